@@ -27,6 +27,12 @@
 #if !defined(SIMDE_ARM_NEON_H)
 #define SIMDE_ARM_NEON_H
 
+#include "neon/div.h"
+#include "neon/recpe.h"
+#include "neon/recps.h"
+#include "neon/rsqrte.h"
+#include "neon/rsqrts.h"
+#include "neon/sqrt.h"
 #include "neon/types.h"
 
 #include "neon/aba.h"
@@ -66,12 +72,24 @@
 #include "neon/dup_n.h"
 #include "neon/eor.h"
 #include "neon/ext.h"
+#include "neon/fma.h"
+#include "neon/fma_lane.h"
+#include "neon/fma_n.h"
+#include "neon/fms.h"
+#include "neon/fms_lane.h"
+#include "neon/fms_n.h"
 #include "neon/get_high.h"
 #include "neon/get_lane.h"
 #include "neon/get_low.h"
 #include "neon/hadd.h"
 #include "neon/hsub.h"
 #include "neon/ld1.h"
+#include "neon/ld1_dup.h"
+#include "neon/ld1_lane.h"
+#include "neon/ld1_x2.h"
+#include "neon/ld1_x3.h"
+#include "neon/ld1_x4.h"
+#include "neon/ld2.h"
 #include "neon/ld3.h"
 #include "neon/ld4.h"
 #include "neon/max.h"
@@ -114,12 +132,16 @@
 #include "neon/qdmull.h"
 #include "neon/qrdmulh.h"
 #include "neon/qrdmulh_n.h"
+#include "neon/qrshrn_n.h"
+#include "neon/qrshrun_n.h"
 #include "neon/qmovn.h"
 #include "neon/qmovun.h"
 #include "neon/qmovn_high.h"
 #include "neon/qneg.h"
 #include "neon/qsub.h"
 #include "neon/qshl.h"
+#include "neon/qshrn_n.h"
+#include "neon/qshrun_n.h"
 #include "neon/qtbl.h"
 #include "neon/qtbx.h"
 #include "neon/rbit.h"
@@ -135,14 +157,19 @@
 #include "neon/rndp.h"
 #include "neon/rshl.h"
 #include "neon/rshr_n.h"
+#include "neon/rshrn_n.h"
 #include "neon/rsra_n.h"
 #include "neon/set_lane.h"
 #include "neon/shl.h"
 #include "neon/shl_n.h"
 #include "neon/shr_n.h"
+#include "neon/shrn_n.h"
+#include "neon/sli_n.h"
 #include "neon/sra_n.h"
+#include "neon/sri_n.h"
 #include "neon/st1.h"
 #include "neon/st1_lane.h"
+#include "neon/st2.h"
 #include "neon/st3.h"
 #include "neon/st4.h"
 #include "neon/sub.h"
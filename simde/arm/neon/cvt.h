@@ -58,8 +58,18 @@ int32_t
 simde_vcvts_s32_f32(simde_float32 a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vcvts_s32_f32(a);
+  #elif defined(SIMDE_FAST_CONVERSION_RANGE)
+    return SIMDE_CONVERT_FTOI(int32_t, a);
   #else
-    return HEDLEY_STATIC_CAST(int32_t, a);
+    #if !defined(SIMDE_FAST_NANS)
+      if (simde_math_isnanf(a)) {
+        return 0;
+      }
+    #endif
+    return
+      (a <= HEDLEY_STATIC_CAST(simde_float32, INT32_MIN)) ? INT32_MIN :
+      (a >= HEDLEY_STATIC_CAST(simde_float32, INT32_MAX)) ? INT32_MAX :
+      SIMDE_CONVERT_FTOI(int32_t, a);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -72,8 +82,18 @@ uint32_t
 simde_vcvts_u32_f32(simde_float32 a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
     return vcvts_u32_f32(a);
-  #else
+  #elif defined(SIMDE_FAST_CONVERSION_RANGE)
     return HEDLEY_STATIC_CAST(uint32_t, (a < 0) ? 0 : a);
+  #else
+    #if !defined(SIMDE_FAST_NANS)
+      if (simde_math_isnanf(a)) {
+        return 0;
+      }
+    #endif
+    return
+      (a <= SIMDE_FLOAT32_C(0.0)) ? 0 :
+      (a >= HEDLEY_STATIC_CAST(simde_float32, UINT32_MAX)) ? UINT32_MAX :
+      SIMDE_CONVERT_FTOI(uint32_t, a);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -115,8 +135,18 @@ int64_t
 simde_vcvtd_s64_f64(simde_float64 a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vcvtd_s64_f64(a);
+  #elif defined(SIMDE_FAST_CONVERSION_RANGE)
+    return SIMDE_CONVERT_FTOI(int64_t, a);
   #else
-    return HEDLEY_STATIC_CAST(int64_t, a);
+    #if !defined(SIMDE_FAST_NANS)
+      if (simde_math_isnan(a)) {
+        return 0;
+      }
+    #endif
+    return
+      (a <= HEDLEY_STATIC_CAST(simde_float64, INT64_MIN)) ? INT64_MIN :
+      (a >= HEDLEY_STATIC_CAST(simde_float64, INT64_MAX)) ? INT64_MAX :
+      SIMDE_CONVERT_FTOI(int64_t, a);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -129,8 +159,18 @@ uint64_t
 simde_vcvtd_u64_f64(simde_float64 a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
     return vcvtd_u64_f64(a);
-  #else
+  #elif defined(SIMDE_FAST_CONVERSION_RANGE)
     return HEDLEY_STATIC_CAST(uint64_t, (a < 0) ? 0 : a);
+  #else
+    #if !defined(SIMDE_FAST_NANS)
+      if (simde_math_isnan(a)) {
+        return 0;
+      }
+    #endif
+    return
+      (a <= SIMDE_FLOAT64_C(0.0)) ? 0 :
+      (a >= HEDLEY_STATIC_CAST(simde_float64, UINT64_MAX)) ? UINT64_MAX :
+      SIMDE_CONVERT_FTOI(uint64_t, a);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -251,6 +291,18 @@ simde_int32x4_t
 simde_vcvtq_s32_f32(simde_float32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vcvtq_s32_f32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* cvttps2dq returns INT32_MIN for NaN and for anything out of
+     * range; flip it to INT32_MAX for large positive lanes and clear
+     * it for NaN lanes. */
+    __m128i r = _mm_cvttps_epi32(a);
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      r = _mm_xor_si128(r, _mm_castps_si128(_mm_cmpge_ps(a, _mm_set1_ps(SIMDE_FLOAT32_C(2147483648.0)))));
+      #if !defined(SIMDE_FAST_NANS)
+        r = _mm_and_si128(r, _mm_castps_si128(_mm_cmpord_ps(a, a)));
+      #endif
+    #endif
+    return r;
   #else
     simde_float32x4_private a_ = simde_float32x4_to_private(a);
     simde_int32x4_private r_;
@@ -271,6 +323,22 @@ simde_uint32x4_t
 simde_vcvtq_u32_f32(simde_float32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
     return vcvtq_u32_f32(a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE)
+    /* max returns its second operand for NaN, so NaN and negative
+     * lanes become 0; vcvttps2udq already saturates the rest. */
+    return _mm_cvttps_epu32(_mm_max_ps(a, _mm_setzero_ps()));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* Lanes >= 2^31 are converted after subtracting 2^31, which is
+     * added back by setting the top bit. */
+    const __m128 x = _mm_max_ps(a, _mm_setzero_ps());
+    const __m128 two31 = _mm_set1_ps(SIMDE_FLOAT32_C(2147483648.0));
+    const __m128 high = _mm_cmpge_ps(x, two31);
+    __m128i r = _mm_cvttps_epi32(_mm_sub_ps(x, _mm_and_ps(high, two31)));
+    r = _mm_xor_si128(r, _mm_slli_epi32(_mm_castps_si128(high), 31));
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      r = _mm_or_si128(r, _mm_castps_si128(_mm_cmpge_ps(x, _mm_set1_ps(SIMDE_FLOAT32_C(4294967296.0)))));
+    #endif
+    return r;
   #else
     simde_float32x4_private a_ = simde_float32x4_to_private(a);
     simde_uint32x4_private r_;
@@ -291,6 +359,15 @@ simde_int64x2_t
 simde_vcvtq_s64_f64(simde_float64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vcvtq_s64_f64(a);
+  #elif defined(SIMDE_X86_AVX512DQ_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    __m128i r = _mm_cvttpd_epi64(a);
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      r = _mm_xor_si128(r, _mm_castpd_si128(_mm_cmpge_pd(a, _mm_set1_pd(SIMDE_FLOAT64_C(9223372036854775808.0)))));
+      #if !defined(SIMDE_FAST_NANS)
+        r = _mm_and_si128(r, _mm_castpd_si128(_mm_cmpord_pd(a, a)));
+      #endif
+    #endif
+    return r;
   #else
     simde_float64x2_private a_ = simde_float64x2_to_private(a);
     simde_int64x2_private r_;
@@ -311,6 +388,8 @@ simde_uint64x2_t
 simde_vcvtq_u64_f64(simde_float64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
     return vcvtq_u64_f64(a);
+  #elif defined(SIMDE_X86_AVX512DQ_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvttpd_epu64(_mm_max_pd(a, _mm_setzero_pd()));
   #else
     simde_float64x2_private a_ = simde_float64x2_to_private(a);
     simde_uint64x2_private r_;
@@ -411,6 +490,8 @@ simde_float32x4_t
 simde_vcvtq_f32_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vcvtq_f32_s32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_cvtepi32_ps(a);
   #else
     simde_int32x4_private a_ = simde_int32x4_to_private(a);
     simde_float32x4_private r_;
@@ -431,6 +512,14 @@ simde_float32x4_t
 simde_vcvtq_f32_u32(simde_uint32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
     return vcvtq_f32_u32(a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtepu32_ps(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* Both halves convert exactly, so the final add is the only
+     * rounding step. */
+    const __m128 lo = _mm_cvtepi32_ps(_mm_and_si128(a, _mm_set1_epi32(0xFFFF)));
+    const __m128 hi = _mm_cvtepi32_ps(_mm_srli_epi32(a, 16));
+    return _mm_add_ps(_mm_mul_ps(hi, _mm_set1_ps(SIMDE_FLOAT32_C(65536.0))), lo);
   #else
     simde_uint32x4_private a_ = simde_uint32x4_to_private(a);
     simde_float32x4_private r_;
@@ -451,6 +540,8 @@ simde_float64x2_t
 simde_vcvtq_f64_s64(simde_int64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vcvtq_f64_s64(a);
+  #elif defined(SIMDE_X86_AVX512DQ_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtepi64_pd(a);
   #else
     simde_int64x2_private a_ = simde_int64x2_to_private(a);
     simde_float64x2_private r_;
@@ -471,6 +562,8 @@ simde_float64x2_t
 simde_vcvtq_f64_u64(simde_uint64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
     return vcvtq_f64_u64(a);
+  #elif defined(SIMDE_X86_AVX512DQ_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtepu64_pd(a);
   #else
     simde_uint64x2_private a_ = simde_uint64x2_to_private(a);
     simde_float64x2_private r_;
@@ -486,6 +579,1017 @@ simde_vcvtq_f64_u64(simde_uint64x2_t a) {
   #define vcvtq_f64_u64(a) simde_vcvtq_f64_u64(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x4_t
+simde_vcvt_f16_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vcvt_f16_f32(a);
+  #else
+    simde_float16x4_private r_;
+
+    #if defined(SIMDE_X86_F16C_NATIVE)
+      _mm_storel_epi64(HEDLEY_REINTERPRET_CAST(__m128i*, r_.values), _mm_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT));
+    #else
+      simde_float32x4_private a_ = simde_float32x4_to_private(a);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_float16_from_float32(a_.values[i]);
+      }
+    #endif
+
+    return simde_float16x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_f16_f32
+  #define vcvt_f16_f32(a) simde_vcvt_f16_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x8_t
+simde_vcvt_high_f16_f32(simde_float16x4_t r, simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vcvt_high_f16_f32(r, a);
+  #else
+    simde_float16x4_private
+      lo_ = simde_float16x4_to_private(r),
+      hi_ = simde_float16x4_to_private(simde_vcvt_f16_f32(a));
+    simde_float16x8_private r_;
+
+    simde_memcpy(&(r_.values[0]), lo_.values, sizeof(lo_.values));
+    simde_memcpy(&(r_.values[4]), hi_.values, sizeof(hi_.values));
+
+    return simde_float16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_high_f16_f32
+  #define vcvt_high_f16_f32(r, a) simde_vcvt_high_f16_f32((r), (a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvt_f32_f16(simde_float16x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vcvt_f32_f16(a);
+  #else
+    simde_float16x4_private a_ = simde_float16x4_to_private(a);
+
+    #if defined(SIMDE_X86_F16C_NATIVE)
+      return _mm_cvtph_ps(_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const __m128i*, a_.values)));
+    #else
+      simde_float32x4_private r_;
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_float16_to_float32(a_.values[i]);
+      }
+
+      return simde_float32x4_from_private(r_);
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_f32_f16
+  #define vcvt_f32_f16(a) simde_vcvt_f32_f16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvt_high_f32_f16(simde_float16x8_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vcvt_high_f32_f16(a);
+  #else
+    simde_float16x8_private a_ = simde_float16x8_to_private(a);
+    simde_float16x4_private hi_;
+
+    simde_memcpy(hi_.values, &(a_.values[4]), sizeof(hi_.values));
+
+    return simde_vcvt_f32_f16(simde_float16x4_from_private(hi_));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_high_f32_f16
+  #define vcvt_high_f32_f16(a) simde_vcvt_high_f32_f16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_vcvtns_s32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtns_s32_f32(a);
+  #else
+    return simde_vcvts_s32_f32(simde_math_roundevenf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtns_s32_f32
+  #define vcvtns_s32_f32(a) simde_vcvtns_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vcvtns_u32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtns_u32_f32(a);
+  #else
+    return simde_vcvts_u32_f32(simde_math_roundevenf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtns_u32_f32
+  #define vcvtns_u32_f32(a) simde_vcvtns_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vcvtnd_s64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtnd_s64_f64(a);
+  #else
+    return simde_vcvtd_s64_f64(simde_math_roundeven(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtnd_s64_f64
+  #define vcvtnd_s64_f64(a) simde_vcvtnd_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vcvtnd_u64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtnd_u64_f64(a);
+  #else
+    return simde_vcvtd_u64_f64(simde_math_roundeven(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtnd_u64_f64
+  #define vcvtnd_u64_f64(a) simde_vcvtnd_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vcvtn_s32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtn_s32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_int32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtns_s32_f32(a_.values[i]);
+    }
+    return simde_int32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtn_s32_f32
+  #define vcvtn_s32_f32(a) simde_vcvtn_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vcvtn_u32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtn_u32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_uint32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtns_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtn_u32_f32
+  #define vcvtn_u32_f32(a) simde_vcvtn_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1_t
+simde_vcvtn_s64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtn_s64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_int64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtnd_s64_f64(a_.values[i]);
+    }
+    return simde_int64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtn_s64_f64
+  #define vcvtn_s64_f64(a) simde_vcvtn_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1_t
+simde_vcvtn_u64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtn_u64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_uint64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtnd_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtn_u64_f64
+  #define vcvtn_u64_f64(a) simde_vcvtn_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vcvtnq_s32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtnq_s32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_s32_f32(_mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_int32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtns_s32_f32(a_.values[i]);
+    }
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtnq_s32_f32
+  #define vcvtnq_s32_f32(a) simde_vcvtnq_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vcvtnq_u32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtnq_u32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_u32_f32(_mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_uint32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtns_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtnq_u32_f32
+  #define vcvtnq_u32_f32(a) simde_vcvtnq_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vcvtnq_s64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtnq_s64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_s64_f64(_mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_int64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtnd_s64_f64(a_.values[i]);
+    }
+    return simde_int64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtnq_s64_f64
+  #define vcvtnq_s64_f64(a) simde_vcvtnq_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vcvtnq_u64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtnq_u64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_u64_f64(_mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_uint64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtnd_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtnq_u64_f64
+  #define vcvtnq_u64_f64(a) simde_vcvtnq_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_vcvtms_s32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtms_s32_f32(a);
+  #else
+    return simde_vcvts_s32_f32(simde_math_floorf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtms_s32_f32
+  #define vcvtms_s32_f32(a) simde_vcvtms_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vcvtms_u32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtms_u32_f32(a);
+  #else
+    return simde_vcvts_u32_f32(simde_math_floorf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtms_u32_f32
+  #define vcvtms_u32_f32(a) simde_vcvtms_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vcvtmd_s64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtmd_s64_f64(a);
+  #else
+    return simde_vcvtd_s64_f64(simde_math_floor(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmd_s64_f64
+  #define vcvtmd_s64_f64(a) simde_vcvtmd_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vcvtmd_u64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtmd_u64_f64(a);
+  #else
+    return simde_vcvtd_u64_f64(simde_math_floor(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmd_u64_f64
+  #define vcvtmd_u64_f64(a) simde_vcvtmd_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vcvtm_s32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtm_s32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_int32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtms_s32_f32(a_.values[i]);
+    }
+    return simde_int32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtm_s32_f32
+  #define vcvtm_s32_f32(a) simde_vcvtm_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vcvtm_u32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtm_u32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_uint32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtms_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtm_u32_f32
+  #define vcvtm_u32_f32(a) simde_vcvtm_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1_t
+simde_vcvtm_s64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtm_s64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_int64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtmd_s64_f64(a_.values[i]);
+    }
+    return simde_int64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtm_s64_f64
+  #define vcvtm_s64_f64(a) simde_vcvtm_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1_t
+simde_vcvtm_u64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtm_u64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_uint64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtmd_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtm_u64_f64
+  #define vcvtm_u64_f64(a) simde_vcvtm_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vcvtmq_s32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtmq_s32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_s32_f32(_mm_round_ps(a, _MM_FROUND_TO_NEG_INF));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_int32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtms_s32_f32(a_.values[i]);
+    }
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_s32_f32
+  #define vcvtmq_s32_f32(a) simde_vcvtmq_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vcvtmq_u32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtmq_u32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_u32_f32(_mm_round_ps(a, _MM_FROUND_TO_NEG_INF));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_uint32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtms_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_u32_f32
+  #define vcvtmq_u32_f32(a) simde_vcvtmq_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vcvtmq_s64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtmq_s64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_s64_f64(_mm_round_pd(a, _MM_FROUND_TO_NEG_INF));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_int64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtmd_s64_f64(a_.values[i]);
+    }
+    return simde_int64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_s64_f64
+  #define vcvtmq_s64_f64(a) simde_vcvtmq_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vcvtmq_u64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtmq_u64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_u64_f64(_mm_round_pd(a, _MM_FROUND_TO_NEG_INF));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_uint64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtmd_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_u64_f64
+  #define vcvtmq_u64_f64(a) simde_vcvtmq_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_vcvtps_s32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtps_s32_f32(a);
+  #else
+    return simde_vcvts_s32_f32(simde_math_ceilf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtps_s32_f32
+  #define vcvtps_s32_f32(a) simde_vcvtps_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vcvtps_u32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtps_u32_f32(a);
+  #else
+    return simde_vcvts_u32_f32(simde_math_ceilf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtps_u32_f32
+  #define vcvtps_u32_f32(a) simde_vcvtps_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vcvtpd_s64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtpd_s64_f64(a);
+  #else
+    return simde_vcvtd_s64_f64(simde_math_ceil(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtpd_s64_f64
+  #define vcvtpd_s64_f64(a) simde_vcvtpd_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vcvtpd_u64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtpd_u64_f64(a);
+  #else
+    return simde_vcvtd_u64_f64(simde_math_ceil(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtpd_u64_f64
+  #define vcvtpd_u64_f64(a) simde_vcvtpd_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vcvtp_s32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtp_s32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_int32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtps_s32_f32(a_.values[i]);
+    }
+    return simde_int32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtp_s32_f32
+  #define vcvtp_s32_f32(a) simde_vcvtp_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vcvtp_u32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtp_u32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_uint32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtps_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtp_u32_f32
+  #define vcvtp_u32_f32(a) simde_vcvtp_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1_t
+simde_vcvtp_s64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtp_s64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_int64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtpd_s64_f64(a_.values[i]);
+    }
+    return simde_int64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtp_s64_f64
+  #define vcvtp_s64_f64(a) simde_vcvtp_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1_t
+simde_vcvtp_u64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtp_u64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_uint64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtpd_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtp_u64_f64
+  #define vcvtp_u64_f64(a) simde_vcvtp_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vcvtpq_s32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtpq_s32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_s32_f32(_mm_round_ps(a, _MM_FROUND_TO_POS_INF));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_int32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtps_s32_f32(a_.values[i]);
+    }
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtpq_s32_f32
+  #define vcvtpq_s32_f32(a) simde_vcvtpq_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vcvtpq_u32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtpq_u32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_u32_f32(_mm_round_ps(a, _MM_FROUND_TO_POS_INF));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_uint32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtps_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtpq_u32_f32
+  #define vcvtpq_u32_f32(a) simde_vcvtpq_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vcvtpq_s64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtpq_s64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_s64_f64(_mm_round_pd(a, _MM_FROUND_TO_POS_INF));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_int64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtpd_s64_f64(a_.values[i]);
+    }
+    return simde_int64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtpq_s64_f64
+  #define vcvtpq_s64_f64(a) simde_vcvtpq_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vcvtpq_u64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtpq_u64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vcvtq_u64_f64(_mm_round_pd(a, _MM_FROUND_TO_POS_INF));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_uint64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtpd_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtpq_u64_f64
+  #define vcvtpq_u64_f64(a) simde_vcvtpq_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_vcvtas_s32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtas_s32_f32(a);
+  #else
+    return simde_vcvts_s32_f32(simde_math_roundf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtas_s32_f32
+  #define vcvtas_s32_f32(a) simde_vcvtas_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vcvtas_u32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtas_u32_f32(a);
+  #else
+    return simde_vcvts_u32_f32(simde_math_roundf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtas_u32_f32
+  #define vcvtas_u32_f32(a) simde_vcvtas_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vcvtad_s64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtad_s64_f64(a);
+  #else
+    return simde_vcvtd_s64_f64(simde_math_round(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtad_s64_f64
+  #define vcvtad_s64_f64(a) simde_vcvtad_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vcvtad_u64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtad_u64_f64(a);
+  #else
+    return simde_vcvtd_u64_f64(simde_math_round(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtad_u64_f64
+  #define vcvtad_u64_f64(a) simde_vcvtad_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vcvta_s32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvta_s32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_int32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtas_s32_f32(a_.values[i]);
+    }
+    return simde_int32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvta_s32_f32
+  #define vcvta_s32_f32(a) simde_vcvta_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vcvta_u32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvta_u32_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+    simde_uint32x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtas_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvta_u32_f32
+  #define vcvta_u32_f32(a) simde_vcvta_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1_t
+simde_vcvta_s64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvta_s64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_int64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtad_s64_f64(a_.values[i]);
+    }
+    return simde_int64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvta_s64_f64
+  #define vcvta_s64_f64(a) simde_vcvta_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1_t
+simde_vcvta_u64_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvta_u64_f64(a);
+  #else
+    simde_float64x1_private a_ = simde_float64x1_to_private(a);
+    simde_uint64x1_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtad_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvta_u64_f64
+  #define vcvta_u64_f64(a) simde_vcvta_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vcvtaq_s32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtaq_s32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    /* Truncate, then step away from zero wherever at least half
+     * was discarded. */
+    const __m128 sign = _mm_set1_ps(-SIMDE_FLOAT32_C(0.0));
+    const __m128 t = _mm_round_ps(a, _MM_FROUND_TO_ZERO);
+    const __m128 half = _mm_cmpge_ps(_mm_andnot_ps(sign, _mm_sub_ps(a, t)), _mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+    return simde_vcvtq_s32_f32(_mm_add_ps(t, _mm_and_ps(half, _mm_or_ps(_mm_and_ps(a, sign), _mm_set1_ps(SIMDE_FLOAT32_C(1.0))))));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_int32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtas_s32_f32(a_.values[i]);
+    }
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtaq_s32_f32
+  #define vcvtaq_s32_f32(a) simde_vcvtaq_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vcvtaq_u32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtaq_u32_f32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    /* Truncate, then step away from zero wherever at least half
+     * was discarded. */
+    const __m128 sign = _mm_set1_ps(-SIMDE_FLOAT32_C(0.0));
+    const __m128 t = _mm_round_ps(a, _MM_FROUND_TO_ZERO);
+    const __m128 half = _mm_cmpge_ps(_mm_andnot_ps(sign, _mm_sub_ps(a, t)), _mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+    return simde_vcvtq_u32_f32(_mm_add_ps(t, _mm_and_ps(half, _mm_or_ps(_mm_and_ps(a, sign), _mm_set1_ps(SIMDE_FLOAT32_C(1.0))))));
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_uint32x4_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtas_u32_f32(a_.values[i]);
+    }
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtaq_u32_f32
+  #define vcvtaq_u32_f32(a) simde_vcvtaq_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vcvtaq_s64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtaq_s64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    /* Truncate, then step away from zero wherever at least half
+     * was discarded. */
+    const __m128d sign = _mm_set1_pd(-SIMDE_FLOAT64_C(0.0));
+    const __m128d t = _mm_round_pd(a, _MM_FROUND_TO_ZERO);
+    const __m128d half = _mm_cmpge_pd(_mm_andnot_pd(sign, _mm_sub_pd(a, t)), _mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+    return simde_vcvtq_s64_f64(_mm_add_pd(t, _mm_and_pd(half, _mm_or_pd(_mm_and_pd(a, sign), _mm_set1_pd(SIMDE_FLOAT64_C(1.0))))));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_int64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtad_s64_f64(a_.values[i]);
+    }
+    return simde_int64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtaq_s64_f64
+  #define vcvtaq_s64_f64(a) simde_vcvtaq_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vcvtaq_u64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_CLANG_46844)
+    return vcvtaq_u64_f64(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    /* Truncate, then step away from zero wherever at least half
+     * was discarded. */
+    const __m128d sign = _mm_set1_pd(-SIMDE_FLOAT64_C(0.0));
+    const __m128d t = _mm_round_pd(a, _MM_FROUND_TO_ZERO);
+    const __m128d half = _mm_cmpge_pd(_mm_andnot_pd(sign, _mm_sub_pd(a, t)), _mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+    return simde_vcvtq_u64_f64(_mm_add_pd(t, _mm_and_pd(half, _mm_or_pd(_mm_and_pd(a, sign), _mm_set1_pd(SIMDE_FLOAT64_C(1.0))))));
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+    simde_uint64x2_private r_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vcvtad_u64_f64(a_.values[i]);
+    }
+    return simde_uint64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtaq_u64_f64
+  #define vcvtaq_u64_f64(a) simde_vcvtaq_u64_f64(a)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -0,0 +1,440 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_ARM_NEON_LD1_X4_H)
+#define SIMDE_ARM_NEON_LD1_X4_H
+
+#include "types.h"
+#include "ld1.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2x4_t
+simde_vld1_f32_x4(simde_float32 const ptr[HEDLEY_ARRAY_PARAM(8)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_f32_x4(ptr);
+  #else
+    simde_float32x2x4_t r = { {
+      simde_vld1_f32(ptr),
+      simde_vld1_f32(ptr + 2),
+      simde_vld1_f32(ptr + 4),
+      simde_vld1_f32(ptr + 6)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_f32_x4
+  #define vld1_f32_x4(a) simde_vld1_f32_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1x4_t
+simde_vld1_f64_x4(simde_float64 const ptr[HEDLEY_ARRAY_PARAM(4)]) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_f64_x4(ptr);
+  #else
+    simde_float64x1x4_t r = { {
+      simde_vld1_f64(ptr),
+      simde_vld1_f64(ptr + 1),
+      simde_vld1_f64(ptr + 2),
+      simde_vld1_f64(ptr + 3)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld1_f64_x4
+  #define vld1_f64_x4(a) simde_vld1_f64_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x8x4_t
+simde_vld1_s8_x4(int8_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_s8_x4(ptr);
+  #else
+    simde_int8x8x4_t r = { {
+      simde_vld1_s8(ptr),
+      simde_vld1_s8(ptr + 8),
+      simde_vld1_s8(ptr + 16),
+      simde_vld1_s8(ptr + 24)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_s8_x4
+  #define vld1_s8_x4(a) simde_vld1_s8_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x4x4_t
+simde_vld1_s16_x4(int16_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_s16_x4(ptr);
+  #else
+    simde_int16x4x4_t r = { {
+      simde_vld1_s16(ptr),
+      simde_vld1_s16(ptr + 4),
+      simde_vld1_s16(ptr + 8),
+      simde_vld1_s16(ptr + 12)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_s16_x4
+  #define vld1_s16_x4(a) simde_vld1_s16_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2x4_t
+simde_vld1_s32_x4(int32_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_s32_x4(ptr);
+  #else
+    simde_int32x2x4_t r = { {
+      simde_vld1_s32(ptr),
+      simde_vld1_s32(ptr + 2),
+      simde_vld1_s32(ptr + 4),
+      simde_vld1_s32(ptr + 6)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_s32_x4
+  #define vld1_s32_x4(a) simde_vld1_s32_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1x4_t
+simde_vld1_s64_x4(int64_t const ptr[HEDLEY_ARRAY_PARAM(4)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_s64_x4(ptr);
+  #else
+    simde_int64x1x4_t r = { {
+      simde_vld1_s64(ptr),
+      simde_vld1_s64(ptr + 1),
+      simde_vld1_s64(ptr + 2),
+      simde_vld1_s64(ptr + 3)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_s64_x4
+  #define vld1_s64_x4(a) simde_vld1_s64_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x8x4_t
+simde_vld1_u8_x4(uint8_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_u8_x4(ptr);
+  #else
+    simde_uint8x8x4_t r = { {
+      simde_vld1_u8(ptr),
+      simde_vld1_u8(ptr + 8),
+      simde_vld1_u8(ptr + 16),
+      simde_vld1_u8(ptr + 24)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_u8_x4
+  #define vld1_u8_x4(a) simde_vld1_u8_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x4x4_t
+simde_vld1_u16_x4(uint16_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_u16_x4(ptr);
+  #else
+    simde_uint16x4x4_t r = { {
+      simde_vld1_u16(ptr),
+      simde_vld1_u16(ptr + 4),
+      simde_vld1_u16(ptr + 8),
+      simde_vld1_u16(ptr + 12)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_u16_x4
+  #define vld1_u16_x4(a) simde_vld1_u16_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2x4_t
+simde_vld1_u32_x4(uint32_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_u32_x4(ptr);
+  #else
+    simde_uint32x2x4_t r = { {
+      simde_vld1_u32(ptr),
+      simde_vld1_u32(ptr + 2),
+      simde_vld1_u32(ptr + 4),
+      simde_vld1_u32(ptr + 6)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_u32_x4
+  #define vld1_u32_x4(a) simde_vld1_u32_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1x4_t
+simde_vld1_u64_x4(uint64_t const ptr[HEDLEY_ARRAY_PARAM(4)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1_u64_x4(ptr);
+  #else
+    simde_uint64x1x4_t r = { {
+      simde_vld1_u64(ptr),
+      simde_vld1_u64(ptr + 1),
+      simde_vld1_u64(ptr + 2),
+      simde_vld1_u64(ptr + 3)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1_u64_x4
+  #define vld1_u64_x4(a) simde_vld1_u64_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4x4_t
+simde_vld1q_f32_x4(simde_float32 const ptr[HEDLEY_ARRAY_PARAM(16)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_f32_x4(ptr);
+  #else
+    simde_float32x4x4_t r = { {
+      simde_vld1q_f32(ptr),
+      simde_vld1q_f32(ptr + 4),
+      simde_vld1q_f32(ptr + 8),
+      simde_vld1q_f32(ptr + 12)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_f32_x4
+  #define vld1q_f32_x4(a) simde_vld1q_f32_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2x4_t
+simde_vld1q_f64_x4(simde_float64 const ptr[HEDLEY_ARRAY_PARAM(8)]) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_f64_x4(ptr);
+  #else
+    simde_float64x2x4_t r = { {
+      simde_vld1q_f64(ptr),
+      simde_vld1q_f64(ptr + 2),
+      simde_vld1q_f64(ptr + 4),
+      simde_vld1q_f64(ptr + 6)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_f64_x4
+  #define vld1q_f64_x4(a) simde_vld1q_f64_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x16x4_t
+simde_vld1q_s8_x4(int8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_s8_x4(ptr);
+  #else
+    simde_int8x16x4_t r = { {
+      simde_vld1q_s8(ptr),
+      simde_vld1q_s8(ptr + 16),
+      simde_vld1q_s8(ptr + 32),
+      simde_vld1q_s8(ptr + 48)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_s8_x4
+  #define vld1q_s8_x4(a) simde_vld1q_s8_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x8x4_t
+simde_vld1q_s16_x4(int16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_s16_x4(ptr);
+  #else
+    simde_int16x8x4_t r = { {
+      simde_vld1q_s16(ptr),
+      simde_vld1q_s16(ptr + 8),
+      simde_vld1q_s16(ptr + 16),
+      simde_vld1q_s16(ptr + 24)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_s16_x4
+  #define vld1q_s16_x4(a) simde_vld1q_s16_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4x4_t
+simde_vld1q_s32_x4(int32_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_s32_x4(ptr);
+  #else
+    simde_int32x4x4_t r = { {
+      simde_vld1q_s32(ptr),
+      simde_vld1q_s32(ptr + 4),
+      simde_vld1q_s32(ptr + 8),
+      simde_vld1q_s32(ptr + 12)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_s32_x4
+  #define vld1q_s32_x4(a) simde_vld1q_s32_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2x4_t
+simde_vld1q_s64_x4(int64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_s64_x4(ptr);
+  #else
+    simde_int64x2x4_t r = { {
+      simde_vld1q_s64(ptr),
+      simde_vld1q_s64(ptr + 2),
+      simde_vld1q_s64(ptr + 4),
+      simde_vld1q_s64(ptr + 6)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_s64_x4
+  #define vld1q_s64_x4(a) simde_vld1q_s64_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16x4_t
+simde_vld1q_u8_x4(uint8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_u8_x4(ptr);
+  #else
+    simde_uint8x16x4_t r = { {
+      simde_vld1q_u8(ptr),
+      simde_vld1q_u8(ptr + 16),
+      simde_vld1q_u8(ptr + 32),
+      simde_vld1q_u8(ptr + 48)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_u8_x4
+  #define vld1q_u8_x4(a) simde_vld1q_u8_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x8x4_t
+simde_vld1q_u16_x4(uint16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_u16_x4(ptr);
+  #else
+    simde_uint16x8x4_t r = { {
+      simde_vld1q_u16(ptr),
+      simde_vld1q_u16(ptr + 8),
+      simde_vld1q_u16(ptr + 16),
+      simde_vld1q_u16(ptr + 24)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_u16_x4
+  #define vld1q_u16_x4(a) simde_vld1q_u16_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4x4_t
+simde_vld1q_u32_x4(uint32_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_u32_x4(ptr);
+  #else
+    simde_uint32x4x4_t r = { {
+      simde_vld1q_u32(ptr),
+      simde_vld1q_u32(ptr + 4),
+      simde_vld1q_u32(ptr + 8),
+      simde_vld1q_u32(ptr + 12)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_u32_x4
+  #define vld1q_u32_x4(a) simde_vld1q_u32_x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2x4_t
+simde_vld1q_u64_x4(uint64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && !defined(SIMDE_BUG_GCC_ARM_VLD1_XN)
+    return vld1q_u64_x4(ptr);
+  #else
+    simde_uint64x2x4_t r = { {
+      simde_vld1q_u64(ptr),
+      simde_vld1q_u64(ptr + 2),
+      simde_vld1q_u64(ptr + 4),
+      simde_vld1q_u64(ptr + 6)
+    } };
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld1q_u64_x4
+  #define vld1q_u64_x4(a) simde_vld1q_u64_x4((a))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_LD1_X4_H) */
@@ -325,6 +325,17 @@ simde_float32x4x3_t
 simde_vld3q_f32(simde_float32 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_f32(ptr);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    /* a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 */
+    const __m128 a = _mm_loadu_ps(ptr);
+    const __m128 b = _mm_loadu_ps(ptr + 4);
+    const __m128 c = _mm_loadu_ps(ptr + 8);
+    simde_float32x4x3_t r = { {
+      _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 3, 0)),
+      _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 2, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0)),
+      _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 1, 0, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0))
+    } };
+    return r;
   #else
     simde_float32x4_private r_[3];
 
@@ -353,6 +364,17 @@ simde_float64x2x3_t
 simde_vld3q_f64(simde_float64 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_f64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* a = x0 y0, b = z0 x1, c = y1 z1 */
+    const __m128d a = _mm_loadu_pd(ptr);
+    const __m128d b = _mm_loadu_pd(ptr + 2);
+    const __m128d c = _mm_loadu_pd(ptr + 4);
+    simde_float64x2x3_t r = { {
+      _mm_shuffle_pd(a, b, 2),
+      _mm_shuffle_pd(a, c, 1),
+      _mm_shuffle_pd(b, c, 2)
+    } };
+    return r;
   #else
     simde_float64x2_private r_[3];
 
@@ -381,6 +403,28 @@ simde_int8x16x3_t
 simde_vld3q_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i a = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr));
+    const __m128i b = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16));
+    const __m128i c = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 32));
+    simde_int8x16x3_t r = { {
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8( 0,  3,  6,  9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1,  2,  5,  8, 11, 14, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  1,  4,  7, 10, 13))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8( 1,  4,  7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1,  0,  3,  6,  9, 12, 15, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  5,  8, 11, 14))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8( 2,  5,  8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1,  1,  4,  7, 10, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  3,  6,  9, 12, 15)))
+    } };
+    return r;
   #else
     simde_int8x16_private r_[3];
 
@@ -409,6 +453,28 @@ simde_int16x8x3_t
 simde_vld3q_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i a = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr));
+    const __m128i b = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 8));
+    const __m128i c = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16));
+    simde_int16x8x3_t r = { {
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8( 0,  1,  6,  7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1,  2,  3,  8,  9, 14, 15, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  4,  5, 10, 11))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8( 2,  3,  8,  9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1,  4,  5, 10, 11, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  1,  6,  7, 12, 13))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8( 4,  5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1,  0,  1,  6,  7, 12, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  3,  8,  9, 14, 15)))
+    } };
+    return r;
   #else
     simde_int16x8_private r_[3];
 
@@ -437,6 +503,10 @@ simde_int32x4x3_t
 simde_vld3q_s32(int32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4x3_t f = simde_vld3q_f32(HEDLEY_REINTERPRET_CAST(simde_float32 const*, ptr));
+    simde_int32x4x3_t r = { { _mm_castps_si128(f.val[0]), _mm_castps_si128(f.val[1]), _mm_castps_si128(f.val[2]) } };
+    return r;
   #else
     simde_int32x4_private r_[3];
 
@@ -465,6 +535,10 @@ simde_int64x2x3_t
 simde_vld3q_s64(int64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_s64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2x3_t f = simde_vld3q_f64(HEDLEY_REINTERPRET_CAST(simde_float64 const*, ptr));
+    simde_int64x2x3_t r = { { _mm_castpd_si128(f.val[0]), _mm_castpd_si128(f.val[1]), _mm_castpd_si128(f.val[2]) } };
+    return r;
   #else
     simde_int64x2_private r_[3];
 
@@ -494,6 +568,10 @@ simde_uint8x16x3_t
 simde_vld3q_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16x3_t s = simde_vld3q_s8(HEDLEY_REINTERPRET_CAST(int8_t const*, ptr));
+    simde_uint8x16x3_t r = { { s.val[0], s.val[1], s.val[2] } };
+    return r;
   #else
     simde_uint8x16_private r_[3];
 
@@ -522,6 +600,10 @@ simde_uint16x8x3_t
 simde_vld3q_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int16x8x3_t s = simde_vld3q_s16(HEDLEY_REINTERPRET_CAST(int16_t const*, ptr));
+    simde_uint16x8x3_t r = { { s.val[0], s.val[1], s.val[2] } };
+    return r;
   #else
     simde_uint16x8_private r_[3];
 
@@ -550,6 +632,10 @@ simde_uint32x4x3_t
 simde_vld3q_u32(uint32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4x3_t s = simde_vld3q_s32(HEDLEY_REINTERPRET_CAST(int32_t const*, ptr));
+    simde_uint32x4x3_t r = { { s.val[0], s.val[1], s.val[2] } };
+    return r;
   #else
     simde_uint32x4_private r_[3];
 
@@ -578,6 +664,10 @@ simde_uint64x2x3_t
 simde_vld3q_u64(uint64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_u64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2x3_t s = simde_vld3q_s64(HEDLEY_REINTERPRET_CAST(int64_t const*, ptr));
+    simde_uint64x2x3_t r = { { s.val[0], s.val[1], s.val[2] } };
+    return r;
   #else
     simde_uint64x2_private r_[3];
 
@@ -244,6 +244,14 @@ simde_float32x4x4_t
 simde_vld4q_f32(simde_float32 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_f32(ptr);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    __m128 a = _mm_loadu_ps(ptr);
+    __m128 b = _mm_loadu_ps(ptr + 4);
+    __m128 c = _mm_loadu_ps(ptr + 8);
+    __m128 d = _mm_loadu_ps(ptr + 12);
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    simde_float32x4x4_t r = { { a, b, c, d } };
+    return r;
   #else
     simde_float32x4_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_float32x4_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -264,6 +272,18 @@ simde_float64x2x4_t
 simde_vld4q_f64(simde_float64 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_f64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d a = _mm_loadu_pd(ptr);
+    const __m128d b = _mm_loadu_pd(ptr + 2);
+    const __m128d c = _mm_loadu_pd(ptr + 4);
+    const __m128d d = _mm_loadu_pd(ptr + 6);
+    simde_float64x2x4_t r = { {
+      _mm_unpacklo_pd(a, c),
+      _mm_unpackhi_pd(a, c),
+      _mm_unpacklo_pd(b, d),
+      _mm_unpackhi_pd(b, d)
+    } };
+    return r;
   #else
     simde_float64x2_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_float64x2_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -284,6 +304,25 @@ simde_int8x16x4_t
 simde_vld4q_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    /* Gather each group of four elements within a vector, then
+     * transpose the 4x4 matrix of 32-bit groups. */
+    const __m128i idx = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)), idx);
+    const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)), idx);
+    const __m128i c = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 32)), idx);
+    const __m128i d = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 48)), idx);
+    const __m128i t0 = _mm_unpacklo_epi32(a, b);
+    const __m128i t1 = _mm_unpacklo_epi32(c, d);
+    const __m128i t2 = _mm_unpackhi_epi32(a, b);
+    const __m128i t3 = _mm_unpackhi_epi32(c, d);
+    simde_int8x16x4_t r = { {
+      _mm_unpacklo_epi64(t0, t1),
+      _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3),
+      _mm_unpackhi_epi64(t2, t3)
+    } };
+    return r;
   #else
     simde_int8x16_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_int8x16_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -304,6 +343,28 @@ simde_int16x8x4_t
 simde_vld4q_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s16(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* x0 y0 z0 w0 x1 y1 z1 w1 -> x0 x1 y0 y1 z0 z1 w0 w1, then
+     * transpose the 4x4 matrix of 32-bit pairs. */
+    __m128i a = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr));
+    __m128i b = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 8));
+    __m128i c = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16));
+    __m128i d = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 24));
+    a = _mm_unpacklo_epi16(a, _mm_unpackhi_epi64(a, a));
+    b = _mm_unpacklo_epi16(b, _mm_unpackhi_epi64(b, b));
+    c = _mm_unpacklo_epi16(c, _mm_unpackhi_epi64(c, c));
+    d = _mm_unpacklo_epi16(d, _mm_unpackhi_epi64(d, d));
+    const __m128i t0 = _mm_unpacklo_epi32(a, b);
+    const __m128i t1 = _mm_unpacklo_epi32(c, d);
+    const __m128i t2 = _mm_unpackhi_epi32(a, b);
+    const __m128i t3 = _mm_unpackhi_epi32(c, d);
+    simde_int16x8x4_t r = { {
+      _mm_unpacklo_epi64(t0, t1),
+      _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3),
+      _mm_unpackhi_epi64(t2, t3)
+    } };
+    return r;
   #else
     simde_int16x8_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_int16x8_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -324,6 +385,10 @@ simde_int32x4x4_t
 simde_vld4q_s32(int32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4x4_t f = simde_vld4q_f32(HEDLEY_REINTERPRET_CAST(simde_float32 const*, ptr));
+    simde_int32x4x4_t r = { { _mm_castps_si128(f.val[0]), _mm_castps_si128(f.val[1]), _mm_castps_si128(f.val[2]), _mm_castps_si128(f.val[3]) } };
+    return r;
   #else
     simde_int32x4_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_int32x4_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -344,6 +409,10 @@ simde_int64x2x4_t
 simde_vld4q_s64(int64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_s64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2x4_t f = simde_vld4q_f64(HEDLEY_REINTERPRET_CAST(simde_float64 const*, ptr));
+    simde_int64x2x4_t r = { { _mm_castpd_si128(f.val[0]), _mm_castpd_si128(f.val[1]), _mm_castpd_si128(f.val[2]), _mm_castpd_si128(f.val[3]) } };
+    return r;
   #else
     simde_int64x2_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_int64x2_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -365,6 +434,10 @@ simde_uint8x16x4_t
 simde_vld4q_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16x4_t s = simde_vld4q_s8(HEDLEY_REINTERPRET_CAST(int8_t const*, ptr));
+    simde_uint8x16x4_t r = { { s.val[0], s.val[1], s.val[2], s.val[3] } };
+    return r;
   #else
     simde_uint8x16_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_uint8x16_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -385,6 +458,10 @@ simde_uint16x8x4_t
 simde_vld4q_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u16(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int16x8x4_t s = simde_vld4q_s16(HEDLEY_REINTERPRET_CAST(int16_t const*, ptr));
+    simde_uint16x8x4_t r = { { s.val[0], s.val[1], s.val[2], s.val[3] } };
+    return r;
   #else
     simde_uint16x8_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_uint16x8_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -405,6 +482,10 @@ simde_uint32x4x4_t
 simde_vld4q_u32(uint32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4x4_t s = simde_vld4q_s32(HEDLEY_REINTERPRET_CAST(int32_t const*, ptr));
+    simde_uint32x4x4_t r = { { s.val[0], s.val[1], s.val[2], s.val[3] } };
+    return r;
   #else
     simde_uint32x4_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_uint32x4_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -425,6 +506,10 @@ simde_uint64x2x4_t
 simde_vld4q_u64(uint64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_u64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2x4_t s = simde_vld4q_s64(HEDLEY_REINTERPRET_CAST(int64_t const*, ptr));
+    simde_uint64x2x4_t r = { { s.val[0], s.val[1], s.val[2], s.val[3] } };
+    return r;
   #else
     simde_uint64x2_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_uint64x2_t) / sizeof(*ptr)) * 4 ; i++) {
@@ -28,6 +28,7 @@
 #define SIMDE_ARM_NEON_MOVN_H
 
 #include "types.h"
+#include "get_low.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -38,6 +39,10 @@ simde_int8x8_t
 simde_vmovn_s16(simde_int16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmovn_s16(a);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    return simde_vget_low_s8(_mm_shuffle_epi8(a, _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_s8(_mm_packus_epi16(_mm_and_si128(a, _mm_set1_epi16(0x00FF)), _mm_setzero_si128()));
   #else
     simde_int8x8_private r_;
     simde_int16x8_private a_ = simde_int16x8_to_private(a);
@@ -64,6 +69,10 @@ simde_int16x4_t
 simde_vmovn_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmovn_s32(a);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    return simde_vget_low_s16(_mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_s16(_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_setzero_si128()));
   #else
     simde_int16x4_private r_;
     simde_int32x4_private a_ = simde_int32x4_to_private(a);
@@ -90,6 +99,8 @@ simde_int32x2_t
 simde_vmovn_s64(simde_int64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmovn_s64(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_s32(_mm_shuffle_epi32(a, _MM_SHUFFLE(2, 0, 2, 0)));
   #else
     simde_int32x2_private r_;
     simde_int64x2_private a_ = simde_int64x2_to_private(a);
@@ -116,6 +127,10 @@ simde_uint8x8_t
 simde_vmovn_u16(simde_uint16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmovn_u16(a);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    return simde_vget_low_u8(_mm_shuffle_epi8(a, _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_u8(_mm_packus_epi16(_mm_and_si128(a, _mm_set1_epi16(0x00FF)), _mm_setzero_si128()));
   #else
     simde_uint8x8_private r_;
     simde_uint16x8_private a_ = simde_uint16x8_to_private(a);
@@ -142,6 +157,10 @@ simde_uint16x4_t
 simde_vmovn_u32(simde_uint32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmovn_u32(a);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    return simde_vget_low_u16(_mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_u16(_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_setzero_si128()));
   #else
     simde_uint16x4_private r_;
     simde_uint32x4_private a_ = simde_uint32x4_to_private(a);
@@ -168,6 +187,8 @@ simde_uint32x2_t
 simde_vmovn_u64(simde_uint64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmovn_u64(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_u32(_mm_shuffle_epi32(a, _MM_SHUFFLE(2, 0, 2, 0)));
   #else
     simde_uint32x2_private r_;
     simde_uint64x2_private a_ = simde_uint64x2_to_private(a);
@@ -30,6 +30,7 @@
 
 #include "types.h"
 #include "dup_n.h"
+#include "get_low.h"
 #include "min.h"
 #include "max.h"
 #include "movn.h"
@@ -128,6 +129,8 @@ simde_int8x8_t
 simde_vqmovn_s16(simde_int16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_s16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_s8(_mm_packs_epi16(a, _mm_setzero_si128()));
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_s16(simde_vmaxq_s16(simde_vdupq_n_s16(INT8_MIN), simde_vminq_s16(simde_vdupq_n_s16(INT8_MAX), a)));
   #else
@@ -152,6 +155,8 @@ simde_int16x4_t
 simde_vqmovn_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_s32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_s16(_mm_packs_epi32(a, _mm_setzero_si128()));
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_s32(simde_vmaxq_s32(simde_vdupq_n_s32(INT16_MIN), simde_vminq_s32(simde_vdupq_n_s32(INT16_MAX), a)));
   #else
@@ -200,6 +205,9 @@ simde_uint8x8_t
 simde_vqmovn_u16(simde_uint16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_u16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* a - max(a - 255, 0) == min(a, 255), which packus leaves alone */
+    return simde_vget_low_u8(_mm_packus_epi16(_mm_sub_epi16(a, _mm_subs_epu16(a, _mm_set1_epi16(UINT8_MAX))), _mm_setzero_si128()));
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u16(simde_vminq_u16(a, simde_vdupq_n_u16(UINT8_MAX)));
   #else
@@ -224,6 +232,8 @@ simde_uint16x4_t
 simde_vqmovn_u32(simde_uint32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_u32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vget_low_u16(_mm_packus_epi32(_mm_min_epu32(a, _mm_set1_epi32(UINT16_MAX)), _mm_setzero_si128()));
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u32(simde_vminq_u32(a, simde_vdupq_n_u32(UINT16_MAX)));
   #else
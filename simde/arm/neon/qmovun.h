@@ -30,6 +30,7 @@
 
 #include "types.h"
 #include "dup_n.h"
+#include "get_low.h"
 #include "min.h"
 #include "max.h"
 #include "movn.h"
@@ -85,6 +86,8 @@ simde_uint8x8_t
 simde_vqmovun_s16(simde_int16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovun_s16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_vget_low_u8(_mm_packus_epi16(a, _mm_setzero_si128()));
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u16(simde_vreinterpretq_u16_s16(simde_vmaxq_s16(simde_vdupq_n_s16(0), simde_vminq_s16(simde_vdupq_n_s16(UINT8_MAX), a))));
   #else
@@ -109,6 +112,8 @@ simde_uint16x4_t
 simde_vqmovun_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovun_s32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_vget_low_u16(_mm_packus_epi32(a, _mm_setzero_si128()));
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u32(simde_vreinterpretq_u32_s32(simde_vmaxq_s32(simde_vdupq_n_s32(0), simde_vminq_s32(simde_vdupq_n_s32(UINT16_MAX), a))));
   #else
@@ -0,0 +1,293 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_ARM_NEON_RECPE_H)
+#define SIMDE_ARM_NEON_RECPE_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* By default the estimates use whatever the target computes quickly:
+ * rcp/rsqrt on x86 (12 bits, or 14 with AVX-512VL), vec_re/vec_rsqrte
+ * on POWER, or an exact reciprocal.  All of these are at least as
+ * accurate as the 8-bit estimate Arm hardware returns, but not equal
+ * to it.  Define SIMDE_ACCURACY_PREFERENCE > 1 to get results which
+ * match AArch64 bit-for-bit (FPCR.FZ clear, round to nearest; note that
+ * AArch32 NEON always flushes denormals to zero). */
+
+/* RecipEstimate() from the Arm ARM; a is in [256, 511], representing
+ * [0.5, 1.0), and the result is in [256, 511], representing [1.0, 2.0). */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_arm_neon_recip_estimate(uint32_t a) {
+  a = (a * 2) + 1;
+  return (((UINT32_C(1) << 19) / a) + 1) / 2;
+}
+
+/* FPRecipEstimate() for a float with fbits fraction bits and ebits
+ * exponent bits, passed in the low bits of a. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_arm_neon_fp_recip_estimate(uint64_t a, unsigned int fbits, unsigned int ebits) {
+  const uint64_t
+    sign = a & (UINT64_C(1) << (fbits + ebits)),
+    emax = (UINT64_C(1) << ebits) - 1,
+    fmask = (UINT64_C(1) << fbits) - 1;
+  uint64_t frac = a & fmask;
+  int64_t e = HEDLEY_STATIC_CAST(int64_t, (a >> fbits) & emax);
+
+  if (e == HEDLEY_STATIC_CAST(int64_t, emax)) {
+    /* NaNs are quieted, infinities give zero. */
+    return (frac != 0) ? (a | (UINT64_C(1) << (fbits - 1))) : sign;
+  } else if ((e == 0) && (frac < (UINT64_C(1) << (fbits - 2)))) {
+    /* Zero, and denormals small enough for the result to overflow. */
+    return sign | (emax << fbits);
+  }
+
+  if (e == 0) {
+    if ((frac & (UINT64_C(1) << (fbits - 1))) == 0) {
+      e = -1;
+      frac = (frac << 2) & fmask;
+    } else {
+      frac = (frac << 1) & fmask;
+    }
+  }
+
+  const uint32_t estimate = simde_x_arm_neon_recip_estimate(HEDLEY_STATIC_CAST(uint32_t, 256 | (frac >> (fbits - 8))));
+  int64_t re = HEDLEY_STATIC_CAST(int64_t, emax) - 2 - e;
+
+  frac = HEDLEY_STATIC_CAST(uint64_t, estimate & 0xff) << (fbits - 8);
+  if (re == 0) {
+    frac = (UINT64_C(1) << (fbits - 1)) | (frac >> 1);
+  } else if (re == -1) {
+    frac = (UINT64_C(1) << (fbits - 2)) | (frac >> 2);
+    re = 0;
+  }
+
+  return sign | (HEDLEY_STATIC_CAST(uint64_t, re) << fbits) | frac;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_arm_neon_recpe_u32(uint32_t a) {
+  return (a >> 31) ? (simde_x_arm_neon_recip_estimate(a >> 23) << 23) : UINT32_MAX;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_vrecpes_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpes_f32(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE > 1) && defined(SIMDE_IEEE754_STORAGE)
+    uint32_t a_;
+    simde_memcpy(&a_, &a, sizeof(a_));
+    a_ = HEDLEY_STATIC_CAST(uint32_t, simde_x_arm_neon_fp_recip_estimate(a_, 23, 8));
+    simde_memcpy(&a, &a_, sizeof(a));
+    return a;
+  #else
+    return SIMDE_FLOAT32_C(1.0) / a;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpes_f32
+  #define vrecpes_f32(a) simde_vrecpes_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_vrecped_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecped_f64(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE > 1) && defined(SIMDE_IEEE754_STORAGE)
+    uint64_t a_;
+    simde_memcpy(&a_, &a, sizeof(a_));
+    a_ = HEDLEY_STATIC_CAST(uint64_t, simde_x_arm_neon_fp_recip_estimate(a_, 52, 11));
+    simde_memcpy(&a, &a_, sizeof(a));
+    return a;
+  #else
+    return SIMDE_FLOAT64_C(1.0) / a;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecped_f64
+  #define vrecped_f64(a) simde_vrecped_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vrecpe_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpe_f32(a);
+  #else
+    simde_float32x2_private
+      r_,
+      a_ = simde_float32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpes_f32(a_.values[i]);
+    }
+
+    return simde_float32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpe_f32
+  #define vrecpe_f32(a) simde_vrecpe_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vrecpe_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpe_f64(a);
+  #else
+    simde_float64x1_private
+      r_,
+      a_ = simde_float64x1_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecped_f64(a_.values[i]);
+    }
+
+    return simde_float64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpe_f64
+  #define vrecpe_f64(a) simde_vrecpe_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vrecpe_u32(simde_uint32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpe_u32(a);
+  #else
+    simde_uint32x2_private
+      r_,
+      a_ = simde_uint32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_x_arm_neon_recpe_u32(a_.values[i]);
+    }
+
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpe_u32
+  #define vrecpe_u32(a) simde_vrecpe_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vrecpeq_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpeq_f32(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rcp14_ps(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_X86_SSE_NATIVE)
+    return _mm_rcp_ps(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_re(a);
+  #else
+    simde_float32x4_private
+      r_,
+      a_ = simde_float32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpes_f32(a_.values[i]);
+    }
+
+    return simde_float32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpeq_f32
+  #define vrecpeq_f32(a) simde_vrecpeq_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vrecpeq_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpeq_f64(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rcp14_pd(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    return vec_re(a);
+  #else
+    simde_float64x2_private
+      r_,
+      a_ = simde_float64x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecped_f64(a_.values[i]);
+    }
+
+    return simde_float64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpeq_f64
+  #define vrecpeq_f64(a) simde_vrecpeq_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vrecpeq_u32(simde_uint32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpeq_u32(a);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_x_arm_neon_recpe_u32(a_.values[i]);
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpeq_u32
+  #define vrecpeq_u32(a) simde_vrecpeq_u32((a))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RECPE_H) */
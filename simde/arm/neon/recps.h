@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_ARM_NEON_RECPS_H)
+#define SIMDE_ARM_NEON_RECPS_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* vrecps computes 2 - a * b, the correction factor for a Newton-Raphson
+ * step towards 1 / b.  Arm defines infinity times zero as giving 2.0, so
+ * an infinite estimate for a zero input survives the step; that is the
+ * only way non-NaN inputs can produce a NaN, so we check for that instead
+ * of testing for infinity and zero separately. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_vrecpss_f32(simde_float32 a, simde_float32 b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpss_f32(a, b);
+  #else
+    #if defined(simde_math_fmaf) && ((SIMDE_ACCURACY_PREFERENCE > 1) || defined(__FP_FAST_FMAF) || defined(FP_FAST_FMAF))
+      simde_float32 r = simde_math_fmaf(-a, b, SIMDE_FLOAT32_C(2.0));
+    #else
+      simde_float32 r = SIMDE_FLOAT32_C(2.0) - (a * b);
+    #endif
+
+    return (simde_math_isnanf(r) && !simde_math_isnanf(a) && !simde_math_isnanf(b)) ? SIMDE_FLOAT32_C(2.0) : r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpss_f32
+  #define vrecpss_f32(a, b) simde_vrecpss_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_vrecpsd_f64(simde_float64 a, simde_float64 b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpsd_f64(a, b);
+  #else
+    #if defined(simde_math_fma) && ((SIMDE_ACCURACY_PREFERENCE > 1) || defined(__FP_FAST_FMA) || defined(FP_FAST_FMA))
+      simde_float64 r = simde_math_fma(-a, b, SIMDE_FLOAT64_C(2.0));
+    #else
+      simde_float64 r = SIMDE_FLOAT64_C(2.0) - (a * b);
+    #endif
+
+    return (simde_math_isnan(r) && !simde_math_isnan(a) && !simde_math_isnan(b)) ? SIMDE_FLOAT64_C(2.0) : r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpsd_f64
+  #define vrecpsd_f64(a, b) simde_vrecpsd_f64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vrecps_f32(simde_float32x2_t a, simde_float32x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecps_f32(a, b);
+  #else
+    simde_float32x2_private
+      r_,
+      a_ = simde_float32x2_to_private(a),
+      b_ = simde_float32x2_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpss_f32(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecps_f32
+  #define vrecps_f32(a, b) simde_vrecps_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vrecps_f64(simde_float64x1_t a, simde_float64x1_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecps_f64(a, b);
+  #else
+    simde_float64x1_private
+      r_,
+      a_ = simde_float64x1_to_private(a),
+      b_ = simde_float64x1_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpsd_f64(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecps_f64
+  #define vrecps_f64(a, b) simde_vrecps_f64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vrecpsq_f32(simde_float32x4_t a, simde_float32x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpsq_f32(a, b);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && (defined(SIMDE_X86_FMA_NATIVE) || (SIMDE_ACCURACY_PREFERENCE <= 1))
+    const __m128 k = _mm_set1_ps(SIMDE_FLOAT32_C(2.0));
+    #if defined(SIMDE_X86_FMA_NATIVE)
+      __m128 r = _mm_fnmadd_ps(a, b, k);
+    #else
+      __m128 r = _mm_sub_ps(k, _mm_mul_ps(a, b));
+    #endif
+
+    /* A NaN from ordered inputs means infinity times zero. */
+    const __m128 inf_zero = _mm_andnot_ps(_mm_cmpunord_ps(a, b), _mm_cmpunord_ps(r, r));
+    return _mm_or_ps(_mm_andnot_ps(inf_zero, r), _mm_and_ps(inf_zero, k));
+  #else
+    simde_float32x4_private
+      r_,
+      a_ = simde_float32x4_to_private(a),
+      b_ = simde_float32x4_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpss_f32(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpsq_f32
+  #define vrecpsq_f32(a, b) simde_vrecpsq_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vrecpsq_f64(simde_float64x2_t a, simde_float64x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpsq_f64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && (defined(SIMDE_X86_FMA_NATIVE) || (SIMDE_ACCURACY_PREFERENCE <= 1))
+    const __m128d k = _mm_set1_pd(SIMDE_FLOAT64_C(2.0));
+    #if defined(SIMDE_X86_FMA_NATIVE)
+      __m128d r = _mm_fnmadd_pd(a, b, k);
+    #else
+      __m128d r = _mm_sub_pd(k, _mm_mul_pd(a, b));
+    #endif
+
+    /* A NaN from ordered inputs means infinity times zero. */
+    const __m128d inf_zero = _mm_andnot_pd(_mm_cmpunord_pd(a, b), _mm_cmpunord_pd(r, r));
+    return _mm_or_pd(_mm_andnot_pd(inf_zero, r), _mm_and_pd(inf_zero, k));
+  #else
+    simde_float64x2_private
+      r_,
+      a_ = simde_float64x2_to_private(a),
+      b_ = simde_float64x2_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpsd_f64(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpsq_f64
+  #define vrecpsq_f64(a, b) simde_vrecpsq_f64((a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RECPS_H) */
@@ -0,0 +1,299 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_ARM_NEON_RSQRTE_H)
+#define SIMDE_ARM_NEON_RSQRTE_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* See recpe.h for how SIMDE_ACCURACY_PREFERENCE affects the estimates. */
+
+/* RecipSqrtEstimate() from the Arm ARM; a is in [128, 511], representing
+ * [0.25, 1.0), and the result is in [256, 511], representing [1.0, 2.0). */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_arm_neon_rsqrt_estimate(uint32_t a) {
+  if (a < 256) {
+    a = (a * 2) + 1;
+  } else {
+    a = (((a >> 1) << 1) + 1) * 2;
+  }
+
+  /* The smallest b >= 512 for which a * (b + 1)^2 >= 2^28.  The
+   * pseudocode counts up from 512; we start just below the answer. */
+  uint32_t b = 512;
+  #if defined(simde_math_sqrt)
+    const uint32_t guess = HEDLEY_STATIC_CAST(uint32_t, simde_math_sqrt(268435456.0 / HEDLEY_STATIC_CAST(double, a)));
+    if (guess > (b + 2))
+      b = guess - 2;
+  #endif
+  while ((a * (b + 1) * (b + 1)) < (UINT32_C(1) << 28))
+    b++;
+
+  return (b + 1) / 2;
+}
+
+/* FPRSqrtEstimate() for a float with fbits fraction bits and ebits
+ * exponent bits, passed in the low bits of a. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_arm_neon_fp_rsqrt_estimate(uint64_t a, unsigned int fbits, unsigned int ebits) {
+  const uint64_t
+    sign = a & (UINT64_C(1) << (fbits + ebits)),
+    emax = (UINT64_C(1) << ebits) - 1,
+    fmask = (UINT64_C(1) << fbits) - 1,
+    qnan = UINT64_C(1) << (fbits - 1);
+  uint64_t frac = a & fmask;
+  int64_t e = HEDLEY_STATIC_CAST(int64_t, (a >> fbits) & emax);
+
+  if ((e == HEDLEY_STATIC_CAST(int64_t, emax)) && (frac != 0)) {
+    return a | qnan;
+  } else if ((e == 0) && (frac == 0)) {
+    return sign | (emax << fbits);
+  } else if (sign != 0) {
+    /* The default NaN. */
+    return (emax << fbits) | qnan;
+  } else if (e == HEDLEY_STATIC_CAST(int64_t, emax)) {
+    return 0;
+  }
+
+  if (e == 0) {
+    while ((frac & qnan) == 0) {
+      frac <<= 1;
+      e--;
+    }
+    frac = (frac << 1) & fmask;
+  }
+
+  const uint32_t estimate = simde_x_arm_neon_rsqrt_estimate(HEDLEY_STATIC_CAST(uint32_t,
+    (e & 1) ? (128 | (frac >> (fbits - 7))) : (256 | (frac >> (fbits - 8)))));
+  const int64_t re = ((3 * HEDLEY_STATIC_CAST(int64_t, emax >> 1)) - 1 - e) / 2;
+
+  return (HEDLEY_STATIC_CAST(uint64_t, re) << fbits) | (HEDLEY_STATIC_CAST(uint64_t, estimate & 0xff) << (fbits - 8));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_arm_neon_rsqrte_u32(uint32_t a) {
+  return (a >> 30) ? (simde_x_arm_neon_rsqrt_estimate(a >> 23) << 23) : UINT32_MAX;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_vrsqrtes_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrtes_f32(a);
+  #elif defined(SIMDE_IEEE754_STORAGE) && ((SIMDE_ACCURACY_PREFERENCE > 1) || !defined(simde_math_sqrtf))
+    uint32_t a_;
+    simde_memcpy(&a_, &a, sizeof(a_));
+    a_ = HEDLEY_STATIC_CAST(uint32_t, simde_x_arm_neon_fp_rsqrt_estimate(a_, 23, 8));
+    simde_memcpy(&a, &a_, sizeof(a));
+    return a;
+  #else
+    return SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrtes_f32
+  #define vrsqrtes_f32(a) simde_vrsqrtes_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_vrsqrted_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrted_f64(a);
+  #elif defined(SIMDE_IEEE754_STORAGE) && ((SIMDE_ACCURACY_PREFERENCE > 1) || !defined(simde_math_sqrt))
+    uint64_t a_;
+    simde_memcpy(&a_, &a, sizeof(a_));
+    a_ = HEDLEY_STATIC_CAST(uint64_t, simde_x_arm_neon_fp_rsqrt_estimate(a_, 52, 11));
+    simde_memcpy(&a, &a_, sizeof(a));
+    return a;
+  #else
+    return SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrted_f64
+  #define vrsqrted_f64(a) simde_vrsqrted_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vrsqrte_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrte_f32(a);
+  #else
+    simde_float32x2_private
+      r_,
+      a_ = simde_float32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtes_f32(a_.values[i]);
+    }
+
+    return simde_float32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrte_f32
+  #define vrsqrte_f32(a) simde_vrsqrte_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vrsqrte_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrte_f64(a);
+  #else
+    simde_float64x1_private
+      r_,
+      a_ = simde_float64x1_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrted_f64(a_.values[i]);
+    }
+
+    return simde_float64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrte_f64
+  #define vrsqrte_f64(a) simde_vrsqrte_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vrsqrte_u32(simde_uint32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrte_u32(a);
+  #else
+    simde_uint32x2_private
+      r_,
+      a_ = simde_uint32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_x_arm_neon_rsqrte_u32(a_.values[i]);
+    }
+
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrte_u32
+  #define vrsqrte_u32(a) simde_vrsqrte_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vrsqrteq_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrteq_f32(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rsqrt14_ps(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_X86_SSE_NATIVE)
+    return _mm_rsqrt_ps(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_rsqrte(a);
+  #else
+    simde_float32x4_private
+      r_,
+      a_ = simde_float32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtes_f32(a_.values[i]);
+    }
+
+    return simde_float32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrteq_f32
+  #define vrsqrteq_f32(a) simde_vrsqrteq_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vrsqrteq_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrteq_f64(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rsqrt14_pd(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    return vec_rsqrte(a);
+  #else
+    simde_float64x2_private
+      r_,
+      a_ = simde_float64x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrted_f64(a_.values[i]);
+    }
+
+    return simde_float64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrteq_f64
+  #define vrsqrteq_f64(a) simde_vrsqrteq_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vrsqrteq_u32(simde_uint32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrteq_u32(a);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_x_arm_neon_rsqrte_u32(a_.values[i]);
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrteq_u32
+  #define vrsqrteq_u32(a) simde_vrsqrteq_u32((a))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RSQRTE_H) */
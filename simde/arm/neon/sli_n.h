@@ -0,0 +1,503 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_ARM_NEON_SLI_N_H)
+#define SIMDE_ARM_NEON_SLI_N_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vslid_n_s64 (const int64_t a, const int64_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 63) {
+  const uint64_t mask = (UINT64_C(1) << n) - 1;
+  return HEDLEY_STATIC_CAST(int64_t, (HEDLEY_STATIC_CAST(uint64_t, b) << n) | (HEDLEY_STATIC_CAST(uint64_t, a) & mask));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vslid_n_s64(a, b, n) vslid_n_s64((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vslid_n_s64
+  #define vslid_n_s64(a, b, n) simde_vslid_n_s64((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vslid_n_u64 (const uint64_t a, const uint64_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 63) {
+  const uint64_t mask = (UINT64_C(1) << n) - 1;
+  return (b << n) | (a & mask);
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vslid_n_u64(a, b, n) vslid_n_u64((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vslid_n_u64
+  #define vslid_n_u64(a, b, n) simde_vslid_n_u64((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x8_t
+simde_vsli_n_s8 (const simde_int8x8_t a, const simde_int8x8_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 7) {
+  simde_int8x8_private
+    r_,
+    a_ = simde_int8x8_to_private(a),
+    b_ = simde_int8x8_to_private(b);
+  const uint8_t mask = HEDLEY_STATIC_CAST(uint8_t, (1 << n) - 1);
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = HEDLEY_STATIC_CAST(int8_t, (HEDLEY_STATIC_CAST(uint8_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint8_t, a_.values[i]) & mask));
+  }
+
+  return simde_int8x8_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_s8(a, b, n) vsli_n_s8((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_s8
+  #define vsli_n_s8(a, b, n) simde_vsli_n_s8((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x4_t
+simde_vsli_n_s16 (const simde_int16x4_t a, const simde_int16x4_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 15) {
+  simde_int16x4_private
+    r_,
+    a_ = simde_int16x4_to_private(a),
+    b_ = simde_int16x4_to_private(b);
+  const uint16_t mask = HEDLEY_STATIC_CAST(uint16_t, (1 << n) - 1);
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = HEDLEY_STATIC_CAST(int16_t, (HEDLEY_STATIC_CAST(uint16_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint16_t, a_.values[i]) & mask));
+  }
+
+  return simde_int16x4_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_s16(a, b, n) vsli_n_s16((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_s16
+  #define vsli_n_s16(a, b, n) simde_vsli_n_s16((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vsli_n_s32 (const simde_int32x2_t a, const simde_int32x2_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 31) {
+  simde_int32x2_private
+    r_,
+    a_ = simde_int32x2_to_private(a),
+    b_ = simde_int32x2_to_private(b);
+  const uint32_t mask = (UINT32_C(1) << n) - 1;
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = HEDLEY_STATIC_CAST(int32_t, (HEDLEY_STATIC_CAST(uint32_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint32_t, a_.values[i]) & mask));
+  }
+
+  return simde_int32x2_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_s32(a, b, n) vsli_n_s32((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_s32
+  #define vsli_n_s32(a, b, n) simde_vsli_n_s32((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1_t
+simde_vsli_n_s64 (const simde_int64x1_t a, const simde_int64x1_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 63) {
+  simde_int64x1_private
+    r_,
+    a_ = simde_int64x1_to_private(a),
+    b_ = simde_int64x1_to_private(b);
+  const uint64_t mask = (UINT64_C(1) << n) - 1;
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = HEDLEY_STATIC_CAST(int64_t, (HEDLEY_STATIC_CAST(uint64_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint64_t, a_.values[i]) & mask));
+  }
+
+  return simde_int64x1_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_s64(a, b, n) vsli_n_s64((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_s64
+  #define vsli_n_s64(a, b, n) simde_vsli_n_s64((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x8_t
+simde_vsli_n_u8 (const simde_uint8x8_t a, const simde_uint8x8_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 7) {
+  simde_uint8x8_private
+    r_,
+    a_ = simde_uint8x8_to_private(a),
+    b_ = simde_uint8x8_to_private(b);
+  const uint8_t mask = HEDLEY_STATIC_CAST(uint8_t, (1 << n) - 1);
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.values[i] << n) | (a_.values[i] & mask));
+  }
+
+  return simde_uint8x8_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_u8(a, b, n) vsli_n_u8((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_u8
+  #define vsli_n_u8(a, b, n) simde_vsli_n_u8((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x4_t
+simde_vsli_n_u16 (const simde_uint16x4_t a, const simde_uint16x4_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 15) {
+  simde_uint16x4_private
+    r_,
+    a_ = simde_uint16x4_to_private(a),
+    b_ = simde_uint16x4_to_private(b);
+  const uint16_t mask = HEDLEY_STATIC_CAST(uint16_t, (1 << n) - 1);
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = HEDLEY_STATIC_CAST(uint16_t, (b_.values[i] << n) | (a_.values[i] & mask));
+  }
+
+  return simde_uint16x4_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_u16(a, b, n) vsli_n_u16((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_u16
+  #define vsli_n_u16(a, b, n) simde_vsli_n_u16((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vsli_n_u32 (const simde_uint32x2_t a, const simde_uint32x2_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 31) {
+  simde_uint32x2_private
+    r_,
+    a_ = simde_uint32x2_to_private(a),
+    b_ = simde_uint32x2_to_private(b);
+  const uint32_t mask = (UINT32_C(1) << n) - 1;
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = (b_.values[i] << n) | (a_.values[i] & mask);
+  }
+
+  return simde_uint32x2_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_u32(a, b, n) vsli_n_u32((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_u32
+  #define vsli_n_u32(a, b, n) simde_vsli_n_u32((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1_t
+simde_vsli_n_u64 (const simde_uint64x1_t a, const simde_uint64x1_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 63) {
+  simde_uint64x1_private
+    r_,
+    a_ = simde_uint64x1_to_private(a),
+    b_ = simde_uint64x1_to_private(b);
+  const uint64_t mask = (UINT64_C(1) << n) - 1;
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+    r_.values[i] = (b_.values[i] << n) | (a_.values[i] & mask);
+  }
+
+  return simde_uint64x1_from_private(r_);
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsli_n_u64(a, b, n) vsli_n_u64((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsli_n_u64
+  #define vsli_n_u64(a, b, n) simde_vsli_n_u64((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x16_t
+simde_vsliq_n_s8 (const simde_int8x16_t a, const simde_int8x16_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 7) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128i m = _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, UINT8_MAX << n));
+    return _mm_or_si128(_mm_and_si128(m, _mm_slli_epi16(b, n)), _mm_andnot_si128(m, a));
+  #else
+    simde_int8x16_private
+      r_,
+      a_ = simde_int8x16_to_private(a),
+      b_ = simde_int8x16_to_private(b);
+    const uint8_t mask = HEDLEY_STATIC_CAST(uint8_t, (1 << n) - 1);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = HEDLEY_STATIC_CAST(int8_t, (HEDLEY_STATIC_CAST(uint8_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint8_t, a_.values[i]) & mask));
+    }
+
+    return simde_int8x16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_s8(a, b, n) vsliq_n_s8((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_s8
+  #define vsliq_n_s8(a, b, n) simde_vsliq_n_s8((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x8_t
+simde_vsliq_n_s16 (const simde_int16x8_t a, const simde_int16x8_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 15) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_or_si128(_mm_slli_epi16(b, n), _mm_and_si128(a, _mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, (1 << n) - 1))));
+  #else
+    simde_int16x8_private
+      r_,
+      a_ = simde_int16x8_to_private(a),
+      b_ = simde_int16x8_to_private(b);
+    const uint16_t mask = HEDLEY_STATIC_CAST(uint16_t, (1 << n) - 1);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = HEDLEY_STATIC_CAST(int16_t, (HEDLEY_STATIC_CAST(uint16_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint16_t, a_.values[i]) & mask));
+    }
+
+    return simde_int16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_s16(a, b, n) vsliq_n_s16((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_s16
+  #define vsliq_n_s16(a, b, n) simde_vsliq_n_s16((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vsliq_n_s32 (const simde_int32x4_t a, const simde_int32x4_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 31) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_or_si128(_mm_slli_epi32(b, n), _mm_and_si128(a, _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, (UINT32_C(1) << n) - 1))));
+  #else
+    simde_int32x4_private
+      r_,
+      a_ = simde_int32x4_to_private(a),
+      b_ = simde_int32x4_to_private(b);
+    const uint32_t mask = (UINT32_C(1) << n) - 1;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = HEDLEY_STATIC_CAST(int32_t, (HEDLEY_STATIC_CAST(uint32_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint32_t, a_.values[i]) & mask));
+    }
+
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_s32(a, b, n) vsliq_n_s32((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_s32
+  #define vsliq_n_s32(a, b, n) simde_vsliq_n_s32((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vsliq_n_s64 (const simde_int64x2_t a, const simde_int64x2_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 63) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_or_si128(_mm_slli_epi64(b, n), _mm_and_si128(a, _mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, (UINT64_C(1) << n) - 1))));
+  #else
+    simde_int64x2_private
+      r_,
+      a_ = simde_int64x2_to_private(a),
+      b_ = simde_int64x2_to_private(b);
+    const uint64_t mask = (UINT64_C(1) << n) - 1;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = HEDLEY_STATIC_CAST(int64_t, (HEDLEY_STATIC_CAST(uint64_t, b_.values[i]) << n) | (HEDLEY_STATIC_CAST(uint64_t, a_.values[i]) & mask));
+    }
+
+    return simde_int64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_s64(a, b, n) vsliq_n_s64((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_s64
+  #define vsliq_n_s64(a, b, n) simde_vsliq_n_s64((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vsliq_n_u8 (const simde_uint8x16_t a, const simde_uint8x16_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 7) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128i m = _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, UINT8_MAX << n));
+    return _mm_or_si128(_mm_and_si128(m, _mm_slli_epi16(b, n)), _mm_andnot_si128(m, a));
+  #else
+    simde_uint8x16_private
+      r_,
+      a_ = simde_uint8x16_to_private(a),
+      b_ = simde_uint8x16_to_private(b);
+    const uint8_t mask = HEDLEY_STATIC_CAST(uint8_t, (1 << n) - 1);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.values[i] << n) | (a_.values[i] & mask));
+    }
+
+    return simde_uint8x16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_u8(a, b, n) vsliq_n_u8((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_u8
+  #define vsliq_n_u8(a, b, n) simde_vsliq_n_u8((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x8_t
+simde_vsliq_n_u16 (const simde_uint16x8_t a, const simde_uint16x8_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 15) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_or_si128(_mm_slli_epi16(b, n), _mm_and_si128(a, _mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, (1 << n) - 1))));
+  #else
+    simde_uint16x8_private
+      r_,
+      a_ = simde_uint16x8_to_private(a),
+      b_ = simde_uint16x8_to_private(b);
+    const uint16_t mask = HEDLEY_STATIC_CAST(uint16_t, (1 << n) - 1);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = HEDLEY_STATIC_CAST(uint16_t, (b_.values[i] << n) | (a_.values[i] & mask));
+    }
+
+    return simde_uint16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_u16(a, b, n) vsliq_n_u16((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_u16
+  #define vsliq_n_u16(a, b, n) simde_vsliq_n_u16((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsliq_n_u32 (const simde_uint32x4_t a, const simde_uint32x4_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 31) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_or_si128(_mm_slli_epi32(b, n), _mm_and_si128(a, _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, (UINT32_C(1) << n) - 1))));
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(a),
+      b_ = simde_uint32x4_to_private(b);
+    const uint32_t mask = (UINT32_C(1) << n) - 1;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = (b_.values[i] << n) | (a_.values[i] & mask);
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_u32(a, b, n) vsliq_n_u32((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_u32
+  #define vsliq_n_u32(a, b, n) simde_vsliq_n_u32((a), (b), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vsliq_n_u64 (const simde_uint64x2_t a, const simde_uint64x2_t b, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 0, 63) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_or_si128(_mm_slli_epi64(b, n), _mm_and_si128(a, _mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, (UINT64_C(1) << n) - 1))));
+  #else
+    simde_uint64x2_private
+      r_,
+      a_ = simde_uint64x2_to_private(a),
+      b_ = simde_uint64x2_to_private(b);
+    const uint64_t mask = (UINT64_C(1) << n) - 1;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = (b_.values[i] << n) | (a_.values[i] & mask);
+    }
+
+    return simde_uint64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vsliq_n_u64(a, b, n) vsliq_n_u64((a), (b), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vsliq_n_u64
+  #define vsliq_n_u64(a, b, n) simde_vsliq_n_u64((a), (b), (n))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_SLI_N_H) */
@@ -0,0 +1,593 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_ARM_NEON_ST2_H)
+#define SIMDE_ARM_NEON_ST2_H
+
+#include "types.h"
+#include "st1.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+#if defined(HEDLEY_GCC_VERSION)
+  SIMDE_DIAGNOSTIC_DISABLE_MAYBE_UNINITIAZILED_
+#endif
+SIMDE_BEGIN_DECLS_
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_f32(simde_float32_t ptr[HEDLEY_ARRAY_PARAM(4)], simde_float32x2x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_f32(ptr, val);
+  #else
+    simde_float32x2_private a_[2] = { simde_float32x2_to_private(val.val[0]), simde_float32x2_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float32x2_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 8, a_[0].values, a_[1].values, 0, 2);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 8, a_[0].values, a_[1].values, 1, 3);
+      simde_vst1_f32(ptr, simde_float32x2_from_private(r_[0]));
+      simde_vst1_f32(ptr + 2, simde_float32x2_from_private(r_[1]));
+    #else
+      simde_float32_t buf[4];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_f32
+  #define vst2_f32(a, b) simde_vst2_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_f64(simde_float64_t ptr[HEDLEY_ARRAY_PARAM(2)], simde_float64x1x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    vst2_f64(ptr, val);
+  #else
+    simde_float64x1_private a_[2] = { simde_float64x1_to_private(val.val[0]), simde_float64x1_to_private(val.val[1]) };
+    simde_float64_t buf[2];
+    for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+      buf[i] = a_[i % 2].values[i / 2];
+    }
+    simde_memcpy(ptr, buf, sizeof(buf));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vst2_f64
+  #define vst2_f64(a, b) simde_vst2_f64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_s8(int8_t ptr[HEDLEY_ARRAY_PARAM(16)], simde_int8x8x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_s8(ptr, val);
+  #else
+    simde_int8x8_private a_[2] = { simde_int8x8_to_private(val.val[0]), simde_int8x8_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int8x8_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 8, a_[0].values, a_[1].values, 0, 8, 1, 9, 2, 10, 3, 11);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 8, a_[0].values, a_[1].values, 4, 12, 5, 13, 6, 14, 7, 15);
+      simde_vst1_s8(ptr, simde_int8x8_from_private(r_[0]));
+      simde_vst1_s8(ptr + 8, simde_int8x8_from_private(r_[1]));
+    #else
+      int8_t buf[16];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_s8
+  #define vst2_s8(a, b) simde_vst2_s8((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_s16(int16_t ptr[HEDLEY_ARRAY_PARAM(8)], simde_int16x4x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_s16(ptr, val);
+  #else
+    simde_int16x4_private a_[2] = { simde_int16x4_to_private(val.val[0]), simde_int16x4_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int16x4_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 8, a_[0].values, a_[1].values, 0, 4, 1, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 8, a_[0].values, a_[1].values, 2, 6, 3, 7);
+      simde_vst1_s16(ptr, simde_int16x4_from_private(r_[0]));
+      simde_vst1_s16(ptr + 4, simde_int16x4_from_private(r_[1]));
+    #else
+      int16_t buf[8];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_s16
+  #define vst2_s16(a, b) simde_vst2_s16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_s32(int32_t ptr[HEDLEY_ARRAY_PARAM(4)], simde_int32x2x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_s32(ptr, val);
+  #else
+    simde_int32x2_private a_[2] = { simde_int32x2_to_private(val.val[0]), simde_int32x2_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int32x2_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 8, a_[0].values, a_[1].values, 0, 2);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 8, a_[0].values, a_[1].values, 1, 3);
+      simde_vst1_s32(ptr, simde_int32x2_from_private(r_[0]));
+      simde_vst1_s32(ptr + 2, simde_int32x2_from_private(r_[1]));
+    #else
+      int32_t buf[4];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_s32
+  #define vst2_s32(a, b) simde_vst2_s32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_s64(int64_t ptr[HEDLEY_ARRAY_PARAM(2)], simde_int64x1x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_s64(ptr, val);
+  #else
+    simde_int64x1_private a_[2] = { simde_int64x1_to_private(val.val[0]), simde_int64x1_to_private(val.val[1]) };
+    int64_t buf[2];
+    for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+      buf[i] = a_[i % 2].values[i / 2];
+    }
+    simde_memcpy(ptr, buf, sizeof(buf));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_s64
+  #define vst2_s64(a, b) simde_vst2_s64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_u8(uint8_t ptr[HEDLEY_ARRAY_PARAM(16)], simde_uint8x8x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_u8(ptr, val);
+  #else
+    simde_uint8x8_private a_[2] = { simde_uint8x8_to_private(val.val[0]), simde_uint8x8_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint8x8_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 8, a_[0].values, a_[1].values, 0, 8, 1, 9, 2, 10, 3, 11);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 8, a_[0].values, a_[1].values, 4, 12, 5, 13, 6, 14, 7, 15);
+      simde_vst1_u8(ptr, simde_uint8x8_from_private(r_[0]));
+      simde_vst1_u8(ptr + 8, simde_uint8x8_from_private(r_[1]));
+    #else
+      uint8_t buf[16];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_u8
+  #define vst2_u8(a, b) simde_vst2_u8((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_u16(uint16_t ptr[HEDLEY_ARRAY_PARAM(8)], simde_uint16x4x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_u16(ptr, val);
+  #else
+    simde_uint16x4_private a_[2] = { simde_uint16x4_to_private(val.val[0]), simde_uint16x4_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint16x4_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 8, a_[0].values, a_[1].values, 0, 4, 1, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 8, a_[0].values, a_[1].values, 2, 6, 3, 7);
+      simde_vst1_u16(ptr, simde_uint16x4_from_private(r_[0]));
+      simde_vst1_u16(ptr + 4, simde_uint16x4_from_private(r_[1]));
+    #else
+      uint16_t buf[8];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_u16
+  #define vst2_u16(a, b) simde_vst2_u16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_u32(uint32_t ptr[HEDLEY_ARRAY_PARAM(4)], simde_uint32x2x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_u32(ptr, val);
+  #else
+    simde_uint32x2_private a_[2] = { simde_uint32x2_to_private(val.val[0]), simde_uint32x2_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint32x2_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 8, a_[0].values, a_[1].values, 0, 2);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 8, a_[0].values, a_[1].values, 1, 3);
+      simde_vst1_u32(ptr, simde_uint32x2_from_private(r_[0]));
+      simde_vst1_u32(ptr + 2, simde_uint32x2_from_private(r_[1]));
+    #else
+      uint32_t buf[4];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_u32
+  #define vst2_u32(a, b) simde_vst2_u32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2_u64(uint64_t ptr[HEDLEY_ARRAY_PARAM(2)], simde_uint64x1x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2_u64(ptr, val);
+  #else
+    simde_uint64x1_private a_[2] = { simde_uint64x1_to_private(val.val[0]), simde_uint64x1_to_private(val.val[1]) };
+    uint64_t buf[2];
+    for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+      buf[i] = a_[i % 2].values[i / 2];
+    }
+    simde_memcpy(ptr, buf, sizeof(buf));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2_u64
+  #define vst2_u64(a, b) simde_vst2_u64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_f32(simde_float32_t ptr[HEDLEY_ARRAY_PARAM(8)], simde_float32x4x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    _mm_storeu_ps(ptr,     _mm_unpacklo_ps(val.val[0], val.val[1]));
+    _mm_storeu_ps(ptr + 4, _mm_unpackhi_ps(val.val[0], val.val[1]));
+  #else
+    simde_float32x4_private a_[2] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float32x4_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 4, 1, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 2, 6, 3, 7);
+      simde_vst1q_f32(ptr, simde_float32x4_from_private(r_[0]));
+      simde_vst1q_f32(ptr + 4, simde_float32x4_from_private(r_[1]));
+    #else
+      simde_float32_t buf[8];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_f32
+  #define vst2q_f32(a, b) simde_vst2q_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_f64(simde_float64_t ptr[HEDLEY_ARRAY_PARAM(4)], simde_float64x2x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    vst2q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_pd(ptr,     _mm_unpacklo_pd(val.val[0], val.val[1]));
+    _mm_storeu_pd(ptr + 2, _mm_unpackhi_pd(val.val[0], val.val[1]));
+  #else
+    simde_float64x2_private a_[2] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float64x2_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 0, 2);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 1, 3);
+      simde_vst1q_f64(ptr, simde_float64x2_from_private(r_[0]));
+      simde_vst1q_f64(ptr + 2, simde_float64x2_from_private(r_[1]));
+    #else
+      simde_float64_t buf[4];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_f64
+  #define vst2q_f64(a, b) simde_vst2q_f64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_s8(int8_t ptr[HEDLEY_ARRAY_PARAM(32)], simde_int8x16x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),     _mm_unpacklo_epi8(val.val[0], val.val[1]));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16), _mm_unpackhi_epi8(val.val[0], val.val[1]));
+  #else
+    simde_int8x16_private a_[2] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int8x16_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+      simde_vst1q_s8(ptr, simde_int8x16_from_private(r_[0]));
+      simde_vst1q_s8(ptr + 16, simde_int8x16_from_private(r_[1]));
+    #else
+      int8_t buf[32];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_s8
+  #define vst2q_s8(a, b) simde_vst2q_s8((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_s16(int16_t ptr[HEDLEY_ARRAY_PARAM(16)], simde_int16x8x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),     _mm_unpacklo_epi16(val.val[0], val.val[1]));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 8), _mm_unpackhi_epi16(val.val[0], val.val[1]));
+  #else
+    simde_int16x8_private a_[2] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int16x8_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 0, 8, 1, 9, 2, 10, 3, 11);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 4, 12, 5, 13, 6, 14, 7, 15);
+      simde_vst1q_s16(ptr, simde_int16x8_from_private(r_[0]));
+      simde_vst1q_s16(ptr + 8, simde_int16x8_from_private(r_[1]));
+    #else
+      int16_t buf[16];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_s16
+  #define vst2q_s16(a, b) simde_vst2q_s16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_s32(int32_t ptr[HEDLEY_ARRAY_PARAM(8)], simde_int32x4x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),     _mm_unpacklo_epi32(val.val[0], val.val[1]));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 4), _mm_unpackhi_epi32(val.val[0], val.val[1]));
+  #else
+    simde_int32x4_private a_[2] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int32x4_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 4, 1, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 2, 6, 3, 7);
+      simde_vst1q_s32(ptr, simde_int32x4_from_private(r_[0]));
+      simde_vst1q_s32(ptr + 4, simde_int32x4_from_private(r_[1]));
+    #else
+      int32_t buf[8];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_s32
+  #define vst2q_s32(a, b) simde_vst2q_s32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_s64(int64_t ptr[HEDLEY_ARRAY_PARAM(4)], simde_int64x2x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    vst2q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),     _mm_unpacklo_epi64(val.val[0], val.val[1]));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 2), _mm_unpackhi_epi64(val.val[0], val.val[1]));
+  #else
+    simde_int64x2_private a_[2] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int64x2_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 0, 2);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 1, 3);
+      simde_vst1q_s64(ptr, simde_int64x2_from_private(r_[0]));
+      simde_vst1q_s64(ptr + 2, simde_int64x2_from_private(r_[1]));
+    #else
+      int64_t buf[4];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_s64
+  #define vst2q_s64(a, b) simde_vst2q_s64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_u8(uint8_t ptr[HEDLEY_ARRAY_PARAM(32)], simde_uint8x16x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x16x2_t s = { { val.val[0], val.val[1] } };
+    simde_vst2q_s8(HEDLEY_REINTERPRET_CAST(int8_t*, ptr), s);
+  #else
+    simde_uint8x16_private a_[2] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint8x16_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+      simde_vst1q_u8(ptr, simde_uint8x16_from_private(r_[0]));
+      simde_vst1q_u8(ptr + 16, simde_uint8x16_from_private(r_[1]));
+    #else
+      uint8_t buf[32];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_u8
+  #define vst2q_u8(a, b) simde_vst2q_u8((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_u16(uint16_t ptr[HEDLEY_ARRAY_PARAM(16)], simde_uint16x8x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int16x8x2_t s = { { val.val[0], val.val[1] } };
+    simde_vst2q_s16(HEDLEY_REINTERPRET_CAST(int16_t*, ptr), s);
+  #else
+    simde_uint16x8_private a_[2] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint16x8_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 0, 8, 1, 9, 2, 10, 3, 11);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 4, 12, 5, 13, 6, 14, 7, 15);
+      simde_vst1q_u16(ptr, simde_uint16x8_from_private(r_[0]));
+      simde_vst1q_u16(ptr + 8, simde_uint16x8_from_private(r_[1]));
+    #else
+      uint16_t buf[16];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_u16
+  #define vst2q_u16(a, b) simde_vst2q_u16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_u32(uint32_t ptr[HEDLEY_ARRAY_PARAM(8)], simde_uint32x4x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    vst2q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4x2_t s = { { val.val[0], val.val[1] } };
+    simde_vst2q_s32(HEDLEY_REINTERPRET_CAST(int32_t*, ptr), s);
+  #else
+    simde_uint32x4_private a_[2] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint32x4_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 4, 1, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 2, 6, 3, 7);
+      simde_vst1q_u32(ptr, simde_uint32x4_from_private(r_[0]));
+      simde_vst1q_u32(ptr + 4, simde_uint32x4_from_private(r_[1]));
+    #else
+      uint32_t buf[8];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_u32
+  #define vst2q_u32(a, b) simde_vst2q_u32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_vst2q_u64(uint64_t ptr[HEDLEY_ARRAY_PARAM(4)], simde_uint64x2x2_t val) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    vst2q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2x2_t s = { { val.val[0], val.val[1] } };
+    simde_vst2q_s64(HEDLEY_REINTERPRET_CAST(int64_t*, ptr), s);
+  #else
+    simde_uint64x2_private a_[2] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]) };
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint64x2_private r_[2];
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 0, 2);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 1, 3);
+      simde_vst1q_u64(ptr, simde_uint64x2_from_private(r_[0]));
+      simde_vst1q_u64(ptr + 2, simde_uint64x2_from_private(r_[1]));
+    #else
+      uint64_t buf[4];
+      for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+        buf[i] = a_[i % 2].values[i / 2];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vst2q_u64
+  #define vst2q_u64(a, b) simde_vst2q_u64((a), (b))
+#endif
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_ST2_H) */
@@ -232,6 +232,11 @@ void
 simde_vst3q_f32(simde_float32_t *ptr, simde_float32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    const __m128 x = val.val[0], y = val.val[1], z = val.val[2];
+    _mm_storeu_ps(ptr,     _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(ptr + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(ptr + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
   #else
     simde_float32_t buf[12];
     simde_float32x4_private a_[3] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]), simde_float32x4_to_private(val.val[2]) };
@@ -251,6 +256,10 @@ void
 simde_vst3q_f64(simde_float64_t *ptr, simde_float64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_pd(ptr,     _mm_unpacklo_pd(val.val[0], val.val[1]));
+    _mm_storeu_pd(ptr + 2, _mm_shuffle_pd(val.val[2], val.val[0], 2));
+    _mm_storeu_pd(ptr + 4, _mm_unpackhi_pd(val.val[1], val.val[2]));
   #else
     simde_float64_t buf[6];
     simde_float64x2_private a_[3] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]), simde_float64x2_to_private(val.val[2]) };
@@ -270,6 +279,25 @@ void
 simde_vst3q_s8(int8_t *ptr, simde_int8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8( 0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1,  5)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8( 5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1,  5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 32),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15))));
   #else
     int8_t buf[48];
     simde_int8x16_private a_[3] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]), simde_int8x16_to_private(val.val[2]) };
@@ -289,6 +317,25 @@ void
 simde_vst3q_s16(int16_t *ptr, simde_int16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8( 0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1,  4,  5, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1,  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1,  4,  5))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, -1, -1,  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 8),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1, -1, -1, 10, 11)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8( 4,  5, -1, -1, -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15))));
   #else
     int16_t buf[24];
     simde_int16x8_private a_[3] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]), simde_int16x8_to_private(val.val[2]) };
@@ -308,6 +355,9 @@ void
 simde_vst3q_s32(int32_t *ptr, simde_int32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4x3_t f = { { _mm_castsi128_ps(val.val[0]), _mm_castsi128_ps(val.val[1]), _mm_castsi128_ps(val.val[2]) } };
+    simde_vst3q_f32(HEDLEY_REINTERPRET_CAST(simde_float32_t*, ptr), f);
   #else
     int32_t buf[12];
     simde_int32x4_private a_[3] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]), simde_int32x4_to_private(val.val[2]) };
@@ -327,6 +377,9 @@ void
 simde_vst3q_s64(int64_t *ptr, simde_int64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2x3_t f = { { _mm_castsi128_pd(val.val[0]), _mm_castsi128_pd(val.val[1]), _mm_castsi128_pd(val.val[2]) } };
+    simde_vst3q_f64(HEDLEY_REINTERPRET_CAST(simde_float64_t*, ptr), f);
   #else
     int64_t buf[6];
     simde_int64x2_private a_[3] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]), simde_int64x2_to_private(val.val[2]) };
@@ -347,6 +400,9 @@ void
 simde_vst3q_u8(uint8_t *ptr, simde_uint8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16x3_t s = { { val.val[0], val.val[1], val.val[2] } };
+    simde_vst3q_s8(HEDLEY_REINTERPRET_CAST(int8_t*, ptr), s);
   #else
     uint8_t buf[48];
     simde_uint8x16_private a_[3] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]), simde_uint8x16_to_private(val.val[2]) };
@@ -366,6 +422,9 @@ void
 simde_vst3q_u16(uint16_t *ptr, simde_uint16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int16x8x3_t s = { { val.val[0], val.val[1], val.val[2] } };
+    simde_vst3q_s16(HEDLEY_REINTERPRET_CAST(int16_t*, ptr), s);
   #else
     uint16_t buf[24];
     simde_uint16x8_private a_[3] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]), simde_uint16x8_to_private(val.val[2]) };
@@ -385,6 +444,9 @@ void
 simde_vst3q_u32(uint32_t *ptr, simde_uint32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4x3_t s = { { val.val[0], val.val[1], val.val[2] } };
+    simde_vst3q_s32(HEDLEY_REINTERPRET_CAST(int32_t*, ptr), s);
   #else
     uint32_t buf[12];
     simde_uint32x4_private a_[3] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]), simde_uint32x4_to_private(val.val[2]) };
@@ -404,6 +466,9 @@ void
 simde_vst3q_u64(uint64_t *ptr, simde_uint64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2x3_t s = { { val.val[0], val.val[1], val.val[2] } };
+    simde_vst3q_s64(HEDLEY_REINTERPRET_CAST(int64_t*, ptr), s);
   #else
     uint64_t buf[6];
     simde_uint64x2_private a_[3] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]), simde_uint64x2_to_private(val.val[2]) };
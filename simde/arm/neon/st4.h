@@ -241,6 +241,13 @@ void
 simde_vst4q_f32(simde_float32_t *ptr, simde_float32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    __m128 a = val.val[0], b = val.val[1], c = val.val[2], d = val.val[3];
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    _mm_storeu_ps(ptr,      a);
+    _mm_storeu_ps(ptr +  4, b);
+    _mm_storeu_ps(ptr +  8, c);
+    _mm_storeu_ps(ptr + 12, d);
   #else
     simde_float32_t buf[16];
     simde_float32x4_private a_[4] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]),
@@ -261,6 +268,11 @@ void
 simde_vst4q_f64(simde_float64_t *ptr, simde_float64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    _mm_storeu_pd(ptr,     _mm_unpacklo_pd(val.val[0], val.val[1]));
+    _mm_storeu_pd(ptr + 2, _mm_unpacklo_pd(val.val[2], val.val[3]));
+    _mm_storeu_pd(ptr + 4, _mm_unpackhi_pd(val.val[0], val.val[1]));
+    _mm_storeu_pd(ptr + 6, _mm_unpackhi_pd(val.val[2], val.val[3]));
   #else
     simde_float64_t buf[8];
     simde_float64x2_private a_[4] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]),
@@ -281,6 +293,18 @@ void
 simde_vst4q_s8(int8_t *ptr, simde_int8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    /* Transpose the 4x4 matrix of 32-bit groups, then interleave the
+     * four elements within each group. */
+    const __m128i idx = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m128i t0 = _mm_unpacklo_epi32(val.val[0], val.val[1]);
+    const __m128i t1 = _mm_unpacklo_epi32(val.val[2], val.val[3]);
+    const __m128i t2 = _mm_unpackhi_epi32(val.val[0], val.val[1]);
+    const __m128i t3 = _mm_unpackhi_epi32(val.val[2], val.val[3]);
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),      _mm_shuffle_epi8(_mm_unpacklo_epi64(t0, t1), idx));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16), _mm_shuffle_epi8(_mm_unpackhi_epi64(t0, t1), idx));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 32), _mm_shuffle_epi8(_mm_unpacklo_epi64(t2, t3), idx));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 48), _mm_shuffle_epi8(_mm_unpackhi_epi64(t2, t3), idx));
   #else
     int8_t buf[64];
     simde_int8x16_private a_[4] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]),
@@ -301,6 +325,25 @@ void
 simde_vst4q_s16(int16_t *ptr, simde_int16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* Transpose the 4x4 matrix of 32-bit pairs, then turn each
+     * x0 x1 y0 y1 z0 z1 w0 w1 into x0 y0 z0 w0 x1 y1 z1 w1. */
+    const __m128i t0 = _mm_unpacklo_epi32(val.val[0], val.val[1]);
+    const __m128i t1 = _mm_unpacklo_epi32(val.val[2], val.val[3]);
+    const __m128i t2 = _mm_unpackhi_epi32(val.val[0], val.val[1]);
+    const __m128i t3 = _mm_unpackhi_epi32(val.val[2], val.val[3]);
+    __m128i r[4] = {
+      _mm_unpacklo_epi64(t0, t1),
+      _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3),
+      _mm_unpackhi_epi64(t2, t3)
+    };
+    for (size_t i = 0 ; i < (sizeof(r) / sizeof(r[0])) ; i++) {
+      r[i] = _mm_shufflelo_epi16(r[i], _MM_SHUFFLE(3, 1, 2, 0));
+      r[i] = _mm_shufflehi_epi16(r[i], _MM_SHUFFLE(3, 1, 2, 0));
+      r[i] = _mm_shuffle_epi32(r[i], _MM_SHUFFLE(3, 1, 2, 0));
+      _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + (i * 8)), r[i]);
+    }
   #else
     int16_t buf[32];
     simde_int16x8_private a_[4] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]),
@@ -321,6 +364,9 @@ void
 simde_vst4q_s32(int32_t *ptr, simde_int32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4x4_t f = { { _mm_castsi128_ps(val.val[0]), _mm_castsi128_ps(val.val[1]), _mm_castsi128_ps(val.val[2]), _mm_castsi128_ps(val.val[3]) } };
+    simde_vst4q_f32(HEDLEY_REINTERPRET_CAST(simde_float32_t*, ptr), f);
   #else
     int32_t buf[16];
     simde_int32x4_private a_[4] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]),
@@ -341,6 +387,9 @@ void
 simde_vst4q_s64(int64_t *ptr, simde_int64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2x4_t f = { { _mm_castsi128_pd(val.val[0]), _mm_castsi128_pd(val.val[1]), _mm_castsi128_pd(val.val[2]), _mm_castsi128_pd(val.val[3]) } };
+    simde_vst4q_f64(HEDLEY_REINTERPRET_CAST(simde_float64_t*, ptr), f);
   #else
     int64_t buf[8];
     simde_int64x2_private a_[4] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]),
@@ -362,6 +411,9 @@ void
 simde_vst4q_u8(uint8_t *ptr, simde_uint8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16x4_t s = { { val.val[0], val.val[1], val.val[2], val.val[3] } };
+    simde_vst4q_s8(HEDLEY_REINTERPRET_CAST(int8_t*, ptr), s);
   #else
     uint8_t buf[64];
     simde_uint8x16_private a_[4] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]),
@@ -382,6 +434,9 @@ void
 simde_vst4q_u16(uint16_t *ptr, simde_uint16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int16x8x4_t s = { { val.val[0], val.val[1], val.val[2], val.val[3] } };
+    simde_vst4q_s16(HEDLEY_REINTERPRET_CAST(int16_t*, ptr), s);
   #else
     uint16_t buf[32];
     simde_uint16x8_private a_[4] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]),
@@ -402,6 +457,9 @@ void
 simde_vst4q_u32(uint32_t *ptr, simde_uint32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4x4_t s = { { val.val[0], val.val[1], val.val[2], val.val[3] } };
+    simde_vst4q_s32(HEDLEY_REINTERPRET_CAST(int32_t*, ptr), s);
   #else
     uint32_t buf[16];
     simde_uint32x4_private a_[4] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]),
@@ -422,6 +480,9 @@ void
 simde_vst4q_u64(uint64_t *ptr, simde_uint64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2x4_t s = { { val.val[0], val.val[1], val.val[2], val.val[3] } };
+    simde_vst4q_s64(HEDLEY_REINTERPRET_CAST(int64_t*, ptr), s);
   #else
     uint64_t buf[8];
     simde_uint64x2_private a_[4] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]),
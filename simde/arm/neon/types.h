@@ -28,6 +28,7 @@
 #define SIMDE_ARM_NEON_TYPES_H
 
 #include "../../simde-common.h"
+#include "../../simde-f16.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -74,6 +75,24 @@ SIMDE_ARM_NEON_TYPE_FLOAT_DEFINE_(64, 1, SIMDE_ALIGN_8_)
 SIMDE_ARM_NEON_TYPE_FLOAT_DEFINE_(32, 4, SIMDE_ALIGN_16_)
 SIMDE_ARM_NEON_TYPE_FLOAT_DEFINE_(64, 2, SIMDE_ALIGN_16_)
 
+/* simde_float16 may be a struct, so these can't use vector extensions. */
+typedef struct simde_float16x4_private {
+  SIMDE_ALIGN_TO(SIMDE_ALIGN_8_) simde_float16 values[4];
+} simde_float16x4_private;
+typedef struct simde_float16x8_private {
+  SIMDE_ALIGN_TO(SIMDE_ALIGN_16_) simde_float16 values[8];
+} simde_float16x8_private;
+
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+  typedef   float16_t   simde_float16_t;
+  typedef float16x4_t simde_float16x4_t;
+  typedef float16x8_t simde_float16x8_t;
+#else
+  typedef           simde_float16   simde_float16_t;
+  typedef simde_float16x4_private simde_float16x4_t;
+  typedef simde_float16x8_private simde_float16x8_t;
+#endif
+
 #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
   typedef     float32_t     simde_float32_t;
 
@@ -558,6 +577,10 @@ SIMDE_ARM_NEON_TYPE_FLOAT_DEFINE_(64, 2, SIMDE_ALIGN_16_)
 #endif
 
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  typedef   simde_float16_t     float16_t;
+  typedef simde_float16x4_t   float16x4_t;
+  typedef simde_float16x8_t   float16x8_t;
+
   typedef   simde_float32_t     float32_t;
 
   typedef    simde_int8x8_t      int8x8_t;
@@ -676,6 +699,8 @@ SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(uint32x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(uint64x2)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float32x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float64x2)
+SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float16x4)
+SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float16x8)
 
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
@@ -797,6 +797,9 @@ HEDLEY_DIAGNOSTIC_POP
 #    if !HEDLEY_GCC_VERSION_CHECK(9,0,0) && defined(SIMDE_ARCH_AARCH64)
 #      define SIMDE_BUG_GCC_BAD_VEXT_REV32
 #    endif
+#    if defined(SIMDE_ARCH_ARM) && (!defined(SIMDE_ARCH_AARCH64) || !HEDLEY_GCC_VERSION_CHECK(10,0,0))
+#      define SIMDE_BUG_GCC_ARM_VLD1_XN /* vld1*_x2/_x3/_x4 missing */
+#    endif
 #    if defined(SIMDE_ARCH_X86) && !defined(SIMDE_ARCH_AMD64)
 #      define SIMDE_BUG_GCC_94482
 #    endif
@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+/* Support for IEEE 754 binary16 ("half precision").
+ *
+ * If the compiler has a native half-precision type we use it as
+ * simde_float16.  Otherwise simde_float16 is a struct wrapping the
+ * bits; arithmetic on it isn't supported, but it keeps it from being
+ * silently converted to or from an integer.
+ *
+ * The portable conversions don't branch on the class of the value
+ * (normal, subnormal, infinity or NaN); every case is computed and the
+ * right one selected, so loops over them vectorize. */
+
+#if !defined(SIMDE_F16_H)
+#define SIMDE_F16_H 1
+
+#include "simde-common.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_ARM_NEON_FP16)
+  #define SIMDE_FLOAT16_NATIVE
+  typedef __fp16 simde_float16;
+#else
+  typedef struct { uint16_t value; } simde_float16;
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16
+simde_uint16_as_float16 (uint16_t value) {
+  simde_float16 r;
+  simde_memcpy(&r, &value, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint16_t
+simde_float16_as_uint16 (simde_float16 value) {
+  uint16_t r;
+  simde_memcpy(&r, &value, sizeof(r));
+  return r;
+}
+
+/* Round to nearest, ties to even.  NaNs are quieted and keep the top
+ * bits of their payload, like the hardware conversions. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint16_t
+simde_x_float16_bits_from_float32 (simde_float32 value) {
+  uint32_t f, a, n, d, r;
+  simde_float32 t;
+
+  simde_memcpy(&f, &value, sizeof(f));
+  a = f & UINT32_C(0x7fffffff);
+
+  /* Normal: rebias the exponent and round the 13 bits shifted out.
+   * The carry out of the mantissa bumps the exponent, and past 65504
+   * it reaches the infinity encoding on its own. */
+  n = (a - (UINT32_C(112) << 23) + UINT32_C(0xfff) + ((a >> 13) & 1)) >> 13;
+
+  /* Subnormal: adding 0.5 leaves the result in the low mantissa bits,
+   * rounded by the FPU. */
+  simde_memcpy(&t, &a, sizeof(t));
+  t += SIMDE_FLOAT32_C(0.5);
+  simde_memcpy(&d, &t, sizeof(d));
+  d -= UINT32_C(0x3f000000);
+
+  r = (a < (UINT32_C(113) << 23)) ? d : n;
+  r = (a >= (UINT32_C(143) << 23)) ? UINT32_C(0x7c00) : r;
+  r = (a > UINT32_C(0x7f800000)) ? (UINT32_C(0x7e00) | ((a >> 13) & UINT32_C(0x3ff))) : r;
+
+  return HEDLEY_STATIC_CAST(uint16_t, r | ((f >> 16) & UINT32_C(0x8000)));
+}
+
+/* Exact; signaling NaNs are quieted. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_float16_bits_to_float32 (uint16_t value) {
+  uint32_t h = value, a = h & UINT32_C(0x7fff), n, d, r;
+  simde_float32 t;
+
+  n = (a << 13) + (UINT32_C(112) << 23);
+  n += (a >= UINT32_C(0x7c00)) ? (UINT32_C(112) << 23) : 0;
+  n |= (a > UINT32_C(0x7c00)) ? UINT32_C(0x400000) : 0;
+
+  /* Subnormal: build 2^-14 * (1 + m/1024) and subtract 2^-14. */
+  d = (a << 13) + (UINT32_C(113) << 23);
+  simde_memcpy(&t, &d, sizeof(t));
+  t -= SIMDE_FLOAT32_C(0.00006103515625);
+  simde_memcpy(&d, &t, sizeof(d));
+
+  r = ((a < UINT32_C(0x400)) ? d : n) | ((h & UINT32_C(0x8000)) << 16);
+  simde_memcpy(&t, &r, sizeof(t));
+  return t;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16
+simde_float16_from_float32 (simde_float32 value) {
+  #if defined(SIMDE_FLOAT16_NATIVE)
+    return HEDLEY_STATIC_CAST(simde_float16, value);
+  #else
+    return simde_uint16_as_float16(simde_x_float16_bits_from_float32(value));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_float16_to_float32 (simde_float16 value) {
+  #if defined(SIMDE_FLOAT16_NATIVE)
+    return HEDLEY_STATIC_CAST(simde_float32, value);
+  #else
+    return simde_x_float16_bits_to_float32(simde_float16_as_uint16(value));
+  #endif
+}
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_F16_H) */
@@ -0,0 +1,802 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2016      Thomas Pornin <pornin@bolet.org>
+ */
+
+/* The portable version is bitsliced so that it runs in constant time;
+ * the S-box circuit is the one by Boyar and Peralta, as used in BearSSL
+ * (aes_ct64.c), which is MIT licensed.  Up to four blocks are pushed
+ * through the circuit at once, so the 512-bit VAES functions cost
+ * little more than the 128-bit ones. */
+
+#if !defined(SIMDE_X86_AES_H)
+#define SIMDE_X86_AES_H
+
+#include "avx512/types.h"
+
+#if !defined(SIMDE_X86_AES_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_AES_ENABLE_NATIVE_ALIASES
+#endif
+#if !defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__)
+  #if HEDLEY_HAS_BUILTIN(__builtin_altivec_crypto_vcipher)
+    #define SIMDE_X_AES_VCIPHER_(a, b)      __builtin_altivec_crypto_vcipher(a, b)
+    #define SIMDE_X_AES_VCIPHERLAST_(a, b)  __builtin_altivec_crypto_vcipherlast(a, b)
+    #define SIMDE_X_AES_VNCIPHER_(a, b)     __builtin_altivec_crypto_vncipher(a, b)
+    #define SIMDE_X_AES_VNCIPHERLAST_(a, b) __builtin_altivec_crypto_vncipherlast(a, b)
+    #define SIMDE_X_AES_VSBOX_(a)           __builtin_altivec_crypto_vsbox(a)
+  #else
+    #define SIMDE_X_AES_VCIPHER_(a, b)      __builtin_crypto_vcipher(a, b)
+    #define SIMDE_X_AES_VCIPHERLAST_(a, b)  __builtin_crypto_vcipherlast(a, b)
+    #define SIMDE_X_AES_VNCIPHER_(a, b)     __builtin_crypto_vncipher(a, b)
+    #define SIMDE_X_AES_VNCIPHERLAST_(a, b) __builtin_crypto_vncipherlast(a, b)
+    #define SIMDE_X_AES_VSBOX_(a)           __builtin_crypto_vsbox(a)
+  #endif
+
+  /* The POWER crypto instructions number the state bytes big-endian,
+   * so on little-endian targets the register has to be reversed before
+   * and after.  This is its own inverse. */
+  SIMDE_FUNCTION_ATTRIBUTES
+  SIMDE_POWER_ALTIVEC_VECTOR(unsigned long long)
+  simde_x_aes_power_state_(SIMDE_POWER_ALTIVEC_VECTOR(unsigned long long) v) {
+    #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE
+      static const SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) perm = { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+      const SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) b = HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned char), v);
+      return HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned long long), vec_perm(b, b, perm));
+    #else
+      return v;
+    #endif
+  }
+#endif
+
+/* Defined when the 128-bit functions map to a single instruction (or
+ * two, plus an XOR), in which case the wider ones are split. */
+#if \
+    defined(SIMDE_X86_AES_NATIVE) || \
+    (defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+    defined(SIMDE_X_AES_VCIPHER_)
+  #define SIMDE_X_AES_NATIVE_128_
+#endif
+
+/* Swap bit i of byte j of q[k] with bit k of byte j of q[i]; afterwards
+ * q[i] holds bit i of every byte.  This is its own inverse. */
+#define SIMDE_X_AES_SWAPN_(cl, ch, s, x, y) \
+  do { \
+    const uint64_t simde_x_aes_a_ = (x), simde_x_aes_b_ = (y); \
+    (x) = (simde_x_aes_a_ & UINT64_C(cl)) | ((simde_x_aes_b_ & UINT64_C(cl)) << (s)); \
+    (y) = ((simde_x_aes_a_ & UINT64_C(ch)) >> (s)) | (simde_x_aes_b_ & UINT64_C(ch)); \
+  } while (0)
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_ortho_(uint64_t q[8]) {
+  SIMDE_X_AES_SWAPN_(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, q[0], q[1]);
+  SIMDE_X_AES_SWAPN_(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, q[2], q[3]);
+  SIMDE_X_AES_SWAPN_(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, q[4], q[5]);
+  SIMDE_X_AES_SWAPN_(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, q[6], q[7]);
+
+  SIMDE_X_AES_SWAPN_(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, q[0], q[2]);
+  SIMDE_X_AES_SWAPN_(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, q[1], q[3]);
+  SIMDE_X_AES_SWAPN_(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, q[4], q[6]);
+  SIMDE_X_AES_SWAPN_(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, q[5], q[7]);
+
+  SIMDE_X_AES_SWAPN_(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, q[0], q[4]);
+  SIMDE_X_AES_SWAPN_(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, q[1], q[5]);
+  SIMDE_X_AES_SWAPN_(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, q[2], q[6]);
+  SIMDE_X_AES_SWAPN_(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, q[3], q[7]);
+}
+
+/* The AES S-box on bitsliced data; q[i] holds bit i of each byte. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_sbox_(uint64_t q[8]) {
+  uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+  uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  uint64_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  uint64_t y20, y21;
+  uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  uint64_t z10, z11, z12, z13, z14, z15, z16, z17;
+  uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  uint64_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  uint64_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  uint64_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  uint64_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  uint64_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  uint64_t t60, t61, t62, t63, t64, t65, t66, t67;
+  uint64_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7];
+  x1 = q[6];
+  x2 = q[5];
+  x3 = q[4];
+  x4 = q[3];
+  x5 = q[2];
+  x6 = q[1];
+  x7 = q[0];
+
+  /* Top linear transformation. */
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  /* Non-linear section. */
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  /* Bottom linear transformation. */
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0 = t59 ^ t63;
+  s6 = t56 ^ ~t62;
+  s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65;
+  s3 = t53 ^ t66;
+  s4 = t51 ^ t66;
+  s5 = t47 ^ t65;
+  s1 = t64 ^ ~s3;
+  s2 = t55 ^ ~t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+/* The inverse of the affine transformation in the S-box, applied before
+ * and after the S-box itself to obtain the inverse S-box. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_inv_affine_(uint64_t q[8]) {
+  const uint64_t
+    q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3],
+    q4 =  q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+/* SubBytes (or InvSubBytes) on up to 64 bytes. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_sub_bytes_(void* bytes, size_t len, int inverse) {
+  uint64_t q[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+  simde_memcpy(q, bytes, len);
+  simde_x_aes_ortho_(q);
+  if (inverse) {
+    simde_x_aes_inv_affine_(q);
+    simde_x_aes_sbox_(q);
+    simde_x_aes_inv_affine_(q);
+  } else {
+    simde_x_aes_sbox_(q);
+  }
+  simde_x_aes_ortho_(q);
+  simde_memcpy(bytes, q, len);
+}
+
+/* The remaining steps work on the bytes of two columns at a time. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_aes_xtime_(uint64_t x) {
+  return ((x & UINT64_C(0x7F7F7F7F7F7F7F7F)) << 1) ^ (((x >> 7) & UINT64_C(0x0101010101010101)) * 0x1b);
+}
+
+/* Rotate each column so that byte i gets the value of byte i + 1. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_aes_rot8_(uint64_t x) {
+  #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE
+    return ((x >>  8) & UINT64_C(0x00FFFFFF00FFFFFF)) | ((x << 24) & UINT64_C(0xFF000000FF000000));
+  #else
+    return ((x <<  8) & UINT64_C(0xFFFFFF00FFFFFF00)) | ((x >> 24) & UINT64_C(0x000000FF000000FF));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_aes_rot16_(uint64_t x) {
+  return ((x >> 16) & UINT64_C(0x0000FFFF0000FFFF)) | ((x << 16) & UINT64_C(0xFFFF0000FFFF0000));
+}
+
+/* MixColumns (or InvMixColumns) on n blocks. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_mix_columns_(void* state, size_t n, int inverse) {
+  uint64_t w[8];
+
+  simde_memcpy(w, state, n * 16);
+  for (size_t i = 0 ; i < (n * 2) ; i++) {
+    uint64_t a = w[i];
+
+    /* InvMixColumns = MixColumns * (4x^2 + 5) */
+    if (inverse)
+      a ^= simde_x_aes_xtime_(simde_x_aes_xtime_(a ^ simde_x_aes_rot16_(a)));
+
+    const uint64_t a1 = simde_x_aes_rot8_(a), a2 = simde_x_aes_rot16_(a);
+    w[i] = a1 ^ a2 ^ simde_x_aes_rot8_(a2) ^ simde_x_aes_xtime_(a ^ a1);
+  }
+  simde_memcpy(state, w, n * 16);
+}
+
+/* One AES round on n (at most four) consecutive blocks: (Inv)ShiftRows,
+ * (Inv)SubBytes, (Inv)MixColumns unless last is set, then the round key
+ * is XORed in. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_round_(void* r, const void* a, const void* round_key, size_t n, int decrypt, int last) {
+  static const uint8_t shift_rows[2][16] = {
+    { 0,  5, 10, 15,  4,  9, 14,  3,  8, 13,  2,  7, 12,  1,  6, 11 },
+    { 0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3 }
+  };
+  const uint8_t* a_ = HEDLEY_STATIC_CAST(const uint8_t*, a);
+  const uint8_t* k_ = HEDLEY_STATIC_CAST(const uint8_t*, round_key);
+  uint8_t* r_ = HEDLEY_STATIC_CAST(uint8_t*, r);
+  uint8_t s[64];
+
+  for (size_t b = 0 ; b < n ; b++) {
+    for (size_t i = 0 ; i < 16 ; i++) {
+      s[(b * 16) + i] = a_[(b * 16) + shift_rows[!!decrypt][i]];
+    }
+  }
+
+  simde_x_aes_sub_bytes_(s, n * 16, decrypt);
+
+  if (!last)
+    simde_x_aes_mix_columns_(s, n, decrypt);
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (n * 16) ; i++) {
+    r_[i] = s[i] ^ k_[i];
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenc_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesenc_si128(a, round_key);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaesmcq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0))), round_key_.neon_u8);
+    #elif defined(SIMDE_X_AES_VCIPHER_)
+      r_.altivec_u64 = simde_x_aes_power_state_(SIMDE_X_AES_VCIPHER_(simde_x_aes_power_state_(a_.altivec_u64), vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0))));
+      r_.altivec_u64 = vec_xor(r_.altivec_u64, round_key_.altivec_u64);
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 1, 0, 0);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #undef _mm_aesenc_si128
+  #define _mm_aesenc_si128(a, round_key) simde_mm_aesenc_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenclast_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesenclast_si128(a, round_key);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0)), round_key_.neon_u8);
+    #elif defined(SIMDE_X_AES_VCIPHER_)
+      r_.altivec_u64 = simde_x_aes_power_state_(SIMDE_X_AES_VCIPHERLAST_(simde_x_aes_power_state_(a_.altivec_u64), vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0))));
+      r_.altivec_u64 = vec_xor(r_.altivec_u64, round_key_.altivec_u64);
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 1, 0, 1);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #undef _mm_aesenclast_si128
+  #define _mm_aesenclast_si128(a, round_key) simde_mm_aesenclast_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdec_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesdec_si128(a, round_key);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaesimcq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0))), round_key_.neon_u8);
+    #elif defined(SIMDE_X_AES_VCIPHER_)
+      /* vncipher XORs the key in before InvMixColumns, so pass zero. */
+      r_.altivec_u64 = simde_x_aes_power_state_(SIMDE_X_AES_VNCIPHER_(simde_x_aes_power_state_(a_.altivec_u64), vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0))));
+      r_.altivec_u64 = vec_xor(r_.altivec_u64, round_key_.altivec_u64);
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 1, 1, 0);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #undef _mm_aesdec_si128
+  #define _mm_aesdec_si128(a, round_key) simde_mm_aesdec_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdeclast_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesdeclast_si128(a, round_key);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0)), round_key_.neon_u8);
+    #elif defined(SIMDE_X_AES_VCIPHER_)
+      r_.altivec_u64 = simde_x_aes_power_state_(SIMDE_X_AES_VNCIPHERLAST_(simde_x_aes_power_state_(a_.altivec_u64), vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0))));
+      r_.altivec_u64 = vec_xor(r_.altivec_u64, round_key_.altivec_u64);
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 1, 1, 1);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #undef _mm_aesdeclast_si128
+  #define _mm_aesdeclast_si128(a, round_key) simde_mm_aesdeclast_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesimc_si128 (simde__m128i a) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesimc_si128(a);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = vaesimcq_u8(a_.neon_u8);
+    #elif defined(SIMDE_X_AES_VCIPHER_)
+      /* There is no InvMixColumns on its own, but the inverse
+       * ShiftRows/SubBytes in vncipher cancel out vcipherlast. */
+      const SIMDE_POWER_ALTIVEC_VECTOR(unsigned long long) zero = vec_splats(HEDLEY_STATIC_CAST(unsigned long long, 0));
+      r_.altivec_u64 = simde_x_aes_power_state_(SIMDE_X_AES_VNCIPHER_(SIMDE_X_AES_VCIPHERLAST_(simde_x_aes_power_state_(a_.altivec_u64), zero), zero));
+    #else
+      r_ = a_;
+      simde_x_aes_mix_columns_(&r_, 1, 1);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #undef _mm_aesimc_si128
+  #define _mm_aesimc_si128(a) simde_mm_aesimc_si128(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aeskeygenassist_si128 (simde__m128i a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a);
+  const uint8_t rcon = HEDLEY_STATIC_CAST(uint8_t, imm8);
+
+  /* dwords 1 and 3 go through SubWord; the odd dwords of the result are
+   * also rotated and have rcon XORed into their low byte. */
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    /* vaeseq also does ShiftRows, which the table lookup undoes. */
+    static const uint8_t idx[16] = { 4, 1, 14, 11, 1, 14, 11, 4, 12, 9, 6, 3, 9, 6, 3, 12 };
+    const uint8_t rc[16] = { 0, 0, 0, 0, rcon, 0, 0, 0, 0, 0, 0, 0, rcon, 0, 0, 0 };
+    r_.neon_u8 = vaeseq_u8(a_.neon_u8, vdupq_n_u8(0));
+    r_.neon_u8 = veorq_u8(vqtbl1q_u8(r_.neon_u8, vld1q_u8(idx)), vld1q_u8(rc));
+  #elif defined(SIMDE_X_AES_VCIPHER_)
+    static const SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) idx = { 4, 5, 6, 7, 5, 6, 7, 4, 12, 13, 14, 15, 13, 14, 15, 12 };
+    const SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) rc = { 0, 0, 0, 0, rcon, 0, 0, 0, 0, 0, 0, 0, rcon, 0, 0, 0 };
+    r_.altivec_u64 = SIMDE_X_AES_VSBOX_(a_.altivec_u64);
+    r_.altivec_u8 = vec_xor(vec_perm(r_.altivec_u8, r_.altivec_u8, idx), rc);
+  #else
+    simde_x_aes_sub_bytes_(&a_, sizeof(a_), 0);
+
+    for (size_t i = 0 ; i < 16 ; i += 8) {
+      r_.u8[i + 0] = a_.u8[i + 4];
+      r_.u8[i + 1] = a_.u8[i + 5];
+      r_.u8[i + 2] = a_.u8[i + 6];
+      r_.u8[i + 3] = a_.u8[i + 7];
+      r_.u8[i + 4] = a_.u8[i + 5] ^ rcon;
+      r_.u8[i + 5] = a_.u8[i + 6];
+      r_.u8[i + 6] = a_.u8[i + 7];
+      r_.u8[i + 7] = a_.u8[i + 4];
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AES_NATIVE)
+  #define simde_mm_aeskeygenassist_si128(a, imm8) _mm_aeskeygenassist_si128(a, imm8)
+#endif
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #undef _mm_aeskeygenassist_si128
+  #define _mm_aeskeygenassist_si128(a, imm8) simde_mm_aeskeygenassist_si128(a, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesenc_epi128 (simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesenc_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesenc_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 2, 0, 0);
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesenc_epi128
+  #define _mm256_aesenc_epi128(a, round_key) simde_mm256_aesenc_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesenclast_epi128 (simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesenclast_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesenclast_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 2, 0, 1);
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesenclast_epi128
+  #define _mm256_aesenclast_epi128(a, round_key) simde_mm256_aesenclast_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesdec_epi128 (simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesdec_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesdec_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 2, 1, 0);
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesdec_epi128
+  #define _mm256_aesdec_epi128(a, round_key) simde_mm256_aesdec_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesdeclast_epi128 (simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesdeclast_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesdeclast_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 2, 1, 1);
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesdeclast_epi128
+  #define _mm256_aesdeclast_epi128(a, round_key) simde_mm256_aesdeclast_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesenc_epi128 (simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesenc_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesenc_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 4, 0, 0);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesenc_epi128
+  #define _mm512_aesenc_epi128(a, round_key) simde_mm512_aesenc_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesenclast_epi128 (simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesenclast_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesenclast_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 4, 0, 1);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesenclast_epi128
+  #define _mm512_aesenclast_epi128(a, round_key) simde_mm512_aesenclast_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesdec_epi128 (simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesdec_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesdec_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 4, 1, 0);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesdec_epi128
+  #define _mm512_aesdec_epi128(a, round_key) simde_mm512_aesdec_epi128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesdeclast_epi128 (simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesdeclast_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    #if defined(SIMDE_X_AES_NATIVE_128_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_aesdeclast_si128(a_.m128i[i], round_key_.m128i[i]);
+      }
+    #else
+      simde_x_aes_round_(&r_, &a_, &round_key_, 4, 1, 1);
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesdeclast_epi128
+  #define _mm512_aesdeclast_epi128(a, round_key) simde_mm512_aesdeclast_epi128(a, round_key)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AES_H) */
@@ -29,6 +29,7 @@
 #define SIMDE_X86_AVX512_2INTERSECT_H
 
 #include "types.h"
+#include "../avx2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -39,6 +40,22 @@ void
 simde_mm_2intersect_epi32(simde__m128i a, simde__m128i b, simde__mmask8 *k1, simde__mmask8 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm_2intersect_epi32(a, b, k1, k2);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Compare a with every rotation of b.  A match in lane i of
+     * rotation r is element (i + r) % 4 of b, so the mask for k2 is
+     * rotated left by r. */
+    const simde__m128i
+      b1 = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1)),
+      b2 = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(1, 0, 3, 2)),
+      b3 = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+    const int
+      m0 = simde_mm_movemask_ps(simde_mm_castsi128_ps(simde_mm_cmpeq_epi32(a, b ))),
+      m1 = simde_mm_movemask_ps(simde_mm_castsi128_ps(simde_mm_cmpeq_epi32(a, b1))),
+      m2 = simde_mm_movemask_ps(simde_mm_castsi128_ps(simde_mm_cmpeq_epi32(a, b2))),
+      m3 = simde_mm_movemask_ps(simde_mm_castsi128_ps(simde_mm_cmpeq_epi32(a, b3)));
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, m0 | m1 | m2 | m3);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, (m0 | (m1 << 1) | (m1 >> 3) | (m2 << 2) | (m2 >> 2) | (m3 << 3) | (m3 >> 1)) & 15);
   #else
     simde__m128i_private
       a_ = simde__m128i_to_private(a),
@@ -65,8 +82,8 @@ simde_mm_2intersect_epi32(simde__m128i a, simde__m128i b, simde__mmask8 *k1, sim
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
-  #undef __mm_2intersect_epi32
-  #define __mm_2intersect_epi32(a,b, k1, k2) simde_mm_2intersect_epi32(a, b, k1, k2)
+  #undef _mm_2intersect_epi32
+  #define _mm_2intersect_epi32(a,b, k1, k2) simde_mm_2intersect_epi32(a, b, k1, k2)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -74,6 +91,13 @@ void
 simde_mm_2intersect_epi64(simde__m128i a, simde__m128i b, simde__mmask8 *k1, simde__mmask8 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm_2intersect_epi64(a, b, k1, k2);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    const int
+      m0 = simde_mm_movemask_pd(simde_mm_castsi128_pd(simde_mm_cmpeq_epi64(a, b))),
+      m1 = simde_mm_movemask_pd(simde_mm_castsi128_pd(simde_mm_cmpeq_epi64(a, simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(1, 0, 3, 2)))));
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, m0 | m1);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, (m0 | (m1 << 1) | (m1 >> 1)) & 3);
   #else
     simde__m128i_private
       a_ = simde__m128i_to_private(a),
@@ -100,8 +124,8 @@ simde_mm_2intersect_epi64(simde__m128i a, simde__m128i b, simde__mmask8 *k1, sim
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
-  #undef __mm_2intersect_epi64
-  #define __mm_2intersect_epi64(a,b, k1, k2) simde_mm_2intersect_epi64(a, b, k1, k2)
+  #undef _mm_2intersect_epi64
+  #define _mm_2intersect_epi64(a,b, k1, k2) simde_mm_2intersect_epi64(a, b, k1, k2)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -109,6 +133,39 @@ void
 simde_mm256_2intersect_epi32(simde__m256i a, simde__m256i b, simde__mmask8 *k1, simde__mmask8 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm256_2intersect_epi32(a, b, k1, k2);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    /* vpermd only looks at the low 3 bits of each index, so adding
+     * one to every index moves on to the next rotation of b. */
+    __m256i idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256i one = _mm256_set1_epi32(1);
+    unsigned int k1_ = 0, k2_ = 0;
+
+    for (unsigned int r = 0 ; r < 8 ; r++) {
+      const unsigned int m = HEDLEY_STATIC_CAST(unsigned int, _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, _mm256_permutevar8x32_epi32(b, idx)))));
+      k1_ |= m;
+      k2_ |= (m << r) | (m >> (8 - r));
+      idx = _mm256_add_epi32(idx, one);
+    }
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, k1_);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, k2_);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    /* Intersect each half of a with each half of b. */
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b);
+    simde__mmask8 m1, m2, k1_ = 0, k2_ = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+      for (size_t j = 0 ; j < (sizeof(b_.m128i) / sizeof(b_.m128i[0])) ; j++) {
+        simde_mm_2intersect_epi32(a_.m128i[i], b_.m128i[j], &m1, &m2);
+        k1_ = HEDLEY_STATIC_CAST(simde__mmask8, k1_ | (m1 << (i * 4)));
+        k2_ = HEDLEY_STATIC_CAST(simde__mmask8, k2_ | (m2 << (j * 4)));
+      }
+    }
+
+    *k1 = k1_;
+    *k2 = k2_;
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
@@ -144,6 +201,31 @@ void
 simde_mm256_2intersect_epi64(simde__m256i a, simde__m256i b, simde__mmask8 *k1, simde__mmask8 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm256_2intersect_epi64(a, b, k1, k2);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const int
+      m0 = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))),
+      m1 = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, _mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1))))),
+      m2 = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, _mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(1, 0, 3, 2))))),
+      m3 = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, _mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(2, 1, 0, 3)))));
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, m0 | m1 | m2 | m3);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, (m0 | (m1 << 1) | (m1 >> 3) | (m2 << 2) | (m2 >> 2) | (m3 << 3) | (m3 >> 1)) & 15);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b);
+    simde__mmask8 m1, m2, k1_ = 0, k2_ = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+      for (size_t j = 0 ; j < (sizeof(b_.m128i) / sizeof(b_.m128i[0])) ; j++) {
+        simde_mm_2intersect_epi64(a_.m128i[i], b_.m128i[j], &m1, &m2);
+        k1_ = HEDLEY_STATIC_CAST(simde__mmask8, k1_ | (m1 << (i * 2)));
+        k2_ = HEDLEY_STATIC_CAST(simde__mmask8, k2_ | (m2 << (j * 2)));
+      }
+    }
+
+    *k1 = k1_;
+    *k2 = k2_;
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
@@ -179,6 +261,40 @@ void
 simde_mm512_2intersect_epi32(simde__m512i a, simde__m512i b, simde__mmask16 *k1, simde__mmask16 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE)
     _mm512_2intersect_epi32(a, b, k1, k2);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    /* vpermd only looks at the low 4 bits of each index, so adding
+     * one to every index moves on to the next rotation of b. */
+    __m512i idx = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i one = _mm512_set1_epi32(1);
+    uint32_t k1_ = 0, k2_ = 0;
+
+    for (unsigned int r = 0 ; r < 16 ; r++) {
+      const uint32_t m = HEDLEY_STATIC_CAST(uint32_t, _mm512_cmpeq_epi32_mask(a, _mm512_permutexvar_epi32(idx, b)));
+      k1_ |= m;
+      k2_ |= (m << r) | (m >> (16 - r));
+      idx = _mm512_add_epi32(idx, one);
+    }
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask16, k1_);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask16, k2_);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    /* Intersect each half of a with each half of b. */
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+    simde__mmask8 m1, m2;
+    simde__mmask16 k1_ = 0, k2_ = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.m256i) / sizeof(a_.m256i[0])) ; i++) {
+      for (size_t j = 0 ; j < (sizeof(b_.m256i) / sizeof(b_.m256i[0])) ; j++) {
+        simde_mm256_2intersect_epi32(a_.m256i[i], b_.m256i[j], &m1, &m2);
+        k1_ = HEDLEY_STATIC_CAST(simde__mmask16, k1_ | (m1 << (i * 8)));
+        k2_ = HEDLEY_STATIC_CAST(simde__mmask16, k2_ | (m2 << (j * 8)));
+      }
+    }
+
+    *k1 = k1_;
+    *k2 = k2_;
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
@@ -214,6 +330,36 @@ void
 simde_mm512_2intersect_epi64(simde__m512i a, simde__m512i b, simde__mmask8 *k1, simde__mmask8 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE)
     _mm512_2intersect_epi64(a, b, k1, k2);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    __m512i idx = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i one = _mm512_set1_epi64(1);
+    uint32_t k1_ = 0, k2_ = 0;
+
+    for (unsigned int r = 0 ; r < 8 ; r++) {
+      const uint32_t m = HEDLEY_STATIC_CAST(uint32_t, _mm512_cmpeq_epi64_mask(a, _mm512_permutexvar_epi64(idx, b)));
+      k1_ |= m;
+      k2_ |= (m << r) | (m >> (8 - r));
+      idx = _mm512_add_epi64(idx, one);
+    }
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, k1_);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, k2_);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+    simde__mmask8 m1, m2, k1_ = 0, k2_ = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.m256i) / sizeof(a_.m256i[0])) ; i++) {
+      for (size_t j = 0 ; j < (sizeof(b_.m256i) / sizeof(b_.m256i[0])) ; j++) {
+        simde_mm256_2intersect_epi64(a_.m256i[i], b_.m256i[j], &m1, &m2);
+        k1_ = HEDLEY_STATIC_CAST(simde__mmask8, k1_ | (m1 << (i * 4)));
+        k2_ = HEDLEY_STATIC_CAST(simde__mmask8, k2_ | (m2 << (j * 4)));
+      }
+    }
+
+    *k1 = k1_;
+    *k2 = k2_;
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
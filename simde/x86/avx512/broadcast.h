@@ -718,19 +718,7 @@ simde_mm512_mask_broadcastss_ps(simde__m512 src, simde__mmask16 k, simde__m128 a
   #if defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_broadcastss_ps(src, k, a);
   #else
-    simde__m512_private
-      src_ = simde__m512_to_private(src),
-      r_;
-    simde__m128_private
-      a_ = simde__m128_to_private(a);
-
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = ((k >> i) & 1) ? a_.f32[0] : src_.f32[i];
-    }
-
-    return simde__m512_from_private(r_);
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_broadcastss_ps(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -744,17 +732,7 @@ simde_mm512_maskz_broadcastss_ps(simde__mmask16 k, simde__m128 a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_maskz_broadcastss_ps(k, a);
   #else
-    simde__m512_private
-      r_;
-    simde__m128_private
-      a_ = simde__m128_to_private(a);
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = ((k >> i) & 1) ? a_.f32[0] : INT32_C(0);
-    }
-
-    return simde__m512_from_private(r_);
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_broadcastss_ps(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -790,18 +768,7 @@ simde_mm512_mask_broadcastsd_pd(simde__m512d src, simde__mmask8 k, simde__m128d
   #if defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_broadcastsd_pd(src, k, a);
   #else
-    simde__m512d_private
-      src_ = simde__m512d_to_private(src),
-      r_;
-    simde__m128d_private
-      a_ = simde__m128d_to_private(a);
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = ((k >> i) & 1) ? a_.f64[0] : src_.f64[i];
-    }
-
-    return simde__m512d_from_private(r_);
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_broadcastsd_pd(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -815,17 +782,7 @@ simde_mm512_maskz_broadcastsd_pd(simde__mmask8 k, simde__m128d a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_maskz_broadcastsd_pd(k, a);
   #else
-    simde__m512d_private
-      r_;
-    simde__m128d_private
-      a_ = simde__m128d_to_private(a);
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = ((k >> i) & 1) ? a_.f64[0] : INT64_C(0);
-    }
-
-    return simde__m512d_from_private(r_);
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_broadcastsd_pd(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -0,0 +1,558 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_X86_AVX512_CONFLICT_H)
+#define SIMDE_X86_AVX512_CONFLICT_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The emulated versions compare a with every rotation of b, rotating
+ * a vector of per-lane bits (p) along with b, so each lane of the
+ * result collects p[j] for every element b[j] equal to a[i].  For
+ * conflict, b is a itself and the result is then masked down to the
+ * bits below each lane. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_conflict_cross_epi32 (simde__m128i a, simde__m128i b, simde__m128i p) {
+  #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    simde__m128i r = simde_mm_and_si128(simde_mm_cmpeq_epi32(a, b), p);
+
+    b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    p = simde_mm_shuffle_epi32(p, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    r = simde_mm_or_si128(r, simde_mm_and_si128(simde_mm_cmpeq_epi32(a, b), p));
+    b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    p = simde_mm_shuffle_epi32(p, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    r = simde_mm_or_si128(r, simde_mm_and_si128(simde_mm_cmpeq_epi32(a, b), p));
+    b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    p = simde_mm_shuffle_epi32(p, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    r = simde_mm_or_si128(r, simde_mm_and_si128(simde_mm_cmpeq_epi32(a, b), p));
+
+    return r;
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      p_ = simde__m128i_to_private(p);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      int32_t m = 0;
+
+      SIMDE_VECTORIZE_REDUCTION(|:m)
+      for (size_t j = 0 ; j < (sizeof(b_.i32) / sizeof(b_.i32[0])) ; j++) {
+        m |= (a_.i32[i] == b_.i32[j]) ? p_.i32[j] : 0;
+      }
+
+      r_.i32[i] = m;
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_conflict_cross_epi64 (simde__m128i a, simde__m128i b, simde__m128i p) {
+  #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    simde__m128i r = simde_mm_and_si128(simde_mm_cmpeq_epi64(a, b), p);
+
+    b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(1, 0, 3, 2));
+    p = simde_mm_shuffle_epi32(p, SIMDE_MM_SHUFFLE(1, 0, 3, 2));
+    r = simde_mm_or_si128(r, simde_mm_and_si128(simde_mm_cmpeq_epi64(a, b), p));
+
+    return r;
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      p_ = simde__m128i_to_private(p);
+
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      int64_t m = 0;
+
+      SIMDE_VECTORIZE_REDUCTION(|:m)
+      for (size_t j = 0 ; j < (sizeof(b_.i64) / sizeof(b_.i64[0])) ; j++) {
+        m |= (a_.i64[i] == b_.i64[j]) ? p_.i64[j] : 0;
+      }
+
+      r_.i64[i] = m;
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_conflict_cross_epi32 (simde__m256i a, simde__m256i b, simde__m256i p) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    /* vpermd only looks at the low 3 bits of each index, so adding
+     * one to every index moves on to the next rotation. */
+    __m256i idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i r = _mm256_and_si256(_mm256_cmpeq_epi32(a, b), p);
+
+    for (int i = 1 ; i < 8 ; i++) {
+      idx = _mm256_add_epi32(idx, one);
+      r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpeq_epi32(a, _mm256_permutevar8x32_epi32(b, idx)), _mm256_permutevar8x32_epi32(p, idx)));
+    }
+
+    return r;
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      p_ = simde__m256i_to_private(p);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] =
+          simde_mm_or_si128(
+            simde_x_mm_conflict_cross_epi32(a_.m128i[i], b_.m128i[0], p_.m128i[0]),
+            simde_x_mm_conflict_cross_epi32(a_.m128i[i], b_.m128i[1], p_.m128i[1]));
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        int32_t m = 0;
+
+        SIMDE_VECTORIZE_REDUCTION(|:m)
+        for (size_t j = 0 ; j < (sizeof(b_.i32) / sizeof(b_.i32[0])) ; j++) {
+          m |= (a_.i32[i] == b_.i32[j]) ? p_.i32[j] : 0;
+        }
+
+        r_.i32[i] = m;
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_conflict_cross_epi64 (simde__m256i a, simde__m256i b, simde__m256i p) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256i r = _mm256_and_si256(_mm256_cmpeq_epi64(a, b), p);
+
+    b = _mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    p = _mm256_permute4x64_epi64(p, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpeq_epi64(a, b), p));
+    b = _mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    p = _mm256_permute4x64_epi64(p, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpeq_epi64(a, b), p));
+    b = _mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    p = _mm256_permute4x64_epi64(p, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpeq_epi64(a, b), p));
+
+    return r;
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      p_ = simde__m256i_to_private(p);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] =
+          simde_mm_or_si128(
+            simde_x_mm_conflict_cross_epi64(a_.m128i[i], b_.m128i[0], p_.m128i[0]),
+            simde_x_mm_conflict_cross_epi64(a_.m128i[i], b_.m128i[1], p_.m128i[1]));
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        int64_t m = 0;
+
+        SIMDE_VECTORIZE_REDUCTION(|:m)
+        for (size_t j = 0 ; j < (sizeof(b_.i64) / sizeof(b_.i64[0])) ; j++) {
+          m |= (a_.i64[i] == b_.i64[j]) ? p_.i64[j] : 0;
+        }
+
+        r_.i64[i] = m;
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_conflict_epi32 (simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_conflict_epi32(a);
+  #else
+    return
+      simde_mm_and_si128(
+        simde_x_mm_conflict_cross_epi32(a, a, simde_mm_set_epi32(8, 4, 2, 1)),
+        simde_mm_set_epi32(7, 3, 1, 0));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_conflict_epi32
+  #define _mm_conflict_epi32(a) simde_mm_conflict_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_conflict_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_conflict_epi32(src, k, a);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_conflict_epi32(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_conflict_epi32
+  #define _mm_mask_conflict_epi32(src, k, a) simde_mm_mask_conflict_epi32(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_conflict_epi32 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_conflict_epi32(k, a);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_conflict_epi32(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_conflict_epi32
+  #define _mm_maskz_conflict_epi32(k, a) simde_mm_maskz_conflict_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_conflict_epi64 (simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_conflict_epi64(a);
+  #else
+    return
+      simde_mm_and_si128(
+        simde_x_mm_conflict_cross_epi64(a, a, simde_mm_set_epi64x(2, 1)),
+        simde_mm_set_epi64x(1, 0));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_conflict_epi64
+  #define _mm_conflict_epi64(a) simde_mm_conflict_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_conflict_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_conflict_epi64(src, k, a);
+  #else
+    return simde_mm_mask_mov_epi64(src, k, simde_mm_conflict_epi64(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_conflict_epi64
+  #define _mm_mask_conflict_epi64(src, k, a) simde_mm_mask_conflict_epi64(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_conflict_epi64 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_conflict_epi64(k, a);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_conflict_epi64(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_conflict_epi64
+  #define _mm_maskz_conflict_epi64(k, a) simde_mm_maskz_conflict_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_conflict_epi32 (simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_conflict_epi32(a);
+  #else
+    return
+      simde_mm256_and_si256(
+        simde_x_mm256_conflict_cross_epi32(a, a, simde_mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1)),
+        simde_mm256_set_epi32(127, 63, 31, 15, 7, 3, 1, 0));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_conflict_epi32
+  #define _mm256_conflict_epi32(a) simde_mm256_conflict_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_conflict_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_conflict_epi32(src, k, a);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_conflict_epi32(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_conflict_epi32
+  #define _mm256_mask_conflict_epi32(src, k, a) simde_mm256_mask_conflict_epi32(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_conflict_epi32 (simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_conflict_epi32(k, a);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_conflict_epi32(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_conflict_epi32
+  #define _mm256_maskz_conflict_epi32(k, a) simde_mm256_maskz_conflict_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_conflict_epi64 (simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_conflict_epi64(a);
+  #else
+    return
+      simde_mm256_and_si256(
+        simde_x_mm256_conflict_cross_epi64(a, a, simde_mm256_set_epi64x(8, 4, 2, 1)),
+        simde_mm256_set_epi64x(7, 3, 1, 0));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_conflict_epi64
+  #define _mm256_conflict_epi64(a) simde_mm256_conflict_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_conflict_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_conflict_epi64(src, k, a);
+  #else
+    return simde_mm256_mask_mov_epi64(src, k, simde_mm256_conflict_epi64(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_conflict_epi64
+  #define _mm256_mask_conflict_epi64(src, k, a) simde_mm256_mask_conflict_epi64(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_conflict_epi64 (simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_conflict_epi64(k, a);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_conflict_epi64(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_conflict_epi64
+  #define _mm256_maskz_conflict_epi64(k, a) simde_mm256_maskz_conflict_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_conflict_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_conflict_epi32(a);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    /* vpermd only looks at the low 4 bits of each index, so adding
+     * one to every index moves on to the next rotation. */
+    __m512i idx = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i
+      one = _mm512_set1_epi32(1),
+      p = _mm512_sllv_epi32(one, idx);
+    __m512i r = _mm512_setzero_si512();
+
+    for (int i = 1 ; i < 16 ; i++) {
+      idx = _mm512_add_epi32(idx, one);
+      r = _mm512_mask_or_epi32(r, _mm512_cmpeq_epi32_mask(a, _mm512_permutexvar_epi32(idx, a)), r, _mm512_permutexvar_epi32(idx, p));
+    }
+
+    return _mm512_and_si512(r, _mm512_sub_epi32(p, one));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      /* The low half only conflicts with itself; the high half needs
+       * the low half's bits too. */
+      r_.m256i[0] = simde_mm256_conflict_epi32(a_.m256i[0]);
+      r_.m256i[1] =
+        simde_mm256_or_si256(
+          simde_x_mm256_conflict_cross_epi32(a_.m256i[1], a_.m256i[0], simde_mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1)),
+          simde_mm256_and_si256(
+            simde_x_mm256_conflict_cross_epi32(a_.m256i[1], a_.m256i[1], simde_mm256_set_epi32(32768, 16384, 8192, 4096, 2048, 1024, 512, 256)),
+            simde_mm256_set_epi32(32512, 16128, 7936, 3840, 1792, 768, 256, 0)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        int32_t m = 0;
+
+        SIMDE_VECTORIZE_REDUCTION(|:m)
+        for (size_t j = 0 ; j < i ; j++) {
+          m |= (a_.i32[i] == a_.i32[j]) ? (INT32_C(1) << j) : 0;
+        }
+
+        r_.i32[i] = m;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_conflict_epi32
+  #define _mm512_conflict_epi32(a) simde_mm512_conflict_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_conflict_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_mask_conflict_epi32(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_conflict_epi32(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_conflict_epi32
+  #define _mm512_mask_conflict_epi32(src, k, a) simde_mm512_mask_conflict_epi32(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_conflict_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_maskz_conflict_epi32(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_conflict_epi32(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_conflict_epi32
+  #define _mm512_maskz_conflict_epi32(k, a) simde_mm512_maskz_conflict_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_conflict_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_conflict_epi64(a);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    __m512i idx = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i
+      one = _mm512_set1_epi64(1),
+      p = _mm512_sllv_epi64(one, idx);
+    __m512i r = _mm512_setzero_si512();
+
+    for (int i = 1 ; i < 8 ; i++) {
+      idx = _mm512_add_epi64(idx, one);
+      r = _mm512_mask_or_epi64(r, _mm512_cmpeq_epi64_mask(a, _mm512_permutexvar_epi64(idx, a)), r, _mm512_permutexvar_epi64(idx, p));
+    }
+
+    return _mm512_and_si512(r, _mm512_sub_epi64(p, one));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      r_.m256i[0] = simde_mm256_conflict_epi64(a_.m256i[0]);
+      r_.m256i[1] =
+        simde_mm256_or_si256(
+          simde_x_mm256_conflict_cross_epi64(a_.m256i[1], a_.m256i[0], simde_mm256_set_epi64x(8, 4, 2, 1)),
+          simde_mm256_and_si256(
+            simde_x_mm256_conflict_cross_epi64(a_.m256i[1], a_.m256i[1], simde_mm256_set_epi64x(128, 64, 32, 16)),
+            simde_mm256_set_epi64x(112, 48, 16, 0)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        int64_t m = 0;
+
+        SIMDE_VECTORIZE_REDUCTION(|:m)
+        for (size_t j = 0 ; j < i ; j++) {
+          m |= (a_.i64[i] == a_.i64[j]) ? (INT64_C(1) << j) : 0;
+        }
+
+        r_.i64[i] = m;
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_conflict_epi64
+  #define _mm512_conflict_epi64(a) simde_mm512_conflict_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_conflict_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_mask_conflict_epi64(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi64(src, k, simde_mm512_conflict_epi64(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_conflict_epi64
+  #define _mm512_mask_conflict_epi64(src, k, a) simde_mm512_mask_conflict_epi64(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_conflict_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_maskz_conflict_epi64(k, a);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_conflict_epi64(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_conflict_epi64
+  #define _mm512_maskz_conflict_epi64(k, a) simde_mm512_maskz_conflict_epi64(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_CONFLICT_H) */
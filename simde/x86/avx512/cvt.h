@@ -31,6 +31,7 @@
 
 #include "types.h"
 #include "mov.h"
+#include "../f16c.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -116,6 +117,94 @@ simde_mm512_cvtepi8_epi16 (simde__m256i a) {
   #define _mm512_cvtepi8_epi16(a) simde_mm512_cvtepi8_epi16(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_cvtph_ps (simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_cvtph_ps(a);
+  #else
+    simde__m512_private r_;
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    r_.m256[0] = simde_mm256_cvtph_ps(a_.m128i[0]);
+    r_.m256[1] = simde_mm256_cvtph_ps(a_.m128i[1]);
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtph_ps
+  #define _mm512_cvtph_ps(a) simde_mm512_cvtph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_cvtph_ps (simde__m512 src, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_cvtph_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_cvtph_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_cvtph_ps
+  #define _mm512_mask_cvtph_ps(src, k, a) simde_mm512_mask_cvtph_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_cvtph_ps (simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_cvtph_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_cvtph_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_cvtph_ps
+  #define _mm512_maskz_cvtph_ps(k, a) simde_mm512_maskz_cvtph_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_cvtps_ph (simde__m512 a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private r_;
+  simde__m512_private a_ = simde__m512_to_private(a);
+
+  r_.m128i[0] = simde_mm256_cvtps_ph(a_.m256[0], imm8);
+  r_.m128i[1] = simde_mm256_cvtps_ph(a_.m256[1], imm8);
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_cvtps_ph(a, imm8) _mm512_cvtps_ph(a, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtps_ph
+  #define _mm512_cvtps_ph(a, imm8) simde_mm512_cvtps_ph(a, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_cvtps_ph(src, k, a, imm8) _mm512_mask_cvtps_ph(src, k, a, imm8)
+#else
+  #define simde_mm512_mask_cvtps_ph(src, k, a, imm8) simde_mm256_mask_mov_epi16(src, k, simde_mm512_cvtps_ph(a, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_cvtps_ph
+  #define _mm512_mask_cvtps_ph(src, k, a, imm8) simde_mm512_mask_cvtps_ph(src, k, a, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_cvtps_ph(k, a, imm8) _mm512_maskz_cvtps_ph(k, a, imm8)
+#else
+  #define simde_mm512_maskz_cvtps_ph(k, a, imm8) simde_mm256_maskz_mov_epi16(k, simde_mm512_cvtps_ph(a, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_cvtps_ph
+  #define _mm512_maskz_cvtps_ph(k, a, imm8) simde_mm512_maskz_cvtps_ph(k, a, imm8)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
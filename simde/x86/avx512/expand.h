@@ -0,0 +1,1534 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_AVX512_EXPAND_H)
+#define SIMDE_X86_AVX512_EXPAND_H
+
+#include "types.h"
+#include "mov.h"
+#include "compress.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Inverse of simde_x_compress_: spreads the leading elements of a
+ * (which must have n readable bytes) into the elements of r selected
+ * by k.  The unselected elements of r are left with garbage, so the
+ * callers blend the result with mask_mov/maskz_mov. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_expand_ (void* r, const void* a, size_t n, size_t e, uint64_t k) {
+  #if defined(SIMDE_X_COMPRESS_SHUFFLE_)
+    static const uint8_t lut[256][8] = {
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0, 0, 0, 0 },
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0, 0, 0 }, { 0, 1, 2, 0, 0, 0, 0, 0 },
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 1, 0, 0, 0, 0 }, { 0, 0, 0, 1, 0, 0, 0, 0 }, { 0, 1, 0, 2, 0, 0, 0, 0 },
+      { 0, 0, 0, 1, 0, 0, 0, 0 }, { 0, 0, 1, 2, 0, 0, 0, 0 }, { 0, 0, 1, 2, 0, 0, 0, 0 }, { 0, 1, 2, 3, 0, 0, 0, 0 },
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 1, 0, 0, 0 }, { 0, 0, 0, 0, 1, 0, 0, 0 }, { 0, 1, 0, 0, 2, 0, 0, 0 },
+      { 0, 0, 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 2, 0, 0, 0 }, { 0, 0, 1, 0, 2, 0, 0, 0 }, { 0, 1, 2, 0, 3, 0, 0, 0 },
+      { 0, 0, 0, 0, 1, 0, 0, 0 }, { 0, 0, 0, 1, 2, 0, 0, 0 }, { 0, 0, 0, 1, 2, 0, 0, 0 }, { 0, 1, 0, 2, 3, 0, 0, 0 },
+      { 0, 0, 0, 1, 2, 0, 0, 0 }, { 0, 0, 1, 2, 3, 0, 0, 0 }, { 0, 0, 1, 2, 3, 0, 0, 0 }, { 0, 1, 2, 3, 4, 0, 0, 0 },
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 0, 0, 1, 0, 0 }, { 0, 1, 0, 0, 0, 2, 0, 0 },
+      { 0, 0, 0, 0, 0, 1, 0, 0 }, { 0, 0, 1, 0, 0, 2, 0, 0 }, { 0, 0, 1, 0, 0, 2, 0, 0 }, { 0, 1, 2, 0, 0, 3, 0, 0 },
+      { 0, 0, 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 2, 0, 0 }, { 0, 0, 0, 1, 0, 2, 0, 0 }, { 0, 1, 0, 2, 0, 3, 0, 0 },
+      { 0, 0, 0, 1, 0, 2, 0, 0 }, { 0, 0, 1, 2, 0, 3, 0, 0 }, { 0, 0, 1, 2, 0, 3, 0, 0 }, { 0, 1, 2, 3, 0, 4, 0, 0 },
+      { 0, 0, 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 0, 1, 2, 0, 0 }, { 0, 0, 0, 0, 1, 2, 0, 0 }, { 0, 1, 0, 0, 2, 3, 0, 0 },
+      { 0, 0, 0, 0, 1, 2, 0, 0 }, { 0, 0, 1, 0, 2, 3, 0, 0 }, { 0, 0, 1, 0, 2, 3, 0, 0 }, { 0, 1, 2, 0, 3, 4, 0, 0 },
+      { 0, 0, 0, 0, 1, 2, 0, 0 }, { 0, 0, 0, 1, 2, 3, 0, 0 }, { 0, 0, 0, 1, 2, 3, 0, 0 }, { 0, 1, 0, 2, 3, 4, 0, 0 },
+      { 0, 0, 0, 1, 2, 3, 0, 0 }, { 0, 0, 1, 2, 3, 4, 0, 0 }, { 0, 0, 1, 2, 3, 4, 0, 0 }, { 0, 1, 2, 3, 4, 5, 0, 0 },
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 0, 0, 1, 0 }, { 0, 1, 0, 0, 0, 0, 2, 0 },
+      { 0, 0, 0, 0, 0, 0, 1, 0 }, { 0, 0, 1, 0, 0, 0, 2, 0 }, { 0, 0, 1, 0, 0, 0, 2, 0 }, { 0, 1, 2, 0, 0, 0, 3, 0 },
+      { 0, 0, 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 1, 0, 0, 2, 0 }, { 0, 0, 0, 1, 0, 0, 2, 0 }, { 0, 1, 0, 2, 0, 0, 3, 0 },
+      { 0, 0, 0, 1, 0, 0, 2, 0 }, { 0, 0, 1, 2, 0, 0, 3, 0 }, { 0, 0, 1, 2, 0, 0, 3, 0 }, { 0, 1, 2, 3, 0, 0, 4, 0 },
+      { 0, 0, 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0, 2, 0 }, { 0, 0, 0, 0, 1, 0, 2, 0 }, { 0, 1, 0, 0, 2, 0, 3, 0 },
+      { 0, 0, 0, 0, 1, 0, 2, 0 }, { 0, 0, 1, 0, 2, 0, 3, 0 }, { 0, 0, 1, 0, 2, 0, 3, 0 }, { 0, 1, 2, 0, 3, 0, 4, 0 },
+      { 0, 0, 0, 0, 1, 0, 2, 0 }, { 0, 0, 0, 1, 2, 0, 3, 0 }, { 0, 0, 0, 1, 2, 0, 3, 0 }, { 0, 1, 0, 2, 3, 0, 4, 0 },
+      { 0, 0, 0, 1, 2, 0, 3, 0 }, { 0, 0, 1, 2, 3, 0, 4, 0 }, { 0, 0, 1, 2, 3, 0, 4, 0 }, { 0, 1, 2, 3, 4, 0, 5, 0 },
+      { 0, 0, 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 0, 1, 2, 0 }, { 0, 0, 0, 0, 0, 1, 2, 0 }, { 0, 1, 0, 0, 0, 2, 3, 0 },
+      { 0, 0, 0, 0, 0, 1, 2, 0 }, { 0, 0, 1, 0, 0, 2, 3, 0 }, { 0, 0, 1, 0, 0, 2, 3, 0 }, { 0, 1, 2, 0, 0, 3, 4, 0 },
+      { 0, 0, 0, 0, 0, 1, 2, 0 }, { 0, 0, 0, 1, 0, 2, 3, 0 }, { 0, 0, 0, 1, 0, 2, 3, 0 }, { 0, 1, 0, 2, 0, 3, 4, 0 },
+      { 0, 0, 0, 1, 0, 2, 3, 0 }, { 0, 0, 1, 2, 0, 3, 4, 0 }, { 0, 0, 1, 2, 0, 3, 4, 0 }, { 0, 1, 2, 3, 0, 4, 5, 0 },
+      { 0, 0, 0, 0, 0, 1, 2, 0 }, { 0, 0, 0, 0, 1, 2, 3, 0 }, { 0, 0, 0, 0, 1, 2, 3, 0 }, { 0, 1, 0, 0, 2, 3, 4, 0 },
+      { 0, 0, 0, 0, 1, 2, 3, 0 }, { 0, 0, 1, 0, 2, 3, 4, 0 }, { 0, 0, 1, 0, 2, 3, 4, 0 }, { 0, 1, 2, 0, 3, 4, 5, 0 },
+      { 0, 0, 0, 0, 1, 2, 3, 0 }, { 0, 0, 0, 1, 2, 3, 4, 0 }, { 0, 0, 0, 1, 2, 3, 4, 0 }, { 0, 1, 0, 2, 3, 4, 5, 0 },
+      { 0, 0, 0, 1, 2, 3, 4, 0 }, { 0, 0, 1, 2, 3, 4, 5, 0 }, { 0, 0, 1, 2, 3, 4, 5, 0 }, { 0, 1, 2, 3, 4, 5, 6, 0 },
+      { 0, 0, 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 1, 0, 0, 0, 0, 0, 2 },
+      { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 0, 1, 0, 0, 0, 0, 2 }, { 0, 0, 1, 0, 0, 0, 0, 2 }, { 0, 1, 2, 0, 0, 0, 0, 3 },
+      { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 1, 0, 0, 0, 2 }, { 0, 0, 0, 1, 0, 0, 0, 2 }, { 0, 1, 0, 2, 0, 0, 0, 3 },
+      { 0, 0, 0, 1, 0, 0, 0, 2 }, { 0, 0, 1, 2, 0, 0, 0, 3 }, { 0, 0, 1, 2, 0, 0, 0, 3 }, { 0, 1, 2, 3, 0, 0, 0, 4 },
+      { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 1, 0, 0, 2 }, { 0, 0, 0, 0, 1, 0, 0, 2 }, { 0, 1, 0, 0, 2, 0, 0, 3 },
+      { 0, 0, 0, 0, 1, 0, 0, 2 }, { 0, 0, 1, 0, 2, 0, 0, 3 }, { 0, 0, 1, 0, 2, 0, 0, 3 }, { 0, 1, 2, 0, 3, 0, 0, 4 },
+      { 0, 0, 0, 0, 1, 0, 0, 2 }, { 0, 0, 0, 1, 2, 0, 0, 3 }, { 0, 0, 0, 1, 2, 0, 0, 3 }, { 0, 1, 0, 2, 3, 0, 0, 4 },
+      { 0, 0, 0, 1, 2, 0, 0, 3 }, { 0, 0, 1, 2, 3, 0, 0, 4 }, { 0, 0, 1, 2, 3, 0, 0, 4 }, { 0, 1, 2, 3, 4, 0, 0, 5 },
+      { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1, 0, 2 }, { 0, 0, 0, 0, 0, 1, 0, 2 }, { 0, 1, 0, 0, 0, 2, 0, 3 },
+      { 0, 0, 0, 0, 0, 1, 0, 2 }, { 0, 0, 1, 0, 0, 2, 0, 3 }, { 0, 0, 1, 0, 0, 2, 0, 3 }, { 0, 1, 2, 0, 0, 3, 0, 4 },
+      { 0, 0, 0, 0, 0, 1, 0, 2 }, { 0, 0, 0, 1, 0, 2, 0, 3 }, { 0, 0, 0, 1, 0, 2, 0, 3 }, { 0, 1, 0, 2, 0, 3, 0, 4 },
+      { 0, 0, 0, 1, 0, 2, 0, 3 }, { 0, 0, 1, 2, 0, 3, 0, 4 }, { 0, 0, 1, 2, 0, 3, 0, 4 }, { 0, 1, 2, 3, 0, 4, 0, 5 },
+      { 0, 0, 0, 0, 0, 1, 0, 2 }, { 0, 0, 0, 0, 1, 2, 0, 3 }, { 0, 0, 0, 0, 1, 2, 0, 3 }, { 0, 1, 0, 0, 2, 3, 0, 4 },
+      { 0, 0, 0, 0, 1, 2, 0, 3 }, { 0, 0, 1, 0, 2, 3, 0, 4 }, { 0, 0, 1, 0, 2, 3, 0, 4 }, { 0, 1, 2, 0, 3, 4, 0, 5 },
+      { 0, 0, 0, 0, 1, 2, 0, 3 }, { 0, 0, 0, 1, 2, 3, 0, 4 }, { 0, 0, 0, 1, 2, 3, 0, 4 }, { 0, 1, 0, 2, 3, 4, 0, 5 },
+      { 0, 0, 0, 1, 2, 3, 0, 4 }, { 0, 0, 1, 2, 3, 4, 0, 5 }, { 0, 0, 1, 2, 3, 4, 0, 5 }, { 0, 1, 2, 3, 4, 5, 0, 6 },
+      { 0, 0, 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 0, 1, 2 }, { 0, 0, 0, 0, 0, 0, 1, 2 }, { 0, 1, 0, 0, 0, 0, 2, 3 },
+      { 0, 0, 0, 0, 0, 0, 1, 2 }, { 0, 0, 1, 0, 0, 0, 2, 3 }, { 0, 0, 1, 0, 0, 0, 2, 3 }, { 0, 1, 2, 0, 0, 0, 3, 4 },
+      { 0, 0, 0, 0, 0, 0, 1, 2 }, { 0, 0, 0, 1, 0, 0, 2, 3 }, { 0, 0, 0, 1, 0, 0, 2, 3 }, { 0, 1, 0, 2, 0, 0, 3, 4 },
+      { 0, 0, 0, 1, 0, 0, 2, 3 }, { 0, 0, 1, 2, 0, 0, 3, 4 }, { 0, 0, 1, 2, 0, 0, 3, 4 }, { 0, 1, 2, 3, 0, 0, 4, 5 },
+      { 0, 0, 0, 0, 0, 0, 1, 2 }, { 0, 0, 0, 0, 1, 0, 2, 3 }, { 0, 0, 0, 0, 1, 0, 2, 3 }, { 0, 1, 0, 0, 2, 0, 3, 4 },
+      { 0, 0, 0, 0, 1, 0, 2, 3 }, { 0, 0, 1, 0, 2, 0, 3, 4 }, { 0, 0, 1, 0, 2, 0, 3, 4 }, { 0, 1, 2, 0, 3, 0, 4, 5 },
+      { 0, 0, 0, 0, 1, 0, 2, 3 }, { 0, 0, 0, 1, 2, 0, 3, 4 }, { 0, 0, 0, 1, 2, 0, 3, 4 }, { 0, 1, 0, 2, 3, 0, 4, 5 },
+      { 0, 0, 0, 1, 2, 0, 3, 4 }, { 0, 0, 1, 2, 3, 0, 4, 5 }, { 0, 0, 1, 2, 3, 0, 4, 5 }, { 0, 1, 2, 3, 4, 0, 5, 6 },
+      { 0, 0, 0, 0, 0, 0, 1, 2 }, { 0, 0, 0, 0, 0, 1, 2, 3 }, { 0, 0, 0, 0, 0, 1, 2, 3 }, { 0, 1, 0, 0, 0, 2, 3, 4 },
+      { 0, 0, 0, 0, 0, 1, 2, 3 }, { 0, 0, 1, 0, 0, 2, 3, 4 }, { 0, 0, 1, 0, 0, 2, 3, 4 }, { 0, 1, 2, 0, 0, 3, 4, 5 },
+      { 0, 0, 0, 0, 0, 1, 2, 3 }, { 0, 0, 0, 1, 0, 2, 3, 4 }, { 0, 0, 0, 1, 0, 2, 3, 4 }, { 0, 1, 0, 2, 0, 3, 4, 5 },
+      { 0, 0, 0, 1, 0, 2, 3, 4 }, { 0, 0, 1, 2, 0, 3, 4, 5 }, { 0, 0, 1, 2, 0, 3, 4, 5 }, { 0, 1, 2, 3, 0, 4, 5, 6 },
+      { 0, 0, 0, 0, 0, 1, 2, 3 }, { 0, 0, 0, 0, 1, 2, 3, 4 }, { 0, 0, 0, 0, 1, 2, 3, 4 }, { 0, 1, 0, 0, 2, 3, 4, 5 },
+      { 0, 0, 0, 0, 1, 2, 3, 4 }, { 0, 0, 1, 0, 2, 3, 4, 5 }, { 0, 0, 1, 0, 2, 3, 4, 5 }, { 0, 1, 2, 0, 3, 4, 5, 6 },
+      { 0, 0, 0, 0, 1, 2, 3, 4 }, { 0, 0, 0, 1, 2, 3, 4, 5 }, { 0, 0, 0, 1, 2, 3, 4, 5 }, { 0, 1, 0, 2, 3, 4, 5, 6 },
+      { 0, 0, 0, 1, 2, 3, 4, 5 }, { 0, 0, 1, 2, 3, 4, 5, 6 }, { 0, 0, 1, 2, 3, 4, 5, 6 }, { 0, 1, 2, 3, 4, 5, 6, 7 }
+    };
+  #endif
+  const uint8_t* a_ = HEDLEY_REINTERPRET_CAST(const uint8_t*, a);
+  uint8_t* r_ = HEDLEY_REINTERPRET_CAST(uint8_t*, r);
+  size_t pos = 0, i = 0;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X_COMPRESS_SHUFFLE_)
+    if ((e >= 4) && ((n % 32) == 0)) {
+      for ( ; i < n ; i += 32, k >>= 32 / e) {
+        const unsigned int m = simde_x_compress_grain_mask_(k, e / 4);
+        const __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const __m128i*, lut[m])));
+        const __m256i v = _mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const __m256i*, &(a_[pos])));
+        _mm256_storeu_si256(HEDLEY_REINTERPRET_CAST(__m256i*, &(r_[i])), _mm256_permutevar8x32_epi32(v, idx));
+        pos += simde_x_compress_popcount_(m) * 4;
+      }
+    }
+  #endif
+
+  #if defined(SIMDE_X_COMPRESS_SHUFFLE_)
+    if (e <= 2) {
+      /* Eight bytes are loaded from a at pos each step; pos never
+       * passes i, so this never reads past the end of a. */
+      for ( ; i < n ; i += 8, k >>= 8 / e) {
+        const unsigned int m = simde_x_compress_grain_mask_(k, e);
+        #if defined(SIMDE_X86_SSSE3_NATIVE)
+          const __m128i v = _mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const __m128i*, &(a_[pos])));
+          _mm_storel_epi64(HEDLEY_REINTERPRET_CAST(__m128i*, &(r_[i])), _mm_shuffle_epi8(v, _mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const __m128i*, lut[m]))));
+        #else
+          vst1_u8(&(r_[i]), vtbl1_u8(vld1_u8(&(a_[pos])), vld1_u8(lut[m])));
+        #endif
+        pos += simde_x_compress_popcount_(m);
+      }
+    }
+  #endif
+
+  for ( ; i < n ; i += e, k >>= 1) {
+    simde_memcpy(&(r_[i]), &(a_[pos]), e);
+    pos += HEDLEY_STATIC_CAST(size_t, k & 1) * e;
+  }
+}
+
+/* Like simde_x_expand_, but only reads as many elements from mem_addr
+ * as k selects. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_expandloadu_ (void* r, const void* mem_addr, size_t n, size_t e, uint64_t k) {
+  uint8_t buf[sizeof(simde__m512i)] = { 0 };
+
+  if ((n / e) < 64)
+    k &= (UINT64_C(1) << (n / e)) - 1;
+  simde_memcpy(buf, mem_addr, simde_x_compress_popcount_(k) * e);
+
+  simde_x_expand_(r, buf, n, e, k);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_epi8(src, k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm_mask_mov_epi8(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_epi8
+  #define _mm_mask_expand_epi8(src, k, a) simde_mm_mask_expand_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi8 (simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_epi8(k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm_maskz_mov_epi8(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_epi8
+  #define _mm_maskz_expand_epi8(k, a) simde_mm_maskz_expand_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi8 (simde__m128i src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_epi8(src, k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm_mask_mov_epi8(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_epi8
+  #define _mm_mask_expandloadu_epi8(src, k, mem_addr) simde_mm_mask_expandloadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi8 (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_epi8(k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm_maskz_mov_epi8(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_epi8
+  #define _mm_maskz_expandloadu_epi8(k, mem_addr) simde_mm_maskz_expandloadu_epi8(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_epi16(src, k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm_mask_mov_epi16(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_epi16
+  #define _mm_mask_expand_epi16(src, k, a) simde_mm_mask_expand_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi16 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_epi16(k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm_maskz_mov_epi16(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_epi16
+  #define _mm_maskz_expand_epi16(k, a) simde_mm_maskz_expand_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi16 (simde__m128i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_epi16(src, k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm_mask_mov_epi16(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_epi16
+  #define _mm_mask_expandloadu_epi16(src, k, mem_addr) simde_mm_mask_expandloadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi16 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_epi16(k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm_maskz_mov_epi16(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_epi16
+  #define _mm_maskz_expandloadu_epi16(k, mem_addr) simde_mm_maskz_expandloadu_epi16(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_epi32(src, k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm_mask_mov_epi32(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_epi32
+  #define _mm_mask_expand_epi32(src, k, a) simde_mm_mask_expand_epi32(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi32 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_epi32(k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm_maskz_mov_epi32(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_epi32
+  #define _mm_maskz_expand_epi32(k, a) simde_mm_maskz_expand_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi32 (simde__m128i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_epi32(src, k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm_mask_mov_epi32(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_epi32
+  #define _mm_mask_expandloadu_epi32(src, k, mem_addr) simde_mm_mask_expandloadu_epi32(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi32 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_epi32(k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm_maskz_mov_epi32(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_epi32
+  #define _mm_maskz_expandloadu_epi32(k, mem_addr) simde_mm_maskz_expandloadu_epi32(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_epi64(src, k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm_mask_mov_epi64(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_epi64
+  #define _mm_mask_expand_epi64(src, k, a) simde_mm_mask_expand_epi64(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi64 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_epi64(k, a);
+  #else
+    simde__m128i_private
+      a_ = simde__m128i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm_maskz_mov_epi64(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_epi64
+  #define _mm_maskz_expand_epi64(k, a) simde_mm_maskz_expand_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi64 (simde__m128i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_epi64(src, k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm_mask_mov_epi64(src, k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_epi64
+  #define _mm_mask_expandloadu_epi64(src, k, mem_addr) simde_mm_mask_expandloadu_epi64(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_epi64(k, mem_addr);
+  #else
+    simde__m128i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm_maskz_mov_epi64(k, simde__m128i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_epi64
+  #define _mm_maskz_expandloadu_epi64(k, mem_addr) simde_mm_maskz_expandloadu_epi64(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_expand_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_ps(src, k, a);
+  #else
+    simde__m128_private
+      a_ = simde__m128_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm_mask_mov_ps(src, k, simde__m128_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_ps
+  #define _mm_mask_expand_ps(src, k, a) simde_mm_mask_expand_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_expand_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_ps(k, a);
+  #else
+    simde__m128_private
+      a_ = simde__m128_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm_maskz_mov_ps(k, simde__m128_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_ps
+  #define _mm_maskz_expand_ps(k, a) simde_mm_maskz_expand_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_expandloadu_ps (simde__m128 src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_ps(src, k, mem_addr);
+  #else
+    simde__m128_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm_mask_mov_ps(src, k, simde__m128_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_ps
+  #define _mm_mask_expandloadu_ps(src, k, mem_addr) simde_mm_mask_expandloadu_ps(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_expandloadu_ps (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_ps(k, mem_addr);
+  #else
+    simde__m128_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm_maskz_mov_ps(k, simde__m128_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_ps
+  #define _mm_maskz_expandloadu_ps(k, mem_addr) simde_mm_maskz_expandloadu_ps(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_expand_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_pd(src, k, a);
+  #else
+    simde__m128d_private
+      a_ = simde__m128d_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm_mask_mov_pd(src, k, simde__m128d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_pd
+  #define _mm_mask_expand_pd(src, k, a) simde_mm_mask_expand_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_expand_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_pd(k, a);
+  #else
+    simde__m128d_private
+      a_ = simde__m128d_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm_maskz_mov_pd(k, simde__m128d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_pd
+  #define _mm_maskz_expand_pd(k, a) simde_mm_maskz_expand_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_expandloadu_pd (simde__m128d src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_pd(src, k, mem_addr);
+  #else
+    simde__m128d_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm_mask_mov_pd(src, k, simde__m128d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_pd
+  #define _mm_mask_expandloadu_pd(src, k, mem_addr) simde_mm_mask_expandloadu_pd(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_expandloadu_pd (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_pd(k, mem_addr);
+  #else
+    simde__m128d_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm_maskz_mov_pd(k, simde__m128d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_pd
+  #define _mm_maskz_expandloadu_pd(k, mem_addr) simde_mm_maskz_expandloadu_pd(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_epi8(src, k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm256_mask_mov_epi8(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_epi8
+  #define _mm256_mask_expand_epi8(src, k, a) simde_mm256_mask_expand_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi8 (simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_epi8(k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm256_maskz_mov_epi8(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_epi8
+  #define _mm256_maskz_expand_epi8(k, a) simde_mm256_maskz_expand_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi8 (simde__m256i src, simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_epi8(src, k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm256_mask_mov_epi8(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_epi8
+  #define _mm256_mask_expandloadu_epi8(src, k, mem_addr) simde_mm256_mask_expandloadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi8 (simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_epi8(k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm256_maskz_mov_epi8(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_epi8
+  #define _mm256_maskz_expandloadu_epi8(k, mem_addr) simde_mm256_maskz_expandloadu_epi8(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_epi16(src, k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm256_mask_mov_epi16(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_epi16
+  #define _mm256_mask_expand_epi16(src, k, a) simde_mm256_mask_expand_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi16 (simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_epi16(k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm256_maskz_mov_epi16(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_epi16
+  #define _mm256_maskz_expand_epi16(k, a) simde_mm256_maskz_expand_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi16 (simde__m256i src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_epi16(src, k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm256_mask_mov_epi16(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_epi16
+  #define _mm256_mask_expandloadu_epi16(src, k, mem_addr) simde_mm256_mask_expandloadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi16 (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_epi16(k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm256_maskz_mov_epi16(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_epi16
+  #define _mm256_maskz_expandloadu_epi16(k, mem_addr) simde_mm256_maskz_expandloadu_epi16(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_epi32(src, k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm256_mask_mov_epi32(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_epi32
+  #define _mm256_mask_expand_epi32(src, k, a) simde_mm256_mask_expand_epi32(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi32 (simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_epi32(k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm256_maskz_mov_epi32(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_epi32
+  #define _mm256_maskz_expand_epi32(k, a) simde_mm256_maskz_expand_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi32 (simde__m256i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_epi32(src, k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm256_mask_mov_epi32(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_epi32
+  #define _mm256_mask_expandloadu_epi32(src, k, mem_addr) simde_mm256_mask_expandloadu_epi32(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi32 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_epi32(k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm256_maskz_mov_epi32(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_epi32
+  #define _mm256_maskz_expandloadu_epi32(k, mem_addr) simde_mm256_maskz_expandloadu_epi32(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_epi64(src, k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm256_mask_mov_epi64(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_epi64
+  #define _mm256_mask_expand_epi64(src, k, a) simde_mm256_mask_expand_epi64(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi64 (simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_epi64(k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm256_maskz_mov_epi64(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_epi64
+  #define _mm256_maskz_expand_epi64(k, a) simde_mm256_maskz_expand_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi64 (simde__m256i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_epi64(src, k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm256_mask_mov_epi64(src, k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_epi64
+  #define _mm256_mask_expandloadu_epi64(src, k, mem_addr) simde_mm256_mask_expandloadu_epi64(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_epi64(k, mem_addr);
+  #else
+    simde__m256i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm256_maskz_mov_epi64(k, simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_epi64
+  #define _mm256_maskz_expandloadu_epi64(k, mem_addr) simde_mm256_maskz_expandloadu_epi64(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_expand_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_ps(src, k, a);
+  #else
+    simde__m256_private
+      a_ = simde__m256_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm256_mask_mov_ps(src, k, simde__m256_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_ps
+  #define _mm256_mask_expand_ps(src, k, a) simde_mm256_mask_expand_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_expand_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_ps(k, a);
+  #else
+    simde__m256_private
+      a_ = simde__m256_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm256_maskz_mov_ps(k, simde__m256_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_ps
+  #define _mm256_maskz_expand_ps(k, a) simde_mm256_maskz_expand_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_expandloadu_ps (simde__m256 src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_ps(src, k, mem_addr);
+  #else
+    simde__m256_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm256_mask_mov_ps(src, k, simde__m256_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_ps
+  #define _mm256_mask_expandloadu_ps(src, k, mem_addr) simde_mm256_mask_expandloadu_ps(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_expandloadu_ps (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_ps(k, mem_addr);
+  #else
+    simde__m256_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm256_maskz_mov_ps(k, simde__m256_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_ps
+  #define _mm256_maskz_expandloadu_ps(k, mem_addr) simde_mm256_maskz_expandloadu_ps(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_expand_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_pd(src, k, a);
+  #else
+    simde__m256d_private
+      a_ = simde__m256d_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm256_mask_mov_pd(src, k, simde__m256d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_pd
+  #define _mm256_mask_expand_pd(src, k, a) simde_mm256_mask_expand_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_expand_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_pd(k, a);
+  #else
+    simde__m256d_private
+      a_ = simde__m256d_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm256_maskz_mov_pd(k, simde__m256d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_pd
+  #define _mm256_maskz_expand_pd(k, a) simde_mm256_maskz_expand_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_expandloadu_pd (simde__m256d src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_pd(src, k, mem_addr);
+  #else
+    simde__m256d_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm256_mask_mov_pd(src, k, simde__m256d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_pd
+  #define _mm256_mask_expandloadu_pd(src, k, mem_addr) simde_mm256_mask_expandloadu_pd(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_expandloadu_pd (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_pd(k, mem_addr);
+  #else
+    simde__m256d_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm256_maskz_mov_pd(k, simde__m256d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_pd
+  #define _mm256_maskz_expandloadu_pd(k, mem_addr) simde_mm256_maskz_expandloadu_pd(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expand_epi8(src, k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm512_mask_mov_epi8(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_epi8
+  #define _mm512_mask_expand_epi8(src, k, a) simde_mm512_mask_expand_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi8 (simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expand_epi8(k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm512_maskz_mov_epi8(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_epi8
+  #define _mm512_maskz_expand_epi8(k, a) simde_mm512_maskz_expand_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi8 (simde__m512i src, simde__mmask64 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expandloadu_epi8(src, k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm512_mask_mov_epi8(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_epi8
+  #define _mm512_mask_expandloadu_epi8(src, k, mem_addr) simde_mm512_mask_expandloadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi8 (simde__mmask64 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expandloadu_epi8(k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i8[0]), k);
+
+    return simde_mm512_maskz_mov_epi8(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_epi8
+  #define _mm512_maskz_expandloadu_epi8(k, mem_addr) simde_mm512_maskz_expandloadu_epi8(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expand_epi16(src, k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm512_mask_mov_epi16(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_epi16
+  #define _mm512_mask_expand_epi16(src, k, a) simde_mm512_mask_expand_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi16 (simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expand_epi16(k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm512_maskz_mov_epi16(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_epi16
+  #define _mm512_maskz_expand_epi16(k, a) simde_mm512_maskz_expand_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi16 (simde__m512i src, simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expandloadu_epi16(src, k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm512_mask_mov_epi16(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_epi16
+  #define _mm512_mask_expandloadu_epi16(src, k, mem_addr) simde_mm512_mask_expandloadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi16 (simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expandloadu_epi16(k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i16[0]), k);
+
+    return simde_mm512_maskz_mov_epi16(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_epi16
+  #define _mm512_maskz_expandloadu_epi16(k, mem_addr) simde_mm512_maskz_expandloadu_epi16(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expand_epi32(src, k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm512_mask_mov_epi32(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_epi32
+  #define _mm512_mask_expand_epi32(src, k, a) simde_mm512_mask_expand_epi32(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expand_epi32(k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm512_maskz_mov_epi32(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_epi32
+  #define _mm512_maskz_expand_epi32(k, a) simde_mm512_maskz_expand_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi32 (simde__m512i src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_epi32(src, k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm512_mask_mov_epi32(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_epi32
+  #define _mm512_mask_expandloadu_epi32(src, k, mem_addr) simde_mm512_mask_expandloadu_epi32(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi32 (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_epi32(k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i32[0]), k);
+
+    return simde_mm512_maskz_mov_epi32(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_epi32
+  #define _mm512_maskz_expandloadu_epi32(k, mem_addr) simde_mm512_maskz_expandloadu_epi32(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expand_epi64(src, k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm512_mask_mov_epi64(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_epi64
+  #define _mm512_mask_expand_epi64(src, k, a) simde_mm512_mask_expand_epi64(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expand_epi64(k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm512_maskz_mov_epi64(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_epi64
+  #define _mm512_maskz_expand_epi64(k, a) simde_mm512_maskz_expand_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi64 (simde__m512i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_epi64(src, k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm512_mask_mov_epi64(src, k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_epi64
+  #define _mm512_mask_expandloadu_epi64(src, k, mem_addr) simde_mm512_mask_expandloadu_epi64(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi64 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_epi64(k, mem_addr);
+  #else
+    simde__m512i_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.i64[0]), k);
+
+    return simde_mm512_maskz_mov_epi64(k, simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_epi64
+  #define _mm512_maskz_expandloadu_epi64(k, mem_addr) simde_mm512_maskz_expandloadu_epi64(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_expand_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expand_ps(src, k, a);
+  #else
+    simde__m512_private
+      a_ = simde__m512_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm512_mask_mov_ps(src, k, simde__m512_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_ps
+  #define _mm512_mask_expand_ps(src, k, a) simde_mm512_mask_expand_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_expand_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expand_ps(k, a);
+  #else
+    simde__m512_private
+      a_ = simde__m512_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm512_maskz_mov_ps(k, simde__m512_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_ps
+  #define _mm512_maskz_expand_ps(k, a) simde_mm512_maskz_expand_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_expandloadu_ps (simde__m512 src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_ps(src, k, mem_addr);
+  #else
+    simde__m512_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm512_mask_mov_ps(src, k, simde__m512_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_ps
+  #define _mm512_mask_expandloadu_ps(src, k, mem_addr) simde_mm512_mask_expandloadu_ps(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_expandloadu_ps (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_ps(k, mem_addr);
+  #else
+    simde__m512_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f32[0]), k);
+
+    return simde_mm512_maskz_mov_ps(k, simde__m512_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_ps
+  #define _mm512_maskz_expandloadu_ps(k, mem_addr) simde_mm512_maskz_expandloadu_ps(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_expand_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expand_pd(src, k, a);
+  #else
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm512_mask_mov_pd(src, k, simde__m512d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_pd
+  #define _mm512_mask_expand_pd(src, k, a) simde_mm512_mask_expand_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_expand_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expand_pd(k, a);
+  #else
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a),
+      r_;
+
+    simde_x_expand_(&r_, &a_, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm512_maskz_mov_pd(k, simde__m512d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_pd
+  #define _mm512_maskz_expand_pd(k, a) simde_mm512_maskz_expand_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_expandloadu_pd (simde__m512d src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_expandloadu_pd(src, k, mem_addr);
+  #else
+    simde__m512d_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm512_mask_mov_pd(src, k, simde__m512d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_pd
+  #define _mm512_mask_expandloadu_pd(src, k, mem_addr) simde_mm512_mask_expandloadu_pd(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_expandloadu_pd (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_expandloadu_pd(k, mem_addr);
+  #else
+    simde__m512d_private r_;
+
+    simde_x_expandloadu_(&r_, mem_addr, sizeof(r_), sizeof(r_.f64[0]), k);
+
+    return simde_mm512_maskz_mov_pd(k, simde__m512d_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_pd
+  #define _mm512_maskz_expandloadu_pd(k, mem_addr) simde_mm512_maskz_expandloadu_pd(k, mem_addr)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_EXPAND_H) */
@@ -0,0 +1,979 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !defined(SIMDE_X86_AVX512_GATHER_H)
+#define SIMDE_X86_AVX512_GATHER_H
+
+#include "types.h"
+#include "movm.h"
+#include "setzero.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_X86_AVX2_NATIVE)
+  /* The AVX2 gathers we build on need scale as an immediate, and once
+   * it has been passed through a function parameter it isn't one (at
+   * least not without optimization), so dispatch on it explicitly. */
+  #define SIMDE_X_GATHER_SCALE_(r, gather, base_addr, vindex, scale) \
+    switch (scale) { \
+      case 1: r = gather(base_addr, vindex, 1); break; \
+      case 2: r = gather(base_addr, vindex, 2); break; \
+      case 4: r = gather(base_addr, vindex, 4); break; \
+      default: r = gather(base_addr, vindex, 8); break; \
+    }
+  #define SIMDE_X_MASK_GATHER_SCALE_(r, gather, src, base_addr, vindex, mask, scale) \
+    switch (scale) { \
+      case 1: r = gather(src, base_addr, vindex, mask, 1); break; \
+      case 2: r = gather(src, base_addr, vindex, mask, 2); break; \
+      case 4: r = gather(src, base_addr, vindex, mask, 4); break; \
+      default: r = gather(src, base_addr, vindex, mask, 8); break; \
+    }
+#endif
+
+/* Byte offset of lane i of a vector of 32- or 64-bit (is bytes)
+ * indices, scaled. */
+SIMDE_FUNCTION_ATTRIBUTES
+size_t
+simde_x_vindex_offset_ (const void* vindex, size_t i, size_t is, const int32_t scale) {
+  const uint8_t* vindex_ = HEDLEY_STATIC_CAST(const uint8_t*, vindex);
+
+  if (is == sizeof(int32_t)) {
+    int32_t idx;
+    simde_memcpy(&idx, &(vindex_[i * is]), sizeof(idx));
+    return HEDLEY_STATIC_CAST(size_t, idx) * HEDLEY_STATIC_CAST(size_t, scale);
+  }
+  else {
+    int64_t idx;
+    simde_memcpy(&idx, &(vindex_[i * is]), sizeof(idx));
+    return HEDLEY_STATIC_CAST(size_t, idx) * HEDLEY_STATIC_CAST(size_t, scale);
+  }
+}
+
+/* Gather n e-byte lanes into r; lanes not selected by k (when masked)
+ * are taken from src.  Lanes are done four at a time, with all four
+ * addresses worked out before the first load so the loads can overlap;
+ * a masked-off lane simply loads from src, which keeps the batch free
+ * of branches. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_gather_ (void* r, const void* src, const void* base_addr, const void* vindex, size_t is, size_t e, size_t n, uint32_t k, int masked, const int32_t scale) {
+  const uint8_t* addr = HEDLEY_STATIC_CAST(const uint8_t*, base_addr);
+  const uint8_t* src_ = HEDLEY_STATIC_CAST(const uint8_t*, src);
+  uint8_t* r_ = HEDLEY_STATIC_CAST(uint8_t*, r);
+
+  #define SIMDE_X_GATHER_LANE_ADDR_(i) \
+    ((!masked || ((k >> (i)) & 1)) ? (addr + simde_x_vindex_offset_(vindex, (i), is, scale)) : &(src_[(i) * e]))
+
+  for (size_t i = 0 ; (i + 4) <= n ; i += 4) {
+    const uint8_t* p0 = SIMDE_X_GATHER_LANE_ADDR_(i    );
+    const uint8_t* p1 = SIMDE_X_GATHER_LANE_ADDR_(i + 1);
+    const uint8_t* p2 = SIMDE_X_GATHER_LANE_ADDR_(i + 2);
+    const uint8_t* p3 = SIMDE_X_GATHER_LANE_ADDR_(i + 3);
+
+    simde_memcpy(&(r_[(i    ) * e]), p0, e);
+    simde_memcpy(&(r_[(i + 1) * e]), p1, e);
+    simde_memcpy(&(r_[(i + 2) * e]), p2, e);
+    simde_memcpy(&(r_[(i + 3) * e]), p3, e);
+  }
+
+  /* Only the 128-bit forms with 64-bit lanes have fewer than four. */
+  for (size_t i = 0 ; n < 4 && i < n ; i++) {
+    simde_memcpy(&(r_[i * e]), SIMDE_X_GATHER_LANE_ADDR_(i), e);
+  }
+
+  #undef SIMDE_X_GATHER_LANE_ADDR_
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i32gather_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i32gather_epi32, src, HEDLEY_STATIC_CAST(int const*, base_addr), vindex, simde_mm_movm_epi32(k), scale)
+    return r;
+  #else
+    simde__m128i_private
+      vindex_ = simde__m128i_to_private(vindex),
+      src_ = simde__m128i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_epi32
+  #define _mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i32gather_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i32gather_epi64, src, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex, simde_mm_movm_epi64(k), scale)
+    return r;
+  #else
+    simde__m128i_private
+      vindex_ = simde__m128i_to_private(vindex),
+      src_ = simde__m128i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i64[0]), sizeof(r_.i64) / sizeof(r_.i64[0]), k, 1, scale);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_epi64
+  #define _mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mmask_i32gather_ps (simde__m128 src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128 r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i32gather_ps, src, HEDLEY_STATIC_CAST(float const*, base_addr), vindex, _mm_castsi128_ps(simde_mm_movm_epi32(k)), scale)
+    return r;
+  #else
+    simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+    simde__m128_private
+      src_ = simde__m128_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_ps
+  #define _mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mmask_i32gather_pd (simde__m128d src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128d r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i32gather_pd, src, HEDLEY_STATIC_CAST(double const*, base_addr), vindex, _mm_castsi128_pd(simde_mm_movm_epi64(k)), scale)
+    return r;
+  #else
+    simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+    simde__m128d_private
+      src_ = simde__m128d_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f64[0]), sizeof(r_.f64) / sizeof(r_.f64[0]), k, 1, scale);
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_pd
+  #define _mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i64gather_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i64gather_epi32, src, HEDLEY_STATIC_CAST(int const*, base_addr), vindex, simde_mm_movm_epi32(k), scale)
+    return r;
+  #else
+    simde__m128i_private
+      vindex_ = simde__m128i_to_private(vindex),
+      src_ = simde__m128i_to_private(src),
+      r_ = simde__m128i_to_private(simde_mm_setzero_si128());
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_epi32
+  #define _mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i64gather_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i64gather_epi64, src, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex, simde_mm_movm_epi64(k), scale)
+    return r;
+  #else
+    simde__m128i_private
+      vindex_ = simde__m128i_to_private(vindex),
+      src_ = simde__m128i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_epi64
+  #define _mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mmask_i64gather_ps (simde__m128 src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128 r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i64gather_ps, src, HEDLEY_STATIC_CAST(float const*, base_addr), vindex, _mm_castsi128_ps(simde_mm_movm_epi32(k)), scale)
+    return r;
+  #else
+    simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+    simde__m128_private
+      src_ = simde__m128_to_private(src),
+      r_ = simde__m128_to_private(simde_mm_setzero_ps());
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_ps
+  #define _mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mmask_i64gather_pd (simde__m128d src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128d r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm_mask_i64gather_pd, src, HEDLEY_STATIC_CAST(double const*, base_addr), vindex, _mm_castsi128_pd(simde_mm_movm_epi64(k)), scale)
+    return r;
+  #else
+    simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+    simde__m128d_private
+      src_ = simde__m128d_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_pd
+  #define _mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mmask_i32gather_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i32gather_epi32, src, HEDLEY_STATIC_CAST(int const*, base_addr), vindex, simde_mm256_movm_epi32(k), scale)
+    return r;
+  #else
+    simde__m256i_private
+      vindex_ = simde__m256i_to_private(vindex),
+      src_ = simde__m256i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_epi32
+  #define _mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mmask_i32gather_epi64 (simde__m256i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i32gather_epi64, src, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex, simde_mm256_movm_epi64(k), scale)
+    return r;
+  #else
+    simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+    simde__m256i_private
+      src_ = simde__m256i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_epi64
+  #define _mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mmask_i32gather_ps (simde__m256 src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256 r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i32gather_ps, src, HEDLEY_STATIC_CAST(float const*, base_addr), vindex, _mm256_castsi256_ps(simde_mm256_movm_epi32(k)), scale)
+    return r;
+  #else
+    simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+    simde__m256_private
+      src_ = simde__m256_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_ps
+  #define _mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mmask_i32gather_pd (simde__m256d src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256d r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i32gather_pd, src, HEDLEY_STATIC_CAST(double const*, base_addr), vindex, _mm256_castsi256_pd(simde_mm256_movm_epi64(k)), scale)
+    return r;
+  #else
+    simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+    simde__m256d_private
+      src_ = simde__m256d_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_pd
+  #define _mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_mmask_i64gather_epi32 (simde__m128i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i64gather_epi32, src, HEDLEY_STATIC_CAST(int const*, base_addr), vindex, simde_mm_movm_epi32(k), scale)
+    return r;
+  #else
+    simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+    simde__m128i_private
+      src_ = simde__m128i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_epi32
+  #define _mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mmask_i64gather_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256i r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i64gather_epi64, src, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex, simde_mm256_movm_epi64(k), scale)
+    return r;
+  #else
+    simde__m256i_private
+      vindex_ = simde__m256i_to_private(vindex),
+      src_ = simde__m256i_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_epi64
+  #define _mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_mmask_i64gather_ps (simde__m128 src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m128 r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i64gather_ps, src, HEDLEY_STATIC_CAST(float const*, base_addr), vindex, _mm_castsi128_ps(simde_mm_movm_epi32(k)), scale)
+    return r;
+  #else
+    simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+    simde__m128_private
+      src_ = simde__m128_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_ps
+  #define _mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mmask_i64gather_pd (simde__m256d src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    __m256d r;
+    SIMDE_X_MASK_GATHER_SCALE_(r, _mm256_mask_i64gather_pd, src, HEDLEY_STATIC_CAST(double const*, base_addr), vindex, _mm256_castsi256_pd(simde_mm256_movm_epi64(k)), scale)
+    return r;
+  #else
+    simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+    simde__m256d_private
+      src_ = simde__m256d_to_private(src),
+      r_;
+
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_pd
+  #define _mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i32gather_epi32 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m256i[0], _mm256_i32gather_epi32, HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m256i[1], _mm256_i32gather_epi32, HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_epi32(vindex, base_addr, scale) _mm512_i32gather_epi32(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_epi32
+  #define _mm512_i32gather_epi32(vindex, base_addr, scale) simde_mm512_i32gather_epi32(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i32gather_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    src_ = simde__m512i_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256i[0], _mm256_mask_i32gather_epi32, src_.m256i[0], HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[0], simde_mm256_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k)), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256i[1], _mm256_mask_i32gather_epi32, src_.m256i[1], HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[1], simde_mm256_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8)), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_epi32
+  #define _mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i32gather_epi64 (simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m256i[0], _mm256_i32gather_epi64, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m128i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m256i[1], _mm256_i32gather_epi64, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m128i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_epi64(vindex, base_addr, scale) _mm512_i32gather_epi64(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_epi64
+  #define _mm512_i32gather_epi64(vindex, base_addr, scale) simde_mm512_i32gather_epi64(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i32gather_epi64 (simde__m512i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256i[0], _mm256_mask_i32gather_epi64, src_.m256i[0], HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m128i[0], simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k)), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256i[1], _mm256_mask_i32gather_epi64, src_.m256i[1], HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m128i[1], simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4)), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_epi64
+  #define _mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_i32gather_ps (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m256[0], _mm256_i32gather_ps, HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m256[1], _mm256_i32gather_ps, HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+  #endif
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_ps(vindex, base_addr, scale) _mm512_i32gather_ps(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_ps
+  #define _mm512_i32gather_ps(vindex, base_addr, scale) simde_mm512_i32gather_ps(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_i32gather_ps (simde__m512 src, simde__mmask16 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private
+    src_ = simde__m512_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256[0], _mm256_mask_i32gather_ps, src_.m256[0], HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[0], _mm256_castsi256_ps(simde_mm256_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k))), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256[1], _mm256_mask_i32gather_ps, src_.m256[1], HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[1], _mm256_castsi256_ps(simde_mm256_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8))), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+  #endif
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_ps
+  #define _mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_i32gather_pd (simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m256d[0], _mm256_i32gather_pd, HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m128i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m256d[1], _mm256_i32gather_pd, HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m128i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_pd(vindex, base_addr, scale) _mm512_i32gather_pd(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_pd
+  #define _mm512_i32gather_pd(vindex, base_addr, scale) simde_mm512_i32gather_pd(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_i32gather_pd (simde__m512d src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private
+    src_ = simde__m512d_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256d[0], _mm256_mask_i32gather_pd, src_.m256d[0], HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m128i[0], _mm256_castsi256_pd(simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k))), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256d[1], _mm256_mask_i32gather_pd, src_.m256d[1], HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m128i[1], _mm256_castsi256_pd(simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4))), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i32[0]), sizeof(r_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_pd
+  #define _mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_i64gather_epi32 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m128i[0], _mm256_i64gather_epi32, HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m128i[1], _mm256_i64gather_epi32, HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_epi32(vindex, base_addr, scale) _mm512_i64gather_epi32(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_epi32
+  #define _mm512_i64gather_epi32(vindex, base_addr, scale) simde_mm512_i64gather_epi32(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_mask_i64gather_epi32 (simde__m256i src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m128i[0], _mm256_mask_i64gather_epi32, src_.m128i[0], HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[0], simde_mm_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k)), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m128i[1], _mm256_mask_i64gather_epi32, src_.m128i[1], HEDLEY_STATIC_CAST(int const*, base_addr), vindex_.m256i[1], simde_mm_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4)), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_epi32
+  #define _mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i64gather_epi64 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m256i[0], _mm256_i64gather_epi64, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m256i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m256i[1], _mm256_i64gather_epi64, HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m256i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_epi64(vindex, base_addr, scale) _mm512_i64gather_epi64(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_epi64
+  #define _mm512_i64gather_epi64(vindex, base_addr, scale) simde_mm512_i64gather_epi64(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i64gather_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    src_ = simde__m512i_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256i[0], _mm256_mask_i64gather_epi64, src_.m256i[0], HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m256i[0], simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k)), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256i[1], _mm256_mask_i64gather_epi64, src_.m256i[1], HEDLEY_STATIC_CAST(long long const*, base_addr), vindex_.m256i[1], simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4)), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_epi64
+  #define _mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_i64gather_ps (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m128[0], _mm256_i64gather_ps, HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m128[1], _mm256_i64gather_ps, HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+  #endif
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_ps(vindex, base_addr, scale) _mm512_i64gather_ps(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_ps
+  #define _mm512_i64gather_ps(vindex, base_addr, scale) simde_mm512_i64gather_ps(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_mask_i64gather_ps (simde__m256 src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private
+    src_ = simde__m256_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m128[0], _mm256_mask_i64gather_ps, src_.m128[0], HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[0], _mm_castsi128_ps(simde_mm_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k))), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m128[1], _mm256_mask_i64gather_ps, src_.m128[1], HEDLEY_STATIC_CAST(float const*, base_addr), vindex_.m256i[1], _mm_castsi128_ps(simde_mm_movm_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4))), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+  #endif
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_ps
+  #define _mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_i64gather_pd (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_GATHER_SCALE_(r_.m256d[0], _mm256_i64gather_pd, HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m256i[0], scale)
+    SIMDE_X_GATHER_SCALE_(r_.m256d[1], _mm256_i64gather_pd, HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m256i[1], scale)
+  #else
+    simde_x_gather_(&r_, &r_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_pd(vindex, base_addr, scale) _mm512_i64gather_pd(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_pd
+  #define _mm512_i64gather_pd(vindex, base_addr, scale) simde_mm512_i64gather_pd(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_i64gather_pd (simde__m512d src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private
+    src_ = simde__m512d_to_private(src),
+    r_;
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256d[0], _mm256_mask_i64gather_pd, src_.m256d[0], HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m256i[0], _mm256_castsi256_pd(simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k))), scale)
+    SIMDE_X_MASK_GATHER_SCALE_(r_.m256d[1], _mm256_mask_i64gather_pd, src_.m256d[1], HEDLEY_STATIC_CAST(double const*, base_addr), vindex_.m256i[1], _mm256_castsi256_pd(simde_mm256_movm_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4))), scale)
+  #else
+    simde_x_gather_(&r_, &src_, base_addr, &vindex_, sizeof(vindex_.i64[0]), sizeof(r_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_pd
+  #define _mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GATHER_H) */
@@ -31,6 +31,7 @@
 #include "types.h"
 #include "cast.h"
 #include "set.h"
+#include "movm.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -41,6 +42,8 @@ simde__m128i
 simde_mm_mask_mov_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_mask_mov_epi8(src, k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_x_mm_select_si128(src, a, simde_mm_movm_epi8(k));
   #else
     simde__m128i_private
       src_ = simde__m128i_to_private(src),
@@ -65,6 +68,8 @@ simde__m128i
 simde_mm_mask_mov_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_mask_mov_epi16(src, k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_x_mm_select_si128(src, a, simde_mm_movm_epi16(k));
   #else
     simde__m128i_private
       src_ = simde__m128i_to_private(src),
@@ -89,6 +94,8 @@ simde__m128i
 simde_mm_mask_mov_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_mask_mov_epi32(src, k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_x_mm_select_si128(src, a, simde_mm_movm_epi32(k));
   #else
     simde__m128i_private
       src_ = simde__m128i_to_private(src),
@@ -113,13 +120,14 @@ simde__m128i
 simde_mm_mask_mov_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_mask_mov_epi64(src, k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_x_mm_select_si128(src, a, simde_mm_movm_epi64(k));
   #else
     simde__m128i_private
       src_ = simde__m128i_to_private(src),
       a_ = simde__m128i_to_private(a),
       r_;
 
-    /* N.B. CM: No fallbacks as there are only two elements */
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
       r_.i64[i] = ((k >> i) & 1) ? a_.i64[i] : src_.i64[i];
@@ -166,13 +174,15 @@ simde__m256i
 simde_mm256_mask_mov_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_mask_mov_epi8(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi8(k));
   #else
     simde__m256i_private
       r_,
       src_ = simde__m256i_to_private(src),
       a_ = simde__m256i_to_private(a);
 
-    #if defined(SIMDE_X86_SSSE3_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_mask_mov_epi8(src_.m128i[0], HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m128i[0]);
       r_.m128i[1] = simde_mm_mask_mov_epi8(src_.m128i[1], HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), a_.m128i[1]);
     #else
@@ -195,13 +205,15 @@ simde__m256i
 simde_mm256_mask_mov_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_mask_mov_epi16(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi16(k));
   #else
     simde__m256i_private
       src_ = simde__m256i_to_private(src),
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_mask_mov_epi16(src_.m128i[0], HEDLEY_STATIC_CAST(simde__mmask8, k     ), a_.m128i[0]);
       r_.m128i[1] = simde_mm_mask_mov_epi16(src_.m128i[1], HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m128i[1]);
     #else
@@ -224,13 +236,15 @@ simde__m256i
 simde_mm256_mask_mov_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_mask_mov_epi32(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi32(k));
   #else
     simde__m256i_private
       src_ = simde__m256i_to_private(src),
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_mask_mov_epi32(src_.m128i[0], k     , a_.m128i[0]);
       r_.m128i[1] = simde_mm_mask_mov_epi32(src_.m128i[1], k >> 4, a_.m128i[1]);
     #else
@@ -253,14 +267,15 @@ simde__m256i
 simde_mm256_mask_mov_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_mask_mov_epi64(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_blendv_epi8(src, a, simde_mm256_movm_epi64(k));
   #else
     simde__m256i_private
       src_ = simde__m256i_to_private(src),
       a_ = simde__m256i_to_private(a),
       r_;
 
-    /* N.B. CM: This fallback may not be faster as there are only four elements */
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_mask_mov_epi64(src_.m128i[0], k     , a_.m128i[0]);
       r_.m128i[1] = simde_mm_mask_mov_epi64(src_.m128i[1], k >> 2, a_.m128i[1]);
     #else
@@ -317,7 +332,7 @@ simde_mm512_mask_mov_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSSE3_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_mask_mov_epi8(src_.m256i[0], HEDLEY_STATIC_CAST(simde__mmask32, k      ), a_.m256i[0]);
       r_.m256i[1] = simde_mm256_mask_mov_epi8(src_.m256i[1], HEDLEY_STATIC_CAST(simde__mmask32, k >> 32), a_.m256i[1]);
     #else
@@ -346,7 +361,7 @@ simde_mm512_mask_mov_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a)
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_mask_mov_epi16(src_.m256i[0], HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m256i[0]);
       r_.m256i[1] = simde_mm256_mask_mov_epi16(src_.m256i[1], HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), a_.m256i[1]);
     #else
@@ -375,7 +390,7 @@ simde_mm512_mask_mov_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a)
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_mask_mov_epi32(src_.m256i[0], HEDLEY_STATIC_CAST(simde__mmask8, k     ), a_.m256i[0]);
       r_.m256i[1] = simde_mm256_mask_mov_epi32(src_.m256i[1], HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m256i[1]);
     #else
@@ -404,8 +419,7 @@ simde_mm512_mask_mov_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    /* N.B. CM: Without AVX2 this fallback may not be faster as there are only eight elements */
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_mask_mov_epi64(src_.m256i[0], k     , a_.m256i[0]);
       r_.m256i[1] = simde_mm256_mask_mov_epi64(src_.m256i[1], k >> 4, a_.m256i[1]);
     #else
@@ -456,6 +470,8 @@ simde__m128i
 simde_mm_maskz_mov_epi8 (simde__mmask16 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_maskz_mov_epi8(k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_mm_and_si128(simde_mm_movm_epi8(k), a);
   #else
     simde__m128i_private
       a_ = simde__m128i_to_private(a),
@@ -479,6 +495,8 @@ simde__m128i
 simde_mm_maskz_mov_epi16 (simde__mmask8 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_maskz_mov_epi16(k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_mm_and_si128(simde_mm_movm_epi16(k), a);
   #else
     simde__m128i_private
       a_ = simde__m128i_to_private(a),
@@ -502,6 +520,8 @@ simde__m128i
 simde_mm_maskz_mov_epi32 (simde__mmask8 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_maskz_mov_epi32(k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_mm_and_si128(simde_mm_movm_epi32(k), a);
   #else
     simde__m128i_private
       a_ = simde__m128i_to_private(a),
@@ -525,12 +545,13 @@ simde__m128i
 simde_mm_maskz_mov_epi64 (simde__mmask8 k, simde__m128i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm_maskz_mov_epi64(k, a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    return simde_mm_and_si128(simde_mm_movm_epi64(k), a);
   #else
     simde__m128i_private
       a_ = simde__m128i_to_private(a),
       r_;
 
-    /* N.B. CM: No fallbacks as there are only two elements */
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
       r_.i64[i] = ((k >> i) & 1) ? a_.i64[i] : INT64_C(0);
@@ -577,12 +598,14 @@ simde__m256i
 simde_mm256_maskz_mov_epi8 (simde__mmask32 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_maskz_mov_epi8(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_and_si256(simde_mm256_movm_epi8(k), a);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSSE3_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_maskz_mov_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m128i[0]);
       r_.m128i[1] = simde_mm_maskz_mov_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), a_.m128i[1]);
     #else
@@ -605,12 +628,14 @@ simde__m256i
 simde_mm256_maskz_mov_epi16 (simde__mmask16 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_maskz_mov_epi16(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_and_si256(simde_mm256_movm_epi16(k), a);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_maskz_mov_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k     ), a_.m128i[0]);
       r_.m128i[1] = simde_mm_maskz_mov_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m128i[1]);
     #else
@@ -633,12 +658,14 @@ simde__m256i
 simde_mm256_maskz_mov_epi32 (simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_maskz_mov_epi32(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_and_si256(simde_mm256_movm_epi32(k), a);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_maskz_mov_epi32(k     , a_.m128i[0]);
       r_.m128i[1] = simde_mm_maskz_mov_epi32(k >> 4, a_.m128i[1]);
     #else
@@ -661,13 +688,14 @@ simde__m256i
 simde_mm256_maskz_mov_epi64 (simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_maskz_mov_epi64(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    return simde_mm256_and_si256(simde_mm256_movm_epi64(k), a);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
       r_;
 
-    /* N.B. CM: This fallback may not be faster as there are only four elements */
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m128i[0] = simde_mm_maskz_mov_epi64(k     , a_.m128i[0]);
       r_.m128i[1] = simde_mm_maskz_mov_epi64(k >> 2, a_.m128i[1]);
     #else
@@ -723,7 +751,7 @@ simde_mm512_maskz_mov_epi8 (simde__mmask64 k, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSSE3_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_maskz_mov_epi8(HEDLEY_STATIC_CAST(simde__mmask32, k      ), a_.m256i[0]);
       r_.m256i[1] = simde_mm256_maskz_mov_epi8(HEDLEY_STATIC_CAST(simde__mmask32, k >> 32), a_.m256i[1]);
     #else
@@ -750,7 +778,7 @@ simde_mm512_maskz_mov_epi16 (simde__mmask32 k, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_maskz_mov_epi16(HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m256i[0]);
       r_.m256i[1] = simde_mm256_maskz_mov_epi16(HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), a_.m256i[1]);
     #else
@@ -778,7 +806,7 @@ simde_mm512_maskz_mov_epi32 (simde__mmask16 k, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_maskz_mov_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k     ), a_.m256i[0]);
       r_.m256i[1] = simde_mm256_maskz_mov_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m256i[1]);
     #else
@@ -806,8 +834,7 @@ simde_mm512_maskz_mov_epi64 (simde__mmask8 k, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    /* N.B. CM: Without AVX2 this fallback may not be faster as there are only eight elements */
-    #if defined(SIMDE_X86_SSE2_NATIVE)
+    #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
       r_.m256i[0] = simde_mm256_maskz_mov_epi64(k     , a_.m256i[0]);
       r_.m256i[1] = simde_mm256_maskz_mov_epi64(k >> 4, a_.m256i[1]);
     #else
@@ -52,6 +52,21 @@ simde_mm_movm_epi8 (simde__mmask16 k) {
     r = simde_mm_shuffle_epi8(r, shuffle);
     r = simde_mm_cmpgt_epi8(zero, r);
 
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* Broadcast the low byte of k to lanes 0-7 and the high byte to
+     * lanes 8-15, then test one bit per lane. */
+    const __m128i bits = _mm_set_epi8(
+      HEDLEY_STATIC_CAST(char, 0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+      HEDLEY_STATIC_CAST(char, 0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+    __m128i r;
+
+    r = _mm_cvtsi32_si128(HEDLEY_STATIC_CAST(int, k));
+    r = _mm_unpacklo_epi8(r, r);
+    r = _mm_unpacklo_epi16(r, r);
+    r = _mm_unpacklo_epi32(r, r);
+    r = _mm_cmpeq_epi8(_mm_and_si128(r, bits), bits);
+
     return r;
   #else
     simde__m128i_private r_;
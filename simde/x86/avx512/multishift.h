@@ -0,0 +1,288 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_X86_AVX512_MULTISHIFT_H)
+#define SIMDE_X86_AVX512_MULTISHIFT_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* vpmultishiftqb: byte i of the result is the 8 bits of the qword of b
+ * containing it, starting at (rotating) bit a[i] & 63.  Without VBMI the
+ * control is split into a byte offset q = c >> 3 and a bit offset s =
+ * c & 7; pshufb fetches bytes q and q + 1 of the qword as one 16-bit
+ * word, and a multiply by 2^(7 - s) lines the wanted bits up on a byte
+ * boundary.  Even and odd result bytes are handled separately since
+ * they need different words. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_multishift_epi64_epi8 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_multishift_epi64_epi8(a, b);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i
+      seven = _mm_set1_epi8(7),
+      lo = _mm_set1_epi16(0x00ff),
+      hi = _mm_set1_epi16(~0x00ff),
+      offs = _mm_set_epi64x(0x0808080808080808, 0),
+      q = _mm_and_si128(_mm_srli_epi16(a, 3), seven),
+      s = _mm_and_si128(a, seven),
+      qe = _mm_and_si128(q, lo),
+      qo = _mm_srli_epi16(q, 8),
+      ie = _mm_or_si128(_mm_and_si128(_mm_add_epi16(_mm_or_si128(qe, _mm_slli_epi16(qe, 8)), _mm_set1_epi16(0x0100)), seven), offs),
+      io = _mm_or_si128(_mm_and_si128(_mm_add_epi16(_mm_or_si128(qo, _mm_slli_epi16(qo, 8)), _mm_set1_epi16(0x0100)), seven), offs),
+      pow2 = _mm_setr_epi8(INT8_MIN, 64, 32, 16, 8, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0),
+      me = _mm_shuffle_epi8(pow2, _mm_or_si128(s, hi)),
+      mo = _mm_shuffle_epi8(pow2, _mm_or_si128(_mm_srli_epi16(s, 8), hi)),
+      re = _mm_mullo_epi16(_mm_shuffle_epi8(b, ie), me),
+      ro = _mm_mullo_epi16(_mm_shuffle_epi8(b, io), mo);
+    return _mm_or_si128(_mm_and_si128(_mm_srli_epi16(re, 7), lo), _mm_andnot_si128(lo, _mm_slli_epi16(ro, 1)));
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      /* Each half of the control only indexes its own half of b, so
+       * vtbl1 on the 64-bit halves doesn't need any offsets. */
+      const uint8x16_t
+        q = vandq_u8(vshrq_n_u8(a_.neon_u8, 3), vdupq_n_u8(7)),
+        n = vandq_u8(vaddq_u8(q, vdupq_n_u8(1)), vdupq_n_u8(7)),
+        lo = vcombine_u8(vtbl1_u8(vget_low_u8(b_.neon_u8), vget_low_u8(q)), vtbl1_u8(vget_high_u8(b_.neon_u8), vget_high_u8(q))),
+        hi = vcombine_u8(vtbl1_u8(vget_low_u8(b_.neon_u8), vget_low_u8(n)), vtbl1_u8(vget_high_u8(b_.neon_u8), vget_high_u8(n)));
+      const int8x16_t s = vreinterpretq_s8_u8(vandq_u8(a_.neon_u8, vdupq_n_u8(7)));
+      r_.neon_u8 = vorrq_u8(vshlq_u8(lo, vnegq_s8(s)), vshlq_u8(hi, vsubq_s8(vdupq_n_s8(8), s)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        const uint64_t v = b_.u64[i / 8];
+        const unsigned int c = a_.u8[i] & 63;
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (v >> c) | (v << ((64 - c) & 63)));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_multishift_epi64_epi8
+  #define _mm_multishift_epi64_epi8(a, b) simde_mm_multishift_epi64_epi8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_multishift_epi64_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_multishift_epi64_epi8(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi8(src, k, simde_mm_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_multishift_epi64_epi8
+  #define _mm_mask_multishift_epi64_epi8(src, k, a, b) simde_mm_mask_multishift_epi64_epi8(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_multishift_epi64_epi8 (simde__mmask16 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_multishift_epi64_epi8(k, a, b);
+  #else
+    return simde_mm_maskz_mov_epi8(k, simde_mm_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_multishift_epi64_epi8
+  #define _mm_maskz_multishift_epi64_epi8(k, a, b) simde_mm_maskz_multishift_epi64_epi8(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_multishift_epi64_epi8 (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_multishift_epi64_epi8(a, b);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i
+      seven = _mm256_set1_epi8(7),
+      lo = _mm256_set1_epi16(0x00ff),
+      hi = _mm256_set1_epi16(~0x00ff),
+      offs = _mm256_set_epi64x(0x0808080808080808, 0, 0x0808080808080808, 0),
+      q = _mm256_and_si256(_mm256_srli_epi16(a, 3), seven),
+      s = _mm256_and_si256(a, seven),
+      qe = _mm256_and_si256(q, lo),
+      qo = _mm256_srli_epi16(q, 8),
+      ie = _mm256_or_si256(_mm256_and_si256(_mm256_add_epi16(_mm256_or_si256(qe, _mm256_slli_epi16(qe, 8)), _mm256_set1_epi16(0x0100)), seven), offs),
+      io = _mm256_or_si256(_mm256_and_si256(_mm256_add_epi16(_mm256_or_si256(qo, _mm256_slli_epi16(qo, 8)), _mm256_set1_epi16(0x0100)), seven), offs),
+      pow2 = _mm256_setr_epi8(
+        INT8_MIN, 64, 32, 16, 8, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        INT8_MIN, 64, 32, 16, 8, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0),
+      me = _mm256_shuffle_epi8(pow2, _mm256_or_si256(s, hi)),
+      mo = _mm256_shuffle_epi8(pow2, _mm256_or_si256(_mm256_srli_epi16(s, 8), hi)),
+      re = _mm256_mullo_epi16(_mm256_shuffle_epi8(b, ie), me),
+      ro = _mm256_mullo_epi16(_mm256_shuffle_epi8(b, io), mo);
+    return _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(re, 7), lo), _mm256_andnot_si256(lo, _mm256_slli_epi16(ro, 1)));
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_multishift_epi64_epi8(a_.m128i[i], b_.m128i[i]);
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        const uint64_t v = b_.u64[i / 8];
+        const unsigned int c = a_.u8[i] & 63;
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (v >> c) | (v << ((64 - c) & 63)));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_multishift_epi64_epi8
+  #define _mm256_multishift_epi64_epi8(a, b) simde_mm256_multishift_epi64_epi8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_multishift_epi64_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_multishift_epi64_epi8(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi8(src, k, simde_mm256_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_multishift_epi64_epi8
+  #define _mm256_mask_multishift_epi64_epi8(src, k, a, b) simde_mm256_mask_multishift_epi64_epi8(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_multishift_epi64_epi8 (simde__mmask32 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_multishift_epi64_epi8(k, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi8(k, simde_mm256_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_multishift_epi64_epi8
+  #define _mm256_maskz_multishift_epi64_epi8(k, a, b) simde_mm256_maskz_multishift_epi64_epi8(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_multishift_epi64_epi8 (simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
+    return _mm512_multishift_epi64_epi8(a, b);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE)
+    const __m512i
+      seven = _mm512_set1_epi8(7),
+      lo = _mm512_set1_epi16(0x00ff),
+      hi = _mm512_set1_epi16(~0x00ff),
+      offs = _mm512_set_epi64(0x0808080808080808, 0, 0x0808080808080808, 0, 0x0808080808080808, 0, 0x0808080808080808, 0),
+      q = _mm512_and_si512(_mm512_srli_epi16(a, 3), seven),
+      s = _mm512_and_si512(a, seven),
+      qe = _mm512_and_si512(q, lo),
+      qo = _mm512_srli_epi16(q, 8),
+      ie = _mm512_or_si512(_mm512_and_si512(_mm512_add_epi16(_mm512_or_si512(qe, _mm512_slli_epi16(qe, 8)), _mm512_set1_epi16(0x0100)), seven), offs),
+      io = _mm512_or_si512(_mm512_and_si512(_mm512_add_epi16(_mm512_or_si512(qo, _mm512_slli_epi16(qo, 8)), _mm512_set1_epi16(0x0100)), seven), offs),
+      pow2 = _mm512_broadcast_i32x4(_mm_setr_epi8(INT8_MIN, 64, 32, 16, 8, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0)),
+      me = _mm512_shuffle_epi8(pow2, _mm512_or_si512(s, hi)),
+      mo = _mm512_shuffle_epi8(pow2, _mm512_or_si512(_mm512_srli_epi16(s, 8), hi)),
+      re = _mm512_mullo_epi16(_mm512_shuffle_epi8(b, ie), me),
+      ro = _mm512_mullo_epi16(_mm512_shuffle_epi8(b, io), mo);
+    return _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(re, 7), lo), _mm512_andnot_si512(lo, _mm512_slli_epi16(ro, 1)));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_multishift_epi64_epi8(a_.m256i[i], b_.m256i[i]);
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.u8) / sizeof(r_.u8[0])) ; i++) {
+        const uint64_t v = b_.u64[i / 8];
+        const unsigned int c = a_.u8[i] & 63;
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (v >> c) | (v << ((64 - c) & 63)));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_multishift_epi64_epi8
+  #define _mm512_multishift_epi64_epi8(a, b) simde_mm512_multishift_epi64_epi8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_multishift_epi64_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
+    return _mm512_mask_multishift_epi64_epi8(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi8(src, k, simde_mm512_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_multishift_epi64_epi8
+  #define _mm512_mask_multishift_epi64_epi8(src, k, a, b) simde_mm512_mask_multishift_epi64_epi8(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_multishift_epi64_epi8 (simde__mmask64 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
+    return _mm512_maskz_multishift_epi64_epi8(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi8(k, simde_mm512_multishift_epi64_epi8(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_multishift_epi64_epi8
+  #define _mm512_maskz_multishift_epi64_epi8(k, a, b) simde_mm512_maskz_multishift_epi64_epi8(k, a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_MULTISHIFT_H) */
@@ -0,0 +1,926 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_X86_AVX512_REDUCE_H)
+#define SIMDE_X86_AVX512_REDUCE_H
+
+#include "types.h"
+#include "mov.h"
+#include "set1.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The emulated reductions fold the upper half of the vector onto the
+ * lower half (512 -> 256 -> 128 -> 64 -> 32 bits), the same tree the
+ * native sequences use.  That keeps the floating-point versions
+ * bit-for-bit compatible: the sum is not computed left-to-right, so
+ * rounding (and, for min/max, which operand a NaN or signed zero comes
+ * from) matches what AVX-512 hardware returns.
+ *
+ * There are no 128/256-bit versions of mullo/min/max for 64-bit lanes
+ * to fold with, so those reduce the private lanes using the same tree
+ * in scalar code. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_add_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_add_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_add_epi32(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_add_epi32(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_s32(simde__m128i_to_neon_i32(r));
+    #else
+      r = simde_mm_add_epi32(r, simde_mm_unpackhi_epi64(r, r));
+      r = simde_mm_add_epi32(r, simde_mm_shuffle_epi32(r, 1));
+      return simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_epi32
+  #define _mm512_reduce_add_epi32(a) simde_mm512_reduce_add_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_add_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_epi32(k, a);
+  #else
+    return simde_mm512_reduce_add_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_epi32
+  #define _mm512_mask_reduce_add_epi32(k, a) simde_mm512_mask_reduce_add_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_add_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_add_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_add_epi64(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_add_epi64(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_s64(simde__m128i_to_neon_i64(r));
+    #else
+      r = simde_mm_add_epi64(r, simde_mm_unpackhi_epi64(r, r));
+      return simde_mm_cvtsi128_si64(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_epi64
+  #define _mm512_reduce_add_epi64(a) simde_mm512_reduce_add_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_add_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_epi64(k, a);
+  #else
+    return simde_mm512_reduce_add_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_epi64
+  #define _mm512_mask_reduce_add_epi64(k, a) simde_mm512_mask_reduce_add_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_add_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_add_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256 r256 = simde_mm256_add_ps(a_.m256[1], a_.m256[0]);
+    simde__m128 r = simde_mm_add_ps(simde_mm256_extractf128_ps(r256, 1), simde_mm256_castps256_ps128(r256));
+    r = simde_mm_add_ps(r, simde_mm_movehl_ps(r, r));
+    r = simde_mm_add_ps(r, simde_mm_shuffle_ps(r, r, 1));
+    return simde_mm_cvtss_f32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_ps
+  #define _mm512_reduce_add_ps(a) simde_mm512_reduce_add_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_add_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_ps(k, a);
+  #else
+    return simde_mm512_reduce_add_ps(simde_mm512_maskz_mov_ps(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_ps
+  #define _mm512_mask_reduce_add_ps(k, a) simde_mm512_mask_reduce_add_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_add_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_add_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d r256 = simde_mm256_add_pd(a_.m256d[1], a_.m256d[0]);
+    simde__m128d r = simde_mm_add_pd(simde_mm256_extractf128_pd(r256, 1), simde_mm256_castpd256_pd128(r256));
+    r = simde_mm_add_pd(r, simde_mm_unpackhi_pd(r, r));
+    return simde_mm_cvtsd_f64(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_pd
+  #define _mm512_reduce_add_pd(a) simde_mm512_reduce_add_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_add_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_add_pd(k, a);
+  #else
+    return simde_mm512_reduce_add_pd(simde_mm512_maskz_mov_pd(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_pd
+  #define _mm512_mask_reduce_add_pd(k, a) simde_mm512_mask_reduce_add_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_and_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_and_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_and_si256(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_and_si128(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    r = simde_mm_and_si128(r, simde_mm_unpackhi_epi64(r, r));
+    r = simde_mm_and_si128(r, simde_mm_shuffle_epi32(r, 1));
+    return simde_mm_cvtsi128_si32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_and_epi32
+  #define _mm512_reduce_and_epi32(a) simde_mm512_reduce_and_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_and_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_and_epi32(k, a);
+  #else
+    return simde_mm512_reduce_and_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_and_epi32
+  #define _mm512_mask_reduce_and_epi32(k, a) simde_mm512_mask_reduce_and_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_and_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_and_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_and_si256(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_and_si128(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    r = simde_mm_and_si128(r, simde_mm_unpackhi_epi64(r, r));
+    return simde_mm_cvtsi128_si64(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_and_epi64
+  #define _mm512_reduce_and_epi64(a) simde_mm512_reduce_and_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_and_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_and_epi64(k, a);
+  #else
+    return simde_mm512_reduce_and_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_and_epi64
+  #define _mm512_mask_reduce_and_epi64(k, a) simde_mm512_mask_reduce_and_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_max_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_max_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_max_epi32(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_max_epi32(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_s32(simde__m128i_to_neon_i32(r));
+    #else
+      r = simde_mm_max_epi32(r, simde_mm_unpackhi_epi64(r, r));
+      r = simde_mm_max_epi32(r, simde_mm_shuffle_epi32(r, 1));
+      return simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epi32
+  #define _mm512_reduce_max_epi32(a) simde_mm512_reduce_max_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_max_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epi32(k, a);
+  #else
+    return simde_mm512_reduce_max_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epi32
+  #define _mm512_mask_reduce_max_epi32(k, a) simde_mm512_mask_reduce_max_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_max_epu32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_max_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_max_epu32(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_max_epu32(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_u32(simde__m128i_to_neon_u32(r));
+    #else
+      r = simde_mm_max_epu32(r, simde_mm_unpackhi_epi64(r, r));
+      r = simde_mm_max_epu32(r, simde_mm_shuffle_epi32(r, 1));
+      return (uint32_t) simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epu32
+  #define _mm512_reduce_max_epu32(a) simde_mm512_reduce_max_epu32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_max_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epu32(k, a);
+  #else
+    return simde_mm512_reduce_max_epu32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epu32
+  #define _mm512_mask_reduce_max_epu32(k, a) simde_mm512_mask_reduce_max_epu32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_max_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_max_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    int64_t
+      r0 = (a_.i64[4] > a_.i64[0]) ? a_.i64[4] : a_.i64[0],
+      r1 = (a_.i64[5] > a_.i64[1]) ? a_.i64[5] : a_.i64[1],
+      r2 = (a_.i64[6] > a_.i64[2]) ? a_.i64[6] : a_.i64[2],
+      r3 = (a_.i64[7] > a_.i64[3]) ? a_.i64[7] : a_.i64[3];
+
+    r0 = (r2 > r0) ? r2 : r0;
+    r1 = (r3 > r1) ? r3 : r1;
+    return (r1 > r0) ? r1 : r0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epi64
+  #define _mm512_reduce_max_epi64(a) simde_mm512_reduce_max_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_max_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epi64(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      a_.i64[i] = ((k >> i) & 1) ? a_.i64[i] : INT64_MIN;
+    }
+
+    return simde_mm512_reduce_max_epi64(simde__m512i_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epi64
+  #define _mm512_mask_reduce_max_epi64(k, a) simde_mm512_mask_reduce_max_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_max_epu64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_max_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    uint64_t
+      r0 = (a_.u64[4] > a_.u64[0]) ? a_.u64[4] : a_.u64[0],
+      r1 = (a_.u64[5] > a_.u64[1]) ? a_.u64[5] : a_.u64[1],
+      r2 = (a_.u64[6] > a_.u64[2]) ? a_.u64[6] : a_.u64[2],
+      r3 = (a_.u64[7] > a_.u64[3]) ? a_.u64[7] : a_.u64[3];
+
+    r0 = (r2 > r0) ? r2 : r0;
+    r1 = (r3 > r1) ? r3 : r1;
+    return (r1 > r0) ? r1 : r0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epu64
+  #define _mm512_reduce_max_epu64(a) simde_mm512_reduce_max_epu64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_max_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_epu64(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      a_.u64[i] = ((k >> i) & 1) ? a_.u64[i] : UINT64_C(0);
+    }
+
+    return simde_mm512_reduce_max_epu64(simde__m512i_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epu64
+  #define _mm512_mask_reduce_max_epu64(k, a) simde_mm512_mask_reduce_max_epu64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_max_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_max_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256 r256 = simde_mm256_max_ps(a_.m256[1], a_.m256[0]);
+    simde__m128 r = simde_mm_max_ps(simde_mm256_extractf128_ps(r256, 1), simde_mm256_castps256_ps128(r256));
+    r = simde_mm_max_ps(r, simde_mm_movehl_ps(r, r));
+    r = simde_mm_max_ps(r, simde_mm_shuffle_ps(r, r, 1));
+    return simde_mm_cvtss_f32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_ps
+  #define _mm512_reduce_max_ps(a) simde_mm512_reduce_max_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_max_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_ps(k, a);
+  #else
+    return simde_mm512_reduce_max_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(-SIMDE_MATH_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_ps
+  #define _mm512_mask_reduce_max_ps(k, a) simde_mm512_mask_reduce_max_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_max_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_max_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d r256 = simde_mm256_max_pd(a_.m256d[1], a_.m256d[0]);
+    simde__m128d r = simde_mm_max_pd(simde_mm256_extractf128_pd(r256, 1), simde_mm256_castpd256_pd128(r256));
+    r = simde_mm_max_pd(r, simde_mm_unpackhi_pd(r, r));
+    return simde_mm_cvtsd_f64(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_pd
+  #define _mm512_reduce_max_pd(a) simde_mm512_reduce_max_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_max_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_max_pd(k, a);
+  #else
+    return simde_mm512_reduce_max_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(-SIMDE_MATH_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_pd
+  #define _mm512_mask_reduce_max_pd(k, a) simde_mm512_mask_reduce_max_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_min_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_min_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_min_epi32(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_min_epi32(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_s32(simde__m128i_to_neon_i32(r));
+    #else
+      r = simde_mm_min_epi32(r, simde_mm_unpackhi_epi64(r, r));
+      r = simde_mm_min_epi32(r, simde_mm_shuffle_epi32(r, 1));
+      return simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epi32
+  #define _mm512_reduce_min_epi32(a) simde_mm512_reduce_min_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_min_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epi32(k, a);
+  #else
+    return simde_mm512_reduce_min_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epi32
+  #define _mm512_mask_reduce_min_epi32(k, a) simde_mm512_mask_reduce_min_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_min_epu32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_min_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_min_epu32(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_min_epu32(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_u32(simde__m128i_to_neon_u32(r));
+    #else
+      r = simde_mm_min_epu32(r, simde_mm_unpackhi_epi64(r, r));
+      r = simde_mm_min_epu32(r, simde_mm_shuffle_epi32(r, 1));
+      return (uint32_t) simde_mm_cvtsi128_si32(r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epu32
+  #define _mm512_reduce_min_epu32(a) simde_mm512_reduce_min_epu32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_min_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epu32(k, a);
+  #else
+    return simde_mm512_reduce_min_epu32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epu32
+  #define _mm512_mask_reduce_min_epu32(k, a) simde_mm512_mask_reduce_min_epu32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_min_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_min_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    int64_t
+      r0 = (a_.i64[4] < a_.i64[0]) ? a_.i64[4] : a_.i64[0],
+      r1 = (a_.i64[5] < a_.i64[1]) ? a_.i64[5] : a_.i64[1],
+      r2 = (a_.i64[6] < a_.i64[2]) ? a_.i64[6] : a_.i64[2],
+      r3 = (a_.i64[7] < a_.i64[3]) ? a_.i64[7] : a_.i64[3];
+
+    r0 = (r2 < r0) ? r2 : r0;
+    r1 = (r3 < r1) ? r3 : r1;
+    return (r1 < r0) ? r1 : r0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epi64
+  #define _mm512_reduce_min_epi64(a) simde_mm512_reduce_min_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_min_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epi64(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      a_.i64[i] = ((k >> i) & 1) ? a_.i64[i] : INT64_MAX;
+    }
+
+    return simde_mm512_reduce_min_epi64(simde__m512i_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epi64
+  #define _mm512_mask_reduce_min_epi64(k, a) simde_mm512_mask_reduce_min_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_min_epu64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_min_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    uint64_t
+      r0 = (a_.u64[4] < a_.u64[0]) ? a_.u64[4] : a_.u64[0],
+      r1 = (a_.u64[5] < a_.u64[1]) ? a_.u64[5] : a_.u64[1],
+      r2 = (a_.u64[6] < a_.u64[2]) ? a_.u64[6] : a_.u64[2],
+      r3 = (a_.u64[7] < a_.u64[3]) ? a_.u64[7] : a_.u64[3];
+
+    r0 = (r2 < r0) ? r2 : r0;
+    r1 = (r3 < r1) ? r3 : r1;
+    return (r1 < r0) ? r1 : r0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epu64
+  #define _mm512_reduce_min_epu64(a) simde_mm512_reduce_min_epu64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_min_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_epu64(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      a_.u64[i] = ((k >> i) & 1) ? a_.u64[i] : UINT64_MAX;
+    }
+
+    return simde_mm512_reduce_min_epu64(simde__m512i_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epu64
+  #define _mm512_mask_reduce_min_epu64(k, a) simde_mm512_mask_reduce_min_epu64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_min_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_min_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256 r256 = simde_mm256_min_ps(a_.m256[1], a_.m256[0]);
+    simde__m128 r = simde_mm_min_ps(simde_mm256_extractf128_ps(r256, 1), simde_mm256_castps256_ps128(r256));
+    r = simde_mm_min_ps(r, simde_mm_movehl_ps(r, r));
+    r = simde_mm_min_ps(r, simde_mm_shuffle_ps(r, r, 1));
+    return simde_mm_cvtss_f32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_ps
+  #define _mm512_reduce_min_ps(a) simde_mm512_reduce_min_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_min_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_ps(k, a);
+  #else
+    return simde_mm512_reduce_min_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_ps
+  #define _mm512_mask_reduce_min_ps(k, a) simde_mm512_mask_reduce_min_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_min_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_min_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d r256 = simde_mm256_min_pd(a_.m256d[1], a_.m256d[0]);
+    simde__m128d r = simde_mm_min_pd(simde_mm256_extractf128_pd(r256, 1), simde_mm256_castpd256_pd128(r256));
+    r = simde_mm_min_pd(r, simde_mm_unpackhi_pd(r, r));
+    return simde_mm_cvtsd_f64(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_pd
+  #define _mm512_reduce_min_pd(a) simde_mm512_reduce_min_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_min_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_min_pd(k, a);
+  #else
+    return simde_mm512_reduce_min_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_MATH_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_pd
+  #define _mm512_mask_reduce_min_pd(k, a) simde_mm512_mask_reduce_min_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_mul_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_mul_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_mullo_epi32(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_mullo_epi32(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    r = simde_mm_mullo_epi32(r, simde_mm_unpackhi_epi64(r, r));
+    r = simde_mm_mullo_epi32(r, simde_mm_shuffle_epi32(r, 1));
+    return simde_mm_cvtsi128_si32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_epi32
+  #define _mm512_reduce_mul_epi32(a) simde_mm512_reduce_mul_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_mul_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_epi32(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(1), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_epi32
+  #define _mm512_mask_reduce_mul_epi32(k, a) simde_mm512_mask_reduce_mul_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_mul_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_mul_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    const uint64_t
+      r0 = a_.u64[0] * a_.u64[4],
+      r1 = a_.u64[1] * a_.u64[5],
+      r2 = a_.u64[2] * a_.u64[6],
+      r3 = a_.u64[3] * a_.u64[7];
+
+    return HEDLEY_STATIC_CAST(int64_t, (r0 * r2) * (r1 * r3));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_epi64
+  #define _mm512_reduce_mul_epi64(a) simde_mm512_reduce_mul_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_mul_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_epi64(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      a_.u64[i] = ((k >> i) & 1) ? a_.u64[i] : UINT64_C(1);
+    }
+
+    return simde_mm512_reduce_mul_epi64(simde__m512i_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_epi64
+  #define _mm512_mask_reduce_mul_epi64(k, a) simde_mm512_mask_reduce_mul_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_mul_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_mul_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256 r256 = simde_mm256_mul_ps(a_.m256[1], a_.m256[0]);
+    simde__m128 r = simde_mm_mul_ps(simde_mm256_extractf128_ps(r256, 1), simde_mm256_castps256_ps128(r256));
+    r = simde_mm_mul_ps(r, simde_mm_movehl_ps(r, r));
+    r = simde_mm_mul_ps(r, simde_mm_shuffle_ps(r, r, 1));
+    return simde_mm_cvtss_f32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_ps
+  #define _mm512_reduce_mul_ps(a) simde_mm512_reduce_mul_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_mul_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_ps(k, a);
+  #else
+    return simde_mm512_reduce_mul_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_ps
+  #define _mm512_mask_reduce_mul_ps(k, a) simde_mm512_mask_reduce_mul_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_mul_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_mul_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m256d r256 = simde_mm256_mul_pd(a_.m256d[1], a_.m256d[0]);
+    simde__m128d r = simde_mm_mul_pd(simde_mm256_extractf128_pd(r256, 1), simde_mm256_castpd256_pd128(r256));
+    r = simde_mm_mul_pd(r, simde_mm_unpackhi_pd(r, r));
+    return simde_mm_cvtsd_f64(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_pd
+  #define _mm512_reduce_mul_pd(a) simde_mm512_reduce_mul_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_mul_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_mul_pd(k, a);
+  #else
+    return simde_mm512_reduce_mul_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_pd
+  #define _mm512_mask_reduce_mul_pd(k, a) simde_mm512_mask_reduce_mul_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_or_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_or_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_or_si256(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_or_si128(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    r = simde_mm_or_si128(r, simde_mm_unpackhi_epi64(r, r));
+    r = simde_mm_or_si128(r, simde_mm_shuffle_epi32(r, 1));
+    return simde_mm_cvtsi128_si32(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_or_epi32
+  #define _mm512_reduce_or_epi32(a) simde_mm512_reduce_or_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_or_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_or_epi32(k, a);
+  #else
+    return simde_mm512_reduce_or_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_or_epi32
+  #define _mm512_mask_reduce_or_epi32(k, a) simde_mm512_mask_reduce_or_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_or_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_reduce_or_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m256i r256 = simde_mm256_or_si256(a_.m256i[1], a_.m256i[0]);
+    simde__m128i r = simde_mm_or_si128(simde_mm256_extracti128_si256(r256, 1), simde_mm256_castsi256_si128(r256));
+
+    r = simde_mm_or_si128(r, simde_mm_unpackhi_epi64(r, r));
+    return simde_mm_cvtsi128_si64(r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_or_epi64
+  #define _mm512_reduce_or_epi64(a) simde_mm512_reduce_or_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_or_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_reduce_or_epi64(k, a);
+  #else
+    return simde_mm512_reduce_or_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_or_epi64
+  #define _mm512_mask_reduce_or_epi64(k, a) simde_mm512_mask_reduce_or_epi64(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_REDUCE_H) */
@@ -0,0 +1,957 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !defined(SIMDE_X86_AVX512_SCATTER_H)
+#define SIMDE_X86_AVX512_SCATTER_H
+
+#include "types.h"
+#include "gather.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+
+/* Scatter n e-byte lanes of a, skipping lanes not selected by k (when
+ * masked).  Stores happen strictly in lane order, since when two lanes
+ * hit the same address the higher one has to win.  As in
+ * simde_x_gather_, lanes are done four at a time: all four addresses
+ * and values are read before the first store, so the CPU isn't left
+ * holding the next reads behind stores it can't disambiguate yet. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_scatter_ (void* base_addr, const void* vindex, const void* a, size_t is, size_t e, size_t n, uint32_t k, int masked, const int32_t scale) {
+  uint8_t* addr = HEDLEY_STATIC_CAST(uint8_t*, base_addr);
+  const uint8_t* a_ = HEDLEY_STATIC_CAST(const uint8_t*, a);
+
+  for (size_t i = 0 ; (i + 4) <= n ; i += 4) {
+    uint8_t* p0 = addr + simde_x_vindex_offset_(vindex, i    , is, scale);
+    uint8_t* p1 = addr + simde_x_vindex_offset_(vindex, i + 1, is, scale);
+    uint8_t* p2 = addr + simde_x_vindex_offset_(vindex, i + 2, is, scale);
+    uint8_t* p3 = addr + simde_x_vindex_offset_(vindex, i + 3, is, scale);
+    uint64_t v0, v1, v2, v3;
+
+    simde_memcpy(&v0, &(a_[(i    ) * e]), e);
+    simde_memcpy(&v1, &(a_[(i + 1) * e]), e);
+    simde_memcpy(&v2, &(a_[(i + 2) * e]), e);
+    simde_memcpy(&v3, &(a_[(i + 3) * e]), e);
+
+    if (!masked || ((k >> (i    )) & 1)) simde_memcpy(p0, &v0, e);
+    if (!masked || ((k >> (i + 1)) & 1)) simde_memcpy(p1, &v1, e);
+    if (!masked || ((k >> (i + 2)) & 1)) simde_memcpy(p2, &v2, e);
+    if (!masked || ((k >> (i + 3)) & 1)) simde_memcpy(p3, &v3, e);
+  }
+
+  /* Only the 128-bit forms with 64-bit lanes have fewer than four. */
+  for (size_t i = 0 ; n < 4 && i < n ; i++) {
+    if (!masked || ((k >> i) & 1)) {
+      simde_memcpy(addr + simde_x_vindex_offset_(vindex, i, is, scale), &(a_[i * e]), e);
+    }
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_epi32 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_epi32(base_addr, vindex, a, scale) _mm_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_epi32
+  #define _mm_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_epi32
+  #define _mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_epi64 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i64[0]), sizeof(a_.i64) / sizeof(a_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_epi64(base_addr, vindex, a, scale) _mm_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_epi64
+  #define _mm_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i64[0]), sizeof(a_.i64) / sizeof(a_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_epi64
+  #define _mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_ps (void* base_addr, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_ps(base_addr, vindex, a, scale) _mm_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_ps
+  #define _mm_i32scatter_ps(base_addr, vindex, a, scale) simde_mm_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_ps (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_ps
+  #define _mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_pd (void* base_addr, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f64[0]), sizeof(a_.f64) / sizeof(a_.f64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_pd(base_addr, vindex, a, scale) _mm_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_pd
+  #define _mm_i32scatter_pd(base_addr, vindex, a, scale) simde_mm_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f64[0]), sizeof(a_.f64) / sizeof(a_.f64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_pd
+  #define _mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_epi32 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_epi32(base_addr, vindex, a, scale) _mm_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_epi32
+  #define _mm_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_epi32
+  #define _mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_epi64 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_epi64(base_addr, vindex, a, scale) _mm_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_epi64
+  #define _mm_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private
+    vindex_ = simde__m128i_to_private(vindex),
+    a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_epi64
+  #define _mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_ps (void* base_addr, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_ps(base_addr, vindex, a, scale) _mm_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_ps
+  #define _mm_i64scatter_ps(base_addr, vindex, a, scale) simde_mm_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_ps
+  #define _mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_pd (void* base_addr, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_pd(base_addr, vindex, a, scale) _mm_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_pd
+  #define _mm_i64scatter_pd(base_addr, vindex, a, scale) simde_mm_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_pd
+  #define _mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_epi32 (void* base_addr, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private
+    vindex_ = simde__m256i_to_private(vindex),
+    a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_epi32(base_addr, vindex, a, scale) _mm256_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_epi32
+  #define _mm256_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm256_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private
+    vindex_ = simde__m256i_to_private(vindex),
+    a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_epi32
+  #define _mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_epi64 (void* base_addr, simde__m128i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_epi64(base_addr, vindex, a, scale) _mm256_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_epi64
+  #define _mm256_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm256_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_epi64
+  #define _mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_ps (void* base_addr, simde__m256i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_ps(base_addr, vindex, a, scale) _mm256_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_ps
+  #define _mm256_i32scatter_ps(base_addr, vindex, a, scale) simde_mm256_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_ps (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_ps
+  #define _mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_pd (void* base_addr, simde__m128i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_pd(base_addr, vindex, a, scale) _mm256_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_pd
+  #define _mm256_i32scatter_pd(base_addr, vindex, a, scale) simde_mm256_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_pd
+  #define _mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_epi32 (void* base_addr, simde__m256i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_epi32(base_addr, vindex, a, scale) _mm256_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_epi32
+  #define _mm256_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm256_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_epi32
+  #define _mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_epi64 (void* base_addr, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private
+    vindex_ = simde__m256i_to_private(vindex),
+    a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_epi64(base_addr, vindex, a, scale) _mm256_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_epi64
+  #define _mm256_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm256_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private
+    vindex_ = simde__m256i_to_private(vindex),
+    a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_epi64
+  #define _mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_ps (void* base_addr, simde__m256i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_ps(base_addr, vindex, a, scale) _mm256_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_ps
+  #define _mm256_i64scatter_ps(base_addr, vindex, a, scale) simde_mm256_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_ps
+  #define _mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_pd (void* base_addr, simde__m256i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_pd(base_addr, vindex, a, scale) _mm256_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_pd
+  #define _mm256_i64scatter_pd(base_addr, vindex, a, scale) simde_mm256_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_pd
+  #define _mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_epi32 (void* base_addr, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    a_ = simde__m512i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale) _mm512_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_epi32
+  #define _mm512_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi32 (void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    a_ = simde__m512i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_epi32
+  #define _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_epi64 (void* base_addr, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale) _mm512_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_epi64
+  #define _mm512_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.i64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_epi64
+  #define _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_ps (void* base_addr, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private a_ = simde__m512_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_ps(base_addr, vindex, a, scale) _mm512_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_ps
+  #define _mm512_i32scatter_ps(base_addr, vindex, a, scale) simde_mm512_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_ps (void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private a_ = simde__m512_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f32[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_ps
+  #define _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_pd (void* base_addr, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_pd(base_addr, vindex, a, scale) _mm512_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_pd
+  #define _mm512_i32scatter_pd(base_addr, vindex, a, scale) simde_mm512_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i32[0]), sizeof(a_.f64[0]), sizeof(vindex_.i32) / sizeof(vindex_.i32[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_pd
+  #define _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_epi32 (void* base_addr, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale) _mm512_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_epi32
+  #define _mm512_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_epi32
+  #define _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_epi64 (void* base_addr, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    a_ = simde__m512i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale) _mm512_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_epi64
+  #define _mm512_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private
+    vindex_ = simde__m512i_to_private(vindex),
+    a_ = simde__m512i_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.i64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_epi64
+  #define _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_ps (void* base_addr, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_ps(base_addr, vindex, a, scale) _mm512_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_ps
+  #define _mm512_i64scatter_ps(base_addr, vindex, a, scale) simde_mm512_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f32[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_ps
+  #define _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_pd (void* base_addr, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), 0, 0, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_pd(base_addr, vindex, a, scale) _mm512_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_pd
+  #define _mm512_i64scatter_pd(base_addr, vindex, a, scale) simde_mm512_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+
+  simde_x_scatter_(base_addr, &vindex_, &a_, sizeof(vindex_.i64[0]), sizeof(a_.f64[0]), sizeof(vindex_.i64) / sizeof(vindex_.i64[0]), k, 1, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_pd
+  #define _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SCATTER_H) */
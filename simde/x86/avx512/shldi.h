@@ -0,0 +1,431 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_X86_AVX512_SHLDI_H)
+#define SIMDE_X86_AVX512_SHLDI_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Immediate version of shldv.h; with a constant count the fallback is
+ * just two shifts and an or per vector. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shldi_epi16 (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+  const int s = imm8 & 15;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u16 = (a_.u16 << s) | ((b_.u16 >> 1) >> (15 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << s) | (b_.u16[i] >> (16 - s)));
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_shldi_epi16(a, b, imm8) _mm_shldi_epi16(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shldi_epi16
+  #define _mm_shldi_epi16(a, b, imm8) simde_mm_shldi_epi16(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_shldi_epi16(src, k, a, b, imm8) _mm_mask_shldi_epi16(src, k, a, b, imm8)
+  #define simde_mm_maskz_shldi_epi16(k, a, b, imm8) _mm_maskz_shldi_epi16(k, a, b, imm8)
+#else
+  #define simde_mm_mask_shldi_epi16(src, k, a, b, imm8) simde_mm_mask_mov_epi16(src, k, simde_mm_shldi_epi16(a, b, imm8))
+  #define simde_mm_maskz_shldi_epi16(k, a, b, imm8) simde_mm_maskz_mov_epi16(k, simde_mm_shldi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shldi_epi16
+  #undef _mm_maskz_shldi_epi16
+  #define _mm_mask_shldi_epi16(src, k, a, b, imm8) simde_mm_mask_shldi_epi16(src, k, a, b, imm8)
+  #define _mm_maskz_shldi_epi16(k, a, b, imm8) simde_mm_maskz_shldi_epi16(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shldi_epi32 (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+  const int s = imm8 & 31;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u32 = (a_.u32 << s) | ((b_.u32 >> 1) >> (31 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (a_.u32[i] << s) | ((b_.u32[i] >> 1) >> (31 - s));
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_shldi_epi32(a, b, imm8) _mm_shldi_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shldi_epi32
+  #define _mm_shldi_epi32(a, b, imm8) simde_mm_shldi_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_shldi_epi32(src, k, a, b, imm8) _mm_mask_shldi_epi32(src, k, a, b, imm8)
+  #define simde_mm_maskz_shldi_epi32(k, a, b, imm8) _mm_maskz_shldi_epi32(k, a, b, imm8)
+#else
+  #define simde_mm_mask_shldi_epi32(src, k, a, b, imm8) simde_mm_mask_mov_epi32(src, k, simde_mm_shldi_epi32(a, b, imm8))
+  #define simde_mm_maskz_shldi_epi32(k, a, b, imm8) simde_mm_maskz_mov_epi32(k, simde_mm_shldi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shldi_epi32
+  #undef _mm_maskz_shldi_epi32
+  #define _mm_mask_shldi_epi32(src, k, a, b, imm8) simde_mm_mask_shldi_epi32(src, k, a, b, imm8)
+  #define _mm_maskz_shldi_epi32(k, a, b, imm8) simde_mm_maskz_shldi_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shldi_epi64 (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+  const int s = imm8 & 63;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u64 = (a_.u64 << s) | ((b_.u64 >> 1) >> (63 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (a_.u64[i] << s) | ((b_.u64[i] >> 1) >> (63 - s));
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_shldi_epi64(a, b, imm8) _mm_shldi_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shldi_epi64
+  #define _mm_shldi_epi64(a, b, imm8) simde_mm_shldi_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_shldi_epi64(src, k, a, b, imm8) _mm_mask_shldi_epi64(src, k, a, b, imm8)
+  #define simde_mm_maskz_shldi_epi64(k, a, b, imm8) _mm_maskz_shldi_epi64(k, a, b, imm8)
+#else
+  #define simde_mm_mask_shldi_epi64(src, k, a, b, imm8) simde_mm_mask_mov_epi64(src, k, simde_mm_shldi_epi64(a, b, imm8))
+  #define simde_mm_maskz_shldi_epi64(k, a, b, imm8) simde_mm_maskz_mov_epi64(k, simde_mm_shldi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shldi_epi64
+  #undef _mm_maskz_shldi_epi64
+  #define _mm_mask_shldi_epi64(src, k, a, b, imm8) simde_mm_mask_shldi_epi64(src, k, a, b, imm8)
+  #define _mm_maskz_shldi_epi64(k, a, b, imm8) simde_mm_maskz_shldi_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shldi_epi16 (simde__m256i a, simde__m256i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+  const int s = imm8 & 15;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u16 = (a_.u16 << s) | ((b_.u16 >> 1) >> (15 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << s) | (b_.u16[i] >> (16 - s)));
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_shldi_epi16(a, b, imm8) _mm256_shldi_epi16(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shldi_epi16
+  #define _mm256_shldi_epi16(a, b, imm8) simde_mm256_shldi_epi16(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_shldi_epi16(src, k, a, b, imm8) _mm256_mask_shldi_epi16(src, k, a, b, imm8)
+  #define simde_mm256_maskz_shldi_epi16(k, a, b, imm8) _mm256_maskz_shldi_epi16(k, a, b, imm8)
+#else
+  #define simde_mm256_mask_shldi_epi16(src, k, a, b, imm8) simde_mm256_mask_mov_epi16(src, k, simde_mm256_shldi_epi16(a, b, imm8))
+  #define simde_mm256_maskz_shldi_epi16(k, a, b, imm8) simde_mm256_maskz_mov_epi16(k, simde_mm256_shldi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shldi_epi16
+  #undef _mm256_maskz_shldi_epi16
+  #define _mm256_mask_shldi_epi16(src, k, a, b, imm8) simde_mm256_mask_shldi_epi16(src, k, a, b, imm8)
+  #define _mm256_maskz_shldi_epi16(k, a, b, imm8) simde_mm256_maskz_shldi_epi16(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shldi_epi32 (simde__m256i a, simde__m256i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+  const int s = imm8 & 31;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u32 = (a_.u32 << s) | ((b_.u32 >> 1) >> (31 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (a_.u32[i] << s) | ((b_.u32[i] >> 1) >> (31 - s));
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_shldi_epi32(a, b, imm8) _mm256_shldi_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shldi_epi32
+  #define _mm256_shldi_epi32(a, b, imm8) simde_mm256_shldi_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_shldi_epi32(src, k, a, b, imm8) _mm256_mask_shldi_epi32(src, k, a, b, imm8)
+  #define simde_mm256_maskz_shldi_epi32(k, a, b, imm8) _mm256_maskz_shldi_epi32(k, a, b, imm8)
+#else
+  #define simde_mm256_mask_shldi_epi32(src, k, a, b, imm8) simde_mm256_mask_mov_epi32(src, k, simde_mm256_shldi_epi32(a, b, imm8))
+  #define simde_mm256_maskz_shldi_epi32(k, a, b, imm8) simde_mm256_maskz_mov_epi32(k, simde_mm256_shldi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shldi_epi32
+  #undef _mm256_maskz_shldi_epi32
+  #define _mm256_mask_shldi_epi32(src, k, a, b, imm8) simde_mm256_mask_shldi_epi32(src, k, a, b, imm8)
+  #define _mm256_maskz_shldi_epi32(k, a, b, imm8) simde_mm256_maskz_shldi_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shldi_epi64 (simde__m256i a, simde__m256i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+  const int s = imm8 & 63;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u64 = (a_.u64 << s) | ((b_.u64 >> 1) >> (63 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (a_.u64[i] << s) | ((b_.u64[i] >> 1) >> (63 - s));
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_shldi_epi64(a, b, imm8) _mm256_shldi_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shldi_epi64
+  #define _mm256_shldi_epi64(a, b, imm8) simde_mm256_shldi_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_shldi_epi64(src, k, a, b, imm8) _mm256_mask_shldi_epi64(src, k, a, b, imm8)
+  #define simde_mm256_maskz_shldi_epi64(k, a, b, imm8) _mm256_maskz_shldi_epi64(k, a, b, imm8)
+#else
+  #define simde_mm256_mask_shldi_epi64(src, k, a, b, imm8) simde_mm256_mask_mov_epi64(src, k, simde_mm256_shldi_epi64(a, b, imm8))
+  #define simde_mm256_maskz_shldi_epi64(k, a, b, imm8) simde_mm256_maskz_mov_epi64(k, simde_mm256_shldi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shldi_epi64
+  #undef _mm256_maskz_shldi_epi64
+  #define _mm256_mask_shldi_epi64(src, k, a, b, imm8) simde_mm256_mask_shldi_epi64(src, k, a, b, imm8)
+  #define _mm256_maskz_shldi_epi64(k, a, b, imm8) simde_mm256_maskz_shldi_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shldi_epi16 (simde__m512i a, simde__m512i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+  const int s = imm8 & 15;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u16 = (a_.u16 << s) | ((b_.u16 >> 1) >> (15 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << s) | (b_.u16[i] >> (16 - s)));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_shldi_epi16(a, b, imm8) _mm512_shldi_epi16(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shldi_epi16
+  #define _mm512_shldi_epi16(a, b, imm8) simde_mm512_shldi_epi16(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_mask_shldi_epi16(src, k, a, b, imm8) _mm512_mask_shldi_epi16(src, k, a, b, imm8)
+  #define simde_mm512_maskz_shldi_epi16(k, a, b, imm8) _mm512_maskz_shldi_epi16(k, a, b, imm8)
+#else
+  #define simde_mm512_mask_shldi_epi16(src, k, a, b, imm8) simde_mm512_mask_mov_epi16(src, k, simde_mm512_shldi_epi16(a, b, imm8))
+  #define simde_mm512_maskz_shldi_epi16(k, a, b, imm8) simde_mm512_maskz_mov_epi16(k, simde_mm512_shldi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shldi_epi16
+  #undef _mm512_maskz_shldi_epi16
+  #define _mm512_mask_shldi_epi16(src, k, a, b, imm8) simde_mm512_mask_shldi_epi16(src, k, a, b, imm8)
+  #define _mm512_maskz_shldi_epi16(k, a, b, imm8) simde_mm512_maskz_shldi_epi16(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shldi_epi32 (simde__m512i a, simde__m512i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+  const int s = imm8 & 31;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u32 = (a_.u32 << s) | ((b_.u32 >> 1) >> (31 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = (a_.u32[i] << s) | ((b_.u32[i] >> 1) >> (31 - s));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_shldi_epi32(a, b, imm8) _mm512_shldi_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shldi_epi32
+  #define _mm512_shldi_epi32(a, b, imm8) simde_mm512_shldi_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_mask_shldi_epi32(src, k, a, b, imm8) _mm512_mask_shldi_epi32(src, k, a, b, imm8)
+  #define simde_mm512_maskz_shldi_epi32(k, a, b, imm8) _mm512_maskz_shldi_epi32(k, a, b, imm8)
+#else
+  #define simde_mm512_mask_shldi_epi32(src, k, a, b, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_shldi_epi32(a, b, imm8))
+  #define simde_mm512_maskz_shldi_epi32(k, a, b, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_shldi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shldi_epi32
+  #undef _mm512_maskz_shldi_epi32
+  #define _mm512_mask_shldi_epi32(src, k, a, b, imm8) simde_mm512_mask_shldi_epi32(src, k, a, b, imm8)
+  #define _mm512_maskz_shldi_epi32(k, a, b, imm8) simde_mm512_maskz_shldi_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shldi_epi64 (simde__m512i a, simde__m512i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+  const int s = imm8 & 63;
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    r_.u64 = (a_.u64 << s) | ((b_.u64 >> 1) >> (63 - s));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      r_.u64[i] = (a_.u64[i] << s) | ((b_.u64[i] >> 1) >> (63 - s));
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_shldi_epi64(a, b, imm8) _mm512_shldi_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shldi_epi64
+  #define _mm512_shldi_epi64(a, b, imm8) simde_mm512_shldi_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_mask_shldi_epi64(src, k, a, b, imm8) _mm512_mask_shldi_epi64(src, k, a, b, imm8)
+  #define simde_mm512_maskz_shldi_epi64(k, a, b, imm8) _mm512_maskz_shldi_epi64(k, a, b, imm8)
+#else
+  #define simde_mm512_mask_shldi_epi64(src, k, a, b, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_shldi_epi64(a, b, imm8))
+  #define simde_mm512_maskz_shldi_epi64(k, a, b, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_shldi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shldi_epi64
+  #undef _mm512_maskz_shldi_epi64
+  #define _mm512_mask_shldi_epi64(src, k, a, b, imm8) simde_mm512_mask_shldi_epi64(src, k, a, b, imm8)
+  #define _mm512_maskz_shldi_epi64(k, a, b, imm8) simde_mm512_maskz_shldi_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SHLDI_H) */
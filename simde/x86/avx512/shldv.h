@@ -0,0 +1,643 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_X86_AVX512_SHLDV_H)
+#define SIMDE_X86_AVX512_SHLDV_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* vpshldv concatenates each lane of a (high) and b (low), shifts the
+ * pair left by c modulo the lane width and keeps the upper half.  The
+ * 32- and 64-bit versions map onto AVX2's variable shifts; the 16-bit
+ * version multiplies by 2^s instead (pmullw for a, pmulhuw for b). */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shldv_epi16 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_shldv_epi16(a, b, c);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i
+      s = _mm_and_si128(c, _mm_set1_epi16(15)),
+      p = _mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, INT8_MIN, 0, 0, 0, 0, 0, 0, 0, 0), _mm_xor_si128(_mm_or_si128(s, _mm_slli_epi16(s, 8)), _mm_set1_epi16(0x0800)));
+    return _mm_or_si128(_mm_mullo_epi16(a, p), _mm_mulhi_epu16(b, p));
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const int16x8_t s = vandq_s16(c_.neon_i16, vdupq_n_s16(15));
+      r_.neon_u16 = vorrq_u16(vshlq_u16(a_.neon_u16, s), vshlq_u16(b_.neon_u16, vsubq_s16(s, vdupq_n_s16(16))));
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u16) s = c_.u16 & 15;
+      r_.u16 = (a_.u16 << s) | ((b_.u16 >> 1) >> (15 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        const unsigned int s = HEDLEY_STATIC_CAST(unsigned int, c_.u16[i] & 15);
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << s) | (b_.u16[i] >> (16 - s)));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shldv_epi16
+  #define _mm_shldv_epi16(a, b, c) simde_mm_shldv_epi16(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_shldv_epi16 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_shldv_epi16(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi16(a, k, simde_mm_shldv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shldv_epi16
+  #define _mm_mask_shldv_epi16(a, k, b, c) simde_mm_mask_shldv_epi16(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_shldv_epi16 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_shldv_epi16(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi16(k, simde_mm_shldv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shldv_epi16
+  #define _mm_maskz_shldv_epi16(k, a, b, c) simde_mm_maskz_shldv_epi16(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shldv_epi32 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_shldv_epi32(a, b, c);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i s = _mm_and_si128(c, _mm_set1_epi32(31));
+    return _mm_or_si128(_mm_sllv_epi32(a, s), _mm_srlv_epi32(b, _mm_sub_epi32(_mm_set1_epi32(32), s)));
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const int32x4_t s = vandq_s32(c_.neon_i32, vdupq_n_s32(31));
+      r_.neon_u32 = vorrq_u32(vshlq_u32(a_.neon_u32, s), vshlq_u32(b_.neon_u32, vsubq_s32(s, vdupq_n_s32(32))));
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u32) s = c_.u32 & 31;
+      r_.u32 = (a_.u32 << s) | ((b_.u32 >> 1) >> (31 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const unsigned int s = c_.u32[i] & 31;
+        r_.u32[i] = (a_.u32[i] << s) | ((b_.u32[i] >> 1) >> (31 - s));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shldv_epi32
+  #define _mm_shldv_epi32(a, b, c) simde_mm_shldv_epi32(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_shldv_epi32 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_shldv_epi32(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi32(a, k, simde_mm_shldv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shldv_epi32
+  #define _mm_mask_shldv_epi32(a, k, b, c) simde_mm_mask_shldv_epi32(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_shldv_epi32 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_shldv_epi32(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_shldv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shldv_epi32
+  #define _mm_maskz_shldv_epi32(k, a, b, c) simde_mm_maskz_shldv_epi32(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shldv_epi64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_shldv_epi64(a, b, c);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i s = _mm_and_si128(c, _mm_set1_epi64x(63));
+    return _mm_or_si128(_mm_sllv_epi64(a, s), _mm_srlv_epi64(b, _mm_sub_epi64(_mm_set1_epi64x(64), s)));
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const int64x2_t s = vandq_s64(c_.neon_i64, vdupq_n_s64(63));
+      r_.neon_u64 = vorrq_u64(vshlq_u64(a_.neon_u64, s), vshlq_u64(b_.neon_u64, vsubq_s64(s, vdupq_n_s64(64))));
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u64) s = c_.u64 & 63;
+      r_.u64 = (a_.u64 << s) | ((b_.u64 >> 1) >> (63 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const unsigned int s = HEDLEY_STATIC_CAST(unsigned int, c_.u64[i] & 63);
+        r_.u64[i] = (a_.u64[i] << s) | ((b_.u64[i] >> 1) >> (63 - s));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shldv_epi64
+  #define _mm_shldv_epi64(a, b, c) simde_mm_shldv_epi64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_shldv_epi64 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_shldv_epi64(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi64(a, k, simde_mm_shldv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shldv_epi64
+  #define _mm_mask_shldv_epi64(a, k, b, c) simde_mm_mask_shldv_epi64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_shldv_epi64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_shldv_epi64(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_shldv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shldv_epi64
+  #define _mm_maskz_shldv_epi64(k, a, b, c) simde_mm_maskz_shldv_epi64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shldv_epi16 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_shldv_epi16(a, b, c);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i
+      s = _mm256_and_si256(c, _mm256_set1_epi16(15)),
+      p = _mm256_shuffle_epi8(_mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, INT8_MIN, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 4, 8, 16, 32, 64, INT8_MIN, 0, 0, 0, 0, 0, 0, 0, 0), _mm256_xor_si256(_mm256_or_si256(s, _mm256_slli_epi16(s, 8)), _mm256_set1_epi16(0x0800)));
+    return _mm256_or_si256(_mm256_mullo_epi16(a, p), _mm256_mulhi_epu16(b, p));
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_shldv_epi16(a_.m128i[i], b_.m128i[i], c_.m128i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u16) s = c_.u16 & 15;
+      r_.u16 = (a_.u16 << s) | ((b_.u16 >> 1) >> (15 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        const unsigned int s = HEDLEY_STATIC_CAST(unsigned int, c_.u16[i] & 15);
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << s) | (b_.u16[i] >> (16 - s)));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shldv_epi16
+  #define _mm256_shldv_epi16(a, b, c) simde_mm256_shldv_epi16(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_shldv_epi16 (simde__m256i a, simde__mmask16 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_shldv_epi16(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi16(a, k, simde_mm256_shldv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shldv_epi16
+  #define _mm256_mask_shldv_epi16(a, k, b, c) simde_mm256_mask_shldv_epi16(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_shldv_epi16 (simde__mmask16 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_shldv_epi16(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi16(k, simde_mm256_shldv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shldv_epi16
+  #define _mm256_maskz_shldv_epi16(k, a, b, c) simde_mm256_maskz_shldv_epi16(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shldv_epi32 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_shldv_epi32(a, b, c);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i s = _mm256_and_si256(c, _mm256_set1_epi32(31));
+    return _mm256_or_si256(_mm256_sllv_epi32(a, s), _mm256_srlv_epi32(b, _mm256_sub_epi32(_mm256_set1_epi32(32), s)));
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_shldv_epi32(a_.m128i[i], b_.m128i[i], c_.m128i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u32) s = c_.u32 & 31;
+      r_.u32 = (a_.u32 << s) | ((b_.u32 >> 1) >> (31 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const unsigned int s = c_.u32[i] & 31;
+        r_.u32[i] = (a_.u32[i] << s) | ((b_.u32[i] >> 1) >> (31 - s));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shldv_epi32
+  #define _mm256_shldv_epi32(a, b, c) simde_mm256_shldv_epi32(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_shldv_epi32 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_shldv_epi32(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi32(a, k, simde_mm256_shldv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shldv_epi32
+  #define _mm256_mask_shldv_epi32(a, k, b, c) simde_mm256_mask_shldv_epi32(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_shldv_epi32 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_shldv_epi32(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_shldv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shldv_epi32
+  #define _mm256_maskz_shldv_epi32(k, a, b, c) simde_mm256_maskz_shldv_epi32(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shldv_epi64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_shldv_epi64(a, b, c);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i s = _mm256_and_si256(c, _mm256_set1_epi64x(63));
+    return _mm256_or_si256(_mm256_sllv_epi64(a, s), _mm256_srlv_epi64(b, _mm256_sub_epi64(_mm256_set1_epi64x(64), s)));
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_shldv_epi64(a_.m128i[i], b_.m128i[i], c_.m128i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u64) s = c_.u64 & 63;
+      r_.u64 = (a_.u64 << s) | ((b_.u64 >> 1) >> (63 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const unsigned int s = HEDLEY_STATIC_CAST(unsigned int, c_.u64[i] & 63);
+        r_.u64[i] = (a_.u64[i] << s) | ((b_.u64[i] >> 1) >> (63 - s));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shldv_epi64
+  #define _mm256_shldv_epi64(a, b, c) simde_mm256_shldv_epi64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_shldv_epi64 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_shldv_epi64(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi64(a, k, simde_mm256_shldv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shldv_epi64
+  #define _mm256_mask_shldv_epi64(a, k, b, c) simde_mm256_mask_shldv_epi64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_shldv_epi64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_shldv_epi64(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_shldv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shldv_epi64
+  #define _mm256_maskz_shldv_epi64(k, a, b, c) simde_mm256_maskz_shldv_epi64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shldv_epi16 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_shldv_epi16(a, b, c);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE)
+    const __m512i s = _mm512_and_si512(c, _mm512_set1_epi16(15));
+    return _mm512_or_si512(_mm512_sllv_epi16(a, s), _mm512_srlv_epi16(b, _mm512_sub_epi16(_mm512_set1_epi16(16), s)));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_shldv_epi16(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u16) s = c_.u16 & 15;
+      r_.u16 = (a_.u16 << s) | ((b_.u16 >> 1) >> (15 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        const unsigned int s = HEDLEY_STATIC_CAST(unsigned int, c_.u16[i] & 15);
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, (HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << s) | (b_.u16[i] >> (16 - s)));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shldv_epi16
+  #define _mm512_shldv_epi16(a, b, c) simde_mm512_shldv_epi16(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_shldv_epi16 (simde__m512i a, simde__mmask32 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_shldv_epi16(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi16(a, k, simde_mm512_shldv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shldv_epi16
+  #define _mm512_mask_shldv_epi16(a, k, b, c) simde_mm512_mask_shldv_epi16(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_shldv_epi16 (simde__mmask32 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_shldv_epi16(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi16(k, simde_mm512_shldv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shldv_epi16
+  #define _mm512_maskz_shldv_epi16(k, a, b, c) simde_mm512_maskz_shldv_epi16(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shldv_epi32 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_shldv_epi32(a, b, c);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    const __m512i s = _mm512_and_si512(c, _mm512_set1_epi32(31));
+    return _mm512_or_si512(_mm512_sllv_epi32(a, s), _mm512_srlv_epi32(b, _mm512_sub_epi32(_mm512_set1_epi32(32), s)));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_shldv_epi32(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u32) s = c_.u32 & 31;
+      r_.u32 = (a_.u32 << s) | ((b_.u32 >> 1) >> (31 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const unsigned int s = c_.u32[i] & 31;
+        r_.u32[i] = (a_.u32[i] << s) | ((b_.u32[i] >> 1) >> (31 - s));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shldv_epi32
+  #define _mm512_shldv_epi32(a, b, c) simde_mm512_shldv_epi32(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_shldv_epi32 (simde__m512i a, simde__mmask16 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_shldv_epi32(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi32(a, k, simde_mm512_shldv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shldv_epi32
+  #define _mm512_mask_shldv_epi32(a, k, b, c) simde_mm512_mask_shldv_epi32(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_shldv_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_shldv_epi32(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_shldv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shldv_epi32
+  #define _mm512_maskz_shldv_epi32(k, a, b, c) simde_mm512_maskz_shldv_epi32(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shldv_epi64 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_shldv_epi64(a, b, c);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    const __m512i s = _mm512_and_si512(c, _mm512_set1_epi64(63));
+    return _mm512_or_si512(_mm512_sllv_epi64(a, s), _mm512_srlv_epi64(b, _mm512_sub_epi64(_mm512_set1_epi64(64), s)));
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_shldv_epi64(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(c_.u64) s = c_.u64 & 63;
+      r_.u64 = (a_.u64 << s) | ((b_.u64 >> 1) >> (63 - s));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const unsigned int s = HEDLEY_STATIC_CAST(unsigned int, c_.u64[i] & 63);
+        r_.u64[i] = (a_.u64[i] << s) | ((b_.u64[i] >> 1) >> (63 - s));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shldv_epi64
+  #define _mm512_shldv_epi64(a, b, c) simde_mm512_shldv_epi64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_shldv_epi64 (simde__m512i a, simde__mmask8 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_shldv_epi64(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_shldv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shldv_epi64
+  #define _mm512_mask_shldv_epi64(a, k, b, c) simde_mm512_mask_shldv_epi64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_shldv_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_shldv_epi64(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_shldv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shldv_epi64
+  #define _mm512_maskz_shldv_epi64(k, a, b, c) simde_mm512_maskz_shldv_epi64(k, a, b, c)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SHLDV_H) */
@@ -0,0 +1,565 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_X86_AVX512_TERNARYLOGIC_H)
+#define SIMDE_X86_AVX512_TERNARYLOGIC_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Each of the 256 truth tables is spelled out as the smallest
+ * expression tree over a, b and c using &, |, ^, and-not and ~ (found
+ * by exhaustive search; no function needs more than five operators).
+ * Bit i of imm8 is the result for a = bit 2 of i, b = bit 1, c = bit 0.
+ * When imm8 is a constant the switch folds away and only the lowered
+ * expression remains; with vector extensions it compiles to whole-vector
+ * pand/pandn/por/pxor (or vand/vbic/vorr/veor/vbsl on NEON). */
+#define SIMDE_X_TERNARYLOGIC_(r, a, b, c, imm8)                 \
+  switch ((imm8) & 0xff) {                                      \
+    case 0x00: (r) = (a) ^ (a); break;                          \
+    case 0x01: (r) = ~((a) | (b)) & ~(c); break;                \
+    case 0x02: (r) = ~((a) | (b)) & (c); break;                 \
+    case 0x03: (r) = ~(a) & ~(b); break;                        \
+    case 0x04: (r) = ~((a) | (c)) & (b); break;                 \
+    case 0x05: (r) = ~(a) & ~(c); break;                        \
+    case 0x06: (r) = ~(a) & ((b) ^ (c)); break;                 \
+    case 0x07: (r) = ~((b) & (c)) & ~(a); break;                \
+    case 0x08: (r) = (~(a) & (b)) & (c); break;                 \
+    case 0x09: (r) = ~((b) ^ (c)) & ~(a); break;                \
+    case 0x0a: (r) = ~(a) & (c); break;                         \
+    case 0x0b: (r) = ~(a) & ((c) | ~(b)); break;                \
+    case 0x0c: (r) = ~(a) & (b); break;                         \
+    case 0x0d: (r) = ~(a) & ((b) | ~(c)); break;                \
+    case 0x0e: (r) = ~(a) & ((b) | (c)); break;                 \
+    case 0x0f: (r) = ~(a); break;                               \
+    case 0x10: (r) = ~((b) | (c)) & (a); break;                 \
+    case 0x11: (r) = ~(b) & ~(c); break;                        \
+    case 0x12: (r) = ~(b) & ((a) ^ (c)); break;                 \
+    case 0x13: (r) = ~((a) & (c)) & ~(b); break;                \
+    case 0x14: (r) = ~(c) & ((a) ^ (b)); break;                 \
+    case 0x15: (r) = ~((a) & (b)) & ~(c); break;                \
+    case 0x16: (r) = (((a) & (b)) | ((a) ^ (c))) ^ (b); break;  \
+    case 0x17: (r) = (((a) ^ (b)) & ((a) ^ (c))) ^ ~(a); break; \
+    case 0x18: (r) = ((a) ^ (b)) & ((a) ^ (c)); break;          \
+    case 0x19: (r) = (((a) & (b)) | ~(c)) ^ (b); break;         \
+    case 0x1a: (r) = (((a) & (b)) | (c)) ^ (a); break;          \
+    case 0x1b: (r) = (((a) ^ (b)) & (c)) ^ ~(b); break;         \
+    case 0x1c: (r) = (((a) & (c)) | (b)) ^ (a); break;          \
+    case 0x1d: (r) = (((a) ^ (c)) & (b)) ^ ~(c); break;         \
+    case 0x1e: (r) = ((b) | (c)) ^ (a); break;                  \
+    case 0x1f: (r) = ~(((b) | (c)) & (a)); break;               \
+    case 0x20: (r) = (~(b) & (a)) & (c); break;                 \
+    case 0x21: (r) = ~((a) ^ (c)) & ~(b); break;                \
+    case 0x22: (r) = ~(b) & (c); break;                         \
+    case 0x23: (r) = ~(b) & ((c) | ~(a)); break;                \
+    case 0x24: (r) = ((a) ^ (b)) & ((b) ^ (c)); break;          \
+    case 0x25: (r) = (((a) & (b)) | ~(c)) ^ (a); break;         \
+    case 0x26: (r) = (((a) & (b)) | (c)) ^ (b); break;          \
+    case 0x27: (r) = (((a) ^ (b)) & (c)) ^ ~(a); break;         \
+    case 0x28: (r) = ((a) ^ (b)) & (c); break;                  \
+    case 0x29: (r) = ((((a) & (b)) | (c)) ^ (a)) ^ ~(b); break; \
+    case 0x2a: (r) = ~((a) & (b)) & (c); break;                 \
+    case 0x2b: (r) = (((a) ^ (b)) & ((a) ^ (c))) ^ ~(b); break; \
+    case 0x2c: (r) = (((b) | (c)) & (a)) ^ (b); break;          \
+    case 0x2d: (r) = ((b) | ~(c)) ^ (a); break;                 \
+    case 0x2e: (r) = (((a) ^ (c)) | (b)) ^ (a); break;          \
+    case 0x2f: (r) = (~(b) & (c)) | ~(a); break;                \
+    case 0x30: (r) = ~(b) & (a); break;                         \
+    case 0x31: (r) = ~(b) & ((a) | ~(c)); break;                \
+    case 0x32: (r) = ~(b) & ((a) | (c)); break;                 \
+    case 0x33: (r) = ~(b); break;                               \
+    case 0x34: (r) = (((b) & (c)) | (a)) ^ (b); break;          \
+    case 0x35: (r) = (((b) ^ (c)) & (a)) ^ ~(c); break;         \
+    case 0x36: (r) = ((a) | (c)) ^ (b); break;                  \
+    case 0x37: (r) = ~(((a) | (c)) & (b)); break;               \
+    case 0x38: (r) = (((a) | (c)) & (b)) ^ (a); break;          \
+    case 0x39: (r) = ((a) | ~(c)) ^ (b); break;                 \
+    case 0x3a: (r) = (((b) ^ (c)) | (a)) ^ (b); break;          \
+    case 0x3b: (r) = (~(a) & (c)) | ~(b); break;                \
+    case 0x3c: (r) = (a) ^ (b); break;                          \
+    case 0x3d: (r) = ((~(a) & ~(c)) | (b)) ^ (a); break;        \
+    case 0x3e: (r) = ((~(a) & (c)) | (b)) ^ (a); break;         \
+    case 0x3f: (r) = ~((a) & (b)); break;                       \
+    case 0x40: (r) = (~(c) & (a)) & (b); break;                 \
+    case 0x41: (r) = ~((a) ^ (b)) & ~(c); break;                \
+    case 0x42: (r) = ((a) ^ (c)) & ((b) ^ (c)); break;          \
+    case 0x43: (r) = (((a) & (c)) | ~(b)) ^ (a); break;         \
+    case 0x44: (r) = ~(c) & (b); break;                         \
+    case 0x45: (r) = ~(c) & ((b) | ~(a)); break;                \
+    case 0x46: (r) = (((a) & (c)) | (b)) ^ (c); break;          \
+    case 0x47: (r) = (((a) ^ (c)) & (b)) ^ ~(a); break;         \
+    case 0x48: (r) = ((a) ^ (c)) & (b); break;                  \
+    case 0x49: (r) = ((((a) & (c)) | (b)) ^ (a)) ^ ~(c); break; \
+    case 0x4a: (r) = (((b) | (c)) & (a)) ^ (c); break;          \
+    case 0x4b: (r) = ((c) | ~(b)) ^ (a); break;                 \
+    case 0x4c: (r) = ~((a) & (c)) & (b); break;                 \
+    case 0x4d: (r) = (((a) ^ (b)) & ((a) ^ (c))) ^ ~(c); break; \
+    case 0x4e: (r) = (((a) ^ (b)) | (c)) ^ (a); break;          \
+    case 0x4f: (r) = (~(c) & (b)) | ~(a); break;                \
+    case 0x50: (r) = ~(c) & (a); break;                         \
+    case 0x51: (r) = ~(c) & ((a) | ~(b)); break;                \
+    case 0x52: (r) = (((b) & (c)) | (a)) ^ (c); break;          \
+    case 0x53: (r) = (((b) ^ (c)) & (a)) ^ ~(b); break;         \
+    case 0x54: (r) = ~(c) & ((a) | (b)); break;                 \
+    case 0x55: (r) = ~(c); break;                               \
+    case 0x56: (r) = ((a) | (b)) ^ (c); break;                  \
+    case 0x57: (r) = ~(((a) | (b)) & (c)); break;               \
+    case 0x58: (r) = (((a) | (b)) & (c)) ^ (a); break;          \
+    case 0x59: (r) = ((a) | ~(b)) ^ (c); break;                 \
+    case 0x5a: (r) = (a) ^ (c); break;                          \
+    case 0x5b: (r) = ((~(a) & ~(b)) | (c)) ^ (a); break;        \
+    case 0x5c: (r) = (((b) ^ (c)) | (a)) ^ (c); break;          \
+    case 0x5d: (r) = (~(a) & (b)) | ~(c); break;                \
+    case 0x5e: (r) = ((~(a) & (b)) | (c)) ^ (a); break;         \
+    case 0x5f: (r) = ~((a) & (c)); break;                       \
+    case 0x60: (r) = ((b) ^ (c)) & (a); break;                  \
+    case 0x61: (r) = ((((b) & (c)) | (a)) ^ (b)) ^ ~(c); break; \
+    case 0x62: (r) = (((a) | (c)) & (b)) ^ (c); break;          \
+    case 0x63: (r) = ((c) | ~(a)) ^ (b); break;                 \
+    case 0x64: (r) = (((a) | (b)) & (c)) ^ (b); break;          \
+    case 0x65: (r) = ((b) | ~(a)) ^ (c); break;                 \
+    case 0x66: (r) = (b) ^ (c); break;                          \
+    case 0x67: (r) = ((~(a) & ~(b)) | (c)) ^ (b); break;        \
+    case 0x68: (r) = (((a) & (b)) ^ (c)) & ((a) | (b)); break;  \
+    case 0x69: (r) = ((a) ^ (b)) ^ ~(c); break;                 \
+    case 0x6a: (r) = ((a) & (b)) ^ (c); break;                  \
+    case 0x6b: (r) = ((((a) | (b)) & (c)) ^ (a)) ^ ~(b); break; \
+    case 0x6c: (r) = ((a) & (c)) ^ (b); break;                  \
+    case 0x6d: (r) = ((((a) | (c)) & (b)) ^ (a)) ^ ~(c); break; \
+    case 0x6e: (r) = ((b) ^ (c)) | (~(a) & (b)); break;         \
+    case 0x6f: (r) = ((b) ^ (c)) | ~(a); break;                 \
+    case 0x70: (r) = ~((b) & (c)) & (a); break;                 \
+    case 0x71: (r) = (((a) ^ (b)) & ((b) ^ (c))) ^ ~(c); break; \
+    case 0x72: (r) = (((a) ^ (b)) | (c)) ^ (b); break;          \
+    case 0x73: (r) = (~(c) & (a)) | ~(b); break;                \
+    case 0x74: (r) = (((a) ^ (c)) | (b)) ^ (c); break;          \
+    case 0x75: (r) = (~(b) & (a)) | ~(c); break;                \
+    case 0x76: (r) = ((~(b) & (a)) | (c)) ^ (b); break;         \
+    case 0x77: (r) = ~((b) & (c)); break;                       \
+    case 0x78: (r) = ((b) & (c)) ^ (a); break;                  \
+    case 0x79: (r) = ((((b) | (c)) & (a)) ^ (b)) ^ ~(c); break; \
+    case 0x7a: (r) = ((a) ^ (c)) | (~(b) & (a)); break;         \
+    case 0x7b: (r) = ((a) ^ (c)) | ~(b); break;                 \
+    case 0x7c: (r) = ((a) ^ (b)) | (~(c) & (a)); break;         \
+    case 0x7d: (r) = ((a) ^ (b)) | ~(c); break;                 \
+    case 0x7e: (r) = ((a) ^ (b)) | ((a) ^ (c)); break;          \
+    case 0x7f: (r) = ~(((a) & (b)) & (c)); break;               \
+    case 0x80: (r) = ((a) & (b)) & (c); break;                  \
+    case 0x81: (r) = ~((a) ^ (b)) & ((a) ^ ~(c)); break;        \
+    case 0x82: (r) = ~((a) ^ (b)) & (c); break;                 \
+    case 0x83: (r) = ((~(c) & (a)) | ~(b)) ^ (a); break;        \
+    case 0x84: (r) = ~((a) ^ (c)) & (b); break;                 \
+    case 0x85: (r) = ((~(b) & (a)) | ~(c)) ^ (a); break;        \
+    case 0x86: (r) = ((((b) | (c)) & (a)) ^ (b)) ^ (c); break;  \
+    case 0x87: (r) = ((b) & (c)) ^ ~(a); break;                 \
+    case 0x88: (r) = (b) & (c); break;                          \
+    case 0x89: (r) = ((~(b) & (a)) | (c)) ^ ~(b); break;        \
+    case 0x8a: (r) = ~(~(b) & (a)) & (c); break;                \
+    case 0x8b: (r) = (((a) ^ (c)) | (b)) ^ ~(c); break;         \
+    case 0x8c: (r) = ~(~(c) & (a)) & (b); break;                \
+    case 0x8d: (r) = (((a) ^ (b)) | (c)) ^ ~(b); break;         \
+    case 0x8e: (r) = (((a) ^ (b)) & ((b) ^ (c))) ^ (c); break;  \
+    case 0x8f: (r) = ((b) & (c)) | ~(a); break;                 \
+    case 0x90: (r) = ~((b) ^ (c)) & (a); break;                 \
+    case 0x91: (r) = ((~(a) & (b)) | ~(c)) ^ (b); break;        \
+    case 0x92: (r) = ((((a) | (c)) & (b)) ^ (a)) ^ (c); break;  \
+    case 0x93: (r) = ((a) & (c)) ^ ~(b); break;                 \
+    case 0x94: (r) = ((((a) | (b)) & (c)) ^ (a)) ^ (b); break;  \
+    case 0x95: (r) = ((a) & (b)) ^ ~(c); break;                 \
+    case 0x96: (r) = ((a) ^ (b)) ^ (c); break;                  \
+    case 0x97: (r) = (((a) | (b)) & (c)) ^ ~((a) & (b)); break; \
+    case 0x98: (r) = (~(b) & ((a) | (c))) ^ (c); break;         \
+    case 0x99: (r) = (b) ^ ~(c); break;                         \
+    case 0x9a: (r) = (~(b) & (a)) ^ (c); break;                 \
+    case 0x9b: (r) = (((a) | (b)) & (c)) ^ ~(b); break;         \
+    case 0x9c: (r) = (~(c) & (a)) ^ (b); break;                 \
+    case 0x9d: (r) = (((a) | (c)) & (b)) ^ ~(c); break;         \
+    case 0x9e: (r) = ((((b) & (c)) | (a)) ^ (b)) ^ (c); break;  \
+    case 0x9f: (r) = ~(((b) ^ (c)) & (a)); break;               \
+    case 0xa0: (r) = (a) & (c); break;                          \
+    case 0xa1: (r) = ((~(a) & (b)) | (c)) ^ ~(a); break;        \
+    case 0xa2: (r) = ~(~(a) & (b)) & (c); break;                \
+    case 0xa3: (r) = (((b) ^ (c)) | (a)) ^ ~(c); break;         \
+    case 0xa4: (r) = (~(a) & ((b) | (c))) ^ (c); break;         \
+    case 0xa5: (r) = (a) ^ ~(c); break;                         \
+    case 0xa6: (r) = (~(a) & (b)) ^ (c); break;                 \
+    case 0xa7: (r) = (((a) | (b)) & (c)) ^ ~(a); break;         \
+    case 0xa8: (r) = ((a) | (b)) & (c); break;                  \
+    case 0xa9: (r) = ((a) | (b)) ^ ~(c); break;                 \
+    case 0xaa: (r) = (c); break;                                \
+    case 0xab: (r) = (~(a) & ~(b)) | (c); break;                \
+    case 0xac: (r) = (((b) ^ (c)) & (a)) ^ (b); break;          \
+    case 0xad: (r) = (((b) & (c)) | (a)) ^ ~(c); break;         \
+    case 0xae: (r) = (~(a) & (b)) | (c); break;                 \
+    case 0xaf: (r) = (c) | ~(a); break;                         \
+    case 0xb0: (r) = ~(~(c) & (b)) & (a); break;                \
+    case 0xb1: (r) = (((a) ^ (b)) | (c)) ^ ~(a); break;         \
+    case 0xb2: (r) = (((a) ^ (b)) & ((a) ^ (c))) ^ (c); break;  \
+    case 0xb3: (r) = ((a) & (c)) | ~(b); break;                 \
+    case 0xb4: (r) = (~(c) & (b)) ^ (a); break;                 \
+    case 0xb5: (r) = (((b) | (c)) & (a)) ^ ~(c); break;         \
+    case 0xb6: (r) = ((((a) & (c)) | (b)) ^ (a)) ^ (c); break;  \
+    case 0xb7: (r) = ~(((a) ^ (c)) & (b)); break;               \
+    case 0xb8: (r) = (((a) ^ (c)) & (b)) ^ (a); break;          \
+    case 0xb9: (r) = (((a) & (c)) | (b)) ^ ~(c); break;         \
+    case 0xba: (r) = (~(b) & (a)) | (c); break;                 \
+    case 0xbb: (r) = (c) | ~(b); break;                         \
+    case 0xbc: (r) = ((a) & (c)) | ((a) ^ (b)); break;          \
+    case 0xbd: (r) = ((a) ^ (b)) | ((a) ^ ~(c)); break;         \
+    case 0xbe: (r) = ((a) ^ (b)) | (c); break;                  \
+    case 0xbf: (r) = (c) | ~((a) & (b)); break;                 \
+    case 0xc0: (r) = (a) & (b); break;                          \
+    case 0xc1: (r) = ((~(a) & (c)) | (b)) ^ ~(a); break;        \
+    case 0xc2: (r) = (~(a) & ((b) | (c))) ^ (b); break;         \
+    case 0xc3: (r) = (a) ^ ~(b); break;                         \
+    case 0xc4: (r) = ~(~(a) & (c)) & (b); break;                \
+    case 0xc5: (r) = (((b) ^ (c)) | (a)) ^ ~(b); break;         \
+    case 0xc6: (r) = (~(a) & (c)) ^ (b); break;                 \
+    case 0xc7: (r) = (((a) | (c)) & (b)) ^ ~(a); break;         \
+    case 0xc8: (r) = ((a) | (c)) & (b); break;                  \
+    case 0xc9: (r) = ((a) | (c)) ^ ~(b); break;                 \
+    case 0xca: (r) = (((b) ^ (c)) & (a)) ^ (c); break;          \
+    case 0xcb: (r) = (((b) & (c)) | (a)) ^ ~(b); break;         \
+    case 0xcc: (r) = (b); break;                                \
+    case 0xcd: (r) = (~(a) & ~(c)) | (b); break;                \
+    case 0xce: (r) = (~(a) & (c)) | (b); break;                 \
+    case 0xcf: (r) = (b) | ~(a); break;                         \
+    case 0xd0: (r) = ~(~(b) & (c)) & (a); break;                \
+    case 0xd1: (r) = (((a) ^ (c)) | (b)) ^ ~(a); break;         \
+    case 0xd2: (r) = (~(b) & (c)) ^ (a); break;                 \
+    case 0xd3: (r) = (((b) | (c)) & (a)) ^ ~(b); break;         \
+    case 0xd4: (r) = (((a) ^ (b)) & ((a) ^ (c))) ^ (b); break;  \
+    case 0xd5: (r) = ((a) & (b)) | ~(c); break;                 \
+    case 0xd6: (r) = ((((a) & (b)) | (c)) ^ (a)) ^ (b); break;  \
+    case 0xd7: (r) = ~(((a) ^ (b)) & (c)); break;               \
+    case 0xd8: (r) = (((a) ^ (b)) & (c)) ^ (a); break;          \
+    case 0xd9: (r) = (((a) & (b)) | (c)) ^ ~(b); break;         \
+    case 0xda: (r) = ((a) & (b)) | ((a) ^ (c)); break;          \
+    case 0xdb: (r) = ((a) ^ (c)) | ((a) ^ ~(b)); break;         \
+    case 0xdc: (r) = (~(c) & (a)) | (b); break;                 \
+    case 0xdd: (r) = (b) | ~(c); break;                         \
+    case 0xde: (r) = ((a) ^ (c)) | (b); break;                  \
+    case 0xdf: (r) = (b) | ~((a) & (c)); break;                 \
+    case 0xe0: (r) = ((b) | (c)) & (a); break;                  \
+    case 0xe1: (r) = ((b) | (c)) ^ ~(a); break;                 \
+    case 0xe2: (r) = (((a) ^ (c)) & (b)) ^ (c); break;          \
+    case 0xe3: (r) = (((a) & (c)) | (b)) ^ ~(a); break;         \
+    case 0xe4: (r) = (((a) ^ (b)) & (c)) ^ (b); break;          \
+    case 0xe5: (r) = (((a) & (b)) | (c)) ^ ~(a); break;         \
+    case 0xe6: (r) = ((a) & (b)) | ((b) ^ (c)); break;          \
+    case 0xe7: (r) = ((a) ^ ~(b)) | ((b) ^ (c)); break;         \
+    case 0xe8: (r) = (((a) & (b)) | (c)) & ((a) | (b)); break;  \
+    case 0xe9: (r) = ((((a) & (b)) | ~(c)) ^ (a)) ^ (b); break; \
+    case 0xea: (r) = ((a) & (b)) | (c); break;                  \
+    case 0xeb: (r) = ((a) ^ ~(b)) | (c); break;                 \
+    case 0xec: (r) = ((a) & (c)) | (b); break;                  \
+    case 0xed: (r) = ((a) ^ ~(c)) | (b); break;                 \
+    case 0xee: (r) = (b) | (c); break;                          \
+    case 0xef: (r) = ((b) | (c)) | ~(a); break;                 \
+    case 0xf0: (r) = (a); break;                                \
+    case 0xf1: (r) = (~(b) & ~(c)) | (a); break;                \
+    case 0xf2: (r) = (~(b) & (c)) | (a); break;                 \
+    case 0xf3: (r) = (a) | ~(b); break;                         \
+    case 0xf4: (r) = (~(c) & (b)) | (a); break;                 \
+    case 0xf5: (r) = (a) | ~(c); break;                         \
+    case 0xf6: (r) = ((b) ^ (c)) | (a); break;                  \
+    case 0xf7: (r) = (a) | ~((b) & (c)); break;                 \
+    case 0xf8: (r) = ((b) & (c)) | (a); break;                  \
+    case 0xf9: (r) = ((b) ^ ~(c)) | (a); break;                 \
+    case 0xfa: (r) = (a) | (c); break;                          \
+    case 0xfb: (r) = ((a) | (c)) | ~(b); break;                 \
+    case 0xfc: (r) = (a) | (b); break;                          \
+    case 0xfd: (r) = ((a) | (b)) | ~(c); break;                 \
+    case 0xfe: (r) = ((a) | (b)) | (c); break;                  \
+    default: (r) = ~((a) ^ (a)); break;                         \
+  }
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_ternarylogic_epi32 (simde__m128i a, simde__m128i b, simde__m128i c, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b),
+    c_ = simde__m128i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_(r_.u32, a_.u32, b_.u32, c_.u32, imm8)
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_(r_.u32[i], a_.u32[i], b_.u32[i], c_.u32[i], imm8)
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_ternarylogic_epi32(a, b, c, imm8) _mm_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_ternarylogic_epi32
+  #define _mm_ternarylogic_epi32(a, b, c, imm8) simde_mm_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm_mask_ternarylogic_epi32(src, k, a, b, imm8)
+  #define simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#else
+  #define simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm_mask_mov_epi32(src, k, simde_mm_ternarylogic_epi32(src, a, b, imm8))
+  #define simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm_maskz_mov_epi32(k, simde_mm_ternarylogic_epi32(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_ternarylogic_epi32
+  #define _mm_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8)
+  #undef _mm_maskz_ternarylogic_epi32
+  #define _mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_ternarylogic_epi64 (simde__m128i a, simde__m128i b, simde__m128i c, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b),
+    c_ = simde__m128i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_(r_.u64, a_.u64, b_.u64, c_.u64, imm8)
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_(r_.u64[i], a_.u64[i], b_.u64[i], c_.u64[i], imm8)
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_ternarylogic_epi64(a, b, c, imm8) _mm_ternarylogic_epi64(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_ternarylogic_epi64
+  #define _mm_ternarylogic_epi64(a, b, c, imm8) simde_mm_ternarylogic_epi64(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm_mask_ternarylogic_epi64(src, k, a, b, imm8)
+  #define simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#else
+  #define simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm_mask_mov_epi64(src, k, simde_mm_ternarylogic_epi64(src, a, b, imm8))
+  #define simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm_maskz_mov_epi64(k, simde_mm_ternarylogic_epi64(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_ternarylogic_epi64
+  #define _mm_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8)
+  #undef _mm_maskz_ternarylogic_epi64
+  #define _mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_ternarylogic_epi32 (simde__m256i a, simde__m256i b, simde__m256i c, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b),
+    c_ = simde__m256i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_(r_.u32, a_.u32, b_.u32, c_.u32, imm8)
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_(r_.u32[i], a_.u32[i], b_.u32[i], c_.u32[i], imm8)
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_ternarylogic_epi32(a, b, c, imm8) _mm256_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_ternarylogic_epi32
+  #define _mm256_ternarylogic_epi32(a, b, c, imm8) simde_mm256_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm256_mask_ternarylogic_epi32(src, k, a, b, imm8)
+  #define simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#else
+  #define simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm256_mask_mov_epi32(src, k, simde_mm256_ternarylogic_epi32(src, a, b, imm8))
+  #define simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm256_maskz_mov_epi32(k, simde_mm256_ternarylogic_epi32(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_ternarylogic_epi32
+  #define _mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8)
+  #undef _mm256_maskz_ternarylogic_epi32
+  #define _mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_ternarylogic_epi64 (simde__m256i a, simde__m256i b, simde__m256i c, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b),
+    c_ = simde__m256i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_(r_.u64, a_.u64, b_.u64, c_.u64, imm8)
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_(r_.u64[i], a_.u64[i], b_.u64[i], c_.u64[i], imm8)
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_ternarylogic_epi64(a, b, c, imm8) _mm256_ternarylogic_epi64(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_ternarylogic_epi64
+  #define _mm256_ternarylogic_epi64(a, b, c, imm8) simde_mm256_ternarylogic_epi64(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm256_mask_ternarylogic_epi64(src, k, a, b, imm8)
+  #define simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#else
+  #define simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm256_mask_mov_epi64(src, k, simde_mm256_ternarylogic_epi64(src, a, b, imm8))
+  #define simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm256_maskz_mov_epi64(k, simde_mm256_ternarylogic_epi64(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_ternarylogic_epi64
+  #define _mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8)
+  #undef _mm256_maskz_ternarylogic_epi64
+  #define _mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ternarylogic_epi32 (simde__m512i a, simde__m512i b, simde__m512i c, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b),
+    c_ = simde__m512i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_(r_.u32, a_.u32, b_.u32, c_.u32, imm8)
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_(r_.u32[i], a_.u32[i], b_.u32[i], c_.u32[i], imm8)
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_ternarylogic_epi32(a, b, c, imm8) _mm512_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_ternarylogic_epi32
+  #define _mm512_ternarylogic_epi32(a, b, c, imm8) simde_mm512_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm512_mask_ternarylogic_epi32(src, k, a, b, imm8)
+  #define simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#else
+  #define simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_ternarylogic_epi32(src, a, b, imm8))
+  #define simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_ternarylogic_epi32(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_ternarylogic_epi32
+  #define _mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8)
+  #undef _mm512_maskz_ternarylogic_epi32
+  #define _mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ternarylogic_epi64 (simde__m512i a, simde__m512i b, simde__m512i c, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b),
+    c_ = simde__m512i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    SIMDE_X_TERNARYLOGIC_(r_.u64, a_.u64, b_.u64, c_.u64, imm8)
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+      SIMDE_X_TERNARYLOGIC_(r_.u64[i], a_.u64[i], b_.u64[i], c_.u64[i], imm8)
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_ternarylogic_epi64(a, b, c, imm8) _mm512_ternarylogic_epi64(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_ternarylogic_epi64
+  #define _mm512_ternarylogic_epi64(a, b, c, imm8) simde_mm512_ternarylogic_epi64(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm512_mask_ternarylogic_epi64(src, k, a, b, imm8)
+  #define simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#else
+  #define simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_ternarylogic_epi64(src, a, b, imm8))
+  #define simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_ternarylogic_epi64(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_ternarylogic_epi64
+  #define _mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8)
+  #undef _mm512_maskz_ternarylogic_epi64
+  #define _mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_TERNARYLOGIC_H) */
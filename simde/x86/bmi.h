@@ -0,0 +1,385 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+/* BMI1 and LZCNT scalar bit manipulation.
+ *
+ * TZCNT and LZCNT are the compiler's ctz/clz builtins plus a zero
+ * check, since the builtins are undefined for zero while the
+ * instructions return the operand width.  On AArch64 ctz compiles to
+ * RBIT+CLZ and clz to CLZ, both of which already return the width for
+ * zero, so the compiler folds the check away.  LZCNT is a separate
+ * CPUID bit from BMI1 (it was introduced with ABM on AMD), so it gets
+ * its own feature macro. */
+
+#if !defined(SIMDE_X86_BMI_H)
+#define SIMDE_X86_BMI_H
+
+#include "../simde-common.h"
+
+#if !defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES
+#endif
+#if !defined(SIMDE_X86_LZCNT_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_andn_u32 (uint32_t a, uint32_t b) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _andn_u32(a, b);
+  #else
+    return ~a & b;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _andn_u32
+  #define _andn_u32(a, b) simde_andn_u32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_andn_u64 (uint64_t a, uint64_t b) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _andn_u64(a, b);
+  #else
+    return ~a & b;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _andn_u64
+  #define _andn_u64(a, b) simde_andn_u64(a, b)
+#endif
+
+/* BEXTR takes the start bit in bits 7:0 of the control and the length
+ * in bits 15:8.  Bits past the top of the operand read as zero, so a
+ * start at or past the width gives zero and an oversized length keeps
+ * everything above the start. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr2_u32 (uint32_t a, uint32_t control) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return __bextr_u32(a, control);
+  #else
+    uint32_t start = control & 0xff;
+    uint32_t len = (control >> 8) & 0xff;
+
+    if (start >= 32)
+      return 0;
+
+    a >>= start;
+    if (len < 32)
+      a &= (UINT32_C(1) << len) - 1;
+
+    return a;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr2_u32
+  #define _bextr2_u32(a, control) simde_bextr2_u32(a, control)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr2_u64 (uint64_t a, uint64_t control) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return __bextr_u64(a, control);
+  #else
+    uint64_t start = control & 0xff;
+    uint64_t len = (control >> 8) & 0xff;
+
+    if (start >= 64)
+      return 0;
+
+    a >>= start;
+    if (len < 64)
+      a &= (UINT64_C(1) << len) - 1;
+
+    return a;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr2_u64
+  #define _bextr2_u64(a, control) simde_bextr2_u64(a, control)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr_u32 (uint32_t a, uint32_t start, uint32_t len) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _bextr_u32(a, start, len);
+  #else
+    return simde_bextr2_u32(a, (start & 0xff) | ((len & 0xff) << 8));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr_u32
+  #define _bextr_u32(a, start, len) simde_bextr_u32(a, start, len)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr_u64 (uint64_t a, uint32_t start, uint32_t len) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _bextr_u64(a, start, len);
+  #else
+    return simde_bextr2_u64(a, HEDLEY_STATIC_CAST(uint64_t, (start & 0xff) | ((len & 0xff) << 8)));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr_u64
+  #define _bextr_u64(a, start, len) simde_bextr_u64(a, start, len)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsi_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsi_u32(a);
+  #else
+    return a & (~a + 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsi_u32
+  #define _blsi_u32(a) simde_blsi_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsi_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsi_u64(a);
+  #else
+    return a & (~a + 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsi_u64
+  #define _blsi_u64(a) simde_blsi_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsmsk_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsmsk_u32(a);
+  #else
+    return a ^ (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsmsk_u32
+  #define _blsmsk_u32(a) simde_blsmsk_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsmsk_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsmsk_u64(a);
+  #else
+    return a ^ (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsmsk_u64
+  #define _blsmsk_u64(a) simde_blsmsk_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsr_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsr_u32(a);
+  #else
+    return a & (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsr_u32
+  #define _blsr_u32(a) simde_blsr_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsr_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsr_u64(a);
+  #else
+    return a & (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsr_u64
+  #define _blsr_u64(a) simde_blsr_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_tzcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _tzcnt_u32(a);
+  #elif \
+      defined(SIMDE_BUILTIN_SUFFIX_32_) && \
+      ( \
+        SIMDE_BUILTIN_HAS_32_(ctz) || \
+        HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+        HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+        HEDLEY_IBM_VERSION_CHECK(13,1,0) \
+      )
+    if (HEDLEY_UNLIKELY(a == 0))
+      return 32;
+
+    return HEDLEY_STATIC_CAST(uint32_t, SIMDE_BUILTIN_32_(ctz)(HEDLEY_STATIC_CAST(unsigned SIMDE_BUILTIN_TYPE_32_, a)));
+  #else
+    /* Isolate the lowest set bit and look its position up with a
+     * de Bruijn multiply. */
+    static const uint8_t debruijn[32] = {
+       0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+      31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+    };
+
+    if (HEDLEY_UNLIKELY(a == 0))
+      return 32;
+
+    return debruijn[((a & (~a + 1)) * UINT32_C(0x077CB531)) >> 27];
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _tzcnt_u32
+  #define _tzcnt_u32(a) simde_tzcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_tzcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _tzcnt_u64(a);
+  #elif \
+      defined(SIMDE_BUILTIN_SUFFIX_64_) && \
+      ( \
+        SIMDE_BUILTIN_HAS_64_(ctz) || \
+        HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+        HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+        HEDLEY_IBM_VERSION_CHECK(13,1,0) \
+      )
+    if (HEDLEY_UNLIKELY(a == 0))
+      return 64;
+
+    return HEDLEY_STATIC_CAST(uint64_t, SIMDE_BUILTIN_64_(ctz)(HEDLEY_STATIC_CAST(unsigned SIMDE_BUILTIN_TYPE_64_, a)));
+  #else
+    uint32_t lo = HEDLEY_STATIC_CAST(uint32_t, a);
+
+    if (lo != 0)
+      return simde_tzcnt_u32(lo);
+
+    return 32 + simde_tzcnt_u32(HEDLEY_STATIC_CAST(uint32_t, a >> 32));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _tzcnt_u64
+  #define _tzcnt_u64(a) simde_tzcnt_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_lzcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_LZCNT_NATIVE)
+    return _lzcnt_u32(a);
+  #elif \
+      defined(SIMDE_BUILTIN_SUFFIX_32_) && \
+      ( \
+        SIMDE_BUILTIN_HAS_32_(clz) || \
+        HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+        HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+        HEDLEY_IBM_VERSION_CHECK(13,1,0) \
+      )
+    if (HEDLEY_UNLIKELY(a == 0))
+      return 32;
+
+    return HEDLEY_STATIC_CAST(uint32_t, SIMDE_BUILTIN_32_(clz)(HEDLEY_STATIC_CAST(unsigned SIMDE_BUILTIN_TYPE_32_, a)));
+  #else
+    uint32_t r;
+    uint32_t shift;
+
+    if (HEDLEY_UNLIKELY(a == 0))
+      return 32;
+
+    r     = HEDLEY_STATIC_CAST(uint32_t, (a > UINT32_C(0xFFFF)) << 4); a >>= r;
+    shift = HEDLEY_STATIC_CAST(uint32_t, (a > UINT32_C(0x00FF)) << 3); a >>= shift; r |= shift;
+    shift = HEDLEY_STATIC_CAST(uint32_t, (a > UINT32_C(0x000F)) << 2); a >>= shift; r |= shift;
+    shift = HEDLEY_STATIC_CAST(uint32_t, (a > UINT32_C(0x0003)) << 1); a >>= shift; r |= shift;
+    r    |= (a >> 1);
+
+    return 31 - r;
+  #endif
+}
+#if defined(SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES)
+  #undef _lzcnt_u32
+  #define _lzcnt_u32(a) simde_lzcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_lzcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_LZCNT_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _lzcnt_u64(a);
+  #elif \
+      defined(SIMDE_BUILTIN_SUFFIX_64_) && \
+      ( \
+        SIMDE_BUILTIN_HAS_64_(clz) || \
+        HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+        HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+        HEDLEY_IBM_VERSION_CHECK(13,1,0) \
+      )
+    if (HEDLEY_UNLIKELY(a == 0))
+      return 64;
+
+    return HEDLEY_STATIC_CAST(uint64_t, SIMDE_BUILTIN_64_(clz)(HEDLEY_STATIC_CAST(unsigned SIMDE_BUILTIN_TYPE_64_, a)));
+  #else
+    uint32_t hi = HEDLEY_STATIC_CAST(uint32_t, a >> 32);
+
+    if (hi != 0)
+      return simde_lzcnt_u32(hi);
+
+    return 32 + simde_lzcnt_u32(HEDLEY_STATIC_CAST(uint32_t, a));
+  #endif
+}
+#if defined(SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES)
+  #undef _lzcnt_u64
+  #define _lzcnt_u64(a) simde_lzcnt_u64(a)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_BMI_H) */
@@ -0,0 +1,365 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+/* BMI2 scalar bit manipulation.
+ *
+ * PDEP and PEXT have no cheap equivalent anywhere else, and the
+ * obvious one-bit-per-iteration loop costs tens of nanoseconds for a
+ * dense mask (hundreds for PDEP, which can't skip the holes).  Instead
+ * the mask is handled one contiguous run of set bits at a time, which
+ * is only a handful of instructions per run, and masks with many runs
+ * switch to the branch-free compress/expand from Hacker's Delight
+ * (section 7-4), which takes log2(width) rounds no matter what the
+ * mask looks like.  When the mask is a compile-time constant (Morton
+ * codes and the like) the compiler evaluates the mask half of either
+ * method, leaving a few shifts and masks per round.
+ *
+ * Zen and Zen 2 implement PDEP/PEXT in microcode with a cost that
+ * grows with the number of set bits in the mask, so there we use the
+ * portable version even when BMI2 is available. */
+
+#if !defined(SIMDE_X86_BMI2_H)
+#define SIMDE_X86_BMI2_H
+
+#include "bmi.h"
+#include "sse4.2.h"
+
+#if !defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES
+#endif
+
+#if defined(SIMDE_X86_BMI2_NATIVE) && !defined(__znver1__) && !defined(__znver2__)
+#  define SIMDE_X86_BMI2_FAST_PDEP_PEXT_
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bzhi_u32 (uint32_t a, uint32_t index) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _bzhi_u32(a, index);
+  #else
+    index &= 0xff;
+
+    if (index >= 32)
+      return a;
+
+    return a & ((UINT32_C(1) << index) - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _bzhi_u32
+  #define _bzhi_u32(a, index) simde_bzhi_u32(a, index)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bzhi_u64 (uint64_t a, uint32_t index) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _bzhi_u64(a, index);
+  #else
+    index &= 0xff;
+
+    if (index >= 64)
+      return a;
+
+    return a & ((UINT64_C(1) << index) - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _bzhi_u64
+  #define _bzhi_u64(a, index) simde_bzhi_u64(a, index)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mulx_u32 (uint32_t a, uint32_t b, uint32_t* hi) {
+  /* GCC only declares _mulx_u32 for 32-bit x86. */
+  #if defined(SIMDE_X86_BMI2_NATIVE) && !defined(SIMDE_ARCH_AMD64)
+    unsigned int hi_;
+    uint32_t r = _mulx_u32(a, b, &hi_);
+    *hi = HEDLEY_STATIC_CAST(uint32_t, hi_);
+    return r;
+  #else
+    uint64_t r = HEDLEY_STATIC_CAST(uint64_t, a) * HEDLEY_STATIC_CAST(uint64_t, b);
+    *hi = HEDLEY_STATIC_CAST(uint32_t, r >> 32);
+    return HEDLEY_STATIC_CAST(uint32_t, r);
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mulx_u32
+  #define _mulx_u32(a, b, hi) simde_mulx_u32(a, b, hi)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mulx_u64 (uint64_t a, uint64_t b, uint64_t* hi) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    unsigned long long hi_;
+    uint64_t r = _mulx_u64(a, b, &hi_);
+    *hi = HEDLEY_STATIC_CAST(uint64_t, hi_);
+    return r;
+  #elif defined(SIMDE_HAVE_INT128_)
+    simde_uint128 r = HEDLEY_STATIC_CAST(simde_uint128, a) * HEDLEY_STATIC_CAST(simde_uint128, b);
+    *hi = HEDLEY_STATIC_CAST(uint64_t, r >> 64);
+    return HEDLEY_STATIC_CAST(uint64_t, r);
+  #else
+    uint64_t al = a & UINT32_C(0xffffffff), ah = a >> 32;
+    uint64_t bl = b & UINT32_C(0xffffffff), bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (lh & UINT32_C(0xffffffff)) + (hl & UINT32_C(0xffffffff));
+
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (ll & UINT32_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mulx_u64
+  #define _mulx_u64(a, b, hi) simde_mulx_u64(a, b, hi)
+#endif
+
+/* One round of the Hacker's Delight compress: works out which mask
+ * bits move right by `shift` (those with an odd number of holes in
+ * the corresponding bit of the hole count below them), moves them, and
+ * returns the bits that moved so the data can follow.  The rounds are
+ * written out rather than looped so that a constant mask folds. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_bmi2_compress_round_u32_ (uint32_t* m, uint32_t* mk, int shift) {
+  uint32_t mp = *mk ^ (*mk << 1);
+  uint32_t mv;
+
+  mp ^= mp <<  2;
+  mp ^= mp <<  4;
+  mp ^= mp <<  8;
+  mp ^= mp << 16;
+
+  mv = mp & *m;
+  *m = (*m ^ mv) | (mv >> shift);
+  *mk &= ~mp;
+
+  return mv;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_bmi2_compress_round_u64_ (uint64_t* m, uint64_t* mk, int shift) {
+  uint64_t mp = *mk ^ (*mk << 1);
+  uint64_t mv;
+
+  mp ^= mp <<  2;
+  mp ^= mp <<  4;
+  mp ^= mp <<  8;
+  mp ^= mp << 16;
+  mp ^= mp << 32;
+
+  mv = mp & *m;
+  *m = (*m ^ mv) | (mv >> shift);
+  *mk &= ~mp;
+
+  return mv;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_pdep_u32 (uint32_t a, uint32_t mask) {
+  #if defined(SIMDE_X86_BMI2_FAST_PDEP_PEXT_)
+    return _pdep_u32(a, mask);
+  #else
+    uint32_t r = 0;
+
+    /* Number of runs of set bits in the mask. */
+    if (simde_mm_popcnt_u32(mask & ~(mask << 1)) <= 8) {
+      while (mask != 0) {
+        uint32_t start = simde_tzcnt_u32(mask);
+        uint32_t above = mask + (mask & (~mask + 1));
+        uint32_t run = mask & ~above;
+        uint32_t len = simde_tzcnt_u32(~(mask >> start));
+
+        r |= (a << start) & run;
+        a = (a >> (len - 1)) >> 1;
+        mask &= above;
+      }
+    } else {
+      /* Work out where compress would move each bit, then run the
+       * moves backwards. */
+      uint32_t m = mask, mk = ~mask << 1;
+      const uint32_t mv0 = simde_x_bmi2_compress_round_u32_(&m, &mk,  1);
+      const uint32_t mv1 = simde_x_bmi2_compress_round_u32_(&m, &mk,  2);
+      const uint32_t mv2 = simde_x_bmi2_compress_round_u32_(&m, &mk,  4);
+      const uint32_t mv3 = simde_x_bmi2_compress_round_u32_(&m, &mk,  8);
+      const uint32_t mv4 = simde_x_bmi2_compress_round_u32_(&m, &mk, 16);
+
+      r = a;
+      r = (r & ~mv4) | ((r << 16) & mv4);
+      r = (r & ~mv3) | ((r <<  8) & mv3);
+      r = (r & ~mv2) | ((r <<  4) & mv2);
+      r = (r & ~mv1) | ((r <<  2) & mv1);
+      r = (r & ~mv0) | ((r <<  1) & mv0);
+      r &= mask;
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pdep_u32
+  #define _pdep_u32(a, mask) simde_pdep_u32(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_pdep_u64 (uint64_t a, uint64_t mask) {
+  #if defined(SIMDE_X86_BMI2_FAST_PDEP_PEXT_) && defined(SIMDE_ARCH_AMD64)
+    return _pdep_u64(a, mask);
+  #else
+    uint64_t r = 0;
+
+    if (simde_mm_popcnt_u64(mask & ~(mask << 1)) <= 12) {
+      while (mask != 0) {
+        uint64_t start = simde_tzcnt_u64(mask);
+        uint64_t above = mask + (mask & (~mask + 1));
+        uint64_t run = mask & ~above;
+        uint64_t len = simde_tzcnt_u64(~(mask >> start));
+
+        r |= (a << start) & run;
+        a = (a >> (len - 1)) >> 1;
+        mask &= above;
+      }
+    } else {
+      uint64_t m = mask, mk = ~mask << 1;
+      const uint64_t mv0 = simde_x_bmi2_compress_round_u64_(&m, &mk,  1);
+      const uint64_t mv1 = simde_x_bmi2_compress_round_u64_(&m, &mk,  2);
+      const uint64_t mv2 = simde_x_bmi2_compress_round_u64_(&m, &mk,  4);
+      const uint64_t mv3 = simde_x_bmi2_compress_round_u64_(&m, &mk,  8);
+      const uint64_t mv4 = simde_x_bmi2_compress_round_u64_(&m, &mk, 16);
+      const uint64_t mv5 = simde_x_bmi2_compress_round_u64_(&m, &mk, 32);
+
+      r = a;
+      r = (r & ~mv5) | ((r << 32) & mv5);
+      r = (r & ~mv4) | ((r << 16) & mv4);
+      r = (r & ~mv3) | ((r <<  8) & mv3);
+      r = (r & ~mv2) | ((r <<  4) & mv2);
+      r = (r & ~mv1) | ((r <<  2) & mv1);
+      r = (r & ~mv0) | ((r <<  1) & mv0);
+      r &= mask;
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pdep_u64
+  #define _pdep_u64(a, mask) simde_pdep_u64(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_pext_u32 (uint32_t a, uint32_t mask) {
+  #if defined(SIMDE_X86_BMI2_FAST_PDEP_PEXT_)
+    return _pext_u32(a, mask);
+  #else
+    uint32_t r = 0;
+
+    if (simde_mm_popcnt_u32(mask & ~(mask << 1)) <= 8) {
+      uint32_t pos = 0;
+
+      while (mask != 0) {
+        uint32_t start = simde_tzcnt_u32(mask);
+        uint32_t above = mask + (mask & (~mask + 1));
+        uint32_t run = mask & ~above;
+
+        r |= ((a & run) >> start) << pos;
+        pos += simde_tzcnt_u32(~(mask >> start));
+        mask &= above;
+      }
+    } else {
+      uint32_t m = mask, mk = ~mask << 1, mv;
+
+      r = a & mask;
+      mv = simde_x_bmi2_compress_round_u32_(&m, &mk,  1); r = (r & ~mv) | ((r & mv) >>  1);
+      mv = simde_x_bmi2_compress_round_u32_(&m, &mk,  2); r = (r & ~mv) | ((r & mv) >>  2);
+      mv = simde_x_bmi2_compress_round_u32_(&m, &mk,  4); r = (r & ~mv) | ((r & mv) >>  4);
+      mv = simde_x_bmi2_compress_round_u32_(&m, &mk,  8); r = (r & ~mv) | ((r & mv) >>  8);
+      mv = simde_x_bmi2_compress_round_u32_(&m, &mk, 16); r = (r & ~mv) | ((r & mv) >> 16);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pext_u32
+  #define _pext_u32(a, mask) simde_pext_u32(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_pext_u64 (uint64_t a, uint64_t mask) {
+  #if defined(SIMDE_X86_BMI2_FAST_PDEP_PEXT_) && defined(SIMDE_ARCH_AMD64)
+    return _pext_u64(a, mask);
+  #else
+    uint64_t r = 0;
+
+    if (simde_mm_popcnt_u64(mask & ~(mask << 1)) <= 12) {
+      uint64_t pos = 0;
+
+      while (mask != 0) {
+        uint64_t start = simde_tzcnt_u64(mask);
+        uint64_t above = mask + (mask & (~mask + 1));
+        uint64_t run = mask & ~above;
+
+        r |= ((a & run) >> start) << pos;
+        pos += simde_tzcnt_u64(~(mask >> start));
+        mask &= above;
+      }
+    } else {
+      uint64_t m = mask, mk = ~mask << 1, mv;
+
+      r = a & mask;
+      mv = simde_x_bmi2_compress_round_u64_(&m, &mk,  1); r = (r & ~mv) | ((r & mv) >>  1);
+      mv = simde_x_bmi2_compress_round_u64_(&m, &mk,  2); r = (r & ~mv) | ((r & mv) >>  2);
+      mv = simde_x_bmi2_compress_round_u64_(&m, &mk,  4); r = (r & ~mv) | ((r & mv) >>  4);
+      mv = simde_x_bmi2_compress_round_u64_(&m, &mk,  8); r = (r & ~mv) | ((r & mv) >>  8);
+      mv = simde_x_bmi2_compress_round_u64_(&m, &mk, 16); r = (r & ~mv) | ((r & mv) >> 16);
+      mv = simde_x_bmi2_compress_round_u64_(&m, &mk, 32); r = (r & ~mv) | ((r & mv) >> 32);
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pext_u64
+  #define _pext_u64(a, mask) simde_pext_u64(a, mask)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_BMI2_H) */
@@ -44,6 +44,28 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* POWER8 vpmsumd multiplies both pairs of doublewords and XORs the two
+ * products; if one doubleword of each input is zero the result is a
+ * single 64x64 -> 128-bit product.  The lane order only matches x86
+ * on little-endian targets. */
+#if \
+    defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__) && \
+    (SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE)
+  #if HEDLEY_HAS_BUILTIN(__builtin_altivec_crypto_vpmsumd)
+    #define SIMDE_X_CLMUL_VPMSUMD_(a, b) __builtin_altivec_crypto_vpmsumd(a, b)
+  #else
+    #define SIMDE_X_CLMUL_VPMSUMD_(a, b) __builtin_crypto_vpmsumd(a, b)
+  #endif
+#endif
+
+/* Defined when simde_mm_clmulepi64_si128 is a single instruction. */
+#if \
+    defined(SIMDE_X86_PCLMUL_NATIVE) || \
+    (defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+    defined(SIMDE_X_CLMUL_VPMSUMD_)
+  #define SIMDE_X_CLMUL_NATIVE_128_
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 uint64_t
 simde_x_clmul_u64(uint64_t x, uint64_t y) {
@@ -134,6 +156,11 @@ simde_mm_clmulepi64_si128 (simde__m128i a, simde__m128i b, const int imm8)
     #endif
     poly128_t R = vmull_p64(A_, B_);
     r_.neon_u64 = vreinterpretq_u64_p128(R);
+  #elif defined(SIMDE_X_CLMUL_VPMSUMD_)
+    const SIMDE_POWER_ALTIVEC_VECTOR(unsigned long long)
+      A = { a_.u64[(imm8     ) & 1], 0 },
+      B = { b_.u64[(imm8 >> 4) & 1], 0 };
+    r_.altivec_u64 = SIMDE_X_CLMUL_VPMSUMD_(A, B);
   #elif SIMDE_NATURAL_VECTOR_SIZE_GE(128)
     #if defined(SIMDE_SHUFFLE_VECTOR_)
       switch (imm8 & 0x11) {
@@ -221,6 +248,91 @@ simde_mm_clmulepi64_si128 (simde__m128i a, simde__m128i b, const int imm8)
   #define _mm_clmulepi64_si128(a, b, imm8) simde_mm_clmulepi64_si128(a, b, imm8)
 #endif
 
+/* simde_x_crc32c_buffer computes the CRC-32C of a buffer.  Like the
+ * crc32 instructions (and unlike most CRC-32C APIs) no pre- or
+ * post-conditioning is performed, so the result is the same as
+ * calling simde_mm_crc32_u8 on each byte in turn; pass ~0 and invert
+ * the result to get the conventional CRC-32C.
+ *
+ * When carry-less multiplication is native the bulk of the buffer is
+ * folded 64 bytes at a time using four independent accumulators (see
+ * Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+ * Instruction"); the folded 128-bit remainder and any trailing bytes
+ * are then reduced with simde_mm_crc32_*.  The folding constants are
+ * x^(n-1) mod P, bit-reflected, for the relevant distances n. */
+#if (SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE) && defined(SIMDE_X_CLMUL_NATIVE_128_)
+  #define SIMDE_X_CRC32C_FOLD_
+#endif
+
+#if defined(SIMDE_X_CRC32C_FOLD_)
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_crc32c_fold_(simde__m128i x, simde__m128i k, simde__m128i data) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(
+        simde_mm_clmulepi64_si128(x, k, 0x00),
+        simde_mm_clmulepi64_si128(x, k, 0x11)),
+      data);
+}
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_crc32c_buffer(uint32_t crc, const void* ptr, size_t len) {
+  const uint8_t* data = HEDLEY_REINTERPRET_CAST(const uint8_t*, ptr);
+
+  #if defined(SIMDE_X_CRC32C_FOLD_)
+    if (len >= 64) {
+      /* x^575 and x^511 fold 512 bits, x^191 and x^127 fold 128 bits. */
+      const simde__m128i k512 = simde_x_mm_set_epu64x(UINT64_C(0x75bba45b00000000), UINT64_C(0x1c19243b00000000));
+      const simde__m128i k128 = simde_x_mm_set_epu64x(UINT64_C(0x3171d43000000000), UINT64_C(0x3743f7bd00000000));
+      simde__m128i x0, x1, x2, x3;
+      simde__m128i_private r_;
+
+      x0 = simde_mm_loadu_si128(data +  0);
+      x1 = simde_mm_loadu_si128(data + 16);
+      x2 = simde_mm_loadu_si128(data + 32);
+      x3 = simde_mm_loadu_si128(data + 48);
+      x0 = simde_mm_xor_si128(x0, simde_mm_cvtsi32_si128(HEDLEY_STATIC_CAST(int32_t, crc)));
+      data += 64;
+      len -= 64;
+
+      for ( ; len >= 64 ; data += 64, len -= 64) {
+        x0 = simde_x_crc32c_fold_(x0, k512, simde_mm_loadu_si128(data +  0));
+        x1 = simde_x_crc32c_fold_(x1, k512, simde_mm_loadu_si128(data + 16));
+        x2 = simde_x_crc32c_fold_(x2, k512, simde_mm_loadu_si128(data + 32));
+        x3 = simde_x_crc32c_fold_(x3, k512, simde_mm_loadu_si128(data + 48));
+      }
+
+      x0 = simde_x_crc32c_fold_(x0, k128, x1);
+      x0 = simde_x_crc32c_fold_(x0, k128, x2);
+      x0 = simde_x_crc32c_fold_(x0, k128, x3);
+      for ( ; len >= 16 ; data += 16, len -= 16) {
+        x0 = simde_x_crc32c_fold_(x0, k128, simde_mm_loadu_si128(data));
+      }
+
+      r_ = simde__m128i_to_private(x0);
+      crc = HEDLEY_STATIC_CAST(uint32_t, simde_mm_crc32_u64(0, r_.u64[0]));
+      crc = HEDLEY_STATIC_CAST(uint32_t, simde_mm_crc32_u64(crc, r_.u64[1]));
+    }
+  #endif
+
+  #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE
+    for ( ; len >= 8 ; data += 8, len -= 8) {
+      uint64_t v;
+      simde_memcpy(&v, data, sizeof(v));
+      crc = HEDLEY_STATIC_CAST(uint32_t, simde_mm_crc32_u64(crc, v));
+    }
+  #endif
+
+  for ( ; len > 0 ; data++, len--) {
+    crc = simde_mm_crc32_u8(crc, *data);
+  }
+
+  return crc;
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_clmulepi64_epi128 (simde__m256i a, simde__m256i b, const int imm8)
@@ -249,6 +361,25 @@ simde_mm256_clmulepi64_epi128 (simde__m256i a, simde__m256i b, const int imm8)
         r_.m128i[1] = _mm_clmulepi64_si128(a_.m128i[1], b_.m128i[1], 0x11);
         break;
     }
+  #elif defined(SIMDE_X_CLMUL_NATIVE_128_)
+    switch (imm8 & 0x11) {
+      case 0x00:
+        r_.m128i[0] = simde_mm_clmulepi64_si128(a_.m128i[0], b_.m128i[0], 0x00);
+        r_.m128i[1] = simde_mm_clmulepi64_si128(a_.m128i[1], b_.m128i[1], 0x00);
+        break;
+      case 0x01:
+        r_.m128i[0] = simde_mm_clmulepi64_si128(a_.m128i[0], b_.m128i[0], 0x01);
+        r_.m128i[1] = simde_mm_clmulepi64_si128(a_.m128i[1], b_.m128i[1], 0x01);
+        break;
+      case 0x10:
+        r_.m128i[0] = simde_mm_clmulepi64_si128(a_.m128i[0], b_.m128i[0], 0x10);
+        r_.m128i[1] = simde_mm_clmulepi64_si128(a_.m128i[1], b_.m128i[1], 0x10);
+        break;
+      case 0x11:
+        r_.m128i[0] = simde_mm_clmulepi64_si128(a_.m128i[0], b_.m128i[0], 0x11);
+        r_.m128i[1] = simde_mm_clmulepi64_si128(a_.m128i[1], b_.m128i[1], 0x11);
+        break;
+    }
   #else
     simde__m128i_private a_lo_, b_lo_, r_lo_, a_hi_, b_hi_, r_hi_;
 
@@ -322,7 +453,7 @@ simde_mm512_clmulepi64_epi128 (simde__m512i a, simde__m512i b, const int imm8)
   #if defined(HEDLEY_MSVC_VERSION)
     r_ = simde__m512i_to_private(simde_mm512_setzero_si512());
   #endif
-  #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+  #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_CLMUL_NATIVE_128_)
     switch (imm8 & 0x11) {
       case 0x00:
         r_.m256i[0] = simde_mm256_clmulepi64_epi128(a_.m256i[0], b_.m256i[0], 0x00);
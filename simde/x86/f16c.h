@@ -0,0 +1,205 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2020      Evan Nemerson <evan@nemerson.com>
+ */
+
+/* F16C half-precision conversions.
+ *
+ * Where there is no F16C (or NEON fp16) the conversions are done with
+ * 32-bit integer operations on all four lanes at once: each lane is
+ * converted as a normal number, a subnormal and an infinity/NaN, and
+ * the right result is selected with compare masks.  Subnormal halves
+ * are exactly representable as floats, so widening never rounds; for
+ * narrowing the rounding direction only changes the increment added
+ * before the extra mantissa bits are shifted out, and which overflow
+ * value (infinity or the largest finite half) is produced. */
+
+#if !defined(SIMDE_X86_F16C_H)
+#define SIMDE_X86_F16C_H
+
+#include "avx.h"
+
+#if !defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtph_ps (simde__m128i a) {
+  #if defined(SIMDE_X86_F16C_NATIVE)
+    return _mm_cvtph_ps(a);
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return simde__m128_from_neon_f32(vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(simde__m128i_to_neon_u16(a)))));
+  #else
+    const simde__m128i h = simde_mm_unpacklo_epi16(a, simde_mm_setzero_si128());
+    const simde__m128i x = simde_mm_and_si128(h, simde_mm_set1_epi32(0x7fff));
+    const simde__m128i e = simde_mm_slli_epi32(x, 13);
+    const simde__m128i bias = simde_mm_set1_epi32(112 << 23);
+    simde__m128i n, d;
+
+    /* Normal, infinity and NaN: rebias the exponent (twice for an
+     * all-ones exponent) and set the quiet bit of NaNs. */
+    n = simde_mm_add_epi32(e, bias);
+    n = simde_mm_add_epi32(n, simde_mm_and_si128(simde_mm_cmpgt_epi32(x, simde_mm_set1_epi32(0x7bff)), bias));
+    n = simde_mm_or_si128(n, simde_mm_and_si128(simde_mm_cmpgt_epi32(x, simde_mm_set1_epi32(0x7c00)), simde_mm_set1_epi32(0x400000)));
+
+    /* Subnormal: 2^-14 * (1 + m/1024) - 2^-14. */
+    d = simde_mm_castps_si128(
+      simde_mm_sub_ps(
+        simde_mm_castsi128_ps(simde_mm_add_epi32(e, simde_mm_set1_epi32(113 << 23))),
+        simde_mm_set1_ps(SIMDE_FLOAT32_C(0.00006103515625))));
+
+    n = simde_x_mm_select_si128(n, d, simde_mm_cmplt_epi32(x, simde_mm_set1_epi32(0x400)));
+    return simde_mm_castsi128_ps(simde_mm_or_si128(n, simde_mm_slli_epi32(simde_mm_xor_si128(h, x), 16)));
+  #endif
+}
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtph_ps
+  #define _mm_cvtph_ps(a) simde_mm_cvtph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtph_ps (simde__m128i a) {
+  #if defined(SIMDE_X86_F16C_NATIVE)
+    return _mm256_cvtph_ps(a);
+  #else
+    return simde_mm256_set_m128(simde_mm_cvtph_ps(simde_mm_unpackhi_epi64(a, a)), simde_mm_cvtph_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtph_ps
+  #define _mm256_cvtph_ps(a) simde_mm256_cvtph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtps_ph (simde__m128 a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    /* FCVTN rounds according to FPCR, which we assume is the default. */
+    if ((imm8 & SIMDE_MM_FROUND_CUR_DIRECTION) || ((imm8 & 3) == SIMDE_MM_FROUND_TO_NEAREST_INT)) {
+      return simde__m128i_from_neon_u16(
+        vcombine_u16(vreinterpret_u16_f16(vcvt_f16_f32(simde__m128_to_neon_f32(a))), vdup_n_u16(0)));
+    }
+  #endif
+
+  const simde__m128i u = simde_mm_castps_si128(a);
+  const simde__m128i sign = simde_mm_and_si128(u, simde_mm_set1_epi32(INT32_MIN));
+  const simde__m128i x = simde_mm_xor_si128(u, sign);
+  const simde__m128i neg = simde_mm_srai_epi32(u, 31);
+  const simde__m128i zero = simde_mm_setzero_si128();
+  const unsigned int mode = (imm8 & SIMDE_MM_FROUND_CUR_DIRECTION) ? (SIMDE_MM_GET_ROUNDING_MODE() >> 13) : HEDLEY_STATIC_CAST(unsigned int, imm8 & 3);
+  simde__m128i inc, up, n, d, s;
+
+  /* The subnormal result is |a| * 2^24 (exact) rounded to an integer.
+   * Rounding the truncated value up by hand instead of using
+   * round_ps keeps this cheap without SSE4.1 and independent of
+   * MXCSR. */
+  const simde__m128 v = simde_mm_mul_ps(simde_mm_castsi128_ps(x), simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0)));
+  const simde__m128i t = simde_mm_cvttps_epi32(v);
+  const simde__m128 f = simde_mm_sub_ps(v, simde_mm_cvtepi32_ps(t));
+  const simde__m128i inexact = simde_mm_castps_si128(simde_mm_cmpgt_ps(f, simde_mm_setzero_ps()));
+
+  /* The increment added before dropping the low 13 mantissa bits of
+   * a normal result, and whether to round the subnormal one up. */
+  switch (mode) {
+    case SIMDE_MM_FROUND_TO_NEG_INF:
+      inc = simde_mm_and_si128(neg, simde_mm_set1_epi32(0x1fff));
+      up = simde_mm_and_si128(neg, inexact);
+      break;
+    case SIMDE_MM_FROUND_TO_POS_INF:
+      inc = simde_mm_andnot_si128(neg, simde_mm_set1_epi32(0x1fff));
+      up = simde_mm_andnot_si128(neg, inexact);
+      break;
+    case SIMDE_MM_FROUND_TO_ZERO:
+      inc = zero;
+      up = zero;
+      break;
+    default:
+      inc = simde_mm_add_epi32(simde_mm_set1_epi32(0xfff), simde_mm_and_si128(simde_mm_srli_epi32(x, 13), simde_mm_set1_epi32(1)));
+      up = simde_mm_castps_si128(simde_mm_or_ps(
+        simde_mm_cmpgt_ps(f, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5))),
+        simde_mm_and_ps(
+          simde_mm_cmpeq_ps(f, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5))),
+          simde_mm_castsi128_ps(simde_mm_slli_epi32(t, 31)))));
+      up = simde_mm_srai_epi32(up, 31);
+      break;
+  }
+
+  /* Normal.  A carry out of the mantissa bumps the exponent; once it
+   * reaches the infinity encoding the result is infinity if we were
+   * rounding away from zero and the largest finite half otherwise. */
+  n = simde_mm_srli_epi32(simde_mm_add_epi32(simde_mm_sub_epi32(x, simde_mm_set1_epi32(112 << 23)), inc), 13);
+  n = simde_x_mm_select_si128(
+    n,
+    simde_mm_add_epi32(simde_mm_set1_epi32(0x7c00), simde_mm_cmpeq_epi32(inc, zero)),
+    simde_mm_cmpgt_epi32(n, simde_mm_set1_epi32(0x7bff)));
+
+  d = simde_mm_sub_epi32(t, up);
+  n = simde_x_mm_select_si128(n, d, simde_mm_cmplt_epi32(x, simde_mm_set1_epi32(113 << 23)));
+
+  /* Infinity, or a quiet NaN keeping the top of the payload. */
+  s = simde_mm_or_si128(
+    simde_mm_set1_epi32(0x7c00),
+    simde_mm_and_si128(
+      simde_mm_cmpgt_epi32(x, simde_mm_set1_epi32(0x7f800000)),
+      simde_mm_or_si128(simde_mm_set1_epi32(0x200), simde_mm_and_si128(simde_mm_srli_epi32(x, 13), simde_mm_set1_epi32(0x3ff)))));
+  n = simde_x_mm_select_si128(n, s, simde_mm_cmpgt_epi32(x, simde_mm_set1_epi32(0x7f7fffff)));
+
+  n = simde_mm_or_si128(n, simde_mm_srli_epi32(sign, 16));
+  return simde_mm_packs_epi32(simde_mm_srai_epi32(simde_mm_slli_epi32(n, 16), 16), zero);
+}
+#if defined(SIMDE_X86_F16C_NATIVE)
+  #define simde_mm_cvtps_ph(a, imm8) _mm_cvtps_ph(a, imm8)
+#endif
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtps_ph
+  #define _mm_cvtps_ph(a, imm8) simde_mm_cvtps_ph(a, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_cvtps_ph (simde__m256 a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_unpacklo_epi64(
+    simde_mm_cvtps_ph(simde_mm256_castps256_ps128(a), imm8),
+    simde_mm_cvtps_ph(simde_mm256_extractf128_ps(a, 1), imm8));
+}
+#if defined(SIMDE_X86_F16C_NATIVE)
+  #define simde_mm256_cvtps_ph(a, imm8) _mm256_cvtps_ph(a, imm8)
+#endif
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtps_ph
+  #define _mm256_cvtps_ph(a, imm8) simde_mm256_cvtps_ph(a, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_F16C_H) */
@@ -0,0 +1,353 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* The x86 SHA extensions keep the first word of the state or message
+ * in the highest lane, while the AArch64 SHA instructions keep it in
+ * the lowest, so most of the NEON implementations reverse the lanes on
+ * the way in and out.  AArch64 has no two-round SHA-256 instruction,
+ * so simde_mm_sha256rnds2_epu32 always uses the portable version
+ * there. */
+
+#if !defined(SIMDE_X86_SHA_H)
+#define SIMDE_X86_SHA_H
+
+#include "sse2.h"
+
+#if !defined(SIMDE_X86_SHA_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
+#  define SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+  #define SIMDE_X_SHA_NEON_
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  uint32x4_t
+  simde_x_sha_neon_rev_(uint32x4_t v) {
+    v = vrev64q_u32(v);
+    return vextq_u32(v, v, 2);
+  }
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rol_(uint32_t v, int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_ror_(uint32_t v, int n) {
+  return (v >> n) | (v << (32 - n));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha256_sigma0_(uint32_t v) {
+  return simde_x_sha_ror_(v, 7) ^ simde_x_sha_ror_(v, 18) ^ (v >> 3);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha256_sigma1_(uint32_t v) {
+  return simde_x_sha_ror_(v, 17) ^ simde_x_sha_ror_(v, 19) ^ (v >> 10);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg1_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_X_SHA_NEON_)
+      r_.neon_u32 = simde_x_sha_neon_rev_(vsha1su0q_u32(simde_x_sha_neon_rev_(a_.neon_u32), simde_x_sha_neon_rev_(b_.neon_u32), vdupq_n_u32(0)));
+    #elif defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.u32 = a_.u32 ^ SIMDE_SHUFFLE_VECTOR_(32, 16, b_.u32, a_.u32, 2, 3, 4, 5);
+    #else
+      r_.u32[0] = a_.u32[0] ^ b_.u32[2];
+      r_.u32[1] = a_.u32[1] ^ b_.u32[3];
+      r_.u32[2] = a_.u32[2] ^ a_.u32[0];
+      r_.u32[3] = a_.u32[3] ^ a_.u32[1];
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1msg1_epu32
+  #define _mm_sha1msg1_epu32(a, b) simde_mm_sha1msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg2_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_X_SHA_NEON_)
+      r_.neon_u32 = simde_x_sha_neon_rev_(vsha1su1q_u32(simde_x_sha_neon_rev_(a_.neon_u32), simde_x_sha_neon_rev_(b_.neon_u32)));
+    #else
+      r_.u32[3] = simde_x_sha_rol_(a_.u32[3] ^ b_.u32[2], 1);
+      r_.u32[2] = simde_x_sha_rol_(a_.u32[2] ^ b_.u32[1], 1);
+      r_.u32[1] = simde_x_sha_rol_(a_.u32[1] ^ b_.u32[0], 1);
+      r_.u32[0] = simde_x_sha_rol_(a_.u32[0] ^ r_.u32[3], 1);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1msg2_epu32
+  #define _mm_sha1msg2_epu32(a, b) simde_mm_sha1msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1nexte_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1nexte_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(b),
+      a_ = simde__m128i_to_private(a);
+
+    #if defined(SIMDE_X_SHA_NEON_)
+      r_.neon_u32 = vsetq_lane_u32(vgetq_lane_u32(r_.neon_u32, 3) + vsha1h_u32(vgetq_lane_u32(a_.neon_u32, 3)), r_.neon_u32, 3);
+    #else
+      r_.u32[3] += simde_x_sha_rol_(a_.u32[3], 30);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1nexte_epu32
+  #define _mm_sha1nexte_epu32(a, b) simde_mm_sha1nexte_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1rnds4_epu32 (simde__m128i a, simde__m128i b, const int func)
+    SIMDE_REQUIRE_CONSTANT_RANGE(func, 0, 3) {
+  static const uint32_t k[4] = {
+    UINT32_C(0x5A827999), UINT32_C(0x6ED9EBA1), UINT32_C(0x8F1BBCDC), UINT32_C(0xCA62C1D6)
+  };
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+
+  #if defined(SIMDE_X_SHA_NEON_)
+    const uint32x4_t abcd = simde_x_sha_neon_rev_(a_.neon_u32);
+    const uint32x4_t wk = vaddq_u32(simde_x_sha_neon_rev_(b_.neon_u32), vdupq_n_u32(k[func & 3]));
+
+    /* E was already added to the first word of the message. */
+    switch (func & 3) {
+      case 0:
+        r_.neon_u32 = vsha1cq_u32(abcd, 0, wk);
+        break;
+      case 2:
+        r_.neon_u32 = vsha1mq_u32(abcd, 0, wk);
+        break;
+      default:
+        r_.neon_u32 = vsha1pq_u32(abcd, 0, wk);
+        break;
+    }
+    r_.neon_u32 = simde_x_sha_neon_rev_(r_.neon_u32);
+  #else
+    uint32_t
+      A = a_.u32[3], B = a_.u32[2], C = a_.u32[1], D = a_.u32[0],
+      E = 0;
+
+    for (int i = 0 ; i < 4 ; i++) {
+      uint32_t f, t;
+
+      switch (func & 3) {
+        case 0:
+          f = (B & C) ^ (~B & D);
+          break;
+        case 2:
+          f = (B & C) ^ (B & D) ^ (C & D);
+          break;
+        default:
+          f = B ^ C ^ D;
+          break;
+      }
+
+      t = f + simde_x_sha_rol_(A, 5) + b_.u32[3 - i] + E + k[func & 3];
+      E = D;
+      D = C;
+      C = simde_x_sha_rol_(B, 30);
+      B = A;
+      A = t;
+    }
+
+    r_.u32[3] = A;
+    r_.u32[2] = B;
+    r_.u32[1] = C;
+    r_.u32[0] = D;
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_SHA_NATIVE)
+  #define simde_mm_sha1rnds4_epu32(a, b, func) _mm_sha1rnds4_epu32(a, b, func)
+#endif
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1rnds4_epu32
+  #define _mm_sha1rnds4_epu32(a, b, func) simde_mm_sha1rnds4_epu32(a, b, func)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg1_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_X_SHA_NEON_)
+      r_.neon_u32 = vsha256su0q_u32(a_.neon_u32, b_.neon_u32);
+    #elif defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(r_.u32) t = SIMDE_SHUFFLE_VECTOR_(32, 16, a_.u32, b_.u32, 1, 2, 3, 4);
+      r_.u32 =
+        a_.u32 +
+        (((t >>  7) | (t << 25)) ^
+         ((t >> 18) | (t << 14)) ^
+          (t >>  3));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = a_.u32[i] + simde_x_sha256_sigma0_((i < 3) ? a_.u32[i + 1] : b_.u32[0]);
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256msg1_epu32
+  #define _mm_sha256msg1_epu32(a, b) simde_mm_sha256msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg2_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_X_SHA_NEON_)
+      /* SHA256SU1 also adds W[t-7], taken from its second argument and
+       * the first lane of the third; pass zero and cancel the lane. */
+      const uint32x4_t w12 = vsetq_lane_u32(vgetq_lane_u32(b_.neon_u32, 0), vdupq_n_u32(0), 3);
+      r_.neon_u32 = vsha256su1q_u32(vsubq_u32(a_.neon_u32, w12), vdupq_n_u32(0), b_.neon_u32);
+    #else
+      r_.u32[0] = a_.u32[0] + simde_x_sha256_sigma1_(b_.u32[2]);
+      r_.u32[1] = a_.u32[1] + simde_x_sha256_sigma1_(b_.u32[3]);
+      r_.u32[2] = a_.u32[2] + simde_x_sha256_sigma1_(r_.u32[0]);
+      r_.u32[3] = a_.u32[3] + simde_x_sha256_sigma1_(r_.u32[1]);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256msg2_epu32
+  #define _mm_sha256msg2_epu32(a, b) simde_mm_sha256msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256rnds2_epu32 (simde__m128i a, simde__m128i b, simde__m128i k) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256rnds2_epu32(a, b, k);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      k_ = simde__m128i_to_private(k);
+    uint32_t
+      A = b_.u32[3], B = b_.u32[2], C = a_.u32[3], D = a_.u32[2],
+      E = b_.u32[1], F = b_.u32[0], G = a_.u32[1], H = a_.u32[0];
+
+    for (size_t i = 0 ; i < 2 ; i++) {
+      const uint32_t
+        t1 =
+          H +
+          (simde_x_sha_ror_(E, 6) ^ simde_x_sha_ror_(E, 11) ^ simde_x_sha_ror_(E, 25)) +
+          ((E & F) ^ (~E & G)) +
+          k_.u32[i],
+        t2 =
+          (simde_x_sha_ror_(A, 2) ^ simde_x_sha_ror_(A, 13) ^ simde_x_sha_ror_(A, 22)) +
+          ((A & B) ^ (A & C) ^ (B & C));
+
+      H = G;
+      G = F;
+      F = E;
+      E = D + t1;
+      D = C;
+      C = B;
+      B = A;
+      A = t1 + t2;
+    }
+
+    r_.u32[3] = A;
+    r_.u32[2] = B;
+    r_.u32[1] = E;
+    r_.u32[0] = F;
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256rnds2_epu32
+  #define _mm_sha256rnds2_epu32(a, b, k) simde_mm_sha256rnds2_epu32(a, b, k)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_SHA_H) */
@@ -398,7 +398,7 @@ SIMDE_MM_GET_ROUNDING_MODE(void) {
 
       #if defined(FE_TOWARDZERO)
         case FE_TOWARDZERO:
-          vfe_mode = SIMDE_MM_ROUND_DOWN;
+          vfe_mode = SIMDE_MM_ROUND_TOWARD_ZERO;
           break;
       #endif
 
@@ -410,7 +410,7 @@ SIMDE_MM_GET_ROUNDING_MODE(void) {
 
       #if defined(FE_DOWNWARD)
         case FE_DOWNWARD:
-          vfe_mode = SIMDE_MM_ROUND_TOWARD_ZERO;
+          vfe_mode = SIMDE_MM_ROUND_DOWN;
           break;
       #endif
 
@@ -61,6 +61,365 @@ SIMDE_BEGIN_DECLS_
 #  define SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES
 #endif
 
+/* Unless SIMDE_ACCURACY_PREFERENCE asks for libm-quality results, the
+ * portable versions of exp, log, sin, cos, sincos, tan, atan, pow and
+ * erf use range reduction plus polynomial approximations built from
+ * SIMDe's own 128-bit operations instead of calling libm on each lane;
+ * the 256- and 512-bit versions run the same kernels on each 128-bit
+ * chunk.  Results are within 4 ULP (see the *_ulp tests in
+ * test/x86/svml.c), comparable to SLEEF's u35 functions.  Set
+ * SIMDE_ACCURACY_PREFERENCE to 2 to call libm instead. */
+#if !defined(SIMDE_X86_SVML_NATIVE) && (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+  #define SIMDE_X_SVML_POLY_
+#endif
+
+#if defined(SIMDE_X_SVML_POLY_)
+
+/* a * b + c for the polynomial kernels.  simde_mm_fmadd_ps/pd emulate
+ * the fused operation with fmaf()/fma() on each lane, which is much
+ * slower than the kernels themselves; none of them need the single
+ * rounding, so use a separate multiply and add unless FMA is native. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_fmadd_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return _mm_fmadd_ps(a, b, c);
+  #else
+    return simde_mm_add_ps(simde_mm_mul_ps(a, b), c);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_fmadd_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return _mm_fmadd_pd(a, b, c);
+  #else
+    return simde_mm_add_pd(simde_mm_mul_pd(a, b), c);
+  #endif
+}
+
+/* 2^n for integer n in [-126, 127] (ps) or [-1022, 1023] (pd); for the
+ * pd version n is in the low two 32-bit lanes, as produced by
+ * _mm_cvtpd_epi32. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_pow2n_ps (simde__m128i n) {
+  return simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_add_epi32(n, simde_mm_set1_epi32(127)), 23));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_pow2n_pd (simde__m128i n) {
+  n = simde_mm_shuffle_epi32(n, SIMDE_MM_SHUFFLE(1, 1, 0, 0));
+  return simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_add_epi32(n, simde_mm_set1_epi32(1023)), 52));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_exp_ps (simde__m128 a) {
+  /* exp(a) = 2^n * exp(r), a = n * ln(2) + r, |r| <= ln(2) / 2.  The
+   * reduction uses a two-part ln(2) and the polynomial is the one from
+   * Cephes' expf.  2^n is applied in two steps so that subnormal
+   * results are still generated. */
+  simde__m128 x, fn, p, z;
+  simde__m128i n, n1;
+
+  x = simde_mm_min_ps(simde_mm_max_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-104.0))), simde_mm_set1_ps(SIMDE_FLOAT32_C(89.0)));
+
+  fn = simde_mm_mul_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.44269504088896341)));
+  n = simde_mm_cvttps_epi32(simde_mm_add_ps(fn, simde_x_mm_copysign_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), fn)));
+  fn = simde_mm_cvtepi32_ps(n);
+
+  x = simde_mm_sub_ps(x, simde_mm_mul_ps(fn, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375))));
+  x = simde_mm_sub_ps(x, simde_mm_mul_ps(fn, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4))));
+  z = simde_mm_mul_ps(x, x);
+
+  p = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+  p = simde_x_mm_svml_fmadd_ps(p, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+  p = simde_x_mm_svml_fmadd_ps(p, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+  p = simde_x_mm_svml_fmadd_ps(p, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+  p = simde_x_mm_svml_fmadd_ps(p, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+  p = simde_x_mm_svml_fmadd_ps(p, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+  p = simde_mm_add_ps(simde_x_mm_svml_fmadd_ps(p, z, x), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+  n1 = simde_mm_srai_epi32(n, 1);
+  p = simde_mm_mul_ps(p, simde_x_mm_svml_pow2n_ps(n1));
+  p = simde_mm_mul_ps(p, simde_x_mm_svml_pow2n_ps(simde_mm_sub_epi32(n, n1)));
+
+  return simde_x_mm_select_ps(p, a, simde_mm_cmpunord_ps(a, a));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_exp_pd (simde__m128d a) {
+  /* Same reduction as the ps version, with fdlibm's exp polynomial
+   * for exp(r) = 1 + 2r / (R(r) - r). */
+  simde__m128d x, fn, hi, lo, t, c, y;
+  simde__m128i n, n1;
+
+  x = simde_mm_min_pd(simde_mm_max_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-746.0))), simde_mm_set1_pd(SIMDE_FLOAT64_C(710.0)));
+
+  fn = simde_mm_mul_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.44269504088896338700e+00)));
+  n = simde_mm_cvttpd_epi32(simde_mm_add_pd(fn, simde_x_mm_copysign_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), fn)));
+  fn = simde_mm_cvtepi32_pd(n);
+
+  hi = simde_mm_sub_pd(x, simde_mm_mul_pd(fn, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01))));
+  lo = simde_mm_mul_pd(fn, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)));
+  x = simde_mm_sub_pd(hi, lo);
+  t = simde_mm_mul_pd(x, x);
+
+  c = simde_mm_set1_pd(SIMDE_FLOAT64_C( 4.13813679705723846039e-08));
+  c = simde_x_mm_svml_fmadd_pd(c, t, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.65339022054652515390e-06)));
+  c = simde_x_mm_svml_fmadd_pd(c, t, simde_mm_set1_pd(SIMDE_FLOAT64_C( 6.61375632143793436117e-05)));
+  c = simde_x_mm_svml_fmadd_pd(c, t, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.77777777770155933842e-03)));
+  c = simde_x_mm_svml_fmadd_pd(c, t, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.66666666666666019037e-01)));
+  c = simde_mm_sub_pd(x, simde_mm_mul_pd(t, c));
+
+  /* y = 1 - ((lo - (x * c) / (2 - c)) - hi) */
+  y = simde_mm_div_pd(simde_mm_mul_pd(x, c), simde_mm_sub_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)), c));
+  y = simde_mm_sub_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), simde_mm_sub_pd(simde_mm_sub_pd(lo, y), hi));
+
+  n1 = simde_mm_srai_epi32(n, 1);
+  y = simde_mm_mul_pd(y, simde_x_mm_svml_pow2n_pd(n1));
+  y = simde_mm_mul_pd(y, simde_x_mm_svml_pow2n_pd(simde_mm_sub_epi32(n, n1)));
+
+  return simde_x_mm_select_pd(y, a, simde_mm_cmpunord_pd(a, a));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_log_ps (simde__m128 a) {
+  /* a = 2^e * m with m in [sqrt(0.5), sqrt(2)), then Cephes' logf
+   * polynomial for log(m). */
+  simde__m128 x, m, fe, z, y, mask;
+  simde__m128i bits, e;
+
+  mask = simde_mm_cmplt_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.17549435e-38)));
+  x = simde_x_mm_select_ps(a, simde_mm_mul_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(8388608.0))), mask);
+  bits = simde_mm_castps_si128(x);
+
+  e = simde_mm_sub_epi32(simde_mm_srli_epi32(bits, 23), simde_mm_set1_epi32(126));
+  e = simde_mm_sub_epi32(e, simde_mm_and_si128(simde_mm_castps_si128(mask), simde_mm_set1_epi32(23)));
+  m = simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi32(0x007fffff)), simde_mm_set1_epi32(0x3f000000)));
+
+  /* if (m < sqrt(0.5)) { e -= 1; x = m + m - 1; } else { x = m - 1; } */
+  mask = simde_mm_cmplt_ps(m, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524)));
+  e = simde_mm_add_epi32(e, simde_mm_castps_si128(mask));
+  x = simde_mm_add_ps(simde_mm_sub_ps(m, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))), simde_mm_and_ps(mask, m));
+  fe = simde_mm_cvtepi32_ps(e);
+  z = simde_mm_mul_ps(x, x);
+
+  y = simde_mm_set1_ps(SIMDE_FLOAT32_C( 7.0376836292e-2));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.1676998740e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.4249322787e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C( 2.0000714765e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+  y = simde_x_mm_svml_fmadd_ps(y, x, simde_mm_set1_ps(SIMDE_FLOAT32_C( 3.3333331174e-1)));
+  y = simde_mm_mul_ps(simde_mm_mul_ps(y, x), z);
+
+  y = simde_x_mm_svml_fmadd_ps(fe, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), y);
+  y = simde_x_mm_svml_fmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.5)), y);
+  x = simde_mm_add_ps(x, y);
+  x = simde_x_mm_svml_fmadd_ps(fe, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375)), x);
+
+  /* log(0) = -inf, log(inf) = inf, log(x < 0) = NaN, log(NaN) = NaN */
+  x = simde_x_mm_select_ps(x, simde_mm_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm_cmpeq_ps(a, simde_mm_setzero_ps()));
+  x = simde_x_mm_select_ps(x, simde_mm_set1_ps(SIMDE_MATH_INFINITYF), simde_mm_cmpeq_ps(a, simde_mm_set1_ps(SIMDE_MATH_INFINITYF)));
+  x = simde_x_mm_select_ps(x, simde_mm_set1_ps(SIMDE_MATH_NANF), simde_mm_cmplt_ps(a, simde_mm_setzero_ps()));
+  return simde_x_mm_select_ps(x, a, simde_mm_cmpunord_ps(a, a));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_log_pd (simde__m128d a) {
+  /* a = 2^k * (1 + f) with 1 + f in [sqrt(0.5), sqrt(2)), then
+   * log(1 + f) = f - (hfsq - s * (hfsq + R(s * s))) with s = f / (2 + f)
+   * and R from fdlibm's log. */
+  simde__m128d x, m, f, dk, s, z, r, hfsq, mask;
+  simde__m128i bits, k;
+
+  mask = simde_mm_cmplt_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072014e-308)));
+  x = simde_x_mm_select_pd(a, simde_mm_mul_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), mask);
+  bits = simde_mm_castpd_si128(x);
+
+  k = simde_mm_shuffle_epi32(simde_mm_srli_epi64(bits, 52), SIMDE_MM_SHUFFLE(2, 0, 2, 0));
+  dk = simde_mm_cvtepi32_pd(simde_mm_sub_epi32(k, simde_mm_set1_epi32(1022)));
+  dk = simde_mm_sub_pd(dk, simde_mm_and_pd(mask, simde_mm_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm_castsi128_pd(
+    simde_mm_or_si128(
+      simde_mm_and_si128(bits, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff))),
+      simde_mm_set1_epi64x(INT64_C(0x3fe0000000000000))));
+
+  mask = simde_mm_cmplt_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524)));
+  dk = simde_mm_sub_pd(dk, simde_mm_and_pd(mask, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+  f = simde_mm_add_pd(simde_mm_sub_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))), simde_mm_and_pd(mask, m));
+
+  hfsq = simde_mm_mul_pd(simde_mm_mul_pd(f, f), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  s = simde_mm_div_pd(f, simde_mm_add_pd(f, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0))));
+  z = simde_mm_mul_pd(s, s);
+
+  r = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.479819860511658591e-01));
+  r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.531383769920937332e-01)));
+  r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.818357216161805012e-01)));
+  r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.222219843214978396e-01)));
+  r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.857142874366239149e-01)));
+  r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.999999999940941908e-01)));
+  r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.666666666666735130e-01)));
+  r = simde_mm_mul_pd(r, z);
+
+  /* k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f) */
+  r = simde_x_mm_svml_fmadd_pd(s, simde_mm_add_pd(hfsq, r), simde_mm_mul_pd(dk, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10))));
+  r = simde_mm_sub_pd(simde_mm_sub_pd(hfsq, r), f);
+  r = simde_mm_sub_pd(simde_mm_mul_pd(dk, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01))), r);
+
+  r = simde_x_mm_select_pd(r, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), simde_mm_cmpeq_pd(a, simde_mm_setzero_pd()));
+  r = simde_x_mm_select_pd(r, simde_mm_set1_pd(SIMDE_MATH_INFINITY), simde_mm_cmpeq_pd(a, simde_mm_set1_pd(SIMDE_MATH_INFINITY)));
+  r = simde_x_mm_select_pd(r, simde_mm_set1_pd(SIMDE_MATH_NAN), simde_mm_cmplt_pd(a, simde_mm_setzero_pd()));
+  return simde_x_mm_select_pd(r, a, simde_mm_cmpunord_pd(a, a));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_sincos_ps (simde__m128* cos_out, simde__m128 a) {
+  /* a = n * pi/2 + r, |r| <= pi/4.  pi/2 is split into pieces short
+   * enough that n * piece is exact for |a| <= 8192; larger, infinite,
+   * and NaN lanes are handed to libm.  sin(r) and cos(r) use Cephes'
+   * sinf/cosf polynomials and are swapped/negated based on n & 3. */
+  simde__m128 x, fn, z, ps, pc, s, c, swap;
+  simde__m128i n;
+
+  fn = simde_mm_mul_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343)));
+  n = simde_mm_cvttps_epi32(simde_mm_add_ps(fn, simde_x_mm_copysign_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), fn)));
+  fn = simde_mm_cvtepi32_ps(n);
+
+  x = simde_mm_sub_ps(a, simde_mm_mul_ps(fn, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.5703125))));
+  x = simde_mm_sub_ps(x, simde_mm_mul_ps(fn, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4))));
+  x = simde_mm_sub_ps(x, simde_mm_mul_ps(fn, simde_mm_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271728515625e-8))));
+  x = simde_mm_sub_ps(x, simde_mm_mul_ps(fn, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.5633440683e-12))));
+  z = simde_mm_mul_ps(x, x);
+
+  ps = simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+  ps = simde_x_mm_svml_fmadd_ps(ps, z, simde_mm_set1_ps(SIMDE_FLOAT32_C( 8.3321608736e-3)));
+  ps = simde_x_mm_svml_fmadd_ps(ps, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+  ps = simde_x_mm_svml_fmadd_ps(simde_mm_mul_ps(ps, z), x, x);
+
+  pc = simde_mm_set1_ps(SIMDE_FLOAT32_C( 2.443315711809948e-5));
+  pc = simde_x_mm_svml_fmadd_ps(pc, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+  pc = simde_x_mm_svml_fmadd_ps(pc, z, simde_mm_set1_ps(SIMDE_FLOAT32_C( 4.166664568298827e-2)));
+  pc = simde_mm_mul_ps(simde_mm_mul_ps(pc, z), z);
+  pc = simde_mm_add_ps(simde_x_mm_svml_fmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.5)), pc), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+  /* n & 1: swap sin and cos; n & 2: negate sin; (n + 1) & 2: negate cos */
+  swap = simde_mm_castsi128_ps(simde_mm_cmpeq_epi32(simde_mm_and_si128(n, simde_mm_set1_epi32(1)), simde_mm_set1_epi32(1)));
+  s = simde_x_mm_select_ps(ps, pc, swap);
+  c = simde_x_mm_select_ps(pc, ps, swap);
+  s = simde_mm_xor_ps(s, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_and_si128(n, simde_mm_set1_epi32(2)), 30)));
+  n = simde_mm_add_epi32(n, simde_mm_set1_epi32(1));
+  c = simde_mm_xor_ps(c, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_and_si128(n, simde_mm_set1_epi32(2)), 30)));
+
+  {
+    simde__m128 large = simde_mm_cmpnle_ps(simde_x_mm_abs_ps(a), simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)));
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(large) != 0)) {
+      simde__m128_private
+        s_ = simde__m128_to_private(s),
+        c_ = simde__m128_to_private(c),
+        a_ = simde__m128_to_private(a),
+        large_ = simde__m128_to_private(large);
+
+      for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+        if (large_.i32[i]) {
+          s_.f32[i] = simde_math_sinf(a_.f32[i]);
+          c_.f32[i] = simde_math_cosf(a_.f32[i]);
+        }
+      }
+
+      s = simde__m128_from_private(s_);
+      c = simde__m128_from_private(c_);
+    }
+  }
+
+  *cos_out = c;
+  return s;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_sincos_pd (simde__m128d* cos_out, simde__m128d a) {
+  /* Same as the ps version with fdlibm's three-part pi/2 (exact
+   * products for |a| <= 2^20) and its __kernel_sin/__kernel_cos
+   * polynomials. */
+  simde__m128d x, fn, z, ps, pc, w, s, c, swap;
+  simde__m128i n;
+
+  fn = simde_mm_mul_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.36619772367581382433e-01)));
+  n = simde_mm_cvttpd_epi32(simde_mm_add_pd(fn, simde_x_mm_copysign_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), fn)));
+  fn = simde_mm_cvtepi32_pd(n);
+
+  x = simde_mm_sub_pd(a, simde_mm_mul_pd(fn, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.57079632673412561417e+00))));
+  x = simde_mm_sub_pd(x, simde_mm_mul_pd(fn, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.07710050630396597660e-11))));
+  x = simde_mm_sub_pd(x, simde_mm_mul_pd(fn, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.02226624879595063154e-21))));
+  z = simde_mm_mul_pd(x, x);
+
+  ps = simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.58969099521155010221e-10));
+  ps = simde_x_mm_svml_fmadd_pd(ps, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.50507602534068634195e-08)));
+  ps = simde_x_mm_svml_fmadd_pd(ps, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.75573137070700676789e-06)));
+  ps = simde_x_mm_svml_fmadd_pd(ps, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.98412698298579493134e-04)));
+  ps = simde_x_mm_svml_fmadd_pd(ps, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 8.33333333332248946124e-03)));
+  ps = simde_x_mm_svml_fmadd_pd(ps, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666324348e-01)));
+  ps = simde_x_mm_svml_fmadd_pd(simde_mm_mul_pd(ps, z), x, x);
+
+  pc = simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.13596475577881948265e-11));
+  pc = simde_x_mm_svml_fmadd_pd(pc, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.08757232129817482790e-09)));
+  pc = simde_x_mm_svml_fmadd_pd(pc, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.75573143513906633035e-07)));
+  pc = simde_x_mm_svml_fmadd_pd(pc, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.48015872894767294178e-05)));
+  pc = simde_x_mm_svml_fmadd_pd(pc, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.38888888888741095749e-03)));
+  pc = simde_x_mm_svml_fmadd_pd(pc, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 4.16666666666666019037e-02)));
+  pc = simde_mm_mul_pd(simde_mm_mul_pd(pc, z), z);
+
+  /* w = 1 - z/2; cos = w + (((1 - w) - z/2) + z * z * C(z)) */
+  z = simde_mm_mul_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  w = simde_mm_sub_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), z);
+  pc = simde_mm_add_pd(w, simde_mm_add_pd(simde_mm_sub_pd(simde_mm_sub_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), w), z), pc));
+
+  n = simde_mm_shuffle_epi32(n, SIMDE_MM_SHUFFLE(1, 1, 0, 0));
+  swap = simde_mm_castsi128_pd(simde_mm_cmpeq_epi32(simde_mm_and_si128(n, simde_mm_set1_epi32(1)), simde_mm_set1_epi32(1)));
+  s = simde_x_mm_select_pd(ps, pc, swap);
+  c = simde_x_mm_select_pd(pc, ps, swap);
+  s = simde_mm_xor_pd(s, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_and_si128(n, simde_mm_set1_epi32(2)), 62)));
+  n = simde_mm_add_epi32(n, simde_mm_set1_epi32(1));
+  c = simde_mm_xor_pd(c, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_and_si128(n, simde_mm_set1_epi32(2)), 62)));
+
+  {
+    simde__m128d large = simde_mm_cmpnle_pd(simde_x_mm_abs_pd(a), simde_mm_set1_pd(SIMDE_FLOAT64_C(1048576.0)));
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(large) != 0)) {
+      simde__m128d_private
+        s_ = simde__m128d_to_private(s),
+        c_ = simde__m128d_to_private(c),
+        a_ = simde__m128d_to_private(a),
+        large_ = simde__m128d_to_private(large);
+
+      for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+        if (large_.i64[i]) {
+          s_.f64[i] = simde_math_sin(a_.f64[i]);
+          c_.f64[i] = simde_math_cos(a_.f64[i]);
+        }
+      }
+
+      s = simde__m128d_from_private(s_);
+      c = simde__m128d_from_private(c_);
+    }
+  }
+
+  *cos_out = c;
+  return s;
+}
+
+#endif /* defined(SIMDE_X_SVML_POLY_) */
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
 simde_mm_acos_ps (simde__m128 a) {
@@ -932,6 +1291,29 @@ simde_mm_atan_ps (simde__m128 a) {
     #else
       return Sleef_atanf4_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    /* Cephes' atanf: |a| is reduced to [0, tan(pi/8)] using
+     * atan(x) = pi/2 + atan(-1/x) and atan(x) = pi/4 + atan((x-1)/(x+1)). */
+    simde__m128 x, y, z, p, big, mid;
+
+    x = simde_x_mm_abs_ps(a);
+    big = simde_mm_cmpgt_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.414213562373095)));
+    mid = simde_mm_andnot_ps(big, simde_mm_cmpgt_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.4142135623730950))));
+
+    y = simde_mm_or_ps(
+      simde_mm_and_ps(big, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.57079632679489661923))),
+      simde_mm_and_ps(mid, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.78539816339744830962))));
+    x = simde_x_mm_select_ps(x, simde_mm_div_ps(simde_mm_sub_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))), simde_mm_add_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)))), mid);
+    x = simde_x_mm_select_ps(x, simde_mm_div_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.0)), x), big);
+    z = simde_mm_mul_ps(x, x);
+
+    p = simde_mm_set1_ps(SIMDE_FLOAT32_C( 8.05374449538e-2));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.38776856032e-1)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.99777106478e-1)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.33329491539e-1)));
+    p = simde_x_mm_svml_fmadd_ps(simde_mm_mul_ps(p, z), x, x);
+
+    return simde_x_mm_xorsign_ps(simde_mm_add_ps(y, p), a);
   #else
     simde__m128_private
       r_,
@@ -961,6 +1343,43 @@ simde_mm_atan_pd (simde__m128d a) {
     #else
       return Sleef_atand2_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    /* Cephes' atan: as in the ps version, but reducing to
+     * [0, 0.66] and using a rational approximation. */
+    simde__m128d x, y, z, p, q, big, mid;
+
+    x = simde_x_mm_abs_pd(a);
+    big = simde_mm_cmpgt_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.41421356237309504880)));
+    mid = simde_mm_andnot_pd(big, simde_mm_cmpgt_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.66))));
+
+    y = simde_mm_or_pd(
+      simde_mm_and_pd(big, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.57079632679489661923))),
+      simde_mm_and_pd(mid, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.78539816339744830962))));
+    x = simde_x_mm_select_pd(x, simde_mm_div_pd(simde_mm_sub_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))), simde_mm_add_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)))), mid);
+    x = simde_x_mm_select_pd(x, simde_mm_div_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.0)), x), big);
+    z = simde_mm_mul_pd(x, x);
+
+    p = simde_mm_set1_pd(SIMDE_FLOAT64_C(-8.750608600031904122785e-01));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.615753718733365076637e+01)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-7.500855792314704667340e+01)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.228866684490136173410e+02)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-6.485021904942025371773e+01)));
+
+    q = simde_mm_add_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.485846490142306297962e+01)));
+    q = simde_x_mm_svml_fmadd_pd(q, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.650270098316988542046e+02)));
+    q = simde_x_mm_svml_fmadd_pd(q, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 4.328810604912902668951e+02)));
+    q = simde_x_mm_svml_fmadd_pd(q, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 4.853903996359136964868e+02)));
+    q = simde_x_mm_svml_fmadd_pd(q, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.945506571482613964425e+02)));
+
+    z = simde_mm_div_pd(simde_mm_mul_pd(z, p), q);
+    z = simde_x_mm_svml_fmadd_pd(x, z, x);
+
+    /* Low bits of pi/2 and pi/4 */
+    z = simde_mm_add_pd(z, simde_mm_or_pd(
+      simde_mm_and_pd(big, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.123233995736765886130e-17))),
+      simde_mm_and_pd(mid, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.061616997868382943065e-17)))));
+
+    return simde_x_mm_xorsign_pd(simde_mm_add_pd(y, z), a);
   #else
     simde__m128d_private
       r_,
@@ -995,7 +1414,7 @@ simde_mm256_atan_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_atan_ps(a_.m128[i]);
       }
@@ -1031,7 +1450,7 @@ simde_mm256_atan_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_atan_pd(a_.m128d[i]);
       }
@@ -1066,7 +1485,7 @@ simde_mm512_atan_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_atan_ps(a_.m256[i]);
       }
@@ -1101,7 +1520,7 @@ simde_mm512_atan_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_atan_pd(a_.m256d[i]);
       }
@@ -1848,6 +2267,10 @@ simde_mm_cos_ps (simde__m128 a) {
     #else
       return Sleef_cosf4_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m128 c;
+    simde_x_mm_svml_sincos_ps(&c, a);
+    return c;
   #else
     simde__m128_private
       r_,
@@ -1877,6 +2300,10 @@ simde_mm_cos_pd (simde__m128d a) {
     #else
       return Sleef_cosd2_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m128d c;
+    simde_x_mm_svml_sincos_pd(&c, a);
+    return c;
   #else
     simde__m128d_private
       r_,
@@ -1911,7 +2338,7 @@ simde_mm256_cos_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_cos_ps(a_.m128[i]);
       }
@@ -1947,7 +2374,7 @@ simde_mm256_cos_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_cos_pd(a_.m128d[i]);
       }
@@ -1982,7 +2409,7 @@ simde_mm512_cos_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_cos_ps(a_.m256[i]);
       }
@@ -2017,7 +2444,7 @@ simde_mm512_cos_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_cos_pd(a_.m256d[i]);
       }
@@ -3511,6 +3938,46 @@ simde_mm_erf_ps (simde__m128 a) {
     return _mm_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_erff4_u10(a);
+  #elif defined(SIMDE_X_SVML_POLY_)
+    /* |a| <= 0.5: Taylor series x * P(x^2).  Above that erf = 1 - erfc,
+     * erfc(x) = exp(G(u) - x^2) where G is a Chebyshev fit of
+     * log(erfc(x)) + x^2 over [0.5, 4] in u = (4x - 9) / 7; erf(x)
+     * rounds to 1 past 4. */
+    simde__m128 x, z, u, p, g;
+
+    x = simde_x_mm_abs_ps(a);
+    z = simde_mm_mul_ps(x, x);
+
+    p = simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.205533298e-04));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-8.548327023e-04)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C( 5.223977625e-03)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.686617065e-02)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.128379167e-01)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.761263890e-01)));
+    p = simde_x_mm_svml_fmadd_ps(p, z, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.128379167e+00)));
+    p = simde_mm_mul_ps(p, x);
+
+    x = simde_mm_min_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.0)));
+    u = simde_x_mm_svml_fmadd_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.571428571428571429)), simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.28571428571428571)));
+    g = simde_mm_set1_ps(SIMDE_FLOAT32_C(-7.650029269e-06));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.998559319e-05)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.486358469e-05)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.029889106e-05)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.792137973e-04)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-8.291231488e-04)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C( 2.948321745e-03)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-9.108238260e-03)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C( 2.599207594e-02)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-7.134674143e-02)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C( 1.994680776e-01)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-6.700991755e-01)));
+    g = simde_x_mm_svml_fmadd_ps(g, u, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.464959896e+00)));
+    g = simde_x_mm_svml_exp_ps(simde_mm_fnmadd_ps(x, x, g));
+    g = simde_mm_sub_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), g);
+
+    p = simde_x_mm_select_ps(g, p, simde_mm_cmple_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.25))));
+    p = simde_x_mm_xorsign_ps(p, a);
+    return simde_x_mm_select_ps(p, a, simde_mm_cmpunord_ps(a, a));
   #else
     simde__m128_private
       r_,
@@ -3536,6 +4003,63 @@ simde_mm_erf_pd (simde__m128d a) {
     return _mm_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_erfd2_u10(a);
+  #elif defined(SIMDE_X_SVML_POLY_)
+    /* Same as the ps version; G is split at 2 into two fits over
+     * [0.5, 2] and [2, 6] which share the evaluation below, and erf(x)
+     * rounds to 1 past 6. */
+    simde__m128d x, z, u, p, g, hi;
+
+    x = simde_x_mm_abs_pd(a);
+    z = simde_mm_mul_pd(x, x);
+
+    p = simde_mm_set1_pd(SIMDE_FLOAT64_C( 9.42275906465041125e-11));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.22905553017179284e-09)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.48071928158792176e-08)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.63658446912349245e-07)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.64621143658892485e-06)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.49256503584062504e-05)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.20553329817896636e-04)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-8.54832702345085333e-04)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 5.22397762544218793e-03)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.68661706451312522e-02)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.12837916709551261e-01)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.76126389031837538e-01)));
+    p = simde_x_mm_svml_fmadd_pd(p, z, simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.12837916709551256e+00)));
+    p = simde_mm_mul_pd(p, x);
+
+    x = simde_mm_min_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.0)));
+    hi = simde_mm_cmpgt_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)));
+    u = simde_x_mm_svml_fmadd_pd(x,
+      simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.33333333333333333333)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 0.5)), hi),
+      simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666666667)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.0)), hi));
+    g = simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 6.17325938142354503e-16)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.27418781494243590e-12)), hi);
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.21033276153753477e-14)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.35381571368172603e-11)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 7.20480141275769813e-14)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.37256506025934183e-10)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.29215700685271628e-13)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-7.54376452137953387e-10)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.53866038233726308e-13)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.09033365134997208e-09)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 3.71126736844144315e-12)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.70791023242552473e-09)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.09808646697831609e-11)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.34307602694005553e-08)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.50245418461507667e-10)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.29634734624777199e-08)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.41133544996699786e-10)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 4.91391356130154034e-09)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.15184325438041152e-11)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.97901434105859537e-07)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.05939495412717474e-08)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.25176157173877818e-06)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-8.14157290232061109e-08)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 5.66709773053180238e-06)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 3.87927419856923766e-07)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.22438560220650374e-05)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.08431076541539080e-06)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 8.03496649203590876e-05)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.34040354210766577e-06)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.74731315831689316e-04)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 4.39222489591317564e-05)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 9.04884808171515175e-04)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.81336995803049797e-04)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.91281755157766966e-03)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 2.46542535366606631e-03)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 9.31437717803424402e-03)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.37898317879832453e-02)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.03451450870098859e-02)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C( 7.26692827169370392e-02)), simde_mm_set1_pd(SIMDE_FLOAT64_C( 1.06221645992001068e-01)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.25792956251929700e-01)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.72753785400352122e-01)), hi));
+    g = simde_x_mm_svml_fmadd_pd(g, u, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.00015366192212563e+00)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.98777831210300659e+00)), hi));
+    g = simde_x_mm_svml_exp_pd(simde_mm_fnmadd_pd(x, x, g));
+    g = simde_mm_sub_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), g);
+
+    p = simde_x_mm_select_pd(g, p, simde_mm_cmple_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.25))));
+    p = simde_x_mm_xorsign_pd(p, a);
+    return simde_x_mm_select_pd(p, a, simde_mm_cmpunord_pd(a, a));
   #else
     simde__m128d_private
       r_,
@@ -3566,7 +4090,7 @@ simde_mm256_erf_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_erf_ps(a_.m128[i]);
       }
@@ -3598,7 +4122,7 @@ simde_mm256_erf_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_erf_pd(a_.m128d[i]);
       }
@@ -3629,7 +4153,7 @@ simde_mm512_erf_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_erf_ps(a_.m256[i]);
       }
@@ -3660,7 +4184,7 @@ simde_mm512_erf_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_erf_pd(a_.m256d[i]);
       }
@@ -3917,6 +4441,8 @@ simde_mm_exp_ps (simde__m128 a) {
     return _mm_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expf4_u10(a);
+  #elif defined(SIMDE_X_SVML_POLY_)
+    return simde_x_mm_svml_exp_ps(a);
   #else
     simde__m128_private
       r_,
@@ -3942,6 +4468,8 @@ simde_mm_exp_pd (simde__m128d a) {
     return _mm_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expd2_u10(a);
+  #elif defined(SIMDE_X_SVML_POLY_)
+    return simde_x_mm_svml_exp_pd(a);
   #else
     simde__m128d_private
       r_,
@@ -3972,7 +4500,7 @@ simde_mm256_exp_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_exp_ps(a_.m128[i]);
       }
@@ -4004,7 +4532,7 @@ simde_mm256_exp_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_exp_pd(a_.m128d[i]);
       }
@@ -4035,7 +4563,7 @@ simde_mm512_exp_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_exp_ps(a_.m256[i]);
       }
@@ -4066,7 +4594,7 @@ simde_mm512_exp_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_exp_pd(a_.m256d[i]);
       }
@@ -5548,6 +6076,8 @@ simde_mm_log_ps (simde__m128 a) {
     #else
       return Sleef_logf4_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    return simde_x_mm_svml_log_ps(a);
   #else
     simde__m128_private
       r_,
@@ -5577,6 +6107,8 @@ simde_mm_log_pd (simde__m128d a) {
     #else
       return Sleef_logd2_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    return simde_x_mm_svml_log_pd(a);
   #else
     simde__m128d_private
       r_,
@@ -5611,7 +6143,7 @@ simde_mm256_log_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_log_ps(a_.m128[i]);
       }
@@ -5647,7 +6179,7 @@ simde_mm256_log_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_log_pd(a_.m128d[i]);
       }
@@ -5682,7 +6214,7 @@ simde_mm512_log_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_log_ps(a_.m256[i]);
       }
@@ -5717,7 +6249,7 @@ simde_mm512_log_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_log_pd(a_.m256d[i]);
       }
@@ -8621,6 +9153,32 @@ simde_mm_pow_ps (simde__m128 a, simde__m128 b) {
     return _mm_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_powf4_u10(a, b);
+  #elif defined(SIMDE_X_SVML_POLY_)
+    /* exp(b * log(|a|)) in double precision, then the sign and the
+     * special cases of powf are patched in. */
+    simde__m128 x, r, bh, bint, bodd, m;
+    simde__m128d lo, hi;
+
+    x = simde_x_mm_abs_ps(a);
+    lo = simde_mm_mul_pd(simde_mm_cvtps_pd(b), simde_x_mm_svml_log_pd(simde_mm_cvtps_pd(x)));
+    hi = simde_mm_mul_pd(simde_mm_cvtps_pd(simde_mm_movehl_ps(b, b)), simde_x_mm_svml_log_pd(simde_mm_cvtps_pd(simde_mm_movehl_ps(x, x))));
+    r = simde_mm_movelh_ps(simde_mm_cvtpd_ps(simde_x_mm_svml_exp_pd(lo)), simde_mm_cvtpd_ps(simde_x_mm_svml_exp_pd(hi)));
+
+    /* b is an integer if trunc(b) == b, and odd if b / 2 isn't. */
+    bint = simde_mm_cmpeq_ps(simde_mm_round_ps(b, SIMDE_MM_FROUND_TO_ZERO), b);
+    bh = simde_mm_mul_ps(b, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+    bodd = simde_mm_andnot_ps(simde_mm_cmpeq_ps(simde_mm_round_ps(bh, SIMDE_MM_FROUND_TO_ZERO), bh), bint);
+
+    /* a < 0 (or -0): the result is negative for odd b, and NaN for
+     * non-integer b unless a is -inf. */
+    r = simde_mm_or_ps(r, simde_mm_and_ps(bodd, simde_mm_and_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0)))));
+    m = simde_mm_and_ps(simde_mm_cmplt_ps(a, simde_mm_setzero_ps()), simde_mm_cmpgt_ps(a, simde_mm_set1_ps(-SIMDE_MATH_INFINITYF)));
+    r = simde_x_mm_select_ps(r, simde_mm_set1_ps(SIMDE_MATH_NANF), simde_mm_andnot_ps(bint, m));
+
+    /* pow(a, 0) = pow(1, b) = pow(-1, +/-inf) = 1, even for NaN */
+    m = simde_mm_or_ps(simde_mm_cmpeq_ps(b, simde_mm_setzero_ps()), simde_mm_cmpeq_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+    m = simde_mm_or_ps(m, simde_mm_and_ps(simde_mm_cmpeq_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.0))), simde_mm_cmpeq_ps(simde_x_mm_abs_ps(b), simde_mm_set1_ps(SIMDE_MATH_INFINITYF))));
+    return simde_x_mm_select_ps(r, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), m);
   #else
     simde__m128_private
       r_,
@@ -8647,6 +9205,105 @@ simde_mm_pow_pd (simde__m128d a, simde__m128d b) {
     return _mm_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_powd2_u10(a, b);
+  #elif defined(SIMDE_X_SVML_POLY_)
+    /* exp(b * log(|a|)) needs log(|a|) with more than double precision
+     * or the error grows with |b * log(a)|, so log(|a|) = k * ln(2) +
+     * log(1 + f) is carried as a double-double (lh + ll), using
+     * log(1 + f) = 2s + s * R(s * s) with s = f / (2 + f) from the log
+     * kernel, and b * (lh + ll) is formed exactly (ph + pl) before
+     * exp(ph + pl) ~= exp(ph) * (1 + pl). */
+    simde__m128d x, m, f, dk, qh, ql, sh, sl, z, t, lh, ll, ph, pl, ah, al, bh, bl, r, bint, bodd, mask;
+    simde__m128i bits, k;
+    const simde__m128d split = simde_mm_castsi128_pd(simde_mm_set1_epi64x(~INT64_C(0x7ffffff)));
+
+    x = simde_x_mm_abs_pd(a);
+    mask = simde_mm_cmplt_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072014e-308)));
+    x = simde_x_mm_select_pd(x, simde_mm_mul_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), mask);
+    bits = simde_mm_castpd_si128(x);
+
+    k = simde_mm_shuffle_epi32(simde_mm_srli_epi64(bits, 52), SIMDE_MM_SHUFFLE(2, 0, 2, 0));
+    dk = simde_mm_cvtepi32_pd(simde_mm_sub_epi32(k, simde_mm_set1_epi32(1022)));
+    dk = simde_mm_sub_pd(dk, simde_mm_and_pd(mask, simde_mm_set1_pd(SIMDE_FLOAT64_C(54.0))));
+    m = simde_mm_castsi128_pd(
+      simde_mm_or_si128(
+        simde_mm_and_si128(bits, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff))),
+        simde_mm_set1_epi64x(INT64_C(0x3fe0000000000000))));
+    mask = simde_mm_cmplt_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524)));
+    dk = simde_mm_sub_pd(dk, simde_mm_and_pd(mask, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+    f = simde_mm_add_pd(simde_mm_sub_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))), simde_mm_and_pd(mask, m));
+
+    /* s = f / (qh + ql), with 2 + f = qh + ql exactly; sl is the
+     * remainder f - sh * (qh + ql), divided by qh.  Products are split
+     * by masking so every partial product is exact (or negligible)
+     * whether or not the compiler contracts them into FMAs. */
+    qh = simde_mm_add_pd(f, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)));
+    ql = simde_mm_sub_pd(f, simde_mm_sub_pd(qh, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0))));
+    sh = simde_mm_div_pd(f, qh);
+    ah = simde_mm_and_pd(sh, split);
+    al = simde_mm_sub_pd(sh, ah);
+    bh = simde_mm_and_pd(qh, split);
+    bl = simde_mm_sub_pd(qh, bh);
+    sl = simde_mm_sub_pd(simde_mm_sub_pd(f, simde_mm_mul_pd(ah, bh)), simde_mm_mul_pd(ah, bl));
+    sl = simde_mm_sub_pd(simde_mm_sub_pd(sl, simde_mm_mul_pd(al, bh)), simde_mm_mul_pd(al, bl));
+    sl = simde_mm_div_pd(simde_mm_sub_pd(sl, simde_mm_mul_pd(sh, ql)), qh);
+
+    z = simde_mm_mul_pd(sh, sh);
+    r = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.479819860511658591e-01));
+    r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.531383769920937332e-01)));
+    r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.818357216161805012e-01)));
+    r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.222219843214978396e-01)));
+    r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.857142874366239149e-01)));
+    r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.999999999940941908e-01)));
+    r = simde_x_mm_svml_fmadd_pd(r, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.666666666666735130e-01)));
+    r = simde_mm_mul_pd(simde_mm_mul_pd(r, z), sh);
+
+    /* lh + ll = k * ln2_hi + 2 * sh + (2 * sl + r + k * ln2_lo) */
+    t = simde_mm_mul_pd(dk, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)));
+    sh = simde_mm_add_pd(sh, sh);
+    lh = simde_mm_add_pd(t, sh);
+    z = simde_mm_sub_pd(lh, t);
+    ll = simde_mm_add_pd(simde_mm_sub_pd(t, simde_mm_sub_pd(lh, z)), simde_mm_sub_pd(sh, z));
+    ll = simde_mm_add_pd(ll, simde_mm_add_pd(simde_mm_add_pd(sl, sl), simde_x_mm_svml_fmadd_pd(dk, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), r)));
+    t = lh;
+    lh = simde_mm_add_pd(t, ll);
+    ll = simde_mm_sub_pd(ll, simde_mm_sub_pd(lh, t));
+
+    /* log(0) = -inf, log(inf) = inf, log(NaN) = NaN; ll doesn't matter
+     * for those since pl is ignored below. */
+    x = simde_x_mm_abs_pd(a);
+    lh = simde_x_mm_select_pd(lh, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), simde_mm_cmpeq_pd(x, simde_mm_setzero_pd()));
+    lh = simde_x_mm_select_pd(lh, simde_mm_set1_pd(SIMDE_MATH_INFINITY), simde_mm_cmpeq_pd(x, simde_mm_set1_pd(SIMDE_MATH_INFINITY)));
+    lh = simde_x_mm_select_pd(lh, x, simde_mm_cmpunord_pd(x, x));
+
+    /* ph + pl = b * (lh + ll) */
+    ph = simde_mm_mul_pd(b, lh);
+    ah = simde_mm_and_pd(b, split);
+    al = simde_mm_sub_pd(b, ah);
+    bh = simde_mm_and_pd(lh, split);
+    bl = simde_mm_sub_pd(lh, bh);
+    pl = simde_mm_add_pd(simde_mm_sub_pd(simde_mm_mul_pd(ah, bh), ph), simde_mm_mul_pd(ah, bl));
+    pl = simde_mm_add_pd(simde_mm_add_pd(pl, simde_mm_mul_pd(al, bh)), simde_mm_mul_pd(al, bl));
+    pl = simde_x_mm_svml_fmadd_pd(b, ll, pl);
+    /* pl is meaningless (and may be NaN) once exp(ph) over/underflows */
+    r = simde_x_mm_svml_exp_pd(ph);
+    mask = simde_mm_cmplt_pd(simde_x_mm_abs_pd(ph), simde_mm_set1_pd(SIMDE_FLOAT64_C(746.0)));
+    r = simde_x_mm_select_pd(r, simde_x_mm_svml_fmadd_pd(r, pl, r), mask);
+
+    /* b is an integer if trunc(b) == b, and odd if b / 2 isn't. */
+    bint = simde_mm_cmpeq_pd(simde_mm_round_pd(b, SIMDE_MM_FROUND_TO_ZERO), b);
+    bh = simde_mm_mul_pd(b, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+    bodd = simde_mm_andnot_pd(simde_mm_cmpeq_pd(simde_mm_round_pd(bh, SIMDE_MM_FROUND_TO_ZERO), bh), bint);
+
+    /* a < 0 (or -0): the result is negative for odd b, and NaN for
+     * non-integer b unless a is -inf. */
+    r = simde_mm_or_pd(r, simde_mm_and_pd(bodd, simde_mm_and_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0)))));
+    mask = simde_mm_and_pd(simde_mm_cmplt_pd(a, simde_mm_setzero_pd()), simde_mm_cmpgt_pd(a, simde_mm_set1_pd(-SIMDE_MATH_INFINITY)));
+    r = simde_x_mm_select_pd(r, simde_mm_set1_pd(SIMDE_MATH_NAN), simde_mm_andnot_pd(bint, mask));
+
+    /* pow(a, 0) = pow(1, b) = pow(-1, +/-inf) = 1, even for NaN */
+    mask = simde_mm_or_pd(simde_mm_cmpeq_pd(b, simde_mm_setzero_pd()), simde_mm_cmpeq_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+    mask = simde_mm_or_pd(mask, simde_mm_and_pd(simde_mm_cmpeq_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.0))), simde_mm_cmpeq_pd(simde_x_mm_abs_pd(b), simde_mm_set1_pd(SIMDE_MATH_INFINITY))));
+    return simde_x_mm_select_pd(r, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), mask);
   #else
     simde__m128d_private
       r_,
@@ -8679,10 +9336,16 @@ simde_mm256_pow_ps (simde__m256 a, simde__m256 b) {
       a_ = simde__m256_to_private(a),
       b_ = simde__m256_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+        r_.m128[i] = simde_mm_pow_ps(a_.m128[i], b_.m128[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
+      }
+    #endif
 
     return simde__m256_from_private(r_);
   #endif
@@ -8706,10 +9369,16 @@ simde_mm256_pow_pd (simde__m256d a, simde__m256d b) {
       a_ = simde__m256d_to_private(a),
       b_ = simde__m256d_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+        r_.m128d[i] = simde_mm_pow_pd(a_.m128d[i], b_.m128d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+    #endif
 
     return simde__m256d_from_private(r_);
   #endif
@@ -8732,10 +9401,16 @@ simde_mm512_pow_ps (simde__m512 a, simde__m512 b) {
       a_ = simde__m512_to_private(a),
       b_ = simde__m512_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_pow_ps(a_.m256[i], b_.m256[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
+      }
+    #endif
 
     return simde__m512_from_private(r_);
   #endif
@@ -8758,10 +9433,16 @@ simde_mm512_pow_pd (simde__m512d a, simde__m512d b) {
       a_ = simde__m512d_to_private(a),
       b_ = simde__m512d_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_pow_pd(a_.m256d[i], b_.m256d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+    #endif
 
     return simde__m512d_from_private(r_);
   #endif
@@ -9862,6 +10543,9 @@ simde_mm_sin_ps (simde__m128 a) {
     #else
       return Sleef_sinf4_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m128 c;
+    return simde_x_mm_svml_sincos_ps(&c, a);
   #else
     simde__m128_private
       r_,
@@ -9891,6 +10575,9 @@ simde_mm_sin_pd (simde__m128d a) {
     #else
       return Sleef_sind2_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m128d c;
+    return simde_x_mm_svml_sincos_pd(&c, a);
   #else
     simde__m128d_private
       r_,
@@ -9925,7 +10612,7 @@ simde_mm256_sin_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_sin_ps(a_.m128[i]);
       }
@@ -9961,7 +10648,7 @@ simde_mm256_sin_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_sin_pd(a_.m128d[i]);
       }
@@ -9996,7 +10683,7 @@ simde_mm512_sin_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_sin_ps(a_.m256[i]);
       }
@@ -10031,7 +10718,7 @@ simde_mm512_sin_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_sin_pd(a_.m256d[i]);
       }
@@ -10094,6 +10781,8 @@ simde_mm_sincos_ps (simde__m128* mem_addr, simde__m128 a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_X_SVML_POLY_)
+    return simde_x_mm_svml_sincos_ps(mem_addr, a);
   #else
     simde__m128 r;
 
@@ -10124,6 +10813,8 @@ simde_mm_sincos_pd (simde__m128d* mem_addr, simde__m128d a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_X_SVML_POLY_)
+    return simde_x_mm_svml_sincos_pd(mem_addr, a);
   #else
     simde__m128d r;
 
@@ -10154,6 +10845,18 @@ simde_mm256_sincos_ps (simde__m256* mem_addr, simde__m256 a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m256_private
+      r_,
+      c_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_x_mm_svml_sincos_ps(&(c_.m128[i]), a_.m128[i]);
+    }
+
+    *mem_addr = simde__m256_from_private(c_);
+    return simde__m256_from_private(r_);
   #else
     simde__m256 r;
 
@@ -10184,6 +10887,18 @@ simde_mm256_sincos_pd (simde__m256d* mem_addr, simde__m256d a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m256d_private
+      r_,
+      c_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+      r_.m128d[i] = simde_x_mm_svml_sincos_pd(&(c_.m128d[i]), a_.m128d[i]);
+    }
+
+    *mem_addr = simde__m256d_from_private(c_);
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d r;
 
@@ -10214,6 +10929,18 @@ simde_mm512_sincos_ps (simde__m512* mem_addr, simde__m512 a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m512_private
+      r_,
+      c_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_x_mm_svml_sincos_ps(&(c_.m128[i]), a_.m128[i]);
+    }
+
+    *mem_addr = simde__m512_from_private(c_);
+    return simde__m512_from_private(r_);
   #else
     simde__m512 r;
 
@@ -10244,6 +10971,18 @@ simde_mm512_sincos_pd (simde__m512d* mem_addr, simde__m512d a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m512d_private
+      r_,
+      c_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+      r_.m128d[i] = simde_x_mm_svml_sincos_pd(&(c_.m128d[i]), a_.m128d[i]);
+    }
+
+    *mem_addr = simde__m512d_from_private(c_);
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d r;
 
@@ -11295,6 +12034,10 @@ simde_mm_tan_ps (simde__m128 a) {
     #else
       return Sleef_tanf4_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m128 c, s;
+    s = simde_x_mm_svml_sincos_ps(&c, a);
+    return simde_mm_div_ps(s, c);
   #else
     simde__m128_private
       r_,
@@ -11324,6 +12067,10 @@ simde_mm_tan_pd (simde__m128d a) {
     #else
       return Sleef_tand2_u35(a);
     #endif
+  #elif defined(SIMDE_X_SVML_POLY_)
+    simde__m128d c, s;
+    s = simde_x_mm_svml_sincos_pd(&c, a);
+    return simde_mm_div_pd(s, c);
   #else
     simde__m128d_private
       r_,
@@ -11358,7 +12105,7 @@ simde_mm256_tan_ps (simde__m256 a) {
       r_,
       a_ = simde__m256_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
         r_.m128[i] = simde_mm_tan_ps(a_.m128[i]);
       }
@@ -11394,7 +12141,7 @@ simde_mm256_tan_pd (simde__m256d a) {
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
         r_.m128d[i] = simde_mm_tan_pd(a_.m128d[i]);
       }
@@ -11429,7 +12176,7 @@ simde_mm512_tan_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_tan_ps(a_.m256[i]);
       }
@@ -11464,7 +12211,7 @@ simde_mm512_tan_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || defined(SIMDE_X_SVML_POLY_)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_tan_pd(a_.m256d[i]);
       }
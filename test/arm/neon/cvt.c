@@ -10,6 +10,14 @@ test_simde_vcvts_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float32 a;
     int32_t r;
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+       INT32_C(           0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(3000000000.00),
+                   INT32_MAX },
+    #endif
     { SIMDE_FLOAT32_C(   550.19),
        INT32_C(         550) },
     { SIMDE_FLOAT32_C(   -14.71),
@@ -57,6 +65,14 @@ test_simde_vcvtd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float64 a;
     int64_t r;
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+       INT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(10000000000000000000.00),
+                           INT64_MAX },
+    #endif
     { SIMDE_FLOAT64_C(  -881.66),
       -INT64_C(                 881) },
     { SIMDE_FLOAT64_C(  -469.33),
@@ -105,6 +121,14 @@ test_simde_vcvts_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float32 a;
     uint32_t r;
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+      UINT32_C(         0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(5000000000.00),
+                UINT32_MAX },
+    #endif
     { SIMDE_FLOAT32_C(   843.42),
       UINT32_C(       843) },
     { SIMDE_FLOAT32_C(   336.45),
@@ -151,6 +175,14 @@ test_simde_vcvtd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float64 a;
     uint64_t r;
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+      UINT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(20000000000000000000.00),
+                          UINT64_MAX },
+    #endif
     { SIMDE_FLOAT64_C(  -497.11),
       UINT64_C(                   0) },
     { SIMDE_FLOAT64_C(  -710.38),
@@ -197,6 +229,14 @@ test_simde_vcvt_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float32 a[2];
     int32_t r[2];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      {  INT32_C(           0),  INT32_C(          12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00) },
+      {              INT32_MAX,              INT32_MIN } },
+    #endif
     { { SIMDE_FLOAT32_C(   396.15), SIMDE_FLOAT32_C(  -246.90) },
       {  INT32_C(         396), -INT32_C(         246) } },
     { { SIMDE_FLOAT32_C(   241.51), SIMDE_FLOAT32_C(   602.56) },
@@ -244,6 +284,14 @@ test_simde_vcvt_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float64 a[1];
     int64_t r[1];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      {  INT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00) },
+      {                      INT64_MAX } },
+    #endif
     { { SIMDE_FLOAT64_C(  -824.03) },
       { -INT64_C(                 824) } },
     { { SIMDE_FLOAT64_C(  -841.94) },
@@ -292,6 +340,14 @@ test_simde_vcvt_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float32 a[2];
     uint32_t r[2];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      { UINT32_C(         0), UINT32_C(        12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50) },
+      {           UINT32_MAX, UINT32_C(         0) } },
+    #endif
     { { SIMDE_FLOAT32_C(   769.38), SIMDE_FLOAT32_C(  -948.10) },
       { UINT32_C(       769), UINT32_C(         0) } },
     { { SIMDE_FLOAT32_C(   -50.28), SIMDE_FLOAT32_C(  -280.11) },
@@ -338,6 +394,14 @@ test_simde_vcvt_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float64 a[1];
     uint64_t r[1];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      { UINT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00) },
+      {                     UINT64_MAX } },
+    #endif
     { { SIMDE_FLOAT64_C(   382.15) },
       { UINT64_C(                 382) } },
     { { SIMDE_FLOAT64_C(   800.28) },
@@ -384,6 +448,14 @@ test_simde_vcvtq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float32 a[4];
     int32_t r[4];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      {  INT32_C(           0),  INT32_C(          12), -INT32_C(           7),  INT32_C(           0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00), SIMDE_FLOAT32_C(2147483648.00), SIMDE_FLOAT32_C(-2147483648.00) },
+      {              INT32_MAX,              INT32_MIN,              INT32_MAX,              INT32_MIN } },
+    #endif
     { { SIMDE_FLOAT32_C(   803.18), SIMDE_FLOAT32_C(  -587.37), SIMDE_FLOAT32_C(   500.83), SIMDE_FLOAT32_C(  -606.29) },
       {  INT32_C(         803), -INT32_C(         587),  INT32_C(         500), -INT32_C(         606) } },
     { { SIMDE_FLOAT32_C(   553.19), SIMDE_FLOAT32_C(   -89.37), SIMDE_FLOAT32_C(  -751.51), SIMDE_FLOAT32_C(    39.67) },
@@ -430,6 +502,14 @@ test_simde_vcvtq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float64 a[2];
     int64_t r[2];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      {  INT64_C(                   0),  INT64_C(                  12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00), SIMDE_FLOAT64_C(-10000000000000000000.00) },
+      {                      INT64_MAX,                      INT64_MIN } },
+    #endif
     { { SIMDE_FLOAT64_C(     7.90), SIMDE_FLOAT64_C(  -570.72) },
       {  INT64_C(                   7), -INT64_C(                 570) } },
     { { SIMDE_FLOAT64_C(  -808.38), SIMDE_FLOAT64_C(   530.98) },
@@ -476,6 +556,14 @@ test_simde_vcvtq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float32 a[4];
     uint32_t r[4];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      { UINT32_C(         0), UINT32_C(        12), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50), SIMDE_FLOAT32_C(4294967296.00), SIMDE_FLOAT32_C(    -0.75) },
+      {           UINT32_MAX, UINT32_C(         0),           UINT32_MAX, UINT32_C(         0) } },
+    #endif
     { { SIMDE_FLOAT32_C(   101.83), SIMDE_FLOAT32_C(   359.10), SIMDE_FLOAT32_C(   718.19), SIMDE_FLOAT32_C(  -635.43) },
       { UINT32_C(       101), UINT32_C(       359), UINT32_C(       718), UINT32_C(         0) } },
     { { SIMDE_FLOAT32_C(   426.17), SIMDE_FLOAT32_C(  -916.71), SIMDE_FLOAT32_C(   598.15), SIMDE_FLOAT32_C(  -323.30) },
@@ -523,6 +611,14 @@ test_simde_vcvtq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
     simde_float64 a[2];
     uint64_t r[2];
   } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      { UINT64_C(                   0), UINT64_C(                  12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00), SIMDE_FLOAT64_C(    -3.50) },
+      {                     UINT64_MAX, UINT64_C(                   0) } },
+    #endif
     { { SIMDE_FLOAT64_C(   770.83), SIMDE_FLOAT64_C(   372.43) },
       { UINT64_C(                 770), UINT64_C(                 372) } },
     { { SIMDE_FLOAT64_C(    28.55), SIMDE_FLOAT64_C(   399.88) },
@@ -937,31 +1033,2877 @@ test_simde_vcvtq_f64_u64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 
-SIMDE_TEST_FUNC_LIST_BEGIN
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_s32_f32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_s64_f64)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_u32_f32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_u64_f64)
+static int
+test_simde_vcvt_f16_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint16_t r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(2.98023224e-08),   SIMDE_FLOAT32_C(-0.435760498),    SIMDE_FLOAT32_C(-2.36157227),   SIMDE_FLOAT32_C(-0.246459961) },
+      { UINT16_C(    0), UINT16_C(46841), UINT16_C(49337), UINT16_C(46051) } },
+    { {     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(65504.0000), SIMDE_FLOAT32_C(5.93662262e-05),     SIMDE_FLOAT32_C(164.671875) },
+      { UINT16_C(    0), UINT16_C(31743), UINT16_C(  996), UINT16_C(22821) } },
+    { { SIMDE_FLOAT32_C(4.86746430e-05),     SIMDE_FLOAT32_C(5.51855469),    SIMDE_FLOAT32_C(-58.8242188),     SIMDE_FLOAT32_C(1.87756348) },
+      { UINT16_C(  817), UINT16_C(17797), UINT16_C(54106), UINT16_C(16259) } },
+    { {            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-3.16235352),   SIMDE_FLOAT32_C(-0.173461914) },
+      { UINT16_C(31744), UINT16_C(    0), UINT16_C(49747), UINT16_C(45453) } },
+    { {    SIMDE_FLOAT32_C(-1.54577637),     SIMDE_FLOAT32_C(44540.0000),    SIMDE_FLOAT32_C(-1.29479980),    SIMDE_FLOAT32_C(0.903137207) },
+      { UINT16_C(48687), UINT16_C(31088), UINT16_C(48430), UINT16_C(15162) } },
+    { { SIMDE_FLOAT32_C(6.10500574e-05), SIMDE_FLOAT32_C(-1.29118562e-05),    SIMDE_FLOAT32_C(-38580.0000),    SIMDE_FLOAT32_C(-65520.0000) },
+      { UINT16_C( 1024), UINT16_C(32985), UINT16_C(63670), UINT16_C(64512) } },
+    { {   SIMDE_FLOAT32_C(-0.801025391),    SIMDE_FLOAT32_C(-1.74389648),                -SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(0.0572967529) },
+      { UINT16_C(47720), UINT16_C(48890), UINT16_C(65024), UINT16_C(11094) } },
+    { {    SIMDE_FLOAT32_C(-3.67382812),    SIMDE_FLOAT32_C(-6.79003906),           -SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(1.63989258) },
+      { UINT16_C(50009), UINT16_C(50890), UINT16_C(64512), UINT16_C(16015) } }
+  };
 
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_s32_f32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_s64_f64)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_u32_f32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_u64_f64)
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float16_t r_[4];
+    uint16_t r[4];
 
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_s32_f32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_s64_f64)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_u32_f32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_u64_f64)
+    simde_vst1_f16(r_, simde_vcvt_f16_f32(a));
+    simde_memcpy(r, r_, sizeof(r));
+    simde_assert_equal_vu16(4, r, test_vec[i].r);
+  }
 
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f32_s32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f64_s64)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f32_u32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f64_u64)
+  return 0;
+}
 
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f32_s32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f64_s64)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f32_u32)
-SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f64_u64)
+static int
+test_simde_vcvt_high_f16_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t r[4];
+    simde_float32 a[4];
+    uint16_t res[8];
+  } test_vec[] = {
+    { { UINT16_C(15999), UINT16_C(45542), UINT16_C(17205), UINT16_C(32768) },
+      {     SIMDE_FLOAT32_C(3.16479492),     SIMDE_FLOAT32_C(14.7753906),    SIMDE_FLOAT32_C(0.295867920),    SIMDE_FLOAT32_C(-1.43774414) },
+      { UINT16_C(15999), UINT16_C(45542), UINT16_C(17205), UINT16_C(32768), UINT16_C(16980), UINT16_C(19299), UINT16_C(13500), UINT16_C(48576) } },
+    { { UINT16_C(56171), UINT16_C(47194), UINT16_C(18209), UINT16_C(46104) },
+      { SIMDE_FLOAT32_C(0.000415772200),    SIMDE_FLOAT32_C(0.965332031),    SIMDE_FLOAT32_C(-3.34643555), SIMDE_FLOAT32_C(-2.33054161e-05) },
+      { UINT16_C(56171), UINT16_C(47194), UINT16_C(18209), UINT16_C(46104), UINT16_C( 3792), UINT16_C(15289), UINT16_C(49841), UINT16_C(33159) } },
+    { { UINT16_C(47274), UINT16_C(46733), UINT16_C(16560), UINT16_C(39493) },
+      {    SIMDE_FLOAT32_C(-2.00170898), SIMDE_FLOAT32_C(-5.57899475e-05), SIMDE_FLOAT32_C(2.98023224e-08), SIMDE_FLOAT32_C(-3.24100256e-05) },
+      { UINT16_C(47274), UINT16_C(46733), UINT16_C(16560), UINT16_C(39493), UINT16_C(49153), UINT16_C(33704), UINT16_C(    0), UINT16_C(33312) } },
+    { { UINT16_C(13545), UINT16_C(18270), UINT16_C(50356), UINT16_C(12354) },
+      { SIMDE_FLOAT32_C(0.000258386135),   SIMDE_FLOAT32_C(0.0484848022),                -SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(-1.40917969) },
+      { UINT16_C(13545), UINT16_C(18270), UINT16_C(50356), UINT16_C(12354), UINT16_C( 3132), UINT16_C(10805), UINT16_C(65024), UINT16_C(48547) } },
+    { { UINT16_C(33271), UINT16_C(33118), UINT16_C(16761), UINT16_C(50438) },
+      {     SIMDE_FLOAT32_C(100000.000),            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(1.00048828),   SIMDE_FLOAT32_C(0.0287189484) },
+      { UINT16_C(33271), UINT16_C(33118), UINT16_C(16761), UINT16_C(50438), UINT16_C(31744), UINT16_C(31744), UINT16_C(15360), UINT16_C(10074) } },
+    { { UINT16_C(13849), UINT16_C(    0), UINT16_C(45490), UINT16_C( 2723) },
+      { SIMDE_FLOAT32_C(-2.42590904e-05),    SIMDE_FLOAT32_C(-19.0703125), SIMDE_FLOAT32_C(2.98023224e-08),  SIMDE_FLOAT32_C(-0.0132455826) },
+      { UINT16_C(13849), UINT16_C(    0), UINT16_C(45490), UINT16_C( 2723), UINT16_C(33175), UINT16_C(52420), UINT16_C(    0), UINT16_C(41672) } },
+    { { UINT16_C(45665), UINT16_C(33123), UINT16_C( 8683), UINT16_C(33170) },
+      {   SIMDE_FLOAT32_C(0.0317382812),            SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.416046143),   SIMDE_FLOAT32_C(-0.221069336) },
+      { UINT16_C(45665), UINT16_C(33123), UINT16_C( 8683), UINT16_C(33170), UINT16_C(10256), UINT16_C(31744), UINT16_C(46760), UINT16_C(45843) } },
+    { { UINT16_C(47241), UINT16_C(57483), UINT16_C(31743), UINT16_C(54740) },
+      {     SIMDE_FLOAT32_C(2.55126953),   SIMDE_FLOAT32_C(-0.954284668),    SIMDE_FLOAT32_C(0.458984375),   SIMDE_FLOAT32_C(-0.183700562) },
+      { UINT16_C(47241), UINT16_C(57483), UINT16_C(31743), UINT16_C(54740), UINT16_C(16666), UINT16_C(48034), UINT16_C(14168), UINT16_C(45537) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16_t r_[4], res_[8];
+    uint16_t res[8];
+
+    simde_memcpy(r_, test_vec[i].r, sizeof(r_));
+    simde_float16x4_t r = simde_vld1_f16(r_);
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_vst1q_f16(res_, simde_vcvt_high_f16_f32(r, a));
+    simde_memcpy(res, res_, sizeof(res));
+    simde_assert_equal_vu16(8, res, test_vec[i].res);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_f32_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { UINT16_C(13366), UINT16_C(14803), UINT16_C(50740), UINT16_C(49258) },
+      {    SIMDE_FLOAT32_C(0.263183594),    SIMDE_FLOAT32_C(0.728027344),    SIMDE_FLOAT32_C(-6.20312500),    SIMDE_FLOAT32_C(-2.20703125) } },
+    { { UINT16_C(12996), UINT16_C(31744), UINT16_C(13056), UINT16_C(52123) },
+      {    SIMDE_FLOAT32_C(0.211425781),            SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(0.218750000),    SIMDE_FLOAT32_C(-15.2109375) } },
+    { { UINT16_C(32783), UINT16_C(14107), UINT16_C(49247), UINT16_C(  816) },
+      { SIMDE_FLOAT32_C(-8.94069672e-07),    SIMDE_FLOAT32_C(0.444091797),    SIMDE_FLOAT32_C(-2.18554688), SIMDE_FLOAT32_C(4.86373901e-05) } },
+    { { UINT16_C(48076), UINT16_C(14871), UINT16_C(50135), UINT16_C(14308) },
+      {   SIMDE_FLOAT32_C(-0.974609375),    SIMDE_FLOAT32_C(0.761230469),    SIMDE_FLOAT32_C(-3.91992188),    SIMDE_FLOAT32_C(0.493164062) } },
+    { { UINT16_C(47081), UINT16_C(39804), UINT16_C(32256), UINT16_C(14242) },
+      {   SIMDE_FLOAT32_C(-0.494384766), SIMDE_FLOAT32_C(-0.00365447998),                 SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(0.477050781) } },
+    { { UINT16_C( 1024), UINT16_C(13774), UINT16_C( 7920), UINT16_C(  641) },
+      { SIMDE_FLOAT32_C(6.10351562e-05),    SIMDE_FLOAT32_C(0.362792969),  SIMDE_FLOAT32_C(0.00677490234), SIMDE_FLOAT32_C(3.82065773e-05) } },
+    { { UINT16_C(32768), UINT16_C(47717), UINT16_C(13657), UINT16_C(  673) },
+      {    SIMDE_FLOAT32_C(-0.00000000),   SIMDE_FLOAT32_C(-0.799316406),    SIMDE_FLOAT32_C(0.334228516), SIMDE_FLOAT32_C(4.01139259e-05) } },
+    { { UINT16_C(27248), UINT16_C(16423), UINT16_C(32256), UINT16_C(32984) },
+      {     SIMDE_FLOAT32_C(3296.00000),     SIMDE_FLOAT32_C(2.07617188),                 SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-1.28746033e-05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16_t a_[4];
+    simde_memcpy(a_, test_vec[i].a, sizeof(a_));
+
+    simde_float16x4_t a = simde_vld1_f16(a_);
+    simde_float32x4_t r = simde_vcvt_f32_f16(a);
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_high_f32_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { UINT16_C(15999), UINT16_C(13042), UINT16_C(18086), UINT16_C( 9225), UINT16_C(19299), UINT16_C(47438), UINT16_C(45796), UINT16_C(31743) },
+      {     SIMDE_FLOAT32_C(14.7734375),   SIMDE_FLOAT32_C(-0.663085938),   SIMDE_FLOAT32_C(-0.215332031),     SIMDE_FLOAT32_C(65504.0000) } },
+    { { UINT16_C(54635), UINT16_C(48576), UINT16_C( 6675), UINT16_C(56171), UINT16_C(33710), UINT16_C(39013), UINT16_C(46802), UINT16_C(15289) },
+      { SIMDE_FLOAT32_C(-5.61475754e-05), SIMDE_FLOAT32_C(-0.00214576721),   SIMDE_FLOAT32_C(-0.426269531),    SIMDE_FLOAT32_C(0.965332031) } },
+    { { UINT16_C(18209), UINT16_C(12502), UINT16_C(31743), UINT16_C(64511), UINT16_C(33176), UINT16_C(47361), UINT16_C(45820), UINT16_C(50374) },
+      { SIMDE_FLOAT32_C(-2.43186951e-05),   SIMDE_FLOAT32_C(-0.625488281),   SIMDE_FLOAT32_C(-0.218261719),    SIMDE_FLOAT32_C(-4.77343750) } },
+    { { UINT16_C(30634), UINT16_C(46733), UINT16_C(16961), UINT16_C(34692), UINT16_C(31744), UINT16_C(50488), UINT16_C(48367), UINT16_C(38024) },
+      {            SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-5.21875000),    SIMDE_FLOAT32_C(-1.23339844), SIMDE_FLOAT32_C(-0.00110626221) } },
+    { { UINT16_C(13545), UINT16_C(17687), UINT16_C(47019), UINT16_C(14276), UINT16_C(15422), UINT16_C(13907), UINT16_C(47444), UINT16_C(48953) },
+      {     SIMDE_FLOAT32_C(1.06054688),    SIMDE_FLOAT32_C(0.395263672),   SIMDE_FLOAT32_C(-0.666015625),    SIMDE_FLOAT32_C(-1.80566406) } },
+    { { UINT16_C(15843), UINT16_C(33271), UINT16_C(16646), UINT16_C(36506), UINT16_C(16761), UINT16_C(  876), UINT16_C(50438), UINT16_C(50184) },
+      {     SIMDE_FLOAT32_C(2.73632812), SIMDE_FLOAT32_C(5.22136688e-05),    SIMDE_FLOAT32_C(-5.02343750),    SIMDE_FLOAT32_C(-4.03125000) } },
+    { { UINT16_C(15753), UINT16_C(13849), UINT16_C( 7120), UINT16_C(64511), UINT16_C(18022), UINT16_C(    0), UINT16_C(33439), UINT16_C(17735) },
+      {     SIMDE_FLOAT32_C(6.39843750),     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-3.99947166e-05),     SIMDE_FLOAT32_C(5.27734375) } },
+    { { UINT16_C(15360), UINT16_C(47479), UINT16_C(64512), UINT16_C(49152), UINT16_C(48324), UINT16_C(13913), UINT16_C( 1024), UINT16_C(33123) },
+      {    SIMDE_FLOAT32_C(-1.19140625),    SIMDE_FLOAT32_C(0.396728516), SIMDE_FLOAT32_C(6.10351562e-05), SIMDE_FLOAT32_C(-2.11596489e-05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16_t a_[8];
+    simde_memcpy(a_, test_vec[i].a, sizeof(a_));
+
+    simde_float16x8_t a = simde_vld1q_f16(a_);
+    simde_float32x4_t r = simde_vcvt_high_f32_f16(a);
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtns_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+       INT32_C(           0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(3000000000.00),
+                   INT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(  -959.80),
+      -INT32_C(         960) },
+    { SIMDE_FLOAT32_C(   906.50),
+       INT32_C(         906) },
+    { SIMDE_FLOAT32_C(   668.44),
+       INT32_C(         668) },
+    { SIMDE_FLOAT32_C(  -888.88),
+      -INT32_C(         889) },
+    { SIMDE_FLOAT32_C(  -908.99),
+      -INT32_C(         909) },
+    { SIMDE_FLOAT32_C(   480.42),
+       INT32_C(         480) },
+    { SIMDE_FLOAT32_C(  -747.95),
+      -INT32_C(         748) },
+    { SIMDE_FLOAT32_C(  -673.92),
+      -INT32_C(         674) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    int32_t r = simde_vcvtns_s32_f32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    int32_t r = simde_vcvtns_s32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtnd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+       INT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(10000000000000000000.00),
+                           INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   800.08),
+       INT64_C(                 800) },
+    { SIMDE_FLOAT64_C(  -483.23),
+      -INT64_C(                 483) },
+    { SIMDE_FLOAT64_C(   638.34),
+       INT64_C(                 638) },
+    { SIMDE_FLOAT64_C(  -525.68),
+      -INT64_C(                 526) },
+    { SIMDE_FLOAT64_C(   -59.75),
+      -INT64_C(                  60) },
+    { SIMDE_FLOAT64_C(   230.48),
+       INT64_C(                 230) },
+    { SIMDE_FLOAT64_C(  -727.42),
+      -INT64_C(                 727) },
+    { SIMDE_FLOAT64_C(   777.48),
+       INT64_C(                 777) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    int64_t r = simde_vcvtnd_s64_f64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    int64_t r = simde_vcvtnd_s64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtns_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+      UINT32_C(         0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(5000000000.00),
+                UINT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(   229.50),
+      UINT32_C(       230) },
+    { SIMDE_FLOAT32_C(   -66.00),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   -74.07),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   384.50),
+      UINT32_C(       384) },
+    { SIMDE_FLOAT32_C(   266.50),
+      UINT32_C(       266) },
+    { SIMDE_FLOAT32_C(  -810.06),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(  -173.50),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(  -818.20),
+      UINT32_C(         0) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    uint32_t r = simde_vcvtns_u32_f32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    uint32_t r = simde_vcvtns_u32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtnd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+      UINT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(20000000000000000000.00),
+                          UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   666.59),
+      UINT64_C(                 667) },
+    { SIMDE_FLOAT64_C(   493.50),
+      UINT64_C(                 494) },
+    { SIMDE_FLOAT64_C(   110.50),
+      UINT64_C(                 110) },
+    { SIMDE_FLOAT64_C(  -841.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(  -421.15),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   466.91),
+      UINT64_C(                 467) },
+    { SIMDE_FLOAT64_C(   141.79),
+      UINT64_C(                 142) },
+    { SIMDE_FLOAT64_C(   602.59),
+      UINT64_C(                 603) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    uint64_t r = simde_vcvtnd_u64_f64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    uint64_t r = simde_vcvtnd_u64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtn_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      {  INT32_C(           0),  INT32_C(          12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00) },
+      {              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   714.10), SIMDE_FLOAT32_C(   159.43) },
+      {  INT32_C(         714),  INT32_C(         159) } },
+    { { SIMDE_FLOAT32_C(   679.50), SIMDE_FLOAT32_C(  -258.53) },
+      {  INT32_C(         680), -INT32_C(         259) } },
+    { { SIMDE_FLOAT32_C(  -902.50), SIMDE_FLOAT32_C(   -12.21) },
+      { -INT32_C(         902), -INT32_C(          12) } },
+    { { SIMDE_FLOAT32_C(   198.61), SIMDE_FLOAT32_C(   -21.50) },
+      {  INT32_C(         199), -INT32_C(          22) } },
+    { { SIMDE_FLOAT32_C(  -120.50), SIMDE_FLOAT32_C(   510.54) },
+      { -INT32_C(         120),  INT32_C(         511) } },
+    { { SIMDE_FLOAT32_C(  -831.74), SIMDE_FLOAT32_C(  -744.50) },
+      { -INT32_C(         832), -INT32_C(         744) } },
+    { { SIMDE_FLOAT32_C(  -520.50), SIMDE_FLOAT32_C(  -508.76) },
+      { -INT32_C(         520), -INT32_C(         509) } },
+    { { SIMDE_FLOAT32_C(   980.48), SIMDE_FLOAT32_C(  -550.50) },
+      {  INT32_C(         980), -INT32_C(         550) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvtn_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_int32x2_t r = simde_vcvtn_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtn_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    int64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      {  INT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00) },
+      {                      INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   810.50) },
+      {  INT64_C(                 810) } },
+    { { SIMDE_FLOAT64_C(  -447.62) },
+      { -INT64_C(                 448) } },
+    { { SIMDE_FLOAT64_C(   292.50) },
+      {  INT64_C(                 292) } },
+    { { SIMDE_FLOAT64_C(   622.01) },
+      {  INT64_C(                 622) } },
+    { { SIMDE_FLOAT64_C(   370.77) },
+      {  INT64_C(                 371) } },
+    { { SIMDE_FLOAT64_C(   -31.97) },
+      { -INT64_C(                  32) } },
+    { { SIMDE_FLOAT64_C(   -49.12) },
+      { -INT64_C(                  49) } },
+    { { SIMDE_FLOAT64_C(   300.78) },
+      {  INT64_C(                 301) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_int64x1_t r = simde_vcvtn_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_int64x1_t r = simde_vcvtn_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtn_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      { UINT32_C(         0), UINT32_C(        12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50) },
+      {           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   223.67), SIMDE_FLOAT32_C(   106.07) },
+      { UINT32_C(       224), UINT32_C(       106) } },
+    { { SIMDE_FLOAT32_C(   -13.92), SIMDE_FLOAT32_C(   316.55) },
+      { UINT32_C(         0), UINT32_C(       317) } },
+    { { SIMDE_FLOAT32_C(   777.50), SIMDE_FLOAT32_C(    93.82) },
+      { UINT32_C(       778), UINT32_C(        94) } },
+    { { SIMDE_FLOAT32_C(  -926.69), SIMDE_FLOAT32_C(   484.10) },
+      { UINT32_C(         0), UINT32_C(       484) } },
+    { { SIMDE_FLOAT32_C(  -398.27), SIMDE_FLOAT32_C(  -957.92) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   528.50), SIMDE_FLOAT32_C(  -321.42) },
+      { UINT32_C(       528), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -708.76), SIMDE_FLOAT32_C(  -317.98) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -915.20), SIMDE_FLOAT32_C(    63.50) },
+      { UINT32_C(         0), UINT32_C(        64) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvtn_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_uint32x2_t r = simde_vcvtn_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtn_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    uint64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      { UINT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00) },
+      {                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   460.50) },
+      { UINT64_C(                 460) } },
+    { { SIMDE_FLOAT64_C(  -445.50) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   254.50) },
+      { UINT64_C(                 254) } },
+    { { SIMDE_FLOAT64_C(  -794.66) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -162.50) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   568.60) },
+      { UINT64_C(                 569) } },
+    { { SIMDE_FLOAT64_C(   711.03) },
+      { UINT64_C(                 711) } },
+    { { SIMDE_FLOAT64_C(   113.50) },
+      { UINT64_C(                 114) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_uint64x1_t r = simde_vcvtn_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_uint64x1_t r = simde_vcvtn_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtnq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      {  INT32_C(           0),  INT32_C(          12), -INT32_C(           7),  INT32_C(           0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00), SIMDE_FLOAT32_C(2147483648.00), SIMDE_FLOAT32_C(-2147483648.00) },
+      {              INT32_MAX,              INT32_MIN,              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -667.24), SIMDE_FLOAT32_C(  -755.18), SIMDE_FLOAT32_C(  -756.55), SIMDE_FLOAT32_C(   477.53) },
+      { -INT32_C(         667), -INT32_C(         755), -INT32_C(         757),  INT32_C(         478) } },
+    { { SIMDE_FLOAT32_C(   977.50), SIMDE_FLOAT32_C(   850.53), SIMDE_FLOAT32_C(  -550.95), SIMDE_FLOAT32_C(  -846.50) },
+      {  INT32_C(         978),  INT32_C(         851), -INT32_C(         551), -INT32_C(         846) } },
+    { { SIMDE_FLOAT32_C(  -958.76), SIMDE_FLOAT32_C(   869.66), SIMDE_FLOAT32_C(    31.50), SIMDE_FLOAT32_C(  -458.50) },
+      { -INT32_C(         959),  INT32_C(         870),  INT32_C(          32), -INT32_C(         458) } },
+    { { SIMDE_FLOAT32_C(   470.50), SIMDE_FLOAT32_C(   414.50), SIMDE_FLOAT32_C(  -400.50), SIMDE_FLOAT32_C(   -55.50) },
+      {  INT32_C(         470),  INT32_C(         414), -INT32_C(         400), -INT32_C(          56) } },
+    { { SIMDE_FLOAT32_C(  -241.30), SIMDE_FLOAT32_C(  -255.51), SIMDE_FLOAT32_C(  -282.22), SIMDE_FLOAT32_C(   756.50) },
+      { -INT32_C(         241), -INT32_C(         256), -INT32_C(         282),  INT32_C(         756) } },
+    { { SIMDE_FLOAT32_C(  -434.50), SIMDE_FLOAT32_C(  -896.62), SIMDE_FLOAT32_C(  -194.47), SIMDE_FLOAT32_C(   879.50) },
+      { -INT32_C(         434), -INT32_C(         897), -INT32_C(         194),  INT32_C(         880) } },
+    { { SIMDE_FLOAT32_C(  -819.74), SIMDE_FLOAT32_C(   579.09), SIMDE_FLOAT32_C(  -300.50), SIMDE_FLOAT32_C(  -850.67) },
+      { -INT32_C(         820),  INT32_C(         579), -INT32_C(         300), -INT32_C(         851) } },
+    { { SIMDE_FLOAT32_C(    -0.50), SIMDE_FLOAT32_C(   -57.01), SIMDE_FLOAT32_C(  -870.46), SIMDE_FLOAT32_C(   173.87) },
+      {  INT32_C(           0), -INT32_C(          57), -INT32_C(         870),  INT32_C(         174) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtnq_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_int32x4_t r = simde_vcvtnq_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtnq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      {  INT64_C(                   0),  INT64_C(                  12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00), SIMDE_FLOAT64_C(-10000000000000000000.00) },
+      {                      INT64_MAX,                      INT64_MIN } },
+    #endif
+    { { SIMDE_FLOAT64_C(  -195.39), SIMDE_FLOAT64_C(  -262.50) },
+      { -INT64_C(                 195), -INT64_C(                 262) } },
+    { { SIMDE_FLOAT64_C(  -816.18), SIMDE_FLOAT64_C(  -893.50) },
+      { -INT64_C(                 816), -INT64_C(                 894) } },
+    { { SIMDE_FLOAT64_C(  -747.01), SIMDE_FLOAT64_C(   701.50) },
+      { -INT64_C(                 747),  INT64_C(                 702) } },
+    { { SIMDE_FLOAT64_C(    31.66), SIMDE_FLOAT64_C(  -968.10) },
+      {  INT64_C(                  32), -INT64_C(                 968) } },
+    { { SIMDE_FLOAT64_C(   952.50), SIMDE_FLOAT64_C(   372.50) },
+      {  INT64_C(                 952),  INT64_C(                 372) } },
+    { { SIMDE_FLOAT64_C(   453.50), SIMDE_FLOAT64_C(  -177.29) },
+      {  INT64_C(                 454), -INT64_C(                 177) } },
+    { { SIMDE_FLOAT64_C(   421.33), SIMDE_FLOAT64_C(  -844.50) },
+      {  INT64_C(                 421), -INT64_C(                 844) } },
+    { { SIMDE_FLOAT64_C(  -720.11), SIMDE_FLOAT64_C(   772.50) },
+      { -INT64_C(                 720),  INT64_C(                 772) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtnq_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_int64x2_t r = simde_vcvtnq_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtnq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      { UINT32_C(         0), UINT32_C(        12), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50), SIMDE_FLOAT32_C(4294967296.00), SIMDE_FLOAT32_C(    -0.75) },
+      {           UINT32_MAX, UINT32_C(         0),           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   562.25), SIMDE_FLOAT32_C(  -763.50), SIMDE_FLOAT32_C(   774.30), SIMDE_FLOAT32_C(   310.06) },
+      { UINT32_C(       562), UINT32_C(         0), UINT32_C(       774), UINT32_C(       310) } },
+    { { SIMDE_FLOAT32_C(   645.50), SIMDE_FLOAT32_C(   646.50), SIMDE_FLOAT32_C(  -589.50), SIMDE_FLOAT32_C(   -14.50) },
+      { UINT32_C(       646), UINT32_C(       646), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   551.50), SIMDE_FLOAT32_C(   634.68), SIMDE_FLOAT32_C(   953.90), SIMDE_FLOAT32_C(   771.77) },
+      { UINT32_C(       552), UINT32_C(       635), UINT32_C(       954), UINT32_C(       772) } },
+    { { SIMDE_FLOAT32_C(  -208.50), SIMDE_FLOAT32_C(   -38.77), SIMDE_FLOAT32_C(  -696.89), SIMDE_FLOAT32_C(  -835.50) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   907.50), SIMDE_FLOAT32_C(   415.53), SIMDE_FLOAT32_C(  -468.23), SIMDE_FLOAT32_C(  -844.50) },
+      { UINT32_C(       908), UINT32_C(       416), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(    -2.62), SIMDE_FLOAT32_C(   491.50), SIMDE_FLOAT32_C(  -827.24), SIMDE_FLOAT32_C(   698.58) },
+      { UINT32_C(         0), UINT32_C(       492), UINT32_C(         0), UINT32_C(       699) } },
+    { { SIMDE_FLOAT32_C(  -216.50), SIMDE_FLOAT32_C(   619.50), SIMDE_FLOAT32_C(    27.50), SIMDE_FLOAT32_C(  -423.50) },
+      { UINT32_C(         0), UINT32_C(       620), UINT32_C(        28), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   120.67), SIMDE_FLOAT32_C(  -472.51), SIMDE_FLOAT32_C(   783.50), SIMDE_FLOAT32_C(    35.38) },
+      { UINT32_C(       121), UINT32_C(         0), UINT32_C(       784), UINT32_C(        35) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtnq_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_uint32x4_t r = simde_vcvtnq_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtnq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      { UINT64_C(                   0), UINT64_C(                  12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00), SIMDE_FLOAT64_C(    -3.50) },
+      {                     UINT64_MAX, UINT64_C(                   0) } },
+    #endif
+    { { SIMDE_FLOAT64_C(  -360.50), SIMDE_FLOAT64_C(  -292.50) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -668.50), SIMDE_FLOAT64_C(   975.65) },
+      { UINT64_C(                   0), UINT64_C(                 976) } },
+    { { SIMDE_FLOAT64_C(  -337.50), SIMDE_FLOAT64_C(   835.49) },
+      { UINT64_C(                   0), UINT64_C(                 835) } },
+    { { SIMDE_FLOAT64_C(   507.50), SIMDE_FLOAT64_C(  -303.50) },
+      { UINT64_C(                 508), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   116.58), SIMDE_FLOAT64_C(   168.48) },
+      { UINT64_C(                 117), UINT64_C(                 168) } },
+    { { SIMDE_FLOAT64_C(  -854.90), SIMDE_FLOAT64_C(  -294.50) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   247.20), SIMDE_FLOAT64_C(  -877.06) },
+      { UINT64_C(                 247), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -942.59), SIMDE_FLOAT64_C(  -702.73) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtnq_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_uint64x2_t r = simde_vcvtnq_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtms_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+       INT32_C(           0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(3000000000.00),
+                   INT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(   114.50),
+       INT32_C(         114) },
+    { SIMDE_FLOAT32_C(  -315.35),
+      -INT32_C(         316) },
+    { SIMDE_FLOAT32_C(  -617.76),
+      -INT32_C(         618) },
+    { SIMDE_FLOAT32_C(  -943.76),
+      -INT32_C(         944) },
+    { SIMDE_FLOAT32_C(    96.78),
+       INT32_C(          96) },
+    { SIMDE_FLOAT32_C(  -326.22),
+      -INT32_C(         327) },
+    { SIMDE_FLOAT32_C(  -917.92),
+      -INT32_C(         918) },
+    { SIMDE_FLOAT32_C(   786.50),
+       INT32_C(         786) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    int32_t r = simde_vcvtms_s32_f32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    int32_t r = simde_vcvtms_s32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtmd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+       INT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(10000000000000000000.00),
+                           INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   292.75),
+       INT64_C(                 292) },
+    { SIMDE_FLOAT64_C(  -344.70),
+      -INT64_C(                 345) },
+    { SIMDE_FLOAT64_C(   148.50),
+       INT64_C(                 148) },
+    { SIMDE_FLOAT64_C(    10.83),
+       INT64_C(                  10) },
+    { SIMDE_FLOAT64_C(  -129.50),
+      -INT64_C(                 130) },
+    { SIMDE_FLOAT64_C(  -862.50),
+      -INT64_C(                 863) },
+    { SIMDE_FLOAT64_C(  -429.21),
+      -INT64_C(                 430) },
+    { SIMDE_FLOAT64_C(  -890.50),
+      -INT64_C(                 891) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    int64_t r = simde_vcvtmd_s64_f64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    int64_t r = simde_vcvtmd_s64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtms_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+      UINT32_C(         0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(5000000000.00),
+                UINT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(  -790.50),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(    -7.50),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   214.50),
+      UINT32_C(       214) },
+    { SIMDE_FLOAT32_C(  -807.50),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   645.56),
+      UINT32_C(       645) },
+    { SIMDE_FLOAT32_C(  -284.17),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(    77.50),
+      UINT32_C(        77) },
+    { SIMDE_FLOAT32_C(   274.27),
+      UINT32_C(       274) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    uint32_t r = simde_vcvtms_u32_f32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    uint32_t r = simde_vcvtms_u32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtmd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+      UINT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(20000000000000000000.00),
+                          UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   127.34),
+      UINT64_C(                 127) },
+    { SIMDE_FLOAT64_C(  -653.93),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   506.99),
+      UINT64_C(                 506) },
+    { SIMDE_FLOAT64_C(    30.50),
+      UINT64_C(                  30) },
+    { SIMDE_FLOAT64_C(  -916.35),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(  -958.46),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   109.70),
+      UINT64_C(                 109) },
+    { SIMDE_FLOAT64_C(   986.50),
+      UINT64_C(                 986) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    uint64_t r = simde_vcvtmd_u64_f64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    uint64_t r = simde_vcvtmd_u64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtm_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      {  INT32_C(           0),  INT32_C(          12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00) },
+      {              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   -31.23), SIMDE_FLOAT32_C(   992.75) },
+      { -INT32_C(          32),  INT32_C(         992) } },
+    { { SIMDE_FLOAT32_C(  -611.41), SIMDE_FLOAT32_C(   -31.50) },
+      { -INT32_C(         612), -INT32_C(          32) } },
+    { { SIMDE_FLOAT32_C(  -311.03), SIMDE_FLOAT32_C(  -930.50) },
+      { -INT32_C(         312), -INT32_C(         931) } },
+    { { SIMDE_FLOAT32_C(   476.61), SIMDE_FLOAT32_C(   154.07) },
+      {  INT32_C(         476),  INT32_C(         154) } },
+    { { SIMDE_FLOAT32_C(  -268.70), SIMDE_FLOAT32_C(   119.68) },
+      { -INT32_C(         269),  INT32_C(         119) } },
+    { { SIMDE_FLOAT32_C(   430.30), SIMDE_FLOAT32_C(    46.50) },
+      {  INT32_C(         430),  INT32_C(          46) } },
+    { { SIMDE_FLOAT32_C(   180.50), SIMDE_FLOAT32_C(  -654.50) },
+      {  INT32_C(         180), -INT32_C(         655) } },
+    { { SIMDE_FLOAT32_C(   222.50), SIMDE_FLOAT32_C(  -171.50) },
+      {  INT32_C(         222), -INT32_C(         172) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvtm_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_int32x2_t r = simde_vcvtm_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtm_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    int64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      {  INT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00) },
+      {                      INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   389.17) },
+      {  INT64_C(                 389) } },
+    { { SIMDE_FLOAT64_C(  -910.32) },
+      { -INT64_C(                 911) } },
+    { { SIMDE_FLOAT64_C(  -398.50) },
+      { -INT64_C(                 399) } },
+    { { SIMDE_FLOAT64_C(  -303.50) },
+      { -INT64_C(                 304) } },
+    { { SIMDE_FLOAT64_C(   388.61) },
+      {  INT64_C(                 388) } },
+    { { SIMDE_FLOAT64_C(  -272.55) },
+      { -INT64_C(                 273) } },
+    { { SIMDE_FLOAT64_C(   128.24) },
+      {  INT64_C(                 128) } },
+    { { SIMDE_FLOAT64_C(   305.27) },
+      {  INT64_C(                 305) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_int64x1_t r = simde_vcvtm_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_int64x1_t r = simde_vcvtm_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtm_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      { UINT32_C(         0), UINT32_C(        12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50) },
+      {           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   352.50), SIMDE_FLOAT32_C(   402.03) },
+      { UINT32_C(       352), UINT32_C(       402) } },
+    { { SIMDE_FLOAT32_C(   626.96), SIMDE_FLOAT32_C(  -457.96) },
+      { UINT32_C(       626), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   812.77), SIMDE_FLOAT32_C(  -725.50) },
+      { UINT32_C(       812), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   600.43), SIMDE_FLOAT32_C(  -531.50) },
+      { UINT32_C(       600), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -256.73), SIMDE_FLOAT32_C(  -690.34) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   -69.95), SIMDE_FLOAT32_C(  -179.84) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   404.50), SIMDE_FLOAT32_C(   316.50) },
+      { UINT32_C(       404), UINT32_C(       316) } },
+    { { SIMDE_FLOAT32_C(   856.25), SIMDE_FLOAT32_C(   864.28) },
+      { UINT32_C(       856), UINT32_C(       864) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvtm_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_uint32x2_t r = simde_vcvtm_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtm_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    uint64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      { UINT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00) },
+      {                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(  -923.50) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   126.61) },
+      { UINT64_C(                 126) } },
+    { { SIMDE_FLOAT64_C(   513.83) },
+      { UINT64_C(                 513) } },
+    { { SIMDE_FLOAT64_C(  -484.82) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -623.79) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   121.50) },
+      { UINT64_C(                 121) } },
+    { { SIMDE_FLOAT64_C(   167.50) },
+      { UINT64_C(                 167) } },
+    { { SIMDE_FLOAT64_C(   220.50) },
+      { UINT64_C(                 220) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_uint64x1_t r = simde_vcvtm_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_uint64x1_t r = simde_vcvtm_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtmq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      {  INT32_C(           0),  INT32_C(          12), -INT32_C(           8),  INT32_C(           0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00), SIMDE_FLOAT32_C(2147483648.00), SIMDE_FLOAT32_C(-2147483648.00) },
+      {              INT32_MAX,              INT32_MIN,              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   651.86), SIMDE_FLOAT32_C(   227.95), SIMDE_FLOAT32_C(  -239.17), SIMDE_FLOAT32_C(  -408.50) },
+      {  INT32_C(         651),  INT32_C(         227), -INT32_C(         240), -INT32_C(         409) } },
+    { { SIMDE_FLOAT32_C(  -545.50), SIMDE_FLOAT32_C(   930.50), SIMDE_FLOAT32_C(    66.22), SIMDE_FLOAT32_C(   131.57) },
+      { -INT32_C(         546),  INT32_C(         930),  INT32_C(          66),  INT32_C(         131) } },
+    { { SIMDE_FLOAT32_C(   353.28), SIMDE_FLOAT32_C(   554.90), SIMDE_FLOAT32_C(  -298.50), SIMDE_FLOAT32_C(   113.74) },
+      {  INT32_C(         353),  INT32_C(         554), -INT32_C(         299),  INT32_C(         113) } },
+    { { SIMDE_FLOAT32_C(  -298.08), SIMDE_FLOAT32_C(  -139.03), SIMDE_FLOAT32_C(  -249.27), SIMDE_FLOAT32_C(  -416.71) },
+      { -INT32_C(         299), -INT32_C(         140), -INT32_C(         250), -INT32_C(         417) } },
+    { { SIMDE_FLOAT32_C(   744.49), SIMDE_FLOAT32_C(   972.50), SIMDE_FLOAT32_C(  -551.95), SIMDE_FLOAT32_C(  -870.94) },
+      {  INT32_C(         744),  INT32_C(         972), -INT32_C(         552), -INT32_C(         871) } },
+    { { SIMDE_FLOAT32_C(   548.84), SIMDE_FLOAT32_C(  -458.58), SIMDE_FLOAT32_C(   595.26), SIMDE_FLOAT32_C(   430.50) },
+      {  INT32_C(         548), -INT32_C(         459),  INT32_C(         595),  INT32_C(         430) } },
+    { { SIMDE_FLOAT32_C(  -810.50), SIMDE_FLOAT32_C(   697.50), SIMDE_FLOAT32_C(   597.50), SIMDE_FLOAT32_C(   236.42) },
+      { -INT32_C(         811),  INT32_C(         697),  INT32_C(         597),  INT32_C(         236) } },
+    { { SIMDE_FLOAT32_C(   -75.05), SIMDE_FLOAT32_C(    20.50), SIMDE_FLOAT32_C(   -11.50), SIMDE_FLOAT32_C(   709.50) },
+      { -INT32_C(          76),  INT32_C(          20), -INT32_C(          12),  INT32_C(         709) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtmq_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_int32x4_t r = simde_vcvtmq_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtmq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      {  INT64_C(                   0),  INT64_C(                  12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00), SIMDE_FLOAT64_C(-10000000000000000000.00) },
+      {                      INT64_MAX,                      INT64_MIN } },
+    #endif
+    { { SIMDE_FLOAT64_C(   -38.86), SIMDE_FLOAT64_C(  -300.56) },
+      { -INT64_C(                  39), -INT64_C(                 301) } },
+    { { SIMDE_FLOAT64_C(   713.50), SIMDE_FLOAT64_C(  -485.07) },
+      {  INT64_C(                 713), -INT64_C(                 486) } },
+    { { SIMDE_FLOAT64_C(  -678.50), SIMDE_FLOAT64_C(   984.50) },
+      { -INT64_C(                 679),  INT64_C(                 984) } },
+    { { SIMDE_FLOAT64_C(  -386.19), SIMDE_FLOAT64_C(   126.28) },
+      { -INT64_C(                 387),  INT64_C(                 126) } },
+    { { SIMDE_FLOAT64_C(  -412.94), SIMDE_FLOAT64_C(   552.50) },
+      { -INT64_C(                 413),  INT64_C(                 552) } },
+    { { SIMDE_FLOAT64_C(   511.69), SIMDE_FLOAT64_C(  -795.60) },
+      {  INT64_C(                 511), -INT64_C(                 796) } },
+    { { SIMDE_FLOAT64_C(  -701.79), SIMDE_FLOAT64_C(     3.17) },
+      { -INT64_C(                 702),  INT64_C(                   3) } },
+    { { SIMDE_FLOAT64_C(   749.21), SIMDE_FLOAT64_C(   655.72) },
+      {  INT64_C(                 749),  INT64_C(                 655) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtmq_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_int64x2_t r = simde_vcvtmq_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtmq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      { UINT32_C(         0), UINT32_C(        12), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50), SIMDE_FLOAT32_C(4294967296.00), SIMDE_FLOAT32_C(    -0.75) },
+      {           UINT32_MAX, UINT32_C(         0),           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   488.15), SIMDE_FLOAT32_C(  -936.45), SIMDE_FLOAT32_C(  -256.05), SIMDE_FLOAT32_C(   185.40) },
+      { UINT32_C(       488), UINT32_C(         0), UINT32_C(         0), UINT32_C(       185) } },
+    { { SIMDE_FLOAT32_C(  -415.99), SIMDE_FLOAT32_C(  -954.50), SIMDE_FLOAT32_C(   435.50), SIMDE_FLOAT32_C(  -901.50) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(       435), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   623.79), SIMDE_FLOAT32_C(  -701.50), SIMDE_FLOAT32_C(  -732.44), SIMDE_FLOAT32_C(    88.12) },
+      { UINT32_C(       623), UINT32_C(         0), UINT32_C(         0), UINT32_C(        88) } },
+    { { SIMDE_FLOAT32_C(   351.50), SIMDE_FLOAT32_C(   372.31), SIMDE_FLOAT32_C(   858.39), SIMDE_FLOAT32_C(  -618.98) },
+      { UINT32_C(       351), UINT32_C(       372), UINT32_C(       858), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -348.21), SIMDE_FLOAT32_C(   830.50), SIMDE_FLOAT32_C(  -525.50), SIMDE_FLOAT32_C(  -133.50) },
+      { UINT32_C(         0), UINT32_C(       830), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   309.50), SIMDE_FLOAT32_C(   993.50), SIMDE_FLOAT32_C(   318.50), SIMDE_FLOAT32_C(  -820.98) },
+      { UINT32_C(       309), UINT32_C(       993), UINT32_C(       318), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   265.76), SIMDE_FLOAT32_C(  -610.77), SIMDE_FLOAT32_C(   154.50), SIMDE_FLOAT32_C(  -443.02) },
+      { UINT32_C(       265), UINT32_C(         0), UINT32_C(       154), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   537.72), SIMDE_FLOAT32_C(   459.20), SIMDE_FLOAT32_C(  -812.35), SIMDE_FLOAT32_C(  -645.26) },
+      { UINT32_C(       537), UINT32_C(       459), UINT32_C(         0), UINT32_C(         0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtmq_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_uint32x4_t r = simde_vcvtmq_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtmq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      { UINT64_C(                   0), UINT64_C(                  12) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00), SIMDE_FLOAT64_C(    -3.50) },
+      {                     UINT64_MAX, UINT64_C(                   0) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   201.89), SIMDE_FLOAT64_C(  -542.98) },
+      { UINT64_C(                 201), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   681.82), SIMDE_FLOAT64_C(  -622.18) },
+      { UINT64_C(                 681), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -483.54), SIMDE_FLOAT64_C(  -150.85) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -190.50), SIMDE_FLOAT64_C(  -603.50) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(    -3.50), SIMDE_FLOAT64_C(  -417.40) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -357.47), SIMDE_FLOAT64_C(    77.50) },
+      { UINT64_C(                   0), UINT64_C(                  77) } },
+    { { SIMDE_FLOAT64_C(   381.59), SIMDE_FLOAT64_C(   271.04) },
+      { UINT64_C(                 381), UINT64_C(                 271) } },
+    { { SIMDE_FLOAT64_C(  -917.37), SIMDE_FLOAT64_C(  -822.50) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtmq_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_uint64x2_t r = simde_vcvtmq_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtps_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+       INT32_C(           0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(3000000000.00),
+                   INT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(   722.50),
+       INT32_C(         723) },
+    { SIMDE_FLOAT32_C(   -42.81),
+      -INT32_C(          42) },
+    { SIMDE_FLOAT32_C(  -517.62),
+      -INT32_C(         517) },
+    { SIMDE_FLOAT32_C(   420.15),
+       INT32_C(         421) },
+    { SIMDE_FLOAT32_C(  -894.10),
+      -INT32_C(         894) },
+    { SIMDE_FLOAT32_C(   459.50),
+       INT32_C(         460) },
+    { SIMDE_FLOAT32_C(   821.50),
+       INT32_C(         822) },
+    { SIMDE_FLOAT32_C(  -879.50),
+      -INT32_C(         879) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    int32_t r = simde_vcvtps_s32_f32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    int32_t r = simde_vcvtps_s32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtpd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+       INT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(10000000000000000000.00),
+                           INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(    74.50),
+       INT64_C(                  75) },
+    { SIMDE_FLOAT64_C(   904.50),
+       INT64_C(                 905) },
+    { SIMDE_FLOAT64_C(   724.53),
+       INT64_C(                 725) },
+    { SIMDE_FLOAT64_C(  -572.01),
+      -INT64_C(                 572) },
+    { SIMDE_FLOAT64_C(  -397.50),
+      -INT64_C(                 397) },
+    { SIMDE_FLOAT64_C(   226.50),
+       INT64_C(                 227) },
+    { SIMDE_FLOAT64_C(   692.50),
+       INT64_C(                 693) },
+    { SIMDE_FLOAT64_C(   799.65),
+       INT64_C(                 800) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    int64_t r = simde_vcvtpd_s64_f64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    int64_t r = simde_vcvtpd_s64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtps_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+      UINT32_C(         0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(5000000000.00),
+                UINT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(    84.66),
+      UINT32_C(        85) },
+    { SIMDE_FLOAT32_C(  -353.50),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   474.53),
+      UINT32_C(       475) },
+    { SIMDE_FLOAT32_C(   410.50),
+      UINT32_C(       411) },
+    { SIMDE_FLOAT32_C(   137.12),
+      UINT32_C(       138) },
+    { SIMDE_FLOAT32_C(   549.22),
+      UINT32_C(       550) },
+    { SIMDE_FLOAT32_C(   644.50),
+      UINT32_C(       645) },
+    { SIMDE_FLOAT32_C(  -368.63),
+      UINT32_C(         0) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    uint32_t r = simde_vcvtps_u32_f32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    uint32_t r = simde_vcvtps_u32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtpd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+      UINT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(20000000000000000000.00),
+                          UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(  -244.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   -96.83),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   602.61),
+      UINT64_C(                 603) },
+    { SIMDE_FLOAT64_C(   115.50),
+      UINT64_C(                 116) },
+    { SIMDE_FLOAT64_C(   808.29),
+      UINT64_C(                 809) },
+    { SIMDE_FLOAT64_C(  -169.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   442.31),
+      UINT64_C(                 443) },
+    { SIMDE_FLOAT64_C(   114.41),
+      UINT64_C(                 115) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    uint64_t r = simde_vcvtpd_u64_f64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    uint64_t r = simde_vcvtpd_u64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtp_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      {  INT32_C(           0),  INT32_C(          13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00) },
+      {              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   -15.49), SIMDE_FLOAT32_C(  -796.50) },
+      { -INT32_C(          15), -INT32_C(         796) } },
+    { { SIMDE_FLOAT32_C(  -569.50), SIMDE_FLOAT32_C(   587.34) },
+      { -INT32_C(         569),  INT32_C(         588) } },
+    { { SIMDE_FLOAT32_C(   316.50), SIMDE_FLOAT32_C(  -122.52) },
+      {  INT32_C(         317), -INT32_C(         122) } },
+    { { SIMDE_FLOAT32_C(   498.50), SIMDE_FLOAT32_C(   786.50) },
+      {  INT32_C(         499),  INT32_C(         787) } },
+    { { SIMDE_FLOAT32_C(  -823.07), SIMDE_FLOAT32_C(   395.74) },
+      { -INT32_C(         823),  INT32_C(         396) } },
+    { { SIMDE_FLOAT32_C(  -950.50), SIMDE_FLOAT32_C(  -139.50) },
+      { -INT32_C(         950), -INT32_C(         139) } },
+    { { SIMDE_FLOAT32_C(   766.58), SIMDE_FLOAT32_C(  -243.69) },
+      {  INT32_C(         767), -INT32_C(         243) } },
+    { { SIMDE_FLOAT32_C(   -32.68), SIMDE_FLOAT32_C(  -794.89) },
+      { -INT32_C(          32), -INT32_C(         794) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvtp_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_int32x2_t r = simde_vcvtp_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtp_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    int64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      {  INT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00) },
+      {                      INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   806.50) },
+      {  INT64_C(                 807) } },
+    { { SIMDE_FLOAT64_C(    69.50) },
+      {  INT64_C(                  70) } },
+    { { SIMDE_FLOAT64_C(  -147.12) },
+      { -INT64_C(                 147) } },
+    { { SIMDE_FLOAT64_C(  -946.50) },
+      { -INT64_C(                 946) } },
+    { { SIMDE_FLOAT64_C(   632.81) },
+      {  INT64_C(                 633) } },
+    { { SIMDE_FLOAT64_C(  -933.10) },
+      { -INT64_C(                 933) } },
+    { { SIMDE_FLOAT64_C(   414.47) },
+      {  INT64_C(                 415) } },
+    { { SIMDE_FLOAT64_C(   969.24) },
+      {  INT64_C(                 970) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_int64x1_t r = simde_vcvtp_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_int64x1_t r = simde_vcvtp_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtp_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      { UINT32_C(         0), UINT32_C(        13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50) },
+      {           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -278.82), SIMDE_FLOAT32_C(  -490.32) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -292.00), SIMDE_FLOAT32_C(   949.50) },
+      { UINT32_C(         0), UINT32_C(       950) } },
+    { { SIMDE_FLOAT32_C(  -704.97), SIMDE_FLOAT32_C(  -402.28) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   768.40), SIMDE_FLOAT32_C(   515.80) },
+      { UINT32_C(       769), UINT32_C(       516) } },
+    { { SIMDE_FLOAT32_C(  -816.55), SIMDE_FLOAT32_C(  -321.50) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   163.22), SIMDE_FLOAT32_C(   537.50) },
+      { UINT32_C(       164), UINT32_C(       538) } },
+    { { SIMDE_FLOAT32_C(  -963.77), SIMDE_FLOAT32_C(  -951.50) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   238.46), SIMDE_FLOAT32_C(  -814.63) },
+      { UINT32_C(       239), UINT32_C(         0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvtp_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_uint32x2_t r = simde_vcvtp_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtp_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    uint64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      { UINT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00) },
+      {                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(  -109.99) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   595.62) },
+      { UINT64_C(                 596) } },
+    { { SIMDE_FLOAT64_C(   620.50) },
+      { UINT64_C(                 621) } },
+    { { SIMDE_FLOAT64_C(   393.50) },
+      { UINT64_C(                 394) } },
+    { { SIMDE_FLOAT64_C(   692.20) },
+      { UINT64_C(                 693) } },
+    { { SIMDE_FLOAT64_C(  -524.13) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -108.57) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   651.72) },
+      { UINT64_C(                 652) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_uint64x1_t r = simde_vcvtp_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_uint64x1_t r = simde_vcvtp_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtpq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      {  INT32_C(           0),  INT32_C(          13), -INT32_C(           7),  INT32_C(           0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00), SIMDE_FLOAT32_C(2147483648.00), SIMDE_FLOAT32_C(-2147483648.00) },
+      {              INT32_MAX,              INT32_MIN,              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -580.50), SIMDE_FLOAT32_C(    61.50), SIMDE_FLOAT32_C(    59.25), SIMDE_FLOAT32_C(  -653.00) },
+      { -INT32_C(         580),  INT32_C(          62),  INT32_C(          60), -INT32_C(         653) } },
+    { { SIMDE_FLOAT32_C(  -658.50), SIMDE_FLOAT32_C(   185.83), SIMDE_FLOAT32_C(  -255.50), SIMDE_FLOAT32_C(    11.06) },
+      { -INT32_C(         658),  INT32_C(         186), -INT32_C(         255),  INT32_C(          12) } },
+    { { SIMDE_FLOAT32_C(  -993.05), SIMDE_FLOAT32_C(  -598.03), SIMDE_FLOAT32_C(    12.84), SIMDE_FLOAT32_C(  -949.96) },
+      { -INT32_C(         993), -INT32_C(         598),  INT32_C(          13), -INT32_C(         949) } },
+    { { SIMDE_FLOAT32_C(   529.50), SIMDE_FLOAT32_C(  -989.08), SIMDE_FLOAT32_C(   376.57), SIMDE_FLOAT32_C(  -351.15) },
+      {  INT32_C(         530), -INT32_C(         989),  INT32_C(         377), -INT32_C(         351) } },
+    { { SIMDE_FLOAT32_C(   562.50), SIMDE_FLOAT32_C(   780.23), SIMDE_FLOAT32_C(   419.80), SIMDE_FLOAT32_C(  -158.61) },
+      {  INT32_C(         563),  INT32_C(         781),  INT32_C(         420), -INT32_C(         158) } },
+    { { SIMDE_FLOAT32_C(   834.36), SIMDE_FLOAT32_C(  -219.33), SIMDE_FLOAT32_C(   902.15), SIMDE_FLOAT32_C(   -54.47) },
+      {  INT32_C(         835), -INT32_C(         219),  INT32_C(         903), -INT32_C(          54) } },
+    { { SIMDE_FLOAT32_C(   159.08), SIMDE_FLOAT32_C(   645.50), SIMDE_FLOAT32_C(   408.53), SIMDE_FLOAT32_C(   423.12) },
+      {  INT32_C(         160),  INT32_C(         646),  INT32_C(         409),  INT32_C(         424) } },
+    { { SIMDE_FLOAT32_C(  -638.34), SIMDE_FLOAT32_C(   544.30), SIMDE_FLOAT32_C(   365.76), SIMDE_FLOAT32_C(   831.50) },
+      { -INT32_C(         638),  INT32_C(         545),  INT32_C(         366),  INT32_C(         832) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtpq_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_int32x4_t r = simde_vcvtpq_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtpq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      {  INT64_C(                   0),  INT64_C(                  13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00), SIMDE_FLOAT64_C(-10000000000000000000.00) },
+      {                      INT64_MAX,                      INT64_MIN } },
+    #endif
+    { { SIMDE_FLOAT64_C(   670.53), SIMDE_FLOAT64_C(   231.50) },
+      {  INT64_C(                 671),  INT64_C(                 232) } },
+    { { SIMDE_FLOAT64_C(   305.34), SIMDE_FLOAT64_C(   130.77) },
+      {  INT64_C(                 306),  INT64_C(                 131) } },
+    { { SIMDE_FLOAT64_C(   546.02), SIMDE_FLOAT64_C(  -665.26) },
+      {  INT64_C(                 547), -INT64_C(                 665) } },
+    { { SIMDE_FLOAT64_C(  -524.16), SIMDE_FLOAT64_C(  -976.56) },
+      { -INT64_C(                 524), -INT64_C(                 976) } },
+    { { SIMDE_FLOAT64_C(  -934.70), SIMDE_FLOAT64_C(   339.22) },
+      { -INT64_C(                 934),  INT64_C(                 340) } },
+    { { SIMDE_FLOAT64_C(   607.49), SIMDE_FLOAT64_C(   856.41) },
+      {  INT64_C(                 608),  INT64_C(                 857) } },
+    { { SIMDE_FLOAT64_C(  -725.50), SIMDE_FLOAT64_C(   696.34) },
+      { -INT64_C(                 725),  INT64_C(                 697) } },
+    { { SIMDE_FLOAT64_C(   283.00), SIMDE_FLOAT64_C(   861.66) },
+      {  INT64_C(                 283),  INT64_C(                 862) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtpq_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_int64x2_t r = simde_vcvtpq_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtpq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      { UINT32_C(         0), UINT32_C(        13), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50), SIMDE_FLOAT32_C(4294967296.00), SIMDE_FLOAT32_C(    -0.75) },
+      {           UINT32_MAX, UINT32_C(         0),           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -542.45), SIMDE_FLOAT32_C(  -850.50), SIMDE_FLOAT32_C(  -558.94), SIMDE_FLOAT32_C(   920.93) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       921) } },
+    { { SIMDE_FLOAT32_C(  -166.50), SIMDE_FLOAT32_C(  -498.89), SIMDE_FLOAT32_C(   738.50), SIMDE_FLOAT32_C(  -653.58) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(       739), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -598.15), SIMDE_FLOAT32_C(  -112.95), SIMDE_FLOAT32_C(   706.50), SIMDE_FLOAT32_C(   573.43) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(       707), UINT32_C(       574) } },
+    { { SIMDE_FLOAT32_C(  -574.50), SIMDE_FLOAT32_C(   152.96), SIMDE_FLOAT32_C(  -429.50), SIMDE_FLOAT32_C(  -207.70) },
+      { UINT32_C(         0), UINT32_C(       153), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -322.43), SIMDE_FLOAT32_C(   619.83), SIMDE_FLOAT32_C(  -963.50), SIMDE_FLOAT32_C(  -551.83) },
+      { UINT32_C(         0), UINT32_C(       620), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -819.85), SIMDE_FLOAT32_C(  -267.12), SIMDE_FLOAT32_C(   139.46), SIMDE_FLOAT32_C(   -99.26) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(       140), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   -24.75), SIMDE_FLOAT32_C(  -231.28), SIMDE_FLOAT32_C(   118.87), SIMDE_FLOAT32_C(  -596.69) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(       119), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   773.50), SIMDE_FLOAT32_C(   -93.31), SIMDE_FLOAT32_C(  -549.50), SIMDE_FLOAT32_C(  -462.84) },
+      { UINT32_C(       774), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtpq_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_uint32x4_t r = simde_vcvtpq_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtpq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      { UINT64_C(                   0), UINT64_C(                  13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00), SIMDE_FLOAT64_C(    -3.50) },
+      {                     UINT64_MAX, UINT64_C(                   0) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   561.92), SIMDE_FLOAT64_C(  -880.50) },
+      { UINT64_C(                 562), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -511.25), SIMDE_FLOAT64_C(  -182.72) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -645.50), SIMDE_FLOAT64_C(    81.78) },
+      { UINT64_C(                   0), UINT64_C(                  82) } },
+    { { SIMDE_FLOAT64_C(  -933.20), SIMDE_FLOAT64_C(   211.16) },
+      { UINT64_C(                   0), UINT64_C(                 212) } },
+    { { SIMDE_FLOAT64_C(   409.57), SIMDE_FLOAT64_C(   129.51) },
+      { UINT64_C(                 410), UINT64_C(                 130) } },
+    { { SIMDE_FLOAT64_C(  -439.50), SIMDE_FLOAT64_C(   996.50) },
+      { UINT64_C(                   0), UINT64_C(                 997) } },
+    { { SIMDE_FLOAT64_C(   -69.98), SIMDE_FLOAT64_C(  -371.50) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   920.50), SIMDE_FLOAT64_C(  -805.50) },
+      { UINT64_C(                 921), UINT64_C(                   0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtpq_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_uint64x2_t r = simde_vcvtpq_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtas_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+       INT32_C(           0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(3000000000.00),
+                   INT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(   981.22),
+       INT32_C(         981) },
+    { SIMDE_FLOAT32_C(   881.57),
+       INT32_C(         882) },
+    { SIMDE_FLOAT32_C(  -524.50),
+      -INT32_C(         525) },
+    { SIMDE_FLOAT32_C(   209.65),
+       INT32_C(         210) },
+    { SIMDE_FLOAT32_C(   935.71),
+       INT32_C(         936) },
+    { SIMDE_FLOAT32_C(  -608.50),
+      -INT32_C(         609) },
+    { SIMDE_FLOAT32_C(   645.04),
+       INT32_C(         645) },
+    { SIMDE_FLOAT32_C(   961.37),
+       INT32_C(         961) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    int32_t r = simde_vcvtas_s32_f32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    int32_t r = simde_vcvtas_s32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtad_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+       INT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(10000000000000000000.00),
+                           INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(  -152.15),
+      -INT64_C(                 152) },
+    { SIMDE_FLOAT64_C(   736.96),
+       INT64_C(                 737) },
+    { SIMDE_FLOAT64_C(   259.53),
+       INT64_C(                 260) },
+    { SIMDE_FLOAT64_C(   -17.05),
+      -INT64_C(                  17) },
+    { SIMDE_FLOAT64_C(   528.50),
+       INT64_C(                 529) },
+    { SIMDE_FLOAT64_C(   587.77),
+       INT64_C(                 588) },
+    { SIMDE_FLOAT64_C(  -686.53),
+      -INT64_C(                 687) },
+    { SIMDE_FLOAT64_C(   -47.19),
+      -INT64_C(                  47) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    int64_t r = simde_vcvtad_s64_f64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    int64_t r = simde_vcvtad_s64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtas_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {            SIMDE_MATH_NANF,
+      UINT32_C(         0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT32_C(5000000000.00),
+                UINT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(   709.06),
+      UINT32_C(       709) },
+    { SIMDE_FLOAT32_C(  -243.55),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   240.50),
+      UINT32_C(       241) },
+    { SIMDE_FLOAT32_C(  -489.92),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(  -290.66),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(   932.50),
+      UINT32_C(       933) },
+    { SIMDE_FLOAT32_C(   -44.50),
+      UINT32_C(         0) },
+    { SIMDE_FLOAT32_C(  -694.86),
+      UINT32_C(         0) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 a = test_vec[i].a;
+    uint32_t r = simde_vcvtas_u32_f32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0, 1000.0);
+    uint32_t r = simde_vcvtas_u32_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtad_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {             SIMDE_MATH_NAN,
+      UINT64_C(                   0) },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { SIMDE_FLOAT64_C(20000000000000000000.00),
+                          UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   218.50),
+      UINT64_C(                 219) },
+    { SIMDE_FLOAT64_C(  -584.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(  -943.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(  -827.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   947.50),
+      UINT64_C(                 948) },
+    { SIMDE_FLOAT64_C(    35.55),
+      UINT64_C(                  36) },
+    { SIMDE_FLOAT64_C(  -273.50),
+      UINT64_C(                   0) },
+    { SIMDE_FLOAT64_C(   710.69),
+      UINT64_C(                 711) },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 a = test_vec[i].a;
+    uint64_t r = simde_vcvtad_u64_f64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    uint64_t r = simde_vcvtad_u64_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvta_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      {  INT32_C(           0),  INT32_C(          13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00) },
+      {              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   619.89), SIMDE_FLOAT32_C(    37.50) },
+      {  INT32_C(         620),  INT32_C(          38) } },
+    { { SIMDE_FLOAT32_C(   717.50), SIMDE_FLOAT32_C(   407.15) },
+      {  INT32_C(         718),  INT32_C(         407) } },
+    { { SIMDE_FLOAT32_C(  -155.50), SIMDE_FLOAT32_C(   915.50) },
+      { -INT32_C(         156),  INT32_C(         916) } },
+    { { SIMDE_FLOAT32_C(  -325.50), SIMDE_FLOAT32_C(   113.13) },
+      { -INT32_C(         326),  INT32_C(         113) } },
+    { { SIMDE_FLOAT32_C(   439.84), SIMDE_FLOAT32_C(   760.42) },
+      {  INT32_C(         440),  INT32_C(         760) } },
+    { { SIMDE_FLOAT32_C(   686.45), SIMDE_FLOAT32_C(  -758.50) },
+      {  INT32_C(         686), -INT32_C(         759) } },
+    { { SIMDE_FLOAT32_C(  -648.50), SIMDE_FLOAT32_C(   745.50) },
+      { -INT32_C(         649),  INT32_C(         746) } },
+    { { SIMDE_FLOAT32_C(  -209.50), SIMDE_FLOAT32_C(  -779.50) },
+      { -INT32_C(         210), -INT32_C(         780) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvta_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_int32x2_t r = simde_vcvta_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvta_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    int64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      {  INT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00) },
+      {                      INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   769.90) },
+      {  INT64_C(                 770) } },
+    { { SIMDE_FLOAT64_C(  -519.69) },
+      { -INT64_C(                 520) } },
+    { { SIMDE_FLOAT64_C(   520.39) },
+      {  INT64_C(                 520) } },
+    { { SIMDE_FLOAT64_C(   986.40) },
+      {  INT64_C(                 986) } },
+    { { SIMDE_FLOAT64_C(  -981.07) },
+      { -INT64_C(                 981) } },
+    { { SIMDE_FLOAT64_C(   448.50) },
+      {  INT64_C(                 449) } },
+    { { SIMDE_FLOAT64_C(   618.50) },
+      {  INT64_C(                 619) } },
+    { { SIMDE_FLOAT64_C(  -913.41) },
+      { -INT64_C(                 913) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_int64x1_t r = simde_vcvta_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_int64x1_t r = simde_vcvta_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvta_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50) },
+      { UINT32_C(         0), UINT32_C(        13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50) },
+      {           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   205.50), SIMDE_FLOAT32_C(   -99.57) },
+      { UINT32_C(       206), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -334.50), SIMDE_FLOAT32_C(   575.69) },
+      { UINT32_C(         0), UINT32_C(       576) } },
+    { { SIMDE_FLOAT32_C(   -49.50), SIMDE_FLOAT32_C(  -460.20) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -514.25), SIMDE_FLOAT32_C(   437.04) },
+      { UINT32_C(         0), UINT32_C(       437) } },
+    { { SIMDE_FLOAT32_C(   575.75), SIMDE_FLOAT32_C(    98.86) },
+      { UINT32_C(       576), UINT32_C(        99) } },
+    { { SIMDE_FLOAT32_C(  -786.50), SIMDE_FLOAT32_C(  -795.05) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(   109.50), SIMDE_FLOAT32_C(  -529.27) },
+      { UINT32_C(       110), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -252.50), SIMDE_FLOAT32_C(  -696.90) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvta_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0, 1000.0);
+    simde_uint32x2_t r = simde_vcvta_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvta_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    uint64_t r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN },
+      { UINT64_C(                   0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00) },
+      {                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   256.61) },
+      { UINT64_C(                 257) } },
+    { { SIMDE_FLOAT64_C(  -624.28) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -281.23) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   231.50) },
+      { UINT64_C(                 232) } },
+    { { SIMDE_FLOAT64_C(  -607.50) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -883.78) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -724.63) },
+      { UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(    34.50) },
+      { UINT64_C(                  35) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_uint64x1_t r = simde_vcvta_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_uint64x1_t r = simde_vcvta_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtaq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      {  INT32_C(           0),  INT32_C(          13), -INT32_C(           7),  INT32_C(           0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(3000000000.00), SIMDE_FLOAT32_C(-3000000000.00), SIMDE_FLOAT32_C(2147483648.00), SIMDE_FLOAT32_C(-2147483648.00) },
+      {              INT32_MAX,              INT32_MIN,              INT32_MAX,              INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   280.89), SIMDE_FLOAT32_C(   -24.50), SIMDE_FLOAT32_C(  -344.01), SIMDE_FLOAT32_C(  -804.80) },
+      {  INT32_C(         281), -INT32_C(          25), -INT32_C(         344), -INT32_C(         805) } },
+    { { SIMDE_FLOAT32_C(   223.37), SIMDE_FLOAT32_C(  -946.31), SIMDE_FLOAT32_C(   281.19), SIMDE_FLOAT32_C(   -83.32) },
+      {  INT32_C(         223), -INT32_C(         946),  INT32_C(         281), -INT32_C(          83) } },
+    { { SIMDE_FLOAT32_C(   602.50), SIMDE_FLOAT32_C(   188.50), SIMDE_FLOAT32_C(   253.67), SIMDE_FLOAT32_C(  -941.50) },
+      {  INT32_C(         603),  INT32_C(         189),  INT32_C(         254), -INT32_C(         942) } },
+    { { SIMDE_FLOAT32_C(  -619.52), SIMDE_FLOAT32_C(    77.95), SIMDE_FLOAT32_C(  -566.18), SIMDE_FLOAT32_C(    49.77) },
+      { -INT32_C(         620),  INT32_C(          78), -INT32_C(         566),  INT32_C(          50) } },
+    { { SIMDE_FLOAT32_C(  -843.37), SIMDE_FLOAT32_C(  -594.50), SIMDE_FLOAT32_C(   240.55), SIMDE_FLOAT32_C(   322.91) },
+      { -INT32_C(         843), -INT32_C(         595),  INT32_C(         241),  INT32_C(         323) } },
+    { { SIMDE_FLOAT32_C(  -129.50), SIMDE_FLOAT32_C(  -978.90), SIMDE_FLOAT32_C(   929.81), SIMDE_FLOAT32_C(   263.56) },
+      { -INT32_C(         130), -INT32_C(         979),  INT32_C(         930),  INT32_C(         264) } },
+    { { SIMDE_FLOAT32_C(  -285.77), SIMDE_FLOAT32_C(   959.84), SIMDE_FLOAT32_C(  -515.11), SIMDE_FLOAT32_C(   566.50) },
+      { -INT32_C(         286),  INT32_C(         960), -INT32_C(         515),  INT32_C(         567) } },
+    { { SIMDE_FLOAT32_C(   264.50), SIMDE_FLOAT32_C(   736.50), SIMDE_FLOAT32_C(   977.98), SIMDE_FLOAT32_C(  -444.50) },
+      {  INT32_C(         265),  INT32_C(         737),  INT32_C(         978), -INT32_C(         445) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtaq_s32_f32(a);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_int32x4_t r = simde_vcvtaq_s32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtaq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      {  INT64_C(                   0),  INT64_C(                  13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(10000000000000000000.00), SIMDE_FLOAT64_C(-10000000000000000000.00) },
+      {                      INT64_MAX,                      INT64_MIN } },
+    #endif
+    { { SIMDE_FLOAT64_C(   387.50), SIMDE_FLOAT64_C(  -699.50) },
+      {  INT64_C(                 388), -INT64_C(                 700) } },
+    { { SIMDE_FLOAT64_C(   753.50), SIMDE_FLOAT64_C(   497.00) },
+      {  INT64_C(                 754),  INT64_C(                 497) } },
+    { { SIMDE_FLOAT64_C(  -576.50), SIMDE_FLOAT64_C(  -446.06) },
+      { -INT64_C(                 577), -INT64_C(                 446) } },
+    { { SIMDE_FLOAT64_C(  -596.11), SIMDE_FLOAT64_C(   156.70) },
+      { -INT64_C(                 596),  INT64_C(                 157) } },
+    { { SIMDE_FLOAT64_C(  -672.90), SIMDE_FLOAT64_C(   109.80) },
+      { -INT64_C(                 673),  INT64_C(                 110) } },
+    { { SIMDE_FLOAT64_C(  -146.50), SIMDE_FLOAT64_C(  -536.50) },
+      { -INT64_C(                 147), -INT64_C(                 537) } },
+    { { SIMDE_FLOAT64_C(  -242.91), SIMDE_FLOAT64_C(   489.50) },
+      { -INT64_C(                 243),  INT64_C(                 490) } },
+    { { SIMDE_FLOAT64_C(  -608.50), SIMDE_FLOAT64_C(    41.84) },
+      { -INT64_C(                 609),  INT64_C(                  42) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtaq_s64_f64(a);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_int64x2_t r = simde_vcvtaq_s64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtaq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(    -7.25),            SIMDE_MATH_NANF },
+      { UINT32_C(         0), UINT32_C(        13), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT32_C(5000000000.00), SIMDE_FLOAT32_C(    -3.50), SIMDE_FLOAT32_C(4294967296.00), SIMDE_FLOAT32_C(    -0.75) },
+      {           UINT32_MAX, UINT32_C(         0),           UINT32_MAX, UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -344.41), SIMDE_FLOAT32_C(  -619.50), SIMDE_FLOAT32_C(  -859.50), SIMDE_FLOAT32_C(  -894.22) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(  -630.79), SIMDE_FLOAT32_C(  -355.50), SIMDE_FLOAT32_C(  -898.50), SIMDE_FLOAT32_C(   932.50) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       933) } },
+    { { SIMDE_FLOAT32_C(  -631.07), SIMDE_FLOAT32_C(   321.50), SIMDE_FLOAT32_C(  -394.50), SIMDE_FLOAT32_C(   240.27) },
+      { UINT32_C(         0), UINT32_C(       322), UINT32_C(         0), UINT32_C(       240) } },
+    { { SIMDE_FLOAT32_C(  -782.52), SIMDE_FLOAT32_C(   365.50), SIMDE_FLOAT32_C(   412.50), SIMDE_FLOAT32_C(   645.41) },
+      { UINT32_C(         0), UINT32_C(       366), UINT32_C(       413), UINT32_C(       645) } },
+    { { SIMDE_FLOAT32_C(   723.47), SIMDE_FLOAT32_C(   935.13), SIMDE_FLOAT32_C(   953.50), SIMDE_FLOAT32_C(  -846.68) },
+      { UINT32_C(       723), UINT32_C(       935), UINT32_C(       954), UINT32_C(         0) } },
+    { { SIMDE_FLOAT32_C(    21.53), SIMDE_FLOAT32_C(   967.38), SIMDE_FLOAT32_C(  -152.16), SIMDE_FLOAT32_C(   630.15) },
+      { UINT32_C(        22), UINT32_C(       967), UINT32_C(         0), UINT32_C(       630) } },
+    { { SIMDE_FLOAT32_C(   594.50), SIMDE_FLOAT32_C(   686.50), SIMDE_FLOAT32_C(   754.07), SIMDE_FLOAT32_C(   718.91) },
+      { UINT32_C(       595), UINT32_C(       687), UINT32_C(       754), UINT32_C(       719) } },
+    { { SIMDE_FLOAT32_C(   771.50), SIMDE_FLOAT32_C(   990.79), SIMDE_FLOAT32_C(    14.73), SIMDE_FLOAT32_C(   359.29) },
+      { UINT32_C(       772), UINT32_C(       991), UINT32_C(        15), UINT32_C(       359) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtaq_u32_f32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0, 1000.0);
+    simde_uint32x4_t r = simde_vcvtaq_u32_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vcvtaq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    12.50) },
+      { UINT64_C(                   0), UINT64_C(                  13) } },
+    #endif
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+    { { SIMDE_FLOAT64_C(20000000000000000000.00), SIMDE_FLOAT64_C(    -3.50) },
+      {                     UINT64_MAX, UINT64_C(                   0) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   388.50), SIMDE_FLOAT64_C(  -404.36) },
+      { UINT64_C(                 389), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -352.41), SIMDE_FLOAT64_C(  -922.38) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -795.15), SIMDE_FLOAT64_C(  -709.94) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(  -287.48), SIMDE_FLOAT64_C(   743.42) },
+      { UINT64_C(                   0), UINT64_C(                 743) } },
+    { { SIMDE_FLOAT64_C(  -824.50), SIMDE_FLOAT64_C(  -733.70) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { { SIMDE_FLOAT64_C(   591.43), SIMDE_FLOAT64_C(   937.50) },
+      { UINT64_C(                 591), UINT64_C(                 938) } },
+    { { SIMDE_FLOAT64_C(   835.74), SIMDE_FLOAT64_C(   222.50) },
+      { UINT64_C(                 836), UINT64_C(                 223) } },
+    { { SIMDE_FLOAT64_C(   545.50), SIMDE_FLOAT64_C(   237.28) },
+      { UINT64_C(                 546), UINT64_C(                 237) } },
+
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtaq_u64_f64(a);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_uint64x2_t r = simde_vcvtaq_u64_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f32_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f64_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f32_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f64_u64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f32_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f64_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f32_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_f64_u64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f16_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_high_f16_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f32_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_high_f32_f16)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtns_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnd_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtns_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnd_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtn_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtn_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtn_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtn_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtms_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmd_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtms_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmd_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtm_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtm_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtm_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtm_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtps_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpd_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtps_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpd_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtp_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtp_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtp_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtp_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtas_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtad_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtas_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtad_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvta_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvta_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvta_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvta_u64_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_s32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_s64_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_u32_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_u64_f64)
 SIMDE_TEST_FUNC_LIST_END
 
 #include "test-neon-footer.h"
@@ -29,17 +29,29 @@ SIMDE_TEST_DECLARE_SUITE(cnt)
 SIMDE_TEST_DECLARE_SUITE(cvt)
 SIMDE_TEST_DECLARE_SUITE(combine)
 SIMDE_TEST_DECLARE_SUITE(create)
+SIMDE_TEST_DECLARE_SUITE(div)
 SIMDE_TEST_DECLARE_SUITE(dot)
 SIMDE_TEST_DECLARE_SUITE(dot_lane)
 SIMDE_TEST_DECLARE_SUITE(dup_n)
 SIMDE_TEST_DECLARE_SUITE(dup_lane)
 SIMDE_TEST_DECLARE_SUITE(eor)
 SIMDE_TEST_DECLARE_SUITE(ext)
+SIMDE_TEST_DECLARE_SUITE(fma)
+SIMDE_TEST_DECLARE_SUITE(fma_lane)
+SIMDE_TEST_DECLARE_SUITE(fma_n)
+SIMDE_TEST_DECLARE_SUITE(fms)
+SIMDE_TEST_DECLARE_SUITE(fms_lane)
+SIMDE_TEST_DECLARE_SUITE(fms_n)
 SIMDE_TEST_DECLARE_SUITE(get_high)
 SIMDE_TEST_DECLARE_SUITE(get_lane)
 SIMDE_TEST_DECLARE_SUITE(get_low)
 SIMDE_TEST_DECLARE_SUITE(hadd)
 SIMDE_TEST_DECLARE_SUITE(hsub)
+SIMDE_TEST_DECLARE_SUITE(ld1_dup)
+SIMDE_TEST_DECLARE_SUITE(ld1_lane)
+SIMDE_TEST_DECLARE_SUITE(ld1_x2)
+SIMDE_TEST_DECLARE_SUITE(ld1_x3)
+SIMDE_TEST_DECLARE_SUITE(ld1_x4)
 SIMDE_TEST_DECLARE_SUITE(max)
 SIMDE_TEST_DECLARE_SUITE(maxnm)
 SIMDE_TEST_DECLARE_SUITE(maxv)
@@ -80,15 +92,21 @@ SIMDE_TEST_DECLARE_SUITE(qdmulh)
 SIMDE_TEST_DECLARE_SUITE(qdmull)
 SIMDE_TEST_DECLARE_SUITE(qrdmulh)
 SIMDE_TEST_DECLARE_SUITE(qrdmulh_n)
+SIMDE_TEST_DECLARE_SUITE(qrshrn_n)
+SIMDE_TEST_DECLARE_SUITE(qrshrun_n)
 SIMDE_TEST_DECLARE_SUITE(qmovn)
 SIMDE_TEST_DECLARE_SUITE(qmovn_high)
 SIMDE_TEST_DECLARE_SUITE(qmovun)
 SIMDE_TEST_DECLARE_SUITE(qneg)
+SIMDE_TEST_DECLARE_SUITE(qshrn_n)
+SIMDE_TEST_DECLARE_SUITE(qshrun_n)
 SIMDE_TEST_DECLARE_SUITE(qshl)
 SIMDE_TEST_DECLARE_SUITE(qsub)
 SIMDE_TEST_DECLARE_SUITE(qtbl)
 SIMDE_TEST_DECLARE_SUITE(qtbx)
 SIMDE_TEST_DECLARE_SUITE(rbit)
+SIMDE_TEST_DECLARE_SUITE(recpe)
+SIMDE_TEST_DECLARE_SUITE(recps)
 SIMDE_TEST_DECLARE_SUITE(reinterpret)
 SIMDE_TEST_DECLARE_SUITE(rev16)
 SIMDE_TEST_DECLARE_SUITE(rev32)
@@ -101,15 +119,23 @@ SIMDE_TEST_DECLARE_SUITE(rndn)
 SIMDE_TEST_DECLARE_SUITE(rndp)
 SIMDE_TEST_DECLARE_SUITE(rshl)
 SIMDE_TEST_DECLARE_SUITE(rshr_n)
+SIMDE_TEST_DECLARE_SUITE(rshrn_n)
+SIMDE_TEST_DECLARE_SUITE(rsqrte)
+SIMDE_TEST_DECLARE_SUITE(rsqrts)
 SIMDE_TEST_DECLARE_SUITE(rsra_n)
 SIMDE_TEST_DECLARE_SUITE(set_lane)
+SIMDE_TEST_DECLARE_SUITE(sqrt)
 SIMDE_TEST_DECLARE_SUITE(st1_lane)
+SIMDE_TEST_DECLARE_SUITE(st2)
 SIMDE_TEST_DECLARE_SUITE(st3)
 SIMDE_TEST_DECLARE_SUITE(st4)
 SIMDE_TEST_DECLARE_SUITE(shl)
 SIMDE_TEST_DECLARE_SUITE(shl_n)
 SIMDE_TEST_DECLARE_SUITE(shr_n)
+SIMDE_TEST_DECLARE_SUITE(shrn_n)
+SIMDE_TEST_DECLARE_SUITE(sli_n)
 SIMDE_TEST_DECLARE_SUITE(sra_n)
+SIMDE_TEST_DECLARE_SUITE(sri_n)
 SIMDE_TEST_DECLARE_SUITE(sub)
 SIMDE_TEST_DECLARE_SUITE(subl)
 SIMDE_TEST_DECLARE_SUITE(subw)
@@ -0,0 +1,245 @@
+#define SIMDE_TEST_ARM_NEON_INSN div
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/div.h"
+
+static int
+test_simde_vdiv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   541.32), SIMDE_FLOAT32_C(  -988.45) },
+      { SIMDE_FLOAT32_C(   999.10), SIMDE_FLOAT32_C(  -796.36) },
+      { SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(     1.24) } },
+    { { SIMDE_FLOAT32_C(  -264.50), SIMDE_FLOAT32_C(   912.02) },
+      { SIMDE_FLOAT32_C(  -700.94), SIMDE_FLOAT32_C(  -437.30) },
+      { SIMDE_FLOAT32_C(     0.38), SIMDE_FLOAT32_C(    -2.09) } },
+    { { SIMDE_FLOAT32_C(   343.25), SIMDE_FLOAT32_C(  -411.97) },
+      { SIMDE_FLOAT32_C(   343.13), SIMDE_FLOAT32_C(  -712.23) },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     0.58) } },
+    { { SIMDE_FLOAT32_C(   571.06), SIMDE_FLOAT32_C(  -313.22) },
+      { SIMDE_FLOAT32_C(  -319.39), SIMDE_FLOAT32_C(   561.59) },
+      { SIMDE_FLOAT32_C(    -1.79), SIMDE_FLOAT32_C(    -0.56) } },
+    { { SIMDE_FLOAT32_C(   -16.25), SIMDE_FLOAT32_C(   726.47) },
+      { SIMDE_FLOAT32_C(   296.53), SIMDE_FLOAT32_C(   275.48) },
+      { SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(     2.64) } },
+    { { SIMDE_FLOAT32_C(   172.51), SIMDE_FLOAT32_C(   262.17) },
+      { SIMDE_FLOAT32_C(   -98.22), SIMDE_FLOAT32_C(  -912.30) },
+      { SIMDE_FLOAT32_C(    -1.76), SIMDE_FLOAT32_C(    -0.29) } },
+    { { SIMDE_FLOAT32_C(   434.44), SIMDE_FLOAT32_C(   683.71) },
+      { SIMDE_FLOAT32_C(   841.31), SIMDE_FLOAT32_C(   433.77) },
+      { SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(     1.58) } },
+    { { SIMDE_FLOAT32_C(  -277.93), SIMDE_FLOAT32_C(   473.67) },
+      { SIMDE_FLOAT32_C(   251.75), SIMDE_FLOAT32_C(     7.92) },
+      { SIMDE_FLOAT32_C(    -1.10), SIMDE_FLOAT32_C(    59.81) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vdiv_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vdiv_f32(a, b);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vdiv_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    11.40) },
+      { SIMDE_FLOAT64_C(   909.55) },
+      { SIMDE_FLOAT64_C(     0.01) } },
+    { { SIMDE_FLOAT64_C(   635.87) },
+      { SIMDE_FLOAT64_C(  -687.54) },
+      { SIMDE_FLOAT64_C(    -0.92) } },
+    { { SIMDE_FLOAT64_C(   493.99) },
+      { SIMDE_FLOAT64_C(   314.81) },
+      { SIMDE_FLOAT64_C(     1.57) } },
+    { { SIMDE_FLOAT64_C(   -24.89) },
+      { SIMDE_FLOAT64_C(   254.69) },
+      { SIMDE_FLOAT64_C(    -0.10) } },
+    { { SIMDE_FLOAT64_C(  -458.93) },
+      { SIMDE_FLOAT64_C(   329.45) },
+      { SIMDE_FLOAT64_C(    -1.39) } },
+    { { SIMDE_FLOAT64_C(   638.99) },
+      { SIMDE_FLOAT64_C(   653.73) },
+      { SIMDE_FLOAT64_C(     0.98) } },
+    { { SIMDE_FLOAT64_C(   609.14) },
+      { SIMDE_FLOAT64_C(   919.56) },
+      { SIMDE_FLOAT64_C(     0.66) } },
+    { { SIMDE_FLOAT64_C(  -532.90) },
+      { SIMDE_FLOAT64_C(  -704.57) },
+      { SIMDE_FLOAT64_C(     0.76) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vdiv_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vdiv_f64(a, b);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vdivq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -55.30), SIMDE_FLOAT32_C(   226.07), SIMDE_FLOAT32_C(   229.50), SIMDE_FLOAT32_C(  -790.65) },
+      { SIMDE_FLOAT32_C(  -464.54), SIMDE_FLOAT32_C(   418.13), SIMDE_FLOAT32_C(   251.23), SIMDE_FLOAT32_C(  -738.85) },
+      { SIMDE_FLOAT32_C(     0.12), SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(     0.91), SIMDE_FLOAT32_C(     1.07) } },
+    { { SIMDE_FLOAT32_C(  -376.65), SIMDE_FLOAT32_C(  -744.26), SIMDE_FLOAT32_C(  -523.18), SIMDE_FLOAT32_C(   430.34) },
+      { SIMDE_FLOAT32_C(  -379.05), SIMDE_FLOAT32_C(   340.75), SIMDE_FLOAT32_C(   135.80), SIMDE_FLOAT32_C(  -261.02) },
+      { SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(    -2.18), SIMDE_FLOAT32_C(    -3.85), SIMDE_FLOAT32_C(    -1.65) } },
+    { { SIMDE_FLOAT32_C(   848.79), SIMDE_FLOAT32_C(   684.87), SIMDE_FLOAT32_C(   795.88), SIMDE_FLOAT32_C(  -891.62) },
+      { SIMDE_FLOAT32_C(   864.46), SIMDE_FLOAT32_C(   214.63), SIMDE_FLOAT32_C(   156.49), SIMDE_FLOAT32_C(   162.83) },
+      { SIMDE_FLOAT32_C(     0.98), SIMDE_FLOAT32_C(     3.19), SIMDE_FLOAT32_C(     5.09), SIMDE_FLOAT32_C(    -5.48) } },
+    { { SIMDE_FLOAT32_C(  -152.41), SIMDE_FLOAT32_C(   262.88), SIMDE_FLOAT32_C(  -825.53), SIMDE_FLOAT32_C(  -876.28) },
+      { SIMDE_FLOAT32_C(   453.52), SIMDE_FLOAT32_C(   579.66), SIMDE_FLOAT32_C(   794.88), SIMDE_FLOAT32_C(   851.48) },
+      { SIMDE_FLOAT32_C(    -0.34), SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(    -1.04), SIMDE_FLOAT32_C(    -1.03) } },
+    { { SIMDE_FLOAT32_C(  -653.07), SIMDE_FLOAT32_C(   994.97), SIMDE_FLOAT32_C(   920.07), SIMDE_FLOAT32_C(  -492.42) },
+      { SIMDE_FLOAT32_C(   667.24), SIMDE_FLOAT32_C(   597.05), SIMDE_FLOAT32_C(  -323.97), SIMDE_FLOAT32_C(  -478.18) },
+      { SIMDE_FLOAT32_C(    -0.98), SIMDE_FLOAT32_C(     1.67), SIMDE_FLOAT32_C(    -2.84), SIMDE_FLOAT32_C(     1.03) } },
+    { { SIMDE_FLOAT32_C(  -418.00), SIMDE_FLOAT32_C(   -12.63), SIMDE_FLOAT32_C(   201.43), SIMDE_FLOAT32_C(  -594.73) },
+      { SIMDE_FLOAT32_C(   326.69), SIMDE_FLOAT32_C(  -111.40), SIMDE_FLOAT32_C(   -36.05), SIMDE_FLOAT32_C(   287.26) },
+      { SIMDE_FLOAT32_C(    -1.28), SIMDE_FLOAT32_C(     0.11), SIMDE_FLOAT32_C(    -5.59), SIMDE_FLOAT32_C(    -2.07) } },
+    { { SIMDE_FLOAT32_C(  -274.07), SIMDE_FLOAT32_C(  -971.80), SIMDE_FLOAT32_C(    14.06), SIMDE_FLOAT32_C(   399.13) },
+      { SIMDE_FLOAT32_C(   412.52), SIMDE_FLOAT32_C(    14.01), SIMDE_FLOAT32_C(  -814.17), SIMDE_FLOAT32_C(   244.36) },
+      { SIMDE_FLOAT32_C(    -0.66), SIMDE_FLOAT32_C(   -69.36), SIMDE_FLOAT32_C(    -0.02), SIMDE_FLOAT32_C(     1.63) } },
+    { { SIMDE_FLOAT32_C(   925.84), SIMDE_FLOAT32_C(  -313.65), SIMDE_FLOAT32_C(  -100.35), SIMDE_FLOAT32_C(  -183.62) },
+      { SIMDE_FLOAT32_C(  -699.53), SIMDE_FLOAT32_C(   374.73), SIMDE_FLOAT32_C(   964.05), SIMDE_FLOAT32_C(  -189.93) },
+      { SIMDE_FLOAT32_C(    -1.32), SIMDE_FLOAT32_C(    -0.84), SIMDE_FLOAT32_C(    -0.10), SIMDE_FLOAT32_C(     0.97) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vdivq_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vdivq_f32(a, b);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vdivq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -903.58), SIMDE_FLOAT64_C(  -478.00) },
+      { SIMDE_FLOAT64_C(   -78.05), SIMDE_FLOAT64_C(   477.19) },
+      { SIMDE_FLOAT64_C(    11.58), SIMDE_FLOAT64_C(    -1.00) } },
+    { { SIMDE_FLOAT64_C(   272.02), SIMDE_FLOAT64_C(  -223.14) },
+      { SIMDE_FLOAT64_C(   719.08), SIMDE_FLOAT64_C(  -830.90) },
+      { SIMDE_FLOAT64_C(     0.38), SIMDE_FLOAT64_C(     0.27) } },
+    { { SIMDE_FLOAT64_C(   713.83), SIMDE_FLOAT64_C(  -236.24) },
+      { SIMDE_FLOAT64_C(  -927.85), SIMDE_FLOAT64_C(   165.38) },
+      { SIMDE_FLOAT64_C(    -0.77), SIMDE_FLOAT64_C(    -1.43) } },
+    { { SIMDE_FLOAT64_C(  -743.15), SIMDE_FLOAT64_C(  -315.40) },
+      { SIMDE_FLOAT64_C(   590.85), SIMDE_FLOAT64_C(   -61.53) },
+      { SIMDE_FLOAT64_C(    -1.26), SIMDE_FLOAT64_C(     5.13) } },
+    { { SIMDE_FLOAT64_C(   206.26), SIMDE_FLOAT64_C(   318.46) },
+      { SIMDE_FLOAT64_C(   982.12), SIMDE_FLOAT64_C(  -707.45) },
+      { SIMDE_FLOAT64_C(     0.21), SIMDE_FLOAT64_C(    -0.45) } },
+    { { SIMDE_FLOAT64_C(  -628.56), SIMDE_FLOAT64_C(  -929.23) },
+      { SIMDE_FLOAT64_C(   511.21), SIMDE_FLOAT64_C(  -603.61) },
+      { SIMDE_FLOAT64_C(    -1.23), SIMDE_FLOAT64_C(     1.54) } },
+    { { SIMDE_FLOAT64_C(   610.27), SIMDE_FLOAT64_C(   430.72) },
+      { SIMDE_FLOAT64_C(   437.39), SIMDE_FLOAT64_C(  -867.76) },
+      { SIMDE_FLOAT64_C(     1.40), SIMDE_FLOAT64_C(    -0.50) } },
+    { { SIMDE_FLOAT64_C(   651.04), SIMDE_FLOAT64_C(    52.98) },
+      { SIMDE_FLOAT64_C(   982.86), SIMDE_FLOAT64_C(   992.03) },
+      { SIMDE_FLOAT64_C(     0.66), SIMDE_FLOAT64_C(     0.05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vdivq_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vdivq_f64(a, b);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vdiv_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vdiv_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vdivq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vdivq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,293 @@
+#define SIMDE_TEST_ARM_NEON_INSN fma
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fma.h"
+
+static int
+test_simde_vfma_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -230.59), SIMDE_FLOAT32_C(   361.14) },
+      { SIMDE_FLOAT32_C(   453.98), SIMDE_FLOAT32_C(  -189.29) },
+      { SIMDE_FLOAT32_C(  -663.59), SIMDE_FLOAT32_C(  -960.00) },
+      { SIMDE_FLOAT32_C(-301487.19), SIMDE_FLOAT32_C(182079.53) } },
+    { { SIMDE_FLOAT32_C(  -419.97), SIMDE_FLOAT32_C(  -920.00) },
+      { SIMDE_FLOAT32_C(  -728.55), SIMDE_FLOAT32_C(    80.36) },
+      { SIMDE_FLOAT32_C(   -31.56), SIMDE_FLOAT32_C(   697.07) },
+      { SIMDE_FLOAT32_C( 22573.07), SIMDE_FLOAT32_C( 55096.55) } },
+    { { SIMDE_FLOAT32_C(  -751.50), SIMDE_FLOAT32_C(  -848.29) },
+      { SIMDE_FLOAT32_C(  -739.13), SIMDE_FLOAT32_C(  -175.53) },
+      { SIMDE_FLOAT32_C(  -721.80), SIMDE_FLOAT32_C(   551.25) },
+      { SIMDE_FLOAT32_C(532752.50), SIMDE_FLOAT32_C(-97609.20) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(   997.44) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   911.91) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   560.25) },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(511895.00) } },
+    { { SIMDE_FLOAT32_C(   682.61), SIMDE_FLOAT32_C(  -411.10) },
+      { SIMDE_FLOAT32_C(  -365.78), SIMDE_FLOAT32_C(  -988.09) },
+      { SIMDE_FLOAT32_C(   290.73), SIMDE_FLOAT32_C(     9.06) },
+      { SIMDE_FLOAT32_C(-105660.61), SIMDE_FLOAT32_C( -9363.20) } },
+    { { SIMDE_FLOAT32_C(   282.49), SIMDE_FLOAT32_C(  -975.05) },
+      { SIMDE_FLOAT32_C(  -961.33), SIMDE_FLOAT32_C(   477.64) },
+      { SIMDE_FLOAT32_C(  -429.13), SIMDE_FLOAT32_C(   970.32) },
+      { SIMDE_FLOAT32_C(412818.03), SIMDE_FLOAT32_C(462488.62) } },
+    { { SIMDE_FLOAT32_C(   349.38), SIMDE_FLOAT32_C(  -653.46) },
+      { SIMDE_FLOAT32_C(   597.94), SIMDE_FLOAT32_C(   550.80) },
+      { SIMDE_FLOAT32_C(    87.59), SIMDE_FLOAT32_C(   916.37) },
+      { SIMDE_FLOAT32_C( 52722.94), SIMDE_FLOAT32_C(504083.12) } },
+    { { SIMDE_FLOAT32_C(   803.05), SIMDE_FLOAT32_C(   565.89) },
+      { SIMDE_FLOAT32_C(   658.67), SIMDE_FLOAT32_C(   404.44) },
+      { SIMDE_FLOAT32_C(    99.81), SIMDE_FLOAT32_C(  -294.41) },
+      { SIMDE_FLOAT32_C( 66544.90), SIMDE_FLOAT32_C(-118505.29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+    simde_float32x2_t r = simde_vfma_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t c = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vfma_f32(a, b, c);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfma_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    59.00) },
+      { SIMDE_FLOAT64_C(  -209.78) },
+      { SIMDE_FLOAT64_C(  -357.54) },
+      { SIMDE_FLOAT64_C( 75063.74) } },
+    { { SIMDE_FLOAT64_C(   414.89) },
+      { SIMDE_FLOAT64_C(   670.98) },
+      { SIMDE_FLOAT64_C(  -709.06) },
+      { SIMDE_FLOAT64_C(-475350.19) } },
+    { { SIMDE_FLOAT64_C(  -814.01) },
+      { SIMDE_FLOAT64_C(   202.33) },
+      { SIMDE_FLOAT64_C(   138.67) },
+      { SIMDE_FLOAT64_C( 27243.09) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(     1.00) } },
+    { { SIMDE_FLOAT64_C(   976.31) },
+      { SIMDE_FLOAT64_C(   428.13) },
+      { SIMDE_FLOAT64_C(   995.00) },
+      { SIMDE_FLOAT64_C(426965.66) } },
+    { { SIMDE_FLOAT64_C(   211.73) },
+      { SIMDE_FLOAT64_C(   242.14) },
+      { SIMDE_FLOAT64_C(   -35.84) },
+      { SIMDE_FLOAT64_C( -8466.57) } },
+    { { SIMDE_FLOAT64_C(   826.52) },
+      { SIMDE_FLOAT64_C(   549.52) },
+      { SIMDE_FLOAT64_C(  -965.76) },
+      { SIMDE_FLOAT64_C(-529877.92) } },
+    { { SIMDE_FLOAT64_C(  -135.20) },
+      { SIMDE_FLOAT64_C(   280.58) },
+      { SIMDE_FLOAT64_C(   743.78) },
+      { SIMDE_FLOAT64_C(208554.59) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfma_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t c = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vfma_f64(a, b, c);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    73.15), SIMDE_FLOAT32_C(  -420.02), SIMDE_FLOAT32_C(   529.11), SIMDE_FLOAT32_C(  -699.71) },
+      { SIMDE_FLOAT32_C(  -947.13), SIMDE_FLOAT32_C(   652.50), SIMDE_FLOAT32_C(  -682.21), SIMDE_FLOAT32_C(  -681.43) },
+      { SIMDE_FLOAT32_C(  -560.57), SIMDE_FLOAT32_C(   299.59), SIMDE_FLOAT32_C(  -135.20), SIMDE_FLOAT32_C(   236.56) },
+      { SIMDE_FLOAT32_C(531005.81), SIMDE_FLOAT32_C(195062.45), SIMDE_FLOAT32_C( 92763.91), SIMDE_FLOAT32_C(-161898.78) } },
+    { { SIMDE_FLOAT32_C(   680.63), SIMDE_FLOAT32_C(  -963.59), SIMDE_FLOAT32_C(  -995.95), SIMDE_FLOAT32_C(   439.10) },
+      { SIMDE_FLOAT32_C(   462.52), SIMDE_FLOAT32_C(   856.01), SIMDE_FLOAT32_C(  -971.62), SIMDE_FLOAT32_C(   489.79) },
+      { SIMDE_FLOAT32_C(   737.84), SIMDE_FLOAT32_C(   906.92), SIMDE_FLOAT32_C(  -371.55), SIMDE_FLOAT32_C(  -956.53) },
+      { SIMDE_FLOAT32_C(341946.41), SIMDE_FLOAT32_C(775369.00), SIMDE_FLOAT32_C(360009.44), SIMDE_FLOAT32_C(-468059.75) } },
+    { { SIMDE_FLOAT32_C(   167.95), SIMDE_FLOAT32_C(   580.07), SIMDE_FLOAT32_C(  -720.51), SIMDE_FLOAT32_C(   737.49) },
+      { SIMDE_FLOAT32_C(  -752.37), SIMDE_FLOAT32_C(   935.24), SIMDE_FLOAT32_C(   489.09), SIMDE_FLOAT32_C(   788.05) },
+      { SIMDE_FLOAT32_C(   -83.17), SIMDE_FLOAT32_C(  -795.92), SIMDE_FLOAT32_C(   674.83), SIMDE_FLOAT32_C(  -407.97) },
+      { SIMDE_FLOAT32_C( 62742.56), SIMDE_FLOAT32_C(-743796.12), SIMDE_FLOAT32_C(329332.09), SIMDE_FLOAT32_C(-320763.25) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(   647.29), SIMDE_FLOAT32_C(  -789.34), SIMDE_FLOAT32_C(   934.50) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -172.44), SIMDE_FLOAT32_C(   900.64), SIMDE_FLOAT32_C(  -276.01) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -170.89), SIMDE_FLOAT32_C(  -119.70), SIMDE_FLOAT32_C(  -168.44) },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C( 30115.56), SIMDE_FLOAT32_C(-108595.95), SIMDE_FLOAT32_C( 47425.62) } },
+    { { SIMDE_FLOAT32_C(  -854.39), SIMDE_FLOAT32_C(  -956.03), SIMDE_FLOAT32_C(  -607.55), SIMDE_FLOAT32_C(   328.01) },
+      { SIMDE_FLOAT32_C(   504.55), SIMDE_FLOAT32_C(   830.70), SIMDE_FLOAT32_C(   313.41), SIMDE_FLOAT32_C(   -82.62) },
+      { SIMDE_FLOAT32_C(   397.52), SIMDE_FLOAT32_C(  -646.42), SIMDE_FLOAT32_C(  -174.05), SIMDE_FLOAT32_C(  -552.82) },
+      { SIMDE_FLOAT32_C(199714.31), SIMDE_FLOAT32_C(-537937.12), SIMDE_FLOAT32_C(-55156.56), SIMDE_FLOAT32_C( 46002.00) } },
+    { { SIMDE_FLOAT32_C(   360.32), SIMDE_FLOAT32_C(   819.65), SIMDE_FLOAT32_C(   258.18), SIMDE_FLOAT32_C(    -7.32) },
+      { SIMDE_FLOAT32_C(   880.48), SIMDE_FLOAT32_C(  -894.42), SIMDE_FLOAT32_C(   243.45), SIMDE_FLOAT32_C(   784.29) },
+      { SIMDE_FLOAT32_C(   274.47), SIMDE_FLOAT32_C(  -489.17), SIMDE_FLOAT32_C(   143.95), SIMDE_FLOAT32_C(  -264.58) },
+      { SIMDE_FLOAT32_C(242025.66), SIMDE_FLOAT32_C(438343.09), SIMDE_FLOAT32_C( 35302.80), SIMDE_FLOAT32_C(-207514.75) } },
+    { { SIMDE_FLOAT32_C(   937.89), SIMDE_FLOAT32_C(  -974.06), SIMDE_FLOAT32_C(  -777.18), SIMDE_FLOAT32_C(  -286.40) },
+      { SIMDE_FLOAT32_C(  -742.78), SIMDE_FLOAT32_C(  -135.01), SIMDE_FLOAT32_C(   567.91), SIMDE_FLOAT32_C(  -589.26) },
+      { SIMDE_FLOAT32_C(   643.81), SIMDE_FLOAT32_C(  -996.83), SIMDE_FLOAT32_C(  -240.89), SIMDE_FLOAT32_C(   294.22) },
+      { SIMDE_FLOAT32_C(-477271.31), SIMDE_FLOAT32_C(133607.95), SIMDE_FLOAT32_C(-137581.02), SIMDE_FLOAT32_C(-173658.48) } },
+    { { SIMDE_FLOAT32_C(   537.30), SIMDE_FLOAT32_C(  -104.18), SIMDE_FLOAT32_C(  -183.27), SIMDE_FLOAT32_C(   146.41) },
+      { SIMDE_FLOAT32_C(   955.62), SIMDE_FLOAT32_C(    42.48), SIMDE_FLOAT32_C(  -368.70), SIMDE_FLOAT32_C(  -141.13) },
+      { SIMDE_FLOAT32_C(  -510.88), SIMDE_FLOAT32_C(   819.31), SIMDE_FLOAT32_C(  -693.92), SIMDE_FLOAT32_C(  -159.92) },
+      { SIMDE_FLOAT32_C(-487669.84), SIMDE_FLOAT32_C( 34700.11), SIMDE_FLOAT32_C(255665.03), SIMDE_FLOAT32_C( 22715.92) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+    simde_float32x4_t r = simde_vfmaq_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t c = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vfmaq_f32(a, b, c);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   329.80), SIMDE_FLOAT64_C(   274.60) },
+      { SIMDE_FLOAT64_C(    64.10), SIMDE_FLOAT64_C(   834.85) },
+      { SIMDE_FLOAT64_C(  -382.32), SIMDE_FLOAT64_C(   400.65) },
+      { SIMDE_FLOAT64_C(-24176.91), SIMDE_FLOAT64_C(334757.25) } },
+    { { SIMDE_FLOAT64_C(   727.10), SIMDE_FLOAT64_C(  -793.76) },
+      { SIMDE_FLOAT64_C(  -226.35), SIMDE_FLOAT64_C(   377.63) },
+      { SIMDE_FLOAT64_C(  -737.61), SIMDE_FLOAT64_C(  -544.16) },
+      { SIMDE_FLOAT64_C(167685.12), SIMDE_FLOAT64_C(-206284.90) } },
+    { { SIMDE_FLOAT64_C(   -26.35), SIMDE_FLOAT64_C(   751.36) },
+      { SIMDE_FLOAT64_C(   736.74), SIMDE_FLOAT64_C(  -975.28) },
+      { SIMDE_FLOAT64_C(  -815.71), SIMDE_FLOAT64_C(    66.32) },
+      { SIMDE_FLOAT64_C(-600992.54), SIMDE_FLOAT64_C(-63929.21) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00), SIMDE_FLOAT64_C(  -756.49) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   -17.91) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(  -900.54) },
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C( 15372.18) } },
+    { { SIMDE_FLOAT64_C(   854.14), SIMDE_FLOAT64_C(   890.26) },
+      { SIMDE_FLOAT64_C(     4.25), SIMDE_FLOAT64_C(    20.32) },
+      { SIMDE_FLOAT64_C(  -789.85), SIMDE_FLOAT64_C(  -165.59) },
+      { SIMDE_FLOAT64_C( -2502.72), SIMDE_FLOAT64_C( -2474.53) } },
+    { { SIMDE_FLOAT64_C(   457.70), SIMDE_FLOAT64_C(  -460.11) },
+      { SIMDE_FLOAT64_C(  -870.06), SIMDE_FLOAT64_C(  -266.44) },
+      { SIMDE_FLOAT64_C(  -587.81), SIMDE_FLOAT64_C(  -541.66) },
+      { SIMDE_FLOAT64_C(511887.67), SIMDE_FLOAT64_C(143859.78) } },
+    { { SIMDE_FLOAT64_C(  -261.33), SIMDE_FLOAT64_C(  -899.60) },
+      { SIMDE_FLOAT64_C(   420.43), SIMDE_FLOAT64_C(   673.99) },
+      { SIMDE_FLOAT64_C(   520.32), SIMDE_FLOAT64_C(   730.16) },
+      { SIMDE_FLOAT64_C(218496.81), SIMDE_FLOAT64_C(491220.94) } },
+    { { SIMDE_FLOAT64_C(   960.55), SIMDE_FLOAT64_C(   586.50) },
+      { SIMDE_FLOAT64_C(  -128.78), SIMDE_FLOAT64_C(    25.52) },
+      { SIMDE_FLOAT64_C(  -964.22), SIMDE_FLOAT64_C(  -287.80) },
+      { SIMDE_FLOAT64_C(125132.80), SIMDE_FLOAT64_C( -6758.16) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmaq_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t c = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vfmaq_f64(a, b, c);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
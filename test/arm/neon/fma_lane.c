@@ -0,0 +1,985 @@
+#define SIMDE_TEST_ARM_NEON_INSN fma_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fma_lane.h"
+
+static int
+test_simde_vfma_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 v[2];
+    int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -207.47), SIMDE_FLOAT32_C(   964.74) },
+      { SIMDE_FLOAT32_C(   410.65), SIMDE_FLOAT32_C(  -881.00) },
+      { SIMDE_FLOAT32_C(   117.17), SIMDE_FLOAT32_C(  -688.47) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( 47908.39), SIMDE_FLOAT32_C(-102262.03) } },
+    { { SIMDE_FLOAT32_C(  -411.99), SIMDE_FLOAT32_C(  -630.47) },
+      { SIMDE_FLOAT32_C(   523.29), SIMDE_FLOAT32_C(  -355.70) },
+      { SIMDE_FLOAT32_C(   760.76), SIMDE_FLOAT32_C(   548.03) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(286366.62), SIMDE_FLOAT32_C(-195564.77) } },
+    { { SIMDE_FLOAT32_C(  -423.10), SIMDE_FLOAT32_C(  -860.30) },
+      { SIMDE_FLOAT32_C(   549.37), SIMDE_FLOAT32_C(  -679.46) },
+      { SIMDE_FLOAT32_C(   -66.59), SIMDE_FLOAT32_C(  -892.76) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-37005.64), SIMDE_FLOAT32_C( 44384.94) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(   154.05) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -980.57) },
+      { SIMDE_FLOAT32_C(    48.80), SIMDE_FLOAT32_C(  4097.00) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(-4017241.25) } },
+    { { SIMDE_FLOAT32_C(   118.04), SIMDE_FLOAT32_C(  -800.79) },
+      { SIMDE_FLOAT32_C(   311.54), SIMDE_FLOAT32_C(   623.58) },
+      { SIMDE_FLOAT32_C(   873.45), SIMDE_FLOAT32_C(   754.45) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(272232.66), SIMDE_FLOAT32_C(543865.19) } },
+    { { SIMDE_FLOAT32_C(   845.25), SIMDE_FLOAT32_C(  -822.37) },
+      { SIMDE_FLOAT32_C(   920.06), SIMDE_FLOAT32_C(   571.55) },
+      { SIMDE_FLOAT32_C(  -513.83), SIMDE_FLOAT32_C(   235.90) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-471909.19), SIMDE_FLOAT32_C(-294501.91) } },
+    { { SIMDE_FLOAT32_C(   182.61), SIMDE_FLOAT32_C(  -617.12) },
+      { SIMDE_FLOAT32_C(  -434.44), SIMDE_FLOAT32_C(  -466.59) },
+      { SIMDE_FLOAT32_C(  -557.99), SIMDE_FLOAT32_C(  -761.77) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(331125.97), SIMDE_FLOAT32_C(354817.16) } },
+    { { SIMDE_FLOAT32_C(   213.49), SIMDE_FLOAT32_C(  -729.00) },
+      { SIMDE_FLOAT32_C(  -983.69), SIMDE_FLOAT32_C(   529.23) },
+      { SIMDE_FLOAT32_C(  -594.96), SIMDE_FLOAT32_C(   608.18) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-598047.06), SIMDE_FLOAT32_C(321138.09) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t v = simde_vld1_f32(test_vec[i].v);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfma_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t v = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfma_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfma_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 v[4];
+    int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   936.21), SIMDE_FLOAT32_C(  -944.61) },
+      { SIMDE_FLOAT32_C(  -730.09), SIMDE_FLOAT32_C(   209.08) },
+      { SIMDE_FLOAT32_C(   -44.13), SIMDE_FLOAT32_C(   -63.36), SIMDE_FLOAT32_C(   855.21), SIMDE_FLOAT32_C(  -871.26) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(637034.44), SIMDE_FLOAT32_C(-183107.66) } },
+    { { SIMDE_FLOAT32_C(   425.16), SIMDE_FLOAT32_C(  -904.24) },
+      { SIMDE_FLOAT32_C(  -686.23), SIMDE_FLOAT32_C(   964.13) },
+      { SIMDE_FLOAT32_C(  -520.25), SIMDE_FLOAT32_C(  -273.43), SIMDE_FLOAT32_C(    31.62), SIMDE_FLOAT32_C(   860.69) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(-21273.43), SIMDE_FLOAT32_C( 29581.55) } },
+    { { SIMDE_FLOAT32_C(  -372.31), SIMDE_FLOAT32_C(  -221.24) },
+      { SIMDE_FLOAT32_C(  -604.17), SIMDE_FLOAT32_C(   740.58) },
+      { SIMDE_FLOAT32_C(  -827.71), SIMDE_FLOAT32_C(  -269.85), SIMDE_FLOAT32_C(   -61.35), SIMDE_FLOAT32_C(   526.17) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(499705.25), SIMDE_FLOAT32_C(-613206.75) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(   604.57) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -993.54) },
+      { SIMDE_FLOAT32_C(  -324.91), SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -327.48), SIMDE_FLOAT32_C(  -629.42) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(-4069928.75) } },
+    { { SIMDE_FLOAT32_C(   103.97), SIMDE_FLOAT32_C(  -603.61) },
+      { SIMDE_FLOAT32_C(   676.40), SIMDE_FLOAT32_C(   471.01) },
+      { SIMDE_FLOAT32_C(  -732.06), SIMDE_FLOAT32_C(  -244.15), SIMDE_FLOAT32_C(  -920.19), SIMDE_FLOAT32_C(   893.03) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(604149.50), SIMDE_FLOAT32_C(420022.47) } },
+    { { SIMDE_FLOAT32_C(   251.20), SIMDE_FLOAT32_C(   -12.42) },
+      { SIMDE_FLOAT32_C(  -899.16), SIMDE_FLOAT32_C(  -371.67) },
+      { SIMDE_FLOAT32_C(  -520.67), SIMDE_FLOAT32_C(   174.55), SIMDE_FLOAT32_C(   492.27), SIMDE_FLOAT32_C(   286.77) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(-442378.28), SIMDE_FLOAT32_C(-182974.41) } },
+    { { SIMDE_FLOAT32_C(  -189.15), SIMDE_FLOAT32_C(   194.62) },
+      { SIMDE_FLOAT32_C(    89.82), SIMDE_FLOAT32_C(   589.21) },
+      { SIMDE_FLOAT32_C(   743.68), SIMDE_FLOAT32_C(   679.66), SIMDE_FLOAT32_C(   -31.07), SIMDE_FLOAT32_C(   368.42) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C( 32902.34), SIMDE_FLOAT32_C(217271.39) } },
+    { { SIMDE_FLOAT32_C(   137.13), SIMDE_FLOAT32_C(  -106.54) },
+      { SIMDE_FLOAT32_C(  -427.90), SIMDE_FLOAT32_C(  -315.38) },
+      { SIMDE_FLOAT32_C(   696.28), SIMDE_FLOAT32_C(   302.69), SIMDE_FLOAT32_C(   449.25), SIMDE_FLOAT32_C(   101.91) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-297801.09), SIMDE_FLOAT32_C(-219699.34) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x4_t v = simde_vld1q_f32(test_vec[i].v);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vfma_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x4_t v = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 3;
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vfma_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfma_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 v[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   896.40) },
+      { SIMDE_FLOAT64_C(   913.63) },
+      { SIMDE_FLOAT64_C(   286.94) },
+      { SIMDE_FLOAT64_C(263053.39) } },
+    { { SIMDE_FLOAT64_C(   203.30) },
+      { SIMDE_FLOAT64_C(  -856.44) },
+      { SIMDE_FLOAT64_C(   666.85) },
+      { SIMDE_FLOAT64_C(-570913.71) } },
+    { { SIMDE_FLOAT64_C(  -807.64) },
+      { SIMDE_FLOAT64_C(  -668.59) },
+      { SIMDE_FLOAT64_C(  -570.18) },
+      { SIMDE_FLOAT64_C(380409.01) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(     1.00) } },
+    { { SIMDE_FLOAT64_C(  -482.74) },
+      { SIMDE_FLOAT64_C(  -367.02) },
+      { SIMDE_FLOAT64_C(     3.67) },
+      { SIMDE_FLOAT64_C( -1829.70) } },
+    { { SIMDE_FLOAT64_C(   -92.32) },
+      { SIMDE_FLOAT64_C(   709.36) },
+      { SIMDE_FLOAT64_C(  -333.63) },
+      { SIMDE_FLOAT64_C(-236756.10) } },
+    { { SIMDE_FLOAT64_C(  -886.07) },
+      { SIMDE_FLOAT64_C(  -810.58) },
+      { SIMDE_FLOAT64_C(     4.81) },
+      { SIMDE_FLOAT64_C( -4784.96) } },
+    { { SIMDE_FLOAT64_C(  -567.69) },
+      { SIMDE_FLOAT64_C(  -676.24) },
+      { SIMDE_FLOAT64_C(   511.30) },
+      { SIMDE_FLOAT64_C(-346329.20) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t v = simde_vld1_f64(test_vec[i].v);
+    simde_float64x1_t r = simde_vfma_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t v = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vfma_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfma_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 v[2];
+    int lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   387.14) },
+      { SIMDE_FLOAT64_C(  -857.67) },
+      { SIMDE_FLOAT64_C(   802.31), SIMDE_FLOAT64_C(  -441.99) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(379468.70) } },
+    { { SIMDE_FLOAT64_C(  -838.56) },
+      { SIMDE_FLOAT64_C(   335.55) },
+      { SIMDE_FLOAT64_C(   948.49), SIMDE_FLOAT64_C(   386.29) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(128781.05) } },
+    { { SIMDE_FLOAT64_C(  -227.10) },
+      { SIMDE_FLOAT64_C(  -293.75) },
+      { SIMDE_FLOAT64_C(   962.92), SIMDE_FLOAT64_C(   188.52) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(-283084.85) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(  -107.49) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(     1.00) } },
+    { { SIMDE_FLOAT64_C(   394.56) },
+      { SIMDE_FLOAT64_C(  -999.29) },
+      { SIMDE_FLOAT64_C(   759.74), SIMDE_FLOAT64_C(   116.58) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(-758806.02) } },
+    { { SIMDE_FLOAT64_C(   396.39) },
+      { SIMDE_FLOAT64_C(   444.96) },
+      { SIMDE_FLOAT64_C(  -637.15), SIMDE_FLOAT64_C(   552.92) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(246423.67) } },
+    { { SIMDE_FLOAT64_C(  -902.91) },
+      { SIMDE_FLOAT64_C(   401.92) },
+      { SIMDE_FLOAT64_C(  -978.30), SIMDE_FLOAT64_C(   -27.88) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(-12108.44) } },
+    { { SIMDE_FLOAT64_C(   668.99) },
+      { SIMDE_FLOAT64_C(  -794.26) },
+      { SIMDE_FLOAT64_C(   497.42), SIMDE_FLOAT64_C(   590.14) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(-394411.82) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x2_t v = simde_vld1q_f64(test_vec[i].v);
+
+    simde_float64x1_t r;
+    SIMDE_CONSTIFY_2_(simde_vfma_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x2_t v = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float64x1_t r;
+    SIMDE_CONSTIFY_2_(simde_vfma_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f64(SIMDE_FLOAT64_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 v[2];
+    int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -306.47), SIMDE_FLOAT32_C(  -794.48), SIMDE_FLOAT32_C(   116.29), SIMDE_FLOAT32_C(   453.98) },
+      { SIMDE_FLOAT32_C(   239.46), SIMDE_FLOAT32_C(  -841.99), SIMDE_FLOAT32_C(  -782.36), SIMDE_FLOAT32_C(  -475.30) },
+      { SIMDE_FLOAT32_C(   -66.43), SIMDE_FLOAT32_C(   213.16) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( 50736.82), SIMDE_FLOAT32_C(-180273.06), SIMDE_FLOAT32_C(-166651.56), SIMDE_FLOAT32_C(-100860.97) } },
+    { { SIMDE_FLOAT32_C(  -441.75), SIMDE_FLOAT32_C(    24.63), SIMDE_FLOAT32_C(  -256.10), SIMDE_FLOAT32_C(   948.82) },
+      { SIMDE_FLOAT32_C(   205.29), SIMDE_FLOAT32_C(  -203.96), SIMDE_FLOAT32_C(  -452.14), SIMDE_FLOAT32_C(   798.73) },
+      { SIMDE_FLOAT32_C(    66.32), SIMDE_FLOAT32_C(  -916.53) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-188596.19), SIMDE_FLOAT32_C(186960.09), SIMDE_FLOAT32_C(414143.81), SIMDE_FLOAT32_C(-731111.19) } },
+    { { SIMDE_FLOAT32_C(   -98.35), SIMDE_FLOAT32_C(  -538.01), SIMDE_FLOAT32_C(  -153.58), SIMDE_FLOAT32_C(  -924.45) },
+      { SIMDE_FLOAT32_C(  -715.93), SIMDE_FLOAT32_C(  -196.27), SIMDE_FLOAT32_C(   348.38), SIMDE_FLOAT32_C(  -723.40) },
+      { SIMDE_FLOAT32_C(   248.62), SIMDE_FLOAT32_C(  -676.11) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(483949.06), SIMDE_FLOAT32_C(132162.09), SIMDE_FLOAT32_C(-235696.78), SIMDE_FLOAT32_C(488173.53) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(   208.72), SIMDE_FLOAT32_C(  -489.26), SIMDE_FLOAT32_C(   883.65) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   202.83), SIMDE_FLOAT32_C(  -396.75), SIMDE_FLOAT32_C(  -512.93) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   474.61) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(831203.25), SIMDE_FLOAT32_C(-1625974.00), SIMDE_FLOAT32_C(-2100590.50) } },
+    { { SIMDE_FLOAT32_C(  -720.97), SIMDE_FLOAT32_C(  -419.30), SIMDE_FLOAT32_C(   709.55), SIMDE_FLOAT32_C(  -364.29) },
+      { SIMDE_FLOAT32_C(  -158.76), SIMDE_FLOAT32_C(   426.71), SIMDE_FLOAT32_C(   -73.47), SIMDE_FLOAT32_C(  -200.50) },
+      { SIMDE_FLOAT32_C(  -212.95), SIMDE_FLOAT32_C(  -995.94) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(157394.45), SIMDE_FLOAT32_C(-425396.84), SIMDE_FLOAT32_C( 73881.27), SIMDE_FLOAT32_C(199321.69) } },
+    { { SIMDE_FLOAT32_C(  -312.19), SIMDE_FLOAT32_C(   896.09), SIMDE_FLOAT32_C(  -748.06), SIMDE_FLOAT32_C(  -415.23) },
+      { SIMDE_FLOAT32_C(  -724.56), SIMDE_FLOAT32_C(  -402.78), SIMDE_FLOAT32_C(   437.80), SIMDE_FLOAT32_C(   440.96) },
+      { SIMDE_FLOAT32_C(   744.85), SIMDE_FLOAT32_C(   864.42) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-540000.69), SIMDE_FLOAT32_C(-299114.59), SIMDE_FLOAT32_C(325347.25), SIMDE_FLOAT32_C(328033.81) } },
+    { { SIMDE_FLOAT32_C(  -687.90), SIMDE_FLOAT32_C(  -503.18), SIMDE_FLOAT32_C(  -300.32), SIMDE_FLOAT32_C(  -570.62) },
+      { SIMDE_FLOAT32_C(  -492.24), SIMDE_FLOAT32_C(   582.17), SIMDE_FLOAT32_C(   471.75), SIMDE_FLOAT32_C(   844.18) },
+      { SIMDE_FLOAT32_C(  -947.93), SIMDE_FLOAT32_C(  -127.11) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(465921.16), SIMDE_FLOAT32_C(-552359.56), SIMDE_FLOAT32_C(-447486.28), SIMDE_FLOAT32_C(-800794.12) } },
+    { { SIMDE_FLOAT32_C(   882.22), SIMDE_FLOAT32_C(  -481.20), SIMDE_FLOAT32_C(   913.90), SIMDE_FLOAT32_C(  -138.00) },
+      { SIMDE_FLOAT32_C(   860.12), SIMDE_FLOAT32_C(  -235.70), SIMDE_FLOAT32_C(  -668.30), SIMDE_FLOAT32_C(   536.08) },
+      { SIMDE_FLOAT32_C(  -522.81), SIMDE_FLOAT32_C(   799.09) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-448797.12), SIMDE_FLOAT32_C(122745.12), SIMDE_FLOAT32_C(350307.81), SIMDE_FLOAT32_C(-280406.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x2_t v = simde_vld1_f32(test_vec[i].v);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmaq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x2_t v = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmaq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 v[4];
+    int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   190.05), SIMDE_FLOAT32_C(   508.82), SIMDE_FLOAT32_C(   318.34), SIMDE_FLOAT32_C(  -572.32) },
+      { SIMDE_FLOAT32_C(  -210.43), SIMDE_FLOAT32_C(  -397.55), SIMDE_FLOAT32_C(  -175.81), SIMDE_FLOAT32_C(   546.55) },
+      { SIMDE_FLOAT32_C(  -172.22), SIMDE_FLOAT32_C(    45.23), SIMDE_FLOAT32_C(   187.10), SIMDE_FLOAT32_C(   103.62) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -9327.70), SIMDE_FLOAT32_C(-17472.37), SIMDE_FLOAT32_C( -7633.55), SIMDE_FLOAT32_C( 24148.13) } },
+    { { SIMDE_FLOAT32_C(  -859.50), SIMDE_FLOAT32_C(   520.86), SIMDE_FLOAT32_C(  -978.75), SIMDE_FLOAT32_C(  -356.63) },
+      { SIMDE_FLOAT32_C(  -739.97), SIMDE_FLOAT32_C(  -865.72), SIMDE_FLOAT32_C(   -69.95), SIMDE_FLOAT32_C(   -16.28) },
+      { SIMDE_FLOAT32_C(   245.13), SIMDE_FLOAT32_C(   919.95), SIMDE_FLOAT32_C(  -338.70), SIMDE_FLOAT32_C(  -139.03) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-681594.88), SIMDE_FLOAT32_C(-795898.25), SIMDE_FLOAT32_C(-65329.25), SIMDE_FLOAT32_C(-15333.42) } },
+    { { SIMDE_FLOAT32_C(   131.43), SIMDE_FLOAT32_C(   756.51), SIMDE_FLOAT32_C(    82.99), SIMDE_FLOAT32_C(  -996.73) },
+      { SIMDE_FLOAT32_C(   525.43), SIMDE_FLOAT32_C(   283.54), SIMDE_FLOAT32_C(   530.05), SIMDE_FLOAT32_C(   454.92) },
+      { SIMDE_FLOAT32_C(  -567.50), SIMDE_FLOAT32_C(     4.27), SIMDE_FLOAT32_C(   407.27), SIMDE_FLOAT32_C(   730.85) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(384141.94), SIMDE_FLOAT32_C(207981.72), SIMDE_FLOAT32_C(387470.00), SIMDE_FLOAT32_C(331481.56) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(  -469.87), SIMDE_FLOAT32_C(  -333.48), SIMDE_FLOAT32_C(   697.22) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -100.37), SIMDE_FLOAT32_C(  -863.65), SIMDE_FLOAT32_C(   945.73) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   577.47), SIMDE_FLOAT32_C(   855.45), SIMDE_FLOAT32_C(  -410.85) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(-411685.78), SIMDE_FLOAT32_C(-3538707.75), SIMDE_FLOAT32_C(3875353.00) } },
+    { { SIMDE_FLOAT32_C(   905.48), SIMDE_FLOAT32_C(   951.98), SIMDE_FLOAT32_C(   954.00), SIMDE_FLOAT32_C(  -518.38) },
+      { SIMDE_FLOAT32_C(   631.78), SIMDE_FLOAT32_C(   -16.71), SIMDE_FLOAT32_C(   631.03), SIMDE_FLOAT32_C(  -283.76) },
+      { SIMDE_FLOAT32_C(   910.07), SIMDE_FLOAT32_C(   764.89), SIMDE_FLOAT32_C(  -419.82), SIMDE_FLOAT32_C(   539.43) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(575869.56), SIMDE_FLOAT32_C(-14255.29), SIMDE_FLOAT32_C(575235.50), SIMDE_FLOAT32_C(-258759.86) } },
+    { { SIMDE_FLOAT32_C(   347.82), SIMDE_FLOAT32_C(   851.75), SIMDE_FLOAT32_C(   523.71), SIMDE_FLOAT32_C(  -474.52) },
+      { SIMDE_FLOAT32_C(  -178.91), SIMDE_FLOAT32_C(   667.75), SIMDE_FLOAT32_C(  -641.34), SIMDE_FLOAT32_C(  -400.64) },
+      { SIMDE_FLOAT32_C(  -364.46), SIMDE_FLOAT32_C(  -336.94), SIMDE_FLOAT32_C(   711.76), SIMDE_FLOAT32_C(  -260.87) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(-126993.16), SIMDE_FLOAT32_C(476129.50), SIMDE_FLOAT32_C(-455956.47), SIMDE_FLOAT32_C(-285634.06) } },
+    { { SIMDE_FLOAT32_C(  -369.31), SIMDE_FLOAT32_C(   999.46), SIMDE_FLOAT32_C(  -783.30), SIMDE_FLOAT32_C(  -103.12) },
+      { SIMDE_FLOAT32_C(   536.47), SIMDE_FLOAT32_C(   -78.13), SIMDE_FLOAT32_C(   151.71), SIMDE_FLOAT32_C(   274.50) },
+      { SIMDE_FLOAT32_C(  -994.24), SIMDE_FLOAT32_C(   -10.57), SIMDE_FLOAT32_C(   435.86), SIMDE_FLOAT32_C(   684.80) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(233456.48), SIMDE_FLOAT32_C(-33054.28), SIMDE_FLOAT32_C( 65341.02), SIMDE_FLOAT32_C(119540.45) } },
+    { { SIMDE_FLOAT32_C(    86.50), SIMDE_FLOAT32_C(   219.14), SIMDE_FLOAT32_C(   366.85), SIMDE_FLOAT32_C(   707.41) },
+      { SIMDE_FLOAT32_C(   923.15), SIMDE_FLOAT32_C(   453.52), SIMDE_FLOAT32_C(   984.31), SIMDE_FLOAT32_C(  -345.98) },
+      { SIMDE_FLOAT32_C(   984.98), SIMDE_FLOAT32_C(   130.72), SIMDE_FLOAT32_C(    15.02), SIMDE_FLOAT32_C(   586.99) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(120760.67), SIMDE_FLOAT32_C( 59503.27), SIMDE_FLOAT32_C(129035.85), SIMDE_FLOAT32_C(-44519.10) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t v = simde_vld1q_f32(test_vec[i].v);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vfmaq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t v = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 3;
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vfmaq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 v[1];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   677.04), SIMDE_FLOAT64_C(   461.58) },
+      { SIMDE_FLOAT64_C(  -390.90), SIMDE_FLOAT64_C(  -170.89) },
+      { SIMDE_FLOAT64_C(   350.92) },
+      { SIMDE_FLOAT64_C(-136497.59), SIMDE_FLOAT64_C(-59507.14) } },
+    { { SIMDE_FLOAT64_C(  -166.01), SIMDE_FLOAT64_C(  -496.27) },
+      { SIMDE_FLOAT64_C(  -968.21), SIMDE_FLOAT64_C(   694.30) },
+      { SIMDE_FLOAT64_C(   520.24) },
+      { SIMDE_FLOAT64_C(-503867.58), SIMDE_FLOAT64_C(360706.36) } },
+    { { SIMDE_FLOAT64_C(  -571.19), SIMDE_FLOAT64_C(  -215.50) },
+      { SIMDE_FLOAT64_C(   712.09), SIMDE_FLOAT64_C(  -489.39) },
+      { SIMDE_FLOAT64_C(   436.30) },
+      { SIMDE_FLOAT64_C(310113.68), SIMDE_FLOAT64_C(-213736.36) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00), SIMDE_FLOAT64_C(   242.30) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   370.03) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(49664586504.17) } },
+    { { SIMDE_FLOAT64_C(  -849.99), SIMDE_FLOAT64_C(   -76.60) },
+      { SIMDE_FLOAT64_C(   608.00), SIMDE_FLOAT64_C(   793.63) },
+      { SIMDE_FLOAT64_C(  -285.62) },
+      { SIMDE_FLOAT64_C(-174506.95), SIMDE_FLOAT64_C(-226753.20) } },
+    { { SIMDE_FLOAT64_C(  -558.87), SIMDE_FLOAT64_C(   -75.24) },
+      { SIMDE_FLOAT64_C(  -577.02), SIMDE_FLOAT64_C(  -355.18) },
+      { SIMDE_FLOAT64_C(   186.76) },
+      { SIMDE_FLOAT64_C(-108323.13), SIMDE_FLOAT64_C(-66408.66) } },
+    { { SIMDE_FLOAT64_C(    -0.60), SIMDE_FLOAT64_C(   791.21) },
+      { SIMDE_FLOAT64_C(  -994.26), SIMDE_FLOAT64_C(   164.50) },
+      { SIMDE_FLOAT64_C(  -750.83) },
+      { SIMDE_FLOAT64_C(746519.64), SIMDE_FLOAT64_C(-122720.33) } },
+    { { SIMDE_FLOAT64_C(  -504.99), SIMDE_FLOAT64_C(   516.55) },
+      { SIMDE_FLOAT64_C(   645.57), SIMDE_FLOAT64_C(   622.65) },
+      { SIMDE_FLOAT64_C(   151.17) },
+      { SIMDE_FLOAT64_C( 97085.83), SIMDE_FLOAT64_C( 94642.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x1_t v = simde_vld1_f64(test_vec[i].v);
+    simde_float64x2_t r = simde_vfmaq_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x1_t v = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vfmaq_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 v[2];
+    int lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -490.33), SIMDE_FLOAT64_C(  -507.10) },
+      { SIMDE_FLOAT64_C(   236.76), SIMDE_FLOAT64_C(    47.83) },
+      { SIMDE_FLOAT64_C(   465.37), SIMDE_FLOAT64_C(  -900.60) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(109690.67), SIMDE_FLOAT64_C( 21751.55) } },
+    { { SIMDE_FLOAT64_C(   846.90), SIMDE_FLOAT64_C(  -779.27) },
+      { SIMDE_FLOAT64_C(  -705.52), SIMDE_FLOAT64_C(    70.31) },
+      { SIMDE_FLOAT64_C(  -565.50), SIMDE_FLOAT64_C(   359.76) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(-252970.98), SIMDE_FLOAT64_C( 24515.46) } },
+    { { SIMDE_FLOAT64_C(   355.52), SIMDE_FLOAT64_C(   218.96) },
+      { SIMDE_FLOAT64_C(   557.37), SIMDE_FLOAT64_C(  -930.38) },
+      { SIMDE_FLOAT64_C(  -267.61), SIMDE_FLOAT64_C(  -168.37) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(-93488.87), SIMDE_FLOAT64_C(156867.04) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00), SIMDE_FLOAT64_C(   -31.47) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   681.48) },
+      { SIMDE_FLOAT64_C(  -488.09), SIMDE_FLOAT64_C(134217729.00) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(91466697927.45) } },
+    { { SIMDE_FLOAT64_C(   -10.81), SIMDE_FLOAT64_C(   639.64) },
+      { SIMDE_FLOAT64_C(  -657.59), SIMDE_FLOAT64_C(  -395.96) },
+      { SIMDE_FLOAT64_C(   561.92), SIMDE_FLOAT64_C(  -827.78) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(544329.04), SIMDE_FLOAT64_C(328407.41) } },
+    { { SIMDE_FLOAT64_C(   621.09), SIMDE_FLOAT64_C(  -823.80) },
+      { SIMDE_FLOAT64_C(    88.77), SIMDE_FLOAT64_C(  -393.60) },
+      { SIMDE_FLOAT64_C(   630.79), SIMDE_FLOAT64_C(  -649.60) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( 56616.32), SIMDE_FLOAT64_C(-249102.74) } },
+    { { SIMDE_FLOAT64_C(   554.25), SIMDE_FLOAT64_C(   240.55) },
+      { SIMDE_FLOAT64_C(  -674.54), SIMDE_FLOAT64_C(  -767.60) },
+      { SIMDE_FLOAT64_C(  -500.22), SIMDE_FLOAT64_C(   264.41) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(337972.65), SIMDE_FLOAT64_C(384209.42) } },
+    { { SIMDE_FLOAT64_C(  -501.37), SIMDE_FLOAT64_C(  -765.56) },
+      { SIMDE_FLOAT64_C(  -627.59), SIMDE_FLOAT64_C(  -584.16) },
+      { SIMDE_FLOAT64_C(  -970.00), SIMDE_FLOAT64_C(  -819.78) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(513984.36), SIMDE_FLOAT64_C(478117.12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t v = simde_vld1q_f64(test_vec[i].v);
+
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmaq_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t v = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmaq_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f64(SIMDE_FLOAT64_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmas_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 b;
+    simde_float32 v[2];
+    int lane;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(    20.26),
+      SIMDE_FLOAT32_C(   204.65),
+      { SIMDE_FLOAT32_C(  -411.24), SIMDE_FLOAT32_C(    15.63) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(  3218.94) },
+    { SIMDE_FLOAT32_C(  -823.13),
+      SIMDE_FLOAT32_C(   -25.97),
+      { SIMDE_FLOAT32_C(   988.13), SIMDE_FLOAT32_C(  -577.28) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C( 14168.83) },
+    { SIMDE_FLOAT32_C(   744.11),
+      SIMDE_FLOAT32_C(   521.90),
+      { SIMDE_FLOAT32_C(  -826.82), SIMDE_FLOAT32_C(   398.46) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(208700.39) },
+    { SIMDE_FLOAT32_C(-16785408.00),
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(  -491.09), SIMDE_FLOAT32_C(  4097.00) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(     1.00) },
+    { SIMDE_FLOAT32_C(  -519.00),
+      SIMDE_FLOAT32_C(  -618.41),
+      { SIMDE_FLOAT32_C(  -649.29), SIMDE_FLOAT32_C(  -354.86) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(401008.41) },
+    { SIMDE_FLOAT32_C(   923.82),
+      SIMDE_FLOAT32_C(   418.49),
+      { SIMDE_FLOAT32_C(   -67.58), SIMDE_FLOAT32_C(    53.58) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(-27357.73) },
+    { SIMDE_FLOAT32_C(   970.48),
+      SIMDE_FLOAT32_C(  -817.17),
+      { SIMDE_FLOAT32_C(  -163.17), SIMDE_FLOAT32_C(   746.16) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(-608769.06) },
+    { SIMDE_FLOAT32_C(  -674.91),
+      SIMDE_FLOAT32_C(   532.13),
+      { SIMDE_FLOAT32_C(  -345.84), SIMDE_FLOAT32_C(   312.01) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(165354.98) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t v = simde_vld1_f32(test_vec[i].v);
+    simde_float32 r;
+    SIMDE_CONSTIFY_2_(simde_vfmas_lane_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), test_vec[i].lane, test_vec[i].a, test_vec[i].b, v);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 b = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x2_t v = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float32 r;
+    SIMDE_CONSTIFY_2_(simde_vfmas_lane_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), lane, a, b, v);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmas_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 b;
+    simde_float32 v[4];
+    int lane;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(  -854.37),
+      SIMDE_FLOAT32_C(  -306.48),
+      { SIMDE_FLOAT32_C(  -293.24), SIMDE_FLOAT32_C(   466.71), SIMDE_FLOAT32_C(    78.62), SIMDE_FLOAT32_C(  -835.32) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C( 89017.83) },
+    { SIMDE_FLOAT32_C(  -379.94),
+      SIMDE_FLOAT32_C(  -137.65),
+      { SIMDE_FLOAT32_C(  -189.82), SIMDE_FLOAT32_C(  -468.24), SIMDE_FLOAT32_C(  -978.97), SIMDE_FLOAT32_C(  -384.31) },
+       INT8_C(   3),
+      SIMDE_FLOAT32_C( 52520.33) },
+    { SIMDE_FLOAT32_C(   681.24),
+      SIMDE_FLOAT32_C(  -674.39),
+      { SIMDE_FLOAT32_C(  -773.52), SIMDE_FLOAT32_C(  -778.08), SIMDE_FLOAT32_C(  -285.43), SIMDE_FLOAT32_C(   326.55) },
+       INT8_C(   3),
+      SIMDE_FLOAT32_C(-219540.81) },
+    { SIMDE_FLOAT32_C(-16785408.00),
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(  -421.42), SIMDE_FLOAT32_C(   -36.39), SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   596.12) },
+       INT8_C(   2),
+      SIMDE_FLOAT32_C(     1.00) },
+    { SIMDE_FLOAT32_C(   987.97),
+      SIMDE_FLOAT32_C(  -833.63),
+      { SIMDE_FLOAT32_C(   473.94), SIMDE_FLOAT32_C(  -485.86), SIMDE_FLOAT32_C(  -849.57), SIMDE_FLOAT32_C(   522.89) },
+       INT8_C(   3),
+      SIMDE_FLOAT32_C(-434908.84) },
+    { SIMDE_FLOAT32_C(    60.51),
+      SIMDE_FLOAT32_C(   428.03),
+      { SIMDE_FLOAT32_C(    56.09), SIMDE_FLOAT32_C(   511.63), SIMDE_FLOAT32_C(   285.72), SIMDE_FLOAT32_C(  -792.98) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C( 24068.71) },
+    { SIMDE_FLOAT32_C(  -202.87),
+      SIMDE_FLOAT32_C(    18.49),
+      { SIMDE_FLOAT32_C(   817.40), SIMDE_FLOAT32_C(   925.47), SIMDE_FLOAT32_C(  -860.80), SIMDE_FLOAT32_C(   -77.88) },
+       INT8_C(   2),
+      SIMDE_FLOAT32_C(-16119.06) },
+    { SIMDE_FLOAT32_C(  -210.64),
+      SIMDE_FLOAT32_C(  -562.99),
+      { SIMDE_FLOAT32_C(  -780.60), SIMDE_FLOAT32_C(   573.74), SIMDE_FLOAT32_C(   748.01), SIMDE_FLOAT32_C(  -357.64) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(439259.34) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t v = simde_vld1q_f32(test_vec[i].v);
+    simde_float32 r;
+    SIMDE_CONSTIFY_4_(simde_vfmas_laneq_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), test_vec[i].lane, test_vec[i].a, test_vec[i].b, v);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 b = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x4_t v = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 3;
+
+    simde_float32 r;
+    SIMDE_CONSTIFY_4_(simde_vfmas_laneq_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), lane, a, b, v);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmad_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 b;
+    simde_float64 v[1];
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   -97.08),
+      SIMDE_FLOAT64_C(   993.23),
+      { SIMDE_FLOAT64_C(  -629.11) },
+      SIMDE_FLOAT64_C(-624948.01) },
+    { SIMDE_FLOAT64_C(  -960.85),
+      SIMDE_FLOAT64_C(   814.26),
+      { SIMDE_FLOAT64_C(     9.45) },
+      SIMDE_FLOAT64_C(  6733.91) },
+    { SIMDE_FLOAT64_C(   300.68),
+      SIMDE_FLOAT64_C(  -791.78),
+      { SIMDE_FLOAT64_C(   382.70) },
+      SIMDE_FLOAT64_C(-302713.53) },
+    { SIMDE_FLOAT64_C(-18014398777917440.00),
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(134217729.00) },
+      SIMDE_FLOAT64_C(     1.00) },
+    { SIMDE_FLOAT64_C(  -610.02),
+      SIMDE_FLOAT64_C(   557.76),
+      { SIMDE_FLOAT64_C(  -411.24) },
+      SIMDE_FLOAT64_C(-229983.24) },
+    { SIMDE_FLOAT64_C(    48.20),
+      SIMDE_FLOAT64_C(   -48.74),
+      { SIMDE_FLOAT64_C(  -899.95) },
+      SIMDE_FLOAT64_C( 43911.76) },
+    { SIMDE_FLOAT64_C(  -977.75),
+      SIMDE_FLOAT64_C(  -972.12),
+      { SIMDE_FLOAT64_C(  -473.80) },
+      SIMDE_FLOAT64_C(459612.71) },
+    { SIMDE_FLOAT64_C(   132.99),
+      SIMDE_FLOAT64_C(  -891.97),
+      { SIMDE_FLOAT64_C(   249.68) },
+      SIMDE_FLOAT64_C(-222574.08) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t v = simde_vld1_f64(test_vec[i].v);
+    simde_float64 r = simde_vfmad_lane_f64(test_vec[i].a, test_vec[i].b, v, 0);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 b = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x1_t v = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64 r = simde_vfmad_lane_f64(a, b, v, 0);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmad_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 b;
+    simde_float64 v[2];
+    int lane;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   685.71),
+      SIMDE_FLOAT64_C(   919.78),
+      { SIMDE_FLOAT64_C(   646.40), SIMDE_FLOAT64_C(   113.93) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(105476.25) },
+    { SIMDE_FLOAT64_C(   828.29),
+      SIMDE_FLOAT64_C(   834.08),
+      { SIMDE_FLOAT64_C(   127.90), SIMDE_FLOAT64_C(   592.11) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(107507.12) },
+    { SIMDE_FLOAT64_C(  -490.63),
+      SIMDE_FLOAT64_C(   234.70),
+      { SIMDE_FLOAT64_C(  -393.08), SIMDE_FLOAT64_C(  -132.39) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(-92746.51) },
+    { SIMDE_FLOAT64_C(-18014398777917440.00),
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   844.46) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(     1.00) },
+    { SIMDE_FLOAT64_C(  -776.69),
+      SIMDE_FLOAT64_C(   639.49),
+      { SIMDE_FLOAT64_C(    48.62), SIMDE_FLOAT64_C(   574.94) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C( 30315.31) },
+    { SIMDE_FLOAT64_C(   795.16),
+      SIMDE_FLOAT64_C(  -750.59),
+      { SIMDE_FLOAT64_C(  -440.47), SIMDE_FLOAT64_C(   571.08) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(-427851.78) },
+    { SIMDE_FLOAT64_C(  -246.36),
+      SIMDE_FLOAT64_C(  -327.19),
+      { SIMDE_FLOAT64_C(  -862.43), SIMDE_FLOAT64_C(  -495.23) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(161787.94) },
+    { SIMDE_FLOAT64_C(   699.16),
+      SIMDE_FLOAT64_C(   801.69),
+      { SIMDE_FLOAT64_C(   -19.79), SIMDE_FLOAT64_C(   839.52) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(-15166.29) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t v = simde_vld1q_f64(test_vec[i].v);
+    simde_float64 r;
+    SIMDE_CONSTIFY_2_(simde_vfmad_laneq_f64, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT64_C(0.0)), test_vec[i].lane, test_vec[i].a, test_vec[i].b, v);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 b = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x2_t v = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float64 r;
+    SIMDE_CONSTIFY_2_(simde_vfmad_laneq_f64, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT64_C(0.0)), lane, a, b, v);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_laneq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_laneq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmas_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmas_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmad_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmad_laneq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,289 @@
+#define SIMDE_TEST_ARM_NEON_INSN fma_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fma_n.h"
+
+static int
+test_simde_vfma_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 n;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   129.79), SIMDE_FLOAT32_C(   481.56) },
+      { SIMDE_FLOAT32_C(  -958.01), SIMDE_FLOAT32_C(   766.44) },
+      SIMDE_FLOAT32_C(   264.17),
+      { SIMDE_FLOAT32_C(-252947.73), SIMDE_FLOAT32_C(202952.03) } },
+    { { SIMDE_FLOAT32_C(   304.20), SIMDE_FLOAT32_C(   690.76) },
+      { SIMDE_FLOAT32_C(  -314.15), SIMDE_FLOAT32_C(   598.44) },
+      SIMDE_FLOAT32_C(   355.10),
+      { SIMDE_FLOAT32_C(-111250.46), SIMDE_FLOAT32_C(213196.81) } },
+    { { SIMDE_FLOAT32_C(  -735.73), SIMDE_FLOAT32_C(   415.48) },
+      { SIMDE_FLOAT32_C(   192.55), SIMDE_FLOAT32_C(   638.19) },
+      SIMDE_FLOAT32_C(   662.16),
+      { SIMDE_FLOAT32_C(126763.17), SIMDE_FLOAT32_C(422999.34) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(   218.13) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -643.69) },
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(-2636979.75) } },
+    { { SIMDE_FLOAT32_C(   307.76), SIMDE_FLOAT32_C(   348.63) },
+      { SIMDE_FLOAT32_C(   928.53), SIMDE_FLOAT32_C(   433.46) },
+      SIMDE_FLOAT32_C(    79.14),
+      { SIMDE_FLOAT32_C( 73791.62), SIMDE_FLOAT32_C( 34652.65) } },
+    { { SIMDE_FLOAT32_C(   803.62), SIMDE_FLOAT32_C(  -743.24) },
+      { SIMDE_FLOAT32_C(  -515.88), SIMDE_FLOAT32_C(   957.59) },
+      SIMDE_FLOAT32_C(   427.61),
+      { SIMDE_FLOAT32_C(-219791.83), SIMDE_FLOAT32_C(408731.81) } },
+    { { SIMDE_FLOAT32_C(   273.79), SIMDE_FLOAT32_C(    45.70) },
+      { SIMDE_FLOAT32_C(  -873.25), SIMDE_FLOAT32_C(  -233.42) },
+      SIMDE_FLOAT32_C(  -572.83),
+      { SIMDE_FLOAT32_C(500497.59), SIMDE_FLOAT32_C(133755.69) } },
+    { { SIMDE_FLOAT32_C(  -500.03), SIMDE_FLOAT32_C(   -53.56) },
+      { SIMDE_FLOAT32_C(  -791.51), SIMDE_FLOAT32_C(   636.85) },
+      SIMDE_FLOAT32_C(  -716.44),
+      { SIMDE_FLOAT32_C(566569.38), SIMDE_FLOAT32_C(-456318.34) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vfma_n_f32(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32 n = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vfma_n_f32(a, b, n);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfma_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 n;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -994.80) },
+      { SIMDE_FLOAT64_C(    17.38) },
+      SIMDE_FLOAT64_C(  -465.23),
+      { SIMDE_FLOAT64_C( -9080.50) } },
+    { { SIMDE_FLOAT64_C(  -561.10) },
+      { SIMDE_FLOAT64_C(   450.32) },
+      SIMDE_FLOAT64_C(   275.69),
+      { SIMDE_FLOAT64_C(123587.62) } },
+    { { SIMDE_FLOAT64_C(   699.08) },
+      { SIMDE_FLOAT64_C(   940.55) },
+      SIMDE_FLOAT64_C(  -451.21),
+      { SIMDE_FLOAT64_C(-423686.49) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(     1.00) } },
+    { { SIMDE_FLOAT64_C(  -459.89) },
+      { SIMDE_FLOAT64_C(  -295.98) },
+      SIMDE_FLOAT64_C(   -52.38),
+      { SIMDE_FLOAT64_C( 15043.54) } },
+    { { SIMDE_FLOAT64_C(   373.72) },
+      { SIMDE_FLOAT64_C(   953.88) },
+      SIMDE_FLOAT64_C(   766.88),
+      { SIMDE_FLOAT64_C(731885.21) } },
+    { { SIMDE_FLOAT64_C(  -862.00) },
+      { SIMDE_FLOAT64_C(  -514.09) },
+      SIMDE_FLOAT64_C(   848.68),
+      { SIMDE_FLOAT64_C(-437159.90) } },
+    { { SIMDE_FLOAT64_C(   854.04) },
+      { SIMDE_FLOAT64_C(    73.94) },
+      SIMDE_FLOAT64_C(  -554.05),
+      { SIMDE_FLOAT64_C(-40112.42) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vfma_n_f64(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64 n = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vfma_n_f64(a, b, n);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 n;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -863.92), SIMDE_FLOAT32_C(  -935.36), SIMDE_FLOAT32_C(   890.36), SIMDE_FLOAT32_C(   544.80) },
+      { SIMDE_FLOAT32_C(   138.61), SIMDE_FLOAT32_C(   262.43), SIMDE_FLOAT32_C(  -301.32), SIMDE_FLOAT32_C(    21.53) },
+      SIMDE_FLOAT32_C(  -568.21),
+      { SIMDE_FLOAT32_C(-79623.51), SIMDE_FLOAT32_C(-150050.72), SIMDE_FLOAT32_C(172103.41), SIMDE_FLOAT32_C(-11688.76) } },
+    { { SIMDE_FLOAT32_C(   441.64), SIMDE_FLOAT32_C(   224.92), SIMDE_FLOAT32_C(   178.78), SIMDE_FLOAT32_C(  -751.99) },
+      { SIMDE_FLOAT32_C(  -917.60), SIMDE_FLOAT32_C(  -988.40), SIMDE_FLOAT32_C(   532.44), SIMDE_FLOAT32_C(   848.88) },
+      SIMDE_FLOAT32_C(   299.74),
+      { SIMDE_FLOAT32_C(-274599.78), SIMDE_FLOAT32_C(-296038.09), SIMDE_FLOAT32_C(159772.34), SIMDE_FLOAT32_C(253691.30) } },
+    { { SIMDE_FLOAT32_C(   474.29), SIMDE_FLOAT32_C(  -206.28), SIMDE_FLOAT32_C(   -37.18), SIMDE_FLOAT32_C(  -568.15) },
+      { SIMDE_FLOAT32_C(   741.33), SIMDE_FLOAT32_C(  -944.86), SIMDE_FLOAT32_C(   580.07), SIMDE_FLOAT32_C(   770.17) },
+      SIMDE_FLOAT32_C(  -594.38),
+      { SIMDE_FLOAT32_C(-440157.44), SIMDE_FLOAT32_C(561399.62), SIMDE_FLOAT32_C(-344819.19), SIMDE_FLOAT32_C(-458341.78) } },
+    { { SIMDE_FLOAT32_C(-16785408.00), SIMDE_FLOAT32_C(  -118.90), SIMDE_FLOAT32_C(   687.87), SIMDE_FLOAT32_C(  -632.65) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(    38.89), SIMDE_FLOAT32_C(  -325.08), SIMDE_FLOAT32_C(  -271.00) },
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(159213.42), SIMDE_FLOAT32_C(-1331164.88), SIMDE_FLOAT32_C(-1110919.62) } },
+    { { SIMDE_FLOAT32_C(   105.81), SIMDE_FLOAT32_C(   257.44), SIMDE_FLOAT32_C(   273.52), SIMDE_FLOAT32_C(  -869.69) },
+      { SIMDE_FLOAT32_C(   857.30), SIMDE_FLOAT32_C(   317.63), SIMDE_FLOAT32_C(  -219.81), SIMDE_FLOAT32_C(   809.14) },
+      SIMDE_FLOAT32_C(   909.06),
+      { SIMDE_FLOAT32_C(779442.94), SIMDE_FLOAT32_C(289002.16), SIMDE_FLOAT32_C(-199546.95), SIMDE_FLOAT32_C(734687.12) } },
+    { { SIMDE_FLOAT32_C(  -780.06), SIMDE_FLOAT32_C(   -65.22), SIMDE_FLOAT32_C(  -692.45), SIMDE_FLOAT32_C(   517.90) },
+      { SIMDE_FLOAT32_C(   206.04), SIMDE_FLOAT32_C(  -624.19), SIMDE_FLOAT32_C(   199.30), SIMDE_FLOAT32_C(   736.50) },
+      SIMDE_FLOAT32_C(   174.84),
+      { SIMDE_FLOAT32_C( 35243.97), SIMDE_FLOAT32_C(-109198.60), SIMDE_FLOAT32_C( 34153.16), SIMDE_FLOAT32_C(129287.55) } },
+    { { SIMDE_FLOAT32_C(  -255.55), SIMDE_FLOAT32_C(  -647.77), SIMDE_FLOAT32_C(  -937.37), SIMDE_FLOAT32_C(  -287.77) },
+      { SIMDE_FLOAT32_C(   682.89), SIMDE_FLOAT32_C(  -220.61), SIMDE_FLOAT32_C(  -782.15), SIMDE_FLOAT32_C(  -832.12) },
+      SIMDE_FLOAT32_C(   944.24),
+      { SIMDE_FLOAT32_C(644556.50), SIMDE_FLOAT32_C(-208956.56), SIMDE_FLOAT32_C(-739474.69), SIMDE_FLOAT32_C(-786008.75) } },
+    { { SIMDE_FLOAT32_C(   972.10), SIMDE_FLOAT32_C(  -871.38), SIMDE_FLOAT32_C(   485.86), SIMDE_FLOAT32_C(  -921.47) },
+      { SIMDE_FLOAT32_C(   742.62), SIMDE_FLOAT32_C(   -71.72), SIMDE_FLOAT32_C(   -70.46), SIMDE_FLOAT32_C(   674.51) },
+      SIMDE_FLOAT32_C(   252.27),
+      { SIMDE_FLOAT32_C(188312.84), SIMDE_FLOAT32_C(-18964.19), SIMDE_FLOAT32_C(-17289.08), SIMDE_FLOAT32_C(169237.17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vfmaq_n_f32(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32 n = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vfmaq_n_f32(a, b, n);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmaq_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 n;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   168.47), SIMDE_FLOAT64_C(   -35.47) },
+      { SIMDE_FLOAT64_C(   586.84), SIMDE_FLOAT64_C(   563.87) },
+      SIMDE_FLOAT64_C(   237.50),
+      { SIMDE_FLOAT64_C(139542.97), SIMDE_FLOAT64_C(133883.65) } },
+    { { SIMDE_FLOAT64_C(  -895.64), SIMDE_FLOAT64_C(   -19.04) },
+      { SIMDE_FLOAT64_C(   884.76), SIMDE_FLOAT64_C(  -197.97) },
+      SIMDE_FLOAT64_C(  -906.92),
+      { SIMDE_FLOAT64_C(-803302.18), SIMDE_FLOAT64_C(179523.91) } },
+    { { SIMDE_FLOAT64_C(   395.11), SIMDE_FLOAT64_C(   509.95) },
+      { SIMDE_FLOAT64_C(    -3.00), SIMDE_FLOAT64_C(   127.56) },
+      SIMDE_FLOAT64_C(  -906.83),
+      { SIMDE_FLOAT64_C(  3115.60), SIMDE_FLOAT64_C(-115165.28) } },
+    { { SIMDE_FLOAT64_C(-18014398777917440.00), SIMDE_FLOAT64_C(  -101.34) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(  -995.39) },
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(-133598985370.65) } },
+    { { SIMDE_FLOAT64_C(  -593.07), SIMDE_FLOAT64_C(   888.20) },
+      { SIMDE_FLOAT64_C(     1.82), SIMDE_FLOAT64_C(   432.42) },
+      SIMDE_FLOAT64_C(  -877.88),
+      { SIMDE_FLOAT64_C( -2190.81), SIMDE_FLOAT64_C(-378724.67) } },
+    { { SIMDE_FLOAT64_C(   566.34), SIMDE_FLOAT64_C(   154.57) },
+      { SIMDE_FLOAT64_C(   246.91), SIMDE_FLOAT64_C(  -284.48) },
+      SIMDE_FLOAT64_C(  -500.61),
+      { SIMDE_FLOAT64_C(-123039.28), SIMDE_FLOAT64_C(142568.10) } },
+    { { SIMDE_FLOAT64_C(   527.28), SIMDE_FLOAT64_C(   -71.87) },
+      { SIMDE_FLOAT64_C(   496.74), SIMDE_FLOAT64_C(   422.03) },
+      SIMDE_FLOAT64_C(  -215.84),
+      { SIMDE_FLOAT64_C(-106689.08), SIMDE_FLOAT64_C(-91162.83) } },
+    { { SIMDE_FLOAT64_C(  -910.64), SIMDE_FLOAT64_C(  -402.47) },
+      { SIMDE_FLOAT64_C(  -499.82), SIMDE_FLOAT64_C(  -586.00) },
+      SIMDE_FLOAT64_C(   716.45),
+      { SIMDE_FLOAT64_C(-359006.68), SIMDE_FLOAT64_C(-420242.17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vfmaq_n_f64(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64 n = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vfmaq_n_f64(a, b, n);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_n_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_n_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
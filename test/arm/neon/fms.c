@@ -0,0 +1,293 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms.h"
+
+static int
+test_simde_vfms_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   495.01), SIMDE_FLOAT32_C(  -533.99) },
+      { SIMDE_FLOAT32_C(  -500.28), SIMDE_FLOAT32_C(  -447.35) },
+      { SIMDE_FLOAT32_C(  -195.98), SIMDE_FLOAT32_C(   -19.41) },
+      { SIMDE_FLOAT32_C(-97549.86), SIMDE_FLOAT32_C( -9217.05) } },
+    { { SIMDE_FLOAT32_C(   419.86), SIMDE_FLOAT32_C(  -528.48) },
+      { SIMDE_FLOAT32_C(   793.85), SIMDE_FLOAT32_C(  -212.92) },
+      { SIMDE_FLOAT32_C(  -228.92), SIMDE_FLOAT32_C(  -613.03) },
+      { SIMDE_FLOAT32_C(182148.00), SIMDE_FLOAT32_C(-131054.84) } },
+    { { SIMDE_FLOAT32_C(   169.07), SIMDE_FLOAT32_C(   328.30) },
+      { SIMDE_FLOAT32_C(  -586.58), SIMDE_FLOAT32_C(   408.17) },
+      { SIMDE_FLOAT32_C(    55.21), SIMDE_FLOAT32_C(  -396.24) },
+      { SIMDE_FLOAT32_C( 32554.15), SIMDE_FLOAT32_C(162061.58) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(  -830.58) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   995.75) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -542.93) },
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(539791.94) } },
+    { { SIMDE_FLOAT32_C(  -352.55), SIMDE_FLOAT32_C(   491.22) },
+      { SIMDE_FLOAT32_C(  -834.40), SIMDE_FLOAT32_C(   167.27) },
+      { SIMDE_FLOAT32_C(   306.34), SIMDE_FLOAT32_C(    56.95) },
+      { SIMDE_FLOAT32_C(255257.55), SIMDE_FLOAT32_C( -9034.81) } },
+    { { SIMDE_FLOAT32_C(  -635.21), SIMDE_FLOAT32_C(  -792.91) },
+      { SIMDE_FLOAT32_C(  -986.61), SIMDE_FLOAT32_C(   775.56) },
+      { SIMDE_FLOAT32_C(   642.23), SIMDE_FLOAT32_C(  -205.08) },
+      { SIMDE_FLOAT32_C(632995.31), SIMDE_FLOAT32_C(158258.94) } },
+    { { SIMDE_FLOAT32_C(  -253.28), SIMDE_FLOAT32_C(   223.61) },
+      { SIMDE_FLOAT32_C(   -19.92), SIMDE_FLOAT32_C(  -444.05) },
+      { SIMDE_FLOAT32_C(   271.01), SIMDE_FLOAT32_C(  -243.74) },
+      { SIMDE_FLOAT32_C(  5145.24), SIMDE_FLOAT32_C(-108009.13) } },
+    { { SIMDE_FLOAT32_C(   516.31), SIMDE_FLOAT32_C(   192.26) },
+      { SIMDE_FLOAT32_C(  -451.32), SIMDE_FLOAT32_C(    33.74) },
+      { SIMDE_FLOAT32_C(   173.40), SIMDE_FLOAT32_C(    41.68) },
+      { SIMDE_FLOAT32_C( 78775.20), SIMDE_FLOAT32_C( -1214.02) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+    simde_float32x2_t r = simde_vfms_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t c = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vfms_f32(a, b, c);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfms_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   566.44) },
+      { SIMDE_FLOAT64_C(   268.24) },
+      { SIMDE_FLOAT64_C(  -211.25) },
+      { SIMDE_FLOAT64_C( 57232.14) } },
+    { { SIMDE_FLOAT64_C(   865.00) },
+      { SIMDE_FLOAT64_C(  -873.21) },
+      { SIMDE_FLOAT64_C(  -122.82) },
+      { SIMDE_FLOAT64_C(-106382.65) } },
+    { { SIMDE_FLOAT64_C(   461.22) },
+      { SIMDE_FLOAT64_C(  -841.39) },
+      { SIMDE_FLOAT64_C(  -883.73) },
+      { SIMDE_FLOAT64_C(-743100.36) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(    -1.00) } },
+    { { SIMDE_FLOAT64_C(   438.95) },
+      { SIMDE_FLOAT64_C(   200.05) },
+      { SIMDE_FLOAT64_C(  -560.24) },
+      { SIMDE_FLOAT64_C(112514.96) } },
+    { { SIMDE_FLOAT64_C(   827.01) },
+      { SIMDE_FLOAT64_C(  -640.65) },
+      { SIMDE_FLOAT64_C(  -997.35) },
+      { SIMDE_FLOAT64_C(-638125.27) } },
+    { { SIMDE_FLOAT64_C(  -379.51) },
+      { SIMDE_FLOAT64_C(  -474.82) },
+      { SIMDE_FLOAT64_C(  -352.73) },
+      { SIMDE_FLOAT64_C(-167862.77) } },
+    { { SIMDE_FLOAT64_C(   169.42) },
+      { SIMDE_FLOAT64_C(   196.60) },
+      { SIMDE_FLOAT64_C(   150.65) },
+      { SIMDE_FLOAT64_C(-29448.37) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfms_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t c = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vfms_f64(a, b, c);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   712.79), SIMDE_FLOAT32_C(  -532.26), SIMDE_FLOAT32_C(  -387.59), SIMDE_FLOAT32_C(  -307.06) },
+      { SIMDE_FLOAT32_C(   950.70), SIMDE_FLOAT32_C(  -623.65), SIMDE_FLOAT32_C(  -368.35), SIMDE_FLOAT32_C(   922.06) },
+      { SIMDE_FLOAT32_C(  -985.10), SIMDE_FLOAT32_C(   595.72), SIMDE_FLOAT32_C(   855.07), SIMDE_FLOAT32_C(   -30.66) },
+      { SIMDE_FLOAT32_C(937247.38), SIMDE_FLOAT32_C(370988.50), SIMDE_FLOAT32_C(314577.44), SIMDE_FLOAT32_C( 27963.30) } },
+    { { SIMDE_FLOAT32_C(  -452.07), SIMDE_FLOAT32_C(  -887.97), SIMDE_FLOAT32_C(   258.80), SIMDE_FLOAT32_C(   780.65) },
+      { SIMDE_FLOAT32_C(  -557.38), SIMDE_FLOAT32_C(  -619.37), SIMDE_FLOAT32_C(  -385.18), SIMDE_FLOAT32_C(   518.85) },
+      { SIMDE_FLOAT32_C(  -440.32), SIMDE_FLOAT32_C(   512.97), SIMDE_FLOAT32_C(    19.15), SIMDE_FLOAT32_C(   939.62) },
+      { SIMDE_FLOAT32_C(-245877.64), SIMDE_FLOAT32_C(316830.25), SIMDE_FLOAT32_C(  7635.00), SIMDE_FLOAT32_C(-486741.16) } },
+    { { SIMDE_FLOAT32_C(   -22.17), SIMDE_FLOAT32_C(   528.17), SIMDE_FLOAT32_C(   317.70), SIMDE_FLOAT32_C(   -14.27) },
+      { SIMDE_FLOAT32_C(  -167.58), SIMDE_FLOAT32_C(   415.16), SIMDE_FLOAT32_C(   846.18), SIMDE_FLOAT32_C(   695.01) },
+      { SIMDE_FLOAT32_C(  -127.83), SIMDE_FLOAT32_C(   245.42), SIMDE_FLOAT32_C(   -11.06), SIMDE_FLOAT32_C(  -473.64) },
+      { SIMDE_FLOAT32_C(-21443.92), SIMDE_FLOAT32_C(-101360.40), SIMDE_FLOAT32_C(  9676.45), SIMDE_FLOAT32_C(329170.28) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(    16.60), SIMDE_FLOAT32_C(  -947.07), SIMDE_FLOAT32_C(   424.34) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   721.42), SIMDE_FLOAT32_C(  -201.84), SIMDE_FLOAT32_C(  -973.14) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   372.23), SIMDE_FLOAT32_C(    15.54), SIMDE_FLOAT32_C(  -567.85) },
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(-268517.56), SIMDE_FLOAT32_C(  2189.52), SIMDE_FLOAT32_C(-552173.19) } },
+    { { SIMDE_FLOAT32_C(  -530.04), SIMDE_FLOAT32_C(  -380.00), SIMDE_FLOAT32_C(  -943.03), SIMDE_FLOAT32_C(   894.19) },
+      { SIMDE_FLOAT32_C(  -469.02), SIMDE_FLOAT32_C(   891.09), SIMDE_FLOAT32_C(  -550.93), SIMDE_FLOAT32_C(   946.78) },
+      { SIMDE_FLOAT32_C(   681.08), SIMDE_FLOAT32_C(  -894.81), SIMDE_FLOAT32_C(   829.14), SIMDE_FLOAT32_C(   398.19) },
+      { SIMDE_FLOAT32_C(318910.09), SIMDE_FLOAT32_C(796976.25), SIMDE_FLOAT32_C(455855.06), SIMDE_FLOAT32_C(-376104.16) } },
+    { { SIMDE_FLOAT32_C(   451.14), SIMDE_FLOAT32_C(  -433.60), SIMDE_FLOAT32_C(  -131.51), SIMDE_FLOAT32_C(  -297.51) },
+      { SIMDE_FLOAT32_C(  -766.13), SIMDE_FLOAT32_C(  -261.95), SIMDE_FLOAT32_C(  -771.16), SIMDE_FLOAT32_C(   327.92) },
+      { SIMDE_FLOAT32_C(  -418.51), SIMDE_FLOAT32_C(   844.07), SIMDE_FLOAT32_C(   893.53), SIMDE_FLOAT32_C(  -481.84) },
+      { SIMDE_FLOAT32_C(-320181.94), SIMDE_FLOAT32_C(220670.55), SIMDE_FLOAT32_C(688923.06), SIMDE_FLOAT32_C(157707.47) } },
+    { { SIMDE_FLOAT32_C(  -821.15), SIMDE_FLOAT32_C(   269.80), SIMDE_FLOAT32_C(   -99.95), SIMDE_FLOAT32_C(   384.89) },
+      { SIMDE_FLOAT32_C(  -719.28), SIMDE_FLOAT32_C(    70.98), SIMDE_FLOAT32_C(  -434.85), SIMDE_FLOAT32_C(   998.27) },
+      { SIMDE_FLOAT32_C(   265.61), SIMDE_FLOAT32_C(  -159.58), SIMDE_FLOAT32_C(   -51.54), SIMDE_FLOAT32_C(   997.10) },
+      { SIMDE_FLOAT32_C(190226.81), SIMDE_FLOAT32_C( 11596.79), SIMDE_FLOAT32_C(-22512.12), SIMDE_FLOAT32_C(-994990.12) } },
+    { { SIMDE_FLOAT32_C(    85.25), SIMDE_FLOAT32_C(   298.30), SIMDE_FLOAT32_C(   544.89), SIMDE_FLOAT32_C(   111.98) },
+      { SIMDE_FLOAT32_C(  -286.17), SIMDE_FLOAT32_C(  -313.30), SIMDE_FLOAT32_C(   -72.81), SIMDE_FLOAT32_C(   409.00) },
+      { SIMDE_FLOAT32_C(  -545.44), SIMDE_FLOAT32_C(  -381.82), SIMDE_FLOAT32_C(  -559.59), SIMDE_FLOAT32_C(  -468.70) },
+      { SIMDE_FLOAT32_C(-156003.33), SIMDE_FLOAT32_C(-119325.91), SIMDE_FLOAT32_C(-40198.86), SIMDE_FLOAT32_C(191810.28) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+    simde_float32x4_t r = simde_vfmsq_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t c = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vfmsq_f32(a, b, c);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -196.76), SIMDE_FLOAT64_C(  -806.58) },
+      { SIMDE_FLOAT64_C(   868.87), SIMDE_FLOAT64_C(   855.27) },
+      { SIMDE_FLOAT64_C(   850.94), SIMDE_FLOAT64_C(    83.01) },
+      { SIMDE_FLOAT64_C(-739553.00), SIMDE_FLOAT64_C(-71802.54) } },
+    { { SIMDE_FLOAT64_C(  -225.82), SIMDE_FLOAT64_C(  -570.67) },
+      { SIMDE_FLOAT64_C(  -829.38), SIMDE_FLOAT64_C(   121.00) },
+      { SIMDE_FLOAT64_C(  -418.92), SIMDE_FLOAT64_C(   765.90) },
+      { SIMDE_FLOAT64_C(-347669.69), SIMDE_FLOAT64_C(-93244.57) } },
+    { { SIMDE_FLOAT64_C(  -149.31), SIMDE_FLOAT64_C(   889.79) },
+      { SIMDE_FLOAT64_C(  -244.38), SIMDE_FLOAT64_C(   331.38) },
+      { SIMDE_FLOAT64_C(  -834.41), SIMDE_FLOAT64_C(   -95.29) },
+      { SIMDE_FLOAT64_C(-204062.43), SIMDE_FLOAT64_C( 32466.99) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00), SIMDE_FLOAT64_C(   -23.81) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   365.50) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(  -893.71) },
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(326627.20) } },
+    { { SIMDE_FLOAT64_C(  -522.46), SIMDE_FLOAT64_C(   884.42) },
+      { SIMDE_FLOAT64_C(  -154.51), SIMDE_FLOAT64_C(  -352.10) },
+      { SIMDE_FLOAT64_C(   416.48), SIMDE_FLOAT64_C(  -273.68) },
+      { SIMDE_FLOAT64_C( 63827.86), SIMDE_FLOAT64_C(-95478.31) } },
+    { { SIMDE_FLOAT64_C(   178.18), SIMDE_FLOAT64_C(  -116.32) },
+      { SIMDE_FLOAT64_C(   155.13), SIMDE_FLOAT64_C(  -243.22) },
+      { SIMDE_FLOAT64_C(  -169.38), SIMDE_FLOAT64_C(   129.82) },
+      { SIMDE_FLOAT64_C( 26454.10), SIMDE_FLOAT64_C( 31458.50) } },
+    { { SIMDE_FLOAT64_C(   993.53), SIMDE_FLOAT64_C(    26.66) },
+      { SIMDE_FLOAT64_C(   907.54), SIMDE_FLOAT64_C(   457.91) },
+      { SIMDE_FLOAT64_C(   -97.01), SIMDE_FLOAT64_C(  -501.28) },
+      { SIMDE_FLOAT64_C( 89033.99), SIMDE_FLOAT64_C(229567.78) } },
+    { { SIMDE_FLOAT64_C(   932.33), SIMDE_FLOAT64_C(  -152.70) },
+      { SIMDE_FLOAT64_C(  -505.27), SIMDE_FLOAT64_C(  -242.81) },
+      { SIMDE_FLOAT64_C(   665.86), SIMDE_FLOAT64_C(  -214.12) },
+      { SIMDE_FLOAT64_C(337371.41), SIMDE_FLOAT64_C(-52143.18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmsq_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t c = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vfmsq_f64(a, b, c);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
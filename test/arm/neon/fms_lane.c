@@ -0,0 +1,985 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms_lane.h"
+
+static int
+test_simde_vfms_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 v[2];
+    int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   557.63), SIMDE_FLOAT32_C(  -529.51) },
+      { SIMDE_FLOAT32_C(  -387.75), SIMDE_FLOAT32_C(  -941.61) },
+      { SIMDE_FLOAT32_C(  -554.00), SIMDE_FLOAT32_C(   480.41) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(186836.61), SIMDE_FLOAT32_C(451829.34) } },
+    { { SIMDE_FLOAT32_C(   -95.70), SIMDE_FLOAT32_C(   550.29) },
+      { SIMDE_FLOAT32_C(  -796.14), SIMDE_FLOAT32_C(  -163.31) },
+      { SIMDE_FLOAT32_C(   907.43), SIMDE_FLOAT32_C(   338.46) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(722345.62), SIMDE_FLOAT32_C(148742.69) } },
+    { { SIMDE_FLOAT32_C(  -265.79), SIMDE_FLOAT32_C(  -500.16) },
+      { SIMDE_FLOAT32_C(  -328.12), SIMDE_FLOAT32_C(  -122.94) },
+      { SIMDE_FLOAT32_C(  -116.86), SIMDE_FLOAT32_C(   799.65) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-38609.89), SIMDE_FLOAT32_C(-14866.93) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(  -188.43) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -224.50) },
+      { SIMDE_FLOAT32_C(   484.33), SIMDE_FLOAT32_C(  4097.00) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(919588.06) } },
+    { { SIMDE_FLOAT32_C(  -356.42), SIMDE_FLOAT32_C(  -645.19) },
+      { SIMDE_FLOAT32_C(   490.51), SIMDE_FLOAT32_C(   624.27) },
+      { SIMDE_FLOAT32_C(   245.04), SIMDE_FLOAT32_C(    41.60) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-20761.63), SIMDE_FLOAT32_C(-26614.82) } },
+    { { SIMDE_FLOAT32_C(   232.20), SIMDE_FLOAT32_C(  -598.90) },
+      { SIMDE_FLOAT32_C(   817.30), SIMDE_FLOAT32_C(   236.82) },
+      { SIMDE_FLOAT32_C(   771.00), SIMDE_FLOAT32_C(  -262.78) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-629906.06), SIMDE_FLOAT32_C(-183187.12) } },
+    { { SIMDE_FLOAT32_C(  -824.16), SIMDE_FLOAT32_C(  -335.49) },
+      { SIMDE_FLOAT32_C(  -461.61), SIMDE_FLOAT32_C(  -490.66) },
+      { SIMDE_FLOAT32_C(    61.70), SIMDE_FLOAT32_C(  -657.34) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-304258.88), SIMDE_FLOAT32_C(-322865.94) } },
+    { { SIMDE_FLOAT32_C(   496.43), SIMDE_FLOAT32_C(  -192.59) },
+      { SIMDE_FLOAT32_C(   738.70), SIMDE_FLOAT32_C(  -180.42) },
+      { SIMDE_FLOAT32_C(  -877.22), SIMDE_FLOAT32_C(  -394.34) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(291795.38), SIMDE_FLOAT32_C(-71339.41) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t v = simde_vld1_f32(test_vec[i].v);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfms_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t v = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfms_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfms_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 v[4];
+    int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   764.84), SIMDE_FLOAT32_C(   646.67) },
+      { SIMDE_FLOAT32_C(  -228.56), SIMDE_FLOAT32_C(  -655.17) },
+      { SIMDE_FLOAT32_C(  -175.81), SIMDE_FLOAT32_C(    52.85), SIMDE_FLOAT32_C(  -302.18), SIMDE_FLOAT32_C(  -781.28) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-39418.29), SIMDE_FLOAT32_C(-114538.77) } },
+    { { SIMDE_FLOAT32_C(    33.67), SIMDE_FLOAT32_C(   158.64) },
+      { SIMDE_FLOAT32_C(  -100.72), SIMDE_FLOAT32_C(  -607.94) },
+      { SIMDE_FLOAT32_C(   432.40), SIMDE_FLOAT32_C(   994.47), SIMDE_FLOAT32_C(   519.31), SIMDE_FLOAT32_C(  -222.88) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(100196.69), SIMDE_FLOAT32_C(604736.69) } },
+    { { SIMDE_FLOAT32_C(   424.79), SIMDE_FLOAT32_C(   379.90) },
+      { SIMDE_FLOAT32_C(  -802.62), SIMDE_FLOAT32_C(  -777.27) },
+      { SIMDE_FLOAT32_C(  -834.83), SIMDE_FLOAT32_C(  -652.00), SIMDE_FLOAT32_C(   629.77), SIMDE_FLOAT32_C(  -402.36) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(-322517.38), SIMDE_FLOAT32_C(-312362.47) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(  -259.92) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   223.62) },
+      { SIMDE_FLOAT32_C(   822.55), SIMDE_FLOAT32_C(   881.67), SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -235.37) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(-916431.06) } },
+    { { SIMDE_FLOAT32_C(   431.01), SIMDE_FLOAT32_C(   -49.11) },
+      { SIMDE_FLOAT32_C(   312.75), SIMDE_FLOAT32_C(   124.19) },
+      { SIMDE_FLOAT32_C(  -364.88), SIMDE_FLOAT32_C(   111.46), SIMDE_FLOAT32_C(    87.87), SIMDE_FLOAT32_C(    59.19) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(-18080.66), SIMDE_FLOAT32_C( -7399.92) } },
+    { { SIMDE_FLOAT32_C(    -0.80), SIMDE_FLOAT32_C(    84.19) },
+      { SIMDE_FLOAT32_C(    22.66), SIMDE_FLOAT32_C(    85.91) },
+      { SIMDE_FLOAT32_C(   896.24), SIMDE_FLOAT32_C(   372.79), SIMDE_FLOAT32_C(   432.39), SIMDE_FLOAT32_C(   835.58) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-20309.60), SIMDE_FLOAT32_C(-76911.79) } },
+    { { SIMDE_FLOAT32_C(   403.47), SIMDE_FLOAT32_C(   650.76) },
+      { SIMDE_FLOAT32_C(  -876.41), SIMDE_FLOAT32_C(  -512.07) },
+      { SIMDE_FLOAT32_C(   205.18), SIMDE_FLOAT32_C(    11.10), SIMDE_FLOAT32_C(   960.42), SIMDE_FLOAT32_C(  -887.07) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(-777033.56), SIMDE_FLOAT32_C(-453591.19) } },
+    { { SIMDE_FLOAT32_C(   304.44), SIMDE_FLOAT32_C(   379.04) },
+      { SIMDE_FLOAT32_C(  -839.16), SIMDE_FLOAT32_C(  -796.59) },
+      { SIMDE_FLOAT32_C(   406.77), SIMDE_FLOAT32_C(   952.97), SIMDE_FLOAT32_C(  -936.88), SIMDE_FLOAT32_C(  -126.70) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(799998.69), SIMDE_FLOAT32_C(759505.44) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x4_t v = simde_vld1q_f32(test_vec[i].v);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vfms_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x4_t v = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 3;
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vfms_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfms_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 v[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   569.27) },
+      { SIMDE_FLOAT64_C(  -513.19) },
+      { SIMDE_FLOAT64_C(   -73.34) },
+      { SIMDE_FLOAT64_C(-37068.08) } },
+    { { SIMDE_FLOAT64_C(  -765.12) },
+      { SIMDE_FLOAT64_C(   687.80) },
+      { SIMDE_FLOAT64_C(  -693.71) },
+      { SIMDE_FLOAT64_C(476368.62) } },
+    { { SIMDE_FLOAT64_C(  -386.69) },
+      { SIMDE_FLOAT64_C(  -937.31) },
+      { SIMDE_FLOAT64_C(  -360.34) },
+      { SIMDE_FLOAT64_C(-338136.98) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(    -1.00) } },
+    { { SIMDE_FLOAT64_C(  -495.59) },
+      { SIMDE_FLOAT64_C(     1.29) },
+      { SIMDE_FLOAT64_C(  -988.09) },
+      { SIMDE_FLOAT64_C(   779.05) } },
+    { { SIMDE_FLOAT64_C(   476.17) },
+      { SIMDE_FLOAT64_C(   251.37) },
+      { SIMDE_FLOAT64_C(   711.97) },
+      { SIMDE_FLOAT64_C(-178491.73) } },
+    { { SIMDE_FLOAT64_C(   426.89) },
+      { SIMDE_FLOAT64_C(   859.74) },
+      { SIMDE_FLOAT64_C(  -250.47) },
+      { SIMDE_FLOAT64_C(215765.97) } },
+    { { SIMDE_FLOAT64_C(  -759.24) },
+      { SIMDE_FLOAT64_C(   231.00) },
+      { SIMDE_FLOAT64_C(   417.69) },
+      { SIMDE_FLOAT64_C(-97245.63) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t v = simde_vld1_f64(test_vec[i].v);
+    simde_float64x1_t r = simde_vfms_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t v = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vfms_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfms_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 v[2];
+    int lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   202.54) },
+      { SIMDE_FLOAT64_C(   815.97) },
+      { SIMDE_FLOAT64_C(  -534.02), SIMDE_FLOAT64_C(  -103.87) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( 84957.34) } },
+    { { SIMDE_FLOAT64_C(   687.36) },
+      { SIMDE_FLOAT64_C(   774.52) },
+      { SIMDE_FLOAT64_C(   -72.24), SIMDE_FLOAT64_C(   409.93) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( 56638.68) } },
+    { { SIMDE_FLOAT64_C(   278.38) },
+      { SIMDE_FLOAT64_C(   278.81) },
+      { SIMDE_FLOAT64_C(   515.14), SIMDE_FLOAT64_C(   704.29) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(-196084.71) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(  -134.35), SIMDE_FLOAT64_C(134217729.00) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(    -1.00) } },
+    { { SIMDE_FLOAT64_C(   819.42) },
+      { SIMDE_FLOAT64_C(   474.31) },
+      { SIMDE_FLOAT64_C(  -172.27), SIMDE_FLOAT64_C(  -800.74) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(380618.41) } },
+    { { SIMDE_FLOAT64_C(   862.28) },
+      { SIMDE_FLOAT64_C(  -339.81) },
+      { SIMDE_FLOAT64_C(   324.96), SIMDE_FLOAT64_C(   618.67) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(211092.53) } },
+    { { SIMDE_FLOAT64_C(  -475.67) },
+      { SIMDE_FLOAT64_C(  -832.53) },
+      { SIMDE_FLOAT64_C(   997.07), SIMDE_FLOAT64_C(  -255.19) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(829615.02) } },
+    { { SIMDE_FLOAT64_C(  -108.69) },
+      { SIMDE_FLOAT64_C(  -578.50) },
+      { SIMDE_FLOAT64_C(   167.50), SIMDE_FLOAT64_C(   660.06) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(381736.02) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x2_t v = simde_vld1q_f64(test_vec[i].v);
+
+    simde_float64x1_t r;
+    SIMDE_CONSTIFY_2_(simde_vfms_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x2_t v = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float64x1_t r;
+    SIMDE_CONSTIFY_2_(simde_vfms_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f64(SIMDE_FLOAT64_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 v[2];
+    int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    -3.10), SIMDE_FLOAT32_C(  -551.52), SIMDE_FLOAT32_C(   962.15), SIMDE_FLOAT32_C(  -847.84) },
+      { SIMDE_FLOAT32_C(    11.72), SIMDE_FLOAT32_C(   438.34), SIMDE_FLOAT32_C(   889.70), SIMDE_FLOAT32_C(   229.23) },
+      { SIMDE_FLOAT32_C(   814.10), SIMDE_FLOAT32_C(  -649.85) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(  7613.14), SIMDE_FLOAT32_C(284303.72), SIMDE_FLOAT32_C(579133.69), SIMDE_FLOAT32_C(148117.27) } },
+    { { SIMDE_FLOAT32_C(   462.21), SIMDE_FLOAT32_C(   824.16), SIMDE_FLOAT32_C(  -710.40), SIMDE_FLOAT32_C(  -695.29) },
+      { SIMDE_FLOAT32_C(   894.99), SIMDE_FLOAT32_C(  -284.97), SIMDE_FLOAT32_C(   377.34), SIMDE_FLOAT32_C(   587.68) },
+      { SIMDE_FLOAT32_C(   455.05), SIMDE_FLOAT32_C(   601.99) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-406802.97), SIMDE_FLOAT32_C(130499.76), SIMDE_FLOAT32_C(-172418.95), SIMDE_FLOAT32_C(-268119.06) } },
+    { { SIMDE_FLOAT32_C(  -873.21), SIMDE_FLOAT32_C(   905.79), SIMDE_FLOAT32_C(   421.91), SIMDE_FLOAT32_C(   931.11) },
+      { SIMDE_FLOAT32_C(  -400.26), SIMDE_FLOAT32_C(  -322.17), SIMDE_FLOAT32_C(   574.71), SIMDE_FLOAT32_C(   776.22) },
+      { SIMDE_FLOAT32_C(  -302.55), SIMDE_FLOAT32_C(  -686.69) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-121971.87), SIMDE_FLOAT32_C(-96566.74), SIMDE_FLOAT32_C(174300.42), SIMDE_FLOAT32_C(235776.45) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(  -982.47), SIMDE_FLOAT32_C(  -934.93), SIMDE_FLOAT32_C(  -277.74) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   591.86), SIMDE_FLOAT32_C(   618.49), SIMDE_FLOAT32_C(   512.50) },
+      { SIMDE_FLOAT32_C(   705.74), SIMDE_FLOAT32_C(  4097.00) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(-2425832.75), SIMDE_FLOAT32_C(-2534888.50), SIMDE_FLOAT32_C(-2099990.25) } },
+    { { SIMDE_FLOAT32_C(  -433.66), SIMDE_FLOAT32_C(    97.48), SIMDE_FLOAT32_C(   874.91), SIMDE_FLOAT32_C(  -322.57) },
+      { SIMDE_FLOAT32_C(   904.16), SIMDE_FLOAT32_C(  -495.65), SIMDE_FLOAT32_C(   474.23), SIMDE_FLOAT32_C(   -34.45) },
+      { SIMDE_FLOAT32_C(   159.89), SIMDE_FLOAT32_C(  -557.48) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-144999.80), SIMDE_FLOAT32_C( 79346.96), SIMDE_FLOAT32_C(-74949.73), SIMDE_FLOAT32_C(  5185.64) } },
+    { { SIMDE_FLOAT32_C(  -344.94), SIMDE_FLOAT32_C(  -125.91), SIMDE_FLOAT32_C(   -56.05), SIMDE_FLOAT32_C(   187.23) },
+      { SIMDE_FLOAT32_C(  -827.15), SIMDE_FLOAT32_C(  -564.96), SIMDE_FLOAT32_C(  -740.95), SIMDE_FLOAT32_C(  -653.22) },
+      { SIMDE_FLOAT32_C(  -120.62), SIMDE_FLOAT32_C(   -93.24) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-77468.41), SIMDE_FLOAT32_C(-52802.78), SIMDE_FLOAT32_C(-69142.23), SIMDE_FLOAT32_C(-60719.00) } },
+    { { SIMDE_FLOAT32_C(   854.16), SIMDE_FLOAT32_C(   551.09), SIMDE_FLOAT32_C(   659.19), SIMDE_FLOAT32_C(  -288.40) },
+      { SIMDE_FLOAT32_C(   514.74), SIMDE_FLOAT32_C(    86.47), SIMDE_FLOAT32_C(   392.46), SIMDE_FLOAT32_C(   591.03) },
+      { SIMDE_FLOAT32_C(   396.65), SIMDE_FLOAT32_C(  -543.42) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(280574.16), SIMDE_FLOAT32_C( 47540.62), SIMDE_FLOAT32_C(213929.80), SIMDE_FLOAT32_C(320889.12) } },
+    { { SIMDE_FLOAT32_C(   158.55), SIMDE_FLOAT32_C(  -920.62), SIMDE_FLOAT32_C(   111.17), SIMDE_FLOAT32_C(  -399.78) },
+      { SIMDE_FLOAT32_C(  -439.53), SIMDE_FLOAT32_C(  -617.19), SIMDE_FLOAT32_C(   553.44), SIMDE_FLOAT32_C(  -493.22) },
+      { SIMDE_FLOAT32_C(  -287.94), SIMDE_FLOAT32_C(  -211.83) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-92947.09), SIMDE_FLOAT32_C(-131659.98), SIMDE_FLOAT32_C(117346.37), SIMDE_FLOAT32_C(-104878.57) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x2_t v = simde_vld1_f32(test_vec[i].v);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmsq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x2_t v = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmsq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 v[4];
+    int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   388.88), SIMDE_FLOAT32_C(   652.60), SIMDE_FLOAT32_C(   116.12), SIMDE_FLOAT32_C(   473.67) },
+      { SIMDE_FLOAT32_C(   748.74), SIMDE_FLOAT32_C(     0.20), SIMDE_FLOAT32_C(    17.20), SIMDE_FLOAT32_C(  -189.33) },
+      { SIMDE_FLOAT32_C(   689.93), SIMDE_FLOAT32_C(   496.37), SIMDE_FLOAT32_C(   668.29), SIMDE_FLOAT32_C(   623.22) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(-516189.28), SIMDE_FLOAT32_C(   514.61), SIMDE_FLOAT32_C(-11750.68), SIMDE_FLOAT32_C(131098.11) } },
+    { { SIMDE_FLOAT32_C(  -812.83), SIMDE_FLOAT32_C(  -764.52), SIMDE_FLOAT32_C(  -828.74), SIMDE_FLOAT32_C(   320.71) },
+      { SIMDE_FLOAT32_C(  -284.66), SIMDE_FLOAT32_C(  -871.80), SIMDE_FLOAT32_C(   869.55), SIMDE_FLOAT32_C(   955.06) },
+      { SIMDE_FLOAT32_C(   742.88), SIMDE_FLOAT32_C(  -812.86), SIMDE_FLOAT32_C(  -752.65), SIMDE_FLOAT32_C(  -150.46) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(-43642.78), SIMDE_FLOAT32_C(-131935.55), SIMDE_FLOAT32_C(130003.76), SIMDE_FLOAT32_C(144019.05) } },
+    { { SIMDE_FLOAT32_C(   410.96), SIMDE_FLOAT32_C(  -835.34), SIMDE_FLOAT32_C(  -648.40), SIMDE_FLOAT32_C(  -439.76) },
+      { SIMDE_FLOAT32_C(   427.34), SIMDE_FLOAT32_C(   826.35), SIMDE_FLOAT32_C(   -95.44), SIMDE_FLOAT32_C(  -742.81) },
+      { SIMDE_FLOAT32_C(  -850.01), SIMDE_FLOAT32_C(   594.68), SIMDE_FLOAT32_C(   233.54), SIMDE_FLOAT32_C(  -649.27) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-253719.58), SIMDE_FLOAT32_C(-492249.12), SIMDE_FLOAT32_C( 56107.86), SIMDE_FLOAT32_C(441294.47) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(  -589.71), SIMDE_FLOAT32_C(   217.68), SIMDE_FLOAT32_C(   296.21) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(   940.45), SIMDE_FLOAT32_C(  -705.75), SIMDE_FLOAT32_C(   102.00) },
+      { SIMDE_FLOAT32_C(  -214.65), SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -650.24), SIMDE_FLOAT32_C(   871.62) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(-3853613.50), SIMDE_FLOAT32_C(2891675.50), SIMDE_FLOAT32_C(-417597.78) } },
+    { { SIMDE_FLOAT32_C(   145.12), SIMDE_FLOAT32_C(  -750.95), SIMDE_FLOAT32_C(   708.07), SIMDE_FLOAT32_C(  -436.84) },
+      { SIMDE_FLOAT32_C(    35.22), SIMDE_FLOAT32_C(  -573.70), SIMDE_FLOAT32_C(  -926.76), SIMDE_FLOAT32_C(   287.46) },
+      { SIMDE_FLOAT32_C(  -893.85), SIMDE_FLOAT32_C(  -201.55), SIMDE_FLOAT32_C(  -362.36), SIMDE_FLOAT32_C(   -50.29) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(  7243.71), SIMDE_FLOAT32_C(-116380.19), SIMDE_FLOAT32_C(-186080.41), SIMDE_FLOAT32_C( 57500.72) } },
+    { { SIMDE_FLOAT32_C(   448.48), SIMDE_FLOAT32_C(    94.67), SIMDE_FLOAT32_C(   673.31), SIMDE_FLOAT32_C(  -258.65) },
+      { SIMDE_FLOAT32_C(   529.52), SIMDE_FLOAT32_C(  -109.86), SIMDE_FLOAT32_C(  -583.34), SIMDE_FLOAT32_C(  -657.84) },
+      { SIMDE_FLOAT32_C(   167.71), SIMDE_FLOAT32_C(   656.76), SIMDE_FLOAT32_C(   614.05), SIMDE_FLOAT32_C(  -347.18) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(-324703.28), SIMDE_FLOAT32_C( 67554.20), SIMDE_FLOAT32_C(358873.25), SIMDE_FLOAT32_C(403688.00) } },
+    { { SIMDE_FLOAT32_C(   -37.64), SIMDE_FLOAT32_C(    42.26), SIMDE_FLOAT32_C(   824.62), SIMDE_FLOAT32_C(  -516.46) },
+      { SIMDE_FLOAT32_C(   456.01), SIMDE_FLOAT32_C(  -603.13), SIMDE_FLOAT32_C(   421.79), SIMDE_FLOAT32_C(  -911.63) },
+      { SIMDE_FLOAT32_C(    54.48), SIMDE_FLOAT32_C(    73.76), SIMDE_FLOAT32_C(  -186.91), SIMDE_FLOAT32_C(  -154.28) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(-33672.94), SIMDE_FLOAT32_C( 44529.13), SIMDE_FLOAT32_C(-30286.61), SIMDE_FLOAT32_C( 66725.37) } },
+    { { SIMDE_FLOAT32_C(  -705.15), SIMDE_FLOAT32_C(  -939.94), SIMDE_FLOAT32_C(   965.50), SIMDE_FLOAT32_C(   694.68) },
+      { SIMDE_FLOAT32_C(   297.11), SIMDE_FLOAT32_C(   189.74), SIMDE_FLOAT32_C(  -545.24), SIMDE_FLOAT32_C(   321.22) },
+      { SIMDE_FLOAT32_C(   247.36), SIMDE_FLOAT32_C(   970.92), SIMDE_FLOAT32_C(    86.07), SIMDE_FLOAT32_C(   185.01) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(-26277.41), SIMDE_FLOAT32_C(-17270.86), SIMDE_FLOAT32_C( 47894.30), SIMDE_FLOAT32_C(-26952.72) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t v = simde_vld1q_f32(test_vec[i].v);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vfmsq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t v = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 3;
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vfmsq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 v[1];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   220.44), SIMDE_FLOAT64_C(  -115.76) },
+      { SIMDE_FLOAT64_C(    -4.68), SIMDE_FLOAT64_C(  -787.80) },
+      { SIMDE_FLOAT64_C(   704.58) },
+      { SIMDE_FLOAT64_C(  3517.87), SIMDE_FLOAT64_C(554952.36) } },
+    { { SIMDE_FLOAT64_C(  -887.59), SIMDE_FLOAT64_C(   289.62) },
+      { SIMDE_FLOAT64_C(   643.74), SIMDE_FLOAT64_C(  -682.57) },
+      { SIMDE_FLOAT64_C(  -613.37) },
+      { SIMDE_FLOAT64_C(393963.21), SIMDE_FLOAT64_C(-418378.34) } },
+    { { SIMDE_FLOAT64_C(  -550.82), SIMDE_FLOAT64_C(   -55.83) },
+      { SIMDE_FLOAT64_C(   408.46), SIMDE_FLOAT64_C(   641.58) },
+      { SIMDE_FLOAT64_C(  -370.07) },
+      { SIMDE_FLOAT64_C(150607.97), SIMDE_FLOAT64_C(237373.68) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00), SIMDE_FLOAT64_C(   603.74) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   635.20) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(-85255100857.06) } },
+    { { SIMDE_FLOAT64_C(  -656.50), SIMDE_FLOAT64_C(    18.86) },
+      { SIMDE_FLOAT64_C(   402.05), SIMDE_FLOAT64_C(   731.28) },
+      { SIMDE_FLOAT64_C(   276.85) },
+      { SIMDE_FLOAT64_C(-111964.04), SIMDE_FLOAT64_C(-202436.01) } },
+    { { SIMDE_FLOAT64_C(    28.01), SIMDE_FLOAT64_C(  -802.11) },
+      { SIMDE_FLOAT64_C(  -409.94), SIMDE_FLOAT64_C(  -305.63) },
+      { SIMDE_FLOAT64_C(  -360.72) },
+      { SIMDE_FLOAT64_C(-147845.55), SIMDE_FLOAT64_C(-111048.96) } },
+    { { SIMDE_FLOAT64_C(  -420.28), SIMDE_FLOAT64_C(   605.71) },
+      { SIMDE_FLOAT64_C(   445.19), SIMDE_FLOAT64_C(  -233.73) },
+      { SIMDE_FLOAT64_C(  -351.65) },
+      { SIMDE_FLOAT64_C(156130.78), SIMDE_FLOAT64_C(-81585.44) } },
+    { { SIMDE_FLOAT64_C(   595.30), SIMDE_FLOAT64_C(  -866.23) },
+      { SIMDE_FLOAT64_C(   363.90), SIMDE_FLOAT64_C(  -262.49) },
+      { SIMDE_FLOAT64_C(  -124.89) },
+      { SIMDE_FLOAT64_C( 46042.77), SIMDE_FLOAT64_C(-33648.61) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x1_t v = simde_vld1_f64(test_vec[i].v);
+    simde_float64x2_t r = simde_vfmsq_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x1_t v = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vfmsq_lane_f64(a, b, v, 0);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 v[2];
+    int lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -680.89), SIMDE_FLOAT64_C(  -872.14) },
+      { SIMDE_FLOAT64_C(  -182.12), SIMDE_FLOAT64_C(   611.25) },
+      { SIMDE_FLOAT64_C(   297.17), SIMDE_FLOAT64_C(  -435.00) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( 53439.71), SIMDE_FLOAT64_C(-182517.30) } },
+    { { SIMDE_FLOAT64_C(  -651.16), SIMDE_FLOAT64_C(  -406.30) },
+      { SIMDE_FLOAT64_C(  -461.72), SIMDE_FLOAT64_C(  -358.04) },
+      { SIMDE_FLOAT64_C(   850.10), SIMDE_FLOAT64_C(    23.96) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(391857.01), SIMDE_FLOAT64_C(303963.50) } },
+    { { SIMDE_FLOAT64_C(  -495.43), SIMDE_FLOAT64_C(  -540.10) },
+      { SIMDE_FLOAT64_C(  -556.06), SIMDE_FLOAT64_C(  -795.28) },
+      { SIMDE_FLOAT64_C(   125.57), SIMDE_FLOAT64_C(  -288.59) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(-160968.79), SIMDE_FLOAT64_C(-230049.96) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00), SIMDE_FLOAT64_C(   169.33) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(  -311.58) },
+      { SIMDE_FLOAT64_C(   417.35), SIMDE_FLOAT64_C(134217729.00) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(41819560171.15) } },
+    { { SIMDE_FLOAT64_C(   277.79), SIMDE_FLOAT64_C(   152.53) },
+      { SIMDE_FLOAT64_C(   350.94), SIMDE_FLOAT64_C(   474.81) },
+      { SIMDE_FLOAT64_C(   131.55), SIMDE_FLOAT64_C(  -525.05) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(184538.84), SIMDE_FLOAT64_C(249451.52) } },
+    { { SIMDE_FLOAT64_C(   -65.57), SIMDE_FLOAT64_C(  -302.08) },
+      { SIMDE_FLOAT64_C(   751.70), SIMDE_FLOAT64_C(    -4.45) },
+      { SIMDE_FLOAT64_C(  -221.86), SIMDE_FLOAT64_C(   631.83) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(166706.59), SIMDE_FLOAT64_C( -1289.36) } },
+    { { SIMDE_FLOAT64_C(   612.04), SIMDE_FLOAT64_C(   207.26) },
+      { SIMDE_FLOAT64_C(  -117.23), SIMDE_FLOAT64_C(  -793.46) },
+      { SIMDE_FLOAT64_C(  -165.43), SIMDE_FLOAT64_C(   784.23) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( 92547.32), SIMDE_FLOAT64_C(622462.40) } },
+    { { SIMDE_FLOAT64_C(  -346.24), SIMDE_FLOAT64_C(  -893.77) },
+      { SIMDE_FLOAT64_C(  -165.03), SIMDE_FLOAT64_C(  -479.52) },
+      { SIMDE_FLOAT64_C(   794.84), SIMDE_FLOAT64_C(  -763.68) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(-126376.35), SIMDE_FLOAT64_C(-367093.60) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t v = simde_vld1q_f64(test_vec[i].v);
+
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmsq_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, v);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t v = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmsq_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f64(SIMDE_FLOAT64_C(0.0))), lane, a, b, v);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmss_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 b;
+    simde_float32 v[2];
+    int lane;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(   272.17),
+      SIMDE_FLOAT32_C(  -607.78),
+      { SIMDE_FLOAT32_C(   687.58), SIMDE_FLOAT32_C(    85.47) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C( 52219.13) },
+    { SIMDE_FLOAT32_C(   205.73),
+      SIMDE_FLOAT32_C(   404.46),
+      { SIMDE_FLOAT32_C(   772.27), SIMDE_FLOAT32_C(   610.91) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(-246882.91) },
+    { SIMDE_FLOAT32_C(   463.21),
+      SIMDE_FLOAT32_C(   640.92),
+      { SIMDE_FLOAT32_C(  -272.68), SIMDE_FLOAT32_C(   639.46) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(-409379.50) },
+    { SIMDE_FLOAT32_C(16785408.00),
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(  -862.04), SIMDE_FLOAT32_C(  4097.00) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(    -1.00) },
+    { SIMDE_FLOAT32_C(   208.04),
+      SIMDE_FLOAT32_C(  -305.60),
+      { SIMDE_FLOAT32_C(  -960.36), SIMDE_FLOAT32_C(  -260.46) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(-293277.97) },
+    { SIMDE_FLOAT32_C(  -394.29),
+      SIMDE_FLOAT32_C(  -769.38),
+      { SIMDE_FLOAT32_C(  -564.10), SIMDE_FLOAT32_C(   718.23) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(-434401.53) },
+    { SIMDE_FLOAT32_C(  -674.56),
+      SIMDE_FLOAT32_C(   671.53),
+      { SIMDE_FLOAT32_C(   744.41), SIMDE_FLOAT32_C(  -164.89) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(-500568.22) },
+    { SIMDE_FLOAT32_C(  -852.23),
+      SIMDE_FLOAT32_C(  -246.76),
+      { SIMDE_FLOAT32_C(  -269.63), SIMDE_FLOAT32_C(   388.17) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(-67386.12) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t v = simde_vld1_f32(test_vec[i].v);
+    simde_float32 r;
+    SIMDE_CONSTIFY_2_(simde_vfmss_lane_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), test_vec[i].lane, test_vec[i].a, test_vec[i].b, v);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 b = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x2_t v = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float32 r;
+    SIMDE_CONSTIFY_2_(simde_vfmss_lane_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), lane, a, b, v);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmss_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 b;
+    simde_float32 v[4];
+    int lane;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(   536.78),
+      SIMDE_FLOAT32_C(   648.76),
+      { SIMDE_FLOAT32_C(   491.76), SIMDE_FLOAT32_C(   314.56), SIMDE_FLOAT32_C(   926.57), SIMDE_FLOAT32_C(  -407.65) },
+       INT8_C(   2),
+      SIMDE_FLOAT32_C(-600584.81) },
+    { SIMDE_FLOAT32_C(  -265.35),
+      SIMDE_FLOAT32_C(  -917.04),
+      { SIMDE_FLOAT32_C(  -439.71), SIMDE_FLOAT32_C(  -243.56), SIMDE_FLOAT32_C(   -14.66), SIMDE_FLOAT32_C(   745.02) },
+       INT8_C(   3),
+      SIMDE_FLOAT32_C(682947.81) },
+    { SIMDE_FLOAT32_C(   203.64),
+      SIMDE_FLOAT32_C(  -205.57),
+      { SIMDE_FLOAT32_C(  -490.67), SIMDE_FLOAT32_C(  -918.76), SIMDE_FLOAT32_C(  -989.19), SIMDE_FLOAT32_C(  -392.56) },
+       INT8_C(   3),
+      SIMDE_FLOAT32_C(-80494.92) },
+    { SIMDE_FLOAT32_C(16785408.00),
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(  -803.63), SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -847.59), SIMDE_FLOAT32_C(  -161.92) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(    -1.00) },
+    { SIMDE_FLOAT32_C(   585.83),
+      SIMDE_FLOAT32_C(  -973.11),
+      { SIMDE_FLOAT32_C(  -427.10), SIMDE_FLOAT32_C(  -668.94), SIMDE_FLOAT32_C(  -786.18), SIMDE_FLOAT32_C(   374.42) },
+       INT8_C(   0),
+      SIMDE_FLOAT32_C(-415029.44) },
+    { SIMDE_FLOAT32_C(   862.69),
+      SIMDE_FLOAT32_C(  -522.81),
+      { SIMDE_FLOAT32_C(  -266.15), SIMDE_FLOAT32_C(   491.41), SIMDE_FLOAT32_C(   161.37), SIMDE_FLOAT32_C(   944.03) },
+       INT8_C(   1),
+      SIMDE_FLOAT32_C(257776.75) },
+    { SIMDE_FLOAT32_C(   159.51),
+      SIMDE_FLOAT32_C(   894.59),
+      { SIMDE_FLOAT32_C(   926.60), SIMDE_FLOAT32_C(   743.15), SIMDE_FLOAT32_C(    14.88), SIMDE_FLOAT32_C(   214.39) },
+       INT8_C(   3),
+      SIMDE_FLOAT32_C(-191631.64) },
+    { SIMDE_FLOAT32_C(  -138.39),
+      SIMDE_FLOAT32_C(  -488.85),
+      { SIMDE_FLOAT32_C(   732.28), SIMDE_FLOAT32_C(  -323.92), SIMDE_FLOAT32_C(   757.77), SIMDE_FLOAT32_C(   244.20) },
+       INT8_C(   2),
+      SIMDE_FLOAT32_C(370297.50) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t v = simde_vld1q_f32(test_vec[i].v);
+    simde_float32 r;
+    SIMDE_CONSTIFY_4_(simde_vfmss_laneq_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), test_vec[i].lane, test_vec[i].a, test_vec[i].b, v);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 b = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x4_t v = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    int lane = simde_test_codegen_random_i8() & 3;
+
+    simde_float32 r;
+    SIMDE_CONSTIFY_4_(simde_vfmss_laneq_f32, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT32_C(0.0)), lane, a, b, v);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsd_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 b;
+    simde_float64 v[1];
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   260.58),
+      SIMDE_FLOAT64_C(  -805.82),
+      { SIMDE_FLOAT64_C(  -669.95) },
+      SIMDE_FLOAT64_C(-539598.53) },
+    { SIMDE_FLOAT64_C(  -343.72),
+      SIMDE_FLOAT64_C(  -956.10),
+      { SIMDE_FLOAT64_C(   791.54) },
+      SIMDE_FLOAT64_C(756447.67) },
+    { SIMDE_FLOAT64_C(  -285.01),
+      SIMDE_FLOAT64_C(  -486.47),
+      { SIMDE_FLOAT64_C(  -150.91) },
+      SIMDE_FLOAT64_C(-73698.20) },
+    { SIMDE_FLOAT64_C(18014398777917440.00),
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(134217729.00) },
+      SIMDE_FLOAT64_C(    -1.00) },
+    { SIMDE_FLOAT64_C(   612.64),
+      SIMDE_FLOAT64_C(   432.85),
+      { SIMDE_FLOAT64_C(   691.55) },
+      SIMDE_FLOAT64_C(-298724.78) },
+    { SIMDE_FLOAT64_C(   715.03),
+      SIMDE_FLOAT64_C(   215.56),
+      { SIMDE_FLOAT64_C(  -889.32) },
+      SIMDE_FLOAT64_C(192416.85) },
+    { SIMDE_FLOAT64_C(   143.83),
+      SIMDE_FLOAT64_C(   730.22),
+      { SIMDE_FLOAT64_C(    56.43) },
+      SIMDE_FLOAT64_C(-41062.48) },
+    { SIMDE_FLOAT64_C(  -577.06),
+      SIMDE_FLOAT64_C(  -754.03),
+      { SIMDE_FLOAT64_C(  -940.66) },
+      SIMDE_FLOAT64_C(-709862.92) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t v = simde_vld1_f64(test_vec[i].v);
+    simde_float64 r = simde_vfmsd_lane_f64(test_vec[i].a, test_vec[i].b, v, 0);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 b = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x1_t v = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64 r = simde_vfmsd_lane_f64(a, b, v, 0);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsd_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 b;
+    simde_float64 v[2];
+    int lane;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   226.90),
+      SIMDE_FLOAT64_C(   751.91),
+      { SIMDE_FLOAT64_C(   202.02), SIMDE_FLOAT64_C(   947.79) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(-151673.96) },
+    { SIMDE_FLOAT64_C(  -715.02),
+      SIMDE_FLOAT64_C(   482.14),
+      { SIMDE_FLOAT64_C(   242.19), SIMDE_FLOAT64_C(    -7.86) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(  3074.60) },
+    { SIMDE_FLOAT64_C(  -357.27),
+      SIMDE_FLOAT64_C(   487.78),
+      { SIMDE_FLOAT64_C(    84.69), SIMDE_FLOAT64_C(   179.28) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(-87806.47) },
+    { SIMDE_FLOAT64_C(18014398777917440.00),
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(  -806.67) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(    -1.00) },
+    { SIMDE_FLOAT64_C(   287.84),
+      SIMDE_FLOAT64_C(  -304.92),
+      { SIMDE_FLOAT64_C(   373.16), SIMDE_FLOAT64_C(   977.21) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(298258.71) },
+    { SIMDE_FLOAT64_C(  -306.65),
+      SIMDE_FLOAT64_C(     0.37),
+      { SIMDE_FLOAT64_C(   961.69), SIMDE_FLOAT64_C(   -33.08) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(  -294.41) },
+    { SIMDE_FLOAT64_C(  -208.67),
+      SIMDE_FLOAT64_C(   292.72),
+      { SIMDE_FLOAT64_C(  -738.54), SIMDE_FLOAT64_C(   790.00) },
+       INT8_C(   0),
+      SIMDE_FLOAT64_C(215976.76) },
+    { SIMDE_FLOAT64_C(  -553.34),
+      SIMDE_FLOAT64_C(   745.21),
+      { SIMDE_FLOAT64_C(   499.06), SIMDE_FLOAT64_C(   458.61) },
+       INT8_C(   1),
+      SIMDE_FLOAT64_C(-342314.10) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t v = simde_vld1q_f64(test_vec[i].v);
+    simde_float64 r;
+    SIMDE_CONSTIFY_2_(simde_vfmsd_laneq_f64, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT64_C(0.0)), test_vec[i].lane, test_vec[i].a, test_vec[i].b, v);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 b = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x2_t v = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    int lane = simde_test_codegen_random_i8() & 1;
+
+    simde_float64 r;
+    SIMDE_CONSTIFY_2_(simde_vfmsd_laneq_f64, r, (HEDLEY_UNREACHABLE(), SIMDE_FLOAT64_C(0.0)), lane, a, b, v);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, v, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, HEDLEY_STATIC_CAST(int8_t, lane), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_laneq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_laneq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmss_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmss_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsd_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsd_laneq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
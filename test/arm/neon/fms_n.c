@@ -0,0 +1,289 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms_n.h"
+
+static int
+test_simde_vfms_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 n;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -509.06), SIMDE_FLOAT32_C(  -812.81) },
+      { SIMDE_FLOAT32_C(  -438.65), SIMDE_FLOAT32_C(   643.39) },
+      SIMDE_FLOAT32_C(  -537.27),
+      { SIMDE_FLOAT32_C(-236182.55), SIMDE_FLOAT32_C(344861.34) } },
+    { { SIMDE_FLOAT32_C(   526.16), SIMDE_FLOAT32_C(  -290.39) },
+      { SIMDE_FLOAT32_C(   -97.13), SIMDE_FLOAT32_C(   406.24) },
+      SIMDE_FLOAT32_C(  -869.92),
+      { SIMDE_FLOAT32_C(-83969.16), SIMDE_FLOAT32_C(353105.91) } },
+    { { SIMDE_FLOAT32_C(   717.01), SIMDE_FLOAT32_C(   255.49) },
+      { SIMDE_FLOAT32_C(  -485.36), SIMDE_FLOAT32_C(  -640.72) },
+      SIMDE_FLOAT32_C(    -9.95),
+      { SIMDE_FLOAT32_C( -4112.32), SIMDE_FLOAT32_C( -6119.67) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(   848.22) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -303.07) },
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(1242526.00) } },
+    { { SIMDE_FLOAT32_C(  -455.51), SIMDE_FLOAT32_C(   508.07) },
+      { SIMDE_FLOAT32_C(   229.24), SIMDE_FLOAT32_C(   388.14) },
+      SIMDE_FLOAT32_C(   316.03),
+      { SIMDE_FLOAT32_C(-72902.23), SIMDE_FLOAT32_C(-122155.82) } },
+    { { SIMDE_FLOAT32_C(  -782.36), SIMDE_FLOAT32_C(   977.61) },
+      { SIMDE_FLOAT32_C(   584.48), SIMDE_FLOAT32_C(   720.78) },
+      SIMDE_FLOAT32_C(   377.83),
+      { SIMDE_FLOAT32_C(-221616.42), SIMDE_FLOAT32_C(-271354.69) } },
+    { { SIMDE_FLOAT32_C(   796.00), SIMDE_FLOAT32_C(    41.21) },
+      { SIMDE_FLOAT32_C(  -816.69), SIMDE_FLOAT32_C(  -412.13) },
+      SIMDE_FLOAT32_C(  -460.74),
+      { SIMDE_FLOAT32_C(-375485.75), SIMDE_FLOAT32_C(-189843.56) } },
+    { { SIMDE_FLOAT32_C(   959.19), SIMDE_FLOAT32_C(  -577.55) },
+      { SIMDE_FLOAT32_C(  -921.48), SIMDE_FLOAT32_C(   781.75) },
+      SIMDE_FLOAT32_C(   609.59),
+      { SIMDE_FLOAT32_C(562684.19), SIMDE_FLOAT32_C(-477124.56) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vfms_n_f32(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32 n = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vfms_n_f32(a, b, n);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfms_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 n;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   193.50) },
+      { SIMDE_FLOAT64_C(  -237.45) },
+      SIMDE_FLOAT64_C(  -634.27),
+      { SIMDE_FLOAT64_C(-150413.91) } },
+    { { SIMDE_FLOAT64_C(    41.82) },
+      { SIMDE_FLOAT64_C(   536.34) },
+      SIMDE_FLOAT64_C(   644.39),
+      { SIMDE_FLOAT64_C(-345570.31) } },
+    { { SIMDE_FLOAT64_C(  -855.55) },
+      { SIMDE_FLOAT64_C(    17.43) },
+      SIMDE_FLOAT64_C(  -947.01),
+      { SIMDE_FLOAT64_C( 15650.83) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00) },
+      { SIMDE_FLOAT64_C(134217729.00) },
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(    -1.00) } },
+    { { SIMDE_FLOAT64_C(   923.81) },
+      { SIMDE_FLOAT64_C(  -628.97) },
+      SIMDE_FLOAT64_C(   271.55),
+      { SIMDE_FLOAT64_C(171720.61) } },
+    { { SIMDE_FLOAT64_C(  -287.10) },
+      { SIMDE_FLOAT64_C(  -874.50) },
+      SIMDE_FLOAT64_C(   307.09),
+      { SIMDE_FLOAT64_C(268263.10) } },
+    { { SIMDE_FLOAT64_C(   541.79) },
+      { SIMDE_FLOAT64_C(  -675.30) },
+      SIMDE_FLOAT64_C(   844.22),
+      { SIMDE_FLOAT64_C(570643.56) } },
+    { { SIMDE_FLOAT64_C(    -8.08) },
+      { SIMDE_FLOAT64_C(  -943.59) },
+      SIMDE_FLOAT64_C(  -648.85),
+      { SIMDE_FLOAT64_C(-612256.45) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vfms_n_f64(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64 n = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vfms_n_f64(a, b, n);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 n;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -978.50), SIMDE_FLOAT32_C(   910.80), SIMDE_FLOAT32_C(  -239.67), SIMDE_FLOAT32_C(  -608.70) },
+      { SIMDE_FLOAT32_C(  -968.56), SIMDE_FLOAT32_C(   176.01), SIMDE_FLOAT32_C(  -607.46), SIMDE_FLOAT32_C(  -258.00) },
+      SIMDE_FLOAT32_C(   -79.59),
+      { SIMDE_FLOAT32_C(-78066.19), SIMDE_FLOAT32_C( 14919.43), SIMDE_FLOAT32_C(-48587.41), SIMDE_FLOAT32_C(-21142.92) } },
+    { { SIMDE_FLOAT32_C(  -512.57), SIMDE_FLOAT32_C(   335.27), SIMDE_FLOAT32_C(    87.66), SIMDE_FLOAT32_C(  -333.11) },
+      { SIMDE_FLOAT32_C(   940.21), SIMDE_FLOAT32_C(   -28.88), SIMDE_FLOAT32_C(   280.81), SIMDE_FLOAT32_C(  -762.76) },
+      SIMDE_FLOAT32_C(  -227.29),
+      { SIMDE_FLOAT32_C(213187.77), SIMDE_FLOAT32_C( -6228.86), SIMDE_FLOAT32_C( 63912.96), SIMDE_FLOAT32_C(-173700.83) } },
+    { { SIMDE_FLOAT32_C(   866.83), SIMDE_FLOAT32_C(   980.55), SIMDE_FLOAT32_C(  -563.08), SIMDE_FLOAT32_C(   835.32) },
+      { SIMDE_FLOAT32_C(  -288.13), SIMDE_FLOAT32_C(   417.53), SIMDE_FLOAT32_C(  -115.34), SIMDE_FLOAT32_C(   637.56) },
+      SIMDE_FLOAT32_C(   134.58),
+      { SIMDE_FLOAT32_C( 39643.37), SIMDE_FLOAT32_C(-55210.64), SIMDE_FLOAT32_C( 14959.38), SIMDE_FLOAT32_C(-84967.51) } },
+    { { SIMDE_FLOAT32_C(16785408.00), SIMDE_FLOAT32_C(   820.64), SIMDE_FLOAT32_C(  -471.64), SIMDE_FLOAT32_C(   522.97) },
+      { SIMDE_FLOAT32_C(  4097.00), SIMDE_FLOAT32_C(  -147.19), SIMDE_FLOAT32_C(  -847.61), SIMDE_FLOAT32_C(   995.69) },
+      SIMDE_FLOAT32_C(  4097.00),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(603858.06), SIMDE_FLOAT32_C(3472186.50), SIMDE_FLOAT32_C(-4078819.00) } },
+    { { SIMDE_FLOAT32_C(   226.94), SIMDE_FLOAT32_C(   250.23), SIMDE_FLOAT32_C(   525.55), SIMDE_FLOAT32_C(   240.38) },
+      { SIMDE_FLOAT32_C(   587.07), SIMDE_FLOAT32_C(   169.88), SIMDE_FLOAT32_C(  -728.86), SIMDE_FLOAT32_C(  -574.04) },
+      SIMDE_FLOAT32_C(  -274.17),
+      { SIMDE_FLOAT32_C(161183.94), SIMDE_FLOAT32_C( 46826.23), SIMDE_FLOAT32_C(-199306.00), SIMDE_FLOAT32_C(-157144.17) } },
+    { { SIMDE_FLOAT32_C(   291.92), SIMDE_FLOAT32_C(   301.10), SIMDE_FLOAT32_C(  -302.46), SIMDE_FLOAT32_C(  -932.65) },
+      { SIMDE_FLOAT32_C(   174.48), SIMDE_FLOAT32_C(  -540.79), SIMDE_FLOAT32_C(   606.26), SIMDE_FLOAT32_C(   551.56) },
+      SIMDE_FLOAT32_C(  -436.32),
+      { SIMDE_FLOAT32_C( 76421.03), SIMDE_FLOAT32_C(-235656.39), SIMDE_FLOAT32_C(264220.91), SIMDE_FLOAT32_C(239724.02) } },
+    { { SIMDE_FLOAT32_C(   804.05), SIMDE_FLOAT32_C(   289.17), SIMDE_FLOAT32_C(   537.47), SIMDE_FLOAT32_C(  -241.10) },
+      { SIMDE_FLOAT32_C(  -448.86), SIMDE_FLOAT32_C(   926.64), SIMDE_FLOAT32_C(  -466.05), SIMDE_FLOAT32_C(   297.19) },
+      SIMDE_FLOAT32_C(  -126.54),
+      { SIMDE_FLOAT32_C(-55994.69), SIMDE_FLOAT32_C(117546.20), SIMDE_FLOAT32_C(-58436.50), SIMDE_FLOAT32_C( 37365.32) } },
+    { { SIMDE_FLOAT32_C(   423.24), SIMDE_FLOAT32_C(   459.03), SIMDE_FLOAT32_C(   922.29), SIMDE_FLOAT32_C(  -872.22) },
+      { SIMDE_FLOAT32_C(   304.12), SIMDE_FLOAT32_C(   253.67), SIMDE_FLOAT32_C(  -212.81), SIMDE_FLOAT32_C(   495.75) },
+      SIMDE_FLOAT32_C(  -491.62),
+      { SIMDE_FLOAT32_C(149934.70), SIMDE_FLOAT32_C(125168.27), SIMDE_FLOAT32_C(-103699.36), SIMDE_FLOAT32_C(242848.39) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vfmsq_n_f32(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32 n = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vfmsq_n_f32(a, b, n);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vfmsq_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 n;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   879.24), SIMDE_FLOAT64_C(   -51.71) },
+      { SIMDE_FLOAT64_C(  -401.09), SIMDE_FLOAT64_C(   220.69) },
+      SIMDE_FLOAT64_C(  -544.97),
+      { SIMDE_FLOAT64_C(-217702.78), SIMDE_FLOAT64_C(120217.72) } },
+    { { SIMDE_FLOAT64_C(   -54.10), SIMDE_FLOAT64_C(   503.50) },
+      { SIMDE_FLOAT64_C(   781.31), SIMDE_FLOAT64_C(   410.08) },
+      SIMDE_FLOAT64_C(   396.03),
+      { SIMDE_FLOAT64_C(-309476.30), SIMDE_FLOAT64_C(-161900.48) } },
+    { { SIMDE_FLOAT64_C(   508.95), SIMDE_FLOAT64_C(   140.96) },
+      { SIMDE_FLOAT64_C(  -638.88), SIMDE_FLOAT64_C(   802.83) },
+      SIMDE_FLOAT64_C(  -398.43),
+      { SIMDE_FLOAT64_C(-254040.01), SIMDE_FLOAT64_C(320012.52) } },
+    { { SIMDE_FLOAT64_C(18014398777917440.00), SIMDE_FLOAT64_C(  -800.28) },
+      { SIMDE_FLOAT64_C(134217729.00), SIMDE_FLOAT64_C(   -41.68) },
+      SIMDE_FLOAT64_C(134217729.00),
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(5594194144.44) } },
+    { { SIMDE_FLOAT64_C(   361.01), SIMDE_FLOAT64_C(  -958.76) },
+      { SIMDE_FLOAT64_C(   200.30), SIMDE_FLOAT64_C(  -581.46) },
+      SIMDE_FLOAT64_C(  -537.53),
+      { SIMDE_FLOAT64_C(108028.27), SIMDE_FLOAT64_C(-313510.95) } },
+    { { SIMDE_FLOAT64_C(  -242.29), SIMDE_FLOAT64_C(   542.14) },
+      { SIMDE_FLOAT64_C(  -623.77), SIMDE_FLOAT64_C(   233.83) },
+      SIMDE_FLOAT64_C(  -543.69),
+      { SIMDE_FLOAT64_C(-339379.80), SIMDE_FLOAT64_C(127673.17) } },
+    { { SIMDE_FLOAT64_C(  -583.09), SIMDE_FLOAT64_C(  -238.39) },
+      { SIMDE_FLOAT64_C(   622.48), SIMDE_FLOAT64_C(  -669.50) },
+      SIMDE_FLOAT64_C(  -313.72),
+      { SIMDE_FLOAT64_C(194701.34), SIMDE_FLOAT64_C(-210273.93) } },
+    { { SIMDE_FLOAT64_C(   944.96), SIMDE_FLOAT64_C(  -287.71) },
+      { SIMDE_FLOAT64_C(    10.98), SIMDE_FLOAT64_C(  -589.29) },
+      SIMDE_FLOAT64_C(  -759.48),
+      { SIMDE_FLOAT64_C(  9284.05), SIMDE_FLOAT64_C(-447841.68) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vfmsq_n_f64(a, b, test_vec[i].n);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64 n = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vfmsq_n_f64(a, b, n);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, n, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_n_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_n_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,926 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld1_dup
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld1_dup.h"
+
+static int
+test_simde_vld1_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(  -654.80),
+      { SIMDE_FLOAT32_C(  -654.80), SIMDE_FLOAT32_C(  -654.80) } },
+    { SIMDE_FLOAT32_C(  -868.31),
+      { SIMDE_FLOAT32_C(  -868.31), SIMDE_FLOAT32_C(  -868.31) } },
+    { SIMDE_FLOAT32_C(  -739.74),
+      { SIMDE_FLOAT32_C(  -739.74), SIMDE_FLOAT32_C(  -739.74) } },
+    { SIMDE_FLOAT32_C(  -852.43),
+      { SIMDE_FLOAT32_C(  -852.43), SIMDE_FLOAT32_C(  -852.43) } },
+    { SIMDE_FLOAT32_C(  -396.48),
+      { SIMDE_FLOAT32_C(  -396.48), SIMDE_FLOAT32_C(  -396.48) } },
+    { SIMDE_FLOAT32_C(  -138.50),
+      { SIMDE_FLOAT32_C(  -138.50), SIMDE_FLOAT32_C(  -138.50) } },
+    { SIMDE_FLOAT32_C(   809.18),
+      { SIMDE_FLOAT32_C(   809.18), SIMDE_FLOAT32_C(   809.18) } },
+    { SIMDE_FLOAT32_C(   303.81),
+      { SIMDE_FLOAT32_C(   303.81), SIMDE_FLOAT32_C(   303.81) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r = simde_vld1_dup_f32(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vld1_dup_f32(&a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   521.57),
+      { SIMDE_FLOAT64_C(   521.57) } },
+    { SIMDE_FLOAT64_C(  -338.82),
+      { SIMDE_FLOAT64_C(  -338.82) } },
+    { SIMDE_FLOAT64_C(  -356.55),
+      { SIMDE_FLOAT64_C(  -356.55) } },
+    { SIMDE_FLOAT64_C(  -175.98),
+      { SIMDE_FLOAT64_C(  -175.98) } },
+    { SIMDE_FLOAT64_C(  -534.55),
+      { SIMDE_FLOAT64_C(  -534.55) } },
+    { SIMDE_FLOAT64_C(  -960.05),
+      { SIMDE_FLOAT64_C(  -960.05) } },
+    { SIMDE_FLOAT64_C(  -449.22),
+      { SIMDE_FLOAT64_C(  -449.22) } },
+    { SIMDE_FLOAT64_C(   856.88),
+      { SIMDE_FLOAT64_C(   856.88) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t r = simde_vld1_dup_f64(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vld1_dup_f64(&a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a;
+    int8_t r[8];
+  } test_vec[] = {
+    {  INT8_C(  13),
+      {  INT8_C(  13),  INT8_C(  13),  INT8_C(  13),  INT8_C(  13),  INT8_C(  13),  INT8_C(  13),  INT8_C(  13),  INT8_C(  13) } },
+    { -INT8_C(  30),
+      { -INT8_C(  30), -INT8_C(  30), -INT8_C(  30), -INT8_C(  30), -INT8_C(  30), -INT8_C(  30), -INT8_C(  30), -INT8_C(  30) } },
+    { -INT8_C( 127),
+      { -INT8_C( 127), -INT8_C( 127), -INT8_C( 127), -INT8_C( 127), -INT8_C( 127), -INT8_C( 127), -INT8_C( 127), -INT8_C( 127) } },
+    { -INT8_C(  34),
+      { -INT8_C(  34), -INT8_C(  34), -INT8_C(  34), -INT8_C(  34), -INT8_C(  34), -INT8_C(  34), -INT8_C(  34), -INT8_C(  34) } },
+    {  INT8_C(  59),
+      {  INT8_C(  59),  INT8_C(  59),  INT8_C(  59),  INT8_C(  59),  INT8_C(  59),  INT8_C(  59),  INT8_C(  59),  INT8_C(  59) } },
+    {  INT8_C( 126),
+      {  INT8_C( 126),  INT8_C( 126),  INT8_C( 126),  INT8_C( 126),  INT8_C( 126),  INT8_C( 126),  INT8_C( 126),  INT8_C( 126) } },
+    { -INT8_C(  61),
+      { -INT8_C(  61), -INT8_C(  61), -INT8_C(  61), -INT8_C(  61), -INT8_C(  61), -INT8_C(  61), -INT8_C(  61), -INT8_C(  61) } },
+    {  INT8_C(  43),
+      {  INT8_C(  43),  INT8_C(  43),  INT8_C(  43),  INT8_C(  43),  INT8_C(  43),  INT8_C(  43),  INT8_C(  43),  INT8_C(  43) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t r = simde_vld1_dup_s8(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x8(r, simde_vld1_s8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a = simde_test_codegen_random_i8();
+    simde_int8x8_t r = simde_vld1_dup_s8(&a);
+
+    simde_test_codegen_write_i8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a;
+    int16_t r[4];
+  } test_vec[] = {
+    {  INT16_C(  2497),
+      {  INT16_C(  2497),  INT16_C(  2497),  INT16_C(  2497),  INT16_C(  2497) } },
+    { -INT16_C(  9172),
+      { -INT16_C(  9172), -INT16_C(  9172), -INT16_C(  9172), -INT16_C(  9172) } },
+    { -INT16_C( 32095),
+      { -INT16_C( 32095), -INT16_C( 32095), -INT16_C( 32095), -INT16_C( 32095) } },
+    { -INT16_C( 26289),
+      { -INT16_C( 26289), -INT16_C( 26289), -INT16_C( 26289), -INT16_C( 26289) } },
+    { -INT16_C( 18024),
+      { -INT16_C( 18024), -INT16_C( 18024), -INT16_C( 18024), -INT16_C( 18024) } },
+    { -INT16_C( 14113),
+      { -INT16_C( 14113), -INT16_C( 14113), -INT16_C( 14113), -INT16_C( 14113) } },
+    {  INT16_C( 30301),
+      {  INT16_C( 30301),  INT16_C( 30301),  INT16_C( 30301),  INT16_C( 30301) } },
+    {  INT16_C(  7709),
+      {  INT16_C(  7709),  INT16_C(  7709),  INT16_C(  7709),  INT16_C(  7709) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t r = simde_vld1_dup_s16(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x4(r, simde_vld1_s16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a = simde_test_codegen_random_i16();
+    simde_int16x4_t r = simde_vld1_dup_s16(&a);
+
+    simde_test_codegen_write_i16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a;
+    int32_t r[2];
+  } test_vec[] = {
+    {  INT32_C(   616317352),
+      {  INT32_C(   616317352),  INT32_C(   616317352) } },
+    { -INT32_C(  1324285466),
+      { -INT32_C(  1324285466), -INT32_C(  1324285466) } },
+    { -INT32_C(   477174493),
+      { -INT32_C(   477174493), -INT32_C(   477174493) } },
+    {  INT32_C(   714740072),
+      {  INT32_C(   714740072),  INT32_C(   714740072) } },
+    {  INT32_C(    82230147),
+      {  INT32_C(    82230147),  INT32_C(    82230147) } },
+    {  INT32_C(   814794711),
+      {  INT32_C(   814794711),  INT32_C(   814794711) } },
+    { -INT32_C(   314970038),
+      { -INT32_C(   314970038), -INT32_C(   314970038) } },
+    {  INT32_C(  1238770178),
+      {  INT32_C(  1238770178),  INT32_C(  1238770178) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t r = simde_vld1_dup_s32(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a = simde_test_codegen_random_i32();
+    simde_int32x2_t r = simde_vld1_dup_s32(&a);
+
+    simde_test_codegen_write_i32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    int64_t r[1];
+  } test_vec[] = {
+    { -INT64_C( 5734511055884538787),
+      { -INT64_C( 5734511055884538787) } },
+    {  INT64_C( 7605328701991506528),
+      {  INT64_C( 7605328701991506528) } },
+    {  INT64_C( 8157417043819358782),
+      {  INT64_C( 8157417043819358782) } },
+    { -INT64_C( 9108445350445407013),
+      { -INT64_C( 9108445350445407013) } },
+    { -INT64_C( 7828749947896113898),
+      { -INT64_C( 7828749947896113898) } },
+    {  INT64_C( 7612454742447652457),
+      {  INT64_C( 7612454742447652457) } },
+    { -INT64_C( 4440600280056223834),
+      { -INT64_C( 4440600280056223834) } },
+    {  INT64_C( 8993593001842161117),
+      {  INT64_C( 8993593001842161117) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t r = simde_vld1_dup_s64(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    simde_int64x1_t r = simde_vld1_dup_s64(&a);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a;
+    uint8_t r[8];
+  } test_vec[] = {
+    { UINT8_C(218),
+      { UINT8_C(218), UINT8_C(218), UINT8_C(218), UINT8_C(218), UINT8_C(218), UINT8_C(218), UINT8_C(218), UINT8_C(218) } },
+    { UINT8_C( 83),
+      { UINT8_C( 83), UINT8_C( 83), UINT8_C( 83), UINT8_C( 83), UINT8_C( 83), UINT8_C( 83), UINT8_C( 83), UINT8_C( 83) } },
+    { UINT8_C( 78),
+      { UINT8_C( 78), UINT8_C( 78), UINT8_C( 78), UINT8_C( 78), UINT8_C( 78), UINT8_C( 78), UINT8_C( 78), UINT8_C( 78) } },
+    { UINT8_C( 89),
+      { UINT8_C( 89), UINT8_C( 89), UINT8_C( 89), UINT8_C( 89), UINT8_C( 89), UINT8_C( 89), UINT8_C( 89), UINT8_C( 89) } },
+    { UINT8_C(143),
+      { UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143) } },
+    { UINT8_C(101),
+      { UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101) } },
+    { UINT8_C( 17),
+      { UINT8_C( 17), UINT8_C( 17), UINT8_C( 17), UINT8_C( 17), UINT8_C( 17), UINT8_C( 17), UINT8_C( 17), UINT8_C( 17) } },
+    { UINT8_C(249),
+      { UINT8_C(249), UINT8_C(249), UINT8_C(249), UINT8_C(249), UINT8_C(249), UINT8_C(249), UINT8_C(249), UINT8_C(249) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t r = simde_vld1_dup_u8(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x8(r, simde_vld1_u8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a = simde_test_codegen_random_u8();
+    simde_uint8x8_t r = simde_vld1_dup_u8(&a);
+
+    simde_test_codegen_write_u8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a;
+    uint16_t r[4];
+  } test_vec[] = {
+    { UINT16_C( 3841),
+      { UINT16_C( 3841), UINT16_C( 3841), UINT16_C( 3841), UINT16_C( 3841) } },
+    { UINT16_C(17071),
+      { UINT16_C(17071), UINT16_C(17071), UINT16_C(17071), UINT16_C(17071) } },
+    { UINT16_C(58003),
+      { UINT16_C(58003), UINT16_C(58003), UINT16_C(58003), UINT16_C(58003) } },
+    { UINT16_C( 7297),
+      { UINT16_C( 7297), UINT16_C( 7297), UINT16_C( 7297), UINT16_C( 7297) } },
+    { UINT16_C(23373),
+      { UINT16_C(23373), UINT16_C(23373), UINT16_C(23373), UINT16_C(23373) } },
+    { UINT16_C(18400),
+      { UINT16_C(18400), UINT16_C(18400), UINT16_C(18400), UINT16_C(18400) } },
+    { UINT16_C(24544),
+      { UINT16_C(24544), UINT16_C(24544), UINT16_C(24544), UINT16_C(24544) } },
+    { UINT16_C(41719),
+      { UINT16_C(41719), UINT16_C(41719), UINT16_C(41719), UINT16_C(41719) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t r = simde_vld1_dup_u16(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x4(r, simde_vld1_u16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a = simde_test_codegen_random_u16();
+    simde_uint16x4_t r = simde_vld1_dup_u16(&a);
+
+    simde_test_codegen_write_u16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a;
+    uint32_t r[2];
+  } test_vec[] = {
+    { UINT32_C(4233363034),
+      { UINT32_C(4233363034), UINT32_C(4233363034) } },
+    { UINT32_C(  64296521),
+      { UINT32_C(  64296521), UINT32_C(  64296521) } },
+    { UINT32_C(3102919566),
+      { UINT32_C(3102919566), UINT32_C(3102919566) } },
+    { UINT32_C(1355335805),
+      { UINT32_C(1355335805), UINT32_C(1355335805) } },
+    { UINT32_C( 667609672),
+      { UINT32_C( 667609672), UINT32_C( 667609672) } },
+    { UINT32_C(3909476035),
+      { UINT32_C(3909476035), UINT32_C(3909476035) } },
+    { UINT32_C(2332035914),
+      { UINT32_C(2332035914), UINT32_C(2332035914) } },
+    { UINT32_C(3227950042),
+      { UINT32_C(3227950042), UINT32_C(3227950042) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t r = simde_vld1_dup_u32(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    simde_uint32x2_t r = simde_vld1_dup_u32(&a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a;
+    uint64_t r[1];
+  } test_vec[] = {
+    { UINT64_C( 8349280451129176045),
+      { UINT64_C( 8349280451129176045) } },
+    { UINT64_C(13482926827584570781),
+      { UINT64_C(13482926827584570781) } },
+    { UINT64_C( 5908259066266497783),
+      { UINT64_C( 5908259066266497783) } },
+    { UINT64_C( 9537970167608484200),
+      { UINT64_C( 9537970167608484200) } },
+    { UINT64_C( 5483606624576162267),
+      { UINT64_C( 5483606624576162267) } },
+    { UINT64_C(11948308598638460070),
+      { UINT64_C(11948308598638460070) } },
+    { UINT64_C( 3008221287194755441),
+      { UINT64_C( 3008221287194755441) } },
+    { UINT64_C( 1711520886761389839),
+      { UINT64_C( 1711520886761389839) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t r = simde_vld1_dup_u64(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    simde_uint64x1_t r = simde_vld1_dup_u64(&a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(   504.33),
+      { SIMDE_FLOAT32_C(   504.33), SIMDE_FLOAT32_C(   504.33), SIMDE_FLOAT32_C(   504.33), SIMDE_FLOAT32_C(   504.33) } },
+    { SIMDE_FLOAT32_C(  -642.14),
+      { SIMDE_FLOAT32_C(  -642.14), SIMDE_FLOAT32_C(  -642.14), SIMDE_FLOAT32_C(  -642.14), SIMDE_FLOAT32_C(  -642.14) } },
+    { SIMDE_FLOAT32_C(   565.84),
+      { SIMDE_FLOAT32_C(   565.84), SIMDE_FLOAT32_C(   565.84), SIMDE_FLOAT32_C(   565.84), SIMDE_FLOAT32_C(   565.84) } },
+    { SIMDE_FLOAT32_C(   -34.53),
+      { SIMDE_FLOAT32_C(   -34.53), SIMDE_FLOAT32_C(   -34.53), SIMDE_FLOAT32_C(   -34.53), SIMDE_FLOAT32_C(   -34.53) } },
+    { SIMDE_FLOAT32_C(  -699.06),
+      { SIMDE_FLOAT32_C(  -699.06), SIMDE_FLOAT32_C(  -699.06), SIMDE_FLOAT32_C(  -699.06), SIMDE_FLOAT32_C(  -699.06) } },
+    { SIMDE_FLOAT32_C(  -367.11),
+      { SIMDE_FLOAT32_C(  -367.11), SIMDE_FLOAT32_C(  -367.11), SIMDE_FLOAT32_C(  -367.11), SIMDE_FLOAT32_C(  -367.11) } },
+    { SIMDE_FLOAT32_C(   981.57),
+      { SIMDE_FLOAT32_C(   981.57), SIMDE_FLOAT32_C(   981.57), SIMDE_FLOAT32_C(   981.57), SIMDE_FLOAT32_C(   981.57) } },
+    { SIMDE_FLOAT32_C(   690.11),
+      { SIMDE_FLOAT32_C(   690.11), SIMDE_FLOAT32_C(   690.11), SIMDE_FLOAT32_C(   690.11), SIMDE_FLOAT32_C(   690.11) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r = simde_vld1q_dup_f32(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vld1q_dup_f32(&a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   806.71),
+      { SIMDE_FLOAT64_C(   806.71), SIMDE_FLOAT64_C(   806.71) } },
+    { SIMDE_FLOAT64_C(     1.10),
+      { SIMDE_FLOAT64_C(     1.10), SIMDE_FLOAT64_C(     1.10) } },
+    { SIMDE_FLOAT64_C(   272.62),
+      { SIMDE_FLOAT64_C(   272.62), SIMDE_FLOAT64_C(   272.62) } },
+    { SIMDE_FLOAT64_C(  -207.50),
+      { SIMDE_FLOAT64_C(  -207.50), SIMDE_FLOAT64_C(  -207.50) } },
+    { SIMDE_FLOAT64_C(   469.53),
+      { SIMDE_FLOAT64_C(   469.53), SIMDE_FLOAT64_C(   469.53) } },
+    { SIMDE_FLOAT64_C(    71.39),
+      { SIMDE_FLOAT64_C(    71.39), SIMDE_FLOAT64_C(    71.39) } },
+    { SIMDE_FLOAT64_C(  -284.89),
+      { SIMDE_FLOAT64_C(  -284.89), SIMDE_FLOAT64_C(  -284.89) } },
+    { SIMDE_FLOAT64_C(   954.80),
+      { SIMDE_FLOAT64_C(   954.80), SIMDE_FLOAT64_C(   954.80) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t r = simde_vld1q_dup_f64(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vld1q_dup_f64(&a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a;
+    int8_t r[16];
+  } test_vec[] = {
+    {      INT8_MIN,
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN } },
+    {  INT8_C(  46),
+      {  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),
+         INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46),  INT8_C(  46) } },
+    {  INT8_C(  10),
+      {  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),
+         INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10),  INT8_C(  10) } },
+    {  INT8_C(  33),
+      {  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),
+         INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33),  INT8_C(  33) } },
+    { -INT8_C(  48),
+      { -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48),
+        -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48), -INT8_C(  48) } },
+    { -INT8_C(  65),
+      { -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65),
+        -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65), -INT8_C(  65) } },
+    {  INT8_C(  24),
+      {  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),
+         INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24),  INT8_C(  24) } },
+    {  INT8_C(  11),
+      {  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),
+         INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11),  INT8_C(  11) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t r = simde_vld1q_dup_s8(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x16(r, simde_vld1q_s8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a = simde_test_codegen_random_i8();
+    simde_int8x16_t r = simde_vld1q_dup_s8(&a);
+
+    simde_test_codegen_write_i8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a;
+    int16_t r[8];
+  } test_vec[] = {
+    {  INT16_C( 18347),
+      {  INT16_C( 18347),  INT16_C( 18347),  INT16_C( 18347),  INT16_C( 18347),  INT16_C( 18347),  INT16_C( 18347),  INT16_C( 18347),  INT16_C( 18347) } },
+    { -INT16_C(  2305),
+      { -INT16_C(  2305), -INT16_C(  2305), -INT16_C(  2305), -INT16_C(  2305), -INT16_C(  2305), -INT16_C(  2305), -INT16_C(  2305), -INT16_C(  2305) } },
+    {  INT16_C( 29690),
+      {  INT16_C( 29690),  INT16_C( 29690),  INT16_C( 29690),  INT16_C( 29690),  INT16_C( 29690),  INT16_C( 29690),  INT16_C( 29690),  INT16_C( 29690) } },
+    { -INT16_C(  4121),
+      { -INT16_C(  4121), -INT16_C(  4121), -INT16_C(  4121), -INT16_C(  4121), -INT16_C(  4121), -INT16_C(  4121), -INT16_C(  4121), -INT16_C(  4121) } },
+    {  INT16_C( 13870),
+      {  INT16_C( 13870),  INT16_C( 13870),  INT16_C( 13870),  INT16_C( 13870),  INT16_C( 13870),  INT16_C( 13870),  INT16_C( 13870),  INT16_C( 13870) } },
+    {  INT16_C( 10484),
+      {  INT16_C( 10484),  INT16_C( 10484),  INT16_C( 10484),  INT16_C( 10484),  INT16_C( 10484),  INT16_C( 10484),  INT16_C( 10484),  INT16_C( 10484) } },
+    {  INT16_C( 29446),
+      {  INT16_C( 29446),  INT16_C( 29446),  INT16_C( 29446),  INT16_C( 29446),  INT16_C( 29446),  INT16_C( 29446),  INT16_C( 29446),  INT16_C( 29446) } },
+    {  INT16_C( 30258),
+      {  INT16_C( 30258),  INT16_C( 30258),  INT16_C( 30258),  INT16_C( 30258),  INT16_C( 30258),  INT16_C( 30258),  INT16_C( 30258),  INT16_C( 30258) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t r = simde_vld1q_dup_s16(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x8(r, simde_vld1q_s16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a = simde_test_codegen_random_i16();
+    simde_int16x8_t r = simde_vld1q_dup_s16(&a);
+
+    simde_test_codegen_write_i16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a;
+    int32_t r[4];
+  } test_vec[] = {
+    {  INT32_C(  1889158850),
+      {  INT32_C(  1889158850),  INT32_C(  1889158850),  INT32_C(  1889158850),  INT32_C(  1889158850) } },
+    {  INT32_C(     7252799),
+      {  INT32_C(     7252799),  INT32_C(     7252799),  INT32_C(     7252799),  INT32_C(     7252799) } },
+    { -INT32_C(  2018066032),
+      { -INT32_C(  2018066032), -INT32_C(  2018066032), -INT32_C(  2018066032), -INT32_C(  2018066032) } },
+    {  INT32_C(  1716134792),
+      {  INT32_C(  1716134792),  INT32_C(  1716134792),  INT32_C(  1716134792),  INT32_C(  1716134792) } },
+    { -INT32_C(  1494135145),
+      { -INT32_C(  1494135145), -INT32_C(  1494135145), -INT32_C(  1494135145), -INT32_C(  1494135145) } },
+    {  INT32_C(   767341489),
+      {  INT32_C(   767341489),  INT32_C(   767341489),  INT32_C(   767341489),  INT32_C(   767341489) } },
+    { -INT32_C(  1350997688),
+      { -INT32_C(  1350997688), -INT32_C(  1350997688), -INT32_C(  1350997688), -INT32_C(  1350997688) } },
+    { -INT32_C(  1970543868),
+      { -INT32_C(  1970543868), -INT32_C(  1970543868), -INT32_C(  1970543868), -INT32_C(  1970543868) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r = simde_vld1q_dup_s32(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a = simde_test_codegen_random_i32();
+    simde_int32x4_t r = simde_vld1q_dup_s32(&a);
+
+    simde_test_codegen_write_i32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    int64_t r[2];
+  } test_vec[] = {
+    {  INT64_C( 3033632862779080222),
+      {  INT64_C( 3033632862779080222),  INT64_C( 3033632862779080222) } },
+    { -INT64_C( 2521660742542541354),
+      { -INT64_C( 2521660742542541354), -INT64_C( 2521660742542541354) } },
+    { -INT64_C( 1861277777196799048),
+      { -INT64_C( 1861277777196799048), -INT64_C( 1861277777196799048) } },
+    {  INT64_C( 2017590111683187940),
+      {  INT64_C( 2017590111683187940),  INT64_C( 2017590111683187940) } },
+    {  INT64_C(  290151310827214870),
+      {  INT64_C(  290151310827214870),  INT64_C(  290151310827214870) } },
+    { -INT64_C( 4757837184846765086),
+      { -INT64_C( 4757837184846765086), -INT64_C( 4757837184846765086) } },
+    { -INT64_C( 7602647088058505690),
+      { -INT64_C( 7602647088058505690), -INT64_C( 7602647088058505690) } },
+    { -INT64_C( 8938639469999096110),
+      { -INT64_C( 8938639469999096110), -INT64_C( 8938639469999096110) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t r = simde_vld1q_dup_s64(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    simde_int64x2_t r = simde_vld1q_dup_s64(&a);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a;
+    uint8_t r[16];
+  } test_vec[] = {
+    { UINT8_C( 39),
+      { UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39),
+        UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39) } },
+    { UINT8_C(153),
+      { UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153),
+        UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153), UINT8_C(153) } },
+    { UINT8_C(189),
+      { UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189),
+        UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189), UINT8_C(189) } },
+    { UINT8_C(199),
+      { UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199),
+        UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199), UINT8_C(199) } },
+    { UINT8_C(217),
+      { UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217),
+        UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217) } },
+    { UINT8_C( 68),
+      { UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68),
+        UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68), UINT8_C( 68) } },
+    { UINT8_C(252),
+      { UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252),
+        UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252), UINT8_C(252) } },
+    { UINT8_C(211),
+      { UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211),
+        UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211), UINT8_C(211) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t r = simde_vld1q_dup_u8(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x16(r, simde_vld1q_u8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a = simde_test_codegen_random_u8();
+    simde_uint8x16_t r = simde_vld1q_dup_u8(&a);
+
+    simde_test_codegen_write_u8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a;
+    uint16_t r[8];
+  } test_vec[] = {
+    { UINT16_C(37724),
+      { UINT16_C(37724), UINT16_C(37724), UINT16_C(37724), UINT16_C(37724), UINT16_C(37724), UINT16_C(37724), UINT16_C(37724), UINT16_C(37724) } },
+    { UINT16_C(17475),
+      { UINT16_C(17475), UINT16_C(17475), UINT16_C(17475), UINT16_C(17475), UINT16_C(17475), UINT16_C(17475), UINT16_C(17475), UINT16_C(17475) } },
+    { UINT16_C( 3629),
+      { UINT16_C( 3629), UINT16_C( 3629), UINT16_C( 3629), UINT16_C( 3629), UINT16_C( 3629), UINT16_C( 3629), UINT16_C( 3629), UINT16_C( 3629) } },
+    { UINT16_C(61780),
+      { UINT16_C(61780), UINT16_C(61780), UINT16_C(61780), UINT16_C(61780), UINT16_C(61780), UINT16_C(61780), UINT16_C(61780), UINT16_C(61780) } },
+    { UINT16_C(18837),
+      { UINT16_C(18837), UINT16_C(18837), UINT16_C(18837), UINT16_C(18837), UINT16_C(18837), UINT16_C(18837), UINT16_C(18837), UINT16_C(18837) } },
+    { UINT16_C(32161),
+      { UINT16_C(32161), UINT16_C(32161), UINT16_C(32161), UINT16_C(32161), UINT16_C(32161), UINT16_C(32161), UINT16_C(32161), UINT16_C(32161) } },
+    { UINT16_C(28555),
+      { UINT16_C(28555), UINT16_C(28555), UINT16_C(28555), UINT16_C(28555), UINT16_C(28555), UINT16_C(28555), UINT16_C(28555), UINT16_C(28555) } },
+    { UINT16_C(41878),
+      { UINT16_C(41878), UINT16_C(41878), UINT16_C(41878), UINT16_C(41878), UINT16_C(41878), UINT16_C(41878), UINT16_C(41878), UINT16_C(41878) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t r = simde_vld1q_dup_u16(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x8(r, simde_vld1q_u16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a = simde_test_codegen_random_u16();
+    simde_uint16x8_t r = simde_vld1q_dup_u16(&a);
+
+    simde_test_codegen_write_u16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a;
+    uint32_t r[4];
+  } test_vec[] = {
+    { UINT32_C(2897123241),
+      { UINT32_C(2897123241), UINT32_C(2897123241), UINT32_C(2897123241), UINT32_C(2897123241) } },
+    { UINT32_C( 358608589),
+      { UINT32_C( 358608589), UINT32_C( 358608589), UINT32_C( 358608589), UINT32_C( 358608589) } },
+    { UINT32_C(4160151965),
+      { UINT32_C(4160151965), UINT32_C(4160151965), UINT32_C(4160151965), UINT32_C(4160151965) } },
+    { UINT32_C(3127205512),
+      { UINT32_C(3127205512), UINT32_C(3127205512), UINT32_C(3127205512), UINT32_C(3127205512) } },
+    { UINT32_C(3764527636),
+      { UINT32_C(3764527636), UINT32_C(3764527636), UINT32_C(3764527636), UINT32_C(3764527636) } },
+    { UINT32_C(2480853267),
+      { UINT32_C(2480853267), UINT32_C(2480853267), UINT32_C(2480853267), UINT32_C(2480853267) } },
+    { UINT32_C( 271049118),
+      { UINT32_C( 271049118), UINT32_C( 271049118), UINT32_C( 271049118), UINT32_C( 271049118) } },
+    { UINT32_C(3696905351),
+      { UINT32_C(3696905351), UINT32_C(3696905351), UINT32_C(3696905351), UINT32_C(3696905351) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t r = simde_vld1q_dup_u32(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    simde_uint32x4_t r = simde_vld1q_dup_u32(&a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a;
+    uint64_t r[2];
+  } test_vec[] = {
+    { UINT64_C( 2121044675987006023),
+      { UINT64_C( 2121044675987006023), UINT64_C( 2121044675987006023) } },
+    { UINT64_C( 5171703899258511067),
+      { UINT64_C( 5171703899258511067), UINT64_C( 5171703899258511067) } },
+    { UINT64_C(14172871935675333257),
+      { UINT64_C(14172871935675333257), UINT64_C(14172871935675333257) } },
+    { UINT64_C( 3016316875486434375),
+      { UINT64_C( 3016316875486434375), UINT64_C( 3016316875486434375) } },
+    { UINT64_C( 5879135452394116971),
+      { UINT64_C( 5879135452394116971), UINT64_C( 5879135452394116971) } },
+    { UINT64_C(17113197391097496443),
+      { UINT64_C(17113197391097496443), UINT64_C(17113197391097496443) } },
+    { UINT64_C(10880204759967510680),
+      { UINT64_C(10880204759967510680), UINT64_C(10880204759967510680) } },
+    { UINT64_C(12526181786646510483),
+      { UINT64_C(12526181786646510483), UINT64_C(12526181786646510483) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t r = simde_vld1q_dup_u64(&test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    simde_uint64x2_t r = simde_vld1q_dup_u64(&a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_dup_u64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_dup_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1439 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld1_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld1_lane.h"
+
+static int
+test_simde_vld1_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 src[2];
+    simde_float32 buf;
+    int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -413.09), SIMDE_FLOAT32_C(  -278.16) },
+      SIMDE_FLOAT32_C(  -676.61),
+       INT32_C(           0),
+      { SIMDE_FLOAT32_C(  -676.61), SIMDE_FLOAT32_C(  -278.16) } },
+    { { SIMDE_FLOAT32_C(  -420.44), SIMDE_FLOAT32_C(  -734.28) },
+      SIMDE_FLOAT32_C(   278.75),
+       INT32_C(           1),
+      { SIMDE_FLOAT32_C(  -420.44), SIMDE_FLOAT32_C(   278.75) } },
+    { { SIMDE_FLOAT32_C(  -958.95), SIMDE_FLOAT32_C(  -514.61) },
+      SIMDE_FLOAT32_C(   615.90),
+       INT32_C(           0),
+      { SIMDE_FLOAT32_C(   615.90), SIMDE_FLOAT32_C(  -514.61) } },
+    { { SIMDE_FLOAT32_C(   703.94), SIMDE_FLOAT32_C(  -320.64) },
+      SIMDE_FLOAT32_C(   469.38),
+       INT32_C(           1),
+      { SIMDE_FLOAT32_C(   703.94), SIMDE_FLOAT32_C(   469.38) } },
+    { { SIMDE_FLOAT32_C(   619.94), SIMDE_FLOAT32_C(   300.31) },
+      SIMDE_FLOAT32_C(   242.18),
+       INT32_C(           0),
+      { SIMDE_FLOAT32_C(   242.18), SIMDE_FLOAT32_C(   300.31) } },
+    { { SIMDE_FLOAT32_C(   507.63), SIMDE_FLOAT32_C(  -360.85) },
+      SIMDE_FLOAT32_C(  -338.00),
+       INT32_C(           1),
+      { SIMDE_FLOAT32_C(   507.63), SIMDE_FLOAT32_C(  -338.00) } },
+    { { SIMDE_FLOAT32_C(  -487.32), SIMDE_FLOAT32_C(  -538.16) },
+      SIMDE_FLOAT32_C(    26.60),
+       INT32_C(           0),
+      { SIMDE_FLOAT32_C(    26.60), SIMDE_FLOAT32_C(  -538.16) } },
+    { { SIMDE_FLOAT32_C(    78.59), SIMDE_FLOAT32_C(  -618.36) },
+      SIMDE_FLOAT32_C(  -829.34),
+       INT32_C(           1),
+      { SIMDE_FLOAT32_C(    78.59), SIMDE_FLOAT32_C(  -829.34) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t src = simde_vld1_f32(test_vec[i].src);
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1_lane_f32, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t src = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32 buf = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    int lane = i % 2;
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1_lane_f32, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_f32x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 src[1];
+    simde_float64 buf;
+    int lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -950.68) },
+      SIMDE_FLOAT64_C(  -573.75),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(  -573.75) } },
+    { { SIMDE_FLOAT64_C(  -687.76) },
+      SIMDE_FLOAT64_C(   242.19),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(   242.19) } },
+    { { SIMDE_FLOAT64_C(   623.41) },
+      SIMDE_FLOAT64_C(    68.89),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(    68.89) } },
+    { { SIMDE_FLOAT64_C(   287.94) },
+      SIMDE_FLOAT64_C(  -157.61),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(  -157.61) } },
+    { { SIMDE_FLOAT64_C(  -851.08) },
+      SIMDE_FLOAT64_C(   494.43),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(   494.43) } },
+    { { SIMDE_FLOAT64_C(   531.62) },
+      SIMDE_FLOAT64_C(  -704.64),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(  -704.64) } },
+    { { SIMDE_FLOAT64_C(  -379.02) },
+      SIMDE_FLOAT64_C(   365.13),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(   365.13) } },
+    { { SIMDE_FLOAT64_C(   411.41) },
+      SIMDE_FLOAT64_C(  -672.07),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(  -672.07) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t src = simde_vld1_f64(test_vec[i].src);
+    simde_float64x1_t r;
+    r = simde_vld1_lane_f64(&test_vec[i].buf, src, 0);
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t src = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64 buf = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64x1_t r;
+    r = simde_vld1_lane_f64(&buf, src, 0);
+
+    simde_test_arm_neon_write_f64x1(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, 0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t src[8];
+    int8_t buf;
+    int lane;
+    int8_t r[8];
+  } test_vec[] = {
+    { {  INT8_C(  99),  INT8_C(  92),  INT8_C(  98), -INT8_C(  92), -INT8_C( 117),  INT8_C(   3), -INT8_C(  47), -INT8_C(  77) },
+       INT8_C(  37),
+       INT32_C(           0),
+      {  INT8_C(  37),  INT8_C(  92),  INT8_C(  98), -INT8_C(  92), -INT8_C( 117),  INT8_C(   3), -INT8_C(  47), -INT8_C(  77) } },
+    { { -INT8_C(  94),  INT8_C(  96),  INT8_C(   2), -INT8_C(  20), -INT8_C( 118),  INT8_C(  45), -INT8_C(  87),  INT8_C(  45) },
+       INT8_C( 109),
+       INT32_C(           1),
+      { -INT8_C(  94),  INT8_C( 109),  INT8_C(   2), -INT8_C(  20), -INT8_C( 118),  INT8_C(  45), -INT8_C(  87),  INT8_C(  45) } },
+    { { -INT8_C(  55), -INT8_C(  82), -INT8_C(  97),  INT8_C(  43),  INT8_C( 121),  INT8_C(  62),  INT8_C( 117), -INT8_C(  63) },
+       INT8_C(  15),
+       INT32_C(           2),
+      { -INT8_C(  55), -INT8_C(  82),  INT8_C(  15),  INT8_C(  43),  INT8_C( 121),  INT8_C(  62),  INT8_C( 117), -INT8_C(  63) } },
+    { {  INT8_C(  19), -INT8_C(  92),  INT8_C( 111),  INT8_C(  67),  INT8_C(  40),  INT8_C( 112), -INT8_C(  69), -INT8_C(  19) },
+       INT8_C( 111),
+       INT32_C(           3),
+      {  INT8_C(  19), -INT8_C(  92),  INT8_C( 111),  INT8_C( 111),  INT8_C(  40),  INT8_C( 112), -INT8_C(  69), -INT8_C(  19) } },
+    { {  INT8_C( 126),  INT8_C(  63),  INT8_C( 101), -INT8_C(  25),  INT8_C(  90),  INT8_C(  77),  INT8_C(  72),  INT8_C(  22) },
+      -INT8_C(  98),
+       INT32_C(           4),
+      {  INT8_C( 126),  INT8_C(  63),  INT8_C( 101), -INT8_C(  25), -INT8_C(  98),  INT8_C(  77),  INT8_C(  72),  INT8_C(  22) } },
+    { { -INT8_C(  56), -INT8_C(  73), -INT8_C(  48),  INT8_C(  29),  INT8_C(  25),  INT8_C(   1), -INT8_C(  74),  INT8_C( 101) },
+      -INT8_C(  60),
+       INT32_C(           5),
+      { -INT8_C(  56), -INT8_C(  73), -INT8_C(  48),  INT8_C(  29),  INT8_C(  25), -INT8_C(  60), -INT8_C(  74),  INT8_C( 101) } },
+    { {  INT8_C(  42), -INT8_C( 106), -INT8_C( 103), -INT8_C(  36),  INT8_C(  41), -INT8_C(  73), -INT8_C( 127), -INT8_C( 101) },
+       INT8_C( 121),
+       INT32_C(           6),
+      {  INT8_C(  42), -INT8_C( 106), -INT8_C( 103), -INT8_C(  36),  INT8_C(  41), -INT8_C(  73),  INT8_C( 121), -INT8_C( 101) } },
+    { { -INT8_C(  81), -INT8_C(   7), -INT8_C(  17),  INT8_C(  81), -INT8_C(  32),  INT8_C(  67), -INT8_C(  49),  INT8_C(  86) },
+      -INT8_C(  99),
+       INT32_C(           7),
+      { -INT8_C(  81), -INT8_C(   7), -INT8_C(  17),  INT8_C(  81), -INT8_C(  32),  INT8_C(  67), -INT8_C(  49), -INT8_C(  99) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t src = simde_vld1_s8(test_vec[i].src);
+    simde_int8x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1_lane_s8, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i8x8(r, simde_vld1_s8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x8_t src = simde_test_arm_neon_random_i8x8();
+    int8_t buf = simde_test_codegen_random_i8();
+    int lane = i % 8;
+    simde_int8x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1_lane_s8, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i8x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i8(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t src[4];
+    int16_t buf;
+    int lane;
+    int16_t r[4];
+  } test_vec[] = {
+    { { -INT16_C( 22332),  INT16_C( 21293),  INT16_C( 15753),  INT16_C(  2115) },
+       INT16_C( 15843),
+       INT32_C(           0),
+      {  INT16_C( 15843),  INT16_C( 21293),  INT16_C( 15753),  INT16_C(  2115) } },
+    { { -INT16_C( 19434), -INT16_C( 18926), -INT16_C( 17819), -INT16_C( 30833) },
+       INT16_C(  5529),
+       INT32_C(           1),
+      { -INT16_C( 19434),  INT16_C(  5529), -INT16_C( 17819), -INT16_C( 30833) } },
+    { {  INT16_C(  4680), -INT16_C( 30764), -INT16_C( 10065),  INT16_C(  1702) },
+       INT16_C(  8309),
+       INT32_C(           2),
+      {  INT16_C(  4680), -INT16_C( 30764),  INT16_C(  8309),  INT16_C(  1702) } },
+    { { -INT16_C( 27495),  INT16_C( 19419), -INT16_C( 20568), -INT16_C( 29746) },
+      -INT16_C( 26304),
+       INT32_C(           3),
+      { -INT16_C( 27495),  INT16_C( 19419), -INT16_C( 20568), -INT16_C( 26304) } },
+    { {  INT16_C( 29925), -INT16_C( 25596), -INT16_C( 15352), -INT16_C(  2296) },
+       INT16_C(  9714),
+       INT32_C(           0),
+      {  INT16_C(  9714), -INT16_C( 25596), -INT16_C( 15352), -INT16_C(  2296) } },
+    { {  INT16_C(  9930), -INT16_C( 22631), -INT16_C( 14661),  INT16_C( 11735) },
+       INT16_C( 14401),
+       INT32_C(           1),
+      {  INT16_C(  9930),  INT16_C( 14401), -INT16_C( 14661),  INT16_C( 11735) } },
+    { {  INT16_C(  7619),  INT16_C( 30468), -INT16_C( 19735),  INT16_C(  4376) },
+      -INT16_C( 14679),
+       INT32_C(           2),
+      {  INT16_C(  7619),  INT16_C( 30468), -INT16_C( 14679),  INT16_C(  4376) } },
+    { { -INT16_C(  6613),  INT16_C(  7073),  INT16_C(   876),  INT16_C(  2181) },
+       INT16_C( 12851),
+       INT32_C(           3),
+      { -INT16_C(  6613),  INT16_C(  7073),  INT16_C(   876),  INT16_C( 12851) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t src = simde_vld1_s16(test_vec[i].src);
+    simde_int16x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1_lane_s16, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i16x4(r, simde_vld1_s16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x4_t src = simde_test_arm_neon_random_i16x4();
+    int16_t buf = simde_test_codegen_random_i16();
+    int lane = i % 4;
+    simde_int16x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1_lane_s16, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i16x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i16(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t src[2];
+    int32_t buf;
+    int lane;
+    int32_t r[2];
+  } test_vec[] = {
+    { {  INT32_C(   862172203), -INT32_C(  1388040714) },
+      -INT32_C(  1826756820),
+       INT32_C(           0),
+      { -INT32_C(  1826756820), -INT32_C(  1388040714) } },
+    { { -INT32_C(  2127570232),  INT32_C(   135945496) },
+       INT32_C(   181257267),
+       INT32_C(           1),
+      { -INT32_C(  2127570232),  INT32_C(   181257267) } },
+    { { -INT32_C(   212498438),  INT32_C(   593030403) },
+       INT32_C(    78303517),
+       INT32_C(           0),
+      {  INT32_C(    78303517),  INT32_C(   593030403) } },
+    { {  INT32_C(  1424904110), -INT32_C(  1107461292) },
+       INT32_C(   648738397),
+       INT32_C(           1),
+      {  INT32_C(  1424904110),  INT32_C(   648738397) } },
+    { { -INT32_C(   837919259), -INT32_C(  1232871341) },
+       INT32_C(  1650130043),
+       INT32_C(           0),
+      {  INT32_C(  1650130043), -INT32_C(  1232871341) } },
+    { { -INT32_C(   414293809), -INT32_C(   794544034) },
+      -INT32_C(   398718460),
+       INT32_C(           1),
+      { -INT32_C(   414293809), -INT32_C(   398718460) } },
+    { {  INT32_C(   753441381), -INT32_C(   872495987) },
+      -INT32_C(   966384948),
+       INT32_C(           0),
+      { -INT32_C(   966384948), -INT32_C(   872495987) } },
+    { { -INT32_C(   700010810), -INT32_C(  1826284424) },
+      -INT32_C(  1521297037),
+       INT32_C(           1),
+      { -INT32_C(   700010810), -INT32_C(  1521297037) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t src = simde_vld1_s32(test_vec[i].src);
+    simde_int32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1_lane_s32, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x2_t src = simde_test_arm_neon_random_i32x2();
+    int32_t buf = simde_test_codegen_random_i32();
+    int lane = i % 2;
+    simde_int32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1_lane_s32, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i32x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t src[1];
+    int64_t buf;
+    int lane;
+    int64_t r[1];
+  } test_vec[] = {
+    { { -INT64_C( 6553860377661967285) },
+      -INT64_C( 4949151220485511802),
+       INT32_C(           0),
+      { -INT64_C( 4949151220485511802) } },
+    { { -INT64_C( 3744229606258704547) },
+       INT64_C( 5579819131519556639),
+       INT32_C(           0),
+      {  INT64_C( 5579819131519556639) } },
+    { {  INT64_C( 3955028641432909660) },
+       INT64_C( 2742103419086659361),
+       INT32_C(           0),
+      {  INT64_C( 2742103419086659361) } },
+    { { -INT64_C( 4046686651905860385) },
+       INT64_C( 6092235431243755407),
+       INT32_C(           0),
+      {  INT64_C( 6092235431243755407) } },
+    { {  INT64_C( 5073097337968017332) },
+      -INT64_C( 8429197375857500420),
+       INT32_C(           0),
+      { -INT64_C( 8429197375857500420) } },
+    { {  INT64_C( 7887813900490643233) },
+       INT64_C( 6315520401219595628),
+       INT32_C(           0),
+      {  INT64_C( 6315520401219595628) } },
+    { {  INT64_C( 3941003351303318957) },
+      -INT64_C( 2657500493581559275),
+       INT32_C(           0),
+      { -INT64_C( 2657500493581559275) } },
+    { { -INT64_C( 4973371602821436012) },
+      -INT64_C(  959138715596567347),
+       INT32_C(           0),
+      { -INT64_C(  959138715596567347) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t src = simde_vld1_s64(test_vec[i].src);
+    simde_int64x1_t r;
+    r = simde_vld1_lane_s64(&test_vec[i].buf, src, 0);
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x1_t src = simde_test_arm_neon_random_i64x1();
+    int64_t buf = simde_test_codegen_random_i64();
+    simde_int64x1_t r;
+    r = simde_vld1_lane_s64(&buf, src, 0);
+
+    simde_test_arm_neon_write_i64x1(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, 0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t src[8];
+    uint8_t buf;
+    int lane;
+    uint8_t r[8];
+  } test_vec[] = {
+    { { UINT8_C(226), UINT8_C(221), UINT8_C(120), UINT8_C(131), UINT8_C(137), UINT8_C(125), UINT8_C(204), UINT8_C( 73) },
+      UINT8_C( 37),
+       INT32_C(           0),
+      { UINT8_C( 37), UINT8_C(221), UINT8_C(120), UINT8_C(131), UINT8_C(137), UINT8_C(125), UINT8_C(204), UINT8_C( 73) } },
+    { { UINT8_C(123), UINT8_C(211), UINT8_C( 98), UINT8_C(159), UINT8_C(166), UINT8_C( 85), UINT8_C(136), UINT8_C( 38) },
+      UINT8_C( 83),
+       INT32_C(           1),
+      { UINT8_C(123), UINT8_C( 83), UINT8_C( 98), UINT8_C(159), UINT8_C(166), UINT8_C( 85), UINT8_C(136), UINT8_C( 38) } },
+    { { UINT8_C(131), UINT8_C(149), UINT8_C( 75), UINT8_C(219), UINT8_C(  0), UINT8_C(210), UINT8_C(211), UINT8_C(182) },
+      UINT8_C(191),
+       INT32_C(           2),
+      { UINT8_C(131), UINT8_C(149), UINT8_C(191), UINT8_C(219), UINT8_C(  0), UINT8_C(210), UINT8_C(211), UINT8_C(182) } },
+    { { UINT8_C(100), UINT8_C(230), UINT8_C( 74), UINT8_C(195), UINT8_C(248), UINT8_C(103), UINT8_C(110), UINT8_C(234) },
+      UINT8_C(107),
+       INT32_C(           3),
+      { UINT8_C(100), UINT8_C(230), UINT8_C( 74), UINT8_C(107), UINT8_C(248), UINT8_C(103), UINT8_C(110), UINT8_C(234) } },
+    { { UINT8_C( 61), UINT8_C(242), UINT8_C( 65), UINT8_C(  6), UINT8_C(119), UINT8_C(  0), UINT8_C(173), UINT8_C(215) },
+      UINT8_C( 25),
+       INT32_C(           4),
+      { UINT8_C( 61), UINT8_C(242), UINT8_C( 65), UINT8_C(  6), UINT8_C( 25), UINT8_C(  0), UINT8_C(173), UINT8_C(215) } },
+    { { UINT8_C(220), UINT8_C( 14), UINT8_C(178), UINT8_C(238), UINT8_C(  6), UINT8_C(  3), UINT8_C(155), UINT8_C(190) },
+      UINT8_C( 22),
+       INT32_C(           5),
+      { UINT8_C(220), UINT8_C( 14), UINT8_C(178), UINT8_C(238), UINT8_C(  6), UINT8_C( 22), UINT8_C(155), UINT8_C(190) } },
+    { { UINT8_C(120), UINT8_C(149), UINT8_C(245), UINT8_C( 94), UINT8_C(219), UINT8_C( 43), UINT8_C(118), UINT8_C( 88) },
+      UINT8_C(139),
+       INT32_C(           6),
+      { UINT8_C(120), UINT8_C(149), UINT8_C(245), UINT8_C( 94), UINT8_C(219), UINT8_C( 43), UINT8_C(139), UINT8_C( 88) } },
+    { { UINT8_C( 30), UINT8_C(178), UINT8_C(251), UINT8_C( 66), UINT8_C(127), UINT8_C(  4), UINT8_C(  1), UINT8_C(253) },
+      UINT8_C(133),
+       INT32_C(           7),
+      { UINT8_C( 30), UINT8_C(178), UINT8_C(251), UINT8_C( 66), UINT8_C(127), UINT8_C(  4), UINT8_C(  1), UINT8_C(133) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t src = simde_vld1_u8(test_vec[i].src);
+    simde_uint8x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1_lane_u8, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u8x8(r, simde_vld1_u8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x8_t src = simde_test_arm_neon_random_u8x8();
+    uint8_t buf = simde_test_codegen_random_u8();
+    int lane = i % 8;
+    simde_uint8x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1_lane_u8, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u8x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u8(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t src[4];
+    uint16_t buf;
+    int lane;
+    uint16_t r[4];
+  } test_vec[] = {
+    { { UINT16_C(35628), UINT16_C(57765), UINT16_C(52424), UINT16_C(65068) },
+      UINT16_C(35270),
+       INT32_C(           0),
+      { UINT16_C(35270), UINT16_C(57765), UINT16_C(52424), UINT16_C(65068) } },
+    { { UINT16_C(13303), UINT16_C( 4977), UINT16_C(15971), UINT16_C( 6738) },
+      UINT16_C( 1993),
+       INT32_C(           1),
+      { UINT16_C(13303), UINT16_C( 1993), UINT16_C(15971), UINT16_C( 6738) } },
+    { { UINT16_C(15381), UINT16_C( 4796), UINT16_C(63265), UINT16_C( 1762) },
+      UINT16_C(53468),
+       INT32_C(           2),
+      { UINT16_C(15381), UINT16_C( 4796), UINT16_C(53468), UINT16_C( 1762) } },
+    { { UINT16_C(44473), UINT16_C(19177), UINT16_C(63019), UINT16_C(29255) },
+      UINT16_C( 1032),
+       INT32_C(           3),
+      { UINT16_C(44473), UINT16_C(19177), UINT16_C(63019), UINT16_C( 1032) } },
+    { { UINT16_C(63451), UINT16_C(38139), UINT16_C(33122), UINT16_C(31159) },
+      UINT16_C(20761),
+       INT32_C(           0),
+      { UINT16_C(20761), UINT16_C(38139), UINT16_C(33122), UINT16_C(31159) } },
+    { { UINT16_C( 3877), UINT16_C(34651), UINT16_C(17412), UINT16_C(11054) },
+      UINT16_C(26127),
+       INT32_C(           1),
+      { UINT16_C( 3877), UINT16_C(26127), UINT16_C(17412), UINT16_C(11054) } },
+    { { UINT16_C(37323), UINT16_C(16430), UINT16_C( 4699), UINT16_C(36639) },
+      UINT16_C(34099),
+       INT32_C(           2),
+      { UINT16_C(37323), UINT16_C(16430), UINT16_C(34099), UINT16_C(36639) } },
+    { { UINT16_C( 4557), UINT16_C( 7277), UINT16_C(50746), UINT16_C( 2571) },
+      UINT16_C( 6852),
+       INT32_C(           3),
+      { UINT16_C( 4557), UINT16_C( 7277), UINT16_C(50746), UINT16_C( 6852) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t src = simde_vld1_u16(test_vec[i].src);
+    simde_uint16x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1_lane_u16, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u16x4(r, simde_vld1_u16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x4_t src = simde_test_arm_neon_random_u16x4();
+    uint16_t buf = simde_test_codegen_random_u16();
+    int lane = i % 4;
+    simde_uint16x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1_lane_u16, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u16x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t src[2];
+    uint32_t buf;
+    int lane;
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(3243217326), UINT32_C(2537008081) },
+      UINT32_C(2169081824),
+       INT32_C(           0),
+      { UINT32_C(2169081824), UINT32_C(2537008081) } },
+    { { UINT32_C(2159801985), UINT32_C( 685992081) },
+      UINT32_C(3704353963),
+       INT32_C(           1),
+      { UINT32_C(2159801985), UINT32_C(3704353963) } },
+    { { UINT32_C(1712696849), UINT32_C(4278402071) },
+      UINT32_C(3812492427),
+       INT32_C(           0),
+      { UINT32_C(3812492427), UINT32_C(4278402071) } },
+    { { UINT32_C(2590262595), UINT32_C(1550799039) },
+      UINT32_C(3343216179),
+       INT32_C(           1),
+      { UINT32_C(2590262595), UINT32_C(3343216179) } },
+    { { UINT32_C(1172749423), UINT32_C(3570690392) },
+      UINT32_C(2062432865),
+       INT32_C(           0),
+      { UINT32_C(2062432865), UINT32_C(3570690392) } },
+    { { UINT32_C(2472823306), UINT32_C(3845174631) },
+      UINT32_C(2395665518),
+       INT32_C(           1),
+      { UINT32_C(2472823306), UINT32_C(2395665518) } },
+    { { UINT32_C(2645435042), UINT32_C(1839390919) },
+      UINT32_C(2034247692),
+       INT32_C(           0),
+      { UINT32_C(2034247692), UINT32_C(1839390919) } },
+    { { UINT32_C(3529268970), UINT32_C(2695844723) },
+      UINT32_C(3449452455),
+       INT32_C(           1),
+      { UINT32_C(3529268970), UINT32_C(3449452455) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t src = simde_vld1_u32(test_vec[i].src);
+    simde_uint32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1_lane_u32, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x2_t src = simde_test_arm_neon_random_u32x2();
+    uint32_t buf = simde_test_codegen_random_u32();
+    int lane = i % 2;
+    simde_uint32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1_lane_u32, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u32x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t src[1];
+    uint64_t buf;
+    int lane;
+    uint64_t r[1];
+  } test_vec[] = {
+    { { UINT64_C(15945146146105313764) },
+      UINT64_C( 1827693701552370621),
+       INT32_C(           0),
+      { UINT64_C( 1827693701552370621) } },
+    { { UINT64_C( 3087809426585287772) },
+      UINT64_C(10700997979126031159),
+       INT32_C(           0),
+      { UINT64_C(10700997979126031159) } },
+    { { UINT64_C(13394941132078487919) },
+      UINT64_C( 9101785055197820695),
+       INT32_C(           0),
+      { UINT64_C( 9101785055197820695) } },
+    { { UINT64_C( 9496401925767159397) },
+      UINT64_C(15749661196281354337),
+       INT32_C(           0),
+      { UINT64_C(15749661196281354337) } },
+    { { UINT64_C(16669041879950191244) },
+      UINT64_C(17319516763412500034),
+       INT32_C(           0),
+      { UINT64_C(17319516763412500034) } },
+    { { UINT64_C( 3229675776826004614) },
+      UINT64_C(13366820532234036286),
+       INT32_C(           0),
+      { UINT64_C(13366820532234036286) } },
+    { { UINT64_C( 1573283269108712454) },
+      UINT64_C(12595407795969127118),
+       INT32_C(           0),
+      { UINT64_C(12595407795969127118) } },
+    { { UINT64_C( 7396769678180417547) },
+      UINT64_C( 5943457933324221325),
+       INT32_C(           0),
+      { UINT64_C( 5943457933324221325) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t src = simde_vld1_u64(test_vec[i].src);
+    simde_uint64x1_t r;
+    r = simde_vld1_lane_u64(&test_vec[i].buf, src, 0);
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x1_t src = simde_test_arm_neon_random_u64x1();
+    uint64_t buf = simde_test_codegen_random_u64();
+    simde_uint64x1_t r;
+    r = simde_vld1_lane_u64(&buf, src, 0);
+
+    simde_test_arm_neon_write_u64x1(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, 0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 src[4];
+    simde_float32 buf;
+    int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     4.07), SIMDE_FLOAT32_C(   389.58), SIMDE_FLOAT32_C(   -71.04), SIMDE_FLOAT32_C(    80.61) },
+      SIMDE_FLOAT32_C(   374.17),
+       INT32_C(           0),
+      { SIMDE_FLOAT32_C(   374.17), SIMDE_FLOAT32_C(   389.58), SIMDE_FLOAT32_C(   -71.04), SIMDE_FLOAT32_C(    80.61) } },
+    { { SIMDE_FLOAT32_C(   649.78), SIMDE_FLOAT32_C(   945.51), SIMDE_FLOAT32_C(   412.36), SIMDE_FLOAT32_C(    -6.20) },
+      SIMDE_FLOAT32_C(  -887.42),
+       INT32_C(           1),
+      { SIMDE_FLOAT32_C(   649.78), SIMDE_FLOAT32_C(  -887.42), SIMDE_FLOAT32_C(   412.36), SIMDE_FLOAT32_C(    -6.20) } },
+    { { SIMDE_FLOAT32_C(  -411.15), SIMDE_FLOAT32_C(  -614.70), SIMDE_FLOAT32_C(   918.58), SIMDE_FLOAT32_C(   455.61) },
+      SIMDE_FLOAT32_C(  -743.39),
+       INT32_C(           2),
+      { SIMDE_FLOAT32_C(  -411.15), SIMDE_FLOAT32_C(  -614.70), SIMDE_FLOAT32_C(  -743.39), SIMDE_FLOAT32_C(   455.61) } },
+    { { SIMDE_FLOAT32_C(  -324.03), SIMDE_FLOAT32_C(  -156.40), SIMDE_FLOAT32_C(   256.38), SIMDE_FLOAT32_C(   948.33) },
+      SIMDE_FLOAT32_C(  -334.11),
+       INT32_C(           3),
+      { SIMDE_FLOAT32_C(  -324.03), SIMDE_FLOAT32_C(  -156.40), SIMDE_FLOAT32_C(   256.38), SIMDE_FLOAT32_C(  -334.11) } },
+    { { SIMDE_FLOAT32_C(   397.64), SIMDE_FLOAT32_C(  -174.37), SIMDE_FLOAT32_C(   808.49), SIMDE_FLOAT32_C(     2.22) },
+      SIMDE_FLOAT32_C(   533.39),
+       INT32_C(           0),
+      { SIMDE_FLOAT32_C(   533.39), SIMDE_FLOAT32_C(  -174.37), SIMDE_FLOAT32_C(   808.49), SIMDE_FLOAT32_C(     2.22) } },
+    { { SIMDE_FLOAT32_C(   166.23), SIMDE_FLOAT32_C(   439.45), SIMDE_FLOAT32_C(   509.88), SIMDE_FLOAT32_C(  -219.30) },
+      SIMDE_FLOAT32_C(  -107.36),
+       INT32_C(           1),
+      { SIMDE_FLOAT32_C(   166.23), SIMDE_FLOAT32_C(  -107.36), SIMDE_FLOAT32_C(   509.88), SIMDE_FLOAT32_C(  -219.30) } },
+    { { SIMDE_FLOAT32_C(   241.12), SIMDE_FLOAT32_C(   429.00), SIMDE_FLOAT32_C(   185.56), SIMDE_FLOAT32_C(  -281.00) },
+      SIMDE_FLOAT32_C(   -22.35),
+       INT32_C(           2),
+      { SIMDE_FLOAT32_C(   241.12), SIMDE_FLOAT32_C(   429.00), SIMDE_FLOAT32_C(   -22.35), SIMDE_FLOAT32_C(  -281.00) } },
+    { { SIMDE_FLOAT32_C(    19.41), SIMDE_FLOAT32_C(  -237.20), SIMDE_FLOAT32_C(  -357.65), SIMDE_FLOAT32_C(  -870.27) },
+      SIMDE_FLOAT32_C(  -867.02),
+       INT32_C(           3),
+      { SIMDE_FLOAT32_C(    19.41), SIMDE_FLOAT32_C(  -237.20), SIMDE_FLOAT32_C(  -357.65), SIMDE_FLOAT32_C(  -867.02) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t src = simde_vld1q_f32(test_vec[i].src);
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1q_lane_f32, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t src = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32 buf = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    int lane = i % 4;
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1q_lane_f32, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 src[2];
+    simde_float64 buf;
+    int lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -688.75), SIMDE_FLOAT64_C(  -825.38) },
+      SIMDE_FLOAT64_C(  -254.89),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(  -254.89), SIMDE_FLOAT64_C(  -825.38) } },
+    { { SIMDE_FLOAT64_C(   938.10), SIMDE_FLOAT64_C(  -198.56) },
+      SIMDE_FLOAT64_C(   824.88),
+       INT32_C(           1),
+      { SIMDE_FLOAT64_C(   938.10), SIMDE_FLOAT64_C(   824.88) } },
+    { { SIMDE_FLOAT64_C(   377.01), SIMDE_FLOAT64_C(   861.31) },
+      SIMDE_FLOAT64_C(   303.24),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(   303.24), SIMDE_FLOAT64_C(   861.31) } },
+    { { SIMDE_FLOAT64_C(   914.94), SIMDE_FLOAT64_C(   609.67) },
+      SIMDE_FLOAT64_C(  -841.78),
+       INT32_C(           1),
+      { SIMDE_FLOAT64_C(   914.94), SIMDE_FLOAT64_C(  -841.78) } },
+    { { SIMDE_FLOAT64_C(  -994.79), SIMDE_FLOAT64_C(   922.52) },
+      SIMDE_FLOAT64_C(  -318.17),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(  -318.17), SIMDE_FLOAT64_C(   922.52) } },
+    { { SIMDE_FLOAT64_C(   308.32), SIMDE_FLOAT64_C(   906.80) },
+      SIMDE_FLOAT64_C(   973.20),
+       INT32_C(           1),
+      { SIMDE_FLOAT64_C(   308.32), SIMDE_FLOAT64_C(   973.20) } },
+    { { SIMDE_FLOAT64_C(    49.93), SIMDE_FLOAT64_C(  -342.67) },
+      SIMDE_FLOAT64_C(   181.10),
+       INT32_C(           0),
+      { SIMDE_FLOAT64_C(   181.10), SIMDE_FLOAT64_C(  -342.67) } },
+    { { SIMDE_FLOAT64_C(   393.94), SIMDE_FLOAT64_C(  -812.60) },
+      SIMDE_FLOAT64_C(   606.79),
+       INT32_C(           1),
+      { SIMDE_FLOAT64_C(   393.94), SIMDE_FLOAT64_C(   606.79) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t src = simde_vld1q_f64(test_vec[i].src);
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1q_lane_f64, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t src = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64 buf = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    int lane = i % 2;
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1q_lane_f64, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t src[16];
+    int8_t buf;
+    int lane;
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(   0),  INT8_C(   4),  INT8_C(  99),  INT8_C(  56), -INT8_C(  41),  INT8_C(  76), -INT8_C(  29), -INT8_C( 119),
+        -INT8_C(  36), -INT8_C(  78), -INT8_C(  35),  INT8_C(  69),  INT8_C( 116),  INT8_C(  20),  INT8_C( 108),      INT8_MIN },
+       INT8_C( 122),
+       INT32_C(           0),
+      {  INT8_C( 122),  INT8_C(   4),  INT8_C(  99),  INT8_C(  56), -INT8_C(  41),  INT8_C(  76), -INT8_C(  29), -INT8_C( 119),
+        -INT8_C(  36), -INT8_C(  78), -INT8_C(  35),  INT8_C(  69),  INT8_C( 116),  INT8_C(  20),  INT8_C( 108),      INT8_MIN } },
+    { { -INT8_C(   3), -INT8_C( 124),  INT8_C(  50),  INT8_C(  55),  INT8_C(  49),  INT8_C(  95),  INT8_C(  99),  INT8_C( 122),
+        -INT8_C( 115),  INT8_C(   4),  INT8_C(  39), -INT8_C( 110),  INT8_C(  27),  INT8_C(  16),  INT8_C(  14), -INT8_C( 113) },
+       INT8_C(  68),
+       INT32_C(           1),
+      { -INT8_C(   3),  INT8_C(  68),  INT8_C(  50),  INT8_C(  55),  INT8_C(  49),  INT8_C(  95),  INT8_C(  99),  INT8_C( 122),
+        -INT8_C( 115),  INT8_C(   4),  INT8_C(  39), -INT8_C( 110),  INT8_C(  27),  INT8_C(  16),  INT8_C(  14), -INT8_C( 113) } },
+    { {  INT8_C(  15),  INT8_C(  84),  INT8_C(  47),  INT8_C(  64),  INT8_C( 117),  INT8_C(  65), -INT8_C(  62), -INT8_C(  70),
+        -INT8_C(   3),  INT8_C(  57), -INT8_C(  60), -INT8_C(  21), -INT8_C(  47),  INT8_C(  31),  INT8_C( 111),  INT8_C(  88) },
+      -INT8_C( 124),
+       INT32_C(           2),
+      {  INT8_C(  15),  INT8_C(  84), -INT8_C( 124),  INT8_C(  64),  INT8_C( 117),  INT8_C(  65), -INT8_C(  62), -INT8_C(  70),
+        -INT8_C(   3),  INT8_C(  57), -INT8_C(  60), -INT8_C(  21), -INT8_C(  47),  INT8_C(  31),  INT8_C( 111),  INT8_C(  88) } },
+    { { -INT8_C(  59), -INT8_C( 117), -INT8_C(  67), -INT8_C(   8),  INT8_C(  75), -INT8_C(  39), -INT8_C(  55),  INT8_C(   3),
+        -INT8_C(  57), -INT8_C(  80),  INT8_C( 122), -INT8_C(  72), -INT8_C(  45), -INT8_C(  28), -INT8_C(  17), -INT8_C(  18) },
+      -INT8_C(  36),
+       INT32_C(           3),
+      { -INT8_C(  59), -INT8_C( 117), -INT8_C(  67), -INT8_C(  36),  INT8_C(  75), -INT8_C(  39), -INT8_C(  55),  INT8_C(   3),
+        -INT8_C(  57), -INT8_C(  80),  INT8_C( 122), -INT8_C(  72), -INT8_C(  45), -INT8_C(  28), -INT8_C(  17), -INT8_C(  18) } },
+    { {  INT8_C( 101), -INT8_C(  36),  INT8_C( 106), -INT8_C(  53),  INT8_C(  60),  INT8_C(  13),  INT8_C(  49), -INT8_C(  48),
+        -INT8_C(  32), -INT8_C(  47), -INT8_C(  67),  INT8_C(  82), -INT8_C(  44), -INT8_C(  63),  INT8_C(  82),  INT8_C(  12) },
+      -INT8_C(  61),
+       INT32_C(           4),
+      {  INT8_C( 101), -INT8_C(  36),  INT8_C( 106), -INT8_C(  53), -INT8_C(  61),  INT8_C(  13),  INT8_C(  49), -INT8_C(  48),
+        -INT8_C(  32), -INT8_C(  47), -INT8_C(  67),  INT8_C(  82), -INT8_C(  44), -INT8_C(  63),  INT8_C(  82),  INT8_C(  12) } },
+    { {  INT8_C(  64),  INT8_C(   4),  INT8_C( 110),      INT8_MAX, -INT8_C( 101),  INT8_C(  79),  INT8_C(  63),  INT8_C(  76),
+        -INT8_C(  12), -INT8_C(   3),  INT8_C(   2),  INT8_C(   0), -INT8_C(  21), -INT8_C(  12), -INT8_C( 106), -INT8_C(  85) },
+       INT8_C(  46),
+       INT32_C(           5),
+      {  INT8_C(  64),  INT8_C(   4),  INT8_C( 110),      INT8_MAX, -INT8_C( 101),  INT8_C(  46),  INT8_C(  63),  INT8_C(  76),
+        -INT8_C(  12), -INT8_C(   3),  INT8_C(   2),  INT8_C(   0), -INT8_C(  21), -INT8_C(  12), -INT8_C( 106), -INT8_C(  85) } },
+    { { -INT8_C(   2), -INT8_C( 118),  INT8_C( 103),  INT8_C(  21), -INT8_C(  26), -INT8_C(  30), -INT8_C( 115),  INT8_C(  24),
+        -INT8_C( 109), -INT8_C( 127), -INT8_C(  96), -INT8_C(  37),  INT8_C(  66),  INT8_C(  79), -INT8_C( 102), -INT8_C(  83) },
+       INT8_C(  44),
+       INT32_C(           6),
+      { -INT8_C(   2), -INT8_C( 118),  INT8_C( 103),  INT8_C(  21), -INT8_C(  26), -INT8_C(  30),  INT8_C(  44),  INT8_C(  24),
+        -INT8_C( 109), -INT8_C( 127), -INT8_C(  96), -INT8_C(  37),  INT8_C(  66),  INT8_C(  79), -INT8_C( 102), -INT8_C(  83) } },
+    { { -INT8_C( 113),  INT8_C(   8), -INT8_C(  66), -INT8_C(  72), -INT8_C(  18),  INT8_C(   6), -INT8_C( 112), -INT8_C(  21),
+         INT8_C(  77),  INT8_C(  58),  INT8_C(  75), -INT8_C(  23), -INT8_C(   4),  INT8_C(  78),  INT8_C(   1), -INT8_C(  73) },
+       INT8_C(  38),
+       INT32_C(           7),
+      { -INT8_C( 113),  INT8_C(   8), -INT8_C(  66), -INT8_C(  72), -INT8_C(  18),  INT8_C(   6), -INT8_C( 112),  INT8_C(  38),
+         INT8_C(  77),  INT8_C(  58),  INT8_C(  75), -INT8_C(  23), -INT8_C(   4),  INT8_C(  78),  INT8_C(   1), -INT8_C(  73) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t src = simde_vld1q_s8(test_vec[i].src);
+    simde_int8x16_t r;
+    SIMDE_CONSTIFY_16_(simde_vld1q_lane_s8, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i8x16(r, simde_vld1q_s8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x16_t src = simde_test_arm_neon_random_i8x16();
+    int8_t buf = simde_test_codegen_random_i8();
+    int lane = i % 16;
+    simde_int8x16_t r;
+    SIMDE_CONSTIFY_16_(simde_vld1q_lane_s8, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i8x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i8(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t src[8];
+    int16_t buf;
+    int lane;
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 22186), -INT16_C( 12388), -INT16_C( 20014), -INT16_C(  2109),  INT16_C( 11825),  INT16_C( 24379),  INT16_C( 14955),  INT16_C( 32488) },
+       INT16_C( 17484),
+       INT32_C(           0),
+      {  INT16_C( 17484), -INT16_C( 12388), -INT16_C( 20014), -INT16_C(  2109),  INT16_C( 11825),  INT16_C( 24379),  INT16_C( 14955),  INT16_C( 32488) } },
+    { {  INT16_C( 26270), -INT16_C(  1155),  INT16_C( 21541), -INT16_C(  6445),  INT16_C( 21057),  INT16_C( 25341), -INT16_C( 32215), -INT16_C(  2768) },
+       INT16_C(   511),
+       INT32_C(           1),
+      {  INT16_C( 26270),  INT16_C(   511),  INT16_C( 21541), -INT16_C(  6445),  INT16_C( 21057),  INT16_C( 25341), -INT16_C( 32215), -INT16_C(  2768) } },
+    { { -INT16_C(  4270),  INT16_C( 26758),  INT16_C(  9327), -INT16_C( 22344), -INT16_C( 24982), -INT16_C( 25369),  INT16_C( 13914),  INT16_C( 23556) },
+       INT16_C( 22587),
+       INT32_C(           2),
+      { -INT16_C(  4270),  INT16_C( 26758),  INT16_C( 22587), -INT16_C( 22344), -INT16_C( 24982), -INT16_C( 25369),  INT16_C( 13914),  INT16_C( 23556) } },
+    { {  INT16_C( 27825),  INT16_C( 19963),  INT16_C( 30626),  INT16_C( 14673),  INT16_C( 11054), -INT16_C( 27097), -INT16_C( 17125),  INT16_C( 14242) },
+      -INT16_C( 31896),
+       INT32_C(           3),
+      {  INT16_C( 27825),  INT16_C( 19963),  INT16_C( 30626), -INT16_C( 31896),  INT16_C( 11054), -INT16_C( 27097), -INT16_C( 17125),  INT16_C( 14242) } },
+    { {  INT16_C( 21749),  INT16_C(  6230),  INT16_C(  9239),  INT16_C( 28741),  INT16_C( 17519),  INT16_C( 29932), -INT16_C( 14783), -INT16_C( 22415) },
+       INT16_C( 18813),
+       INT32_C(           4),
+      {  INT16_C( 21749),  INT16_C(  6230),  INT16_C(  9239),  INT16_C( 28741),  INT16_C( 18813),  INT16_C( 29932), -INT16_C( 14783), -INT16_C( 22415) } },
+    { { -INT16_C(   419), -INT16_C(  2013), -INT16_C(  4526),  INT16_C(  7255), -INT16_C( 21671),  INT16_C(  1813), -INT16_C( 31804),  INT16_C( 16324) },
+      -INT16_C( 32490),
+       INT32_C(           5),
+      { -INT16_C(   419), -INT16_C(  2013), -INT16_C(  4526),  INT16_C(  7255), -INT16_C( 21671), -INT16_C( 32490), -INT16_C( 31804),  INT16_C( 16324) } },
+    { { -INT16_C( 31801), -INT16_C(  7492),  INT16_C( 20347),  INT16_C( 30149),  INT16_C( 26229), -INT16_C(  2975), -INT16_C( 16516),  INT16_C(  7615) },
+      -INT16_C( 22108),
+       INT32_C(           6),
+      { -INT16_C( 31801), -INT16_C(  7492),  INT16_C( 20347),  INT16_C( 30149),  INT16_C( 26229), -INT16_C(  2975), -INT16_C( 22108),  INT16_C(  7615) } },
+    { { -INT16_C( 23652),  INT16_C( 15814),  INT16_C( 12221), -INT16_C(  7903), -INT16_C( 15364),  INT16_C( 23638),  INT16_C( 19033), -INT16_C( 28125) },
+      -INT16_C(  2277),
+       INT32_C(           7),
+      { -INT16_C( 23652),  INT16_C( 15814),  INT16_C( 12221), -INT16_C(  7903), -INT16_C( 15364),  INT16_C( 23638),  INT16_C( 19033), -INT16_C(  2277) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t src = simde_vld1q_s16(test_vec[i].src);
+    simde_int16x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1q_lane_s16, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i16x8(r, simde_vld1q_s16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t src = simde_test_arm_neon_random_i16x8();
+    int16_t buf = simde_test_codegen_random_i16();
+    int lane = i % 8;
+    simde_int16x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1q_lane_s16, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i16x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i16(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t src[4];
+    int32_t buf;
+    int lane;
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1547215167),  INT32_C(   641388330), -INT32_C(  1044439796), -INT32_C(   226554873) },
+      -INT32_C(  1811291419),
+       INT32_C(           0),
+      { -INT32_C(  1811291419),  INT32_C(   641388330), -INT32_C(  1044439796), -INT32_C(   226554873) } },
+    { { -INT32_C(  1249169738),  INT32_C(  2140308662),  INT32_C(  1786781088),  INT32_C(   741269436) },
+      -INT32_C(   476319106),
+       INT32_C(           1),
+      { -INT32_C(  1249169738), -INT32_C(   476319106),  INT32_C(  1786781088),  INT32_C(   741269436) } },
+    { {  INT32_C(   330816393),  INT32_C(   242704470),  INT32_C(  1121022671),  INT32_C(   589496267) },
+      -INT32_C(   643887181),
+       INT32_C(           2),
+      {  INT32_C(   330816393),  INT32_C(   242704470), -INT32_C(   643887181),  INT32_C(   589496267) } },
+    { { -INT32_C(   482493603), -INT32_C(   320430017),  INT32_C(   417399889),  INT32_C(  1742323101) },
+      -INT32_C(   746460692),
+       INT32_C(           3),
+      { -INT32_C(   482493603), -INT32_C(   320430017),  INT32_C(   417399889), -INT32_C(   746460692) } },
+    { {  INT32_C(   311756617), -INT32_C(  1666616419),  INT32_C(   854228596),  INT32_C(    56607314) },
+      -INT32_C(   277769759),
+       INT32_C(           0),
+      { -INT32_C(   277769759), -INT32_C(  1666616419),  INT32_C(   854228596),  INT32_C(    56607314) } },
+    { {  INT32_C(  1803892348),  INT32_C(   551203297),  INT32_C(   164368942),  INT32_C(  1787801116) },
+      -INT32_C(   640759248),
+       INT32_C(           1),
+      {  INT32_C(  1803892348), -INT32_C(   640759248),  INT32_C(   164368942),  INT32_C(  1787801116) } },
+    { {  INT32_C(   311333216),  INT32_C(   495748874),  INT32_C(  2130708977), -INT32_C(   153751357) },
+       INT32_C(  1480391236),
+       INT32_C(           2),
+      {  INT32_C(   311333216),  INT32_C(   495748874),  INT32_C(  1480391236), -INT32_C(   153751357) } },
+    { { -INT32_C(   455700346), -INT32_C(    70136946), -INT32_C(  1397872496), -INT32_C(    71961852) },
+       INT32_C(  1029045811),
+       INT32_C(           3),
+      { -INT32_C(   455700346), -INT32_C(    70136946), -INT32_C(  1397872496),  INT32_C(  1029045811) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t src = simde_vld1q_s32(test_vec[i].src);
+    simde_int32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1q_lane_s32, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t src = simde_test_arm_neon_random_i32x4();
+    int32_t buf = simde_test_codegen_random_i32();
+    int lane = i % 4;
+    simde_int32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1q_lane_s32, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t src[2];
+    int64_t buf;
+    int lane;
+    int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 5700797767282454936), -INT64_C( 1828856912828336439) },
+       INT64_C( 1999208563653893260),
+       INT32_C(           0),
+      {  INT64_C( 1999208563653893260), -INT64_C( 1828856912828336439) } },
+    { {  INT64_C( 7636412709942606463), -INT64_C( 6330562021812514434) },
+       INT64_C( 3840702718511905969),
+       INT32_C(           1),
+      {  INT64_C( 7636412709942606463),  INT64_C( 3840702718511905969) } },
+    { { -INT64_C( 7710534501208712193),  INT64_C( 8012517096325716724) },
+      -INT64_C( 3691387662700217997),
+       INT32_C(           0),
+      { -INT64_C( 3691387662700217997),  INT64_C( 8012517096325716724) } },
+    { {  INT64_C( 6263706923610202081),  INT64_C( 1461127527142604147) },
+      -INT64_C( 7025996778114762393),
+       INT32_C(           1),
+      {  INT64_C( 6263706923610202081), -INT64_C( 7025996778114762393) } },
+    { {  INT64_C( 3794768658395144354),  INT64_C( 7438759649489098162) },
+       INT64_C( 4233992793296992272),
+       INT32_C(           0),
+      {  INT64_C( 4233992793296992272),  INT64_C( 7438759649489098162) } },
+    { {  INT64_C( 7192377041045740804),  INT64_C( 6965866649044280753) },
+       INT64_C( 5792182775426978936),
+       INT32_C(           1),
+      {  INT64_C( 7192377041045740804),  INT64_C( 5792182775426978936) } },
+    { { -INT64_C( 7099524887648727821), -INT64_C( 7734427686995297201) },
+       INT64_C( 6138593229428322402),
+       INT32_C(           0),
+      {  INT64_C( 6138593229428322402), -INT64_C( 7734427686995297201) } },
+    { {  INT64_C( 9126786961711655495), -INT64_C( 4393297116898000860) },
+       INT64_C(  958187599470522799),
+       INT32_C(           1),
+      {  INT64_C( 9126786961711655495),  INT64_C(  958187599470522799) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t src = simde_vld1q_s64(test_vec[i].src);
+    simde_int64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1q_lane_s64, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t src = simde_test_arm_neon_random_i64x2();
+    int64_t buf = simde_test_codegen_random_i64();
+    int lane = i % 2;
+    simde_int64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1q_lane_s64, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_i64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t src[16];
+    uint8_t buf;
+    int lane;
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C(120), UINT8_C(178), UINT8_C(116), UINT8_C(195), UINT8_C( 53), UINT8_C(215), UINT8_C(146), UINT8_C(237),
+        UINT8_C(219), UINT8_C(206), UINT8_C( 65), UINT8_C(235), UINT8_C(106), UINT8_C( 41), UINT8_C( 95), UINT8_C( 20) },
+      UINT8_C( 75),
+       INT32_C(           0),
+      { UINT8_C( 75), UINT8_C(178), UINT8_C(116), UINT8_C(195), UINT8_C( 53), UINT8_C(215), UINT8_C(146), UINT8_C(237),
+        UINT8_C(219), UINT8_C(206), UINT8_C( 65), UINT8_C(235), UINT8_C(106), UINT8_C( 41), UINT8_C( 95), UINT8_C( 20) } },
+    { { UINT8_C(168), UINT8_C(237), UINT8_C(169), UINT8_C(186), UINT8_C(206), UINT8_C( 22), UINT8_C( 14), UINT8_C(132),
+        UINT8_C( 88), UINT8_C( 89), UINT8_C(191), UINT8_C( 93), UINT8_C(202), UINT8_C( 28), UINT8_C( 96), UINT8_C(154) },
+      UINT8_C(245),
+       INT32_C(           1),
+      { UINT8_C(168), UINT8_C(245), UINT8_C(169), UINT8_C(186), UINT8_C(206), UINT8_C( 22), UINT8_C( 14), UINT8_C(132),
+        UINT8_C( 88), UINT8_C( 89), UINT8_C(191), UINT8_C( 93), UINT8_C(202), UINT8_C( 28), UINT8_C( 96), UINT8_C(154) } },
+    { { UINT8_C( 92), UINT8_C(171), UINT8_C(173), UINT8_C( 99), UINT8_C( 30), UINT8_C(169), UINT8_C(132), UINT8_C(117),
+        UINT8_C(113), UINT8_C( 33), UINT8_C(163), UINT8_C(184), UINT8_C( 16), UINT8_C( 55), UINT8_C(201), UINT8_C(191) },
+      UINT8_C(134),
+       INT32_C(           2),
+      { UINT8_C( 92), UINT8_C(171), UINT8_C(134), UINT8_C( 99), UINT8_C( 30), UINT8_C(169), UINT8_C(132), UINT8_C(117),
+        UINT8_C(113), UINT8_C( 33), UINT8_C(163), UINT8_C(184), UINT8_C( 16), UINT8_C( 55), UINT8_C(201), UINT8_C(191) } },
+    { { UINT8_C(150), UINT8_C( 64), UINT8_C( 23), UINT8_C( 42), UINT8_C(173), UINT8_C(208), UINT8_C(200), UINT8_C(  3),
+        UINT8_C( 69), UINT8_C(150), UINT8_C( 94), UINT8_C( 78), UINT8_C( 66), UINT8_C( 87), UINT8_C(133), UINT8_C(247) },
+      UINT8_C( 13),
+       INT32_C(           3),
+      { UINT8_C(150), UINT8_C( 64), UINT8_C( 23), UINT8_C( 13), UINT8_C(173), UINT8_C(208), UINT8_C(200), UINT8_C(  3),
+        UINT8_C( 69), UINT8_C(150), UINT8_C( 94), UINT8_C( 78), UINT8_C( 66), UINT8_C( 87), UINT8_C(133), UINT8_C(247) } },
+    { { UINT8_C( 35), UINT8_C( 19), UINT8_C( 47), UINT8_C(163), UINT8_C(  2), UINT8_C(112), UINT8_C( 93), UINT8_C(214),
+        UINT8_C( 19), UINT8_C( 89), UINT8_C( 11), UINT8_C( 72), UINT8_C(174), UINT8_C(208), UINT8_C(241), UINT8_C(153) },
+      UINT8_C( 43),
+       INT32_C(           4),
+      { UINT8_C( 35), UINT8_C( 19), UINT8_C( 47), UINT8_C(163), UINT8_C( 43), UINT8_C(112), UINT8_C( 93), UINT8_C(214),
+        UINT8_C( 19), UINT8_C( 89), UINT8_C( 11), UINT8_C( 72), UINT8_C(174), UINT8_C(208), UINT8_C(241), UINT8_C(153) } },
+    { { UINT8_C( 76), UINT8_C(153), UINT8_C(116), UINT8_C(246), UINT8_C(  4), UINT8_C( 45), UINT8_C( 50), UINT8_C( 39),
+        UINT8_C(234), UINT8_C(129), UINT8_C(139), UINT8_C( 13), UINT8_C(137), UINT8_C(148), UINT8_C( 94), UINT8_C(213) },
+      UINT8_C(247),
+       INT32_C(           5),
+      { UINT8_C( 76), UINT8_C(153), UINT8_C(116), UINT8_C(246), UINT8_C(  4), UINT8_C(247), UINT8_C( 50), UINT8_C( 39),
+        UINT8_C(234), UINT8_C(129), UINT8_C(139), UINT8_C( 13), UINT8_C(137), UINT8_C(148), UINT8_C( 94), UINT8_C(213) } },
+    { { UINT8_C(225), UINT8_C( 90), UINT8_C( 29), UINT8_C(153), UINT8_C(142), UINT8_C( 88), UINT8_C(129), UINT8_C( 32),
+        UINT8_C(115), UINT8_C( 64), UINT8_C( 47), UINT8_C( 40), UINT8_C(155), UINT8_C( 36), UINT8_C( 38), UINT8_C(190) },
+      UINT8_C(174),
+       INT32_C(           6),
+      { UINT8_C(225), UINT8_C( 90), UINT8_C( 29), UINT8_C(153), UINT8_C(142), UINT8_C( 88), UINT8_C(174), UINT8_C( 32),
+        UINT8_C(115), UINT8_C( 64), UINT8_C( 47), UINT8_C( 40), UINT8_C(155), UINT8_C( 36), UINT8_C( 38), UINT8_C(190) } },
+    { { UINT8_C( 77), UINT8_C( 22), UINT8_C( 58), UINT8_C(  0), UINT8_C(123), UINT8_C(218), UINT8_C(201), UINT8_C( 86),
+        UINT8_C( 78), UINT8_C(104), UINT8_C(115), UINT8_C(131), UINT8_C(235), UINT8_C(122), UINT8_C( 89), UINT8_C(  4) },
+      UINT8_C( 81),
+       INT32_C(           7),
+      { UINT8_C( 77), UINT8_C( 22), UINT8_C( 58), UINT8_C(  0), UINT8_C(123), UINT8_C(218), UINT8_C(201), UINT8_C( 81),
+        UINT8_C( 78), UINT8_C(104), UINT8_C(115), UINT8_C(131), UINT8_C(235), UINT8_C(122), UINT8_C( 89), UINT8_C(  4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t src = simde_vld1q_u8(test_vec[i].src);
+    simde_uint8x16_t r;
+    SIMDE_CONSTIFY_16_(simde_vld1q_lane_u8, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u8x16(r, simde_vld1q_u8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x16_t src = simde_test_arm_neon_random_u8x16();
+    uint8_t buf = simde_test_codegen_random_u8();
+    int lane = i % 16;
+    simde_uint8x16_t r;
+    SIMDE_CONSTIFY_16_(simde_vld1q_lane_u8, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u8x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u8(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t src[8];
+    uint16_t buf;
+    int lane;
+    uint16_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(53660), UINT16_C(20328), UINT16_C(64115), UINT16_C( 9854), UINT16_C(19887), UINT16_C(26391), UINT16_C(18768), UINT16_C(27828) },
+      UINT16_C(18216),
+       INT32_C(           0),
+      { UINT16_C(18216), UINT16_C(20328), UINT16_C(64115), UINT16_C( 9854), UINT16_C(19887), UINT16_C(26391), UINT16_C(18768), UINT16_C(27828) } },
+    { { UINT16_C(28415), UINT16_C(43268), UINT16_C(22896), UINT16_C(34549), UINT16_C( 9023), UINT16_C(36635), UINT16_C(36178), UINT16_C(40060) },
+      UINT16_C(  521),
+       INT32_C(           1),
+      { UINT16_C(28415), UINT16_C(  521), UINT16_C(22896), UINT16_C(34549), UINT16_C( 9023), UINT16_C(36635), UINT16_C(36178), UINT16_C(40060) } },
+    { { UINT16_C(17002), UINT16_C(28914), UINT16_C(34071), UINT16_C(56922), UINT16_C(34893), UINT16_C(57975), UINT16_C(41033), UINT16_C(  661) },
+      UINT16_C(41930),
+       INT32_C(           2),
+      { UINT16_C(17002), UINT16_C(28914), UINT16_C(41930), UINT16_C(56922), UINT16_C(34893), UINT16_C(57975), UINT16_C(41033), UINT16_C(  661) } },
+    { { UINT16_C(14403), UINT16_C(64307), UINT16_C(31116), UINT16_C( 8633), UINT16_C(28245), UINT16_C(33455), UINT16_C(49496), UINT16_C(38861) },
+      UINT16_C(24949),
+       INT32_C(           3),
+      { UINT16_C(14403), UINT16_C(64307), UINT16_C(31116), UINT16_C(24949), UINT16_C(28245), UINT16_C(33455), UINT16_C(49496), UINT16_C(38861) } },
+    { { UINT16_C(10561), UINT16_C(54611), UINT16_C(24283), UINT16_C(58244), UINT16_C(16104), UINT16_C(  747), UINT16_C(35656), UINT16_C(42865) },
+      UINT16_C(46042),
+       INT32_C(           4),
+      { UINT16_C(10561), UINT16_C(54611), UINT16_C(24283), UINT16_C(58244), UINT16_C(46042), UINT16_C(  747), UINT16_C(35656), UINT16_C(42865) } },
+    { { UINT16_C(28986), UINT16_C(17379), UINT16_C(42020), UINT16_C(30306), UINT16_C( 3821), UINT16_C(13554), UINT16_C(42668), UINT16_C(26841) },
+      UINT16_C(38019),
+       INT32_C(           5),
+      { UINT16_C(28986), UINT16_C(17379), UINT16_C(42020), UINT16_C(30306), UINT16_C( 3821), UINT16_C(38019), UINT16_C(42668), UINT16_C(26841) } },
+    { { UINT16_C(64913), UINT16_C(23834), UINT16_C(58154), UINT16_C(40571), UINT16_C(23721), UINT16_C(12439), UINT16_C(22331), UINT16_C(27775) },
+      UINT16_C(11922),
+       INT32_C(           6),
+      { UINT16_C(64913), UINT16_C(23834), UINT16_C(58154), UINT16_C(40571), UINT16_C(23721), UINT16_C(12439), UINT16_C(11922), UINT16_C(27775) } },
+    { { UINT16_C(58250), UINT16_C(57817), UINT16_C(11044), UINT16_C(60688), UINT16_C(39547), UINT16_C( 3024), UINT16_C(11135), UINT16_C(29328) },
+      UINT16_C(10169),
+       INT32_C(           7),
+      { UINT16_C(58250), UINT16_C(57817), UINT16_C(11044), UINT16_C(60688), UINT16_C(39547), UINT16_C( 3024), UINT16_C(11135), UINT16_C(10169) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t src = simde_vld1q_u16(test_vec[i].src);
+    simde_uint16x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1q_lane_u16, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u16x8(r, simde_vld1q_u16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t src = simde_test_arm_neon_random_u16x8();
+    uint16_t buf = simde_test_codegen_random_u16();
+    int lane = i % 8;
+    simde_uint16x8_t r;
+    SIMDE_CONSTIFY_8_(simde_vld1q_lane_u16, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u16x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t src[4];
+    uint32_t buf;
+    int lane;
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1717965362), UINT32_C(1198067959), UINT32_C(1027061857), UINT32_C(2562820142) },
+      UINT32_C(2855178404),
+       INT32_C(           0),
+      { UINT32_C(2855178404), UINT32_C(1198067959), UINT32_C(1027061857), UINT32_C(2562820142) } },
+    { { UINT32_C(1762284599), UINT32_C(3551738699), UINT32_C(1908667600), UINT32_C(1581278853) },
+      UINT32_C( 244879401),
+       INT32_C(           1),
+      { UINT32_C(1762284599), UINT32_C( 244879401), UINT32_C(1908667600), UINT32_C(1581278853) } },
+    { { UINT32_C(4215938738), UINT32_C(3400786872), UINT32_C(2615135775), UINT32_C( 432385033) },
+      UINT32_C(1039825353),
+       INT32_C(           2),
+      { UINT32_C(4215938738), UINT32_C(3400786872), UINT32_C(1039825353), UINT32_C( 432385033) } },
+    { { UINT32_C(2471786886), UINT32_C(2938416499), UINT32_C(3781670903), UINT32_C( 572534551) },
+      UINT32_C(1784529968),
+       INT32_C(           3),
+      { UINT32_C(2471786886), UINT32_C(2938416499), UINT32_C(3781670903), UINT32_C(1784529968) } },
+    { { UINT32_C(1773194678), UINT32_C(2465140117), UINT32_C(2487566309), UINT32_C( 622276000) },
+      UINT32_C( 792687850),
+       INT32_C(           0),
+      { UINT32_C( 792687850), UINT32_C(2465140117), UINT32_C(2487566309), UINT32_C( 622276000) } },
+    { { UINT32_C(1886584531), UINT32_C( 458180104), UINT32_C( 501156088), UINT32_C(1628873853) },
+      UINT32_C(2612854957),
+       INT32_C(           1),
+      { UINT32_C(1886584531), UINT32_C(2612854957), UINT32_C( 501156088), UINT32_C(1628873853) } },
+    { { UINT32_C(3680456189), UINT32_C(3866645114), UINT32_C( 874043040), UINT32_C(1821225763) },
+      UINT32_C(2028983171),
+       INT32_C(           2),
+      { UINT32_C(3680456189), UINT32_C(3866645114), UINT32_C(2028983171), UINT32_C(1821225763) } },
+    { { UINT32_C(3600580294), UINT32_C(2620494461), UINT32_C(4129006490), UINT32_C( 797928616) },
+      UINT32_C(2729674028),
+       INT32_C(           3),
+      { UINT32_C(3600580294), UINT32_C(2620494461), UINT32_C(4129006490), UINT32_C(2729674028) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t src = simde_vld1q_u32(test_vec[i].src);
+    simde_uint32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1q_lane_u32, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t src = simde_test_arm_neon_random_u32x4();
+    uint32_t buf = simde_test_codegen_random_u32();
+    int lane = i % 4;
+    simde_uint32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vld1q_lane_u32, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t src[2];
+    uint64_t buf;
+    int lane;
+    uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 3394748324233838182), UINT64_C( 3807103244471103463) },
+      UINT64_C(10363009808011644601),
+       INT32_C(           0),
+      { UINT64_C(10363009808011644601), UINT64_C( 3807103244471103463) } },
+    { { UINT64_C(13193501806082754224), UINT64_C( 3107646838368975441) },
+      UINT64_C( 1496173774807484836),
+       INT32_C(           1),
+      { UINT64_C(13193501806082754224), UINT64_C( 1496173774807484836) } },
+    { { UINT64_C(18062535125265576762), UINT64_C(16393334577685095021) },
+      UINT64_C( 1341177815585506523),
+       INT32_C(           0),
+      { UINT64_C( 1341177815585506523), UINT64_C(16393334577685095021) } },
+    { { UINT64_C(10214842926715737363), UINT64_C( 9876713028513914937) },
+      UINT64_C( 1312578782024641720),
+       INT32_C(           1),
+      { UINT64_C(10214842926715737363), UINT64_C( 1312578782024641720) } },
+    { { UINT64_C( 8253944929454086921), UINT64_C(16873494626213943220) },
+      UINT64_C( 8887956651076892707),
+       INT32_C(           0),
+      { UINT64_C( 8887956651076892707), UINT64_C(16873494626213943220) } },
+    { { UINT64_C(15739446636971644494), UINT64_C(14745551248836205015) },
+      UINT64_C(  323225577427297592),
+       INT32_C(           1),
+      { UINT64_C(15739446636971644494), UINT64_C(  323225577427297592) } },
+    { { UINT64_C( 7820486434778556770), UINT64_C(12597439116430632882) },
+      UINT64_C( 2002802840463275901),
+       INT32_C(           0),
+      { UINT64_C( 2002802840463275901), UINT64_C(12597439116430632882) } },
+    { { UINT64_C(17553699954494906306), UINT64_C(15625280231129172180) },
+      UINT64_C( 7962532922184436279),
+       INT32_C(           1),
+      { UINT64_C(17553699954494906306), UINT64_C( 7962532922184436279) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t src = simde_vld1q_u64(test_vec[i].src);
+    simde_uint64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1q_lane_u64, r, (HEDLEY_UNREACHABLE(), src), test_vec[i].lane, &test_vec[i].buf, src);
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t src = simde_test_arm_neon_random_u64x2();
+    uint64_t buf = simde_test_codegen_random_u64();
+    int lane = i % 2;
+    simde_uint64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld1q_lane_u64, r, (HEDLEY_UNREACHABLE(), src), lane, &buf, src);
+
+    simde_test_arm_neon_write_u64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, buf, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lane, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_lane_u64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_lane_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
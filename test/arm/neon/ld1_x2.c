@@ -0,0 +1,1230 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld1_x2
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld1_x2.h"
+
+static int
+test_simde_vld1_f32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[2][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   232.41), SIMDE_FLOAT32_C(  -931.15), SIMDE_FLOAT32_C(   -41.35), SIMDE_FLOAT32_C(  -296.51) },
+      { { SIMDE_FLOAT32_C(   232.41), SIMDE_FLOAT32_C(  -931.15) },
+        { SIMDE_FLOAT32_C(   -41.35), SIMDE_FLOAT32_C(  -296.51) } } },
+    { { SIMDE_FLOAT32_C(   -33.45), SIMDE_FLOAT32_C(  -185.72), SIMDE_FLOAT32_C(   327.52), SIMDE_FLOAT32_C(   299.99) },
+      { { SIMDE_FLOAT32_C(   -33.45), SIMDE_FLOAT32_C(  -185.72) },
+        { SIMDE_FLOAT32_C(   327.52), SIMDE_FLOAT32_C(   299.99) } } },
+    { { SIMDE_FLOAT32_C(  -997.72), SIMDE_FLOAT32_C(    46.42), SIMDE_FLOAT32_C(  -168.96), SIMDE_FLOAT32_C(  -256.06) },
+      { { SIMDE_FLOAT32_C(  -997.72), SIMDE_FLOAT32_C(    46.42) },
+        { SIMDE_FLOAT32_C(  -168.96), SIMDE_FLOAT32_C(  -256.06) } } },
+    { { SIMDE_FLOAT32_C(  -628.35), SIMDE_FLOAT32_C(   617.94), SIMDE_FLOAT32_C(  -642.24), SIMDE_FLOAT32_C(  -482.37) },
+      { { SIMDE_FLOAT32_C(  -628.35), SIMDE_FLOAT32_C(   617.94) },
+        { SIMDE_FLOAT32_C(  -642.24), SIMDE_FLOAT32_C(  -482.37) } } },
+    { { SIMDE_FLOAT32_C(  -345.61), SIMDE_FLOAT32_C(   826.19), SIMDE_FLOAT32_C(   -40.81), SIMDE_FLOAT32_C(  -689.11) },
+      { { SIMDE_FLOAT32_C(  -345.61), SIMDE_FLOAT32_C(   826.19) },
+        { SIMDE_FLOAT32_C(   -40.81), SIMDE_FLOAT32_C(  -689.11) } } },
+    { { SIMDE_FLOAT32_C(  -574.51), SIMDE_FLOAT32_C(  -385.53), SIMDE_FLOAT32_C(   643.85), SIMDE_FLOAT32_C(  -992.33) },
+      { { SIMDE_FLOAT32_C(  -574.51), SIMDE_FLOAT32_C(  -385.53) },
+        { SIMDE_FLOAT32_C(   643.85), SIMDE_FLOAT32_C(  -992.33) } } },
+    { { SIMDE_FLOAT32_C(  -515.34), SIMDE_FLOAT32_C(   445.30), SIMDE_FLOAT32_C(  -828.35), SIMDE_FLOAT32_C(   171.15) },
+      { { SIMDE_FLOAT32_C(  -515.34), SIMDE_FLOAT32_C(   445.30) },
+        { SIMDE_FLOAT32_C(  -828.35), SIMDE_FLOAT32_C(   171.15) } } },
+    { { SIMDE_FLOAT32_C(   678.20), SIMDE_FLOAT32_C(   -79.88), SIMDE_FLOAT32_C(   392.30), SIMDE_FLOAT32_C(   122.58) },
+      { { SIMDE_FLOAT32_C(   678.20), SIMDE_FLOAT32_C(   -79.88) },
+        { SIMDE_FLOAT32_C(   392.30), SIMDE_FLOAT32_C(   122.58) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t r = simde_vld1_f32_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a[4];
+    simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, -1000.0f, 1000.0f);
+    simde_float32x2x2_t r = simde_vld1_f32_x2(a);
+
+    simde_test_codegen_write_vf32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_f64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   764.08), SIMDE_FLOAT64_C(   938.42) },
+      { { SIMDE_FLOAT64_C(   764.08) },
+        { SIMDE_FLOAT64_C(   938.42) } } },
+    { { SIMDE_FLOAT64_C(   184.04), SIMDE_FLOAT64_C(   447.62) },
+      { { SIMDE_FLOAT64_C(   184.04) },
+        { SIMDE_FLOAT64_C(   447.62) } } },
+    { { SIMDE_FLOAT64_C(   409.30), SIMDE_FLOAT64_C(   655.35) },
+      { { SIMDE_FLOAT64_C(   409.30) },
+        { SIMDE_FLOAT64_C(   655.35) } } },
+    { { SIMDE_FLOAT64_C(  -186.37), SIMDE_FLOAT64_C(   297.40) },
+      { { SIMDE_FLOAT64_C(  -186.37) },
+        { SIMDE_FLOAT64_C(   297.40) } } },
+    { { SIMDE_FLOAT64_C(  -170.49), SIMDE_FLOAT64_C(   714.91) },
+      { { SIMDE_FLOAT64_C(  -170.49) },
+        { SIMDE_FLOAT64_C(   714.91) } } },
+    { { SIMDE_FLOAT64_C(   637.68), SIMDE_FLOAT64_C(  -335.51) },
+      { { SIMDE_FLOAT64_C(   637.68) },
+        { SIMDE_FLOAT64_C(  -335.51) } } },
+    { { SIMDE_FLOAT64_C(    85.78), SIMDE_FLOAT64_C(   973.42) },
+      { { SIMDE_FLOAT64_C(    85.78) },
+        { SIMDE_FLOAT64_C(   973.42) } } },
+    { { SIMDE_FLOAT64_C(   468.30), SIMDE_FLOAT64_C(  -553.27) },
+      { { SIMDE_FLOAT64_C(   468.30) },
+        { SIMDE_FLOAT64_C(  -553.27) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t r = simde_vld1_f64_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a[2];
+    simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, -1000.0, 1000.0);
+    simde_float64x1x2_t r = simde_vld1_f64_x2(a);
+
+    simde_test_codegen_write_vf64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t r[2][8];
+  } test_vec[] = {
+    { {  INT8_C( 122), -INT8_C(  93),  INT8_C(  20),  INT8_C(  72),  INT8_C(  68), -INT8_C( 110), -INT8_C(  51), -INT8_C(  73),
+         INT8_C(  45), -INT8_C(  34), -INT8_C(  99),  INT8_C(  88), -INT8_C(  62),  INT8_C(  20), -INT8_C(  12), -INT8_C(  99) },
+      { {  INT8_C( 122), -INT8_C(  93),  INT8_C(  20),  INT8_C(  72),  INT8_C(  68), -INT8_C( 110), -INT8_C(  51), -INT8_C(  73) },
+        {  INT8_C(  45), -INT8_C(  34), -INT8_C(  99),  INT8_C(  88), -INT8_C(  62),  INT8_C(  20), -INT8_C(  12), -INT8_C(  99) } } },
+    { {  INT8_C( 109),  INT8_C(  43),  INT8_C(  14), -INT8_C( 110),  INT8_C( 107),  INT8_C( 109), -INT8_C(  90), -INT8_C(  77),
+        -INT8_C(  62), -INT8_C(  50), -INT8_C(  37), -INT8_C(  17),  INT8_C(  16),  INT8_C(   9),  INT8_C( 111),  INT8_C(  50) },
+      { {  INT8_C( 109),  INT8_C(  43),  INT8_C(  14), -INT8_C( 110),  INT8_C( 107),  INT8_C( 109), -INT8_C(  90), -INT8_C(  77) },
+        { -INT8_C(  62), -INT8_C(  50), -INT8_C(  37), -INT8_C(  17),  INT8_C(  16),  INT8_C(   9),  INT8_C( 111),  INT8_C(  50) } } },
+    { { -INT8_C(  70),  INT8_C(  71),  INT8_C(  69), -INT8_C( 108), -INT8_C(  49), -INT8_C( 112), -INT8_C(   5),  INT8_C(  17),
+         INT8_C(  84),  INT8_C(  32), -INT8_C( 101), -INT8_C(   7),  INT8_C(  11),  INT8_C(  43), -INT8_C(  85), -INT8_C(   8) },
+      { { -INT8_C(  70),  INT8_C(  71),  INT8_C(  69), -INT8_C( 108), -INT8_C(  49), -INT8_C( 112), -INT8_C(   5),  INT8_C(  17) },
+        {  INT8_C(  84),  INT8_C(  32), -INT8_C( 101), -INT8_C(   7),  INT8_C(  11),  INT8_C(  43), -INT8_C(  85), -INT8_C(   8) } } },
+    { { -INT8_C(  13),  INT8_C(  99), -INT8_C(  58), -INT8_C(  92),  INT8_C(  83),  INT8_C(  31), -INT8_C(  19),  INT8_C( 113),
+         INT8_C(   0), -INT8_C(  41), -INT8_C( 112),  INT8_C( 126),  INT8_C(  15), -INT8_C(  49),  INT8_C( 105), -INT8_C( 110) },
+      { { -INT8_C(  13),  INT8_C(  99), -INT8_C(  58), -INT8_C(  92),  INT8_C(  83),  INT8_C(  31), -INT8_C(  19),  INT8_C( 113) },
+        {  INT8_C(   0), -INT8_C(  41), -INT8_C( 112),  INT8_C( 126),  INT8_C(  15), -INT8_C(  49),  INT8_C( 105), -INT8_C( 110) } } },
+    { {  INT8_C(  69),  INT8_C(  82),  INT8_C(  31),  INT8_C( 125), -INT8_C(  32),  INT8_C(  82), -INT8_C(  49),  INT8_C(  82),
+        -INT8_C( 120), -INT8_C(  26),  INT8_C(  41),  INT8_C( 109), -INT8_C( 126),  INT8_C(  17),  INT8_C(  57),  INT8_C(  85) },
+      { {  INT8_C(  69),  INT8_C(  82),  INT8_C(  31),  INT8_C( 125), -INT8_C(  32),  INT8_C(  82), -INT8_C(  49),  INT8_C(  82) },
+        { -INT8_C( 120), -INT8_C(  26),  INT8_C(  41),  INT8_C( 109), -INT8_C( 126),  INT8_C(  17),  INT8_C(  57),  INT8_C(  85) } } },
+    { { -INT8_C( 116), -INT8_C( 121), -INT8_C(  84),  INT8_C(  37), -INT8_C(  15), -INT8_C(  17),  INT8_C(  63), -INT8_C( 107),
+         INT8_C(  68), -INT8_C(  84),  INT8_C(  47),  INT8_C(  89), -INT8_C(  15), -INT8_C(  38), -INT8_C(  51), -INT8_C(   8) },
+      { { -INT8_C( 116), -INT8_C( 121), -INT8_C(  84),  INT8_C(  37), -INT8_C(  15), -INT8_C(  17),  INT8_C(  63), -INT8_C( 107) },
+        {  INT8_C(  68), -INT8_C(  84),  INT8_C(  47),  INT8_C(  89), -INT8_C(  15), -INT8_C(  38), -INT8_C(  51), -INT8_C(   8) } } },
+    { {  INT8_C(  89), -INT8_C( 121),  INT8_C( 110), -INT8_C( 102), -INT8_C(  46), -INT8_C(  46), -INT8_C( 107),  INT8_C(  95),
+        -INT8_C( 106), -INT8_C(  13),  INT8_C( 104),  INT8_C(  72), -INT8_C( 105),  INT8_C(  95),  INT8_C(   0),  INT8_C( 100) },
+      { {  INT8_C(  89), -INT8_C( 121),  INT8_C( 110), -INT8_C( 102), -INT8_C(  46), -INT8_C(  46), -INT8_C( 107),  INT8_C(  95) },
+        { -INT8_C( 106), -INT8_C(  13),  INT8_C( 104),  INT8_C(  72), -INT8_C( 105),  INT8_C(  95),  INT8_C(   0),  INT8_C( 100) } } },
+    { {  INT8_C(  44), -INT8_C( 117), -INT8_C(  42),  INT8_C(  51), -INT8_C(  20), -INT8_C(  40), -INT8_C( 113), -INT8_C(  72),
+        -INT8_C(  88),  INT8_C(  83),  INT8_C( 111),  INT8_C(  65),  INT8_C(  92),  INT8_C(  82), -INT8_C( 107),  INT8_C(  75) },
+      { {  INT8_C(  44), -INT8_C( 117), -INT8_C(  42),  INT8_C(  51), -INT8_C(  20), -INT8_C(  40), -INT8_C( 113), -INT8_C(  72) },
+        { -INT8_C(  88),  INT8_C(  83),  INT8_C( 111),  INT8_C(  65),  INT8_C(  92),  INT8_C(  82), -INT8_C( 107),  INT8_C(  75) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t r = simde_vld1_s8_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int8x8x2_t r = simde_vld1_s8_x2(a);
+
+    simde_test_codegen_write_vi8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t r[2][4];
+  } test_vec[] = {
+    { { -INT16_C( 14312), -INT16_C( 15946), -INT16_C(  6011), -INT16_C( 12673),  INT16_C( 16666),  INT16_C( 25968),  INT16_C( 29835), -INT16_C( 17021) },
+      { { -INT16_C( 14312), -INT16_C( 15946), -INT16_C(  6011), -INT16_C( 12673) },
+        {  INT16_C( 16666),  INT16_C( 25968),  INT16_C( 29835), -INT16_C( 17021) } } },
+    { {  INT16_C( 28870),  INT16_C( 28818), -INT16_C( 16518), -INT16_C( 21304), -INT16_C(  8389),  INT16_C( 13458), -INT16_C(  1798), -INT16_C( 19109) },
+      { {  INT16_C( 28870),  INT16_C( 28818), -INT16_C( 16518), -INT16_C( 21304) },
+        { -INT16_C(  8389),  INT16_C( 13458), -INT16_C(  1798), -INT16_C( 19109) } } },
+    { { -INT16_C( 21657), -INT16_C( 22933), -INT16_C( 25983),  INT16_C(  8727),  INT16_C(  7361),  INT16_C( 26945),  INT16_C(  3944), -INT16_C( 17003) },
+      { { -INT16_C( 21657), -INT16_C( 22933), -INT16_C( 25983),  INT16_C(  8727) },
+        {  INT16_C(  7361),  INT16_C( 26945),  INT16_C(  3944), -INT16_C( 17003) } } },
+    { {  INT16_C(  1408), -INT16_C( 27450), -INT16_C( 24905), -INT16_C( 28738), -INT16_C( 27740), -INT16_C( 11928),  INT16_C(  2518),  INT16_C( 10586) },
+      { {  INT16_C(  1408), -INT16_C( 27450), -INT16_C( 24905), -INT16_C( 28738) },
+        { -INT16_C( 27740), -INT16_C( 11928),  INT16_C(  2518),  INT16_C( 10586) } } },
+    { { -INT16_C(  7629),  INT16_C(  9429), -INT16_C( 20295), -INT16_C(  8665), -INT16_C( 20410),  INT16_C(  8540),  INT16_C( 16278), -INT16_C( 20522) },
+      { { -INT16_C(  7629),  INT16_C(  9429), -INT16_C( 20295), -INT16_C(  8665) },
+        { -INT16_C( 20410),  INT16_C(  8540),  INT16_C( 16278), -INT16_C( 20522) } } },
+    { {  INT16_C( 19873),  INT16_C( 20577), -INT16_C( 29246),  INT16_C( 23540),  INT16_C( 21859), -INT16_C( 16864), -INT16_C( 30018),  INT16_C( 20834) },
+      { {  INT16_C( 19873),  INT16_C( 20577), -INT16_C( 29246),  INT16_C( 23540) },
+        {  INT16_C( 21859), -INT16_C( 16864), -INT16_C( 30018),  INT16_C( 20834) } } },
+    { { -INT16_C( 22705), -INT16_C(  1145), -INT16_C( 26172), -INT16_C( 25086),  INT16_C( 21289),  INT16_C( 21664), -INT16_C(   390),  INT16_C( 17747) },
+      { { -INT16_C( 22705), -INT16_C(  1145), -INT16_C( 26172), -INT16_C( 25086) },
+        {  INT16_C( 21289),  INT16_C( 21664), -INT16_C(   390),  INT16_C( 17747) } } },
+    { {  INT16_C( 16712), -INT16_C(  2330), -INT16_C( 28901), -INT16_C( 10312),  INT16_C( 25068),  INT16_C(  5196),  INT16_C(  2372), -INT16_C(  6380) },
+      { {  INT16_C( 16712), -INT16_C(  2330), -INT16_C( 28901), -INT16_C( 10312) },
+        {  INT16_C( 25068),  INT16_C(  5196),  INT16_C(  2372), -INT16_C(  6380) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t r = simde_vld1_s16_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int16x4x2_t r = simde_vld1_s16_x2(a);
+
+    simde_test_codegen_write_vi16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t r[2][2];
+  } test_vec[] = {
+    { {  INT32_C(  1514720853),  INT32_C(   736548877), -INT32_C(  1484798723),  INT32_C(  1424487291) },
+      { {  INT32_C(  1514720853),  INT32_C(   736548877) },
+        { -INT32_C(  1484798723),  INT32_C(  1424487291) } } },
+    { { -INT32_C(   559661179), -INT32_C(   623446206),  INT32_C(  1703255455), -INT32_C(  1641381413) },
+      { { -INT32_C(   559661179), -INT32_C(   623446206) },
+        {  INT32_C(  1703255455), -INT32_C(  1641381413) } } },
+    { {  INT32_C(   682854313),  INT32_C(   790540089), -INT32_C(  1573700186),  INT32_C(   326558690) },
+      { {  INT32_C(   682854313),  INT32_C(   790540089) },
+        { -INT32_C(  1573700186),  INT32_C(   326558690) } } },
+    { {  INT32_C(   208836084),  INT32_C(  1165866619), -INT32_C(  2078798656), -INT32_C(  1165486652) },
+      { {  INT32_C(   208836084),  INT32_C(  1165866619) },
+        { -INT32_C(  2078798656), -INT32_C(  1165486652) } } },
+    { {  INT32_C(   499844726), -INT32_C(  1170446520), -INT32_C(  1296557872), -INT32_C(  1155039545) },
+      { {  INT32_C(   499844726), -INT32_C(  1170446520) },
+        { -INT32_C(  1296557872), -INT32_C(  1155039545) } } },
+    { { -INT32_C(  1031919815), -INT32_C(   954341274), -INT32_C(   953370075),  INT32_C(  1110439688) },
+      { { -INT32_C(  1031919815), -INT32_C(   954341274) },
+        { -INT32_C(   953370075),  INT32_C(  1110439688) } } },
+    { {  INT32_C(  1471201388), -INT32_C(  2054681002), -INT32_C(   907041255), -INT32_C(   774436862) },
+      { {  INT32_C(  1471201388), -INT32_C(  2054681002) },
+        { -INT32_C(   907041255), -INT32_C(   774436862) } } },
+    { { -INT32_C(  2086191949),  INT32_C(   101464573),  INT32_C(  1001541825),  INT32_C(   560818878) },
+      { { -INT32_C(  2086191949),  INT32_C(   101464573) },
+        {  INT32_C(  1001541825),  INT32_C(   560818878) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t r = simde_vld1_s32_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a[4];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int32x2x2_t r = simde_vld1_s32_x2(a);
+
+    simde_test_codegen_write_vi32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t r[2][1];
+  } test_vec[] = {
+    { {  INT64_C( 6525390167138232810),  INT64_C( 2656897367583947455) },
+      { {  INT64_C( 6525390167138232810) },
+        {  INT64_C( 2656897367583947455) } } },
+    { {  INT64_C( 4871415966346190098),  INT64_C( 7781586256795856231) },
+      { {  INT64_C( 4871415966346190098) },
+        {  INT64_C( 7781586256795856231) } } },
+    { { -INT64_C( 2866621178014876134), -INT64_C( 7603810162299897561) },
+      { { -INT64_C( 2866621178014876134) },
+        { -INT64_C( 7603810162299897561) } } },
+    { {  INT64_C( 5765137300602572561),  INT64_C( 3001054771340998823) },
+      { {  INT64_C( 5765137300602572561) },
+        {  INT64_C( 3001054771340998823) } } },
+    { { -INT64_C( 5402254006551640541), -INT64_C( 6506148231312410442) },
+      { { -INT64_C( 5402254006551640541) },
+        { -INT64_C( 6506148231312410442) } } },
+    { {  INT64_C( 6421108761988358772),  INT64_C( 9160434042042836556) },
+      { {  INT64_C( 6421108761988358772) },
+        {  INT64_C( 9160434042042836556) } } },
+    { { -INT64_C( 3330417629158909333),  INT64_C(  450013136653372630) },
+      { { -INT64_C( 3330417629158909333) },
+        {  INT64_C(  450013136653372630) } } },
+    { {  INT64_C( 2594529235434960351),  INT64_C( 1931538152956348161) },
+      { {  INT64_C( 2594529235434960351) },
+        {  INT64_C( 1931538152956348161) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t r = simde_vld1_s64_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a[2];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int64x1x2_t r = simde_vld1_s64_x2(a);
+
+    simde_test_codegen_write_vi64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[16];
+    uint8_t r[2][8];
+  } test_vec[] = {
+    { { UINT8_C(168), UINT8_C( 72), UINT8_C( 95), UINT8_C( 38), UINT8_C(  4), UINT8_C(222), UINT8_C(171), UINT8_C(194),
+        UINT8_C( 74), UINT8_C( 72), UINT8_C(142), UINT8_C(186), UINT8_C(179), UINT8_C( 78), UINT8_C(141), UINT8_C(162) },
+      { { UINT8_C(168), UINT8_C( 72), UINT8_C( 95), UINT8_C( 38), UINT8_C(  4), UINT8_C(222), UINT8_C(171), UINT8_C(194) },
+        { UINT8_C( 74), UINT8_C( 72), UINT8_C(142), UINT8_C(186), UINT8_C(179), UINT8_C( 78), UINT8_C(141), UINT8_C(162) } } },
+    { { UINT8_C( 48), UINT8_C( 39), UINT8_C( 41), UINT8_C(139), UINT8_C(211), UINT8_C( 50), UINT8_C(230), UINT8_C( 73),
+        UINT8_C( 86), UINT8_C( 16), UINT8_C(158), UINT8_C( 27), UINT8_C(246), UINT8_C( 42), UINT8_C( 38), UINT8_C( 67) },
+      { { UINT8_C( 48), UINT8_C( 39), UINT8_C( 41), UINT8_C(139), UINT8_C(211), UINT8_C( 50), UINT8_C(230), UINT8_C( 73) },
+        { UINT8_C( 86), UINT8_C( 16), UINT8_C(158), UINT8_C( 27), UINT8_C(246), UINT8_C( 42), UINT8_C( 38), UINT8_C( 67) } } },
+    { { UINT8_C(129), UINT8_C( 98), UINT8_C(201), UINT8_C( 35), UINT8_C(167), UINT8_C(220), UINT8_C(146), UINT8_C(113),
+        UINT8_C(202), UINT8_C(132), UINT8_C( 95), UINT8_C(127), UINT8_C( 57), UINT8_C(179), UINT8_C( 80), UINT8_C(192) },
+      { { UINT8_C(129), UINT8_C( 98), UINT8_C(201), UINT8_C( 35), UINT8_C(167), UINT8_C(220), UINT8_C(146), UINT8_C(113) },
+        { UINT8_C(202), UINT8_C(132), UINT8_C( 95), UINT8_C(127), UINT8_C( 57), UINT8_C(179), UINT8_C( 80), UINT8_C(192) } } },
+    { { UINT8_C( 80), UINT8_C(158), UINT8_C(113), UINT8_C( 85), UINT8_C( 30), UINT8_C(200), UINT8_C(215), UINT8_C( 53),
+        UINT8_C(165), UINT8_C( 11), UINT8_C(180), UINT8_C( 21), UINT8_C(168), UINT8_C(248), UINT8_C(196), UINT8_C(167) },
+      { { UINT8_C( 80), UINT8_C(158), UINT8_C(113), UINT8_C( 85), UINT8_C( 30), UINT8_C(200), UINT8_C(215), UINT8_C( 53) },
+        { UINT8_C(165), UINT8_C( 11), UINT8_C(180), UINT8_C( 21), UINT8_C(168), UINT8_C(248), UINT8_C(196), UINT8_C(167) } } },
+    { { UINT8_C(114), UINT8_C(237), UINT8_C( 66), UINT8_C( 93), UINT8_C( 56), UINT8_C(196), UINT8_C( 29), UINT8_C(160),
+        UINT8_C(247), UINT8_C(213), UINT8_C(173), UINT8_C(180), UINT8_C(162), UINT8_C(238), UINT8_C(155), UINT8_C( 17) },
+      { { UINT8_C(114), UINT8_C(237), UINT8_C( 66), UINT8_C( 93), UINT8_C( 56), UINT8_C(196), UINT8_C( 29), UINT8_C(160) },
+        { UINT8_C(247), UINT8_C(213), UINT8_C(173), UINT8_C(180), UINT8_C(162), UINT8_C(238), UINT8_C(155), UINT8_C( 17) } } },
+    { { UINT8_C(110), UINT8_C(100), UINT8_C(133), UINT8_C(117), UINT8_C( 10), UINT8_C( 97), UINT8_C(176), UINT8_C( 83),
+        UINT8_C(109), UINT8_C(231), UINT8_C( 22), UINT8_C( 80), UINT8_C(241), UINT8_C(132), UINT8_C(131), UINT8_C(175) },
+      { { UINT8_C(110), UINT8_C(100), UINT8_C(133), UINT8_C(117), UINT8_C( 10), UINT8_C( 97), UINT8_C(176), UINT8_C( 83) },
+        { UINT8_C(109), UINT8_C(231), UINT8_C( 22), UINT8_C( 80), UINT8_C(241), UINT8_C(132), UINT8_C(131), UINT8_C(175) } } },
+    { { UINT8_C(  4), UINT8_C(224), UINT8_C( 62), UINT8_C(128), UINT8_C( 82), UINT8_C( 12), UINT8_C(127), UINT8_C( 85),
+        UINT8_C(  0), UINT8_C(122), UINT8_C(104), UINT8_C(140), UINT8_C(169), UINT8_C(253), UINT8_C(169), UINT8_C(135) },
+      { { UINT8_C(  4), UINT8_C(224), UINT8_C( 62), UINT8_C(128), UINT8_C( 82), UINT8_C( 12), UINT8_C(127), UINT8_C( 85) },
+        { UINT8_C(  0), UINT8_C(122), UINT8_C(104), UINT8_C(140), UINT8_C(169), UINT8_C(253), UINT8_C(169), UINT8_C(135) } } },
+    { { UINT8_C( 87), UINT8_C( 73), UINT8_C(184), UINT8_C( 43), UINT8_C( 37), UINT8_C(100), UINT8_C( 10), UINT8_C(109),
+        UINT8_C(  5), UINT8_C( 52), UINT8_C( 43), UINT8_C(237), UINT8_C(210), UINT8_C(149), UINT8_C( 80), UINT8_C(181) },
+      { { UINT8_C( 87), UINT8_C( 73), UINT8_C(184), UINT8_C( 43), UINT8_C( 37), UINT8_C(100), UINT8_C( 10), UINT8_C(109) },
+        { UINT8_C(  5), UINT8_C( 52), UINT8_C( 43), UINT8_C(237), UINT8_C(210), UINT8_C(149), UINT8_C( 80), UINT8_C(181) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t r = simde_vld1_u8_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x8x2_t r = simde_vld1_u8_x2(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint16_t r[2][4];
+  } test_vec[] = {
+    { { UINT16_C(59413), UINT16_C(19763), UINT16_C(47887), UINT16_C(48965), UINT16_C(52513), UINT16_C(60036), UINT16_C(63501), UINT16_C(22259) },
+      { { UINT16_C(59413), UINT16_C(19763), UINT16_C(47887), UINT16_C(48965) },
+        { UINT16_C(52513), UINT16_C(60036), UINT16_C(63501), UINT16_C(22259) } } },
+    { { UINT16_C(42590), UINT16_C(46336), UINT16_C(44220), UINT16_C(58215), UINT16_C(53195), UINT16_C(57500), UINT16_C(43495), UINT16_C( 9565) },
+      { { UINT16_C(42590), UINT16_C(46336), UINT16_C(44220), UINT16_C(58215) },
+        { UINT16_C(53195), UINT16_C(57500), UINT16_C(43495), UINT16_C( 9565) } } },
+    { { UINT16_C(28021), UINT16_C(42992), UINT16_C(44762), UINT16_C(60668), UINT16_C( 5442), UINT16_C(32533), UINT16_C(51546), UINT16_C( 1774) },
+      { { UINT16_C(28021), UINT16_C(42992), UINT16_C(44762), UINT16_C(60668) },
+        { UINT16_C( 5442), UINT16_C(32533), UINT16_C(51546), UINT16_C( 1774) } } },
+    { { UINT16_C( 4135), UINT16_C(39404), UINT16_C(61940), UINT16_C(27680), UINT16_C(44101), UINT16_C( 2211), UINT16_C(61668), UINT16_C(  149) },
+      { { UINT16_C( 4135), UINT16_C(39404), UINT16_C(61940), UINT16_C(27680) },
+        { UINT16_C(44101), UINT16_C( 2211), UINT16_C(61668), UINT16_C(  149) } } },
+    { { UINT16_C(41897), UINT16_C(41315), UINT16_C(26370), UINT16_C(35698), UINT16_C(32924), UINT16_C(50551), UINT16_C(29496), UINT16_C(46317) },
+      { { UINT16_C(41897), UINT16_C(41315), UINT16_C(26370), UINT16_C(35698) },
+        { UINT16_C(32924), UINT16_C(50551), UINT16_C(29496), UINT16_C(46317) } } },
+    { { UINT16_C( 6134), UINT16_C( 4730), UINT16_C(54683), UINT16_C(62883), UINT16_C(11096), UINT16_C(41631), UINT16_C(14365), UINT16_C(51512) },
+      { { UINT16_C( 6134), UINT16_C( 4730), UINT16_C(54683), UINT16_C(62883) },
+        { UINT16_C(11096), UINT16_C(41631), UINT16_C(14365), UINT16_C(51512) } } },
+    { { UINT16_C(21527), UINT16_C(64927), UINT16_C(45476), UINT16_C(51763), UINT16_C(26861), UINT16_C(60122), UINT16_C(20220), UINT16_C(37543) },
+      { { UINT16_C(21527), UINT16_C(64927), UINT16_C(45476), UINT16_C(51763) },
+        { UINT16_C(26861), UINT16_C(60122), UINT16_C(20220), UINT16_C(37543) } } },
+    { { UINT16_C(38320), UINT16_C(29982), UINT16_C(20520), UINT16_C(52572), UINT16_C(11914), UINT16_C(26946), UINT16_C(52259), UINT16_C(50314) },
+      { { UINT16_C(38320), UINT16_C(29982), UINT16_C(20520), UINT16_C(52572) },
+        { UINT16_C(11914), UINT16_C(26946), UINT16_C(52259), UINT16_C(50314) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t r = simde_vld1_u16_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint16x4x2_t r = simde_vld1_u16_x2(a);
+
+    simde_test_codegen_write_vu16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t r[2][2];
+  } test_vec[] = {
+    { { UINT32_C(1946758523), UINT32_C(3892361556), UINT32_C(2961826637), UINT32_C( 334223723) },
+      { { UINT32_C(1946758523), UINT32_C(3892361556) },
+        { UINT32_C(2961826637), UINT32_C( 334223723) } } },
+    { { UINT32_C( 122292613), UINT32_C( 253564746), UINT32_C(4221864682), UINT32_C( 174234064) },
+      { { UINT32_C( 122292613), UINT32_C( 253564746) },
+        { UINT32_C(4221864682), UINT32_C( 174234064) } } },
+    { { UINT32_C( 778428259), UINT32_C(2065535479), UINT32_C(2357747766), UINT32_C( 634158590) },
+      { { UINT32_C( 778428259), UINT32_C(2065535479) },
+        { UINT32_C(2357747766), UINT32_C( 634158590) } } },
+    { { UINT32_C( 747329282), UINT32_C(2316931764), UINT32_C(1398500491), UINT32_C( 517571204) },
+      { { UINT32_C( 747329282), UINT32_C(2316931764) },
+        { UINT32_C(1398500491), UINT32_C( 517571204) } } },
+    { { UINT32_C(3346428391), UINT32_C(3867222962), UINT32_C(2225671726), UINT32_C(4239761432) },
+      { { UINT32_C(3346428391), UINT32_C(3867222962) },
+        { UINT32_C(2225671726), UINT32_C(4239761432) } } },
+    { { UINT32_C(4220634782), UINT32_C(3739982908), UINT32_C( 490025788), UINT32_C(4281456758) },
+      { { UINT32_C(4220634782), UINT32_C(3739982908) },
+        { UINT32_C( 490025788), UINT32_C(4281456758) } } },
+    { { UINT32_C(3757014163), UINT32_C(3644163458), UINT32_C(3899399705), UINT32_C(3539709046) },
+      { { UINT32_C(3757014163), UINT32_C(3644163458) },
+        { UINT32_C(3899399705), UINT32_C(3539709046) } } },
+    { { UINT32_C(1391641925), UINT32_C( 501992734), UINT32_C(3941943650), UINT32_C(1311219841) },
+      { { UINT32_C(1391641925), UINT32_C( 501992734) },
+        { UINT32_C(3941943650), UINT32_C(1311219841) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t r = simde_vld1_u32_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[4];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x2x2_t r = simde_vld1_u32_x2(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint64_t r[2][1];
+  } test_vec[] = {
+    { { UINT64_C(16356223912419134188), UINT64_C( 9775562279895284084) },
+      { { UINT64_C(16356223912419134188) },
+        { UINT64_C( 9775562279895284084) } } },
+    { { UINT64_C( 9133438485405749262), UINT64_C( 9802965579214188033) },
+      { { UINT64_C( 9133438485405749262) },
+        { UINT64_C( 9802965579214188033) } } },
+    { { UINT64_C( 8648217373922812611), UINT64_C( 6865710182153057280) },
+      { { UINT64_C( 8648217373922812611) },
+        { UINT64_C( 6865710182153057280) } } },
+    { { UINT64_C(15251774369539593220), UINT64_C( 8143398550666072342) },
+      { { UINT64_C(15251774369539593220) },
+        { UINT64_C( 8143398550666072342) } } },
+    { { UINT64_C(16432238489912019825), UINT64_C(18427494213859600184) },
+      { { UINT64_C(16432238489912019825) },
+        { UINT64_C(18427494213859600184) } } },
+    { { UINT64_C( 1718581712698636062), UINT64_C(13601887340753789629) },
+      { { UINT64_C( 1718581712698636062) },
+        { UINT64_C(13601887340753789629) } } },
+    { { UINT64_C( 8562917575479772986), UINT64_C( 3612047697889193386) },
+      { { UINT64_C( 8562917575479772986) },
+        { UINT64_C( 3612047697889193386) } } },
+    { { UINT64_C( 2717108959349230814), UINT64_C(17305186044986535315) },
+      { { UINT64_C( 2717108959349230814) },
+        { UINT64_C(17305186044986535315) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t r = simde_vld1_u64_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[2];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x1x2_t r = simde_vld1_u64_x2(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_f32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[8];
+    simde_float32 r[2][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -32.88), SIMDE_FLOAT32_C(   746.40), SIMDE_FLOAT32_C(  -891.92), SIMDE_FLOAT32_C(  -232.46),
+        SIMDE_FLOAT32_C(   342.35), SIMDE_FLOAT32_C(   319.64), SIMDE_FLOAT32_C(  -118.74), SIMDE_FLOAT32_C(  -124.61) },
+      { { SIMDE_FLOAT32_C(   -32.88), SIMDE_FLOAT32_C(   746.40), SIMDE_FLOAT32_C(  -891.92), SIMDE_FLOAT32_C(  -232.46) },
+        { SIMDE_FLOAT32_C(   342.35), SIMDE_FLOAT32_C(   319.64), SIMDE_FLOAT32_C(  -118.74), SIMDE_FLOAT32_C(  -124.61) } } },
+    { { SIMDE_FLOAT32_C(   816.61), SIMDE_FLOAT32_C(   797.30), SIMDE_FLOAT32_C(  -477.44), SIMDE_FLOAT32_C(  -124.74),
+        SIMDE_FLOAT32_C(  -981.77), SIMDE_FLOAT32_C(  -785.15), SIMDE_FLOAT32_C(  -302.62), SIMDE_FLOAT32_C(  -264.36) },
+      { { SIMDE_FLOAT32_C(   816.61), SIMDE_FLOAT32_C(   797.30), SIMDE_FLOAT32_C(  -477.44), SIMDE_FLOAT32_C(  -124.74) },
+        { SIMDE_FLOAT32_C(  -981.77), SIMDE_FLOAT32_C(  -785.15), SIMDE_FLOAT32_C(  -302.62), SIMDE_FLOAT32_C(  -264.36) } } },
+    { { SIMDE_FLOAT32_C(   403.31), SIMDE_FLOAT32_C(  -719.54), SIMDE_FLOAT32_C(   -96.07), SIMDE_FLOAT32_C(   684.87),
+        SIMDE_FLOAT32_C(  -758.85), SIMDE_FLOAT32_C(  -566.84), SIMDE_FLOAT32_C(  -291.74), SIMDE_FLOAT32_C(   159.17) },
+      { { SIMDE_FLOAT32_C(   403.31), SIMDE_FLOAT32_C(  -719.54), SIMDE_FLOAT32_C(   -96.07), SIMDE_FLOAT32_C(   684.87) },
+        { SIMDE_FLOAT32_C(  -758.85), SIMDE_FLOAT32_C(  -566.84), SIMDE_FLOAT32_C(  -291.74), SIMDE_FLOAT32_C(   159.17) } } },
+    { { SIMDE_FLOAT32_C(   882.92), SIMDE_FLOAT32_C(  -588.28), SIMDE_FLOAT32_C(   -90.22), SIMDE_FLOAT32_C(   206.40),
+        SIMDE_FLOAT32_C(   643.57), SIMDE_FLOAT32_C(   838.43), SIMDE_FLOAT32_C(   800.08), SIMDE_FLOAT32_C(  -668.50) },
+      { { SIMDE_FLOAT32_C(   882.92), SIMDE_FLOAT32_C(  -588.28), SIMDE_FLOAT32_C(   -90.22), SIMDE_FLOAT32_C(   206.40) },
+        { SIMDE_FLOAT32_C(   643.57), SIMDE_FLOAT32_C(   838.43), SIMDE_FLOAT32_C(   800.08), SIMDE_FLOAT32_C(  -668.50) } } },
+    { { SIMDE_FLOAT32_C(  -331.61), SIMDE_FLOAT32_C(  -908.07), SIMDE_FLOAT32_C(  -932.93), SIMDE_FLOAT32_C(  -204.44),
+        SIMDE_FLOAT32_C(  -127.45), SIMDE_FLOAT32_C(   225.80), SIMDE_FLOAT32_C(   885.79), SIMDE_FLOAT32_C(  -764.66) },
+      { { SIMDE_FLOAT32_C(  -331.61), SIMDE_FLOAT32_C(  -908.07), SIMDE_FLOAT32_C(  -932.93), SIMDE_FLOAT32_C(  -204.44) },
+        { SIMDE_FLOAT32_C(  -127.45), SIMDE_FLOAT32_C(   225.80), SIMDE_FLOAT32_C(   885.79), SIMDE_FLOAT32_C(  -764.66) } } },
+    { { SIMDE_FLOAT32_C(   932.13), SIMDE_FLOAT32_C(   415.66), SIMDE_FLOAT32_C(  -730.77), SIMDE_FLOAT32_C(   373.27),
+        SIMDE_FLOAT32_C(  -757.27), SIMDE_FLOAT32_C(  -854.77), SIMDE_FLOAT32_C(   316.46), SIMDE_FLOAT32_C(  -720.11) },
+      { { SIMDE_FLOAT32_C(   932.13), SIMDE_FLOAT32_C(   415.66), SIMDE_FLOAT32_C(  -730.77), SIMDE_FLOAT32_C(   373.27) },
+        { SIMDE_FLOAT32_C(  -757.27), SIMDE_FLOAT32_C(  -854.77), SIMDE_FLOAT32_C(   316.46), SIMDE_FLOAT32_C(  -720.11) } } },
+    { { SIMDE_FLOAT32_C(   327.66), SIMDE_FLOAT32_C(  -146.89), SIMDE_FLOAT32_C(   331.31), SIMDE_FLOAT32_C(  -369.39),
+        SIMDE_FLOAT32_C(   224.76), SIMDE_FLOAT32_C(  -807.60), SIMDE_FLOAT32_C(   723.03), SIMDE_FLOAT32_C(   591.65) },
+      { { SIMDE_FLOAT32_C(   327.66), SIMDE_FLOAT32_C(  -146.89), SIMDE_FLOAT32_C(   331.31), SIMDE_FLOAT32_C(  -369.39) },
+        { SIMDE_FLOAT32_C(   224.76), SIMDE_FLOAT32_C(  -807.60), SIMDE_FLOAT32_C(   723.03), SIMDE_FLOAT32_C(   591.65) } } },
+    { { SIMDE_FLOAT32_C(  -273.64), SIMDE_FLOAT32_C(   297.48), SIMDE_FLOAT32_C(  -812.29), SIMDE_FLOAT32_C(   253.73),
+        SIMDE_FLOAT32_C(  -522.89), SIMDE_FLOAT32_C(   922.36), SIMDE_FLOAT32_C(  -761.24), SIMDE_FLOAT32_C(  -941.21) },
+      { { SIMDE_FLOAT32_C(  -273.64), SIMDE_FLOAT32_C(   297.48), SIMDE_FLOAT32_C(  -812.29), SIMDE_FLOAT32_C(   253.73) },
+        { SIMDE_FLOAT32_C(  -522.89), SIMDE_FLOAT32_C(   922.36), SIMDE_FLOAT32_C(  -761.24), SIMDE_FLOAT32_C(  -941.21) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t r = simde_vld1q_f32_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a[8];
+    simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, -1000.0f, 1000.0f);
+    simde_float32x4x2_t r = simde_vld1q_f32_x2(a);
+
+    simde_test_codegen_write_vf32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_f64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[4];
+    simde_float64 r[2][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   781.65), SIMDE_FLOAT64_C(   369.67), SIMDE_FLOAT64_C(   239.52), SIMDE_FLOAT64_C(  -824.16) },
+      { { SIMDE_FLOAT64_C(   781.65), SIMDE_FLOAT64_C(   369.67) },
+        { SIMDE_FLOAT64_C(   239.52), SIMDE_FLOAT64_C(  -824.16) } } },
+    { { SIMDE_FLOAT64_C(  -118.26), SIMDE_FLOAT64_C(   459.96), SIMDE_FLOAT64_C(  -857.74), SIMDE_FLOAT64_C(   592.36) },
+      { { SIMDE_FLOAT64_C(  -118.26), SIMDE_FLOAT64_C(   459.96) },
+        { SIMDE_FLOAT64_C(  -857.74), SIMDE_FLOAT64_C(   592.36) } } },
+    { { SIMDE_FLOAT64_C(   183.08), SIMDE_FLOAT64_C(  -750.95), SIMDE_FLOAT64_C(    42.35), SIMDE_FLOAT64_C(  -166.40) },
+      { { SIMDE_FLOAT64_C(   183.08), SIMDE_FLOAT64_C(  -750.95) },
+        { SIMDE_FLOAT64_C(    42.35), SIMDE_FLOAT64_C(  -166.40) } } },
+    { { SIMDE_FLOAT64_C(   595.38), SIMDE_FLOAT64_C(   129.56), SIMDE_FLOAT64_C(   671.11), SIMDE_FLOAT64_C(   519.98) },
+      { { SIMDE_FLOAT64_C(   595.38), SIMDE_FLOAT64_C(   129.56) },
+        { SIMDE_FLOAT64_C(   671.11), SIMDE_FLOAT64_C(   519.98) } } },
+    { { SIMDE_FLOAT64_C(    -2.62), SIMDE_FLOAT64_C(  -602.48), SIMDE_FLOAT64_C(   981.90), SIMDE_FLOAT64_C(  -364.43) },
+      { { SIMDE_FLOAT64_C(    -2.62), SIMDE_FLOAT64_C(  -602.48) },
+        { SIMDE_FLOAT64_C(   981.90), SIMDE_FLOAT64_C(  -364.43) } } },
+    { { SIMDE_FLOAT64_C(   259.59), SIMDE_FLOAT64_C(   671.73), SIMDE_FLOAT64_C(  -627.73), SIMDE_FLOAT64_C(  -899.11) },
+      { { SIMDE_FLOAT64_C(   259.59), SIMDE_FLOAT64_C(   671.73) },
+        { SIMDE_FLOAT64_C(  -627.73), SIMDE_FLOAT64_C(  -899.11) } } },
+    { { SIMDE_FLOAT64_C(   577.13), SIMDE_FLOAT64_C(   463.38), SIMDE_FLOAT64_C(  -676.16), SIMDE_FLOAT64_C(  -393.49) },
+      { { SIMDE_FLOAT64_C(   577.13), SIMDE_FLOAT64_C(   463.38) },
+        { SIMDE_FLOAT64_C(  -676.16), SIMDE_FLOAT64_C(  -393.49) } } },
+    { { SIMDE_FLOAT64_C(   238.64), SIMDE_FLOAT64_C(   130.93), SIMDE_FLOAT64_C(   701.18), SIMDE_FLOAT64_C(   -37.31) },
+      { { SIMDE_FLOAT64_C(   238.64), SIMDE_FLOAT64_C(   130.93) },
+        { SIMDE_FLOAT64_C(   701.18), SIMDE_FLOAT64_C(   -37.31) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t r = simde_vld1q_f64_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a[4];
+    simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, -1000.0, 1000.0);
+    simde_float64x2x2_t r = simde_vld1q_f64_x2(a);
+
+    simde_test_codegen_write_vf64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[32];
+    int8_t r[2][16];
+  } test_vec[] = {
+    { {  INT8_C(  48), -INT8_C(  55), -INT8_C(  61), -INT8_C(  86),  INT8_C( 106), -INT8_C(  12),  INT8_C(  68), -INT8_C(  50),
+         INT8_C(  36),  INT8_C(  74),  INT8_C(  64), -INT8_C(  67),  INT8_C(  31), -INT8_C(  43),  INT8_C(  39), -INT8_C(  42),
+        -INT8_C( 124),  INT8_C( 106),  INT8_C(  28),  INT8_C(  20),  INT8_C(  45), -INT8_C(  44), -INT8_C(  78), -INT8_C(  51),
+         INT8_C(  46),  INT8_C( 115), -INT8_C(  63),  INT8_C(  10),  INT8_C(   5), -INT8_C(  84),  INT8_C(  78), -INT8_C(  49) },
+      { {  INT8_C(  48), -INT8_C(  55), -INT8_C(  61), -INT8_C(  86),  INT8_C( 106), -INT8_C(  12),  INT8_C(  68), -INT8_C(  50),
+           INT8_C(  36),  INT8_C(  74),  INT8_C(  64), -INT8_C(  67),  INT8_C(  31), -INT8_C(  43),  INT8_C(  39), -INT8_C(  42) },
+        { -INT8_C( 124),  INT8_C( 106),  INT8_C(  28),  INT8_C(  20),  INT8_C(  45), -INT8_C(  44), -INT8_C(  78), -INT8_C(  51),
+           INT8_C(  46),  INT8_C( 115), -INT8_C(  63),  INT8_C(  10),  INT8_C(   5), -INT8_C(  84),  INT8_C(  78), -INT8_C(  49) } } },
+    { {  INT8_C(  37),      INT8_MAX, -INT8_C( 118), -INT8_C(  50),  INT8_C( 124), -INT8_C(  33), -INT8_C(  65), -INT8_C( 112),
+         INT8_C( 111), -INT8_C(  52), -INT8_C(  38), -INT8_C(  83),  INT8_C(  15), -INT8_C(  62), -INT8_C( 104), -INT8_C(  89),
+         INT8_C(  15),  INT8_C(  79),  INT8_C(  87),  INT8_C( 102), -INT8_C(  24), -INT8_C( 109),  INT8_C(  60), -INT8_C( 124),
+         INT8_C(  15), -INT8_C( 104), -INT8_C(   5), -INT8_C(  89),  INT8_C(   3),  INT8_C( 114), -INT8_C( 102),  INT8_C(  61) },
+      { {  INT8_C(  37),      INT8_MAX, -INT8_C( 118), -INT8_C(  50),  INT8_C( 124), -INT8_C(  33), -INT8_C(  65), -INT8_C( 112),
+           INT8_C( 111), -INT8_C(  52), -INT8_C(  38), -INT8_C(  83),  INT8_C(  15), -INT8_C(  62), -INT8_C( 104), -INT8_C(  89) },
+        {  INT8_C(  15),  INT8_C(  79),  INT8_C(  87),  INT8_C( 102), -INT8_C(  24), -INT8_C( 109),  INT8_C(  60), -INT8_C( 124),
+           INT8_C(  15), -INT8_C( 104), -INT8_C(   5), -INT8_C(  89),  INT8_C(   3),  INT8_C( 114), -INT8_C( 102),  INT8_C(  61) } } },
+    { {  INT8_C(  38), -INT8_C( 112), -INT8_C( 101), -INT8_C(  29), -INT8_C(  45), -INT8_C(   7),  INT8_C(  30),  INT8_C(  64),
+        -INT8_C(  21), -INT8_C(  45), -INT8_C(  83), -INT8_C(  23),  INT8_C(  30), -INT8_C(  84),  INT8_C(  48), -INT8_C(  53),
+         INT8_C( 100),  INT8_C(  49), -INT8_C(  55), -INT8_C(  44), -INT8_C(  35),  INT8_C(  60),  INT8_C(  47), -INT8_C( 122),
+        -INT8_C(  34),  INT8_C(  14), -INT8_C(  99),  INT8_C(  90),  INT8_C(   8), -INT8_C(  53), -INT8_C( 120),  INT8_C( 101) },
+      { {  INT8_C(  38), -INT8_C( 112), -INT8_C( 101), -INT8_C(  29), -INT8_C(  45), -INT8_C(   7),  INT8_C(  30),  INT8_C(  64),
+          -INT8_C(  21), -INT8_C(  45), -INT8_C(  83), -INT8_C(  23),  INT8_C(  30), -INT8_C(  84),  INT8_C(  48), -INT8_C(  53) },
+        {  INT8_C( 100),  INT8_C(  49), -INT8_C(  55), -INT8_C(  44), -INT8_C(  35),  INT8_C(  60),  INT8_C(  47), -INT8_C( 122),
+          -INT8_C(  34),  INT8_C(  14), -INT8_C(  99),  INT8_C(  90),  INT8_C(   8), -INT8_C(  53), -INT8_C( 120),  INT8_C( 101) } } },
+    { {  INT8_C(  72), -INT8_C(  98), -INT8_C( 111),  INT8_C(   2), -INT8_C(  58), -INT8_C(  75),  INT8_C(  29),  INT8_C( 108),
+         INT8_C(  19),  INT8_C(   3),  INT8_C(  14), -INT8_C(  93), -INT8_C( 119), -INT8_C(  14), -INT8_C(  68), -INT8_C(  63),
+         INT8_C(  69), -INT8_C(  31), -INT8_C(  72),  INT8_C( 101), -INT8_C(  34),  INT8_C( 101),  INT8_C( 124),  INT8_C( 121),
+         INT8_C(  24),  INT8_C(  27),  INT8_C(   3),  INT8_C(  20),  INT8_C(  27),  INT8_C(  35), -INT8_C(  65),  INT8_C( 110) },
+      { {  INT8_C(  72), -INT8_C(  98), -INT8_C( 111),  INT8_C(   2), -INT8_C(  58), -INT8_C(  75),  INT8_C(  29),  INT8_C( 108),
+           INT8_C(  19),  INT8_C(   3),  INT8_C(  14), -INT8_C(  93), -INT8_C( 119), -INT8_C(  14), -INT8_C(  68), -INT8_C(  63) },
+        {  INT8_C(  69), -INT8_C(  31), -INT8_C(  72),  INT8_C( 101), -INT8_C(  34),  INT8_C( 101),  INT8_C( 124),  INT8_C( 121),
+           INT8_C(  24),  INT8_C(  27),  INT8_C(   3),  INT8_C(  20),  INT8_C(  27),  INT8_C(  35), -INT8_C(  65),  INT8_C( 110) } } },
+    { { -INT8_C(  48), -INT8_C(  65),  INT8_C(   2), -INT8_C(  21), -INT8_C(  94),  INT8_C(  55), -INT8_C(  22),  INT8_C(  29),
+         INT8_C(  76), -INT8_C(  43), -INT8_C(  11), -INT8_C(  18), -INT8_C(  56),  INT8_C(  85),  INT8_C(  48),  INT8_C( 125),
+         INT8_C(  47),  INT8_C(  91), -INT8_C(  41),  INT8_C(  42),  INT8_C(  74), -INT8_C(  46),  INT8_C(   8), -INT8_C( 106),
+         INT8_C(   4),  INT8_C(  50), -INT8_C(  83), -INT8_C(   3), -INT8_C(  82), -INT8_C(   8),  INT8_C(  44),  INT8_C(  22) },
+      { { -INT8_C(  48), -INT8_C(  65),  INT8_C(   2), -INT8_C(  21), -INT8_C(  94),  INT8_C(  55), -INT8_C(  22),  INT8_C(  29),
+           INT8_C(  76), -INT8_C(  43), -INT8_C(  11), -INT8_C(  18), -INT8_C(  56),  INT8_C(  85),  INT8_C(  48),  INT8_C( 125) },
+        {  INT8_C(  47),  INT8_C(  91), -INT8_C(  41),  INT8_C(  42),  INT8_C(  74), -INT8_C(  46),  INT8_C(   8), -INT8_C( 106),
+           INT8_C(   4),  INT8_C(  50), -INT8_C(  83), -INT8_C(   3), -INT8_C(  82), -INT8_C(   8),  INT8_C(  44),  INT8_C(  22) } } },
+    { { -INT8_C(  24), -INT8_C(  75),  INT8_C(  89),  INT8_C( 107),  INT8_C(  63), -INT8_C(   5),  INT8_C(  61),  INT8_C(  32),
+        -INT8_C(  90), -INT8_C(   1), -INT8_C(  61), -INT8_C( 117), -INT8_C(  37),  INT8_C(  19),  INT8_C(  18), -INT8_C( 105),
+        -INT8_C(  95),  INT8_C(  11),  INT8_C(  82), -INT8_C( 127),  INT8_C(  21), -INT8_C( 112), -INT8_C(  89),  INT8_C(  37),
+         INT8_C(  43), -INT8_C( 101),  INT8_C(  21),  INT8_C(  35), -INT8_C(   8),  INT8_C(  86),  INT8_C(  13),  INT8_C(  25) },
+      { { -INT8_C(  24), -INT8_C(  75),  INT8_C(  89),  INT8_C( 107),  INT8_C(  63), -INT8_C(   5),  INT8_C(  61),  INT8_C(  32),
+          -INT8_C(  90), -INT8_C(   1), -INT8_C(  61), -INT8_C( 117), -INT8_C(  37),  INT8_C(  19),  INT8_C(  18), -INT8_C( 105) },
+        { -INT8_C(  95),  INT8_C(  11),  INT8_C(  82), -INT8_C( 127),  INT8_C(  21), -INT8_C( 112), -INT8_C(  89),  INT8_C(  37),
+           INT8_C(  43), -INT8_C( 101),  INT8_C(  21),  INT8_C(  35), -INT8_C(   8),  INT8_C(  86),  INT8_C(  13),  INT8_C(  25) } } },
+    { {  INT8_C( 124), -INT8_C(  80),  INT8_C( 100), -INT8_C( 102),  INT8_C(  44), -INT8_C( 114), -INT8_C(   4),  INT8_C(  43),
+         INT8_C(  16),  INT8_C(  73),  INT8_C(  15),  INT8_C(   5),  INT8_C(  82), -INT8_C(  60), -INT8_C( 106), -INT8_C(  67),
+        -INT8_C( 113), -INT8_C(  27), -INT8_C(  75),  INT8_C(  45), -INT8_C( 109),  INT8_C( 104),  INT8_C( 119), -INT8_C(  63),
+        -INT8_C(   5), -INT8_C(  51),  INT8_C(  28),  INT8_C(  69),  INT8_C( 119),  INT8_C( 103),  INT8_C(  82), -INT8_C(  20) },
+      { {  INT8_C( 124), -INT8_C(  80),  INT8_C( 100), -INT8_C( 102),  INT8_C(  44), -INT8_C( 114), -INT8_C(   4),  INT8_C(  43),
+           INT8_C(  16),  INT8_C(  73),  INT8_C(  15),  INT8_C(   5),  INT8_C(  82), -INT8_C(  60), -INT8_C( 106), -INT8_C(  67) },
+        { -INT8_C( 113), -INT8_C(  27), -INT8_C(  75),  INT8_C(  45), -INT8_C( 109),  INT8_C( 104),  INT8_C( 119), -INT8_C(  63),
+          -INT8_C(   5), -INT8_C(  51),  INT8_C(  28),  INT8_C(  69),  INT8_C( 119),  INT8_C( 103),  INT8_C(  82), -INT8_C(  20) } } },
+    { { -INT8_C(   6), -INT8_C(   9),  INT8_C( 126),  INT8_C(  12),      INT8_MAX, -INT8_C( 120), -INT8_C(  55), -INT8_C(   1),
+        -INT8_C(   4),  INT8_C(  69), -INT8_C(  85),  INT8_C( 103),  INT8_C(   9), -INT8_C(  87),  INT8_C(  39),  INT8_C( 111),
+         INT8_C(  32), -INT8_C(  76),  INT8_C(  13),  INT8_C(  29),  INT8_C(   9), -INT8_C(  36), -INT8_C(  13),  INT8_C(  24),
+         INT8_C( 104), -INT8_C(  45), -INT8_C(  65),  INT8_C(  57),  INT8_C(  66),  INT8_C(  66),  INT8_C(  53),  INT8_C(   8) },
+      { { -INT8_C(   6), -INT8_C(   9),  INT8_C( 126),  INT8_C(  12),      INT8_MAX, -INT8_C( 120), -INT8_C(  55), -INT8_C(   1),
+          -INT8_C(   4),  INT8_C(  69), -INT8_C(  85),  INT8_C( 103),  INT8_C(   9), -INT8_C(  87),  INT8_C(  39),  INT8_C( 111) },
+        {  INT8_C(  32), -INT8_C(  76),  INT8_C(  13),  INT8_C(  29),  INT8_C(   9), -INT8_C(  36), -INT8_C(  13),  INT8_C(  24),
+           INT8_C( 104), -INT8_C(  45), -INT8_C(  65),  INT8_C(  57),  INT8_C(  66),  INT8_C(  66),  INT8_C(  53),  INT8_C(   8) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t r = simde_vld1q_s8_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a[32];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int8x16x2_t r = simde_vld1q_s8_x2(a);
+
+    simde_test_codegen_write_vi8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[16];
+    int16_t r[2][8];
+  } test_vec[] = {
+    { { -INT16_C(  1037),  INT16_C(  8749),  INT16_C(  5642),  INT16_C(   291), -INT16_C(  8781),  INT16_C( 15092),  INT16_C(  3930), -INT16_C( 13030),
+         INT16_C( 31339),  INT16_C(  8256),  INT16_C( 29016), -INT16_C( 29128), -INT16_C( 28473), -INT16_C( 32240), -INT16_C( 25697), -INT16_C( 16280) },
+      { { -INT16_C(  1037),  INT16_C(  8749),  INT16_C(  5642),  INT16_C(   291), -INT16_C(  8781),  INT16_C( 15092),  INT16_C(  3930), -INT16_C( 13030) },
+        {  INT16_C( 31339),  INT16_C(  8256),  INT16_C( 29016), -INT16_C( 29128), -INT16_C( 28473), -INT16_C( 32240), -INT16_C( 25697), -INT16_C( 16280) } } },
+    { {  INT16_C(  8287), -INT16_C( 10745), -INT16_C(  8647), -INT16_C( 24471),  INT16_C( 13314), -INT16_C( 19633),  INT16_C( 16679), -INT16_C(  8433),
+         INT16_C(  3357),  INT16_C( 31860),  INT16_C( 14564),  INT16_C(  2112), -INT16_C( 27190),  INT16_C( 24127),  INT16_C( 30988),  INT16_C(  2316) },
+      { {  INT16_C(  8287), -INT16_C( 10745), -INT16_C(  8647), -INT16_C( 24471),  INT16_C( 13314), -INT16_C( 19633),  INT16_C( 16679), -INT16_C(  8433) },
+        {  INT16_C(  3357),  INT16_C( 31860),  INT16_C( 14564),  INT16_C(  2112), -INT16_C( 27190),  INT16_C( 24127),  INT16_C( 30988),  INT16_C(  2316) } } },
+    { { -INT16_C(  3026), -INT16_C( 20921), -INT16_C( 11715),  INT16_C( 14187),  INT16_C( 23278), -INT16_C( 19646),  INT16_C( 20301),  INT16_C(  6888),
+        -INT16_C( 32547),  INT16_C( 31623),  INT16_C( 18066), -INT16_C( 31178),  INT16_C( 23512), -INT16_C(  3566), -INT16_C( 22816),  INT16_C( 28225) },
+      { { -INT16_C(  3026), -INT16_C( 20921), -INT16_C( 11715),  INT16_C( 14187),  INT16_C( 23278), -INT16_C( 19646),  INT16_C( 20301),  INT16_C(  6888) },
+        { -INT16_C( 32547),  INT16_C( 31623),  INT16_C( 18066), -INT16_C( 31178),  INT16_C( 23512), -INT16_C(  3566), -INT16_C( 22816),  INT16_C( 28225) } } },
+    { {  INT16_C( 14731),  INT16_C( 11750), -INT16_C(  3500), -INT16_C(  7614), -INT16_C(  7619), -INT16_C( 26696), -INT16_C( 21553),  INT16_C( 12606),
+        -INT16_C( 18351),  INT16_C( 14087), -INT16_C(   238),  INT16_C( 29526),  INT16_C( 31380),  INT16_C( 25211),  INT16_C( 27356), -INT16_C(  4753) },
+      { {  INT16_C( 14731),  INT16_C( 11750), -INT16_C(  3500), -INT16_C(  7614), -INT16_C(  7619), -INT16_C( 26696), -INT16_C( 21553),  INT16_C( 12606) },
+        { -INT16_C( 18351),  INT16_C( 14087), -INT16_C(   238),  INT16_C( 29526),  INT16_C( 31380),  INT16_C( 25211),  INT16_C( 27356), -INT16_C(  4753) } } },
+    { { -INT16_C( 22994), -INT16_C(  4952), -INT16_C( 14628),  INT16_C( 24581),  INT16_C( 28848), -INT16_C(  3086),  INT16_C( 14445),  INT16_C(  7562),
+        -INT16_C(   223),  INT16_C( 31336), -INT16_C( 18603), -INT16_C( 11636), -INT16_C( 21213), -INT16_C( 12772),  INT16_C(  5732),  INT16_C( 19330) },
+      { { -INT16_C( 22994), -INT16_C(  4952), -INT16_C( 14628),  INT16_C( 24581),  INT16_C( 28848), -INT16_C(  3086),  INT16_C( 14445),  INT16_C(  7562) },
+        { -INT16_C(   223),  INT16_C( 31336), -INT16_C( 18603), -INT16_C( 11636), -INT16_C( 21213), -INT16_C( 12772),  INT16_C(  5732),  INT16_C( 19330) } } },
+    { {  INT16_C( 26802), -INT16_C( 19443), -INT16_C( 24889),  INT16_C( 11847), -INT16_C(  8382), -INT16_C( 22298),  INT16_C( 20040), -INT16_C( 13658),
+         INT16_C(  5744),  INT16_C(  1508), -INT16_C( 18264), -INT16_C( 32064), -INT16_C(  9220), -INT16_C( 17613), -INT16_C( 29595),  INT16_C( 13982) },
+      { {  INT16_C( 26802), -INT16_C( 19443), -INT16_C( 24889),  INT16_C( 11847), -INT16_C(  8382), -INT16_C( 22298),  INT16_C( 20040), -INT16_C( 13658) },
+        {  INT16_C(  5744),  INT16_C(  1508), -INT16_C( 18264), -INT16_C( 32064), -INT16_C(  9220), -INT16_C( 17613), -INT16_C( 29595),  INT16_C( 13982) } } },
+    { { -INT16_C( 18804), -INT16_C(  8258),  INT16_C( 21631),  INT16_C( 17458),  INT16_C( 20814),  INT16_C( 25073),  INT16_C(  7692), -INT16_C( 11070),
+         INT16_C(  6761), -INT16_C(  4279), -INT16_C( 13580),  INT16_C( 16039), -INT16_C( 11976),  INT16_C( 29252), -INT16_C( 28104),  INT16_C( 19817) },
+      { { -INT16_C( 18804), -INT16_C(  8258),  INT16_C( 21631),  INT16_C( 17458),  INT16_C( 20814),  INT16_C( 25073),  INT16_C(  7692), -INT16_C( 11070) },
+        {  INT16_C(  6761), -INT16_C(  4279), -INT16_C( 13580),  INT16_C( 16039), -INT16_C( 11976),  INT16_C( 29252), -INT16_C( 28104),  INT16_C( 19817) } } },
+    { { -INT16_C( 29737),  INT16_C(  4323), -INT16_C( 31747),  INT16_C(  2877), -INT16_C( 13145),  INT16_C( 23301),  INT16_C(  5597),  INT16_C(  2009),
+         INT16_C( 14180), -INT16_C(   419),  INT16_C(  9899), -INT16_C( 17543), -INT16_C(  1176), -INT16_C( 18349),  INT16_C( 32335),  INT16_C( 14248) },
+      { { -INT16_C( 29737),  INT16_C(  4323), -INT16_C( 31747),  INT16_C(  2877), -INT16_C( 13145),  INT16_C( 23301),  INT16_C(  5597),  INT16_C(  2009) },
+        {  INT16_C( 14180), -INT16_C(   419),  INT16_C(  9899), -INT16_C( 17543), -INT16_C(  1176), -INT16_C( 18349),  INT16_C( 32335),  INT16_C( 14248) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t r = simde_vld1q_s16_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int16x8x2_t r = simde_vld1q_s16_x2(a);
+
+    simde_test_codegen_write_vi16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[8];
+    int32_t r[2][4];
+  } test_vec[] = {
+    { { -INT32_C(  1260695501), -INT32_C(    11374713),  INT32_C(  1316509169), -INT32_C(   113021654), -INT32_C(   812302348),  INT32_C(   717448203), -INT32_C(   948795261),  INT32_C(  2042230897) },
+      { { -INT32_C(  1260695501), -INT32_C(    11374713),  INT32_C(  1316509169), -INT32_C(   113021654) },
+        { -INT32_C(   812302348),  INT32_C(   717448203), -INT32_C(   948795261),  INT32_C(  2042230897) } } },
+    { {  INT32_C(  1699835047),  INT32_C(   745701582), -INT32_C(    12233366),  INT32_C(   245863400), -INT32_C(    62332891),  INT32_C(  1023069902), -INT32_C(  1036198982),  INT32_C(  2129887390) },
+      { {  INT32_C(  1699835047),  INT32_C(   745701582), -INT32_C(    12233366),  INT32_C(   245863400) },
+        { -INT32_C(    62332891),  INT32_C(  1023069902), -INT32_C(  1036198982),  INT32_C(  2129887390) } } },
+    { {  INT32_C(  1465074670), -INT32_C(   788496304), -INT32_C(   230923736),  INT32_C(  1858173702), -INT32_C(   141571146), -INT32_C(   404537702), -INT32_C(  1860708315), -INT32_C(  1046016384) },
+      { {  INT32_C(  1465074670), -INT32_C(   788496304), -INT32_C(   230923736),  INT32_C(  1858173702) },
+        { -INT32_C(   141571146), -INT32_C(   404537702), -INT32_C(  1860708315), -INT32_C(  1046016384) } } },
+    { {  INT32_C(  1549904931),  INT32_C(   878926648), -INT32_C(  1606941448), -INT32_C(  1025414369),  INT32_C(  1363290203), -INT32_C(  1535638034),  INT32_C(   502381268), -INT32_C(  1973754715) },
+      { {  INT32_C(  1549904931),  INT32_C(   878926648), -INT32_C(  1606941448), -INT32_C(  1025414369) },
+        {  INT32_C(  1363290203), -INT32_C(  1535638034),  INT32_C(   502381268), -INT32_C(  1973754715) } } },
+    { {  INT32_C(  1303398825),  INT32_C(   886776142),  INT32_C(  1652739527), -INT32_C(   844045725),  INT32_C(  2072467571),  INT32_C(  1481664317), -INT32_C(  1983394687),  INT32_C(   273070999) },
+      { {  INT32_C(  1303398825),  INT32_C(   886776142),  INT32_C(  1652739527), -INT32_C(   844045725) },
+        {  INT32_C(  2072467571),  INT32_C(  1481664317), -INT32_C(  1983394687),  INT32_C(   273070999) } } },
+    { { -INT32_C(   314746642),  INT32_C(   917062280), -INT32_C(  1516969767),  INT32_C(   907303033),  INT32_C(  1936707424), -INT32_C(   371624443),  INT32_C(  2083200564), -INT32_C(   878935342) },
+      { { -INT32_C(   314746642),  INT32_C(   917062280), -INT32_C(  1516969767),  INT32_C(   907303033) },
+        {  INT32_C(  1936707424), -INT32_C(   371624443),  INT32_C(  2083200564), -INT32_C(   878935342) } } },
+    { { -INT32_C(   887350336), -INT32_C(  2030927960), -INT32_C(  1571258553),  INT32_C(  2034752205),  INT32_C(  1795851114), -INT32_C(   865418653),  INT32_C(  1618530530),  INT32_C(  1405677502) },
+      { { -INT32_C(   887350336), -INT32_C(  2030927960), -INT32_C(  1571258553),  INT32_C(  2034752205) },
+        {  INT32_C(  1795851114), -INT32_C(   865418653),  INT32_C(  1618530530),  INT32_C(  1405677502) } } },
+    { { -INT32_C(  1113393609), -INT32_C(   616013838), -INT32_C(  1493382260),  INT32_C(  1185818994),  INT32_C(  1488164221),  INT32_C(   692910403),  INT32_C(   626876756),  INT32_C(  1959872254) },
+      { { -INT32_C(  1113393609), -INT32_C(   616013838), -INT32_C(  1493382260),  INT32_C(  1185818994) },
+        {  INT32_C(  1488164221),  INT32_C(   692910403),  INT32_C(   626876756),  INT32_C(  1959872254) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t r = simde_vld1q_s32_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int32x4x2_t r = simde_vld1q_s32_x2(a);
+
+    simde_test_codegen_write_vi32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[4];
+    int64_t r[2][2];
+  } test_vec[] = {
+    { { -INT64_C( 4412744339439861139),  INT64_C( 8059155988154596982),  INT64_C( 8402815308221694417), -INT64_C( 8799212075382890094) },
+      { { -INT64_C( 4412744339439861139),  INT64_C( 8059155988154596982) },
+        {  INT64_C( 8402815308221694417), -INT64_C( 8799212075382890094) } } },
+    { { -INT64_C( 6287429439939761166), -INT64_C( 2936655374224393216),  INT64_C( 4350215523431590899), -INT64_C( 8787001155298500663) },
+      { { -INT64_C( 6287429439939761166), -INT64_C( 2936655374224393216) },
+        {  INT64_C( 4350215523431590899), -INT64_C( 8787001155298500663) } } },
+    { { -INT64_C( 1764658983263684995), -INT64_C( 2231540626415263196), -INT64_C( 7423920146502936418), -INT64_C( 1927376504728616703) },
+      { { -INT64_C( 1764658983263684995), -INT64_C( 2231540626415263196) },
+        { -INT64_C( 7423920146502936418), -INT64_C( 1927376504728616703) } } },
+    { {  INT64_C( 6830371422996054371),  INT64_C( 5711550070828357629), -INT64_C( 2919176649601775804), -INT64_C( 4635552772477972462) },
+      { {  INT64_C( 6830371422996054371),  INT64_C( 5711550070828357629) },
+        { -INT64_C( 2919176649601775804), -INT64_C( 4635552772477972462) } } },
+    { { -INT64_C( 7011462258721602052),  INT64_C( 3783013541288616147),  INT64_C( 3806941299089621809), -INT64_C( 3429895892781574852) },
+      { { -INT64_C( 7011462258721602052),  INT64_C( 3783013541288616147) },
+        {  INT64_C( 3806941299089621809), -INT64_C( 3429895892781574852) } } },
+    { { -INT64_C(  930454094369786304), -INT64_C( 2117643553230208325), -INT64_C( 7190797549227859947),  INT64_C( 6211554477986942005) },
+      { { -INT64_C(  930454094369786304), -INT64_C( 2117643553230208325) },
+        { -INT64_C( 7190797549227859947),  INT64_C( 6211554477986942005) } } },
+    { {  INT64_C( 8545303890162319507),  INT64_C( 1255934450359646653), -INT64_C( 3890239843749080506), -INT64_C( 7308032850181098851) },
+      { {  INT64_C( 8545303890162319507),  INT64_C( 1255934450359646653) },
+        { -INT64_C( 3890239843749080506), -INT64_C( 7308032850181098851) } } },
+    { { -INT64_C( 6851477215731096487), -INT64_C( 2498745050803213641), -INT64_C( 3308993860620848507), -INT64_C( 4822032356051227773) },
+      { { -INT64_C( 6851477215731096487), -INT64_C( 2498745050803213641) },
+        { -INT64_C( 3308993860620848507), -INT64_C( 4822032356051227773) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t r = simde_vld1q_s64_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a[4];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int64x2x2_t r = simde_vld1q_s64_x2(a);
+
+    simde_test_codegen_write_vi64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[32];
+    uint8_t r[2][16];
+  } test_vec[] = {
+    { { UINT8_C(226), UINT8_C( 64), UINT8_C(119), UINT8_C(185), UINT8_C(144), UINT8_C( 28), UINT8_C( 38), UINT8_C( 46),
+        UINT8_C( 39), UINT8_C(193), UINT8_C(246), UINT8_C(129), UINT8_C( 61), UINT8_C(199), UINT8_C(138), UINT8_C( 11),
+        UINT8_C( 55), UINT8_C( 74), UINT8_C( 28), UINT8_C(219), UINT8_C( 68), UINT8_C( 94), UINT8_C(108), UINT8_C( 79),
+        UINT8_C( 62), UINT8_C(212), UINT8_C(235), UINT8_C( 80), UINT8_C( 75), UINT8_C( 52), UINT8_C(233), UINT8_C(219) },
+      { { UINT8_C(226), UINT8_C( 64), UINT8_C(119), UINT8_C(185), UINT8_C(144), UINT8_C( 28), UINT8_C( 38), UINT8_C( 46),
+          UINT8_C( 39), UINT8_C(193), UINT8_C(246), UINT8_C(129), UINT8_C( 61), UINT8_C(199), UINT8_C(138), UINT8_C( 11) },
+        { UINT8_C( 55), UINT8_C( 74), UINT8_C( 28), UINT8_C(219), UINT8_C( 68), UINT8_C( 94), UINT8_C(108), UINT8_C( 79),
+          UINT8_C( 62), UINT8_C(212), UINT8_C(235), UINT8_C( 80), UINT8_C( 75), UINT8_C( 52), UINT8_C(233), UINT8_C(219) } } },
+    { { UINT8_C(168), UINT8_C(108), UINT8_C(231), UINT8_C(111), UINT8_C(118), UINT8_C( 50), UINT8_C(  5), UINT8_C(199),
+        UINT8_C( 38), UINT8_C(149), UINT8_C( 20), UINT8_C(120), UINT8_C( 32), UINT8_C(204), UINT8_C( 13), UINT8_C(233),
+        UINT8_C( 62), UINT8_C(129), UINT8_C(125), UINT8_C(  4), UINT8_C(170), UINT8_C(228), UINT8_C( 49), UINT8_C(124),
+        UINT8_C(105), UINT8_C(164), UINT8_C(188), UINT8_C(120), UINT8_C( 27), UINT8_C(212), UINT8_C(178), UINT8_C(214) },
+      { { UINT8_C(168), UINT8_C(108), UINT8_C(231), UINT8_C(111), UINT8_C(118), UINT8_C( 50), UINT8_C(  5), UINT8_C(199),
+          UINT8_C( 38), UINT8_C(149), UINT8_C( 20), UINT8_C(120), UINT8_C( 32), UINT8_C(204), UINT8_C( 13), UINT8_C(233) },
+        { UINT8_C( 62), UINT8_C(129), UINT8_C(125), UINT8_C(  4), UINT8_C(170), UINT8_C(228), UINT8_C( 49), UINT8_C(124),
+          UINT8_C(105), UINT8_C(164), UINT8_C(188), UINT8_C(120), UINT8_C( 27), UINT8_C(212), UINT8_C(178), UINT8_C(214) } } },
+    { { UINT8_C( 21), UINT8_C(133), UINT8_C(  3), UINT8_C(123), UINT8_C(198), UINT8_C(230), UINT8_C(137), UINT8_C(144),
+        UINT8_C(154), UINT8_C(175), UINT8_C( 74), UINT8_C( 97), UINT8_C( 38), UINT8_C(167), UINT8_C(145), UINT8_C(130),
+        UINT8_C( 78), UINT8_C(133), UINT8_C(253), UINT8_C(103), UINT8_C(203), UINT8_C( 21), UINT8_C(229), UINT8_C(106),
+        UINT8_C( 45), UINT8_C(245), UINT8_C( 95), UINT8_C( 91), UINT8_C( 97), UINT8_C(162), UINT8_C( 30), UINT8_C( 50) },
+      { { UINT8_C( 21), UINT8_C(133), UINT8_C(  3), UINT8_C(123), UINT8_C(198), UINT8_C(230), UINT8_C(137), UINT8_C(144),
+          UINT8_C(154), UINT8_C(175), UINT8_C( 74), UINT8_C( 97), UINT8_C( 38), UINT8_C(167), UINT8_C(145), UINT8_C(130) },
+        { UINT8_C( 78), UINT8_C(133), UINT8_C(253), UINT8_C(103), UINT8_C(203), UINT8_C( 21), UINT8_C(229), UINT8_C(106),
+          UINT8_C( 45), UINT8_C(245), UINT8_C( 95), UINT8_C( 91), UINT8_C( 97), UINT8_C(162), UINT8_C( 30), UINT8_C( 50) } } },
+    { { UINT8_C(122), UINT8_C(232), UINT8_C(154), UINT8_C(226), UINT8_C( 75), UINT8_C( 79), UINT8_C( 45), UINT8_C(106),
+        UINT8_C(  7), UINT8_C(252), UINT8_C( 59), UINT8_C(178), UINT8_C(125), UINT8_C(227), UINT8_C(253), UINT8_C(234),
+        UINT8_C(182), UINT8_C(168), UINT8_C( 63), UINT8_C( 33), UINT8_C( 68), UINT8_C(142), UINT8_C( 51), UINT8_C( 21),
+        UINT8_C(224), UINT8_C( 75), UINT8_C(  1), UINT8_C(229), UINT8_C(233), UINT8_C(104), UINT8_C(197), UINT8_C(252) },
+      { { UINT8_C(122), UINT8_C(232), UINT8_C(154), UINT8_C(226), UINT8_C( 75), UINT8_C( 79), UINT8_C( 45), UINT8_C(106),
+          UINT8_C(  7), UINT8_C(252), UINT8_C( 59), UINT8_C(178), UINT8_C(125), UINT8_C(227), UINT8_C(253), UINT8_C(234) },
+        { UINT8_C(182), UINT8_C(168), UINT8_C( 63), UINT8_C( 33), UINT8_C( 68), UINT8_C(142), UINT8_C( 51), UINT8_C( 21),
+          UINT8_C(224), UINT8_C( 75), UINT8_C(  1), UINT8_C(229), UINT8_C(233), UINT8_C(104), UINT8_C(197), UINT8_C(252) } } },
+    { { UINT8_C( 76), UINT8_C( 73), UINT8_C(142), UINT8_C(198), UINT8_C( 28), UINT8_C(188), UINT8_C(180), UINT8_C(  4),
+        UINT8_C( 26), UINT8_C(188), UINT8_C(248),    UINT8_MAX, UINT8_C(105), UINT8_C(122), UINT8_C(162), UINT8_C( 77),
+        UINT8_C(246), UINT8_C(221), UINT8_C(230), UINT8_C(169), UINT8_C(210), UINT8_C(149), UINT8_C(157), UINT8_C( 42),
+        UINT8_C( 95), UINT8_C(214), UINT8_C(135), UINT8_C(149), UINT8_C(193), UINT8_C(178), UINT8_C( 80), UINT8_C(251) },
+      { { UINT8_C( 76), UINT8_C( 73), UINT8_C(142), UINT8_C(198), UINT8_C( 28), UINT8_C(188), UINT8_C(180), UINT8_C(  4),
+          UINT8_C( 26), UINT8_C(188), UINT8_C(248),    UINT8_MAX, UINT8_C(105), UINT8_C(122), UINT8_C(162), UINT8_C( 77) },
+        { UINT8_C(246), UINT8_C(221), UINT8_C(230), UINT8_C(169), UINT8_C(210), UINT8_C(149), UINT8_C(157), UINT8_C( 42),
+          UINT8_C( 95), UINT8_C(214), UINT8_C(135), UINT8_C(149), UINT8_C(193), UINT8_C(178), UINT8_C( 80), UINT8_C(251) } } },
+    { { UINT8_C(240), UINT8_C( 14), UINT8_C(157), UINT8_C( 60), UINT8_C(237), UINT8_C( 60), UINT8_C( 38), UINT8_C(150),
+        UINT8_C(126), UINT8_C( 41), UINT8_C(130), UINT8_C(127), UINT8_C( 76), UINT8_C( 19), UINT8_C(142), UINT8_C( 16),
+        UINT8_C(127), UINT8_C(232), UINT8_C( 93), UINT8_C(179), UINT8_C( 66), UINT8_C(221), UINT8_C(132), UINT8_C(103),
+        UINT8_C(100), UINT8_C(116), UINT8_C( 64), UINT8_C(111), UINT8_C( 12), UINT8_C(130), UINT8_C(116), UINT8_C( 51) },
+      { { UINT8_C(240), UINT8_C( 14), UINT8_C(157), UINT8_C( 60), UINT8_C(237), UINT8_C( 60), UINT8_C( 38), UINT8_C(150),
+          UINT8_C(126), UINT8_C( 41), UINT8_C(130), UINT8_C(127), UINT8_C( 76), UINT8_C( 19), UINT8_C(142), UINT8_C( 16) },
+        { UINT8_C(127), UINT8_C(232), UINT8_C( 93), UINT8_C(179), UINT8_C( 66), UINT8_C(221), UINT8_C(132), UINT8_C(103),
+          UINT8_C(100), UINT8_C(116), UINT8_C( 64), UINT8_C(111), UINT8_C( 12), UINT8_C(130), UINT8_C(116), UINT8_C( 51) } } },
+    { { UINT8_C(172), UINT8_C( 27), UINT8_C( 33), UINT8_C(242), UINT8_C(229), UINT8_C( 78), UINT8_C( 35), UINT8_C( 20),
+        UINT8_C( 26), UINT8_C( 56), UINT8_C( 12), UINT8_C(243), UINT8_C(207), UINT8_C( 57), UINT8_C( 48), UINT8_C(184),
+        UINT8_C( 15), UINT8_C(145), UINT8_C(177), UINT8_C(  2), UINT8_C( 61), UINT8_C(159), UINT8_C( 90), UINT8_C( 52),
+        UINT8_C(146), UINT8_C( 53), UINT8_C( 73), UINT8_C(225), UINT8_C(226), UINT8_C(195), UINT8_C(107), UINT8_C( 41) },
+      { { UINT8_C(172), UINT8_C( 27), UINT8_C( 33), UINT8_C(242), UINT8_C(229), UINT8_C( 78), UINT8_C( 35), UINT8_C( 20),
+          UINT8_C( 26), UINT8_C( 56), UINT8_C( 12), UINT8_C(243), UINT8_C(207), UINT8_C( 57), UINT8_C( 48), UINT8_C(184) },
+        { UINT8_C( 15), UINT8_C(145), UINT8_C(177), UINT8_C(  2), UINT8_C( 61), UINT8_C(159), UINT8_C( 90), UINT8_C( 52),
+          UINT8_C(146), UINT8_C( 53), UINT8_C( 73), UINT8_C(225), UINT8_C(226), UINT8_C(195), UINT8_C(107), UINT8_C( 41) } } },
+    { { UINT8_C(161), UINT8_C(110), UINT8_C(169), UINT8_C(  0), UINT8_C(140), UINT8_C( 32), UINT8_C(191), UINT8_C( 65),
+        UINT8_C( 76), UINT8_C( 98), UINT8_C( 43), UINT8_C(243), UINT8_C(116), UINT8_C( 17), UINT8_C(212), UINT8_C(116),
+        UINT8_C(121), UINT8_C(  8), UINT8_C(121), UINT8_C(136), UINT8_C(229), UINT8_C( 50), UINT8_C(215), UINT8_C( 76),
+        UINT8_C(243), UINT8_C( 18), UINT8_C(182), UINT8_C(118), UINT8_C(173), UINT8_C( 28), UINT8_C(106), UINT8_C( 10) },
+      { { UINT8_C(161), UINT8_C(110), UINT8_C(169), UINT8_C(  0), UINT8_C(140), UINT8_C( 32), UINT8_C(191), UINT8_C( 65),
+          UINT8_C( 76), UINT8_C( 98), UINT8_C( 43), UINT8_C(243), UINT8_C(116), UINT8_C( 17), UINT8_C(212), UINT8_C(116) },
+        { UINT8_C(121), UINT8_C(  8), UINT8_C(121), UINT8_C(136), UINT8_C(229), UINT8_C( 50), UINT8_C(215), UINT8_C( 76),
+          UINT8_C(243), UINT8_C( 18), UINT8_C(182), UINT8_C(118), UINT8_C(173), UINT8_C( 28), UINT8_C(106), UINT8_C( 10) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t r = simde_vld1q_u8_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[32];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x16x2_t r = simde_vld1q_u8_x2(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[16];
+    uint16_t r[2][8];
+  } test_vec[] = {
+    { { UINT16_C(15407), UINT16_C(12751), UINT16_C(56358), UINT16_C(63029), UINT16_C(43026), UINT16_C( 1071), UINT16_C(63730), UINT16_C( 6214),
+        UINT16_C(15703), UINT16_C(61270), UINT16_C(60497), UINT16_C(13782), UINT16_C(13587), UINT16_C( 6521), UINT16_C(48759), UINT16_C(36630) },
+      { { UINT16_C(15407), UINT16_C(12751), UINT16_C(56358), UINT16_C(63029), UINT16_C(43026), UINT16_C( 1071), UINT16_C(63730), UINT16_C( 6214) },
+        { UINT16_C(15703), UINT16_C(61270), UINT16_C(60497), UINT16_C(13782), UINT16_C(13587), UINT16_C( 6521), UINT16_C(48759), UINT16_C(36630) } } },
+    { { UINT16_C(28618), UINT16_C(65514), UINT16_C(54589), UINT16_C(49347), UINT16_C(40195), UINT16_C(51581), UINT16_C(19312), UINT16_C(33827),
+        UINT16_C(52772), UINT16_C(13087), UINT16_C(12532), UINT16_C( 5665), UINT16_C(48056), UINT16_C(33236), UINT16_C(41388), UINT16_C(29830) },
+      { { UINT16_C(28618), UINT16_C(65514), UINT16_C(54589), UINT16_C(49347), UINT16_C(40195), UINT16_C(51581), UINT16_C(19312), UINT16_C(33827) },
+        { UINT16_C(52772), UINT16_C(13087), UINT16_C(12532), UINT16_C( 5665), UINT16_C(48056), UINT16_C(33236), UINT16_C(41388), UINT16_C(29830) } } },
+    { { UINT16_C(48782), UINT16_C(10665), UINT16_C(56693), UINT16_C(61610), UINT16_C( 9057), UINT16_C(55006), UINT16_C(57307), UINT16_C(24868),
+        UINT16_C(49429), UINT16_C(37926), UINT16_C(52450), UINT16_C(13296), UINT16_C(63262), UINT16_C(22289), UINT16_C(38796), UINT16_C(62157) },
+      { { UINT16_C(48782), UINT16_C(10665), UINT16_C(56693), UINT16_C(61610), UINT16_C( 9057), UINT16_C(55006), UINT16_C(57307), UINT16_C(24868) },
+        { UINT16_C(49429), UINT16_C(37926), UINT16_C(52450), UINT16_C(13296), UINT16_C(63262), UINT16_C(22289), UINT16_C(38796), UINT16_C(62157) } } },
+    { { UINT16_C(51089), UINT16_C(42267), UINT16_C(32300), UINT16_C( 2699), UINT16_C(61865), UINT16_C( 5266), UINT16_C(32569), UINT16_C(37792),
+        UINT16_C(35045), UINT16_C(19865), UINT16_C( 1121), UINT16_C(63273), UINT16_C(26904), UINT16_C(57466), UINT16_C( 7989), UINT16_C(19082) },
+      { { UINT16_C(51089), UINT16_C(42267), UINT16_C(32300), UINT16_C( 2699), UINT16_C(61865), UINT16_C( 5266), UINT16_C(32569), UINT16_C(37792) },
+        { UINT16_C(35045), UINT16_C(19865), UINT16_C( 1121), UINT16_C(63273), UINT16_C(26904), UINT16_C(57466), UINT16_C( 7989), UINT16_C(19082) } } },
+    { { UINT16_C(  521), UINT16_C(26229), UINT16_C(34244), UINT16_C(31707), UINT16_C( 4727), UINT16_C(56320), UINT16_C( 6656), UINT16_C( 5581),
+        UINT16_C(63302), UINT16_C(37664), UINT16_C(14046), UINT16_C(43985), UINT16_C(22040), UINT16_C(42190), UINT16_C(47810), UINT16_C(48957) },
+      { { UINT16_C(  521), UINT16_C(26229), UINT16_C(34244), UINT16_C(31707), UINT16_C( 4727), UINT16_C(56320), UINT16_C( 6656), UINT16_C( 5581) },
+        { UINT16_C(63302), UINT16_C(37664), UINT16_C(14046), UINT16_C(43985), UINT16_C(22040), UINT16_C(42190), UINT16_C(47810), UINT16_C(48957) } } },
+    { { UINT16_C( 2335), UINT16_C(24325), UINT16_C(56457), UINT16_C(20548), UINT16_C(31107), UINT16_C(41943), UINT16_C( 4675), UINT16_C(61041),
+        UINT16_C( 6333), UINT16_C(17853), UINT16_C(20819), UINT16_C(15050), UINT16_C(43333), UINT16_C(40674), UINT16_C(33742), UINT16_C(49270) },
+      { { UINT16_C( 2335), UINT16_C(24325), UINT16_C(56457), UINT16_C(20548), UINT16_C(31107), UINT16_C(41943), UINT16_C( 4675), UINT16_C(61041) },
+        { UINT16_C( 6333), UINT16_C(17853), UINT16_C(20819), UINT16_C(15050), UINT16_C(43333), UINT16_C(40674), UINT16_C(33742), UINT16_C(49270) } } },
+    { { UINT16_C(20139), UINT16_C(51705), UINT16_C( 4537), UINT16_C(63972), UINT16_C(47261), UINT16_C(23497), UINT16_C(16361), UINT16_C(33755),
+        UINT16_C(29690), UINT16_C(64777), UINT16_C(27485), UINT16_C( 8272), UINT16_C(37398), UINT16_C(29066), UINT16_C(61656), UINT16_C(44103) },
+      { { UINT16_C(20139), UINT16_C(51705), UINT16_C( 4537), UINT16_C(63972), UINT16_C(47261), UINT16_C(23497), UINT16_C(16361), UINT16_C(33755) },
+        { UINT16_C(29690), UINT16_C(64777), UINT16_C(27485), UINT16_C( 8272), UINT16_C(37398), UINT16_C(29066), UINT16_C(61656), UINT16_C(44103) } } },
+    { { UINT16_C(52367), UINT16_C(14743), UINT16_C(58149), UINT16_C(45566), UINT16_C(17867), UINT16_C(10967), UINT16_C(41941), UINT16_C(22704),
+        UINT16_C(44232), UINT16_C(17115), UINT16_C(49670), UINT16_C( 4539), UINT16_C(27301), UINT16_C(62269), UINT16_C(60448), UINT16_C(13602) },
+      { { UINT16_C(52367), UINT16_C(14743), UINT16_C(58149), UINT16_C(45566), UINT16_C(17867), UINT16_C(10967), UINT16_C(41941), UINT16_C(22704) },
+        { UINT16_C(44232), UINT16_C(17115), UINT16_C(49670), UINT16_C( 4539), UINT16_C(27301), UINT16_C(62269), UINT16_C(60448), UINT16_C(13602) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t r = simde_vld1q_u16_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint16x8x2_t r = simde_vld1q_u16_x2(a);
+
+    simde_test_codegen_write_vu16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[8];
+    uint32_t r[2][4];
+  } test_vec[] = {
+    { { UINT32_C(2067031396), UINT32_C(3214639090), UINT32_C(3777268894), UINT32_C(2309251077), UINT32_C(2033609033), UINT32_C(2186328417), UINT32_C(3079422210), UINT32_C(2456847248) },
+      { { UINT32_C(2067031396), UINT32_C(3214639090), UINT32_C(3777268894), UINT32_C(2309251077) },
+        { UINT32_C(2033609033), UINT32_C(2186328417), UINT32_C(3079422210), UINT32_C(2456847248) } } },
+    { { UINT32_C( 950742611), UINT32_C(3846911501), UINT32_C( 983833214), UINT32_C(2188194227), UINT32_C(2314388667), UINT32_C( 876821596), UINT32_C(2702036777), UINT32_C(1445903283) },
+      { { UINT32_C( 950742611), UINT32_C(3846911501), UINT32_C( 983833214), UINT32_C(2188194227) },
+        { UINT32_C(2314388667), UINT32_C( 876821596), UINT32_C(2702036777), UINT32_C(1445903283) } } },
+    { { UINT32_C(2171432005), UINT32_C(2898234400), UINT32_C(3627719323), UINT32_C(2640641700), UINT32_C(3694444647), UINT32_C(2730330785), UINT32_C(1848823280), UINT32_C( 649734885) },
+      { { UINT32_C(2171432005), UINT32_C(2898234400), UINT32_C(3627719323), UINT32_C(2640641700) },
+        { UINT32_C(3694444647), UINT32_C(2730330785), UINT32_C(1848823280), UINT32_C( 649734885) } } },
+    { { UINT32_C( 316895447), UINT32_C( 276481546), UINT32_C(1593596372), UINT32_C( 877002022), UINT32_C( 684267394), UINT32_C(1854088565), UINT32_C(3544525280), UINT32_C(1745593385) },
+      { { UINT32_C( 316895447), UINT32_C( 276481546), UINT32_C(1593596372), UINT32_C( 877002022) },
+        { UINT32_C( 684267394), UINT32_C(1854088565), UINT32_C(3544525280), UINT32_C(1745593385) } } },
+    { { UINT32_C(1156467504), UINT32_C(2635632068), UINT32_C(2891615997), UINT32_C(  23465906), UINT32_C(3116414730), UINT32_C(1278088099), UINT32_C(1979701142), UINT32_C(1425449196) },
+      { { UINT32_C(1156467504), UINT32_C(2635632068), UINT32_C(2891615997), UINT32_C(  23465906) },
+        { UINT32_C(3116414730), UINT32_C(1278088099), UINT32_C(1979701142), UINT32_C(1425449196) } } },
+    { { UINT32_C(3782400242), UINT32_C(1371739054), UINT32_C(1595394577), UINT32_C(2737581832), UINT32_C(2001077856), UINT32_C(1835499833), UINT32_C(4055416441), UINT32_C( 173707687) },
+      { { UINT32_C(3782400242), UINT32_C(1371739054), UINT32_C(1595394577), UINT32_C(2737581832) },
+        { UINT32_C(2001077856), UINT32_C(1835499833), UINT32_C(4055416441), UINT32_C( 173707687) } } },
+    { { UINT32_C( 828335154), UINT32_C( 388874638), UINT32_C(2964525855), UINT32_C( 176571475), UINT32_C( 138130092), UINT32_C( 913970727), UINT32_C(1042037014), UINT32_C(3157117449) },
+      { { UINT32_C( 828335154), UINT32_C( 388874638), UINT32_C(2964525855), UINT32_C( 176571475) },
+        { UINT32_C( 138130092), UINT32_C( 913970727), UINT32_C(1042037014), UINT32_C(3157117449) } } },
+    { { UINT32_C(2100553416), UINT32_C(2509744440), UINT32_C(3978580158), UINT32_C( 666803842), UINT32_C(3738704631), UINT32_C(2587835855), UINT32_C(3383295353), UINT32_C(2852791486) },
+      { { UINT32_C(2100553416), UINT32_C(2509744440), UINT32_C(3978580158), UINT32_C( 666803842) },
+        { UINT32_C(3738704631), UINT32_C(2587835855), UINT32_C(3383295353), UINT32_C(2852791486) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t r = simde_vld1q_u32_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x4x2_t r = simde_vld1q_u32_x2(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[4];
+    uint64_t r[2][2];
+  } test_vec[] = {
+    { { UINT64_C(  710740452972744570), UINT64_C(17972805473148473850), UINT64_C( 9364228041750612713), UINT64_C(18055097847612703197) },
+      { { UINT64_C(  710740452972744570), UINT64_C(17972805473148473850) },
+        { UINT64_C( 9364228041750612713), UINT64_C(18055097847612703197) } } },
+    { { UINT64_C(15298150620733159116), UINT64_C(10785937995135514030), UINT64_C(12435270929124043203), UINT64_C(15020640851642598335) },
+      { { UINT64_C(15298150620733159116), UINT64_C(10785937995135514030) },
+        { UINT64_C(12435270929124043203), UINT64_C(15020640851642598335) } } },
+    { { UINT64_C(   28189718687194478), UINT64_C(12618258886518150540), UINT64_C(10185671369812647911), UINT64_C(11630558732508812932) },
+      { { UINT64_C(   28189718687194478), UINT64_C(12618258886518150540) },
+        { UINT64_C(10185671369812647911), UINT64_C(11630558732508812932) } } },
+    { { UINT64_C(  552372439915590972), UINT64_C( 3276625990123048761), UINT64_C( 2929396232341456939), UINT64_C( 1546228478944755470) },
+      { { UINT64_C(  552372439915590972), UINT64_C( 3276625990123048761) },
+        { UINT64_C( 2929396232341456939), UINT64_C( 1546228478944755470) } } },
+    { { UINT64_C(15802052034382498259), UINT64_C( 7473364352747413472), UINT64_C(17685437086166697620), UINT64_C(17213656716437839088) },
+      { { UINT64_C(15802052034382498259), UINT64_C( 7473364352747413472) },
+        { UINT64_C(17685437086166697620), UINT64_C(17213656716437839088) } } },
+    { { UINT64_C(10203447533690110727), UINT64_C( 4414770544807820717), UINT64_C(   40337338017366339), UINT64_C( 4062881433092133142) },
+      { { UINT64_C(10203447533690110727), UINT64_C( 4414770544807820717) },
+        { UINT64_C(   40337338017366339), UINT64_C( 4062881433092133142) } } },
+    { { UINT64_C( 5765278595200868458), UINT64_C( 5338537707691613040), UINT64_C(18222893386706537953), UINT64_C(12051650054837355619) },
+      { { UINT64_C( 5765278595200868458), UINT64_C( 5338537707691613040) },
+        { UINT64_C(18222893386706537953), UINT64_C(12051650054837355619) } } },
+    { { UINT64_C(12226271477267524343), UINT64_C( 3456687880864730501), UINT64_C( 8054024923005775147), UINT64_C(17103188313700443180) },
+      { { UINT64_C(12226271477267524343), UINT64_C( 3456687880864730501) },
+        { UINT64_C( 8054024923005775147), UINT64_C(17103188313700443180) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t r = simde_vld1q_u64_x2(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[4];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x2x2_t r = simde_vld1q_u64_x2(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_f32_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_f64_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s8_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s16_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s32_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s64_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u8_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u16_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u32_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u64_x2)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_f32_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_f64_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s8_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s16_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s32_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s64_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u8_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u16_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u32_x2)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u64_x2)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1562 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld1_x3
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld1_x3.h"
+
+static int
+test_simde_vld1_f32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[6];
+    simde_float32 r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -738.52), SIMDE_FLOAT32_C(  -285.04), SIMDE_FLOAT32_C(  -765.41), SIMDE_FLOAT32_C(    -5.48),
+        SIMDE_FLOAT32_C(  -102.51), SIMDE_FLOAT32_C(  -584.74) },
+      { { SIMDE_FLOAT32_C(  -738.52), SIMDE_FLOAT32_C(  -285.04) },
+        { SIMDE_FLOAT32_C(  -765.41), SIMDE_FLOAT32_C(    -5.48) },
+        { SIMDE_FLOAT32_C(  -102.51), SIMDE_FLOAT32_C(  -584.74) } } },
+    { { SIMDE_FLOAT32_C(   966.65), SIMDE_FLOAT32_C(   407.77), SIMDE_FLOAT32_C(  -250.18), SIMDE_FLOAT32_C(   233.75),
+        SIMDE_FLOAT32_C(   283.08), SIMDE_FLOAT32_C(  -821.15) },
+      { { SIMDE_FLOAT32_C(   966.65), SIMDE_FLOAT32_C(   407.77) },
+        { SIMDE_FLOAT32_C(  -250.18), SIMDE_FLOAT32_C(   233.75) },
+        { SIMDE_FLOAT32_C(   283.08), SIMDE_FLOAT32_C(  -821.15) } } },
+    { { SIMDE_FLOAT32_C(    31.37), SIMDE_FLOAT32_C(   188.26), SIMDE_FLOAT32_C(  -401.00), SIMDE_FLOAT32_C(  -239.83),
+        SIMDE_FLOAT32_C(   301.64), SIMDE_FLOAT32_C(   286.50) },
+      { { SIMDE_FLOAT32_C(    31.37), SIMDE_FLOAT32_C(   188.26) },
+        { SIMDE_FLOAT32_C(  -401.00), SIMDE_FLOAT32_C(  -239.83) },
+        { SIMDE_FLOAT32_C(   301.64), SIMDE_FLOAT32_C(   286.50) } } },
+    { { SIMDE_FLOAT32_C(   796.28), SIMDE_FLOAT32_C(  -609.25), SIMDE_FLOAT32_C(  -275.44), SIMDE_FLOAT32_C(   747.43),
+        SIMDE_FLOAT32_C(  -826.97), SIMDE_FLOAT32_C(  -833.61) },
+      { { SIMDE_FLOAT32_C(   796.28), SIMDE_FLOAT32_C(  -609.25) },
+        { SIMDE_FLOAT32_C(  -275.44), SIMDE_FLOAT32_C(   747.43) },
+        { SIMDE_FLOAT32_C(  -826.97), SIMDE_FLOAT32_C(  -833.61) } } },
+    { { SIMDE_FLOAT32_C(  -871.31), SIMDE_FLOAT32_C(  -449.39), SIMDE_FLOAT32_C(  -681.98), SIMDE_FLOAT32_C(  -257.37),
+        SIMDE_FLOAT32_C(   -19.83), SIMDE_FLOAT32_C(  -507.90) },
+      { { SIMDE_FLOAT32_C(  -871.31), SIMDE_FLOAT32_C(  -449.39) },
+        { SIMDE_FLOAT32_C(  -681.98), SIMDE_FLOAT32_C(  -257.37) },
+        { SIMDE_FLOAT32_C(   -19.83), SIMDE_FLOAT32_C(  -507.90) } } },
+    { { SIMDE_FLOAT32_C(   159.70), SIMDE_FLOAT32_C(   399.64), SIMDE_FLOAT32_C(  -362.20), SIMDE_FLOAT32_C(  -713.65),
+        SIMDE_FLOAT32_C(   967.77), SIMDE_FLOAT32_C(  -135.35) },
+      { { SIMDE_FLOAT32_C(   159.70), SIMDE_FLOAT32_C(   399.64) },
+        { SIMDE_FLOAT32_C(  -362.20), SIMDE_FLOAT32_C(  -713.65) },
+        { SIMDE_FLOAT32_C(   967.77), SIMDE_FLOAT32_C(  -135.35) } } },
+    { { SIMDE_FLOAT32_C(  -842.05), SIMDE_FLOAT32_C(  -776.86), SIMDE_FLOAT32_C(   451.28), SIMDE_FLOAT32_C(  -129.05),
+        SIMDE_FLOAT32_C(   874.63), SIMDE_FLOAT32_C(   493.44) },
+      { { SIMDE_FLOAT32_C(  -842.05), SIMDE_FLOAT32_C(  -776.86) },
+        { SIMDE_FLOAT32_C(   451.28), SIMDE_FLOAT32_C(  -129.05) },
+        { SIMDE_FLOAT32_C(   874.63), SIMDE_FLOAT32_C(   493.44) } } },
+    { { SIMDE_FLOAT32_C(  -836.03), SIMDE_FLOAT32_C(   511.97), SIMDE_FLOAT32_C(   930.05), SIMDE_FLOAT32_C(   998.02),
+        SIMDE_FLOAT32_C(   700.33), SIMDE_FLOAT32_C(   252.24) },
+      { { SIMDE_FLOAT32_C(  -836.03), SIMDE_FLOAT32_C(   511.97) },
+        { SIMDE_FLOAT32_C(   930.05), SIMDE_FLOAT32_C(   998.02) },
+        { SIMDE_FLOAT32_C(   700.33), SIMDE_FLOAT32_C(   252.24) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x3_t r = simde_vld1_f32_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[2], simde_vld1_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a[6];
+    simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, -1000.0f, 1000.0f);
+    simde_float32x2x3_t r = simde_vld1_f32_x3(a);
+
+    simde_test_codegen_write_vf32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_f64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[3];
+    simde_float64 r[3][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   843.02), SIMDE_FLOAT64_C(   590.27), SIMDE_FLOAT64_C(  -162.15) },
+      { { SIMDE_FLOAT64_C(   843.02) },
+        { SIMDE_FLOAT64_C(   590.27) },
+        { SIMDE_FLOAT64_C(  -162.15) } } },
+    { { SIMDE_FLOAT64_C(  -425.47), SIMDE_FLOAT64_C(  -972.92), SIMDE_FLOAT64_C(  -825.33) },
+      { { SIMDE_FLOAT64_C(  -425.47) },
+        { SIMDE_FLOAT64_C(  -972.92) },
+        { SIMDE_FLOAT64_C(  -825.33) } } },
+    { { SIMDE_FLOAT64_C(  -200.77), SIMDE_FLOAT64_C(  -831.50), SIMDE_FLOAT64_C(  -736.61) },
+      { { SIMDE_FLOAT64_C(  -200.77) },
+        { SIMDE_FLOAT64_C(  -831.50) },
+        { SIMDE_FLOAT64_C(  -736.61) } } },
+    { { SIMDE_FLOAT64_C(   -95.22), SIMDE_FLOAT64_C(  -487.21), SIMDE_FLOAT64_C(   929.70) },
+      { { SIMDE_FLOAT64_C(   -95.22) },
+        { SIMDE_FLOAT64_C(  -487.21) },
+        { SIMDE_FLOAT64_C(   929.70) } } },
+    { { SIMDE_FLOAT64_C(  -628.84), SIMDE_FLOAT64_C(   113.24), SIMDE_FLOAT64_C(    39.99) },
+      { { SIMDE_FLOAT64_C(  -628.84) },
+        { SIMDE_FLOAT64_C(   113.24) },
+        { SIMDE_FLOAT64_C(    39.99) } } },
+    { { SIMDE_FLOAT64_C(  -187.56), SIMDE_FLOAT64_C(   580.14), SIMDE_FLOAT64_C(   905.45) },
+      { { SIMDE_FLOAT64_C(  -187.56) },
+        { SIMDE_FLOAT64_C(   580.14) },
+        { SIMDE_FLOAT64_C(   905.45) } } },
+    { { SIMDE_FLOAT64_C(   669.05), SIMDE_FLOAT64_C(  -871.53), SIMDE_FLOAT64_C(  -291.39) },
+      { { SIMDE_FLOAT64_C(   669.05) },
+        { SIMDE_FLOAT64_C(  -871.53) },
+        { SIMDE_FLOAT64_C(  -291.39) } } },
+    { { SIMDE_FLOAT64_C(  -165.54), SIMDE_FLOAT64_C(   825.09), SIMDE_FLOAT64_C(   380.36) },
+      { { SIMDE_FLOAT64_C(  -165.54) },
+        { SIMDE_FLOAT64_C(   825.09) },
+        { SIMDE_FLOAT64_C(   380.36) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x3_t r = simde_vld1_f64_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[2], simde_vld1_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a[3];
+    simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, -1000.0, 1000.0);
+    simde_float64x1x3_t r = simde_vld1_f64_x3(a);
+
+    simde_test_codegen_write_vf64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[24];
+    int8_t r[3][8];
+  } test_vec[] = {
+    { {  INT8_C(  95), -INT8_C(  82), -INT8_C(  73),  INT8_C( 104), -INT8_C(   7), -INT8_C(  14),  INT8_C(  21),  INT8_C(   0),
+        -INT8_C(   7), -INT8_C( 123),  INT8_C(  25), -INT8_C(  56),  INT8_C(   2),  INT8_C(  12),  INT8_C(  12),  INT8_C(  86),
+        -INT8_C(  36),  INT8_C(  58),  INT8_C(  79), -INT8_C(  90), -INT8_C(  34), -INT8_C(  57), -INT8_C(  99), -INT8_C(   9) },
+      { {  INT8_C(  95), -INT8_C(  82), -INT8_C(  73),  INT8_C( 104), -INT8_C(   7), -INT8_C(  14),  INT8_C(  21),  INT8_C(   0) },
+        { -INT8_C(   7), -INT8_C( 123),  INT8_C(  25), -INT8_C(  56),  INT8_C(   2),  INT8_C(  12),  INT8_C(  12),  INT8_C(  86) },
+        { -INT8_C(  36),  INT8_C(  58),  INT8_C(  79), -INT8_C(  90), -INT8_C(  34), -INT8_C(  57), -INT8_C(  99), -INT8_C(   9) } } },
+    { {  INT8_C(  13), -INT8_C(  91), -INT8_C(   9),  INT8_C(  73),  INT8_C(  41),  INT8_C(  29), -INT8_C(  14), -INT8_C( 118),
+        -INT8_C(  29),  INT8_C(   2), -INT8_C( 117), -INT8_C( 122),  INT8_C(  20), -INT8_C(  36),  INT8_C(  21), -INT8_C(  74),
+         INT8_C(  59),  INT8_C(  11),  INT8_C(  50),  INT8_C(  50), -INT8_C(  65), -INT8_C(  27),  INT8_C(  53),  INT8_C(  58) },
+      { {  INT8_C(  13), -INT8_C(  91), -INT8_C(   9),  INT8_C(  73),  INT8_C(  41),  INT8_C(  29), -INT8_C(  14), -INT8_C( 118) },
+        { -INT8_C(  29),  INT8_C(   2), -INT8_C( 117), -INT8_C( 122),  INT8_C(  20), -INT8_C(  36),  INT8_C(  21), -INT8_C(  74) },
+        {  INT8_C(  59),  INT8_C(  11),  INT8_C(  50),  INT8_C(  50), -INT8_C(  65), -INT8_C(  27),  INT8_C(  53),  INT8_C(  58) } } },
+    { {  INT8_C( 111), -INT8_C(   1),  INT8_C(  23), -INT8_C( 126), -INT8_C(  41), -INT8_C(  75),  INT8_C(  87), -INT8_C( 118),
+         INT8_C(   6),  INT8_C(  57), -INT8_C(  69), -INT8_C(  95), -INT8_C(  80), -INT8_C(  73),      INT8_MAX,  INT8_C(  64),
+        -INT8_C(  63), -INT8_C(  50),  INT8_C(  83),  INT8_C(  97), -INT8_C(  50), -INT8_C(  53), -INT8_C(  50), -INT8_C(  39) },
+      { {  INT8_C( 111), -INT8_C(   1),  INT8_C(  23), -INT8_C( 126), -INT8_C(  41), -INT8_C(  75),  INT8_C(  87), -INT8_C( 118) },
+        {  INT8_C(   6),  INT8_C(  57), -INT8_C(  69), -INT8_C(  95), -INT8_C(  80), -INT8_C(  73),      INT8_MAX,  INT8_C(  64) },
+        { -INT8_C(  63), -INT8_C(  50),  INT8_C(  83),  INT8_C(  97), -INT8_C(  50), -INT8_C(  53), -INT8_C(  50), -INT8_C(  39) } } },
+    { {  INT8_C( 120),  INT8_C(  53), -INT8_C(  62), -INT8_C(  20),  INT8_C(  75), -INT8_C( 103), -INT8_C( 117), -INT8_C( 102),
+        -INT8_C(  97),  INT8_C( 116),  INT8_C(  14),  INT8_C(  36), -INT8_C( 103),  INT8_C(  27), -INT8_C(  49), -INT8_C(  80),
+        -INT8_C(   5),  INT8_C( 117), -INT8_C(   1),  INT8_C(  94),  INT8_C( 105), -INT8_C(  49), -INT8_C( 104),  INT8_C( 126) },
+      { {  INT8_C( 120),  INT8_C(  53), -INT8_C(  62), -INT8_C(  20),  INT8_C(  75), -INT8_C( 103), -INT8_C( 117), -INT8_C( 102) },
+        { -INT8_C(  97),  INT8_C( 116),  INT8_C(  14),  INT8_C(  36), -INT8_C( 103),  INT8_C(  27), -INT8_C(  49), -INT8_C(  80) },
+        { -INT8_C(   5),  INT8_C( 117), -INT8_C(   1),  INT8_C(  94),  INT8_C( 105), -INT8_C(  49), -INT8_C( 104),  INT8_C( 126) } } },
+    { {  INT8_C(  26),  INT8_C( 111), -INT8_C(   6), -INT8_C(  33),  INT8_C(  12), -INT8_C(  97), -INT8_C(  92),  INT8_C(  14),
+         INT8_C( 115),  INT8_C( 123), -INT8_C(  49),  INT8_C(  25), -INT8_C(  19),  INT8_C( 113), -INT8_C(  18), -INT8_C(  97),
+        -INT8_C(   7),  INT8_C(  85), -INT8_C(  23), -INT8_C(   7),  INT8_C(   4),  INT8_C(   3),  INT8_C(  27), -INT8_C(  39) },
+      { {  INT8_C(  26),  INT8_C( 111), -INT8_C(   6), -INT8_C(  33),  INT8_C(  12), -INT8_C(  97), -INT8_C(  92),  INT8_C(  14) },
+        {  INT8_C( 115),  INT8_C( 123), -INT8_C(  49),  INT8_C(  25), -INT8_C(  19),  INT8_C( 113), -INT8_C(  18), -INT8_C(  97) },
+        { -INT8_C(   7),  INT8_C(  85), -INT8_C(  23), -INT8_C(   7),  INT8_C(   4),  INT8_C(   3),  INT8_C(  27), -INT8_C(  39) } } },
+    { {  INT8_C( 123), -INT8_C(   2), -INT8_C(  86),  INT8_C(  65), -INT8_C(  38),  INT8_C(  72), -INT8_C(  46), -INT8_C(  12),
+        -INT8_C(  64),  INT8_C(  30),  INT8_C( 121), -INT8_C(  85),  INT8_C(  51), -INT8_C(  47),  INT8_C(  56), -INT8_C(  42),
+        -INT8_C(  64), -INT8_C( 120),  INT8_C(  82),  INT8_C( 110),  INT8_C(  18),  INT8_C(  19), -INT8_C(  84), -INT8_C(  18) },
+      { {  INT8_C( 123), -INT8_C(   2), -INT8_C(  86),  INT8_C(  65), -INT8_C(  38),  INT8_C(  72), -INT8_C(  46), -INT8_C(  12) },
+        { -INT8_C(  64),  INT8_C(  30),  INT8_C( 121), -INT8_C(  85),  INT8_C(  51), -INT8_C(  47),  INT8_C(  56), -INT8_C(  42) },
+        { -INT8_C(  64), -INT8_C( 120),  INT8_C(  82),  INT8_C( 110),  INT8_C(  18),  INT8_C(  19), -INT8_C(  84), -INT8_C(  18) } } },
+    { { -INT8_C( 108),  INT8_C(  17), -INT8_C(  82), -INT8_C( 123),  INT8_C( 121), -INT8_C(   3),  INT8_C(  60), -INT8_C(  73),
+        -INT8_C(   8),  INT8_C( 118),      INT8_MIN, -INT8_C( 115), -INT8_C( 110), -INT8_C(  25), -INT8_C(  88),  INT8_C(   2),
+         INT8_C(   2), -INT8_C( 100),  INT8_C(  45),  INT8_C(  34),  INT8_C(  87),  INT8_C(  35), -INT8_C(  14), -INT8_C( 124) },
+      { { -INT8_C( 108),  INT8_C(  17), -INT8_C(  82), -INT8_C( 123),  INT8_C( 121), -INT8_C(   3),  INT8_C(  60), -INT8_C(  73) },
+        { -INT8_C(   8),  INT8_C( 118),      INT8_MIN, -INT8_C( 115), -INT8_C( 110), -INT8_C(  25), -INT8_C(  88),  INT8_C(   2) },
+        {  INT8_C(   2), -INT8_C( 100),  INT8_C(  45),  INT8_C(  34),  INT8_C(  87),  INT8_C(  35), -INT8_C(  14), -INT8_C( 124) } } },
+    { {  INT8_C(  10),  INT8_C(  96), -INT8_C(  14), -INT8_C(  23), -INT8_C( 102),  INT8_C(  39),  INT8_C( 108), -INT8_C(  74),
+        -INT8_C(  67), -INT8_C(  27), -INT8_C(  32),  INT8_C(  78), -INT8_C(  57),  INT8_C( 103),  INT8_C(   3), -INT8_C(  80),
+        -INT8_C(  36), -INT8_C(  65),  INT8_C(  91),  INT8_C(  37), -INT8_C(  41),  INT8_C(  87),      INT8_MAX, -INT8_C(  94) },
+      { {  INT8_C(  10),  INT8_C(  96), -INT8_C(  14), -INT8_C(  23), -INT8_C( 102),  INT8_C(  39),  INT8_C( 108), -INT8_C(  74) },
+        { -INT8_C(  67), -INT8_C(  27), -INT8_C(  32),  INT8_C(  78), -INT8_C(  57),  INT8_C( 103),  INT8_C(   3), -INT8_C(  80) },
+        { -INT8_C(  36), -INT8_C(  65),  INT8_C(  91),  INT8_C(  37), -INT8_C(  41),  INT8_C(  87),      INT8_MAX, -INT8_C(  94) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x3_t r = simde_vld1_s8_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[2], simde_vld1_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a[24];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int8x8x3_t r = simde_vld1_s8_x3(a);
+
+    simde_test_codegen_write_vi8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[12];
+    int16_t r[3][4];
+  } test_vec[] = {
+    { { -INT16_C(  9102),  INT16_C( 25044),  INT16_C(  4463),  INT16_C( 10792), -INT16_C( 32688),  INT16_C(  9463), -INT16_C( 10996), -INT16_C( 24772),
+         INT16_C( 20739), -INT16_C( 18853), -INT16_C( 11163),  INT16_C(  6322) },
+      { { -INT16_C(  9102),  INT16_C( 25044),  INT16_C(  4463),  INT16_C( 10792) },
+        { -INT16_C( 32688),  INT16_C(  9463), -INT16_C( 10996), -INT16_C( 24772) },
+        {  INT16_C( 20739), -INT16_C( 18853), -INT16_C( 11163),  INT16_C(  6322) } } },
+    { {  INT16_C(  9619),  INT16_C( 26847), -INT16_C( 29062),  INT16_C( 30574),  INT16_C(  1378), -INT16_C(  9664), -INT16_C( 16939), -INT16_C( 20377),
+         INT16_C( 17552),  INT16_C( 23081), -INT16_C( 20683),  INT16_C( 30125) },
+      { {  INT16_C(  9619),  INT16_C( 26847), -INT16_C( 29062),  INT16_C( 30574) },
+        {  INT16_C(  1378), -INT16_C(  9664), -INT16_C( 16939), -INT16_C( 20377) },
+        {  INT16_C( 17552),  INT16_C( 23081), -INT16_C( 20683),  INT16_C( 30125) } } },
+    { {  INT16_C(  5746),  INT16_C( 13301),  INT16_C( 28039),  INT16_C( 20160), -INT16_C( 28874),  INT16_C( 28746),  INT16_C( 10119),  INT16_C(  2228),
+         INT16_C( 19632),  INT16_C( 10984), -INT16_C( 20681), -INT16_C( 24260) },
+      { {  INT16_C(  5746),  INT16_C( 13301),  INT16_C( 28039),  INT16_C( 20160) },
+        { -INT16_C( 28874),  INT16_C( 28746),  INT16_C( 10119),  INT16_C(  2228) },
+        {  INT16_C( 19632),  INT16_C( 10984), -INT16_C( 20681), -INT16_C( 24260) } } },
+    { { -INT16_C( 29182), -INT16_C(  5731), -INT16_C( 26666), -INT16_C( 30684),  INT16_C(  2943), -INT16_C( 11803), -INT16_C( 16329),  INT16_C( 32191),
+         INT16_C( 31526), -INT16_C(  9145), -INT16_C( 25301),  INT16_C( 25549) },
+      { { -INT16_C( 29182), -INT16_C(  5731), -INT16_C( 26666), -INT16_C( 30684) },
+        {  INT16_C(  2943), -INT16_C( 11803), -INT16_C( 16329),  INT16_C( 32191) },
+        {  INT16_C( 31526), -INT16_C(  9145), -INT16_C( 25301),  INT16_C( 25549) } } },
+    { {  INT16_C(  1748), -INT16_C( 16870), -INT16_C(  5886), -INT16_C( 14467),  INT16_C(  2652), -INT16_C( 32213), -INT16_C( 30691),  INT16_C( 25561),
+         INT16_C( 27267),  INT16_C(  7270),  INT16_C( 17624),  INT16_C( 23241) },
+      { {  INT16_C(  1748), -INT16_C( 16870), -INT16_C(  5886), -INT16_C( 14467) },
+        {  INT16_C(  2652), -INT16_C( 32213), -INT16_C( 30691),  INT16_C( 25561) },
+        {  INT16_C( 27267),  INT16_C(  7270),  INT16_C( 17624),  INT16_C( 23241) } } },
+    { {  INT16_C(  6613), -INT16_C(  1040),  INT16_C( 16130),  INT16_C( 20350), -INT16_C( 12375), -INT16_C(  3633),  INT16_C( 10677),  INT16_C( 21647),
+         INT16_C( 26893),  INT16_C( 21030), -INT16_C(  7410), -INT16_C( 24906) },
+      { {  INT16_C(  6613), -INT16_C(  1040),  INT16_C( 16130),  INT16_C( 20350) },
+        { -INT16_C( 12375), -INT16_C(  3633),  INT16_C( 10677),  INT16_C( 21647) },
+        {  INT16_C( 26893),  INT16_C( 21030), -INT16_C(  7410), -INT16_C( 24906) } } },
+    { {  INT16_C( 19243), -INT16_C(  3490), -INT16_C(  9975), -INT16_C( 22498),  INT16_C(  7663), -INT16_C( 21712),  INT16_C( 21639),  INT16_C( 24233),
+         INT16_C( 24693), -INT16_C( 11445),  INT16_C(  3808),  INT16_C( 24015) },
+      { {  INT16_C( 19243), -INT16_C(  3490), -INT16_C(  9975), -INT16_C( 22498) },
+        {  INT16_C(  7663), -INT16_C( 21712),  INT16_C( 21639),  INT16_C( 24233) },
+        {  INT16_C( 24693), -INT16_C( 11445),  INT16_C(  3808),  INT16_C( 24015) } } },
+    { {  INT16_C( 10350), -INT16_C(  9478), -INT16_C( 27592),  INT16_C( 23428),  INT16_C( 25779), -INT16_C( 12136),  INT16_C(   116),  INT16_C( 29358),
+         INT16_C( 16405),  INT16_C(  7065),  INT16_C( 17067), -INT16_C( 21620) },
+      { {  INT16_C( 10350), -INT16_C(  9478), -INT16_C( 27592),  INT16_C( 23428) },
+        {  INT16_C( 25779), -INT16_C( 12136),  INT16_C(   116),  INT16_C( 29358) },
+        {  INT16_C( 16405),  INT16_C(  7065),  INT16_C( 17067), -INT16_C( 21620) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x3_t r = simde_vld1_s16_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[2], simde_vld1_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a[12];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int16x4x3_t r = simde_vld1_s16_x3(a);
+
+    simde_test_codegen_write_vi16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[6];
+    int32_t r[3][2];
+  } test_vec[] = {
+    { {  INT32_C(  1775308920),  INT32_C(    16803740), -INT32_C(  1908736529), -INT32_C(   865804526),  INT32_C(  1879673218),  INT32_C(  1327530046) },
+      { {  INT32_C(  1775308920),  INT32_C(    16803740) },
+        { -INT32_C(  1908736529), -INT32_C(   865804526) },
+        {  INT32_C(  1879673218),  INT32_C(  1327530046) } } },
+    { { -INT32_C(   658358226),  INT32_C(   329927382), -INT32_C(   677905488), -INT32_C(   725071949), -INT32_C(  1261986838),  INT32_C(  1553339797) },
+      { { -INT32_C(   658358226),  INT32_C(   329927382) },
+        { -INT32_C(   677905488), -INT32_C(   725071949) },
+        { -INT32_C(  1261986838),  INT32_C(  1553339797) } } },
+    { {  INT32_C(  1959953395),  INT32_C(  1433876140), -INT32_C(   337897795), -INT32_C(  1970168340),  INT32_C(  1247077106), -INT32_C(  1278512437) },
+      { {  INT32_C(  1959953395),  INT32_C(  1433876140) },
+        { -INT32_C(   337897795), -INT32_C(  1970168340) },
+        {  INT32_C(  1247077106), -INT32_C(  1278512437) } } },
+    { {  INT32_C(  1795855878), -INT32_C(  2006930119),  INT32_C(   388328262), -INT32_C(  2144328793),  INT32_C(  1842957277),  INT32_C(   833806739) },
+      { {  INT32_C(  1795855878), -INT32_C(  2006930119) },
+        {  INT32_C(   388328262), -INT32_C(  2144328793) },
+        {  INT32_C(  1842957277),  INT32_C(   833806739) } } },
+    { { -INT32_C(    19858106), -INT32_C(   533527756), -INT32_C(    79241461), -INT32_C(  1968427980),  INT32_C(  1310404707),  INT32_C(   432676948) },
+      { { -INT32_C(    19858106), -INT32_C(   533527756) },
+        { -INT32_C(    79241461), -INT32_C(  1968427980) },
+        {  INT32_C(  1310404707),  INT32_C(   432676948) } } },
+    { {  INT32_C(  1964414043),  INT32_C(   595064672),  INT32_C(  1043820221), -INT32_C(  1058998946),  INT32_C(  2029118672), -INT32_C(   641455661) },
+      { {  INT32_C(  1964414043),  INT32_C(   595064672) },
+        {  INT32_C(  1043820221), -INT32_C(  1058998946) },
+        {  INT32_C(  2029118672), -INT32_C(   641455661) } } },
+    { { -INT32_C(   944946709), -INT32_C(  1868106874),  INT32_C(  1205582539),  INT32_C(   865230975), -INT32_C(    29643843), -INT32_C(    49536489) },
+      { { -INT32_C(   944946709), -INT32_C(  1868106874) },
+        {  INT32_C(  1205582539),  INT32_C(   865230975) },
+        { -INT32_C(    29643843), -INT32_C(    49536489) } } },
+    { { -INT32_C(    25104853), -INT32_C(   921741045), -INT32_C(  1083531414),  INT32_C(   801511669),  INT32_C(   607284949), -INT32_C(  1749223933) },
+      { { -INT32_C(    25104853), -INT32_C(   921741045) },
+        { -INT32_C(  1083531414),  INT32_C(   801511669) },
+        {  INT32_C(   607284949), -INT32_C(  1749223933) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x3_t r = simde_vld1_s32_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[2], simde_vld1_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a[6];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int32x2x3_t r = simde_vld1_s32_x3(a);
+
+    simde_test_codegen_write_vi32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[3];
+    int64_t r[3][1];
+  } test_vec[] = {
+    { { -INT64_C( 5956920893940898420), -INT64_C( 4514603995137750250),  INT64_C( 3954705559883552531) },
+      { { -INT64_C( 5956920893940898420) },
+        { -INT64_C( 4514603995137750250) },
+        {  INT64_C( 3954705559883552531) } } },
+    { {  INT64_C( 5052877740489053175), -INT64_C( 4307520805675540775),  INT64_C( 1641916546091791913) },
+      { {  INT64_C( 5052877740489053175) },
+        { -INT64_C( 4307520805675540775) },
+        {  INT64_C( 1641916546091791913) } } },
+    { { -INT64_C(  369415167161617213), -INT64_C( 5432542314823417323), -INT64_C( 5505701691060363240) },
+      { { -INT64_C(  369415167161617213) },
+        { -INT64_C( 5432542314823417323) },
+        { -INT64_C( 5505701691060363240) } } },
+    { {  INT64_C( 5130810877897809673), -INT64_C( 7478200508687956459),  INT64_C( 5951260328698868565) },
+      { {  INT64_C( 5130810877897809673) },
+        { -INT64_C( 7478200508687956459) },
+        {  INT64_C( 5951260328698868565) } } },
+    { { -INT64_C( 5157725234357533701), -INT64_C( 5892013374464502203), -INT64_C(  981168174615784212) },
+      { { -INT64_C( 5157725234357533701) },
+        { -INT64_C( 5892013374464502203) },
+        { -INT64_C(  981168174615784212) } } },
+    { {  INT64_C( 6009184316323741422), -INT64_C( 6383343066836228232),  INT64_C( 5403714486970801919) },
+      { {  INT64_C( 6009184316323741422) },
+        { -INT64_C( 6383343066836228232) },
+        {  INT64_C( 5403714486970801919) } } },
+    { { -INT64_C( 9068250955181170750),  INT64_C( 3561724221716944589), -INT64_C( 6893717289603352321) },
+      { { -INT64_C( 9068250955181170750) },
+        {  INT64_C( 3561724221716944589) },
+        { -INT64_C( 6893717289603352321) } } },
+    { { -INT64_C(  931510480956576858),  INT64_C( 2732337026965707274), -INT64_C( 8426682289302649258) },
+      { { -INT64_C(  931510480956576858) },
+        {  INT64_C( 2732337026965707274) },
+        { -INT64_C( 8426682289302649258) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x3_t r = simde_vld1_s64_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[2], simde_vld1_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a[3];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int64x1x3_t r = simde_vld1_s64_x3(a);
+
+    simde_test_codegen_write_vi64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[24];
+    uint8_t r[3][8];
+  } test_vec[] = {
+    { { UINT8_C(246), UINT8_C( 33), UINT8_C( 41), UINT8_C(100), UINT8_C(212), UINT8_C(142), UINT8_C(211), UINT8_C( 60),
+        UINT8_C(228), UINT8_C(241), UINT8_C(170), UINT8_C( 87), UINT8_C(206), UINT8_C(180), UINT8_C(216), UINT8_C( 56),
+        UINT8_C( 13), UINT8_C( 95), UINT8_C(192), UINT8_C(153), UINT8_C(218), UINT8_C(224), UINT8_C(239), UINT8_C(146) },
+      { { UINT8_C(246), UINT8_C( 33), UINT8_C( 41), UINT8_C(100), UINT8_C(212), UINT8_C(142), UINT8_C(211), UINT8_C( 60) },
+        { UINT8_C(228), UINT8_C(241), UINT8_C(170), UINT8_C( 87), UINT8_C(206), UINT8_C(180), UINT8_C(216), UINT8_C( 56) },
+        { UINT8_C( 13), UINT8_C( 95), UINT8_C(192), UINT8_C(153), UINT8_C(218), UINT8_C(224), UINT8_C(239), UINT8_C(146) } } },
+    { { UINT8_C(162), UINT8_C( 43), UINT8_C(115), UINT8_C( 58), UINT8_C( 96), UINT8_C(202), UINT8_C(140), UINT8_C(126),
+        UINT8_C(100), UINT8_C(230), UINT8_C(105), UINT8_C( 11), UINT8_C(213), UINT8_C(140), UINT8_C(182), UINT8_C(235),
+        UINT8_C(112), UINT8_C(193), UINT8_C(180), UINT8_C(231), UINT8_C( 11), UINT8_C(120), UINT8_C(193), UINT8_C(216) },
+      { { UINT8_C(162), UINT8_C( 43), UINT8_C(115), UINT8_C( 58), UINT8_C( 96), UINT8_C(202), UINT8_C(140), UINT8_C(126) },
+        { UINT8_C(100), UINT8_C(230), UINT8_C(105), UINT8_C( 11), UINT8_C(213), UINT8_C(140), UINT8_C(182), UINT8_C(235) },
+        { UINT8_C(112), UINT8_C(193), UINT8_C(180), UINT8_C(231), UINT8_C( 11), UINT8_C(120), UINT8_C(193), UINT8_C(216) } } },
+    { { UINT8_C(124), UINT8_C( 49), UINT8_C( 94), UINT8_C(151), UINT8_C(254), UINT8_C( 97), UINT8_C( 62), UINT8_C( 63),
+        UINT8_C( 58), UINT8_C(216), UINT8_C(251), UINT8_C(110), UINT8_C(192), UINT8_C( 88), UINT8_C( 66), UINT8_C( 44),
+        UINT8_C(186), UINT8_C(191), UINT8_C(228), UINT8_C(135), UINT8_C(156), UINT8_C(235), UINT8_C( 68), UINT8_C(112) },
+      { { UINT8_C(124), UINT8_C( 49), UINT8_C( 94), UINT8_C(151), UINT8_C(254), UINT8_C( 97), UINT8_C( 62), UINT8_C( 63) },
+        { UINT8_C( 58), UINT8_C(216), UINT8_C(251), UINT8_C(110), UINT8_C(192), UINT8_C( 88), UINT8_C( 66), UINT8_C( 44) },
+        { UINT8_C(186), UINT8_C(191), UINT8_C(228), UINT8_C(135), UINT8_C(156), UINT8_C(235), UINT8_C( 68), UINT8_C(112) } } },
+    { { UINT8_C( 69), UINT8_C( 24), UINT8_C(132), UINT8_C( 90), UINT8_C(108), UINT8_C( 28),    UINT8_MAX, UINT8_C(149),
+        UINT8_C( 96), UINT8_C( 48), UINT8_C(184), UINT8_C(141), UINT8_C( 83), UINT8_C( 84), UINT8_C(  9), UINT8_C(169),
+        UINT8_C( 17), UINT8_C(122), UINT8_C(243), UINT8_C(129), UINT8_C(106), UINT8_C(236), UINT8_C(178), UINT8_C(158) },
+      { { UINT8_C( 69), UINT8_C( 24), UINT8_C(132), UINT8_C( 90), UINT8_C(108), UINT8_C( 28),    UINT8_MAX, UINT8_C(149) },
+        { UINT8_C( 96), UINT8_C( 48), UINT8_C(184), UINT8_C(141), UINT8_C( 83), UINT8_C( 84), UINT8_C(  9), UINT8_C(169) },
+        { UINT8_C( 17), UINT8_C(122), UINT8_C(243), UINT8_C(129), UINT8_C(106), UINT8_C(236), UINT8_C(178), UINT8_C(158) } } },
+    { { UINT8_C( 96), UINT8_C(157), UINT8_C( 46), UINT8_C( 55), UINT8_C( 91), UINT8_C( 67), UINT8_C(162), UINT8_C(188),
+        UINT8_C(136), UINT8_C(  8), UINT8_C(115), UINT8_C(215), UINT8_C(127), UINT8_C(139), UINT8_C(109), UINT8_C( 29),
+        UINT8_C(219), UINT8_C(168), UINT8_C( 35), UINT8_C(215), UINT8_C( 77), UINT8_C(159), UINT8_C( 14), UINT8_C( 77) },
+      { { UINT8_C( 96), UINT8_C(157), UINT8_C( 46), UINT8_C( 55), UINT8_C( 91), UINT8_C( 67), UINT8_C(162), UINT8_C(188) },
+        { UINT8_C(136), UINT8_C(  8), UINT8_C(115), UINT8_C(215), UINT8_C(127), UINT8_C(139), UINT8_C(109), UINT8_C( 29) },
+        { UINT8_C(219), UINT8_C(168), UINT8_C( 35), UINT8_C(215), UINT8_C( 77), UINT8_C(159), UINT8_C( 14), UINT8_C( 77) } } },
+    { { UINT8_C(223), UINT8_C(149), UINT8_C( 81), UINT8_C( 17), UINT8_C(195), UINT8_C( 30), UINT8_C(  6), UINT8_C(  3),
+        UINT8_C(191), UINT8_C(234), UINT8_C( 28), UINT8_C(151), UINT8_C( 85), UINT8_C( 18), UINT8_C( 95), UINT8_C(196),
+        UINT8_C(139), UINT8_C(146), UINT8_C(208), UINT8_C( 55), UINT8_C(236), UINT8_C( 61), UINT8_C(189), UINT8_C( 58) },
+      { { UINT8_C(223), UINT8_C(149), UINT8_C( 81), UINT8_C( 17), UINT8_C(195), UINT8_C( 30), UINT8_C(  6), UINT8_C(  3) },
+        { UINT8_C(191), UINT8_C(234), UINT8_C( 28), UINT8_C(151), UINT8_C( 85), UINT8_C( 18), UINT8_C( 95), UINT8_C(196) },
+        { UINT8_C(139), UINT8_C(146), UINT8_C(208), UINT8_C( 55), UINT8_C(236), UINT8_C( 61), UINT8_C(189), UINT8_C( 58) } } },
+    { { UINT8_C(166), UINT8_C(166), UINT8_C(234), UINT8_C(183), UINT8_C( 97), UINT8_C(169), UINT8_C( 90), UINT8_C( 71),
+        UINT8_C( 16), UINT8_C(177), UINT8_C(129), UINT8_C(140), UINT8_C(204), UINT8_C(131), UINT8_C( 18), UINT8_C(208),
+        UINT8_C(134), UINT8_C( 80), UINT8_C(171), UINT8_C( 37), UINT8_C(114), UINT8_C( 63), UINT8_C( 65), UINT8_C(142) },
+      { { UINT8_C(166), UINT8_C(166), UINT8_C(234), UINT8_C(183), UINT8_C( 97), UINT8_C(169), UINT8_C( 90), UINT8_C( 71) },
+        { UINT8_C( 16), UINT8_C(177), UINT8_C(129), UINT8_C(140), UINT8_C(204), UINT8_C(131), UINT8_C( 18), UINT8_C(208) },
+        { UINT8_C(134), UINT8_C( 80), UINT8_C(171), UINT8_C( 37), UINT8_C(114), UINT8_C( 63), UINT8_C( 65), UINT8_C(142) } } },
+    { { UINT8_C(238), UINT8_C(127), UINT8_C(197), UINT8_C( 67), UINT8_C( 11), UINT8_C(156), UINT8_C( 70), UINT8_C(168),
+        UINT8_C(125), UINT8_C( 18), UINT8_C(104), UINT8_C( 48), UINT8_C(170), UINT8_C( 46), UINT8_C( 84), UINT8_C(176),
+        UINT8_C( 63), UINT8_C( 47), UINT8_C( 55), UINT8_C(239), UINT8_C(105), UINT8_C( 94), UINT8_C(219), UINT8_C(100) },
+      { { UINT8_C(238), UINT8_C(127), UINT8_C(197), UINT8_C( 67), UINT8_C( 11), UINT8_C(156), UINT8_C( 70), UINT8_C(168) },
+        { UINT8_C(125), UINT8_C( 18), UINT8_C(104), UINT8_C( 48), UINT8_C(170), UINT8_C( 46), UINT8_C( 84), UINT8_C(176) },
+        { UINT8_C( 63), UINT8_C( 47), UINT8_C( 55), UINT8_C(239), UINT8_C(105), UINT8_C( 94), UINT8_C(219), UINT8_C(100) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x3_t r = simde_vld1_u8_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[2], simde_vld1_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[24];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x8x3_t r = simde_vld1_u8_x3(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[12];
+    uint16_t r[3][4];
+  } test_vec[] = {
+    { { UINT16_C(34508), UINT16_C(56164), UINT16_C(14286), UINT16_C(25369), UINT16_C(30796), UINT16_C(12082), UINT16_C(10523), UINT16_C(47190),
+        UINT16_C(13406), UINT16_C( 6872), UINT16_C(36280), UINT16_C(18517) },
+      { { UINT16_C(34508), UINT16_C(56164), UINT16_C(14286), UINT16_C(25369) },
+        { UINT16_C(30796), UINT16_C(12082), UINT16_C(10523), UINT16_C(47190) },
+        { UINT16_C(13406), UINT16_C( 6872), UINT16_C(36280), UINT16_C(18517) } } },
+    { { UINT16_C(58094), UINT16_C(51805), UINT16_C(54448), UINT16_C(17014), UINT16_C(61405), UINT16_C(35041), UINT16_C(59732), UINT16_C(13279),
+        UINT16_C(18513), UINT16_C( 7609), UINT16_C( 1952), UINT16_C(10330) },
+      { { UINT16_C(58094), UINT16_C(51805), UINT16_C(54448), UINT16_C(17014) },
+        { UINT16_C(61405), UINT16_C(35041), UINT16_C(59732), UINT16_C(13279) },
+        { UINT16_C(18513), UINT16_C( 7609), UINT16_C( 1952), UINT16_C(10330) } } },
+    { { UINT16_C(58633), UINT16_C( 8867), UINT16_C(58943), UINT16_C(38864), UINT16_C( 6387), UINT16_C(36897), UINT16_C(13306), UINT16_C(39507),
+        UINT16_C(17957), UINT16_C(64922), UINT16_C(52252), UINT16_C(19719) },
+      { { UINT16_C(58633), UINT16_C( 8867), UINT16_C(58943), UINT16_C(38864) },
+        { UINT16_C( 6387), UINT16_C(36897), UINT16_C(13306), UINT16_C(39507) },
+        { UINT16_C(17957), UINT16_C(64922), UINT16_C(52252), UINT16_C(19719) } } },
+    { { UINT16_C(17073), UINT16_C(46729), UINT16_C( 9175), UINT16_C(14699), UINT16_C(62795), UINT16_C(42527), UINT16_C(10301), UINT16_C(16548),
+        UINT16_C(53045), UINT16_C(48562), UINT16_C(61983), UINT16_C(53702) },
+      { { UINT16_C(17073), UINT16_C(46729), UINT16_C( 9175), UINT16_C(14699) },
+        { UINT16_C(62795), UINT16_C(42527), UINT16_C(10301), UINT16_C(16548) },
+        { UINT16_C(53045), UINT16_C(48562), UINT16_C(61983), UINT16_C(53702) } } },
+    { { UINT16_C(26816), UINT16_C(33456), UINT16_C(23797), UINT16_C(13805), UINT16_C( 6568), UINT16_C(44939), UINT16_C(25203), UINT16_C( 8433),
+        UINT16_C(49750), UINT16_C(43584), UINT16_C(15665), UINT16_C(65064) },
+      { { UINT16_C(26816), UINT16_C(33456), UINT16_C(23797), UINT16_C(13805) },
+        { UINT16_C( 6568), UINT16_C(44939), UINT16_C(25203), UINT16_C( 8433) },
+        { UINT16_C(49750), UINT16_C(43584), UINT16_C(15665), UINT16_C(65064) } } },
+    { { UINT16_C( 8031), UINT16_C(26526), UINT16_C(45403), UINT16_C(41125), UINT16_C(51365), UINT16_C(57832), UINT16_C(14157), UINT16_C(51868),
+        UINT16_C(46115), UINT16_C(49607), UINT16_C(27626), UINT16_C(57303) },
+      { { UINT16_C( 8031), UINT16_C(26526), UINT16_C(45403), UINT16_C(41125) },
+        { UINT16_C(51365), UINT16_C(57832), UINT16_C(14157), UINT16_C(51868) },
+        { UINT16_C(46115), UINT16_C(49607), UINT16_C(27626), UINT16_C(57303) } } },
+    { { UINT16_C(26991), UINT16_C( 2931), UINT16_C(23883), UINT16_C(10734), UINT16_C(15012), UINT16_C(24125), UINT16_C(64368), UINT16_C(11117),
+        UINT16_C(40186), UINT16_C( 2858), UINT16_C(42553), UINT16_C(  635) },
+      { { UINT16_C(26991), UINT16_C( 2931), UINT16_C(23883), UINT16_C(10734) },
+        { UINT16_C(15012), UINT16_C(24125), UINT16_C(64368), UINT16_C(11117) },
+        { UINT16_C(40186), UINT16_C( 2858), UINT16_C(42553), UINT16_C(  635) } } },
+    { { UINT16_C(59583), UINT16_C(24962), UINT16_C(43668), UINT16_C(18805), UINT16_C( 3933), UINT16_C( 6762), UINT16_C(14904), UINT16_C(64286),
+        UINT16_C( 6173), UINT16_C( 4353), UINT16_C( 2433), UINT16_C( 2764) },
+      { { UINT16_C(59583), UINT16_C(24962), UINT16_C(43668), UINT16_C(18805) },
+        { UINT16_C( 3933), UINT16_C( 6762), UINT16_C(14904), UINT16_C(64286) },
+        { UINT16_C( 6173), UINT16_C( 4353), UINT16_C( 2433), UINT16_C( 2764) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x3_t r = simde_vld1_u16_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[2], simde_vld1_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a[12];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint16x4x3_t r = simde_vld1_u16_x3(a);
+
+    simde_test_codegen_write_vu16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[6];
+    uint32_t r[3][2];
+  } test_vec[] = {
+    { { UINT32_C( 454250690), UINT32_C( 625855798), UINT32_C(2908149421), UINT32_C(2836903361), UINT32_C(2749062193), UINT32_C( 413551273) },
+      { { UINT32_C( 454250690), UINT32_C( 625855798) },
+        { UINT32_C(2908149421), UINT32_C(2836903361) },
+        { UINT32_C(2749062193), UINT32_C( 413551273) } } },
+    { { UINT32_C(1478763770), UINT32_C(3263982211), UINT32_C(4020138362), UINT32_C(1176249778), UINT32_C( 202693806), UINT32_C(3144061968) },
+      { { UINT32_C(1478763770), UINT32_C(3263982211) },
+        { UINT32_C(4020138362), UINT32_C(1176249778) },
+        { UINT32_C( 202693806), UINT32_C(3144061968) } } },
+    { { UINT32_C(2146031471), UINT32_C(3984058595), UINT32_C(4151556022), UINT32_C( 145739055), UINT32_C(3905721604), UINT32_C( 831927705) },
+      { { UINT32_C(2146031471), UINT32_C(3984058595) },
+        { UINT32_C(4151556022), UINT32_C( 145739055) },
+        { UINT32_C(3905721604), UINT32_C( 831927705) } } },
+    { { UINT32_C(3641639505), UINT32_C(3928474427), UINT32_C(2893714641), UINT32_C( 389179039), UINT32_C(2930651580), UINT32_C(2987582546) },
+      { { UINT32_C(3641639505), UINT32_C(3928474427) },
+        { UINT32_C(2893714641), UINT32_C( 389179039) },
+        { UINT32_C(2930651580), UINT32_C(2987582546) } } },
+    { { UINT32_C(3643828214), UINT32_C( 435987921), UINT32_C( 406977038), UINT32_C(2213770598), UINT32_C(1954543970), UINT32_C(3280923646) },
+      { { UINT32_C(3643828214), UINT32_C( 435987921) },
+        { UINT32_C( 406977038), UINT32_C(2213770598) },
+        { UINT32_C(1954543970), UINT32_C(3280923646) } } },
+    { { UINT32_C(1769509402), UINT32_C(4195682546), UINT32_C(3902152650), UINT32_C(2479636229), UINT32_C(4136380030), UINT32_C( 665081580) },
+      { { UINT32_C(1769509402), UINT32_C(4195682546) },
+        { UINT32_C(3902152650), UINT32_C(2479636229) },
+        { UINT32_C(4136380030), UINT32_C( 665081580) } } },
+    { { UINT32_C(3973531472), UINT32_C(2165148397), UINT32_C(3253601713), UINT32_C(1488789447), UINT32_C( 918730380), UINT32_C(2655390733) },
+      { { UINT32_C(3973531472), UINT32_C(2165148397) },
+        { UINT32_C(3253601713), UINT32_C(1488789447) },
+        { UINT32_C( 918730380), UINT32_C(2655390733) } } },
+    { { UINT32_C( 942821150), UINT32_C( 726072658), UINT32_C(2377676258), UINT32_C( 434947622), UINT32_C( 114540342), UINT32_C(1690162541) },
+      { { UINT32_C( 942821150), UINT32_C( 726072658) },
+        { UINT32_C(2377676258), UINT32_C( 434947622) },
+        { UINT32_C( 114540342), UINT32_C(1690162541) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x3_t r = simde_vld1_u32_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[2], simde_vld1_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[6];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x2x3_t r = simde_vld1_u32_x3(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[3];
+    uint64_t r[3][1];
+  } test_vec[] = {
+    { { UINT64_C( 3524510108090017891), UINT64_C( 7569842531441713889), UINT64_C(  875726442554470629) },
+      { { UINT64_C( 3524510108090017891) },
+        { UINT64_C( 7569842531441713889) },
+        { UINT64_C(  875726442554470629) } } },
+    { { UINT64_C( 8390762495219029984), UINT64_C( 8361706403408582458), UINT64_C(12470082282208949623) },
+      { { UINT64_C( 8390762495219029984) },
+        { UINT64_C( 8361706403408582458) },
+        { UINT64_C(12470082282208949623) } } },
+    { { UINT64_C(10579846978323483605), UINT64_C( 5399504909793776701), UINT64_C( 3226441545306129110) },
+      { { UINT64_C(10579846978323483605) },
+        { UINT64_C( 5399504909793776701) },
+        { UINT64_C( 3226441545306129110) } } },
+    { { UINT64_C(12008703703655910694), UINT64_C( 6880984103591796354), UINT64_C( 2722576237261508491) },
+      { { UINT64_C(12008703703655910694) },
+        { UINT64_C( 6880984103591796354) },
+        { UINT64_C( 2722576237261508491) } } },
+    { { UINT64_C(16391576234781209480), UINT64_C(15643912295375782921), UINT64_C(11959822566596053326) },
+      { { UINT64_C(16391576234781209480) },
+        { UINT64_C(15643912295375782921) },
+        { UINT64_C(11959822566596053326) } } },
+    { { UINT64_C(13955877587441335584), UINT64_C( 2401459756992672477), UINT64_C(  933097548770001603) },
+      { { UINT64_C(13955877587441335584) },
+        { UINT64_C( 2401459756992672477) },
+        { UINT64_C(  933097548770001603) } } },
+    { { UINT64_C( 2668499337496575989), UINT64_C( 9644577916954527776), UINT64_C(16582574946202376956) },
+      { { UINT64_C( 2668499337496575989) },
+        { UINT64_C( 9644577916954527776) },
+        { UINT64_C(16582574946202376956) } } },
+    { { UINT64_C(13148710448140263286), UINT64_C(  493232085162664835), UINT64_C(11954233906932111385) },
+      { { UINT64_C(13148710448140263286) },
+        { UINT64_C(  493232085162664835) },
+        { UINT64_C(11954233906932111385) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x3_t r = simde_vld1_u64_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[2], simde_vld1_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[3];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x1x3_t r = simde_vld1_u64_x3(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_f32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[12];
+    simde_float32 r[3][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -280.04), SIMDE_FLOAT32_C(   524.81), SIMDE_FLOAT32_C(   -44.69), SIMDE_FLOAT32_C(    73.43),
+        SIMDE_FLOAT32_C(  -769.03), SIMDE_FLOAT32_C(   316.96), SIMDE_FLOAT32_C(  -528.66), SIMDE_FLOAT32_C(   815.78),
+        SIMDE_FLOAT32_C(  -453.06), SIMDE_FLOAT32_C(   525.87), SIMDE_FLOAT32_C(  -964.64), SIMDE_FLOAT32_C(   568.14) },
+      { { SIMDE_FLOAT32_C(  -280.04), SIMDE_FLOAT32_C(   524.81), SIMDE_FLOAT32_C(   -44.69), SIMDE_FLOAT32_C(    73.43) },
+        { SIMDE_FLOAT32_C(  -769.03), SIMDE_FLOAT32_C(   316.96), SIMDE_FLOAT32_C(  -528.66), SIMDE_FLOAT32_C(   815.78) },
+        { SIMDE_FLOAT32_C(  -453.06), SIMDE_FLOAT32_C(   525.87), SIMDE_FLOAT32_C(  -964.64), SIMDE_FLOAT32_C(   568.14) } } },
+    { { SIMDE_FLOAT32_C(   846.05), SIMDE_FLOAT32_C(   252.06), SIMDE_FLOAT32_C(   796.59), SIMDE_FLOAT32_C(   -63.92),
+        SIMDE_FLOAT32_C(   -28.14), SIMDE_FLOAT32_C(   892.14), SIMDE_FLOAT32_C(  -637.55), SIMDE_FLOAT32_C(  -797.65),
+        SIMDE_FLOAT32_C(   594.73), SIMDE_FLOAT32_C(  -625.91), SIMDE_FLOAT32_C(   756.90), SIMDE_FLOAT32_C(   284.10) },
+      { { SIMDE_FLOAT32_C(   846.05), SIMDE_FLOAT32_C(   252.06), SIMDE_FLOAT32_C(   796.59), SIMDE_FLOAT32_C(   -63.92) },
+        { SIMDE_FLOAT32_C(   -28.14), SIMDE_FLOAT32_C(   892.14), SIMDE_FLOAT32_C(  -637.55), SIMDE_FLOAT32_C(  -797.65) },
+        { SIMDE_FLOAT32_C(   594.73), SIMDE_FLOAT32_C(  -625.91), SIMDE_FLOAT32_C(   756.90), SIMDE_FLOAT32_C(   284.10) } } },
+    { { SIMDE_FLOAT32_C(   699.68), SIMDE_FLOAT32_C(   512.98), SIMDE_FLOAT32_C(   115.22), SIMDE_FLOAT32_C(   282.34),
+        SIMDE_FLOAT32_C(   430.96), SIMDE_FLOAT32_C(   357.56), SIMDE_FLOAT32_C(  -811.66), SIMDE_FLOAT32_C(  -597.80),
+        SIMDE_FLOAT32_C(  -209.33), SIMDE_FLOAT32_C(   471.91), SIMDE_FLOAT32_C(  -285.56), SIMDE_FLOAT32_C(  -316.73) },
+      { { SIMDE_FLOAT32_C(   699.68), SIMDE_FLOAT32_C(   512.98), SIMDE_FLOAT32_C(   115.22), SIMDE_FLOAT32_C(   282.34) },
+        { SIMDE_FLOAT32_C(   430.96), SIMDE_FLOAT32_C(   357.56), SIMDE_FLOAT32_C(  -811.66), SIMDE_FLOAT32_C(  -597.80) },
+        { SIMDE_FLOAT32_C(  -209.33), SIMDE_FLOAT32_C(   471.91), SIMDE_FLOAT32_C(  -285.56), SIMDE_FLOAT32_C(  -316.73) } } },
+    { { SIMDE_FLOAT32_C(    53.40), SIMDE_FLOAT32_C(  -526.69), SIMDE_FLOAT32_C(  -973.44), SIMDE_FLOAT32_C(  -976.66),
+        SIMDE_FLOAT32_C(  -452.14), SIMDE_FLOAT32_C(   129.13), SIMDE_FLOAT32_C(    19.76), SIMDE_FLOAT32_C(  -396.23),
+        SIMDE_FLOAT32_C(  -861.43), SIMDE_FLOAT32_C(   148.77), SIMDE_FLOAT32_C(   472.66), SIMDE_FLOAT32_C(   203.28) },
+      { { SIMDE_FLOAT32_C(    53.40), SIMDE_FLOAT32_C(  -526.69), SIMDE_FLOAT32_C(  -973.44), SIMDE_FLOAT32_C(  -976.66) },
+        { SIMDE_FLOAT32_C(  -452.14), SIMDE_FLOAT32_C(   129.13), SIMDE_FLOAT32_C(    19.76), SIMDE_FLOAT32_C(  -396.23) },
+        { SIMDE_FLOAT32_C(  -861.43), SIMDE_FLOAT32_C(   148.77), SIMDE_FLOAT32_C(   472.66), SIMDE_FLOAT32_C(   203.28) } } },
+    { { SIMDE_FLOAT32_C(   561.04), SIMDE_FLOAT32_C(  -893.27), SIMDE_FLOAT32_C(  -935.05), SIMDE_FLOAT32_C(  -615.48),
+        SIMDE_FLOAT32_C(   357.67), SIMDE_FLOAT32_C(   120.98), SIMDE_FLOAT32_C(   132.25), SIMDE_FLOAT32_C(  -964.36),
+        SIMDE_FLOAT32_C(  -836.71), SIMDE_FLOAT32_C(  -541.61), SIMDE_FLOAT32_C(  -365.93), SIMDE_FLOAT32_C(  -848.19) },
+      { { SIMDE_FLOAT32_C(   561.04), SIMDE_FLOAT32_C(  -893.27), SIMDE_FLOAT32_C(  -935.05), SIMDE_FLOAT32_C(  -615.48) },
+        { SIMDE_FLOAT32_C(   357.67), SIMDE_FLOAT32_C(   120.98), SIMDE_FLOAT32_C(   132.25), SIMDE_FLOAT32_C(  -964.36) },
+        { SIMDE_FLOAT32_C(  -836.71), SIMDE_FLOAT32_C(  -541.61), SIMDE_FLOAT32_C(  -365.93), SIMDE_FLOAT32_C(  -848.19) } } },
+    { { SIMDE_FLOAT32_C(   853.61), SIMDE_FLOAT32_C(   731.94), SIMDE_FLOAT32_C(  -896.07), SIMDE_FLOAT32_C(   735.97),
+        SIMDE_FLOAT32_C(   322.67), SIMDE_FLOAT32_C(   253.14), SIMDE_FLOAT32_C(  -162.08), SIMDE_FLOAT32_C(  -762.39),
+        SIMDE_FLOAT32_C(   604.46), SIMDE_FLOAT32_C(  -503.61), SIMDE_FLOAT32_C(  -423.29), SIMDE_FLOAT32_C(  -737.59) },
+      { { SIMDE_FLOAT32_C(   853.61), SIMDE_FLOAT32_C(   731.94), SIMDE_FLOAT32_C(  -896.07), SIMDE_FLOAT32_C(   735.97) },
+        { SIMDE_FLOAT32_C(   322.67), SIMDE_FLOAT32_C(   253.14), SIMDE_FLOAT32_C(  -162.08), SIMDE_FLOAT32_C(  -762.39) },
+        { SIMDE_FLOAT32_C(   604.46), SIMDE_FLOAT32_C(  -503.61), SIMDE_FLOAT32_C(  -423.29), SIMDE_FLOAT32_C(  -737.59) } } },
+    { { SIMDE_FLOAT32_C(  -591.64), SIMDE_FLOAT32_C(  -801.75), SIMDE_FLOAT32_C(   177.89), SIMDE_FLOAT32_C(  -906.68),
+        SIMDE_FLOAT32_C(   718.56), SIMDE_FLOAT32_C(   933.41), SIMDE_FLOAT32_C(  -152.69), SIMDE_FLOAT32_C(  -765.20),
+        SIMDE_FLOAT32_C(   253.74), SIMDE_FLOAT32_C(   902.62), SIMDE_FLOAT32_C(   286.76), SIMDE_FLOAT32_C(  -240.30) },
+      { { SIMDE_FLOAT32_C(  -591.64), SIMDE_FLOAT32_C(  -801.75), SIMDE_FLOAT32_C(   177.89), SIMDE_FLOAT32_C(  -906.68) },
+        { SIMDE_FLOAT32_C(   718.56), SIMDE_FLOAT32_C(   933.41), SIMDE_FLOAT32_C(  -152.69), SIMDE_FLOAT32_C(  -765.20) },
+        { SIMDE_FLOAT32_C(   253.74), SIMDE_FLOAT32_C(   902.62), SIMDE_FLOAT32_C(   286.76), SIMDE_FLOAT32_C(  -240.30) } } },
+    { { SIMDE_FLOAT32_C(   258.23), SIMDE_FLOAT32_C(  -108.53), SIMDE_FLOAT32_C(   882.75), SIMDE_FLOAT32_C(  -957.94),
+        SIMDE_FLOAT32_C(   824.04), SIMDE_FLOAT32_C(  -353.69), SIMDE_FLOAT32_C(   690.54), SIMDE_FLOAT32_C(  -494.95),
+        SIMDE_FLOAT32_C(   298.39), SIMDE_FLOAT32_C(  -765.75), SIMDE_FLOAT32_C(  -164.33), SIMDE_FLOAT32_C(   -75.98) },
+      { { SIMDE_FLOAT32_C(   258.23), SIMDE_FLOAT32_C(  -108.53), SIMDE_FLOAT32_C(   882.75), SIMDE_FLOAT32_C(  -957.94) },
+        { SIMDE_FLOAT32_C(   824.04), SIMDE_FLOAT32_C(  -353.69), SIMDE_FLOAT32_C(   690.54), SIMDE_FLOAT32_C(  -494.95) },
+        { SIMDE_FLOAT32_C(   298.39), SIMDE_FLOAT32_C(  -765.75), SIMDE_FLOAT32_C(  -164.33), SIMDE_FLOAT32_C(   -75.98) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x3_t r = simde_vld1q_f32_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[2], simde_vld1q_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a[12];
+    simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, -1000.0f, 1000.0f);
+    simde_float32x4x3_t r = simde_vld1q_f32_x3(a);
+
+    simde_test_codegen_write_vf32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_f64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[6];
+    simde_float64 r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -308.54), SIMDE_FLOAT64_C(  -152.19), SIMDE_FLOAT64_C(  -905.34), SIMDE_FLOAT64_C(   690.80),
+        SIMDE_FLOAT64_C(   542.49), SIMDE_FLOAT64_C(   176.07) },
+      { { SIMDE_FLOAT64_C(  -308.54), SIMDE_FLOAT64_C(  -152.19) },
+        { SIMDE_FLOAT64_C(  -905.34), SIMDE_FLOAT64_C(   690.80) },
+        { SIMDE_FLOAT64_C(   542.49), SIMDE_FLOAT64_C(   176.07) } } },
+    { { SIMDE_FLOAT64_C(   417.75), SIMDE_FLOAT64_C(  -171.38), SIMDE_FLOAT64_C(   171.79), SIMDE_FLOAT64_C(   784.10),
+        SIMDE_FLOAT64_C(   154.88), SIMDE_FLOAT64_C(  -951.69) },
+      { { SIMDE_FLOAT64_C(   417.75), SIMDE_FLOAT64_C(  -171.38) },
+        { SIMDE_FLOAT64_C(   171.79), SIMDE_FLOAT64_C(   784.10) },
+        { SIMDE_FLOAT64_C(   154.88), SIMDE_FLOAT64_C(  -951.69) } } },
+    { { SIMDE_FLOAT64_C(  -691.76), SIMDE_FLOAT64_C(  -763.98), SIMDE_FLOAT64_C(   600.44), SIMDE_FLOAT64_C(  -219.83),
+        SIMDE_FLOAT64_C(   -96.48), SIMDE_FLOAT64_C(  -271.99) },
+      { { SIMDE_FLOAT64_C(  -691.76), SIMDE_FLOAT64_C(  -763.98) },
+        { SIMDE_FLOAT64_C(   600.44), SIMDE_FLOAT64_C(  -219.83) },
+        { SIMDE_FLOAT64_C(   -96.48), SIMDE_FLOAT64_C(  -271.99) } } },
+    { { SIMDE_FLOAT64_C(  -795.62), SIMDE_FLOAT64_C(  -289.07), SIMDE_FLOAT64_C(   278.95), SIMDE_FLOAT64_C(   802.82),
+        SIMDE_FLOAT64_C(  -177.44), SIMDE_FLOAT64_C(   798.21) },
+      { { SIMDE_FLOAT64_C(  -795.62), SIMDE_FLOAT64_C(  -289.07) },
+        { SIMDE_FLOAT64_C(   278.95), SIMDE_FLOAT64_C(   802.82) },
+        { SIMDE_FLOAT64_C(  -177.44), SIMDE_FLOAT64_C(   798.21) } } },
+    { { SIMDE_FLOAT64_C(  -172.57), SIMDE_FLOAT64_C(  -476.69), SIMDE_FLOAT64_C(   984.07), SIMDE_FLOAT64_C(  -566.49),
+        SIMDE_FLOAT64_C(   662.42), SIMDE_FLOAT64_C(  -812.50) },
+      { { SIMDE_FLOAT64_C(  -172.57), SIMDE_FLOAT64_C(  -476.69) },
+        { SIMDE_FLOAT64_C(   984.07), SIMDE_FLOAT64_C(  -566.49) },
+        { SIMDE_FLOAT64_C(   662.42), SIMDE_FLOAT64_C(  -812.50) } } },
+    { { SIMDE_FLOAT64_C(   409.13), SIMDE_FLOAT64_C(   -25.27), SIMDE_FLOAT64_C(   802.67), SIMDE_FLOAT64_C(  -874.95),
+        SIMDE_FLOAT64_C(  -956.76), SIMDE_FLOAT64_C(   184.31) },
+      { { SIMDE_FLOAT64_C(   409.13), SIMDE_FLOAT64_C(   -25.27) },
+        { SIMDE_FLOAT64_C(   802.67), SIMDE_FLOAT64_C(  -874.95) },
+        { SIMDE_FLOAT64_C(  -956.76), SIMDE_FLOAT64_C(   184.31) } } },
+    { { SIMDE_FLOAT64_C(  -874.45), SIMDE_FLOAT64_C(  -791.75), SIMDE_FLOAT64_C(  -618.86), SIMDE_FLOAT64_C(   656.68),
+        SIMDE_FLOAT64_C(  -771.59), SIMDE_FLOAT64_C(   379.15) },
+      { { SIMDE_FLOAT64_C(  -874.45), SIMDE_FLOAT64_C(  -791.75) },
+        { SIMDE_FLOAT64_C(  -618.86), SIMDE_FLOAT64_C(   656.68) },
+        { SIMDE_FLOAT64_C(  -771.59), SIMDE_FLOAT64_C(   379.15) } } },
+    { { SIMDE_FLOAT64_C(   320.75), SIMDE_FLOAT64_C(   407.82), SIMDE_FLOAT64_C(     5.25), SIMDE_FLOAT64_C(  -345.17),
+        SIMDE_FLOAT64_C(   231.94), SIMDE_FLOAT64_C(  -403.73) },
+      { { SIMDE_FLOAT64_C(   320.75), SIMDE_FLOAT64_C(   407.82) },
+        { SIMDE_FLOAT64_C(     5.25), SIMDE_FLOAT64_C(  -345.17) },
+        { SIMDE_FLOAT64_C(   231.94), SIMDE_FLOAT64_C(  -403.73) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x3_t r = simde_vld1q_f64_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[2], simde_vld1q_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a[6];
+    simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, -1000.0, 1000.0);
+    simde_float64x2x3_t r = simde_vld1q_f64_x3(a);
+
+    simde_test_codegen_write_vf64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[48];
+    int8_t r[3][16];
+  } test_vec[] = {
+    { { -INT8_C(   8), -INT8_C(  28),  INT8_C(  17), -INT8_C(  94), -INT8_C(  25), -INT8_C( 126),  INT8_C(  90),  INT8_C(  87),
+        -INT8_C(  50),  INT8_C(  42), -INT8_C(  44),  INT8_C(  44), -INT8_C(   6),  INT8_C( 113),  INT8_C(   0),  INT8_C(  61),
+         INT8_C(  27), -INT8_C( 109), -INT8_C(  65),  INT8_C(  44),  INT8_C(  83),  INT8_C( 114), -INT8_C(  54),  INT8_C(  25),
+        -INT8_C(  77), -INT8_C( 126), -INT8_C(  65),  INT8_C( 115), -INT8_C(  13), -INT8_C(  74),  INT8_C(   3),      INT8_MAX,
+         INT8_C(  19),  INT8_C(  68), -INT8_C(  10),  INT8_C(  83), -INT8_C(  68),  INT8_C(  59), -INT8_C(  76), -INT8_C( 112),
+         INT8_C(  10),  INT8_C( 103), -INT8_C(  50), -INT8_C(   3), -INT8_C(  76), -INT8_C(  63),  INT8_C( 118), -INT8_C( 113) },
+      { { -INT8_C(   8), -INT8_C(  28),  INT8_C(  17), -INT8_C(  94), -INT8_C(  25), -INT8_C( 126),  INT8_C(  90),  INT8_C(  87),
+          -INT8_C(  50),  INT8_C(  42), -INT8_C(  44),  INT8_C(  44), -INT8_C(   6),  INT8_C( 113),  INT8_C(   0),  INT8_C(  61) },
+        {  INT8_C(  27), -INT8_C( 109), -INT8_C(  65),  INT8_C(  44),  INT8_C(  83),  INT8_C( 114), -INT8_C(  54),  INT8_C(  25),
+          -INT8_C(  77), -INT8_C( 126), -INT8_C(  65),  INT8_C( 115), -INT8_C(  13), -INT8_C(  74),  INT8_C(   3),      INT8_MAX },
+        {  INT8_C(  19),  INT8_C(  68), -INT8_C(  10),  INT8_C(  83), -INT8_C(  68),  INT8_C(  59), -INT8_C(  76), -INT8_C( 112),
+           INT8_C(  10),  INT8_C( 103), -INT8_C(  50), -INT8_C(   3), -INT8_C(  76), -INT8_C(  63),  INT8_C( 118), -INT8_C( 113) } } },
+    { { -INT8_C(  17),  INT8_C(  87),  INT8_C(   6), -INT8_C(  39),  INT8_C(  89), -INT8_C(  66), -INT8_C(  62), -INT8_C(  60),
+         INT8_C( 109),  INT8_C(  81), -INT8_C(  12), -INT8_C(  46),  INT8_C(  58), -INT8_C(  95), -INT8_C(  31), -INT8_C(  26),
+        -INT8_C(  92), -INT8_C(  17), -INT8_C(  90), -INT8_C(  73), -INT8_C(   4), -INT8_C(  18), -INT8_C(  22), -INT8_C(  28),
+         INT8_C(  45),  INT8_C( 112), -INT8_C(  23),  INT8_C(  45),  INT8_C(  21), -INT8_C(   4), -INT8_C(  97),  INT8_C(  45),
+         INT8_C(  20),  INT8_C( 111),  INT8_C(  92),  INT8_C(  19), -INT8_C(  25), -INT8_C( 109), -INT8_C(  75), -INT8_C(  69),
+        -INT8_C(  75),  INT8_C( 124),  INT8_C(  39), -INT8_C( 107), -INT8_C(  21),  INT8_C(  98), -INT8_C(  67), -INT8_C(  68) },
+      { { -INT8_C(  17),  INT8_C(  87),  INT8_C(   6), -INT8_C(  39),  INT8_C(  89), -INT8_C(  66), -INT8_C(  62), -INT8_C(  60),
+           INT8_C( 109),  INT8_C(  81), -INT8_C(  12), -INT8_C(  46),  INT8_C(  58), -INT8_C(  95), -INT8_C(  31), -INT8_C(  26) },
+        { -INT8_C(  92), -INT8_C(  17), -INT8_C(  90), -INT8_C(  73), -INT8_C(   4), -INT8_C(  18), -INT8_C(  22), -INT8_C(  28),
+           INT8_C(  45),  INT8_C( 112), -INT8_C(  23),  INT8_C(  45),  INT8_C(  21), -INT8_C(   4), -INT8_C(  97),  INT8_C(  45) },
+        {  INT8_C(  20),  INT8_C( 111),  INT8_C(  92),  INT8_C(  19), -INT8_C(  25), -INT8_C( 109), -INT8_C(  75), -INT8_C(  69),
+          -INT8_C(  75),  INT8_C( 124),  INT8_C(  39), -INT8_C( 107), -INT8_C(  21),  INT8_C(  98), -INT8_C(  67), -INT8_C(  68) } } },
+    { { -INT8_C(  74),  INT8_C(  99),  INT8_C( 122), -INT8_C(  94),  INT8_C(  65),  INT8_C(  49), -INT8_C(  86), -INT8_C(  51),
+        -INT8_C( 117),  INT8_C( 125),  INT8_C( 116),  INT8_C( 106), -INT8_C(  43), -INT8_C(  10),  INT8_C( 102),  INT8_C(  86),
+        -INT8_C( 103), -INT8_C(  73), -INT8_C(   3),  INT8_C(  32),  INT8_C(  42), -INT8_C(  32),  INT8_C( 100),  INT8_C(   0),
+         INT8_C(   6),  INT8_C( 116), -INT8_C(  21),  INT8_C(  33),  INT8_C(  15), -INT8_C(  92), -INT8_C(  46), -INT8_C(  87),
+         INT8_C(  20),  INT8_C(  32),  INT8_C(   3), -INT8_C(  38), -INT8_C(  69), -INT8_C(  84), -INT8_C(  85),  INT8_C(  89),
+        -INT8_C( 118),  INT8_C(  16),  INT8_C( 122),  INT8_C(  25),  INT8_C(  42), -INT8_C(  64),  INT8_C(  17),  INT8_C(  91) },
+      { { -INT8_C(  74),  INT8_C(  99),  INT8_C( 122), -INT8_C(  94),  INT8_C(  65),  INT8_C(  49), -INT8_C(  86), -INT8_C(  51),
+          -INT8_C( 117),  INT8_C( 125),  INT8_C( 116),  INT8_C( 106), -INT8_C(  43), -INT8_C(  10),  INT8_C( 102),  INT8_C(  86) },
+        { -INT8_C( 103), -INT8_C(  73), -INT8_C(   3),  INT8_C(  32),  INT8_C(  42), -INT8_C(  32),  INT8_C( 100),  INT8_C(   0),
+           INT8_C(   6),  INT8_C( 116), -INT8_C(  21),  INT8_C(  33),  INT8_C(  15), -INT8_C(  92), -INT8_C(  46), -INT8_C(  87) },
+        {  INT8_C(  20),  INT8_C(  32),  INT8_C(   3), -INT8_C(  38), -INT8_C(  69), -INT8_C(  84), -INT8_C(  85),  INT8_C(  89),
+          -INT8_C( 118),  INT8_C(  16),  INT8_C( 122),  INT8_C(  25),  INT8_C(  42), -INT8_C(  64),  INT8_C(  17),  INT8_C(  91) } } },
+    { { -INT8_C( 116), -INT8_C(  97), -INT8_C(  82), -INT8_C(  66),  INT8_C( 100), -INT8_C(  33),  INT8_C(  94),  INT8_C( 120),
+         INT8_C(  87),  INT8_C( 123),  INT8_C(  42),  INT8_C( 113), -INT8_C( 100), -INT8_C( 126), -INT8_C( 126), -INT8_C(  39),
+        -INT8_C(  14),  INT8_C(  73), -INT8_C(  91), -INT8_C(  55), -INT8_C(  96), -INT8_C( 105),  INT8_C(  50),  INT8_C(  71),
+         INT8_C(  38), -INT8_C( 112),  INT8_C( 120),  INT8_C(   7),  INT8_C(  28),  INT8_C( 104),  INT8_C(   3), -INT8_C(  45),
+         INT8_C( 104),  INT8_C(  17),  INT8_C(   6),  INT8_C(  33), -INT8_C(  54), -INT8_C( 122), -INT8_C(  57), -INT8_C(   3),
+        -INT8_C( 100),  INT8_C(  30),  INT8_C(  48),  INT8_C( 125), -INT8_C(  70),  INT8_C(  53),  INT8_C( 125),  INT8_C(  23) },
+      { { -INT8_C( 116), -INT8_C(  97), -INT8_C(  82), -INT8_C(  66),  INT8_C( 100), -INT8_C(  33),  INT8_C(  94),  INT8_C( 120),
+           INT8_C(  87),  INT8_C( 123),  INT8_C(  42),  INT8_C( 113), -INT8_C( 100), -INT8_C( 126), -INT8_C( 126), -INT8_C(  39) },
+        { -INT8_C(  14),  INT8_C(  73), -INT8_C(  91), -INT8_C(  55), -INT8_C(  96), -INT8_C( 105),  INT8_C(  50),  INT8_C(  71),
+           INT8_C(  38), -INT8_C( 112),  INT8_C( 120),  INT8_C(   7),  INT8_C(  28),  INT8_C( 104),  INT8_C(   3), -INT8_C(  45) },
+        {  INT8_C( 104),  INT8_C(  17),  INT8_C(   6),  INT8_C(  33), -INT8_C(  54), -INT8_C( 122), -INT8_C(  57), -INT8_C(   3),
+          -INT8_C( 100),  INT8_C(  30),  INT8_C(  48),  INT8_C( 125), -INT8_C(  70),  INT8_C(  53),  INT8_C( 125),  INT8_C(  23) } } },
+    { {  INT8_C(  99), -INT8_C( 101),  INT8_C( 123), -INT8_C(  97), -INT8_C(  82),  INT8_C(  84), -INT8_C(  95),  INT8_C(  29),
+         INT8_C(  34),  INT8_C(  18),  INT8_C(  79),  INT8_C(  60), -INT8_C(  20),  INT8_C( 117), -INT8_C(  87), -INT8_C(  61),
+         INT8_C(  97), -INT8_C( 117), -INT8_C(  24), -INT8_C( 108), -INT8_C(  19),  INT8_C(  45),  INT8_C(  37),  INT8_C(  48),
+        -INT8_C( 123), -INT8_C( 110), -INT8_C(  27), -INT8_C(  67), -INT8_C(  83), -INT8_C( 105),  INT8_C(  28), -INT8_C(  36),
+        -INT8_C(  30),  INT8_C(  18),  INT8_C(  65), -INT8_C(  37), -INT8_C(  30), -INT8_C(  51),  INT8_C(  96), -INT8_C(  43),
+        -INT8_C(  74), -INT8_C(  53),  INT8_C(  59), -INT8_C(  65),  INT8_C(  80),  INT8_C(  61), -INT8_C( 100), -INT8_C(  27) },
+      { {  INT8_C(  99), -INT8_C( 101),  INT8_C( 123), -INT8_C(  97), -INT8_C(  82),  INT8_C(  84), -INT8_C(  95),  INT8_C(  29),
+           INT8_C(  34),  INT8_C(  18),  INT8_C(  79),  INT8_C(  60), -INT8_C(  20),  INT8_C( 117), -INT8_C(  87), -INT8_C(  61) },
+        {  INT8_C(  97), -INT8_C( 117), -INT8_C(  24), -INT8_C( 108), -INT8_C(  19),  INT8_C(  45),  INT8_C(  37),  INT8_C(  48),
+          -INT8_C( 123), -INT8_C( 110), -INT8_C(  27), -INT8_C(  67), -INT8_C(  83), -INT8_C( 105),  INT8_C(  28), -INT8_C(  36) },
+        { -INT8_C(  30),  INT8_C(  18),  INT8_C(  65), -INT8_C(  37), -INT8_C(  30), -INT8_C(  51),  INT8_C(  96), -INT8_C(  43),
+          -INT8_C(  74), -INT8_C(  53),  INT8_C(  59), -INT8_C(  65),  INT8_C(  80),  INT8_C(  61), -INT8_C( 100), -INT8_C(  27) } } },
+    { {  INT8_C( 110), -INT8_C(  97), -INT8_C(  97), -INT8_C(  96), -INT8_C(  33), -INT8_C(  60),  INT8_C(  33),  INT8_C(  31),
+         INT8_C(  98), -INT8_C(  41),  INT8_C(  67), -INT8_C(  39), -INT8_C( 122), -INT8_C(  34),  INT8_C(  63),  INT8_C(   3),
+        -INT8_C(  39),  INT8_C(  32),  INT8_C(  32), -INT8_C(  31), -INT8_C( 121),  INT8_C(  39), -INT8_C(  59),  INT8_C(  13),
+        -INT8_C(  97), -INT8_C(  76),  INT8_C(  96), -INT8_C(  14), -INT8_C(  75),  INT8_C(  37), -INT8_C(   7),  INT8_C(  50),
+         INT8_C(  94), -INT8_C( 116),  INT8_C( 110), -INT8_C(  89), -INT8_C( 114),  INT8_C(  70), -INT8_C(  56), -INT8_C(  68),
+        -INT8_C(  96),  INT8_C( 104), -INT8_C(  44), -INT8_C(  48), -INT8_C(  43), -INT8_C(  58), -INT8_C( 124), -INT8_C(  47) },
+      { {  INT8_C( 110), -INT8_C(  97), -INT8_C(  97), -INT8_C(  96), -INT8_C(  33), -INT8_C(  60),  INT8_C(  33),  INT8_C(  31),
+           INT8_C(  98), -INT8_C(  41),  INT8_C(  67), -INT8_C(  39), -INT8_C( 122), -INT8_C(  34),  INT8_C(  63),  INT8_C(   3) },
+        { -INT8_C(  39),  INT8_C(  32),  INT8_C(  32), -INT8_C(  31), -INT8_C( 121),  INT8_C(  39), -INT8_C(  59),  INT8_C(  13),
+          -INT8_C(  97), -INT8_C(  76),  INT8_C(  96), -INT8_C(  14), -INT8_C(  75),  INT8_C(  37), -INT8_C(   7),  INT8_C(  50) },
+        {  INT8_C(  94), -INT8_C( 116),  INT8_C( 110), -INT8_C(  89), -INT8_C( 114),  INT8_C(  70), -INT8_C(  56), -INT8_C(  68),
+          -INT8_C(  96),  INT8_C( 104), -INT8_C(  44), -INT8_C(  48), -INT8_C(  43), -INT8_C(  58), -INT8_C( 124), -INT8_C(  47) } } },
+    { {  INT8_C( 123), -INT8_C(  33),  INT8_C(  50), -INT8_C(  71), -INT8_C(  20), -INT8_C(  42),  INT8_C(  89), -INT8_C(  30),
+         INT8_C(  13),  INT8_C(  20),  INT8_C(  94),  INT8_C(  83),  INT8_C(  90),  INT8_C(  49), -INT8_C(  13),  INT8_C(  44),
+        -INT8_C(  54), -INT8_C(  43),  INT8_C(  84), -INT8_C(   5), -INT8_C(  15),  INT8_C(  56), -INT8_C( 106),  INT8_C(  79),
+         INT8_C( 105), -INT8_C(  18), -INT8_C(  22),  INT8_C(  98), -INT8_C(  90), -INT8_C(  30),  INT8_C(  45), -INT8_C(   6),
+         INT8_C(   6), -INT8_C( 107),  INT8_C(  25), -INT8_C(  80),  INT8_C(  67),  INT8_C(  34), -INT8_C(  31),  INT8_C(  22),
+        -INT8_C(  11), -INT8_C(  19), -INT8_C(  16), -INT8_C(  35), -INT8_C( 113), -INT8_C( 110), -INT8_C(  36),  INT8_C( 116) },
+      { {  INT8_C( 123), -INT8_C(  33),  INT8_C(  50), -INT8_C(  71), -INT8_C(  20), -INT8_C(  42),  INT8_C(  89), -INT8_C(  30),
+           INT8_C(  13),  INT8_C(  20),  INT8_C(  94),  INT8_C(  83),  INT8_C(  90),  INT8_C(  49), -INT8_C(  13),  INT8_C(  44) },
+        { -INT8_C(  54), -INT8_C(  43),  INT8_C(  84), -INT8_C(   5), -INT8_C(  15),  INT8_C(  56), -INT8_C( 106),  INT8_C(  79),
+           INT8_C( 105), -INT8_C(  18), -INT8_C(  22),  INT8_C(  98), -INT8_C(  90), -INT8_C(  30),  INT8_C(  45), -INT8_C(   6) },
+        {  INT8_C(   6), -INT8_C( 107),  INT8_C(  25), -INT8_C(  80),  INT8_C(  67),  INT8_C(  34), -INT8_C(  31),  INT8_C(  22),
+          -INT8_C(  11), -INT8_C(  19), -INT8_C(  16), -INT8_C(  35), -INT8_C( 113), -INT8_C( 110), -INT8_C(  36),  INT8_C( 116) } } },
+    { { -INT8_C(  29), -INT8_C( 122), -INT8_C(   7), -INT8_C(   2),  INT8_C(  49),  INT8_C(  73),  INT8_C( 109), -INT8_C(  97),
+         INT8_C(  56),  INT8_C(  43), -INT8_C(  58), -INT8_C(  56),  INT8_C(   6),  INT8_C(  77), -INT8_C(  56), -INT8_C( 108),
+         INT8_C(  11), -INT8_C(  53),      INT8_MIN,  INT8_C(  66),  INT8_C(  25), -INT8_C(  30), -INT8_C(  80), -INT8_C(  51),
+         INT8_C( 123), -INT8_C(  14), -INT8_C( 123),  INT8_C(   2),  INT8_C(  15),  INT8_C(  54),  INT8_C(  16),  INT8_C( 101),
+         INT8_C(  35),  INT8_C(  27),  INT8_C(  72),  INT8_C(  83),  INT8_C(  70), -INT8_C(  89),  INT8_C(  78), -INT8_C( 106),
+        -INT8_C( 115), -INT8_C(  62), -INT8_C(   5),  INT8_C(  26), -INT8_C( 117),  INT8_C(  32), -INT8_C( 123),  INT8_C(  78) },
+      { { -INT8_C(  29), -INT8_C( 122), -INT8_C(   7), -INT8_C(   2),  INT8_C(  49),  INT8_C(  73),  INT8_C( 109), -INT8_C(  97),
+           INT8_C(  56),  INT8_C(  43), -INT8_C(  58), -INT8_C(  56),  INT8_C(   6),  INT8_C(  77), -INT8_C(  56), -INT8_C( 108) },
+        {  INT8_C(  11), -INT8_C(  53),      INT8_MIN,  INT8_C(  66),  INT8_C(  25), -INT8_C(  30), -INT8_C(  80), -INT8_C(  51),
+           INT8_C( 123), -INT8_C(  14), -INT8_C( 123),  INT8_C(   2),  INT8_C(  15),  INT8_C(  54),  INT8_C(  16),  INT8_C( 101) },
+        {  INT8_C(  35),  INT8_C(  27),  INT8_C(  72),  INT8_C(  83),  INT8_C(  70), -INT8_C(  89),  INT8_C(  78), -INT8_C( 106),
+          -INT8_C( 115), -INT8_C(  62), -INT8_C(   5),  INT8_C(  26), -INT8_C( 117),  INT8_C(  32), -INT8_C( 123),  INT8_C(  78) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x3_t r = simde_vld1q_s8_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[2], simde_vld1q_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a[48];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int8x16x3_t r = simde_vld1q_s8_x3(a);
+
+    simde_test_codegen_write_vi8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[24];
+    int16_t r[3][8];
+  } test_vec[] = {
+    { {  INT16_C( 30184), -INT16_C( 30958), -INT16_C( 15705),  INT16_C( 11402), -INT16_C( 19248),  INT16_C( 22605), -INT16_C( 11578), -INT16_C( 14157),
+         INT16_C( 25463),  INT16_C( 24187), -INT16_C( 13156), -INT16_C( 15071),  INT16_C(  1575),  INT16_C( 10948),  INT16_C( 16291), -INT16_C( 17844),
+        -INT16_C( 24555),  INT16_C( 32025),  INT16_C( 22593), -INT16_C( 20082),  INT16_C(  3951), -INT16_C( 16315), -INT16_C( 15585),  INT16_C( 10443) },
+      { {  INT16_C( 30184), -INT16_C( 30958), -INT16_C( 15705),  INT16_C( 11402), -INT16_C( 19248),  INT16_C( 22605), -INT16_C( 11578), -INT16_C( 14157) },
+        {  INT16_C( 25463),  INT16_C( 24187), -INT16_C( 13156), -INT16_C( 15071),  INT16_C(  1575),  INT16_C( 10948),  INT16_C( 16291), -INT16_C( 17844) },
+        { -INT16_C( 24555),  INT16_C( 32025),  INT16_C( 22593), -INT16_C( 20082),  INT16_C(  3951), -INT16_C( 16315), -INT16_C( 15585),  INT16_C( 10443) } } },
+    { { -INT16_C(  6270), -INT16_C( 13210),  INT16_C( 29190),  INT16_C( 28876), -INT16_C( 14128),  INT16_C( 30142), -INT16_C( 22589), -INT16_C(  8409),
+         INT16_C( 25958),  INT16_C(  5304), -INT16_C(  7757), -INT16_C( 25768),  INT16_C( 21918), -INT16_C( 20967), -INT16_C( 19623),  INT16_C( 28735),
+        -INT16_C(  1229),  INT16_C( 10253), -INT16_C(  7205), -INT16_C( 19336), -INT16_C( 13589),  INT16_C(  3511),  INT16_C( 17757),  INT16_C( 28293) },
+      { { -INT16_C(  6270), -INT16_C( 13210),  INT16_C( 29190),  INT16_C( 28876), -INT16_C( 14128),  INT16_C( 30142), -INT16_C( 22589), -INT16_C(  8409) },
+        {  INT16_C( 25958),  INT16_C(  5304), -INT16_C(  7757), -INT16_C( 25768),  INT16_C( 21918), -INT16_C( 20967), -INT16_C( 19623),  INT16_C( 28735) },
+        { -INT16_C(  1229),  INT16_C( 10253), -INT16_C(  7205), -INT16_C( 19336), -INT16_C( 13589),  INT16_C(  3511),  INT16_C( 17757),  INT16_C( 28293) } } },
+    { {  INT16_C( 22031),  INT16_C(  8061), -INT16_C( 10811), -INT16_C( 29272),  INT16_C( 29678), -INT16_C( 10768),  INT16_C(  6509), -INT16_C(  4915),
+         INT16_C( 26247), -INT16_C(  1986), -INT16_C( 24639),  INT16_C(  4789),  INT16_C( 10210),  INT16_C( 25781),  INT16_C( 16871), -INT16_C( 13865),
+        -INT16_C( 24347), -INT16_C( 14884), -INT16_C( 25338), -INT16_C( 26879), -INT16_C( 14659), -INT16_C( 29804),  INT16_C(  9850),  INT16_C( 22525) },
+      { {  INT16_C( 22031),  INT16_C(  8061), -INT16_C( 10811), -INT16_C( 29272),  INT16_C( 29678), -INT16_C( 10768),  INT16_C(  6509), -INT16_C(  4915) },
+        {  INT16_C( 26247), -INT16_C(  1986), -INT16_C( 24639),  INT16_C(  4789),  INT16_C( 10210),  INT16_C( 25781),  INT16_C( 16871), -INT16_C( 13865) },
+        { -INT16_C( 24347), -INT16_C( 14884), -INT16_C( 25338), -INT16_C( 26879), -INT16_C( 14659), -INT16_C( 29804),  INT16_C(  9850),  INT16_C( 22525) } } },
+    { { -INT16_C( 30436),  INT16_C( 13020),  INT16_C( 11953),  INT16_C( 27615),  INT16_C(  4009), -INT16_C(   106), -INT16_C(  3527), -INT16_C( 16655),
+        -INT16_C(  2562),  INT16_C(  4850), -INT16_C( 12788), -INT16_C(  5246),  INT16_C( 31553),  INT16_C(  7301),  INT16_C(  2032), -INT16_C(  7969),
+         INT16_C(  1551),  INT16_C(  2608), -INT16_C(  8781),  INT16_C( 30925), -INT16_C( 24463),  INT16_C(  4651), -INT16_C( 21152), -INT16_C( 24922) },
+      { { -INT16_C( 30436),  INT16_C( 13020),  INT16_C( 11953),  INT16_C( 27615),  INT16_C(  4009), -INT16_C(   106), -INT16_C(  3527), -INT16_C( 16655) },
+        { -INT16_C(  2562),  INT16_C(  4850), -INT16_C( 12788), -INT16_C(  5246),  INT16_C( 31553),  INT16_C(  7301),  INT16_C(  2032), -INT16_C(  7969) },
+        {  INT16_C(  1551),  INT16_C(  2608), -INT16_C(  8781),  INT16_C( 30925), -INT16_C( 24463),  INT16_C(  4651), -INT16_C( 21152), -INT16_C( 24922) } } },
+    { { -INT16_C( 22005),  INT16_C(  7629), -INT16_C( 25365),  INT16_C( 14120), -INT16_C( 21070), -INT16_C( 28326), -INT16_C( 24605), -INT16_C(  9659),
+         INT16_C( 15230), -INT16_C( 15198),  INT16_C(  6448), -INT16_C(  6562),  INT16_C( 29770),  INT16_C( 17816),  INT16_C( 31880), -INT16_C( 11448),
+         INT16_C(  2048),  INT16_C( 18631), -INT16_C( 10007),  INT16_C( 16758), -INT16_C(  8046), -INT16_C( 14359),  INT16_C( 18867),  INT16_C( 22989) },
+      { { -INT16_C( 22005),  INT16_C(  7629), -INT16_C( 25365),  INT16_C( 14120), -INT16_C( 21070), -INT16_C( 28326), -INT16_C( 24605), -INT16_C(  9659) },
+        {  INT16_C( 15230), -INT16_C( 15198),  INT16_C(  6448), -INT16_C(  6562),  INT16_C( 29770),  INT16_C( 17816),  INT16_C( 31880), -INT16_C( 11448) },
+        {  INT16_C(  2048),  INT16_C( 18631), -INT16_C( 10007),  INT16_C( 16758), -INT16_C(  8046), -INT16_C( 14359),  INT16_C( 18867),  INT16_C( 22989) } } },
+    { {  INT16_C(  6495),  INT16_C(  7497), -INT16_C( 28555),  INT16_C( 25876),  INT16_C(  2026),  INT16_C( 29124), -INT16_C( 19086), -INT16_C( 31176),
+        -INT16_C( 30403), -INT16_C( 16081),  INT16_C( 31715),  INT16_C( 25433),  INT16_C(  3604),  INT16_C( 28201),  INT16_C( 19776), -INT16_C(  9532),
+         INT16_C( 17806), -INT16_C( 28628), -INT16_C( 15705), -INT16_C( 29586),  INT16_C(  9977), -INT16_C( 31712),  INT16_C(  4430),  INT16_C(  2973) },
+      { {  INT16_C(  6495),  INT16_C(  7497), -INT16_C( 28555),  INT16_C( 25876),  INT16_C(  2026),  INT16_C( 29124), -INT16_C( 19086), -INT16_C( 31176) },
+        { -INT16_C( 30403), -INT16_C( 16081),  INT16_C( 31715),  INT16_C( 25433),  INT16_C(  3604),  INT16_C( 28201),  INT16_C( 19776), -INT16_C(  9532) },
+        {  INT16_C( 17806), -INT16_C( 28628), -INT16_C( 15705), -INT16_C( 29586),  INT16_C(  9977), -INT16_C( 31712),  INT16_C(  4430),  INT16_C(  2973) } } },
+    { { -INT16_C( 20907), -INT16_C( 17696), -INT16_C( 18103),  INT16_C(  1801),  INT16_C(  5010), -INT16_C(   442), -INT16_C( 13952),  INT16_C( 28790),
+        -INT16_C(  1671),  INT16_C(  4960),  INT16_C( 21231),  INT16_C( 18073),  INT16_C( 27506),  INT16_C(  1962), -INT16_C( 21238), -INT16_C( 29800),
+         INT16_C(  4632),  INT16_C(  3790),  INT16_C( 22084),  INT16_C( 17317),  INT16_C( 21533), -INT16_C( 28725), -INT16_C( 32189), -INT16_C( 16591) },
+      { { -INT16_C( 20907), -INT16_C( 17696), -INT16_C( 18103),  INT16_C(  1801),  INT16_C(  5010), -INT16_C(   442), -INT16_C( 13952),  INT16_C( 28790) },
+        { -INT16_C(  1671),  INT16_C(  4960),  INT16_C( 21231),  INT16_C( 18073),  INT16_C( 27506),  INT16_C(  1962), -INT16_C( 21238), -INT16_C( 29800) },
+        {  INT16_C(  4632),  INT16_C(  3790),  INT16_C( 22084),  INT16_C( 17317),  INT16_C( 21533), -INT16_C( 28725), -INT16_C( 32189), -INT16_C( 16591) } } },
+    { { -INT16_C( 21384),  INT16_C( 18426), -INT16_C(  5412), -INT16_C( 31472), -INT16_C( 12247), -INT16_C( 25446), -INT16_C( 29468), -INT16_C(  7986),
+         INT16_C(  6452), -INT16_C(  9952),  INT16_C( 26484), -INT16_C( 18125),  INT16_C( 29956), -INT16_C( 18794),  INT16_C(  5681), -INT16_C( 14072),
+         INT16_C(  7068), -INT16_C( 22873),  INT16_C( 30579),  INT16_C( 15066), -INT16_C( 21958),  INT16_C(  6846),  INT16_C( 16019), -INT16_C( 32446) },
+      { { -INT16_C( 21384),  INT16_C( 18426), -INT16_C(  5412), -INT16_C( 31472), -INT16_C( 12247), -INT16_C( 25446), -INT16_C( 29468), -INT16_C(  7986) },
+        {  INT16_C(  6452), -INT16_C(  9952),  INT16_C( 26484), -INT16_C( 18125),  INT16_C( 29956), -INT16_C( 18794),  INT16_C(  5681), -INT16_C( 14072) },
+        {  INT16_C(  7068), -INT16_C( 22873),  INT16_C( 30579),  INT16_C( 15066), -INT16_C( 21958),  INT16_C(  6846),  INT16_C( 16019), -INT16_C( 32446) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x3_t r = simde_vld1q_s16_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[2], simde_vld1q_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a[24];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int16x8x3_t r = simde_vld1q_s16_x3(a);
+
+    simde_test_codegen_write_vi16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[12];
+    int32_t r[3][4];
+  } test_vec[] = {
+    { { -INT32_C(     3316720), -INT32_C(   490989076),  INT32_C(  1949101108), -INT32_C(  1452125581), -INT32_C(    75204587), -INT32_C(   192661690), -INT32_C(   812621583),  INT32_C(   599486026),
+         INT32_C(   339418449),  INT32_C(  1561844584), -INT32_C(   943198283),  INT32_C(   631004820) },
+      { { -INT32_C(     3316720), -INT32_C(   490989076),  INT32_C(  1949101108), -INT32_C(  1452125581) },
+        { -INT32_C(    75204587), -INT32_C(   192661690), -INT32_C(   812621583),  INT32_C(   599486026) },
+        {  INT32_C(   339418449),  INT32_C(  1561844584), -INT32_C(   943198283),  INT32_C(   631004820) } } },
+    { {  INT32_C(  2074953511),  INT32_C(  1872547143),  INT32_C(   336453911),  INT32_C(  1004623056),  INT32_C(  1779881741),  INT32_C(  1276180110), -INT32_C(  1252516946), -INT32_C(    28919815),
+         INT32_C(  1716383874),  INT32_C(   123773993), -INT32_C(   503905021), -INT32_C(  1302043874) },
+      { {  INT32_C(  2074953511),  INT32_C(  1872547143),  INT32_C(   336453911),  INT32_C(  1004623056) },
+        {  INT32_C(  1779881741),  INT32_C(  1276180110), -INT32_C(  1252516946), -INT32_C(    28919815) },
+        {  INT32_C(  1716383874),  INT32_C(   123773993), -INT32_C(   503905021), -INT32_C(  1302043874) } } },
+    { { -INT32_C(  1155392886), -INT32_C(  1287372857),  INT32_C(  1296722437), -INT32_C(  1948447798),  INT32_C(  1868171056),  INT32_C(  2034092603), -INT32_C(   208506734), -INT32_C(   935654024),
+        -INT32_C(  1666847811), -INT32_C(   379100824),  INT32_C(   615961439), -INT32_C(  1654353248) },
+      { { -INT32_C(  1155392886), -INT32_C(  1287372857),  INT32_C(  1296722437), -INT32_C(  1948447798) },
+        {  INT32_C(  1868171056),  INT32_C(  2034092603), -INT32_C(   208506734), -INT32_C(   935654024) },
+        { -INT32_C(  1666847811), -INT32_C(   379100824),  INT32_C(   615961439), -INT32_C(  1654353248) } } },
+    { {  INT32_C(  1744220767), -INT32_C(  1800541211),  INT32_C(   784000603),  INT32_C(  1092841242),  INT32_C(  1081570482),  INT32_C(  1245963978), -INT32_C(  1886007447),  INT32_C(  2037856798),
+         INT32_C(  1196163529),  INT32_C(  2147290441), -INT32_C(   106949703), -INT32_C(   328706321) },
+      { {  INT32_C(  1744220767), -INT32_C(  1800541211),  INT32_C(   784000603),  INT32_C(  1092841242) },
+        {  INT32_C(  1081570482),  INT32_C(  1245963978), -INT32_C(  1886007447),  INT32_C(  2037856798) },
+        {  INT32_C(  1196163529),  INT32_C(  2147290441), -INT32_C(   106949703), -INT32_C(   328706321) } } },
+    { { -INT32_C(  1918172743), -INT32_C(  1414424822), -INT32_C(  2010424243),  INT32_C(  1464332796), -INT32_C(  1556685759),  INT32_C(   928502641),  INT32_C(   562594318), -INT32_C(   472904616),
+        -INT32_C(  1349842067),  INT32_C(   965488178), -INT32_C(  1966499658),  INT32_C(    10041390) },
+      { { -INT32_C(  1918172743), -INT32_C(  1414424822), -INT32_C(  2010424243),  INT32_C(  1464332796) },
+        { -INT32_C(  1556685759),  INT32_C(   928502641),  INT32_C(   562594318), -INT32_C(   472904616) },
+        { -INT32_C(  1349842067),  INT32_C(   965488178), -INT32_C(  1966499658),  INT32_C(    10041390) } } },
+    { { -INT32_C(  1748266907),  INT32_C(    49602425),  INT32_C(   365043830),  INT32_C(  1427163364), -INT32_C(  2102483897), -INT32_C(   281483997), -INT32_C(  1104855476), -INT32_C(  2002986272),
+         INT32_C(  1377700150), -INT32_C(   612451589),  INT32_C(  1761873037), -INT32_C(   323962530) },
+      { { -INT32_C(  1748266907),  INT32_C(    49602425),  INT32_C(   365043830),  INT32_C(  1427163364) },
+        { -INT32_C(  2102483897), -INT32_C(   281483997), -INT32_C(  1104855476), -INT32_C(  2002986272) },
+        {  INT32_C(  1377700150), -INT32_C(   612451589),  INT32_C(  1761873037), -INT32_C(   323962530) } } },
+    { { -INT32_C(   461096013), -INT32_C(   422330373),  INT32_C(   321628739), -INT32_C(  1306911646),  INT32_C(  1888757722),  INT32_C(   186642031), -INT32_C(  1640873466), -INT32_C(  1032325839),
+         INT32_C(   505375692), -INT32_C(  1726721170),  INT32_C(  1901143748), -INT32_C(   675007333) },
+      { { -INT32_C(   461096013), -INT32_C(   422330373),  INT32_C(   321628739), -INT32_C(  1306911646) },
+        {  INT32_C(  1888757722),  INT32_C(   186642031), -INT32_C(  1640873466), -INT32_C(  1032325839) },
+        {  INT32_C(   505375692), -INT32_C(  1726721170),  INT32_C(  1901143748), -INT32_C(   675007333) } } },
+    { { -INT32_C(   164580070), -INT32_C(    23135877), -INT32_C(  1991440763), -INT32_C(   101108502),  INT32_C(  1517190952),  INT32_C(   456295599),  INT32_C(  1134934294),  INT32_C(   146342723),
+         INT32_C(  1449651064),  INT32_C(   611513790),  INT32_C(  1923925174),  INT32_C(  2099985951) },
+      { { -INT32_C(   164580070), -INT32_C(    23135877), -INT32_C(  1991440763), -INT32_C(   101108502) },
+        {  INT32_C(  1517190952),  INT32_C(   456295599),  INT32_C(  1134934294),  INT32_C(   146342723) },
+        {  INT32_C(  1449651064),  INT32_C(   611513790),  INT32_C(  1923925174),  INT32_C(  2099985951) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x3_t r = simde_vld1q_s32_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[2], simde_vld1q_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a[12];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int32x4x3_t r = simde_vld1q_s32_x3(a);
+
+    simde_test_codegen_write_vi32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[6];
+    int64_t r[3][2];
+  } test_vec[] = {
+    { {  INT64_C(  885280382821761876), -INT64_C( 1323408485477878417),  INT64_C( 3230015065110961851), -INT64_C( 2532188955120235140),
+        -INT64_C( 3616674334485928933),  INT64_C( 2415228036132200182) },
+      { {  INT64_C(  885280382821761876), -INT64_C( 1323408485477878417) },
+        {  INT64_C( 3230015065110961851), -INT64_C( 2532188955120235140) },
+        { -INT64_C( 3616674334485928933),  INT64_C( 2415228036132200182) } } },
+    { {  INT64_C( 7418575510180163745),  INT64_C( 8301215253102850602), -INT64_C( 4097241984956735583), -INT64_C( 6523387493176640915),
+         INT64_C( 2959851726029456289), -INT64_C( 1616954940551473203) },
+      { {  INT64_C( 7418575510180163745),  INT64_C( 8301215253102850602) },
+        { -INT64_C( 4097241984956735583), -INT64_C( 6523387493176640915) },
+        {  INT64_C( 2959851726029456289), -INT64_C( 1616954940551473203) } } },
+    { { -INT64_C( 2609861661102328053),  INT64_C( 3095229850441356738),  INT64_C( 5817589274878777608), -INT64_C( 2020651747431545821),
+        -INT64_C( 5887903500800623137), -INT64_C( 8905252620345728436) },
+      { { -INT64_C( 2609861661102328053),  INT64_C( 3095229850441356738) },
+        {  INT64_C( 5817589274878777608), -INT64_C( 2020651747431545821) },
+        { -INT64_C( 5887903500800623137), -INT64_C( 8905252620345728436) } } },
+    { { -INT64_C( 4548093014018437970),  INT64_C(  908051881157398890),  INT64_C( 4489123316123371802), -INT64_C( 2459124357625270361),
+         INT64_C( 1695306698526348519),  INT64_C( 1278219334828847784) },
+      { { -INT64_C( 4548093014018437970),  INT64_C(  908051881157398890) },
+        {  INT64_C( 4489123316123371802), -INT64_C( 2459124357625270361) },
+        {  INT64_C( 1695306698526348519),  INT64_C( 1278219334828847784) } } },
+    { { -INT64_C(  562888447538213663), -INT64_C( 1500909309207709780), -INT64_C( 1091096668682345454), -INT64_C( 8607383020115999351),
+         INT64_C( 6196745860950406609), -INT64_C( 4618533470357315844) },
+      { { -INT64_C(  562888447538213663), -INT64_C( 1500909309207709780) },
+        { -INT64_C( 1091096668682345454), -INT64_C( 8607383020115999351) },
+        {  INT64_C( 6196745860950406609), -INT64_C( 4618533470357315844) } } },
+    { {  INT64_C( 6595475796073510133), -INT64_C( 1324124898304564989),  INT64_C( 6782117959714044662), -INT64_C( 5565510976903088766),
+         INT64_C( 1248048992703676287),  INT64_C( 8596479063619125562) },
+      { {  INT64_C( 6595475796073510133), -INT64_C( 1324124898304564989) },
+        {  INT64_C( 6782117959714044662), -INT64_C( 5565510976903088766) },
+        {  INT64_C( 1248048992703676287),  INT64_C( 8596479063619125562) } } },
+    { {  INT64_C( 2562737082216897126), -INT64_C( 6516079834088313011), -INT64_C(  204732604939623152), -INT64_C( 7882162167925871105),
+        -INT64_C( 7745435778596308067), -INT64_C(  891850608128372285) },
+      { {  INT64_C( 2562737082216897126), -INT64_C( 6516079834088313011) },
+        { -INT64_C(  204732604939623152), -INT64_C( 7882162167925871105) },
+        { -INT64_C( 7745435778596308067), -INT64_C(  891850608128372285) } } },
+    { { -INT64_C( 2560481329583911318), -INT64_C( 5862336126200343119),  INT64_C( 3632085492094785298), -INT64_C( 8991802172098822055),
+        -INT64_C( 6612587535518990829), -INT64_C( 5605206428186972564) },
+      { { -INT64_C( 2560481329583911318), -INT64_C( 5862336126200343119) },
+        {  INT64_C( 3632085492094785298), -INT64_C( 8991802172098822055) },
+        { -INT64_C( 6612587535518990829), -INT64_C( 5605206428186972564) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x3_t r = simde_vld1q_s64_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[2], simde_vld1q_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a[6];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int64x2x3_t r = simde_vld1q_s64_x3(a);
+
+    simde_test_codegen_write_vi64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[48];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    { { UINT8_C(197), UINT8_C(141), UINT8_C(194), UINT8_C(183), UINT8_C(155), UINT8_C( 53), UINT8_C(253), UINT8_C(152),
+        UINT8_C( 54), UINT8_C(147), UINT8_C(118), UINT8_C( 47), UINT8_C( 35), UINT8_C(102), UINT8_C(  4),    UINT8_MAX,
+        UINT8_C(122), UINT8_C(169), UINT8_C(189), UINT8_C( 40), UINT8_C(233), UINT8_C(224), UINT8_C(153), UINT8_C(107),
+        UINT8_C(154), UINT8_C(101), UINT8_C(204), UINT8_C(141), UINT8_C(199), UINT8_C( 37), UINT8_C( 27), UINT8_C(193),
+        UINT8_C( 20), UINT8_C(120), UINT8_C(238), UINT8_C(143), UINT8_C( 41), UINT8_C( 24), UINT8_C( 84), UINT8_C(184),
+        UINT8_C(185), UINT8_C(103), UINT8_C(103), UINT8_C(230), UINT8_C(168), UINT8_C( 27), UINT8_C( 26), UINT8_C(214) },
+      { { UINT8_C(197), UINT8_C(141), UINT8_C(194), UINT8_C(183), UINT8_C(155), UINT8_C( 53), UINT8_C(253), UINT8_C(152),
+          UINT8_C( 54), UINT8_C(147), UINT8_C(118), UINT8_C( 47), UINT8_C( 35), UINT8_C(102), UINT8_C(  4),    UINT8_MAX },
+        { UINT8_C(122), UINT8_C(169), UINT8_C(189), UINT8_C( 40), UINT8_C(233), UINT8_C(224), UINT8_C(153), UINT8_C(107),
+          UINT8_C(154), UINT8_C(101), UINT8_C(204), UINT8_C(141), UINT8_C(199), UINT8_C( 37), UINT8_C( 27), UINT8_C(193) },
+        { UINT8_C( 20), UINT8_C(120), UINT8_C(238), UINT8_C(143), UINT8_C( 41), UINT8_C( 24), UINT8_C( 84), UINT8_C(184),
+          UINT8_C(185), UINT8_C(103), UINT8_C(103), UINT8_C(230), UINT8_C(168), UINT8_C( 27), UINT8_C( 26), UINT8_C(214) } } },
+    { { UINT8_C(109), UINT8_C( 25), UINT8_C( 48), UINT8_C( 15), UINT8_C(179), UINT8_C(253), UINT8_C( 53), UINT8_C( 96),
+        UINT8_C(251), UINT8_C( 35), UINT8_C(150), UINT8_C(156), UINT8_C(220), UINT8_C(  7), UINT8_C( 82), UINT8_C(107),
+        UINT8_C(246), UINT8_C(105), UINT8_C(223), UINT8_C( 20), UINT8_C(242), UINT8_C(193), UINT8_C(174), UINT8_C(191),
+        UINT8_C(211), UINT8_C( 86), UINT8_C(102), UINT8_C( 55), UINT8_C(168), UINT8_C(197), UINT8_C( 47), UINT8_C(166),
+        UINT8_C( 50), UINT8_C( 81), UINT8_C( 56), UINT8_C(122), UINT8_C(239), UINT8_C(203), UINT8_C(219), UINT8_C(175),
+        UINT8_C( 32), UINT8_C( 40), UINT8_C(218), UINT8_C( 25), UINT8_C(138), UINT8_C(223), UINT8_C( 99), UINT8_C( 67) },
+      { { UINT8_C(109), UINT8_C( 25), UINT8_C( 48), UINT8_C( 15), UINT8_C(179), UINT8_C(253), UINT8_C( 53), UINT8_C( 96),
+          UINT8_C(251), UINT8_C( 35), UINT8_C(150), UINT8_C(156), UINT8_C(220), UINT8_C(  7), UINT8_C( 82), UINT8_C(107) },
+        { UINT8_C(246), UINT8_C(105), UINT8_C(223), UINT8_C( 20), UINT8_C(242), UINT8_C(193), UINT8_C(174), UINT8_C(191),
+          UINT8_C(211), UINT8_C( 86), UINT8_C(102), UINT8_C( 55), UINT8_C(168), UINT8_C(197), UINT8_C( 47), UINT8_C(166) },
+        { UINT8_C( 50), UINT8_C( 81), UINT8_C( 56), UINT8_C(122), UINT8_C(239), UINT8_C(203), UINT8_C(219), UINT8_C(175),
+          UINT8_C( 32), UINT8_C( 40), UINT8_C(218), UINT8_C( 25), UINT8_C(138), UINT8_C(223), UINT8_C( 99), UINT8_C( 67) } } },
+    { { UINT8_C( 95), UINT8_C( 52), UINT8_C( 23), UINT8_C( 49), UINT8_C(194), UINT8_C( 30), UINT8_C(224), UINT8_C(185),
+        UINT8_C( 19), UINT8_C(251), UINT8_C(245), UINT8_C( 54), UINT8_C(116), UINT8_C( 93), UINT8_C( 71), UINT8_C(111),
+        UINT8_C( 48), UINT8_C( 67), UINT8_C( 25), UINT8_C(192), UINT8_C(197), UINT8_C(167), UINT8_C(196), UINT8_C( 11),
+        UINT8_C(174), UINT8_C(238), UINT8_C( 15), UINT8_C( 10), UINT8_C(217), UINT8_C(212), UINT8_C(150), UINT8_C( 92),
+        UINT8_C(206), UINT8_C( 65), UINT8_C(195), UINT8_C( 92), UINT8_C( 53), UINT8_C( 43), UINT8_C(144), UINT8_C(182),
+        UINT8_C(132), UINT8_C( 24), UINT8_C(196), UINT8_C(222), UINT8_C(160), UINT8_C(183), UINT8_C( 91), UINT8_C(166) },
+      { { UINT8_C( 95), UINT8_C( 52), UINT8_C( 23), UINT8_C( 49), UINT8_C(194), UINT8_C( 30), UINT8_C(224), UINT8_C(185),
+          UINT8_C( 19), UINT8_C(251), UINT8_C(245), UINT8_C( 54), UINT8_C(116), UINT8_C( 93), UINT8_C( 71), UINT8_C(111) },
+        { UINT8_C( 48), UINT8_C( 67), UINT8_C( 25), UINT8_C(192), UINT8_C(197), UINT8_C(167), UINT8_C(196), UINT8_C( 11),
+          UINT8_C(174), UINT8_C(238), UINT8_C( 15), UINT8_C( 10), UINT8_C(217), UINT8_C(212), UINT8_C(150), UINT8_C( 92) },
+        { UINT8_C(206), UINT8_C( 65), UINT8_C(195), UINT8_C( 92), UINT8_C( 53), UINT8_C( 43), UINT8_C(144), UINT8_C(182),
+          UINT8_C(132), UINT8_C( 24), UINT8_C(196), UINT8_C(222), UINT8_C(160), UINT8_C(183), UINT8_C( 91), UINT8_C(166) } } },
+    { { UINT8_C(242), UINT8_C(151), UINT8_C( 41), UINT8_C(197), UINT8_C(254), UINT8_C(173), UINT8_C(167), UINT8_C(173),
+        UINT8_C( 34), UINT8_C(221), UINT8_C( 41), UINT8_C(252), UINT8_C(192), UINT8_C(226), UINT8_C( 40), UINT8_C( 54),
+        UINT8_C( 70), UINT8_C(195), UINT8_C( 58), UINT8_C( 97), UINT8_C(220), UINT8_C(163), UINT8_C(193), UINT8_C(238),
+        UINT8_C( 71), UINT8_C( 54), UINT8_C( 62), UINT8_C(205), UINT8_C(238), UINT8_C(211), UINT8_C(204), UINT8_C(  4),
+        UINT8_C( 35), UINT8_C(155), UINT8_C(  4), UINT8_C(194), UINT8_C(184), UINT8_C( 42), UINT8_C( 33), UINT8_C(247),
+        UINT8_C(168), UINT8_C(106), UINT8_C(131), UINT8_C( 61), UINT8_C(248), UINT8_C( 41), UINT8_C(124), UINT8_C(236) },
+      { { UINT8_C(242), UINT8_C(151), UINT8_C( 41), UINT8_C(197), UINT8_C(254), UINT8_C(173), UINT8_C(167), UINT8_C(173),
+          UINT8_C( 34), UINT8_C(221), UINT8_C( 41), UINT8_C(252), UINT8_C(192), UINT8_C(226), UINT8_C( 40), UINT8_C( 54) },
+        { UINT8_C( 70), UINT8_C(195), UINT8_C( 58), UINT8_C( 97), UINT8_C(220), UINT8_C(163), UINT8_C(193), UINT8_C(238),
+          UINT8_C( 71), UINT8_C( 54), UINT8_C( 62), UINT8_C(205), UINT8_C(238), UINT8_C(211), UINT8_C(204), UINT8_C(  4) },
+        { UINT8_C( 35), UINT8_C(155), UINT8_C(  4), UINT8_C(194), UINT8_C(184), UINT8_C( 42), UINT8_C( 33), UINT8_C(247),
+          UINT8_C(168), UINT8_C(106), UINT8_C(131), UINT8_C( 61), UINT8_C(248), UINT8_C( 41), UINT8_C(124), UINT8_C(236) } } },
+    { { UINT8_C(219), UINT8_C(242), UINT8_C(222), UINT8_C(182), UINT8_C( 40), UINT8_C( 57), UINT8_C( 48), UINT8_C(189),
+        UINT8_C(151), UINT8_C(208), UINT8_C(247), UINT8_C( 84), UINT8_C(235), UINT8_C(235), UINT8_C(140), UINT8_C( 87),
+        UINT8_C(154), UINT8_C(198), UINT8_C( 44), UINT8_C( 57), UINT8_C( 60), UINT8_C( 49), UINT8_C( 96), UINT8_C(224),
+        UINT8_C(189), UINT8_C(193), UINT8_C( 21), UINT8_C(245), UINT8_C(147), UINT8_C( 95), UINT8_C(165), UINT8_C(152),
+        UINT8_C( 67), UINT8_C( 65), UINT8_C( 99), UINT8_C(181), UINT8_C( 13), UINT8_C(152), UINT8_C(247), UINT8_C(210),
+        UINT8_C(241), UINT8_C(226), UINT8_C(226), UINT8_C( 60), UINT8_C( 56), UINT8_C( 59), UINT8_C( 87), UINT8_C(187) },
+      { { UINT8_C(219), UINT8_C(242), UINT8_C(222), UINT8_C(182), UINT8_C( 40), UINT8_C( 57), UINT8_C( 48), UINT8_C(189),
+          UINT8_C(151), UINT8_C(208), UINT8_C(247), UINT8_C( 84), UINT8_C(235), UINT8_C(235), UINT8_C(140), UINT8_C( 87) },
+        { UINT8_C(154), UINT8_C(198), UINT8_C( 44), UINT8_C( 57), UINT8_C( 60), UINT8_C( 49), UINT8_C( 96), UINT8_C(224),
+          UINT8_C(189), UINT8_C(193), UINT8_C( 21), UINT8_C(245), UINT8_C(147), UINT8_C( 95), UINT8_C(165), UINT8_C(152) },
+        { UINT8_C( 67), UINT8_C( 65), UINT8_C( 99), UINT8_C(181), UINT8_C( 13), UINT8_C(152), UINT8_C(247), UINT8_C(210),
+          UINT8_C(241), UINT8_C(226), UINT8_C(226), UINT8_C( 60), UINT8_C( 56), UINT8_C( 59), UINT8_C( 87), UINT8_C(187) } } },
+    { { UINT8_C(113), UINT8_C( 58), UINT8_C(164), UINT8_C( 64), UINT8_C(213), UINT8_C(240), UINT8_C( 38), UINT8_C( 69),
+        UINT8_C(172), UINT8_C(  8), UINT8_C(104), UINT8_C(215), UINT8_C( 51), UINT8_C( 65), UINT8_C(165), UINT8_C( 28),
+        UINT8_C(  7), UINT8_C(141), UINT8_C( 37), UINT8_C(  0), UINT8_C( 41), UINT8_C(194), UINT8_C(126), UINT8_C(196),
+        UINT8_C(246), UINT8_C( 23), UINT8_C(112), UINT8_C(208), UINT8_C( 74), UINT8_C( 20), UINT8_C( 52), UINT8_C(181),
+        UINT8_C(248), UINT8_C(159), UINT8_C( 64), UINT8_C(102), UINT8_C(149), UINT8_C(158), UINT8_C(117), UINT8_C(244),
+        UINT8_C(118), UINT8_C(167), UINT8_C(176), UINT8_C(180), UINT8_C(198), UINT8_C(149), UINT8_C( 55), UINT8_C(225) },
+      { { UINT8_C(113), UINT8_C( 58), UINT8_C(164), UINT8_C( 64), UINT8_C(213), UINT8_C(240), UINT8_C( 38), UINT8_C( 69),
+          UINT8_C(172), UINT8_C(  8), UINT8_C(104), UINT8_C(215), UINT8_C( 51), UINT8_C( 65), UINT8_C(165), UINT8_C( 28) },
+        { UINT8_C(  7), UINT8_C(141), UINT8_C( 37), UINT8_C(  0), UINT8_C( 41), UINT8_C(194), UINT8_C(126), UINT8_C(196),
+          UINT8_C(246), UINT8_C( 23), UINT8_C(112), UINT8_C(208), UINT8_C( 74), UINT8_C( 20), UINT8_C( 52), UINT8_C(181) },
+        { UINT8_C(248), UINT8_C(159), UINT8_C( 64), UINT8_C(102), UINT8_C(149), UINT8_C(158), UINT8_C(117), UINT8_C(244),
+          UINT8_C(118), UINT8_C(167), UINT8_C(176), UINT8_C(180), UINT8_C(198), UINT8_C(149), UINT8_C( 55), UINT8_C(225) } } },
+    { { UINT8_C(106), UINT8_C( 64), UINT8_C(232), UINT8_C(234), UINT8_C(237), UINT8_C( 37), UINT8_C(214), UINT8_C( 70),
+        UINT8_C(140), UINT8_C(230), UINT8_C( 79), UINT8_C(173), UINT8_C( 37), UINT8_C(222), UINT8_C(140), UINT8_C(244),
+        UINT8_C(188), UINT8_C( 77), UINT8_C(237), UINT8_C(241), UINT8_C( 52), UINT8_C(  6), UINT8_C(150), UINT8_C( 43),
+        UINT8_C( 40), UINT8_C( 35), UINT8_C( 88), UINT8_C(225), UINT8_C( 76), UINT8_C( 13), UINT8_C(179), UINT8_C(226),
+        UINT8_C( 40), UINT8_C(228), UINT8_C(232), UINT8_C( 91), UINT8_C(111), UINT8_C( 20), UINT8_C( 99), UINT8_C( 21),
+        UINT8_C(122), UINT8_C(105), UINT8_C(133), UINT8_C(175), UINT8_C( 74), UINT8_C( 98), UINT8_C( 36), UINT8_C( 84) },
+      { { UINT8_C(106), UINT8_C( 64), UINT8_C(232), UINT8_C(234), UINT8_C(237), UINT8_C( 37), UINT8_C(214), UINT8_C( 70),
+          UINT8_C(140), UINT8_C(230), UINT8_C( 79), UINT8_C(173), UINT8_C( 37), UINT8_C(222), UINT8_C(140), UINT8_C(244) },
+        { UINT8_C(188), UINT8_C( 77), UINT8_C(237), UINT8_C(241), UINT8_C( 52), UINT8_C(  6), UINT8_C(150), UINT8_C( 43),
+          UINT8_C( 40), UINT8_C( 35), UINT8_C( 88), UINT8_C(225), UINT8_C( 76), UINT8_C( 13), UINT8_C(179), UINT8_C(226) },
+        { UINT8_C( 40), UINT8_C(228), UINT8_C(232), UINT8_C( 91), UINT8_C(111), UINT8_C( 20), UINT8_C( 99), UINT8_C( 21),
+          UINT8_C(122), UINT8_C(105), UINT8_C(133), UINT8_C(175), UINT8_C( 74), UINT8_C( 98), UINT8_C( 36), UINT8_C( 84) } } },
+    { { UINT8_C(138), UINT8_C( 62), UINT8_C(212), UINT8_C( 23), UINT8_C( 17), UINT8_C( 16), UINT8_C(169), UINT8_C( 62),
+        UINT8_C(213), UINT8_C(235), UINT8_C( 99), UINT8_C( 48), UINT8_C( 97), UINT8_C(141), UINT8_C(130), UINT8_C(150),
+        UINT8_C( 73), UINT8_C(133), UINT8_C(101), UINT8_C( 20), UINT8_C( 12), UINT8_C(188), UINT8_C( 69), UINT8_C( 44),
+        UINT8_C( 77), UINT8_C( 75), UINT8_C(210), UINT8_C( 70), UINT8_C( 59), UINT8_C(126), UINT8_C(191), UINT8_C( 60),
+        UINT8_C( 95), UINT8_C( 17), UINT8_C( 35), UINT8_C(204), UINT8_C( 72), UINT8_C( 70), UINT8_C( 58), UINT8_C( 94),
+        UINT8_C(227), UINT8_C(152), UINT8_C(119), UINT8_C(196), UINT8_C( 42), UINT8_C(211), UINT8_C( 62), UINT8_C(143) },
+      { { UINT8_C(138), UINT8_C( 62), UINT8_C(212), UINT8_C( 23), UINT8_C( 17), UINT8_C( 16), UINT8_C(169), UINT8_C( 62),
+          UINT8_C(213), UINT8_C(235), UINT8_C( 99), UINT8_C( 48), UINT8_C( 97), UINT8_C(141), UINT8_C(130), UINT8_C(150) },
+        { UINT8_C( 73), UINT8_C(133), UINT8_C(101), UINT8_C( 20), UINT8_C( 12), UINT8_C(188), UINT8_C( 69), UINT8_C( 44),
+          UINT8_C( 77), UINT8_C( 75), UINT8_C(210), UINT8_C( 70), UINT8_C( 59), UINT8_C(126), UINT8_C(191), UINT8_C( 60) },
+        { UINT8_C( 95), UINT8_C( 17), UINT8_C( 35), UINT8_C(204), UINT8_C( 72), UINT8_C( 70), UINT8_C( 58), UINT8_C( 94),
+          UINT8_C(227), UINT8_C(152), UINT8_C(119), UINT8_C(196), UINT8_C( 42), UINT8_C(211), UINT8_C( 62), UINT8_C(143) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x3_t r = simde_vld1q_u8_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[48];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x16x3_t r = simde_vld1q_u8_x3(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[24];
+    uint16_t r[3][8];
+  } test_vec[] = {
+    { { UINT16_C(56470), UINT16_C(11092), UINT16_C(10353), UINT16_C(51472), UINT16_C(57331), UINT16_C(42469), UINT16_C(24656), UINT16_C(41985),
+        UINT16_C(65265), UINT16_C(22460), UINT16_C(   13), UINT16_C(35508), UINT16_C(38738), UINT16_C(11931), UINT16_C(10250), UINT16_C( 9247),
+        UINT16_C(62870), UINT16_C(57488), UINT16_C(11521), UINT16_C( 6010), UINT16_C(47326), UINT16_C(58060), UINT16_C(24434), UINT16_C(13085) },
+      { { UINT16_C(56470), UINT16_C(11092), UINT16_C(10353), UINT16_C(51472), UINT16_C(57331), UINT16_C(42469), UINT16_C(24656), UINT16_C(41985) },
+        { UINT16_C(65265), UINT16_C(22460), UINT16_C(   13), UINT16_C(35508), UINT16_C(38738), UINT16_C(11931), UINT16_C(10250), UINT16_C( 9247) },
+        { UINT16_C(62870), UINT16_C(57488), UINT16_C(11521), UINT16_C( 6010), UINT16_C(47326), UINT16_C(58060), UINT16_C(24434), UINT16_C(13085) } } },
+    { { UINT16_C(43476), UINT16_C(22740), UINT16_C(48009), UINT16_C(11898), UINT16_C(29232), UINT16_C(53162), UINT16_C( 2085), UINT16_C(33066),
+        UINT16_C(51544), UINT16_C( 6557), UINT16_C(59294), UINT16_C(65256), UINT16_C(60080), UINT16_C(35481), UINT16_C(23882), UINT16_C(28819),
+        UINT16_C(62181), UINT16_C(24472), UINT16_C(24747), UINT16_C(21086), UINT16_C(21652), UINT16_C(44970), UINT16_C(54752), UINT16_C(10915) },
+      { { UINT16_C(43476), UINT16_C(22740), UINT16_C(48009), UINT16_C(11898), UINT16_C(29232), UINT16_C(53162), UINT16_C( 2085), UINT16_C(33066) },
+        { UINT16_C(51544), UINT16_C( 6557), UINT16_C(59294), UINT16_C(65256), UINT16_C(60080), UINT16_C(35481), UINT16_C(23882), UINT16_C(28819) },
+        { UINT16_C(62181), UINT16_C(24472), UINT16_C(24747), UINT16_C(21086), UINT16_C(21652), UINT16_C(44970), UINT16_C(54752), UINT16_C(10915) } } },
+    { { UINT16_C(33746), UINT16_C(46226), UINT16_C(62938), UINT16_C(54411), UINT16_C(30276), UINT16_C(33045), UINT16_C(40655), UINT16_C(15472),
+        UINT16_C(35945), UINT16_C( 2472), UINT16_C(24497), UINT16_C(60877), UINT16_C(19452), UINT16_C(18111), UINT16_C(10302), UINT16_C(18274),
+        UINT16_C(27221), UINT16_C(15879), UINT16_C(64518), UINT16_C(25253), UINT16_C(55484), UINT16_C(58433), UINT16_C(23619), UINT16_C(53884) },
+      { { UINT16_C(33746), UINT16_C(46226), UINT16_C(62938), UINT16_C(54411), UINT16_C(30276), UINT16_C(33045), UINT16_C(40655), UINT16_C(15472) },
+        { UINT16_C(35945), UINT16_C( 2472), UINT16_C(24497), UINT16_C(60877), UINT16_C(19452), UINT16_C(18111), UINT16_C(10302), UINT16_C(18274) },
+        { UINT16_C(27221), UINT16_C(15879), UINT16_C(64518), UINT16_C(25253), UINT16_C(55484), UINT16_C(58433), UINT16_C(23619), UINT16_C(53884) } } },
+    { { UINT16_C( 2760), UINT16_C( 2278), UINT16_C( 4647), UINT16_C(13311), UINT16_C(50008), UINT16_C(31846), UINT16_C( 1938), UINT16_C(13367),
+        UINT16_C(22446), UINT16_C(24952), UINT16_C(60784), UINT16_C(38421), UINT16_C(16378), UINT16_C(27257), UINT16_C(61362), UINT16_C(53695),
+        UINT16_C(44784), UINT16_C(59517), UINT16_C(11513), UINT16_C(41731), UINT16_C(14041), UINT16_C( 6450), UINT16_C(54955), UINT16_C(57845) },
+      { { UINT16_C( 2760), UINT16_C( 2278), UINT16_C( 4647), UINT16_C(13311), UINT16_C(50008), UINT16_C(31846), UINT16_C( 1938), UINT16_C(13367) },
+        { UINT16_C(22446), UINT16_C(24952), UINT16_C(60784), UINT16_C(38421), UINT16_C(16378), UINT16_C(27257), UINT16_C(61362), UINT16_C(53695) },
+        { UINT16_C(44784), UINT16_C(59517), UINT16_C(11513), UINT16_C(41731), UINT16_C(14041), UINT16_C( 6450), UINT16_C(54955), UINT16_C(57845) } } },
+    { { UINT16_C(58809), UINT16_C(29775), UINT16_C(15853), UINT16_C(57964), UINT16_C(14503), UINT16_C( 2033), UINT16_C(64546), UINT16_C(42355),
+        UINT16_C(25044), UINT16_C(26272), UINT16_C(30297), UINT16_C(10688), UINT16_C( 5863), UINT16_C(14349), UINT16_C( 8139), UINT16_C(59879),
+        UINT16_C( 6054), UINT16_C(21575), UINT16_C(35637), UINT16_C(40911), UINT16_C(58074), UINT16_C(38006), UINT16_C( 6251), UINT16_C(19013) },
+      { { UINT16_C(58809), UINT16_C(29775), UINT16_C(15853), UINT16_C(57964), UINT16_C(14503), UINT16_C( 2033), UINT16_C(64546), UINT16_C(42355) },
+        { UINT16_C(25044), UINT16_C(26272), UINT16_C(30297), UINT16_C(10688), UINT16_C( 5863), UINT16_C(14349), UINT16_C( 8139), UINT16_C(59879) },
+        { UINT16_C( 6054), UINT16_C(21575), UINT16_C(35637), UINT16_C(40911), UINT16_C(58074), UINT16_C(38006), UINT16_C( 6251), UINT16_C(19013) } } },
+    { { UINT16_C(61525), UINT16_C( 7273), UINT16_C(33260), UINT16_C(17189), UINT16_C(27397), UINT16_C(44191), UINT16_C(58274), UINT16_C( 6745),
+        UINT16_C(56192), UINT16_C(48245), UINT16_C(52939), UINT16_C(17061), UINT16_C(35100), UINT16_C(44514), UINT16_C(60883), UINT16_C(48859),
+        UINT16_C(38997), UINT16_C(15373), UINT16_C( 5520), UINT16_C(30537), UINT16_C(22336), UINT16_C( 9685), UINT16_C(18700), UINT16_C(56659) },
+      { { UINT16_C(61525), UINT16_C( 7273), UINT16_C(33260), UINT16_C(17189), UINT16_C(27397), UINT16_C(44191), UINT16_C(58274), UINT16_C( 6745) },
+        { UINT16_C(56192), UINT16_C(48245), UINT16_C(52939), UINT16_C(17061), UINT16_C(35100), UINT16_C(44514), UINT16_C(60883), UINT16_C(48859) },
+        { UINT16_C(38997), UINT16_C(15373), UINT16_C( 5520), UINT16_C(30537), UINT16_C(22336), UINT16_C( 9685), UINT16_C(18700), UINT16_C(56659) } } },
+    { { UINT16_C(41063), UINT16_C(52974), UINT16_C(38038), UINT16_C(51118), UINT16_C(29756), UINT16_C( 3093), UINT16_C(34178), UINT16_C(25805),
+        UINT16_C(29036), UINT16_C(12715), UINT16_C(28645), UINT16_C(25133), UINT16_C(27705), UINT16_C(54901), UINT16_C(15626), UINT16_C(52818),
+        UINT16_C(59861), UINT16_C(25882), UINT16_C(42660), UINT16_C(23455), UINT16_C(60206), UINT16_C(30757), UINT16_C( 3007), UINT16_C(35256) },
+      { { UINT16_C(41063), UINT16_C(52974), UINT16_C(38038), UINT16_C(51118), UINT16_C(29756), UINT16_C( 3093), UINT16_C(34178), UINT16_C(25805) },
+        { UINT16_C(29036), UINT16_C(12715), UINT16_C(28645), UINT16_C(25133), UINT16_C(27705), UINT16_C(54901), UINT16_C(15626), UINT16_C(52818) },
+        { UINT16_C(59861), UINT16_C(25882), UINT16_C(42660), UINT16_C(23455), UINT16_C(60206), UINT16_C(30757), UINT16_C( 3007), UINT16_C(35256) } } },
+    { { UINT16_C(29038), UINT16_C(22877), UINT16_C(32087), UINT16_C(21415), UINT16_C(40899), UINT16_C(56471), UINT16_C(60236), UINT16_C( 1577),
+        UINT16_C(40667), UINT16_C(22894), UINT16_C(25565), UINT16_C(24427), UINT16_C( 5700), UINT16_C(15847), UINT16_C(31546), UINT16_C(40804),
+        UINT16_C(38520), UINT16_C(30661), UINT16_C(11720), UINT16_C(45719), UINT16_C(13275), UINT16_C(14657), UINT16_C( 3175), UINT16_C( 8186) },
+      { { UINT16_C(29038), UINT16_C(22877), UINT16_C(32087), UINT16_C(21415), UINT16_C(40899), UINT16_C(56471), UINT16_C(60236), UINT16_C( 1577) },
+        { UINT16_C(40667), UINT16_C(22894), UINT16_C(25565), UINT16_C(24427), UINT16_C( 5700), UINT16_C(15847), UINT16_C(31546), UINT16_C(40804) },
+        { UINT16_C(38520), UINT16_C(30661), UINT16_C(11720), UINT16_C(45719), UINT16_C(13275), UINT16_C(14657), UINT16_C( 3175), UINT16_C( 8186) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x3_t r = simde_vld1q_u16_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[2], simde_vld1q_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a[24];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint16x8x3_t r = simde_vld1q_u16_x3(a);
+
+    simde_test_codegen_write_vu16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[12];
+    uint32_t r[3][4];
+  } test_vec[] = {
+    { { UINT32_C(1230030576), UINT32_C(2483892222), UINT32_C(1659258945), UINT32_C( 780793117), UINT32_C(1191630129), UINT32_C( 184406787), UINT32_C(1435018343), UINT32_C(3566721259),
+        UINT32_C(3390279626), UINT32_C( 285671931), UINT32_C(2466707293), UINT32_C(4091008740) },
+      { { UINT32_C(1230030576), UINT32_C(2483892222), UINT32_C(1659258945), UINT32_C( 780793117) },
+        { UINT32_C(1191630129), UINT32_C( 184406787), UINT32_C(1435018343), UINT32_C(3566721259) },
+        { UINT32_C(3390279626), UINT32_C( 285671931), UINT32_C(2466707293), UINT32_C(4091008740) } } },
+    { { UINT32_C(1623608728), UINT32_C(1797799946), UINT32_C(3546774405), UINT32_C(2826398396), UINT32_C(2994859870), UINT32_C(4209678917), UINT32_C(2826557028), UINT32_C(1727911247),
+        UINT32_C(3789421336), UINT32_C(4083302161), UINT32_C(2994138737), UINT32_C(3758612760) },
+      { { UINT32_C(1623608728), UINT32_C(1797799946), UINT32_C(3546774405), UINT32_C(2826398396) },
+        { UINT32_C(2994859870), UINT32_C(4209678917), UINT32_C(2826557028), UINT32_C(1727911247) },
+        { UINT32_C(3789421336), UINT32_C(4083302161), UINT32_C(2994138737), UINT32_C(3758612760) } } },
+    { { UINT32_C(4177146811), UINT32_C(2450942053), UINT32_C(2774469309), UINT32_C( 687753091), UINT32_C(3893910264), UINT32_C(1242498921), UINT32_C( 629553531), UINT32_C(3057016930),
+        UINT32_C(2697510851), UINT32_C(3033948766), UINT32_C(4085766793), UINT32_C(2767092508) },
+      { { UINT32_C(4177146811), UINT32_C(2450942053), UINT32_C(2774469309), UINT32_C( 687753091) },
+        { UINT32_C(3893910264), UINT32_C(1242498921), UINT32_C( 629553531), UINT32_C(3057016930) },
+        { UINT32_C(2697510851), UINT32_C(3033948766), UINT32_C(4085766793), UINT32_C(2767092508) } } },
+    { { UINT32_C(1451398461), UINT32_C( 463820986), UINT32_C(4213067561), UINT32_C(3839953784), UINT32_C(3248984928), UINT32_C(1011879313), UINT32_C(3015180535), UINT32_C(2067318574),
+        UINT32_C(3944267087), UINT32_C(2069842022), UINT32_C(2916963836), UINT32_C( 109301289) },
+      { { UINT32_C(1451398461), UINT32_C( 463820986), UINT32_C(4213067561), UINT32_C(3839953784) },
+        { UINT32_C(3248984928), UINT32_C(1011879313), UINT32_C(3015180535), UINT32_C(2067318574) },
+        { UINT32_C(3944267087), UINT32_C(2069842022), UINT32_C(2916963836), UINT32_C( 109301289) } } },
+    { { UINT32_C(1832221153), UINT32_C(3633152896), UINT32_C(4276940095), UINT32_C(3009319134), UINT32_C(4061709974), UINT32_C(4110439351), UINT32_C(1825947777), UINT32_C(2131971725),
+        UINT32_C( 151617471), UINT32_C(2170387333), UINT32_C(2629207944), UINT32_C(2025028062) },
+      { { UINT32_C(1832221153), UINT32_C(3633152896), UINT32_C(4276940095), UINT32_C(3009319134) },
+        { UINT32_C(4061709974), UINT32_C(4110439351), UINT32_C(1825947777), UINT32_C(2131971725) },
+        { UINT32_C( 151617471), UINT32_C(2170387333), UINT32_C(2629207944), UINT32_C(2025028062) } } },
+    { { UINT32_C(2953675630), UINT32_C(2156586294), UINT32_C(1761492419), UINT32_C(1834273467), UINT32_C( 135966853), UINT32_C(2318622399), UINT32_C( 350745966), UINT32_C(2735201795),
+        UINT32_C(3116666999), UINT32_C(2057679054), UINT32_C(1401927161), UINT32_C(2856935662) },
+      { { UINT32_C(2953675630), UINT32_C(2156586294), UINT32_C(1761492419), UINT32_C(1834273467) },
+        { UINT32_C( 135966853), UINT32_C(2318622399), UINT32_C( 350745966), UINT32_C(2735201795) },
+        { UINT32_C(3116666999), UINT32_C(2057679054), UINT32_C(1401927161), UINT32_C(2856935662) } } },
+    { { UINT32_C(1661867104), UINT32_C( 653180845), UINT32_C(3518015282), UINT32_C(2244042573), UINT32_C(1707919590), UINT32_C(2267644393), UINT32_C(4078454098), UINT32_C(1342237367),
+        UINT32_C(1489997641), UINT32_C(1639219218), UINT32_C( 619057755), UINT32_C(2807623568) },
+      { { UINT32_C(1661867104), UINT32_C( 653180845), UINT32_C(3518015282), UINT32_C(2244042573) },
+        { UINT32_C(1707919590), UINT32_C(2267644393), UINT32_C(4078454098), UINT32_C(1342237367) },
+        { UINT32_C(1489997641), UINT32_C(1639219218), UINT32_C( 619057755), UINT32_C(2807623568) } } },
+    { { UINT32_C(1769524094), UINT32_C(1817578474), UINT32_C(4049809738), UINT32_C(2799571616), UINT32_C(  52899251), UINT32_C(2783634197), UINT32_C( 389126030), UINT32_C(1362438027),
+        UINT32_C( 517455745), UINT32_C(2963656149), UINT32_C(1473566328), UINT32_C(1738925095) },
+      { { UINT32_C(1769524094), UINT32_C(1817578474), UINT32_C(4049809738), UINT32_C(2799571616) },
+        { UINT32_C(  52899251), UINT32_C(2783634197), UINT32_C( 389126030), UINT32_C(1362438027) },
+        { UINT32_C( 517455745), UINT32_C(2963656149), UINT32_C(1473566328), UINT32_C(1738925095) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x3_t r = simde_vld1q_u32_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[12];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x4x3_t r = simde_vld1q_u32_x3(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[6];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    { { UINT64_C( 4961365197358649426), UINT64_C( 9402667997077414760), UINT64_C(15461378116016510254), UINT64_C(14371424273979311059),
+        UINT64_C( 7285876832189980380), UINT64_C(18241062950726278175) },
+      { { UINT64_C( 4961365197358649426), UINT64_C( 9402667997077414760) },
+        { UINT64_C(15461378116016510254), UINT64_C(14371424273979311059) },
+        { UINT64_C( 7285876832189980380), UINT64_C(18241062950726278175) } } },
+    { { UINT64_C( 5983000552922628410), UINT64_C( 6596491233042906738), UINT64_C(16442312345128689371), UINT64_C(12128563092291366375),
+        UINT64_C(14745720487133667225), UINT64_C( 6611992784199341211) },
+      { { UINT64_C( 5983000552922628410), UINT64_C( 6596491233042906738) },
+        { UINT64_C(16442312345128689371), UINT64_C(12128563092291366375) },
+        { UINT64_C(14745720487133667225), UINT64_C( 6611992784199341211) } } },
+    { { UINT64_C( 6363497259824091075), UINT64_C(17749377480193951073), UINT64_C(10124246111944993511), UINT64_C( 2840700259416400867),
+        UINT64_C( 7516902243648163427), UINT64_C(12922923186738842396) },
+      { { UINT64_C( 6363497259824091075), UINT64_C(17749377480193951073) },
+        { UINT64_C(10124246111944993511), UINT64_C( 2840700259416400867) },
+        { UINT64_C( 7516902243648163427), UINT64_C(12922923186738842396) } } },
+    { { UINT64_C( 4298746892764671201), UINT64_C(15361447196953341707), UINT64_C(12573883744206372710), UINT64_C( 3429089577177141218),
+        UINT64_C( 6061170996205651846), UINT64_C(10192359017145163245) },
+      { { UINT64_C( 4298746892764671201), UINT64_C(15361447196953341707) },
+        { UINT64_C(12573883744206372710), UINT64_C( 3429089577177141218) },
+        { UINT64_C( 6061170996205651846), UINT64_C(10192359017145163245) } } },
+    { { UINT64_C( 2608813150892287109), UINT64_C( 5935639939770180817), UINT64_C( 4134933944117585190), UINT64_C(10860721802237419597),
+        UINT64_C(17338695887542720567), UINT64_C(13539129271410899692) },
+      { { UINT64_C( 2608813150892287109), UINT64_C( 5935639939770180817) },
+        { UINT64_C( 4134933944117585190), UINT64_C(10860721802237419597) },
+        { UINT64_C(17338695887542720567), UINT64_C(13539129271410899692) } } },
+    { { UINT64_C( 9970248393653350401), UINT64_C( 6873512210979666415), UINT64_C(16983332993452372318), UINT64_C(10058634090784624411),
+        UINT64_C(  985266594382669676), UINT64_C(14059257872121601822) },
+      { { UINT64_C( 9970248393653350401), UINT64_C( 6873512210979666415) },
+        { UINT64_C(16983332993452372318), UINT64_C(10058634090784624411) },
+        { UINT64_C(  985266594382669676), UINT64_C(14059257872121601822) } } },
+    { { UINT64_C( 4868205348596167367), UINT64_C( 2376297512274528497), UINT64_C(   97068217867510783), UINT64_C(10648169865528100421),
+        UINT64_C( 6120869415586102010), UINT64_C( 5918856339115572930) },
+      { { UINT64_C( 4868205348596167367), UINT64_C( 2376297512274528497) },
+        { UINT64_C(   97068217867510783), UINT64_C(10648169865528100421) },
+        { UINT64_C( 6120869415586102010), UINT64_C( 5918856339115572930) } } },
+    { { UINT64_C(15780595322731951389), UINT64_C(18326931353391620399), UINT64_C( 2311269185289940815), UINT64_C(12321983999446468871),
+        UINT64_C( 1841552192942603970), UINT64_C(10638247805115812170) },
+      { { UINT64_C(15780595322731951389), UINT64_C(18326931353391620399) },
+        { UINT64_C( 2311269185289940815), UINT64_C(12321983999446468871) },
+        { UINT64_C( 1841552192942603970), UINT64_C(10638247805115812170) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x3_t r = simde_vld1q_u64_x3(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[6];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x2x3_t r = simde_vld1q_u64_x3(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2x3(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_f32_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_f64_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s8_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s16_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s32_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s64_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u8_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u16_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u32_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u64_x3)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_f32_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_f64_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s8_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s16_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s32_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s64_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u8_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u16_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u32_x3)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u64_x3)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1830 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld1_x4
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld1_x4.h"
+
+static int
+test_simde_vld1_f32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[8];
+    simde_float32 r[4][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   875.40), SIMDE_FLOAT32_C(  -842.15), SIMDE_FLOAT32_C(     1.98), SIMDE_FLOAT32_C(  -124.81),
+        SIMDE_FLOAT32_C(   117.19), SIMDE_FLOAT32_C(  -124.72), SIMDE_FLOAT32_C(  -458.22), SIMDE_FLOAT32_C(   467.49) },
+      { { SIMDE_FLOAT32_C(   875.40), SIMDE_FLOAT32_C(  -842.15) },
+        { SIMDE_FLOAT32_C(     1.98), SIMDE_FLOAT32_C(  -124.81) },
+        { SIMDE_FLOAT32_C(   117.19), SIMDE_FLOAT32_C(  -124.72) },
+        { SIMDE_FLOAT32_C(  -458.22), SIMDE_FLOAT32_C(   467.49) } } },
+    { { SIMDE_FLOAT32_C(  -909.68), SIMDE_FLOAT32_C(   996.15), SIMDE_FLOAT32_C(   818.73), SIMDE_FLOAT32_C(    24.92),
+        SIMDE_FLOAT32_C(   672.35), SIMDE_FLOAT32_C(   434.41), SIMDE_FLOAT32_C(  -480.63), SIMDE_FLOAT32_C(  -675.89) },
+      { { SIMDE_FLOAT32_C(  -909.68), SIMDE_FLOAT32_C(   996.15) },
+        { SIMDE_FLOAT32_C(   818.73), SIMDE_FLOAT32_C(    24.92) },
+        { SIMDE_FLOAT32_C(   672.35), SIMDE_FLOAT32_C(   434.41) },
+        { SIMDE_FLOAT32_C(  -480.63), SIMDE_FLOAT32_C(  -675.89) } } },
+    { { SIMDE_FLOAT32_C(   295.95), SIMDE_FLOAT32_C(   406.17), SIMDE_FLOAT32_C(   661.04), SIMDE_FLOAT32_C(   167.05),
+        SIMDE_FLOAT32_C(   136.96), SIMDE_FLOAT32_C(   586.92), SIMDE_FLOAT32_C(   358.48), SIMDE_FLOAT32_C(    40.83) },
+      { { SIMDE_FLOAT32_C(   295.95), SIMDE_FLOAT32_C(   406.17) },
+        { SIMDE_FLOAT32_C(   661.04), SIMDE_FLOAT32_C(   167.05) },
+        { SIMDE_FLOAT32_C(   136.96), SIMDE_FLOAT32_C(   586.92) },
+        { SIMDE_FLOAT32_C(   358.48), SIMDE_FLOAT32_C(    40.83) } } },
+    { { SIMDE_FLOAT32_C(  -146.92), SIMDE_FLOAT32_C(   -40.40), SIMDE_FLOAT32_C(    70.54), SIMDE_FLOAT32_C(  -177.56),
+        SIMDE_FLOAT32_C(   850.97), SIMDE_FLOAT32_C(  -431.88), SIMDE_FLOAT32_C(  -309.34), SIMDE_FLOAT32_C(  -831.04) },
+      { { SIMDE_FLOAT32_C(  -146.92), SIMDE_FLOAT32_C(   -40.40) },
+        { SIMDE_FLOAT32_C(    70.54), SIMDE_FLOAT32_C(  -177.56) },
+        { SIMDE_FLOAT32_C(   850.97), SIMDE_FLOAT32_C(  -431.88) },
+        { SIMDE_FLOAT32_C(  -309.34), SIMDE_FLOAT32_C(  -831.04) } } },
+    { { SIMDE_FLOAT32_C(  -928.65), SIMDE_FLOAT32_C(  -545.48), SIMDE_FLOAT32_C(   463.33), SIMDE_FLOAT32_C(   780.77),
+        SIMDE_FLOAT32_C(   304.77), SIMDE_FLOAT32_C(   648.90), SIMDE_FLOAT32_C(  -559.14), SIMDE_FLOAT32_C(  -872.10) },
+      { { SIMDE_FLOAT32_C(  -928.65), SIMDE_FLOAT32_C(  -545.48) },
+        { SIMDE_FLOAT32_C(   463.33), SIMDE_FLOAT32_C(   780.77) },
+        { SIMDE_FLOAT32_C(   304.77), SIMDE_FLOAT32_C(   648.90) },
+        { SIMDE_FLOAT32_C(  -559.14), SIMDE_FLOAT32_C(  -872.10) } } },
+    { { SIMDE_FLOAT32_C(   935.01), SIMDE_FLOAT32_C(  -625.83), SIMDE_FLOAT32_C(  -278.92), SIMDE_FLOAT32_C(   328.14),
+        SIMDE_FLOAT32_C(  -564.98), SIMDE_FLOAT32_C(  -959.74), SIMDE_FLOAT32_C(   496.80), SIMDE_FLOAT32_C(   961.32) },
+      { { SIMDE_FLOAT32_C(   935.01), SIMDE_FLOAT32_C(  -625.83) },
+        { SIMDE_FLOAT32_C(  -278.92), SIMDE_FLOAT32_C(   328.14) },
+        { SIMDE_FLOAT32_C(  -564.98), SIMDE_FLOAT32_C(  -959.74) },
+        { SIMDE_FLOAT32_C(   496.80), SIMDE_FLOAT32_C(   961.32) } } },
+    { { SIMDE_FLOAT32_C(   863.73), SIMDE_FLOAT32_C(  -558.93), SIMDE_FLOAT32_C(  -500.75), SIMDE_FLOAT32_C(  -658.78),
+        SIMDE_FLOAT32_C(   293.80), SIMDE_FLOAT32_C(   846.57), SIMDE_FLOAT32_C(   267.58), SIMDE_FLOAT32_C(  -285.02) },
+      { { SIMDE_FLOAT32_C(   863.73), SIMDE_FLOAT32_C(  -558.93) },
+        { SIMDE_FLOAT32_C(  -500.75), SIMDE_FLOAT32_C(  -658.78) },
+        { SIMDE_FLOAT32_C(   293.80), SIMDE_FLOAT32_C(   846.57) },
+        { SIMDE_FLOAT32_C(   267.58), SIMDE_FLOAT32_C(  -285.02) } } },
+    { { SIMDE_FLOAT32_C(   710.59), SIMDE_FLOAT32_C(   662.00), SIMDE_FLOAT32_C(   -20.76), SIMDE_FLOAT32_C(  -869.77),
+        SIMDE_FLOAT32_C(   587.83), SIMDE_FLOAT32_C(  -342.67), SIMDE_FLOAT32_C(  -852.47), SIMDE_FLOAT32_C(  -351.50) },
+      { { SIMDE_FLOAT32_C(   710.59), SIMDE_FLOAT32_C(   662.00) },
+        { SIMDE_FLOAT32_C(   -20.76), SIMDE_FLOAT32_C(  -869.77) },
+        { SIMDE_FLOAT32_C(   587.83), SIMDE_FLOAT32_C(  -342.67) },
+        { SIMDE_FLOAT32_C(  -852.47), SIMDE_FLOAT32_C(  -351.50) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x4_t r = simde_vld1_f32_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[2], simde_vld1_f32(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[3], simde_vld1_f32(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a[8];
+    simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, -1000.0f, 1000.0f);
+    simde_float32x2x4_t r = simde_vld1_f32_x4(a);
+
+    simde_test_codegen_write_vf32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_f64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[4];
+    simde_float64 r[4][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   133.58), SIMDE_FLOAT64_C(  -834.79), SIMDE_FLOAT64_C(  -857.90), SIMDE_FLOAT64_C(   508.32) },
+      { { SIMDE_FLOAT64_C(   133.58) },
+        { SIMDE_FLOAT64_C(  -834.79) },
+        { SIMDE_FLOAT64_C(  -857.90) },
+        { SIMDE_FLOAT64_C(   508.32) } } },
+    { { SIMDE_FLOAT64_C(  -366.09), SIMDE_FLOAT64_C(  -236.32), SIMDE_FLOAT64_C(   439.87), SIMDE_FLOAT64_C(   821.30) },
+      { { SIMDE_FLOAT64_C(  -366.09) },
+        { SIMDE_FLOAT64_C(  -236.32) },
+        { SIMDE_FLOAT64_C(   439.87) },
+        { SIMDE_FLOAT64_C(   821.30) } } },
+    { { SIMDE_FLOAT64_C(   642.89), SIMDE_FLOAT64_C(  -999.76), SIMDE_FLOAT64_C(   816.80), SIMDE_FLOAT64_C(    81.31) },
+      { { SIMDE_FLOAT64_C(   642.89) },
+        { SIMDE_FLOAT64_C(  -999.76) },
+        { SIMDE_FLOAT64_C(   816.80) },
+        { SIMDE_FLOAT64_C(    81.31) } } },
+    { { SIMDE_FLOAT64_C(   151.45), SIMDE_FLOAT64_C(  -724.89), SIMDE_FLOAT64_C(   647.80), SIMDE_FLOAT64_C(  -395.02) },
+      { { SIMDE_FLOAT64_C(   151.45) },
+        { SIMDE_FLOAT64_C(  -724.89) },
+        { SIMDE_FLOAT64_C(   647.80) },
+        { SIMDE_FLOAT64_C(  -395.02) } } },
+    { { SIMDE_FLOAT64_C(  -559.70), SIMDE_FLOAT64_C(  -164.80), SIMDE_FLOAT64_C(   936.16), SIMDE_FLOAT64_C(  -470.88) },
+      { { SIMDE_FLOAT64_C(  -559.70) },
+        { SIMDE_FLOAT64_C(  -164.80) },
+        { SIMDE_FLOAT64_C(   936.16) },
+        { SIMDE_FLOAT64_C(  -470.88) } } },
+    { { SIMDE_FLOAT64_C(    54.86), SIMDE_FLOAT64_C(   362.72), SIMDE_FLOAT64_C(   890.08), SIMDE_FLOAT64_C(  -799.05) },
+      { { SIMDE_FLOAT64_C(    54.86) },
+        { SIMDE_FLOAT64_C(   362.72) },
+        { SIMDE_FLOAT64_C(   890.08) },
+        { SIMDE_FLOAT64_C(  -799.05) } } },
+    { { SIMDE_FLOAT64_C(   179.68), SIMDE_FLOAT64_C(   774.93), SIMDE_FLOAT64_C(  -895.14), SIMDE_FLOAT64_C(    35.42) },
+      { { SIMDE_FLOAT64_C(   179.68) },
+        { SIMDE_FLOAT64_C(   774.93) },
+        { SIMDE_FLOAT64_C(  -895.14) },
+        { SIMDE_FLOAT64_C(    35.42) } } },
+    { { SIMDE_FLOAT64_C(  -476.24), SIMDE_FLOAT64_C(   -93.26), SIMDE_FLOAT64_C(   696.92), SIMDE_FLOAT64_C(  -249.90) },
+      { { SIMDE_FLOAT64_C(  -476.24) },
+        { SIMDE_FLOAT64_C(   -93.26) },
+        { SIMDE_FLOAT64_C(   696.92) },
+        { SIMDE_FLOAT64_C(  -249.90) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x4_t r = simde_vld1_f64_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[2], simde_vld1_f64(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[3], simde_vld1_f64(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a[4];
+    simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, -1000.0, 1000.0);
+    simde_float64x1x4_t r = simde_vld1_f64_x4(a);
+
+    simde_test_codegen_write_vf64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[32];
+    int8_t r[4][8];
+  } test_vec[] = {
+    { { -INT8_C(  20),      INT8_MIN, -INT8_C(  60), -INT8_C(  74),  INT8_C(  53), -INT8_C(  96), -INT8_C(  66), -INT8_C(  57),
+         INT8_C( 101),  INT8_C(  95),  INT8_C(  87),  INT8_C(  12),  INT8_C( 114), -INT8_C(  98), -INT8_C(   1), -INT8_C(  86),
+        -INT8_C(  55), -INT8_C(  39), -INT8_C( 114), -INT8_C(  91),  INT8_C(  17),  INT8_C( 101),  INT8_C(  91),  INT8_C(  35),
+         INT8_C(   4),  INT8_C(  26),  INT8_C(  90), -INT8_C(  68), -INT8_C(  88),  INT8_C(  89),  INT8_C(  45), -INT8_C(  21) },
+      { { -INT8_C(  20),      INT8_MIN, -INT8_C(  60), -INT8_C(  74),  INT8_C(  53), -INT8_C(  96), -INT8_C(  66), -INT8_C(  57) },
+        {  INT8_C( 101),  INT8_C(  95),  INT8_C(  87),  INT8_C(  12),  INT8_C( 114), -INT8_C(  98), -INT8_C(   1), -INT8_C(  86) },
+        { -INT8_C(  55), -INT8_C(  39), -INT8_C( 114), -INT8_C(  91),  INT8_C(  17),  INT8_C( 101),  INT8_C(  91),  INT8_C(  35) },
+        {  INT8_C(   4),  INT8_C(  26),  INT8_C(  90), -INT8_C(  68), -INT8_C(  88),  INT8_C(  89),  INT8_C(  45), -INT8_C(  21) } } },
+    { { -INT8_C( 125), -INT8_C( 120),  INT8_C(  13), -INT8_C(  74), -INT8_C(  94),  INT8_C(  23),  INT8_C(  46),  INT8_C(  40),
+         INT8_C(  58),  INT8_C(  81), -INT8_C(  95), -INT8_C(  26),  INT8_C( 103),  INT8_C(  22),  INT8_C( 118), -INT8_C(  64),
+        -INT8_C( 116),  INT8_C(  23),  INT8_C(   8),  INT8_C(  23),  INT8_C(  18),  INT8_C(  43),  INT8_C( 102), -INT8_C(  40),
+         INT8_C( 120),  INT8_C(  54),  INT8_C(  37),  INT8_C(  42), -INT8_C( 108), -INT8_C(  75), -INT8_C( 124),  INT8_C(  51) },
+      { { -INT8_C( 125), -INT8_C( 120),  INT8_C(  13), -INT8_C(  74), -INT8_C(  94),  INT8_C(  23),  INT8_C(  46),  INT8_C(  40) },
+        {  INT8_C(  58),  INT8_C(  81), -INT8_C(  95), -INT8_C(  26),  INT8_C( 103),  INT8_C(  22),  INT8_C( 118), -INT8_C(  64) },
+        { -INT8_C( 116),  INT8_C(  23),  INT8_C(   8),  INT8_C(  23),  INT8_C(  18),  INT8_C(  43),  INT8_C( 102), -INT8_C(  40) },
+        {  INT8_C( 120),  INT8_C(  54),  INT8_C(  37),  INT8_C(  42), -INT8_C( 108), -INT8_C(  75), -INT8_C( 124),  INT8_C(  51) } } },
+    { {  INT8_C(  70), -INT8_C(  17),  INT8_C(  20),  INT8_C(  89), -INT8_C(  34),  INT8_C( 100), -INT8_C(  55), -INT8_C(  92),
+         INT8_C(  55),  INT8_C(   4),  INT8_C(  66), -INT8_C( 122), -INT8_C(  26),  INT8_C(  94),  INT8_C(  40),  INT8_C(  91),
+        -INT8_C(  76), -INT8_C(  59),  INT8_C(  48), -INT8_C(  74), -INT8_C( 101),  INT8_C(  93), -INT8_C(  52), -INT8_C(  67),
+        -INT8_C(  60), -INT8_C(   5), -INT8_C(  77), -INT8_C(  81),  INT8_C( 126), -INT8_C(  85), -INT8_C( 103),  INT8_C(  77) },
+      { {  INT8_C(  70), -INT8_C(  17),  INT8_C(  20),  INT8_C(  89), -INT8_C(  34),  INT8_C( 100), -INT8_C(  55), -INT8_C(  92) },
+        {  INT8_C(  55),  INT8_C(   4),  INT8_C(  66), -INT8_C( 122), -INT8_C(  26),  INT8_C(  94),  INT8_C(  40),  INT8_C(  91) },
+        { -INT8_C(  76), -INT8_C(  59),  INT8_C(  48), -INT8_C(  74), -INT8_C( 101),  INT8_C(  93), -INT8_C(  52), -INT8_C(  67) },
+        { -INT8_C(  60), -INT8_C(   5), -INT8_C(  77), -INT8_C(  81),  INT8_C( 126), -INT8_C(  85), -INT8_C( 103),  INT8_C(  77) } } },
+    { { -INT8_C( 122),  INT8_C(  41), -INT8_C(  44),  INT8_C(  61), -INT8_C( 108), -INT8_C(   5), -INT8_C(  62),  INT8_C( 111),
+         INT8_C(  74), -INT8_C(   8), -INT8_C(   2),  INT8_C(  75),  INT8_C( 111), -INT8_C( 116),  INT8_C(  79),  INT8_C(  62),
+         INT8_C(  93), -INT8_C(  30), -INT8_C(  98),  INT8_C(  36),  INT8_C(  32), -INT8_C(   6), -INT8_C( 121),  INT8_C( 108),
+        -INT8_C(  43),  INT8_C(  91),  INT8_C(  78), -INT8_C(  36),  INT8_C(  34), -INT8_C(  95), -INT8_C(  35), -INT8_C(  93) },
+      { { -INT8_C( 122),  INT8_C(  41), -INT8_C(  44),  INT8_C(  61), -INT8_C( 108), -INT8_C(   5), -INT8_C(  62),  INT8_C( 111) },
+        {  INT8_C(  74), -INT8_C(   8), -INT8_C(   2),  INT8_C(  75),  INT8_C( 111), -INT8_C( 116),  INT8_C(  79),  INT8_C(  62) },
+        {  INT8_C(  93), -INT8_C(  30), -INT8_C(  98),  INT8_C(  36),  INT8_C(  32), -INT8_C(   6), -INT8_C( 121),  INT8_C( 108) },
+        { -INT8_C(  43),  INT8_C(  91),  INT8_C(  78), -INT8_C(  36),  INT8_C(  34), -INT8_C(  95), -INT8_C(  35), -INT8_C(  93) } } },
+    { { -INT8_C(  83),      INT8_MAX,  INT8_C(  36), -INT8_C( 119),  INT8_C(  29),  INT8_C(  45), -INT8_C(  27), -INT8_C(  66),
+         INT8_C(  99), -INT8_C(  83),  INT8_C(  62), -INT8_C(  14),      INT8_MAX,  INT8_C(   0),  INT8_C(  61), -INT8_C(  84),
+        -INT8_C(   9),  INT8_C(  82),  INT8_C(  18), -INT8_C(  61),  INT8_C(  96),  INT8_C(  36), -INT8_C(  17), -INT8_C( 101),
+         INT8_C(  46),  INT8_C(  46), -INT8_C(  94), -INT8_C( 101), -INT8_C(  35), -INT8_C(  93),  INT8_C(  52),  INT8_C(  63) },
+      { { -INT8_C(  83),      INT8_MAX,  INT8_C(  36), -INT8_C( 119),  INT8_C(  29),  INT8_C(  45), -INT8_C(  27), -INT8_C(  66) },
+        {  INT8_C(  99), -INT8_C(  83),  INT8_C(  62), -INT8_C(  14),      INT8_MAX,  INT8_C(   0),  INT8_C(  61), -INT8_C(  84) },
+        { -INT8_C(   9),  INT8_C(  82),  INT8_C(  18), -INT8_C(  61),  INT8_C(  96),  INT8_C(  36), -INT8_C(  17), -INT8_C( 101) },
+        {  INT8_C(  46),  INT8_C(  46), -INT8_C(  94), -INT8_C( 101), -INT8_C(  35), -INT8_C(  93),  INT8_C(  52),  INT8_C(  63) } } },
+    { { -INT8_C( 124),  INT8_C(  92), -INT8_C(  44), -INT8_C( 122),  INT8_C(  68), -INT8_C(  59),  INT8_C(  82),  INT8_C(  51),
+        -INT8_C( 107),  INT8_C(  91),  INT8_C( 113),  INT8_C(  16), -INT8_C(  88),  INT8_C(  17), -INT8_C(  12),  INT8_C(  74),
+        -INT8_C(  95), -INT8_C(  69), -INT8_C(  21), -INT8_C( 122),  INT8_C(  88),  INT8_C( 119),  INT8_C(  32),  INT8_C(  15),
+        -INT8_C(  55), -INT8_C(  51),  INT8_C(  45), -INT8_C(  14), -INT8_C(  34), -INT8_C(  80), -INT8_C(  38), -INT8_C(   6) },
+      { { -INT8_C( 124),  INT8_C(  92), -INT8_C(  44), -INT8_C( 122),  INT8_C(  68), -INT8_C(  59),  INT8_C(  82),  INT8_C(  51) },
+        { -INT8_C( 107),  INT8_C(  91),  INT8_C( 113),  INT8_C(  16), -INT8_C(  88),  INT8_C(  17), -INT8_C(  12),  INT8_C(  74) },
+        { -INT8_C(  95), -INT8_C(  69), -INT8_C(  21), -INT8_C( 122),  INT8_C(  88),  INT8_C( 119),  INT8_C(  32),  INT8_C(  15) },
+        { -INT8_C(  55), -INT8_C(  51),  INT8_C(  45), -INT8_C(  14), -INT8_C(  34), -INT8_C(  80), -INT8_C(  38), -INT8_C(   6) } } },
+    { { -INT8_C(   3), -INT8_C(  69), -INT8_C(  85),  INT8_C( 106),  INT8_C( 117),  INT8_C(  87), -INT8_C(  29), -INT8_C(   1),
+         INT8_C( 111),  INT8_C(  47), -INT8_C(  48),  INT8_C(  21),  INT8_C(  47), -INT8_C(  29), -INT8_C(  91),  INT8_C(  19),
+        -INT8_C(  71), -INT8_C(  97),  INT8_C(  27),  INT8_C(  92),  INT8_C( 108),  INT8_C( 124),  INT8_C( 102),  INT8_C(  27),
+         INT8_C(   3), -INT8_C(   1),  INT8_C(  84), -INT8_C(  10), -INT8_C(   6), -INT8_C(  28), -INT8_C(  12),  INT8_C(   9) },
+      { { -INT8_C(   3), -INT8_C(  69), -INT8_C(  85),  INT8_C( 106),  INT8_C( 117),  INT8_C(  87), -INT8_C(  29), -INT8_C(   1) },
+        {  INT8_C( 111),  INT8_C(  47), -INT8_C(  48),  INT8_C(  21),  INT8_C(  47), -INT8_C(  29), -INT8_C(  91),  INT8_C(  19) },
+        { -INT8_C(  71), -INT8_C(  97),  INT8_C(  27),  INT8_C(  92),  INT8_C( 108),  INT8_C( 124),  INT8_C( 102),  INT8_C(  27) },
+        {  INT8_C(   3), -INT8_C(   1),  INT8_C(  84), -INT8_C(  10), -INT8_C(   6), -INT8_C(  28), -INT8_C(  12),  INT8_C(   9) } } },
+    { {  INT8_C(  71),  INT8_C(  96),  INT8_C(  67),  INT8_C(  80), -INT8_C( 117), -INT8_C(  31), -INT8_C(  91), -INT8_C( 122),
+        -INT8_C( 120), -INT8_C(  30), -INT8_C( 123),  INT8_C(  48), -INT8_C(  68),  INT8_C(  72), -INT8_C(  17),  INT8_C(  66),
+        -INT8_C(  75), -INT8_C(  44), -INT8_C(  49), -INT8_C(  35), -INT8_C(  88), -INT8_C(  14),  INT8_C( 110), -INT8_C(  88),
+        -INT8_C(  29),  INT8_C(  76), -INT8_C(  18), -INT8_C(  66), -INT8_C(  30),  INT8_C(  24), -INT8_C( 123),  INT8_C( 102) },
+      { {  INT8_C(  71),  INT8_C(  96),  INT8_C(  67),  INT8_C(  80), -INT8_C( 117), -INT8_C(  31), -INT8_C(  91), -INT8_C( 122) },
+        { -INT8_C( 120), -INT8_C(  30), -INT8_C( 123),  INT8_C(  48), -INT8_C(  68),  INT8_C(  72), -INT8_C(  17),  INT8_C(  66) },
+        { -INT8_C(  75), -INT8_C(  44), -INT8_C(  49), -INT8_C(  35), -INT8_C(  88), -INT8_C(  14),  INT8_C( 110), -INT8_C(  88) },
+        { -INT8_C(  29),  INT8_C(  76), -INT8_C(  18), -INT8_C(  66), -INT8_C(  30),  INT8_C(  24), -INT8_C( 123),  INT8_C( 102) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x4_t r = simde_vld1_s8_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[2], simde_vld1_s8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[3], simde_vld1_s8(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a[32];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int8x8x4_t r = simde_vld1_s8_x4(a);
+
+    simde_test_codegen_write_vi8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[16];
+    int16_t r[4][4];
+  } test_vec[] = {
+    { { -INT16_C( 26349), -INT16_C( 18021),  INT16_C( 31867),  INT16_C(  8070),  INT16_C(  8870), -INT16_C( 30166),  INT16_C( 29510),  INT16_C( 32205),
+        -INT16_C( 11197), -INT16_C(  9053),  INT16_C( 12675),  INT16_C( 30541),  INT16_C( 29738),  INT16_C( 15236),  INT16_C( 10413),  INT16_C( 24891) },
+      { { -INT16_C( 26349), -INT16_C( 18021),  INT16_C( 31867),  INT16_C(  8070) },
+        {  INT16_C(  8870), -INT16_C( 30166),  INT16_C( 29510),  INT16_C( 32205) },
+        { -INT16_C( 11197), -INT16_C(  9053),  INT16_C( 12675),  INT16_C( 30541) },
+        {  INT16_C( 29738),  INT16_C( 15236),  INT16_C( 10413),  INT16_C( 24891) } } },
+    { { -INT16_C(  9901), -INT16_C(  9809), -INT16_C( 28186),  INT16_C( 13359),  INT16_C( 18074),  INT16_C( 10584), -INT16_C( 29289),  INT16_C( 25696),
+         INT16_C(  4049),  INT16_C( 30640),  INT16_C( 20089),  INT16_C( 15973),  INT16_C( 25848), -INT16_C(  5469),  INT16_C( 13091), -INT16_C( 10536) },
+      { { -INT16_C(  9901), -INT16_C(  9809), -INT16_C( 28186),  INT16_C( 13359) },
+        {  INT16_C( 18074),  INT16_C( 10584), -INT16_C( 29289),  INT16_C( 25696) },
+        {  INT16_C(  4049),  INT16_C( 30640),  INT16_C( 20089),  INT16_C( 15973) },
+        {  INT16_C( 25848), -INT16_C(  5469),  INT16_C( 13091), -INT16_C( 10536) } } },
+    { {  INT16_C( 26360), -INT16_C( 20915),  INT16_C(  3341),  INT16_C( 24181),  INT16_C( 11878),  INT16_C( 11975), -INT16_C( 23747),  INT16_C(   134),
+        -INT16_C( 23539), -INT16_C(  9121),  INT16_C( 17061),  INT16_C(  3691), -INT16_C( 20314), -INT16_C( 28538),  INT16_C( 18476),  INT16_C( 31330) },
+      { {  INT16_C( 26360), -INT16_C( 20915),  INT16_C(  3341),  INT16_C( 24181) },
+        {  INT16_C( 11878),  INT16_C( 11975), -INT16_C( 23747),  INT16_C(   134) },
+        { -INT16_C( 23539), -INT16_C(  9121),  INT16_C( 17061),  INT16_C(  3691) },
+        { -INT16_C( 20314), -INT16_C( 28538),  INT16_C( 18476),  INT16_C( 31330) } } },
+    { { -INT16_C( 32670),  INT16_C(  9187),  INT16_C( 14278), -INT16_C(  2416),  INT16_C( 14855),  INT16_C( 12727), -INT16_C( 22021), -INT16_C( 16212),
+        -INT16_C( 20485),  INT16_C(  2319),  INT16_C(  2892), -INT16_C(    78), -INT16_C( 12753), -INT16_C(  7763),  INT16_C( 13023), -INT16_C( 20687) },
+      { { -INT16_C( 32670),  INT16_C(  9187),  INT16_C( 14278), -INT16_C(  2416) },
+        {  INT16_C( 14855),  INT16_C( 12727), -INT16_C( 22021), -INT16_C( 16212) },
+        { -INT16_C( 20485),  INT16_C(  2319),  INT16_C(  2892), -INT16_C(    78) },
+        { -INT16_C( 12753), -INT16_C(  7763),  INT16_C( 13023), -INT16_C( 20687) } } },
+    { {  INT16_C(  5172),  INT16_C( 14138),  INT16_C( 10800),  INT16_C( 28376), -INT16_C( 21604), -INT16_C( 24666),  INT16_C( 27349), -INT16_C( 30169),
+         INT16_C( 23315),  INT16_C( 17302),  INT16_C(  3802), -INT16_C( 24679), -INT16_C( 17696),  INT16_C( 23364), -INT16_C(  9432), -INT16_C( 15314) },
+      { {  INT16_C(  5172),  INT16_C( 14138),  INT16_C( 10800),  INT16_C( 28376) },
+        { -INT16_C( 21604), -INT16_C( 24666),  INT16_C( 27349), -INT16_C( 30169) },
+        {  INT16_C( 23315),  INT16_C( 17302),  INT16_C(  3802), -INT16_C( 24679) },
+        { -INT16_C( 17696),  INT16_C( 23364), -INT16_C(  9432), -INT16_C( 15314) } } },
+    { { -INT16_C( 24431), -INT16_C(  7082), -INT16_C(   556),  INT16_C( 30315),  INT16_C(  4083),  INT16_C( 31995), -INT16_C( 24008),  INT16_C( 16571),
+         INT16_C(  9886), -INT16_C( 28518), -INT16_C( 25472), -INT16_C( 22604), -INT16_C(  7661), -INT16_C( 17232), -INT16_C( 18953),  INT16_C( 29249) },
+      { { -INT16_C( 24431), -INT16_C(  7082), -INT16_C(   556),  INT16_C( 30315) },
+        {  INT16_C(  4083),  INT16_C( 31995), -INT16_C( 24008),  INT16_C( 16571) },
+        {  INT16_C(  9886), -INT16_C( 28518), -INT16_C( 25472), -INT16_C( 22604) },
+        { -INT16_C(  7661), -INT16_C( 17232), -INT16_C( 18953),  INT16_C( 29249) } } },
+    { {  INT16_C( 27257), -INT16_C( 27427), -INT16_C( 18329),  INT16_C( 19370),  INT16_C(  4060),  INT16_C( 12885), -INT16_C( 24858),  INT16_C( 12265),
+         INT16_C( 16564), -INT16_C(  1442),  INT16_C( 20550),  INT16_C( 16845), -INT16_C( 17892), -INT16_C( 30161), -INT16_C(  1827), -INT16_C(  2433) },
+      { {  INT16_C( 27257), -INT16_C( 27427), -INT16_C( 18329),  INT16_C( 19370) },
+        {  INT16_C(  4060),  INT16_C( 12885), -INT16_C( 24858),  INT16_C( 12265) },
+        {  INT16_C( 16564), -INT16_C(  1442),  INT16_C( 20550),  INT16_C( 16845) },
+        { -INT16_C( 17892), -INT16_C( 30161), -INT16_C(  1827), -INT16_C(  2433) } } },
+    { {  INT16_C(  8565),  INT16_C(  6487),  INT16_C( 20499),  INT16_C(  6031),  INT16_C( 27055), -INT16_C( 30837),  INT16_C(   443), -INT16_C(    50),
+        -INT16_C( 21562),  INT16_C(   785),  INT16_C(  5060),  INT16_C( 12654), -INT16_C( 14478), -INT16_C( 22986), -INT16_C( 31345),  INT16_C(  3227) },
+      { {  INT16_C(  8565),  INT16_C(  6487),  INT16_C( 20499),  INT16_C(  6031) },
+        {  INT16_C( 27055), -INT16_C( 30837),  INT16_C(   443), -INT16_C(    50) },
+        { -INT16_C( 21562),  INT16_C(   785),  INT16_C(  5060),  INT16_C( 12654) },
+        { -INT16_C( 14478), -INT16_C( 22986), -INT16_C( 31345),  INT16_C(  3227) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x4_t r = simde_vld1_s16_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[2], simde_vld1_s16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[3], simde_vld1_s16(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int16x4x4_t r = simde_vld1_s16_x4(a);
+
+    simde_test_codegen_write_vi16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[8];
+    int32_t r[4][2];
+  } test_vec[] = {
+    { { -INT32_C(  1936643837), -INT32_C(   925898076),  INT32_C(  1061062484), -INT32_C(   295863548),  INT32_C(  2137559053), -INT32_C(   384741912), -INT32_C(  1431790602), -INT32_C(   275264428) },
+      { { -INT32_C(  1936643837), -INT32_C(   925898076) },
+        {  INT32_C(  1061062484), -INT32_C(   295863548) },
+        {  INT32_C(  2137559053), -INT32_C(   384741912) },
+        { -INT32_C(  1431790602), -INT32_C(   275264428) } } },
+    { { -INT32_C(   272576259),  INT32_C(   635094560),  INT32_C(   763000848), -INT32_C(  1497850236),  INT32_C(   823898045), -INT32_C(  1157307407),  INT32_C(  1294228576), -INT32_C(   347268095) },
+      { { -INT32_C(   272576259),  INT32_C(   635094560) },
+        {  INT32_C(   763000848), -INT32_C(  1497850236) },
+        {  INT32_C(   823898045), -INT32_C(  1157307407) },
+        {  INT32_C(  1294228576), -INT32_C(   347268095) } } },
+    { { -INT32_C(    46830514),  INT32_C(  1916868627),  INT32_C(  2004461873),  INT32_C(  1104462942), -INT32_C(  1745204815), -INT32_C(   905183027),  INT32_C(  1735855396), -INT32_C(   506468311) },
+      { { -INT32_C(    46830514),  INT32_C(  1916868627) },
+        {  INT32_C(  2004461873),  INT32_C(  1104462942) },
+        { -INT32_C(  1745204815), -INT32_C(   905183027) },
+        {  INT32_C(  1735855396), -INT32_C(   506468311) } } },
+    { {  INT32_C(  2029351369), -INT32_C(  1746967181), -INT32_C(   545073695), -INT32_C(   789840397),  INT32_C(  1547871717),  INT32_C(  1617119451),  INT32_C(  1621591444), -INT32_C(   914356656) },
+      { {  INT32_C(  2029351369), -INT32_C(  1746967181) },
+        { -INT32_C(   545073695), -INT32_C(   789840397) },
+        {  INT32_C(  1547871717),  INT32_C(  1617119451) },
+        {  INT32_C(  1621591444), -INT32_C(   914356656) } } },
+    { {  INT32_C(  1848489589),  INT32_C(    28896337),  INT32_C(  1988088898),  INT32_C(  1033746846),  INT32_C(  1194854888),  INT32_C(   145212957),  INT32_C(  1933575926),  INT32_C(   130843217) },
+      { {  INT32_C(  1848489589),  INT32_C(    28896337) },
+        {  INT32_C(  1988088898),  INT32_C(  1033746846) },
+        {  INT32_C(  1194854888),  INT32_C(   145212957) },
+        {  INT32_C(  1933575926),  INT32_C(   130843217) } } },
+    { { -INT32_C(  1968778136),  INT32_C(   165321281),  INT32_C(    54591033),  INT32_C(  1585403859), -INT32_C(  1841512351), -INT32_C(   224094208),  INT32_C(    66893929),  INT32_C(  2112769563) },
+      { { -INT32_C(  1968778136),  INT32_C(   165321281) },
+        {  INT32_C(    54591033),  INT32_C(  1585403859) },
+        { -INT32_C(  1841512351), -INT32_C(   224094208) },
+        {  INT32_C(    66893929),  INT32_C(  2112769563) } } },
+    { {  INT32_C(  2071658570), -INT32_C(   374212979),  INT32_C(  1525093621),  INT32_C(  1719162545),  INT32_C(  1267580555),  INT32_C(  1227866003), -INT32_C(  1621320710), -INT32_C(   661595908) },
+      { {  INT32_C(  2071658570), -INT32_C(   374212979) },
+        {  INT32_C(  1525093621),  INT32_C(  1719162545) },
+        {  INT32_C(  1267580555),  INT32_C(  1227866003) },
+        { -INT32_C(  1621320710), -INT32_C(   661595908) } } },
+    { { -INT32_C(  2046485835),  INT32_C(   999846040), -INT32_C(  1602331587), -INT32_C(   956375388),  INT32_C(   306169730), -INT32_C(  2051317539),  INT32_C(   866435702),  INT32_C(   440285499) },
+      { { -INT32_C(  2046485835),  INT32_C(   999846040) },
+        { -INT32_C(  1602331587), -INT32_C(   956375388) },
+        {  INT32_C(   306169730), -INT32_C(  2051317539) },
+        {  INT32_C(   866435702),  INT32_C(   440285499) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x4_t r = simde_vld1_s32_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[2], simde_vld1_s32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[3], simde_vld1_s32(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int32x2x4_t r = simde_vld1_s32_x4(a);
+
+    simde_test_codegen_write_vi32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_s64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[4];
+    int64_t r[4][1];
+  } test_vec[] = {
+    { {  INT64_C(  970321538095139068),  INT64_C(  611402499701225325),  INT64_C( 5683033297295753139),  INT64_C( 3778400960187204968) },
+      { {  INT64_C(  970321538095139068) },
+        {  INT64_C(  611402499701225325) },
+        {  INT64_C( 5683033297295753139) },
+        {  INT64_C( 3778400960187204968) } } },
+    { {  INT64_C( 5276172597689667806),  INT64_C( 6638302360538921167),  INT64_C( 7062811859530948244), -INT64_C( 3986532689379176496) },
+      { {  INT64_C( 5276172597689667806) },
+        {  INT64_C( 6638302360538921167) },
+        {  INT64_C( 7062811859530948244) },
+        { -INT64_C( 3986532689379176496) } } },
+    { {  INT64_C( 4579756467525015383), -INT64_C( 8500904524617222140), -INT64_C( 4600875789456959670), -INT64_C( 8447272980641305064) },
+      { {  INT64_C( 4579756467525015383) },
+        { -INT64_C( 8500904524617222140) },
+        { -INT64_C( 4600875789456959670) },
+        { -INT64_C( 8447272980641305064) } } },
+    { { -INT64_C( 3838968091279890330),  INT64_C( 3671434331755352090),  INT64_C( 1799650440191001955),  INT64_C( 5238057252926173773) },
+      { { -INT64_C( 3838968091279890330) },
+        {  INT64_C( 3671434331755352090) },
+        {  INT64_C( 1799650440191001955) },
+        {  INT64_C( 5238057252926173773) } } },
+    { {  INT64_C( 5283367559778355238),  INT64_C( 5668608799011097376),  INT64_C( 1393004184199263602),  INT64_C( 2863461001815620420) },
+      { {  INT64_C( 5283367559778355238) },
+        {  INT64_C( 5668608799011097376) },
+        {  INT64_C( 1393004184199263602) },
+        {  INT64_C( 2863461001815620420) } } },
+    { {  INT64_C( 2747600309670229062),  INT64_C( 7669242644013000106),  INT64_C( 2026991081697215433), -INT64_C( 4731422711914100668) },
+      { {  INT64_C( 2747600309670229062) },
+        {  INT64_C( 7669242644013000106) },
+        {  INT64_C( 2026991081697215433) },
+        { -INT64_C( 4731422711914100668) } } },
+    { { -INT64_C( 8916201812000003895),  INT64_C( 2092361688506606681), -INT64_C( 2678138845224399947), -INT64_C( 7126466276467316087) },
+      { { -INT64_C( 8916201812000003895) },
+        {  INT64_C( 2092361688506606681) },
+        { -INT64_C( 2678138845224399947) },
+        { -INT64_C( 7126466276467316087) } } },
+    { { -INT64_C( 5402759744576222726), -INT64_C( 1003282320663157719), -INT64_C( 4701312180753742529), -INT64_C( 2279637826776850652) },
+      { { -INT64_C( 5402759744576222726) },
+        { -INT64_C( 1003282320663157719) },
+        { -INT64_C( 4701312180753742529) },
+        { -INT64_C( 2279637826776850652) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x4_t r = simde_vld1_s64_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[2], simde_vld1_s64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[3], simde_vld1_s64(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a[4];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int64x1x4_t r = simde_vld1_s64_x4(a);
+
+    simde_test_codegen_write_vi64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[32];
+    uint8_t r[4][8];
+  } test_vec[] = {
+    { { UINT8_C(112), UINT8_C(166), UINT8_C(132), UINT8_C( 51), UINT8_C(103), UINT8_C( 13), UINT8_C( 57), UINT8_C( 62),
+        UINT8_C( 68), UINT8_C(  8), UINT8_C(210), UINT8_C(101), UINT8_C(224), UINT8_C(188), UINT8_C( 85), UINT8_C(197),
+        UINT8_C(131), UINT8_C(  1), UINT8_C( 11), UINT8_C( 85), UINT8_C( 49), UINT8_C(148), UINT8_C(127), UINT8_C( 65),
+        UINT8_C(202), UINT8_C(114), UINT8_C(124), UINT8_C( 26), UINT8_C(142), UINT8_C(186), UINT8_C(  0), UINT8_C(  1) },
+      { { UINT8_C(112), UINT8_C(166), UINT8_C(132), UINT8_C( 51), UINT8_C(103), UINT8_C( 13), UINT8_C( 57), UINT8_C( 62) },
+        { UINT8_C( 68), UINT8_C(  8), UINT8_C(210), UINT8_C(101), UINT8_C(224), UINT8_C(188), UINT8_C( 85), UINT8_C(197) },
+        { UINT8_C(131), UINT8_C(  1), UINT8_C( 11), UINT8_C( 85), UINT8_C( 49), UINT8_C(148), UINT8_C(127), UINT8_C( 65) },
+        { UINT8_C(202), UINT8_C(114), UINT8_C(124), UINT8_C( 26), UINT8_C(142), UINT8_C(186), UINT8_C(  0), UINT8_C(  1) } } },
+    { { UINT8_C(223), UINT8_C(234), UINT8_C( 94), UINT8_C(120), UINT8_C(103), UINT8_C( 14), UINT8_C(130), UINT8_C(220),
+        UINT8_C(104), UINT8_C(238), UINT8_C( 45), UINT8_C(142), UINT8_C(143), UINT8_C(218), UINT8_C( 48), UINT8_C(153),
+        UINT8_C( 98), UINT8_C( 49), UINT8_C(207), UINT8_C(  5), UINT8_C(204), UINT8_C(160), UINT8_C(238), UINT8_C(  2),
+        UINT8_C(147), UINT8_C(132), UINT8_C(122), UINT8_C(185), UINT8_C(  9), UINT8_C( 47), UINT8_C(226), UINT8_C(220) },
+      { { UINT8_C(223), UINT8_C(234), UINT8_C( 94), UINT8_C(120), UINT8_C(103), UINT8_C( 14), UINT8_C(130), UINT8_C(220) },
+        { UINT8_C(104), UINT8_C(238), UINT8_C( 45), UINT8_C(142), UINT8_C(143), UINT8_C(218), UINT8_C( 48), UINT8_C(153) },
+        { UINT8_C( 98), UINT8_C( 49), UINT8_C(207), UINT8_C(  5), UINT8_C(204), UINT8_C(160), UINT8_C(238), UINT8_C(  2) },
+        { UINT8_C(147), UINT8_C(132), UINT8_C(122), UINT8_C(185), UINT8_C(  9), UINT8_C( 47), UINT8_C(226), UINT8_C(220) } } },
+    { { UINT8_C(200), UINT8_C(197), UINT8_C(247), UINT8_C( 63), UINT8_C(107), UINT8_C(182), UINT8_C(108), UINT8_C(  6),
+        UINT8_C(231), UINT8_C(188), UINT8_C( 80), UINT8_C( 29), UINT8_C( 27), UINT8_C(183), UINT8_C( 78), UINT8_C(187),
+        UINT8_C( 64), UINT8_C(135), UINT8_C(186), UINT8_C(148), UINT8_C(239), UINT8_C( 76), UINT8_C( 23), UINT8_C( 90),
+        UINT8_C(225), UINT8_C(236), UINT8_C(  5), UINT8_C(217), UINT8_C(239), UINT8_C( 58), UINT8_C(226), UINT8_C(193) },
+      { { UINT8_C(200), UINT8_C(197), UINT8_C(247), UINT8_C( 63), UINT8_C(107), UINT8_C(182), UINT8_C(108), UINT8_C(  6) },
+        { UINT8_C(231), UINT8_C(188), UINT8_C( 80), UINT8_C( 29), UINT8_C( 27), UINT8_C(183), UINT8_C( 78), UINT8_C(187) },
+        { UINT8_C( 64), UINT8_C(135), UINT8_C(186), UINT8_C(148), UINT8_C(239), UINT8_C( 76), UINT8_C( 23), UINT8_C( 90) },
+        { UINT8_C(225), UINT8_C(236), UINT8_C(  5), UINT8_C(217), UINT8_C(239), UINT8_C( 58), UINT8_C(226), UINT8_C(193) } } },
+    { { UINT8_C( 68), UINT8_C(177), UINT8_C( 97), UINT8_C(152), UINT8_C(147), UINT8_C( 72), UINT8_C(206), UINT8_C(254),
+        UINT8_C(218), UINT8_C(167), UINT8_C( 88), UINT8_C(173), UINT8_C(101), UINT8_C(249), UINT8_C(197), UINT8_C( 61),
+        UINT8_C(130), UINT8_C(157), UINT8_C(  5), UINT8_C( 32), UINT8_C(169), UINT8_C( 17), UINT8_C( 28), UINT8_C( 72),
+        UINT8_C(132), UINT8_C(102), UINT8_C( 91),    UINT8_MAX, UINT8_C(105), UINT8_C( 95), UINT8_C( 24), UINT8_C(208) },
+      { { UINT8_C( 68), UINT8_C(177), UINT8_C( 97), UINT8_C(152), UINT8_C(147), UINT8_C( 72), UINT8_C(206), UINT8_C(254) },
+        { UINT8_C(218), UINT8_C(167), UINT8_C( 88), UINT8_C(173), UINT8_C(101), UINT8_C(249), UINT8_C(197), UINT8_C( 61) },
+        { UINT8_C(130), UINT8_C(157), UINT8_C(  5), UINT8_C( 32), UINT8_C(169), UINT8_C( 17), UINT8_C( 28), UINT8_C( 72) },
+        { UINT8_C(132), UINT8_C(102), UINT8_C( 91),    UINT8_MAX, UINT8_C(105), UINT8_C( 95), UINT8_C( 24), UINT8_C(208) } } },
+    { { UINT8_C( 10), UINT8_C(225), UINT8_C( 14), UINT8_C(118), UINT8_C(243), UINT8_C(172), UINT8_C(149), UINT8_C(246),
+        UINT8_C(180), UINT8_C(123), UINT8_C( 90), UINT8_C( 83), UINT8_C(208), UINT8_C( 39), UINT8_C(231), UINT8_C( 44),
+        UINT8_C( 35), UINT8_C( 65), UINT8_C(231), UINT8_C(240), UINT8_C( 52), UINT8_C(244), UINT8_C(110), UINT8_C(164),
+        UINT8_C(234), UINT8_C(169), UINT8_C(215), UINT8_C( 89), UINT8_C( 48), UINT8_C(  3), UINT8_C(126), UINT8_C( 11) },
+      { { UINT8_C( 10), UINT8_C(225), UINT8_C( 14), UINT8_C(118), UINT8_C(243), UINT8_C(172), UINT8_C(149), UINT8_C(246) },
+        { UINT8_C(180), UINT8_C(123), UINT8_C( 90), UINT8_C( 83), UINT8_C(208), UINT8_C( 39), UINT8_C(231), UINT8_C( 44) },
+        { UINT8_C( 35), UINT8_C( 65), UINT8_C(231), UINT8_C(240), UINT8_C( 52), UINT8_C(244), UINT8_C(110), UINT8_C(164) },
+        { UINT8_C(234), UINT8_C(169), UINT8_C(215), UINT8_C( 89), UINT8_C( 48), UINT8_C(  3), UINT8_C(126), UINT8_C( 11) } } },
+    { { UINT8_C( 28), UINT8_C( 84), UINT8_C(118), UINT8_C( 28), UINT8_C( 81), UINT8_C( 76), UINT8_C(184), UINT8_C(205),
+        UINT8_C(237), UINT8_C(100), UINT8_C(146), UINT8_C(  0), UINT8_C(201), UINT8_C(249), UINT8_C(252), UINT8_C(137),
+        UINT8_C( 40), UINT8_C( 92), UINT8_C( 25), UINT8_C(196), UINT8_C( 79), UINT8_C(118), UINT8_C( 87), UINT8_C(128),
+        UINT8_C(235), UINT8_C( 67), UINT8_C(228), UINT8_C(161), UINT8_C(  3), UINT8_C( 40), UINT8_C(222), UINT8_C(127) },
+      { { UINT8_C( 28), UINT8_C( 84), UINT8_C(118), UINT8_C( 28), UINT8_C( 81), UINT8_C( 76), UINT8_C(184), UINT8_C(205) },
+        { UINT8_C(237), UINT8_C(100), UINT8_C(146), UINT8_C(  0), UINT8_C(201), UINT8_C(249), UINT8_C(252), UINT8_C(137) },
+        { UINT8_C( 40), UINT8_C( 92), UINT8_C( 25), UINT8_C(196), UINT8_C( 79), UINT8_C(118), UINT8_C( 87), UINT8_C(128) },
+        { UINT8_C(235), UINT8_C( 67), UINT8_C(228), UINT8_C(161), UINT8_C(  3), UINT8_C( 40), UINT8_C(222), UINT8_C(127) } } },
+    { { UINT8_C(119), UINT8_C(219), UINT8_C(224), UINT8_C( 87), UINT8_C(195), UINT8_C(203), UINT8_C(121), UINT8_C(248),
+        UINT8_C( 53), UINT8_C(126), UINT8_C( 77), UINT8_C(102), UINT8_C(114), UINT8_C(  7), UINT8_C(193), UINT8_C(177),
+        UINT8_C(168), UINT8_C(  2), UINT8_C(157), UINT8_C( 67), UINT8_C(107), UINT8_C( 25), UINT8_C( 35), UINT8_C(238),
+        UINT8_C( 92), UINT8_C(164), UINT8_C(111), UINT8_C(  4), UINT8_C( 58), UINT8_C( 29), UINT8_C(154), UINT8_C(165) },
+      { { UINT8_C(119), UINT8_C(219), UINT8_C(224), UINT8_C( 87), UINT8_C(195), UINT8_C(203), UINT8_C(121), UINT8_C(248) },
+        { UINT8_C( 53), UINT8_C(126), UINT8_C( 77), UINT8_C(102), UINT8_C(114), UINT8_C(  7), UINT8_C(193), UINT8_C(177) },
+        { UINT8_C(168), UINT8_C(  2), UINT8_C(157), UINT8_C( 67), UINT8_C(107), UINT8_C( 25), UINT8_C( 35), UINT8_C(238) },
+        { UINT8_C( 92), UINT8_C(164), UINT8_C(111), UINT8_C(  4), UINT8_C( 58), UINT8_C( 29), UINT8_C(154), UINT8_C(165) } } },
+    { { UINT8_C(161), UINT8_C(158), UINT8_C(156), UINT8_C( 88), UINT8_C( 19), UINT8_C(173), UINT8_C( 16), UINT8_C( 88),
+        UINT8_C(216), UINT8_C(234), UINT8_C(124), UINT8_C(138), UINT8_C(250), UINT8_C(222), UINT8_C(163), UINT8_C( 70),
+        UINT8_C(188), UINT8_C(211), UINT8_C( 16), UINT8_C(171), UINT8_C( 36), UINT8_C( 16), UINT8_C(173), UINT8_C( 10),
+        UINT8_C( 51), UINT8_C(135), UINT8_C(184), UINT8_C(150), UINT8_C( 42), UINT8_C( 25), UINT8_C( 11), UINT8_C(135) },
+      { { UINT8_C(161), UINT8_C(158), UINT8_C(156), UINT8_C( 88), UINT8_C( 19), UINT8_C(173), UINT8_C( 16), UINT8_C( 88) },
+        { UINT8_C(216), UINT8_C(234), UINT8_C(124), UINT8_C(138), UINT8_C(250), UINT8_C(222), UINT8_C(163), UINT8_C( 70) },
+        { UINT8_C(188), UINT8_C(211), UINT8_C( 16), UINT8_C(171), UINT8_C( 36), UINT8_C( 16), UINT8_C(173), UINT8_C( 10) },
+        { UINT8_C( 51), UINT8_C(135), UINT8_C(184), UINT8_C(150), UINT8_C( 42), UINT8_C( 25), UINT8_C( 11), UINT8_C(135) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x4_t r = simde_vld1_u8_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[2], simde_vld1_u8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[3], simde_vld1_u8(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[32];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x8x4_t r = simde_vld1_u8_x4(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[16];
+    uint16_t r[4][4];
+  } test_vec[] = {
+    { { UINT16_C(17551), UINT16_C(34521), UINT16_C(26095), UINT16_C(19230), UINT16_C(23640), UINT16_C(24225), UINT16_C( 7568), UINT16_C(38888),
+        UINT16_C( 4313), UINT16_C(62489), UINT16_C(51926), UINT16_C(21484), UINT16_C(12910), UINT16_C(16284), UINT16_C(52434), UINT16_C(39079) },
+      { { UINT16_C(17551), UINT16_C(34521), UINT16_C(26095), UINT16_C(19230) },
+        { UINT16_C(23640), UINT16_C(24225), UINT16_C( 7568), UINT16_C(38888) },
+        { UINT16_C( 4313), UINT16_C(62489), UINT16_C(51926), UINT16_C(21484) },
+        { UINT16_C(12910), UINT16_C(16284), UINT16_C(52434), UINT16_C(39079) } } },
+    { { UINT16_C(30847), UINT16_C(14127), UINT16_C(59570), UINT16_C(44200), UINT16_C(50397), UINT16_C( 9319), UINT16_C(39030), UINT16_C(27750),
+        UINT16_C(11965), UINT16_C(25024), UINT16_C(27694), UINT16_C(64454), UINT16_C(38540), UINT16_C(53815), UINT16_C( 6309), UINT16_C(56529) },
+      { { UINT16_C(30847), UINT16_C(14127), UINT16_C(59570), UINT16_C(44200) },
+        { UINT16_C(50397), UINT16_C( 9319), UINT16_C(39030), UINT16_C(27750) },
+        { UINT16_C(11965), UINT16_C(25024), UINT16_C(27694), UINT16_C(64454) },
+        { UINT16_C(38540), UINT16_C(53815), UINT16_C( 6309), UINT16_C(56529) } } },
+    { { UINT16_C( 2279), UINT16_C(13745), UINT16_C(10207), UINT16_C(25144), UINT16_C(35254), UINT16_C( 4597), UINT16_C(18414), UINT16_C(15388),
+        UINT16_C( 5328), UINT16_C(57238), UINT16_C(42316), UINT16_C( 4586), UINT16_C(52420), UINT16_C(42131), UINT16_C(42850), UINT16_C(47579) },
+      { { UINT16_C( 2279), UINT16_C(13745), UINT16_C(10207), UINT16_C(25144) },
+        { UINT16_C(35254), UINT16_C( 4597), UINT16_C(18414), UINT16_C(15388) },
+        { UINT16_C( 5328), UINT16_C(57238), UINT16_C(42316), UINT16_C( 4586) },
+        { UINT16_C(52420), UINT16_C(42131), UINT16_C(42850), UINT16_C(47579) } } },
+    { { UINT16_C(40467), UINT16_C(12296), UINT16_C(44197), UINT16_C(33523), UINT16_C(49105), UINT16_C(47480), UINT16_C(52500), UINT16_C(60581),
+        UINT16_C( 8395), UINT16_C(21782), UINT16_C(15802), UINT16_C(33419), UINT16_C( 7538), UINT16_C(26720), UINT16_C(35287), UINT16_C(45954) },
+      { { UINT16_C(40467), UINT16_C(12296), UINT16_C(44197), UINT16_C(33523) },
+        { UINT16_C(49105), UINT16_C(47480), UINT16_C(52500), UINT16_C(60581) },
+        { UINT16_C( 8395), UINT16_C(21782), UINT16_C(15802), UINT16_C(33419) },
+        { UINT16_C( 7538), UINT16_C(26720), UINT16_C(35287), UINT16_C(45954) } } },
+    { { UINT16_C(32162), UINT16_C( 4968), UINT16_C(45061), UINT16_C(47054), UINT16_C(20439), UINT16_C( 5263), UINT16_C(43689), UINT16_C(55943),
+        UINT16_C(59593), UINT16_C( 6844), UINT16_C(23822), UINT16_C(10149), UINT16_C(22557), UINT16_C(38509), UINT16_C( 3208), UINT16_C( 8560) },
+      { { UINT16_C(32162), UINT16_C( 4968), UINT16_C(45061), UINT16_C(47054) },
+        { UINT16_C(20439), UINT16_C( 5263), UINT16_C(43689), UINT16_C(55943) },
+        { UINT16_C(59593), UINT16_C( 6844), UINT16_C(23822), UINT16_C(10149) },
+        { UINT16_C(22557), UINT16_C(38509), UINT16_C( 3208), UINT16_C( 8560) } } },
+    { { UINT16_C( 3200), UINT16_C(28853), UINT16_C( 6628), UINT16_C(37325), UINT16_C(49963), UINT16_C(22528), UINT16_C( 2262), UINT16_C( 1169),
+        UINT16_C( 6234), UINT16_C(44639), UINT16_C(20591), UINT16_C(41733), UINT16_C(43648), UINT16_C(19997), UINT16_C(23805), UINT16_C(47819) },
+      { { UINT16_C( 3200), UINT16_C(28853), UINT16_C( 6628), UINT16_C(37325) },
+        { UINT16_C(49963), UINT16_C(22528), UINT16_C( 2262), UINT16_C( 1169) },
+        { UINT16_C( 6234), UINT16_C(44639), UINT16_C(20591), UINT16_C(41733) },
+        { UINT16_C(43648), UINT16_C(19997), UINT16_C(23805), UINT16_C(47819) } } },
+    { { UINT16_C(11383), UINT16_C(10703), UINT16_C(12600), UINT16_C(62723), UINT16_C(16448), UINT16_C(63662), UINT16_C(48076), UINT16_C(31171),
+        UINT16_C(41075), UINT16_C(19428), UINT16_C(17536), UINT16_C(41189), UINT16_C(41100), UINT16_C(44608), UINT16_C(42155), UINT16_C(14110) },
+      { { UINT16_C(11383), UINT16_C(10703), UINT16_C(12600), UINT16_C(62723) },
+        { UINT16_C(16448), UINT16_C(63662), UINT16_C(48076), UINT16_C(31171) },
+        { UINT16_C(41075), UINT16_C(19428), UINT16_C(17536), UINT16_C(41189) },
+        { UINT16_C(41100), UINT16_C(44608), UINT16_C(42155), UINT16_C(14110) } } },
+    { { UINT16_C(44135), UINT16_C(23429), UINT16_C(38020), UINT16_C(65386), UINT16_C(10089), UINT16_C(33835), UINT16_C(59252), UINT16_C(31216),
+        UINT16_C(31728), UINT16_C(44564), UINT16_C(50470), UINT16_C(55301), UINT16_C(31079), UINT16_C(11852), UINT16_C(25721), UINT16_C(10035) },
+      { { UINT16_C(44135), UINT16_C(23429), UINT16_C(38020), UINT16_C(65386) },
+        { UINT16_C(10089), UINT16_C(33835), UINT16_C(59252), UINT16_C(31216) },
+        { UINT16_C(31728), UINT16_C(44564), UINT16_C(50470), UINT16_C(55301) },
+        { UINT16_C(31079), UINT16_C(11852), UINT16_C(25721), UINT16_C(10035) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x4_t r = simde_vld1_u16_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[2], simde_vld1_u16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[3], simde_vld1_u16(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint16x4x4_t r = simde_vld1_u16_x4(a);
+
+    simde_test_codegen_write_vu16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[8];
+    uint32_t r[4][2];
+  } test_vec[] = {
+    { { UINT32_C( 477416357), UINT32_C(2009458243), UINT32_C(3499835749), UINT32_C(1826658934), UINT32_C(2359492449), UINT32_C(1683514783), UINT32_C(1539483975), UINT32_C(2605427951) },
+      { { UINT32_C( 477416357), UINT32_C(2009458243) },
+        { UINT32_C(3499835749), UINT32_C(1826658934) },
+        { UINT32_C(2359492449), UINT32_C(1683514783) },
+        { UINT32_C(1539483975), UINT32_C(2605427951) } } },
+    { { UINT32_C( 680379007), UINT32_C(1645533950), UINT32_C(1793536384), UINT32_C( 202373177), UINT32_C(2913650548), UINT32_C(1383036744), UINT32_C( 580921221), UINT32_C(3650365231) },
+      { { UINT32_C( 680379007), UINT32_C(1645533950) },
+        { UINT32_C(1793536384), UINT32_C( 202373177) },
+        { UINT32_C(2913650548), UINT32_C(1383036744) },
+        { UINT32_C( 580921221), UINT32_C(3650365231) } } },
+    { { UINT32_C(   6462357), UINT32_C(4025345257), UINT32_C(3434011503), UINT32_C(1231681820), UINT32_C(4010340438), UINT32_C(2128038626), UINT32_C(3873140594), UINT32_C( 153555844) },
+      { { UINT32_C(   6462357), UINT32_C(4025345257) },
+        { UINT32_C(3434011503), UINT32_C(1231681820) },
+        { UINT32_C(4010340438), UINT32_C(2128038626) },
+        { UINT32_C(3873140594), UINT32_C( 153555844) } } },
+    { { UINT32_C( 161393473), UINT32_C(1141792652), UINT32_C(2641690242), UINT32_C(1898068188), UINT32_C( 252133736), UINT32_C(1398899432), UINT32_C( 727915506), UINT32_C(1371869286) },
+      { { UINT32_C( 161393473), UINT32_C(1141792652) },
+        { UINT32_C(2641690242), UINT32_C(1898068188) },
+        { UINT32_C( 252133736), UINT32_C(1398899432) },
+        { UINT32_C( 727915506), UINT32_C(1371869286) } } },
+    { { UINT32_C(3472453316), UINT32_C(2033217279), UINT32_C(2413332864), UINT32_C(2627779436), UINT32_C(2388755374), UINT32_C(1968462590), UINT32_C(1971961723), UINT32_C(3355631608) },
+      { { UINT32_C(3472453316), UINT32_C(2033217279) },
+        { UINT32_C(2413332864), UINT32_C(2627779436) },
+        { UINT32_C(2388755374), UINT32_C(1968462590) },
+        { UINT32_C(1971961723), UINT32_C(3355631608) } } },
+    { { UINT32_C(1748263959), UINT32_C(4091517117), UINT32_C( 473442984), UINT32_C(3720668621), UINT32_C( 651994831), UINT32_C(2399732696), UINT32_C(3486486795), UINT32_C(1569363001) },
+      { { UINT32_C(1748263959), UINT32_C(4091517117) },
+        { UINT32_C( 473442984), UINT32_C(3720668621) },
+        { UINT32_C( 651994831), UINT32_C(2399732696) },
+        { UINT32_C(3486486795), UINT32_C(1569363001) } } },
+    { { UINT32_C(3144094153), UINT32_C(4162556005), UINT32_C( 786900992), UINT32_C(  21793542), UINT32_C(3073818948), UINT32_C(2276512045), UINT32_C(1525540426), UINT32_C( 542427627) },
+      { { UINT32_C(3144094153), UINT32_C(4162556005) },
+        { UINT32_C( 786900992), UINT32_C(  21793542) },
+        { UINT32_C(3073818948), UINT32_C(2276512045) },
+        { UINT32_C(1525540426), UINT32_C( 542427627) } } },
+    { { UINT32_C(3270810672), UINT32_C(2532703028), UINT32_C(1832148594), UINT32_C(3939400565), UINT32_C(1126544377), UINT32_C(3157131923), UINT32_C(4200723738), UINT32_C( 452949959) },
+      { { UINT32_C(3270810672), UINT32_C(2532703028) },
+        { UINT32_C(1832148594), UINT32_C(3939400565) },
+        { UINT32_C(1126544377), UINT32_C(3157131923) },
+        { UINT32_C(4200723738), UINT32_C( 452949959) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x4_t r = simde_vld1_u32_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[2], simde_vld1_u32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[3], simde_vld1_u32(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x2x4_t r = simde_vld1_u32_x4(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1_u64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[4];
+    uint64_t r[4][1];
+  } test_vec[] = {
+    { { UINT64_C( 1320322543239645702), UINT64_C(11574016685526105880), UINT64_C( 4021929163720054128), UINT64_C( 6441995785323845588) },
+      { { UINT64_C( 1320322543239645702) },
+        { UINT64_C(11574016685526105880) },
+        { UINT64_C( 4021929163720054128) },
+        { UINT64_C( 6441995785323845588) } } },
+    { { UINT64_C( 4376302675552885686), UINT64_C(14861549495506650243), UINT64_C(10121816666722088885), UINT64_C(  715723515876846734) },
+      { { UINT64_C( 4376302675552885686) },
+        { UINT64_C(14861549495506650243) },
+        { UINT64_C(10121816666722088885) },
+        { UINT64_C(  715723515876846734) } } },
+    { { UINT64_C(11736258608633750968), UINT64_C( 6675880728360419403), UINT64_C(12961600102216433649), UINT64_C( 7279879850887164064) },
+      { { UINT64_C(11736258608633750968) },
+        { UINT64_C( 6675880728360419403) },
+        { UINT64_C(12961600102216433649) },
+        { UINT64_C( 7279879850887164064) } } },
+    { { UINT64_C(16761167408752518263), UINT64_C(14060533428659977974), UINT64_C(16156032536366715798), UINT64_C(10353017128493973513) },
+      { { UINT64_C(16761167408752518263) },
+        { UINT64_C(14060533428659977974) },
+        { UINT64_C(16156032536366715798) },
+        { UINT64_C(10353017128493973513) } } },
+    { { UINT64_C(15321129755637129027), UINT64_C( 3377707067486264381), UINT64_C(14352757049006966198), UINT64_C(13772413884278663486) },
+      { { UINT64_C(15321129755637129027) },
+        { UINT64_C( 3377707067486264381) },
+        { UINT64_C(14352757049006966198) },
+        { UINT64_C(13772413884278663486) } } },
+    { { UINT64_C(13694479988279361636), UINT64_C( 6102359610399280254), UINT64_C(12095090445671705681), UINT64_C(17543057741858821331) },
+      { { UINT64_C(13694479988279361636) },
+        { UINT64_C( 6102359610399280254) },
+        { UINT64_C(12095090445671705681) },
+        { UINT64_C(17543057741858821331) } } },
+    { { UINT64_C( 4331558614703325617), UINT64_C(16898831140761818828), UINT64_C(11151814628287791997), UINT64_C( 7028185700821852212) },
+      { { UINT64_C( 4331558614703325617) },
+        { UINT64_C(16898831140761818828) },
+        { UINT64_C(11151814628287791997) },
+        { UINT64_C( 7028185700821852212) } } },
+    { { UINT64_C( 5874155657346494862), UINT64_C(13978065469560734718), UINT64_C(18284115449352538272), UINT64_C( 2720592610226631825) },
+      { { UINT64_C( 5874155657346494862) },
+        { UINT64_C(13978065469560734718) },
+        { UINT64_C(18284115449352538272) },
+        { UINT64_C( 2720592610226631825) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x4_t r = simde_vld1_u64_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[2], simde_vld1_u64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[3], simde_vld1_u64(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[4];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x1x4_t r = simde_vld1_u64_x4(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_f32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[16];
+    simde_float32 r[4][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -360.10), SIMDE_FLOAT32_C(  -559.70), SIMDE_FLOAT32_C(  -836.22), SIMDE_FLOAT32_C(  -728.86),
+        SIMDE_FLOAT32_C(    76.04), SIMDE_FLOAT32_C(   835.56), SIMDE_FLOAT32_C(   123.30), SIMDE_FLOAT32_C(   993.59),
+        SIMDE_FLOAT32_C(   454.12), SIMDE_FLOAT32_C(  -600.80), SIMDE_FLOAT32_C(   796.08), SIMDE_FLOAT32_C(  -247.64),
+        SIMDE_FLOAT32_C(  -820.62), SIMDE_FLOAT32_C(   902.98), SIMDE_FLOAT32_C(   -76.02), SIMDE_FLOAT32_C(   855.32) },
+      { { SIMDE_FLOAT32_C(  -360.10), SIMDE_FLOAT32_C(  -559.70), SIMDE_FLOAT32_C(  -836.22), SIMDE_FLOAT32_C(  -728.86) },
+        { SIMDE_FLOAT32_C(    76.04), SIMDE_FLOAT32_C(   835.56), SIMDE_FLOAT32_C(   123.30), SIMDE_FLOAT32_C(   993.59) },
+        { SIMDE_FLOAT32_C(   454.12), SIMDE_FLOAT32_C(  -600.80), SIMDE_FLOAT32_C(   796.08), SIMDE_FLOAT32_C(  -247.64) },
+        { SIMDE_FLOAT32_C(  -820.62), SIMDE_FLOAT32_C(   902.98), SIMDE_FLOAT32_C(   -76.02), SIMDE_FLOAT32_C(   855.32) } } },
+    { { SIMDE_FLOAT32_C(  -646.55), SIMDE_FLOAT32_C(   706.38), SIMDE_FLOAT32_C(  -481.16), SIMDE_FLOAT32_C(  -269.53),
+        SIMDE_FLOAT32_C(  -191.31), SIMDE_FLOAT32_C(   332.34), SIMDE_FLOAT32_C(   988.95), SIMDE_FLOAT32_C(  -327.95),
+        SIMDE_FLOAT32_C(   400.96), SIMDE_FLOAT32_C(   356.25), SIMDE_FLOAT32_C(  -132.62), SIMDE_FLOAT32_C(   913.67),
+        SIMDE_FLOAT32_C(  -289.61), SIMDE_FLOAT32_C(  -889.86), SIMDE_FLOAT32_C(    58.75), SIMDE_FLOAT32_C(  -247.28) },
+      { { SIMDE_FLOAT32_C(  -646.55), SIMDE_FLOAT32_C(   706.38), SIMDE_FLOAT32_C(  -481.16), SIMDE_FLOAT32_C(  -269.53) },
+        { SIMDE_FLOAT32_C(  -191.31), SIMDE_FLOAT32_C(   332.34), SIMDE_FLOAT32_C(   988.95), SIMDE_FLOAT32_C(  -327.95) },
+        { SIMDE_FLOAT32_C(   400.96), SIMDE_FLOAT32_C(   356.25), SIMDE_FLOAT32_C(  -132.62), SIMDE_FLOAT32_C(   913.67) },
+        { SIMDE_FLOAT32_C(  -289.61), SIMDE_FLOAT32_C(  -889.86), SIMDE_FLOAT32_C(    58.75), SIMDE_FLOAT32_C(  -247.28) } } },
+    { { SIMDE_FLOAT32_C(   630.95), SIMDE_FLOAT32_C(  -233.66), SIMDE_FLOAT32_C(  -246.82), SIMDE_FLOAT32_C(  -373.74),
+        SIMDE_FLOAT32_C(  -686.17), SIMDE_FLOAT32_C(   776.47), SIMDE_FLOAT32_C(   574.38), SIMDE_FLOAT32_C(    24.64),
+        SIMDE_FLOAT32_C(  -793.95), SIMDE_FLOAT32_C(   378.81), SIMDE_FLOAT32_C(  -531.15), SIMDE_FLOAT32_C(  -519.78),
+        SIMDE_FLOAT32_C(  -459.65), SIMDE_FLOAT32_C(    28.98), SIMDE_FLOAT32_C(  -281.65), SIMDE_FLOAT32_C(  -350.04) },
+      { { SIMDE_FLOAT32_C(   630.95), SIMDE_FLOAT32_C(  -233.66), SIMDE_FLOAT32_C(  -246.82), SIMDE_FLOAT32_C(  -373.74) },
+        { SIMDE_FLOAT32_C(  -686.17), SIMDE_FLOAT32_C(   776.47), SIMDE_FLOAT32_C(   574.38), SIMDE_FLOAT32_C(    24.64) },
+        { SIMDE_FLOAT32_C(  -793.95), SIMDE_FLOAT32_C(   378.81), SIMDE_FLOAT32_C(  -531.15), SIMDE_FLOAT32_C(  -519.78) },
+        { SIMDE_FLOAT32_C(  -459.65), SIMDE_FLOAT32_C(    28.98), SIMDE_FLOAT32_C(  -281.65), SIMDE_FLOAT32_C(  -350.04) } } },
+    { { SIMDE_FLOAT32_C(   405.02), SIMDE_FLOAT32_C(   981.70), SIMDE_FLOAT32_C(  -307.54), SIMDE_FLOAT32_C(  -772.09),
+        SIMDE_FLOAT32_C(  -600.68), SIMDE_FLOAT32_C(  -889.94), SIMDE_FLOAT32_C(  -986.51), SIMDE_FLOAT32_C(   -70.31),
+        SIMDE_FLOAT32_C(   354.52), SIMDE_FLOAT32_C(   893.84), SIMDE_FLOAT32_C(  -424.95), SIMDE_FLOAT32_C(   187.49),
+        SIMDE_FLOAT32_C(   835.05), SIMDE_FLOAT32_C(   461.34), SIMDE_FLOAT32_C(   235.19), SIMDE_FLOAT32_C(   855.63) },
+      { { SIMDE_FLOAT32_C(   405.02), SIMDE_FLOAT32_C(   981.70), SIMDE_FLOAT32_C(  -307.54), SIMDE_FLOAT32_C(  -772.09) },
+        { SIMDE_FLOAT32_C(  -600.68), SIMDE_FLOAT32_C(  -889.94), SIMDE_FLOAT32_C(  -986.51), SIMDE_FLOAT32_C(   -70.31) },
+        { SIMDE_FLOAT32_C(   354.52), SIMDE_FLOAT32_C(   893.84), SIMDE_FLOAT32_C(  -424.95), SIMDE_FLOAT32_C(   187.49) },
+        { SIMDE_FLOAT32_C(   835.05), SIMDE_FLOAT32_C(   461.34), SIMDE_FLOAT32_C(   235.19), SIMDE_FLOAT32_C(   855.63) } } },
+    { { SIMDE_FLOAT32_C(    56.32), SIMDE_FLOAT32_C(  -620.53), SIMDE_FLOAT32_C(   237.64), SIMDE_FLOAT32_C(   660.99),
+        SIMDE_FLOAT32_C(   304.41), SIMDE_FLOAT32_C(   556.73), SIMDE_FLOAT32_C(   277.33), SIMDE_FLOAT32_C(  -158.04),
+        SIMDE_FLOAT32_C(  -763.79), SIMDE_FLOAT32_C(   154.80), SIMDE_FLOAT32_C(   352.30), SIMDE_FLOAT32_C(   350.87),
+        SIMDE_FLOAT32_C(   552.53), SIMDE_FLOAT32_C(   534.07), SIMDE_FLOAT32_C(   178.99), SIMDE_FLOAT32_C(   658.63) },
+      { { SIMDE_FLOAT32_C(    56.32), SIMDE_FLOAT32_C(  -620.53), SIMDE_FLOAT32_C(   237.64), SIMDE_FLOAT32_C(   660.99) },
+        { SIMDE_FLOAT32_C(   304.41), SIMDE_FLOAT32_C(   556.73), SIMDE_FLOAT32_C(   277.33), SIMDE_FLOAT32_C(  -158.04) },
+        { SIMDE_FLOAT32_C(  -763.79), SIMDE_FLOAT32_C(   154.80), SIMDE_FLOAT32_C(   352.30), SIMDE_FLOAT32_C(   350.87) },
+        { SIMDE_FLOAT32_C(   552.53), SIMDE_FLOAT32_C(   534.07), SIMDE_FLOAT32_C(   178.99), SIMDE_FLOAT32_C(   658.63) } } },
+    { { SIMDE_FLOAT32_C(    69.34), SIMDE_FLOAT32_C(    85.34), SIMDE_FLOAT32_C(   531.15), SIMDE_FLOAT32_C(   550.41),
+        SIMDE_FLOAT32_C(   957.99), SIMDE_FLOAT32_C(   430.41), SIMDE_FLOAT32_C(   236.28), SIMDE_FLOAT32_C(   857.48),
+        SIMDE_FLOAT32_C(  -724.75), SIMDE_FLOAT32_C(   300.15), SIMDE_FLOAT32_C(  -607.05), SIMDE_FLOAT32_C(  -380.52),
+        SIMDE_FLOAT32_C(   -28.48), SIMDE_FLOAT32_C(   281.68), SIMDE_FLOAT32_C(  -219.10), SIMDE_FLOAT32_C(   239.94) },
+      { { SIMDE_FLOAT32_C(    69.34), SIMDE_FLOAT32_C(    85.34), SIMDE_FLOAT32_C(   531.15), SIMDE_FLOAT32_C(   550.41) },
+        { SIMDE_FLOAT32_C(   957.99), SIMDE_FLOAT32_C(   430.41), SIMDE_FLOAT32_C(   236.28), SIMDE_FLOAT32_C(   857.48) },
+        { SIMDE_FLOAT32_C(  -724.75), SIMDE_FLOAT32_C(   300.15), SIMDE_FLOAT32_C(  -607.05), SIMDE_FLOAT32_C(  -380.52) },
+        { SIMDE_FLOAT32_C(   -28.48), SIMDE_FLOAT32_C(   281.68), SIMDE_FLOAT32_C(  -219.10), SIMDE_FLOAT32_C(   239.94) } } },
+    { { SIMDE_FLOAT32_C(  -108.71), SIMDE_FLOAT32_C(  -560.37), SIMDE_FLOAT32_C(  -780.96), SIMDE_FLOAT32_C(  -601.42),
+        SIMDE_FLOAT32_C(  -254.72), SIMDE_FLOAT32_C(   179.58), SIMDE_FLOAT32_C(  -376.11), SIMDE_FLOAT32_C(  -161.69),
+        SIMDE_FLOAT32_C(   623.46), SIMDE_FLOAT32_C(  -274.75), SIMDE_FLOAT32_C(  -671.01), SIMDE_FLOAT32_C(  -120.76),
+        SIMDE_FLOAT32_C(   620.30), SIMDE_FLOAT32_C(  -840.24), SIMDE_FLOAT32_C(  -566.53), SIMDE_FLOAT32_C(   866.65) },
+      { { SIMDE_FLOAT32_C(  -108.71), SIMDE_FLOAT32_C(  -560.37), SIMDE_FLOAT32_C(  -780.96), SIMDE_FLOAT32_C(  -601.42) },
+        { SIMDE_FLOAT32_C(  -254.72), SIMDE_FLOAT32_C(   179.58), SIMDE_FLOAT32_C(  -376.11), SIMDE_FLOAT32_C(  -161.69) },
+        { SIMDE_FLOAT32_C(   623.46), SIMDE_FLOAT32_C(  -274.75), SIMDE_FLOAT32_C(  -671.01), SIMDE_FLOAT32_C(  -120.76) },
+        { SIMDE_FLOAT32_C(   620.30), SIMDE_FLOAT32_C(  -840.24), SIMDE_FLOAT32_C(  -566.53), SIMDE_FLOAT32_C(   866.65) } } },
+    { { SIMDE_FLOAT32_C(   -80.19), SIMDE_FLOAT32_C(   374.24), SIMDE_FLOAT32_C(  -680.16), SIMDE_FLOAT32_C(  -106.01),
+        SIMDE_FLOAT32_C(  -406.86), SIMDE_FLOAT32_C(   749.07), SIMDE_FLOAT32_C(   632.68), SIMDE_FLOAT32_C(   175.34),
+        SIMDE_FLOAT32_C(  -380.25), SIMDE_FLOAT32_C(   693.46), SIMDE_FLOAT32_C(  -145.52), SIMDE_FLOAT32_C(   620.81),
+        SIMDE_FLOAT32_C(    18.45), SIMDE_FLOAT32_C(  -684.31), SIMDE_FLOAT32_C(   640.23), SIMDE_FLOAT32_C(  -433.09) },
+      { { SIMDE_FLOAT32_C(   -80.19), SIMDE_FLOAT32_C(   374.24), SIMDE_FLOAT32_C(  -680.16), SIMDE_FLOAT32_C(  -106.01) },
+        { SIMDE_FLOAT32_C(  -406.86), SIMDE_FLOAT32_C(   749.07), SIMDE_FLOAT32_C(   632.68), SIMDE_FLOAT32_C(   175.34) },
+        { SIMDE_FLOAT32_C(  -380.25), SIMDE_FLOAT32_C(   693.46), SIMDE_FLOAT32_C(  -145.52), SIMDE_FLOAT32_C(   620.81) },
+        { SIMDE_FLOAT32_C(    18.45), SIMDE_FLOAT32_C(  -684.31), SIMDE_FLOAT32_C(   640.23), SIMDE_FLOAT32_C(  -433.09) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x4_t r = simde_vld1q_f32_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[2], simde_vld1q_f32(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[3], simde_vld1q_f32(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a[16];
+    simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, -1000.0f, 1000.0f);
+    simde_float32x4x4_t r = simde_vld1q_f32_x4(a);
+
+    simde_test_codegen_write_vf32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_f64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[8];
+    simde_float64 r[4][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -720.57), SIMDE_FLOAT64_C(  -792.58), SIMDE_FLOAT64_C(   -71.53), SIMDE_FLOAT64_C(  -441.18),
+        SIMDE_FLOAT64_C(  -904.94), SIMDE_FLOAT64_C(  -628.44), SIMDE_FLOAT64_C(  -939.01), SIMDE_FLOAT64_C(    59.32) },
+      { { SIMDE_FLOAT64_C(  -720.57), SIMDE_FLOAT64_C(  -792.58) },
+        { SIMDE_FLOAT64_C(   -71.53), SIMDE_FLOAT64_C(  -441.18) },
+        { SIMDE_FLOAT64_C(  -904.94), SIMDE_FLOAT64_C(  -628.44) },
+        { SIMDE_FLOAT64_C(  -939.01), SIMDE_FLOAT64_C(    59.32) } } },
+    { { SIMDE_FLOAT64_C(  -375.60), SIMDE_FLOAT64_C(   792.43), SIMDE_FLOAT64_C(   749.58), SIMDE_FLOAT64_C(  -354.35),
+        SIMDE_FLOAT64_C(  -928.02), SIMDE_FLOAT64_C(   704.98), SIMDE_FLOAT64_C(  -944.21), SIMDE_FLOAT64_C(  -243.72) },
+      { { SIMDE_FLOAT64_C(  -375.60), SIMDE_FLOAT64_C(   792.43) },
+        { SIMDE_FLOAT64_C(   749.58), SIMDE_FLOAT64_C(  -354.35) },
+        { SIMDE_FLOAT64_C(  -928.02), SIMDE_FLOAT64_C(   704.98) },
+        { SIMDE_FLOAT64_C(  -944.21), SIMDE_FLOAT64_C(  -243.72) } } },
+    { { SIMDE_FLOAT64_C(  -846.52), SIMDE_FLOAT64_C(    24.07), SIMDE_FLOAT64_C(  -135.88), SIMDE_FLOAT64_C(     3.65),
+        SIMDE_FLOAT64_C(   601.68), SIMDE_FLOAT64_C(   635.68), SIMDE_FLOAT64_C(  -191.38), SIMDE_FLOAT64_C(  -315.27) },
+      { { SIMDE_FLOAT64_C(  -846.52), SIMDE_FLOAT64_C(    24.07) },
+        { SIMDE_FLOAT64_C(  -135.88), SIMDE_FLOAT64_C(     3.65) },
+        { SIMDE_FLOAT64_C(   601.68), SIMDE_FLOAT64_C(   635.68) },
+        { SIMDE_FLOAT64_C(  -191.38), SIMDE_FLOAT64_C(  -315.27) } } },
+    { { SIMDE_FLOAT64_C(    -7.58), SIMDE_FLOAT64_C(   867.91), SIMDE_FLOAT64_C(  -490.93), SIMDE_FLOAT64_C(  -259.39),
+        SIMDE_FLOAT64_C(  -400.07), SIMDE_FLOAT64_C(  -902.22), SIMDE_FLOAT64_C(    14.36), SIMDE_FLOAT64_C(   234.00) },
+      { { SIMDE_FLOAT64_C(    -7.58), SIMDE_FLOAT64_C(   867.91) },
+        { SIMDE_FLOAT64_C(  -490.93), SIMDE_FLOAT64_C(  -259.39) },
+        { SIMDE_FLOAT64_C(  -400.07), SIMDE_FLOAT64_C(  -902.22) },
+        { SIMDE_FLOAT64_C(    14.36), SIMDE_FLOAT64_C(   234.00) } } },
+    { { SIMDE_FLOAT64_C(   856.29), SIMDE_FLOAT64_C(   781.89), SIMDE_FLOAT64_C(   257.57), SIMDE_FLOAT64_C(   848.18),
+        SIMDE_FLOAT64_C(   -99.13), SIMDE_FLOAT64_C(  -738.15), SIMDE_FLOAT64_C(   619.19), SIMDE_FLOAT64_C(  -446.68) },
+      { { SIMDE_FLOAT64_C(   856.29), SIMDE_FLOAT64_C(   781.89) },
+        { SIMDE_FLOAT64_C(   257.57), SIMDE_FLOAT64_C(   848.18) },
+        { SIMDE_FLOAT64_C(   -99.13), SIMDE_FLOAT64_C(  -738.15) },
+        { SIMDE_FLOAT64_C(   619.19), SIMDE_FLOAT64_C(  -446.68) } } },
+    { { SIMDE_FLOAT64_C(  -131.49), SIMDE_FLOAT64_C(  -512.88), SIMDE_FLOAT64_C(   518.00), SIMDE_FLOAT64_C(  -461.77),
+        SIMDE_FLOAT64_C(   744.31), SIMDE_FLOAT64_C(   977.42), SIMDE_FLOAT64_C(  -890.18), SIMDE_FLOAT64_C(  -116.40) },
+      { { SIMDE_FLOAT64_C(  -131.49), SIMDE_FLOAT64_C(  -512.88) },
+        { SIMDE_FLOAT64_C(   518.00), SIMDE_FLOAT64_C(  -461.77) },
+        { SIMDE_FLOAT64_C(   744.31), SIMDE_FLOAT64_C(   977.42) },
+        { SIMDE_FLOAT64_C(  -890.18), SIMDE_FLOAT64_C(  -116.40) } } },
+    { { SIMDE_FLOAT64_C(   864.64), SIMDE_FLOAT64_C(  -894.14), SIMDE_FLOAT64_C(   913.36), SIMDE_FLOAT64_C(   -15.43),
+        SIMDE_FLOAT64_C(  -991.27), SIMDE_FLOAT64_C(  -892.61), SIMDE_FLOAT64_C(   146.15), SIMDE_FLOAT64_C(   990.46) },
+      { { SIMDE_FLOAT64_C(   864.64), SIMDE_FLOAT64_C(  -894.14) },
+        { SIMDE_FLOAT64_C(   913.36), SIMDE_FLOAT64_C(   -15.43) },
+        { SIMDE_FLOAT64_C(  -991.27), SIMDE_FLOAT64_C(  -892.61) },
+        { SIMDE_FLOAT64_C(   146.15), SIMDE_FLOAT64_C(   990.46) } } },
+    { { SIMDE_FLOAT64_C(    17.90), SIMDE_FLOAT64_C(   627.42), SIMDE_FLOAT64_C(   424.11), SIMDE_FLOAT64_C(  -791.48),
+        SIMDE_FLOAT64_C(   345.56), SIMDE_FLOAT64_C(   305.65), SIMDE_FLOAT64_C(  -141.77), SIMDE_FLOAT64_C(     0.69) },
+      { { SIMDE_FLOAT64_C(    17.90), SIMDE_FLOAT64_C(   627.42) },
+        { SIMDE_FLOAT64_C(   424.11), SIMDE_FLOAT64_C(  -791.48) },
+        { SIMDE_FLOAT64_C(   345.56), SIMDE_FLOAT64_C(   305.65) },
+        { SIMDE_FLOAT64_C(  -141.77), SIMDE_FLOAT64_C(     0.69) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x4_t r = simde_vld1q_f64_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[2], simde_vld1q_f64(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[3], simde_vld1q_f64(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a[8];
+    simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, -1000.0, 1000.0);
+    simde_float64x2x4_t r = simde_vld1q_f64_x4(a);
+
+    simde_test_codegen_write_vf64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[64];
+    int8_t r[4][16];
+  } test_vec[] = {
+    { { -INT8_C(  23),  INT8_C(  74), -INT8_C(  21), -INT8_C( 112),  INT8_C(  55),  INT8_C(  99), -INT8_C(  64), -INT8_C(  59),
+         INT8_C(  94), -INT8_C( 113), -INT8_C(  39),  INT8_C(  80),  INT8_C(  39), -INT8_C( 125), -INT8_C(  61),  INT8_C(  20),
+        -INT8_C(  87),  INT8_C(  44),  INT8_C(  48), -INT8_C( 106),  INT8_C(  13),  INT8_C(  86),  INT8_C(  38), -INT8_C( 124),
+         INT8_C(  81), -INT8_C(  28),  INT8_C(  27), -INT8_C(  74), -INT8_C( 110), -INT8_C(  85), -INT8_C(   3),  INT8_C(  15),
+        -INT8_C(  99), -INT8_C(  85), -INT8_C(  83), -INT8_C(  53),  INT8_C( 104), -INT8_C( 102),  INT8_C(  71),  INT8_C(  68),
+        -INT8_C(  95),  INT8_C(  23), -INT8_C(  29), -INT8_C(  97), -INT8_C(  65), -INT8_C( 113), -INT8_C(  95), -INT8_C(   4),
+         INT8_C(  16),  INT8_C(  74), -INT8_C(  23),  INT8_C(  56),  INT8_C(  52),  INT8_C( 103), -INT8_C( 106), -INT8_C(   6),
+        -INT8_C(  96), -INT8_C(  73),  INT8_C(   2),  INT8_C(  75), -INT8_C(  85),  INT8_C(  29), -INT8_C(  52), -INT8_C( 100) },
+      { { -INT8_C(  23),  INT8_C(  74), -INT8_C(  21), -INT8_C( 112),  INT8_C(  55),  INT8_C(  99), -INT8_C(  64), -INT8_C(  59),
+           INT8_C(  94), -INT8_C( 113), -INT8_C(  39),  INT8_C(  80),  INT8_C(  39), -INT8_C( 125), -INT8_C(  61),  INT8_C(  20) },
+        { -INT8_C(  87),  INT8_C(  44),  INT8_C(  48), -INT8_C( 106),  INT8_C(  13),  INT8_C(  86),  INT8_C(  38), -INT8_C( 124),
+           INT8_C(  81), -INT8_C(  28),  INT8_C(  27), -INT8_C(  74), -INT8_C( 110), -INT8_C(  85), -INT8_C(   3),  INT8_C(  15) },
+        { -INT8_C(  99), -INT8_C(  85), -INT8_C(  83), -INT8_C(  53),  INT8_C( 104), -INT8_C( 102),  INT8_C(  71),  INT8_C(  68),
+          -INT8_C(  95),  INT8_C(  23), -INT8_C(  29), -INT8_C(  97), -INT8_C(  65), -INT8_C( 113), -INT8_C(  95), -INT8_C(   4) },
+        {  INT8_C(  16),  INT8_C(  74), -INT8_C(  23),  INT8_C(  56),  INT8_C(  52),  INT8_C( 103), -INT8_C( 106), -INT8_C(   6),
+          -INT8_C(  96), -INT8_C(  73),  INT8_C(   2),  INT8_C(  75), -INT8_C(  85),  INT8_C(  29), -INT8_C(  52), -INT8_C( 100) } } },
+    { {  INT8_C(  83),  INT8_C( 112),  INT8_C(  56), -INT8_C(  31),  INT8_C( 106),  INT8_C(  90),  INT8_C( 118), -INT8_C(  54),
+        -INT8_C(  37), -INT8_C( 112),  INT8_C(  76),  INT8_C( 107), -INT8_C(  59),  INT8_C( 122), -INT8_C(   4),  INT8_C(  45),
+        -INT8_C(  44),  INT8_C(  44),  INT8_C(  31),  INT8_C(  71), -INT8_C(  38), -INT8_C(  58), -INT8_C(  12), -INT8_C(  21),
+         INT8_C(  22), -INT8_C( 123),  INT8_C(  68),  INT8_C(  39),  INT8_C(  37),  INT8_C(   5),  INT8_C( 100),  INT8_C( 113),
+        -INT8_C( 127), -INT8_C(  99),      INT8_MAX, -INT8_C(  65),  INT8_C( 126), -INT8_C( 107),  INT8_C(  87), -INT8_C(  47),
+        -INT8_C( 102), -INT8_C(  10), -INT8_C(  36), -INT8_C( 119),  INT8_C(  39), -INT8_C(  31), -INT8_C( 107),  INT8_C(  98),
+         INT8_C(  15),  INT8_C(  97), -INT8_C(  25),  INT8_C(  23),  INT8_C( 124), -INT8_C(  25),  INT8_C(  88), -INT8_C(  20),
+         INT8_C(  47), -INT8_C(  92),  INT8_C( 110),  INT8_C(  61),  INT8_C(  44),  INT8_C(  33),  INT8_C(  61),  INT8_C(  33) },
+      { {  INT8_C(  83),  INT8_C( 112),  INT8_C(  56), -INT8_C(  31),  INT8_C( 106),  INT8_C(  90),  INT8_C( 118), -INT8_C(  54),
+          -INT8_C(  37), -INT8_C( 112),  INT8_C(  76),  INT8_C( 107), -INT8_C(  59),  INT8_C( 122), -INT8_C(   4),  INT8_C(  45) },
+        { -INT8_C(  44),  INT8_C(  44),  INT8_C(  31),  INT8_C(  71), -INT8_C(  38), -INT8_C(  58), -INT8_C(  12), -INT8_C(  21),
+           INT8_C(  22), -INT8_C( 123),  INT8_C(  68),  INT8_C(  39),  INT8_C(  37),  INT8_C(   5),  INT8_C( 100),  INT8_C( 113) },
+        { -INT8_C( 127), -INT8_C(  99),      INT8_MAX, -INT8_C(  65),  INT8_C( 126), -INT8_C( 107),  INT8_C(  87), -INT8_C(  47),
+          -INT8_C( 102), -INT8_C(  10), -INT8_C(  36), -INT8_C( 119),  INT8_C(  39), -INT8_C(  31), -INT8_C( 107),  INT8_C(  98) },
+        {  INT8_C(  15),  INT8_C(  97), -INT8_C(  25),  INT8_C(  23),  INT8_C( 124), -INT8_C(  25),  INT8_C(  88), -INT8_C(  20),
+           INT8_C(  47), -INT8_C(  92),  INT8_C( 110),  INT8_C(  61),  INT8_C(  44),  INT8_C(  33),  INT8_C(  61),  INT8_C(  33) } } },
+    { {  INT8_C(  35), -INT8_C(  82),  INT8_C(  66),  INT8_C(   5),  INT8_C(  76), -INT8_C(  88),  INT8_C( 116), -INT8_C(  68),
+        -INT8_C(  93),  INT8_C( 119),  INT8_C(  52), -INT8_C(  56), -INT8_C(  24),  INT8_C(  15),  INT8_C(  62),  INT8_C( 104),
+         INT8_C( 117),  INT8_C(   3),  INT8_C(  31), -INT8_C(  34),  INT8_C(  92),  INT8_C( 102), -INT8_C( 121),  INT8_C(  22),
+         INT8_C(  90),  INT8_C( 105), -INT8_C(  74),  INT8_C( 108), -INT8_C( 111),  INT8_C(  45), -INT8_C(  62),  INT8_C(  36),
+         INT8_C(   8),  INT8_C(  28), -INT8_C( 114), -INT8_C(  63),  INT8_C(  50), -INT8_C(  26), -INT8_C(  77),  INT8_C(  76),
+         INT8_C(  90),  INT8_C(  84), -INT8_C(  33), -INT8_C(   1),  INT8_C(  85),  INT8_C(  23), -INT8_C(  24),  INT8_C( 113),
+         INT8_C(  61),  INT8_C( 113), -INT8_C(  61),  INT8_C(  27),  INT8_C(   8),  INT8_C( 122), -INT8_C( 105),  INT8_C(   8),
+         INT8_C(  98), -INT8_C(   9), -INT8_C(   8),  INT8_C(  10), -INT8_C(  65),  INT8_C( 107),  INT8_C(  52), -INT8_C(   9) },
+      { {  INT8_C(  35), -INT8_C(  82),  INT8_C(  66),  INT8_C(   5),  INT8_C(  76), -INT8_C(  88),  INT8_C( 116), -INT8_C(  68),
+          -INT8_C(  93),  INT8_C( 119),  INT8_C(  52), -INT8_C(  56), -INT8_C(  24),  INT8_C(  15),  INT8_C(  62),  INT8_C( 104) },
+        {  INT8_C( 117),  INT8_C(   3),  INT8_C(  31), -INT8_C(  34),  INT8_C(  92),  INT8_C( 102), -INT8_C( 121),  INT8_C(  22),
+           INT8_C(  90),  INT8_C( 105), -INT8_C(  74),  INT8_C( 108), -INT8_C( 111),  INT8_C(  45), -INT8_C(  62),  INT8_C(  36) },
+        {  INT8_C(   8),  INT8_C(  28), -INT8_C( 114), -INT8_C(  63),  INT8_C(  50), -INT8_C(  26), -INT8_C(  77),  INT8_C(  76),
+           INT8_C(  90),  INT8_C(  84), -INT8_C(  33), -INT8_C(   1),  INT8_C(  85),  INT8_C(  23), -INT8_C(  24),  INT8_C( 113) },
+        {  INT8_C(  61),  INT8_C( 113), -INT8_C(  61),  INT8_C(  27),  INT8_C(   8),  INT8_C( 122), -INT8_C( 105),  INT8_C(   8),
+           INT8_C(  98), -INT8_C(   9), -INT8_C(   8),  INT8_C(  10), -INT8_C(  65),  INT8_C( 107),  INT8_C(  52), -INT8_C(   9) } } },
+    { { -INT8_C(  80), -INT8_C( 100), -INT8_C(  60), -INT8_C( 114),  INT8_C( 121),  INT8_C(  91),  INT8_C(   0),  INT8_C( 109),
+         INT8_C(  97), -INT8_C(  14), -INT8_C(  28), -INT8_C(  29),  INT8_C(  62), -INT8_C(   1),  INT8_C( 115),  INT8_C(  53),
+         INT8_C(  34),  INT8_C(   4), -INT8_C( 125),  INT8_C(  51), -INT8_C( 102), -INT8_C( 121), -INT8_C(  70),  INT8_C(  86),
+        -INT8_C(  16), -INT8_C(  41),  INT8_C(  63), -INT8_C(  18),  INT8_C(  15),  INT8_C(  77),  INT8_C(  13), -INT8_C(  33),
+         INT8_C(  81),  INT8_C(  86), -INT8_C( 116), -INT8_C(  50), -INT8_C(  79),  INT8_C( 102), -INT8_C(  48),  INT8_C(  99),
+         INT8_C(  94), -INT8_C(  43), -INT8_C(   2),  INT8_C(  84), -INT8_C(  95),  INT8_C( 101), -INT8_C(  74),  INT8_C(  80),
+        -INT8_C(  39), -INT8_C( 121),  INT8_C(  58), -INT8_C( 117),  INT8_C(   8), -INT8_C(  43), -INT8_C(  33), -INT8_C(  29),
+        -INT8_C(  76), -INT8_C(  99), -INT8_C(  81), -INT8_C(  11),  INT8_C(  53), -INT8_C(   4),  INT8_C(  84), -INT8_C(  68) },
+      { { -INT8_C(  80), -INT8_C( 100), -INT8_C(  60), -INT8_C( 114),  INT8_C( 121),  INT8_C(  91),  INT8_C(   0),  INT8_C( 109),
+           INT8_C(  97), -INT8_C(  14), -INT8_C(  28), -INT8_C(  29),  INT8_C(  62), -INT8_C(   1),  INT8_C( 115),  INT8_C(  53) },
+        {  INT8_C(  34),  INT8_C(   4), -INT8_C( 125),  INT8_C(  51), -INT8_C( 102), -INT8_C( 121), -INT8_C(  70),  INT8_C(  86),
+          -INT8_C(  16), -INT8_C(  41),  INT8_C(  63), -INT8_C(  18),  INT8_C(  15),  INT8_C(  77),  INT8_C(  13), -INT8_C(  33) },
+        {  INT8_C(  81),  INT8_C(  86), -INT8_C( 116), -INT8_C(  50), -INT8_C(  79),  INT8_C( 102), -INT8_C(  48),  INT8_C(  99),
+           INT8_C(  94), -INT8_C(  43), -INT8_C(   2),  INT8_C(  84), -INT8_C(  95),  INT8_C( 101), -INT8_C(  74),  INT8_C(  80) },
+        { -INT8_C(  39), -INT8_C( 121),  INT8_C(  58), -INT8_C( 117),  INT8_C(   8), -INT8_C(  43), -INT8_C(  33), -INT8_C(  29),
+          -INT8_C(  76), -INT8_C(  99), -INT8_C(  81), -INT8_C(  11),  INT8_C(  53), -INT8_C(   4),  INT8_C(  84), -INT8_C(  68) } } },
+    { {  INT8_C(  68), -INT8_C(  41), -INT8_C(  15), -INT8_C(  77),  INT8_C(  20),  INT8_C(  12),  INT8_C(  28), -INT8_C(  10),
+        -INT8_C(  24), -INT8_C( 113),  INT8_C(  61),  INT8_C(  23),  INT8_C(  53), -INT8_C(  40), -INT8_C(  25),  INT8_C(  42),
+         INT8_C(  29),  INT8_C(  22),  INT8_C(   2),  INT8_C(  32),  INT8_C(  13),  INT8_C(  75),  INT8_C( 122), -INT8_C( 115),
+        -INT8_C(  65), -INT8_C(  45),  INT8_C(  41),  INT8_C(  49),  INT8_C(  10), -INT8_C(  85),  INT8_C(  91), -INT8_C(  33),
+        -INT8_C(  19),  INT8_C( 124), -INT8_C(  43), -INT8_C(  95),  INT8_C(  20), -INT8_C( 104),  INT8_C( 109),  INT8_C(  37),
+        -INT8_C(   3),  INT8_C( 105), -INT8_C(  96),  INT8_C( 108), -INT8_C(  25),  INT8_C( 105),  INT8_C(   2), -INT8_C(  43),
+         INT8_C( 109), -INT8_C(  78),  INT8_C(  50),  INT8_C(  26), -INT8_C(   8), -INT8_C(  96),  INT8_C(  20),  INT8_C(  41),
+         INT8_C(  27),  INT8_C(  76),  INT8_C(  85), -INT8_C( 114), -INT8_C(  55),  INT8_C(  98), -INT8_C(  60), -INT8_C(  15) },
+      { {  INT8_C(  68), -INT8_C(  41), -INT8_C(  15), -INT8_C(  77),  INT8_C(  20),  INT8_C(  12),  INT8_C(  28), -INT8_C(  10),
+          -INT8_C(  24), -INT8_C( 113),  INT8_C(  61),  INT8_C(  23),  INT8_C(  53), -INT8_C(  40), -INT8_C(  25),  INT8_C(  42) },
+        {  INT8_C(  29),  INT8_C(  22),  INT8_C(   2),  INT8_C(  32),  INT8_C(  13),  INT8_C(  75),  INT8_C( 122), -INT8_C( 115),
+          -INT8_C(  65), -INT8_C(  45),  INT8_C(  41),  INT8_C(  49),  INT8_C(  10), -INT8_C(  85),  INT8_C(  91), -INT8_C(  33) },
+        { -INT8_C(  19),  INT8_C( 124), -INT8_C(  43), -INT8_C(  95),  INT8_C(  20), -INT8_C( 104),  INT8_C( 109),  INT8_C(  37),
+          -INT8_C(   3),  INT8_C( 105), -INT8_C(  96),  INT8_C( 108), -INT8_C(  25),  INT8_C( 105),  INT8_C(   2), -INT8_C(  43) },
+        {  INT8_C( 109), -INT8_C(  78),  INT8_C(  50),  INT8_C(  26), -INT8_C(   8), -INT8_C(  96),  INT8_C(  20),  INT8_C(  41),
+           INT8_C(  27),  INT8_C(  76),  INT8_C(  85), -INT8_C( 114), -INT8_C(  55),  INT8_C(  98), -INT8_C(  60), -INT8_C(  15) } } },
+    { {  INT8_C(  33),  INT8_C(  42), -INT8_C( 107),  INT8_C(   2), -INT8_C(  35),  INT8_C( 107),  INT8_C(  41),  INT8_C(  97),
+         INT8_C( 110), -INT8_C( 102), -INT8_C(  42),  INT8_C(  74),  INT8_C(  59),  INT8_C(  48), -INT8_C(   9),  INT8_C(  90),
+        -INT8_C(  80), -INT8_C(  99),  INT8_C( 121), -INT8_C(  89), -INT8_C( 107),  INT8_C(  91),  INT8_C(  59), -INT8_C(  74),
+        -INT8_C(  93),  INT8_C(   0), -INT8_C(  25),  INT8_C(  86), -INT8_C(   9), -INT8_C(  56),  INT8_C(  50),  INT8_C( 118),
+         INT8_C(  45),  INT8_C(   9), -INT8_C(   6),  INT8_C(  24), -INT8_C(  92),  INT8_C( 111), -INT8_C(  59),  INT8_C(  72),
+         INT8_C(   8),  INT8_C(  67),  INT8_C( 102),  INT8_C(   5),  INT8_C( 105),  INT8_C( 122),  INT8_C( 101), -INT8_C(  76),
+         INT8_C(   1),  INT8_C( 121),  INT8_C(   1), -INT8_C(  34),  INT8_C( 110), -INT8_C(  26), -INT8_C(   7), -INT8_C( 105),
+        -INT8_C(   9), -INT8_C(  74), -INT8_C(   5), -INT8_C(  98), -INT8_C(  87),  INT8_C(  22),  INT8_C(  17), -INT8_C(  50) },
+      { {  INT8_C(  33),  INT8_C(  42), -INT8_C( 107),  INT8_C(   2), -INT8_C(  35),  INT8_C( 107),  INT8_C(  41),  INT8_C(  97),
+           INT8_C( 110), -INT8_C( 102), -INT8_C(  42),  INT8_C(  74),  INT8_C(  59),  INT8_C(  48), -INT8_C(   9),  INT8_C(  90) },
+        { -INT8_C(  80), -INT8_C(  99),  INT8_C( 121), -INT8_C(  89), -INT8_C( 107),  INT8_C(  91),  INT8_C(  59), -INT8_C(  74),
+          -INT8_C(  93),  INT8_C(   0), -INT8_C(  25),  INT8_C(  86), -INT8_C(   9), -INT8_C(  56),  INT8_C(  50),  INT8_C( 118) },
+        {  INT8_C(  45),  INT8_C(   9), -INT8_C(   6),  INT8_C(  24), -INT8_C(  92),  INT8_C( 111), -INT8_C(  59),  INT8_C(  72),
+           INT8_C(   8),  INT8_C(  67),  INT8_C( 102),  INT8_C(   5),  INT8_C( 105),  INT8_C( 122),  INT8_C( 101), -INT8_C(  76) },
+        {  INT8_C(   1),  INT8_C( 121),  INT8_C(   1), -INT8_C(  34),  INT8_C( 110), -INT8_C(  26), -INT8_C(   7), -INT8_C( 105),
+          -INT8_C(   9), -INT8_C(  74), -INT8_C(   5), -INT8_C(  98), -INT8_C(  87),  INT8_C(  22),  INT8_C(  17), -INT8_C(  50) } } },
+    { { -INT8_C( 117),  INT8_C(  76), -INT8_C( 115), -INT8_C(  26), -INT8_C(  93), -INT8_C(  98), -INT8_C( 116), -INT8_C(  81),
+        -INT8_C(   8), -INT8_C( 121), -INT8_C(  65), -INT8_C(  25), -INT8_C( 107), -INT8_C( 122),      INT8_MAX,  INT8_C(  30),
+             INT8_MAX,  INT8_C(  82), -INT8_C(  23), -INT8_C(  30),  INT8_C(  91), -INT8_C( 116), -INT8_C(  31),  INT8_C(  91),
+         INT8_C(  87), -INT8_C( 113), -INT8_C(   2), -INT8_C(  81), -INT8_C(  62),  INT8_C(  25), -INT8_C(  60),  INT8_C( 115),
+        -INT8_C(  98),  INT8_C(   7), -INT8_C( 120), -INT8_C(  35), -INT8_C( 107),  INT8_C( 120),  INT8_C( 117), -INT8_C( 104),
+         INT8_C(  55), -INT8_C(  32), -INT8_C(  13), -INT8_C( 124),  INT8_C(  26), -INT8_C(  34),  INT8_C(  56),  INT8_C(  41),
+        -INT8_C( 102), -INT8_C(  28), -INT8_C(  59),  INT8_C(  82),  INT8_C(  84), -INT8_C(  94), -INT8_C(  13),  INT8_C(  61),
+         INT8_C( 112),  INT8_C(  27), -INT8_C( 119),  INT8_C( 110),  INT8_C(  62), -INT8_C(  69), -INT8_C(  49), -INT8_C(  42) },
+      { { -INT8_C( 117),  INT8_C(  76), -INT8_C( 115), -INT8_C(  26), -INT8_C(  93), -INT8_C(  98), -INT8_C( 116), -INT8_C(  81),
+          -INT8_C(   8), -INT8_C( 121), -INT8_C(  65), -INT8_C(  25), -INT8_C( 107), -INT8_C( 122),      INT8_MAX,  INT8_C(  30) },
+        {      INT8_MAX,  INT8_C(  82), -INT8_C(  23), -INT8_C(  30),  INT8_C(  91), -INT8_C( 116), -INT8_C(  31),  INT8_C(  91),
+           INT8_C(  87), -INT8_C( 113), -INT8_C(   2), -INT8_C(  81), -INT8_C(  62),  INT8_C(  25), -INT8_C(  60),  INT8_C( 115) },
+        { -INT8_C(  98),  INT8_C(   7), -INT8_C( 120), -INT8_C(  35), -INT8_C( 107),  INT8_C( 120),  INT8_C( 117), -INT8_C( 104),
+           INT8_C(  55), -INT8_C(  32), -INT8_C(  13), -INT8_C( 124),  INT8_C(  26), -INT8_C(  34),  INT8_C(  56),  INT8_C(  41) },
+        { -INT8_C( 102), -INT8_C(  28), -INT8_C(  59),  INT8_C(  82),  INT8_C(  84), -INT8_C(  94), -INT8_C(  13),  INT8_C(  61),
+           INT8_C( 112),  INT8_C(  27), -INT8_C( 119),  INT8_C( 110),  INT8_C(  62), -INT8_C(  69), -INT8_C(  49), -INT8_C(  42) } } },
+    { {  INT8_C(  72), -INT8_C(  23),  INT8_C(  43),  INT8_C(  48), -INT8_C(  69), -INT8_C(  68),  INT8_C(  24), -INT8_C( 103),
+         INT8_C(  66),  INT8_C(  55),  INT8_C(  15), -INT8_C(  74), -INT8_C(  27), -INT8_C( 111), -INT8_C(  56), -INT8_C( 102),
+         INT8_C( 101),  INT8_C(  42), -INT8_C(  66), -INT8_C(   7), -INT8_C(  94), -INT8_C(  65),  INT8_C(  48), -INT8_C(   9),
+         INT8_C(   5),  INT8_C( 114),  INT8_C(  69),  INT8_C(  39),  INT8_C(  32), -INT8_C(  45), -INT8_C(  61), -INT8_C(  64),
+         INT8_C(  18), -INT8_C(  52),  INT8_C(  69), -INT8_C(  18),  INT8_C(  26),  INT8_C(  87),  INT8_C(  30),  INT8_C(  10),
+        -INT8_C(  73), -INT8_C(  75), -INT8_C(  92), -INT8_C(   9), -INT8_C(  90),  INT8_C(   8), -INT8_C(  79), -INT8_C(  78),
+        -INT8_C(  99),  INT8_C( 123),  INT8_C(  63), -INT8_C(  93),  INT8_C( 116), -INT8_C(  90), -INT8_C(  22), -INT8_C(   2),
+         INT8_C( 109),  INT8_C(  11), -INT8_C(  88),      INT8_MAX,  INT8_C(  39),  INT8_C(  72),  INT8_C(  27), -INT8_C(   5) },
+      { {  INT8_C(  72), -INT8_C(  23),  INT8_C(  43),  INT8_C(  48), -INT8_C(  69), -INT8_C(  68),  INT8_C(  24), -INT8_C( 103),
+           INT8_C(  66),  INT8_C(  55),  INT8_C(  15), -INT8_C(  74), -INT8_C(  27), -INT8_C( 111), -INT8_C(  56), -INT8_C( 102) },
+        {  INT8_C( 101),  INT8_C(  42), -INT8_C(  66), -INT8_C(   7), -INT8_C(  94), -INT8_C(  65),  INT8_C(  48), -INT8_C(   9),
+           INT8_C(   5),  INT8_C( 114),  INT8_C(  69),  INT8_C(  39),  INT8_C(  32), -INT8_C(  45), -INT8_C(  61), -INT8_C(  64) },
+        {  INT8_C(  18), -INT8_C(  52),  INT8_C(  69), -INT8_C(  18),  INT8_C(  26),  INT8_C(  87),  INT8_C(  30),  INT8_C(  10),
+          -INT8_C(  73), -INT8_C(  75), -INT8_C(  92), -INT8_C(   9), -INT8_C(  90),  INT8_C(   8), -INT8_C(  79), -INT8_C(  78) },
+        { -INT8_C(  99),  INT8_C( 123),  INT8_C(  63), -INT8_C(  93),  INT8_C( 116), -INT8_C(  90), -INT8_C(  22), -INT8_C(   2),
+           INT8_C( 109),  INT8_C(  11), -INT8_C(  88),      INT8_MAX,  INT8_C(  39),  INT8_C(  72),  INT8_C(  27), -INT8_C(   5) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x4_t r = simde_vld1q_s8_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[2], simde_vld1q_s8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[3], simde_vld1q_s8(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a[64];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int8x16x4_t r = simde_vld1q_s8_x4(a);
+
+    simde_test_codegen_write_vi8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[32];
+    int16_t r[4][8];
+  } test_vec[] = {
+    { {  INT16_C( 26886),  INT16_C(  8512),  INT16_C( 12081),  INT16_C( 24564), -INT16_C( 29820), -INT16_C(  8529), -INT16_C(  6617), -INT16_C(  9769),
+         INT16_C( 12899), -INT16_C( 31113), -INT16_C( 19138), -INT16_C( 10287),  INT16_C( 27622),  INT16_C(  7003),  INT16_C( 28204), -INT16_C( 26710),
+        -INT16_C(   200), -INT16_C( 30097), -INT16_C( 30962),  INT16_C( 14471), -INT16_C( 25842),  INT16_C( 31602),  INT16_C( 20330), -INT16_C(  3999),
+         INT16_C( 31498),  INT16_C(  1048),  INT16_C( 25832),  INT16_C( 13018),  INT16_C( 27352),  INT16_C( 13206), -INT16_C(  8371), -INT16_C( 26871) },
+      { {  INT16_C( 26886),  INT16_C(  8512),  INT16_C( 12081),  INT16_C( 24564), -INT16_C( 29820), -INT16_C(  8529), -INT16_C(  6617), -INT16_C(  9769) },
+        {  INT16_C( 12899), -INT16_C( 31113), -INT16_C( 19138), -INT16_C( 10287),  INT16_C( 27622),  INT16_C(  7003),  INT16_C( 28204), -INT16_C( 26710) },
+        { -INT16_C(   200), -INT16_C( 30097), -INT16_C( 30962),  INT16_C( 14471), -INT16_C( 25842),  INT16_C( 31602),  INT16_C( 20330), -INT16_C(  3999) },
+        {  INT16_C( 31498),  INT16_C(  1048),  INT16_C( 25832),  INT16_C( 13018),  INT16_C( 27352),  INT16_C( 13206), -INT16_C(  8371), -INT16_C( 26871) } } },
+    { {  INT16_C( 16090), -INT16_C( 28902), -INT16_C( 11865),  INT16_C( 22042), -INT16_C( 14976), -INT16_C(  2507), -INT16_C( 25011), -INT16_C( 20637),
+         INT16_C(  2310), -INT16_C(  1285),  INT16_C( 23325), -INT16_C( 24285), -INT16_C( 20737), -INT16_C( 28243), -INT16_C( 15307), -INT16_C( 12840),
+        -INT16_C( 27788),  INT16_C(  8714),  INT16_C(  1778), -INT16_C( 32764),  INT16_C( 18721),  INT16_C( 24893), -INT16_C( 18733),  INT16_C(  5748),
+        -INT16_C( 28196),  INT16_C( 30645),  INT16_C( 27555), -INT16_C( 29578), -INT16_C(  3311),  INT16_C( 11776), -INT16_C( 12014),  INT16_C( 19655) },
+      { {  INT16_C( 16090), -INT16_C( 28902), -INT16_C( 11865),  INT16_C( 22042), -INT16_C( 14976), -INT16_C(  2507), -INT16_C( 25011), -INT16_C( 20637) },
+        {  INT16_C(  2310), -INT16_C(  1285),  INT16_C( 23325), -INT16_C( 24285), -INT16_C( 20737), -INT16_C( 28243), -INT16_C( 15307), -INT16_C( 12840) },
+        { -INT16_C( 27788),  INT16_C(  8714),  INT16_C(  1778), -INT16_C( 32764),  INT16_C( 18721),  INT16_C( 24893), -INT16_C( 18733),  INT16_C(  5748) },
+        { -INT16_C( 28196),  INT16_C( 30645),  INT16_C( 27555), -INT16_C( 29578), -INT16_C(  3311),  INT16_C( 11776), -INT16_C( 12014),  INT16_C( 19655) } } },
+    { {  INT16_C(  9191),  INT16_C( 23080),  INT16_C( 15452),  INT16_C( 13312),  INT16_C( 10621), -INT16_C(  2466), -INT16_C(  3803),  INT16_C( 12262),
+        -INT16_C( 31839), -INT16_C( 16183),  INT16_C( 23693), -INT16_C( 19068),  INT16_C( 13257),  INT16_C( 21145), -INT16_C( 13347),  INT16_C( 16433),
+         INT16_C( 30712),  INT16_C( 14882),  INT16_C(  8435), -INT16_C( 30963),  INT16_C(  9152), -INT16_C(  6831),  INT16_C( 20088),  INT16_C( 11120),
+        -INT16_C( 16357), -INT16_C( 28623),  INT16_C(  5676), -INT16_C(  4625), -INT16_C(  3554),  INT16_C( 10164), -INT16_C( 12595), -INT16_C(  9942) },
+      { {  INT16_C(  9191),  INT16_C( 23080),  INT16_C( 15452),  INT16_C( 13312),  INT16_C( 10621), -INT16_C(  2466), -INT16_C(  3803),  INT16_C( 12262) },
+        { -INT16_C( 31839), -INT16_C( 16183),  INT16_C( 23693), -INT16_C( 19068),  INT16_C( 13257),  INT16_C( 21145), -INT16_C( 13347),  INT16_C( 16433) },
+        {  INT16_C( 30712),  INT16_C( 14882),  INT16_C(  8435), -INT16_C( 30963),  INT16_C(  9152), -INT16_C(  6831),  INT16_C( 20088),  INT16_C( 11120) },
+        { -INT16_C( 16357), -INT16_C( 28623),  INT16_C(  5676), -INT16_C(  4625), -INT16_C(  3554),  INT16_C( 10164), -INT16_C( 12595), -INT16_C(  9942) } } },
+    { {  INT16_C( 20708), -INT16_C( 21303), -INT16_C( 15523), -INT16_C( 22688),  INT16_C( 19706),  INT16_C(  7675), -INT16_C(    16),  INT16_C( 21649),
+         INT16_C( 26891), -INT16_C( 27392),  INT16_C( 23937), -INT16_C( 32617),  INT16_C( 11085),  INT16_C(  1337),  INT16_C( 30897), -INT16_C(  5538),
+        -INT16_C( 31942), -INT16_C(  3428),  INT16_C( 28980),  INT16_C( 10473), -INT16_C( 20838),  INT16_C(  4174), -INT16_C( 25963),  INT16_C(  7676),
+         INT16_C( 28746),  INT16_C( 23329),  INT16_C( 15130), -INT16_C( 29400),  INT16_C( 15741), -INT16_C( 17312),  INT16_C(  6048), -INT16_C( 31778) },
+      { {  INT16_C( 20708), -INT16_C( 21303), -INT16_C( 15523), -INT16_C( 22688),  INT16_C( 19706),  INT16_C(  7675), -INT16_C(    16),  INT16_C( 21649) },
+        {  INT16_C( 26891), -INT16_C( 27392),  INT16_C( 23937), -INT16_C( 32617),  INT16_C( 11085),  INT16_C(  1337),  INT16_C( 30897), -INT16_C(  5538) },
+        { -INT16_C( 31942), -INT16_C(  3428),  INT16_C( 28980),  INT16_C( 10473), -INT16_C( 20838),  INT16_C(  4174), -INT16_C( 25963),  INT16_C(  7676) },
+        {  INT16_C( 28746),  INT16_C( 23329),  INT16_C( 15130), -INT16_C( 29400),  INT16_C( 15741), -INT16_C( 17312),  INT16_C(  6048), -INT16_C( 31778) } } },
+    { {  INT16_C( 31894),  INT16_C( 17652),  INT16_C( 23960), -INT16_C( 21780), -INT16_C( 22480), -INT16_C( 24753),  INT16_C( 31548), -INT16_C( 22507),
+         INT16_C(  8502),  INT16_C( 14355),  INT16_C( 10143),  INT16_C( 13934),  INT16_C( 32248), -INT16_C( 10116),  INT16_C( 13886),  INT16_C( 24975),
+        -INT16_C(  3137),  INT16_C( 13056),  INT16_C( 23680),  INT16_C( 15596), -INT16_C(  6813),  INT16_C( 15396), -INT16_C( 27746), -INT16_C(   413),
+         INT16_C( 22754),  INT16_C( 30964), -INT16_C( 23304), -INT16_C( 25777), -INT16_C( 20755),  INT16_C(  3275),  INT16_C( 26682), -INT16_C( 10090) },
+      { {  INT16_C( 31894),  INT16_C( 17652),  INT16_C( 23960), -INT16_C( 21780), -INT16_C( 22480), -INT16_C( 24753),  INT16_C( 31548), -INT16_C( 22507) },
+        {  INT16_C(  8502),  INT16_C( 14355),  INT16_C( 10143),  INT16_C( 13934),  INT16_C( 32248), -INT16_C( 10116),  INT16_C( 13886),  INT16_C( 24975) },
+        { -INT16_C(  3137),  INT16_C( 13056),  INT16_C( 23680),  INT16_C( 15596), -INT16_C(  6813),  INT16_C( 15396), -INT16_C( 27746), -INT16_C(   413) },
+        {  INT16_C( 22754),  INT16_C( 30964), -INT16_C( 23304), -INT16_C( 25777), -INT16_C( 20755),  INT16_C(  3275),  INT16_C( 26682), -INT16_C( 10090) } } },
+    { {  INT16_C(   699),  INT16_C( 18455),  INT16_C(  3075), -INT16_C(  1878),  INT16_C(  9537), -INT16_C( 25316), -INT16_C( 15020),  INT16_C(  6194),
+         INT16_C( 26544),  INT16_C(  8023),  INT16_C(  9627), -INT16_C(  9139),  INT16_C( 20146),  INT16_C(  7547), -INT16_C( 24019), -INT16_C( 23602),
+        -INT16_C( 12962),  INT16_C(  7404), -INT16_C( 14629), -INT16_C(  2723), -INT16_C( 23881), -INT16_C(  4382),  INT16_C( 26535),  INT16_C(  3931),
+         INT16_C(  6544), -INT16_C(  8485),  INT16_C( 21534),  INT16_C( 15522),  INT16_C( 20351),  INT16_C(  4729),  INT16_C( 16225),  INT16_C( 10070) },
+      { {  INT16_C(   699),  INT16_C( 18455),  INT16_C(  3075), -INT16_C(  1878),  INT16_C(  9537), -INT16_C( 25316), -INT16_C( 15020),  INT16_C(  6194) },
+        {  INT16_C( 26544),  INT16_C(  8023),  INT16_C(  9627), -INT16_C(  9139),  INT16_C( 20146),  INT16_C(  7547), -INT16_C( 24019), -INT16_C( 23602) },
+        { -INT16_C( 12962),  INT16_C(  7404), -INT16_C( 14629), -INT16_C(  2723), -INT16_C( 23881), -INT16_C(  4382),  INT16_C( 26535),  INT16_C(  3931) },
+        {  INT16_C(  6544), -INT16_C(  8485),  INT16_C( 21534),  INT16_C( 15522),  INT16_C( 20351),  INT16_C(  4729),  INT16_C( 16225),  INT16_C( 10070) } } },
+    { {  INT16_C(  7939),  INT16_C( 23400),  INT16_C( 19505), -INT16_C( 29300), -INT16_C(  2264),  INT16_C(  8790),  INT16_C( 20083),  INT16_C( 16663),
+         INT16_C( 15488), -INT16_C( 15266), -INT16_C(  7895),  INT16_C( 28544),  INT16_C( 29635), -INT16_C( 28184),  INT16_C( 29319),  INT16_C( 31591),
+         INT16_C( 23687), -INT16_C( 18548),  INT16_C( 21750),  INT16_C(  5084),  INT16_C(  3533), -INT16_C(  2412), -INT16_C( 27603), -INT16_C(  6101),
+         INT16_C( 25830), -INT16_C( 19521),  INT16_C( 13417),  INT16_C( 18520), -INT16_C( 26188),  INT16_C( 23858),  INT16_C( 11783),  INT16_C( 24234) },
+      { {  INT16_C(  7939),  INT16_C( 23400),  INT16_C( 19505), -INT16_C( 29300), -INT16_C(  2264),  INT16_C(  8790),  INT16_C( 20083),  INT16_C( 16663) },
+        {  INT16_C( 15488), -INT16_C( 15266), -INT16_C(  7895),  INT16_C( 28544),  INT16_C( 29635), -INT16_C( 28184),  INT16_C( 29319),  INT16_C( 31591) },
+        {  INT16_C( 23687), -INT16_C( 18548),  INT16_C( 21750),  INT16_C(  5084),  INT16_C(  3533), -INT16_C(  2412), -INT16_C( 27603), -INT16_C(  6101) },
+        {  INT16_C( 25830), -INT16_C( 19521),  INT16_C( 13417),  INT16_C( 18520), -INT16_C( 26188),  INT16_C( 23858),  INT16_C( 11783),  INT16_C( 24234) } } },
+    { {  INT16_C(   225), -INT16_C(  2228), -INT16_C( 21209),  INT16_C( 19152), -INT16_C( 22953), -INT16_C( 24279), -INT16_C( 23711), -INT16_C( 21425),
+        -INT16_C( 22777), -INT16_C( 17395), -INT16_C(  7743), -INT16_C( 23939), -INT16_C( 17555), -INT16_C( 20116), -INT16_C(   565),  INT16_C( 19436),
+        -INT16_C( 10614), -INT16_C(  2511),  INT16_C( 19379), -INT16_C(   641), -INT16_C( 30224),  INT16_C( 28637), -INT16_C(  6591),  INT16_C(  3713),
+        -INT16_C( 13085),  INT16_C( 13519),  INT16_C( 10732), -INT16_C( 27933), -INT16_C( 17106), -INT16_C( 32709),  INT16_C( 32042), -INT16_C( 23737) },
+      { {  INT16_C(   225), -INT16_C(  2228), -INT16_C( 21209),  INT16_C( 19152), -INT16_C( 22953), -INT16_C( 24279), -INT16_C( 23711), -INT16_C( 21425) },
+        { -INT16_C( 22777), -INT16_C( 17395), -INT16_C(  7743), -INT16_C( 23939), -INT16_C( 17555), -INT16_C( 20116), -INT16_C(   565),  INT16_C( 19436) },
+        { -INT16_C( 10614), -INT16_C(  2511),  INT16_C( 19379), -INT16_C(   641), -INT16_C( 30224),  INT16_C( 28637), -INT16_C(  6591),  INT16_C(  3713) },
+        { -INT16_C( 13085),  INT16_C( 13519),  INT16_C( 10732), -INT16_C( 27933), -INT16_C( 17106), -INT16_C( 32709),  INT16_C( 32042), -INT16_C( 23737) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x4_t r = simde_vld1q_s16_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[2], simde_vld1q_s16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[3], simde_vld1q_s16(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a[32];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int16x8x4_t r = simde_vld1q_s16_x4(a);
+
+    simde_test_codegen_write_vi16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[16];
+    int32_t r[4][4];
+  } test_vec[] = {
+    { {  INT32_C(  1203942820), -INT32_C(   698697319), -INT32_C(   324855779), -INT32_C(   389817230), -INT32_C(   638365893), -INT32_C(   889670680), -INT32_C(  1555470810), -INT32_C(  2093066564),
+        -INT32_C(   694471254),  INT32_C(   177975906), -INT32_C(  1782010729),  INT32_C(   333646493), -INT32_C(   543816493),  INT32_C(  1711575186),  INT32_C(  1505877426), -INT32_C(   226665363) },
+      { {  INT32_C(  1203942820), -INT32_C(   698697319), -INT32_C(   324855779), -INT32_C(   389817230) },
+        { -INT32_C(   638365893), -INT32_C(   889670680), -INT32_C(  1555470810), -INT32_C(  2093066564) },
+        { -INT32_C(   694471254),  INT32_C(   177975906), -INT32_C(  1782010729),  INT32_C(   333646493) },
+        { -INT32_C(   543816493),  INT32_C(  1711575186),  INT32_C(  1505877426), -INT32_C(   226665363) } } },
+    { {  INT32_C(  1497887115), -INT32_C(  1506634010), -INT32_C(  1286302861),  INT32_C(  1539466813),  INT32_C(    97116028),  INT32_C(   735576368),  INT32_C(   414649915), -INT32_C(  1701061691),
+        -INT32_C(   260395115),  INT32_C(   663631794), -INT32_C(  1596269305), -INT32_C(   681959075),  INT32_C(   443021831),  INT32_C(    70628434), -INT32_C(  1035442026),  INT32_C(  1983932569) },
+      { {  INT32_C(  1497887115), -INT32_C(  1506634010), -INT32_C(  1286302861),  INT32_C(  1539466813) },
+        {  INT32_C(    97116028),  INT32_C(   735576368),  INT32_C(   414649915), -INT32_C(  1701061691) },
+        { -INT32_C(   260395115),  INT32_C(   663631794), -INT32_C(  1596269305), -INT32_C(   681959075) },
+        {  INT32_C(   443021831),  INT32_C(    70628434), -INT32_C(  1035442026),  INT32_C(  1983932569) } } },
+    { {  INT32_C(  1489546960),  INT32_C(   555588799),  INT32_C(    73768661),  INT32_C(   471146562),  INT32_C(   890527849),  INT32_C(  1216294323),  INT32_C(  1037625075), -INT32_C(   833192890),
+         INT32_C(  1540812169), -INT32_C(   938416430), -INT32_C(    46353011),  INT32_C(   873325899),  INT32_C(   584561596), -INT32_C(   279935100), -INT32_C(   633989916), -INT32_C(    49860364) },
+      { {  INT32_C(  1489546960),  INT32_C(   555588799),  INT32_C(    73768661),  INT32_C(   471146562) },
+        {  INT32_C(   890527849),  INT32_C(  1216294323),  INT32_C(  1037625075), -INT32_C(   833192890) },
+        {  INT32_C(  1540812169), -INT32_C(   938416430), -INT32_C(    46353011),  INT32_C(   873325899) },
+        {  INT32_C(   584561596), -INT32_C(   279935100), -INT32_C(   633989916), -INT32_C(    49860364) } } },
+    { {  INT32_C(  1836674287),  INT32_C(   140683595),  INT32_C(   588818136),  INT32_C(  1090545714), -INT32_C(   595745493), -INT32_C(   600913959), -INT32_C(   334176501), -INT32_C(   166913190),
+         INT32_C(  2127435913), -INT32_C(   704806044), -INT32_C(  1626789026),  INT32_C(  1849337870), -INT32_C(   501243179), -INT32_C(   414661550),  INT32_C(    47812649),  INT32_C(   896937438) },
+      { {  INT32_C(  1836674287),  INT32_C(   140683595),  INT32_C(   588818136),  INT32_C(  1090545714) },
+        { -INT32_C(   595745493), -INT32_C(   600913959), -INT32_C(   334176501), -INT32_C(   166913190) },
+        {  INT32_C(  2127435913), -INT32_C(   704806044), -INT32_C(  1626789026),  INT32_C(  1849337870) },
+        { -INT32_C(   501243179), -INT32_C(   414661550),  INT32_C(    47812649),  INT32_C(   896937438) } } },
+    { { -INT32_C(   961929016), -INT32_C(   964020214),  INT32_C(   790367829), -INT32_C(   525791228),  INT32_C(  1344056134), -INT32_C(  1754976003),  INT32_C(   372022956), -INT32_C(   658356909),
+         INT32_C(  1875838525), -INT32_C(  1104013081),  INT32_C(   931190781), -INT32_C(   644308052),  INT32_C(   414205791), -INT32_C(  1972331535),  INT32_C(   406762681),  INT32_C(   159643400) },
+      { { -INT32_C(   961929016), -INT32_C(   964020214),  INT32_C(   790367829), -INT32_C(   525791228) },
+        {  INT32_C(  1344056134), -INT32_C(  1754976003),  INT32_C(   372022956), -INT32_C(   658356909) },
+        {  INT32_C(  1875838525), -INT32_C(  1104013081),  INT32_C(   931190781), -INT32_C(   644308052) },
+        {  INT32_C(   414205791), -INT32_C(  1972331535),  INT32_C(   406762681),  INT32_C(   159643400) } } },
+    { { -INT32_C(  1979360973), -INT32_C(  1148254778), -INT32_C(  1446718201),  INT32_C(  1971011612), -INT32_C(   427395786), -INT32_C(   301269153), -INT32_C(  1927515619),  INT32_C(   582308093),
+         INT32_C(  1269744782), -INT32_C(   324461675),  INT32_C(   347987276),  INT32_C(   347952970),  INT32_C(   197849566), -INT32_C(   156021981),  INT32_C(  1009069179),  INT32_C(  1792896412) },
+      { { -INT32_C(  1979360973), -INT32_C(  1148254778), -INT32_C(  1446718201),  INT32_C(  1971011612) },
+        { -INT32_C(   427395786), -INT32_C(   301269153), -INT32_C(  1927515619),  INT32_C(   582308093) },
+        {  INT32_C(  1269744782), -INT32_C(   324461675),  INT32_C(   347987276),  INT32_C(   347952970) },
+        {  INT32_C(   197849566), -INT32_C(   156021981),  INT32_C(  1009069179),  INT32_C(  1792896412) } } },
+    { { -INT32_C(  1799464771), -INT32_C(  2116894027), -INT32_C(   630469113),  INT32_C(   226451487), -INT32_C(   319145777), -INT32_C(  1574102991),  INT32_C(   241877460), -INT32_C(   397207850),
+        -INT32_C(  1354494073),  INT32_C(  1339020819), -INT32_C(  1206778432),  INT32_C(  1749352692), -INT32_C(  1171380506), -INT32_C(  1096454608), -INT32_C(  1917686455),  INT32_C(  1974291667) },
+      { { -INT32_C(  1799464771), -INT32_C(  2116894027), -INT32_C(   630469113),  INT32_C(   226451487) },
+        { -INT32_C(   319145777), -INT32_C(  1574102991),  INT32_C(   241877460), -INT32_C(   397207850) },
+        { -INT32_C(  1354494073),  INT32_C(  1339020819), -INT32_C(  1206778432),  INT32_C(  1749352692) },
+        { -INT32_C(  1171380506), -INT32_C(  1096454608), -INT32_C(  1917686455),  INT32_C(  1974291667) } } },
+    { { -INT32_C(   655623615),  INT32_C(    27328748),  INT32_C(  1069113200),  INT32_C(   473587671), -INT32_C(   213372328),  INT32_C(  2035192896), -INT32_C(  1092222348),  INT32_C(  2074645865),
+         INT32_C(   844614818),  INT32_C(  1954776237), -INT32_C(  1221705471), -INT32_C(   713918888), -INT32_C(   721270874), -INT32_C(   528344276), -INT32_C(    41700314),  INT32_C(  1593243329) },
+      { { -INT32_C(   655623615),  INT32_C(    27328748),  INT32_C(  1069113200),  INT32_C(   473587671) },
+        { -INT32_C(   213372328),  INT32_C(  2035192896), -INT32_C(  1092222348),  INT32_C(  2074645865) },
+        {  INT32_C(   844614818),  INT32_C(  1954776237), -INT32_C(  1221705471), -INT32_C(   713918888) },
+        { -INT32_C(   721270874), -INT32_C(   528344276), -INT32_C(    41700314),  INT32_C(  1593243329) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x4_t r = simde_vld1q_s32_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[2], simde_vld1q_s32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[3], simde_vld1q_s32(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int32x4x4_t r = simde_vld1q_s32_x4(a);
+
+    simde_test_codegen_write_vi32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_s64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[8];
+    int64_t r[4][2];
+  } test_vec[] = {
+    { { -INT64_C( 6114114918330445069),  INT64_C( 2144246363580383408), -INT64_C( 6900152894811191759), -INT64_C(  752582566236121737),
+         INT64_C( 3610808856943524757), -INT64_C( 9151814705685016239), -INT64_C( 9077797095463212125), -INT64_C(  258732782074385811) },
+      { { -INT64_C( 6114114918330445069),  INT64_C( 2144246363580383408) },
+        { -INT64_C( 6900152894811191759), -INT64_C(  752582566236121737) },
+        {  INT64_C( 3610808856943524757), -INT64_C( 9151814705685016239) },
+        { -INT64_C( 9077797095463212125), -INT64_C(  258732782074385811) } } },
+    { { -INT64_C( 7788876300626212853),  INT64_C(   57201506566623187),  INT64_C( 4187628057640302974),  INT64_C( 8991394217698447658),
+        -INT64_C(  698208753926042238),  INT64_C( 8402435612662216831),  INT64_C( 6471253235103341166),  INT64_C( 9063223777691240938) },
+      { { -INT64_C( 7788876300626212853),  INT64_C(   57201506566623187) },
+        {  INT64_C( 4187628057640302974),  INT64_C( 8991394217698447658) },
+        { -INT64_C(  698208753926042238),  INT64_C( 8402435612662216831) },
+        {  INT64_C( 6471253235103341166),  INT64_C( 9063223777691240938) } } },
+    { { -INT64_C( 1590257712638118050),  INT64_C( 9040686645597354973),  INT64_C( 4165279576306310691),  INT64_C( 3157796813021276547),
+         INT64_C( 7826592025523340285), -INT64_C( 2700879408187686202), -INT64_C(  362249254645658446), -INT64_C( 5333531114116516245) },
+      { { -INT64_C( 1590257712638118050),  INT64_C( 9040686645597354973) },
+        {  INT64_C( 4165279576306310691),  INT64_C( 3157796813021276547) },
+        {  INT64_C( 7826592025523340285), -INT64_C( 2700879408187686202) },
+        { -INT64_C(  362249254645658446), -INT64_C( 5333531114116516245) } } },
+    { {  INT64_C( 8014837052565321309),  INT64_C( 1871996053969453306),  INT64_C( 6279806568127292216),  INT64_C(   83648834274552500),
+        -INT64_C( 6105382945789889850), -INT64_C( 1622238526514714470), -INT64_C( 7111936933629657262),  INT64_C(  939049547508046796) },
+      { {  INT64_C( 8014837052565321309),  INT64_C( 1871996053969453306) },
+        {  INT64_C( 6279806568127292216),  INT64_C(   83648834274552500) },
+        { -INT64_C( 6105382945789889850), -INT64_C( 1622238526514714470) },
+        { -INT64_C( 7111936933629657262),  INT64_C(  939049547508046796) } } },
+    { { -INT64_C( 2433945616356233775),  INT64_C( 1902902595732841700), -INT64_C( 8562299561287789913), -INT64_C( 7812829115287956100),
+         INT64_C( 4245111932651376778), -INT64_C( 5945257780596115773),  INT64_C( 6507105472475581321),  INT64_C( 1905260236279519936) },
+      { { -INT64_C( 2433945616356233775),  INT64_C( 1902902595732841700) },
+        { -INT64_C( 8562299561287789913), -INT64_C( 7812829115287956100) },
+        {  INT64_C( 4245111932651376778), -INT64_C( 5945257780596115773) },
+        {  INT64_C( 6507105472475581321),  INT64_C( 1905260236279519936) } } },
+    { {  INT64_C( 5138263628374379621), -INT64_C( 3007317829110735781),  INT64_C( 7363069808392229338), -INT64_C( 4229848344190844053),
+         INT64_C( 7290975765914507333),  INT64_C( 1084025531570880315), -INT64_C( 5543595570904559830),  INT64_C( 7809657704253731380) },
+      { {  INT64_C( 5138263628374379621), -INT64_C( 3007317829110735781) },
+        {  INT64_C( 7363069808392229338), -INT64_C( 4229848344190844053) },
+        {  INT64_C( 7290975765914507333),  INT64_C( 1084025531570880315) },
+        { -INT64_C( 5543595570904559830),  INT64_C( 7809657704253731380) } } },
+    { {  INT64_C( 5726254076582235573),  INT64_C( 3852411194420013607),  INT64_C( 3880775740296195876),  INT64_C( 7827498092322034149),
+        -INT64_C( 6622734935651101906),  INT64_C( 4208717258777153717),  INT64_C( 1968533111081524711), -INT64_C( 3928932149381419057) },
+      { {  INT64_C( 5726254076582235573),  INT64_C( 3852411194420013607) },
+        {  INT64_C( 3880775740296195876),  INT64_C( 7827498092322034149) },
+        { -INT64_C( 6622734935651101906),  INT64_C( 4208717258777153717) },
+        {  INT64_C( 1968533111081524711), -INT64_C( 3928932149381419057) } } },
+    { { -INT64_C(  215087928593988261),  INT64_C( 6027836497993555479), -INT64_C( 1832612043607953233), -INT64_C( 7023239546631258279),
+        -INT64_C( 5877631789950885746), -INT64_C(  731464750390001537),  INT64_C( 6188965739792476382), -INT64_C( 4896803924190034330) },
+      { { -INT64_C(  215087928593988261),  INT64_C( 6027836497993555479) },
+        { -INT64_C( 1832612043607953233), -INT64_C( 7023239546631258279) },
+        { -INT64_C( 5877631789950885746), -INT64_C(  731464750390001537) },
+        {  INT64_C( 6188965739792476382), -INT64_C( 4896803924190034330) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x4_t r = simde_vld1q_s64_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[2], simde_vld1q_s64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[3], simde_vld1q_s64(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_int64x2x4_t r = simde_vld1q_s64_x4(a);
+
+    simde_test_codegen_write_vi64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[64];
+    uint8_t r[4][16];
+  } test_vec[] = {
+    { { UINT8_C(150), UINT8_C( 14), UINT8_C(201), UINT8_C(153), UINT8_C( 61), UINT8_C(218), UINT8_C(148), UINT8_C(209),
+        UINT8_C(157), UINT8_C(152), UINT8_C(132), UINT8_C( 42), UINT8_C(176), UINT8_C( 22), UINT8_C(145), UINT8_C(108),
+        UINT8_C( 43), UINT8_C(211), UINT8_C(206), UINT8_C( 51), UINT8_C(182), UINT8_C(214), UINT8_C( 61), UINT8_C(152),
+        UINT8_C( 17), UINT8_C(203), UINT8_C( 73), UINT8_C(182), UINT8_C(185), UINT8_C( 14), UINT8_C( 78), UINT8_C(202),
+        UINT8_C(101), UINT8_C(140), UINT8_C(249), UINT8_C(156), UINT8_C(228), UINT8_C( 90), UINT8_C(205), UINT8_C(200),
+        UINT8_C(209), UINT8_C(147), UINT8_C(127), UINT8_C(175), UINT8_C(118), UINT8_C(164), UINT8_C( 91), UINT8_C(161),
+        UINT8_C( 58), UINT8_C(167), UINT8_C( 13), UINT8_C(221), UINT8_C(137), UINT8_C(162), UINT8_C(168), UINT8_C(146),
+        UINT8_C(165), UINT8_C(  8), UINT8_C(251), UINT8_C(158), UINT8_C(201), UINT8_C(152), UINT8_C(232), UINT8_C( 44) },
+      { { UINT8_C(150), UINT8_C( 14), UINT8_C(201), UINT8_C(153), UINT8_C( 61), UINT8_C(218), UINT8_C(148), UINT8_C(209),
+          UINT8_C(157), UINT8_C(152), UINT8_C(132), UINT8_C( 42), UINT8_C(176), UINT8_C( 22), UINT8_C(145), UINT8_C(108) },
+        { UINT8_C( 43), UINT8_C(211), UINT8_C(206), UINT8_C( 51), UINT8_C(182), UINT8_C(214), UINT8_C( 61), UINT8_C(152),
+          UINT8_C( 17), UINT8_C(203), UINT8_C( 73), UINT8_C(182), UINT8_C(185), UINT8_C( 14), UINT8_C( 78), UINT8_C(202) },
+        { UINT8_C(101), UINT8_C(140), UINT8_C(249), UINT8_C(156), UINT8_C(228), UINT8_C( 90), UINT8_C(205), UINT8_C(200),
+          UINT8_C(209), UINT8_C(147), UINT8_C(127), UINT8_C(175), UINT8_C(118), UINT8_C(164), UINT8_C( 91), UINT8_C(161) },
+        { UINT8_C( 58), UINT8_C(167), UINT8_C( 13), UINT8_C(221), UINT8_C(137), UINT8_C(162), UINT8_C(168), UINT8_C(146),
+          UINT8_C(165), UINT8_C(  8), UINT8_C(251), UINT8_C(158), UINT8_C(201), UINT8_C(152), UINT8_C(232), UINT8_C( 44) } } },
+    { { UINT8_C(191), UINT8_C( 38), UINT8_C(235), UINT8_C(147), UINT8_C( 77), UINT8_C( 15), UINT8_C(115), UINT8_C( 70),
+        UINT8_C(168), UINT8_C(175), UINT8_C(248), UINT8_C(159), UINT8_C(171), UINT8_C(248), UINT8_C(189), UINT8_C(252),
+        UINT8_C( 62), UINT8_C(165),    UINT8_MAX, UINT8_C(223), UINT8_C( 86), UINT8_C(137), UINT8_C(215), UINT8_C(  3),
+        UINT8_C( 69), UINT8_C(224), UINT8_C(133), UINT8_C( 10), UINT8_C(149), UINT8_C(228), UINT8_C( 66), UINT8_C( 62),
+        UINT8_C( 63), UINT8_C(253), UINT8_C(217), UINT8_C( 13), UINT8_C(224), UINT8_C(133), UINT8_C(249), UINT8_C( 71),
+        UINT8_C( 13), UINT8_C(158), UINT8_C(231), UINT8_C(224), UINT8_C(145), UINT8_C(138), UINT8_C( 66), UINT8_C(166),
+        UINT8_C(231), UINT8_C( 38), UINT8_C(204), UINT8_C(116), UINT8_C(  6), UINT8_C(234), UINT8_C(101), UINT8_C(204),
+        UINT8_C(187), UINT8_C( 95), UINT8_C( 82), UINT8_C(224), UINT8_C(168), UINT8_C(103), UINT8_C( 68), UINT8_C(151) },
+      { { UINT8_C(191), UINT8_C( 38), UINT8_C(235), UINT8_C(147), UINT8_C( 77), UINT8_C( 15), UINT8_C(115), UINT8_C( 70),
+          UINT8_C(168), UINT8_C(175), UINT8_C(248), UINT8_C(159), UINT8_C(171), UINT8_C(248), UINT8_C(189), UINT8_C(252) },
+        { UINT8_C( 62), UINT8_C(165),    UINT8_MAX, UINT8_C(223), UINT8_C( 86), UINT8_C(137), UINT8_C(215), UINT8_C(  3),
+          UINT8_C( 69), UINT8_C(224), UINT8_C(133), UINT8_C( 10), UINT8_C(149), UINT8_C(228), UINT8_C( 66), UINT8_C( 62) },
+        { UINT8_C( 63), UINT8_C(253), UINT8_C(217), UINT8_C( 13), UINT8_C(224), UINT8_C(133), UINT8_C(249), UINT8_C( 71),
+          UINT8_C( 13), UINT8_C(158), UINT8_C(231), UINT8_C(224), UINT8_C(145), UINT8_C(138), UINT8_C( 66), UINT8_C(166) },
+        { UINT8_C(231), UINT8_C( 38), UINT8_C(204), UINT8_C(116), UINT8_C(  6), UINT8_C(234), UINT8_C(101), UINT8_C(204),
+          UINT8_C(187), UINT8_C( 95), UINT8_C( 82), UINT8_C(224), UINT8_C(168), UINT8_C(103), UINT8_C( 68), UINT8_C(151) } } },
+    { { UINT8_C(158), UINT8_C( 11), UINT8_C(185), UINT8_C(119), UINT8_C(233), UINT8_C( 42), UINT8_C(104), UINT8_C( 84),
+        UINT8_C(220), UINT8_C(234), UINT8_C( 54), UINT8_C(252), UINT8_C(109), UINT8_C(135), UINT8_C(185), UINT8_C( 78),
+        UINT8_C(  4), UINT8_C( 80), UINT8_C(176), UINT8_C( 32), UINT8_C( 74), UINT8_C( 35), UINT8_C(221), UINT8_C( 22),
+        UINT8_C(174), UINT8_C(109), UINT8_C( 16), UINT8_C(209), UINT8_C(116), UINT8_C(176), UINT8_C(182), UINT8_C( 24),
+        UINT8_C( 28), UINT8_C(220), UINT8_C( 86), UINT8_C(243), UINT8_C(119), UINT8_C( 56), UINT8_C(220), UINT8_C( 43),
+        UINT8_C(141), UINT8_C( 56), UINT8_C( 35), UINT8_C(254), UINT8_C(249), UINT8_C( 46), UINT8_C( 99), UINT8_C(169),
+        UINT8_C( 50), UINT8_C(165), UINT8_C(190), UINT8_C(  9), UINT8_C(198), UINT8_C( 55), UINT8_C( 30), UINT8_C(222),
+        UINT8_C(209), UINT8_C( 78), UINT8_C( 28), UINT8_C(130), UINT8_C( 32), UINT8_C( 77), UINT8_C(194), UINT8_C(123) },
+      { { UINT8_C(158), UINT8_C( 11), UINT8_C(185), UINT8_C(119), UINT8_C(233), UINT8_C( 42), UINT8_C(104), UINT8_C( 84),
+          UINT8_C(220), UINT8_C(234), UINT8_C( 54), UINT8_C(252), UINT8_C(109), UINT8_C(135), UINT8_C(185), UINT8_C( 78) },
+        { UINT8_C(  4), UINT8_C( 80), UINT8_C(176), UINT8_C( 32), UINT8_C( 74), UINT8_C( 35), UINT8_C(221), UINT8_C( 22),
+          UINT8_C(174), UINT8_C(109), UINT8_C( 16), UINT8_C(209), UINT8_C(116), UINT8_C(176), UINT8_C(182), UINT8_C( 24) },
+        { UINT8_C( 28), UINT8_C(220), UINT8_C( 86), UINT8_C(243), UINT8_C(119), UINT8_C( 56), UINT8_C(220), UINT8_C( 43),
+          UINT8_C(141), UINT8_C( 56), UINT8_C( 35), UINT8_C(254), UINT8_C(249), UINT8_C( 46), UINT8_C( 99), UINT8_C(169) },
+        { UINT8_C( 50), UINT8_C(165), UINT8_C(190), UINT8_C(  9), UINT8_C(198), UINT8_C( 55), UINT8_C( 30), UINT8_C(222),
+          UINT8_C(209), UINT8_C( 78), UINT8_C( 28), UINT8_C(130), UINT8_C( 32), UINT8_C( 77), UINT8_C(194), UINT8_C(123) } } },
+    { { UINT8_C( 30), UINT8_C(196), UINT8_C(232), UINT8_C(103), UINT8_C(168), UINT8_C(208), UINT8_C(164), UINT8_C( 51),
+        UINT8_C( 79), UINT8_C(101), UINT8_C(  0), UINT8_C(254), UINT8_C( 41), UINT8_C(251), UINT8_C(152), UINT8_C(248),
+        UINT8_C(163), UINT8_C(106), UINT8_C(174), UINT8_C(220), UINT8_C( 71), UINT8_C(  2), UINT8_C( 50), UINT8_C( 65),
+        UINT8_C(151), UINT8_C( 76), UINT8_C( 36), UINT8_C( 53), UINT8_C(241), UINT8_C( 99), UINT8_C( 38), UINT8_C( 89),
+        UINT8_C(232), UINT8_C( 58), UINT8_C(186), UINT8_C( 47), UINT8_C(104), UINT8_C(  7), UINT8_C(173), UINT8_C( 23),
+        UINT8_C(215), UINT8_C(101), UINT8_C(206), UINT8_C(210), UINT8_C(238), UINT8_C(242), UINT8_C(224), UINT8_C( 78),
+        UINT8_C(142), UINT8_C(209), UINT8_C(196), UINT8_C(228), UINT8_C(129), UINT8_C( 10), UINT8_C( 29), UINT8_C( 54),
+        UINT8_C( 38), UINT8_C( 51), UINT8_C( 30), UINT8_C( 31), UINT8_C(243), UINT8_C(137), UINT8_C(221), UINT8_C(245) },
+      { { UINT8_C( 30), UINT8_C(196), UINT8_C(232), UINT8_C(103), UINT8_C(168), UINT8_C(208), UINT8_C(164), UINT8_C( 51),
+          UINT8_C( 79), UINT8_C(101), UINT8_C(  0), UINT8_C(254), UINT8_C( 41), UINT8_C(251), UINT8_C(152), UINT8_C(248) },
+        { UINT8_C(163), UINT8_C(106), UINT8_C(174), UINT8_C(220), UINT8_C( 71), UINT8_C(  2), UINT8_C( 50), UINT8_C( 65),
+          UINT8_C(151), UINT8_C( 76), UINT8_C( 36), UINT8_C( 53), UINT8_C(241), UINT8_C( 99), UINT8_C( 38), UINT8_C( 89) },
+        { UINT8_C(232), UINT8_C( 58), UINT8_C(186), UINT8_C( 47), UINT8_C(104), UINT8_C(  7), UINT8_C(173), UINT8_C( 23),
+          UINT8_C(215), UINT8_C(101), UINT8_C(206), UINT8_C(210), UINT8_C(238), UINT8_C(242), UINT8_C(224), UINT8_C( 78) },
+        { UINT8_C(142), UINT8_C(209), UINT8_C(196), UINT8_C(228), UINT8_C(129), UINT8_C( 10), UINT8_C( 29), UINT8_C( 54),
+          UINT8_C( 38), UINT8_C( 51), UINT8_C( 30), UINT8_C( 31), UINT8_C(243), UINT8_C(137), UINT8_C(221), UINT8_C(245) } } },
+    { { UINT8_C(250),    UINT8_MAX, UINT8_C( 69), UINT8_C( 12), UINT8_C( 57), UINT8_C(228), UINT8_C(137), UINT8_C(250),
+        UINT8_C( 89), UINT8_C(131), UINT8_C(173), UINT8_C(170), UINT8_C(223), UINT8_C(139), UINT8_C( 77), UINT8_C(248),
+        UINT8_C( 41), UINT8_C(223), UINT8_C(123), UINT8_C(219), UINT8_C(152), UINT8_C( 94), UINT8_C(  0), UINT8_C( 27),
+        UINT8_C( 14), UINT8_C(242), UINT8_C(232), UINT8_C( 88), UINT8_C(126), UINT8_C( 22), UINT8_C(109), UINT8_C(236),
+        UINT8_C(249), UINT8_C(135), UINT8_C( 39),    UINT8_MAX, UINT8_C(126), UINT8_C(254), UINT8_C(179), UINT8_C(250),
+        UINT8_C( 16), UINT8_C(154), UINT8_C( 55), UINT8_C( 90), UINT8_C(153), UINT8_C(131), UINT8_C(  5), UINT8_C( 51),
+        UINT8_C(221), UINT8_C( 45), UINT8_C(133), UINT8_C(192), UINT8_C(102), UINT8_C(192), UINT8_C(128), UINT8_C(187),
+        UINT8_C(186), UINT8_C(252), UINT8_C( 82), UINT8_C( 36), UINT8_C(143), UINT8_C( 24), UINT8_C(178), UINT8_C(217) },
+      { { UINT8_C(250),    UINT8_MAX, UINT8_C( 69), UINT8_C( 12), UINT8_C( 57), UINT8_C(228), UINT8_C(137), UINT8_C(250),
+          UINT8_C( 89), UINT8_C(131), UINT8_C(173), UINT8_C(170), UINT8_C(223), UINT8_C(139), UINT8_C( 77), UINT8_C(248) },
+        { UINT8_C( 41), UINT8_C(223), UINT8_C(123), UINT8_C(219), UINT8_C(152), UINT8_C( 94), UINT8_C(  0), UINT8_C( 27),
+          UINT8_C( 14), UINT8_C(242), UINT8_C(232), UINT8_C( 88), UINT8_C(126), UINT8_C( 22), UINT8_C(109), UINT8_C(236) },
+        { UINT8_C(249), UINT8_C(135), UINT8_C( 39),    UINT8_MAX, UINT8_C(126), UINT8_C(254), UINT8_C(179), UINT8_C(250),
+          UINT8_C( 16), UINT8_C(154), UINT8_C( 55), UINT8_C( 90), UINT8_C(153), UINT8_C(131), UINT8_C(  5), UINT8_C( 51) },
+        { UINT8_C(221), UINT8_C( 45), UINT8_C(133), UINT8_C(192), UINT8_C(102), UINT8_C(192), UINT8_C(128), UINT8_C(187),
+          UINT8_C(186), UINT8_C(252), UINT8_C( 82), UINT8_C( 36), UINT8_C(143), UINT8_C( 24), UINT8_C(178), UINT8_C(217) } } },
+    { { UINT8_C(190), UINT8_C( 39), UINT8_C( 29), UINT8_C( 78), UINT8_C( 90), UINT8_C(189), UINT8_C( 91), UINT8_C( 79),
+        UINT8_C(200), UINT8_C( 49), UINT8_C(156), UINT8_C(112), UINT8_C( 56), UINT8_C(  5), UINT8_C(244), UINT8_C(236),
+        UINT8_C(221), UINT8_C(215), UINT8_C( 57), UINT8_C( 90), UINT8_C(162), UINT8_C(144), UINT8_C(181), UINT8_C(105),
+        UINT8_C(125), UINT8_C(144), UINT8_C(  6), UINT8_C(167), UINT8_C( 44), UINT8_C(191), UINT8_C( 85), UINT8_C(170),
+        UINT8_C( 46), UINT8_C(107), UINT8_C(110), UINT8_C(177), UINT8_C( 46), UINT8_C(195), UINT8_C(108), UINT8_C(143),
+        UINT8_C(243), UINT8_C(169), UINT8_C(245), UINT8_C( 50), UINT8_C( 45), UINT8_C(195), UINT8_C(214), UINT8_C(166),
+        UINT8_C(  0), UINT8_C( 93), UINT8_C(128), UINT8_C(177), UINT8_C(247), UINT8_C(132), UINT8_C( 14), UINT8_C(162),
+        UINT8_C( 12), UINT8_C( 58), UINT8_C(254), UINT8_C(110), UINT8_C(184), UINT8_C(191), UINT8_C(123), UINT8_C( 42) },
+      { { UINT8_C(190), UINT8_C( 39), UINT8_C( 29), UINT8_C( 78), UINT8_C( 90), UINT8_C(189), UINT8_C( 91), UINT8_C( 79),
+          UINT8_C(200), UINT8_C( 49), UINT8_C(156), UINT8_C(112), UINT8_C( 56), UINT8_C(  5), UINT8_C(244), UINT8_C(236) },
+        { UINT8_C(221), UINT8_C(215), UINT8_C( 57), UINT8_C( 90), UINT8_C(162), UINT8_C(144), UINT8_C(181), UINT8_C(105),
+          UINT8_C(125), UINT8_C(144), UINT8_C(  6), UINT8_C(167), UINT8_C( 44), UINT8_C(191), UINT8_C( 85), UINT8_C(170) },
+        { UINT8_C( 46), UINT8_C(107), UINT8_C(110), UINT8_C(177), UINT8_C( 46), UINT8_C(195), UINT8_C(108), UINT8_C(143),
+          UINT8_C(243), UINT8_C(169), UINT8_C(245), UINT8_C( 50), UINT8_C( 45), UINT8_C(195), UINT8_C(214), UINT8_C(166) },
+        { UINT8_C(  0), UINT8_C( 93), UINT8_C(128), UINT8_C(177), UINT8_C(247), UINT8_C(132), UINT8_C( 14), UINT8_C(162),
+          UINT8_C( 12), UINT8_C( 58), UINT8_C(254), UINT8_C(110), UINT8_C(184), UINT8_C(191), UINT8_C(123), UINT8_C( 42) } } },
+    { { UINT8_C(253), UINT8_C(185), UINT8_C( 92), UINT8_C( 26), UINT8_C( 24), UINT8_C(166), UINT8_C( 73), UINT8_C( 80),
+        UINT8_C(233), UINT8_C(164), UINT8_C(123), UINT8_C(103), UINT8_C(224), UINT8_C(  3), UINT8_C(238), UINT8_C( 44),
+        UINT8_C( 28), UINT8_C(240), UINT8_C(120), UINT8_C(173), UINT8_C(144), UINT8_C( 27), UINT8_C(144), UINT8_C(  8),
+        UINT8_C(229), UINT8_C( 62), UINT8_C( 41), UINT8_C(  5), UINT8_C( 44), UINT8_C(205), UINT8_C(242), UINT8_C( 16),
+        UINT8_C( 64), UINT8_C(161), UINT8_C(242), UINT8_C( 95), UINT8_C(151), UINT8_C(198), UINT8_C(  8), UINT8_C(155),
+        UINT8_C( 32), UINT8_C(123), UINT8_C(194), UINT8_C(202), UINT8_C(145), UINT8_C(188), UINT8_C(147), UINT8_C( 36),
+        UINT8_C(236), UINT8_C( 68), UINT8_C(186), UINT8_C(107), UINT8_C( 46), UINT8_C(131), UINT8_C( 80), UINT8_C(163),
+        UINT8_C( 66), UINT8_C(121), UINT8_C(110), UINT8_C( 89), UINT8_C(131), UINT8_C(207), UINT8_C(  4), UINT8_C( 90) },
+      { { UINT8_C(253), UINT8_C(185), UINT8_C( 92), UINT8_C( 26), UINT8_C( 24), UINT8_C(166), UINT8_C( 73), UINT8_C( 80),
+          UINT8_C(233), UINT8_C(164), UINT8_C(123), UINT8_C(103), UINT8_C(224), UINT8_C(  3), UINT8_C(238), UINT8_C( 44) },
+        { UINT8_C( 28), UINT8_C(240), UINT8_C(120), UINT8_C(173), UINT8_C(144), UINT8_C( 27), UINT8_C(144), UINT8_C(  8),
+          UINT8_C(229), UINT8_C( 62), UINT8_C( 41), UINT8_C(  5), UINT8_C( 44), UINT8_C(205), UINT8_C(242), UINT8_C( 16) },
+        { UINT8_C( 64), UINT8_C(161), UINT8_C(242), UINT8_C( 95), UINT8_C(151), UINT8_C(198), UINT8_C(  8), UINT8_C(155),
+          UINT8_C( 32), UINT8_C(123), UINT8_C(194), UINT8_C(202), UINT8_C(145), UINT8_C(188), UINT8_C(147), UINT8_C( 36) },
+        { UINT8_C(236), UINT8_C( 68), UINT8_C(186), UINT8_C(107), UINT8_C( 46), UINT8_C(131), UINT8_C( 80), UINT8_C(163),
+          UINT8_C( 66), UINT8_C(121), UINT8_C(110), UINT8_C( 89), UINT8_C(131), UINT8_C(207), UINT8_C(  4), UINT8_C( 90) } } },
+    { { UINT8_C(214), UINT8_C( 20), UINT8_C( 14), UINT8_C(103), UINT8_C( 68), UINT8_C(194), UINT8_C( 28), UINT8_C(232),
+        UINT8_C(234), UINT8_C(185), UINT8_C(124), UINT8_C(199), UINT8_C( 17), UINT8_C(241), UINT8_C(137), UINT8_C(206),
+        UINT8_C(156), UINT8_C( 23), UINT8_C( 85), UINT8_C(236), UINT8_C(166), UINT8_C(178), UINT8_C( 47), UINT8_C(187),
+        UINT8_C(144), UINT8_C(116), UINT8_C(202), UINT8_C(246), UINT8_C(138), UINT8_C(139), UINT8_C(251), UINT8_C(107),
+        UINT8_C(231), UINT8_C( 63), UINT8_C(207), UINT8_C(127), UINT8_C(237), UINT8_C( 59), UINT8_C( 56), UINT8_C(225),
+        UINT8_C( 18), UINT8_C( 81), UINT8_C( 78), UINT8_C(201), UINT8_C(222), UINT8_C(  4), UINT8_C(223), UINT8_C(224),
+        UINT8_C(254), UINT8_C(153), UINT8_C( 66), UINT8_C(112), UINT8_C( 63), UINT8_C(205), UINT8_C(170), UINT8_C( 40),
+        UINT8_C(150), UINT8_C( 38), UINT8_C( 42), UINT8_C(210), UINT8_C(111), UINT8_C(180), UINT8_C(201), UINT8_C(120) },
+      { { UINT8_C(214), UINT8_C( 20), UINT8_C( 14), UINT8_C(103), UINT8_C( 68), UINT8_C(194), UINT8_C( 28), UINT8_C(232),
+          UINT8_C(234), UINT8_C(185), UINT8_C(124), UINT8_C(199), UINT8_C( 17), UINT8_C(241), UINT8_C(137), UINT8_C(206) },
+        { UINT8_C(156), UINT8_C( 23), UINT8_C( 85), UINT8_C(236), UINT8_C(166), UINT8_C(178), UINT8_C( 47), UINT8_C(187),
+          UINT8_C(144), UINT8_C(116), UINT8_C(202), UINT8_C(246), UINT8_C(138), UINT8_C(139), UINT8_C(251), UINT8_C(107) },
+        { UINT8_C(231), UINT8_C( 63), UINT8_C(207), UINT8_C(127), UINT8_C(237), UINT8_C( 59), UINT8_C( 56), UINT8_C(225),
+          UINT8_C( 18), UINT8_C( 81), UINT8_C( 78), UINT8_C(201), UINT8_C(222), UINT8_C(  4), UINT8_C(223), UINT8_C(224) },
+        { UINT8_C(254), UINT8_C(153), UINT8_C( 66), UINT8_C(112), UINT8_C( 63), UINT8_C(205), UINT8_C(170), UINT8_C( 40),
+          UINT8_C(150), UINT8_C( 38), UINT8_C( 42), UINT8_C(210), UINT8_C(111), UINT8_C(180), UINT8_C(201), UINT8_C(120) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x4_t r = simde_vld1q_u8_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[3], simde_vld1q_u8(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[64];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x16x4_t r = simde_vld1q_u8_x4(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[32];
+    uint16_t r[4][8];
+  } test_vec[] = {
+    { { UINT16_C(51131), UINT16_C(17475), UINT16_C(18398), UINT16_C(54427), UINT16_C(26441), UINT16_C( 4991), UINT16_C(45131), UINT16_C(41601),
+        UINT16_C(54660), UINT16_C(62689), UINT16_C(54339), UINT16_C(46455), UINT16_C(16155), UINT16_C(20252), UINT16_C(57849), UINT16_C(13544),
+        UINT16_C(55070), UINT16_C(43593), UINT16_C( 1621), UINT16_C(13354), UINT16_C( 9374), UINT16_C( 3157), UINT16_C(48675), UINT16_C(60966),
+        UINT16_C(40747), UINT16_C(  558), UINT16_C(14605), UINT16_C(44396), UINT16_C(19915), UINT16_C(44680), UINT16_C(23947), UINT16_C(19464) },
+      { { UINT16_C(51131), UINT16_C(17475), UINT16_C(18398), UINT16_C(54427), UINT16_C(26441), UINT16_C( 4991), UINT16_C(45131), UINT16_C(41601) },
+        { UINT16_C(54660), UINT16_C(62689), UINT16_C(54339), UINT16_C(46455), UINT16_C(16155), UINT16_C(20252), UINT16_C(57849), UINT16_C(13544) },
+        { UINT16_C(55070), UINT16_C(43593), UINT16_C( 1621), UINT16_C(13354), UINT16_C( 9374), UINT16_C( 3157), UINT16_C(48675), UINT16_C(60966) },
+        { UINT16_C(40747), UINT16_C(  558), UINT16_C(14605), UINT16_C(44396), UINT16_C(19915), UINT16_C(44680), UINT16_C(23947), UINT16_C(19464) } } },
+    { { UINT16_C(51764), UINT16_C(19051), UINT16_C(52743), UINT16_C(63220), UINT16_C(49841), UINT16_C(42081), UINT16_C(36758), UINT16_C(  700),
+        UINT16_C(21414), UINT16_C(42577), UINT16_C(19457), UINT16_C(64994), UINT16_C(48432), UINT16_C(49849), UINT16_C(17373), UINT16_C( 9745),
+        UINT16_C(40979), UINT16_C(31638), UINT16_C(32385), UINT16_C(41474), UINT16_C(59806), UINT16_C(18948), UINT16_C(50655), UINT16_C(13898),
+        UINT16_C( 8046), UINT16_C(29936), UINT16_C(46394), UINT16_C( 8338), UINT16_C( 9279), UINT16_C(10622), UINT16_C(63669), UINT16_C( 9408) },
+      { { UINT16_C(51764), UINT16_C(19051), UINT16_C(52743), UINT16_C(63220), UINT16_C(49841), UINT16_C(42081), UINT16_C(36758), UINT16_C(  700) },
+        { UINT16_C(21414), UINT16_C(42577), UINT16_C(19457), UINT16_C(64994), UINT16_C(48432), UINT16_C(49849), UINT16_C(17373), UINT16_C( 9745) },
+        { UINT16_C(40979), UINT16_C(31638), UINT16_C(32385), UINT16_C(41474), UINT16_C(59806), UINT16_C(18948), UINT16_C(50655), UINT16_C(13898) },
+        { UINT16_C( 8046), UINT16_C(29936), UINT16_C(46394), UINT16_C( 8338), UINT16_C( 9279), UINT16_C(10622), UINT16_C(63669), UINT16_C( 9408) } } },
+    { { UINT16_C(43196), UINT16_C(30214), UINT16_C(36824), UINT16_C(25845), UINT16_C(11451), UINT16_C(46792), UINT16_C(35621), UINT16_C(36955),
+        UINT16_C(11544), UINT16_C(35476), UINT16_C(53352), UINT16_C(64589), UINT16_C(62958), UINT16_C(41938), UINT16_C(41486), UINT16_C(  769),
+        UINT16_C(34820), UINT16_C(34171), UINT16_C(13595), UINT16_C(16302), UINT16_C( 3590), UINT16_C(60599), UINT16_C(52026), UINT16_C(20403),
+        UINT16_C(24924), UINT16_C(31964), UINT16_C(60709), UINT16_C(45110), UINT16_C(49273), UINT16_C(36973), UINT16_C(53130), UINT16_C(20052) },
+      { { UINT16_C(43196), UINT16_C(30214), UINT16_C(36824), UINT16_C(25845), UINT16_C(11451), UINT16_C(46792), UINT16_C(35621), UINT16_C(36955) },
+        { UINT16_C(11544), UINT16_C(35476), UINT16_C(53352), UINT16_C(64589), UINT16_C(62958), UINT16_C(41938), UINT16_C(41486), UINT16_C(  769) },
+        { UINT16_C(34820), UINT16_C(34171), UINT16_C(13595), UINT16_C(16302), UINT16_C( 3590), UINT16_C(60599), UINT16_C(52026), UINT16_C(20403) },
+        { UINT16_C(24924), UINT16_C(31964), UINT16_C(60709), UINT16_C(45110), UINT16_C(49273), UINT16_C(36973), UINT16_C(53130), UINT16_C(20052) } } },
+    { { UINT16_C(41561), UINT16_C(27851), UINT16_C(31214), UINT16_C(15079), UINT16_C(  540), UINT16_C(59387), UINT16_C(21357), UINT16_C(16836),
+        UINT16_C( 6392), UINT16_C( 2410), UINT16_C(55953), UINT16_C(  919), UINT16_C(14803), UINT16_C(31424), UINT16_C(45522), UINT16_C(40360),
+        UINT16_C(63984), UINT16_C( 5568), UINT16_C(  267), UINT16_C(55503), UINT16_C( 3134), UINT16_C(14404), UINT16_C(55399), UINT16_C( 6970),
+        UINT16_C(58529), UINT16_C(13801), UINT16_C(45777), UINT16_C(50805), UINT16_C(49353), UINT16_C(54175), UINT16_C(59433), UINT16_C(38998) },
+      { { UINT16_C(41561), UINT16_C(27851), UINT16_C(31214), UINT16_C(15079), UINT16_C(  540), UINT16_C(59387), UINT16_C(21357), UINT16_C(16836) },
+        { UINT16_C( 6392), UINT16_C( 2410), UINT16_C(55953), UINT16_C(  919), UINT16_C(14803), UINT16_C(31424), UINT16_C(45522), UINT16_C(40360) },
+        { UINT16_C(63984), UINT16_C( 5568), UINT16_C(  267), UINT16_C(55503), UINT16_C( 3134), UINT16_C(14404), UINT16_C(55399), UINT16_C( 6970) },
+        { UINT16_C(58529), UINT16_C(13801), UINT16_C(45777), UINT16_C(50805), UINT16_C(49353), UINT16_C(54175), UINT16_C(59433), UINT16_C(38998) } } },
+    { { UINT16_C(58792), UINT16_C(10375), UINT16_C(28133), UINT16_C(34666), UINT16_C(50293), UINT16_C(47516), UINT16_C(47016), UINT16_C(51506),
+        UINT16_C(  509), UINT16_C( 3335), UINT16_C(58853), UINT16_C(44165), UINT16_C(33790), UINT16_C(33634), UINT16_C(20570), UINT16_C(24681),
+        UINT16_C(46849), UINT16_C(45613), UINT16_C(60195), UINT16_C(39243), UINT16_C(32304), UINT16_C(57160), UINT16_C(61844), UINT16_C(44820),
+        UINT16_C(61286), UINT16_C(59885), UINT16_C(26446), UINT16_C(44021), UINT16_C(19794), UINT16_C(59156), UINT16_C(29568), UINT16_C( 9865) },
+      { { UINT16_C(58792), UINT16_C(10375), UINT16_C(28133), UINT16_C(34666), UINT16_C(50293), UINT16_C(47516), UINT16_C(47016), UINT16_C(51506) },
+        { UINT16_C(  509), UINT16_C( 3335), UINT16_C(58853), UINT16_C(44165), UINT16_C(33790), UINT16_C(33634), UINT16_C(20570), UINT16_C(24681) },
+        { UINT16_C(46849), UINT16_C(45613), UINT16_C(60195), UINT16_C(39243), UINT16_C(32304), UINT16_C(57160), UINT16_C(61844), UINT16_C(44820) },
+        { UINT16_C(61286), UINT16_C(59885), UINT16_C(26446), UINT16_C(44021), UINT16_C(19794), UINT16_C(59156), UINT16_C(29568), UINT16_C( 9865) } } },
+    { { UINT16_C(63078), UINT16_C(25626), UINT16_C(  529), UINT16_C(54834), UINT16_C( 3029), UINT16_C(49315), UINT16_C(49709), UINT16_C(33639),
+        UINT16_C(50656), UINT16_C(59692), UINT16_C( 2529), UINT16_C( 9924), UINT16_C(35240), UINT16_C(54073), UINT16_C(   30), UINT16_C(44672),
+        UINT16_C(49788), UINT16_C(31081), UINT16_C(31981), UINT16_C(17885), UINT16_C(56373), UINT16_C(12748), UINT16_C(63757), UINT16_C(30921),
+        UINT16_C( 4040), UINT16_C(45723), UINT16_C(60661), UINT16_C(28002), UINT16_C(36124), UINT16_C(48350), UINT16_C(19426), UINT16_C(23143) },
+      { { UINT16_C(63078), UINT16_C(25626), UINT16_C(  529), UINT16_C(54834), UINT16_C( 3029), UINT16_C(49315), UINT16_C(49709), UINT16_C(33639) },
+        { UINT16_C(50656), UINT16_C(59692), UINT16_C( 2529), UINT16_C( 9924), UINT16_C(35240), UINT16_C(54073), UINT16_C(   30), UINT16_C(44672) },
+        { UINT16_C(49788), UINT16_C(31081), UINT16_C(31981), UINT16_C(17885), UINT16_C(56373), UINT16_C(12748), UINT16_C(63757), UINT16_C(30921) },
+        { UINT16_C( 4040), UINT16_C(45723), UINT16_C(60661), UINT16_C(28002), UINT16_C(36124), UINT16_C(48350), UINT16_C(19426), UINT16_C(23143) } } },
+    { { UINT16_C(26350), UINT16_C( 6134), UINT16_C(16435), UINT16_C(33322), UINT16_C(45238), UINT16_C( 1284), UINT16_C(55301), UINT16_C(65093),
+        UINT16_C(60012), UINT16_C(17904), UINT16_C(55613), UINT16_C(46000), UINT16_C(11805), UINT16_C(53816), UINT16_C(13782), UINT16_C(13527),
+        UINT16_C(58800), UINT16_C(49336), UINT16_C(12025), UINT16_C(16400), UINT16_C(54312), UINT16_C(50006), UINT16_C(55613), UINT16_C(25532),
+        UINT16_C(35096), UINT16_C(27004), UINT16_C(51599), UINT16_C(56629), UINT16_C(30696), UINT16_C(14402), UINT16_C(38725), UINT16_C(37026) },
+      { { UINT16_C(26350), UINT16_C( 6134), UINT16_C(16435), UINT16_C(33322), UINT16_C(45238), UINT16_C( 1284), UINT16_C(55301), UINT16_C(65093) },
+        { UINT16_C(60012), UINT16_C(17904), UINT16_C(55613), UINT16_C(46000), UINT16_C(11805), UINT16_C(53816), UINT16_C(13782), UINT16_C(13527) },
+        { UINT16_C(58800), UINT16_C(49336), UINT16_C(12025), UINT16_C(16400), UINT16_C(54312), UINT16_C(50006), UINT16_C(55613), UINT16_C(25532) },
+        { UINT16_C(35096), UINT16_C(27004), UINT16_C(51599), UINT16_C(56629), UINT16_C(30696), UINT16_C(14402), UINT16_C(38725), UINT16_C(37026) } } },
+    { { UINT16_C(22943), UINT16_C(12568), UINT16_C(21799), UINT16_C(  350), UINT16_C(57136), UINT16_C(31027), UINT16_C(61558), UINT16_C(40569),
+        UINT16_C(27427), UINT16_C(47114), UINT16_C(49458), UINT16_C( 1098), UINT16_C( 2646), UINT16_C( 9523), UINT16_C(56444), UINT16_C( 4574),
+        UINT16_C(46144), UINT16_C(53324), UINT16_C(39644), UINT16_C(37964), UINT16_C(47726), UINT16_C(61822), UINT16_C(56425), UINT16_C(39278),
+        UINT16_C(36219), UINT16_C(50863), UINT16_C( 3895), UINT16_C( 4554), UINT16_C(44109), UINT16_C(23450), UINT16_C(27009), UINT16_C(  242) },
+      { { UINT16_C(22943), UINT16_C(12568), UINT16_C(21799), UINT16_C(  350), UINT16_C(57136), UINT16_C(31027), UINT16_C(61558), UINT16_C(40569) },
+        { UINT16_C(27427), UINT16_C(47114), UINT16_C(49458), UINT16_C( 1098), UINT16_C( 2646), UINT16_C( 9523), UINT16_C(56444), UINT16_C( 4574) },
+        { UINT16_C(46144), UINT16_C(53324), UINT16_C(39644), UINT16_C(37964), UINT16_C(47726), UINT16_C(61822), UINT16_C(56425), UINT16_C(39278) },
+        { UINT16_C(36219), UINT16_C(50863), UINT16_C( 3895), UINT16_C( 4554), UINT16_C(44109), UINT16_C(23450), UINT16_C(27009), UINT16_C(  242) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x4_t r = simde_vld1q_u16_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[2], simde_vld1q_u16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[3], simde_vld1q_u16(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a[32];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint16x8x4_t r = simde_vld1q_u16_x4(a);
+
+    simde_test_codegen_write_vu16(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[16];
+    uint32_t r[4][4];
+  } test_vec[] = {
+    { { UINT32_C(3630991664), UINT32_C(1537684688), UINT32_C( 315234765), UINT32_C(3913997838), UINT32_C(2382390338), UINT32_C( 199971418), UINT32_C( 586929967), UINT32_C(2776199807),
+        UINT32_C(2524412882), UINT32_C(2641034167), UINT32_C( 159236530), UINT32_C(3763047510), UINT32_C(4120205064), UINT32_C( 519706522), UINT32_C(1780651557), UINT32_C(1054384438) },
+      { { UINT32_C(3630991664), UINT32_C(1537684688), UINT32_C( 315234765), UINT32_C(3913997838) },
+        { UINT32_C(2382390338), UINT32_C( 199971418), UINT32_C( 586929967), UINT32_C(2776199807) },
+        { UINT32_C(2524412882), UINT32_C(2641034167), UINT32_C( 159236530), UINT32_C(3763047510) },
+        { UINT32_C(4120205064), UINT32_C( 519706522), UINT32_C(1780651557), UINT32_C(1054384438) } } },
+    { { UINT32_C( 677868971), UINT32_C(3077527538), UINT32_C(3597723684), UINT32_C(3467813303), UINT32_C(3906080169), UINT32_C(3149346677), UINT32_C(3361736919), UINT32_C(1597640532),
+        UINT32_C(3122058480), UINT32_C(3063148590), UINT32_C(2828383478), UINT32_C( 574517745), UINT32_C(3334584350), UINT32_C(2369903789), UINT32_C(2101086554), UINT32_C(2557082896) },
+      { { UINT32_C( 677868971), UINT32_C(3077527538), UINT32_C(3597723684), UINT32_C(3467813303) },
+        { UINT32_C(3906080169), UINT32_C(3149346677), UINT32_C(3361736919), UINT32_C(1597640532) },
+        { UINT32_C(3122058480), UINT32_C(3063148590), UINT32_C(2828383478), UINT32_C( 574517745) },
+        { UINT32_C(3334584350), UINT32_C(2369903789), UINT32_C(2101086554), UINT32_C(2557082896) } } },
+    { { UINT32_C( 257296197), UINT32_C( 274931601), UINT32_C(1157005783), UINT32_C(2650818352), UINT32_C(1434184015), UINT32_C(1792623547), UINT32_C( 651453868), UINT32_C(2081129402),
+        UINT32_C(1127570216), UINT32_C(3154289614), UINT32_C(3086305416), UINT32_C(1522012998), UINT32_C(3774591336), UINT32_C(1213911223), UINT32_C(3200314593), UINT32_C( 711908584) },
+      { { UINT32_C( 257296197), UINT32_C( 274931601), UINT32_C(1157005783), UINT32_C(2650818352) },
+        { UINT32_C(1434184015), UINT32_C(1792623547), UINT32_C( 651453868), UINT32_C(2081129402) },
+        { UINT32_C(1127570216), UINT32_C(3154289614), UINT32_C(3086305416), UINT32_C(1522012998) },
+        { UINT32_C(3774591336), UINT32_C(1213911223), UINT32_C(3200314593), UINT32_C( 711908584) } } },
+    { { UINT32_C( 538375048), UINT32_C(  18869098), UINT32_C( 262541975), UINT32_C(1184937309), UINT32_C(3475657001), UINT32_C(2305383530), UINT32_C(3740712947), UINT32_C(2618062282),
+        UINT32_C(1180303234), UINT32_C( 654465171), UINT32_C(3696447023), UINT32_C(2168974560), UINT32_C(1165399458), UINT32_C( 137269452), UINT32_C(2959579329), UINT32_C(1126690152) },
+      { { UINT32_C( 538375048), UINT32_C(  18869098), UINT32_C( 262541975), UINT32_C(1184937309) },
+        { UINT32_C(3475657001), UINT32_C(2305383530), UINT32_C(3740712947), UINT32_C(2618062282) },
+        { UINT32_C(1180303234), UINT32_C( 654465171), UINT32_C(3696447023), UINT32_C(2168974560) },
+        { UINT32_C(1165399458), UINT32_C( 137269452), UINT32_C(2959579329), UINT32_C(1126690152) } } },
+    { { UINT32_C(3690743447), UINT32_C(3009734484), UINT32_C( 170540635), UINT32_C(2499504873), UINT32_C(4241433492), UINT32_C(2605169492), UINT32_C(3952007136), UINT32_C(4060863723),
+        UINT32_C(4252548470), UINT32_C(1498452761), UINT32_C(2723497376), UINT32_C(4005689194), UINT32_C( 727326007), UINT32_C( 426253966), UINT32_C(1480404746), UINT32_C(3293893701) },
+      { { UINT32_C(3690743447), UINT32_C(3009734484), UINT32_C( 170540635), UINT32_C(2499504873) },
+        { UINT32_C(4241433492), UINT32_C(2605169492), UINT32_C(3952007136), UINT32_C(4060863723) },
+        { UINT32_C(4252548470), UINT32_C(1498452761), UINT32_C(2723497376), UINT32_C(4005689194) },
+        { UINT32_C( 727326007), UINT32_C( 426253966), UINT32_C(1480404746), UINT32_C(3293893701) } } },
+    { { UINT32_C(3279351181), UINT32_C(4226852370), UINT32_C(2413126811), UINT32_C(2905788784), UINT32_C(1258818313), UINT32_C(3661272150), UINT32_C(4265251117), UINT32_C(1992692654),
+        UINT32_C(2379240098), UINT32_C( 951667736), UINT32_C(1498801478), UINT32_C(2137831059), UINT32_C(2397743592), UINT32_C(3651870237), UINT32_C(1391622677), UINT32_C(3787643134) },
+      { { UINT32_C(3279351181), UINT32_C(4226852370), UINT32_C(2413126811), UINT32_C(2905788784) },
+        { UINT32_C(1258818313), UINT32_C(3661272150), UINT32_C(4265251117), UINT32_C(1992692654) },
+        { UINT32_C(2379240098), UINT32_C( 951667736), UINT32_C(1498801478), UINT32_C(2137831059) },
+        { UINT32_C(2397743592), UINT32_C(3651870237), UINT32_C(1391622677), UINT32_C(3787643134) } } },
+    { { UINT32_C(2198860351), UINT32_C( 602511814), UINT32_C(1248636827), UINT32_C(2704731043), UINT32_C(4029938243), UINT32_C(3756709785), UINT32_C( 834833887), UINT32_C(3674116133),
+        UINT32_C(2045786168), UINT32_C(2375536308), UINT32_C(3988776998), UINT32_C(4155332743), UINT32_C(3525106955), UINT32_C(4255025637), UINT32_C(4221309145), UINT32_C(  14401693) },
+      { { UINT32_C(2198860351), UINT32_C( 602511814), UINT32_C(1248636827), UINT32_C(2704731043) },
+        { UINT32_C(4029938243), UINT32_C(3756709785), UINT32_C( 834833887), UINT32_C(3674116133) },
+        { UINT32_C(2045786168), UINT32_C(2375536308), UINT32_C(3988776998), UINT32_C(4155332743) },
+        { UINT32_C(3525106955), UINT32_C(4255025637), UINT32_C(4221309145), UINT32_C(  14401693) } } },
+    { { UINT32_C(1300125858), UINT32_C(3991482655), UINT32_C(1865291495), UINT32_C( 776976416), UINT32_C( 233622884), UINT32_C(3320231507), UINT32_C( 480725062), UINT32_C(2840536601),
+        UINT32_C(3417014482), UINT32_C(1297804497), UINT32_C( 819365232), UINT32_C(3047619026), UINT32_C( 164911673), UINT32_C(  51822816), UINT32_C(3406851175), UINT32_C(1744389744) },
+      { { UINT32_C(1300125858), UINT32_C(3991482655), UINT32_C(1865291495), UINT32_C( 776976416) },
+        { UINT32_C( 233622884), UINT32_C(3320231507), UINT32_C( 480725062), UINT32_C(2840536601) },
+        { UINT32_C(3417014482), UINT32_C(1297804497), UINT32_C( 819365232), UINT32_C(3047619026) },
+        { UINT32_C( 164911673), UINT32_C(  51822816), UINT32_C(3406851175), UINT32_C(1744389744) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x4_t r = simde_vld1q_u32_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[3], simde_vld1q_u32(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x4x4_t r = simde_vld1q_u32_x4(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld1q_u64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[8];
+    uint64_t r[4][2];
+  } test_vec[] = {
+    { { UINT64_C( 9468929620329017953), UINT64_C(12162385369966112723), UINT64_C(  356024234024452106), UINT64_C( 8009208327571708148),
+        UINT64_C(  731471831423732284), UINT64_C( 2276135800507255906), UINT64_C(15461402479303040085), UINT64_C( 4134038767304560563) },
+      { { UINT64_C( 9468929620329017953), UINT64_C(12162385369966112723) },
+        { UINT64_C(  356024234024452106), UINT64_C( 8009208327571708148) },
+        { UINT64_C(  731471831423732284), UINT64_C( 2276135800507255906) },
+        { UINT64_C(15461402479303040085), UINT64_C( 4134038767304560563) } } },
+    { { UINT64_C(12358920617050759082), UINT64_C( 1536071201421952308), UINT64_C( 2054683386076504820), UINT64_C(  900848827403512492),
+        UINT64_C(   21085587872302669), UINT64_C( 9121156417365807441), UINT64_C(11844957722017372981), UINT64_C( 8690796524020742921) },
+      { { UINT64_C(12358920617050759082), UINT64_C( 1536071201421952308) },
+        { UINT64_C( 2054683386076504820), UINT64_C(  900848827403512492) },
+        { UINT64_C(   21085587872302669), UINT64_C( 9121156417365807441) },
+        { UINT64_C(11844957722017372981), UINT64_C( 8690796524020742921) } } },
+    { { UINT64_C(  903983455951948180), UINT64_C( 2577514455423195422), UINT64_C(11962321952139828968), UINT64_C(18243673901417969493),
+        UINT64_C(  287931454468779789), UINT64_C( 1720879332647253845), UINT64_C( 2878305596856707905), UINT64_C( 5161345646736074718) },
+      { { UINT64_C(  903983455951948180), UINT64_C( 2577514455423195422) },
+        { UINT64_C(11962321952139828968), UINT64_C(18243673901417969493) },
+        { UINT64_C(  287931454468779789), UINT64_C( 1720879332647253845) },
+        { UINT64_C( 2878305596856707905), UINT64_C( 5161345646736074718) } } },
+    { { UINT64_C( 1560294136289850019), UINT64_C(   13514930702738262), UINT64_C(16060634233949039896), UINT64_C( 1467960690165254022),
+        UINT64_C(14545320823582983626), UINT64_C( 5696519941508105598), UINT64_C(17647127236725590678), UINT64_C( 5513359476611331362) },
+      { { UINT64_C( 1560294136289850019), UINT64_C(   13514930702738262) },
+        { UINT64_C(16060634233949039896), UINT64_C( 1467960690165254022) },
+        { UINT64_C(14545320823582983626), UINT64_C( 5696519941508105598) },
+        { UINT64_C(17647127236725590678), UINT64_C( 5513359476611331362) } } },
+    { { UINT64_C(13617696171039539056), UINT64_C(18402386719326197805), UINT64_C( 7500833078222248185), UINT64_C( 2373680745838554438),
+        UINT64_C(18317377996049849944), UINT64_C(14253606465937230721), UINT64_C( 8513894272268160186), UINT64_C(14925542795876282405) },
+      { { UINT64_C(13617696171039539056), UINT64_C(18402386719326197805) },
+        { UINT64_C( 7500833078222248185), UINT64_C( 2373680745838554438) },
+        { UINT64_C(18317377996049849944), UINT64_C(14253606465937230721) },
+        { UINT64_C( 8513894272268160186), UINT64_C(14925542795876282405) } } },
+    { { UINT64_C(12883263937814311750), UINT64_C(18248723389925430573), UINT64_C(  137303811979118577), UINT64_C( 4848110226228177987),
+        UINT64_C(   38243114181456561), UINT64_C(14680190784883314420), UINT64_C( 2142240556794664497), UINT64_C(  635931707957748397) },
+      { { UINT64_C(12883263937814311750), UINT64_C(18248723389925430573) },
+        { UINT64_C(  137303811979118577), UINT64_C( 4848110226228177987) },
+        { UINT64_C(   38243114181456561), UINT64_C(14680190784883314420) },
+        { UINT64_C( 2142240556794664497), UINT64_C(  635931707957748397) } } },
+    { { UINT64_C(11547361654992720239), UINT64_C(16337915005456920592), UINT64_C(10262233824540972469), UINT64_C( 8758230639086144153),
+        UINT64_C( 6151765086217026651), UINT64_C(11297021710746325309), UINT64_C(15933454110948332499), UINT64_C(17747920626563207987) },
+      { { UINT64_C(11547361654992720239), UINT64_C(16337915005456920592) },
+        { UINT64_C(10262233824540972469), UINT64_C( 8758230639086144153) },
+        { UINT64_C( 6151765086217026651), UINT64_C(11297021710746325309) },
+        { UINT64_C(15933454110948332499), UINT64_C(17747920626563207987) } } },
+    { { UINT64_C(11888744215223292539), UINT64_C(14689012204896471518), UINT64_C( 5506022967746752452), UINT64_C( 7149517299884304340),
+        UINT64_C(14589227647320044140), UINT64_C(12187857502772104375), UINT64_C(13221905217107384425), UINT64_C(13581774873230414210) },
+      { { UINT64_C(11888744215223292539), UINT64_C(14689012204896471518) },
+        { UINT64_C( 5506022967746752452), UINT64_C( 7149517299884304340) },
+        { UINT64_C(14589227647320044140), UINT64_C(12187857502772104375) },
+        { UINT64_C(13221905217107384425), UINT64_C(13581774873230414210) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x4_t r = simde_vld1q_u64_x4(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[3], simde_vld1q_u64(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x2x4_t r = simde_vld1q_u64_x4(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_f32_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_f64_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s8_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s16_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s32_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_s64_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u8_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u16_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u32_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1_u64_x4)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_f32_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_f64_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s8_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s16_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s32_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_s64_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u8_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u16_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u32_x4)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld1q_u64_x4)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1203 @@
+#define SIMDE_TEST_ARM_NEON_INSN qrshrn_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qrshrn_n.h"
+
+static int
+test_simde_vqrshrnh_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a;
+    int8_t r1;
+    int8_t r3;
+    int8_t r5;
+    int8_t r6;
+    int8_t r8;
+  } test_vec[] = {
+    {        INT16_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN },
+    {        INT16_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX },
+    {  INT16_C( 26438),
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+       INT8_C( 103) },
+    { -INT16_C(  5888),
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+      -INT8_C(  92),
+      -INT8_C(  23) },
+    {  INT16_C(    59),
+       INT8_C(  30),
+       INT8_C(   7),
+       INT8_C(   2),
+       INT8_C(   1),
+       INT8_C(   0) },
+    {  INT16_C(  3430),
+           INT8_MAX,
+           INT8_MAX,
+       INT8_C( 107),
+       INT8_C(  54),
+       INT8_C(  13) },
+    { -INT16_C( 21826),
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+      -INT8_C(  85) },
+    { -INT16_C(   162),
+      -INT8_C(  81),
+      -INT8_C(  20),
+      -INT8_C(   5),
+      -INT8_C(   3),
+      -INT8_C(   1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int8_t r1 = simde_vqrshrnh_n_s16(test_vec[i].a, 1);
+    int8_t r3 = simde_vqrshrnh_n_s16(test_vec[i].a, 3);
+    int8_t r5 = simde_vqrshrnh_n_s16(test_vec[i].a, 5);
+    int8_t r6 = simde_vqrshrnh_n_s16(test_vec[i].a, 6);
+    int8_t r8 = simde_vqrshrnh_n_s16(test_vec[i].a, 8);
+
+    simde_assert_equal_i8(r1, test_vec[i].r1);
+    simde_assert_equal_i8(r3, test_vec[i].r3);
+    simde_assert_equal_i8(r5, test_vec[i].r5);
+    simde_assert_equal_i8(r6, test_vec[i].r6);
+    simde_assert_equal_i8(r8, test_vec[i].r8);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a = simde_test_codegen_random_i16();
+    int8_t r1 = simde_vqrshrnh_n_s16(a, 1);
+    int8_t r3 = simde_vqrshrnh_n_s16(a, 3);
+    int8_t r5 = simde_vqrshrnh_n_s16(a, 5);
+    int8_t r6 = simde_vqrshrnh_n_s16(a, 6);
+    int8_t r8 = simde_vqrshrnh_n_s16(a, 8);
+
+    simde_test_codegen_write_i16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrns_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a;
+    int16_t r1;
+    int16_t r6;
+    int16_t r10;
+    int16_t r13;
+    int16_t r16;
+  } test_vec[] = {
+    {              INT32_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN },
+    {              INT32_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX },
+    {  INT32_C(   548199480),
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+       INT16_C(  8365) },
+    {  INT32_C(   809721414),
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+       INT16_C( 12355) },
+    { -INT32_C(   391585957),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C(  5975) },
+    { -INT32_C(   811454452),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C( 12382) },
+    {  INT32_C(  1718648558),
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+       INT16_C( 26224) },
+    { -INT32_C(   680975387),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C( 10391) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int16_t r1 = simde_vqrshrns_n_s32(test_vec[i].a, 1);
+    int16_t r6 = simde_vqrshrns_n_s32(test_vec[i].a, 6);
+    int16_t r10 = simde_vqrshrns_n_s32(test_vec[i].a, 10);
+    int16_t r13 = simde_vqrshrns_n_s32(test_vec[i].a, 13);
+    int16_t r16 = simde_vqrshrns_n_s32(test_vec[i].a, 16);
+
+    simde_assert_equal_i16(r1, test_vec[i].r1);
+    simde_assert_equal_i16(r6, test_vec[i].r6);
+    simde_assert_equal_i16(r10, test_vec[i].r10);
+    simde_assert_equal_i16(r13, test_vec[i].r13);
+    simde_assert_equal_i16(r16, test_vec[i].r16);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a = simde_test_codegen_random_i32();
+    int16_t r1 = simde_vqrshrns_n_s32(a, 1);
+    int16_t r6 = simde_vqrshrns_n_s32(a, 6);
+    int16_t r10 = simde_vqrshrns_n_s32(a, 10);
+    int16_t r13 = simde_vqrshrns_n_s32(a, 13);
+    int16_t r16 = simde_vqrshrns_n_s32(a, 16);
+
+    simde_test_codegen_write_i32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrnd_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    int32_t r1;
+    int32_t r13;
+    int32_t r19;
+    int32_t r26;
+    int32_t r32;
+  } test_vec[] = {
+    {                      INT64_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN },
+    {                      INT64_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX },
+    {  INT64_C( 5601435556456214871),
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+       INT32_C(  1304185846) },
+    { -INT64_C( 1000463963820132834),
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+      -INT32_C(   232938669) },
+    { -INT64_C(  522081662535844245),
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+      -INT32_C(   121556610) },
+    {  INT64_C( 5896352544953122567),
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+       INT32_C(  1372851558) },
+    { -INT64_C( 3318363033292008461),
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+      -INT32_C(   772616601) },
+    {  INT64_C( 6084340733248869181),
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+       INT32_C(  1416620969) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r1 = simde_vqrshrnd_n_s64(test_vec[i].a, 1);
+    int32_t r13 = simde_vqrshrnd_n_s64(test_vec[i].a, 13);
+    int32_t r19 = simde_vqrshrnd_n_s64(test_vec[i].a, 19);
+    int32_t r26 = simde_vqrshrnd_n_s64(test_vec[i].a, 26);
+    int32_t r32 = simde_vqrshrnd_n_s64(test_vec[i].a, 32);
+
+    simde_assert_equal_i32(r1, test_vec[i].r1);
+    simde_assert_equal_i32(r13, test_vec[i].r13);
+    simde_assert_equal_i32(r19, test_vec[i].r19);
+    simde_assert_equal_i32(r26, test_vec[i].r26);
+    simde_assert_equal_i32(r32, test_vec[i].r32);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    int32_t r1 = simde_vqrshrnd_n_s64(a, 1);
+    int32_t r13 = simde_vqrshrnd_n_s64(a, 13);
+    int32_t r19 = simde_vqrshrnd_n_s64(a, 19);
+    int32_t r26 = simde_vqrshrnd_n_s64(a, 26);
+    int32_t r32 = simde_vqrshrnd_n_s64(a, 32);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrnh_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a;
+    uint8_t r1;
+    uint8_t r3;
+    uint8_t r5;
+    uint8_t r6;
+    uint8_t r8;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    {      UINT16_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX },
+    { UINT16_C(29860),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(117) },
+    { UINT16_C(33709),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(132) },
+    { UINT16_C(28259),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(110) },
+    { UINT16_C(29774),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(116) },
+    { UINT16_C(46119),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(180) },
+    { UINT16_C(49242),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(192) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint8_t r1 = simde_vqrshrnh_n_u16(test_vec[i].a, 1);
+    uint8_t r3 = simde_vqrshrnh_n_u16(test_vec[i].a, 3);
+    uint8_t r5 = simde_vqrshrnh_n_u16(test_vec[i].a, 5);
+    uint8_t r6 = simde_vqrshrnh_n_u16(test_vec[i].a, 6);
+    uint8_t r8 = simde_vqrshrnh_n_u16(test_vec[i].a, 8);
+
+    simde_assert_equal_u8(r1, test_vec[i].r1);
+    simde_assert_equal_u8(r3, test_vec[i].r3);
+    simde_assert_equal_u8(r5, test_vec[i].r5);
+    simde_assert_equal_u8(r6, test_vec[i].r6);
+    simde_assert_equal_u8(r8, test_vec[i].r8);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a = simde_test_codegen_random_u16();
+    uint8_t r1 = simde_vqrshrnh_n_u16(a, 1);
+    uint8_t r3 = simde_vqrshrnh_n_u16(a, 3);
+    uint8_t r5 = simde_vqrshrnh_n_u16(a, 5);
+    uint8_t r6 = simde_vqrshrnh_n_u16(a, 6);
+    uint8_t r8 = simde_vqrshrnh_n_u16(a, 8);
+
+    simde_test_codegen_write_u16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrns_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a;
+    uint16_t r1;
+    uint16_t r6;
+    uint16_t r10;
+    uint16_t r13;
+    uint16_t r16;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {           UINT32_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX },
+    { UINT32_C(3754856146),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(57295) },
+    { UINT32_C(4045474465),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(61729) },
+    { UINT32_C( 601228251),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C( 9174) },
+    { UINT32_C(4111964419),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(62744) },
+    { UINT32_C(2396630825),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(36570) },
+    { UINT32_C(3838172987),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(58566) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint16_t r1 = simde_vqrshrns_n_u32(test_vec[i].a, 1);
+    uint16_t r6 = simde_vqrshrns_n_u32(test_vec[i].a, 6);
+    uint16_t r10 = simde_vqrshrns_n_u32(test_vec[i].a, 10);
+    uint16_t r13 = simde_vqrshrns_n_u32(test_vec[i].a, 13);
+    uint16_t r16 = simde_vqrshrns_n_u32(test_vec[i].a, 16);
+
+    simde_assert_equal_u16(r1, test_vec[i].r1);
+    simde_assert_equal_u16(r6, test_vec[i].r6);
+    simde_assert_equal_u16(r10, test_vec[i].r10);
+    simde_assert_equal_u16(r13, test_vec[i].r13);
+    simde_assert_equal_u16(r16, test_vec[i].r16);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint16_t r1 = simde_vqrshrns_n_u32(a, 1);
+    uint16_t r6 = simde_vqrshrns_n_u32(a, 6);
+    uint16_t r10 = simde_vqrshrns_n_u32(a, 10);
+    uint16_t r13 = simde_vqrshrns_n_u32(a, 13);
+    uint16_t r16 = simde_vqrshrns_n_u32(a, 16);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrnd_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a;
+    uint32_t r1;
+    uint32_t r13;
+    uint32_t r19;
+    uint32_t r26;
+    uint32_t r32;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {                     UINT64_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX },
+    { UINT64_C( 1310390701150009689),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 305099110) },
+    { UINT64_C(15066324068612339239),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(3507901930) },
+    { UINT64_C( 7080974041778580737),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1648667744) },
+    { UINT64_C( 1924212364807237153),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 448015603) },
+    { UINT64_C( 4361115810294818313),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1015401401) },
+    { UINT64_C(  483687756185641519),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 112617332) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r1 = simde_vqrshrnd_n_u64(test_vec[i].a, 1);
+    uint32_t r13 = simde_vqrshrnd_n_u64(test_vec[i].a, 13);
+    uint32_t r19 = simde_vqrshrnd_n_u64(test_vec[i].a, 19);
+    uint32_t r26 = simde_vqrshrnd_n_u64(test_vec[i].a, 26);
+    uint32_t r32 = simde_vqrshrnd_n_u64(test_vec[i].a, 32);
+
+    simde_assert_equal_u32(r1, test_vec[i].r1);
+    simde_assert_equal_u32(r13, test_vec[i].r13);
+    simde_assert_equal_u32(r19, test_vec[i].r19);
+    simde_assert_equal_u32(r26, test_vec[i].r26);
+    simde_assert_equal_u32(r32, test_vec[i].r32);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint32_t r1 = simde_vqrshrnd_n_u64(a, 1);
+    uint32_t r13 = simde_vqrshrnd_n_u64(a, 13);
+    uint32_t r19 = simde_vqrshrnd_n_u64(a, 19);
+    uint32_t r26 = simde_vqrshrnd_n_u64(a, 26);
+    uint32_t r32 = simde_vqrshrnd_n_u64(a, 32);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrn_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int8_t r1[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r6[8];
+    int8_t r8[8];
+  } test_vec[] = {
+    { {        INT16_MIN,        INT16_MAX, -INT16_C(  6197),  INT16_C( 11655),  INT16_C(  7076), -INT16_C( 20921),  INT16_C( 10174), -INT16_C(   186) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX, -INT8_C(  93) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX, -INT8_C(  23) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX, -INT8_C(   6) },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(  97),      INT8_MAX,  INT8_C( 111),      INT8_MIN,      INT8_MAX, -INT8_C(   3) },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(  24),  INT8_C(  46),  INT8_C(  28), -INT8_C(  82),  INT8_C(  40), -INT8_C(   1) } },
+    { {  INT16_C(  4274),  INT16_C(  8247),  INT16_C( 19454),  INT16_C(  1480), -INT16_C( 14245),  INT16_C( 13207),  INT16_C(  5245),  INT16_C( 31835) },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,  INT8_C(  46),      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT8_C(  67),      INT8_MAX,      INT8_MAX,  INT8_C(  23),      INT8_MIN,      INT8_MAX,  INT8_C(  82),      INT8_MAX },
+      {  INT8_C(  17),  INT8_C(  32),  INT8_C(  76),  INT8_C(   6), -INT8_C(  56),  INT8_C(  52),  INT8_C(  20),  INT8_C( 124) } },
+    { { -INT16_C( 25659),  INT16_C(  5541), -INT16_C(  6746), -INT16_C( 24079),  INT16_C( 15155), -INT16_C(  7542), -INT16_C( 16753), -INT16_C( 20456) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,  INT8_C(  87), -INT8_C( 105),      INT8_MIN,      INT8_MAX, -INT8_C( 118),      INT8_MIN,      INT8_MIN },
+      { -INT8_C( 100),  INT8_C(  22), -INT8_C(  26), -INT8_C(  94),  INT8_C(  59), -INT8_C(  29), -INT8_C(  65), -INT8_C(  80) } },
+    { { -INT16_C( 18130), -INT16_C( 13303), -INT16_C(  2419),  INT16_C( 26656), -INT16_C(  9692),  INT16_C( 10482), -INT16_C( 24344),  INT16_C( 17626) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN, -INT8_C(  76),      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN, -INT8_C(  38),      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      { -INT8_C(  71), -INT8_C(  52), -INT8_C(   9),  INT8_C( 104), -INT8_C(  38),  INT8_C(  41), -INT8_C(  95),  INT8_C(  69) } },
+    { {  INT16_C( 27872),  INT16_C( 18086),  INT16_C( 24117), -INT16_C( 19005),  INT16_C(  8007),  INT16_C(  7591),  INT16_C(  3483),  INT16_C(  9728) },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,  INT8_C( 109),      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C( 125),  INT8_C( 119),  INT8_C(  54),      INT8_MAX },
+      {  INT8_C( 109),  INT8_C(  71),  INT8_C(  94), -INT8_C(  74),  INT8_C(  31),  INT8_C(  30),  INT8_C(  14),  INT8_C(  38) } },
+    { { -INT16_C( 23327),  INT16_C( 24518),  INT16_C( 18570), -INT16_C(  1376),  INT16_C( 10265),  INT16_C( 30510),  INT16_C( 31335), -INT16_C( 21747) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX, -INT8_C(  43),      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX, -INT8_C(  21),      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN },
+      { -INT8_C(  91),  INT8_C(  96),  INT8_C(  73), -INT8_C(   5),  INT8_C(  40),  INT8_C( 119),  INT8_C( 122), -INT8_C(  85) } },
+    { {  INT16_C(  9518), -INT16_C( 12748), -INT16_C( 23888),  INT16_C(  7597), -INT16_C(  3165), -INT16_C(  1726),  INT16_C( 24408),  INT16_C( 17264) },
+      {      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX, -INT8_C(  99), -INT8_C(  54),      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MIN,      INT8_MIN,  INT8_C( 119), -INT8_C(  49), -INT8_C(  27),      INT8_MAX,      INT8_MAX },
+      {  INT8_C(  37), -INT8_C(  50), -INT8_C(  93),  INT8_C(  30), -INT8_C(  12), -INT8_C(   7),  INT8_C(  95),  INT8_C(  67) } },
+    { {  INT16_C(  2163),  INT16_C( 21545),  INT16_C( 10952),  INT16_C( 17442),  INT16_C( 20485), -INT16_C( 15146), -INT16_C(  7341),  INT16_C( 30535) },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX },
+      {  INT8_C(  68),      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX },
+      {  INT8_C(  34),      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN, -INT8_C( 115),      INT8_MAX },
+      {  INT8_C(   8),  INT8_C(  84),  INT8_C(  43),  INT8_C(  68),  INT8_C(  80), -INT8_C(  59), -INT8_C(  29),  INT8_C( 119) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+
+    simde_int8x8_t r1 = simde_vqrshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vqrshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vqrshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vqrshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vqrshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r6, simde_vld1_s8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i8x8(r8, simde_vld1_s8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+
+    simde_int8x8_t r1 = simde_vqrshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vqrshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vqrshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vqrshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vqrshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrn_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int16_t r1[4];
+    int16_t r6[4];
+    int16_t r10[4];
+    int16_t r13[4];
+    int16_t r16[4];
+  } test_vec[] = {
+    { {              INT32_MIN,              INT32_MAX, -INT32_C(  1691766093),  INT32_C(  2014865381) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX, -INT16_C( 25814),  INT16_C( 30744) } },
+    { {  INT32_C(  1704068596), -INT32_C(   182722951),  INT32_C(   409906143),  INT32_C(  1238809935) },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MAX, -INT16_C( 22305),        INT16_MAX,        INT16_MAX },
+      {  INT16_C( 26002), -INT16_C(  2788),  INT16_C(  6255),  INT16_C( 18903) } },
+    { { -INT32_C(   693279667),  INT32_C(    44494096),  INT32_C(   103698748), -INT32_C(  1278867033) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,  INT16_C(  5431),  INT16_C( 12659),        INT16_MIN },
+      { -INT16_C( 10579),  INT16_C(   679),  INT16_C(  1582), -INT16_C( 19514) } },
+    { {  INT32_C(  1117726753),  INT32_C(   326690959), -INT32_C(  1146552015),  INT32_C(  2007388415) },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {  INT16_C( 17055),  INT16_C(  4985), -INT16_C( 17495),  INT16_C( 30630) } },
+    { { -INT32_C(  1318705519), -INT32_C(   685629949),  INT32_C(   797392793), -INT32_C(  1188542261) },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      { -INT16_C( 20122), -INT16_C( 10462),  INT16_C( 12167), -INT16_C( 18136) } },
+    { { -INT32_C(    44344397),  INT32_C(   845548733), -INT32_C(  1487157922), -INT32_C(   441462150) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      { -INT16_C(  5413),        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      { -INT16_C(   677),  INT16_C( 12902), -INT16_C( 22692), -INT16_C(  6736) } },
+    { { -INT32_C(  1337401409),  INT32_C(   400125161),  INT32_C(  1001945654), -INT32_C(  1679286706) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MIN },
+      { -INT16_C( 20407),  INT16_C(  6105),  INT16_C( 15288), -INT16_C( 25624) } },
+    { { -INT32_C(   874999517),  INT32_C(   589307157),  INT32_C(   112330976),  INT32_C(   701793330) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,  INT16_C( 13712),        INT16_MAX },
+      { -INT16_C( 13351),  INT16_C(  8992),  INT16_C(  1714),  INT16_C( 10709) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_int16x4_t r1 = simde_vqrshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vqrshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vqrshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vqrshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vqrshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i16x4(r6, simde_vld1_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x4(r10, simde_vld1_s16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i16x4(r13, simde_vld1_s16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i16x4(r16, simde_vld1_s16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+
+    simde_int16x4_t r1 = simde_vqrshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vqrshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vqrshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vqrshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vqrshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrn_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int32_t r1[2];
+    int32_t r13[2];
+    int32_t r19[2];
+    int32_t r26[2];
+    int32_t r32[2];
+  } test_vec[] = {
+    { {                      INT64_MIN,                      INT64_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX } },
+    { {  INT64_C( 1641917347250586229), -INT64_C( 5497367474157543692) },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {  INT32_C(   382288673), -INT32_C(  1279955607) } },
+    { { -INT64_C( 7879878780728386156), -INT64_C( 6334255231544727141) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(  1834677248), -INT32_C(  1474808723) } },
+    { { -INT64_C( 7635864022524180847),  INT64_C( 3510655591578672091) },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      { -INT32_C(  1777863135),  INT32_C(   817388201) } },
+    { {  INT64_C( 2071968747679903400), -INT64_C( 5134438986327648638) },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {  INT32_C(   482417817), -INT32_C(  1195454734) } },
+    { { -INT64_C( 4367632294504299293), -INT64_C( 8049795561797452075) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(  1016918638), -INT32_C(  1874239082) } },
+    { {  INT64_C(  414183397398073449),  INT64_C( 7393518889260045577) },
+      {              INT32_MAX,              INT32_MAX },
+      {              INT32_MAX,              INT32_MAX },
+      {              INT32_MAX,              INT32_MAX },
+      {              INT32_MAX,              INT32_MAX },
+      {  INT32_C(    96434587),  INT32_C(  1721437762) } },
+    { { -INT64_C( 4400569115843997582), -INT64_C(  629809746410036167) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(  1024587340), -INT32_C(   146639009) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_int32x2_t r1 = simde_vqrshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vqrshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vqrshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vqrshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vqrshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x2(r13, simde_vld1_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x2(r19, simde_vld1_s32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i32x2(r26, simde_vld1_s32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_i32x2(r32, simde_vld1_s32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+
+    simde_int32x2_t r1 = simde_vqrshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vqrshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vqrshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vqrshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vqrshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrn_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r6[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(24254), UINT16_C(10347), UINT16_C(55125), UINT16_C(27341), UINT16_C(64852), UINT16_C( 1574) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(197) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 49) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(162),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 25) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C( 95), UINT8_C( 40), UINT8_C(215), UINT8_C(107), UINT8_C(253), UINT8_C(  6) } },
+    { { UINT16_C( 7017), UINT16_C(41439), UINT16_C(15498), UINT16_C(27708), UINT16_C(  722), UINT16_C( 3520), UINT16_C(17284), UINT16_C(21726) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 90),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(219),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 23), UINT8_C(110),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(110),    UINT8_MAX, UINT8_C(242),    UINT8_MAX, UINT8_C( 11), UINT8_C( 55),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C( 27), UINT8_C(162), UINT8_C( 61), UINT8_C(108), UINT8_C(  3), UINT8_C( 14), UINT8_C( 68), UINT8_C( 85) } },
+    { { UINT16_C(38853), UINT16_C(50528), UINT16_C(64294), UINT16_C(55825), UINT16_C(52111), UINT16_C(21283), UINT16_C(47196), UINT16_C(35072) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(152), UINT8_C(197), UINT8_C(251), UINT8_C(218), UINT8_C(204), UINT8_C( 83), UINT8_C(184), UINT8_C(137) } },
+    { { UINT16_C( 9590), UINT16_C( 5984), UINT16_C(60774), UINT16_C(11678), UINT16_C(28389), UINT16_C(12470), UINT16_C(50888), UINT16_C(55711) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(187),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(150), UINT8_C( 94),    UINT8_MAX, UINT8_C(182),    UINT8_MAX, UINT8_C(195),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C( 37), UINT8_C( 23), UINT8_C(237), UINT8_C( 46), UINT8_C(111), UINT8_C( 49), UINT8_C(199), UINT8_C(218) } },
+    { { UINT16_C(12760), UINT16_C(13346), UINT16_C(63882), UINT16_C(18382), UINT16_C(25329), UINT16_C(50969), UINT16_C(19196), UINT16_C( 3463) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(108) },
+      { UINT8_C(199), UINT8_C(209),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 54) },
+      { UINT8_C( 50), UINT8_C( 52), UINT8_C(250), UINT8_C( 72), UINT8_C( 99), UINT8_C(199), UINT8_C( 75), UINT8_C( 14) } },
+    { { UINT16_C(56534), UINT16_C(25356), UINT16_C(43649), UINT16_C(15438), UINT16_C(26278), UINT16_C(37293), UINT16_C(29518), UINT16_C(23186) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(241),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(221), UINT8_C( 99), UINT8_C(171), UINT8_C( 60), UINT8_C(103), UINT8_C(146), UINT8_C(115), UINT8_C( 91) } },
+    { { UINT16_C(48409), UINT16_C(39449), UINT16_C(24940), UINT16_C(63550), UINT16_C(34596), UINT16_C(49921), UINT16_C(32594), UINT16_C(60415) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(189), UINT8_C(154), UINT8_C( 97), UINT8_C(248), UINT8_C(135), UINT8_C(195), UINT8_C(127), UINT8_C(236) } },
+    { { UINT16_C(26142), UINT16_C( 8582), UINT16_C(22940), UINT16_C(61655), UINT16_C(16907), UINT16_C(30566), UINT16_C(51972), UINT16_C(62729) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(134),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(102), UINT8_C( 34), UINT8_C( 90), UINT8_C(241), UINT8_C( 66), UINT8_C(119), UINT8_C(203), UINT8_C(245) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+
+    simde_uint8x8_t r1 = simde_vqrshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vqrshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vqrshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vqrshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vqrshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r6, simde_vld1_u8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a = simde_test_arm_neon_random_u16x8();
+
+    simde_uint8x8_t r1 = simde_vqrshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vqrshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vqrshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vqrshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vqrshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_write_u16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrn_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r10[4];
+    uint16_t r13[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C( 744147012), UINT32_C(1178587004) },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(11355), UINT16_C(17984) } },
+    { { UINT32_C( 713716623), UINT32_C( 673633813), UINT32_C(1687527136), UINT32_C(2797945238) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(10890), UINT16_C(10279), UINT16_C(25750), UINT16_C(42693) } },
+    { { UINT32_C(2553191946), UINT32_C( 512505213), UINT32_C(2169260918), UINT32_C(2632980636) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(62562),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(38959), UINT16_C( 7820), UINT16_C(33100), UINT16_C(40176) } },
+    { { UINT32_C(2777903283), UINT32_C(2667486396), UINT32_C(3011018365), UINT32_C(4136029403) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(42387), UINT16_C(40703), UINT16_C(45944), UINT16_C(63111) } },
+    { { UINT32_C(1265980345), UINT32_C(1409576239), UINT32_C( 286707832), UINT32_C(4072787613) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX, UINT16_C(34999),      UINT16_MAX },
+      { UINT16_C(19317), UINT16_C(21508), UINT16_C( 4375), UINT16_C(62146) } },
+    { { UINT32_C(2828933413), UINT32_C(3284271239), UINT32_C(2317018028), UINT32_C(1898363882) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(43166), UINT16_C(50114), UINT16_C(35355), UINT16_C(28967) } },
+    { { UINT32_C(1442273982), UINT32_C(2769149286), UINT32_C(3807292755), UINT32_C(4262915732) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(22007), UINT16_C(42254), UINT16_C(58095), UINT16_C(65047) } },
+    { { UINT32_C( 622645067), UINT32_C(1961418471), UINT32_C( 499777189), UINT32_C(3135383251) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX, UINT16_C(61008),      UINT16_MAX },
+      { UINT16_C( 9501), UINT16_C(29929), UINT16_C( 7626), UINT16_C(47842) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+
+    simde_uint16x4_t r1 = simde_vqrshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vqrshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vqrshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vqrshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vqrshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r13, simde_vld1_u16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+
+    simde_uint16x4_t r1 = simde_vqrshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vqrshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vqrshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vqrshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vqrshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrn_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r19[2];
+    uint32_t r26[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { { UINT64_C(                   0),                     UINT64_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX } },
+    { { UINT64_C( 5957000521435947426), UINT64_C(16152232898010959866) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1386972266), UINT32_C(3760734782) } },
+    { { UINT64_C(14647587173082667080), UINT64_C(11464896173989451788) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(3410407149), UINT32_C(2669379156) } },
+    { { UINT64_C( 8091218272945598887), UINT64_C( 6705460710169931280) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1883883558), UINT32_C(1561236733) } },
+    { { UINT64_C( 7655145796568390212), UINT64_C(10120843516695958889) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1782352523), UINT32_C(2356442510) } },
+    { { UINT64_C(16498575900525391443), UINT64_C( 6885549671312178974) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(3841374046), UINT32_C(1603166962) } },
+    { { UINT64_C( 5449089424643582742), UINT64_C(10881088051771607887) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1268714998), UINT32_C(2533450735) } },
+    { { UINT64_C(14565443185372863646), UINT64_C( 9604253308010799556) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(3391281512), UINT32_C(2236164480) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vqrshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vqrshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vqrshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vqrshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vqrshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r19, simde_vld1_u32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u32x2(r26, simde_vld1_u32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a = simde_test_arm_neon_random_u64x2();
+
+    simde_uint32x2_t r1 = simde_vqrshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vqrshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vqrshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vqrshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vqrshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrnh_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrns_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrnd_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrnh_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrns_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrnd_n_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrn_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrn_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrn_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrn_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrn_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrn_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,606 @@
+#define SIMDE_TEST_ARM_NEON_INSN qrshrun_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qrshrun_n.h"
+
+static int
+test_simde_vqrshrunh_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a;
+    uint8_t r1;
+    uint8_t r3;
+    uint8_t r5;
+    uint8_t r6;
+    uint8_t r8;
+  } test_vec[] = {
+    {        INT16_MIN,
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    {        INT16_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(128) },
+    { -INT16_C( 13656),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { -INT16_C( 26895),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    {  INT16_C(  3756),
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(117),
+      UINT8_C( 59),
+      UINT8_C( 15) },
+    {  INT16_C( 19500),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C( 76) },
+    {  INT16_C( 31991),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(125) },
+    { -INT16_C( 10915),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint8_t r1 = simde_vqrshrunh_n_s16(test_vec[i].a, 1);
+    uint8_t r3 = simde_vqrshrunh_n_s16(test_vec[i].a, 3);
+    uint8_t r5 = simde_vqrshrunh_n_s16(test_vec[i].a, 5);
+    uint8_t r6 = simde_vqrshrunh_n_s16(test_vec[i].a, 6);
+    uint8_t r8 = simde_vqrshrunh_n_s16(test_vec[i].a, 8);
+
+    simde_assert_equal_u8(r1, test_vec[i].r1);
+    simde_assert_equal_u8(r3, test_vec[i].r3);
+    simde_assert_equal_u8(r5, test_vec[i].r5);
+    simde_assert_equal_u8(r6, test_vec[i].r6);
+    simde_assert_equal_u8(r8, test_vec[i].r8);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a = simde_test_codegen_random_i16();
+    uint8_t r1 = simde_vqrshrunh_n_s16(a, 1);
+    uint8_t r3 = simde_vqrshrunh_n_s16(a, 3);
+    uint8_t r5 = simde_vqrshrunh_n_s16(a, 5);
+    uint8_t r6 = simde_vqrshrunh_n_s16(a, 6);
+    uint8_t r8 = simde_vqrshrunh_n_s16(a, 8);
+
+    simde_test_codegen_write_i16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshruns_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a;
+    uint16_t r1;
+    uint16_t r6;
+    uint16_t r10;
+    uint16_t r13;
+    uint16_t r16;
+  } test_vec[] = {
+    {              INT32_MIN,
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {              INT32_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(32768) },
+    {  INT32_C(  1153195269),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(17596) },
+    {  INT32_C(   627475774),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C( 9575) },
+    { -INT32_C(   274344361),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {  INT32_C(  1844788748),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(28149) },
+    { -INT32_C(  1594150793),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {  INT32_C(   174720739),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(21328),
+      UINT16_C( 2666) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint16_t r1 = simde_vqrshruns_n_s32(test_vec[i].a, 1);
+    uint16_t r6 = simde_vqrshruns_n_s32(test_vec[i].a, 6);
+    uint16_t r10 = simde_vqrshruns_n_s32(test_vec[i].a, 10);
+    uint16_t r13 = simde_vqrshruns_n_s32(test_vec[i].a, 13);
+    uint16_t r16 = simde_vqrshruns_n_s32(test_vec[i].a, 16);
+
+    simde_assert_equal_u16(r1, test_vec[i].r1);
+    simde_assert_equal_u16(r6, test_vec[i].r6);
+    simde_assert_equal_u16(r10, test_vec[i].r10);
+    simde_assert_equal_u16(r13, test_vec[i].r13);
+    simde_assert_equal_u16(r16, test_vec[i].r16);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a = simde_test_codegen_random_i32();
+    uint16_t r1 = simde_vqrshruns_n_s32(a, 1);
+    uint16_t r6 = simde_vqrshruns_n_s32(a, 6);
+    uint16_t r10 = simde_vqrshruns_n_s32(a, 10);
+    uint16_t r13 = simde_vqrshruns_n_s32(a, 13);
+    uint16_t r16 = simde_vqrshruns_n_s32(a, 16);
+
+    simde_test_codegen_write_i32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrund_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    uint32_t r1;
+    uint32_t r13;
+    uint32_t r19;
+    uint32_t r26;
+    uint32_t r32;
+  } test_vec[] = {
+    {                      INT64_MIN,
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {                      INT64_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(2147483648) },
+    { -INT64_C(   72023097398989977),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {  INT64_C( 5428310930726489889),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1263877128) },
+    {  INT64_C( 2657495008954525154),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 618746273) },
+    { -INT64_C( 1144844667666512441),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {  INT64_C( 7337490589557560208),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1708392657) },
+    {  INT64_C(  512351169572705418),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 119291053) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r1 = simde_vqrshrund_n_s64(test_vec[i].a, 1);
+    uint32_t r13 = simde_vqrshrund_n_s64(test_vec[i].a, 13);
+    uint32_t r19 = simde_vqrshrund_n_s64(test_vec[i].a, 19);
+    uint32_t r26 = simde_vqrshrund_n_s64(test_vec[i].a, 26);
+    uint32_t r32 = simde_vqrshrund_n_s64(test_vec[i].a, 32);
+
+    simde_assert_equal_u32(r1, test_vec[i].r1);
+    simde_assert_equal_u32(r13, test_vec[i].r13);
+    simde_assert_equal_u32(r19, test_vec[i].r19);
+    simde_assert_equal_u32(r26, test_vec[i].r26);
+    simde_assert_equal_u32(r32, test_vec[i].r32);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    uint32_t r1 = simde_vqrshrund_n_s64(a, 1);
+    uint32_t r13 = simde_vqrshrund_n_s64(a, 13);
+    uint32_t r19 = simde_vqrshrund_n_s64(a, 19);
+    uint32_t r26 = simde_vqrshrund_n_s64(a, 26);
+    uint32_t r32 = simde_vqrshrund_n_s64(a, 32);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrun_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r6[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { {        INT16_MIN,        INT16_MAX,  INT16_C( 32353), -INT16_C( 26239), -INT16_C( 25193), -INT16_C( 17157), -INT16_C( 14863), -INT16_C( 14332) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(128), UINT8_C(126), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+    { { -INT16_C( 24722),  INT16_C( 31169),  INT16_C( 20528),  INT16_C(  9060),  INT16_C(  5720),  INT16_C( 28577),  INT16_C(  3163), -INT16_C(  5052) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(179),    UINT8_MAX, UINT8_C( 99), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(142), UINT8_C( 89),    UINT8_MAX, UINT8_C( 49), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(122), UINT8_C( 80), UINT8_C( 35), UINT8_C( 22), UINT8_C(112), UINT8_C( 12), UINT8_C(  0) } },
+    { {  INT16_C(  7654),  INT16_C( 23727),  INT16_C( 26770), -INT16_C( 15374),  INT16_C( 25485),  INT16_C( 25736), -INT16_C(  5473),  INT16_C( 10165) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(239),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(120),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(159) },
+      { UINT8_C( 30), UINT8_C( 93), UINT8_C(105), UINT8_C(  0), UINT8_C(100), UINT8_C(101), UINT8_C(  0), UINT8_C( 40) } },
+    { { -INT16_C( 32624),  INT16_C( 32507), -INT16_C( 11381),  INT16_C(  8463), -INT16_C( 21057), -INT16_C( 16759), -INT16_C( 19483),  INT16_C(  1308) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(164) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 41) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(132), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 20) },
+      { UINT8_C(  0), UINT8_C(127), UINT8_C(  0), UINT8_C( 33), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  5) } },
+    { { -INT16_C( 10291),  INT16_C(  7564), -INT16_C(  9247),  INT16_C(  7004), -INT16_C( 20078), -INT16_C( 17317),  INT16_C( 32393),  INT16_C( 22378) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(236), UINT8_C(  0), UINT8_C(219), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(118), UINT8_C(  0), UINT8_C(109), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C( 30), UINT8_C(  0), UINT8_C( 27), UINT8_C(  0), UINT8_C(  0), UINT8_C(127), UINT8_C( 87) } },
+    { { -INT16_C(  9787), -INT16_C(  8264),  INT16_C( 16442), -INT16_C( 20349),  INT16_C( 16978), -INT16_C( 16016),  INT16_C(  8185), -INT16_C( 10201) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(128), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C( 66), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0) } },
+    { {  INT16_C( 12530), -INT16_C(   119),  INT16_C(  7491),  INT16_C( 19237),  INT16_C( 12139),  INT16_C(  1351),  INT16_C( 20765),  INT16_C( 28125) },
+      {    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(169),    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C(234),    UINT8_MAX,    UINT8_MAX, UINT8_C( 42),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(196), UINT8_C(  0), UINT8_C(117),    UINT8_MAX, UINT8_C(190), UINT8_C( 21),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C( 49), UINT8_C(  0), UINT8_C( 29), UINT8_C( 75), UINT8_C( 47), UINT8_C(  5), UINT8_C( 81), UINT8_C(110) } },
+    { { -INT16_C( 19429), -INT16_C( 22535), -INT16_C(   901),  INT16_C( 20955), -INT16_C( 23535), -INT16_C(  5271), -INT16_C( 19049), -INT16_C( 21492) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 82), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+
+    simde_uint8x8_t r1 = simde_vqrshrun_n_s16(a, 1);
+    simde_uint8x8_t r3 = simde_vqrshrun_n_s16(a, 3);
+    simde_uint8x8_t r5 = simde_vqrshrun_n_s16(a, 5);
+    simde_uint8x8_t r6 = simde_vqrshrun_n_s16(a, 6);
+    simde_uint8x8_t r8 = simde_vqrshrun_n_s16(a, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r6, simde_vld1_u8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+
+    simde_uint8x8_t r1 = simde_vqrshrun_n_s16(a, 1);
+    simde_uint8x8_t r3 = simde_vqrshrun_n_s16(a, 3);
+    simde_uint8x8_t r5 = simde_vqrshrun_n_s16(a, 5);
+    simde_uint8x8_t r6 = simde_vqrshrun_n_s16(a, 6);
+    simde_uint8x8_t r8 = simde_vqrshrun_n_s16(a, 8);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrun_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r10[4];
+    uint16_t r13[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { {              INT32_MIN,              INT32_MAX,  INT32_C(   633373375),  INT32_C(  2130201937) },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(32768), UINT16_C( 9665), UINT16_C(32504) } },
+    { { -INT32_C(  1173557061), -INT32_C(   687215564), -INT32_C(  1778502764), -INT32_C(  1265002771) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {  INT32_C(  1967198175), -INT32_C(   408278301), -INT32_C(   674322680),  INT32_C(  1319193232) },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(30017), UINT16_C(    0), UINT16_C(    0), UINT16_C(20129) } },
+    { { -INT32_C(   218759186), -INT32_C(  1726813045),  INT32_C(   722849846),  INT32_C(   120890934) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(14757) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(11030), UINT16_C( 1845) } },
+    { {  INT32_C(    77787491), -INT32_C(   407682459),  INT32_C(  1610339286), -INT32_C(  1562892078) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C( 9496), UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C( 1187), UINT16_C(    0), UINT16_C(24572), UINT16_C(    0) } },
+    { { -INT32_C(  1823059118), -INT32_C(  1434611070), -INT32_C(  2144255153),  INT32_C(  1112349450) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(16973) } },
+    { {  INT32_C(  1266748166), -INT32_C(  1603488633),  INT32_C(  1103750166), -INT32_C(  1700779255) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C(19329), UINT16_C(    0), UINT16_C(16842), UINT16_C(    0) } },
+    { {  INT32_C(  1905928093),  INT32_C(  1224184475),  INT32_C(   385142464), -INT32_C(   661023496) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX,      UINT16_MAX, UINT16_C(47014), UINT16_C(    0) },
+      { UINT16_C(29082), UINT16_C(18680), UINT16_C( 5877), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_uint16x4_t r1 = simde_vqrshrun_n_s32(a, 1);
+    simde_uint16x4_t r6 = simde_vqrshrun_n_s32(a, 6);
+    simde_uint16x4_t r10 = simde_vqrshrun_n_s32(a, 10);
+    simde_uint16x4_t r13 = simde_vqrshrun_n_s32(a, 13);
+    simde_uint16x4_t r16 = simde_vqrshrun_n_s32(a, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r13, simde_vld1_u16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+
+    simde_uint16x4_t r1 = simde_vqrshrun_n_s32(a, 1);
+    simde_uint16x4_t r6 = simde_vqrshrun_n_s32(a, 6);
+    simde_uint16x4_t r10 = simde_vqrshrun_n_s32(a, 10);
+    simde_uint16x4_t r13 = simde_vqrshrun_n_s32(a, 13);
+    simde_uint16x4_t r16 = simde_vqrshrun_n_s32(a, 16);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqrshrun_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r19[2];
+    uint32_t r26[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { {                      INT64_MIN,                      INT64_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0), UINT32_C(2147483648) } },
+    { { -INT64_C( 3919305151589087707),  INT64_C( 8974700327177490421) },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0), UINT32_C(2089585254) } },
+    { {  INT64_C( 7686640293974546054),  INT64_C( 7610696537124711046) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1789685407), UINT32_C(1772003373) } },
+    { {  INT64_C( 9009812833044507998), -INT64_C( 8786945604305290618) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      { UINT32_C(2097760521), UINT32_C(         0) } },
+    { { -INT64_C( 3753159318930863663),  INT64_C( 5798702124757756576) },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0), UINT32_C(1350115548) } },
+    { { -INT64_C( 7497842439812812378), -INT64_C( 9186552883093024828) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { {  INT64_C( 7318843073796417201), -INT64_C( 6005150746340593045) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      { UINT32_C(1704050944), UINT32_C(         0) } },
+    { { -INT64_C( 8528834252997392684),  INT64_C( 6677040024734866047) },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0), UINT32_C(1554619527) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vqrshrun_n_s64(a, 1);
+    simde_uint32x2_t r13 = simde_vqrshrun_n_s64(a, 13);
+    simde_uint32x2_t r19 = simde_vqrshrun_n_s64(a, 19);
+    simde_uint32x2_t r26 = simde_vqrshrun_n_s64(a, 26);
+    simde_uint32x2_t r32 = simde_vqrshrun_n_s64(a, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r19, simde_vld1_u32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u32x2(r26, simde_vld1_u32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+
+    simde_uint32x2_t r1 = simde_vqrshrun_n_s64(a, 1);
+    simde_uint32x2_t r13 = simde_vqrshrun_n_s64(a, 13);
+    simde_uint32x2_t r19 = simde_vqrshrun_n_s64(a, 19);
+    simde_uint32x2_t r26 = simde_vqrshrun_n_s64(a, 26);
+    simde_uint32x2_t r32 = simde_vqrshrun_n_s64(a, 32);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrunh_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshruns_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrund_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrun_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrun_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqrshrun_n_s64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1203 @@
+#define SIMDE_TEST_ARM_NEON_INSN qshrn_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qshrn_n.h"
+
+static int
+test_simde_vqshrnh_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a;
+    int8_t r1;
+    int8_t r3;
+    int8_t r5;
+    int8_t r6;
+    int8_t r8;
+  } test_vec[] = {
+    {        INT16_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN },
+    {        INT16_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX },
+    { -INT16_C( 17087),
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+      -INT8_C(  67) },
+    { -INT16_C( 13688),
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+      -INT8_C(  54) },
+    { -INT16_C( 21808),
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+      -INT8_C(  86) },
+    { -INT16_C( 17175),
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+           INT8_MIN,
+      -INT8_C(  68) },
+    {  INT16_C( 16044),
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+           INT8_MAX,
+       INT8_C(  62) },
+    { -INT16_C(   925),
+           INT8_MIN,
+      -INT8_C( 116),
+      -INT8_C(  29),
+      -INT8_C(  15),
+      -INT8_C(   4) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int8_t r1 = simde_vqshrnh_n_s16(test_vec[i].a, 1);
+    int8_t r3 = simde_vqshrnh_n_s16(test_vec[i].a, 3);
+    int8_t r5 = simde_vqshrnh_n_s16(test_vec[i].a, 5);
+    int8_t r6 = simde_vqshrnh_n_s16(test_vec[i].a, 6);
+    int8_t r8 = simde_vqshrnh_n_s16(test_vec[i].a, 8);
+
+    simde_assert_equal_i8(r1, test_vec[i].r1);
+    simde_assert_equal_i8(r3, test_vec[i].r3);
+    simde_assert_equal_i8(r5, test_vec[i].r5);
+    simde_assert_equal_i8(r6, test_vec[i].r6);
+    simde_assert_equal_i8(r8, test_vec[i].r8);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a = simde_test_codegen_random_i16();
+    int8_t r1 = simde_vqshrnh_n_s16(a, 1);
+    int8_t r3 = simde_vqshrnh_n_s16(a, 3);
+    int8_t r5 = simde_vqshrnh_n_s16(a, 5);
+    int8_t r6 = simde_vqshrnh_n_s16(a, 6);
+    int8_t r8 = simde_vqshrnh_n_s16(a, 8);
+
+    simde_test_codegen_write_i16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrns_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a;
+    int16_t r1;
+    int16_t r6;
+    int16_t r10;
+    int16_t r13;
+    int16_t r16;
+  } test_vec[] = {
+    {              INT32_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN },
+    {              INT32_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX,
+             INT16_MAX },
+    { -INT32_C(  1990454030),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C( 30372) },
+    { -INT32_C(   757195968),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C( 11554) },
+    { -INT32_C(  1010416958),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C( 15418) },
+    { -INT32_C(   640607764),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C(  9775) },
+    {  INT32_C(    14611901),
+             INT16_MAX,
+             INT16_MAX,
+       INT16_C( 14269),
+       INT16_C(  1783),
+       INT16_C(   222) },
+    { -INT32_C(   226654415),
+             INT16_MIN,
+             INT16_MIN,
+             INT16_MIN,
+      -INT16_C( 27668),
+      -INT16_C(  3459) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int16_t r1 = simde_vqshrns_n_s32(test_vec[i].a, 1);
+    int16_t r6 = simde_vqshrns_n_s32(test_vec[i].a, 6);
+    int16_t r10 = simde_vqshrns_n_s32(test_vec[i].a, 10);
+    int16_t r13 = simde_vqshrns_n_s32(test_vec[i].a, 13);
+    int16_t r16 = simde_vqshrns_n_s32(test_vec[i].a, 16);
+
+    simde_assert_equal_i16(r1, test_vec[i].r1);
+    simde_assert_equal_i16(r6, test_vec[i].r6);
+    simde_assert_equal_i16(r10, test_vec[i].r10);
+    simde_assert_equal_i16(r13, test_vec[i].r13);
+    simde_assert_equal_i16(r16, test_vec[i].r16);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a = simde_test_codegen_random_i32();
+    int16_t r1 = simde_vqshrns_n_s32(a, 1);
+    int16_t r6 = simde_vqshrns_n_s32(a, 6);
+    int16_t r10 = simde_vqshrns_n_s32(a, 10);
+    int16_t r13 = simde_vqshrns_n_s32(a, 13);
+    int16_t r16 = simde_vqshrns_n_s32(a, 16);
+
+    simde_test_codegen_write_i32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i16(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrnd_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    int32_t r1;
+    int32_t r13;
+    int32_t r19;
+    int32_t r26;
+    int32_t r32;
+  } test_vec[] = {
+    {                      INT64_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN },
+    {                      INT64_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX },
+    {  INT64_C( 1341669784763339241),
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+       INT32_C(   312381839) },
+    { -INT64_C( 8708982720977498235),
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+      -INT32_C(  2027718053) },
+    { -INT64_C( 4644851800858938851),
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+      -INT32_C(  1081463835) },
+    {  INT64_C( 4503690537300536621),
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+       INT32_C(  1048597166) },
+    { -INT64_C( 1451982835930566218),
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+                   INT32_MIN,
+      -INT32_C(   338066099) },
+    {  INT64_C( 8328385685852738512),
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+                   INT32_MAX,
+       INT32_C(  1939103399) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r1 = simde_vqshrnd_n_s64(test_vec[i].a, 1);
+    int32_t r13 = simde_vqshrnd_n_s64(test_vec[i].a, 13);
+    int32_t r19 = simde_vqshrnd_n_s64(test_vec[i].a, 19);
+    int32_t r26 = simde_vqshrnd_n_s64(test_vec[i].a, 26);
+    int32_t r32 = simde_vqshrnd_n_s64(test_vec[i].a, 32);
+
+    simde_assert_equal_i32(r1, test_vec[i].r1);
+    simde_assert_equal_i32(r13, test_vec[i].r13);
+    simde_assert_equal_i32(r19, test_vec[i].r19);
+    simde_assert_equal_i32(r26, test_vec[i].r26);
+    simde_assert_equal_i32(r32, test_vec[i].r32);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    int32_t r1 = simde_vqshrnd_n_s64(a, 1);
+    int32_t r13 = simde_vqshrnd_n_s64(a, 13);
+    int32_t r19 = simde_vqshrnd_n_s64(a, 19);
+    int32_t r26 = simde_vqshrnd_n_s64(a, 26);
+    int32_t r32 = simde_vqshrnd_n_s64(a, 32);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrnh_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a;
+    uint8_t r1;
+    uint8_t r3;
+    uint8_t r5;
+    uint8_t r6;
+    uint8_t r8;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    {      UINT16_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX },
+    { UINT16_C(59415),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(232) },
+    { UINT16_C(20629),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C( 80) },
+    { UINT16_C(37724),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(147) },
+    { UINT16_C(12561),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(196),
+      UINT8_C( 49) },
+    { UINT16_C(11241),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(175),
+      UINT8_C( 43) },
+    { UINT16_C(    1),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint8_t r1 = simde_vqshrnh_n_u16(test_vec[i].a, 1);
+    uint8_t r3 = simde_vqshrnh_n_u16(test_vec[i].a, 3);
+    uint8_t r5 = simde_vqshrnh_n_u16(test_vec[i].a, 5);
+    uint8_t r6 = simde_vqshrnh_n_u16(test_vec[i].a, 6);
+    uint8_t r8 = simde_vqshrnh_n_u16(test_vec[i].a, 8);
+
+    simde_assert_equal_u8(r1, test_vec[i].r1);
+    simde_assert_equal_u8(r3, test_vec[i].r3);
+    simde_assert_equal_u8(r5, test_vec[i].r5);
+    simde_assert_equal_u8(r6, test_vec[i].r6);
+    simde_assert_equal_u8(r8, test_vec[i].r8);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a = simde_test_codegen_random_u16();
+    uint8_t r1 = simde_vqshrnh_n_u16(a, 1);
+    uint8_t r3 = simde_vqshrnh_n_u16(a, 3);
+    uint8_t r5 = simde_vqshrnh_n_u16(a, 5);
+    uint8_t r6 = simde_vqshrnh_n_u16(a, 6);
+    uint8_t r8 = simde_vqshrnh_n_u16(a, 8);
+
+    simde_test_codegen_write_u16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrns_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a;
+    uint16_t r1;
+    uint16_t r6;
+    uint16_t r10;
+    uint16_t r13;
+    uint16_t r16;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {           UINT32_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX },
+    { UINT32_C(3701801417),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(56485) },
+    { UINT32_C(4145385088),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(63253) },
+    { UINT32_C(3316240166),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(50601) },
+    { UINT32_C(2041832816),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(31155) },
+    { UINT32_C(2661543759),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(40611) },
+    { UINT32_C( 187470165),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(22884),
+      UINT16_C( 2860) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint16_t r1 = simde_vqshrns_n_u32(test_vec[i].a, 1);
+    uint16_t r6 = simde_vqshrns_n_u32(test_vec[i].a, 6);
+    uint16_t r10 = simde_vqshrns_n_u32(test_vec[i].a, 10);
+    uint16_t r13 = simde_vqshrns_n_u32(test_vec[i].a, 13);
+    uint16_t r16 = simde_vqshrns_n_u32(test_vec[i].a, 16);
+
+    simde_assert_equal_u16(r1, test_vec[i].r1);
+    simde_assert_equal_u16(r6, test_vec[i].r6);
+    simde_assert_equal_u16(r10, test_vec[i].r10);
+    simde_assert_equal_u16(r13, test_vec[i].r13);
+    simde_assert_equal_u16(r16, test_vec[i].r16);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint16_t r1 = simde_vqshrns_n_u32(a, 1);
+    uint16_t r6 = simde_vqshrns_n_u32(a, 6);
+    uint16_t r10 = simde_vqshrns_n_u32(a, 10);
+    uint16_t r13 = simde_vqshrns_n_u32(a, 13);
+    uint16_t r16 = simde_vqshrns_n_u32(a, 16);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrnd_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a;
+    uint32_t r1;
+    uint32_t r13;
+    uint32_t r19;
+    uint32_t r26;
+    uint32_t r32;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {                     UINT64_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX },
+    { UINT64_C( 5140837781797182721),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1196944569) },
+    { UINT64_C(17653472867311340188),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(4110269450) },
+    { UINT64_C(11884147678177973667),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(2766993753) },
+    { UINT64_C( 2300006552258431035),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 535512005) },
+    { UINT64_C( 8007888927211385641),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1864481933) },
+    { UINT64_C(15811228316661037842),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(3681338465) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r1 = simde_vqshrnd_n_u64(test_vec[i].a, 1);
+    uint32_t r13 = simde_vqshrnd_n_u64(test_vec[i].a, 13);
+    uint32_t r19 = simde_vqshrnd_n_u64(test_vec[i].a, 19);
+    uint32_t r26 = simde_vqshrnd_n_u64(test_vec[i].a, 26);
+    uint32_t r32 = simde_vqshrnd_n_u64(test_vec[i].a, 32);
+
+    simde_assert_equal_u32(r1, test_vec[i].r1);
+    simde_assert_equal_u32(r13, test_vec[i].r13);
+    simde_assert_equal_u32(r19, test_vec[i].r19);
+    simde_assert_equal_u32(r26, test_vec[i].r26);
+    simde_assert_equal_u32(r32, test_vec[i].r32);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint32_t r1 = simde_vqshrnd_n_u64(a, 1);
+    uint32_t r13 = simde_vqshrnd_n_u64(a, 13);
+    uint32_t r19 = simde_vqshrnd_n_u64(a, 19);
+    uint32_t r26 = simde_vqshrnd_n_u64(a, 26);
+    uint32_t r32 = simde_vqshrnd_n_u64(a, 32);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrn_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int8_t r1[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r6[8];
+    int8_t r8[8];
+  } test_vec[] = {
+    { {        INT16_MIN,        INT16_MAX, -INT16_C(  2937), -INT16_C(  3563), -INT16_C( 14742), -INT16_C( 18784),  INT16_C( 13176),  INT16_C( 31289) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(  92), -INT8_C( 112),      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(  46), -INT8_C(  56),      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(  12), -INT8_C(  14), -INT8_C(  58), -INT8_C(  74),  INT8_C(  51),  INT8_C( 122) } },
+    { {  INT16_C( 14927),  INT16_C( 14313), -INT16_C(  8988),  INT16_C( 17576),  INT16_C( 28456),  INT16_C(  9944), -INT16_C( 32534), -INT16_C( 28550) },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {  INT8_C(  58),  INT8_C(  55), -INT8_C(  36),  INT8_C(  68),  INT8_C( 111),  INT8_C(  38),      INT8_MIN, -INT8_C( 112) } },
+    { { -INT16_C( 16559), -INT16_C( 14207), -INT16_C( 26028),  INT16_C( 15212), -INT16_C( 18391), -INT16_C( 13422), -INT16_C( 31363),  INT16_C(  7600) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,  INT8_C( 118) },
+      { -INT8_C(  65), -INT8_C(  56), -INT8_C( 102),  INT8_C(  59), -INT8_C(  72), -INT8_C(  53), -INT8_C( 123),  INT8_C(  29) } },
+    { {  INT16_C( 18056),  INT16_C(  7312), -INT16_C( 18241),  INT16_C(   687),  INT16_C(  8279),  INT16_C( 23549), -INT16_C( 18086), -INT16_C( 27987) },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C(  85),      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C(  21),      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,  INT8_C( 114),      INT8_MIN,  INT8_C(  10),      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {  INT8_C(  70),  INT8_C(  28), -INT8_C(  72),  INT8_C(   2),  INT8_C(  32),  INT8_C(  91), -INT8_C(  71), -INT8_C( 110) } },
+    { { -INT16_C( 13370),  INT16_C( 27031),  INT16_C(  9307), -INT16_C( 31199),  INT16_C(   156),  INT16_C( 23372), -INT16_C(  5626), -INT16_C( 24457) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C(  78),      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C(  19),      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C(   4),      INT8_MAX,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,  INT8_C(   2),      INT8_MAX, -INT8_C(  88),      INT8_MIN },
+      { -INT8_C(  53),  INT8_C( 105),  INT8_C(  36), -INT8_C( 122),  INT8_C(   0),  INT8_C(  91), -INT8_C(  22), -INT8_C(  96) } },
+    { {  INT16_C( 12221),  INT16_C( 26927), -INT16_C( 30598), -INT16_C(  5530),  INT16_C( 19003), -INT16_C( 21324),  INT16_C(  8983), -INT16_C( 11759) },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MIN, -INT8_C(  87),      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {  INT8_C(  47),  INT8_C( 105), -INT8_C( 120), -INT8_C(  22),  INT8_C(  74), -INT8_C(  84),  INT8_C(  35), -INT8_C(  46) } },
+    { {  INT16_C( 16917), -INT16_C(  2141),  INT16_C(  4808),  INT16_C( 13574), -INT16_C( 10061),  INT16_C(  6559), -INT16_C( 15102),  INT16_C( 28333) },
+      {      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MAX, -INT8_C(  67),      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MAX, -INT8_C(  34),  INT8_C(  75),      INT8_MAX,      INT8_MIN,  INT8_C( 102),      INT8_MIN,      INT8_MAX },
+      {  INT8_C(  66), -INT8_C(   9),  INT8_C(  18),  INT8_C(  53), -INT8_C(  40),  INT8_C(  25), -INT8_C(  59),  INT8_C( 110) } },
+    { { -INT16_C( 14188),  INT16_C( 19807),  INT16_C(  9628), -INT16_C( 26168),  INT16_C( 21207), -INT16_C( 18160),  INT16_C(  6383), -INT16_C(  7905) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,  INT8_C(  99), -INT8_C( 124) },
+      { -INT8_C(  56),  INT8_C(  77),  INT8_C(  37), -INT8_C( 103),  INT8_C(  82), -INT8_C(  71),  INT8_C(  24), -INT8_C(  31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+
+    simde_int8x8_t r1 = simde_vqshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vqshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vqshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vqshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vqshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r6, simde_vld1_s8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i8x8(r8, simde_vld1_s8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+
+    simde_int8x8_t r1 = simde_vqshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vqshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vqshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vqshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vqshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrn_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int16_t r1[4];
+    int16_t r6[4];
+    int16_t r10[4];
+    int16_t r13[4];
+    int16_t r16[4];
+  } test_vec[] = {
+    { {              INT32_MIN,              INT32_MAX, -INT32_C(   106292693),  INT32_C(  1742493605) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX, -INT16_C( 12976),        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX, -INT16_C(  1622),  INT16_C( 26588) } },
+    { { -INT32_C(   221262760),  INT32_C(  1026425015), -INT32_C(   673709258),  INT32_C(   690857840) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      { -INT16_C( 27010),        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      { -INT16_C(  3377),  INT16_C( 15662), -INT16_C( 10280),  INT16_C( 10541) } },
+    { { -INT32_C(  1661784261), -INT32_C(   893964263),  INT32_C(  2136918767), -INT32_C(   490198983) },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MIN },
+      { -INT16_C( 25357), -INT16_C( 13641),  INT16_C( 32606), -INT16_C(  7480) } },
+    { {  INT32_C(   492321823), -INT32_C(  1076049552),  INT32_C(   140101030),  INT32_C(   408063692) },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MAX,        INT16_MIN,  INT16_C( 17102),        INT16_MAX },
+      {  INT16_C(  7512), -INT16_C( 16420),  INT16_C(  2137),  INT16_C(  6226) } },
+    { { -INT32_C(  1636099088), -INT32_C(   413008153), -INT32_C(   164069525),  INT32_C(  1190761486) },
+      {        INT16_MIN,        INT16_MIN,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MIN,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MIN,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MIN, -INT16_C( 20029),        INT16_MAX },
+      { -INT16_C( 24965), -INT16_C(  6303), -INT16_C(  2504),  INT16_C( 18169) } },
+    { { -INT32_C(    81510593), -INT32_C(    11266341),  INT32_C(  1792958256),  INT32_C(  1863443823) },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MIN,        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      {        INT16_MIN, -INT16_C( 11003),        INT16_MAX,        INT16_MAX },
+      { -INT16_C(  9951), -INT16_C(  1376),        INT16_MAX,        INT16_MAX },
+      { -INT16_C(  1244), -INT16_C(   172),  INT16_C( 27358),  INT16_C( 28433) } },
+    { { -INT32_C(  2054425099),  INT32_C(  2020045539), -INT32_C(   510059734),  INT32_C(   427154429) },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      {        INT16_MIN,        INT16_MAX,        INT16_MIN,        INT16_MAX },
+      { -INT16_C( 31349),  INT16_C( 30823), -INT16_C(  7783),  INT16_C(  6517) } },
+    { {  INT32_C(  1214286887),  INT32_C(  1560594601), -INT32_C(  1143436509), -INT32_C(   132288895) },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN,        INT16_MIN },
+      {        INT16_MAX,        INT16_MAX,        INT16_MIN, -INT16_C( 16149) },
+      {  INT16_C( 18528),  INT16_C( 23812), -INT16_C( 17448), -INT16_C(  2019) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_int16x4_t r1 = simde_vqshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vqshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vqshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vqshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vqshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i16x4(r6, simde_vld1_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x4(r10, simde_vld1_s16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i16x4(r13, simde_vld1_s16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i16x4(r16, simde_vld1_s16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+
+    simde_int16x4_t r1 = simde_vqshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vqshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vqshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vqshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vqshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrn_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int32_t r1[2];
+    int32_t r13[2];
+    int32_t r19[2];
+    int32_t r26[2];
+    int32_t r32[2];
+  } test_vec[] = {
+    { {                      INT64_MIN,                      INT64_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX } },
+    { { -INT64_C( 2062734527008271126), -INT64_C( 1534451519072665528) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(   480267808), -INT32_C(   357267335) } },
+    { { -INT64_C(  440355986844007111), -INT64_C( 3240656061683734885) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(   102528368), -INT32_C(   754524037) } },
+    { {  INT64_C( 1749298741766847781),  INT64_C( 8672149061360662422) },
+      {              INT32_MAX,              INT32_MAX },
+      {              INT32_MAX,              INT32_MAX },
+      {              INT32_MAX,              INT32_MAX },
+      {              INT32_MAX,              INT32_MAX },
+      {  INT32_C(   407290351),  INT32_C(  2019142047) } },
+    { { -INT64_C( 3330821501074293929), -INT64_C( 2726132450963676819) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(   775517314), -INT32_C(   634727174) } },
+    { {  INT64_C(  301988419728072466), -INT64_C( 3937067303677402419) },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {              INT32_MAX,              INT32_MIN },
+      {  INT32_C(    70312158), -INT32_C(   916669915) } },
+    { { -INT64_C( 4184146230887927988), -INT64_C( 6503889012761329290) },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      {              INT32_MIN,              INT32_MIN },
+      { -INT32_C(   974197461), -INT32_C(  1514304666) } },
+    { { -INT64_C( 2375673538641047138),  INT64_C( 8167657908552004512) },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      {              INT32_MIN,              INT32_MAX },
+      { -INT32_C(   553129600),  INT32_C(  1901681047) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_int32x2_t r1 = simde_vqshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vqshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vqshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vqshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vqshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x2(r13, simde_vld1_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x2(r19, simde_vld1_s32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i32x2(r26, simde_vld1_s32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_i32x2(r32, simde_vld1_s32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+
+    simde_int32x2_t r1 = simde_vqshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vqshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vqshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vqshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vqshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrn_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r6[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C( 2054), UINT16_C(65488), UINT16_C(16641), UINT16_C( 4735), UINT16_C(43851), UINT16_C(11898) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C( 64),    UINT8_MAX,    UINT8_MAX, UINT8_C(147),    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C( 32),    UINT8_MAX,    UINT8_MAX, UINT8_C( 73),    UINT8_MAX, UINT8_C(185) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  8),    UINT8_MAX, UINT8_C( 65), UINT8_C( 18), UINT8_C(171), UINT8_C( 46) } },
+    { { UINT16_C(39042), UINT16_C(18801), UINT16_C(59778), UINT16_C(26157), UINT16_C(11170), UINT16_C(24473), UINT16_C(58093), UINT16_C( 7998) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(249) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(174),    UINT8_MAX,    UINT8_MAX, UINT8_C(124) },
+      { UINT8_C(152), UINT8_C( 73), UINT8_C(233), UINT8_C(102), UINT8_C( 43), UINT8_C( 95), UINT8_C(226), UINT8_C( 31) } },
+    { { UINT16_C(37859), UINT16_C(50905), UINT16_C(38848), UINT16_C(16503), UINT16_C( 7932), UINT16_C(42365), UINT16_C(23303), UINT16_C(48939) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(247),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(123),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(147), UINT8_C(198), UINT8_C(151), UINT8_C( 64), UINT8_C( 30), UINT8_C(165), UINT8_C( 91), UINT8_C(191) } },
+    { { UINT16_C(33704), UINT16_C(21495), UINT16_C(49464), UINT16_C(16617), UINT16_C(44569), UINT16_C(52576), UINT16_C(42020), UINT16_C(37137) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(131), UINT8_C( 83), UINT8_C(193), UINT8_C( 64), UINT8_C(174), UINT8_C(205), UINT8_C(164), UINT8_C(145) } },
+    { { UINT16_C(46563), UINT16_C(34838), UINT16_C(23123), UINT16_C(43338), UINT16_C(21980), UINT16_C(63270), UINT16_C(64101), UINT16_C( 9505) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(148) },
+      { UINT8_C(181), UINT8_C(136), UINT8_C( 90), UINT8_C(169), UINT8_C( 85), UINT8_C(247), UINT8_C(250), UINT8_C( 37) } },
+    { { UINT16_C(43941), UINT16_C(64088), UINT16_C(36691), UINT16_C(15551), UINT16_C(63304), UINT16_C( 8627), UINT16_C(56705), UINT16_C( 9459) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(242),    UINT8_MAX, UINT8_C(134),    UINT8_MAX, UINT8_C(147) },
+      { UINT8_C(171), UINT8_C(250), UINT8_C(143), UINT8_C( 60), UINT8_C(247), UINT8_C( 33), UINT8_C(221), UINT8_C( 36) } },
+    { { UINT16_C(47253), UINT16_C(15071), UINT16_C(64122), UINT16_C(27563), UINT16_C(25170), UINT16_C(26736), UINT16_C(60652), UINT16_C(56661) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(235),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT8_C(184), UINT8_C( 58), UINT8_C(250), UINT8_C(107), UINT8_C( 98), UINT8_C(104), UINT8_C(236), UINT8_C(221) } },
+    { { UINT16_C(37802), UINT16_C( 6911), UINT16_C(27917), UINT16_C(16852), UINT16_C(26352), UINT16_C(64170), UINT16_C( 3216), UINT16_C(20153) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(215),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(100),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(107),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 50),    UINT8_MAX },
+      { UINT8_C(147), UINT8_C( 26), UINT8_C(109), UINT8_C( 65), UINT8_C(102), UINT8_C(250), UINT8_C( 12), UINT8_C( 78) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+
+    simde_uint8x8_t r1 = simde_vqshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vqshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vqshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vqshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vqshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r6, simde_vld1_u8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a = simde_test_arm_neon_random_u16x8();
+
+    simde_uint8x8_t r1 = simde_vqshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vqshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vqshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vqshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vqshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_write_u16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrn_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r10[4];
+    uint16_t r13[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(4181251163), UINT32_C( 884021825) },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(63800), UINT16_C(13489) } },
+    { { UINT32_C(1623066410), UINT32_C( 501853508), UINT32_C(4067710843), UINT32_C(1185962240) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(61261),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(24766), UINT16_C( 7657), UINT16_C(62068), UINT16_C(18096) } },
+    { { UINT32_C( 560709581), UINT32_C( 817945681), UINT32_C(1982658506), UINT32_C(3630341602) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C( 8555), UINT16_C(12480), UINT16_C(30252), UINT16_C(55394) } },
+    { { UINT32_C(4263825370), UINT32_C(3633565810), UINT32_C(2716739129), UINT32_C(1394800929) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(65060), UINT16_C(55443), UINT16_C(41454), UINT16_C(21282) } },
+    { { UINT32_C( 673528102), UINT32_C(3298437316), UINT32_C(2726063153), UINT32_C(2427209254) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(10277), UINT16_C(50330), UINT16_C(41596), UINT16_C(37036) } },
+    { { UINT32_C( 111613535), UINT32_C( 937441583), UINT32_C(3099653019), UINT32_C( 736913994) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(13624),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C( 1703), UINT16_C(14304), UINT16_C(47296), UINT16_C(11244) } },
+    { { UINT32_C(2523188388), UINT32_C(1361467822), UINT32_C(2767689692), UINT32_C( 360131500) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(43961) },
+      { UINT16_C(38500), UINT16_C(20774), UINT16_C(42231), UINT16_C( 5495) } },
+    { { UINT32_C(2900127560), UINT32_C( 721998303), UINT32_C( 415758564), UINT32_C(2391169391) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX, UINT16_C(50751),      UINT16_MAX },
+      { UINT16_C(44252), UINT16_C(11016), UINT16_C( 6343), UINT16_C(36486) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+
+    simde_uint16x4_t r1 = simde_vqshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vqshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vqshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vqshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vqshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r13, simde_vld1_u16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+
+    simde_uint16x4_t r1 = simde_vqshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vqshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vqshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vqshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vqshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrn_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r19[2];
+    uint32_t r26[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { { UINT64_C(                   0),                     UINT64_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX } },
+    { { UINT64_C(10849750626676685792), UINT64_C(12438098532837679006) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(2526154421), UINT32_C(2895970487) } },
+    { { UINT64_C( 3629392269704754558), UINT64_C( 6479000478842303267) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C( 845033738), UINT32_C(1508509851) } },
+    { { UINT64_C( 9463904661956644885), UINT64_C( 8131061224842103443) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(2203487013), UINT32_C(1893160218) } },
+    { { UINT64_C(11645043666476505211), UINT64_C(14056605093214816111) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(2711323012), UINT32_C(3272808411) } },
+    { { UINT64_C(16870358092038970666), UINT64_C(15891192814737543636) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(3927936333), UINT32_C(3699956651) } },
+    { { UINT64_C( 5419438494680173648), UINT64_C(10760060885296329907) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1261811352), UINT32_C(2505271901) } },
+    { { UINT64_C(18087890881166183019), UINT64_C( 9813287577009660620) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(4211415276), UINT32_C(2284834062) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vqshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vqshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vqshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vqshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vqshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r19, simde_vld1_u32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u32x2(r26, simde_vld1_u32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a = simde_test_arm_neon_random_u64x2();
+
+    simde_uint32x2_t r1 = simde_vqshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vqshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vqshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vqshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vqshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrnh_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrns_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrnd_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrnh_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrns_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrnd_n_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrn_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrn_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrn_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrn_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrn_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrn_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
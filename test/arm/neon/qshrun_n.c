@@ -0,0 +1,606 @@
+#define SIMDE_TEST_ARM_NEON_INSN qshrun_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qshrun_n.h"
+
+static int
+test_simde_vqshrunh_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a;
+    uint8_t r1;
+    uint8_t r3;
+    uint8_t r5;
+    uint8_t r6;
+    uint8_t r8;
+  } test_vec[] = {
+    {        INT16_MIN,
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    {        INT16_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(127) },
+    { -INT16_C( 25402),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { -INT16_C( 10474),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { -INT16_C(  4799),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    {  INT16_C( 27712),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(108) },
+    {  INT16_C( 26931),
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C(105) },
+    {  INT16_C(  2572),
+         UINT8_MAX,
+         UINT8_MAX,
+      UINT8_C( 80),
+      UINT8_C( 40),
+      UINT8_C( 10) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint8_t r1 = simde_vqshrunh_n_s16(test_vec[i].a, 1);
+    uint8_t r3 = simde_vqshrunh_n_s16(test_vec[i].a, 3);
+    uint8_t r5 = simde_vqshrunh_n_s16(test_vec[i].a, 5);
+    uint8_t r6 = simde_vqshrunh_n_s16(test_vec[i].a, 6);
+    uint8_t r8 = simde_vqshrunh_n_s16(test_vec[i].a, 8);
+
+    simde_assert_equal_u8(r1, test_vec[i].r1);
+    simde_assert_equal_u8(r3, test_vec[i].r3);
+    simde_assert_equal_u8(r5, test_vec[i].r5);
+    simde_assert_equal_u8(r6, test_vec[i].r6);
+    simde_assert_equal_u8(r8, test_vec[i].r8);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a = simde_test_codegen_random_i16();
+    uint8_t r1 = simde_vqshrunh_n_s16(a, 1);
+    uint8_t r3 = simde_vqshrunh_n_s16(a, 3);
+    uint8_t r5 = simde_vqshrunh_n_s16(a, 5);
+    uint8_t r6 = simde_vqshrunh_n_s16(a, 6);
+    uint8_t r8 = simde_vqshrunh_n_s16(a, 8);
+
+    simde_test_codegen_write_i16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshruns_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a;
+    uint16_t r1;
+    uint16_t r6;
+    uint16_t r10;
+    uint16_t r13;
+    uint16_t r16;
+  } test_vec[] = {
+    {              INT32_MIN,
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {              INT32_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(32767) },
+    {  INT32_C(   897891245),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(13700) },
+    { -INT32_C(   276784442),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) },
+    {  INT32_C(  1114387790),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(17004) },
+    {  INT32_C(  1365850926),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(20841) },
+    {  INT32_C(  1513765731),
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+           UINT16_MAX,
+      UINT16_C(23098) },
+    { -INT32_C(  1869270609),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0),
+      UINT16_C(    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint16_t r1 = simde_vqshruns_n_s32(test_vec[i].a, 1);
+    uint16_t r6 = simde_vqshruns_n_s32(test_vec[i].a, 6);
+    uint16_t r10 = simde_vqshruns_n_s32(test_vec[i].a, 10);
+    uint16_t r13 = simde_vqshruns_n_s32(test_vec[i].a, 13);
+    uint16_t r16 = simde_vqshruns_n_s32(test_vec[i].a, 16);
+
+    simde_assert_equal_u16(r1, test_vec[i].r1);
+    simde_assert_equal_u16(r6, test_vec[i].r6);
+    simde_assert_equal_u16(r10, test_vec[i].r10);
+    simde_assert_equal_u16(r13, test_vec[i].r13);
+    simde_assert_equal_u16(r16, test_vec[i].r16);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t a = simde_test_codegen_random_i32();
+    uint16_t r1 = simde_vqshruns_n_s32(a, 1);
+    uint16_t r6 = simde_vqshruns_n_s32(a, 6);
+    uint16_t r10 = simde_vqshruns_n_s32(a, 10);
+    uint16_t r13 = simde_vqshruns_n_s32(a, 13);
+    uint16_t r16 = simde_vqshruns_n_s32(a, 16);
+
+    simde_test_codegen_write_i32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u16(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrund_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    uint32_t r1;
+    uint32_t r13;
+    uint32_t r19;
+    uint32_t r26;
+    uint32_t r32;
+  } test_vec[] = {
+    {                      INT64_MIN,
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {                      INT64_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(2147483647) },
+    { -INT64_C( 1994003764080390394),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { -INT64_C( 3890005554012229082),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {  INT64_C( 1920168703906991267),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C( 447074115) },
+    { -INT64_C( 4320334160350405836),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    {  INT64_C( 5824799727389569079),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1356191869) },
+    {  INT64_C( 5548537547564404202),
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+                UINT32_MAX,
+      UINT32_C(1291869568) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r1 = simde_vqshrund_n_s64(test_vec[i].a, 1);
+    uint32_t r13 = simde_vqshrund_n_s64(test_vec[i].a, 13);
+    uint32_t r19 = simde_vqshrund_n_s64(test_vec[i].a, 19);
+    uint32_t r26 = simde_vqshrund_n_s64(test_vec[i].a, 26);
+    uint32_t r32 = simde_vqshrund_n_s64(test_vec[i].a, 32);
+
+    simde_assert_equal_u32(r1, test_vec[i].r1);
+    simde_assert_equal_u32(r13, test_vec[i].r13);
+    simde_assert_equal_u32(r19, test_vec[i].r19);
+    simde_assert_equal_u32(r26, test_vec[i].r26);
+    simde_assert_equal_u32(r32, test_vec[i].r32);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    uint32_t r1 = simde_vqshrund_n_s64(a, 1);
+    uint32_t r13 = simde_vqshrund_n_s64(a, 13);
+    uint32_t r19 = simde_vqshrund_n_s64(a, 19);
+    uint32_t r26 = simde_vqshrund_n_s64(a, 26);
+    uint32_t r32 = simde_vqshrund_n_s64(a, 32);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrun_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r6[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { {        INT16_MIN,        INT16_MAX,  INT16_C( 31539), -INT16_C( 24157),  INT16_C( 10267),  INT16_C(  2494), -INT16_C(  2733), -INT16_C( 26149) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C( 77), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(160), UINT8_C( 38), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(127), UINT8_C(123), UINT8_C(  0), UINT8_C( 40), UINT8_C(  9), UINT8_C(  0), UINT8_C(  0) } },
+    { {  INT16_C( 22154), -INT16_C( 11938),  INT16_C(   486), -INT16_C( 20547),  INT16_C( 11160), -INT16_C( 32237),  INT16_C( 16956), -INT16_C( 30036) },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C(243), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C( 60), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C( 15), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C(  7), UINT8_C(  0), UINT8_C(174), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C( 86), UINT8_C(  0), UINT8_C(  1), UINT8_C(  0), UINT8_C( 43), UINT8_C(  0), UINT8_C( 66), UINT8_C(  0) } },
+    { { -INT16_C( 18546), -INT16_C(  3199),  INT16_C( 19653), -INT16_C( 20927),  INT16_C( 11384),  INT16_C( 30977), -INT16_C( 20463),  INT16_C( 26262) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(177),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C( 76), UINT8_C(  0), UINT8_C( 44), UINT8_C(121), UINT8_C(  0), UINT8_C(102) } },
+    { { -INT16_C( 22398), -INT16_C(  4560), -INT16_C( 22469), -INT16_C( 19517),  INT16_C( 17540), -INT16_C(  9031), -INT16_C(  6109),  INT16_C(  5631) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(175) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C( 87) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 68), UINT8_C(  0), UINT8_C(  0), UINT8_C( 21) } },
+    { { -INT16_C( 23410), -INT16_C(  9620),  INT16_C( 30758), -INT16_C(  9162), -INT16_C(  5517),  INT16_C( 12982),  INT16_C( 15585), -INT16_C(  3031) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(202), UINT8_C(243), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(120), UINT8_C(  0), UINT8_C(  0), UINT8_C( 50), UINT8_C( 60), UINT8_C(  0) } },
+    { {  INT16_C( 19604),  INT16_C( 21331), -INT16_C( 27653), -INT16_C( 29681), -INT16_C( 27621),  INT16_C( 16510), -INT16_C( 29070), -INT16_C( 16220) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 76), UINT8_C( 83), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0) } },
+    { {  INT16_C(  6221),  INT16_C( 28543), -INT16_C( 16052),  INT16_C( 12682), -INT16_C(  1484), -INT16_C( 20002),  INT16_C( 23612), -INT16_C( 11311) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C(194),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C( 97),    UINT8_MAX, UINT8_C(  0), UINT8_C(198), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) },
+      { UINT8_C( 24), UINT8_C(111), UINT8_C(  0), UINT8_C( 49), UINT8_C(  0), UINT8_C(  0), UINT8_C( 92), UINT8_C(  0) } },
+    { { -INT16_C( 11186),  INT16_C( 26143),  INT16_C(  8272),  INT16_C(  6018),  INT16_C(  7209),  INT16_C( 15298), -INT16_C( 26756),  INT16_C(  8015) },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX },
+      { UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(188), UINT8_C(225),    UINT8_MAX, UINT8_C(  0), UINT8_C(250) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(129), UINT8_C( 94), UINT8_C(112), UINT8_C(239), UINT8_C(  0), UINT8_C(125) },
+      { UINT8_C(  0), UINT8_C(102), UINT8_C( 32), UINT8_C( 23), UINT8_C( 28), UINT8_C( 59), UINT8_C(  0), UINT8_C( 31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+
+    simde_uint8x8_t r1 = simde_vqshrun_n_s16(a, 1);
+    simde_uint8x8_t r3 = simde_vqshrun_n_s16(a, 3);
+    simde_uint8x8_t r5 = simde_vqshrun_n_s16(a, 5);
+    simde_uint8x8_t r6 = simde_vqshrun_n_s16(a, 6);
+    simde_uint8x8_t r8 = simde_vqshrun_n_s16(a, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r6, simde_vld1_u8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+
+    simde_uint8x8_t r1 = simde_vqshrun_n_s16(a, 1);
+    simde_uint8x8_t r3 = simde_vqshrun_n_s16(a, 3);
+    simde_uint8x8_t r5 = simde_vqshrun_n_s16(a, 5);
+    simde_uint8x8_t r6 = simde_vqshrun_n_s16(a, 6);
+    simde_uint8x8_t r8 = simde_vqshrun_n_s16(a, 8);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrun_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r10[4];
+    uint16_t r13[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { {              INT32_MIN,              INT32_MAX, -INT32_C(  1866599298),  INT32_C(  1126648176) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(32767), UINT16_C(    0), UINT16_C(17191) } },
+    { {  INT32_C(   997948128),  INT32_C(  1027604468),  INT32_C(   640881809), -INT32_C(   577984378) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C(15227), UINT16_C(15679), UINT16_C( 9779), UINT16_C(    0) } },
+    { { -INT32_C(   362671599),  INT32_C(    10594322), -INT32_C(  1269879755),  INT32_C(   960435820) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(10346), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C( 1293), UINT16_C(    0),      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(  161), UINT16_C(    0), UINT16_C(14655) } },
+    { { -INT32_C(    40624065), -INT32_C(   368595657),  INT32_C(  1135379334), -INT32_C(    80916321) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(17324), UINT16_C(    0) } },
+    { { -INT32_C(  1032653953), -INT32_C(  2024376105),  INT32_C(   728652932),  INT32_C(    48618178) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(47478) },
+      { UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C( 5934) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(11118), UINT16_C(  741) } },
+    { {  INT32_C(   541627104), -INT32_C(   721765974),  INT32_C(  1710293726),  INT32_C(  1790075967) },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(    0),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C( 8264), UINT16_C(    0), UINT16_C(26097), UINT16_C(27314) } },
+    { {  INT32_C(  1498587063), -INT32_C(  1713892470), -INT32_C(  1013200618), -INT32_C(  1587580304) },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(22866), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {  INT32_C(  1832925273),  INT32_C(   525263347),  INT32_C(  1371420381),  INT32_C(  1931198491) },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      {      UINT16_MAX, UINT16_C(64119),      UINT16_MAX,      UINT16_MAX },
+      { UINT16_C(27968), UINT16_C( 8014), UINT16_C(20926), UINT16_C(29467) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_uint16x4_t r1 = simde_vqshrun_n_s32(a, 1);
+    simde_uint16x4_t r6 = simde_vqshrun_n_s32(a, 6);
+    simde_uint16x4_t r10 = simde_vqshrun_n_s32(a, 10);
+    simde_uint16x4_t r13 = simde_vqshrun_n_s32(a, 13);
+    simde_uint16x4_t r16 = simde_vqshrun_n_s32(a, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r13, simde_vld1_u16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+
+    simde_uint16x4_t r1 = simde_vqshrun_n_s32(a, 1);
+    simde_uint16x4_t r6 = simde_vqshrun_n_s32(a, 6);
+    simde_uint16x4_t r10 = simde_vqshrun_n_s32(a, 10);
+    simde_uint16x4_t r13 = simde_vqshrun_n_s32(a, 13);
+    simde_uint16x4_t r16 = simde_vqshrun_n_s32(a, 16);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vqshrun_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r19[2];
+    uint32_t r26[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { {                      INT64_MIN,                      INT64_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0), UINT32_C(2147483647) } },
+    { {  INT64_C( 5011127376269226695), -INT64_C( 2098325179871267960) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      { UINT32_C(1166744012), UINT32_C(         0) } },
+    { { -INT64_C( 7119798154167584424),  INT64_C( 1154625186325127466) },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0), UINT32_C( 268832125) } },
+    { { -INT64_C( 1297072629201714218), -INT64_C( 5830766162032029447) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { {  INT64_C( 4940819662134004624),  INT64_C( 5394393691094549761) },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      {           UINT32_MAX,           UINT32_MAX },
+      { UINT32_C(1150374222), UINT32_C(1255980155) } },
+    { { -INT64_C(  553458664580142122), -INT64_C( 6590519944164755323) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { {  INT64_C( 5282462770760030662), -INT64_C( 9087878656420782516) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      {           UINT32_MAX, UINT32_C(         0) },
+      { UINT32_C(1229919206), UINT32_C(         0) } },
+    { { -INT64_C( 5330188547952942008), -INT64_C( 3816955685885441377) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vqshrun_n_s64(a, 1);
+    simde_uint32x2_t r13 = simde_vqshrun_n_s64(a, 13);
+    simde_uint32x2_t r19 = simde_vqshrun_n_s64(a, 19);
+    simde_uint32x2_t r26 = simde_vqshrun_n_s64(a, 26);
+    simde_uint32x2_t r32 = simde_vqshrun_n_s64(a, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r19, simde_vld1_u32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u32x2(r26, simde_vld1_u32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+
+    simde_uint32x2_t r1 = simde_vqshrun_n_s64(a, 1);
+    simde_uint32x2_t r13 = simde_vqshrun_n_s64(a, 13);
+    simde_uint32x2_t r19 = simde_vqshrun_n_s64(a, 19);
+    simde_uint32x2_t r26 = simde_vqshrun_n_s64(a, 26);
+    simde_uint32x2_t r32 = simde_vqshrun_n_s64(a, 32);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrunh_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshruns_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrund_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrun_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrun_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vqshrun_n_s64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,383 @@
+#define SIMDE_TEST_ARM_NEON_INSN recpe
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/recpe.h"
+
+static int
+test_simde_vrecpes_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(    -5.2300),
+      SIMDE_FLOAT32_C(    -0.1914) },
+    { SIMDE_FLOAT32_C(     2.6500),
+      SIMDE_FLOAT32_C(     0.3770) },
+    { SIMDE_FLOAT32_C(     1.6000),
+      SIMDE_FLOAT32_C(     0.6250) },
+    { SIMDE_FLOAT32_C(     4.1100),
+      SIMDE_FLOAT32_C(     0.2427) },
+    { SIMDE_FLOAT32_C(    -1.6800),
+      SIMDE_FLOAT32_C(    -0.5938) },
+    {  SIMDE_MATH_INFINITYF,
+      SIMDE_FLOAT32_C(     0.0000) },
+    { SIMDE_FLOAT32_C(    -1.8400),
+      SIMDE_FLOAT32_C(    -0.5430) },
+    { SIMDE_FLOAT32_C(    -3.3900),
+      SIMDE_FLOAT32_C(    -0.2949) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_vrecpes_f32(test_vec[i].a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(1.0f, 10.0f);
+    simde_float32 r = simde_vrecpes_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecped_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(    -9.9000),
+      SIMDE_FLOAT64_C(    -0.1011) },
+    { SIMDE_FLOAT64_C(     5.2100),
+      SIMDE_FLOAT64_C(     0.1919) },
+    { SIMDE_FLOAT64_C(     4.1300),
+      SIMDE_FLOAT64_C(     0.2422) },
+    { SIMDE_FLOAT64_C(    -5.6900),
+      SIMDE_FLOAT64_C(    -0.1758) },
+    { SIMDE_FLOAT64_C(    -9.8400),
+      SIMDE_FLOAT64_C(    -0.1018) },
+    {  SIMDE_MATH_INFINITY,
+      SIMDE_FLOAT64_C(     0.0000) },
+    { SIMDE_FLOAT64_C(     5.8900),
+      SIMDE_FLOAT64_C(     0.1699) },
+    { SIMDE_FLOAT64_C(    -7.0700),
+      SIMDE_FLOAT64_C(    -0.1416) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r = simde_vrecped_f64(test_vec[i].a);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(1.0, 10.0);
+    simde_float64 r = simde_vrecped_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpe_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     8.0700), SIMDE_FLOAT32_C(    -1.1300) },
+      { SIMDE_FLOAT32_C(     0.1238), SIMDE_FLOAT32_C(    -0.8848) } },
+    { { SIMDE_FLOAT32_C(    -3.2800), SIMDE_FLOAT32_C(     8.8900) },
+      { SIMDE_FLOAT32_C(    -0.3047), SIMDE_FLOAT32_C(     0.1125) } },
+    { { SIMDE_FLOAT32_C(     1.2100), SIMDE_FLOAT32_C(     3.4200) },
+      { SIMDE_FLOAT32_C(     0.8262), SIMDE_FLOAT32_C(     0.2930) } },
+    { { SIMDE_FLOAT32_C(    -6.4300), SIMDE_FLOAT32_C(    -8.6300) },
+      { SIMDE_FLOAT32_C(    -0.1558), SIMDE_FLOAT32_C(    -0.1157) } },
+    { { SIMDE_FLOAT32_C(     1.8600), SIMDE_FLOAT32_C(     6.4900) },
+      { SIMDE_FLOAT32_C(     0.5371), SIMDE_FLOAT32_C(     0.1538) } },
+    { {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.0000) },
+      { SIMDE_FLOAT32_C(     0.0000),  SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C(     7.6000), SIMDE_FLOAT32_C(    -3.8500) },
+      { SIMDE_FLOAT32_C(     0.1313), SIMDE_FLOAT32_C(    -0.2598) } },
+    { { SIMDE_FLOAT32_C(    -8.3100), SIMDE_FLOAT32_C(    -5.6300) },
+      { SIMDE_FLOAT32_C(    -0.1206), SIMDE_FLOAT32_C(    -0.1777) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t r = simde_vrecpe_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(1.0f, 10.0f);
+    simde_float32x2_t r = simde_vrecpe_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpe_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     6.4900) },
+      { SIMDE_FLOAT64_C(     0.1538) } },
+    { { SIMDE_FLOAT64_C(     4.5200) },
+      { SIMDE_FLOAT64_C(     0.2212) } },
+    { { SIMDE_FLOAT64_C(    -2.6800) },
+      { SIMDE_FLOAT64_C(    -0.3730) } },
+    { { SIMDE_FLOAT64_C(     9.7800) },
+      { SIMDE_FLOAT64_C(     0.1023) } },
+    { { SIMDE_FLOAT64_C(     9.9900) },
+      { SIMDE_FLOAT64_C(     0.1001) } },
+    { {  SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(     0.0000) } },
+    { { SIMDE_FLOAT64_C(     9.3300) },
+      { SIMDE_FLOAT64_C(     0.1072) } },
+    { { SIMDE_FLOAT64_C(     5.5000) },
+      { SIMDE_FLOAT64_C(     0.1816) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t r = simde_vrecpe_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(1.0, 10.0);
+    simde_float64x1_t r = simde_vrecpe_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpe_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(2837711761), UINT32_C( 576842601) },
+      { UINT32_C(3246391296), UINT32_C(4294967295) } },
+    { { UINT32_C( 375329581), UINT32_C( 576527775) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(2077468808), UINT32_C(2557533451) },
+      { UINT32_C(4294967295), UINT32_C(3607101440) } },
+    { { UINT32_C(1017656590), UINT32_C( 199814048) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C( 416349404), UINT32_C( 517956826) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1033588655), UINT32_C( 671090941) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1135055627), UINT32_C(1486102374) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1012732547), UINT32_C( 955635441) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vrecpe_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x2_t a = simde_test_arm_neon_random_u32x2();
+    simde_uint32x2_t r = simde_vrecpe_u32(a);
+
+    simde_test_arm_neon_write_u32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpeq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     2.1200), SIMDE_FLOAT32_C(    -1.6000), SIMDE_FLOAT32_C(     2.4200), SIMDE_FLOAT32_C(     7.3500) },
+      { SIMDE_FLOAT32_C(     0.4717), SIMDE_FLOAT32_C(    -0.6250), SIMDE_FLOAT32_C(     0.4131), SIMDE_FLOAT32_C(     0.1362) } },
+    { { SIMDE_FLOAT32_C(     6.6700), SIMDE_FLOAT32_C(    -9.1000), SIMDE_FLOAT32_C(     4.7700), SIMDE_FLOAT32_C(    -3.7500) },
+      { SIMDE_FLOAT32_C(     0.1499), SIMDE_FLOAT32_C(    -0.1099), SIMDE_FLOAT32_C(     0.2095), SIMDE_FLOAT32_C(    -0.2666) } },
+    { { SIMDE_FLOAT32_C(    -8.2100), SIMDE_FLOAT32_C(     4.1700), SIMDE_FLOAT32_C(     5.0200), SIMDE_FLOAT32_C(    -9.6400) },
+      { SIMDE_FLOAT32_C(    -0.1218), SIMDE_FLOAT32_C(     0.2402), SIMDE_FLOAT32_C(     0.1992), SIMDE_FLOAT32_C(    -0.1038) } },
+    { { SIMDE_FLOAT32_C(    -5.6100), SIMDE_FLOAT32_C(     2.2200), SIMDE_FLOAT32_C(    -8.8400), SIMDE_FLOAT32_C(     5.2400) },
+      { SIMDE_FLOAT32_C(    -0.1782), SIMDE_FLOAT32_C(     0.4502), SIMDE_FLOAT32_C(    -0.1133), SIMDE_FLOAT32_C(     0.1909) } },
+    { { SIMDE_FLOAT32_C(    -9.7700), SIMDE_FLOAT32_C(     9.3700), SIMDE_FLOAT32_C(    -9.4200), SIMDE_FLOAT32_C(     9.5000) },
+      { SIMDE_FLOAT32_C(    -0.1023), SIMDE_FLOAT32_C(     0.1069), SIMDE_FLOAT32_C(    -0.1062), SIMDE_FLOAT32_C(     0.1050) } },
+    { {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.0000), SIMDE_FLOAT32_C(    -7.6200), SIMDE_FLOAT32_C(    -1.4500) },
+      { SIMDE_FLOAT32_C(     0.0000),  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    -0.1313), SIMDE_FLOAT32_C(    -0.6895) } },
+    { { SIMDE_FLOAT32_C(    -4.2900), SIMDE_FLOAT32_C(     3.4100), SIMDE_FLOAT32_C(    -3.2800), SIMDE_FLOAT32_C(     2.2200) },
+      { SIMDE_FLOAT32_C(    -0.2329), SIMDE_FLOAT32_C(     0.2930), SIMDE_FLOAT32_C(    -0.3047), SIMDE_FLOAT32_C(     0.4502) } },
+    { { SIMDE_FLOAT32_C(     9.0400), SIMDE_FLOAT32_C(     7.3200), SIMDE_FLOAT32_C(     8.2000), SIMDE_FLOAT32_C(    -9.2000) },
+      { SIMDE_FLOAT32_C(     0.1106), SIMDE_FLOAT32_C(     0.1367), SIMDE_FLOAT32_C(     0.1218), SIMDE_FLOAT32_C(    -0.1086) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t r = simde_vrecpeq_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(1.0f, 10.0f);
+    simde_float32x4_t r = simde_vrecpeq_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpeq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    -9.5100), SIMDE_FLOAT64_C(     8.6900) },
+      { SIMDE_FLOAT64_C(    -0.1050), SIMDE_FLOAT64_C(     0.1150) } },
+    { { SIMDE_FLOAT64_C(    -3.0400), SIMDE_FLOAT64_C(    -6.6300) },
+      { SIMDE_FLOAT64_C(    -0.3291), SIMDE_FLOAT64_C(    -0.1509) } },
+    { { SIMDE_FLOAT64_C(     1.9100), SIMDE_FLOAT64_C(     9.9800) },
+      { SIMDE_FLOAT64_C(     0.5234), SIMDE_FLOAT64_C(     0.1001) } },
+    { { SIMDE_FLOAT64_C(    -9.2300), SIMDE_FLOAT64_C(    -4.4700) },
+      { SIMDE_FLOAT64_C(    -0.1084), SIMDE_FLOAT64_C(    -0.2231) } },
+    { { SIMDE_FLOAT64_C(     9.6400), SIMDE_FLOAT64_C(     6.9500) },
+      { SIMDE_FLOAT64_C(     0.1038), SIMDE_FLOAT64_C(     0.1440) } },
+    { {  SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(     0.0000) },
+      { SIMDE_FLOAT64_C(     0.0000),  SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C(     2.9300), SIMDE_FLOAT64_C(    -3.6700) },
+      { SIMDE_FLOAT64_C(     0.3408), SIMDE_FLOAT64_C(    -0.2725) } },
+    { { SIMDE_FLOAT64_C(     2.2400), SIMDE_FLOAT64_C(    -4.7400) },
+      { SIMDE_FLOAT64_C(     0.4463), SIMDE_FLOAT64_C(    -0.2109) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t r = simde_vrecpeq_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(1.0, 10.0);
+    simde_float64x2_t r = simde_vrecpeq_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpeq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2162539336), UINT32_C(4017315025), UINT32_C(  72557126), UINT32_C(4186153598) },
+      { UINT32_C(4269801472), UINT32_C(2298478592), UINT32_C(4294967295), UINT32_C(2197815296) } },
+    { { UINT32_C(1150032459), UINT32_C( 710810649), UINT32_C(2119861844), UINT32_C(2570228363) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(3590324224) } },
+    { { UINT32_C(2734929926), UINT32_C( 891895681), UINT32_C( 500608298), UINT32_C( 104366207) },
+      { UINT32_C(3363831808), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(2291879101), UINT32_C(2097780868), UINT32_C(1185819199), UINT32_C(2115655259) },
+      { UINT32_C(4018143232), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1246968651), UINT32_C(3057614041), UINT32_C( 197061546), UINT32_C(1052031983) },
+      { UINT32_C(4294967295), UINT32_C(3019898880), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(2209269359), UINT32_C(1272656276), UINT32_C(1558054144), UINT32_C( 393152782) },
+      { UINT32_C(4169138176), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C( 749676259), UINT32_C(1238220120), UINT32_C(2471398268), UINT32_C( 462758857) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(3732930560), UINT32_C(4294967295) } },
+    { { UINT32_C(1266653614), UINT32_C( 103735568), UINT32_C(3609624837), UINT32_C( 524435089) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(2550136832), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vrecpeq_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+    simde_uint32x4_t r = simde_vrecpeq_u32(a);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpes_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecped_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpe_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpe_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpe_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpeq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpeq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpeq_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
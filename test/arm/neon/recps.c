@@ -0,0 +1,359 @@
+#define SIMDE_TEST_ARM_NEON_INSN recps
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/recps.h"
+
+static int
+test_simde_vrecpss_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 b;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(    43.98),
+      SIMDE_FLOAT32_C(   738.94),
+      SIMDE_FLOAT32_C(-32496.58) },
+    { SIMDE_FLOAT32_C(  -393.30),
+      SIMDE_FLOAT32_C(  -989.57),
+      SIMDE_FLOAT32_C(-389195.88) },
+    { SIMDE_FLOAT32_C(   891.10),
+      SIMDE_FLOAT32_C(   875.97),
+      SIMDE_FLOAT32_C(-780574.81) },
+    { SIMDE_FLOAT32_C(   839.17),
+      SIMDE_FLOAT32_C(  -268.32),
+      SIMDE_FLOAT32_C(225168.09) },
+    { SIMDE_FLOAT32_C(   -91.13),
+      SIMDE_FLOAT32_C(   208.80),
+      SIMDE_FLOAT32_C( 19029.94) },
+    {  SIMDE_MATH_INFINITYF,
+      SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     2.00) },
+    { SIMDE_FLOAT32_C(   907.90),
+      SIMDE_FLOAT32_C(   767.85),
+      SIMDE_FLOAT32_C(-697129.00) },
+    { SIMDE_FLOAT32_C(  -345.28),
+      SIMDE_FLOAT32_C(  -988.01),
+      SIMDE_FLOAT32_C(-341138.09) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_vrecpss_f32(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 b = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 r = simde_vrecpss_f32(a, b);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpsd_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 b;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(  -621.27),
+      SIMDE_FLOAT64_C(   917.33),
+      SIMDE_FLOAT64_C(569911.61) },
+    { SIMDE_FLOAT64_C(   322.19),
+      SIMDE_FLOAT64_C(   -49.69),
+      SIMDE_FLOAT64_C( 16011.62) },
+    { SIMDE_FLOAT64_C(   914.80),
+      SIMDE_FLOAT64_C(   -17.59),
+      SIMDE_FLOAT64_C( 16093.33) },
+    { SIMDE_FLOAT64_C(   -84.38),
+      SIMDE_FLOAT64_C(   636.13),
+      SIMDE_FLOAT64_C( 53678.65) },
+    { SIMDE_FLOAT64_C(  -950.50),
+      SIMDE_FLOAT64_C(   822.65),
+      SIMDE_FLOAT64_C(781930.82) },
+    {  SIMDE_MATH_INFINITY,
+      SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     2.00) },
+    { SIMDE_FLOAT64_C(   894.41),
+      SIMDE_FLOAT64_C(   954.81),
+      SIMDE_FLOAT64_C(-853989.61) },
+    { SIMDE_FLOAT64_C(   371.44),
+      SIMDE_FLOAT64_C(   598.90),
+      SIMDE_FLOAT64_C(-222453.42) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r = simde_vrecpsd_f64(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 b = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 r = simde_vrecpsd_f64(a, b);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecps_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -962.97), SIMDE_FLOAT32_C(   743.42) },
+      { SIMDE_FLOAT32_C(   263.14), SIMDE_FLOAT32_C(   800.88) },
+      { SIMDE_FLOAT32_C(253397.94), SIMDE_FLOAT32_C(-595388.19) } },
+    { { SIMDE_FLOAT32_C(   -19.20), SIMDE_FLOAT32_C(   173.31) },
+      { SIMDE_FLOAT32_C(  -592.82), SIMDE_FLOAT32_C(  -593.68) },
+      { SIMDE_FLOAT32_C(-11380.14), SIMDE_FLOAT32_C(102892.68) } },
+    { { SIMDE_FLOAT32_C(  -988.03), SIMDE_FLOAT32_C(  -627.61) },
+      { SIMDE_FLOAT32_C(   -36.41), SIMDE_FLOAT32_C(    36.63) },
+      { SIMDE_FLOAT32_C(-35972.17), SIMDE_FLOAT32_C( 22991.35) } },
+    { { SIMDE_FLOAT32_C(   990.16), SIMDE_FLOAT32_C(   974.80) },
+      { SIMDE_FLOAT32_C(  -645.13), SIMDE_FLOAT32_C(  -825.45) },
+      { SIMDE_FLOAT32_C(638783.94), SIMDE_FLOAT32_C(804650.69) } },
+    { { SIMDE_FLOAT32_C(   367.96), SIMDE_FLOAT32_C(   583.05) },
+      { SIMDE_FLOAT32_C(   810.35), SIMDE_FLOAT32_C(   597.34) },
+      { SIMDE_FLOAT32_C(-298174.38), SIMDE_FLOAT32_C(-348277.09) } },
+    { {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00) },
+      { SIMDE_FLOAT32_C(     0.00), -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     2.00) } },
+    { { SIMDE_FLOAT32_C(  -882.33), SIMDE_FLOAT32_C(   372.99) },
+      { SIMDE_FLOAT32_C(   887.08), SIMDE_FLOAT32_C(   -98.49) },
+      { SIMDE_FLOAT32_C(782699.31), SIMDE_FLOAT32_C( 36737.79) } },
+    { { SIMDE_FLOAT32_C(  -895.22), SIMDE_FLOAT32_C(  -550.43) },
+      { SIMDE_FLOAT32_C(   672.55), SIMDE_FLOAT32_C(  -239.80) },
+      { SIMDE_FLOAT32_C(602082.19), SIMDE_FLOAT32_C(-131991.11) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vrecps_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vrecps_f32(a, b);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecps_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -231.27) },
+      { SIMDE_FLOAT64_C(   -42.80) },
+      { SIMDE_FLOAT64_C( -9896.36) } },
+    { { SIMDE_FLOAT64_C(   125.35) },
+      { SIMDE_FLOAT64_C(   290.61) },
+      { SIMDE_FLOAT64_C(-36425.96) } },
+    { { SIMDE_FLOAT64_C(   624.04) },
+      { SIMDE_FLOAT64_C(  -729.64) },
+      { SIMDE_FLOAT64_C(455326.55) } },
+    { { SIMDE_FLOAT64_C(   493.77) },
+      { SIMDE_FLOAT64_C(   692.96) },
+      { SIMDE_FLOAT64_C(-342160.86) } },
+    { { SIMDE_FLOAT64_C(  -539.41) },
+      { SIMDE_FLOAT64_C(   520.37) },
+      { SIMDE_FLOAT64_C(280694.78) } },
+    { {  SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(     0.00) },
+      { SIMDE_FLOAT64_C(     2.00) } },
+    { { SIMDE_FLOAT64_C(   992.25) },
+      { SIMDE_FLOAT64_C(  -326.42) },
+      { SIMDE_FLOAT64_C(323892.24) } },
+    { { SIMDE_FLOAT64_C(   200.05) },
+      { SIMDE_FLOAT64_C(   677.92) },
+      { SIMDE_FLOAT64_C(-135615.90) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vrecps_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vrecps_f64(a, b);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -731.72), SIMDE_FLOAT32_C(  -330.50), SIMDE_FLOAT32_C(  -466.16), SIMDE_FLOAT32_C(   685.39) },
+      { SIMDE_FLOAT32_C(   751.21), SIMDE_FLOAT32_C(  -962.15), SIMDE_FLOAT32_C(  -925.78), SIMDE_FLOAT32_C(   233.12) },
+      { SIMDE_FLOAT32_C(549677.38), SIMDE_FLOAT32_C(-317988.59), SIMDE_FLOAT32_C(-431559.62), SIMDE_FLOAT32_C(-159776.11) } },
+    { { SIMDE_FLOAT32_C(  -816.59), SIMDE_FLOAT32_C(  -431.91), SIMDE_FLOAT32_C(   410.99), SIMDE_FLOAT32_C(   123.46) },
+      { SIMDE_FLOAT32_C(  -300.53), SIMDE_FLOAT32_C(  -704.46), SIMDE_FLOAT32_C(   606.36), SIMDE_FLOAT32_C(  -418.74) },
+      { SIMDE_FLOAT32_C(-245407.80), SIMDE_FLOAT32_C(-304261.34), SIMDE_FLOAT32_C(-249205.89), SIMDE_FLOAT32_C( 51699.64) } },
+    { { SIMDE_FLOAT32_C(  -874.30), SIMDE_FLOAT32_C(   435.47), SIMDE_FLOAT32_C(  -345.71), SIMDE_FLOAT32_C(   668.92) },
+      { SIMDE_FLOAT32_C(   -27.01), SIMDE_FLOAT32_C(  -453.00), SIMDE_FLOAT32_C(   590.16), SIMDE_FLOAT32_C(   842.83) },
+      { SIMDE_FLOAT32_C(-23612.84), SIMDE_FLOAT32_C(197269.91), SIMDE_FLOAT32_C(204026.20), SIMDE_FLOAT32_C(-563783.81) } },
+    { { SIMDE_FLOAT32_C(   357.79), SIMDE_FLOAT32_C(  -305.73), SIMDE_FLOAT32_C(  -395.01), SIMDE_FLOAT32_C(  -393.87) },
+      { SIMDE_FLOAT32_C(   -59.97), SIMDE_FLOAT32_C(   668.58), SIMDE_FLOAT32_C(  -481.32), SIMDE_FLOAT32_C(   872.20) },
+      { SIMDE_FLOAT32_C( 21458.67), SIMDE_FLOAT32_C(204406.97), SIMDE_FLOAT32_C(-190124.22), SIMDE_FLOAT32_C(343535.41) } },
+    { { SIMDE_FLOAT32_C(  -316.90), SIMDE_FLOAT32_C(   183.31), SIMDE_FLOAT32_C(   646.63), SIMDE_FLOAT32_C(  -757.92) },
+      { SIMDE_FLOAT32_C(   142.31), SIMDE_FLOAT32_C(  -137.03), SIMDE_FLOAT32_C(  -120.45), SIMDE_FLOAT32_C(   303.80) },
+      { SIMDE_FLOAT32_C( 45100.04), SIMDE_FLOAT32_C( 25120.97), SIMDE_FLOAT32_C( 77888.59), SIMDE_FLOAT32_C(230258.08) } },
+    { {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   336.50), SIMDE_FLOAT32_C(    80.14) },
+      { SIMDE_FLOAT32_C(     0.00), -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -977.01), SIMDE_FLOAT32_C(  -544.73) },
+      { SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(328765.88), SIMDE_FLOAT32_C( 43656.66) } },
+    { { SIMDE_FLOAT32_C(   -95.98), SIMDE_FLOAT32_C(   964.14), SIMDE_FLOAT32_C(   150.50), SIMDE_FLOAT32_C(  -704.38) },
+      { SIMDE_FLOAT32_C(  -676.13), SIMDE_FLOAT32_C(   551.59), SIMDE_FLOAT32_C(  -212.85), SIMDE_FLOAT32_C(  -517.43) },
+      { SIMDE_FLOAT32_C(-64892.96), SIMDE_FLOAT32_C(-531808.00), SIMDE_FLOAT32_C( 32035.93), SIMDE_FLOAT32_C(-364465.34) } },
+    { { SIMDE_FLOAT32_C(   541.93), SIMDE_FLOAT32_C(  -831.19), SIMDE_FLOAT32_C(  -575.86), SIMDE_FLOAT32_C(  -382.20) },
+      { SIMDE_FLOAT32_C(   -76.31), SIMDE_FLOAT32_C(   879.89), SIMDE_FLOAT32_C(   104.76), SIMDE_FLOAT32_C(  -948.86) },
+      { SIMDE_FLOAT32_C( 41356.68), SIMDE_FLOAT32_C(731357.81), SIMDE_FLOAT32_C( 60329.09), SIMDE_FLOAT32_C(-362652.31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vrecpsq_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vrecpsq_f32(a, b);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrecpsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   158.82), SIMDE_FLOAT64_C(   695.06) },
+      { SIMDE_FLOAT64_C(   843.04), SIMDE_FLOAT64_C(   436.90) },
+      { SIMDE_FLOAT64_C(-133889.61), SIMDE_FLOAT64_C(-303669.71) } },
+    { { SIMDE_FLOAT64_C(   866.64), SIMDE_FLOAT64_C(  -980.45) },
+      { SIMDE_FLOAT64_C(  -848.65), SIMDE_FLOAT64_C(   795.84) },
+      { SIMDE_FLOAT64_C(735476.04), SIMDE_FLOAT64_C(780283.33) } },
+    { { SIMDE_FLOAT64_C(   100.68), SIMDE_FLOAT64_C(   937.56) },
+      { SIMDE_FLOAT64_C(   459.59), SIMDE_FLOAT64_C(   513.75) },
+      { SIMDE_FLOAT64_C(-46269.52), SIMDE_FLOAT64_C(-481669.45) } },
+    { { SIMDE_FLOAT64_C(   521.61), SIMDE_FLOAT64_C(   805.63) },
+      { SIMDE_FLOAT64_C(   159.70), SIMDE_FLOAT64_C(  -306.28) },
+      { SIMDE_FLOAT64_C(-83299.12), SIMDE_FLOAT64_C(246750.36) } },
+    { { SIMDE_FLOAT64_C(   146.86), SIMDE_FLOAT64_C(   796.00) },
+      { SIMDE_FLOAT64_C(   505.54), SIMDE_FLOAT64_C(   684.28) },
+      { SIMDE_FLOAT64_C(-74241.60), SIMDE_FLOAT64_C(-544684.88) } },
+    { {  SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(     0.00) },
+      { SIMDE_FLOAT64_C(     0.00), -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     2.00) } },
+    { { SIMDE_FLOAT64_C(   601.01), SIMDE_FLOAT64_C(  -302.62) },
+      { SIMDE_FLOAT64_C(  -319.44), SIMDE_FLOAT64_C(  -466.00) },
+      { SIMDE_FLOAT64_C(191988.63), SIMDE_FLOAT64_C(-141018.92) } },
+    { { SIMDE_FLOAT64_C(  -295.93), SIMDE_FLOAT64_C(  -556.14) },
+      { SIMDE_FLOAT64_C(   923.87), SIMDE_FLOAT64_C(   837.50) },
+      { SIMDE_FLOAT64_C(273402.85), SIMDE_FLOAT64_C(465769.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vrecpsq_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vrecpsq_f64(a, b);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpss_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpsd_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecps_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecps_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpsq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,615 @@
+#define SIMDE_TEST_ARM_NEON_INSN rshrn_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rshrn_n.h"
+
+static int
+test_simde_vrshrn_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int8_t r1[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r6[8];
+    int8_t r8[8];
+  } test_vec[] = {
+    { {        INT16_MIN,        INT16_MAX,  INT16_C(  5158), -INT16_C( 26402), -INT16_C( 13207), -INT16_C( 31288),  INT16_C( 32534), -INT16_C( 31345) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  19),  INT8_C( 111),  INT8_C(  53), -INT8_C(  28), -INT8_C( 117), -INT8_C(  56) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C( 123),  INT8_C(  28), -INT8_C( 115), -INT8_C(  71), -INT8_C(  29), -INT8_C(  78) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  95), -INT8_C(  57),  INT8_C(  99),  INT8_C(  46), -INT8_C(   7),  INT8_C(  44) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  81),  INT8_C(  99),  INT8_C(  50),  INT8_C(  23), -INT8_C(   4),  INT8_C(  22) },
+      {      INT8_MIN,      INT8_MIN,  INT8_C(  20), -INT8_C( 103), -INT8_C(  52), -INT8_C( 122),      INT8_MAX, -INT8_C( 122) } },
+    { { -INT16_C( 19393),  INT16_C( 20061),  INT16_C( 16686), -INT16_C( 20580), -INT16_C( 22672), -INT16_C(  5316),  INT16_C( 29725),  INT16_C( 30180) },
+      {  INT8_C(  32),  INT8_C(  47), -INT8_C( 105), -INT8_C(  50), -INT8_C(  72), -INT8_C(  98),  INT8_C(  15), -INT8_C(  14) },
+      { -INT8_C( 120), -INT8_C(  52),  INT8_C(  38), -INT8_C(  12), -INT8_C(  18),  INT8_C( 104), -INT8_C( 124), -INT8_C(  67) },
+      { -INT8_C(  94),  INT8_C( 115),  INT8_C(   9),  INT8_C( 125),  INT8_C(  60),  INT8_C(  90), -INT8_C(  95), -INT8_C(  81) },
+      { -INT8_C(  47),  INT8_C(  57),  INT8_C(   5), -INT8_C(  66), -INT8_C(  98), -INT8_C(  83), -INT8_C(  48), -INT8_C(  40) },
+      { -INT8_C(  76),  INT8_C(  78),  INT8_C(  65), -INT8_C(  80), -INT8_C(  89), -INT8_C(  21),  INT8_C( 116),  INT8_C( 118) } },
+    { { -INT16_C( 23046),  INT16_C( 24802),  INT16_C( 26918), -INT16_C(  5398), -INT16_C(   672), -INT16_C( 22311), -INT16_C( 10078), -INT16_C( 17093) },
+      { -INT8_C(   3),  INT8_C( 113), -INT8_C( 109),  INT8_C( 117), -INT8_C(  80),  INT8_C( 109),  INT8_C(  81), -INT8_C(  98) },
+      { -INT8_C(  65),  INT8_C(  28),  INT8_C(  37),  INT8_C(  93), -INT8_C(  84),  INT8_C(  27),  INT8_C(  20), -INT8_C(  89) },
+      {  INT8_C(  48),  INT8_C(   7),  INT8_C(  73),  INT8_C(  87), -INT8_C(  21),  INT8_C(  71), -INT8_C(  59), -INT8_C(  22) },
+      { -INT8_C( 104), -INT8_C( 124), -INT8_C(  91), -INT8_C(  84), -INT8_C(  10), -INT8_C(  93),  INT8_C(  99), -INT8_C(  11) },
+      { -INT8_C(  90),  INT8_C(  97),  INT8_C( 105), -INT8_C(  21), -INT8_C(   3), -INT8_C(  87), -INT8_C(  39), -INT8_C(  67) } },
+    { { -INT16_C( 10963),  INT16_C( 10131),  INT16_C( 22364),  INT16_C(  5300),  INT16_C( 12523), -INT16_C( 30741),  INT16_C( 10052),  INT16_C( 11903) },
+      { -INT8_C( 105), -INT8_C(  54), -INT8_C(  82),  INT8_C(  90),  INT8_C( 118), -INT8_C(  10), -INT8_C(  94),  INT8_C(  64) },
+      { -INT8_C(  90), -INT8_C(  14), -INT8_C(  20), -INT8_C( 105),  INT8_C(  29), -INT8_C(   3), -INT8_C(  23), -INT8_C(  48) },
+      { -INT8_C(  87),  INT8_C(  61), -INT8_C(  69), -INT8_C(  90), -INT8_C( 121),  INT8_C(  63),  INT8_C(  58),  INT8_C( 116) },
+      {  INT8_C(  85), -INT8_C(  98),  INT8_C(  93),  INT8_C(  83), -INT8_C(  60),  INT8_C(  32), -INT8_C(  99), -INT8_C(  70) },
+      { -INT8_C(  43),  INT8_C(  40),  INT8_C(  87),  INT8_C(  21),  INT8_C(  49), -INT8_C( 120),  INT8_C(  39),  INT8_C(  46) } },
+    { {  INT16_C(  8625),  INT16_C( 28894), -INT16_C(  2136),  INT16_C( 22331),  INT16_C( 18490), -INT16_C(  2756), -INT16_C(  8483), -INT16_C(  9868) },
+      { -INT8_C(  39),  INT8_C( 111), -INT8_C(  44), -INT8_C(  98),  INT8_C(  29), -INT8_C(  98),  INT8_C( 111), -INT8_C(  70) },
+      {  INT8_C(  54),  INT8_C(  28), -INT8_C(  11), -INT8_C(  25),  INT8_C(   7), -INT8_C(  88), -INT8_C(  36),  INT8_C(  47) },
+      {  INT8_C(  14), -INT8_C( 121), -INT8_C(  67), -INT8_C(  70),  INT8_C(  66), -INT8_C(  86), -INT8_C(   9), -INT8_C(  52) },
+      { -INT8_C( 121), -INT8_C(  61), -INT8_C(  33),  INT8_C(  93),  INT8_C(  33), -INT8_C(  43),  INT8_C( 123),  INT8_C( 102) },
+      {  INT8_C(  34),  INT8_C( 113), -INT8_C(   8),  INT8_C(  87),  INT8_C(  72), -INT8_C(  11), -INT8_C(  33), -INT8_C(  39) } },
+    { {  INT16_C( 15217), -INT16_C( 23510), -INT16_C( 24923),  INT16_C(  8862),  INT16_C( 16331),  INT16_C(  6540),  INT16_C( 20129), -INT16_C(  1025) },
+      { -INT8_C(  71),  INT8_C(  21),  INT8_C(  83),  INT8_C(  79), -INT8_C(  26), -INT8_C(  58),  INT8_C(  81),  INT8_C(   0) },
+      {  INT8_C( 110), -INT8_C( 123), -INT8_C(  43),  INT8_C(  84), -INT8_C(   7),  INT8_C(  50), -INT8_C(  44),      INT8_MIN },
+      { -INT8_C(  36),  INT8_C(  33), -INT8_C(  11),  INT8_C(  21), -INT8_C(   2), -INT8_C(  52),  INT8_C( 117), -INT8_C(  32) },
+      { -INT8_C(  18), -INT8_C( 111),  INT8_C( 123), -INT8_C( 118), -INT8_C(   1),  INT8_C( 102),  INT8_C(  59), -INT8_C(  16) },
+      {  INT8_C(  59), -INT8_C(  92), -INT8_C(  97),  INT8_C(  35),  INT8_C(  64),  INT8_C(  26),  INT8_C(  79), -INT8_C(   4) } },
+    { { -INT16_C( 16543), -INT16_C( 23804), -INT16_C( 25666), -INT16_C( 25906), -INT16_C(  3546), -INT16_C(  6799),  INT16_C( 15561), -INT16_C(  5281) },
+      { -INT8_C(  79), -INT8_C( 126), -INT8_C(  33),  INT8_C( 103),  INT8_C(  19), -INT8_C(  71),  INT8_C( 101), -INT8_C(  80) },
+      { -INT8_C(  20),  INT8_C(  97),  INT8_C( 120),  INT8_C(  90),  INT8_C(  69), -INT8_C(  82), -INT8_C( 103),  INT8_C( 108) },
+      { -INT8_C(   5),  INT8_C(  24), -INT8_C(  34), -INT8_C(  42), -INT8_C( 111),  INT8_C(  44), -INT8_C(  26),  INT8_C(  91) },
+      { -INT8_C(   2), -INT8_C( 116),  INT8_C( 111),  INT8_C( 107), -INT8_C(  55), -INT8_C( 106), -INT8_C(  13), -INT8_C(  83) },
+      { -INT8_C(  65), -INT8_C(  93), -INT8_C( 100), -INT8_C( 101), -INT8_C(  14), -INT8_C(  27),  INT8_C(  61), -INT8_C(  21) } },
+    { {  INT16_C( 17725),  INT16_C( 30252),  INT16_C(  4116),  INT16_C( 12311),  INT16_C( 14026),  INT16_C( 24676), -INT16_C(  1270), -INT16_C( 24612) },
+      { -INT8_C(  97),  INT8_C(  22),  INT8_C(  10),  INT8_C(  12),  INT8_C( 101),  INT8_C(  50), -INT8_C( 123), -INT8_C(  18) },
+      { -INT8_C(  88), -INT8_C(  58),  INT8_C(   3),  INT8_C(   3), -INT8_C(  39),  INT8_C(  13),  INT8_C(  97), -INT8_C(   4) },
+      {  INT8_C(  42), -INT8_C(  79), -INT8_C( 127), -INT8_C( 127), -INT8_C(  74),  INT8_C(   3), -INT8_C(  40), -INT8_C(   1) },
+      {  INT8_C(  21), -INT8_C(  39),  INT8_C(  64), -INT8_C(  64), -INT8_C(  37), -INT8_C( 126), -INT8_C(  20),      INT8_MAX },
+      {  INT8_C(  69),  INT8_C( 118),  INT8_C(  16),  INT8_C(  48),  INT8_C(  55),  INT8_C(  96), -INT8_C(   5), -INT8_C(  96) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+
+    simde_int8x8_t r1 = simde_vrshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vrshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vrshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vrshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vrshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r6, simde_vld1_s8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i8x8(r8, simde_vld1_s8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+
+    simde_int8x8_t r1 = simde_vrshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vrshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vrshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vrshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vrshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrshrn_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int16_t r1[4];
+    int16_t r6[4];
+    int16_t r10[4];
+    int16_t r13[4];
+    int16_t r16[4];
+  } test_vec[] = {
+    { {              INT32_MIN,              INT32_MAX,  INT32_C(  2042294755), -INT32_C(  1776116108) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 30962),  INT16_C( 20282) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(  5176), -INT16_C( 30086) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 28348), -INT16_C( 30552) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 12840), -INT16_C( 20203) },
+      {        INT16_MIN,        INT16_MIN,  INT16_C( 31163), -INT16_C( 27101) } },
+    { {  INT32_C(  1463899455), -INT32_C(    34120360), -INT32_C(  1032028365),  INT32_C(  1954921047) },
+      { -INT16_C( 21856), -INT16_C( 20820),  INT16_C( 16282), -INT16_C(  8916) },
+      {  INT16_C(  1365), -INT16_C(  8843), -INT16_C(  3587),  INT16_C(  5865) },
+      { -INT16_C( 12203),  INT16_C( 32215), -INT16_C( 24800),  INT16_C(  8559) },
+      { -INT16_C( 17909), -INT16_C(  4165),  INT16_C(  5092), -INT16_C( 23506) },
+      {  INT16_C( 22337), -INT16_C(   521), -INT16_C( 15748),  INT16_C( 29830) } },
+    { { -INT32_C(  1334993649), -INT32_C(   548936212),  INT32_C(   668389131), -INT32_C(   589112167) },
+      { -INT16_C( 12664), -INT16_C(  3338),  INT16_C( 26502),  INT16_C( 28237) },
+      { -INT16_C( 18828),  INT16_C(  8088),  INT16_C( 23356), -INT16_C( 29838) },
+      {  INT16_C(  7015), -INT16_C( 11783), -INT16_C(  2636),  INT16_C( 14519) },
+      { -INT16_C( 31891), -INT16_C(  1473),  INT16_C( 16054), -INT16_C(  6377) },
+      { -INT16_C( 20370), -INT16_C(  8376),  INT16_C( 10199), -INT16_C(  8989) } },
+    { {  INT32_C(   198930805), -INT32_C(   291582757),  INT32_C(   745113797),  INT32_C(   724908804) },
+      { -INT16_C( 18245),  INT16_C( 26222), -INT16_C( 15261), -INT16_C( 25214) },
+      {  INT16_C( 28102),  INT16_C( 31539), -INT16_C( 23005), -INT16_C( 11028) },
+      { -INT16_C(  2340), -INT16_C( 22605),  INT16_C(  6754), -INT16_C( 12977) },
+      {  INT16_C( 24284),  INT16_C( 29942),  INT16_C( 25420),  INT16_C( 22954) },
+      {  INT16_C(  3035), -INT16_C(  4449),  INT16_C( 11370),  INT16_C( 11061) } },
+    { { -INT32_C(   785383357),  INT32_C(   814619367), -INT32_C(  1147192764), -INT32_C(   751941353) },
+      {  INT16_C(    34),  INT16_C(  3444), -INT16_C( 25310),  INT16_C(  9356) },
+      { -INT16_C( 16383),  INT16_C( 14444),  INT16_C( 31977), -INT16_C( 18140) },
+      {  INT16_C( 19456),  INT16_C(  9095), -INT16_C(  6193), -INT16_C( 13422) },
+      { -INT16_C( 30336), -INT16_C( 31631), -INT16_C(  8966), -INT16_C( 26254) },
+      { -INT16_C( 11984),  INT16_C( 12430), -INT16_C( 17505), -INT16_C( 11474) } },
+    { {  INT32_C(   972461441),  INT32_C(    54121231),  INT32_C(  1005849600),  INT32_C(  1185581264) },
+      {  INT16_C( 19137), -INT16_C(  5752),  INT16_C(  1536),  INT16_C( 17512) },
+      { -INT16_C(  9642), -INT16_C(  6324), -INT16_C( 12240), -INT16_C( 21981) },
+      {  INT16_C( 32165), -INT16_C( 12683), -INT16_C(   765), -INT16_C( 21854) },
+      { -INT16_C( 12363),  INT16_C(  6607), -INT16_C(  8288),  INT16_C( 13652) },
+      {  INT16_C( 14839),  INT16_C(   826),  INT16_C( 15348),  INT16_C( 18091) } },
+    { {  INT32_C(  1319743032),  INT32_C(  2043257412), -INT32_C(  1377597172), -INT32_C(  1624160339) },
+      { -INT16_C( 10468), -INT16_C( 11998), -INT16_C( 15226), -INT16_C( 23593) },
+      { -INT16_C( 22855),  INT16_C(  9865), -INT16_C( 29148), -INT16_C( 15073) },
+      { -INT16_C( 21908),  INT16_C( 29289),  INT16_C( 30946), -INT16_C( 13230) },
+      {  INT16_C( 30029), -INT16_C( 12723),  INT16_C( 28444), -INT16_C(  1654) },
+      {  INT16_C( 20138),  INT16_C( 31178), -INT16_C( 21020), -INT16_C( 24783) } },
+    { { -INT32_C(  1080760675), -INT32_C(  1798656966),  INT32_C(  1023483024), -INT32_C(   461502585) },
+      {  INT16_C( 29519),  INT16_C( 22045), -INT16_C( 29112),  INT16_C(   964) },
+      {  INT16_C( 21402),  INT16_C( 10929),  INT16_C(  1138), -INT16_C(  2018) },
+      { -INT16_C(  6854),  INT16_C( 12971),  INT16_C( 16455),  INT16_C(  8066) },
+      { -INT16_C(   857), -INT16_C( 22955), -INT16_C(  6135),  INT16_C(  9200) },
+      { -INT16_C( 16491), -INT16_C( 27445),  INT16_C( 15617), -INT16_C(  7042) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_int16x4_t r1 = simde_vrshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vrshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vrshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vrshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vrshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i16x4(r6, simde_vld1_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x4(r10, simde_vld1_s16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i16x4(r13, simde_vld1_s16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i16x4(r16, simde_vld1_s16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+
+    simde_int16x4_t r1 = simde_vrshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vrshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vrshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vrshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vrshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrshrn_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int32_t r1[2];
+    int32_t r13[2];
+    int32_t r19[2];
+    int32_t r26[2];
+    int32_t r32[2];
+  } test_vec[] = {
+    { {                      INT64_MIN,                      INT64_MAX },
+      {  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0) },
+      {              INT32_MIN,              INT32_MIN } },
+    { {  INT64_C( 8746160909012309813),  INT64_C( 5215024339136386739) },
+      { -INT32_C(   116716645), -INT32_C(   962671782) },
+      { -INT32_C(   670068559), -INT32_C(   401839635) },
+      {  INT32_C(   325074499), -INT32_C(   274714200) },
+      {  INT32_C(  1478934653),  INT32_C(   400506979) },
+      {  INT32_C(  2036374274),  INT32_C(  1214217474) } },
+    { {  INT64_C(  546933556259173412),  INT64_C( 6351717055082764020) },
+      { -INT32_C(   129443310),  INT32_C(   520080250) },
+      { -INT32_C(   916487026), -INT32_C(  1475219459) },
+      { -INT32_C(   484082158), -INT32_C(  1163900992) },
+      { -INT32_C(   439989508),  INT32_C(   158679183) },
+      {  INT32_C(   127342892),  INT32_C(  1478874370) } },
+    { { -INT64_C( 7440317044103167759),  INT64_C( 5414518960154364581) },
+      { -INT32_C(   788979591),  INT32_C(  1221535059) },
+      {  INT32_C(  2022510482), -INT32_C(   495678222) },
+      { -INT32_C(   706595778), -INT32_C(  2021010892) },
+      {  INT32_C(   799786088), -INT32_C(   921758812) },
+      { -INT32_C(  1732333806),  INT32_C(  1260665935) } },
+    { {  INT64_C( 4037590315343261102), -INT64_C( 3081832547361067981) },
+      { -INT32_C(   146024745),  INT32_C(   782710298) },
+      {  INT32_C(   939488445),  INT32_C(   218294899) },
+      {  INT32_C(   216006099),  INT32_C(  1681132458) },
+      {  INT32_C(    35241980),  INT32_C(  1321756695) },
+      {  INT32_C(   940074752), -INT32_C(   717545056) } },
+    { { -INT64_C( 3781157389575690565), -INT64_C( 1273610902451163557) },
+      { -INT32_C(  1656769698), -INT32_C(   391465170) },
+      {  INT32_C(   186242043), -INT32_C(   854685013) },
+      { -INT32_C(   735287472),  INT32_C(  1731476011) },
+      { -INT32_C(   509060913), -INT32_C(  1798412172) },
+      { -INT32_C(   880369309), -INT32_C(   296535646) } },
+    { { -INT64_C( 4017423567482953109),  INT64_C( 7244294333594172002) },
+      {  INT32_C(  2045948214),  INT32_C(  1092664625) },
+      { -INT32_C(   194535637),  INT32_C(   981733900) },
+      { -INT32_C(   405692803),  INT32_C(   485101640) },
+      {  INT32_C(   265265981),  INT32_C(   574215201) },
+      { -INT32_C(   935379315),  INT32_C(  1686693713) } },
+    { {  INT64_C( 1382795354082958625),  INT64_C( 6603932708149261735) },
+      {  INT32_C(   714501777), -INT32_C(  1964442924) },
+      {  INT32_C(  1751296359),  INT32_C(   242790032) },
+      {  INT32_C(   362908326), -INT32_C(  1137057094) },
+      { -INT32_C(   869580011), -INT32_C(   377982011) },
+      {  INT32_C(   321957132),  INT32_C(  1537597903) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_int32x2_t r1 = simde_vrshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vrshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vrshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vrshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vrshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x2(r13, simde_vld1_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x2(r19, simde_vld1_s32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i32x2(r26, simde_vld1_s32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_i32x2(r32, simde_vld1_s32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+
+    simde_int32x2_t r1 = simde_vrshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vrshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vrshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vrshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vrshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrshrn_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r6[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(60628), UINT16_C(29632), UINT16_C(23413), UINT16_C(62973), UINT16_C(29404), UINT16_C(30886) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(106), UINT8_C(224), UINT8_C(187),    UINT8_MAX, UINT8_C(110), UINT8_C( 83) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(155), UINT8_C(120), UINT8_C(111), UINT8_C(192), UINT8_C( 92), UINT8_C( 21) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(103), UINT8_C(158), UINT8_C(220), UINT8_C(176), UINT8_C(151), UINT8_C(197) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(179), UINT8_C(207), UINT8_C(110), UINT8_C(216), UINT8_C(203), UINT8_C(227) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(237), UINT8_C(116), UINT8_C( 91), UINT8_C(246), UINT8_C(115), UINT8_C(121) } },
+    { { UINT16_C(36985), UINT16_C(27111), UINT16_C(15586), UINT16_C( 2210), UINT16_C( 7109), UINT16_C(10684), UINT16_C(34014), UINT16_C( 2000) },
+      { UINT8_C( 61), UINT8_C(244), UINT8_C(113), UINT8_C( 81), UINT8_C(227), UINT8_C(222), UINT8_C(111), UINT8_C(232) },
+      { UINT8_C( 15), UINT8_C( 61), UINT8_C(156), UINT8_C( 20), UINT8_C(121), UINT8_C( 56), UINT8_C(156), UINT8_C(250) },
+      { UINT8_C(132), UINT8_C( 79), UINT8_C(231), UINT8_C( 69), UINT8_C(222), UINT8_C( 78), UINT8_C( 39), UINT8_C( 63) },
+      { UINT8_C( 66), UINT8_C(168), UINT8_C(244), UINT8_C( 35), UINT8_C(111), UINT8_C(167), UINT8_C( 19), UINT8_C( 31) },
+      { UINT8_C(144), UINT8_C(106), UINT8_C( 61), UINT8_C(  9), UINT8_C( 28), UINT8_C( 42), UINT8_C(133), UINT8_C(  8) } },
+    { { UINT16_C(63391), UINT16_C(50604), UINT16_C(57144), UINT16_C(51030), UINT16_C(19793), UINT16_C(41525), UINT16_C(51399), UINT16_C(35466) },
+      { UINT8_C(208), UINT8_C(214), UINT8_C(156), UINT8_C(171), UINT8_C(169), UINT8_C( 27), UINT8_C(100), UINT8_C( 69) },
+      { UINT8_C(244), UINT8_C(182), UINT8_C(231), UINT8_C(235), UINT8_C(170), UINT8_C( 71), UINT8_C( 25), UINT8_C( 81) },
+      { UINT8_C(189), UINT8_C( 45), UINT8_C(250), UINT8_C( 59), UINT8_C(107), UINT8_C( 18), UINT8_C( 70), UINT8_C( 84) },
+      { UINT8_C(222), UINT8_C( 23), UINT8_C(125), UINT8_C( 29), UINT8_C( 53), UINT8_C(137), UINT8_C( 35), UINT8_C( 42) },
+      { UINT8_C(248), UINT8_C(198), UINT8_C(223), UINT8_C(199), UINT8_C( 77), UINT8_C(162), UINT8_C(201), UINT8_C(139) } },
+    { { UINT16_C(54522), UINT16_C( 4591), UINT16_C(38223), UINT16_C(43180), UINT16_C(23560), UINT16_C(64202), UINT16_C(12836), UINT16_C(59668) },
+      { UINT8_C(125), UINT8_C(248), UINT8_C(168), UINT8_C( 86), UINT8_C(  4), UINT8_C(101), UINT8_C( 18), UINT8_C(138) },
+      { UINT8_C(159), UINT8_C( 62), UINT8_C(170), UINT8_C( 22), UINT8_C(129), UINT8_C( 89), UINT8_C( 69), UINT8_C( 35) },
+      { UINT8_C(168), UINT8_C(143), UINT8_C(170), UINT8_C( 69), UINT8_C(224), UINT8_C(214), UINT8_C(145), UINT8_C( 73) },
+      { UINT8_C( 84), UINT8_C( 72), UINT8_C( 85), UINT8_C(163), UINT8_C(112), UINT8_C(235), UINT8_C(201), UINT8_C(164) },
+      { UINT8_C(213), UINT8_C( 18), UINT8_C(149), UINT8_C(169), UINT8_C( 92), UINT8_C(251), UINT8_C( 50), UINT8_C(233) } },
+    { { UINT16_C(46112), UINT16_C(49943), UINT16_C(44983), UINT16_C(39753), UINT16_C(14004), UINT16_C(23412), UINT16_C( 9265), UINT16_C(62141) },
+      { UINT8_C( 16), UINT8_C(140), UINT8_C(220), UINT8_C(165), UINT8_C( 90), UINT8_C(186), UINT8_C( 25), UINT8_C( 95) },
+      { UINT8_C(132), UINT8_C( 99), UINT8_C(247), UINT8_C(105), UINT8_C(215), UINT8_C(111), UINT8_C(134), UINT8_C( 88) },
+      { UINT8_C(161), UINT8_C( 25), UINT8_C(126), UINT8_C(218), UINT8_C(182), UINT8_C(220), UINT8_C( 34), UINT8_C(150) },
+      { UINT8_C(209), UINT8_C( 12), UINT8_C(191), UINT8_C(109), UINT8_C(219), UINT8_C(110), UINT8_C(145), UINT8_C(203) },
+      { UINT8_C(180), UINT8_C(195), UINT8_C(176), UINT8_C(155), UINT8_C( 55), UINT8_C( 91), UINT8_C( 36), UINT8_C(243) } },
+    { { UINT16_C( 7470), UINT16_C(42289), UINT16_C(54282), UINT16_C(34073), UINT16_C(58031), UINT16_C(13996), UINT16_C(33871), UINT16_C(16565) },
+      { UINT8_C(151), UINT8_C(153), UINT8_C(  5), UINT8_C(141), UINT8_C( 88), UINT8_C( 86), UINT8_C( 40), UINT8_C( 91) },
+      { UINT8_C(166), UINT8_C(166), UINT8_C(129), UINT8_C(163), UINT8_C( 86), UINT8_C(214), UINT8_C(138), UINT8_C( 23) },
+      { UINT8_C(233), UINT8_C( 42), UINT8_C(160), UINT8_C( 41), UINT8_C( 21), UINT8_C(181), UINT8_C( 34), UINT8_C(  6) },
+      { UINT8_C(117), UINT8_C(149), UINT8_C( 80), UINT8_C( 20), UINT8_C(139), UINT8_C(219), UINT8_C( 17), UINT8_C(  3) },
+      { UINT8_C( 29), UINT8_C(165), UINT8_C(212), UINT8_C(133), UINT8_C(227), UINT8_C( 55), UINT8_C(132), UINT8_C( 65) } },
+    { { UINT16_C(40038), UINT16_C(41284), UINT16_C(46357), UINT16_C(24282), UINT16_C(10280), UINT16_C(18224), UINT16_C(34046), UINT16_C(55679) },
+      { UINT8_C( 51), UINT8_C(162), UINT8_C(139), UINT8_C(109), UINT8_C( 20), UINT8_C(152), UINT8_C(127), UINT8_C(192) },
+      { UINT8_C(141), UINT8_C( 41), UINT8_C(163), UINT8_C(219), UINT8_C(  5), UINT8_C(230), UINT8_C(160), UINT8_C( 48) },
+      { UINT8_C(227), UINT8_C( 10), UINT8_C(169), UINT8_C(247), UINT8_C( 65), UINT8_C( 58), UINT8_C( 40), UINT8_C(204) },
+      { UINT8_C(114), UINT8_C(133), UINT8_C(212), UINT8_C(123), UINT8_C(161), UINT8_C( 29), UINT8_C( 20), UINT8_C(102) },
+      { UINT8_C(156), UINT8_C(161), UINT8_C(181), UINT8_C( 95), UINT8_C( 40), UINT8_C( 71), UINT8_C(133), UINT8_C(217) } },
+    { { UINT16_C(29370), UINT16_C(18844), UINT16_C(56982), UINT16_C(57649), UINT16_C(10742), UINT16_C(18664), UINT16_C(55503), UINT16_C(37965) },
+      { UINT8_C( 93), UINT8_C(206), UINT8_C( 75), UINT8_C(153), UINT8_C(251), UINT8_C(116), UINT8_C(104), UINT8_C( 39) },
+      { UINT8_C( 87), UINT8_C( 52), UINT8_C(211), UINT8_C( 38), UINT8_C( 63), UINT8_C( 29), UINT8_C( 26), UINT8_C(138) },
+      { UINT8_C(150), UINT8_C( 77), UINT8_C(245), UINT8_C( 10), UINT8_C( 80), UINT8_C( 71), UINT8_C(198), UINT8_C(162) },
+      { UINT8_C(203), UINT8_C( 38), UINT8_C(122), UINT8_C(133), UINT8_C(168), UINT8_C( 36), UINT8_C( 99), UINT8_C( 81) },
+      { UINT8_C(115), UINT8_C( 74), UINT8_C(223), UINT8_C(225), UINT8_C( 42), UINT8_C( 73), UINT8_C(217), UINT8_C(148) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+
+    simde_uint8x8_t r1 = simde_vrshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vrshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vrshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vrshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vrshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r6, simde_vld1_u8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a = simde_test_arm_neon_random_u16x8();
+
+    simde_uint8x8_t r1 = simde_vrshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vrshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vrshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vrshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vrshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_write_u16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrshrn_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r10[4];
+    uint16_t r13[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(2622616722), UINT32_C(  69222972) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(64073), UINT16_C( 8478) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(18386), UINT16_C(33033) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C( 5245), UINT16_C( 2065) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(58000), UINT16_C( 8450) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(40018), UINT16_C( 1056) } },
+    { { UINT32_C(3829241454), UINT32_C(3630187388), UINT32_C( 327146267), UINT32_C(1037218914) },
+      { UINT16_C(52023), UINT16_C( 8638), UINT16_C(60814), UINT16_C(23089) },
+      { UINT16_C(63066), UINT16_C(33038), UINT16_C(65388), UINT16_C(19154) },
+      { UINT16_C( 3942), UINT16_C( 6161), UINT16_C(57335), UINT16_C(29869) },
+      { UINT16_C( 8685), UINT16_C(49922), UINT16_C(39935), UINT16_C(61078) },
+      { UINT16_C(58430), UINT16_C(55392), UINT16_C( 4992), UINT16_C(15827) } },
+    { { UINT32_C(2077046400), UINT32_C(3929388985), UINT32_C(  19068762), UINT32_C(1061527701) },
+      { UINT16_C(39744), UINT16_C(56285), UINT16_C(31661), UINT16_C(53323) },
+      { UINT16_C(13530), UINT16_C(55007), UINT16_C(35805), UINT16_C( 5762) },
+      { UINT16_C(62286), UINT16_C(36206), UINT16_C(18622), UINT16_C(53608) },
+      { UINT16_C(56938), UINT16_C(20910), UINT16_C( 2328), UINT16_C(64045) },
+      { UINT16_C(31693), UINT16_C(59958), UINT16_C(  291), UINT16_C(16198) } },
+    { { UINT32_C(2186786209), UINT32_C(3315105087), UINT32_C(2085852165), UINT32_C(4095152706) },
+      { UINT16_C(56017), UINT16_C(16032), UINT16_C(51715), UINT16_C(35105) },
+      { UINT16_C(24279), UINT16_C(25077), UINT16_C(20048), UINT16_C(23625) },
+      { UINT16_C(38381), UINT16_C(26143), UINT16_C( 5349), UINT16_C( 1477) },
+      { UINT16_C( 4798), UINT16_C(11460), UINT16_C(58013), UINT16_C(41145) },
+      { UINT16_C(33368), UINT16_C(50584), UINT16_C(31828), UINT16_C(62487) } },
+    { { UINT32_C(4121981757), UINT32_C(3291594976), UINT32_C(2087738019), UINT32_C( 598339768) },
+      { UINT16_C(14751), UINT16_C(57456), UINT16_C(11602), UINT16_C(63580) },
+      { UINT16_C(49613), UINT16_C(50948), UINT16_C(49515), UINT16_C(42947) },
+      { UINT16_C(27677), UINT16_C( 3184), UINT16_C( 7191), UINT16_C(60028) },
+      { UINT16_C(44420), UINT16_C( 8590), UINT16_C(58243), UINT16_C( 7504) },
+      { UINT16_C(62896), UINT16_C(50226), UINT16_C(31856), UINT16_C( 9130) } },
+    { { UINT32_C(3906576169), UINT32_C(2307615024), UINT32_C(3131932964), UINT32_C( 989458188) },
+      { UINT16_C(53141), UINT16_C(46232), UINT16_C(49298), UINT16_C(63366) },
+      { UINT16_C(26237), UINT16_C(11685), UINT16_C(46597), UINT16_C(59324) },
+      { UINT16_C(13928), UINT16_C(25306), UINT16_C(43872), UINT16_C(48764) },
+      { UINT16_C(18125), UINT16_C(19547), UINT16_C(54636), UINT16_C(55247) },
+      { UINT16_C(59610), UINT16_C(35211), UINT16_C(47790), UINT16_C(15098) } },
+    { { UINT32_C(3615477607), UINT32_C(2583578923), UINT32_C(1504058782), UINT32_C(4070407117) },
+      { UINT16_C(59316), UINT16_C( 9366), UINT16_C( 3791), UINT16_C(48615) },
+      { UINT16_C(65342), UINT16_C(63781), UINT16_C(39030), UINT16_C(30191) },
+      { UINT16_C(57332), UINT16_C(32658), UINT16_C(27015), UINT16_C(42847) },
+      { UINT16_C(48126), UINT16_C(53234), UINT16_C(52529), UINT16_C(38124) },
+      { UINT16_C(55168), UINT16_C(39422), UINT16_C(22950), UINT16_C(62109) } },
+    { { UINT32_C( 411168518), UINT32_C(2599723556), UINT32_C(2737966601), UINT32_C(2793392281) },
+      { UINT16_C(63363), UINT16_C(20754), UINT16_C( 1797), UINT16_C(58445) },
+      { UINT16_C( 1980), UINT16_C(53897), UINT16_C(51256), UINT16_C(65314) },
+      { UINT16_C( 8316), UINT16_C(48425), UINT16_C(52356), UINT16_C(40946) },
+      { UINT16_C(50191), UINT16_C(55205), UINT16_C( 6544), UINT16_C(13310) },
+      { UINT16_C( 6274), UINT16_C(39669), UINT16_C(41778), UINT16_C(42624) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+
+    simde_uint16x4_t r1 = simde_vrshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vrshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vrshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vrshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vrshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r13, simde_vld1_u16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+
+    simde_uint16x4_t r1 = simde_vrshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vrshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vrshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vrshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vrshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrshrn_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r19[2];
+    uint32_t r26[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { { UINT64_C(                   0),                     UINT64_MAX },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { UINT64_C(12207032586331245732), UINT64_C(18144572987929951719) },
+      { UINT32_C( 384968274), UINT32_C(3445309172) },
+      { UINT32_C(3148967714), UINT32_C(3355235764) },
+      { UINT32_C(  49202621), UINT32_C(3474977623) },
+      { UINT32_C(1510333835), UINT32_C(4087234535) },
+      { UINT32_C(2842171254), UINT32_C(4224612608) } },
+    { { UINT64_C( 4213455348363322862), UINT64_C(10666510253922765144) },
+      { UINT32_C(1645556471), UINT32_C(4212155564) },
+      { UINT32_C(2592481619), UINT32_C(1954525446) },
+      { UINT32_C( 644487301), UINT32_C(3788635844) },
+      { UINT32_C(2655835185), UINT32_C(  29598718) },
+      { UINT32_C( 981021521), UINT32_C(2483490448) } },
+    { { UINT64_C( 6328175883890849213), UINT64_C(11079114500106835483) },
+      { UINT32_C( 432077535), UINT32_C( 375368462) },
+      { UINT32_C(2474744848), UINT32_C(1602315771) },
+      { UINT32_C(1179518576), UINT32_C( 494798232) },
+      { UINT32_C(4102855693), UINT32_C(1882913803) },
+      { UINT32_C(1473393264), UINT32_C(2579557360) } },
+    { { UINT64_C( 4254287927380674894), UINT64_C(13866361915717218762) },
+      { UINT32_C( 903939239), UINT32_C(4239014117) },
+      { UINT32_C( 581131792), UINT32_C(3046099620) },
+      { UINT32_C(1217039736), UINT32_C(3872800555) },
+      { UINT32_C(3264288027), UINT32_C( 466463870) },
+      { UINT32_C( 990528596), UINT32_C(3228513970) } },
+    { { UINT64_C(17758403135290563410), UINT64_C(18060330128736518621) },
+      { UINT32_C( 546745769), UINT32_C(1020264687) },
+      { UINT32_C( 746719595), UINT32_C(1954794752) },
+      { UINT32_C(1353844774), UINT32_C(1708265268) },
+      { UINT32_C(2627822608), UINT32_C(2831918110) },
+      { UINT32_C(4134700432), UINT32_C(4204998288) } },
+    { { UINT64_C(10313351063664387789), UINT64_C( 8629014250584486327) },
+      { UINT32_C( 818836327), UINT32_C( 133142748) },
+      { UINT32_C( 288558311), UINT32_C(1441824506) },
+      { UINT32_C( 205835316), UINT32_C( 223855100) },
+      { UINT32_C(3357051288), UINT32_C(4028280708) },
+      { UINT32_C(2401264166), UINT32_C(2009098942) } },
+    { { UINT64_C( 6714735388798803406), UINT64_C( 3656942913290353361) },
+      { UINT32_C(1158442727), UINT32_C( 658955625) },
+      { UINT32_C(1108627655), UINT32_C(2443342958) },
+      { UINT32_C(4043854147), UINT32_C(  38177234) },
+      { UINT32_C(1273106595), UINT32_C(2953088276) },
+      { UINT32_C(1563396163), UINT32_C( 851448372) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vrshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vrshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vrshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vrshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vrshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r19, simde_vld1_u32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u32x2(r26, simde_vld1_u32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a = simde_test_arm_neon_random_u64x2();
+
+    simde_uint32x2_t r1 = simde_vrshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vrshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vrshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vrshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vrshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrshrn_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrshrn_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrshrn_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrshrn_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrshrn_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrshrn_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,383 @@
+#define SIMDE_TEST_ARM_NEON_INSN rsqrte
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rsqrte.h"
+
+static int
+test_simde_vrsqrtes_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(    33.3100),
+      SIMDE_FLOAT32_C(     0.1733) },
+    { SIMDE_FLOAT32_C(    72.9300),
+      SIMDE_FLOAT32_C(     0.1172) },
+    { SIMDE_FLOAT32_C(    53.9100),
+      SIMDE_FLOAT32_C(     0.1362) },
+    { SIMDE_FLOAT32_C(    36.9900),
+      SIMDE_FLOAT32_C(     0.1646) },
+    { SIMDE_FLOAT32_C(    42.3600),
+      SIMDE_FLOAT32_C(     0.1538) },
+    { SIMDE_FLOAT32_C(     0.0000),
+       SIMDE_MATH_INFINITYF },
+    { SIMDE_FLOAT32_C(    30.8600),
+      SIMDE_FLOAT32_C(     0.1802) },
+    { SIMDE_FLOAT32_C(    92.2600),
+      SIMDE_FLOAT32_C(     0.1040) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_vrsqrtes_f32(test_vec[i].a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(0.25f, 100.0f);
+    simde_float32 r = simde_vrsqrtes_f32(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrted_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(     0.7000),
+      SIMDE_FLOAT64_C(     1.1953) },
+    { SIMDE_FLOAT64_C(    31.0000),
+      SIMDE_FLOAT64_C(     0.1792) },
+    { SIMDE_FLOAT64_C(    57.4100),
+      SIMDE_FLOAT64_C(     0.1318) },
+    { SIMDE_FLOAT64_C(    76.7900),
+      SIMDE_FLOAT64_C(     0.1143) },
+    { SIMDE_FLOAT64_C(    39.5100),
+      SIMDE_FLOAT64_C(     0.1587) },
+    { SIMDE_FLOAT64_C(     0.0000),
+       SIMDE_MATH_INFINITY },
+    { SIMDE_FLOAT64_C(     3.6800),
+      SIMDE_FLOAT64_C(     0.5215) },
+    { SIMDE_FLOAT64_C(    57.3800),
+      SIMDE_FLOAT64_C(     0.1318) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r = simde_vrsqrted_f64(test_vec[i].a);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(0.25, 100.0);
+    simde_float64 r = simde_vrsqrted_f64(a);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrte_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    72.8700), SIMDE_FLOAT32_C(    39.4500) },
+      { SIMDE_FLOAT32_C(     0.1172), SIMDE_FLOAT32_C(     0.1592) } },
+    { { SIMDE_FLOAT32_C(    18.3000), SIMDE_FLOAT32_C(    81.0300) },
+      { SIMDE_FLOAT32_C(     0.2339), SIMDE_FLOAT32_C(     0.1108) } },
+    { { SIMDE_FLOAT32_C(    36.9300), SIMDE_FLOAT32_C(    36.8100) },
+      { SIMDE_FLOAT32_C(     0.1646), SIMDE_FLOAT32_C(     0.1646) } },
+    { { SIMDE_FLOAT32_C(    12.0900), SIMDE_FLOAT32_C(    93.2400) },
+      { SIMDE_FLOAT32_C(     0.2871), SIMDE_FLOAT32_C(     0.1035) } },
+    { { SIMDE_FLOAT32_C(    24.3100), SIMDE_FLOAT32_C(    38.1400) },
+      { SIMDE_FLOAT32_C(     0.2026), SIMDE_FLOAT32_C(     0.1621) } },
+    { { SIMDE_FLOAT32_C(     0.0000),  SIMDE_MATH_INFINITYF },
+      {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.0000) } },
+    { { SIMDE_FLOAT32_C(    51.8000), SIMDE_FLOAT32_C(    59.8100) },
+      { SIMDE_FLOAT32_C(     0.1387), SIMDE_FLOAT32_C(     0.1294) } },
+    { { SIMDE_FLOAT32_C(    64.0000), SIMDE_FLOAT32_C(    89.3100) },
+      { SIMDE_FLOAT32_C(     0.1248), SIMDE_FLOAT32_C(     0.1060) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t r = simde_vrsqrte_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(0.25f, 100.0f);
+    simde_float32x2_t r = simde_vrsqrte_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrte_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    71.6900) },
+      { SIMDE_FLOAT64_C(     0.1182) } },
+    { { SIMDE_FLOAT64_C(    68.4100) },
+      { SIMDE_FLOAT64_C(     0.1211) } },
+    { { SIMDE_FLOAT64_C(    58.5900) },
+      { SIMDE_FLOAT64_C(     0.1304) } },
+    { { SIMDE_FLOAT64_C(    79.8300) },
+      { SIMDE_FLOAT64_C(     0.1121) } },
+    { { SIMDE_FLOAT64_C(    23.7300) },
+      { SIMDE_FLOAT64_C(     0.2056) } },
+    { { SIMDE_FLOAT64_C(     0.0000) },
+      {  SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C(    46.4800) },
+      { SIMDE_FLOAT64_C(     0.1470) } },
+    { { SIMDE_FLOAT64_C(    47.2900) },
+      { SIMDE_FLOAT64_C(     0.1455) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t r = simde_vrsqrte_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(0.25, 100.0);
+    simde_float64x1_t r = simde_vrsqrte_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrte_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(1872050268), UINT32_C(2002423764) },
+      { UINT32_C(3246391296), UINT32_C(3145728000) } },
+    { { UINT32_C( 190885907), UINT32_C(1967724223) },
+      { UINT32_C(4294967295), UINT32_C(3170893824) } },
+    { { UINT32_C(1532056810), UINT32_C(4108639901) },
+      { UINT32_C(3598712832), UINT32_C(2197815296) } },
+    { { UINT32_C(1739420995), UINT32_C( 236726050) },
+      { UINT32_C(3372220416), UINT32_C(4294967295) } },
+    { { UINT32_C(1210064990), UINT32_C(3694606946) },
+      { UINT32_C(4043309056), UINT32_C(2315255808) } },
+    { { UINT32_C( 586991055), UINT32_C( 716353977) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1410564419), UINT32_C(2384253736) },
+      { UINT32_C(3741319168), UINT32_C(2877292544) } },
+    { { UINT32_C( 390481688), UINT32_C(1342223838) },
+      { UINT32_C(4294967295), UINT32_C(3833593856) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vrsqrte_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x2_t a = simde_test_arm_neon_random_u32x2();
+    simde_uint32x2_t r = simde_vrsqrte_u32(a);
+
+    simde_test_arm_neon_write_u32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrteq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    22.2300), SIMDE_FLOAT32_C(    28.7800), SIMDE_FLOAT32_C(    11.5100), SIMDE_FLOAT32_C(     9.6800) },
+      { SIMDE_FLOAT32_C(     0.2124), SIMDE_FLOAT32_C(     0.1865), SIMDE_FLOAT32_C(     0.2949), SIMDE_FLOAT32_C(     0.3223) } },
+    { { SIMDE_FLOAT32_C(    31.6800), SIMDE_FLOAT32_C(    11.2600), SIMDE_FLOAT32_C(    42.9900), SIMDE_FLOAT32_C(    19.6900) },
+      { SIMDE_FLOAT32_C(     0.1777), SIMDE_FLOAT32_C(     0.2979), SIMDE_FLOAT32_C(     0.1528), SIMDE_FLOAT32_C(     0.2256) } },
+    { { SIMDE_FLOAT32_C(    64.9900), SIMDE_FLOAT32_C(    56.8100), SIMDE_FLOAT32_C(    35.8700), SIMDE_FLOAT32_C(    92.1700) },
+      { SIMDE_FLOAT32_C(     0.1243), SIMDE_FLOAT32_C(     0.1328), SIMDE_FLOAT32_C(     0.1670), SIMDE_FLOAT32_C(     0.1040) } },
+    { { SIMDE_FLOAT32_C(    92.1700), SIMDE_FLOAT32_C(    35.3200), SIMDE_FLOAT32_C(    16.7400), SIMDE_FLOAT32_C(    32.3800) },
+      { SIMDE_FLOAT32_C(     0.1040), SIMDE_FLOAT32_C(     0.1680), SIMDE_FLOAT32_C(     0.2446), SIMDE_FLOAT32_C(     0.1758) } },
+    { { SIMDE_FLOAT32_C(    89.1700), SIMDE_FLOAT32_C(    31.5000), SIMDE_FLOAT32_C(    75.3300), SIMDE_FLOAT32_C(    75.1000) },
+      { SIMDE_FLOAT32_C(     0.1060), SIMDE_FLOAT32_C(     0.1782), SIMDE_FLOAT32_C(     0.1152), SIMDE_FLOAT32_C(     0.1152) } },
+    { { SIMDE_FLOAT32_C(     0.0000),  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    35.9800), SIMDE_FLOAT32_C(    41.3900) },
+      {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.0000), SIMDE_FLOAT32_C(     0.1670), SIMDE_FLOAT32_C(     0.1553) } },
+    { { SIMDE_FLOAT32_C(    56.1500), SIMDE_FLOAT32_C(    74.4000), SIMDE_FLOAT32_C(    69.3800), SIMDE_FLOAT32_C(    11.3700) },
+      { SIMDE_FLOAT32_C(     0.1333), SIMDE_FLOAT32_C(     0.1160), SIMDE_FLOAT32_C(     0.1201), SIMDE_FLOAT32_C(     0.2969) } },
+    { { SIMDE_FLOAT32_C(    45.0800), SIMDE_FLOAT32_C(    97.7300), SIMDE_FLOAT32_C(    40.9400), SIMDE_FLOAT32_C(    13.1300) },
+      { SIMDE_FLOAT32_C(     0.1489), SIMDE_FLOAT32_C(     0.1011), SIMDE_FLOAT32_C(     0.1562), SIMDE_FLOAT32_C(     0.2754) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t r = simde_vrsqrteq_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(0.25f, 100.0f);
+    simde_float32x4_t r = simde_vrsqrteq_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrteq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     3.8900), SIMDE_FLOAT64_C(    71.4200) },
+      { SIMDE_FLOAT64_C(     0.5078), SIMDE_FLOAT64_C(     0.1184) } },
+    { { SIMDE_FLOAT64_C(     4.0200), SIMDE_FLOAT64_C(    32.2700) },
+      { SIMDE_FLOAT64_C(     0.4990), SIMDE_FLOAT64_C(     0.1758) } },
+    { { SIMDE_FLOAT64_C(    62.1000), SIMDE_FLOAT64_C(    25.8800) },
+      { SIMDE_FLOAT64_C(     0.1270), SIMDE_FLOAT64_C(     0.1963) } },
+    { { SIMDE_FLOAT64_C(    72.8700), SIMDE_FLOAT64_C(    59.5700) },
+      { SIMDE_FLOAT64_C(     0.1172), SIMDE_FLOAT64_C(     0.1294) } },
+    { { SIMDE_FLOAT64_C(    95.2700), SIMDE_FLOAT64_C(    70.2700) },
+      { SIMDE_FLOAT64_C(     0.1025), SIMDE_FLOAT64_C(     0.1194) } },
+    { { SIMDE_FLOAT64_C(     0.0000),  SIMDE_MATH_INFINITY },
+      {  SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(     0.0000) } },
+    { { SIMDE_FLOAT64_C(    96.9900), SIMDE_FLOAT64_C(    21.6900) },
+      { SIMDE_FLOAT64_C(     0.1016), SIMDE_FLOAT64_C(     0.2148) } },
+    { { SIMDE_FLOAT64_C(    51.8400), SIMDE_FLOAT64_C(    21.0600) },
+      { SIMDE_FLOAT64_C(     0.1387), SIMDE_FLOAT64_C(     0.2178) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t r = simde_vrsqrteq_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(0.25, 100.0);
+    simde_float64x2_t r = simde_vrsqrteq_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrteq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2125297140), UINT32_C( 551523919), UINT32_C(2025647167), UINT32_C(1668281428) },
+      { UINT32_C(3053453312), UINT32_C(4294967295), UINT32_C(3128950784), UINT32_C(3447717888) } },
+    { { UINT32_C(3729180152), UINT32_C( 398559674), UINT32_C(2104306866), UINT32_C(3530250692) },
+      { UINT32_C(2306867200), UINT32_C(4294967295), UINT32_C(3070230528), UINT32_C(2365587456) } },
+    { { UINT32_C(3555501388), UINT32_C( 874020436), UINT32_C( 300237292), UINT32_C( 127185224) },
+      { UINT32_C(2365587456), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1144793491), UINT32_C(2025536096), UINT32_C(3344783695), UINT32_C( 345783712) },
+      { UINT32_C(4160749568), UINT32_C(3128950784), UINT32_C(2432696320), UINT32_C(4294967295) } },
+    { { UINT32_C(1436048996), UINT32_C(1179940324), UINT32_C( 377646816), UINT32_C( 930881216) },
+      { UINT32_C(3707764736), UINT32_C(4102029312), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C( 731745833), UINT32_C(1885779197), UINT32_C( 426697582), UINT32_C( 552955270) },
+      { UINT32_C(4294967295), UINT32_C(3246391296), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C( 863162843), UINT32_C( 105710042), UINT32_C(3723554599), UINT32_C( 485005478) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(2306867200), UINT32_C(4294967295) } },
+    { { UINT32_C(1744278678), UINT32_C( 435411499), UINT32_C( 389799201), UINT32_C( 898428094) },
+      { UINT32_C(3372220416), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vrsqrteq_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+    simde_uint32x4_t r = simde_vrsqrteq_u32(a);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtes_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrted_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrte_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrte_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrte_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrteq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrteq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrteq_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
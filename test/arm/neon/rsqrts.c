@@ -0,0 +1,359 @@
+#define SIMDE_TEST_ARM_NEON_INSN rsqrts
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rsqrts.h"
+
+static int
+test_simde_vrsqrtss_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a;
+    simde_float32 b;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(    68.32),
+      SIMDE_FLOAT32_C(  -461.76),
+      SIMDE_FLOAT32_C( 15775.22) },
+    { SIMDE_FLOAT32_C(  -504.65),
+      SIMDE_FLOAT32_C(  -655.59),
+      SIMDE_FLOAT32_C(-165420.25) },
+    { SIMDE_FLOAT32_C(    -7.15),
+      SIMDE_FLOAT32_C(   585.59),
+      SIMDE_FLOAT32_C(  2094.98) },
+    { SIMDE_FLOAT32_C(  -981.96),
+      SIMDE_FLOAT32_C(   493.66),
+      SIMDE_FLOAT32_C(242378.69) },
+    { SIMDE_FLOAT32_C(    84.50),
+      SIMDE_FLOAT32_C(   940.33),
+      SIMDE_FLOAT32_C(-39727.44) },
+    {  SIMDE_MATH_INFINITYF,
+      SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     1.50) },
+    { SIMDE_FLOAT32_C(   806.51),
+      SIMDE_FLOAT32_C(  -862.53),
+      SIMDE_FLOAT32_C(347821.06) },
+    { SIMDE_FLOAT32_C(   870.03),
+      SIMDE_FLOAT32_C(  -289.23),
+      SIMDE_FLOAT32_C(125820.90) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_vrsqrtss_f32(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 b = simde_test_codegen_random_f32(-1000.0f, 1000.0f);
+    simde_float32 r = simde_vrsqrtss_f32(a, b);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrtsd_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a;
+    simde_float64 b;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(  -984.14),
+      SIMDE_FLOAT64_C(  -219.24),
+      SIMDE_FLOAT64_C(-107879.93) },
+    { SIMDE_FLOAT64_C(   699.77),
+      SIMDE_FLOAT64_C(  -840.26),
+      SIMDE_FLOAT64_C(293995.87) },
+    { SIMDE_FLOAT64_C(   480.20),
+      SIMDE_FLOAT64_C(   268.07),
+      SIMDE_FLOAT64_C(-64362.11) },
+    { SIMDE_FLOAT64_C(  -274.49),
+      SIMDE_FLOAT64_C(  -658.31),
+      SIMDE_FLOAT64_C(-90348.26) },
+    { SIMDE_FLOAT64_C(  -870.71),
+      SIMDE_FLOAT64_C(  -762.69),
+      SIMDE_FLOAT64_C(-332039.40) },
+    {  SIMDE_MATH_INFINITY,
+      SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     1.50) },
+    { SIMDE_FLOAT64_C(    98.00),
+      SIMDE_FLOAT64_C(  -509.11),
+      SIMDE_FLOAT64_C( 24947.89) },
+    { SIMDE_FLOAT64_C(   203.73),
+      SIMDE_FLOAT64_C(  -888.57),
+      SIMDE_FLOAT64_C( 90515.68) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r = simde_vrsqrtsd_f64(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64 a = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 b = simde_test_codegen_random_f64(-1000.0, 1000.0);
+    simde_float64 r = simde_vrsqrtsd_f64(a, b);
+
+    simde_test_codegen_write_f64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_f64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrts_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   658.42), SIMDE_FLOAT32_C(   792.98) },
+      { SIMDE_FLOAT32_C(  -101.51), SIMDE_FLOAT32_C(   787.93) },
+      { SIMDE_FLOAT32_C( 33419.61), SIMDE_FLOAT32_C(-312404.84) } },
+    { { SIMDE_FLOAT32_C(  -254.44), SIMDE_FLOAT32_C(  -883.08) },
+      { SIMDE_FLOAT32_C(  -879.99), SIMDE_FLOAT32_C(   112.73) },
+      { SIMDE_FLOAT32_C(-111950.83), SIMDE_FLOAT32_C( 49776.31) } },
+    { { SIMDE_FLOAT32_C(   799.41), SIMDE_FLOAT32_C(   -62.35) },
+      { SIMDE_FLOAT32_C(  -244.10), SIMDE_FLOAT32_C(  -457.75) },
+      { SIMDE_FLOAT32_C( 97569.49), SIMDE_FLOAT32_C(-14268.86) } },
+    { { SIMDE_FLOAT32_C(   449.02), SIMDE_FLOAT32_C(  -734.53) },
+      { SIMDE_FLOAT32_C(    -6.59), SIMDE_FLOAT32_C(   -13.14) },
+      { SIMDE_FLOAT32_C(  1481.02), SIMDE_FLOAT32_C( -4824.36) } },
+    { { SIMDE_FLOAT32_C(  -626.08), SIMDE_FLOAT32_C(  -826.94) },
+      { SIMDE_FLOAT32_C(  -966.26), SIMDE_FLOAT32_C(   -73.16) },
+      { SIMDE_FLOAT32_C(-302476.53), SIMDE_FLOAT32_C(-30247.97) } },
+    { {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00) },
+      { SIMDE_FLOAT32_C(     0.00), -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(     1.50), SIMDE_FLOAT32_C(     1.50) } },
+    { { SIMDE_FLOAT32_C(  -110.21), SIMDE_FLOAT32_C(  -651.67) },
+      { SIMDE_FLOAT32_C(   384.17), SIMDE_FLOAT32_C(    45.31) },
+      { SIMDE_FLOAT32_C( 21171.19), SIMDE_FLOAT32_C( 14765.08) } },
+    { { SIMDE_FLOAT32_C(  -822.11), SIMDE_FLOAT32_C(   150.07) },
+      { SIMDE_FLOAT32_C(   612.20), SIMDE_FLOAT32_C(  -577.60) },
+      { SIMDE_FLOAT32_C(251649.38), SIMDE_FLOAT32_C( 43341.71) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vrsqrts_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t b = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t r = simde_vrsqrts_f32(a, b);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrts_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -672.21) },
+      { SIMDE_FLOAT64_C(   387.17) },
+      { SIMDE_FLOAT64_C(130131.27) } },
+    { { SIMDE_FLOAT64_C(   752.92) },
+      { SIMDE_FLOAT64_C(   567.31) },
+      { SIMDE_FLOAT64_C(-213568.02) } },
+    { { SIMDE_FLOAT64_C(  -729.52) },
+      { SIMDE_FLOAT64_C(  -375.85) },
+      { SIMDE_FLOAT64_C(-137093.55) } },
+    { { SIMDE_FLOAT64_C(    58.75) },
+      { SIMDE_FLOAT64_C(   279.77) },
+      { SIMDE_FLOAT64_C( -8216.74) } },
+    { { SIMDE_FLOAT64_C(  -562.85) },
+      { SIMDE_FLOAT64_C(   289.33) },
+      { SIMDE_FLOAT64_C( 81426.20) } },
+    { {  SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(     0.00) },
+      { SIMDE_FLOAT64_C(     1.50) } },
+    { { SIMDE_FLOAT64_C(  -124.13) },
+      { SIMDE_FLOAT64_C(  -460.29) },
+      { SIMDE_FLOAT64_C(-28566.40) } },
+    { { SIMDE_FLOAT64_C(   332.10) },
+      { SIMDE_FLOAT64_C(  -120.66) },
+      { SIMDE_FLOAT64_C( 20037.09) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vrsqrts_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t b = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t r = simde_vrsqrts_f64(a, b);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrtsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -204.75), SIMDE_FLOAT32_C(  -839.82), SIMDE_FLOAT32_C(    84.74), SIMDE_FLOAT32_C(  -213.63) },
+      { SIMDE_FLOAT32_C(   965.82), SIMDE_FLOAT32_C(  -477.98), SIMDE_FLOAT32_C(  -635.78), SIMDE_FLOAT32_C(   975.35) },
+      { SIMDE_FLOAT32_C( 98877.32), SIMDE_FLOAT32_C(-200707.09), SIMDE_FLOAT32_C( 26939.50), SIMDE_FLOAT32_C(104183.51) } },
+    { { SIMDE_FLOAT32_C(  -557.69), SIMDE_FLOAT32_C(  -620.68), SIMDE_FLOAT32_C(   611.62), SIMDE_FLOAT32_C(   374.23) },
+      { SIMDE_FLOAT32_C(  -259.83), SIMDE_FLOAT32_C(   138.52), SIMDE_FLOAT32_C(   973.13), SIMDE_FLOAT32_C(  -379.84) },
+      { SIMDE_FLOAT32_C(-72450.79), SIMDE_FLOAT32_C( 42989.80), SIMDE_FLOAT32_C(-297591.38), SIMDE_FLOAT32_C( 71075.27) } },
+    { { SIMDE_FLOAT32_C(   551.19), SIMDE_FLOAT32_C(   876.84), SIMDE_FLOAT32_C(   432.76), SIMDE_FLOAT32_C(  -190.40) },
+      { SIMDE_FLOAT32_C(  -540.05), SIMDE_FLOAT32_C(   218.04), SIMDE_FLOAT32_C(  -920.57), SIMDE_FLOAT32_C(  -338.65) },
+      { SIMDE_FLOAT32_C(148836.58), SIMDE_FLOAT32_C(-95591.59), SIMDE_FLOAT32_C(199194.44), SIMDE_FLOAT32_C(-32237.98) } },
+    { { SIMDE_FLOAT32_C(   700.77), SIMDE_FLOAT32_C(   394.05), SIMDE_FLOAT32_C(   333.03), SIMDE_FLOAT32_C(  -954.94) },
+      { SIMDE_FLOAT32_C(  -127.15), SIMDE_FLOAT32_C(  -623.13), SIMDE_FLOAT32_C(  -216.50), SIMDE_FLOAT32_C(  -326.73) },
+      { SIMDE_FLOAT32_C( 44552.95), SIMDE_FLOAT32_C(122773.69), SIMDE_FLOAT32_C( 36052.00), SIMDE_FLOAT32_C(-156002.28) } },
+    { { SIMDE_FLOAT32_C(   617.99), SIMDE_FLOAT32_C(   461.59), SIMDE_FLOAT32_C(  -534.76), SIMDE_FLOAT32_C(  -699.02) },
+      { SIMDE_FLOAT32_C(   858.76), SIMDE_FLOAT32_C(   917.95), SIMDE_FLOAT32_C(  -323.79), SIMDE_FLOAT32_C(   408.22) },
+      { SIMDE_FLOAT32_C(-265351.03), SIMDE_FLOAT32_C(-211856.77), SIMDE_FLOAT32_C(-86573.48), SIMDE_FLOAT32_C(142678.48) } },
+    { {  SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -728.46), SIMDE_FLOAT32_C(  -445.51) },
+      { SIMDE_FLOAT32_C(     0.00), -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -752.13), SIMDE_FLOAT32_C(  -502.54) },
+      { SIMDE_FLOAT32_C(     1.50), SIMDE_FLOAT32_C(     1.50), SIMDE_FLOAT32_C(-273946.81), SIMDE_FLOAT32_C(-111941.80) } },
+    { { SIMDE_FLOAT32_C(  -489.05), SIMDE_FLOAT32_C(   -13.27), SIMDE_FLOAT32_C(  -657.30), SIMDE_FLOAT32_C(  -474.51) },
+      { SIMDE_FLOAT32_C(   928.34), SIMDE_FLOAT32_C(  -537.47), SIMDE_FLOAT32_C(  -534.64), SIMDE_FLOAT32_C(  -406.35) },
+      { SIMDE_FLOAT32_C(227003.84), SIMDE_FLOAT32_C( -3564.61), SIMDE_FLOAT32_C(-175707.94), SIMDE_FLOAT32_C(-96407.07) } },
+    { { SIMDE_FLOAT32_C(  -127.16), SIMDE_FLOAT32_C(  -617.12), SIMDE_FLOAT32_C(  -240.75), SIMDE_FLOAT32_C(  -296.77) },
+      { SIMDE_FLOAT32_C(   245.35), SIMDE_FLOAT32_C(   513.89), SIMDE_FLOAT32_C(  -530.33), SIMDE_FLOAT32_C(  -218.52) },
+      { SIMDE_FLOAT32_C( 15600.85), SIMDE_FLOAT32_C(158567.41), SIMDE_FLOAT32_C(-63836.98), SIMDE_FLOAT32_C(-32423.59) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vrsqrtsq_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t b = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t r = simde_vrsqrtsq_f32(a, b);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vrsqrtsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   176.03), SIMDE_FLOAT64_C(  -667.02) },
+      { SIMDE_FLOAT64_C(   698.85), SIMDE_FLOAT64_C(   133.73) },
+      { SIMDE_FLOAT64_C(-61507.78), SIMDE_FLOAT64_C( 44601.79) } },
+    { { SIMDE_FLOAT64_C(   863.01), SIMDE_FLOAT64_C(   528.07) },
+      { SIMDE_FLOAT64_C(   899.23), SIMDE_FLOAT64_C(   223.51) },
+      { SIMDE_FLOAT64_C(-388020.74), SIMDE_FLOAT64_C(-59012.96) } },
+    { { SIMDE_FLOAT64_C(   793.07), SIMDE_FLOAT64_C(   231.61) },
+      { SIMDE_FLOAT64_C(   318.65), SIMDE_FLOAT64_C(  -360.65) },
+      { SIMDE_FLOAT64_C(-126354.38), SIMDE_FLOAT64_C( 41766.57) } },
+    { { SIMDE_FLOAT64_C(   184.06), SIMDE_FLOAT64_C(   707.36) },
+      { SIMDE_FLOAT64_C(  -794.29), SIMDE_FLOAT64_C(   801.94) },
+      { SIMDE_FLOAT64_C( 73100.01), SIMDE_FLOAT64_C(-283628.64) } },
+    { { SIMDE_FLOAT64_C(   -85.93), SIMDE_FLOAT64_C(    53.22) },
+      { SIMDE_FLOAT64_C(  -810.01), SIMDE_FLOAT64_C(  -675.17) },
+      { SIMDE_FLOAT64_C(-34800.58), SIMDE_FLOAT64_C( 17967.77) } },
+    { {  SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(     0.00) },
+      { SIMDE_FLOAT64_C(     0.00), -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(     1.50), SIMDE_FLOAT64_C(     1.50) } },
+    { { SIMDE_FLOAT64_C(   850.50), SIMDE_FLOAT64_C(   999.85) },
+      { SIMDE_FLOAT64_C(  -702.37), SIMDE_FLOAT64_C(   480.98) },
+      { SIMDE_FLOAT64_C(298684.34), SIMDE_FLOAT64_C(-240452.43) } },
+    { { SIMDE_FLOAT64_C(  -977.39), SIMDE_FLOAT64_C(  -331.18) },
+      { SIMDE_FLOAT64_C(   164.51), SIMDE_FLOAT64_C(   142.97) },
+      { SIMDE_FLOAT64_C( 80396.71), SIMDE_FLOAT64_C( 23675.90) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vrsqrtsq_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t b = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t r = simde_vrsqrtsq_f64(a, b);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtss_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtsd_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrts_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrts_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtsq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
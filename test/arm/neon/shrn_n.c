@@ -0,0 +1,615 @@
+#define SIMDE_TEST_ARM_NEON_INSN shrn_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/shrn_n.h"
+
+static int
+test_simde_vshrn_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int8_t r1[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r6[8];
+    int8_t r8[8];
+  } test_vec[] = {
+    { {        INT16_MIN,        INT16_MAX, -INT16_C( 10499), -INT16_C( 27344),  INT16_C( 11966),  INT16_C( 14304), -INT16_C(   113),  INT16_C( 10966) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C( 126), -INT8_C( 104),  INT8_C(  95), -INT8_C(  16), -INT8_C(  57),  INT8_C( 107) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(  33), -INT8_C(  90), -INT8_C(  41), -INT8_C(   4), -INT8_C(  15),  INT8_C(  90) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(  73), -INT8_C(  87),  INT8_C( 117), -INT8_C(  65), -INT8_C(   4),  INT8_C(  86) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(  91),  INT8_C(  84), -INT8_C(  70), -INT8_C(  33), -INT8_C(   2), -INT8_C(  85) },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(  42), -INT8_C( 107),  INT8_C(  46),  INT8_C(  55), -INT8_C(   1),  INT8_C(  42) } },
+    { {  INT16_C( 12720),  INT16_C( 11100), -INT16_C( 21569), -INT16_C( 20864),  INT16_C(  6015), -INT16_C( 19276), -INT16_C( 15877), -INT16_C(    83) },
+      { -INT8_C(  40), -INT8_C(  82), -INT8_C(  33),  INT8_C(  64), -INT8_C(  65),  INT8_C(  90), -INT8_C(   3), -INT8_C(  42) },
+      {  INT8_C(  54),  INT8_C( 107),  INT8_C( 119), -INT8_C(  48), -INT8_C(  17), -INT8_C( 106),  INT8_C(  63), -INT8_C(  11) },
+      { -INT8_C( 115),  INT8_C(  90),  INT8_C(  93),  INT8_C( 116), -INT8_C(  69), -INT8_C(  91),  INT8_C(  15), -INT8_C(   3) },
+      { -INT8_C(  58), -INT8_C(  83), -INT8_C(  82), -INT8_C(  70),  INT8_C(  93), -INT8_C(  46),  INT8_C(   7), -INT8_C(   2) },
+      {  INT8_C(  49),  INT8_C(  43), -INT8_C(  85), -INT8_C(  82),  INT8_C(  23), -INT8_C(  76), -INT8_C(  63), -INT8_C(   1) } },
+    { {  INT16_C(  9915), -INT16_C( 12689), -INT16_C( 19231),  INT16_C( 18571), -INT16_C( 18059), -INT16_C(  5101), -INT16_C( 15340),  INT16_C(   833) },
+      {  INT8_C(  93),  INT8_C(  55),  INT8_C( 112),  INT8_C(  69), -INT8_C(  70),  INT8_C(   9),  INT8_C(  10), -INT8_C(  96) },
+      { -INT8_C(  41), -INT8_C(  51), -INT8_C( 100),  INT8_C(  17),  INT8_C(  46), -INT8_C( 126), -INT8_C( 126),  INT8_C( 104) },
+      {  INT8_C(  53),  INT8_C( 115), -INT8_C(  89),  INT8_C(  68), -INT8_C(  53),  INT8_C(  96),  INT8_C(  32),  INT8_C(  26) },
+      { -INT8_C( 102),  INT8_C(  57), -INT8_C(  45),  INT8_C(  34), -INT8_C(  27), -INT8_C(  80),  INT8_C(  16),  INT8_C(  13) },
+      {  INT8_C(  38), -INT8_C(  50), -INT8_C(  76),  INT8_C(  72), -INT8_C(  71), -INT8_C(  20), -INT8_C(  60),  INT8_C(   3) } },
+    { {  INT16_C( 28926),  INT16_C( 30655), -INT16_C(  8797), -INT16_C( 18283), -INT16_C(   793), -INT16_C( 23910),  INT16_C(  7575),  INT16_C(  1846) },
+      {      INT8_MAX, -INT8_C(  33), -INT8_C(  47),  INT8_C(  74),  INT8_C( 115),  INT8_C(  77), -INT8_C(  53), -INT8_C( 101) },
+      {  INT8_C(  31), -INT8_C(   9), -INT8_C(  76),  INT8_C(  18), -INT8_C( 100),  INT8_C(  83), -INT8_C(  78), -INT8_C(  26) },
+      { -INT8_C( 121), -INT8_C(  67), -INT8_C(  19), -INT8_C(  60), -INT8_C(  25),  INT8_C(  20), -INT8_C(  20),  INT8_C(  57) },
+      { -INT8_C(  61), -INT8_C(  34),  INT8_C( 118), -INT8_C(  30), -INT8_C(  13), -INT8_C( 118),  INT8_C( 118),  INT8_C(  28) },
+      {  INT8_C( 112),  INT8_C( 119), -INT8_C(  35), -INT8_C(  72), -INT8_C(   4), -INT8_C(  94),  INT8_C(  29),  INT8_C(   7) } },
+    { { -INT16_C( 31661),  INT16_C( 11052), -INT16_C(  2742),  INT16_C( 32198), -INT16_C( 17096), -INT16_C( 10144),  INT16_C( 29111), -INT16_C( 20851) },
+      {  INT8_C(  41), -INT8_C( 106), -INT8_C(  91), -INT8_C(  29), -INT8_C( 100),  INT8_C(  48), -INT8_C(  37),  INT8_C(  70) },
+      { -INT8_C( 118),  INT8_C( 101), -INT8_C(  87), -INT8_C(  72), -INT8_C(  89),  INT8_C(  12),  INT8_C(  54), -INT8_C(  47) },
+      {  INT8_C(  34),  INT8_C(  89), -INT8_C(  86), -INT8_C(  18), -INT8_C(  23), -INT8_C(  61), -INT8_C( 115),  INT8_C( 116) },
+      {  INT8_C(  17), -INT8_C(  84), -INT8_C(  43), -INT8_C(   9), -INT8_C(  12),  INT8_C(  97), -INT8_C(  58), -INT8_C(  70) },
+      { -INT8_C( 124),  INT8_C(  43), -INT8_C(  11),  INT8_C( 125), -INT8_C(  67), -INT8_C(  40),  INT8_C( 113), -INT8_C(  82) } },
+    { {  INT16_C( 19962),  INT16_C( 32752), -INT16_C(  3079), -INT16_C(   320),  INT16_C(  5578), -INT16_C( 20498), -INT16_C( 15693),  INT16_C( 16640) },
+      { -INT8_C(   3), -INT8_C(   8), -INT8_C(   4),  INT8_C(  96), -INT8_C(  27), -INT8_C(   9),  INT8_C(  89),      INT8_MIN },
+      { -INT8_C(  65), -INT8_C(   2),      INT8_MAX, -INT8_C(  40), -INT8_C(  71), -INT8_C(   3),  INT8_C(  86),  INT8_C(  32) },
+      {  INT8_C( 111), -INT8_C(   1), -INT8_C(  97), -INT8_C(  10), -INT8_C(  82),      INT8_MAX,  INT8_C(  21),  INT8_C(   8) },
+      {  INT8_C(  55), -INT8_C(   1), -INT8_C(  49), -INT8_C(   5),  INT8_C(  87), -INT8_C(  65),  INT8_C(  10),  INT8_C(   4) },
+      {  INT8_C(  77),      INT8_MAX, -INT8_C(  13), -INT8_C(   2),  INT8_C(  21), -INT8_C(  81), -INT8_C(  62),  INT8_C(  65) } },
+    { { -INT16_C( 10273), -INT16_C( 25470),  INT16_C( 10335), -INT16_C( 20893),  INT16_C( 21421), -INT16_C(  2607),  INT16_C( 20011),  INT16_C(  4882) },
+      { -INT8_C(  17),  INT8_C(  65),  INT8_C(  47),  INT8_C(  49), -INT8_C(  42), -INT8_C(  24),  INT8_C(  21), -INT8_C( 119) },
+      { -INT8_C(   5), -INT8_C( 112),  INT8_C(  11), -INT8_C(  52),  INT8_C( 117), -INT8_C(  70), -INT8_C(  59),  INT8_C(  98) },
+      { -INT8_C(  66), -INT8_C(  28),  INT8_C(  66),  INT8_C( 115), -INT8_C(  99), -INT8_C(  82),  INT8_C( 113), -INT8_C( 104) },
+      {  INT8_C(  95),  INT8_C( 114), -INT8_C(  95), -INT8_C(  71),  INT8_C(  78), -INT8_C(  41),  INT8_C(  56),  INT8_C(  76) },
+      { -INT8_C(  41), -INT8_C( 100),  INT8_C(  40), -INT8_C(  82),  INT8_C(  83), -INT8_C(  11),  INT8_C(  78),  INT8_C(  19) } },
+    { { -INT16_C( 30010), -INT16_C( 23005),  INT16_C( 24051), -INT16_C( 22233), -INT16_C(  6968),  INT16_C(  2179), -INT16_C(  4940),  INT16_C( 14006) },
+      {  INT8_C(  99),  INT8_C(  17), -INT8_C(   7), -INT8_C( 109),  INT8_C( 100),  INT8_C(  65),  INT8_C(  90),  INT8_C(  91) },
+      {  INT8_C(  88), -INT8_C(  60), -INT8_C(  66),  INT8_C(  36), -INT8_C( 103),  INT8_C(  16), -INT8_C( 106), -INT8_C(  42) },
+      {  INT8_C(  86),  INT8_C(  49), -INT8_C(  17),  INT8_C(  73),  INT8_C(  38),  INT8_C(  68),  INT8_C( 101), -INT8_C(  75) },
+      {  INT8_C(  43), -INT8_C( 104),  INT8_C( 119), -INT8_C(  92), -INT8_C( 109),  INT8_C(  34), -INT8_C(  78), -INT8_C(  38) },
+      { -INT8_C( 118), -INT8_C(  90),  INT8_C(  93), -INT8_C(  87), -INT8_C(  28),  INT8_C(   8), -INT8_C(  20),  INT8_C(  54) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+
+    simde_int8x8_t r1 = simde_vshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r6, simde_vld1_s8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i8x8(r8, simde_vld1_s8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+
+    simde_int8x8_t r1 = simde_vshrn_n_s16(a, 1);
+    simde_int8x8_t r3 = simde_vshrn_n_s16(a, 3);
+    simde_int8x8_t r5 = simde_vshrn_n_s16(a, 5);
+    simde_int8x8_t r6 = simde_vshrn_n_s16(a, 6);
+    simde_int8x8_t r8 = simde_vshrn_n_s16(a, 8);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshrn_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int16_t r1[4];
+    int16_t r6[4];
+    int16_t r10[4];
+    int16_t r13[4];
+    int16_t r16[4];
+  } test_vec[] = {
+    { {              INT32_MIN,              INT32_MAX, -INT32_C(   451916936), -INT32_C(  1103760487) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C(  9660), -INT16_C(  1588) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C( 16685), -INT16_C( 10290) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C( 17426), -INT16_C( 29316) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C( 10370), -INT16_C(  3665) },
+      {        INT16_MIN,        INT16_MAX, -INT16_C(  6896), -INT16_C( 16843) } },
+    { {  INT32_C(   298974518),  INT32_C(  1334783368),  INT32_C(   416203899),  INT32_C(  1056475200) },
+      { -INT16_C(   357), -INT16_C( 26940),  INT16_C( 25149),  INT16_C( 17440) },
+      {  INT16_C( 18420),  INT16_C( 15542),  INT16_C( 15121), -INT16_C(  7647) },
+      {  INT16_C( 29823), -INT16_C(  7221),  INT16_C( 13233), -INT16_C( 16862) },
+      { -INT16_C( 29041),  INT16_C( 31865), -INT16_C( 14730), -INT16_C(  2108) },
+      {  INT16_C(  4561),  INT16_C( 20367),  INT16_C(  6350),  INT16_C( 16120) } },
+    { { -INT32_C(  1438254375), -INT32_C(  1733162285), -INT32_C(   862983026),  INT32_C(   656837029) },
+      { -INT16_C(   660),  INT16_C(  1385), -INT16_C(  2489),  INT16_C( 17618) },
+      {  INT16_C(  6123), -INT16_C( 14293),  INT16_C( 16306), -INT16_C( 26074) },
+      { -INT16_C( 28290),  INT16_C( 11394),  INT16_C(  9211), -INT16_C( 13918) },
+      {  INT16_C( 21039), -INT16_C( 14960),  INT16_C( 25727),  INT16_C( 14644) },
+      { -INT16_C( 21947), -INT16_C( 26446), -INT16_C( 13169),  INT16_C( 10022) } },
+    { { -INT32_C(   776743012), -INT32_C(   654093370), -INT32_C(    34454269),  INT32_C(  2102569409) },
+      { -INT16_C(  5170), -INT16_C( 22045),  INT16_C(  8833),  INT16_C( 21728) },
+      { -INT16_C( 12450),  INT16_C(  3407), -INT16_C( 14060),  INT16_C( 19111) },
+      {  INT16_C( 27893),  INT16_C( 16596),  INT16_C( 31889),  INT16_C( 21674) },
+      { -INT16_C( 29282), -INT16_C( 14310), -INT16_C(  4206), -INT16_C(  5483) },
+      { -INT16_C( 11853), -INT16_C(  9981), -INT16_C(   526),  INT16_C( 32082) } },
+    { { -INT32_C(   602469046),  INT32_C(  1220376614),  INT32_C(  1144231460), -INT32_C(  1880080947) },
+      { -INT16_C( 31067), -INT16_C( 17389), -INT16_C( 13550),  INT16_C(  7910) },
+      {  INT16_C( 23605), -INT16_C(  2592), -INT16_C( 12712), -INT16_C( 16137) },
+      {  INT16_C(  1475),  INT16_C( 12126),  INT16_C(  3301), -INT16_C(  1009) },
+      { -INT16_C(  8008),  INT16_C( 17899),  INT16_C(  8604),  INT16_C( 32641) },
+      { -INT16_C(  9193),  INT16_C( 18621),  INT16_C( 17459), -INT16_C( 28688) } },
+    { { -INT32_C(  1104729708),  INT32_C(  1176272136), -INT32_C(   323609417),  INT32_C(   850730745) },
+      { -INT16_C( 27446),  INT16_C( 16004),  INT16_C(  3675), -INT16_C( 28804) },
+      { -INT16_C( 25434),  INT16_C( 29172), -INT16_C( 10126), -INT16_C( 11141) },
+      { -INT16_C( 30262), -INT16_C( 30945),  INT16_C( 11655), -INT16_C( 21177) },
+      { -INT16_C(  3783),  INT16_C( 12515),  INT16_C( 26032), -INT16_C( 27224) },
+      { -INT16_C( 16857),  INT16_C( 17948), -INT16_C(  4938),  INT16_C( 12981) } },
+    { {  INT32_C(   401986470), -INT32_C(  1819475590),  INT32_C(  2123546748), -INT32_C(   924810935) },
+      { -INT16_C(  5677), -INT16_C( 32579),  INT16_C( 24638),  INT16_C( 16548) },
+      { -INT16_C( 10418),  INT16_C( 13317),  INT16_C( 19201), -INT16_C( 32251) },
+      { -INT16_C(   652), -INT16_C(  7360), -INT16_C( 23376),  INT16_C( 14368) },
+      { -INT16_C( 16466), -INT16_C( 25496), -INT16_C(  2922),  INT16_C( 18180) },
+      {  INT16_C(  6133), -INT16_C( 27763),  INT16_C( 32402), -INT16_C( 14112) } },
+    { {  INT32_C(   662617246), -INT32_C(  1491099104),  INT32_C(   614611619),  INT32_C(  1392677883) },
+      {  INT16_C( 24143), -INT16_C( 12016),  INT16_C(  7505),  INT16_C( 18941) },
+      { -INT16_C(  1294),  INT16_C( 32392), -INT16_C( 30486),  INT16_C(  2639) },
+      { -INT16_C(  8273), -INT16_C( 14360),  INT16_C( 10382), -INT16_C( 16220) },
+      {  INT16_C( 15349),  INT16_C( 14589),  INT16_C(  9489), -INT16_C( 26604) },
+      {  INT16_C( 10110), -INT16_C( 22753),  INT16_C(  9378),  INT16_C( 21250) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_int16x4_t r1 = simde_vshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i16x4(r6, simde_vld1_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x4(r10, simde_vld1_s16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i16x4(r13, simde_vld1_s16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i16x4(r16, simde_vld1_s16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+
+    simde_int16x4_t r1 = simde_vshrn_n_s32(a, 1);
+    simde_int16x4_t r6 = simde_vshrn_n_s32(a, 6);
+    simde_int16x4_t r10 = simde_vshrn_n_s32(a, 10);
+    simde_int16x4_t r13 = simde_vshrn_n_s32(a, 13);
+    simde_int16x4_t r16 = simde_vshrn_n_s32(a, 16);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshrn_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int32_t r1[2];
+    int32_t r13[2];
+    int32_t r19[2];
+    int32_t r26[2];
+    int32_t r32[2];
+  } test_vec[] = {
+    { {                      INT64_MIN,                      INT64_MAX },
+      {  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0), -INT32_C(           1) },
+      {              INT32_MIN,              INT32_MAX } },
+    { { -INT64_C( 3994181553733752705),  INT64_C( 8777570929063499219) },
+      { -INT32_C(    56355777), -INT32_C(  1865413911) },
+      { -INT32_C(  2008036799), -INT32_C(  1844900608) },
+      {  INT32_C(   975257385),  INT32_C(   105391156) },
+      {  INT32_C(   611598974),  INT32_C(  1946980424) },
+      { -INT32_C(   929967863),  INT32_C(  2043687489) } },
+    { {  INT64_C( 4784624317585742908), -INT64_C( 9060300057146600153) },
+      { -INT32_C(  1062048226), -INT32_C(     5657965) },
+      {  INT32_C(   867961638), -INT32_C(   925893990) },
+      { -INT32_C(   858853332),  INT32_C(  1797472234) },
+      { -INT32_C(  1717985824), -INT32_C(  1865005441) },
+      {  INT32_C(  1114007159), -INT32_C(  2109515495) } },
+    { {  INT64_C( 4163967296359332037), -INT64_C( 3757222484718943659) },
+      { -INT32_C(   504644510),  INT32_C(  1142669610) },
+      {  INT32_C(   294526651),  INT32_C(  1349796284) },
+      {  INT32_C(   742799482),  INT32_C(  1967247622) },
+      {  INT32_C(  1918405744), -INT32_C(   152403038) },
+      {  INT32_C(   969499185), -INT32_C(   874796530) } },
+    { {  INT64_C( 1559294135622137514),  INT64_C( 2520268343643410807) },
+      { -INT32_C(  1626490027),  INT32_C(  1354991803) },
+      { -INT32_C(   838209317),  INT32_C(  1436879928) },
+      {  INT32_C(  2000168899),  INT32_C(   961975344) },
+      {  INT32_C(  1760456783), -INT32_C(  1099780824) },
+      {  INT32_C(   363051457),  INT32_C(   586795700) } },
+    { {  INT64_C( 5781053632536261644), -INT64_C( 8446331627548174534) },
+      {  INT32_C(   560404998),  INT32_C(  1382812573) },
+      {  INT32_C(  1831999089), -INT32_C(   787142976) },
+      {  INT32_C(  1303693401),  INT32_C(   323245211) },
+      {  INT32_C(   245066128), -INT32_C(  1306097495) },
+      {  INT32_C(  1346006438), -INT32_C(  1966564830) } },
+    { {  INT64_C( 4250097766854866622),  INT64_C( 3810181707482140333) },
+      {  INT32_C(  1393056607), -INT32_C(  1307244714) },
+      {  INT32_C(   188035205), -INT32_C(   526704304) },
+      {  INT32_C(  1814877378),  INT32_C(   260205701) },
+      { -INT32_C(  1093117527),  INT32_C(   941556953) },
+      {  INT32_C(   989552998),  INT32_C(   887127059) } },
+    { {  INT64_C( 5644614240505834943),  INT64_C( 1227337935071608149) },
+      {  INT32_C(  1706759903), -INT32_C(  1280901462) },
+      { -INT32_C(  1779016783),  INT32_C(   181090927) },
+      { -INT32_C(  1235756690),  INT32_C(   204156137) },
+      { -INT32_C(  1788039246),  INT32_C(  1108891225) },
+      {  INT32_C(  1314239166),  INT32_C(   285761881) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_int32x2_t r1 = simde_vshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x2(r13, simde_vld1_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x2(r19, simde_vld1_s32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i32x2(r26, simde_vld1_s32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_i32x2(r32, simde_vld1_s32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+
+    simde_int32x2_t r1 = simde_vshrn_n_s64(a, 1);
+    simde_int32x2_t r13 = simde_vshrn_n_s64(a, 13);
+    simde_int32x2_t r19 = simde_vshrn_n_s64(a, 19);
+    simde_int32x2_t r26 = simde_vshrn_n_s64(a, 26);
+    simde_int32x2_t r32 = simde_vshrn_n_s64(a, 32);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshrn_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r6[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(54501), UINT16_C(21348), UINT16_C(16418), UINT16_C(50756), UINT16_C(12157), UINT16_C(48700) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(114), UINT8_C(178), UINT8_C( 17), UINT8_C( 34), UINT8_C(190), UINT8_C( 30) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(156), UINT8_C(108), UINT8_C(  4), UINT8_C(200), UINT8_C(239), UINT8_C(199) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(167), UINT8_C(155), UINT8_C(  1), UINT8_C( 50), UINT8_C(123), UINT8_C(241) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C( 83), UINT8_C( 77), UINT8_C(  0), UINT8_C( 25), UINT8_C(189), UINT8_C(248) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(212), UINT8_C( 83), UINT8_C( 64), UINT8_C(198), UINT8_C( 47), UINT8_C(190) } },
+    { { UINT16_C(37641), UINT16_C(54119), UINT16_C(28480), UINT16_C(22373), UINT16_C(57289), UINT16_C(58061), UINT16_C(16314), UINT16_C(59316) },
+      { UINT8_C(132), UINT8_C(179), UINT8_C(160), UINT8_C(178), UINT8_C(228), UINT8_C(102), UINT8_C(221), UINT8_C(218) },
+      { UINT8_C( 97), UINT8_C(108), UINT8_C(232), UINT8_C(236), UINT8_C(249), UINT8_C( 89), UINT8_C(247), UINT8_C(246) },
+      { UINT8_C(152), UINT8_C(155), UINT8_C(122), UINT8_C(187), UINT8_C(254), UINT8_C( 22), UINT8_C(253), UINT8_C( 61) },
+      { UINT8_C( 76), UINT8_C( 77), UINT8_C(189), UINT8_C( 93), UINT8_C(127), UINT8_C(139), UINT8_C(254), UINT8_C(158) },
+      { UINT8_C(147), UINT8_C(211), UINT8_C(111), UINT8_C( 87), UINT8_C(223), UINT8_C(226), UINT8_C( 63), UINT8_C(231) } },
+    { { UINT16_C(24334), UINT16_C( 2212), UINT16_C( 3785), UINT16_C(57083), UINT16_C(29548), UINT16_C(46071), UINT16_C(20484), UINT16_C(28754) },
+      { UINT8_C(135), UINT8_C( 82), UINT8_C(100), UINT8_C(125), UINT8_C(182), UINT8_C(251), UINT8_C(  2), UINT8_C( 41) },
+      { UINT8_C(225), UINT8_C( 20), UINT8_C(217), UINT8_C(223), UINT8_C(109), UINT8_C(126), UINT8_C(  0), UINT8_C( 10) },
+      { UINT8_C(248), UINT8_C( 69), UINT8_C(118), UINT8_C(247), UINT8_C(155), UINT8_C(159), UINT8_C(128), UINT8_C(130) },
+      { UINT8_C(124), UINT8_C( 34), UINT8_C( 59), UINT8_C(123), UINT8_C(205), UINT8_C(207), UINT8_C( 64), UINT8_C(193) },
+      { UINT8_C( 95), UINT8_C(  8), UINT8_C( 14), UINT8_C(222), UINT8_C(115), UINT8_C(179), UINT8_C( 80), UINT8_C(112) } },
+    { { UINT16_C(29407), UINT16_C(51564), UINT16_C(50069), UINT16_C( 5874), UINT16_C( 2455), UINT16_C( 5340), UINT16_C(64831), UINT16_C(21494) },
+      { UINT8_C(111), UINT8_C(182), UINT8_C(202), UINT8_C(121), UINT8_C(203), UINT8_C(110), UINT8_C(159), UINT8_C(251) },
+      { UINT8_C( 91), UINT8_C( 45), UINT8_C(114), UINT8_C(222), UINT8_C( 50), UINT8_C(155), UINT8_C(167), UINT8_C(126) },
+      { UINT8_C(150), UINT8_C( 75), UINT8_C( 28), UINT8_C(183), UINT8_C( 76), UINT8_C(166), UINT8_C(233), UINT8_C(159) },
+      { UINT8_C(203), UINT8_C( 37), UINT8_C( 14), UINT8_C( 91), UINT8_C( 38), UINT8_C( 83), UINT8_C(244), UINT8_C( 79) },
+      { UINT8_C(114), UINT8_C(201), UINT8_C(195), UINT8_C( 22), UINT8_C(  9), UINT8_C( 20), UINT8_C(253), UINT8_C( 83) } },
+    { { UINT16_C(46625), UINT16_C(26815), UINT16_C(53171), UINT16_C(24658), UINT16_C(35312), UINT16_C(32591), UINT16_C(37773), UINT16_C(34363) },
+      { UINT8_C( 16), UINT8_C( 95), UINT8_C(217), UINT8_C( 41), UINT8_C(248), UINT8_C(167), UINT8_C(198), UINT8_C( 29) },
+      { UINT8_C(196), UINT8_C( 23), UINT8_C(246), UINT8_C( 10), UINT8_C( 62), UINT8_C(233), UINT8_C(113), UINT8_C(199) },
+      { UINT8_C(177), UINT8_C( 69), UINT8_C(125), UINT8_C(  2), UINT8_C( 79), UINT8_C(250), UINT8_C(156), UINT8_C( 49) },
+      { UINT8_C(216), UINT8_C(162), UINT8_C( 62), UINT8_C(129), UINT8_C( 39), UINT8_C(253), UINT8_C( 78), UINT8_C( 24) },
+      { UINT8_C(182), UINT8_C(104), UINT8_C(207), UINT8_C( 96), UINT8_C(137), UINT8_C(127), UINT8_C(147), UINT8_C(134) } },
+    { { UINT16_C(26841), UINT16_C(55730), UINT16_C(25963), UINT16_C(54935), UINT16_C(14470), UINT16_C(18462), UINT16_C(19856), UINT16_C(24375) },
+      { UINT8_C(108), UINT8_C(217), UINT8_C(181), UINT8_C( 75), UINT8_C( 67), UINT8_C( 15), UINT8_C(200), UINT8_C(155) },
+      { UINT8_C( 27), UINT8_C( 54), UINT8_C(173), UINT8_C(210), UINT8_C( 16), UINT8_C(  3), UINT8_C(178), UINT8_C(230) },
+      { UINT8_C( 70), UINT8_C(205), UINT8_C( 43), UINT8_C(180), UINT8_C(196), UINT8_C( 64), UINT8_C(108), UINT8_C(249) },
+      { UINT8_C(163), UINT8_C(102), UINT8_C(149), UINT8_C( 90), UINT8_C(226), UINT8_C( 32), UINT8_C( 54), UINT8_C(124) },
+      { UINT8_C(104), UINT8_C(217), UINT8_C(101), UINT8_C(214), UINT8_C( 56), UINT8_C( 72), UINT8_C( 77), UINT8_C( 95) } },
+    { { UINT16_C(19257), UINT16_C( 9554), UINT16_C(22028), UINT16_C(48800), UINT16_C(59453), UINT16_C( 4152), UINT16_C(52325), UINT16_C(37928) },
+      { UINT8_C(156), UINT8_C(169), UINT8_C(  6), UINT8_C( 80), UINT8_C( 30), UINT8_C( 28), UINT8_C( 50), UINT8_C( 20) },
+      { UINT8_C(103), UINT8_C(170), UINT8_C(193), UINT8_C(212), UINT8_C(  7), UINT8_C(  7), UINT8_C(140), UINT8_C(133) },
+      { UINT8_C( 89), UINT8_C( 42), UINT8_C(176), UINT8_C(245), UINT8_C( 65), UINT8_C(129), UINT8_C( 99), UINT8_C(161) },
+      { UINT8_C( 44), UINT8_C(149), UINT8_C( 88), UINT8_C(250), UINT8_C(160), UINT8_C( 64), UINT8_C( 49), UINT8_C( 80) },
+      { UINT8_C( 75), UINT8_C( 37), UINT8_C( 86), UINT8_C(190), UINT8_C(232), UINT8_C( 16), UINT8_C(204), UINT8_C(148) } },
+    { { UINT16_C(42015), UINT16_C(52671), UINT16_C( 1126), UINT16_C(59691), UINT16_C(17192), UINT16_C(60610), UINT16_C(35600), UINT16_C( 1007) },
+      { UINT8_C( 15), UINT8_C(223), UINT8_C( 51), UINT8_C(149), UINT8_C(148), UINT8_C( 97), UINT8_C(136), UINT8_C(247) },
+      { UINT8_C(131), UINT8_C(183), UINT8_C(140), UINT8_C( 37), UINT8_C(101), UINT8_C(152), UINT8_C( 98), UINT8_C(125) },
+      { UINT8_C( 32), UINT8_C(109), UINT8_C( 35), UINT8_C( 73), UINT8_C( 25), UINT8_C(102), UINT8_C( 88), UINT8_C( 31) },
+      { UINT8_C(144), UINT8_C( 54), UINT8_C( 17), UINT8_C(164), UINT8_C( 12), UINT8_C(179), UINT8_C( 44), UINT8_C( 15) },
+      { UINT8_C(164), UINT8_C(205), UINT8_C(  4), UINT8_C(233), UINT8_C( 67), UINT8_C(236), UINT8_C(139), UINT8_C(  3) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+
+    simde_uint8x8_t r1 = simde_vshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r6, simde_vld1_u8(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a = simde_test_arm_neon_random_u16x8();
+
+    simde_uint8x8_t r1 = simde_vshrn_n_u16(a, 1);
+    simde_uint8x8_t r3 = simde_vshrn_n_u16(a, 3);
+    simde_uint8x8_t r5 = simde_vshrn_n_u16(a, 5);
+    simde_uint8x8_t r6 = simde_vshrn_n_u16(a, 6);
+    simde_uint8x8_t r8 = simde_vshrn_n_u16(a, 8);
+
+    simde_test_arm_neon_write_u16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshrn_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r10[4];
+    uint16_t r13[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(1800715086), UINT32_C(1718937959) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(23975), UINT16_C(29875) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(21229), UINT16_C(54181) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(54574), UINT16_C(40250) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(23205), UINT16_C(13223) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(27476), UINT16_C(26228) } },
+    { { UINT32_C(2717326289), UINT32_C(1687761761), UINT32_C(3887432308), UINT32_C(1250460282) },
+      { UINT16_C(36328), UINT16_C(39344), UINT16_C(49466), UINT16_C(16701) },
+      { UINT16_C(56431), UINT16_C(25805), UINT16_C(54793), UINT16_C( 8713) },
+      { UINT16_C(32198), UINT16_C( 9804), UINT16_C(60768), UINT16_C(41504) },
+      { UINT16_C( 4024), UINT16_C( 9417), UINT16_C(15788), UINT16_C(21572) },
+      { UINT16_C(41463), UINT16_C(25753), UINT16_C(59317), UINT16_C(19080) } },
+    { { UINT32_C(1148958190), UINT32_C(1935611272), UINT32_C(1640816223), UINT32_C(2910786190) },
+      { UINT16_C(56055), UINT16_C(35524), UINT16_C(28463), UINT16_C(35143) },
+      { UINT16_C(61143), UINT16_C(31830), UINT16_C(13177), UINT16_C(64586) },
+      { UINT16_C( 7917), UINT16_C(55237), UINT16_C(29495), UINT16_C(24516) },
+      { UINT16_C( 9181), UINT16_C(39672), UINT16_C( 3686), UINT16_C(27640) },
+      { UINT16_C(17531), UINT16_C(29535), UINT16_C(25036), UINT16_C(44415) } },
+    { { UINT32_C(3265226687), UINT32_C(1595060610), UINT32_C(1368276104), UINT32_C(3742446042) },
+      { UINT16_C(46047), UINT16_C(22721), UINT16_C( 7748), UINT16_C(39149) },
+      { UINT16_C(32158), UINT16_C(19142), UINT16_C(14578), UINT16_C(17607) },
+      { UINT16_C(42969), UINT16_C(50348), UINT16_C(25487), UINT16_C(50252) },
+      { UINT16_C( 5371), UINT16_C(63637), UINT16_C(35953), UINT16_C(63625) },
+      { UINT16_C(49823), UINT16_C(24338), UINT16_C(20878), UINT16_C(57105) } },
+    { { UINT32_C(3098089947), UINT32_C(  36610768), UINT32_C(1705702468), UINT32_C(3904548927) },
+      { UINT16_C(36077), UINT16_C(20840), UINT16_C(31266), UINT16_C(22559) },
+      { UINT16_C(42087), UINT16_C(47755), UINT16_C(43985), UINT16_C(60096) },
+      { UINT16_C(10822), UINT16_C(35752), UINT16_C(27325), UINT16_C(11948) },
+      { UINT16_C(50504), UINT16_C( 4469), UINT16_C(11607), UINT16_C(17877) },
+      { UINT16_C(47273), UINT16_C(  558), UINT16_C(26026), UINT16_C(59578) } },
+    { { UINT32_C(  83308769), UINT32_C(2067509750), UINT32_C(1986790847), UINT32_C(3405243118) },
+      { UINT16_C(39024), UINT16_C(55547), UINT16_C(  735), UINT16_C(61815) },
+      { UINT16_C(56515), UINT16_C(61127), UINT16_C(45078), UINT16_C(57227) },
+      { UINT16_C(15820), UINT16_C(52972), UINT16_C(39681), UINT16_C(48632) },
+      { UINT16_C(10169), UINT16_C(55773), UINT16_C(45920), UINT16_C(22463) },
+      { UINT16_C( 1271), UINT16_C(31547), UINT16_C(30316), UINT16_C(51959) } },
+    { { UINT32_C( 292542480), UINT32_C( 723578134), UINT32_C(3370332694), UINT32_C( 995086844) },
+      { UINT16_C(60424), UINT16_C(30347), UINT16_C(39179), UINT16_C(59646) },
+      { UINT16_C(48992), UINT16_C(33716), UINT16_C(36040), UINT16_C(16199) },
+      { UINT16_C(23542), UINT16_C(51259), UINT16_C(14540), UINT16_C(54260) },
+      { UINT16_C(35710), UINT16_C(22791), UINT16_C(18201), UINT16_C(55934) },
+      { UINT16_C( 4463), UINT16_C(11040), UINT16_C(51427), UINT16_C(15183) } },
+    { { UINT32_C(3629407770), UINT32_C( 541237344), UINT32_C(2274411813), UINT32_C(2804492503) },
+      { UINT16_C(12045), UINT16_C(20528), UINT16_C(25234), UINT16_C(37995) },
+      { UINT16_C(20856), UINT16_C( 2689), UINT16_C(17172), UINT16_C(42147) },
+      { UINT16_C( 5399), UINT16_C( 4264), UINT16_C(58417), UINT16_C(51786) },
+      { UINT16_C(49826), UINT16_C(  533), UINT16_C(15494), UINT16_C(14665) },
+      { UINT16_C(55380), UINT16_C( 8258), UINT16_C(34704), UINT16_C(42793) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+
+    simde_uint16x4_t r1 = simde_vshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r13, simde_vld1_u16(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+
+    simde_uint16x4_t r1 = simde_vshrn_n_u32(a, 1);
+    simde_uint16x4_t r6 = simde_vshrn_n_u32(a, 6);
+    simde_uint16x4_t r10 = simde_vshrn_n_u32(a, 10);
+    simde_uint16x4_t r13 = simde_vshrn_n_u32(a, 13);
+    simde_uint16x4_t r16 = simde_vshrn_n_u32(a, 16);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshrn_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r19[2];
+    uint32_t r26[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { { UINT64_C(                   0),                     UINT64_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(         0),           UINT32_MAX } },
+    { { UINT64_C( 2467155042098640544), UINT64_C(15224354039261485756) },
+      { UINT32_C( 957168464), UINT32_C( 377187678) },
+      { UINT32_C(3280179411), UINT32_C( 716269494) },
+      { UINT32_C(2735607363), UINT32_C(4171941278) },
+      { UINT32_C(2403736604), UINT32_C(3522254219) },
+      { UINT32_C( 574429296), UINT32_C(3544696150) } },
+    { { UINT64_C( 2081693601161862041), UINT64_C( 1514619391546740068) },
+      { UINT32_C(2251976140), UINT32_C(3917997746) },
+      { UINT32_C(1248355238), UINT32_C( 310286462) },
+      { UINT32_C(1965662606), UINT32_C(2689202785) },
+      { UINT32_C( 954880835), UINT32_C(1094751220) },
+      { UINT32_C( 484682061), UINT32_C( 352649807) } },
+    { { UINT64_C( 4323533106530087953), UINT64_C(  437623095205423281) },
+      { UINT32_C( 112130568), UINT32_C(2006774872) },
+      { UINT32_C( 866151151), UINT32_C(4279728591) },
+      { UINT32_C( 147751339), UINT32_C(1476156903) },
+      { UINT32_C(   1154307), UINT32_C(2226124987) },
+      { UINT32_C(1006650996), UINT32_C( 101892066) } },
+    { { UINT64_C(17861536120387935237), UINT64_C( 9016299554716249688) },
+      { UINT32_C(3343126018), UINT32_C(1504704300) },
+      { UINT32_C(1673294912), UINT32_C(2774899455) },
+      { UINT32_C( 495907281), UINT32_C( 177575531) },
+      { UINT32_C(4164623843), UINT32_C(1209346860) },
+      { UINT32_C(4158712951), UINT32_C(2099270828) } },
+    { { UINT64_C( 3379811994246951513), UINT64_C( 6137966096214675031) },
+      { UINT32_C( 106486060), UINT32_C(1948395307) },
+      { UINT32_C( 147875213), UINT32_C(2099724834) },
+      { UINT32_C(4028842390), UINT32_C(3455360264) },
+      { UINT32_C(3118483075), UINT32_C(1268508986) },
+      { UINT32_C( 786923802), UINT32_C(1429106596) } },
+    { { UINT64_C( 5697549252863191849), UINT64_C(15936944870624907155) },
+      { UINT32_C(3852072340), UINT32_C( 222980041) },
+      { UINT32_C( 383670687), UINT32_C( 929092774) },
+      { UINT32_C( 945518950), UINT32_C(1826456402) },
+      { UINT32_C(3295721202), UINT32_C(1255783174) },
+      { UINT32_C(1326564059), UINT32_C(3710609132) } },
+    { { UINT64_C( 2047991848064949486), UINT64_C(14372984722387890925) },
+      { UINT32_C( 392646263), UINT32_C( 302381430) },
+      { UINT32_C(1843492468), UINT32_C(3416334431) },
+      { UINT32_C(2109179353), UINT32_C(3811476609) },
+      { UINT32_C( 452685579), UINT32_C(3720764681) },
+      { UINT32_C( 476835260), UINT32_C(3346471284) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r19, simde_vld1_u32(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u32x2(r26, simde_vld1_u32(test_vec[i].r26));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a = simde_test_arm_neon_random_u64x2();
+
+    simde_uint32x2_t r1 = simde_vshrn_n_u64(a, 1);
+    simde_uint32x2_t r13 = simde_vshrn_n_u64(a, 13);
+    simde_uint32x2_t r19 = simde_vshrn_n_u64(a, 19);
+    simde_uint32x2_t r26 = simde_vshrn_n_u64(a, 26);
+    simde_uint32x2_t r32 = simde_vshrn_n_u64(a, 32);
+
+    simde_test_arm_neon_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r26, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vshrn_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshrn_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshrn_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshrn_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshrn_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshrn_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1897 @@
+#define SIMDE_TEST_ARM_NEON_INSN sli_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sli_n.h"
+
+static int
+test_simde_vslid_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    int64_t b;
+    int64_t r0;
+    int64_t r19;
+    int64_t r42;
+    int64_t r63;
+  } test_vec[] = {
+    {  INT64_C( 4039998325515756735),
+      -INT64_C( 7274072498483946199),
+      -INT64_C( 7274072498483946199),
+       INT64_C( 7841201708935554239),
+      -INT64_C( 5443544550749887297),
+      -INT64_C( 5183373711339019073) },
+    {  INT64_C( 4787041292247796919),
+       INT64_C( 7858708887224894300),
+       INT64_C( 7858708887224894300),
+      -INT64_C( 1097750252646658889),
+      -INT64_C(  356504888813908809),
+       INT64_C( 4787041292247796919) },
+    { -INT64_C( 5051031712602773031),
+       INT64_C( 8057161415882390540),
+       INT64_C( 8057161415882390540),
+       INT64_C( 5545018806870747609),
+      -INT64_C( 7138151072726242855),
+       INT64_C( 4172340324252002777) },
+    {  INT64_C( 3767261450651906870),
+       INT64_C( 1704686602733822695),
+       INT64_C( 1704686602733822695),
+       INT64_C( 1979202882657399606),
+       INT64_C( 4939213302512300854),
+      -INT64_C( 5456110586202868938) },
+    {  INT64_C( 8002692914092425616),
+       INT64_C( 8977193993826514153),
+       INT64_C( 8977193993826514153),
+       INT64_C( 3674460544486326672),
+       INT64_C( 3662454326330376592),
+      -INT64_C( 1220679122762350192) },
+    { -INT64_C( 3968002559005477313),
+      -INT64_C( 5724389947306983034),
+      -INT64_C( 5724389947306983034),
+       INT64_C(  963866639398549055),
+      -INT64_C( 3673219093552220609),
+       INT64_C( 5255369477849298495) },
+    { -INT64_C( 8199971112925647502),
+      -INT64_C(   37442585311916697),
+      -INT64_C(   37442585311916697),
+      -INT64_C( 3362473587218174606),
+       INT64_C(  807725121071099250),
+      -INT64_C( 8199971112925647502) },
+    {  INT64_C( 4949503627685457907),
+      -INT64_C( 6270413538316892769),
+      -INT64_C( 6270413538316892769),
+       INT64_C( 2368663134374916083),
+       INT64_C( 5266536810438389747),
+      -INT64_C( 4273868409169317901) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r0 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 0);
+    int64_t r19 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 19);
+    int64_t r42 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 42);
+    int64_t r63 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 63);
+
+    simde_assert_equal_i64(r0, test_vec[i].r0);
+    simde_assert_equal_i64(r19, test_vec[i].r19);
+    simde_assert_equal_i64(r42, test_vec[i].r42);
+    simde_assert_equal_i64(r63, test_vec[i].r63);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    int64_t b = simde_test_codegen_random_i64();
+    int64_t r0 = simde_vslid_n_s64(a, b, 0);
+    int64_t r19 = simde_vslid_n_s64(a, b, 19);
+    int64_t r42 = simde_vslid_n_s64(a, b, 42);
+    int64_t r63 = simde_vslid_n_s64(a, b, 63);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vslid_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r0;
+    uint64_t r19;
+    uint64_t r42;
+    uint64_t r63;
+  } test_vec[] = {
+    { UINT64_C( 6463097961149937306),
+      UINT64_C( 9464988902633727664),
+      UINT64_C( 9464988902633727664),
+      UINT64_C( 3031771351620040346),
+      UINT64_C(18274131031556929178),
+      UINT64_C( 6463097961149937306) },
+    { UINT64_C(16914598336579996889),
+      UINT64_C(  380728556228113911),
+      UINT64_C(  380728556228113911),
+      UINT64_C(17642410188037917913),
+      UINT64_C( 5465080291339242713),
+      UINT64_C(16914598336579996889) },
+    { UINT64_C( 5198679159898398711),
+      UINT64_C(10142076104243656857),
+      UINT64_C(10142076104243656857),
+      UINT64_C( 2583574551565197303),
+      UINT64_C(12601748124318851063),
+      UINT64_C(14422051196753174519) },
+    { UINT64_C(10275669294161887230),
+      UINT64_C( 2038024228563836945),
+      UINT64_C( 2038024228563836945),
+      UINT64_C( 2443019724876447742),
+      UINT64_C(13799107081928212478),
+      UINT64_C(10275669294161887230) },
+    { UINT64_C(  162302509318109726),
+      UINT64_C(15971136676797806059),
+      UINT64_C(15971136676797806059),
+      UINT64_C(  108858212507154974),
+      UINT64_C(18147163738431519262),
+      UINT64_C( 9385674546172885534) },
+    { UINT64_C(  910017507167167313),
+      UINT64_C(  732850981860811999),
+      UINT64_C(  732850981860811999),
+      UINT64_C(16190010618860659537),
+      UINT64_C( 8111963804634833745),
+      UINT64_C(10133389544021943121) },
+    { UINT64_C(13669158174799900581),
+      UINT64_C( 4894964776109320586),
+      UINT64_C( 4894964776109320586),
+      UINT64_C( 4916770109522128805),
+      UINT64_C( 3361421382353366949),
+      UINT64_C( 4445786137945124773) },
+    { UINT64_C( 6414745857893969720),
+      UINT64_C(11442844262209349249),
+      UINT64_C(11442844262209349249),
+      UINT64_C( 3591173026375118648),
+      UINT64_C( 7753515613920538424),
+      UINT64_C(15638117894748745528) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r0 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 0);
+    uint64_t r19 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 19);
+    uint64_t r42 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 42);
+    uint64_t r63 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 63);
+
+    simde_assert_equal_u64(r0, test_vec[i].r0);
+    simde_assert_equal_u64(r19, test_vec[i].r19);
+    simde_assert_equal_u64(r42, test_vec[i].r42);
+    simde_assert_equal_u64(r63, test_vec[i].r63);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t b = simde_test_codegen_random_u64();
+    uint64_t r0 = simde_vslid_n_u64(a, b, 0);
+    uint64_t r19 = simde_vslid_n_u64(a, b, 19);
+    uint64_t r42 = simde_vslid_n_u64(a, b, 42);
+    uint64_t r63 = simde_vslid_n_u64(a, b, 63);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[8];
+    int8_t b[8];
+    int8_t r0[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r7[8];
+  } test_vec[] = {
+    { { -INT8_C(  78),  INT8_C( 115),  INT8_C(  19),  INT8_C(  60), -INT8_C(  40),  INT8_C( 118),  INT8_C(  67),  INT8_C(  59) },
+      {  INT8_C(  55),  INT8_C(  19), -INT8_C(  68), -INT8_C(  57),  INT8_C( 121), -INT8_C(  72), -INT8_C(   1),  INT8_C( 115) },
+      {  INT8_C(  55),  INT8_C(  19), -INT8_C(  68), -INT8_C(  57),  INT8_C( 121), -INT8_C(  72), -INT8_C(   1),  INT8_C( 115) },
+      { -INT8_C(  70), -INT8_C( 101), -INT8_C(  29),  INT8_C(  60), -INT8_C(  56), -INT8_C(  58), -INT8_C(   5), -INT8_C( 101) },
+      { -INT8_C(  14),  INT8_C( 115), -INT8_C( 109), -INT8_C(   4),  INT8_C(  56),  INT8_C(  22), -INT8_C(  29),  INT8_C( 123) },
+      { -INT8_C(  78), -INT8_C(  13),  INT8_C(  19), -INT8_C(  68), -INT8_C(  40),  INT8_C( 118), -INT8_C(  61), -INT8_C(  69) } },
+    { { -INT8_C(  42), -INT8_C(  38),  INT8_C(  21),  INT8_C(  58),  INT8_C(  11),  INT8_C( 119),  INT8_C(  45), -INT8_C(  61) },
+      {  INT8_C(  18),  INT8_C( 122),  INT8_C(  70),  INT8_C( 117),  INT8_C(  94),  INT8_C(  21),  INT8_C(   4),  INT8_C(  47) },
+      {  INT8_C(  18),  INT8_C( 122),  INT8_C(  70),  INT8_C( 117),  INT8_C(  94),  INT8_C(  21),  INT8_C(   4),  INT8_C(  47) },
+      { -INT8_C( 106), -INT8_C(  46),  INT8_C(  53), -INT8_C(  86), -INT8_C(  13), -INT8_C(  81),  INT8_C(  37),  INT8_C( 123) },
+      {  INT8_C(  86),  INT8_C(  90), -INT8_C(  43), -INT8_C(  70), -INT8_C(  53), -INT8_C(  73), -INT8_C( 115), -INT8_C(  29) },
+      {  INT8_C(  86),  INT8_C(  90),  INT8_C(  21), -INT8_C(  70),  INT8_C(  11), -INT8_C(   9),  INT8_C(  45), -INT8_C(  61) } },
+    { { -INT8_C(  71),  INT8_C(  76), -INT8_C(  49), -INT8_C(  79),  INT8_C(  96),  INT8_C(  54),  INT8_C( 126),  INT8_C(  92) },
+      { -INT8_C( 106), -INT8_C( 118), -INT8_C(   4),  INT8_C(  26), -INT8_C(  62),  INT8_C(  48),  INT8_C(  49),  INT8_C(   4) },
+      { -INT8_C( 106), -INT8_C( 118), -INT8_C(   4),  INT8_C(  26), -INT8_C(  62),  INT8_C(  48),  INT8_C(  49),  INT8_C(   4) },
+      { -INT8_C(  79),  INT8_C(  84), -INT8_C(  25), -INT8_C(  47),  INT8_C(  16), -INT8_C( 122), -INT8_C( 114),  INT8_C(  36) },
+      { -INT8_C(  39),  INT8_C(  76), -INT8_C( 113),  INT8_C(  81),  INT8_C(  64),  INT8_C(  22),  INT8_C(  62), -INT8_C( 100) },
+      {  INT8_C(  57),  INT8_C(  76),  INT8_C(  79),  INT8_C(  49),  INT8_C(  96),  INT8_C(  54), -INT8_C(   2),  INT8_C(  92) } },
+    { { -INT8_C( 115), -INT8_C(  74),  INT8_C(  77),  INT8_C(  62), -INT8_C(  25),  INT8_C(  56), -INT8_C(  34), -INT8_C( 103) },
+      {  INT8_C( 118),  INT8_C(  40), -INT8_C(  13),  INT8_C( 125), -INT8_C(  56),  INT8_C(   4), -INT8_C(  46), -INT8_C( 122) },
+      {  INT8_C( 118),  INT8_C(  40), -INT8_C(  13),  INT8_C( 125), -INT8_C(  56),  INT8_C(   4), -INT8_C(  46), -INT8_C( 122) },
+      { -INT8_C(  75),  INT8_C(  70), -INT8_C(  99), -INT8_C(  18),  INT8_C(  71),  INT8_C(  32), -INT8_C( 106),  INT8_C(  49) },
+      { -INT8_C(  51),  INT8_C(  22),  INT8_C( 109), -INT8_C(  66),  INT8_C(   7), -INT8_C( 104),  INT8_C(  94), -INT8_C(  39) },
+      {  INT8_C(  13),  INT8_C(  54), -INT8_C(  51), -INT8_C(  66),  INT8_C( 103),  INT8_C(  56),  INT8_C(  94),  INT8_C(  25) } },
+    { {  INT8_C(  91),  INT8_C( 102), -INT8_C(  45), -INT8_C( 125),  INT8_C(  41), -INT8_C(  20), -INT8_C(  43), -INT8_C(  88) },
+      {  INT8_C(  97), -INT8_C(  34), -INT8_C(  23),  INT8_C( 102),  INT8_C( 119),  INT8_C(  21),  INT8_C(  70),  INT8_C( 119) },
+      {  INT8_C(  97), -INT8_C(  34), -INT8_C(  23),  INT8_C( 102),  INT8_C( 119),  INT8_C(  21),  INT8_C(  70),  INT8_C( 119) },
+      {  INT8_C(  11), -INT8_C(  10),  INT8_C(  75),  INT8_C(  51), -INT8_C(  71), -INT8_C(  84),  INT8_C(  53), -INT8_C(  72) },
+      {  INT8_C(  59), -INT8_C(  58),  INT8_C(  51), -INT8_C(  61), -INT8_C(  23), -INT8_C(  84), -INT8_C(  43), -INT8_C(  24) },
+      { -INT8_C(  37),  INT8_C( 102), -INT8_C(  45),  INT8_C(   3), -INT8_C(  87), -INT8_C(  20),  INT8_C(  85), -INT8_C(  88) } },
+    { {  INT8_C(  68), -INT8_C( 111),  INT8_C(  88),  INT8_C(  36), -INT8_C(  32),  INT8_C( 126),  INT8_C( 119),  INT8_C(  70) },
+      {  INT8_C(  84),  INT8_C(  83), -INT8_C(   9),  INT8_C( 116), -INT8_C(  55), -INT8_C( 110),  INT8_C(  13),  INT8_C(  67) },
+      {  INT8_C(  84),  INT8_C(  83), -INT8_C(   9),  INT8_C( 116), -INT8_C(  55), -INT8_C( 110),  INT8_C(  13),  INT8_C(  67) },
+      { -INT8_C(  92), -INT8_C( 103), -INT8_C(  72), -INT8_C(  92),  INT8_C(  72), -INT8_C( 106),  INT8_C( 111),  INT8_C(  30) },
+      { -INT8_C( 124),  INT8_C( 113), -INT8_C(   8), -INT8_C( 124),  INT8_C(  32),  INT8_C(  94), -INT8_C(  73),  INT8_C( 102) },
+      {  INT8_C(  68), -INT8_C( 111), -INT8_C(  40),  INT8_C(  36), -INT8_C(  32),  INT8_C( 126), -INT8_C(   9), -INT8_C(  58) } },
+    { { -INT8_C( 127), -INT8_C(  59), -INT8_C(  16),  INT8_C(  75),  INT8_C( 101), -INT8_C( 106),  INT8_C(   0),      INT8_MIN },
+      { -INT8_C( 111), -INT8_C( 123), -INT8_C(  67),  INT8_C(  67), -INT8_C(  63),  INT8_C(  30), -INT8_C(  91),  INT8_C( 105) },
+      { -INT8_C( 111), -INT8_C( 123), -INT8_C(  67),  INT8_C(  67), -INT8_C(  63),  INT8_C(  30), -INT8_C(  91),  INT8_C( 105) },
+      { -INT8_C( 119),  INT8_C(  45), -INT8_C(  24),  INT8_C(  27),  INT8_C(  13), -INT8_C(  10),  INT8_C(  40),  INT8_C(  72) },
+      {  INT8_C(  33), -INT8_C(  91), -INT8_C(  80),  INT8_C( 107),  INT8_C(  37), -INT8_C(  42), -INT8_C(  96),  INT8_C(  32) },
+      { -INT8_C( 127), -INT8_C(  59), -INT8_C(  16), -INT8_C(  53), -INT8_C(  27),  INT8_C(  22),      INT8_MIN,      INT8_MIN } },
+    { {  INT8_C( 105), -INT8_C(  72),  INT8_C( 110),  INT8_C(  20),  INT8_C(  29), -INT8_C(  46), -INT8_C(  18),  INT8_C(  68) },
+      { -INT8_C(   3),  INT8_C(  74),  INT8_C(  30),  INT8_C(  21),  INT8_C(  34),  INT8_C( 111),  INT8_C(   7), -INT8_C( 122) },
+      { -INT8_C(   3),  INT8_C(  74),  INT8_C(  30),  INT8_C(  21),  INT8_C(  34),  INT8_C( 111),  INT8_C(   7), -INT8_C( 122) },
+      { -INT8_C(  23),  INT8_C(  80), -INT8_C(  10), -INT8_C(  84),  INT8_C(  21),  INT8_C( 122),  INT8_C(  62),  INT8_C(  52) },
+      { -INT8_C(  87),  INT8_C(  88), -INT8_C(  50), -INT8_C(  76),  INT8_C(  93), -INT8_C(  14), -INT8_C(  18), -INT8_C(  60) },
+      { -INT8_C(  23),  INT8_C(  56),  INT8_C( 110), -INT8_C( 108),  INT8_C(  29), -INT8_C(  46), -INT8_C(  18),  INT8_C(  68) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+
+    simde_int8x8_t r0 = simde_vsli_n_s8(a, b, 0);
+    simde_int8x8_t r3 = simde_vsli_n_s8(a, b, 3);
+    simde_int8x8_t r5 = simde_vsli_n_s8(a, b, 5);
+    simde_int8x8_t r7 = simde_vsli_n_s8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_i8x8(r0, simde_vld1_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r7, simde_vld1_s8(test_vec[i].r7));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x8_t a = simde_test_arm_neon_random_i8x8();
+    simde_int8x8_t b = simde_test_arm_neon_random_i8x8();
+
+    simde_int8x8_t r0 = simde_vsli_n_s8(a, b, 0);
+    simde_int8x8_t r3 = simde_vsli_n_s8(a, b, 3);
+    simde_int8x8_t r5 = simde_vsli_n_s8(a, b, 5);
+    simde_int8x8_t r7 = simde_vsli_n_s8(a, b, 7);
+
+    simde_test_arm_neon_write_i8x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r7, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t r0[4];
+    int16_t r6[4];
+    int16_t r11[4];
+    int16_t r15[4];
+  } test_vec[] = {
+    { {  INT16_C( 24041), -INT16_C( 24467), -INT16_C( 16164), -INT16_C(  9737) },
+      {  INT16_C( 24311),  INT16_C( 14642),  INT16_C( 16866),  INT16_C( 11103) },
+      {  INT16_C( 24311),  INT16_C( 14642),  INT16_C( 16866),  INT16_C( 11103) },
+      { -INT16_C( 16919),  INT16_C( 19629),  INT16_C( 30876), -INT16_C( 10249) },
+      { -INT16_C( 16919), -INT16_C( 28563),  INT16_C(  4316), -INT16_C(  1545) },
+      { -INT16_C(  8727),  INT16_C(  8301),  INT16_C( 16604), -INT16_C(  9737) } },
+    { {  INT16_C( 29948), -INT16_C(  1163), -INT16_C( 24690), -INT16_C(  2898) },
+      { -INT16_C( 28261), -INT16_C( 12705), -INT16_C( 32542),  INT16_C(  9418) },
+      { -INT16_C( 28261), -INT16_C( 12705), -INT16_C( 32542),  INT16_C(  9418) },
+      {  INT16_C( 26364), -INT16_C( 26635),  INT16_C( 14478),  INT16_C( 12974) },
+      { -INT16_C(  8964), -INT16_C(  1163),  INT16_C(  6030),  INT16_C( 21678) },
+      { -INT16_C(  2820), -INT16_C(  1163),  INT16_C(  8078),  INT16_C( 29870) } },
+    { {  INT16_C( 27161), -INT16_C( 25115),  INT16_C( 29284),  INT16_C( 31523) },
+      { -INT16_C( 23131), -INT16_C( 12587),  INT16_C( 20185),  INT16_C( 11325) },
+      { -INT16_C( 23131), -INT16_C( 12587),  INT16_C( 20185),  INT16_C( 11325) },
+      {  INT16_C( 26969), -INT16_C( 19099), -INT16_C( 18844),  INT16_C(  3939) },
+      {  INT16_C( 10777), -INT16_C( 21019), -INT16_C( 13724), -INT16_C(  5341) },
+      { -INT16_C(  5607), -INT16_C( 25115), -INT16_C(  3484), -INT16_C(  1245) } },
+    { { -INT16_C(   930),  INT16_C( 14336), -INT16_C( 22424), -INT16_C(  4218) },
+      { -INT16_C( 10268), -INT16_C( 21329), -INT16_C( 22955), -INT16_C(  5857) },
+      { -INT16_C( 10268), -INT16_C( 21329), -INT16_C( 22955), -INT16_C(  5857) },
+      { -INT16_C(  1762),  INT16_C( 11200), -INT16_C( 27288),  INT16_C( 18374) },
+      {  INT16_C(  9310),  INT16_C( 30720), -INT16_C( 22424), -INT16_C(   122) },
+      {  INT16_C( 31838), -INT16_C( 18432), -INT16_C( 22424), -INT16_C(  4218) } },
+    { { -INT16_C(   119),  INT16_C( 18414),  INT16_C(   801), -INT16_C( 20387) },
+      {  INT16_C( 19144),  INT16_C( 27410), -INT16_C( 29410),  INT16_C( 18062) },
+      {  INT16_C( 19144),  INT16_C( 27410), -INT16_C( 29410),  INT16_C( 18062) },
+      { -INT16_C( 19959), -INT16_C( 15186),  INT16_C( 18337), -INT16_C( 23651) },
+      {  INT16_C( 18313), -INT16_C( 26642), -INT16_C(  3295),  INT16_C( 28765) },
+      {  INT16_C( 32649),  INT16_C( 18414),  INT16_C(   801),  INT16_C( 12381) } },
+    { { -INT16_C(  4338), -INT16_C(   480),  INT16_C( 28939),  INT16_C(  1348) },
+      {  INT16_C( 13187), -INT16_C( 28028), -INT16_C( 25958), -INT16_C( 16737) },
+      {  INT16_C( 13187), -INT16_C( 28028), -INT16_C( 25958), -INT16_C( 16737) },
+      { -INT16_C(  7986), -INT16_C( 24288), -INT16_C( 22901), -INT16_C( 22588) },
+      {  INT16_C(  7950),  INT16_C(  9760), -INT16_C( 12021), -INT16_C(   700) },
+      { -INT16_C(  4338),  INT16_C( 32288),  INT16_C( 28939), -INT16_C( 31420) } },
+    { { -INT16_C(   691), -INT16_C( 20193),  INT16_C(   766), -INT16_C( 14139) },
+      {  INT16_C(  5180), -INT16_C( 31089), -INT16_C( 24789), -INT16_C(  5626) },
+      {  INT16_C(  5180), -INT16_C( 31089), -INT16_C( 24789), -INT16_C(  5626) },
+      {  INT16_C(  3853), -INT16_C( 23585), -INT16_C( 13570), -INT16_C( 32379) },
+      { -INT16_C(  6835),  INT16_C( 31007),  INT16_C( 23294),  INT16_C( 12485) },
+      {  INT16_C( 32077), -INT16_C( 20193), -INT16_C( 32002),  INT16_C( 18629) } },
+    { {  INT16_C( 11074),  INT16_C( 22729), -INT16_C(  4773),  INT16_C( 21563) },
+      {  INT16_C(  1825), -INT16_C(  3495), -INT16_C( 18739), -INT16_C( 10618) },
+      {  INT16_C(  1825), -INT16_C(  3495), -INT16_C( 18739), -INT16_C( 10618) },
+      { -INT16_C( 14270), -INT16_C( 27063), -INT16_C( 19621), -INT16_C( 24133) },
+      {  INT16_C(  2882), -INT16_C( 14135),  INT16_C( 27995),  INT16_C( 13371) },
+      { -INT16_C( 21694), -INT16_C( 10039), -INT16_C(  4773),  INT16_C( 21563) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+
+    simde_int16x4_t r0 = simde_vsli_n_s16(a, b, 0);
+    simde_int16x4_t r6 = simde_vsli_n_s16(a, b, 6);
+    simde_int16x4_t r11 = simde_vsli_n_s16(a, b, 11);
+    simde_int16x4_t r15 = simde_vsli_n_s16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_i16x4(r0, simde_vld1_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x4(r6, simde_vld1_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x4(r11, simde_vld1_s16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_i16x4(r15, simde_vld1_s16(test_vec[i].r15));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x4_t a = simde_test_arm_neon_random_i16x4();
+    simde_int16x4_t b = simde_test_arm_neon_random_i16x4();
+
+    simde_int16x4_t r0 = simde_vsli_n_s16(a, b, 0);
+    simde_int16x4_t r6 = simde_vsli_n_s16(a, b, 6);
+    simde_int16x4_t r11 = simde_vsli_n_s16(a, b, 11);
+    simde_int16x4_t r15 = simde_vsli_n_s16(a, b, 15);
+
+    simde_test_arm_neon_write_i16x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r15, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t r0[2];
+    int32_t r13[2];
+    int32_t r22[2];
+    int32_t r31[2];
+  } test_vec[] = {
+    { {  INT32_C(  1300154878), -INT32_C(   982786138) },
+      { -INT32_C(  1732585379), -INT32_C(   211041800) },
+      { -INT32_C(  1732585379), -INT32_C(   211041800) },
+      {  INT32_C(  1527491070),  INT32_C(  2017402790) },
+      {  INT32_C(   394185214),  INT32_C(  2116804518) },
+      { -INT32_C(   847328770),  INT32_C(  1164697510) } },
+    { { -INT32_C(  1434087316),  INT32_C(  1350714010) },
+      { -INT32_C(  2146861433), -INT32_C(   868057480) },
+      { -INT32_C(  2146861433), -INT32_C(   868057480) },
+      {  INT32_C(   802222188),  INT32_C(  1338966682) },
+      { -INT32_C(  1580887956), -INT32_C(  1644019046) },
+      { -INT32_C(  1434087316),  INT32_C(  1350714010) } },
+    { {  INT32_C(  1501860676),  INT32_C(  1379262714) },
+      { -INT32_C(   177177835), -INT32_C(   162579236) },
+      { -INT32_C(   177177835), -INT32_C(   162579236) },
+      {  INT32_C(   258126660), -INT32_C(   409239302) },
+      { -INT32_C(   985361596),  INT32_C(   926277882) },
+      { -INT32_C(   645622972),  INT32_C(  1379262714) } },
+    { {  INT32_C(  1910211774), -INT32_C(  1344786466) },
+      {  INT32_C(   897786760), -INT32_C(   461914384) },
+      {  INT32_C(   897786760), -INT32_C(   461914384) },
+      {  INT32_C(  1685128382), -INT32_C(   136441890) },
+      { -INT32_C(   501513026), -INT32_C(  1139265570) },
+      {  INT32_C(  1910211774),  INT32_C(   802697182) } },
+    { {  INT32_C(    34038404),  INT32_C(  1089116652) },
+      { -INT32_C(  1613358929), -INT32_C(  1871545735) },
+      { -INT32_C(  1613358929), -INT32_C(  1871545735) },
+      { -INT32_C(  1021975932),  INT32_C(  1330592236) },
+      {  INT32_C(   734487172), -INT32_C(  1637180948) },
+      { -INT32_C(  2113445244), -INT32_C(  1058366996) } },
+    { {  INT32_C(   937248899), -INT32_C(   624625118) },
+      { -INT32_C(  1976561530),  INT32_C(  2118718567) },
+      { -INT32_C(  1976561530),  INT32_C(  2118718567) },
+      {  INT32_C(    34654339),  INT32_C(   579664418) },
+      {  INT32_C(   563955843),  INT32_C(   432339490) },
+      {  INT32_C(   937248899), -INT32_C(   624625118) } },
+    { {  INT32_C(  1051019142), -INT32_C(   525122146) },
+      {  INT32_C(   479110527),  INT32_C(  1808808516) },
+      {  INT32_C(   479110527),  INT32_C(  1808808516) },
+      { -INT32_C(   726669434),  INT32_C(   122193310) },
+      {  INT32_C(  1608861574), -INT32_C(  1858910818) },
+      { -INT32_C(  1096464506),  INT32_C(  1622361502) } },
+    { {  INT32_C(  2067568896),  INT32_C(   588393709) },
+      { -INT32_C(  1523865568), -INT32_C(   915490493) },
+      { -INT32_C(  1523865568), -INT32_C(   915490493) },
+      {  INT32_C(  1963202816), -INT32_C(   685216531) },
+      {  INT32_C(   138189056),  INT32_C(  1355951341) },
+      {  INT32_C(  2067568896), -INT32_C(  1559089939) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+
+    simde_int32x2_t r0 = simde_vsli_n_s32(a, b, 0);
+    simde_int32x2_t r13 = simde_vsli_n_s32(a, b, 13);
+    simde_int32x2_t r22 = simde_vsli_n_s32(a, b, 22);
+    simde_int32x2_t r31 = simde_vsli_n_s32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_i32x2(r0, simde_vld1_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x2(r13, simde_vld1_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x2(r22, simde_vld1_s32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_i32x2(r31, simde_vld1_s32(test_vec[i].r31));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x2_t a = simde_test_arm_neon_random_i32x2();
+    simde_int32x2_t b = simde_test_arm_neon_random_i32x2();
+
+    simde_int32x2_t r0 = simde_vsli_n_s32(a, b, 0);
+    simde_int32x2_t r13 = simde_vsli_n_s32(a, b, 13);
+    simde_int32x2_t r22 = simde_vsli_n_s32(a, b, 22);
+    simde_int32x2_t r31 = simde_vsli_n_s32(a, b, 31);
+
+    simde_test_arm_neon_write_i32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r31, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[1];
+    int64_t b[1];
+    int64_t r0[1];
+    int64_t r19[1];
+    int64_t r42[1];
+    int64_t r63[1];
+  } test_vec[] = {
+    { {  INT64_C( 4651433528745165905) },
+      { -INT64_C( 1458769935540631924) },
+      { -INT64_C( 1458769935540631924) },
+      {  INT64_C( 4884075344889545809) },
+      {  INT64_C( 5988153795097560145) },
+      {  INT64_C( 4651433528745165905) } },
+    { {  INT64_C( 6582923131718883729) },
+      { -INT64_C( 6650109646407896646) },
+      { -INT64_C( 6650109646407896646) },
+      { -INT64_C( 8929156282094036591) },
+      { -INT64_C( 3042487530855442031) },
+      {  INT64_C( 6582923131718883729) } },
+    { {  INT64_C( 4719610934582773444) },
+      { -INT64_C( 2109334267197680049) },
+      { -INT64_C( 2109334267197680049) },
+      {  INT64_C( 2109682424051599044) },
+      {  INT64_C( 9104375345223239364) },
+      { -INT64_C( 4503761102272002364) } },
+    { {  INT64_C( 3486388542726939046) },
+      {  INT64_C(  944367100845748553) },
+      {  INT64_C(  944367100845748553) },
+      { -INT64_C( 8719114222257364570) },
+      { -INT64_C( 1745945401300934234) },
+      { -INT64_C( 5736983494127836762) } },
+    { {  INT64_C( 6969614737048279333) },
+      { -INT64_C(   19211947311140122) },
+      { -INT64_C(   19211947311140122) },
+      { -INT64_C(  671167617616635611) },
+      {  INT64_C( 5605745329582840101) },
+      {  INT64_C( 6969614737048279333) } },
+    { { -INT64_C( 5543888681801505789) },
+      { -INT64_C( 3700881350391840418) },
+      { -INT64_C( 3700881350391840418) },
+      { -INT64_C( 6906041098042235901) },
+      {  INT64_C( 1947097232375915523) },
+      {  INT64_C( 3679483355053270019) } },
+    { { -INT64_C( 2334752842083463019) },
+      {  INT64_C( 3240289515867904497) },
+      {  INT64_C( 3240289515867904497) },
+      { -INT64_C( 7985772929243148139) },
+      { -INT64_C( 1556056717059944299) },
+      { -INT64_C( 2334752842083463019) } },
+    { { -INT64_C( 6793585289265954999) },
+      {  INT64_C( 6177602174143282687) },
+      {  INT64_C( 6177602174143282687) },
+      {  INT64_C(  257703457740013385) },
+      { -INT64_C(  650772154555842743) },
+      { -INT64_C( 6793585289265954999) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t a = simde_vld1_s64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+
+    simde_int64x1_t r0 = simde_vsli_n_s64(a, b, 0);
+    simde_int64x1_t r19 = simde_vsli_n_s64(a, b, 19);
+    simde_int64x1_t r42 = simde_vsli_n_s64(a, b, 42);
+    simde_int64x1_t r63 = simde_vsli_n_s64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_i64x1(r0, simde_vld1_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x1(r19, simde_vld1_s64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i64x1(r42, simde_vld1_s64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_i64x1(r63, simde_vld1_s64(test_vec[i].r63));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x1_t a = simde_test_arm_neon_random_i64x1();
+    simde_int64x1_t b = simde_test_arm_neon_random_i64x1();
+
+    simde_int64x1_t r0 = simde_vsli_n_s64(a, b, 0);
+    simde_int64x1_t r19 = simde_vsli_n_s64(a, b, 19);
+    simde_int64x1_t r42 = simde_vsli_n_s64(a, b, 42);
+    simde_int64x1_t r63 = simde_vsli_n_s64(a, b, 63);
+
+    simde_test_arm_neon_write_i64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[8];
+    uint8_t b[8];
+    uint8_t r0[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r7[8];
+  } test_vec[] = {
+    { { UINT8_C( 13), UINT8_C( 13), UINT8_C(112), UINT8_C(208), UINT8_C(157), UINT8_C( 43), UINT8_C(194), UINT8_C(114) },
+      { UINT8_C(148), UINT8_C( 57), UINT8_C(179), UINT8_C( 48), UINT8_C(111), UINT8_C(  6), UINT8_C(241), UINT8_C(213) },
+      { UINT8_C(148), UINT8_C( 57), UINT8_C(179), UINT8_C( 48), UINT8_C(111), UINT8_C(  6), UINT8_C(241), UINT8_C(213) },
+      { UINT8_C(165), UINT8_C(205), UINT8_C(152), UINT8_C(128), UINT8_C(125), UINT8_C( 51), UINT8_C(138), UINT8_C(170) },
+      { UINT8_C(141), UINT8_C( 45), UINT8_C(112), UINT8_C( 16), UINT8_C(253), UINT8_C(203), UINT8_C( 34), UINT8_C(178) },
+      { UINT8_C( 13), UINT8_C(141), UINT8_C(240), UINT8_C( 80), UINT8_C(157), UINT8_C( 43), UINT8_C(194), UINT8_C(242) } },
+    { { UINT8_C( 59), UINT8_C( 83), UINT8_C(126), UINT8_C( 46), UINT8_C( 92), UINT8_C(116), UINT8_C(219), UINT8_C(194) },
+      { UINT8_C( 97), UINT8_C(103), UINT8_C( 29), UINT8_C( 90), UINT8_C(187), UINT8_C( 30), UINT8_C(170), UINT8_C(239) },
+      { UINT8_C( 97), UINT8_C(103), UINT8_C( 29), UINT8_C( 90), UINT8_C(187), UINT8_C( 30), UINT8_C(170), UINT8_C(239) },
+      { UINT8_C( 11), UINT8_C( 59), UINT8_C(238), UINT8_C(214), UINT8_C(220), UINT8_C(244), UINT8_C( 83), UINT8_C(122) },
+      { UINT8_C( 59), UINT8_C(243), UINT8_C(190), UINT8_C( 78), UINT8_C(124), UINT8_C(212), UINT8_C( 91), UINT8_C(226) },
+      { UINT8_C(187), UINT8_C(211), UINT8_C(254), UINT8_C( 46), UINT8_C(220), UINT8_C(116), UINT8_C( 91), UINT8_C(194) } },
+    { { UINT8_C( 74), UINT8_C(143), UINT8_C(236), UINT8_C(203), UINT8_C(  1), UINT8_C( 62), UINT8_C( 67), UINT8_C( 48) },
+      { UINT8_C(226), UINT8_C(100), UINT8_C(217), UINT8_C( 67), UINT8_C(139), UINT8_C(186), UINT8_C( 75), UINT8_C( 74) },
+      { UINT8_C(226), UINT8_C(100), UINT8_C(217), UINT8_C( 67), UINT8_C(139), UINT8_C(186), UINT8_C( 75), UINT8_C( 74) },
+      { UINT8_C( 18), UINT8_C( 39), UINT8_C(204), UINT8_C( 27), UINT8_C( 89), UINT8_C(214), UINT8_C( 91), UINT8_C( 80) },
+      { UINT8_C( 74), UINT8_C(143), UINT8_C( 44), UINT8_C(107), UINT8_C( 97), UINT8_C( 94), UINT8_C( 99), UINT8_C( 80) },
+      { UINT8_C( 74), UINT8_C( 15), UINT8_C(236), UINT8_C(203), UINT8_C(129), UINT8_C( 62), UINT8_C(195), UINT8_C( 48) } },
+    { { UINT8_C( 13), UINT8_C(137), UINT8_C(187), UINT8_C( 14), UINT8_C( 30), UINT8_C( 67), UINT8_C(247), UINT8_C(171) },
+      { UINT8_C( 45), UINT8_C(121), UINT8_C( 58), UINT8_C(227), UINT8_C( 12), UINT8_C( 58), UINT8_C( 97), UINT8_C(185) },
+      { UINT8_C( 45), UINT8_C(121), UINT8_C( 58), UINT8_C(227), UINT8_C( 12), UINT8_C( 58), UINT8_C( 97), UINT8_C(185) },
+      { UINT8_C(109), UINT8_C(201), UINT8_C(211), UINT8_C( 30), UINT8_C(102), UINT8_C(211), UINT8_C( 15), UINT8_C(203) },
+      { UINT8_C(173), UINT8_C( 41), UINT8_C( 91), UINT8_C(110), UINT8_C(158), UINT8_C( 67), UINT8_C( 55), UINT8_C( 43) },
+      { UINT8_C(141), UINT8_C(137), UINT8_C( 59), UINT8_C(142), UINT8_C( 30), UINT8_C( 67), UINT8_C(247), UINT8_C(171) } },
+    { { UINT8_C(119), UINT8_C(249), UINT8_C(201), UINT8_C(139), UINT8_C( 43), UINT8_C(112), UINT8_C( 22), UINT8_C(104) },
+      { UINT8_C( 79), UINT8_C( 20), UINT8_C(238), UINT8_C(191), UINT8_C( 74), UINT8_C(131), UINT8_C( 94), UINT8_C(222) },
+      { UINT8_C( 79), UINT8_C( 20), UINT8_C(238), UINT8_C(191), UINT8_C( 74), UINT8_C(131), UINT8_C( 94), UINT8_C(222) },
+      { UINT8_C(127), UINT8_C(161), UINT8_C(113), UINT8_C(251), UINT8_C( 83), UINT8_C( 24), UINT8_C(246), UINT8_C(240) },
+      { UINT8_C(247), UINT8_C(153), UINT8_C(201), UINT8_C(235), UINT8_C( 75), UINT8_C(112), UINT8_C(214), UINT8_C(200) },
+      { UINT8_C(247), UINT8_C(121), UINT8_C( 73), UINT8_C(139), UINT8_C( 43), UINT8_C(240), UINT8_C( 22), UINT8_C(104) } },
+    { { UINT8_C(244), UINT8_C( 76), UINT8_C(213), UINT8_C(131), UINT8_C(110), UINT8_C( 93), UINT8_C(190), UINT8_C( 32) },
+      { UINT8_C(100), UINT8_C( 59), UINT8_C(154), UINT8_C(212), UINT8_C(182), UINT8_C(175), UINT8_C( 70), UINT8_C(131) },
+      { UINT8_C(100), UINT8_C( 59), UINT8_C(154), UINT8_C(212), UINT8_C(182), UINT8_C(175), UINT8_C( 70), UINT8_C(131) },
+      { UINT8_C( 36), UINT8_C(220), UINT8_C(213), UINT8_C(163), UINT8_C(182), UINT8_C(125), UINT8_C( 54), UINT8_C( 24) },
+      { UINT8_C(148), UINT8_C(108), UINT8_C( 85), UINT8_C(131), UINT8_C(206), UINT8_C(253), UINT8_C(222), UINT8_C( 96) },
+      { UINT8_C(116), UINT8_C(204), UINT8_C( 85), UINT8_C(  3), UINT8_C(110), UINT8_C(221), UINT8_C( 62), UINT8_C(160) } },
+    { { UINT8_C( 14), UINT8_C( 92), UINT8_C(182), UINT8_C(186), UINT8_C(181), UINT8_C( 41), UINT8_C(223), UINT8_C(221) },
+      { UINT8_C( 20), UINT8_C( 65), UINT8_C(131), UINT8_C(123), UINT8_C(131), UINT8_C(150), UINT8_C( 61), UINT8_C(100) },
+      { UINT8_C( 20), UINT8_C( 65), UINT8_C(131), UINT8_C(123), UINT8_C(131), UINT8_C(150), UINT8_C( 61), UINT8_C(100) },
+      { UINT8_C(166), UINT8_C( 12), UINT8_C( 30), UINT8_C(218), UINT8_C( 29), UINT8_C(177), UINT8_C(239), UINT8_C( 37) },
+      { UINT8_C(142), UINT8_C( 60), UINT8_C(118), UINT8_C(122), UINT8_C(117), UINT8_C(201), UINT8_C(191), UINT8_C(157) },
+      { UINT8_C( 14), UINT8_C(220), UINT8_C(182), UINT8_C(186), UINT8_C(181), UINT8_C( 41), UINT8_C(223), UINT8_C( 93) } },
+    { { UINT8_C(109), UINT8_C( 21), UINT8_C(152), UINT8_C(248), UINT8_C(235), UINT8_C(  6), UINT8_C( 27), UINT8_C( 47) },
+      { UINT8_C( 42), UINT8_C( 21), UINT8_C(247), UINT8_C(146), UINT8_C(130), UINT8_C( 15), UINT8_C(112), UINT8_C(112) },
+      { UINT8_C( 42), UINT8_C( 21), UINT8_C(247), UINT8_C(146), UINT8_C(130), UINT8_C( 15), UINT8_C(112), UINT8_C(112) },
+      { UINT8_C( 85), UINT8_C(173), UINT8_C(184), UINT8_C(144), UINT8_C( 19), UINT8_C(126), UINT8_C(131), UINT8_C(135) },
+      { UINT8_C( 77), UINT8_C(181), UINT8_C(248), UINT8_C( 88), UINT8_C( 75), UINT8_C(230), UINT8_C( 27), UINT8_C( 15) },
+      { UINT8_C(109), UINT8_C(149), UINT8_C(152), UINT8_C(120), UINT8_C(107), UINT8_C(134), UINT8_C( 27), UINT8_C( 47) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+
+    simde_uint8x8_t r0 = simde_vsli_n_u8(a, b, 0);
+    simde_uint8x8_t r3 = simde_vsli_n_u8(a, b, 3);
+    simde_uint8x8_t r5 = simde_vsli_n_u8(a, b, 5);
+    simde_uint8x8_t r7 = simde_vsli_n_u8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_u8x8(r0, simde_vld1_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r7, simde_vld1_u8(test_vec[i].r7));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x8_t a = simde_test_arm_neon_random_u8x8();
+    simde_uint8x8_t b = simde_test_arm_neon_random_u8x8();
+
+    simde_uint8x8_t r0 = simde_vsli_n_u8(a, b, 0);
+    simde_uint8x8_t r3 = simde_vsli_n_u8(a, b, 3);
+    simde_uint8x8_t r5 = simde_vsli_n_u8(a, b, 5);
+    simde_uint8x8_t r7 = simde_vsli_n_u8(a, b, 7);
+
+    simde_test_arm_neon_write_u8x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r7, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[4];
+    uint16_t b[4];
+    uint16_t r0[4];
+    uint16_t r6[4];
+    uint16_t r11[4];
+    uint16_t r15[4];
+  } test_vec[] = {
+    { { UINT16_C(54719), UINT16_C(51733), UINT16_C(62965), UINT16_C(64402) },
+      { UINT16_C(23357), UINT16_C( 5668), UINT16_C(64314), UINT16_C(22530) },
+      { UINT16_C(23357), UINT16_C( 5668), UINT16_C(64314), UINT16_C(22530) },
+      { UINT16_C(53119), UINT16_C(35093), UINT16_C(52917), UINT16_C(  146) },
+      { UINT16_C(60863), UINT16_C( 8725), UINT16_C(54773), UINT16_C( 5010) },
+      { UINT16_C(54719), UINT16_C(18965), UINT16_C(30197), UINT16_C(31634) } },
+    { { UINT16_C(37519), UINT16_C(29680), UINT16_C(28295), UINT16_C(15193) },
+      { UINT16_C(45747), UINT16_C(36594), UINT16_C(35126), UINT16_C(27212) },
+      { UINT16_C(45747), UINT16_C(36594), UINT16_C(35126), UINT16_C(27212) },
+      { UINT16_C(44239), UINT16_C(48304), UINT16_C(19847), UINT16_C(37657) },
+      { UINT16_C(39567), UINT16_C(37872), UINT16_C(46727), UINT16_C(25433) },
+      { UINT16_C(37519), UINT16_C(29680), UINT16_C(28295), UINT16_C(15193) } },
+    { { UINT16_C(45335), UINT16_C(62089), UINT16_C( 5960), UINT16_C(57610) },
+      { UINT16_C(52746), UINT16_C(56050), UINT16_C(15019), UINT16_C(29497) },
+      { UINT16_C(52746), UINT16_C(56050), UINT16_C(15019), UINT16_C(29497) },
+      { UINT16_C(33431), UINT16_C(48265), UINT16_C(43720), UINT16_C(52810) },
+      { UINT16_C(20759), UINT16_C(37513), UINT16_C(24392), UINT16_C(51466) },
+      { UINT16_C(12567), UINT16_C(29321), UINT16_C(38728), UINT16_C(57610) } },
+    { { UINT16_C(19325), UINT16_C(54960), UINT16_C(40153), UINT16_C(46551) },
+      { UINT16_C(39727), UINT16_C(57131), UINT16_C(36506), UINT16_C(50132) },
+      { UINT16_C(39727), UINT16_C(57131), UINT16_C(36506), UINT16_C(50132) },
+      { UINT16_C(52221), UINT16_C(51952), UINT16_C(42649), UINT16_C(62743) },
+      { UINT16_C(31613), UINT16_C(24240), UINT16_C(54489), UINT16_C(42455) },
+      { UINT16_C(52093), UINT16_C(54960), UINT16_C( 7385), UINT16_C(13783) } },
+    { { UINT16_C(12736), UINT16_C( 8068), UINT16_C(19657), UINT16_C(45213) },
+      { UINT16_C(41350), UINT16_C(63526), UINT16_C(28192), UINT16_C(43419) },
+      { UINT16_C(41350), UINT16_C(63526), UINT16_C(28192), UINT16_C(43419) },
+      { UINT16_C(24960), UINT16_C( 2436), UINT16_C(34825), UINT16_C(26333) },
+      { UINT16_C(12736), UINT16_C(14212), UINT16_C( 1225), UINT16_C(55453) },
+      { UINT16_C(12736), UINT16_C( 8068), UINT16_C(19657), UINT16_C(45213) } },
+    { { UINT16_C( 5836), UINT16_C(23389), UINT16_C(18514), UINT16_C(63857) },
+      { UINT16_C(33012), UINT16_C(38625), UINT16_C(37531), UINT16_C(33968) },
+      { UINT16_C(33012), UINT16_C(38625), UINT16_C(37531), UINT16_C(33968) },
+      { UINT16_C(15628), UINT16_C(47197), UINT16_C(42706), UINT16_C(11313) },
+      { UINT16_C(42700), UINT16_C( 2909), UINT16_C(55378), UINT16_C(33137) },
+      { UINT16_C( 5836), UINT16_C(56157), UINT16_C(51282), UINT16_C(31089) } },
+    { { UINT16_C(64241), UINT16_C( 5348), UINT16_C(38642), UINT16_C( 5495) },
+      { UINT16_C(57853), UINT16_C(10431), UINT16_C(57359), UINT16_C(58214) },
+      { UINT16_C(57853), UINT16_C(10431), UINT16_C(57359), UINT16_C(58214) },
+      { UINT16_C(32625), UINT16_C(12260), UINT16_C( 1010), UINT16_C(55735) },
+      { UINT16_C(60145), UINT16_C(64740), UINT16_C(32498), UINT16_C(13687) },
+      { UINT16_C(64241), UINT16_C(38116), UINT16_C(38642), UINT16_C( 5495) } },
+    { { UINT16_C( 8895), UINT16_C(31916), UINT16_C( 2033), UINT16_C(31820) },
+      { UINT16_C(57977), UINT16_C(24785), UINT16_C(27586), UINT16_C(55507) },
+      { UINT16_C(57977), UINT16_C(24785), UINT16_C(27586), UINT16_C(55507) },
+      { UINT16_C(40575), UINT16_C(13420), UINT16_C(61617), UINT16_C(13516) },
+      { UINT16_C(51903), UINT16_C(36012), UINT16_C( 6129), UINT16_C(40012) },
+      { UINT16_C(41663), UINT16_C(64684), UINT16_C( 2033), UINT16_C(64588) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t a = simde_vld1_u16(test_vec[i].a);
+    simde_uint16x4_t b = simde_vld1_u16(test_vec[i].b);
+
+    simde_uint16x4_t r0 = simde_vsli_n_u16(a, b, 0);
+    simde_uint16x4_t r6 = simde_vsli_n_u16(a, b, 6);
+    simde_uint16x4_t r11 = simde_vsli_n_u16(a, b, 11);
+    simde_uint16x4_t r15 = simde_vsli_n_u16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_u16x4(r0, simde_vld1_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r11, simde_vld1_u16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_u16x4(r15, simde_vld1_u16(test_vec[i].r15));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x4_t a = simde_test_arm_neon_random_u16x4();
+    simde_uint16x4_t b = simde_test_arm_neon_random_u16x4();
+
+    simde_uint16x4_t r0 = simde_vsli_n_u16(a, b, 0);
+    simde_uint16x4_t r6 = simde_vsli_n_u16(a, b, 6);
+    simde_uint16x4_t r11 = simde_vsli_n_u16(a, b, 11);
+    simde_uint16x4_t r15 = simde_vsli_n_u16(a, b, 15);
+
+    simde_test_arm_neon_write_u16x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r15, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[2];
+    uint32_t b[2];
+    uint32_t r0[2];
+    uint32_t r13[2];
+    uint32_t r22[2];
+    uint32_t r31[2];
+  } test_vec[] = {
+    { { UINT32_C(2759791621), UINT32_C(3977134583) },
+      { UINT32_C(4242766910), UINT32_C(3031057262) },
+      { UINT32_C(4242766910), UINT32_C(3031057262) },
+      { UINT32_C(1871172613), UINT32_C(1215152631) },
+      { UINT32_C( 264180741), UINT32_C(3683533303) },
+      { UINT32_C( 612307973), UINT32_C(1829650935) } },
+    { { UINT32_C(  54044987), UINT32_C(3478237246) },
+      { UINT32_C(1911296491), UINT32_C( 122275208) },
+      { UINT32_C(1911296491), UINT32_C( 122275208) },
+      { UINT32_C(2185062715), UINT32_C( 951128126) },
+      { UINT32_C(2063116603), UINT32_C(1645326398) },
+      { UINT32_C(2201528635), UINT32_C(1330753598) } },
+    { { UINT32_C(3175029165), UINT32_C(3912611440) },
+      { UINT32_C(1578783944), UINT32_C(2900677402) },
+      { UINT32_C(1578783944), UINT32_C(2900677402) },
+      { UINT32_C(1251547565), UINT32_C(2590201456) },
+      { UINT32_C( 842996141), UINT32_C(3333797488) },
+      { UINT32_C(1027545517), UINT32_C(1765127792) } },
+    { { UINT32_C(3090004635), UINT32_C(4260657543) },
+      { UINT32_C(1153034833), UINT32_C(1731350328) },
+      { UINT32_C(1153034833), UINT32_C(1731350328) },
+      { UINT32_C(1028274843), UINT32_C(1239882119) },
+      { UINT32_C(2490219163), UINT32_C(3459545479) },
+      { UINT32_C(3090004635), UINT32_C(2113173895) } },
+    { { UINT32_C(3664114873), UINT32_C( 539994087) },
+      { UINT32_C(2753934979), UINT32_C(4142246348) },
+      { UINT32_C(2753934979), UINT32_C(4142246348) },
+      { UINT32_C(3067114681), UINT32_C(3040446439) },
+      { UINT32_C(2699424953), UINT32_C(1932503015) },
+      { UINT32_C(3664114873), UINT32_C( 539994087) } },
+    { { UINT32_C( 407484650), UINT32_C(1199916885) },
+      { UINT32_C(2602056450), UINT32_C( 982764206) },
+      { UINT32_C(2602056450), UINT32_C( 982764206) },
+      { UINT32_C( 123754730), UINT32_C(2035664725) },
+      { UINT32_C(3230251242), UINT32_C(2877638485) },
+      { UINT32_C( 407484650), UINT32_C(1199916885) } },
+    { { UINT32_C(1338184387), UINT32_C(3621431326) },
+      { UINT32_C( 838706543), UINT32_C(3593046779) },
+      { UINT32_C( 838706543), UINT32_C(3593046779) },
+      { UINT32_C(3031298755), UINT32_C( 828336158) },
+      { UINT32_C(1539510979), UINT32_C(3202000926) },
+      { UINT32_C(3485668035), UINT32_C(3621431326) } },
+    { { UINT32_C(3990015355), UINT32_C(3477084051) },
+      { UINT32_C( 625939645), UINT32_C(3588517556) },
+      { UINT32_C( 625939645), UINT32_C(3588517556) },
+      { UINT32_C(3801591163), UINT32_C(2379650963) },
+      { UINT32_C( 793955707), UINT32_C(2902464403) },
+      { UINT32_C(3990015355), UINT32_C(1329600403) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t b = simde_vld1_u32(test_vec[i].b);
+
+    simde_uint32x2_t r0 = simde_vsli_n_u32(a, b, 0);
+    simde_uint32x2_t r13 = simde_vsli_n_u32(a, b, 13);
+    simde_uint32x2_t r22 = simde_vsli_n_u32(a, b, 22);
+    simde_uint32x2_t r31 = simde_vsli_n_u32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_u32x2(r0, simde_vld1_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r22, simde_vld1_u32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_u32x2(r31, simde_vld1_u32(test_vec[i].r31));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x2_t a = simde_test_arm_neon_random_u32x2();
+    simde_uint32x2_t b = simde_test_arm_neon_random_u32x2();
+
+    simde_uint32x2_t r0 = simde_vsli_n_u32(a, b, 0);
+    simde_uint32x2_t r13 = simde_vsli_n_u32(a, b, 13);
+    simde_uint32x2_t r22 = simde_vsli_n_u32(a, b, 22);
+    simde_uint32x2_t r31 = simde_vsli_n_u32(a, b, 31);
+
+    simde_test_arm_neon_write_u32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r31, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsli_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[1];
+    uint64_t b[1];
+    uint64_t r0[1];
+    uint64_t r19[1];
+    uint64_t r42[1];
+    uint64_t r63[1];
+  } test_vec[] = {
+    { { UINT64_C( 2686710162991906812) },
+      { UINT64_C(11655781007948052412) },
+      { UINT64_C(11655781007948052412) },
+      { UINT64_C( 4076588789372321788) },
+      { UINT64_C(17572747402800037884) },
+      { UINT64_C( 2686710162991906812) } },
+    { { UINT64_C(11531587188981588693) },
+      { UINT64_C(15140253474112997599) },
+      { UINT64_C(15140253474112997599) },
+      { UINT64_C(16324333724419842773) },
+      { UINT64_C( 9521591972476838613) },
+      { UINT64_C(11531587188981588693) } },
+    { { UINT64_C( 2571802237902879674) },
+      { UINT64_C( 7170153659729279296) },
+      { UINT64_C( 7170153659729279296) },
+      { UINT64_C(  440659022278917050) },
+      { UINT64_C( 9648118336780860346) },
+      { UINT64_C( 2571802237902879674) } },
+    { { UINT64_C( 4273751953641762199) },
+      { UINT64_C( 5411468713062206582) },
+      { UINT64_C( 5411468713062206582) },
+      { UINT64_C( 3529865207997459863) },
+      { UINT64_C(15722588301673295255) },
+      { UINT64_C( 4273751953641762199) } },
+    { { UINT64_C(  841803353340620418) },
+      { UINT64_C(14787940845235153059) },
+      { UINT64_C(14787940845235153059) },
+      { UINT64_C(10289174670802005634) },
+      { UINT64_C(17051349127781789314) },
+      { UINT64_C(10065175390195396226) } },
+    { { UINT64_C( 9553439535183782588) },
+      { UINT64_C( 2302970684319343393) },
+      { UINT64_C( 2302970684319343393) },
+      { UINT64_C( 6707539834917708476) },
+      { UINT64_C(17909837857444160188) },
+      { UINT64_C( 9553439535183782588) } },
+    { { UINT64_C(  153892842597145854) },
+      { UINT64_C(17550304550915511898) },
+      { UINT64_C(17550304550915511898) },
+      { UINT64_C(12107727404170108158) },
+      { UINT64_C(17751334552593915134) },
+      { UINT64_C(  153892842597145854) } },
+    { { UINT64_C( 8686856339554547928) },
+      { UINT64_C(14999578209957837332) },
+      { UINT64_C(14999578209957837332) },
+      { UINT64_C(12054247034541553880) },
+      { UINT64_C(16710696374877796568) },
+      { UINT64_C( 8686856339554547928) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t a = simde_vld1_u64(test_vec[i].a);
+    simde_uint64x1_t b = simde_vld1_u64(test_vec[i].b);
+
+    simde_uint64x1_t r0 = simde_vsli_n_u64(a, b, 0);
+    simde_uint64x1_t r19 = simde_vsli_n_u64(a, b, 19);
+    simde_uint64x1_t r42 = simde_vsli_n_u64(a, b, 42);
+    simde_uint64x1_t r63 = simde_vsli_n_u64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_u64x1(r0, simde_vld1_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x1(r19, simde_vld1_u64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u64x1(r42, simde_vld1_u64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_u64x1(r63, simde_vld1_u64(test_vec[i].r63));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x1_t a = simde_test_arm_neon_random_u64x1();
+    simde_uint64x1_t b = simde_test_arm_neon_random_u64x1();
+
+    simde_uint64x1_t r0 = simde_vsli_n_u64(a, b, 0);
+    simde_uint64x1_t r19 = simde_vsli_n_u64(a, b, 19);
+    simde_uint64x1_t r42 = simde_vsli_n_u64(a, b, 42);
+    simde_uint64x1_t r63 = simde_vsli_n_u64(a, b, 63);
+
+    simde_test_arm_neon_write_u64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r0[16];
+    int8_t r3[16];
+    int8_t r5[16];
+    int8_t r7[16];
+  } test_vec[] = {
+    { { -INT8_C(   7), -INT8_C(   2),  INT8_C(  88), -INT8_C( 126),      INT8_MAX,  INT8_C(  34),  INT8_C(  79),  INT8_C(  93),
+        -INT8_C( 105), -INT8_C(  33), -INT8_C(  76), -INT8_C(  48),  INT8_C(  71),  INT8_C(  69),  INT8_C(  64), -INT8_C(  52) },
+      { -INT8_C( 102), -INT8_C( 102), -INT8_C( 127), -INT8_C(  60), -INT8_C( 110),  INT8_C(  73),  INT8_C(  29),  INT8_C( 107),
+        -INT8_C(  17), -INT8_C(   2), -INT8_C(  28),  INT8_C(  33),  INT8_C(  32), -INT8_C(  66),  INT8_C(  74),  INT8_C( 107) },
+      { -INT8_C( 102), -INT8_C( 102), -INT8_C( 127), -INT8_C(  60), -INT8_C( 110),  INT8_C(  73),  INT8_C(  29),  INT8_C( 107),
+        -INT8_C(  17), -INT8_C(   2), -INT8_C(  28),  INT8_C(  33),  INT8_C(  32), -INT8_C(  66),  INT8_C(  74),  INT8_C( 107) },
+      { -INT8_C(  47), -INT8_C(  42),  INT8_C(   8),  INT8_C(  34), -INT8_C( 105),  INT8_C(  74), -INT8_C(  17),  INT8_C(  93),
+             INT8_MAX, -INT8_C(   9),  INT8_C(  36),  INT8_C(   8),  INT8_C(   7), -INT8_C(  11),  INT8_C(  80),  INT8_C(  92) },
+      {  INT8_C(  89),  INT8_C(  94),  INT8_C(  56), -INT8_C( 126),  INT8_C(  95),  INT8_C(  34), -INT8_C(  81),  INT8_C( 125),
+        -INT8_C(   9), -INT8_C(  33), -INT8_C( 108),  INT8_C(  48),  INT8_C(   7), -INT8_C(  59),  INT8_C(  64),  INT8_C( 108) },
+      {  INT8_C( 121),  INT8_C( 126), -INT8_C(  40),  INT8_C(   2),      INT8_MAX, -INT8_C(  94), -INT8_C(  49), -INT8_C(  35),
+        -INT8_C( 105),  INT8_C(  95),  INT8_C(  52), -INT8_C(  48),  INT8_C(  71),  INT8_C(  69),  INT8_C(  64), -INT8_C(  52) } },
+    { {  INT8_C(  10),  INT8_C( 102),  INT8_C(  17),  INT8_C(  68),  INT8_C(   5),  INT8_C(  52),  INT8_C(  48),  INT8_C(  36),
+        -INT8_C( 104), -INT8_C( 107), -INT8_C(  17),  INT8_C(  40), -INT8_C( 125), -INT8_C(  26),  INT8_C(  37), -INT8_C(   4) },
+      { -INT8_C(  40), -INT8_C(  59),  INT8_C(  34),  INT8_C( 104), -INT8_C(  96), -INT8_C(  38),  INT8_C( 107), -INT8_C(  44),
+         INT8_C( 115),  INT8_C(  20),  INT8_C(  32),  INT8_C( 104),  INT8_C(  30),  INT8_C(  33), -INT8_C(  89),  INT8_C(  64) },
+      { -INT8_C(  40), -INT8_C(  59),  INT8_C(  34),  INT8_C( 104), -INT8_C(  96), -INT8_C(  38),  INT8_C( 107), -INT8_C(  44),
+         INT8_C( 115),  INT8_C(  20),  INT8_C(  32),  INT8_C( 104),  INT8_C(  30),  INT8_C(  33), -INT8_C(  89),  INT8_C(  64) },
+      { -INT8_C(  62),  INT8_C(  46),  INT8_C(  17),  INT8_C(  68),  INT8_C(   5), -INT8_C(  44),  INT8_C(  88), -INT8_C(  92),
+        -INT8_C( 104), -INT8_C(  91),  INT8_C(   7),  INT8_C(  64), -INT8_C(  13),  INT8_C(  14),  INT8_C(  61),  INT8_C(   4) },
+      {  INT8_C(  10), -INT8_C(  90),  INT8_C(  81),  INT8_C(   4),  INT8_C(   5),  INT8_C(  84),  INT8_C( 112), -INT8_C( 124),
+         INT8_C( 120), -INT8_C( 107),  INT8_C(  15),  INT8_C(   8), -INT8_C(  61),  INT8_C(  38), -INT8_C(  27),  INT8_C(  28) },
+      {  INT8_C(  10), -INT8_C(  26),  INT8_C(  17),  INT8_C(  68),  INT8_C(   5),  INT8_C(  52), -INT8_C(  80),  INT8_C(  36),
+        -INT8_C( 104),  INT8_C(  21),  INT8_C( 111),  INT8_C(  40),  INT8_C(   3), -INT8_C(  26), -INT8_C(  91),  INT8_C( 124) } },
+    { { -INT8_C(  83), -INT8_C(  26),  INT8_C( 116), -INT8_C(   4),  INT8_C(  88),  INT8_C(  44), -INT8_C(  65),  INT8_C(  38),
+         INT8_C( 112),  INT8_C(  45), -INT8_C(  36), -INT8_C(  52), -INT8_C(  95), -INT8_C(  95),  INT8_C(  12), -INT8_C(   3) },
+      {  INT8_C(  35), -INT8_C(  46),  INT8_C(  85), -INT8_C(  20),  INT8_C(   2),  INT8_C(  20), -INT8_C(  84),  INT8_C( 113),
+        -INT8_C(  33),  INT8_C(  53), -INT8_C(  44), -INT8_C(  87), -INT8_C( 116), -INT8_C( 115), -INT8_C( 109), -INT8_C(   1) },
+      {  INT8_C(  35), -INT8_C(  46),  INT8_C(  85), -INT8_C(  20),  INT8_C(   2),  INT8_C(  20), -INT8_C(  84),  INT8_C( 113),
+        -INT8_C(  33),  INT8_C(  53), -INT8_C(  44), -INT8_C(  87), -INT8_C( 116), -INT8_C( 115), -INT8_C( 109), -INT8_C(   1) },
+      {  INT8_C(  29), -INT8_C( 106), -INT8_C(  84),  INT8_C( 100),  INT8_C(  16), -INT8_C(  92),  INT8_C( 103), -INT8_C( 114),
+        -INT8_C(   8), -INT8_C(  83), -INT8_C(  92),  INT8_C(  76),  INT8_C(  97),  INT8_C( 105), -INT8_C( 100), -INT8_C(   3) },
+      {  INT8_C( 109),  INT8_C(  70), -INT8_C(  76), -INT8_C( 100),  INT8_C(  88), -INT8_C( 116), -INT8_C(  97),  INT8_C(  38),
+        -INT8_C(  16), -INT8_C(  83), -INT8_C( 100),  INT8_C(  44), -INT8_C( 127), -INT8_C(  95),  INT8_C( 108), -INT8_C(   3) },
+      { -INT8_C(  83),  INT8_C( 102), -INT8_C(  12),  INT8_C( 124),  INT8_C(  88),  INT8_C(  44),  INT8_C(  63), -INT8_C(  90),
+        -INT8_C(  16), -INT8_C(  83),  INT8_C(  92), -INT8_C(  52),  INT8_C(  33), -INT8_C(  95), -INT8_C( 116), -INT8_C(   3) } },
+    { { -INT8_C(  25),      INT8_MIN,  INT8_C(  88), -INT8_C(  22), -INT8_C(  19), -INT8_C(  12),  INT8_C(  22), -INT8_C(  69),
+         INT8_C(  11),  INT8_C( 102), -INT8_C(  68),  INT8_C( 113), -INT8_C(  47), -INT8_C(  32),  INT8_C(  40), -INT8_C(  76) },
+      {  INT8_C(  89), -INT8_C( 109), -INT8_C(  40),  INT8_C( 102), -INT8_C(  16), -INT8_C( 121), -INT8_C(  22), -INT8_C(  61),
+        -INT8_C( 122), -INT8_C(  59), -INT8_C( 103), -INT8_C(  59), -INT8_C(  19), -INT8_C(  44), -INT8_C(  13),  INT8_C(  96) },
+      {  INT8_C(  89), -INT8_C( 109), -INT8_C(  40),  INT8_C( 102), -INT8_C(  16), -INT8_C( 121), -INT8_C(  22), -INT8_C(  61),
+        -INT8_C( 122), -INT8_C(  59), -INT8_C( 103), -INT8_C(  59), -INT8_C(  19), -INT8_C(  44), -INT8_C(  13),  INT8_C(  96) },
+      { -INT8_C(  49), -INT8_C( 104), -INT8_C(  64),  INT8_C(  50), -INT8_C( 123),  INT8_C(  60),  INT8_C(  86),  INT8_C(  27),
+         INT8_C(  51),  INT8_C(  46), -INT8_C(  52),  INT8_C(  41),  INT8_C( 105), -INT8_C(  96), -INT8_C( 104),  INT8_C(   4) },
+      {  INT8_C(  39),  INT8_C(  96),  INT8_C(  24), -INT8_C(  54),  INT8_C(  13), -INT8_C(  12),  INT8_C(  86),  INT8_C( 123),
+        -INT8_C(  53), -INT8_C(  90),  INT8_C(  60), -INT8_C(  79), -INT8_C(  79),      INT8_MIN,  INT8_C( 104),  INT8_C(  20) },
+      { -INT8_C(  25),      INT8_MIN,  INT8_C(  88),  INT8_C( 106),  INT8_C( 109), -INT8_C(  12),  INT8_C(  22), -INT8_C(  69),
+         INT8_C(  11), -INT8_C(  26), -INT8_C(  68), -INT8_C(  15), -INT8_C(  47),  INT8_C(  96), -INT8_C(  88),  INT8_C(  52) } },
+    { {  INT8_C(  48),  INT8_C(  85), -INT8_C(  31), -INT8_C(  21), -INT8_C(  18), -INT8_C(  19), -INT8_C( 108), -INT8_C(  46),
+         INT8_C(  63), -INT8_C(  58),  INT8_C( 109), -INT8_C(  49), -INT8_C(  65), -INT8_C(  66), -INT8_C(  53),  INT8_C(  71) },
+      {  INT8_C( 113),  INT8_C(  75),  INT8_C(  15), -INT8_C(  66),  INT8_C(  31),  INT8_C( 121),  INT8_C(  57), -INT8_C( 127),
+         INT8_C(  78), -INT8_C( 122),  INT8_C(  91), -INT8_C(  71),  INT8_C( 109), -INT8_C(  42),  INT8_C( 104), -INT8_C(  13) },
+      {  INT8_C( 113),  INT8_C(  75),  INT8_C(  15), -INT8_C(  66),  INT8_C(  31),  INT8_C( 121),  INT8_C(  57), -INT8_C( 127),
+         INT8_C(  78), -INT8_C( 122),  INT8_C(  91), -INT8_C(  71),  INT8_C( 109), -INT8_C(  42),  INT8_C( 104), -INT8_C(  13) },
+      { -INT8_C( 120),  INT8_C(  93),  INT8_C( 121), -INT8_C(  13), -INT8_C(   2), -INT8_C(  51), -INT8_C(  52),  INT8_C(  10),
+         INT8_C( 119),  INT8_C(  54), -INT8_C(  35), -INT8_C(  49),  INT8_C( 111), -INT8_C(  74),  INT8_C(  67), -INT8_C(  97) },
+      {  INT8_C(  48),  INT8_C( 117), -INT8_C(  31), -INT8_C(  53), -INT8_C(  18),  INT8_C(  45),  INT8_C(  52),  INT8_C(  50),
+        -INT8_C(  33), -INT8_C(  58),  INT8_C( 109),  INT8_C(  47), -INT8_C(  65), -INT8_C(  34),  INT8_C(  11),  INT8_C( 103) },
+      { -INT8_C(  80), -INT8_C(  43), -INT8_C(  31),  INT8_C( 107), -INT8_C(  18), -INT8_C(  19), -INT8_C( 108), -INT8_C(  46),
+         INT8_C(  63),  INT8_C(  70), -INT8_C(  19), -INT8_C(  49), -INT8_C(  65),  INT8_C(  62),  INT8_C(  75), -INT8_C(  57) } },
+    { {  INT8_C(  80), -INT8_C(  80),  INT8_C( 125), -INT8_C(  40),  INT8_C(   2),  INT8_C(  96),  INT8_C(  85),  INT8_C(  56),
+        -INT8_C(  59), -INT8_C( 117), -INT8_C(  43), -INT8_C(  33),  INT8_C(  14),  INT8_C(  26), -INT8_C( 122),  INT8_C(  83) },
+      { -INT8_C(  89),  INT8_C(  96),  INT8_C(  22), -INT8_C(  79),  INT8_C( 107), -INT8_C( 123), -INT8_C( 106),  INT8_C(  15),
+         INT8_C(  59), -INT8_C(  87),  INT8_C(  64), -INT8_C( 122),  INT8_C(   6),  INT8_C( 119),  INT8_C( 125), -INT8_C(  83) },
+      { -INT8_C(  89),  INT8_C(  96),  INT8_C(  22), -INT8_C(  79),  INT8_C( 107), -INT8_C( 123), -INT8_C( 106),  INT8_C(  15),
+         INT8_C(  59), -INT8_C(  87),  INT8_C(  64), -INT8_C( 122),  INT8_C(   6),  INT8_C( 119),  INT8_C( 125), -INT8_C(  83) },
+      {  INT8_C(  56),  INT8_C(   0), -INT8_C(  75), -INT8_C( 120),  INT8_C(  90),  INT8_C(  40), -INT8_C(  75),  INT8_C( 120),
+        -INT8_C(  35),  INT8_C(  75),  INT8_C(   5),  INT8_C(  55),  INT8_C(  54), -INT8_C(  70), -INT8_C(  18),  INT8_C( 107) },
+      { -INT8_C(  16),  INT8_C(  16), -INT8_C(  35),  INT8_C(  56),  INT8_C(  98), -INT8_C(  96), -INT8_C(  43), -INT8_C(   8),
+         INT8_C( 101),  INT8_C(  43),  INT8_C(  21), -INT8_C(  33), -INT8_C(  50), -INT8_C(   6), -INT8_C(  90), -INT8_C(  77) },
+      { -INT8_C(  48),  INT8_C(  48),  INT8_C( 125), -INT8_C(  40), -INT8_C( 126), -INT8_C(  32),  INT8_C(  85), -INT8_C(  72),
+        -INT8_C(  59), -INT8_C( 117),  INT8_C(  85),  INT8_C(  95),  INT8_C(  14), -INT8_C( 102), -INT8_C( 122), -INT8_C(  45) } },
+    { { -INT8_C( 119),  INT8_C(  21),  INT8_C(  58), -INT8_C(  47), -INT8_C( 111), -INT8_C(  77),  INT8_C( 106),  INT8_C(  13),
+         INT8_C(  21),  INT8_C(  66), -INT8_C( 102), -INT8_C(  36), -INT8_C(  32), -INT8_C(   6), -INT8_C(  89),  INT8_C(  62) },
+      { -INT8_C(  20),  INT8_C(  11), -INT8_C(  91),  INT8_C( 117),  INT8_C(  35), -INT8_C(  69), -INT8_C(  19),  INT8_C( 119),
+         INT8_C(  63), -INT8_C(  61),  INT8_C(  59),  INT8_C(  87),  INT8_C(  51),  INT8_C(   1), -INT8_C( 111),  INT8_C(  40) },
+      { -INT8_C(  20),  INT8_C(  11), -INT8_C(  91),  INT8_C( 117),  INT8_C(  35), -INT8_C(  69), -INT8_C(  19),  INT8_C( 119),
+         INT8_C(  63), -INT8_C(  61),  INT8_C(  59),  INT8_C(  87),  INT8_C(  51),  INT8_C(   1), -INT8_C( 111),  INT8_C(  40) },
+      {  INT8_C(  97),  INT8_C(  93),  INT8_C(  42), -INT8_C(  87),  INT8_C(  25), -INT8_C(  37),  INT8_C( 106), -INT8_C(  67),
+        -INT8_C(   3),  INT8_C(  26), -INT8_C(  38), -INT8_C(  68), -INT8_C( 104),  INT8_C(  10), -INT8_C( 113),  INT8_C(  70) },
+      { -INT8_C( 119),  INT8_C( 117), -INT8_C(  70), -INT8_C(  79),  INT8_C( 113),  INT8_C( 115), -INT8_C(  86), -INT8_C(  19),
+        -INT8_C(  11),  INT8_C(  98),  INT8_C( 122), -INT8_C(   4),  INT8_C(  96),  INT8_C(  58),  INT8_C(  39),  INT8_C(  30) },
+      {  INT8_C(   9), -INT8_C( 107), -INT8_C(  70), -INT8_C(  47), -INT8_C( 111), -INT8_C(  77), -INT8_C(  22), -INT8_C( 115),
+        -INT8_C( 107), -INT8_C(  62), -INT8_C( 102), -INT8_C(  36), -INT8_C(  32), -INT8_C(   6), -INT8_C(  89),  INT8_C(  62) } },
+    { {  INT8_C( 105),  INT8_C( 111),  INT8_C(  67),  INT8_C(  68),  INT8_C(  28), -INT8_C(  95),  INT8_C(  34),  INT8_C(  45),
+         INT8_C(  89), -INT8_C(   1),  INT8_C(  46),  INT8_C(  54),  INT8_C(   9),  INT8_C(   2),  INT8_C( 109),  INT8_C(  22) },
+      { -INT8_C( 111),      INT8_MIN, -INT8_C( 106), -INT8_C(  52), -INT8_C(  27), -INT8_C(  45),  INT8_C(  44), -INT8_C(   3),
+        -INT8_C(  82),  INT8_C(   4),  INT8_C( 115),  INT8_C( 114),  INT8_C(  89), -INT8_C(  37),  INT8_C(  29),  INT8_C(  96) },
+      { -INT8_C( 111),      INT8_MIN, -INT8_C( 106), -INT8_C(  52), -INT8_C(  27), -INT8_C(  45),  INT8_C(  44), -INT8_C(   3),
+        -INT8_C(  82),  INT8_C(   4),  INT8_C( 115),  INT8_C( 114),  INT8_C(  89), -INT8_C(  37),  INT8_C(  29),  INT8_C(  96) },
+      { -INT8_C( 119),  INT8_C(   7), -INT8_C(  77),  INT8_C( 100),  INT8_C(  44), -INT8_C( 103),  INT8_C(  98), -INT8_C(  19),
+         INT8_C( 113),  INT8_C(  39), -INT8_C(  98), -INT8_C( 106), -INT8_C(  55), -INT8_C(  38), -INT8_C(  19),  INT8_C(   6) },
+      {  INT8_C(  41),  INT8_C(  15), -INT8_C(  61), -INT8_C( 124), -INT8_C(  68),  INT8_C(  97), -INT8_C( 126), -INT8_C(  83),
+        -INT8_C(  39), -INT8_C(  97),  INT8_C( 110),  INT8_C(  86),  INT8_C(  41),  INT8_C(  98), -INT8_C(  83),  INT8_C(  22) },
+      { -INT8_C(  23),  INT8_C( 111),  INT8_C(  67),  INT8_C(  68), -INT8_C( 100), -INT8_C(  95),  INT8_C(  34), -INT8_C(  83),
+         INT8_C(  89),      INT8_MAX, -INT8_C(  82),  INT8_C(  54), -INT8_C( 119), -INT8_C( 126), -INT8_C(  19),  INT8_C(  22) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+
+    simde_int8x16_t r0 = simde_vsliq_n_s8(a, b, 0);
+    simde_int8x16_t r3 = simde_vsliq_n_s8(a, b, 3);
+    simde_int8x16_t r5 = simde_vsliq_n_s8(a, b, 5);
+    simde_int8x16_t r7 = simde_vsliq_n_s8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_i8x16(r0, simde_vld1q_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x16(r3, simde_vld1q_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x16(r5, simde_vld1q_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x16(r7, simde_vld1q_s8(test_vec[i].r7));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x16_t a = simde_test_arm_neon_random_i8x16();
+    simde_int8x16_t b = simde_test_arm_neon_random_i8x16();
+
+    simde_int8x16_t r0 = simde_vsliq_n_s8(a, b, 0);
+    simde_int8x16_t r3 = simde_vsliq_n_s8(a, b, 3);
+    simde_int8x16_t r5 = simde_vsliq_n_s8(a, b, 5);
+    simde_int8x16_t r7 = simde_vsliq_n_s8(a, b, 7);
+
+    simde_test_arm_neon_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r7, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r0[8];
+    int16_t r6[8];
+    int16_t r11[8];
+    int16_t r15[8];
+  } test_vec[] = {
+    { {  INT16_C(  4793), -INT16_C(  2104),  INT16_C(  3968), -INT16_C( 32439),  INT16_C( 13406), -INT16_C( 13603), -INT16_C(  8733), -INT16_C( 28278) },
+      { -INT16_C( 24374), -INT16_C( 16424),  INT16_C(  9752),  INT16_C(  4136), -INT16_C( 22800), -INT16_C(  3802), -INT16_C( 17681),  INT16_C(  5427) },
+      { -INT16_C( 24374), -INT16_C( 16424),  INT16_C(  9752),  INT16_C(  4136), -INT16_C( 22800), -INT16_C(  3802), -INT16_C( 17681),  INT16_C(  5427) },
+      {  INT16_C( 12985), -INT16_C(  2552), -INT16_C( 31232),  INT16_C(  2569), -INT16_C( 17378),  INT16_C( 18845), -INT16_C( 17437),  INT16_C( 19658) },
+      {  INT16_C( 21177), -INT16_C( 14392), -INT16_C( 14464),  INT16_C( 16713), -INT16_C( 31650),  INT16_C( 13021),  INT16_C( 32227), -INT16_C( 26230) },
+      {  INT16_C(  4793),  INT16_C( 30664),  INT16_C(  3968),  INT16_C(   329),  INT16_C( 13406),  INT16_C( 19165), -INT16_C(  8733), -INT16_C( 28278) } },
+    { { -INT16_C( 28156), -INT16_C( 19836),  INT16_C( 20522), -INT16_C( 19561), -INT16_C(  7108),  INT16_C( 15250), -INT16_C( 28429),  INT16_C(  4315) },
+      {  INT16_C( 24886), -INT16_C( 13301), -INT16_C(  2770), -INT16_C(  1049), -INT16_C( 14221), -INT16_C( 12091), -INT16_C( 16939), -INT16_C( 26690) },
+      {  INT16_C( 24886), -INT16_C( 13301), -INT16_C(  2770), -INT16_C(  1049), -INT16_C( 14221), -INT16_C( 12091), -INT16_C( 16939), -INT16_C( 26690) },
+      {  INT16_C( 19844),  INT16_C(   708),  INT16_C( 19370), -INT16_C(  1577),  INT16_C(  7420),  INT16_C( 12626),  INT16_C( 30067), -INT16_C(  4197) },
+      { -INT16_C( 19964),  INT16_C( 23172),  INT16_C( 28714),  INT16_C( 15255), -INT16_C( 25540),  INT16_C( 11154), -INT16_C( 22285), -INT16_C(  3877) },
+      {  INT16_C(  4612), -INT16_C( 19836),  INT16_C( 20522), -INT16_C( 19561), -INT16_C(  7108), -INT16_C( 17518), -INT16_C( 28429),  INT16_C(  4315) } },
+    { { -INT16_C( 32441), -INT16_C( 25756), -INT16_C(   903), -INT16_C( 10938),  INT16_C( 25024), -INT16_C( 18523),  INT16_C( 18143),  INT16_C( 18381) },
+      {  INT16_C(  4580),  INT16_C( 24693), -INT16_C( 13283),  INT16_C(  2917), -INT16_C( 11026), -INT16_C( 28859),  INT16_C( 25344),  INT16_C(  5507) },
+      {  INT16_C(  4580),  INT16_C( 24693), -INT16_C( 13283),  INT16_C(  2917), -INT16_C( 11026), -INT16_C( 28859),  INT16_C( 25344),  INT16_C(  5507) },
+      {  INT16_C( 30983),  INT16_C(  7524),  INT16_C(  1913), -INT16_C(  9914),  INT16_C( 15232), -INT16_C( 11931), -INT16_C( 16353),  INT16_C( 24781) },
+      {  INT16_C(  8519), -INT16_C( 21660), -INT16_C(  4999),  INT16_C( 11590),  INT16_C( 29120),  INT16_C( 12197),  INT16_C(  1759),  INT16_C(  8141) },
+      {  INT16_C(   327), -INT16_C( 25756), -INT16_C(   903), -INT16_C( 10938),  INT16_C( 25024), -INT16_C( 18523),  INT16_C( 18143), -INT16_C( 14387) } },
+    { { -INT16_C(  4326),  INT16_C(  4494),  INT16_C( 28592), -INT16_C( 25652),  INT16_C(   989), -INT16_C(  5494), -INT16_C(  7059), -INT16_C(  2060) },
+      {  INT16_C(  5191),  INT16_C(  7073), -INT16_C(  2983), -INT16_C( 10964), -INT16_C( 29365), -INT16_C( 26390), -INT16_C( 28795), -INT16_C(  4439) },
+      {  INT16_C(  5191),  INT16_C(  7073), -INT16_C(  2983), -INT16_C( 10964), -INT16_C( 29365), -INT16_C( 26390), -INT16_C( 28795), -INT16_C(  4439) },
+      {  INT16_C(  4570), -INT16_C(  6066),  INT16_C(  5744),  INT16_C( 19212),  INT16_C( 21213),  INT16_C( 14986), -INT16_C(  7827), -INT16_C( 21900) },
+      {  INT16_C( 16154),  INT16_C(  2446), -INT16_C( 12368),  INT16_C( 25548),  INT16_C( 23517),  INT16_C( 21130),  INT16_C( 11373),  INT16_C( 20468) },
+      { -INT16_C(  4326), -INT16_C( 28274), -INT16_C(  4176),  INT16_C(  7116), -INT16_C( 31779),  INT16_C( 27274), -INT16_C(  7059), -INT16_C(  2060) } },
+    { {  INT16_C( 31298),  INT16_C( 11623), -INT16_C( 31615), -INT16_C(  5688), -INT16_C(   167), -INT16_C( 28023), -INT16_C( 16711), -INT16_C(  7870) },
+      { -INT16_C( 20536),  INT16_C( 22581),  INT16_C( 17074), -INT16_C( 13280),  INT16_C( 17078),  INT16_C( 17183), -INT16_C(  7069),  INT16_C( 26030) },
+      { -INT16_C( 20536),  INT16_C( 22581),  INT16_C( 17074), -INT16_C( 13280),  INT16_C( 17078),  INT16_C( 17183), -INT16_C(  7069),  INT16_C( 26030) },
+      { -INT16_C(  3582),  INT16_C(  3431), -INT16_C( 21375),  INT16_C(  2056), -INT16_C( 21095), -INT16_C( 14391),  INT16_C(  6393),  INT16_C( 27522) },
+      {  INT16_C( 16962), -INT16_C( 21145), -INT16_C( 27519),  INT16_C(   456), -INT16_C( 18599), -INT16_C(  1399),  INT16_C(  7865),  INT16_C( 28994) },
+      {  INT16_C( 31298), -INT16_C( 21145),  INT16_C(  1153),  INT16_C( 27080),  INT16_C( 32601), -INT16_C( 28023), -INT16_C( 16711),  INT16_C( 24898) } },
+    { {  INT16_C( 28955), -INT16_C(  8152),  INT16_C(  5809), -INT16_C( 10141),  INT16_C( 28989),  INT16_C( 14539), -INT16_C(  3428), -INT16_C(  8776) },
+      {  INT16_C(  1597),  INT16_C(  1065), -INT16_C(  5762),  INT16_C(  1323),  INT16_C( 16982), -INT16_C(  1170),  INT16_C( 29716), -INT16_C( 11880) },
+      {  INT16_C(  1597),  INT16_C(  1065), -INT16_C(  5762),  INT16_C(  1323),  INT16_C( 16982), -INT16_C(  1170),  INT16_C( 29716), -INT16_C( 11880) },
+      { -INT16_C( 28837),  INT16_C(  2664),  INT16_C( 24497),  INT16_C( 19171), -INT16_C( 27203), -INT16_C(  9333),  INT16_C(  1308),  INT16_C( 26168) },
+      { -INT16_C(  5861),  INT16_C( 18472), -INT16_C(  2383),  INT16_C( 22627), -INT16_C( 20163),  INT16_C( 28875), -INT16_C( 23908), -INT16_C( 14920) },
+      { -INT16_C(  3813), -INT16_C(  8152),  INT16_C(  5809), -INT16_C( 10141),  INT16_C( 28989),  INT16_C( 14539),  INT16_C( 29340),  INT16_C( 23992) } },
+    { { -INT16_C( 27601), -INT16_C( 30620), -INT16_C( 32190),  INT16_C(   132), -INT16_C( 31176), -INT16_C( 31117), -INT16_C( 29632), -INT16_C(  9183) },
+      {  INT16_C( 12815), -INT16_C( 17641),  INT16_C(  9608), -INT16_C(  2767), -INT16_C(  1688),  INT16_C( 31825),  INT16_C(  5772),  INT16_C( 32365) },
+      {  INT16_C( 12815), -INT16_C( 17641),  INT16_C(  9608), -INT16_C(  2767), -INT16_C(  1688),  INT16_C( 31825),  INT16_C(  5772),  INT16_C( 32365) },
+      { -INT16_C( 31761), -INT16_C( 14876),  INT16_C( 25090),  INT16_C( 19524),  INT16_C( 23096),  INT16_C(  5235), -INT16_C( 23808), -INT16_C( 25759) },
+      {  INT16_C( 31791), -INT16_C( 18332),  INT16_C( 16962), -INT16_C( 30588),  INT16_C( 17976), -INT16_C( 29069),  INT16_C( 25664),  INT16_C( 27681) },
+      { -INT16_C( 27601), -INT16_C( 30620),  INT16_C(   578), -INT16_C( 32636),  INT16_C(  1592), -INT16_C( 31117),  INT16_C(  3136), -INT16_C(  9183) } },
+    { { -INT16_C(  8002), -INT16_C(  5727),  INT16_C( 15445), -INT16_C( 26079),  INT16_C( 18988), -INT16_C(  7522), -INT16_C( 20022), -INT16_C( 12589) },
+      { -INT16_C( 28249), -INT16_C( 18365), -INT16_C(  7449), -INT16_C(  5959),  INT16_C( 21857),  INT16_C( 30771), -INT16_C( 22339),  INT16_C(  1877) },
+      { -INT16_C( 28249), -INT16_C( 18365), -INT16_C(  7449), -INT16_C(  5959),  INT16_C( 21857),  INT16_C( 30771), -INT16_C( 22339),  INT16_C(  1877) },
+      {  INT16_C( 27134),  INT16_C(  4321), -INT16_C( 17963),  INT16_C( 11873),  INT16_C( 22636),  INT16_C(  3294),  INT16_C( 12106), -INT16_C( 10925) },
+      {  INT16_C( 14526),  INT16_C(  6561),  INT16_C( 15445), -INT16_C( 13791),  INT16_C(  2604), -INT16_C( 25954), -INT16_C(  5686), -INT16_C( 20781) },
+      { -INT16_C(  8002), -INT16_C(  5727), -INT16_C( 17323), -INT16_C( 26079), -INT16_C( 13780), -INT16_C(  7522), -INT16_C( 20022), -INT16_C( 12589) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+
+    simde_int16x8_t r0 = simde_vsliq_n_s16(a, b, 0);
+    simde_int16x8_t r6 = simde_vsliq_n_s16(a, b, 6);
+    simde_int16x8_t r11 = simde_vsliq_n_s16(a, b, 11);
+    simde_int16x8_t r15 = simde_vsliq_n_s16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_i16x8(r0, simde_vld1q_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x8(r6, simde_vld1q_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x8(r11, simde_vld1q_s16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_i16x8(r15, simde_vld1q_s16(test_vec[i].r15));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+    simde_int16x8_t b = simde_test_arm_neon_random_i16x8();
+
+    simde_int16x8_t r0 = simde_vsliq_n_s16(a, b, 0);
+    simde_int16x8_t r6 = simde_vsliq_n_s16(a, b, 6);
+    simde_int16x8_t r11 = simde_vsliq_n_s16(a, b, 11);
+    simde_int16x8_t r15 = simde_vsliq_n_s16(a, b, 15);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r15, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r0[4];
+    int32_t r13[4];
+    int32_t r22[4];
+    int32_t r31[4];
+  } test_vec[] = {
+    { {  INT32_C(   202698549),  INT32_C(   325948795),  INT32_C(  2147392362), -INT32_C(  1941298091) },
+      {  INT32_C(  1769858085), -INT32_C(  1124665411), -INT32_C(  1446443271), -INT32_C(  1535330523) },
+      {  INT32_C(  1769858085), -INT32_C(  1124665411), -INT32_C(  1446443271), -INT32_C(  1535330523) },
+      { -INT32_C(  1132155083), -INT32_C(   554191493),  INT32_C(   551500650), -INT32_C(  1763400619) },
+      {  INT32_C(   156561205), -INT32_C(   278030981), -INT32_C(  1098998934), -INT32_C(   917887915) },
+      { -INT32_C(  1944785099), -INT32_C(  1821534853), -INT32_C(       91286), -INT32_C(  1941298091) } },
+    { { -INT32_C(   671321779), -INT32_C(  1204963382), -INT32_C(   885496485), -INT32_C(  1251022287) },
+      {  INT32_C(   200807020),  INT32_C(  1918960284),  INT32_C(  1374818376),  INT32_C(  1581782193) },
+      {  INT32_C(   200807020),  INT32_C(  1918960284),  INT32_C(  1374818376),  INT32_C(  1581782193) },
+      {  INT32_C(    38637901),  INT32_C(   542349258),  INT32_C(  1107887451),  INT32_C(    43395633) },
+      { -INT32_C(  1690537651), -INT32_C(  1490176054),  INT32_C(   305685851),  INT32_C(   745466417) },
+      {  INT32_C(  1476161869),  INT32_C(   942520266),  INT32_C(  1261987163), -INT32_C(  1251022287) } },
+    { { -INT32_C(  1218231753),  INT32_C(  1824229666),  INT32_C(  1212061328),  INT32_C(  1502123083) },
+      {  INT32_C(  1056523651),  INT32_C(   230256463), -INT32_C(   440280084),  INT32_C(  1560987772) },
+      {  INT32_C(  1056523651),  INT32_C(   230256463), -INT32_C(   440280084),  INT32_C(  1560987772) },
+      {  INT32_C(   682648119),  INT32_C(   770304290),  INT32_C(   998086288),  INT32_C(  1494193227) },
+      {  INT32_C(  1625506359), -INT32_C(   738490078), -INT32_C(    79784304),  INT32_C(   520655947) },
+      { -INT32_C(  1218231753), -INT32_C(   323253982),  INT32_C(  1212061328),  INT32_C(  1502123083) } },
+    { { -INT32_C(   634494152),  INT32_C(   415953910), -INT32_C(  2006132868),  INT32_C(  1399043992) },
+      { -INT32_C(  2112308276),  INT32_C(   448784290), -INT32_C(   750423114),  INT32_C(  2091526198) },
+      { -INT32_C(  2112308276),  INT32_C(   448784290), -INT32_C(   750423114),  INT32_C(  2091526198) },
+      {  INT32_C(   393839416), -INT32_C(    51096586), -INT32_C(  1367943300),  INT32_C(  1158076312) },
+      { -INT32_C(   215063752), -INT32_C(   393546762), -INT32_C(   307439748),  INT32_C(   228833176) },
+      {  INT32_C(  1512989496),  INT32_C(   415953910),  INT32_C(   141350780),  INT32_C(  1399043992) } },
+    { {  INT32_C(  2107229277), -INT32_C(  1114627523), -INT32_C(  2107946476), -INT32_C(   266098322) },
+      {  INT32_C(  1531840425), -INT32_C(  1674971764),  INT32_C(   839207931),  INT32_C(   848243244) },
+      {  INT32_C(  1531840425), -INT32_C(  1674971764),  INT32_C(   839207931),  INT32_C(   848243244) },
+      { -INT32_C(  1057676195),  INT32_C(  1051820605), -INT32_C(  1451267564), -INT32_C(   448427666) },
+      { -INT32_C(   363215779),  INT32_C(  1662001725), -INT32_C(    19183084), -INT32_C(  1960597138) },
+      { -INT32_C(    40254371),  INT32_C(  1032856125), -INT32_C(  2107946476),  INT32_C(  1881385326) } },
+    { { -INT32_C(   650977421), -INT32_C(   337971638), -INT32_C(  1775530341), -INT32_C(   941456516) },
+      { -INT32_C(  1259988954), -INT32_C(   825656953), -INT32_C(  1228435397), -INT32_C(    65671656) },
+      { -INT32_C(  1259988954), -INT32_C(   825656953), -INT32_C(  1228435397), -INT32_C(    65671656) },
+      { -INT32_C(  1023090829),  INT32_C(   791737930), -INT32_C(   234393957), -INT32_C(  1111293060) },
+      {  INT32_C(   162717555),  INT32_C(  1641739850),  INT32_C(   250318491), -INT32_C(  2044558468) },
+      {  INT32_C(  1496506227), -INT32_C(   337971638), -INT32_C(  1775530341),  INT32_C(  1206027132) } },
+    { {  INT32_C(   753995914), -INT32_C(   802053927), -INT32_C(  1933098312), -INT32_C(  1513825495) },
+      {  INT32_C(    38887789), -INT32_C(   689729579),  INT32_C(   966883278),  INT32_C(   892128501) },
+      {  INT32_C(    38887789), -INT32_C(   689729579),  INT32_C(   966883278),  INT32_C(   892128501) },
+      {  INT32_C(   741191818),  INT32_C(  1912250585),  INT32_C(   788120248), -INT32_C(  1717650647) },
+      {  INT32_C(  1534136458), -INT32_C(   177102631), -INT32_C(   209239368),  INT32_C(  1027922729) },
+      { -INT32_C(  1393487734), -INT32_C(   802053927),  INT32_C(   214385336), -INT32_C(  1513825495) } },
+    { { -INT32_C(  1729124661),  INT32_C(  1625884407), -INT32_C(   547544706),  INT32_C(  1080384842) },
+      { -INT32_C(   858528003), -INT32_C(   973062979), -INT32_C(   801845894), -INT32_C(  1548452585) },
+      { -INT32_C(   858528003), -INT32_C(   973062979), -INT32_C(   801845894), -INT32_C(  1548452585) },
+      {  INT32_C(  2095032011),  INT32_C(   127379191), -INT32_C(  1716567682), -INT32_C(  1885143734) },
+      { -INT32_C(  1083201845),  INT32_C(   795412215),  INT32_C(  1587356030),  INT32_C(  1172659530) },
+      { -INT32_C(  1729124661), -INT32_C(   521599241),  INT32_C(  1599938942), -INT32_C(  1067098806) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+
+    simde_int32x4_t r0 = simde_vsliq_n_s32(a, b, 0);
+    simde_int32x4_t r13 = simde_vsliq_n_s32(a, b, 13);
+    simde_int32x4_t r22 = simde_vsliq_n_s32(a, b, 22);
+    simde_int32x4_t r31 = simde_vsliq_n_s32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_i32x4(r0, simde_vld1q_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x4(r13, simde_vld1q_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x4(r22, simde_vld1q_s32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_i32x4(r31, simde_vld1q_s32(test_vec[i].r31));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+    simde_int32x4_t b = simde_test_arm_neon_random_i32x4();
+
+    simde_int32x4_t r0 = simde_vsliq_n_s32(a, b, 0);
+    simde_int32x4_t r13 = simde_vsliq_n_s32(a, b, 13);
+    simde_int32x4_t r22 = simde_vsliq_n_s32(a, b, 22);
+    simde_int32x4_t r31 = simde_vsliq_n_s32(a, b, 31);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r31, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r0[2];
+    int64_t r19[2];
+    int64_t r42[2];
+    int64_t r63[2];
+  } test_vec[] = {
+    { {  INT64_C( 2269604850076127454), -INT64_C( 5572376475729062633) },
+      {  INT64_C(   22492179263246576),  INT64_C( 1887406492090553599) },
+      {  INT64_C(   22492179263246576),  INT64_C( 1887406492090553599) },
+      {  INT64_C( 4910218468617523422),  INT64_C( 5882579170688308503) },
+      { -INT64_C( 2935289681768967970),  INT64_C( 5427960283239617815) },
+      {  INT64_C( 2269604850076127454), -INT64_C( 5572376475729062633) } },
+    { {  INT64_C( 6112772144471348684), -INT64_C( 3820664276314314321) },
+      {  INT64_C( 9030247165219774152), -INT64_C( 7002135636707856924) },
+      {  INT64_C( 9030247165219774152), -INT64_C( 7002135636707856924) },
+      {  INT64_C( 1125520819980998092),  INT64_C( 6189642870104959407) },
+      { -INT64_C( 7171100731806706228), -INT64_C( 5568821793780487761) },
+      {  INT64_C( 6112772144471348684),  INT64_C( 5402707760540461487) } },
+    { { -INT64_C( 1808559104591993567), -INT64_C( 3011499755856380201) },
+      { -INT64_C( 8304334030787077302), -INT64_C(  359764727403952353) },
+      { -INT64_C( 8304334030787077302), -INT64_C(  359764727403952353) },
+      { -INT64_C( 6803824145682995935), -INT64_C( 2371247483205894441) },
+      { -INT64_C(  113389251491601119),  INT64_C( 9015217913501662935) },
+      {  INT64_C( 7414812932262782241), -INT64_C( 3011499755856380201) } },
+    { {  INT64_C( 2836550940807702032), -INT64_C(  919709397255895564) },
+      {  INT64_C( 5321680140051067328),  INT64_C( 7912216903428247848) },
+      {  INT64_C( 5321680140051067328),  INT64_C( 7912216903428247848) },
+      {  INT64_C( 4549374450596095504), -INT64_C( 4984687141050038796) },
+      { -INT64_C(  376331986716547568), -INT64_C( 5024714069325036044) },
+      {  INT64_C( 2836550940807702032),  INT64_C( 8303662639598880244) } },
+    { {  INT64_C( 5006799728171181372),  INT64_C(  989414656230012728) },
+      { -INT64_C( 2749342811355123343), -INT64_C(  283240409296514078) },
+      { -INT64_C( 2749342811355123343), -INT64_C(  283240409296514078) },
+      { -INT64_C(  415216016834271940), -INT64_C( 3257915888881912008) },
+      { -INT64_C( 7078033727784590020),  INT64_C( 7011976403233519416) },
+      { -INT64_C( 4216572308683594436),  INT64_C(  989414656230012728) } },
+    { { -INT64_C( 8454189076826476877),  INT64_C( 4281477972952216419) },
+      {  INT64_C( 5665632197019170511), -INT64_C( 8337816434819096840) },
+      {  INT64_C( 5665632197019170511), -INT64_C( 8337816434819096840) },
+      { -INT64_C(  884646441098858829),  INT64_C(   73888886350279523) },
+      {  INT64_C( 6907184631855263411), -INT64_C( 4144471056834759837) },
+      { -INT64_C( 8454189076826476877),  INT64_C( 4281477972952216419) } },
+    { {  INT64_C( 2124594190628201603),  INT64_C( 2501685026151487327) },
+      {  INT64_C( 8435054750050396306),  INT64_C( 2107945430983166732) },
+      {  INT64_C( 8435054750050396306),  INT64_C( 2107945430983166732) },
+      { -INT64_C( 5992692632016345981),  INT64_C( 7609919289573005151) },
+      { -INT64_C( 1827815859691674493), -INT64_C( 6688917166149052577) },
+      {  INT64_C( 2124594190628201603),  INT64_C( 2501685026151487327) } },
+    { { -INT64_C( 4457661243259231698), -INT64_C( 8516958047432654315) },
+      {  INT64_C( 9107603483436001565), -INT64_C( 5457852822745895222) },
+      {  INT64_C( 9107603483436001565), -INT64_C( 5457852822745895222) },
+      { -INT64_C( 6275332317885373906),  INT64_C( 9093470173152100885) },
+      {  INT64_C( 4657976246259540526),  INT64_C( 8699595242516464149) },
+      { -INT64_C( 4457661243259231698),  INT64_C(  706413989422121493) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+
+    simde_int64x2_t r0 = simde_vsliq_n_s64(a, b, 0);
+    simde_int64x2_t r19 = simde_vsliq_n_s64(a, b, 19);
+    simde_int64x2_t r42 = simde_vsliq_n_s64(a, b, 42);
+    simde_int64x2_t r63 = simde_vsliq_n_s64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_i64x2(r0, simde_vld1q_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x2(r19, simde_vld1q_s64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i64x2(r42, simde_vld1q_s64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_i64x2(r63, simde_vld1q_s64(test_vec[i].r63));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+    simde_int64x2_t b = simde_test_arm_neon_random_i64x2();
+
+    simde_int64x2_t r0 = simde_vsliq_n_s64(a, b, 0);
+    simde_int64x2_t r19 = simde_vsliq_n_s64(a, b, 19);
+    simde_int64x2_t r42 = simde_vsliq_n_s64(a, b, 42);
+    simde_int64x2_t r63 = simde_vsliq_n_s64(a, b, 63);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    uint8_t r0[16];
+    uint8_t r3[16];
+    uint8_t r5[16];
+    uint8_t r7[16];
+  } test_vec[] = {
+    { {    UINT8_MAX, UINT8_C( 26), UINT8_C( 83), UINT8_C( 12), UINT8_C(109), UINT8_C(147), UINT8_C( 52), UINT8_C( 83),
+        UINT8_C(114), UINT8_C( 54), UINT8_C(122), UINT8_C(102), UINT8_C(114), UINT8_C(119), UINT8_C( 84), UINT8_C( 82) },
+      { UINT8_C(221), UINT8_C(139), UINT8_C(247), UINT8_C( 13), UINT8_C(174), UINT8_C(169), UINT8_C( 43), UINT8_C(106),
+        UINT8_C(246), UINT8_C(  5), UINT8_C(187), UINT8_C( 79), UINT8_C(179), UINT8_C( 70), UINT8_C(102), UINT8_C( 18) },
+      { UINT8_C(221), UINT8_C(139), UINT8_C(247), UINT8_C( 13), UINT8_C(174), UINT8_C(169), UINT8_C( 43), UINT8_C(106),
+        UINT8_C(246), UINT8_C(  5), UINT8_C(187), UINT8_C( 79), UINT8_C(179), UINT8_C( 70), UINT8_C(102), UINT8_C( 18) },
+      { UINT8_C(239), UINT8_C( 90), UINT8_C(187), UINT8_C(108), UINT8_C(117), UINT8_C( 75), UINT8_C( 92), UINT8_C( 83),
+        UINT8_C(178), UINT8_C( 46), UINT8_C(218), UINT8_C(126), UINT8_C(154), UINT8_C( 55), UINT8_C( 52), UINT8_C(146) },
+      { UINT8_C(191), UINT8_C(122), UINT8_C(243), UINT8_C(172), UINT8_C(205), UINT8_C( 51), UINT8_C(116), UINT8_C( 83),
+        UINT8_C(210), UINT8_C(182), UINT8_C(122), UINT8_C(230), UINT8_C(114), UINT8_C(215), UINT8_C(212), UINT8_C( 82) },
+      {    UINT8_MAX, UINT8_C(154), UINT8_C(211), UINT8_C(140), UINT8_C(109), UINT8_C(147), UINT8_C(180), UINT8_C( 83),
+        UINT8_C(114), UINT8_C(182), UINT8_C(250), UINT8_C(230), UINT8_C(242), UINT8_C(119), UINT8_C( 84), UINT8_C( 82) } },
+    { { UINT8_C( 64), UINT8_C( 44), UINT8_C(239), UINT8_C( 50), UINT8_C( 86), UINT8_C(224), UINT8_C( 95), UINT8_C(236),
+        UINT8_C( 39), UINT8_C(216), UINT8_C(233), UINT8_C( 23), UINT8_C(211), UINT8_C(232), UINT8_C( 19), UINT8_C( 47) },
+      { UINT8_C( 57), UINT8_C(  4), UINT8_C( 86), UINT8_C(185), UINT8_C( 40), UINT8_C(116), UINT8_C( 40), UINT8_C(194),
+        UINT8_C( 13), UINT8_C( 98), UINT8_C(121), UINT8_C(115), UINT8_C(162), UINT8_C(127), UINT8_C(130), UINT8_C( 82) },
+      { UINT8_C( 57), UINT8_C(  4), UINT8_C( 86), UINT8_C(185), UINT8_C( 40), UINT8_C(116), UINT8_C( 40), UINT8_C(194),
+        UINT8_C( 13), UINT8_C( 98), UINT8_C(121), UINT8_C(115), UINT8_C(162), UINT8_C(127), UINT8_C(130), UINT8_C( 82) },
+      { UINT8_C(200), UINT8_C( 36), UINT8_C(183), UINT8_C(202), UINT8_C( 70), UINT8_C(160), UINT8_C( 71), UINT8_C( 20),
+        UINT8_C(111), UINT8_C( 16), UINT8_C(201), UINT8_C(159), UINT8_C( 19), UINT8_C(248), UINT8_C( 19), UINT8_C(151) },
+      { UINT8_C( 32), UINT8_C(140), UINT8_C(207), UINT8_C( 50), UINT8_C( 22), UINT8_C(128), UINT8_C( 31), UINT8_C( 76),
+        UINT8_C(167), UINT8_C( 88), UINT8_C( 41), UINT8_C(119), UINT8_C( 83), UINT8_C(232), UINT8_C( 83), UINT8_C( 79) },
+      { UINT8_C(192), UINT8_C( 44), UINT8_C(111), UINT8_C(178), UINT8_C( 86), UINT8_C( 96), UINT8_C( 95), UINT8_C(108),
+        UINT8_C(167), UINT8_C( 88), UINT8_C(233), UINT8_C(151), UINT8_C( 83), UINT8_C(232), UINT8_C( 19), UINT8_C( 47) } },
+    { { UINT8_C( 90), UINT8_C(145), UINT8_C(117), UINT8_C(230), UINT8_C(146), UINT8_C( 50), UINT8_C(136), UINT8_C(209),
+        UINT8_C(189), UINT8_C(168), UINT8_C(150), UINT8_C(207), UINT8_C(200), UINT8_C( 38), UINT8_C(100), UINT8_C( 16) },
+      { UINT8_C(131), UINT8_C(180), UINT8_C(145), UINT8_C(232), UINT8_C(249), UINT8_C(220),    UINT8_MAX, UINT8_C( 78),
+        UINT8_C( 27), UINT8_C( 94), UINT8_C(126), UINT8_C(  9), UINT8_C(104), UINT8_C( 72), UINT8_C(202), UINT8_C(197) },
+      { UINT8_C(131), UINT8_C(180), UINT8_C(145), UINT8_C(232), UINT8_C(249), UINT8_C(220),    UINT8_MAX, UINT8_C( 78),
+        UINT8_C( 27), UINT8_C( 94), UINT8_C(126), UINT8_C(  9), UINT8_C(104), UINT8_C( 72), UINT8_C(202), UINT8_C(197) },
+      { UINT8_C( 26), UINT8_C(161), UINT8_C(141), UINT8_C( 70), UINT8_C(202), UINT8_C(226), UINT8_C(248), UINT8_C(113),
+        UINT8_C(221), UINT8_C(240), UINT8_C(246), UINT8_C( 79), UINT8_C( 64), UINT8_C( 70), UINT8_C( 84), UINT8_C( 40) },
+      { UINT8_C(122), UINT8_C(145), UINT8_C( 53), UINT8_C(  6), UINT8_C( 50), UINT8_C(146), UINT8_C(232), UINT8_C(209),
+        UINT8_C(125), UINT8_C(200), UINT8_C(214), UINT8_C( 47), UINT8_C(  8), UINT8_C(  6), UINT8_C( 68), UINT8_C(176) },
+      { UINT8_C(218), UINT8_C( 17), UINT8_C(245), UINT8_C(102), UINT8_C(146), UINT8_C( 50), UINT8_C(136), UINT8_C( 81),
+        UINT8_C(189), UINT8_C( 40), UINT8_C( 22), UINT8_C(207), UINT8_C( 72), UINT8_C( 38), UINT8_C(100), UINT8_C(144) } },
+    { { UINT8_C(220), UINT8_C(107), UINT8_C(169), UINT8_C(206), UINT8_C( 32), UINT8_C(155), UINT8_C(246), UINT8_C( 76),
+        UINT8_C(114), UINT8_C(145), UINT8_C( 31), UINT8_C( 29), UINT8_C( 97), UINT8_C(140), UINT8_C(193), UINT8_C(249) },
+      { UINT8_C(243), UINT8_C(246), UINT8_C(153), UINT8_C(234), UINT8_C(203), UINT8_C( 72), UINT8_C(  3), UINT8_C(248),
+        UINT8_C( 79), UINT8_C(154), UINT8_C(189), UINT8_C( 15), UINT8_C( 41), UINT8_C( 13), UINT8_C( 14), UINT8_C(195) },
+      { UINT8_C(243), UINT8_C(246), UINT8_C(153), UINT8_C(234), UINT8_C(203), UINT8_C( 72), UINT8_C(  3), UINT8_C(248),
+        UINT8_C( 79), UINT8_C(154), UINT8_C(189), UINT8_C( 15), UINT8_C( 41), UINT8_C( 13), UINT8_C( 14), UINT8_C(195) },
+      { UINT8_C(156), UINT8_C(179), UINT8_C(201), UINT8_C( 86), UINT8_C( 88), UINT8_C( 67), UINT8_C( 30), UINT8_C(196),
+        UINT8_C(122), UINT8_C(209), UINT8_C(239), UINT8_C(125), UINT8_C( 73), UINT8_C(108), UINT8_C(113), UINT8_C( 25) },
+      { UINT8_C(124), UINT8_C(203), UINT8_C( 41), UINT8_C( 78), UINT8_C( 96), UINT8_C( 27), UINT8_C(118), UINT8_C( 12),
+        UINT8_C(242), UINT8_C( 81), UINT8_C(191), UINT8_C(253), UINT8_C( 33), UINT8_C(172), UINT8_C(193), UINT8_C(121) },
+      { UINT8_C(220), UINT8_C(107), UINT8_C(169), UINT8_C( 78), UINT8_C(160), UINT8_C( 27), UINT8_C(246), UINT8_C( 76),
+        UINT8_C(242), UINT8_C( 17), UINT8_C(159), UINT8_C(157), UINT8_C(225), UINT8_C(140), UINT8_C( 65), UINT8_C(249) } },
+    { { UINT8_C(117), UINT8_C(135), UINT8_C( 11), UINT8_C(207), UINT8_C(  8), UINT8_C(194), UINT8_C( 18), UINT8_C(132),
+        UINT8_C(141), UINT8_C(108), UINT8_C(164), UINT8_C(179), UINT8_C(196), UINT8_C(237), UINT8_C( 74), UINT8_C( 53) },
+      { UINT8_C(157), UINT8_C(206), UINT8_C(250), UINT8_C(102), UINT8_C(249), UINT8_C( 50), UINT8_C(158), UINT8_C(242),
+        UINT8_C(166), UINT8_C(113), UINT8_C( 67), UINT8_C(247), UINT8_C( 53), UINT8_C(198), UINT8_C(204), UINT8_C(143) },
+      { UINT8_C(157), UINT8_C(206), UINT8_C(250), UINT8_C(102), UINT8_C(249), UINT8_C( 50), UINT8_C(158), UINT8_C(242),
+        UINT8_C(166), UINT8_C(113), UINT8_C( 67), UINT8_C(247), UINT8_C( 53), UINT8_C(198), UINT8_C(204), UINT8_C(143) },
+      { UINT8_C(237), UINT8_C(119), UINT8_C(211), UINT8_C( 55), UINT8_C(200), UINT8_C(146), UINT8_C(242), UINT8_C(148),
+        UINT8_C( 53), UINT8_C(140), UINT8_C( 28), UINT8_C(187), UINT8_C(172), UINT8_C( 53), UINT8_C( 98), UINT8_C(125) },
+      { UINT8_C(181), UINT8_C(199), UINT8_C( 75), UINT8_C(207), UINT8_C( 40), UINT8_C( 66), UINT8_C(210), UINT8_C( 68),
+        UINT8_C(205), UINT8_C( 44), UINT8_C(100), UINT8_C(243), UINT8_C(164), UINT8_C(205), UINT8_C(138), UINT8_C(245) },
+      { UINT8_C(245), UINT8_C(  7), UINT8_C( 11), UINT8_C( 79), UINT8_C(136), UINT8_C( 66), UINT8_C( 18), UINT8_C(  4),
+        UINT8_C( 13), UINT8_C(236), UINT8_C(164), UINT8_C(179), UINT8_C(196), UINT8_C(109), UINT8_C( 74), UINT8_C(181) } },
+    { { UINT8_C(117), UINT8_C(126), UINT8_C(229), UINT8_C(109), UINT8_C(233), UINT8_C( 13), UINT8_C(242), UINT8_C( 50),
+        UINT8_C( 65), UINT8_C(106), UINT8_C(189), UINT8_C(144), UINT8_C(227), UINT8_C(177), UINT8_C(250), UINT8_C( 16) },
+      { UINT8_C(157), UINT8_C(111), UINT8_C( 59), UINT8_C(113), UINT8_C( 95), UINT8_C(  7), UINT8_C(108), UINT8_C(110),
+        UINT8_C(149), UINT8_C( 52), UINT8_C(186), UINT8_C(241), UINT8_C( 99), UINT8_C(214), UINT8_C( 42), UINT8_C(160) },
+      { UINT8_C(157), UINT8_C(111), UINT8_C( 59), UINT8_C(113), UINT8_C( 95), UINT8_C(  7), UINT8_C(108), UINT8_C(110),
+        UINT8_C(149), UINT8_C( 52), UINT8_C(186), UINT8_C(241), UINT8_C( 99), UINT8_C(214), UINT8_C( 42), UINT8_C(160) },
+      { UINT8_C(237), UINT8_C(126), UINT8_C(221), UINT8_C(141), UINT8_C(249), UINT8_C( 61), UINT8_C( 98), UINT8_C(114),
+        UINT8_C(169), UINT8_C(162), UINT8_C(213), UINT8_C(136), UINT8_C( 27), UINT8_C(177), UINT8_C( 82), UINT8_C(  0) },
+      { UINT8_C(181), UINT8_C(254), UINT8_C(101), UINT8_C( 45), UINT8_C(233), UINT8_C(237), UINT8_C(146), UINT8_C(210),
+        UINT8_C(161), UINT8_C(138), UINT8_C( 93), UINT8_C( 48), UINT8_C( 99), UINT8_C(209), UINT8_C( 90), UINT8_C( 16) },
+      { UINT8_C(245), UINT8_C(254), UINT8_C(229), UINT8_C(237), UINT8_C(233), UINT8_C(141), UINT8_C(114), UINT8_C( 50),
+        UINT8_C(193), UINT8_C(106), UINT8_C( 61), UINT8_C(144), UINT8_C(227), UINT8_C( 49), UINT8_C(122), UINT8_C( 16) } },
+    { { UINT8_C(119), UINT8_C( 63), UINT8_C(210), UINT8_C(214), UINT8_C(243), UINT8_C( 58), UINT8_C(100), UINT8_C(177),
+        UINT8_C( 73), UINT8_C(117), UINT8_C(179), UINT8_C(186), UINT8_C(218), UINT8_C( 63), UINT8_C( 80), UINT8_C(126) },
+      { UINT8_C( 75), UINT8_C(215), UINT8_C(252), UINT8_C( 45), UINT8_C( 26), UINT8_C(177), UINT8_C(178), UINT8_C(227),
+        UINT8_C(150), UINT8_C(132), UINT8_C(196), UINT8_C( 73), UINT8_C(147), UINT8_C(  8), UINT8_C(183), UINT8_C(241) },
+      { UINT8_C( 75), UINT8_C(215), UINT8_C(252), UINT8_C( 45), UINT8_C( 26), UINT8_C(177), UINT8_C(178), UINT8_C(227),
+        UINT8_C(150), UINT8_C(132), UINT8_C(196), UINT8_C( 73), UINT8_C(147), UINT8_C(  8), UINT8_C(183), UINT8_C(241) },
+      { UINT8_C( 95), UINT8_C(191), UINT8_C(226), UINT8_C(110), UINT8_C(211), UINT8_C(138), UINT8_C(148), UINT8_C( 25),
+        UINT8_C(177), UINT8_C( 37), UINT8_C( 35), UINT8_C( 74), UINT8_C(154), UINT8_C( 71), UINT8_C(184), UINT8_C(142) },
+      { UINT8_C(119),    UINT8_MAX, UINT8_C(146), UINT8_C(182), UINT8_C( 83), UINT8_C( 58), UINT8_C( 68), UINT8_C(113),
+        UINT8_C(201), UINT8_C(149), UINT8_C(147), UINT8_C( 58), UINT8_C(122), UINT8_C( 31), UINT8_C(240), UINT8_C( 62) },
+      { UINT8_C(247), UINT8_C(191), UINT8_C( 82), UINT8_C(214), UINT8_C(115), UINT8_C(186), UINT8_C(100), UINT8_C(177),
+        UINT8_C( 73), UINT8_C(117), UINT8_C( 51), UINT8_C(186), UINT8_C(218), UINT8_C( 63), UINT8_C(208), UINT8_C(254) } },
+    { { UINT8_C( 24), UINT8_C(190), UINT8_C(  2), UINT8_C( 28), UINT8_C(181), UINT8_C(160), UINT8_C(142), UINT8_C( 41),
+        UINT8_C(  3), UINT8_C( 44), UINT8_C(156), UINT8_C( 71), UINT8_C(  5), UINT8_C(104), UINT8_C(214), UINT8_C( 69) },
+      { UINT8_C(194), UINT8_C(166), UINT8_C(134), UINT8_C(134), UINT8_C( 93), UINT8_C(215), UINT8_C(198), UINT8_C(165),
+        UINT8_C( 17), UINT8_C(  5), UINT8_C(101), UINT8_C(223), UINT8_C(217), UINT8_C(152), UINT8_C(244), UINT8_C( 25) },
+      { UINT8_C(194), UINT8_C(166), UINT8_C(134), UINT8_C(134), UINT8_C( 93), UINT8_C(215), UINT8_C(198), UINT8_C(165),
+        UINT8_C( 17), UINT8_C(  5), UINT8_C(101), UINT8_C(223), UINT8_C(217), UINT8_C(152), UINT8_C(244), UINT8_C( 25) },
+      { UINT8_C( 16), UINT8_C( 54), UINT8_C( 50), UINT8_C( 52), UINT8_C(237), UINT8_C(184), UINT8_C( 54), UINT8_C( 41),
+        UINT8_C(139), UINT8_C( 44), UINT8_C( 44),    UINT8_MAX, UINT8_C(205), UINT8_C(192), UINT8_C(166), UINT8_C(205) },
+      { UINT8_C( 88), UINT8_C(222), UINT8_C(194), UINT8_C(220), UINT8_C(181), UINT8_C(224), UINT8_C(206), UINT8_C(169),
+        UINT8_C( 35), UINT8_C(172), UINT8_C(188), UINT8_C(231), UINT8_C( 37), UINT8_C(  8), UINT8_C(150), UINT8_C( 37) },
+      { UINT8_C( 24), UINT8_C( 62), UINT8_C(  2), UINT8_C( 28), UINT8_C(181), UINT8_C(160), UINT8_C( 14), UINT8_C(169),
+        UINT8_C(131), UINT8_C(172), UINT8_C(156), UINT8_C(199), UINT8_C(133), UINT8_C(104), UINT8_C( 86), UINT8_C(197) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+
+    simde_uint8x16_t r0 = simde_vsliq_n_u8(a, b, 0);
+    simde_uint8x16_t r3 = simde_vsliq_n_u8(a, b, 3);
+    simde_uint8x16_t r5 = simde_vsliq_n_u8(a, b, 5);
+    simde_uint8x16_t r7 = simde_vsliq_n_u8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_u8x16(r0, simde_vld1q_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x16(r3, simde_vld1q_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x16(r5, simde_vld1q_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x16(r7, simde_vld1q_u8(test_vec[i].r7));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x16_t a = simde_test_arm_neon_random_u8x16();
+    simde_uint8x16_t b = simde_test_arm_neon_random_u8x16();
+
+    simde_uint8x16_t r0 = simde_vsliq_n_u8(a, b, 0);
+    simde_uint8x16_t r3 = simde_vsliq_n_u8(a, b, 3);
+    simde_uint8x16_t r5 = simde_vsliq_n_u8(a, b, 5);
+    simde_uint8x16_t r7 = simde_vsliq_n_u8(a, b, 7);
+
+    simde_test_arm_neon_write_u8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r7, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint16_t r0[8];
+    uint16_t r6[8];
+    uint16_t r11[8];
+    uint16_t r15[8];
+  } test_vec[] = {
+    { { UINT16_C(41874), UINT16_C( 4409), UINT16_C( 1922), UINT16_C(21284), UINT16_C(28411), UINT16_C(19073), UINT16_C( 6415), UINT16_C(37851) },
+      { UINT16_C(28167), UINT16_C(20268), UINT16_C(50986), UINT16_C(56266), UINT16_C(35523), UINT16_C(36900), UINT16_C( 8983), UINT16_C(15113) },
+      { UINT16_C(28167), UINT16_C(20268), UINT16_C(50986), UINT16_C(56266), UINT16_C(35523), UINT16_C(36900), UINT16_C( 8983), UINT16_C(15113) },
+      { UINT16_C(33234), UINT16_C(52025), UINT16_C(51842), UINT16_C(62116), UINT16_C(45307), UINT16_C( 2305), UINT16_C(50639), UINT16_C(49755) },
+      { UINT16_C(15250), UINT16_C(24889), UINT16_C(22402), UINT16_C(21284), UINT16_C( 7931), UINT16_C( 8833), UINT16_C(47375), UINT16_C(19419) },
+      { UINT16_C(41874), UINT16_C( 4409), UINT16_C( 1922), UINT16_C(21284), UINT16_C(61179), UINT16_C(19073), UINT16_C(39183), UINT16_C(37851) } },
+    { { UINT16_C(32653), UINT16_C(30344), UINT16_C(28844), UINT16_C(21034), UINT16_C(18370), UINT16_C( 4975), UINT16_C(30185), UINT16_C(21722) },
+      { UINT16_C(34080), UINT16_C(46851), UINT16_C(43079), UINT16_C(64642), UINT16_C(29279), UINT16_C(26539), UINT16_C( 9949), UINT16_C(50617) },
+      { UINT16_C(34080), UINT16_C(46851), UINT16_C(43079), UINT16_C(64642), UINT16_C(29279), UINT16_C(26539), UINT16_C( 9949), UINT16_C(50617) },
+      { UINT16_C(18445), UINT16_C(49352), UINT16_C( 4588), UINT16_C( 8362), UINT16_C(38850), UINT16_C(60143), UINT16_C(46953), UINT16_C(28250) },
+      { UINT16_C( 1933), UINT16_C( 7816), UINT16_C(14508), UINT16_C( 4650), UINT16_C(65474), UINT16_C(23407), UINT16_C(60905), UINT16_C(52442) },
+      { UINT16_C(32653), UINT16_C(63112), UINT16_C(61612), UINT16_C(21034), UINT16_C(51138), UINT16_C(37743), UINT16_C(62953), UINT16_C(54490) } },
+    { { UINT16_C(56926), UINT16_C(16710), UINT16_C(18800), UINT16_C(26736), UINT16_C(62846), UINT16_C(35901), UINT16_C( 3372), UINT16_C(43144) },
+      { UINT16_C(55885), UINT16_C(27141), UINT16_C(63737), UINT16_C( 8345), UINT16_C( 7022), UINT16_C( 9985), UINT16_C(26305), UINT16_C(44979) },
+      { UINT16_C(55885), UINT16_C(27141), UINT16_C(63737), UINT16_C( 8345), UINT16_C( 7022), UINT16_C( 9985), UINT16_C(26305), UINT16_C(44979) },
+      { UINT16_C(37726), UINT16_C(33094), UINT16_C(15984), UINT16_C( 9840), UINT16_C(56254), UINT16_C(49277), UINT16_C(45164), UINT16_C(60616) },
+      { UINT16_C(28254), UINT16_C(10566), UINT16_C(51568), UINT16_C(51312), UINT16_C(30078), UINT16_C( 3133), UINT16_C( 3372), UINT16_C(39048) },
+      { UINT16_C(56926), UINT16_C(49478), UINT16_C(51568), UINT16_C(59504), UINT16_C(30078), UINT16_C(35901), UINT16_C(36140), UINT16_C(43144) } },
+    { { UINT16_C(25248), UINT16_C(33446), UINT16_C(24272), UINT16_C(23521), UINT16_C(26729), UINT16_C(51812), UINT16_C(30915), UINT16_C(28544) },
+      { UINT16_C(22367), UINT16_C(23281), UINT16_C(46202), UINT16_C( 6372), UINT16_C(35701), UINT16_C(49383), UINT16_C(24771), UINT16_C(60995) },
+      { UINT16_C(22367), UINT16_C(23281), UINT16_C(46202), UINT16_C( 6372), UINT16_C(35701), UINT16_C(49383), UINT16_C(24771), UINT16_C(60995) },
+      { UINT16_C(55264), UINT16_C(48230), UINT16_C( 7824), UINT16_C(14625), UINT16_C(56681), UINT16_C(14820), UINT16_C(12483), UINT16_C(37056) },
+      { UINT16_C(64160), UINT16_C(35494), UINT16_C(54992), UINT16_C( 9185), UINT16_C(43113), UINT16_C(14948), UINT16_C( 6339), UINT16_C( 8064) },
+      { UINT16_C(58016), UINT16_C(33446), UINT16_C(24272), UINT16_C(23521), UINT16_C(59497), UINT16_C(51812), UINT16_C(63683), UINT16_C(61312) } },
+    { { UINT16_C(52143), UINT16_C(22313), UINT16_C(14758), UINT16_C(38281), UINT16_C(46669), UINT16_C(13334), UINT16_C(11103), UINT16_C(61774) },
+      { UINT16_C(35629), UINT16_C(64909), UINT16_C(52050), UINT16_C(33100), UINT16_C(22964), UINT16_C(41475), UINT16_C(65264), UINT16_C(44373) },
+      { UINT16_C(35629), UINT16_C(64909), UINT16_C(52050), UINT16_C(33100), UINT16_C(22964), UINT16_C(41475), UINT16_C(65264), UINT16_C(44373) },
+      { UINT16_C(52079), UINT16_C(25449), UINT16_C(54438), UINT16_C(21257), UINT16_C(27917), UINT16_C(32982), UINT16_C(48159), UINT16_C(21838) },
+      { UINT16_C(27567), UINT16_C(28457), UINT16_C(37286), UINT16_C(25993), UINT16_C(42573), UINT16_C( 7190), UINT16_C(33631), UINT16_C(43342) },
+      { UINT16_C(52143), UINT16_C(55081), UINT16_C(14758), UINT16_C( 5513), UINT16_C(13901), UINT16_C(46102), UINT16_C(11103), UINT16_C(61774) } },
+    { { UINT16_C( 1552), UINT16_C(55419), UINT16_C(65301), UINT16_C(56762), UINT16_C(58828), UINT16_C(10010), UINT16_C(14301), UINT16_C(59769) },
+      { UINT16_C(54669), UINT16_C(32418), UINT16_C(45238), UINT16_C( 5492), UINT16_C(27705), UINT16_C(20828), UINT16_C(59031), UINT16_C( 4138) },
+      { UINT16_C(54669), UINT16_C(32418), UINT16_C(45238), UINT16_C( 5492), UINT16_C(27705), UINT16_C(20828), UINT16_C(59031), UINT16_C( 4138) },
+      { UINT16_C(25424), UINT16_C(43195), UINT16_C(11669), UINT16_C(23866), UINT16_C( 3660), UINT16_C(22298), UINT16_C(42461), UINT16_C( 2745) },
+      { UINT16_C(28176), UINT16_C( 4219), UINT16_C(46869), UINT16_C(42426), UINT16_C(52684), UINT16_C(59162), UINT16_C(49117), UINT16_C(20857) },
+      { UINT16_C(34320), UINT16_C(22651), UINT16_C(32533), UINT16_C(23994), UINT16_C(58828), UINT16_C(10010), UINT16_C(47069), UINT16_C(27001) } },
+    { { UINT16_C(57595), UINT16_C(33802), UINT16_C(18165), UINT16_C(35971), UINT16_C(52122), UINT16_C(35376), UINT16_C(52769), UINT16_C(57719) },
+      { UINT16_C(45296), UINT16_C(40352), UINT16_C(57221), UINT16_C(56903), UINT16_C(20672), UINT16_C(41235), UINT16_C( 1917), UINT16_C(48762) },
+      { UINT16_C(45296), UINT16_C(40352), UINT16_C(57221), UINT16_C(56903), UINT16_C(20672), UINT16_C(41235), UINT16_C( 1917), UINT16_C(48762) },
+      { UINT16_C(15419), UINT16_C(26634), UINT16_C(57717), UINT16_C(37315), UINT16_C(12314), UINT16_C(17648), UINT16_C(57185), UINT16_C(40631) },
+      { UINT16_C(33019), UINT16_C( 1034), UINT16_C(12021), UINT16_C(15491), UINT16_C(  922), UINT16_C(39472), UINT16_C(60961), UINT16_C(53623) },
+      { UINT16_C(24827), UINT16_C( 1034), UINT16_C(50933), UINT16_C(35971), UINT16_C(19354), UINT16_C(35376), UINT16_C(52769), UINT16_C(24951) } },
+    { { UINT16_C(34861), UINT16_C(34067), UINT16_C(30074), UINT16_C(59188), UINT16_C(26407), UINT16_C(24895), UINT16_C(32396), UINT16_C(56439) },
+      { UINT16_C(59799), UINT16_C( 8403), UINT16_C(55187), UINT16_C(60993), UINT16_C(38660), UINT16_C(16173), UINT16_C(41033), UINT16_C(26646) },
+      { UINT16_C(59799), UINT16_C( 8403), UINT16_C(55187), UINT16_C(60993), UINT16_C(38660), UINT16_C(16173), UINT16_C(41033), UINT16_C(26646) },
+      { UINT16_C(26093), UINT16_C(13523), UINT16_C(58618), UINT16_C(36980), UINT16_C(49447), UINT16_C(52095), UINT16_C( 4684), UINT16_C( 1463) },
+      { UINT16_C(47149), UINT16_C(40211), UINT16_C(40314), UINT16_C( 3892), UINT16_C(10023), UINT16_C(26943), UINT16_C(20108), UINT16_C(46199) },
+      { UINT16_C(34861), UINT16_C(34067), UINT16_C(62842), UINT16_C(59188), UINT16_C(26407), UINT16_C(57663), UINT16_C(65164), UINT16_C(23671) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+
+    simde_uint16x8_t r0 = simde_vsliq_n_u16(a, b, 0);
+    simde_uint16x8_t r6 = simde_vsliq_n_u16(a, b, 6);
+    simde_uint16x8_t r11 = simde_vsliq_n_u16(a, b, 11);
+    simde_uint16x8_t r15 = simde_vsliq_n_u16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_u16x8(r0, simde_vld1q_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x8(r6, simde_vld1q_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x8(r11, simde_vld1q_u16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_u16x8(r15, simde_vld1q_u16(test_vec[i].r15));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a = simde_test_arm_neon_random_u16x8();
+    simde_uint16x8_t b = simde_test_arm_neon_random_u16x8();
+
+    simde_uint16x8_t r0 = simde_vsliq_n_u16(a, b, 0);
+    simde_uint16x8_t r6 = simde_vsliq_n_u16(a, b, 6);
+    simde_uint16x8_t r11 = simde_vsliq_n_u16(a, b, 11);
+    simde_uint16x8_t r15 = simde_vsliq_n_u16(a, b, 15);
+
+    simde_test_arm_neon_write_u16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r15, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r0[4];
+    uint32_t r13[4];
+    uint32_t r22[4];
+    uint32_t r31[4];
+  } test_vec[] = {
+    { { UINT32_C(1807168732), UINT32_C(1399918811), UINT32_C(3777476205), UINT32_C(2694541160) },
+      { UINT32_C(1520746779), UINT32_C(3767664557), UINT32_C( 696678163), UINT32_C( 732256997) },
+      { UINT32_C(1520746779), UINT32_C(3767664557), UINT32_C( 696678163), UINT32_C( 732256997) },
+      { UINT32_C(2552460508), UINT32_C(1073066203), UINT32_C(3470947949), UINT32_C(2874978152) },
+      { UINT32_C(1190606044), UINT32_C(3950055643), UINT32_C(3303519853), UINT32_C(3109777256) },
+      { UINT32_C(3954652380), UINT32_C(3547402459), UINT32_C(3777476205), UINT32_C(2694541160) } },
+    { { UINT32_C(2537574772), UINT32_C(  59052068), UINT32_C(  86175807), UINT32_C(  27402234) },
+      { UINT32_C(2097542650), UINT32_C(2322249487), UINT32_C(1023829632), UINT32_C(3096847561) },
+      { UINT32_C(2097542650), UINT32_C(2322249487), UINT32_C(1023829632), UINT32_C(3096847561) },
+      { UINT32_C(3200209268), UINT32_C(1457647652), UINT32_C(3436187711), UINT32_C(3298377722) },
+      { UINT32_C(2122338676), UINT32_C(3284471844), UINT32_C(2686644287), UINT32_C( 845291514) },
+      { UINT32_C( 390091124), UINT32_C(2206535716), UINT32_C(  86175807), UINT32_C(2174885882) } },
+    { { UINT32_C(3095758126), UINT32_C(4091584671), UINT32_C(2470803186), UINT32_C(3548567808) },
+      { UINT32_C(1519508967), UINT32_C(2547773346), UINT32_C( 981386919), UINT32_C(2498730777) },
+      { UINT32_C(1519508967), UINT32_C(2547773346), UINT32_C( 981386919), UINT32_C(2498730777) },
+      { UINT32_C(1002235182), UINT32_C(2113159327), UINT32_C(3637835506), UINT32_C(4083366144) },
+      { UINT32_C(2042987822), UINT32_C(3902840991), UINT32_C(2848290546), UINT32_C(3326269696) },
+      { UINT32_C(3095758126), UINT32_C(1944101023), UINT32_C(2470803186), UINT32_C(3548567808) } },
+    { { UINT32_C(1599106566), UINT32_C( 982180246), UINT32_C( 531767105), UINT32_C(4000847623) },
+      { UINT32_C(2516674935), UINT32_C(1546260936), UINT32_C(2938792155), UINT32_C(3796936469) },
+      { UINT32_C(2516674935), UINT32_C(1546260936), UINT32_C(2938792155), UINT32_C(3796936469) },
+      { UINT32_C( 758050310), UINT32_C(1111032214), UINT32_C(1293647681), UINT32_C( 350402311) },
+      { UINT32_C(1573940742), UINT32_C(1913315734), UINT32_C( 921837377), UINT32_C(3312981767) },
+      { UINT32_C(3746590214), UINT32_C( 982180246), UINT32_C(2679250753), UINT32_C(4000847623) } },
+    { { UINT32_C(2862125328), UINT32_C( 597901890), UINT32_C(2329749430), UINT32_C(3746683717) },
+      { UINT32_C(3073697579), UINT32_C(3795019519), UINT32_C(4241373000), UINT32_C(  58690955) },
+      { UINT32_C(3073697579), UINT32_C(3795019519), UINT32_C(4241373000), UINT32_C(  58690955) },
+      { UINT32_C(2632282384), UINT32_C(1826611778), UINT32_C(3337160630), UINT32_C(4054940485) },
+      { UINT32_C(3403190544), UINT32_C(3219341890), UINT32_C(3525126070), UINT32_C(1657920325) },
+      { UINT32_C(2862125328), UINT32_C(2745385538), UINT32_C( 182265782), UINT32_C(3746683717) } },
+    { { UINT32_C( 871824254), UINT32_C( 682431317), UINT32_C(1519643027), UINT32_C(2479948386) },
+      { UINT32_C(2755853374), UINT32_C(4176188433), UINT32_C(1410860616), UINT32_C(2924371066) },
+      { UINT32_C(2755853374), UINT32_C(4176188433), UINT32_C(1410860616), UINT32_C(2924371066) },
+      { UINT32_C(1602739070), UINT32_C(1921135445), UINT32_C(  13175187), UINT32_C(3415163490) },
+      { UINT32_C( 263650174), UINT32_C(  74257237), UINT32_C(2450778515), UINT32_C( 512819810) },
+      { UINT32_C( 871824254), UINT32_C(2829914965), UINT32_C(1519643027), UINT32_C( 332464738) } },
+    { { UINT32_C( 392180915), UINT32_C( 168266183), UINT32_C(3758870433), UINT32_C(3171570585) },
+      { UINT32_C(3560886905), UINT32_C(1653201741), UINT32_C(1771881110), UINT32_C(2492479862) },
+      { UINT32_C(3560886905), UINT32_C(1653201741), UINT32_C(1771881110), UINT32_C(2492479862) },
+      { UINT32_C(3662623923), UINT32_C( 996780487), UINT32_C(2555563937), UINT32_C( 120509337) },
+      { UINT32_C(2657105075), UINT32_C(3544680903), UINT32_C(2777403297), UINT32_C(1569346457) },
+      { UINT32_C(2539664563), UINT32_C(2315749831), UINT32_C(1611386785), UINT32_C(1024086937) } },
+    { { UINT32_C( 127901325), UINT32_C(2404639763), UINT32_C(1099380046), UINT32_C(3673124012) },
+      { UINT32_C(2830814171), UINT32_C( 409917687), UINT32_C(2111450646), UINT32_C(1736658586) },
+      { UINT32_C(2830814171), UINT32_C( 409917687), UINT32_C(2111450646), UINT32_C(1736658586) },
+      { UINT32_C(1501265549), UINT32_C(3676234771), UINT32_C(1170396494), UINT32_C(1775455404) },
+      { UINT32_C(4141850253), UINT32_C(1037296659), UINT32_C(2240230734), UINT32_C(2796514476) },
+      { UINT32_C(2275384973), UINT32_C(2404639763), UINT32_C(1099380046), UINT32_C(1525640364) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+
+    simde_uint32x4_t r0 = simde_vsliq_n_u32(a, b, 0);
+    simde_uint32x4_t r13 = simde_vsliq_n_u32(a, b, 13);
+    simde_uint32x4_t r22 = simde_vsliq_n_u32(a, b, 22);
+    simde_uint32x4_t r31 = simde_vsliq_n_u32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_u32x4(r0, simde_vld1q_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x4(r13, simde_vld1q_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x4(r22, simde_vld1q_u32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_u32x4(r31, simde_vld1q_u32(test_vec[i].r31));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+    simde_uint32x4_t b = simde_test_arm_neon_random_u32x4();
+
+    simde_uint32x4_t r0 = simde_vsliq_n_u32(a, b, 0);
+    simde_uint32x4_t r13 = simde_vsliq_n_u32(a, b, 13);
+    simde_uint32x4_t r22 = simde_vsliq_n_u32(a, b, 22);
+    simde_uint32x4_t r31 = simde_vsliq_n_u32(a, b, 31);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r31, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsliq_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t r0[2];
+    uint64_t r19[2];
+    uint64_t r42[2];
+    uint64_t r63[2];
+  } test_vec[] = {
+    { { UINT64_C(11784425939280341565), UINT64_C(15498732801218676324) },
+      { UINT64_C( 9956490548546033427), UINT64_C( 1127883728171904880) },
+      { UINT64_C( 9956490548546033427), UINT64_C( 1127883728171904880) },
+      { UINT64_C( 8878737773857352253), UINT64_C( 7076048958279485028) },
+      { UINT64_C( 8889064377671756349), UINT64_C( 9565015991785981540) },
+      { UINT64_C(11784425939280341565), UINT64_C( 6275360764363900516) } },
+    { { UINT64_C(  660390415842983291), UINT64_C( 3544171492401420854) },
+      { UINT64_C( 3100683804210288143), UINT64_C( 6932052657264660178) },
+      { UINT64_C( 3100683804210288143), UINT64_C( 6932052657264660178) },
+      { UINT64_C(13542102075604516219), UINT64_C(14506169718296484406) },
+      { UINT64_C(  817471045033573755), UINT64_C( 4628373520272267830) },
+      { UINT64_C( 9883762452697759099), UINT64_C( 3544171492401420854) } },
+    { { UINT64_C( 1525460940616300981), UINT64_C(13568047555882692884) },
+      { UINT64_C( 1454501070689856253), UINT64_C(11416934936842007425) },
+      { UINT64_C( 1454501070689856253), UINT64_C(11416934936842007425) },
+      { UINT64_C( 7504086764201114037), UINT64_C(14893177157404504340) },
+      { UINT64_C(10640869731716495797), UINT64_C(15838605037937799444) },
+      { UINT64_C(10748832977471076789), UINT64_C(13568047555882692884) } },
+    { { UINT64_C( 9463617596986663204), UINT64_C( 8536639947151318268) },
+      { UINT64_C( 9375164491683037856), UINT64_C(17240131236497402534) },
+      { UINT64_C( 9375164491683037856), UINT64_C(17240131236497402534) },
+      { UINT64_C( 3708623016847384868), UINT64_C(   10067512145550588) },
+      { UINT64_C( 9082214605497213220), UINT64_C( 3218552892249939196) },
+      { UINT64_C(  240245560131887396), UINT64_C( 8536639947151318268) } },
+    { { UINT64_C(17946648061464167429), UINT64_C( 8020756545347278934) },
+      { UINT64_C(  385864364521294453), UINT64_C( 7304951320507941525) },
+      { UINT64_C(  385864364521294453), UINT64_C( 7304951320507941525) },
+      { UINT64_C(17060433841483564037), UINT64_C( 3760086964249319510) },
+      { UINT64_C( 1741157285906236421), UINT64_C(10811550153107855446) },
+      { UINT64_C(17946648061464167429), UINT64_C(17244128582202054742) } },
+    { { UINT64_C( 8059755292147598878), UINT64_C( 9037047818578109029) },
+      { UINT64_C( 7346812254481772759), UINT64_C(12279304504483785678) },
+      { UINT64_C( 7346812254481772759), UINT64_C(12279304504483785678) },
+      { UINT64_C(17766734595622454814), UINT64_C(15211810308930740837) },
+      { UINT64_C( 9062188839284000286), UINT64_C( 8119773646036214373) },
+      { UINT64_C(17283127329002374686), UINT64_C( 9037047818578109029) } },
+    { { UINT64_C(16713451109464820044), UINT64_C( 9963388170734480329) },
+      { UINT64_C(12261752587420626098), UINT64_C( 8888118892308397057) },
+      { UINT64_C(12261752587420626098), UINT64_C( 8888118892308397057) },
+      { UINT64_C(17877609880187193676), UINT64_C( 9823630446495083465) },
+      { UINT64_C(13525096087332997452), UINT64_C(17001093819291478985) },
+      { UINT64_C( 7490079072610044236), UINT64_C( 9963388170734480329) } },
+    { { UINT64_C(17456079817314947883), UINT64_C(  477394267632467704) },
+      { UINT64_C(12298468703161302350), UINT64_C( 6565437788457950048) },
+      { UINT64_C(12298468703161302350), UINT64_C( 6565437788457950048) },
+      { UINT64_C( 9295686375086248747), UINT64_C(17803080839383383800) },
+      { UINT64_C(13904081115505513259), UINT64_C(15667323327218351864) },
+      { UINT64_C( 8232707780460172075), UINT64_C(  477394267632467704) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+
+    simde_uint64x2_t r0 = simde_vsliq_n_u64(a, b, 0);
+    simde_uint64x2_t r19 = simde_vsliq_n_u64(a, b, 19);
+    simde_uint64x2_t r42 = simde_vsliq_n_u64(a, b, 42);
+    simde_uint64x2_t r63 = simde_vsliq_n_u64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_u64x2(r0, simde_vld1q_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x2(r19, simde_vld1q_u64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u64x2(r42, simde_vld1q_u64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_u64x2(r63, simde_vld1q_u64(test_vec[i].r63));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a = simde_test_arm_neon_random_u64x2();
+    simde_uint64x2_t b = simde_test_arm_neon_random_u64x2();
+
+    simde_uint64x2_t r0 = simde_vsliq_n_u64(a, b, 0);
+    simde_uint64x2_t r19 = simde_vsliq_n_u64(a, b, 19);
+    simde_uint64x2_t r42 = simde_vsliq_n_u64(a, b, 42);
+    simde_uint64x2_t r63 = simde_vsliq_n_u64(a, b, 63);
+
+    simde_test_arm_neon_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vslid_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vslid_n_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,197 @@
+#define SIMDE_TEST_ARM_NEON_INSN sqrt
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sqrt.h"
+
+static int
+test_simde_vsqrt_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   392.85), SIMDE_FLOAT32_C(   849.06) },
+      { SIMDE_FLOAT32_C(    19.82), SIMDE_FLOAT32_C(    29.14) } },
+    { { SIMDE_FLOAT32_C(   290.90), SIMDE_FLOAT32_C(   664.56) },
+      { SIMDE_FLOAT32_C(    17.06), SIMDE_FLOAT32_C(    25.78) } },
+    { { SIMDE_FLOAT32_C(   456.00), SIMDE_FLOAT32_C(   742.49) },
+      { SIMDE_FLOAT32_C(    21.35), SIMDE_FLOAT32_C(    27.25) } },
+    { { SIMDE_FLOAT32_C(   950.82), SIMDE_FLOAT32_C(   309.14) },
+      { SIMDE_FLOAT32_C(    30.84), SIMDE_FLOAT32_C(    17.58) } },
+    { { SIMDE_FLOAT32_C(    91.82), SIMDE_FLOAT32_C(   840.85) },
+      { SIMDE_FLOAT32_C(     9.58), SIMDE_FLOAT32_C(    29.00) } },
+    { { SIMDE_FLOAT32_C(   958.89), SIMDE_FLOAT32_C(   113.35) },
+      { SIMDE_FLOAT32_C(    30.97), SIMDE_FLOAT32_C(    10.65) } },
+    { { SIMDE_FLOAT32_C(   258.11), SIMDE_FLOAT32_C(   129.02) },
+      { SIMDE_FLOAT32_C(    16.07), SIMDE_FLOAT32_C(    11.36) } },
+    { { SIMDE_FLOAT32_C(   971.52), SIMDE_FLOAT32_C(   327.43) },
+      { SIMDE_FLOAT32_C(    31.17), SIMDE_FLOAT32_C(    18.10) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t r = simde_vsqrt_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a = simde_test_arm_neon_random_f32x2(0.0f, 1000.0f);
+    simde_float32x2_t r = simde_vsqrt_f32(a);
+
+    simde_test_arm_neon_write_f32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsqrt_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   270.01) },
+      { SIMDE_FLOAT64_C(    16.43) } },
+    { { SIMDE_FLOAT64_C(   132.88) },
+      { SIMDE_FLOAT64_C(    11.53) } },
+    { { SIMDE_FLOAT64_C(   374.68) },
+      { SIMDE_FLOAT64_C(    19.36) } },
+    { { SIMDE_FLOAT64_C(   755.92) },
+      { SIMDE_FLOAT64_C(    27.49) } },
+    { { SIMDE_FLOAT64_C(   927.47) },
+      { SIMDE_FLOAT64_C(    30.45) } },
+    { { SIMDE_FLOAT64_C(   693.15) },
+      { SIMDE_FLOAT64_C(    26.33) } },
+    { { SIMDE_FLOAT64_C(   424.43) },
+      { SIMDE_FLOAT64_C(    20.60) } },
+    { { SIMDE_FLOAT64_C(   620.05) },
+      { SIMDE_FLOAT64_C(    24.90) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t r = simde_vsqrt_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a = simde_test_arm_neon_random_f64x1(0.0, 1000.0);
+    simde_float64x1_t r = simde_vsqrt_f64(a);
+
+    simde_test_arm_neon_write_f64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsqrtq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   701.00), SIMDE_FLOAT32_C(   582.49), SIMDE_FLOAT32_C(    83.05), SIMDE_FLOAT32_C(   784.12) },
+      { SIMDE_FLOAT32_C(    26.48), SIMDE_FLOAT32_C(    24.13), SIMDE_FLOAT32_C(     9.11), SIMDE_FLOAT32_C(    28.00) } },
+    { { SIMDE_FLOAT32_C(   353.38), SIMDE_FLOAT32_C(   590.85), SIMDE_FLOAT32_C(   425.94), SIMDE_FLOAT32_C(   586.38) },
+      { SIMDE_FLOAT32_C(    18.80), SIMDE_FLOAT32_C(    24.31), SIMDE_FLOAT32_C(    20.64), SIMDE_FLOAT32_C(    24.22) } },
+    { { SIMDE_FLOAT32_C(   689.99), SIMDE_FLOAT32_C(   224.67), SIMDE_FLOAT32_C(    25.73), SIMDE_FLOAT32_C(   373.28) },
+      { SIMDE_FLOAT32_C(    26.27), SIMDE_FLOAT32_C(    14.99), SIMDE_FLOAT32_C(     5.07), SIMDE_FLOAT32_C(    19.32) } },
+    { { SIMDE_FLOAT32_C(   359.08), SIMDE_FLOAT32_C(   756.59), SIMDE_FLOAT32_C(   589.50), SIMDE_FLOAT32_C(   513.00) },
+      { SIMDE_FLOAT32_C(    18.95), SIMDE_FLOAT32_C(    27.51), SIMDE_FLOAT32_C(    24.28), SIMDE_FLOAT32_C(    22.65) } },
+    { { SIMDE_FLOAT32_C(   792.60), SIMDE_FLOAT32_C(   957.89), SIMDE_FLOAT32_C(   107.50), SIMDE_FLOAT32_C(    84.52) },
+      { SIMDE_FLOAT32_C(    28.15), SIMDE_FLOAT32_C(    30.95), SIMDE_FLOAT32_C(    10.37), SIMDE_FLOAT32_C(     9.19) } },
+    { { SIMDE_FLOAT32_C(    69.25), SIMDE_FLOAT32_C(   694.50), SIMDE_FLOAT32_C(   915.17), SIMDE_FLOAT32_C(   289.59) },
+      { SIMDE_FLOAT32_C(     8.32), SIMDE_FLOAT32_C(    26.35), SIMDE_FLOAT32_C(    30.25), SIMDE_FLOAT32_C(    17.02) } },
+    { { SIMDE_FLOAT32_C(    81.80), SIMDE_FLOAT32_C(   649.63), SIMDE_FLOAT32_C(   929.69), SIMDE_FLOAT32_C(    43.27) },
+      { SIMDE_FLOAT32_C(     9.04), SIMDE_FLOAT32_C(    25.49), SIMDE_FLOAT32_C(    30.49), SIMDE_FLOAT32_C(     6.58) } },
+    { { SIMDE_FLOAT32_C(   934.49), SIMDE_FLOAT32_C(   693.57), SIMDE_FLOAT32_C(   403.71), SIMDE_FLOAT32_C(   228.63) },
+      { SIMDE_FLOAT32_C(    30.57), SIMDE_FLOAT32_C(    26.34), SIMDE_FLOAT32_C(    20.09), SIMDE_FLOAT32_C(    15.12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t r = simde_vsqrtq_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a = simde_test_arm_neon_random_f32x4(0.0f, 1000.0f);
+    simde_float32x4_t r = simde_vsqrtq_f32(a);
+
+    simde_test_arm_neon_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsqrtq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   795.00), SIMDE_FLOAT64_C(   158.95) },
+      { SIMDE_FLOAT64_C(    28.20), SIMDE_FLOAT64_C(    12.61) } },
+    { { SIMDE_FLOAT64_C(   578.24), SIMDE_FLOAT64_C(   994.68) },
+      { SIMDE_FLOAT64_C(    24.05), SIMDE_FLOAT64_C(    31.54) } },
+    { { SIMDE_FLOAT64_C(   383.48), SIMDE_FLOAT64_C(   241.37) },
+      { SIMDE_FLOAT64_C(    19.58), SIMDE_FLOAT64_C(    15.54) } },
+    { { SIMDE_FLOAT64_C(   144.03), SIMDE_FLOAT64_C(   660.06) },
+      { SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    25.69) } },
+    { { SIMDE_FLOAT64_C(   799.14), SIMDE_FLOAT64_C(   600.09) },
+      { SIMDE_FLOAT64_C(    28.27), SIMDE_FLOAT64_C(    24.50) } },
+    { { SIMDE_FLOAT64_C(   674.03), SIMDE_FLOAT64_C(   118.68) },
+      { SIMDE_FLOAT64_C(    25.96), SIMDE_FLOAT64_C(    10.89) } },
+    { { SIMDE_FLOAT64_C(   122.46), SIMDE_FLOAT64_C(   171.69) },
+      { SIMDE_FLOAT64_C(    11.07), SIMDE_FLOAT64_C(    13.10) } },
+    { { SIMDE_FLOAT64_C(   404.95), SIMDE_FLOAT64_C(   208.55) },
+      { SIMDE_FLOAT64_C(    20.12), SIMDE_FLOAT64_C(    14.44) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t r = simde_vsqrtq_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a = simde_test_arm_neon_random_f64x2(0.0, 1000.0);
+    simde_float64x2_t r = simde_vsqrtq_f64(a);
+
+    simde_test_arm_neon_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsqrt_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsqrt_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsqrtq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsqrtq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1897 @@
+#define SIMDE_TEST_ARM_NEON_INSN sri_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sri_n.h"
+
+static int
+test_simde_vsrid_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a;
+    int64_t b;
+    int64_t r1;
+    int64_t r19;
+    int64_t r42;
+    int64_t r64;
+  } test_vec[] = {
+    { -INT64_C( 7924324646368331121),
+       INT64_C( 9059588072132968557),
+      -INT64_C( 4693578000788291530),
+      -INT64_C( 7924312555170086309),
+      -INT64_C( 7924324646367826297),
+      -INT64_C( 7924324646368331121) },
+    { -INT64_C( 6587184792610508415),
+       INT64_C( 9051525745110520980),
+      -INT64_C( 4697609164299515318),
+      -INT64_C( 6587200878055872237),
+      -INT64_C( 6587184792610052258),
+      -INT64_C( 6587184792610508415) },
+    {  INT64_C( 3347034458012382681),
+      -INT64_C( 8235754945521463025),
+       INT64_C( 5105494564094044295),
+       INT64_C( 3347038423982563808),
+       INT64_C( 3347034458013527342),
+       INT64_C( 3347034458012382681) },
+    {  INT64_C( 9086837270223014451),
+       INT64_C( 1280342807457931681),
+       INT64_C(  640171403728965840),
+       INT64_C( 9086823930838122152),
+       INT64_C( 9086837270220402988),
+       INT64_C( 9086837270223014451) },
+    { -INT64_C( 4426721835159688619),
+      -INT64_C( 8262855830860998794),
+      -INT64_C( 4131427915430499397),
+      -INT64_C( 4426737534503170200),
+      -INT64_C( 4426721835158907620),
+      -INT64_C( 4426721835159688619) },
+    {  INT64_C( 4289343975621697380),
+       INT64_C( 8655849051772642454),
+       INT64_C( 4327924525886321227),
+       INT64_C( 4289343311071363849),
+       INT64_C( 4289343975621265392),
+       INT64_C( 4289343975621697380) },
+    {  INT64_C( 1902955852971183481),
+      -INT64_C( 5336429697311956080),
+       INT64_C( 6555157188198797768),
+       INT64_C( 1902971770364680284),
+       INT64_C( 1902955852972522572),
+       INT64_C( 1902955852971183481) },
+    { -INT64_C( 4729739274083267262),
+      -INT64_C( 4256593797273846437),
+      -INT64_C( 2128296898636923219),
+      -INT64_C( 4729737705593778933),
+      -INT64_C( 4729739274080928926),
+      -INT64_C( 4729739274083267262) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r1 = simde_vsrid_n_s64(test_vec[i].a, test_vec[i].b, 1);
+    int64_t r19 = simde_vsrid_n_s64(test_vec[i].a, test_vec[i].b, 19);
+    int64_t r42 = simde_vsrid_n_s64(test_vec[i].a, test_vec[i].b, 42);
+    int64_t r64 = simde_vsrid_n_s64(test_vec[i].a, test_vec[i].b, 64);
+
+    simde_assert_equal_i64(r1, test_vec[i].r1);
+    simde_assert_equal_i64(r19, test_vec[i].r19);
+    simde_assert_equal_i64(r42, test_vec[i].r42);
+    simde_assert_equal_i64(r64, test_vec[i].r64);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t a = simde_test_codegen_random_i64();
+    int64_t b = simde_test_codegen_random_i64();
+    int64_t r1 = simde_vsrid_n_s64(a, b, 1);
+    int64_t r19 = simde_vsrid_n_s64(a, b, 19);
+    int64_t r42 = simde_vsrid_n_s64(a, b, 42);
+    int64_t r64 = simde_vsrid_n_s64(a, b, 64);
+
+    simde_test_codegen_write_i64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i64(2, r64, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsrid_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r1;
+    uint64_t r19;
+    uint64_t r42;
+    uint64_t r64;
+  } test_vec[] = {
+    { UINT64_C( 2346176007456356081),
+      UINT64_C( 9308069390040349153),
+      UINT64_C( 4654034695020174576),
+      UINT64_C( 2346182053360920641),
+      UINT64_C( 2346176007454608185),
+      UINT64_C( 2346176007456356081) },
+    { UINT64_C( 9807998076415416525),
+      UINT64_C( 8189388740477937639),
+      UINT64_C(13318066407093744627),
+      UINT64_C( 9808011183502226040),
+      UINT64_C( 9807998076413831587),
+      UINT64_C( 9807998076415416525) },
+    { UINT64_C(17892389797457103527),
+      UINT64_C( 7513033419075746284),
+      UINT64_C(12979888746392648950),
+      UINT64_C(17892393437051934772),
+      UINT64_C(17892389797458743530),
+      UINT64_C(17892389797457103527) },
+    { UINT64_C( 6135878142261388761),
+      UINT64_C(17764716913296240221),
+      UINT64_C( 8882358456648120110),
+      UINT64_C( 6135906900824107020),
+      UINT64_C( 6135878142264189500),
+      UINT64_C( 6135878142261388761) },
+    { UINT64_C( 4126769827454141489),
+      UINT64_C( 7725945624487481327),
+      UINT64_C( 3862972812243740663),
+      UINT64_C( 4126754553998840497),
+      UINT64_C( 4126769827452472836),
+      UINT64_C( 4126769827454141489) },
+    { UINT64_C(17618411116949102155),
+      UINT64_C( 6683023510895622620),
+      UINT64_C(12564883792302587118),
+      UINT64_C(17618411148477936400),
+      UINT64_C(17618411116949876663),
+      UINT64_C(17618411116949102155) },
+    { UINT64_C(15506757440538381778),
+      UINT64_C( 1968160499495583548),
+      UINT64_C(10207452286602567582),
+      UINT64_C(15506741695934987564),
+      UINT64_C(15506757440535712787),
+      UINT64_C(15506757440538381778) },
+    { UINT64_C(13512856455405964357),
+      UINT64_C(13640234919916967368),
+      UINT64_C(16043489496813259492),
+      UINT64_C(13512865592376066000),
+      UINT64_C(13512856455407948534),
+      UINT64_C(13512856455405964357) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r1 = simde_vsrid_n_u64(test_vec[i].a, test_vec[i].b, 1);
+    uint64_t r19 = simde_vsrid_n_u64(test_vec[i].a, test_vec[i].b, 19);
+    uint64_t r42 = simde_vsrid_n_u64(test_vec[i].a, test_vec[i].b, 42);
+    uint64_t r64 = simde_vsrid_n_u64(test_vec[i].a, test_vec[i].b, 64);
+
+    simde_assert_equal_u64(r1, test_vec[i].r1);
+    simde_assert_equal_u64(r19, test_vec[i].r19);
+    simde_assert_equal_u64(r42, test_vec[i].r42);
+    simde_assert_equal_u64(r64, test_vec[i].r64);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t b = simde_test_codegen_random_u64();
+    uint64_t r1 = simde_vsrid_n_u64(a, b, 1);
+    uint64_t r19 = simde_vsrid_n_u64(a, b, 19);
+    uint64_t r42 = simde_vsrid_n_u64(a, b, 42);
+    uint64_t r64 = simde_vsrid_n_u64(a, b, 64);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r64, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[8];
+    int8_t b[8];
+    int8_t r1[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r8[8];
+  } test_vec[] = {
+    { {  INT8_C(  27),  INT8_C( 107),  INT8_C(  26), -INT8_C( 122), -INT8_C(  58), -INT8_C(  15), -INT8_C(  53), -INT8_C( 112) },
+      {  INT8_C(  20),  INT8_C( 112),  INT8_C(  85), -INT8_C(  93), -INT8_C(  57),  INT8_C(  65), -INT8_C(  45),  INT8_C(  39) },
+      {  INT8_C(  10),  INT8_C(  56),  INT8_C(  42), -INT8_C(  47), -INT8_C(  29), -INT8_C(  96), -INT8_C(  23), -INT8_C( 109) },
+      {  INT8_C(   2),  INT8_C( 110),  INT8_C(  10), -INT8_C( 108), -INT8_C(  40), -INT8_C(  24), -INT8_C(  38), -INT8_C( 124) },
+      {  INT8_C(  24),  INT8_C( 107),  INT8_C(  26), -INT8_C( 123), -INT8_C(  58), -INT8_C(  14), -INT8_C(  50), -INT8_C( 111) },
+      {  INT8_C(  27),  INT8_C( 107),  INT8_C(  26), -INT8_C( 122), -INT8_C(  58), -INT8_C(  15), -INT8_C(  53), -INT8_C( 112) } },
+    { { -INT8_C(  55), -INT8_C(  80), -INT8_C(  68),  INT8_C( 117),  INT8_C(  60), -INT8_C(  92),  INT8_C(  12), -INT8_C( 107) },
+      { -INT8_C(  11), -INT8_C(  33),  INT8_C(  85),  INT8_C( 117),  INT8_C(  87),  INT8_C( 110), -INT8_C(  92),  INT8_C( 102) },
+      { -INT8_C(   6), -INT8_C(  17), -INT8_C(  86),  INT8_C(  58),  INT8_C(  43), -INT8_C(  73),  INT8_C(  82), -INT8_C(  77) },
+      { -INT8_C(  34), -INT8_C(  69), -INT8_C(  86),  INT8_C( 110),  INT8_C(  42), -INT8_C(  83),  INT8_C(  20), -INT8_C( 116) },
+      { -INT8_C(  49), -INT8_C(  74), -INT8_C(  70),  INT8_C( 115),  INT8_C(  58), -INT8_C(  93),  INT8_C(  13), -INT8_C( 109) },
+      { -INT8_C(  55), -INT8_C(  80), -INT8_C(  68),  INT8_C( 117),  INT8_C(  60), -INT8_C(  92),  INT8_C(  12), -INT8_C( 107) } },
+    { {  INT8_C(  44),  INT8_C(  88),  INT8_C(  44), -INT8_C(  16),  INT8_C(  90), -INT8_C(  56),  INT8_C(  87), -INT8_C(  28) },
+      {  INT8_C(  62), -INT8_C(  15), -INT8_C(  13),  INT8_C(  58), -INT8_C( 114), -INT8_C(  27), -INT8_C( 115), -INT8_C(  22) },
+      {  INT8_C(  31),  INT8_C( 120),  INT8_C( 121), -INT8_C(  99),  INT8_C(  71), -INT8_C(  14),  INT8_C(  70), -INT8_C(  11) },
+      {  INT8_C(  39),  INT8_C(  94),  INT8_C(  62), -INT8_C(  25),  INT8_C(  81), -INT8_C(  36),  INT8_C(  81), -INT8_C(   3) },
+      {  INT8_C(  41),  INT8_C(  95),  INT8_C(  47), -INT8_C(  15),  INT8_C(  92), -INT8_C(  49),  INT8_C(  84), -INT8_C(  25) },
+      {  INT8_C(  44),  INT8_C(  88),  INT8_C(  44), -INT8_C(  16),  INT8_C(  90), -INT8_C(  56),  INT8_C(  87), -INT8_C(  28) } },
+    { {  INT8_C( 104),  INT8_C(  94),  INT8_C(  25), -INT8_C( 114), -INT8_C(  72),      INT8_MAX, -INT8_C(  33), -INT8_C(  62) },
+      {  INT8_C(   9), -INT8_C(  52), -INT8_C(  25),  INT8_C(  42), -INT8_C(  58), -INT8_C(  48), -INT8_C( 109),  INT8_C(  79) },
+      {  INT8_C(   4),  INT8_C( 102),  INT8_C( 115), -INT8_C( 107), -INT8_C(  29),  INT8_C( 104), -INT8_C(  55), -INT8_C(  89) },
+      {  INT8_C(  97),  INT8_C(  89),  INT8_C(  28), -INT8_C( 123), -INT8_C(  72),  INT8_C( 122), -INT8_C(  46), -INT8_C(  55) },
+      {  INT8_C( 104),  INT8_C(  94),  INT8_C(  31), -INT8_C( 119), -INT8_C(  66),  INT8_C( 126), -INT8_C(  36), -INT8_C(  62) },
+      {  INT8_C( 104),  INT8_C(  94),  INT8_C(  25), -INT8_C( 114), -INT8_C(  72),      INT8_MAX, -INT8_C(  33), -INT8_C(  62) } },
+    { {  INT8_C(  56), -INT8_C(  35),  INT8_C(  64), -INT8_C(  58), -INT8_C(  71),  INT8_C(  87), -INT8_C( 120),  INT8_C(  15) },
+      {  INT8_C(  77), -INT8_C(  38),  INT8_C(  58), -INT8_C(  51), -INT8_C(  61),  INT8_C(  80), -INT8_C(  18), -INT8_C(  23) },
+      {  INT8_C(  38), -INT8_C(  19),  INT8_C(  29), -INT8_C(  26), -INT8_C(  31),  INT8_C(  40), -INT8_C(   9),  INT8_C( 116) },
+      {  INT8_C(  41), -INT8_C(  37),  INT8_C(  71), -INT8_C(  39), -INT8_C(  72),  INT8_C(  74), -INT8_C(  99),  INT8_C(  29) },
+      {  INT8_C(  58), -INT8_C(  34),  INT8_C(  65), -INT8_C(  58), -INT8_C(  66),  INT8_C(  82), -INT8_C( 113),  INT8_C(  15) },
+      {  INT8_C(  56), -INT8_C(  35),  INT8_C(  64), -INT8_C(  58), -INT8_C(  71),  INT8_C(  87), -INT8_C( 120),  INT8_C(  15) } },
+    { { -INT8_C(  82),  INT8_C(  58), -INT8_C(   3), -INT8_C( 118), -INT8_C( 113), -INT8_C(  87), -INT8_C( 114), -INT8_C(  27) },
+      { -INT8_C(  72),  INT8_C(  21),  INT8_C( 124), -INT8_C(  96),  INT8_C( 111),  INT8_C(  57), -INT8_C(  38),  INT8_C(  50) },
+      { -INT8_C(  36),  INT8_C(  10), -INT8_C(  66), -INT8_C(  48), -INT8_C(  73), -INT8_C( 100), -INT8_C(  19), -INT8_C( 103) },
+      { -INT8_C(  73),  INT8_C(  34), -INT8_C(  17), -INT8_C( 108), -INT8_C( 115), -INT8_C(  89), -INT8_C( 101), -INT8_C(  26) },
+      { -INT8_C(  83),  INT8_C(  56), -INT8_C(   5), -INT8_C( 115), -INT8_C( 117), -INT8_C(  87), -INT8_C( 114), -INT8_C(  31) },
+      { -INT8_C(  82),  INT8_C(  58), -INT8_C(   3), -INT8_C( 118), -INT8_C( 113), -INT8_C(  87), -INT8_C( 114), -INT8_C(  27) } },
+    { { -INT8_C( 110), -INT8_C(  11), -INT8_C( 121),  INT8_C(  35), -INT8_C( 107), -INT8_C(  20),  INT8_C(  92), -INT8_C(  19) },
+      { -INT8_C( 121),  INT8_C(   4), -INT8_C(  89),  INT8_C(  54), -INT8_C(  74), -INT8_C(  92), -INT8_C( 120),  INT8_C( 108) },
+      { -INT8_C(  61), -INT8_C( 126), -INT8_C(  45),  INT8_C(  27), -INT8_C(  37), -INT8_C(  46),  INT8_C(  68), -INT8_C(  74) },
+      { -INT8_C( 112), -INT8_C(  32), -INT8_C( 108),  INT8_C(  38), -INT8_C( 106), -INT8_C(  12),  INT8_C(  81), -INT8_C(  19) },
+      { -INT8_C( 108), -INT8_C(  16), -INT8_C( 123),  INT8_C(  33), -INT8_C( 107), -INT8_C(  19),  INT8_C(  92), -INT8_C(  21) },
+      { -INT8_C( 110), -INT8_C(  11), -INT8_C( 121),  INT8_C(  35), -INT8_C( 107), -INT8_C(  20),  INT8_C(  92), -INT8_C(  19) } },
+    { {  INT8_C(  99), -INT8_C(  51),  INT8_C(   9), -INT8_C( 123), -INT8_C(  18), -INT8_C( 119), -INT8_C(  72),  INT8_C( 126) },
+      { -INT8_C(  47),  INT8_C( 104),  INT8_C(  22), -INT8_C( 106), -INT8_C(  32),  INT8_C(  74), -INT8_C(  66), -INT8_C(   7) },
+      {  INT8_C( 104), -INT8_C(  76),  INT8_C(  11), -INT8_C(  53), -INT8_C(  16), -INT8_C(  91), -INT8_C(  33),  INT8_C( 124) },
+      {  INT8_C( 122), -INT8_C(  51),  INT8_C(   2), -INT8_C( 110), -INT8_C(   4), -INT8_C( 119), -INT8_C(  73),      INT8_MAX },
+      {  INT8_C( 102), -INT8_C(  53),  INT8_C(   8), -INT8_C( 124), -INT8_C(  17), -INT8_C( 118), -INT8_C(  67),      INT8_MAX },
+      {  INT8_C(  99), -INT8_C(  51),  INT8_C(   9), -INT8_C( 123), -INT8_C(  18), -INT8_C( 119), -INT8_C(  72),  INT8_C( 126) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+
+    simde_int8x8_t r1 = simde_vsri_n_s8(a, b, 1);
+    simde_int8x8_t r3 = simde_vsri_n_s8(a, b, 3);
+    simde_int8x8_t r5 = simde_vsri_n_s8(a, b, 5);
+    simde_int8x8_t r8 = simde_vsri_n_s8(a, b, 8);
+
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r8, simde_vld1_s8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x8_t a = simde_test_arm_neon_random_i8x8();
+    simde_int8x8_t b = simde_test_arm_neon_random_i8x8();
+
+    simde_int8x8_t r1 = simde_vsri_n_s8(a, b, 1);
+    simde_int8x8_t r3 = simde_vsri_n_s8(a, b, 3);
+    simde_int8x8_t r5 = simde_vsri_n_s8(a, b, 5);
+    simde_int8x8_t r8 = simde_vsri_n_s8(a, b, 8);
+
+    simde_test_arm_neon_write_i8x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t r1[4];
+    int16_t r6[4];
+    int16_t r11[4];
+    int16_t r16[4];
+  } test_vec[] = {
+    { {  INT16_C( 27879),  INT16_C( 20471), -INT16_C( 18372), -INT16_C(  9531) },
+      { -INT16_C( 29672), -INT16_C(  4955), -INT16_C( 26125), -INT16_C(  1284) },
+      {  INT16_C( 17932),  INT16_C( 30290), -INT16_C( 13063), -INT16_C(   642) },
+      {  INT16_C( 28208),  INT16_C( 20402), -INT16_C( 17817), -INT16_C(  9237) },
+      {  INT16_C( 27889),  INT16_C( 20477), -INT16_C( 18381), -INT16_C(  9505) },
+      {  INT16_C( 27879),  INT16_C( 20471), -INT16_C( 18372), -INT16_C(  9531) } },
+    { {  INT16_C( 32581),  INT16_C( 19429),  INT16_C( 29971),  INT16_C( 10544) },
+      { -INT16_C(  8858), -INT16_C( 19405),  INT16_C( 22533),  INT16_C(  8894) },
+      {  INT16_C( 28339),  INT16_C( 23065),  INT16_C( 11266),  INT16_C(  4447) },
+      {  INT16_C( 32629),  INT16_C( 19152),  INT16_C( 30048),  INT16_C( 10378) },
+      {  INT16_C( 32603),  INT16_C( 19446),  INT16_C( 29963),  INT16_C( 10532) },
+      {  INT16_C( 32581),  INT16_C( 19429),  INT16_C( 29971),  INT16_C( 10544) } },
+    { {  INT16_C(  3281),  INT16_C( 31077),  INT16_C(  2690), -INT16_C(  4295) },
+      {  INT16_C(  8266), -INT16_C( 21398), -INT16_C( 15170),  INT16_C( 18251) },
+      {  INT16_C(  4133),  INT16_C( 22069),  INT16_C( 25183), -INT16_C( 23643) },
+      {  INT16_C(  3201),  INT16_C( 31409),  INT16_C(  2834), -INT16_C(  4835) },
+      {  INT16_C(  3268),  INT16_C( 31093),  INT16_C(  2712), -INT16_C(  4312) },
+      {  INT16_C(  3281),  INT16_C( 31077),  INT16_C(  2690), -INT16_C(  4295) } },
+    { {  INT16_C(  7552), -INT16_C( 26134),  INT16_C(  9890), -INT16_C(  4407) },
+      { -INT16_C( 14334),  INT16_C( 26854), -INT16_C( 14640),  INT16_C( 31086) },
+      {  INT16_C( 25601), -INT16_C( 19341),  INT16_C( 25448), -INT16_C( 17225) },
+      {  INT16_C(  7968), -INT16_C( 26205),  INT16_C( 10011), -INT16_C(  4635) },
+      {  INT16_C(  7577), -INT16_C( 26131),  INT16_C(  9912), -INT16_C(  4401) },
+      {  INT16_C(  7552), -INT16_C( 26134),  INT16_C(  9890), -INT16_C(  4407) } },
+    { { -INT16_C( 23555), -INT16_C( 15822), -INT16_C( 16086),  INT16_C(  1148) },
+      { -INT16_C( 29850), -INT16_C( 28581), -INT16_C(  5542), -INT16_C( 22254) },
+      { -INT16_C( 14925), -INT16_C( 14291), -INT16_C(  2771),  INT16_C( 21641) },
+      { -INT16_C( 24019), -INT16_C( 15807), -INT16_C( 15447),  INT16_C(  1700) },
+      { -INT16_C( 23567), -INT16_C( 15822), -INT16_C( 16067),  INT16_C(  1141) },
+      { -INT16_C( 23555), -INT16_C( 15822), -INT16_C( 16086),  INT16_C(  1148) } },
+    { {  INT16_C( 28944),  INT16_C( 19323),  INT16_C( 11717), -INT16_C( 17606) },
+      { -INT16_C( 30489), -INT16_C( 24927),  INT16_C( 28235), -INT16_C( 12981) },
+      {  INT16_C( 17523),  INT16_C( 20304),  INT16_C( 14117), -INT16_C(  6491) },
+      {  INT16_C( 29219),  INT16_C( 19066),  INT16_C( 11705), -INT16_C( 17611) },
+      {  INT16_C( 28945),  INT16_C( 19315),  INT16_C( 11725), -INT16_C( 17607) },
+      {  INT16_C( 28944),  INT16_C( 19323),  INT16_C( 11717), -INT16_C( 17606) } },
+    { {  INT16_C( 21292),  INT16_C( 16290), -INT16_C( 12204), -INT16_C(  7736) },
+      {  INT16_C( 31705),  INT16_C( 22729), -INT16_C(  8567), -INT16_C( 11503) },
+      {  INT16_C( 15852),  INT16_C( 11364), -INT16_C(  4284), -INT16_C(  5752) },
+      {  INT16_C( 20975),  INT16_C( 15715), -INT16_C( 11398), -INT16_C(  7348) },
+      {  INT16_C( 21295),  INT16_C( 16299), -INT16_C( 12197), -INT16_C(  7718) },
+      {  INT16_C( 21292),  INT16_C( 16290), -INT16_C( 12204), -INT16_C(  7736) } },
+    { {  INT16_C( 12958), -INT16_C( 12845),  INT16_C( 20905), -INT16_C( 21771) },
+      { -INT16_C( 17855), -INT16_C( 25002), -INT16_C(  1331), -INT16_C(  2116) },
+      {  INT16_C( 23840), -INT16_C( 12501),  INT16_C( 32102), -INT16_C(  1058) },
+      {  INT16_C( 13033), -INT16_C( 12679),  INT16_C( 21483), -INT16_C( 21538) },
+      {  INT16_C( 12951), -INT16_C( 12845),  INT16_C( 20927), -INT16_C( 21762) },
+      {  INT16_C( 12958), -INT16_C( 12845),  INT16_C( 20905), -INT16_C( 21771) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+
+    simde_int16x4_t r1 = simde_vsri_n_s16(a, b, 1);
+    simde_int16x4_t r6 = simde_vsri_n_s16(a, b, 6);
+    simde_int16x4_t r11 = simde_vsri_n_s16(a, b, 11);
+    simde_int16x4_t r16 = simde_vsri_n_s16(a, b, 16);
+
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i16x4(r6, simde_vld1_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x4(r11, simde_vld1_s16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_i16x4(r16, simde_vld1_s16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x4_t a = simde_test_arm_neon_random_i16x4();
+    simde_int16x4_t b = simde_test_arm_neon_random_i16x4();
+
+    simde_int16x4_t r1 = simde_vsri_n_s16(a, b, 1);
+    simde_int16x4_t r6 = simde_vsri_n_s16(a, b, 6);
+    simde_int16x4_t r11 = simde_vsri_n_s16(a, b, 11);
+    simde_int16x4_t r16 = simde_vsri_n_s16(a, b, 16);
+
+    simde_test_arm_neon_write_i16x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t r1[2];
+    int32_t r13[2];
+    int32_t r22[2];
+    int32_t r32[2];
+  } test_vec[] = {
+    { { -INT32_C(  2077227121), -INT32_C(   278649360) },
+      { -INT32_C(   388925712), -INT32_C(   138778070) },
+      { -INT32_C(   194462856), -INT32_C(    69389035) },
+      { -INT32_C(  2076752245), -INT32_C(   278413869) },
+      { -INT32_C(  2077227101), -INT32_C(   278648866) },
+      { -INT32_C(  2077227121), -INT32_C(   278649360) } },
+    { { -INT32_C(  1096326829),  INT32_C(  1730593703) },
+      { -INT32_C(  1751295101),  INT32_C(  1545034386) },
+      { -INT32_C(   875647551),  INT32_C(   772517193) },
+      { -INT32_C(  1096499990),  INT32_C(  1730339002) },
+      { -INT32_C(  1096326562),  INT32_C(  1730593136) },
+      { -INT32_C(  1096326829),  INT32_C(  1730593703) } },
+    { {  INT32_C(  1112217495), -INT32_C(    87432425) },
+      {  INT32_C(  2094623492),  INT32_C(   321274611) },
+      {  INT32_C(  1047311746), -INT32_C(  1986846343) },
+      {  INT32_C(  1112270539), -INT32_C(    87516878) },
+      {  INT32_C(  1112217075), -INT32_C(    87433140) },
+      {  INT32_C(  1112217495), -INT32_C(    87432425) } },
+    { {  INT32_C(   189283328), -INT32_C(   171976577) },
+      { -INT32_C(  1395795756),  INT32_C(   368468659) },
+      {  INT32_C(  1449585770), -INT32_C(  1963249319) },
+      {  INT32_C(   189621870), -INT32_C(   172445773) },
+      {  INT32_C(   189284019), -INT32_C(   171976617) },
+      {  INT32_C(   189283328), -INT32_C(   171976577) } },
+    { {  INT32_C(   271728811),  INT32_C(  2041198545) },
+      {  INT32_C(   336735366), -INT32_C(  1168879338) },
+      {  INT32_C(   168367683),  INT32_C(  1563043979) },
+      {  INT32_C(   271622289),  INT32_C(  2041434786) },
+      {  INT32_C(   271728720),  INT32_C(  2041198313) },
+      {  INT32_C(   271728811),  INT32_C(  2041198545) } },
+    { { -INT32_C(   682428233),  INT32_C(  1216206961) },
+      { -INT32_C(   854384275), -INT32_C(  2009519022) },
+      { -INT32_C(   427192138),  INT32_C(  1142724137) },
+      { -INT32_C(   682202983),  INT32_C(  1216102857) },
+      { -INT32_C(   682427596),  INT32_C(  1216207392) },
+      { -INT32_C(   682428233),  INT32_C(  1216206961) } },
+    { { -INT32_C(  1360556303), -INT32_C(   104073717) },
+      { -INT32_C(    98571443),  INT32_C(   602505995) },
+      { -INT32_C(    49285722), -INT32_C(  1846230651) },
+      { -INT32_C(  1360539393), -INT32_C(   104259764) },
+      { -INT32_C(  1360556056), -INT32_C(   104074097) },
+      { -INT32_C(  1360556303), -INT32_C(   104073717) } },
+    { {  INT32_C(  1146070570),  INT32_C(   858622331) },
+      { -INT32_C(  1434026652),  INT32_C(  1724387613) },
+      {  INT32_C(  1430470322),  INT32_C(   862193806) },
+      {  INT32_C(  1145918515),  INT32_C(   858469952) },
+      {  INT32_C(  1146070698),  INT32_C(   858622363) },
+      {  INT32_C(  1146070570),  INT32_C(   858622331) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+
+    simde_int32x2_t r1 = simde_vsri_n_s32(a, b, 1);
+    simde_int32x2_t r13 = simde_vsri_n_s32(a, b, 13);
+    simde_int32x2_t r22 = simde_vsri_n_s32(a, b, 22);
+    simde_int32x2_t r32 = simde_vsri_n_s32(a, b, 32);
+
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x2(r13, simde_vld1_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x2(r22, simde_vld1_s32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_i32x2(r32, simde_vld1_s32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x2_t a = simde_test_arm_neon_random_i32x2();
+    simde_int32x2_t b = simde_test_arm_neon_random_i32x2();
+
+    simde_int32x2_t r1 = simde_vsri_n_s32(a, b, 1);
+    simde_int32x2_t r13 = simde_vsri_n_s32(a, b, 13);
+    simde_int32x2_t r22 = simde_vsri_n_s32(a, b, 22);
+    simde_int32x2_t r32 = simde_vsri_n_s32(a, b, 32);
+
+    simde_test_arm_neon_write_i32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[1];
+    int64_t b[1];
+    int64_t r1[1];
+    int64_t r19[1];
+    int64_t r42[1];
+    int64_t r64[1];
+  } test_vec[] = {
+    { { -INT64_C( 1252416370136632592) },
+      { -INT64_C( 5258963501564939542) },
+      { -INT64_C( 2629481750782469771) },
+      { -INT64_C( 1252397755178819761) },
+      { -INT64_C( 1252416370135678694) },
+      { -INT64_C( 1252416370136632592) } },
+    { { -INT64_C( 1403418216553621556) },
+      { -INT64_C( 6443378458107391907) },
+      { -INT64_C( 3221689229053695954) },
+      { -INT64_C( 1403411339276334749) },
+      { -INT64_C( 1403418216551045855) },
+      { -INT64_C( 1403418216553621556) } },
+    { { -INT64_C( 8355446037092933635) },
+      {  INT64_C( 5503519308296437871) },
+      { -INT64_C( 6471612382706556873) },
+      { -INT64_C( 8355468633409528528) },
+      { -INT64_C( 8355446037093869541) },
+      { -INT64_C( 8355446037092933635) } },
+    { {  INT64_C( 7752924988617578710) },
+      {  INT64_C( 8643712851787591843) },
+      {  INT64_C( 4321856425893795921) },
+      {  INT64_C( 7752928060720110312) },
+      {  INT64_C( 7752924988618702120) },
+      {  INT64_C( 7752924988617578710) } },
+    { {  INT64_C( 2334325030438956697) },
+      { -INT64_C( 7193735364691858412) },
+      {  INT64_C( 5626504354508846602) },
+      {  INT64_C( 2334328629644335212) },
+      {  INT64_C( 2334325030439553709) },
+      {  INT64_C( 2334325030438956697) } },
+    { { -INT64_C( 2956877586695288943) },
+      { -INT64_C( 8681495410468364898) },
+      { -INT64_C( 4340747705234182449) },
+      { -INT64_C( 2956876004611754373) },
+      { -INT64_C( 2956877586696642232) },
+      { -INT64_C( 2956877586695288943) } },
+    { {  INT64_C( 2360628175279357167) },
+      { -INT64_C( 1422602365264520490) },
+      {  INT64_C( 8512070854222515563) },
+      {  INT64_C( 2360657547529417784) },
+      {  INT64_C( 2360628175282311289) },
+      {  INT64_C( 2360628175279357167) } },
+    { { -INT64_C( 4497917203168144037) },
+      {  INT64_C( 7523182719577630508) },
+      { -INT64_C( 5461780677065960554) },
+      { -INT64_C( 4497920594131919463) },
+      { -INT64_C( 4497917203167176211) },
+      { -INT64_C( 4497917203168144037) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t a = simde_vld1_s64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+
+    simde_int64x1_t r1 = simde_vsri_n_s64(a, b, 1);
+    simde_int64x1_t r19 = simde_vsri_n_s64(a, b, 19);
+    simde_int64x1_t r42 = simde_vsri_n_s64(a, b, 42);
+    simde_int64x1_t r64 = simde_vsri_n_s64(a, b, 64);
+
+    simde_test_arm_neon_assert_equal_i64x1(r1, simde_vld1_s64(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i64x1(r19, simde_vld1_s64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i64x1(r42, simde_vld1_s64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_i64x1(r64, simde_vld1_s64(test_vec[i].r64));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x1_t a = simde_test_arm_neon_random_i64x1();
+    simde_int64x1_t b = simde_test_arm_neon_random_i64x1();
+
+    simde_int64x1_t r1 = simde_vsri_n_s64(a, b, 1);
+    simde_int64x1_t r19 = simde_vsri_n_s64(a, b, 19);
+    simde_int64x1_t r42 = simde_vsri_n_s64(a, b, 42);
+    simde_int64x1_t r64 = simde_vsri_n_s64(a, b, 64);
+
+    simde_test_arm_neon_write_i64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x1(2, r64, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[8];
+    uint8_t b[8];
+    uint8_t r1[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r8[8];
+  } test_vec[] = {
+    { { UINT8_C( 11), UINT8_C(220), UINT8_C( 73), UINT8_C(156), UINT8_C(165), UINT8_C(165), UINT8_C(124), UINT8_C(230) },
+      { UINT8_C( 35), UINT8_C(176), UINT8_C(136), UINT8_C(153), UINT8_C(118), UINT8_C( 65), UINT8_C( 12), UINT8_C( 35) },
+      { UINT8_C( 17), UINT8_C(216), UINT8_C( 68), UINT8_C(204), UINT8_C(187), UINT8_C(160), UINT8_C(  6), UINT8_C(145) },
+      { UINT8_C(  4), UINT8_C(214), UINT8_C( 81), UINT8_C(147), UINT8_C(174), UINT8_C(168), UINT8_C( 97), UINT8_C(228) },
+      { UINT8_C(  9), UINT8_C(221), UINT8_C( 76), UINT8_C(156), UINT8_C(163), UINT8_C(162), UINT8_C(120), UINT8_C(225) },
+      { UINT8_C( 11), UINT8_C(220), UINT8_C( 73), UINT8_C(156), UINT8_C(165), UINT8_C(165), UINT8_C(124), UINT8_C(230) } },
+    { { UINT8_C(108), UINT8_C(146), UINT8_C(212), UINT8_C(131), UINT8_C( 43), UINT8_C(208), UINT8_C(213), UINT8_C( 37) },
+      { UINT8_C( 21), UINT8_C(205), UINT8_C(119), UINT8_C(204), UINT8_C(141), UINT8_C( 56), UINT8_C( 59), UINT8_C(180) },
+      { UINT8_C( 10), UINT8_C(230), UINT8_C(187), UINT8_C(230), UINT8_C( 70), UINT8_C(156), UINT8_C(157), UINT8_C( 90) },
+      { UINT8_C( 98), UINT8_C(153), UINT8_C(206), UINT8_C(153), UINT8_C( 49), UINT8_C(199), UINT8_C(199), UINT8_C( 54) },
+      { UINT8_C(104), UINT8_C(150), UINT8_C(211), UINT8_C(134), UINT8_C( 44), UINT8_C(209), UINT8_C(209), UINT8_C( 37) },
+      { UINT8_C(108), UINT8_C(146), UINT8_C(212), UINT8_C(131), UINT8_C( 43), UINT8_C(208), UINT8_C(213), UINT8_C( 37) } },
+    { { UINT8_C(151), UINT8_C(224), UINT8_C(168), UINT8_C(126), UINT8_C( 62), UINT8_C(127), UINT8_C( 16), UINT8_C(239) },
+      { UINT8_C(223), UINT8_C(126), UINT8_C(119), UINT8_C(234), UINT8_C(  7), UINT8_C(224), UINT8_C(249), UINT8_C(230) },
+      { UINT8_C(239), UINT8_C(191), UINT8_C(187), UINT8_C(117), UINT8_C(  3), UINT8_C(112), UINT8_C(124), UINT8_C(243) },
+      { UINT8_C(155), UINT8_C(239), UINT8_C(174), UINT8_C(125), UINT8_C( 32), UINT8_C(124), UINT8_C( 31), UINT8_C(252) },
+      { UINT8_C(150), UINT8_C(227), UINT8_C(171), UINT8_C(127), UINT8_C( 56), UINT8_C(127), UINT8_C( 23), UINT8_C(239) },
+      { UINT8_C(151), UINT8_C(224), UINT8_C(168), UINT8_C(126), UINT8_C( 62), UINT8_C(127), UINT8_C( 16), UINT8_C(239) } },
+    { { UINT8_C(  7), UINT8_C(155), UINT8_C( 86), UINT8_C( 86), UINT8_C( 39), UINT8_C( 65), UINT8_C( 39), UINT8_C(213) },
+      { UINT8_C(229), UINT8_C(128), UINT8_C(116), UINT8_C(183), UINT8_C(  7), UINT8_C( 12), UINT8_C(200), UINT8_C(128) },
+      { UINT8_C(114), UINT8_C(192), UINT8_C( 58), UINT8_C( 91), UINT8_C(  3), UINT8_C(  6), UINT8_C(100), UINT8_C(192) },
+      { UINT8_C( 28), UINT8_C(144), UINT8_C( 78), UINT8_C( 86), UINT8_C( 32), UINT8_C( 65), UINT8_C( 57), UINT8_C(208) },
+      { UINT8_C(  7), UINT8_C(156), UINT8_C( 83), UINT8_C( 85), UINT8_C( 32), UINT8_C( 64), UINT8_C( 38), UINT8_C(212) },
+      { UINT8_C(  7), UINT8_C(155), UINT8_C( 86), UINT8_C( 86), UINT8_C( 39), UINT8_C( 65), UINT8_C( 39), UINT8_C(213) } },
+    { { UINT8_C(146), UINT8_C( 80), UINT8_C( 34), UINT8_C( 29), UINT8_C(241), UINT8_C( 39), UINT8_C(225), UINT8_C(196) },
+      { UINT8_C( 61), UINT8_C(134), UINT8_C(165), UINT8_C(141), UINT8_C(194), UINT8_C(  3), UINT8_C(129), UINT8_C(193) },
+      { UINT8_C(158), UINT8_C( 67), UINT8_C( 82), UINT8_C( 70), UINT8_C(225), UINT8_C(  1), UINT8_C(192), UINT8_C(224) },
+      { UINT8_C(135), UINT8_C( 80), UINT8_C( 52), UINT8_C( 17), UINT8_C(248), UINT8_C( 32), UINT8_C(240), UINT8_C(216) },
+      { UINT8_C(145), UINT8_C( 84), UINT8_C( 37), UINT8_C( 28), UINT8_C(246), UINT8_C( 32), UINT8_C(228), UINT8_C(198) },
+      { UINT8_C(146), UINT8_C( 80), UINT8_C( 34), UINT8_C( 29), UINT8_C(241), UINT8_C( 39), UINT8_C(225), UINT8_C(196) } },
+    { { UINT8_C(112), UINT8_C( 65), UINT8_C( 82), UINT8_C( 73), UINT8_C(237), UINT8_C(234), UINT8_C( 43), UINT8_C(114) },
+      { UINT8_C(239), UINT8_C( 44), UINT8_C( 75), UINT8_C(197), UINT8_C( 97), UINT8_C(151), UINT8_C(250), UINT8_C( 53) },
+      { UINT8_C(119), UINT8_C( 22), UINT8_C( 37), UINT8_C( 98), UINT8_C(176), UINT8_C(203), UINT8_C(125), UINT8_C( 26) },
+      { UINT8_C(125), UINT8_C( 69), UINT8_C( 73), UINT8_C( 88), UINT8_C(236), UINT8_C(242), UINT8_C( 63), UINT8_C(102) },
+      { UINT8_C(119), UINT8_C( 65), UINT8_C( 82), UINT8_C( 78), UINT8_C(235), UINT8_C(236), UINT8_C( 47), UINT8_C(113) },
+      { UINT8_C(112), UINT8_C( 65), UINT8_C( 82), UINT8_C( 73), UINT8_C(237), UINT8_C(234), UINT8_C( 43), UINT8_C(114) } },
+    { { UINT8_C( 79), UINT8_C(134), UINT8_C(164), UINT8_C(170), UINT8_C(104), UINT8_C(117), UINT8_C(165), UINT8_C( 64) },
+      { UINT8_C(191), UINT8_C(138), UINT8_C( 21), UINT8_C( 30), UINT8_C( 60), UINT8_C( 32), UINT8_C( 86), UINT8_C(172) },
+      { UINT8_C( 95), UINT8_C(197), UINT8_C(138), UINT8_C(143), UINT8_C( 30), UINT8_C( 16), UINT8_C(171), UINT8_C( 86) },
+      { UINT8_C( 87), UINT8_C(145), UINT8_C(162), UINT8_C(163), UINT8_C(103), UINT8_C(100), UINT8_C(170), UINT8_C( 85) },
+      { UINT8_C( 77), UINT8_C(132), UINT8_C(160), UINT8_C(168), UINT8_C(105), UINT8_C(113), UINT8_C(162), UINT8_C( 69) },
+      { UINT8_C( 79), UINT8_C(134), UINT8_C(164), UINT8_C(170), UINT8_C(104), UINT8_C(117), UINT8_C(165), UINT8_C( 64) } },
+    { { UINT8_C( 95), UINT8_C( 66), UINT8_C(243), UINT8_C(150), UINT8_C( 82), UINT8_C( 22), UINT8_C( 71), UINT8_C(244) },
+      { UINT8_C(167), UINT8_C( 94), UINT8_C(167), UINT8_C( 25), UINT8_C(104), UINT8_C( 36), UINT8_C( 26), UINT8_C(194) },
+      { UINT8_C( 83), UINT8_C( 47), UINT8_C(211), UINT8_C(140), UINT8_C( 52), UINT8_C( 18), UINT8_C( 13), UINT8_C(225) },
+      { UINT8_C( 84), UINT8_C( 75), UINT8_C(244), UINT8_C(131), UINT8_C( 77), UINT8_C(  4), UINT8_C( 67), UINT8_C(248) },
+      { UINT8_C( 93), UINT8_C( 66), UINT8_C(245), UINT8_C(144), UINT8_C( 83), UINT8_C( 17), UINT8_C( 64), UINT8_C(246) },
+      { UINT8_C( 95), UINT8_C( 66), UINT8_C(243), UINT8_C(150), UINT8_C( 82), UINT8_C( 22), UINT8_C( 71), UINT8_C(244) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+
+    simde_uint8x8_t r1 = simde_vsri_n_u8(a, b, 1);
+    simde_uint8x8_t r3 = simde_vsri_n_u8(a, b, 3);
+    simde_uint8x8_t r5 = simde_vsri_n_u8(a, b, 5);
+    simde_uint8x8_t r8 = simde_vsri_n_u8(a, b, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r8, simde_vld1_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x8_t a = simde_test_arm_neon_random_u8x8();
+    simde_uint8x8_t b = simde_test_arm_neon_random_u8x8();
+
+    simde_uint8x8_t r1 = simde_vsri_n_u8(a, b, 1);
+    simde_uint8x8_t r3 = simde_vsri_n_u8(a, b, 3);
+    simde_uint8x8_t r5 = simde_vsri_n_u8(a, b, 5);
+    simde_uint8x8_t r8 = simde_vsri_n_u8(a, b, 8);
+
+    simde_test_arm_neon_write_u8x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x8(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[4];
+    uint16_t b[4];
+    uint16_t r1[4];
+    uint16_t r6[4];
+    uint16_t r11[4];
+    uint16_t r16[4];
+  } test_vec[] = {
+    { { UINT16_C(63390), UINT16_C( 7551), UINT16_C(30507), UINT16_C(62541) },
+      { UINT16_C(46959), UINT16_C(52460), UINT16_C(11236), UINT16_C(31969) },
+      { UINT16_C(56247), UINT16_C(26230), UINT16_C( 5618), UINT16_C(48752) },
+      { UINT16_C(63197), UINT16_C( 7987), UINT16_C(29871), UINT16_C(62963) },
+      { UINT16_C(63382), UINT16_C( 7545), UINT16_C(30501), UINT16_C(62543) },
+      { UINT16_C(63390), UINT16_C( 7551), UINT16_C(30507), UINT16_C(62541) } },
+    { { UINT16_C(  200), UINT16_C(48806), UINT16_C(48283), UINT16_C(45407) },
+      { UINT16_C(38871), UINT16_C(51479), UINT16_C( 3151), UINT16_C(13802) },
+      { UINT16_C(19435), UINT16_C(58507), UINT16_C(34343), UINT16_C(39669) },
+      { UINT16_C(  607), UINT16_C(48932), UINT16_C(48177), UINT16_C(45271) },
+      { UINT16_C(  210), UINT16_C(48825), UINT16_C(48257), UINT16_C(45382) },
+      { UINT16_C(  200), UINT16_C(48806), UINT16_C(48283), UINT16_C(45407) } },
+    { { UINT16_C(57683), UINT16_C(39889), UINT16_C(62842), UINT16_C(42113) },
+      { UINT16_C(32850), UINT16_C(  538), UINT16_C(53665), UINT16_C(44323) },
+      { UINT16_C(49193), UINT16_C(33037), UINT16_C(59600), UINT16_C(54929) },
+      { UINT16_C(57857), UINT16_C(38920), UINT16_C(63302), UINT16_C(42676) },
+      { UINT16_C(57680), UINT16_C(39872), UINT16_C(62842), UINT16_C(42133) },
+      { UINT16_C(57683), UINT16_C(39889), UINT16_C(62842), UINT16_C(42113) } },
+    { { UINT16_C(39647), UINT16_C(54750), UINT16_C(46379), UINT16_C(15695) },
+      { UINT16_C(12414), UINT16_C(59184), UINT16_C(65313), UINT16_C(30088) },
+      { UINT16_C(38975), UINT16_C(62360), UINT16_C(65424), UINT16_C(15044) },
+      { UINT16_C(39105), UINT16_C(55196), UINT16_C(47100), UINT16_C(15830) },
+      { UINT16_C(39622), UINT16_C(54748), UINT16_C(46399), UINT16_C(15694) },
+      { UINT16_C(39647), UINT16_C(54750), UINT16_C(46379), UINT16_C(15695) } },
+    { { UINT16_C(43610), UINT16_C(17688), UINT16_C(61088), UINT16_C(39378) },
+      { UINT16_C( 1965), UINT16_C(19484), UINT16_C(17831), UINT16_C(26047) },
+      { UINT16_C(33750), UINT16_C( 9742), UINT16_C(41683), UINT16_C(45791) },
+      { UINT16_C(43038), UINT16_C(17712), UINT16_C(60694), UINT16_C(39318) },
+      { UINT16_C(43584), UINT16_C(17673), UINT16_C(61096), UINT16_C(39372) },
+      { UINT16_C(43610), UINT16_C(17688), UINT16_C(61088), UINT16_C(39378) } },
+    { { UINT16_C(10925), UINT16_C(64664), UINT16_C(51989), UINT16_C(55193) },
+      { UINT16_C(51300), UINT16_C(41739), UINT16_C( 3975), UINT16_C(46597) },
+      { UINT16_C(25650), UINT16_C(53637), UINT16_C(34755), UINT16_C(56066) },
+      { UINT16_C(11041), UINT16_C(65164), UINT16_C(51262), UINT16_C(55000) },
+      { UINT16_C(10937), UINT16_C(64660), UINT16_C(51969), UINT16_C(55190) },
+      { UINT16_C(10925), UINT16_C(64664), UINT16_C(51989), UINT16_C(55193) } },
+    { { UINT16_C( 2142), UINT16_C(57442), UINT16_C(64098), UINT16_C(42163) },
+      { UINT16_C(59634), UINT16_C(35984), UINT16_C(63903), UINT16_C(  219) },
+      { UINT16_C(29817), UINT16_C(50760), UINT16_C(64719), UINT16_C(32877) },
+      { UINT16_C( 2979), UINT16_C(57906), UINT16_C(64486), UINT16_C(41987) },
+      { UINT16_C( 2141), UINT16_C(57457), UINT16_C(64127), UINT16_C(42144) },
+      { UINT16_C( 2142), UINT16_C(57442), UINT16_C(64098), UINT16_C(42163) } },
+    { { UINT16_C(21150), UINT16_C(18424), UINT16_C(63774), UINT16_C(25516) },
+      { UINT16_C(24812), UINT16_C(65209), UINT16_C( 8209), UINT16_C(45430) },
+      { UINT16_C(12406), UINT16_C(32604), UINT16_C(36872), UINT16_C(22715) },
+      { UINT16_C(20867), UINT16_C(18426), UINT16_C(63616), UINT16_C(25285) },
+      { UINT16_C(21132), UINT16_C(18431), UINT16_C(63748), UINT16_C(25526) },
+      { UINT16_C(21150), UINT16_C(18424), UINT16_C(63774), UINT16_C(25516) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t a = simde_vld1_u16(test_vec[i].a);
+    simde_uint16x4_t b = simde_vld1_u16(test_vec[i].b);
+
+    simde_uint16x4_t r1 = simde_vsri_n_u16(a, b, 1);
+    simde_uint16x4_t r6 = simde_vsri_n_u16(a, b, 6);
+    simde_uint16x4_t r11 = simde_vsri_n_u16(a, b, 11);
+    simde_uint16x4_t r16 = simde_vsri_n_u16(a, b, 16);
+
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x4(r6, simde_vld1_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x4(r11, simde_vld1_u16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_u16x4(r16, simde_vld1_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x4_t a = simde_test_arm_neon_random_u16x4();
+    simde_uint16x4_t b = simde_test_arm_neon_random_u16x4();
+
+    simde_uint16x4_t r1 = simde_vsri_n_u16(a, b, 1);
+    simde_uint16x4_t r6 = simde_vsri_n_u16(a, b, 6);
+    simde_uint16x4_t r11 = simde_vsri_n_u16(a, b, 11);
+    simde_uint16x4_t r16 = simde_vsri_n_u16(a, b, 16);
+
+    simde_test_arm_neon_write_u16x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[2];
+    uint32_t b[2];
+    uint32_t r1[2];
+    uint32_t r13[2];
+    uint32_t r22[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    { { UINT32_C(1831943238), UINT32_C( 577560207) },
+      { UINT32_C(3968548221), UINT32_C(4215112601) },
+      { UINT32_C(1984274110), UINT32_C(2107556300) },
+      { UINT32_C(1832346713), UINT32_C( 577755628) },
+      { UINT32_C(1831944114), UINT32_C( 577560556) },
+      { UINT32_C(1831943238), UINT32_C( 577560207) } },
+    { { UINT32_C( 751060302), UINT32_C(3841678678) },
+      { UINT32_C(2811345722), UINT32_C( 928764922) },
+      { UINT32_C(1405672861), UINT32_C(2611866109) },
+      { UINT32_C( 751123597), UINT32_C(3841571550) },
+      { UINT32_C( 751060638), UINT32_C(3841678557) },
+      { UINT32_C( 751060302), UINT32_C(3841678678) } },
+    { { UINT32_C(1894499929), UINT32_C(1861683577) },
+      { UINT32_C(3649472678), UINT32_C(1405169463) },
+      { UINT32_C(1824736339), UINT32_C( 702584731) },
+      { UINT32_C(1894698036), UINT32_C(1861393929) },
+      { UINT32_C(1894500198), UINT32_C(1861683535) },
+      { UINT32_C(1894499929), UINT32_C(1861683577) } },
+    { { UINT32_C(  41007919), UINT32_C( 805693071) },
+      { UINT32_C(1581934252), UINT32_C(1624761227) },
+      { UINT32_C( 790967126), UINT32_C( 812380613) },
+      { UINT32_C(  41087571), UINT32_C( 805504703) },
+      { UINT32_C(  41007481), UINT32_C( 805692803) },
+      { UINT32_C(  41007919), UINT32_C( 805693071) } },
+    { { UINT32_C(2024564008), UINT32_C(2704920572) },
+      { UINT32_C( 122309933), UINT32_C(  72132126) },
+      { UINT32_C(  61154966), UINT32_C(2183549711) },
+      { UINT32_C(2024290898), UINT32_C(2704810597) },
+      { UINT32_C(2024563741), UINT32_C(2704919569) },
+      { UINT32_C(2024564008), UINT32_C(2704920572) } },
+    { { UINT32_C(3468335217), UINT32_C(2621871721) },
+      { UINT32_C(3845274144), UINT32_C( 269123574) },
+      { UINT32_C(4070120720), UINT32_C(2282045435) },
+      { UINT32_C(3468634513), UINT32_C(2621472851) },
+      { UINT32_C(3468336020), UINT32_C(2621871168) },
+      { UINT32_C(3468335217), UINT32_C(2621871721) } },
+    { { UINT32_C(2507741973), UINT32_C(3783252844) },
+      { UINT32_C(1075357383), UINT32_C(1930037472) },
+      { UINT32_C(2685162339), UINT32_C(3112502384) },
+      { UINT32_C(2507800773), UINT32_C(3782973520) },
+      { UINT32_C(2507741440), UINT32_C(3783252428) },
+      { UINT32_C(2507741973), UINT32_C(3783252844) } },
+    { { UINT32_C(2060623049), UINT32_C( 579494434) },
+      { UINT32_C(3074508434), UINT32_C(2195917460) },
+      { UINT32_C(1537254217), UINT32_C(1097958730) },
+      { UINT32_C(2060827146), UINT32_C( 579606296) },
+      { UINT32_C(2060623581), UINT32_C( 579494411) },
+      { UINT32_C(2060623049), UINT32_C( 579494434) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t b = simde_vld1_u32(test_vec[i].b);
+
+    simde_uint32x2_t r1 = simde_vsri_n_u32(a, b, 1);
+    simde_uint32x2_t r13 = simde_vsri_n_u32(a, b, 13);
+    simde_uint32x2_t r22 = simde_vsri_n_u32(a, b, 22);
+    simde_uint32x2_t r32 = simde_vsri_n_u32(a, b, 32);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r13, simde_vld1_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x2(r22, simde_vld1_u32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x2_t a = simde_test_arm_neon_random_u32x2();
+    simde_uint32x2_t b = simde_test_arm_neon_random_u32x2();
+
+    simde_uint32x2_t r1 = simde_vsri_n_u32(a, b, 1);
+    simde_uint32x2_t r13 = simde_vsri_n_u32(a, b, 13);
+    simde_uint32x2_t r22 = simde_vsri_n_u32(a, b, 22);
+    simde_uint32x2_t r32 = simde_vsri_n_u32(a, b, 32);
+
+    simde_test_arm_neon_write_u32x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x2(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsri_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[1];
+    uint64_t b[1];
+    uint64_t r1[1];
+    uint64_t r19[1];
+    uint64_t r42[1];
+    uint64_t r64[1];
+  } test_vec[] = {
+    { { UINT64_C(12832307344522830999) },
+      { UINT64_C(15150749996640596111) },
+      { UINT64_C(16798747035175073863) },
+      { UINT64_C(12832332348512743888) },
+      { UINT64_C(12832307344523432081) },
+      { UINT64_C(12832307344522830999) } },
+    { { UINT64_C(14919889749058959396) },
+      { UINT64_C(17518426194337713222) },
+      { UINT64_C(17982585134023632419) },
+      { UINT64_C(14919896029271282732) },
+      { UINT64_C(14919889749060405116) },
+      { UINT64_C(14919889749058959396) } },
+    { { UINT64_C( 5490490779400379587) },
+      { UINT64_C( 5844067231004444174) },
+      { UINT64_C( 2922033615502222087) },
+      { UINT64_C( 5490497226763787888) },
+      { UINT64_C( 5490490779398063763) },
+      { UINT64_C( 5490490779400379587) } },
+    { { UINT64_C(13411691535146332978) },
+      { UINT64_C( 9975137945271348952) },
+      { UINT64_C(14210941009490450284) },
+      { UINT64_C(13411703532002970285) },
+      { UINT64_C(13411691535148424115) },
+      { UINT64_C(13411691535146332978) } },
+    { { UINT64_C( 4518063150550252006) },
+      { UINT64_C(17860448968714754772) },
+      { UINT64_C( 8930224484357377386) },
+      { UINT64_C( 4518094470401927847) },
+      { UINT64_C( 4518063150552971075) },
+      { UINT64_C( 4518063150550252006) } },
+    { { UINT64_C( 3142387316863883713) },
+      { UINT64_C( 8144244703115757844) },
+      { UINT64_C( 4072122351557878922) },
+      { UINT64_C( 3142402173911763362) },
+      { UINT64_C( 3142387316863811978) },
+      { UINT64_C( 3142387316863883713) } },
+    { { UINT64_C(15678421831930275721) },
+      { UINT64_C( 6823624152776331015) },
+      { UINT64_C(12635184113242941315) },
+      { UINT64_C(15678415508418359648) },
+      { UINT64_C(15678421831928753304) },
+      { UINT64_C(15678421831930275721) } },
+    { { UINT64_C( 7668928237817819268) },
+      { UINT64_C(15719394528220855793) },
+      { UINT64_C( 7859697264110427896) },
+      { UINT64_C( 7668956460335840090) },
+      { UINT64_C( 7668928237819824544) },
+      { UINT64_C( 7668928237817819268) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t a = simde_vld1_u64(test_vec[i].a);
+    simde_uint64x1_t b = simde_vld1_u64(test_vec[i].b);
+
+    simde_uint64x1_t r1 = simde_vsri_n_u64(a, b, 1);
+    simde_uint64x1_t r19 = simde_vsri_n_u64(a, b, 19);
+    simde_uint64x1_t r42 = simde_vsri_n_u64(a, b, 42);
+    simde_uint64x1_t r64 = simde_vsri_n_u64(a, b, 64);
+
+    simde_test_arm_neon_assert_equal_u64x1(r1, simde_vld1_u64(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u64x1(r19, simde_vld1_u64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u64x1(r42, simde_vld1_u64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_u64x1(r64, simde_vld1_u64(test_vec[i].r64));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x1_t a = simde_test_arm_neon_random_u64x1();
+    simde_uint64x1_t b = simde_test_arm_neon_random_u64x1();
+
+    simde_uint64x1_t r1 = simde_vsri_n_u64(a, b, 1);
+    simde_uint64x1_t r19 = simde_vsri_n_u64(a, b, 19);
+    simde_uint64x1_t r42 = simde_vsri_n_u64(a, b, 42);
+    simde_uint64x1_t r64 = simde_vsri_n_u64(a, b, 64);
+
+    simde_test_arm_neon_write_u64x1(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x1(2, r64, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r1[16];
+    int8_t r3[16];
+    int8_t r5[16];
+    int8_t r8[16];
+  } test_vec[] = {
+    { { -INT8_C(  75), -INT8_C( 120), -INT8_C(  98), -INT8_C(  33), -INT8_C(  75), -INT8_C(  80), -INT8_C(  39),  INT8_C(  45),
+         INT8_C(  69), -INT8_C(  97),  INT8_C( 100), -INT8_C(  21),  INT8_C(  68),  INT8_C( 105),  INT8_C(  18),  INT8_C( 114) },
+      {  INT8_C( 103), -INT8_C(  43),  INT8_C(  19), -INT8_C(  34), -INT8_C(   5),  INT8_C( 112),  INT8_C(  80), -INT8_C(  10),
+         INT8_C(  74),  INT8_C(  85), -INT8_C( 119),  INT8_C(  21),  INT8_C( 110),  INT8_C(  59), -INT8_C( 119), -INT8_C( 117) },
+      { -INT8_C(  77), -INT8_C(  22), -INT8_C( 119), -INT8_C(  17), -INT8_C(   3), -INT8_C(  72), -INT8_C(  88),  INT8_C( 123),
+         INT8_C(  37), -INT8_C(  86),  INT8_C(  68), -INT8_C( 118),  INT8_C(  55),  INT8_C(  29),  INT8_C(  68),  INT8_C(  69) },
+      { -INT8_C(  84), -INT8_C( 102), -INT8_C( 126), -INT8_C(  37), -INT8_C(  65), -INT8_C(  82), -INT8_C(  54),  INT8_C(  62),
+         INT8_C(  73), -INT8_C( 118),  INT8_C( 113), -INT8_C(  30),  INT8_C(  77),  INT8_C( 103),  INT8_C(  17),  INT8_C( 113) },
+      { -INT8_C(  77), -INT8_C( 114), -INT8_C( 104), -INT8_C(  34), -INT8_C(  73), -INT8_C(  77), -INT8_C(  38),  INT8_C(  47),
+         INT8_C(  66), -INT8_C( 102),  INT8_C( 100), -INT8_C(  24),  INT8_C(  67),  INT8_C( 105),  INT8_C(  20),  INT8_C( 116) },
+      { -INT8_C(  75), -INT8_C( 120), -INT8_C(  98), -INT8_C(  33), -INT8_C(  75), -INT8_C(  80), -INT8_C(  39),  INT8_C(  45),
+         INT8_C(  69), -INT8_C(  97),  INT8_C( 100), -INT8_C(  21),  INT8_C(  68),  INT8_C( 105),  INT8_C(  18),  INT8_C( 114) } },
+    { {  INT8_C(   1), -INT8_C(  33),  INT8_C(  20), -INT8_C(  21), -INT8_C(  96), -INT8_C(  34),  INT8_C( 106),  INT8_C( 108),
+        -INT8_C( 118),  INT8_C(   7),  INT8_C(  62), -INT8_C(  58), -INT8_C(  20), -INT8_C(  40), -INT8_C(  32),  INT8_C(  61) },
+      { -INT8_C(  16), -INT8_C(  65), -INT8_C(  71),  INT8_C( 117),  INT8_C(  10), -INT8_C(  27),  INT8_C( 104),  INT8_C(   1),
+         INT8_C( 103),  INT8_C(  28), -INT8_C(  55),  INT8_C(  98),  INT8_C(  78), -INT8_C(  70), -INT8_C( 125),  INT8_C(  68) },
+      {  INT8_C( 120), -INT8_C(  33),  INT8_C(  92), -INT8_C(  70), -INT8_C( 123), -INT8_C(  14),  INT8_C(  52),  INT8_C(   0),
+        -INT8_C(  77),  INT8_C(  14),  INT8_C( 100), -INT8_C(  79), -INT8_C(  89), -INT8_C(  35), -INT8_C(  63),  INT8_C(  34) },
+      {  INT8_C(  30), -INT8_C(  41),  INT8_C(  23), -INT8_C(  18), -INT8_C(  95), -INT8_C(  36),  INT8_C( 109),  INT8_C(  96),
+        -INT8_C( 116),  INT8_C(   3),  INT8_C(  57), -INT8_C(  52), -INT8_C(  23), -INT8_C(  41), -INT8_C(  16),  INT8_C(  40) },
+      {  INT8_C(   7), -INT8_C(  35),  INT8_C(  21), -INT8_C(  21), -INT8_C(  96), -INT8_C(  33),  INT8_C( 107),  INT8_C( 104),
+        -INT8_C( 117),  INT8_C(   0),  INT8_C(  62), -INT8_C(  61), -INT8_C(  22), -INT8_C(  35), -INT8_C(  28),  INT8_C(  58) },
+      {  INT8_C(   1), -INT8_C(  33),  INT8_C(  20), -INT8_C(  21), -INT8_C(  96), -INT8_C(  34),  INT8_C( 106),  INT8_C( 108),
+        -INT8_C( 118),  INT8_C(   7),  INT8_C(  62), -INT8_C(  58), -INT8_C(  20), -INT8_C(  40), -INT8_C(  32),  INT8_C(  61) } },
+    { {  INT8_C(  17), -INT8_C(  50),  INT8_C(  16), -INT8_C(  50), -INT8_C( 103),  INT8_C(  73), -INT8_C(  93), -INT8_C(  55),
+         INT8_C(  66), -INT8_C(  49), -INT8_C( 116),  INT8_C(  25), -INT8_C( 101), -INT8_C(   3),  INT8_C(  50),  INT8_C(  30) },
+      { -INT8_C( 115),  INT8_C(  86), -INT8_C(  79),  INT8_C(  40),      INT8_MIN,  INT8_C(  39), -INT8_C(  81), -INT8_C(  79),
+         INT8_C(   0),  INT8_C(  61),  INT8_C( 100),  INT8_C(  40),  INT8_C(  55), -INT8_C( 123),  INT8_C( 124), -INT8_C(  12) },
+      {  INT8_C(  70), -INT8_C(  85),  INT8_C(  88), -INT8_C( 108), -INT8_C(  64),  INT8_C(  19), -INT8_C(  41), -INT8_C(  40),
+         INT8_C(   0), -INT8_C(  98), -INT8_C(  78),  INT8_C(  20), -INT8_C( 101), -INT8_C(  62),  INT8_C(  62),  INT8_C( 122) },
+      {  INT8_C(  17), -INT8_C(  54),  INT8_C(  22), -INT8_C(  59), -INT8_C( 112),  INT8_C(  68), -INT8_C(  75), -INT8_C(  42),
+         INT8_C(  64), -INT8_C(  57), -INT8_C( 116),  INT8_C(   5), -INT8_C( 122), -INT8_C(  16),  INT8_C(  47),  INT8_C(  30) },
+      {  INT8_C(  20), -INT8_C(  54),  INT8_C(  21), -INT8_C(  55), -INT8_C( 100),  INT8_C(  73), -INT8_C(  91), -INT8_C(  51),
+         INT8_C(  64), -INT8_C(  55), -INT8_C( 117),  INT8_C(  25), -INT8_C( 103), -INT8_C(   4),  INT8_C(  51),  INT8_C(  31) },
+      {  INT8_C(  17), -INT8_C(  50),  INT8_C(  16), -INT8_C(  50), -INT8_C( 103),  INT8_C(  73), -INT8_C(  93), -INT8_C(  55),
+         INT8_C(  66), -INT8_C(  49), -INT8_C( 116),  INT8_C(  25), -INT8_C( 101), -INT8_C(   3),  INT8_C(  50),  INT8_C(  30) } },
+    { {  INT8_C(  62),  INT8_C(  91), -INT8_C( 124), -INT8_C(  57),  INT8_C(  11), -INT8_C(  22),  INT8_C(  88),  INT8_C(  84),
+         INT8_C(  29),  INT8_C(  95), -INT8_C(  31), -INT8_C( 121), -INT8_C( 117), -INT8_C(  60), -INT8_C(  25), -INT8_C(  45) },
+      { -INT8_C(  13),  INT8_C(   2), -INT8_C(  99), -INT8_C( 114),  INT8_C(  39), -INT8_C( 119),  INT8_C( 109),  INT8_C(  64),
+         INT8_C(  50), -INT8_C(  88),  INT8_C(  20),  INT8_C(  45),  INT8_C(  78),  INT8_C(  95), -INT8_C(  62),  INT8_C(  14) },
+      {  INT8_C( 121),  INT8_C(   1), -INT8_C(  50), -INT8_C(  57),  INT8_C(  19), -INT8_C(  60),  INT8_C(  54),  INT8_C(  32),
+         INT8_C(  25),  INT8_C(  84), -INT8_C( 118), -INT8_C( 106), -INT8_C(  89), -INT8_C(  81), -INT8_C(  31), -INT8_C( 121) },
+      {  INT8_C(  62),  INT8_C(  64), -INT8_C( 109), -INT8_C(  47),  INT8_C(   4), -INT8_C(  15),  INT8_C(  77),  INT8_C(  72),
+         INT8_C(   6),  INT8_C(  85), -INT8_C(  30), -INT8_C( 123), -INT8_C( 119), -INT8_C(  53), -INT8_C(   8), -INT8_C(  63) },
+      {  INT8_C(  63),  INT8_C(  88), -INT8_C( 124), -INT8_C(  60),  INT8_C(   9), -INT8_C(  20),  INT8_C(  91),  INT8_C(  82),
+         INT8_C(  25),  INT8_C(  93), -INT8_C(  32), -INT8_C( 127), -INT8_C( 118), -INT8_C(  62), -INT8_C(  26), -INT8_C(  48) },
+      {  INT8_C(  62),  INT8_C(  91), -INT8_C( 124), -INT8_C(  57),  INT8_C(  11), -INT8_C(  22),  INT8_C(  88),  INT8_C(  84),
+         INT8_C(  29),  INT8_C(  95), -INT8_C(  31), -INT8_C( 121), -INT8_C( 117), -INT8_C(  60), -INT8_C(  25), -INT8_C(  45) } },
+    { {  INT8_C(  59), -INT8_C(  33),  INT8_C(  18),  INT8_C( 102),  INT8_C(  48),  INT8_C(  14),  INT8_C( 109),  INT8_C(  89),
+         INT8_C(  59),  INT8_C( 113),  INT8_C(  13), -INT8_C(  36), -INT8_C(  26),  INT8_C( 103), -INT8_C( 115), -INT8_C(  24) },
+      {  INT8_C(  70), -INT8_C(  70), -INT8_C(  40), -INT8_C(   6), -INT8_C(  17),  INT8_C(  85), -INT8_C(  95),  INT8_C(  51),
+         INT8_C( 125), -INT8_C( 120), -INT8_C(   1),  INT8_C(  28), -INT8_C( 118), -INT8_C(  22),  INT8_C(  35), -INT8_C(  91) },
+      {  INT8_C(  35), -INT8_C(  35),  INT8_C( 108),  INT8_C( 125),  INT8_C( 119),  INT8_C(  42),  INT8_C(  80),  INT8_C(  25),
+         INT8_C(  62),  INT8_C(  68),      INT8_MAX, -INT8_C( 114), -INT8_C(  59),  INT8_C( 117), -INT8_C( 111), -INT8_C(  46) },
+      {  INT8_C(  40), -INT8_C(  41),  INT8_C(  27),      INT8_MAX,  INT8_C(  61),  INT8_C(  10),  INT8_C( 116),  INT8_C(  70),
+         INT8_C(  47),  INT8_C( 113),  INT8_C(  31), -INT8_C(  61), -INT8_C(  15),  INT8_C( 125), -INT8_C( 124), -INT8_C(  12) },
+      {  INT8_C(  58), -INT8_C(  35),  INT8_C(  22),  INT8_C( 103),  INT8_C(  55),  INT8_C(  10),  INT8_C( 109),  INT8_C(  89),
+         INT8_C(  59),  INT8_C( 116),  INT8_C(  15), -INT8_C(  40), -INT8_C(  28),  INT8_C( 103), -INT8_C( 119), -INT8_C(  19) },
+      {  INT8_C(  59), -INT8_C(  33),  INT8_C(  18),  INT8_C( 102),  INT8_C(  48),  INT8_C(  14),  INT8_C( 109),  INT8_C(  89),
+         INT8_C(  59),  INT8_C( 113),  INT8_C(  13), -INT8_C(  36), -INT8_C(  26),  INT8_C( 103), -INT8_C( 115), -INT8_C(  24) } },
+    { { -INT8_C( 110),  INT8_C(  54), -INT8_C( 108), -INT8_C( 112), -INT8_C( 119),  INT8_C(  26),  INT8_C(  30), -INT8_C(  18),
+        -INT8_C(  20),  INT8_C(  11), -INT8_C(  57), -INT8_C(  41),  INT8_C(  70),  INT8_C(  46),  INT8_C(  77),  INT8_C(  46) },
+      {  INT8_C(  17), -INT8_C(  44),  INT8_C( 109),  INT8_C(  49), -INT8_C( 114),  INT8_C(  83),  INT8_C(  64),  INT8_C(   0),
+         INT8_C(  21), -INT8_C( 104), -INT8_C( 127), -INT8_C(  98), -INT8_C(  87),  INT8_C(  18),  INT8_C(  14), -INT8_C(  70) },
+      { -INT8_C( 120),  INT8_C( 106), -INT8_C(  74), -INT8_C( 104), -INT8_C(  57),  INT8_C(  41),  INT8_C(  32),      INT8_MIN,
+        -INT8_C( 118),  INT8_C(  76), -INT8_C(  64), -INT8_C(  49),  INT8_C(  84),  INT8_C(   9),  INT8_C(   7),  INT8_C(  93) },
+      { -INT8_C( 126),  INT8_C(  58), -INT8_C( 115), -INT8_C( 122), -INT8_C( 111),  INT8_C(  10),  INT8_C(   8), -INT8_C(  32),
+        -INT8_C(  30),  INT8_C(  19), -INT8_C(  48), -INT8_C(  45),  INT8_C(  85),  INT8_C(  34),  INT8_C(  65),  INT8_C(  55) },
+      { -INT8_C( 112),  INT8_C(  54), -INT8_C( 109), -INT8_C( 111), -INT8_C( 116),  INT8_C(  26),  INT8_C(  26), -INT8_C(  24),
+        -INT8_C(  24),  INT8_C(  12), -INT8_C(  60), -INT8_C(  44),  INT8_C(  69),  INT8_C(  40),  INT8_C(  72),  INT8_C(  45) },
+      { -INT8_C( 110),  INT8_C(  54), -INT8_C( 108), -INT8_C( 112), -INT8_C( 119),  INT8_C(  26),  INT8_C(  30), -INT8_C(  18),
+        -INT8_C(  20),  INT8_C(  11), -INT8_C(  57), -INT8_C(  41),  INT8_C(  70),  INT8_C(  46),  INT8_C(  77),  INT8_C(  46) } },
+    { { -INT8_C(  48),  INT8_C( 123), -INT8_C( 105), -INT8_C( 111), -INT8_C( 114),  INT8_C(  57),  INT8_C(  35),  INT8_C( 116),
+        -INT8_C(   5), -INT8_C(  63), -INT8_C( 116),  INT8_C(   4),  INT8_C( 126),  INT8_C( 101),  INT8_C(  97),  INT8_C( 106) },
+      {  INT8_C( 116), -INT8_C( 104), -INT8_C(  69),  INT8_C( 126), -INT8_C(  60),  INT8_C(  29),  INT8_C( 103),  INT8_C(  57),
+         INT8_C(  90),  INT8_C(  39), -INT8_C( 103), -INT8_C(  66), -INT8_C(  87),  INT8_C(  65), -INT8_C(  81),  INT8_C(  57) },
+      { -INT8_C(  70),  INT8_C(  76), -INT8_C(  35), -INT8_C(  65), -INT8_C(  30),  INT8_C(  14),  INT8_C(  51),  INT8_C(  28),
+        -INT8_C(  83), -INT8_C( 109), -INT8_C(  52),  INT8_C(  95),  INT8_C(  84),  INT8_C(  32),  INT8_C(  87),  INT8_C(  28) },
+      { -INT8_C(  50),  INT8_C( 115), -INT8_C( 105), -INT8_C( 113), -INT8_C( 104),  INT8_C(  35),  INT8_C(  44),  INT8_C( 103),
+        -INT8_C(  21), -INT8_C(  60), -INT8_C( 109),  INT8_C(  23),  INT8_C( 117),  INT8_C( 104),  INT8_C( 117),  INT8_C( 103) },
+      { -INT8_C(  45),  INT8_C( 124), -INT8_C( 107), -INT8_C( 109), -INT8_C( 114),  INT8_C(  56),  INT8_C(  35),  INT8_C( 113),
+        -INT8_C(   6), -INT8_C(  63), -INT8_C( 116),  INT8_C(   5),  INT8_C( 125),  INT8_C(  98),  INT8_C( 101),  INT8_C( 105) },
+      { -INT8_C(  48),  INT8_C( 123), -INT8_C( 105), -INT8_C( 111), -INT8_C( 114),  INT8_C(  57),  INT8_C(  35),  INT8_C( 116),
+        -INT8_C(   5), -INT8_C(  63), -INT8_C( 116),  INT8_C(   4),  INT8_C( 126),  INT8_C( 101),  INT8_C(  97),  INT8_C( 106) } },
+    { {  INT8_C(  96),  INT8_C( 115), -INT8_C(  68),  INT8_C( 118),  INT8_C(  11), -INT8_C(  50), -INT8_C( 126), -INT8_C(  87),
+         INT8_C(  23), -INT8_C(  77),  INT8_C(  31), -INT8_C(  62),  INT8_C(  66),  INT8_C(  63), -INT8_C(  87),  INT8_C(   7) },
+      { -INT8_C(   5),  INT8_C(  38),  INT8_C(  17),  INT8_C(  32), -INT8_C(  41), -INT8_C(  82),  INT8_C( 114),  INT8_C(   7),
+        -INT8_C(  14), -INT8_C( 124),  INT8_C(  21), -INT8_C(  14),  INT8_C( 109),  INT8_C(  16), -INT8_C(  43), -INT8_C(  65) },
+      {  INT8_C( 125),  INT8_C(  19), -INT8_C( 120),  INT8_C(  16),  INT8_C( 107), -INT8_C(  41), -INT8_C(  71), -INT8_C( 125),
+         INT8_C( 121), -INT8_C(  62),  INT8_C(  10), -INT8_C(   7),  INT8_C(  54),  INT8_C(   8), -INT8_C(  22),  INT8_C(  95) },
+      {      INT8_MAX,  INT8_C( 100), -INT8_C(  94),  INT8_C( 100),  INT8_C(  26), -INT8_C(  43), -INT8_C( 114), -INT8_C(  96),
+         INT8_C(  30), -INT8_C(  80),  INT8_C(   2), -INT8_C(  34),  INT8_C(  77),  INT8_C(  34), -INT8_C(  70),  INT8_C(  23) },
+      {  INT8_C( 103),  INT8_C( 113), -INT8_C(  72),  INT8_C( 113),  INT8_C(  14), -INT8_C(  51), -INT8_C( 125), -INT8_C(  88),
+         INT8_C(  23), -INT8_C(  76),  INT8_C(  24), -INT8_C(  57),  INT8_C(  67),  INT8_C(  56), -INT8_C(  82),  INT8_C(   5) },
+      {  INT8_C(  96),  INT8_C( 115), -INT8_C(  68),  INT8_C( 118),  INT8_C(  11), -INT8_C(  50), -INT8_C( 126), -INT8_C(  87),
+         INT8_C(  23), -INT8_C(  77),  INT8_C(  31), -INT8_C(  62),  INT8_C(  66),  INT8_C(  63), -INT8_C(  87),  INT8_C(   7) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+
+    simde_int8x16_t r1 = simde_vsriq_n_s8(a, b, 1);
+    simde_int8x16_t r3 = simde_vsriq_n_s8(a, b, 3);
+    simde_int8x16_t r5 = simde_vsriq_n_s8(a, b, 5);
+    simde_int8x16_t r8 = simde_vsriq_n_s8(a, b, 8);
+
+    simde_test_arm_neon_assert_equal_i8x16(r1, simde_vld1q_s8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i8x16(r3, simde_vld1q_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x16(r5, simde_vld1q_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x16(r8, simde_vld1q_s8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x16_t a = simde_test_arm_neon_random_i8x16();
+    simde_int8x16_t b = simde_test_arm_neon_random_i8x16();
+
+    simde_int8x16_t r1 = simde_vsriq_n_s8(a, b, 1);
+    simde_int8x16_t r3 = simde_vsriq_n_s8(a, b, 3);
+    simde_int8x16_t r5 = simde_vsriq_n_s8(a, b, 5);
+    simde_int8x16_t r8 = simde_vsriq_n_s8(a, b, 8);
+
+    simde_test_arm_neon_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i8x16(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r1[8];
+    int16_t r6[8];
+    int16_t r11[8];
+    int16_t r16[8];
+  } test_vec[] = {
+    { { -INT16_C( 32675),  INT16_C(  1698), -INT16_C( 25610), -INT16_C(  5636), -INT16_C(  1512), -INT16_C( 18356), -INT16_C(  7648), -INT16_C( 20368) },
+      {  INT16_C( 16899),  INT16_C( 24241), -INT16_C( 22881), -INT16_C( 25693), -INT16_C( 13392),  INT16_C(  3588), -INT16_C( 15215),  INT16_C( 23190) },
+      { -INT16_C( 24319),  INT16_C( 12120), -INT16_C( 11441), -INT16_C( 12847), -INT16_C(  6696), -INT16_C( 30974), -INT16_C(  7608), -INT16_C( 21173) },
+      { -INT16_C( 32504),  INT16_C(  1402), -INT16_C( 25958), -INT16_C(  5522), -INT16_C(  1234), -INT16_C( 18376), -INT16_C(  7406), -INT16_C( 20118) },
+      { -INT16_C( 32696),  INT16_C(  1707), -INT16_C( 25612), -INT16_C(  5645), -INT16_C(  1511), -INT16_C( 18367), -INT16_C(  7624), -INT16_C( 20373) },
+      { -INT16_C( 32675),  INT16_C(  1698), -INT16_C( 25610), -INT16_C(  5636), -INT16_C(  1512), -INT16_C( 18356), -INT16_C(  7648), -INT16_C( 20368) } },
+    { { -INT16_C( 22197),  INT16_C( 31798),  INT16_C( 11545),  INT16_C( 32069),  INT16_C( 13212), -INT16_C( 17338),  INT16_C( 16354), -INT16_C(  8979) },
+      { -INT16_C( 11290), -INT16_C(  1138), -INT16_C( 16886), -INT16_C( 15045), -INT16_C( 25160), -INT16_C( 14259), -INT16_C(   671), -INT16_C( 30207) },
+      { -INT16_C(  5645),  INT16_C( 32199),  INT16_C( 24325),  INT16_C( 25245),  INT16_C( 20188), -INT16_C(  7130),  INT16_C( 32432), -INT16_C( 15104) },
+      { -INT16_C( 21681),  INT16_C( 32750),  INT16_C( 12024),  INT16_C( 32532),  INT16_C( 12918), -INT16_C( 16607),  INT16_C( 16373), -INT16_C(  8664) },
+      { -INT16_C( 22182),  INT16_C( 31807),  INT16_C( 11543),  INT16_C( 32088),  INT16_C( 13203), -INT16_C( 17319),  INT16_C( 16383), -INT16_C(  8975) },
+      { -INT16_C( 22197),  INT16_C( 31798),  INT16_C( 11545),  INT16_C( 32069),  INT16_C( 13212), -INT16_C( 17338),  INT16_C( 16354), -INT16_C(  8979) } },
+    { {  INT16_C(  4070),  INT16_C(  3204), -INT16_C(  8517),  INT16_C( 30261), -INT16_C( 15002),  INT16_C( 18694), -INT16_C( 12699),  INT16_C( 31615) },
+      { -INT16_C( 14610),  INT16_C(  9714),  INT16_C( 22748), -INT16_C( 31709),  INT16_C( 16244),  INT16_C( 21861), -INT16_C( 12783),  INT16_C( 17812) },
+      {  INT16_C( 25463),  INT16_C(  4857), -INT16_C( 21394),  INT16_C( 16913), -INT16_C( 24646),  INT16_C( 10930), -INT16_C(  6392),  INT16_C(  8906) },
+      {  INT16_C(  3867),  INT16_C(  3223), -INT16_C(  8861),  INT16_C( 30224), -INT16_C( 15107),  INT16_C( 18773), -INT16_C( 12488),  INT16_C( 30998) },
+      {  INT16_C(  4088),  INT16_C(  3204), -INT16_C(  8533),  INT16_C( 30256), -INT16_C( 15001),  INT16_C( 18698), -INT16_C( 12679),  INT16_C( 31592) },
+      {  INT16_C(  4070),  INT16_C(  3204), -INT16_C(  8517),  INT16_C( 30261), -INT16_C( 15002),  INT16_C( 18694), -INT16_C( 12699),  INT16_C( 31615) } },
+    { {  INT16_C(  9595), -INT16_C(  7911), -INT16_C( 19475),  INT16_C(  6974),  INT16_C(  1615), -INT16_C( 27051),  INT16_C( 23211), -INT16_C( 26849) },
+      { -INT16_C(  5736), -INT16_C(  7371),  INT16_C( 27882), -INT16_C( 17195),  INT16_C( 32312),  INT16_C( 31726), -INT16_C( 28144), -INT16_C( 18120) },
+      {  INT16_C( 29900), -INT16_C(  3686), -INT16_C( 18827),  INT16_C( 24170),  INT16_C( 16156), -INT16_C( 16905),  INT16_C( 18696), -INT16_C(  9060) },
+      {  INT16_C( 10150), -INT16_C(  7284), -INT16_C( 20045),  INT16_C(  6899),  INT16_C(  1528), -INT16_C( 27153),  INT16_C( 23112), -INT16_C( 26908) },
+      {  INT16_C(  9597), -INT16_C(  7908), -INT16_C( 19475),  INT16_C(  6967),  INT16_C(  1615), -INT16_C( 27057),  INT16_C( 23218), -INT16_C( 26857) },
+      {  INT16_C(  9595), -INT16_C(  7911), -INT16_C( 19475),  INT16_C(  6974),  INT16_C(  1615), -INT16_C( 27051),  INT16_C( 23211), -INT16_C( 26849) } },
+    { { -INT16_C(  1698), -INT16_C( 13418), -INT16_C( 26744),  INT16_C( 16506), -INT16_C(  3555), -INT16_C(  9774),  INT16_C( 12765),  INT16_C(  5840) },
+      { -INT16_C( 24043),  INT16_C( 30506), -INT16_C(  5464),  INT16_C(   932), -INT16_C( 29826), -INT16_C(  8349), -INT16_C( 19226),  INT16_C( 13513) },
+      { -INT16_C( 12022), -INT16_C( 17515), -INT16_C(  2732),  INT16_C(   466), -INT16_C( 14913), -INT16_C(  4175),  INT16_C( 23155),  INT16_C(  6756) },
+      { -INT16_C(  1400), -INT16_C( 13860), -INT16_C( 26710),  INT16_C( 16398), -INT16_C(  3539), -INT16_C(  9347),  INT16_C( 13011),  INT16_C(  5331) },
+      { -INT16_C(  1708), -INT16_C( 13426), -INT16_C( 26723),  INT16_C( 16480), -INT16_C(  3567), -INT16_C(  9765),  INT16_C( 12758),  INT16_C(  5830) },
+      { -INT16_C(  1698), -INT16_C( 13418), -INT16_C( 26744),  INT16_C( 16506), -INT16_C(  3555), -INT16_C(  9774),  INT16_C( 12765),  INT16_C(  5840) } },
+    { { -INT16_C(  3694), -INT16_C( 15892), -INT16_C( 12637),  INT16_C( 12180), -INT16_C(  2748), -INT16_C( 17109),  INT16_C( 12916),  INT16_C( 31267) },
+      { -INT16_C( 16935),  INT16_C( 18198), -INT16_C( 31030), -INT16_C( 22522),  INT16_C(  9942),  INT16_C( 30835), -INT16_C( 27534), -INT16_C( 15028) },
+      { -INT16_C(  8468), -INT16_C( 23669), -INT16_C( 15515),  INT16_C( 21507), -INT16_C( 27797), -INT16_C( 17351),  INT16_C( 19001),  INT16_C( 25254) },
+      { -INT16_C(  3337), -INT16_C( 16100), -INT16_C( 12773),  INT16_C( 11936), -INT16_C(  2917), -INT16_C( 16927),  INT16_C( 12881),  INT16_C( 31509) },
+      { -INT16_C(  3689), -INT16_C( 15896), -INT16_C( 12624),  INT16_C( 12181), -INT16_C(  2748), -INT16_C( 17105),  INT16_C( 12914),  INT16_C( 31288) },
+      { -INT16_C(  3694), -INT16_C( 15892), -INT16_C( 12637),  INT16_C( 12180), -INT16_C(  2748), -INT16_C( 17109),  INT16_C( 12916),  INT16_C( 31267) } },
+    { { -INT16_C( 27703), -INT16_C( 31978), -INT16_C( 22942),  INT16_C(  5057), -INT16_C( 11954),  INT16_C( 21181), -INT16_C(  6812), -INT16_C(  2647) },
+      { -INT16_C(  8845), -INT16_C( 12800),  INT16_C(  7679), -INT16_C( 25151),  INT16_C( 26351),  INT16_C( 28081), -INT16_C( 22174),  INT16_C(  1126) },
+      { -INT16_C(  4423), -INT16_C(  6400), -INT16_C( 28929),  INT16_C( 20192), -INT16_C( 19593),  INT16_C( 14040), -INT16_C( 11087), -INT16_C( 32205) },
+      { -INT16_C( 27787), -INT16_C( 31944), -INT16_C( 23433),  INT16_C(  4727), -INT16_C( 11877),  INT16_C( 20918), -INT16_C(  6491), -INT16_C(  3055) },
+      { -INT16_C( 27685), -INT16_C( 31975), -INT16_C( 22941),  INT16_C(  5075), -INT16_C( 11956),  INT16_C( 21165), -INT16_C(  6795), -INT16_C(  2656) },
+      { -INT16_C( 27703), -INT16_C( 31978), -INT16_C( 22942),  INT16_C(  5057), -INT16_C( 11954),  INT16_C( 21181), -INT16_C(  6812), -INT16_C(  2647) } },
+    { { -INT16_C(  6633),  INT16_C( 16654),  INT16_C( 17758), -INT16_C(  1339),  INT16_C( 29832),  INT16_C( 30303),  INT16_C( 22053),  INT16_C( 19645) },
+      { -INT16_C(  8689),  INT16_C( 17471), -INT16_C( 22377),  INT16_C(  5635), -INT16_C( 18480),  INT16_C( 19633), -INT16_C( 30428), -INT16_C(  7350) },
+      { -INT16_C(  4345),  INT16_C(  8735),  INT16_C( 21579), -INT16_C( 29951),  INT16_C( 23528),  INT16_C(  9816),  INT16_C( 17554),  INT16_C( 29093) },
+      { -INT16_C(  6280),  INT16_C( 16656),  INT16_C( 18082), -INT16_C(  1960),  INT16_C( 30431),  INT16_C( 30002),  INT16_C( 22052),  INT16_C( 20365) },
+      { -INT16_C(  6629),  INT16_C( 16648),  INT16_C( 17749), -INT16_C(  1342),  INT16_C( 29846),  INT16_C( 30281),  INT16_C( 22065),  INT16_C( 19644) },
+      { -INT16_C(  6633),  INT16_C( 16654),  INT16_C( 17758), -INT16_C(  1339),  INT16_C( 29832),  INT16_C( 30303),  INT16_C( 22053),  INT16_C( 19645) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+
+    simde_int16x8_t r1 = simde_vsriq_n_s16(a, b, 1);
+    simde_int16x8_t r6 = simde_vsriq_n_s16(a, b, 6);
+    simde_int16x8_t r11 = simde_vsriq_n_s16(a, b, 11);
+    simde_int16x8_t r16 = simde_vsriq_n_s16(a, b, 16);
+
+    simde_test_arm_neon_assert_equal_i16x8(r1, simde_vld1q_s16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i16x8(r6, simde_vld1q_s16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_i16x8(r11, simde_vld1q_s16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_i16x8(r16, simde_vld1q_s16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a = simde_test_arm_neon_random_i16x8();
+    simde_int16x8_t b = simde_test_arm_neon_random_i16x8();
+
+    simde_int16x8_t r1 = simde_vsriq_n_s16(a, b, 1);
+    simde_int16x8_t r6 = simde_vsriq_n_s16(a, b, 6);
+    simde_int16x8_t r11 = simde_vsriq_n_s16(a, b, 11);
+    simde_int16x8_t r16 = simde_vsriq_n_s16(a, b, 16);
+
+    simde_test_arm_neon_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i16x8(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r1[4];
+    int32_t r13[4];
+    int32_t r22[4];
+    int32_t r32[4];
+  } test_vec[] = {
+    { {  INT32_C(   454794674), -INT32_C(  1883291540), -INT32_C(   734699184), -INT32_C(  1083574747) },
+      { -INT32_C(  2032200444),  INT32_C(  1697558223), -INT32_C(   317562745),  INT32_C(   670433208) },
+      {  INT32_C(  1131383426), -INT32_C(  1298704537), -INT32_C(   158781373), -INT32_C(  1812267044) },
+      {  INT32_C(   454833912), -INT32_C(  1883559563), -INT32_C(   734566253), -INT32_C(  1083621457) },
+      {  INT32_C(   454794779), -INT32_C(  1883291244), -INT32_C(   734698572), -INT32_C(  1083575137) },
+      {  INT32_C(   454794674), -INT32_C(  1883291540), -INT32_C(   734699184), -INT32_C(  1083574747) } },
+    { {  INT32_C(   103968214), -INT32_C(  1736513176), -INT32_C(  1070194322), -INT32_C(   388651450) },
+      {  INT32_C(   407821182), -INT32_C(  2107930191),  INT32_C(   621039542),  INT32_C(   848998094) },
+      {  INT32_C(   203910591), -INT32_C(  1053965096), -INT32_C(  1836963877), -INT32_C(  1722984601) },
+      {  INT32_C(   103858806), -INT32_C(  1736699172), -INT32_C(  1070520286), -INT32_C(   388918059) },
+      {  INT32_C(   103967841), -INT32_C(  1736513015), -INT32_C(  1070194540), -INT32_C(   388651830) },
+      {  INT32_C(   103968214), -INT32_C(  1736513176), -INT32_C(  1070194322), -INT32_C(   388651450) } },
+    { {  INT32_C(  1683883960),  INT32_C(   567005587), -INT32_C(  1423506334),  INT32_C(  2075386546) },
+      { -INT32_C(   233592937), -INT32_C(   315555431), -INT32_C(   345206385), -INT32_C(   743333960) },
+      {  INT32_C(  2030687179),  INT32_C(  1989705932), -INT32_C(   172603193),  INT32_C(  1775816668) },
+      {  INT32_C(  1683984541),  INT32_C(   567241096), -INT32_C(  1423484060),  INT32_C(  2075565452) },
+      {  INT32_C(  1683883976),  INT32_C(   567006132), -INT32_C(  1423505491),  INT32_C(  2075386702) },
+      {  INT32_C(  1683883960),  INT32_C(   567005587), -INT32_C(  1423506334),  INT32_C(  2075386546) } },
+    { {  INT32_C(  1151027321), -INT32_C(   782127354),  INT32_C(  1297840990), -INT32_C(   186744481) },
+      { -INT32_C(   229990098), -INT32_C(   993929244), -INT32_C(   160649851), -INT32_C(  2008365612) },
+      {  INT32_C(  2032488599), -INT32_C(   496964622),  INT32_C(  2067158722), -INT32_C(  1004182806) },
+      {  INT32_C(  1151308373), -INT32_C(   781834738),  INT32_C(  1298117477), -INT32_C(   186891690) },
+      {  INT32_C(  1151028169), -INT32_C(   782127341),  INT32_C(  1297841113), -INT32_C(   186744287) },
+      {  INT32_C(  1151027321), -INT32_C(   782127354),  INT32_C(  1297840990), -INT32_C(   186744481) } },
+    { { -INT32_C(   356236563), -INT32_C(  1151590409),  INT32_C(  1667028736),  INT32_C(  1274025051) },
+      {  INT32_C(  2069585580), -INT32_C(   295951696),  INT32_C(  1248450049),  INT32_C(   880772421) },
+      { -INT32_C(  1112690858), -INT32_C(   147975848),  INT32_C(   624225024),  INT32_C(   440386210) },
+      { -INT32_C(   356263206), -INT32_C(  1151372575),  INT32_C(  1666863950),  INT32_C(  1274127356) },
+      { -INT32_C(   356236819), -INT32_C(  1151590471),  INT32_C(  1667028265),  INT32_C(  1274025169) },
+      { -INT32_C(   356236563), -INT32_C(  1151590409),  INT32_C(  1667028736),  INT32_C(  1274025051) } },
+    { { -INT32_C(  1237848587),  INT32_C(   336537394),  INT32_C(  1035882277), -INT32_C(   624385197) },
+      {  INT32_C(  1450264390),  INT32_C(  1821658201),  INT32_C(  2096459781),  INT32_C(   115105840) },
+      { -INT32_C(  1422351453),  INT32_C(   910829100),  INT32_C(  1048229890), -INT32_C(  2089930728) },
+      { -INT32_C(  1238191222),  INT32_C(   336290978),  INT32_C(  1035724715), -INT32_C(   624412957) },
+      { -INT32_C(  1237848743),  INT32_C(   336537010),  INT32_C(  1035881971), -INT32_C(   624386021) },
+      { -INT32_C(  1237848587),  INT32_C(   336537394),  INT32_C(  1035882277), -INT32_C(   624385197) } },
+    { {  INT32_C(  2068305405), -INT32_C(   747348212),  INT32_C(   810737703),  INT32_C(  2067143456) },
+      { -INT32_C(  1969044029),  INT32_C(   695126589), -INT32_C(  2067019238), -INT32_C(  1182630918) },
+      {  INT32_C(  1162961633), -INT32_C(  1799920354),  INT32_C(  1113974029),  INT32_C(  1556168189) },
+      {  INT32_C(  2068075798), -INT32_C(   747549834),  INT32_C(   810821214),  INT32_C(  2067123219) },
+      {  INT32_C(  2068305450), -INT32_C(   747348827),  INT32_C(   810738195),  INT32_C(  2067143398) },
+      {  INT32_C(  2068305405), -INT32_C(   747348212),  INT32_C(   810737703),  INT32_C(  2067143456) } },
+    { {  INT32_C(  1054524187), -INT32_C(  1160198578),  INT32_C(   441145380),  INT32_C(  1421807199) },
+      {  INT32_C(  1140431171),  INT32_C(  1888243826),  INT32_C(  1751647213), -INT32_C(   181595039) },
+      {  INT32_C(   570215585), -INT32_C(  1203361735),  INT32_C(   875823606),  INT32_C(  2056686128) },
+      {  INT32_C(  1054482380), -INT32_C(  1160018846),  INT32_C(   441140032),  INT32_C(  1421846888) },
+      {  INT32_C(  1054523663), -INT32_C(  1160198718),  INT32_C(   441145761),  INT32_C(  1421807572) },
+      {  INT32_C(  1054524187), -INT32_C(  1160198578),  INT32_C(   441145380),  INT32_C(  1421807199) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+
+    simde_int32x4_t r1 = simde_vsriq_n_s32(a, b, 1);
+    simde_int32x4_t r13 = simde_vsriq_n_s32(a, b, 13);
+    simde_int32x4_t r22 = simde_vsriq_n_s32(a, b, 22);
+    simde_int32x4_t r32 = simde_vsriq_n_s32(a, b, 32);
+
+    simde_test_arm_neon_assert_equal_i32x4(r1, simde_vld1q_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x4(r13, simde_vld1q_s32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_i32x4(r22, simde_vld1q_s32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_i32x4(r32, simde_vld1q_s32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a = simde_test_arm_neon_random_i32x4();
+    simde_int32x4_t b = simde_test_arm_neon_random_i32x4();
+
+    simde_int32x4_t r1 = simde_vsriq_n_s32(a, b, 1);
+    simde_int32x4_t r13 = simde_vsriq_n_s32(a, b, 13);
+    simde_int32x4_t r22 = simde_vsriq_n_s32(a, b, 22);
+    simde_int32x4_t r32 = simde_vsriq_n_s32(a, b, 32);
+
+    simde_test_arm_neon_write_i32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i32x4(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r1[2];
+    int64_t r19[2];
+    int64_t r42[2];
+    int64_t r64[2];
+  } test_vec[] = {
+    { { -INT64_C( 3225413110812625815), -INT64_C( 1947507554581908530) },
+      {  INT64_C( 3866765409200019284),  INT64_C( 9051025090984107023) },
+      { -INT64_C( 7289989332254766166), -INT64_C( 4697859491362722297) },
+      { -INT64_C( 3225414382857690460), -INT64_C( 1947508100400696024) },
+      { -INT64_C( 3225413110813857184), -INT64_C( 1947507554579945748) },
+      { -INT64_C( 3225413110812625815), -INT64_C( 1947507554581908530) } },
+    { { -INT64_C(  791074680283086665),  INT64_C( 7520516729612038469) },
+      {  INT64_C(  213103240956136612),  INT64_C( 2307295670651517942) },
+      { -INT64_C( 9116820416376707502),  INT64_C( 1153647835325758971) },
+      { -INT64_C(  791085015583123403),  INT64_C( 7520488012944638751) },
+      { -INT64_C(  791074680285905594),  INT64_C( 7520516729609912650) },
+      { -INT64_C(  791074680283086665),  INT64_C( 7520516729612038469) } },
+    { { -INT64_C( 5733227922029292623),  INT64_C( 3844486204890777062) },
+      { -INT64_C(  937121162092762900), -INT64_C( 8269353845872338724) },
+      { -INT64_C(  468560581046381450),  INT64_C( 5088695113918606446) },
+      { -INT64_C( 5733224850547764034),  INT64_C( 3844475012489653976) },
+      { -INT64_C( 5733227922026872917),  INT64_C( 3844486204890500950) },
+      { -INT64_C( 5733227922029292623),  INT64_C( 3844486204890777062) } },
+    { {  INT64_C( 1785316739806248885), -INT64_C( 4937078002585680398) },
+      {  INT64_C( 1461302953536765124),  INT64_C( 1451921420105000300) },
+      {  INT64_C(  730651476768382562), -INT64_C( 8497411326802275658) },
+      {  INT64_C( 1785293011373615065), -INT64_C( 4937103506556659484) },
+      {  INT64_C( 1785316739803058661), -INT64_C( 4937078002589300336) },
+      {  INT64_C( 1785316739806248885), -INT64_C( 4937078002585680398) } },
+    { {  INT64_C( 2730130806019083968), -INT64_C( 7398770194670189063) },
+      { -INT64_C( 4810023580454618972), -INT64_C( 7183556292456671022) },
+      {  INT64_C( 6818360246627466322), -INT64_C( 3591778146228335511) },
+      {  INT64_C( 2730122177841019063), -INT64_C( 7398759386246310269) },
+      {  INT64_C( 2730130806020198359), -INT64_C( 7398770194670742600) },
+      {  INT64_C( 2730130806019083968), -INT64_C( 7398770194670189063) } },
+    { {  INT64_C( 8969672623761273380), -INT64_C( 6954702580410573095) },
+      {  INT64_C( 4055245180221831134),  INT64_C( 8940526064869368623) },
+      {  INT64_C( 2027622590110915567), -INT64_C( 4753109004420091497) },
+      {  INT64_C( 8969665264488558471), -INT64_C( 6954701856238810827) },
+      {  INT64_C( 8969672623760740808), -INT64_C( 6954702580410809144) },
+      {  INT64_C( 8969672623761273380), -INT64_C( 6954702580410573095) } },
+    { { -INT64_C(  738702690285445986), -INT64_C( 7245252890764014399) },
+      {  INT64_C( 9095358333903172185), -INT64_C(  220195013294932980) },
+      { -INT64_C( 4675692869903189716), -INT64_C(  110097506647466490) },
+      { -INT64_C(  738713728357833563), -INT64_C( 7245236689265120665) },
+      { -INT64_C(  738702690286072243), -INT64_C( 7245252890762199955) },
+      { -INT64_C(  738702690285445986), -INT64_C( 7245252890764014399) } },
+    { { -INT64_C( 1433062079905428408),  INT64_C( 8054027595207538192) },
+      {  INT64_C( 5303170830035305279),  INT64_C( 4627055842957104654) },
+      { -INT64_C( 6571786621837123169),  INT64_C( 2313527921478552327) },
+      { -INT64_C( 1433084544554583954),  INT64_C( 8054028255891080299) },
+      { -INT64_C( 1433062079906814423),  INT64_C( 8054027595207937446) },
+      { -INT64_C( 1433062079905428408),  INT64_C( 8054027595207538192) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+
+    simde_int64x2_t r1 = simde_vsriq_n_s64(a, b, 1);
+    simde_int64x2_t r19 = simde_vsriq_n_s64(a, b, 19);
+    simde_int64x2_t r42 = simde_vsriq_n_s64(a, b, 42);
+    simde_int64x2_t r64 = simde_vsriq_n_s64(a, b, 64);
+
+    simde_test_arm_neon_assert_equal_i64x2(r1, simde_vld1q_s64(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i64x2(r19, simde_vld1q_s64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_i64x2(r42, simde_vld1q_s64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_i64x2(r64, simde_vld1q_s64(test_vec[i].r64));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a = simde_test_arm_neon_random_i64x2();
+    simde_int64x2_t b = simde_test_arm_neon_random_i64x2();
+
+    simde_int64x2_t r1 = simde_vsriq_n_s64(a, b, 1);
+    simde_int64x2_t r19 = simde_vsriq_n_s64(a, b, 19);
+    simde_int64x2_t r42 = simde_vsriq_n_s64(a, b, 42);
+    simde_int64x2_t r64 = simde_vsriq_n_s64(a, b, 64);
+
+    simde_test_arm_neon_write_i64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_i64x2(2, r64, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    uint8_t r1[16];
+    uint8_t r3[16];
+    uint8_t r5[16];
+    uint8_t r8[16];
+  } test_vec[] = {
+    { { UINT8_C(  0), UINT8_C(101), UINT8_C(214), UINT8_C(136), UINT8_C( 35), UINT8_C(108), UINT8_C( 47), UINT8_C(234),
+        UINT8_C(208), UINT8_C(153), UINT8_C(103), UINT8_C(118), UINT8_C(115), UINT8_C( 38), UINT8_C( 53), UINT8_C(223) },
+      { UINT8_C(223), UINT8_C(133), UINT8_C( 20), UINT8_C( 20), UINT8_C(247), UINT8_C(120), UINT8_C(113), UINT8_C( 52),
+        UINT8_C(  9), UINT8_C(217), UINT8_C(161), UINT8_C(204), UINT8_C(170), UINT8_C(203), UINT8_C(109), UINT8_C(157) },
+      { UINT8_C(111), UINT8_C( 66), UINT8_C(138), UINT8_C(138), UINT8_C(123), UINT8_C( 60), UINT8_C( 56), UINT8_C(154),
+        UINT8_C(132), UINT8_C(236), UINT8_C( 80), UINT8_C(102), UINT8_C( 85), UINT8_C(101), UINT8_C( 54), UINT8_C(206) },
+      { UINT8_C( 27), UINT8_C(112), UINT8_C(194), UINT8_C(130), UINT8_C( 62), UINT8_C(111), UINT8_C( 46), UINT8_C(230),
+        UINT8_C(193), UINT8_C(155), UINT8_C(116), UINT8_C(121), UINT8_C(117), UINT8_C( 57), UINT8_C( 45), UINT8_C(211) },
+      { UINT8_C(  6), UINT8_C(100), UINT8_C(208), UINT8_C(136), UINT8_C( 39), UINT8_C(107), UINT8_C( 43), UINT8_C(233),
+        UINT8_C(208), UINT8_C(158), UINT8_C(101), UINT8_C(118), UINT8_C(117), UINT8_C( 38), UINT8_C( 51), UINT8_C(220) },
+      { UINT8_C(  0), UINT8_C(101), UINT8_C(214), UINT8_C(136), UINT8_C( 35), UINT8_C(108), UINT8_C( 47), UINT8_C(234),
+        UINT8_C(208), UINT8_C(153), UINT8_C(103), UINT8_C(118), UINT8_C(115), UINT8_C( 38), UINT8_C( 53), UINT8_C(223) } },
+    { { UINT8_C(173), UINT8_C(184), UINT8_C(121), UINT8_C( 99), UINT8_C( 82), UINT8_C(106),    UINT8_MAX, UINT8_C( 35),
+        UINT8_C( 63), UINT8_C( 74), UINT8_C( 22), UINT8_C(146), UINT8_C(174), UINT8_C(132), UINT8_C(153), UINT8_C( 20) },
+      { UINT8_C(247), UINT8_C(177), UINT8_C( 81), UINT8_C( 20), UINT8_C( 76), UINT8_C( 58), UINT8_C( 50), UINT8_C(188),
+        UINT8_C(  5), UINT8_C(118), UINT8_C(116), UINT8_C( 83), UINT8_C(146), UINT8_C(190), UINT8_C( 25), UINT8_C( 38) },
+      { UINT8_C(251), UINT8_C(216), UINT8_C( 40), UINT8_C( 10), UINT8_C( 38), UINT8_C( 29), UINT8_C(153), UINT8_C( 94),
+        UINT8_C(  2), UINT8_C( 59), UINT8_C( 58), UINT8_C(169), UINT8_C(201), UINT8_C(223), UINT8_C(140), UINT8_C( 19) },
+      { UINT8_C(190), UINT8_C(182), UINT8_C(106), UINT8_C( 98), UINT8_C( 73), UINT8_C(103), UINT8_C(230), UINT8_C( 55),
+        UINT8_C( 32), UINT8_C( 78), UINT8_C( 14), UINT8_C(138), UINT8_C(178), UINT8_C(151), UINT8_C(131), UINT8_C(  4) },
+      { UINT8_C(175), UINT8_C(189), UINT8_C(122), UINT8_C( 96), UINT8_C( 82), UINT8_C(105), UINT8_C(249), UINT8_C( 37),
+        UINT8_C( 56), UINT8_C( 75), UINT8_C( 19), UINT8_C(146), UINT8_C(172), UINT8_C(133), UINT8_C(152), UINT8_C( 17) },
+      { UINT8_C(173), UINT8_C(184), UINT8_C(121), UINT8_C( 99), UINT8_C( 82), UINT8_C(106),    UINT8_MAX, UINT8_C( 35),
+        UINT8_C( 63), UINT8_C( 74), UINT8_C( 22), UINT8_C(146), UINT8_C(174), UINT8_C(132), UINT8_C(153), UINT8_C( 20) } },
+    { { UINT8_C( 60), UINT8_C(141), UINT8_C(185), UINT8_C(250), UINT8_C(197), UINT8_C(191), UINT8_C(126), UINT8_C(177),
+        UINT8_C(137), UINT8_C( 21), UINT8_C( 14), UINT8_C(121), UINT8_C(144), UINT8_C(231), UINT8_C( 70), UINT8_C(204) },
+      { UINT8_C(157), UINT8_C(161), UINT8_C(110), UINT8_C(135), UINT8_C(125), UINT8_C( 91), UINT8_C(176), UINT8_C( 96),
+        UINT8_C( 55), UINT8_C(208), UINT8_C( 64), UINT8_C(220), UINT8_C(171), UINT8_C(209), UINT8_C( 45), UINT8_C(  4) },
+      { UINT8_C( 78), UINT8_C(208), UINT8_C(183), UINT8_C(195), UINT8_C(190), UINT8_C(173), UINT8_C( 88), UINT8_C(176),
+        UINT8_C(155), UINT8_C(104), UINT8_C( 32), UINT8_C(110), UINT8_C(213), UINT8_C(232), UINT8_C( 22), UINT8_C(130) },
+      { UINT8_C( 51), UINT8_C(148), UINT8_C(173), UINT8_C(240), UINT8_C(207), UINT8_C(171), UINT8_C(118), UINT8_C(172),
+        UINT8_C(134), UINT8_C( 26), UINT8_C(  8), UINT8_C(123), UINT8_C(149), UINT8_C(250), UINT8_C( 69), UINT8_C(192) },
+      { UINT8_C( 60), UINT8_C(141), UINT8_C(187), UINT8_C(252), UINT8_C(195), UINT8_C(186), UINT8_C(125), UINT8_C(179),
+        UINT8_C(137), UINT8_C( 22), UINT8_C( 10), UINT8_C(126), UINT8_C(149), UINT8_C(230), UINT8_C( 65), UINT8_C(200) },
+      { UINT8_C( 60), UINT8_C(141), UINT8_C(185), UINT8_C(250), UINT8_C(197), UINT8_C(191), UINT8_C(126), UINT8_C(177),
+        UINT8_C(137), UINT8_C( 21), UINT8_C( 14), UINT8_C(121), UINT8_C(144), UINT8_C(231), UINT8_C( 70), UINT8_C(204) } },
+    { { UINT8_C( 78), UINT8_C(236), UINT8_C(247), UINT8_C(155), UINT8_C(235), UINT8_C(145), UINT8_C( 21), UINT8_C( 22),
+        UINT8_C(224), UINT8_C(115), UINT8_C( 37), UINT8_C(231), UINT8_C( 25), UINT8_C(170), UINT8_C(160), UINT8_C(231) },
+      { UINT8_C(253), UINT8_C(213), UINT8_C( 79), UINT8_C(149), UINT8_C(217), UINT8_C( 34),    UINT8_MAX, UINT8_C( 89),
+        UINT8_C(115), UINT8_C( 51), UINT8_C(146), UINT8_C( 24), UINT8_C( 57), UINT8_C( 53), UINT8_C( 46), UINT8_C(115) },
+      { UINT8_C(126), UINT8_C(234), UINT8_C(167), UINT8_C(202), UINT8_C(236), UINT8_C(145), UINT8_C(127), UINT8_C( 44),
+        UINT8_C(185), UINT8_C( 25), UINT8_C( 73), UINT8_C(140), UINT8_C( 28), UINT8_C(154), UINT8_C(151), UINT8_C(185) },
+      { UINT8_C( 95), UINT8_C(250), UINT8_C(233), UINT8_C(146), UINT8_C(251), UINT8_C(132), UINT8_C( 31), UINT8_C( 11),
+        UINT8_C(238), UINT8_C(102), UINT8_C( 50), UINT8_C(227), UINT8_C(  7), UINT8_C(166), UINT8_C(165), UINT8_C(238) },
+      { UINT8_C( 79), UINT8_C(238), UINT8_C(242), UINT8_C(156), UINT8_C(238), UINT8_C(145), UINT8_C( 23), UINT8_C( 18),
+        UINT8_C(227), UINT8_C(113), UINT8_C( 36), UINT8_C(224), UINT8_C( 25), UINT8_C(169), UINT8_C(161), UINT8_C(227) },
+      { UINT8_C( 78), UINT8_C(236), UINT8_C(247), UINT8_C(155), UINT8_C(235), UINT8_C(145), UINT8_C( 21), UINT8_C( 22),
+        UINT8_C(224), UINT8_C(115), UINT8_C( 37), UINT8_C(231), UINT8_C( 25), UINT8_C(170), UINT8_C(160), UINT8_C(231) } },
+    { { UINT8_C( 62), UINT8_C(179), UINT8_C(176), UINT8_C( 90), UINT8_C(116), UINT8_C(118), UINT8_C(150), UINT8_C( 10),
+        UINT8_C(101), UINT8_C( 93), UINT8_C( 85), UINT8_C( 25), UINT8_C(137), UINT8_C( 48), UINT8_C( 89), UINT8_C( 21) },
+      { UINT8_C( 19), UINT8_C(213), UINT8_C( 10), UINT8_C(151), UINT8_C(225), UINT8_C(182), UINT8_C( 94), UINT8_C(190),
+        UINT8_C( 69), UINT8_C(238), UINT8_C(158), UINT8_C(186), UINT8_C(  6), UINT8_C( 87), UINT8_C(150), UINT8_C(103) },
+      { UINT8_C(  9), UINT8_C(234), UINT8_C(133), UINT8_C( 75), UINT8_C(112), UINT8_C( 91), UINT8_C(175), UINT8_C( 95),
+        UINT8_C( 34), UINT8_C(119), UINT8_C( 79), UINT8_C( 93), UINT8_C(131), UINT8_C( 43), UINT8_C( 75), UINT8_C( 51) },
+      { UINT8_C( 34), UINT8_C(186), UINT8_C(161), UINT8_C( 82), UINT8_C(124), UINT8_C(118), UINT8_C(139), UINT8_C( 23),
+        UINT8_C(104), UINT8_C( 93), UINT8_C( 83), UINT8_C( 23), UINT8_C(128), UINT8_C( 42), UINT8_C( 82), UINT8_C( 12) },
+      { UINT8_C( 56), UINT8_C(182), UINT8_C(176), UINT8_C( 92), UINT8_C(119), UINT8_C(117), UINT8_C(146), UINT8_C( 13),
+        UINT8_C( 98), UINT8_C( 95), UINT8_C( 84), UINT8_C( 29), UINT8_C(136), UINT8_C( 50), UINT8_C( 92), UINT8_C( 19) },
+      { UINT8_C( 62), UINT8_C(179), UINT8_C(176), UINT8_C( 90), UINT8_C(116), UINT8_C(118), UINT8_C(150), UINT8_C( 10),
+        UINT8_C(101), UINT8_C( 93), UINT8_C( 85), UINT8_C( 25), UINT8_C(137), UINT8_C( 48), UINT8_C( 89), UINT8_C( 21) } },
+    { { UINT8_C(149), UINT8_C(118), UINT8_C(141), UINT8_C(  4), UINT8_C(172), UINT8_C( 72), UINT8_C(254), UINT8_C(213),
+        UINT8_C(252), UINT8_C( 21), UINT8_C(220), UINT8_C(193), UINT8_C(106), UINT8_C(151), UINT8_C(127), UINT8_C(160) },
+      { UINT8_C( 64), UINT8_C(190), UINT8_C(234), UINT8_C(219), UINT8_C(208), UINT8_C(167), UINT8_C( 94), UINT8_C(208),
+        UINT8_C(210), UINT8_C( 45), UINT8_C( 45), UINT8_C(169), UINT8_C(119), UINT8_C(239), UINT8_C(168), UINT8_C(139) },
+      { UINT8_C(160), UINT8_C( 95), UINT8_C(245), UINT8_C(109), UINT8_C(232), UINT8_C( 83), UINT8_C(175), UINT8_C(232),
+        UINT8_C(233), UINT8_C( 22), UINT8_C(150), UINT8_C(212), UINT8_C( 59), UINT8_C(247), UINT8_C( 84), UINT8_C(197) },
+      { UINT8_C(136), UINT8_C(119), UINT8_C(157), UINT8_C( 27), UINT8_C(186), UINT8_C( 84), UINT8_C(235), UINT8_C(218),
+        UINT8_C(250), UINT8_C(  5), UINT8_C(197), UINT8_C(213), UINT8_C(110), UINT8_C(157), UINT8_C(117), UINT8_C(177) },
+      { UINT8_C(146), UINT8_C(117), UINT8_C(143), UINT8_C(  6), UINT8_C(174), UINT8_C( 77), UINT8_C(250), UINT8_C(214),
+        UINT8_C(254), UINT8_C( 17), UINT8_C(217), UINT8_C(197), UINT8_C(107), UINT8_C(151), UINT8_C(125), UINT8_C(164) },
+      { UINT8_C(149), UINT8_C(118), UINT8_C(141), UINT8_C(  4), UINT8_C(172), UINT8_C( 72), UINT8_C(254), UINT8_C(213),
+        UINT8_C(252), UINT8_C( 21), UINT8_C(220), UINT8_C(193), UINT8_C(106), UINT8_C(151), UINT8_C(127), UINT8_C(160) } },
+    { { UINT8_C(251), UINT8_C( 59), UINT8_C(135), UINT8_C( 42), UINT8_C(217), UINT8_C(160), UINT8_C(104), UINT8_C(252),
+        UINT8_C( 76), UINT8_C( 52), UINT8_C( 54), UINT8_C( 52), UINT8_C(  4), UINT8_C( 45), UINT8_C( 95), UINT8_C( 44) },
+      { UINT8_C( 37), UINT8_C(195), UINT8_C(106), UINT8_C( 75), UINT8_C(208), UINT8_C( 91), UINT8_C(208), UINT8_C(113),
+        UINT8_C(228), UINT8_C(219), UINT8_C( 42), UINT8_C( 59), UINT8_C(100), UINT8_C(142), UINT8_C(196), UINT8_C( 73) },
+      { UINT8_C(146), UINT8_C( 97), UINT8_C(181), UINT8_C( 37), UINT8_C(232), UINT8_C(173), UINT8_C(104), UINT8_C(184),
+        UINT8_C(114), UINT8_C(109), UINT8_C( 21), UINT8_C( 29), UINT8_C( 50), UINT8_C( 71), UINT8_C( 98), UINT8_C( 36) },
+      { UINT8_C(228), UINT8_C( 56), UINT8_C(141), UINT8_C( 41), UINT8_C(218), UINT8_C(171), UINT8_C(122), UINT8_C(238),
+        UINT8_C( 92), UINT8_C( 59), UINT8_C( 37), UINT8_C( 39), UINT8_C( 12), UINT8_C( 49), UINT8_C( 88), UINT8_C( 41) },
+      { UINT8_C(249), UINT8_C( 62), UINT8_C(131), UINT8_C( 42), UINT8_C(222), UINT8_C(162), UINT8_C(110), UINT8_C(251),
+        UINT8_C( 79), UINT8_C( 54), UINT8_C( 49), UINT8_C( 49), UINT8_C(  3), UINT8_C( 44), UINT8_C( 94), UINT8_C( 42) },
+      { UINT8_C(251), UINT8_C( 59), UINT8_C(135), UINT8_C( 42), UINT8_C(217), UINT8_C(160), UINT8_C(104), UINT8_C(252),
+        UINT8_C( 76), UINT8_C( 52), UINT8_C( 54), UINT8_C( 52), UINT8_C(  4), UINT8_C( 45), UINT8_C( 95), UINT8_C( 44) } },
+    { { UINT8_C(110), UINT8_C( 89), UINT8_C(194),    UINT8_MAX, UINT8_C(191), UINT8_C( 52), UINT8_C(254), UINT8_C(236),
+        UINT8_C(209), UINT8_C( 67), UINT8_C(137), UINT8_C(243), UINT8_C( 90), UINT8_C(196), UINT8_C( 91), UINT8_C(104) },
+      { UINT8_C(127), UINT8_C(  6), UINT8_C(184), UINT8_C(238), UINT8_C(138), UINT8_C( 83), UINT8_C(226), UINT8_C( 14),
+        UINT8_C(221), UINT8_C( 38), UINT8_C( 65), UINT8_C( 74), UINT8_C(216), UINT8_C(132), UINT8_C(130), UINT8_C(211) },
+      { UINT8_C( 63), UINT8_C(  3), UINT8_C(220), UINT8_C(247), UINT8_C(197), UINT8_C( 41), UINT8_C(241), UINT8_C(135),
+        UINT8_C(238), UINT8_C( 19), UINT8_C(160), UINT8_C(165), UINT8_C(108), UINT8_C(194), UINT8_C( 65), UINT8_C(105) },
+      { UINT8_C(111), UINT8_C( 64), UINT8_C(215), UINT8_C(253), UINT8_C(177), UINT8_C( 42), UINT8_C(252), UINT8_C(225),
+        UINT8_C(219), UINT8_C( 68), UINT8_C(136), UINT8_C(233), UINT8_C( 91), UINT8_C(208), UINT8_C( 80), UINT8_C(122) },
+      { UINT8_C(107), UINT8_C( 88), UINT8_C(197),    UINT8_MAX, UINT8_C(188), UINT8_C( 50),    UINT8_MAX, UINT8_C(232),
+        UINT8_C(214), UINT8_C( 65), UINT8_C(138), UINT8_C(242), UINT8_C( 94), UINT8_C(196), UINT8_C( 92), UINT8_C(110) },
+      { UINT8_C(110), UINT8_C( 89), UINT8_C(194),    UINT8_MAX, UINT8_C(191), UINT8_C( 52), UINT8_C(254), UINT8_C(236),
+        UINT8_C(209), UINT8_C( 67), UINT8_C(137), UINT8_C(243), UINT8_C( 90), UINT8_C(196), UINT8_C( 91), UINT8_C(104) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+
+    simde_uint8x16_t r1 = simde_vsriq_n_u8(a, b, 1);
+    simde_uint8x16_t r3 = simde_vsriq_n_u8(a, b, 3);
+    simde_uint8x16_t r5 = simde_vsriq_n_u8(a, b, 5);
+    simde_uint8x16_t r8 = simde_vsriq_n_u8(a, b, 8);
+
+    simde_test_arm_neon_assert_equal_u8x16(r1, simde_vld1q_u8(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u8x16(r3, simde_vld1q_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x16(r5, simde_vld1q_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x16(r8, simde_vld1q_u8(test_vec[i].r8));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x16_t a = simde_test_arm_neon_random_u8x16();
+    simde_uint8x16_t b = simde_test_arm_neon_random_u8x16();
+
+    simde_uint8x16_t r1 = simde_vsriq_n_u8(a, b, 1);
+    simde_uint8x16_t r3 = simde_vsriq_n_u8(a, b, 3);
+    simde_uint8x16_t r5 = simde_vsriq_n_u8(a, b, 5);
+    simde_uint8x16_t r8 = simde_vsriq_n_u8(a, b, 8);
+
+    simde_test_arm_neon_write_u8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r3, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r8, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint16_t r1[8];
+    uint16_t r6[8];
+    uint16_t r11[8];
+    uint16_t r16[8];
+  } test_vec[] = {
+    { { UINT16_C( 4048), UINT16_C(13459), UINT16_C(39357), UINT16_C(11752), UINT16_C(13113), UINT16_C(59291), UINT16_C(62524), UINT16_C(26956) },
+      { UINT16_C(48844), UINT16_C(19382), UINT16_C(56041), UINT16_C( 1213), UINT16_C(54298), UINT16_C(22834), UINT16_C(42532), UINT16_C(25674) },
+      { UINT16_C(24422), UINT16_C( 9691), UINT16_C(60788), UINT16_C(  606), UINT16_C(27149), UINT16_C(44185), UINT16_C(54034), UINT16_C(12837) },
+      { UINT16_C( 3835), UINT16_C(13614), UINT16_C(39787), UINT16_C(11282), UINT16_C(13136), UINT16_C(58724), UINT16_C(63128), UINT16_C(27025) },
+      { UINT16_C( 4055), UINT16_C(13449), UINT16_C(39355), UINT16_C(11744), UINT16_C(13114), UINT16_C(59275), UINT16_C(62516), UINT16_C(26956) },
+      { UINT16_C( 4048), UINT16_C(13459), UINT16_C(39357), UINT16_C(11752), UINT16_C(13113), UINT16_C(59291), UINT16_C(62524), UINT16_C(26956) } },
+    { { UINT16_C(56138), UINT16_C(  481), UINT16_C(58650), UINT16_C(39768), UINT16_C(32053), UINT16_C(42504), UINT16_C(53227), UINT16_C( 3184) },
+      { UINT16_C(49421), UINT16_C(62335), UINT16_C(53319), UINT16_C(12171), UINT16_C(33566), UINT16_C(54800), UINT16_C(44173), UINT16_C(18355) },
+      { UINT16_C(57478), UINT16_C(31167), UINT16_C(59427), UINT16_C(38853), UINT16_C(16783), UINT16_C(60168), UINT16_C(54854), UINT16_C( 9177) },
+      { UINT16_C(56068), UINT16_C(  973), UINT16_C(59201), UINT16_C(39102), UINT16_C(32268), UINT16_C(42840), UINT16_C(52914), UINT16_C( 3358) },
+      { UINT16_C(56152), UINT16_C(  510), UINT16_C(58650), UINT16_C(39749), UINT16_C(32048), UINT16_C(42522), UINT16_C(53237), UINT16_C( 3176) },
+      { UINT16_C(56138), UINT16_C(  481), UINT16_C(58650), UINT16_C(39768), UINT16_C(32053), UINT16_C(42504), UINT16_C(53227), UINT16_C( 3184) } },
+    { { UINT16_C(42500), UINT16_C(34294), UINT16_C(36869), UINT16_C(30311), UINT16_C(  828), UINT16_C(57422), UINT16_C(57768), UINT16_C( 9715) },
+      { UINT16_C(29200), UINT16_C(57987), UINT16_C(40241), UINT16_C( 4661), UINT16_C(24454), UINT16_C( 8637), UINT16_C(62513), UINT16_C(58536) },
+      { UINT16_C(47368), UINT16_C(61761), UINT16_C(52888), UINT16_C( 2330), UINT16_C(12227), UINT16_C(37086), UINT16_C(64024), UINT16_C(29268) },
+      { UINT16_C(42440), UINT16_C(34698), UINT16_C(37492), UINT16_C(29768), UINT16_C(  382), UINT16_C(57478), UINT16_C(58320), UINT16_C(10130) },
+      { UINT16_C(42510), UINT16_C(34300), UINT16_C(36883), UINT16_C(30306), UINT16_C(  811), UINT16_C(57412), UINT16_C(57790), UINT16_C( 9724) },
+      { UINT16_C(42500), UINT16_C(34294), UINT16_C(36869), UINT16_C(30311), UINT16_C(  828), UINT16_C(57422), UINT16_C(57768), UINT16_C( 9715) } },
+    { { UINT16_C(49331), UINT16_C(29300), UINT16_C(53867), UINT16_C(32859), UINT16_C(29042), UINT16_C(21818), UINT16_C(39546), UINT16_C(28184) },
+      { UINT16_C( 5509), UINT16_C(44313), UINT16_C(61002), UINT16_C(55074), UINT16_C(  591), UINT16_C(60206), UINT16_C(31367), UINT16_C(26744) },
+      { UINT16_C(35522), UINT16_C(22156), UINT16_C(63269), UINT16_C(60305), UINT16_C(  295), UINT16_C(30103), UINT16_C(48451), UINT16_C(13372) },
+      { UINT16_C(49238), UINT16_C(29364), UINT16_C(54201), UINT16_C(33628), UINT16_C(28681), UINT16_C(22444), UINT16_C(39402), UINT16_C(28065) },
+      { UINT16_C(49314), UINT16_C(29301), UINT16_C(53885), UINT16_C(32858), UINT16_C(29024), UINT16_C(21821), UINT16_C(39535), UINT16_C(28173) },
+      { UINT16_C(49331), UINT16_C(29300), UINT16_C(53867), UINT16_C(32859), UINT16_C(29042), UINT16_C(21818), UINT16_C(39546), UINT16_C(28184) } },
+    { { UINT16_C(17921), UINT16_C(40449), UINT16_C(33021), UINT16_C(53878), UINT16_C(18856), UINT16_C( 8472), UINT16_C(24469), UINT16_C(44729) },
+      { UINT16_C(55169), UINT16_C(24030), UINT16_C(29250), UINT16_C(14369), UINT16_C(43964), UINT16_C(27674), UINT16_C( 7156), UINT16_C(11161) },
+      { UINT16_C(27584), UINT16_C(44783), UINT16_C(47393), UINT16_C(39952), UINT16_C(21982), UINT16_C(13837), UINT16_C( 3578), UINT16_C(38348) },
+      { UINT16_C(18270), UINT16_C(40311), UINT16_C(33225), UINT16_C(53472), UINT16_C(19118), UINT16_C( 8624), UINT16_C(23663), UINT16_C(44206) },
+      { UINT16_C(17946), UINT16_C(40459), UINT16_C(33006), UINT16_C(53863), UINT16_C(18869), UINT16_C( 8461), UINT16_C(24451), UINT16_C(44709) },
+      { UINT16_C(17921), UINT16_C(40449), UINT16_C(33021), UINT16_C(53878), UINT16_C(18856), UINT16_C( 8472), UINT16_C(24469), UINT16_C(44729) } },
+    { { UINT16_C( 6729), UINT16_C( 1251), UINT16_C(16208), UINT16_C(25361), UINT16_C(26760), UINT16_C(57305), UINT16_C(33306), UINT16_C(18468) },
+      { UINT16_C(12785), UINT16_C(  718), UINT16_C(18026), UINT16_C(12642), UINT16_C( 4768), UINT16_C(57856), UINT16_C(13926), UINT16_C(60697) },
+      { UINT16_C( 6392), UINT16_C(  359), UINT16_C( 9013), UINT16_C( 6321), UINT16_C( 2384), UINT16_C(61696), UINT16_C(39731), UINT16_C(30348) },
+      { UINT16_C( 6343), UINT16_C( 1035), UINT16_C(15641), UINT16_C(24773), UINT16_C(26698), UINT16_C(57224), UINT16_C(32985), UINT16_C(19380) },
+      { UINT16_C( 6726), UINT16_C( 1248), UINT16_C(16200), UINT16_C(25350), UINT16_C(26754), UINT16_C(57308), UINT16_C(33286), UINT16_C(18493) },
+      { UINT16_C( 6729), UINT16_C( 1251), UINT16_C(16208), UINT16_C(25361), UINT16_C(26760), UINT16_C(57305), UINT16_C(33306), UINT16_C(18468) } },
+    { { UINT16_C(61630), UINT16_C(12562), UINT16_C(64403), UINT16_C(44968), UINT16_C(59803), UINT16_C( 8495), UINT16_C(41888), UINT16_C( 4837) },
+      { UINT16_C(15383), UINT16_C(22355), UINT16_C(18705), UINT16_C(63248), UINT16_C(56295), UINT16_C(28736), UINT16_C(49407), UINT16_C( 5745) },
+      { UINT16_C(40459), UINT16_C(11177), UINT16_C(42120), UINT16_C(64392), UINT16_C(60915), UINT16_C(14368), UINT16_C(57471), UINT16_C( 2872) },
+      { UINT16_C(61680), UINT16_C(12637), UINT16_C(63780), UINT16_C(45020), UINT16_C(60271), UINT16_C( 8641), UINT16_C(41731), UINT16_C( 4185) },
+      { UINT16_C(61607), UINT16_C(12554), UINT16_C(64393), UINT16_C(44990), UINT16_C(59803), UINT16_C( 8494), UINT16_C(41912), UINT16_C( 4834) },
+      { UINT16_C(61630), UINT16_C(12562), UINT16_C(64403), UINT16_C(44968), UINT16_C(59803), UINT16_C( 8495), UINT16_C(41888), UINT16_C( 4837) } },
+    { { UINT16_C(19926), UINT16_C(16777), UINT16_C(18522), UINT16_C(38650), UINT16_C(61959), UINT16_C(50779), UINT16_C(36013), UINT16_C(19468) },
+      { UINT16_C(53384), UINT16_C(11662), UINT16_C(37656), UINT16_C(34530), UINT16_C( 7226), UINT16_C(19766), UINT16_C(15469), UINT16_C(12484) },
+      { UINT16_C(26692), UINT16_C( 5831), UINT16_C(18828), UINT16_C(50033), UINT16_C(36381), UINT16_C(42651), UINT16_C(40502), UINT16_C( 6242) },
+      { UINT16_C(20290), UINT16_C(16566), UINT16_C(19020), UINT16_C(38427), UINT16_C(61552), UINT16_C(50484), UINT16_C(36081), UINT16_C(19651) },
+      { UINT16_C(19930), UINT16_C(16773), UINT16_C(18514), UINT16_C(38640), UINT16_C(61955), UINT16_C(50761), UINT16_C(36007), UINT16_C(19462) },
+      { UINT16_C(19926), UINT16_C(16777), UINT16_C(18522), UINT16_C(38650), UINT16_C(61959), UINT16_C(50779), UINT16_C(36013), UINT16_C(19468) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+
+    simde_uint16x8_t r1 = simde_vsriq_n_u16(a, b, 1);
+    simde_uint16x8_t r6 = simde_vsriq_n_u16(a, b, 6);
+    simde_uint16x8_t r11 = simde_vsriq_n_u16(a, b, 11);
+    simde_uint16x8_t r16 = simde_vsriq_n_u16(a, b, 16);
+
+    simde_test_arm_neon_assert_equal_u16x8(r1, simde_vld1q_u16(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u16x8(r6, simde_vld1q_u16(test_vec[i].r6));
+    simde_test_arm_neon_assert_equal_u16x8(r11, simde_vld1q_u16(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_u16x8(r16, simde_vld1q_u16(test_vec[i].r16));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a = simde_test_arm_neon_random_u16x8();
+    simde_uint16x8_t b = simde_test_arm_neon_random_u16x8();
+
+    simde_uint16x8_t r1 = simde_vsriq_n_u16(a, b, 1);
+    simde_uint16x8_t r6 = simde_vsriq_n_u16(a, b, 6);
+    simde_uint16x8_t r11 = simde_vsriq_n_u16(a, b, 11);
+    simde_uint16x8_t r16 = simde_vsriq_n_u16(a, b, 16);
+
+    simde_test_arm_neon_write_u16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r6, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r11, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, r16, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r1[4];
+    uint32_t r13[4];
+    uint32_t r22[4];
+    uint32_t r32[4];
+  } test_vec[] = {
+    { { UINT32_C(2334269456), UINT32_C(1362801903), UINT32_C(1541926454), UINT32_C(1084740522) },
+      { UINT32_C(4060764031), UINT32_C(3118612442), UINT32_C( 650774697), UINT32_C(3306516886) },
+      { UINT32_C(4177865663), UINT32_C(1559306221), UINT32_C( 325387348), UINT32_C(1653258443) },
+      { UINT32_C(2334625874), UINT32_C(1363005201), UINT32_C(1541486160), UINT32_C(1084631211) },
+      { UINT32_C(2334270408), UINT32_C(1362802407), UINT32_C(1541926043), UINT32_C(1084740372) },
+      { UINT32_C(2334269456), UINT32_C(1362801903), UINT32_C(1541926454), UINT32_C(1084740522) } },
+    { { UINT32_C(1242756336), UINT32_C( 336559182), UINT32_C(4027474434), UINT32_C(1617796895) },
+      { UINT32_C(1339689343), UINT32_C( 978820590), UINT32_C(1191877387), UINT32_C(2303482203) },
+      { UINT32_C( 669844671), UINT32_C( 489410295), UINT32_C(2743422341), UINT32_C(1151741101) },
+      { UINT32_C(1242726096), UINT32_C( 336188092), UINT32_C(4027201620), UINT32_C(1617709666) },
+      { UINT32_C(1242756415), UINT32_C( 336559337), UINT32_C(4027474204), UINT32_C(1617796645) },
+      { UINT32_C(1242756336), UINT32_C( 336559182), UINT32_C(4027474434), UINT32_C(1617796895) } },
+    { { UINT32_C(2752228850), UINT32_C(3997896073), UINT32_C(3565127127), UINT32_C(4211897621) },
+      { UINT32_C( 492005823), UINT32_C(3494050979), UINT32_C(1934549013), UINT32_C(3692509796) },
+      { UINT32_C(2393486559), UINT32_C(3894509137), UINT32_C(3114758154), UINT32_C(3993738546) },
+      { UINT32_C(2752047771), UINT32_C(3998122519), UINT32_C(3564870263), UINT32_C(4212056249) },
+      { UINT32_C(2752228469), UINT32_C(3997896513), UINT32_C(3565127117), UINT32_C(4211898224) },
+      { UINT32_C(2752228850), UINT32_C(3997896073), UINT32_C(3565127127), UINT32_C(4211897621) } },
+    { { UINT32_C(3397696535), UINT32_C(3255394013), UINT32_C(2953159294), UINT32_C(4120615695) },
+      { UINT32_C(1764309449), UINT32_C(1504671612), UINT32_C(2453024284), UINT32_C(2498466321) },
+      { UINT32_C(3029638372), UINT32_C(2899819454), UINT32_C(3373995790), UINT32_C(3396716808) },
+      { UINT32_C(3397601609), UINT32_C(3255487867), UINT32_C(2953089457), UINT32_C(4120684380) },
+      { UINT32_C(3397696932), UINT32_C(3255393638), UINT32_C(2953159240), UINT32_C(4120615507) },
+      { UINT32_C(3397696535), UINT32_C(3255394013), UINT32_C(2953159294), UINT32_C(4120615695) } },
+    { { UINT32_C( 248674124), UINT32_C(2303490606), UINT32_C(4061121026), UINT32_C(1558784031) },
+      { UINT32_C(2974481803), UINT32_C(1129056740), UINT32_C(3776435946), UINT32_C(3942701937) },
+      { UINT32_C(1487240901), UINT32_C(2712012018), UINT32_C(4035701621), UINT32_C(1971350968) },
+      { UINT32_C( 248875607), UINT32_C(2303335008), UINT32_C(4061071550), UINT32_C(1559189510) },
+      { UINT32_C( 248673989), UINT32_C(2303490317), UINT32_C(4061121412), UINT32_C(1558784940) },
+      { UINT32_C( 248674124), UINT32_C(2303490606), UINT32_C(4061121026), UINT32_C(1558784031) } },
+    { { UINT32_C(1821350528), UINT32_C( 408337274), UINT32_C(4245222544), UINT32_C( 320769477) },
+      { UINT32_C(2325311823), UINT32_C(2769887859), UINT32_C(4107028651), UINT32_C(2425639010) },
+      { UINT32_C(1162655911), UINT32_C(1384943929), UINT32_C(4200997973), UINT32_C(1212819505) },
+      { UINT32_C(1821136075), UINT32_C( 408234185), UINT32_C(4245661282), UINT32_C( 320636066) },
+      { UINT32_C(1821350442), UINT32_C( 408337044), UINT32_C(4245223379), UINT32_C( 320769602) },
+      { UINT32_C(1821350528), UINT32_C( 408337274), UINT32_C(4245222544), UINT32_C( 320769477) } },
+    { { UINT32_C(1465856870), UINT32_C(2034916828), UINT32_C(3798514135), UINT32_C( 884396198) },
+      { UINT32_C( 125647517), UINT32_C(1183293577), UINT32_C(2867697760), UINT32_C(1498483833) },
+      { UINT32_C(  62823758), UINT32_C( 591646788), UINT32_C(3581332528), UINT32_C( 749241916) },
+      { UINT32_C(1465400297), UINT32_C(2034906173), UINT32_C(3798816620), UINT32_C( 884132488) },
+      { UINT32_C(1465856029), UINT32_C(2034916634), UINT32_C(3798514347), UINT32_C( 884396389) },
+      { UINT32_C(1465856870), UINT32_C(2034916828), UINT32_C(3798514135), UINT32_C( 884396198) } },
+    { { UINT32_C(4086881849), UINT32_C( 402875819), UINT32_C(2808654191), UINT32_C(3298178653) },
+      { UINT32_C(3945976471), UINT32_C(1795589746), UINT32_C( 935701277), UINT32_C(4039022396) },
+      { UINT32_C(4120471883), UINT32_C( 897794873), UINT32_C(2615334286), UINT32_C(4166994846) },
+      { UINT32_C(4087306646), UINT32_C( 402872372), UINT32_C(2808725037), UINT32_C(3298264564) },
+      { UINT32_C(4086882220), UINT32_C( 402875820), UINT32_C(2808654047), UINT32_C(3298179010) },
+      { UINT32_C(4086881849), UINT32_C( 402875819), UINT32_C(2808654191), UINT32_C(3298178653) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+
+    simde_uint32x4_t r1 = simde_vsriq_n_u32(a, b, 1);
+    simde_uint32x4_t r13 = simde_vsriq_n_u32(a, b, 13);
+    simde_uint32x4_t r22 = simde_vsriq_n_u32(a, b, 22);
+    simde_uint32x4_t r32 = simde_vsriq_n_u32(a, b, 32);
+
+    simde_test_arm_neon_assert_equal_u32x4(r1, simde_vld1q_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x4(r13, simde_vld1q_u32(test_vec[i].r13));
+    simde_test_arm_neon_assert_equal_u32x4(r22, simde_vld1q_u32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_u32x4(r32, simde_vld1q_u32(test_vec[i].r32));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a = simde_test_arm_neon_random_u32x4();
+    simde_uint32x4_t b = simde_test_arm_neon_random_u32x4();
+
+    simde_uint32x4_t r1 = simde_vsriq_n_u32(a, b, 1);
+    simde_uint32x4_t r13 = simde_vsriq_n_u32(a, b, 13);
+    simde_uint32x4_t r22 = simde_vsriq_n_u32(a, b, 22);
+    simde_uint32x4_t r32 = simde_vsriq_n_u32(a, b, 32);
+
+    simde_test_arm_neon_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r13, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r22, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r32, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vsriq_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t r1[2];
+    uint64_t r19[2];
+    uint64_t r42[2];
+    uint64_t r64[2];
+  } test_vec[] = {
+    { { UINT64_C(10200934799355498630), UINT64_C( 2359744702171643915) },
+      { UINT64_C(15597048979254445090), UINT64_C(10230937507246416076) },
+      { UINT64_C(17021896526481998353), UINT64_C( 5115468753623208038) },
+      { UINT64_C(10200964379980930586), UINT64_C( 2359729796846362580) },
+      { UINT64_C(10200934799358958838), UINT64_C( 2359744702173118181) },
+      { UINT64_C(10200934799355498630), UINT64_C( 2359744702171643915) } },
+    { { UINT64_C( 2289799387154070856), UINT64_C(11001594354821278073) },
+      { UINT64_C(17611869627851253318), UINT64_C(11756888300592059965) },
+      { UINT64_C( 8805934813925626659), UINT64_C(15101816187150805790) },
+      { UINT64_C( 2289832527516642514), UINT64_C(11001612626709171351) },
+      { UINT64_C( 2289799387154291323), UINT64_C(11001594354822859318) },
+      { UINT64_C( 2289799387154070856), UINT64_C(11001594354821278073) } },
+    { { UINT64_C(10572381019994358829), UINT64_C(  656583006466144678) },
+      { UINT64_C(  768592765499933191), UINT64_C(  940572396007303697) },
+      { UINT64_C( 9607668419604742403), UINT64_C(  470286198003651848) },
+      { UINT64_C(10572377513087043985), UINT64_C(  656577361549167537) },
+      { UINT64_C(10572381019992926885), UINT64_C(  656583006462624613) },
+      { UINT64_C(10572381019994358829), UINT64_C(  656583006466144678) } },
+    { { UINT64_C(  731897433756894581), UINT64_C( 9634695900997406976) },
+      { UINT64_C(11858980919367015234), UINT64_C(14822614907929840662) },
+      { UINT64_C( 5929490459683507617), UINT64_C(16634679490819696139) },
+      { UINT64_C(  731892743030837536), UINT64_C( 9634705618467501234) },
+      { UINT64_C(  731897433757918436), UINT64_C( 9634695900998888736) },
+      { UINT64_C(  731897433756894581), UINT64_C( 9634695900997406976) } },
+    { { UINT64_C( 5201044380012802527), UINT64_C(14615855073966540628) },
+      { UINT64_C( 2707304626223410577), UINT64_C( 7757242033546567216) },
+      { UINT64_C( 1353652313111705288), UINT64_C(13101993053628059416) },
+      { UINT64_C( 5201029414689101338), UINT64_C(14615849252070421704) },
+      { UINT64_C( 5201044380009981073), UINT64_C(14615855073966352848) },
+      { UINT64_C( 5201044380012802527), UINT64_C(14615855073966540628) } },
+    { { UINT64_C( 6234126864950829133), UINT64_C(15627305855572208122) },
+      { UINT64_C(11705933337691250973), UINT64_C(14893353107873485042) },
+      { UINT64_C( 5852966668845625486), UINT64_C(16670048590791518329) },
+      { UINT64_C( 6234130111483556527), UINT64_C(15627308007559776424) },
+      { UINT64_C( 6234126864951581941), UINT64_C(15627305855575370740) },
+      { UINT64_C( 6234126864950829133), UINT64_C(15627305855572208122) } },
+    { { UINT64_C( 7686659072754812857), UINT64_C(17246194110228938152) },
+      { UINT64_C( 9725055944763702290), UINT64_C( 1616076124646484101) },
+      { UINT64_C( 4862527972381851145), UINT64_C(10031410099178017858) },
+      { UINT64_C( 7686642766203020814), UINT64_C(17246186011715012977) },
+      { UINT64_C( 7686659072755613077), UINT64_C(17246194110227127133) },
+      { UINT64_C( 7686659072754812857), UINT64_C(17246194110228938152) } },
+    { { UINT64_C(13598353391361189784), UINT64_C(11249532071866744385) },
+      { UINT64_C(14679723829752672006), UINT64_C( 3664442957666595209) },
+      { UINT64_C(16563233951731111811), UINT64_C(11055593515688073412) },
+      { UINT64_C(13598365599219678759), UINT64_C(11249506277332520684) },
+      { UINT64_C(13598353391363485238), UINT64_C(11249532071863695021) },
+      { UINT64_C(13598353391361189784), UINT64_C(11249532071866744385) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+
+    simde_uint64x2_t r1 = simde_vsriq_n_u64(a, b, 1);
+    simde_uint64x2_t r19 = simde_vsriq_n_u64(a, b, 19);
+    simde_uint64x2_t r42 = simde_vsriq_n_u64(a, b, 42);
+    simde_uint64x2_t r64 = simde_vsriq_n_u64(a, b, 64);
+
+    simde_test_arm_neon_assert_equal_u64x2(r1, simde_vld1q_u64(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u64x2(r19, simde_vld1q_u64(test_vec[i].r19));
+    simde_test_arm_neon_assert_equal_u64x2(r42, simde_vld1q_u64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_u64x2(r64, simde_vld1q_u64(test_vec[i].r64));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a = simde_test_arm_neon_random_u64x2();
+    simde_uint64x2_t b = simde_test_arm_neon_random_u64x2();
+
+    simde_uint64x2_t r1 = simde_vsriq_n_u64(a, b, 1);
+    simde_uint64x2_t r19 = simde_vsriq_n_u64(a, b, 19);
+    simde_uint64x2_t r42 = simde_vsriq_n_u64(a, b, 42);
+    simde_uint64x2_t r64 = simde_vsriq_n_u64(a, b, 64);
+
+    simde_test_arm_neon_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r19, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r42, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r64, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsrid_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsrid_n_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsri_n_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsriq_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1457 @@
+#define SIMDE_TEST_ARM_NEON_INSN st2
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st2.h"
+#include "../../../simde/arm/neon/ld2.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst2_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r0[2];
+    simde_float32 r1[2];
+    simde_float32 a[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   849.73), SIMDE_FLOAT32_C(   897.21) },
+      { SIMDE_FLOAT32_C(   784.87), SIMDE_FLOAT32_C(  -832.90) },
+      { SIMDE_FLOAT32_C(   849.73), SIMDE_FLOAT32_C(   784.87), SIMDE_FLOAT32_C(   897.21), SIMDE_FLOAT32_C(  -832.90) } },
+    { { SIMDE_FLOAT32_C(   184.05), SIMDE_FLOAT32_C(  -152.51) },
+      { SIMDE_FLOAT32_C(    60.18), SIMDE_FLOAT32_C(  -739.39) },
+      { SIMDE_FLOAT32_C(   184.05), SIMDE_FLOAT32_C(    60.18), SIMDE_FLOAT32_C(  -152.51), SIMDE_FLOAT32_C(  -739.39) } },
+    { { SIMDE_FLOAT32_C(  -616.01), SIMDE_FLOAT32_C(  -110.85) },
+      { SIMDE_FLOAT32_C(  -557.92), SIMDE_FLOAT32_C(   -89.93) },
+      { SIMDE_FLOAT32_C(  -616.01), SIMDE_FLOAT32_C(  -557.92), SIMDE_FLOAT32_C(  -110.85), SIMDE_FLOAT32_C(   -89.93) } },
+    { { SIMDE_FLOAT32_C(  -950.47), SIMDE_FLOAT32_C(  -828.45) },
+      { SIMDE_FLOAT32_C(   420.02), SIMDE_FLOAT32_C(  -157.50) },
+      { SIMDE_FLOAT32_C(  -950.47), SIMDE_FLOAT32_C(   420.02), SIMDE_FLOAT32_C(  -828.45), SIMDE_FLOAT32_C(  -157.50) } },
+    { { SIMDE_FLOAT32_C(    25.27), SIMDE_FLOAT32_C(   468.42) },
+      { SIMDE_FLOAT32_C(  -282.01), SIMDE_FLOAT32_C(  -884.89) },
+      { SIMDE_FLOAT32_C(    25.27), SIMDE_FLOAT32_C(  -282.01), SIMDE_FLOAT32_C(   468.42), SIMDE_FLOAT32_C(  -884.89) } },
+    { { SIMDE_FLOAT32_C(   566.20), SIMDE_FLOAT32_C(   178.25) },
+      { SIMDE_FLOAT32_C(   315.83), SIMDE_FLOAT32_C(   241.98) },
+      { SIMDE_FLOAT32_C(   566.20), SIMDE_FLOAT32_C(   315.83), SIMDE_FLOAT32_C(   178.25), SIMDE_FLOAT32_C(   241.98) } },
+    { { SIMDE_FLOAT32_C(   941.47), SIMDE_FLOAT32_C(  -274.41) },
+      { SIMDE_FLOAT32_C(   519.57), SIMDE_FLOAT32_C(  -262.63) },
+      { SIMDE_FLOAT32_C(   941.47), SIMDE_FLOAT32_C(   519.57), SIMDE_FLOAT32_C(  -274.41), SIMDE_FLOAT32_C(  -262.63) } },
+    { { SIMDE_FLOAT32_C(   144.09), SIMDE_FLOAT32_C(   321.06) },
+      { SIMDE_FLOAT32_C(  -371.22), SIMDE_FLOAT32_C(  -828.53) },
+      { SIMDE_FLOAT32_C(   144.09), SIMDE_FLOAT32_C(  -371.22), SIMDE_FLOAT32_C(   321.06), SIMDE_FLOAT32_C(  -828.53) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t r_ = { { simde_vld1_f32(test_vec[i].r0),
+                                 simde_vld1_f32(test_vec[i].r1) } };
+
+    simde_float32 a_[4];
+    simde_vst2_f32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_f32(a_);
+    simde_test_arm_neon_assert_equal_f32x2(r_.val[0], simde_vld1_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r_.val[1], simde_vld1_f32(test_vec[i].r1), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t a0 = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2_t a1 = simde_test_arm_neon_random_f32x2(-1000.0f, 1000.0f);
+    simde_float32x2x2_t a = { { a0, a1 } };
+    simde_float32 buf[4];
+    simde_vst2_f32(buf, a);
+
+    simde_test_arm_neon_write_f32x2(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x2(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 r0[1];
+    simde_float64 r1[1];
+    simde_float64 a[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   -51.87) },
+      { SIMDE_FLOAT64_C(   435.83) },
+      { SIMDE_FLOAT64_C(   -51.87), SIMDE_FLOAT64_C(   435.83) } },
+    { { SIMDE_FLOAT64_C(   181.22) },
+      { SIMDE_FLOAT64_C(  -105.10) },
+      { SIMDE_FLOAT64_C(   181.22), SIMDE_FLOAT64_C(  -105.10) } },
+    { { SIMDE_FLOAT64_C(   284.76) },
+      { SIMDE_FLOAT64_C(  -635.94) },
+      { SIMDE_FLOAT64_C(   284.76), SIMDE_FLOAT64_C(  -635.94) } },
+    { { SIMDE_FLOAT64_C(  -642.92) },
+      { SIMDE_FLOAT64_C(  -353.18) },
+      { SIMDE_FLOAT64_C(  -642.92), SIMDE_FLOAT64_C(  -353.18) } },
+    { { SIMDE_FLOAT64_C(   631.75) },
+      { SIMDE_FLOAT64_C(  -608.78) },
+      { SIMDE_FLOAT64_C(   631.75), SIMDE_FLOAT64_C(  -608.78) } },
+    { { SIMDE_FLOAT64_C(  -771.40) },
+      { SIMDE_FLOAT64_C(  -802.79) },
+      { SIMDE_FLOAT64_C(  -771.40), SIMDE_FLOAT64_C(  -802.79) } },
+    { { SIMDE_FLOAT64_C(  -922.13) },
+      { SIMDE_FLOAT64_C(  -448.87) },
+      { SIMDE_FLOAT64_C(  -922.13), SIMDE_FLOAT64_C(  -448.87) } },
+    { { SIMDE_FLOAT64_C(   145.64) },
+      { SIMDE_FLOAT64_C(   641.33) },
+      { SIMDE_FLOAT64_C(   145.64), SIMDE_FLOAT64_C(   641.33) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t r_ = { { simde_vld1_f64(test_vec[i].r0),
+                                 simde_vld1_f64(test_vec[i].r1) } };
+
+    simde_float64 a_[2];
+    simde_vst2_f64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_f64(a_);
+    simde_test_arm_neon_assert_equal_f64x1(r_.val[0], simde_vld1_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r_.val[1], simde_vld1_f64(test_vec[i].r1), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x1_t a0 = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1_t a1 = simde_test_arm_neon_random_f64x1(-1000.0, 1000.0);
+    simde_float64x1x2_t a = { { a0, a1 } };
+    simde_float64 buf[2];
+    simde_vst2_f64(buf, a);
+
+    simde_test_arm_neon_write_f64x1(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x1(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t r0[8];
+    int8_t r1[8];
+    int8_t a[16];
+  } test_vec[] = {
+    { {  INT8_C(  84),  INT8_C(  27),  INT8_C(  94), -INT8_C(  26),  INT8_C(  73), -INT8_C( 118),  INT8_C(  78), -INT8_C(  27) },
+      { -INT8_C(  57),  INT8_C( 116), -INT8_C( 116),  INT8_C(  55),  INT8_C(  66),  INT8_C(  38),  INT8_C(  27), -INT8_C(  98) },
+      {  INT8_C(  84), -INT8_C(  57),  INT8_C(  27),  INT8_C( 116),  INT8_C(  94), -INT8_C( 116), -INT8_C(  26),  INT8_C(  55),
+         INT8_C(  73),  INT8_C(  66), -INT8_C( 118),  INT8_C(  38),  INT8_C(  78),  INT8_C(  27), -INT8_C(  27), -INT8_C(  98) } },
+    { { -INT8_C(  56),  INT8_C(  30), -INT8_C(  75), -INT8_C(  53), -INT8_C(  44),  INT8_C( 126),  INT8_C(  60),  INT8_C(  84) },
+      { -INT8_C( 117),  INT8_C(  36), -INT8_C(  21), -INT8_C(  66), -INT8_C( 105),  INT8_C(  25), -INT8_C(  14),  INT8_C(  98) },
+      { -INT8_C(  56), -INT8_C( 117),  INT8_C(  30),  INT8_C(  36), -INT8_C(  75), -INT8_C(  21), -INT8_C(  53), -INT8_C(  66),
+        -INT8_C(  44), -INT8_C( 105),  INT8_C( 126),  INT8_C(  25),  INT8_C(  60), -INT8_C(  14),  INT8_C(  84),  INT8_C(  98) } },
+    { {  INT8_C(  42),  INT8_C( 115), -INT8_C(   7),  INT8_C(   8),  INT8_C(  14), -INT8_C(  95),  INT8_C( 106),  INT8_C( 100) },
+      {  INT8_C(   5),  INT8_C(  41), -INT8_C(  49),  INT8_C(  57), -INT8_C(  81),  INT8_C(   3), -INT8_C(   7),  INT8_C(  56) },
+      {  INT8_C(  42),  INT8_C(   5),  INT8_C( 115),  INT8_C(  41), -INT8_C(   7), -INT8_C(  49),  INT8_C(   8),  INT8_C(  57),
+         INT8_C(  14), -INT8_C(  81), -INT8_C(  95),  INT8_C(   3),  INT8_C( 106), -INT8_C(   7),  INT8_C( 100),  INT8_C(  56) } },
+    { { -INT8_C(  50), -INT8_C(  67), -INT8_C(  14),  INT8_C(  14), -INT8_C( 119), -INT8_C(  15), -INT8_C(   4),  INT8_C( 113) },
+      { -INT8_C(  65),  INT8_C(  23),  INT8_C(  88),  INT8_C(   4), -INT8_C(   7), -INT8_C(  55),  INT8_C(  96),  INT8_C( 125) },
+      { -INT8_C(  50), -INT8_C(  65), -INT8_C(  67),  INT8_C(  23), -INT8_C(  14),  INT8_C(  88),  INT8_C(  14),  INT8_C(   4),
+        -INT8_C( 119), -INT8_C(   7), -INT8_C(  15), -INT8_C(  55), -INT8_C(   4),  INT8_C(  96),  INT8_C( 113),  INT8_C( 125) } },
+    { {  INT8_C(  49),  INT8_C(   9),  INT8_C(  19),  INT8_C(  67),  INT8_C( 119), -INT8_C( 116),  INT8_C(  50), -INT8_C(  63) },
+      { -INT8_C(  18),  INT8_C( 117), -INT8_C(  13),  INT8_C(  75),  INT8_C(  55),  INT8_C(  23),  INT8_C(  26), -INT8_C( 114) },
+      {  INT8_C(  49), -INT8_C(  18),  INT8_C(   9),  INT8_C( 117),  INT8_C(  19), -INT8_C(  13),  INT8_C(  67),  INT8_C(  75),
+         INT8_C( 119),  INT8_C(  55), -INT8_C( 116),  INT8_C(  23),  INT8_C(  50),  INT8_C(  26), -INT8_C(  63), -INT8_C( 114) } },
+    { { -INT8_C( 121), -INT8_C(  90),  INT8_C(  43), -INT8_C(  80), -INT8_C( 117), -INT8_C( 114), -INT8_C(  48),  INT8_C(  61) },
+      {  INT8_C(  64),  INT8_C(  25),  INT8_C( 107),  INT8_C(  42), -INT8_C(  26),  INT8_C(   3),  INT8_C( 113), -INT8_C(  61) },
+      { -INT8_C( 121),  INT8_C(  64), -INT8_C(  90),  INT8_C(  25),  INT8_C(  43),  INT8_C( 107), -INT8_C(  80),  INT8_C(  42),
+        -INT8_C( 117), -INT8_C(  26), -INT8_C( 114),  INT8_C(   3), -INT8_C(  48),  INT8_C( 113),  INT8_C(  61), -INT8_C(  61) } },
+    { {  INT8_C(  87), -INT8_C(  88), -INT8_C(  28),  INT8_C( 106), -INT8_C(  48),  INT8_C(  42), -INT8_C(  27), -INT8_C(  99) },
+      { -INT8_C(  80), -INT8_C(  49),  INT8_C( 105),  INT8_C(  17), -INT8_C(  79), -INT8_C(  11), -INT8_C(  44), -INT8_C(  27) },
+      {  INT8_C(  87), -INT8_C(  80), -INT8_C(  88), -INT8_C(  49), -INT8_C(  28),  INT8_C( 105),  INT8_C( 106),  INT8_C(  17),
+        -INT8_C(  48), -INT8_C(  79),  INT8_C(  42), -INT8_C(  11), -INT8_C(  27), -INT8_C(  44), -INT8_C(  99), -INT8_C(  27) } },
+    { { -INT8_C(  93), -INT8_C(  66),  INT8_C(  61), -INT8_C( 117),  INT8_C(  75),  INT8_C( 108),  INT8_C( 104),  INT8_C(  76) },
+      { -INT8_C(  59), -INT8_C(  36), -INT8_C( 114), -INT8_C( 100), -INT8_C( 116),  INT8_C(  13), -INT8_C(  45),  INT8_C(  72) },
+      { -INT8_C(  93), -INT8_C(  59), -INT8_C(  66), -INT8_C(  36),  INT8_C(  61), -INT8_C( 114), -INT8_C( 117), -INT8_C( 100),
+         INT8_C(  75), -INT8_C( 116),  INT8_C( 108),  INT8_C(  13),  INT8_C( 104), -INT8_C(  45),  INT8_C(  76),  INT8_C(  72) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t r_ = { { simde_vld1_s8(test_vec[i].r0),
+                              simde_vld1_s8(test_vec[i].r1) } };
+
+    int8_t a_[16];
+    simde_vst2_s8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s8(a_);
+    simde_test_arm_neon_assert_equal_i8x8(r_.val[0], simde_vld1_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x8(r_.val[1], simde_vld1_s8(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x8_t a0 = simde_test_arm_neon_random_i8x8();
+    simde_int8x8_t a1 = simde_test_arm_neon_random_i8x8();
+    simde_int8x8x2_t a = { { a0, a1 } };
+    int8_t buf[16];
+    simde_vst2_s8(buf, a);
+
+    simde_test_arm_neon_write_i8x8(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x8(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi8(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t r0[4];
+    int16_t r1[4];
+    int16_t a[8];
+  } test_vec[] = {
+    { {  INT16_C(  7107),  INT16_C(  1658), -INT16_C( 24168),  INT16_C(  9123) },
+      {  INT16_C( 21790), -INT16_C(  2299), -INT16_C( 28879), -INT16_C( 17778) },
+      {  INT16_C(  7107),  INT16_C( 21790),  INT16_C(  1658), -INT16_C(  2299), -INT16_C( 24168), -INT16_C( 28879),  INT16_C(  9123), -INT16_C( 17778) } },
+    { { -INT16_C( 10791),  INT16_C( 28210),  INT16_C( 16276),  INT16_C( 10834) },
+      { -INT16_C(  3178), -INT16_C( 22242),  INT16_C(  5149),  INT16_C( 22143) },
+      { -INT16_C( 10791), -INT16_C(  3178),  INT16_C( 28210), -INT16_C( 22242),  INT16_C( 16276),  INT16_C(  5149),  INT16_C( 10834),  INT16_C( 22143) } },
+    { { -INT16_C( 28704), -INT16_C( 20412), -INT16_C( 30028),  INT16_C(  7447) },
+      {  INT16_C( 15406), -INT16_C(  7411), -INT16_C( 28781), -INT16_C(  2778) },
+      { -INT16_C( 28704),  INT16_C( 15406), -INT16_C( 20412), -INT16_C(  7411), -INT16_C( 30028), -INT16_C( 28781),  INT16_C(  7447), -INT16_C(  2778) } },
+    { {  INT16_C( 30849), -INT16_C( 13138),  INT16_C( 29464), -INT16_C(   766) },
+      { -INT16_C( 18457),  INT16_C( 17833),  INT16_C(   258),  INT16_C( 22162) },
+      {  INT16_C( 30849), -INT16_C( 18457), -INT16_C( 13138),  INT16_C( 17833),  INT16_C( 29464),  INT16_C(   258), -INT16_C(   766),  INT16_C( 22162) } },
+    { {  INT16_C( 24718),  INT16_C(  1549), -INT16_C( 14051), -INT16_C(  2844) },
+      {  INT16_C(  9297), -INT16_C( 16438), -INT16_C(  8691),  INT16_C( 26329) },
+      {  INT16_C( 24718),  INT16_C(  9297),  INT16_C(  1549), -INT16_C( 16438), -INT16_C( 14051), -INT16_C(  8691), -INT16_C(  2844),  INT16_C( 26329) } },
+    { {  INT16_C( 13342), -INT16_C( 13528), -INT16_C( 20898),  INT16_C(  1977) },
+      {  INT16_C( 11348), -INT16_C( 22636),  INT16_C( 29446), -INT16_C( 16657) },
+      {  INT16_C( 13342),  INT16_C( 11348), -INT16_C( 13528), -INT16_C( 22636), -INT16_C( 20898),  INT16_C( 29446),  INT16_C(  1977), -INT16_C( 16657) } },
+    { {  INT16_C( 27692), -INT16_C(  2970),  INT16_C(  5360),  INT16_C( 27523) },
+      { -INT16_C( 19687),  INT16_C( 18170),  INT16_C( 31468), -INT16_C( 26389) },
+      {  INT16_C( 27692), -INT16_C( 19687), -INT16_C(  2970),  INT16_C( 18170),  INT16_C(  5360),  INT16_C( 31468),  INT16_C( 27523), -INT16_C( 26389) } },
+    { { -INT16_C( 20382), -INT16_C(   525), -INT16_C( 30204), -INT16_C( 18321) },
+      { -INT16_C( 29107),  INT16_C( 11642), -INT16_C( 31056), -INT16_C( 30643) },
+      { -INT16_C( 20382), -INT16_C( 29107), -INT16_C(   525),  INT16_C( 11642), -INT16_C( 30204), -INT16_C( 31056), -INT16_C( 18321), -INT16_C( 30643) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t r_ = { { simde_vld1_s16(test_vec[i].r0),
+                               simde_vld1_s16(test_vec[i].r1) } };
+
+    int16_t a_[8];
+    simde_vst2_s16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s16(a_);
+    simde_test_arm_neon_assert_equal_i16x4(r_.val[0], simde_vld1_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x4(r_.val[1], simde_vld1_s16(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x4_t a0 = simde_test_arm_neon_random_i16x4();
+    simde_int16x4_t a1 = simde_test_arm_neon_random_i16x4();
+    simde_int16x4x2_t a = { { a0, a1 } };
+    int16_t buf[8];
+    simde_vst2_s16(buf, a);
+
+    simde_test_arm_neon_write_i16x4(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x4(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi16(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t r0[2];
+    int32_t r1[2];
+    int32_t a[4];
+  } test_vec[] = {
+    { {  INT32_C(  1279017807),  INT32_C(  1139996531) },
+      { -INT32_C(   434850447), -INT32_C(    26334972) },
+      {  INT32_C(  1279017807), -INT32_C(   434850447),  INT32_C(  1139996531), -INT32_C(    26334972) } },
+    { {  INT32_C(   371044853),  INT32_C(   972797985) },
+      { -INT32_C(   529929734),  INT32_C(   267185802) },
+      {  INT32_C(   371044853), -INT32_C(   529929734),  INT32_C(   972797985),  INT32_C(   267185802) } },
+    { { -INT32_C(   586417346), -INT32_C(   472210196) },
+      {  INT32_C(  2138062560),  INT32_C(  1620684445) },
+      { -INT32_C(   586417346),  INT32_C(  2138062560), -INT32_C(   472210196),  INT32_C(  1620684445) } },
+    { { -INT32_C(   958000063),  INT32_C(    76674708) },
+      { -INT32_C(  1402879448),  INT32_C(  1962083932) },
+      { -INT32_C(   958000063), -INT32_C(  1402879448),  INT32_C(    76674708),  INT32_C(  1962083932) } },
+    { { -INT32_C(  1696196162),  INT32_C(  1768941135) },
+      {  INT32_C(  1252527025), -INT32_C(  1369053569) },
+      { -INT32_C(  1696196162),  INT32_C(  1252527025),  INT32_C(  1768941135), -INT32_C(  1369053569) } },
+    { {  INT32_C(  1372881428),  INT32_C(  1749609843) },
+      {  INT32_C(  1500576402), -INT32_C(   838619362) },
+      {  INT32_C(  1372881428),  INT32_C(  1500576402),  INT32_C(  1749609843), -INT32_C(   838619362) } },
+    { {  INT32_C(  1297817823),  INT32_C(  1175485792) },
+      { -INT32_C(   173075633), -INT32_C(   299894235) },
+      {  INT32_C(  1297817823), -INT32_C(   173075633),  INT32_C(  1175485792), -INT32_C(   299894235) } },
+    { {  INT32_C(  1465773446),  INT32_C(   689112003) },
+      {  INT32_C(  1664515524),  INT32_C(   183790235) },
+      {  INT32_C(  1465773446),  INT32_C(  1664515524),  INT32_C(   689112003),  INT32_C(   183790235) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t r_ = { { simde_vld1_s32(test_vec[i].r0),
+                               simde_vld1_s32(test_vec[i].r1) } };
+
+    int32_t a_[4];
+    simde_vst2_s32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s32(a_);
+    simde_test_arm_neon_assert_equal_i32x2(r_.val[0], simde_vld1_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x2(r_.val[1], simde_vld1_s32(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x2_t a0 = simde_test_arm_neon_random_i32x2();
+    simde_int32x2_t a1 = simde_test_arm_neon_random_i32x2();
+    simde_int32x2x2_t a = { { a0, a1 } };
+    int32_t buf[4];
+    simde_vst2_s32(buf, a);
+
+    simde_test_arm_neon_write_i32x2(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x2(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t r0[1];
+    int64_t r1[1];
+    int64_t a[2];
+  } test_vec[] = {
+    { { -INT64_C( 2086630767136850026) },
+      { -INT64_C( 6126140025210552585) },
+      { -INT64_C( 2086630767136850026), -INT64_C( 6126140025210552585) } },
+    { { -INT64_C( 4502508845359274387) },
+      { -INT64_C( 2151032598573173124) },
+      { -INT64_C( 4502508845359274387), -INT64_C( 2151032598573173124) } },
+    { { -INT64_C( 8507674031470197673) },
+      { -INT64_C( 5699575828578330915) },
+      { -INT64_C( 8507674031470197673), -INT64_C( 5699575828578330915) } },
+    { {  INT64_C( 7083908312949749931) },
+      { -INT64_C( 1970118703381068889) },
+      {  INT64_C( 7083908312949749931), -INT64_C( 1970118703381068889) } },
+    { { -INT64_C(  220605122805355400) },
+      {  INT64_C( 2698181699768838251) },
+      { -INT64_C(  220605122805355400),  INT64_C( 2698181699768838251) } },
+    { {  INT64_C( 6844678696467553817) },
+      { -INT64_C( 7001233253956684134) },
+      {  INT64_C( 6844678696467553817), -INT64_C( 7001233253956684134) } },
+    { { -INT64_C(  188648456440184602) },
+      {  INT64_C( 5119606106887633287) },
+      { -INT64_C(  188648456440184602),  INT64_C( 5119606106887633287) } },
+    { { -INT64_C( 4248716796508036246) },
+      {  INT64_C(  140022983789884018) },
+      { -INT64_C( 4248716796508036246),  INT64_C(  140022983789884018) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t r_ = { { simde_vld1_s64(test_vec[i].r0),
+                               simde_vld1_s64(test_vec[i].r1) } };
+
+    int64_t a_[2];
+    simde_vst2_s64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s64(a_);
+    simde_test_arm_neon_assert_equal_i64x1(r_.val[0], simde_vld1_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x1(r_.val[1], simde_vld1_s64(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x1_t a0 = simde_test_arm_neon_random_i64x1();
+    simde_int64x1_t a1 = simde_test_arm_neon_random_i64x1();
+    simde_int64x1x2_t a = { { a0, a1 } };
+    int64_t buf[2];
+    simde_vst2_s64(buf, a);
+
+    simde_test_arm_neon_write_i64x1(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x1(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t r0[8];
+    uint8_t r1[8];
+    uint8_t a[16];
+  } test_vec[] = {
+    { { UINT8_C(219), UINT8_C(  9), UINT8_C( 66), UINT8_C(200), UINT8_C(217), UINT8_C( 28), UINT8_C( 63), UINT8_C(195) },
+      { UINT8_C(251), UINT8_C(144), UINT8_C(162), UINT8_C(120), UINT8_C( 10), UINT8_C(104), UINT8_C(206), UINT8_C( 20) },
+      { UINT8_C(219), UINT8_C(251), UINT8_C(  9), UINT8_C(144), UINT8_C( 66), UINT8_C(162), UINT8_C(200), UINT8_C(120),
+        UINT8_C(217), UINT8_C( 10), UINT8_C( 28), UINT8_C(104), UINT8_C( 63), UINT8_C(206), UINT8_C(195), UINT8_C( 20) } },
+    { { UINT8_C( 70), UINT8_C( 51), UINT8_C( 92), UINT8_C(144), UINT8_C( 37), UINT8_C(159), UINT8_C(214), UINT8_C(199) },
+      { UINT8_C( 23), UINT8_C( 46), UINT8_C(188), UINT8_C(130), UINT8_C(101), UINT8_C(156), UINT8_C(173), UINT8_C( 92) },
+      { UINT8_C( 70), UINT8_C( 23), UINT8_C( 51), UINT8_C( 46), UINT8_C( 92), UINT8_C(188), UINT8_C(144), UINT8_C(130),
+        UINT8_C( 37), UINT8_C(101), UINT8_C(159), UINT8_C(156), UINT8_C(214), UINT8_C(173), UINT8_C(199), UINT8_C( 92) } },
+    { { UINT8_C( 75), UINT8_C(252), UINT8_C( 20), UINT8_C(159), UINT8_C(234), UINT8_C(178), UINT8_C(167), UINT8_C(154) },
+      { UINT8_C( 43), UINT8_C( 10), UINT8_C(249), UINT8_C( 30), UINT8_C(233), UINT8_C(190), UINT8_C( 46), UINT8_C(252) },
+      { UINT8_C( 75), UINT8_C( 43), UINT8_C(252), UINT8_C( 10), UINT8_C( 20), UINT8_C(249), UINT8_C(159), UINT8_C( 30),
+        UINT8_C(234), UINT8_C(233), UINT8_C(178), UINT8_C(190), UINT8_C(167), UINT8_C( 46), UINT8_C(154), UINT8_C(252) } },
+    { { UINT8_C(  4), UINT8_C( 34), UINT8_C(156), UINT8_C(174), UINT8_C( 35), UINT8_C(238), UINT8_C(187), UINT8_C( 75) },
+      { UINT8_C(120), UINT8_C(229), UINT8_C(181), UINT8_C( 75), UINT8_C(145), UINT8_C(203), UINT8_C(197), UINT8_C( 12) },
+      { UINT8_C(  4), UINT8_C(120), UINT8_C( 34), UINT8_C(229), UINT8_C(156), UINT8_C(181), UINT8_C(174), UINT8_C( 75),
+        UINT8_C( 35), UINT8_C(145), UINT8_C(238), UINT8_C(203), UINT8_C(187), UINT8_C(197), UINT8_C( 75), UINT8_C( 12) } },
+    { { UINT8_C(210), UINT8_C( 11), UINT8_C(154), UINT8_C(194), UINT8_C(151), UINT8_C( 26), UINT8_C( 83), UINT8_C(  7) },
+      { UINT8_C( 34), UINT8_C( 89), UINT8_C( 23), UINT8_C( 40), UINT8_C(219), UINT8_C( 54), UINT8_C( 52), UINT8_C(247) },
+      { UINT8_C(210), UINT8_C( 34), UINT8_C( 11), UINT8_C( 89), UINT8_C(154), UINT8_C( 23), UINT8_C(194), UINT8_C( 40),
+        UINT8_C(151), UINT8_C(219), UINT8_C( 26), UINT8_C( 54), UINT8_C( 83), UINT8_C( 52), UINT8_C(  7), UINT8_C(247) } },
+    { { UINT8_C(109), UINT8_C(253), UINT8_C( 81), UINT8_C(193), UINT8_C(158), UINT8_C( 56), UINT8_C(136), UINT8_C(150) },
+      { UINT8_C(219), UINT8_C(240), UINT8_C(111), UINT8_C(169), UINT8_C( 92), UINT8_C(136), UINT8_C(166), UINT8_C( 56) },
+      { UINT8_C(109), UINT8_C(219), UINT8_C(253), UINT8_C(240), UINT8_C( 81), UINT8_C(111), UINT8_C(193), UINT8_C(169),
+        UINT8_C(158), UINT8_C( 92), UINT8_C( 56), UINT8_C(136), UINT8_C(136), UINT8_C(166), UINT8_C(150), UINT8_C( 56) } },
+    { { UINT8_C(190), UINT8_C(143), UINT8_C(236), UINT8_C(189), UINT8_C( 79), UINT8_C(116), UINT8_C(226), UINT8_C(168) },
+      { UINT8_C(251), UINT8_C(244), UINT8_C(251), UINT8_C(163), UINT8_C( 33), UINT8_C( 91), UINT8_C( 97), UINT8_C(251) },
+      { UINT8_C(190), UINT8_C(251), UINT8_C(143), UINT8_C(244), UINT8_C(236), UINT8_C(251), UINT8_C(189), UINT8_C(163),
+        UINT8_C( 79), UINT8_C( 33), UINT8_C(116), UINT8_C( 91), UINT8_C(226), UINT8_C( 97), UINT8_C(168), UINT8_C(251) } },
+    { { UINT8_C(198), UINT8_C( 79), UINT8_C(212), UINT8_C(236), UINT8_C( 10), UINT8_C(125), UINT8_C(101), UINT8_C( 89) },
+      { UINT8_C(185), UINT8_C( 53), UINT8_C(194), UINT8_C(166), UINT8_C(136), UINT8_C( 41), UINT8_C( 53), UINT8_C( 80) },
+      { UINT8_C(198), UINT8_C(185), UINT8_C( 79), UINT8_C( 53), UINT8_C(212), UINT8_C(194), UINT8_C(236), UINT8_C(166),
+        UINT8_C( 10), UINT8_C(136), UINT8_C(125), UINT8_C( 41), UINT8_C(101), UINT8_C( 53), UINT8_C( 89), UINT8_C( 80) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t r_ = { { simde_vld1_u8(test_vec[i].r0),
+                               simde_vld1_u8(test_vec[i].r1) } };
+
+    uint8_t a_[16];
+    simde_vst2_u8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u8(a_);
+    simde_test_arm_neon_assert_equal_u8x8(r_.val[0], simde_vld1_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x8(r_.val[1], simde_vld1_u8(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x8_t a0 = simde_test_arm_neon_random_u8x8();
+    simde_uint8x8_t a1 = simde_test_arm_neon_random_u8x8();
+    simde_uint8x8x2_t a = { { a0, a1 } };
+    uint8_t buf[16];
+    simde_vst2_u8(buf, a);
+
+    simde_test_arm_neon_write_u8x8(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x8(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu8(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t r0[4];
+    uint16_t r1[4];
+    uint16_t a[8];
+  } test_vec[] = {
+    { { UINT16_C(26660), UINT16_C(27701), UINT16_C( 3836), UINT16_C( 2665) },
+      { UINT16_C(20688), UINT16_C(48230), UINT16_C(28008), UINT16_C(30967) },
+      { UINT16_C(26660), UINT16_C(20688), UINT16_C(27701), UINT16_C(48230), UINT16_C( 3836), UINT16_C(28008), UINT16_C( 2665), UINT16_C(30967) } },
+    { { UINT16_C(53932), UINT16_C(10504), UINT16_C(38622), UINT16_C(61016) },
+      { UINT16_C(27155), UINT16_C(24021), UINT16_C(16117), UINT16_C(62595) },
+      { UINT16_C(53932), UINT16_C(27155), UINT16_C(10504), UINT16_C(24021), UINT16_C(38622), UINT16_C(16117), UINT16_C(61016), UINT16_C(62595) } },
+    { { UINT16_C(20662), UINT16_C( 2298), UINT16_C(43958), UINT16_C(19414) },
+      { UINT16_C(29193), UINT16_C(53640), UINT16_C(11345), UINT16_C(26134) },
+      { UINT16_C(20662), UINT16_C(29193), UINT16_C( 2298), UINT16_C(53640), UINT16_C(43958), UINT16_C(11345), UINT16_C(19414), UINT16_C(26134) } },
+    { { UINT16_C(53853), UINT16_C(24074), UINT16_C(37723), UINT16_C(32652) },
+      { UINT16_C(63407), UINT16_C( 1069), UINT16_C(35152), UINT16_C(58887) },
+      { UINT16_C(53853), UINT16_C(63407), UINT16_C(24074), UINT16_C( 1069), UINT16_C(37723), UINT16_C(35152), UINT16_C(32652), UINT16_C(58887) } },
+    { { UINT16_C(40833), UINT16_C(41372), UINT16_C(28026), UINT16_C(53333) },
+      { UINT16_C(39864), UINT16_C(11907), UINT16_C(60216), UINT16_C(28846) },
+      { UINT16_C(40833), UINT16_C(39864), UINT16_C(41372), UINT16_C(11907), UINT16_C(28026), UINT16_C(60216), UINT16_C(53333), UINT16_C(28846) } },
+    { { UINT16_C(64309), UINT16_C(12469), UINT16_C(43316), UINT16_C(50672) },
+      { UINT16_C(28196), UINT16_C(64299), UINT16_C( 4107), UINT16_C(29910) },
+      { UINT16_C(64309), UINT16_C(28196), UINT16_C(12469), UINT16_C(64299), UINT16_C(43316), UINT16_C( 4107), UINT16_C(50672), UINT16_C(29910) } },
+    { { UINT16_C(55063), UINT16_C(  206), UINT16_C(25652), UINT16_C(41752) },
+      { UINT16_C(25064), UINT16_C(16684), UINT16_C( 3742), UINT16_C(48305) },
+      { UINT16_C(55063), UINT16_C(25064), UINT16_C(  206), UINT16_C(16684), UINT16_C(25652), UINT16_C( 3742), UINT16_C(41752), UINT16_C(48305) } },
+    { { UINT16_C( 2236), UINT16_C(27613), UINT16_C(25594), UINT16_C(22954) },
+      { UINT16_C(63879), UINT16_C(61801), UINT16_C(48534), UINT16_C(44020) },
+      { UINT16_C( 2236), UINT16_C(63879), UINT16_C(27613), UINT16_C(61801), UINT16_C(25594), UINT16_C(48534), UINT16_C(22954), UINT16_C(44020) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t r_ = { { simde_vld1_u16(test_vec[i].r0),
+                                simde_vld1_u16(test_vec[i].r1) } };
+
+    uint16_t a_[8];
+    simde_vst2_u16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u16(a_);
+    simde_test_arm_neon_assert_equal_u16x4(r_.val[0], simde_vld1_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x4(r_.val[1], simde_vld1_u16(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x4_t a0 = simde_test_arm_neon_random_u16x4();
+    simde_uint16x4_t a1 = simde_test_arm_neon_random_u16x4();
+    simde_uint16x4x2_t a = { { a0, a1 } };
+    uint16_t buf[8];
+    simde_vst2_u16(buf, a);
+
+    simde_test_arm_neon_write_u16x4(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu16(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t r0[2];
+    uint32_t r1[2];
+    uint32_t a[4];
+  } test_vec[] = {
+    { { UINT32_C(3044293449), UINT32_C(4210975369) },
+      { UINT32_C(2870954332), UINT32_C(3753352889) },
+      { UINT32_C(3044293449), UINT32_C(2870954332), UINT32_C(4210975369), UINT32_C(3753352889) } },
+    { { UINT32_C(1171981287), UINT32_C(3088999031) },
+      { UINT32_C( 724363049), UINT32_C( 616736071) },
+      { UINT32_C(1171981287), UINT32_C( 724363049), UINT32_C(3088999031), UINT32_C( 616736071) } },
+    { { UINT32_C(2587088294), UINT32_C(4226052122) },
+      { UINT32_C( 272994442), UINT32_C(3226387362) },
+      { UINT32_C(2587088294), UINT32_C( 272994442), UINT32_C(4226052122), UINT32_C(3226387362) } },
+    { { UINT32_C(2525769563), UINT32_C(3485774420) },
+      { UINT32_C(2209672700), UINT32_C(1993649827) },
+      { UINT32_C(2525769563), UINT32_C(2209672700), UINT32_C(3485774420), UINT32_C(1993649827) } },
+    { { UINT32_C(2330012541), UINT32_C(3225227519) },
+      { UINT32_C( 521129253), UINT32_C(3985062971) },
+      { UINT32_C(2330012541), UINT32_C( 521129253), UINT32_C(3225227519), UINT32_C(3985062971) } },
+    { { UINT32_C( 290337683), UINT32_C(1818889039) },
+      { UINT32_C(2032518430), UINT32_C(2948452280) },
+      { UINT32_C( 290337683), UINT32_C(2032518430), UINT32_C(1818889039), UINT32_C(2948452280) } },
+    { { UINT32_C( 625239587), UINT32_C(4204812043) },
+      { UINT32_C(2755027124), UINT32_C(3430128396) },
+      { UINT32_C( 625239587), UINT32_C(2755027124), UINT32_C(4204812043), UINT32_C(3430128396) } },
+    { { UINT32_C(1329446927), UINT32_C( 504081940) },
+      { UINT32_C(2665646564), UINT32_C(  76161363) },
+      { UINT32_C(1329446927), UINT32_C(2665646564), UINT32_C( 504081940), UINT32_C(  76161363) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t r_ = { { simde_vld1_u32(test_vec[i].r0),
+                                simde_vld1_u32(test_vec[i].r1) } };
+
+    uint32_t a_[4];
+    simde_vst2_u32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u32(a_);
+    simde_test_arm_neon_assert_equal_u32x2(r_.val[0], simde_vld1_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x2(r_.val[1], simde_vld1_u32(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x2_t a0 = simde_test_arm_neon_random_u32x2();
+    simde_uint32x2_t a1 = simde_test_arm_neon_random_u32x2();
+    simde_uint32x2x2_t a = { { a0, a1 } };
+    uint32_t buf[4];
+    simde_vst2_u32(buf, a);
+
+    simde_test_arm_neon_write_u32x2(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x2(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu32(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t r0[1];
+    uint64_t r1[1];
+    uint64_t a[2];
+  } test_vec[] = {
+    { { UINT64_C( 9595148764315503015) },
+      { UINT64_C( 3847453924227247484) },
+      { UINT64_C( 9595148764315503015), UINT64_C( 3847453924227247484) } },
+    { { UINT64_C(11908219554009306747) },
+      { UINT64_C(15715413344116779078) },
+      { UINT64_C(11908219554009306747), UINT64_C(15715413344116779078) } },
+    { { UINT64_C(14441803972100579997) },
+      { UINT64_C( 5758705804083121511) },
+      { UINT64_C(14441803972100579997), UINT64_C( 5758705804083121511) } },
+    { { UINT64_C(12981512282214298578) },
+      { UINT64_C( 7937764974922415022) },
+      { UINT64_C(12981512282214298578), UINT64_C( 7937764974922415022) } },
+    { { UINT64_C(16827881867293744445) },
+      { UINT64_C(17295654718596686599) },
+      { UINT64_C(16827881867293744445), UINT64_C(17295654718596686599) } },
+    { { UINT64_C( 9996069143934024025) },
+      { UINT64_C( 6238306176117050893) },
+      { UINT64_C( 9996069143934024025), UINT64_C( 6238306176117050893) } },
+    { { UINT64_C(13632054334227997194) },
+      { UINT64_C( 4061975971806357201) },
+      { UINT64_C(13632054334227997194), UINT64_C( 4061975971806357201) } },
+    { { UINT64_C(12337020908040696519) },
+      { UINT64_C(14527450500021469624) },
+      { UINT64_C(12337020908040696519), UINT64_C(14527450500021469624) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t r_ = { { simde_vld1_u64(test_vec[i].r0),
+                                simde_vld1_u64(test_vec[i].r1) } };
+
+    uint64_t a_[2];
+    simde_vst2_u64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u64(a_);
+    simde_test_arm_neon_assert_equal_u64x1(r_.val[0], simde_vld1_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x1(r_.val[1], simde_vld1_u64(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x1_t a0 = simde_test_arm_neon_random_u64x1();
+    simde_uint64x1_t a1 = simde_test_arm_neon_random_u64x1();
+    simde_uint64x1x2_t a = { { a0, a1 } };
+    uint64_t buf[2];
+    simde_vst2_u64(buf, a);
+
+    simde_test_arm_neon_write_u64x1(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x1(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu64(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r0[4];
+    simde_float32 r1[4];
+    simde_float32 a[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   802.33), SIMDE_FLOAT32_C(  -693.87), SIMDE_FLOAT32_C(   378.44), SIMDE_FLOAT32_C(   894.43) },
+      { SIMDE_FLOAT32_C(   334.11), SIMDE_FLOAT32_C(  -775.23), SIMDE_FLOAT32_C(   841.87), SIMDE_FLOAT32_C(   939.27) },
+      { SIMDE_FLOAT32_C(   802.33), SIMDE_FLOAT32_C(   334.11), SIMDE_FLOAT32_C(  -693.87), SIMDE_FLOAT32_C(  -775.23),
+        SIMDE_FLOAT32_C(   378.44), SIMDE_FLOAT32_C(   841.87), SIMDE_FLOAT32_C(   894.43), SIMDE_FLOAT32_C(   939.27) } },
+    { { SIMDE_FLOAT32_C(  -778.39), SIMDE_FLOAT32_C(   654.54), SIMDE_FLOAT32_C(  -841.34), SIMDE_FLOAT32_C(  -837.41) },
+      { SIMDE_FLOAT32_C(   590.75), SIMDE_FLOAT32_C(   439.83), SIMDE_FLOAT32_C(   914.37), SIMDE_FLOAT32_C(   263.86) },
+      { SIMDE_FLOAT32_C(  -778.39), SIMDE_FLOAT32_C(   590.75), SIMDE_FLOAT32_C(   654.54), SIMDE_FLOAT32_C(   439.83),
+        SIMDE_FLOAT32_C(  -841.34), SIMDE_FLOAT32_C(   914.37), SIMDE_FLOAT32_C(  -837.41), SIMDE_FLOAT32_C(   263.86) } },
+    { { SIMDE_FLOAT32_C(    23.40), SIMDE_FLOAT32_C(  -455.86), SIMDE_FLOAT32_C(   145.71), SIMDE_FLOAT32_C(   984.92) },
+      { SIMDE_FLOAT32_C(   293.33), SIMDE_FLOAT32_C(   751.09), SIMDE_FLOAT32_C(  -605.10), SIMDE_FLOAT32_C(   469.93) },
+      { SIMDE_FLOAT32_C(    23.40), SIMDE_FLOAT32_C(   293.33), SIMDE_FLOAT32_C(  -455.86), SIMDE_FLOAT32_C(   751.09),
+        SIMDE_FLOAT32_C(   145.71), SIMDE_FLOAT32_C(  -605.10), SIMDE_FLOAT32_C(   984.92), SIMDE_FLOAT32_C(   469.93) } },
+    { { SIMDE_FLOAT32_C(   463.55), SIMDE_FLOAT32_C(  -858.29), SIMDE_FLOAT32_C(   640.40), SIMDE_FLOAT32_C(  -647.86) },
+      { SIMDE_FLOAT32_C(  -565.32), SIMDE_FLOAT32_C(  -877.58), SIMDE_FLOAT32_C(   325.34), SIMDE_FLOAT32_C(  -715.40) },
+      { SIMDE_FLOAT32_C(   463.55), SIMDE_FLOAT32_C(  -565.32), SIMDE_FLOAT32_C(  -858.29), SIMDE_FLOAT32_C(  -877.58),
+        SIMDE_FLOAT32_C(   640.40), SIMDE_FLOAT32_C(   325.34), SIMDE_FLOAT32_C(  -647.86), SIMDE_FLOAT32_C(  -715.40) } },
+    { { SIMDE_FLOAT32_C(   951.40), SIMDE_FLOAT32_C(  -999.92), SIMDE_FLOAT32_C(   618.98), SIMDE_FLOAT32_C(   518.33) },
+      { SIMDE_FLOAT32_C(   138.60), SIMDE_FLOAT32_C(   143.96), SIMDE_FLOAT32_C(   595.96), SIMDE_FLOAT32_C(   272.72) },
+      { SIMDE_FLOAT32_C(   951.40), SIMDE_FLOAT32_C(   138.60), SIMDE_FLOAT32_C(  -999.92), SIMDE_FLOAT32_C(   143.96),
+        SIMDE_FLOAT32_C(   618.98), SIMDE_FLOAT32_C(   595.96), SIMDE_FLOAT32_C(   518.33), SIMDE_FLOAT32_C(   272.72) } },
+    { { SIMDE_FLOAT32_C(  -721.26), SIMDE_FLOAT32_C(   593.69), SIMDE_FLOAT32_C(  -292.24), SIMDE_FLOAT32_C(   167.53) },
+      { SIMDE_FLOAT32_C(    24.87), SIMDE_FLOAT32_C(   808.07), SIMDE_FLOAT32_C(  -171.28), SIMDE_FLOAT32_C(   706.84) },
+      { SIMDE_FLOAT32_C(  -721.26), SIMDE_FLOAT32_C(    24.87), SIMDE_FLOAT32_C(   593.69), SIMDE_FLOAT32_C(   808.07),
+        SIMDE_FLOAT32_C(  -292.24), SIMDE_FLOAT32_C(  -171.28), SIMDE_FLOAT32_C(   167.53), SIMDE_FLOAT32_C(   706.84) } },
+    { { SIMDE_FLOAT32_C(  -836.39), SIMDE_FLOAT32_C(  -347.66), SIMDE_FLOAT32_C(   341.15), SIMDE_FLOAT32_C(   223.90) },
+      { SIMDE_FLOAT32_C(   664.64), SIMDE_FLOAT32_C(  -584.18), SIMDE_FLOAT32_C(   608.38), SIMDE_FLOAT32_C(   591.24) },
+      { SIMDE_FLOAT32_C(  -836.39), SIMDE_FLOAT32_C(   664.64), SIMDE_FLOAT32_C(  -347.66), SIMDE_FLOAT32_C(  -584.18),
+        SIMDE_FLOAT32_C(   341.15), SIMDE_FLOAT32_C(   608.38), SIMDE_FLOAT32_C(   223.90), SIMDE_FLOAT32_C(   591.24) } },
+    { { SIMDE_FLOAT32_C(  -714.15), SIMDE_FLOAT32_C(  -720.34), SIMDE_FLOAT32_C(   166.57), SIMDE_FLOAT32_C(   951.25) },
+      { SIMDE_FLOAT32_C(   227.46), SIMDE_FLOAT32_C(  -144.09), SIMDE_FLOAT32_C(    13.73), SIMDE_FLOAT32_C(   619.10) },
+      { SIMDE_FLOAT32_C(  -714.15), SIMDE_FLOAT32_C(   227.46), SIMDE_FLOAT32_C(  -720.34), SIMDE_FLOAT32_C(  -144.09),
+        SIMDE_FLOAT32_C(   166.57), SIMDE_FLOAT32_C(    13.73), SIMDE_FLOAT32_C(   951.25), SIMDE_FLOAT32_C(   619.10) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t r_ = { { simde_vld1q_f32(test_vec[i].r0),
+                                 simde_vld1q_f32(test_vec[i].r1) } };
+
+    simde_float32 a_[8];
+    simde_vst2q_f32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_f32(a_);
+    simde_test_arm_neon_assert_equal_f32x4(r_.val[0], simde_vld1q_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r_.val[1], simde_vld1q_f32(test_vec[i].r1), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t a0 = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4_t a1 = simde_test_arm_neon_random_f32x4(-1000.0f, 1000.0f);
+    simde_float32x4x2_t a = { { a0, a1 } };
+    simde_float32 buf[8];
+    simde_vst2q_f32(buf, a);
+
+    simde_test_arm_neon_write_f32x4(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f32x4(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 r0[2];
+    simde_float64 r1[2];
+    simde_float64 a[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    44.57), SIMDE_FLOAT64_C(    73.52) },
+      { SIMDE_FLOAT64_C(   186.57), SIMDE_FLOAT64_C(   864.19) },
+      { SIMDE_FLOAT64_C(    44.57), SIMDE_FLOAT64_C(   186.57), SIMDE_FLOAT64_C(    73.52), SIMDE_FLOAT64_C(   864.19) } },
+    { { SIMDE_FLOAT64_C(   600.80), SIMDE_FLOAT64_C(   678.30) },
+      { SIMDE_FLOAT64_C(  -467.59), SIMDE_FLOAT64_C(   200.30) },
+      { SIMDE_FLOAT64_C(   600.80), SIMDE_FLOAT64_C(  -467.59), SIMDE_FLOAT64_C(   678.30), SIMDE_FLOAT64_C(   200.30) } },
+    { { SIMDE_FLOAT64_C(   646.17), SIMDE_FLOAT64_C(   436.31) },
+      { SIMDE_FLOAT64_C(   903.63), SIMDE_FLOAT64_C(   830.42) },
+      { SIMDE_FLOAT64_C(   646.17), SIMDE_FLOAT64_C(   903.63), SIMDE_FLOAT64_C(   436.31), SIMDE_FLOAT64_C(   830.42) } },
+    { { SIMDE_FLOAT64_C(  -744.74), SIMDE_FLOAT64_C(    16.40) },
+      { SIMDE_FLOAT64_C(  -284.48), SIMDE_FLOAT64_C(  -589.73) },
+      { SIMDE_FLOAT64_C(  -744.74), SIMDE_FLOAT64_C(  -284.48), SIMDE_FLOAT64_C(    16.40), SIMDE_FLOAT64_C(  -589.73) } },
+    { { SIMDE_FLOAT64_C(     1.60), SIMDE_FLOAT64_C(   967.20) },
+      { SIMDE_FLOAT64_C(   536.55), SIMDE_FLOAT64_C(  -801.73) },
+      { SIMDE_FLOAT64_C(     1.60), SIMDE_FLOAT64_C(   536.55), SIMDE_FLOAT64_C(   967.20), SIMDE_FLOAT64_C(  -801.73) } },
+    { { SIMDE_FLOAT64_C(  -504.54), SIMDE_FLOAT64_C(  -260.68) },
+      { SIMDE_FLOAT64_C(   770.30), SIMDE_FLOAT64_C(   -81.01) },
+      { SIMDE_FLOAT64_C(  -504.54), SIMDE_FLOAT64_C(   770.30), SIMDE_FLOAT64_C(  -260.68), SIMDE_FLOAT64_C(   -81.01) } },
+    { { SIMDE_FLOAT64_C(  -680.96), SIMDE_FLOAT64_C(   100.39) },
+      { SIMDE_FLOAT64_C(  -505.55), SIMDE_FLOAT64_C(  -923.32) },
+      { SIMDE_FLOAT64_C(  -680.96), SIMDE_FLOAT64_C(  -505.55), SIMDE_FLOAT64_C(   100.39), SIMDE_FLOAT64_C(  -923.32) } },
+    { { SIMDE_FLOAT64_C(   185.34), SIMDE_FLOAT64_C(   981.72) },
+      { SIMDE_FLOAT64_C(   551.83), SIMDE_FLOAT64_C(   472.41) },
+      { SIMDE_FLOAT64_C(   185.34), SIMDE_FLOAT64_C(   551.83), SIMDE_FLOAT64_C(   981.72), SIMDE_FLOAT64_C(   472.41) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t r_ = { { simde_vld1q_f64(test_vec[i].r0),
+                                 simde_vld1q_f64(test_vec[i].r1) } };
+
+    simde_float64 a_[4];
+    simde_vst2q_f64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_f64(a_);
+    simde_test_arm_neon_assert_equal_f64x2(r_.val[0], simde_vld1q_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r_.val[1], simde_vld1q_f64(test_vec[i].r1), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float64x2_t a0 = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2_t a1 = simde_test_arm_neon_random_f64x2(-1000.0, 1000.0);
+    simde_float64x2x2_t a = { { a0, a1 } };
+    simde_float64 buf[4];
+    simde_vst2q_f64(buf, a);
+
+    simde_test_arm_neon_write_f64x2(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_f64x2(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t r0[16];
+    int8_t r1[16];
+    int8_t a[32];
+  } test_vec[] = {
+    { {  INT8_C(  39),  INT8_C(  17), -INT8_C( 113),  INT8_C(  95), -INT8_C(  93),  INT8_C(   8), -INT8_C(  62),  INT8_C(   9),
+         INT8_C( 114), -INT8_C(  47),  INT8_C(  13),  INT8_C(  41), -INT8_C(  19), -INT8_C(  29),  INT8_C(  67),  INT8_C(  89) },
+      { -INT8_C(  67),  INT8_C(  52),  INT8_C( 118), -INT8_C(  76), -INT8_C(  57), -INT8_C(  84),  INT8_C(  86),  INT8_C(  76),
+         INT8_C(  23), -INT8_C(  51),  INT8_C( 109), -INT8_C(  23),  INT8_C( 122), -INT8_C(  54), -INT8_C(  54),  INT8_C(  26) },
+      {  INT8_C(  39), -INT8_C(  67),  INT8_C(  17),  INT8_C(  52), -INT8_C( 113),  INT8_C( 118),  INT8_C(  95), -INT8_C(  76),
+        -INT8_C(  93), -INT8_C(  57),  INT8_C(   8), -INT8_C(  84), -INT8_C(  62),  INT8_C(  86),  INT8_C(   9),  INT8_C(  76),
+         INT8_C( 114),  INT8_C(  23), -INT8_C(  47), -INT8_C(  51),  INT8_C(  13),  INT8_C( 109),  INT8_C(  41), -INT8_C(  23),
+        -INT8_C(  19),  INT8_C( 122), -INT8_C(  29), -INT8_C(  54),  INT8_C(  67), -INT8_C(  54),  INT8_C(  89),  INT8_C(  26) } },
+    { {  INT8_C( 103), -INT8_C( 120), -INT8_C(  86),  INT8_C(  96),  INT8_C(  96), -INT8_C(  92), -INT8_C(  69),  INT8_C(   4),
+         INT8_C(  44), -INT8_C( 112), -INT8_C(  31), -INT8_C(  90), -INT8_C(  15),  INT8_C(  17),  INT8_C(   6),  INT8_C(   9) },
+      { -INT8_C(  37), -INT8_C(  19), -INT8_C(  57),  INT8_C(  84), -INT8_C(  79),  INT8_C(  37),  INT8_C(  27), -INT8_C(  39),
+        -INT8_C(  69), -INT8_C(  85), -INT8_C(  59), -INT8_C(  89), -INT8_C(  96), -INT8_C(  39), -INT8_C(  10),  INT8_C(  85) },
+      {  INT8_C( 103), -INT8_C(  37), -INT8_C( 120), -INT8_C(  19), -INT8_C(  86), -INT8_C(  57),  INT8_C(  96),  INT8_C(  84),
+         INT8_C(  96), -INT8_C(  79), -INT8_C(  92),  INT8_C(  37), -INT8_C(  69),  INT8_C(  27),  INT8_C(   4), -INT8_C(  39),
+         INT8_C(  44), -INT8_C(  69), -INT8_C( 112), -INT8_C(  85), -INT8_C(  31), -INT8_C(  59), -INT8_C(  90), -INT8_C(  89),
+        -INT8_C(  15), -INT8_C(  96),  INT8_C(  17), -INT8_C(  39),  INT8_C(   6), -INT8_C(  10),  INT8_C(   9),  INT8_C(  85) } },
+    { { -INT8_C(  14),  INT8_C( 100), -INT8_C(  94), -INT8_C(  14), -INT8_C(  20), -INT8_C(  77),  INT8_C(  36),  INT8_C( 104),
+         INT8_C(  76),  INT8_C(  32), -INT8_C( 121),  INT8_C(  70), -INT8_C( 123), -INT8_C( 117), -INT8_C(  13), -INT8_C( 104) },
+      { -INT8_C(  94), -INT8_C(  49), -INT8_C(  97), -INT8_C( 111), -INT8_C(  97), -INT8_C(  95), -INT8_C(  14), -INT8_C( 125),
+         INT8_C( 102), -INT8_C(  84), -INT8_C(  67),  INT8_C(  45), -INT8_C( 103),  INT8_C(  68),  INT8_C( 103), -INT8_C(  71) },
+      { -INT8_C(  14), -INT8_C(  94),  INT8_C( 100), -INT8_C(  49), -INT8_C(  94), -INT8_C(  97), -INT8_C(  14), -INT8_C( 111),
+        -INT8_C(  20), -INT8_C(  97), -INT8_C(  77), -INT8_C(  95),  INT8_C(  36), -INT8_C(  14),  INT8_C( 104), -INT8_C( 125),
+         INT8_C(  76),  INT8_C( 102),  INT8_C(  32), -INT8_C(  84), -INT8_C( 121), -INT8_C(  67),  INT8_C(  70),  INT8_C(  45),
+        -INT8_C( 123), -INT8_C( 103), -INT8_C( 117),  INT8_C(  68), -INT8_C(  13),  INT8_C( 103), -INT8_C( 104), -INT8_C(  71) } },
+    { {  INT8_C(  86), -INT8_C(  70),  INT8_C(  39), -INT8_C(  48),  INT8_C(   2), -INT8_C(  28),  INT8_C(  86), -INT8_C(  55),
+         INT8_C(  76), -INT8_C( 116),  INT8_C(  20), -INT8_C(  31),  INT8_C( 124),  INT8_C( 122),  INT8_C(  89), -INT8_C(  73) },
+      { -INT8_C(  19),  INT8_C(  13), -INT8_C(  57),  INT8_C( 105), -INT8_C(  86), -INT8_C(  63), -INT8_C(  40),  INT8_C(  20),
+         INT8_C(  70),  INT8_C(  45),  INT8_C(  29),  INT8_C(   4), -INT8_C( 100), -INT8_C( 100),  INT8_C(  58), -INT8_C(  25) },
+      {  INT8_C(  86), -INT8_C(  19), -INT8_C(  70),  INT8_C(  13),  INT8_C(  39), -INT8_C(  57), -INT8_C(  48),  INT8_C( 105),
+         INT8_C(   2), -INT8_C(  86), -INT8_C(  28), -INT8_C(  63),  INT8_C(  86), -INT8_C(  40), -INT8_C(  55),  INT8_C(  20),
+         INT8_C(  76),  INT8_C(  70), -INT8_C( 116),  INT8_C(  45),  INT8_C(  20),  INT8_C(  29), -INT8_C(  31),  INT8_C(   4),
+         INT8_C( 124), -INT8_C( 100),  INT8_C( 122), -INT8_C( 100),  INT8_C(  89),  INT8_C(  58), -INT8_C(  73), -INT8_C(  25) } },
+    { { -INT8_C(   4),  INT8_C(  93),  INT8_C( 108), -INT8_C(  27), -INT8_C(  30), -INT8_C(  43),  INT8_C(  62), -INT8_C( 102),
+         INT8_C(  23), -INT8_C(  48), -INT8_C(  96), -INT8_C( 122), -INT8_C(  79),  INT8_C(  66),  INT8_C(  65), -INT8_C(  15) },
+      { -INT8_C(  19),  INT8_C(  51), -INT8_C(   7),  INT8_C(  54), -INT8_C(  81),  INT8_C(  44), -INT8_C(   5), -INT8_C( 119),
+        -INT8_C(   5), -INT8_C(   5),  INT8_C(  37),  INT8_C( 125), -INT8_C(  70),  INT8_C(  82), -INT8_C(  66), -INT8_C(  59) },
+      { -INT8_C(   4), -INT8_C(  19),  INT8_C(  93),  INT8_C(  51),  INT8_C( 108), -INT8_C(   7), -INT8_C(  27),  INT8_C(  54),
+        -INT8_C(  30), -INT8_C(  81), -INT8_C(  43),  INT8_C(  44),  INT8_C(  62), -INT8_C(   5), -INT8_C( 102), -INT8_C( 119),
+         INT8_C(  23), -INT8_C(   5), -INT8_C(  48), -INT8_C(   5), -INT8_C(  96),  INT8_C(  37), -INT8_C( 122),  INT8_C( 125),
+        -INT8_C(  79), -INT8_C(  70),  INT8_C(  66),  INT8_C(  82),  INT8_C(  65), -INT8_C(  66), -INT8_C(  15), -INT8_C(  59) } },
+    { { -INT8_C(  69),  INT8_C( 104),  INT8_C(  86),  INT8_C(  94), -INT8_C( 117),  INT8_C(  56), -INT8_C( 106),  INT8_C( 109),
+        -INT8_C(  39), -INT8_C(  66),  INT8_C(  13), -INT8_C(  65),  INT8_C(  96), -INT8_C(  27),  INT8_C(  80), -INT8_C( 105) },
+      { -INT8_C(  54), -INT8_C(  68),  INT8_C(  29),  INT8_C(  16),  INT8_C(  15),  INT8_C(  32),  INT8_C(  29),  INT8_C(  47),
+         INT8_C(  29), -INT8_C(  34),  INT8_C( 111),  INT8_C(  72), -INT8_C(  35),  INT8_C(  32),  INT8_C(  90),  INT8_C(  43) },
+      { -INT8_C(  69), -INT8_C(  54),  INT8_C( 104), -INT8_C(  68),  INT8_C(  86),  INT8_C(  29),  INT8_C(  94),  INT8_C(  16),
+        -INT8_C( 117),  INT8_C(  15),  INT8_C(  56),  INT8_C(  32), -INT8_C( 106),  INT8_C(  29),  INT8_C( 109),  INT8_C(  47),
+        -INT8_C(  39),  INT8_C(  29), -INT8_C(  66), -INT8_C(  34),  INT8_C(  13),  INT8_C( 111), -INT8_C(  65),  INT8_C(  72),
+         INT8_C(  96), -INT8_C(  35), -INT8_C(  27),  INT8_C(  32),  INT8_C(  80),  INT8_C(  90), -INT8_C( 105),  INT8_C(  43) } },
+    { {  INT8_C(  25), -INT8_C(  25), -INT8_C(  85),  INT8_C(  93),  INT8_C(  85),  INT8_C(  75), -INT8_C( 110), -INT8_C(  34),
+        -INT8_C(  65), -INT8_C(  49),  INT8_C( 116), -INT8_C(  22), -INT8_C(  69), -INT8_C(   1), -INT8_C(  98),  INT8_C(  52) },
+      { -INT8_C(  38), -INT8_C( 112), -INT8_C(  61),  INT8_C( 101), -INT8_C(  26), -INT8_C( 103), -INT8_C(  65), -INT8_C( 103),
+         INT8_C(  72), -INT8_C(   3), -INT8_C( 127),  INT8_C(   9), -INT8_C(  59), -INT8_C(  89), -INT8_C(  56),  INT8_C(  41) },
+      {  INT8_C(  25), -INT8_C(  38), -INT8_C(  25), -INT8_C( 112), -INT8_C(  85), -INT8_C(  61),  INT8_C(  93),  INT8_C( 101),
+         INT8_C(  85), -INT8_C(  26),  INT8_C(  75), -INT8_C( 103), -INT8_C( 110), -INT8_C(  65), -INT8_C(  34), -INT8_C( 103),
+        -INT8_C(  65),  INT8_C(  72), -INT8_C(  49), -INT8_C(   3),  INT8_C( 116), -INT8_C( 127), -INT8_C(  22),  INT8_C(   9),
+        -INT8_C(  69), -INT8_C(  59), -INT8_C(   1), -INT8_C(  89), -INT8_C(  98), -INT8_C(  56),  INT8_C(  52),  INT8_C(  41) } },
+    { { -INT8_C(  70), -INT8_C(  93), -INT8_C(  41),  INT8_C(   9), -INT8_C(  45),  INT8_C( 117), -INT8_C( 118),  INT8_C( 101),
+        -INT8_C(  93), -INT8_C(  90),  INT8_C(  11),  INT8_C(  32),  INT8_C( 122),  INT8_C(   3), -INT8_C(  70),  INT8_C(  92) },
+      { -INT8_C(  23), -INT8_C(  56), -INT8_C(  39), -INT8_C(  93),  INT8_C( 112), -INT8_C(  57),  INT8_C(  58), -INT8_C( 117),
+        -INT8_C(  30),  INT8_C(  36), -INT8_C(  88), -INT8_C(  74),  INT8_C(  49), -INT8_C(  76),  INT8_C(   9),  INT8_C(  71) },
+      { -INT8_C(  70), -INT8_C(  23), -INT8_C(  93), -INT8_C(  56), -INT8_C(  41), -INT8_C(  39),  INT8_C(   9), -INT8_C(  93),
+        -INT8_C(  45),  INT8_C( 112),  INT8_C( 117), -INT8_C(  57), -INT8_C( 118),  INT8_C(  58),  INT8_C( 101), -INT8_C( 117),
+        -INT8_C(  93), -INT8_C(  30), -INT8_C(  90),  INT8_C(  36),  INT8_C(  11), -INT8_C(  88),  INT8_C(  32), -INT8_C(  74),
+         INT8_C( 122),  INT8_C(  49),  INT8_C(   3), -INT8_C(  76), -INT8_C(  70),  INT8_C(   9),  INT8_C(  92),  INT8_C(  71) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t r_ = { { simde_vld1q_s8(test_vec[i].r0),
+                               simde_vld1q_s8(test_vec[i].r1) } };
+
+    int8_t a_[32];
+    simde_vst2q_s8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s8(a_);
+    simde_test_arm_neon_assert_equal_i8x16(r_.val[0], simde_vld1q_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x16(r_.val[1], simde_vld1q_s8(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int8x16_t a0 = simde_test_arm_neon_random_i8x16();
+    simde_int8x16_t a1 = simde_test_arm_neon_random_i8x16();
+    simde_int8x16x2_t a = { { a0, a1 } };
+    int8_t buf[32];
+    simde_vst2q_s8(buf, a);
+
+    simde_test_arm_neon_write_i8x16(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i8x16(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi8(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t r0[8];
+    int16_t r1[8];
+    int16_t a[16];
+  } test_vec[] = {
+    { { -INT16_C(  7992), -INT16_C( 13198), -INT16_C( 27741),  INT16_C( 12718),  INT16_C(  7174),  INT16_C( 20193), -INT16_C(   661),  INT16_C( 31864) },
+      { -INT16_C( 27051), -INT16_C(  7326), -INT16_C( 15818),  INT16_C(   207), -INT16_C( 12688),  INT16_C( 17653),  INT16_C( 16771),  INT16_C( 31768) },
+      { -INT16_C(  7992), -INT16_C( 27051), -INT16_C( 13198), -INT16_C(  7326), -INT16_C( 27741), -INT16_C( 15818),  INT16_C( 12718),  INT16_C(   207),
+         INT16_C(  7174), -INT16_C( 12688),  INT16_C( 20193),  INT16_C( 17653), -INT16_C(   661),  INT16_C( 16771),  INT16_C( 31864),  INT16_C( 31768) } },
+    { { -INT16_C( 31301),  INT16_C( 31504),  INT16_C( 11285), -INT16_C(  9940), -INT16_C( 25400), -INT16_C(   558),  INT16_C( 28481),  INT16_C( 27604) },
+      { -INT16_C( 13763),  INT16_C( 13151),  INT16_C(  7589), -INT16_C( 19018),  INT16_C( 13470), -INT16_C(  4128),  INT16_C( 25364), -INT16_C(  1729) },
+      { -INT16_C( 31301), -INT16_C( 13763),  INT16_C( 31504),  INT16_C( 13151),  INT16_C( 11285),  INT16_C(  7589), -INT16_C(  9940), -INT16_C( 19018),
+        -INT16_C( 25400),  INT16_C( 13470), -INT16_C(   558), -INT16_C(  4128),  INT16_C( 28481),  INT16_C( 25364),  INT16_C( 27604), -INT16_C(  1729) } },
+    { {  INT16_C(   103), -INT16_C(  8599),  INT16_C( 26644),  INT16_C(  7911), -INT16_C(  2454), -INT16_C( 17293), -INT16_C(  8801),  INT16_C( 17784) },
+      {  INT16_C( 11799),  INT16_C( 17452), -INT16_C( 11029), -INT16_C( 12064),  INT16_C( 14751),  INT16_C( 14267),  INT16_C( 15704),  INT16_C(   468) },
+      {  INT16_C(   103),  INT16_C( 11799), -INT16_C(  8599),  INT16_C( 17452),  INT16_C( 26644), -INT16_C( 11029),  INT16_C(  7911), -INT16_C( 12064),
+        -INT16_C(  2454),  INT16_C( 14751), -INT16_C( 17293),  INT16_C( 14267), -INT16_C(  8801),  INT16_C( 15704),  INT16_C( 17784),  INT16_C(   468) } },
+    { { -INT16_C( 23751), -INT16_C( 20693),  INT16_C( 19273), -INT16_C( 31837),  INT16_C( 13189),  INT16_C( 27177),  INT16_C(  5611), -INT16_C(  2369) },
+      {  INT16_C( 11584),  INT16_C( 26976),  INT16_C( 12613),  INT16_C( 12979), -INT16_C(  5776), -INT16_C(  2024),  INT16_C(  2749), -INT16_C( 12790) },
+      { -INT16_C( 23751),  INT16_C( 11584), -INT16_C( 20693),  INT16_C( 26976),  INT16_C( 19273),  INT16_C( 12613), -INT16_C( 31837),  INT16_C( 12979),
+         INT16_C( 13189), -INT16_C(  5776),  INT16_C( 27177), -INT16_C(  2024),  INT16_C(  5611),  INT16_C(  2749), -INT16_C(  2369), -INT16_C( 12790) } },
+    { { -INT16_C( 30137), -INT16_C(  6578),  INT16_C( 13907),  INT16_C(  4666), -INT16_C( 18332),  INT16_C(  1312),  INT16_C(   197),  INT16_C( 11873) },
+      {  INT16_C( 24341),  INT16_C(  2547), -INT16_C( 17191), -INT16_C( 27930),  INT16_C(  1697), -INT16_C( 31756),  INT16_C( 26956), -INT16_C( 19693) },
+      { -INT16_C( 30137),  INT16_C( 24341), -INT16_C(  6578),  INT16_C(  2547),  INT16_C( 13907), -INT16_C( 17191),  INT16_C(  4666), -INT16_C( 27930),
+        -INT16_C( 18332),  INT16_C(  1697),  INT16_C(  1312), -INT16_C( 31756),  INT16_C(   197),  INT16_C( 26956),  INT16_C( 11873), -INT16_C( 19693) } },
+    { {  INT16_C( 21363), -INT16_C( 27767),  INT16_C( 31731), -INT16_C(  8119), -INT16_C( 24337), -INT16_C( 15356),  INT16_C(  5238), -INT16_C(  7430) },
+      { -INT16_C(  8787),  INT16_C( 14686),  INT16_C( 17697),  INT16_C(  3973), -INT16_C( 14938), -INT16_C(  6177),  INT16_C(  8710),  INT16_C(   259) },
+      {  INT16_C( 21363), -INT16_C(  8787), -INT16_C( 27767),  INT16_C( 14686),  INT16_C( 31731),  INT16_C( 17697), -INT16_C(  8119),  INT16_C(  3973),
+        -INT16_C( 24337), -INT16_C( 14938), -INT16_C( 15356), -INT16_C(  6177),  INT16_C(  5238),  INT16_C(  8710), -INT16_C(  7430),  INT16_C(   259) } },
+    { {  INT16_C(  6148),  INT16_C(  3959),  INT16_C( 12693),  INT16_C(  7105),  INT16_C(  5496), -INT16_C(    57),  INT16_C( 16242), -INT16_C(  3637) },
+      {  INT16_C(  9145), -INT16_C(  9859),  INT16_C(  5668), -INT16_C( 20014), -INT16_C(  9709),  INT16_C( 28852), -INT16_C( 30904),  INT16_C( 17481) },
+      {  INT16_C(  6148),  INT16_C(  9145),  INT16_C(  3959), -INT16_C(  9859),  INT16_C( 12693),  INT16_C(  5668),  INT16_C(  7105), -INT16_C( 20014),
+         INT16_C(  5496), -INT16_C(  9709), -INT16_C(    57),  INT16_C( 28852),  INT16_C( 16242), -INT16_C( 30904), -INT16_C(  3637),  INT16_C( 17481) } },
+    { {  INT16_C( 32541),  INT16_C( 31992), -INT16_C( 32226), -INT16_C( 18540), -INT16_C( 12418), -INT16_C( 13109),  INT16_C(  3008), -INT16_C(  8431) },
+      {  INT16_C(  2972), -INT16_C( 29240), -INT16_C( 21877),  INT16_C( 11208),  INT16_C(   460),  INT16_C( 21016), -INT16_C( 32396), -INT16_C( 11613) },
+      {  INT16_C( 32541),  INT16_C(  2972),  INT16_C( 31992), -INT16_C( 29240), -INT16_C( 32226), -INT16_C( 21877), -INT16_C( 18540),  INT16_C( 11208),
+        -INT16_C( 12418),  INT16_C(   460), -INT16_C( 13109),  INT16_C( 21016),  INT16_C(  3008), -INT16_C( 32396), -INT16_C(  8431), -INT16_C( 11613) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t r_ = { { simde_vld1q_s16(test_vec[i].r0),
+                               simde_vld1q_s16(test_vec[i].r1) } };
+
+    int16_t a_[16];
+    simde_vst2q_s16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s16(a_);
+    simde_test_arm_neon_assert_equal_i16x8(r_.val[0], simde_vld1q_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x8(r_.val[1], simde_vld1q_s16(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int16x8_t a0 = simde_test_arm_neon_random_i16x8();
+    simde_int16x8_t a1 = simde_test_arm_neon_random_i16x8();
+    simde_int16x8x2_t a = { { a0, a1 } };
+    int16_t buf[16];
+    simde_vst2q_s16(buf, a);
+
+    simde_test_arm_neon_write_i16x8(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i16x8(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi16(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t r0[4];
+    int32_t r1[4];
+    int32_t a[8];
+  } test_vec[] = {
+    { { -INT32_C(  1611006329),  INT32_C(  2042308271), -INT32_C(   646385124), -INT32_C(   767358045) },
+      {  INT32_C(     2861697), -INT32_C(  1843798205),  INT32_C(  1726377797),  INT32_C(  1038787916) },
+      { -INT32_C(  1611006329),  INT32_C(     2861697),  INT32_C(  2042308271), -INT32_C(  1843798205), -INT32_C(   646385124),  INT32_C(  1726377797), -INT32_C(   767358045),  INT32_C(  1038787916) } },
+    { {  INT32_C(  1344130098), -INT32_C(  1682363726), -INT32_C(  1803187439), -INT32_C(  1449144663) },
+      {  INT32_C(   141808332),  INT32_C(  1425713591), -INT32_C(  1056451835), -INT32_C(   301983994) },
+      {  INT32_C(  1344130098),  INT32_C(   141808332), -INT32_C(  1682363726),  INT32_C(  1425713591), -INT32_C(  1803187439), -INT32_C(  1056451835), -INT32_C(  1449144663), -INT32_C(   301983994) } },
+    { { -INT32_C(   184724326), -INT32_C(  2056946458), -INT32_C(  1938404789), -INT32_C(   657169180) },
+      { -INT32_C(  1433587308), -INT32_C(   321523478), -INT32_C(   708122824), -INT32_C(  2129354132) },
+      { -INT32_C(   184724326), -INT32_C(  1433587308), -INT32_C(  2056946458), -INT32_C(   321523478), -INT32_C(  1938404789), -INT32_C(   708122824), -INT32_C(   657169180), -INT32_C(  2129354132) } },
+    { { -INT32_C(   670981926), -INT32_C(   291369702), -INT32_C(   775805910),  INT32_C(   764702284) },
+      {  INT32_C(  2092658942),  INT32_C(  1568936791),  INT32_C(   376384115),  INT32_C(   876386593) },
+      { -INT32_C(   670981926),  INT32_C(  2092658942), -INT32_C(   291369702),  INT32_C(  1568936791), -INT32_C(   775805910),  INT32_C(   376384115),  INT32_C(   764702284),  INT32_C(   876386593) } },
+    { { -INT32_C(   882926656),  INT32_C(  1230048995), -INT32_C(   671298536), -INT32_C(   323074563) },
+      { -INT32_C(  1284458328), -INT32_C(   746863771),  INT32_C(  1351380224), -INT32_C(  1559963765) },
+      { -INT32_C(   882926656), -INT32_C(  1284458328),  INT32_C(  1230048995), -INT32_C(   746863771), -INT32_C(   671298536),  INT32_C(  1351380224), -INT32_C(   323074563), -INT32_C(  1559963765) } },
+    { { -INT32_C(   107562486), -INT32_C(  1444591153), -INT32_C(  1619899111), -INT32_C(  1080215266) },
+      {  INT32_C(  1341750046),  INT32_C(  1259910114), -INT32_C(   918640403), -INT32_C(  1055782509) },
+      { -INT32_C(   107562486),  INT32_C(  1341750046), -INT32_C(  1444591153),  INT32_C(  1259910114), -INT32_C(  1619899111), -INT32_C(   918640403), -INT32_C(  1080215266), -INT32_C(  1055782509) } },
+    { {  INT32_C(   962640241),  INT32_C(  1807041537),  INT32_C(  1033879419), -INT32_C(  1496507498) },
+      { -INT32_C(   406959704),  INT32_C(   147647043),  INT32_C(   237079300),  INT32_C(   318824881) },
+      {  INT32_C(   962640241), -INT32_C(   406959704),  INT32_C(  1807041537),  INT32_C(   147647043),  INT32_C(  1033879419),  INT32_C(   237079300), -INT32_C(  1496507498),  INT32_C(   318824881) } },
+    { { -INT32_C(   559293344),  INT32_C(  1405648043),  INT32_C(  1704093923), -INT32_C(  1584066609) },
+      { -INT32_C(  1838149952),  INT32_C(  1613556434), -INT32_C(  1327238908),  INT32_C(  1747883680) },
+      { -INT32_C(   559293344), -INT32_C(  1838149952),  INT32_C(  1405648043),  INT32_C(  1613556434),  INT32_C(  1704093923), -INT32_C(  1327238908), -INT32_C(  1584066609),  INT32_C(  1747883680) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t r_ = { { simde_vld1q_s32(test_vec[i].r0),
+                               simde_vld1q_s32(test_vec[i].r1) } };
+
+    int32_t a_[8];
+    simde_vst2q_s32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s32(a_);
+    simde_test_arm_neon_assert_equal_i32x4(r_.val[0], simde_vld1q_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x4(r_.val[1], simde_vld1q_s32(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int32x4_t a0 = simde_test_arm_neon_random_i32x4();
+    simde_int32x4_t a1 = simde_test_arm_neon_random_i32x4();
+    simde_int32x4x2_t a = { { a0, a1 } };
+    int32_t buf[8];
+    simde_vst2q_s32(buf, a);
+
+    simde_test_arm_neon_write_i32x4(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i32x4(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t r0[2];
+    int64_t r1[2];
+    int64_t a[4];
+  } test_vec[] = {
+    { { -INT64_C( 1240886043019871991), -INT64_C( 7748611439060213603) },
+      { -INT64_C( 1878062088584512849),  INT64_C( 2938510364337021796) },
+      { -INT64_C( 1240886043019871991), -INT64_C( 1878062088584512849), -INT64_C( 7748611439060213603),  INT64_C( 2938510364337021796) } },
+    { {  INT64_C( 3723247930855829823), -INT64_C( 5641322061233890058) },
+      { -INT64_C( 8452988554271244527),  INT64_C( 8276508284514097454) },
+      {  INT64_C( 3723247930855829823), -INT64_C( 8452988554271244527), -INT64_C( 5641322061233890058),  INT64_C( 8276508284514097454) } },
+    { { -INT64_C( 6191927590836071810),  INT64_C( 8857217944720138210) },
+      {  INT64_C( 1399745034210771872), -INT64_C( 3269588245194744127) },
+      { -INT64_C( 6191927590836071810),  INT64_C( 1399745034210771872),  INT64_C( 8857217944720138210), -INT64_C( 3269588245194744127) } },
+    { { -INT64_C( 8763680681733712877), -INT64_C( 2459778481933057715) },
+      {  INT64_C( 4169565185520750335),  INT64_C( 6296665323021565877) },
+      { -INT64_C( 8763680681733712877),  INT64_C( 4169565185520750335), -INT64_C( 2459778481933057715),  INT64_C( 6296665323021565877) } },
+    { { -INT64_C(  760279580965777002), -INT64_C( 8606714212426285218) },
+      {  INT64_C( 7084703679219160240), -INT64_C( 5424234955158342225) },
+      { -INT64_C(  760279580965777002),  INT64_C( 7084703679219160240), -INT64_C( 8606714212426285218), -INT64_C( 5424234955158342225) } },
+    { { -INT64_C(  385269592725342403), -INT64_C( 8880764170980163485) },
+      { -INT64_C( 1001516476016751554),  INT64_C( 3767648873011594051) },
+      { -INT64_C(  385269592725342403), -INT64_C( 1001516476016751554), -INT64_C( 8880764170980163485),  INT64_C( 3767648873011594051) } },
+    { {  INT64_C( 2854896270993637208),  INT64_C( 2572409363563875979) },
+      { -INT64_C( 8456397840598817853), -INT64_C( 3370221224014728573) },
+      {  INT64_C( 2854896270993637208), -INT64_C( 8456397840598817853),  INT64_C( 2572409363563875979), -INT64_C( 3370221224014728573) } },
+    { {  INT64_C( 6872477092322168915), -INT64_C( 5231325791769864798) },
+      { -INT64_C( 1055938106705344896),  INT64_C( 8830566740300838996) },
+      {  INT64_C( 6872477092322168915), -INT64_C( 1055938106705344896), -INT64_C( 5231325791769864798),  INT64_C( 8830566740300838996) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t r_ = { { simde_vld1q_s64(test_vec[i].r0),
+                               simde_vld1q_s64(test_vec[i].r1) } };
+
+    int64_t a_[4];
+    simde_vst2q_s64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s64(a_);
+    simde_test_arm_neon_assert_equal_i64x2(r_.val[0], simde_vld1q_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x2(r_.val[1], simde_vld1q_s64(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_int64x2_t a0 = simde_test_arm_neon_random_i64x2();
+    simde_int64x2_t a1 = simde_test_arm_neon_random_i64x2();
+    simde_int64x2x2_t a = { { a0, a1 } };
+    int64_t buf[4];
+    simde_vst2q_s64(buf, a);
+
+    simde_test_arm_neon_write_i64x2(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_i64x2(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t r0[16];
+    uint8_t r1[16];
+    uint8_t a[32];
+  } test_vec[] = {
+    { { UINT8_C( 40), UINT8_C(199), UINT8_C(186), UINT8_C(100), UINT8_C(  6), UINT8_C( 11), UINT8_C( 49), UINT8_C(228),
+        UINT8_C(137), UINT8_C(109), UINT8_C( 59), UINT8_C(146), UINT8_C( 55), UINT8_C(233), UINT8_C( 91), UINT8_C( 37) },
+      { UINT8_C(117), UINT8_C(237), UINT8_C(234), UINT8_C(  7), UINT8_C(148), UINT8_C(221), UINT8_C(142), UINT8_C(153),
+        UINT8_C(184), UINT8_C(123), UINT8_C( 48), UINT8_C( 57), UINT8_C(205), UINT8_C(211), UINT8_C(195), UINT8_C(139) },
+      { UINT8_C( 40), UINT8_C(117), UINT8_C(199), UINT8_C(237), UINT8_C(186), UINT8_C(234), UINT8_C(100), UINT8_C(  7),
+        UINT8_C(  6), UINT8_C(148), UINT8_C( 11), UINT8_C(221), UINT8_C( 49), UINT8_C(142), UINT8_C(228), UINT8_C(153),
+        UINT8_C(137), UINT8_C(184), UINT8_C(109), UINT8_C(123), UINT8_C( 59), UINT8_C( 48), UINT8_C(146), UINT8_C( 57),
+        UINT8_C( 55), UINT8_C(205), UINT8_C(233), UINT8_C(211), UINT8_C( 91), UINT8_C(195), UINT8_C( 37), UINT8_C(139) } },
+    { { UINT8_C(208), UINT8_C(237), UINT8_C(115), UINT8_C(195), UINT8_C(138), UINT8_C(115), UINT8_C( 19), UINT8_C( 25),
+        UINT8_C(117), UINT8_C( 89), UINT8_C(164), UINT8_C(203), UINT8_C(243), UINT8_C(142), UINT8_C(229), UINT8_C(107) },
+      { UINT8_C( 86), UINT8_C( 21), UINT8_C(193), UINT8_C( 58), UINT8_C(219), UINT8_C( 81), UINT8_C(246), UINT8_C( 41),
+        UINT8_C(174), UINT8_C( 76), UINT8_C( 84), UINT8_C(223), UINT8_C(223), UINT8_C( 49), UINT8_C(  4), UINT8_C( 90) },
+      { UINT8_C(208), UINT8_C( 86), UINT8_C(237), UINT8_C( 21), UINT8_C(115), UINT8_C(193), UINT8_C(195), UINT8_C( 58),
+        UINT8_C(138), UINT8_C(219), UINT8_C(115), UINT8_C( 81), UINT8_C( 19), UINT8_C(246), UINT8_C( 25), UINT8_C( 41),
+        UINT8_C(117), UINT8_C(174), UINT8_C( 89), UINT8_C( 76), UINT8_C(164), UINT8_C( 84), UINT8_C(203), UINT8_C(223),
+        UINT8_C(243), UINT8_C(223), UINT8_C(142), UINT8_C( 49), UINT8_C(229), UINT8_C(  4), UINT8_C(107), UINT8_C( 90) } },
+    { { UINT8_C(145), UINT8_C(171), UINT8_C(117), UINT8_C( 74), UINT8_C(225), UINT8_C(222), UINT8_C(159), UINT8_C( 62),
+        UINT8_C( 51), UINT8_C( 23), UINT8_C( 42), UINT8_C(153), UINT8_C(  9), UINT8_C(246), UINT8_C(192), UINT8_C( 12) },
+      { UINT8_C(200), UINT8_C(246), UINT8_C( 95), UINT8_C( 20), UINT8_C( 57), UINT8_C( 18), UINT8_C(142), UINT8_C( 23),
+        UINT8_C( 50), UINT8_C( 97), UINT8_C(134), UINT8_C( 28), UINT8_C( 87), UINT8_C( 59), UINT8_C( 81), UINT8_C(154) },
+      { UINT8_C(145), UINT8_C(200), UINT8_C(171), UINT8_C(246), UINT8_C(117), UINT8_C( 95), UINT8_C( 74), UINT8_C( 20),
+        UINT8_C(225), UINT8_C( 57), UINT8_C(222), UINT8_C( 18), UINT8_C(159), UINT8_C(142), UINT8_C( 62), UINT8_C( 23),
+        UINT8_C( 51), UINT8_C( 50), UINT8_C( 23), UINT8_C( 97), UINT8_C( 42), UINT8_C(134), UINT8_C(153), UINT8_C( 28),
+        UINT8_C(  9), UINT8_C( 87), UINT8_C(246), UINT8_C( 59), UINT8_C(192), UINT8_C( 81), UINT8_C( 12), UINT8_C(154) } },
+    { { UINT8_C(176), UINT8_C( 29), UINT8_C( 63), UINT8_C( 93), UINT8_C( 84), UINT8_C( 32), UINT8_C(144), UINT8_C( 63),
+        UINT8_C(241), UINT8_C(118), UINT8_C( 38), UINT8_C(179), UINT8_C( 78), UINT8_C(192), UINT8_C( 69), UINT8_C( 27) },
+      { UINT8_C( 80), UINT8_C(181), UINT8_C(124), UINT8_C(232), UINT8_C(209), UINT8_C( 60), UINT8_C( 46), UINT8_C(151),
+        UINT8_C(184), UINT8_C(184), UINT8_C(110), UINT8_C(137), UINT8_C(146), UINT8_C( 68), UINT8_C(128), UINT8_C( 49) },
+      { UINT8_C(176), UINT8_C( 80), UINT8_C( 29), UINT8_C(181), UINT8_C( 63), UINT8_C(124), UINT8_C( 93), UINT8_C(232),
+        UINT8_C( 84), UINT8_C(209), UINT8_C( 32), UINT8_C( 60), UINT8_C(144), UINT8_C( 46), UINT8_C( 63), UINT8_C(151),
+        UINT8_C(241), UINT8_C(184), UINT8_C(118), UINT8_C(184), UINT8_C( 38), UINT8_C(110), UINT8_C(179), UINT8_C(137),
+        UINT8_C( 78), UINT8_C(146), UINT8_C(192), UINT8_C( 68), UINT8_C( 69), UINT8_C(128), UINT8_C( 27), UINT8_C( 49) } },
+    { { UINT8_C(154), UINT8_C(222), UINT8_C( 45), UINT8_C(172), UINT8_C(157), UINT8_C(182), UINT8_C(102), UINT8_C(159),
+        UINT8_C(200), UINT8_C(100), UINT8_C(152), UINT8_C(192), UINT8_C(104), UINT8_C( 78), UINT8_C(252), UINT8_C(221) },
+      { UINT8_C( 45), UINT8_C(100), UINT8_C(  3), UINT8_C(121), UINT8_C( 31), UINT8_C(151), UINT8_C(176), UINT8_C(205),
+        UINT8_C( 23), UINT8_C(153), UINT8_C(188), UINT8_C(207), UINT8_C( 22), UINT8_C(  0), UINT8_C( 76), UINT8_C(220) },
+      { UINT8_C(154), UINT8_C( 45), UINT8_C(222), UINT8_C(100), UINT8_C( 45), UINT8_C(  3), UINT8_C(172), UINT8_C(121),
+        UINT8_C(157), UINT8_C( 31), UINT8_C(182), UINT8_C(151), UINT8_C(102), UINT8_C(176), UINT8_C(159), UINT8_C(205),
+        UINT8_C(200), UINT8_C( 23), UINT8_C(100), UINT8_C(153), UINT8_C(152), UINT8_C(188), UINT8_C(192), UINT8_C(207),
+        UINT8_C(104), UINT8_C( 22), UINT8_C( 78), UINT8_C(  0), UINT8_C(252), UINT8_C( 76), UINT8_C(221), UINT8_C(220) } },
+    { { UINT8_C(159), UINT8_C( 47), UINT8_C(  5), UINT8_C(223), UINT8_C(110), UINT8_C( 32),    UINT8_MAX, UINT8_C(123),
+        UINT8_C(186), UINT8_C( 87), UINT8_C( 99), UINT8_C( 79), UINT8_C(232), UINT8_C(171), UINT8_C(145), UINT8_C(192) },
+      { UINT8_C(207), UINT8_C(163), UINT8_C( 88), UINT8_C(197), UINT8_C( 97), UINT8_C( 65), UINT8_C(179), UINT8_C( 89),
+        UINT8_C(194), UINT8_C( 53), UINT8_C(177), UINT8_C(100), UINT8_C( 38), UINT8_C(165), UINT8_C(107), UINT8_C(244) },
+      { UINT8_C(159), UINT8_C(207), UINT8_C( 47), UINT8_C(163), UINT8_C(  5), UINT8_C( 88), UINT8_C(223), UINT8_C(197),
+        UINT8_C(110), UINT8_C( 97), UINT8_C( 32), UINT8_C( 65),    UINT8_MAX, UINT8_C(179), UINT8_C(123), UINT8_C( 89),
+        UINT8_C(186), UINT8_C(194), UINT8_C( 87), UINT8_C( 53), UINT8_C( 99), UINT8_C(177), UINT8_C( 79), UINT8_C(100),
+        UINT8_C(232), UINT8_C( 38), UINT8_C(171), UINT8_C(165), UINT8_C(145), UINT8_C(107), UINT8_C(192), UINT8_C(244) } },
+    { { UINT8_C( 81), UINT8_C( 98), UINT8_C( 59), UINT8_C( 33), UINT8_C( 29), UINT8_C(180), UINT8_C(191), UINT8_C(104),
+        UINT8_C( 36), UINT8_C(176), UINT8_C( 90), UINT8_C(234), UINT8_C(  4), UINT8_C( 98), UINT8_C(180), UINT8_C(105) },
+      { UINT8_C(160), UINT8_C(132), UINT8_C( 19), UINT8_C(247), UINT8_C(243), UINT8_C(181), UINT8_C(254), UINT8_C(206),
+        UINT8_C(192), UINT8_C(234), UINT8_C(206), UINT8_C( 41), UINT8_C(180),    UINT8_MAX, UINT8_C(  5), UINT8_C(116) },
+      { UINT8_C( 81), UINT8_C(160), UINT8_C( 98), UINT8_C(132), UINT8_C( 59), UINT8_C( 19), UINT8_C( 33), UINT8_C(247),
+        UINT8_C( 29), UINT8_C(243), UINT8_C(180), UINT8_C(181), UINT8_C(191), UINT8_C(254), UINT8_C(104), UINT8_C(206),
+        UINT8_C( 36), UINT8_C(192), UINT8_C(176), UINT8_C(234), UINT8_C( 90), UINT8_C(206), UINT8_C(234), UINT8_C( 41),
+        UINT8_C(  4), UINT8_C(180), UINT8_C( 98),    UINT8_MAX, UINT8_C(180), UINT8_C(  5), UINT8_C(105), UINT8_C(116) } },
+    { { UINT8_C( 69), UINT8_C( 20), UINT8_C( 60), UINT8_C(144), UINT8_C(  5), UINT8_C( 38), UINT8_C(163), UINT8_C(151),
+        UINT8_C(151), UINT8_C( 77), UINT8_C( 92), UINT8_C( 29), UINT8_C(191), UINT8_C(146), UINT8_C( 59), UINT8_C(121) },
+      { UINT8_C( 71), UINT8_C(218), UINT8_C( 29), UINT8_C(127), UINT8_C( 60), UINT8_C(207), UINT8_C(217), UINT8_C(106),
+        UINT8_C(125), UINT8_C(119), UINT8_C(188), UINT8_C(  1), UINT8_C(222), UINT8_C( 48), UINT8_C(170), UINT8_C(118) },
+      { UINT8_C( 69), UINT8_C( 71), UINT8_C( 20), UINT8_C(218), UINT8_C( 60), UINT8_C( 29), UINT8_C(144), UINT8_C(127),
+        UINT8_C(  5), UINT8_C( 60), UINT8_C( 38), UINT8_C(207), UINT8_C(163), UINT8_C(217), UINT8_C(151), UINT8_C(106),
+        UINT8_C(151), UINT8_C(125), UINT8_C( 77), UINT8_C(119), UINT8_C( 92), UINT8_C(188), UINT8_C( 29), UINT8_C(  1),
+        UINT8_C(191), UINT8_C(222), UINT8_C(146), UINT8_C( 48), UINT8_C( 59), UINT8_C(170), UINT8_C(121), UINT8_C(118) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t r_ = { { simde_vld1q_u8(test_vec[i].r0),
+                                simde_vld1q_u8(test_vec[i].r1) } };
+
+    uint8_t a_[32];
+    simde_vst2q_u8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u8(a_);
+    simde_test_arm_neon_assert_equal_u8x16(r_.val[0], simde_vld1q_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x16(r_.val[1], simde_vld1q_u8(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint8x16_t a0 = simde_test_arm_neon_random_u8x16();
+    simde_uint8x16_t a1 = simde_test_arm_neon_random_u8x16();
+    simde_uint8x16x2_t a = { { a0, a1 } };
+    uint8_t buf[32];
+    simde_vst2q_u8(buf, a);
+
+    simde_test_arm_neon_write_u8x16(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu8(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t r0[8];
+    uint16_t r1[8];
+    uint16_t a[16];
+  } test_vec[] = {
+    { { UINT16_C(23669), UINT16_C(32735), UINT16_C(63390), UINT16_C( 5029), UINT16_C( 5249), UINT16_C(14908), UINT16_C(27073), UINT16_C(45231) },
+      { UINT16_C(58002), UINT16_C( 9408), UINT16_C(44708), UINT16_C( 4823), UINT16_C(23176), UINT16_C(36050), UINT16_C(54209), UINT16_C( 2915) },
+      { UINT16_C(23669), UINT16_C(58002), UINT16_C(32735), UINT16_C( 9408), UINT16_C(63390), UINT16_C(44708), UINT16_C( 5029), UINT16_C( 4823),
+        UINT16_C( 5249), UINT16_C(23176), UINT16_C(14908), UINT16_C(36050), UINT16_C(27073), UINT16_C(54209), UINT16_C(45231), UINT16_C( 2915) } },
+    { { UINT16_C(49667), UINT16_C(46719), UINT16_C(47409), UINT16_C( 7466), UINT16_C(17464), UINT16_C(62290), UINT16_C(44564), UINT16_C(46366) },
+      { UINT16_C(42980), UINT16_C( 1098), UINT16_C(55051), UINT16_C(50817), UINT16_C(33614), UINT16_C( 7650), UINT16_C(60902), UINT16_C(40730) },
+      { UINT16_C(49667), UINT16_C(42980), UINT16_C(46719), UINT16_C( 1098), UINT16_C(47409), UINT16_C(55051), UINT16_C( 7466), UINT16_C(50817),
+        UINT16_C(17464), UINT16_C(33614), UINT16_C(62290), UINT16_C( 7650), UINT16_C(44564), UINT16_C(60902), UINT16_C(46366), UINT16_C(40730) } },
+    { { UINT16_C(47194), UINT16_C(60525), UINT16_C(13728), UINT16_C(61126), UINT16_C(37906), UINT16_C(23162), UINT16_C(12865), UINT16_C(30736) },
+      { UINT16_C(40464), UINT16_C(34844), UINT16_C(21341), UINT16_C(64156), UINT16_C(65401), UINT16_C(57613), UINT16_C(22428), UINT16_C( 8208) },
+      { UINT16_C(47194), UINT16_C(40464), UINT16_C(60525), UINT16_C(34844), UINT16_C(13728), UINT16_C(21341), UINT16_C(61126), UINT16_C(64156),
+        UINT16_C(37906), UINT16_C(65401), UINT16_C(23162), UINT16_C(57613), UINT16_C(12865), UINT16_C(22428), UINT16_C(30736), UINT16_C( 8208) } },
+    { { UINT16_C(51761), UINT16_C(14506), UINT16_C(54783), UINT16_C(45342), UINT16_C(24471), UINT16_C(54788), UINT16_C(38601), UINT16_C(  767) },
+      { UINT16_C(15254), UINT16_C(20261), UINT16_C(24599), UINT16_C(  607), UINT16_C(28783), UINT16_C(62955), UINT16_C(46632), UINT16_C(52599) },
+      { UINT16_C(51761), UINT16_C(15254), UINT16_C(14506), UINT16_C(20261), UINT16_C(54783), UINT16_C(24599), UINT16_C(45342), UINT16_C(  607),
+        UINT16_C(24471), UINT16_C(28783), UINT16_C(54788), UINT16_C(62955), UINT16_C(38601), UINT16_C(46632), UINT16_C(  767), UINT16_C(52599) } },
+    { { UINT16_C(33304), UINT16_C(14599), UINT16_C(10543), UINT16_C( 1035), UINT16_C(42530), UINT16_C( 7868), UINT16_C(33820), UINT16_C(54924) },
+      { UINT16_C(34416), UINT16_C(52114), UINT16_C(29201), UINT16_C(44311), UINT16_C(56805), UINT16_C(34961), UINT16_C(42878), UINT16_C(55124) },
+      { UINT16_C(33304), UINT16_C(34416), UINT16_C(14599), UINT16_C(52114), UINT16_C(10543), UINT16_C(29201), UINT16_C( 1035), UINT16_C(44311),
+        UINT16_C(42530), UINT16_C(56805), UINT16_C( 7868), UINT16_C(34961), UINT16_C(33820), UINT16_C(42878), UINT16_C(54924), UINT16_C(55124) } },
+    { { UINT16_C(43359), UINT16_C( 8510), UINT16_C(32854), UINT16_C(54154), UINT16_C(26331), UINT16_C(54397), UINT16_C(27988), UINT16_C(19366) },
+      { UINT16_C(44488), UINT16_C(44468), UINT16_C(28698), UINT16_C(54371), UINT16_C( 4554), UINT16_C(22269), UINT16_C(14466), UINT16_C(38325) },
+      { UINT16_C(43359), UINT16_C(44488), UINT16_C( 8510), UINT16_C(44468), UINT16_C(32854), UINT16_C(28698), UINT16_C(54154), UINT16_C(54371),
+        UINT16_C(26331), UINT16_C( 4554), UINT16_C(54397), UINT16_C(22269), UINT16_C(27988), UINT16_C(14466), UINT16_C(19366), UINT16_C(38325) } },
+    { { UINT16_C( 3504), UINT16_C(42726), UINT16_C( 3218), UINT16_C(35177), UINT16_C(23543), UINT16_C( 7983), UINT16_C(24759), UINT16_C(33348) },
+      { UINT16_C(29911), UINT16_C(13598), UINT16_C(13182), UINT16_C( 9284), UINT16_C(15272), UINT16_C(11874), UINT16_C(29302), UINT16_C( 6783) },
+      { UINT16_C( 3504), UINT16_C(29911), UINT16_C(42726), UINT16_C(13598), UINT16_C( 3218), UINT16_C(13182), UINT16_C(35177), UINT16_C( 9284),
+        UINT16_C(23543), UINT16_C(15272), UINT16_C( 7983), UINT16_C(11874), UINT16_C(24759), UINT16_C(29302), UINT16_C(33348), UINT16_C( 6783) } },
+    { { UINT16_C(19034), UINT16_C(33002), UINT16_C(17098), UINT16_C(17404), UINT16_C(32217), UINT16_C(64676), UINT16_C(50045), UINT16_C(52614) },
+      { UINT16_C( 3980), UINT16_C( 6601), UINT16_C(  891), UINT16_C(53977), UINT16_C(29356), UINT16_C(17209), UINT16_C(58603), UINT16_C(32093) },
+      { UINT16_C(19034), UINT16_C( 3980), UINT16_C(33002), UINT16_C( 6601), UINT16_C(17098), UINT16_C(  891), UINT16_C(17404), UINT16_C(53977),
+        UINT16_C(32217), UINT16_C(29356), UINT16_C(64676), UINT16_C(17209), UINT16_C(50045), UINT16_C(58603), UINT16_C(52614), UINT16_C(32093) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t r_ = { { simde_vld1q_u16(test_vec[i].r0),
+                                simde_vld1q_u16(test_vec[i].r1) } };
+
+    uint16_t a_[16];
+    simde_vst2q_u16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u16(a_);
+    simde_test_arm_neon_assert_equal_u16x8(r_.val[0], simde_vld1q_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x8(r_.val[1], simde_vld1q_u16(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint16x8_t a0 = simde_test_arm_neon_random_u16x8();
+    simde_uint16x8_t a1 = simde_test_arm_neon_random_u16x8();
+    simde_uint16x8x2_t a = { { a0, a1 } };
+    uint16_t buf[16];
+    simde_vst2q_u16(buf, a);
+
+    simde_test_arm_neon_write_u16x8(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu16(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t r0[4];
+    uint32_t r1[4];
+    uint32_t a[8];
+  } test_vec[] = {
+    { { UINT32_C(2714175786), UINT32_C(2498554129), UINT32_C(1567237174), UINT32_C(1603186075) },
+      { UINT32_C(4177963704), UINT32_C(2610795938), UINT32_C(2915477154), UINT32_C( 948970111) },
+      { UINT32_C(2714175786), UINT32_C(4177963704), UINT32_C(2498554129), UINT32_C(2610795938), UINT32_C(1567237174), UINT32_C(2915477154), UINT32_C(1603186075), UINT32_C( 948970111) } },
+    { { UINT32_C(3545148947), UINT32_C(1504838023), UINT32_C(3617267921), UINT32_C(4128021965) },
+      { UINT32_C( 166810255), UINT32_C(2929625974), UINT32_C( 837089005), UINT32_C(3255059021) },
+      { UINT32_C(3545148947), UINT32_C( 166810255), UINT32_C(1504838023), UINT32_C(2929625974), UINT32_C(3617267921), UINT32_C( 837089005), UINT32_C(4128021965), UINT32_C(3255059021) } },
+    { { UINT32_C(3396779984), UINT32_C(2360594723), UINT32_C(1680086471), UINT32_C(1927128014) },
+      { UINT32_C(3866762547), UINT32_C(2975067802), UINT32_C( 305852623), UINT32_C(  39588990) },
+      { UINT32_C(3396779984), UINT32_C(3866762547), UINT32_C(2360594723), UINT32_C(2975067802), UINT32_C(1680086471), UINT32_C( 305852623), UINT32_C(1927128014), UINT32_C(  39588990) } },
+    { { UINT32_C(4028391272), UINT32_C(4288641958), UINT32_C(2665470311), UINT32_C(1864777553) },
+      { UINT32_C(1767046901), UINT32_C( 194045147), UINT32_C(3563099803), UINT32_C( 353921870) },
+      { UINT32_C(4028391272), UINT32_C(1767046901), UINT32_C(4288641958), UINT32_C( 194045147), UINT32_C(2665470311), UINT32_C(3563099803), UINT32_C(1864777553), UINT32_C( 353921870) } },
+    { { UINT32_C(2299965260), UINT32_C(2150460825), UINT32_C(1973505969), UINT32_C(1349890728) },
+      { UINT32_C( 791587658), UINT32_C(2434016605), UINT32_C(3366968780), UINT32_C(2729099383) },
+      { UINT32_C(2299965260), UINT32_C( 791587658), UINT32_C(2150460825), UINT32_C(2434016605), UINT32_C(1973505969), UINT32_C(3366968780), UINT32_C(1349890728), UINT32_C(2729099383) } },
+    { { UINT32_C( 628101693), UINT32_C(3053727451), UINT32_C(1289049262), UINT32_C(2016237285) },
+      { UINT32_C( 378384207), UINT32_C(  27877314), UINT32_C(  67836915), UINT32_C(1364855362) },
+      { UINT32_C( 628101693), UINT32_C( 378384207), UINT32_C(3053727451), UINT32_C(  27877314), UINT32_C(1289049262), UINT32_C(  67836915), UINT32_C(2016237285), UINT32_C(1364855362) } },
+    { { UINT32_C(1275946390), UINT32_C(3721583488), UINT32_C( 190474009), UINT32_C(2114065262) },
+      { UINT32_C(2015278810), UINT32_C(1529846432), UINT32_C(1490102696), UINT32_C(4223720289) },
+      { UINT32_C(1275946390), UINT32_C(2015278810), UINT32_C(3721583488), UINT32_C(1529846432), UINT32_C( 190474009), UINT32_C(1490102696), UINT32_C(2114065262), UINT32_C(4223720289) } },
+    { { UINT32_C(  77684044), UINT32_C(3156066669), UINT32_C(1992512614), UINT32_C(  14344597) },
+      { UINT32_C(1230018807), UINT32_C(2523366218), UINT32_C( 994392940), UINT32_C(3847628363) },
+      { UINT32_C(  77684044), UINT32_C(1230018807), UINT32_C(3156066669), UINT32_C(2523366218), UINT32_C(1992512614), UINT32_C( 994392940), UINT32_C(  14344597), UINT32_C(3847628363) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t r_ = { { simde_vld1q_u32(test_vec[i].r0),
+                                simde_vld1q_u32(test_vec[i].r1) } };
+
+    uint32_t a_[8];
+    simde_vst2q_u32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u32(a_);
+    simde_test_arm_neon_assert_equal_u32x4(r_.val[0], simde_vld1q_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x4(r_.val[1], simde_vld1q_u32(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint32x4_t a0 = simde_test_arm_neon_random_u32x4();
+    simde_uint32x4_t a1 = simde_test_arm_neon_random_u32x4();
+    simde_uint32x4x2_t a = { { a0, a1 } };
+    uint32_t buf[8];
+    simde_vst2q_u32(buf, a);
+
+    simde_test_arm_neon_write_u32x4(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu32(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vst2q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t r0[2];
+    uint64_t r1[2];
+    uint64_t a[4];
+  } test_vec[] = {
+    { { UINT64_C(14425900744123670012), UINT64_C( 1325137960754356760) },
+      { UINT64_C(13507862503399417000), UINT64_C( 1168677634785436129) },
+      { UINT64_C(14425900744123670012), UINT64_C(13507862503399417000), UINT64_C( 1325137960754356760), UINT64_C( 1168677634785436129) } },
+    { { UINT64_C( 4255039969929658047), UINT64_C(12507272339830081195) },
+      { UINT64_C(18354224283347605036), UINT64_C(17995190718167288960) },
+      { UINT64_C( 4255039969929658047), UINT64_C(18354224283347605036), UINT64_C(12507272339830081195), UINT64_C(17995190718167288960) } },
+    { { UINT64_C(12366147883561586134), UINT64_C(15738603823927178963) },
+      { UINT64_C( 7384270503591009187), UINT64_C(12841408962988691081) },
+      { UINT64_C(12366147883561586134), UINT64_C( 7384270503591009187), UINT64_C(15738603823927178963), UINT64_C(12841408962988691081) } },
+    { { UINT64_C( 8495476920099732431), UINT64_C( 1019811324311993867) },
+      { UINT64_C(17304802413464691777), UINT64_C( 1930649230399497541) },
+      { UINT64_C( 8495476920099732431), UINT64_C(17304802413464691777), UINT64_C( 1019811324311993867), UINT64_C( 1930649230399497541) } },
+    { { UINT64_C( 2771015604497931395), UINT64_C(11178873439875990044) },
+      { UINT64_C( 5621211295289619906), UINT64_C( 4417845843599596125) },
+      { UINT64_C( 2771015604497931395), UINT64_C( 5621211295289619906), UINT64_C(11178873439875990044), UINT64_C( 4417845843599596125) } },
+    { { UINT64_C( 1432364402801753282), UINT64_C( 5853039694158108468) },
+      { UINT64_C(16456167400327687176), UINT64_C(  560041094272434451) },
+      { UINT64_C( 1432364402801753282), UINT64_C(16456167400327687176), UINT64_C( 5853039694158108468), UINT64_C(  560041094272434451) } },
+    { { UINT64_C(14957251911604122407), UINT64_C(16304047158758967100) },
+      { UINT64_C(11017879992669826064), UINT64_C(13263474308542904075) },
+      { UINT64_C(14957251911604122407), UINT64_C(11017879992669826064), UINT64_C(16304047158758967100), UINT64_C(13263474308542904075) } },
+    { { UINT64_C(10585625612261443671), UINT64_C( 4562663093629347237) },
+      { UINT64_C(13995262307395273342), UINT64_C( 4684738594940267753) },
+      { UINT64_C(10585625612261443671), UINT64_C(13995262307395273342), UINT64_C( 4562663093629347237), UINT64_C( 4684738594940267753) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t r_ = { { simde_vld1q_u64(test_vec[i].r0),
+                                simde_vld1q_u64(test_vec[i].r1) } };
+
+    uint64_t a_[4];
+    simde_vst2q_u64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u64(a_);
+    simde_test_arm_neon_assert_equal_u64x2(r_.val[0], simde_vld1q_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x2(r_.val[1], simde_vld1q_u64(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_uint64x2_t a0 = simde_test_arm_neon_random_u64x2();
+    simde_uint64x2_t a1 = simde_test_arm_neon_random_u64x2();
+    simde_uint64x2x2_t a = { { a0, a1 } };
+    uint64_t buf[4];
+    simde_vst2q_u64(buf, a);
+
+    simde_test_arm_neon_write_u64x2(2, a0, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, a1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vu64(2, sizeof(buf) / sizeof(buf[0]), buf, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
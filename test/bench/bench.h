@@ -0,0 +1,629 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Micro-benchmark harness for SIMDe.
+ *
+ * Each benchmark is a function which receives a simde_bench_ctx and
+ * uses SIMDE_BENCH_LOOP to time a single expression in two ways:
+ *
+ *  - latency: one dependency chain, every operation consumes the
+ *    result of the previous one;
+ *  - throughput: eight independent chains interleaved, so the CPU is
+ *    free to overlap operations.
+ *
+ * The expression may refer to `a`, the previous value of the chain,
+ * and `k`, an index in [0, 64) which changes on every operation (use
+ * it to vary addresses for loads and stores so they can't be hoisted
+ * out of the loop).  Inputs should come from simde_bench_data or the
+ * simde_bench_opaque_* functions so the compiler can't constant-fold
+ * the work away.
+ *
+ * Results are reported as nanoseconds and cycles per operation, either
+ * as a human-readable table or (with --json) as a JSON document which
+ * also records the compiler and the ISA extensions SIMDe used natively,
+ * so runs from different releases/compilers can be diffed. */
+
+#if !defined(SIMDE_BENCH_H)
+#define SIMDE_BENCH_H
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../simde/simde-common.h"
+
+#if defined(_WIN32)
+  #include <windows.h>
+#endif
+#if defined(_MSC_VER) && (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64))
+  #include <intrin.h>
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DIAGNOSTIC_DISABLE_UNUSED_FUNCTION_
+SIMDE_DIAGNOSTIC_DISABLE_PADDED_
+SIMDE_DIAGNOSTIC_DISABLE_C99_EXTENSIONS_
+SIMDE_DIAGNOSTIC_DISABLE_NO_EMMS_INSTRUCTION_
+SIMDE_DIAGNOSTIC_DISABLE_CPP98_COMPAT_PEDANTIC_
+SIMDE_DIAGNOSTIC_DISABLE_ANNEX_K_
+
+#if !defined(SIMDE_BENCH_CONFIG)
+  #if defined(SIMDE_NO_NATIVE)
+    #define SIMDE_BENCH_CONFIG "emul"
+  #else
+    #define SIMDE_BENCH_CONFIG "native"
+  #endif
+#endif
+
+#if defined(__cplusplus)
+  #define SIMDE_BENCH_LANGUAGE "c++"
+#else
+  #define SIMDE_BENCH_LANGUAGE "c"
+#endif
+
+#if defined(__clang__) && defined(__clang_version__)
+  #define SIMDE_BENCH_COMPILER "clang " __clang_version__
+#elif defined(__INTEL_COMPILER) && defined(__VERSION__)
+  #define SIMDE_BENCH_COMPILER "icc " __VERSION__
+#elif defined(__GNUC__) && defined(__VERSION__)
+  #define SIMDE_BENCH_COMPILER "gcc " __VERSION__
+#elif defined(_MSC_VER)
+  #define SIMDE_BENCH_COMPILER "msvc " HEDLEY_STRINGIFY(_MSC_FULL_VER)
+#else
+  #define SIMDE_BENCH_COMPILER "unknown"
+#endif
+
+/* Space-separated list of the extensions SIMDe is allowed to use
+ * natively in this build. */
+static const char simde_bench_native_isa[] = ""
+#if defined(SIMDE_X86_MMX_NATIVE)
+  " mmx"
+#endif
+#if defined(SIMDE_X86_SSE_NATIVE)
+  " sse"
+#endif
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  " sse2"
+#endif
+#if defined(SIMDE_X86_SSE3_NATIVE)
+  " sse3"
+#endif
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+  " ssse3"
+#endif
+#if defined(SIMDE_X86_SSE4_1_NATIVE)
+  " sse4.1"
+#endif
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  " sse4.2"
+#endif
+#if defined(SIMDE_X86_AVX_NATIVE)
+  " avx"
+#endif
+#if defined(SIMDE_X86_AVX2_NATIVE)
+  " avx2"
+#endif
+#if defined(SIMDE_X86_FMA_NATIVE)
+  " fma"
+#endif
+#if defined(SIMDE_X86_F16C_NATIVE)
+  " f16c"
+#endif
+#if defined(SIMDE_X86_BMI1_NATIVE)
+  " bmi1"
+#endif
+#if defined(SIMDE_X86_BMI2_NATIVE)
+  " bmi2"
+#endif
+#if defined(SIMDE_X86_LZCNT_NATIVE)
+  " lzcnt"
+#endif
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  " avx512f"
+#endif
+#if defined(SIMDE_X86_AVX512BW_NATIVE)
+  " avx512bw"
+#endif
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  " avx512vl"
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  " avx512vbmi2"
+#endif
+#if defined(SIMDE_X86_AVX512BITALG_NATIVE)
+  " avx512bitalg"
+#endif
+#if defined(SIMDE_X86_AVX512VPOPCNTDQ_NATIVE)
+  " avx512vpopcntdq"
+#endif
+#if defined(SIMDE_X86_AVX512VNNI_NATIVE)
+  " avx512vnni"
+#endif
+#if defined(SIMDE_X86_AVXVNNI_NATIVE)
+  " avxvnni"
+#endif
+#if defined(SIMDE_X86_AES_NATIVE)
+  " aes"
+#endif
+#if defined(SIMDE_X86_VAES_NATIVE)
+  " vaes"
+#endif
+#if defined(SIMDE_X86_SHA_NATIVE)
+  " sha"
+#endif
+#if defined(SIMDE_X86_PCLMUL_NATIVE)
+  " pclmul"
+#endif
+#if defined(SIMDE_X86_GFNI_NATIVE)
+  " gfni"
+#endif
+#if defined(SIMDE_X86_SVML_NATIVE)
+  " svml"
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  " neon"
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  " neon-a64"
+#endif
+#if defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+  " altivec"
+#endif
+#if defined(SIMDE_POWER_ALTIVEC_P8_NATIVE)
+  " power8"
+#endif
+#if defined(SIMDE_WASM_SIMD128_NATIVE)
+  " wasm-simd128"
+#endif
+  ;
+
+/* Timers */
+
+static uint64_t
+simde_bench_now_ns(void) {
+  #if defined(_WIN32)
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return HEDLEY_STATIC_CAST(uint64_t, (HEDLEY_STATIC_CAST(double, count.QuadPart) * 1e9) / HEDLEY_STATIC_CAST(double, freq.QuadPart));
+  #elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (HEDLEY_STATIC_CAST(uint64_t, ts.tv_sec) * UINT64_C(1000000000)) + HEDLEY_STATIC_CAST(uint64_t, ts.tv_nsec);
+  #else
+    return HEDLEY_STATIC_CAST(uint64_t, (HEDLEY_STATIC_CAST(double, clock()) * 1e9) / HEDLEY_STATIC_CAST(double, CLOCKS_PER_SEC));
+  #endif
+}
+
+/* On x86 this is the TSC, which counts reference cycles at a constant
+ * rate rather than core clock cycles; on AArch64 it is the generic
+ * timer.  Either way it's only comparable between runs on the same
+ * machine, which is what we want for diffing. */
+#if defined(_MSC_VER) && (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64))
+  #define SIMDE_BENCH_CYCLE_COUNTER "tsc"
+  static uint64_t simde_bench_cycles(void) { return HEDLEY_STATIC_CAST(uint64_t, __rdtsc()); }
+#elif (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)) && (HEDLEY_GNUC_VERSION_CHECK(3,0,0) || defined(__clang__))
+  #define SIMDE_BENCH_CYCLE_COUNTER "tsc"
+  static uint64_t
+  simde_bench_cycles(void) {
+    uint32_t lo, hi;
+    __asm__ __volatile__("rdtsc" : "=a" (lo), "=d" (hi));
+    return (HEDLEY_STATIC_CAST(uint64_t, hi) << 32) | lo;
+  }
+#elif defined(SIMDE_ARCH_AARCH64) && (HEDLEY_GNUC_VERSION_CHECK(3,0,0) || defined(__clang__))
+  #define SIMDE_BENCH_CYCLE_COUNTER "cntvct"
+  static uint64_t
+  simde_bench_cycles(void) {
+    uint64_t r;
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r" (r));
+    return r;
+  }
+#else
+  static uint64_t simde_bench_cycles(void) { return 0; }
+#endif
+
+/* Inputs */
+
+#define SIMDE_BENCH_DATA_LENGTH 4096
+
+/* Filled with pseudo-random values at startup.  Floating-point
+ * elements are in [1, 2) so chains of arithmetic don't wander into
+ * denormals or infinities too quickly; integer views see random bits. */
+static union {
+  uint8_t       u8[SIMDE_BENCH_DATA_LENGTH];
+  int8_t        i8[SIMDE_BENCH_DATA_LENGTH];
+  uint16_t     u16[SIMDE_BENCH_DATA_LENGTH / sizeof(uint16_t)];
+  int16_t      i16[SIMDE_BENCH_DATA_LENGTH / sizeof(int16_t)];
+  uint32_t     u32[SIMDE_BENCH_DATA_LENGTH / sizeof(uint32_t)];
+  int32_t      i32[SIMDE_BENCH_DATA_LENGTH / sizeof(int32_t)];
+  uint64_t     u64[SIMDE_BENCH_DATA_LENGTH / sizeof(uint64_t)];
+  int64_t      i64[SIMDE_BENCH_DATA_LENGTH / sizeof(int64_t)];
+  simde_float32 f32[SIMDE_BENCH_DATA_LENGTH / sizeof(simde_float32)];
+  simde_float64 f64[SIMDE_BENCH_DATA_LENGTH / sizeof(simde_float64)];
+} simde_bench_data;
+
+/* Output buffer for store benchmarks. */
+static union {
+  uint8_t       u8[SIMDE_BENCH_DATA_LENGTH];
+  uint16_t     u16[SIMDE_BENCH_DATA_LENGTH / sizeof(uint16_t)];
+  uint32_t     u32[SIMDE_BENCH_DATA_LENGTH / sizeof(uint32_t)];
+  simde_float32 f32[SIMDE_BENCH_DATA_LENGTH / sizeof(simde_float32)];
+  simde_float64 f64[SIMDE_BENCH_DATA_LENGTH / sizeof(simde_float64)];
+} simde_bench_out;
+
+static void
+simde_bench_init_data(void) {
+  uint32_t state = UINT32_C(0x2545F491);
+  size_t i;
+
+  for (i = 0 ; i < sizeof(simde_bench_data.u32) / sizeof(simde_bench_data.u32[0]) ; i++) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    simde_bench_data.u32[i] = state;
+  }
+
+  /* Reserve the second half for floating-point values. */
+  for (i = (sizeof(simde_bench_data.f32) / sizeof(simde_bench_data.f32[0])) / 2 ; i < (sizeof(simde_bench_data.f32) / sizeof(simde_bench_data.f32[0])) * 3 / 4 ; i++)
+    simde_bench_data.f32[i] = SIMDE_FLOAT32_C(1.0) + HEDLEY_STATIC_CAST(simde_float32, simde_bench_data.u32[i] >> 8) * SIMDE_FLOAT32_C(5.9604644775390625e-08);
+  for (i = (sizeof(simde_bench_data.f64) / sizeof(simde_bench_data.f64[0])) * 3 / 4 ; i < (sizeof(simde_bench_data.f64) / sizeof(simde_bench_data.f64[0])) ; i++)
+    simde_bench_data.f64[i] = SIMDE_FLOAT64_C(1.0) + HEDLEY_STATIC_CAST(simde_float64, simde_bench_data.u64[i] >> 11) * SIMDE_FLOAT64_C(1.1102230246251565404236316680908203125e-16);
+}
+
+/* Pointers to random data of the requested type, offset by k elements.
+ * At least 1 KiB is available past the pointer for any k < 64. */
+#define SIMDE_BENCH_U8(k)  (&(simde_bench_data.u8[(k)]))
+#define SIMDE_BENCH_I8(k)  (&(simde_bench_data.i8[(k)]))
+#define SIMDE_BENCH_U16(k) (&(simde_bench_data.u16[(k)]))
+#define SIMDE_BENCH_I16(k) (&(simde_bench_data.i16[(k)]))
+#define SIMDE_BENCH_U32(k) (&(simde_bench_data.u32[(k)]))
+#define SIMDE_BENCH_I32(k) (&(simde_bench_data.i32[(k)]))
+#define SIMDE_BENCH_U64(k) (&(simde_bench_data.u64[(k)]))
+#define SIMDE_BENCH_I64(k) (&(simde_bench_data.i64[(k)]))
+#define SIMDE_BENCH_F32(k) (&(simde_bench_data.f32[(sizeof(simde_bench_data.f32) / sizeof(simde_bench_data.f32[0])) / 2 + (k)]))
+#define SIMDE_BENCH_F64(k) (&(simde_bench_data.f64[(sizeof(simde_bench_data.f64) / sizeof(simde_bench_data.f64[0])) * 3 / 4 + (k)]))
+
+/* Return the argument without letting the compiler see its value. */
+static simde_float32 simde_bench_opaque_f32(simde_float32 v) { volatile simde_float32 r = v; return r; }
+static simde_float64 simde_bench_opaque_f64(simde_float64 v) { volatile simde_float64 r = v; return r; }
+static int32_t simde_bench_opaque_i32(int32_t v) { volatile int32_t r = v; return r; }
+static int64_t simde_bench_opaque_i64(int64_t v) { volatile int64_t r = v; return r; }
+
+static volatile uint8_t simde_bench_sink_;
+
+/* Consume a value so the work which produced it can't be discarded. */
+static void
+simde_bench_sink(const void* ptr, size_t len) {
+  const uint8_t* p = HEDLEY_REINTERPRET_CAST(const uint8_t*, ptr);
+  uint8_t r = 0;
+  size_t i;
+
+  for (i = 0 ; i < len ; i++)
+    r ^= p[i];
+
+  simde_bench_sink_ = r;
+}
+
+/* Benchmark context */
+
+typedef struct {
+  int dependent;
+  size_t iterations;
+
+  size_t ops;
+  uint64_t ns;
+  uint64_t cycles;
+} simde_bench_ctx;
+
+#define SIMDE_BENCH_START_(ctx) \
+  uint64_t simde_bench_ns_ = simde_bench_now_ns(); \
+  uint64_t simde_bench_cycles_ = simde_bench_cycles()
+
+#define SIMDE_BENCH_STOP_(ctx, n) \
+  (ctx)->cycles = simde_bench_cycles() - simde_bench_cycles_; \
+  (ctx)->ns = simde_bench_now_ns() - simde_bench_ns_; \
+  (ctx)->ops = (n)
+
+#define SIMDE_BENCH_CHAIN_INIT_(T, c, init) \
+  T a##c; \
+  { \
+    const size_t k = (c) * 8; \
+    (void) k; \
+    a##c = (init); \
+  }
+
+#define SIMDE_BENCH_CHAIN_STEP_(T, c, expr) \
+  { \
+    const size_t k = ((simde_bench_i_ << 3) + (c)) & 63; \
+    const T a = a##c; \
+    (void) k; \
+    a##c = (expr); \
+  }
+
+#define SIMDE_BENCH_LOOP(ctx, T, init, expr) \
+  do { \
+    size_t simde_bench_i_; \
+    if ((ctx)->dependent) { \
+      SIMDE_BENCH_CHAIN_INIT_(T, 0, init) \
+      { \
+        SIMDE_BENCH_START_(ctx); \
+        for (simde_bench_i_ = 0 ; simde_bench_i_ < (ctx)->iterations ; simde_bench_i_++) { \
+          const size_t k = simde_bench_i_ & 63; \
+          const T a = a0; \
+          (void) k; \
+          a0 = (expr); \
+        } \
+        SIMDE_BENCH_STOP_(ctx, (ctx)->iterations); \
+      } \
+      simde_bench_sink(&a0, sizeof(a0)); \
+    } else { \
+      SIMDE_BENCH_CHAIN_INIT_(T, 0, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 1, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 2, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 3, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 4, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 5, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 6, init) \
+      SIMDE_BENCH_CHAIN_INIT_(T, 7, init) \
+      { \
+        SIMDE_BENCH_START_(ctx); \
+        for (simde_bench_i_ = 0 ; simde_bench_i_ < (ctx)->iterations ; simde_bench_i_++) { \
+          SIMDE_BENCH_CHAIN_STEP_(T, 0, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 1, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 2, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 3, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 4, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 5, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 6, expr) \
+          SIMDE_BENCH_CHAIN_STEP_(T, 7, expr) \
+        } \
+        SIMDE_BENCH_STOP_(ctx, (ctx)->iterations * 8); \
+      } \
+      simde_bench_sink(&a0, sizeof(a0)); \
+      simde_bench_sink(&a1, sizeof(a1)); \
+      simde_bench_sink(&a2, sizeof(a2)); \
+      simde_bench_sink(&a3, sizeof(a3)); \
+      simde_bench_sink(&a4, sizeof(a4)); \
+      simde_bench_sink(&a5, sizeof(a5)); \
+      simde_bench_sink(&a6, sizeof(a6)); \
+      simde_bench_sink(&a7, sizeof(a7)); \
+    } \
+  } while (0)
+
+typedef struct {
+  void (* func)(simde_bench_ctx* ctx);
+  const char* name;
+} simde_bench_entry;
+
+#define SIMDE_BENCH_FUNC_LIST_BEGIN static const simde_bench_entry bench_suite_benchmarks[] = {
+#define SIMDE_BENCH_FUNC_LIST_ENTRY(name) { bench_simde_##name, "simde_" #name },
+#define SIMDE_BENCH_FUNC_LIST_END };
+
+/* Runner */
+
+typedef struct {
+  double ns_per_op;
+  double cycles_per_op;
+} simde_bench_result;
+
+/* Grow the iteration count until a run takes at least min_ns, then
+ * keep the fastest of `repetitions` runs. */
+static simde_bench_result
+simde_bench_measure(void (* func)(simde_bench_ctx* ctx), int dependent, uint64_t min_ns, int repetitions) {
+  simde_bench_ctx ctx;
+  simde_bench_result r;
+  double best_ns = 0.0, best_cycles = 0.0;
+  int rep;
+
+  ctx.dependent = dependent;
+  ctx.iterations = 64;
+  for (;;) {
+    func(&ctx);
+    if (ctx.ns >= min_ns || ctx.iterations >= (SIZE_MAX / 16))
+      break;
+    if (ctx.ns < (min_ns / 64))
+      ctx.iterations *= 16;
+    else
+      ctx.iterations *= 2;
+  }
+
+  for (rep = 0 ; rep < repetitions ; rep++) {
+    const double ns = HEDLEY_STATIC_CAST(double, ctx.ns) / HEDLEY_STATIC_CAST(double, ctx.ops);
+    const double cycles = HEDLEY_STATIC_CAST(double, ctx.cycles) / HEDLEY_STATIC_CAST(double, ctx.ops);
+    if (rep == 0 || ns < best_ns) {
+      best_ns = ns;
+      best_cycles = cycles;
+    }
+    func(&ctx);
+  }
+
+  r.ns_per_op = best_ns;
+  r.cycles_per_op = best_cycles;
+  return r;
+}
+
+static void
+simde_bench_print_json_string(const char* str) {
+  putchar('"');
+  for ( ; *str != '\0' ; str++) {
+    if (*str == '"' || *str == '\\')
+      printf("\\%c", *str);
+    else if (HEDLEY_STATIC_CAST(unsigned char, *str) < 0x20)
+      printf("\\u%04x", HEDLEY_STATIC_CAST(unsigned int, HEDLEY_STATIC_CAST(unsigned char, *str)));
+    else
+      putchar(*str);
+  }
+  putchar('"');
+}
+
+static void
+simde_bench_print_json_number(double v) {
+  #if defined(SIMDE_BENCH_CYCLE_COUNTER)
+    printf("%.4f", v);
+  #else
+    (void) v;
+    printf("null");
+  #endif
+}
+
+static void
+simde_bench_usage(const char* argv0) {
+  fprintf(stderr,
+    "Usage: %s [OPTION]... [FILTER]...\n"
+    "Run the benchmarks whose name contains one of the FILTERs (all by default).\n\n"
+    "  --json          emit results as JSON\n"
+    "  --latency       only run the dependent (latency) loops\n"
+    "  --throughput    only run the independent (throughput) loops\n"
+    "  --min-time MS   minimum duration of a single run (default 20)\n"
+    "  --repeat N      number of timed runs; the fastest is reported (default 5)\n"
+    "  --output FILE   write results to FILE instead of standard output\n"
+    "  --list          list available benchmarks\n",
+    argv0);
+}
+
+static int
+simde_bench_main(const char* suite, int argc, char* argv[], size_t count, const simde_bench_entry benchmarks[HEDLEY_ARRAY_PARAM(count)]) {
+  int json = 0, latency = 1, throughput = 1, repetitions = 5, first = 1, argi;
+  uint64_t min_ns = UINT64_C(20000000);
+  size_t i, filters = 0;
+
+  for (argi = 1 ; argi < argc ; argi++) {
+    if (strcmp(argv[argi], "--json") == 0) {
+      json = 1;
+    } else if (strcmp(argv[argi], "--latency") == 0) {
+      throughput = 0;
+    } else if (strcmp(argv[argi], "--throughput") == 0) {
+      latency = 0;
+    } else if (strcmp(argv[argi], "--min-time") == 0 && (argi + 1) < argc) {
+      min_ns = HEDLEY_STATIC_CAST(uint64_t, strtoul(argv[++argi], NULL, 10)) * UINT64_C(1000000);
+    } else if (strcmp(argv[argi], "--repeat") == 0 && (argi + 1) < argc) {
+      repetitions = atoi(argv[++argi]);
+      if (repetitions < 1)
+        repetitions = 1;
+    } else if (strcmp(argv[argi], "--output") == 0 && (argi + 1) < argc) {
+      if (freopen(argv[++argi], "w", stdout) == NULL) {
+        perror(argv[argi]);
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[argi], "--list") == 0) {
+      for (i = 0 ; i < count ; i++)
+        printf("%s\n", benchmarks[i].name);
+      return EXIT_SUCCESS;
+    } else if (argv[argi][0] == '-') {
+      simde_bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    } else {
+      filters++;
+    }
+  }
+
+  simde_bench_init_data();
+
+  if (json) {
+    printf("{\n  \"suite\": ");
+    simde_bench_print_json_string(suite);
+    printf(",\n  \"config\": {\n    \"variant\": ");
+    simde_bench_print_json_string(SIMDE_BENCH_CONFIG);
+    printf(",\n    \"language\": ");
+    simde_bench_print_json_string(SIMDE_BENCH_LANGUAGE);
+    printf(",\n    \"compiler\": ");
+    simde_bench_print_json_string(SIMDE_BENCH_COMPILER);
+    printf(",\n    \"native\": ");
+    simde_bench_print_json_string(simde_bench_native_isa[0] == ' ' ? simde_bench_native_isa + 1 : simde_bench_native_isa);
+    printf(",\n    \"natural_vector_size\": %d", HEDLEY_STATIC_CAST(int, SIMDE_NATURAL_VECTOR_SIZE));
+    printf(",\n    \"accuracy_preference\": %d", HEDLEY_STATIC_CAST(int, SIMDE_ACCURACY_PREFERENCE));
+    printf(",\n    \"cycle_counter\": ");
+    #if defined(SIMDE_BENCH_CYCLE_COUNTER)
+      simde_bench_print_json_string(SIMDE_BENCH_CYCLE_COUNTER);
+    #else
+      printf("null");
+    #endif
+    printf("\n  },\n  \"benchmarks\": [");
+  } else {
+    printf("# %s (%s, %s), native:%s\n", suite, SIMDE_BENCH_CONFIG, SIMDE_BENCH_COMPILER, simde_bench_native_isa[0] ? simde_bench_native_isa : " none");
+    printf("%-36s %12s %12s %12s %12s\n", "name", "lat ns/op", "lat cyc/op", "tput ns/op", "tput cyc/op");
+  }
+
+  for (i = 0 ; i < count ; i++) {
+    const char* name = benchmarks[i].name;
+    simde_bench_result lat = { 0.0, 0.0 }, tput = { 0.0, 0.0 };
+
+    if (filters > 0) {
+      int matched = 0;
+      for (argi = 1 ; argi < argc && !matched ; argi++) {
+        if (argv[argi][0] == '-') {
+          if (strcmp(argv[argi], "--min-time") == 0 || strcmp(argv[argi], "--repeat") == 0 || strcmp(argv[argi], "--output") == 0)
+            argi++;
+          continue;
+        }
+        matched = strstr(name, argv[argi]) != NULL;
+      }
+      if (!matched)
+        continue;
+    }
+
+    if (latency)
+      lat = simde_bench_measure(benchmarks[i].func, 1, min_ns, repetitions);
+    if (throughput)
+      tput = simde_bench_measure(benchmarks[i].func, 0, min_ns, repetitions);
+
+    if (json) {
+      printf("%s\n    { \"name\": ", first ? "" : ",");
+      simde_bench_print_json_string(name);
+      if (latency) {
+        printf(", \"latency_ns\": %.4f, \"latency_cycles\": ", lat.ns_per_op);
+        simde_bench_print_json_number(lat.cycles_per_op);
+      }
+      if (throughput) {
+        printf(", \"throughput_ns\": %.4f, \"throughput_cycles\": ", tput.ns_per_op);
+        simde_bench_print_json_number(tput.cycles_per_op);
+      }
+      printf(" }");
+    } else {
+      printf("%-36s %12.3f %12.2f %12.3f %12.2f\n", name, lat.ns_per_op, lat.cycles_per_op, tput.ns_per_op, tput.cycles_per_op);
+    }
+    fflush(stdout);
+    first = 0;
+  }
+
+  if (json)
+    printf("\n  ]\n}\n");
+
+  return EXIT_SUCCESS;
+}
+
+#define SIMDE_BENCH_MAIN(suite_name) \
+  int main(int argc, char* argv[]) { \
+    return simde_bench_main(suite_name, argc, argv, \
+      sizeof(bench_suite_benchmarks) / sizeof(bench_suite_benchmarks[0]), \
+      bench_suite_benchmarks); \
+  }
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_BENCH_H) */
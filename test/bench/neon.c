@@ -0,0 +1,389 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <test/bench/bench.h>
+#include <simde/arm/neon.h>
+
+/* Fold every register of a multi-vector load into one so none of the
+ * loaded data is dead. */
+static simde_uint8x16_t
+bench_fold_u8x16x2(simde_uint8x16x2_t v) {
+  return simde_veorq_u8(v.val[0], v.val[1]);
+}
+
+static simde_uint8x16_t
+bench_fold_u8x16x3(simde_uint8x16x3_t v) {
+  return simde_veorq_u8(simde_veorq_u8(v.val[0], v.val[1]), v.val[2]);
+}
+
+static simde_uint8x16_t
+bench_fold_u8x16x4(simde_uint8x16x4_t v) {
+  return simde_veorq_u8(simde_veorq_u8(v.val[0], v.val[1]), simde_veorq_u8(v.val[2], v.val[3]));
+}
+
+static simde_float32x4_t
+bench_fold_f32x4x2(simde_float32x4x2_t v) {
+  return simde_vaddq_f32(v.val[0], v.val[1]);
+}
+
+static simde_float32x4_t
+bench_fold_f32x4x3(simde_float32x4x3_t v) {
+  return simde_vaddq_f32(simde_vaddq_f32(v.val[0], v.val[1]), v.val[2]);
+}
+
+static simde_float32x4_t
+bench_fold_f32x4x4(simde_float32x4x4_t v) {
+  return simde_vaddq_f32(simde_vaddq_f32(v.val[0], v.val[1]), simde_vaddq_f32(v.val[2], v.val[3]));
+}
+
+static void
+bench_simde_vaddq_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4_t b = simde_vld1q_f32(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vaddq_f32(a, b));
+}
+
+static void
+bench_simde_vcvt_f32_f16(simde_bench_ctx* ctx) {
+  /* Round trip, so this includes a vcvt_f16_f32. */
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vcvt_f32_f16(simde_vcvt_f16_f32(a)));
+}
+
+static void
+bench_simde_vmulq_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4_t b = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vmulq_f32(a, b));
+}
+
+static void
+bench_simde_vmlaq_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4_t b = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  const simde_float32x4_t c = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(0.0)));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vmlaq_f32(a, b, c));
+}
+
+static void
+bench_simde_vfmaq_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4_t b = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  const simde_float32x4_t c = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(0.0)));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vfmaq_f32(a, b, c));
+}
+
+static void
+bench_simde_vfmaq_laneq_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4_t b = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  const simde_float32x4_t v = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(0.0)));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vfmaq_laneq_f32(a, b, v, 3));
+}
+
+/* Estimate-and-refine versus division: one over a, with the two
+ * Newton-Raphson steps needed to get close to full precision. */
+static simde_float32x4_t
+bench_recip_f32x4(simde_float32x4_t a) {
+  simde_float32x4_t r = simde_vrecpeq_f32(a);
+  r = simde_vmulq_f32(r, simde_vrecpsq_f32(a, r));
+  return simde_vmulq_f32(r, simde_vrecpsq_f32(a, r));
+}
+
+static simde_float32x4_t
+bench_rsqrt_f32x4(simde_float32x4_t a) {
+  simde_float32x4_t r = simde_vrsqrteq_f32(a);
+  r = simde_vmulq_f32(r, simde_vrsqrtsq_f32(simde_vmulq_f32(a, r), r));
+  return simde_vmulq_f32(r, simde_vrsqrtsq_f32(simde_vmulq_f32(a, r), r));
+}
+
+static void
+bench_simde_vdivq_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4_t one = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vdivq_f32(one, a));
+}
+
+static void
+bench_simde_vrecpeq_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vrecpeq_f32(a));
+}
+
+static void
+bench_simde_vrecpsq_f32(simde_bench_ctx* ctx) {
+  /* vrecpeq_f32 plus two vrecpsq_f32 steps. */
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), bench_recip_f32x4(a));
+}
+
+static void
+bench_simde_vsqrtq_f32(simde_bench_ctx* ctx) {
+  /* Includes a vdivq_f32, for comparison with the vrsqrte sequence. */
+  const simde_float32x4_t one = simde_vdupq_n_f32(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vdivq_f32(one, simde_vsqrtq_f32(a)));
+}
+
+static void
+bench_simde_vrsqrtsq_f32(simde_bench_ctx* ctx) {
+  /* vrsqrteq_f32 plus two vrsqrtsq_f32 steps. */
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), bench_rsqrt_f32x4(a));
+}
+
+static void
+bench_simde_vrndnq_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vrndnq_f32(a));
+}
+
+static void
+bench_simde_vcvtq_s32_f32(simde_bench_ctx* ctx) {
+  /* Round trip, so this includes a vcvtq_f32_s32. */
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vcvtq_f32_s32(simde_vcvtq_s32_f32(a)));
+}
+
+static void
+bench_simde_vcvtq_u32_f32(simde_bench_ctx* ctx) {
+  /* Round trip, so this includes a vcvtq_f32_u32. */
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vcvtq_f32_u32(simde_vcvtq_u32_f32(a)));
+}
+
+static void
+bench_simde_vcvtnq_s32_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vcvtq_f32_s32(simde_vcvtnq_s32_f32(a)));
+}
+
+static void
+bench_simde_vcvtaq_s32_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vcvtq_f32_s32(simde_vcvtaq_s32_f32(a)));
+}
+
+static void
+bench_simde_vmaxvq_f32(simde_bench_ctx* ctx) {
+  /* The result is broadcast back into a vector, so this includes a
+   * vdupq_n_f32. */
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vdupq_n_f32(simde_vmaxvq_f32(a)));
+}
+
+static void
+bench_simde_vqaddq_s16(simde_bench_ctx* ctx) {
+  const simde_int16x8_t b = simde_vld1q_s16(SIMDE_BENCH_I16(64));
+  SIMDE_BENCH_LOOP(ctx, simde_int16x8_t, simde_vld1q_s16(SIMDE_BENCH_I16(k)), simde_vqaddq_s16(a, b));
+}
+
+static void
+bench_simde_vqrdmulhq_s16(simde_bench_ctx* ctx) {
+  const simde_int16x8_t b = simde_vld1q_s16(SIMDE_BENCH_I16(64));
+  SIMDE_BENCH_LOOP(ctx, simde_int16x8_t, simde_vld1q_s16(SIMDE_BENCH_I16(k)), simde_vqrdmulhq_s16(a, b));
+}
+
+static void
+bench_simde_vmull_s16(simde_bench_ctx* ctx) {
+  /* Includes a vmovn_s32 to feed the result back. */
+  const simde_int16x4_t b = simde_vld1_s16(SIMDE_BENCH_I16(64));
+  SIMDE_BENCH_LOOP(ctx, simde_int16x4_t, simde_vld1_s16(SIMDE_BENCH_I16(k)), simde_vmovn_s32(simde_vmull_s16(a, b)));
+}
+
+static void
+bench_simde_vshlq_s32(simde_bench_ctx* ctx) {
+  const simde_int32x4_t b = simde_vandq_s32(simde_vld1q_s32(SIMDE_BENCH_I32(64)), simde_vdupq_n_s32(simde_bench_opaque_i32(7)));
+  SIMDE_BENCH_LOOP(ctx, simde_int32x4_t, simde_vld1q_s32(SIMDE_BENCH_I32(k)), simde_vshlq_s32(a, b));
+}
+
+static void
+bench_simde_vqrshrn_n_s32(simde_bench_ctx* ctx) {
+  /* Includes a vmovl_s16 to feed the result back. */
+  SIMDE_BENCH_LOOP(ctx, simde_int32x4_t, simde_vld1q_s32(SIMDE_BENCH_I32(k)), simde_vmovl_s16(simde_vqrshrn_n_s32(a, 12)));
+}
+
+static void
+bench_simde_vqrshrun_n_s16(simde_bench_ctx* ctx) {
+  /* Includes a vmovl_u8 to feed the result back. */
+  SIMDE_BENCH_LOOP(ctx, simde_int16x8_t, simde_vld1q_s16(SIMDE_BENCH_I16(k)), simde_vreinterpretq_s16_u16(simde_vmovl_u8(simde_vqrshrun_n_s16(a, 4))));
+}
+
+static void
+bench_simde_vsliq_n_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16_t b = simde_vld1q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vsliq_n_u8(a, b, 3));
+}
+
+static void
+bench_simde_vabdq_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16_t b = simde_vld1q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vabdq_u8(a, b));
+}
+
+static void
+bench_simde_vpaddq_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16_t b = simde_vld1q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vpaddq_u8(a, b));
+}
+
+static void
+bench_simde_vcntq_u8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vcntq_u8(a));
+}
+
+static void
+bench_simde_vaddlvq_u8(simde_bench_ctx* ctx) {
+  /* Includes a vdupq_n_u8 to feed the result back. */
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vdupq_n_u8(HEDLEY_STATIC_CAST(uint8_t, simde_vaddlvq_u8(a))));
+}
+
+static void
+bench_simde_vzip1q_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16_t b = simde_vld1q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vzip1q_u8(a, b));
+}
+
+static void
+bench_simde_vqtbl1q_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16_t t = simde_vld1q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vandq_u8(simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_vdupq_n_u8(15)), simde_vqtbl1q_u8(t, a));
+}
+
+/* Structure loads and stores.  Loads are xor-ed (or added) into the
+ * chain, so latency is that of the combining operations; throughput is
+ * the interesting number. */
+
+static void
+bench_simde_vld2q_u8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_veorq_u8(a, bench_fold_u8x16x2(simde_vld2q_u8(SIMDE_BENCH_U8(k)))));
+}
+
+static void
+bench_simde_vld3q_u8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_veorq_u8(a, bench_fold_u8x16x3(simde_vld3q_u8(SIMDE_BENCH_U8(k)))));
+}
+
+static void
+bench_simde_vld4q_u8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_veorq_u8(a, bench_fold_u8x16x4(simde_vld4q_u8(SIMDE_BENCH_U8(k)))));
+}
+
+static void
+bench_simde_vld2q_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vaddq_f32(a, bench_fold_f32x4x2(simde_vld2q_f32(SIMDE_BENCH_F32(k)))));
+}
+
+static void
+bench_simde_vld3q_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vaddq_f32(a, bench_fold_f32x4x3(simde_vld3q_f32(SIMDE_BENCH_F32(k)))));
+}
+
+static void
+bench_simde_vld4q_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vaddq_f32(a, bench_fold_f32x4x4(simde_vld4q_f32(SIMDE_BENCH_F32(k)))));
+}
+
+static void
+bench_simde_vld1q_u8_x4(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)), simde_veorq_u8(a, bench_fold_u8x16x4(simde_vld1q_u8_x4(SIMDE_BENCH_U8(k)))));
+}
+
+static void
+bench_simde_vld1q_dup_f32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)), simde_vaddq_f32(a, simde_vld1q_dup_f32(SIMDE_BENCH_F32(k))));
+}
+
+static void
+bench_simde_vst2q_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16x2_t v = simde_vld2q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)),
+    (simde_vst2q_u8(&(simde_bench_out.u8[k * 32]), v), a));
+}
+
+static void
+bench_simde_vst3q_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16x3_t v = simde_vld3q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)),
+    (simde_vst3q_u8(&(simde_bench_out.u8[k * 48]), v), a));
+}
+
+static void
+bench_simde_vst4q_u8(simde_bench_ctx* ctx) {
+  const simde_uint8x16x4_t v = simde_vld4q_u8(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde_uint8x16_t, simde_vld1q_u8(SIMDE_BENCH_U8(k)),
+    (simde_vst4q_u8(&(simde_bench_out.u8[k * 64]), v), a));
+}
+
+static void
+bench_simde_vst2q_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4x2_t v = simde_vld2q_f32(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)),
+    (simde_vst2q_f32(&(simde_bench_out.f32[k * 8]), v), a));
+}
+
+static void
+bench_simde_vst3q_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4x3_t v = simde_vld3q_f32(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)),
+    (simde_vst3q_f32(&(simde_bench_out.f32[k * 12]), v), a));
+}
+
+static void
+bench_simde_vst4q_f32(simde_bench_ctx* ctx) {
+  const simde_float32x4x4_t v = simde_vld4q_f32(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde_float32x4_t, simde_vld1q_f32(SIMDE_BENCH_F32(k)),
+    (simde_vst4q_f32(&(simde_bench_out.f32[k * 16]), v), a));
+}
+
+SIMDE_BENCH_FUNC_LIST_BEGIN
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vaddq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vcvt_f32_f16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vmulq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vmlaq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vfmaq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vfmaq_laneq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vdivq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vrecpeq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vrecpsq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vsqrtq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vrsqrtsq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vrndnq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vcvtq_s32_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vcvtq_u32_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vcvtnq_s32_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vcvtaq_s32_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vmaxvq_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vqaddq_s16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vqrdmulhq_s16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vmull_s16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vshlq_s32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vqrshrn_n_s32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vqrshrun_n_s16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vsliq_n_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vabdq_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vpaddq_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vcntq_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vaddlvq_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vzip1q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vqtbl1q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld1q_u8_x4)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld1q_dup_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld2q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld3q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld4q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld2q_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld3q_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vld4q_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vst2q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vst3q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vst4q_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vst2q_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vst3q_f32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(vst4q_f32)
+SIMDE_BENCH_FUNC_LIST_END
+
+SIMDE_BENCH_MAIN("arm/neon")
@@ -0,0 +1,1165 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <test/bench/bench.h>
+#include <simde/x86/sse4.2.h>
+#include <simde/x86/clmul.h>
+#include <simde/x86/aes.h>
+#include <simde/x86/sha.h>
+#include <simde/x86/fma.h>
+#include <simde/x86/svml.h>
+#include <simde/x86/f16c.h>
+#include <simde/x86/bmi2.h>
+#include <simde/x86/avx512/loadu.h>
+#include <simde/x86/avx512/add.h>
+#include <simde/x86/avx512/2intersect.h>
+#include <simde/x86/avx512/compress.h>
+#include <simde/x86/avx512/conflict.h>
+#include <simde/x86/avx512/expand.h>
+#include <simde/x86/avx512/popcnt.h>
+#include <simde/x86/avx512/dpbusd.h>
+#include <simde/x86/avx512/dpwssds.h>
+#include <simde/x86/avx512/ternarylogic.h>
+#include <simde/x86/avx512/gather.h>
+#include <simde/x86/avx512/scatter.h>
+#include <simde/x86/avx512/reduce.h>
+#include <simde/x86/avx512/mul.h>
+#include <simde/x86/avx512/and.h>
+#include <simde/x86/avx512/xor.h>
+#include <simde/x86/avx512/set1.h>
+#include <simde/x86/avx512/srli.h>
+#include <simde/x86/avx512/multishift.h>
+#include <simde/x86/avx512/shldv.h>
+#include <simde/x86/avx512/shrdv.h>
+#include <simde/x86/avx512/shldi.h>
+
+/* Floating-point inputs are in [1, 2).  Where a function would drift
+ * out of a reasonable range when fed its own output, the chain goes
+ * through one cheap extra operation (noted below) to keep it bounded. */
+
+static void
+bench_simde_mm_add_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_add_ps(a, b));
+}
+
+static void
+bench_simde_mm_mul_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_mul_ps(a, b));
+}
+
+static void
+bench_simde_mm_div_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_div_ps(a, b));
+}
+
+static void
+bench_simde_mm_sqrt_ps(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_sqrt_ps(a));
+}
+
+static void
+bench_simde_mm_rcp_ps(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_rcp_ps(a));
+}
+
+static void
+bench_simde_mm_min_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_min_ps(a, b));
+}
+
+static void
+bench_simde_mm_shuffle_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_shuffle_ps(a, b, SIMDE_MM_SHUFFLE(0, 1, 2, 3)));
+}
+
+static void
+bench_simde_mm_add_epi32(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_add_epi32(a, b));
+}
+
+static void
+bench_simde_mm_mullo_epi16(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_mullo_epi16(a, b));
+}
+
+static void
+bench_simde_mm_madd_epi16(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_madd_epi16(a, b));
+}
+
+static void
+bench_simde_mm_sad_epu8(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_sad_epu8(a, b));
+}
+
+static void
+bench_simde_mm_packs_epi32(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_packs_epi32(a, b));
+}
+
+static void
+bench_simde_mm_movemask_epi8(simde_bench_ctx* ctx) {
+  /* The mask is fed back into the next input, so this includes a
+   * cvtsi32_si128 and an add. */
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, int32_t, simde_bench_opaque_i32(0), simde_mm_movemask_epi8(simde_mm_add_epi8(b, simde_mm_cvtsi32_si128(a))));
+}
+
+static void
+bench_simde_mm_maskmoveu_si128(simde_bench_ctx* ctx) {
+  /* Stores don't form a dependency chain; only throughput is meaningful. */
+  const simde__m128i m = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))),
+    (simde_mm_maskmoveu_si128(a, m, HEDLEY_REINTERPRET_CAST(int8_t*, &(simde_bench_out.u8[k * 16]))), a));
+}
+
+static void
+bench_simde_mm_cvtps_epi32(simde_bench_ctx* ctx) {
+  /* Round trip, so this includes a cvtepi32_ps. */
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_cvtepi32_ps(simde_mm_cvtps_epi32(a)));
+}
+
+static void
+bench_simde_mm_shuffle_epi8(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_shuffle_epi8(a, b));
+}
+
+static void
+bench_simde_mm_maddubs_epi16(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_maddubs_epi16(a, b));
+}
+
+static void
+bench_simde_mm_hadd_epi16(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_hadd_epi16(a, b));
+}
+
+static void
+bench_simde_mm_blendv_epi8(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  const simde__m128i m = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(128)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_blendv_epi8(a, b, m));
+}
+
+static void
+bench_simde_mm_mullo_epi32(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_mullo_epi32(a, b));
+}
+
+static void
+bench_simde_mm_dp_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(0.25)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_dp_ps(a, b, 0xff));
+}
+
+static void
+bench_simde_mm_round_ps(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_round_ps(a, SIMDE_MM_FROUND_TO_NEAREST_INT));
+}
+
+static void
+bench_simde_mm_minpos_epu16(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_minpos_epu16(a));
+}
+
+static void
+bench_simde_mm_cmpgt_epi64(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_cmpgt_epi64(a, b));
+}
+
+/* Text scanning: walk a 1 KiB JSON document 16 bytes at a time the
+ * way a tokenizer does, stopping at every structural character
+ * (explicit lengths) or at every character which can't be part of a
+ * number (implicit lengths).  One operation is a full pass over the
+ * document, so the cost depends on how many matches there are; both
+ * documents are the same for every variant. */
+
+static char bench_json_[1024 + 32];
+
+static void
+bench_json_init_(void) {
+  static const char doc[] =
+    "{\"id\": 12345, \"name\": \"simde\", \"tags\": [\"sse\", \"neon\"], "
+    "\"ratio\": -0.125e3, \"ok\": true, \"nested\": {\"x\": [1, 2, 3]}}\n";
+  for (size_t i = 0 ; i < sizeof(bench_json_) ; i++)
+    bench_json_[i] = doc[i % (sizeof(doc) - 1)];
+}
+
+static int
+bench_json_structural_(size_t start) {
+  const simde__m128i set = simde_mm_setr_epi8('{', '}', '[', ']', ':', ',', '"', '\\', 0, 0, 0, 0, 0, 0, 0, 0);
+  int count = 0;
+  size_t i = start;
+
+  while (i < start + 1024) {
+    const simde__m128i text = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(bench_json_[i])));
+    const int r = simde_mm_cmpestri(set, 8, text, 16, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT);
+    count += (r != 16);
+    i += HEDLEY_STATIC_CAST(size_t, r) + (r != 16);
+  }
+
+  return count;
+}
+
+static int
+bench_json_numbers_(size_t start) {
+  const simde__m128i ranges = simde_mm_setr_epi8('0', '9', '-', '.', 'e', 'e', 'E', 'E', 0, 0, 0, 0, 0, 0, 0, 0);
+  int count = 0;
+  size_t i = start;
+
+  while (i < start + 1024) {
+    const simde__m128i text = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(bench_json_[i])));
+    const int r = simde_mm_cmpistri(ranges, text, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT);
+    count += (r != 16);
+    i += HEDLEY_STATIC_CAST(size_t, r) + (r != 16);
+  }
+
+  return count;
+}
+
+static void
+bench_simde_mm_cmpestri(simde_bench_ctx* ctx) {
+  bench_json_init_();
+  SIMDE_BENCH_LOOP(ctx, int, 0, a + bench_json_structural_(HEDLEY_STATIC_CAST(size_t, a) & 15));
+}
+
+static void
+bench_simde_mm_cmpistri(simde_bench_ctx* ctx) {
+  bench_json_init_();
+  SIMDE_BENCH_LOOP(ctx, int, 0, a + bench_json_numbers_(HEDLEY_STATIC_CAST(size_t, a) & 15));
+}
+
+static void
+bench_simde_mm_crc32_u8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint32_t, SIMDE_BENCH_U32(k)[0], simde_mm_crc32_u8(a, SIMDE_BENCH_U8(k)[0]));
+}
+
+static void
+bench_simde_mm_crc32_u32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint32_t, SIMDE_BENCH_U32(k)[0], simde_mm_crc32_u32(a, SIMDE_BENCH_U32(k)[0]));
+}
+
+static void
+bench_simde_mm_crc32_u64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, SIMDE_BENCH_U64(k)[0], simde_mm_crc32_u64(a, SIMDE_BENCH_U64(k)[0]));
+}
+
+static void
+bench_simde_x_crc32c_buffer(simde_bench_ctx* ctx) {
+  /* One operation is a 1 KiB buffer. */
+  SIMDE_BENCH_LOOP(ctx, uint32_t, SIMDE_BENCH_U32(k)[0], simde_x_crc32c_buffer(a, SIMDE_BENCH_U8(k), 1024));
+}
+
+static void
+bench_simde_mm_clmulepi64_si128(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_clmulepi64_si128(a, b, 0x01));
+}
+
+/* GHASH (the GCM authenticator) over a 1 KiB buffer: four carry-less
+ * multiplies per block plus the reduction modulo
+ * x^128 + x^7 + x^2 + x + 1, in the bit-reflected domain.  Each block
+ * depends on the previous one, so this measures latency even in the
+ * throughput variant. */
+static simde__m128i
+bench_ghash_(simde__m128i y, simde__m128i h, const uint8_t* data, size_t len) {
+  const simde__m128i poly = simde_x_mm_set_epu64x(UINT64_C(0xc200000000000000), 0);
+  simde__m128i lo, mid, hi, t;
+
+  for ( ; len >= 16 ; data += 16, len -= 16) {
+    y = simde_mm_xor_si128(y, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, data)));
+
+    lo  = simde_mm_clmulepi64_si128(y, h, 0x00);
+    hi  = simde_mm_clmulepi64_si128(y, h, 0x11);
+    mid = simde_mm_xor_si128(simde_mm_clmulepi64_si128(y, h, 0x01), simde_mm_clmulepi64_si128(y, h, 0x10));
+    lo  = simde_mm_xor_si128(lo, simde_mm_slli_si128(mid, 8));
+    hi  = simde_mm_xor_si128(hi, simde_mm_srli_si128(mid, 8));
+
+    t  = simde_mm_clmulepi64_si128(lo, poly, 0x10);
+    lo = simde_mm_xor_si128(simde_mm_shuffle_epi32(lo, 0x4e), t);
+    t  = simde_mm_clmulepi64_si128(lo, poly, 0x10);
+    lo = simde_mm_xor_si128(simde_mm_shuffle_epi32(lo, 0x4e), t);
+    y  = simde_mm_xor_si128(hi, lo);
+  }
+
+  return y;
+}
+
+static void
+bench_simde_x_ghash(simde_bench_ctx* ctx) {
+  /* One operation is a 1 KiB buffer. */
+  const simde__m128i h = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), bench_ghash_(a, h, SIMDE_BENCH_U8(k), 1024));
+}
+
+static void
+bench_simde_mm256_clmulepi64_epi128(simde_bench_ctx* ctx) {
+  const simde__m256i b = simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(k))), simde_mm256_clmulepi64_epi128(a, b, 0x01));
+}
+
+static void
+bench_simde_mm_aesenc_si128(simde_bench_ctx* ctx) {
+  const simde__m128i round_key = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_aesenc_si128(a, round_key));
+}
+
+static void
+bench_simde_mm_aesdec_si128(simde_bench_ctx* ctx) {
+  const simde__m128i round_key = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_aesdec_si128(a, round_key));
+}
+
+static void
+bench_simde_mm512_aesenc_epi128(simde_bench_ctx* ctx) {
+  /* One operation is four blocks. */
+  const simde__m512i round_key = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_aesenc_epi128(a, round_key));
+}
+
+static const uint32_t bench_sha256_k_[64] = {
+  UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5),
+  UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
+  UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3),
+  UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
+  UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc),
+  UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
+  UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7),
+  UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
+  UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13),
+  UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
+  UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3),
+  UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
+  UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5),
+  UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
+  UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208),
+  UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2)
+};
+
+/* SHA-256 compression, written the way SHA-NI code usually is: the
+ * state is kept as ABEF/CDGH and each group of four rounds expands
+ * the next four message words with msg1/msg2.  The blocks are chained,
+ * so this measures latency even in the throughput variant. */
+static simde__m128i
+bench_sha256_(simde__m128i abef, const uint8_t* data, size_t len) {
+  const simde__m128i bswap = simde_x_mm_set_epu64x(UINT64_C(0x0c0d0e0f08090a0b), UINT64_C(0x0405060700010203));
+  simde__m128i cdgh = simde_mm_shuffle_epi32(abef, 0x1b);
+
+  for ( ; len >= 64 ; data += 64, len -= 64) {
+    const simde__m128i abef_save = abef, cdgh_save = cdgh;
+    simde__m128i w[4], wk;
+
+    for (size_t i = 0 ; i < 16 ; i++) {
+      if (i < 4) {
+        w[i] = simde_mm_shuffle_epi8(simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, data + (i * 16))), bswap);
+      } else {
+        w[i & 3] = simde_mm_sha256msg2_epu32(
+          simde_mm_add_epi32(
+            simde_mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]),
+            simde_mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4)),
+          w[(i + 3) & 3]);
+      }
+
+      wk = simde_mm_add_epi32(w[i & 3], simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(bench_sha256_k_[i * 4]))));
+      cdgh = simde_mm_sha256rnds2_epu32(cdgh, abef, wk);
+      abef = simde_mm_sha256rnds2_epu32(abef, cdgh, simde_mm_shuffle_epi32(wk, 0x0e));
+    }
+
+    abef = simde_mm_add_epi32(abef, abef_save);
+    cdgh = simde_mm_add_epi32(cdgh, cdgh_save);
+  }
+
+  return simde_mm_xor_si128(abef, cdgh);
+}
+
+static void
+bench_simde_x_sha256(simde_bench_ctx* ctx) {
+  /* One operation is a 1 KiB buffer. */
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), bench_sha256_(a, SIMDE_BENCH_U8(k), 1024));
+}
+
+static void
+bench_simde_mm_fmadd_ps(simde_bench_ctx* ctx) {
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  const simde__m128 c = simde_mm_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_fmadd_ps(a, b, c));
+}
+
+static void
+bench_simde_mm256_add_ps(simde_bench_ctx* ctx) {
+  const simde__m256 b = simde_mm256_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m256, simde_mm256_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm256_add_ps(a, b));
+}
+
+static void
+bench_simde_mm256_fmadd_ps(simde_bench_ctx* ctx) {
+  const simde__m256 b = simde_mm256_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  const simde__m256 c = simde_mm256_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m256, simde_mm256_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm256_fmadd_ps(a, b, c));
+}
+
+static void
+bench_simde_mm256_shuffle_epi8(simde_bench_ctx* ctx) {
+  const simde__m256i b = simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(k))), simde_mm256_shuffle_epi8(a, b));
+}
+
+static void
+bench_simde_mm256_permutevar8x32_epi32(simde_bench_ctx* ctx) {
+  const simde__m256i b = simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(k))), simde_mm256_permutevar8x32_epi32(a, b));
+}
+
+static void
+bench_simde_mm512_add_ps(simde_bench_ctx* ctx) {
+  const simde__m512 b = simde_mm512_loadu_ps(SIMDE_BENCH_F32(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m512, simde_mm512_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm512_add_ps(a, b));
+}
+
+/* AVX-512 masked operations; the mask is not a compile-time constant. */
+
+static void
+bench_simde_mm_mask_mov_epi8(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  const simde__mmask16 m = HEDLEY_STATIC_CAST(simde__mmask16, simde_bench_opaque_i32(0x5a3c));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_mask_mov_epi8(b, m, simde_mm_add_epi8(a, b)));
+}
+
+static void
+bench_simde_mm256_mask_add_epi16(simde_bench_ctx* ctx) {
+  const simde__m256i b = simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(64)));
+  const simde__mmask16 m = HEDLEY_STATIC_CAST(simde__mmask16, simde_bench_opaque_i32(0x5a3c));
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(k))), simde_mm256_mask_add_epi16(a, m, a, b));
+}
+
+static void
+bench_simde_mm512_mask_add_ps(simde_bench_ctx* ctx) {
+  const simde__m512 b = simde_mm512_loadu_ps(SIMDE_BENCH_F32(64));
+  const simde__mmask16 m = HEDLEY_STATIC_CAST(simde__mmask16, simde_bench_opaque_i32(0x5a3c));
+  SIMDE_BENCH_LOOP(ctx, simde__m512, simde_mm512_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm512_mask_add_ps(a, m, a, b));
+}
+
+/* VP2INTERSECT; the masks are fed back into a, which adds a broadcast
+ * and an xor. */
+
+static simde__m256i
+bench_2intersect_epi32_256_(simde__m256i a, simde__m256i b) {
+  simde__mmask8 k1, k2;
+  simde_mm256_2intersect_epi32(a, b, &k1, &k2);
+  return simde_mm256_xor_si256(a, simde_mm256_set1_epi32(k1 ^ k2));
+}
+
+static simde__m512i
+bench_2intersect_epi32_512_(simde__m512i a, simde__m512i b) {
+  simde__mmask16 k1, k2;
+  simde_mm512_2intersect_epi32(a, b, &k1, &k2);
+  return simde_mm512_xor_si512(a, simde_mm512_set1_epi32(k1 ^ k2));
+}
+
+static void
+bench_simde_mm256_2intersect_epi32(simde_bench_ctx* ctx) {
+  const simde__m256i b = simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(k))), bench_2intersect_epi32_256_(a, b));
+}
+
+static void
+bench_simde_mm512_2intersect_epi32(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_2intersect_epi32_512_(a, b));
+}
+
+static void
+bench_simde_mm512_maskz_compress_epi32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_maskz_compress_epi32(SIMDE_BENCH_U16(k)[0], a));
+}
+
+static void
+bench_simde_mm512_maskz_compress_epi8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_maskz_compress_epi8(simde_bench_data.u64[k], a));
+}
+
+static void
+bench_simde_mm512_maskz_expand_epi32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_maskz_expand_epi32(SIMDE_BENCH_U16(k)[0], a));
+}
+
+static void
+bench_simde_mm256_conflict_epi32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(HEDLEY_REINTERPRET_CAST(const simde__m256i*, SIMDE_BENCH_U8(k))), simde_mm256_conflict_epi32(a));
+}
+
+static void
+bench_simde_mm512_conflict_epi32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_conflict_epi32(a));
+}
+
+static void
+bench_simde_mm512_conflict_epi64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_conflict_epi64(a));
+}
+
+static void
+bench_simde_mm_popcnt_epi8(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_popcnt_epi8(a));
+}
+
+static void
+bench_simde_mm512_popcnt_epi64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_popcnt_epi64(a));
+}
+
+/* Bitmap intersection count: one operation is popcount(x & y) over
+ * two 1 KiB bitmaps, either with 64-bit lane counts or with scalar
+ * popcnt on each word. */
+static simde__m512i
+bench_popcount_and_1k_(simde__m512i acc) {
+  for (size_t i = 0 ; i < 1024 ; i += 64) {
+    const simde__m512i v = simde_mm512_and_si512(simde_mm512_loadu_si512(SIMDE_BENCH_U8(i)), simde_mm512_loadu_si512(SIMDE_BENCH_U8(1024 + i)));
+    acc = simde_mm512_add_epi64(acc, simde_mm512_popcnt_epi64(v));
+  }
+
+  return acc;
+}
+
+static uint64_t
+bench_popcount_and_u64_1k_(uint64_t acc) {
+  for (size_t i = 0 ; i < 128 ; i++) {
+    acc += HEDLEY_STATIC_CAST(uint64_t, simde_mm_popcnt_u64(simde_bench_data.u64[i] & simde_bench_data.u64[128 + i]));
+  }
+
+  return acc;
+}
+
+static void
+bench_simde_x_popcount_and_1k(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_popcount_and_1k_(a));
+}
+
+static void
+bench_simde_x_popcount_and_u64_1k(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, simde_bench_data.u64[k], bench_popcount_and_u64_1k_(a));
+}
+
+static void
+bench_simde_mm_dpbusd_epi32(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_dpbusd_epi32(a, a, b));
+}
+
+static void
+bench_simde_mm512_dpbusd_epi32(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_dpbusd_epi32(a, a, b));
+}
+
+static void
+bench_simde_mm512_dpwssds_epi32(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_dpwssds_epi32(a, a, b));
+}
+
+/* Quantized GEMM microkernel: one operation is a 4x16 int32 tile of
+ * C += A * B over K = 64, with A as u8 rows and B as s8 packed four
+ * K values per 32-bit lane (the VNNI layout). */
+static simde__m512i
+bench_qgemm_4x16_k64_(simde__m512i c) {
+  simde__m512i c0 = c, c1 = c, c2 = c, c3 = c;
+
+  for (size_t k = 0 ; k < 64 ; k += 4) {
+    const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(1024 + (k * 16)));
+    int32_t a[4];
+
+    for (size_t m = 0 ; m < 4 ; m++)
+      simde_memcpy(&a[m], SIMDE_BENCH_U8((m * 64) + k), sizeof(a[m]));
+
+    c0 = simde_mm512_dpbusd_epi32(c0, simde_mm512_set1_epi32(a[0]), b);
+    c1 = simde_mm512_dpbusd_epi32(c1, simde_mm512_set1_epi32(a[1]), b);
+    c2 = simde_mm512_dpbusd_epi32(c2, simde_mm512_set1_epi32(a[2]), b);
+    c3 = simde_mm512_dpbusd_epi32(c3, simde_mm512_set1_epi32(a[3]), b);
+  }
+
+  return simde_mm512_add_epi32(simde_mm512_add_epi32(c0, c1), simde_mm512_add_epi32(c2, c3));
+}
+
+/* The same tile at 256 bits (4x8), the width AVX-VNNI targets. */
+static simde__m256i
+bench_qgemm_4x8_k64_(simde__m256i c) {
+  simde__m256i c0 = c, c1 = c, c2 = c, c3 = c;
+
+  for (size_t k = 0 ; k < 64 ; k += 4) {
+    const simde__m256i b = simde_mm256_loadu_si256(SIMDE_BENCH_U8(1024 + (k * 8)));
+    int32_t a[4];
+
+    for (size_t m = 0 ; m < 4 ; m++)
+      simde_memcpy(&a[m], SIMDE_BENCH_U8((m * 64) + k), sizeof(a[m]));
+
+    c0 = simde_mm256_dpbusd_epi32(c0, simde_mm256_set1_epi32(a[0]), b);
+    c1 = simde_mm256_dpbusd_epi32(c1, simde_mm256_set1_epi32(a[1]), b);
+    c2 = simde_mm256_dpbusd_epi32(c2, simde_mm256_set1_epi32(a[2]), b);
+    c3 = simde_mm256_dpbusd_epi32(c3, simde_mm256_set1_epi32(a[3]), b);
+  }
+
+  return simde_mm256_add_epi32(simde_mm256_add_epi32(c0, c1), simde_mm256_add_epi32(c2, c3));
+}
+
+static void
+bench_simde_x_qgemm_4x16_k64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_qgemm_4x16_k64_(a));
+}
+
+static void
+bench_simde_x_qgemm_4x8_k64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(SIMDE_BENCH_U8(k)), bench_qgemm_4x8_k64_(a));
+}
+
+/* 0xe8 is majority (SHA-2 Maj), 0x96 is a three-way xor and 0x17 is
+ * one of the truth tables that needs the longest lowering. */
+static void
+bench_simde_mm_ternarylogic_epi32(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  const simde__m128i c = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(128)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_ternarylogic_epi32(a, b, c, 0xe8));
+}
+
+static void
+bench_simde_mm512_ternarylogic_epi64(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  const simde__m512i c = simde_mm512_loadu_si512(SIMDE_BENCH_U8(128));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_ternarylogic_epi64(a, b, c, 0x96));
+}
+
+static void
+bench_simde_x_mm512_ternarylogic_epi32_0x17(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  const simde__m512i c = simde_mm512_loadu_si512(SIMDE_BENCH_U8(128));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_ternarylogic_epi32(a, b, c, 0x17));
+}
+
+/* Random access: the gathers index the 1024 32-bit (or 512 64-bit)
+ * words of the bench data with indices taken from the chain, so the
+ * latency figure is a pointer chase. */
+static void
+bench_simde_mm512_i32gather_epi32(simde_bench_ctx* ctx) {
+  const simde__m512i m = simde_mm512_set1_epi32(1023);
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_i32gather_epi32(simde_mm512_and_si512(a, m), simde_bench_data.u32, 4));
+}
+
+static void
+bench_simde_mm512_mask_i64gather_epi64(simde_bench_ctx* ctx) {
+  const simde__m512i m = simde_mm512_set1_epi64(511);
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_mask_i64gather_epi64(a, 0x5b, simde_mm512_and_si512(a, m), simde_bench_data.u64, 8));
+}
+
+static uint32_t bench_scatter_buffer_[1024];
+
+static simde__m512i
+bench_scatter_(simde__m512i a) {
+  simde_mm512_i32scatter_epi32(bench_scatter_buffer_, simde_mm512_and_si512(a, simde_mm512_set1_epi32(1023)), a, 4);
+  return simde_mm512_srli_epi32(a, 1);
+}
+
+static void
+bench_simde_mm512_i32scatter_epi32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_scatter_(a));
+}
+
+/* Sparse lookup: one operation is 256 random 32-bit loads (16 gathers
+ * with indices from the bench data) summed into one vector. */
+static simde__m512i
+bench_gather_sum_256_(simde__m512i acc) {
+  const simde__m512i m = simde_mm512_set1_epi32(1023);
+  for (size_t i = 0 ; i < 1024 ; i += 64) {
+    const simde__m512i vindex = simde_mm512_and_si512(simde_mm512_loadu_si512(SIMDE_BENCH_U8(i)), m);
+    acc = simde_mm512_add_epi32(acc, simde_mm512_i32gather_epi32(vindex, simde_bench_data.u32, 4));
+  }
+
+  return acc;
+}
+
+static void
+bench_simde_x_gather_sum_256(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_gather_sum_256_(a));
+}
+
+/* Horizontal reductions; the result is broadcast back into a vector so
+ * it can feed the next iteration. */
+static void
+bench_simde_mm512_reduce_add_ps(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512, simde_mm512_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm512_set1_ps(simde_mm512_reduce_add_ps(a)));
+}
+
+static void
+bench_simde_mm512_reduce_max_epu32(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_mm512_reduce_max_epu32(a))));
+}
+
+static void
+bench_simde_mm512_mask_reduce_mul_epi64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_set1_epi64(simde_mm512_mask_reduce_mul_epi64(0x5b, a)));
+}
+
+/* Dot product: one operation is 256 float multiply-adds accumulated in
+ * one vector, then reduced. */
+static simde_float32
+bench_dot_256_(simde__m512 b) {
+  simde__m512 acc = simde_mm512_setzero_ps();
+  for (size_t i = 0 ; i < 256 ; i += 16)
+    acc = simde_mm512_add_ps(acc, simde_mm512_mul_ps(b, simde_mm512_loadu_ps(SIMDE_BENCH_F32(i))));
+
+  return simde_mm512_reduce_add_ps(acc);
+}
+
+static void
+bench_simde_x_dot_256(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512, simde_mm512_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm512_set1_ps(bench_dot_256_(a)));
+}
+
+/* Stream compaction: one operation filters a 1 KiB block of 32-bit
+ * elements with compressstoreu, using masks where roughly 1/8, 1/2 or
+ * 7/8 of the bits are set.  A branchy fallback gets faster as fewer
+ * elements are selected; a table-driven one should not care. */
+static int32_t bench_filter_out_[256];
+
+static void
+bench_filter_masks_(uint16_t masks[16], size_t offsets[16], int density) {
+  size_t pos = 0;
+
+  for (size_t i = 0 ; i < 16 ; i++) {
+    const uint16_t* d = SIMDE_BENCH_U16(i * 3);
+    masks[i] =
+      (density < 0) ? HEDLEY_STATIC_CAST(uint16_t, d[0] & d[1] & d[2]) :
+      (density > 0) ? HEDLEY_STATIC_CAST(uint16_t, d[0] | d[1] | d[2]) :
+                      d[0];
+    offsets[i] = pos;
+    for (uint16_t m = masks[i] ; m != 0 ; m &= HEDLEY_STATIC_CAST(uint16_t, m - 1))
+      pos++;
+  }
+}
+
+static simde__m512i
+bench_filter_epi32_(simde__m512i a, const uint16_t masks[16], const size_t offsets[16]) {
+  for (size_t i = 0 ; i < 16 ; i++) {
+    const simde__m512i v = simde_mm512_add_epi32(a, simde_mm512_loadu_si512(SIMDE_BENCH_I32(i * 16)));
+    simde_mm512_mask_compressstoreu_epi32(&(bench_filter_out_[offsets[i]]), masks[i], v);
+  }
+
+  return simde_mm512_loadu_si512(bench_filter_out_);
+}
+
+static void
+bench_simde_x_filter_epi32_sel12(simde_bench_ctx* ctx) {
+  uint16_t masks[16];
+  size_t offsets[16];
+  bench_filter_masks_(masks, offsets, -1);
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_filter_epi32_(a, masks, offsets));
+}
+
+static void
+bench_simde_x_filter_epi32_sel50(simde_bench_ctx* ctx) {
+  uint16_t masks[16];
+  size_t offsets[16];
+  bench_filter_masks_(masks, offsets, 0);
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_filter_epi32_(a, masks, offsets));
+}
+
+static void
+bench_simde_x_filter_epi32_sel88(simde_bench_ctx* ctx) {
+  uint16_t masks[16];
+  size_t offsets[16];
+  bench_filter_masks_(masks, offsets, 1);
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), bench_filter_epi32_(a, masks, offsets));
+}
+
+/* Bulk half-precision conversion: one operation converts 512 elements
+ * between 1 KiB of halves and 2 KiB of floats, so 3072 / (ns/op) is
+ * the bandwidth in GB/s.  The widening input is random bits, so it
+ * includes subnormals, infinities and NaNs. */
+static simde_float32 bench_cvt_f32_[512];
+static uint16_t bench_cvt_f16_[512];
+
+static simde__m128i
+bench_cvtph_ps_512_(simde__m128i a) {
+  for (size_t i = 0 ; i < 512 ; i += 8) {
+    const simde__m128i h = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U16(i)));
+    simde_mm256_storeu_ps(&(bench_cvt_f32_[i]), simde_mm256_cvtph_ps(simde_mm_xor_si128(a, h)));
+  }
+
+  return simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(bench_cvt_f32_[508])));
+}
+
+static simde__m256
+bench_cvtps_ph_512_(simde__m256 a) {
+  for (size_t i = 0 ; i < 512 ; i += 8) {
+    const simde__m256 f = simde_mm256_sub_ps(simde_mm256_loadu_ps(SIMDE_BENCH_F32(i)), a);
+    simde_mm_storeu_si128(HEDLEY_REINTERPRET_CAST(simde__m128i*, &(bench_cvt_f16_[i])), simde_mm256_cvtps_ph(f, SIMDE_MM_FROUND_TO_NEAREST_INT));
+  }
+
+  return simde_mm256_cvtph_ps(simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, &(bench_cvt_f16_[504]))));
+}
+
+static void
+bench_simde_x_cvtph_ps_512(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), bench_cvtph_ps_512_(a));
+}
+
+static void
+bench_simde_x_cvtps_ph_512(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m256, simde_mm256_loadu_ps(SIMDE_BENCH_F32(k)), bench_cvtps_ph_512_(a));
+}
+
+/* PDEP/PEXT.  With a random mask (about 16 runs of set bits) the
+ * portable version takes the branch-free path; the sparse mask (about
+ * eight set bits) takes the run-at-a-time loop.  The Morton benchmarks
+ * interleave/deinterleave two 32-bit coordinates with constant masks,
+ * which is how these are usually used. */
+
+static void
+bench_simde_pdep_u64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, SIMDE_BENCH_U64(k)[0], simde_pdep_u64(a ^ SIMDE_BENCH_U64(k)[64], SIMDE_BENCH_U64(k)[0]));
+}
+
+static void
+bench_simde_pext_u64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, SIMDE_BENCH_U64(k)[0], simde_pext_u64(a ^ SIMDE_BENCH_U64(k)[64], SIMDE_BENCH_U64(k)[0]));
+}
+
+static void
+bench_simde_x_pext_u64_sparse(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, SIMDE_BENCH_U64(k)[0],
+    simde_pext_u64(a ^ SIMDE_BENCH_U64(k)[64], SIMDE_BENCH_U64(k)[0] & SIMDE_BENCH_U64(k)[128] & SIMDE_BENCH_U64(k)[192]));
+}
+
+static void
+bench_simde_x_morton_encode_u64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, SIMDE_BENCH_U64(k)[0],
+    simde_pdep_u64(a, UINT64_C(0x5555555555555555)) | simde_pdep_u64(a >> 32, UINT64_C(0xaaaaaaaaaaaaaaaa)));
+}
+
+static void
+bench_simde_x_morton_decode_u64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, uint64_t, SIMDE_BENCH_U64(k)[0],
+    simde_pext_u64(a, UINT64_C(0x5555555555555555)) | (simde_pext_u64(a, UINT64_C(0xaaaaaaaaaaaaaaaa)) << 32));
+}
+
+/* VBMI/VBMI2.  The multishift controls come from the bench data, so
+ * they are neither constant nor sorted. */
+static void
+bench_simde_mm_multishift_epi64_epi8(simde_bench_ctx* ctx) {
+  const simde__m128i c = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_multishift_epi64_epi8(c, a));
+}
+
+static void
+bench_simde_mm512_multishift_epi64_epi8(simde_bench_ctx* ctx) {
+  const simde__m512i c = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_multishift_epi64_epi8(c, a));
+}
+
+/* Bit unpacking: eight 6-bit fields from the low 48 bits of each qword,
+ * one per byte, as in base64 decoding or packed-integer columns. */
+static void
+bench_simde_x_unpack_u6_512(simde_bench_ctx* ctx) {
+  const simde__m512i c = simde_mm512_set1_epi64(INT64_C(0x2a241e18120c0600));
+  const simde__m512i m = simde_mm512_set1_epi8(0x3f);
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_and_si512(simde_mm512_multishift_epi64_epi8(c, a), m));
+}
+
+static void
+bench_simde_mm_shldv_epi16(simde_bench_ctx* ctx) {
+  const simde__m128i b = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(64)));
+  const simde__m128i c = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(128)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128i, simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, SIMDE_BENCH_U8(k))), simde_mm_shldv_epi16(a, b, c));
+}
+
+static void
+bench_simde_mm512_shldv_epi16(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  const simde__m512i c = simde_mm512_loadu_si512(SIMDE_BENCH_U8(128));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_shldv_epi16(a, b, c));
+}
+
+static void
+bench_simde_mm512_shrdv_epi16(simde_bench_ctx* ctx) {
+  const simde__m512i b = simde_mm512_loadu_si512(SIMDE_BENCH_U8(64));
+  const simde__m512i c = simde_mm512_loadu_si512(SIMDE_BENCH_U8(128));
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_shrdv_epi16(a, b, c));
+}
+
+static void
+bench_simde_mm256_shldv_epi32(simde_bench_ctx* ctx) {
+  const simde__m256i b = simde_mm256_loadu_si256(SIMDE_BENCH_U8(64));
+  const simde__m256i c = simde_mm256_loadu_si256(SIMDE_BENCH_U8(128));
+  SIMDE_BENCH_LOOP(ctx, simde__m256i, simde_mm256_loadu_si256(SIMDE_BENCH_U8(k)), simde_mm256_shldv_epi32(a, b, c));
+}
+
+/* shldi with a == b is a rotate. */
+static void
+bench_simde_mm512_shldi_epi64(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m512i, simde_mm512_loadu_si512(SIMDE_BENCH_U8(k)), simde_mm512_shldi_epi64(a, a, 13));
+}
+
+/* SVML.  Each chain converges to a fixed point in a "normal" part of
+ * the domain rather than to zero, infinity or NaN, where libm (and
+ * some fallbacks) take fast paths. */
+
+static void
+bench_simde_mm_exp_ps(simde_bench_ctx* ctx) {
+  /* exp(-a): includes an xor. */
+  const simde__m128 n = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(-0.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_exp_ps(simde_mm_xor_ps(a, n)));
+}
+
+static void
+bench_simde_mm_exp_pd(simde_bench_ctx* ctx) {
+  const simde__m128d n = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(-0.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_exp_pd(simde_mm_xor_pd(a, n)));
+}
+
+static void
+bench_simde_mm_log_ps(simde_bench_ctx* ctx) {
+  /* log(a + 2): includes an add. */
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(2.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_log_ps(simde_mm_add_ps(a, b)));
+}
+
+static void
+bench_simde_mm_log_pd(simde_bench_ctx* ctx) {
+  const simde__m128d b = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(2.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_log_pd(simde_mm_add_pd(a, b)));
+}
+
+static void
+bench_simde_mm_sin_ps(simde_bench_ctx* ctx) {
+  /* sin(a + 1): includes an add. */
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_sin_ps(simde_mm_add_ps(a, b)));
+}
+
+static void
+bench_simde_mm_sin_pd(simde_bench_ctx* ctx) {
+  const simde__m128d b = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_sin_pd(simde_mm_add_pd(a, b)));
+}
+
+static void
+bench_simde_mm_cos_ps(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_cos_ps(a));
+}
+
+static void
+bench_simde_mm_cos_pd(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_cos_pd(a));
+}
+
+static void
+bench_simde_mm_tan_ps(simde_bench_ctx* ctx) {
+  /* tan(min(a, 1)): includes a min. */
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_tan_ps(simde_mm_min_ps(a, b)));
+}
+
+static void
+bench_simde_mm_tan_pd(simde_bench_ctx* ctx) {
+  const simde__m128d b = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_tan_pd(simde_mm_min_pd(a, b)));
+}
+
+static void
+bench_simde_mm_atan_ps(simde_bench_ctx* ctx) {
+  /* atan(a + 1): includes an add. */
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_atan_ps(simde_mm_add_ps(a, b)));
+}
+
+static void
+bench_simde_mm_atan_pd(simde_bench_ctx* ctx) {
+  const simde__m128d b = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_atan_pd(simde_mm_add_pd(a, b)));
+}
+
+static void
+bench_simde_mm_pow_ps(simde_bench_ctx* ctx) {
+  /* pow(a + 1, 0.5): includes an add. */
+  const simde__m128 b = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(1.0)));
+  const simde__m128 e = simde_mm_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(0.5)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_pow_ps(simde_mm_add_ps(a, b), e));
+}
+
+static void
+bench_simde_mm_pow_pd(simde_bench_ctx* ctx) {
+  const simde__m128d b = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(1.0)));
+  const simde__m128d e = simde_mm_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(0.5)));
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_pow_pd(simde_mm_add_pd(a, b), e));
+}
+
+static void
+bench_simde_mm_erf_ps(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128, simde_mm_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm_erf_ps(a));
+}
+
+static void
+bench_simde_mm_erf_pd(simde_bench_ctx* ctx) {
+  SIMDE_BENCH_LOOP(ctx, simde__m128d, simde_mm_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm_erf_pd(a));
+}
+
+static void
+bench_simde_mm256_exp_ps(simde_bench_ctx* ctx) {
+  const simde__m256 n = simde_mm256_set1_ps(simde_bench_opaque_f32(SIMDE_FLOAT32_C(-0.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m256, simde_mm256_loadu_ps(SIMDE_BENCH_F32(k)), simde_mm256_exp_ps(simde_mm256_xor_ps(a, n)));
+}
+
+static void
+bench_simde_mm256_sin_pd(simde_bench_ctx* ctx) {
+  const simde__m256d b = simde_mm256_set1_pd(simde_bench_opaque_f64(SIMDE_FLOAT64_C(1.0)));
+  SIMDE_BENCH_LOOP(ctx, simde__m256d, simde_mm256_loadu_pd(SIMDE_BENCH_F64(k)), simde_mm256_sin_pd(simde_mm256_add_pd(a, b)));
+}
+
+SIMDE_BENCH_FUNC_LIST_BEGIN
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_add_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_mul_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_div_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_sqrt_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_rcp_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_min_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_shuffle_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_add_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_mullo_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_madd_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_sad_epu8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_packs_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_movemask_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_maskmoveu_si128)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_cvtps_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_shuffle_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_maddubs_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_hadd_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_blendv_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_mullo_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_dp_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_round_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_minpos_epu16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_cmpgt_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_cmpestri)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_cmpistri)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_crc32_u8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_crc32_u32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_crc32_u64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_crc32c_buffer)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_clmulepi64_si128)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_clmulepi64_epi128)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_ghash)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_aesenc_si128)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_aesdec_si128)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_aesenc_epi128)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_sha256)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_fmadd_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_add_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_fmadd_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_shuffle_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_permutevar8x32_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_add_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_mask_mov_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_mask_add_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_mask_add_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_2intersect_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_2intersect_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_maskz_compress_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_maskz_compress_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_maskz_expand_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_conflict_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_conflict_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_conflict_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_popcnt_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_popcnt_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_popcount_and_1k)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_popcount_and_u64_1k)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_dpbusd_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_dpbusd_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_dpwssds_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_qgemm_4x16_k64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_qgemm_4x8_k64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_ternarylogic_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_ternarylogic_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_mm512_ternarylogic_epi32_0x17)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_i32gather_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_mask_i64gather_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_i32scatter_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_gather_sum_256)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_reduce_add_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_reduce_max_epu32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_dot_256)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_filter_epi32_sel12)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_filter_epi32_sel50)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_filter_epi32_sel88)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_cvtph_ps_512)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_cvtps_ph_512)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(pdep_u64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(pext_u64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_pext_u64_sparse)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_morton_encode_u64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_morton_decode_u64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_multishift_epi64_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_multishift_epi64_epi8)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(x_unpack_u6_512)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_shldv_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_shldv_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_shrdv_epi16)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_shldv_epi32)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm512_shldi_epi64)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_exp_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_exp_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_log_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_log_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_sin_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_sin_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_cos_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_cos_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_tan_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_tan_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_atan_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_atan_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_pow_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_pow_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_erf_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm_erf_pd)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_exp_ps)
+  SIMDE_BENCH_FUNC_LIST_ENTRY(mm256_sin_pd)
+SIMDE_BENCH_FUNC_LIST_END
+
+SIMDE_BENCH_MAIN("x86")
@@ -0,0 +1,1210 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX aes
+#include <simde/x86/aes.h>
+#include <simde/x86/avx512/loadu.h>
+#include <test/x86/avx512/test-avx512.h>
+
+static int
+test_simde_mm_aesenc_si128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t round_key[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C(173), UINT8_C(118), UINT8_C( 54), UINT8_C(116), UINT8_C(236), UINT8_C(121), UINT8_C(207), UINT8_C(234),
+        UINT8_C(139), UINT8_C(142), UINT8_C( 21), UINT8_C(  3), UINT8_C(253), UINT8_C(158), UINT8_C( 31), UINT8_C(255) },
+      { UINT8_C(184), UINT8_C(117), UINT8_C( 79), UINT8_C( 25), UINT8_C(109), UINT8_C(239), UINT8_C( 26), UINT8_C(222),
+        UINT8_C(189), UINT8_C(228), UINT8_C( 19), UINT8_C( 63), UINT8_C( 45), UINT8_C(125), UINT8_C( 55), UINT8_C(245) },
+      { UINT8_C(  7), UINT8_C(106), UINT8_C(228), UINT8_C(126), UINT8_C(147), UINT8_C(218), UINT8_C(251), UINT8_C(113),
+        UINT8_C( 88), UINT8_C( 71), UINT8_C(189), UINT8_C( 99), UINT8_C( 60), UINT8_C(167), UINT8_C(217), UINT8_C( 77) } },
+    { { UINT8_C( 90), UINT8_C(236), UINT8_C(237), UINT8_C( 82), UINT8_C(246), UINT8_C(  9), UINT8_C(179), UINT8_C( 32),
+        UINT8_C( 94), UINT8_C(194), UINT8_C(185), UINT8_C(172), UINT8_C(187), UINT8_C(210), UINT8_C( 13), UINT8_C(117) },
+      { UINT8_C(185), UINT8_C(236), UINT8_C( 95), UINT8_C(217), UINT8_C( 38), UINT8_C( 18), UINT8_C( 16), UINT8_C( 38),
+        UINT8_C(166), UINT8_C(121), UINT8_C(175), UINT8_C(198), UINT8_C(227), UINT8_C(200), UINT8_C( 23), UINT8_C( 69) },
+      { UINT8_C( 22), UINT8_C( 55), UINT8_C(240), UINT8_C(118), UINT8_C( 26), UINT8_C(120), UINT8_C(194), UINT8_C( 18),
+        UINT8_C( 48), UINT8_C( 24), UINT8_C( 42), UINT8_C(187), UINT8_C(153), UINT8_C(131), UINT8_C( 65), UINT8_C(250) } },
+    { { UINT8_C(115), UINT8_C(229), UINT8_C(190), UINT8_C(  1), UINT8_C(169), UINT8_C(206), UINT8_C( 93), UINT8_C(169),
+        UINT8_C( 50), UINT8_C( 28), UINT8_C(128), UINT8_C( 99), UINT8_C(143), UINT8_C( 76), UINT8_C( 94), UINT8_C( 48) },
+      { UINT8_C(234), UINT8_C( 47), UINT8_C(225), UINT8_C( 38), UINT8_C(250), UINT8_C(117), UINT8_C(181), UINT8_C( 68),
+        UINT8_C(182), UINT8_C(191), UINT8_C( 18), UINT8_C( 12), UINT8_C( 18), UINT8_C( 26), UINT8_C( 28), UINT8_C(178) },
+      { UINT8_C(160), UINT8_C(229), UINT8_C(104), UINT8_C(226), UINT8_C(220), UINT8_C( 17), UINT8_C(206), UINT8_C( 22),
+        UINT8_C(246), UINT8_C(244), UINT8_C( 49), UINT8_C( 83), UINT8_C( 51), UINT8_C(239), UINT8_C( 56), UINT8_C( 95) } },
+    { { UINT8_C( 59), UINT8_C( 63), UINT8_C(247), UINT8_C(174), UINT8_C( 75), UINT8_C(  7), UINT8_C(213), UINT8_C(212),
+        UINT8_C( 89), UINT8_C( 47), UINT8_C( 77), UINT8_C(151), UINT8_C(208), UINT8_C(107), UINT8_C(157), UINT8_C(162) },
+      { UINT8_C(  3), UINT8_C(203), UINT8_C( 84), UINT8_C(254), UINT8_C( 89), UINT8_C( 25), UINT8_C(205), UINT8_C(186),
+        UINT8_C(145), UINT8_C(188), UINT8_C(225), UINT8_C( 18), UINT8_C(170), UINT8_C( 41), UINT8_C(141), UINT8_C(228) },
+      { UINT8_C( 81), UINT8_C(188), UINT8_C(224), UINT8_C(145), UINT8_C(161), UINT8_C(134), UINT8_C(224), UINT8_C(236),
+        UINT8_C(189), UINT8_C(121), UINT8_C( 93), UINT8_C(211), UINT8_C( 94), UINT8_C( 62), UINT8_C( 13), UINT8_C(  9) } },
+    { { UINT8_C( 63), UINT8_C(163), UINT8_C(106), UINT8_C(166), UINT8_C( 55), UINT8_C( 63), UINT8_C(151), UINT8_C( 36),
+        UINT8_C(130), UINT8_C( 85), UINT8_C(117), UINT8_C(145), UINT8_C(126), UINT8_C( 62), UINT8_C( 82), UINT8_C(156) },
+      { UINT8_C(143), UINT8_C(102), UINT8_C(196), UINT8_C(  5), UINT8_C( 33), UINT8_C(  9), UINT8_C( 63), UINT8_C(135),
+        UINT8_C(244), UINT8_C(103), UINT8_C(251), UINT8_C(178), UINT8_C(203), UINT8_C(230), UINT8_C(249), UINT8_C(186) },
+      { UINT8_C(185), UINT8_C(155), UINT8_C(156), UINT8_C(213), UINT8_C( 53), UINT8_C( 84), UINT8_C( 53), UINT8_C(134),
+        UINT8_C( 43), UINT8_C( 59), UINT8_C(  4), UINT8_C( 91), UINT8_C( 33), UINT8_C(  3), UINT8_C(147), UINT8_C( 47) } },
+    { { UINT8_C( 67), UINT8_C(113), UINT8_C(247), UINT8_C(  0), UINT8_C(186), UINT8_C(123), UINT8_C(253), UINT8_C(210),
+        UINT8_C( 99), UINT8_C( 71), UINT8_C(153), UINT8_C(  4), UINT8_C(136), UINT8_C(237), UINT8_C( 48), UINT8_C(238) },
+      { UINT8_C(157), UINT8_C(  4), UINT8_C( 50), UINT8_C(168), UINT8_C( 87), UINT8_C(173), UINT8_C(120), UINT8_C( 82),
+        UINT8_C(206), UINT8_C( 21), UINT8_C( 27), UINT8_C(161), UINT8_C(156), UINT8_C( 85), UINT8_C(183), UINT8_C(166) },
+      { UINT8_C( 12), UINT8_C( 93), UINT8_C(182), UINT8_C( 25), UINT8_C( 56), UINT8_C(109), UINT8_C(129), UINT8_C( 55),
+        UINT8_C(  1), UINT8_C( 73), UINT8_C(161), UINT8_C(251), UINT8_C( 87), UINT8_C(194), UINT8_C(117), UINT8_C(249) } },
+    { { UINT8_C(125), UINT8_C( 57), UINT8_C(213), UINT8_C( 74), UINT8_C(252), UINT8_C(101), UINT8_C(195), UINT8_C(228),
+        UINT8_C(125), UINT8_C( 97), UINT8_C(113), UINT8_C(105), UINT8_C(125), UINT8_C(183), UINT8_C(198), UINT8_C(239) },
+      { UINT8_C(224), UINT8_C(107), UINT8_C( 15), UINT8_C( 57), UINT8_C( 81), UINT8_C(117), UINT8_C( 83), UINT8_C( 91),
+        UINT8_C(179), UINT8_C(132), UINT8_C(225), UINT8_C( 96), UINT8_C(246), UINT8_C(131), UINT8_C(114), UINT8_C(174) },
+      { UINT8_C(174), UINT8_C( 47), UINT8_C(154), UINT8_C(104), UINT8_C( 98), UINT8_C( 17), UINT8_C( 30), UINT8_C(124),
+        UINT8_C(220), UINT8_C( 94), UINT8_C( 10), UINT8_C(  2), UINT8_C(242), UINT8_C(211), UINT8_C(211), UINT8_C( 97) } },
+    { { UINT8_C( 89), UINT8_C(123), UINT8_C( 51), UINT8_C( 75), UINT8_C(197), UINT8_C( 76), UINT8_C(  2), UINT8_C(182),
+        UINT8_C( 39), UINT8_C(143), UINT8_C(  6), UINT8_C( 80), UINT8_C(252), UINT8_C(153), UINT8_C(  6), UINT8_C(172) },
+      { UINT8_C( 53), UINT8_C( 21), UINT8_C( 91), UINT8_C(103), UINT8_C(145), UINT8_C(212), UINT8_C( 55), UINT8_C( 45),
+        UINT8_C(107), UINT8_C(215), UINT8_C(192), UINT8_C(211), UINT8_C(252), UINT8_C(203), UINT8_C(124), UINT8_C(152) },
+      { UINT8_C( 61), UINT8_C(172), UINT8_C(207), UINT8_C( 94), UINT8_C(143), UINT8_C(150), UINT8_C(242), UINT8_C(189),
+        UINT8_C( 76), UINT8_C(204), UINT8_C(173), UINT8_C( 45), UINT8_C(192), UINT8_C(243), UINT8_C(246), UINT8_C(163) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i round_key = simde_mm_loadu_si128(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesenc_si128(a, round_key);
+    simde_test_x86_assert_equal_u8x16(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesenclast_si128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t round_key[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C( 87), UINT8_C(235), UINT8_C(134), UINT8_C( 47), UINT8_C( 81), UINT8_C(255), UINT8_C( 14), UINT8_C( 32),
+        UINT8_C(188), UINT8_C(213), UINT8_C(178), UINT8_C(145), UINT8_C(214), UINT8_C(229), UINT8_C( 98), UINT8_C( 10) },
+      { UINT8_C(192), UINT8_C(187), UINT8_C( 64), UINT8_C(178), UINT8_C( 45), UINT8_C(245), UINT8_C(178), UINT8_C(225),
+        UINT8_C(228), UINT8_C( 11), UINT8_C( 95), UINT8_C( 49), UINT8_C(131), UINT8_C( 14), UINT8_C(200), UINT8_C( 23) },
+      { UINT8_C(155), UINT8_C(173), UINT8_C(119), UINT8_C(213), UINT8_C(252), UINT8_C(246), UINT8_C( 24), UINT8_C(244),
+        UINT8_C(129), UINT8_C(210), UINT8_C( 27), UINT8_C(134), UINT8_C(117), UINT8_C(231), UINT8_C( 99), UINT8_C(150) } },
+    { { UINT8_C(115), UINT8_C( 21), UINT8_C(103), UINT8_C(145), UINT8_C(108), UINT8_C( 62), UINT8_C( 56), UINT8_C(210),
+        UINT8_C( 43), UINT8_C( 75), UINT8_C(135), UINT8_C(134), UINT8_C(231), UINT8_C( 98), UINT8_C( 42), UINT8_C( 16) },
+      { UINT8_C( 32), UINT8_C(210), UINT8_C(237), UINT8_C( 96), UINT8_C(236), UINT8_C(251), UINT8_C( 58), UINT8_C(138),
+        UINT8_C(155), UINT8_C(172), UINT8_C(133), UINT8_C(228), UINT8_C(201), UINT8_C(228), UINT8_C(115), UINT8_C(165) },
+      { UINT8_C(175), UINT8_C( 96), UINT8_C(250), UINT8_C(170), UINT8_C(188), UINT8_C( 72), UINT8_C(223), UINT8_C( 11),
+        UINT8_C(106), UINT8_C(  6), UINT8_C(  0), UINT8_C( 81), UINT8_C( 93), UINT8_C(189), UINT8_C(116), UINT8_C(225) } },
+    { { UINT8_C(196), UINT8_C( 87), UINT8_C( 33), UINT8_C( 49), UINT8_C(153), UINT8_C( 34), UINT8_C(112), UINT8_C(210),
+        UINT8_C(237), UINT8_C(  0), UINT8_C(224), UINT8_C(163), UINT8_C( 28), UINT8_C(150), UINT8_C(147), UINT8_C(112) },
+      { UINT8_C(200), UINT8_C(147), UINT8_C(152), UINT8_C(139), UINT8_C(208), UINT8_C(161), UINT8_C( 92), UINT8_C( 58),
+        UINT8_C(164), UINT8_C(133), UINT8_C(196), UINT8_C( 49), UINT8_C(133), UINT8_C(182), UINT8_C(225), UINT8_C( 30) },
+      { UINT8_C(212), UINT8_C(  0), UINT8_C(121), UINT8_C(218), UINT8_C( 62), UINT8_C(194), UINT8_C(128), UINT8_C(253),
+        UINT8_C(241), UINT8_C( 21), UINT8_C( 57), UINT8_C(132), UINT8_C( 25), UINT8_C(237), UINT8_C(176), UINT8_C( 20) } },
+    { { UINT8_C(140), UINT8_C( 61), UINT8_C(189), UINT8_C( 98), UINT8_C( 28), UINT8_C( 52), UINT8_C(168), UINT8_C( 75),
+        UINT8_C( 43), UINT8_C(151), UINT8_C(  4), UINT8_C(174), UINT8_C(179), UINT8_C(148), UINT8_C( 15), UINT8_C(121) },
+      { UINT8_C(157), UINT8_C(140), UINT8_C(151), UINT8_C(230), UINT8_C(195), UINT8_C( 62), UINT8_C(248), UINT8_C( 83),
+        UINT8_C(189), UINT8_C(222), UINT8_C( 25), UINT8_C(169), UINT8_C(118), UINT8_C( 72), UINT8_C(204), UINT8_C(103) },
+      { UINT8_C(249), UINT8_C(148), UINT8_C(101), UINT8_C( 80), UINT8_C( 95), UINT8_C(182), UINT8_C(142), UINT8_C(249),
+        UINT8_C( 76), UINT8_C(252), UINT8_C( 99), UINT8_C( 26), UINT8_C( 27), UINT8_C(111), UINT8_C( 14), UINT8_C(131) } },
+    { { UINT8_C(139), UINT8_C(126), UINT8_C(252), UINT8_C(199), UINT8_C( 76), UINT8_C(170), UINT8_C(195), UINT8_C(242),
+        UINT8_C(147), UINT8_C(178), UINT8_C(101), UINT8_C(111), UINT8_C(113), UINT8_C(155), UINT8_C( 74), UINT8_C(214) },
+      { UINT8_C( 63), UINT8_C(131), UINT8_C( 20), UINT8_C( 76), UINT8_C(  0), UINT8_C(242), UINT8_C( 53), UINT8_C(101),
+        UINT8_C( 45), UINT8_C( 49), UINT8_C(179), UINT8_C( 90), UINT8_C( 84), UINT8_C( 48), UINT8_C(202), UINT8_C( 89) },
+      { UINT8_C(  2), UINT8_C( 47), UINT8_C( 89), UINT8_C(186), UINT8_C( 41), UINT8_C(197), UINT8_C(227), UINT8_C(163),
+        UINT8_C(241), UINT8_C( 37), UINT8_C(  3), UINT8_C(211), UINT8_C(247), UINT8_C(195), UINT8_C(228), UINT8_C(241) } },
+    { { UINT8_C(  3), UINT8_C(149), UINT8_C(122), UINT8_C( 62), UINT8_C(162), UINT8_C( 47), UINT8_C(129), UINT8_C(254),
+        UINT8_C( 41), UINT8_C( 73), UINT8_C(185), UINT8_C(216), UINT8_C(147), UINT8_C( 80), UINT8_C(  2), UINT8_C( 42) },
+      { UINT8_C( 54), UINT8_C(212), UINT8_C(135), UINT8_C(100), UINT8_C(132), UINT8_C(111), UINT8_C( 61), UINT8_C( 69),
+        UINT8_C(103), UINT8_C( 51), UINT8_C(123), UINT8_C(167), UINT8_C( 28), UINT8_C(254), UINT8_C(137), UINT8_C(230) },
+      { UINT8_C( 77), UINT8_C(193), UINT8_C(209), UINT8_C(129), UINT8_C(190), UINT8_C( 84), UINT8_C( 74), UINT8_C(247),
+        UINT8_C(194), UINT8_C( 96), UINT8_C(161), UINT8_C( 28), UINT8_C(192), UINT8_C(212), UINT8_C(133), UINT8_C(135) } },
+    { { UINT8_C(179), UINT8_C(126), UINT8_C(234), UINT8_C(181), UINT8_C(168), UINT8_C(123), UINT8_C( 95), UINT8_C(201),
+        UINT8_C(  0), UINT8_C( 52), UINT8_C(160), UINT8_C(123), UINT8_C(153), UINT8_C( 60), UINT8_C(204), UINT8_C(151) },
+      { UINT8_C( 78), UINT8_C( 82), UINT8_C(150), UINT8_C(137), UINT8_C( 52), UINT8_C( 42), UINT8_C(214), UINT8_C(235),
+        UINT8_C(228), UINT8_C(241), UINT8_C( 60), UINT8_C(236), UINT8_C( 97), UINT8_C( 99), UINT8_C( 13), UINT8_C(171) },
+      { UINT8_C( 35), UINT8_C(115), UINT8_C(118), UINT8_C(  1), UINT8_C(246), UINT8_C( 50), UINT8_C(157), UINT8_C( 62),
+        UINT8_C(135), UINT8_C( 26), UINT8_C(187), UINT8_C( 49), UINT8_C(143), UINT8_C(144), UINT8_C(194), UINT8_C(138) } },
+    { { UINT8_C(230), UINT8_C(213), UINT8_C(186), UINT8_C(  3), UINT8_C(137), UINT8_C( 84), UINT8_C(248), UINT8_C(211),
+        UINT8_C( 12), UINT8_C( 72), UINT8_C( 22), UINT8_C(  0), UINT8_C( 56), UINT8_C(252), UINT8_C(117), UINT8_C(133) },
+      { UINT8_C(128), UINT8_C( 15), UINT8_C(201), UINT8_C(192), UINT8_C(121), UINT8_C(225), UINT8_C(112), UINT8_C( 86),
+        UINT8_C(112), UINT8_C( 72), UINT8_C( 24), UINT8_C( 12), UINT8_C(242), UINT8_C( 63), UINT8_C( 27), UINT8_C( 43) },
+      { UINT8_C( 14), UINT8_C( 47), UINT8_C(142), UINT8_C( 87), UINT8_C(222), UINT8_C(179), UINT8_C(237), UINT8_C( 45),
+        UINT8_C(142), UINT8_C(248), UINT8_C(236), UINT8_C(106), UINT8_C(245), UINT8_C( 60), UINT8_C( 90), UINT8_C( 72) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i round_key = simde_mm_loadu_si128(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesenclast_si128(a, round_key);
+    simde_test_x86_assert_equal_u8x16(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesdec_si128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t round_key[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C(183), UINT8_C(208), UINT8_C(117), UINT8_C( 53), UINT8_C( 39), UINT8_C(113), UINT8_C(223), UINT8_C(228),
+        UINT8_C(157), UINT8_C(154), UINT8_C(121), UINT8_C( 55), UINT8_C(187), UINT8_C(214), UINT8_C(213), UINT8_C(204) },
+      { UINT8_C(245), UINT8_C(246), UINT8_C(103), UINT8_C( 59), UINT8_C(235), UINT8_C( 34), UINT8_C(144), UINT8_C(115),
+        UINT8_C(157), UINT8_C(220), UINT8_C(173), UINT8_C(104), UINT8_C( 52), UINT8_C(160), UINT8_C(201), UINT8_C(140) },
+      { UINT8_C( 21), UINT8_C(206), UINT8_C(222), UINT8_C( 49), UINT8_C(198), UINT8_C( 42), UINT8_C(129), UINT8_C( 29),
+        UINT8_C( 22), UINT8_C(133), UINT8_C(238), UINT8_C(184), UINT8_C( 65), UINT8_C(239), UINT8_C( 72), UINT8_C(200) } },
+    { { UINT8_C(247), UINT8_C(212), UINT8_C(199), UINT8_C(242), UINT8_C( 37), UINT8_C(199), UINT8_C( 30), UINT8_C(206),
+        UINT8_C(247), UINT8_C( 26), UINT8_C( 32), UINT8_C( 70), UINT8_C( 26), UINT8_C( 62), UINT8_C( 80), UINT8_C( 48) },
+      { UINT8_C( 82), UINT8_C( 82), UINT8_C(254), UINT8_C(181), UINT8_C(100), UINT8_C(176), UINT8_C(253), UINT8_C(198),
+        UINT8_C(  9), UINT8_C(147), UINT8_C(212), UINT8_C( 13), UINT8_C(181), UINT8_C(204), UINT8_C( 97), UINT8_C(163) },
+      { UINT8_C( 83), UINT8_C(103), UINT8_C( 19), UINT8_C( 35), UINT8_C(201), UINT8_C( 61), UINT8_C(160), UINT8_C(148),
+        UINT8_C( 24), UINT8_C(  3), UINT8_C(142), UINT8_C(248), UINT8_C(172), UINT8_C(  3), UINT8_C( 19), UINT8_C(234) } },
+    { { UINT8_C( 12), UINT8_C(234), UINT8_C(203), UINT8_C(138), UINT8_C(  3), UINT8_C(199), UINT8_C(208), UINT8_C(109),
+        UINT8_C( 51), UINT8_C( 49), UINT8_C( 69), UINT8_C( 39), UINT8_C(245), UINT8_C(252), UINT8_C(159), UINT8_C( 52) },
+      { UINT8_C( 36), UINT8_C(144), UINT8_C( 47), UINT8_C(117), UINT8_C(139), UINT8_C( 96), UINT8_C(138), UINT8_C(189),
+        UINT8_C(164), UINT8_C(251), UINT8_C(  2), UINT8_C(  6), UINT8_C(  8), UINT8_C(160), UINT8_C( 45), UINT8_C(155) },
+      { UINT8_C(232), UINT8_C(125), UINT8_C( 20), UINT8_C( 96), UINT8_C(150), UINT8_C(138), UINT8_C( 86), UINT8_C(171),
+        UINT8_C(157), UINT8_C(115), UINT8_C( 72), UINT8_C(219), UINT8_C(150), UINT8_C(188), UINT8_C( 83), UINT8_C(145) } },
+    { { UINT8_C( 50), UINT8_C( 98), UINT8_C(184), UINT8_C(243), UINT8_C( 44), UINT8_C(246), UINT8_C(239), UINT8_C(146),
+        UINT8_C( 11), UINT8_C(115), UINT8_C(237), UINT8_C( 38), UINT8_C(180), UINT8_C(163), UINT8_C(124), UINT8_C( 34) },
+      { UINT8_C(186), UINT8_C(155), UINT8_C(140), UINT8_C(  5), UINT8_C( 99), UINT8_C(191), UINT8_C(222), UINT8_C( 61),
+        UINT8_C( 57), UINT8_C(177), UINT8_C( 66), UINT8_C( 40), UINT8_C(102), UINT8_C(240), UINT8_C( 89), UINT8_C( 59) },
+      { UINT8_C( 75), UINT8_C(180), UINT8_C(122), UINT8_C(218), UINT8_C( 54), UINT8_C(132), UINT8_C( 69), UINT8_C(  3),
+        UINT8_C(103), UINT8_C(172), UINT8_C(148), UINT8_C(251), UINT8_C( 72), UINT8_C(129), UINT8_C(124), UINT8_C( 23) } },
+    { { UINT8_C(193), UINT8_C(178), UINT8_C(157), UINT8_C(240), UINT8_C(  1), UINT8_C(145), UINT8_C(244), UINT8_C(141),
+        UINT8_C( 54), UINT8_C( 36), UINT8_C( 94), UINT8_C(142), UINT8_C(147), UINT8_C(208), UINT8_C(183), UINT8_C(246) },
+      { UINT8_C(137), UINT8_C( 74), UINT8_C(208), UINT8_C( 53), UINT8_C(183), UINT8_C( 90), UINT8_C(128), UINT8_C( 21),
+        UINT8_C(161), UINT8_C( 14), UINT8_C(134), UINT8_C(163), UINT8_C(232), UINT8_C(163), UINT8_C(214), UINT8_C( 39) },
+      { UINT8_C(118), UINT8_C(238), UINT8_C( 92), UINT8_C(118), UINT8_C( 76), UINT8_C( 45), UINT8_C(171), UINT8_C( 67),
+        UINT8_C(185), UINT8_C(144), UINT8_C(153), UINT8_C( 17), UINT8_C(245), UINT8_C(181), UINT8_C(  1), UINT8_C(210) } },
+    { { UINT8_C(165), UINT8_C(170), UINT8_C(163), UINT8_C( 42), UINT8_C(210), UINT8_C(255), UINT8_C(220), UINT8_C(129),
+        UINT8_C( 46), UINT8_C(142), UINT8_C(191), UINT8_C( 36), UINT8_C(134), UINT8_C(163), UINT8_C(168), UINT8_C( 47) },
+      { UINT8_C( 73), UINT8_C( 31), UINT8_C( 79), UINT8_C(227), UINT8_C(200), UINT8_C( 57), UINT8_C(115), UINT8_C(189),
+        UINT8_C( 52), UINT8_C( 68), UINT8_C(220), UINT8_C(171), UINT8_C(224), UINT8_C( 81), UINT8_C(111), UINT8_C(119) },
+      { UINT8_C( 71), UINT8_C( 28), UINT8_C(230), UINT8_C(122), UINT8_C(227), UINT8_C( 82), UINT8_C(251), UINT8_C(161),
+        UINT8_C(139), UINT8_C(  8), UINT8_C(200), UINT8_C(205), UINT8_C(168), UINT8_C( 77), UINT8_C( 16), UINT8_C( 96) } },
+    { { UINT8_C(169), UINT8_C( 38), UINT8_C( 34), UINT8_C(244), UINT8_C( 43), UINT8_C( 23), UINT8_C( 97), UINT8_C( 55),
+        UINT8_C(149), UINT8_C(134), UINT8_C( 73), UINT8_C( 53), UINT8_C( 21), UINT8_C( 27), UINT8_C(241), UINT8_C(188) },
+      { UINT8_C(159), UINT8_C(246), UINT8_C(179), UINT8_C(248), UINT8_C(163), UINT8_C( 40), UINT8_C( 92), UINT8_C(180),
+        UINT8_C(155), UINT8_C(204), UINT8_C( 61), UINT8_C( 27), UINT8_C(185), UINT8_C(248), UINT8_C(129), UINT8_C(202) },
+      { UINT8_C( 21), UINT8_C( 16), UINT8_C(251), UINT8_C( 57), UINT8_C( 40), UINT8_C(142), UINT8_C( 88), UINT8_C( 71),
+        UINT8_C( 42), UINT8_C( 16), UINT8_C( 34), UINT8_C(175), UINT8_C(239), UINT8_C(218), UINT8_C( 25), UINT8_C(183) } },
+    { { UINT8_C(  5), UINT8_C(103), UINT8_C(163), UINT8_C(116), UINT8_C(  8), UINT8_C(160), UINT8_C( 21), UINT8_C(101),
+        UINT8_C( 63), UINT8_C(227), UINT8_C(200), UINT8_C( 81), UINT8_C(161), UINT8_C( 56), UINT8_C(242), UINT8_C(127) },
+      { UINT8_C(197), UINT8_C(204), UINT8_C( 65), UINT8_C( 81), UINT8_C(175), UINT8_C( 58), UINT8_C(208), UINT8_C(113),
+        UINT8_C(141), UINT8_C(232), UINT8_C(145), UINT8_C( 86), UINT8_C(118), UINT8_C(166), UINT8_C( 65), UINT8_C(105) },
+      { UINT8_C( 74), UINT8_C( 57), UINT8_C(211), UINT8_C(244), UINT8_C( 40), UINT8_C( 76), UINT8_C(117), UINT8_C(228),
+        UINT8_C(178), UINT8_C(230), UINT8_C( 10), UINT8_C(132), UINT8_C( 22), UINT8_C(162), UINT8_C( 77), UINT8_C( 88) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i round_key = simde_mm_loadu_si128(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesdec_si128(a, round_key);
+    simde_test_x86_assert_equal_u8x16(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesdeclast_si128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t round_key[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C( 13), UINT8_C(203), UINT8_C(250), UINT8_C( 49), UINT8_C(163), UINT8_C(138), UINT8_C( 89), UINT8_C(105),
+        UINT8_C( 79), UINT8_C(171), UINT8_C(108), UINT8_C(218), UINT8_C( 69), UINT8_C(175), UINT8_C(124), UINT8_C(212) },
+      { UINT8_C(147), UINT8_C(248), UINT8_C(133), UINT8_C(134), UINT8_C( 19), UINT8_C(253), UINT8_C( 78), UINT8_C(  0),
+        UINT8_C( 60), UINT8_C( 80), UINT8_C(206), UINT8_C(203), UINT8_C(104), UINT8_C(246), UINT8_C( 83), UINT8_C(221) },
+      { UINT8_C( 96), UINT8_C(227), UINT8_C( 61), UINT8_C( 98), UINT8_C( 98), UINT8_C(164), UINT8_C( 79), UINT8_C(122),
+        UINT8_C(174), UINT8_C(159), UINT8_C(218), UINT8_C(210), UINT8_C(  0), UINT8_C(248), UINT8_C( 70), UINT8_C(243) } },
+    { { UINT8_C(136), UINT8_C( 65), UINT8_C( 95), UINT8_C(221), UINT8_C(208), UINT8_C(213), UINT8_C(136), UINT8_C(119),
+        UINT8_C( 59), UINT8_C(173), UINT8_C(144), UINT8_C(243), UINT8_C(124), UINT8_C( 26), UINT8_C( 86), UINT8_C(  2) },
+      { UINT8_C(154), UINT8_C( 79), UINT8_C( 97), UINT8_C( 71), UINT8_C(215), UINT8_C(164), UINT8_C(243), UINT8_C(146),
+        UINT8_C(111), UINT8_C(165), UINT8_C(  0), UINT8_C( 66), UINT8_C( 36), UINT8_C(224), UINT8_C( 37), UINT8_C(255) },
+      { UINT8_C( 13), UINT8_C( 12), UINT8_C(247), UINT8_C( 69), UINT8_C(183), UINT8_C( 92), UINT8_C( 74), UINT8_C(236),
+        UINT8_C( 38), UINT8_C( 16), UINT8_C(132), UINT8_C( 40), UINT8_C( 37), UINT8_C(248), UINT8_C(178), UINT8_C( 54) } },
+    { { UINT8_C(154), UINT8_C(209), UINT8_C(204), UINT8_C( 27), UINT8_C( 19), UINT8_C(125), UINT8_C(151), UINT8_C(202),
+        UINT8_C(181), UINT8_C( 92), UINT8_C( 78), UINT8_C(150), UINT8_C(231), UINT8_C(246), UINT8_C(  9), UINT8_C( 97) },
+      { UINT8_C(107), UINT8_C( 95), UINT8_C( 81), UINT8_C(119), UINT8_C( 31), UINT8_C(127), UINT8_C(227), UINT8_C(190),
+        UINT8_C(247), UINT8_C(  2), UINT8_C(226), UINT8_C(243), UINT8_C( 54), UINT8_C(198), UINT8_C(147), UINT8_C( 26) },
+      { UINT8_C( 92), UINT8_C(137), UINT8_C(231), UINT8_C(103), UINT8_C(157), UINT8_C( 46), UINT8_C(163), UINT8_C(139),
+        UINT8_C( 37), UINT8_C( 17), UINT8_C(197), UINT8_C( 43), UINT8_C(134), UINT8_C( 97), UINT8_C( 22), UINT8_C( 94) } },
+    { { UINT8_C( 12), UINT8_C(208), UINT8_C(163), UINT8_C(180), UINT8_C( 77), UINT8_C( 65), UINT8_C( 31), UINT8_C(207),
+        UINT8_C(174), UINT8_C(115), UINT8_C(219), UINT8_C(  2), UINT8_C(100), UINT8_C(110), UINT8_C(172), UINT8_C( 77) },
+      { UINT8_C( 13), UINT8_C(173), UINT8_C( 58), UINT8_C( 12), UINT8_C( 38), UINT8_C(218), UINT8_C( 73), UINT8_C(247),
+        UINT8_C(210), UINT8_C(165), UINT8_C(178), UINT8_C(113), UINT8_C( 21), UINT8_C( 21), UINT8_C( 87), UINT8_C(169) },
+      { UINT8_C(140), UINT8_C(232), UINT8_C(165), UINT8_C( 83), UINT8_C( 67), UINT8_C(186), UINT8_C(227), UINT8_C(157),
+        UINT8_C(108), UINT8_C( 93), UINT8_C(195), UINT8_C( 20), UINT8_C(153), UINT8_C(154), UINT8_C(156), UINT8_C(111) } },
+    { { UINT8_C(242), UINT8_C(149), UINT8_C(228), UINT8_C( 93), UINT8_C(147), UINT8_C( 28), UINT8_C( 74), UINT8_C(210),
+        UINT8_C(127), UINT8_C( 97), UINT8_C(127), UINT8_C( 19), UINT8_C(181), UINT8_C(248), UINT8_C(113), UINT8_C(115) },
+      { UINT8_C(213), UINT8_C(190), UINT8_C( 95), UINT8_C( 71), UINT8_C(133), UINT8_C(162), UINT8_C(103), UINT8_C(139),
+        UINT8_C(126), UINT8_C( 84), UINT8_C( 38), UINT8_C(206), UINT8_C(221), UINT8_C( 38), UINT8_C( 94), UINT8_C(  8) },
+      { UINT8_C(209), UINT8_C( 95), UINT8_C( 52), UINT8_C( 56), UINT8_C(167), UINT8_C( 15), UINT8_C( 75), UINT8_C(  9),
+        UINT8_C( 21), UINT8_C(144), UINT8_C(136), UINT8_C( 65), UINT8_C( 15), UINT8_C(254), UINT8_C(  2), UINT8_C(133) } },
+    { { UINT8_C(  4), UINT8_C(192), UINT8_C( 41), UINT8_C(109), UINT8_C( 65), UINT8_C(127), UINT8_C(161), UINT8_C(222),
+        UINT8_C(245), UINT8_C(226), UINT8_C( 19), UINT8_C(119), UINT8_C( 17), UINT8_C(117), UINT8_C(241), UINT8_C(104) },
+      { UINT8_C(108), UINT8_C(176), UINT8_C(153), UINT8_C(144), UINT8_C(247), UINT8_C(204), UINT8_C(187), UINT8_C(206),
+        UINT8_C( 73), UINT8_C(167), UINT8_C(184), UINT8_C(167), UINT8_C( 66), UINT8_C( 60), UINT8_C( 10), UINT8_C(252) },
+      { UINT8_C( 92), UINT8_C(143), UINT8_C( 27), UINT8_C( 12), UINT8_C( 15), UINT8_C(211), UINT8_C(144), UINT8_C(204),
+        UINT8_C( 62), UINT8_C(204), UINT8_C(244), UINT8_C( 80), UINT8_C(161), UINT8_C(  7), UINT8_C(251), UINT8_C( 79) } },
+    { { UINT8_C(125), UINT8_C(103), UINT8_C(199), UINT8_C(108), UINT8_C( 58), UINT8_C(114), UINT8_C(104), UINT8_C( 54),
+        UINT8_C(106), UINT8_C(214), UINT8_C(177), UINT8_C(  6), UINT8_C(242), UINT8_C( 21), UINT8_C(149), UINT8_C(  8) },
+      { UINT8_C( 74), UINT8_C( 58), UINT8_C(188), UINT8_C(147), UINT8_C(188), UINT8_C(211), UINT8_C(134), UINT8_C( 17),
+        UINT8_C(145), UINT8_C(120), UINT8_C(242), UINT8_C( 47), UINT8_C(227), UINT8_C( 80), UINT8_C( 24), UINT8_C(138) },
+      { UINT8_C( 89), UINT8_C( 21), UINT8_C(234), UINT8_C(183), UINT8_C( 30), UINT8_C(217), UINT8_C( 43), UINT8_C(180),
+        UINT8_C(201), UINT8_C(102), UINT8_C(195), UINT8_C(144), UINT8_C(231), UINT8_C( 26), UINT8_C(239), UINT8_C( 50) } },
+    { { UINT8_C( 83), UINT8_C(173), UINT8_C(204), UINT8_C( 95), UINT8_C(145), UINT8_C( 96), UINT8_C(140), UINT8_C(245),
+        UINT8_C(196), UINT8_C( 55), UINT8_C(199), UINT8_C(116), UINT8_C(164), UINT8_C(239), UINT8_C(108), UINT8_C(240) },
+      { UINT8_C(159), UINT8_C( 64), UINT8_C( 40), UINT8_C(208), UINT8_C(215), UINT8_C(220), UINT8_C( 69), UINT8_C(205),
+        UINT8_C( 24), UINT8_C(150), UINT8_C(207), UINT8_C( 50), UINT8_C( 20), UINT8_C(214), UINT8_C(111), UINT8_C(203) },
+      { UINT8_C(207), UINT8_C( 33), UINT8_C( 25), UINT8_C(167), UINT8_C(123), UINT8_C(196), UINT8_C(253), UINT8_C(  7),
+        UINT8_C(144), UINT8_C(  6), UINT8_C(232), UINT8_C( 37), UINT8_C(  9), UINT8_C(100), UINT8_C(159), UINT8_C( 79) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i round_key = simde_mm_loadu_si128(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesdeclast_si128(a, round_key);
+    simde_test_x86_assert_equal_u8x16(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesimc_si128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C( 64), UINT8_C(234), UINT8_C(223), UINT8_C(128), UINT8_C( 63), UINT8_C(175), UINT8_C( 20), UINT8_C(218),
+        UINT8_C(247), UINT8_C( 32), UINT8_C( 78), UINT8_C(148), UINT8_C( 77), UINT8_C(141), UINT8_C( 22), UINT8_C(160) },
+      { UINT8_C( 89), UINT8_C( 47), UINT8_C( 55), UINT8_C(180), UINT8_C( 48), UINT8_C(149), UINT8_C(167), UINT8_C( 92),
+        UINT8_C(245), UINT8_C(127), UINT8_C( 86), UINT8_C(209), UINT8_C( 74), UINT8_C(255), UINT8_C(253), UINT8_C( 62) } },
+    { { UINT8_C(105), UINT8_C(147), UINT8_C(136), UINT8_C(221), UINT8_C( 80), UINT8_C( 80), UINT8_C( 38), UINT8_C(218),
+        UINT8_C(241), UINT8_C( 50), UINT8_C(244), UINT8_C( 93), UINT8_C(129), UINT8_C(  6), UINT8_C( 80), UINT8_C(122) },
+      { UINT8_C(143), UINT8_C( 38), UINT8_C( 43), UINT8_C( 45), UINT8_C(206), UINT8_C(255), UINT8_C( 91), UINT8_C(150),
+        UINT8_C(111), UINT8_C( 21), UINT8_C(190), UINT8_C(174), UINT8_C( 79), UINT8_C(243), UINT8_C(223), UINT8_C(206) } },
+    { { UINT8_C(190), UINT8_C( 35), UINT8_C(247), UINT8_C(104), UINT8_C(232), UINT8_C(219), UINT8_C(  4), UINT8_C(210),
+        UINT8_C(159), UINT8_C( 38), UINT8_C(194), UINT8_C(177), UINT8_C(232), UINT8_C( 95), UINT8_C(165), UINT8_C(120) },
+      { UINT8_C(178), UINT8_C(181), UINT8_C(255), UINT8_C(250), UINT8_C(159), UINT8_C(214), UINT8_C(162), UINT8_C( 14),
+        UINT8_C( 89), UINT8_C( 95), UINT8_C(139), UINT8_C( 71), UINT8_C(165), UINT8_C( 59), UINT8_C( 60), UINT8_C(200) } },
+    { { UINT8_C(158), UINT8_C( 57), UINT8_C( 25), UINT8_C(149), UINT8_C(244), UINT8_C( 75), UINT8_C( 45), UINT8_C( 91),
+        UINT8_C(217), UINT8_C( 98), UINT8_C(170), UINT8_C( 75), UINT8_C(191), UINT8_C(176), UINT8_C(235), UINT8_C(208) },
+      { UINT8_C(137), UINT8_C(151), UINT8_C( 88), UINT8_C(109), UINT8_C(  3), UINT8_C( 28), UINT8_C( 83), UINT8_C(133),
+        UINT8_C(223), UINT8_C(241), UINT8_C( 24), UINT8_C(108), UINT8_C(101), UINT8_C( 18), UINT8_C( 89), UINT8_C( 26) } },
+    { { UINT8_C(127), UINT8_C(203), UINT8_C(254), UINT8_C(127), UINT8_C(173), UINT8_C(182), UINT8_C(227), UINT8_C( 82),
+        UINT8_C( 28), UINT8_C(248), UINT8_C(121), UINT8_C(253), UINT8_C(154), UINT8_C(181), UINT8_C(108), UINT8_C( 48) },
+      { UINT8_C(184), UINT8_C(193), UINT8_C( 83), UINT8_C( 31), UINT8_C( 53), UINT8_C( 44), UINT8_C( 52), UINT8_C(135),
+        UINT8_C( 13), UINT8_C(184), UINT8_C(168), UINT8_C(125), UINT8_C(247), UINT8_C(248), UINT8_C(231), UINT8_C(155) } },
+    { { UINT8_C(112), UINT8_C(152), UINT8_C(183), UINT8_C(  8), UINT8_C(  8), UINT8_C(208), UINT8_C(199), UINT8_C( 24),
+        UINT8_C(184), UINT8_C(157), UINT8_C(194), UINT8_C( 39), UINT8_C(225), UINT8_C(146), UINT8_C(105), UINT8_C( 87) },
+      { UINT8_C( 83), UINT8_C(105), UINT8_C( 58), UINT8_C( 87), UINT8_C(141), UINT8_C(204), UINT8_C( 76), UINT8_C( 10),
+        UINT8_C(155), UINT8_C(103), UINT8_C(122), UINT8_C( 70), UINT8_C(  2), UINT8_C( 85), UINT8_C( 16), UINT8_C( 10) } },
+    { { UINT8_C(169), UINT8_C(144), UINT8_C( 17), UINT8_C(119), UINT8_C( 81), UINT8_C(183), UINT8_C(  8), UINT8_C(168),
+        UINT8_C( 61), UINT8_C( 55), UINT8_C( 95), UINT8_C( 79), UINT8_C(113), UINT8_C(241), UINT8_C( 42), UINT8_C( 64) },
+      { UINT8_C(156), UINT8_C(169), UINT8_C(154), UINT8_C(240), UINT8_C(185), UINT8_C(238), UINT8_C(108), UINT8_C(125),
+        UINT8_C(112), UINT8_C(214), UINT8_C( 38), UINT8_C(154), UINT8_C(230), UINT8_C( 85), UINT8_C(114), UINT8_C( 43) } },
+    { { UINT8_C(104), UINT8_C( 18), UINT8_C(192), UINT8_C( 31), UINT8_C(227), UINT8_C(112), UINT8_C(216), UINT8_C(  1),
+        UINT8_C(183), UINT8_C( 86), UINT8_C( 82), UINT8_C(  4), UINT8_C(222), UINT8_C( 79), UINT8_C(169), UINT8_C( 96) },
+      { UINT8_C(240), UINT8_C( 99), UINT8_C(  9), UINT8_C( 63), UINT8_C( 30), UINT8_C(200), UINT8_C(177), UINT8_C( 45),
+        UINT8_C(175), UINT8_C(117), UINT8_C( 63), UINT8_C( 82), UINT8_C(142), UINT8_C(138), UINT8_C( 73), UINT8_C( 21) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i r = simde_mm_aesimc_si128(a);
+    simde_test_x86_assert_equal_u8x16(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aeskeygenassist_si128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C(236), UINT8_C( 95), UINT8_C( 63), UINT8_C(  7), UINT8_C( 29), UINT8_C( 13), UINT8_C( 17), UINT8_C(199),
+        UINT8_C( 64), UINT8_C(114), UINT8_C(236), UINT8_C(243), UINT8_C(  6), UINT8_C(  6), UINT8_C(204), UINT8_C(113) },
+      { UINT8_C(164), UINT8_C(215), UINT8_C(130), UINT8_C(198), UINT8_C(214), UINT8_C(130), UINT8_C(198), UINT8_C(164),
+        UINT8_C(111), UINT8_C(111), UINT8_C( 75), UINT8_C(163), UINT8_C(110), UINT8_C( 75), UINT8_C(163), UINT8_C(111) } },
+    { { UINT8_C(163), UINT8_C( 74), UINT8_C( 82), UINT8_C(204), UINT8_C( 59), UINT8_C(163), UINT8_C( 22), UINT8_C( 42),
+        UINT8_C( 18), UINT8_C( 90), UINT8_C( 38), UINT8_C( 44), UINT8_C( 80), UINT8_C( 54), UINT8_C(238), UINT8_C(103) },
+      { UINT8_C(226), UINT8_C( 10), UINT8_C( 71), UINT8_C(229), UINT8_C( 17), UINT8_C( 71), UINT8_C(229), UINT8_C(226),
+        UINT8_C( 83), UINT8_C(  5), UINT8_C( 40), UINT8_C(133), UINT8_C( 30), UINT8_C( 40), UINT8_C(133), UINT8_C( 83) } },
+    { { UINT8_C(151), UINT8_C(108), UINT8_C(144), UINT8_C(183), UINT8_C(222), UINT8_C( 93), UINT8_C(227), UINT8_C(174),
+        UINT8_C( 15), UINT8_C( 53), UINT8_C(115), UINT8_C(219), UINT8_C(172), UINT8_C(241), UINT8_C(166), UINT8_C(191) },
+      { UINT8_C( 29), UINT8_C( 76), UINT8_C( 17), UINT8_C(228), UINT8_C(122), UINT8_C( 17), UINT8_C(228), UINT8_C( 29),
+        UINT8_C(145), UINT8_C(161), UINT8_C( 36), UINT8_C(  8), UINT8_C(151), UINT8_C( 36), UINT8_C(  8), UINT8_C(145) } },
+    { { UINT8_C(248), UINT8_C( 65), UINT8_C(153), UINT8_C(226), UINT8_C(  7), UINT8_C(177), UINT8_C( 96), UINT8_C( 80),
+        UINT8_C( 12), UINT8_C( 76), UINT8_C( 78), UINT8_C(184), UINT8_C( 57), UINT8_C( 33), UINT8_C( 63), UINT8_C(163) },
+      { UINT8_C(197), UINT8_C(200), UINT8_C(208), UINT8_C( 83), UINT8_C( 55), UINT8_C(208), UINT8_C( 83), UINT8_C(197),
+        UINT8_C( 18), UINT8_C(253), UINT8_C(117), UINT8_C( 10), UINT8_C(  2), UINT8_C(117), UINT8_C( 10), UINT8_C( 18) } },
+    { { UINT8_C(240), UINT8_C( 31), UINT8_C(  5), UINT8_C( 71), UINT8_C( 39), UINT8_C( 89), UINT8_C(179), UINT8_C(244),
+        UINT8_C(181), UINT8_C(154), UINT8_C( 65), UINT8_C(149), UINT8_C( 94), UINT8_C(114), UINT8_C(136), UINT8_C(193) },
+      { UINT8_C(204), UINT8_C(203), UINT8_C(109), UINT8_C(191), UINT8_C(202), UINT8_C(109), UINT8_C(191), UINT8_C(204),
+        UINT8_C( 88), UINT8_C( 64), UINT8_C(196), UINT8_C(120), UINT8_C( 65), UINT8_C(196), UINT8_C(120), UINT8_C( 88) } },
+    { { UINT8_C(140), UINT8_C(  3), UINT8_C(175), UINT8_C(120), UINT8_C(130), UINT8_C( 15), UINT8_C( 77), UINT8_C( 65),
+        UINT8_C( 45), UINT8_C( 79), UINT8_C( 59), UINT8_C( 65), UINT8_C( 55), UINT8_C( 35), UINT8_C(211), UINT8_C( 92) },
+      { UINT8_C( 19), UINT8_C(118), UINT8_C(227), UINT8_C(131), UINT8_C(109), UINT8_C(227), UINT8_C(131), UINT8_C( 19),
+        UINT8_C(154), UINT8_C( 38), UINT8_C(102), UINT8_C( 74), UINT8_C( 61), UINT8_C(102), UINT8_C( 74), UINT8_C(154) } },
+    { { UINT8_C(142), UINT8_C(225), UINT8_C(190), UINT8_C( 69), UINT8_C(135), UINT8_C(244), UINT8_C(145), UINT8_C(162),
+        UINT8_C(175), UINT8_C(242), UINT8_C( 79), UINT8_C(193), UINT8_C(218), UINT8_C( 53), UINT8_C(131), UINT8_C( 14) },
+      { UINT8_C( 23), UINT8_C(191), UINT8_C(129), UINT8_C( 58), UINT8_C(137), UINT8_C(129), UINT8_C( 58), UINT8_C( 23),
+        UINT8_C( 87), UINT8_C(150), UINT8_C(236), UINT8_C(171), UINT8_C(160), UINT8_C(236), UINT8_C(171), UINT8_C( 87) } },
+    { { UINT8_C( 72), UINT8_C(152), UINT8_C(255), UINT8_C(210), UINT8_C( 73), UINT8_C(219), UINT8_C(240), UINT8_C(191),
+        UINT8_C( 60), UINT8_C(228), UINT8_C( 59), UINT8_C( 51), UINT8_C(147), UINT8_C( 98), UINT8_C( 70), UINT8_C( 58) },
+      { UINT8_C( 59), UINT8_C(185), UINT8_C(140), UINT8_C(  8), UINT8_C( 70), UINT8_C(140), UINT8_C(  8), UINT8_C( 59),
+        UINT8_C(220), UINT8_C(170), UINT8_C( 90), UINT8_C(128), UINT8_C( 85), UINT8_C( 90), UINT8_C(128), UINT8_C(220) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i r;
+
+    switch (i & 3) {
+      case 0:
+        r = simde_mm_aeskeygenassist_si128(a, 0x01);
+        break;
+      case 1:
+        r = simde_mm_aeskeygenassist_si128(a, 0x1b);
+        break;
+      case 2:
+        r = simde_mm_aeskeygenassist_si128(a, 0x36);
+        break;
+      case 3:
+        r = simde_mm_aeskeygenassist_si128(a, 0xff);
+        break;
+      default:
+        HEDLEY_UNREACHABLE();
+    }
+
+    simde_test_x86_assert_equal_u8x16(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesenc_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[32];
+    uint8_t round_key[32];
+    uint8_t r[32];
+  } test_vec[] = {
+    { { UINT8_C(150), UINT8_C(181), UINT8_C( 28), UINT8_C(148), UINT8_C( 33), UINT8_C( 19), UINT8_C(227), UINT8_C( 18),
+        UINT8_C( 58), UINT8_C(178), UINT8_C( 45), UINT8_C(129), UINT8_C(240), UINT8_C( 57), UINT8_C( 77), UINT8_C( 61),
+        UINT8_C(177), UINT8_C( 46), UINT8_C(184), UINT8_C( 53), UINT8_C( 25), UINT8_C(137), UINT8_C(242), UINT8_C(117),
+        UINT8_C(133), UINT8_C(144), UINT8_C( 67), UINT8_C(217), UINT8_C( 12), UINT8_C( 22), UINT8_C(236), UINT8_C(249) },
+      { UINT8_C(242), UINT8_C(151), UINT8_C(192), UINT8_C( 61), UINT8_C(243), UINT8_C(222), UINT8_C( 85), UINT8_C(175),
+        UINT8_C( 46), UINT8_C(194), UINT8_C(135), UINT8_C(202), UINT8_C(231), UINT8_C(110), UINT8_C( 54), UINT8_C( 90),
+        UINT8_C(148), UINT8_C(141), UINT8_C(184), UINT8_C(121), UINT8_C(179), UINT8_C(164), UINT8_C( 85), UINT8_C(107),
+        UINT8_C( 51), UINT8_C(  7), UINT8_C(199), UINT8_C(242), UINT8_C(225), UINT8_C( 60), UINT8_C( 90), UINT8_C(250) },
+      { UINT8_C(177), UINT8_C(169), UINT8_C(239), UINT8_C(125), UINT8_C(138), UINT8_C( 81), UINT8_C( 36), UINT8_C( 35),
+        UINT8_C( 86), UINT8_C( 16), UINT8_C(118), UINT8_C( 86), UINT8_C(157), UINT8_C(108), UINT8_C( 89), UINT8_C(  9),
+        UINT8_C(110), UINT8_C(167), UINT8_C( 83), UINT8_C(174), UINT8_C(248), UINT8_C(111), UINT8_C(199), UINT8_C(149),
+        UINT8_C( 62), UINT8_C( 55), UINT8_C(115), UINT8_C( 90), UINT8_C(233), UINT8_C( 21), UINT8_C(195), UINT8_C( 49) } },
+    { { UINT8_C(121), UINT8_C(239), UINT8_C(240), UINT8_C(231), UINT8_C(  0), UINT8_C(130), UINT8_C(  5), UINT8_C(163),
+        UINT8_C( 20), UINT8_C(184), UINT8_C( 53), UINT8_C( 93), UINT8_C(141), UINT8_C( 36), UINT8_C( 20), UINT8_C( 70),
+        UINT8_C(176), UINT8_C( 21), UINT8_C(153), UINT8_C( 76), UINT8_C(216), UINT8_C(151), UINT8_C( 68), UINT8_C( 28),
+        UINT8_C( 94), UINT8_C(110), UINT8_C(204), UINT8_C(139), UINT8_C( 12), UINT8_C( 52), UINT8_C( 58), UINT8_C( 98) },
+      { UINT8_C( 48), UINT8_C( 68), UINT8_C( 52), UINT8_C(100), UINT8_C( 96), UINT8_C(134), UINT8_C(151), UINT8_C( 26),
+        UINT8_C(136), UINT8_C( 89), UINT8_C(105), UINT8_C( 35), UINT8_C( 95), UINT8_C(195), UINT8_C(178), UINT8_C(241),
+        UINT8_C(156), UINT8_C(185), UINT8_C(164), UINT8_C(205), UINT8_C( 74), UINT8_C(120), UINT8_C(206), UINT8_C( 45),
+        UINT8_C(253), UINT8_C( 10), UINT8_C( 32), UINT8_C( 80), UINT8_C(146), UINT8_C( 57), UINT8_C(145), UINT8_C(134) },
+      { UINT8_C(190), UINT8_C( 47), UINT8_C( 72), UINT8_C(148), UINT8_C(124), UINT8_C(188), UINT8_C(208), UINT8_C( 26),
+        UINT8_C(187), UINT8_C( 74), UINT8_C(184), UINT8_C(152), UINT8_C(184), UINT8_C(202), UINT8_C( 50), UINT8_C( 58),
+        UINT8_C( 43), UINT8_C( 34), UINT8_C(184), UINT8_C(115), UINT8_C(155), UINT8_C(142), UINT8_C( 80), UINT8_C(195),
+        UINT8_C( 23), UINT8_C(215), UINT8_C( 24), UINT8_C(109), UINT8_C(184), UINT8_C(101), UINT8_C( 71), UINT8_C(167) } },
+    { { UINT8_C( 35), UINT8_C( 17), UINT8_C(149), UINT8_C(170), UINT8_C(207), UINT8_C( 26), UINT8_C(102), UINT8_C(210),
+        UINT8_C(241), UINT8_C( 68), UINT8_C(  2), UINT8_C(192), UINT8_C(241), UINT8_C(240), UINT8_C(197), UINT8_C(140),
+        UINT8_C(189), UINT8_C(218), UINT8_C(235), UINT8_C(206), UINT8_C(149), UINT8_C(176), UINT8_C(149), UINT8_C(172),
+        UINT8_C( 15), UINT8_C(133), UINT8_C(148), UINT8_C( 39), UINT8_C(171), UINT8_C( 36), UINT8_C(178), UINT8_C(235) },
+      { UINT8_C(200), UINT8_C( 79), UINT8_C(  3), UINT8_C(127), UINT8_C(245), UINT8_C(208), UINT8_C( 67), UINT8_C(151),
+        UINT8_C( 22), UINT8_C(126), UINT8_C(134), UINT8_C(  1), UINT8_C(217), UINT8_C( 86), UINT8_C( 54), UINT8_C( 42),
+        UINT8_C(234), UINT8_C(169), UINT8_C( 70), UINT8_C(182), UINT8_C( 81), UINT8_C( 51), UINT8_C(221), UINT8_C( 44),
+        UINT8_C(128), UINT8_C(177), UINT8_C( 20), UINT8_C(144), UINT8_C(189), UINT8_C(112), UINT8_C(  8), UINT8_C( 66) },
+      { UINT8_C(106), UINT8_C(203), UINT8_C(197), UINT8_C(  8), UINT8_C(221), UINT8_C( 49), UINT8_C(106), UINT8_C(236),
+        UINT8_C( 95), UINT8_C( 23), UINT8_C( 59), UINT8_C( 46), UINT8_C(148), UINT8_C(  7), UINT8_C(166), UINT8_C( 12),
+        UINT8_C(231), UINT8_C(137), UINT8_C(191), UINT8_C( 52), UINT8_C( 27), UINT8_C(254), UINT8_C(136), UINT8_C(255),
+        UINT8_C( 78), UINT8_C( 26), UINT8_C( 53), UINT8_C(236), UINT8_C(102), UINT8_C( 14), UINT8_C( 38), UINT8_C( 26) } },
+    { { UINT8_C(228), UINT8_C( 87), UINT8_C(177), UINT8_C(128), UINT8_C(253), UINT8_C(132), UINT8_C(143), UINT8_C(116),
+        UINT8_C(102), UINT8_C( 74), UINT8_C(  6), UINT8_C(190), UINT8_C(237), UINT8_C(136), UINT8_C( 21), UINT8_C( 23),
+        UINT8_C( 53), UINT8_C(141), UINT8_C( 78), UINT8_C( 96), UINT8_C(114), UINT8_C(186), UINT8_C(231), UINT8_C( 38),
+        UINT8_C(172), UINT8_C(131), UINT8_C( 16), UINT8_C(136), UINT8_C( 37), UINT8_C(135), UINT8_C(212), UINT8_C(239) },
+      { UINT8_C(230), UINT8_C(165), UINT8_C(158), UINT8_C(153), UINT8_C( 68), UINT8_C( 20), UINT8_C(  0), UINT8_C(188),
+        UINT8_C( 65), UINT8_C(137), UINT8_C(240), UINT8_C(239), UINT8_C(246), UINT8_C( 61), UINT8_C(111), UINT8_C(169),
+        UINT8_C( 36), UINT8_C( 82), UINT8_C(252), UINT8_C(111), UINT8_C(187), UINT8_C( 96), UINT8_C(252), UINT8_C( 37),
+        UINT8_C(159), UINT8_C( 42), UINT8_C( 64), UINT8_C(152), UINT8_C(193), UINT8_C(234), UINT8_C(239), UINT8_C(250) },
+      { UINT8_C( 74), UINT8_C( 51), UINT8_C(125), UINT8_C(233), UINT8_C( 25), UINT8_C(209), UINT8_C(124), UINT8_C( 78),
+        UINT8_C( 42), UINT8_C(248), UINT8_C( 33), UINT8_C(137), UINT8_C(108), UINT8_C(229), UINT8_C(110), UINT8_C( 57),
+        UINT8_C(  1), UINT8_C(173), UINT8_C(107), UINT8_C( 85), UINT8_C(140), UINT8_C(235), UINT8_C(171), UINT8_C(250),
+        UINT8_C( 71), UINT8_C( 19), UINT8_C(154), UINT8_C(253), UINT8_C(  8), UINT8_C( 12), UINT8_C(233), UINT8_C(225) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i round_key = simde_mm256_loadu_si256(test_vec[i].round_key);
+    simde__m256i r = simde_mm256_aesenc_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x32(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesenclast_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[32];
+    uint8_t round_key[32];
+    uint8_t r[32];
+  } test_vec[] = {
+    { { UINT8_C(125), UINT8_C(161), UINT8_C( 98), UINT8_C(212), UINT8_C( 47), UINT8_C(111), UINT8_C(115), UINT8_C(169),
+        UINT8_C(254), UINT8_C(109), UINT8_C( 65), UINT8_C(243), UINT8_C(110), UINT8_C( 58), UINT8_C(164), UINT8_C(211),
+        UINT8_C(114), UINT8_C(140), UINT8_C(253), UINT8_C( 66), UINT8_C( 40), UINT8_C(168), UINT8_C( 15), UINT8_C(179),
+        UINT8_C(164), UINT8_C(189), UINT8_C(154), UINT8_C(199), UINT8_C( 68), UINT8_C(202), UINT8_C(247), UINT8_C(190) },
+      { UINT8_C(253), UINT8_C(208), UINT8_C( 71), UINT8_C(223), UINT8_C(168), UINT8_C(165), UINT8_C(156), UINT8_C(141),
+        UINT8_C(100), UINT8_C( 78), UINT8_C( 62), UINT8_C(146), UINT8_C( 55), UINT8_C(239), UINT8_C(136), UINT8_C(235),
+        UINT8_C(180), UINT8_C(115), UINT8_C( 51), UINT8_C(179), UINT8_C( 50), UINT8_C( 22), UINT8_C(100), UINT8_C(130),
+        UINT8_C( 69), UINT8_C(115), UINT8_C( 19), UINT8_C(225), UINT8_C( 66), UINT8_C(192), UINT8_C( 31), UINT8_C(171) },
+      { UINT8_C(  2), UINT8_C(120), UINT8_C(196), UINT8_C(185), UINT8_C(189), UINT8_C(153), UINT8_C(213), UINT8_C(197),
+        UINT8_C(223), UINT8_C(206), UINT8_C(148), UINT8_C( 65), UINT8_C(168), UINT8_C(221), UINT8_C(  7), UINT8_C(230),
+        UINT8_C(244), UINT8_C(177), UINT8_C(139), UINT8_C( 29), UINT8_C(  6), UINT8_C(108), UINT8_C( 12), UINT8_C(174),
+        UINT8_C( 12), UINT8_C(  7), UINT8_C( 71), UINT8_C(140), UINT8_C( 89), UINT8_C(164), UINT8_C(105), UINT8_C(109) } },
+    { { UINT8_C( 36), UINT8_C( 48), UINT8_C( 40), UINT8_C(230), UINT8_C( 77), UINT8_C( 51), UINT8_C(233), UINT8_C(198),
+        UINT8_C(169), UINT8_C( 76), UINT8_C(244), UINT8_C(143), UINT8_C(136), UINT8_C(151), UINT8_C(146), UINT8_C( 95),
+        UINT8_C( 43), UINT8_C(211), UINT8_C( 78), UINT8_C(234), UINT8_C(207), UINT8_C(218), UINT8_C(105), UINT8_C(231),
+        UINT8_C( 48), UINT8_C(180), UINT8_C(157), UINT8_C(168), UINT8_C( 45), UINT8_C(201), UINT8_C( 16), UINT8_C(232) },
+      { UINT8_C(209), UINT8_C(216), UINT8_C( 35), UINT8_C(177), UINT8_C(236), UINT8_C(233), UINT8_C( 20), UINT8_C(178),
+        UINT8_C( 75), UINT8_C(223), UINT8_C(102), UINT8_C(108), UINT8_C(146), UINT8_C( 85), UINT8_C( 31), UINT8_C(151),
+        UINT8_C(246), UINT8_C(149), UINT8_C(114), UINT8_C( 98), UINT8_C(164), UINT8_C(155), UINT8_C(242), UINT8_C( 77),
+        UINT8_C( 17), UINT8_C(141), UINT8_C(212), UINT8_C( 41), UINT8_C( 85), UINT8_C(177), UINT8_C(252), UINT8_C(135) },
+      { UINT8_C(231), UINT8_C( 27), UINT8_C(156), UINT8_C(126), UINT8_C( 15), UINT8_C(192), UINT8_C( 91), UINT8_C( 60),
+        UINT8_C(152), UINT8_C( 87), UINT8_C( 82), UINT8_C(216), UINT8_C( 86), UINT8_C( 81), UINT8_C(  1), UINT8_C(228),
+        UINT8_C(  7), UINT8_C(194), UINT8_C( 44), UINT8_C(249), UINT8_C( 46), UINT8_C( 22), UINT8_C( 56), UINT8_C(202),
+        UINT8_C( 21), UINT8_C( 80), UINT8_C(251), UINT8_C(189), UINT8_C(141), UINT8_C(215), UINT8_C(  5), UINT8_C( 69) } },
+    { { UINT8_C(100), UINT8_C( 88), UINT8_C(214), UINT8_C( 71), UINT8_C(205), UINT8_C( 76), UINT8_C(204), UINT8_C(181),
+        UINT8_C( 28), UINT8_C(226), UINT8_C(209), UINT8_C(196), UINT8_C( 17), UINT8_C( 47), UINT8_C(  7), UINT8_C(243),
+        UINT8_C( 14), UINT8_C(252), UINT8_C( 97), UINT8_C( 29), UINT8_C(159), UINT8_C( 80), UINT8_C( 58), UINT8_C( 66),
+        UINT8_C(152), UINT8_C(215), UINT8_C(172), UINT8_C(219), UINT8_C( 86), UINT8_C( 86), UINT8_C(150), UINT8_C(169) },
+      { UINT8_C(112), UINT8_C(158), UINT8_C(199), UINT8_C(104), UINT8_C(144), UINT8_C( 41), UINT8_C(153), UINT8_C( 52),
+        UINT8_C( 16), UINT8_C(122), UINT8_C(132), UINT8_C(131), UINT8_C(134), UINT8_C( 17), UINT8_C( 23), UINT8_C(189),
+        UINT8_C(236), UINT8_C( 87), UINT8_C(193), UINT8_C(104), UINT8_C( 66), UINT8_C(180), UINT8_C( 97), UINT8_C(243),
+        UINT8_C(194), UINT8_C(189), UINT8_C(110), UINT8_C(212), UINT8_C(169), UINT8_C( 46), UINT8_C(244), UINT8_C( 55) },
+      { UINT8_C( 51), UINT8_C(183), UINT8_C(249), UINT8_C(101), UINT8_C( 45), UINT8_C(177), UINT8_C( 92), UINT8_C(148),
+        UINT8_C(140), UINT8_C(111), UINT8_C(114), UINT8_C( 86), UINT8_C(  4), UINT8_C(123), UINT8_C( 92), UINT8_C(161),
+        UINT8_C( 71), UINT8_C(  4), UINT8_C( 80), UINT8_C(187), UINT8_C(153), UINT8_C(186), UINT8_C(241), UINT8_C( 87),
+        UINT8_C(132), UINT8_C( 12), UINT8_C(129), UINT8_C(248), UINT8_C( 24), UINT8_C(158), UINT8_C(116), UINT8_C(142) } },
+    { { UINT8_C(225), UINT8_C(172), UINT8_C(115), UINT8_C(221), UINT8_C( 48), UINT8_C( 94), UINT8_C(108), UINT8_C(180),
+        UINT8_C(159), UINT8_C( 24), UINT8_C(226), UINT8_C( 39), UINT8_C(193), UINT8_C(202), UINT8_C(215), UINT8_C( 14),
+        UINT8_C( 20), UINT8_C(176), UINT8_C( 53), UINT8_C(249), UINT8_C( 80), UINT8_C(138), UINT8_C( 81), UINT8_C(213),
+        UINT8_C(224), UINT8_C(229), UINT8_C(128), UINT8_C(127), UINT8_C(111), UINT8_C(143), UINT8_C(188), UINT8_C(217) },
+      { UINT8_C( 82), UINT8_C(244), UINT8_C( 95), UINT8_C( 53), UINT8_C(241), UINT8_C( 16), UINT8_C( 30), UINT8_C( 50),
+        UINT8_C(102), UINT8_C(238), UINT8_C( 63), UINT8_C(191), UINT8_C(160), UINT8_C(101), UINT8_C(157), UINT8_C( 54),
+        UINT8_C(234), UINT8_C(191), UINT8_C(150), UINT8_C(213), UINT8_C( 86), UINT8_C(102), UINT8_C( 86), UINT8_C( 74),
+        UINT8_C( 56), UINT8_C(168), UINT8_C( 39), UINT8_C( 13), UINT8_C(253), UINT8_C(184), UINT8_C( 77), UINT8_C( 95) },
+      { UINT8_C(170), UINT8_C(172), UINT8_C(199), UINT8_C(158), UINT8_C(245), UINT8_C(189), UINT8_C( 16), UINT8_C(243),
+        UINT8_C(189), UINT8_C(154), UINT8_C(176), UINT8_C( 50), UINT8_C(216), UINT8_C(244), UINT8_C(205), UINT8_C(250),
+        UINT8_C( 16), UINT8_C(193), UINT8_C( 91), UINT8_C(224), UINT8_C(  5), UINT8_C(191), UINT8_C( 51), UINT8_C(211),
+        UINT8_C(217), UINT8_C(219), UINT8_C(177), UINT8_C( 14), UINT8_C( 85), UINT8_C( 95), UINT8_C(156), UINT8_C(141) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i round_key = simde_mm256_loadu_si256(test_vec[i].round_key);
+    simde__m256i r = simde_mm256_aesenclast_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x32(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesdec_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[32];
+    uint8_t round_key[32];
+    uint8_t r[32];
+  } test_vec[] = {
+    { { UINT8_C(139), UINT8_C(232), UINT8_C(109), UINT8_C(197), UINT8_C(214), UINT8_C( 23), UINT8_C(173), UINT8_C( 78),
+        UINT8_C( 50), UINT8_C(176), UINT8_C(145), UINT8_C(160), UINT8_C(217), UINT8_C( 98), UINT8_C(  4), UINT8_C( 54),
+        UINT8_C(  0), UINT8_C( 32), UINT8_C(150), UINT8_C(127), UINT8_C( 79), UINT8_C(159), UINT8_C(174), UINT8_C(127),
+        UINT8_C(197), UINT8_C(230), UINT8_C( 87), UINT8_C(233), UINT8_C(196), UINT8_C(131), UINT8_C(152), UINT8_C(167) },
+      { UINT8_C(174), UINT8_C( 87), UINT8_C(223), UINT8_C(116), UINT8_C(142), UINT8_C(195), UINT8_C(236), UINT8_C(223),
+        UINT8_C(162), UINT8_C( 21), UINT8_C( 87), UINT8_C(235), UINT8_C(242), UINT8_C(201), UINT8_C( 44), UINT8_C( 90),
+        UINT8_C( 22), UINT8_C(140), UINT8_C( 23), UINT8_C(205), UINT8_C(158), UINT8_C( 61), UINT8_C(121), UINT8_C(  7),
+        UINT8_C(179), UINT8_C(104), UINT8_C(106), UINT8_C(  4), UINT8_C( 14), UINT8_C(172), UINT8_C(111), UINT8_C(103) },
+      { UINT8_C(147), UINT8_C( 44), UINT8_C(126), UINT8_C(236), UINT8_C( 52), UINT8_C(246), UINT8_C(221), UINT8_C(148),
+        UINT8_C( 73), UINT8_C( 14), UINT8_C(215), UINT8_C( 42), UINT8_C(202), UINT8_C( 17), UINT8_C(229), UINT8_C(117),
+        UINT8_C(177), UINT8_C(141), UINT8_C(103), UINT8_C(185), UINT8_C(173), UINT8_C( 57), UINT8_C(191), UINT8_C( 57),
+        UINT8_C(137), UINT8_C( 38), UINT8_C(211), UINT8_C( 28), UINT8_C( 59), UINT8_C( 30), UINT8_C( 39), UINT8_C(  0) } },
+    { { UINT8_C(117), UINT8_C( 69), UINT8_C(203), UINT8_C(120), UINT8_C(228), UINT8_C(249), UINT8_C( 96), UINT8_C( 98),
+        UINT8_C(112), UINT8_C(148), UINT8_C( 25), UINT8_C(101), UINT8_C(255), UINT8_C(120), UINT8_C(136), UINT8_C(149),
+        UINT8_C( 60), UINT8_C(138), UINT8_C( 15), UINT8_C(113), UINT8_C( 47), UINT8_C(229), UINT8_C(210), UINT8_C( 87),
+        UINT8_C(145), UINT8_C( 10), UINT8_C(204), UINT8_C(223), UINT8_C( 72), UINT8_C(232), UINT8_C( 25), UINT8_C( 23) },
+      { UINT8_C(149), UINT8_C(100), UINT8_C(132), UINT8_C(187), UINT8_C(184), UINT8_C( 99), UINT8_C(153), UINT8_C(194),
+        UINT8_C( 43), UINT8_C( 45), UINT8_C(189), UINT8_C(162), UINT8_C(159), UINT8_C( 60), UINT8_C( 94), UINT8_C( 92),
+        UINT8_C( 24), UINT8_C(216), UINT8_C(237), UINT8_C( 80), UINT8_C( 88), UINT8_C(150), UINT8_C(251), UINT8_C(146),
+        UINT8_C(247), UINT8_C( 54), UINT8_C(  4), UINT8_C(220), UINT8_C(223), UINT8_C(126), UINT8_C(164), UINT8_C(185) },
+      { UINT8_C(230), UINT8_C(209), UINT8_C(235), UINT8_C(201), UINT8_C(161), UINT8_C( 87), UINT8_C(120), UINT8_C(227),
+        UINT8_C(147), UINT8_C( 10), UINT8_C( 22), UINT8_C(219), UINT8_C(157), UINT8_C(100), UINT8_C( 60), UINT8_C(175),
+        UINT8_C(185), UINT8_C( 51), UINT8_C(182), UINT8_C( 25), UINT8_C(131), UINT8_C(250), UINT8_C( 59), UINT8_C(  5),
+        UINT8_C( 96), UINT8_C( 76), UINT8_C( 43), UINT8_C(228), UINT8_C( 96), UINT8_C(107), UINT8_C(248), UINT8_C(107) } },
+    { { UINT8_C(128), UINT8_C(211), UINT8_C( 34), UINT8_C(226), UINT8_C(  3), UINT8_C(159), UINT8_C(244), UINT8_C(127),
+        UINT8_C( 17), UINT8_C(185), UINT8_C( 54), UINT8_C(150), UINT8_C(127), UINT8_C(127), UINT8_C(117), UINT8_C(189),
+        UINT8_C(134), UINT8_C(215), UINT8_C(102), UINT8_C(248), UINT8_C(173), UINT8_C( 10), UINT8_C(120), UINT8_C( 90),
+        UINT8_C(  6), UINT8_C( 38), UINT8_C( 88), UINT8_C(186), UINT8_C(  5), UINT8_C( 97), UINT8_C( 65), UINT8_C(131) },
+      { UINT8_C(180), UINT8_C(187), UINT8_C( 38), UINT8_C(228), UINT8_C(255), UINT8_C(224), UINT8_C(247), UINT8_C( 26),
+        UINT8_C( 46), UINT8_C( 40), UINT8_C(136), UINT8_C( 59), UINT8_C(205), UINT8_C(108), UINT8_C( 68), UINT8_C(162),
+        UINT8_C( 57), UINT8_C(199), UINT8_C(248), UINT8_C(145), UINT8_C(102), UINT8_C( 48), UINT8_C(188), UINT8_C(113),
+        UINT8_C(179), UINT8_C(232), UINT8_C(221), UINT8_C( 96), UINT8_C(174), UINT8_C(119), UINT8_C( 81), UINT8_C(123) },
+      { UINT8_C(186), UINT8_C(160), UINT8_C( 10), UINT8_C(195), UINT8_C(188), UINT8_C(211), UINT8_C(178), UINT8_C( 89),
+        UINT8_C( 37), UINT8_C( 61), UINT8_C( 71), UINT8_C( 62), UINT8_C( 22), UINT8_C(122), UINT8_C( 44), UINT8_C( 54),
+        UINT8_C( 47), UINT8_C(186), UINT8_C( 84), UINT8_C( 74), UINT8_C(167), UINT8_C(139), UINT8_C(199), UINT8_C( 93),
+        UINT8_C(129), UINT8_C( 86), UINT8_C(170), UINT8_C( 15), UINT8_C(197), UINT8_C( 40), UINT8_C(167), UINT8_C(140) } },
+    { { UINT8_C(171), UINT8_C( 48), UINT8_C(128), UINT8_C( 33), UINT8_C( 61), UINT8_C(101), UINT8_C( 31), UINT8_C(123),
+        UINT8_C(177), UINT8_C(224), UINT8_C( 51), UINT8_C(135), UINT8_C(  2), UINT8_C(212), UINT8_C(137), UINT8_C(216),
+        UINT8_C(185), UINT8_C( 40), UINT8_C( 76), UINT8_C(178), UINT8_C(157), UINT8_C(198), UINT8_C(205), UINT8_C(160),
+        UINT8_C( 29), UINT8_C(207), UINT8_C(172), UINT8_C(145), UINT8_C(194), UINT8_C( 15), UINT8_C(191), UINT8_C(132) },
+      { UINT8_C(249), UINT8_C(118), UINT8_C(210), UINT8_C(217), UINT8_C(194), UINT8_C(223), UINT8_C(206), UINT8_C( 41),
+        UINT8_C(253), UINT8_C( 88), UINT8_C(208), UINT8_C( 35), UINT8_C(163), UINT8_C( 64), UINT8_C(122), UINT8_C( 74),
+        UINT8_C(214), UINT8_C(  1), UINT8_C(185), UINT8_C(106), UINT8_C(218), UINT8_C( 43), UINT8_C(167), UINT8_C( 74),
+        UINT8_C( 98), UINT8_C(248), UINT8_C( 51), UINT8_C( 79), UINT8_C( 93), UINT8_C(189), UINT8_C( 38), UINT8_C(126) },
+      { UINT8_C(173), UINT8_C( 54), UINT8_C( 10), UINT8_C(103), UINT8_C(132), UINT8_C(178), UINT8_C(220), UINT8_C(139),
+        UINT8_C(155), UINT8_C(213), UINT8_C( 59), UINT8_C(222), UINT8_C(115), UINT8_C(240), UINT8_C(255), UINT8_C(213),
+        UINT8_C(109), UINT8_C( 97), UINT8_C(242), UINT8_C( 55), UINT8_C( 49), UINT8_C( 99), UINT8_C( 80), UINT8_C(221),
+        UINT8_C(231), UINT8_C( 85), UINT8_C( 35), UINT8_C(124), UINT8_C(151), UINT8_C(239), UINT8_C( 86), UINT8_C(223) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i round_key = simde_mm256_loadu_si256(test_vec[i].round_key);
+    simde__m256i r = simde_mm256_aesdec_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x32(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesdeclast_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[32];
+    uint8_t round_key[32];
+    uint8_t r[32];
+  } test_vec[] = {
+    { { UINT8_C(142), UINT8_C(241), UINT8_C( 96), UINT8_C(  4), UINT8_C(222), UINT8_C(117), UINT8_C(161), UINT8_C(152),
+        UINT8_C(135), UINT8_C(172), UINT8_C(173), UINT8_C(168), UINT8_C(133), UINT8_C(140), UINT8_C(137), UINT8_C( 38),
+        UINT8_C(106), UINT8_C(116), UINT8_C( 16), UINT8_C( 18), UINT8_C( 76), UINT8_C(192), UINT8_C( 27), UINT8_C( 53),
+        UINT8_C( 97), UINT8_C(133), UINT8_C(110), UINT8_C(140), UINT8_C(251), UINT8_C( 90), UINT8_C( 48), UINT8_C( 84) },
+      { UINT8_C(190), UINT8_C(133), UINT8_C(174), UINT8_C( 45), UINT8_C(141), UINT8_C(230), UINT8_C(217), UINT8_C(122),
+        UINT8_C(188), UINT8_C(  7), UINT8_C(227), UINT8_C( 10), UINT8_C(  8), UINT8_C(180), UINT8_C( 29), UINT8_C( 95),
+        UINT8_C(105), UINT8_C(145), UINT8_C(232), UINT8_C( 39), UINT8_C(203), UINT8_C(188), UINT8_C(163), UINT8_C(104),
+        UINT8_C(  8), UINT8_C( 14), UINT8_C( 36), UINT8_C( 20), UINT8_C(132), UINT8_C( 25), UINT8_C(117), UINT8_C(205) },
+      { UINT8_C( 88), UINT8_C(117), UINT8_C(182), UINT8_C(207), UINT8_C( 17), UINT8_C(205), UINT8_C( 43), UINT8_C( 21),
+        UINT8_C( 86), UINT8_C( 56), UINT8_C(115), UINT8_C( 41), UINT8_C(111), UINT8_C( 30), UINT8_C(236), UINT8_C(111),
+        UINT8_C( 49), UINT8_C(215), UINT8_C(173), UINT8_C(254), UINT8_C(150), UINT8_C(118), UINT8_C(171), UINT8_C(152),
+        UINT8_C(208), UINT8_C( 17), UINT8_C( 88), UINT8_C(233), UINT8_C(231), UINT8_C(126), UINT8_C( 49), UINT8_C(244) } },
+    { { UINT8_C( 80), UINT8_C(170), UINT8_C(145), UINT8_C(168), UINT8_C(129), UINT8_C( 54), UINT8_C(204), UINT8_C( 69),
+        UINT8_C(131), UINT8_C( 14), UINT8_C( 32), UINT8_C(194), UINT8_C(167), UINT8_C(  6), UINT8_C( 96), UINT8_C(226),
+        UINT8_C(139), UINT8_C( 66), UINT8_C( 92), UINT8_C( 52), UINT8_C( 44), UINT8_C( 62), UINT8_C( 10), UINT8_C(118),
+        UINT8_C(166), UINT8_C(231), UINT8_C(178), UINT8_C( 47), UINT8_C(247), UINT8_C(224), UINT8_C( 41), UINT8_C(153) },
+      { UINT8_C( 56), UINT8_C(244), UINT8_C( 11), UINT8_C(253), UINT8_C( 22), UINT8_C( 76), UINT8_C(102), UINT8_C(  8),
+        UINT8_C(206), UINT8_C( 13), UINT8_C( 43), UINT8_C(163), UINT8_C( 68), UINT8_C( 36), UINT8_C( 80), UINT8_C(224),
+        UINT8_C(137), UINT8_C(158), UINT8_C(243), UINT8_C(224), UINT8_C( 69), UINT8_C(197), UINT8_C( 70), UINT8_C( 98),
+        UINT8_C(230), UINT8_C(151), UINT8_C( 86), UINT8_C(132), UINT8_C(189), UINT8_C( 90), UINT8_C( 84), UINT8_C(162) },
+      { UINT8_C( 84), UINT8_C( 81), UINT8_C( 95), UINT8_C(149), UINT8_C(135), UINT8_C( 46), UINT8_C(246), UINT8_C(160),
+        UINT8_C(143), UINT8_C( 41), UINT8_C(135), UINT8_C(152), UINT8_C(205), UINT8_C(243), UINT8_C(119), UINT8_C(143),
+        UINT8_C( 71), UINT8_C( 62), UINT8_C(205), UINT8_C(239), UINT8_C(  7), UINT8_C( 51), UINT8_C( 10), UINT8_C( 44),
+        UINT8_C( 35), UINT8_C( 70), UINT8_C(241), UINT8_C(125), UINT8_C(155), UINT8_C(234), UINT8_C(247), UINT8_C(138) } },
+    { { UINT8_C( 99), UINT8_C( 67), UINT8_C(115), UINT8_C(179), UINT8_C( 82), UINT8_C(144), UINT8_C(113), UINT8_C(143),
+        UINT8_C(194), UINT8_C(119), UINT8_C(129), UINT8_C(218), UINT8_C(181), UINT8_C(  0), UINT8_C(118), UINT8_C(120),
+        UINT8_C(196), UINT8_C( 25), UINT8_C(127), UINT8_C(107), UINT8_C(235), UINT8_C(184), UINT8_C( 27), UINT8_C(215),
+        UINT8_C(138), UINT8_C(157), UINT8_C( 26), UINT8_C( 40), UINT8_C( 64), UINT8_C(  6), UINT8_C( 58), UINT8_C(178) },
+      { UINT8_C( 71), UINT8_C(119), UINT8_C(159), UINT8_C( 48), UINT8_C( 90), UINT8_C(254), UINT8_C(185), UINT8_C( 78),
+        UINT8_C(130), UINT8_C(109), UINT8_C( 41), UINT8_C( 59), UINT8_C(209), UINT8_C(158), UINT8_C(139), UINT8_C( 74),
+        UINT8_C(192), UINT8_C(233), UINT8_C( 24), UINT8_C(144), UINT8_C(181), UINT8_C(188), UINT8_C(255), UINT8_C( 46),
+        UINT8_C(146), UINT8_C(245), UINT8_C(138), UINT8_C(141), UINT8_C( 46), UINT8_C(108), UINT8_C( 64), UINT8_C( 92) },
+      { UINT8_C( 71), UINT8_C( 37), UINT8_C( 14), UINT8_C( 67), UINT8_C( 18), UINT8_C(154), UINT8_C(182), UINT8_C( 52),
+        UINT8_C( 42), UINT8_C(251), UINT8_C(166), UINT8_C(250), UINT8_C(  3), UINT8_C(156), UINT8_C(167), UINT8_C(  1),
+        UINT8_C( 72), UINT8_C( 76), UINT8_C( 91), UINT8_C(157), UINT8_C(137), UINT8_C( 50), UINT8_C( 93), UINT8_C(192),
+        UINT8_C( 93), UINT8_C(111), UINT8_C(225), UINT8_C(179), UINT8_C( 92), UINT8_C( 25), UINT8_C(  4), UINT8_C( 89) } },
+    { { UINT8_C( 72), UINT8_C( 28), UINT8_C( 24), UINT8_C(192), UINT8_C(185), UINT8_C(140), UINT8_C( 37), UINT8_C(225),
+        UINT8_C(156), UINT8_C( 27), UINT8_C(227), UINT8_C(250), UINT8_C(  9), UINT8_C(127), UINT8_C( 31), UINT8_C(109),
+        UINT8_C( 67), UINT8_C(139), UINT8_C(250), UINT8_C( 63), UINT8_C(203), UINT8_C(144), UINT8_C(121), UINT8_C(109),
+        UINT8_C(159), UINT8_C(236), UINT8_C( 31), UINT8_C(237), UINT8_C(214), UINT8_C(135), UINT8_C( 88), UINT8_C( 54) },
+      { UINT8_C(246), UINT8_C(143), UINT8_C(128), UINT8_C(  7), UINT8_C( 39), UINT8_C(217), UINT8_C(200), UINT8_C( 75),
+        UINT8_C(215), UINT8_C(190), UINT8_C(231), UINT8_C(174), UINT8_C( 83), UINT8_C( 15), UINT8_C(139), UINT8_C(116),
+        UINT8_C( 56), UINT8_C(106), UINT8_C(162), UINT8_C( 95), UINT8_C(149), UINT8_C( 42), UINT8_C(110), UINT8_C(172),
+        UINT8_C(187), UINT8_C(190), UINT8_C(237), UINT8_C(158), UINT8_C(  5), UINT8_C( 69), UINT8_C(129), UINT8_C( 64) },
+      { UINT8_C( 34), UINT8_C(228), UINT8_C(205), UINT8_C(231), UINT8_C(252), UINT8_C( 29), UINT8_C(  3), UINT8_C( 95),
+        UINT8_C(203), UINT8_C( 78), UINT8_C(211), UINT8_C( 29), UINT8_C( 19), UINT8_C( 75), UINT8_C( 73), UINT8_C(107),
+        UINT8_C( 92), UINT8_C(128), UINT8_C(105), UINT8_C(236), UINT8_C(204), UINT8_C(228), UINT8_C( 48), UINT8_C(255),
+        UINT8_C(213), UINT8_C( 40), UINT8_C(249), UINT8_C(186), UINT8_C( 79), UINT8_C(198), UINT8_C( 46), UINT8_C(101) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i round_key = simde_mm256_loadu_si256(test_vec[i].round_key);
+    simde__m256i r = simde_mm256_aesdeclast_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x32(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesenc_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[64];
+    uint8_t round_key[64];
+    uint8_t r[64];
+  } test_vec[] = {
+    { { UINT8_C(144), UINT8_C( 19), UINT8_C(225), UINT8_C(176), UINT8_C(191), UINT8_C( 40), UINT8_C( 24), UINT8_C(214),
+        UINT8_C( 33), UINT8_C(  9), UINT8_C(145), UINT8_C(182), UINT8_C(193), UINT8_C(172), UINT8_C(157), UINT8_C(158),
+        UINT8_C( 27), UINT8_C( 35), UINT8_C(163), UINT8_C(178), UINT8_C( 85), UINT8_C(213), UINT8_C( 14), UINT8_C( 82),
+        UINT8_C(114), UINT8_C( 62), UINT8_C(182), UINT8_C( 25), UINT8_C(151), UINT8_C(  2), UINT8_C( 50), UINT8_C(184),
+        UINT8_C(225), UINT8_C(226), UINT8_C(197), UINT8_C(110), UINT8_C( 22), UINT8_C(166), UINT8_C(165), UINT8_C( 94),
+        UINT8_C(190), UINT8_C(193), UINT8_C( 90), UINT8_C(132), UINT8_C(141), UINT8_C(138), UINT8_C(197), UINT8_C( 30),
+        UINT8_C(134), UINT8_C(107), UINT8_C(131), UINT8_C(146), UINT8_C( 45), UINT8_C(191), UINT8_C(102), UINT8_C( 50),
+        UINT8_C(232), UINT8_C(  7), UINT8_C(247), UINT8_C( 62), UINT8_C(182), UINT8_C( 53), UINT8_C(161), UINT8_C(154) },
+      { UINT8_C(163), UINT8_C( 82), UINT8_C( 36), UINT8_C( 58), UINT8_C(156), UINT8_C( 67), UINT8_C(203), UINT8_C(220),
+        UINT8_C(253), UINT8_C(212), UINT8_C(  9), UINT8_C(205), UINT8_C( 32), UINT8_C(214), UINT8_C(243), UINT8_C(148),
+        UINT8_C(161), UINT8_C(204), UINT8_C( 97), UINT8_C( 39), UINT8_C(137), UINT8_C( 66), UINT8_C(104), UINT8_C( 14),
+        UINT8_C(124), UINT8_C( 50), UINT8_C(164), UINT8_C(255), UINT8_C(182), UINT8_C(193), UINT8_C(154), UINT8_C(231),
+        UINT8_C(138), UINT8_C(107), UINT8_C(201), UINT8_C(214), UINT8_C(153), UINT8_C( 84), UINT8_C( 98), UINT8_C(224),
+        UINT8_C(159), UINT8_C( 76), UINT8_C(226), UINT8_C(145), UINT8_C( 76), UINT8_C(186), UINT8_C(211), UINT8_C(194),
+        UINT8_C(151), UINT8_C(144), UINT8_C(245), UINT8_C(234), UINT8_C( 81), UINT8_C(103), UINT8_C(151), UINT8_C( 42),
+        UINT8_C( 14), UINT8_C(112), UINT8_C(198), UINT8_C(101), UINT8_C( 21), UINT8_C(255), UINT8_C(112), UINT8_C(138) },
+      { UINT8_C(181), UINT8_C(201), UINT8_C(116), UINT8_C( 57), UINT8_C( 54), UINT8_C( 76), UINT8_C( 76), UINT8_C( 78),
+        UINT8_C(186), UINT8_C(245), UINT8_C(143), UINT8_C( 79), UINT8_C(180), UINT8_C(246), UINT8_C(101), UINT8_C( 80),
+        UINT8_C(195), UINT8_C(219), UINT8_C(229), UINT8_C( 88), UINT8_C(179), UINT8_C(147), UINT8_C( 57), UINT8_C(238),
+        UINT8_C(111), UINT8_C(130), UINT8_C(135), UINT8_C( 66), UINT8_C(168), UINT8_C( 55), UINT8_C( 30), UINT8_C( 90),
+        UINT8_C(193), UINT8_C(112), UINT8_C(228), UINT8_C(187), UINT8_C(166), UINT8_C(141), UINT8_C(176), UINT8_C(210),
+        UINT8_C(164), UINT8_C(183), UINT8_C(141), UINT8_C( 16), UINT8_C( 28), UINT8_C(153), UINT8_C(251), UINT8_C(  5),
+        UINT8_C(215), UINT8_C(196), UINT8_C(186), UINT8_C( 45), UINT8_C(211), UINT8_C( 55), UINT8_C( 63), UINT8_C( 48),
+        UINT8_C( 77), UINT8_C(208), UINT8_C(109), UINT8_C(239), UINT8_C(137), UINT8_C(168), UINT8_C(234), UINT8_C(107) } },
+    { { UINT8_C( 41), UINT8_C(243), UINT8_C(232), UINT8_C(123), UINT8_C(115), UINT8_C(103), UINT8_C( 85), UINT8_C(219),
+        UINT8_C( 88), UINT8_C( 66), UINT8_C(176), UINT8_C( 47), UINT8_C( 65), UINT8_C( 17), UINT8_C(107), UINT8_C(211),
+        UINT8_C( 86), UINT8_C(242), UINT8_C( 81), UINT8_C( 89), UINT8_C(197), UINT8_C(164), UINT8_C( 89), UINT8_C(253),
+        UINT8_C( 34), UINT8_C(150), UINT8_C(223), UINT8_C(106), UINT8_C(218), UINT8_C(103), UINT8_C(147), UINT8_C( 64),
+        UINT8_C( 74), UINT8_C(114), UINT8_C( 58), UINT8_C(204), UINT8_C(119), UINT8_C(151), UINT8_C(192), UINT8_C( 99),
+        UINT8_C(201), UINT8_C( 36), UINT8_C( 50), UINT8_C(190), UINT8_C(239), UINT8_C(162), UINT8_C( 93), UINT8_C( 93),
+        UINT8_C( 15), UINT8_C(187), UINT8_C( 22), UINT8_C( 60), UINT8_C( 32), UINT8_C( 58), UINT8_C(122), UINT8_C(148),
+        UINT8_C(113), UINT8_C(117), UINT8_C(253), UINT8_C( 86), UINT8_C(150), UINT8_C(151), UINT8_C(190), UINT8_C( 79) },
+      { UINT8_C(157), UINT8_C(128), UINT8_C(221), UINT8_C(164), UINT8_C( 63), UINT8_C( 67), UINT8_C(105), UINT8_C(221),
+        UINT8_C(128), UINT8_C(229), UINT8_C(162), UINT8_C(  5), UINT8_C(187), UINT8_C(170), UINT8_C( 45), UINT8_C(167),
+        UINT8_C(170), UINT8_C(217), UINT8_C(246), UINT8_C(247), UINT8_C(148), UINT8_C( 13), UINT8_C( 19), UINT8_C(129),
+        UINT8_C(222), UINT8_C(175), UINT8_C(106), UINT8_C( 70), UINT8_C(200), UINT8_C(149), UINT8_C(240), UINT8_C(123),
+        UINT8_C(105), UINT8_C( 51), UINT8_C( 27), UINT8_C( 93), UINT8_C( 85), UINT8_C( 53), UINT8_C( 55), UINT8_C( 35),
+        UINT8_C( 29), UINT8_C(123), UINT8_C( 45), UINT8_C(167), UINT8_C( 78), UINT8_C(162), UINT8_C(119), UINT8_C( 15),
+        UINT8_C( 73), UINT8_C(211), UINT8_C(132), UINT8_C( 47), UINT8_C( 77), UINT8_C( 65), UINT8_C(125), UINT8_C(205),
+        UINT8_C(240), UINT8_C(183), UINT8_C(172), UINT8_C( 19), UINT8_C(253), UINT8_C(212), UINT8_C( 99), UINT8_C( 67) },
+      { UINT8_C(217), UINT8_C( 96), UINT8_C(130), UINT8_C(254), UINT8_C( 16), UINT8_C( 52), UINT8_C( 87), UINT8_C( 70),
+        UINT8_C(235), UINT8_C(159), UINT8_C(183), UINT8_C(203), UINT8_C( 88), UINT8_C( 57), UINT8_C(127), UINT8_C(226),
+        UINT8_C(159), UINT8_C( 74), UINT8_C( 50), UINT8_C(250), UINT8_C(127), UINT8_C( 36), UINT8_C(192), UINT8_C(177),
+        UINT8_C(242), UINT8_C( 17), UINT8_C( 57), UINT8_C( 20), UINT8_C( 47), UINT8_C(143), UINT8_C(165), UINT8_C(196),
+        UINT8_C( 50), UINT8_C(199), UINT8_C(215), UINT8_C( 15), UINT8_C(249), UINT8_C( 51), UINT8_C(177), UINT8_C(203),
+        UINT8_C(137), UINT8_C(178), UINT8_C(199), UINT8_C(140), UINT8_C( 63), UINT8_C(134), UINT8_C(110), UINT8_C(200),
+        UINT8_C(238), UINT8_C(198), UINT8_C( 77), UINT8_C(114), UINT8_C(193), UINT8_C(213), UINT8_C( 54), UINT8_C(241),
+        UINT8_C( 75), UINT8_C(244), UINT8_C(111), UINT8_C(102), UINT8_C(136), UINT8_C( 79), UINT8_C(126), UINT8_C(161) } },
+    { { UINT8_C(123), UINT8_C(165), UINT8_C(150), UINT8_C( 43), UINT8_C(129), UINT8_C(124), UINT8_C(216), UINT8_C(209),
+        UINT8_C(122), UINT8_C(118), UINT8_C(220), UINT8_C(109), UINT8_C(161), UINT8_C(210), UINT8_C(221), UINT8_C(152),
+        UINT8_C( 33), UINT8_C(229), UINT8_C( 98), UINT8_C(172), UINT8_C(163), UINT8_C( 74), UINT8_C( 90), UINT8_C(244),
+        UINT8_C(149), UINT8_C(226), UINT8_C( 83), UINT8_C(185), UINT8_C(102), UINT8_C(254), UINT8_C(103), UINT8_C(145),
+        UINT8_C(166), UINT8_C(203), UINT8_C( 92), UINT8_C( 52), UINT8_C( 76), UINT8_C( 52), UINT8_C( 54), UINT8_C(144),
+        UINT8_C(225), UINT8_C(248), UINT8_C(207), UINT8_C( 18), UINT8_C(164), UINT8_C(161), UINT8_C(216), UINT8_C(153),
+        UINT8_C(110), UINT8_C(102), UINT8_C( 48), UINT8_C(112), UINT8_C( 62), UINT8_C(  4), UINT8_C(150), UINT8_C(157),
+        UINT8_C( 94), UINT8_C(122), UINT8_C( 90), UINT8_C( 14), UINT8_C( 40), UINT8_C(214), UINT8_C(187), UINT8_C(186) },
+      { UINT8_C( 17), UINT8_C(215), UINT8_C( 52), UINT8_C( 92), UINT8_C( 20), UINT8_C(202), UINT8_C(133), UINT8_C(226),
+        UINT8_C(191), UINT8_C(166), UINT8_C(169), UINT8_C(102), UINT8_C( 92), UINT8_C(196), UINT8_C(  1), UINT8_C( 35),
+        UINT8_C(115), UINT8_C(213), UINT8_C( 22), UINT8_C( 20), UINT8_C( 44), UINT8_C(124), UINT8_C(142), UINT8_C(  9),
+        UINT8_C(175), UINT8_C(238), UINT8_C(  7), UINT8_C(183), UINT8_C(132), UINT8_C(241), UINT8_C(222), UINT8_C(133),
+        UINT8_C( 26), UINT8_C( 28), UINT8_C(188), UINT8_C(179), UINT8_C( 68), UINT8_C( 50), UINT8_C(212), UINT8_C(249),
+        UINT8_C(206), UINT8_C(111), UINT8_C(141), UINT8_C(234), UINT8_C( 53), UINT8_C(133), UINT8_C(200), UINT8_C(185),
+        UINT8_C(150), UINT8_C(177), UINT8_C( 66), UINT8_C( 40), UINT8_C(236), UINT8_C( 69), UINT8_C(165), UINT8_C(192),
+        UINT8_C(239), UINT8_C(124), UINT8_C( 48), UINT8_C(190), UINT8_C(249), UINT8_C( 88), UINT8_C(232), UINT8_C( 97) },
+      { UINT8_C(163), UINT8_C(  1), UINT8_C(216), UINT8_C( 37), UINT8_C(116), UINT8_C( 31), UINT8_C( 32), UINT8_C(246),
+        UINT8_C(122), UINT8_C(152), UINT8_C(191), UINT8_C( 74), UINT8_C(111), UINT8_C(101), UINT8_C(179), UINT8_C(106),
+        UINT8_C(159), UINT8_C( 50), UINT8_C(100), UINT8_C( 42), UINT8_C(159), UINT8_C( 88), UINT8_C(165), UINT8_C( 51),
+        UINT8_C( 56), UINT8_C(243), UINT8_C(  3), UINT8_C(189), UINT8_C(122), UINT8_C(228), UINT8_C(169), UINT8_C( 27),
+        UINT8_C( 30), UINT8_C( 99), UINT8_C(166), UINT8_C(138), UINT8_C(172), UINT8_C( 34), UINT8_C( 86), UINT8_C(146),
+        UINT8_C( 89), UINT8_C( 77), UINT8_C(115), UINT8_C( 65), UINT8_C( 74), UINT8_C( 52), UINT8_C(212), UINT8_C(241),
+        UINT8_C(244), UINT8_C(252), UINT8_C( 79), UINT8_C( 45), UINT8_C( 93), UINT8_C( 44), UINT8_C(241), UINT8_C(159),
+        UINT8_C(  4), UINT8_C(129), UINT8_C(116), UINT8_C( 24), UINT8_C(255), UINT8_C( 10), UINT8_C( 50), UINT8_C(211) } },
+    { { UINT8_C( 13), UINT8_C(173), UINT8_C(164), UINT8_C(235), UINT8_C(236), UINT8_C(167), UINT8_C( 50), UINT8_C(194),
+        UINT8_C(191), UINT8_C( 92), UINT8_C( 80), UINT8_C( 44), UINT8_C(134), UINT8_C(115), UINT8_C(225), UINT8_C(106),
+        UINT8_C(172), UINT8_C( 77), UINT8_C( 65), UINT8_C( 11), UINT8_C( 37), UINT8_C(183), UINT8_C( 26), UINT8_C(142),
+        UINT8_C(141), UINT8_C( 28), UINT8_C( 14), UINT8_C(146), UINT8_C(169), UINT8_C( 98), UINT8_C( 62), UINT8_C( 38),
+        UINT8_C( 80), UINT8_C(196), UINT8_C( 85), UINT8_C(177), UINT8_C(180), UINT8_C(161), UINT8_C( 66), UINT8_C(166),
+        UINT8_C(133), UINT8_C( 62), UINT8_C(126), UINT8_C(160), UINT8_C( 51), UINT8_C(157), UINT8_C(140), UINT8_C(239),
+        UINT8_C(244), UINT8_C(139), UINT8_C(100), UINT8_C(174), UINT8_C(183), UINT8_C( 98), UINT8_C(136), UINT8_C(131),
+        UINT8_C(  4), UINT8_C(234), UINT8_C(205), UINT8_C( 78), UINT8_C(  0), UINT8_C(210), UINT8_C(117), UINT8_C(127) },
+      { UINT8_C(139), UINT8_C(248), UINT8_C( 73), UINT8_C( 11), UINT8_C(217), UINT8_C( 68), UINT8_C( 70), UINT8_C(102),
+        UINT8_C(  4), UINT8_C(130), UINT8_C(233), UINT8_C(172), UINT8_C( 67), UINT8_C(227), UINT8_C(246), UINT8_C(227),
+        UINT8_C( 92), UINT8_C(174), UINT8_C(253), UINT8_C(140), UINT8_C( 81), UINT8_C(187), UINT8_C(186), UINT8_C(153),
+        UINT8_C( 92), UINT8_C(226), UINT8_C( 53), UINT8_C(111), UINT8_C(227), UINT8_C(252), UINT8_C( 57), UINT8_C(179),
+        UINT8_C(188), UINT8_C( 43), UINT8_C( 45), UINT8_C( 29), UINT8_C(187), UINT8_C( 94), UINT8_C(248), UINT8_C(181),
+        UINT8_C( 38), UINT8_C(156), UINT8_C( 23), UINT8_C(197), UINT8_C(208), UINT8_C(203), UINT8_C(100), UINT8_C(132),
+        UINT8_C(181), UINT8_C(130), UINT8_C(  1), UINT8_C(211), UINT8_C(142), UINT8_C(159), UINT8_C(134), UINT8_C(159),
+        UINT8_C(104), UINT8_C( 66), UINT8_C( 14), UINT8_C(102), UINT8_C( 22), UINT8_C( 20), UINT8_C(214), UINT8_C(169) },
+      { UINT8_C(139), UINT8_C( 96), UINT8_C( 98), UINT8_C( 98), UINT8_C(145), UINT8_C(228), UINT8_C(  9), UINT8_C( 84),
+        UINT8_C(242), UINT8_C(113), UINT8_C(147), UINT8_C( 56), UINT8_C( 61), UINT8_C(130), UINT8_C(242), UINT8_C(123),
+        UINT8_C(217), UINT8_C(103), UINT8_C(138), UINT8_C(211), UINT8_C(  9), UINT8_C( 65), UINT8_C( 27), UINT8_C(160),
+        UINT8_C(153), UINT8_C(119), UINT8_C(244), UINT8_C(147), UINT8_C(141), UINT8_C( 64), UINT8_C(135), UINT8_C(  2),
+        UINT8_C( 96), UINT8_C(205), UINT8_C(203), UINT8_C(140), UINT8_C(219), UINT8_C(200), UINT8_C( 76), UINT8_C(100),
+        UINT8_C( 41), UINT8_C(140), UINT8_C( 81), UINT8_C(141), UINT8_C(165), UINT8_C(164), UINT8_C(216), UINT8_C( 49),
+        UINT8_C( 90), UINT8_C(124), UINT8_C( 24), UINT8_C(161), UINT8_C( 44), UINT8_C(123), UINT8_C(190), UINT8_C(182),
+        UINT8_C(252), UINT8_C(232), UINT8_C(224), UINT8_C( 94), UINT8_C(124), UINT8_C(117), UINT8_C(106), UINT8_C(171) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i round_key = simde_mm512_loadu_si512(test_vec[i].round_key);
+    simde__m512i r = simde_mm512_aesenc_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x64(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesenclast_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[64];
+    uint8_t round_key[64];
+    uint8_t r[64];
+  } test_vec[] = {
+    { { UINT8_C(250), UINT8_C(  1), UINT8_C( 99), UINT8_C( 43), UINT8_C(141), UINT8_C(194), UINT8_C(247), UINT8_C(212),
+        UINT8_C(163), UINT8_C(208), UINT8_C(111), UINT8_C( 89), UINT8_C( 81), UINT8_C( 53), UINT8_C(  1), UINT8_C( 73),
+        UINT8_C(151), UINT8_C(254), UINT8_C( 87), UINT8_C(207), UINT8_C(192), UINT8_C(119), UINT8_C( 61), UINT8_C(175),
+        UINT8_C(116), UINT8_C( 86), UINT8_C( 14), UINT8_C(104), UINT8_C(214), UINT8_C( 37), UINT8_C( 69), UINT8_C( 39),
+        UINT8_C(  7), UINT8_C(141), UINT8_C(100), UINT8_C( 70), UINT8_C( 46), UINT8_C(138), UINT8_C( 75), UINT8_C( 17),
+        UINT8_C(253), UINT8_C(164), UINT8_C( 81), UINT8_C(123), UINT8_C( 35), UINT8_C( 81), UINT8_C(183), UINT8_C(  0),
+        UINT8_C(162), UINT8_C(231), UINT8_C(110), UINT8_C( 86), UINT8_C(220), UINT8_C(157), UINT8_C(110), UINT8_C(178),
+        UINT8_C(193), UINT8_C( 76), UINT8_C(136), UINT8_C(157), UINT8_C(160), UINT8_C(219), UINT8_C(248), UINT8_C(149) },
+      { UINT8_C(198), UINT8_C(255), UINT8_C( 44), UINT8_C(248), UINT8_C(115), UINT8_C(141), UINT8_C(216), UINT8_C(241),
+        UINT8_C(206), UINT8_C( 61), UINT8_C(157), UINT8_C(192), UINT8_C(171), UINT8_C(150), UINT8_C( 91), UINT8_C( 95),
+        UINT8_C(209), UINT8_C(228), UINT8_C(135), UINT8_C(232), UINT8_C(141), UINT8_C( 46), UINT8_C(172), UINT8_C(155),
+        UINT8_C( 94), UINT8_C( 56), UINT8_C(120), UINT8_C( 36), UINT8_C( 52), UINT8_C(162), UINT8_C(129), UINT8_C(240),
+        UINT8_C(217), UINT8_C( 42), UINT8_C(216), UINT8_C(165), UINT8_C(104), UINT8_C( 50), UINT8_C( 68), UINT8_C(  8),
+        UINT8_C(208), UINT8_C( 47), UINT8_C(117), UINT8_C(183), UINT8_C(216), UINT8_C(131), UINT8_C( 10), UINT8_C(252),
+        UINT8_C(129), UINT8_C(224), UINT8_C(  7), UINT8_C( 67), UINT8_C(137), UINT8_C(236), UINT8_C(199), UINT8_C( 68),
+        UINT8_C(204), UINT8_C( 83), UINT8_C(239), UINT8_C(216), UINT8_C( 35), UINT8_C(185), UINT8_C(212), UINT8_C( 41) },
+      { UINT8_C(235), UINT8_C(218), UINT8_C(132), UINT8_C(195), UINT8_C( 46), UINT8_C(253), UINT8_C(164), UINT8_C(  0),
+        UINT8_C(196), UINT8_C(171), UINT8_C(102), UINT8_C(136), UINT8_C(122), UINT8_C(234), UINT8_C( 51), UINT8_C(148),
+        UINT8_C( 89), UINT8_C( 17), UINT8_C( 44), UINT8_C( 36), UINT8_C( 55), UINT8_C(159), UINT8_C(194), UINT8_C( 17),
+        UINT8_C(204), UINT8_C(  7), UINT8_C( 35), UINT8_C( 93), UINT8_C(194), UINT8_C( 25), UINT8_C(166), UINT8_C(181),
+        UINT8_C( 28), UINT8_C( 84), UINT8_C(  9), UINT8_C(198), UINT8_C( 89), UINT8_C(123), UINT8_C(237), UINT8_C( 82),
+        UINT8_C(132), UINT8_C(254), UINT8_C( 54), UINT8_C( 53), UINT8_C(254), UINT8_C(222), UINT8_C(185), UINT8_C(221),
+        UINT8_C(187), UINT8_C(190), UINT8_C(195), UINT8_C(105), UINT8_C( 15), UINT8_C(197), UINT8_C(134), UINT8_C(245),
+        UINT8_C(180), UINT8_C(234), UINT8_C(112), UINT8_C(239), UINT8_C(195), UINT8_C( 45), UINT8_C( 75), UINT8_C(119) } },
+    { { UINT8_C( 15), UINT8_C(199), UINT8_C(162), UINT8_C(143), UINT8_C(  8), UINT8_C(134), UINT8_C(167), UINT8_C( 20),
+        UINT8_C(230), UINT8_C( 97), UINT8_C( 37), UINT8_C(253), UINT8_C( 70), UINT8_C( 40), UINT8_C(254), UINT8_C(109),
+        UINT8_C(217), UINT8_C( 30), UINT8_C(146), UINT8_C(  1), UINT8_C( 69), UINT8_C( 13), UINT8_C(137), UINT8_C(240),
+        UINT8_C(207), UINT8_C( 80), UINT8_C(138), UINT8_C(173), UINT8_C(246), UINT8_C(211), UINT8_C(220), UINT8_C(155),
+        UINT8_C(110), UINT8_C(226), UINT8_C(245), UINT8_C( 12), UINT8_C( 40), UINT8_C(206), UINT8_C(241), UINT8_C(164),
+        UINT8_C(227), UINT8_C( 16), UINT8_C( 76), UINT8_C(224), UINT8_C(255), UINT8_C(254), UINT8_C(107), UINT8_C( 73),
+        UINT8_C(  1), UINT8_C(121), UINT8_C( 47), UINT8_C(155), UINT8_C(164), UINT8_C(139), UINT8_C( 74), UINT8_C(104),
+        UINT8_C(102), UINT8_C(170), UINT8_C(197), UINT8_C( 70), UINT8_C(124), UINT8_C(156), UINT8_C(177), UINT8_C( 44) },
+      { UINT8_C( 24), UINT8_C(126), UINT8_C( 20), UINT8_C(228), UINT8_C( 17), UINT8_C(235), UINT8_C(106), UINT8_C(208),
+        UINT8_C(251), UINT8_C( 92), UINT8_C(164), UINT8_C( 61), UINT8_C(113), UINT8_C(147), UINT8_C(204), UINT8_C(253),
+        UINT8_C( 10), UINT8_C(180), UINT8_C( 37), UINT8_C(125), UINT8_C( 75), UINT8_C(241), UINT8_C(118), UINT8_C(192),
+        UINT8_C(  5), UINT8_C(211), UINT8_C(236), UINT8_C(157), UINT8_C( 64), UINT8_C(100), UINT8_C( 74), UINT8_C(252),
+        UINT8_C(211), UINT8_C(134), UINT8_C( 47), UINT8_C(175), UINT8_C(222), UINT8_C(239), UINT8_C(200), UINT8_C(221),
+        UINT8_C( 88), UINT8_C( 20), UINT8_C(158), UINT8_C( 81), UINT8_C(199), UINT8_C(110), UINT8_C(214), UINT8_C(193),
+        UINT8_C(232), UINT8_C(185), UINT8_C(130), UINT8_C(  5), UINT8_C(199), UINT8_C(220), UINT8_C( 27), UINT8_C( 73),
+        UINT8_C(229), UINT8_C(234), UINT8_C(249), UINT8_C( 54), UINT8_C(162), UINT8_C(177), UINT8_C( 10), UINT8_C(228) },
+      { UINT8_C(110), UINT8_C( 58), UINT8_C( 43), UINT8_C(216), UINT8_C( 33), UINT8_C(  4), UINT8_C(209), UINT8_C(163),
+        UINT8_C(117), UINT8_C(104), UINT8_C(158), UINT8_C(199), UINT8_C( 43), UINT8_C( 85), UINT8_C(144), UINT8_C(169),
+        UINT8_C( 63), UINT8_C( 99), UINT8_C( 91), UINT8_C(105), UINT8_C( 37), UINT8_C(162), UINT8_C(240), UINT8_C(188),
+        UINT8_C(143), UINT8_C(181), UINT8_C(163), UINT8_C( 17), UINT8_C(  2), UINT8_C( 22), UINT8_C(237), UINT8_C(105),
+        UINT8_C( 76), UINT8_C( 13), UINT8_C(  6), UINT8_C(148), UINT8_C(234), UINT8_C( 37), UINT8_C(183), UINT8_C( 35),
+        UINT8_C( 73), UINT8_C(175), UINT8_C(120), UINT8_C( 24), UINT8_C(209), UINT8_C(246), UINT8_C(119), UINT8_C( 32),
+        UINT8_C(148), UINT8_C(132), UINT8_C( 36), UINT8_C(116), UINT8_C(142), UINT8_C(112), UINT8_C(211), UINT8_C( 93),
+        UINT8_C(214), UINT8_C( 52), UINT8_C(236), UINT8_C(115), UINT8_C(178), UINT8_C(  7), UINT8_C(220), UINT8_C(190) } },
+    { { UINT8_C( 89), UINT8_C( 95), UINT8_C(217), UINT8_C(186), UINT8_C(  1), UINT8_C(255), UINT8_C(158), UINT8_C(253),
+        UINT8_C(110), UINT8_C( 62), UINT8_C( 70), UINT8_C(152), UINT8_C( 13), UINT8_C(255), UINT8_C(100), UINT8_C( 20),
+        UINT8_C(176), UINT8_C(237), UINT8_C( 70), UINT8_C( 54), UINT8_C( 48), UINT8_C(108), UINT8_C(114), UINT8_C(116),
+        UINT8_C(118), UINT8_C( 40), UINT8_C( 98), UINT8_C(  6), UINT8_C(166), UINT8_C( 61), UINT8_C( 91), UINT8_C(229),
+        UINT8_C( 30), UINT8_C( 20), UINT8_C( 98), UINT8_C(188), UINT8_C(255), UINT8_C(248), UINT8_C(225), UINT8_C( 88),
+        UINT8_C(126), UINT8_C( 20), UINT8_C( 16), UINT8_C(218), UINT8_C(191), UINT8_C(126), UINT8_C(124), UINT8_C(140),
+        UINT8_C(201), UINT8_C(144), UINT8_C(193), UINT8_C( 32), UINT8_C( 24), UINT8_C( 34), UINT8_C(226), UINT8_C(107),
+        UINT8_C( 51), UINT8_C(129), UINT8_C( 76), UINT8_C(224), UINT8_C( 79), UINT8_C(181), UINT8_C(  8), UINT8_C(244) },
+      { UINT8_C( 23), UINT8_C(187), UINT8_C(130), UINT8_C(119), UINT8_C(177), UINT8_C( 52), UINT8_C( 12), UINT8_C(116),
+        UINT8_C( 64), UINT8_C( 60), UINT8_C(198), UINT8_C(  9), UINT8_C( 85), UINT8_C(217), UINT8_C(216), UINT8_C( 49),
+        UINT8_C(199), UINT8_C( 64), UINT8_C( 14), UINT8_C(116), UINT8_C( 12), UINT8_C( 58), UINT8_C( 92), UINT8_C( 40),
+        UINT8_C(242), UINT8_C(223), UINT8_C( 40), UINT8_C( 22), UINT8_C(120), UINT8_C(188), UINT8_C(241), UINT8_C( 26),
+        UINT8_C(190), UINT8_C( 21), UINT8_C(233), UINT8_C( 70), UINT8_C(188), UINT8_C(141), UINT8_C(130), UINT8_C(113),
+        UINT8_C(239), UINT8_C(168), UINT8_C( 45), UINT8_C(239), UINT8_C(154), UINT8_C( 37), UINT8_C(143), UINT8_C( 98),
+        UINT8_C(174), UINT8_C( 73), UINT8_C(175), UINT8_C(218), UINT8_C(189), UINT8_C(194), UINT8_C(113), UINT8_C( 45),
+        UINT8_C( 91), UINT8_C( 81), UINT8_C(211), UINT8_C(158), UINT8_C(185), UINT8_C( 62), UINT8_C( 12), UINT8_C(  6) },
+      { UINT8_C(220), UINT8_C(173), UINT8_C(216), UINT8_C(141), UINT8_C(205), UINT8_C(134), UINT8_C( 79), UINT8_C(128),
+        UINT8_C(223), UINT8_C( 42), UINT8_C(243), UINT8_C( 93), UINT8_C(130), UINT8_C( 22), UINT8_C(211), UINT8_C(119),
+        UINT8_C( 32), UINT8_C( 16), UINT8_C(164), UINT8_C(173), UINT8_C(  8), UINT8_C( 14), UINT8_C(101), UINT8_C( 45),
+        UINT8_C(202), UINT8_C(248), UINT8_C(114), UINT8_C(132), UINT8_C( 92), UINT8_C(233), UINT8_C(177), UINT8_C(117),
+        UINT8_C(204), UINT8_C( 84), UINT8_C( 35), UINT8_C( 34), UINT8_C(170), UINT8_C(119), UINT8_C(146), UINT8_C( 20),
+        UINT8_C( 28), UINT8_C( 91), UINT8_C(135), UINT8_C(133), UINT8_C(146), UINT8_C(223), UINT8_C(119), UINT8_C( 53),
+        UINT8_C(115), UINT8_C(218), UINT8_C(134), UINT8_C(101), UINT8_C( 16), UINT8_C(206), UINT8_C( 65), UINT8_C(154),
+        UINT8_C(152), UINT8_C(132), UINT8_C(171), UINT8_C(225), UINT8_C( 61), UINT8_C( 94), UINT8_C(148), UINT8_C(231) } },
+    { { UINT8_C(206), UINT8_C(151), UINT8_C(178), UINT8_C( 33), UINT8_C( 69), UINT8_C(157), UINT8_C(238), UINT8_C(117),
+        UINT8_C(197), UINT8_C( 82), UINT8_C(100), UINT8_C( 26), UINT8_C( 18), UINT8_C( 80), UINT8_C(156), UINT8_C(147),
+        UINT8_C( 36), UINT8_C(220), UINT8_C(215), UINT8_C(120), UINT8_C(166), UINT8_C(161), UINT8_C( 96), UINT8_C(164),
+        UINT8_C(195), UINT8_C(120), UINT8_C(254), UINT8_C(143), UINT8_C(156), UINT8_C(149), UINT8_C(106), UINT8_C(136),
+        UINT8_C(195), UINT8_C(128), UINT8_C( 31), UINT8_C( 43), UINT8_C(185), UINT8_C( 54), UINT8_C( 72), UINT8_C(140),
+        UINT8_C(149), UINT8_C( 26), UINT8_C( 98), UINT8_C(188), UINT8_C(105), UINT8_C( 77), UINT8_C(189), UINT8_C(194),
+        UINT8_C(193), UINT8_C(166), UINT8_C( 25), UINT8_C( 75), UINT8_C( 89), UINT8_C(235), UINT8_C(126), UINT8_C(196),
+        UINT8_C( 11), UINT8_C(223), UINT8_C(182), UINT8_C( 85), UINT8_C(201), UINT8_C(  8), UINT8_C( 82), UINT8_C(224) },
+      { UINT8_C( 65), UINT8_C(241), UINT8_C(176), UINT8_C(199), UINT8_C( 24), UINT8_C(244), UINT8_C(  1), UINT8_C(103),
+        UINT8_C( 85), UINT8_C(131), UINT8_C(248), UINT8_C(163), UINT8_C( 74), UINT8_C( 88), UINT8_C(158), UINT8_C(119),
+        UINT8_C(113), UINT8_C( 55), UINT8_C( 17), UINT8_C(201), UINT8_C(168), UINT8_C(  9), UINT8_C(211), UINT8_C(230),
+        UINT8_C(215), UINT8_C( 98), UINT8_C(130), UINT8_C(235), UINT8_C( 24), UINT8_C(222), UINT8_C(211), UINT8_C( 90),
+        UINT8_C(142), UINT8_C( 85), UINT8_C(161), UINT8_C(232), UINT8_C(239), UINT8_C(  4), UINT8_C(244), UINT8_C( 67),
+        UINT8_C( 75), UINT8_C(199), UINT8_C(246), UINT8_C(101), UINT8_C( 49), UINT8_C( 49), UINT8_C( 59), UINT8_C(183),
+        UINT8_C(144), UINT8_C( 45), UINT8_C(117), UINT8_C(147), UINT8_C( 42), UINT8_C(254), UINT8_C(101), UINT8_C(255),
+        UINT8_C(192), UINT8_C(171), UINT8_C( 38), UINT8_C(200), UINT8_C(215), UINT8_C(194), UINT8_C( 65), UINT8_C(111) },
+      { UINT8_C(202), UINT8_C(175), UINT8_C(243), UINT8_C( 27), UINT8_C(118), UINT8_C(244), UINT8_C(223), UINT8_C(154),
+        UINT8_C(243), UINT8_C(208), UINT8_C(207), UINT8_C( 62), UINT8_C(131), UINT8_C(208), UINT8_C(182), UINT8_C(213),
+        UINT8_C( 71), UINT8_C(  5), UINT8_C(170), UINT8_C( 13), UINT8_C(140), UINT8_C(181), UINT8_C(209), UINT8_C( 90),
+        UINT8_C(249), UINT8_C( 72), UINT8_C(140), UINT8_C(162), UINT8_C(198), UINT8_C( 88), UINT8_C(  3), UINT8_C( 41),
+        UINT8_C(160), UINT8_C( 80), UINT8_C( 11), UINT8_C(205), UINT8_C(185), UINT8_C(166), UINT8_C(142), UINT8_C(178),
+        UINT8_C( 97), UINT8_C( 36), UINT8_C( 54), UINT8_C(  1), UINT8_C(200), UINT8_C(252), UINT8_C(105), UINT8_C(210),
+        UINT8_C(232), UINT8_C(196), UINT8_C( 59), UINT8_C(114), UINT8_C(225), UINT8_C( 96), UINT8_C(101), UINT8_C( 76),
+        UINT8_C(235), UINT8_C(155), UINT8_C(242), UINT8_C(212), UINT8_C( 10), UINT8_C(230), UINT8_C(178), UINT8_C(147) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i round_key = simde_mm512_loadu_si512(test_vec[i].round_key);
+    simde__m512i r = simde_mm512_aesenclast_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x64(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesdec_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[64];
+    uint8_t round_key[64];
+    uint8_t r[64];
+  } test_vec[] = {
+    { { UINT8_C(199), UINT8_C(126), UINT8_C( 88), UINT8_C(216), UINT8_C( 59), UINT8_C( 13), UINT8_C(211), UINT8_C(254),
+        UINT8_C(253), UINT8_C(222), UINT8_C( 61), UINT8_C( 67), UINT8_C(237), UINT8_C( 58), UINT8_C(240), UINT8_C(195),
+        UINT8_C(206), UINT8_C(241), UINT8_C( 24), UINT8_C(136), UINT8_C( 97), UINT8_C( 99), UINT8_C(235), UINT8_C(200),
+        UINT8_C( 73), UINT8_C( 11), UINT8_C(237), UINT8_C(168), UINT8_C( 15), UINT8_C(151), UINT8_C(130), UINT8_C( 57),
+        UINT8_C(209), UINT8_C(206), UINT8_C(113), UINT8_C( 23), UINT8_C(185), UINT8_C( 74), UINT8_C(244), UINT8_C( 79),
+        UINT8_C(125), UINT8_C(105), UINT8_C(187), UINT8_C(172), UINT8_C(145), UINT8_C(118), UINT8_C( 96), UINT8_C(246),
+        UINT8_C(153), UINT8_C(134), UINT8_C(231), UINT8_C(240), UINT8_C( 33), UINT8_C( 65), UINT8_C(181), UINT8_C(106),
+        UINT8_C(198), UINT8_C(  1), UINT8_C(255), UINT8_C(136), UINT8_C( 63), UINT8_C( 91), UINT8_C( 47), UINT8_C(123) },
+      { UINT8_C( 29), UINT8_C(179), UINT8_C( 10), UINT8_C(152), UINT8_C(153), UINT8_C(242), UINT8_C(157), UINT8_C(162),
+        UINT8_C(169), UINT8_C(  6), UINT8_C(114), UINT8_C(178), UINT8_C( 33), UINT8_C( 97), UINT8_C( 39), UINT8_C(151),
+        UINT8_C(100), UINT8_C( 36), UINT8_C( 20), UINT8_C(162), UINT8_C(  3), UINT8_C(125), UINT8_C( 87), UINT8_C( 67),
+        UINT8_C(163), UINT8_C(102), UINT8_C(108), UINT8_C(242), UINT8_C(211), UINT8_C(102), UINT8_C( 78), UINT8_C(192),
+        UINT8_C( 71), UINT8_C( 41), UINT8_C(165), UINT8_C( 76), UINT8_C(134), UINT8_C(247), UINT8_C(144), UINT8_C( 67),
+        UINT8_C(213), UINT8_C(176), UINT8_C(191), UINT8_C(  6), UINT8_C(120), UINT8_C(182), UINT8_C( 61), UINT8_C(  1),
+        UINT8_C( 69), UINT8_C( 93), UINT8_C(185), UINT8_C( 64), UINT8_C(130), UINT8_C(233), UINT8_C( 80), UINT8_C( 80),
+        UINT8_C(230), UINT8_C( 99), UINT8_C(233), UINT8_C(214), UINT8_C( 53), UINT8_C( 49), UINT8_C(251), UINT8_C( 68) },
+      { UINT8_C(123), UINT8_C(121), UINT8_C(254), UINT8_C(212), UINT8_C(105), UINT8_C(139), UINT8_C( 72), UINT8_C( 78),
+        UINT8_C(224), UINT8_C(169), UINT8_C( 33), UINT8_C(184), UINT8_C( 23), UINT8_C( 64), UINT8_C(125), UINT8_C(145),
+        UINT8_C( 47), UINT8_C(121), UINT8_C(237), UINT8_C(198), UINT8_C(166), UINT8_C(160), UINT8_C( 58), UINT8_C(219),
+        UINT8_C(235), UINT8_C(176), UINT8_C( 57), UINT8_C(242), UINT8_C( 55), UINT8_C(103), UINT8_C(234), UINT8_C( 79),
+        UINT8_C(153), UINT8_C( 36), UINT8_C(176), UINT8_C(184), UINT8_C( 97), UINT8_C(133), UINT8_C( 38), UINT8_C(109),
+        UINT8_C(206), UINT8_C(120), UINT8_C(234), UINT8_C( 53), UINT8_C(236), UINT8_C(137), UINT8_C( 85), UINT8_C(183),
+        UINT8_C( 98), UINT8_C(221), UINT8_C( 23), UINT8_C(194), UINT8_C(219), UINT8_C(158), UINT8_C(192), UINT8_C(144),
+        UINT8_C( 24), UINT8_C( 74), UINT8_C( 99), UINT8_C(  7), UINT8_C( 89), UINT8_C( 13), UINT8_C(169), UINT8_C(175) } },
+    { { UINT8_C( 24), UINT8_C(148), UINT8_C(199), UINT8_C(200), UINT8_C(215), UINT8_C(108), UINT8_C( 14), UINT8_C( 58),
+        UINT8_C(176), UINT8_C(113), UINT8_C(101), UINT8_C(127), UINT8_C(231), UINT8_C(110), UINT8_C(198), UINT8_C(129),
+        UINT8_C( 36), UINT8_C(134), UINT8_C(137), UINT8_C(140), UINT8_C(239), UINT8_C(140), UINT8_C( 37), UINT8_C( 93),
+        UINT8_C(215), UINT8_C( 72), UINT8_C(188), UINT8_C( 39), UINT8_C(251), UINT8_C( 42), UINT8_C( 34), UINT8_C( 66),
+        UINT8_C(158), UINT8_C( 93), UINT8_C( 43), UINT8_C( 99), UINT8_C(195), UINT8_C( 32), UINT8_C(244), UINT8_C(111),
+        UINT8_C(201), UINT8_C( 50), UINT8_C( 94), UINT8_C(126), UINT8_C(190), UINT8_C( 15), UINT8_C( 49), UINT8_C(221),
+        UINT8_C(226), UINT8_C(127), UINT8_C(171), UINT8_C(166), UINT8_C( 13), UINT8_C(245), UINT8_C( 88), UINT8_C( 92),
+        UINT8_C(156), UINT8_C(177), UINT8_C(142), UINT8_C(159), UINT8_C( 96), UINT8_C(198), UINT8_C(  7), UINT8_C(173) },
+      { UINT8_C( 30), UINT8_C( 14), UINT8_C( 94), UINT8_C( 20), UINT8_C( 62), UINT8_C(102), UINT8_C(176), UINT8_C(225),
+        UINT8_C(252), UINT8_C(179), UINT8_C(120), UINT8_C(228), UINT8_C(245), UINT8_C(134), UINT8_C(183), UINT8_C(112),
+        UINT8_C(238), UINT8_C(  1), UINT8_C( 13), UINT8_C(249), UINT8_C(238), UINT8_C(101), UINT8_C(147), UINT8_C(134),
+        UINT8_C(245), UINT8_C(220), UINT8_C( 75), UINT8_C(175), UINT8_C(184), UINT8_C(223), UINT8_C(138), UINT8_C(151),
+        UINT8_C(  0), UINT8_C(240), UINT8_C(189), UINT8_C(162), UINT8_C(241), UINT8_C(112), UINT8_C(192), UINT8_C(125),
+        UINT8_C(149), UINT8_C( 96), UINT8_C(128), UINT8_C( 99), UINT8_C(163), UINT8_C(138), UINT8_C( 71), UINT8_C( 11),
+        UINT8_C(139), UINT8_C( 20), UINT8_C(110), UINT8_C( 88), UINT8_C(152), UINT8_C(231), UINT8_C(102), UINT8_C( 86),
+        UINT8_C(134), UINT8_C( 81), UINT8_C( 41), UINT8_C( 29), UINT8_C(209), UINT8_C(204), UINT8_C(189), UINT8_C(110) },
+      { UINT8_C(228), UINT8_C( 41), UINT8_C(242), UINT8_C( 10), UINT8_C(185), UINT8_C(135), UINT8_C(113), UINT8_C(  0),
+        UINT8_C( 20), UINT8_C( 35), UINT8_C(142), UINT8_C(142), UINT8_C(138), UINT8_C(110), UINT8_C( 64), UINT8_C(234),
+        UINT8_C(215), UINT8_C(153), UINT8_C(125), UINT8_C(238), UINT8_C(163), UINT8_C( 52), UINT8_C(  3), UINT8_C( 30),
+        UINT8_C(184), UINT8_C( 64), UINT8_C( 16), UINT8_C(220), UINT8_C(221), UINT8_C(118), UINT8_C( 95), UINT8_C( 11),
+        UINT8_C(180), UINT8_C( 46), UINT8_C( 46), UINT8_C(228), UINT8_C( 27), UINT8_C(118), UINT8_C(  3), UINT8_C( 72),
+        UINT8_C(167), UINT8_C(  0), UINT8_C(184), UINT8_C(141), UINT8_C(198), UINT8_C(208), UINT8_C( 64), UINT8_C(114),
+        UINT8_C( 40), UINT8_C( 40), UINT8_C(113), UINT8_C(101), UINT8_C(165), UINT8_C(218), UINT8_C( 23), UINT8_C(233),
+        UINT8_C(188), UINT8_C(203), UINT8_C(251), UINT8_C( 18), UINT8_C( 64), UINT8_C(115), UINT8_C( 88), UINT8_C(248) } },
+    { { UINT8_C(140), UINT8_C( 41), UINT8_C( 45), UINT8_C(207), UINT8_C( 96), UINT8_C(192), UINT8_C( 73), UINT8_C( 73),
+        UINT8_C(121), UINT8_C( 73), UINT8_C(171), UINT8_C( 64), UINT8_C(160), UINT8_C(161), UINT8_C(240), UINT8_C( 35),
+        UINT8_C( 73), UINT8_C(195), UINT8_C(216), UINT8_C(129), UINT8_C(152), UINT8_C(125), UINT8_C(177), UINT8_C(214),
+        UINT8_C(205), UINT8_C( 54), UINT8_C(160), UINT8_C(205), UINT8_C(244), UINT8_C( 19), UINT8_C( 61), UINT8_C(  1),
+        UINT8_C( 59), UINT8_C( 63), UINT8_C(173), UINT8_C( 58), UINT8_C(116), UINT8_C( 20), UINT8_C(242), UINT8_C(111),
+        UINT8_C( 51), UINT8_C( 67), UINT8_C(199), UINT8_C(170), UINT8_C(151), UINT8_C( 40), UINT8_C(242), UINT8_C(253),
+        UINT8_C(192), UINT8_C( 59), UINT8_C(225), UINT8_C(198), UINT8_C(251), UINT8_C(150), UINT8_C(229), UINT8_C(238),
+        UINT8_C(161), UINT8_C(158), UINT8_C( 33), UINT8_C( 65), UINT8_C(155), UINT8_C(206), UINT8_C(181), UINT8_C(220) },
+      { UINT8_C( 55), UINT8_C(155), UINT8_C( 80), UINT8_C(194), UINT8_C(225), UINT8_C( 60), UINT8_C(128), UINT8_C( 19),
+        UINT8_C(243), UINT8_C(254), UINT8_C(157), UINT8_C(110), UINT8_C(196), UINT8_C(199), UINT8_C( 52), UINT8_C( 16),
+        UINT8_C(  0), UINT8_C(220), UINT8_C(235), UINT8_C( 94), UINT8_C(122), UINT8_C( 70), UINT8_C(252), UINT8_C(139),
+        UINT8_C( 18), UINT8_C(110), UINT8_C( 50), UINT8_C( 78), UINT8_C(166), UINT8_C( 43), UINT8_C(225), UINT8_C( 14),
+        UINT8_C(196), UINT8_C(189), UINT8_C(170), UINT8_C(209), UINT8_C( 32), UINT8_C(222), UINT8_C(143), UINT8_C(166),
+        UINT8_C( 71), UINT8_C(  3), UINT8_C(  9), UINT8_C( 25), UINT8_C(163), UINT8_C( 40), UINT8_C( 16), UINT8_C(212),
+        UINT8_C( 69), UINT8_C( 89), UINT8_C(117), UINT8_C(189), UINT8_C( 76), UINT8_C( 76), UINT8_C( 92), UINT8_C(128),
+        UINT8_C( 63), UINT8_C(185), UINT8_C(170), UINT8_C(143), UINT8_C( 30), UINT8_C(192), UINT8_C( 79), UINT8_C( 63) },
+      { UINT8_C(148), UINT8_C( 68), UINT8_C( 64), UINT8_C(  5), UINT8_C(254), UINT8_C( 56), UINT8_C(113), UINT8_C( 64),
+        UINT8_C(253), UINT8_C( 17), UINT8_C( 54), UINT8_C( 92), UINT8_C( 39), UINT8_C(122), UINT8_C(  4), UINT8_C(102),
+        UINT8_C( 33), UINT8_C(170), UINT8_C(127), UINT8_C(182), UINT8_C(206), UINT8_C(180), UINT8_C(142), UINT8_C(101),
+        UINT8_C( 85), UINT8_C( 17), UINT8_C(173), UINT8_C( 94), UINT8_C(  1), UINT8_C(174), UINT8_C( 24), UINT8_C(140),
+        UINT8_C( 95), UINT8_C(  7), UINT8_C(114), UINT8_C(184), UINT8_C(151), UINT8_C( 19), UINT8_C(255), UINT8_C( 37),
+        UINT8_C(157), UINT8_C(229), UINT8_C( 62), UINT8_C(214), UINT8_C(132), UINT8_C(240), UINT8_C( 56), UINT8_C( 68),
+        UINT8_C(181), UINT8_C(214), UINT8_C(195), UINT8_C(101), UINT8_C(137), UINT8_C(218), UINT8_C( 40), UINT8_C(167),
+        UINT8_C( 97), UINT8_C(235), UINT8_C(144), UINT8_C( 14), UINT8_C(237), UINT8_C(222), UINT8_C(209), UINT8_C(150) } },
+    { { UINT8_C(243), UINT8_C(172), UINT8_C(215), UINT8_C(160), UINT8_C(205), UINT8_C(174), UINT8_C(179), UINT8_C(146),
+        UINT8_C( 59), UINT8_C(127), UINT8_C( 49), UINT8_C(229), UINT8_C(174), UINT8_C(115), UINT8_C( 37), UINT8_C(205),
+        UINT8_C(156), UINT8_C( 75), UINT8_C( 61), UINT8_C(173), UINT8_C( 42), UINT8_C( 18), UINT8_C(180), UINT8_C(153),
+        UINT8_C(100), UINT8_C( 20), UINT8_C(196), UINT8_C(145), UINT8_C(154), UINT8_C(185), UINT8_C(228), UINT8_C(169),
+        UINT8_C(136), UINT8_C(123), UINT8_C( 33), UINT8_C(231), UINT8_C(246), UINT8_C( 85), UINT8_C(101), UINT8_C(255),
+        UINT8_C(244), UINT8_C( 65), UINT8_C(101), UINT8_C( 99), UINT8_C(243), UINT8_C(106), UINT8_C( 78), UINT8_C(218),
+        UINT8_C( 69), UINT8_C(187), UINT8_C(112), UINT8_C( 12), UINT8_C( 50), UINT8_C(102), UINT8_C(180), UINT8_C(123),
+        UINT8_C( 45), UINT8_C( 45), UINT8_C(  9), UINT8_C(175), UINT8_C( 72), UINT8_C( 22), UINT8_C( 82), UINT8_C(  8) },
+      { UINT8_C(116), UINT8_C(144), UINT8_C( 55), UINT8_C(123), UINT8_C(161), UINT8_C( 92), UINT8_C(246), UINT8_C(195),
+        UINT8_C( 66), UINT8_C(180), UINT8_C( 83), UINT8_C(103), UINT8_C( 79), UINT8_C(247), UINT8_C(124), UINT8_C(240),
+        UINT8_C(111), UINT8_C( 47), UINT8_C(177), UINT8_C( 10), UINT8_C(130), UINT8_C( 15), UINT8_C(253), UINT8_C(184),
+        UINT8_C(  1), UINT8_C( 63), UINT8_C(171), UINT8_C(202), UINT8_C( 19), UINT8_C( 75), UINT8_C( 11), UINT8_C(173),
+        UINT8_C( 26), UINT8_C(116), UINT8_C( 46), UINT8_C(110), UINT8_C(120), UINT8_C( 54), UINT8_C(116), UINT8_C(150),
+        UINT8_C(193), UINT8_C(156), UINT8_C( 53), UINT8_C( 73), UINT8_C(251), UINT8_C(122), UINT8_C(142), UINT8_C(195),
+        UINT8_C( 38), UINT8_C(130), UINT8_C(169), UINT8_C(202), UINT8_C( 49), UINT8_C( 11), UINT8_C( 57), UINT8_C( 89),
+        UINT8_C(227), UINT8_C(210), UINT8_C(113), UINT8_C( 23), UINT8_C(243), UINT8_C( 76), UINT8_C( 86), UINT8_C(122) },
+      { UINT8_C( 44), UINT8_C(  3), UINT8_C(114), UINT8_C( 94), UINT8_C(238), UINT8_C(152), UINT8_C(100), UINT8_C( 24),
+        UINT8_C(114), UINT8_C(  8), UINT8_C(211), UINT8_C( 17), UINT8_C(242), UINT8_C( 39), UINT8_C(157), UINT8_C(165),
+        UINT8_C(241), UINT8_C(171), UINT8_C(204), UINT8_C(219), UINT8_C(252), UINT8_C( 41), UINT8_C( 14), UINT8_C( 72),
+        UINT8_C( 77), UINT8_C(218), UINT8_C(233), UINT8_C(168), UINT8_C( 65), UINT8_C(159), UINT8_C( 76), UINT8_C( 30),
+        UINT8_C(218), UINT8_C( 21), UINT8_C(217), UINT8_C( 54), UINT8_C(210), UINT8_C( 30), UINT8_C(120), UINT8_C(123),
+        UINT8_C( 44), UINT8_C(252), UINT8_C(181), UINT8_C( 18), UINT8_C(  1), UINT8_C(135), UINT8_C(185), UINT8_C(121),
+        UINT8_C(245), UINT8_C(235), UINT8_C(225), UINT8_C(236), UINT8_C(203), UINT8_C( 87), UINT8_C( 50), UINT8_C(248),
+        UINT8_C(163), UINT8_C(236), UINT8_C(151), UINT8_C(201), UINT8_C( 63), UINT8_C( 53), UINT8_C( 90), UINT8_C(170) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i round_key = simde_mm512_loadu_si512(test_vec[i].round_key);
+    simde__m512i r = simde_mm512_aesdec_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x64(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesdeclast_epi128(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[64];
+    uint8_t round_key[64];
+    uint8_t r[64];
+  } test_vec[] = {
+    { { UINT8_C(138), UINT8_C( 23), UINT8_C(143), UINT8_C(190), UINT8_C( 63), UINT8_C(199), UINT8_C(190), UINT8_C(173),
+        UINT8_C(160), UINT8_C(163), UINT8_C( 68), UINT8_C(  0), UINT8_C(204), UINT8_C( 55), UINT8_C( 45), UINT8_C(149),
+        UINT8_C(230), UINT8_C(139), UINT8_C(  8), UINT8_C( 32), UINT8_C( 18), UINT8_C( 94), UINT8_C( 48), UINT8_C( 92),
+        UINT8_C( 94), UINT8_C(226), UINT8_C( 13), UINT8_C(157), UINT8_C( 24), UINT8_C(146), UINT8_C( 55), UINT8_C(  7),
+        UINT8_C(141), UINT8_C(110), UINT8_C( 70), UINT8_C( 14), UINT8_C( 50), UINT8_C(  8), UINT8_C(182), UINT8_C(191),
+        UINT8_C(142), UINT8_C( 85), UINT8_C(211), UINT8_C(102), UINT8_C(146), UINT8_C( 33), UINT8_C(129), UINT8_C( 96),
+        UINT8_C(106), UINT8_C( 14), UINT8_C( 72), UINT8_C(170), UINT8_C(141), UINT8_C( 46), UINT8_C(236), UINT8_C(203),
+        UINT8_C(154), UINT8_C(173), UINT8_C(212), UINT8_C(219), UINT8_C(124), UINT8_C(182), UINT8_C(225), UINT8_C(204) },
+      { UINT8_C(233), UINT8_C( 18), UINT8_C(234), UINT8_C(141), UINT8_C( 58), UINT8_C(228), UINT8_C(107), UINT8_C(  3),
+        UINT8_C( 85), UINT8_C( 51), UINT8_C( 55), UINT8_C( 89), UINT8_C( 99), UINT8_C(231), UINT8_C( 86), UINT8_C(138),
+        UINT8_C(  1), UINT8_C(129), UINT8_C( 36), UINT8_C(110), UINT8_C(200), UINT8_C(157), UINT8_C( 58), UINT8_C( 68),
+        UINT8_C(144), UINT8_C( 31), UINT8_C(205), UINT8_C( 42), UINT8_C(106), UINT8_C(132), UINT8_C(  7), UINT8_C( 11),
+        UINT8_C(155), UINT8_C(104), UINT8_C( 28), UINT8_C(144), UINT8_C(219), UINT8_C(136), UINT8_C(245), UINT8_C(162),
+        UINT8_C(193), UINT8_C(226), UINT8_C(111), UINT8_C(225), UINT8_C(116), UINT8_C( 56), UINT8_C(208), UINT8_C( 55),
+        UINT8_C( 53), UINT8_C(217), UINT8_C(200), UINT8_C( 51), UINT8_C(161), UINT8_C(102), UINT8_C( 74), UINT8_C(156),
+        UINT8_C(243), UINT8_C(242), UINT8_C(237), UINT8_C(236), UINT8_C(213), UINT8_C(230), UINT8_C( 71), UINT8_C( 97) },
+      { UINT8_C( 38), UINT8_C(160), UINT8_C(108), UINT8_C(149), UINT8_C( 31), UINT8_C( 99), UINT8_C(145), UINT8_C( 81),
+        UINT8_C( 18), UINT8_C(  2), UINT8_C( 68), UINT8_C(244), UINT8_C( 68), UINT8_C(150), UINT8_C( 12), UINT8_C(208),
+        UINT8_C(244), UINT8_C(245), UINT8_C(215), UINT8_C(201), UINT8_C(241), UINT8_C( 83), UINT8_C(136), UINT8_C( 49),
+        UINT8_C( 13), UINT8_C(130), UINT8_C(114), UINT8_C( 18), UINT8_C( 94), UINT8_C(191), UINT8_C( 15), UINT8_C( 95),
+        UINT8_C( 47), UINT8_C( 19), UINT8_C(181), UINT8_C(100), UINT8_C(122), UINT8_C(205), UINT8_C(100), UINT8_C(113),
+        UINT8_C( 39), UINT8_C( 93), UINT8_C(247), UINT8_C(113), UINT8_C(  0), UINT8_C(213), UINT8_C(169), UINT8_C(224),
+        UINT8_C(109), UINT8_C(160), UINT8_C(209), UINT8_C(106), UINT8_C( 21), UINT8_C(177), UINT8_C(170), UINT8_C(  3),
+        UINT8_C(196), UINT8_C( 49), UINT8_C( 57), UINT8_C(203), UINT8_C(212), UINT8_C(254), UINT8_C(196), UINT8_C(  3) } },
+    { { UINT8_C(167), UINT8_C(226), UINT8_C( 61), UINT8_C( 19), UINT8_C(137), UINT8_C( 90), UINT8_C( 24), UINT8_C(124),
+        UINT8_C( 58), UINT8_C(132), UINT8_C(119), UINT8_C(225), UINT8_C( 14), UINT8_C( 40), UINT8_C( 18), UINT8_C( 74),
+        UINT8_C(122), UINT8_C(144), UINT8_C( 69), UINT8_C( 79), UINT8_C( 23), UINT8_C(167), UINT8_C(124), UINT8_C(184),
+        UINT8_C(233), UINT8_C(  8), UINT8_C(196), UINT8_C(149), UINT8_C(202), UINT8_C(  3), UINT8_C( 77), UINT8_C(177),
+        UINT8_C(194), UINT8_C( 59), UINT8_C(179), UINT8_C(  8), UINT8_C(214), UINT8_C(  5), UINT8_C( 73), UINT8_C(211),
+        UINT8_C(  2), UINT8_C(214), UINT8_C(111), UINT8_C(131), UINT8_C(174), UINT8_C(139), UINT8_C(126), UINT8_C(230),
+        UINT8_C( 13), UINT8_C( 41), UINT8_C(  9), UINT8_C(119), UINT8_C(217), UINT8_C(160), UINT8_C(229), UINT8_C( 90),
+        UINT8_C( 38), UINT8_C( 82), UINT8_C(250), UINT8_C(135), UINT8_C( 44), UINT8_C(192), UINT8_C(187), UINT8_C( 10) },
+      { UINT8_C(188), UINT8_C(153), UINT8_C( 56), UINT8_C( 64), UINT8_C( 44), UINT8_C( 20), UINT8_C(186), UINT8_C(181),
+        UINT8_C(182), UINT8_C(  1), UINT8_C(137), UINT8_C(166), UINT8_C( 75), UINT8_C( 31), UINT8_C(133), UINT8_C(214),
+        UINT8_C(249), UINT8_C( 12), UINT8_C(194), UINT8_C(205), UINT8_C(108), UINT8_C( 14), UINT8_C(206), UINT8_C(205),
+        UINT8_C( 38), UINT8_C(142), UINT8_C(161), UINT8_C( 38), UINT8_C(138), UINT8_C( 39), UINT8_C( 77), UINT8_C( 17),
+        UINT8_C(253), UINT8_C(254), UINT8_C( 43), UINT8_C(135), UINT8_C( 76), UINT8_C(218), UINT8_C(195), UINT8_C(  2),
+        UINT8_C( 14), UINT8_C(124), UINT8_C(100), UINT8_C( 44), UINT8_C(238), UINT8_C(215), UINT8_C(202), UINT8_C(  5),
+        UINT8_C(117), UINT8_C( 95), UINT8_C(227), UINT8_C(126), UINT8_C(188), UINT8_C( 19), UINT8_C(169), UINT8_C(128),
+        UINT8_C(131), UINT8_C(166), UINT8_C(255), UINT8_C(208), UINT8_C(101), UINT8_C(167), UINT8_C(132), UINT8_C(129) },
+      { UINT8_C( 53), UINT8_C(119), UINT8_C( 58), UINT8_C( 65), UINT8_C(222), UINT8_C( 47), UINT8_C(131), UINT8_C( 85),
+        UINT8_C( 20), UINT8_C( 71), UINT8_C(  2), UINT8_C(250), UINT8_C(156), UINT8_C( 80), UINT8_C(177), UINT8_C( 84),
+        UINT8_C( 68), UINT8_C(217), UINT8_C( 74), UINT8_C( 87), UINT8_C(235), UINT8_C(152), UINT8_C(171), UINT8_C( 96),
+        UINT8_C(205), UINT8_C(  7), UINT8_C(201), UINT8_C(112), UINT8_C(154), UINT8_C(152), UINT8_C( 76), UINT8_C(131),
+        UINT8_C( 85), UINT8_C( 48), UINT8_C( 45), UINT8_C( 46), UINT8_C(  6), UINT8_C(147), UINT8_C( 73), UINT8_C( 67),
+        UINT8_C(100), UINT8_C( 74), UINT8_C( 47), UINT8_C(217), UINT8_C( 80), UINT8_C(157), UINT8_C(110), UINT8_C(186),
+        UINT8_C(134), UINT8_C( 64), UINT8_C(247), UINT8_C( 56), UINT8_C( 89), UINT8_C( 95), UINT8_C( 87), UINT8_C(106),
+        UINT8_C(160), UINT8_C(225), UINT8_C(191), UINT8_C(115), UINT8_C( 39), UINT8_C(239), UINT8_C(174), UINT8_C(131) } },
+    { { UINT8_C( 32), UINT8_C(188), UINT8_C(  3), UINT8_C( 61), UINT8_C(243), UINT8_C(142), UINT8_C(191), UINT8_C( 96),
+        UINT8_C(208), UINT8_C(223), UINT8_C(116), UINT8_C(196), UINT8_C(165), UINT8_C(240), UINT8_C(  5), UINT8_C(151),
+        UINT8_C(104), UINT8_C(178), UINT8_C(105), UINT8_C( 75), UINT8_C( 13), UINT8_C( 13), UINT8_C(217), UINT8_C( 78),
+        UINT8_C(190), UINT8_C(225), UINT8_C( 20), UINT8_C( 20), UINT8_C( 18), UINT8_C( 28), UINT8_C(240), UINT8_C( 63),
+        UINT8_C(223), UINT8_C( 10), UINT8_C( 20), UINT8_C( 74), UINT8_C(  2), UINT8_C(158), UINT8_C(237), UINT8_C(158),
+        UINT8_C( 67), UINT8_C(157), UINT8_C(202), UINT8_C( 67), UINT8_C(171), UINT8_C(172), UINT8_C( 75), UINT8_C( 85),
+        UINT8_C( 29), UINT8_C( 69), UINT8_C( 29), UINT8_C(141), UINT8_C(234), UINT8_C( 41), UINT8_C(177), UINT8_C(104),
+        UINT8_C( 40), UINT8_C(206), UINT8_C(247), UINT8_C(204), UINT8_C(239), UINT8_C(212), UINT8_C(107), UINT8_C( 85) },
+      { UINT8_C(227), UINT8_C( 54), UINT8_C(178), UINT8_C( 45), UINT8_C(247), UINT8_C( 72), UINT8_C( 70), UINT8_C( 46),
+        UINT8_C(112), UINT8_C(250), UINT8_C( 41), UINT8_C(179), UINT8_C(194), UINT8_C(209), UINT8_C(202), UINT8_C(175),
+        UINT8_C( 62), UINT8_C( 60), UINT8_C(152), UINT8_C( 85), UINT8_C( 45), UINT8_C(189), UINT8_C( 90), UINT8_C( 90),
+        UINT8_C( 68), UINT8_C(244), UINT8_C(103), UINT8_C( 13), UINT8_C(201), UINT8_C(146), UINT8_C(101), UINT8_C(255),
+        UINT8_C(138), UINT8_C(191), UINT8_C(148), UINT8_C( 51), UINT8_C(247), UINT8_C( 54), UINT8_C( 16), UINT8_C(200),
+        UINT8_C(197), UINT8_C( 74), UINT8_C(220), UINT8_C(139), UINT8_C(246), UINT8_C(193), UINT8_C( 16), UINT8_C(110),
+        UINT8_C(164), UINT8_C(211), UINT8_C(200), UINT8_C(237), UINT8_C( 96), UINT8_C(102), UINT8_C( 12), UINT8_C( 46),
+        UINT8_C(118), UINT8_C(122), UINT8_C(134), UINT8_C(167), UINT8_C(  0), UINT8_C(240), UINT8_C(235), UINT8_C(146) },
+      { UINT8_C(183), UINT8_C( 33), UINT8_C(120), UINT8_C(189), UINT8_C(137), UINT8_C( 48), UINT8_C(112), UINT8_C(166),
+        UINT8_C( 16), UINT8_C( 28), UINT8_C(252), UINT8_C( 54), UINT8_C(235), UINT8_C( 62), UINT8_C( 62), UINT8_C( 36),
+        UINT8_C(201), UINT8_C(248), UINT8_C(  3), UINT8_C(227), UINT8_C(222), UINT8_C(131), UINT8_C( 77), UINT8_C(193),
+        UINT8_C( 30), UINT8_C(  7), UINT8_C(131), UINT8_C( 40), UINT8_C(240), UINT8_C(114), UINT8_C(128), UINT8_C( 51),
+        UINT8_C(101), UINT8_C( 21), UINT8_C(132), UINT8_C(236), UINT8_C(157), UINT8_C(149), UINT8_C(220), UINT8_C(172),
+        UINT8_C(161), UINT8_C(149), UINT8_C( 71), UINT8_C(102), UINT8_C(248), UINT8_C(180), UINT8_C( 67), UINT8_C( 50),
+        UINT8_C(122), UINT8_C(202), UINT8_C(238), UINT8_C( 26), UINT8_C(219), UINT8_C( 14), UINT8_C(  9), UINT8_C(  9),
+        UINT8_C(152), UINT8_C( 54), UINT8_C( 88), UINT8_C( 74), UINT8_C( 97), UINT8_C( 28), UINT8_C(189), UINT8_C( 38) } },
+    { { UINT8_C(251), UINT8_C( 78), UINT8_C(212), UINT8_C(175), UINT8_C(120), UINT8_C(196), UINT8_C( 71), UINT8_C(203),
+        UINT8_C(128), UINT8_C(229), UINT8_C( 82), UINT8_C( 12), UINT8_C(120), UINT8_C(144), UINT8_C(179), UINT8_C(120),
+        UINT8_C(128), UINT8_C(131), UINT8_C( 86), UINT8_C( 90), UINT8_C(212), UINT8_C( 47), UINT8_C(209), UINT8_C(238),
+        UINT8_C(123), UINT8_C( 11), UINT8_C( 81), UINT8_C( 75), UINT8_C( 21), UINT8_C(145), UINT8_C( 54), UINT8_C(176),
+        UINT8_C(  5), UINT8_C(  7), UINT8_C(109), UINT8_C(177), UINT8_C( 82), UINT8_C(104), UINT8_C( 76), UINT8_C( 84),
+        UINT8_C(196), UINT8_C( 37), UINT8_C(199), UINT8_C(180), UINT8_C( 23), UINT8_C(  5), UINT8_C( 25), UINT8_C(201),
+        UINT8_C(132), UINT8_C( 75), UINT8_C( 95), UINT8_C( 71), UINT8_C(173), UINT8_C(194), UINT8_C(  9), UINT8_C( 61),
+        UINT8_C(237), UINT8_C(222), UINT8_C( 57), UINT8_C(107), UINT8_C(185), UINT8_C( 52), UINT8_C(162), UINT8_C(127) },
+      { UINT8_C(203), UINT8_C( 98), UINT8_C(116), UINT8_C(174), UINT8_C(133), UINT8_C(182), UINT8_C(249), UINT8_C( 28),
+        UINT8_C(168), UINT8_C(137), UINT8_C(158), UINT8_C(179), UINT8_C(188), UINT8_C(227), UINT8_C(120), UINT8_C( 70),
+        UINT8_C(248), UINT8_C(135), UINT8_C(168), UINT8_C(237), UINT8_C(208), UINT8_C(101), UINT8_C(  5), UINT8_C(149),
+        UINT8_C(208), UINT8_C( 27), UINT8_C( 35), UINT8_C(229), UINT8_C(238), UINT8_C(245), UINT8_C( 30), UINT8_C( 32),
+        UINT8_C(238), UINT8_C( 13), UINT8_C(195), UINT8_C(144), UINT8_C(111), UINT8_C(219), UINT8_C(220), UINT8_C( 27),
+        UINT8_C( 93), UINT8_C( 43), UINT8_C( 91), UINT8_C(  9), UINT8_C(113), UINT8_C(  9), UINT8_C(175), UINT8_C(170),
+        UINT8_C( 57), UINT8_C(181), UINT8_C(238), UINT8_C( 45), UINT8_C( 75), UINT8_C(251), UINT8_C( 94), UINT8_C(250),
+        UINT8_C(155), UINT8_C(162), UINT8_C( 23), UINT8_C(115), UINT8_C(127), UINT8_C(211), UINT8_C( 64), UINT8_C( 66) },
+      { UINT8_C(168), UINT8_C(244), UINT8_C( 60), UINT8_C(247), UINT8_C( 68), UINT8_C(  0), UINT8_C(178), UINT8_C(157),
+        UINT8_C(146), UINT8_C(  1), UINT8_C(135), UINT8_C(114), UINT8_C(125), UINT8_C(201), UINT8_C(110), UINT8_C( 93),
+        UINT8_C(194), UINT8_C( 43), UINT8_C(216), UINT8_C(116), UINT8_C(201), UINT8_C( 36), UINT8_C( 33), UINT8_C( 89),
+        UINT8_C(211), UINT8_C( 85), UINT8_C(154), UINT8_C( 25), UINT8_C(193), UINT8_C(107), UINT8_C( 79), UINT8_C(102),
+        UINT8_C(216), UINT8_C( 59), UINT8_C(242), UINT8_C(109), UINT8_C( 39), UINT8_C(227), UINT8_C( 82), UINT8_C(221),
+        UINT8_C(213), UINT8_C(220), UINT8_C(232), UINT8_C( 27), UINT8_C(246), UINT8_C(203), UINT8_C(242), UINT8_C(252),
+        UINT8_C(118), UINT8_C(157), UINT8_C(181), UINT8_C(166), UINT8_C( 83), UINT8_C( 55), UINT8_C( 68), UINT8_C(255),
+        UINT8_C(200), UINT8_C( 10), UINT8_C(147), UINT8_C( 24), UINT8_C(164), UINT8_C( 79), UINT8_C(  0), UINT8_C( 84) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i round_key = simde_mm512_loadu_si512(test_vec[i].round_key);
+    simde__m512i r = simde_mm512_aesdeclast_epi128(a, round_key);
+    simde_test_x86_assert_equal_u8x64(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+/* FIPS-197 appendix C.1, using every 128-bit function. */
+static int
+test_simde_x_aes128_fips197(SIMDE_MUNIT_TEST_ARGS) {
+  static const uint8_t key[16] = {
+    UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x02), UINT8_C(0x03), UINT8_C(0x04), UINT8_C(0x05), UINT8_C(0x06), UINT8_C(0x07),
+    UINT8_C(0x08), UINT8_C(0x09), UINT8_C(0x0a), UINT8_C(0x0b), UINT8_C(0x0c), UINT8_C(0x0d), UINT8_C(0x0e), UINT8_C(0x0f) };
+  static const uint8_t plaintext[16] = {
+    UINT8_C(0x00), UINT8_C(0x11), UINT8_C(0x22), UINT8_C(0x33), UINT8_C(0x44), UINT8_C(0x55), UINT8_C(0x66), UINT8_C(0x77),
+    UINT8_C(0x88), UINT8_C(0x99), UINT8_C(0xaa), UINT8_C(0xbb), UINT8_C(0xcc), UINT8_C(0xdd), UINT8_C(0xee), UINT8_C(0xff) };
+  static const uint8_t ciphertext[16] = {
+    UINT8_C(0x69), UINT8_C(0xc4), UINT8_C(0xe0), UINT8_C(0xd8), UINT8_C(0x6a), UINT8_C(0x7b), UINT8_C(0x04), UINT8_C(0x30),
+    UINT8_C(0xd8), UINT8_C(0xcd), UINT8_C(0xb7), UINT8_C(0x80), UINT8_C(0x70), UINT8_C(0xb4), UINT8_C(0xc5), UINT8_C(0x5a) };
+  simde__m128i rk[11], t, s;
+
+  #define SIMDE_TEST_AES128_EXPAND_(i, rcon) \
+    t = simde_mm_shuffle_epi32(simde_mm_aeskeygenassist_si128(rk[i - 1], rcon), 0xff); \
+    s = simde_mm_xor_si128(rk[i - 1], simde_mm_slli_si128(rk[i - 1], 4)); \
+    s = simde_mm_xor_si128(s, simde_mm_slli_si128(s, 8)); \
+    rk[i] = simde_mm_xor_si128(s, t)
+
+  rk[0] = simde_mm_loadu_si128(key);
+  SIMDE_TEST_AES128_EXPAND_( 1, 0x01);
+  SIMDE_TEST_AES128_EXPAND_( 2, 0x02);
+  SIMDE_TEST_AES128_EXPAND_( 3, 0x04);
+  SIMDE_TEST_AES128_EXPAND_( 4, 0x08);
+  SIMDE_TEST_AES128_EXPAND_( 5, 0x10);
+  SIMDE_TEST_AES128_EXPAND_( 6, 0x20);
+  SIMDE_TEST_AES128_EXPAND_( 7, 0x40);
+  SIMDE_TEST_AES128_EXPAND_( 8, 0x80);
+  SIMDE_TEST_AES128_EXPAND_( 9, 0x1b);
+  SIMDE_TEST_AES128_EXPAND_(10, 0x36);
+  #undef SIMDE_TEST_AES128_EXPAND_
+
+  s = simde_mm_xor_si128(simde_mm_loadu_si128(plaintext), rk[0]);
+  for (size_t i = 1 ; i < 10 ; i++)
+    s = simde_mm_aesenc_si128(s, rk[i]);
+  s = simde_mm_aesenclast_si128(s, rk[10]);
+  simde_test_x86_assert_equal_u8x16(s, simde_mm_loadu_si128(ciphertext));
+
+  s = simde_mm_xor_si128(s, rk[10]);
+  for (size_t i = 9 ; i > 0 ; i--)
+    s = simde_mm_aesdec_si128(s, simde_mm_aesimc_si128(rk[i]));
+  s = simde_mm_aesdeclast_si128(s, rk[0]);
+  simde_test_x86_assert_equal_u8x16(s, simde_mm_loadu_si128(plaintext));
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenc_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenclast_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdec_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdeclast_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesimc_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aeskeygenassist_si128)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesenc_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesenclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesdec_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesdeclast_epi128)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesenc_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesenclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesdec_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesdeclast_epi128)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_aes128_fips197)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
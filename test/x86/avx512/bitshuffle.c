@@ -0,0 +1,515 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN bitshuffle
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/bitshuffle.h>
+
+static int
+test_simde_mm_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t b[2];
+    const int8_t c[16];
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { { -INT64_C( 6879212144777232352), -INT64_C(   92429349772337217) },
+      { -INT8_C(  88),  INT8_C( 115),  INT8_C(  77),  INT8_C( 119), -INT8_C(  81), -INT8_C(  33),  INT8_C( 101),  INT8_C( 100),
+        -INT8_C(  57), -INT8_C(  24),  INT8_C(  30),  INT8_C(  67),  INT8_C(  57), -INT8_C(  34), -INT8_C(  26),  INT8_C(  80) },
+      UINT16_C(65323) },
+    { { -INT64_C( 3610373031004413861), -INT64_C( 5764607523311067139) },
+      {  INT8_C(   2), -INT8_C(  90),  INT8_C(  17),  INT8_C(  31), -INT8_C( 104),  INT8_C(  86),  INT8_C(   7),  INT8_C(  21),
+         INT8_C(  70),  INT8_C(  52), -INT8_C(  38), -INT8_C(   6),  INT8_C(  97),  INT8_C( 103), -INT8_C( 107), -INT8_C(   3) },
+      UINT16_C(65314) },
+    { { -INT64_C( 7239771185830217753), -INT64_C( 9220552884544864256) },
+      { -INT8_C( 106), -INT8_C(  93), -INT8_C(  94),  INT8_C(  93),  INT8_C(  46), -INT8_C(  35),  INT8_C(  24), -INT8_C(  65),
+        -INT8_C(  33),  INT8_C( 124), -INT8_C( 125), -INT8_C(  84),  INT8_C(  49),  INT8_C(  69),  INT8_C( 115), -INT8_C(  97) },
+      UINT16_C(20717) },
+    { {  INT64_C( 5189535611963938000),  INT64_C( 2235461968984586535) },
+      { -INT8_C(  47), -INT8_C(   1),  INT8_C(  22),  INT8_C(  71),  INT8_C(  71),  INT8_C(  30),  INT8_C(   7),  INT8_C(  41),
+        -INT8_C(  67),  INT8_C( 105),  INT8_C(  29), -INT8_C(  81), -INT8_C( 122), -INT8_C( 106),  INT8_C(  23),  INT8_C( 108) },
+      UINT16_C(35068) },
+    { {  INT64_C( 9223136741315048951), -INT64_C( 7462692995709667189) },
+      { -INT8_C(  45),  INT8_C(  24),  INT8_C(  65),  INT8_C( 121),  INT8_C( 100),  INT8_C(  60),  INT8_C( 115), -INT8_C(  35),
+        -INT8_C(  99), -INT8_C(  16),  INT8_C( 125),  INT8_C(  17), -INT8_C( 111),  INT8_C(  36),  INT8_C( 125), -INT8_C(  76) },
+      UINT16_C( 1021) },
+    { { -INT64_C( 3221713947138449029), -INT64_C(  235364757817422802) },
+      {  INT8_C( 108),  INT8_C(   5),  INT8_C(  88), -INT8_C(  75), -INT8_C( 111),  INT8_C(  94), -INT8_C(  16),  INT8_C( 120),
+         INT8_C(  67),  INT8_C(  91),  INT8_C(  77), -INT8_C( 121),  INT8_C(  48),  INT8_C(  10), -INT8_C(  96), -INT8_C( 113) },
+      UINT16_C(61826) },
+    { {  INT64_C( 7155389509518591140),  INT64_C(           142868992) },
+      { -INT8_C( 106), -INT8_C( 127),  INT8_C(  72), -INT8_C( 123), -INT8_C(  17), -INT8_C(  51),  INT8_C(  91), -INT8_C(   3),
+         INT8_C(  64),  INT8_C(  29),  INT8_C(   8), -INT8_C(  12),  INT8_C(  37), -INT8_C(  58),  INT8_C(  50),  INT8_C(   0) },
+      UINT16_C(  201) },
+    { { -INT64_C( 9211066711284142558),  INT64_C( 4585872131890470988) },
+      {  INT8_C(  53), -INT8_C( 102), -INT8_C(  82), -INT8_C(  22),  INT8_C(  84),  INT8_C(  74), -INT8_C(  72), -INT8_C(  62),
+        -INT8_C(  27),  INT8_C(  94),  INT8_C(   8), -INT8_C( 113), -INT8_C(  21), -INT8_C( 104), -INT8_C(  67), -INT8_C(  15) },
+      UINT16_C(22843) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi8(test_vec[i].c);
+    simde__mmask16 r = simde_mm_bitshuffle_epi64_mask(b, c);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int64_t b[2];
+    const int8_t c[16];
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(50695),
+      { -INT64_C(   33777547498487809), -INT64_C(  738313127762866399) },
+      {  INT8_C(  99), -INT8_C( 117), -INT8_C( 115), -INT8_C(  58), -INT8_C(  24),  INT8_C(  80),  INT8_C( 124), -INT8_C(  22),
+        -INT8_C(  13), -INT8_C( 100),  INT8_C(   8),  INT8_C(  63), -INT8_C(  92), -INT8_C(  17),  INT8_C( 109),  INT8_C( 120) },
+      UINT16_C(50695) },
+    { UINT16_C(27440),
+      {  INT64_C( 4846930251016647929),  INT64_C( 2305843700720273536) },
+      {  INT8_C(  54),  INT8_C(  66),  INT8_C( 124),  INT8_C( 114),  INT8_C(  32), -INT8_C( 117), -INT8_C(  27),  INT8_C(  97),
+         INT8_C(  13), -INT8_C(  56),  INT8_C(  27),  INT8_C(  65), -INT8_C(  76),  INT8_C(  94), -INT8_C( 118),  INT8_C( 108) },
+      UINT16_C(    0) },
+    { UINT16_C(17436),
+      { -INT64_C( 4756997492334231571), -INT64_C(     566043406237733) },
+      { -INT8_C(  91), -INT8_C(  36), -INT8_C(  88), -INT8_C(  47),  INT8_C(  90), -INT8_C(   2), -INT8_C(  18), -INT8_C( 104),
+        -INT8_C(  88), -INT8_C(  46), -INT8_C( 114), -INT8_C(  76),  INT8_C(  11), -INT8_C( 109),  INT8_C( 104),  INT8_C( 119) },
+      UINT16_C(17436) },
+    { UINT16_C(61029),
+      { -INT64_C( 1229844273002810399),  INT64_C(  288265595085389856) },
+      { -INT8_C(  17), -INT8_C(  91), -INT8_C( 118), -INT8_C(  46),  INT8_C(  24), -INT8_C(  21), -INT8_C(  35),  INT8_C(  17),
+         INT8_C( 109), -INT8_C(  42), -INT8_C(   5),  INT8_C(  29), -INT8_C(  33),  INT8_C(  13), -INT8_C(  44), -INT8_C(  91) },
+      UINT16_C(    1) },
+    { UINT16_C(38886),
+      { -INT64_C( 5800636389318656553), -INT64_C(  576461302059239425) },
+      { -INT8_C(  30),  INT8_C( 115),  INT8_C( 119), -INT8_C(  56), -INT8_C(  35),  INT8_C( 126), -INT8_C(  73), -INT8_C( 121),
+         INT8_C(   5),  INT8_C(  75),  INT8_C(  20), -INT8_C(   8),  INT8_C(  69),  INT8_C(  63),  INT8_C(  72), -INT8_C(  82) },
+      UINT16_C(38274) },
+    { UINT16_C(46271),
+      {  INT64_C( 4323460042603909122),  INT64_C( 1769914656788316224) },
+      {  INT8_C( 101),  INT8_C(  97),  INT8_C( 114),  INT8_C(  75),  INT8_C(  88), -INT8_C(  71), -INT8_C(  17),  INT8_C(  85),
+         INT8_C(   7),  INT8_C(  64),  INT8_C(  35),  INT8_C(  72), -INT8_C(  12), -INT8_C( 111), -INT8_C(  50), -INT8_C(  60) },
+      UINT16_C( 4096) },
+    { UINT16_C(63667),
+      {  INT64_C( 3989223859848468601), -INT64_C( 1831840574252412460) },
+      { -INT8_C(  91),  INT8_C(  17), -INT8_C(   1),  INT8_C( 112),  INT8_C(  87), -INT8_C( 109),  INT8_C(  98), -INT8_C(  53),
+        -INT8_C( 103),  INT8_C( 108),  INT8_C(  64), -INT8_C(  82), -INT8_C(  61), -INT8_C(   9), -INT8_C(   7),  INT8_C( 107) },
+      UINT16_C(59539) },
+    { UINT16_C( 1835),
+      { -INT64_C(    9018469257325313), -INT64_C(  288652588619161601) },
+      {  INT8_C(  56), -INT8_C(  45),  INT8_C(  60),  INT8_C(  49),  INT8_C(  65), -INT8_C(  39), -INT8_C(  36),  INT8_C(  19),
+         INT8_C(  63), -INT8_C(  54),  INT8_C(  23),  INT8_C( 116), -INT8_C(  35), -INT8_C(  87), -INT8_C( 114),  INT8_C(  12) },
+      UINT16_C( 1835) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi8(test_vec[i].c);
+    simde__mmask16 r = simde_mm_mask_bitshuffle_epi64_mask(test_vec[i].k, b, c);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t b[4];
+    const int8_t c[32];
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { { -INT64_C( 2308525818927784065),  INT64_C( 4148383693408763149),  INT64_C( 1369094287257501702), -INT64_C( 5697551021296001653) },
+      {  INT8_C(  51),  INT8_C(  98),  INT8_C(  27), -INT8_C( 102),  INT8_C(  93),  INT8_C( 121),  INT8_C(  55), -INT8_C(  63),
+        -INT8_C(  82),  INT8_C(  89),  INT8_C(  85),      INT8_MAX, -INT8_C( 120), -INT8_C(  44), -INT8_C(   6),  INT8_C(  79),
+         INT8_C(  12),  INT8_C(  44), -INT8_C( 100), -INT8_C(  94),  INT8_C( 117),  INT8_C(  34), -INT8_C(  26), -INT8_C(  37),
+        -INT8_C(  47),  INT8_C(  70),  INT8_C( 121), -INT8_C(  25),  INT8_C(  78), -INT8_C( 120),  INT8_C(  12),  INT8_C(  39) },
+      UINT32_C(4160787710) },
+    { {  INT64_C( 5188146788448605760), -INT64_C(  752752771622870233), -INT64_C( 3458905251313090755),  INT64_C(   36592108286509186) },
+      { -INT8_C(  35),  INT8_C(  79), -INT8_C(  39),  INT8_C( 103), -INT8_C( 105),  INT8_C( 121), -INT8_C(  46), -INT8_C( 102),
+        -INT8_C(  49),  INT8_C(  89),  INT8_C(  45),  INT8_C(  89),  INT8_C(  63), -INT8_C(  38), -INT8_C(  36), -INT8_C( 114),
+        -INT8_C(  94),  INT8_C(  90),  INT8_C(  85), -INT8_C(  47), -INT8_C( 123), -INT8_C(   1), -INT8_C(   6),  INT8_C( 110),
+         INT8_C(  28),  INT8_C(   3),  INT8_C(  10),  INT8_C(  78), -INT8_C(  34), -INT8_C(  27),  INT8_C(  69),  INT8_C(  43) },
+      UINT32_C(  16752129) },
+    { { -INT64_C( 2308132467302745093), -INT64_C(      37520839032865),  INT64_C( 2080825372347568135), -INT64_C( 4237707895864329861) },
+      { -INT8_C( 102), -INT8_C(  61), -INT8_C(  49),  INT8_C(  19), -INT8_C(  76), -INT8_C(  46), -INT8_C( 117), -INT8_C(  46),
+        -INT8_C(  17),  INT8_C(  61),  INT8_C(  15), -INT8_C( 105), -INT8_C( 117),  INT8_C(  52), -INT8_C( 118), -INT8_C( 119),
+        -INT8_C(   5), -INT8_C(  64), -INT8_C( 106),  INT8_C(  96),  INT8_C(  49), -INT8_C( 120),  INT8_C(  20),  INT8_C(  33),
+         INT8_C(  93), -INT8_C(  36), -INT8_C(   4), -INT8_C(  96),  INT8_C( 122), -INT8_C(  44),  INT8_C(  30),  INT8_C(  20) },
+      UINT32_C(1401421823) },
+    { {  INT64_C(  144678344457240576),  INT64_C( 6917674459530805536),  INT64_C(  576465780099514882),  INT64_C(    1165500646228496) },
+      {  INT8_C( 116),  INT8_C( 123), -INT8_C(   7), -INT8_C(  73), -INT8_C(  57),  INT8_C(  25), -INT8_C(  95),  INT8_C(  90),
+         INT8_C(  10), -INT8_C( 119),  INT8_C( 115),  INT8_C(  81),  INT8_C(   3), -INT8_C(  64),  INT8_C(  15), -INT8_C( 120),
+         INT8_C(  96),  INT8_C(  51),  INT8_C(  62), -INT8_C( 118),  INT8_C(  26),  INT8_C(  90), -INT8_C( 126), -INT8_C(  77),
+        -INT8_C(  56), -INT8_C(  17), -INT8_C(  20),  INT8_C(  42), -INT8_C(  22),  INT8_C(  71),  INT8_C( 109),  INT8_C(  12) },
+      UINT32_C(1476427780) },
+    { {  INT64_C( 2305843010292424705), -INT64_C( 4332623897851234467), -INT64_C( 5261316201660112829), -INT64_C(      88184278024209) },
+      { -INT8_C(  89),  INT8_C(  30),  INT8_C(  65),  INT8_C(  62), -INT8_C( 125), -INT8_C(  94),  INT8_C(  15),  INT8_C(  52),
+         INT8_C(  36),  INT8_C(  54),  INT8_C( 100),  INT8_C(  64),  INT8_C(  28),  INT8_C(  59),  INT8_C(  58),  INT8_C(   2),
+         INT8_C(  50), -INT8_C(  67), -INT8_C(  84), -INT8_C(  88), -INT8_C(  59),  INT8_C(  79),  INT8_C(   8), -INT8_C(  26),
+         INT8_C(  70), -INT8_C( 113),  INT8_C(  61),  INT8_C(  56),  INT8_C(  85), -INT8_C(   9),  INT8_C(  34),  INT8_C(  58) },
+      UINT32_C(3215165954) },
+    { {  INT64_C( 3334006789804441527),  INT64_C(   40532407392141312),  INT64_C( 8998455268029453150),  INT64_C( 4457688504739870095) },
+      { -INT8_C(  65),  INT8_C(  12),  INT8_C( 126), -INT8_C(  30),  INT8_C(  38),  INT8_C( 116),  INT8_C(  53), -INT8_C(  74),
+        -INT8_C(  69), -INT8_C(  92),  INT8_C(  66), -INT8_C(   6), -INT8_C(  12), -INT8_C(  17), -INT8_C(   8), -INT8_C(  17),
+         INT8_C(  51), -INT8_C( 127), -INT8_C( 107), -INT8_C(  23), -INT8_C(  89),  INT8_C(  78), -INT8_C(  20),  INT8_C(  31),
+         INT8_C( 126), -INT8_C(  93),  INT8_C( 103),  INT8_C(   7),  INT8_C( 122), -INT8_C(   8), -INT8_C( 120),  INT8_C(  83) },
+      UINT32_C(4172157058) },
+    { {  INT64_C( 5364752657625993369), -INT64_C( 8531798525268888470),  INT64_C(     352118615703680), -INT64_C(  720576062896998705) },
+      {  INT8_C( 126), -INT8_C(  17), -INT8_C(  75),  INT8_C(  99), -INT8_C(  62),  INT8_C(  98),  INT8_C(   0),  INT8_C( 102),
+        -INT8_C( 110),  INT8_C(  60), -INT8_C(  38), -INT8_C(  76),  INT8_C(  19),  INT8_C(  73),  INT8_C(  23), -INT8_C( 126),
+        -INT8_C( 102), -INT8_C( 110),  INT8_C(  53), -INT8_C(  60), -INT8_C(  88), -INT8_C(  67), -INT8_C( 123),  INT8_C( 123),
+        -INT8_C(  13), -INT8_C(  13), -INT8_C(  51), -INT8_C(  14), -INT8_C(  29), -INT8_C(  16),  INT8_C( 107), -INT8_C(  74) },
+      UINT32_C(4009758061) },
+    { {  INT64_C( 6638932681165340686), -INT64_C( 7980346315160993168), -INT64_C( 4646416667139428379),  INT64_C( 5177421053646371738) },
+      {  INT8_C(  93),  INT8_C(  47),  INT8_C(   4),  INT8_C(  32), -INT8_C(  70), -INT8_C(   5),  INT8_C(  74),  INT8_C(  31),
+         INT8_C( 126), -INT8_C(  48), -INT8_C(  71), -INT8_C(  19), -INT8_C(  44), -INT8_C(  90), -INT8_C(  15),  INT8_C( 124),
+        -INT8_C(  87),  INT8_C(  14),  INT8_C(  59),  INT8_C( 120), -INT8_C(  19),  INT8_C(   5),  INT8_C(  13),  INT8_C(  35),
+         INT8_C( 105), -INT8_C(  92), -INT8_C(  20), -INT8_C(  62), -INT8_C(  40),  INT8_C(  44), -INT8_C( 104),  INT8_C(  51) },
+      UINT32_C(3505173048) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi8(test_vec[i].c);
+    simde__mmask32 r = simde_mm256_bitshuffle_epi64_mask(b, c);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int64_t b[4];
+    const int8_t c[32];
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(1291941689),
+      { -INT64_C( 1154891831725523457),  INT64_C(      70369018905184), -INT64_C( 9209860649271558144),  INT64_C( 2308094830502250497) },
+      {  INT8_C(  13),  INT8_C(  85),  INT8_C(  85), -INT8_C( 111), -INT8_C( 101), -INT8_C(  51),  INT8_C( 107), -INT8_C(  98),
+         INT8_C( 106), -INT8_C(  44), -INT8_C( 100),  INT8_C(   4), -INT8_C(  96), -INT8_C( 118),  INT8_C( 122),  INT8_C(   5),
+        -INT8_C(  26), -INT8_C(  38),  INT8_C(  13),  INT8_C(   6), -INT8_C(  10),  INT8_C(  24), -INT8_C(  74),  INT8_C( 109),
+         INT8_C(  49), -INT8_C(  98), -INT8_C( 104),  INT8_C(   3), -INT8_C(  50), -INT8_C(  93),  INT8_C(  32),  INT8_C(  26) },
+      UINT32_C(1073742889) },
+    { UINT32_C(4027304248),
+      {  INT64_C(  774001695789377844), -INT64_C(    7464653831536641), -INT64_C(  578857704865562657),  INT64_C( 3572277194111128837) },
+      { -INT8_C(  31),  INT8_C( 124), -INT8_C(  83), -INT8_C(  65), -INT8_C(  55),  INT8_C(  55), -INT8_C( 125),  INT8_C(  47),
+        -INT8_C(  56), -INT8_C(  98),      INT8_MAX,  INT8_C(  59),  INT8_C(  69), -INT8_C(   4),  INT8_C( 122),  INT8_C(  41),
+         INT8_C(  10),  INT8_C(  20), -INT8_C(  84),  INT8_C(  99),  INT8_C(  85),  INT8_C( 126),  INT8_C(  46),  INT8_C(  46),
+        -INT8_C(  54), -INT8_C( 106), -INT8_C( 122),  INT8_C( 110),  INT8_C(  80), -INT8_C(  90), -INT8_C(  20), -INT8_C(  26) },
+      UINT32_C( 269207840) },
+    { UINT32_C(3081892083),
+      { -INT64_C( 4129607204987756506),  INT64_C(  926477432759654061), -INT64_C(  228934736100217685), -INT64_C(   77267651092549121) },
+      {  INT8_C(  19), -INT8_C( 121), -INT8_C(  63), -INT8_C(  53), -INT8_C(   4),  INT8_C(  41), -INT8_C(  62),  INT8_C(  85),
+        -INT8_C( 102),  INT8_C( 124),  INT8_C(  97), -INT8_C(  68),  INT8_C(  97), -INT8_C( 110),  INT8_C(  33),  INT8_C(  84),
+         INT8_C( 101),  INT8_C(  49),  INT8_C(  31),  INT8_C(  33), -INT8_C(  49), -INT8_C(   3), -INT8_C( 119), -INT8_C(  27),
+         INT8_C(  96),  INT8_C( 102), -INT8_C(  38),  INT8_C(  50),  INT8_C(  76),  INT8_C(  31), -INT8_C(  33), -INT8_C(  25) },
+      UINT32_C( 389029953) },
+    { UINT32_C(1964236341),
+      {  INT64_C( 1232143695201844535), -INT64_C( 9164454888245870623), -INT64_C( 6081312802233371141),  INT64_C( 8229834771273511753) },
+      {  INT8_C(  62),  INT8_C(  10), -INT8_C(  19), -INT8_C(  67), -INT8_C(  30), -INT8_C( 102), -INT8_C(  94),  INT8_C( 114),
+         INT8_C(  28),  INT8_C(  99), -INT8_C(  29),  INT8_C(  29),  INT8_C(  96),  INT8_C(  99),  INT8_C(  85),  INT8_C(  30),
+        -INT8_C(  13),  INT8_C(  85),  INT8_C(  22),  INT8_C(  75), -INT8_C(  91), -INT8_C(  65),  INT8_C(  57),  INT8_C(  79),
+        -INT8_C(  34), -INT8_C(  46),  INT8_C(  55), -INT8_C(  43),  INT8_C(  27),  INT8_C(  82),  INT8_C( 124), -INT8_C(  76) },
+      UINT32_C(1091639300) },
+    { UINT32_C(4037588132),
+      { -INT64_C( 9196335044818370304), -INT64_C(   22517998141083651), -INT64_C( 6030140348841552084),  INT64_C( 1736199560094751177) },
+      {  INT8_C( 114),  INT8_C( 120), -INT8_C(  10), -INT8_C(  62),  INT8_C(  69),  INT8_C(   0),  INT8_C(  76), -INT8_C(  91),
+        -INT8_C(  16), -INT8_C(  21),  INT8_C(  97),  INT8_C(  71), -INT8_C(  36),  INT8_C(  81), -INT8_C(  73), -INT8_C(  82),
+         INT8_C(  36),  INT8_C(  39),  INT8_C(  21),  INT8_C(  68), -INT8_C( 104), -INT8_C(  98), -INT8_C(  30), -INT8_C( 124),
+        -INT8_C(  33),  INT8_C(  42), -INT8_C(  18),  INT8_C(  50), -INT8_C(  64),  INT8_C( 125), -INT8_C( 102), -INT8_C(  34) },
+      UINT32_C(1344320516) },
+    { UINT32_C(1269734002),
+      { -INT64_C( 1193456168995917889),  INT64_C( 5768331145490785803),  INT64_C(    1479955670107264),  INT64_C( 2454637727904178692) },
+      {  INT8_C( 114),  INT8_C(   7), -INT8_C(  19), -INT8_C( 111), -INT8_C(  69), -INT8_C(  51), -INT8_C(  72), -INT8_C(  33),
+        -INT8_C(  88), -INT8_C(  18), -INT8_C(  63),  INT8_C(  64), -INT8_C(  37), -INT8_C(  52), -INT8_C(  61),  INT8_C(  91),
+        -INT8_C( 101), -INT8_C(  73),  INT8_C(  79),  INT8_C( 120),  INT8_C( 110), -INT8_C(  66), -INT8_C(  11),  INT8_C( 102),
+         INT8_C(  70), -INT8_C(  11),  INT8_C(  67),  INT8_C( 119), -INT8_C(  45), -INT8_C(  52),  INT8_C( 101),  INT8_C(  46) },
+      UINT32_C(     39026) },
+    { UINT32_C(3472751121),
+      { -INT64_C( 1441761018798931969),  INT64_C( 3448233654624011681),  INT64_C(     301576498054148), -INT64_C(  144123984187752577) },
+      {  INT8_C(  43), -INT8_C( 109), -INT8_C(  15), -INT8_C(  42), -INT8_C(  20), -INT8_C(  39), -INT8_C(  36),  INT8_C(  31),
+        -INT8_C( 105), -INT8_C(  20), -INT8_C(   6),  INT8_C(  36), -INT8_C(  47),  INT8_C(  30), -INT8_C( 116),  INT8_C(  60),
+         INT8_C( 124), -INT8_C(  78),  INT8_C(  53), -INT8_C( 109),  INT8_C(  43), -INT8_C(  80), -INT8_C(  34),  INT8_C(  55),
+         INT8_C(   9),  INT8_C( 121), -INT8_C(  33),  INT8_C(  83),  INT8_C(  32), -INT8_C(  10),  INT8_C(   7), -INT8_C( 111) },
+      UINT32_C(2355636752) },
+    { UINT32_C(2848273376),
+      { -INT64_C( 7846379088603486826),  INT64_C( 1765411054633878536),  INT64_C( 9223371993804177151),  INT64_C( 9049381525554703193) },
+      {  INT8_C(  67), -INT8_C(  22), -INT8_C( 126), -INT8_C(  57),  INT8_C(  57),  INT8_C( 111), -INT8_C(  40),  INT8_C(  75),
+        -INT8_C(  61),  INT8_C(  61),  INT8_C(  64),  INT8_C(  90), -INT8_C( 124), -INT8_C( 121), -INT8_C(  88), -INT8_C(   8),
+        -INT8_C( 127),  INT8_C(  19),  INT8_C(   9),  INT8_C(  48),  INT8_C( 112),  INT8_C( 101), -INT8_C(  39), -INT8_C( 112),
+         INT8_C(  72),  INT8_C(  17), -INT8_C( 103),  INT8_C(   5), -INT8_C(  76), -INT8_C( 115), -INT8_C(   4),  INT8_C(   4) },
+      UINT32_C(2709848320) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi8(test_vec[i].c);
+    simde__mmask32 r = simde_mm256_mask_bitshuffle_epi64_mask(test_vec[i].k, b, c);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t b[8];
+    const int8_t c[64];
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { { -INT64_C(   50703319481737257), -INT64_C( 1013954990846455572), -INT64_C(     319171906830341),  INT64_C(  153404961818935872),
+         INT64_C( 7970783470219752892),  INT64_C(          4311744513), -INT64_C(       1111608786949),  INT64_C( 2709940326428748280) },
+      {  INT8_C(  66),  INT8_C(  31),  INT8_C(  38), -INT8_C(  85),  INT8_C(  71), -INT8_C( 115),  INT8_C(  27),  INT8_C(  82),
+        -INT8_C(  53),  INT8_C(  60), -INT8_C(  20),  INT8_C(  75), -INT8_C(  48), -INT8_C(  21),  INT8_C(  19),  INT8_C(  40),
+        -INT8_C( 101),  INT8_C( 106), -INT8_C(  38), -INT8_C(  58),  INT8_C( 101), -INT8_C( 117), -INT8_C(  57),  INT8_C( 116),
+         INT8_C(   3),  INT8_C(  74), -INT8_C( 124), -INT8_C(  30), -INT8_C(  66), -INT8_C( 110),  INT8_C( 109), -INT8_C(  88),
+         INT8_C(  25), -INT8_C( 109), -INT8_C(   8), -INT8_C( 116), -INT8_C(  49), -INT8_C(  32),  INT8_C(  72),  INT8_C(  16),
+        -INT8_C(  70),  INT8_C(   7),  INT8_C(  42), -INT8_C(  55), -INT8_C(  99),  INT8_C(  86), -INT8_C(  74), -INT8_C(  72),
+        -INT8_C( 103),  INT8_C(  12),  INT8_C( 112),  INT8_C(  27), -INT8_C(  45), -INT8_C(  66),  INT8_C( 105), -INT8_C(  48),
+         INT8_C(  18), -INT8_C( 118),  INT8_C(  39), -INT8_C( 107),  INT8_C(  38), -INT8_C(  28), -INT8_C(  57),  INT8_C( 105) },
+      UINT64_C( 8137723569242097241) },
+    { {  INT64_C( 3548837056145330212),  INT64_C( 4438717998385817929), -INT64_C(  865254147396993579), -INT64_C(  576461322511187969),
+        -INT64_C( 1001210428110158473), -INT64_C( 7957918801895495540), -INT64_C( 4630272180167395463), -INT64_C( 1523189188566291184) },
+      { -INT8_C(  16), -INT8_C(  29),  INT8_C(  70), -INT8_C(  70),  INT8_C( 119),  INT8_C(  30), -INT8_C(  51),  INT8_C( 102),
+         INT8_C( 124),  INT8_C( 115),  INT8_C(  81),  INT8_C(   5), -INT8_C(  22),  INT8_C(  91), -INT8_C(   1), -INT8_C(  64),
+         INT8_C(  60), -INT8_C( 121), -INT8_C(  41), -INT8_C(  45),  INT8_C(   9), -INT8_C(  69), -INT8_C(  45),  INT8_C(  34),
+         INT8_C(  88), -INT8_C(   2), -INT8_C(   4),  INT8_C(  81),  INT8_C(   6),  INT8_C( 107),  INT8_C(  53), -INT8_C( 124),
+         INT8_C( 103),  INT8_C(   6), -INT8_C( 127), -INT8_C(  14), -INT8_C(  58),  INT8_C(  71),  INT8_C(  33),  INT8_C(   8),
+         INT8_C(  14),  INT8_C(  52),  INT8_C(  61), -INT8_C(   7),  INT8_C(  25),  INT8_C(  25), -INT8_C(  14), -INT8_C(  64),
+        -INT8_C( 125),  INT8_C(  57),  INT8_C(  51), -INT8_C(  60),  INT8_C(  82),  INT8_C(  29),  INT8_C(  67), -INT8_C(  96),
+         INT8_C( 115),  INT8_C(  59),  INT8_C(  82), -INT8_C(  98), -INT8_C(  96), -INT8_C(  67),  INT8_C(  55), -INT8_C(  79) },
+      UINT64_C( 7782011072768620288) },
+    { {  INT64_C( 8600235306905237702), -INT64_C( 3322159519944272524),  INT64_C(    1143775829164032),  INT64_C(  148619200053641220),
+         INT64_C( 2310364201295548419),  INT64_C( 2323857407773523970), -INT64_C(    5700005717409795), -INT64_C(  703108825768811929) },
+      {  INT8_C(  65), -INT8_C(  50), -INT8_C(  91), -INT8_C(  21), -INT8_C( 103),  INT8_C(  30), -INT8_C(  49),  INT8_C( 121),
+        -INT8_C(  48), -INT8_C(  27),  INT8_C(  25), -INT8_C(  68), -INT8_C(  47), -INT8_C( 121),  INT8_C(  82), -INT8_C( 117),
+        -INT8_C(   7),  INT8_C(  15), -INT8_C( 110), -INT8_C(  40),  INT8_C(  50),  INT8_C( 111), -INT8_C( 123), -INT8_C(  24),
+        -INT8_C( 117),  INT8_C(  88), -INT8_C( 126),  INT8_C(  83),  INT8_C(  98), -INT8_C(  18), -INT8_C( 107),  INT8_C(  55),
+        -INT8_C( 118), -INT8_C(  35), -INT8_C(  53), -INT8_C( 115),  INT8_C(  87), -INT8_C(   2),  INT8_C( 116), -INT8_C(  33),
+         INT8_C(   2),  INT8_C(  74), -INT8_C(  65), -INT8_C( 109),  INT8_C(  14), -INT8_C(  16), -INT8_C(  33), -INT8_C(  58),
+        -INT8_C( 124),  INT8_C(  27), -INT8_C( 110),  INT8_C(  94),  INT8_C(  99), -INT8_C(  81), -INT8_C( 115), -INT8_C(   8),
+         INT8_C(  25),  INT8_C(  22),  INT8_C(  40), -INT8_C(  51), -INT8_C( 120), -INT8_C(  79),  INT8_C(  76),  INT8_C(  21) },
+      UINT64_C( 2954097747710450895) },
+    { { -INT64_C(  393634410567708291),  INT64_C(       2473910075648), -INT64_C(     712483534834754), -INT64_C( 1152930584211750913),
+        -INT64_C(   63051495368564737), -INT64_C(  288230378377069185), -INT64_C(     140927540920353), -INT64_C( 5832140682882008100) },
+      { -INT8_C(  53), -INT8_C(  78), -INT8_C(  68),  INT8_C( 120),  INT8_C( 101),  INT8_C(  64),  INT8_C(  48),  INT8_C( 126),
+        -INT8_C(  64), -INT8_C( 118),  INT8_C(  39),  INT8_C(  97),  INT8_C( 124),  INT8_C(  57),  INT8_C(  91), -INT8_C( 107),
+         INT8_C(  96), -INT8_C(  90), -INT8_C(  95),  INT8_C(  59), -INT8_C( 106),  INT8_C(  32),  INT8_C(  30), -INT8_C(  63),
+        -INT8_C(  31), -INT8_C(   4),  INT8_C(  54), -INT8_C(  70), -INT8_C(  52), -INT8_C(  46), -INT8_C(  59), -INT8_C(  71),
+        -INT8_C( 116),  INT8_C(  99), -INT8_C(  64), -INT8_C( 108), -INT8_C(  56),  INT8_C( 117),  INT8_C(  44), -INT8_C(   6),
+        -INT8_C(  44),  INT8_C(  28),  INT8_C(  41), -INT8_C(   2), -INT8_C(  13),  INT8_C(  33),  INT8_C(  17),  INT8_C(  78),
+        -INT8_C(  68), -INT8_C( 110), -INT8_C( 100), -INT8_C(  15),  INT8_C(  59), -INT8_C(  31), -INT8_C(  81), -INT8_C(  62),
+         INT8_C(  94), -INT8_C(  92), -INT8_C(  71), -INT8_C(  64),  INT8_C( 105),  INT8_C(  78), -INT8_C(  19),  INT8_C(  11) },
+      UINT64_C(10934036070324437220) },
+    { { -INT64_C(   99079192070619138), -INT64_C(     158398679093258), -INT64_C(   72348423755404033), -INT64_C(    2260733354180805),
+         INT64_C(    2251834175652098),  INT64_C( 2931840209552329829), -INT64_C( 3064053684136897621), -INT64_C( 3477070108267651435) },
+      {  INT8_C(  76), -INT8_C(  78),  INT8_C(  30), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8), -INT8_C(  48), -INT8_C(  26),
+         INT8_C(  66),  INT8_C(  36), -INT8_C( 114),  INT8_C(  86),  INT8_C(  49),  INT8_C(   1), -INT8_C(  77),  INT8_C(  79),
+         INT8_C(  21), -INT8_C(  20),  INT8_C( 120),  INT8_C( 115),  INT8_C( 112),  INT8_C( 120), -INT8_C( 126), -INT8_C( 113),
+         INT8_C(  53),  INT8_C(   1), -INT8_C(  82), -INT8_C(  62), -INT8_C(  11), -INT8_C( 103),  INT8_C(  53), -INT8_C( 102),
+         INT8_C(  18), -INT8_C(  22),  INT8_C(  71),  INT8_C(  39),  INT8_C(  86), -INT8_C(  67), -INT8_C(  35), -INT8_C(  12),
+         INT8_C(   8), -INT8_C(  35),  INT8_C(  11),  INT8_C(  17), -INT8_C( 120),  INT8_C(  81),  INT8_C( 119), -INT8_C(  78),
+         INT8_C(  54), -INT8_C(  55), -INT8_C(  81),  INT8_C(  77),  INT8_C( 101), -INT8_C( 122), -INT8_C(   9), -INT8_C(  56),
+         INT8_C(  55), -INT8_C(  34), -INT8_C( 122),  INT8_C(  47),  INT8_C(  32), -INT8_C(   8),  INT8_C(  26), -INT8_C(  63) },
+      UINT64_C( 2995997666033008111) },
+    { {  INT64_C( 4921091819205751781), -INT64_C( 3459327679598170113), -INT64_C( 1878027452220211724),  INT64_C( 6488317372450178059),
+         INT64_C( 4661765009820604816), -INT64_C( 8046227678156441046),  INT64_C(      70368746541056),  INT64_C( 2812021907627959534) },
+      {  INT8_C( 124), -INT8_C(  57), -INT8_C(  64), -INT8_C(  64), -INT8_C(  70),  INT8_C(  59), -INT8_C( 101),  INT8_C( 113),
+         INT8_C(  48),  INT8_C(  44),  INT8_C(  10),  INT8_C( 118),  INT8_C(  86), -INT8_C(   6), -INT8_C(  26),  INT8_C(  67),
+         INT8_C( 101),  INT8_C(  91),  INT8_C(  29), -INT8_C(  35),  INT8_C(  72), -INT8_C(   4),      INT8_MIN, -INT8_C( 125),
+         INT8_C(  11), -INT8_C( 115),  INT8_C(  42), -INT8_C( 127),  INT8_C(  28), -INT8_C(  76), -INT8_C(   6), -INT8_C(  23),
+        -INT8_C(  25), -INT8_C(  22), -INT8_C(  56), -INT8_C( 112),  INT8_C(  93),  INT8_C( 118), -INT8_C(   8), -INT8_C(  38),
+         INT8_C(  67), -INT8_C(  84), -INT8_C( 102), -INT8_C(   3), -INT8_C( 116),  INT8_C(  26), -INT8_C(  79), -INT8_C(  68),
+        -INT8_C(  87), -INT8_C(  52),  INT8_C(   7),  INT8_C(  90),  INT8_C(  53),  INT8_C(   2),  INT8_C(  37),  INT8_C(  86),
+        -INT8_C(  49), -INT8_C(   8), -INT8_C(  65), -INT8_C(  62), -INT8_C(  17),  INT8_C(  86), -INT8_C(  44), -INT8_C(  39) },
+      UINT64_C( 3099309481807314910) },
+    { {  INT64_C( 7682896218752051196), -INT64_C( 1459932956762076639),  INT64_C( 6410666797745608047),  INT64_C( 5446005909934748158),
+         INT64_C( 8523700643832269963), -INT64_C( 3097343173949871004),  INT64_C(  987102518956371890),  INT64_C( 2308948031428362240) },
+      { -INT8_C(  42), -INT8_C(  31), -INT8_C(  80),  INT8_C( 113), -INT8_C( 109), -INT8_C(  61), -INT8_C(   9), -INT8_C(  50),
+         INT8_C( 121),  INT8_C(   0), -INT8_C(  98),  INT8_C(  49), -INT8_C(  30),  INT8_C(  75),  INT8_C(  91),  INT8_C(  18),
+         INT8_C( 109), -INT8_C(  70), -INT8_C(  87),  INT8_C(  74), -INT8_C(  74),  INT8_C(  12), -INT8_C(  77), -INT8_C(  90),
+         INT8_C( 104),  INT8_C( 101),  INT8_C(  71),  INT8_C( 121), -INT8_C(  60), -INT8_C(  42), -INT8_C(  72),  INT8_C(  53),
+        -INT8_C( 123), -INT8_C(  17),  INT8_C(  65), -INT8_C(  79),  INT8_C(  18),  INT8_C(  11), -INT8_C( 124), -INT8_C(   1),
+        -INT8_C(  24), -INT8_C(  47), -INT8_C(  34), -INT8_C( 123), -INT8_C(  66), -INT8_C(  20),  INT8_C( 108), -INT8_C(  15),
+        -INT8_C(  34),  INT8_C(   2), -INT8_C(  31), -INT8_C(   5),  INT8_C(  78),  INT8_C( 113), -INT8_C( 119), -INT8_C(  52),
+         INT8_C(  93),  INT8_C( 106),  INT8_C(  49),  INT8_C(  14),  INT8_C( 125), -INT8_C(  38),  INT8_C(  57),  INT8_C(  94) },
+      UINT64_C(10695231338161436671) },
+    { {  INT64_C( 7278491794133519324), -INT64_C(   10134251286626465), -INT64_C( 2882627748255337005), -INT64_C(   36068380512362499),
+         INT64_C( 4266833968867609781), -INT64_C( 8283768509014431717), -INT64_C(   73623750243451105),  INT64_C(  290482322138990336) },
+      { -INT8_C(  56), -INT8_C(  21),  INT8_C(   7),  INT8_C(   4),  INT8_C(  40),  INT8_C( 124),  INT8_C(  37),  INT8_C(  19),
+        -INT8_C( 113),  INT8_C(   2), -INT8_C(  30), -INT8_C(  19), -INT8_C(  96),      INT8_MIN,  INT8_C(  38), -INT8_C(  37),
+        -INT8_C(  45), -INT8_C(  95),  INT8_C(  35), -INT8_C( 109), -INT8_C(  14), -INT8_C(  60),  INT8_C(  14),  INT8_C(   1),
+        -INT8_C(  13),  INT8_C(  53), -INT8_C(  45), -INT8_C(  83), -INT8_C(  31), -INT8_C(   2), -INT8_C(  86),  INT8_C(  49),
+             INT8_MIN,  INT8_C( 101),  INT8_C(  50), -INT8_C(  82),  INT8_C(   9), -INT8_C( 110), -INT8_C(  68), -INT8_C(  69),
+         INT8_C(  17),  INT8_C(  11),  INT8_C(  17),  INT8_C(  62), -INT8_C(  86), -INT8_C(  84), -INT8_C(   5), -INT8_C(  66),
+         INT8_C(  35), -INT8_C(  87), -INT8_C(  43), -INT8_C(  50),  INT8_C(  64), -INT8_C(  51), -INT8_C(  73),  INT8_C(   0),
+         INT8_C(  34),  INT8_C(  77), -INT8_C(  24),  INT8_C(  18),  INT8_C(  74),  INT8_C(  31), -INT8_C(  42), -INT8_C(  71) },
+      UINT64_C( 1224507338228628445) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi8(test_vec[i].c);
+    simde__mmask64 r = simde_mm512_bitshuffle_epi64_mask(b, c);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int64_t b[8];
+    const int8_t c[64];
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(14848148599918082140),
+      {  INT64_C( 2667895785251182655),  INT64_C( 5769427782043960336),  INT64_C( 8235443554696214394),  INT64_C(  292733975854588161),
+        -INT64_C( 2958935598871609857),  INT64_C( 4611686054934626388), -INT64_C( 9153181260284689322),  INT64_C(  289638988003166216) },
+      { -INT8_C(  57),  INT8_C(  24),  INT8_C(   8),  INT8_C(  77),  INT8_C( 126),  INT8_C(  35), -INT8_C( 125),  INT8_C(  80),
+         INT8_C( 123),  INT8_C(  36), -INT8_C(  54), -INT8_C(  71), -INT8_C(  48),  INT8_C(  38),  INT8_C(  41),  INT8_C( 116),
+        -INT8_C(  47),  INT8_C(  14),  INT8_C(  34),  INT8_C( 101),  INT8_C(  42),  INT8_C(  66),  INT8_C(  83), -INT8_C( 118),
+        -INT8_C(  92),  INT8_C(  67), -INT8_C(  66),  INT8_C(  55),  INT8_C(  89),  INT8_C(  90), -INT8_C(  34), -INT8_C(  15),
+         INT8_C(  96), -INT8_C(   3), -INT8_C( 109),  INT8_C(  40),  INT8_C(   7), -INT8_C(  67), -INT8_C(   1),  INT8_C(  14),
+         INT8_C(  93),  INT8_C(  80), -INT8_C(  29), -INT8_C(  57),  INT8_C(  64), -INT8_C(  70),  INT8_C(  50), -INT8_C(  79),
+         INT8_C(  48),  INT8_C( 126),  INT8_C( 100),  INT8_C( 113),  INT8_C( 121),  INT8_C(  13), -INT8_C(  65), -INT8_C(  88),
+         INT8_C(  94), -INT8_C(  93),  INT8_C(  68),  INT8_C(  95), -INT8_C( 118),  INT8_C(  37), -INT8_C(  94),  INT8_C(  66) },
+      UINT64_C(     281857230143552) },
+    { UINT64_C( 2040741600567975758),
+      { -INT64_C( 9218868355522363392),  INT64_C( 3603163393177952256), -INT64_C( 6658497974047977407),  INT64_C(  144152021715517440),
+        -INT64_C( 4358921213355850240), -INT64_C( 9205075888221978357), -INT64_C(     914804418052129),  INT64_C( 1152922621315268704) },
+      { -INT8_C( 102), -INT8_C(  56),  INT8_C(  18), -INT8_C(  45),  INT8_C(  20),  INT8_C(  25),  INT8_C(  11),  INT8_C( 113),
+        -INT8_C(  86),  INT8_C(  38), -INT8_C( 106),  INT8_C(  87), -INT8_C(  96),  INT8_C( 117), -INT8_C(   5),  INT8_C(  72),
+        -INT8_C(  18),  INT8_C(  87), -INT8_C(   5),  INT8_C( 117), -INT8_C( 126), -INT8_C(  73),  INT8_C(  94),  INT8_C(  51),
+        -INT8_C(  62),  INT8_C(  42), -INT8_C(  34),  INT8_C( 118), -INT8_C(  26),  INT8_C(  75),  INT8_C(  47),  INT8_C(  60),
+        -INT8_C(  28),  INT8_C(  39),  INT8_C( 113), -INT8_C(  47),  INT8_C(  97), -INT8_C(  51),  INT8_C(  89),  INT8_C(  29),
+        -INT8_C(   8), -INT8_C(  89), -INT8_C(  81),  INT8_C( 113),  INT8_C(  13),  INT8_C(  16), -INT8_C(  74),  INT8_C(  19),
+        -INT8_C(  50), -INT8_C(   1), -INT8_C(  98),  INT8_C(  27), -INT8_C(  85), -INT8_C( 124),  INT8_C(  65), -INT8_C(  77),
+         INT8_C(  80), -INT8_C(  64),  INT8_C(  58), -INT8_C(  75),  INT8_C(  15),  INT8_C(  19), -INT8_C(  48),  INT8_C(  97) },
+      UINT64_C(   23080999632044032) },
+    { UINT64_C( 5299811582802839601),
+      { -INT64_C(    9007199323975685),  INT64_C( 8628896301657292798), -INT64_C( 4554948373466067062),  INT64_C( 3486058199762813917),
+        -INT64_C( 2594426917545320457),  INT64_C( 3027122637035144200),  INT64_C( 9079246884435918830),  INT64_C( 1226902719089107056) },
+      { -INT8_C(  89), -INT8_C( 118),  INT8_C( 116), -INT8_C(  21), -INT8_C( 120),  INT8_C(  62), -INT8_C(  60), -INT8_C( 101),
+        -INT8_C(  89), -INT8_C(  12),  INT8_C( 109),  INT8_C( 112), -INT8_C( 114),  INT8_C(  28),  INT8_C( 112), -INT8_C(   5),
+        -INT8_C(  94), -INT8_C(  21), -INT8_C(  49),  INT8_C(  98), -INT8_C(  59),  INT8_C(  51), -INT8_C(  13), -INT8_C(  42),
+         INT8_C(   6),  INT8_C(  86),  INT8_C(  17),  INT8_C(  51),  INT8_C(  29), -INT8_C(  49), -INT8_C(  14),  INT8_C(  12),
+         INT8_C(  95), -INT8_C( 124),  INT8_C( 126),  INT8_C(  83),  INT8_C( 115),  INT8_C(  60),  INT8_C( 119), -INT8_C(  36),
+        -INT8_C(  85),  INT8_C( 108), -INT8_C(  97), -INT8_C(  54),  INT8_C(  53),  INT8_C(   5),  INT8_C( 124), -INT8_C(  65),
+        -INT8_C(  39), -INT8_C( 126),  INT8_C( 116), -INT8_C(  72),  INT8_C( 117),  INT8_C(  70),  INT8_C(  74),  INT8_C( 112),
+         INT8_C( 104),  INT8_C(  57),  INT8_C(  99),  INT8_C(  72),  INT8_C(  48),  INT8_C(   2), -INT8_C( 102), -INT8_C(  48) },
+      UINT64_C(  111464700954560561) },
+    { UINT64_C( 3981709603886853631),
+      { -INT64_C( 1152921506754331148), -INT64_C( 2466573556212797242),  INT64_C( 9106374476653266673), -INT64_C(     140755070947347),
+        -INT64_C(  530736938066130860), -INT64_C( 5291552804325079186),  INT64_C( 6637543967633559225), -INT64_C(    3377837159481498) },
+      { -INT8_C(  37),  INT8_C(  35), -INT8_C(  61),  INT8_C(  46), -INT8_C(  52), -INT8_C( 100),  INT8_C( 103),  INT8_C( 114),
+         INT8_C(  79), -INT8_C(   7), -INT8_C(  29),  INT8_C(  56), -INT8_C(   6), -INT8_C(  47), -INT8_C(  73), -INT8_C(  30),
+         INT8_C(  64),  INT8_C(  74),  INT8_C(  15),  INT8_C(  42), -INT8_C(  93),  INT8_C( 120),  INT8_C(  20), -INT8_C(   6),
+        -INT8_C(  38),  INT8_C(  52),  INT8_C(  46),  INT8_C(  51),  INT8_C(  71),  INT8_C(  93),  INT8_C(  28), -INT8_C(  85),
+        -INT8_C(  57),  INT8_C(  47),  INT8_C(  45), -INT8_C(  36),  INT8_C(  43),  INT8_C(  25),  INT8_C(  91), -INT8_C(  27),
+         INT8_C(  31), -INT8_C(  19),  INT8_C(  17), -INT8_C( 115), -INT8_C(  22), -INT8_C(  56),  INT8_C( 105),  INT8_C( 122),
+         INT8_C(  63), -INT8_C(  72),  INT8_C(  44),  INT8_C(  64), -INT8_C(  68),  INT8_C(   5),  INT8_C(   8), -INT8_C(  64),
+        -INT8_C( 126),  INT8_C(  46),  INT8_C( 111), -INT8_C(  75), -INT8_C( 119),  INT8_C(   4),  INT8_C(  90), -INT8_C(  76) },
+      UINT64_C( 1657473409036799227) },
+    { UINT64_C( 7834265351778332727),
+      {  INT64_C(   40673147027988480),  INT64_C( 6678517091646243342),  INT64_C( 8894259667801220089), -INT64_C( 1155244259431940097),
+        -INT64_C( 4396520569315379712), -INT64_C( 8942862410517763552),  INT64_C(  288794425686237696),  INT64_C(  613070813016367104) },
+      {  INT8_C(  33),  INT8_C(  60), -INT8_C(  70),  INT8_C(  39), -INT8_C(  35),  INT8_C(  72), -INT8_C(  98), -INT8_C(  99),
+         INT8_C(  40), -INT8_C(  77),  INT8_C(   6),  INT8_C(  94),  INT8_C(  86),  INT8_C(  97),  INT8_C(  74),  INT8_C(   8),
+         INT8_C(  45),  INT8_C( 121), -INT8_C( 114), -INT8_C(  95),  INT8_C(  55), -INT8_C( 115),  INT8_C(  33), -INT8_C(  94),
+        -INT8_C(  28), -INT8_C( 116),  INT8_C( 103), -INT8_C(  46),  INT8_C(  38), -INT8_C(  35), -INT8_C(  64),      INT8_MAX,
+         INT8_C(  32), -INT8_C(  38), -INT8_C(  90),  INT8_C(  42), -INT8_C(  32),  INT8_C(  46), -INT8_C(  42), -INT8_C(  27),
+         INT8_C(  14),  INT8_C(  83), -INT8_C(  50),  INT8_C(  96),  INT8_C(  46),  INT8_C(  30),  INT8_C( 112), -INT8_C( 109),
+             INT8_MAX, -INT8_C(  72), -INT8_C(  23),  INT8_C(  19),  INT8_C(  65),  INT8_C(  74),  INT8_C(  14),  INT8_C(  12),
+         INT8_C( 102),  INT8_C( 108), -INT8_C( 120),  INT8_C(  59),  INT8_C(  90), -INT8_C( 106),  INT8_C(  63), -INT8_C(  82) },
+      UINT64_C(  576496230484414465) },
+    { UINT64_C(17752459461026363029),
+      { -INT64_C(  489778291509780820), -INT64_C( 2124348816650203443),  INT64_C( 4611987423127142400), -INT64_C( 5314953463325595127),
+        -INT64_C(  444457740596722836),  INT64_C( 2305888092412322369),  INT64_C( 1441152430514429952), -INT64_C(   36028823057269441) },
+      {  INT8_C( 124), -INT8_C(  50),  INT8_C( 113), -INT8_C(  10), -INT8_C(  96),  INT8_C(  60),  INT8_C(  34), -INT8_C(   8),
+        -INT8_C(  76), -INT8_C( 100),  INT8_C(  38),  INT8_C( 115), -INT8_C(   9),  INT8_C( 126),  INT8_C(  90),  INT8_C( 117),
+        -INT8_C(  64), -INT8_C( 112),  INT8_C(  11),  INT8_C(  31),  INT8_C( 105), -INT8_C(  46), -INT8_C(   6),  INT8_C( 102),
+        -INT8_C(  61),  INT8_C(  93),  INT8_C( 106),  INT8_C(  48), -INT8_C(  42),  INT8_C(  49), -INT8_C(  22), -INT8_C( 106),
+         INT8_C(  53), -INT8_C(  22), -INT8_C(  88),  INT8_C(  44),  INT8_C(  56), -INT8_C(  65),  INT8_C( 102), -INT8_C(  35),
+         INT8_C(  54), -INT8_C( 116), -INT8_C( 114), -INT8_C(  31), -INT8_C( 122), -INT8_C(  26),  INT8_C(  92), -INT8_C(  93),
+         INT8_C(  28), -INT8_C(  58),  INT8_C(  27),  INT8_C( 115), -INT8_C(  77),  INT8_C(  30),  INT8_C(  16),  INT8_C( 108),
+        -INT8_C(  36),  INT8_C( 118), -INT8_C(   1),  INT8_C(  61),  INT8_C(  64),  INT8_C(  54), -INT8_C( 105),  INT8_C( 107) },
+      UINT64_C(17726168752058282133) },
+    { UINT64_C( 7279112256671978924),
+      {  INT64_C( 3668444517279418418),  INT64_C( 7497654617205418959), -INT64_C( 4676827578343609505),  INT64_C( 4039799818712844288),
+         INT64_C( 8630885778166416514), -INT64_C( 5411936106224591161),  INT64_C( 2181986965641482703), -INT64_C( 3835185668896353483) },
+      { -INT8_C( 117),  INT8_C(  49),  INT8_C(  47), -INT8_C(  22),  INT8_C(  71), -INT8_C( 121), -INT8_C(  93),  INT8_C(   6),
+        -INT8_C( 105), -INT8_C(  21),  INT8_C( 109),  INT8_C( 112),  INT8_C(  23),  INT8_C(  17),  INT8_C( 121),  INT8_C(  57),
+        -INT8_C( 114),  INT8_C(  79), -INT8_C(  91),  INT8_C(  91), -INT8_C(  97), -INT8_C(  75),  INT8_C(  70),  INT8_C(  85),
+        -INT8_C( 108), -INT8_C(   9), -INT8_C(  86),  INT8_C(  15),  INT8_C(  76), -INT8_C( 115), -INT8_C(  41), -INT8_C(  28),
+         INT8_C(  38), -INT8_C(  24), -INT8_C(   3),  INT8_C(  75), -INT8_C(  11),  INT8_C(  20), -INT8_C(   1), -INT8_C(  81),
+         INT8_C(   2), -INT8_C(  39),  INT8_C( 104),  INT8_C( 101),  INT8_C(  23), -INT8_C( 124), -INT8_C(  72), -INT8_C( 116),
+        -INT8_C( 107), -INT8_C( 114), -INT8_C(  71),  INT8_C( 123), -INT8_C(  72), -INT8_C(  61),  INT8_C(   3),  INT8_C(   5),
+        -INT8_C(  38), -INT8_C( 120), -INT8_C(  13), -INT8_C( 121), -INT8_C(  99), -INT8_C(   4),  INT8_C(  69),  INT8_C(  75) },
+      UINT64_C( 4685010271352127500) },
+    { UINT64_C( 6072430820767182007),
+      { -INT64_C(  360851469907263490),  INT64_C( 6673769223908473855), -INT64_C( 2098730323448827910), -INT64_C( 7915745215447843418),
+         INT64_C( 8646277963706269679), -INT64_C(            25165869), -INT64_C( 2061811992117105242), -INT64_C(        146634047746) },
+      {  INT8_C(  68), -INT8_C(  10),  INT8_C( 122),  INT8_C( 122),  INT8_C( 114),  INT8_C(  83),  INT8_C( 119), -INT8_C(  71),
+         INT8_C( 122),  INT8_C(  39), -INT8_C(  28), -INT8_C(  77),  INT8_C(  68),  INT8_C(  45),  INT8_C( 113), -INT8_C(  19),
+         INT8_C(  84), -INT8_C(  93), -INT8_C(  98), -INT8_C(  34),  INT8_C(   3), -INT8_C(  29), -INT8_C(  74), -INT8_C(  85),
+        -INT8_C(  59), -INT8_C( 107),  INT8_C(  76),  INT8_C(  57), -INT8_C(  17), -INT8_C(  60),  INT8_C(  13), -INT8_C(  49),
+        -INT8_C(  19),  INT8_C( 114), -INT8_C(  89),  INT8_C(   6), -INT8_C(  51),  INT8_C(  72),  INT8_C(   8), -INT8_C( 105),
+        -INT8_C( 105), -INT8_C(  89),  INT8_C(  85), -INT8_C(  38),  INT8_C(  30),  INT8_C(   2), -INT8_C(  66), -INT8_C(  89),
+        -INT8_C( 115),  INT8_C(  70), -INT8_C(  40),  INT8_C(  74),  INT8_C(   3), -INT8_C(  66), -INT8_C(  68),  INT8_C( 108),
+        -INT8_C(  36),  INT8_C( 117),  INT8_C(  41), -INT8_C(  88), -INT8_C(  28), -INT8_C(  40),  INT8_C(  83), -INT8_C(   9) },
+      UINT64_C( 6053289422837001395) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi8(test_vec[i].c);
+    simde__mmask64 r = simde_mm512_mask_bitshuffle_epi64_mask(test_vec[i].k, b, c);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_bitshuffle_epi64_mask)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,3588 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN compress
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/compress.h>
+
+static int
+test_simde_mm_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C( 103),  INT8_C( 110),  INT8_C( 103), -INT8_C(  31), -INT8_C(  34),  INT8_C( 115), -INT8_C(  33), -INT8_C(  80),
+         INT8_C( 100),  INT8_C(  27), -INT8_C(  56), -INT8_C(  82), -INT8_C( 107),  INT8_C(  74),  INT8_C( 103), -INT8_C(  48) },
+      UINT16_C(29971),
+      { -INT8_C( 121), -INT8_C(  96), -INT8_C(  98), -INT8_C( 110), -INT8_C(  31), -INT8_C(   5), -INT8_C( 113),  INT8_C( 109),
+         INT8_C(  39),  INT8_C(  97), -INT8_C(  28), -INT8_C(   9),  INT8_C(  22),      INT8_MAX, -INT8_C( 126), -INT8_C(  85) },
+      { -INT8_C( 121), -INT8_C(  96), -INT8_C(  31),  INT8_C(  39), -INT8_C(  28),  INT8_C(  22),      INT8_MAX, -INT8_C( 126),
+         INT8_C( 100),  INT8_C(  27), -INT8_C(  56), -INT8_C(  82), -INT8_C( 107),  INT8_C(  74),  INT8_C( 103), -INT8_C(  48) } },
+    { {  INT8_C(  80), -INT8_C(  86),  INT8_C(   2),  INT8_C(  33), -INT8_C(  11),  INT8_C(  19), -INT8_C( 113), -INT8_C(  93),
+        -INT8_C(  73),  INT8_C(  77), -INT8_C(  73),  INT8_C(  20),  INT8_C(  69), -INT8_C(  94), -INT8_C( 120),      INT8_MIN },
+      UINT16_C(  516),
+      { -INT8_C(  19), -INT8_C(  21), -INT8_C( 102),  INT8_C( 112),  INT8_C(  64),  INT8_C(  75),  INT8_C(  86), -INT8_C(  91),
+        -INT8_C(  27),  INT8_C(  10),  INT8_C(  44), -INT8_C(  84),  INT8_C(  31),  INT8_C(  42), -INT8_C( 121),  INT8_C(  81) },
+      { -INT8_C( 102),  INT8_C(  10),  INT8_C(   2),  INT8_C(  33), -INT8_C(  11),  INT8_C(  19), -INT8_C( 113), -INT8_C(  93),
+        -INT8_C(  73),  INT8_C(  77), -INT8_C(  73),  INT8_C(  20),  INT8_C(  69), -INT8_C(  94), -INT8_C( 120),      INT8_MIN } },
+    { { -INT8_C(   2), -INT8_C(  77), -INT8_C( 123), -INT8_C(  98),  INT8_C( 110),  INT8_C( 121), -INT8_C(  38), -INT8_C(  32),
+         INT8_C( 101), -INT8_C(  31), -INT8_C(  61),  INT8_C(  86),  INT8_C(  68), -INT8_C(  69),  INT8_C(  74),  INT8_C(  87) },
+      UINT16_C(54413),
+      { -INT8_C(  20),      INT8_MIN,  INT8_C(  10),  INT8_C(  27), -INT8_C( 118), -INT8_C(  21), -INT8_C(  33),  INT8_C(  73),
+        -INT8_C(  77), -INT8_C( 107), -INT8_C(  54), -INT8_C(  19),  INT8_C(  98),  INT8_C(   4), -INT8_C( 124),  INT8_C(  40) },
+      { -INT8_C(  20),  INT8_C(  10),  INT8_C(  27),  INT8_C(  73), -INT8_C(  54),  INT8_C(  98), -INT8_C( 124),  INT8_C(  40),
+         INT8_C( 101), -INT8_C(  31), -INT8_C(  61),  INT8_C(  86),  INT8_C(  68), -INT8_C(  69),  INT8_C(  74),  INT8_C(  87) } },
+    { {  INT8_C(  69), -INT8_C(  91), -INT8_C(  90), -INT8_C(  82), -INT8_C(  22), -INT8_C(   4), -INT8_C( 121),  INT8_C(  60),
+         INT8_C(  62),  INT8_C( 104), -INT8_C(  63),  INT8_C( 119), -INT8_C(  59),  INT8_C(  69), -INT8_C(  35), -INT8_C(  50) },
+      UINT16_C(48485),
+      {  INT8_C(  31), -INT8_C(  12), -INT8_C(   1), -INT8_C(  31), -INT8_C(  47), -INT8_C(  28),  INT8_C(  70),  INT8_C( 119),
+        -INT8_C(  88),  INT8_C(  87), -INT8_C( 104), -INT8_C(  75), -INT8_C(  73), -INT8_C( 109),  INT8_C(   2), -INT8_C(   6) },
+      {  INT8_C(  31), -INT8_C(   1), -INT8_C(  28),  INT8_C(  70), -INT8_C(  88), -INT8_C( 104), -INT8_C(  75), -INT8_C(  73),
+        -INT8_C( 109), -INT8_C(   6), -INT8_C(  63),  INT8_C( 119), -INT8_C(  59),  INT8_C(  69), -INT8_C(  35), -INT8_C(  50) } },
+    { {  INT8_C(   3),  INT8_C(  87),  INT8_C( 123),  INT8_C(  22), -INT8_C(  39), -INT8_C(  93), -INT8_C(  64), -INT8_C(  12),
+         INT8_C( 117), -INT8_C(  91),  INT8_C(  15), -INT8_C(  20), -INT8_C(  24), -INT8_C( 120), -INT8_C(  93),  INT8_C(   9) },
+      UINT16_C(26624),
+      {  INT8_C(  82),  INT8_C( 100), -INT8_C(   1), -INT8_C(  98), -INT8_C( 105), -INT8_C(  38),  INT8_C(  16),  INT8_C(  60),
+        -INT8_C(  61), -INT8_C(  81),  INT8_C(  57), -INT8_C(  58),  INT8_C( 102),  INT8_C(  41), -INT8_C(  57), -INT8_C( 111) },
+      { -INT8_C(  58),  INT8_C(  41), -INT8_C(  57),  INT8_C(  22), -INT8_C(  39), -INT8_C(  93), -INT8_C(  64), -INT8_C(  12),
+         INT8_C( 117), -INT8_C(  91),  INT8_C(  15), -INT8_C(  20), -INT8_C(  24), -INT8_C( 120), -INT8_C(  93),  INT8_C(   9) } },
+    { {  INT8_C(  55),  INT8_C(  31), -INT8_C( 111), -INT8_C( 118), -INT8_C(  90),  INT8_C( 118), -INT8_C(  94),  INT8_C(  31),
+         INT8_C(  35), -INT8_C(  59), -INT8_C(  91), -INT8_C(  90),  INT8_C( 103),  INT8_C(  60), -INT8_C( 106), -INT8_C(  62) },
+      UINT16_C(65098),
+      {  INT8_C(  46),  INT8_C(  52), -INT8_C(  85),  INT8_C( 114), -INT8_C(  89),  INT8_C(  85), -INT8_C( 113),      INT8_MAX,
+        -INT8_C( 121),  INT8_C(  67),  INT8_C(  66), -INT8_C( 122), -INT8_C(  92), -INT8_C(  87), -INT8_C(  82), -INT8_C(  69) },
+      {  INT8_C(  52),  INT8_C( 114), -INT8_C( 113),  INT8_C(  67),  INT8_C(  66), -INT8_C( 122), -INT8_C(  92), -INT8_C(  87),
+        -INT8_C(  82), -INT8_C(  69), -INT8_C(  91), -INT8_C(  90),  INT8_C( 103),  INT8_C(  60), -INT8_C( 106), -INT8_C(  62) } },
+    { {  INT8_C(  85),  INT8_C(  41),  INT8_C(  70),  INT8_C( 106),  INT8_C(  97),  INT8_C( 108), -INT8_C(  86), -INT8_C( 113),
+         INT8_C(  30), -INT8_C(  84),  INT8_C( 118), -INT8_C( 117), -INT8_C(  11), -INT8_C(  71),  INT8_C( 126),  INT8_C( 120) },
+      UINT16_C(60889),
+      {  INT8_C(   2), -INT8_C( 123),  INT8_C(  60),  INT8_C(  26), -INT8_C(  55), -INT8_C(  25), -INT8_C(  42),  INT8_C(  47),
+         INT8_C(  98),      INT8_MAX, -INT8_C(   5),  INT8_C(  39),  INT8_C(  79),  INT8_C(   0), -INT8_C(  27),  INT8_C(  92) },
+      {  INT8_C(   2),  INT8_C(  26), -INT8_C(  55), -INT8_C(  42),  INT8_C(  47),  INT8_C(  98), -INT8_C(   5),  INT8_C(  39),
+         INT8_C(   0), -INT8_C(  27),  INT8_C(  92), -INT8_C( 117), -INT8_C(  11), -INT8_C(  71),  INT8_C( 126),  INT8_C( 120) } },
+    { { -INT8_C(  19),  INT8_C(  68), -INT8_C(  16),  INT8_C(  34), -INT8_C(  21), -INT8_C(  59), -INT8_C(  60),  INT8_C( 126),
+         INT8_C(  51), -INT8_C( 108), -INT8_C(  96),  INT8_C(  13), -INT8_C(  42), -INT8_C(  71),  INT8_C( 102),  INT8_C( 113) },
+      UINT16_C(59327),
+      {  INT8_C(  12), -INT8_C(  19),  INT8_C(  83),  INT8_C(  67),  INT8_C( 124),  INT8_C(  33),  INT8_C( 103),  INT8_C(  36),
+        -INT8_C(  90), -INT8_C( 112),  INT8_C(  14), -INT8_C( 107),  INT8_C(  15),  INT8_C(  53),  INT8_C(  30), -INT8_C( 119) },
+      {  INT8_C(  12), -INT8_C(  19),  INT8_C(  83),  INT8_C(  67),  INT8_C( 124),  INT8_C(  33),  INT8_C(  36), -INT8_C(  90),
+        -INT8_C( 112),  INT8_C(  14),  INT8_C(  53),  INT8_C(  30), -INT8_C( 119), -INT8_C(  71),  INT8_C( 102),  INT8_C( 113) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(62523),
+      { -INT8_C(  37), -INT8_C( 123),  INT8_C( 113), -INT8_C( 110), -INT8_C(  37), -INT8_C(  13),  INT8_C(  11),  INT8_C(  49),
+        -INT8_C(  47),  INT8_C(  73), -INT8_C(  14), -INT8_C(  84),  INT8_C(  82),  INT8_C(  70), -INT8_C(  62),  INT8_C( 102) },
+      { -INT8_C(  37), -INT8_C( 123), -INT8_C( 110), -INT8_C(  37), -INT8_C(  13), -INT8_C(  14),  INT8_C(  82),  INT8_C(  70),
+        -INT8_C(  62),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(65526),
+      {  INT8_C(  50), -INT8_C(  86), -INT8_C( 109),  INT8_C(  97),  INT8_C(  47),  INT8_C(  87),  INT8_C(  12),  INT8_C( 121),
+        -INT8_C( 114), -INT8_C(  17), -INT8_C(  96),  INT8_C(  91), -INT8_C( 111), -INT8_C(  40),  INT8_C(  43), -INT8_C(  57) },
+      { -INT8_C(  86), -INT8_C( 109),  INT8_C(  47),  INT8_C(  87),  INT8_C(  12),  INT8_C( 121), -INT8_C( 114), -INT8_C(  17),
+        -INT8_C(  96),  INT8_C(  91), -INT8_C( 111), -INT8_C(  40),  INT8_C(  43), -INT8_C(  57),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(16140),
+      {  INT8_C(  82), -INT8_C(  70), -INT8_C( 126),  INT8_C(  65), -INT8_C( 114), -INT8_C( 106),  INT8_C(  77), -INT8_C(  66),
+         INT8_C( 123), -INT8_C(  81), -INT8_C(  43), -INT8_C(  95),  INT8_C( 106),  INT8_C(  83),  INT8_C(  78),  INT8_C(   9) },
+      { -INT8_C( 126),  INT8_C(  65),  INT8_C( 123), -INT8_C(  81), -INT8_C(  43), -INT8_C(  95),  INT8_C( 106),  INT8_C(  83),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(56318),
+      { -INT8_C(  12), -INT8_C( 122),  INT8_C(  17),  INT8_C(  36),  INT8_C(  53), -INT8_C(   3),      INT8_MAX, -INT8_C(  75),
+             INT8_MAX, -INT8_C(  66),  INT8_C(   0), -INT8_C(  27),  INT8_C(  95), -INT8_C( 117),  INT8_C(  64),  INT8_C(  83) },
+      { -INT8_C( 122),  INT8_C(  17),  INT8_C(  36),  INT8_C(  53), -INT8_C(   3),      INT8_MAX, -INT8_C(  75),      INT8_MAX,
+        -INT8_C(  66), -INT8_C(  27),  INT8_C(  95),  INT8_C(  64),  INT8_C(  83),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(52663),
+      { -INT8_C(  83),  INT8_C(   4),  INT8_C(  70), -INT8_C(  79),  INT8_C(  94),  INT8_C(  87), -INT8_C(  64), -INT8_C(  26),
+         INT8_C(  78), -INT8_C( 119), -INT8_C(  79), -INT8_C(  26),  INT8_C(  55),  INT8_C(  56), -INT8_C(  69),  INT8_C(  47) },
+      { -INT8_C(  83),  INT8_C(   4),  INT8_C(  70),  INT8_C(  94),  INT8_C(  87), -INT8_C(  26),  INT8_C(  78), -INT8_C(  79),
+        -INT8_C(  26), -INT8_C(  69),  INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(26735),
+      { -INT8_C(  60),  INT8_C( 108), -INT8_C(  89), -INT8_C(  79),  INT8_C(  39),  INT8_C(  72),  INT8_C( 111),  INT8_C(  90),
+         INT8_C(  53),  INT8_C(  92), -INT8_C(  21),  INT8_C(  63), -INT8_C( 122), -INT8_C( 108), -INT8_C(  26), -INT8_C(  36) },
+      { -INT8_C(  60),  INT8_C( 108), -INT8_C(  89), -INT8_C(  79),  INT8_C(  72),  INT8_C( 111),  INT8_C(  63), -INT8_C( 108),
+        -INT8_C(  26),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(14594),
+      {  INT8_C(  79), -INT8_C(  60),  INT8_C(  40),  INT8_C(  61),  INT8_C(  93), -INT8_C(  36),  INT8_C(  79), -INT8_C(  23),
+        -INT8_C(  34), -INT8_C(  92),  INT8_C(  46),  INT8_C(  26),  INT8_C( 112), -INT8_C(  77), -INT8_C( 123),  INT8_C(  54) },
+      { -INT8_C(  60), -INT8_C(  34),  INT8_C(  26),  INT8_C( 112), -INT8_C(  77),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(  164),
+      {  INT8_C(   3),  INT8_C(  99),  INT8_C(  77), -INT8_C( 103), -INT8_C(  28),  INT8_C(  64), -INT8_C( 123), -INT8_C(  78),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(  13),  INT8_C(  46),  INT8_C(  84), -INT8_C(  77),  INT8_C(  99), -INT8_C(  89) },
+      {  INT8_C(  77),  INT8_C(  64), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  47),  INT8_C(  69),  INT8_C( 113), -INT8_C(  42),  INT8_C( 125), -INT8_C(  99),  INT8_C(  91),  INT8_C( 125),
+         INT8_C(  87),  INT8_C(  17),  INT8_C(  76),  INT8_C(  31),  INT8_C(  59),  INT8_C(  18),  INT8_C( 119),  INT8_C(  10) },
+      UINT16_C(28148),
+      {  INT8_C(  17),  INT8_C(  23), -INT8_C( 115), -INT8_C( 121), -INT8_C(   3), -INT8_C( 107), -INT8_C(  48),  INT8_C(  81),
+         INT8_C(  71), -INT8_C( 101),  INT8_C(  33),  INT8_C(  75), -INT8_C( 103),  INT8_C(  35), -INT8_C(  91), -INT8_C(  14) },
+      { -INT8_C( 115), -INT8_C(   3), -INT8_C( 107), -INT8_C(  48),  INT8_C(  81),  INT8_C(  71),  INT8_C(  33),  INT8_C(  75),
+         INT8_C(  35), -INT8_C(  91),  INT8_C(  76),  INT8_C(  31),  INT8_C(  59),  INT8_C(  18),  INT8_C( 119),  INT8_C(  10) } },
+    { {  INT8_C(   0), -INT8_C(   4), -INT8_C( 105), -INT8_C(  78),  INT8_C( 111), -INT8_C(  55), -INT8_C(   3), -INT8_C(  70),
+        -INT8_C( 103),  INT8_C(  85),  INT8_C( 105), -INT8_C(  68), -INT8_C(  24), -INT8_C( 102),  INT8_C(  54), -INT8_C(  49) },
+      UINT16_C(51400),
+      { -INT8_C(  65),  INT8_C(  58),  INT8_C(  98), -INT8_C(  57),  INT8_C(  85),  INT8_C( 105),  INT8_C(   6),  INT8_C(  86),
+         INT8_C(  58), -INT8_C(  58),  INT8_C(  20), -INT8_C(  63), -INT8_C(   6),  INT8_C( 118), -INT8_C(  70),  INT8_C(  30) },
+      { -INT8_C(  57),  INT8_C(   6),  INT8_C(  86), -INT8_C(  63), -INT8_C(  70),  INT8_C(  30), -INT8_C(   3), -INT8_C(  70),
+        -INT8_C( 103),  INT8_C(  85),  INT8_C( 105), -INT8_C(  68), -INT8_C(  24), -INT8_C( 102),  INT8_C(  54), -INT8_C(  49) } },
+    { {  INT8_C(  12),  INT8_C(  11), -INT8_C(  31),  INT8_C(  14), -INT8_C(   6), -INT8_C(  31), -INT8_C(   1), -INT8_C(  28),
+        -INT8_C( 108), -INT8_C(  97), -INT8_C( 124),  INT8_C(  10),  INT8_C(   4),  INT8_C(  89), -INT8_C( 115), -INT8_C( 109) },
+      UINT16_C(50208),
+      { -INT8_C(  76), -INT8_C(  15),  INT8_C(  14), -INT8_C(  91), -INT8_C(  84), -INT8_C(  46), -INT8_C(   8),  INT8_C(  63),
+         INT8_C( 119),  INT8_C( 117),  INT8_C(  53), -INT8_C(  21),  INT8_C(  45),  INT8_C(  47),  INT8_C( 125), -INT8_C(  60) },
+      { -INT8_C(  46),  INT8_C(  53),  INT8_C( 125), -INT8_C(  60), -INT8_C(   6), -INT8_C(  31), -INT8_C(   1), -INT8_C(  28),
+        -INT8_C( 108), -INT8_C(  97), -INT8_C( 124),  INT8_C(  10),  INT8_C(   4),  INT8_C(  89), -INT8_C( 115), -INT8_C( 109) } },
+    { { -INT8_C(  67),  INT8_C( 101), -INT8_C(  19),  INT8_C(  99),  INT8_C(  89),  INT8_C(   4),  INT8_C(  71), -INT8_C(  51),
+         INT8_C(  60), -INT8_C(  50),  INT8_C(  38),  INT8_C(  20), -INT8_C(  34),  INT8_C(  90),  INT8_C(  61), -INT8_C(  79) },
+      UINT16_C(30829),
+      {  INT8_C( 108),  INT8_C(  37), -INT8_C(  88), -INT8_C(  86),  INT8_C(  93),  INT8_C( 120),  INT8_C( 109),  INT8_C(  25),
+        -INT8_C( 124), -INT8_C(  90),  INT8_C(  30), -INT8_C(  19), -INT8_C(  87),  INT8_C(  27),  INT8_C( 125),  INT8_C(  39) },
+      {  INT8_C( 108), -INT8_C(  88), -INT8_C(  86),  INT8_C( 120),  INT8_C( 109), -INT8_C(  19), -INT8_C(  87),  INT8_C(  27),
+         INT8_C( 125), -INT8_C(  50),  INT8_C(  38),  INT8_C(  20), -INT8_C(  34),  INT8_C(  90),  INT8_C(  61), -INT8_C(  79) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    int8_t r[16];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm_mask_compressstoreu_epi8(r, test_vec[i].k, a);
+    simde_assert_equal_vi8(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 14129),  INT16_C( 10101),  INT16_C( 15256), -INT16_C( 17383),  INT16_C(  9495),  INT16_C( 25032),  INT16_C(  3827),  INT16_C( 24640) },
+      UINT8_C(212),
+      {  INT16_C(  7178),  INT16_C( 27299),  INT16_C(  8862), -INT16_C(  3774),  INT16_C( 19607), -INT16_C(   223), -INT16_C( 21721),  INT16_C( 14639) },
+      {  INT16_C(  8862),  INT16_C( 19607), -INT16_C( 21721),  INT16_C( 14639),  INT16_C(  9495),  INT16_C( 25032),  INT16_C(  3827),  INT16_C( 24640) } },
+    { { -INT16_C( 29607),  INT16_C( 14852),  INT16_C( 19085),  INT16_C( 18032), -INT16_C(  7215),  INT16_C( 15498),  INT16_C( 18382), -INT16_C( 12480) },
+      UINT8_C(155),
+      { -INT16_C(  9531), -INT16_C(  9622), -INT16_C( 21006),  INT16_C( 26787),  INT16_C(  4122), -INT16_C( 29855), -INT16_C(  3770), -INT16_C( 25202) },
+      { -INT16_C(  9531), -INT16_C(  9622),  INT16_C( 26787),  INT16_C(  4122), -INT16_C( 25202),  INT16_C( 15498),  INT16_C( 18382), -INT16_C( 12480) } },
+    { {  INT16_C(  6013), -INT16_C( 29840),  INT16_C( 22642), -INT16_C( 24372),  INT16_C(  7271), -INT16_C( 21752),  INT16_C( 11078), -INT16_C( 22064) },
+      UINT8_C(127),
+      {  INT16_C(  3099), -INT16_C( 18953),  INT16_C(  8363), -INT16_C( 21667), -INT16_C( 29366), -INT16_C( 13910), -INT16_C( 19996),  INT16_C( 22551) },
+      {  INT16_C(  3099), -INT16_C( 18953),  INT16_C(  8363), -INT16_C( 21667), -INT16_C( 29366), -INT16_C( 13910), -INT16_C( 19996), -INT16_C( 22064) } },
+    { {  INT16_C( 11556),  INT16_C( 27403),  INT16_C( 18924),  INT16_C( 13164),  INT16_C( 11509),  INT16_C( 10874), -INT16_C( 14849),  INT16_C( 31937) },
+      UINT8_C(227),
+      {  INT16_C( 31200), -INT16_C( 23270), -INT16_C( 26708),  INT16_C( 21050),  INT16_C( 12997), -INT16_C( 32261),  INT16_C( 16774), -INT16_C( 21070) },
+      {  INT16_C( 31200), -INT16_C( 23270), -INT16_C( 32261),  INT16_C( 16774), -INT16_C( 21070),  INT16_C( 10874), -INT16_C( 14849),  INT16_C( 31937) } },
+    { { -INT16_C( 29577),  INT16_C( 14686), -INT16_C( 31438), -INT16_C( 18360),  INT16_C( 22493),  INT16_C( 22342), -INT16_C( 13607), -INT16_C(   561) },
+      UINT8_C( 64),
+      { -INT16_C( 11502),  INT16_C( 16452), -INT16_C( 10794),  INT16_C(  9290), -INT16_C(  5982),  INT16_C( 18261),  INT16_C( 22930),  INT16_C(  5508) },
+      {  INT16_C( 22930),  INT16_C( 14686), -INT16_C( 31438), -INT16_C( 18360),  INT16_C( 22493),  INT16_C( 22342), -INT16_C( 13607), -INT16_C(   561) } },
+    { {  INT16_C(  7660), -INT16_C( 17720),  INT16_C(  7012), -INT16_C( 12385), -INT16_C(  9250), -INT16_C( 24597),  INT16_C( 27362), -INT16_C( 30518) },
+      UINT8_C(159),
+      {  INT16_C( 30287), -INT16_C( 28001),  INT16_C(  8198), -INT16_C( 18524), -INT16_C(  6865), -INT16_C(  8580),  INT16_C( 14328), -INT16_C(  4278) },
+      {  INT16_C( 30287), -INT16_C( 28001),  INT16_C(  8198), -INT16_C( 18524), -INT16_C(  6865), -INT16_C(  4278),  INT16_C( 27362), -INT16_C( 30518) } },
+    { {  INT16_C( 29086), -INT16_C(  3414),  INT16_C( 25159), -INT16_C(  8522),  INT16_C(  4071),  INT16_C( 19986), -INT16_C( 10157),  INT16_C(  8091) },
+      UINT8_C( 38),
+      {  INT16_C( 30079),  INT16_C(  1371),  INT16_C( 30770),  INT16_C( 20003),  INT16_C( 12068), -INT16_C( 20655),  INT16_C( 30489), -INT16_C(  3801) },
+      {  INT16_C(  1371),  INT16_C( 30770), -INT16_C( 20655), -INT16_C(  8522),  INT16_C(  4071),  INT16_C( 19986), -INT16_C( 10157),  INT16_C(  8091) } },
+    { { -INT16_C( 15167),  INT16_C( 17691),  INT16_C(  3217), -INT16_C( 25175), -INT16_C(  1624), -INT16_C( 31343),  INT16_C( 29182),  INT16_C( 15933) },
+      UINT8_C(227),
+      {  INT16_C( 26216), -INT16_C(   452),  INT16_C( 22470), -INT16_C( 12152),  INT16_C( 21728), -INT16_C( 12202),  INT16_C(  9411), -INT16_C( 13797) },
+      {  INT16_C( 26216), -INT16_C(   452), -INT16_C( 12202),  INT16_C(  9411), -INT16_C( 13797), -INT16_C( 31343),  INT16_C( 29182),  INT16_C( 15933) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(110),
+      { -INT16_C( 21965),  INT16_C( 13333),  INT16_C(  2611), -INT16_C( 20033),  INT16_C( 30159),  INT16_C( 28660), -INT16_C( 21908),  INT16_C(  7024) },
+      {  INT16_C( 13333),  INT16_C(  2611), -INT16_C( 20033),  INT16_C( 28660), -INT16_C( 21908),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 12),
+      {  INT16_C(  8048),  INT16_C(  8663),  INT16_C(  7962),  INT16_C( 20376), -INT16_C( 22804),  INT16_C(  7300),  INT16_C( 28472), -INT16_C( 23981) },
+      {  INT16_C(  7962),  INT16_C( 20376),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 74),
+      {  INT16_C( 29524), -INT16_C(  1642),  INT16_C(  5697), -INT16_C( 17915),  INT16_C( 27274), -INT16_C( 31396), -INT16_C(  5672), -INT16_C( 12828) },
+      { -INT16_C(  1642), -INT16_C( 17915), -INT16_C(  5672),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(  4),
+      { -INT16_C( 18405),  INT16_C( 10406),  INT16_C(  7826),  INT16_C(  3120),  INT16_C( 28812),  INT16_C( 10703),  INT16_C( 25802),  INT16_C( 17358) },
+      {  INT16_C(  7826),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 69),
+      { -INT16_C( 20959), -INT16_C( 19605), -INT16_C(  3070), -INT16_C( 28527), -INT16_C( 12179), -INT16_C( 16501),  INT16_C( 24092),  INT16_C( 20557) },
+      { -INT16_C( 20959), -INT16_C(  3070),  INT16_C( 24092),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 87),
+      { -INT16_C( 30747),  INT16_C( 19753),  INT16_C(  8873), -INT16_C(   649), -INT16_C( 30338),  INT16_C(  1404),  INT16_C( 10618), -INT16_C(  8027) },
+      { -INT16_C( 30747),  INT16_C( 19753),  INT16_C(  8873), -INT16_C( 30338),  INT16_C( 10618),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(230),
+      {  INT16_C(   508),  INT16_C(  6355), -INT16_C(  2109),  INT16_C( 13442), -INT16_C( 14188), -INT16_C(  6794), -INT16_C(  6921), -INT16_C( 29268) },
+      {  INT16_C(  6355), -INT16_C(  2109), -INT16_C(  6794), -INT16_C(  6921), -INT16_C( 29268),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(143),
+      {  INT16_C( 14575),  INT16_C(  2119),  INT16_C( 27922), -INT16_C( 16512),  INT16_C( 26514), -INT16_C( 14995), -INT16_C(  1491), -INT16_C( 24434) },
+      {  INT16_C( 14575),  INT16_C(  2119),  INT16_C( 27922), -INT16_C( 16512), -INT16_C( 24434),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 10678),  INT16_C( 11102), -INT16_C( 13679), -INT16_C( 16692), -INT16_C( 32271),  INT16_C(  5056),  INT16_C( 14894), -INT16_C(  1198) },
+      UINT8_C(206),
+      {  INT16_C( 14824), -INT16_C( 11027), -INT16_C(  8445), -INT16_C( 22771),  INT16_C( 26784), -INT16_C( 28571),  INT16_C( 20105), -INT16_C(  9167) },
+      { -INT16_C( 11027), -INT16_C(  8445), -INT16_C( 22771),  INT16_C( 20105), -INT16_C(  9167),  INT16_C(  5056),  INT16_C( 14894), -INT16_C(  1198) } },
+    { {  INT16_C( 17254), -INT16_C( 30626), -INT16_C( 11987), -INT16_C(  6615),  INT16_C( 21234),  INT16_C( 28576), -INT16_C( 28435), -INT16_C( 14027) },
+      UINT8_C(145),
+      {  INT16_C( 17875), -INT16_C( 17266),  INT16_C( 20412), -INT16_C( 10003),  INT16_C( 11303), -INT16_C( 15536),  INT16_C(  1790), -INT16_C(   770) },
+      {  INT16_C( 17875),  INT16_C( 11303), -INT16_C(   770), -INT16_C(  6615),  INT16_C( 21234),  INT16_C( 28576), -INT16_C( 28435), -INT16_C( 14027) } },
+    { { -INT16_C( 25760), -INT16_C( 27806), -INT16_C( 13796),  INT16_C( 20077),  INT16_C( 32447), -INT16_C( 19331),  INT16_C( 28824),  INT16_C( 12510) },
+      UINT8_C(128),
+      {  INT16_C( 21158),  INT16_C( 20573),  INT16_C(  4137),  INT16_C( 30905),  INT16_C( 27984),  INT16_C( 20843),  INT16_C( 24111), -INT16_C( 17385) },
+      { -INT16_C( 17385), -INT16_C( 27806), -INT16_C( 13796),  INT16_C( 20077),  INT16_C( 32447), -INT16_C( 19331),  INT16_C( 28824),  INT16_C( 12510) } },
+    { {  INT16_C( 10533),  INT16_C( 23884),  INT16_C( 22328), -INT16_C( 29595),  INT16_C(  9265), -INT16_C( 25601),  INT16_C(  6035),  INT16_C( 24015) },
+      UINT8_C(128),
+      {  INT16_C( 16578),  INT16_C(  9425),  INT16_C(  7176), -INT16_C( 23620), -INT16_C(   742), -INT16_C( 16457),  INT16_C( 25815), -INT16_C(  1004) },
+      { -INT16_C(  1004),  INT16_C( 23884),  INT16_C( 22328), -INT16_C( 29595),  INT16_C(  9265), -INT16_C( 25601),  INT16_C(  6035),  INT16_C( 24015) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    int16_t r[8];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm_mask_compressstoreu_epi16(r, test_vec[i].k, a);
+    simde_assert_equal_vi16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  2029585223),  INT32_C(  1760707606),  INT32_C(   193190069),  INT32_C(   673640054) },
+      UINT8_C(166),
+      {  INT32_C(  1890823879),  INT32_C(  1631024967),  INT32_C(   198240925), -INT32_C(  1442573683) },
+      {  INT32_C(  1631024967),  INT32_C(   198240925),  INT32_C(   193190069),  INT32_C(   673640054) } },
+    { {  INT32_C(   286918194),  INT32_C(  1732652011),  INT32_C(  1255665616),  INT32_C(  1936922496) },
+      UINT8_C(229),
+      { -INT32_C(  2145007252), -INT32_C(   862139539), -INT32_C(   752631604), -INT32_C(  1878471594) },
+      { -INT32_C(  2145007252), -INT32_C(   752631604),  INT32_C(  1255665616),  INT32_C(  1936922496) } },
+    { { -INT32_C(   441287532),  INT32_C(   367258071), -INT32_C(  1950389200), -INT32_C(  2013774080) },
+      UINT8_C(  2),
+      {  INT32_C(  1711596741), -INT32_C(   825284836), -INT32_C(     6794833), -INT32_C(  1260537888) },
+      { -INT32_C(   825284836),  INT32_C(   367258071), -INT32_C(  1950389200), -INT32_C(  2013774080) } },
+    { {  INT32_C(  1542653833),  INT32_C(  1715107346), -INT32_C(  2078607028),  INT32_C(   256966919) },
+      UINT8_C(246),
+      { -INT32_C(  1132938918),  INT32_C(  2045567060),  INT32_C(   644735795),  INT32_C(  1364473162) },
+      {  INT32_C(  2045567060),  INT32_C(   644735795), -INT32_C(  2078607028),  INT32_C(   256966919) } },
+    { {  INT32_C(  1587361545), -INT32_C(  1568179272), -INT32_C(   235555446), -INT32_C(  1808226079) },
+      UINT8_C( 23),
+      { -INT32_C(   828227887), -INT32_C(  1303672182),  INT32_C(   706915339),  INT32_C(  1247645088) },
+      { -INT32_C(   828227887), -INT32_C(  1303672182),  INT32_C(   706915339), -INT32_C(  1808226079) } },
+    { {  INT32_C(    68344744),  INT32_C(  2049276534), -INT32_C(  1177028463),  INT32_C(   720698716) },
+      UINT8_C( 40),
+      { -INT32_C(  1819971725),  INT32_C(  1749750461),  INT32_C(   371779597),  INT32_C(   160007551) },
+      {  INT32_C(   160007551),  INT32_C(  2049276534), -INT32_C(  1177028463),  INT32_C(   720698716) } },
+    { {  INT32_C(  1098143043), -INT32_C(  1091357321),  INT32_C(   206608236),  INT32_C(  1705237012) },
+      UINT8_C(168),
+      { -INT32_C(   495165218), -INT32_C(      428035), -INT32_C(  1374840193), -INT32_C(   602915658) },
+      { -INT32_C(   602915658), -INT32_C(  1091357321),  INT32_C(   206608236),  INT32_C(  1705237012) } },
+    { {  INT32_C(  1215456081),  INT32_C(    71876670), -INT32_C(  1438061982),  INT32_C(   464196027) },
+      UINT8_C(144),
+      {  INT32_C(  1172651432), -INT32_C(  1134135758), -INT32_C(     4457843), -INT32_C(  1995728077) },
+      {  INT32_C(  1215456081),  INT32_C(    71876670), -INT32_C(  1438061982),  INT32_C(   464196027) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(157),
+      {  INT32_C(  1315007113),  INT32_C(    15950327),  INT32_C(   958372322), -INT32_C(  2014631751) },
+      {  INT32_C(  1315007113),  INT32_C(   958372322), -INT32_C(  2014631751),  INT32_C(           0) } },
+    { UINT8_C( 96),
+      {  INT32_C(   840297137),  INT32_C(  1205630208), -INT32_C(     7108311),  INT32_C(    45341320) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(190),
+      {  INT32_C(   853206355),  INT32_C(  1963694050), -INT32_C(  1595934975), -INT32_C(  1569635465) },
+      {  INT32_C(  1963694050), -INT32_C(  1595934975), -INT32_C(  1569635465),  INT32_C(           0) } },
+    { UINT8_C(239),
+      {  INT32_C(   240908058), -INT32_C(   120719304),  INT32_C(  1870742213),  INT32_C(  2025682772) },
+      {  INT32_C(   240908058), -INT32_C(   120719304),  INT32_C(  1870742213),  INT32_C(  2025682772) } },
+    { UINT8_C(118),
+      { -INT32_C(   584119577),  INT32_C(   476284698), -INT32_C(  1977083679),  INT32_C(  1659460195) },
+      {  INT32_C(   476284698), -INT32_C(  1977083679),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(194),
+      {  INT32_C(  1306324220), -INT32_C(    85091307), -INT32_C(   428544757),  INT32_C(   403242448) },
+      { -INT32_C(    85091307),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(189),
+      { -INT32_C(   959946148),  INT32_C(  1927259125),  INT32_C(   519558810),  INT32_C(    81187284) },
+      { -INT32_C(   959946148),  INT32_C(   519558810),  INT32_C(    81187284),  INT32_C(           0) } },
+    { UINT8_C( 82),
+      {  INT32_C(  1189126987), -INT32_C(  1635334003),  INT32_C(  2138838418),  INT32_C(  1455222187) },
+      { -INT32_C(  1635334003),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1642337666), -INT32_C(   750546665), -INT32_C(  1911661574), -INT32_C(  1123991931) },
+      UINT8_C(108),
+      { -INT32_C(  1972147769),  INT32_C(   409705025), -INT32_C(  2011014004), -INT32_C(   806251179) },
+      { -INT32_C(  2011014004), -INT32_C(   806251179), -INT32_C(  1911661574), -INT32_C(  1123991931) } },
+    { { -INT32_C(  1029111449),  INT32_C(   968430739),  INT32_C(   713713605),  INT32_C(   913828094) },
+      UINT8_C(123),
+      { -INT32_C(   406691751),  INT32_C(  1571835651), -INT32_C(  1176631598), -INT32_C(   893034801) },
+      { -INT32_C(   406691751),  INT32_C(  1571835651), -INT32_C(   893034801),  INT32_C(   913828094) } },
+    { {  INT32_C(   560037833),  INT32_C(   283204000),  INT32_C(   732252060),  INT32_C(   812655113) },
+      UINT8_C(100),
+      {  INT32_C(   715515039),  INT32_C(  1582158392),  INT32_C(   569166394), -INT32_C(   310508042) },
+      {  INT32_C(   569166394),  INT32_C(   283204000),  INT32_C(   732252060),  INT32_C(   812655113) } },
+    { { -INT32_C(  1889328996), -INT32_C(   737946333), -INT32_C(   945693372), -INT32_C(   418974944) },
+      UINT8_C(163),
+      { -INT32_C(  1431435057), -INT32_C(  1499831876),  INT32_C(   354926004),  INT32_C(   228447238) },
+      { -INT32_C(  1431435057), -INT32_C(  1499831876), -INT32_C(   945693372), -INT32_C(   418974944) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[4];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm_mask_compressstoreu_epi32(r, test_vec[i].k, a);
+    simde_assert_equal_vi32(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 7003482432633508746), -INT64_C( 4205803416716033952) },
+      UINT8_C(  9),
+      { -INT64_C( 3689505569082939275), -INT64_C( 7890199214832141885) },
+      { -INT64_C( 3689505569082939275), -INT64_C( 4205803416716033952) } },
+    { {  INT64_C( 7226732782755756253), -INT64_C( 3738942231884413107) },
+      UINT8_C(244),
+      {  INT64_C( 2625323787253315635),  INT64_C( 2126145977246603727) },
+      {  INT64_C( 7226732782755756253), -INT64_C( 3738942231884413107) } },
+    { {  INT64_C( 2349010158167141153),  INT64_C(  790623466619250613) },
+      UINT8_C( 97),
+      { -INT64_C( 1557459450768303286),  INT64_C( 7004695605654485879) },
+      { -INT64_C( 1557459450768303286),  INT64_C(  790623466619250613) } },
+    { {  INT64_C( 5604651310323548949),  INT64_C(  130547200344521762) },
+      UINT8_C(103),
+      { -INT64_C(   91598156310977223),  INT64_C( 8798696581874924732) },
+      { -INT64_C(   91598156310977223),  INT64_C( 8798696581874924732) } },
+    { { -INT64_C( 1957112194808961527),  INT64_C(  867242494675717458) },
+      UINT8_C(247),
+      { -INT64_C( 3071009730430433661),  INT64_C( 3441299988790865796) },
+      { -INT64_C( 3071009730430433661),  INT64_C( 3441299988790865796) } },
+    { { -INT64_C( 6281679034540012034),  INT64_C( 3491228945920165146) },
+      UINT8_C( 93),
+      {  INT64_C( 1177188704646850388), -INT64_C( 1571674376223783909) },
+      {  INT64_C( 1177188704646850388),  INT64_C( 3491228945920165146) } },
+    { {  INT64_C( 2697906535751612858),  INT64_C( 9023563548561786672) },
+      UINT8_C(159),
+      { -INT64_C( 3501681430332946208),  INT64_C( 3306672131683181469) },
+      { -INT64_C( 3501681430332946208),  INT64_C( 3306672131683181469) } },
+    { { -INT64_C( 8237548741089658850), -INT64_C( 4578184755396163863) },
+      UINT8_C(145),
+      {  INT64_C( 3372783532236197999),  INT64_C( 6060496055929184727) },
+      {  INT64_C( 3372783532236197999), -INT64_C( 4578184755396163863) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(251),
+      { -INT64_C( 5518181428836275821),  INT64_C( 3124141376779190678) },
+      { -INT64_C( 5518181428836275821),  INT64_C( 3124141376779190678) } },
+    { UINT8_C(150),
+      { -INT64_C( 1905225413514220443), -INT64_C( 8324995651099826139) },
+      { -INT64_C( 8324995651099826139),  INT64_C(                   0) } },
+    { UINT8_C(112),
+      { -INT64_C(  312780547274973217), -INT64_C( 7980435180125345132) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(160),
+      { -INT64_C( 1242892666404923242), -INT64_C( 6573714045589834861) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C(  949585556678377125), -INT64_C( 8278335622807674850) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(106),
+      {  INT64_C( 5332254296572804850),  INT64_C( 6774576469996481243) },
+      {  INT64_C( 6774576469996481243),  INT64_C(                   0) } },
+    { UINT8_C(249),
+      {  INT64_C( 4149907498332599118),  INT64_C( 6590525560102085957) },
+      {  INT64_C( 4149907498332599118),  INT64_C(                   0) } },
+    { UINT8_C( 18),
+      {  INT64_C( 1027760358337122005),  INT64_C(  262784361640588057) },
+      {  INT64_C(  262784361640588057),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 2499217933296578577),  INT64_C(  502719783487203225) },
+      UINT8_C(215),
+      {  INT64_C( 4342419571830794756), -INT64_C(  330496612653855712) },
+      {  INT64_C( 4342419571830794756), -INT64_C(  330496612653855712) } },
+    { { -INT64_C( 8789969714720042374), -INT64_C( 6626405928408585903) },
+      UINT8_C( 54),
+      { -INT64_C( 2692291838019778401), -INT64_C( 4341846584458591860) },
+      { -INT64_C( 4341846584458591860), -INT64_C( 6626405928408585903) } },
+    { {  INT64_C( 4486196471628196444), -INT64_C( 5952869515124839378) },
+      UINT8_C(  2),
+      { -INT64_C( 6352821491543362054), -INT64_C( 2760785296727489244) },
+      { -INT64_C( 2760785296727489244), -INT64_C( 5952869515124839378) } },
+    { {  INT64_C(   47438353587794531), -INT64_C( 7475763942757621354) },
+      UINT8_C( 64),
+      {  INT64_C( 4823665172793623262),  INT64_C( 7018634920110313305) },
+      {  INT64_C(   47438353587794531), -INT64_C( 7475763942757621354) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    int64_t r[2];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm_mask_compressstoreu_epi64(r, test_vec[i].k, a);
+    simde_assert_equal_vi64(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   544.22), SIMDE_FLOAT32_C(  -715.95), SIMDE_FLOAT32_C(   517.26), SIMDE_FLOAT32_C(  -157.13) },
+      UINT8_C(248),
+      { SIMDE_FLOAT32_C(   127.50), SIMDE_FLOAT32_C(   240.84), SIMDE_FLOAT32_C(  -424.26), SIMDE_FLOAT32_C(   308.86) },
+      { SIMDE_FLOAT32_C(   308.86), SIMDE_FLOAT32_C(  -715.95), SIMDE_FLOAT32_C(   517.26), SIMDE_FLOAT32_C(  -157.13) } },
+    { { SIMDE_FLOAT32_C(  -283.39), SIMDE_FLOAT32_C(  -816.64), SIMDE_FLOAT32_C(   775.27), SIMDE_FLOAT32_C(    22.63) },
+      UINT8_C( 37),
+      { SIMDE_FLOAT32_C(  -155.31), SIMDE_FLOAT32_C(  -519.12), SIMDE_FLOAT32_C(   -63.66), SIMDE_FLOAT32_C(   376.48) },
+      { SIMDE_FLOAT32_C(  -155.31), SIMDE_FLOAT32_C(   -63.66), SIMDE_FLOAT32_C(   775.27), SIMDE_FLOAT32_C(    22.63) } },
+    { { SIMDE_FLOAT32_C(   914.18), SIMDE_FLOAT32_C(   663.89), SIMDE_FLOAT32_C(   736.69), SIMDE_FLOAT32_C(    -8.79) },
+      UINT8_C(157),
+      { SIMDE_FLOAT32_C(   687.88), SIMDE_FLOAT32_C(  -855.03), SIMDE_FLOAT32_C(  -443.50), SIMDE_FLOAT32_C(   615.99) },
+      { SIMDE_FLOAT32_C(   687.88), SIMDE_FLOAT32_C(  -443.50), SIMDE_FLOAT32_C(   615.99), SIMDE_FLOAT32_C(    -8.79) } },
+    { { SIMDE_FLOAT32_C(   152.02), SIMDE_FLOAT32_C(   873.04), SIMDE_FLOAT32_C(   647.89), SIMDE_FLOAT32_C(   111.47) },
+      UINT8_C(214),
+      { SIMDE_FLOAT32_C(   323.43), SIMDE_FLOAT32_C(   488.28), SIMDE_FLOAT32_C(  -700.80), SIMDE_FLOAT32_C(  -681.69) },
+      { SIMDE_FLOAT32_C(   488.28), SIMDE_FLOAT32_C(  -700.80), SIMDE_FLOAT32_C(   647.89), SIMDE_FLOAT32_C(   111.47) } },
+    { { SIMDE_FLOAT32_C(   143.41), SIMDE_FLOAT32_C(   744.44), SIMDE_FLOAT32_C(   224.85), SIMDE_FLOAT32_C(    99.35) },
+      UINT8_C(129),
+      { SIMDE_FLOAT32_C(     8.32), SIMDE_FLOAT32_C(   314.68), SIMDE_FLOAT32_C(  -397.00), SIMDE_FLOAT32_C(   -15.77) },
+      { SIMDE_FLOAT32_C(     8.32), SIMDE_FLOAT32_C(   744.44), SIMDE_FLOAT32_C(   224.85), SIMDE_FLOAT32_C(    99.35) } },
+    { { SIMDE_FLOAT32_C(  -915.57), SIMDE_FLOAT32_C(   384.67), SIMDE_FLOAT32_C(   644.51), SIMDE_FLOAT32_C(   184.02) },
+      UINT8_C(136),
+      { SIMDE_FLOAT32_C(   171.29), SIMDE_FLOAT32_C(  -255.05), SIMDE_FLOAT32_C(   555.47), SIMDE_FLOAT32_C(  -879.00) },
+      { SIMDE_FLOAT32_C(  -879.00), SIMDE_FLOAT32_C(   384.67), SIMDE_FLOAT32_C(   644.51), SIMDE_FLOAT32_C(   184.02) } },
+    { { SIMDE_FLOAT32_C(  -148.73), SIMDE_FLOAT32_C(  -601.73), SIMDE_FLOAT32_C(   407.63), SIMDE_FLOAT32_C(   228.62) },
+      UINT8_C(252),
+      { SIMDE_FLOAT32_C(  -139.81), SIMDE_FLOAT32_C(  -328.96), SIMDE_FLOAT32_C(   934.60), SIMDE_FLOAT32_C(   632.79) },
+      { SIMDE_FLOAT32_C(   934.60), SIMDE_FLOAT32_C(   632.79), SIMDE_FLOAT32_C(   407.63), SIMDE_FLOAT32_C(   228.62) } },
+    { { SIMDE_FLOAT32_C(   229.30), SIMDE_FLOAT32_C(   446.23), SIMDE_FLOAT32_C(    54.07), SIMDE_FLOAT32_C(  -862.47) },
+         UINT8_MAX,
+      { SIMDE_FLOAT32_C(  -667.90), SIMDE_FLOAT32_C(   973.54), SIMDE_FLOAT32_C(   287.33), SIMDE_FLOAT32_C(  -708.89) },
+      { SIMDE_FLOAT32_C(  -667.90), SIMDE_FLOAT32_C(   973.54), SIMDE_FLOAT32_C(   287.33), SIMDE_FLOAT32_C(  -708.89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_compress_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C( 38),
+      { SIMDE_FLOAT32_C(   341.13), SIMDE_FLOAT32_C(  -339.99), SIMDE_FLOAT32_C(  -314.53), SIMDE_FLOAT32_C(  -830.07) },
+      { SIMDE_FLOAT32_C(  -339.99), SIMDE_FLOAT32_C(  -314.53), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(221),
+      { SIMDE_FLOAT32_C(   190.30), SIMDE_FLOAT32_C(  -456.25), SIMDE_FLOAT32_C(   405.92), SIMDE_FLOAT32_C(  -962.37) },
+      { SIMDE_FLOAT32_C(   190.30), SIMDE_FLOAT32_C(   405.92), SIMDE_FLOAT32_C(  -962.37), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(112),
+      { SIMDE_FLOAT32_C(  -374.71), SIMDE_FLOAT32_C(  -807.20), SIMDE_FLOAT32_C(  -718.80), SIMDE_FLOAT32_C(   454.89) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  5),
+      { SIMDE_FLOAT32_C(   439.91), SIMDE_FLOAT32_C(  -827.72), SIMDE_FLOAT32_C(  -602.15), SIMDE_FLOAT32_C(   -40.95) },
+      { SIMDE_FLOAT32_C(   439.91), SIMDE_FLOAT32_C(  -602.15), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 65),
+      { SIMDE_FLOAT32_C(  -692.23), SIMDE_FLOAT32_C(    90.60), SIMDE_FLOAT32_C(  -523.68), SIMDE_FLOAT32_C(   610.55) },
+      { SIMDE_FLOAT32_C(  -692.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(136),
+      { SIMDE_FLOAT32_C(  -811.56), SIMDE_FLOAT32_C(  -768.56), SIMDE_FLOAT32_C(   701.24), SIMDE_FLOAT32_C(  -458.05) },
+      { SIMDE_FLOAT32_C(  -458.05), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(179),
+      { SIMDE_FLOAT32_C(   129.23), SIMDE_FLOAT32_C(    -8.53), SIMDE_FLOAT32_C(  -959.72), SIMDE_FLOAT32_C(  -109.82) },
+      { SIMDE_FLOAT32_C(   129.23), SIMDE_FLOAT32_C(    -8.53), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(239),
+      { SIMDE_FLOAT32_C(  -453.22), SIMDE_FLOAT32_C(   821.51), SIMDE_FLOAT32_C(  -450.59), SIMDE_FLOAT32_C(  -526.38) },
+      { SIMDE_FLOAT32_C(  -453.22), SIMDE_FLOAT32_C(   821.51), SIMDE_FLOAT32_C(  -450.59), SIMDE_FLOAT32_C(  -526.38) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_compress_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   818.63), SIMDE_FLOAT32_C(   521.84), SIMDE_FLOAT32_C(   222.80), SIMDE_FLOAT32_C(  -891.60) },
+      UINT8_C(240),
+      { SIMDE_FLOAT32_C(  -661.57), SIMDE_FLOAT32_C(  -270.63), SIMDE_FLOAT32_C(  -695.86), SIMDE_FLOAT32_C(  -322.12) },
+      { SIMDE_FLOAT32_C(   818.63), SIMDE_FLOAT32_C(   521.84), SIMDE_FLOAT32_C(   222.80), SIMDE_FLOAT32_C(  -891.60) } },
+    { { SIMDE_FLOAT32_C(   599.13), SIMDE_FLOAT32_C(   632.76), SIMDE_FLOAT32_C(   -62.74), SIMDE_FLOAT32_C(  -194.60) },
+      UINT8_C( 52),
+      { SIMDE_FLOAT32_C(  -485.79), SIMDE_FLOAT32_C(  -978.93), SIMDE_FLOAT32_C(  -819.07), SIMDE_FLOAT32_C(   813.13) },
+      { SIMDE_FLOAT32_C(  -819.07), SIMDE_FLOAT32_C(   632.76), SIMDE_FLOAT32_C(   -62.74), SIMDE_FLOAT32_C(  -194.60) } },
+    { { SIMDE_FLOAT32_C(  -186.65), SIMDE_FLOAT32_C(    70.23), SIMDE_FLOAT32_C(  -475.22), SIMDE_FLOAT32_C(  -616.56) },
+      UINT8_C( 95),
+      { SIMDE_FLOAT32_C(  -812.70), SIMDE_FLOAT32_C(   654.72), SIMDE_FLOAT32_C(  -303.14), SIMDE_FLOAT32_C(   113.38) },
+      { SIMDE_FLOAT32_C(  -812.70), SIMDE_FLOAT32_C(   654.72), SIMDE_FLOAT32_C(  -303.14), SIMDE_FLOAT32_C(   113.38) } },
+    { { SIMDE_FLOAT32_C(  -267.99), SIMDE_FLOAT32_C(   197.45), SIMDE_FLOAT32_C(  -649.32), SIMDE_FLOAT32_C(   327.72) },
+      UINT8_C(180),
+      { SIMDE_FLOAT32_C(  -676.05), SIMDE_FLOAT32_C(  -750.82), SIMDE_FLOAT32_C(   -92.06), SIMDE_FLOAT32_C(   346.98) },
+      { SIMDE_FLOAT32_C(   -92.06), SIMDE_FLOAT32_C(   197.45), SIMDE_FLOAT32_C(  -649.32), SIMDE_FLOAT32_C(   327.72) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[4];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm_mask_compressstoreu_ps(r, test_vec[i].k, a);
+    simde_assert_equal_vf32(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -383.81), SIMDE_FLOAT64_C(   291.21) },
+      UINT8_C( 72),
+      { SIMDE_FLOAT64_C(   518.51), SIMDE_FLOAT64_C(  -691.83) },
+      { SIMDE_FLOAT64_C(  -383.81), SIMDE_FLOAT64_C(   291.21) } },
+    { { SIMDE_FLOAT64_C(  -248.99), SIMDE_FLOAT64_C(  -795.10) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(   773.88), SIMDE_FLOAT64_C(   699.60) },
+      { SIMDE_FLOAT64_C(   773.88), SIMDE_FLOAT64_C(   699.60) } },
+    { { SIMDE_FLOAT64_C(   251.67), SIMDE_FLOAT64_C(    16.14) },
+      UINT8_C(123),
+      { SIMDE_FLOAT64_C(  -479.06), SIMDE_FLOAT64_C(   948.49) },
+      { SIMDE_FLOAT64_C(  -479.06), SIMDE_FLOAT64_C(   948.49) } },
+    { { SIMDE_FLOAT64_C(   676.82), SIMDE_FLOAT64_C(  -831.73) },
+      UINT8_C( 85),
+      { SIMDE_FLOAT64_C(   -37.78), SIMDE_FLOAT64_C(    98.64) },
+      { SIMDE_FLOAT64_C(   -37.78), SIMDE_FLOAT64_C(  -831.73) } },
+    { { SIMDE_FLOAT64_C(   531.68), SIMDE_FLOAT64_C(   155.78) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT64_C(   726.21), SIMDE_FLOAT64_C(  -298.39) },
+      { SIMDE_FLOAT64_C(   531.68), SIMDE_FLOAT64_C(   155.78) } },
+    { { SIMDE_FLOAT64_C(   600.66), SIMDE_FLOAT64_C(  -358.49) },
+      UINT8_C(223),
+      { SIMDE_FLOAT64_C(  -960.35), SIMDE_FLOAT64_C(    78.80) },
+      { SIMDE_FLOAT64_C(  -960.35), SIMDE_FLOAT64_C(    78.80) } },
+    { { SIMDE_FLOAT64_C(  -340.30), SIMDE_FLOAT64_C(    17.36) },
+      UINT8_C( 82),
+      { SIMDE_FLOAT64_C(   102.69), SIMDE_FLOAT64_C(  -270.40) },
+      { SIMDE_FLOAT64_C(  -270.40), SIMDE_FLOAT64_C(    17.36) } },
+    { { SIMDE_FLOAT64_C(   548.50), SIMDE_FLOAT64_C(  -726.43) },
+      UINT8_C( 25),
+      { SIMDE_FLOAT64_C(   431.11), SIMDE_FLOAT64_C(   723.43) },
+      { SIMDE_FLOAT64_C(   431.11), SIMDE_FLOAT64_C(  -726.43) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_compress_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C( 25),
+      { SIMDE_FLOAT64_C(   -46.90), SIMDE_FLOAT64_C(  -957.66) },
+      { SIMDE_FLOAT64_C(   -46.90), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(169),
+      { SIMDE_FLOAT64_C(   827.94), SIMDE_FLOAT64_C(   -98.57) },
+      { SIMDE_FLOAT64_C(   827.94), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(126),
+      { SIMDE_FLOAT64_C(   229.95), SIMDE_FLOAT64_C(  -809.84) },
+      { SIMDE_FLOAT64_C(  -809.84), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(160),
+      { SIMDE_FLOAT64_C(   257.34), SIMDE_FLOAT64_C(   758.64) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(246),
+      { SIMDE_FLOAT64_C(    35.83), SIMDE_FLOAT64_C(   136.05) },
+      { SIMDE_FLOAT64_C(   136.05), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 17),
+      { SIMDE_FLOAT64_C(  -711.61), SIMDE_FLOAT64_C(  -849.28) },
+      { SIMDE_FLOAT64_C(  -711.61), SIMDE_FLOAT64_C(     0.00) } },
+    {    UINT8_MAX,
+      { SIMDE_FLOAT64_C(   719.83), SIMDE_FLOAT64_C(  -428.35) },
+      { SIMDE_FLOAT64_C(   719.83), SIMDE_FLOAT64_C(  -428.35) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   351.52), SIMDE_FLOAT64_C(    34.53) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_compress_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -562.61), SIMDE_FLOAT64_C(   701.17) },
+      UINT8_C(201),
+      { SIMDE_FLOAT64_C(   824.28), SIMDE_FLOAT64_C(   633.15) },
+      { SIMDE_FLOAT64_C(   824.28), SIMDE_FLOAT64_C(   701.17) } },
+    { { SIMDE_FLOAT64_C(   738.95), SIMDE_FLOAT64_C(   915.94) },
+      UINT8_C(110),
+      { SIMDE_FLOAT64_C(   241.92), SIMDE_FLOAT64_C(  -686.25) },
+      { SIMDE_FLOAT64_C(  -686.25), SIMDE_FLOAT64_C(   915.94) } },
+    { { SIMDE_FLOAT64_C(  -591.58), SIMDE_FLOAT64_C(  -958.59) },
+      UINT8_C( 17),
+      { SIMDE_FLOAT64_C(   -27.67), SIMDE_FLOAT64_C(   -40.08) },
+      { SIMDE_FLOAT64_C(   -27.67), SIMDE_FLOAT64_C(  -958.59) } },
+    { { SIMDE_FLOAT64_C(   -79.60), SIMDE_FLOAT64_C(    82.50) },
+      UINT8_C(128),
+      { SIMDE_FLOAT64_C(   404.78), SIMDE_FLOAT64_C(   470.84) },
+      { SIMDE_FLOAT64_C(   -79.60), SIMDE_FLOAT64_C(    82.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_float64 r[2];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm_mask_compressstoreu_pd(r, test_vec[i].k, a);
+    simde_assert_equal_vf64(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C(  80),  INT8_C(  26), -INT8_C(  65), -INT8_C(  94), -INT8_C(   7), -INT8_C(  62), -INT8_C(  83),  INT8_C(  29),
+         INT8_C(  22),  INT8_C(  52), -INT8_C(   3), -INT8_C(   2),  INT8_C(  83),  INT8_C( 110), -INT8_C( 101), -INT8_C(  17),
+         INT8_C( 103), -INT8_C(  41), -INT8_C(  75),  INT8_C( 107), -INT8_C(  58), -INT8_C(  75), -INT8_C(  49), -INT8_C(  55),
+        -INT8_C(  40),  INT8_C(  80), -INT8_C(  68),  INT8_C(  83), -INT8_C( 123), -INT8_C(  11), -INT8_C(  50), -INT8_C(  72) },
+      UINT32_C(1539656419),
+      {  INT8_C(  64), -INT8_C(  48),  INT8_C(  22), -INT8_C( 114),  INT8_C(  79), -INT8_C(  72),  INT8_C( 124),  INT8_C(  25),
+        -INT8_C( 105),  INT8_C(  71),  INT8_C(  85),  INT8_C(  25), -INT8_C(  88), -INT8_C(  19),  INT8_C(   5), -INT8_C(  71),
+         INT8_C(  86),  INT8_C(  40),  INT8_C( 122), -INT8_C(  24), -INT8_C(  58), -INT8_C(  79),  INT8_C(  73),  INT8_C(  25),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  16),  INT8_C(  60), -INT8_C(  85),  INT8_C(  91),  INT8_C( 116),  INT8_C(  68) },
+      {  INT8_C(  64), -INT8_C(  48), -INT8_C(  72),  INT8_C( 124),  INT8_C(  25),  INT8_C(  71),  INT8_C(  25),  INT8_C(   5),
+         INT8_C(  86),  INT8_C( 122),  INT8_C(  73),  INT8_C(  25),  INT8_C(   8),  INT8_C(   4),  INT8_C(  60), -INT8_C(  85),
+         INT8_C( 116), -INT8_C(  41), -INT8_C(  75),  INT8_C( 107), -INT8_C(  58), -INT8_C(  75), -INT8_C(  49), -INT8_C(  55),
+        -INT8_C(  40),  INT8_C(  80), -INT8_C(  68),  INT8_C(  83), -INT8_C( 123), -INT8_C(  11), -INT8_C(  50), -INT8_C(  72) } },
+    { {  INT8_C(  42),  INT8_C( 102), -INT8_C(  69), -INT8_C( 103),  INT8_C(  31), -INT8_C(  97), -INT8_C(  45),  INT8_C(  67),
+         INT8_C(  37),  INT8_C(  76), -INT8_C(  14), -INT8_C(  78),  INT8_C(  62), -INT8_C( 112),  INT8_C(  32),  INT8_C(  56),
+         INT8_C( 119), -INT8_C(  11),  INT8_C( 121), -INT8_C( 124),  INT8_C(  63),  INT8_C(  80), -INT8_C(  75), -INT8_C( 125),
+         INT8_C(  54), -INT8_C(   2),  INT8_C(  59),  INT8_C(  60),  INT8_C(  26), -INT8_C(  21), -INT8_C( 100),  INT8_C(  33) },
+      UINT32_C(3982793226),
+      { -INT8_C(  34),  INT8_C( 126), -INT8_C(  68),  INT8_C(  48), -INT8_C( 101), -INT8_C(  81), -INT8_C(  19),  INT8_C(   1),
+         INT8_C(  10),  INT8_C(  89),  INT8_C(  63),  INT8_C(  77), -INT8_C(  83),  INT8_C(  18), -INT8_C(  79), -INT8_C(  85),
+         INT8_C(  75), -INT8_C(  13),  INT8_C(   0),  INT8_C(  40), -INT8_C( 112),  INT8_C(  34), -INT8_C(  52), -INT8_C(  49),
+         INT8_C(  18),  INT8_C(  16), -INT8_C(  99),  INT8_C( 123), -INT8_C( 104),  INT8_C(  74), -INT8_C(  86), -INT8_C(  58) },
+      {  INT8_C( 126),  INT8_C(  48),  INT8_C(  89),  INT8_C(  77), -INT8_C(  83), -INT8_C(  85),  INT8_C(   0),  INT8_C(  34),
+        -INT8_C(  52),  INT8_C(  18), -INT8_C(  99),  INT8_C( 123),  INT8_C(  74), -INT8_C(  86), -INT8_C(  58),  INT8_C(  56),
+         INT8_C( 119), -INT8_C(  11),  INT8_C( 121), -INT8_C( 124),  INT8_C(  63),  INT8_C(  80), -INT8_C(  75), -INT8_C( 125),
+         INT8_C(  54), -INT8_C(   2),  INT8_C(  59),  INT8_C(  60),  INT8_C(  26), -INT8_C(  21), -INT8_C( 100),  INT8_C(  33) } },
+    { { -INT8_C( 117), -INT8_C(  20), -INT8_C( 126),  INT8_C( 117),  INT8_C(  86),  INT8_C(  43), -INT8_C(  90), -INT8_C(  40),
+        -INT8_C(  86),  INT8_C(  97), -INT8_C(  57),  INT8_C(  65),  INT8_C( 101),  INT8_C(  95), -INT8_C(  68),  INT8_C(  99),
+         INT8_C(  35), -INT8_C(  92), -INT8_C(  69),  INT8_C(  54), -INT8_C(  71), -INT8_C(  68),  INT8_C(  75),  INT8_C(  30),
+        -INT8_C(  70), -INT8_C(  20), -INT8_C(  79),  INT8_C(  84),  INT8_C(  37), -INT8_C(  57), -INT8_C(  65), -INT8_C(  49) },
+      UINT32_C(2716065349),
+      {  INT8_C(  12),  INT8_C( 113),  INT8_C(  80), -INT8_C( 112),  INT8_C(  93),  INT8_C(  65), -INT8_C(  26),  INT8_C( 125),
+         INT8_C( 124),  INT8_C(  95),  INT8_C(  70),  INT8_C( 118), -INT8_C(  75), -INT8_C(  43),  INT8_C(  37), -INT8_C(  25),
+        -INT8_C( 121),  INT8_C(  49), -INT8_C(  45),  INT8_C(  51),  INT8_C(  65),  INT8_C(  70),  INT8_C( 103),  INT8_C( 108),
+         INT8_C(  55), -INT8_C(  53),  INT8_C( 118),  INT8_C(  74),  INT8_C(  39), -INT8_C(  82),  INT8_C( 122), -INT8_C(   9) },
+      {  INT8_C(  12),  INT8_C(  80), -INT8_C(  26),  INT8_C(  95),  INT8_C(  70),  INT8_C( 118), -INT8_C(  75),  INT8_C(  37),
+        -INT8_C(  25), -INT8_C( 121),  INT8_C(  49),  INT8_C(  70),  INT8_C( 103),  INT8_C( 108),  INT8_C(  55), -INT8_C(  82),
+        -INT8_C(   9), -INT8_C(  92), -INT8_C(  69),  INT8_C(  54), -INT8_C(  71), -INT8_C(  68),  INT8_C(  75),  INT8_C(  30),
+        -INT8_C(  70), -INT8_C(  20), -INT8_C(  79),  INT8_C(  84),  INT8_C(  37), -INT8_C(  57), -INT8_C(  65), -INT8_C(  49) } },
+    { {  INT8_C(  51),  INT8_C(  82), -INT8_C( 105),  INT8_C(   3), -INT8_C(  96),  INT8_C(   2),  INT8_C(  65), -INT8_C(   4),
+        -INT8_C(  19),  INT8_C(  93), -INT8_C(  95), -INT8_C(  36),  INT8_C(  83),  INT8_C( 105),  INT8_C(  70),  INT8_C( 121),
+        -INT8_C(  68), -INT8_C(  10), -INT8_C(  33), -INT8_C(  76),  INT8_C(  28), -INT8_C(  52), -INT8_C( 111),  INT8_C(  52),
+        -INT8_C(  47),  INT8_C( 122),  INT8_C(  42),  INT8_C( 122), -INT8_C(  51),  INT8_C( 100),  INT8_C(  54),  INT8_C(  26) },
+      UINT32_C(3408576753),
+      { -INT8_C(  78), -INT8_C(   2), -INT8_C(  49), -INT8_C(  17), -INT8_C(  26),  INT8_C(  48), -INT8_C(  67), -INT8_C(  45),
+        -INT8_C(  31), -INT8_C(  42),  INT8_C(  60),  INT8_C(  38),  INT8_C(  58), -INT8_C(  73),  INT8_C(  20),  INT8_C(   7),
+        -INT8_C(  72), -INT8_C(   1),  INT8_C(  55), -INT8_C( 118), -INT8_C(  40),  INT8_C(   1),  INT8_C(  22),  INT8_C(  18),
+         INT8_C(   1), -INT8_C(  61),  INT8_C(   6),  INT8_C( 120), -INT8_C(  90),  INT8_C(  11), -INT8_C( 114),  INT8_C(  17) },
+      { -INT8_C(  78), -INT8_C(  26),  INT8_C(  48), -INT8_C(  67), -INT8_C(  45),  INT8_C(  20),  INT8_C(   7), -INT8_C(   1),
+        -INT8_C( 118),  INT8_C(   1),  INT8_C(   1), -INT8_C(  61),  INT8_C( 120), -INT8_C( 114),  INT8_C(  17),  INT8_C( 121),
+        -INT8_C(  68), -INT8_C(  10), -INT8_C(  33), -INT8_C(  76),  INT8_C(  28), -INT8_C(  52), -INT8_C( 111),  INT8_C(  52),
+        -INT8_C(  47),  INT8_C( 122),  INT8_C(  42),  INT8_C( 122), -INT8_C(  51),  INT8_C( 100),  INT8_C(  54),  INT8_C(  26) } },
+    { { -INT8_C(  51),  INT8_C(  71), -INT8_C(  47), -INT8_C(  61), -INT8_C(  83), -INT8_C(  45),  INT8_C(   5),  INT8_C(  28),
+        -INT8_C( 101),  INT8_C(  90),  INT8_C(  57), -INT8_C(   9),  INT8_C( 118),  INT8_C( 103),  INT8_C(  61),  INT8_C(  48),
+        -INT8_C(  18),  INT8_C(  10),  INT8_C(  50), -INT8_C(  10), -INT8_C(  90), -INT8_C(  72), -INT8_C(  92),  INT8_C(  26),
+        -INT8_C( 127), -INT8_C(  76), -INT8_C(  67), -INT8_C(  29),  INT8_C(  60),  INT8_C(  30),  INT8_C(  53), -INT8_C(  56) },
+      UINT32_C(2615362075),
+      { -INT8_C(  97), -INT8_C(  94), -INT8_C(  56), -INT8_C( 113),  INT8_C(  83), -INT8_C(  55), -INT8_C(  89),  INT8_C(  95),
+        -INT8_C(  34), -INT8_C(  84),  INT8_C(  53),      INT8_MAX, -INT8_C(  27), -INT8_C(  76),  INT8_C(  85), -INT8_C(  57),
+         INT8_C( 120), -INT8_C(  30), -INT8_C(  88),  INT8_C( 121), -INT8_C( 113), -INT8_C(  83), -INT8_C(  59),  INT8_C(  25),
+         INT8_C(   3),  INT8_C(  43), -INT8_C(  16),  INT8_C(  11), -INT8_C(  51), -INT8_C(  49),  INT8_C(  90), -INT8_C( 118) },
+      { -INT8_C(  97), -INT8_C(  94), -INT8_C( 113),  INT8_C(  83), -INT8_C(  84),  INT8_C(  85),  INT8_C( 120), -INT8_C(  30),
+        -INT8_C(  83), -INT8_C(  59),  INT8_C(  25),  INT8_C(   3),  INT8_C(  43),  INT8_C(  11), -INT8_C(  51), -INT8_C( 118),
+        -INT8_C(  18),  INT8_C(  10),  INT8_C(  50), -INT8_C(  10), -INT8_C(  90), -INT8_C(  72), -INT8_C(  92),  INT8_C(  26),
+        -INT8_C( 127), -INT8_C(  76), -INT8_C(  67), -INT8_C(  29),  INT8_C(  60),  INT8_C(  30),  INT8_C(  53), -INT8_C(  56) } },
+    { {  INT8_C(  33), -INT8_C(  42), -INT8_C(  84), -INT8_C(  48), -INT8_C( 112), -INT8_C(  73), -INT8_C(  71),  INT8_C(  24),
+         INT8_C(  26), -INT8_C( 116),  INT8_C(  84), -INT8_C( 112), -INT8_C(  52), -INT8_C(  33), -INT8_C(  86),      INT8_MIN,
+         INT8_C(  62), -INT8_C(  94), -INT8_C(  18),  INT8_C(  74), -INT8_C(  10),  INT8_C(  80),  INT8_C(  51),  INT8_C(  43),
+        -INT8_C(  16),  INT8_C(  49),  INT8_C(  72), -INT8_C( 121), -INT8_C(   5),  INT8_C(   6), -INT8_C( 104),  INT8_C(  61) },
+      UINT32_C( 570438944),
+      {  INT8_C(  43),  INT8_C(  52),  INT8_C( 104), -INT8_C(   8),  INT8_C(  84), -INT8_C(  39), -INT8_C(  26), -INT8_C(  52),
+        -INT8_C(  20),  INT8_C(   1),  INT8_C( 103),  INT8_C( 117), -INT8_C(  15),  INT8_C(  42), -INT8_C(  34), -INT8_C(   7),
+         INT8_C(   5),  INT8_C(   2), -INT8_C( 117), -INT8_C(  34),  INT8_C(  31), -INT8_C(  10), -INT8_C(  95),  INT8_C(  26),
+         INT8_C(  40), -INT8_C(  24), -INT8_C( 111), -INT8_C(   2), -INT8_C(  81), -INT8_C(  88), -INT8_C(   3),  INT8_C(  98) },
+      { -INT8_C(  39), -INT8_C(  20),  INT8_C( 103), -INT8_C(  15),  INT8_C(  42), -INT8_C(  24), -INT8_C(  88),  INT8_C(  24),
+         INT8_C(  26), -INT8_C( 116),  INT8_C(  84), -INT8_C( 112), -INT8_C(  52), -INT8_C(  33), -INT8_C(  86),      INT8_MIN,
+         INT8_C(  62), -INT8_C(  94), -INT8_C(  18),  INT8_C(  74), -INT8_C(  10),  INT8_C(  80),  INT8_C(  51),  INT8_C(  43),
+        -INT8_C(  16),  INT8_C(  49),  INT8_C(  72), -INT8_C( 121), -INT8_C(   5),  INT8_C(   6), -INT8_C( 104),  INT8_C(  61) } },
+    { { -INT8_C(  58),  INT8_C(  61),  INT8_C(  54), -INT8_C(  93), -INT8_C(  91),  INT8_C(  70), -INT8_C(  59),  INT8_C(  86),
+        -INT8_C(   9),  INT8_C(  45), -INT8_C(  23),  INT8_C(  66),  INT8_C(  18), -INT8_C(  94),  INT8_C( 115), -INT8_C( 121),
+        -INT8_C( 102),      INT8_MAX, -INT8_C( 112),  INT8_C(  66), -INT8_C(  95),  INT8_C(  89), -INT8_C(  47), -INT8_C(  55),
+        -INT8_C(  94), -INT8_C(  23), -INT8_C(  47),  INT8_C( 124), -INT8_C(  13),  INT8_C(  35),  INT8_C(  47), -INT8_C(  58) },
+      UINT32_C(4190093043),
+      { -INT8_C(  59), -INT8_C(  56),  INT8_C(  35), -INT8_C( 107), -INT8_C(  30), -INT8_C(   7), -INT8_C(  59), -INT8_C(   7),
+         INT8_C( 104),  INT8_C(  60),  INT8_C(  62), -INT8_C(  67),  INT8_C(  11), -INT8_C(  54), -INT8_C(  92), -INT8_C(  34),
+         INT8_C(  49), -INT8_C( 103), -INT8_C(  65),  INT8_C(  29),  INT8_C(  36), -INT8_C(  35), -INT8_C(  66),  INT8_C(  12),
+         INT8_C(  98),  INT8_C(   6), -INT8_C(  81), -INT8_C(  87), -INT8_C(  14), -INT8_C( 120), -INT8_C(  89),  INT8_C(  30) },
+      { -INT8_C(  59), -INT8_C(  56), -INT8_C(  30), -INT8_C(   7), -INT8_C(  59), -INT8_C(   7),  INT8_C(  60),  INT8_C(  62),
+        -INT8_C(  67),  INT8_C(  11), -INT8_C(  54), -INT8_C(  34),  INT8_C(  49), -INT8_C( 103), -INT8_C(  65),  INT8_C(  29),
+         INT8_C(  36), -INT8_C(  35),  INT8_C(  12),  INT8_C(  98), -INT8_C(  87), -INT8_C(  14), -INT8_C( 120), -INT8_C(  89),
+         INT8_C(  30), -INT8_C(  23), -INT8_C(  47),  INT8_C( 124), -INT8_C(  13),  INT8_C(  35),  INT8_C(  47), -INT8_C(  58) } },
+    { {  INT8_C(  41), -INT8_C(  75),  INT8_C(  22),  INT8_C( 119),  INT8_C( 107),  INT8_C(  51),  INT8_C( 122),  INT8_C( 110),
+        -INT8_C( 109), -INT8_C(  31), -INT8_C(  53),  INT8_C( 112), -INT8_C( 116),  INT8_C(  96),  INT8_C(  77), -INT8_C( 102),
+         INT8_C(  16), -INT8_C(  45), -INT8_C( 105), -INT8_C(  40),  INT8_C(  77), -INT8_C(  20), -INT8_C( 118), -INT8_C( 116),
+        -INT8_C(  16),  INT8_C(  89),      INT8_MAX, -INT8_C(  96),  INT8_C( 110), -INT8_C( 116), -INT8_C(  35),  INT8_C(  47) },
+      UINT32_C(1490804826),
+      { -INT8_C( 121), -INT8_C(  43),  INT8_C(  27), -INT8_C( 107),  INT8_C(  44),  INT8_C(   5),  INT8_C(  61),  INT8_C( 114),
+         INT8_C(   0),  INT8_C(  34), -INT8_C(  43),  INT8_C(  54), -INT8_C(  55),  INT8_C(  85),  INT8_C(  91),  INT8_C( 107),
+         INT8_C(   3),  INT8_C(  42),  INT8_C( 123), -INT8_C(   9), -INT8_C(  45),  INT8_C( 111),  INT8_C(  19), -INT8_C(  41),
+         INT8_C(  32), -INT8_C(   8),  INT8_C(  78), -INT8_C(  48),  INT8_C(  45),  INT8_C(  17), -INT8_C(  79), -INT8_C( 127) },
+      { -INT8_C(  43), -INT8_C( 107),  INT8_C(  44),  INT8_C(  61),  INT8_C(  85),  INT8_C(  91),  INT8_C( 107),  INT8_C(   3),
+         INT8_C(  42), -INT8_C(   9), -INT8_C(  45),  INT8_C(  19), -INT8_C(  41), -INT8_C(  48),  INT8_C(  45), -INT8_C(  79),
+         INT8_C(  16), -INT8_C(  45), -INT8_C( 105), -INT8_C(  40),  INT8_C(  77), -INT8_C(  20), -INT8_C( 118), -INT8_C( 116),
+        -INT8_C(  16),  INT8_C(  89),      INT8_MAX, -INT8_C(  96),  INT8_C( 110), -INT8_C( 116), -INT8_C(  35),  INT8_C(  47) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3713342381),
+      { -INT8_C(  91),  INT8_C( 122),  INT8_C( 118), -INT8_C(  51),  INT8_C(  20),  INT8_C(  33),  INT8_C(  47), -INT8_C(  28),
+        -INT8_C(  18),  INT8_C( 100),  INT8_C(  24), -INT8_C(  63), -INT8_C(   2),  INT8_C(  12),  INT8_C(  24), -INT8_C(  38),
+        -INT8_C(  68),  INT8_C( 115),  INT8_C(  27), -INT8_C(   4), -INT8_C( 106), -INT8_C( 117),  INT8_C(  47),  INT8_C( 113),
+         INT8_C(  76), -INT8_C(  95), -INT8_C(  47), -INT8_C(  72),  INT8_C(   4),  INT8_C(  19),  INT8_C(  71),  INT8_C(  31) },
+      { -INT8_C(  91),  INT8_C( 118), -INT8_C(  51),  INT8_C(  33), -INT8_C(  28), -INT8_C(  18),  INT8_C( 100), -INT8_C(  63),
+        -INT8_C(   2), -INT8_C(  68),  INT8_C(  27), -INT8_C( 106),  INT8_C(  47),  INT8_C(  76), -INT8_C(  47), -INT8_C(  72),
+         INT8_C(   4),  INT8_C(  71),  INT8_C(  31),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3391550799),
+      { -INT8_C( 115),  INT8_C(  20),  INT8_C(  27),  INT8_C( 109), -INT8_C(  99),  INT8_C(  42), -INT8_C(  73),  INT8_C(  15),
+        -INT8_C(  17),  INT8_C( 121), -INT8_C(  95), -INT8_C( 110), -INT8_C(  79), -INT8_C( 103),  INT8_C( 114), -INT8_C(   1),
+         INT8_C(  19), -INT8_C(  26),  INT8_C(  58), -INT8_C(   5),  INT8_C(  94),  INT8_C(  39),  INT8_C(  75), -INT8_C(  93),
+         INT8_C(  45), -INT8_C( 102),  INT8_C(  53),  INT8_C(  23),  INT8_C(  84), -INT8_C(  18),  INT8_C(  80), -INT8_C(   8) },
+      { -INT8_C( 115),  INT8_C(  20),  INT8_C(  27),  INT8_C( 109), -INT8_C(  73), -INT8_C(  17), -INT8_C(  95), -INT8_C(  79),
+        -INT8_C( 103),  INT8_C( 114), -INT8_C(   1), -INT8_C(  26),  INT8_C(  58),  INT8_C(  39), -INT8_C( 102),  INT8_C(  23),
+         INT8_C(  80), -INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3756948971),
+      {  INT8_C(  96), -INT8_C(  63),  INT8_C(  89),      INT8_MAX, -INT8_C(   3),  INT8_C(  78), -INT8_C(   6),  INT8_C(  81),
+        -INT8_C( 105), -INT8_C(  84), -INT8_C(  63), -INT8_C(   3), -INT8_C( 100),  INT8_C( 114),  INT8_C(  78), -INT8_C( 120),
+         INT8_C(  68), -INT8_C(  91),  INT8_C(  72),  INT8_C( 111), -INT8_C(  74), -INT8_C(  22), -INT8_C(   3),  INT8_C( 121),
+         INT8_C(  33), -INT8_C(  67),  INT8_C(  43),  INT8_C(  27), -INT8_C( 117), -INT8_C(  15),  INT8_C(  82),  INT8_C(  76) },
+      {  INT8_C(  96), -INT8_C(  63),      INT8_MAX,  INT8_C(  78), -INT8_C(   6),  INT8_C(  81), -INT8_C( 105), -INT8_C(  63),
+        -INT8_C(   3), -INT8_C( 100),  INT8_C( 114),  INT8_C(  78), -INT8_C(  91),  INT8_C(  72),  INT8_C( 111), -INT8_C(  22),
+        -INT8_C(   3),  INT8_C( 121),  INT8_C(  33), -INT8_C(  67),  INT8_C(  43),  INT8_C(  27), -INT8_C( 117),  INT8_C(  82),
+         INT8_C(  76),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(2269034778),
+      {  INT8_C(  72), -INT8_C( 120),  INT8_C(  85),  INT8_C(  48),  INT8_C(  90),  INT8_C(   4), -INT8_C(  82),  INT8_C(  66),
+        -INT8_C(  15),  INT8_C(  75),  INT8_C(  25), -INT8_C(  28),  INT8_C(  94), -INT8_C(  98),      INT8_MAX, -INT8_C( 102),
+        -INT8_C(  18),  INT8_C(  72), -INT8_C(  94),  INT8_C(  45),  INT8_C(  58),  INT8_C( 116),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(  80), -INT8_C(  48), -INT8_C( 116), -INT8_C(  59),  INT8_C(  38), -INT8_C( 117),  INT8_C(  12),  INT8_C(  47) },
+      { -INT8_C( 120),  INT8_C(  48),  INT8_C(  90), -INT8_C(  15), -INT8_C(  28),  INT8_C(  94), -INT8_C(  98), -INT8_C( 102),
+         INT8_C(  72), -INT8_C(  94),  INT8_C(  45),  INT8_C(  58),  INT8_C( 116),  INT8_C(  80), -INT8_C(  48), -INT8_C( 116),
+         INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3384281973),
+      {  INT8_C(  31), -INT8_C(   1), -INT8_C(  23), -INT8_C(  37), -INT8_C( 115), -INT8_C(  68), -INT8_C(  85), -INT8_C( 115),
+        -INT8_C(  31),  INT8_C(   7), -INT8_C( 118),  INT8_C( 122), -INT8_C(  99), -INT8_C( 114),  INT8_C(  21),  INT8_C(  41),
+        -INT8_C(  20),  INT8_C(  57),  INT8_C(  36),  INT8_C(  44), -INT8_C(  17),  INT8_C( 114),  INT8_C(  32), -INT8_C( 114),
+         INT8_C(  98),  INT8_C(  16),  INT8_C(  55), -INT8_C(  14), -INT8_C(  14),  INT8_C(  35), -INT8_C(  52),  INT8_C(  46) },
+      {  INT8_C(  31), -INT8_C(  23), -INT8_C( 115), -INT8_C(  68), -INT8_C(  85), -INT8_C(  31),  INT8_C(   7),  INT8_C( 122),
+         INT8_C(  44), -INT8_C(  17),  INT8_C( 114), -INT8_C( 114),  INT8_C(  98), -INT8_C(  14), -INT8_C(  52),  INT8_C(  46),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1555884186),
+      {  INT8_C(  37), -INT8_C( 101),  INT8_C( 111),  INT8_C(  19), -INT8_C(  15), -INT8_C( 118),  INT8_C(  54), -INT8_C(   1),
+         INT8_C(  56), -INT8_C( 127), -INT8_C(   1),  INT8_C(  21),  INT8_C(  25),  INT8_C(   5), -INT8_C( 121), -INT8_C( 120),
+         INT8_C(  58),  INT8_C(  30),  INT8_C(  85), -INT8_C(  40),  INT8_C(   9), -INT8_C(  40), -INT8_C(  71), -INT8_C(  45),
+        -INT8_C(  79),  INT8_C( 112), -INT8_C(  31),  INT8_C(  31),  INT8_C(  99), -INT8_C(   3),  INT8_C(  83),  INT8_C(  71) },
+      { -INT8_C( 101),  INT8_C(  19), -INT8_C(  15), -INT8_C(   1),  INT8_C(  21),  INT8_C(   5), -INT8_C( 121), -INT8_C( 120),
+         INT8_C(  85), -INT8_C(  40),  INT8_C(   9), -INT8_C(  40), -INT8_C(  45), -INT8_C(  31),  INT8_C(  31),  INT8_C(  99),
+         INT8_C(  83),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3405704691),
+      { -INT8_C( 122), -INT8_C(  53),  INT8_C(  71), -INT8_C(  72),  INT8_C( 101),  INT8_C(  94), -INT8_C( 100), -INT8_C(  40),
+        -INT8_C(  93),  INT8_C( 109), -INT8_C(   4),      INT8_MAX, -INT8_C(  18),  INT8_C( 100),  INT8_C(  44), -INT8_C( 119),
+        -INT8_C( 122), -INT8_C(  16), -INT8_C(  19), -INT8_C(  91), -INT8_C(   4),  INT8_C(  31),  INT8_C(  42), -INT8_C(  38),
+        -INT8_C(  77), -INT8_C(  34),  INT8_C(   6), -INT8_C(  32), -INT8_C(  14), -INT8_C(  44), -INT8_C(  99),  INT8_C(  48) },
+      { -INT8_C( 122), -INT8_C(  53),  INT8_C( 101),  INT8_C(  94), -INT8_C( 100), -INT8_C(  40), -INT8_C(  93), -INT8_C(   4),
+             INT8_MAX,  INT8_C( 100),  INT8_C(  44), -INT8_C( 119), -INT8_C(  16), -INT8_C(  19), -INT8_C(  91), -INT8_C(   4),
+         INT8_C(  31),  INT8_C(  42), -INT8_C(  38), -INT8_C(  34), -INT8_C(  32), -INT8_C(  99),  INT8_C(  48),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 968050081),
+      {  INT8_C(  35),  INT8_C( 124), -INT8_C( 125), -INT8_C(  98),  INT8_C(  82),  INT8_C( 123),  INT8_C(  68), -INT8_C(  66),
+         INT8_C(   1), -INT8_C( 104), -INT8_C(  69), -INT8_C( 114),  INT8_C(  56),  INT8_C(  62),  INT8_C(  40),  INT8_C(  71),
+        -INT8_C(  53), -INT8_C(  36), -INT8_C(  24), -INT8_C( 123),      INT8_MAX, -INT8_C(   6),  INT8_C( 101), -INT8_C(  31),
+         INT8_C( 120), -INT8_C( 107), -INT8_C(  89), -INT8_C( 111), -INT8_C(  62), -INT8_C(  31),  INT8_C(  68),  INT8_C( 111) },
+      {  INT8_C(  35),  INT8_C( 123), -INT8_C(  66),  INT8_C(   1), -INT8_C(  69),  INT8_C(  40), -INT8_C(  53), -INT8_C(  36),
+             INT8_MAX, -INT8_C(   6), -INT8_C(  31),  INT8_C( 120), -INT8_C( 111), -INT8_C(  62), -INT8_C(  31),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(  64), -INT8_C(  45),  INT8_C(  58), -INT8_C( 102),  INT8_C(  51), -INT8_C(  94), -INT8_C(  53),  INT8_C(  13),
+        -INT8_C(  45), -INT8_C( 109), -INT8_C( 114), -INT8_C(   5),  INT8_C(  67), -INT8_C(  54), -INT8_C(  84), -INT8_C( 105),
+        -INT8_C(  57),  INT8_C(  47), -INT8_C( 109), -INT8_C(  71), -INT8_C(  11),  INT8_C(  18), -INT8_C(  36), -INT8_C(  31),
+         INT8_C( 102), -INT8_C(  71),  INT8_C(  95), -INT8_C(  26), -INT8_C(  91), -INT8_C(  42), -INT8_C(  92), -INT8_C(  42) },
+      UINT32_C(3715766480),
+      {  INT8_C(  64),  INT8_C(  81), -INT8_C(  52),  INT8_C(  65), -INT8_C(  79),  INT8_C(  70), -INT8_C( 126),  INT8_C( 114),
+         INT8_C(  29), -INT8_C( 108), -INT8_C( 114), -INT8_C(  29),  INT8_C(  43), -INT8_C( 124),  INT8_C(  88),  INT8_C(  72),
+         INT8_C(  20),  INT8_C(  18), -INT8_C(  61), -INT8_C(  46),  INT8_C(  68),  INT8_C(  62), -INT8_C(  73), -INT8_C( 108),
+         INT8_C(   7),  INT8_C(  17),  INT8_C(  24),  INT8_C(  21), -INT8_C(   3), -INT8_C(  78), -INT8_C(  33),  INT8_C(  73) },
+      { -INT8_C(  79), -INT8_C( 126),  INT8_C( 114), -INT8_C(  29),  INT8_C(  43),  INT8_C(  18), -INT8_C(  46),  INT8_C(  68),
+         INT8_C(  62), -INT8_C(  73),  INT8_C(   7),  INT8_C(  24),  INT8_C(  21), -INT8_C(   3), -INT8_C(  33),  INT8_C(  73),
+        -INT8_C(  57),  INT8_C(  47), -INT8_C( 109), -INT8_C(  71), -INT8_C(  11),  INT8_C(  18), -INT8_C(  36), -INT8_C(  31),
+         INT8_C( 102), -INT8_C(  71),  INT8_C(  95), -INT8_C(  26), -INT8_C(  91), -INT8_C(  42), -INT8_C(  92), -INT8_C(  42) } },
+    { {  INT8_C(   0), -INT8_C(  71), -INT8_C(  67),  INT8_C(  84),  INT8_C(  57),  INT8_C(  14), -INT8_C(   9),  INT8_C( 119),
+         INT8_C(  10), -INT8_C(  55),  INT8_C(   4),  INT8_C(  78),  INT8_C( 126), -INT8_C(  82), -INT8_C(  61), -INT8_C(  97),
+         INT8_C(  94),  INT8_C(  15), -INT8_C(  22),  INT8_C(  37),  INT8_C(  71), -INT8_C(  30),  INT8_C(   9),  INT8_C( 101),
+        -INT8_C( 113),  INT8_C(   6), -INT8_C(  33),  INT8_C(  59), -INT8_C(  31),  INT8_C(   6), -INT8_C(  27),  INT8_C(  66) },
+      UINT32_C(2458174340),
+      {  INT8_C(  45),      INT8_MIN, -INT8_C(  70),      INT8_MIN, -INT8_C( 127),  INT8_C(  40),  INT8_C(  12),  INT8_C( 112),
+        -INT8_C( 115), -INT8_C(  95),  INT8_C(  92), -INT8_C(   9),  INT8_C( 118), -INT8_C(  37),  INT8_C( 109),  INT8_C( 114),
+         INT8_C(  87),  INT8_C(   9),  INT8_C(  34),  INT8_C(  75), -INT8_C(   5),  INT8_C(  32),  INT8_C( 109), -INT8_C(  51),
+        -INT8_C(  25), -INT8_C(  64), -INT8_C(  46), -INT8_C( 110),  INT8_C(  87),  INT8_C(  83), -INT8_C(  35), -INT8_C(  29) },
+      { -INT8_C(  70),  INT8_C( 112), -INT8_C( 115), -INT8_C(  95),  INT8_C( 109),  INT8_C( 114),  INT8_C(  34), -INT8_C(  51),
+        -INT8_C(  64),  INT8_C(  87), -INT8_C(  29),  INT8_C(  78),  INT8_C( 126), -INT8_C(  82), -INT8_C(  61), -INT8_C(  97),
+         INT8_C(  94),  INT8_C(  15), -INT8_C(  22),  INT8_C(  37),  INT8_C(  71), -INT8_C(  30),  INT8_C(   9),  INT8_C( 101),
+        -INT8_C( 113),  INT8_C(   6), -INT8_C(  33),  INT8_C(  59), -INT8_C(  31),  INT8_C(   6), -INT8_C(  27),  INT8_C(  66) } },
+    { { -INT8_C(  99),  INT8_C(  61), -INT8_C(  78), -INT8_C( 110), -INT8_C(  57),  INT8_C( 107),  INT8_C(   3),  INT8_C(   2),
+         INT8_C( 105),  INT8_C(  62), -INT8_C(  71), -INT8_C(  99), -INT8_C( 115),  INT8_C( 115), -INT8_C(  11), -INT8_C(  77),
+        -INT8_C( 113), -INT8_C(  46), -INT8_C(  96), -INT8_C(  46),  INT8_C(  50), -INT8_C(  63), -INT8_C(  81),  INT8_C(  48),
+        -INT8_C(  67),  INT8_C(  62),  INT8_C(  62),  INT8_C(  90), -INT8_C(   5), -INT8_C( 101),  INT8_C(  39),  INT8_C(  18) },
+      UINT32_C(4160725499),
+      {  INT8_C(  99),  INT8_C(  18),  INT8_C(  89),  INT8_C( 111), -INT8_C(  20), -INT8_C( 123),  INT8_C(  97),  INT8_C( 115),
+         INT8_C(   6),  INT8_C( 118), -INT8_C(  48),  INT8_C(   8), -INT8_C(  98), -INT8_C(  61),  INT8_C(  56),  INT8_C(  59),
+        -INT8_C(  79),  INT8_C(  20), -INT8_C(  91),  INT8_C( 105),  INT8_C(  87),  INT8_C(  15),  INT8_C(  73),  INT8_C( 119),
+         INT8_C(  75),  INT8_C( 117),  INT8_C(  54), -INT8_C(  87), -INT8_C(  68), -INT8_C( 105),  INT8_C(  76), -INT8_C(  88) },
+      {  INT8_C(  99),  INT8_C(  18),  INT8_C( 111), -INT8_C(  20), -INT8_C( 123),  INT8_C(  97),  INT8_C( 115),  INT8_C(   6),
+        -INT8_C(  61),  INT8_C(  59), -INT8_C(  79),  INT8_C(  20), -INT8_C(  91),  INT8_C( 105),  INT8_C(  87),  INT8_C(  15),
+         INT8_C(  73),  INT8_C( 119),  INT8_C(  75),  INT8_C( 117),  INT8_C(  54), -INT8_C(  68), -INT8_C( 105),  INT8_C(  76),
+        -INT8_C(  88),  INT8_C(  62),  INT8_C(  62),  INT8_C(  90), -INT8_C(   5), -INT8_C( 101),  INT8_C(  39),  INT8_C(  18) } },
+    { { -INT8_C(  52),  INT8_C(  88), -INT8_C(  78), -INT8_C(  11), -INT8_C(  53),  INT8_C(  99),  INT8_C(  23),  INT8_C(  31),
+         INT8_C(  60),  INT8_C(  68), -INT8_C(  19), -INT8_C( 123), -INT8_C( 127), -INT8_C(  42),  INT8_C( 119), -INT8_C(  56),
+        -INT8_C(  61), -INT8_C(  45), -INT8_C(  59), -INT8_C(  70), -INT8_C(  96), -INT8_C(  49), -INT8_C(  19),  INT8_C(  42),
+         INT8_C( 100), -INT8_C(  35), -INT8_C( 102),  INT8_C(  16), -INT8_C( 104),  INT8_C(  43), -INT8_C(  55),  INT8_C(  89) },
+      UINT32_C(3598092059),
+      { -INT8_C(  90), -INT8_C(  73), -INT8_C( 109),  INT8_C(  42),  INT8_C( 112),  INT8_C(  77), -INT8_C(  23), -INT8_C( 105),
+        -INT8_C(  37),  INT8_C( 112),  INT8_C( 125),  INT8_C(  26),  INT8_C(  29),  INT8_C(  85), -INT8_C(  22), -INT8_C(  91),
+         INT8_C(  86), -INT8_C(  48),  INT8_C( 106), -INT8_C(  36),  INT8_C(  36), -INT8_C(  98),  INT8_C(  85), -INT8_C( 108),
+        -INT8_C(   6), -INT8_C(  57),  INT8_C(  17), -INT8_C(   1), -INT8_C(  41),  INT8_C(  34), -INT8_C(  42),  INT8_C(   6) },
+      { -INT8_C(  90), -INT8_C(  73),  INT8_C(  42),  INT8_C( 112), -INT8_C(  37),  INT8_C( 112),  INT8_C( 125), -INT8_C(  91),
+        -INT8_C(  48),  INT8_C( 106),  INT8_C(  36), -INT8_C(  98),  INT8_C(  85), -INT8_C(  57),  INT8_C(  17), -INT8_C(  41),
+        -INT8_C(  42),  INT8_C(   6), -INT8_C(  59), -INT8_C(  70), -INT8_C(  96), -INT8_C(  49), -INT8_C(  19),  INT8_C(  42),
+         INT8_C( 100), -INT8_C(  35), -INT8_C( 102),  INT8_C(  16), -INT8_C( 104),  INT8_C(  43), -INT8_C(  55),  INT8_C(  89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    int8_t r[32];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm256_mask_compressstoreu_epi8(r, test_vec[i].k, a);
+    simde_assert_equal_vi8(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C( 22309), -INT16_C(  3420),  INT16_C( 27990), -INT16_C( 24561), -INT16_C( 17272), -INT16_C( 20233), -INT16_C(  2479), -INT16_C( 10544),
+        -INT16_C(   860),  INT16_C( 22427),  INT16_C( 32282),  INT16_C( 30912),  INT16_C( 15014), -INT16_C(  6757),  INT16_C( 15589), -INT16_C( 22663) },
+      UINT16_C(36761),
+      { -INT16_C(  9696), -INT16_C(  3236), -INT16_C(   285), -INT16_C( 15908), -INT16_C( 20990),  INT16_C( 23894),  INT16_C( 20542), -INT16_C(  1789),
+         INT16_C( 16300),  INT16_C( 21047),  INT16_C( 15222), -INT16_C( 16605),  INT16_C(    37),  INT16_C( 13435),  INT16_C( 28260),  INT16_C( 13367) },
+      { -INT16_C(  9696), -INT16_C( 15908), -INT16_C( 20990), -INT16_C(  1789),  INT16_C( 16300),  INT16_C( 21047),  INT16_C( 15222), -INT16_C( 16605),
+         INT16_C( 13367),  INT16_C( 22427),  INT16_C( 32282),  INT16_C( 30912),  INT16_C( 15014), -INT16_C(  6757),  INT16_C( 15589), -INT16_C( 22663) } },
+    { { -INT16_C( 12600),  INT16_C(  4916),  INT16_C( 17834), -INT16_C( 26915),  INT16_C(   162),  INT16_C( 17626),  INT16_C(  8568), -INT16_C( 19577),
+        -INT16_C(  9999),  INT16_C(  6910),  INT16_C( 16819), -INT16_C( 17428), -INT16_C( 14130), -INT16_C( 21764),  INT16_C(   604),  INT16_C( 31409) },
+      UINT16_C(  776),
+      { -INT16_C(  3162), -INT16_C( 20393), -INT16_C( 23937),  INT16_C( 13474),  INT16_C( 29284), -INT16_C(  6337),  INT16_C(  5340),  INT16_C( 22877),
+         INT16_C(  3697),  INT16_C(  7272),  INT16_C( 30101), -INT16_C( 28812), -INT16_C(  5316),  INT16_C(  9977),  INT16_C( 32306), -INT16_C(  7667) },
+      {  INT16_C( 13474),  INT16_C(  3697),  INT16_C(  7272), -INT16_C( 26915),  INT16_C(   162),  INT16_C( 17626),  INT16_C(  8568), -INT16_C( 19577),
+        -INT16_C(  9999),  INT16_C(  6910),  INT16_C( 16819), -INT16_C( 17428), -INT16_C( 14130), -INT16_C( 21764),  INT16_C(   604),  INT16_C( 31409) } },
+    { { -INT16_C( 22621), -INT16_C( 21922), -INT16_C( 30786), -INT16_C(  1027),  INT16_C( 26646),  INT16_C( 28491),  INT16_C( 31173),  INT16_C(  9093),
+         INT16_C(  8992), -INT16_C( 28202),  INT16_C( 22413),  INT16_C( 24684),  INT16_C( 13577),  INT16_C(  1026), -INT16_C( 15298),  INT16_C( 14383) },
+      UINT16_C( 8464),
+      { -INT16_C( 16591), -INT16_C( 16258),  INT16_C( 12031), -INT16_C( 20951), -INT16_C(  9666), -INT16_C( 20019), -INT16_C( 20633), -INT16_C(  9342),
+         INT16_C( 21044), -INT16_C( 12281),  INT16_C(  6447),  INT16_C(  8778),  INT16_C(  6026),  INT16_C(  5849), -INT16_C( 22505),  INT16_C( 26681) },
+      { -INT16_C(  9666),  INT16_C( 21044),  INT16_C(  5849), -INT16_C(  1027),  INT16_C( 26646),  INT16_C( 28491),  INT16_C( 31173),  INT16_C(  9093),
+         INT16_C(  8992), -INT16_C( 28202),  INT16_C( 22413),  INT16_C( 24684),  INT16_C( 13577),  INT16_C(  1026), -INT16_C( 15298),  INT16_C( 14383) } },
+    { { -INT16_C( 15362),  INT16_C(  8212), -INT16_C( 17102), -INT16_C( 12059),  INT16_C( 21432),  INT16_C( 25536), -INT16_C( 20661), -INT16_C( 13753),
+        -INT16_C( 26585), -INT16_C( 11740),  INT16_C(  7806), -INT16_C( 17844),  INT16_C( 24772), -INT16_C( 14401),  INT16_C( 28225), -INT16_C( 10627) },
+      UINT16_C(60883),
+      {  INT16_C(  3863),  INT16_C( 10704), -INT16_C( 19196),  INT16_C( 11054),  INT16_C( 22119), -INT16_C( 32619),  INT16_C( 31767),  INT16_C( 16805),
+        -INT16_C( 20567), -INT16_C(  5026), -INT16_C( 23678),  INT16_C( 12846),  INT16_C(  2257), -INT16_C(  8931),  INT16_C( 21371),  INT16_C( 10276) },
+      {  INT16_C(  3863),  INT16_C( 10704),  INT16_C( 22119),  INT16_C( 31767),  INT16_C( 16805), -INT16_C( 20567), -INT16_C( 23678),  INT16_C( 12846),
+        -INT16_C(  8931),  INT16_C( 21371),  INT16_C( 10276), -INT16_C( 17844),  INT16_C( 24772), -INT16_C( 14401),  INT16_C( 28225), -INT16_C( 10627) } },
+    { {  INT16_C( 27836), -INT16_C( 27312),  INT16_C(   952), -INT16_C( 24975),  INT16_C( 28286), -INT16_C( 18780), -INT16_C( 14740), -INT16_C(  6875),
+         INT16_C( 31421), -INT16_C( 32378), -INT16_C(  4762),  INT16_C( 17016), -INT16_C( 11950),  INT16_C( 29632),  INT16_C( 24920), -INT16_C(  9422) },
+      UINT16_C(28641),
+      {  INT16_C( 32048), -INT16_C(  5424), -INT16_C( 16977),  INT16_C( 15141), -INT16_C( 11204),  INT16_C( 23272), -INT16_C(  2457), -INT16_C( 20862),
+        -INT16_C( 32086),  INT16_C( 29331), -INT16_C( 16057),  INT16_C( 13440), -INT16_C( 20865), -INT16_C(  1160),  INT16_C(  4549),  INT16_C( 12839) },
+      {  INT16_C( 32048),  INT16_C( 23272), -INT16_C(  2457), -INT16_C( 20862), -INT16_C( 32086),  INT16_C( 29331), -INT16_C( 16057),  INT16_C( 13440),
+        -INT16_C(  1160),  INT16_C(  4549), -INT16_C(  4762),  INT16_C( 17016), -INT16_C( 11950),  INT16_C( 29632),  INT16_C( 24920), -INT16_C(  9422) } },
+    { { -INT16_C( 29194),  INT16_C( 28558),  INT16_C( 15753),  INT16_C( 26883),  INT16_C( 10012), -INT16_C( 13758), -INT16_C( 12574), -INT16_C( 26842),
+         INT16_C( 17953),  INT16_C( 14322), -INT16_C( 28508), -INT16_C( 22349),  INT16_C( 23038), -INT16_C(  3348),  INT16_C( 13204), -INT16_C( 28810) },
+      UINT16_C(61439),
+      { -INT16_C( 22050),  INT16_C(  8746), -INT16_C(  3429),  INT16_C( 15556), -INT16_C( 17812),  INT16_C(  8011), -INT16_C( 14801), -INT16_C( 25050),
+         INT16_C( 17261),  INT16_C( 11330), -INT16_C(  9654), -INT16_C(  8609), -INT16_C( 18969),  INT16_C( 11955), -INT16_C( 30782),  INT16_C( 25437) },
+      { -INT16_C( 22050),  INT16_C(  8746), -INT16_C(  3429),  INT16_C( 15556), -INT16_C( 17812),  INT16_C(  8011), -INT16_C( 14801), -INT16_C( 25050),
+         INT16_C( 17261),  INT16_C( 11330), -INT16_C(  9654), -INT16_C(  8609),  INT16_C( 11955), -INT16_C( 30782),  INT16_C( 25437), -INT16_C( 28810) } },
+    { { -INT16_C( 21834), -INT16_C(  6570), -INT16_C(  8004),  INT16_C( 16830),  INT16_C(  8570),  INT16_C( 28846), -INT16_C( 20894),  INT16_C(  6928),
+        -INT16_C( 26998),  INT16_C( 26464),  INT16_C( 31332),  INT16_C( 13774), -INT16_C( 21089),  INT16_C( 29059), -INT16_C( 19627),  INT16_C(  1536) },
+      UINT16_C(58841),
+      { -INT16_C( 24373),  INT16_C(  6282),  INT16_C( 12218), -INT16_C( 20275), -INT16_C( 10337),  INT16_C( 10360), -INT16_C(  6481), -INT16_C(  3470),
+        -INT16_C( 16879),  INT16_C( 27390),  INT16_C(  6906),  INT16_C( 25183), -INT16_C( 22879),  INT16_C(  9045), -INT16_C(  6051), -INT16_C( 21303) },
+      { -INT16_C( 24373), -INT16_C( 20275), -INT16_C( 10337), -INT16_C(  6481), -INT16_C(  3470), -INT16_C( 16879),  INT16_C(  6906),  INT16_C(  9045),
+        -INT16_C(  6051), -INT16_C( 21303),  INT16_C( 31332),  INT16_C( 13774), -INT16_C( 21089),  INT16_C( 29059), -INT16_C( 19627),  INT16_C(  1536) } },
+    { { -INT16_C( 28361), -INT16_C( 26132),  INT16_C(  5995),  INT16_C(  4673),  INT16_C(  5563),  INT16_C( 22123),  INT16_C( 19476), -INT16_C( 22671),
+         INT16_C( 21708), -INT16_C( 23424),  INT16_C( 21214), -INT16_C(   591),  INT16_C( 20147),  INT16_C( 11855),  INT16_C( 24596), -INT16_C(  2955) },
+      UINT16_C( 6079),
+      {  INT16_C( 32752), -INT16_C( 24507), -INT16_C( 26103),  INT16_C(  7513),  INT16_C( 21279),  INT16_C(  2677),  INT16_C(  5498),  INT16_C( 19646),
+         INT16_C(  5363),  INT16_C( 15613), -INT16_C( 30563),  INT16_C( 27008), -INT16_C( 26819),  INT16_C( 11233),  INT16_C( 31645),  INT16_C( 16738) },
+      {  INT16_C( 32752), -INT16_C( 24507), -INT16_C( 26103),  INT16_C(  7513),  INT16_C( 21279),  INT16_C(  2677),  INT16_C( 19646),  INT16_C(  5363),
+         INT16_C( 15613), -INT16_C( 30563), -INT16_C( 26819), -INT16_C(   591),  INT16_C( 20147),  INT16_C( 11855),  INT16_C( 24596), -INT16_C(  2955) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(24584),
+      {  INT16_C( 22172), -INT16_C( 19472),  INT16_C( 19902),  INT16_C( 31886), -INT16_C( 20043),  INT16_C( 12289),  INT16_C( 17849),  INT16_C(  2573),
+         INT16_C( 18404), -INT16_C( 14193),  INT16_C(  6654),  INT16_C( 27732), -INT16_C( 25941), -INT16_C( 26270),  INT16_C( 29499), -INT16_C( 15380) },
+      {  INT16_C( 31886), -INT16_C( 26270),  INT16_C( 29499),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(21857),
+      { -INT16_C( 22673), -INT16_C( 28376),  INT16_C( 25180),  INT16_C( 30084), -INT16_C(   173),  INT16_C( 11557), -INT16_C( 10389), -INT16_C( 19093),
+         INT16_C( 17238),  INT16_C( 27855), -INT16_C( 16504),  INT16_C( 25641), -INT16_C( 16303),  INT16_C(  3067), -INT16_C( 18377), -INT16_C(  8904) },
+      { -INT16_C( 22673),  INT16_C( 11557), -INT16_C( 10389),  INT16_C( 17238), -INT16_C( 16504), -INT16_C( 16303), -INT16_C( 18377),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(62634),
+      { -INT16_C( 20869), -INT16_C(  5319), -INT16_C( 27297), -INT16_C(  1706), -INT16_C( 19700), -INT16_C(  1000), -INT16_C( 17255), -INT16_C( 22144),
+         INT16_C(  1746), -INT16_C( 19349),  INT16_C( 25491),  INT16_C(  3676),  INT16_C( 29181), -INT16_C( 15992),  INT16_C( 13264),  INT16_C(  2791) },
+      { -INT16_C(  5319), -INT16_C(  1706), -INT16_C(  1000), -INT16_C( 22144),  INT16_C( 25491),  INT16_C( 29181), -INT16_C( 15992),  INT16_C( 13264),
+         INT16_C(  2791),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(10242),
+      { -INT16_C( 26545),  INT16_C( 25814), -INT16_C(  6638),  INT16_C(  8798),  INT16_C( 24262),  INT16_C( 15413), -INT16_C( 25031), -INT16_C( 23880),
+         INT16_C( 16879),  INT16_C( 20333),  INT16_C( 27820), -INT16_C(  5883), -INT16_C( 13112),  INT16_C( 26369),  INT16_C( 25198), -INT16_C( 18527) },
+      {  INT16_C( 25814), -INT16_C(  5883),  INT16_C( 26369),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(57323),
+      { -INT16_C( 25688), -INT16_C( 25877),  INT16_C( 28422),  INT16_C( 30785), -INT16_C( 23114),  INT16_C( 27732),  INT16_C( 27473), -INT16_C( 30852),
+        -INT16_C( 10493),  INT16_C( 15192),  INT16_C( 14856), -INT16_C( 24596), -INT16_C( 32152),  INT16_C(  9659),  INT16_C( 31649),  INT16_C( 30778) },
+      { -INT16_C( 25688), -INT16_C( 25877),  INT16_C( 30785),  INT16_C( 27732),  INT16_C( 27473), -INT16_C( 30852), -INT16_C( 10493),  INT16_C( 15192),
+         INT16_C( 14856), -INT16_C( 24596), -INT16_C( 32152),  INT16_C( 31649),  INT16_C( 30778),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(45723),
+      { -INT16_C( 20749),  INT16_C( 22670),  INT16_C( 14011), -INT16_C( 26775),  INT16_C( 11726), -INT16_C(  7126),  INT16_C(  6670), -INT16_C(  3112),
+         INT16_C(  9758), -INT16_C( 30900),  INT16_C(  6764),  INT16_C( 21833),  INT16_C(  5444),  INT16_C( 11658),  INT16_C( 31251),  INT16_C(  2101) },
+      { -INT16_C( 20749),  INT16_C( 22670), -INT16_C( 26775),  INT16_C( 11726), -INT16_C(  3112), -INT16_C( 30900),  INT16_C(  5444),  INT16_C( 11658),
+         INT16_C(  2101),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(62431),
+      { -INT16_C( 15146),  INT16_C( 17462),  INT16_C(  8192),  INT16_C(  2460), -INT16_C( 24985),  INT16_C( 24943),  INT16_C( 17666), -INT16_C( 23597),
+        -INT16_C( 29781),  INT16_C(  1271), -INT16_C( 20295), -INT16_C(  4177), -INT16_C( 10416),  INT16_C(  6886),  INT16_C( 26729),  INT16_C( 23254) },
+      { -INT16_C( 15146),  INT16_C( 17462),  INT16_C(  8192),  INT16_C(  2460), -INT16_C( 24985),  INT16_C( 17666), -INT16_C( 23597), -INT16_C( 29781),
+         INT16_C(  1271), -INT16_C( 10416),  INT16_C(  6886),  INT16_C( 26729),  INT16_C( 23254),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(50542),
+      {  INT16_C(  2460), -INT16_C( 27643), -INT16_C( 32220),  INT16_C( 28496), -INT16_C( 17496),  INT16_C( 10248), -INT16_C(  9656),  INT16_C( 21560),
+         INT16_C( 10389), -INT16_C( 16256),  INT16_C( 21435),  INT16_C(  3365),  INT16_C(  4871),  INT16_C(  5675),  INT16_C( 13043), -INT16_C( 21543) },
+      { -INT16_C( 27643), -INT16_C( 32220),  INT16_C( 28496),  INT16_C( 10248), -INT16_C(  9656),  INT16_C( 10389),  INT16_C( 21435),  INT16_C( 13043),
+        -INT16_C( 21543),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C( 15313), -INT16_C(  5918), -INT16_C(  7825), -INT16_C( 32585), -INT16_C( 19630), -INT16_C( 20825),  INT16_C( 31149), -INT16_C( 24590),
+         INT16_C( 29161), -INT16_C( 11365), -INT16_C( 26318),  INT16_C( 11023),  INT16_C( 18316),  INT16_C(  6033),  INT16_C(  2840), -INT16_C(  2192) },
+      UINT16_C( 1939),
+      { -INT16_C( 21691), -INT16_C(  3777), -INT16_C( 30398), -INT16_C( 13477), -INT16_C( 29023), -INT16_C( 11820),  INT16_C( 31944),  INT16_C( 22274),
+         INT16_C( 21477),  INT16_C( 15471),  INT16_C(  8353),  INT16_C(  7399), -INT16_C(  8057),  INT16_C( 23652), -INT16_C( 19291),  INT16_C( 27967) },
+      { -INT16_C( 21691), -INT16_C(  3777), -INT16_C( 29023),  INT16_C( 22274),  INT16_C( 21477),  INT16_C( 15471),  INT16_C(  8353), -INT16_C( 24590),
+         INT16_C( 29161), -INT16_C( 11365), -INT16_C( 26318),  INT16_C( 11023),  INT16_C( 18316),  INT16_C(  6033),  INT16_C(  2840), -INT16_C(  2192) } },
+    { { -INT16_C( 26175), -INT16_C(   813), -INT16_C( 16286), -INT16_C(  2297),  INT16_C(  9483), -INT16_C(  6187), -INT16_C(   710),  INT16_C(  5954),
+        -INT16_C( 12316),  INT16_C( 32294), -INT16_C( 18760), -INT16_C(  4432),  INT16_C( 31809), -INT16_C( 26040),  INT16_C( 15570), -INT16_C(  4440) },
+      UINT16_C(32607),
+      { -INT16_C( 23988), -INT16_C( 10413),  INT16_C(  5937), -INT16_C( 27225), -INT16_C( 32443),  INT16_C( 13583), -INT16_C( 21986),  INT16_C( 13912),
+        -INT16_C( 26696), -INT16_C(  6065),  INT16_C( 24033), -INT16_C(  1460), -INT16_C(  3217), -INT16_C( 20126),  INT16_C( 14323),  INT16_C(  6350) },
+      { -INT16_C( 23988), -INT16_C( 10413),  INT16_C(  5937), -INT16_C( 27225), -INT16_C( 32443), -INT16_C( 21986), -INT16_C( 26696), -INT16_C(  6065),
+         INT16_C( 24033), -INT16_C(  1460), -INT16_C(  3217), -INT16_C( 20126),  INT16_C( 14323), -INT16_C( 26040),  INT16_C( 15570), -INT16_C(  4440) } },
+    { { -INT16_C( 19748),  INT16_C(  1634),  INT16_C( 24932), -INT16_C( 16415), -INT16_C(   777),  INT16_C( 18775),  INT16_C(  2000), -INT16_C( 32295),
+         INT16_C( 16472), -INT16_C(  1169),  INT16_C( 26074), -INT16_C( 14153),  INT16_C( 30887), -INT16_C(  3467), -INT16_C(  6679), -INT16_C( 16401) },
+      UINT16_C(15876),
+      {  INT16_C( 30380),  INT16_C(  4112), -INT16_C(  3480), -INT16_C( 21022),  INT16_C( 12309),  INT16_C( 21842), -INT16_C( 26218), -INT16_C( 16956),
+        -INT16_C( 26020),  INT16_C( 27875),  INT16_C( 18315), -INT16_C(  1805), -INT16_C( 10480), -INT16_C( 24545),  INT16_C( 26313), -INT16_C(  5426) },
+      { -INT16_C(  3480),  INT16_C( 27875),  INT16_C( 18315), -INT16_C(  1805), -INT16_C( 10480), -INT16_C( 24545),  INT16_C(  2000), -INT16_C( 32295),
+         INT16_C( 16472), -INT16_C(  1169),  INT16_C( 26074), -INT16_C( 14153),  INT16_C( 30887), -INT16_C(  3467), -INT16_C(  6679), -INT16_C( 16401) } },
+    { { -INT16_C( 16199),  INT16_C( 28944), -INT16_C( 21816),  INT16_C( 12633),  INT16_C( 29675),  INT16_C( 21793), -INT16_C( 17757), -INT16_C( 30881),
+        -INT16_C( 14825),  INT16_C(  4381), -INT16_C( 15250), -INT16_C( 29610),  INT16_C(   737), -INT16_C( 14786),  INT16_C(  7080),  INT16_C( 26406) },
+      UINT16_C(31359),
+      { -INT16_C( 13906),  INT16_C( 19636),  INT16_C( 31613), -INT16_C( 29053), -INT16_C( 11852),  INT16_C( 31242), -INT16_C(  8241),  INT16_C( 31833),
+        -INT16_C(  4457),  INT16_C(  8790),  INT16_C( 12500), -INT16_C(  6355), -INT16_C( 25389),  INT16_C( 25581),  INT16_C( 27350),  INT16_C( 29284) },
+      { -INT16_C( 13906),  INT16_C( 19636),  INT16_C( 31613), -INT16_C( 29053), -INT16_C( 11852),  INT16_C( 31242), -INT16_C(  8241),  INT16_C(  8790),
+        -INT16_C(  6355), -INT16_C( 25389),  INT16_C( 25581),  INT16_C( 27350),  INT16_C(   737), -INT16_C( 14786),  INT16_C(  7080),  INT16_C( 26406) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    int16_t r[16];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm256_mask_compressstoreu_epi16(r, test_vec[i].k, a);
+    simde_assert_equal_vi16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(   971968697),  INT32_C(  1646251603),  INT32_C(   221817554),  INT32_C(   514309178),  INT32_C(   150530312), -INT32_C(   573793419),  INT32_C(  2115332239),  INT32_C(  1099084130) },
+      UINT8_C(130),
+      { -INT32_C(   522376256),  INT32_C(    20379410),  INT32_C(  1269882651),  INT32_C(   522214809),  INT32_C(  1388539975),  INT32_C(   772033605),  INT32_C(   947908658), -INT32_C(  1557914372) },
+      {  INT32_C(    20379410), -INT32_C(  1557914372),  INT32_C(   221817554),  INT32_C(   514309178),  INT32_C(   150530312), -INT32_C(   573793419),  INT32_C(  2115332239),  INT32_C(  1099084130) } },
+    { { -INT32_C(   322384855), -INT32_C(  1558000836),  INT32_C(  1405803619),  INT32_C(   472375636),  INT32_C(  1575864760), -INT32_C(  1941067758), -INT32_C(  1289518612), -INT32_C(   294180102) },
+      UINT8_C(  6),
+      {  INT32_C(  1904700275),  INT32_C(   391415153), -INT32_C(  1033072694), -INT32_C(  1947582034),  INT32_C(   252606535), -INT32_C(  1260265737), -INT32_C(  1267834232), -INT32_C(  2079332491) },
+      {  INT32_C(   391415153), -INT32_C(  1033072694),  INT32_C(  1405803619),  INT32_C(   472375636),  INT32_C(  1575864760), -INT32_C(  1941067758), -INT32_C(  1289518612), -INT32_C(   294180102) } },
+    { { -INT32_C(   426902264),  INT32_C(   630858865), -INT32_C(   671306722),  INT32_C(   122972059),  INT32_C(   264874010), -INT32_C(  1300142439),  INT32_C(   215080867), -INT32_C(  2034219002) },
+      UINT8_C(192),
+      { -INT32_C(  1987155746),  INT32_C(  1004859007),  INT32_C(  1164905176), -INT32_C(  1083435362), -INT32_C(  1860837918),  INT32_C(   738638049), -INT32_C(   139322719), -INT32_C(  1335167770) },
+      { -INT32_C(   139322719), -INT32_C(  1335167770), -INT32_C(   671306722),  INT32_C(   122972059),  INT32_C(   264874010), -INT32_C(  1300142439),  INT32_C(   215080867), -INT32_C(  2034219002) } },
+    { {  INT32_C(   502035185), -INT32_C(  1717490578), -INT32_C(   928154141),  INT32_C(  1599663187),  INT32_C(   708775153), -INT32_C(  1104528810), -INT32_C(  1643436728),  INT32_C(   413126563) },
+      UINT8_C(211),
+      { -INT32_C(   889518329),  INT32_C(   324210913),  INT32_C(  1875351464),  INT32_C(  1832946406), -INT32_C(   123704585),  INT32_C(   478881455),  INT32_C(   833002342),  INT32_C(   783071944) },
+      { -INT32_C(   889518329),  INT32_C(   324210913), -INT32_C(   123704585),  INT32_C(   833002342),  INT32_C(   783071944), -INT32_C(  1104528810), -INT32_C(  1643436728),  INT32_C(   413126563) } },
+    { { -INT32_C(  1804882070), -INT32_C(    84044711),  INT32_C(   482960684), -INT32_C(  1222603980),  INT32_C(  1002134448),  INT32_C(  2038769708),  INT32_C(   499447912),  INT32_C(  1151826551) },
+      UINT8_C(  4),
+      { -INT32_C(   908727017), -INT32_C(   290339143), -INT32_C(  1351975010),  INT32_C(  1949925811),  INT32_C(  2128170006),  INT32_C(   520874831), -INT32_C(   495619694), -INT32_C(  1773983181) },
+      { -INT32_C(  1351975010), -INT32_C(    84044711),  INT32_C(   482960684), -INT32_C(  1222603980),  INT32_C(  1002134448),  INT32_C(  2038769708),  INT32_C(   499447912),  INT32_C(  1151826551) } },
+    { {  INT32_C(   497497273),  INT32_C(  1039613632),  INT32_C(   207724907),  INT32_C(   257780783),  INT32_C(   874727842), -INT32_C(   309605690), -INT32_C(  1433028941), -INT32_C(   609516597) },
+      UINT8_C(163),
+      { -INT32_C(  1436837812),  INT32_C(  1668744318),  INT32_C(   911689471),  INT32_C(    73233554),  INT32_C(  2133658699),  INT32_C(  1541638289),  INT32_C(  2050688667), -INT32_C(   221691192) },
+      { -INT32_C(  1436837812),  INT32_C(  1668744318),  INT32_C(  1541638289), -INT32_C(   221691192),  INT32_C(   874727842), -INT32_C(   309605690), -INT32_C(  1433028941), -INT32_C(   609516597) } },
+    { {  INT32_C(  2026488438),  INT32_C(  1525923971), -INT32_C(   561083214),  INT32_C(  1225197273),  INT32_C(  2074253006), -INT32_C(   323287459),  INT32_C(   785023592),  INT32_C(   384440981) },
+      UINT8_C(190),
+      { -INT32_C(  1125975511), -INT32_C(   668190312), -INT32_C(    26837686), -INT32_C(   244353624), -INT32_C(  1251429919), -INT32_C(  1156114168),  INT32_C(  1667609821),  INT32_C(   592945357) },
+      { -INT32_C(   668190312), -INT32_C(    26837686), -INT32_C(   244353624), -INT32_C(  1251429919), -INT32_C(  1156114168),  INT32_C(   592945357),  INT32_C(   785023592),  INT32_C(   384440981) } },
+    { {  INT32_C(   890534807), -INT32_C(   597955198),  INT32_C(  2091857019),  INT32_C(  2117357943),  INT32_C(   526477863),  INT32_C(  2141028180), -INT32_C(   456981408), -INT32_C(  1313340102) },
+      UINT8_C(  3),
+      { -INT32_C(  1617894901),  INT32_C(   113496192),  INT32_C(  1751739170),  INT32_C(  2015803388),  INT32_C(  1240799632),  INT32_C(  1832385114), -INT32_C(   166619335),  INT32_C(  1984870745) },
+      { -INT32_C(  1617894901),  INT32_C(   113496192),  INT32_C(  2091857019),  INT32_C(  2117357943),  INT32_C(   526477863),  INT32_C(  2141028180), -INT32_C(   456981408), -INT32_C(  1313340102) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(129),
+      {  INT32_C(  1821795109), -INT32_C(    73514218), -INT32_C(  1287489213),  INT32_C(  1310969042), -INT32_C(   973222438),  INT32_C(   376060018), -INT32_C(  1110792804), -INT32_C(  1342649527) },
+      {  INT32_C(  1821795109), -INT32_C(  1342649527),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(205),
+      { -INT32_C(  1998099946), -INT32_C(  1785965473),  INT32_C(   182542677), -INT32_C(   230381459), -INT32_C(  1515104355),  INT32_C(   524203225),  INT32_C(   164054015),  INT32_C(  1452520854) },
+      { -INT32_C(  1998099946),  INT32_C(   182542677), -INT32_C(   230381459),  INT32_C(   164054015),  INT32_C(  1452520854),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(187),
+      { -INT32_C(  1613742527),  INT32_C(  1811320622),  INT32_C(   806637882), -INT32_C(   786266073), -INT32_C(   466890365),  INT32_C(  1171535792), -INT32_C(    79194971), -INT32_C(  1515796541) },
+      { -INT32_C(  1613742527),  INT32_C(  1811320622), -INT32_C(   786266073), -INT32_C(   466890365),  INT32_C(  1171535792), -INT32_C(  1515796541),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(195),
+      {  INT32_C(   410832161), -INT32_C(   621897099),  INT32_C(  1733958393), -INT32_C(   449197252),  INT32_C(  1484443125),  INT32_C(  1072677022), -INT32_C(   848321683),  INT32_C(   979402945) },
+      {  INT32_C(   410832161), -INT32_C(   621897099), -INT32_C(   848321683),  INT32_C(   979402945),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(215),
+      { -INT32_C(  1340404248),  INT32_C(   412342066), -INT32_C(   170557802),  INT32_C(   625231628), -INT32_C(   382195993),  INT32_C(   135393420),  INT32_C(  1633734844),  INT32_C(  2087048612) },
+      { -INT32_C(  1340404248),  INT32_C(   412342066), -INT32_C(   170557802), -INT32_C(   382195993),  INT32_C(  1633734844),  INT32_C(  2087048612),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(142),
+      { -INT32_C(   778201684), -INT32_C(   224205296),  INT32_C(  1099150357),  INT32_C(  2026185450),  INT32_C(   650409240), -INT32_C(   799377506),  INT32_C(  1414674542), -INT32_C(   352901553) },
+      { -INT32_C(   224205296),  INT32_C(  1099150357),  INT32_C(  2026185450), -INT32_C(   352901553),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(254),
+      { -INT32_C(   344705758),  INT32_C(  1876133419),  INT32_C(   955519669),  INT32_C(   221052489),  INT32_C(  1955928015),  INT32_C(   769474185),  INT32_C(  1908231148), -INT32_C(   140174895) },
+      {  INT32_C(  1876133419),  INT32_C(   955519669),  INT32_C(   221052489),  INT32_C(  1955928015),  INT32_C(   769474185),  INT32_C(  1908231148), -INT32_C(   140174895),  INT32_C(           0) } },
+    { UINT8_C( 62),
+      {  INT32_C(   870782528), -INT32_C(   743977001),  INT32_C(  2106785857),  INT32_C(   896818250), -INT32_C(   421395520), -INT32_C(  1677031402), -INT32_C(   853362510), -INT32_C(   564789617) },
+      { -INT32_C(   743977001),  INT32_C(  2106785857),  INT32_C(   896818250), -INT32_C(   421395520), -INT32_C(  1677031402),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(   846642797), -INT32_C(  1103992347), -INT32_C(  1470166643),  INT32_C(   689499552),  INT32_C(  1224891315), -INT32_C(  1389224318), -INT32_C(   201992040), -INT32_C(   177750936) },
+      UINT8_C(239),
+      { -INT32_C(  2028208649),  INT32_C(   286115369), -INT32_C(   603485956), -INT32_C(    49993505),  INT32_C(  1266908054), -INT32_C(  2105370196), -INT32_C(  1800484655), -INT32_C(   775946847) },
+      { -INT32_C(  2028208649),  INT32_C(   286115369), -INT32_C(   603485956), -INT32_C(    49993505), -INT32_C(  2105370196), -INT32_C(  1800484655), -INT32_C(   775946847), -INT32_C(   177750936) } },
+    { {  INT32_C(  1057009700), -INT32_C(  1104993114),  INT32_C(   119202231), -INT32_C(   719208744), -INT32_C(   758222467),  INT32_C(  1764453408),  INT32_C(  1391199830),  INT32_C(  1203245975) },
+      UINT8_C(173),
+      {  INT32_C(  1483397643),  INT32_C(   524895337),  INT32_C(   547014360), -INT32_C(   530038421), -INT32_C(  1146165077), -INT32_C(   346797517),  INT32_C(   839389482), -INT32_C(   548361492) },
+      {  INT32_C(  1483397643),  INT32_C(   547014360), -INT32_C(   530038421), -INT32_C(   346797517), -INT32_C(   548361492),  INT32_C(  1764453408),  INT32_C(  1391199830),  INT32_C(  1203245975) } },
+    { {  INT32_C(   980270268), -INT32_C(    40426275), -INT32_C(   871343248),  INT32_C(   100245219), -INT32_C(   540566991),  INT32_C(  1377890941), -INT32_C(   474633691), -INT32_C(  1828525267) },
+      UINT8_C( 75),
+      {  INT32_C(  1883336916),  INT32_C(  2147434449),  INT32_C(   190635445),  INT32_C(   999935319),  INT32_C(   435261147), -INT32_C(    96490524),  INT32_C(   609931481), -INT32_C(  1967088172) },
+      {  INT32_C(  1883336916),  INT32_C(  2147434449),  INT32_C(   999935319),  INT32_C(   609931481), -INT32_C(   540566991),  INT32_C(  1377890941), -INT32_C(   474633691), -INT32_C(  1828525267) } },
+    { {  INT32_C(  1129409511), -INT32_C(    89772080), -INT32_C(   918285955),  INT32_C(  1208856620), -INT32_C(   899993264), -INT32_C(   462015317), -INT32_C(  2139387504), -INT32_C(  1989581586) },
+      UINT8_C(101),
+      {  INT32_C(  1625302221),  INT32_C(  1894027822), -INT32_C(   390707467), -INT32_C(   672965764), -INT32_C(    44738351), -INT32_C(   309318664),  INT32_C(   471234159), -INT32_C(   482673548) },
+      {  INT32_C(  1625302221), -INT32_C(   390707467), -INT32_C(   309318664),  INT32_C(   471234159), -INT32_C(   899993264), -INT32_C(   462015317), -INT32_C(  2139387504), -INT32_C(  1989581586) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    int32_t r[8];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm256_mask_compressstoreu_epi32(r, test_vec[i].k, a);
+    simde_assert_equal_vi32(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 3497861296282894216),  INT64_C( 6661366647491915502), -INT64_C( 3390830834942220903),  INT64_C( 5435189698626967840) },
+      UINT8_C(127),
+      {  INT64_C( 8422174537432922948), -INT64_C( 5898447500327204071), -INT64_C( 7217293173600650881),  INT64_C(  153314513516139273) },
+      {  INT64_C( 8422174537432922948), -INT64_C( 5898447500327204071), -INT64_C( 7217293173600650881),  INT64_C(  153314513516139273) } },
+    { { -INT64_C( 4300550979153328716),  INT64_C( 6850901458476618359),  INT64_C( 3094523498473856074), -INT64_C(  804431749760757029) },
+      UINT8_C(252),
+      { -INT64_C( 8182328208617320918),  INT64_C( 4506806852037405049),  INT64_C( 2247631340403335868),  INT64_C( 4644775935268752971) },
+      {  INT64_C( 2247631340403335868),  INT64_C( 4644775935268752971),  INT64_C( 3094523498473856074), -INT64_C(  804431749760757029) } },
+    { {  INT64_C( 2386736987839671226), -INT64_C( 1599224173308550022), -INT64_C( 4981545474850203696),  INT64_C( 6319509037869857331) },
+      UINT8_C(253),
+      {  INT64_C( 5616292809142288887),  INT64_C( 4626233508127276512),  INT64_C( 6142424195398836818),  INT64_C( 6297930925006431781) },
+      {  INT64_C( 5616292809142288887),  INT64_C( 6142424195398836818),  INT64_C( 6297930925006431781),  INT64_C( 6319509037869857331) } },
+    { { -INT64_C( 4279684434679118892),  INT64_C( 8676524066490883919),  INT64_C( 8792672198731612544), -INT64_C( 1627082142595309443) },
+      UINT8_C(254),
+      {  INT64_C( 8133864291736482689),  INT64_C( 5011510860575644148),  INT64_C( 1868124588205226535),  INT64_C( 3878652206147471725) },
+      {  INT64_C( 5011510860575644148),  INT64_C( 1868124588205226535),  INT64_C( 3878652206147471725), -INT64_C( 1627082142595309443) } },
+    { {  INT64_C( 8691969693144435066),  INT64_C( 4329768101376250797), -INT64_C( 7700452617883477565),  INT64_C( 6203981023559342472) },
+      UINT8_C( 15),
+      {  INT64_C( 6282494378020182445), -INT64_C( 8780246871526267056),  INT64_C( 2409683228976638435), -INT64_C(  901032090744447150) },
+      {  INT64_C( 6282494378020182445), -INT64_C( 8780246871526267056),  INT64_C( 2409683228976638435), -INT64_C(  901032090744447150) } },
+    { { -INT64_C( 7925666428828297914), -INT64_C( 3607073006944344040),  INT64_C( 1034516103392296678), -INT64_C(  310220593371527967) },
+      UINT8_C(122),
+      { -INT64_C( 4457757064436205075),  INT64_C( 8875885722404586374),  INT64_C( 5395220562836172657), -INT64_C( 9143153930399235487) },
+      {  INT64_C( 8875885722404586374), -INT64_C( 9143153930399235487),  INT64_C( 1034516103392296678), -INT64_C(  310220593371527967) } },
+    { {  INT64_C(  582942175122762917), -INT64_C( 2316322547564585954), -INT64_C( 8257723119418247393), -INT64_C( 5319351090514067931) },
+      UINT8_C(160),
+      { -INT64_C( 3724159635140659665),  INT64_C( 2717222312874392855), -INT64_C( 2981942368557966672),  INT64_C( 2167902505257186286) },
+      {  INT64_C(  582942175122762917), -INT64_C( 2316322547564585954), -INT64_C( 8257723119418247393), -INT64_C( 5319351090514067931) } },
+    { { -INT64_C( 7539276158393705534),  INT64_C( 5210574729484217224),  INT64_C( 1584394671396078898), -INT64_C( 1250840641236370650) },
+      UINT8_C(126),
+      { -INT64_C( 8322696540172495755), -INT64_C( 7077921339644085959), -INT64_C( 7319089524407948618), -INT64_C( 1453662493757939016) },
+      { -INT64_C( 7077921339644085959), -INT64_C( 7319089524407948618), -INT64_C( 1453662493757939016), -INT64_C( 1250840641236370650) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(123),
+      { -INT64_C(  766188710446869659), -INT64_C( 7936023659283804398), -INT64_C( 3476274946123532593),  INT64_C( 7547388922375174162) },
+      { -INT64_C(  766188710446869659), -INT64_C( 7936023659283804398),  INT64_C( 7547388922375174162),  INT64_C(                   0) } },
+    { UINT8_C(136),
+      {  INT64_C(  864294724091689626),  INT64_C( 2397855582403396931), -INT64_C( 5180752445194637787), -INT64_C( 5681760075200794854) },
+      { -INT64_C( 5681760075200794854),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(109),
+      { -INT64_C( 4535307545192400727),  INT64_C( 1497431278002131540),  INT64_C( 8467041404898296650), -INT64_C( 1411739841611797097) },
+      { -INT64_C( 4535307545192400727),  INT64_C( 8467041404898296650), -INT64_C( 1411739841611797097),  INT64_C(                   0) } },
+    { UINT8_C(208),
+      {  INT64_C( 4663735850549269100), -INT64_C( 7133133436211902969),  INT64_C( 4432281064666993128),  INT64_C( 5663647356108783767) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 56),
+      {  INT64_C(  626883739038353898),  INT64_C(  510649324656820523), -INT64_C( 5716655320256841787),  INT64_C( 1425239166518077824) },
+      {  INT64_C( 1425239166518077824),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(204),
+      {  INT64_C( 3497450349111891897), -INT64_C( 3161319637636313461),  INT64_C( 2141508354383002169),  INT64_C( 3089799356138597849) },
+      {  INT64_C( 2141508354383002169),  INT64_C( 3089799356138597849),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(244),
+      {  INT64_C( 2110371257060009059), -INT64_C(  248504639848639250), -INT64_C( 3572207014695265308),  INT64_C( 4419024026042081888) },
+      { -INT64_C( 3572207014695265308),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(136),
+      { -INT64_C( 6491663760136113179),  INT64_C(  141389090992211272),  INT64_C( 6536075771945381843),  INT64_C( 1178851395724718225) },
+      {  INT64_C( 1178851395724718225),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 6967289965073864580), -INT64_C( 3423096124423142523),  INT64_C( 7868390730981393405),  INT64_C( 3673548907451230986) },
+      UINT8_C(178),
+      {  INT64_C( 7646219685279681536),  INT64_C( 3283094930974973244), -INT64_C( 1151250194410800430), -INT64_C( 5088235347589673896) },
+      {  INT64_C( 3283094930974973244), -INT64_C( 3423096124423142523),  INT64_C( 7868390730981393405),  INT64_C( 3673548907451230986) } },
+    { { -INT64_C( 9080247432964728683),  INT64_C( 1395063685736776783), -INT64_C( 4270079918532098373), -INT64_C(  495574249459130627) },
+      UINT8_C(134),
+      {  INT64_C( 9061437775573635001),  INT64_C( 2227995013256397981), -INT64_C( 7501104532738607095),  INT64_C( 7375953582960855124) },
+      {  INT64_C( 2227995013256397981), -INT64_C( 7501104532738607095), -INT64_C( 4270079918532098373), -INT64_C(  495574249459130627) } },
+    { {  INT64_C(   53223304955020441), -INT64_C( 8451655820520327934), -INT64_C( 5677502532426053673), -INT64_C( 5148989125196902132) },
+      UINT8_C( 66),
+      {  INT64_C( 6088495418854320989),  INT64_C( 4139637933053665143),  INT64_C( 4078968606452548511), -INT64_C( 4558945193518825796) },
+      {  INT64_C( 4139637933053665143), -INT64_C( 8451655820520327934), -INT64_C( 5677502532426053673), -INT64_C( 5148989125196902132) } },
+    { { -INT64_C( 5569180858768310965), -INT64_C( 2155085673213816557),  INT64_C( 3309280360059083642),  INT64_C( 6169120701716887448) },
+      UINT8_C(  4),
+      { -INT64_C( 6772651607378505280), -INT64_C( 9089998075848347140),  INT64_C(  156669354147630250),  INT64_C( 6639544673443371787) },
+      {  INT64_C(  156669354147630250), -INT64_C( 2155085673213816557),  INT64_C( 3309280360059083642),  INT64_C( 6169120701716887448) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    int64_t r[4];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm256_mask_compressstoreu_epi64(r, test_vec[i].k, a);
+    simde_assert_equal_vi64(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -117.53), SIMDE_FLOAT32_C(  -519.49), SIMDE_FLOAT32_C(   123.65), SIMDE_FLOAT32_C(  -143.77),
+        SIMDE_FLOAT32_C(  -983.48), SIMDE_FLOAT32_C(  -157.21), SIMDE_FLOAT32_C(   -81.47), SIMDE_FLOAT32_C(   604.72) },
+      UINT8_C(155),
+      { SIMDE_FLOAT32_C(  -664.89), SIMDE_FLOAT32_C(  -963.19), SIMDE_FLOAT32_C(   494.49), SIMDE_FLOAT32_C(  -448.51),
+        SIMDE_FLOAT32_C(    77.98), SIMDE_FLOAT32_C(  -164.73), SIMDE_FLOAT32_C(  -844.17), SIMDE_FLOAT32_C(  -541.55) },
+      { SIMDE_FLOAT32_C(  -664.89), SIMDE_FLOAT32_C(  -963.19), SIMDE_FLOAT32_C(  -448.51), SIMDE_FLOAT32_C(    77.98),
+        SIMDE_FLOAT32_C(  -541.55), SIMDE_FLOAT32_C(  -157.21), SIMDE_FLOAT32_C(   -81.47), SIMDE_FLOAT32_C(   604.72) } },
+    { { SIMDE_FLOAT32_C(  -704.95), SIMDE_FLOAT32_C(  -211.82), SIMDE_FLOAT32_C(   152.28), SIMDE_FLOAT32_C(  -171.69),
+        SIMDE_FLOAT32_C(  -421.97), SIMDE_FLOAT32_C(   967.49), SIMDE_FLOAT32_C(  -354.59), SIMDE_FLOAT32_C(  -748.95) },
+      UINT8_C(199),
+      { SIMDE_FLOAT32_C(  -671.57), SIMDE_FLOAT32_C(   872.38), SIMDE_FLOAT32_C(  -167.64), SIMDE_FLOAT32_C(   930.42),
+        SIMDE_FLOAT32_C(   -68.98), SIMDE_FLOAT32_C(  -824.02), SIMDE_FLOAT32_C(   522.29), SIMDE_FLOAT32_C(   666.16) },
+      { SIMDE_FLOAT32_C(  -671.57), SIMDE_FLOAT32_C(   872.38), SIMDE_FLOAT32_C(  -167.64), SIMDE_FLOAT32_C(   522.29),
+        SIMDE_FLOAT32_C(   666.16), SIMDE_FLOAT32_C(   967.49), SIMDE_FLOAT32_C(  -354.59), SIMDE_FLOAT32_C(  -748.95) } },
+    { { SIMDE_FLOAT32_C(  -872.35), SIMDE_FLOAT32_C(    59.39), SIMDE_FLOAT32_C(   427.64), SIMDE_FLOAT32_C(  -711.78),
+        SIMDE_FLOAT32_C(   275.18), SIMDE_FLOAT32_C(  -270.27), SIMDE_FLOAT32_C(  -531.40), SIMDE_FLOAT32_C(   649.71) },
+      UINT8_C(168),
+      { SIMDE_FLOAT32_C(   373.55), SIMDE_FLOAT32_C(  -365.22), SIMDE_FLOAT32_C(  -897.02), SIMDE_FLOAT32_C(  -960.01),
+        SIMDE_FLOAT32_C(   605.92), SIMDE_FLOAT32_C(  -761.46), SIMDE_FLOAT32_C(  -900.12), SIMDE_FLOAT32_C(  -455.06) },
+      { SIMDE_FLOAT32_C(  -960.01), SIMDE_FLOAT32_C(  -761.46), SIMDE_FLOAT32_C(  -455.06), SIMDE_FLOAT32_C(  -711.78),
+        SIMDE_FLOAT32_C(   275.18), SIMDE_FLOAT32_C(  -270.27), SIMDE_FLOAT32_C(  -531.40), SIMDE_FLOAT32_C(   649.71) } },
+    { { SIMDE_FLOAT32_C(   735.36), SIMDE_FLOAT32_C(   741.70), SIMDE_FLOAT32_C(  -939.44), SIMDE_FLOAT32_C(   786.20),
+        SIMDE_FLOAT32_C(  -219.04), SIMDE_FLOAT32_C(  -174.19), SIMDE_FLOAT32_C(   957.52), SIMDE_FLOAT32_C(   414.24) },
+      UINT8_C(254),
+      { SIMDE_FLOAT32_C(   306.46), SIMDE_FLOAT32_C(   279.82), SIMDE_FLOAT32_C(  -767.76), SIMDE_FLOAT32_C(   379.54),
+        SIMDE_FLOAT32_C(   854.52), SIMDE_FLOAT32_C(  -994.60), SIMDE_FLOAT32_C(    33.92), SIMDE_FLOAT32_C(   606.21) },
+      { SIMDE_FLOAT32_C(   279.82), SIMDE_FLOAT32_C(  -767.76), SIMDE_FLOAT32_C(   379.54), SIMDE_FLOAT32_C(   854.52),
+        SIMDE_FLOAT32_C(  -994.60), SIMDE_FLOAT32_C(    33.92), SIMDE_FLOAT32_C(   606.21), SIMDE_FLOAT32_C(   414.24) } },
+    { { SIMDE_FLOAT32_C(   -84.52), SIMDE_FLOAT32_C(   909.61), SIMDE_FLOAT32_C(  -158.93), SIMDE_FLOAT32_C(   916.85),
+        SIMDE_FLOAT32_C(  -876.56), SIMDE_FLOAT32_C(    50.98), SIMDE_FLOAT32_C(   661.75), SIMDE_FLOAT32_C(  -994.36) },
+      UINT8_C(104),
+      { SIMDE_FLOAT32_C(   898.04), SIMDE_FLOAT32_C(   121.61), SIMDE_FLOAT32_C(   256.35), SIMDE_FLOAT32_C(  -653.53),
+        SIMDE_FLOAT32_C(  -838.40), SIMDE_FLOAT32_C(  -310.35), SIMDE_FLOAT32_C(  -230.27), SIMDE_FLOAT32_C(  -752.25) },
+      { SIMDE_FLOAT32_C(  -653.53), SIMDE_FLOAT32_C(  -310.35), SIMDE_FLOAT32_C(  -230.27), SIMDE_FLOAT32_C(   916.85),
+        SIMDE_FLOAT32_C(  -876.56), SIMDE_FLOAT32_C(    50.98), SIMDE_FLOAT32_C(   661.75), SIMDE_FLOAT32_C(  -994.36) } },
+    { { SIMDE_FLOAT32_C(   515.68), SIMDE_FLOAT32_C(   631.25), SIMDE_FLOAT32_C(  -668.54), SIMDE_FLOAT32_C(   316.49),
+        SIMDE_FLOAT32_C(   -11.84), SIMDE_FLOAT32_C(   459.19), SIMDE_FLOAT32_C(  -114.97), SIMDE_FLOAT32_C(   952.35) },
+      UINT8_C(219),
+      { SIMDE_FLOAT32_C(    67.25), SIMDE_FLOAT32_C(   153.62), SIMDE_FLOAT32_C(  -329.58), SIMDE_FLOAT32_C(   811.44),
+        SIMDE_FLOAT32_C(   966.37), SIMDE_FLOAT32_C(   390.84), SIMDE_FLOAT32_C(  -792.20), SIMDE_FLOAT32_C(  -312.98) },
+      { SIMDE_FLOAT32_C(    67.25), SIMDE_FLOAT32_C(   153.62), SIMDE_FLOAT32_C(   811.44), SIMDE_FLOAT32_C(   966.37),
+        SIMDE_FLOAT32_C(  -792.20), SIMDE_FLOAT32_C(  -312.98), SIMDE_FLOAT32_C(  -114.97), SIMDE_FLOAT32_C(   952.35) } },
+    { { SIMDE_FLOAT32_C(   538.05), SIMDE_FLOAT32_C(  -486.03), SIMDE_FLOAT32_C(  -659.41), SIMDE_FLOAT32_C(   266.75),
+        SIMDE_FLOAT32_C(   751.85), SIMDE_FLOAT32_C(   -67.41), SIMDE_FLOAT32_C(   304.29), SIMDE_FLOAT32_C(   167.83) },
+      UINT8_C(250),
+      { SIMDE_FLOAT32_C(   888.18), SIMDE_FLOAT32_C(   486.01), SIMDE_FLOAT32_C(   515.06), SIMDE_FLOAT32_C(    15.20),
+        SIMDE_FLOAT32_C(   803.66), SIMDE_FLOAT32_C(  -179.53), SIMDE_FLOAT32_C(   -28.58), SIMDE_FLOAT32_C(   -39.74) },
+      { SIMDE_FLOAT32_C(   486.01), SIMDE_FLOAT32_C(    15.20), SIMDE_FLOAT32_C(   803.66), SIMDE_FLOAT32_C(  -179.53),
+        SIMDE_FLOAT32_C(   -28.58), SIMDE_FLOAT32_C(   -39.74), SIMDE_FLOAT32_C(   304.29), SIMDE_FLOAT32_C(   167.83) } },
+    { { SIMDE_FLOAT32_C(  -821.14), SIMDE_FLOAT32_C(   494.35), SIMDE_FLOAT32_C(  -641.16), SIMDE_FLOAT32_C(   849.87),
+        SIMDE_FLOAT32_C(  -183.40), SIMDE_FLOAT32_C(  -429.70), SIMDE_FLOAT32_C(  -595.51), SIMDE_FLOAT32_C(  -945.07) },
+      UINT8_C( 30),
+      { SIMDE_FLOAT32_C(  -772.51), SIMDE_FLOAT32_C(  -218.94), SIMDE_FLOAT32_C(  -309.67), SIMDE_FLOAT32_C(   869.11),
+        SIMDE_FLOAT32_C(  -127.99), SIMDE_FLOAT32_C(   500.51), SIMDE_FLOAT32_C(   148.81), SIMDE_FLOAT32_C(  -754.85) },
+      { SIMDE_FLOAT32_C(  -218.94), SIMDE_FLOAT32_C(  -309.67), SIMDE_FLOAT32_C(   869.11), SIMDE_FLOAT32_C(  -127.99),
+        SIMDE_FLOAT32_C(  -183.40), SIMDE_FLOAT32_C(  -429.70), SIMDE_FLOAT32_C(  -595.51), SIMDE_FLOAT32_C(  -945.07) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_compress_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(219),
+      { SIMDE_FLOAT32_C(  -490.74), SIMDE_FLOAT32_C(  -635.06), SIMDE_FLOAT32_C(    69.81), SIMDE_FLOAT32_C(  -863.54),
+        SIMDE_FLOAT32_C(  -233.93), SIMDE_FLOAT32_C(   686.46), SIMDE_FLOAT32_C(   306.52), SIMDE_FLOAT32_C(   831.91) },
+      { SIMDE_FLOAT32_C(  -490.74), SIMDE_FLOAT32_C(  -635.06), SIMDE_FLOAT32_C(  -863.54), SIMDE_FLOAT32_C(  -233.93),
+        SIMDE_FLOAT32_C(   306.52), SIMDE_FLOAT32_C(   831.91), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 95),
+      { SIMDE_FLOAT32_C(   282.32), SIMDE_FLOAT32_C(   973.67), SIMDE_FLOAT32_C(  -724.10), SIMDE_FLOAT32_C(  -625.62),
+        SIMDE_FLOAT32_C(   -22.83), SIMDE_FLOAT32_C(  -750.26), SIMDE_FLOAT32_C(  -361.90), SIMDE_FLOAT32_C(  -785.48) },
+      { SIMDE_FLOAT32_C(   282.32), SIMDE_FLOAT32_C(   973.67), SIMDE_FLOAT32_C(  -724.10), SIMDE_FLOAT32_C(  -625.62),
+        SIMDE_FLOAT32_C(   -22.83), SIMDE_FLOAT32_C(  -361.90), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(105),
+      { SIMDE_FLOAT32_C(  -792.14), SIMDE_FLOAT32_C(   803.97), SIMDE_FLOAT32_C(  -119.40), SIMDE_FLOAT32_C(   604.45),
+        SIMDE_FLOAT32_C(   297.49), SIMDE_FLOAT32_C(  -531.79), SIMDE_FLOAT32_C(   327.06), SIMDE_FLOAT32_C(  -351.86) },
+      { SIMDE_FLOAT32_C(  -792.14), SIMDE_FLOAT32_C(   604.45), SIMDE_FLOAT32_C(  -531.79), SIMDE_FLOAT32_C(   327.06),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 13),
+      { SIMDE_FLOAT32_C(   132.83), SIMDE_FLOAT32_C(   868.31), SIMDE_FLOAT32_C(  -224.04), SIMDE_FLOAT32_C(   325.36),
+        SIMDE_FLOAT32_C(   990.92), SIMDE_FLOAT32_C(  -749.10), SIMDE_FLOAT32_C(  -268.53), SIMDE_FLOAT32_C(   456.42) },
+      { SIMDE_FLOAT32_C(   132.83), SIMDE_FLOAT32_C(  -224.04), SIMDE_FLOAT32_C(   325.36), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 33),
+      { SIMDE_FLOAT32_C(  -395.00), SIMDE_FLOAT32_C(  -167.67), SIMDE_FLOAT32_C(  -566.36), SIMDE_FLOAT32_C(   469.77),
+        SIMDE_FLOAT32_C(     0.07), SIMDE_FLOAT32_C(   602.82), SIMDE_FLOAT32_C(   960.64), SIMDE_FLOAT32_C(   215.85) },
+      { SIMDE_FLOAT32_C(  -395.00), SIMDE_FLOAT32_C(   602.82), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(217),
+      { SIMDE_FLOAT32_C(  -805.39), SIMDE_FLOAT32_C(   638.09), SIMDE_FLOAT32_C(   810.46), SIMDE_FLOAT32_C(   227.12),
+        SIMDE_FLOAT32_C(  -230.36), SIMDE_FLOAT32_C(   545.82), SIMDE_FLOAT32_C(   611.57), SIMDE_FLOAT32_C(   921.64) },
+      { SIMDE_FLOAT32_C(  -805.39), SIMDE_FLOAT32_C(   227.12), SIMDE_FLOAT32_C(  -230.36), SIMDE_FLOAT32_C(   611.57),
+        SIMDE_FLOAT32_C(   921.64), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 92),
+      { SIMDE_FLOAT32_C(  -102.24), SIMDE_FLOAT32_C(  -762.21), SIMDE_FLOAT32_C(  -136.59), SIMDE_FLOAT32_C(  -834.71),
+        SIMDE_FLOAT32_C(  -394.86), SIMDE_FLOAT32_C(   572.57), SIMDE_FLOAT32_C(   656.41), SIMDE_FLOAT32_C(   718.11) },
+      { SIMDE_FLOAT32_C(  -136.59), SIMDE_FLOAT32_C(  -834.71), SIMDE_FLOAT32_C(  -394.86), SIMDE_FLOAT32_C(   656.41),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 60),
+      { SIMDE_FLOAT32_C(  -585.40), SIMDE_FLOAT32_C(   226.15), SIMDE_FLOAT32_C(   705.39), SIMDE_FLOAT32_C(   791.58),
+        SIMDE_FLOAT32_C(  -520.24), SIMDE_FLOAT32_C(   -70.91), SIMDE_FLOAT32_C(  -613.79), SIMDE_FLOAT32_C(  -231.56) },
+      { SIMDE_FLOAT32_C(   705.39), SIMDE_FLOAT32_C(   791.58), SIMDE_FLOAT32_C(  -520.24), SIMDE_FLOAT32_C(   -70.91),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_compress_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   571.08), SIMDE_FLOAT32_C(   718.44), SIMDE_FLOAT32_C(  -951.54), SIMDE_FLOAT32_C(  -923.84),
+        SIMDE_FLOAT32_C(   836.59), SIMDE_FLOAT32_C(   -55.83), SIMDE_FLOAT32_C(  -911.43), SIMDE_FLOAT32_C(   367.25) },
+      UINT8_C(137),
+      { SIMDE_FLOAT32_C(   -16.05), SIMDE_FLOAT32_C(  -269.78), SIMDE_FLOAT32_C(   461.79), SIMDE_FLOAT32_C(   873.51),
+        SIMDE_FLOAT32_C(   546.34), SIMDE_FLOAT32_C(   825.10), SIMDE_FLOAT32_C(  -673.11), SIMDE_FLOAT32_C(   268.17) },
+      { SIMDE_FLOAT32_C(   -16.05), SIMDE_FLOAT32_C(   873.51), SIMDE_FLOAT32_C(   268.17), SIMDE_FLOAT32_C(  -923.84),
+        SIMDE_FLOAT32_C(   836.59), SIMDE_FLOAT32_C(   -55.83), SIMDE_FLOAT32_C(  -911.43), SIMDE_FLOAT32_C(   367.25) } },
+    { { SIMDE_FLOAT32_C(    21.81), SIMDE_FLOAT32_C(  -339.27), SIMDE_FLOAT32_C(  -279.48), SIMDE_FLOAT32_C(  -236.55),
+        SIMDE_FLOAT32_C(  -404.10), SIMDE_FLOAT32_C(   820.17), SIMDE_FLOAT32_C(  -138.07), SIMDE_FLOAT32_C(  -770.06) },
+      UINT8_C(231),
+      { SIMDE_FLOAT32_C(   291.38), SIMDE_FLOAT32_C(  -693.04), SIMDE_FLOAT32_C(   329.17), SIMDE_FLOAT32_C(   303.39),
+        SIMDE_FLOAT32_C(   567.84), SIMDE_FLOAT32_C(   753.29), SIMDE_FLOAT32_C(  -485.83), SIMDE_FLOAT32_C(   944.07) },
+      { SIMDE_FLOAT32_C(   291.38), SIMDE_FLOAT32_C(  -693.04), SIMDE_FLOAT32_C(   329.17), SIMDE_FLOAT32_C(   753.29),
+        SIMDE_FLOAT32_C(  -485.83), SIMDE_FLOAT32_C(   944.07), SIMDE_FLOAT32_C(  -138.07), SIMDE_FLOAT32_C(  -770.06) } },
+    { { SIMDE_FLOAT32_C(   338.05), SIMDE_FLOAT32_C(  -894.21), SIMDE_FLOAT32_C(  -954.07), SIMDE_FLOAT32_C(   363.37),
+        SIMDE_FLOAT32_C(  -915.49), SIMDE_FLOAT32_C(  -697.15), SIMDE_FLOAT32_C(   196.20), SIMDE_FLOAT32_C(  -683.51) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT32_C(  -887.67), SIMDE_FLOAT32_C(   -94.31), SIMDE_FLOAT32_C(   919.67), SIMDE_FLOAT32_C(   245.81),
+        SIMDE_FLOAT32_C(  -796.31), SIMDE_FLOAT32_C(  -427.84), SIMDE_FLOAT32_C(   406.54), SIMDE_FLOAT32_C(  -796.90) },
+      { SIMDE_FLOAT32_C(  -887.67), SIMDE_FLOAT32_C(  -894.21), SIMDE_FLOAT32_C(  -954.07), SIMDE_FLOAT32_C(   363.37),
+        SIMDE_FLOAT32_C(  -915.49), SIMDE_FLOAT32_C(  -697.15), SIMDE_FLOAT32_C(   196.20), SIMDE_FLOAT32_C(  -683.51) } },
+    { { SIMDE_FLOAT32_C(  -408.45), SIMDE_FLOAT32_C(   680.10), SIMDE_FLOAT32_C(   990.85), SIMDE_FLOAT32_C(  -642.04),
+        SIMDE_FLOAT32_C(   447.53), SIMDE_FLOAT32_C(  -471.20), SIMDE_FLOAT32_C(  -990.44), SIMDE_FLOAT32_C(  -358.02) },
+      UINT8_C( 20),
+      { SIMDE_FLOAT32_C(  -959.35), SIMDE_FLOAT32_C(   949.10), SIMDE_FLOAT32_C(  -610.01), SIMDE_FLOAT32_C(   183.82),
+        SIMDE_FLOAT32_C(   701.34), SIMDE_FLOAT32_C(    32.88), SIMDE_FLOAT32_C(   362.42), SIMDE_FLOAT32_C(  -167.44) },
+      { SIMDE_FLOAT32_C(  -610.01), SIMDE_FLOAT32_C(   701.34), SIMDE_FLOAT32_C(   990.85), SIMDE_FLOAT32_C(  -642.04),
+        SIMDE_FLOAT32_C(   447.53), SIMDE_FLOAT32_C(  -471.20), SIMDE_FLOAT32_C(  -990.44), SIMDE_FLOAT32_C(  -358.02) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_float32 r[8];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm256_mask_compressstoreu_ps(r, test_vec[i].k, a);
+    simde_assert_equal_vf32(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -911.50), SIMDE_FLOAT64_C(   894.28), SIMDE_FLOAT64_C(   997.91), SIMDE_FLOAT64_C(   562.68) },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C(   710.11), SIMDE_FLOAT64_C(   840.20), SIMDE_FLOAT64_C(  -907.94), SIMDE_FLOAT64_C(   108.57) },
+      { SIMDE_FLOAT64_C(  -911.50), SIMDE_FLOAT64_C(   894.28), SIMDE_FLOAT64_C(   997.91), SIMDE_FLOAT64_C(   562.68) } },
+    { { SIMDE_FLOAT64_C(   498.94), SIMDE_FLOAT64_C(  -901.73), SIMDE_FLOAT64_C(  -933.34), SIMDE_FLOAT64_C(  -412.41) },
+      UINT8_C( 75),
+      { SIMDE_FLOAT64_C(   172.86), SIMDE_FLOAT64_C(   707.46), SIMDE_FLOAT64_C(   928.02), SIMDE_FLOAT64_C(   858.62) },
+      { SIMDE_FLOAT64_C(   172.86), SIMDE_FLOAT64_C(   707.46), SIMDE_FLOAT64_C(   858.62), SIMDE_FLOAT64_C(  -412.41) } },
+    { { SIMDE_FLOAT64_C(   248.31), SIMDE_FLOAT64_C(   100.04), SIMDE_FLOAT64_C(   982.38), SIMDE_FLOAT64_C(  -412.05) },
+      UINT8_C( 72),
+      { SIMDE_FLOAT64_C(   838.84), SIMDE_FLOAT64_C(  -982.56), SIMDE_FLOAT64_C(   157.69), SIMDE_FLOAT64_C(  -778.99) },
+      { SIMDE_FLOAT64_C(  -778.99), SIMDE_FLOAT64_C(   100.04), SIMDE_FLOAT64_C(   982.38), SIMDE_FLOAT64_C(  -412.05) } },
+    { { SIMDE_FLOAT64_C(  -735.68), SIMDE_FLOAT64_C(  -967.46), SIMDE_FLOAT64_C(  -705.70), SIMDE_FLOAT64_C(  -161.41) },
+      UINT8_C(235),
+      { SIMDE_FLOAT64_C(   677.73), SIMDE_FLOAT64_C(  -203.64), SIMDE_FLOAT64_C(  -458.91), SIMDE_FLOAT64_C(  -429.64) },
+      { SIMDE_FLOAT64_C(   677.73), SIMDE_FLOAT64_C(  -203.64), SIMDE_FLOAT64_C(  -429.64), SIMDE_FLOAT64_C(  -161.41) } },
+    { { SIMDE_FLOAT64_C(   703.35), SIMDE_FLOAT64_C(  -889.32), SIMDE_FLOAT64_C(   807.67), SIMDE_FLOAT64_C(  -701.43) },
+      UINT8_C(188),
+      { SIMDE_FLOAT64_C(  -248.29), SIMDE_FLOAT64_C(    51.84), SIMDE_FLOAT64_C(   443.08), SIMDE_FLOAT64_C(   964.13) },
+      { SIMDE_FLOAT64_C(   443.08), SIMDE_FLOAT64_C(   964.13), SIMDE_FLOAT64_C(   807.67), SIMDE_FLOAT64_C(  -701.43) } },
+    { { SIMDE_FLOAT64_C(  -799.61), SIMDE_FLOAT64_C(   412.49), SIMDE_FLOAT64_C(   390.19), SIMDE_FLOAT64_C(   249.02) },
+      UINT8_C( 17),
+      { SIMDE_FLOAT64_C(   938.58), SIMDE_FLOAT64_C(   363.87), SIMDE_FLOAT64_C(   843.25), SIMDE_FLOAT64_C(   780.71) },
+      { SIMDE_FLOAT64_C(   938.58), SIMDE_FLOAT64_C(   412.49), SIMDE_FLOAT64_C(   390.19), SIMDE_FLOAT64_C(   249.02) } },
+    { { SIMDE_FLOAT64_C(  -587.77), SIMDE_FLOAT64_C(  -921.50), SIMDE_FLOAT64_C(   853.48), SIMDE_FLOAT64_C(   957.76) },
+      UINT8_C(251),
+      { SIMDE_FLOAT64_C(  -356.13), SIMDE_FLOAT64_C(  -503.12), SIMDE_FLOAT64_C(  -513.01), SIMDE_FLOAT64_C(   984.09) },
+      { SIMDE_FLOAT64_C(  -356.13), SIMDE_FLOAT64_C(  -503.12), SIMDE_FLOAT64_C(   984.09), SIMDE_FLOAT64_C(   957.76) } },
+    { { SIMDE_FLOAT64_C(  -593.80), SIMDE_FLOAT64_C(   724.47), SIMDE_FLOAT64_C(   -18.72), SIMDE_FLOAT64_C(   633.24) },
+      UINT8_C( 20),
+      { SIMDE_FLOAT64_C(  -580.79), SIMDE_FLOAT64_C(   254.28), SIMDE_FLOAT64_C(  -435.10), SIMDE_FLOAT64_C(   297.53) },
+      { SIMDE_FLOAT64_C(  -435.10), SIMDE_FLOAT64_C(   724.47), SIMDE_FLOAT64_C(   -18.72), SIMDE_FLOAT64_C(   633.24) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_compress_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(237),
+      { SIMDE_FLOAT64_C(   122.83), SIMDE_FLOAT64_C(  -760.77), SIMDE_FLOAT64_C(   163.45), SIMDE_FLOAT64_C(   689.52) },
+      { SIMDE_FLOAT64_C(   122.83), SIMDE_FLOAT64_C(   163.45), SIMDE_FLOAT64_C(   689.52), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 16),
+      { SIMDE_FLOAT64_C(  -909.67), SIMDE_FLOAT64_C(  -847.58), SIMDE_FLOAT64_C(  -950.04), SIMDE_FLOAT64_C(  -238.37) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(207),
+      { SIMDE_FLOAT64_C(  -829.07), SIMDE_FLOAT64_C(   460.62), SIMDE_FLOAT64_C(   252.34), SIMDE_FLOAT64_C(   294.09) },
+      { SIMDE_FLOAT64_C(  -829.07), SIMDE_FLOAT64_C(   460.62), SIMDE_FLOAT64_C(   252.34), SIMDE_FLOAT64_C(   294.09) } },
+    { UINT8_C( 88),
+      { SIMDE_FLOAT64_C(  -397.11), SIMDE_FLOAT64_C(  -924.18), SIMDE_FLOAT64_C(  -579.71), SIMDE_FLOAT64_C(  -938.96) },
+      { SIMDE_FLOAT64_C(  -938.96), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(189),
+      { SIMDE_FLOAT64_C(  -690.72), SIMDE_FLOAT64_C(  -419.17), SIMDE_FLOAT64_C(  -371.48), SIMDE_FLOAT64_C(   834.40) },
+      { SIMDE_FLOAT64_C(  -690.72), SIMDE_FLOAT64_C(  -371.48), SIMDE_FLOAT64_C(   834.40), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(108),
+      { SIMDE_FLOAT64_C(  -815.89), SIMDE_FLOAT64_C(  -749.79), SIMDE_FLOAT64_C(   231.42), SIMDE_FLOAT64_C(   637.55) },
+      { SIMDE_FLOAT64_C(   231.42), SIMDE_FLOAT64_C(   637.55), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(130),
+      { SIMDE_FLOAT64_C(  -169.68), SIMDE_FLOAT64_C(    54.40), SIMDE_FLOAT64_C(   361.95), SIMDE_FLOAT64_C(   242.46) },
+      { SIMDE_FLOAT64_C(    54.40), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(154),
+      { SIMDE_FLOAT64_C(  -960.58), SIMDE_FLOAT64_C(  -288.13), SIMDE_FLOAT64_C(  -476.21), SIMDE_FLOAT64_C(    15.01) },
+      { SIMDE_FLOAT64_C(  -288.13), SIMDE_FLOAT64_C(    15.01), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_compress_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   191.84), SIMDE_FLOAT64_C(   832.30), SIMDE_FLOAT64_C(   -32.97), SIMDE_FLOAT64_C(  -581.03) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(   953.01), SIMDE_FLOAT64_C(    22.21), SIMDE_FLOAT64_C(   315.76), SIMDE_FLOAT64_C(   934.44) },
+      { SIMDE_FLOAT64_C(   953.01), SIMDE_FLOAT64_C(    22.21), SIMDE_FLOAT64_C(   315.76), SIMDE_FLOAT64_C(   934.44) } },
+    { { SIMDE_FLOAT64_C(   489.87), SIMDE_FLOAT64_C(  -456.55), SIMDE_FLOAT64_C(   122.72), SIMDE_FLOAT64_C(   418.64) },
+      UINT8_C(  7),
+      { SIMDE_FLOAT64_C(   783.13), SIMDE_FLOAT64_C(   528.60), SIMDE_FLOAT64_C(  -459.13), SIMDE_FLOAT64_C(   -30.56) },
+      { SIMDE_FLOAT64_C(   783.13), SIMDE_FLOAT64_C(   528.60), SIMDE_FLOAT64_C(  -459.13), SIMDE_FLOAT64_C(   418.64) } },
+    { { SIMDE_FLOAT64_C(   476.00), SIMDE_FLOAT64_C(   285.53), SIMDE_FLOAT64_C(  -315.62), SIMDE_FLOAT64_C(   179.49) },
+      UINT8_C(126),
+      { SIMDE_FLOAT64_C(  -229.88), SIMDE_FLOAT64_C(  -383.74), SIMDE_FLOAT64_C(  -566.67), SIMDE_FLOAT64_C(   318.90) },
+      { SIMDE_FLOAT64_C(  -383.74), SIMDE_FLOAT64_C(  -566.67), SIMDE_FLOAT64_C(   318.90), SIMDE_FLOAT64_C(   179.49) } },
+    { { SIMDE_FLOAT64_C(   -24.46), SIMDE_FLOAT64_C(   197.16), SIMDE_FLOAT64_C(  -780.15), SIMDE_FLOAT64_C(   281.36) },
+      UINT8_C(102),
+      { SIMDE_FLOAT64_C(    48.63), SIMDE_FLOAT64_C(  -927.17), SIMDE_FLOAT64_C(   182.06), SIMDE_FLOAT64_C(   257.08) },
+      { SIMDE_FLOAT64_C(  -927.17), SIMDE_FLOAT64_C(   182.06), SIMDE_FLOAT64_C(  -780.15), SIMDE_FLOAT64_C(   281.36) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_float64 r[4];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm256_mask_compressstoreu_pd(r, test_vec[i].k, a);
+    simde_assert_equal_vf64(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C(  82), -INT8_C(  44),  INT8_C(  45), -INT8_C(  37),  INT8_C(  81),  INT8_C( 124),  INT8_C(  81),  INT8_C(   0),
+             INT8_MIN, -INT8_C( 104), -INT8_C(  24),  INT8_C( 125),  INT8_C(   0), -INT8_C(  64),  INT8_C( 109),  INT8_C(  51),
+        -INT8_C(  59), -INT8_C(  71),  INT8_C( 106), -INT8_C(  28),  INT8_C(  66),  INT8_C(  83), -INT8_C( 126),  INT8_C(   7),
+             INT8_MIN, -INT8_C( 117),  INT8_C(  16),  INT8_C( 109),  INT8_C( 124),  INT8_C(  37), -INT8_C(  61),  INT8_C( 109),
+         INT8_C(  97), -INT8_C( 119),  INT8_C(  61),  INT8_C(   9), -INT8_C(  13),  INT8_C(  47), -INT8_C(  90),  INT8_C(  87),
+        -INT8_C( 115),  INT8_C(  73),  INT8_C(  20), -INT8_C(  44), -INT8_C(  90),  INT8_C(  98),  INT8_C(  39),  INT8_C(  32),
+        -INT8_C(  31),  INT8_C(  32),  INT8_C(  85),  INT8_C(  49), -INT8_C(  37),  INT8_C( 126),  INT8_C(  56),  INT8_C(   1),
+         INT8_C(  87),  INT8_C(  83),  INT8_C(  77),  INT8_C(  28),  INT8_C(   3),  INT8_C( 117),  INT8_C(  98),  INT8_C(  70) },
+      UINT64_C(13492711895957663535),
+      { -INT8_C(  93), -INT8_C(  79), -INT8_C(  80),  INT8_C(  15),  INT8_C(  85), -INT8_C(  77), -INT8_C(  43),  INT8_C(  24),
+         INT8_C(   1), -INT8_C(  53),  INT8_C(  15),  INT8_C( 104),  INT8_C(  62), -INT8_C( 109), -INT8_C(  39),  INT8_C(  72),
+         INT8_C(  75),  INT8_C(  91), -INT8_C(  84), -INT8_C(  23), -INT8_C( 124), -INT8_C( 107), -INT8_C(  95), -INT8_C(  14),
+        -INT8_C(  62),  INT8_C(  96),  INT8_C(  49),  INT8_C(  21), -INT8_C(  37), -INT8_C(  88),  INT8_C(   7), -INT8_C(  38),
+         INT8_C( 114),  INT8_C(  65),  INT8_C( 112),  INT8_C(  26),  INT8_C(  11), -INT8_C(  71),  INT8_C( 121), -INT8_C(  87),
+        -INT8_C(  91),  INT8_C( 103), -INT8_C( 102), -INT8_C(  86), -INT8_C(   8),  INT8_C(  20),  INT8_C( 123),  INT8_C( 111),
+        -INT8_C(  24), -INT8_C(  50),  INT8_C(  51),  INT8_C(   0),  INT8_C(  57), -INT8_C(  47),  INT8_C(  47),  INT8_C( 111),
+        -INT8_C(  61),  INT8_C(  98),  INT8_C(  10), -INT8_C( 105), -INT8_C(   3),  INT8_C(  26), -INT8_C(  74), -INT8_C(  95) },
+      { -INT8_C(  93), -INT8_C(  79), -INT8_C(  80),  INT8_C(  15), -INT8_C(  77),  INT8_C(   1), -INT8_C(  53),  INT8_C(  15),
+         INT8_C( 104), -INT8_C( 109), -INT8_C(  39),  INT8_C(  91), -INT8_C(  84), -INT8_C(  23), -INT8_C( 124), -INT8_C( 107),
+        -INT8_C(  62),  INT8_C(  96),  INT8_C(  49),  INT8_C(  21), -INT8_C(  37),  INT8_C(   7),  INT8_C( 114),  INT8_C(  65),
+         INT8_C(  26),  INT8_C(  11), -INT8_C(  71),  INT8_C( 121), -INT8_C(  87), -INT8_C(  91), -INT8_C( 102), -INT8_C(  86),
+        -INT8_C(   8),  INT8_C(  20),  INT8_C( 111), -INT8_C(  24), -INT8_C(  50),  INT8_C(  51),  INT8_C(   0),  INT8_C(  57),
+        -INT8_C(  47), -INT8_C(  61),  INT8_C(  98), -INT8_C( 105), -INT8_C(   3),  INT8_C(  26), -INT8_C(  95),  INT8_C(  32),
+        -INT8_C(  31),  INT8_C(  32),  INT8_C(  85),  INT8_C(  49), -INT8_C(  37),  INT8_C( 126),  INT8_C(  56),  INT8_C(   1),
+         INT8_C(  87),  INT8_C(  83),  INT8_C(  77),  INT8_C(  28),  INT8_C(   3),  INT8_C( 117),  INT8_C(  98),  INT8_C(  70) } },
+    { {  INT8_C(  96), -INT8_C( 113), -INT8_C(   8),  INT8_C( 121),  INT8_C(  71),  INT8_C(  61), -INT8_C(  16), -INT8_C( 109),
+         INT8_C(  52),  INT8_C(   4), -INT8_C(  37),  INT8_C(  57),  INT8_C(  67), -INT8_C(  24),  INT8_C(  28), -INT8_C( 122),
+         INT8_C( 114),  INT8_C( 112), -INT8_C( 103), -INT8_C(  35),  INT8_C(  51), -INT8_C(  68), -INT8_C(  55), -INT8_C(  65),
+         INT8_C( 103), -INT8_C(  74), -INT8_C(  19), -INT8_C(  68),  INT8_C(  67),  INT8_C(  27),  INT8_C(  85),  INT8_C(  83),
+        -INT8_C(  40), -INT8_C(  21),  INT8_C(  26), -INT8_C(  98), -INT8_C(  62), -INT8_C(  94),  INT8_C(  92), -INT8_C(  23),
+        -INT8_C(  61),  INT8_C( 119), -INT8_C(  70),  INT8_C( 106), -INT8_C( 114),  INT8_C(   9),  INT8_C(  63),  INT8_C( 103),
+         INT8_C( 125),  INT8_C(  25),  INT8_C(  66), -INT8_C(  94),  INT8_C(  71), -INT8_C(  26), -INT8_C( 112),  INT8_C( 125),
+         INT8_C(  13), -INT8_C(  51),  INT8_C(  83), -INT8_C(  63), -INT8_C(  71),  INT8_C(  56),  INT8_C( 100), -INT8_C( 122) },
+      UINT64_C(13355444874896922834),
+      { -INT8_C(   8), -INT8_C(   5), -INT8_C( 109),  INT8_C(   9),      INT8_MAX,  INT8_C(  26),  INT8_C(  68),  INT8_C(  89),
+        -INT8_C(  76),  INT8_C(  94), -INT8_C(  22),  INT8_C(  14),  INT8_C(  41), -INT8_C(  27),  INT8_C( 108), -INT8_C(   7),
+         INT8_C(  39),  INT8_C(  89),  INT8_C(   8), -INT8_C(  68),  INT8_C(   5),  INT8_C(  37),  INT8_C(  23),  INT8_C(  71),
+        -INT8_C( 125), -INT8_C( 109),  INT8_C( 115),  INT8_C( 105), -INT8_C(  60),  INT8_C(  68),  INT8_C( 112), -INT8_C(  57),
+         INT8_C(  31),  INT8_C(  52), -INT8_C( 120), -INT8_C(  74), -INT8_C(  99), -INT8_C(   5),  INT8_C(  61), -INT8_C(  93),
+         INT8_C(  53),  INT8_C(  51), -INT8_C(  45), -INT8_C(  84), -INT8_C(  11),  INT8_C(  24),  INT8_C(  30),  INT8_C( 123),
+        -INT8_C(  20),  INT8_C( 114),  INT8_C(  15), -INT8_C( 121),  INT8_C(  41),  INT8_C(  12),  INT8_C(  29),  INT8_C(   2),
+        -INT8_C(  34), -INT8_C(  60), -INT8_C( 123), -INT8_C(  95), -INT8_C(  58), -INT8_C( 119), -INT8_C(  17),  INT8_C(  17) },
+      { -INT8_C(   5),      INT8_MAX,  INT8_C(  68),  INT8_C(  89),  INT8_C(  14),  INT8_C(  41),  INT8_C( 108), -INT8_C(   7),
+         INT8_C(  89), -INT8_C(  68),  INT8_C(  71), -INT8_C( 125), -INT8_C(  57),  INT8_C(  52), -INT8_C(  74), -INT8_C(  99),
+         INT8_C(  61),  INT8_C(  51), -INT8_C(  11), -INT8_C( 121),  INT8_C(  41),  INT8_C(  29), -INT8_C(  34), -INT8_C(  95),
+        -INT8_C(  58), -INT8_C( 119),  INT8_C(  17), -INT8_C(  68),  INT8_C(  67),  INT8_C(  27),  INT8_C(  85),  INT8_C(  83),
+        -INT8_C(  40), -INT8_C(  21),  INT8_C(  26), -INT8_C(  98), -INT8_C(  62), -INT8_C(  94),  INT8_C(  92), -INT8_C(  23),
+        -INT8_C(  61),  INT8_C( 119), -INT8_C(  70),  INT8_C( 106), -INT8_C( 114),  INT8_C(   9),  INT8_C(  63),  INT8_C( 103),
+         INT8_C( 125),  INT8_C(  25),  INT8_C(  66), -INT8_C(  94),  INT8_C(  71), -INT8_C(  26), -INT8_C( 112),  INT8_C( 125),
+         INT8_C(  13), -INT8_C(  51),  INT8_C(  83), -INT8_C(  63), -INT8_C(  71),  INT8_C(  56),  INT8_C( 100), -INT8_C( 122) } },
+    { {  INT8_C(   1),  INT8_C( 123),  INT8_C( 110),  INT8_C(  45),  INT8_C(  26), -INT8_C(  77),  INT8_C(  25), -INT8_C(  92),
+        -INT8_C(  48),  INT8_C(  90), -INT8_C( 126),  INT8_C(  94),  INT8_C(  17), -INT8_C(  67),  INT8_C(  47),  INT8_C( 119),
+        -INT8_C(  19),  INT8_C(   4),  INT8_C(  92),  INT8_C(  44),  INT8_C(  94), -INT8_C( 103),  INT8_C(  58),  INT8_C( 121),
+         INT8_C( 106), -INT8_C( 120),  INT8_C(  10),  INT8_C(  99),  INT8_C(   6), -INT8_C(  89),  INT8_C(   6),  INT8_C(  58),
+        -INT8_C( 115),  INT8_C(  68), -INT8_C(  80),  INT8_C(  24),  INT8_C(  34),  INT8_C(  11),  INT8_C(  21),  INT8_C(  19),
+        -INT8_C( 112),  INT8_C(  27),  INT8_C( 118), -INT8_C( 107), -INT8_C(   9), -INT8_C( 100), -INT8_C(  34), -INT8_C(   8),
+         INT8_C(   6),  INT8_C(  56), -INT8_C(  67),  INT8_C(  12),  INT8_C(  39), -INT8_C(  16), -INT8_C(  92),  INT8_C(   3),
+        -INT8_C(  85), -INT8_C(  13), -INT8_C(  92),  INT8_C( 117),  INT8_C(  81), -INT8_C(  78),  INT8_C(  79),  INT8_C(  89) },
+      UINT64_C(10142668909441554445),
+      { -INT8_C(  92),  INT8_C(   6), -INT8_C( 118),  INT8_C(  65), -INT8_C( 124), -INT8_C(  36), -INT8_C(  74),  INT8_C(  36),
+        -INT8_C(  52), -INT8_C(  73),  INT8_C(  78), -INT8_C(  53), -INT8_C(  21),  INT8_C(  92), -INT8_C( 113), -INT8_C(  19),
+        -INT8_C(  32),  INT8_C(  38),  INT8_C( 120), -INT8_C( 122),  INT8_C(  74), -INT8_C( 123), -INT8_C(  97), -INT8_C(  79),
+        -INT8_C( 127),  INT8_C(   7), -INT8_C(  27), -INT8_C(  68), -INT8_C(  61), -INT8_C(  69), -INT8_C(   3), -INT8_C(  65),
+         INT8_C(  64),  INT8_C(  44),  INT8_C(  81), -INT8_C(  50),  INT8_C(  50), -INT8_C(  28),  INT8_C(  58),  INT8_C(  34),
+         INT8_C( 117), -INT8_C(  37),  INT8_C( 100), -INT8_C( 109),  INT8_C( 100), -INT8_C(  66), -INT8_C(  43), -INT8_C(  70),
+         INT8_C(  47), -INT8_C(  98),  INT8_C(   1), -INT8_C(  60), -INT8_C(  62),  INT8_C(  32), -INT8_C(  43),  INT8_C( 112),
+         INT8_C( 114),  INT8_C( 108), -INT8_C(  17), -INT8_C(  25), -INT8_C(  51), -INT8_C(  60),  INT8_C(  67),  INT8_C(  77) },
+      { -INT8_C(  92), -INT8_C( 118),  INT8_C(  65), -INT8_C(  53), -INT8_C(  21), -INT8_C(  19), -INT8_C(  32), -INT8_C( 122),
+        -INT8_C( 123), -INT8_C(  79), -INT8_C( 127), -INT8_C(  27), -INT8_C(  68), -INT8_C(  65),  INT8_C(  44), -INT8_C(  28),
+         INT8_C(  34),  INT8_C( 117), -INT8_C(  37),  INT8_C( 100), -INT8_C( 109),  INT8_C( 100), -INT8_C(  66), -INT8_C(  43),
+        -INT8_C(  70),  INT8_C(  47), -INT8_C(  43),  INT8_C( 112), -INT8_C(  17), -INT8_C(  25),  INT8_C(  77),  INT8_C(  58),
+        -INT8_C( 115),  INT8_C(  68), -INT8_C(  80),  INT8_C(  24),  INT8_C(  34),  INT8_C(  11),  INT8_C(  21),  INT8_C(  19),
+        -INT8_C( 112),  INT8_C(  27),  INT8_C( 118), -INT8_C( 107), -INT8_C(   9), -INT8_C( 100), -INT8_C(  34), -INT8_C(   8),
+         INT8_C(   6),  INT8_C(  56), -INT8_C(  67),  INT8_C(  12),  INT8_C(  39), -INT8_C(  16), -INT8_C(  92),  INT8_C(   3),
+        -INT8_C(  85), -INT8_C(  13), -INT8_C(  92),  INT8_C( 117),  INT8_C(  81), -INT8_C(  78),  INT8_C(  79),  INT8_C(  89) } },
+    { {  INT8_C(  92),  INT8_C(  21),  INT8_C(  88),  INT8_C(  67),  INT8_C(   8), -INT8_C(  86), -INT8_C( 109), -INT8_C(  19),
+         INT8_C(  82), -INT8_C( 120),  INT8_C(  89),  INT8_C(  66), -INT8_C( 100), -INT8_C( 107),  INT8_C( 103), -INT8_C(  80),
+        -INT8_C(  99),  INT8_C(  55),  INT8_C(  45), -INT8_C(   3), -INT8_C(  50),  INT8_C(  59),  INT8_C(  54), -INT8_C( 120),
+        -INT8_C(  62), -INT8_C(  77),  INT8_C(   1),  INT8_C( 106),  INT8_C(  67),  INT8_C(  47),  INT8_C(  14),  INT8_C(  82),
+         INT8_C(   0), -INT8_C(  25),  INT8_C(  89),  INT8_C(   6),  INT8_C( 103),  INT8_C(  16),  INT8_C(  51),  INT8_C(  84),
+        -INT8_C(  13),  INT8_C(  66), -INT8_C(  43),  INT8_C( 125), -INT8_C(  82),  INT8_C(  29),  INT8_C( 114),  INT8_C(  80),
+        -INT8_C( 106), -INT8_C(  62),  INT8_C(  91),  INT8_C(  80), -INT8_C(  21), -INT8_C( 112),  INT8_C(  37),  INT8_C( 119),
+         INT8_C(  39), -INT8_C(  67), -INT8_C( 123),  INT8_C(  81), -INT8_C(  44),  INT8_C( 108), -INT8_C(  76), -INT8_C( 122) },
+      UINT64_C( 9259770274623068192),
+      {  INT8_C(  37),  INT8_C(  51),  INT8_C(  57),  INT8_C(  19), -INT8_C(  49),  INT8_C(  87), -INT8_C( 114), -INT8_C(  69),
+        -INT8_C(  51),  INT8_C(  99), -INT8_C(  46), -INT8_C(  38), -INT8_C(  54), -INT8_C(  49), -INT8_C( 118),  INT8_C(  78),
+        -INT8_C(  13), -INT8_C(  95), -INT8_C(  67),  INT8_C( 113),  INT8_C( 111), -INT8_C(   3),  INT8_C(   8), -INT8_C(  97),
+        -INT8_C( 116),  INT8_C(  56),  INT8_C( 101),  INT8_C(  19),  INT8_C(  64), -INT8_C(  32), -INT8_C( 105), -INT8_C(  37),
+         INT8_C(  58),  INT8_C(  66), -INT8_C(  12),  INT8_C(  79),  INT8_C(  40),  INT8_C(  60), -INT8_C( 119), -INT8_C(   7),
+        -INT8_C(  69),  INT8_C(  70), -INT8_C(  43),  INT8_C(  54), -INT8_C( 110),  INT8_C(   2), -INT8_C(  67),  INT8_C(   5),
+        -INT8_C(  36),      INT8_MAX,  INT8_C(  95), -INT8_C( 101), -INT8_C( 104),  INT8_C(  16),  INT8_C(  30), -INT8_C( 118),
+         INT8_C(  13), -INT8_C(  97), -INT8_C(  44), -INT8_C(   4), -INT8_C(  20),  INT8_C(  63),  INT8_C(  36), -INT8_C(  23) },
+      {  INT8_C(  87), -INT8_C(  38), -INT8_C(  54), -INT8_C(  13), -INT8_C(   3), -INT8_C(  97), -INT8_C(  32),  INT8_C(  58),
+        -INT8_C( 110), -INT8_C(  67), -INT8_C(  36), -INT8_C( 118), -INT8_C(  23), -INT8_C( 107),  INT8_C( 103), -INT8_C(  80),
+        -INT8_C(  99),  INT8_C(  55),  INT8_C(  45), -INT8_C(   3), -INT8_C(  50),  INT8_C(  59),  INT8_C(  54), -INT8_C( 120),
+        -INT8_C(  62), -INT8_C(  77),  INT8_C(   1),  INT8_C( 106),  INT8_C(  67),  INT8_C(  47),  INT8_C(  14),  INT8_C(  82),
+         INT8_C(   0), -INT8_C(  25),  INT8_C(  89),  INT8_C(   6),  INT8_C( 103),  INT8_C(  16),  INT8_C(  51),  INT8_C(  84),
+        -INT8_C(  13),  INT8_C(  66), -INT8_C(  43),  INT8_C( 125), -INT8_C(  82),  INT8_C(  29),  INT8_C( 114),  INT8_C(  80),
+        -INT8_C( 106), -INT8_C(  62),  INT8_C(  91),  INT8_C(  80), -INT8_C(  21), -INT8_C( 112),  INT8_C(  37),  INT8_C( 119),
+         INT8_C(  39), -INT8_C(  67), -INT8_C( 123),  INT8_C(  81), -INT8_C(  44),  INT8_C( 108), -INT8_C(  76), -INT8_C( 122) } },
+    { { -INT8_C(  60),  INT8_C(  32),  INT8_C(  21),  INT8_C( 108), -INT8_C(  69), -INT8_C(  45),  INT8_C(  91),  INT8_C(   1),
+         INT8_C(  57), -INT8_C(  32), -INT8_C(  47),  INT8_C(  17),  INT8_C(  42), -INT8_C(  69),  INT8_C( 112),  INT8_C(  71),
+         INT8_C(  99),  INT8_C(  34),  INT8_C(  53), -INT8_C(  35), -INT8_C(  31),  INT8_C(  79), -INT8_C(  69), -INT8_C(  87),
+        -INT8_C(  86),  INT8_C(  42),  INT8_C(  36),  INT8_C(  24),  INT8_C(  40),  INT8_C(  74), -INT8_C(  84), -INT8_C( 110),
+         INT8_C(  64),  INT8_C(   9),  INT8_C(  59),  INT8_C(  83),  INT8_C(  43), -INT8_C(  93), -INT8_C(  52), -INT8_C(  61),
+        -INT8_C( 107),  INT8_C(  63), -INT8_C(   9),  INT8_C(  94),  INT8_C( 102),  INT8_C(  57),  INT8_C(  45),  INT8_C( 120),
+        -INT8_C( 102), -INT8_C(  38), -INT8_C(  12), -INT8_C(   3), -INT8_C(  44), -INT8_C( 104), -INT8_C( 125),  INT8_C(  60),
+        -INT8_C(  89),  INT8_C( 103), -INT8_C( 118), -INT8_C(  45), -INT8_C( 108), -INT8_C(  53), -INT8_C( 104),  INT8_C(  88) },
+      UINT64_C(12757485580671999865),
+      {  INT8_C(  68), -INT8_C(  38),  INT8_C(  66),  INT8_C(  25), -INT8_C(  62), -INT8_C(  10),  INT8_C(  60), -INT8_C(  19),
+         INT8_C(   2), -INT8_C(  16), -INT8_C(  98), -INT8_C( 109), -INT8_C(  94), -INT8_C(  85), -INT8_C(  56), -INT8_C(  63),
+        -INT8_C(  75), -INT8_C(  38),  INT8_C(  27),  INT8_C(  23), -INT8_C(  52), -INT8_C(  32),  INT8_C( 108),  INT8_C(  56),
+         INT8_C(   2),  INT8_C( 117), -INT8_C(  92), -INT8_C(  49), -INT8_C(  36), -INT8_C( 107),  INT8_C( 120),  INT8_C(  68),
+         INT8_C(  26),  INT8_C(   3),  INT8_C( 126), -INT8_C(  28),  INT8_C(  75), -INT8_C(  27), -INT8_C(  29), -INT8_C(  43),
+        -INT8_C(  27),  INT8_C(  49), -INT8_C(  83),  INT8_C(  95), -INT8_C( 118),  INT8_C(  31), -INT8_C(  60), -INT8_C(  16),
+         INT8_C(  11), -INT8_C(  31), -INT8_C(  91),  INT8_C(   8),  INT8_C(  42),  INT8_C(  67),  INT8_C(  45),  INT8_C(  54),
+         INT8_C( 118), -INT8_C(  22), -INT8_C(  25),  INT8_C(  58), -INT8_C(  43), -INT8_C(  52), -INT8_C(   3),  INT8_C( 115) },
+      {  INT8_C(  68),  INT8_C(  25), -INT8_C(  62), -INT8_C(  10),  INT8_C(  60),  INT8_C(   2), -INT8_C(  16), -INT8_C(  98),
+        -INT8_C( 109), -INT8_C(  94), -INT8_C(  56), -INT8_C(  75), -INT8_C(  38),  INT8_C(  27),  INT8_C(  23), -INT8_C(  52),
+         INT8_C(   2),  INT8_C( 117), -INT8_C(  92), -INT8_C( 107),  INT8_C(  26),  INT8_C(   3), -INT8_C(  28), -INT8_C(  43),
+        -INT8_C(  27), -INT8_C( 118),  INT8_C(  31), -INT8_C(  16),  INT8_C(  11), -INT8_C(  31),  INT8_C(   8),  INT8_C( 118),
+        -INT8_C(  43), -INT8_C(  52),  INT8_C( 115),  INT8_C(  83),  INT8_C(  43), -INT8_C(  93), -INT8_C(  52), -INT8_C(  61),
+        -INT8_C( 107),  INT8_C(  63), -INT8_C(   9),  INT8_C(  94),  INT8_C( 102),  INT8_C(  57),  INT8_C(  45),  INT8_C( 120),
+        -INT8_C( 102), -INT8_C(  38), -INT8_C(  12), -INT8_C(   3), -INT8_C(  44), -INT8_C( 104), -INT8_C( 125),  INT8_C(  60),
+        -INT8_C(  89),  INT8_C( 103), -INT8_C( 118), -INT8_C(  45), -INT8_C( 108), -INT8_C(  53), -INT8_C( 104),  INT8_C(  88) } },
+    { { -INT8_C(  70),  INT8_C(  74), -INT8_C(  39),  INT8_C(  56), -INT8_C(  27),  INT8_C( 100),  INT8_C( 120), -INT8_C( 112),
+         INT8_C(   6),  INT8_C(  89), -INT8_C(  74),  INT8_C( 110), -INT8_C(  50), -INT8_C( 116), -INT8_C(  38), -INT8_C( 109),
+        -INT8_C(  55),  INT8_C(  24),  INT8_C(  21),  INT8_C(  33),  INT8_C(  13),  INT8_C(  69), -INT8_C(  61), -INT8_C(  50),
+         INT8_C(  76),  INT8_C(  15),  INT8_C(   2), -INT8_C(  39), -INT8_C(  78),  INT8_C(  61), -INT8_C(  93),  INT8_C(  79),
+         INT8_C(  81), -INT8_C(  27), -INT8_C( 119),  INT8_C(  49),  INT8_C(  54), -INT8_C(  75), -INT8_C(  17), -INT8_C( 113),
+        -INT8_C(  37), -INT8_C( 126), -INT8_C( 108), -INT8_C(  32), -INT8_C(  62), -INT8_C(  74), -INT8_C(  93), -INT8_C( 114),
+         INT8_C(  93), -INT8_C( 117), -INT8_C(  98), -INT8_C(  96),  INT8_C(  68),  INT8_C(   0),  INT8_C(  10), -INT8_C(  26),
+        -INT8_C(  74), -INT8_C(  85), -INT8_C( 121),  INT8_C(  38),  INT8_C(  23), -INT8_C(  21), -INT8_C(  21),      INT8_MAX },
+      UINT64_C( 7890781466383023901),
+      { -INT8_C(  29), -INT8_C( 105),  INT8_C(  79), -INT8_C( 105), -INT8_C(  21),  INT8_C(  35),  INT8_C(  52), -INT8_C(  79),
+        -INT8_C(  79),  INT8_C( 126), -INT8_C(  84),  INT8_C( 102), -INT8_C(  40),  INT8_C(  58),  INT8_C( 109), -INT8_C(  61),
+         INT8_C( 109), -INT8_C(  45),  INT8_C(  56),  INT8_C(   4),  INT8_C( 111), -INT8_C( 125),  INT8_C(  10),  INT8_C( 125),
+         INT8_C( 107), -INT8_C( 111),  INT8_C(  76), -INT8_C(   1), -INT8_C(  62), -INT8_C( 105),  INT8_C(  29), -INT8_C(  35),
+        -INT8_C( 127),  INT8_C(   9), -INT8_C(  43),  INT8_C(  53),  INT8_C(  86),  INT8_C(  67), -INT8_C(  45),  INT8_C(   4),
+         INT8_C( 122),  INT8_C(  94), -INT8_C(  60), -INT8_C(  74),  INT8_C(  94), -INT8_C(  40), -INT8_C( 113),  INT8_C( 113),
+        -INT8_C(  20), -INT8_C(  38), -INT8_C(  89), -INT8_C( 120), -INT8_C(  83),  INT8_C(  10),  INT8_C(  14), -INT8_C(  90),
+        -INT8_C(  23), -INT8_C(  38),  INT8_C(  12), -INT8_C(  10), -INT8_C(  99), -INT8_C(   3),  INT8_C(   9),  INT8_C(   3) },
+      { -INT8_C(  29),  INT8_C(  79), -INT8_C( 105), -INT8_C(  21), -INT8_C(  79),  INT8_C( 126), -INT8_C(  84),  INT8_C( 102),
+        -INT8_C(  40),  INT8_C(  58),  INT8_C( 109), -INT8_C(  61), -INT8_C(  45),  INT8_C(  56),  INT8_C(   4),  INT8_C( 111),
+        -INT8_C( 125),  INT8_C(  10),  INT8_C( 125),  INT8_C( 107), -INT8_C( 111),  INT8_C(  76), -INT8_C(   1), -INT8_C(  62),
+        -INT8_C( 105), -INT8_C(  35), -INT8_C( 127),  INT8_C(   9), -INT8_C(  43),  INT8_C(  53),  INT8_C(  67), -INT8_C(  45),
+         INT8_C(   4),  INT8_C( 122),  INT8_C(  94), -INT8_C(  60), -INT8_C(  74), -INT8_C(  40),  INT8_C( 113), -INT8_C(  20),
+        -INT8_C(  90), -INT8_C(  23),  INT8_C(  12), -INT8_C(  10), -INT8_C(   3),  INT8_C(   9), -INT8_C(  93), -INT8_C( 114),
+         INT8_C(  93), -INT8_C( 117), -INT8_C(  98), -INT8_C(  96),  INT8_C(  68),  INT8_C(   0),  INT8_C(  10), -INT8_C(  26),
+        -INT8_C(  74), -INT8_C(  85), -INT8_C( 121),  INT8_C(  38),  INT8_C(  23), -INT8_C(  21), -INT8_C(  21),      INT8_MAX } },
+    { {  INT8_C(  95),  INT8_C(  93), -INT8_C( 116), -INT8_C(  21), -INT8_C(  24), -INT8_C(  72),  INT8_C(  10), -INT8_C(  23),
+        -INT8_C(  81),  INT8_C(  46), -INT8_C(  44),  INT8_C(  85), -INT8_C(   1), -INT8_C( 105), -INT8_C(  93),  INT8_C(  91),
+         INT8_C(  35), -INT8_C(  10),  INT8_C(  37), -INT8_C(  80),  INT8_C(  96),  INT8_C(  25),  INT8_C(   5),  INT8_C(  40),
+        -INT8_C(  55),  INT8_C(  25),  INT8_C(  86), -INT8_C(  46),  INT8_C(  96),  INT8_C(  33),  INT8_C(  97),  INT8_C( 114),
+         INT8_C(  52),  INT8_C(  91), -INT8_C(  11), -INT8_C( 109), -INT8_C(  10),  INT8_C(  24),  INT8_C(  10),  INT8_C(   8),
+        -INT8_C(  90), -INT8_C(   2), -INT8_C(  93), -INT8_C( 126), -INT8_C( 120), -INT8_C(  33),  INT8_C(  19),  INT8_C(  37),
+         INT8_C( 115), -INT8_C(  38), -INT8_C(   8), -INT8_C(  20), -INT8_C(  36),  INT8_C(  72),  INT8_C(   9),  INT8_C( 102),
+        -INT8_C( 118),  INT8_C(  21), -INT8_C( 118),  INT8_C(  95), -INT8_C(  19), -INT8_C( 120), -INT8_C(  69),  INT8_C(  19) },
+      UINT64_C(  599033726781145130),
+      { -INT8_C( 113),  INT8_C(  32),  INT8_C(  63), -INT8_C(  99), -INT8_C(  52),  INT8_C(  37),  INT8_C( 103), -INT8_C(  62),
+        -INT8_C( 124), -INT8_C(  41),  INT8_C(  56), -INT8_C( 122),  INT8_C( 110), -INT8_C(  72), -INT8_C(  96), -INT8_C( 106),
+         INT8_C(  41), -INT8_C(  19),  INT8_C(  99), -INT8_C(   6), -INT8_C(  21), -INT8_C( 119), -INT8_C(  46), -INT8_C(  95),
+         INT8_C(  57),  INT8_C(   3),  INT8_C(  50), -INT8_C(  88),  INT8_C(   9), -INT8_C(  28), -INT8_C(  54), -INT8_C(  45),
+        -INT8_C(  72),  INT8_C( 108), -INT8_C( 115), -INT8_C(  84),  INT8_C(  33), -INT8_C( 106),  INT8_C(  36), -INT8_C(  16),
+         INT8_C( 110),  INT8_C( 105), -INT8_C(  90), -INT8_C(  66), -INT8_C( 119), -INT8_C(   6),  INT8_C(  53), -INT8_C(  51),
+         INT8_C(  46),  INT8_C(  71), -INT8_C(  59), -INT8_C(  24),  INT8_C( 108), -INT8_C(  96),  INT8_C(  55),  INT8_C(  48),
+        -INT8_C(  24), -INT8_C(  44),  INT8_C( 123),  INT8_C(  88),  INT8_C(  11),  INT8_C(  96), -INT8_C(  36), -INT8_C(  30) },
+      {  INT8_C(  32), -INT8_C(  99),  INT8_C(  37), -INT8_C(  96), -INT8_C( 106),  INT8_C(  99), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  50), -INT8_C(  88), -INT8_C(  28),  INT8_C( 105), -INT8_C( 119), -INT8_C(   6),  INT8_C( 108),  INT8_C(  55),
+         INT8_C(  88), -INT8_C(  10),  INT8_C(  37), -INT8_C(  80),  INT8_C(  96),  INT8_C(  25),  INT8_C(   5),  INT8_C(  40),
+        -INT8_C(  55),  INT8_C(  25),  INT8_C(  86), -INT8_C(  46),  INT8_C(  96),  INT8_C(  33),  INT8_C(  97),  INT8_C( 114),
+         INT8_C(  52),  INT8_C(  91), -INT8_C(  11), -INT8_C( 109), -INT8_C(  10),  INT8_C(  24),  INT8_C(  10),  INT8_C(   8),
+        -INT8_C(  90), -INT8_C(   2), -INT8_C(  93), -INT8_C( 126), -INT8_C( 120), -INT8_C(  33),  INT8_C(  19),  INT8_C(  37),
+         INT8_C( 115), -INT8_C(  38), -INT8_C(   8), -INT8_C(  20), -INT8_C(  36),  INT8_C(  72),  INT8_C(   9),  INT8_C( 102),
+        -INT8_C( 118),  INT8_C(  21), -INT8_C( 118),  INT8_C(  95), -INT8_C(  19), -INT8_C( 120), -INT8_C(  69),  INT8_C(  19) } },
+    { { -INT8_C(  12), -INT8_C(  86),  INT8_C( 114),  INT8_C(   9), -INT8_C(  16),  INT8_C( 125),  INT8_C(  60), -INT8_C(   9),
+         INT8_C(   8), -INT8_C( 108), -INT8_C(  19),  INT8_C(  57),  INT8_C(  36),  INT8_C(  80), -INT8_C(   9), -INT8_C(  34),
+         INT8_C(  43), -INT8_C( 125),  INT8_C(  76),  INT8_C(   1),  INT8_C(  19),  INT8_C( 102),  INT8_C(  71),  INT8_C(  66),
+        -INT8_C(  38), -INT8_C(  89), -INT8_C(  36),  INT8_C(  41),  INT8_C( 110), -INT8_C(   9), -INT8_C( 106), -INT8_C( 118),
+        -INT8_C(  46),  INT8_C(  59),  INT8_C(  54),  INT8_C(  83), -INT8_C(  78), -INT8_C(  36), -INT8_C(  21), -INT8_C(  22),
+         INT8_C(  72), -INT8_C( 124),  INT8_C( 124), -INT8_C( 116), -INT8_C( 124),  INT8_C( 104),  INT8_C( 122), -INT8_C(  47),
+        -INT8_C(  59),  INT8_C(   6), -INT8_C(  61),  INT8_C( 107),  INT8_C( 112), -INT8_C(  51), -INT8_C(   6), -INT8_C(  33),
+         INT8_C( 117),  INT8_C(  15), -INT8_C( 107),  INT8_C(   4),  INT8_C(   9), -INT8_C(  72), -INT8_C(  46), -INT8_C(  93) },
+      UINT64_C( 4697298941569925120),
+      { -INT8_C(  83),  INT8_C(  96), -INT8_C(  56),  INT8_C( 103), -INT8_C(  70), -INT8_C(  62),  INT8_C(  93), -INT8_C( 122),
+         INT8_C(  71),  INT8_C(  30), -INT8_C( 106),  INT8_C(  15),  INT8_C(  19),  INT8_C(  76),  INT8_C( 120),  INT8_C(  46),
+         INT8_C( 105), -INT8_C(  68),  INT8_C(  25), -INT8_C(  94),  INT8_C(  22), -INT8_C(  39),  INT8_C(  12),  INT8_C( 118),
+        -INT8_C(  27),  INT8_C(  86), -INT8_C(  73),  INT8_C( 125), -INT8_C(  63), -INT8_C(  97), -INT8_C( 100),  INT8_C(  91),
+         INT8_C(  53), -INT8_C(  27),  INT8_C( 125),  INT8_C( 125),  INT8_C(  20),  INT8_C(  16),  INT8_C( 123),  INT8_C(  91),
+         INT8_C(   6),  INT8_C(  28),  INT8_C( 102), -INT8_C( 105), -INT8_C(   5),  INT8_C( 117), -INT8_C(  57), -INT8_C(  93),
+         INT8_C( 122), -INT8_C(   3),  INT8_C(   7), -INT8_C(  61),  INT8_C(  53), -INT8_C( 123),  INT8_C(  29), -INT8_C( 116),
+         INT8_C(  70), -INT8_C(  93), -INT8_C(  69), -INT8_C(  72),  INT8_C( 116),  INT8_C(  61), -INT8_C(  71),  INT8_C(  99) },
+      { -INT8_C(  94),  INT8_C(  22),  INT8_C(  91), -INT8_C( 105),  INT8_C( 117),  INT8_C(  53), -INT8_C( 123),  INT8_C(  70),
+        -INT8_C(  71), -INT8_C( 108), -INT8_C(  19),  INT8_C(  57),  INT8_C(  36),  INT8_C(  80), -INT8_C(   9), -INT8_C(  34),
+         INT8_C(  43), -INT8_C( 125),  INT8_C(  76),  INT8_C(   1),  INT8_C(  19),  INT8_C( 102),  INT8_C(  71),  INT8_C(  66),
+        -INT8_C(  38), -INT8_C(  89), -INT8_C(  36),  INT8_C(  41),  INT8_C( 110), -INT8_C(   9), -INT8_C( 106), -INT8_C( 118),
+        -INT8_C(  46),  INT8_C(  59),  INT8_C(  54),  INT8_C(  83), -INT8_C(  78), -INT8_C(  36), -INT8_C(  21), -INT8_C(  22),
+         INT8_C(  72), -INT8_C( 124),  INT8_C( 124), -INT8_C( 116), -INT8_C( 124),  INT8_C( 104),  INT8_C( 122), -INT8_C(  47),
+        -INT8_C(  59),  INT8_C(   6), -INT8_C(  61),  INT8_C( 107),  INT8_C( 112), -INT8_C(  51), -INT8_C(   6), -INT8_C(  33),
+         INT8_C( 117),  INT8_C(  15), -INT8_C( 107),  INT8_C(   4),  INT8_C(   9), -INT8_C(  72), -INT8_C(  46), -INT8_C(  93) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(   63406018649409813),
+      { -INT8_C(  53),  INT8_C(  51), -INT8_C(   7),  INT8_C(  59),  INT8_C(  27),  INT8_C( 113),  INT8_C(  82),  INT8_C(  11),
+        -INT8_C(  12), -INT8_C(  60),  INT8_C(  24), -INT8_C(   8),  INT8_C(  35),  INT8_C(  24), -INT8_C(  25),  INT8_C(  84),
+        -INT8_C(  97), -INT8_C(  81), -INT8_C(  61), -INT8_C( 106), -INT8_C(   3), -INT8_C( 127), -INT8_C(   9), -INT8_C(  19),
+         INT8_C( 118), -INT8_C( 111), -INT8_C(  63),  INT8_C(  14), -INT8_C(  71), -INT8_C(  45), -INT8_C( 116), -INT8_C(  67),
+         INT8_C(   3), -INT8_C(  62),  INT8_C(  39), -INT8_C(  50),      INT8_MIN, -INT8_C(   9),  INT8_C(  53),  INT8_C(  40),
+        -INT8_C(  90), -INT8_C(  42),  INT8_C(  87), -INT8_C(  78), -INT8_C(  89),  INT8_C( 107),  INT8_C(  39), -INT8_C(  25),
+         INT8_C(  51),  INT8_C( 113),  INT8_C(  81), -INT8_C(  28),  INT8_C(  14),  INT8_C(  37),  INT8_C(  97),  INT8_C(  28),
+         INT8_C(  61),  INT8_C(  74),      INT8_MAX,  INT8_C( 117), -INT8_C( 103), -INT8_C(  38),  INT8_C(  71),  INT8_C(  28) },
+      { -INT8_C(  53), -INT8_C(   7),  INT8_C(  27), -INT8_C(  12), -INT8_C(   8), -INT8_C(  25), -INT8_C( 106), -INT8_C(   3),
+        -INT8_C( 127), -INT8_C( 111), -INT8_C(  45),      INT8_MIN, -INT8_C(   9),  INT8_C(  53), -INT8_C(  90), -INT8_C(  42),
+         INT8_C(  39),  INT8_C(  51),  INT8_C(  37),  INT8_C(  97),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 4523623394206796197),
+      { -INT8_C(  67), -INT8_C(  85), -INT8_C(  41),  INT8_C(   8), -INT8_C(  89),  INT8_C( 114),  INT8_C(  89), -INT8_C(   7),
+         INT8_C(  97), -INT8_C(  63),  INT8_C(  71),  INT8_C(  56),  INT8_C( 120),  INT8_C( 122),  INT8_C(   7),  INT8_C(  86),
+        -INT8_C(  62), -INT8_C(  65), -INT8_C(  53),  INT8_C(  26),  INT8_C(  20), -INT8_C(  70),  INT8_C(  25), -INT8_C(  17),
+         INT8_C(   0), -INT8_C(   5),  INT8_C( 121), -INT8_C( 121),  INT8_C(  76),  INT8_C(  55), -INT8_C(   2), -INT8_C(  43),
+        -INT8_C( 127), -INT8_C(  80),  INT8_C(  78), -INT8_C(  10), -INT8_C(  97),  INT8_C( 114),  INT8_C(  66),  INT8_C(  26),
+         INT8_C(  76),  INT8_C(  49), -INT8_C(  85),  INT8_C(  76),  INT8_C(  41),  INT8_C( 118), -INT8_C(  39), -INT8_C(  73),
+        -INT8_C(  62),  INT8_C(  99), -INT8_C( 101), -INT8_C(  66), -INT8_C(  49), -INT8_C( 100), -INT8_C(   7), -INT8_C(  21),
+        -INT8_C(  41),  INT8_C(  42),  INT8_C(  32), -INT8_C( 102), -INT8_C(  40),  INT8_C(  78),  INT8_C(   3),  INT8_C( 122) },
+      { -INT8_C(  67), -INT8_C(  41),  INT8_C( 114), -INT8_C(   7),  INT8_C(  97),  INT8_C(  56),  INT8_C(   7),  INT8_C(  86),
+        -INT8_C(  62), -INT8_C(  65), -INT8_C(  53),  INT8_C(  20),  INT8_C(  25),  INT8_C(   0),  INT8_C( 121), -INT8_C(  43),
+        -INT8_C(  80),  INT8_C(  26),  INT8_C(  76),  INT8_C(  49),  INT8_C( 118), -INT8_C(  62),  INT8_C(  99), -INT8_C( 101),
+        -INT8_C(   7), -INT8_C(  21),  INT8_C(  42),  INT8_C(  32), -INT8_C( 102), -INT8_C(  40),  INT8_C(  78),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 4467137346487713661),
+      { -INT8_C(  67), -INT8_C(  19),  INT8_C(  75),  INT8_C(  16),  INT8_C(  99),  INT8_C(   2), -INT8_C( 118), -INT8_C( 115),
+        -INT8_C(  16), -INT8_C(  24),  INT8_C(  11),  INT8_C(  59),  INT8_C(  29),  INT8_C(  16), -INT8_C(  74), -INT8_C( 113),
+         INT8_C(  24),  INT8_C(  51), -INT8_C(  43),  INT8_C(  68),  INT8_C(  52), -INT8_C(  94), -INT8_C(  48),  INT8_C(  10),
+        -INT8_C( 114), -INT8_C( 104), -INT8_C(  26), -INT8_C(  46), -INT8_C(  94), -INT8_C(  81), -INT8_C(  42), -INT8_C(  40),
+         INT8_C(  50),  INT8_C( 117), -INT8_C(  94),  INT8_C(  76),  INT8_C(  60),  INT8_C(  83), -INT8_C(  92),  INT8_C(  49),
+         INT8_C(  83), -INT8_C(   6),  INT8_C(  90), -INT8_C(  33), -INT8_C(   7), -INT8_C(  62), -INT8_C(  15),  INT8_C(  28),
+         INT8_C(  82),  INT8_C(  85), -INT8_C( 121),  INT8_C( 114), -INT8_C(  46),  INT8_C(  11),  INT8_C(  84), -INT8_C(  82),
+        -INT8_C(  91), -INT8_C( 102), -INT8_C( 103),  INT8_C( 123),  INT8_C(  38),  INT8_C(  14),  INT8_C(   1), -INT8_C(  80) },
+      { -INT8_C(  67),  INT8_C(  75),  INT8_C(  16),  INT8_C(  99),  INT8_C(   2), -INT8_C( 118), -INT8_C(  16), -INT8_C(  24),
+         INT8_C(  11),  INT8_C(  59),  INT8_C(  29),  INT8_C(  16), -INT8_C(  74), -INT8_C( 113),  INT8_C(  24),  INT8_C(  51),
+        -INT8_C(  43), -INT8_C(  48), -INT8_C(  26), -INT8_C(  46), -INT8_C(  81), -INT8_C(  40),  INT8_C(  50),  INT8_C( 117),
+        -INT8_C(  94),  INT8_C(  76),  INT8_C(  60),  INT8_C(  83),  INT8_C(  49),  INT8_C(  83),  INT8_C(  90), -INT8_C(   7),
+        -INT8_C(  62), -INT8_C(  15),  INT8_C(  85), -INT8_C( 121),  INT8_C( 114), -INT8_C(  46),  INT8_C(  11),  INT8_C(  84),
+        -INT8_C(  82), -INT8_C(  91), -INT8_C( 103),  INT8_C( 123),  INT8_C(  38),  INT8_C(  14),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(13864692312404532363),
+      { -INT8_C(  96), -INT8_C(  87),  INT8_C(  62),  INT8_C( 119),  INT8_C(  30), -INT8_C( 118),  INT8_C(  18), -INT8_C(  52),
+         INT8_C( 101), -INT8_C(  97),  INT8_C( 108),  INT8_C( 117), -INT8_C(  34),  INT8_C(  89), -INT8_C( 105), -INT8_C(  32),
+         INT8_C( 110),  INT8_C(  50), -INT8_C( 116), -INT8_C( 108), -INT8_C(  24),  INT8_C( 109),  INT8_C(  48),  INT8_C(  30),
+        -INT8_C( 112),  INT8_C(  65), -INT8_C(  55), -INT8_C(  24),  INT8_C(  48),  INT8_C(  14), -INT8_C(  53), -INT8_C(  22),
+        -INT8_C(   2),  INT8_C(  52),  INT8_C(  94), -INT8_C( 126),  INT8_C(  36),  INT8_C(  27),  INT8_C( 104), -INT8_C(  70),
+         INT8_C(   9), -INT8_C(  79),  INT8_C(  80),  INT8_C(   6), -INT8_C(  87), -INT8_C(   4),  INT8_C(   4), -INT8_C(  32),
+         INT8_C(  60), -INT8_C(  96),  INT8_C(  77), -INT8_C(  32), -INT8_C(  67), -INT8_C(  89),  INT8_C(  61),  INT8_C(  30),
+        -INT8_C(  67),  INT8_C( 110),  INT8_C(  79), -INT8_C(  91),  INT8_C(  65), -INT8_C(  83), -INT8_C(   2), -INT8_C(  93) },
+      { -INT8_C(  96), -INT8_C(  87),  INT8_C( 119), -INT8_C(  52),  INT8_C( 108),  INT8_C( 117), -INT8_C(  34),  INT8_C(  50),
+        -INT8_C( 116), -INT8_C(  24),  INT8_C( 109),  INT8_C(  48),  INT8_C(  30), -INT8_C(  24),  INT8_C(  14), -INT8_C(   2),
+         INT8_C(  52),  INT8_C(  36),  INT8_C(  27),  INT8_C(   6),  INT8_C(   4),  INT8_C(  60), -INT8_C(  32), -INT8_C(  89),
+         INT8_C(  61), -INT8_C(   2), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(15728840168503045665),
+      { -INT8_C( 100), -INT8_C(  20),  INT8_C(  17), -INT8_C(  75),  INT8_C(   8), -INT8_C(  33), -INT8_C( 121), -INT8_C(  97),
+        -INT8_C( 115), -INT8_C(  21),  INT8_C(  98),  INT8_C( 124), -INT8_C(  82), -INT8_C(  98), -INT8_C(  37),  INT8_C(  11),
+        -INT8_C( 120), -INT8_C(  14), -INT8_C(  86),  INT8_C(  65), -INT8_C( 117), -INT8_C(  30),  INT8_C(  87),  INT8_C(  95),
+        -INT8_C(  86),  INT8_C(  39), -INT8_C(  61), -INT8_C( 127),  INT8_C(  46),  INT8_C(  26),  INT8_C( 108),  INT8_C( 125),
+        -INT8_C(  87), -INT8_C( 127), -INT8_C(  97), -INT8_C(  57),  INT8_C(  89),  INT8_C( 111),  INT8_C(  15), -INT8_C(  15),
+        -INT8_C(  20), -INT8_C(  53), -INT8_C(  82),  INT8_C( 109), -INT8_C(  10),  INT8_C(  74),  INT8_C(  20),  INT8_C(  55),
+         INT8_C(  16),  INT8_C(  71),  INT8_C(  68),  INT8_C( 109), -INT8_C(  84),  INT8_C( 109), -INT8_C(  85), -INT8_C( 107),
+         INT8_C( 114), -INT8_C(   6), -INT8_C(  90), -INT8_C(   8), -INT8_C( 107),  INT8_C(  53),  INT8_C(  42),  INT8_C(   3) },
+      { -INT8_C( 100), -INT8_C(  33), -INT8_C(  21),  INT8_C(  98),  INT8_C( 124), -INT8_C(  98), -INT8_C(  37),  INT8_C(  11),
+        -INT8_C(  86),  INT8_C(  95), -INT8_C(  61), -INT8_C( 127),  INT8_C(  46),  INT8_C( 108), -INT8_C(  97), -INT8_C(  57),
+         INT8_C(  15), -INT8_C(  15), -INT8_C(  10),  INT8_C( 109), -INT8_C(  85), -INT8_C(   6), -INT8_C(   8), -INT8_C( 107),
+         INT8_C(  42),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(12338518864084397624),
+      {  INT8_C(  11), -INT8_C(  76),  INT8_C(  54),  INT8_C(  82), -INT8_C(  20),  INT8_C(  63),  INT8_C(  64),  INT8_C(  60),
+             INT8_MIN,  INT8_C(  27), -INT8_C(  37),  INT8_C(  75),  INT8_C( 125), -INT8_C(  59),  INT8_C(  94), -INT8_C( 123),
+         INT8_C(  27), -INT8_C(  83), -INT8_C( 115), -INT8_C(  51),  INT8_C(  35),  INT8_C(  21),  INT8_C(  92),  INT8_C( 100),
+        -INT8_C(  36), -INT8_C( 107),  INT8_C(  15), -INT8_C(  21),  INT8_C(   8), -INT8_C(  25), -INT8_C(  81), -INT8_C(  89),
+         INT8_C(  66),  INT8_C( 111),  INT8_C(   0), -INT8_C(  47),  INT8_C(  94),  INT8_C(  12), -INT8_C(  62),  INT8_C(   2),
+         INT8_C(  53),  INT8_C(  60),  INT8_C( 112), -INT8_C(  49),  INT8_C(   9), -INT8_C(   9),  INT8_C(  11),  INT8_C( 116),
+         INT8_C( 122),  INT8_C(  41),  INT8_C(  51), -INT8_C(  68),  INT8_C(  84),  INT8_C(  21), -INT8_C( 112),  INT8_C(  67),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  48),  INT8_C(  55),  INT8_C(  55),  INT8_C(  22), -INT8_C( 118),  INT8_C(  44) },
+      {  INT8_C(  82), -INT8_C(  20),  INT8_C(  63),  INT8_C(  27), -INT8_C(  37),  INT8_C(  75), -INT8_C(  59),  INT8_C(  94),
+        -INT8_C( 123), -INT8_C( 115),  INT8_C(  35),  INT8_C(  21),  INT8_C(  15), -INT8_C(  21),  INT8_C(   8), -INT8_C(  81),
+        -INT8_C(  89), -INT8_C(  47),  INT8_C(   2),  INT8_C(  53), -INT8_C(  49),  INT8_C(   9), -INT8_C(   9),  INT8_C( 122),
+         INT8_C(  41), -INT8_C(  68),  INT8_C(  84),  INT8_C(  21),  INT8_C(   2), -INT8_C( 127),  INT8_C(  55),  INT8_C(  22),
+         INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(16090319816499413279),
+      { -INT8_C(  20),  INT8_C(  26),  INT8_C(  43),  INT8_C(  26),  INT8_C(  59), -INT8_C(  53),  INT8_C(  53), -INT8_C(  62),
+        -INT8_C(  98),  INT8_C( 107), -INT8_C(   4), -INT8_C(   2), -INT8_C( 127),  INT8_C(  13), -INT8_C(  98), -INT8_C(  55),
+         INT8_C(  70), -INT8_C( 120),  INT8_C(  86),  INT8_C(  37), -INT8_C(  63),  INT8_C(  45),  INT8_C(  11), -INT8_C(  38),
+        -INT8_C(  26), -INT8_C(  42), -INT8_C( 127), -INT8_C(  55), -INT8_C( 106), -INT8_C(  83), -INT8_C(  49),  INT8_C(  83),
+        -INT8_C( 120), -INT8_C(  98),  INT8_C(  21), -INT8_C(  32), -INT8_C( 109),  INT8_C(  16), -INT8_C(  28),  INT8_C(  46),
+        -INT8_C(  54), -INT8_C( 120), -INT8_C(  61), -INT8_C(  18), -INT8_C(  29), -INT8_C(  61), -INT8_C(  61), -INT8_C( 123),
+        -INT8_C(  68),  INT8_C(  40),  INT8_C(  28), -INT8_C(  36),  INT8_C(  75), -INT8_C(  32), -INT8_C(  48), -INT8_C(  99),
+        -INT8_C(  49), -INT8_C(  31),  INT8_C(   8),  INT8_C(  25), -INT8_C(  61), -INT8_C( 109),  INT8_C(  53),  INT8_C(  52) },
+      { -INT8_C(  20),  INT8_C(  26),  INT8_C(  43),  INT8_C(  26),  INT8_C(  59), -INT8_C(  98), -INT8_C(  98),  INT8_C(  45),
+         INT8_C(  11), -INT8_C(  38), -INT8_C(  55), -INT8_C( 106), -INT8_C(  83), -INT8_C(  49), -INT8_C( 120), -INT8_C(  98),
+         INT8_C(  21), -INT8_C(  32), -INT8_C( 109),  INT8_C(  46), -INT8_C(  61), -INT8_C(  18), -INT8_C(  61),  INT8_C(  28),
+        -INT8_C(  36), -INT8_C(  48), -INT8_C(  49), -INT8_C(  31),  INT8_C(   8),  INT8_C(  25), -INT8_C(  61),  INT8_C(  53),
+         INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 2592916484308094996),
+      {  INT8_C(  71),  INT8_C(  49), -INT8_C(  88), -INT8_C( 113),  INT8_C(  25),  INT8_C(  56),  INT8_C(  15), -INT8_C(  38),
+         INT8_C(  26),      INT8_MIN, -INT8_C(  69), -INT8_C( 118),  INT8_C(  97),  INT8_C( 112), -INT8_C(  21), -INT8_C(  52),
+        -INT8_C(  30),  INT8_C( 103),  INT8_C(  31),  INT8_C(  34), -INT8_C(  54),  INT8_C(  45), -INT8_C(  90),  INT8_C(  48),
+        -INT8_C(  79),  INT8_C(  68), -INT8_C(  94), -INT8_C( 120),  INT8_C(   8),  INT8_C(  57),  INT8_C(  42),  INT8_C(  91),
+        -INT8_C(  52),  INT8_C( 114), -INT8_C(  22), -INT8_C( 102), -INT8_C(  92), -INT8_C(  42), -INT8_C(  54),  INT8_C(  81),
+         INT8_C(  23),  INT8_C(  49),  INT8_C( 104), -INT8_C(  58),  INT8_C(  56), -INT8_C(  52),  INT8_C(  35),  INT8_C(  77),
+         INT8_C( 113),  INT8_C( 120), -INT8_C(  35),  INT8_C(  43), -INT8_C(  19), -INT8_C(  66), -INT8_C(  61), -INT8_C(  23),
+        -INT8_C(  37), -INT8_C(  62), -INT8_C( 121),  INT8_C(  69),  INT8_C(  29), -INT8_C(   3),  INT8_C(  32), -INT8_C(  57) },
+      { -INT8_C(  88),  INT8_C(  25),  INT8_C(  97), -INT8_C(  21), -INT8_C(  54),  INT8_C(  45), -INT8_C(  90), -INT8_C(  79),
+         INT8_C(  68), -INT8_C( 120),  INT8_C(   8),  INT8_C(  57),  INT8_C(  42),  INT8_C(  91), -INT8_C(  52), -INT8_C(  22),
+        -INT8_C( 102), -INT8_C(  54),  INT8_C(  81),  INT8_C(  23),  INT8_C(  49), -INT8_C(  52),  INT8_C(  35),  INT8_C(  77),
+         INT8_C( 113),  INT8_C( 120),  INT8_C(  43), -INT8_C(  19), -INT8_C(  66), -INT8_C(  61), -INT8_C(  23), -INT8_C(  37),
+        -INT8_C(  62), -INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  71), -INT8_C(  51),  INT8_C(  12), -INT8_C( 111),  INT8_C( 120), -INT8_C(  32), -INT8_C(  28),  INT8_C(  37),
+        -INT8_C( 114), -INT8_C( 122),  INT8_C( 100),  INT8_C(  26), -INT8_C(  53),  INT8_C(  51),  INT8_C(  43), -INT8_C(  24),
+        -INT8_C(  41),  INT8_C( 117), -INT8_C(  41),  INT8_C(   6), -INT8_C(  39), -INT8_C(  48), -INT8_C(  23), -INT8_C(  20),
+        -INT8_C(  76),  INT8_C(  83), -INT8_C(  40),  INT8_C(  45),  INT8_C(  49), -INT8_C(  57),  INT8_C( 124), -INT8_C(  37),
+        -INT8_C( 100),  INT8_C(  78), -INT8_C(  24), -INT8_C(  92),  INT8_C(  23), -INT8_C( 106),  INT8_C(  88), -INT8_C(  66),
+         INT8_C( 126),  INT8_C( 112), -INT8_C(  61), -INT8_C(  59),  INT8_C(  93),  INT8_C( 106), -INT8_C(  85), -INT8_C(  29),
+        -INT8_C(  44), -INT8_C( 119), -INT8_C(  86), -INT8_C(  23),  INT8_C(  89),  INT8_C(  85),  INT8_C(  52),  INT8_C( 119),
+         INT8_C(  96),  INT8_C(  10),  INT8_C(  87), -INT8_C(  10),  INT8_C(  94), -INT8_C( 104),  INT8_C(  47),  INT8_C(  77) },
+      UINT64_C(16867308157932998336),
+      {  INT8_C(  91), -INT8_C(  76), -INT8_C(  84), -INT8_C(  60),  INT8_C(  14),  INT8_C(  32), -INT8_C(  91), -INT8_C(  12),
+        -INT8_C(  97),  INT8_C(  69),  INT8_C(   3),  INT8_C( 100),  INT8_C(  86), -INT8_C(  11),  INT8_C(  41),  INT8_C(  10),
+        -INT8_C(  38),  INT8_C( 105), -INT8_C(  36), -INT8_C( 109), -INT8_C(  46), -INT8_C(  24), -INT8_C(  45),  INT8_C(  20),
+         INT8_C(  64),  INT8_C(  56),  INT8_C(  37), -INT8_C(  72),  INT8_C(  95), -INT8_C(  41), -INT8_C(  89), -INT8_C( 102),
+         INT8_C(  87),  INT8_C( 123), -INT8_C(  68),  INT8_C(  63), -INT8_C(  21), -INT8_C(  31),  INT8_C(  14), -INT8_C(   1),
+         INT8_C( 114),  INT8_C(  42),  INT8_C( 102), -INT8_C(  81),  INT8_C(  93), -INT8_C(  59), -INT8_C( 116), -INT8_C( 101),
+         INT8_C(  17),  INT8_C( 103), -INT8_C(  22), -INT8_C(  98), -INT8_C(   5), -INT8_C(  32), -INT8_C(  83), -INT8_C(   8),
+        -INT8_C(  75), -INT8_C(  57), -INT8_C(  98), -INT8_C( 124), -INT8_C(  14), -INT8_C( 115),  INT8_C(  30), -INT8_C(  67) },
+      { -INT8_C(  91), -INT8_C(  12),  INT8_C(  69),  INT8_C(   3),  INT8_C( 100), -INT8_C(  38), -INT8_C(  36), -INT8_C(  24),
+         INT8_C(  20),  INT8_C(  56),  INT8_C(  37), -INT8_C(  72),  INT8_C(  95),  INT8_C(  87),  INT8_C( 123), -INT8_C(  68),
+        -INT8_C(  31),  INT8_C(  14),  INT8_C( 114),  INT8_C(  42),  INT8_C( 102),  INT8_C(  93), -INT8_C(  59), -INT8_C( 101),
+        -INT8_C(  22), -INT8_C(   5), -INT8_C(  57), -INT8_C( 124), -INT8_C( 115),  INT8_C(  30), -INT8_C(  67), -INT8_C(  37),
+        -INT8_C( 100),  INT8_C(  78), -INT8_C(  24), -INT8_C(  92),  INT8_C(  23), -INT8_C( 106),  INT8_C(  88), -INT8_C(  66),
+         INT8_C( 126),  INT8_C( 112), -INT8_C(  61), -INT8_C(  59),  INT8_C(  93),  INT8_C( 106), -INT8_C(  85), -INT8_C(  29),
+        -INT8_C(  44), -INT8_C( 119), -INT8_C(  86), -INT8_C(  23),  INT8_C(  89),  INT8_C(  85),  INT8_C(  52),  INT8_C( 119),
+         INT8_C(  96),  INT8_C(  10),  INT8_C(  87), -INT8_C(  10),  INT8_C(  94), -INT8_C( 104),  INT8_C(  47),  INT8_C(  77) } },
+    { { -INT8_C(  50), -INT8_C(  60),  INT8_C( 113),  INT8_C(  82),      INT8_MIN,  INT8_C( 119),  INT8_C(  12), -INT8_C(  21),
+         INT8_C(   9), -INT8_C(  97), -INT8_C(  48),  INT8_C(  98), -INT8_C(  55), -INT8_C( 125),  INT8_C(  21), -INT8_C( 122),
+         INT8_C(  97),  INT8_C(  66),  INT8_C( 100),  INT8_C(  59),  INT8_C(  12),  INT8_C( 113),  INT8_C(  92), -INT8_C(  74),
+        -INT8_C(  23), -INT8_C(  93), -INT8_C( 102),  INT8_C(  70),  INT8_C( 121),  INT8_C( 107),  INT8_C(  59), -INT8_C(  61),
+        -INT8_C(  38), -INT8_C(  46),  INT8_C(  50), -INT8_C(  62), -INT8_C( 124), -INT8_C(  64), -INT8_C( 109), -INT8_C(  84),
+         INT8_C(  39), -INT8_C(  23),  INT8_C(  36),  INT8_C(  80),  INT8_C(  58),  INT8_C(   8),  INT8_C(  12), -INT8_C(  35),
+        -INT8_C(  75),  INT8_C(  46),  INT8_C(  95),  INT8_C(   6), -INT8_C(  27), -INT8_C(  72), -INT8_C(  86),  INT8_C(  58),
+        -INT8_C(  58), -INT8_C( 118), -INT8_C(  46), -INT8_C(  37),      INT8_MAX,  INT8_C(  26), -INT8_C(  56), -INT8_C(  55) },
+      UINT64_C( 1554114536362612240),
+      {  INT8_C( 125), -INT8_C( 126), -INT8_C(  24), -INT8_C(  74), -INT8_C(  80),  INT8_C(  37), -INT8_C(  56),  INT8_C(  74),
+         INT8_C(  56),  INT8_C(  87), -INT8_C(  33), -INT8_C(  95),  INT8_C(  69),  INT8_C(  87),  INT8_C(  88),  INT8_C(  15),
+        -INT8_C(  16), -INT8_C( 115),  INT8_C(  25), -INT8_C(  11),  INT8_C(  82),  INT8_C(  68),  INT8_C( 114), -INT8_C( 115),
+         INT8_C(   1), -INT8_C(  98), -INT8_C(  90), -INT8_C(  87),  INT8_C(  87),  INT8_C(  46),  INT8_C(  71), -INT8_C(  22),
+        -INT8_C(  45),  INT8_C(  62), -INT8_C(  74),  INT8_C(  22),  INT8_C( 102),  INT8_C(  28),  INT8_C(  60), -INT8_C(  58),
+         INT8_C(  17), -INT8_C( 112), -INT8_C( 110), -INT8_C( 117), -INT8_C(  50), -INT8_C(   3), -INT8_C(  20),  INT8_C( 123),
+        -INT8_C(  22), -INT8_C(  31),  INT8_C(  62), -INT8_C(  48), -INT8_C(  46), -INT8_C(  86),  INT8_C( 104), -INT8_C(  36),
+         INT8_C( 125),  INT8_C(  51), -INT8_C(  23),  INT8_C(  50), -INT8_C(   9), -INT8_C( 101), -INT8_C( 111),  INT8_C(  67) },
+      { -INT8_C(  80),  INT8_C(  87), -INT8_C(  33),  INT8_C(  69), -INT8_C( 115), -INT8_C(  11),  INT8_C(  68),  INT8_C(  87),
+         INT8_C(  71), -INT8_C(  22), -INT8_C(  45),  INT8_C(  62), -INT8_C(  74),  INT8_C(  22),  INT8_C(  28),  INT8_C(  60),
+        -INT8_C(  58), -INT8_C( 112), -INT8_C(  50), -INT8_C(  20), -INT8_C(  22), -INT8_C(  46), -INT8_C(  36),  INT8_C( 125),
+        -INT8_C(  23), -INT8_C(   9), -INT8_C( 102),  INT8_C(  70),  INT8_C( 121),  INT8_C( 107),  INT8_C(  59), -INT8_C(  61),
+        -INT8_C(  38), -INT8_C(  46),  INT8_C(  50), -INT8_C(  62), -INT8_C( 124), -INT8_C(  64), -INT8_C( 109), -INT8_C(  84),
+         INT8_C(  39), -INT8_C(  23),  INT8_C(  36),  INT8_C(  80),  INT8_C(  58),  INT8_C(   8),  INT8_C(  12), -INT8_C(  35),
+        -INT8_C(  75),  INT8_C(  46),  INT8_C(  95),  INT8_C(   6), -INT8_C(  27), -INT8_C(  72), -INT8_C(  86),  INT8_C(  58),
+        -INT8_C(  58), -INT8_C( 118), -INT8_C(  46), -INT8_C(  37),      INT8_MAX,  INT8_C(  26), -INT8_C(  56), -INT8_C(  55) } },
+    { { -INT8_C(  29), -INT8_C(  23),  INT8_C(  93),  INT8_C(  17), -INT8_C(   3), -INT8_C(   2),  INT8_C(  17),  INT8_C(   4),
+         INT8_C(  79),  INT8_C(  25),  INT8_C(  10), -INT8_C(  69), -INT8_C( 119), -INT8_C(  57), -INT8_C( 102),  INT8_C(  57),
+         INT8_C(  23), -INT8_C(  43),  INT8_C(  82),  INT8_C(  16), -INT8_C( 103),  INT8_C(  35), -INT8_C(  60),  INT8_C( 118),
+         INT8_C( 104), -INT8_C(  82),  INT8_C( 116),  INT8_C( 121), -INT8_C(  65), -INT8_C( 125),  INT8_C( 121), -INT8_C( 113),
+         INT8_C(  88),  INT8_C( 120),  INT8_C(  10), -INT8_C(   5), -INT8_C(  26),  INT8_C(  50),  INT8_C(  44), -INT8_C(  30),
+        -INT8_C(   1),  INT8_C( 100), -INT8_C(  63), -INT8_C(  69),  INT8_C( 119), -INT8_C(  40), -INT8_C(  14),  INT8_C(  50),
+         INT8_C(  12),  INT8_C(  30), -INT8_C(  74),  INT8_C( 119), -INT8_C(  13), -INT8_C(  81), -INT8_C(  76),  INT8_C( 111),
+         INT8_C(  33),  INT8_C(  55),  INT8_C(  80), -INT8_C(  78), -INT8_C(  92), -INT8_C( 100),  INT8_C(  71),  INT8_C(  12) },
+      UINT64_C( 7390473497111210219),
+      { -INT8_C( 112),  INT8_C(  57),  INT8_C( 124), -INT8_C(  95), -INT8_C(  55), -INT8_C(   3), -INT8_C(   8),  INT8_C(  47),
+             INT8_MAX, -INT8_C(  62),  INT8_C(  92),  INT8_C(   5),  INT8_C(  51),  INT8_C(   7), -INT8_C(  73),  INT8_C(  97),
+         INT8_C( 107), -INT8_C(  74),  INT8_C(  56),  INT8_C(  88),  INT8_C(  34),  INT8_C( 102), -INT8_C(  99), -INT8_C(  24),
+        -INT8_C(  53),  INT8_C(  73), -INT8_C(  32), -INT8_C(  53),  INT8_C(  99),  INT8_C(  49),  INT8_C(  70),  INT8_C(  24),
+             INT8_MIN, -INT8_C(  31),  INT8_C(  98), -INT8_C(  34),  INT8_C(  81), -INT8_C(  18),  INT8_C(  62),  INT8_C(  87),
+        -INT8_C( 115), -INT8_C(  41),  INT8_C(  80), -INT8_C(  67),  INT8_C(  58),  INT8_C(  70),  INT8_C( 126), -INT8_C(  62),
+        -INT8_C(   3), -INT8_C(  96), -INT8_C(  74),  INT8_C( 117), -INT8_C(  21), -INT8_C(  30),  INT8_C( 126), -INT8_C(  52),
+         INT8_C(  64),  INT8_C(  99), -INT8_C(  62),  INT8_C( 108),  INT8_C( 126), -INT8_C(  88),  INT8_C(  90), -INT8_C(  12) },
+      { -INT8_C( 112),  INT8_C(  57), -INT8_C(  95), -INT8_C(   3), -INT8_C(   8),  INT8_C(  47),  INT8_C(   5),  INT8_C(   7),
+         INT8_C(  97), -INT8_C(  99), -INT8_C(  53), -INT8_C(  32), -INT8_C(  53),  INT8_C(  99),  INT8_C(  49),      INT8_MIN,
+         INT8_C(  98), -INT8_C(  34),  INT8_C(  81), -INT8_C(  18),  INT8_C(  62),  INT8_C(  80), -INT8_C(  67),  INT8_C(  58),
+         INT8_C(  70), -INT8_C(  21), -INT8_C(  52),  INT8_C(  99), -INT8_C(  62), -INT8_C(  88),  INT8_C(  90), -INT8_C( 113),
+         INT8_C(  88),  INT8_C( 120),  INT8_C(  10), -INT8_C(   5), -INT8_C(  26),  INT8_C(  50),  INT8_C(  44), -INT8_C(  30),
+        -INT8_C(   1),  INT8_C( 100), -INT8_C(  63), -INT8_C(  69),  INT8_C( 119), -INT8_C(  40), -INT8_C(  14),  INT8_C(  50),
+         INT8_C(  12),  INT8_C(  30), -INT8_C(  74),  INT8_C( 119), -INT8_C(  13), -INT8_C(  81), -INT8_C(  76),  INT8_C( 111),
+         INT8_C(  33),  INT8_C(  55),  INT8_C(  80), -INT8_C(  78), -INT8_C(  92), -INT8_C( 100),  INT8_C(  71),  INT8_C(  12) } },
+    { { -INT8_C(  59),  INT8_C(  60),  INT8_C( 102), -INT8_C(  92),  INT8_C( 122), -INT8_C(  68),  INT8_C(  56), -INT8_C(  17),
+         INT8_C(  45),  INT8_C( 109), -INT8_C( 127), -INT8_C(  96),  INT8_C(  74),  INT8_C(  27), -INT8_C(  12),  INT8_C(  50),
+        -INT8_C( 102),  INT8_C( 103),  INT8_C(  93),  INT8_C( 119),  INT8_C(  58),  INT8_C(  77), -INT8_C( 119),  INT8_C(  88),
+         INT8_C(  68),  INT8_C(  48), -INT8_C(  23),  INT8_C(  87),  INT8_C(   9), -INT8_C(  76), -INT8_C(  53), -INT8_C(   7),
+        -INT8_C(  54), -INT8_C(  73),  INT8_C(  90),  INT8_C(  57),  INT8_C(  54), -INT8_C(  66),  INT8_C(  81), -INT8_C(  81),
+        -INT8_C(  72), -INT8_C(  90),  INT8_C( 116), -INT8_C( 110),  INT8_C( 119), -INT8_C( 127),  INT8_C(  36), -INT8_C(  67),
+         INT8_C( 105),  INT8_C( 108),  INT8_C(  83), -INT8_C(  89), -INT8_C(  71),  INT8_C(  53),  INT8_C( 118), -INT8_C(  27),
+        -INT8_C(  40), -INT8_C(  87),  INT8_C( 106),  INT8_C(   4),  INT8_C(  51), -INT8_C(  57),  INT8_C(  72),  INT8_C(  95) },
+      UINT64_C(12662996105808281598),
+      {  INT8_C(  31), -INT8_C(  64),  INT8_C(   8), -INT8_C(  13), -INT8_C(  35), -INT8_C(  82),  INT8_C(  35), -INT8_C(  44),
+        -INT8_C( 127),  INT8_C(  44),  INT8_C(  71),  INT8_C(  44), -INT8_C(  68),  INT8_C(  55),  INT8_C(  51), -INT8_C(  16),
+         INT8_C(  90),  INT8_C( 117), -INT8_C(   4), -INT8_C(  84),  INT8_C(  22),  INT8_C(   6), -INT8_C(  53),  INT8_C(  17),
+         INT8_C(  92),  INT8_C(  54), -INT8_C( 121),  INT8_C(  23),  INT8_C(  93),  INT8_C( 126),  INT8_C(  87),  INT8_C(  69),
+         INT8_C(   1), -INT8_C(  47), -INT8_C( 102),  INT8_C(  92),  INT8_C(  30), -INT8_C(  72),  INT8_C(  32), -INT8_C(  66),
+        -INT8_C(   3),  INT8_C(  87),  INT8_C(  30), -INT8_C(   8),  INT8_C( 126),  INT8_C(  42),  INT8_C(  37),  INT8_C(  15),
+        -INT8_C(  62),  INT8_C(  15), -INT8_C(  47), -INT8_C(  15), -INT8_C(  69), -INT8_C(  86), -INT8_C(  89),  INT8_C(   6),
+        -INT8_C(  28),  INT8_C( 108),  INT8_C( 124),  INT8_C(  13), -INT8_C(   1), -INT8_C(  67),  INT8_C(  67), -INT8_C(  69) },
+      { -INT8_C(  64),  INT8_C(   8), -INT8_C(  13), -INT8_C(  35), -INT8_C(  82),  INT8_C(  35), -INT8_C(  44), -INT8_C( 127),
+         INT8_C(  44),  INT8_C(  71),  INT8_C(  44), -INT8_C(  68),  INT8_C(  55),  INT8_C(  51),  INT8_C(  90),  INT8_C( 117),
+        -INT8_C(  84),  INT8_C(  22), -INT8_C(  53),  INT8_C(  17),  INT8_C(  54), -INT8_C( 121),  INT8_C( 126),  INT8_C(  87),
+         INT8_C(  69),  INT8_C(   1), -INT8_C( 102),  INT8_C(  92),  INT8_C(  30),  INT8_C(  32), -INT8_C(  66), -INT8_C(   3),
+         INT8_C(  87),  INT8_C(  30), -INT8_C(   8),  INT8_C( 126),  INT8_C(  42),  INT8_C(  37),  INT8_C(  15), -INT8_C(  62),
+         INT8_C(  15), -INT8_C(  15), -INT8_C(  69), -INT8_C(  86),  INT8_C(   6), -INT8_C(  28),  INT8_C( 108),  INT8_C( 124),
+         INT8_C(  13), -INT8_C(  67), -INT8_C(  69), -INT8_C(  89), -INT8_C(  71),  INT8_C(  53),  INT8_C( 118), -INT8_C(  27),
+        -INT8_C(  40), -INT8_C(  87),  INT8_C( 106),  INT8_C(   4),  INT8_C(  51), -INT8_C(  57),  INT8_C(  72),  INT8_C(  95) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    int8_t r[64];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm512_mask_compressstoreu_epi8(r, test_vec[i].k, a);
+    simde_assert_equal_vi8(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C( 25610),  INT16_C( 20336), -INT16_C( 30477),  INT16_C(  7295), -INT16_C( 12441), -INT16_C(  6456),  INT16_C( 12898),  INT16_C( 24886),
+        -INT16_C( 26287),  INT16_C( 11805), -INT16_C( 13792),  INT16_C(  7755),  INT16_C( 21773), -INT16_C(  4408),  INT16_C( 26953),  INT16_C( 23390),
+         INT16_C( 19920), -INT16_C(  3007), -INT16_C( 12480),  INT16_C( 11988), -INT16_C(  3142),  INT16_C( 30062), -INT16_C(  1832),  INT16_C(  1086),
+        -INT16_C(   720), -INT16_C( 17244),  INT16_C(  3746),  INT16_C( 17736),  INT16_C( 15012), -INT16_C( 23975),  INT16_C( 13823), -INT16_C(  3605) },
+      UINT32_C( 237501209),
+      { -INT16_C(  7144),  INT16_C(  3656), -INT16_C(   220),  INT16_C( 22238),  INT16_C( 28808), -INT16_C( 26931),  INT16_C( 13218),  INT16_C( 17660),
+        -INT16_C( 25952),  INT16_C( 14551), -INT16_C(  7437),  INT16_C( 19608), -INT16_C(  5548), -INT16_C( 17780), -INT16_C( 17812),  INT16_C(  5306),
+        -INT16_C( 24560),  INT16_C( 18738), -INT16_C(  3556), -INT16_C(  8027), -INT16_C( 15030), -INT16_C( 11431), -INT16_C(  4880), -INT16_C( 15441),
+         INT16_C(  8894), -INT16_C( 16409), -INT16_C( 23161),  INT16_C( 29415),  INT16_C( 10164),  INT16_C( 30930),  INT16_C(  8666), -INT16_C(  1235) },
+      { -INT16_C(  7144),  INT16_C( 22238),  INT16_C( 28808), -INT16_C( 25952),  INT16_C( 14551),  INT16_C( 19608), -INT16_C(  5548), -INT16_C( 17780),
+        -INT16_C( 17812),  INT16_C(  5306), -INT16_C( 24560),  INT16_C( 18738), -INT16_C(  3556), -INT16_C( 11431), -INT16_C( 16409), -INT16_C( 23161),
+         INT16_C( 29415), -INT16_C(  3007), -INT16_C( 12480),  INT16_C( 11988), -INT16_C(  3142),  INT16_C( 30062), -INT16_C(  1832),  INT16_C(  1086),
+        -INT16_C(   720), -INT16_C( 17244),  INT16_C(  3746),  INT16_C( 17736),  INT16_C( 15012), -INT16_C( 23975),  INT16_C( 13823), -INT16_C(  3605) } },
+    { { -INT16_C( 25306), -INT16_C(  9673), -INT16_C( 16138), -INT16_C( 28041),  INT16_C( 24135),  INT16_C( 24759), -INT16_C(  2059),  INT16_C( 12728),
+         INT16_C( 26110),  INT16_C( 20612), -INT16_C( 19476),  INT16_C( 26878), -INT16_C(   397), -INT16_C( 19515), -INT16_C( 13247), -INT16_C( 19303),
+         INT16_C(  1944),  INT16_C(  2145), -INT16_C(  5903), -INT16_C( 21494), -INT16_C(  2707), -INT16_C( 19019),  INT16_C( 16678),  INT16_C( 12599),
+        -INT16_C( 23434),  INT16_C( 15522), -INT16_C(  7105), -INT16_C(  4906),  INT16_C( 17380), -INT16_C(  7700),  INT16_C( 17302), -INT16_C( 29705) },
+      UINT32_C(4287778773),
+      { -INT16_C( 23854),  INT16_C( 20948),  INT16_C(  6504),  INT16_C( 25350), -INT16_C(  1603), -INT16_C(  5273),  INT16_C(  9009), -INT16_C( 13976),
+         INT16_C( 10068), -INT16_C( 17206),  INT16_C(  6471), -INT16_C(  5032), -INT16_C(  4928),  INT16_C(  9759),  INT16_C( 27388),  INT16_C(  1533),
+        -INT16_C(  5504), -INT16_C(  5338), -INT16_C(  4226),  INT16_C( 18212),  INT16_C( 20291),  INT16_C(   335),  INT16_C(  8867),  INT16_C( 31804),
+        -INT16_C(  2185),  INT16_C( 13397),  INT16_C( 18827),  INT16_C( 20063), -INT16_C( 25126), -INT16_C(  3336), -INT16_C(  9740), -INT16_C( 23342) },
+      { -INT16_C( 23854),  INT16_C(  6504), -INT16_C(  1603),  INT16_C(  9009), -INT16_C( 13976),  INT16_C( 10068), -INT16_C( 17206),  INT16_C(  6471),
+        -INT16_C(  5032),  INT16_C( 27388), -INT16_C(  5338),  INT16_C( 20291),  INT16_C( 31804), -INT16_C(  2185),  INT16_C( 13397),  INT16_C( 18827),
+         INT16_C( 20063), -INT16_C( 25126), -INT16_C(  3336), -INT16_C(  9740), -INT16_C( 23342), -INT16_C( 19019),  INT16_C( 16678),  INT16_C( 12599),
+        -INT16_C( 23434),  INT16_C( 15522), -INT16_C(  7105), -INT16_C(  4906),  INT16_C( 17380), -INT16_C(  7700),  INT16_C( 17302), -INT16_C( 29705) } },
+    { {  INT16_C( 19427),  INT16_C(  6974),  INT16_C( 16691),  INT16_C( 16978), -INT16_C( 31124),  INT16_C(  6015), -INT16_C(  4578), -INT16_C( 10873),
+         INT16_C( 22088),  INT16_C( 27933), -INT16_C(  3276), -INT16_C( 13634), -INT16_C( 27540), -INT16_C( 25799),  INT16_C(  3631), -INT16_C( 28856),
+        -INT16_C( 14850),  INT16_C( 25027),  INT16_C(  6448),  INT16_C( 22286),  INT16_C( 23013),  INT16_C(  6823),  INT16_C( 17012), -INT16_C( 11294),
+        -INT16_C( 18079), -INT16_C(   376),  INT16_C( 30187), -INT16_C( 12648), -INT16_C(  8524),  INT16_C( 11912),  INT16_C( 20101),  INT16_C( 13940) },
+      UINT32_C(1785205531),
+      { -INT16_C(   121), -INT16_C( 21570), -INT16_C( 28657),  INT16_C(  3079),  INT16_C( 14749),  INT16_C(  2014), -INT16_C(  5085),  INT16_C(  8743),
+         INT16_C(  4172), -INT16_C( 16698), -INT16_C( 17743), -INT16_C( 29905), -INT16_C( 23637),  INT16_C(  5093), -INT16_C(   685), -INT16_C(  7949),
+        -INT16_C( 25106), -INT16_C( 23229),  INT16_C( 25030), -INT16_C( 27264), -INT16_C( 13455), -INT16_C( 18858),  INT16_C( 26071), -INT16_C( 11284),
+         INT16_C( 26334),  INT16_C( 28034), -INT16_C( 19559), -INT16_C( 23176),  INT16_C(  2448),  INT16_C( 21842),  INT16_C( 31945), -INT16_C( 23558) },
+      { -INT16_C(   121), -INT16_C( 21570),  INT16_C(  3079),  INT16_C( 14749),  INT16_C(  4172), -INT16_C( 16698), -INT16_C( 23637), -INT16_C( 27264),
+        -INT16_C( 18858),  INT16_C( 26071),  INT16_C( 28034), -INT16_C( 23176),  INT16_C( 21842),  INT16_C( 31945),  INT16_C(  3631), -INT16_C( 28856),
+        -INT16_C( 14850),  INT16_C( 25027),  INT16_C(  6448),  INT16_C( 22286),  INT16_C( 23013),  INT16_C(  6823),  INT16_C( 17012), -INT16_C( 11294),
+        -INT16_C( 18079), -INT16_C(   376),  INT16_C( 30187), -INT16_C( 12648), -INT16_C(  8524),  INT16_C( 11912),  INT16_C( 20101),  INT16_C( 13940) } },
+    { {  INT16_C( 18703), -INT16_C( 18477), -INT16_C(  4706),  INT16_C( 12566), -INT16_C( 30567), -INT16_C( 21312), -INT16_C( 28995), -INT16_C( 19344),
+         INT16_C( 12160),  INT16_C(  5030), -INT16_C( 20127),  INT16_C( 22907), -INT16_C(  1740), -INT16_C( 15418), -INT16_C(  3280), -INT16_C( 13314),
+         INT16_C( 31204), -INT16_C( 13153),  INT16_C(    17),  INT16_C(  9888),  INT16_C(   223),  INT16_C( 12394),  INT16_C( 26047),  INT16_C( 32282),
+        -INT16_C( 10278),  INT16_C( 27369), -INT16_C(  3144),  INT16_C(  1457),  INT16_C( 20542),  INT16_C( 26485), -INT16_C( 13933),  INT16_C(  8409) },
+      UINT32_C(2550136807),
+      { -INT16_C(  7857),  INT16_C(  5845), -INT16_C( 19377), -INT16_C(  6285), -INT16_C( 30993), -INT16_C( 10705), -INT16_C( 16901), -INT16_C(  5049),
+        -INT16_C( 17929), -INT16_C( 16225),  INT16_C( 31403),  INT16_C( 27732), -INT16_C(  7719), -INT16_C(  2053), -INT16_C( 11650),  INT16_C( 23158),
+         INT16_C( 18382),  INT16_C( 32302),  INT16_C( 30265), -INT16_C( 20719), -INT16_C( 30201), -INT16_C( 28645),  INT16_C( 14192),  INT16_C( 14375),
+        -INT16_C(  1141),  INT16_C(  1101), -INT16_C(  6268), -INT16_C( 14850),  INT16_C(   950),  INT16_C( 28209), -INT16_C( 23641),  INT16_C( 23916) },
+      { -INT16_C(  7857),  INT16_C(  5845), -INT16_C( 19377), -INT16_C( 10705), -INT16_C( 16901), -INT16_C(  5049), -INT16_C( 17929), -INT16_C( 16225),
+         INT16_C( 31403),  INT16_C( 27732), -INT16_C(  7719), -INT16_C(  2053), -INT16_C( 11650),  INT16_C( 23158),  INT16_C( 18382),  INT16_C( 32302),
+         INT16_C( 30265), -INT16_C( 20719), -INT16_C( 30201), -INT16_C( 28645),  INT16_C( 14192),  INT16_C( 14375), -INT16_C(  1141),  INT16_C(  1101),
+        -INT16_C(  6268),  INT16_C(   950),  INT16_C( 23916),  INT16_C(  1457),  INT16_C( 20542),  INT16_C( 26485), -INT16_C( 13933),  INT16_C(  8409) } },
+    { { -INT16_C(  4215), -INT16_C( 31824),  INT16_C(  5253), -INT16_C( 21311),  INT16_C( 21626),  INT16_C(  3741), -INT16_C( 31093),  INT16_C(  2493),
+         INT16_C( 19170),  INT16_C(  2498), -INT16_C( 27129),  INT16_C( 13797), -INT16_C(  5795), -INT16_C( 15581), -INT16_C( 32631),  INT16_C( 17864),
+         INT16_C( 23405), -INT16_C( 31237), -INT16_C( 22180), -INT16_C( 19985), -INT16_C(  7130),  INT16_C( 25112),  INT16_C(  2834), -INT16_C(  6119),
+         INT16_C( 17714),  INT16_C( 14434), -INT16_C( 26038), -INT16_C( 11082), -INT16_C( 28607),  INT16_C( 28188), -INT16_C(   816),  INT16_C( 14071) },
+      UINT32_C(2189722154),
+      { -INT16_C(  7794),  INT16_C(  1773),  INT16_C(  2778), -INT16_C( 17861),  INT16_C(  6096),  INT16_C(  9070),  INT16_C( 18467),  INT16_C( 25691),
+        -INT16_C( 15605),  INT16_C(  2632), -INT16_C(  4371), -INT16_C(  9061),  INT16_C( 20362),  INT16_C( 22949),  INT16_C( 20903),  INT16_C( 16354),
+        -INT16_C( 28997),  INT16_C( 20467),  INT16_C(  3856), -INT16_C( 17022), -INT16_C( 24501),  INT16_C(   211), -INT16_C( 24597), -INT16_C(  3353),
+         INT16_C( 32076),  INT16_C( 16212), -INT16_C( 12260), -INT16_C(  8088), -INT16_C( 18268), -INT16_C(  9298),  INT16_C( 22883), -INT16_C( 29207) },
+      {  INT16_C(  1773), -INT16_C( 17861),  INT16_C(  9070),  INT16_C(  2632),  INT16_C( 16354),  INT16_C(  3856), -INT16_C(  3353),  INT16_C( 16212),
+        -INT16_C( 29207),  INT16_C(  2498), -INT16_C( 27129),  INT16_C( 13797), -INT16_C(  5795), -INT16_C( 15581), -INT16_C( 32631),  INT16_C( 17864),
+         INT16_C( 23405), -INT16_C( 31237), -INT16_C( 22180), -INT16_C( 19985), -INT16_C(  7130),  INT16_C( 25112),  INT16_C(  2834), -INT16_C(  6119),
+         INT16_C( 17714),  INT16_C( 14434), -INT16_C( 26038), -INT16_C( 11082), -INT16_C( 28607),  INT16_C( 28188), -INT16_C(   816),  INT16_C( 14071) } },
+    { {  INT16_C( 16857), -INT16_C( 12555), -INT16_C(   940), -INT16_C( 28697), -INT16_C(  3525),  INT16_C(  6527), -INT16_C( 13058),  INT16_C( 32328),
+         INT16_C( 11623), -INT16_C( 26521),  INT16_C(  9407),  INT16_C( 31907),  INT16_C( 14981), -INT16_C( 15093), -INT16_C( 24912),  INT16_C( 24550),
+         INT16_C(  7145), -INT16_C(   282),  INT16_C(  9579), -INT16_C( 30492),  INT16_C( 20309), -INT16_C( 16258), -INT16_C(  4617), -INT16_C(  4596),
+        -INT16_C( 26247),  INT16_C( 26445),  INT16_C( 14442),  INT16_C(  6610), -INT16_C( 26161), -INT16_C( 25595), -INT16_C( 11045), -INT16_C( 10022) },
+      UINT32_C(2739066039),
+      { -INT16_C( 31996),  INT16_C(  5328), -INT16_C(  5906),  INT16_C(  4014), -INT16_C( 30902),  INT16_C(  2572), -INT16_C( 12373),  INT16_C( 19254),
+        -INT16_C( 19316), -INT16_C(  5382), -INT16_C(  3305), -INT16_C( 16920),  INT16_C( 21244),  INT16_C( 28265),  INT16_C( 17551),  INT16_C( 14653),
+        -INT16_C(  3123), -INT16_C(  7870),  INT16_C( 16314), -INT16_C(  1958), -INT16_C( 26163),  INT16_C( 16114), -INT16_C( 31293), -INT16_C(  5627),
+        -INT16_C( 15729),  INT16_C( 14653),  INT16_C( 13542),  INT16_C(  5994), -INT16_C( 19493), -INT16_C( 13487),  INT16_C( 25484), -INT16_C( 26355) },
+      { -INT16_C( 31996),  INT16_C(  5328), -INT16_C(  5906), -INT16_C( 30902),  INT16_C(  2572),  INT16_C( 19254), -INT16_C(  3305),  INT16_C( 21244),
+         INT16_C( 17551),  INT16_C( 14653), -INT16_C(  7870), -INT16_C( 31293), -INT16_C( 15729),  INT16_C( 14653), -INT16_C( 13487), -INT16_C( 26355),
+         INT16_C(  7145), -INT16_C(   282),  INT16_C(  9579), -INT16_C( 30492),  INT16_C( 20309), -INT16_C( 16258), -INT16_C(  4617), -INT16_C(  4596),
+        -INT16_C( 26247),  INT16_C( 26445),  INT16_C( 14442),  INT16_C(  6610), -INT16_C( 26161), -INT16_C( 25595), -INT16_C( 11045), -INT16_C( 10022) } },
+    { {  INT16_C( 19110),  INT16_C( 17515),  INT16_C(  7384),  INT16_C( 10339), -INT16_C(  9246),  INT16_C(  2513),  INT16_C( 20620), -INT16_C( 29359),
+        -INT16_C( 32523), -INT16_C( 22900),  INT16_C( 16578), -INT16_C(  2117),  INT16_C( 23086),  INT16_C(  1772),  INT16_C( 23912), -INT16_C( 18371),
+        -INT16_C( 20301), -INT16_C(  7221), -INT16_C( 25820),  INT16_C( 31011), -INT16_C(  1478), -INT16_C( 30948),  INT16_C( 17059), -INT16_C(  5762),
+         INT16_C( 32674),  INT16_C( 26821), -INT16_C( 11457),  INT16_C(  6934), -INT16_C( 10767),  INT16_C( 25102), -INT16_C( 23814), -INT16_C( 32486) },
+      UINT32_C(2306378842),
+      { -INT16_C( 31607), -INT16_C(  8777),  INT16_C(  1837), -INT16_C( 21587),  INT16_C( 18626), -INT16_C( 30666), -INT16_C( 19580),  INT16_C( 30861),
+         INT16_C( 10641), -INT16_C( 16254),  INT16_C( 27755),  INT16_C( 19534),  INT16_C( 27227),  INT16_C( 15190),  INT16_C( 11000),  INT16_C( 16207),
+        -INT16_C(  9039), -INT16_C(  2010), -INT16_C(  1098), -INT16_C(  8442),  INT16_C( 11778), -INT16_C(  8553),  INT16_C( 32023), -INT16_C( 32262),
+         INT16_C( 28341),  INT16_C(  4371),  INT16_C( 20851),  INT16_C( 31547),  INT16_C( 22627), -INT16_C( 19425), -INT16_C( 18125), -INT16_C( 31071) },
+      { -INT16_C(  8777), -INT16_C( 21587),  INT16_C( 18626), -INT16_C( 19580),  INT16_C( 27755),  INT16_C( 19534),  INT16_C( 16207), -INT16_C(  8442),
+         INT16_C( 11778), -INT16_C(  8553),  INT16_C( 32023),  INT16_C( 28341),  INT16_C( 31547), -INT16_C( 31071),  INT16_C( 23912), -INT16_C( 18371),
+        -INT16_C( 20301), -INT16_C(  7221), -INT16_C( 25820),  INT16_C( 31011), -INT16_C(  1478), -INT16_C( 30948),  INT16_C( 17059), -INT16_C(  5762),
+         INT16_C( 32674),  INT16_C( 26821), -INT16_C( 11457),  INT16_C(  6934), -INT16_C( 10767),  INT16_C( 25102), -INT16_C( 23814), -INT16_C( 32486) } },
+    { { -INT16_C( 14793), -INT16_C( 32695),  INT16_C(  8207),  INT16_C( 26890), -INT16_C( 13052),  INT16_C( 23857),  INT16_C(  9295), -INT16_C( 31955),
+        -INT16_C(  9514),  INT16_C(  3695),  INT16_C( 11603), -INT16_C(  2473), -INT16_C( 24370), -INT16_C(   845),  INT16_C( 11539),  INT16_C( 20072),
+        -INT16_C( 17800),  INT16_C( 15262),  INT16_C(  4748), -INT16_C(  3777),  INT16_C( 14549),  INT16_C( 10087),  INT16_C( 26390),  INT16_C( 31201),
+         INT16_C( 11191), -INT16_C( 10110), -INT16_C( 24011), -INT16_C( 24417), -INT16_C( 26570),  INT16_C(  6547), -INT16_C( 24679),  INT16_C(  7824) },
+      UINT32_C(   8488979),
+      { -INT16_C( 10559),  INT16_C( 32327), -INT16_C( 17343), -INT16_C( 19862), -INT16_C(  4421), -INT16_C( 27774), -INT16_C( 19942), -INT16_C(  9582),
+        -INT16_C( 21627), -INT16_C( 18239), -INT16_C(   465), -INT16_C( 28262), -INT16_C( 26778), -INT16_C(  4195),  INT16_C( 17918), -INT16_C(  5206),
+        -INT16_C( 10952), -INT16_C(  8389), -INT16_C( 16642),  INT16_C( 13432), -INT16_C( 14120), -INT16_C( 21563),  INT16_C( 23028),  INT16_C(  7666),
+        -INT16_C( 29592),  INT16_C(  7065), -INT16_C( 13132),  INT16_C( 11533),  INT16_C( 13958), -INT16_C(  3268), -INT16_C(  9226),  INT16_C( 31571) },
+      { -INT16_C( 10559),  INT16_C( 32327), -INT16_C(  4421), -INT16_C( 28262), -INT16_C(  5206), -INT16_C( 10952),  INT16_C(  7666), -INT16_C( 31955),
+        -INT16_C(  9514),  INT16_C(  3695),  INT16_C( 11603), -INT16_C(  2473), -INT16_C( 24370), -INT16_C(   845),  INT16_C( 11539),  INT16_C( 20072),
+        -INT16_C( 17800),  INT16_C( 15262),  INT16_C(  4748), -INT16_C(  3777),  INT16_C( 14549),  INT16_C( 10087),  INT16_C( 26390),  INT16_C( 31201),
+         INT16_C( 11191), -INT16_C( 10110), -INT16_C( 24011), -INT16_C( 24417), -INT16_C( 26570),  INT16_C(  6547), -INT16_C( 24679),  INT16_C(  7824) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3419120854),
+      {  INT16_C(  6581),  INT16_C(  7958),  INT16_C( 32695), -INT16_C( 23159),  INT16_C(  6489), -INT16_C( 22183),  INT16_C( 22282),  INT16_C( 18547),
+         INT16_C( 15956),  INT16_C( 14848),  INT16_C(  4521), -INT16_C( 26143),  INT16_C( 10861), -INT16_C( 21643), -INT16_C(  4125),  INT16_C(   707),
+         INT16_C( 28311), -INT16_C( 26375), -INT16_C( 19155), -INT16_C( 23659), -INT16_C(  6996), -INT16_C(   547),  INT16_C( 26196),  INT16_C( 16359),
+        -INT16_C( 23481),  INT16_C(  9084), -INT16_C( 18047), -INT16_C(  1026), -INT16_C( 26025), -INT16_C( 28585),  INT16_C(  7651),  INT16_C(  7327) },
+      {  INT16_C(  7958),  INT16_C( 32695),  INT16_C(  6489),  INT16_C( 22282),  INT16_C( 18547),  INT16_C(  4521), -INT16_C( 21643),  INT16_C(   707),
+         INT16_C( 28311), -INT16_C( 26375), -INT16_C( 23659),  INT16_C( 26196),  INT16_C( 16359), -INT16_C( 23481),  INT16_C(  9084), -INT16_C(  1026),
+         INT16_C(  7651),  INT16_C(  7327),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(4229095285),
+      {  INT16_C(  6208),  INT16_C( 26982),  INT16_C( 27426), -INT16_C( 27775),  INT16_C(   590), -INT16_C( 29922),  INT16_C( 27325), -INT16_C( 12358),
+         INT16_C(  1399),  INT16_C(  9906),  INT16_C( 20899), -INT16_C( 14069),  INT16_C(  4117), -INT16_C( 27724),  INT16_C( 26146),  INT16_C(  8020),
+        -INT16_C( 25611), -INT16_C( 30490), -INT16_C( 19397),  INT16_C( 18512),       INT16_MIN, -INT16_C( 13209),  INT16_C(   119), -INT16_C( 30989),
+         INT16_C(  7742),  INT16_C( 21210),  INT16_C( 10259), -INT16_C( 22778),  INT16_C(  3370), -INT16_C( 10965), -INT16_C(  4409), -INT16_C( 27552) },
+      {  INT16_C(  6208),  INT16_C( 27426),  INT16_C(   590), -INT16_C( 29922),  INT16_C( 27325),  INT16_C(  1399),  INT16_C(  9906),  INT16_C( 20899),
+        -INT16_C( 14069),  INT16_C(  4117),  INT16_C( 26146),  INT16_C(  8020), -INT16_C( 30490),       INT16_MIN,  INT16_C( 10259), -INT16_C( 22778),
+         INT16_C(  3370), -INT16_C( 10965), -INT16_C(  4409), -INT16_C( 27552),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(  25199104),
+      {  INT16_C( 26397),  INT16_C(  8787), -INT16_C( 17274), -INT16_C( 22230),  INT16_C(  5827),  INT16_C(  8186), -INT16_C( 31524), -INT16_C(   868),
+         INT16_C( 31304), -INT16_C(  5079), -INT16_C(  8138), -INT16_C( 13083),  INT16_C( 19469), -INT16_C( 28870),  INT16_C( 16734),  INT16_C(  2542),
+         INT16_C( 13930),  INT16_C( 13499),  INT16_C( 15734), -INT16_C( 17991), -INT16_C( 29202),  INT16_C( 22955),  INT16_C( 30228), -INT16_C( 19282),
+         INT16_C(  2732),  INT16_C(  4607), -INT16_C(  7074), -INT16_C( 23020),  INT16_C( 13660),  INT16_C( 21844), -INT16_C( 22505), -INT16_C( 11970) },
+      { -INT16_C(  5079),  INT16_C(  2542), -INT16_C( 19282),  INT16_C(  2732),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 879165696),
+      { -INT16_C( 14559),  INT16_C( 12702),  INT16_C( 25487),  INT16_C( 26222), -INT16_C( 20963),  INT16_C( 27393), -INT16_C( 26148), -INT16_C(  1944),
+        -INT16_C( 22539),  INT16_C( 21690),  INT16_C( 25128),  INT16_C( 22565),  INT16_C(  2159), -INT16_C( 16845), -INT16_C(  5045), -INT16_C( 28081),
+        -INT16_C( 26879), -INT16_C( 25356), -INT16_C(  8338),  INT16_C(  1125),  INT16_C( 22493), -INT16_C( 16173), -INT16_C( 17054), -INT16_C(  4902),
+        -INT16_C( 29390),  INT16_C(  1735),  INT16_C( 31621), -INT16_C(  5524),  INT16_C( 17780),  INT16_C(  1118), -INT16_C( 12889),  INT16_C(   918) },
+      { -INT16_C( 22539), -INT16_C( 26879), -INT16_C( 25356), -INT16_C(  8338), -INT16_C( 16173), -INT16_C( 17054),  INT16_C( 31621),  INT16_C( 17780),
+         INT16_C(  1118),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2662178289),
+      { -INT16_C( 30925),  INT16_C(  5938), -INT16_C( 16628), -INT16_C( 13455),  INT16_C( 30607),  INT16_C( 32395), -INT16_C( 25337),  INT16_C( 31548),
+        -INT16_C( 19189), -INT16_C(  4670),  INT16_C( 27158), -INT16_C(  4625), -INT16_C(  5959),  INT16_C( 24025), -INT16_C(  4328),  INT16_C( 23438),
+        -INT16_C( 15769), -INT16_C( 18885),  INT16_C(  5950), -INT16_C(   532),  INT16_C( 31696),  INT16_C( 16102),  INT16_C( 24094), -INT16_C(  2732),
+        -INT16_C( 19789),  INT16_C(  5760),  INT16_C( 28927), -INT16_C( 31851), -INT16_C( 11132),  INT16_C( 20939),  INT16_C( 13340), -INT16_C(  8333) },
+      { -INT16_C( 30925),  INT16_C( 30607),  INT16_C( 32395), -INT16_C( 25337),  INT16_C( 31548), -INT16_C( 19189),  INT16_C( 27158), -INT16_C(  4625),
+        -INT16_C(  5959),  INT16_C( 23438), -INT16_C( 15769),  INT16_C(  5950), -INT16_C(   532),  INT16_C( 16102), -INT16_C(  2732),  INT16_C(  5760),
+         INT16_C( 28927), -INT16_C( 31851), -INT16_C( 11132), -INT16_C(  8333),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 143835712),
+      {  INT16_C( 15407),  INT16_C( 16662),  INT16_C( 16731),  INT16_C( 22836),  INT16_C( 29363), -INT16_C( 15829),  INT16_C( 12247),  INT16_C( 32480),
+        -INT16_C( 13462),  INT16_C( 16956),  INT16_C( 31371),  INT16_C( 27527),  INT16_C( 12324),  INT16_C(  9326),  INT16_C( 22732),  INT16_C( 19224),
+        -INT16_C( 17154),  INT16_C( 10808),  INT16_C( 31933),  INT16_C(  2931), -INT16_C(  2763), -INT16_C( 20995),  INT16_C( 24392),  INT16_C( 13704),
+        -INT16_C( 14461),  INT16_C( 19290), -INT16_C(  6944),  INT16_C( 11196), -INT16_C( 26762), -INT16_C(  5319),  INT16_C(  5651),  INT16_C( 11974) },
+      {  INT16_C( 12247),  INT16_C( 16956),  INT16_C( 22732),  INT16_C( 19224),  INT16_C( 10808), -INT16_C(  2763),  INT16_C( 13704),  INT16_C( 11196),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1825098688),
+      { -INT16_C( 12049), -INT16_C( 18545),  INT16_C( 30740),  INT16_C(  8777),  INT16_C( 11362), -INT16_C( 29573), -INT16_C( 22280), -INT16_C( 15625),
+        -INT16_C( 23281),  INT16_C( 15416),  INT16_C(  9332), -INT16_C( 11225), -INT16_C( 21717), -INT16_C( 18340),  INT16_C( 18107), -INT16_C( 15944),
+         INT16_C(  5193), -INT16_C(    88),  INT16_C( 29371),  INT16_C( 18811),  INT16_C( 17728), -INT16_C( 11042), -INT16_C(  6412), -INT16_C(  7949),
+         INT16_C( 25527), -INT16_C(  7329),  INT16_C(   421), -INT16_C(  3559), -INT16_C( 32092),  INT16_C( 21246), -INT16_C( 11090), -INT16_C( 23123) },
+      { -INT16_C( 22280), -INT16_C( 15625), -INT16_C( 23281),  INT16_C( 15416), -INT16_C( 11225),  INT16_C( 18107), -INT16_C( 15944),  INT16_C( 18811),
+        -INT16_C(  6412), -INT16_C(  7949),  INT16_C(   421), -INT16_C(  3559),  INT16_C( 21246), -INT16_C( 11090),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(   1071112),
+      {  INT16_C( 22763), -INT16_C( 19235),  INT16_C(  4374),  INT16_C(  9572),  INT16_C( 16816),  INT16_C( 12061), -INT16_C( 19787), -INT16_C( 24904),
+         INT16_C( 21049),  INT16_C(  5002), -INT16_C(  6930), -INT16_C(  9718),  INT16_C(   450), -INT16_C( 29441), -INT16_C(   279),  INT16_C( 22355),
+        -INT16_C(  4926), -INT16_C(  6550),  INT16_C( 25296),  INT16_C( 12177), -INT16_C( 17396),  INT16_C( 23078),  INT16_C(  4457),  INT16_C( 27567),
+         INT16_C(  8635),  INT16_C(   574), -INT16_C( 11065),  INT16_C(   224),  INT16_C(  8599), -INT16_C(  1950),  INT16_C( 25473), -INT16_C( 30598) },
+      {  INT16_C(  9572), -INT16_C(  9718),  INT16_C(   450), -INT16_C(   279), -INT16_C( 17396),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C( 15250), -INT16_C( 29953),  INT16_C( 14866), -INT16_C(  3933),  INT16_C( 19799),  INT16_C( 21316), -INT16_C( 30298), -INT16_C(  2080),
+         INT16_C( 12464),  INT16_C(  8343),  INT16_C(  8596), -INT16_C( 25940), -INT16_C( 26913),  INT16_C( 16779), -INT16_C(  5017), -INT16_C( 30932),
+        -INT16_C( 14637), -INT16_C( 31239), -INT16_C( 21159), -INT16_C( 24620),  INT16_C( 27133), -INT16_C( 21712),  INT16_C(  7683),  INT16_C( 30609),
+        -INT16_C( 32087), -INT16_C(  8967),  INT16_C( 21659), -INT16_C( 25304),  INT16_C( 12350),  INT16_C( 12078),  INT16_C(    79), -INT16_C( 23681) },
+      UINT32_C(4233123057),
+      { -INT16_C(  5996), -INT16_C( 24516), -INT16_C(  8563), -INT16_C(  7254), -INT16_C( 25164), -INT16_C(  1449), -INT16_C( 14927),  INT16_C(  9837),
+         INT16_C( 24244),  INT16_C( 22968), -INT16_C( 21297), -INT16_C(  1867), -INT16_C(  2919), -INT16_C( 10228),  INT16_C(  1102), -INT16_C(  3431),
+        -INT16_C( 27055), -INT16_C( 13911),  INT16_C( 25106),  INT16_C( 25898),  INT16_C( 17235), -INT16_C( 30537), -INT16_C( 25423), -INT16_C(  4798),
+        -INT16_C(  4367), -INT16_C( 29403), -INT16_C( 31275),  INT16_C( 10521),  INT16_C( 24892),  INT16_C(  5507), -INT16_C( 17048), -INT16_C( 26909) },
+      { -INT16_C(  5996), -INT16_C( 25164), -INT16_C(  1449), -INT16_C( 14927),  INT16_C(  9837), -INT16_C( 21297), -INT16_C(  2919),  INT16_C(  1102),
+         INT16_C( 17235), -INT16_C( 25423), -INT16_C( 31275),  INT16_C( 10521),  INT16_C( 24892),  INT16_C(  5507), -INT16_C( 17048), -INT16_C( 26909),
+        -INT16_C( 14637), -INT16_C( 31239), -INT16_C( 21159), -INT16_C( 24620),  INT16_C( 27133), -INT16_C( 21712),  INT16_C(  7683),  INT16_C( 30609),
+        -INT16_C( 32087), -INT16_C(  8967),  INT16_C( 21659), -INT16_C( 25304),  INT16_C( 12350),  INT16_C( 12078),  INT16_C(    79), -INT16_C( 23681) } },
+    { { -INT16_C( 19066),  INT16_C( 14683),  INT16_C( 10915),  INT16_C(  1324),  INT16_C( 13124),  INT16_C(  9474),  INT16_C( 31302), -INT16_C( 25076),
+        -INT16_C(   563), -INT16_C( 17159), -INT16_C(  4024), -INT16_C( 14515),  INT16_C( 20271), -INT16_C( 26448), -INT16_C( 13037),  INT16_C(  7911),
+        -INT16_C(   441),  INT16_C( 31098),  INT16_C(    70),  INT16_C(  3329),  INT16_C( 28756), -INT16_C(  8926),  INT16_C(  8179), -INT16_C(  8262),
+        -INT16_C( 30637), -INT16_C(  7247), -INT16_C( 13317), -INT16_C( 30005),  INT16_C( 28301), -INT16_C( 30995), -INT16_C(  6107), -INT16_C( 26470) },
+      UINT32_C(   3710240),
+      {  INT16_C(  4073), -INT16_C(  4847),  INT16_C( 15465),  INT16_C( 16589), -INT16_C( 29832), -INT16_C( 20975),  INT16_C(  6686),  INT16_C( 27263),
+         INT16_C( 28901), -INT16_C(  8642), -INT16_C( 10955),  INT16_C( 11583), -INT16_C(  3374), -INT16_C(  6756),  INT16_C( 15617),  INT16_C( 12507),
+        -INT16_C(  3295),  INT16_C(  4543),  INT16_C( 17447),  INT16_C(  9384),  INT16_C( 31544),  INT16_C( 27230), -INT16_C( 22359),  INT16_C(  7713),
+        -INT16_C( 10119), -INT16_C(  1791), -INT16_C( 27639), -INT16_C( 18688), -INT16_C( 26461),  INT16_C(  1256), -INT16_C( 22580),  INT16_C( 26130) },
+      { -INT16_C( 20975),  INT16_C( 28901), -INT16_C( 10955),  INT16_C( 11583), -INT16_C(  3374),  INT16_C( 12507),  INT16_C(  9384),  INT16_C( 31544),
+         INT16_C( 27230), -INT16_C( 17159), -INT16_C(  4024), -INT16_C( 14515),  INT16_C( 20271), -INT16_C( 26448), -INT16_C( 13037),  INT16_C(  7911),
+        -INT16_C(   441),  INT16_C( 31098),  INT16_C(    70),  INT16_C(  3329),  INT16_C( 28756), -INT16_C(  8926),  INT16_C(  8179), -INT16_C(  8262),
+        -INT16_C( 30637), -INT16_C(  7247), -INT16_C( 13317), -INT16_C( 30005),  INT16_C( 28301), -INT16_C( 30995), -INT16_C(  6107), -INT16_C( 26470) } },
+    { { -INT16_C( 32567),  INT16_C( 23433),  INT16_C( 14836), -INT16_C( 23910),  INT16_C(  6326),  INT16_C( 16317), -INT16_C( 14903),  INT16_C(  9320),
+         INT16_C( 27489), -INT16_C( 17271),  INT16_C(  4618),  INT16_C( 16111), -INT16_C( 10362),  INT16_C( 11889),  INT16_C(  7859),  INT16_C( 10737),
+         INT16_C( 29659), -INT16_C( 23184),  INT16_C( 12608), -INT16_C( 30022), -INT16_C( 31693), -INT16_C( 19267),  INT16_C(  6548), -INT16_C( 22021),
+         INT16_C( 20089), -INT16_C(     2), -INT16_C(  1970),  INT16_C( 11973), -INT16_C( 16118),  INT16_C(  5081),  INT16_C( 26212),  INT16_C( 30804) },
+      UINT32_C( 105271300),
+      {  INT16_C(  2933),  INT16_C(  6791), -INT16_C( 12342), -INT16_C( 22804), -INT16_C(  3435),  INT16_C( 12394), -INT16_C( 29677), -INT16_C( 19118),
+        -INT16_C( 10035), -INT16_C(  9678),  INT16_C(  7249),  INT16_C( 26800),  INT16_C(  7494), -INT16_C( 20434),  INT16_C( 22434),  INT16_C( 11636),
+         INT16_C( 17405), -INT16_C( 23350),  INT16_C( 21032),  INT16_C(  6671), -INT16_C( 19068), -INT16_C( 15932), -INT16_C( 26760),  INT16_C( 15899),
+        -INT16_C( 12846),  INT16_C(  9801),  INT16_C( 16882),  INT16_C( 18860),  INT16_C(  8365),  INT16_C( 19592),  INT16_C( 24863), -INT16_C(  4725) },
+      { -INT16_C( 12342),  INT16_C(  7494),  INT16_C( 22434), -INT16_C( 23350),  INT16_C( 21032), -INT16_C( 26760),  INT16_C(  9801),  INT16_C( 16882),
+         INT16_C( 27489), -INT16_C( 17271),  INT16_C(  4618),  INT16_C( 16111), -INT16_C( 10362),  INT16_C( 11889),  INT16_C(  7859),  INT16_C( 10737),
+         INT16_C( 29659), -INT16_C( 23184),  INT16_C( 12608), -INT16_C( 30022), -INT16_C( 31693), -INT16_C( 19267),  INT16_C(  6548), -INT16_C( 22021),
+         INT16_C( 20089), -INT16_C(     2), -INT16_C(  1970),  INT16_C( 11973), -INT16_C( 16118),  INT16_C(  5081),  INT16_C( 26212),  INT16_C( 30804) } },
+    { {  INT16_C( 25997),  INT16_C( 21191), -INT16_C( 22827), -INT16_C(   845),  INT16_C( 28592),  INT16_C( 14015), -INT16_C(  8829), -INT16_C( 18815),
+         INT16_C( 17083), -INT16_C(  5804), -INT16_C( 30632), -INT16_C( 28184),  INT16_C( 15665),  INT16_C(  5365),  INT16_C( 25198), -INT16_C( 14820),
+         INT16_C( 13925), -INT16_C( 28811),  INT16_C( 30824), -INT16_C( 25854), -INT16_C( 19334), -INT16_C(  6916), -INT16_C(  4246),  INT16_C(  3408),
+        -INT16_C( 20272),  INT16_C( 31680),  INT16_C(  7625), -INT16_C( 17763), -INT16_C( 18813), -INT16_C(  6211), -INT16_C( 12092), -INT16_C( 15845) },
+      UINT32_C( 138421249),
+      {  INT16_C( 16458), -INT16_C( 14102), -INT16_C(  2477), -INT16_C( 14386),  INT16_C(  4101),  INT16_C(  6857),  INT16_C( 23407),  INT16_C(   398),
+        -INT16_C( 20829), -INT16_C( 22166),  INT16_C(  1077),  INT16_C( 21223), -INT16_C( 32422), -INT16_C(  4441), -INT16_C( 25390), -INT16_C( 19357),
+        -INT16_C(  2965),  INT16_C( 16638), -INT16_C(  6235),  INT16_C( 25578),  INT16_C( 16158),  INT16_C( 11172), -INT16_C( 10966),  INT16_C(  7682),
+         INT16_C( 17212),  INT16_C( 25335),  INT16_C(  1811),  INT16_C( 23864),  INT16_C( 11412),  INT16_C( 28961),  INT16_C( 32419), -INT16_C( 22391) },
+      {  INT16_C( 16458),  INT16_C(  1077), -INT16_C(  4441), -INT16_C( 10966),  INT16_C( 23864),  INT16_C( 14015), -INT16_C(  8829), -INT16_C( 18815),
+         INT16_C( 17083), -INT16_C(  5804), -INT16_C( 30632), -INT16_C( 28184),  INT16_C( 15665),  INT16_C(  5365),  INT16_C( 25198), -INT16_C( 14820),
+         INT16_C( 13925), -INT16_C( 28811),  INT16_C( 30824), -INT16_C( 25854), -INT16_C( 19334), -INT16_C(  6916), -INT16_C(  4246),  INT16_C(  3408),
+        -INT16_C( 20272),  INT16_C( 31680),  INT16_C(  7625), -INT16_C( 17763), -INT16_C( 18813), -INT16_C(  6211), -INT16_C( 12092), -INT16_C( 15845) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    int16_t r[32];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm512_mask_compressstoreu_epi16(r, test_vec[i].k, a);
+    simde_assert_equal_vi16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  1696317630), -INT32_C(  1987781718), -INT32_C(  1997364157), -INT32_C(  1643606099),  INT32_C(    56782388), -INT32_C(  1773142661),  INT32_C(  1646853841),  INT32_C(   305581477),
+        -INT32_C(   988981938),  INT32_C(   385015733),  INT32_C(  1230270586), -INT32_C(   724320210),  INT32_C(  1904322115),  INT32_C(  1152198937),  INT32_C(  1360888910), -INT32_C(   761934606) },
+      UINT16_C(56061),
+      { -INT32_C(  1164368141),  INT32_C(   749890037),  INT32_C(   952634484), -INT32_C(   178083356),  INT32_C(  1730301419),  INT32_C(  1846285640), -INT32_C(  1244964388),  INT32_C(    94570731),
+         INT32_C(   254253878),  INT32_C(  1139420064), -INT32_C(   997785476),  INT32_C(   118284153),  INT32_C(  1552474839), -INT32_C(   407726755), -INT32_C(  1181985311),  INT32_C(   319890182) },
+      { -INT32_C(  1164368141),  INT32_C(   952634484), -INT32_C(   178083356),  INT32_C(  1730301419),  INT32_C(  1846285640), -INT32_C(  1244964388),  INT32_C(    94570731),  INT32_C(  1139420064),
+         INT32_C(   118284153),  INT32_C(  1552474839), -INT32_C(  1181985311),  INT32_C(   319890182),  INT32_C(  1904322115),  INT32_C(  1152198937),  INT32_C(  1360888910), -INT32_C(   761934606) } },
+    { {  INT32_C(  1746844380), -INT32_C(  1385780141), -INT32_C(  1581713565), -INT32_C(  2111708262),  INT32_C(   435443422),  INT32_C(   208586289),  INT32_C(   204370792), -INT32_C(   714574744),
+        -INT32_C(  1488929228), -INT32_C(  1126829239), -INT32_C(   210336149), -INT32_C(   706656160), -INT32_C(  1189290686), -INT32_C(   794805977), -INT32_C(  1683503919),  INT32_C(    57119626) },
+      UINT16_C(31647),
+      {  INT32_C(  1815764940),  INT32_C(   369855469), -INT32_C(  2100803317),  INT32_C(  1917493039), -INT32_C(   627588217), -INT32_C(   803466082),  INT32_C(   736355839), -INT32_C(  2095652389),
+         INT32_C(  1446719816),  INT32_C(  1862501903),  INT32_C(  1764998067), -INT32_C(  1029541973),  INT32_C(  1994654576),  INT32_C(   601576596),  INT32_C(   283800806),  INT32_C(  2053364706) },
+      {  INT32_C(  1815764940),  INT32_C(   369855469), -INT32_C(  2100803317),  INT32_C(  1917493039), -INT32_C(   627588217), -INT32_C(  2095652389),  INT32_C(  1446719816),  INT32_C(  1862501903),
+        -INT32_C(  1029541973),  INT32_C(  1994654576),  INT32_C(   601576596),  INT32_C(   283800806), -INT32_C(  1189290686), -INT32_C(   794805977), -INT32_C(  1683503919),  INT32_C(    57119626) } },
+    { {  INT32_C(   906346572), -INT32_C(  1429208417), -INT32_C(  1530460914),  INT32_C(  1592849452), -INT32_C(   851155664),  INT32_C(  1160686278),  INT32_C(   604154890),  INT32_C(   881531125),
+        -INT32_C(   180599554), -INT32_C(  1996810342), -INT32_C(  1992497620),  INT32_C(  2080595137),  INT32_C(  2089237555),  INT32_C(  1676531823),  INT32_C(   411930712),  INT32_C(  2093309006) },
+      UINT16_C(18395),
+      { -INT32_C(  1956552231), -INT32_C(   554858071), -INT32_C(   229562546), -INT32_C(  1909765691),  INT32_C(  1537320292),  INT32_C(  2092330587), -INT32_C(   496468505), -INT32_C(  2088017394),
+         INT32_C(   880370263),  INT32_C(     3780729),  INT32_C(  2106583190), -INT32_C(   355064305), -INT32_C(  1765553562),  INT32_C(   316117688),  INT32_C(   451716784), -INT32_C(  1183146854) },
+      { -INT32_C(  1956552231), -INT32_C(   554858071), -INT32_C(  1909765691),  INT32_C(  1537320292), -INT32_C(   496468505), -INT32_C(  2088017394),  INT32_C(   880370263),  INT32_C(     3780729),
+         INT32_C(  2106583190),  INT32_C(   451716784), -INT32_C(  1992497620),  INT32_C(  2080595137),  INT32_C(  2089237555),  INT32_C(  1676531823),  INT32_C(   411930712),  INT32_C(  2093309006) } },
+    { {  INT32_C(   553569557), -INT32_C(  1589358380), -INT32_C(  1588972491),  INT32_C(  2082495386),  INT32_C(  1627117397), -INT32_C(   722102755),  INT32_C(   152104529), -INT32_C(   200182542),
+         INT32_C(   789214580), -INT32_C(   518219582), -INT32_C(   128130832), -INT32_C(   156423051), -INT32_C(  1359931395),  INT32_C(   462090444), -INT32_C(  1018077587), -INT32_C(   907850545) },
+      UINT16_C(54693),
+      {  INT32_C(  1500505339), -INT32_C(  1393034306), -INT32_C(  1537262078), -INT32_C(   453714878),  INT32_C(  1154298580), -INT32_C(  1602007180), -INT32_C(  1125635591), -INT32_C(   874828770),
+         INT32_C(   750803403), -INT32_C(   226543043), -INT32_C(   311806311), -INT32_C(  1391720302),  INT32_C(   185638544), -INT32_C(   692119114),  INT32_C(  1622595891),  INT32_C(   498295196) },
+      {  INT32_C(  1500505339), -INT32_C(  1537262078), -INT32_C(  1602007180), -INT32_C(   874828770),  INT32_C(   750803403), -INT32_C(   311806311),  INT32_C(   185638544),  INT32_C(  1622595891),
+         INT32_C(   498295196), -INT32_C(   518219582), -INT32_C(   128130832), -INT32_C(   156423051), -INT32_C(  1359931395),  INT32_C(   462090444), -INT32_C(  1018077587), -INT32_C(   907850545) } },
+    { { -INT32_C(   153146347), -INT32_C(  1297226245), -INT32_C(  1657996227),  INT32_C(   858039707),  INT32_C(  1470186700), -INT32_C(   350138086), -INT32_C(   459955312),  INT32_C(   421005405),
+        -INT32_C(  2089241663),  INT32_C(  1788170066), -INT32_C(   572512930),  INT32_C(   198416022),  INT32_C(  1353876141),  INT32_C(  2015353358), -INT32_C(  1098465204), -INT32_C(   765443410) },
+      UINT16_C( 7261),
+      { -INT32_C(  1640936287), -INT32_C(  1552784362), -INT32_C(    14058904),  INT32_C(   400188916), -INT32_C(  1234431429), -INT32_C(   621888435),  INT32_C(   560284576),  INT32_C(   750944250),
+        -INT32_C(   320675629),  INT32_C(  1976204577),  INT32_C(  1656319282),  INT32_C(  1268023025), -INT32_C(  1922895886),  INT32_C(  1278049616),  INT32_C(  1460092596), -INT32_C(  1413494503) },
+      { -INT32_C(  1640936287), -INT32_C(    14058904),  INT32_C(   400188916), -INT32_C(  1234431429),  INT32_C(   560284576),  INT32_C(  1656319282),  INT32_C(  1268023025), -INT32_C(  1922895886),
+        -INT32_C(  2089241663),  INT32_C(  1788170066), -INT32_C(   572512930),  INT32_C(   198416022),  INT32_C(  1353876141),  INT32_C(  2015353358), -INT32_C(  1098465204), -INT32_C(   765443410) } },
+    { { -INT32_C(  1402003860), -INT32_C(  1940330641), -INT32_C(   185805393),  INT32_C(  1474863933), -INT32_C(  2027645719), -INT32_C(  1313383760), -INT32_C(  1487618324),  INT32_C(  1781901194),
+         INT32_C(  2132109492), -INT32_C(  2077586319), -INT32_C(   693611487), -INT32_C(   147099265), -INT32_C(  1952571105), -INT32_C(   138015615),  INT32_C(  2026699069), -INT32_C(  1650030314) },
+      UINT16_C(10656),
+      {  INT32_C(   470060862), -INT32_C(  1757628294),  INT32_C(   320368882), -INT32_C(  2021962503), -INT32_C(   815274371), -INT32_C(   354201538),  INT32_C(   421825608),  INT32_C(   179105698),
+         INT32_C(  1949091681), -INT32_C(  1350912188), -INT32_C(  1668853302), -INT32_C(  1696716790), -INT32_C(  1692656761), -INT32_C(  1794349840), -INT32_C(   224404463), -INT32_C(  1427214981) },
+      { -INT32_C(   354201538),  INT32_C(   179105698),  INT32_C(  1949091681), -INT32_C(  1696716790), -INT32_C(  1794349840), -INT32_C(  1313383760), -INT32_C(  1487618324),  INT32_C(  1781901194),
+         INT32_C(  2132109492), -INT32_C(  2077586319), -INT32_C(   693611487), -INT32_C(   147099265), -INT32_C(  1952571105), -INT32_C(   138015615),  INT32_C(  2026699069), -INT32_C(  1650030314) } },
+    { { -INT32_C(  2040168605),  INT32_C(   265925401),  INT32_C(   760144280), -INT32_C(  1852334834),  INT32_C(   663762365),  INT32_C(   525301113), -INT32_C(  1760086431),  INT32_C(  1627202519),
+         INT32_C(  1157629626),  INT32_C(  1739835062), -INT32_C(  1317524156),  INT32_C(   557455076),  INT32_C(  1935002323),  INT32_C(  1121872602),  INT32_C(  1778540472),  INT32_C(  1693606280) },
+      UINT16_C( 7239),
+      {  INT32_C(    23581060),  INT32_C(   978670717), -INT32_C(   745443264),  INT32_C(  1000958559),  INT32_C(  1561974837),  INT32_C(  1066861721),  INT32_C(  1121492528),  INT32_C(   383868312),
+        -INT32_C(  1940286590),  INT32_C(  2085319660), -INT32_C(   402753746), -INT32_C(   580118359),  INT32_C(   948048861), -INT32_C(  2076282726), -INT32_C(  1833036363),  INT32_C(  1248510274) },
+      {  INT32_C(    23581060),  INT32_C(   978670717), -INT32_C(   745443264),  INT32_C(  1121492528), -INT32_C(   402753746), -INT32_C(   580118359),  INT32_C(   948048861),  INT32_C(  1627202519),
+         INT32_C(  1157629626),  INT32_C(  1739835062), -INT32_C(  1317524156),  INT32_C(   557455076),  INT32_C(  1935002323),  INT32_C(  1121872602),  INT32_C(  1778540472),  INT32_C(  1693606280) } },
+    { {  INT32_C(  1378520133), -INT32_C(  1085410097),  INT32_C(   446753503), -INT32_C(  1194955623), -INT32_C(  1307648989),  INT32_C(  2088090853),  INT32_C(  1362847775),  INT32_C(  1468832398),
+         INT32_C(   115998996), -INT32_C(  1470795802),  INT32_C(  1162064643),  INT32_C(  2128523099),  INT32_C(  1738721047), -INT32_C(   586741857),  INT32_C(  1766708701), -INT32_C(   202751350) },
+      UINT16_C(32765),
+      {  INT32_C(  1748274569), -INT32_C(  2052108704),  INT32_C(  1016496412), -INT32_C(  2136920230), -INT32_C(  2128165003), -INT32_C(  1261299150),  INT32_C(  1908385428), -INT32_C(   344984506),
+        -INT32_C(  1360313420), -INT32_C(  1101457064), -INT32_C(  1235619037),  INT32_C(  2036561346), -INT32_C(   334287406), -INT32_C(  1962009818),  INT32_C(   399222545),  INT32_C(  1967569919) },
+      {  INT32_C(  1748274569),  INT32_C(  1016496412), -INT32_C(  2136920230), -INT32_C(  2128165003), -INT32_C(  1261299150),  INT32_C(  1908385428), -INT32_C(   344984506), -INT32_C(  1360313420),
+        -INT32_C(  1101457064), -INT32_C(  1235619037),  INT32_C(  2036561346), -INT32_C(   334287406), -INT32_C(  1962009818),  INT32_C(   399222545),  INT32_C(  1766708701), -INT32_C(   202751350) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(14867),
+      { -INT32_C(   590111076), -INT32_C(  1702863753), -INT32_C(  1282051361), -INT32_C(  1981968890),  INT32_C(  1829214867), -INT32_C(   261518530), -INT32_C(  1007609568), -INT32_C(  1889488607),
+        -INT32_C(  1657690586),  INT32_C(   244890760),  INT32_C(  1750543447),  INT32_C(    46516056),  INT32_C(  1557511994), -INT32_C(   386557856),  INT32_C(  1457551441), -INT32_C(   506969831) },
+      { -INT32_C(   590111076), -INT32_C(  1702863753),  INT32_C(  1829214867),  INT32_C(   244890760),  INT32_C(    46516056),  INT32_C(  1557511994), -INT32_C(   386557856),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C( 9377),
+      {  INT32_C(  1327775497), -INT32_C(  1180705776), -INT32_C(   750151657), -INT32_C(  1395917124), -INT32_C(  1452562881), -INT32_C(   990255013),  INT32_C(   711054112),  INT32_C(  2034350467),
+         INT32_C(  1701391672),  INT32_C(   221646079),  INT32_C(  1877304224), -INT32_C(  1533074449),  INT32_C(   826518876), -INT32_C(   576091838), -INT32_C(  1680095675),  INT32_C(  2000175168) },
+      {  INT32_C(  1327775497), -INT32_C(   990255013),  INT32_C(  2034350467),  INT32_C(  1877304224), -INT32_C(   576091838),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(62937),
+      { -INT32_C(  1531868357),  INT32_C(  1929550688), -INT32_C(  2032218921),  INT32_C(   420339089), -INT32_C(   354528526),  INT32_C(  1472169732),  INT32_C(   454097222),  INT32_C(  1913304335),
+         INT32_C(  1882819375),  INT32_C(   155345491), -INT32_C(  1403368433),  INT32_C(  1471157723), -INT32_C(  1503008396), -INT32_C(   501192100),  INT32_C(   343515901),  INT32_C(   341376240) },
+      { -INT32_C(  1531868357),  INT32_C(   420339089), -INT32_C(   354528526),  INT32_C(   454097222),  INT32_C(  1913304335),  INT32_C(  1882819375), -INT32_C(  1403368433), -INT32_C(  1503008396),
+        -INT32_C(   501192100),  INT32_C(   343515901),  INT32_C(   341376240),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(19995),
+      { -INT32_C(  1937515313),  INT32_C(  1728480870), -INT32_C(  1306958384), -INT32_C(  1470818736),  INT32_C(   208394495),  INT32_C(   232101430),  INT32_C(   324722509),  INT32_C(   935191047),
+         INT32_C(  1454102283), -INT32_C(   481178315), -INT32_C(   521603072),  INT32_C(   452728197), -INT32_C(  1766169233), -INT32_C(   378949862), -INT32_C(  1331356683),  INT32_C(  1907691590) },
+      { -INT32_C(  1937515313),  INT32_C(  1728480870), -INT32_C(  1470818736),  INT32_C(   208394495), -INT32_C(   481178315), -INT32_C(   521603072),  INT32_C(   452728197), -INT32_C(  1331356683),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(36836),
+      { -INT32_C(  1545828060), -INT32_C(   159096579),  INT32_C(   720405362),  INT32_C(  1521946098),  INT32_C(  1233925164),  INT32_C(   845056615), -INT32_C(  1823447627),  INT32_C(  1788564530),
+         INT32_C(   869231002), -INT32_C(   927331192), -INT32_C(  1840615061),  INT32_C(   748876144),  INT32_C(   959691799), -INT32_C(  1971280751),  INT32_C(   665541053), -INT32_C(  1688260331) },
+      {  INT32_C(   720405362),  INT32_C(   845056615), -INT32_C(  1823447627),  INT32_C(  1788564530),  INT32_C(   869231002), -INT32_C(   927331192), -INT32_C(  1840615061),  INT32_C(   748876144),
+        -INT32_C(  1688260331),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(64187),
+      { -INT32_C(  1515054309), -INT32_C(  1554756371), -INT32_C(  1665438824),  INT32_C(  1899017377),  INT32_C(   415438180), -INT32_C(  1618318592),  INT32_C(   556069947), -INT32_C(  1373122048),
+        -INT32_C(   695294195), -INT32_C(  2087507859), -INT32_C(  1217043728),  INT32_C(  1310939962), -INT32_C(  1281264164), -INT32_C(  1396677343),  INT32_C(   241318609),  INT32_C(  2060962841) },
+      { -INT32_C(  1515054309), -INT32_C(  1554756371),  INT32_C(  1899017377),  INT32_C(   415438180), -INT32_C(  1618318592), -INT32_C(  1373122048), -INT32_C(  2087507859),  INT32_C(  1310939962),
+        -INT32_C(  1281264164), -INT32_C(  1396677343),  INT32_C(   241318609),  INT32_C(  2060962841),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(36165),
+      {  INT32_C(   369390437),  INT32_C(  1156593255),  INT32_C(   313753147), -INT32_C(    97409261),  INT32_C(   870338909), -INT32_C(  1323464805), -INT32_C(   153131315),  INT32_C(  1925273811),
+         INT32_C(  1224709075), -INT32_C(  2005346135),  INT32_C(  1383030474), -INT32_C(  1080127056), -INT32_C(  1078823378), -INT32_C(   286739821), -INT32_C(  1837792842),  INT32_C(  2029698369) },
+      {  INT32_C(   369390437),  INT32_C(   313753147), -INT32_C(   153131315),  INT32_C(  1224709075),  INT32_C(  1383030474), -INT32_C(  1080127056),  INT32_C(  2029698369),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(32259),
+      {  INT32_C(  1673654460), -INT32_C(   553262410),  INT32_C(   653522822),  INT32_C(   836179138),  INT32_C(   489568487),  INT32_C(  1507782679), -INT32_C(  2077816559), -INT32_C(   919212456),
+        -INT32_C(   328881107),  INT32_C(   117251464), -INT32_C(    29296425), -INT32_C(  1423068807),  INT32_C(   837582860),  INT32_C(   378490180), -INT32_C(   892391607), -INT32_C(   414431547) },
+      {  INT32_C(  1673654460), -INT32_C(   553262410),  INT32_C(   117251464), -INT32_C(    29296425), -INT32_C(  1423068807),  INT32_C(   837582860),  INT32_C(   378490180), -INT32_C(   892391607),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   931527409), -INT32_C(    75580596),  INT32_C(  1294354816),  INT32_C(  1156135522), -INT32_C(  1545937565), -INT32_C(   921006223),  INT32_C(  1126428600),  INT32_C(  1301539199),
+        -INT32_C(  1322022644),  INT32_C(    74105951), -INT32_C(   667085547), -INT32_C(   368730780),  INT32_C(  1655067682), -INT32_C(  1629388551),  INT32_C(  1637880458),  INT32_C(  1776500691) },
+      UINT16_C(28174),
+      { -INT32_C(  1001362150),  INT32_C(  1838851764), -INT32_C(    67008016),  INT32_C(   327146911), -INT32_C(  1970016467),  INT32_C(   586172542),  INT32_C(  1557334806), -INT32_C(  1669480746),
+        -INT32_C(  1524938289), -INT32_C(  1909442199),  INT32_C(  1661935645), -INT32_C(   458685451),  INT32_C(   313368668),  INT32_C(  2098150132),  INT32_C(    66116373),  INT32_C(  1580784408) },
+      {  INT32_C(  1838851764), -INT32_C(    67008016),  INT32_C(   327146911), -INT32_C(  1909442199),  INT32_C(  1661935645), -INT32_C(   458685451),  INT32_C(  2098150132),  INT32_C(    66116373),
+        -INT32_C(  1322022644),  INT32_C(    74105951), -INT32_C(   667085547), -INT32_C(   368730780),  INT32_C(  1655067682), -INT32_C(  1629388551),  INT32_C(  1637880458),  INT32_C(  1776500691) } },
+    { { -INT32_C(   827380892),  INT32_C(  1960430423), -INT32_C(   169078561), -INT32_C(   781230441),  INT32_C(  1268659727), -INT32_C(   450734988),  INT32_C(  1600825007),  INT32_C(   188179022),
+         INT32_C(    61098631),  INT32_C(  1777484369),  INT32_C(   411862641),  INT32_C(  1890104243), -INT32_C(   877405874), -INT32_C(   676429563),  INT32_C(  2052936603), -INT32_C(  2063386900) },
+      UINT16_C(21900),
+      { -INT32_C(  2044563395), -INT32_C(  1364197423),  INT32_C(    83184959),  INT32_C(   748028933), -INT32_C(  1542263399),  INT32_C(  2021719820),  INT32_C(  1544713978),  INT32_C(  1692496453),
+        -INT32_C(   340774860),  INT32_C(   942305015),  INT32_C(  1239250444),  INT32_C(  1475196082), -INT32_C(  1152821662),  INT32_C(  1156803956),  INT32_C(  1067194990), -INT32_C(  1530989962) },
+      {  INT32_C(    83184959),  INT32_C(   748028933),  INT32_C(  1692496453), -INT32_C(   340774860),  INT32_C(  1239250444), -INT32_C(  1152821662),  INT32_C(  1067194990),  INT32_C(   188179022),
+         INT32_C(    61098631),  INT32_C(  1777484369),  INT32_C(   411862641),  INT32_C(  1890104243), -INT32_C(   877405874), -INT32_C(   676429563),  INT32_C(  2052936603), -INT32_C(  2063386900) } },
+    { { -INT32_C(   340827687), -INT32_C(   662350809), -INT32_C(   471039739),  INT32_C(   190866860), -INT32_C(  1264965047), -INT32_C(  1247924001),  INT32_C(    78650669), -INT32_C(  1718012427),
+        -INT32_C(  2032590213), -INT32_C(  1621651780), -INT32_C(  1060581240), -INT32_C(  1112352167), -INT32_C(    92027046), -INT32_C(   294578319), -INT32_C(  1552366890), -INT32_C(  1459076895) },
+      UINT16_C(52273),
+      { -INT32_C(   476496788),  INT32_C(  1881933188), -INT32_C(   291752337),  INT32_C(   312732257), -INT32_C(   362639810),  INT32_C(  1439939553), -INT32_C(  1125081281), -INT32_C(  1861811474),
+         INT32_C(   802572307), -INT32_C(  1405402622), -INT32_C(   930485719),  INT32_C(  1314441381),  INT32_C(  1167813454), -INT32_C(   366545241),  INT32_C(   456560259),  INT32_C(   266221903) },
+      { -INT32_C(   476496788), -INT32_C(   362639810),  INT32_C(  1439939553), -INT32_C(   930485719),  INT32_C(  1314441381),  INT32_C(   456560259),  INT32_C(   266221903), -INT32_C(  1718012427),
+        -INT32_C(  2032590213), -INT32_C(  1621651780), -INT32_C(  1060581240), -INT32_C(  1112352167), -INT32_C(    92027046), -INT32_C(   294578319), -INT32_C(  1552366890), -INT32_C(  1459076895) } },
+    { {  INT32_C(   401788333),  INT32_C(   670847266), -INT32_C(  1539730269), -INT32_C(  2036253331), -INT32_C(  1540270037), -INT32_C(  1901113994),  INT32_C(  1703646827),  INT32_C(  2145894014),
+         INT32_C(   446747541), -INT32_C(   984530109),  INT32_C(  1641717163),  INT32_C(   364578186),  INT32_C(   232958118),  INT32_C(   297145963), -INT32_C(   279516959),  INT32_C(  1495725114) },
+      UINT16_C(61526),
+      { -INT32_C(   849997115), -INT32_C(   235996573), -INT32_C(  2115887781),  INT32_C(  1483953286), -INT32_C(  1097099326), -INT32_C(  1605224540),  INT32_C(   363679770),  INT32_C(    30081198),
+        -INT32_C(  1609481567),  INT32_C(  1257888343),  INT32_C(  1845931954),  INT32_C(   894941865), -INT32_C(   727065433), -INT32_C(   894029308), -INT32_C(   667422118),  INT32_C(   683398995) },
+      { -INT32_C(   235996573), -INT32_C(  2115887781), -INT32_C(  1097099326),  INT32_C(   363679770), -INT32_C(   727065433), -INT32_C(   894029308), -INT32_C(   667422118),  INT32_C(   683398995),
+         INT32_C(   446747541), -INT32_C(   984530109),  INT32_C(  1641717163),  INT32_C(   364578186),  INT32_C(   232958118),  INT32_C(   297145963), -INT32_C(   279516959),  INT32_C(  1495725114) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r[16];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm512_mask_compressstoreu_epi32(r, test_vec[i].k, a);
+    simde_assert_equal_vi32(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 8681069584612229676), -INT64_C( 2735041508068229245),  INT64_C( 5930923526197399679), -INT64_C( 4662712999255175641),
+         INT64_C( 1265380538038757321),  INT64_C( 2728176334848669080), -INT64_C( 8272404950517964966),  INT64_C(  810777575662256808) },
+      UINT8_C(  1),
+      {  INT64_C(  640372847328306536),  INT64_C( 4380817521748116502), -INT64_C( 4315750743702249867),  INT64_C( 6053004466398248051),
+        -INT64_C( 3036367121820806597), -INT64_C( 5219891179694309078), -INT64_C( 2440809934501554253), -INT64_C( 8729854887447971754) },
+      {  INT64_C(  640372847328306536), -INT64_C( 2735041508068229245),  INT64_C( 5930923526197399679), -INT64_C( 4662712999255175641),
+         INT64_C( 1265380538038757321),  INT64_C( 2728176334848669080), -INT64_C( 8272404950517964966),  INT64_C(  810777575662256808) } },
+    { { -INT64_C(  673126234191743437),  INT64_C( 1308016042936449846), -INT64_C( 6257126631530081063),  INT64_C(  116185798502379176),
+         INT64_C( 4534895428600346607),  INT64_C( 6568726839708675035), -INT64_C( 1340877373069523699),  INT64_C( 8417892724545537266) },
+      UINT8_C(219),
+      {  INT64_C( 2054022264969873162),  INT64_C( 3748643263100877393), -INT64_C( 7905206311441735407), -INT64_C( 2694056344894326099),
+        -INT64_C( 6152605906327779444),  INT64_C( 4361585858458653436),  INT64_C( 1671803807414900435),  INT64_C( 1061977983190826565) },
+      {  INT64_C( 2054022264969873162),  INT64_C( 3748643263100877393), -INT64_C( 2694056344894326099), -INT64_C( 6152605906327779444),
+         INT64_C( 1671803807414900435),  INT64_C( 1061977983190826565), -INT64_C( 1340877373069523699),  INT64_C( 8417892724545537266) } },
+    { { -INT64_C( 8774863353769828540),  INT64_C( 9153296815085654578),  INT64_C( 8249683779908228638), -INT64_C( 1712010798706068494),
+         INT64_C( 2621802514651452408), -INT64_C( 1795363595859193812),  INT64_C( 7146526907934548639), -INT64_C(  176204518432804442) },
+      UINT8_C(210),
+      {  INT64_C( 2896949970854013383), -INT64_C( 7202280189321702204),  INT64_C( 3597827615569424372),  INT64_C( 3797739156770750472),
+        -INT64_C(   10098469746612616),  INT64_C( 8950581998394018782),  INT64_C( 6964448152291194085), -INT64_C( 4033934066130762729) },
+      { -INT64_C( 7202280189321702204), -INT64_C(   10098469746612616),  INT64_C( 6964448152291194085), -INT64_C( 4033934066130762729),
+         INT64_C( 2621802514651452408), -INT64_C( 1795363595859193812),  INT64_C( 7146526907934548639), -INT64_C(  176204518432804442) } },
+    { { -INT64_C( 3823043529999812761), -INT64_C(  274087148004255247), -INT64_C( 1343399579657440663), -INT64_C( 6735896126368093399),
+        -INT64_C( 2069314226943635656), -INT64_C( 1870473607948004501), -INT64_C( 1993591591482099323), -INT64_C( 8267613835481829528) },
+      UINT8_C(130),
+      { -INT64_C( 3893243607986265980),  INT64_C( 8209411215470942259), -INT64_C( 1748910465907681756), -INT64_C(  466663329689479977),
+        -INT64_C( 8948419336509003234),  INT64_C( 5606816770714560376), -INT64_C( 8863832910094581771), -INT64_C( 4382516694899592043) },
+      {  INT64_C( 8209411215470942259), -INT64_C( 4382516694899592043), -INT64_C( 1343399579657440663), -INT64_C( 6735896126368093399),
+        -INT64_C( 2069314226943635656), -INT64_C( 1870473607948004501), -INT64_C( 1993591591482099323), -INT64_C( 8267613835481829528) } },
+    { { -INT64_C( 1531031652036532424),  INT64_C( 7728059924378024019), -INT64_C( 7660931746018762127), -INT64_C( 8534762620768895293),
+         INT64_C( 7765024009385595503),  INT64_C( 4676594016013417907), -INT64_C( 8911641976717099092), -INT64_C( 1730760024380513226) },
+      UINT8_C(251),
+      {  INT64_C( 5907686136171150359), -INT64_C( 2954204036578881595),  INT64_C( 7622728509429169163), -INT64_C( 5354584497675506180),
+        -INT64_C( 7003649423356860820), -INT64_C( 1237666648148051604), -INT64_C( 1208619097348486016), -INT64_C( 8852401644992212659) },
+      {  INT64_C( 5907686136171150359), -INT64_C( 2954204036578881595), -INT64_C( 5354584497675506180), -INT64_C( 7003649423356860820),
+        -INT64_C( 1237666648148051604), -INT64_C( 1208619097348486016), -INT64_C( 8852401644992212659), -INT64_C( 1730760024380513226) } },
+    { { -INT64_C( 8723757646375270750), -INT64_C(  820185669726370512),  INT64_C( 6045725407506767906),  INT64_C( 8676501559027497664),
+         INT64_C( 8214746301084491674),  INT64_C(  482920922176963480), -INT64_C( 8401051505585236316),  INT64_C( 2136784791522555148) },
+      UINT8_C(191),
+      {  INT64_C( 4790902251122162839),  INT64_C( 2528715312610610367),  INT64_C(  852467717266540249),  INT64_C( 3110127490275400989),
+        -INT64_C( 5991677747709098595), -INT64_C( 7418163066084000604), -INT64_C( 4443851885478106444), -INT64_C(  487410475595318930) },
+      {  INT64_C( 4790902251122162839),  INT64_C( 2528715312610610367),  INT64_C(  852467717266540249),  INT64_C( 3110127490275400989),
+        -INT64_C( 5991677747709098595), -INT64_C( 7418163066084000604), -INT64_C(  487410475595318930),  INT64_C( 2136784791522555148) } },
+    { {  INT64_C( 6137843933027293253), -INT64_C( 3732531456166046547),  INT64_C( 8968946152343705016),  INT64_C( 5916032432071662402),
+        -INT64_C( 5029455328129052979),  INT64_C( 4611988977785658944), -INT64_C( 3912229009501679286),  INT64_C( 8565129931569253362) },
+      UINT8_C(218),
+      {  INT64_C( 4708294467207061706),  INT64_C( 8216692751929665691), -INT64_C( 5645307157364772290),  INT64_C( 4616092504342893675),
+         INT64_C( 6740202906415726131), -INT64_C(  717630072793181416), -INT64_C( 6526730033967436739),  INT64_C( 6377903391753155074) },
+      {  INT64_C( 8216692751929665691),  INT64_C( 4616092504342893675),  INT64_C( 6740202906415726131), -INT64_C( 6526730033967436739),
+         INT64_C( 6377903391753155074),  INT64_C( 4611988977785658944), -INT64_C( 3912229009501679286),  INT64_C( 8565129931569253362) } },
+    { {  INT64_C( 3477685882214589151), -INT64_C( 4638771744526296667), -INT64_C( 2219160420468135788), -INT64_C( 1987926850433341182),
+        -INT64_C( 1398606509093223464),  INT64_C( 2076694747498778960),  INT64_C( 4808663743693575422), -INT64_C( 8481054327639504606) },
+      UINT8_C(  3),
+      {  INT64_C( 6987567273900643076),  INT64_C( 1111177884766231117),  INT64_C(  775462417955868959), -INT64_C( 7340418545033218869),
+        -INT64_C( 7160889970884623396), -INT64_C( 3028268157212806555),  INT64_C( 4827236026585418281),  INT64_C( 2192574113233565569) },
+      {  INT64_C( 6987567273900643076),  INT64_C( 1111177884766231117), -INT64_C( 2219160420468135788), -INT64_C( 1987926850433341182),
+        -INT64_C( 1398606509093223464),  INT64_C( 2076694747498778960),  INT64_C( 4808663743693575422), -INT64_C( 8481054327639504606) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 85),
+      {  INT64_C( 4644733450491212584), -INT64_C( 7136964847175598117), -INT64_C( 3113464009569958900), -INT64_C( 5949397782408022488),
+         INT64_C( 4426514770540321904), -INT64_C( 1281327966003838688), -INT64_C( 3186361678228599508), -INT64_C( 5254090456642188006) },
+      {  INT64_C( 4644733450491212584), -INT64_C( 3113464009569958900),  INT64_C( 4426514770540321904), -INT64_C( 3186361678228599508),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(162),
+      {  INT64_C( 7899447205555923923), -INT64_C( 7554665076075631158),  INT64_C( 8100605577331282301), -INT64_C( 2257175051566168289),
+         INT64_C(  218724575652309137), -INT64_C( 7741844656559692947),  INT64_C( 8835970702604209076),  INT64_C( 3353714351910029788) },
+      { -INT64_C( 7554665076075631158), -INT64_C( 7741844656559692947),  INT64_C( 3353714351910029788),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      { -INT64_C( 7050308036887294953),  INT64_C( 3648432905314615512), -INT64_C( 3268586002328041999), -INT64_C( 7427324011405509542),
+         INT64_C( 4376158911060889062),  INT64_C( 4460079044904038486), -INT64_C( 2852059678115438586), -INT64_C( 2533128449383063433) },
+      {  INT64_C( 3648432905314615512),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 88),
+      {  INT64_C( 8034766906116680422), -INT64_C( 5316778993379723055),  INT64_C( 2851313078468669149), -INT64_C( 5241342967545278062),
+         INT64_C( 6281040742238614090),  INT64_C( 7646167422039241971),  INT64_C( 5547992862534010386),  INT64_C(  694928379103988823) },
+      { -INT64_C( 5241342967545278062),  INT64_C( 6281040742238614090),  INT64_C( 5547992862534010386),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(249),
+      { -INT64_C( 9143538276882530301),  INT64_C( 4759387183574850781),  INT64_C( 9194544446299326146),  INT64_C( 5104049709890191622),
+         INT64_C( 4103935237545045947),  INT64_C( 7939583086113528345),  INT64_C( 5684490530284392969),  INT64_C(  427759933806963488) },
+      { -INT64_C( 9143538276882530301),  INT64_C( 5104049709890191622),  INT64_C( 4103935237545045947),  INT64_C( 7939583086113528345),
+         INT64_C( 5684490530284392969),  INT64_C(  427759933806963488),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(241),
+      { -INT64_C( 2479965667953918190),  INT64_C( 7229376345913572581),  INT64_C( 8906787494813481090),  INT64_C( 7279287386866860545),
+         INT64_C( 5643079937323450420), -INT64_C( 4254292777937926432), -INT64_C( 4704006208343076684),  INT64_C( 2745293445797351561) },
+      { -INT64_C( 2479965667953918190),  INT64_C( 5643079937323450420), -INT64_C( 4254292777937926432), -INT64_C( 4704006208343076684),
+         INT64_C( 2745293445797351561),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  4),
+      { -INT64_C( 1700245788098536907), -INT64_C( 2940265253025705843), -INT64_C( 7937832653553963226),  INT64_C( 4922218444353290423),
+         INT64_C( 6704601517784906937), -INT64_C(  278303850255042320),  INT64_C( 5366713581606196313),  INT64_C( 4385391265502554993) },
+      { -INT64_C( 7937832653553963226),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 87),
+      { -INT64_C(  357532968422315534), -INT64_C( 2325002121184924757),  INT64_C( 7013514702122501281), -INT64_C( 7199911862295017090),
+         INT64_C( 7405610258913798739),  INT64_C( 3732375218767402290),  INT64_C( 1699345464662209633),  INT64_C( 4269155850585940018) },
+      { -INT64_C(  357532968422315534), -INT64_C( 2325002121184924757),  INT64_C( 7013514702122501281),  INT64_C( 7405610258913798739),
+         INT64_C( 1699345464662209633),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(  619612673994195876), -INT64_C( 1742841638126670137), -INT64_C( 5630390570198792450),  INT64_C( 1787939519632281740),
+         INT64_C( 5393848660550738395), -INT64_C( 4477638496599214116), -INT64_C( 4888496382771004969),  INT64_C( 2112174189489217878) },
+      UINT8_C(131),
+      {  INT64_C( 5749139699573136414),  INT64_C( 4117644149527380442), -INT64_C( 8633892322079786384), -INT64_C( 1143987233441148466),
+         INT64_C( 9043177185016933414), -INT64_C( 3057507374007584210),  INT64_C( 6166561740727985747),  INT64_C( 6833021401866185600) },
+      {  INT64_C( 5749139699573136414),  INT64_C( 4117644149527380442),  INT64_C( 6833021401866185600),  INT64_C( 1787939519632281740),
+         INT64_C( 5393848660550738395), -INT64_C( 4477638496599214116), -INT64_C( 4888496382771004969),  INT64_C( 2112174189489217878) } },
+    { {  INT64_C( 2244725356030562759), -INT64_C( 7488848574375813279), -INT64_C( 2705732566638425273), -INT64_C( 5091903108167248463),
+         INT64_C( 6701303393012182640), -INT64_C( 4242849500710077479), -INT64_C( 9039187528149077478),  INT64_C( 3453922923024973325) },
+      UINT8_C(133),
+      { -INT64_C( 6036965247332011886), -INT64_C( 6661868594921597001),  INT64_C( 3672566091171593017), -INT64_C( 2834644842537081962),
+         INT64_C( 8329222791579445417), -INT64_C( 7364054919070491606),  INT64_C( 6403155626665754948),  INT64_C( 8377420904362301193) },
+      { -INT64_C( 6036965247332011886),  INT64_C( 3672566091171593017),  INT64_C( 8377420904362301193), -INT64_C( 5091903108167248463),
+         INT64_C( 6701303393012182640), -INT64_C( 4242849500710077479), -INT64_C( 9039187528149077478),  INT64_C( 3453922923024973325) } },
+    { { -INT64_C( 1700071331027814809), -INT64_C( 3840927506942150295), -INT64_C( 1848056538384566373),  INT64_C( 4021870232662801907),
+        -INT64_C( 3622931053961437885), -INT64_C( 3784096059141481685),  INT64_C( 3238792609008425959),  INT64_C( 3795726907900106398) },
+      UINT8_C(128),
+      { -INT64_C( 7232129657892560188),  INT64_C( 6105060923118007359),  INT64_C( 7151515280460185380), -INT64_C( 2530330632609528277),
+         INT64_C( 2488417556479928477), -INT64_C( 3214930854893173381), -INT64_C( 2259895523994011741),  INT64_C( 5825006787425386957) },
+      {  INT64_C( 5825006787425386957), -INT64_C( 3840927506942150295), -INT64_C( 1848056538384566373),  INT64_C( 4021870232662801907),
+        -INT64_C( 3622931053961437885), -INT64_C( 3784096059141481685),  INT64_C( 3238792609008425959),  INT64_C( 3795726907900106398) } },
+    { { -INT64_C( 2608673923322237931),  INT64_C( 2846822038649110651), -INT64_C( 2750591602369033775),  INT64_C( 7304104166075154919),
+         INT64_C( 8473944683071303050), -INT64_C( 3737920295459270407),  INT64_C( 6120654405324888017),  INT64_C( 7831140398165549466) },
+      UINT8_C( 72),
+      { -INT64_C( 4343180878185906897),  INT64_C( 2145135540032450472),  INT64_C(  214189018377729199), -INT64_C( 8267552356185064249),
+         INT64_C(  785634447241170561), -INT64_C( 1062198930530846441),  INT64_C( 4396218853538519464), -INT64_C( 7743724424122289353) },
+      { -INT64_C( 8267552356185064249),  INT64_C( 4396218853538519464), -INT64_C( 2750591602369033775),  INT64_C( 7304104166075154919),
+         INT64_C( 8473944683071303050), -INT64_C( 3737920295459270407),  INT64_C( 6120654405324888017),  INT64_C( 7831140398165549466) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r[8];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm512_mask_compressstoreu_epi64(r, test_vec[i].k, a);
+    simde_assert_equal_vi64(sizeof(r) / sizeof(r[0]), r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -881.43), SIMDE_FLOAT32_C(   897.38), SIMDE_FLOAT32_C(   255.50), SIMDE_FLOAT32_C(   704.62),
+        SIMDE_FLOAT32_C(  -569.42), SIMDE_FLOAT32_C(  -704.95), SIMDE_FLOAT32_C(  -203.25), SIMDE_FLOAT32_C(   278.20),
+        SIMDE_FLOAT32_C(  -292.26), SIMDE_FLOAT32_C(  -609.13), SIMDE_FLOAT32_C(   427.47), SIMDE_FLOAT32_C(  -150.98),
+        SIMDE_FLOAT32_C(   746.34), SIMDE_FLOAT32_C(   660.19), SIMDE_FLOAT32_C(   204.07), SIMDE_FLOAT32_C(  -863.69) },
+      UINT16_C(59574),
+      { SIMDE_FLOAT32_C(  -688.64), SIMDE_FLOAT32_C(  -579.89), SIMDE_FLOAT32_C(   129.81), SIMDE_FLOAT32_C(  -112.32),
+        SIMDE_FLOAT32_C(   -38.85), SIMDE_FLOAT32_C(   753.40), SIMDE_FLOAT32_C(  -959.89), SIMDE_FLOAT32_C(  -690.82),
+        SIMDE_FLOAT32_C(  -343.67), SIMDE_FLOAT32_C(   813.60), SIMDE_FLOAT32_C(  -596.54), SIMDE_FLOAT32_C(   948.11),
+        SIMDE_FLOAT32_C(   -28.53), SIMDE_FLOAT32_C(  -459.01), SIMDE_FLOAT32_C(  -697.67), SIMDE_FLOAT32_C(   -21.60) },
+      { SIMDE_FLOAT32_C(  -579.89), SIMDE_FLOAT32_C(   129.81), SIMDE_FLOAT32_C(   -38.85), SIMDE_FLOAT32_C(   753.40),
+        SIMDE_FLOAT32_C(  -690.82), SIMDE_FLOAT32_C(   948.11), SIMDE_FLOAT32_C(  -459.01), SIMDE_FLOAT32_C(  -697.67),
+        SIMDE_FLOAT32_C(   -21.60), SIMDE_FLOAT32_C(  -609.13), SIMDE_FLOAT32_C(   427.47), SIMDE_FLOAT32_C(  -150.98),
+        SIMDE_FLOAT32_C(   746.34), SIMDE_FLOAT32_C(   660.19), SIMDE_FLOAT32_C(   204.07), SIMDE_FLOAT32_C(  -863.69) } },
+    { { SIMDE_FLOAT32_C(   978.81), SIMDE_FLOAT32_C(   174.17), SIMDE_FLOAT32_C(   808.07), SIMDE_FLOAT32_C(  -871.47),
+        SIMDE_FLOAT32_C(   879.41), SIMDE_FLOAT32_C(   694.40), SIMDE_FLOAT32_C(  -792.91), SIMDE_FLOAT32_C(  -541.45),
+        SIMDE_FLOAT32_C(   -63.81), SIMDE_FLOAT32_C(   908.04), SIMDE_FLOAT32_C(   799.35), SIMDE_FLOAT32_C(  -979.93),
+        SIMDE_FLOAT32_C(  -353.52), SIMDE_FLOAT32_C(  -184.07), SIMDE_FLOAT32_C(   783.93), SIMDE_FLOAT32_C(   730.08) },
+      UINT16_C(13648),
+      { SIMDE_FLOAT32_C(   712.27), SIMDE_FLOAT32_C(  -242.74), SIMDE_FLOAT32_C(  -410.61), SIMDE_FLOAT32_C(   481.20),
+        SIMDE_FLOAT32_C(   703.90), SIMDE_FLOAT32_C(  -452.63), SIMDE_FLOAT32_C(  -525.83), SIMDE_FLOAT32_C(   122.41),
+        SIMDE_FLOAT32_C(   913.96), SIMDE_FLOAT32_C(  -984.89), SIMDE_FLOAT32_C(   956.34), SIMDE_FLOAT32_C(   -53.81),
+        SIMDE_FLOAT32_C(  -855.92), SIMDE_FLOAT32_C(   230.21), SIMDE_FLOAT32_C(   333.85), SIMDE_FLOAT32_C(  -777.02) },
+      { SIMDE_FLOAT32_C(   703.90), SIMDE_FLOAT32_C(  -525.83), SIMDE_FLOAT32_C(   913.96), SIMDE_FLOAT32_C(   956.34),
+        SIMDE_FLOAT32_C(  -855.92), SIMDE_FLOAT32_C(   230.21), SIMDE_FLOAT32_C(  -792.91), SIMDE_FLOAT32_C(  -541.45),
+        SIMDE_FLOAT32_C(   -63.81), SIMDE_FLOAT32_C(   908.04), SIMDE_FLOAT32_C(   799.35), SIMDE_FLOAT32_C(  -979.93),
+        SIMDE_FLOAT32_C(  -353.52), SIMDE_FLOAT32_C(  -184.07), SIMDE_FLOAT32_C(   783.93), SIMDE_FLOAT32_C(   730.08) } },
+    { { SIMDE_FLOAT32_C(  -668.52), SIMDE_FLOAT32_C(   -41.96), SIMDE_FLOAT32_C(   156.46), SIMDE_FLOAT32_C(  -648.04),
+        SIMDE_FLOAT32_C(    65.50), SIMDE_FLOAT32_C(   772.90), SIMDE_FLOAT32_C(  -634.56), SIMDE_FLOAT32_C(  -416.21),
+        SIMDE_FLOAT32_C(  -655.63), SIMDE_FLOAT32_C(  -617.25), SIMDE_FLOAT32_C(  -831.09), SIMDE_FLOAT32_C(  -603.85),
+        SIMDE_FLOAT32_C(  -744.79), SIMDE_FLOAT32_C(   109.00), SIMDE_FLOAT32_C(   403.13), SIMDE_FLOAT32_C(   765.73) },
+      UINT16_C(18476),
+      { SIMDE_FLOAT32_C(   446.20), SIMDE_FLOAT32_C(  -732.53), SIMDE_FLOAT32_C(   783.83), SIMDE_FLOAT32_C(   389.33),
+        SIMDE_FLOAT32_C(   208.24), SIMDE_FLOAT32_C(   904.43), SIMDE_FLOAT32_C(   220.56), SIMDE_FLOAT32_C(   362.44),
+        SIMDE_FLOAT32_C(    44.82), SIMDE_FLOAT32_C(   -58.57), SIMDE_FLOAT32_C(  -880.24), SIMDE_FLOAT32_C(  -760.56),
+        SIMDE_FLOAT32_C(   655.22), SIMDE_FLOAT32_C(  -484.79), SIMDE_FLOAT32_C(  -933.75), SIMDE_FLOAT32_C(   197.12) },
+      { SIMDE_FLOAT32_C(   783.83), SIMDE_FLOAT32_C(   389.33), SIMDE_FLOAT32_C(   904.43), SIMDE_FLOAT32_C(  -760.56),
+        SIMDE_FLOAT32_C(  -933.75), SIMDE_FLOAT32_C(   772.90), SIMDE_FLOAT32_C(  -634.56), SIMDE_FLOAT32_C(  -416.21),
+        SIMDE_FLOAT32_C(  -655.63), SIMDE_FLOAT32_C(  -617.25), SIMDE_FLOAT32_C(  -831.09), SIMDE_FLOAT32_C(  -603.85),
+        SIMDE_FLOAT32_C(  -744.79), SIMDE_FLOAT32_C(   109.00), SIMDE_FLOAT32_C(   403.13), SIMDE_FLOAT32_C(   765.73) } },
+    { { SIMDE_FLOAT32_C(  -159.18), SIMDE_FLOAT32_C(  -232.38), SIMDE_FLOAT32_C(    35.24), SIMDE_FLOAT32_C(   314.66),
+        SIMDE_FLOAT32_C(  -869.21), SIMDE_FLOAT32_C(   340.28), SIMDE_FLOAT32_C(   595.09), SIMDE_FLOAT32_C(    56.59),
+        SIMDE_FLOAT32_C(  -533.64), SIMDE_FLOAT32_C(   -64.29), SIMDE_FLOAT32_C(  -291.18), SIMDE_FLOAT32_C(   -62.93),
+        SIMDE_FLOAT32_C(  -526.87), SIMDE_FLOAT32_C(   759.47), SIMDE_FLOAT32_C(  -254.00), SIMDE_FLOAT32_C(   620.90) },
+      UINT16_C(  128),
+      { SIMDE_FLOAT32_C(  -311.75), SIMDE_FLOAT32_C(   176.93), SIMDE_FLOAT32_C(   125.72), SIMDE_FLOAT32_C(  -376.93),
+        SIMDE_FLOAT32_C(   140.17), SIMDE_FLOAT32_C(  -351.13), SIMDE_FLOAT32_C(   630.65), SIMDE_FLOAT32_C(   892.63),
+        SIMDE_FLOAT32_C(    93.33), SIMDE_FLOAT32_C(   145.51), SIMDE_FLOAT32_C(  -270.70), SIMDE_FLOAT32_C(   587.89),
+        SIMDE_FLOAT32_C(  -843.13), SIMDE_FLOAT32_C(  -339.10), SIMDE_FLOAT32_C(   -87.22), SIMDE_FLOAT32_C(   500.03) },
+      { SIMDE_FLOAT32_C(   892.63), SIMDE_FLOAT32_C(  -232.38), SIMDE_FLOAT32_C(    35.24), SIMDE_FLOAT32_C(   314.66),
+        SIMDE_FLOAT32_C(  -869.21), SIMDE_FLOAT32_C(   340.28), SIMDE_FLOAT32_C(   595.09), SIMDE_FLOAT32_C(    56.59),
+        SIMDE_FLOAT32_C(  -533.64), SIMDE_FLOAT32_C(   -64.29), SIMDE_FLOAT32_C(  -291.18), SIMDE_FLOAT32_C(   -62.93),
+        SIMDE_FLOAT32_C(  -526.87), SIMDE_FLOAT32_C(   759.47), SIMDE_FLOAT32_C(  -254.00), SIMDE_FLOAT32_C(   620.90) } },
+    { { SIMDE_FLOAT32_C(  -175.19), SIMDE_FLOAT32_C(   570.36), SIMDE_FLOAT32_C(   147.86), SIMDE_FLOAT32_C(  -870.50),
+        SIMDE_FLOAT32_C(   602.59), SIMDE_FLOAT32_C(  -163.69), SIMDE_FLOAT32_C(  -202.10), SIMDE_FLOAT32_C(   -21.54),
+        SIMDE_FLOAT32_C(  -414.38), SIMDE_FLOAT32_C(  -472.74), SIMDE_FLOAT32_C(   366.74), SIMDE_FLOAT32_C(  -231.18),
+        SIMDE_FLOAT32_C(   808.33), SIMDE_FLOAT32_C(  -885.20), SIMDE_FLOAT32_C(   130.22), SIMDE_FLOAT32_C(  -284.80) },
+      UINT16_C(33748),
+      { SIMDE_FLOAT32_C(    94.41), SIMDE_FLOAT32_C(  -720.36), SIMDE_FLOAT32_C(   670.84), SIMDE_FLOAT32_C(   988.07),
+        SIMDE_FLOAT32_C(  -346.55), SIMDE_FLOAT32_C(   590.79), SIMDE_FLOAT32_C(  -974.28), SIMDE_FLOAT32_C(   107.76),
+        SIMDE_FLOAT32_C(   853.94), SIMDE_FLOAT32_C(   433.95), SIMDE_FLOAT32_C(   534.11), SIMDE_FLOAT32_C(  -283.06),
+        SIMDE_FLOAT32_C(  -559.63), SIMDE_FLOAT32_C(   937.31), SIMDE_FLOAT32_C(  -146.23), SIMDE_FLOAT32_C(  -677.47) },
+      { SIMDE_FLOAT32_C(   670.84), SIMDE_FLOAT32_C(  -346.55), SIMDE_FLOAT32_C(  -974.28), SIMDE_FLOAT32_C(   107.76),
+        SIMDE_FLOAT32_C(   853.94), SIMDE_FLOAT32_C(   433.95), SIMDE_FLOAT32_C(  -677.47), SIMDE_FLOAT32_C(   -21.54),
+        SIMDE_FLOAT32_C(  -414.38), SIMDE_FLOAT32_C(  -472.74), SIMDE_FLOAT32_C(   366.74), SIMDE_FLOAT32_C(  -231.18),
+        SIMDE_FLOAT32_C(   808.33), SIMDE_FLOAT32_C(  -885.20), SIMDE_FLOAT32_C(   130.22), SIMDE_FLOAT32_C(  -284.80) } },
+    { { SIMDE_FLOAT32_C(  -701.59), SIMDE_FLOAT32_C(   -56.06), SIMDE_FLOAT32_C(   -22.39), SIMDE_FLOAT32_C(    73.49),
+        SIMDE_FLOAT32_C(  -173.10), SIMDE_FLOAT32_C(  -765.08), SIMDE_FLOAT32_C(   417.52), SIMDE_FLOAT32_C(  -334.54),
+        SIMDE_FLOAT32_C(  -145.67), SIMDE_FLOAT32_C(  -618.10), SIMDE_FLOAT32_C(   794.88), SIMDE_FLOAT32_C(  -341.70),
+        SIMDE_FLOAT32_C(  -879.43), SIMDE_FLOAT32_C(    81.99), SIMDE_FLOAT32_C(    74.44), SIMDE_FLOAT32_C(  -953.08) },
+      UINT16_C(37991),
+      { SIMDE_FLOAT32_C(    39.01), SIMDE_FLOAT32_C(  -112.62), SIMDE_FLOAT32_C(  -403.20), SIMDE_FLOAT32_C(   323.35),
+        SIMDE_FLOAT32_C(   628.08), SIMDE_FLOAT32_C(   809.86), SIMDE_FLOAT32_C(   -78.84), SIMDE_FLOAT32_C(  -341.69),
+        SIMDE_FLOAT32_C(     9.82), SIMDE_FLOAT32_C(  -884.27), SIMDE_FLOAT32_C(   501.57), SIMDE_FLOAT32_C(   187.02),
+        SIMDE_FLOAT32_C(  -551.39), SIMDE_FLOAT32_C(  -424.60), SIMDE_FLOAT32_C(   336.14), SIMDE_FLOAT32_C(   253.18) },
+      { SIMDE_FLOAT32_C(    39.01), SIMDE_FLOAT32_C(  -112.62), SIMDE_FLOAT32_C(  -403.20), SIMDE_FLOAT32_C(   809.86),
+        SIMDE_FLOAT32_C(   -78.84), SIMDE_FLOAT32_C(   501.57), SIMDE_FLOAT32_C(  -551.39), SIMDE_FLOAT32_C(   253.18),
+        SIMDE_FLOAT32_C(  -145.67), SIMDE_FLOAT32_C(  -618.10), SIMDE_FLOAT32_C(   794.88), SIMDE_FLOAT32_C(  -341.70),
+        SIMDE_FLOAT32_C(  -879.43), SIMDE_FLOAT32_C(    81.99), SIMDE_FLOAT32_C(    74.44), SIMDE_FLOAT32_C(  -953.08) } },
+    { { SIMDE_FLOAT32_C(   392.39), SIMDE_FLOAT32_C(  -163.04), SIMDE_FLOAT32_C(   595.50), SIMDE_FLOAT32_C(  -744.70),
+        SIMDE_FLOAT32_C(  -466.06), SIMDE_FLOAT32_C(  -557.41), SIMDE_FLOAT32_C(   -47.96), SIMDE_FLOAT32_C(   828.61),
+        SIMDE_FLOAT32_C(  -153.63), SIMDE_FLOAT32_C(   532.36), SIMDE_FLOAT32_C(   732.58), SIMDE_FLOAT32_C(    37.07),
+        SIMDE_FLOAT32_C(   646.45), SIMDE_FLOAT32_C(   876.78), SIMDE_FLOAT32_C(  -140.67), SIMDE_FLOAT32_C(  -640.86) },
+      UINT16_C(57341),
+      { SIMDE_FLOAT32_C(    74.71), SIMDE_FLOAT32_C(    -1.27), SIMDE_FLOAT32_C(  -971.07), SIMDE_FLOAT32_C(   -45.98),
+        SIMDE_FLOAT32_C(   785.16), SIMDE_FLOAT32_C(   215.96), SIMDE_FLOAT32_C(   306.52), SIMDE_FLOAT32_C(  -105.80),
+        SIMDE_FLOAT32_C(  -895.42), SIMDE_FLOAT32_C(   332.02), SIMDE_FLOAT32_C(   522.58), SIMDE_FLOAT32_C(   477.55),
+        SIMDE_FLOAT32_C(   925.97), SIMDE_FLOAT32_C(   153.19), SIMDE_FLOAT32_C(  -801.87), SIMDE_FLOAT32_C(   650.68) },
+      { SIMDE_FLOAT32_C(    74.71), SIMDE_FLOAT32_C(  -971.07), SIMDE_FLOAT32_C(   -45.98), SIMDE_FLOAT32_C(   785.16),
+        SIMDE_FLOAT32_C(   215.96), SIMDE_FLOAT32_C(   306.52), SIMDE_FLOAT32_C(  -105.80), SIMDE_FLOAT32_C(  -895.42),
+        SIMDE_FLOAT32_C(   332.02), SIMDE_FLOAT32_C(   522.58), SIMDE_FLOAT32_C(   477.55), SIMDE_FLOAT32_C(   925.97),
+        SIMDE_FLOAT32_C(  -801.87), SIMDE_FLOAT32_C(   650.68), SIMDE_FLOAT32_C(  -140.67), SIMDE_FLOAT32_C(  -640.86) } },
+    { { SIMDE_FLOAT32_C(   570.62), SIMDE_FLOAT32_C(  -358.69), SIMDE_FLOAT32_C(  -454.07), SIMDE_FLOAT32_C(  -914.72),
+        SIMDE_FLOAT32_C(  -840.09), SIMDE_FLOAT32_C(   824.24), SIMDE_FLOAT32_C(  -276.15), SIMDE_FLOAT32_C(  -251.79),
+        SIMDE_FLOAT32_C(   317.62), SIMDE_FLOAT32_C(   922.25), SIMDE_FLOAT32_C(   585.58), SIMDE_FLOAT32_C(   630.47),
+        SIMDE_FLOAT32_C(  -707.78), SIMDE_FLOAT32_C(   637.29), SIMDE_FLOAT32_C(   -30.72), SIMDE_FLOAT32_C(  -712.08) },
+      UINT16_C(47699),
+      { SIMDE_FLOAT32_C(   868.18), SIMDE_FLOAT32_C(   908.30), SIMDE_FLOAT32_C(   416.66), SIMDE_FLOAT32_C(   577.15),
+        SIMDE_FLOAT32_C(  -599.03), SIMDE_FLOAT32_C(  -464.21), SIMDE_FLOAT32_C(    -7.30), SIMDE_FLOAT32_C(  -438.99),
+        SIMDE_FLOAT32_C(  -412.21), SIMDE_FLOAT32_C(  -457.34), SIMDE_FLOAT32_C(  -507.17), SIMDE_FLOAT32_C(   847.01),
+        SIMDE_FLOAT32_C(  -586.90), SIMDE_FLOAT32_C(  -912.49), SIMDE_FLOAT32_C(   553.87), SIMDE_FLOAT32_C(  -607.36) },
+      { SIMDE_FLOAT32_C(   868.18), SIMDE_FLOAT32_C(   908.30), SIMDE_FLOAT32_C(  -599.03), SIMDE_FLOAT32_C(    -7.30),
+        SIMDE_FLOAT32_C(  -457.34), SIMDE_FLOAT32_C(   847.01), SIMDE_FLOAT32_C(  -586.90), SIMDE_FLOAT32_C(  -912.49),
+        SIMDE_FLOAT32_C(  -607.36), SIMDE_FLOAT32_C(   922.25), SIMDE_FLOAT32_C(   585.58), SIMDE_FLOAT32_C(   630.47),
+        SIMDE_FLOAT32_C(  -707.78), SIMDE_FLOAT32_C(   637.29), SIMDE_FLOAT32_C(   -30.72), SIMDE_FLOAT32_C(  -712.08) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_compress_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(36869),
+      { SIMDE_FLOAT32_C(  -205.58), SIMDE_FLOAT32_C(    89.84), SIMDE_FLOAT32_C(   -42.56), SIMDE_FLOAT32_C(  -894.23),
+        SIMDE_FLOAT32_C(  -166.84), SIMDE_FLOAT32_C(   578.35), SIMDE_FLOAT32_C(   -23.65), SIMDE_FLOAT32_C(   772.61),
+        SIMDE_FLOAT32_C(   654.38), SIMDE_FLOAT32_C(   961.48), SIMDE_FLOAT32_C(   936.07), SIMDE_FLOAT32_C(   634.92),
+        SIMDE_FLOAT32_C(  -804.00), SIMDE_FLOAT32_C(  -710.44), SIMDE_FLOAT32_C(   285.69), SIMDE_FLOAT32_C(   838.11) },
+      { SIMDE_FLOAT32_C(  -205.58), SIMDE_FLOAT32_C(   -42.56), SIMDE_FLOAT32_C(  -804.00), SIMDE_FLOAT32_C(   838.11),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(16382),
+      { SIMDE_FLOAT32_C(  -556.28), SIMDE_FLOAT32_C(  -570.71), SIMDE_FLOAT32_C(   175.26), SIMDE_FLOAT32_C(   929.38),
+        SIMDE_FLOAT32_C(   -76.77), SIMDE_FLOAT32_C(   -52.48), SIMDE_FLOAT32_C(   640.31), SIMDE_FLOAT32_C(   233.39),
+        SIMDE_FLOAT32_C(  -722.78), SIMDE_FLOAT32_C(    88.45), SIMDE_FLOAT32_C(  -645.83), SIMDE_FLOAT32_C(  -884.87),
+        SIMDE_FLOAT32_C(   202.24), SIMDE_FLOAT32_C(    78.58), SIMDE_FLOAT32_C(   396.42), SIMDE_FLOAT32_C(  -202.23) },
+      { SIMDE_FLOAT32_C(  -570.71), SIMDE_FLOAT32_C(   175.26), SIMDE_FLOAT32_C(   929.38), SIMDE_FLOAT32_C(   -76.77),
+        SIMDE_FLOAT32_C(   -52.48), SIMDE_FLOAT32_C(   640.31), SIMDE_FLOAT32_C(   233.39), SIMDE_FLOAT32_C(  -722.78),
+        SIMDE_FLOAT32_C(    88.45), SIMDE_FLOAT32_C(  -645.83), SIMDE_FLOAT32_C(  -884.87), SIMDE_FLOAT32_C(   202.24),
+        SIMDE_FLOAT32_C(    78.58), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(29520),
+      { SIMDE_FLOAT32_C(  -847.27), SIMDE_FLOAT32_C(   968.09), SIMDE_FLOAT32_C(     8.08), SIMDE_FLOAT32_C(   740.81),
+        SIMDE_FLOAT32_C(  -436.72), SIMDE_FLOAT32_C(  -155.08), SIMDE_FLOAT32_C(   913.14), SIMDE_FLOAT32_C(   781.48),
+        SIMDE_FLOAT32_C(  -223.36), SIMDE_FLOAT32_C(   879.28), SIMDE_FLOAT32_C(   253.68), SIMDE_FLOAT32_C(   287.26),
+        SIMDE_FLOAT32_C(   745.43), SIMDE_FLOAT32_C(   629.46), SIMDE_FLOAT32_C(  -536.66), SIMDE_FLOAT32_C(   712.02) },
+      { SIMDE_FLOAT32_C(  -436.72), SIMDE_FLOAT32_C(   913.14), SIMDE_FLOAT32_C(  -223.36), SIMDE_FLOAT32_C(   879.28),
+        SIMDE_FLOAT32_C(   745.43), SIMDE_FLOAT32_C(   629.46), SIMDE_FLOAT32_C(  -536.66), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(21674),
+      { SIMDE_FLOAT32_C(  -217.86), SIMDE_FLOAT32_C(  -481.69), SIMDE_FLOAT32_C(  -583.91), SIMDE_FLOAT32_C(  -110.98),
+        SIMDE_FLOAT32_C(   614.44), SIMDE_FLOAT32_C(  -724.80), SIMDE_FLOAT32_C(    69.69), SIMDE_FLOAT32_C(     4.32),
+        SIMDE_FLOAT32_C(   332.60), SIMDE_FLOAT32_C(   926.13), SIMDE_FLOAT32_C(   109.45), SIMDE_FLOAT32_C(  -359.23),
+        SIMDE_FLOAT32_C(  -373.79), SIMDE_FLOAT32_C(   -39.57), SIMDE_FLOAT32_C(  -321.50), SIMDE_FLOAT32_C(   550.40) },
+      { SIMDE_FLOAT32_C(  -481.69), SIMDE_FLOAT32_C(  -110.98), SIMDE_FLOAT32_C(  -724.80), SIMDE_FLOAT32_C(     4.32),
+        SIMDE_FLOAT32_C(   109.45), SIMDE_FLOAT32_C(  -373.79), SIMDE_FLOAT32_C(  -321.50), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(14000),
+      { SIMDE_FLOAT32_C(  -738.82), SIMDE_FLOAT32_C(   774.21), SIMDE_FLOAT32_C(    25.23), SIMDE_FLOAT32_C(   629.37),
+        SIMDE_FLOAT32_C(  -913.20), SIMDE_FLOAT32_C(   140.48), SIMDE_FLOAT32_C(   970.01), SIMDE_FLOAT32_C(   893.24),
+        SIMDE_FLOAT32_C(   -97.22), SIMDE_FLOAT32_C(   815.53), SIMDE_FLOAT32_C(  -321.62), SIMDE_FLOAT32_C(  -763.86),
+        SIMDE_FLOAT32_C(  -903.16), SIMDE_FLOAT32_C(   896.78), SIMDE_FLOAT32_C(   674.50), SIMDE_FLOAT32_C(  -948.58) },
+      { SIMDE_FLOAT32_C(  -913.20), SIMDE_FLOAT32_C(   140.48), SIMDE_FLOAT32_C(   893.24), SIMDE_FLOAT32_C(   815.53),
+        SIMDE_FLOAT32_C(  -321.62), SIMDE_FLOAT32_C(  -903.16), SIMDE_FLOAT32_C(   896.78), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C( 6418),
+      { SIMDE_FLOAT32_C(   321.75), SIMDE_FLOAT32_C(   417.52), SIMDE_FLOAT32_C(  -251.18), SIMDE_FLOAT32_C(   671.85),
+        SIMDE_FLOAT32_C(   534.02), SIMDE_FLOAT32_C(   -16.71), SIMDE_FLOAT32_C(   -29.49), SIMDE_FLOAT32_C(   491.77),
+        SIMDE_FLOAT32_C(  -653.90), SIMDE_FLOAT32_C(   -69.89), SIMDE_FLOAT32_C(   169.29), SIMDE_FLOAT32_C(    27.86),
+        SIMDE_FLOAT32_C(  -835.62), SIMDE_FLOAT32_C(  -557.02), SIMDE_FLOAT32_C(  -293.72), SIMDE_FLOAT32_C(  -471.50) },
+      { SIMDE_FLOAT32_C(   417.52), SIMDE_FLOAT32_C(   534.02), SIMDE_FLOAT32_C(  -653.90), SIMDE_FLOAT32_C(    27.86),
+        SIMDE_FLOAT32_C(  -835.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(62078),
+      { SIMDE_FLOAT32_C(   -72.69), SIMDE_FLOAT32_C(     5.52), SIMDE_FLOAT32_C(   342.27), SIMDE_FLOAT32_C(  -659.40),
+        SIMDE_FLOAT32_C(  -517.20), SIMDE_FLOAT32_C(   197.80), SIMDE_FLOAT32_C(   608.47), SIMDE_FLOAT32_C(    80.04),
+        SIMDE_FLOAT32_C(  -413.19), SIMDE_FLOAT32_C(  -743.51), SIMDE_FLOAT32_C(  -615.76), SIMDE_FLOAT32_C(   670.28),
+        SIMDE_FLOAT32_C(   -61.85), SIMDE_FLOAT32_C(  -634.42), SIMDE_FLOAT32_C(  -955.80), SIMDE_FLOAT32_C(   137.53) },
+      { SIMDE_FLOAT32_C(     5.52), SIMDE_FLOAT32_C(   342.27), SIMDE_FLOAT32_C(  -659.40), SIMDE_FLOAT32_C(  -517.20),
+        SIMDE_FLOAT32_C(   197.80), SIMDE_FLOAT32_C(   608.47), SIMDE_FLOAT32_C(  -743.51), SIMDE_FLOAT32_C(   -61.85),
+        SIMDE_FLOAT32_C(  -634.42), SIMDE_FLOAT32_C(  -955.80), SIMDE_FLOAT32_C(   137.53), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(38338),
+      { SIMDE_FLOAT32_C(  -593.55), SIMDE_FLOAT32_C(  -584.70), SIMDE_FLOAT32_C(  -750.76), SIMDE_FLOAT32_C(   794.64),
+        SIMDE_FLOAT32_C(    45.61), SIMDE_FLOAT32_C(  -424.63), SIMDE_FLOAT32_C(  -472.32), SIMDE_FLOAT32_C(   378.30),
+        SIMDE_FLOAT32_C(   -30.64), SIMDE_FLOAT32_C(   931.76), SIMDE_FLOAT32_C(  -365.87), SIMDE_FLOAT32_C(   762.79),
+        SIMDE_FLOAT32_C(  -670.18), SIMDE_FLOAT32_C(  -191.16), SIMDE_FLOAT32_C(  -312.22), SIMDE_FLOAT32_C(   142.31) },
+      { SIMDE_FLOAT32_C(  -584.70), SIMDE_FLOAT32_C(  -472.32), SIMDE_FLOAT32_C(   378.30), SIMDE_FLOAT32_C(   -30.64),
+        SIMDE_FLOAT32_C(  -365.87), SIMDE_FLOAT32_C(  -670.18), SIMDE_FLOAT32_C(   142.31), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_compress_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   457.85), SIMDE_FLOAT32_C(   260.09), SIMDE_FLOAT32_C(   158.70), SIMDE_FLOAT32_C(   360.17),
+        SIMDE_FLOAT32_C(   -34.44), SIMDE_FLOAT32_C(  -107.45), SIMDE_FLOAT32_C(   606.42), SIMDE_FLOAT32_C(   -92.01),
+        SIMDE_FLOAT32_C(   983.31), SIMDE_FLOAT32_C(  -168.94), SIMDE_FLOAT32_C(  -280.86), SIMDE_FLOAT32_C(  -746.69),
+        SIMDE_FLOAT32_C(  -767.41), SIMDE_FLOAT32_C(  -516.72), SIMDE_FLOAT32_C(   878.46), SIMDE_FLOAT32_C(  -870.07) },
+      UINT16_C(45214),
+      { SIMDE_FLOAT32_C(   719.87), SIMDE_FLOAT32_C(  -510.09), SIMDE_FLOAT32_C(   584.60), SIMDE_FLOAT32_C(   957.05),
+        SIMDE_FLOAT32_C(   752.65), SIMDE_FLOAT32_C(   426.95), SIMDE_FLOAT32_C(   542.94), SIMDE_FLOAT32_C(  -945.34),
+        SIMDE_FLOAT32_C(   785.17), SIMDE_FLOAT32_C(  -638.95), SIMDE_FLOAT32_C(   536.82), SIMDE_FLOAT32_C(   309.94),
+        SIMDE_FLOAT32_C(   141.27), SIMDE_FLOAT32_C(    29.24), SIMDE_FLOAT32_C(   437.89), SIMDE_FLOAT32_C(    36.56) },
+      { SIMDE_FLOAT32_C(  -510.09), SIMDE_FLOAT32_C(   584.60), SIMDE_FLOAT32_C(   957.05), SIMDE_FLOAT32_C(   752.65),
+        SIMDE_FLOAT32_C(  -945.34), SIMDE_FLOAT32_C(   141.27), SIMDE_FLOAT32_C(    29.24), SIMDE_FLOAT32_C(    36.56),
+        SIMDE_FLOAT32_C(   983.31), SIMDE_FLOAT32_C(  -168.94), SIMDE_FLOAT32_C(  -280.86), SIMDE_FLOAT32_C(  -746.69),
+        SIMDE_FLOAT32_C(  -767.41), SIMDE_FLOAT32_C(  -516.72), SIMDE_FLOAT32_C(   878.46), SIMDE_FLOAT32_C(  -870.07) } },
+    { { SIMDE_FLOAT32_C(  -351.75), SIMDE_FLOAT32_C(  -353.42), SIMDE_FLOAT32_C(  -505.46), SIMDE_FLOAT32_C(   840.60),
+        SIMDE_FLOAT32_C(  -710.07), SIMDE_FLOAT32_C(   311.33), SIMDE_FLOAT32_C(   -22.97), SIMDE_FLOAT32_C(  -377.81),
+        SIMDE_FLOAT32_C(   737.23), SIMDE_FLOAT32_C(   776.57), SIMDE_FLOAT32_C(   477.22), SIMDE_FLOAT32_C(  -251.51),
+        SIMDE_FLOAT32_C(   111.87), SIMDE_FLOAT32_C(  -172.25), SIMDE_FLOAT32_C(   304.05), SIMDE_FLOAT32_C(  -683.27) },
+      UINT16_C(48627),
+      { SIMDE_FLOAT32_C(  -743.12), SIMDE_FLOAT32_C(  -955.41), SIMDE_FLOAT32_C(  -148.62), SIMDE_FLOAT32_C(   775.18),
+        SIMDE_FLOAT32_C(   517.84), SIMDE_FLOAT32_C(  -647.21), SIMDE_FLOAT32_C(   163.94), SIMDE_FLOAT32_C(  -639.98),
+        SIMDE_FLOAT32_C(  -803.69), SIMDE_FLOAT32_C(  -857.64), SIMDE_FLOAT32_C(  -892.15), SIMDE_FLOAT32_C(  -694.25),
+        SIMDE_FLOAT32_C(   673.11), SIMDE_FLOAT32_C(   303.17), SIMDE_FLOAT32_C(   978.53), SIMDE_FLOAT32_C(   296.44) },
+      { SIMDE_FLOAT32_C(  -743.12), SIMDE_FLOAT32_C(  -955.41), SIMDE_FLOAT32_C(   517.84), SIMDE_FLOAT32_C(  -647.21),
+        SIMDE_FLOAT32_C(   163.94), SIMDE_FLOAT32_C(  -639.98), SIMDE_FLOAT32_C(  -803.69), SIMDE_FLOAT32_C(  -892.15),
+        SIMDE_FLOAT32_C(  -694.25), SIMDE_FLOAT32_C(   673.11), SIMDE_FLOAT32_C(   303.17), SIMDE_FLOAT32_C(   296.44),
+        SIMDE_FLOAT32_C(   111.87), SIMDE_FLOAT32_C(  -172.25), SIMDE_FLOAT32_C(   304.05), SIMDE_FLOAT32_C(  -683.27) } },
+    { { SIMDE_FLOAT32_C(   594.55), SIMDE_FLOAT32_C(  -396.90), SIMDE_FLOAT32_C(  -462.83), SIMDE_FLOAT32_C(  -307.28),
+        SIMDE_FLOAT32_C(  -666.94), SIMDE_FLOAT32_C(   974.31), SIMDE_FLOAT32_C(  -770.44), SIMDE_FLOAT32_C(   493.76),
+        SIMDE_FLOAT32_C(  -439.90), SIMDE_FLOAT32_C(   477.27), SIMDE_FLOAT32_C(   741.51), SIMDE_FLOAT32_C(   510.76),
+        SIMDE_FLOAT32_C(   179.18), SIMDE_FLOAT32_C(   228.25), SIMDE_FLOAT32_C(   126.01), SIMDE_FLOAT32_C(   -15.42) },
+      UINT16_C(63316),
+      { SIMDE_FLOAT32_C(   657.02), SIMDE_FLOAT32_C(   -12.56), SIMDE_FLOAT32_C(   542.23), SIMDE_FLOAT32_C(   429.97),
+        SIMDE_FLOAT32_C(  -650.57), SIMDE_FLOAT32_C(  -520.79), SIMDE_FLOAT32_C(  -222.99), SIMDE_FLOAT32_C(   491.30),
+        SIMDE_FLOAT32_C(   700.72), SIMDE_FLOAT32_C(  -955.27), SIMDE_FLOAT32_C(   506.33), SIMDE_FLOAT32_C(  -615.52),
+        SIMDE_FLOAT32_C(   672.55), SIMDE_FLOAT32_C(   554.42), SIMDE_FLOAT32_C(   -28.63), SIMDE_FLOAT32_C(   813.75) },
+      { SIMDE_FLOAT32_C(   542.23), SIMDE_FLOAT32_C(  -650.57), SIMDE_FLOAT32_C(  -222.99), SIMDE_FLOAT32_C(   700.72),
+        SIMDE_FLOAT32_C(  -955.27), SIMDE_FLOAT32_C(   506.33), SIMDE_FLOAT32_C(   672.55), SIMDE_FLOAT32_C(   554.42),
+        SIMDE_FLOAT32_C(   -28.63), SIMDE_FLOAT32_C(   813.75), SIMDE_FLOAT32_C(   741.51), SIMDE_FLOAT32_C(   510.76),
+        SIMDE_FLOAT32_C(   179.18), SIMDE_FLOAT32_C(   228.25), SIMDE_FLOAT32_C(   126.01), SIMDE_FLOAT32_C(   -15.42) } },
+    { { SIMDE_FLOAT32_C(   155.92), SIMDE_FLOAT32_C(  -612.20), SIMDE_FLOAT32_C(   394.96), SIMDE_FLOAT32_C(   892.54),
+        SIMDE_FLOAT32_C(    89.41), SIMDE_FLOAT32_C(   909.12), SIMDE_FLOAT32_C(   829.76), SIMDE_FLOAT32_C(  -764.96),
+        SIMDE_FLOAT32_C(   878.34), SIMDE_FLOAT32_C(   654.20), SIMDE_FLOAT32_C(   -51.36), SIMDE_FLOAT32_C(  -155.89),
+        SIMDE_FLOAT32_C(   464.09), SIMDE_FLOAT32_C(  -122.26), SIMDE_FLOAT32_C(    99.98), SIMDE_FLOAT32_C(  -865.69) },
+      UINT16_C(44564),
+      { SIMDE_FLOAT32_C(   363.79), SIMDE_FLOAT32_C(   309.64), SIMDE_FLOAT32_C(  -841.50), SIMDE_FLOAT32_C(  -582.76),
+        SIMDE_FLOAT32_C(   261.13), SIMDE_FLOAT32_C(  -976.05), SIMDE_FLOAT32_C(   -84.62), SIMDE_FLOAT32_C(   540.54),
+        SIMDE_FLOAT32_C(  -573.59), SIMDE_FLOAT32_C(    34.61), SIMDE_FLOAT32_C(   366.37), SIMDE_FLOAT32_C(   609.76),
+        SIMDE_FLOAT32_C(  -544.27), SIMDE_FLOAT32_C(   255.06), SIMDE_FLOAT32_C(  -454.47), SIMDE_FLOAT32_C(   865.26) },
+      { SIMDE_FLOAT32_C(  -841.50), SIMDE_FLOAT32_C(   261.13), SIMDE_FLOAT32_C(    34.61), SIMDE_FLOAT32_C(   366.37),
+        SIMDE_FLOAT32_C(   609.76), SIMDE_FLOAT32_C(   255.06), SIMDE_FLOAT32_C(   865.26), SIMDE_FLOAT32_C(  -764.96),
+        SIMDE_FLOAT32_C(   878.34), SIMDE_FLOAT32_C(   654.20), SIMDE_FLOAT32_C(   -51.36), SIMDE_FLOAT32_C(  -155.89),
+        SIMDE_FLOAT32_C(   464.09), SIMDE_FLOAT32_C(  -122.26), SIMDE_FLOAT32_C(    99.98), SIMDE_FLOAT32_C(  -865.69) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r[16];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm512_mask_compressstoreu_ps(r, test_vec[i].k, a);
+    simde_assert_equal_vf32(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -392.41), SIMDE_FLOAT64_C(   517.10), SIMDE_FLOAT64_C(  -443.04), SIMDE_FLOAT64_C(   -93.76),
+        SIMDE_FLOAT64_C(  -673.05), SIMDE_FLOAT64_C(  -612.80), SIMDE_FLOAT64_C(   370.26), SIMDE_FLOAT64_C(   118.98) },
+      UINT8_C(161),
+      { SIMDE_FLOAT64_C(  -282.83), SIMDE_FLOAT64_C(   896.46), SIMDE_FLOAT64_C(  -968.93), SIMDE_FLOAT64_C(  -818.88),
+        SIMDE_FLOAT64_C(  -955.87), SIMDE_FLOAT64_C(  -800.35), SIMDE_FLOAT64_C(   865.62), SIMDE_FLOAT64_C(   586.15) },
+      { SIMDE_FLOAT64_C(  -282.83), SIMDE_FLOAT64_C(  -800.35), SIMDE_FLOAT64_C(   586.15), SIMDE_FLOAT64_C(   -93.76),
+        SIMDE_FLOAT64_C(  -673.05), SIMDE_FLOAT64_C(  -612.80), SIMDE_FLOAT64_C(   370.26), SIMDE_FLOAT64_C(   118.98) } },
+    { { SIMDE_FLOAT64_C(  -345.43), SIMDE_FLOAT64_C(   629.01), SIMDE_FLOAT64_C(   210.12), SIMDE_FLOAT64_C(  -882.78),
+        SIMDE_FLOAT64_C(   627.56), SIMDE_FLOAT64_C(   413.27), SIMDE_FLOAT64_C(   385.74), SIMDE_FLOAT64_C(   272.31) },
+      UINT8_C(241),
+      { SIMDE_FLOAT64_C(   308.65), SIMDE_FLOAT64_C(   720.17), SIMDE_FLOAT64_C(    66.10), SIMDE_FLOAT64_C(  -724.79),
+        SIMDE_FLOAT64_C(  -633.21), SIMDE_FLOAT64_C(     7.90), SIMDE_FLOAT64_C(   933.23), SIMDE_FLOAT64_C(  -711.25) },
+      { SIMDE_FLOAT64_C(   308.65), SIMDE_FLOAT64_C(  -633.21), SIMDE_FLOAT64_C(     7.90), SIMDE_FLOAT64_C(   933.23),
+        SIMDE_FLOAT64_C(  -711.25), SIMDE_FLOAT64_C(   413.27), SIMDE_FLOAT64_C(   385.74), SIMDE_FLOAT64_C(   272.31) } },
+    { { SIMDE_FLOAT64_C(   -94.78), SIMDE_FLOAT64_C(   461.94), SIMDE_FLOAT64_C(  -971.18), SIMDE_FLOAT64_C(  -103.29),
+        SIMDE_FLOAT64_C(   645.98), SIMDE_FLOAT64_C(   -23.25), SIMDE_FLOAT64_C(   -44.15), SIMDE_FLOAT64_C(   284.97) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(   136.39), SIMDE_FLOAT64_C(   209.21), SIMDE_FLOAT64_C(   904.63), SIMDE_FLOAT64_C(  -620.89),
+        SIMDE_FLOAT64_C(    38.54), SIMDE_FLOAT64_C(  -739.48), SIMDE_FLOAT64_C(   413.17), SIMDE_FLOAT64_C(   591.77) },
+      { SIMDE_FLOAT64_C(   136.39), SIMDE_FLOAT64_C(   209.21), SIMDE_FLOAT64_C(   904.63), SIMDE_FLOAT64_C(  -620.89),
+        SIMDE_FLOAT64_C(    38.54), SIMDE_FLOAT64_C(  -739.48), SIMDE_FLOAT64_C(   413.17), SIMDE_FLOAT64_C(   591.77) } },
+    { { SIMDE_FLOAT64_C(   374.12), SIMDE_FLOAT64_C(  -582.88), SIMDE_FLOAT64_C(  -103.72), SIMDE_FLOAT64_C(  -427.41),
+        SIMDE_FLOAT64_C(    80.40), SIMDE_FLOAT64_C(   428.49), SIMDE_FLOAT64_C(   -60.73), SIMDE_FLOAT64_C(  -901.12) },
+      UINT8_C( 11),
+      { SIMDE_FLOAT64_C(   -49.08), SIMDE_FLOAT64_C(  -686.12), SIMDE_FLOAT64_C(   613.01), SIMDE_FLOAT64_C(  -967.39),
+        SIMDE_FLOAT64_C(   -26.79), SIMDE_FLOAT64_C(  -609.31), SIMDE_FLOAT64_C(   624.84), SIMDE_FLOAT64_C(   602.35) },
+      { SIMDE_FLOAT64_C(   -49.08), SIMDE_FLOAT64_C(  -686.12), SIMDE_FLOAT64_C(  -967.39), SIMDE_FLOAT64_C(  -427.41),
+        SIMDE_FLOAT64_C(    80.40), SIMDE_FLOAT64_C(   428.49), SIMDE_FLOAT64_C(   -60.73), SIMDE_FLOAT64_C(  -901.12) } },
+    { { SIMDE_FLOAT64_C(  -784.90), SIMDE_FLOAT64_C(  -508.87), SIMDE_FLOAT64_C(   -61.47), SIMDE_FLOAT64_C(   487.78),
+        SIMDE_FLOAT64_C(   294.85), SIMDE_FLOAT64_C(  -493.96), SIMDE_FLOAT64_C(   -34.72), SIMDE_FLOAT64_C(   215.96) },
+      UINT8_C( 87),
+      { SIMDE_FLOAT64_C(   498.62), SIMDE_FLOAT64_C(  -762.97), SIMDE_FLOAT64_C(   106.02), SIMDE_FLOAT64_C(   -80.61),
+        SIMDE_FLOAT64_C(   563.93), SIMDE_FLOAT64_C(   -47.30), SIMDE_FLOAT64_C(  -103.42), SIMDE_FLOAT64_C(  -186.76) },
+      { SIMDE_FLOAT64_C(   498.62), SIMDE_FLOAT64_C(  -762.97), SIMDE_FLOAT64_C(   106.02), SIMDE_FLOAT64_C(   563.93),
+        SIMDE_FLOAT64_C(  -103.42), SIMDE_FLOAT64_C(  -493.96), SIMDE_FLOAT64_C(   -34.72), SIMDE_FLOAT64_C(   215.96) } },
+    { { SIMDE_FLOAT64_C(  -484.31), SIMDE_FLOAT64_C(    67.79), SIMDE_FLOAT64_C(  -805.33), SIMDE_FLOAT64_C(  -175.80),
+        SIMDE_FLOAT64_C(   273.56), SIMDE_FLOAT64_C(   888.35), SIMDE_FLOAT64_C(   858.19), SIMDE_FLOAT64_C(  -452.24) },
+      UINT8_C(147),
+      { SIMDE_FLOAT64_C(   476.78), SIMDE_FLOAT64_C(   601.00), SIMDE_FLOAT64_C(  -729.24), SIMDE_FLOAT64_C(  -537.66),
+        SIMDE_FLOAT64_C(   145.44), SIMDE_FLOAT64_C(  -522.49), SIMDE_FLOAT64_C(   735.23), SIMDE_FLOAT64_C(   773.49) },
+      { SIMDE_FLOAT64_C(   476.78), SIMDE_FLOAT64_C(   601.00), SIMDE_FLOAT64_C(   145.44), SIMDE_FLOAT64_C(   773.49),
+        SIMDE_FLOAT64_C(   273.56), SIMDE_FLOAT64_C(   888.35), SIMDE_FLOAT64_C(   858.19), SIMDE_FLOAT64_C(  -452.24) } },
+    { { SIMDE_FLOAT64_C(   201.78), SIMDE_FLOAT64_C(  -385.25), SIMDE_FLOAT64_C(   147.95), SIMDE_FLOAT64_C(  -415.83),
+        SIMDE_FLOAT64_C(   784.19), SIMDE_FLOAT64_C(  -967.10), SIMDE_FLOAT64_C(   165.76), SIMDE_FLOAT64_C(   432.27) },
+      UINT8_C( 37),
+      { SIMDE_FLOAT64_C(  -841.61), SIMDE_FLOAT64_C(  -696.70), SIMDE_FLOAT64_C(   383.18), SIMDE_FLOAT64_C(  -111.56),
+        SIMDE_FLOAT64_C(  -177.55), SIMDE_FLOAT64_C(  -425.24), SIMDE_FLOAT64_C(   358.01), SIMDE_FLOAT64_C(  -858.87) },
+      { SIMDE_FLOAT64_C(  -841.61), SIMDE_FLOAT64_C(   383.18), SIMDE_FLOAT64_C(  -425.24), SIMDE_FLOAT64_C(  -415.83),
+        SIMDE_FLOAT64_C(   784.19), SIMDE_FLOAT64_C(  -967.10), SIMDE_FLOAT64_C(   165.76), SIMDE_FLOAT64_C(   432.27) } },
+    { { SIMDE_FLOAT64_C(   139.40), SIMDE_FLOAT64_C(  -762.86), SIMDE_FLOAT64_C(  -816.56), SIMDE_FLOAT64_C(  -253.39),
+        SIMDE_FLOAT64_C(   152.81), SIMDE_FLOAT64_C(   871.74), SIMDE_FLOAT64_C(   721.50), SIMDE_FLOAT64_C(   850.55) },
+      UINT8_C(128),
+      { SIMDE_FLOAT64_C(   791.40), SIMDE_FLOAT64_C(  -881.07), SIMDE_FLOAT64_C(  -475.98), SIMDE_FLOAT64_C(  -254.79),
+        SIMDE_FLOAT64_C(  -640.99), SIMDE_FLOAT64_C(   116.13), SIMDE_FLOAT64_C(  -917.57), SIMDE_FLOAT64_C(  -128.05) },
+      { SIMDE_FLOAT64_C(  -128.05), SIMDE_FLOAT64_C(  -762.86), SIMDE_FLOAT64_C(  -816.56), SIMDE_FLOAT64_C(  -253.39),
+        SIMDE_FLOAT64_C(   152.81), SIMDE_FLOAT64_C(   871.74), SIMDE_FLOAT64_C(   721.50), SIMDE_FLOAT64_C(   850.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_compress_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(170),
+      { SIMDE_FLOAT64_C(  -316.25), SIMDE_FLOAT64_C(   320.70), SIMDE_FLOAT64_C(   264.52), SIMDE_FLOAT64_C(  -368.46),
+        SIMDE_FLOAT64_C(   927.35), SIMDE_FLOAT64_C(  -493.25), SIMDE_FLOAT64_C(   863.94), SIMDE_FLOAT64_C(   642.16) },
+      { SIMDE_FLOAT64_C(   320.70), SIMDE_FLOAT64_C(  -368.46), SIMDE_FLOAT64_C(  -493.25), SIMDE_FLOAT64_C(   642.16),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 57),
+      { SIMDE_FLOAT64_C(  -180.47), SIMDE_FLOAT64_C(  -218.94), SIMDE_FLOAT64_C(   375.26), SIMDE_FLOAT64_C(   -30.81),
+        SIMDE_FLOAT64_C(   837.01), SIMDE_FLOAT64_C(   425.14), SIMDE_FLOAT64_C(  -424.80), SIMDE_FLOAT64_C(   -30.98) },
+      { SIMDE_FLOAT64_C(  -180.47), SIMDE_FLOAT64_C(   -30.81), SIMDE_FLOAT64_C(   837.01), SIMDE_FLOAT64_C(   425.14),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(225),
+      { SIMDE_FLOAT64_C(  -507.69), SIMDE_FLOAT64_C(   442.14), SIMDE_FLOAT64_C(   898.14), SIMDE_FLOAT64_C(  -932.91),
+        SIMDE_FLOAT64_C(  -560.08), SIMDE_FLOAT64_C(   945.86), SIMDE_FLOAT64_C(   275.84), SIMDE_FLOAT64_C(   531.23) },
+      { SIMDE_FLOAT64_C(  -507.69), SIMDE_FLOAT64_C(   945.86), SIMDE_FLOAT64_C(   275.84), SIMDE_FLOAT64_C(   531.23),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(172),
+      { SIMDE_FLOAT64_C(   -88.23), SIMDE_FLOAT64_C(   929.62), SIMDE_FLOAT64_C(  -356.20), SIMDE_FLOAT64_C(   401.92),
+        SIMDE_FLOAT64_C(   207.68), SIMDE_FLOAT64_C(  -374.21), SIMDE_FLOAT64_C(  -188.32), SIMDE_FLOAT64_C(   891.04) },
+      { SIMDE_FLOAT64_C(  -356.20), SIMDE_FLOAT64_C(   401.92), SIMDE_FLOAT64_C(  -374.21), SIMDE_FLOAT64_C(   891.04),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 41),
+      { SIMDE_FLOAT64_C(   220.67), SIMDE_FLOAT64_C(  -200.95), SIMDE_FLOAT64_C(   392.97), SIMDE_FLOAT64_C(   466.09),
+        SIMDE_FLOAT64_C(   423.83), SIMDE_FLOAT64_C(   916.84), SIMDE_FLOAT64_C(   244.46), SIMDE_FLOAT64_C(   210.33) },
+      { SIMDE_FLOAT64_C(   220.67), SIMDE_FLOAT64_C(   466.09), SIMDE_FLOAT64_C(   916.84), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -692.13), SIMDE_FLOAT64_C(   578.13), SIMDE_FLOAT64_C(  -670.44), SIMDE_FLOAT64_C(  -760.17),
+        SIMDE_FLOAT64_C(    53.20), SIMDE_FLOAT64_C(    -8.46), SIMDE_FLOAT64_C(   798.77), SIMDE_FLOAT64_C(  -333.29) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 49),
+      { SIMDE_FLOAT64_C(  -581.95), SIMDE_FLOAT64_C(   786.60), SIMDE_FLOAT64_C(   237.83), SIMDE_FLOAT64_C(    61.93),
+        SIMDE_FLOAT64_C(   374.49), SIMDE_FLOAT64_C(  -686.97), SIMDE_FLOAT64_C(  -101.86), SIMDE_FLOAT64_C(  -395.23) },
+      { SIMDE_FLOAT64_C(  -581.95), SIMDE_FLOAT64_C(   374.49), SIMDE_FLOAT64_C(  -686.97), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(112),
+      { SIMDE_FLOAT64_C(    39.61), SIMDE_FLOAT64_C(  -672.85), SIMDE_FLOAT64_C(  -395.75), SIMDE_FLOAT64_C(  -666.46),
+        SIMDE_FLOAT64_C(   199.78), SIMDE_FLOAT64_C(   695.96), SIMDE_FLOAT64_C(   693.02), SIMDE_FLOAT64_C(   926.78) },
+      { SIMDE_FLOAT64_C(   199.78), SIMDE_FLOAT64_C(   695.96), SIMDE_FLOAT64_C(   693.02), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_compress_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   478.56), SIMDE_FLOAT64_C(   762.73), SIMDE_FLOAT64_C(   -33.12), SIMDE_FLOAT64_C(  -665.22),
+        SIMDE_FLOAT64_C(   836.66), SIMDE_FLOAT64_C(    59.49), SIMDE_FLOAT64_C(  -787.58), SIMDE_FLOAT64_C(  -270.07) },
+      UINT8_C(187),
+      { SIMDE_FLOAT64_C(  -817.98), SIMDE_FLOAT64_C(   115.14), SIMDE_FLOAT64_C(   331.16), SIMDE_FLOAT64_C(  -471.10),
+        SIMDE_FLOAT64_C(   727.74), SIMDE_FLOAT64_C(  -626.48), SIMDE_FLOAT64_C(  -500.56), SIMDE_FLOAT64_C(   -57.30) },
+      { SIMDE_FLOAT64_C(  -817.98), SIMDE_FLOAT64_C(   115.14), SIMDE_FLOAT64_C(  -471.10), SIMDE_FLOAT64_C(   727.74),
+        SIMDE_FLOAT64_C(  -626.48), SIMDE_FLOAT64_C(   -57.30), SIMDE_FLOAT64_C(  -787.58), SIMDE_FLOAT64_C(  -270.07) } },
+    { { SIMDE_FLOAT64_C(   280.53), SIMDE_FLOAT64_C(   286.59), SIMDE_FLOAT64_C(  -370.58), SIMDE_FLOAT64_C(   822.49),
+        SIMDE_FLOAT64_C(  -667.90), SIMDE_FLOAT64_C(  -292.69), SIMDE_FLOAT64_C(    62.97), SIMDE_FLOAT64_C(    63.45) },
+      UINT8_C( 80),
+      { SIMDE_FLOAT64_C(  -371.69), SIMDE_FLOAT64_C(   -54.29), SIMDE_FLOAT64_C(   122.99), SIMDE_FLOAT64_C(  -375.75),
+        SIMDE_FLOAT64_C(  -243.81), SIMDE_FLOAT64_C(   409.61), SIMDE_FLOAT64_C(  -171.10), SIMDE_FLOAT64_C(  -753.48) },
+      { SIMDE_FLOAT64_C(  -243.81), SIMDE_FLOAT64_C(  -171.10), SIMDE_FLOAT64_C(  -370.58), SIMDE_FLOAT64_C(   822.49),
+        SIMDE_FLOAT64_C(  -667.90), SIMDE_FLOAT64_C(  -292.69), SIMDE_FLOAT64_C(    62.97), SIMDE_FLOAT64_C(    63.45) } },
+    { { SIMDE_FLOAT64_C(   601.55), SIMDE_FLOAT64_C(   665.81), SIMDE_FLOAT64_C(   764.18), SIMDE_FLOAT64_C(  -929.96),
+        SIMDE_FLOAT64_C(   181.05), SIMDE_FLOAT64_C(   885.99), SIMDE_FLOAT64_C(  -829.54), SIMDE_FLOAT64_C(  -684.19) },
+      UINT8_C( 83),
+      { SIMDE_FLOAT64_C(   120.00), SIMDE_FLOAT64_C(   896.82), SIMDE_FLOAT64_C(  -450.06), SIMDE_FLOAT64_C(   -43.58),
+        SIMDE_FLOAT64_C(  -997.67), SIMDE_FLOAT64_C(  -451.17), SIMDE_FLOAT64_C(  -537.05), SIMDE_FLOAT64_C(   153.97) },
+      { SIMDE_FLOAT64_C(   120.00), SIMDE_FLOAT64_C(   896.82), SIMDE_FLOAT64_C(  -997.67), SIMDE_FLOAT64_C(  -537.05),
+        SIMDE_FLOAT64_C(   181.05), SIMDE_FLOAT64_C(   885.99), SIMDE_FLOAT64_C(  -829.54), SIMDE_FLOAT64_C(  -684.19) } },
+    { { SIMDE_FLOAT64_C(   653.46), SIMDE_FLOAT64_C(   890.24), SIMDE_FLOAT64_C(  -823.44), SIMDE_FLOAT64_C(    29.65),
+        SIMDE_FLOAT64_C(   872.41), SIMDE_FLOAT64_C(  -120.17), SIMDE_FLOAT64_C(  -219.96), SIMDE_FLOAT64_C(   -20.08) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(  -471.59), SIMDE_FLOAT64_C(  -776.67), SIMDE_FLOAT64_C(  -782.45), SIMDE_FLOAT64_C(  -749.07),
+        SIMDE_FLOAT64_C(  -826.92), SIMDE_FLOAT64_C(  -154.41), SIMDE_FLOAT64_C(   100.32), SIMDE_FLOAT64_C(  -108.32) },
+      { SIMDE_FLOAT64_C(  -471.59), SIMDE_FLOAT64_C(  -776.67), SIMDE_FLOAT64_C(  -782.45), SIMDE_FLOAT64_C(  -749.07),
+        SIMDE_FLOAT64_C(  -826.92), SIMDE_FLOAT64_C(  -154.41), SIMDE_FLOAT64_C(   100.32), SIMDE_FLOAT64_C(  -108.32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r[8];
+    simde_memcpy(r, test_vec[i].src, sizeof(r));
+    simde_mm512_mask_compressstoreu_pd(r, test_vec[i].k, a);
+    simde_assert_equal_vf64(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,924 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN conflict
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/conflict.h>
+
+static int
+test_simde_mm_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   109218082), -INT32_C(   109218082), -INT32_C(   109218082), -INT32_C(   109218082) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           7) } },
+    { { -INT32_C(  1450550792), -INT32_C(  1450550792), -INT32_C(  1450550792),  INT32_C(  1743640679) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           0) } },
+    { {  INT32_C(  1918617807),  INT32_C(  1355911088),  INT32_C(  1918617807),  INT32_C(  1355911088) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           2) } },
+    { { -INT32_C(  1063529723), -INT32_C(   816462019),  INT32_C(  1894457770), -INT32_C(   707670383) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   460800084),  INT32_C(   460800084),  INT32_C(   460800084),  INT32_C(   460800084) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           7) } },
+    { { -INT32_C(   190564319), -INT32_C(   190564319),  INT32_C(  1527031864),  INT32_C(  1527031864) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           4) } },
+    { {  INT32_C(  2077969896),  INT32_C(  2077969896), -INT32_C(  1975586402), -INT32_C(  1975586402) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           4) } },
+    { { -INT32_C(   952172593), -INT32_C(  1451064825),  INT32_C(  1602751249),  INT32_C(  1602751249) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_conflict_epi32(a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   379827339),  INT32_C(  1722116838),  INT32_C(  1242245482),  INT32_C(  1012904985) },
+      UINT8_C(144),
+      {  INT32_C(  2059340409),  INT32_C(  2059340409),  INT32_C(  2059340409),  INT32_C(  2059340409) },
+      {  INT32_C(   379827339),  INT32_C(  1722116838),  INT32_C(  1242245482),  INT32_C(  1012904985) } },
+    { {  INT32_C(   477318519),  INT32_C(   769321345),  INT32_C(   346531306), -INT32_C(  1839396445) },
+      UINT8_C( 91),
+      { -INT32_C(  1456321002),  INT32_C(  1834149066), -INT32_C(  1456321002),  INT32_C(  1834149066) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   346531306),  INT32_C(           2) } },
+    { { -INT32_C(   274778958), -INT32_C(  1392440560), -INT32_C(  1249160884),  INT32_C(   528245435) },
+      UINT8_C(124),
+      { -INT32_C(   805403878), -INT32_C(   757661524), -INT32_C(   805403878), -INT32_C(   805403878) },
+      { -INT32_C(   274778958), -INT32_C(  1392440560),  INT32_C(           1),  INT32_C(           5) } },
+    { {  INT32_C(  1498020483),  INT32_C(   809497737), -INT32_C(   875942082), -INT32_C(   719343478) },
+      UINT8_C(128),
+      { -INT32_C(  1377097823), -INT32_C(   741099232), -INT32_C(   741099232), -INT32_C(   741099232) },
+      {  INT32_C(  1498020483),  INT32_C(   809497737), -INT32_C(   875942082), -INT32_C(   719343478) } },
+    { { -INT32_C(  1170357544),  INT32_C(   744698574),  INT32_C(   701254071),  INT32_C(  2029095141) },
+      UINT8_C(141),
+      { -INT32_C(   151912372), -INT32_C(   151912372), -INT32_C(   151912372), -INT32_C(   151912372) },
+      {  INT32_C(           0),  INT32_C(   744698574),  INT32_C(           3),  INT32_C(           7) } },
+    { { -INT32_C(  1563746217),  INT32_C(   190268746), -INT32_C(  1065795303), -INT32_C(  1950299870) },
+      UINT8_C(205),
+      { -INT32_C(  2074427785), -INT32_C(  2074427785), -INT32_C(  2074427785), -INT32_C(   807207571) },
+      {  INT32_C(           0),  INT32_C(   190268746),  INT32_C(           3),  INT32_C(           0) } },
+    { { -INT32_C(   522186261),  INT32_C(   680662596), -INT32_C(   687872627),  INT32_C(  1153955305) },
+      UINT8_C(126),
+      { -INT32_C(   580741825), -INT32_C(   580741825), -INT32_C(   932867515),  INT32_C(   460446314) },
+      { -INT32_C(   522186261),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1412860846), -INT32_C(  1446292817),  INT32_C(  1555510429), -INT32_C(  1707985399) },
+      UINT8_C(175),
+      { -INT32_C(  1053672251),  INT32_C(  1319338768),  INT32_C(  2023103964),  INT32_C(  1319338768) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_conflict_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(183),
+      { -INT32_C(  1287413820), -INT32_C(  1287413820), -INT32_C(  1287413820), -INT32_C(  1287413820) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           0) } },
+    { UINT8_C(206),
+      { -INT32_C(  1481527915),  INT32_C(  1481468522), -INT32_C(  1481527915), -INT32_C(  1481527915) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           5) } },
+    { UINT8_C( 31),
+      { -INT32_C(  1260183010),  INT32_C(  1102973712),  INT32_C(  1102973712), -INT32_C(  1260183010) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1) } },
+    { UINT8_C( 49),
+      {  INT32_C(   430009141),  INT32_C(  1818946048), -INT32_C(  2093624793), -INT32_C(  2093624793) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 30),
+      {  INT32_C(   513470052),  INT32_C(   513470052),  INT32_C(   513470052),  INT32_C(   513470052) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           7) } },
+    { UINT8_C( 85),
+      {  INT32_C(   566347048), -INT32_C(  1405213357), -INT32_C(  1405213357), -INT32_C(  1405213357) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0) } },
+    { UINT8_C( 50),
+      {  INT32_C(   160606091),  INT32_C(   611246577),  INT32_C(   160606091),  INT32_C(   611246577) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  6),
+      { -INT32_C(   251851744), -INT32_C(    70580465), -INT32_C(    70580465), -INT32_C(   815560801) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_conflict_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 3836190323546695159), -INT64_C( 3836190323546695159) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C(  574656273835555747),  INT64_C(  574656273835555747) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C( 7987070288126321175),  INT64_C( 7987070288126321175) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C(  952954552553872614), -INT64_C( 4813556221039035574) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 2138441502769412239), -INT64_C( 2138441502769412239) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { { -INT64_C( 5167535771094659629), -INT64_C( 5167535771094659629) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { { -INT64_C( 2829274512046220981), -INT64_C( 2829274512046220981) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C( 1278576684693759249),  INT64_C( 5975972261779483961) },
+      {  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_conflict_epi64(a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 3223502752327194229),  INT64_C( 1093717759293561982) },
+      UINT8_C( 35),
+      {  INT64_C( 2085077086398128965),  INT64_C( 2085077086398128965) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C( 7091196941665950041),  INT64_C( 2022233279421264768) },
+      UINT8_C(190),
+      {  INT64_C( 6250473434675901724),  INT64_C( 6250473434675901724) },
+      {  INT64_C( 7091196941665950041),  INT64_C(                   1) } },
+    { { -INT64_C( 3382493465065448857),  INT64_C( 7031679985480356769) },
+      UINT8_C(169),
+      {  INT64_C( 3306295463973153329),  INT64_C( 3306295463973153329) },
+      {  INT64_C(                   0),  INT64_C( 7031679985480356769) } },
+    { {  INT64_C( 8944012775363039963),  INT64_C(  555768807481558044) },
+      UINT8_C(183),
+      {  INT64_C( 3113378461348839461),  INT64_C( 6646166505059421408) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 1635750489596872350), -INT64_C( 3172394322061234193) },
+      UINT8_C(252),
+      {  INT64_C( 8960825081724484482),  INT64_C( 8960825081724484482) },
+      { -INT64_C( 1635750489596872350), -INT64_C( 3172394322061234193) } },
+    { { -INT64_C( 6565221834353010675),  INT64_C( 3714222947504735725) },
+      UINT8_C(185),
+      {  INT64_C( 3396078984769495018),  INT64_C( 3396078984769495018) },
+      {  INT64_C(                   0),  INT64_C( 3714222947504735725) } },
+    { {  INT64_C( 6489834323426832494),  INT64_C( 7188358694869980665) },
+      UINT8_C( 40),
+      { -INT64_C( 6083893520661092631), -INT64_C( 6083893520661092631) },
+      {  INT64_C( 6489834323426832494),  INT64_C( 7188358694869980665) } },
+    { { -INT64_C( 8677090127078651964), -INT64_C( 8458938937297338350) },
+      UINT8_C(212),
+      {  INT64_C( 2412941093333256025), -INT64_C( 4988530694311761800) },
+      { -INT64_C( 8677090127078651964), -INT64_C( 8458938937297338350) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_conflict_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C( 76),
+      {  INT64_C( 2402378146716768913),  INT64_C( 2402378146716768913) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(250),
+      { -INT64_C( 5393497164869089761), -INT64_C( 5393497164869089761) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { UINT8_C( 30),
+      { -INT64_C( 9026487489182144452), -INT64_C( 9026487489182144452) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { UINT8_C( 58),
+      {  INT64_C( 3709195002538067422),  INT64_C( 3709195002538067422) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { UINT8_C(112),
+      { -INT64_C(  386779591459624650), -INT64_C(  386779591459624650) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C( 5647823693994247160),  INT64_C( 5647823693994247160) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 20),
+      { -INT64_C( 5606829859849435082), -INT64_C( 5606829859849435082) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 60),
+      { -INT64_C( 9114719524520986618), -INT64_C( 4135309005841557026) },
+      {  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_conflict_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  1003753847), -INT32_C(  1003753847), -INT32_C(  1003753847), -INT32_C(  1003753847), -INT32_C(  1891242510), -INT32_C(  1003753847), -INT32_C(  1003753847), -INT32_C(  1003753847) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           7),  INT32_C(           0),  INT32_C(          15),  INT32_C(          47),  INT32_C(         111) } },
+    { { -INT32_C(  1881179307), -INT32_C(    11723606), -INT32_C(    11723606), -INT32_C(   311827500), -INT32_C(  1500800115), -INT32_C(    11723606), -INT32_C(  1500800115), -INT32_C(   311827500) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           6),  INT32_C(          16),  INT32_C(           8) } },
+    { { -INT32_C(    14981081), -INT32_C(  1836157054), -INT32_C(  1415228655), -INT32_C(  1836157054), -INT32_C(    79282006), -INT32_C(   271188352), -INT32_C(    79282006), -INT32_C(  1836157054) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(          10) } },
+    { {  INT32_C(   485693523),  INT32_C(  1136462841), -INT32_C(   290577125),  INT32_C(  1863754092),  INT32_C(  1790525151),  INT32_C(  1904983703),  INT32_C(  1904983703),  INT32_C(  1863754092) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           8) } },
+    { { -INT32_C(  1516743102), -INT32_C(  1516743102), -INT32_C(  1892717292), -INT32_C(  1516743102), -INT32_C(  1516743102), -INT32_C(  1516743102), -INT32_C(  1892717292), -INT32_C(  1892717292) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           3),  INT32_C(          11),  INT32_C(          27),  INT32_C(           4),  INT32_C(          68) } },
+    { { -INT32_C(   100163043),  INT32_C(   809795671),  INT32_C(  1091349787), -INT32_C(   100163043), -INT32_C(   100163043),  INT32_C(  1091349787),  INT32_C(   809795671), -INT32_C(  1508485943) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           9),  INT32_C(           4),  INT32_C(           2),  INT32_C(           0) } },
+    { {  INT32_C(  1860960502),  INT32_C(  1988162655), -INT32_C(   269642078),  INT32_C(  1860960502),  INT32_C(  1988162655),  INT32_C(  1988162655),  INT32_C(  1860960502), -INT32_C(  1093186186) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(          18),  INT32_C(           9),  INT32_C(           0) } },
+    { {  INT32_C(    19720639), -INT32_C(   409151889),  INT32_C(   896323020), -INT32_C(   572104821), -INT32_C(  1399456208),  INT32_C(    19720639), -INT32_C(   572104821),  INT32_C(   896323020) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           8),  INT32_C(           4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_conflict_epi32(a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1549209245), -INT32_C(   301099743),  INT32_C(   180560434), -INT32_C(  1573217837),  INT32_C(   594647063),  INT32_C(   251043951),  INT32_C(  1394275670), -INT32_C(   407738950) },
+      UINT8_C( 87),
+      { -INT32_C(    91808389), -INT32_C(    91808389),  INT32_C(   824966483),  INT32_C(   824966483), -INT32_C(    91808389),  INT32_C(   824966483),  INT32_C(   824966483), -INT32_C(    91808389) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0), -INT32_C(  1573217837),  INT32_C(           3),  INT32_C(   251043951),  INT32_C(          44), -INT32_C(   407738950) } },
+    { {  INT32_C(  1235059429),  INT32_C(  1376164618), -INT32_C(  2101315195),  INT32_C(  1706580726),  INT32_C(  1301779058),  INT32_C(  1951000306), -INT32_C(   361006216), -INT32_C(    30728126) },
+      UINT8_C(153),
+      {  INT32_C(   889924660),  INT32_C(   889924660),  INT32_C(   540186951),  INT32_C(   540186951), -INT32_C(  1034445147),  INT32_C(   889924660), -INT32_C(  1804310195),  INT32_C(   540186951) },
+      {  INT32_C(           0),  INT32_C(  1376164618), -INT32_C(  2101315195),  INT32_C(           4),  INT32_C(           0),  INT32_C(  1951000306), -INT32_C(   361006216),  INT32_C(          12) } },
+    { {  INT32_C(   450379615), -INT32_C(  1220604761), -INT32_C(   860643212), -INT32_C(   942910861), -INT32_C(  2087180781), -INT32_C(  1850594846), -INT32_C(   512744764), -INT32_C(  1812692185) },
+      UINT8_C( 93),
+      {  INT32_C(  2063000715),  INT32_C(   108333130),  INT32_C(  2063000715),  INT32_C(   541175455),  INT32_C(   990443634), -INT32_C(   503003702),  INT32_C(   108333130), -INT32_C(   503003702) },
+      {  INT32_C(           0), -INT32_C(  1220604761),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1850594846),  INT32_C(           2), -INT32_C(  1812692185) } },
+    { {  INT32_C(   694887495), -INT32_C(   869217579), -INT32_C(  1768987415), -INT32_C(   659438123), -INT32_C(  1054409158), -INT32_C(    23894127), -INT32_C(  1805875381), -INT32_C(   674005783) },
+      UINT8_C(213),
+      {  INT32_C(    35337482),  INT32_C(   654369154), -INT32_C(   471872545),  INT32_C(    35337482), -INT32_C(   471872545),  INT32_C(  1773111124),  INT32_C(  1773111124),  INT32_C(   654369154) },
+      {  INT32_C(           0), -INT32_C(   869217579),  INT32_C(           0), -INT32_C(   659438123),  INT32_C(           4), -INT32_C(    23894127),  INT32_C(          32),  INT32_C(           2) } },
+    { {  INT32_C(  1514895737),  INT32_C(  1720475891),  INT32_C(  1058286799), -INT32_C(  1406508052), -INT32_C(  1674593094), -INT32_C(  1831861277), -INT32_C(  1917417276), -INT32_C(   827935115) },
+      UINT8_C(161),
+      { -INT32_C(  1986327648),  INT32_C(    11275708), -INT32_C(  1986327648),  INT32_C(    11275708), -INT32_C(  1986327648), -INT32_C(  1986327648),  INT32_C(    11275708), -INT32_C(  1986327648) },
+      {  INT32_C(           0),  INT32_C(  1720475891),  INT32_C(  1058286799), -INT32_C(  1406508052), -INT32_C(  1674593094),  INT32_C(          21), -INT32_C(  1917417276),  INT32_C(          53) } },
+    { {  INT32_C(   451323184), -INT32_C(   634717491),  INT32_C(   283082066), -INT32_C(   598451068), -INT32_C(  1711235695),  INT32_C(  2063032188), -INT32_C(  1488302298), -INT32_C(    96385520) },
+      UINT8_C(144),
+      { -INT32_C(   256872468), -INT32_C(  1665687152), -INT32_C(   199156933), -INT32_C(   256872468), -INT32_C(  1665687152), -INT32_C(   199156933), -INT32_C(   199156933), -INT32_C(  1665687152) },
+      {  INT32_C(   451323184), -INT32_C(   634717491),  INT32_C(   283082066), -INT32_C(   598451068),  INT32_C(           2),  INT32_C(  2063032188), -INT32_C(  1488302298),  INT32_C(          18) } },
+    { {  INT32_C(  1780510803),  INT32_C(  1365362634), -INT32_C(  1559259756),  INT32_C(   303612918), -INT32_C(   169842163),  INT32_C(  1923465262), -INT32_C(  1689931026),  INT32_C(  2002865108) },
+      UINT8_C(139),
+      {  INT32_C(  1853308667), -INT32_C(   682924742), -INT32_C(   682924742), -INT32_C(  1008936554), -INT32_C(   768198015),  INT32_C(   125636156),  INT32_C(  1853308667), -INT32_C(   768198015) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1559259756),  INT32_C(           0), -INT32_C(   169842163),  INT32_C(  1923465262), -INT32_C(  1689931026),  INT32_C(          16) } },
+    { {  INT32_C(  1892882966),  INT32_C(  1621233599),  INT32_C(    34920926), -INT32_C(   195591269),  INT32_C(  1521314651), -INT32_C(    91432257), -INT32_C(  2082811630),  INT32_C(  1847125890) },
+      UINT8_C( 12),
+      {  INT32_C(  1447911620),  INT32_C(  1447911620),  INT32_C(   263475254), -INT32_C(   644804303),  INT32_C(    64603247),  INT32_C(   534613429),  INT32_C(   263475254), -INT32_C(   644804303) },
+      {  INT32_C(  1892882966),  INT32_C(  1621233599),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1521314651), -INT32_C(    91432257), -INT32_C(  2082811630),  INT32_C(  1847125890) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_conflict_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 84),
+      {  INT32_C(  1505995363), -INT32_C(   540250202),  INT32_C(  1505995363),  INT32_C(  1505995363), -INT32_C(   540250202),  INT32_C(  1505995363), -INT32_C(   540250202), -INT32_C(   540250202) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(          18),  INT32_C(           0) } },
+    { UINT8_C( 52),
+      {  INT32_C(  1097937084), -INT32_C(   590958995),  INT32_C(  1420582206), -INT32_C(    28532622),  INT32_C(  1097937084), -INT32_C(    28532622),  INT32_C(  1420582206),  INT32_C(  1420582206) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(191),
+      {  INT32_C(  1099455517),  INT32_C(  2112508915),  INT32_C(   149779381),  INT32_C(  2112508915), -INT32_C(  1198095236),  INT32_C(  1099455517),  INT32_C(   149779381), -INT32_C(  1198095236) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          16) } },
+    { UINT8_C(207),
+      { -INT32_C(  1377078993), -INT32_C(   256992674), -INT32_C(   307755731), -INT32_C(   256992674), -INT32_C(   256992674), -INT32_C(  1377078993),  INT32_C(   112579678), -INT32_C(  2014465757) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 98),
+      { -INT32_C(    98477340), -INT32_C(    98477340), -INT32_C(    98477340), -INT32_C(    98477340), -INT32_C(    98477340), -INT32_C(    98477340), -INT32_C(    98477340), -INT32_C(    98477340) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          31),  INT32_C(          63),  INT32_C(           0) } },
+    { UINT8_C(219),
+      {  INT32_C(   296475207), -INT32_C(  1249075047),  INT32_C(   296475207), -INT32_C(  1249075047),  INT32_C(   880130146), -INT32_C(  1249075047),  INT32_C(   296475207),  INT32_C(   880130146) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5),  INT32_C(          16) } },
+    { UINT8_C( 67),
+      {  INT32_C(  1860299201), -INT32_C(   335718108), -INT32_C(   335718108),  INT32_C(  1151391699), -INT32_C(  1067242709),  INT32_C(  1151391699), -INT32_C(  1067242709),  INT32_C(   272711372) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0) } },
+    { UINT8_C( 57),
+      { -INT32_C(  1724271388),  INT32_C(   578551213),  INT32_C(  1389708392),  INT32_C(  1389708392), -INT32_C(   721049402),  INT32_C(  1898714080),  INT32_C(  1898714080), -INT32_C(  1724271388) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_conflict_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 6433471868840046400), -INT64_C( 6433471868840046400), -INT64_C( 6433471868840046400), -INT64_C( 6433471868840046400) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   7) } },
+    { {  INT64_C(  481925107280829791),  INT64_C(  481925107280829791),  INT64_C( 7649219929928440691),  INT64_C(  481925107280829791) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   3) } },
+    { {  INT64_C( 2080653903800574712),  INT64_C( 2080653903800574712), -INT64_C( 7429146349723473656),  INT64_C( 2080653903800574712) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   3) } },
+    { {  INT64_C( 4991320015244010032),  INT64_C( 8084323100025830890), -INT64_C( 7103895655442837612), -INT64_C( 7103895655442837612) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   4) } },
+    { {  INT64_C( 6998573879775982256),  INT64_C( 6998573879775982256),  INT64_C( 6998573879775982256),  INT64_C( 6998573879775982256) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   7) } },
+    { {  INT64_C( 6558933734427326708),  INT64_C( 6558933734427326708),  INT64_C( 6593051215870163445),  INT64_C( 6593051215870163445) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   4) } },
+    { { -INT64_C( 7807380476157813966),  INT64_C( 8096706207469431772), -INT64_C(  596946918730340061), -INT64_C( 7807380476157813966) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C( 5733292792995668300),  INT64_C( 1823054127948007004),  INT64_C( 5733292792995668300),  INT64_C( 1823054127948007004) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_conflict_epi64(a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 6031656224657952563), -INT64_C( 8964634992108340522),  INT64_C( 4703362372691729367), -INT64_C( 5178312210881676994) },
+      UINT8_C( 12),
+      {  INT64_C( 4854454762936276037),  INT64_C( 4854454762936276037),  INT64_C( 4854454762936276037),  INT64_C( 4854454762936276037) },
+      { -INT64_C( 6031656224657952563), -INT64_C( 8964634992108340522),  INT64_C(                   3),  INT64_C(                   7) } },
+    { { -INT64_C( 2458739063105978033),  INT64_C( 3120367063039315006), -INT64_C( 6614486221989747276), -INT64_C( 6716473464060446865) },
+      UINT8_C(218),
+      {  INT64_C( 3016903011371298292), -INT64_C(  446383533888100239), -INT64_C(  446383533888100239), -INT64_C(  446383533888100239) },
+      { -INT64_C( 2458739063105978033),  INT64_C(                   0), -INT64_C( 6614486221989747276),  INT64_C(                   6) } },
+    { { -INT64_C(   11158066585825196), -INT64_C( 9007290691119973939),  INT64_C( 6282211083765764952), -INT64_C( 8767187324986943231) },
+      UINT8_C(244),
+      {  INT64_C(  928195840780057413),  INT64_C( 9159677747936269348), -INT64_C( 7963565738696506727), -INT64_C( 7963565738696506727) },
+      { -INT64_C(   11158066585825196), -INT64_C( 9007290691119973939),  INT64_C(                   0), -INT64_C( 8767187324986943231) } },
+    { {  INT64_C( 3629139005874080637),  INT64_C( 7348950902813218837), -INT64_C( 8624121722645576977),  INT64_C( 5335249285809967248) },
+      UINT8_C( 58),
+      {  INT64_C( 6304793277916382435), -INT64_C( 4156225949635904053), -INT64_C( 5192520157462825101), -INT64_C( 5192520157462825101) },
+      {  INT64_C( 3629139005874080637),  INT64_C(                   0), -INT64_C( 8624121722645576977),  INT64_C(                   4) } },
+    { {  INT64_C( 9213471681621277028), -INT64_C( 7916509646599791071), -INT64_C( 7030005333979222262),  INT64_C( 1291075584159676839) },
+      UINT8_C(163),
+      { -INT64_C( 1407748300088032040), -INT64_C( 1407748300088032040), -INT64_C( 1407748300088032040), -INT64_C( 1407748300088032040) },
+      {  INT64_C(                   0),  INT64_C(                   1), -INT64_C( 7030005333979222262),  INT64_C( 1291075584159676839) } },
+    { { -INT64_C( 4513066107662647377), -INT64_C( 6058383767786454235), -INT64_C( 3350301529128435332), -INT64_C( 4810122918754962300) },
+      UINT8_C(254),
+      {  INT64_C( 7100673121539579370),  INT64_C( 6181834355357708734),  INT64_C( 6181834355357708734),  INT64_C( 7100673121539579370) },
+      { -INT64_C( 4513066107662647377),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   1) } },
+    { { -INT64_C( 8643162575172488454), -INT64_C( 4508559821842480293),  INT64_C(  220396372964255776),  INT64_C( 3157820099237281854) },
+      UINT8_C( 66),
+      {  INT64_C( 5529525430637323494),  INT64_C( 3109172100511097853),  INT64_C( 7837275727513190751),  INT64_C( 3109172100511097853) },
+      { -INT64_C( 8643162575172488454),  INT64_C(                   0),  INT64_C(  220396372964255776),  INT64_C( 3157820099237281854) } },
+    { { -INT64_C( 8046115046736585788), -INT64_C( 1880916937266214539), -INT64_C( 3814695408740343730),  INT64_C(  244485328994135553) },
+      UINT8_C( 30),
+      {  INT64_C( 8772863445965674817), -INT64_C( 5167500394201485238), -INT64_C( 5988474630021510943), -INT64_C( 5167500394201485238) },
+      { -INT64_C( 8046115046736585788),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_conflict_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 55),
+      {  INT64_C( 4067460000985041736),  INT64_C( 4067460000985041736),  INT64_C( 4067460000985041736),  INT64_C( 4067460000985041736) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   0) } },
+    { UINT8_C(205),
+      { -INT64_C( 6941107426643168894), -INT64_C( 6941107426643168894),  INT64_C( 6460537355673380867), -INT64_C( 6941107426643168894) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   3) } },
+    { UINT8_C( 16),
+      {  INT64_C(  114843129958397547),  INT64_C(  114843129958397547),  INT64_C(  114843129958397547),  INT64_C( 4539232978591667523) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(183),
+      {  INT64_C( 6711512464183011768),  INT64_C( 6711512464183011768), -INT64_C( 2971254605862392364), -INT64_C( 2971254605862392364) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(152),
+      { -INT64_C( 4557386550641499514), -INT64_C( 4557386550641499514), -INT64_C( 4557386550641499514), -INT64_C( 4557386550641499514) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   7) } },
+    { UINT8_C( 74),
+      { -INT64_C( 5622079841363029506), -INT64_C( 5622079841363029506), -INT64_C( 5622079841363029506), -INT64_C( 5622079841363029506) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   7) } },
+    { UINT8_C( 10),
+      { -INT64_C( 1094069545455686674),  INT64_C(  327325973558108630), -INT64_C( 1094069545455686674), -INT64_C( 1094069545455686674) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   5) } },
+    { UINT8_C(197),
+      {  INT64_C( 4303839551928570117), -INT64_C( 4546451625219060489),  INT64_C( 1290845805649613616),  INT64_C( 3863896235639668200) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_conflict_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1780523513),  INT32_C(   551138015), -INT32_C(  1512207890),  INT32_C(   563284369), -INT32_C(  1780523513), -INT32_C(  1512207890), -INT32_C(  1780523513),  INT32_C(   563284369),
+        -INT32_C(  1780523513),  INT32_C(   551138015), -INT32_C(  1512207890), -INT32_C(  1780523513),  INT32_C(   563284369),  INT32_C(   563284369),  INT32_C(   563284369),  INT32_C(   563284369) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           4),  INT32_C(          17),  INT32_C(           8),
+         INT32_C(          81),  INT32_C(           2),  INT32_C(          36),  INT32_C(         337),  INT32_C(         136),  INT32_C(        4232),  INT32_C(       12424),  INT32_C(       28808) } },
+    { { -INT32_C(   311759694),  INT32_C(  2010657525), -INT32_C(  1168482671), -INT32_C(  1168482671), -INT32_C(   737112226),  INT32_C(  2010657525),  INT32_C(  1695682716),  INT32_C(  2006241494),
+        -INT32_C(  1088642750), -INT32_C(   737112226), -INT32_C(  1088642750), -INT32_C(   311759694), -INT32_C(   737112226),  INT32_C(  1454846853),  INT32_C(  2010657525), -INT32_C(   311759694) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(          16),  INT32_C(         256),  INT32_C(           1),  INT32_C(         528),  INT32_C(           0),  INT32_C(          34),  INT32_C(        2049) } },
+    { { -INT32_C(  1920795181),  INT32_C(  2038792252),  INT32_C(   964607396), -INT32_C(  1920795181),  INT32_C(   125049776), -INT32_C(   155836760),  INT32_C(   307036889),  INT32_C(   964607396),
+        -INT32_C(  1542584035),  INT32_C(  2038792252),  INT32_C(   964607396), -INT32_C(   264354787), -INT32_C(  1542584035),  INT32_C(   271885469),  INT32_C(  1398575141), -INT32_C(   264354787) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),
+         INT32_C(           0),  INT32_C(           2),  INT32_C(         132),  INT32_C(           0),  INT32_C(         256),  INT32_C(           0),  INT32_C(           0),  INT32_C(        2048) } },
+    { {  INT32_C(  1617479092),  INT32_C(  2142655311), -INT32_C(  1690819919), -INT32_C(   412178341), -INT32_C(  2062362977),  INT32_C(  2101732640), -INT32_C(  2062362977),  INT32_C(  1617479092),
+        -INT32_C(  1922602514),  INT32_C(   207938841),  INT32_C(   802576728),  INT32_C(  2142655311), -INT32_C(  1690819919), -INT32_C(  1690819919), -INT32_C(  1690819919), -INT32_C(   391263348) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(           1),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           4),  INT32_C(        4100),  INT32_C(       12292),  INT32_C(           0) } },
+    { {  INT32_C(  1133546344),  INT32_C(  1309441708), -INT32_C(  1869741312),  INT32_C(  1515681759),  INT32_C(  1309441708),  INT32_C(  1515681759),  INT32_C(  1133546344), -INT32_C(  1869741312),
+         INT32_C(  1133546344), -INT32_C(  1869741312),  INT32_C(  1515681759),  INT32_C(  1309441708),  INT32_C(  1133546344),  INT32_C(  1133546344),  INT32_C(  1309441708),  INT32_C(  1133546344) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           8),  INT32_C(           1),  INT32_C(           4),
+         INT32_C(          65),  INT32_C(         132),  INT32_C(          40),  INT32_C(          18),  INT32_C(         321),  INT32_C(        4417),  INT32_C(        2066),  INT32_C(       12609) } },
+    { { -INT32_C(   902452078), -INT32_C(   421181651),  INT32_C(   499121599), -INT32_C(   725130486),  INT32_C(  1108615541),  INT32_C(  1108615541),  INT32_C(   227009681),  INT32_C(  1108615541),
+         INT32_C(  1108615541), -INT32_C(   421181651), -INT32_C(   421181651),  INT32_C(   499121599), -INT32_C(   421181651),  INT32_C(   554134597),  INT32_C(   227009681),  INT32_C(  1108615541) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(          48),
+         INT32_C(         176),  INT32_C(           2),  INT32_C(         514),  INT32_C(           4),  INT32_C(        1538),  INT32_C(           0),  INT32_C(          64),  INT32_C(         432) } },
+    { { -INT32_C(  2037471569),  INT32_C(  1576461421),  INT32_C(   580352259), -INT32_C(   374201813), -INT32_C(  1677713687), -INT32_C(   541953249),  INT32_C(   407000900), -INT32_C(  1677713687),
+         INT32_C(  2075334681), -INT32_C(   374201813),  INT32_C(  2075334681), -INT32_C(  1853852805), -INT32_C(  2037471569), -INT32_C(   694254272), -INT32_C(   541953249),  INT32_C(  2075334681) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),
+         INT32_C(           0),  INT32_C(           8),  INT32_C(         256),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          32),  INT32_C(        1280) } },
+    { {  INT32_C(  1582911753),  INT32_C(   201416793),  INT32_C(   169356933),  INT32_C(  1573183963), -INT32_C(  2093066342),  INT32_C(  1218259494),  INT32_C(   169356933),  INT32_C(   201416793),
+        -INT32_C(  2093066342),  INT32_C(  1389947066),  INT32_C(  1298206188), -INT32_C(  2093066342),  INT32_C(  1573183963),  INT32_C(  1582911753), -INT32_C(  1337498129),  INT32_C(  1717425341) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           2),
+         INT32_C(          16),  INT32_C(           0),  INT32_C(           0),  INT32_C(         272),  INT32_C(           8),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_conflict_epi32(a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   346282994),  INT32_C(   479245960), -INT32_C(  1337587221), -INT32_C(  1879025542), -INT32_C(   871233427), -INT32_C(   935077928),  INT32_C(  1742142096), -INT32_C(  2043198105),
+        -INT32_C(   824247691), -INT32_C(   843738725),  INT32_C(  1956583790),  INT32_C(   610058025), -INT32_C(   416765486), -INT32_C(   509831793),  INT32_C(   360796668),  INT32_C(  2125339514) },
+      UINT16_C(61967),
+      {  INT32_C(   904418918),  INT32_C(   904418918), -INT32_C(  1060639279), -INT32_C(  1095245636), -INT32_C(  1095245636), -INT32_C(  1095245636), -INT32_C(  1095245636),  INT32_C(   904418918),
+        -INT32_C(  1095245636),  INT32_C(   904418918), -INT32_C(  1095245636), -INT32_C(  1060639279), -INT32_C(   282766018), -INT32_C(  1095245636), -INT32_C(   282766018), -INT32_C(  1060639279) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(   871233427), -INT32_C(   935077928),  INT32_C(  1742142096), -INT32_C(  2043198105),
+        -INT32_C(   824247691),  INT32_C(         131),  INT32_C(  1956583790),  INT32_C(   610058025),  INT32_C(           0),  INT32_C(        1400),  INT32_C(        4096),  INT32_C(        2052) } },
+    { {  INT32_C(   850043576),  INT32_C(  1299256382),  INT32_C(   126323020),  INT32_C(   578664247), -INT32_C(  1296050709), -INT32_C(     2649871), -INT32_C(   593832810), -INT32_C(   519357044),
+        -INT32_C(   107351612),  INT32_C(   418293561), -INT32_C(  2142871469),  INT32_C(   174185349), -INT32_C(  1096962159), -INT32_C(  1399118919),  INT32_C(   876912588), -INT32_C(  1672460901) },
+      UINT16_C(31928),
+      { -INT32_C(  2133159323), -INT32_C(  1904793308), -INT32_C(  1904793308), -INT32_C(  2133159323),  INT32_C(  2121927219),  INT32_C(  2121927219),  INT32_C(  1144427537), -INT32_C(  1268952687),
+        -INT32_C(  1904793308), -INT32_C(  1268952687), -INT32_C(  1486124561), -INT32_C(  1486124561),  INT32_C(  1437028468), -INT32_C(  2133159323), -INT32_C(  1904793308), -INT32_C(  2133159323) },
+      {  INT32_C(   850043576),  INT32_C(  1299256382),  INT32_C(   126323020),  INT32_C(           1),  INT32_C(           0),  INT32_C(          16), -INT32_C(   593832810),  INT32_C(           0),
+        -INT32_C(   107351612),  INT32_C(   418293561),  INT32_C(           0),  INT32_C(        1024),  INT32_C(           0),  INT32_C(           9),  INT32_C(         262), -INT32_C(  1672460901) } },
+    { {  INT32_C(   866789651), -INT32_C(   998395644),  INT32_C(  1662989548), -INT32_C(  1757271638), -INT32_C(   839684712), -INT32_C(  1627245058),  INT32_C(   253844596), -INT32_C(    70386315),
+         INT32_C(  1919180257),  INT32_C(   747951765),  INT32_C(  2009010038), -INT32_C(   332317730), -INT32_C(  1282849397), -INT32_C(  1685135375),  INT32_C(  1954337749),  INT32_C(  1759837793) },
+      UINT16_C(13007),
+      {  INT32_C(   835410707), -INT32_C(   275889732), -INT32_C(  1272430562), -INT32_C(  1187145927),  INT32_C(   835410707),  INT32_C(  1379815306), -INT32_C(  1499061559), -INT32_C(   989025365),
+         INT32_C(  1379815306),  INT32_C(  2002418544), -INT32_C(  1868289353), -INT32_C(  1187145927), -INT32_C(   989025365), -INT32_C(  1868289353), -INT32_C(   275889732), -INT32_C(  1031351972) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   839684712), -INT32_C(  1627245058),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  1919180257),  INT32_C(           0),  INT32_C(  2009010038), -INT32_C(   332317730),  INT32_C(         128),  INT32_C(        1024),  INT32_C(  1954337749),  INT32_C(  1759837793) } },
+    { {  INT32_C(  1761947722), -INT32_C(  1361250621), -INT32_C(  2096078040), -INT32_C(   154562298),  INT32_C(   295698246), -INT32_C(  1790983088),  INT32_C(  1540548672),  INT32_C(  1371679409),
+        -INT32_C(  1672285691),  INT32_C(  1509383699), -INT32_C(  1536400436),  INT32_C(   342455740), -INT32_C(  1276283978), -INT32_C(   357812422), -INT32_C(   226965272),  INT32_C(  1075842131) },
+      UINT16_C(14592),
+      { -INT32_C(  1113451966),  INT32_C(  1332421885), -INT32_C(   386667455),  INT32_C(  1340097047),  INT32_C(    58519552), -INT32_C(   985741996),  INT32_C(  1332421885),  INT32_C(  1340097047),
+         INT32_C(  1830670583), -INT32_C(  1632626009), -INT32_C(  1113451966),  INT32_C(    58519552), -INT32_C(  1113451966),  INT32_C(  1332421885), -INT32_C(   985741996), -INT32_C(   985741996) },
+      {  INT32_C(  1761947722), -INT32_C(  1361250621), -INT32_C(  2096078040), -INT32_C(   154562298),  INT32_C(   295698246), -INT32_C(  1790983088),  INT32_C(  1540548672),  INT32_C(  1371679409),
+         INT32_C(           0),  INT32_C(  1509383699), -INT32_C(  1536400436),  INT32_C(          16),  INT32_C(        1025),  INT32_C(          66), -INT32_C(   226965272),  INT32_C(  1075842131) } },
+    { {  INT32_C(  2010348869),  INT32_C(   483154627), -INT32_C(  1708005591), -INT32_C(   595381617), -INT32_C(  1770265311), -INT32_C(  1114775681),  INT32_C(   614006689),  INT32_C(   534548961),
+        -INT32_C(  2065758152),  INT32_C(   876240362),  INT32_C(  1547077692), -INT32_C(   814920909),  INT32_C(   322816429), -INT32_C(  1254674975),  INT32_C(   569189299),  INT32_C(   723224420) },
+      UINT16_C(16038),
+      { -INT32_C(   378049504),  INT32_C(   211928602),  INT32_C(   211928602), -INT32_C(   378049504),  INT32_C(  1584928565),  INT32_C(  1879123693),  INT32_C(  1879123693),  INT32_C(  1584928565),
+         INT32_C(  1584928565),  INT32_C(   211928602),  INT32_C(   211928602),  INT32_C(   211928602), -INT32_C(   378049504),  INT32_C(  1879123693), -INT32_C(   378049504),  INT32_C(   211928602) },
+      {  INT32_C(  2010348869),  INT32_C(           0),  INT32_C(           2), -INT32_C(   595381617), -INT32_C(  1770265311),  INT32_C(           0),  INT32_C(   614006689),  INT32_C(          16),
+        -INT32_C(  2065758152),  INT32_C(           6),  INT32_C(         518),  INT32_C(        1542),  INT32_C(           9),  INT32_C(          96),  INT32_C(   569189299),  INT32_C(   723224420) } },
+    { {  INT32_C(   583908111),  INT32_C(  1435939345), -INT32_C(  1018048851),  INT32_C(  1719430555),  INT32_C(  1695544185),  INT32_C(  1072691280), -INT32_C(   962661134), -INT32_C(   292193584),
+        -INT32_C(   544747959), -INT32_C(   768487914), -INT32_C(  1523850033), -INT32_C(  1143755558), -INT32_C(  1085753235), -INT32_C(    38266752), -INT32_C(   704127365),  INT32_C(   132397757) },
+      UINT16_C(21040),
+      { -INT32_C(   674055100), -INT32_C(  1553494805), -INT32_C(  1553494805), -INT32_C(   128885775),  INT32_C(   843364111), -INT32_C(  1553494805), -INT32_C(   128885775), -INT32_C(  1682845064),
+        -INT32_C(   128885775), -INT32_C(  1553494805), -INT32_C(  1553494805), -INT32_C(  1682845064), -INT32_C(  1682845064),  INT32_C(   843364111), -INT32_C(  1312812220), -INT32_C(  1227702567) },
+      {  INT32_C(   583908111),  INT32_C(  1435939345), -INT32_C(  1018048851),  INT32_C(  1719430555),  INT32_C(           0),  INT32_C(           6), -INT32_C(   962661134), -INT32_C(   292193584),
+        -INT32_C(   544747959),  INT32_C(          38), -INT32_C(  1523850033), -INT32_C(  1143755558),  INT32_C(        2176), -INT32_C(    38266752),  INT32_C(           0),  INT32_C(   132397757) } },
+    { { -INT32_C(   175184514),  INT32_C(  1464254375), -INT32_C(  1566322635), -INT32_C(  1238027909), -INT32_C(  1153882311), -INT32_C(  1668258306), -INT32_C(  1016325940), -INT32_C(   545771698),
+        -INT32_C(  1470756925), -INT32_C(  1209933882), -INT32_C(   442267327), -INT32_C(   722238284), -INT32_C(  1326755597),  INT32_C(   285011112),  INT32_C(  1086708231),  INT32_C(  1099008880) },
+      UINT16_C(16550),
+      { -INT32_C(   182493146), -INT32_C(  1352977270), -INT32_C(  1352977270), -INT32_C(  1069925289), -INT32_C(   182493146),  INT32_C(   696810850), -INT32_C(  2064754625),  INT32_C(  1406157848),
+        -INT32_C(  1352977270),  INT32_C(  1406157848), -INT32_C(  1069925289),  INT32_C(  1510614240), -INT32_C(    18494467), -INT32_C(  1069925289), -INT32_C(    18494467),  INT32_C(  2087980310) },
+      { -INT32_C(   175184514),  INT32_C(           0),  INT32_C(           2), -INT32_C(  1238027909), -INT32_C(  1153882311),  INT32_C(           0), -INT32_C(  1016325940),  INT32_C(           0),
+        -INT32_C(  1470756925), -INT32_C(  1209933882), -INT32_C(   442267327), -INT32_C(   722238284), -INT32_C(  1326755597),  INT32_C(   285011112),  INT32_C(        4096),  INT32_C(  1099008880) } },
+    { {  INT32_C(  1698335529),  INT32_C(   202200719), -INT32_C(  1993254559),  INT32_C(  1720747110), -INT32_C(  1141585367),  INT32_C(   889536307),  INT32_C(  1270630257), -INT32_C(  1198898902),
+         INT32_C(  1440867091),  INT32_C(  1097871573),  INT32_C(   334929733),  INT32_C(   261973854),  INT32_C(   648628390),  INT32_C(   822071180), -INT32_C(   347011554), -INT32_C(  1789481450) },
+      UINT16_C(48777),
+      { -INT32_C(    64404412), -INT32_C(  1811329012),  INT32_C(  1912231862), -INT32_C(  1637610808), -INT32_C(  1811329012),  INT32_C(    25380143),  INT32_C(   829818528), -INT32_C(  1006298183),
+         INT32_C(   311702550),  INT32_C(  1009463892), -INT32_C(    64404412), -INT32_C(  1667958405),  INT32_C(  1104218281), -INT32_C(    42193614),  INT32_C(  1009463892),  INT32_C(  1009463892) },
+      {  INT32_C(           0),  INT32_C(   202200719), -INT32_C(  1993254559),  INT32_C(           0), -INT32_C(  1141585367),  INT32_C(   889536307),  INT32_C(  1270630257),  INT32_C(           0),
+         INT32_C(  1440867091),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   347011554),  INT32_C(       16896) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_conflict_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(32603),
+      { -INT32_C(    17217705),  INT32_C(  2014855375), -INT32_C(  1180124477), -INT32_C(    17217705), -INT32_C(  1826378960), -INT32_C(  1826378960),  INT32_C(  2014855375), -INT32_C(  1826378960),
+        -INT32_C(  1826378960), -INT32_C(  1826378960), -INT32_C(  1180124477), -INT32_C(    17217705), -INT32_C(  1180124477), -INT32_C(    17217705), -INT32_C(  1826378960), -INT32_C(    17217705) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),
+         INT32_C(         176),  INT32_C(         432),  INT32_C(           4),  INT32_C(           9),  INT32_C(        1028),  INT32_C(        2057),  INT32_C(         944),  INT32_C(           0) } },
+    { UINT16_C( 5421),
+      {  INT32_C(   324366915),  INT32_C(  1465138537),  INT32_C(  1411380061),  INT32_C(    62713822), -INT32_C(   508678288),  INT32_C(  1465138537), -INT32_C(   508678288),  INT32_C(  1465138537),
+         INT32_C(   724368130), -INT32_C(    17425122),  INT32_C(  1465138537), -INT32_C(   508678288),  INT32_C(   324366915),  INT32_C(  1411380061),  INT32_C(   724368130), -INT32_C(   508678288) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(         162),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(34971),
+      { -INT32_C(   496471552), -INT32_C(  1364378587), -INT32_C(  1203300783), -INT32_C(  1203300783),  INT32_C(  1392448669),  INT32_C(   706763684), -INT32_C(   890007084),  INT32_C(   319667307),
+        -INT32_C(  1203300783), -INT32_C(  1364378587),  INT32_C(  1889596344), -INT32_C(  1504591654), -INT32_C(  1203300783),  INT32_C(  1392448669),  INT32_C(   319667307),  INT32_C(   582137590) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(58123),
+      {  INT32_C(   650641288),  INT32_C(   877719691), -INT32_C(   817080220), -INT32_C(   625200115),  INT32_C(  1328807700), -INT32_C(   444820396),  INT32_C(   877719691),  INT32_C(   725611957),
+         INT32_C(   650641288), -INT32_C(  1043578765),  INT32_C(   214424121), -INT32_C(  1043578765),  INT32_C(   639641024), -INT32_C(  1043578765),  INT32_C(   639641024),  INT32_C(   725611957) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(        2560),  INT32_C(        4096),  INT32_C(         128) } },
+    { UINT16_C(58911),
+      {  INT32_C(  1689953347), -INT32_C(  1153350519),  INT32_C(  1689953347),  INT32_C(  1689953347),  INT32_C(  1071037402),  INT32_C(  1071037402), -INT32_C(  1153350519), -INT32_C(  1946528365),
+        -INT32_C(  1946528365), -INT32_C(  1946528365),  INT32_C(  1689953347),  INT32_C(  1071037402), -INT32_C(  1946528365),  INT32_C(  1689953347),  INT32_C(  1689953347),  INT32_C(  1689953347) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           5),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(         384),  INT32_C(          13),  INT32_C(           0),  INT32_C(           0),  INT32_C(        1037),  INT32_C(        9229),  INT32_C(       25613) } },
+    { UINT16_C(65226),
+      { -INT32_C(   441218064),  INT32_C(  2123331779), -INT32_C(  1452934578), -INT32_C(   441218064),  INT32_C(  1799206717), -INT32_C(  1452934578), -INT32_C(  1944325577),  INT32_C(  2123331779),
+        -INT32_C(  1158708889), -INT32_C(  1158708889), -INT32_C(   209290386), -INT32_C(  1452934578), -INT32_C(   209290386), -INT32_C(  1348604619), -INT32_C(  1348604619),  INT32_C(  2123331779) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),
+         INT32_C(           0),  INT32_C(         256),  INT32_C(           0),  INT32_C(          36),  INT32_C(        1024),  INT32_C(           0),  INT32_C(        8192),  INT32_C(         130) } },
+    { UINT16_C(15038),
+      { -INT32_C(    86243342), -INT32_C(    86243342), -INT32_C(    86243342), -INT32_C(  1943846582), -INT32_C(   221394228), -INT32_C(  1250049810),  INT32_C(   587381904), -INT32_C(  1250049810),
+         INT32_C(   533983821),  INT32_C(   533983821),  INT32_C(  1204549535),  INT32_C(  1469216072),  INT32_C(   714929947), -INT32_C(   221394228),  INT32_C(   533983821),  INT32_C(  1204549535) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),
+         INT32_C(           0),  INT32_C(         256),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(60289),
+      {  INT32_C(  1993971500),  INT32_C(  1404644776), -INT32_C(  1261488208), -INT32_C(   972824965),  INT32_C(  1993971500), -INT32_C(   552818772),  INT32_C(   657233584),  INT32_C(   974329808),
+        -INT32_C(   972824965), -INT32_C(   972824965),  INT32_C(   657233584),  INT32_C(  1072659387),  INT32_C(   107948478),  INT32_C(  1072659387),  INT32_C(  1592532224),  INT32_C(  1993971500) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           8),  INT32_C(         264),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(        2048),  INT32_C(           0),  INT32_C(          17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_conflict_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 4764144783647360926),  INT64_C( 4764144783647360926),  INT64_C( 4764144783647360926), -INT64_C( 7590428788393826231),
+        -INT64_C( 7590428788393826231),  INT64_C( 4764144783647360926), -INT64_C( 7590428788393826231), -INT64_C( 7590428788393826231) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   0),
+         INT64_C(                   8),  INT64_C(                   7),  INT64_C(                  24),  INT64_C(                  88) } },
+    { { -INT64_C( 4865491594536474309),  INT64_C( 2967438994857147610),  INT64_C( 5622761581364708118), -INT64_C( 4865491594536474309),
+         INT64_C( 2967438994857147610), -INT64_C( 4865491594536474309),  INT64_C( 5622761581364708118),  INT64_C(  255204210867298998) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),
+         INT64_C(                   2),  INT64_C(                   9),  INT64_C(                   4),  INT64_C(                   0) } },
+    { { -INT64_C( 3880667634026003386), -INT64_C( 8963678909835891319),  INT64_C( 8555161711827612247), -INT64_C( 3449720269119068806),
+        -INT64_C( 3880667634026003386), -INT64_C( 3880667634026003386),  INT64_C( 8555161711827612247), -INT64_C( 3848550457901391183) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   1),  INT64_C(                  17),  INT64_C(                   4),  INT64_C(                   0) } },
+    { { -INT64_C( 8768622260435887208),  INT64_C(  664197875814229375),  INT64_C( 7659338550135872945),  INT64_C( 7805143939050145235),
+        -INT64_C( 9142605771605090892),  INT64_C( 7659338550135872945),  INT64_C( 7852825347516879892), -INT64_C( 4494010867184803112) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   4),  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C( 1457056988557617774),  INT64_C( 1457056988557617774),  INT64_C( 1457056988557617774),  INT64_C( 1457056988557617774),
+         INT64_C( 1457056988557617774),  INT64_C( 1457056988557617774),  INT64_C( 1457056988557617774),  INT64_C( 1457056988557617774) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   7),
+         INT64_C(                  15),  INT64_C(                  31),  INT64_C(                  63),  INT64_C(                 127) } },
+    { { -INT64_C( 2621719670646656430), -INT64_C( 6079287017264056160), -INT64_C( 8711233039042418613), -INT64_C( 2621719670646656430),
+        -INT64_C( 5088741172590752221), -INT64_C( 2621719670646656430), -INT64_C( 6079287017264056160), -INT64_C( 2621719670646656430) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),
+         INT64_C(                   0),  INT64_C(                   9),  INT64_C(                   2),  INT64_C(                  41) } },
+    { {  INT64_C( 7726690691865273303), -INT64_C( 2979649146288109172),  INT64_C( 5701467955460446429), -INT64_C( 2979649146288109172),
+         INT64_C( 5701467955460446429), -INT64_C( 4412273191402139905), -INT64_C( 4412273191402139905),  INT64_C( 5701467955460446429) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2),
+         INT64_C(                   4),  INT64_C(                   0),  INT64_C(                  32),  INT64_C(                  20) } },
+    { { -INT64_C( 7109096811556695669),  INT64_C( 3134965597768261795),  INT64_C(  382784230034937998), -INT64_C( 6620429419661181046),
+        -INT64_C( 6620429419661181046),  INT64_C( 5741193087010938282), -INT64_C(  525714556020579289), -INT64_C( 7109096811556695669) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   8),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_conflict_epi64(a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 7911398257386204523),  INT64_C( 6334802840297790291),  INT64_C( 2159932969319249470),  INT64_C( 8820952199870136837),
+        -INT64_C( 7151979668758746427), -INT64_C( 2958366229312944657), -INT64_C( 8918141313436890234), -INT64_C( 9064127148303318472) },
+      UINT8_C(  0),
+      {  INT64_C( 4689978431960414437),  INT64_C( 2443135554387887090),  INT64_C( 4689978431960414437),  INT64_C( 4689978431960414437),
+         INT64_C( 4689978431960414437),  INT64_C( 2443135554387887090),  INT64_C( 2443135554387887090),  INT64_C( 2443135554387887090) },
+      { -INT64_C( 7911398257386204523),  INT64_C( 6334802840297790291),  INT64_C( 2159932969319249470),  INT64_C( 8820952199870136837),
+        -INT64_C( 7151979668758746427), -INT64_C( 2958366229312944657), -INT64_C( 8918141313436890234), -INT64_C( 9064127148303318472) } },
+    { { -INT64_C( 5925758588053105399), -INT64_C( 5171663391123508201), -INT64_C( 3564542266055812795),  INT64_C( 1469369522920859499),
+         INT64_C(  773053301848440015),  INT64_C( 4974659745829065945), -INT64_C( 7097938843665990978), -INT64_C( 5483677501710761649) },
+      UINT8_C( 67),
+      { -INT64_C( 2040679913244132090),  INT64_C( 7606311333813529925),  INT64_C(  544043056402880886), -INT64_C( 2040679913244132090),
+        -INT64_C( 2040679913244132090), -INT64_C( 2040679913244132090),  INT64_C( 3074672589248481195),  INT64_C(  544043056402880886) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 3564542266055812795),  INT64_C( 1469369522920859499),
+         INT64_C(  773053301848440015),  INT64_C( 4974659745829065945),  INT64_C(                   0), -INT64_C( 5483677501710761649) } },
+    { {  INT64_C( 3121926316868399230),  INT64_C( 1057510983625862403),  INT64_C( 2467351250273996675), -INT64_C( 6322882111593328726),
+         INT64_C( 8175725286538011998),  INT64_C( 7410295713117396359), -INT64_C( 7602588287117996896),  INT64_C( 8712872036774020490) },
+      UINT8_C(244),
+      { -INT64_C(  938273313872585957), -INT64_C( 4756917565297220193),  INT64_C( 9152256709810346317), -INT64_C(  938273313872585957),
+        -INT64_C( 4756917565297220193), -INT64_C(  938273313872585957), -INT64_C(  938273313872585957),  INT64_C( 7498998552021981700) },
+      {  INT64_C( 3121926316868399230),  INT64_C( 1057510983625862403),  INT64_C(                   0), -INT64_C( 6322882111593328726),
+         INT64_C(                   2),  INT64_C(                   9),  INT64_C(                  41),  INT64_C(                   0) } },
+    { {  INT64_C( 6326915217559186100), -INT64_C( 6650539216821822493), -INT64_C( 8424285769975000225),  INT64_C( 3921122476307984201),
+        -INT64_C( 5088170428370021215), -INT64_C( 4868254601670764221), -INT64_C( 1582490172181981915),  INT64_C( 3894013641990627104) },
+      UINT8_C(122),
+      { -INT64_C( 1799034748908248553),  INT64_C( 4031447595483292986),  INT64_C( 5137707262270455082),  INT64_C( 5137707262270455082),
+        -INT64_C( 6500545184015846398), -INT64_C( 8402688104148348041),  INT64_C( 2544001342642124928),  INT64_C( 5137707262270455082) },
+      {  INT64_C( 6326915217559186100),  INT64_C(                   0), -INT64_C( 8424285769975000225),  INT64_C(                   4),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3894013641990627104) } },
+    { { -INT64_C( 2294721630024847689), -INT64_C( 2694816033317755070),  INT64_C( 5598785019261159982), -INT64_C( 5654349670372302157),
+        -INT64_C( 3861910609637359222),  INT64_C( 7620699200357639198),  INT64_C( 6780139552151063689), -INT64_C( 6673253617583739396) },
+      UINT8_C(244),
+      { -INT64_C(  477741508822350991),  INT64_C(  565254372815170563), -INT64_C(  477741508822350991),  INT64_C(  565254372815170563),
+        -INT64_C(  477741508822350991),  INT64_C(  565254372815170563),  INT64_C(  565254372815170563), -INT64_C(  477741508822350991) },
+      { -INT64_C( 2294721630024847689), -INT64_C( 2694816033317755070),  INT64_C(                   1), -INT64_C( 5654349670372302157),
+         INT64_C(                   5),  INT64_C(                  10),  INT64_C(                  42),  INT64_C(                  21) } },
+    { {  INT64_C( 6085680016208478255), -INT64_C( 8034466514776079760), -INT64_C( 4772776215620488635),  INT64_C( 8234251537392026268),
+         INT64_C( 1412641255044113403),  INT64_C( 7070830169746163239), -INT64_C( 5860718618470551956),  INT64_C( 5421738992545608316) },
+      UINT8_C(130),
+      {  INT64_C( 4245584849110822700),  INT64_C( 4245584849110822700),  INT64_C( 4245584849110822700), -INT64_C( 6181098509942814798),
+        -INT64_C( 5691618471279432710), -INT64_C( 6181098509942814798),  INT64_C( 4245584849110822700), -INT64_C( 5691618471279432710) },
+      {  INT64_C( 6085680016208478255),  INT64_C(                   1), -INT64_C( 4772776215620488635),  INT64_C( 8234251537392026268),
+         INT64_C( 1412641255044113403),  INT64_C( 7070830169746163239), -INT64_C( 5860718618470551956),  INT64_C(                  16) } },
+    { { -INT64_C( 3980469206910443945),  INT64_C( 3220576715948974578), -INT64_C( 1392531819224764941),  INT64_C( 2853762481884007441),
+        -INT64_C(  822902715963594177), -INT64_C( 1693756914184877247), -INT64_C( 6615774896917644888),  INT64_C( 8503776286464341934) },
+      UINT8_C(254),
+      { -INT64_C( 5799398522046909124), -INT64_C( 6894306634125730872),  INT64_C( 7693295697189739753), -INT64_C( 5799398522046909124),
+        -INT64_C( 5836778343565045416),  INT64_C( 4887479062983915831), -INT64_C( 5836778343565045416),  INT64_C( 5884135249563982595) },
+      { -INT64_C( 3980469206910443945),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  16),  INT64_C(                   0) } },
+    { { -INT64_C( 4493525716891112523), -INT64_C( 3275717193152788829), -INT64_C( 6896289338932445481),  INT64_C( 4601040820889096138),
+        -INT64_C( 1995115179816858595),  INT64_C( 9201848195654917185),  INT64_C( 3052726110595063656),  INT64_C( 5917074389262938577) },
+      UINT8_C(162),
+      {  INT64_C( 3499376274189316057), -INT64_C( 3950639902852783903),  INT64_C( 2074593365308262591),  INT64_C( 3490977535523214352),
+         INT64_C( 3499376274189316057),  INT64_C( 3499376274189316057),  INT64_C( 2074593365308262591), -INT64_C( 6736775852586758055) },
+      { -INT64_C( 4493525716891112523),  INT64_C(                   0), -INT64_C( 6896289338932445481),  INT64_C( 4601040820889096138),
+        -INT64_C( 1995115179816858595),  INT64_C(                  17),  INT64_C( 3052726110595063656),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_conflict_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(190),
+      {  INT64_C(  627330432450708375),  INT64_C(  627330432450708375), -INT64_C( 3455936771785424532), -INT64_C( 3455936771785424532),
+        -INT64_C( 3455936771785424532), -INT64_C( 3455936771785424532), -INT64_C( 3455936771785424532), -INT64_C( 3455936771785424532) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   4),
+         INT64_C(                  12),  INT64_C(                  28),  INT64_C(                   0),  INT64_C(                 124) } },
+    { UINT8_C( 89),
+      { -INT64_C( 6643587567054633855),  INT64_C( 9181846464294637274),  INT64_C( 5003299074538508072),  INT64_C( 9181846464294637274),
+        -INT64_C( 5778364362173999045),  INT64_C( 9181846464294637274),  INT64_C( 9181846464294637274), -INT64_C( 6643587567054633855) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  42),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      {  INT64_C( 4823286991706485133), -INT64_C( 5311922000309294191), -INT64_C( 7085368436455957199), -INT64_C( 5311922000309294191),
+         INT64_C( 4823286991706485133),  INT64_C( 7952903007363112373),  INT64_C( 7952903007363112373), -INT64_C( 9204058232783679024) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(198),
+      { -INT64_C( 4481775739791772803), -INT64_C( 4991469309855391351), -INT64_C( 4481775739791772803), -INT64_C( 4481775739791772803),
+        -INT64_C( 4481775739791772803), -INT64_C( 4481775739791772803), -INT64_C( 4481775739791772803), -INT64_C( 4481775739791772803) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  61),  INT64_C(                 125) } },
+    { UINT8_C( 71),
+      {  INT64_C( 8639833625315522980),  INT64_C( 8639833625315522980),  INT64_C( 8639833625315522980),  INT64_C( 8639833625315522980),
+         INT64_C( 8639833625315522980),  INT64_C( 8639833625315522980), -INT64_C( 3076745314927820772),  INT64_C( 8639833625315522980) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 34),
+      {  INT64_C( 1352880943109768492), -INT64_C( 2861509025325537958),  INT64_C( 1352880943109768492),  INT64_C( 1352880943109768492),
+        -INT64_C( 8194625067767235039),  INT64_C( 1352880943109768492), -INT64_C( 8194625067767235039),  INT64_C( 1352880943109768492) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                  13),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 16),
+      { -INT64_C( 3107295675929663595), -INT64_C( 1928334667221093428), -INT64_C( 8367657468880523906), -INT64_C( 8367657468880523906),
+         INT64_C( 8185846224590974880), -INT64_C(   58824415042267819),  INT64_C( 8185846224590974880), -INT64_C( 8344874424787868377) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(206),
+      { -INT64_C( 4135184378360676029), -INT64_C(  493842840494623543), -INT64_C( 4135184378360676029),  INT64_C( 7936171013687267847),
+         INT64_C( 4641671095157515955),  INT64_C( 4245628633769399141),  INT64_C( 4641671095157515955),  INT64_C( 7936171013687267847) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  16),  INT64_C(                   8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_conflict_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_conflict_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -691,11 +691,495 @@ test_simde_mm512_cvtepi8_epi16(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_cvtph_ps(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[16];
+    simde_float32 r[16];
+  } test_vec[] = {
+    { { UINT16_C(46065), UINT16_C(46334), UINT16_C(47325), UINT16_C(48936), UINT16_C(41319), UINT16_C(33777), UINT16_C(12319), UINT16_C(33544),
+        UINT16_C(54041), UINT16_C(41674), UINT16_C(37978), UINT16_C(45501), UINT16_C(    1), UINT16_C(32768), UINT16_C(50779), UINT16_C(47840) },
+      {   SIMDE_FLOAT32_C(-0.248168945),   SIMDE_FLOAT32_C(-0.312011719),   SIMDE_FLOAT32_C(-0.607910156),    SIMDE_FLOAT32_C(-1.78906250),
+         SIMDE_FLOAT32_C(-0.0105514526), SIMDE_FLOAT32_C(-6.01410866e-05),    SIMDE_FLOAT32_C(0.128784180), SIMDE_FLOAT32_C(-4.62532043e-05),
+           SIMDE_FLOAT32_C(-56.7812500),  SIMDE_FLOAT32_C(-0.0132598877), SIMDE_FLOAT32_C(-0.00106239319),   SIMDE_FLOAT32_C(-0.179321289),
+        SIMDE_FLOAT32_C(5.96046448e-08),    SIMDE_FLOAT32_C(-0.00000000),    SIMDE_FLOAT32_C(-6.35546875),   SIMDE_FLOAT32_C(-0.859375000) } },
+    { { UINT16_C(35341), UINT16_C(32256), UINT16_C(31744), UINT16_C(45196), UINT16_C(16625), UINT16_C(64511), UINT16_C(   62), UINT16_C(16016),
+        UINT16_C( 9919), UINT16_C(12331), UINT16_C(64512), UINT16_C(14859), UINT16_C(16427), UINT16_C(12407), UINT16_C(37839), UINT16_C(   45) },
+      { SIMDE_FLOAT32_C(-0.000184655190),                 SIMDE_MATH_NANF,            SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.142089844),
+            SIMDE_FLOAT32_C(2.47070312),    SIMDE_FLOAT32_C(-65504.0000), SIMDE_FLOAT32_C(3.69548798e-06),     SIMDE_FLOAT32_C(1.64062500),
+          SIMDE_FLOAT32_C(0.0263519287),    SIMDE_FLOAT32_C(0.130249023),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(0.755371094),
+            SIMDE_FLOAT32_C(2.08398438),    SIMDE_FLOAT32_C(0.139526367), SIMDE_FLOAT32_C(-0.000953197479), SIMDE_FLOAT32_C(2.68220901e-06) } },
+    { { UINT16_C(18260), UINT16_C(61839), UINT16_C(32256), UINT16_C(  370), UINT16_C(16174), UINT16_C(13205), UINT16_C(42495), UINT16_C(23585),
+        UINT16_C(  191), UINT16_C( 7881), UINT16_C(50266), UINT16_C(17101), UINT16_C(15652), UINT16_C(16443), UINT16_C(32768), UINT16_C(31743) },
+      {     SIMDE_FLOAT32_C(7.32812500),    SIMDE_FLOAT32_C(-11384.0000),                 SIMDE_MATH_NANF, SIMDE_FLOAT32_C(2.20537186e-05),
+            SIMDE_FLOAT32_C(1.79492188),    SIMDE_FLOAT32_C(0.236938477),  SIMDE_FLOAT32_C(-0.0234222412),     SIMDE_FLOAT32_C(264.250000),
+        SIMDE_FLOAT32_C(1.13844872e-05),  SIMDE_FLOAT32_C(0.00662612915),    SIMDE_FLOAT32_C(-4.35156250),     SIMDE_FLOAT32_C(3.40039062),
+            SIMDE_FLOAT32_C(1.28515625),     SIMDE_FLOAT32_C(2.11523438),    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(65504.0000) } },
+    { { UINT16_C(12879), UINT16_C(19682), UINT16_C(12800), UINT16_C(47947), UINT16_C(25442), UINT16_C(33791), UINT16_C(17527), UINT16_C(33708),
+        UINT16_C(16051), UINT16_C(22425), UINT16_C(45546), UINT16_C(16942), UINT16_C(32256), UINT16_C(  760), UINT16_C(12411), UINT16_C(16013) },
+      {    SIMDE_FLOAT32_C(0.197143555),     SIMDE_FLOAT32_C(19.5312500),    SIMDE_FLOAT32_C(0.187500000),   SIMDE_FLOAT32_C(-0.911621094),
+            SIMDE_FLOAT32_C(945.000000), SIMDE_FLOAT32_C(-6.09755516e-05),     SIMDE_FLOAT32_C(4.46484375), SIMDE_FLOAT32_C(-5.60283661e-05),
+            SIMDE_FLOAT32_C(1.67480469),     SIMDE_FLOAT32_C(121.562500),   SIMDE_FLOAT32_C(-0.184814453),     SIMDE_FLOAT32_C(3.08984375),
+                        SIMDE_MATH_NANF, SIMDE_FLOAT32_C(4.52995300e-05),    SIMDE_FLOAT32_C(0.140014648),     SIMDE_FLOAT32_C(1.63769531) } },
+    { { UINT16_C(    0), UINT16_C(26967), UINT16_C(13057), UINT16_C(33352), UINT16_C( 1024), UINT16_C(13320), UINT16_C(20833), UINT16_C(44678),
+        UINT16_C(31743), UINT16_C(15369), UINT16_C(45532), UINT16_C(47840), UINT16_C( 8103), UINT16_C(14679), UINT16_C(32256), UINT16_C(   81) },
+      {     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(2734.00000),    SIMDE_FLOAT32_C(0.218872070), SIMDE_FLOAT32_C(-3.48091125e-05),
+        SIMDE_FLOAT32_C(6.10351562e-05),    SIMDE_FLOAT32_C(0.251953125),     SIMDE_FLOAT32_C(43.0312500),   SIMDE_FLOAT32_C(-0.101928711),
+            SIMDE_FLOAT32_C(65504.0000),     SIMDE_FLOAT32_C(1.00878906),   SIMDE_FLOAT32_C(-0.183105469),   SIMDE_FLOAT32_C(-0.859375000),
+         SIMDE_FLOAT32_C(0.00747299194),    SIMDE_FLOAT32_C(0.667480469),                 SIMDE_MATH_NANF, SIMDE_FLOAT32_C(4.82797623e-06) } },
+    { { UINT16_C( 2697), UINT16_C(15360), UINT16_C(46526), UINT16_C(56351), UINT16_C(13626), UINT16_C(49288), UINT16_C(  300), UINT16_C(51109),
+        UINT16_C(19290), UINT16_C(23930), UINT16_C(  719), UINT16_C(    0), UINT16_C(    1), UINT16_C(14898), UINT16_C( 3394), UINT16_C(33075) },
+      { SIMDE_FLOAT32_C(0.000199437141),     SIMDE_FLOAT32_C(1.00000000),   SIMDE_FLOAT32_C(-0.358886719),    SIMDE_FLOAT32_C(-263.750000),
+           SIMDE_FLOAT32_C(0.326660156),    SIMDE_FLOAT32_C(-2.26562500), SIMDE_FLOAT32_C(1.78813934e-05),    SIMDE_FLOAT32_C(-7.64453125),
+            SIMDE_FLOAT32_C(14.7031250),     SIMDE_FLOAT32_C(350.500000), SIMDE_FLOAT32_C(4.28557396e-05),     SIMDE_FLOAT32_C(0.00000000),
+        SIMDE_FLOAT32_C(5.96046448e-08),    SIMDE_FLOAT32_C(0.774414062), SIMDE_FLOAT32_C(0.000320911407), SIMDE_FLOAT32_C(-1.82986259e-05) } },
+    { { UINT16_C(16034), UINT16_C(13531), UINT16_C(64511), UINT16_C(53490), UINT16_C(    1), UINT16_C(14186), UINT16_C( 5358), UINT16_C(46813),
+        UINT16_C(49613), UINT16_C(    0), UINT16_C(33384), UINT16_C(48836), UINT16_C(52070), UINT16_C(17004), UINT16_C(50393), UINT16_C(12878) },
+      {     SIMDE_FLOAT32_C(1.65820312),    SIMDE_FLOAT32_C(0.303466797),    SIMDE_FLOAT32_C(-65504.0000),    SIMDE_FLOAT32_C(-39.5625000),
+        SIMDE_FLOAT32_C(5.96046448e-08),    SIMDE_FLOAT32_C(0.463378906),  SIMDE_FLOAT32_C(0.00120353699),   SIMDE_FLOAT32_C(-0.428955078),
+           SIMDE_FLOAT32_C(-2.90039062),     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-3.67164612e-05),    SIMDE_FLOAT32_C(-1.69140625),
+           SIMDE_FLOAT32_C(-14.7968750),     SIMDE_FLOAT32_C(3.21093750),    SIMDE_FLOAT32_C(-4.84765625),    SIMDE_FLOAT32_C(0.197021484) } },
+    { { UINT16_C(39635), UINT16_C(17911), UINT16_C( 7862), UINT16_C(47117), UINT16_C(33710), UINT16_C(46510), UINT16_C(12923), UINT16_C(15067),
+        UINT16_C(46519), UINT16_C(49633), UINT16_C(49152), UINT16_C(61645), UINT16_C(36692), UINT16_C(32256), UINT16_C(52998), UINT16_C(17977) },
+      { SIMDE_FLOAT32_C(-0.00333213806),     SIMDE_FLOAT32_C(5.96484375),  SIMDE_FLOAT32_C(0.00655364990),   SIMDE_FLOAT32_C(-0.506347656),
+        SIMDE_FLOAT32_C(-5.61475754e-05),   SIMDE_FLOAT32_C(-0.354980469),    SIMDE_FLOAT32_C(0.202514648),    SIMDE_FLOAT32_C(0.856933594),
+          SIMDE_FLOAT32_C(-0.357177734),    SIMDE_FLOAT32_C(-2.93945312),    SIMDE_FLOAT32_C(-2.00000000),    SIMDE_FLOAT32_C(-9832.00000),
+        SIMDE_FLOAT32_C(-0.000447273254),                 SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(-28.0937500),     SIMDE_FLOAT32_C(6.22265625) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m512 r = simde_mm512_cvtph_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_cvtph_ps(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 src[16];
+    simde__mmask16 k;
+    uint16_t a[16];
+    simde_float32 r[16];
+  } test_vec[] = {
+    { {    SIMDE_FLOAT32_C(-110.000000),     SIMDE_FLOAT32_C(243.250000),     SIMDE_FLOAT32_C(75.5000000),     SIMDE_FLOAT32_C(142.750000),
+           SIMDE_FLOAT32_C(-201.250000),     SIMDE_FLOAT32_C(112.250000),     SIMDE_FLOAT32_C(79.0000000),    SIMDE_FLOAT32_C(-134.250000),
+            SIMDE_FLOAT32_C(89.7500000),     SIMDE_FLOAT32_C(73.0000000),    SIMDE_FLOAT32_C(-242.250000),    SIMDE_FLOAT32_C(-51.0000000),
+           SIMDE_FLOAT32_C(-172.250000),    SIMDE_FLOAT32_C(-201.750000),    SIMDE_FLOAT32_C(-210.500000),     SIMDE_FLOAT32_C(170.250000) },
+      UINT16_C(37534),
+      { UINT16_C(31743), UINT16_C(50745), UINT16_C(47815), UINT16_C(  595), UINT16_C(15722), UINT16_C(    0), UINT16_C(50128), UINT16_C(13236),
+        UINT16_C(20628), UINT16_C(31033), UINT16_C( 2755), UINT16_C(15347), UINT16_C(33430), UINT16_C(50224), UINT16_C(46595), UINT16_C(50943) },
+      {    SIMDE_FLOAT32_C(-110.000000),    SIMDE_FLOAT32_C(-6.22265625),   SIMDE_FLOAT32_C(-0.847167969), SIMDE_FLOAT32_C(3.54647636e-05),
+            SIMDE_FLOAT32_C(1.35351562),     SIMDE_FLOAT32_C(112.250000),     SIMDE_FLOAT32_C(79.0000000),    SIMDE_FLOAT32_C(0.240722656),
+            SIMDE_FLOAT32_C(89.7500000),     SIMDE_FLOAT32_C(42784.0000),    SIMDE_FLOAT32_C(-242.250000),    SIMDE_FLOAT32_C(-51.0000000),
+        SIMDE_FLOAT32_C(-3.94582748e-05),    SIMDE_FLOAT32_C(-201.750000),    SIMDE_FLOAT32_C(-210.500000),    SIMDE_FLOAT32_C(-6.99609375) } },
+    { {    SIMDE_FLOAT32_C(-237.750000),     SIMDE_FLOAT32_C(124.000000),     SIMDE_FLOAT32_C(8.75000000),     SIMDE_FLOAT32_C(133.750000),
+            SIMDE_FLOAT32_C(81.7500000),     SIMDE_FLOAT32_C(239.750000),     SIMDE_FLOAT32_C(159.000000),     SIMDE_FLOAT32_C(197.000000),
+            SIMDE_FLOAT32_C(208.250000),     SIMDE_FLOAT32_C(122.750000),    SIMDE_FLOAT32_C(-204.500000),    SIMDE_FLOAT32_C(-220.250000),
+            SIMDE_FLOAT32_C(54.2500000),    SIMDE_FLOAT32_C(-70.2500000),     SIMDE_FLOAT32_C(236.500000),     SIMDE_FLOAT32_C(207.500000) },
+      UINT16_C(49104),
+      { UINT16_C(13639), UINT16_C(14962), UINT16_C(13794), UINT16_C(17471), UINT16_C(59374), UINT16_C(46287), UINT16_C(31743), UINT16_C(15367),
+        UINT16_C(12707), UINT16_C(11898), UINT16_C(64511), UINT16_C( 1573), UINT16_C( 5119), UINT16_C(18224), UINT16_C(48928), UINT16_C(13629) },
+      {    SIMDE_FLOAT32_C(-237.750000),     SIMDE_FLOAT32_C(124.000000),     SIMDE_FLOAT32_C(8.75000000),     SIMDE_FLOAT32_C(133.750000),
+           SIMDE_FLOAT32_C(-2030.00000),     SIMDE_FLOAT32_C(239.750000),     SIMDE_FLOAT32_C(65504.0000),     SIMDE_FLOAT32_C(1.00683594),
+           SIMDE_FLOAT32_C(0.176147461),    SIMDE_FLOAT32_C(0.101196289),    SIMDE_FLOAT32_C(-65504.0000), SIMDE_FLOAT32_C(9.37581062e-05),
+        SIMDE_FLOAT32_C(0.000976085663),     SIMDE_FLOAT32_C(7.18750000),     SIMDE_FLOAT32_C(236.500000),    SIMDE_FLOAT32_C(0.327392578) } },
+    { {     SIMDE_FLOAT32_C(51.5000000),    SIMDE_FLOAT32_C(-189.000000),     SIMDE_FLOAT32_C(51.7500000),     SIMDE_FLOAT32_C(228.750000),
+            SIMDE_FLOAT32_C(5.25000000),     SIMDE_FLOAT32_C(160.500000),    SIMDE_FLOAT32_C(-221.750000),     SIMDE_FLOAT32_C(198.250000),
+           SIMDE_FLOAT32_C(-185.750000),    SIMDE_FLOAT32_C(-99.0000000),    SIMDE_FLOAT32_C(-13.0000000),    SIMDE_FLOAT32_C(-181.000000),
+            SIMDE_FLOAT32_C(151.000000),    SIMDE_FLOAT32_C(-198.500000),     SIMDE_FLOAT32_C(82.0000000),    SIMDE_FLOAT32_C(-91.7500000) },
+      UINT16_C(52115),
+      { UINT16_C(    1), UINT16_C(64030), UINT16_C(46693), UINT16_C(33263), UINT16_C(13411), UINT16_C(58365), UINT16_C(10543), UINT16_C(  543),
+        UINT16_C(16249), UINT16_C(10425), UINT16_C(    0), UINT16_C(46559), UINT16_C(46872), UINT16_C(47613), UINT16_C(13604), UINT16_C(18061) },
+      { SIMDE_FLOAT32_C(5.96046448e-08),    SIMDE_FLOAT32_C(-50112.0000),     SIMDE_FLOAT32_C(51.7500000),     SIMDE_FLOAT32_C(228.750000),
+           SIMDE_FLOAT32_C(0.274169922),     SIMDE_FLOAT32_C(160.500000),    SIMDE_FLOAT32_C(-221.750000), SIMDE_FLOAT32_C(3.23653221e-05),
+            SIMDE_FLOAT32_C(1.86816406),   SIMDE_FLOAT32_C(0.0368957520),    SIMDE_FLOAT32_C(-13.0000000),   SIMDE_FLOAT32_C(-0.366943359),
+            SIMDE_FLOAT32_C(151.000000),    SIMDE_FLOAT32_C(-198.500000),    SIMDE_FLOAT32_C(0.321289062),     SIMDE_FLOAT32_C(6.55078125) } },
+    { {    SIMDE_FLOAT32_C(-121.000000),     SIMDE_FLOAT32_C(51.7500000),     SIMDE_FLOAT32_C(24.7500000),    SIMDE_FLOAT32_C(-209.000000),
+           SIMDE_FLOAT32_C(-187.250000),    SIMDE_FLOAT32_C(-125.250000),    SIMDE_FLOAT32_C(-93.2500000),     SIMDE_FLOAT32_C(230.250000),
+            SIMDE_FLOAT32_C(74.2500000),     SIMDE_FLOAT32_C(6.50000000),    SIMDE_FLOAT32_C(-140.500000),     SIMDE_FLOAT32_C(78.7500000),
+           SIMDE_FLOAT32_C(-217.250000),    SIMDE_FLOAT32_C(-212.500000),    SIMDE_FLOAT32_C(-80.7500000),     SIMDE_FLOAT32_C(64.5000000) },
+      UINT16_C(60025),
+      { UINT16_C(47558), UINT16_C(33791), UINT16_C(17022), UINT16_C(56131), UINT16_C(32957), UINT16_C(   70), UINT16_C(33146), UINT16_C( 7286),
+        UINT16_C(50100), UINT16_C( 5075), UINT16_C(31743), UINT16_C(48490), UINT16_C(14508), UINT16_C(  753), UINT16_C(26423), UINT16_C(33778) },
+      {   SIMDE_FLOAT32_C(-0.721679688),     SIMDE_FLOAT32_C(51.7500000),     SIMDE_FLOAT32_C(24.7500000),    SIMDE_FLOAT32_C(-232.375000),
+        SIMDE_FLOAT32_C(-1.12652779e-05), SIMDE_FLOAT32_C(4.17232513e-06), SIMDE_FLOAT32_C(-2.25305557e-05),     SIMDE_FLOAT32_C(230.250000),
+            SIMDE_FLOAT32_C(74.2500000), SIMDE_FLOAT32_C(0.000955104828),    SIMDE_FLOAT32_C(-140.500000),    SIMDE_FLOAT32_C(-1.35351562),
+           SIMDE_FLOAT32_C(-217.250000), SIMDE_FLOAT32_C(4.48822975e-05),     SIMDE_FLOAT32_C(1847.00000), SIMDE_FLOAT32_C(-6.02006912e-05) } },
+    { {    SIMDE_FLOAT32_C(-77.5000000),    SIMDE_FLOAT32_C(-147.500000),     SIMDE_FLOAT32_C(223.000000),     SIMDE_FLOAT32_C(181.250000),
+           SIMDE_FLOAT32_C(-8.50000000),    SIMDE_FLOAT32_C(-91.2500000),     SIMDE_FLOAT32_C(110.000000),    SIMDE_FLOAT32_C(-41.5000000),
+            SIMDE_FLOAT32_C(82.7500000),     SIMDE_FLOAT32_C(139.750000),    SIMDE_FLOAT32_C(-196.250000),    SIMDE_FLOAT32_C(-19.7500000),
+           SIMDE_FLOAT32_C(-2.25000000),    SIMDE_FLOAT32_C(-80.2500000),     SIMDE_FLOAT32_C(110.750000),    SIMDE_FLOAT32_C(-102.000000) },
+      UINT16_C(56607),
+      { UINT16_C(48288), UINT16_C(20530), UINT16_C(45213), UINT16_C(    1), UINT16_C(49639), UINT16_C(45249), UINT16_C(18121), UINT16_C(62927),
+        UINT16_C(46052), UINT16_C(59745), UINT16_C(47465), UINT16_C(56694), UINT16_C(14948), UINT16_C(46093), UINT16_C(32768), UINT16_C(64512) },
+      {    SIMDE_FLOAT32_C(-1.15625000),     SIMDE_FLOAT32_C(33.5625000),   SIMDE_FLOAT32_C(-0.144165039), SIMDE_FLOAT32_C(5.96046448e-08),
+           SIMDE_FLOAT32_C(-2.95117188),    SIMDE_FLOAT32_C(-91.2500000),     SIMDE_FLOAT32_C(110.000000),    SIMDE_FLOAT32_C(-41.5000000),
+          SIMDE_FLOAT32_C(-0.246582031),     SIMDE_FLOAT32_C(139.750000),   SIMDE_FLOAT32_C(-0.676269531),    SIMDE_FLOAT32_C(-349.500000),
+           SIMDE_FLOAT32_C(0.798828125),    SIMDE_FLOAT32_C(-80.2500000),    SIMDE_FLOAT32_C(-0.00000000),           -SIMDE_MATH_INFINITYF } },
+    { {     SIMDE_FLOAT32_C(24.0000000),     SIMDE_FLOAT32_C(107.750000),    SIMDE_FLOAT32_C(-236.500000),     SIMDE_FLOAT32_C(90.5000000),
+           SIMDE_FLOAT32_C(-1.00000000),     SIMDE_FLOAT32_C(218.250000),    SIMDE_FLOAT32_C(-42.7500000),     SIMDE_FLOAT32_C(12.7500000),
+            SIMDE_FLOAT32_C(201.750000),     SIMDE_FLOAT32_C(3.75000000),     SIMDE_FLOAT32_C(56.2500000),    SIMDE_FLOAT32_C(-191.750000),
+           SIMDE_FLOAT32_C(-83.7500000),     SIMDE_FLOAT32_C(157.500000),     SIMDE_FLOAT32_C(157.500000),    SIMDE_FLOAT32_C(-200.500000) },
+      UINT16_C(30649),
+      { UINT16_C(12858), UINT16_C(49152), UINT16_C(33198), UINT16_C(32256), UINT16_C(12590), UINT16_C( 1024), UINT16_C(16654), UINT16_C(48794),
+        UINT16_C(13653), UINT16_C(12798), UINT16_C(  568), UINT16_C(12641), UINT16_C(46818), UINT16_C(46761), UINT16_C(13107), UINT16_C(39561) },
+      {    SIMDE_FLOAT32_C(0.194580078),     SIMDE_FLOAT32_C(107.750000),    SIMDE_FLOAT32_C(-236.500000),                 SIMDE_MATH_NANF,
+           SIMDE_FLOAT32_C(0.161865234), SIMDE_FLOAT32_C(6.10351562e-05),    SIMDE_FLOAT32_C(-42.7500000),    SIMDE_FLOAT32_C(-1.65039062),
+           SIMDE_FLOAT32_C(0.333251953),    SIMDE_FLOAT32_C(0.187255859), SIMDE_FLOAT32_C(3.38554382e-05),    SIMDE_FLOAT32_C(-191.750000),
+          SIMDE_FLOAT32_C(-0.430175781),   SIMDE_FLOAT32_C(-0.416259766),    SIMDE_FLOAT32_C(0.224975586),    SIMDE_FLOAT32_C(-200.500000) } },
+    { {    SIMDE_FLOAT32_C(-150.000000),     SIMDE_FLOAT32_C(241.250000),     SIMDE_FLOAT32_C(153.750000),    SIMDE_FLOAT32_C(-193.000000),
+           SIMDE_FLOAT32_C(-139.000000),    SIMDE_FLOAT32_C(-101.750000),     SIMDE_FLOAT32_C(188.500000),     SIMDE_FLOAT32_C(163.500000),
+            SIMDE_FLOAT32_C(188.000000),     SIMDE_FLOAT32_C(41.2500000),    SIMDE_FLOAT32_C(-173.250000),     SIMDE_FLOAT32_C(75.0000000),
+            SIMDE_FLOAT32_C(103.000000),     SIMDE_FLOAT32_C(65.7500000),     SIMDE_FLOAT32_C(26.5000000),    SIMDE_FLOAT32_C(-65.0000000) },
+      UINT16_C( 7619),
+      { UINT16_C(31744), UINT16_C(20743), UINT16_C(    0), UINT16_C(64204), UINT16_C(47922), UINT16_C(15046), UINT16_C(33791), UINT16_C(50084),
+        UINT16_C(62625), UINT16_C(47668), UINT16_C(46457), UINT16_C(46896), UINT16_C(48686), UINT16_C(50453), UINT16_C(47804), UINT16_C(33305) },
+      {            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(40.2187500),     SIMDE_FLOAT32_C(153.750000),    SIMDE_FLOAT32_C(-193.000000),
+           SIMDE_FLOAT32_C(-139.000000),    SIMDE_FLOAT32_C(-101.750000), SIMDE_FLOAT32_C(-6.09755516e-05),    SIMDE_FLOAT32_C(-3.82031250),
+           SIMDE_FLOAT32_C(-18960.0000),     SIMDE_FLOAT32_C(41.2500000),   SIMDE_FLOAT32_C(-0.342041016),   SIMDE_FLOAT32_C(-0.449218750),
+           SIMDE_FLOAT32_C(-1.54492188),     SIMDE_FLOAT32_C(65.7500000),     SIMDE_FLOAT32_C(26.5000000),    SIMDE_FLOAT32_C(-65.0000000) } },
+    { {     SIMDE_FLOAT32_C(184.250000),    SIMDE_FLOAT32_C(-61.7500000),    SIMDE_FLOAT32_C(-9.00000000),     SIMDE_FLOAT32_C(52.0000000),
+           SIMDE_FLOAT32_C(-174.500000),     SIMDE_FLOAT32_C(135.000000),     SIMDE_FLOAT32_C(176.500000),     SIMDE_FLOAT32_C(11.2500000),
+           SIMDE_FLOAT32_C(-222.500000),     SIMDE_FLOAT32_C(71.2500000),    SIMDE_FLOAT32_C(-14.2500000),    SIMDE_FLOAT32_C(-214.500000),
+            SIMDE_FLOAT32_C(238.250000),    SIMDE_FLOAT32_C(-246.500000),     SIMDE_FLOAT32_C(26.5000000),     SIMDE_FLOAT32_C(161.250000) },
+      UINT16_C(24081),
+      { UINT16_C(13653), UINT16_C(17422), UINT16_C(45841), UINT16_C(16197), UINT16_C(50182), UINT16_C(13293), UINT16_C( 5571), UINT16_C(   61),
+        UINT16_C(47504), UINT16_C(14652), UINT16_C(11604), UINT16_C(42117), UINT16_C(16729), UINT16_C(17192), UINT16_C(49436), UINT16_C(10391) },
+      {    SIMDE_FLOAT32_C(0.333251953),    SIMDE_FLOAT32_C(-61.7500000),    SIMDE_FLOAT32_C(-9.00000000),     SIMDE_FLOAT32_C(52.0000000),
+           SIMDE_FLOAT32_C(-4.02343750),     SIMDE_FLOAT32_C(135.000000),     SIMDE_FLOAT32_C(176.500000),     SIMDE_FLOAT32_C(11.2500000),
+           SIMDE_FLOAT32_C(-222.500000),    SIMDE_FLOAT32_C(0.654296875),   SIMDE_FLOAT32_C(0.0832519531),  SIMDE_FLOAT32_C(-0.0176544189),
+            SIMDE_FLOAT32_C(2.67382812),    SIMDE_FLOAT32_C(-246.500000),    SIMDE_FLOAT32_C(-2.55468750),     SIMDE_FLOAT32_C(161.250000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_cvtph_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_cvtph_ps(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde__mmask16 k;
+    uint16_t a[16];
+    simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(13107),
+      { UINT16_C(17294), UINT16_C(64511), UINT16_C(14833), UINT16_C(50116), UINT16_C( 5102), UINT16_C(33791), UINT16_C(31743), UINT16_C(53659),
+        UINT16_C(42811), UINT16_C(18746), UINT16_C(18329), UINT16_C(32830), UINT16_C(12691), UINT16_C(49101), UINT16_C(46774), UINT16_C(56481) },
+      {     SIMDE_FLOAT32_C(3.77734375),    SIMDE_FLOAT32_C(-65504.0000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+        SIMDE_FLOAT32_C(0.000967979431), SIMDE_FLOAT32_C(-6.09755516e-05),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+         SIMDE_FLOAT32_C(-0.0282440186),     SIMDE_FLOAT32_C(10.4531250),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+           SIMDE_FLOAT32_C(0.174194336),    SIMDE_FLOAT32_C(-1.95019531),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000) } },
+    { UINT16_C(45555),
+      { UINT16_C(33546), UINT16_C(13928), UINT16_C(54097), UINT16_C(12347), UINT16_C(33791), UINT16_C(47059), UINT16_C(13701), UINT16_C( 2152),
+        UINT16_C(50344), UINT16_C(14935), UINT16_C(50254), UINT16_C(33405), UINT16_C(  342), UINT16_C(18237), UINT16_C(  844), UINT16_C(64511) },
+      { SIMDE_FLOAT32_C(-4.63724136e-05),    SIMDE_FLOAT32_C(0.400390625),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+        SIMDE_FLOAT32_C(-6.09755516e-05),   SIMDE_FLOAT32_C(-0.489013672),    SIMDE_FLOAT32_C(0.344970703), SIMDE_FLOAT32_C(0.000134468079),
+           SIMDE_FLOAT32_C(-4.65625000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+        SIMDE_FLOAT32_C(2.03847885e-05),     SIMDE_FLOAT32_C(7.23828125),     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-65504.0000) } },
+    { UINT16_C( 7752),
+      { UINT16_C(28119), UINT16_C(49491), UINT16_C(  145), UINT16_C(12778), UINT16_C(15299), UINT16_C(44532), UINT16_C(45161), UINT16_C(16685),
+        UINT16_C(31222), UINT16_C(    1), UINT16_C(46955), UINT16_C(15327), UINT16_C(14113), UINT16_C(15223), UINT16_C(59803), UINT16_C(49265) },
+      {     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(0.184814453),
+            SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),   SIMDE_FLOAT32_C(-0.137817383),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(5.96046448e-08),   SIMDE_FLOAT32_C(-0.463623047),    SIMDE_FLOAT32_C(0.983886719),
+           SIMDE_FLOAT32_C(0.445556641),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000) } },
+    { UINT16_C(24277),
+      { UINT16_C(32256), UINT16_C(51164), UINT16_C(17573), UINT16_C( 8661), UINT16_C(58934), UINT16_C(46901), UINT16_C(64512), UINT16_C(33034),
+        UINT16_C(32256), UINT16_C(15826), UINT16_C(46099), UINT16_C(15971), UINT16_C(31744), UINT16_C(   97), UINT16_C(14329), UINT16_C(48988) },
+      {                 SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(4.64453125),     SIMDE_FLOAT32_C(0.00000000),
+           SIMDE_FLOAT32_C(-1590.00000),     SIMDE_FLOAT32_C(0.00000000),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-1.58548355e-05),
+            SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(1.45507812),   SIMDE_FLOAT32_C(-0.254638672),     SIMDE_FLOAT32_C(1.59667969),
+                   SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(0.498291016),     SIMDE_FLOAT32_C(0.00000000) } },
+    { UINT16_C(51317),
+      { UINT16_C(64113), UINT16_C(14902), UINT16_C(39560), UINT16_C(33590), UINT16_C(15579), UINT16_C(49441), UINT16_C(15186), UINT16_C(33683),
+        UINT16_C(13949), UINT16_C(64511), UINT16_C(48827), UINT16_C(50853), UINT16_C( 8797), UINT16_C(16826), UINT16_C(  464), UINT16_C(46100) },
+      {    SIMDE_FLOAT32_C(-52768.0000),     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-0.00318908691),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(1.21386719),    SIMDE_FLOAT32_C(-2.56445312),    SIMDE_FLOAT32_C(0.915039062),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-6.64453125),
+            SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(2.76565552e-05),   SIMDE_FLOAT32_C(-0.254882812) } },
+    { UINT16_C(29205),
+      { UINT16_C(35597), UINT16_C(50890), UINT16_C(17265), UINT16_C(26230), UINT16_C(18652), UINT16_C(32965), UINT16_C(15166), UINT16_C(  637),
+        UINT16_C(15503), UINT16_C(33582), UINT16_C(42102), UINT16_C(62415), UINT16_C(    0), UINT16_C(32768), UINT16_C(25161), UINT16_C(47720) },
+      { SIMDE_FLOAT32_C(-0.000215172768),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(3.72070312),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(9.71875000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-4.85181808e-05),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(804.500000),     SIMDE_FLOAT32_C(0.00000000) } },
+    { UINT16_C(41762),
+      { UINT16_C( 1015), UINT16_C(32256), UINT16_C( 1900), UINT16_C(49841), UINT16_C(48126), UINT16_C(49646), UINT16_C(60222), UINT16_C(16220),
+        UINT16_C(  962), UINT16_C(32768), UINT16_C(15576), UINT16_C(    1), UINT16_C(64512), UINT16_C(56563), UINT16_C(  568), UINT16_C(33065) },
+      {     SIMDE_FLOAT32_C(0.00000000),                 SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-2.96484375),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+        SIMDE_FLOAT32_C(5.73396683e-05),    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-316.750000),     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-1.77025795e-05) } },
+    { UINT16_C(  622),
+      { UINT16_C(15474), UINT16_C(46001), UINT16_C(15360), UINT16_C(32256), UINT16_C(17383), UINT16_C(18023), UINT16_C(43336), UINT16_C(    1),
+        UINT16_C(33313), UINT16_C(32768), UINT16_C(46185), UINT16_C(14463), UINT16_C(47981), UINT16_C(17571), UINT16_C(  387), UINT16_C(58949) },
+      {     SIMDE_FLOAT32_C(0.00000000),   SIMDE_FLOAT32_C(-0.240356445),     SIMDE_FLOAT32_C(1.00000000),                 SIMDE_MATH_NANF,
+            SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(6.40234375),  SIMDE_FLOAT32_C(-0.0412597656),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(0.00000000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_cvtph_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_cvtps_ph(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[16];
+    uint16_t r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(3.02866101e-05),    SIMDE_FLOAT32_C(-65520.0000),    SIMDE_FLOAT32_C(-1.78967285), SIMDE_FLOAT32_C(5.96046448e-08),
+          SIMDE_FLOAT32_C(-0.137817383),  SIMDE_FLOAT32_C(-0.0132675171),    SIMDE_FLOAT32_C(0.159225464),            SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(1.00000001e-10),    SIMDE_FLOAT32_C(-5.01757812), SIMDE_FLOAT32_C(-1.49533153e-05), SIMDE_FLOAT32_C(5.96046448e-08),
+           SIMDE_FLOAT32_C(0.257202148),                 SIMDE_MATH_NANF,                -SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(2.47070312) },
+      { UINT16_C(  508), UINT16_C(64512), UINT16_C(48937), UINT16_C(    1), UINT16_C(45161), UINT16_C(41675), UINT16_C(12568), UINT16_C(31744),
+        UINT16_C(    0), UINT16_C(50436), UINT16_C(33019), UINT16_C(    1), UINT16_C(13342), UINT16_C(32256), UINT16_C(65024), UINT16_C(16625) } },
+    { {     SIMDE_FLOAT32_C(1.64086914), SIMDE_FLOAT32_C(-2.98023224e-08),     SIMDE_FLOAT32_C(1.00048828),     SIMDE_FLOAT32_C(2.55981445),
+        SIMDE_FLOAT32_C(5.96046448e-08),   SIMDE_FLOAT32_C(-0.785095215),    SIMDE_FLOAT32_C(-664.812500),     SIMDE_FLOAT32_C(5.18017578),
+        SIMDE_FLOAT32_C(-0.00202345848),     SIMDE_FLOAT32_C(65520.0000),    SIMDE_FLOAT32_C(-1417.00000),     SIMDE_FLOAT32_C(1.79492188),
+         SIMDE_FLOAT32_C(-0.0234355927), SIMDE_FLOAT32_C(-0.000200092793),     SIMDE_FLOAT32_C(268.687500),     SIMDE_FLOAT32_C(1.01586914) },
+      { UINT16_C(16016), UINT16_C(32768), UINT16_C(15360), UINT16_C(16671), UINT16_C(    1), UINT16_C(47688), UINT16_C(57650), UINT16_C(17710),
+        UINT16_C(38949), UINT16_C(31744), UINT16_C(58761), UINT16_C(16174), UINT16_C(42496), UINT16_C(35470), UINT16_C(23603), UINT16_C(15376) } },
+    { {     SIMDE_FLOAT32_C(1.73742676),    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(65504.0000),    SIMDE_FLOAT32_C(-0.00000000),
+            SIMDE_FLOAT32_C(2.00195312),           -SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(1.62280273),     SIMDE_FLOAT32_C(3.24755859),
+            SIMDE_FLOAT32_C(105.750000),    SIMDE_FLOAT32_C(0.128555298),    SIMDE_FLOAT32_C(-3.03686523), SIMDE_FLOAT32_C(2.98023224e-08),
+           SIMDE_FLOAT32_C(0.140106201),    SIMDE_FLOAT32_C(-208.031250),    SIMDE_FLOAT32_C(0.177566528),     SIMDE_FLOAT32_C(2.28613281) },
+      { UINT16_C(16115), UINT16_C(32768), UINT16_C(31743), UINT16_C(32768), UINT16_C(16385), UINT16_C(64512), UINT16_C(15998), UINT16_C(17023),
+        UINT16_C(22172), UINT16_C(12317), UINT16_C(49683), UINT16_C(    0), UINT16_C(12412), UINT16_C(55936), UINT16_C(12719), UINT16_C(16530) } },
+    { {    SIMDE_FLOAT32_C(-9.89843750),    SIMDE_FLOAT32_C(-2.00170898),                -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(8.94069672e-08),
+        SIMDE_FLOAT32_C(7.45058060e-09),    SIMDE_FLOAT32_C(-2.90869141),     SIMDE_FLOAT32_C(0.00000000),   SIMDE_FLOAT32_C(-0.472656250),
+        SIMDE_FLOAT32_C(1.00000001e-10),     SIMDE_FLOAT32_C(1.00048828), SIMDE_FLOAT32_C(0.000999450684),    SIMDE_FLOAT32_C(-1.95031738),
+            SIMDE_FLOAT32_C(0.00000000),   SIMDE_FLOAT32_C(-0.358917236),     SIMDE_FLOAT32_C(65520.0000), SIMDE_FLOAT32_C(8.94069672e-08) },
+      { UINT16_C(51443), UINT16_C(49153), UINT16_C(65024), UINT16_C(    2), UINT16_C(    0), UINT16_C(49617), UINT16_C(    0), UINT16_C(46992),
+        UINT16_C(    0), UINT16_C(15360), UINT16_C( 5144), UINT16_C(49101), UINT16_C(    0), UINT16_C(46526), UINT16_C(31744), UINT16_C(    2) } },
+    { {    SIMDE_FLOAT32_C(-7.64746094),   SIMDE_FLOAT32_C(-0.629394531),    SIMDE_FLOAT32_C(-3.74194336), SIMDE_FLOAT32_C(-1.83433294e-05),
+          SIMDE_FLOAT32_C(-0.542358398),     SIMDE_FLOAT32_C(23.5996094),    SIMDE_FLOAT32_C(-4.30029297),    SIMDE_FLOAT32_C(0.303527832),
+            SIMDE_FLOAT32_C(1.33642578),  SIMDE_FLOAT32_C(0.00120437145),    SIMDE_FLOAT32_C(-2.90063477),     SIMDE_FLOAT32_C(7.09277344),
+            SIMDE_FLOAT32_C(4.89453125),    SIMDE_FLOAT32_C(-7.02099609),    SIMDE_FLOAT32_C(0.255615234),     SIMDE_FLOAT32_C(65504.0000) },
+      { UINT16_C(51110), UINT16_C(47369), UINT16_C(50044), UINT16_C(33076), UINT16_C(47191), UINT16_C(19942), UINT16_C(50253), UINT16_C(13531),
+        UINT16_C(15704), UINT16_C( 5359), UINT16_C(49613), UINT16_C(18200), UINT16_C(17637), UINT16_C(50949), UINT16_C(13335), UINT16_C(31743) } },
+    { {    SIMDE_FLOAT32_C(0.126373291),    SIMDE_FLOAT32_C(-5.87597656),    SIMDE_FLOAT32_C(-7.59960938),   SIMDE_FLOAT32_C(-0.776245117),
+            SIMDE_FLOAT32_C(5.41943359),     SIMDE_FLOAT32_C(1.85998535),    SIMDE_FLOAT32_C(-1.95324707), SIMDE_FLOAT32_C(3.39299440e-05),
+            SIMDE_FLOAT32_C(2.00195312),           -SIMDE_MATH_INFINITYF,                -SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(65520.0000),
+        SIMDE_FLOAT32_C(-5.18560410e-05),   SIMDE_FLOAT32_C(-0.308837891),    SIMDE_FLOAT32_C(-1.09375000),   SIMDE_FLOAT32_C(-0.309112549) },
+      { UINT16_C(12299), UINT16_C(50656), UINT16_C(51098), UINT16_C(47670), UINT16_C(17771), UINT16_C(16241), UINT16_C(49104), UINT16_C(  569),
+        UINT16_C(16385), UINT16_C(64512), UINT16_C(65024), UINT16_C(31744), UINT16_C(33638), UINT16_C(46321), UINT16_C(48224), UINT16_C(46322) } },
+    { {    SIMDE_FLOAT32_C(-3.64062500), SIMDE_FLOAT32_C(8.94069672e-08),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-65520.0000),
+           SIMDE_FLOAT32_C(-65520.0000),   SIMDE_FLOAT32_C(0.0475921631), SIMDE_FLOAT32_C(-3.34382057e-05),                 SIMDE_MATH_NANF,
+            SIMDE_FLOAT32_C(100000.000), SIMDE_FLOAT32_C(-4.90471721e-05), SIMDE_FLOAT32_C(2.98023224e-08),    SIMDE_FLOAT32_C(0.843444824),
+            SIMDE_FLOAT32_C(5.90625000), SIMDE_FLOAT32_C(-0.000457167625),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-5683.50000) },
+      { UINT16_C(49992), UINT16_C(    2), UINT16_C(64512), UINT16_C(64512), UINT16_C(64512), UINT16_C(10776), UINT16_C(33329), UINT16_C(32256),
+        UINT16_C(31744), UINT16_C(33591), UINT16_C(    0), UINT16_C(15039), UINT16_C(17896), UINT16_C(36734), UINT16_C(64512), UINT16_C(60813) } },
+    { {  SIMDE_FLOAT32_C(-0.0403976440),                -SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(1.11584473),     SIMDE_FLOAT32_C(2.00195312),
+                        SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(-0.376220703),    SIMDE_FLOAT32_C(0.185104370),                -SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(1.00000001e-10),  SIMDE_FLOAT32_C(0.00543403625),           -SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.951477051),
+                   SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.503784180),     SIMDE_FLOAT32_C(65520.0000), SIMDE_FLOAT32_C(-6.10128045e-05) },
+      { UINT16_C(43308), UINT16_C(65024), UINT16_C(15479), UINT16_C(16385), UINT16_C(32256), UINT16_C(46597), UINT16_C(12780), UINT16_C(65024),
+        UINT16_C(    0), UINT16_C( 7568), UINT16_C(64512), UINT16_C(48029), UINT16_C(31744), UINT16_C(47112), UINT16_C(31744), UINT16_C(33792) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256i r = simde_mm512_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT);
+    simde_test_x86_assert_equal_u16x16(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_cvtps_ph(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t src[16];
+    simde__mmask16 k;
+    simde_float32 a[16];
+    uint16_t r[16];
+  } test_vec[] = {
+    { { UINT16_C(31291), UINT16_C(45142), UINT16_C(27886), UINT16_C(55144), UINT16_C(51253), UINT16_C(25029), UINT16_C(26114), UINT16_C( 6359),
+        UINT16_C(15847), UINT16_C(36918), UINT16_C(51511), UINT16_C(55268), UINT16_C(48119), UINT16_C(16226), UINT16_C( 9855), UINT16_C(57164) },
+      UINT16_C( 9574),
+      {           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-4.05833125e-05),     SIMDE_FLOAT32_C(18.5468750), SIMDE_FLOAT32_C(4.27067280e-05),
+        SIMDE_FLOAT32_C(5.35771251e-05),     SIMDE_FLOAT32_C(4.29492188),     SIMDE_FLOAT32_C(2.46020508),     SIMDE_FLOAT32_C(65504.0000),
+            SIMDE_FLOAT32_C(65520.0000),     SIMDE_FLOAT32_C(6.39843750),    SIMDE_FLOAT32_C(0.636352539), SIMDE_FLOAT32_C(8.94069672e-08),
+           SIMDE_FLOAT32_C(-4.14550781),  SIMDE_FLOAT32_C(-0.0176086426),   SIMDE_FLOAT32_C(-0.256622314),   SIMDE_FLOAT32_C(0.0420608521) },
+      { UINT16_C(31291), UINT16_C(33448), UINT16_C(19619), UINT16_C(55144), UINT16_C(51253), UINT16_C(17483), UINT16_C(16619), UINT16_C( 6359),
+        UINT16_C(31743), UINT16_C(36918), UINT16_C(14615), UINT16_C(55268), UINT16_C(48119), UINT16_C(42114), UINT16_C( 9855), UINT16_C(57164) } },
+    { { UINT16_C(37492), UINT16_C( 9402), UINT16_C(64886), UINT16_C(52427), UINT16_C(11578), UINT16_C( 2223), UINT16_C(23289), UINT16_C(52320),
+        UINT16_C(51943), UINT16_C(21654), UINT16_C(33005), UINT16_C(59058), UINT16_C(37744), UINT16_C(54842), UINT16_C(13068), UINT16_C(23035) },
+      UINT16_C(36052),
+      {     SIMDE_FLOAT32_C(3.38012695),     SIMDE_FLOAT32_C(20.1777344),     SIMDE_FLOAT32_C(65504.0000),    SIMDE_FLOAT32_C(-3.47656250),
+           SIMDE_FLOAT32_C(-6.49609375),    SIMDE_FLOAT32_C(-1.22814941),    SIMDE_FLOAT32_C(-3.72412109),     SIMDE_FLOAT32_C(93.1875000),
+           SIMDE_FLOAT32_C(-7.62841797), SIMDE_FLOAT32_C(-1.53854489e-05),     SIMDE_FLOAT32_C(1.97729492),                 SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(8.94069672e-08),                 SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(-0.278045654),    SIMDE_FLOAT32_C(0.742187500) },
+      { UINT16_C(37492), UINT16_C( 9402), UINT16_C(31743), UINT16_C(52427), UINT16_C(50815), UINT16_C( 2223), UINT16_C(50034), UINT16_C(21971),
+        UINT16_C(51943), UINT16_C(21654), UINT16_C(16360), UINT16_C(32256), UINT16_C(37744), UINT16_C(54842), UINT16_C(13068), UINT16_C(14832) } },
+    { { UINT16_C(39135), UINT16_C(60010), UINT16_C(31376), UINT16_C(17856), UINT16_C( 1779), UINT16_C(32269), UINT16_C(49552), UINT16_C(10715),
+        UINT16_C(17015), UINT16_C(61351), UINT16_C( 3375), UINT16_C(51196), UINT16_C(16423), UINT16_C(32088), UINT16_C(10931), UINT16_C(12823) },
+      UINT16_C(48664),
+      {   SIMDE_FLOAT32_C(-0.225097656),     SIMDE_FLOAT32_C(2.00195312), SIMDE_FLOAT32_C(-2.36853957e-05),   SIMDE_FLOAT32_C(-0.304473877),
+            SIMDE_FLOAT32_C(65520.0000), SIMDE_FLOAT32_C(-1.39921904e-05),    SIMDE_FLOAT32_C(-1.27734375),    SIMDE_FLOAT32_C(-3.78735352),
+                        SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(0.797546387), SIMDE_FLOAT32_C(5.83976507e-05),     SIMDE_FLOAT32_C(53.6953125),
+            SIMDE_FLOAT32_C(2.10595703),     SIMDE_FLOAT32_C(7767.50000),   SIMDE_FLOAT32_C(-0.812805176),     SIMDE_FLOAT32_C(1.30786133) },
+      { UINT16_C(39135), UINT16_C(60010), UINT16_C(31376), UINT16_C(46303), UINT16_C(31743), UINT16_C(32269), UINT16_C(49552), UINT16_C(10715),
+        UINT16_C(17015), UINT16_C(14945), UINT16_C(  979), UINT16_C(21174), UINT16_C(16438), UINT16_C(28565), UINT16_C(10931), UINT16_C(15675) } },
+    { { UINT16_C(41063), UINT16_C(33985), UINT16_C(64025), UINT16_C(57487), UINT16_C(44959), UINT16_C( 4193), UINT16_C( 7220), UINT16_C(33954),
+        UINT16_C( 3769), UINT16_C(33415), UINT16_C( 4224), UINT16_C( 8274), UINT16_C(23152), UINT16_C(29155), UINT16_C(  114), UINT16_C(51179) },
+      UINT16_C( 2084),
+      { SIMDE_FLOAT32_C(1.00000001e-10),     SIMDE_FLOAT32_C(5.15966797),     SIMDE_FLOAT32_C(65519.9883),     SIMDE_FLOAT32_C(65520.0000),
+          SIMDE_FLOAT32_C(-0.167984009),                -SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(-1.51757812),    SIMDE_FLOAT32_C(-3.87939453),
+          SIMDE_FLOAT32_C(-0.729003906),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-2.95361328),     SIMDE_FLOAT32_C(130.093750),
+           SIMDE_FLOAT32_C(-2.95776367),     SIMDE_FLOAT32_C(4.04687500), SIMDE_FLOAT32_C(8.94069672e-08), SIMDE_FLOAT32_C(0.000755012035) },
+      { UINT16_C(41063), UINT16_C(33985), UINT16_C(31743), UINT16_C(57487), UINT16_C(44959), UINT16_C(65024), UINT16_C( 7220), UINT16_C(33954),
+        UINT16_C( 3769), UINT16_C(33415), UINT16_C( 4224), UINT16_C(22544), UINT16_C(23152), UINT16_C(29155), UINT16_C(  114), UINT16_C(51179) } },
+    { { UINT16_C(18985), UINT16_C(38270), UINT16_C(60406), UINT16_C(64329), UINT16_C(41844), UINT16_C(14090), UINT16_C(31210), UINT16_C( 9756),
+        UINT16_C(55687), UINT16_C(35948), UINT16_C(15702), UINT16_C(25617), UINT16_C(54703), UINT16_C( 7004), UINT16_C(27766), UINT16_C(29299) },
+      UINT16_C( 2404),
+      {                 SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-7.45058060e-09),     SIMDE_FLOAT32_C(4.82617188),   SIMDE_FLOAT32_C(-0.464935303),
+           SIMDE_FLOAT32_C(0.701049805),   SIMDE_FLOAT32_C(-0.162658691),    SIMDE_FLOAT32_C(-2.49047852),    SIMDE_FLOAT32_C(0.465362549),
+        SIMDE_FLOAT32_C(-2.43484974e-05), SIMDE_FLOAT32_C(8.94069672e-08),    SIMDE_FLOAT32_C(-1.79711914),                 SIMDE_MATH_NANF,
+            SIMDE_FLOAT32_C(65504.0000),    SIMDE_FLOAT32_C(-65520.0000),   SIMDE_FLOAT32_C(-0.881835938),     SIMDE_FLOAT32_C(100000.000) },
+      { UINT16_C(18985), UINT16_C(38270), UINT16_C(17619), UINT16_C(64329), UINT16_C(41844), UINT16_C(45364), UINT16_C(49403), UINT16_C( 9756),
+        UINT16_C(33176), UINT16_C(35948), UINT16_C(15702), UINT16_C(32256), UINT16_C(54703), UINT16_C( 7004), UINT16_C(27766), UINT16_C(29299) } },
+    { { UINT16_C( 9039), UINT16_C(17704), UINT16_C(58177), UINT16_C(23422), UINT16_C(44447), UINT16_C(35351), UINT16_C(28942), UINT16_C( 6864),
+        UINT16_C(28845), UINT16_C(16847), UINT16_C(55728), UINT16_C(46460), UINT16_C(17024), UINT16_C(57959), UINT16_C(12422), UINT16_C(38161) },
+      UINT16_C(33570),
+      { SIMDE_FLOAT32_C(1.49011612e-08),     SIMDE_FLOAT32_C(1.00085449), SIMDE_FLOAT32_C(-1.49011612e-08), SIMDE_FLOAT32_C(-2.98023224e-08),
+        SIMDE_FLOAT32_C(-0.000206053257),     SIMDE_FLOAT32_C(2.75390625), SIMDE_FLOAT32_C(1.00000001e-10),   SIMDE_FLOAT32_C(-0.324737549),
+           SIMDE_FLOAT32_C(-6.75585938), SIMDE_FLOAT32_C(6.10724092e-05),    SIMDE_FLOAT32_C(0.750366211),   SIMDE_FLOAT32_C(-0.134414673),
+        SIMDE_FLOAT32_C(6.10724092e-05),     SIMDE_FLOAT32_C(2.70117188),     SIMDE_FLOAT32_C(0.00000000),                 SIMDE_MATH_NANF },
+      { UINT16_C( 9039), UINT16_C(15360), UINT16_C(58177), UINT16_C(23422), UINT16_C(44447), UINT16_C(16770), UINT16_C(28942), UINT16_C( 6864),
+        UINT16_C(50881), UINT16_C( 1024), UINT16_C(55728), UINT16_C(46460), UINT16_C(17024), UINT16_C(57959), UINT16_C(12422), UINT16_C(32256) } },
+    { { UINT16_C(42058), UINT16_C(30716), UINT16_C( 9499), UINT16_C(33125), UINT16_C( 2521), UINT16_C(46604), UINT16_C(24738), UINT16_C( 9041),
+        UINT16_C( 2629), UINT16_C( 9889), UINT16_C(44869), UINT16_C(35248), UINT16_C(35866), UINT16_C(48382), UINT16_C(19757), UINT16_C(37651) },
+      UINT16_C(53718),
+      {  SIMDE_FLOAT32_C(-0.0137577057), SIMDE_FLOAT32_C(-2.17407942e-05),                -SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(0.0154485703),
+            SIMDE_FLOAT32_C(1.11132812),     SIMDE_FLOAT32_C(3.22900391),    SIMDE_FLOAT32_C(-7.95410156), SIMDE_FLOAT32_C(8.94069672e-08),
+           SIMDE_FLOAT32_C(-65520.0000),     SIMDE_FLOAT32_C(2.00195312),    SIMDE_FLOAT32_C(-6.33691406), SIMDE_FLOAT32_C(9.68575478e-08),
+        SIMDE_FLOAT32_C(2.98023224e-08),     SIMDE_FLOAT32_C(2.00195312),   SIMDE_FLOAT32_C(-0.451599121),     SIMDE_FLOAT32_C(31408.0000) },
+      { UINT16_C(42058), UINT16_C(33132), UINT16_C(65024), UINT16_C(33125), UINT16_C(15474), UINT16_C(46604), UINT16_C(51188), UINT16_C(    1),
+        UINT16_C(64511), UINT16_C( 9889), UINT16_C(44869), UINT16_C(35248), UINT16_C(    0), UINT16_C(48382), UINT16_C(46905), UINT16_C(30635) } },
+    { { UINT16_C(19827), UINT16_C(21756), UINT16_C(41441), UINT16_C(46574), UINT16_C(43401), UINT16_C(57223), UINT16_C( 8472), UINT16_C(55920),
+        UINT16_C(35028), UINT16_C(57752), UINT16_C(30487), UINT16_C(31325), UINT16_C( 3171), UINT16_C(56018), UINT16_C(13131), UINT16_C(55066) },
+      UINT16_C(43173),
+      {    SIMDE_FLOAT32_C(-21.9453125),     SIMDE_FLOAT32_C(6.24853516),     SIMDE_FLOAT32_C(3.44116211), SIMDE_FLOAT32_C(-2.39163637e-06),
+        SIMDE_FLOAT32_C(-1.04084611e-05), SIMDE_FLOAT32_C(1.40741467e-05),     SIMDE_FLOAT32_C(1.00073242), SIMDE_FLOAT32_C(5.96046448e-08),
+           SIMDE_FLOAT32_C(-3.35595703),   SIMDE_FLOAT32_C(-0.176849365),     SIMDE_FLOAT32_C(1.96362305), SIMDE_FLOAT32_C(-3.98084521e-05),
+        SIMDE_FLOAT32_C(-5.96046448e-08),    SIMDE_FLOAT32_C(-1.58605957),    SIMDE_FLOAT32_C(-2718.00000), SIMDE_FLOAT32_C(2.64495611e-05) },
+      { UINT16_C(52604), UINT16_C(21756), UINT16_C(17121), UINT16_C(46574), UINT16_C(43401), UINT16_C(  236), UINT16_C( 8472), UINT16_C(    1),
+        UINT16_C(35028), UINT16_C(57752), UINT16_C(30487), UINT16_C(33435), UINT16_C( 3171), UINT16_C(48728), UINT16_C(13131), UINT16_C(  443) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_mm256_loadu_si256(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256i r = simde_mm512_mask_cvtps_ph(src, test_vec[i].k, a, SIMDE_MM_FROUND_TO_ZERO);
+    simde_test_x86_assert_equal_u16x16(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_cvtps_ph(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde__mmask16 k;
+    simde_float32 a[16];
+    uint16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(33115),
+      {   SIMDE_FLOAT32_C(-0.411071777),    SIMDE_FLOAT32_C(-15.0664062),     SIMDE_FLOAT32_C(5.77929688),    SIMDE_FLOAT32_C(-1099.75000),
+           SIMDE_FLOAT32_C(-2.00122070),    SIMDE_FLOAT32_C(-223.625000),    SIMDE_FLOAT32_C(-2.88940430), SIMDE_FLOAT32_C(-2.45049596e-05),
+        SIMDE_FLOAT32_C(3.34978104e-05), SIMDE_FLOAT32_C(-5.21540642e-08),     SIMDE_FLOAT32_C(65504.0000),    SIMDE_FLOAT32_C(-38740.0000),
+           SIMDE_FLOAT32_C(-65520.0000),     SIMDE_FLOAT32_C(2.00195312),            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-0.00340676308) },
+      { UINT16_C(46739), UINT16_C(52104), UINT16_C(    0), UINT16_C(58443), UINT16_C(49152), UINT16_C(    0), UINT16_C(49607), UINT16_C(    0),
+        UINT16_C(  562), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(39674) } },
+    { UINT16_C(50942),
+      {    SIMDE_FLOAT32_C(-2.18017578),            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(33532.0000),     SIMDE_FLOAT32_C(4.48291016),
+                       -SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(-1.83032227),     SIMDE_FLOAT32_C(1.87353516),    SIMDE_FLOAT32_C(-4.81689453),
+        SIMDE_FLOAT32_C(-0.000401586294),                -SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(0.876770020),                -SIMDE_MATH_NANF,
+            SIMDE_FLOAT32_C(7.64453125),            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-2.98023224e-08),     SIMDE_FLOAT32_C(0.00000000) },
+      { UINT16_C(    0), UINT16_C(31744), UINT16_C(30744), UINT16_C(17532), UINT16_C(65024), UINT16_C(48978), UINT16_C(16255), UINT16_C(50385),
+        UINT16_C(    0), UINT16_C(65024), UINT16_C(15108), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(32768), UINT16_C(    0) } },
+    { UINT16_C(31624),
+      { SIMDE_FLOAT32_C(-5.88595867e-05),     SIMDE_FLOAT32_C(1.00061035),    SIMDE_FLOAT32_C(0.477447510),   SIMDE_FLOAT32_C(-0.954101562),
+           SIMDE_FLOAT32_C(-1.66027832),     SIMDE_FLOAT32_C(6.78662109),     SIMDE_FLOAT32_C(28.1953125), SIMDE_FLOAT32_C(8.94069672e-08),
+        SIMDE_FLOAT32_C(-6.14672899e-06),     SIMDE_FLOAT32_C(2.00195312),    SIMDE_FLOAT32_C(-6.07324219),    SIMDE_FLOAT32_C(0.553710938),
+        SIMDE_FLOAT32_C(2.98023224e-08),     SIMDE_FLOAT32_C(2.00195312),     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(0.592468262) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(48034), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    2),
+        UINT16_C(32871), UINT16_C(16385), UINT16_C(    0), UINT16_C(14446), UINT16_C(    1), UINT16_C(16385), UINT16_C(    0), UINT16_C(    0) } },
+    { UINT16_C(21086),
+      {    SIMDE_FLOAT32_C(0.589477539), SIMDE_FLOAT32_C(3.97041440e-05),            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(0.00000000),
+            SIMDE_FLOAT32_C(7818.00000),    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(6.97509766),            SIMDE_MATH_INFINITYF,
+            SIMDE_FLOAT32_C(9832.00000), SIMDE_FLOAT32_C(-2.98023224e-08), SIMDE_FLOAT32_C(5.96046448e-08),   SIMDE_FLOAT32_C(-0.218612671),
+          SIMDE_FLOAT32_C(-0.134719849),    SIMDE_FLOAT32_C(-3308.25000),   SIMDE_FLOAT32_C(0.0755004883), SIMDE_FLOAT32_C(5.96046448e-08) },
+      { UINT16_C(    0), UINT16_C(  667), UINT16_C(31744), UINT16_C(    0), UINT16_C(28579), UINT16_C(    0), UINT16_C(18170), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(32768), UINT16_C(    0), UINT16_C(    0), UINT16_C(45135), UINT16_C(    0), UINT16_C(11477), UINT16_C(    0) } },
+    { UINT16_C(57164),
+      {     SIMDE_FLOAT32_C(4.99267578), SIMDE_FLOAT32_C(-0.000217273831),    SIMDE_FLOAT32_C(0.438690186),     SIMDE_FLOAT32_C(0.00000000),
+        SIMDE_FLOAT32_C(8.16583633e-06),   SIMDE_FLOAT32_C(-0.183975220),   SIMDE_FLOAT32_C(-0.699707031),                -SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(-2.53319740e-05),    SIMDE_FLOAT32_C(-65520.0000),    SIMDE_FLOAT32_C(-3.48974609), SIMDE_FLOAT32_C(1.72182918e-05),
+            SIMDE_FLOAT32_C(10892.0000), SIMDE_FLOAT32_C(8.19563866e-08), SIMDE_FLOAT32_C(-4.93749976e-05),    SIMDE_FLOAT32_C(0.415130615) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(14085), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(47513), UINT16_C(    0),
+        UINT16_C(33193), UINT16_C(64511), UINT16_C(49914), UINT16_C(  289), UINT16_C(29010), UINT16_C(    0), UINT16_C(33596), UINT16_C(13989) } },
+    { UINT16_C(15397),
+      { SIMDE_FLOAT32_C(1.62124634e-05),            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(8.94069672e-08),    SIMDE_FLOAT32_C(-0.00000000),
+           SIMDE_FLOAT32_C(0.147781372),   SIMDE_FLOAT32_C(-0.336212158),     SIMDE_FLOAT32_C(1.82995605), SIMDE_FLOAT32_C(0.000125914812),
+           SIMDE_FLOAT32_C(0.230545044), SIMDE_FLOAT32_C(1.21220946e-05),     SIMDE_FLOAT32_C(3.92358398),     SIMDE_FLOAT32_C(7.47216797),
+          SIMDE_FLOAT32_C(-0.573669434), SIMDE_FLOAT32_C(-0.000874459743),    SIMDE_FLOAT32_C(0.131729126),    SIMDE_FLOAT32_C(0.674865723) },
+      { UINT16_C(  272), UINT16_C(    0), UINT16_C(    2), UINT16_C(    0), UINT16_C(    0), UINT16_C(46433), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(17369), UINT16_C(18297), UINT16_C(47254), UINT16_C(37673), UINT16_C(    0), UINT16_C(    0) } },
+    { UINT16_C(22665),
+      {     SIMDE_FLOAT32_C(16.2636719), SIMDE_FLOAT32_C(-2.76714563e-05),    SIMDE_FLOAT32_C(-0.00000000), SIMDE_FLOAT32_C(-0.000172898173),
+          SIMDE_FLOAT32_C(-0.765014648), SIMDE_FLOAT32_C(-0.000458598137),     SIMDE_FLOAT32_C(2.38256836),    SIMDE_FLOAT32_C(-65520.0000),
+                       -SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(7814.00000),            SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-0.00000000),
+            SIMDE_FLOAT32_C(65504.0000),                -SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(0.333435059),    SIMDE_FLOAT32_C(-3.43798828) },
+      { UINT16_C(19473), UINT16_C(    0), UINT16_C(    0), UINT16_C(35242), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(64511),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(32768), UINT16_C(31743), UINT16_C(    0), UINT16_C(13654), UINT16_C(    0) } },
+    { UINT16_C( 9662),
+      {    SIMDE_FLOAT32_C(0.333312988),                 SIMDE_MATH_NANF,           -SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(65520.0000),
+        SIMDE_FLOAT32_C(2.87741423e-05),    SIMDE_FLOAT32_C(0.439727783),    SIMDE_FLOAT32_C(0.348999023),     SIMDE_FLOAT32_C(2.29638672),
+          SIMDE_FLOAT32_C(0.0273990631),    SIMDE_FLOAT32_C(-12216.0000), SIMDE_FLOAT32_C(5.96046448e-08), SIMDE_FLOAT32_C(3.17692757e-05),
+          SIMDE_FLOAT32_C(-0.942932129),     SIMDE_FLOAT32_C(100000.000),    SIMDE_FLOAT32_C(0.346832275),    SIMDE_FLOAT32_C(-1.85046387) },
+      { UINT16_C(    0), UINT16_C(32256), UINT16_C(64512), UINT16_C(31744), UINT16_C(  483), UINT16_C(14090), UINT16_C(    0), UINT16_C(16536),
+        UINT16_C( 9988), UINT16_C(    0), UINT16_C(    1), UINT16_C(    0), UINT16_C(    0), UINT16_C(31744), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256i r = simde_mm512_maskz_cvtps_ph(test_vec[i].k, a, SIMDE_MM_FROUND_TO_POS_INF);
+    simde_test_x86_assert_equal_u16x16(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepi8_epi16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepi16_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtepi16_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtepi16_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtps_ph)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtps_ph)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtps_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
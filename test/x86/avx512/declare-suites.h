@@ -5,6 +5,7 @@ SIMDE_TEST_DECLARE_SUITE(adds)
 SIMDE_TEST_DECLARE_SUITE(and)
 SIMDE_TEST_DECLARE_SUITE(andnot)
 SIMDE_TEST_DECLARE_SUITE(avg)
+SIMDE_TEST_DECLARE_SUITE(bitshuffle)
 SIMDE_TEST_DECLARE_SUITE(blend)
 SIMDE_TEST_DECLARE_SUITE(broadcast)
 SIMDE_TEST_DECLARE_SUITE(cast)
@@ -14,15 +15,23 @@ SIMDE_TEST_DECLARE_SUITE(cmpgt)
 SIMDE_TEST_DECLARE_SUITE(cmp)
 SIMDE_TEST_DECLARE_SUITE(cmple)
 SIMDE_TEST_DECLARE_SUITE(cmplt)
+SIMDE_TEST_DECLARE_SUITE(compress)
+SIMDE_TEST_DECLARE_SUITE(conflict)
 SIMDE_TEST_DECLARE_SUITE(copysign)
 SIMDE_TEST_DECLARE_SUITE(cvt)
 SIMDE_TEST_DECLARE_SUITE(cvts)
 SIMDE_TEST_DECLARE_SUITE(div)
+SIMDE_TEST_DECLARE_SUITE(dpbusd)
+SIMDE_TEST_DECLARE_SUITE(dpbusds)
+SIMDE_TEST_DECLARE_SUITE(dpwssd)
+SIMDE_TEST_DECLARE_SUITE(dpwssds)
+SIMDE_TEST_DECLARE_SUITE(expand)
 SIMDE_TEST_DECLARE_SUITE(extract)
 SIMDE_TEST_DECLARE_SUITE(fmadd)
 SIMDE_TEST_DECLARE_SUITE(fmsub)
 SIMDE_TEST_DECLARE_SUITE(fnmadd)
 SIMDE_TEST_DECLARE_SUITE(fnmsub)
+SIMDE_TEST_DECLARE_SUITE(gather)
 SIMDE_TEST_DECLARE_SUITE(insert)
 SIMDE_TEST_DECLARE_SUITE(kshift)
 SIMDE_TEST_DECLARE_SUITE(load)
@@ -39,13 +48,17 @@ SIMDE_TEST_DECLARE_SUITE(mul)
 SIMDE_TEST_DECLARE_SUITE(mulhi)
 SIMDE_TEST_DECLARE_SUITE(mulhrs)
 SIMDE_TEST_DECLARE_SUITE(mullo)
+SIMDE_TEST_DECLARE_SUITE(multishift)
 SIMDE_TEST_DECLARE_SUITE(negate)
 SIMDE_TEST_DECLARE_SUITE(or)
 SIMDE_TEST_DECLARE_SUITE(packs)
 SIMDE_TEST_DECLARE_SUITE(packus)
 SIMDE_TEST_DECLARE_SUITE(permutex2var)
 SIMDE_TEST_DECLARE_SUITE(permutexvar)
+SIMDE_TEST_DECLARE_SUITE(popcnt)
+SIMDE_TEST_DECLARE_SUITE(reduce)
 SIMDE_TEST_DECLARE_SUITE(sad)
+SIMDE_TEST_DECLARE_SUITE(scatter)
 SIMDE_TEST_DECLARE_SUITE(set1)
 SIMDE_TEST_DECLARE_SUITE(set4)
 SIMDE_TEST_DECLARE_SUITE(set)
@@ -53,6 +66,10 @@ SIMDE_TEST_DECLARE_SUITE(setone)
 SIMDE_TEST_DECLARE_SUITE(setr4)
 SIMDE_TEST_DECLARE_SUITE(setr)
 SIMDE_TEST_DECLARE_SUITE(setzero)
+SIMDE_TEST_DECLARE_SUITE(shldi)
+SIMDE_TEST_DECLARE_SUITE(shldv)
+SIMDE_TEST_DECLARE_SUITE(shrdi)
+SIMDE_TEST_DECLARE_SUITE(shrdv)
 SIMDE_TEST_DECLARE_SUITE(shuffle)
 SIMDE_TEST_DECLARE_SUITE(sll)
 SIMDE_TEST_DECLARE_SUITE(slli)
@@ -68,6 +85,7 @@ SIMDE_TEST_DECLARE_SUITE(store)
 SIMDE_TEST_DECLARE_SUITE(storeu)
 SIMDE_TEST_DECLARE_SUITE(sub)
 SIMDE_TEST_DECLARE_SUITE(subs)
+SIMDE_TEST_DECLARE_SUITE(ternarylogic)
 SIMDE_TEST_DECLARE_SUITE(test)
 SIMDE_TEST_DECLARE_SUITE(unpackhi)
 SIMDE_TEST_DECLARE_SUITE(unpacklo)
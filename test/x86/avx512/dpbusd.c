@@ -0,0 +1,812 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpbusd
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpbusd.h>
+
+static int
+test_simde_mm_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   830256800), -INT32_C(   169673641),  INT32_C(  1243931546), -INT32_C(   186647041) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   830387360), -INT32_C(   169544101),  INT32_C(  1243800986), -INT32_C(   186517501) } },
+    { { -INT32_C(     9437185),  INT32_C(   787209476), -INT32_C(         545), -INT32_C(    43253763) },
+      { -INT8_C(   1), -INT8_C(  50), -INT8_C(  49),  INT8_C(  12), -INT8_C(   1), -INT8_C(  42), -INT8_C(  88),  INT8_C( 122),  INT8_C(   0), -INT8_C(   3), -INT8_C( 109), -INT8_C(  49), -INT8_C( 106), -INT8_C(  45),  INT8_C(  56), -INT8_C( 124) },
+      {  INT8_C(  19), -INT8_C(  64),  INT8_C( 123), -INT8_C(   3), -INT8_C( 110),  INT8_C(  13), -INT8_C(  10), -INT8_C(   2), -INT8_C(  34), -INT8_C(   1),      INT8_MAX, -INT8_C( 105),  INT8_C(   0),  INT8_C(  17),  INT8_C( 119), -INT8_C(   3) },
+      { -INT32_C(     9420099),  INT32_C(   787182284), -INT32_C(        3864), -INT32_C(    43243908) } },
+    { {  INT32_C(    50397184),  INT32_C(  1115750404), -INT32_C(  1065246686),  INT32_C(   907307450) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C( 100), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(  53),  INT8_C(   4),  INT8_C(   0),  INT8_C(  68),  INT8_C(  88),  INT8_C( 103),      INT8_MIN,  INT8_C(  20),      INT8_MIN,  INT8_C(  83) },
+      {  INT8_C(  30),  INT8_C(  32), -INT8_C(   2),  INT8_C( 113),  INT8_C(   0),  INT8_C(  79),      INT8_MAX, -INT8_C(   3), -INT8_C(  33),  INT8_C( 112), -INT8_C(  57), -INT8_C(  81), -INT8_C(   1),  INT8_C( 126), -INT8_C(  12),  INT8_C(  16) },
+      {  INT32_C(    50425687),  INT32_C(  1115796318), -INT32_C(  1065252429),  INT32_C(   907309634) } },
+    { { -INT32_C(        1033), -INT32_C(     8421713), -INT32_C(  1973436475), -INT32_C(  1072241801) },
+      { -INT8_C(   1),  INT8_C(  64), -INT8_C(   1),  INT8_C(  16),  INT8_C(  22),  INT8_C(  62), -INT8_C(   1),  INT8_C(  64),  INT8_C(  82), -INT8_C(   2),  INT8_C(  78), -INT8_C(  35), -INT8_C(  21), -INT8_C(   1),  INT8_C(  60), -INT8_C(   1) },
+      { -INT8_C(  42),  INT8_C(  96), -INT8_C(  15),  INT8_C(  64), -INT8_C(  13), -INT8_C( 112),  INT8_C(   0),  INT8_C( 103), -INT8_C( 100), -INT8_C(  80),  INT8_C( 115), -INT8_C(   2), -INT8_C(   1), -INT8_C(   5),  INT8_C(  18), -INT8_C(  88) },
+      { -INT32_C(        8400), -INT32_C(     8422351), -INT32_C(  1973456467), -INT32_C(  1072264671) } },
+    { { -INT32_C(  1195827381), -INT32_C(      263489), -INT32_C(   799013742),  INT32_C(   536872980) },
+      { -INT8_C(  60),  INT8_C(  58),  INT8_C(  96),  INT8_C(  85), -INT8_C(  13), -INT8_C(   1),  INT8_C(   8),  INT8_C(  25),      INT8_MAX,  INT8_C(  33),  INT8_C( 109),  INT8_C(  10),  INT8_C(  13),  INT8_C(  64), -INT8_C( 120), -INT8_C(  91) },
+      { -INT8_C( 124), -INT8_C(  49),  INT8_C(   4), -INT8_C( 120),  INT8_C(   4), -INT8_C(  99), -INT8_C(  26), -INT8_C(  13), -INT8_C(  33),  INT8_C(  90),  INT8_C(  84),  INT8_C(  93), -INT8_C(  33),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0) },
+      { -INT32_C(  1195864343), -INT32_C(      288295), -INT32_C(   799004877),  INT32_C(   536872143) } },
+    { {  INT32_C(   603979776), -INT32_C(  1099243531),  INT32_C(   202215212),  INT32_C(    78188235) },
+      {  INT8_C(   0),  INT8_C(  56), -INT8_C(  54),  INT8_C(  77), -INT8_C( 115),  INT8_C(   2),  INT8_C(   2), -INT8_C( 119), -INT8_C(  68), -INT8_C(  19),  INT8_C(  20),  INT8_C(  76), -INT8_C( 111), -INT8_C(   9), -INT8_C(  82),  INT8_C(   2) },
+      { -INT8_C(   1), -INT8_C(  53),  INT8_C(   0), -INT8_C(  52),  INT8_C(   0), -INT8_C(  52), -INT8_C( 109), -INT8_C(  68), -INT8_C( 102), -INT8_C(   3), -INT8_C(  44), -INT8_C(   7), -INT8_C(  54), -INT8_C(  33), -INT8_C(   9),      INT8_MAX },
+      {  INT32_C(   603972804), -INT32_C(  1099253169),  INT32_C(   202193913),  INT32_C(    78170942) } },
+    { { -INT32_C(  1642282228),  INT32_C(   270534660),  INT32_C(  1333762006), -INT32_C(   565096306) },
+      { -INT8_C(  44),  INT8_C(  98),      INT8_MIN,  INT8_C(   0), -INT8_C(  77), -INT8_C(  49), -INT8_C(   5), -INT8_C( 103), -INT8_C(  41), -INT8_C(  20),  INT8_C(  28), -INT8_C(  25), -INT8_C( 127), -INT8_C(   1),  INT8_C(   0),  INT8_C(  96) },
+      {  INT8_C(  25),  INT8_C(  49), -INT8_C(  74),  INT8_C(  83), -INT8_C(   1), -INT8_C(  77),  INT8_C(  66),  INT8_C( 120),  INT8_C(   8),  INT8_C(  63),  INT8_C(  26), -INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(   2), -INT8_C(  51) },
+      { -INT32_C(  1642281598),  INT32_C(   270553468),  INT32_C(  1333750678), -INT32_C(   565073794) } },
+    { { -INT32_C(  1077938140), -INT32_C(   134742529),  INT32_C(  1543429870),  INT32_C(      229384) },
+      { -INT8_C(  60),  INT8_C(  58), -INT8_C(  83),  INT8_C(  72),      INT8_MIN,  INT8_C( 105),  INT8_C(  85), -INT8_C( 108),  INT8_C(   0), -INT8_C(  33), -INT8_C(  89),  INT8_C(   0), -INT8_C(  33), -INT8_C(   5), -INT8_C(  19),  INT8_C( 125) },
+      { -INT8_C(   9), -INT8_C(  90),  INT8_C(  55), -INT8_C(   3),  INT8_C( 118), -INT8_C(  95),      INT8_MIN,  INT8_C(  34),  INT8_C(   9),  INT8_C(   0),  INT8_C(  20),  INT8_C(   0),  INT8_C(  64), -INT8_C(   1),  INT8_C(  81), -INT8_C(  13) },
+      { -INT32_C(  1077935825), -INT32_C(   134743248),  INT32_C(  1543433210),  INT32_C(      260977) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_dpbusd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   169846395), -INT32_C(           1),  INT32_C(   127421023), -INT32_C(   270548993) },
+      UINT8_C(236),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   169846395), -INT32_C(           1),  INT32_C(   127290463), -INT32_C(   270419453) } },
+    { { -INT32_C(   823444916), -INT32_C(  2147483616),  INT32_C(   146103050), -INT32_C(   805318657) },
+      UINT8_C(242),
+      { -INT8_C( 113), -INT8_C(  33),  INT8_C(  24), -INT8_C(  60), -INT8_C(   4), -INT8_C( 118), -INT8_C(   1),      INT8_MIN, -INT8_C(   3),  INT8_C(  28),  INT8_C(  63), -INT8_C(   1),  INT8_C( 126),  INT8_C(   0), -INT8_C( 107), -INT8_C(   1) },
+      {  INT8_C( 125), -INT8_C(  79),  INT8_C(   0), -INT8_C(   3),  INT8_C(   4), -INT8_C( 100), -INT8_C(  17), -INT8_C(   2),  INT8_C(  68), -INT8_C(   9), -INT8_C(   1), -INT8_C(  17),  INT8_C(   0), -INT8_C(  95), -INT8_C(  15), -INT8_C(  17) },
+      { -INT32_C(   823444916),  INT32_C(  2147466297),  INT32_C(   146103050), -INT32_C(   805318657) } },
+    { { -INT32_C(  1776138209), -INT32_C(   134226113),  INT32_C(  2113929079), -INT32_C(    79444356) },
+      UINT8_C( 43),
+      {  INT8_C(  42), -INT8_C(   1),  INT8_C(  57), -INT8_C(  58),  INT8_C(   1), -INT8_C(  83),  INT8_C( 119),  INT8_C( 102),  INT8_C(  70), -INT8_C(  65), -INT8_C( 110),  INT8_C(  88), -INT8_C(   1), -INT8_C(  15),  INT8_C(  32), -INT8_C(  33) },
+      {  INT8_C(  80),  INT8_C(  32),  INT8_C(  93), -INT8_C(   1), -INT8_C( 108), -INT8_C( 127),  INT8_C(  82),  INT8_C(  64),  INT8_C(  61), -INT8_C(   9),  INT8_C( 110),  INT8_C(   0), -INT8_C(  86),  INT8_C(   2),  INT8_C(   4), -INT8_C(  77) },
+      { -INT32_C(  1776121586), -INT32_C(   134231906),  INT32_C(  2113929079), -INT32_C(    79482847) } },
+    { {  INT32_C(  1524060692), -INT32_C(   205833363),  INT32_C(    67108928), -INT32_C(   272629761) },
+      UINT8_C(126),
+      {  INT8_C(  57), -INT8_C(  65),  INT8_C(  72),  INT8_C(  95), -INT8_C(  89),      INT8_MIN, -INT8_C(  41), -INT8_C(  33),  INT8_C(   3), -INT8_C( 103), -INT8_C(   3), -INT8_C(  64),  INT8_C(   2), -INT8_C(  50), -INT8_C(  13), -INT8_C(  33) },
+      { -INT8_C(  64), -INT8_C(  65),  INT8_C( 115),  INT8_C( 116),  INT8_C( 103), -INT8_C( 127),  INT8_C(  32),  INT8_C(  74),  INT8_C(   0), -INT8_C(  18),  INT8_C(  40), -INT8_C(   1), -INT8_C(  33),  INT8_C(   0),  INT8_C(   8), -INT8_C( 109) },
+      {  INT32_C(  1524060692), -INT32_C(   205809036),  INT32_C(    67116102), -INT32_C(   272652190) } },
+    { { -INT32_C(  1953251876), -INT32_C(  1210056705), -INT32_C(   553713937), -INT32_C(  1870609652) },
+      UINT8_C(183),
+      { -INT8_C(  29), -INT8_C(  89),  INT8_C( 108),  INT8_C(  46),  INT8_C(  12),  INT8_C(   0),  INT8_C(   8),  INT8_C(  45),  INT8_C(  15), -INT8_C( 120), -INT8_C(  36), -INT8_C(  65), -INT8_C(  17),  INT8_C(  80),  INT8_C(  88), -INT8_C(  91) },
+      {  INT8_C(  76),  INT8_C(  98),  INT8_C(  31), -INT8_C(   1), -INT8_C(   5),  INT8_C(  32), -INT8_C(   9),  INT8_C(  16),  INT8_C(  42), -INT8_C(  33), -INT8_C( 103), -INT8_C(   1), -INT8_C(  99),  INT8_C(  64),  INT8_C(  96), -INT8_C(  28) },
+      { -INT32_C(  1953214956), -INT32_C(  1210056117), -INT32_C(   553740646), -INT32_C(  1870609652) } },
+    { { -INT32_C(   343577119),  INT32_C(   628499844),  INT32_C(  1283389919),  INT32_C(  1370177150) },
+      UINT8_C(228),
+      {  INT8_C(   9), -INT8_C(  25),  INT8_C(   2),  INT8_C(  69), -INT8_C(  25), -INT8_C(   2), -INT8_C(  33),  INT8_C(  38),  INT8_C(  50), -INT8_C(   1), -INT8_C(   1), -INT8_C(  85), -INT8_C(   1), -INT8_C(  32),  INT8_C(  55), -INT8_C(  22) },
+      {  INT8_C(   3), -INT8_C(  60), -INT8_C(  12), -INT8_C(   7), -INT8_C(  38), -INT8_C(  19), -INT8_C(  41), -INT8_C(  33), -INT8_C(  58),  INT8_C(   0),  INT8_C(  58), -INT8_C(  37), -INT8_C(  33), -INT8_C( 109),  INT8_C(  74), -INT8_C(  17) },
+      { -INT32_C(   343577119),  INT32_C(   628499844),  INT32_C(  1283395482),  INT32_C(  1370177150) } },
+    { {  INT32_C(     1049217),  INT32_C(   433897068),  INT32_C(    35660553),  INT32_C(   320777522) },
+      UINT8_C(108),
+      {      INT8_MAX,      INT8_MAX,  INT8_C(  29),  INT8_C(   8),  INT8_C(   4), -INT8_C(  58),  INT8_C(  23),  INT8_C(  67),  INT8_C(  77),  INT8_C(  66), -INT8_C(  15),  INT8_C(  10), -INT8_C(  10),  INT8_C(  67), -INT8_C(  14),  INT8_C(   0) },
+      { -INT8_C(  19),  INT8_C(  34),  INT8_C(   0), -INT8_C(  65), -INT8_C( 113), -INT8_C(  88), -INT8_C( 105), -INT8_C(   1),  INT8_C(  83),  INT8_C(  42),  INT8_C(   4),  INT8_C( 104), -INT8_C(  10),  INT8_C( 114), -INT8_C(  27),  INT8_C(  17) },
+      {  INT32_C(     1049217),  INT32_C(   433897068),  INT32_C(    35671720),  INT32_C(   320776166) } },
+    { {  INT32_C(    67112970), -INT32_C(  2001254354), -INT32_C(    67109249), -INT32_C(  1759266292) },
+      UINT8_C( 27),
+      { -INT8_C(   8), -INT8_C(  31), -INT8_C(   1),  INT8_C(  73),      INT8_MIN,  INT8_C(   0), -INT8_C(  23), -INT8_C( 106), -INT8_C(  66),  INT8_C(   4),  INT8_C( 125), -INT8_C( 107),  INT8_C(   0), -INT8_C(  71),  INT8_C(   8),  INT8_C( 111) },
+      {  INT8_C(  93), -INT8_C(  26),  INT8_C(  74),  INT8_C(  12),  INT8_C(   4),  INT8_C(  59),  INT8_C(  63),  INT8_C(  11), -INT8_C(  26),  INT8_C(   3), -INT8_C(  51), -INT8_C(  14), -INT8_C(  53), -INT8_C(   5),  INT8_C(   2), -INT8_C(   7) },
+      {  INT32_C(    67149930), -INT32_C(  2001237513), -INT32_C(    67109249), -INT32_C(  1759267978) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpbusd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(         513),  INT32_C(   754084566),  INT32_C(  1778367471), -INT32_C(  1017358365) },
+      UINT8_C( 69),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(      131073),  INT32_C(           0),  INT32_C(  1778236911),  INT32_C(           0) } },
+    { {  INT32_C(    16810336), -INT32_C(   549454853), -INT32_C(  1787999901),  INT32_C(   844151943) },
+      UINT8_C(194),
+      { -INT8_C(  17),  INT8_C(  87), -INT8_C(  32), -INT8_C(  62),      INT8_MAX,  INT8_C(   0), -INT8_C(  33), -INT8_C(   1), -INT8_C(   8),  INT8_C(  78), -INT8_C(   1), -INT8_C( 127), -INT8_C(  17), -INT8_C(  25), -INT8_C(  73),  INT8_C(   0) },
+      { -INT8_C(  63), -INT8_C(  69),  INT8_C(  78), -INT8_C(  76), -INT8_C(  73), -INT8_C(  63),  INT8_C( 116), -INT8_C(   2), -INT8_C(  41),  INT8_C(  21),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0),  INT8_C(   0),      INT8_MAX,  INT8_C(   8) },
+      {  INT32_C(           0), -INT32_C(   549438766),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   277781214),  INT32_C(    16777216), -INT32_C(      851969), -INT32_C(   791317507) },
+      UINT8_C(  9),
+      { -INT8_C(  11), -INT8_C(   1), -INT8_C(  81),      INT8_MIN, -INT8_C(   2), -INT8_C(   1),  INT8_C(  16),  INT8_C(  55),  INT8_C(   9),  INT8_C(  56), -INT8_C(  67),  INT8_C(  97), -INT8_C(  21),  INT8_C( 125), -INT8_C(  97), -INT8_C(  19) },
+      {  INT8_C(  16),  INT8_C(  32), -INT8_C(   2),  INT8_C(  93), -INT8_C(  63), -INT8_C(   1),  INT8_C(  62), -INT8_C(   1),  INT8_C(  16), -INT8_C( 117),  INT8_C( 101),  INT8_C(   0),  INT8_C(  58), -INT8_C(  65),  INT8_C(  32), -INT8_C(   2) },
+      { -INT32_C(   277757580),  INT32_C(           0),  INT32_C(           0), -INT32_C(   791307388) } },
+    { {  INT32_C(    18942080), -INT32_C(  2079842304),  INT32_C(  1860473299),  INT32_C(  2080933963) },
+      UINT8_C(173),
+      {  INT8_C(  38), -INT8_C(  40), -INT8_C( 118),  INT8_C(   1),  INT8_C(  50),  INT8_C(   4),  INT8_C(  91), -INT8_C( 104),  INT8_C(  16),  INT8_C(   0),  INT8_C(  10), -INT8_C(  73),  INT8_C(  32),  INT8_C(  32), -INT8_C(   1),  INT8_C(  88) },
+      { -INT8_C(  93),  INT8_C( 125), -INT8_C(   9),  INT8_C(  14),  INT8_C(  53),  INT8_C(   0),  INT8_C(  50),  INT8_C(  10), -INT8_C( 106), -INT8_C(  33), -INT8_C(   1), -INT8_C(  25), -INT8_C(   1), -INT8_C(   1),  INT8_C(  53),  INT8_C(   3) },
+      {  INT32_C(    18964318),  INT32_C(           0),  INT32_C(  1860467018),  INT32_C(  2080947678) } },
+    { { -INT32_C(  1949450802),  INT32_C(   549331698),  INT32_C(      786432), -INT32_C(  1259404026) },
+      UINT8_C(186),
+      { -INT8_C(   7), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(  65),  INT8_C(  62), -INT8_C(   9), -INT8_C(  67), -INT8_C( 111),  INT8_C(  10), -INT8_C(   1),  INT8_C( 123),  INT8_C(   0), -INT8_C(  17) },
+      { -INT8_C(  13),  INT8_C(   3), -INT8_C(  75), -INT8_C(  49),  INT8_C(   0), -INT8_C(  21), -INT8_C(   1), -INT8_C(  37), -INT8_C( 106), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0), -INT8_C(  40), -INT8_C(  11),  INT8_C(   0), -INT8_C(   4) },
+      {  INT32_C(           0),  INT32_C(   549329213),  INT32_C(           0), -INT32_C(  1259416535) } },
+    { {  INT32_C(  2063572991), -INT32_C(  1974886489), -INT32_C(  1781403551), -INT32_C(  2147479552) },
+      UINT8_C( 15),
+      {  INT8_C(   4),      INT8_MIN,  INT8_C( 100),  INT8_C(  23),  INT8_C(  45),  INT8_C(  32), -INT8_C(  17), -INT8_C(   4), -INT8_C(  15),  INT8_C(  44), -INT8_C(   3),      INT8_MAX, -INT8_C(   9), -INT8_C(  67), -INT8_C(  15), -INT8_C(   1) },
+      { -INT8_C(   9), -INT8_C(  65),  INT8_C(  72),  INT8_C(  93),  INT8_C(  23), -INT8_C(  87),  INT8_C(  76), -INT8_C(  77), -INT8_C(  73), -INT8_C(  65),      INT8_MAX,  INT8_C(   5), -INT8_C(  43), -INT8_C(  64), -INT8_C(   2), -INT8_C(  34) },
+      {  INT32_C(  2063573974), -INT32_C(  1974889478), -INT32_C(  1781391238),  INT32_C(  2147455875) } },
+    { {  INT32_C(    16793600),  INT32_C(    17991680),  INT32_C(        4224),  INT32_C(      393216) },
+      UINT8_C( 90),
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C(  56),  INT8_C( 101),  INT8_C(   8), -INT8_C(   1), -INT8_C( 121), -INT8_C(   1),  INT8_C(  36), -INT8_C(   2),  INT8_C( 126), -INT8_C(  20),  INT8_C(   0),  INT8_C(  45),  INT8_C( 126),  INT8_C(  16) },
+      { -INT8_C(  57),  INT8_C(  14), -INT8_C(  56),  INT8_C(   0),  INT8_C( 126),  INT8_C(   8), -INT8_C(  53), -INT8_C(  35),  INT8_C(   3), -INT8_C(  57),  INT8_C(  15),  INT8_C(  32),  INT8_C(  95),  INT8_C(  64),  INT8_C(  53),  INT8_C(  76) },
+      {  INT32_C(           0),  INT32_C(    17978648),  INT32_C(           0),  INT32_C(      403990) } },
+    { {  INT32_C(  1048377294), -INT32_C(     2623617),  INT32_C(    67239968),  INT32_C(     2113616) },
+      UINT8_C( 71),
+      {  INT8_C(  77), -INT8_C(  80), -INT8_C( 101),  INT8_C(   2), -INT8_C(  83),  INT8_C(  68),  INT8_C(   0), -INT8_C(  27), -INT8_C(   1), -INT8_C(  94), -INT8_C(  17), -INT8_C(   3),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0), -INT8_C(  89) },
+      {  INT8_C(   0),      INT8_MAX,      INT8_MIN,  INT8_C(   8), -INT8_C(   9),  INT8_C(   4),      INT8_MAX, -INT8_C( 112), -INT8_C(  65),  INT8_C(  71),  INT8_C(  66),  INT8_C(  61), -INT8_C(  65), -INT8_C(  48), -INT8_C(  67),      INT8_MAX },
+      {  INT32_C(  1048379822), -INT32_C(     2650550),  INT32_C(    67266102),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpbusd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int8_t a[32];
+    const int8_t b[32];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(   394264575), -INT32_C(   846152715), -INT32_C(  1926186338), -INT32_C(  1909730489),  INT32_C(  1410162807),  INT32_C(  2078663169), -INT32_C(  1406438892), -INT32_C(    68157442) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   394395135), -INT32_C(   846023175), -INT32_C(  1926316898), -INT32_C(  1909600949),  INT32_C(  1410032247),  INT32_C(  2078792709), -INT32_C(  1406569452), -INT32_C(    68027902) } },
+    { { -INT32_C(        2113),  INT32_C(   289931400), -INT32_C(  1477728023),  INT32_C(   272629761),  INT32_C(     1052672),  INT32_C(  2128477439), -INT32_C(   214660511), -INT32_C(   537920529) },
+      {  INT8_C(   0),  INT8_C(  83),  INT8_C(   1),  INT8_C(  32), -INT8_C( 125), -INT8_C(  32),  INT8_C(   1), -INT8_C(  21),  INT8_C(  85), -INT8_C(   2),  INT8_C( 116), -INT8_C(   3),  INT8_C(  26), -INT8_C(  65), -INT8_C(  62),  INT8_C(  83),
+        -INT8_C(  33),  INT8_C(  80), -INT8_C(  35), -INT8_C(  13),  INT8_C( 125), -INT8_C(   1),  INT8_C(  80), -INT8_C(  35),  INT8_C(   0), -INT8_C(  89),  INT8_C(   6), -INT8_C(  18),  INT8_C(   0), -INT8_C(   1),  INT8_C( 125), -INT8_C(  67) },
+      { -INT8_C(  73), -INT8_C(  50),  INT8_C( 116),  INT8_C(  63),  INT8_C(   1),  INT8_C(   0), -INT8_C(   2),  INT8_C(  13),  INT8_C( 118),  INT8_C(  64),  INT8_C(  64),  INT8_C(  40),  INT8_C( 105),  INT8_C(  70), -INT8_C(   3), -INT8_C(  17),
+         INT8_C(  77),  INT8_C(  12),  INT8_C( 120), -INT8_C(   2),  INT8_C( 122),      INT8_MAX,  INT8_C(  92), -INT8_C(  81),  INT8_C(  73), -INT8_C(  65), -INT8_C(  13), -INT8_C(   1), -INT8_C(  17), -INT8_C(   1),  INT8_C(   8),  INT8_C(  54) },
+      { -INT32_C(        4131),  INT32_C(   289934584), -INT32_C(  1477684193),  INT32_C(   272643868),  INT32_C(     1096837),  INT32_C(  2128514533), -INT32_C(   214671682), -INT32_C(   537909578) } },
+    { {  INT32_C(  1612266901),  INT32_C(  1204708246),  INT32_C(  1191842946), -INT32_C(   537919505),  INT32_C(     1048581),  INT32_C(   268468224), -INT32_C(   433992434), -INT32_C(     2121729) },
+      { -INT8_C(   5),  INT8_C( 108),  INT8_C(  91), -INT8_C(  25), -INT8_C( 126),  INT8_C( 114),  INT8_C(  59), -INT8_C(  96), -INT8_C( 117),  INT8_C(   9), -INT8_C(   9), -INT8_C(  44),  INT8_C(  32),  INT8_C(   0),  INT8_C(  43),  INT8_C(   0),
+        -INT8_C(  84), -INT8_C(   1),  INT8_C(   4),  INT8_C(  48),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),  INT8_C(  30),  INT8_C(   8), -INT8_C(  97),  INT8_C( 123), -INT8_C(  45), -INT8_C(  65), -INT8_C(   2), -INT8_C(   3),  INT8_C(  53) },
+      { -INT8_C(   9), -INT8_C( 104),  INT8_C( 113), -INT8_C(   1), -INT8_C(  14),      INT8_MIN,  INT8_C(  76),  INT8_C(   4),  INT8_C(   0),  INT8_C(   8),  INT8_C(  46), -INT8_C(  27),  INT8_C(   0), -INT8_C(   1), -INT8_C( 121),  INT8_C(  66),
+        -INT8_C(  60),  INT8_C( 117),  INT8_C(  87), -INT8_C(  70), -INT8_C( 105),  INT8_C(   3), -INT8_C(   4), -INT8_C(  31), -INT8_C(  37), -INT8_C(   1),  INT8_C(  65),  INT8_C( 111), -INT8_C(  25), -INT8_C(  66),  INT8_C( 112), -INT8_C( 116) },
+      {  INT32_C(  1612263462),  INT32_C(  1204696958),  INT32_C(  1191848656), -INT32_C(   537924708),  INT32_C(     1065084),  INT32_C(   268467390), -INT32_C(   433961473), -INT32_C(     2121080) } },
+    { { -INT32_C(  1074083574),  INT32_C(  1140883520),  INT32_C(   148918783), -INT32_C(    83952130), -INT32_C(   536870929), -INT32_C(    67699345),  INT32_C(      262233),  INT32_C(  1228732356) },
+      {      INT8_MIN, -INT8_C(  11),  INT8_C( 115), -INT8_C(  37),  INT8_C(   5),  INT8_C(   2), -INT8_C( 115), -INT8_C(  99), -INT8_C( 102), -INT8_C(  65), -INT8_C(  13),  INT8_C(  69), -INT8_C( 103),  INT8_C( 107),  INT8_C(  67), -INT8_C(   1),
+         INT8_C(  52), -INT8_C(  74), -INT8_C(   1), -INT8_C(  66), -INT8_C(   3), -INT8_C(   1), -INT8_C(  62),  INT8_C(   1),  INT8_C(   8), -INT8_C(  48), -INT8_C(  13), -INT8_C(  83),  INT8_C(  73), -INT8_C(   1),  INT8_C( 111),  INT8_C( 117) },
+      { -INT8_C(  69),  INT8_C(  18),  INT8_C(  17), -INT8_C( 104), -INT8_C(  48),      INT8_MAX,  INT8_C(   0), -INT8_C(   2), -INT8_C(  81),  INT8_C(  96), -INT8_C(  83),  INT8_C(   0), -INT8_C(  65), -INT8_C(  89),  INT8_C(  18), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(  65), -INT8_C(   3), -INT8_C(   2), -INT8_C(   9), -INT8_C( 108), -INT8_C(  33), -INT8_C( 104),  INT8_C(  76), -INT8_C(   3), -INT8_C(   1),  INT8_C(   8), -INT8_C(  33),      INT8_MAX, -INT8_C(   3),  INT8_C(   0) },
+      { -INT32_C(  1074108817),  INT32_C(  1140883220),  INT32_C(   148904476), -INT32_C(    83970647), -INT32_C(   536860296), -INT32_C(    67735668),  INT32_C(      263358),  INT32_C(  1228761999) } },
+    { { -INT32_C(   461155475),  INT32_C(  1524999017),  INT32_C(  1878522854),  INT32_C(           2),  INT32_C(   136323072),  INT32_C(          32), -INT32_C(  1720230365), -INT32_C(         517) },
+      { -INT8_C(  39), -INT8_C(  66), -INT8_C(  50),  INT8_C( 102),  INT8_C(  66), -INT8_C(  86),  INT8_C(   4),  INT8_C(   8),  INT8_C(   0),  INT8_C(   1), -INT8_C(   1), -INT8_C(   3), -INT8_C(  34), -INT8_C(  77), -INT8_C( 104), -INT8_C( 104),
+        -INT8_C(   9), -INT8_C(  23), -INT8_C(  65), -INT8_C(   1), -INT8_C(   5), -INT8_C(  56),  INT8_C(  16), -INT8_C(  48),  INT8_C(   0), -INT8_C(   1), -INT8_C(  95),      INT8_MIN, -INT8_C( 115), -INT8_C( 103), -INT8_C(  65), -INT8_C(  91) },
+      {  INT8_C(   8), -INT8_C(  17), -INT8_C(  85),  INT8_C(   0), -INT8_C(  30), -INT8_C(   2), -INT8_C(   1), -INT8_C(   6),  INT8_C( 121), -INT8_C(   1),  INT8_C(  12),  INT8_C(  79), -INT8_C(   2),  INT8_C(  13),  INT8_C( 113), -INT8_C( 105),
+         INT8_C(  74),  INT8_C(   6),  INT8_C(  41), -INT8_C(  67),  INT8_C(  18), -INT8_C( 113), -INT8_C(  74), -INT8_C(  73),  INT8_C(  70), -INT8_C(  45),  INT8_C(   8), -INT8_C(  33), -INT8_C(   7), -INT8_C(  33),  INT8_C(  10),  INT8_C(  83) },
+      { -INT32_C(   461174479),  INT32_C(  1524996645),  INT32_C(  1878545900),  INT32_C(        3101),  INT32_C(   136333494), -INT32_C(       34418), -INT32_C(  1720244776),  INT32_C(        9052) } },
+    { { -INT32_C(  2146942912),  INT32_C(  1073741840),  INT32_C(    16777280),  INT32_C(   769592764),  INT32_C(    67108864),  INT32_C(     2134144),  INT32_C(    17076240),  INT32_C(   372517201) },
+      { -INT8_C(   1),  INT8_C(   0), -INT8_C(  38), -INT8_C( 113),  INT8_C(   0),  INT8_C(   2), -INT8_C(  77), -INT8_C(  49), -INT8_C(  65),  INT8_C(   6),      INT8_MAX,  INT8_C(  49), -INT8_C( 107), -INT8_C( 124), -INT8_C( 109),  INT8_C(  64),
+         INT8_C(  90), -INT8_C(  29), -INT8_C(  24),      INT8_MIN, -INT8_C(   2), -INT8_C(  46),  INT8_C(  72), -INT8_C(  26), -INT8_C(  49),  INT8_C(  97), -INT8_C(  51),  INT8_C(  16),  INT8_C(   4),  INT8_C(  20),  INT8_C(   0), -INT8_C(   2) },
+      {  INT8_C(  10),  INT8_C(   0), -INT8_C(  57),  INT8_C(   0),  INT8_C(  62), -INT8_C(  61), -INT8_C(   1), -INT8_C(   1),  INT8_C(  69),  INT8_C(  13), -INT8_C( 115), -INT8_C( 117), -INT8_C(  34), -INT8_C(   1), -INT8_C(  11),  INT8_C(  43),
+        -INT8_C(  44),  INT8_C(   0), -INT8_C(   5),  INT8_C(  19),  INT8_C(  45),  INT8_C(  34), -INT8_C(  74),  INT8_C( 109),  INT8_C(  81),  INT8_C( 119),  INT8_C(  44), -INT8_C(  16), -INT8_C(  68),  INT8_C(  53), -INT8_C(   1), -INT8_C(   1) },
+      { -INT32_C(  2146952788),  INT32_C(  1073741332),  INT32_C(    16770199),  INT32_C(   769588701),  INT32_C(    67106176),  INT32_C(     2172456),  INT32_C(    17113314),  INT32_C(   372517735) } },
+    { { -INT32_C(     8650753),  INT32_C(     2130944), -INT32_C(  1635687390),  INT32_C(  1140758012),  INT32_C(  1177012054), -INT32_C(   541065473), -INT32_C(   870574632),  INT32_C(   268435456) },
+      { -INT8_C(   1), -INT8_C(  40),  INT8_C(   0),  INT8_C(   0), -INT8_C(  45),  INT8_C(  25),  INT8_C(  16), -INT8_C( 118),  INT8_C(   0),      INT8_MIN, -INT8_C( 111), -INT8_C(  73), -INT8_C(  97),  INT8_C(  26),  INT8_C(  16), -INT8_C(   2),
+         INT8_C(  26),  INT8_C(  40), -INT8_C(   1), -INT8_C(   9), -INT8_C(  53),  INT8_C(   0), -INT8_C(   1),  INT8_C(  48),  INT8_C( 109), -INT8_C(   1),  INT8_C(   6), -INT8_C(  33),  INT8_C(  32),      INT8_MAX,  INT8_C(  88),      INT8_MIN },
+      {  INT8_C(  20),  INT8_C(  30),  INT8_C(   0),  INT8_C( 108), -INT8_C(   1),  INT8_C(  36), -INT8_C(   1),  INT8_C(  16), -INT8_C(   3), -INT8_C(  66),  INT8_C(  34),  INT8_C(   2), -INT8_C(   9), -INT8_C(  40), -INT8_C(   9),  INT8_C(  70),
+         INT8_C(  38), -INT8_C(  20),  INT8_C(   0), -INT8_C(   3),  INT8_C(  78), -INT8_C( 119),  INT8_C(  10), -INT8_C(  46), -INT8_C(  33), -INT8_C(  62),  INT8_C(  30), -INT8_C(   8),  INT8_C(  14), -INT8_C(  41),  INT8_C( 108),  INT8_C(  41) },
+      { -INT32_C(     8639173),  INT32_C(     2133825), -INT32_C(  1635690542),  INT32_C(  1140773177),  INT32_C(  1177011501), -INT32_C(   541049297), -INT32_C(   870595643),  INT32_C(   268445449) } },
+    { { -INT32_C(     8388609), -INT32_C(    33562642),  INT32_C(   269485057),  INT32_C(   754081987),  INT32_C(  1330055596),  INT32_C(      167940), -INT32_C(  1610608640),  INT32_C(  1132138610) },
+      {  INT8_C(  69), -INT8_C(  35), -INT8_C(   1), -INT8_C( 123), -INT8_C(  67), -INT8_C(   5),      INT8_MAX, -INT8_C(  53), -INT8_C(  28), -INT8_C(  29), -INT8_C( 108),  INT8_C(  32), -INT8_C(  35),  INT8_C(  80), -INT8_C(  30),  INT8_C( 120),
+        -INT8_C( 112), -INT8_C(   2), -INT8_C(  41), -INT8_C(  29), -INT8_C(   1),  INT8_C(  68),  INT8_C(   0), -INT8_C(   5), -INT8_C(  47),  INT8_C(  92), -INT8_C(   2),  INT8_C(   2),  INT8_C( 121), -INT8_C(   5), -INT8_C(  49),  INT8_C(   2) },
+      { -INT8_C(   1), -INT8_C(   2), -INT8_C(  72),  INT8_C(  70), -INT8_C(  65),  INT8_C(  97), -INT8_C( 121), -INT8_C(   1), -INT8_C(   1), -INT8_C( 104),  INT8_C(   2),  INT8_C(   0), -INT8_C(  41), -INT8_C(  12),  INT8_C(  32),  INT8_C(  32),
+        -INT8_C(  41),  INT8_C(  37), -INT8_C( 116), -INT8_C(   5),  INT8_C(  29), -INT8_C(   1),  INT8_C( 120),  INT8_C(  66), -INT8_C( 123), -INT8_C( 102),  INT8_C(  64),  INT8_C(   0), -INT8_C(  21),  INT8_C(  96),  INT8_C(   1), -INT8_C(   3) },
+      { -INT32_C(     8398170), -INT32_C(    33566150),  INT32_C(   269461517),  INT32_C(   754083038),  INT32_C(  1330033015),  INT32_C(      191833), -INT32_C(  1610627475),  INT32_C(  1132160366) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpbusd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(     1179905),  INT32_C(   425635864),  INT32_C(   222221259), -INT32_C(   754244980), -INT32_C(  1295740315),  INT32_C(   766432978), -INT32_C(      197633), -INT32_C(   413599176) },
+      UINT8_C( 80),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(     1179905),  INT32_C(   425635864),  INT32_C(   222221259), -INT32_C(   754244980), -INT32_C(  1295870875),  INT32_C(   766432978), -INT32_C(      328193), -INT32_C(   413599176) } },
+    { {  INT32_C(     1115136), -INT32_C(  2147270583), -INT32_C(   608174389), -INT32_C(  2003638537), -INT32_C(    50332698),  INT32_C(   505811534), -INT32_C(    32919453),  INT32_C(    15730688) },
+      UINT8_C(158),
+      {  INT8_C( 114),  INT8_C( 118),  INT8_C(   8),  INT8_C( 108),  INT8_C(  36), -INT8_C(  39), -INT8_C(   1), -INT8_C(  15), -INT8_C(   1),  INT8_C(   0),  INT8_C(  59),  INT8_C(  92),  INT8_C(  93),  INT8_C(   0), -INT8_C(  72), -INT8_C(   4),
+        -INT8_C(  65),  INT8_C(  40), -INT8_C( 119), -INT8_C( 124), -INT8_C(  42),  INT8_C( 111), -INT8_C(  77), -INT8_C(  17),  INT8_C(  16), -INT8_C(  85), -INT8_C(  65), -INT8_C(   5), -INT8_C(   3),  INT8_C(  17),  INT8_C(  16),  INT8_C(  30) },
+      {  INT8_C(  16), -INT8_C(   2),  INT8_C(  60),  INT8_C( 113),  INT8_C(   9), -INT8_C(   1),  INT8_C(  33),  INT8_C(   0), -INT8_C(   1),  INT8_C(  23), -INT8_C(   1), -INT8_C(  45), -INT8_C(   5), -INT8_C(  67),  INT8_C(   0), -INT8_C(   2),
+         INT8_C(   9),  INT8_C(  69), -INT8_C(  80),  INT8_C(  66),  INT8_C(   0), -INT8_C(  24),  INT8_C(  32),  INT8_C(   4), -INT8_C(   3),  INT8_C(   0),  INT8_C(  64),  INT8_C(  44), -INT8_C(  95), -INT8_C(  89), -INT8_C(   1),  INT8_C(  87) },
+      {  INT32_C(     1115136), -INT32_C(  2147262061), -INT32_C(   608178843), -INT32_C(  2003639506), -INT32_C(    50330467),  INT32_C(   505811534), -INT32_C(    32919453),  INT32_C(    15707734) } },
+    { {  INT32_C(      393728),  INT32_C(  1047188948), -INT32_C(  1566230207),  INT32_C(  1722272983), -INT32_C(  2022051530),  INT32_C(    16777216), -INT32_C(  1459617278),  INT32_C(   904872418) },
+      UINT8_C(178),
+      { -INT8_C(  47), -INT8_C(  67), -INT8_C( 115), -INT8_C(   1), -INT8_C(   1), -INT8_C(   7),  INT8_C( 120),  INT8_C(  43), -INT8_C(  39),  INT8_C(  22),  INT8_C( 123), -INT8_C(  61),  INT8_C(  16),  INT8_C(  33), -INT8_C(  57),  INT8_C(   0),
+        -INT8_C(  94),  INT8_C(   1), -INT8_C(  33), -INT8_C(  55),  INT8_C(   3), -INT8_C(  65),  INT8_C(  42), -INT8_C( 104),  INT8_C(  80), -INT8_C(   9),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0), -INT8_C(   3), -INT8_C(  36), -INT8_C(  65) },
+      {  INT8_C(  27), -INT8_C(   1), -INT8_C(  40), -INT8_C( 106), -INT8_C(  97),  INT8_C(  11), -INT8_C(  42), -INT8_C(   1),  INT8_C(  71),  INT8_C(  39), -INT8_C(   1), -INT8_C(   1),  INT8_C( 117),  INT8_C(  68), -INT8_C( 112), -INT8_C(  71),
+         INT8_C(  25), -INT8_C(  60),  INT8_C(   1), -INT8_C(  38), -INT8_C(  81), -INT8_C(  10),  INT8_C(   2), -INT8_C(  23),  INT8_C(   4),  INT8_C(   7),  INT8_C(  18), -INT8_C(   1),  INT8_C(  99),  INT8_C(  64), -INT8_C(  72),  INT8_C(  60) },
+      {  INT32_C(      393728),  INT32_C(  1047161869), -INT32_C(  1566230207),  INT32_C(  1722272983), -INT32_C(  2022054955),  INT32_C(    16771651), -INT32_C(  1459617278),  INT32_C(   904884230) } },
+    { {  INT32_C(      524873),  INT32_C(  1082358390), -INT32_C(   134316289),  INT32_C(         256), -INT32_C(   771791634),  INT32_C(   469770369), -INT32_C(   541130805), -INT32_C(   445220160) },
+      UINT8_C(241),
+      {  INT8_C(  40), -INT8_C(   1),  INT8_C(   6),  INT8_C(  16), -INT8_C(  56),  INT8_C(  99), -INT8_C( 111),  INT8_C(  64),  INT8_C(  69), -INT8_C(  19),  INT8_C(   3),  INT8_C(   0),  INT8_C( 119), -INT8_C( 112),  INT8_C( 103), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(  27), -INT8_C(  10), -INT8_C(   1), -INT8_C(  19), -INT8_C(  65),      INT8_MIN,  INT8_C(   0), -INT8_C(   1),  INT8_C(  41), -INT8_C(  94), -INT8_C(   7), -INT8_C(  12), -INT8_C(  77),  INT8_C(   0), -INT8_C(  43) },
+      {  INT8_C(  64),  INT8_C(  10), -INT8_C( 117),  INT8_C(  48),  INT8_C(  67),  INT8_C(  32),  INT8_C(   9),      INT8_MIN,      INT8_MAX, -INT8_C(   1), -INT8_C( 108), -INT8_C(  17),  INT8_C(  76),  INT8_C(  30), -INT8_C(   9), -INT8_C(  36),
+        -INT8_C(   9),  INT8_C(   0), -INT8_C(  33), -INT8_C(   1),  INT8_C( 102),  INT8_C(  83), -INT8_C(  81),  INT8_C(  46), -INT8_C(   1),  INT8_C(   3), -INT8_C(  12),      INT8_MAX,  INT8_C(  19),  INT8_C(   0), -INT8_C(  89), -INT8_C(  19) },
+      {  INT32_C(      530049),  INT32_C(  1082358390), -INT32_C(   134316289),  INT32_C(         256), -INT32_C(   771802302),  INT32_C(   469800028), -INT32_C(   541101258), -INT32_C(   445219571) } },
+    { { -INT32_C(    16681028),  INT32_C(   520081279), -INT32_C(   302008339),  INT32_C(   285376928), -INT32_C(         129),  INT32_C(   402915456), -INT32_C(  2147121016), -INT32_C(   955858549) },
+      UINT8_C(231),
+      { -INT8_C(  21), -INT8_C( 114),  INT8_C(  34),  INT8_C( 113), -INT8_C(   1), -INT8_C(  35), -INT8_C(  89),      INT8_MIN, -INT8_C(  33), -INT8_C(  24),  INT8_C(  53), -INT8_C(  28), -INT8_C(   5), -INT8_C(  53), -INT8_C(  15), -INT8_C( 106),
+        -INT8_C(  65),  INT8_C(   0),  INT8_C( 101),  INT8_C(  18),  INT8_C(   4),  INT8_C(   1), -INT8_C(  27),  INT8_C(   3),  INT8_C( 107), -INT8_C(  97),  INT8_C(  40),  INT8_C(   4),  INT8_C(  23), -INT8_C(   1),  INT8_C(  32),  INT8_C(  26) },
+      {  INT8_C(   0),  INT8_C( 112), -INT8_C(  58),  INT8_C(  61),  INT8_C(  58),  INT8_C(  34), -INT8_C( 103),  INT8_C(   0), -INT8_C(   2),      INT8_MIN,  INT8_C(  93),  INT8_C(  32),  INT8_C(  16), -INT8_C(  69),      INT8_MAX,  INT8_C(   1),
+         INT8_C(  62),  INT8_C(  60),  INT8_C(   0),  INT8_C( 111),  INT8_C(   2),  INT8_C(   0),  INT8_C(  91), -INT8_C(  26), -INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(   8),  INT8_C(  18),  INT8_C(  85), -INT8_C(  97), -INT8_C(   1) },
+      { -INT32_C(    16660203),  INT32_C(   520086382), -INT32_C(   302026256),  INT32_C(   285376928), -INT32_C(         129),  INT32_C(   402936225), -INT32_C(  2147120931), -INT32_C(   955839590) } },
+    { {  INT32_C(    12589312),  INT32_C(   134218240), -INT32_C(   644808766), -INT32_C(   450516250), -INT32_C(   442951091),  INT32_C(  1188724781), -INT32_C(  1654041185),  INT32_C(   325562799) },
+      UINT8_C(196),
+      { -INT8_C(  96),  INT8_C(  56), -INT8_C(   1),  INT8_C(  66),  INT8_C(  76),  INT8_C(   0), -INT8_C(  69),  INT8_C(   2),  INT8_C( 126),  INT8_C(  83),  INT8_C(   8),  INT8_C(  12), -INT8_C(  68),  INT8_C(   0), -INT8_C(   1), -INT8_C( 117),
+        -INT8_C(  64), -INT8_C(  92),  INT8_C(  32),      INT8_MAX, -INT8_C(  73),  INT8_C(  33), -INT8_C( 100),  INT8_C(  29), -INT8_C(  32), -INT8_C(  64),  INT8_C(  55),  INT8_C(   0), -INT8_C(  54),      INT8_MIN,  INT8_C(  57), -INT8_C( 108) },
+      {  INT8_C(   6), -INT8_C(  73),  INT8_C(  88),  INT8_C(   3),  INT8_C(  14), -INT8_C(  99),  INT8_C(  21),  INT8_C(  68), -INT8_C(  96),  INT8_C(  38), -INT8_C( 113),  INT8_C(  77), -INT8_C(  34), -INT8_C(  78), -INT8_C(   1),  INT8_C(  33),
+        -INT8_C(  96), -INT8_C( 123), -INT8_C(   1),  INT8_C( 112), -INT8_C(  33), -INT8_C(  35), -INT8_C(  22),  INT8_C(   4), -INT8_C(  41),  INT8_C( 102), -INT8_C(   1),  INT8_C(  60), -INT8_C(   9),  INT8_C(  16), -INT8_C(   5), -INT8_C(  17) },
+      {  INT32_C(    12589312),  INT32_C(   134218240), -INT32_C(   644817688), -INT32_C(   450516250), -INT32_C(   442951091),  INT32_C(  1188724781), -INT32_C(  1654030840),  INT32_C(   325560228) } },
+    { { -INT32_C(   497543103),  INT32_C(    33686049),  INT32_C(     2097185), -INT32_C(   329965160), -INT32_C(   892057170), -INT32_C(    16844865), -INT32_C(   537133571), -INT32_C(  1856978529) },
+      UINT8_C( 36),
+      {  INT8_C(  22),  INT8_C(  89), -INT8_C(   5), -INT8_C(  47),  INT8_C(  22),  INT8_C(  16), -INT8_C(  23), -INT8_C(   5), -INT8_C(   9), -INT8_C(  18), -INT8_C(   2),  INT8_C(  56),  INT8_C(   0),  INT8_C(   0), -INT8_C(   9),  INT8_C( 119),
+        -INT8_C(  17),  INT8_C(  36), -INT8_C(  50),  INT8_C(  42),  INT8_C(  15), -INT8_C(   1), -INT8_C(  36),      INT8_MIN, -INT8_C(   2),  INT8_C(  44), -INT8_C(  17),  INT8_C(  96), -INT8_C(  65), -INT8_C(   1),  INT8_C(  75), -INT8_C(  65) },
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C(  39), -INT8_C(  17), -INT8_C(  17), -INT8_C(  48), -INT8_C(   3),  INT8_C(  45),  INT8_C(  73),  INT8_C(  64), -INT8_C(  62),  INT8_C(  36), -INT8_C(   9), -INT8_C( 101),  INT8_C(   0), -INT8_C(  44),
+         INT8_C(   0),  INT8_C(  32),  INT8_C(  96), -INT8_C(  33),      INT8_MAX,  INT8_C(  96),  INT8_C(  70), -INT8_C(   6), -INT8_C(  36),  INT8_C(  55), -INT8_C(  87),  INT8_C(   8),  INT8_C(  48), -INT8_C(  65), -INT8_C(   9), -INT8_C(   4) },
+      { -INT32_C(   497543103),  INT32_C(    33686049),  INT32_C(     2116716), -INT32_C(   329965160), -INT32_C(   892057170), -INT32_C(    16803848), -INT32_C(   537133571), -INT32_C(  1856978529) } },
+    { {  INT32_C(  1404339929), -INT32_C(   104610780), -INT32_C(    33562642), -INT32_C(     1082405),  INT32_C(  1587544047), -INT32_C(  2120214528), -INT32_C(  1547358860),  INT32_C(           0) },
+      UINT8_C(253),
+      {  INT8_C( 105),  INT8_C(   0),  INT8_C(  94),  INT8_C(  50), -INT8_C(  60),  INT8_C(   0), -INT8_C(   1), -INT8_C(  34),  INT8_C( 121), -INT8_C(   1), -INT8_C(  32), -INT8_C(  27),  INT8_C(  69), -INT8_C(  46), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(  86), -INT8_C(   1),  INT8_C( 111),  INT8_C(   8), -INT8_C(  54), -INT8_C(   5), -INT8_C(  98), -INT8_C(  22),  INT8_C(   2),  INT8_C(  36),  INT8_C(  77),  INT8_C(   4),  INT8_C(   0), -INT8_C( 112), -INT8_C( 103),  INT8_C(  50) },
+      { -INT8_C(  85),  INT8_C( 102), -INT8_C( 113),  INT8_C(   0),  INT8_C(  98), -INT8_C(  88), -INT8_C(   1), -INT8_C(  30),  INT8_C(  58),  INT8_C(  67),  INT8_C(  67),  INT8_C(  49), -INT8_C(   1),  INT8_C(  68), -INT8_C(  47),  INT8_C(  55),
+        -INT8_C( 102),  INT8_C(  34), -INT8_C( 105),  INT8_C(  32),  INT8_C(   0), -INT8_C(   2), -INT8_C(  17),  INT8_C(   0),  INT8_C(  54), -INT8_C(   5), -INT8_C(  69),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44), -INT8_C(   3), -INT8_C( 125) },
+      {  INT32_C(  1404320382), -INT32_C(   104610780), -INT32_C(    33512310), -INT32_C(     1066154),  INT32_C(  1587523978), -INT32_C(  2120217716), -INT32_C(  1547364245), -INT32_C(         373) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpbusd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(       12562), -INT32_C(    10616993),  INT32_C(   389792746),  INT32_C(   536871936), -INT32_C(     2622513), -INT32_C(   265710383),  INT32_C(           0), -INT32_C(  1897808782) },
+      UINT8_C(222),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(           0), -INT32_C(    10487453),  INT32_C(   389662186),  INT32_C(   537001476), -INT32_C(     2753073),  INT32_C(           0), -INT32_C(      130560), -INT32_C(  1897679242) } },
+    { {  INT32_C(  1370623715), -INT32_C(    16777249), -INT32_C(  1111917425),  INT32_C(   908661866), -INT32_C(  1661685100), -INT32_C(   510967639), -INT32_C(  1889152226), -INT32_C(    75916648) },
+      UINT8_C(128),
+      { -INT8_C(  17), -INT8_C(  33), -INT8_C(  96), -INT8_C(  16),  INT8_C( 104), -INT8_C(  33),      INT8_MIN,  INT8_C(  32), -INT8_C(   9),  INT8_C(  80), -INT8_C(  24), -INT8_C(  36), -INT8_C(  55), -INT8_C(   3), -INT8_C(   3), -INT8_C(  12),
+        -INT8_C( 111), -INT8_C(   1), -INT8_C(   1), -INT8_C(  64), -INT8_C(  66),  INT8_C(   0),  INT8_C(  30),  INT8_C(  14), -INT8_C(  93), -INT8_C(  80), -INT8_C(   9),  INT8_C(  68), -INT8_C(  40), -INT8_C(  66), -INT8_C( 113), -INT8_C( 126) },
+      { -INT8_C(  97),  INT8_C(  32),  INT8_C(   0),  INT8_C( 112), -INT8_C(  65), -INT8_C(   1),  INT8_C(   7),  INT8_C(  48), -INT8_C(  81),  INT8_C(  63), -INT8_C(   1), -INT8_C(   5), -INT8_C(  92), -INT8_C(  94),  INT8_C(  85), -INT8_C( 120),
+        -INT8_C( 126), -INT8_C(  70), -INT8_C(  21), -INT8_C(   1), -INT8_C(  19), -INT8_C(  60),  INT8_C(   0), -INT8_C( 121), -INT8_C(  42),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50), -INT8_C(   1),  INT8_C(  95),  INT8_C(  42), -INT8_C(  93) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    75904898) } },
+    { { -INT32_C(     4195077),  INT32_C(    68157441),  INT32_C(   570425348), -INT32_C(    65100775), -INT32_C(  2103228831), -INT32_C(  1039654848),  INT32_C(   678534252), -INT32_C(    67141701) },
+      UINT8_C(216),
+      {  INT8_C( 103),  INT8_C( 122), -INT8_C( 113),  INT8_C(  68), -INT8_C(  70), -INT8_C(  87),  INT8_C(  82),  INT8_C(  65),  INT8_C(   8), -INT8_C( 104),  INT8_C(  88), -INT8_C(  45),  INT8_C(  65), -INT8_C(  96), -INT8_C(  24),  INT8_C( 116),
+         INT8_C(   4),  INT8_C(  32), -INT8_C(   1), -INT8_C(  75), -INT8_C( 103),  INT8_C(   8), -INT8_C(  17),  INT8_C(  86),  INT8_C(  13),      INT8_MIN, -INT8_C(  81), -INT8_C(  67),  INT8_C(   0), -INT8_C(  21), -INT8_C(  13),  INT8_C(   0) },
+      {      INT8_MIN, -INT8_C(  52),      INT8_MAX,  INT8_C(   0),  INT8_C(  24), -INT8_C(   1),  INT8_C(  46), -INT8_C(  72), -INT8_C(   9), -INT8_C(   1),  INT8_C(   4), -INT8_C(  28),  INT8_C(  81),  INT8_C(  59), -INT8_C(  11), -INT8_C(  53),
+         INT8_C(  72),  INT8_C( 122), -INT8_C(  67), -INT8_C( 111),  INT8_C(  98), -INT8_C( 115), -INT8_C(   1), -INT8_C(  64), -INT8_C(   2),  INT8_C(   8), -INT8_C( 106), -INT8_C(   1), -INT8_C( 126),      INT8_MIN,  INT8_C(  16), -INT8_C(  17) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    65094770), -INT32_C(  2103261815),  INT32_C(           0),  INT32_C(   678516511), -INT32_C(    67167893) } },
+    { { -INT32_C(     1200385), -INT32_C(  2130704384), -INT32_C(  1554211430), -INT32_C(         257), -INT32_C(  2141543826), -INT32_C(  1155662643), -INT32_C(         257),  INT32_C(  1164308269) },
+      UINT8_C(109),
+      {  INT8_C(   2),  INT8_C(  17),  INT8_C(   0),  INT8_C(  95), -INT8_C( 108),  INT8_C(  42), -INT8_C(   3), -INT8_C(  67),  INT8_C(   0),  INT8_C(   8),  INT8_C(  18), -INT8_C(  97), -INT8_C(  96),  INT8_C(   0),  INT8_C( 122), -INT8_C(  64),
+        -INT8_C(  28),  INT8_C(  15),  INT8_C(  94), -INT8_C(  21),  INT8_C(  74),  INT8_C(  58), -INT8_C(  81),  INT8_C(   0), -INT8_C(  13),  INT8_C( 114),  INT8_C(  14), -INT8_C(   9), -INT8_C(   7),  INT8_C(  37), -INT8_C(  48), -INT8_C(  66) },
+      { -INT8_C(   1),  INT8_C(  55),  INT8_C(  34),  INT8_C(  58), -INT8_C(   1), -INT8_C(  93),  INT8_C( 111), -INT8_C(  54),  INT8_C(  60),  INT8_C(  48), -INT8_C( 108),  INT8_C(  75),  INT8_C(  55),  INT8_C(  65),  INT8_C(   0),  INT8_C(  66),
+             INT8_MAX, -INT8_C(  35), -INT8_C( 104),  INT8_C(  40), -INT8_C(  29), -INT8_C(   1),  INT8_C(   2),  INT8_C(  35), -INT8_C(   9), -INT8_C(  33),  INT8_C( 125),  INT8_C(   0), -INT8_C(  92),  INT8_C(  72), -INT8_C(  78), -INT8_C(  65) },
+      { -INT32_C(     1193942),  INT32_C(           0), -INT32_C(  1554201065),  INT32_C(       21215),  INT32_C(           0), -INT32_C(  1155664497), -INT32_C(        4456),  INT32_C(           0) } },
+    { {  INT32_C(   202375168), -INT32_C(   148828191),  INT32_C(     1638416), -INT32_C(   672127899),  INT32_C(     1220736), -INT32_C(    69019368),  INT32_C(  1396699918),  INT32_C(   431311644) },
+      UINT8_C(146),
+      { -INT8_C(  48), -INT8_C(  65),  INT8_C(   2),  INT8_C(   0),  INT8_C(  64),  INT8_C(  80), -INT8_C(   5),  INT8_C(   0),  INT8_C( 107),  INT8_C(  13),      INT8_MIN,  INT8_C( 113),  INT8_C( 119), -INT8_C(  47),  INT8_C(   2),  INT8_C(  16),
+        -INT8_C(   9),  INT8_C(   0), -INT8_C(  63),  INT8_C(  41),  INT8_C(  37), -INT8_C(  41),  INT8_C(   8), -INT8_C(   2), -INT8_C(   1),  INT8_C(   8), -INT8_C(  56), -INT8_C( 127), -INT8_C(  37),  INT8_C( 113),  INT8_C(   8),  INT8_C(   0) },
+      { -INT8_C(   9),  INT8_C( 111),  INT8_C( 120),  INT8_C( 101),  INT8_C(  65), -INT8_C(  40),  INT8_C(  95), -INT8_C(  46),  INT8_C(  47), -INT8_C(   3), -INT8_C(  43), -INT8_C(   3),  INT8_C( 102), -INT8_C(  59), -INT8_C(  99),  INT8_C(   4),
+         INT8_C(  18), -INT8_C(  65), -INT8_C(  25), -INT8_C(  59),  INT8_C(  29), -INT8_C(  66), -INT8_C(   1),  INT8_C(  25), -INT8_C(  99),  INT8_C(   0), -INT8_C(   1), -INT8_C(  81), -INT8_C(   1), -INT8_C(  65),  INT8_C(  58),  INT8_C(  62) },
+      {  INT32_C(           0), -INT32_C(   148803386),  INT32_C(           0),  INT32_C(           0),  INT32_C(     1217938),  INT32_C(           0),  INT32_C(           0),  INT32_C(   431304544) } },
+    { { -INT32_C(     1638467), -INT32_C(    71565313), -INT32_C(  2070471360), -INT32_C(   574619650), -INT32_C(      131073),  INT32_C(   260750396),  INT32_C(     4236288),  INT32_C(  1407435759) },
+      UINT8_C(113),
+      {  INT8_C( 109),  INT8_C(  85), -INT8_C(  18), -INT8_C( 104),  INT8_C(  29),  INT8_C(  89),  INT8_C(   0), -INT8_C(   3), -INT8_C(  33), -INT8_C(   1),  INT8_C(   0), -INT8_C(  84), -INT8_C(  82), -INT8_C(  18),  INT8_C(  65), -INT8_C(   1),
+        -INT8_C(  47), -INT8_C(  90),  INT8_C(   2), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C( 125), -INT8_C(  97), -INT8_C(  81),  INT8_C(   0),  INT8_C(  64), -INT8_C(  19), -INT8_C( 112),  INT8_C(  68), -INT8_C(  77),  INT8_C(  57) },
+      {  INT8_C(  45),  INT8_C(  49),  INT8_C(  15),  INT8_C(  10),  INT8_C(   0), -INT8_C(   1),  INT8_C(  64), -INT8_C( 100),  INT8_C(   5),  INT8_C(   0),  INT8_C(  16),      INT8_MIN, -INT8_C(  57), -INT8_C(  95), -INT8_C(   2), -INT8_C(   1),
+        -INT8_C(  17),  INT8_C(  32),  INT8_C(  28),  INT8_C(  64),  INT8_C(  41),  INT8_C(  96),  INT8_C(  82),  INT8_C(   0),  INT8_C(  99), -INT8_C(   1), -INT8_C(  88), -INT8_C(  65), -INT8_C(   1), -INT8_C(   1),  INT8_C(  32), -INT8_C(  87) },
+      { -INT32_C(     1624307),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(      112938),  INT32_C(   260761138),  INT32_C(     4232576),  INT32_C(           0) } },
+    { { -INT32_C(   135266305), -INT32_C(     4457985), -INT32_C(    67125257),  INT32_C(    67143720),  INT32_C(      526352), -INT32_C(    50331653), -INT32_C(   964811654), -INT32_C(  2147090432) },
+      UINT8_C(148),
+      {  INT8_C(  67),  INT8_C(  49), -INT8_C( 101),  INT8_C(   2),  INT8_C(  64), -INT8_C(   1),  INT8_C(   0), -INT8_C(   9), -INT8_C( 127),  INT8_C(  32), -INT8_C(  94),  INT8_C( 110), -INT8_C(  17), -INT8_C(  28), -INT8_C(  67), -INT8_C(   5),
+         INT8_C(  70), -INT8_C(  73),  INT8_C(   0), -INT8_C( 115),  INT8_C(   2), -INT8_C(   2), -INT8_C(  60), -INT8_C(  59), -INT8_C(   7), -INT8_C(  89), -INT8_C(  65), -INT8_C(   3),  INT8_C(   1), -INT8_C(   7),  INT8_C(  53), -INT8_C(   3) },
+      { -INT8_C(   3), -INT8_C(  17),  INT8_C(   0),  INT8_C(  84), -INT8_C(   1),  INT8_C(   2), -INT8_C( 107),  INT8_C( 109), -INT8_C(  61),  INT8_C(   4), -INT8_C(  33), -INT8_C(  75),      INT8_MIN,  INT8_C(   0),  INT8_C( 110), -INT8_C(   9),
+        -INT8_C( 120),  INT8_C(   2),  INT8_C(  26),  INT8_C(  24), -INT8_C(   6),  INT8_C(   1),  INT8_C( 111), -INT8_C(   9), -INT8_C(  17),  INT8_C( 108), -INT8_C(   1),  INT8_C(   8), -INT8_C(  51),  INT8_C(   1), -INT8_C(  10),  INT8_C(  98) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(    67146594),  INT32_C(           0),  INT32_C(      521702),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147065970) } },
+    { { -INT32_C(  1610639490),  INT32_C(  1727314998),  INT32_C(   318768160),  INT32_C(  1280880407),  INT32_C(   753345923), -INT32_C(  1352794113),  INT32_C(    71311361),  INT32_C(  1026415995) },
+      UINT8_C(102),
+      { -INT8_C(  44), -INT8_C( 108), -INT8_C( 115), -INT8_C(   1),  INT8_C(  76), -INT8_C(   9), -INT8_C(  20), -INT8_C(   1), -INT8_C(   5), -INT8_C(   1),  INT8_C(  24),  INT8_C(   0), -INT8_C(  93),  INT8_C( 111),  INT8_C(  74), -INT8_C( 101),
+        -INT8_C(   7), -INT8_C( 123), -INT8_C(   1),  INT8_C( 119),  INT8_C(  96),  INT8_C(  77), -INT8_C(  76), -INT8_C( 116), -INT8_C( 122), -INT8_C(   9), -INT8_C(  51), -INT8_C( 125), -INT8_C(   1), -INT8_C(  38),      INT8_MIN, -INT8_C(  54) },
+      { -INT8_C(   1),  INT8_C(   0), -INT8_C(  95), -INT8_C(  17),  INT8_C( 125),  INT8_C(  46), -INT8_C(   1), -INT8_C( 109),  INT8_C(   8),  INT8_C( 102),  INT8_C(  16), -INT8_C(  65),  INT8_C(  41), -INT8_C(   2), -INT8_C(   1),  INT8_C( 123),
+         INT8_C(   8),  INT8_C(  98), -INT8_C(  80),  INT8_C( 119), -INT8_C(  67),      INT8_MIN, -INT8_C(  81),  INT8_C(  10), -INT8_C(  62), -INT8_C( 109),  INT8_C(  24), -INT8_C(   1),  INT8_C(   0),  INT8_C(  56),  INT8_C(  80),  INT8_C(  56) },
+      {  INT32_C(           0),  INT32_C(  1727307829),  INT32_C(   318796562),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1352823581),  INT32_C(    71280919),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpbusd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int8_t a[64];
+    const int8_t b[64];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   411369522),  INT32_C(  2080602749),  INT32_C(  1848268744),  INT32_C(  1973678848),  INT32_C(   614530835), -INT32_C(   436208227),  INT32_C(  2026030691), -INT32_C(  1744830464),
+         INT32_C(    86967937),  INT32_C(   731862916),  INT32_C(     4210834),  INT32_C(    68168704), -INT32_C(        5145),  INT32_C(   281284608), -INT32_C(  1843912019),  INT32_C(  2147384797) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   411500082),  INT32_C(  2080732289),  INT32_C(  1848138184),  INT32_C(  1973808388),  INT32_C(   614400275), -INT32_C(   436078687),  INT32_C(  2025900131), -INT32_C(  1744700924),
+         INT32_C(    86837377),  INT32_C(   731992456),  INT32_C(     4080274),  INT32_C(    68298244), -INT32_C(      135705),  INT32_C(   281414148), -INT32_C(  1844042579), -INT32_C(  2147452959) } },
+    { { -INT32_C(  1244341523),  INT32_C(        9480),  INT32_C(  1841515009),  INT32_C(     2100224), -INT32_C(  2074553118),  INT32_C(   268435472), -INT32_C(   536876305), -INT32_C(  2147479552),
+         INT32_C(  1884279293),  INT32_C(  1391550154),  INT32_C(  1902350947),  INT32_C(        4608), -INT32_C(        1537),  INT32_C(  1465061471), -INT32_C(   467453429), -INT32_C(     4653075) },
+      {  INT8_C( 108),  INT8_C(  18),  INT8_C(  14),  INT8_C(   0), -INT8_C(  58),  INT8_C( 102), -INT8_C(  81),  INT8_C(  88),  INT8_C(  79),  INT8_C( 117), -INT8_C(   1), -INT8_C(   9), -INT8_C(  17),  INT8_C(  20), -INT8_C(  65),  INT8_C( 101),
+        -INT8_C(   1),  INT8_C(   4),  INT8_C(   0), -INT8_C(  71),      INT8_MAX, -INT8_C(  13), -INT8_C(  14),  INT8_C(  16),  INT8_C(  80),  INT8_C(   3), -INT8_C(  11),  INT8_C(   8),  INT8_C(   0), -INT8_C(  38),  INT8_C(   9),      INT8_MAX,
+        -INT8_C(   1), -INT8_C(  77),  INT8_C(   6), -INT8_C(  37),  INT8_C(  71), -INT8_C(  68),  INT8_C(  44),  INT8_C(  14), -INT8_C(   3),  INT8_C( 126),  INT8_C(  50),  INT8_C(   0), -INT8_C(  73), -INT8_C(   7), -INT8_C( 117), -INT8_C(   3),
+         INT8_C(   8),  INT8_C(  32),  INT8_C(  80),  INT8_C(  91),  INT8_C( 108),  INT8_C( 104), -INT8_C(  68), -INT8_C(  39),  INT8_C(  37),  INT8_C(  47),  INT8_C(  83), -INT8_C( 125),  INT8_C(  21),  INT8_C(  14),  INT8_C(  63),  INT8_C(   0) },
+      {  INT8_C(  36),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0), -INT8_C(  26), -INT8_C(   5),  INT8_C( 111),  INT8_C(   0),  INT8_C(  18), -INT8_C( 107),  INT8_C( 120), -INT8_C( 124), -INT8_C(   1), -INT8_C(   2),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(  64),      INT8_MIN, -INT8_C(  56), -INT8_C(  53),  INT8_C(  53),  INT8_C( 118),  INT8_C( 121), -INT8_C(  60), -INT8_C(  63), -INT8_C(   1), -INT8_C(  44),      INT8_MAX, -INT8_C(   1), -INT8_C(   3),
+         INT8_C(   8),  INT8_C(  72),  INT8_C(  12),  INT8_C( 110),  INT8_C(  85),  INT8_C(   8),  INT8_C(  16),  INT8_C(  89), -INT8_C(  96),  INT8_C( 114), -INT8_C(  53),  INT8_C( 118),  INT8_C(  92),  INT8_C(   1), -INT8_C(   1),  INT8_C(   1),
+         INT8_C(   8),  INT8_C(  45),  INT8_C(  13),  INT8_C(   0),  INT8_C( 115), -INT8_C(   4), -INT8_C(  54), -INT8_C(   2), -INT8_C(   3), -INT8_C(   5), -INT8_C(  94),  INT8_C( 107), -INT8_C(  33), -INT8_C(   1),  INT8_C(  81),  INT8_C( 119) },
+      { -INT32_C(  1244335907),  INT32_C(        5282),  INT32_C(  1841501939),  INT32_C(     2126031), -INT32_C(  2074577057),  INT32_C(   268430195), -INT32_C(   536882248), -INT32_C(  2147452256),
+         INT32_C(  1884318383),  INT32_C(  1391559643),  INT32_C(  1902338373),  INT32_C(       21807),  INT32_C(        1007),  INT32_C(  1465062889), -INT32_C(   467447560), -INT32_C(     4648679) } },
+    { { -INT32_C(         273), -INT32_C(  2099195393),  INT32_C(   294487339), -INT32_C(     8390658), -INT32_C(      561154),  INT32_C(           0), -INT32_C(  1219921656), -INT32_C(  1209009153),
+         INT32_C(    84164026), -INT32_C(     8430179), -INT32_C(  2146697216), -INT32_C(      263169), -INT32_C(   984680711),  INT32_C(  1098907666),  INT32_C(      131072), -INT32_C(     2099238) },
+      { -INT8_C(  34), -INT8_C(  23),      INT8_MAX,  INT8_C(   0),  INT8_C(   0), -INT8_C(  28), -INT8_C(  26),  INT8_C(   4),  INT8_C(  63),  INT8_C(   0),  INT8_C(   0), -INT8_C(   3),  INT8_C(  16),  INT8_C(   0), -INT8_C( 110), -INT8_C(  46),
+        -INT8_C(  17), -INT8_C(  21), -INT8_C(   3), -INT8_C(  30), -INT8_C(  25),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),      INT8_MAX,  INT8_C(  72),  INT8_C(  28), -INT8_C( 104),  INT8_C(  29), -INT8_C(   3),      INT8_MAX,  INT8_C(  16),
+        -INT8_C(  10), -INT8_C(  51),  INT8_C(  70), -INT8_C(   1), -INT8_C(  34), -INT8_C(   1),  INT8_C(   1),  INT8_C(  32),  INT8_C(  32), -INT8_C(  65),  INT8_C(  19),  INT8_C(   0), -INT8_C(   5), -INT8_C( 126), -INT8_C(  45),  INT8_C(   0),
+        -INT8_C(  35),  INT8_C( 106), -INT8_C(  81), -INT8_C(   1),  INT8_C(   0),  INT8_C(  98),  INT8_C( 117),  INT8_C(   0),  INT8_C(  40), -INT8_C(  26),      INT8_MAX,  INT8_C(   4),  INT8_C(   9), -INT8_C(   1),  INT8_C(  79),  INT8_C(   0) },
+      {      INT8_MIN,  INT8_C(   0), -INT8_C(  59), -INT8_C(  18),  INT8_C(  45), -INT8_C(  21),  INT8_C(   0),  INT8_C( 111), -INT8_C(  80),  INT8_C(   8),  INT8_C(   1), -INT8_C(  65), -INT8_C(   8), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(  16),  INT8_C(  18), -INT8_C(   6), -INT8_C(  39), -INT8_C(  15),  INT8_C(   0),  INT8_C( 118),  INT8_C(  27), -INT8_C(  23),  INT8_C(   1),  INT8_C(  34), -INT8_C(   1), -INT8_C(   1),  INT8_C(  85),  INT8_C(  63),
+         INT8_C(  15),  INT8_C( 109), -INT8_C(   1),  INT8_C(  32),  INT8_C(  11),  INT8_C(  85), -INT8_C(  64),  INT8_C(  41),  INT8_C(   0),  INT8_C(   8),  INT8_C(  16),  INT8_C(  76), -INT8_C(  17),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50),
+         INT8_C(   6), -INT8_C( 120), -INT8_C(  21),  INT8_C( 116), -INT8_C(  72),  INT8_C(  94),  INT8_C(  42),      INT8_MAX,  INT8_C(  16), -INT8_C(  79),  INT8_C(   4),  INT8_C(  62), -INT8_C(  73),  INT8_C( 122), -INT8_C(   1),  INT8_C(   0) },
+      { -INT32_C(       36182), -INT32_C(  2099199737),  INT32_C(   294465854), -INT32_C(     8390996), -INT32_C(      561716), -INT32_C(        9009), -INT32_C(  1219914687), -INT32_C(  1208997632),
+         INT32_C(    84198151), -INT32_C(     8404814), -INT32_C(  2146695384), -INT32_C(      267436), -INT32_C(   984666200),  INT32_C(  1098921792),  INT32_C(      114298), -INT32_C(     2068864) } },
+    { { -INT32_C(   268435521), -INT32_C(   958609805), -INT32_C(    16909505), -INT32_C(   469938662), -INT32_C(  1496586578),  INT32_C(   674529883), -INT32_C(   671091489),  INT32_C(   976597235),
+        -INT32_C(       66561), -INT32_C(  1076695089), -INT32_C(  2146664448), -INT32_C(  2130706176),  INT32_C(  1443883047),  INT32_C(   451198333),  INT32_C(     8421376), -INT32_C(  1125155331) },
+      {  INT8_C(  14), -INT8_C(  86),  INT8_C(  64),  INT8_C(   4), -INT8_C(  21), -INT8_C(   1), -INT8_C(  92),  INT8_C( 100),  INT8_C(  42), -INT8_C(  41), -INT8_C(  41), -INT8_C(   2),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0), -INT8_C(  82),
+        -INT8_C(  17), -INT8_C(  22),  INT8_C(  15), -INT8_C(   1),  INT8_C( 110),  INT8_C(   0), -INT8_C(  34), -INT8_C(  17), -INT8_C(  55), -INT8_C(  83), -INT8_C(  81),  INT8_C(   4), -INT8_C(   9),  INT8_C(  48),  INT8_C( 109), -INT8_C(  15),
+        -INT8_C(  19), -INT8_C(  15), -INT8_C(   1),  INT8_C(  16),  INT8_C(   0),  INT8_C(  31),  INT8_C(   0), -INT8_C(  11), -INT8_C(  50), -INT8_C( 124), -INT8_C(  43),  INT8_C(   0), -INT8_C( 115), -INT8_C(   4), -INT8_C(   1), -INT8_C(   3),
+         INT8_C(  16),  INT8_C(  24),  INT8_C(   0), -INT8_C(   1), -INT8_C(  33), -INT8_C(  10),  INT8_C(   1),  INT8_C(  38), -INT8_C(  73),  INT8_C( 113), -INT8_C(  17),  INT8_C(  31), -INT8_C(  18),  INT8_C(  83), -INT8_C(  34),  INT8_C(   0) },
+      { -INT8_C( 117), -INT8_C(  49), -INT8_C(  41),  INT8_C( 125),  INT8_C(   0),  INT8_C( 119),  INT8_C(  12),  INT8_C(  57),  INT8_C(   2),  INT8_C(  88),  INT8_C(  64), -INT8_C(  79),      INT8_MAX, -INT8_C(  17),  INT8_C(  14), -INT8_C(   9),
+         INT8_C(  54), -INT8_C( 105), -INT8_C(   5), -INT8_C(   3),  INT8_C(  23), -INT8_C(  17),  INT8_C(   0), -INT8_C( 101),  INT8_C(  35), -INT8_C( 119),  INT8_C(  45), -INT8_C(   9), -INT8_C(   1),  INT8_C(  10),  INT8_C( 104),  INT8_C(  77),
+         INT8_C(   0), -INT8_C(  56),  INT8_C(  92),  INT8_C(  16),  INT8_C(  35),      INT8_MAX,  INT8_C(   3), -INT8_C(  33),  INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(  24),  INT8_C(   0),  INT8_C(   9), -INT8_C(  62), -INT8_C(  84),
+         INT8_C(  74),  INT8_C( 105), -INT8_C(  17),  INT8_C(  98),  INT8_C(  18), -INT8_C(   1),  INT8_C(   1), -INT8_C(   8), -INT8_C(   1), -INT8_C( 126), -INT8_C(  67), -INT8_C(  61), -INT8_C(   1), -INT8_C(  82),  INT8_C(  27), -INT8_C(   1) },
+      { -INT32_C(   268447613), -INT32_C(   958571792), -INT32_C(    16896807), -INT32_C(   469941316), -INT32_C(  1496599082),  INT32_C(   674508274), -INT32_C(   671097202),  INT32_C(   976627361),
+        -INT32_C(       56341), -INT32_C(  1076699237), -INT32_C(  2146651477), -INT32_C(  2130740970),  INT32_C(  1443911741),  INT32_C(   451201798),  INT32_C(     8389051), -INT32_C(  1125156381) } },
+    { {  INT32_C(    14600890),  INT32_C(   674082797), -INT32_C(  1108345873),  INT32_C(   336068613),  INT32_C(     4194820),  INT32_C(  2104559857), -INT32_C(      786497), -INT32_C(     8658945),
+        -INT32_C(    67108866), -INT32_C(   805314598), -INT32_C(  1165700544), -INT32_C(  1994249148),  INT32_C(     2195456),  INT32_C(     8454160), -INT32_C(    67158277), -INT32_C(   711354398) },
+      {  INT8_C(  92), -INT8_C( 115), -INT8_C(  77), -INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   1),  INT8_C(  17),  INT8_C(   8), -INT8_C(   1),  INT8_C(   0), -INT8_C( 103),  INT8_C(  45),  INT8_C(   0), -INT8_C(   3),  INT8_C( 113),
+        -INT8_C(  65),  INT8_C(  75),  INT8_C(   3),  INT8_C(   0), -INT8_C(   1), -INT8_C(  75), -INT8_C(  17), -INT8_C(  65),  INT8_C(   0), -INT8_C( 103), -INT8_C(   5),  INT8_C(  73),  INT8_C(  32), -INT8_C(  21),  INT8_C(  66), -INT8_C(  60),
+         INT8_C(  73), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(  22),  INT8_C(   0),  INT8_C(  65),  INT8_C( 111), -INT8_C(  29), -INT8_C( 124),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C( 119),  INT8_C(  41), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(  77), -INT8_C(  99), -INT8_C(   3),  INT8_C(  39), -INT8_C( 120), -INT8_C(  97), -INT8_C(  17),  INT8_C(  64), -INT8_C(  26),  INT8_C(  69),  INT8_C(   0), -INT8_C(  65), -INT8_C(   2), -INT8_C(  43), -INT8_C(   1) },
+      { -INT8_C(  37),  INT8_C(   0),  INT8_C( 121),  INT8_C(  26),  INT8_C(  17), -INT8_C(   1), -INT8_C(   1),  INT8_C(  91), -INT8_C(  11), -INT8_C(  35), -INT8_C(   1), -INT8_C(   1),  INT8_C(  59),  INT8_C(  16), -INT8_C( 124),  INT8_C(  65),
+        -INT8_C(  61), -INT8_C(  11), -INT8_C(   2),  INT8_C(  10),  INT8_C(   7), -INT8_C( 104),  INT8_C(   0), -INT8_C(  21), -INT8_C(  14),  INT8_C(  14),  INT8_C(  95),  INT8_C(   0),  INT8_C(  88),  INT8_C(  32), -INT8_C(   9), -INT8_C(   1),
+         INT8_C(   1),  INT8_C(  12),  INT8_C(  93),  INT8_C( 118),  INT8_C(  20), -INT8_C(  33), -INT8_C(   4),  INT8_C(   2),  INT8_C(  10), -INT8_C(  17),  INT8_C(  24), -INT8_C(  11),      INT8_MAX, -INT8_C(   1),  INT8_C(  76),  INT8_C(   0),
+         INT8_C(  78), -INT8_C(   1), -INT8_C(  54),  INT8_C(  99),  INT8_C(   0),  INT8_C(  58),  INT8_C(  22), -INT8_C(   1),  INT8_C(  35), -INT8_C(  26),  INT8_C(   2),  INT8_C( 117), -INT8_C(  69), -INT8_C(   7),  INT8_C(   0), -INT8_C(   3) },
+      {  INT32_C(    14625775),  INT32_C(   674083852), -INT32_C(  1108355039),  INT32_C(   336047241),  INT32_C(     4182338),  INT32_C(  2104538807), -INT32_C(      760510), -INT32_C(     8649399),
+        -INT32_C(    67082018), -INT32_C(   805314196), -INT32_C(  1165703323), -INT32_C(  1994246169),  INT32_C(     2211846),  INT32_C(     8465307), -INT32_C(    67161879), -INT32_C(   711370120) } },
+    { {  INT32_C(   100663428), -INT32_C(  1073815617),  INT32_C(  2113929213), -INT32_C(   624511098),  INT32_C(  2113886207),  INT32_C(   356375971),  INT32_C(  1107206407), -INT32_C(   940081153),
+         INT32_C(   282469102),  INT32_C(  1850540961), -INT32_C(  2147450365), -INT32_C(     4259873), -INT32_C(  1057231693),  INT32_C(  1077936129), -INT32_C(  2147483622), -INT32_C(  2147483517) },
+      {  INT8_C( 119), -INT8_C(  11),  INT8_C(   0), -INT8_C(   4), -INT8_C( 112), -INT8_C( 114), -INT8_C(  15),  INT8_C(   0), -INT8_C(  33),  INT8_C( 122), -INT8_C(  56),  INT8_C(  83), -INT8_C(  34), -INT8_C(   1),  INT8_C(  72),  INT8_C( 119),
+         INT8_C(  42),      INT8_MAX,  INT8_C(  44), -INT8_C(  38),  INT8_C(  32),  INT8_C(   1), -INT8_C(   1),  INT8_C(   8),  INT8_C(   1),  INT8_C(  45), -INT8_C(   3), -INT8_C(   2),  INT8_C( 107),  INT8_C(  16),  INT8_C(  76),  INT8_C(  64),
+         INT8_C(   0),  INT8_C(  16), -INT8_C(  50),  INT8_C(  13),      INT8_MIN,  INT8_C(   0),  INT8_C(   0), -INT8_C(  65), -INT8_C(  30), -INT8_C(   2), -INT8_C(  45),  INT8_C(  10),  INT8_C( 105), -INT8_C( 109), -INT8_C(  15),  INT8_C(  36),
+        -INT8_C(  13), -INT8_C(  49),  INT8_C(   0), -INT8_C( 120),  INT8_C(  60), -INT8_C(  61),  INT8_C(  27), -INT8_C( 112),  INT8_C( 124),  INT8_C(  21), -INT8_C(  95), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(  87), -INT8_C( 127) },
+      { -INT8_C( 101), -INT8_C(  45), -INT8_C( 120), -INT8_C(  65),  INT8_C(  15), -INT8_C(  37),  INT8_C(  71),  INT8_C(   8),  INT8_C(   1), -INT8_C(  93), -INT8_C(  55), -INT8_C(  33), -INT8_C(   9),  INT8_C( 123), -INT8_C( 110),  INT8_C(   6),
+         INT8_C( 105), -INT8_C(  58), -INT8_C( 103), -INT8_C(   7),  INT8_C(   0),  INT8_C(  49), -INT8_C(  52),  INT8_C(   0), -INT8_C(  75), -INT8_C(  27), -INT8_C(  28),  INT8_C(  52),  INT8_C(   0),  INT8_C(  32), -INT8_C(  77), -INT8_C(  48),
+         INT8_C(   0),  INT8_C( 125),  INT8_C(   1), -INT8_C(   1), -INT8_C(  74),  INT8_C(  36),  INT8_C(  13),      INT8_MIN,  INT8_C(  12),  INT8_C(  32), -INT8_C(  52),  INT8_C(  32),  INT8_C(  16),  INT8_C(   0),  INT8_C(  34),  INT8_C(  16),
+         INT8_C(  98),  INT8_C(  89),  INT8_C( 112),  INT8_C( 114), -INT8_C(  73), -INT8_C( 111),      INT8_MIN,  INT8_C( 105),  INT8_C(  74), -INT8_C(   2), -INT8_C(  12), -INT8_C(   5), -INT8_C(   1),  INT8_C(  30), -INT8_C(  53), -INT8_C(   1) },
+      {  INT32_C(   100624004), -INT32_C(  1073801600),  INT32_C(  2113904351), -INT32_C(   624488937),  INT32_C(  2113877193),  INT32_C(   356362760),  INT32_C(  1107211241), -INT32_C(   940089565),
+         INT32_C(   282471295),  INT32_C(  1850507041), -INT32_C(  2147450177), -INT32_C(     4249423), -INT32_C(  1057173952),  INT32_C(  1077921768), -INT32_C(  2147477695), -INT32_C(  2147480607) } },
+    { {  INT32_C(  1536024822),  INT32_C(  1840163358),  INT32_C(   812015159), -INT32_C(  2102011432),  INT32_C(   729377951), -INT32_C(    35717169),  INT32_C(     5246978),  INT32_C(   857174668),
+        -INT32_C(   268501057), -INT32_C(     5243393), -INT32_C(  1145051176), -INT32_C(  1545274934), -INT32_C(    26771459), -INT32_C(   268451881),  INT32_C(     9046081), -INT32_C(  2147479552) },
+      { -INT8_C(   9), -INT8_C( 119),  INT8_C(  98), -INT8_C(   2), -INT8_C(  65),  INT8_C( 126), -INT8_C(  96), -INT8_C(  82),  INT8_C(   6),  INT8_C(  64),  INT8_C(  36), -INT8_C(  17),  INT8_C(  20), -INT8_C(  12), -INT8_C(   1),  INT8_C( 110),
+        -INT8_C(  38),  INT8_C(  59), -INT8_C(  65), -INT8_C(   1), -INT8_C(  82),  INT8_C(  17),  INT8_C( 120), -INT8_C(   1),  INT8_C(   5), -INT8_C(  89),  INT8_C(  12), -INT8_C(   1), -INT8_C(   1),  INT8_C(   4),  INT8_C(   0),  INT8_C(  45),
+         INT8_C(  64),  INT8_C( 105), -INT8_C(   5),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),      INT8_MAX,  INT8_C( 106),  INT8_C(  79), -INT8_C( 100), -INT8_C( 123), -INT8_C(  33),  INT8_C(  31),
+         INT8_C(  74),  INT8_C( 121),  INT8_C( 102),  INT8_C(   0),  INT8_C(  32),  INT8_C(  48),  INT8_C(   0),  INT8_C(  47), -INT8_C(  84),  INT8_C(   0),  INT8_C(  67),  INT8_C(   8),  INT8_C(   0), -INT8_C(  49), -INT8_C(  13),  INT8_C(   8) },
+      {      INT8_MIN,  INT8_C(   8), -INT8_C(  12),  INT8_C( 121),  INT8_C(  37),  INT8_C(  32), -INT8_C(  99), -INT8_C(  33),  INT8_C(   8),  INT8_C(   0),  INT8_C(  85),  INT8_C( 109), -INT8_C(  30),  INT8_C(   0), -INT8_C( 112), -INT8_C(  69),
+         INT8_C(   0), -INT8_C( 107),  INT8_C(  36),      INT8_MIN,  INT8_C(  17),  INT8_C(  16), -INT8_C(  95), -INT8_C( 109),  INT8_C(  83),  INT8_C(   2), -INT8_C(  65),  INT8_C(  36),  INT8_C(  70),  INT8_C(  42), -INT8_C(   1),  INT8_C(  97),
+         INT8_C(  18), -INT8_C(  59), -INT8_C(  38),  INT8_C(  94), -INT8_C(  17), -INT8_C(  18),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(  11),  INT8_C( 111),  INT8_C(   0), -INT8_C( 121), -INT8_C(   5),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   0),      INT8_MAX, -INT8_C(  22),  INT8_C(  24), -INT8_C(  14),  INT8_C(  31),  INT8_C(   9),  INT8_C(   0),  INT8_C(  23), -INT8_C(  73),  INT8_C(   0),  INT8_C(  83),  INT8_C( 126),  INT8_C(   4),  INT8_C(   0) },
+      {  INT32_C(  1536023860),  INT32_C(  1840152875),  INT32_C(   812044318), -INT32_C(  2102048182),  INT32_C(   729345874), -INT32_C(    35753134),  INT32_C(     5256127),  INT32_C(   857197051),
+        -INT32_C(   268515638), -INT32_C(     5243529), -INT32_C(  1145041241), -INT32_C(  1545292142), -INT32_C(    26758431), -INT32_C(   268451362),  INT32_C(     9041190), -INT32_C(  2147452498) } },
+    { { -INT32_C(   268587013),  INT32_C(   306674668),  INT32_C(          10),  INT32_C(    17973248),  INT32_C(   511035395), -INT32_C(  1264347205), -INT32_C(   479287051),  INT32_C(   355919010),
+        -INT32_C(  1091043329), -INT32_C(      524321),  INT32_C(      233504), -INT32_C(  2079637210),  INT32_C(   271056899),  INT32_C(   411307228),  INT32_C(  2012610555), -INT32_C(    25182209) },
+      { -INT8_C(   5),  INT8_C( 121),  INT8_C(  48), -INT8_C(  89),  INT8_C( 111), -INT8_C(  33),      INT8_MAX, -INT8_C( 127), -INT8_C(  81), -INT8_C(  33),  INT8_C(  64),  INT8_C(   0), -INT8_C(   3), -INT8_C(   9),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(  65), -INT8_C(   4), -INT8_C(   1),      INT8_MIN, -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32), -INT8_C(  65), -INT8_C(  32), -INT8_C(  49),  INT8_C(  31),  INT8_C( 105), -INT8_C(  69),  INT8_C(   3), -INT8_C(  44),
+             INT8_MAX, -INT8_C(  49),  INT8_C(  51), -INT8_C(  66), -INT8_C(  65),  INT8_C(  80),      INT8_MAX,  INT8_C( 123), -INT8_C(  35),  INT8_C(  17),  INT8_C(   9), -INT8_C(   3), -INT8_C(  17),  INT8_C(  48), -INT8_C(  25), -INT8_C( 105),
+        -INT8_C(  99), -INT8_C( 127), -INT8_C(   1),  INT8_C(   1), -INT8_C(  67), -INT8_C(  18),  INT8_C(   0),  INT8_C(   0), -INT8_C( 105),  INT8_C(  34),  INT8_C(  31),  INT8_C(   0),  INT8_C(   0), -INT8_C(  69), -INT8_C(  75), -INT8_C( 120) },
+      { -INT8_C(  63),  INT8_C(  64), -INT8_C(  41),  INT8_C(  64),  INT8_C(  20),  INT8_C(  80), -INT8_C(   1), -INT8_C(  60), -INT8_C(  20),  INT8_C( 106), -INT8_C(   5),  INT8_C(  27),  INT8_C(  11), -INT8_C(   1), -INT8_C(  92),  INT8_C(  69),
+        -INT8_C(  72),  INT8_C(   0), -INT8_C( 108), -INT8_C(  62), -INT8_C(  92),  INT8_C(   0), -INT8_C( 118), -INT8_C( 121), -INT8_C(  86), -INT8_C(  86),  INT8_C(   1),  INT8_C(  64),  INT8_C(  87), -INT8_C(  99), -INT8_C( 101),  INT8_C( 125),
+         INT8_C(  83), -INT8_C( 125), -INT8_C( 110), -INT8_C(  12),  INT8_C(  64), -INT8_C( 118),  INT8_C(  80), -INT8_C(  31), -INT8_C(  52),  INT8_C(  64),  INT8_C(  16),  INT8_C( 104), -INT8_C( 118), -INT8_C( 104), -INT8_C(  48), -INT8_C(   1),
+        -INT8_C(  98),  INT8_C(   0),  INT8_C(  45), -INT8_C(   1),  INT8_C(   0), -INT8_C(  27), -INT8_C(   1), -INT8_C(   2),  INT8_C(   8),  INT8_C(  75), -INT8_C(  11),  INT8_C(   0), -INT8_C(  16),  INT8_C(  57),  INT8_C(  55),  INT8_C(  20) },
+      { -INT32_C(   268586362),  INT32_C(   306686861),  INT32_C(       19828),  INT32_C(    17993379),  INT32_C(   510986167), -INT32_C(  1264363221), -INT32_C(   479320550),  INT32_C(   355935829),
+        -INT32_C(  1091066553), -INT32_C(      515190),  INT32_C(      249556), -INT32_C(  2079681643),  INT32_C(   271052987),  INT32_C(   411300802),  INT32_C(  2012613972), -INT32_C(    25158875) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpbusd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   276824097),  INT32_C(       49184), -INT32_C(   581882425), -INT32_C(   553648161),  INT32_C(   979330653), -INT32_C(  1555711043), -INT32_C(  1801535287),  INT32_C(    49826528),
+        -INT32_C(   913445690),  INT32_C(    64845943), -INT32_C(  1984085381), -INT32_C(   536903685), -INT32_C(   272241597), -INT32_C(   729405669),  INT32_C(   466202734), -INT32_C(  1073741841) },
+      UINT16_C(59385),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   276954657),  INT32_C(       49184), -INT32_C(   581882425), -INT32_C(   553518621),  INT32_C(   979200093), -INT32_C(  1555581503), -INT32_C(  1801665847),  INT32_C(    49956068),
+        -INT32_C(   913576250),  INT32_C(    64975483), -INT32_C(  1984215941), -INT32_C(   536903685), -INT32_C(   272241597), -INT32_C(   729276129),  INT32_C(   466072174), -INT32_C(  1073612301) } },
+    { {  INT32_C(  1451655387), -INT32_C(   490543027), -INT32_C(  1080777375), -INT32_C(  1881271004), -INT32_C(     8405058),  INT32_C(           4), -INT32_C(     6816833),  INT32_C(   713479810),
+         INT32_C(  1472019477), -INT32_C(   644994266), -INT32_C(   673476449), -INT32_C(   220895122),  INT32_C(   268501632),  INT32_C(    19113758),  INT32_C(    41943808),  INT32_C(    20980256) },
+      UINT16_C(51461),
+      {  INT8_C( 108), -INT8_C(   9), -INT8_C(  14),  INT8_C(  16), -INT8_C(  17),  INT8_C(   8),  INT8_C(  55), -INT8_C(   9), -INT8_C(  56),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(  48),  INT8_C(  97),  INT8_C(   0),  INT8_C(  10),
+        -INT8_C(  74), -INT8_C(  31),  INT8_C(  66),  INT8_C(   0),  INT8_C(  29), -INT8_C(   4), -INT8_C(  57), -INT8_C(  25),  INT8_C(   1), -INT8_C(  67),  INT8_C( 112), -INT8_C(  85),  INT8_C(  41), -INT8_C(  97), -INT8_C(  27),  INT8_C(   0),
+        -INT8_C(  96),  INT8_C(   0), -INT8_C(  35),  INT8_C(  64),  INT8_C(   8),  INT8_C(  42),  INT8_C(   6), -INT8_C(   1), -INT8_C(   5), -INT8_C(   1), -INT8_C(  63),  INT8_C(   0),  INT8_C( 118), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  77), -INT8_C(   5), -INT8_C(  41), -INT8_C(  85), -INT8_C(  13), -INT8_C(  47),  INT8_C(  94), -INT8_C(   1), -INT8_C(  72),  INT8_C(   3),  INT8_C(   8),  INT8_C(   0),  INT8_C(  56),  INT8_C(   0), -INT8_C(  10), -INT8_C(   1) },
+      { -INT8_C(   1),  INT8_C(  17), -INT8_C(  88), -INT8_C(  92),  INT8_C(  76), -INT8_C(  38), -INT8_C(  33), -INT8_C(  19), -INT8_C(  50),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(  83),  INT8_C(  32),  INT8_C(  96), -INT8_C(   1),
+        -INT8_C(  98),  INT8_C(  37), -INT8_C(   9), -INT8_C(   3), -INT8_C( 108),  INT8_C(  87),      INT8_MIN, -INT8_C(   1),  INT8_C(   0), -INT8_C(  61), -INT8_C(   3),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0), -INT8_C(  21),  INT8_C(  33),
+         INT8_C(  64),  INT8_C(  50), -INT8_C(  68),  INT8_C( 122), -INT8_C(   1), -INT8_C(   1), -INT8_C(   5),  INT8_C(   0),  INT8_C(   0), -INT8_C(  91),      INT8_MIN,  INT8_C( 123),  INT8_C(   0), -INT8_C(  52),  INT8_C( 104),  INT8_C(  52),
+         INT8_C(  77), -INT8_C(   1), -INT8_C( 127), -INT8_C(   9), -INT8_C(  45), -INT8_C(  23), -INT8_C(  82),  INT8_C(  29), -INT8_C(  35),  INT8_C(  28),  INT8_C(  38),  INT8_C(  12), -INT8_C(   4),  INT8_C(  68),  INT8_C(  72), -INT8_C(   7) },
+      {  INT32_C(  1451636710), -INT32_C(   490543027), -INT32_C(  1080787131), -INT32_C(  1881271004), -INT32_C(     8405058),  INT32_C(           4), -INT32_C(     6816833),  INT32_C(   713479810),
+         INT32_C(  1472022497), -INT32_C(   644994266), -INT32_C(   673476449), -INT32_C(   220902766),  INT32_C(   268501632),  INT32_C(    19113758),  INT32_C(    41937756),  INT32_C(    20995959) } },
+    { {  INT32_C(  1522409878), -INT32_C(   286277634), -INT32_C(   411084889),  INT32_C(  2130173951), -INT32_C(  1704191571), -INT32_C(   777080828),  INT32_C(   414620705), -INT32_C(  1721056134),
+         INT32_C(  2147483641),  INT32_C(  1427443166),  INT32_C(  1879905783), -INT32_C(  1811410920), -INT32_C(   311412334), -INT32_C(   268567433),  INT32_C(     8390416), -INT32_C(  1133972366) },
+      UINT16_C(64594),
+      { -INT8_C(   1), -INT8_C(  38),  INT8_C(   8),  INT8_C(  45), -INT8_C( 109),  INT8_C(  64),  INT8_C(   1),  INT8_C( 121),  INT8_C(  73), -INT8_C(  94),  INT8_C(   1), -INT8_C(   1),  INT8_C(  26),  INT8_C(   0), -INT8_C(  22),  INT8_C(  16),
+        -INT8_C(  88), -INT8_C( 127), -INT8_C(   3),  INT8_C(  50), -INT8_C(  48),  INT8_C(  36), -INT8_C(   1), -INT8_C(   4),  INT8_C(  45),  INT8_C(  10), -INT8_C(  27),  INT8_C(  63),  INT8_C(   0),  INT8_C(  91), -INT8_C(  15),  INT8_C(  73),
+        -INT8_C(  17), -INT8_C(   5), -INT8_C(   3),  INT8_C( 122), -INT8_C(   3),  INT8_C( 114), -INT8_C(   1), -INT8_C( 105),  INT8_C(   0), -INT8_C(  65), -INT8_C(  33), -INT8_C(   9),  INT8_C(   0),  INT8_C(  59),  INT8_C(  48),  INT8_C(   0),
+         INT8_C(  58), -INT8_C(  45),  INT8_C(   2),  INT8_C(  32), -INT8_C(   6),  INT8_C(  49), -INT8_C(  28),  INT8_C(   0), -INT8_C(  63), -INT8_C(  34),  INT8_C(  29),  INT8_C(   1),  INT8_C( 110), -INT8_C(   1),  INT8_C(   0), -INT8_C(  42) },
+      {  INT8_C(   3),  INT8_C(  77),  INT8_C(  24), -INT8_C(   1),  INT8_C(   0),  INT8_C(  22),  INT8_C(   2), -INT8_C( 126),  INT8_C(  92), -INT8_C( 103), -INT8_C(  28),      INT8_MIN, -INT8_C(   9), -INT8_C(   1),  INT8_C(  32),  INT8_C(  61),
+         INT8_C( 124),  INT8_C(   0), -INT8_C( 122), -INT8_C(  25), -INT8_C( 118),  INT8_C( 123),  INT8_C(  40), -INT8_C(   1), -INT8_C(  42),  INT8_C(  50),  INT8_C(   0), -INT8_C( 109),  INT8_C(  63),  INT8_C(   9), -INT8_C(  49), -INT8_C(  65),
+         INT8_C(  63),  INT8_C( 120),      INT8_MIN,  INT8_C(  64),  INT8_C(  54), -INT8_C( 116), -INT8_C(   1), -INT8_C(   1), -INT8_C(  72),  INT8_C(  64),  INT8_C(  37), -INT8_C(  98), -INT8_C(  53),  INT8_C(  58), -INT8_C( 126), -INT8_C(  13),
+         INT8_C(   7), -INT8_C(  65),  INT8_C(  64),  INT8_C(  44), -INT8_C(  69), -INT8_C(  97),  INT8_C(  77), -INT8_C(  60), -INT8_C(   1),  INT8_C(   1), -INT8_C(  69),  INT8_C(   4),  INT8_C(   4),  INT8_C(  16), -INT8_C( 119),  INT8_C( 100) },
+      {  INT32_C(  1522409878), -INT32_C(   286291470), -INT32_C(   411084889),  INT32_C(  2130173951), -INT32_C(  1704202855), -INT32_C(   777080828),  INT32_C(   414612448), -INT32_C(  1721056134),
+         INT32_C(  2147483641),  INT32_C(  1427443166),  INT32_C(  1879902052), -INT32_C(  1811413546), -INT32_C(   311424107), -INT32_C(   268571880),  INT32_C(     8388448), -INT32_C(  1133946446) } },
+    { {  INT32_C(   483071435),  INT32_C(  1084760711), -INT32_C(  1264756044), -INT32_C(   238297258), -INT32_C(  2080308576), -INT32_C(  2143155210), -INT32_C(    14523742), -INT32_C(   259987717),
+        -INT32_C(     2097298),  INT32_C(   536969218), -INT32_C(   545259521), -INT32_C(   536870914), -INT32_C(    16777250),  INT32_C(    67633216), -INT32_C(  1183971101), -INT32_C(    43122693) },
+      UINT16_C(38688),
+      {  INT8_C(  64), -INT8_C(  98),  INT8_C(  20),  INT8_C(  15), -INT8_C(  80), -INT8_C(   3), -INT8_C(  84),  INT8_C(  64), -INT8_C(  30),  INT8_C(   0),      INT8_MIN, -INT8_C(  82),  INT8_C(   8),  INT8_C(   0), -INT8_C(  71),  INT8_C(   0),
+        -INT8_C(  96), -INT8_C( 124),  INT8_C(  44),  INT8_C(  68),  INT8_C(   0),  INT8_C( 124),  INT8_C(  81), -INT8_C(  72),  INT8_C(   3), -INT8_C(  25), -INT8_C(   5),  INT8_C(   8), -INT8_C( 114),  INT8_C(  76),  INT8_C( 108),  INT8_C( 107),
+        -INT8_C(  54), -INT8_C(   1), -INT8_C(  66),  INT8_C(  40), -INT8_C(   5), -INT8_C(   3), -INT8_C(   1),  INT8_C(   8), -INT8_C(  18), -INT8_C(  46),  INT8_C(   0), -INT8_C( 118), -INT8_C(   1), -INT8_C(  10), -INT8_C(  28), -INT8_C(  17),
+         INT8_C(  31),  INT8_C(  68),  INT8_C(  30), -INT8_C(  22),  INT8_C(  32),  INT8_C(  59),  INT8_C(  55),  INT8_C(  65), -INT8_C(  33), -INT8_C(   1),  INT8_C(  70),  INT8_C( 111), -INT8_C(  26),  INT8_C(  52),  INT8_C(   2), -INT8_C(   1) },
+      { -INT8_C(  77),      INT8_MAX, -INT8_C( 126), -INT8_C(  15),      INT8_MIN,  INT8_C(  32), -INT8_C(   3),  INT8_C(  64), -INT8_C(   1),  INT8_C(  78), -INT8_C(  42),  INT8_C(  73), -INT8_C(   2),  INT8_C(   2), -INT8_C(  69),  INT8_C( 119),
+        -INT8_C(   5),      INT8_MIN,  INT8_C(  24), -INT8_C(   1), -INT8_C(   5), -INT8_C(   1), -INT8_C(  73),  INT8_C(  60),  INT8_C(   0),  INT8_C(   9),      INT8_MIN,  INT8_C(   0),  INT8_C(  74),  INT8_C(  84), -INT8_C(  87),  INT8_C(   0),
+         INT8_C(  33),      INT8_MIN, -INT8_C( 108),  INT8_C(   0), -INT8_C(  94), -INT8_C(  81),  INT8_C(  60), -INT8_C(   3), -INT8_C(   1), -INT8_C( 113),  INT8_C(  68),  INT8_C(  16),  INT8_C(   4), -INT8_C(   5),  INT8_C(  22), -INT8_C( 112),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   8),  INT8_C(  72), -INT8_C(  85),  INT8_C(  14),      INT8_MIN, -INT8_C(  88),  INT8_C( 126),  INT8_C(  71),  INT8_C(  95),  INT8_C(  80),  INT8_C(   0), -INT8_C(   1), -INT8_C(  25),  INT8_C( 112) },
+      {  INT32_C(   483071435),  INT32_C(  1084760711), -INT32_C(  1264756044), -INT32_C(   238297258), -INT32_C(  2080308576), -INT32_C(  2143150207), -INT32_C(    14523742), -INT32_C(   259987717),
+        -INT32_C(     2143792),  INT32_C(   536940407), -INT32_C(   545281281), -INT32_C(   536870914), -INT32_C(    16760230),  INT32_C(    67633216), -INT32_C(  1183971101), -INT32_C(    43094235) } },
+    { { -INT32_C(       34825),  INT32_C(   727581291), -INT32_C(   134217985),  INT32_C(      270416),  INT32_C(   446556738),  INT32_C(  1457324519), -INT32_C(   594673360),  INT32_C(  2139092979),
+         INT32_C(  1337384781), -INT32_C(   686110773),  INT32_C(  1346392065), -INT32_C(   212193888),  INT32_C(      131840), -INT32_C(  1932068122), -INT32_C(  1074463233), -INT32_C(  1048661230) },
+      UINT16_C(49594),
+      {  INT8_C(  59), -INT8_C( 113), -INT8_C(  71), -INT8_C(   1),  INT8_C(  16), -INT8_C(   1), -INT8_C(  42), -INT8_C(   3),  INT8_C(  15), -INT8_C(   2), -INT8_C(  59),  INT8_C(   0), -INT8_C(   1), -INT8_C(  78),  INT8_C(  47),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(  78), -INT8_C(  25),      INT8_MIN,  INT8_C(  98), -INT8_C(   5), -INT8_C(   9), -INT8_C( 121), -INT8_C(   1), -INT8_C(   1), -INT8_C(   2),      INT8_MIN, -INT8_C(   4), -INT8_C(  17),  INT8_C(  37),  INT8_C(   1),
+         INT8_C(  64),  INT8_C(  33), -INT8_C( 120),  INT8_C( 101), -INT8_C(   1), -INT8_C(   1), -INT8_C(  15),  INT8_C(  97), -INT8_C(  21),  INT8_C(  36),  INT8_C(  93), -INT8_C(   1), -INT8_C(  18),  INT8_C(  32), -INT8_C(  47),  INT8_C(  15),
+        -INT8_C(  18),  INT8_C(   0),  INT8_C(  48), -INT8_C( 108), -INT8_C(  22), -INT8_C(  97), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20), -INT8_C(  22),  INT8_C(  29), -INT8_C(  56), -INT8_C(  65),  INT8_C(   3), -INT8_C(  54) },
+      { -INT8_C( 100),  INT8_C(  12),  INT8_C( 103), -INT8_C(  62),  INT8_C(  67), -INT8_C(   1), -INT8_C(  73),  INT8_C(  81),  INT8_C(  54),  INT8_C(   0),  INT8_C(   0), -INT8_C(  26),  INT8_C(  16), -INT8_C(  60), -INT8_C(  21), -INT8_C(  89),
+        -INT8_C(   3), -INT8_C(   2), -INT8_C(   3),  INT8_C(  81),  INT8_C(  24), -INT8_C( 124),  INT8_C(   1),  INT8_C(  63),  INT8_C(  10), -INT8_C(   1), -INT8_C(  97),  INT8_C(  24), -INT8_C(  65),  INT8_C(   5), -INT8_C( 127),  INT8_C(   0),
+         INT8_C(  81), -INT8_C( 118), -INT8_C(   3), -INT8_C(   5),      INT8_MAX, -INT8_C(  53),  INT8_C(   0), -INT8_C( 124),  INT8_C(  33),  INT8_C(  91), -INT8_C(  43),  INT8_C(  64),  INT8_C( 123), -INT8_C(  43), -INT8_C(  65), -INT8_C( 127),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(  21),  INT8_C(   0),  INT8_C( 109), -INT8_C(  43),  INT8_C(   0),  INT8_C(  93), -INT8_C(   3), -INT8_C( 110), -INT8_C( 114), -INT8_C(   1), -INT8_C(  33), -INT8_C(   1), -INT8_C(  78),  INT8_C( 108) },
+      { -INT32_C(       34825),  INT32_C(   727586979), -INT32_C(   134217985),  INT32_C(      262829),  INT32_C(   446565492),  INT32_C(  1457304499), -INT32_C(   594673360),  INT32_C(  2139073095),
+         INT32_C(  1337385158), -INT32_C(   686110773),  INT32_C(  1346392065), -INT32_C(   212193888),  INT32_C(      131840), -INT32_C(  1932068122), -INT32_C(  1074515898), -INT32_C(  1048646439) } },
+    { {  INT32_C(  1401810685), -INT32_C(      131092),  INT32_C(     1183744), -INT32_C(  1451694529),  INT32_C(    16777856),  INT32_C(     2097664), -INT32_C(  1073742889),  INT32_C(   268505152),
+         INT32_C(  2080341950),  INT32_C(     1573124), -INT32_C(    42205186),  INT32_C(   123980601),  INT32_C(   484859823),  INT32_C(     8388676),  INT32_C(   538968102), -INT32_C(  1681562319) },
+      UINT16_C(25021),
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(  19),  INT8_C(  12), -INT8_C( 125),  INT8_C( 109), -INT8_C(  92), -INT8_C( 120),  INT8_C(   0), -INT8_C(  45),  INT8_C(   0), -INT8_C( 105),  INT8_C(  56),  INT8_C( 104), -INT8_C(  58),  INT8_C( 114),
+         INT8_C( 119), -INT8_C(  33),  INT8_C(  58), -INT8_C( 103), -INT8_C(   9), -INT8_C(  46),  INT8_C(  21), -INT8_C(  18),  INT8_C(  68),  INT8_C(   1), -INT8_C(  48), -INT8_C( 107), -INT8_C(  33), -INT8_C(  68), -INT8_C(  65),  INT8_C(  48),
+        -INT8_C(   8), -INT8_C( 127),  INT8_C(   0),  INT8_C(  11), -INT8_C(   2),  INT8_C(   1), -INT8_C(  43),  INT8_C(  61),  INT8_C(  45),  INT8_C(  95), -INT8_C(   1),  INT8_C(   0), -INT8_C( 104), -INT8_C(   1),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  56),      INT8_MIN,  INT8_C(  85), -INT8_C(  11),  INT8_C(  64),  INT8_C(  16), -INT8_C( 113), -INT8_C(   1), -INT8_C(  89),  INT8_C(   4), -INT8_C(  35),  INT8_C(  87),  INT8_C(  40), -INT8_C( 107), -INT8_C(   1),      INT8_MIN },
+      { -INT8_C( 105),  INT8_C(   3),  INT8_C(  16),  INT8_C(   0),  INT8_C(  79), -INT8_C(  69), -INT8_C(  89), -INT8_C(  75), -INT8_C(  54),  INT8_C(   8), -INT8_C(  61),      INT8_MAX, -INT8_C(   9), -INT8_C(  37),  INT8_C(   7), -INT8_C(   1),
+        -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   2), -INT8_C(  57), -INT8_C(   1), -INT8_C(  69),  INT8_C(   0), -INT8_C(   2),  INT8_C(  30), -INT8_C(   1),  INT8_C(   2),  INT8_C(   8),  INT8_C(  32), -INT8_C( 112),
+         INT8_C(  19),  INT8_C(  90), -INT8_C(  64), -INT8_C(  52),  INT8_C(   0),  INT8_C(  18),  INT8_C( 107),  INT8_C(  88), -INT8_C(  28),  INT8_C(  84),  INT8_C(  27), -INT8_C(  52), -INT8_C(  60),  INT8_C(   0), -INT8_C(   5), -INT8_C(  42),
+         INT8_C(  32), -INT8_C( 124),  INT8_C( 110), -INT8_C(  44),  INT8_C(  34), -INT8_C(   1), -INT8_C( 108),  INT8_C(  97), -INT8_C(  17), -INT8_C(   1), -INT8_C(   2),  INT8_C(  82),  INT8_C(  46),  INT8_C( 110), -INT8_C(  15), -INT8_C(  17) },
+      {  INT32_C(  1401815242), -INT32_C(      131092),  INT32_C(     1204609), -INT32_C(  1451697609),  INT32_C(    16772059),  INT32_C(     2069745), -INT32_C(  1073742889),  INT32_C(   268507838),
+         INT32_C(  2080357700),  INT32_C(     1573124), -INT32_C(    42205186),  INT32_C(   123980601),  INT32_C(   484859823),  INT32_C(     8400127),  INT32_C(   538971951), -INT32_C(  1681562319) } },
+    { {  INT32_C(      280576),  INT32_C(   718052997), -INT32_C(  1848144051),  INT32_C(   466728254), -INT32_C(    16777221),  INT32_C(     1052672),  INT32_C(  1100953533), -INT32_C(     4727169),
+        -INT32_C(  2019163837),  INT32_C(   467951489), -INT32_C(      524321),  INT32_C(  2034298154),  INT32_C(   539099304),  INT32_C(   138412545), -INT32_C(   251952237),  INT32_C(     1058824) },
+      UINT16_C(61920),
+      {  INT8_C(  67),  INT8_C(   0),  INT8_C(  71), -INT8_C( 126), -INT8_C(   5),  INT8_C(  81),  INT8_C(   1), -INT8_C(  46), -INT8_C(  68),  INT8_C(   5), -INT8_C(  90), -INT8_C(   1),  INT8_C(   0),  INT8_C( 112),  INT8_C(   2),  INT8_C(   2),
+         INT8_C(   3), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 123), -INT8_C(  15),  INT8_C( 111),  INT8_C(  16), -INT8_C(  98),  INT8_C(   2),  INT8_C(  97),  INT8_C(  20),  INT8_C(  32),  INT8_C(  14), -INT8_C( 112),  INT8_C(  38),
+         INT8_C(  79),  INT8_C( 106), -INT8_C(  36),      INT8_MAX,  INT8_C(  16), -INT8_C(  16), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0), -INT8_C(   9), -INT8_C(  22), -INT8_C(   1),  INT8_C(  89), -INT8_C(  18), -INT8_C(   5),  INT8_C(   0),
+        -INT8_C(  21), -INT8_C(   1), -INT8_C(   1), -INT8_C(  93),  INT8_C(  16), -INT8_C(  65), -INT8_C(   1),      INT8_MIN, -INT8_C(  33),  INT8_C(   0), -INT8_C(  13),  INT8_C(   0), -INT8_C(  26), -INT8_C(  30),  INT8_C( 101),  INT8_C( 120) },
+      {  INT8_C( 119), -INT8_C( 110), -INT8_C(  10), -INT8_C(  90),  INT8_C(  11), -INT8_C(   9),  INT8_C(  49),  INT8_C(  36), -INT8_C(   1), -INT8_C( 107), -INT8_C(  65),  INT8_C(  97),  INT8_C(  61),  INT8_C(  94),  INT8_C(  98),  INT8_C(  95),
+         INT8_C(  66), -INT8_C(  25), -INT8_C( 120), -INT8_C(   5),  INT8_C(  37),  INT8_C( 107), -INT8_C( 105), -INT8_C( 120),  INT8_C(   7), -INT8_C( 106), -INT8_C(  58), -INT8_C(   3),  INT8_C(  55),  INT8_C(  23),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(  32),  INT8_C(   0),  INT8_C(   8),  INT8_C(  72), -INT8_C(   5), -INT8_C(  40), -INT8_C(  14), -INT8_C(  33), -INT8_C( 112),  INT8_C( 118),  INT8_C(  32),  INT8_C(  53),  INT8_C( 109),  INT8_C(  88), -INT8_C(  29),  INT8_C(  73),
+        -INT8_C(   1),  INT8_C(  52),  INT8_C(  24),  INT8_C(   4),  INT8_C(   0), -INT8_C(   2),  INT8_C(   2), -INT8_C(   5), -INT8_C(   5),  INT8_C( 110),  INT8_C(   4), -INT8_C( 126), -INT8_C(   1), -INT8_C(  34), -INT8_C(   9), -INT8_C(  34) },
+      {  INT32_C(      280576),  INT32_C(   718052997), -INT32_C(  1848144051),  INT32_C(   466728254), -INT32_C(    16777221),  INT32_C(     1069805),  INT32_C(  1100948741), -INT32_C(     4724783),
+        -INT32_C(  2019150405),  INT32_C(   467951489), -INT32_C(      524321),  INT32_C(  2034298154),  INT32_C(   539119101),  INT32_C(   138412033), -INT32_C(   251952380),  INT32_C(     1045921) } },
+    { { -INT32_C(     1048577),  INT32_C(       65696), -INT32_C(  1623561159), -INT32_C(   162529281),  INT32_C(  1727325900), -INT32_C(          33),  INT32_C(  1823363088),  INT32_C(         256),
+        -INT32_C(   885521145),  INT32_C(   138414080),  INT32_C(    19398660), -INT32_C(   570458113), -INT32_C(   269490225), -INT32_C(    38516562), -INT32_C(     1327155),  INT32_C(  1108761699) },
+      UINT16_C(36497),
+      { -INT8_C(  11),  INT8_C(  63),  INT8_C(   8), -INT8_C(  19),  INT8_C(   0), -INT8_C(  19),  INT8_C(   9), -INT8_C(  98), -INT8_C(  37), -INT8_C(   6), -INT8_C(  69),  INT8_C(  29), -INT8_C(   3),  INT8_C(   2),  INT8_C(  45),  INT8_C( 126),
+        -INT8_C(   7), -INT8_C(  39),  INT8_C(  18), -INT8_C(   5),  INT8_C(  79),  INT8_C(  12), -INT8_C(   2),  INT8_C( 106), -INT8_C(  69),  INT8_C(  39), -INT8_C(   6),  INT8_C(  64),  INT8_C(  32), -INT8_C(  65), -INT8_C(   2),  INT8_C(  64),
+        -INT8_C(  73),  INT8_C(  88), -INT8_C(  66), -INT8_C(   4), -INT8_C(  96),  INT8_C(   7), -INT8_C( 103), -INT8_C(   4), -INT8_C( 114),  INT8_C(   0),  INT8_C(  37),  INT8_C(   6), -INT8_C(   5),  INT8_C(  38),  INT8_C(  24),  INT8_C(  37),
+         INT8_C(   0), -INT8_C(  54), -INT8_C(  33),  INT8_C(  27),  INT8_C(  26),  INT8_C( 115), -INT8_C(   1), -INT8_C(  37), -INT8_C(  76),  INT8_C(  55),  INT8_C(   0), -INT8_C(  16),  INT8_C(   5),  INT8_C(  97),  INT8_C(   2),  INT8_C(  16) },
+      { -INT8_C(  18),  INT8_C(  80), -INT8_C(  65), -INT8_C( 119), -INT8_C(  59), -INT8_C( 120),  INT8_C(  65),  INT8_C(   4), -INT8_C( 123),  INT8_C(   4), -INT8_C(   2), -INT8_C(  17), -INT8_C(  97), -INT8_C( 123), -INT8_C( 102), -INT8_C( 117),
+        -INT8_C(   2),  INT8_C(  32),  INT8_C(   0),  INT8_C(   0), -INT8_C(   6), -INT8_C(   1),  INT8_C(  74), -INT8_C(  33),  INT8_C(  30),      INT8_MAX,  INT8_C(  32),  INT8_C(  34), -INT8_C(  52), -INT8_C(  67),  INT8_C(  95), -INT8_C(  10),
+         INT8_C( 110), -INT8_C(   9),  INT8_C( 106), -INT8_C(  23), -INT8_C(   5), -INT8_C(  97),  INT8_C(  96),  INT8_C(  23),  INT8_C(  36), -INT8_C( 102), -INT8_C( 126),  INT8_C(  81),  INT8_C(  91), -INT8_C(  85), -INT8_C(   1),  INT8_C( 118),
+        -INT8_C(   1),  INT8_C(  17),  INT8_C(  32),  INT8_C(   4),  INT8_C(  16),  INT8_C(  64),  INT8_C(  57), -INT8_C(  34),  INT8_C( 117), -INT8_C(  33),  INT8_C(   0), -INT8_C(  33),  INT8_C(  91),  INT8_C(   9), -INT8_C(   3), -INT8_C(  33) },
+      { -INT32_C(     1076670),  INT32_C(       65696), -INT32_C(  1623561159), -INT32_C(   162529281),  INT32_C(  1727332346), -INT32_C(          33),  INT32_C(  1823363088),  INT32_C(        9285),
+        -INT32_C(   885521145),  INT32_C(   138433085),  INT32_C(    19399596), -INT32_C(   570434160), -INT32_C(   269490225), -INT32_C(    38516562), -INT32_C(     1327155),  INT32_C(  1108762493) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpbusd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   347095585),  INT32_C(  1073746948),  INT32_C(  1094733892), -INT32_C(  1783817428), -INT32_C(  1313416855),  INT32_C(    33589544),  INT32_C(   269488128), -INT32_C(     4194305),
+        -INT32_C(  2147352576), -INT32_C(   843280377),  INT32_C(  1132569755), -INT32_C(   537395201),  INT32_C(  1864684851),  INT32_C(   714080384), -INT32_C(   744344300), -INT32_C(  1652954214) },
+      UINT16_C(47297),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(   346965025),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   269357568), -INT32_C(     4064765),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   537265661),  INT32_C(  1864554291),  INT32_C(   714209924),  INT32_C(           0), -INT32_C(  1652824674) } },
+    { { -INT32_C(       17697),  INT32_C(  1073881264), -INT32_C(     1442861),  INT32_C(   339133600), -INT32_C(   134217742),  INT32_C(     4194336), -INT32_C(       40961),  INT32_C(  1827488692),
+         INT32_C(  2147331071), -INT32_C(     8388609), -INT32_C(  1431647584),  INT32_C(   947761357), -INT32_C(   625279020),  INT32_C(     6331441),  INT32_C(   805439489),  INT32_C(  2147483454) },
+      UINT16_C(28433),
+      { -INT8_C(  45), -INT8_C(  65),      INT8_MAX, -INT8_C(  66),  INT8_C(  96),  INT8_C( 119),  INT8_C(   3), -INT8_C(   3), -INT8_C( 105), -INT8_C(  67),  INT8_C(   0), -INT8_C(   1),  INT8_C( 124),  INT8_C(  49), -INT8_C(  11), -INT8_C(   1),
+         INT8_C(  26), -INT8_C(   3),  INT8_C(  99),  INT8_C(   2), -INT8_C(   1),  INT8_C(  60), -INT8_C(  28),  INT8_C( 119),  INT8_C(   0), -INT8_C(  69),  INT8_C(   0),  INT8_C(  71), -INT8_C(  49),  INT8_C(   0),      INT8_MAX,  INT8_C(  80),
+         INT8_C(  32), -INT8_C(   1), -INT8_C( 106), -INT8_C(   2), -INT8_C(  90),  INT8_C(  85),  INT8_C(  55), -INT8_C( 117), -INT8_C(  65),  INT8_C(  16),  INT8_C(  32),  INT8_C(  17),  INT8_C(  18),  INT8_C(  47), -INT8_C(  82), -INT8_C(  58),
+         INT8_C(  76),  INT8_C(  10),  INT8_C( 123), -INT8_C(  66),  INT8_C(  63), -INT8_C(  44),  INT8_C(   0), -INT8_C(   1), -INT8_C( 124), -INT8_C( 105), -INT8_C(  66),  INT8_C(   4),  INT8_C(  64), -INT8_C( 109),  INT8_C(   1),  INT8_C(   0) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C( 105), -INT8_C(   1),  INT8_C(  30), -INT8_C(   1),  INT8_C(  88), -INT8_C(   5), -INT8_C(  27), -INT8_C(  15),  INT8_C(  53), -INT8_C(  33),  INT8_C(   0),  INT8_C(  30), -INT8_C(   3),  INT8_C(  32),
+         INT8_C(  16), -INT8_C(  21), -INT8_C(  93), -INT8_C(  40),  INT8_C(  64), -INT8_C(   1),  INT8_C(  13),  INT8_C(  36), -INT8_C(  17),  INT8_C(   2), -INT8_C( 107),  INT8_C(   2), -INT8_C(  14), -INT8_C(   1),  INT8_C(  59), -INT8_C(  43),
+         INT8_C(  60), -INT8_C(  35),  INT8_C(  53),  INT8_C(   5), -INT8_C(   6), -INT8_C(  15),  INT8_C(   3), -INT8_C(  12),  INT8_C(  16),  INT8_C(  16), -INT8_C(  41), -INT8_C(   2), -INT8_C(   5),  INT8_C(   5),  INT8_C( 122), -INT8_C(  65),
+         INT8_C(  84),  INT8_C(  20), -INT8_C(  45),  INT8_C(  71), -INT8_C(  28), -INT8_C( 126),  INT8_C(  11), -INT8_C(   3), -INT8_C(  35), -INT8_C(   1), -INT8_C(  88), -INT8_C(   9), -INT8_C( 108),  INT8_C(  18), -INT8_C( 104),  INT8_C(   0) },
+      { -INT32_C(        4743),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   134231926),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  2147333286), -INT32_C(     8392383), -INT32_C(  1431645618),  INT32_C(   947769860),  INT32_C(           0),  INT32_C(     6302200),  INT32_C(   805417962),  INT32_C(           0) } },
+    { { -INT32_C(   861586803), -INT32_C(   418707608),  INT32_C(   874484561),  INT32_C(   817890065),  INT32_C(  1779388755), -INT32_C(  2146942464), -INT32_C(   537198593), -INT32_C(  1859045383),
+         INT32_C(  1046229742),  INT32_C(   835893532),  INT32_C(  1580199755),  INT32_C(     8912914), -INT32_C(      135617), -INT32_C(   537042953),  INT32_C(   629204265), -INT32_C(   439993465) },
+      UINT16_C(50813),
+      {  INT8_C(   7),  INT8_C(   9), -INT8_C(  44),  INT8_C(   1), -INT8_C(  42),  INT8_C(   1),  INT8_C( 121), -INT8_C(  28),  INT8_C(  42),  INT8_C(   0), -INT8_C(  96), -INT8_C( 115),  INT8_C(   0), -INT8_C(  83), -INT8_C(   1),  INT8_C( 109),
+         INT8_C(   0), -INT8_C( 110),  INT8_C( 113), -INT8_C(   1), -INT8_C(  21),  INT8_C(   2),  INT8_C(  77),  INT8_C(  34),  INT8_C(   8), -INT8_C(  65), -INT8_C(   1),  INT8_C(  18), -INT8_C(  96), -INT8_C(  32), -INT8_C(  51),  INT8_C(   8),
+        -INT8_C(  65), -INT8_C(   2), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(  18),  INT8_C(  57), -INT8_C(   1),  INT8_C(  32),  INT8_C( 107),  INT8_C(   0), -INT8_C(  92), -INT8_C(  41), -INT8_C( 104), -INT8_C(  64),  INT8_C(   1),
+        -INT8_C(  33), -INT8_C(  33), -INT8_C(  65),  INT8_C(  40),  INT8_C(  31),  INT8_C(  90), -INT8_C(  34), -INT8_C(  81),      INT8_MAX, -INT8_C(  34), -INT8_C(   5),  INT8_C(  40),  INT8_C(  80), -INT8_C(  37),  INT8_C(  32), -INT8_C( 112) },
+      {  INT8_C(  66), -INT8_C(   2),  INT8_C(  10), -INT8_C(  92),  INT8_C(  18), -INT8_C(   5), -INT8_C(   9), -INT8_C( 112),  INT8_C(   5),  INT8_C(  72),      INT8_MIN, -INT8_C(  96),  INT8_C(  32), -INT8_C( 100),      INT8_MAX, -INT8_C(  89),
+        -INT8_C(   1), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(  22), -INT8_C(  84), -INT8_C( 101), -INT8_C(  29),  INT8_C( 122),  INT8_C(   0),  INT8_C( 121), -INT8_C( 126),  INT8_C(   8), -INT8_C(   3), -INT8_C(  54), -INT8_C(   1),
+         INT8_C(  10), -INT8_C(   1), -INT8_C(   3),  INT8_C(  32),  INT8_C( 119),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(  12), -INT8_C(  97),  INT8_C( 113),  INT8_C(  64), -INT8_C(   1),  INT8_C( 111), -INT8_C( 104),  INT8_C(  47),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(  69),  INT8_C(   5), -INT8_C(   1), -INT8_C( 114), -INT8_C( 104), -INT8_C( 117),  INT8_C(   6),  INT8_C(  75),  INT8_C( 109), -INT8_C(  65),  INT8_C(   9), -INT8_C(  80), -INT8_C(  26),  INT8_C(  45) },
+      { -INT32_C(   861584331),  INT32_C(           0),  INT32_C(   874450755),  INT32_C(   817895449),  INT32_C(  1779373279), -INT32_C(  2146946225), -INT32_C(   537169030),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(   835919542),  INT32_C(  1580200256),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   629246436), -INT32_C(   440004617) } },
+    { {  INT32_C(    39811918), -INT32_C(   136380421),  INT32_C(  2019574015),  INT32_C(   689244926), -INT32_C(  1174429697), -INT32_C(   205520901), -INT32_C(  1224738817), -INT32_C(  1938131345),
+        -INT32_C(   400724926),  INT32_C(  2106341117),  INT32_C(    67109888),  INT32_C(  2049276878), -INT32_C(      262145),  INT32_C(   642189335),  INT32_C(   520635214), -INT32_C(  1102598679) },
+      UINT16_C(53982),
+      { -INT8_C(  49), -INT8_C(   1),  INT8_C(  76),  INT8_C( 114), -INT8_C(  25),  INT8_C(   9), -INT8_C(  32), -INT8_C(  10), -INT8_C(  32),  INT8_C(  90), -INT8_C(  81),  INT8_C(  23),  INT8_C( 119),  INT8_C(  60), -INT8_C(   2), -INT8_C(  82),
+        -INT8_C(  15),  INT8_C(  97),  INT8_C( 116), -INT8_C(   1), -INT8_C(  96),  INT8_C(   0),  INT8_C(  63),  INT8_C(   0),  INT8_C(  36), -INT8_C(  33), -INT8_C( 117), -INT8_C(  18),  INT8_C(  24), -INT8_C( 123), -INT8_C(  55),  INT8_C( 101),
+        -INT8_C( 123),  INT8_C(  31),  INT8_C(   5),  INT8_C(  43), -INT8_C(  53),  INT8_C(   8),  INT8_C(  32), -INT8_C(   3),  INT8_C(   0), -INT8_C(  34),  INT8_C(   0),  INT8_C(  33), -INT8_C(  17),  INT8_C(  48),  INT8_C(  32),  INT8_C(   6),
+        -INT8_C(  65), -INT8_C(  76), -INT8_C(   1), -INT8_C(  92), -INT8_C(  33), -INT8_C(   1),  INT8_C(   2),  INT8_C(  64), -INT8_C( 126),  INT8_C(   8),  INT8_C(   0),  INT8_C(   2),      INT8_MAX,  INT8_C(  48), -INT8_C(   7), -INT8_C(  57) },
+      {  INT8_C(  40),  INT8_C(   0), -INT8_C(  34), -INT8_C(  61), -INT8_C( 109), -INT8_C(  49),  INT8_C(  32),  INT8_C(  99),  INT8_C(   0),  INT8_C(  79), -INT8_C(  17),  INT8_C(  29), -INT8_C(  92), -INT8_C(  35), -INT8_C(  85), -INT8_C(   1),
+         INT8_C(   8), -INT8_C(   2),  INT8_C(  74),  INT8_C(  14), -INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(  47), -INT8_C(  17), -INT8_C(  46), -INT8_C(   1),  INT8_C(  16), -INT8_C(  10),      INT8_MAX, -INT8_C(  50), -INT8_C(  32),
+         INT8_C(  95), -INT8_C(  79), -INT8_C(   1), -INT8_C(  85), -INT8_C( 108), -INT8_C(  85),  INT8_C(   0),  INT8_C(  95), -INT8_C(  65),  INT8_C(  16), -INT8_C(  14), -INT8_C(   1),  INT8_C( 111),  INT8_C(  54), -INT8_C(   1),  INT8_C(  64),
+         INT8_C(   0),  INT8_C(  16), -INT8_C(  82),  INT8_C( 120),  INT8_C(  16),  INT8_C(   0), -INT8_C(  13),  INT8_C(  41), -INT8_C( 108),  INT8_C(  88),  INT8_C(   0), -INT8_C(  72),  INT8_C(  49), -INT8_C(   2), -INT8_C(  64),  INT8_C( 105) },
+      {  INT32_C(           0), -INT32_C(   136374519),  INT32_C(  2019578817),  INT32_C(   689210114), -INT32_C(  1174415809),  INT32_C(           0), -INT32_C(  1224746018), -INT32_C(  1938127976),
+         INT32_C(           0),  INT32_C(  2106342548),  INT32_C(           0),  INT32_C(           0), -INT32_C(      260495),  INT32_C(           0),  INT32_C(   520621734), -INT32_C(  1102587593) } },
+    { { -INT32_C(  1562862406), -INT32_C(   751865045),  INT32_C(     8390912), -INT32_C(   500290130), -INT32_C(  1115514907), -INT32_C(  2016359219),  INT32_C(  2109733503),  INT32_C(  2145369855),
+        -INT32_C(  1074009601),  INT32_C(  1677983744), -INT32_C(   536871170),  INT32_C(  1791220375),  INT32_C(    90356777),  INT32_C(  1276832442), -INT32_C(  1545814517), -INT32_C(  1741202950) },
+      UINT16_C(58430),
+      {  INT8_C(   0),  INT8_C(  46),  INT8_C(  50), -INT8_C(   5),  INT8_C(   0),  INT8_C(   9),  INT8_C( 115), -INT8_C(  56), -INT8_C(  70), -INT8_C(  36), -INT8_C(   3), -INT8_C(  25),  INT8_C(   8), -INT8_C(   1),  INT8_C(  40),  INT8_C(   0),
+        -INT8_C( 124),  INT8_C(  32), -INT8_C(   1), -INT8_C(   1), -INT8_C(  15),  INT8_C(  32), -INT8_C(  80), -INT8_C(  11), -INT8_C(   9),  INT8_C(   0), -INT8_C(   5), -INT8_C(  67), -INT8_C(   1),  INT8_C(  79),  INT8_C(  64),  INT8_C(  29),
+        -INT8_C(   1), -INT8_C(  96),  INT8_C(   5), -INT8_C(  59),  INT8_C(  79),  INT8_C(   0), -INT8_C(  98),  INT8_C( 121),  INT8_C(  61), -INT8_C(  97),  INT8_C(  47),  INT8_C(   0),  INT8_C(  96), -INT8_C(  66),  INT8_C(   4),  INT8_C(   0),
+        -INT8_C(  17),  INT8_C(  33), -INT8_C(   2), -INT8_C(   5),  INT8_C( 117),  INT8_C(   0),  INT8_C( 103), -INT8_C( 101),  INT8_C(  20),  INT8_C(   0),  INT8_C(  32), -INT8_C(  90), -INT8_C(   1),  INT8_C( 109),      INT8_MIN, -INT8_C(  83) },
+      {      INT8_MIN,  INT8_C(   1),  INT8_C(  55),  INT8_C(   0),  INT8_C(  57), -INT8_C(  12), -INT8_C(  69), -INT8_C(   1), -INT8_C(  61),  INT8_C(  93),  INT8_C(  99),  INT8_C(  55), -INT8_C(  18),  INT8_C(  63), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(  87),  INT8_C(  78), -INT8_C(  67), -INT8_C(   9),  INT8_C(   4), -INT8_C(   1),  INT8_C(   0), -INT8_C(  30),  INT8_C(   0),  INT8_C(  42), -INT8_C(  23),  INT8_C(  68), -INT8_C( 112),  INT8_C(  20),
+         INT8_C(  33),  INT8_C(   0),  INT8_C(  73),      INT8_MIN,      INT8_MAX,  INT8_C(  93),  INT8_C(  37),  INT8_C(  45), -INT8_C(   9),  INT8_C(   0), -INT8_C(  86),  INT8_C( 119),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86),  INT8_C(  42),
+        -INT8_C(  34),  INT8_C(  65),  INT8_C(   0),  INT8_C(  59), -INT8_C(   1), -INT8_C(  66),  INT8_C(   0),  INT8_C(  28),  INT8_C(  16), -INT8_C(   1),  INT8_C(  71), -INT8_C(   7),  INT8_C(   0), -INT8_C(   1),  INT8_C(  77), -INT8_C(  93) },
+      {  INT32_C(           0), -INT32_C(   751873288),  INT32_C(     8437778), -INT32_C(   500274249), -INT32_C(  1115472864), -INT32_C(  2016375195),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(   536875761),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1276836665), -INT32_C(  1545813087), -INT32_C(  1741209292) } },
+    { {  INT32_C(         384), -INT32_C(   274475010), -INT32_C(   163678018),  INT32_C(  1753049354),  INT32_C(   988004926), -INT32_C(   626547379),  INT32_C(  1925644843), -INT32_C(   553648265),
+         INT32_C(  1041523853),  INT32_C(   175848778),  INT32_C(    75563025),  INT32_C(   827919105), -INT32_C(  1430104781), -INT32_C(   270937709), -INT32_C(  1236223034),  INT32_C(   134815744) },
+      UINT16_C(37043),
+      {  INT8_C(  16), -INT8_C( 113),      INT8_MAX, -INT8_C(  20),  INT8_C( 111),  INT8_C(   0), -INT8_C(   1), -INT8_C(  19), -INT8_C(  54),  INT8_C(  56),  INT8_C(  17), -INT8_C(  51),  INT8_C(  18), -INT8_C( 112), -INT8_C(  60),  INT8_C(  91),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   0), -INT8_C(  36),  INT8_C(  72),  INT8_C(  48),  INT8_C(  24), -INT8_C(  33), -INT8_C(  49),  INT8_C(  32), -INT8_C( 101), -INT8_C(   1),  INT8_C(  83),  INT8_C(  76), -INT8_C(  73),  INT8_C(   0),
+         INT8_C( 121),  INT8_C(   8), -INT8_C(  68), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(  36),  INT8_C(  25), -INT8_C(  71),  INT8_C(   0),  INT8_C(  81),  INT8_C(   0),  INT8_C(  66),  INT8_C( 101), -INT8_C(   3),      INT8_MIN,
+         INT8_C(   4),  INT8_C(  12), -INT8_C(   1),  INT8_C(  55), -INT8_C(   4),  INT8_C(   0),  INT8_C( 102),  INT8_C(  38), -INT8_C(  56),  INT8_C( 123), -INT8_C(  44), -INT8_C(  66), -INT8_C(  47),  INT8_C( 123),  INT8_C(  91), -INT8_C( 112) },
+      {  INT8_C(  64),  INT8_C(   0),  INT8_C(  78),  INT8_C( 101), -INT8_C(   2),  INT8_C(  72),  INT8_C(   0), -INT8_C(   1), -INT8_C( 120), -INT8_C(  43),  INT8_C(  63),  INT8_C(  69),      INT8_MIN, -INT8_C(   1),  INT8_C(   0),      INT8_MAX,
+        -INT8_C( 105), -INT8_C(  21), -INT8_C(  87), -INT8_C(  43),  INT8_C( 112),  INT8_C(   0),  INT8_C(   1),  INT8_C(  32),  INT8_C( 119),  INT8_C( 126), -INT8_C( 124),  INT8_C( 126), -INT8_C(  17), -INT8_C(   1), -INT8_C(   1),  INT8_C(  64),
+        -INT8_C(  17),      INT8_MIN, -INT8_C(  54), -INT8_C(   6),  INT8_C(  50), -INT8_C(   1),  INT8_C(   0),  INT8_C( 126),  INT8_C(  48), -INT8_C(  11),  INT8_C(  27),  INT8_C(   1), -INT8_C(  70), -INT8_C(  33),  INT8_C(  99),  INT8_C(   8),
+         INT8_C(  64),  INT8_C(  83),  INT8_C( 106),  INT8_C(  10), -INT8_C( 124), -INT8_C(   1),  INT8_C(   3), -INT8_C(   8), -INT8_C(  57),  INT8_C(  87),  INT8_C(   8), -INT8_C(   2), -INT8_C(   1), -INT8_C(  93),  INT8_C(   8), -INT8_C(  52) },
+      {  INT32_C(       35150), -INT32_C(   274475469),  INT32_C(           0),  INT32_C(           0),  INT32_C(   987995256), -INT32_C(   626532155),  INT32_C(           0), -INT32_C(   553649935),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1430075949),  INT32_C(           0),  INT32_C(           0),  INT32_C(   134797336) } },
+    { {  INT32_C(   939655328),  INT32_C(   861103943),  INT32_C(     8413472),  INT32_C(  1776857143), -INT32_C(   422863284),  INT32_C(   883573532),  INT32_C(   971797575),  INT32_C(   905424403),
+        -INT32_C(    55900865), -INT32_C(   134791361), -INT32_C(  2113505902),  INT32_C(     4245504), -INT32_C(     6291495),  INT32_C(    35651616),  INT32_C(   909026717), -INT32_C(  1995567104) },
+      UINT16_C(55787),
+      {  INT8_C(  16),  INT8_C(  76),      INT8_MIN, -INT8_C(  65),  INT8_C(  92), -INT8_C(   1),  INT8_C(   4), -INT8_C( 111), -INT8_C( 100), -INT8_C(   1), -INT8_C(   1), -INT8_C(   9),  INT8_C(  91),  INT8_C( 104), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(  48), -INT8_C( 115),  INT8_C(  39), -INT8_C(   9),  INT8_C(  36),  INT8_C( 119),  INT8_C(   4), -INT8_C(   1), -INT8_C(  19), -INT8_C( 125),  INT8_C(  59),  INT8_C(   0), -INT8_C(   1),  INT8_C(  11), -INT8_C(   2),
+        -INT8_C(   9),  INT8_C(  64),  INT8_C(  42),  INT8_C(  20), -INT8_C(   9), -INT8_C(  67), -INT8_C(  83),  INT8_C(  58),      INT8_MAX, -INT8_C(   3), -INT8_C(  40),  INT8_C(   7), -INT8_C(   1),  INT8_C(  64),  INT8_C(   9), -INT8_C(  16),
+         INT8_C(   0), -INT8_C(  95),  INT8_C(  64),  INT8_C(  72),  INT8_C(  16),  INT8_C(   4), -INT8_C(   5), -INT8_C(  82), -INT8_C(   2),  INT8_C( 108),  INT8_C(  88), -INT8_C(  65), -INT8_C(   1), -INT8_C(  23), -INT8_C(  82),  INT8_C(   0) },
+      { -INT8_C(  15), -INT8_C(   1), -INT8_C(  97), -INT8_C(  30), -INT8_C(  34),  INT8_C(   1),      INT8_MIN,  INT8_C(   1), -INT8_C(  47),  INT8_C(  96), -INT8_C( 119), -INT8_C(   5), -INT8_C(   1), -INT8_C( 100), -INT8_C(   3), -INT8_C(   1),
+         INT8_C(  16), -INT8_C(   1), -INT8_C(  22),  INT8_C(  86),  INT8_C(   0),  INT8_C(   4),  INT8_C(  99),  INT8_C(   0), -INT8_C(  95),  INT8_C(   4), -INT8_C(  27),  INT8_C(  74), -INT8_C(  74),  INT8_C(  61),  INT8_C(  16),  INT8_C(  39),
+         INT8_C(  34),  INT8_C(  59),  INT8_C(  68), -INT8_C(  17), -INT8_C(  90), -INT8_C(  80),  INT8_C(  28),  INT8_C(  96), -INT8_C(  65),  INT8_C(  85), -INT8_C(  33),  INT8_C(  90), -INT8_C(  50),  INT8_C(  32),  INT8_C(  64),  INT8_C(  37),
+         INT8_C(  12), -INT8_C(  98), -INT8_C( 103), -INT8_C(  83),  INT8_C(  42), -INT8_C(  85),  INT8_C(  32), -INT8_C(  93),  INT8_C(  34), -INT8_C( 119), -INT8_C(   5), -INT8_C( 103), -INT8_C(  65),  INT8_C(   0), -INT8_C(   3), -INT8_C(  23) },
+      {  INT32_C(   939636866),  INT32_C(   861100703),  INT32_C(           0),  INT32_C(  1776845632),  INT32_C(           0),  INT32_C(   883585457),  INT32_C(   971775127),  INT32_C(   905450040),
+        -INT32_C(    55886175),  INT32_C(           0),  INT32_C(           0),  INT32_C(     4244258), -INT32_C(     6319841),  INT32_C(           0),  INT32_C(   909002388), -INT32_C(  1995584201) } },
+    { { -INT32_C(  1296642856), -INT32_C(  1111501122),  INT32_C(    17303552), -INT32_C(   173695106),  INT32_C(  2013183835),  INT32_C(   420953018), -INT32_C(       12289), -INT32_C(   100796417),
+         INT32_C(         160),  INT32_C(  1804613478),  INT32_C(    69206144),  INT32_C(     1315968), -INT32_C(  1160029305), -INT32_C(   841003946), -INT32_C(    96885464), -INT32_C(    36820025) },
+      UINT16_C(16482),
+      {  INT8_C(   4),  INT8_C(  65),  INT8_C(  41), -INT8_C(  53), -INT8_C(  81), -INT8_C(   9), -INT8_C( 111),  INT8_C(  17), -INT8_C(   1),  INT8_C( 100), -INT8_C(  96),  INT8_C(  64),  INT8_C( 106),  INT8_C(   0), -INT8_C( 112),  INT8_C( 126),
+         INT8_C( 125),  INT8_C(  12), -INT8_C(   3),  INT8_C(  86),  INT8_C(  64), -INT8_C(  65), -INT8_C(  73),  INT8_C(  76), -INT8_C(  13),  INT8_C( 123),  INT8_C(  96),  INT8_C(  20),  INT8_C(  16), -INT8_C(   1),  INT8_C(  31), -INT8_C(   5),
+         INT8_C(  68), -INT8_C(  93),  INT8_C(  36), -INT8_C(  40), -INT8_C( 127),  INT8_C( 125), -INT8_C(  19),  INT8_C(  71),  INT8_C(   1), -INT8_C(  76), -INT8_C(  85),  INT8_C(  12),  INT8_C(   8),      INT8_MIN,  INT8_C(  32),  INT8_C(   0),
+         INT8_C(  79),  INT8_C( 102), -INT8_C(  96),  INT8_C(   4), -INT8_C(   1), -INT8_C(  34),      INT8_MAX,      INT8_MAX, -INT8_C(  11),  INT8_C(   0), -INT8_C(  99),  INT8_C(   0), -INT8_C(  95), -INT8_C(   6),  INT8_C(  12),  INT8_C( 100) },
+      {  INT8_C(  67),  INT8_C(  64),  INT8_C(   4), -INT8_C(  31), -INT8_C(  73), -INT8_C(  34),  INT8_C(  46),  INT8_C(  80),  INT8_C(  33), -INT8_C(  69),  INT8_C(   0),  INT8_C(  81),  INT8_C(   0),  INT8_C(  97), -INT8_C(  99),  INT8_C(   0),
+        -INT8_C(   2), -INT8_C(   6), -INT8_C(  79), -INT8_C(  33), -INT8_C(   4), -INT8_C(   4),  INT8_C(  66), -INT8_C( 109), -INT8_C( 117),  INT8_C(  96),  INT8_C(   3), -INT8_C(  17),  INT8_C(   0),  INT8_C( 112),  INT8_C(  16),  INT8_C(   1),
+         INT8_C( 123), -INT8_C(   9),  INT8_C(  88),  INT8_C( 110), -INT8_C(  49), -INT8_C(  75), -INT8_C( 127),  INT8_C(  20),  INT8_C(  69),  INT8_C(  82), -INT8_C(   1),  INT8_C(  12), -INT8_C(  17),  INT8_C(  78), -INT8_C(   3),  INT8_C(  60),
+         INT8_C( 106),  INT8_C(  60),  INT8_C(   0),  INT8_C(  32), -INT8_C(   3),  INT8_C(   2),  INT8_C(   1), -INT8_C( 105), -INT8_C( 120),  INT8_C(   0),  INT8_C( 102), -INT8_C(  83),  INT8_C(  55),  INT8_C(   1),  INT8_C( 124),  INT8_C( 122) },
+      {  INT32_C(           0), -INT32_C(  1111514265),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   420955792), -INT32_C(       28964),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    96898850),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpbusd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpbusd_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,812 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpbusds
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpbusds.h>
+
+static int
+test_simde_mm_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   830256800), -INT32_C(   169673641),  INT32_C(  1243931546), -INT32_C(   186647041) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   830387360), -INT32_C(   169544101),  INT32_C(  1243800986), -INT32_C(   186517501) } },
+    { {  INT32_C(  2147424297), -INT32_C(  2147482063),  INT32_C(  2147445081), -INT32_C(  2147449121) },
+      { -INT8_C(   1), -INT8_C(  50), -INT8_C(  49),  INT8_C(  12), -INT8_C(   1), -INT8_C(  42), -INT8_C(  88),  INT8_C( 122),  INT8_C(   0), -INT8_C(   3), -INT8_C( 109), -INT8_C(  49), -INT8_C( 106), -INT8_C(  45),  INT8_C(  56), -INT8_C( 124) },
+      {  INT8_C(  19), -INT8_C(  64),  INT8_C( 123), -INT8_C(   3), -INT8_C( 110),  INT8_C(  13), -INT8_C(  10), -INT8_C(   2), -INT8_C(  34), -INT8_C(   1),      INT8_MAX, -INT8_C( 105),  INT8_C(   0),  INT8_C(  17),  INT8_C( 119), -INT8_C(   3) },
+      {  INT32_C(  2147441383),            INT32_MIN,  INT32_C(  2147441762), -INT32_C(  2147439266) } },
+    { { -INT32_C(  2147463866),  INT32_C(  2147452763), -INT32_C(  2147427678),  INT32_C(  2147411916) },
+      {  INT8_C(   0), -INT8_C( 100), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(  53),  INT8_C(   4),  INT8_C(   0),  INT8_C(  68),  INT8_C(  88),  INT8_C( 103),      INT8_MIN,  INT8_C(  20),      INT8_MIN,  INT8_C(  83),  INT8_C(  30) },
+      {  INT8_C(  32), -INT8_C(   2),  INT8_C( 113),  INT8_C(   0),  INT8_C(  79),      INT8_MAX, -INT8_C(   3), -INT8_C(  33),  INT8_C( 112), -INT8_C(  57), -INT8_C(  81), -INT8_C(   1),  INT8_C( 126), -INT8_C(  12),  INT8_C(  16), -INT8_C(   1) },
+      { -INT32_C(  2147435363),            INT32_MAX, -INT32_C(  2147433549),  INT32_C(  2147414198) } },
+    { { -INT32_C(  1072241801), -INT32_C(        1025),  INT32_C(  1076509892), -INT32_C(           9) },
+      {  INT8_C(  16),  INT8_C(  22),  INT8_C(  62), -INT8_C(   1),  INT8_C(  64),  INT8_C(  82), -INT8_C(   2),  INT8_C(  78), -INT8_C(  35), -INT8_C(  21), -INT8_C(   1),  INT8_C(  60), -INT8_C(   1), -INT8_C(  42),  INT8_C(  96), -INT8_C(  15) },
+      {  INT8_C(  64), -INT8_C(  13), -INT8_C( 112),  INT8_C(   0),  INT8_C( 103), -INT8_C( 100), -INT8_C(  80),  INT8_C( 115), -INT8_C(   2), -INT8_C(   1), -INT8_C(   5),  INT8_C(  18), -INT8_C(  88), -INT8_C(   6), -INT8_C(   1), -INT8_C(  48) },
+      { -INT32_C(  1072248007), -INT32_C(       13983),  INT32_C(  1076509020), -INT32_C(       35397) } },
+    { {  INT32_C(   536872980), -INT32_C(   996493459),  INT32_C(   978133247),  INT32_C(  1625395830) },
+      {  INT8_C(  85), -INT8_C(  13), -INT8_C(   1),  INT8_C(   8),  INT8_C(  25),      INT8_MAX,  INT8_C(  33),  INT8_C( 109),  INT8_C(  10),  INT8_C(  13),  INT8_C(  64), -INT8_C( 120), -INT8_C(  91), -INT8_C( 124), -INT8_C(  49),  INT8_C(   4) },
+      { -INT8_C( 120),  INT8_C(   4), -INT8_C(  99), -INT8_C(  26), -INT8_C(  13), -INT8_C(  33),  INT8_C(  90),  INT8_C(  84),  INT8_C(  93), -INT8_C(  33),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),  INT8_C(  36), -INT8_C(  66),  INT8_C(  12) },
+      {  INT32_C(   536838299), -INT32_C(   996485849),  INT32_C(   978133340),  INT32_C(  1625386968) } },
+    { {  INT32_C(    78188235),  INT32_C(     9797776),  INT32_C(   946418548), -INT32_C(   902852980) },
+      {  INT8_C(  77), -INT8_C( 115),  INT8_C(   2),  INT8_C(   2), -INT8_C( 119), -INT8_C(  68), -INT8_C(  19),  INT8_C(  20),  INT8_C(  76), -INT8_C( 111), -INT8_C(   9), -INT8_C(  82),  INT8_C(   2), -INT8_C(   1), -INT8_C(  53),  INT8_C(   0) },
+      { -INT8_C(  52),  INT8_C(   0), -INT8_C(  52), -INT8_C( 109), -INT8_C(  68), -INT8_C( 102), -INT8_C(   3), -INT8_C(  44), -INT8_C(   7), -INT8_C(  54), -INT8_C(  33), -INT8_C(   9),      INT8_MAX, -INT8_C(  98),  INT8_C(  16),  INT8_C(  79) },
+      {  INT32_C(    78183909),  INT32_C(     9767693),  INT32_C(   946400469), -INT32_C(   902874468) } },
+    { { -INT32_C(   565096306), -INT32_C(   732455522),  INT32_C(  1659304457), -INT32_C(  2143152088) },
+      {  INT8_C(   0), -INT8_C(  77), -INT8_C(  49), -INT8_C(   5), -INT8_C( 103), -INT8_C(  41), -INT8_C(  20),  INT8_C(  28), -INT8_C(  25), -INT8_C( 127), -INT8_C(   1),  INT8_C(   0),  INT8_C(  96),  INT8_C(  25),  INT8_C(  49), -INT8_C(  74) },
+      {  INT8_C(  83), -INT8_C(   1), -INT8_C(  77),  INT8_C(  66),  INT8_C( 120),  INT8_C(   8),  INT8_C(  63),  INT8_C(  26), -INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(   2), -INT8_C(  51), -INT8_C(  65), -INT8_C(   9),  INT8_C(  91) },
+      { -INT32_C(   565095858), -INT32_C(   732419846),  INT32_C(  1659303221), -INT32_C(  2143142488) } },
+    { {  INT32_C(      393232),  INT32_C(   976492240), -INT32_C(  1375732485),  INT32_C(  1208516628) },
+      {      INT8_MIN,  INT8_C( 105),  INT8_C(  85), -INT8_C( 108),  INT8_C(   0), -INT8_C(  33), -INT8_C(  89),  INT8_C(   0), -INT8_C(  33), -INT8_C(   5), -INT8_C(  19),  INT8_C( 125), -INT8_C(   9), -INT8_C(  90),  INT8_C(  55), -INT8_C(   3) },
+      {  INT8_C( 118), -INT8_C(  95),      INT8_MIN,  INT8_C(  34),  INT8_C(   9),  INT8_C(   0),  INT8_C(  20),  INT8_C(   0),  INT8_C(  64), -INT8_C(   1),  INT8_C(  81), -INT8_C(  13), -INT8_C(  11), -INT8_C(   1),  INT8_C(   7), -INT8_C(  17) },
+      {  INT32_C(      392513),  INT32_C(   976495580), -INT32_C(  1375700892),  INT32_C(  1208509829) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_dpbusds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   421527553),  INT32_C(     8388608),  INT32_C(  1176071896), -INT32_C(  2009880949) },
+      UINT8_C(234),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(   421527553),  INT32_C(     8518148),  INT32_C(  1176071896), -INT32_C(  2009751409) } },
+    { {  INT32_C(  2147444723), -INT32_C(  2147461831),  INT32_C(  2147458303), -INT32_C(  2147404542) },
+      UINT8_C(102),
+      { -INT8_C(   4), -INT8_C( 118), -INT8_C(   1),      INT8_MIN, -INT8_C(   3),  INT8_C(  28),  INT8_C(  63), -INT8_C(   1),  INT8_C( 126),  INT8_C(   0), -INT8_C( 107), -INT8_C(   1),  INT8_C( 125), -INT8_C(  79),  INT8_C(   0), -INT8_C(   3) },
+      {  INT8_C(   4), -INT8_C( 100), -INT8_C(  17), -INT8_C(   2),  INT8_C(  68), -INT8_C(   9), -INT8_C(   1), -INT8_C(  17),  INT8_C(   0), -INT8_C(  95), -INT8_C(  15), -INT8_C(  17), -INT8_C( 106), -INT8_C(   9),  INT8_C( 125), -INT8_C(   5) },
+      {  INT32_C(  2147444723), -INT32_C(  2147449277),  INT32_C(  2147451733), -INT32_C(  2147404542) } },
+    { { -INT32_C(  2147466154),  INT32_C(  2147403377), -INT32_C(  2147473295),  INT32_C(  2147461159) },
+      UINT8_C(161),
+      {  INT8_C( 119),  INT8_C( 102),  INT8_C(  70), -INT8_C(  65), -INT8_C( 110),  INT8_C(  88), -INT8_C(   1), -INT8_C(  15),  INT8_C(  32), -INT8_C(  33),  INT8_C(  80),  INT8_C(  32),  INT8_C(  93), -INT8_C(   1), -INT8_C( 108), -INT8_C( 127) },
+      {  INT8_C(  82),  INT8_C(  64),  INT8_C(  61), -INT8_C(   9),  INT8_C( 110),  INT8_C(   0), -INT8_C(  86),  INT8_C(   2),  INT8_C(   4), -INT8_C(  77), -INT8_C(   2),  INT8_C(  90), -INT8_C(  13),  INT8_C(   4), -INT8_C(  17),  INT8_C(  57) },
+      { -INT32_C(  2147447317),  INT32_C(  2147403377), -INT32_C(  2147473295),  INT32_C(  2147461159) } },
+    { {  INT32_C(  1220870400),  INT32_C(  1610432511), -INT32_C(  1476395009), -INT32_C(  2147482526) },
+      UINT8_C(127),
+      { -INT8_C(  41), -INT8_C(  33),  INT8_C(   3), -INT8_C( 103), -INT8_C(   3), -INT8_C(  64),  INT8_C(   2), -INT8_C(  50), -INT8_C(  13), -INT8_C(  33), -INT8_C(  64), -INT8_C(  65),  INT8_C( 115),  INT8_C( 116),  INT8_C( 103), -INT8_C( 127) },
+      {  INT8_C(  32),  INT8_C(  74),  INT8_C(   0), -INT8_C(  18),  INT8_C(  40), -INT8_C(   1), -INT8_C(  33),  INT8_C(   0),  INT8_C(   8), -INT8_C( 109),  INT8_C(  77), -INT8_C(  73), -INT8_C(  34), -INT8_C( 112), -INT8_C(  29), -INT8_C(  89) },
+      {  INT32_C(  1220891028),  INT32_C(  1610442373), -INT32_C(  1476416531),            INT32_MIN } },
+    { {  INT32_C(  1774617289), -INT32_C(       65537), -INT32_C(   540759274),  INT32_C(       65569) },
+      UINT8_C(137),
+      {  INT8_C(   8),  INT8_C(  45),  INT8_C(  15), -INT8_C( 120), -INT8_C(  36), -INT8_C(  65), -INT8_C(  17),  INT8_C(  80),  INT8_C(  88), -INT8_C(  91),  INT8_C(  76),  INT8_C(  98),  INT8_C(  31), -INT8_C(   1), -INT8_C(   5),  INT8_C(  32) },
+      { -INT8_C(   9),  INT8_C(  16),  INT8_C(  42), -INT8_C(  33), -INT8_C( 103), -INT8_C(   1), -INT8_C(  99),  INT8_C(  64),  INT8_C(  96), -INT8_C(  28), -INT8_C(  21),  INT8_C(  37),  INT8_C(  76),  INT8_C(  81),  INT8_C(   9), -INT8_C(  25) },
+      {  INT32_C(  1774614079), -INT32_C(       65537), -INT32_C(   540759274),  INT32_C(       90039) } },
+    { {  INT32_C(    34603600),  INT32_C(  1167277727), -INT32_C(   402685965), -INT32_C(    21365889) },
+      UINT8_C(123),
+      { -INT8_C(  33),  INT8_C(  38),  INT8_C(  50), -INT8_C(   1), -INT8_C(   1), -INT8_C(  85), -INT8_C(   1), -INT8_C(  32),  INT8_C(  55), -INT8_C(  22),  INT8_C(   3), -INT8_C(  60), -INT8_C(  12), -INT8_C(   7), -INT8_C(  38), -INT8_C(  19) },
+      { -INT8_C(  41), -INT8_C(  33), -INT8_C(  58),  INT8_C(   0),  INT8_C(  58), -INT8_C(  37), -INT8_C(  33), -INT8_C( 109),  INT8_C(  74), -INT8_C(  17),  INT8_C(   0),  INT8_C(  25),  INT8_C(   2),  INT8_C(  19),      INT8_MAX,      INT8_MAX },
+      {  INT32_C(    34590303),  INT32_C(  1167253359), -INT32_C(   402685965), -INT32_C(    21302885) } },
+    { {  INT32_C(       32832),  INT32_C(     4472832),  INT32_C(  1208057856),  INT32_C(   387390565) },
+      UINT8_C( 13),
+      {  INT8_C(  67),  INT8_C(  77),  INT8_C(  66), -INT8_C(  15),  INT8_C(  10), -INT8_C(  10),  INT8_C(  67), -INT8_C(  14),  INT8_C(   0), -INT8_C(  19),  INT8_C(  34),  INT8_C(   0), -INT8_C(  65), -INT8_C( 113), -INT8_C(  88), -INT8_C( 105) },
+      { -INT8_C(   1),  INT8_C(  83),  INT8_C(  42),  INT8_C(   4),  INT8_C( 104), -INT8_C(  10),  INT8_C( 114), -INT8_C(  27),  INT8_C(  17),  INT8_C(  20), -INT8_C(  33), -INT8_C(   5), -INT8_C( 105), -INT8_C(   8), -INT8_C(  31), -INT8_C(   1) },
+      {  INT32_C(       42892),  INT32_C(     4472832),  INT32_C(  1208061474),  INT32_C(   387364007) } },
+    { { -INT32_C(   850337955), -INT32_C(  2143255289),  INT32_C(      399360), -INT32_C(   385372137) },
+      UINT8_C(201),
+      { -INT8_C( 106), -INT8_C(  66),  INT8_C(   4),  INT8_C( 125), -INT8_C( 107),  INT8_C(   0), -INT8_C(  71),  INT8_C(   8),  INT8_C( 111),  INT8_C(  93), -INT8_C(  26),  INT8_C(  74),  INT8_C(  12),  INT8_C(   4),  INT8_C(  59),  INT8_C(  63) },
+      {  INT8_C(  11), -INT8_C(  26),  INT8_C(   3), -INT8_C(  51), -INT8_C(  14), -INT8_C(  53), -INT8_C(   5),  INT8_C(   2), -INT8_C(   7),  INT8_C(   0),  INT8_C(  44),  INT8_C( 105), -INT8_C(  61),  INT8_C(   0), -INT8_C(  21),  INT8_C(   4) },
+      { -INT32_C(   850347608), -INT32_C(  2143255289),  INT32_C(      399360), -INT32_C(   385373856) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpbusds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   947727351), -INT32_C(       65553), -INT32_C(   477228501),  INT32_C(     1064968) },
+      UINT8_C(110),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(           0),  INT32_C(       63987), -INT32_C(   477359061),  INT32_C(     1194508) } },
+    { {  INT32_C(  2147483199), -INT32_C(  2147386656),  INT32_C(  2147462966), -INT32_C(  2147394221) },
+      UINT8_C( 82),
+      { -INT8_C(   1), -INT8_C(   8),  INT8_C(  78), -INT8_C(   1), -INT8_C( 127), -INT8_C(  17), -INT8_C(  25), -INT8_C(  73),  INT8_C(   0), -INT8_C(  63), -INT8_C(  69),  INT8_C(  78), -INT8_C(  76), -INT8_C(  73), -INT8_C(  63),  INT8_C( 116) },
+      { -INT8_C(   2), -INT8_C(  41),  INT8_C(  21),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0),  INT8_C(   0),      INT8_MAX,  INT8_C(   8), -INT8_C(  17),  INT8_C(   1), -INT8_C(   1), -INT8_C(  48), -INT8_C(  11), -INT8_C(   1), -INT8_C(  81) },
+      {  INT32_C(           0), -INT32_C(  2147355159),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  2147411127),  INT32_C(  2147385877), -INT32_C(  2147391952),  INT32_C(  2147481611) },
+      UINT8_C( 47),
+      {  INT8_C(  56), -INT8_C(  67),  INT8_C(  97), -INT8_C(  21),  INT8_C( 125), -INT8_C(  97), -INT8_C(  19),  INT8_C(  16),  INT8_C(  32), -INT8_C(   2),  INT8_C(  93), -INT8_C(  63), -INT8_C(   1),  INT8_C(  62), -INT8_C(   1),  INT8_C(  16) },
+      { -INT8_C( 117),  INT8_C( 101),  INT8_C(   0),  INT8_C(  58), -INT8_C(  65),  INT8_C(  32), -INT8_C(   2),  INT8_C(   8),  INT8_C(   0),  INT8_C( 110),  INT8_C( 124),  INT8_C(  38), -INT8_C(  40), -INT8_C( 118),  INT8_C(   1),  INT8_C(  50) },
+      { -INT32_C(  2147384960),  INT32_C(  2147382494), -INT32_C(  2147345146),  INT32_C(  2147465150) } },
+    { {  INT32_C(   395740873),  INT32_C(  1535386729), -INT32_C(  1740882631),  INT32_C(   269484160) },
+      UINT8_C( 11),
+      {  INT8_C(   0),  INT8_C(  10), -INT8_C(  73),  INT8_C(  32),  INT8_C(  32), -INT8_C(   1),  INT8_C(  88), -INT8_C(  93),  INT8_C( 125), -INT8_C(   9),  INT8_C(  14),  INT8_C(  53),  INT8_C(   0),  INT8_C(  50),  INT8_C(  10), -INT8_C( 106) },
+      { -INT8_C(  33), -INT8_C(   1), -INT8_C(  25), -INT8_C(   1), -INT8_C(   1),  INT8_C(  53),  INT8_C(   3), -INT8_C( 117),  INT8_C(  32),  INT8_C(   0), -INT8_C(  76), -INT8_C(   7), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) },
+      {  INT32_C(   395736256),  INT32_C(  1535381405),  INT32_C(           0),  INT32_C(   269484000) } },
+    { {  INT32_C(     8388608),  INT32_C(    67186816),  INT32_C(  1050814513), -INT32_C(   134485249) },
+      UINT8_C(177),
+      { -INT8_C(  67), -INT8_C( 111),  INT8_C(  10), -INT8_C(   1),  INT8_C( 123),  INT8_C(   0), -INT8_C(  17), -INT8_C(  13),  INT8_C(   3), -INT8_C(  75), -INT8_C(  49),  INT8_C(   0), -INT8_C(  21), -INT8_C(   1), -INT8_C(  37), -INT8_C( 106) },
+      { -INT8_C( 109),  INT8_C(   0),  INT8_C(   0), -INT8_C(  40), -INT8_C(  11),  INT8_C(   0), -INT8_C(   4),  INT8_C( 122), -INT8_C( 118), -INT8_C( 107),      INT8_MIN,  INT8_C(   4),      INT8_MIN,  INT8_C( 100),  INT8_C(  23),  INT8_C(  45) },
+      {  INT32_C(     8357807),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   536871168), -INT32_C(   268436498), -INT32_C(    59244577), -INT32_C(   245143078) },
+      UINT8_C(225),
+      {  INT8_C(  44), -INT8_C(   3),      INT8_MAX, -INT8_C(   9), -INT8_C(  67), -INT8_C(  15), -INT8_C(   1), -INT8_C(   9), -INT8_C(  65),  INT8_C(  72),  INT8_C(  93),  INT8_C(  23), -INT8_C(  87),  INT8_C(  76), -INT8_C(  77), -INT8_C(  73) },
+      { -INT8_C(  65),      INT8_MAX,  INT8_C(   5), -INT8_C(  43), -INT8_C(  64), -INT8_C(   2), -INT8_C(  34),  INT8_C(   0),  INT8_C(   4), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(  56),  INT8_C( 101) },
+      {  INT32_C(   536890453),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   134479872), -INT32_C(         289), -INT32_C(  2021406321), -INT32_C(        4097) },
+      UINT8_C(222),
+      {  INT8_C(  36), -INT8_C(   2),  INT8_C( 126), -INT8_C(  20),  INT8_C(   0),  INT8_C(  45),  INT8_C( 126),  INT8_C(  16), -INT8_C(  57),  INT8_C(  14), -INT8_C(  56),  INT8_C(   0),  INT8_C( 126),  INT8_C(   8), -INT8_C(  53), -INT8_C(  35) },
+      {  INT8_C(   3), -INT8_C(  57),  INT8_C(  15),  INT8_C(  32),  INT8_C(  95),  INT8_C(  64),  INT8_C(  53),  INT8_C(  76),  INT8_C(  95), -INT8_C(  65), -INT8_C(  56),  INT8_C(   4),  INT8_C(   0),  INT8_C(  77), -INT8_C(  80), -INT8_C( 101) },
+      {  INT32_C(           0),  INT32_C(       10485), -INT32_C(  2021399526), -INT32_C(       42042) } },
+    { {  INT32_C(    34893824), -INT32_C(  1378849909),  INT32_C(  1140858896),  INT32_C(     1066528) },
+      UINT8_C( 41),
+      { -INT8_C(  27), -INT8_C(   1), -INT8_C(  94), -INT8_C(  17), -INT8_C(   3),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0), -INT8_C(  89),  INT8_C(   0),      INT8_MAX,      INT8_MIN,  INT8_C(   8), -INT8_C(   9),  INT8_C(   4),      INT8_MAX },
+      { -INT8_C( 112), -INT8_C(  65),  INT8_C(  71),  INT8_C(  66),  INT8_C(  61), -INT8_C(  65), -INT8_C(  48), -INT8_C(  67),      INT8_MAX,  INT8_C(  25), -INT8_C(  51), -INT8_C( 115), -INT8_C( 114),  INT8_C(  84),  INT8_C( 123), -INT8_C(  84) },
+      {  INT32_C(    34878877),  INT32_C(           0),  INT32_C(           0),  INT32_C(     1076188) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpbusds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int8_t a[32];
+    const int8_t b[32];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   875301319), -INT32_C(    16794121), -INT32_C(   224642118),  INT32_C(   637730824), -INT32_C(     4456449),  INT32_C(   869367458), -INT32_C(  1137314020),  INT32_C(    14778527) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(   875170759), -INT32_C(    16664581), -INT32_C(   224772678),  INT32_C(   637860364), -INT32_C(     4587009),  INT32_C(   869496998), -INT32_C(  1137444580),  INT32_C(    14908067) } },
+    { {  INT32_C(  2147461060), -INT32_C(  2147473505),  INT32_C(  2147438617), -INT32_C(  2147393051),  INT32_C(  2147392757), -INT32_C(  2147426372),  INT32_C(  2147428106), -INT32_C(  2147386290) },
+      {  INT8_C(  85), -INT8_C(   2),  INT8_C( 116), -INT8_C(   3),  INT8_C(  26), -INT8_C(  65), -INT8_C(  62),  INT8_C(  83), -INT8_C(  33),  INT8_C(  80), -INT8_C(  35), -INT8_C(  13),  INT8_C( 125), -INT8_C(   1),  INT8_C(  80), -INT8_C(  35),
+         INT8_C(   0), -INT8_C(  89),  INT8_C(   6), -INT8_C(  18),  INT8_C(   0), -INT8_C(   1),  INT8_C( 125), -INT8_C(  67), -INT8_C(  73), -INT8_C(  50),  INT8_C( 116),  INT8_C(  63),  INT8_C(   1),  INT8_C(   0), -INT8_C(   2),  INT8_C(  13) },
+      {  INT8_C( 118),  INT8_C(  64),  INT8_C(  64),  INT8_C(  40),  INT8_C( 105),  INT8_C(  70), -INT8_C(   3), -INT8_C(  17),  INT8_C(  77),  INT8_C(  12),  INT8_C( 120), -INT8_C(   2),  INT8_C( 122),      INT8_MAX,  INT8_C(  92), -INT8_C(  81),
+         INT8_C(  73), -INT8_C(  65), -INT8_C(  13), -INT8_C(   1), -INT8_C(  17), -INT8_C(   1),  INT8_C(   8),  INT8_C(  54),      INT8_MIN,  INT8_C(  96),  INT8_C(  71),  INT8_C(  71), -INT8_C(  33),  INT8_C(   0),  INT8_C(  16), -INT8_C(  26) },
+      {            INT32_MAX, -INT32_C(  2147459398),  INT32_C(  2147482782), -INT32_C(  2147355957),  INT32_C(  2147381586), -INT32_C(  2147415421),  INT32_C(  2147437167), -INT32_C(  2147382597) } },
+    { { -INT32_C(  2147415471),  INT32_C(  2147443108), -INT32_C(  2147424361),  INT32_C(  2147418300), -INT32_C(  2147435020),  INT32_C(  2147480894), -INT32_C(  2147386682),  INT32_C(  2147468811) },
+      { -INT8_C(   9), -INT8_C(  44),  INT8_C(  32),  INT8_C(   0),  INT8_C(  43),  INT8_C(   0), -INT8_C(  84), -INT8_C(   1),  INT8_C(   4),  INT8_C(  48),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),  INT8_C(  30),  INT8_C(   8), -INT8_C(  97),
+         INT8_C( 123), -INT8_C(  45), -INT8_C(  65), -INT8_C(   2), -INT8_C(   3),  INT8_C(  53), -INT8_C(   9), -INT8_C( 104),  INT8_C( 113), -INT8_C(   1), -INT8_C(  14),      INT8_MIN,  INT8_C(  76),  INT8_C(   4),  INT8_C(   0),  INT8_C(   8) },
+      {  INT8_C(  46), -INT8_C(  27),  INT8_C(   0), -INT8_C(   1), -INT8_C( 121),  INT8_C(  66), -INT8_C(  60),  INT8_C( 117),  INT8_C(  87), -INT8_C(  70), -INT8_C( 105),  INT8_C(   3), -INT8_C(   4), -INT8_C(  31), -INT8_C(  37), -INT8_C(   1),
+         INT8_C(  65),  INT8_C( 111), -INT8_C(  25), -INT8_C(  66),  INT8_C( 112), -INT8_C( 116), -INT8_C(  65),  INT8_C(  68),  INT8_C(   8), -INT8_C(   6), -INT8_C(  33), -INT8_C(   5),  INT8_C(   0),  INT8_C(  73),      INT8_MIN, -INT8_C(  11) },
+      { -INT32_C(  2147409833),  INT32_C(  2147457420), -INT32_C(  2147427277),  INT32_C(  2147416915), -INT32_C(  2147425143),            INT32_MAX, -INT32_C(  2147395934),  INT32_C(  2147469015) } },
+    { { -INT32_C(  1919341134), -INT32_C(  1648078142), -INT32_C(  1703598079), -INT32_C(  1074807253), -INT32_C(   201392421),  INT32_C(  1166016367), -INT32_C(  1725939552),  INT32_C(  1801424012) },
+      {  INT8_C(  67), -INT8_C(   1),  INT8_C(  52), -INT8_C(  74), -INT8_C(   1), -INT8_C(  66), -INT8_C(   3), -INT8_C(   1), -INT8_C(  62),  INT8_C(   1),  INT8_C(   8), -INT8_C(  48), -INT8_C(  13), -INT8_C(  83),  INT8_C(  73), -INT8_C(   1),
+         INT8_C( 111),  INT8_C( 117), -INT8_C(  69),  INT8_C(  18),  INT8_C(  17), -INT8_C( 104), -INT8_C(  48),      INT8_MAX,  INT8_C(   0), -INT8_C(   2), -INT8_C(  81),  INT8_C(  96), -INT8_C(  83),  INT8_C(   0), -INT8_C(  65), -INT8_C(  89) },
+      {  INT8_C(  18), -INT8_C(   1), -INT8_C(   1),  INT8_C(  65), -INT8_C(   3), -INT8_C(   2), -INT8_C(   9), -INT8_C( 108), -INT8_C(  33), -INT8_C( 104),  INT8_C(  76), -INT8_C(   3), -INT8_C(   1),  INT8_C(   8), -INT8_C(  33),      INT8_MAX,
+        -INT8_C(   3),  INT8_C(   0), -INT8_C(   1), -INT8_C(  17),  INT8_C( 111),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0), -INT8_C( 103), -INT8_C(   1), -INT8_C(  39), -INT8_C(  66), -INT8_C(  50),  INT8_C( 102),  INT8_C(  66), -INT8_C(  86) },
+      { -INT32_C(  1919328405), -INT32_C(  1648109104), -INT32_C(  1703604601), -INT32_C(  1074776136), -INT32_C(   201393247),  INT32_C(  1166019918), -INT32_C(  1725952967),  INT32_C(  1801413606) } },
+    { {  INT32_C(    69476352),  INT32_C(   144769026),  INT32_C(      884738),  INT32_C(    16777232), -INT32_C(      131074), -INT32_C(    38127443), -INT32_C(   566545597), -INT32_C(  1290133427) },
+      { -INT8_C( 104), -INT8_C( 104), -INT8_C(   9), -INT8_C(  23), -INT8_C(  65), -INT8_C(   1), -INT8_C(   5), -INT8_C(  56),  INT8_C(  16), -INT8_C(  48),  INT8_C(   0), -INT8_C(   1), -INT8_C(  95),      INT8_MIN, -INT8_C( 115), -INT8_C( 103),
+        -INT8_C(  65), -INT8_C(  91),  INT8_C(   8), -INT8_C(  17), -INT8_C(  85),  INT8_C(   0), -INT8_C(  30), -INT8_C(   2), -INT8_C(   1), -INT8_C(   6),  INT8_C( 121), -INT8_C(   1),  INT8_C(  12),  INT8_C(  79), -INT8_C(   2),  INT8_C(  13) },
+      {  INT8_C( 113), -INT8_C( 105),  INT8_C(  74),  INT8_C(   6),  INT8_C(  41), -INT8_C(  67),  INT8_C(  18), -INT8_C( 113), -INT8_C(  74), -INT8_C(  73),  INT8_C(  70), -INT8_C(  45),  INT8_C(   8), -INT8_C(  33), -INT8_C(   7), -INT8_C(  33),
+         INT8_C(  10),  INT8_C(  83),  INT8_C(  23),  INT8_C(  64),  INT8_C(   1),  INT8_C(  45),  INT8_C(   4),  INT8_C(   0),  INT8_C(   1),  INT8_C(  22), -INT8_C(   1),  INT8_C(   0), -INT8_C(  38), -INT8_C( 113),  INT8_C(   0),  INT8_C(   2) },
+      {  INT32_C(    69497244),  INT32_C(   144741690),  INT32_C(      856895),  INT32_C(    16768260), -INT32_C(       99989), -INT32_C(    38126368), -INT32_C(   566539963), -INT32_C(  1290142784) } },
+    { { -INT32_C(  1276045547), -INT32_C(   811734570), -INT32_C(  1073750018),  INT32_C(   100925516),  INT32_C(  2146270711),  INT32_C(   830474976), -INT32_C(  1778705233), -INT32_C(  2080308696) },
+      { -INT8_C( 109),  INT8_C(  64),  INT8_C(  90), -INT8_C(  29), -INT8_C(  24),      INT8_MIN, -INT8_C(   2), -INT8_C(  46),  INT8_C(  72), -INT8_C(  26), -INT8_C(  49),  INT8_C(  97), -INT8_C(  51),  INT8_C(  16),  INT8_C(   4),  INT8_C(  20),
+         INT8_C(   0), -INT8_C(   2),  INT8_C(  10),  INT8_C(   0), -INT8_C(  57),  INT8_C(   0),  INT8_C(  62), -INT8_C(  61), -INT8_C(   1), -INT8_C(   1),  INT8_C(  69),  INT8_C(  13), -INT8_C( 115), -INT8_C( 117), -INT8_C(  34), -INT8_C(   1) },
+      { -INT8_C(  11),  INT8_C(  43), -INT8_C(  44),  INT8_C(   0), -INT8_C(   5),  INT8_C(  19),  INT8_C(  45),  INT8_C(  34), -INT8_C(  74),  INT8_C( 109),  INT8_C(  81),  INT8_C( 119),  INT8_C(  44), -INT8_C(  16), -INT8_C(  68),  INT8_C(  53),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(  40), -INT8_C(   1),  INT8_C(   0), -INT8_C(  98),  INT8_C(  67),  INT8_C(  70), -INT8_C(  33), -INT8_C(  52),  INT8_C(  16), -INT8_C(   1), -INT8_C(  40),  INT8_C(   0),  INT8_C(   0), -INT8_C(  45) },
+      { -INT32_C(  1276048372), -INT32_C(   811714728), -INT32_C(  1073701966),  INT32_C(   100935068),  INT32_C(  2146270057),  INT32_C(   830492780), -INT32_C(  1778725817), -INT32_C(  2080325811) } },
+    { {  INT32_C(   432873748),  INT32_C(   278780723), -INT32_C(  1974608499),  INT32_C(      887296), -INT32_C(  2145781463), -INT32_C(  1854482865), -INT32_C(  1217662241), -INT32_C(  1621586483) },
+      {  INT8_C(  26),  INT8_C(  16), -INT8_C(   2),  INT8_C(  26),  INT8_C(  40), -INT8_C(   1), -INT8_C(   9), -INT8_C(  53),  INT8_C(   0), -INT8_C(   1),  INT8_C(  48),  INT8_C( 109), -INT8_C(   1),  INT8_C(   6), -INT8_C(  33),  INT8_C(  32),
+             INT8_MAX,  INT8_C(  88),      INT8_MIN,  INT8_C(  20),  INT8_C(  30),  INT8_C(   0),  INT8_C( 108), -INT8_C(   1),  INT8_C(  36), -INT8_C(   1),  INT8_C(  16), -INT8_C(   3), -INT8_C(  66),  INT8_C(  34),  INT8_C(   2), -INT8_C(   9) },
+      { -INT8_C(  40), -INT8_C(   9),  INT8_C(  70),  INT8_C(  38), -INT8_C(  20),  INT8_C(   0), -INT8_C(   3),  INT8_C(  78), -INT8_C( 119),  INT8_C(  10), -INT8_C(  46), -INT8_C(  33), -INT8_C(  62),  INT8_C(  30), -INT8_C(   8),  INT8_C(  14),
+        -INT8_C(  41),  INT8_C( 108),  INT8_C(  41),  INT8_C(  16), -INT8_C(   3),  INT8_C(  16),  INT8_C(  44),  INT8_C(  79),  INT8_C(   0), -INT8_C(  96),  INT8_C(  67),  INT8_C(  69), -INT8_C(  35), -INT8_C(   1), -INT8_C( 123), -INT8_C(  67) },
+      {  INT32_C(   432891332),  INT32_C(   278795016), -INT32_C(  1974611754),  INT32_C(      870330), -INT32_C(  2145771598), -INT32_C(  1854458058), -INT32_C(  1217668192), -INT32_C(  1621609962) } },
+    { { -INT32_C(    77857793),  INT32_C(  2143108990), -INT32_C(   874347029), -INT32_C(   466904779), -INT32_C(   481034942), -INT32_C(  1797403313),  INT32_C(   553262917), -INT32_C(   570783496) },
+      {  INT8_C(  80), -INT8_C(  30),  INT8_C( 120), -INT8_C( 112), -INT8_C(   2), -INT8_C(  41), -INT8_C(  29), -INT8_C(   1),  INT8_C(  68),  INT8_C(   0), -INT8_C(   5), -INT8_C(  47),  INT8_C(  92), -INT8_C(   2),  INT8_C(   2),  INT8_C( 121),
+        -INT8_C(   5), -INT8_C(  49),  INT8_C(   2), -INT8_C(   1), -INT8_C(   2), -INT8_C(  72),  INT8_C(  70), -INT8_C(  65),  INT8_C(  97), -INT8_C( 121), -INT8_C(   1), -INT8_C(   1), -INT8_C( 104),  INT8_C(   2),  INT8_C(   0), -INT8_C(  41) },
+      { -INT8_C(  12),  INT8_C(  32),  INT8_C(  32), -INT8_C(  41),  INT8_C(  37), -INT8_C( 116), -INT8_C(   5),  INT8_C(  29), -INT8_C(   1),  INT8_C( 120),  INT8_C(  66), -INT8_C( 123), -INT8_C( 102),  INT8_C(  64),  INT8_C(   0), -INT8_C(  21),
+         INT8_C(  96),  INT8_C(   1), -INT8_C(   3), -INT8_C(  10),  INT8_C( 104),  INT8_C(   1), -INT8_C(  78),  INT8_C(  45), -INT8_C(   1), -INT8_C(  25), -INT8_C(  49),  INT8_C(  80),  INT8_C( 125),  INT8_C(  49), -INT8_C(  19), -INT8_C(  88) },
+      { -INT32_C(    77853585),  INT32_C(  2143099708), -INT32_C(   874356238), -INT32_C(   466900448), -INT32_C(   481013195), -INT32_C(  1797373578),  INT32_C(   553267350), -INT32_C(   570783318) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpbusds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  1725999101), -INT32_C(  2055359157),  INT32_C(  1433718062), -INT32_C(  1240331616), -INT32_C(      201010),  INT32_C(   686788097),  INT32_C(  1446647824), -INT32_C(     4294401) },
+      UINT8_C( 86),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(  1725999101), -INT32_C(  2055229617),  INT32_C(  1433587502), -INT32_C(  1240331616), -INT32_C(      331570),  INT32_C(   686788097),  INT32_C(  1446517264), -INT32_C(     4294401) } },
+    { {  INT32_C(  2147425684), -INT32_C(  2147421988),  INT32_C(  2147444189), -INT32_C(  2147461295),  INT32_C(  2147433852), -INT32_C(  2147427636),  INT32_C(  2147471901), -INT32_C(  2147461614) },
+      UINT8_C( 18),
+      { -INT8_C(  72), -INT8_C(   4), -INT8_C(  65),  INT8_C(  40), -INT8_C( 119), -INT8_C( 124), -INT8_C(  42),  INT8_C( 111), -INT8_C(  77), -INT8_C(  17),  INT8_C(  16), -INT8_C(  85), -INT8_C(  65), -INT8_C(   5), -INT8_C(   3),  INT8_C(  17),
+         INT8_C(  16),  INT8_C(  30),  INT8_C(  16), -INT8_C(   2),  INT8_C(  60),  INT8_C( 113),  INT8_C(   9), -INT8_C(   1),  INT8_C(  33),  INT8_C(   0), -INT8_C(   1),  INT8_C(  23), -INT8_C(   1), -INT8_C(  45), -INT8_C(   5), -INT8_C(  67) },
+      {  INT8_C(   0), -INT8_C(   2),  INT8_C(   9),  INT8_C(  69), -INT8_C(  80),  INT8_C(  66),  INT8_C(   0), -INT8_C(  24),  INT8_C(  32),  INT8_C(   4), -INT8_C(   3),  INT8_C(   0),  INT8_C(  64),  INT8_C(  44), -INT8_C(  95), -INT8_C(  89),
+        -INT8_C(   1),  INT8_C(  87),  INT8_C(   0),  INT8_C(  62), -INT8_C(  94),  INT8_C( 102), -INT8_C( 121),  INT8_C(   1), -INT8_C(  87),  INT8_C(  53), -INT8_C(  47), -INT8_C(  67), -INT8_C( 115), -INT8_C(   1), -INT8_C(   1), -INT8_C(   7) },
+      {  INT32_C(  2147425684), -INT32_C(  2147426900),  INT32_C(  2147444189), -INT32_C(  2147461295),  INT32_C(  2147452194), -INT32_C(  2147427636),  INT32_C(  2147471901), -INT32_C(  2147461614) } },
+    { { -INT32_C(  2147442469),  INT32_C(  2147482074), -INT32_C(  2147475883),  INT32_C(  2147421737), -INT32_C(  2147400828),  INT32_C(  2147446000), -INT32_C(  2147438399),  INT32_C(  2147422252) },
+      UINT8_C(251),
+      { -INT8_C(  33), -INT8_C(  55),  INT8_C(   3), -INT8_C(  65),  INT8_C(  42), -INT8_C( 104),  INT8_C(  80), -INT8_C(   9),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0), -INT8_C(   3), -INT8_C(  36), -INT8_C(  65),  INT8_C(  27), -INT8_C(   1),
+        -INT8_C(  40), -INT8_C( 106), -INT8_C(  97),  INT8_C(  11), -INT8_C(  42), -INT8_C(   1),  INT8_C(  71),  INT8_C(  39), -INT8_C(   1), -INT8_C(   1),  INT8_C( 117),  INT8_C(  68), -INT8_C( 112), -INT8_C(  71),  INT8_C(  25), -INT8_C(  60) },
+      {  INT8_C(   1), -INT8_C(  38), -INT8_C(  81), -INT8_C(  10),  INT8_C(   2), -INT8_C(  23),  INT8_C(   4),  INT8_C(   7),  INT8_C(  18), -INT8_C(   1),  INT8_C(  99),  INT8_C(  64), -INT8_C(  72),  INT8_C(  60),  INT8_C(   0),  INT8_C(  64),
+        -INT8_C(   9),  INT8_C(   0), -INT8_C(  47),  INT8_C(  28), -INT8_C(  33), -INT8_C(  27),  INT8_C(  40), -INT8_C(   1),  INT8_C(   6),  INT8_C(  16), -INT8_C(  56),  INT8_C(  99), -INT8_C( 111),  INT8_C(  64),  INT8_C(  69), -INT8_C(  19) },
+      { -INT32_C(  2147452037),  INT32_C(  2147480711), -INT32_C(  2147475883),  INT32_C(  2147433677), -INT32_C(  2147409937),  INT32_C(  2147434854), -INT32_C(  2147432609),  INT32_C(  2147416109) } },
+    { { -INT32_C(  1871001017),  INT32_C(  1737295652), -INT32_C(     2114570), -INT32_C(       10243),  INT32_C(   453541889), -INT32_C(   166005472), -INT32_C(          39), -INT32_C(   303054881) },
+      UINT8_C(171),
+      { -INT8_C(  65),      INT8_MIN,  INT8_C(   0), -INT8_C(   1),  INT8_C(  41), -INT8_C(  94), -INT8_C(   7), -INT8_C(  12), -INT8_C(  77),  INT8_C(   0), -INT8_C(  43),  INT8_C(  64),  INT8_C(  10), -INT8_C( 117),  INT8_C(  48),  INT8_C(  67),
+         INT8_C(  32),  INT8_C(   9),      INT8_MIN,      INT8_MAX, -INT8_C(   1), -INT8_C( 108), -INT8_C(  17),  INT8_C(  76),  INT8_C(  30), -INT8_C(   9), -INT8_C(  36), -INT8_C(   9),  INT8_C(   0), -INT8_C(  33), -INT8_C(   1),  INT8_C( 102) },
+      {  INT8_C(  83), -INT8_C(  81),  INT8_C(  46), -INT8_C(   1),  INT8_C(   3), -INT8_C(  12),      INT8_MAX,  INT8_C(  19),  INT8_C(   0), -INT8_C(  89), -INT8_C(  19), -INT8_C(   1),  INT8_C(  30), -INT8_C(  19),  INT8_C(  17), -INT8_C(   1),
+         INT8_C(  24),      INT8_MIN, -INT8_C(  57), -INT8_C(  21), -INT8_C( 114),  INT8_C(  34),  INT8_C( 113), -INT8_C(   1), -INT8_C(  35), -INT8_C(  89),      INT8_MIN, -INT8_C(  33), -INT8_C(  24),  INT8_C(  53), -INT8_C(  28), -INT8_C(   5) },
+      { -INT32_C(  1870995787),  INT32_C(  1737330090), -INT32_C(     2114570), -INT32_C(       11835),  INT32_C(   453541889), -INT32_C(   166002579), -INT32_C(          39), -INT32_C(   303050712) } },
+    { { -INT32_C(   886776526), -INT32_C(   237862438), -INT32_C(  1768997841), -INT32_C(  1075839041),  INT32_C(         136),  INT32_C(  1695759541),  INT32_C(   306708752),  INT32_C(    67108880) },
+      UINT8_C(198),
+      {  INT8_C(   1), -INT8_C(  27),  INT8_C(   3),  INT8_C( 107), -INT8_C(  97),  INT8_C(  40),  INT8_C(   4),  INT8_C(  23), -INT8_C(   1),  INT8_C(  32),  INT8_C(  26),  INT8_C(   0),  INT8_C( 112), -INT8_C(  58),  INT8_C(  61),  INT8_C(  58),
+         INT8_C(  34), -INT8_C( 103),  INT8_C(   0), -INT8_C(   2),      INT8_MIN,  INT8_C(  93),  INT8_C(  32),  INT8_C(  16), -INT8_C(  69),      INT8_MAX,  INT8_C(   1),  INT8_C(  62),  INT8_C(  60),  INT8_C(   0),  INT8_C( 111),  INT8_C(   2) },
+      {  INT8_C(   0),  INT8_C(  91), -INT8_C(  26), -INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(   8),  INT8_C(  18),  INT8_C(  85), -INT8_C(  97), -INT8_C(   1),  INT8_C(   0),  INT8_C(   8), -INT8_C(  39), -INT8_C(  27), -INT8_C(  27),
+         INT8_C(  70), -INT8_C(  99),  INT8_C(  19), -INT8_C(  96),  INT8_C(  56), -INT8_C(   1),  INT8_C(  66),  INT8_C(  76),  INT8_C(   0), -INT8_C(  69),  INT8_C(   2),  INT8_C( 126),  INT8_C(  83),  INT8_C(   8),  INT8_C(  12), -INT8_C(  68) },
+      { -INT32_C(   886776526), -INT32_C(   237861832), -INT32_C(  1768979296), -INT32_C(  1075839041),  INT32_C(         136),  INT32_C(  1695759541),  INT32_C(   306707803),  INT32_C(    67115056) } },
+    { {  INT32_C(         276), -INT32_C(     1048581), -INT32_C(  1947310655), -INT32_C(  1065349120), -INT32_C(  1537481636),  INT32_C(   541213240),  INT32_C(  2145255423), -INT32_C(  1219465819) },
+      UINT8_C( 15),
+      {  INT8_C(  33), -INT8_C( 100),  INT8_C(  29), -INT8_C(  32), -INT8_C(  64),  INT8_C(  55),  INT8_C(   0), -INT8_C(  54),      INT8_MIN,  INT8_C(  57), -INT8_C( 108),  INT8_C(   6), -INT8_C(  73),  INT8_C(  88),  INT8_C(   3),  INT8_C(  14),
+        -INT8_C(  99),  INT8_C(  21),  INT8_C(  68), -INT8_C(  96),  INT8_C(  38), -INT8_C( 113),  INT8_C(  77), -INT8_C(  34), -INT8_C(  78), -INT8_C(   1),  INT8_C(  33), -INT8_C(  96), -INT8_C( 123), -INT8_C(   1),  INT8_C( 112), -INT8_C(  33) },
+      { -INT8_C(  35), -INT8_C(  22),  INT8_C(   4), -INT8_C(  41),  INT8_C( 102), -INT8_C(   1),  INT8_C(  60), -INT8_C(   9),  INT8_C(  16), -INT8_C(   5), -INT8_C(  17), -INT8_C(  30),  INT8_C(   2),  INT8_C(   0), -INT8_C(  20), -INT8_C(  54),
+        -INT8_C(   2), -INT8_C(  33), -INT8_C( 111),  INT8_C(  22),  INT8_C(  89), -INT8_C(   5), -INT8_C(  47),  INT8_C(  22),  INT8_C(  16), -INT8_C(  23), -INT8_C(   5), -INT8_C(   9), -INT8_C(  18), -INT8_C(   2),  INT8_C(  56),  INT8_C(   0) },
+      { -INT32_C(       13379), -INT32_C(     1030870), -INT32_C(  1947311588), -INT32_C(  1065349570), -INT32_C(  1537481636),  INT32_C(   541213240),  INT32_C(  2145255423), -INT32_C(  1219465819) } },
+    { {  INT32_C(       33792),  INT32_C(  2004178338), -INT32_C(   268541993),  INT32_C(   612368393), -INT32_C(   824633396),  INT32_C(   709515265),  INT32_C(   267631790), -INT32_C(     1048577) },
+      UINT8_C( 68),
+      { -INT8_C(  36),      INT8_MIN, -INT8_C(   2),  INT8_C(  44), -INT8_C(  17),  INT8_C(  96), -INT8_C(  65), -INT8_C(   1),  INT8_C(  75), -INT8_C(  65), -INT8_C(   1), -INT8_C(   1),  INT8_C(  39), -INT8_C(  17), -INT8_C(  17), -INT8_C(  48),
+        -INT8_C(   3),  INT8_C(  45),  INT8_C(  73),  INT8_C(  64), -INT8_C(  62),  INT8_C(  36), -INT8_C(   9), -INT8_C( 101),  INT8_C(   0), -INT8_C(  44),  INT8_C(   0),  INT8_C(  32),  INT8_C(  96), -INT8_C(  33),      INT8_MAX,  INT8_C(  96) },
+      {  INT8_C(  70), -INT8_C(   6), -INT8_C(  36),  INT8_C(  55), -INT8_C(  87),  INT8_C(   8),  INT8_C(  48), -INT8_C(  65), -INT8_C(   9), -INT8_C(   4), -INT8_C(   2),  INT8_C(  83), -INT8_C(   7), -INT8_C(   3), -INT8_C(   1),  INT8_C(  94),
+        -INT8_C( 127), -INT8_C(  93),  INT8_C(   0),  INT8_C( 105),  INT8_C(   0),  INT8_C(  94),  INT8_C(  50), -INT8_C(  60),  INT8_C(   0), -INT8_C(   1), -INT8_C(  34),  INT8_C( 121), -INT8_C(   1), -INT8_C(  32), -INT8_C(  27),  INT8_C(  69) },
+      {  INT32_C(       33792),  INT32_C(  2004178338), -INT32_C(   268522777),  INT32_C(   612368393), -INT32_C(   824633396),  INT32_C(   709515265),  INT32_C(   267635450), -INT32_C(     1048577) } },
+    { { -INT32_C(     1052801), -INT32_C(     2105613), -INT32_C(  1434156674), -INT32_C(      791561),  INT32_C(  1879048155),  INT32_C(   134513672), -INT32_C(   905301254), -INT32_C(    75501569) },
+      UINT8_C( 91),
+      { -INT8_C(  98), -INT8_C(  22),  INT8_C(   2),  INT8_C(  36),  INT8_C(  77),  INT8_C(   4),  INT8_C(   0), -INT8_C( 112), -INT8_C( 103),  INT8_C(  50), -INT8_C(  85),  INT8_C( 102), -INT8_C( 113),  INT8_C(   0),  INT8_C(  98), -INT8_C(  88),
+        -INT8_C(   1), -INT8_C(  30),  INT8_C(  58),  INT8_C(  67),  INT8_C(  67),  INT8_C(  49), -INT8_C(   1),  INT8_C(  68), -INT8_C(  47),  INT8_C(  55), -INT8_C( 102),  INT8_C(  34), -INT8_C( 105),  INT8_C(  32),  INT8_C(   0), -INT8_C(   2) },
+      { -INT8_C(  17),  INT8_C(   0),  INT8_C(  54), -INT8_C(   5), -INT8_C(  69),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44), -INT8_C(   3), -INT8_C( 125), -INT8_C(   1), -INT8_C(   1),  INT8_C(  23),  INT8_C(  32), -INT8_C(   1), -INT8_C(  16),
+         INT8_C(   0), -INT8_C( 114), -INT8_C(  65), -INT8_C(  39), -INT8_C( 126), -INT8_C(  96), -INT8_C( 122), -INT8_C( 123),  INT8_C(  97), -INT8_C(  13), -INT8_C(  41), -INT8_C(  52),  INT8_C( 124),  INT8_C(  32), -INT8_C(  33), -INT8_C(   2) },
+      { -INT32_C(     1055559), -INT32_C(     2104590), -INT32_C(  1434156674), -INT32_C(      791058),  INT32_C(  1879016008),  INT32_C(   134513672), -INT32_C(   905289778), -INT32_C(    75501569) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpbusds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  1251957444), -INT32_C(   343932929), -INT32_C(   142608385),  INT32_C(     1294340),  INT32_C(  1374191126), -INT32_C(   227959073), -INT32_C(   337675265),  INT32_C(  1073745936) },
+      UINT8_C( 73),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      { -INT32_C(  1252088004),  INT32_C(           0),  INT32_C(           0),  INT32_C(     1423880),  INT32_C(           0),  INT32_C(           0), -INT32_C(   337805825),  INT32_C(           0) } },
+    { {  INT32_C(  2147391928), -INT32_C(  2147479304),  INT32_C(  2147419539), -INT32_C(  2147394092),  INT32_C(  2147401804), -INT32_C(  2147412588),  INT32_C(  2147474793), -INT32_C(  2147392473) },
+      UINT8_C(246),
+      { -INT8_C(  93), -INT8_C(  80), -INT8_C(   9),  INT8_C(  68), -INT8_C(  40), -INT8_C(  66), -INT8_C( 113), -INT8_C( 126), -INT8_C(  97),  INT8_C(  32),  INT8_C(   0),  INT8_C( 112), -INT8_C(  65), -INT8_C(   1),  INT8_C(   7),  INT8_C(  48),
+        -INT8_C(  81),  INT8_C(  63), -INT8_C(   1), -INT8_C(   5), -INT8_C(  92), -INT8_C(  94),  INT8_C(  85), -INT8_C( 120), -INT8_C( 126), -INT8_C(  70), -INT8_C(  21), -INT8_C(   1), -INT8_C(  19), -INT8_C(  60),  INT8_C(   0), -INT8_C( 121) },
+      { -INT8_C(  42),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50), -INT8_C(   1),  INT8_C(  95),  INT8_C(  42), -INT8_C(  93), -INT8_C(   1),  INT8_C(   4),  INT8_C(  34), -INT8_C(   4), -INT8_C( 126), -INT8_C(  62),  INT8_C(  40), -INT8_C(   5),
+         INT8_C( 103),  INT8_C( 122), -INT8_C( 113),  INT8_C(  68), -INT8_C(  70), -INT8_C(  87),  INT8_C(  82),  INT8_C(  65),  INT8_C(   8), -INT8_C( 104),  INT8_C(  88), -INT8_C(  45),  INT8_C(  65), -INT8_C(  96), -INT8_C(  24),  INT8_C( 116) },
+      {  INT32_C(           0), -INT32_C(  2147467554),  INT32_C(  2147419060),  INT32_C(           0),  INT32_C(  2147415768), -INT32_C(  2147422352),  INT32_C(  2147465694), -INT32_C(  2147380224) } },
+    { { -INT32_C(  2147385969),  INT32_C(  2147414523), -INT32_C(  2147384629),  INT32_C(  2147427455), -INT32_C(  2147435390),  INT32_C(  2147399284), -INT32_C(  2147393851),  INT32_C(  2147457138) },
+      UINT8_C( 43),
+      { -INT8_C(  81), -INT8_C(  67),  INT8_C(   0), -INT8_C(  21), -INT8_C(  13),  INT8_C(   0),      INT8_MIN, -INT8_C(  52),      INT8_MAX,  INT8_C(   0),  INT8_C(  24), -INT8_C(   1),  INT8_C(  46), -INT8_C(  72), -INT8_C(   9), -INT8_C(   1),
+         INT8_C(   4), -INT8_C(  28),  INT8_C(  81),  INT8_C(  59), -INT8_C(  11), -INT8_C(  53),  INT8_C(  72),  INT8_C( 122), -INT8_C(  67), -INT8_C( 111),  INT8_C(  98), -INT8_C( 115), -INT8_C(   1), -INT8_C(  64), -INT8_C(   2),  INT8_C(   8) },
+      { -INT8_C( 106), -INT8_C(   1), -INT8_C( 126),      INT8_MIN,  INT8_C(  16), -INT8_C(  17), -INT8_C(   1), -INT8_C( 127), -INT8_C(  93), -INT8_C(   1),      INT8_MIN, -INT8_C(  69), -INT8_C(   1),  INT8_C(  69),  INT8_C(   2),  INT8_C(  17),
+         INT8_C(   0),  INT8_C(  95), -INT8_C( 108),  INT8_C(  42), -INT8_C(   3), -INT8_C(  67),  INT8_C(   0),  INT8_C(   8),  INT8_C(  18), -INT8_C(  97), -INT8_C(  96),  INT8_C(   0),  INT8_C( 122), -INT8_C(  64), -INT8_C(  28),  INT8_C(  15) },
+      { -INT32_C(  2147434788),  INT32_C(  2147392375),  INT32_C(           0),  INT32_C(  2147444934),  INT32_C(           0),  INT32_C(  2147385924),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1509610503),  INT32_C(  1252496386),  INT32_C(   974845750), -INT32_C(  1347564459),  INT32_C(           4), -INT32_C(   201326593),  INT32_C(  1915218482),  INT32_C(   238457866) },
+      UINT8_C(201),
+      { -INT8_C(   9), -INT8_C(   7),  INT8_C(  37), -INT8_C(  48), -INT8_C(  66), -INT8_C(   1),  INT8_C(  55),  INT8_C(  34),  INT8_C(  58), -INT8_C(   1), -INT8_C(  93),  INT8_C( 111), -INT8_C(  54),  INT8_C(  60),  INT8_C(  48), -INT8_C( 108),
+         INT8_C(  75),  INT8_C(  55),  INT8_C(  65),  INT8_C(   0),  INT8_C(  66),      INT8_MAX, -INT8_C(  35), -INT8_C( 104),  INT8_C(  40), -INT8_C(  29), -INT8_C(   1),  INT8_C(   2),  INT8_C(  35), -INT8_C(   9), -INT8_C(  33),  INT8_C( 125) },
+      {  INT8_C(   0), -INT8_C(  92),  INT8_C(  72), -INT8_C(  78), -INT8_C(  65), -INT8_C( 118),  INT8_C(  12), -INT8_C(   9),  INT8_C(   0), -INT8_C(  41),  INT8_C(   0), -INT8_C(   5),  INT8_C(  83),  INT8_C(  25), -INT8_C(  48), -INT8_C(  65),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(  64),  INT8_C(  80), -INT8_C(   5),  INT8_C(   0),  INT8_C( 107),  INT8_C(  13),      INT8_MIN,  INT8_C( 113),  INT8_C( 119), -INT8_C(  47),  INT8_C(   2),  INT8_C(  16), -INT8_C(   9),  INT8_C(   0) },
+      { -INT32_C(  1509646971),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1347558117),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1915269264),  INT32_C(   238459881) } },
+    { { -INT32_C(  1056121316),  INT32_C(   697919463),  INT32_C(   627853773), -INT32_C(   675279281),  INT32_C(   139067520), -INT32_C(    18874369), -INT32_C(      131169),  INT32_C(   135528464) },
+      UINT8_C(136),
+      { -INT8_C(  56), -INT8_C( 127), -INT8_C(  37),  INT8_C( 113),  INT8_C(   8),  INT8_C(   0), -INT8_C(   9),  INT8_C( 111),  INT8_C( 120),  INT8_C( 101),  INT8_C(  65), -INT8_C(  40),  INT8_C(  95), -INT8_C(  46),  INT8_C(  47), -INT8_C(   3),
+        -INT8_C(  43), -INT8_C(   3),  INT8_C( 102), -INT8_C(  59), -INT8_C(  99),  INT8_C(   4),  INT8_C(  18), -INT8_C(  65), -INT8_C(  25), -INT8_C(  59),  INT8_C(  29), -INT8_C(  66), -INT8_C(   1),  INT8_C(  25), -INT8_C(  99),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(  81), -INT8_C(   1), -INT8_C(  65),  INT8_C(  58),  INT8_C(  62), -INT8_C(   1), -INT8_C(   5), -INT8_C( 124), -INT8_C(  35), -INT8_C(   1),  INT8_C(  15),  INT8_C(   0),  INT8_C(  83),  INT8_C( 109),  INT8_C(  85),
+        -INT8_C(  18), -INT8_C( 104),  INT8_C(  29),  INT8_C(  89),  INT8_C(   0), -INT8_C(   3), -INT8_C(  33), -INT8_C(   1),  INT8_C(   0), -INT8_C(  84), -INT8_C(  82), -INT8_C(  18),  INT8_C(  65), -INT8_C(   1), -INT8_C(  47), -INT8_C(  90) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   675235223),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   135537635) } },
+    { {  INT32_C(    39977088), -INT32_C(     4259905),  INT32_C(    12845056),  INT32_C(     4115200), -INT32_C(  2093747697), -INT32_C(  1610883073), -INT32_C(  1355054217),  INT32_C(       32768) },
+      UINT8_C( 38),
+      {  INT8_C(  64), -INT8_C(  19), -INT8_C( 112),  INT8_C(  68), -INT8_C(  77),  INT8_C(  57),  INT8_C(  45),  INT8_C(  49),  INT8_C(  15),  INT8_C(  10),  INT8_C(   0), -INT8_C(   1),  INT8_C(  64), -INT8_C( 100),  INT8_C(   5),  INT8_C(   0),
+         INT8_C(  16),      INT8_MIN, -INT8_C(  57), -INT8_C(  95), -INT8_C(   2), -INT8_C(   1), -INT8_C(  17),  INT8_C(  32),  INT8_C(  28),  INT8_C(  64),  INT8_C(  41),  INT8_C(  96),  INT8_C(  82),  INT8_C(   0),  INT8_C(  99), -INT8_C(   1) },
+      { -INT8_C(  88), -INT8_C(  65), -INT8_C(   1), -INT8_C(   1),  INT8_C(  32), -INT8_C(  87),  INT8_C(  33), -INT8_C(  69), -INT8_C(   1), -INT8_C(  87),  INT8_C(   4),  INT8_C(   0), -INT8_C(   4), -INT8_C(  58),      INT8_MIN,  INT8_C(  67),
+         INT8_C(  49), -INT8_C( 101),  INT8_C(   2),  INT8_C(  64), -INT8_C(   1),  INT8_C(   0), -INT8_C(   9), -INT8_C( 127),  INT8_C(  32), -INT8_C(  94),  INT8_C( 110), -INT8_C(  17), -INT8_C(  28), -INT8_C(  67), -INT8_C(   5),  INT8_C(  70) },
+      {  INT32_C(           0), -INT32_C(     4261032),  INT32_C(    12844171),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1610889542),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1212284947),  INT32_C(       40192), -INT32_C(  1918594793),  INT32_C(    35659776), -INT32_C(    25167873), -INT32_C(   998945114), -INT32_C(   976820570), -INT32_C(   100663313) },
+      UINT8_C( 13),
+      { -INT8_C(  89), -INT8_C(  65), -INT8_C(   3),  INT8_C(   1), -INT8_C(   7),  INT8_C(  53), -INT8_C(   3), -INT8_C(   3), -INT8_C(  17),  INT8_C(   0),  INT8_C(  84), -INT8_C(   1),  INT8_C(   2), -INT8_C( 107),  INT8_C( 109), -INT8_C(  61),
+         INT8_C(   4), -INT8_C(  33), -INT8_C(  75),      INT8_MIN,  INT8_C(   0),  INT8_C( 110), -INT8_C(   9), -INT8_C( 120),  INT8_C(   2),  INT8_C(  26),  INT8_C(  24), -INT8_C(   6),  INT8_C(   1),  INT8_C( 111), -INT8_C(   9), -INT8_C(  17) },
+      {  INT8_C( 108), -INT8_C(   1),  INT8_C(   8), -INT8_C(  51),  INT8_C(   1), -INT8_C(  10),  INT8_C(  98), -INT8_C(  97),  INT8_C( 102),  INT8_C(  19),  INT8_C(  76),  INT8_C(  44), -INT8_C(  81),  INT8_C(   4),  INT8_C(  61), -INT8_C(  44),
+        -INT8_C( 108), -INT8_C( 115), -INT8_C(   1),  INT8_C(  76), -INT8_C(   9), -INT8_C(  20), -INT8_C(   1), -INT8_C(   5), -INT8_C(   1),  INT8_C(  24),  INT8_C(   0), -INT8_C(  93),  INT8_C( 111),  INT8_C(  74), -INT8_C( 101), -INT8_C(   7) },
+      { -INT32_C(  1212265129),  INT32_C(           0), -INT32_C(  1918552811),  INT32_C(    35658279),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(     1198209),  INT32_C(  2011466585),  INT32_C(  1625423501),  INT32_C(  1301702010), -INT32_C(  1265204836), -INT32_C(  1942342108), -INT32_C(  2030232018), -INT32_C(   138412307) },
+      UINT8_C( 79),
+      { -INT8_C(  51), -INT8_C( 125), -INT8_C(   1), -INT8_C(  38),      INT8_MIN, -INT8_C(  54), -INT8_C(   1),  INT8_C(   0), -INT8_C(  95), -INT8_C(  17),  INT8_C( 125),  INT8_C(  46), -INT8_C(   1), -INT8_C( 109),  INT8_C(   8),  INT8_C( 102),
+         INT8_C(  16), -INT8_C(  65),  INT8_C(  41), -INT8_C(   2), -INT8_C(   1),  INT8_C( 123),  INT8_C(   8),  INT8_C(  98), -INT8_C(  80),  INT8_C( 119), -INT8_C(  67),      INT8_MIN, -INT8_C(  81),  INT8_C(  10), -INT8_C(  62), -INT8_C( 109) },
+      {  INT8_C(  24), -INT8_C(   1),  INT8_C(   0),  INT8_C(  56),  INT8_C(  80),  INT8_C(  56),  INT8_C(  62),  INT8_C(   7),  INT8_C( 124),  INT8_C( 110),  INT8_C( 117),  INT8_C(  36), -INT8_C(  27),  INT8_C( 120), -INT8_C( 104),  INT8_C(   5),
+         INT8_C(  43),  INT8_C(   0),  INT8_C(   4), -INT8_C(   1),  INT8_C(  16), -INT8_C( 110),      INT8_MAX,  INT8_C(   8), -INT8_C(   1), -INT8_C(  86),  INT8_C(  41), -INT8_C(   4),  INT8_C(  40), -INT8_C( 111),  INT8_C(   0), -INT8_C(  88) },
+      { -INT32_C(     1181212),  INT32_C(  2011503947),  INT32_C(  1625486036),  INT32_C(  1301712443),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2030235191),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpbusds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int8_t a[64];
+    const int8_t b[64];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(     1444864),  INT32_C(  1140850697), -INT32_C(  2005089561), -INT32_C(     8486945),  INT32_C(   134221952),  INT32_C(   134393888),  INT32_C(       17416),  INT32_C(   810899706),
+         INT32_C(  1924567679), -INT32_C(  1254812515),  INT32_C(   525994662), -INT32_C(  1519301196),  INT32_C(    40113661),  INT32_C(   171996594),  INT32_C(   134479872), -INT32_C(  1207992385) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(     1314304),  INT32_C(  1140980237), -INT32_C(  2005220121), -INT32_C(     8357405),  INT32_C(   134091392),  INT32_C(   134523428), -INT32_C(      113144),  INT32_C(   811029246),
+         INT32_C(  1924437119), -INT32_C(  1254682975),  INT32_C(   525864102), -INT32_C(  1519171656),  INT32_C(    39983101),  INT32_C(   172126134),  INT32_C(   134349312), -INT32_C(  1207862845) } },
+    { {  INT32_C(  2147471602), -INT32_C(  2147428988),  INT32_C(  2147474080), -INT32_C(  2147387020),  INT32_C(  2147386590), -INT32_C(  2147470909),  INT32_C(  2147457445), -INT32_C(  2147436790),
+         INT32_C(  2147453602), -INT32_C(  2147427717),  INT32_C(  2147419175), -INT32_C(  2147481541),  INT32_C(  2147458804), -INT32_C(  2147403115),  INT32_C(  2147473465), -INT32_C(  2147386052) },
+      {  INT8_C(   3), -INT8_C(  11),  INT8_C(   8),  INT8_C(   0), -INT8_C(  38),  INT8_C(   9),      INT8_MAX, -INT8_C(   1), -INT8_C(  77),  INT8_C(   6), -INT8_C(  37),  INT8_C(  71), -INT8_C(  68),  INT8_C(  44),  INT8_C(  14), -INT8_C(   3),
+         INT8_C( 126),  INT8_C(  50),  INT8_C(   0), -INT8_C(  73), -INT8_C(   7), -INT8_C( 117), -INT8_C(   3),  INT8_C(   8),  INT8_C(  32),  INT8_C(  80),  INT8_C(  91),  INT8_C( 108),  INT8_C( 104), -INT8_C(  68), -INT8_C(  39),  INT8_C(  37),
+         INT8_C(  47),  INT8_C(  83), -INT8_C( 125),  INT8_C(  21),  INT8_C(  14),  INT8_C(  63),  INT8_C(   0),  INT8_C(  36),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0), -INT8_C(  26), -INT8_C(   5),  INT8_C( 111),
+         INT8_C(   0),  INT8_C(  18), -INT8_C( 107),  INT8_C( 120), -INT8_C( 124), -INT8_C(   1), -INT8_C(   2), -INT8_C(   1), -INT8_C(   1),  INT8_C(  64),      INT8_MIN, -INT8_C(  56), -INT8_C(  53),  INT8_C(  53),  INT8_C( 118),  INT8_C( 121) },
+      { -INT8_C(  60), -INT8_C(  63), -INT8_C(   1), -INT8_C(  44),      INT8_MAX, -INT8_C(   1), -INT8_C(   3),  INT8_C(   8),  INT8_C(  72),  INT8_C(  12),  INT8_C( 110),  INT8_C(  85),  INT8_C(   8),  INT8_C(  16),  INT8_C(  89), -INT8_C(  96),
+         INT8_C( 114), -INT8_C(  53),  INT8_C( 118),  INT8_C(  92),  INT8_C(   1), -INT8_C(   1),  INT8_C(   1),  INT8_C(   8),  INT8_C(  45),  INT8_C(  13),  INT8_C(   0),  INT8_C( 115), -INT8_C(   4), -INT8_C(  54), -INT8_C(   2), -INT8_C(   3),
+        -INT8_C(   5), -INT8_C(  94),  INT8_C( 107), -INT8_C(  33), -INT8_C(   1),  INT8_C(  81),  INT8_C( 119), -INT8_C(   1), -INT8_C( 126),  INT8_C(  17), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(  73), -INT8_C(  73),  INT8_C(   5),
+        -INT8_C(   1),      INT8_MIN, -INT8_C(   1), -INT8_C(  59),  INT8_C(  65),  INT8_C(   0), -INT8_C(   1), -INT8_C(  34), -INT8_C(  23),      INT8_MAX,  INT8_C(   0),  INT8_C(   0), -INT8_C(  28), -INT8_C(  26),  INT8_C(   4),  INT8_C(  63) },
+      {  INT32_C(  2147455979), -INT32_C(  2147399652),            INT32_MAX, -INT32_C(  2147407854),  INT32_C(  2147415140), -INT32_C(  2147470482),  INT32_C(  2147472345), -INT32_C(  2147447903),
+         INT32_C(  2147458889), -INT32_C(  2147422664),  INT32_C(  2147407075),            INT32_MIN,  INT32_C(  2147449271), -INT32_C(  2147403459),  INT32_C(  2147475728), -INT32_C(  2147385019) } },
+    { { -INT32_C(  2147476617),  INT32_C(  2147423272), -INT32_C(  2147393588),  INT32_C(  2147483077), -INT32_C(  2147395133),  INT32_C(  2147409498), -INT32_C(  2147429407),  INT32_C(  2147448467),
+        -INT32_C(  2147394407),  INT32_C(  2147453115), -INT32_C(  2147477812),  INT32_C(  2147433641), -INT32_C(  2147460342),  INT32_C(  2147429164), -INT32_C(  2147466201),  INT32_C(  2147441410) },
+      {      INT8_MAX,  INT8_C(  16), -INT8_C(  10), -INT8_C(  51),  INT8_C(  70), -INT8_C(   1), -INT8_C(  34), -INT8_C(   1),  INT8_C(   1),  INT8_C(  32),  INT8_C(  32), -INT8_C(  65),  INT8_C(  19),  INT8_C(   0), -INT8_C(   5), -INT8_C( 126),
+        -INT8_C(  45),  INT8_C(   0), -INT8_C(  35),  INT8_C( 106), -INT8_C(  81), -INT8_C(   1),  INT8_C(   0),  INT8_C(  98),  INT8_C( 117),  INT8_C(   0),  INT8_C(  40), -INT8_C(  26),      INT8_MAX,  INT8_C(   4),  INT8_C(   9), -INT8_C(   1),
+         INT8_C(  79),  INT8_C(   0),      INT8_MIN,  INT8_C(   0), -INT8_C(  59), -INT8_C(  18),  INT8_C(  45), -INT8_C(  21),  INT8_C(   0),  INT8_C( 111), -INT8_C(  80),  INT8_C(   8),  INT8_C(   1), -INT8_C(  65), -INT8_C(   8), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(  16),  INT8_C(  18), -INT8_C(   6), -INT8_C(  39), -INT8_C(  15),  INT8_C(   0),  INT8_C( 118),  INT8_C(  27), -INT8_C(  23),  INT8_C(   1),  INT8_C(  34), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(  85),  INT8_C(  63),  INT8_C(  15),  INT8_C( 109), -INT8_C(   1),  INT8_C(  32),  INT8_C(  11),  INT8_C(  85), -INT8_C(  64),  INT8_C(  41),  INT8_C(   0),  INT8_C(   8),  INT8_C(  16),  INT8_C(  76), -INT8_C(  17),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  50),  INT8_C(   6), -INT8_C( 120), -INT8_C(  21),  INT8_C( 116), -INT8_C(  72),  INT8_C(  94),  INT8_C(  42),      INT8_MAX,  INT8_C(  16), -INT8_C(  79),  INT8_C(   4),  INT8_C(  62), -INT8_C(  73),  INT8_C( 122),
+        -INT8_C(   1),  INT8_C(   0), -INT8_C(  93), -INT8_C(  17), -INT8_C(  58), -INT8_C(   2), -INT8_C(  29), -INT8_C(  90),  INT8_C(  40), -INT8_C(  41),  INT8_C(  58), -INT8_C(   1), -INT8_C(  65),      INT8_MIN, -INT8_C( 127),  INT8_C(  86),
+         INT8_C(  26),  INT8_C(   0), -INT8_C(  68),  INT8_C(  14), -INT8_C(  86),  INT8_C(  64),  INT8_C(   4), -INT8_C(  21), -INT8_C(   1), -INT8_C(  92),  INT8_C( 100),  INT8_C(  42), -INT8_C(  41), -INT8_C(  41), -INT8_C(   2),  INT8_C(   0) },
+      { -INT32_C(  2147438779),  INT32_C(  2147455479), -INT32_C(  2147390812),  INT32_C(  2147479114), -INT32_C(  2147406527),  INT32_C(  2147444615), -INT32_C(  2147442023),  INT32_C(  2147479676),
+        -INT32_C(  2147406390),  INT32_C(  2147418758), -INT32_C(  2147472163),  INT32_C(  2147399562), -INT32_C(  2147456982),  INT32_C(  2147439423), -INT32_C(  2147464571),  INT32_C(  2147439465) } },
+    { { -INT32_C(      524547),  INT32_C(  1845788688),  INT32_C(         194), -INT32_C(   563400142), -INT32_C(   268697601), -INT32_C(   908059076), -INT32_C(  1384048429), -INT32_C(  1348308304),
+         INT32_C(    67633664), -INT32_C(   140509221),  INT32_C(   810714114),  INT32_C(  1837092799), -INT32_C(   243239940), -INT32_C(   314796556), -INT32_C(   246294040), -INT32_C(           2) },
+      {  INT8_C(  16),  INT8_C(   0),  INT8_C(  31),  INT8_C(   0), -INT8_C(  11), -INT8_C(  50), -INT8_C( 124), -INT8_C(  43),  INT8_C(   0), -INT8_C( 115), -INT8_C(   4), -INT8_C(   1), -INT8_C(   3),  INT8_C(  16),  INT8_C(  24),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(  33), -INT8_C(  10),  INT8_C(   1),  INT8_C(  38), -INT8_C(  73),  INT8_C( 113), -INT8_C(  17),  INT8_C(  31), -INT8_C(  18),  INT8_C(  83), -INT8_C(  34),  INT8_C(   0), -INT8_C( 117), -INT8_C(  49), -INT8_C(  41),
+         INT8_C( 125),  INT8_C(   0),  INT8_C( 119),  INT8_C(  12),  INT8_C(  57),  INT8_C(   2),  INT8_C(  88),  INT8_C(  64), -INT8_C(  79),      INT8_MAX, -INT8_C(  17),  INT8_C(  14), -INT8_C(   9),  INT8_C(  54), -INT8_C( 105), -INT8_C(   5),
+        -INT8_C(   3),  INT8_C(  23), -INT8_C(  17),  INT8_C(   0), -INT8_C( 101),  INT8_C(  35), -INT8_C( 119),  INT8_C(  45), -INT8_C(   9), -INT8_C(   1),  INT8_C(  10),  INT8_C( 104),  INT8_C(  77),  INT8_C(   0), -INT8_C(  56),  INT8_C(  92) },
+      {  INT8_C(  16),  INT8_C(  35),      INT8_MAX,  INT8_C(   3), -INT8_C(  33),  INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(  24),  INT8_C(   0),  INT8_C(   9), -INT8_C(  62), -INT8_C(  84),  INT8_C(  74),  INT8_C( 105), -INT8_C(  17),
+         INT8_C(  98),  INT8_C(  18), -INT8_C(   1),  INT8_C(   1), -INT8_C(   8), -INT8_C(   1), -INT8_C( 126), -INT8_C(  67), -INT8_C(  61), -INT8_C(   1), -INT8_C(  82),  INT8_C(  27), -INT8_C(   1), -INT8_C(   3),  INT8_C(  32), -INT8_C(   3),
+         INT8_C(   0), -INT8_C(   3), -INT8_C(   1), -INT8_C(   1), -INT8_C(   5), -INT8_C(  49), -INT8_C(  70), -INT8_C( 119),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5), -INT8_C(  43),  INT8_C(  92), -INT8_C( 115), -INT8_C(  77), -INT8_C(   1),
+         INT8_C(   1), -INT8_C(   2), -INT8_C(   1),  INT8_C(  17),  INT8_C(   8), -INT8_C(   1),  INT8_C(   0), -INT8_C( 103),  INT8_C(  45),  INT8_C(   0), -INT8_C(   3),  INT8_C( 113), -INT8_C(  65),  INT8_C(  75),  INT8_C(   3),  INT8_C(   0) },
+      { -INT32_C(      520354),  INT32_C(  1845793574), -INT32_C(       13348), -INT32_C(   563417690), -INT32_C(   268668842), -INT32_C(   908089814), -INT32_C(  1384051370), -INT32_C(  1348302742),
+         INT32_C(    67633533), -INT32_C(   140523380),  INT32_C(   810712317),  INT32_C(  1837097435), -INT32_C(   243239972), -INT32_C(   314799986), -INT32_C(   246271203), -INT32_C(        4407) } },
+    { { -INT32_C(      131585), -INT32_C(  1249735916), -INT32_C(   272638017), -INT32_C(  1073742345),  INT32_C(     9536528), -INT32_C(  1711282177), -INT32_C(    68265103),  INT32_C(  1238093298),
+         INT32_C(   536880192), -INT32_C(   342681969),  INT32_C(  1115613920), -INT32_C(   994882644),  INT32_C(  1235804789), -INT32_C(           1), -INT32_C(       18513),  INT32_C(         768) },
+      {  INT8_C(  22),  INT8_C(   0),  INT8_C(  65),  INT8_C( 111), -INT8_C(  29), -INT8_C( 124),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C( 119),  INT8_C(  41), -INT8_C(   1),  INT8_C(   0), -INT8_C(  77), -INT8_C(  99), -INT8_C(   3),
+         INT8_C(  39), -INT8_C( 120), -INT8_C(  97), -INT8_C(  17),  INT8_C(  64), -INT8_C(  26),  INT8_C(  69),  INT8_C(   0), -INT8_C(  65), -INT8_C(   2), -INT8_C(  43), -INT8_C(   1), -INT8_C(  37),  INT8_C(   0),  INT8_C( 121),  INT8_C(  26),
+         INT8_C(  17), -INT8_C(   1), -INT8_C(   1),  INT8_C(  91), -INT8_C(  11), -INT8_C(  35), -INT8_C(   1), -INT8_C(   1),  INT8_C(  59),  INT8_C(  16), -INT8_C( 124),  INT8_C(  65), -INT8_C(  61), -INT8_C(  11), -INT8_C(   2),  INT8_C(  10),
+         INT8_C(   7), -INT8_C( 104),  INT8_C(   0), -INT8_C(  21), -INT8_C(  14),  INT8_C(  14),  INT8_C(  95),  INT8_C(   0),  INT8_C(  88),  INT8_C(  32), -INT8_C(   9), -INT8_C(   1),  INT8_C(   1),  INT8_C(  12),  INT8_C(  93),  INT8_C( 118) },
+      {  INT8_C(  20), -INT8_C(  33), -INT8_C(   4),  INT8_C(   2),  INT8_C(  10), -INT8_C(  17),  INT8_C(  24), -INT8_C(  11),      INT8_MAX, -INT8_C(   1),  INT8_C(  76),  INT8_C(   0),  INT8_C(  78), -INT8_C(   1), -INT8_C(  54),  INT8_C(  99),
+         INT8_C(   0),  INT8_C(  58),  INT8_C(  22), -INT8_C(   1),  INT8_C(  35), -INT8_C(  26),  INT8_C(   2),  INT8_C( 117), -INT8_C(  69), -INT8_C(   7),  INT8_C(   0), -INT8_C(   3),  INT8_C(   6), -INT8_C(  65),  INT8_C( 125), -INT8_C(  38),
+         INT8_C( 125),  INT8_C(  21),  INT8_C(  65), -INT8_C(  57),  INT8_C(  16),  INT8_C( 110),      INT8_MIN, -INT8_C(   1), -INT8_C(  64),  INT8_C(  64),      INT8_MIN,      INT8_MIN,  INT8_C( 119), -INT8_C(  11),  INT8_C(   0), -INT8_C(   4),
+        -INT8_C( 112), -INT8_C( 114), -INT8_C(  15),  INT8_C(   0), -INT8_C(  33),  INT8_C( 122), -INT8_C(  56),  INT8_C(  83), -INT8_C(  34), -INT8_C(   1),  INT8_C(  72),  INT8_C( 119),  INT8_C(  42),      INT8_MAX,  INT8_C(  44), -INT8_C(  38) },
+      { -INT32_C(      131183), -INT32_C(  1249738695), -INT32_C(   272635038), -INT32_C(  1073725955),  INT32_C(     9547675), -INT32_C(  1711285779), -INT32_C(    68280825),  INT32_C(  1238108749),
+         INT32_C(   536899060), -INT32_C(   342686634),  INT32_C(  1115585952), -INT32_C(   994862174),  INT32_C(  1235786677), -INT32_C(       11599),  INT32_C(       26592),  INT32_C(        1942) } },
+    { {  INT32_C(   538968065),  INT32_C(    27262976), -INT32_C(     1056769),  INT32_C(   138412032),  INT32_C(    16777224),  INT32_C(   755351657), -INT32_C(    33619993), -INT32_C(    18878465),
+         INT32_C(  1804484419),  INT32_C(   280959914),  INT32_C(  1290067435),  INT32_C(  1074921472),  INT32_C(           4),  INT32_C(   268436576), -INT32_C(   834604961),  INT32_C(   231311232) },
+      {      INT8_MIN,  INT8_C(   0),  INT8_C(   0), -INT8_C(  65), -INT8_C(  30), -INT8_C(   2), -INT8_C(  45),  INT8_C(  10),  INT8_C( 105), -INT8_C( 109), -INT8_C(  15),  INT8_C(  36), -INT8_C(  13), -INT8_C(  49),  INT8_C(   0), -INT8_C( 120),
+         INT8_C(  60), -INT8_C(  61),  INT8_C(  27), -INT8_C( 112),  INT8_C( 124),  INT8_C(  21), -INT8_C(  95), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(  87), -INT8_C( 127), -INT8_C( 101), -INT8_C(  45), -INT8_C( 120), -INT8_C(  65),
+         INT8_C(  15), -INT8_C(  37),  INT8_C(  71),  INT8_C(   8),  INT8_C(   1), -INT8_C(  93), -INT8_C(  55), -INT8_C(  33), -INT8_C(   9),  INT8_C( 123), -INT8_C( 110),  INT8_C(   6),  INT8_C( 105), -INT8_C(  58), -INT8_C( 103), -INT8_C(   7),
+         INT8_C(   0),  INT8_C(  49), -INT8_C(  52),  INT8_C(   0), -INT8_C(  75), -INT8_C(  27), -INT8_C(  28),  INT8_C(  52),  INT8_C(   0),  INT8_C(  32), -INT8_C(  77), -INT8_C(  48),  INT8_C(   0),  INT8_C( 125),  INT8_C(   1), -INT8_C(   1) },
+      { -INT8_C(  74),  INT8_C(  36),  INT8_C(  13),      INT8_MIN,  INT8_C(  12),  INT8_C(  32), -INT8_C(  52),  INT8_C(  32),  INT8_C(  16),  INT8_C(   0),  INT8_C(  34),  INT8_C(  16),  INT8_C(  98),  INT8_C(  89),  INT8_C( 112),  INT8_C( 114),
+        -INT8_C(  73), -INT8_C( 111),      INT8_MIN,  INT8_C( 105),  INT8_C(  74), -INT8_C(   2), -INT8_C(  12), -INT8_C(   5), -INT8_C(   1),  INT8_C(  30), -INT8_C(  53), -INT8_C(   1),  INT8_C(  91),  INT8_C( 109),  INT8_C(  48), -INT8_C( 126),
+         INT8_C(  43), -INT8_C(   3),  INT8_C(   0),  INT8_C(  51), -INT8_C(  17), -INT8_C(   1), -INT8_C(  69), -INT8_C(  93), -INT8_C(   2), -INT8_C(  17),  INT8_C(   0),      INT8_MIN, -INT8_C(   9), -INT8_C( 119),  INT8_C(  98), -INT8_C(   2),
+        -INT8_C(  65),  INT8_C( 126), -INT8_C(  96), -INT8_C(  82),  INT8_C(   6),  INT8_C(  64),  INT8_C(  36), -INT8_C(  17),  INT8_C(  20), -INT8_C(  12), -INT8_C(   1),  INT8_C( 110), -INT8_C(  38),  INT8_C(  59), -INT8_C(  65), -INT8_C(   1) },
+      {  INT32_C(   538934145),  INT32_C(    27263164), -INT32_C(     1046319),  INT32_C(   138469773),  INT32_C(    16762863),  INT32_C(   755357584), -INT32_C(    33617083), -INT32_C(    18858899),
+         INT32_C(  1804484815),  INT32_C(   280925126),  INT32_C(  1290064082),  INT32_C(  1074911461), -INT32_C(       13406),  INT32_C(   268459642), -INT32_C(   834582644),  INT32_C(   231318287) } },
+    { {  INT32_C(   286069911),  INT32_C(  2019148191), -INT32_C(        4097),  INT32_C(    84738048), -INT32_C(  1492339184),  INT32_C(   210365835), -INT32_C(     4718594), -INT32_C(     9437185),
+         INT32_C(    71321744),  INT32_C(     4227072),  INT32_C(   770192166),  INT32_C(  1073742208),  INT32_C(  1769554561), -INT32_C(    67118081),  INT32_C(     4202496),  INT32_C(   134291840) },
+      {  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),      INT8_MAX,  INT8_C( 106),  INT8_C(  79), -INT8_C( 100), -INT8_C( 123), -INT8_C(  33),  INT8_C(  31),  INT8_C(  74),  INT8_C( 121),  INT8_C( 102),  INT8_C(   0),  INT8_C(  32),
+         INT8_C(  48),  INT8_C(   0),  INT8_C(  47), -INT8_C(  84),  INT8_C(   0),  INT8_C(  67),  INT8_C(   8),  INT8_C(   0), -INT8_C(  49), -INT8_C(  13),  INT8_C(   8),      INT8_MIN,  INT8_C(   8), -INT8_C(  12),  INT8_C( 121),  INT8_C(  37),
+         INT8_C(  32), -INT8_C(  99), -INT8_C(  33),  INT8_C(   8),  INT8_C(   0),  INT8_C(  85),  INT8_C( 109), -INT8_C(  30),  INT8_C(   0), -INT8_C( 112), -INT8_C(  69),  INT8_C(   0), -INT8_C( 107),  INT8_C(  36),      INT8_MIN,  INT8_C(  17),
+         INT8_C(  16), -INT8_C(  95), -INT8_C( 109),  INT8_C(  83),  INT8_C(   2), -INT8_C(  65),  INT8_C(  36),  INT8_C(  70),  INT8_C(  42), -INT8_C(   1),  INT8_C(  97),  INT8_C(  18), -INT8_C(  59), -INT8_C(  38),  INT8_C(  94), -INT8_C(  17) },
+      { -INT8_C(  18),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(  11),  INT8_C( 111),  INT8_C(   0), -INT8_C( 121), -INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),      INT8_MAX, -INT8_C(  22),  INT8_C(  24),
+        -INT8_C(  14),  INT8_C(  31),  INT8_C(   9),  INT8_C(   0),  INT8_C(  23), -INT8_C(  73),  INT8_C(   0),  INT8_C(  83),  INT8_C( 126),  INT8_C(   4),  INT8_C(   0), -INT8_C( 114), -INT8_C(  17),  INT8_C(  18),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(  30), -INT8_C(  76), -INT8_C(  29),  INT8_C(  21), -INT8_C(  66), -INT8_C(   1),  INT8_C(   0), -INT8_C( 124),  INT8_C(  16),  INT8_C(  24),  INT8_C( 119), -INT8_C(   2), -INT8_C(   5),  INT8_C( 121),  INT8_C(  48), -INT8_C(  89),
+         INT8_C( 111), -INT8_C(  33),      INT8_MAX, -INT8_C( 127), -INT8_C(  81), -INT8_C(  33),  INT8_C(  64),  INT8_C(   0), -INT8_C(   3), -INT8_C(   9),  INT8_C(   0), -INT8_C(   1), -INT8_C(  65), -INT8_C(   4), -INT8_C(   1),      INT8_MIN },
+      {  INT32_C(   286069911),  INT32_C(  2019158126), -INT32_C(       21231),  INT32_C(    84751770), -INT32_C(  1492339433),  INT32_C(   210360944), -INT32_C(     4706132), -INT32_C(     9432892),
+         INT32_C(    71304473),  INT32_C(     4198963),  INT32_C(   770217875),  INT32_C(  1073750450),  INT32_C(  1769559152), -INT32_C(    67122242),  INT32_C(     4200057),  INT32_C(   134247477) } },
+    { {  INT32_C(     3145792),  INT32_C(           0),  INT32_C(   536873984), -INT32_C(  1074790451), -INT32_C(   530755175), -INT32_C(   813957137),  INT32_C(   525867522),  INT32_C(  1767034165),
+        -INT32_C(  1141048385),  INT32_C(    51454241), -INT32_C(   731935275),  INT32_C(  2147350270), -INT32_C(   813793285),  INT32_C(   870254612), -INT32_C(  1090612817), -INT32_C(  1073872913) },
+      {  INT8_C(  80),      INT8_MAX,  INT8_C( 123), -INT8_C(  35),  INT8_C(  17),  INT8_C(   9), -INT8_C(   3), -INT8_C(  17),  INT8_C(  48), -INT8_C(  25), -INT8_C( 105), -INT8_C(  99), -INT8_C( 127), -INT8_C(   1),  INT8_C(   1), -INT8_C(  67),
+        -INT8_C(  18),  INT8_C(   0),  INT8_C(   0), -INT8_C( 105),  INT8_C(  34),  INT8_C(  31),  INT8_C(   0),  INT8_C(   0), -INT8_C(  69), -INT8_C(  75), -INT8_C( 120), -INT8_C(  63),  INT8_C(  64), -INT8_C(  41),  INT8_C(  64),  INT8_C(  20),
+         INT8_C(  80), -INT8_C(   1), -INT8_C(  60), -INT8_C(  20),  INT8_C( 106), -INT8_C(   5),  INT8_C(  27),  INT8_C(  11), -INT8_C(   1), -INT8_C(  92),  INT8_C(  69), -INT8_C(  72),  INT8_C(   0), -INT8_C( 108), -INT8_C(  62), -INT8_C(  92),
+         INT8_C(   0), -INT8_C( 118), -INT8_C( 121), -INT8_C(  86), -INT8_C(  86),  INT8_C(   1),  INT8_C(  64),  INT8_C(  87), -INT8_C(  99), -INT8_C( 101),  INT8_C( 125),  INT8_C(  83), -INT8_C( 125), -INT8_C( 110), -INT8_C(  12),  INT8_C(  64) },
+      { -INT8_C( 118),  INT8_C(  80), -INT8_C(  31), -INT8_C(  52),  INT8_C(  64),  INT8_C(  16),  INT8_C( 104), -INT8_C( 118), -INT8_C( 104), -INT8_C(  48), -INT8_C(   1), -INT8_C(  98),  INT8_C(   0),  INT8_C(  45), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  27), -INT8_C(   1), -INT8_C(   2),  INT8_C(   8),  INT8_C(  75), -INT8_C(  11),  INT8_C(   0), -INT8_C(  16),  INT8_C(  57),  INT8_C(  55),  INT8_C(  20), -INT8_C(  17),  INT8_C(   0), -INT8_C(  35), -INT8_C(  34),  INT8_C(  58),
+        -INT8_C(  93), -INT8_C( 108),  INT8_C(   2), -INT8_C(  55),  INT8_C(   3), -INT8_C( 119), -INT8_C(  33), -INT8_C(  17), -INT8_C(  44),  INT8_C(  27), -INT8_C(  65), -INT8_C(   9), -INT8_C( 127),  INT8_C(  29),  INT8_C( 116),  INT8_C( 104),
+        -INT8_C(  92),  INT8_C(  66), -INT8_C( 103), -INT8_C(  65),  INT8_C(  57),  INT8_C(  18), -INT8_C(  28), -INT8_C(  79),  INT8_C(   0),  INT8_C(  12), -INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C( 110) },
+      {  INT32_C(     3131207), -INT32_C(         658),  INT32_C(   536842367), -INT32_C(  1074778977), -INT32_C(   530760393), -INT32_C(   813954928),  INT32_C(   525887575),  INT32_C(  1767025624),
+        -INT32_C(  1141095953),  INT32_C(    51423612), -INT32_C(   731948208),  INT32_C(  2147394122), -INT32_C(   813809132),  INT32_C(   870255655), -INT32_C(  1090610750), -INT32_C(  1073864879) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpbusds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   268959760),  INT32_C(   335548416), -INT32_C(   702623687), -INT32_C(   748294049), -INT32_C(      262153),  INT32_C(     5242993),  INT32_C(  1379927080),  INT32_C(   832643819),
+         INT32_C(  1529259635), -INT32_C(  1472893219), -INT32_C(  1124396271), -INT32_C(  1712206286),  INT32_C(  1581049436), -INT32_C(     2097201), -INT32_C(  1827468857), -INT32_C(  1744830481) },
+      UINT16_C(19053),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(   268829200),  INT32_C(   335548416), -INT32_C(   702754247), -INT32_C(   748164509), -INT32_C(      262153),  INT32_C(     5372533),  INT32_C(  1379796520),  INT32_C(   832643819),
+         INT32_C(  1529259635), -INT32_C(  1472763679), -INT32_C(  1124396271), -INT32_C(  1712076746),  INT32_C(  1581049436), -INT32_C(     2097201), -INT32_C(  1827599417), -INT32_C(  1744830481) } },
+    { {  INT32_C(  2147451434), -INT32_C(  2147476965),  INT32_C(  2147392489), -INT32_C(  2147437962),  INT32_C(  2147393096), -INT32_C(  2147438294),  INT32_C(  2147460227), -INT32_C(  2147467576),
+         INT32_C(  2147404531), -INT32_C(  2147445609),  INT32_C(  2147459296), -INT32_C(  2147444597),  INT32_C(  2147434662), -INT32_C(  2147451162),  INT32_C(  2147405931), -INT32_C(  2147472970) },
+      UINT16_C(37036),
+      {  INT8_C(   6), -INT8_C(   1), -INT8_C(   5), -INT8_C(   1), -INT8_C(  63),  INT8_C(   0),  INT8_C( 118), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),  INT8_C(  77), -INT8_C(   5), -INT8_C(  41), -INT8_C(  85), -INT8_C(  13), -INT8_C(  47),
+         INT8_C(  94), -INT8_C(   1), -INT8_C(  72),  INT8_C(   3),  INT8_C(   8),  INT8_C(   0),  INT8_C(  56),  INT8_C(   0), -INT8_C(  10), -INT8_C(   1), -INT8_C(   1),  INT8_C(  17), -INT8_C(  88), -INT8_C(  92),  INT8_C(  76), -INT8_C(  38),
+        -INT8_C(  33), -INT8_C(  19), -INT8_C(  50),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(  83),  INT8_C(  32),  INT8_C(  96), -INT8_C(   1), -INT8_C(  98),  INT8_C(  37), -INT8_C(   9), -INT8_C(   3), -INT8_C( 108),  INT8_C(  87),
+             INT8_MIN, -INT8_C(   1),  INT8_C(   0), -INT8_C(  61), -INT8_C(   3),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0), -INT8_C(  21),  INT8_C(  33),  INT8_C(  64),  INT8_C(  50), -INT8_C(  68),  INT8_C( 122), -INT8_C(   1), -INT8_C(   1) },
+      { -INT8_C(   5),  INT8_C(   0),  INT8_C(   0), -INT8_C(  91),      INT8_MIN,  INT8_C( 123),  INT8_C(   0), -INT8_C(  52),  INT8_C( 104),  INT8_C(  52),  INT8_C(  77), -INT8_C(   1), -INT8_C( 127), -INT8_C(   9), -INT8_C(  45), -INT8_C(  23),
+        -INT8_C(  82),  INT8_C(  29), -INT8_C(  35),  INT8_C(  28),  INT8_C(  38),  INT8_C(  12), -INT8_C(   4),  INT8_C(  68),  INT8_C(  72), -INT8_C(   7),  INT8_C(  90), -INT8_C(  18), -INT8_C(  25),  INT8_C( 126), -INT8_C( 102), -INT8_C(  47),
+         INT8_C(  24), -INT8_C( 103),      INT8_MAX,  INT8_C(  85),  INT8_C( 112), -INT8_C( 108), -INT8_C(  19), -INT8_C(  17),  INT8_C(   0), -INT8_C(  68), -INT8_C(   1), -INT8_C(  38),  INT8_C(   8),  INT8_C(  45), -INT8_C( 109),  INT8_C(  64),
+         INT8_C(   1),  INT8_C( 121),  INT8_C(  73), -INT8_C(  94),  INT8_C(   1), -INT8_C(   1),  INT8_C(  26),  INT8_C(   0), -INT8_C(  22),  INT8_C(  16), -INT8_C(  88), -INT8_C( 127), -INT8_C(   3),  INT8_C(  50), -INT8_C(  48),  INT8_C(  36) },
+      {  INT32_C(  2147451434), -INT32_C(  2147476965),  INT32_C(  2147398167), -INT32_C(  2147482548),  INT32_C(  2147393096), -INT32_C(  2147438214),  INT32_C(  2147460227), -INT32_C(  2147469110),
+         INT32_C(  2147404531), -INT32_C(  2147445609),  INT32_C(  2147459296), -INT32_C(  2147444597),  INT32_C(  2147447315), -INT32_C(  2147451162),  INT32_C(  2147405931), -INT32_C(  2147470494) } },
+    { { -INT32_C(  2147416847),  INT32_C(  2147434808), -INT32_C(  2147410488),  INT32_C(  2147446197), -INT32_C(  2147444606),  INT32_C(  2147404544), -INT32_C(  2147418807),  INT32_C(  2147428098),
+        -INT32_C(  2147420326),  INT32_C(  2147428685), -INT32_C(  2147404883),  INT32_C(  2147438795), -INT32_C(  2147416364),  INT32_C(  2147397504), -INT32_C(  2147458945),  INT32_C(  2147440439) },
+      UINT16_C(39629),
+      {  INT8_C(   0),  INT8_C(  59),  INT8_C(  48),  INT8_C(   0),  INT8_C(  58), -INT8_C(  45),  INT8_C(   2),  INT8_C(  32), -INT8_C(   6),  INT8_C(  49), -INT8_C(  28),  INT8_C(   0), -INT8_C(  63), -INT8_C(  34),  INT8_C(  29),  INT8_C(   1),
+         INT8_C( 110), -INT8_C(   1),  INT8_C(   0), -INT8_C(  42),  INT8_C(   3),  INT8_C(  77),  INT8_C(  24), -INT8_C(   1),  INT8_C(   0),  INT8_C(  22),  INT8_C(   2), -INT8_C( 126),  INT8_C(  92), -INT8_C( 103), -INT8_C(  28),      INT8_MIN,
+        -INT8_C(   9), -INT8_C(   1),  INT8_C(  32),  INT8_C(  61),  INT8_C( 124),  INT8_C(   0), -INT8_C( 122), -INT8_C(  25), -INT8_C( 118),  INT8_C( 123),  INT8_C(  40), -INT8_C(   1), -INT8_C(  42),  INT8_C(  50),  INT8_C(   0), -INT8_C( 109),
+         INT8_C(  63),  INT8_C(   9), -INT8_C(  49), -INT8_C(  65),  INT8_C(  63),  INT8_C( 120),      INT8_MIN,  INT8_C(  64),  INT8_C(  54), -INT8_C( 116), -INT8_C(   1), -INT8_C(   1), -INT8_C(  72),  INT8_C(  64),  INT8_C(  37), -INT8_C(  98) },
+      { -INT8_C(  53),  INT8_C(  58), -INT8_C( 126), -INT8_C(  13),  INT8_C(   7), -INT8_C(  65),  INT8_C(  64),  INT8_C(  44), -INT8_C(  69), -INT8_C(  97),  INT8_C(  77), -INT8_C(  60), -INT8_C(   1),  INT8_C(   1), -INT8_C(  69),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(  16), -INT8_C( 119),  INT8_C( 100),  INT8_C(  28),  INT8_C(  64), -INT8_C(  76), -INT8_C(  15), -INT8_C( 124),      INT8_MIN, -INT8_C(   1), -INT8_C(  16), -INT8_C(   1),  INT8_C(  32), -INT8_C(  33), -INT8_C(  33),
+        -INT8_C(   2),  INT8_C(   4), -INT8_C(  71), -INT8_C(   3),  INT8_C(  64), -INT8_C(  98),  INT8_C(  20),  INT8_C(  15), -INT8_C(  80), -INT8_C(   3), -INT8_C(  84),  INT8_C(  64), -INT8_C(  30),  INT8_C(   0),      INT8_MIN, -INT8_C(  82),
+         INT8_C(   8),  INT8_C(   0), -INT8_C(  71),  INT8_C(   0), -INT8_C(  96), -INT8_C( 124),  INT8_C(  44),  INT8_C(  68),  INT8_C(   0),  INT8_C( 124),  INT8_C(  81), -INT8_C(  72),  INT8_C(   3), -INT8_C(  25), -INT8_C(   5),  INT8_C(   8) },
+      { -INT32_C(  2147419473),  INT32_C(  2147434808), -INT32_C(  2147414935),  INT32_C(  2147444229), -INT32_C(  2147444606),  INT32_C(  2147404544), -INT32_C(  2147423705),  INT32_C(  2147421154),
+        -INT32_C(  2147420326),  INT32_C(  2147442766), -INT32_C(  2147404883),  INT32_C(  2147420321), -INT32_C(  2147430557),  INT32_C(  2147397504), -INT32_C(  2147458945),  INT32_C(  2147440470) } },
+    { { -INT32_C(  1093140481),  INT32_C(   672138240), -INT32_C(    68190209), -INT32_C(    33816737), -INT32_C(         257),  INT32_C(   138477570), -INT32_C(   285779276), -INT32_C(   759919456),
+         INT32_C(     8389632), -INT32_C(  1977100347), -INT32_C(          33), -INT32_C(   153354241), -INT32_C(   468909470), -INT32_C(   284356075),  INT32_C(   532193708),  INT32_C(  1142296478) },
+      UINT16_C( 4636),
+      {  INT8_C(  30), -INT8_C(  22),  INT8_C(  32),  INT8_C(  59),  INT8_C(  55),  INT8_C(  65), -INT8_C(  33), -INT8_C(   1),  INT8_C(  70),  INT8_C( 111), -INT8_C(  26),  INT8_C(  52),  INT8_C(   2), -INT8_C(   1), -INT8_C(  77),      INT8_MAX,
+        -INT8_C( 126), -INT8_C(  15),      INT8_MIN,  INT8_C(  32), -INT8_C(   3),  INT8_C(  64), -INT8_C(   1),  INT8_C(  78), -INT8_C(  42),  INT8_C(  73), -INT8_C(   2),  INT8_C(   2), -INT8_C(  69),  INT8_C( 119), -INT8_C(   5),      INT8_MIN,
+         INT8_C(  24), -INT8_C(   1), -INT8_C(   5), -INT8_C(   1), -INT8_C(  73),  INT8_C(  60),  INT8_C(   0),  INT8_C(   9),      INT8_MIN,  INT8_C(   0),  INT8_C(  74),  INT8_C(  84), -INT8_C(  87),  INT8_C(   0),  INT8_C(  33),      INT8_MIN,
+        -INT8_C( 108),  INT8_C(   0), -INT8_C(  94), -INT8_C(  81),  INT8_C(  60), -INT8_C(   3), -INT8_C(   1), -INT8_C( 113),  INT8_C(  68),  INT8_C(  16),  INT8_C(   4), -INT8_C(   5),  INT8_C(  22), -INT8_C( 112),  INT8_C(   0), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(  72), -INT8_C(  85),  INT8_C(  14),      INT8_MIN, -INT8_C(  88),  INT8_C( 126),  INT8_C(  71),  INT8_C(  95),  INT8_C(  80),  INT8_C(   0), -INT8_C(   1), -INT8_C(  25),  INT8_C( 112), -INT8_C(   1),  INT8_C(  43),
+        -INT8_C(   9),  INT8_C(   0),  INT8_C(  26),  INT8_C(  86), -INT8_C(  36),      INT8_MAX,  INT8_C(  79), -INT8_C(  41),  INT8_C(  80), -INT8_C(  13),  INT8_C(   0), -INT8_C( 116), -INT8_C(  65), -INT8_C(  63),  INT8_C(  59), -INT8_C( 113),
+        -INT8_C(  71), -INT8_C(   1),  INT8_C(  16), -INT8_C(   1), -INT8_C(  42), -INT8_C(   3),  INT8_C(  15), -INT8_C(   2), -INT8_C(  59),  INT8_C(   0), -INT8_C(   1), -INT8_C(  78),  INT8_C(  47),  INT8_C(   0), -INT8_C(   1),  INT8_C(  78),
+        -INT8_C(  25),      INT8_MIN,  INT8_C(  98), -INT8_C(   5), -INT8_C(   9), -INT8_C( 121), -INT8_C(   1), -INT8_C(   1), -INT8_C(   2),      INT8_MIN, -INT8_C(   4), -INT8_C(  17),  INT8_C(  37),  INT8_C(   1),  INT8_C(  64),  INT8_C(  33) },
+      { -INT32_C(  1093140481),  INT32_C(   672138240), -INT32_C(    68174731), -INT32_C(    33782945),  INT32_C(        4653),  INT32_C(   138477570), -INT32_C(   285779276), -INT32_C(   759919456),
+         INT32_C(     8389632), -INT32_C(  1977108231), -INT32_C(          33), -INT32_C(   153354241), -INT32_C(   468898169), -INT32_C(   284356075),  INT32_C(   532193708),  INT32_C(  1142296478) } },
+    { {  INT32_C(  1694856769), -INT32_C(      529153), -INT32_C(     1048833), -INT32_C(   245787873),  INT32_C(  1628621525), -INT32_C(   338597872),  INT32_C(   604037632),  INT32_C(  1572274602),
+        -INT32_C(     4259873), -INT32_C(   293464914),  INT32_C(   538969128), -INT32_C(   773458341),  INT32_C(   260144635), -INT32_C(   285215234),  INT32_C(      262160),  INT32_C(   805306372) },
+      UINT16_C(19804),
+      { -INT8_C( 108), -INT8_C(  22), -INT8_C(  97), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20), -INT8_C(  22),  INT8_C(  29), -INT8_C(  56), -INT8_C(  65),  INT8_C(   3), -INT8_C(  54), -INT8_C( 100),  INT8_C(  12),  INT8_C( 103),
+        -INT8_C(  62),  INT8_C(  67), -INT8_C(   1), -INT8_C(  73),  INT8_C(  81),  INT8_C(  54),  INT8_C(   0),  INT8_C(   0), -INT8_C(  26),  INT8_C(  16), -INT8_C(  60), -INT8_C(  21), -INT8_C(  89), -INT8_C(   3), -INT8_C(   2), -INT8_C(   3),
+         INT8_C(  81),  INT8_C(  24), -INT8_C( 124),  INT8_C(   1),  INT8_C(  63),  INT8_C(  10), -INT8_C(   1), -INT8_C(  97),  INT8_C(  24), -INT8_C(  65),  INT8_C(   5), -INT8_C( 127),  INT8_C(   0),  INT8_C(  81), -INT8_C( 118), -INT8_C(   3),
+        -INT8_C(   5),      INT8_MAX, -INT8_C(  53),  INT8_C(   0), -INT8_C( 124),  INT8_C(  33),  INT8_C(  91), -INT8_C(  43),  INT8_C(  64),  INT8_C( 123), -INT8_C(  43), -INT8_C(  65), -INT8_C( 127),  INT8_C(   2),  INT8_C(   4),  INT8_C(  21) },
+      {  INT8_C(   0),  INT8_C( 109), -INT8_C(  43),  INT8_C(   0),  INT8_C(  93), -INT8_C(   3), -INT8_C( 110), -INT8_C( 114), -INT8_C(   1), -INT8_C(  33), -INT8_C(   1), -INT8_C(  78),  INT8_C( 108),  INT8_C(  83), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  87),  INT8_C(   1),  INT8_C(   0), -INT8_C(  65),  INT8_C(  16),  INT8_C( 123),  INT8_C(   0), -INT8_C(   3),  INT8_C(   7),  INT8_C(  28),  INT8_C(   0),  INT8_C(  32), -INT8_C( 101),  INT8_C(   0), -INT8_C(   1), -INT8_C(  19),
+         INT8_C(  12), -INT8_C( 125),  INT8_C( 109), -INT8_C(  92), -INT8_C( 120),  INT8_C(   0), -INT8_C(  45),  INT8_C(   0), -INT8_C( 105),  INT8_C(  56),  INT8_C( 104), -INT8_C(  58),  INT8_C( 114),  INT8_C( 119), -INT8_C(  33),  INT8_C(  58),
+        -INT8_C( 103), -INT8_C(   9), -INT8_C(  46),  INT8_C(  21), -INT8_C(  18),  INT8_C(  68),  INT8_C(   1), -INT8_C(  48), -INT8_C( 107), -INT8_C(  33), -INT8_C(  68), -INT8_C(  65),  INT8_C(  48), -INT8_C(   8), -INT8_C( 127),  INT8_C(   0) },
+      {  INT32_C(  1694856769), -INT32_C(      529153), -INT32_C(     1055887), -INT32_C(   245753121),  INT32_C(  1628592819), -INT32_C(   338597872),  INT32_C(   604047210),  INT32_C(  1572274602),
+        -INT32_C(     4247605), -INT32_C(   293464914),  INT32_C(   538970342), -INT32_C(   773438582),  INT32_C(   260144635), -INT32_C(   285215234),  INT32_C(      224354),  INT32_C(   805306372) } },
+    { {  INT32_C(         129), -INT32_C(  1909830636),  INT32_C(    16795651), -INT32_C(   711586264),  INT32_C(  1034587394),  INT32_C(   758237476),  INT32_C(  1610547191), -INT32_C(       67585),
+         INT32_C(           0), -INT32_C(  1734979183), -INT32_C(      532481),  INT32_C(        8232), -INT32_C(  1201479222), -INT32_C(   934803452), -INT32_C(  2144264192),  INT32_C(  1440479995) },
+      UINT16_C(44654),
+      { -INT8_C(  11),  INT8_C(  64),  INT8_C(  16), -INT8_C( 113), -INT8_C(   1), -INT8_C(  89),  INT8_C(   4), -INT8_C(  35),  INT8_C(  87),  INT8_C(  40), -INT8_C( 107), -INT8_C(   1),      INT8_MIN, -INT8_C( 105),  INT8_C(   3),  INT8_C(  16),
+         INT8_C(   0),  INT8_C(  79), -INT8_C(  69), -INT8_C(  89), -INT8_C(  75), -INT8_C(  54),  INT8_C(   8), -INT8_C(  61),      INT8_MAX, -INT8_C(   9), -INT8_C(  37),  INT8_C(   7), -INT8_C(   1), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   8),  INT8_C(   2), -INT8_C(  57), -INT8_C(   1), -INT8_C(  69),  INT8_C(   0), -INT8_C(   2),  INT8_C(  30), -INT8_C(   1),  INT8_C(   2),  INT8_C(   8),  INT8_C(  32), -INT8_C( 112),  INT8_C(  19),  INT8_C(  90), -INT8_C(  64),
+        -INT8_C(  52),  INT8_C(   0),  INT8_C(  18),  INT8_C( 107),  INT8_C(  88), -INT8_C(  28),  INT8_C(  84),  INT8_C(  27), -INT8_C(  52), -INT8_C(  60),  INT8_C(   0), -INT8_C(   5), -INT8_C(  42),  INT8_C(  32), -INT8_C( 124),  INT8_C( 110) },
+      { -INT8_C(  44),  INT8_C(  34), -INT8_C(   1), -INT8_C( 108),  INT8_C(  97), -INT8_C(  17), -INT8_C(   1), -INT8_C(   2),  INT8_C(  82),  INT8_C(  46),  INT8_C( 110), -INT8_C(  15), -INT8_C(  17),  INT8_C(  25),  INT8_C(   0), -INT8_C(   1),
+         INT8_C(  27), -INT8_C(   2),  INT8_C(   0),  INT8_C(  65), -INT8_C(   1), -INT8_C( 121),  INT8_C(  27), -INT8_C(   1),  INT8_C( 121),  INT8_C(  32),  INT8_C(   8), -INT8_C(  16),  INT8_C(   0),  INT8_C(  67),  INT8_C(   0),  INT8_C(  71),
+        -INT8_C( 126), -INT8_C(   5),  INT8_C(  81),  INT8_C(   1), -INT8_C(  46), -INT8_C(  68),  INT8_C(   5), -INT8_C(  90), -INT8_C(   1),  INT8_C(   0),  INT8_C( 112),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C( 123), -INT8_C(  15),  INT8_C( 111),  INT8_C(  16), -INT8_C(  98),  INT8_C(   2),  INT8_C(  97),  INT8_C(  20),  INT8_C(  32),  INT8_C(  14), -INT8_C( 112),  INT8_C(  38),  INT8_C(  79),  INT8_C( 106), -INT8_C(  36) },
+      {  INT32_C(         129), -INT32_C(  1909809186),  INT32_C(    16817190), -INT32_C(   711584681),  INT32_C(  1034587394),  INT32_C(   758212874),  INT32_C(  1610572102), -INT32_C(       67585),
+         INT32_C(           0), -INT32_C(  1734989215), -INT32_C(      531776),  INT32_C(        8295), -INT32_C(  1201479222), -INT32_C(   934821601), -INT32_C(  2144264192),  INT32_C(  1440500687) } },
+    { {  INT32_C(  2147196669),  INT32_C(   272631872), -INT32_C(   257830318), -INT32_C(   383779081),  INT32_C(    10485808),  INT32_C(     2113536), -INT32_C(   143424295), -INT32_C(   365571850),
+        -INT32_C(      132097),  INT32_C(  1501900141), -INT32_C(   285477647), -INT32_C(    71303169),  INT32_C(      262144), -INT32_C(   350428413), -INT32_C(     8388609), -INT32_C(        2081) },
+      UINT16_C(62924),
+      { -INT8_C(  93),  INT8_C(  16), -INT8_C(  65), -INT8_C(   1),      INT8_MIN, -INT8_C(  33),  INT8_C(   0), -INT8_C(  13),  INT8_C(   0), -INT8_C(  26), -INT8_C(  30),  INT8_C( 101),  INT8_C( 120),  INT8_C( 119), -INT8_C( 110), -INT8_C(  10),
+        -INT8_C(  90),  INT8_C(  11), -INT8_C(   9),  INT8_C(  49),  INT8_C(  36), -INT8_C(   1), -INT8_C( 107), -INT8_C(  65),  INT8_C(  97),  INT8_C(  61),  INT8_C(  94),  INT8_C(  98),  INT8_C(  95),  INT8_C(  66), -INT8_C(  25), -INT8_C( 120),
+        -INT8_C(   5),  INT8_C(  37),  INT8_C( 107), -INT8_C( 105), -INT8_C( 120),  INT8_C(   7), -INT8_C( 106), -INT8_C(  58), -INT8_C(   3),  INT8_C(  55),  INT8_C(  23),  INT8_C(   0),  INT8_C(   8),  INT8_C(  32),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(  72), -INT8_C(   5), -INT8_C(  40), -INT8_C(  14), -INT8_C(  33), -INT8_C( 112),  INT8_C( 118),  INT8_C(  32),  INT8_C(  53),  INT8_C( 109),  INT8_C(  88), -INT8_C(  29),  INT8_C(  73), -INT8_C(   1),  INT8_C(  52),  INT8_C(  24) },
+      {  INT8_C(   4),  INT8_C(   0), -INT8_C(   2),  INT8_C(   2), -INT8_C(   5), -INT8_C(   5),  INT8_C( 110),  INT8_C(   4), -INT8_C( 126), -INT8_C(   1), -INT8_C(  34), -INT8_C(   9), -INT8_C(  34), -INT8_C(   1),  INT8_C(   0), -INT8_C(  97),
+        -INT8_C(  10),  INT8_C( 102), -INT8_C(   1),  INT8_C( 108),  INT8_C(   0), -INT8_C(  53),  INT8_C(   8),  INT8_C(   1), -INT8_C(  35), -INT8_C(  17), -INT8_C(   3), -INT8_C(   1),  INT8_C(  66), -INT8_C(  11),  INT8_C(  63),  INT8_C(   8),
+        -INT8_C(  19),  INT8_C(   0), -INT8_C(  19),  INT8_C(   9), -INT8_C(  98), -INT8_C(  37), -INT8_C(   6), -INT8_C(  69),  INT8_C(  29), -INT8_C(   3),  INT8_C(   2),  INT8_C(  45),  INT8_C( 126), -INT8_C(   7), -INT8_C(  39),  INT8_C(  18),
+        -INT8_C(   5),  INT8_C(  79),  INT8_C(  12), -INT8_C(   2),  INT8_C( 106), -INT8_C(  69),  INT8_C(  39), -INT8_C(   6),  INT8_C(  64),  INT8_C(  32), -INT8_C(  65), -INT8_C(   2),  INT8_C(  64), -INT8_C(  73),  INT8_C(  88), -INT8_C(  66) },
+      {  INT32_C(  2147196669),  INT32_C(   272631872), -INT32_C(   257839141), -INT32_C(   383807142),  INT32_C(    10485808),  INT32_C(     2113536), -INT32_C(   143429107), -INT32_C(   365550665),
+        -INT32_C(      137540),  INT32_C(  1501900141), -INT32_C(   285470429), -INT32_C(    71303169),  INT32_C(      283721), -INT32_C(   350410301), -INT32_C(     8387903), -INT32_C(       13032) } },
+    { { -INT32_C(    59244545), -INT32_C(  1595288170),  INT32_C(   127926816), -INT32_C(  1715575144), -INT32_C(    54542337), -INT32_C(  1909583537),  INT32_C(     8519680),  INT32_C(   630041534),
+         INT32_C(   116863885), -INT32_C(    67110913),  INT32_C(   646626552),  INT32_C(   403718144),  INT32_C(   631367056),  INT32_C(       51720), -INT32_C(   892751319), -INT32_C(   536909830) },
+      UINT16_C(19128),
+      {  INT8_C(  27),  INT8_C(  26),  INT8_C( 115), -INT8_C(   1), -INT8_C(  37), -INT8_C(  76),  INT8_C(  55),  INT8_C(   0), -INT8_C(  16),  INT8_C(   5),  INT8_C(  97),  INT8_C(   2),  INT8_C(  16), -INT8_C(  18),  INT8_C(  80), -INT8_C(  65),
+        -INT8_C( 119), -INT8_C(  59), -INT8_C( 120),  INT8_C(  65),  INT8_C(   4), -INT8_C( 123),  INT8_C(   4), -INT8_C(   2), -INT8_C(  17), -INT8_C(  97), -INT8_C( 123), -INT8_C( 102), -INT8_C( 117), -INT8_C(   2),  INT8_C(  32),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   6), -INT8_C(   1),  INT8_C(  74), -INT8_C(  33),  INT8_C(  30),      INT8_MAX,  INT8_C(  32),  INT8_C(  34), -INT8_C(  52), -INT8_C(  67),  INT8_C(  95), -INT8_C(  10),  INT8_C( 110), -INT8_C(   9),  INT8_C( 106),
+        -INT8_C(  23), -INT8_C(   5), -INT8_C(  97),  INT8_C(  96),  INT8_C(  23),  INT8_C(  36), -INT8_C( 102), -INT8_C( 126),  INT8_C(  81),  INT8_C(  91), -INT8_C(  85), -INT8_C(   1),  INT8_C( 118), -INT8_C(   1),  INT8_C(  17),  INT8_C(  32) },
+      {  INT8_C(   4),  INT8_C(  16),  INT8_C(  64),  INT8_C(  57), -INT8_C(  34),  INT8_C( 117), -INT8_C(  33),  INT8_C(   0), -INT8_C(  33),  INT8_C(  91),  INT8_C(   9), -INT8_C(   3), -INT8_C(  33),  INT8_C(  20),  INT8_C(  64),  INT8_C(  65),
+        -INT8_C( 107), -INT8_C(  79),  INT8_C(   2),  INT8_C(  16), -INT8_C(   1),      INT8_MIN, -INT8_C(  51),  INT8_C(  67), -INT8_C(  33),  INT8_C( 111),  INT8_C(  42), -INT8_C(  45), -INT8_C(  99),  INT8_C(   0), -INT8_C(   1), -INT8_C(  37),
+             INT8_MAX,  INT8_C(  63),  INT8_C(  20),  INT8_C(   0),      INT8_MIN,  INT8_C(  26),      INT8_MAX,  INT8_C(  66), -INT8_C(  80),  INT8_C(   0),      INT8_MAX,  INT8_C(   5), -INT8_C(   1),  INT8_C( 126), -INT8_C(  75),  INT8_C(  66),
+        -INT8_C(   3),  INT8_C(  62),  INT8_C(  14), -INT8_C(  68),  INT8_C(   6), -INT8_C(  10),  INT8_C(  27),  INT8_C(  71),  INT8_C(   0), -INT8_C(  32), -INT8_C(   1),  INT8_C(  32), -INT8_C(  33), -INT8_C(   5),  INT8_C(   4),      INT8_MAX },
+      { -INT32_C(    59244545), -INT32_C(  1595288170),  INT32_C(   127926816), -INT32_C(  1715553377), -INT32_C(    54571247), -INT32_C(  1909583751),  INT32_C(     8519680),  INT32_C(   630027741),
+         INT32_C(   116863885), -INT32_C(    67120436),  INT32_C(   646626552),  INT32_C(   403720229),  INT32_C(   631367056),  INT32_C(       51720), -INT32_C(   892746242), -INT32_C(   536909830) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpbusds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1610612669), -INT32_C(      313345), -INT32_C(    69206057),  INT32_C(   529233635), -INT32_C(  1306146633),  INT32_C(   823896846),  INT32_C(  1644827080), -INT32_C(  1792875690),
+        -INT32_C(  1275165638), -INT32_C(   175998134), -INT32_C(   142610693), -INT32_C(   386586042), -INT32_C(  1915794453), -INT32_C(   284959920),  INT32_C(   243630080), -INT32_C(      208904) },
+      UINT16_C(58820),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(    69336617),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1644696520), -INT32_C(  1792746150),
+        -INT32_C(  1275296198),  INT32_C(           0), -INT32_C(   142741253),  INT32_C(           0),  INT32_C(           0), -INT32_C(   284830380),  INT32_C(   243499520), -INT32_C(       79364) } },
+    { {  INT32_C(  2147401054), -INT32_C(  2147482149),  INT32_C(  2147446180), -INT32_C(  2147404106),  INT32_C(  2147475100), -INT32_C(  2147441777),  INT32_C(  2147477011), -INT32_C(  2147440779),
+         INT32_C(  2147402672), -INT32_C(  2147460128),  INT32_C(  2147459720), -INT32_C(  2147397282),  INT32_C(  2147439100), -INT32_C(  2147454063),  INT32_C(  2147459491), -INT32_C(  2147471412) },
+      UINT16_C(59536),
+      { -INT8_C(  66),  INT8_C(  63), -INT8_C(  44),  INT8_C(   0), -INT8_C(   1), -INT8_C( 124), -INT8_C( 105), -INT8_C(  66),  INT8_C(   4),  INT8_C(  64), -INT8_C( 109),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C( 105),
+        -INT8_C(   1),  INT8_C(  30), -INT8_C(   1),  INT8_C(  88), -INT8_C(   5), -INT8_C(  27), -INT8_C(  15),  INT8_C(  53), -INT8_C(  33),  INT8_C(   0),  INT8_C(  30), -INT8_C(   3),  INT8_C(  32),  INT8_C(  16), -INT8_C(  21), -INT8_C(  93),
+        -INT8_C(  40),  INT8_C(  64), -INT8_C(   1),  INT8_C(  13),  INT8_C(  36), -INT8_C(  17),  INT8_C(   2), -INT8_C( 107),  INT8_C(   2), -INT8_C(  14), -INT8_C(   1),  INT8_C(  59), -INT8_C(  43),  INT8_C(  60), -INT8_C(  35),  INT8_C(  53),
+         INT8_C(   5), -INT8_C(   6), -INT8_C(  15),  INT8_C(   3), -INT8_C(  12),  INT8_C(  16),  INT8_C(  16), -INT8_C(  41), -INT8_C(   2), -INT8_C(   5),  INT8_C(   5),  INT8_C( 122), -INT8_C(  65),  INT8_C(  84),  INT8_C(  20), -INT8_C(  45) },
+      {  INT8_C(  71), -INT8_C(  28), -INT8_C( 126),  INT8_C(  11), -INT8_C(   3), -INT8_C(  35), -INT8_C(   1), -INT8_C(  88), -INT8_C(   9), -INT8_C( 108),  INT8_C(  18), -INT8_C( 104),  INT8_C(   0),  INT8_C(  79), -INT8_C(  25),  INT8_C(  52),
+         INT8_C(  48),  INT8_C( 106),      INT8_MIN, -INT8_C(  33), -INT8_C( 111),  INT8_C(  62),  INT8_C(  49),  INT8_C(  94),  INT8_C(   0), -INT8_C(   1), -INT8_C(  33),  INT8_C(  37), -INT8_C(  27),  INT8_C(   7),  INT8_C(   9), -INT8_C(  44),
+         INT8_C(   1), -INT8_C(  42),  INT8_C(   1),  INT8_C( 121), -INT8_C(  28),  INT8_C(  42),  INT8_C(   0), -INT8_C(  96), -INT8_C( 115),  INT8_C(   0), -INT8_C(  83), -INT8_C(   1),  INT8_C( 109),  INT8_C(   0), -INT8_C( 110),  INT8_C( 113),
+        -INT8_C(   1), -INT8_C(  21),  INT8_C(   2),  INT8_C(  77),  INT8_C(  34),  INT8_C(   8), -INT8_C(  65), -INT8_C(   1),  INT8_C(  18), -INT8_C(  96), -INT8_C(  32), -INT8_C(  51),  INT8_C(   8), -INT8_C(  65), -INT8_C(   2), -INT8_C(   1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147454976),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147446588),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147392386),  INT32_C(           0), -INT32_C(  2147446894),  INT32_C(  2147433585), -INT32_C(  2147475595) } },
+    { { -INT32_C(  2147416554),  INT32_C(  2147472249), -INT32_C(  2147450670),  INT32_C(  2147446194), -INT32_C(  2147479942),  INT32_C(  2147431977), -INT32_C(  2147479362),  INT32_C(  2147458030),
+        -INT32_C(  2147428155),  INT32_C(  2147420181), -INT32_C(  2147466734),  INT32_C(  2147456253), -INT32_C(  2147400183),  INT32_C(  2147414542), -INT32_C(  2147399231),  INT32_C(  2147422151) },
+      UINT16_C(12295),
+      {      INT8_MAX, -INT8_C(  34), -INT8_C(   5),  INT8_C(  40),  INT8_C(  80), -INT8_C(  37),  INT8_C(  32), -INT8_C( 112),  INT8_C(  66), -INT8_C(   2),  INT8_C(  10), -INT8_C(  92),  INT8_C(  18), -INT8_C(   5), -INT8_C(   9), -INT8_C( 112),
+         INT8_C(   5),  INT8_C(  72),      INT8_MIN, -INT8_C(  96),  INT8_C(  32), -INT8_C( 100),      INT8_MAX, -INT8_C(  89), -INT8_C(   1), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(  22), -INT8_C(  84), -INT8_C( 101), -INT8_C(  29),
+         INT8_C( 122),  INT8_C(   0),  INT8_C( 121), -INT8_C( 126),  INT8_C(   8), -INT8_C(   3), -INT8_C(  54), -INT8_C(   1),  INT8_C(  10), -INT8_C(   1), -INT8_C(   3),  INT8_C(  32),  INT8_C( 119),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),
+         INT8_C(  12), -INT8_C(  97),  INT8_C( 113),  INT8_C(  64), -INT8_C(   1),  INT8_C( 111), -INT8_C( 104),  INT8_C(  47),  INT8_C(   0), -INT8_C(   1), -INT8_C(  69),  INT8_C(   5), -INT8_C(   1), -INT8_C( 114), -INT8_C( 104), -INT8_C( 117) },
+      {  INT8_C(   6),  INT8_C(  75),  INT8_C( 109), -INT8_C(  65),  INT8_C(   9), -INT8_C(  80), -INT8_C(  26),  INT8_C(  45),  INT8_C(   2), -INT8_C(   9),  INT8_C( 120),  INT8_C(  41), -INT8_C(  71), -INT8_C(  13), -INT8_C(  74), -INT8_C( 116),
+        -INT8_C(  24),  INT8_C( 125),  INT8_C(   4),  INT8_C( 122), -INT8_C(   1),  INT8_C(  38),  INT8_C(  31), -INT8_C(  66), -INT8_C(  49), -INT8_C(   1),  INT8_C(  76),  INT8_C( 114), -INT8_C(  25),  INT8_C(   9), -INT8_C(  32), -INT8_C(  10),
+        -INT8_C(  32),  INT8_C(  90), -INT8_C(  81),  INT8_C(  23),  INT8_C( 119),  INT8_C(  60), -INT8_C(   2), -INT8_C(  82), -INT8_C(  15),  INT8_C(  97),  INT8_C( 116), -INT8_C(   1), -INT8_C(  96),  INT8_C(   0),  INT8_C(  63),  INT8_C(   0),
+         INT8_C(  36), -INT8_C(  33), -INT8_C( 117), -INT8_C(  18),  INT8_C(  24), -INT8_C( 123), -INT8_C(  55),  INT8_C( 101), -INT8_C( 123),  INT8_C(  31),  INT8_C(   5),  INT8_C(  43), -INT8_C(  53),  INT8_C(   8),  INT8_C(  32), -INT8_C(   3) },
+      { -INT32_C(  2147374383),  INT32_C(  2147461097), -INT32_C(  2147444900),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147419371),  INT32_C(  2147403396),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   537927680),  INT32_C(   106517110), -INT32_C(  1080822021), -INT32_C(  1267927176), -INT32_C(       16385), -INT32_C(  1543438336), -INT32_C(   536872963), -INT32_C(          33),
+         INT32_C(    33685920),  INT32_C(  1073873220), -INT32_C(  2113667072),  INT32_C(   142606338),  INT32_C(       32768),  INT32_C(    33562648),  INT32_C(  2147418047),  INT32_C(   816006916) },
+      UINT16_C(51926),
+      { -INT8_C(   7), -INT8_C(  57),  INT8_C(  40),  INT8_C(   0), -INT8_C(  34), -INT8_C(  61), -INT8_C( 109), -INT8_C(  49),  INT8_C(  32),  INT8_C(  99),  INT8_C(   0),  INT8_C(  79), -INT8_C(  17),  INT8_C(  29), -INT8_C(  92), -INT8_C(  35),
+        -INT8_C(  85), -INT8_C(   1),  INT8_C(   8), -INT8_C(   2),  INT8_C(  74),  INT8_C(  14), -INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(  47), -INT8_C(  17), -INT8_C(  46), -INT8_C(   1),  INT8_C(  16), -INT8_C(  10),      INT8_MAX,
+        -INT8_C(  50), -INT8_C(  32),  INT8_C(  95), -INT8_C(  79), -INT8_C(   1), -INT8_C(  85), -INT8_C( 108), -INT8_C(  85),  INT8_C(   0),  INT8_C(  95), -INT8_C(  65),  INT8_C(  16), -INT8_C(  14), -INT8_C(   1),  INT8_C( 111),  INT8_C(  54),
+        -INT8_C(   1),  INT8_C(  64),  INT8_C(   0),  INT8_C(  16), -INT8_C(  82),  INT8_C( 120),  INT8_C(  16),  INT8_C(   0), -INT8_C(  13),  INT8_C(  41), -INT8_C( 108),  INT8_C(  88),  INT8_C(   0), -INT8_C(  72),  INT8_C(  49), -INT8_C(   2) },
+      { -INT8_C(  64),  INT8_C( 105), -INT8_C(  94), -INT8_C(  45),  INT8_C(   0), -INT8_C(  30), -INT8_C(  67), -INT8_C( 121),  INT8_C( 125),      INT8_MAX, -INT8_C(  65),  INT8_C( 100), -INT8_C(  33),  INT8_C( 106),  INT8_C(   5),  INT8_C(  76),
+        -INT8_C(  93), -INT8_C( 104),  INT8_C(   0),  INT8_C(  46),  INT8_C(  50), -INT8_C(   5),  INT8_C(   0),  INT8_C(   9),  INT8_C( 115), -INT8_C(  56), -INT8_C(  70), -INT8_C(  36), -INT8_C(   3), -INT8_C(  25),  INT8_C(   8), -INT8_C(   1),
+         INT8_C(  40),  INT8_C(   0), -INT8_C( 124),  INT8_C(  32), -INT8_C(   1), -INT8_C(   1), -INT8_C(  15),  INT8_C(  32), -INT8_C(  80), -INT8_C(  11), -INT8_C(   9),  INT8_C(   0), -INT8_C(   5), -INT8_C(  67), -INT8_C(   1),  INT8_C(  79),
+         INT8_C(  64),  INT8_C(  29), -INT8_C(   1), -INT8_C(  96),  INT8_C(   5), -INT8_C(  59),  INT8_C(  79),  INT8_C(   0), -INT8_C(  98),  INT8_C( 121),  INT8_C(  61), -INT8_C(  97),  INT8_C(  47),  INT8_C(   0),  INT8_C(  96), -INT8_C(  66) },
+      {  INT32_C(           0),  INT32_C(   106476364), -INT32_C(  1080797548),  INT32_C(           0), -INT32_C(       47124),  INT32_C(           0), -INT32_C(   536899425),  INT32_C(         643),
+         INT32_C(           0),  INT32_C(  1073876046),  INT32_C(           0),  INT32_C(   142592198),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147399686),  INT32_C(   815994856) } },
+    { {  INT32_C(    79689863),  INT32_C(      557057), -INT32_C(   276824193),  INT32_C(   566231057), -INT32_C(    26214529), -INT32_C(    67174913),  INT32_C(  1974907201),  INT32_C(      557058),
+         INT32_C(  1741752325), -INT32_C(  1687982987),  INT32_C(   344577557),  INT32_C(      262168),  INT32_C(   536872968), -INT32_C(  1495699526), -INT32_C(        8451),  INT32_C(  1833041992) },
+      UINT16_C(18362),
+      {      INT8_MIN, -INT8_C(  83),      INT8_MIN,  INT8_C(   1),  INT8_C(  55),  INT8_C(   0),  INT8_C(  57), -INT8_C(  12), -INT8_C(  69), -INT8_C(   1), -INT8_C(  61),  INT8_C(  93),  INT8_C(  99),  INT8_C(  55), -INT8_C(  18),  INT8_C(  63),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(  87),  INT8_C(  78), -INT8_C(  67), -INT8_C(   9),  INT8_C(   4), -INT8_C(   1),  INT8_C(   0), -INT8_C(  30),  INT8_C(   0),  INT8_C(  42), -INT8_C(  23),  INT8_C(  68),
+        -INT8_C( 112),  INT8_C(  20),  INT8_C(  33),  INT8_C(   0),  INT8_C(  73),      INT8_MIN,      INT8_MAX,  INT8_C(  93),  INT8_C(  37),  INT8_C(  45), -INT8_C(   9),  INT8_C(   0), -INT8_C(  86),  INT8_C( 119),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  86),  INT8_C(  42), -INT8_C(  34),  INT8_C(  65),  INT8_C(   0),  INT8_C(  59), -INT8_C(   1), -INT8_C(  66),  INT8_C(   0),  INT8_C(  28),  INT8_C(  16), -INT8_C(   1),  INT8_C(  71), -INT8_C(   7),  INT8_C(   0), -INT8_C(   1) },
+      {  INT8_C(  77), -INT8_C(  93),  INT8_C(   0), -INT8_C(  17), -INT8_C(  10),  INT8_C( 104),  INT8_C(  58), -INT8_C(  38),  INT8_C( 114), -INT8_C(  34),  INT8_C(  62),  INT8_C(  10),  INT8_C(   4),  INT8_C(  49), -INT8_C(  86), -INT8_C(  17),
+        -INT8_C(  74),  INT8_C(   8),  INT8_C(  16), -INT8_C( 113),      INT8_MAX, -INT8_C(  20),  INT8_C( 111),  INT8_C(   0), -INT8_C(   1), -INT8_C(  19), -INT8_C(  54),  INT8_C(  56),  INT8_C(  17), -INT8_C(  51),  INT8_C(  18), -INT8_C( 112),
+        -INT8_C(  60),  INT8_C(  91),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0), -INT8_C(  36),  INT8_C(  72),  INT8_C(  48),  INT8_C(  24), -INT8_C(  33), -INT8_C(  49),  INT8_C(  32), -INT8_C( 101), -INT8_C(   1),  INT8_C(  83),  INT8_C(  76),
+        -INT8_C(  73),  INT8_C(   0),  INT8_C( 121),  INT8_C(   8), -INT8_C(  68), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(  36),  INT8_C(  25), -INT8_C(  71),  INT8_C(   0),  INT8_C(  81),  INT8_C(   0),  INT8_C(  66),  INT8_C( 101) },
+      {  INT32_C(           0),  INT32_C(      550541),  INT32_C(           0),  INT32_C(   566212609), -INT32_C(    26260174), -INT32_C(    67144445),  INT32_C(           0),  INT32_C(      551494),
+         INT32_C(  1741745571), -INT32_C(  1687973987),  INT32_C(   344564857),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(        8887),  INT32_C(           0) } },
+    { { -INT32_C(  2135949183),  INT32_C(    68638272),  INT32_C(   208905680), -INT32_C(      393249),  INT32_C(   927559917), -INT32_C(    60577997),  INT32_C(     4194306),  INT32_C(  1725325678),
+         INT32_C(   653505978), -INT32_C(   933814647),  INT32_C(  2080366575), -INT32_C(   723833981), -INT32_C(  1090650121), -INT32_C(   780975652),  INT32_C(  2080358394),  INT32_C(  1529308429) },
+      UINT16_C(21779),
+      { -INT8_C( 112),  INT8_C(  64),  INT8_C(   0),  INT8_C(  78),  INT8_C( 101), -INT8_C(   2),  INT8_C(  72),  INT8_C(   0), -INT8_C(   1), -INT8_C( 120), -INT8_C(  43),  INT8_C(  63),  INT8_C(  69),      INT8_MIN, -INT8_C(   1),  INT8_C(   0),
+             INT8_MAX, -INT8_C( 105), -INT8_C(  21), -INT8_C(  87), -INT8_C(  43),  INT8_C( 112),  INT8_C(   0),  INT8_C(   1),  INT8_C(  32),  INT8_C( 119),  INT8_C( 126), -INT8_C( 124),  INT8_C( 126), -INT8_C(  17), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(  64), -INT8_C(  17),      INT8_MIN, -INT8_C(  54), -INT8_C(   6),  INT8_C(  50), -INT8_C(   1),  INT8_C(   0),  INT8_C( 126),  INT8_C(  48), -INT8_C(  11),  INT8_C(  27),  INT8_C(   1), -INT8_C(  70), -INT8_C(  33),  INT8_C(  99),
+         INT8_C(   8),  INT8_C(  64),  INT8_C(  83),  INT8_C( 106),  INT8_C(  10), -INT8_C( 124), -INT8_C(   1),  INT8_C(   3), -INT8_C(   8), -INT8_C(  57),  INT8_C(  87),  INT8_C(   8), -INT8_C(   2), -INT8_C(   1), -INT8_C(  93),  INT8_C(   8) },
+      { -INT8_C(  52),  INT8_C(  56),  INT8_C(  51),  INT8_C(   0),  INT8_C( 105), -INT8_C(  26),  INT8_C(  52),  INT8_C(  57),  INT8_C(  53), -INT8_C(   4), -INT8_C(   9), -INT8_C( 126),  INT8_C(   0), -INT8_C(   1),  INT8_C(   2),  INT8_C(  54),
+        -INT8_C( 119),  INT8_C(  16),  INT8_C(  76),      INT8_MIN, -INT8_C(  65),  INT8_C(  92), -INT8_C(   1),  INT8_C(   4), -INT8_C( 111), -INT8_C( 100), -INT8_C(   1), -INT8_C(   1), -INT8_C(   9),  INT8_C(  91),  INT8_C( 104), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(  48), -INT8_C( 115),  INT8_C(  39), -INT8_C(   9),  INT8_C(  36),  INT8_C( 119),  INT8_C(   4), -INT8_C(   1), -INT8_C(  19), -INT8_C( 125),  INT8_C(  59),  INT8_C(   0), -INT8_C(   1),  INT8_C(  11),
+        -INT8_C(   2), -INT8_C(   9),  INT8_C(  64),  INT8_C(  42),  INT8_C(  20), -INT8_C(   9), -INT8_C(  67), -INT8_C(  83),  INT8_C(  58),      INT8_MAX, -INT8_C(   3), -INT8_C(  40),  INT8_C(   7), -INT8_C(   1),  INT8_C(  64),  INT8_C(   9) },
+      { -INT32_C(  2135953087),  INT32_C(    68646017),  INT32_C(           0),  INT32_C(           0),  INT32_C(   927543448),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   653488828),  INT32_C(           0),  INT32_C(  2080359001),  INT32_C(           0), -INT32_C(  1090640949),  INT32_C(           0),  INT32_C(  2080397470),  INT32_C(           0) } },
+    { {  INT32_C(     7340108), -INT32_C(  1585498236),  INT32_C(  1082134529),  INT32_C(  1211853494),  INT32_C(   268716032),  INT32_C(    69226496), -INT32_C(    68157441), -INT32_C(  1364358077),
+        -INT32_C(    16777217),  INT32_C(  1822359866),  INT32_C(  1477452883), -INT32_C(  1073741889), -INT32_C(      528402), -INT32_C(   384592418), -INT32_C(  1374941292),  INT32_C(        2210) },
+      UINT16_C(16804),
+      { -INT8_C(  15), -INT8_C(   1), -INT8_C(  97), -INT8_C(  30), -INT8_C(  34),  INT8_C(   1),      INT8_MIN,  INT8_C(   1), -INT8_C(  47),  INT8_C(  96), -INT8_C( 119), -INT8_C(   5), -INT8_C(   1), -INT8_C( 100), -INT8_C(   3), -INT8_C(   1),
+         INT8_C(  16), -INT8_C(   1), -INT8_C(  22),  INT8_C(  86),  INT8_C(   0),  INT8_C(   4),  INT8_C(  99),  INT8_C(   0), -INT8_C(  95),  INT8_C(   4), -INT8_C(  27),  INT8_C(  74), -INT8_C(  74),  INT8_C(  61),  INT8_C(  16),  INT8_C(  39),
+         INT8_C(  34),  INT8_C(  59),  INT8_C(  68), -INT8_C(  17), -INT8_C(  90), -INT8_C(  80),  INT8_C(  28),  INT8_C(  96), -INT8_C(  65),  INT8_C(  85), -INT8_C(  33),  INT8_C(  90), -INT8_C(  50),  INT8_C(  32),  INT8_C(  64),  INT8_C(  37),
+         INT8_C(  12), -INT8_C(  98), -INT8_C( 103), -INT8_C(  83),  INT8_C(  42), -INT8_C(  85),  INT8_C(  32), -INT8_C(  93),  INT8_C(  34), -INT8_C( 119), -INT8_C(   5), -INT8_C( 103), -INT8_C(  65),  INT8_C(   0), -INT8_C(   3), -INT8_C(  23) },
+      { -INT8_C(  78), -INT8_C(  67),  INT8_C(   1), -INT8_C(  11),  INT8_C( 119),  INT8_C(  25), -INT8_C(   1), -INT8_C(   7),  INT8_C(   0),  INT8_C( 107),  INT8_C(   4),  INT8_C(   0), -INT8_C(  70), -INT8_C(  51), -INT8_C(   6), -INT8_C(   3),
+         INT8_C(   4),  INT8_C(  65),  INT8_C(  41), -INT8_C(  53), -INT8_C(  81), -INT8_C(   9), -INT8_C( 111),  INT8_C(  17), -INT8_C(   1),  INT8_C( 100), -INT8_C(  96),  INT8_C(  64),  INT8_C( 106),  INT8_C(   0), -INT8_C( 112),  INT8_C( 126),
+         INT8_C( 125),  INT8_C(  12), -INT8_C(   3),  INT8_C(  86),  INT8_C(  64), -INT8_C(  65), -INT8_C(  73),  INT8_C(  76), -INT8_C(  13),  INT8_C( 123),  INT8_C(  96),  INT8_C(  20),  INT8_C(  16), -INT8_C(   1),  INT8_C(  31), -INT8_C(   5),
+         INT8_C(  68), -INT8_C(  93),  INT8_C(  36), -INT8_C(  40), -INT8_C( 127),  INT8_C( 125), -INT8_C(  19),  INT8_C(  71),  INT8_C(   1), -INT8_C(  76), -INT8_C(  85),  INT8_C(  12),  INT8_C(   8),      INT8_MIN,  INT8_C(  32),  INT8_C(   0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1082145349),  INT32_C(           0),  INT32_C(           0),  INT32_C(    69215471),  INT32_C(           0), -INT32_C(  1364335663),
+        -INT32_C(    16751909),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1374971169),  INT32_C(           0) } },
+    { { -INT32_C(   726938243),  INT32_C(  1719163797), -INT32_C(  1602224128),  INT32_C(    68161536), -INT32_C(     1052805), -INT32_C(   554713857),  INT32_C(  2139960104),  INT32_C(  2146697215),
+        -INT32_C(   167809025),  INT32_C(     2229256), -INT32_C(  1655609037),  INT32_C(     8459268), -INT32_C(  1577575329), -INT32_C(    88244753),  INT32_C(   201359360),  INT32_C(  1685317541) },
+      UINT16_C(26744),
+      {  INT8_C(  67),  INT8_C(  64),  INT8_C(   4), -INT8_C(  31), -INT8_C(  73), -INT8_C(  34),  INT8_C(  46),  INT8_C(  80),  INT8_C(  33), -INT8_C(  69),  INT8_C(   0),  INT8_C(  81),  INT8_C(   0),  INT8_C(  97), -INT8_C(  99),  INT8_C(   0),
+        -INT8_C(   2), -INT8_C(   6), -INT8_C(  79), -INT8_C(  33), -INT8_C(   4), -INT8_C(   4),  INT8_C(  66), -INT8_C( 109), -INT8_C( 117),  INT8_C(  96),  INT8_C(   3), -INT8_C(  17),  INT8_C(   0),  INT8_C( 112),  INT8_C(  16),  INT8_C(   1),
+         INT8_C( 123), -INT8_C(   9),  INT8_C(  88),  INT8_C( 110), -INT8_C(  49), -INT8_C(  75), -INT8_C( 127),  INT8_C(  20),  INT8_C(  69),  INT8_C(  82), -INT8_C(   1),  INT8_C(  12), -INT8_C(  17),  INT8_C(  78), -INT8_C(   3),  INT8_C(  60),
+         INT8_C( 106),  INT8_C(  60),  INT8_C(   0),  INT8_C(  32), -INT8_C(   3),  INT8_C(   2),  INT8_C(   1), -INT8_C( 105), -INT8_C( 120),  INT8_C(   0),  INT8_C( 102), -INT8_C(  83),  INT8_C(  55),  INT8_C(   1),  INT8_C( 124),  INT8_C( 122) },
+      {  INT8_C(   2), -INT8_C(  95),  INT8_C(   0),      INT8_MIN,  INT8_C(  87), -INT8_C(   9), -INT8_C(  13), -INT8_C(   2),  INT8_C(   0),      INT8_MAX,  INT8_C(  67),      INT8_MIN, -INT8_C(   2),  INT8_C(  62), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(  32),  INT8_C(  22),  INT8_C(  12),  INT8_C( 107), -INT8_C(  65),  INT8_C(   0), -INT8_C(  84),  INT8_C(   8),  INT8_C(   5), -INT8_C(  87), -INT8_C(  99),  INT8_C(  47),  INT8_C(  18), -INT8_C(   2), -INT8_C( 115), -INT8_C( 102),
+         INT8_C( 104), -INT8_C(  74),  INT8_C(   2),  INT8_C(   2), -INT8_C(   2), -INT8_C( 119),  INT8_C(  35), -INT8_C(   1), -INT8_C(   5),  INT8_C(  30),  INT8_C( 112),  INT8_C(  80), -INT8_C( 107), -INT8_C(  87), -INT8_C(   3),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   2),  INT8_C(   1), -INT8_C(  17), -INT8_C(   5),  INT8_C(   0),  INT8_C( 112),  INT8_C(   4), -INT8_C(  67),  INT8_C(  18),  INT8_C(  32), -INT8_C(  39),  INT8_C( 126), -INT8_C(   1),  INT8_C(  89),  INT8_C(  81) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    68167393), -INT32_C(     1013192), -INT32_C(   554734605),  INT32_C(  2139963383),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(     8426150),  INT32_C(           0), -INT32_C(    88245302),  INT32_C(   201346765),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpbusds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpbusds_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,812 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpwssd
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpwssd.h>
+
+static int
+test_simde_mm_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   830256800), -INT32_C(   169673641),  INT32_C(  1243931546), -INT32_C(   186647041) },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(  1317226848),  INT32_C(  1977810007), -INT32_C(   903552102),  INT32_C(  1960836607) } },
+    { {  INT32_C(    67109378),  INT32_C(    67240000), -INT32_C(      655371),  INT32_C(     4194818) },
+      {  INT16_C( 12631), -INT16_C(  4417),  INT16_C( 20898), -INT16_C(   585),  INT16_C( 21961),  INT16_C(   144),  INT16_C(  1259), -INT16_C( 16735) },
+      {  INT16_C( 31051),  INT16_C(   514),  INT16_C(  4917),  INT16_C(  1354), -INT16_C(   145),  INT16_C( 12011), -INT16_C(     1), -INT16_C(   661) },
+      {  INT32_C(   457044221),  INT32_C(   169203376), -INT32_C(     2110132),  INT32_C(    15255394) } },
+    { { -INT32_C(  2130706175), -INT32_C(   837794495), -INT32_C(   812673597),  INT32_C(   212355784) },
+      { -INT16_C(    53), -INT16_C( 10555), -INT16_C( 22450),  INT16_C( 31473),  INT16_C(     0), -INT16_C(   513), -INT16_C( 27789), -INT16_C( 12353) },
+      { -INT16_C( 27106), -INT16_C( 11505),  INT16_C( 14580), -INT16_C( 31742),  INT16_C(  5072), -INT16_C( 16271),  INT16_C( 31739), -INT16_C(   649) },
+      { -INT32_C(  2007834282),  INT32_C(  2130835835), -INT32_C(   804326574), -INT32_C(   661622190) } },
+    { {  INT32_C(   230583233), -INT32_C(   153037811), -INT32_C(    17825809), -INT32_C(   553648259) },
+      { -INT16_C(     5),  INT16_C( 32687), -INT16_C( 26771),  INT16_C(     0),  INT16_C(  4384),  INT16_C( 30650), -INT16_C(   521),  INT16_C(   792) },
+      {  INT16_C( 17263), -INT16_C(     7),  INT16_C( 22108),  INT16_C( 13844),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25412), -INT16_C(     1) },
+      {  INT32_C(   230268109), -INT32_C(   744891079), -INT32_C(    17825809), -INT32_C(   540409399) } },
+    { {  INT32_C(     1050628), -INT32_C(     4588291), -INT32_C(   884991442),  INT32_C(    76021784) },
+      {  INT16_C(    32),  INT16_C( 17657),  INT16_C( 22761),  INT16_C( 26576),       INT16_MIN,  INT16_C(  5302), -INT16_C( 32752),  INT16_C( 21324) },
+      {  INT16_C(  7698),  INT16_C(  8339), -INT16_C(   265),  INT16_C( 29002),  INT16_C(    68),  INT16_C( 20350),  INT16_C( 32735), -INT16_C(   577) },
+      {  INT32_C(   148538687),  INT32_C(   760137196), -INT32_C(   779323966), -INT32_C(  1008418884) } },
+    { { -INT32_C(   536870917),  INT32_C(  1879162169), -INT32_C(   940526725), -INT32_C(  1343242517) },
+      { -INT16_C(     5),  INT16_C( 32320), -INT16_C(  2839),  INT16_C(  4315), -INT16_C(     1), -INT16_C(   129), -INT16_C( 30113), -INT16_C( 16362) },
+      { -INT16_C(     1),  INT16_C( 16426), -INT16_C(     1),  INT16_C(  4096),  INT16_C(  5673),  INT16_C( 15977), -INT16_C(     1),  INT16_C( 16392) },
+      { -INT32_C(     5982592),  INT32_C(  1896839248), -INT32_C(   942593431), -INT32_C(  1611418308) } },
+    { {  INT32_C(  1380177753), -INT32_C(    19534338),  INT32_C(  1324166747), -INT32_C(   586565755) },
+      { -INT16_C(  5127), -INT16_C(    19),  INT16_C( 15540), -INT16_C(     2), -INT16_C( 10536),  INT16_C( 24605), -INT16_C(  3612),  INT16_C( 16512) },
+      { -INT16_C(  3105), -INT16_C( 28672),  INT16_C(     4),  INT16_C( 26471), -INT16_C( 25557), -INT16_C( 20361),  INT16_C( 29447), -INT16_C(   329) },
+      {  INT32_C(  1396641856), -INT32_C(    19525120),  INT32_C(  1092452894), -INT32_C(   698360767) } },
+    { { -INT32_C(    16785483), -INT32_C(    68157441),  INT32_C(   306424421), -INT32_C(  1464775319) },
+      { -INT16_C(  1285), -INT16_C(     5), -INT16_C( 12192),  INT16_C(  8192), -INT16_C( 15206),  INT16_C( 14925),  INT16_C( 24801),  INT16_C( 21922) },
+      { -INT16_C(  3073), -INT16_C(     3),  INT16_C(  2049),  INT16_C(  6518),  INT16_C( 32765),  INT16_C(  8449),  INT16_C( 28079),  INT16_C(  2561) },
+      { -INT32_C(    12836663), -INT32_C(    39743393), -INT32_C(    65698844), -INT32_C(   712245798) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_dpwssd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(    33624098), -INT32_C(  2012911054), -INT32_C(  1514798079), -INT32_C(  2072901947) },
+      UINT8_C( 36),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(    33624098), -INT32_C(  2012911054),  INT32_C(   632685569), -INT32_C(  2072901947) } },
+    { { -INT32_C(     8527873), -INT32_C(  2145316600),  INT32_C(    78188235),  INT32_C(     9797776) },
+      UINT8_C(107),
+      {  INT16_C( 14441), -INT16_C( 13777),  INT16_C( 19844), -INT16_C( 29323),  INT16_C(   512),  INT16_C(   513), -INT16_C( 30355), -INT16_C( 17308) },
+      { -INT16_C(  4828),  INT16_C(  5264),  INT16_C( 19458), -INT16_C( 28400), -INT16_C(  2245), -INT16_C( 20964),  INT16_C(   512), -INT16_C(    33) },
+      { -INT32_C(   150771149), -INT32_C(   926418848),  INT32_C(    78188235), -INT32_C(     5172820) } },
+    { {  INT32_C(     8454912), -INT32_C(   855805599),  INT32_C(      131072), -INT32_C(   868183239) },
+      UINT8_C(180),
+      { -INT16_C( 27727), -INT16_C( 17285), -INT16_C( 26064), -INT16_C(   545), -INT16_C( 11070), -INT16_C(  1554), -INT16_C( 13736), -INT16_C(  8193) },
+      { -INT16_C(  2089),  INT16_C( 32670), -INT16_C( 25060),  INT16_C(  4128),  INT16_C( 20351), -INT16_C(  8623), -INT16_C( 11177),  INT16_C( 25318) },
+      {  INT32_C(     8454912), -INT32_C(   855805599), -INT32_C(   211754356), -INT32_C(   868183239) } },
+    { { -INT32_C(  2143152088),  INT32_C(     1082368), -INT32_C(  1286393214), -INT32_C(   811234350) },
+      UINT8_C( 92),
+      { -INT16_C(  1025), -INT16_C( 26286), -INT16_C( 10389), -INT16_C(  5038),  INT16_C(  7249), -INT16_C(  6145), -INT16_C( 32279), -INT16_C(     9) },
+      {  INT16_C(     3),  INT16_C( 24608),  INT16_C(  6515),  INT16_C( 12547), -INT16_C( 18697),  INT16_C( 21438), -INT16_C(    34), -INT16_C( 19673) },
+      { -INT32_C(  2143152088),  INT32_C(     1082368), -INT32_C(  1553664277), -INT32_C(   809959807) } },
+    { { -INT32_C(  1242146669),  INT32_C(  2016067867),  INT32_C(   134291456),  INT32_C(  1070645762) },
+      UINT8_C(106),
+      {  INT16_C(  6696), -INT16_C( 31624),  INT16_C( 21181),  INT16_C( 17099),  INT16_C(   521), -INT16_C( 12836), -INT16_C( 16449), -INT16_C(  2057) },
+      {  INT16_C( 23550),  INT16_C(     3), -INT16_C( 15338),  INT16_C( 14900), -INT16_C( 20993),  INT16_C( 18440), -INT16_C( 32752),  INT16_C( 26931) },
+      { -INT32_C(  1242146669),  INT32_C(  1945968789),  INT32_C(   134291456),  INT32_C(  1553986343) } },
+    { { -INT32_C(  2062995447), -INT32_C(  1798329764),  INT32_C(     4360320), -INT32_C(   537001985) },
+      UINT8_C(201),
+      { -INT16_C( 22706),  INT16_C(    64), -INT16_C(  8209), -INT16_C(  1027), -INT16_C(  4611),  INT16_C( 32032), -INT16_C(  2193), -INT16_C( 22991) },
+      {  INT16_C( 14150), -INT16_C(   641),  INT16_C( 30439), -INT16_C( 24090), -INT16_C( 32640),  INT16_C(  8729),  INT16_C(  2448),  INT16_C(     0) },
+      {  INT32_C(  1910640925), -INT32_C(  1798329764),  INT32_C(     4360320), -INT32_C(   542370449) } },
+    { {  INT32_C(   336224256),  INT32_C(          32),  INT32_C(  1073758208), -INT32_C(     8388609) },
+      UINT8_C(204),
+      {  INT16_C( 20817), -INT16_C(  3073), -INT16_C(  2592), -INT16_C(     1),  INT16_C(  1944), -INT16_C(  4129), -INT16_C(  6433),  INT16_C(   128) },
+      {  INT16_C( 17945), -INT16_C( 30669),  INT16_C( 30685), -INT16_C(  2351),  INT16_C( 18097), -INT16_C( 28640),  INT16_C( 17284),  INT16_C( 25407) },
+      {  INT32_C(   336224256),  INT32_C(          32),  INT32_C(  1227193336), -INT32_C(   116324485) } },
+    { {  INT32_C(    16777216), -INT32_C(    39574092),  INT32_C(    38261250), -INT32_C(  1094721026) },
+      UINT8_C(179),
+      {  INT16_C( 18623),       INT16_MIN, -INT16_C(  6143), -INT16_C( 32060), -INT16_C( 19468), -INT16_C( 20019),  INT16_C( 16255),  INT16_C(  4611) },
+      { -INT16_C( 11645),  INT16_C(  8200), -INT16_C(  9030), -INT16_C(   269),  INT16_C( 17898), -INT16_C( 28239),  INT16_C(   320),  INT16_C(   792) },
+      { -INT32_C(   468785219),  INT32_C(    24521338),  INT32_C(    38261250), -INT32_C(  1094721026) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpwssd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(       98434),  INT32_C(   157939663), -INT32_C(   823444916), -INT32_C(  2147483616) },
+      UINT8_C(252),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1324038732),  INT32_C(          32) } },
+    { { -INT32_C(  1793421104), -INT32_C(       16385),  INT32_C(  2112879303), -INT32_C(  1313393871) },
+      UINT8_C(241),
+      {  INT16_C(   130), -INT16_C(   541),  INT16_C(  1065), -INT16_C( 25357), -INT16_C(  4101), -INT16_C(   257),  INT16_C( 17536), -INT16_C(  2081) },
+      { -INT16_C(     1), -INT16_C(  4227),  INT16_C(     0), -INT16_C( 24297), -INT16_C(  3805), -INT16_C(  4136), -INT16_C( 27102), -INT16_C(  2049) },
+      { -INT32_C(  1791134427),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  2113929079), -INT32_C(    79444356),  INT32_C(   714913838), -INT32_C(     2623521) },
+      UINT8_C(130),
+      {  INT16_C( 14593), -INT16_C( 14785),  INT16_C(   259), -INT16_C( 21158),  INT16_C( 30470),  INT16_C( 26182),  INT16_C( 17977), -INT16_C( 16385) },
+      { -INT16_C( 28157),  INT16_C( 22554), -INT16_C(    67), -INT16_C(  3719),  INT16_C(  8194), -INT16_C(  8194),  INT16_C( 20584),  INT16_C(  8192) },
+      {  INT32_C(           0), -INT32_C(      775107),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1572863423), -INT32_C(     8421379), -INT32_C(  1811790263), -INT32_C(  2130411264) },
+      UINT8_C( 34),
+      {  INT16_C( 21231),  INT16_C( 16394),  INT16_C( 15632), -INT16_C(  2178),  INT16_C( 28274),  INT16_C(    32), -INT16_C( 21971),  INT16_C(   516) },
+      {  INT16_C(  1064), -INT16_C( 19652), -INT16_C(   257),  INT16_C( 23255), -INT16_C(  3141),  INT16_C(  1024), -INT16_C(  4161),  INT16_C( 14763) },
+      {  INT32_C(           0), -INT32_C(    63088193),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(     8388672),  INT32_C(  1220870400),  INT32_C(  1610432511), -INT32_C(  1476395009) },
+      UINT8_C( 25),
+      {       INT16_MIN, -INT16_C( 10242), -INT16_C(  8193),  INT16_C(   772), -INT16_C( 26150), -INT16_C(   529), -INT16_C( 16140),  INT16_C(   544) },
+      { -INT16_C( 12683), -INT16_C(  3205), -INT16_C(  8211), -INT16_C( 16281), -INT16_C( 16385),  INT16_C( 29695),  INT16_C( 29914),  INT16_C( 26576) },
+      {  INT32_C(   456810826),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1944749625) } },
+    { {  INT32_C(   549453824),  INT32_C(  1253454285),  INT32_C(        2336), -INT32_C(   289802258) },
+      UINT8_C( 21),
+      {  INT16_C( 10412), -INT16_C(     1), -INT16_C(  8225),  INT16_C(     0),  INT16_C(  2058), -INT16_C( 27857),  INT16_C( 19735), -INT16_C( 18465) },
+      { -INT16_C(  8450), -INT16_C( 28544), -INT16_C(  7276), -INT16_C( 22737),  INT16_C( 27698),  INT16_C( 11783),  INT16_C(  3072),  INT16_C(     1) },
+      {  INT32_C(   461500968),  INT32_C(           0), -INT32_C(   271234211),  INT32_C(           0) } },
+    { { -INT32_C(  1910546101),  INT32_C(   760152390),  INT32_C(   256842295), -INT32_C(  2013265920) },
+      UINT8_C(108),
+      { -INT16_C(  9134), -INT16_C( 16385), -INT16_C(  4106),  INT16_C( 20658),  INT16_C( 22528), -INT16_C( 23170),  INT16_C( 19490),  INT16_C( 25190) },
+      {  INT16_C(  8147), -INT16_C(     1), -INT16_C(  1157),  INT16_C(  8319), -INT16_C(  2177),  INT16_C(  4224),  INT16_C( 10834), -INT16_C(  8195) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   109928759), -INT32_C(  2008543310) } },
+    { { -INT32_C(     9179137), -INT32_C(  1645577884),  INT32_C(  1073939104),  INT32_C(  1611137552) },
+      UINT8_C( 89),
+      { -INT16_C(  7092), -INT16_C(  5243),  INT16_C(  9590),  INT16_C( 19582),  INT16_C( 20907),  INT16_C(  2311), -INT16_C(  6245),  INT16_C(   528) },
+      {  INT16_C( 17811), -INT16_C(  6145), -INT16_C(   327), -INT16_C(  8257),  INT16_C(  9931),  INT16_C( 12929), -INT16_C(     1), -INT16_C(     3) },
+      { -INT32_C(   103276514),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1611142213) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpwssd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int16_t a[16];
+    const int16_t b[16];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(      411682), -INT32_C(   525663494),  INT32_C(   939049648), -INT32_C(   367695543),  INT32_C(    50336256), -INT32_C(   996900389), -INT32_C(   189734534), -INT32_C(   100667393) },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(  2147071966),  INT32_C(  1621820154), -INT32_C(  1208434000),  INT32_C(  1779788105), -INT32_C(  2097147392),  INT32_C(  1150583259),  INT32_C(  1957749114),  INT32_C(  2046816255) } },
+    { { -INT32_C(   304475041),  INT32_C(   571473922),  INT32_C(     9455616), -INT32_C(  1073774597), -INT32_C(  1890991624), -INT32_C(  1461266300), -INT32_C(  1760647100), -INT32_C(     1048585) },
+      {  INT16_C( 21471),  INT16_C( 10755),  INT16_C(  1189),  INT16_C( 26625), -INT16_C(  2449),  INT16_C( 29375), -INT16_C(  6789),  INT16_C(  4494),
+         INT16_C(  5319), -INT16_C(  8193), -INT16_C(  1025), -INT16_C( 26845), -INT16_C(  1992), -INT16_C(  7904), -INT16_C(     4),  INT16_C( 18688) },
+      { -INT16_C( 32704),  INT16_C(     6), -INT16_C(  5881), -INT16_C( 27043), -INT16_C( 16706),  INT16_C(  1276),  INT16_C( 32170), -INT16_C( 27265),
+         INT16_C(     0), -INT16_C( 17951),  INT16_C(  2056),  INT16_C( 28574),  INT16_C( 24057), -INT16_C(  6546),  INT16_C( 19056),  INT16_C(  3136) },
+      { -INT32_C(  1006598095), -INT32_C(   155538462),  INT32_C(    87851110), -INT32_C(  1414705637), -INT32_C(  1743919081),  INT32_C(  2064524566), -INT32_C(  1756829060),  INT32_C(    57480759) } },
+    { {  INT32_C(   134385680),  INT32_C(   320865312),  INT32_C(   193069056), -INT32_C(   421844505),  INT32_C(    66735590), -INT32_C(   842688034), -INT32_C(   227684488), -INT32_C(   879022103) },
+      { -INT16_C(  1025),  INT16_C(   520), -INT16_C(  1569),  INT16_C(     0),  INT16_C( 11506),  INT16_C( 27135), -INT16_C( 15524),  INT16_C(     8),
+        -INT16_C(  5341),  INT16_C(  1031),  INT16_C( 14461), -INT16_C(     2), -INT16_C(  7282),  INT16_C(    16),       INT16_MAX, -INT16_C(     3) },
+      { -INT16_C( 16386),  INT16_C( 19009),  INT16_C(   278), -INT16_C( 30910), -INT16_C( 11470),  INT16_C(     0),  INT16_C( 26501), -INT16_C(     1),
+              INT16_MIN,  INT16_C( 15880),  INT16_C(     0), -INT16_C(     1), -INT16_C(  8193), -INT16_C( 24430), -INT16_C(  8193),  INT16_C( 32683) },
+      {  INT32_C(   161066010),  INT32_C(   320429130),  INT32_C(    61095236), -INT32_C(   833246037),  INT32_C(   258121758), -INT32_C(   842688032), -INT32_C(   168413942), -INT32_C(  1147580183) } },
+    { {  INT32_C(  2016645581), -INT32_C(   994742867), -INT32_C(  1417302261), -INT32_C(    16777259), -INT32_C(   622854145),  INT32_C(     4259872), -INT32_C(  1177726131),  INT32_C(    81602670) },
+      { -INT16_C( 18447),  INT16_C(  3120), -INT16_C( 27283),  INT16_C( 12880), -INT16_C(  4225),  INT16_C( 22349), -INT16_C(  8163), -INT16_C( 15804),
+         INT16_C( 32735),  INT16_C(   132), -INT16_C(  8197), -INT16_C(     5), -INT16_C(  1861),  INT16_C( 20214), -INT16_C(     9), -INT16_C( 32440) },
+      { -INT16_C(  4130), -INT16_C(  6149), -INT16_C( 18452),  INT16_C(     4), -INT16_C( 16045), -INT16_C( 17464),  INT16_C( 19979), -INT16_C( 19429),
+        -INT16_C( 18441), -INT16_C( 16060),  INT16_C( 29779), -INT16_C(   385), -INT16_C( 10311),  INT16_C(  5410),  INT16_C(    32),  INT16_C( 16384) },
+      {  INT32_C(  2073646811), -INT32_C(   491265431), -INT32_C(  1739815072),  INT32_C(   127190080), -INT32_C(  1228640200), -INT32_C(   239836666), -INT32_C(  1049179620), -INT32_C(   449894578) } },
+    { {  INT32_C(         256),  INT32_C(     4198436),  INT32_C(  2145386478),  INT32_C(   134218274), -INT32_C(   277781214),  INT32_C(    16777216), -INT32_C(      851969), -INT32_C(   791317507) },
+      { -INT16_C(  2594), -INT16_C(     1), -INT16_C( 20567),       INT16_MIN, -INT16_C(   257), -INT16_C(     1),  INT16_C(  4307),  INT16_C( 14324),
+         INT16_C(  2345),  INT16_C( 14358), -INT16_C( 17131),  INT16_C( 24917), -INT16_C(  5239),  INT16_C( 32250), -INT16_C( 24577), -INT16_C(  4610) },
+      {  INT16_C(  4228),  INT16_C(  8202), -INT16_C(   265),  INT16_C( 24047), -INT16_C( 15925), -INT16_C(    17),  INT16_C( 16020), -INT16_C(     1),
+         INT16_C(  4096), -INT16_C( 29952),  INT16_C( 25907),  INT16_C(     4),  INT16_C( 14975), -INT16_C( 16385),  INT16_C(  8217), -INT16_C(   393) },
+      { -INT32_C(    10975378), -INT32_C(   778323405), -INT32_C(  2145488076),  INT32_C(   203202090), -INT32_C(   698226910), -INT32_C(   426935933), -INT32_C(   607722244), -INT32_C(   991454986) } },
+    { {  INT32_C(    18942080), -INT32_C(  2079842304),  INT32_C(  1860473299),  INT32_C(  2080933963),  INT32_C(   641828555), -INT32_C(   655020882), -INT32_C(  1979703296),  INT32_C(    18907393) },
+      {  INT16_C( 12904),  INT16_C(  1028),  INT16_C( 23428), -INT16_C( 26564),  INT16_C(  4112),  INT16_C(     2),  INT16_C(  2631), -INT16_C( 18642),
+         INT16_C(  8224),  INT16_C(  8192), -INT16_C(   129),  INT16_C( 22528), -INT16_C( 23663),  INT16_C( 32072), -INT16_C(  2049),  INT16_C(  3681) },
+      {  INT16_C( 13628),  INT16_C(    16),  INT16_C( 13053),  INT16_C(  2649), -INT16_C( 27016), -INT16_C(  8209), -INT16_C(     1), -INT16_C(  6397),
+        -INT16_C(     1), -INT16_C(     1),  INT16_C( 13681),  INT16_C(   782), -INT16_C( 29747),  INT16_C(  8382),  INT16_C(    12), -INT16_C( 19217) },
+      {  INT32_C(   194814240), -INT32_C(  1844404656),  INT32_C(  1749367089), -INT32_C(  2094783090),  INT32_C(   641812139), -INT32_C(   639168835), -INT32_C(  1006972531), -INT32_C(    51854972) } },
+    { { -INT32_C(   109059075), -INT32_C(       18465),  INT32_C(      132129), -INT32_C(    11012123), -INT32_C(         133),  INT32_C(        4102), -INT32_C(  1074268161),  INT32_C(  1050814513) },
+      { -INT16_C(  2053), -INT16_C( 16901), -INT16_C( 28275),  INT16_C(  2752), -INT16_C(   169),  INT16_C( 31651),  INT16_C(     0), -INT16_C(  4225),
+        -INT16_C(  3201),  INT16_C(   972), -INT16_C( 19147), -INT16_C( 12413),  INT16_C(   245), -INT16_C(  5334), -INT16_C(     1), -INT16_C(  9418) },
+      { -INT16_C( 27053), -INT16_C( 27719),  INT16_C(   128),  INT16_C(     4), -INT16_C( 10094), -INT16_C(  2561),  INT16_C(     2), -INT16_C(   785),
+         INT16_C( 31487), -INT16_C( 30135), -INT16_C( 27183),       INT16_MIN,  INT16_C(  1024), -INT16_C( 32760),  INT16_C( 25752),  INT16_C(  5895) },
+      {  INT32_C(   414959553), -INT32_C(     3626657), -INT32_C(    79220196), -INT32_C(     7695498), -INT32_C(   130081240),  INT32_C(   927226187), -INT32_C(   899275441),  INT32_C(   995269651) } },
+    { {  INT32_C(   766268526),  INT32_C(   536871168), -INT32_C(   268436498), -INT32_C(    59244577), -INT32_C(   245143078),  INT32_C(   748214848), -INT32_C(    42029317),  INT32_C(  2146417215) },
+      { -INT16_C(  2061), -INT16_C( 16984), -INT16_C(  3708), -INT16_C(     1), -INT16_C(  2049), -INT16_C( 16389),  INT16_C( 18653),  INT16_C( 23941),
+         INT16_C(  6051), -INT16_C( 22129),  INT16_C( 19593), -INT16_C( 19555), -INT16_C( 18570), -INT16_C( 16421),       INT16_MAX,  INT16_C(  1297) },
+      { -INT16_C( 10891), -INT16_C( 16255), -INT16_C(   261), -INT16_C(  8459),  INT16_C(     0),  INT16_C(  1024), -INT16_C(     1),  INT16_C(     0),
+         INT16_C(     6), -INT16_C(    73), -INT16_C(     1),  INT16_C( 14338),  INT16_C( 25873),  INT16_C(  2052), -INT16_C(     1), -INT16_C( 30845) },
+      {  INT32_C(  1064789797),  INT32_C(   537847415), -INT32_C(   285218834), -INT32_C(    59263230), -INT32_C(   243491355),  INT32_C(   467815665), -INT32_C(   556186819),  INT32_C(  2106378483) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpwssd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(        4097),  INT32_C(   603984258), -INT32_C(    17825858),  INT32_C(  2122374542), -INT32_C(   318896409),  INT32_C(           8),  INT32_C(   756835709),  INT32_C(  2122687545) },
+      UINT8_C( 36),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      { -INT32_C(        4097),  INT32_C(   603984258),  INT32_C(  2129657790),  INT32_C(  2122374542), -INT32_C(   318896409), -INT32_C(  2147483640),  INT32_C(   756835709),  INT32_C(  2122687545) } },
+    { { -INT32_C(   873662242), -INT32_C(    33720835),  INT32_C(     8651272), -INT32_C(  1082261573),  INT32_C(         520), -INT32_C(  1493058872),  INT32_C(       24844),  INT32_C(  2147221502) },
+      UINT8_C(207),
+      { -INT16_C( 32736),  INT16_C(  2048), -INT16_C(  2085),  INT16_C(  1060),  INT16_C( 32759), -INT16_C( 28668), -INT16_C( 16385),  INT16_C( 18280),
+         INT16_C( 16896),  INT16_C( 15716), -INT16_C( 16385), -INT16_C( 12108), -INT16_C( 17085),  INT16_C( 32574),  INT16_C(  6637), -INT16_C( 12912) },
+      { -INT16_C( 29392), -INT16_C( 29141),  INT16_C( 21517),  INT16_C( 31717), -INT16_C( 21461), -INT16_C(  1041),  INT16_C( 13356), -INT16_C(   257),
+        -INT16_C(  3428),  INT16_C(  9731), -INT16_C(    69),  INT16_C( 13265), -INT16_C( 17355),  INT16_C(   225), -INT16_C( 16154),  INT16_C(    16) },
+      {  INT32_C(    28833502), -INT32_C(    44963760), -INT32_C(   664546239), -INT32_C(  1305797593),  INT32_C(         520), -INT32_C(  1493058872),  INT32_C(   303864169),  INT32_C(  2039800812) } },
+    { {  INT32_C(  1042492955),  INT32_C(       34952), -INT32_C(   608502273),  INT32_C(   268456064),  INT32_C(    70254620), -INT32_C(  1753076634), -INT32_C(  1878974464),  INT32_C(  1851108515) },
+      UINT8_C( 28),
+      {  INT16_C( 16430),  INT16_C( 13062), -INT16_C(  4097), -INT16_C( 12142), -INT16_C( 13930),  INT16_C( 11005), -INT16_C(  2275), -INT16_C(  8385),
+        -INT16_C(     1), -INT16_C( 30754), -INT16_C(     1), -INT16_C(     1),  INT16_C( 17687),  INT16_C( 27550), -INT16_C( 31351), -INT16_C(  2259) },
+      { -INT16_C( 24641),  INT16_C(  6625),  INT16_C(     1),  INT16_C(  8192), -INT16_C( 12557), -INT16_C( 16417),  INT16_C(   200), -INT16_C( 12299),
+        -INT16_C( 32371),  INT16_C( 24300), -INT16_C( 21510),  INT16_C(    42), -INT16_C( 13599),  INT16_C( 25225),  INT16_C( 16416), -INT16_C( 13082) },
+      {  INT32_C(  1042492955),  INT32_C(       34952), -INT32_C(   614252348),  INT32_C(   371128179), -INT32_C(   677035209), -INT32_C(  1753076634), -INT32_C(  1878974464),  INT32_C(  1851108515) } },
+    { { -INT32_C(  1492612046), -INT32_C(        2665),  INT32_C(  1247641959), -INT32_C(     5598668), -INT32_C(  1575235291),  INT32_C(  1781617471),  INT32_C(    67108864), -INT32_C(   807675784) },
+      UINT8_C(224),
+      { -INT16_C( 27402), -INT16_C(  4101),  INT16_C(   512),  INT16_C( 29593),  INT16_C(   256),  INT16_C(  4096), -INT16_C(     1),  INT16_C(  4424),
+        -INT16_C( 22549),  INT16_C(  4160),  INT16_C(    16),  INT16_C( 32477), -INT16_C(  3276), -INT16_C(  8209),  INT16_C(     0),  INT16_C( 21480) },
+      {  INT16_C(   292),  INT16_C(  8256), -INT16_C( 31776), -INT16_C(  8123),  INT16_C(   290), -INT16_C(  5121),  INT16_C( 21980), -INT16_C(   289),
+         INT16_C( 29875), -INT16_C(   514),  INT16_C(  6658), -INT16_C( 16425), -INT16_C( 15696),  INT16_C( 21286), -INT16_C(  8312),  INT16_C( 20480) },
+      { -INT32_C(  1492612046), -INT32_C(        2665),  INT32_C(  1247641959), -INT32_C(     5598668), -INT32_C(  1575235291),  INT32_C(  1248289274), -INT32_C(    56207814), -INT32_C(   367765384) } },
+    { { -INT32_C(   572653609), -INT32_C(   212258723),  INT32_C(  2112872446), -INT32_C(    14952736),  INT32_C(  1349985672), -INT32_C(   570433537),  INT32_C(     8472609), -INT32_C(  1483300045) },
+      UINT8_C(118),
+      {  INT16_C(  1678), -INT16_C(  4569),  INT16_C(     9), -INT16_C(    98),  INT16_C( 32229), -INT16_C( 17122), -INT16_C( 18476), -INT16_C( 12707),
+         INT16_C( 29913),  INT16_C( 16351),  INT16_C(   256),  INT16_C(     4), -INT16_C(   466),  INT16_C(  3384),  INT16_C( 30452),  INT16_C( 16391) },
+      {  INT16_C( 16392),  INT16_C( 10365),  INT16_C( 26929),  INT16_C( 18135), -INT16_C(   513), -INT16_C(  4129),  INT16_C( 19800),  INT16_C(  3074),
+         INT16_C( 30911), -INT16_C(   289),  INT16_C( 31253),  INT16_C( 32625),  INT16_C( 23657), -INT16_C( 20603),  INT16_C( 18897), -INT16_C( 16427) },
+      { -INT32_C(   572653609), -INT32_C(   213793592), -INT32_C(  2127931589), -INT32_C(    14952736), -INT32_C(  2025066320), -INT32_C(   562302269), -INT32_C(    72272105), -INT32_C(  1483300045) } },
+    { { -INT32_C(     8388657), -INT32_C(   276955137), -INT32_C(      671873),  INT32_C(   134252160),  INT32_C(   910202835), -INT32_C(  2139547111),  INT32_C(  1612266901),  INT32_C(  1204708246) },
+      UINT8_C( 48),
+      {  INT16_C( 18186), -INT16_C(  8209),  INT16_C(    16),  INT16_C(  4096), -INT16_C(  6623), -INT16_C(    33), -INT16_C(  1277),  INT16_C( 27770),
+         INT16_C( 23326), -INT16_C(  6321), -INT16_C( 32194),  INT16_C( 29269),  INT16_C( 15169), -INT16_C( 24510), -INT16_C( 29897),  INT16_C(  2314) },
+      { -INT16_C(  2049), -INT16_C( 11019),  INT16_C(  8256),  INT16_C(    16),  INT16_C( 11185),  INT16_C(    64), -INT16_C( 21504), -INT16_C(     3),
+         INT16_C(  1024),  INT16_C( 12297),  INT16_C(     0),  INT16_C(  8192),  INT16_C(    36),  INT16_C(  7917),  INT16_C(  2050), -INT16_C( 24577) },
+      { -INT32_C(     8388657), -INT32_C(   276955137), -INT32_C(      671873),  INT32_C(   134252160),  INT32_C(   856359322), -INT32_C(  1899775463),  INT32_C(  1612266901),  INT32_C(  1204708246) } },
+    { {  INT32_C(   997549444), -INT32_C(   901797527), -INT32_C(   740887570), -INT32_C(  1073758401), -INT32_C(    16809985), -INT32_C(    35651617),  INT32_C(   900340798), -INT32_C(   134217793) },
+      UINT8_C(185),
+      { -INT16_C( 26542),  INT16_C( 29093), -INT16_C(    65), -INT16_C(  3329), -INT16_C( 32640),  INT16_C( 19505),  INT16_C(  1093),  INT16_C(    24),
+         INT16_C(  2049),  INT16_C( 11980), -INT16_C(  6855),  INT16_C(    64), -INT16_C(     1), -INT16_C( 30885),  INT16_C( 17020), -INT16_C( 15146) },
+      {  INT16_C( 30089),  INT16_C( 22333), -INT16_C( 17666), -INT16_C( 26758),  INT16_C(   781), -INT16_C(   777), -INT16_C(  7856), -INT16_C(  9249),
+        -INT16_C(     1),  INT16_C( 16715),  INT16_C( 28479), -INT16_C(  6163), -INT16_C( 16841),  INT16_C( 28823), -INT16_C( 29608), -INT16_C( 16390) },
+      {  INT32_C(   848661175), -INT32_C(   901797527), -INT32_C(   740887570), -INT32_C(  1082566985),  INT32_C(   183433666), -INT32_C(   231269594),  INT32_C(   900340798), -INT32_C(   389903013) } },
+    { {  INT32_C(  1140883520),  INT32_C(   148918783), -INT32_C(    83952130), -INT32_C(   536870929), -INT32_C(    67699345),  INT32_C(      262233),  INT32_C(  1228732356), -INT32_C(  2143284720) },
+      UINT8_C(226),
+      { -INT16_C(  2561),  INT16_C( 29643), -INT16_C(  9455),  INT16_C(  1376),  INT16_C(   520), -INT16_C( 29287), -INT16_C( 25148), -INT16_C( 25995),
+        -INT16_C( 16401), -INT16_C(  3074),  INT16_C( 17791), -INT16_C( 26336),  INT16_C( 27487),  INT16_C( 17303), -INT16_C(   131),  INT16_C( 13331) },
+      { -INT16_C( 18818), -INT16_C(     1), -INT16_C( 16769), -INT16_C(   545), -INT16_C(     5), -INT16_C( 15688),  INT16_C(   257),  INT16_C(  2147),
+        -INT16_C( 12155), -INT16_C(  3285), -INT16_C( 21110),  INT16_C( 18816), -INT16_C(    33),  INT16_C( 28417),  INT16_C( 30065), -INT16_C( 17533) },
+      {  INT32_C(  1140883520),  INT32_C(   306719758), -INT32_C(    83952130), -INT32_C(   536870929), -INT32_C(    67699345), -INT32_C(   870843953),  INT32_C(  1719524636),  INT32_C(  1914011638) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpwssd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   316842956),  INT32_C(   291087487), -INT32_C(  1736441856), -INT32_C(   791776065),  INT32_C(  2145320921),  INT32_C(          16), -INT32_C(    16779329), -INT32_C(  1349111077) },
+      UINT8_C(207),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      { -INT32_C(  1830640692), -INT32_C(  1856396161),  INT32_C(   411041792),  INT32_C(  1355707583),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2130704319),  INT32_C(   798372571) } },
+    { { -INT32_C(  1101004817), -INT32_C(   830467250),  INT32_C(  1711573210),  INT32_C(  1109265440), -INT32_C(  1440166662),  INT32_C(    69476352),  INT32_C(   144769026),  INT32_C(      884738) },
+      UINT8_C( 58),
+      {  INT16_C(   256), -INT16_C(     3), -INT16_C(   582), -INT16_C(  8645), -INT16_C( 19686), -INT16_C( 26441), -INT16_C( 26483), -INT16_C(  2081),
+        -INT16_C(  5724), -INT16_C( 16385), -INT16_C(    33), -INT16_C(  1043), -INT16_C( 14121),  INT16_C(  4096), -INT16_C( 12185),  INT16_C(   204) },
+      { -INT16_C(     1), -INT16_C( 24192),       INT16_MIN, -INT16_C( 29229), -INT16_C( 26291), -INT16_C( 16418), -INT16_C( 23288),  INT16_C(  2048),
+        -INT16_C(  4098), -INT16_C( 21685),  INT16_C(    73), -INT16_C(  7512), -INT16_C(   257), -INT16_C(     1), -INT16_C(  1297),  INT16_C( 31092) },
+      {  INT32_C(           0), -INT32_C(   558711569),  INT32_C(           0),  INT32_C(  1721739656), -INT32_C(  1061400985),  INT32_C(    77308959),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(       49152),  INT32_C(   201752582), -INT32_C(   536961281),  INT32_C(  1896996857), -INT32_C(  1745398472),  INT32_C(  1242027386),  INT32_C(   101236830),  INT32_C(   701223862) },
+      UINT8_C(138),
+      { -INT16_C( 16897),  INT16_C(  4616), -INT16_C( 28754), -INT16_C( 18766), -INT16_C( 18570),  INT16_C( 17954), -INT16_C( 11281),  INT16_C(  2056),
+        -INT16_C(  8321), -INT16_C(  1541), -INT16_C(  8293),  INT16_C(  2613),  INT16_C( 21275),  INT16_C(  6075),  INT16_C( 16384),  INT16_C(   256) },
+      {  INT16_C( 11743),  INT16_C(  1024),  INT16_C(    32),  INT16_C(   260),  INT16_C(  5684), -INT16_C(   129),  INT16_C(    32), -INT16_C(  9703),
+        -INT16_C( 28785),  INT16_C(     3),  INT16_C(   544), -INT16_C( 19471), -INT16_C( 12387), -INT16_C( 16385),  INT16_C(  1540),  INT16_C( 32749) },
+      {  INT32_C(           0),  INT32_C(   195953294),  INT32_C(           0),  INT32_C(  1876686497),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   734838966) } },
+    { {  INT32_C(   830474976), -INT32_C(  1778705233), -INT32_C(  2080308696), -INT32_C(  1823983055),  INT32_C(  1075708992),  INT32_C(  1509998592), -INT32_C(   475187053), -INT32_C(   395402248) },
+      UINT8_C(197),
+      { -INT16_C( 32607), -INT16_C(   267), -INT16_C( 11705),  INT16_C( 18466), -INT16_C(  6610), -INT16_C( 12353),  INT16_C( 24852), -INT16_C( 12928),
+         INT16_C(  4100),  INT16_C(  1040),  INT16_C(  5211),  INT16_C(     0), -INT16_C(   259),  INT16_C(  2700),  INT16_C(   128), -INT16_C( 14541) },
+      {  INT16_C(    64),  INT16_C( 16127), -INT16_C( 15492), -INT16_C(     3), -INT16_C(   129),  INT16_C( 17899),  INT16_C(  3454), -INT16_C( 29234),
+        -INT16_C( 29878), -INT16_C(  8512), -INT16_C(    65), -INT16_C(  2813),  INT16_C( 11173), -INT16_C( 11141),  INT16_C(    20), -INT16_C(  1025) },
+      {  INT32_C(   824082219),  INT32_C(           0),  INT32_C(  1994404943),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   508161560), -INT32_C(   380495163) } },
+    { {  INT32_C(   329738818),  INT32_C(   768344660),  INT32_C(   572532768), -INT32_C(  1225040005),  INT32_C(  1842002517),  INT32_C(  1374078356),  INT32_C(  2000874518),  INT32_C(   738271360) },
+      UINT8_C(234),
+      { -INT16_C(  4051), -INT16_C( 17314),  INT16_C( 13714), -INT16_C(   129), -INT16_C(     1), -INT16_C( 10187), -INT16_C(   133),  INT16_C(    32),
+        -INT16_C( 24959),  INT16_C( 17406),  INT16_C( 17959), -INT16_C(  8257), -INT16_C( 13284),  INT16_C(  4096), -INT16_C(    17), -INT16_C( 10163) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 11367),  INT16_C(  6605),  INT16_C(  4253), -INT16_C( 30131),  INT16_C(    13), -INT16_C( 32743),
+        -INT16_C( 28298), -INT16_C( 18581), -INT16_C( 24744),  INT16_C(  6823),  INT16_C(  4162), -INT16_C(   289),  INT16_C(  6827),  INT16_C( 10437) },
+      {  INT32_C(           0),  INT32_C(   611605577),  INT32_C(           0), -INT32_C(  1226089510),  INT32_C(           0),  INT32_C(   873363349),  INT32_C(  1944402766),  INT32_C(   632084070) } },
+    { { -INT32_C(     2168834), -INT32_C(   134218249), -INT32_C(   876400312),  INT32_C(     7077889), -INT32_C(      150594),  INT32_C(   810021260),  INT32_C(  1835126350), -INT32_C(        1153) },
+      UINT8_C(215),
+      {  INT16_C(  1543), -INT16_C(  8193),  INT16_C(  8192),  INT16_C( 32758),  INT16_C( 22560), -INT16_C( 32561),  INT16_C(  5261),  INT16_C(  7835),
+         INT16_C(     0),  INT16_C( 27731), -INT16_C(     4),  INT16_C(  9216), -INT16_C(     5),  INT16_C(  4096), -INT16_C(   744), -INT16_C( 16801) },
+      {  INT16_C(  8851),  INT16_C(   589), -INT16_C(  2113), -INT16_C( 10223), -INT16_C(  2113),  INT16_C( 17952),  INT16_C(  9846), -INT16_C(  5086),
+         INT16_C(     0), -INT16_C(   545),  INT16_C( 20048), -INT16_C( 30381),  INT16_C(  2698), -INT16_C( 11534), -INT16_C(  8225), -INT16_C( 15743) },
+      {  INT32_C(     6662582), -INT32_C(   486412979), -INT32_C(  1508604664),  INT32_C(           0), -INT32_C(    15263989),  INT32_C(           0),  INT32_C(  1787869596),  INT32_C(   270616390) } },
+    { {  INT32_C(   515777355), -INT32_C(   120420093),  INT32_C(   239368938), -INT32_C(   671263321),  INT32_C(  1826118200),  INT32_C(   689209408),  INT32_C(   268960009), -INT32_C(    33562642) },
+      UINT8_C(134),
+      {  INT16_C(  4112),  INT16_C( 11506),  INT16_C( 20295),  INT16_C(     2), -INT16_C( 24576),  INT16_C( 17275),  INT16_C( 17672), -INT16_C(  8824),
+        -INT16_C(     1), -INT16_C( 31328), -INT16_C( 17130), -INT16_C(  1189),  INT16_C( 32701), -INT16_C( 13342), -INT16_C(  7125), -INT16_C(  7341) },
+      { -INT16_C( 27427),  INT16_C(  8442), -INT16_C(  8710),  INT16_C( 20725), -INT16_C(  7600),  INT16_C( 30760), -INT16_C( 28664), -INT16_C(   261),
+        -INT16_C( 10292), -INT16_C(  7417), -INT16_C(   139),  INT16_C( 17531),  INT16_C(     0), -INT16_C(  1264), -INT16_C( 11908),  INT16_C( 23625) },
+      {  INT32_C(           0), -INT32_C(   297148093),  INT32_C(   957525538),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   122149267) } },
+    { { -INT32_C(    22024193),  INT32_C(    33555457),  INT32_C(  2040207359), -INT32_C(    67112961), -INT32_C(   820775933),  INT32_C(    38797312), -INT32_C(     1048641), -INT32_C(    26931324) },
+      UINT8_C( 25),
+      { -INT16_C( 18198),  INT16_C( 17928), -INT16_C( 16449),  INT16_C( 24868), -INT16_C( 30749), -INT16_C(     1), -INT16_C(     1), -INT16_C( 26413),
+         INT16_C(   520),  INT16_C(    64), -INT16_C( 10445), -INT16_C(  2855),  INT16_C(  8192),  INT16_C(  8196), -INT16_C( 10242),  INT16_C(  9617) },
+      { -INT16_C( 29629), -INT16_C(  1028),  INT16_C(  7474), -INT16_C(    10),  INT16_C( 30813),  INT16_C( 16896), -INT16_C( 31396), -INT16_C( 25860),
+         INT16_C( 16386),  INT16_C(   128), -INT16_C(  5129),  INT16_C( 24714),  INT16_C(   258), -INT16_C(   547), -INT16_C(  2305),  INT16_C( 26803) },
+      {  INT32_C(   498734365),  INT32_C(           0),  INT32_C(           0),  INT32_C(   615958615), -INT32_C(   812247021),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpwssd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int16_t a[32];
+    const int16_t b[32];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   222221259), -INT32_C(   754244980), -INT32_C(  1295740315),  INT32_C(   766432978), -INT32_C(      197633), -INT32_C(   413599176), -INT32_C(   811725904),  INT32_C(  1342177296),
+         INT32_C(  2101881954),  INT32_C(   828369134), -INT32_C(   301989921), -INT32_C(  1466348865), -INT32_C(  1725999101), -INT32_C(  2055359157),  INT32_C(  1433718062), -INT32_C(  1240331616) },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      { -INT32_C(  1925262389),  INT32_C(  1393238668),  INT32_C(   851743333), -INT32_C(  1381050670),  INT32_C(  2147286015),  INT32_C(  1733884472),  INT32_C(  1335757744), -INT32_C(   805306352),
+        -INT32_C(    45601694), -INT32_C(  1319114514),  INT32_C(  1845493727),  INT32_C(   681134783),  INT32_C(   421484547),  INT32_C(    92124491), -INT32_C(   713765586),  INT32_C(   907152032) } },
+    { { -INT32_C(  1446017207),  INT32_C(   141274207),  INT32_C(  1824703597),  INT32_C(   609070024), -INT32_C(   642671329), -INT32_C(       16417), -INT32_C(   245573310), -INT32_C(       33025),
+         INT32_C(      196624),  INT32_C(   992071811),  INT32_C(  1543806499),  INT32_C(  1560757512),  INT32_C(     2099200), -INT32_C(  1195353796), -INT32_C(    61235110), -INT32_C(  1075056649) },
+      {  INT16_C( 10371), -INT16_C( 30248), -INT16_C( 31619), -INT16_C( 10707),  INT16_C( 28610), -INT16_C( 19591), -INT16_C(  4257),  INT16_C(  4164),
+        -INT16_C( 21727), -INT16_C( 16417), -INT16_C(  1025), -INT16_C(   515),  INT16_C(  4530),  INT16_C(  4098),  INT16_C(  7750),  INT16_C(  4099),
+        -INT16_C(   257),  INT16_C( 15394),  INT16_C( 28983),  INT16_C(  2304), -INT16_C(    33),  INT16_C(  8456),  INT16_C(   194), -INT16_C(     1),
+         INT16_C(  6058), -INT16_C(    17), -INT16_C( 11422), -INT16_C(  1249), -INT16_C( 17107),  INT16_C(     0), -INT16_C(   263),  INT16_C(  2459) },
+      {  INT16_C( 17816), -INT16_C( 20480),  INT16_C( 16900),  INT16_C(     2), -INT16_C(  6067),  INT16_C(  8194),  INT16_C(  1024), -INT16_C(   515),
+         INT16_C(    33),  INT16_C( 16426),  INT16_C( 11383), -INT16_C( 24318), -INT16_C( 22670), -INT16_C(     1),  INT16_C( 22351),  INT16_C(     6),
+         INT16_C( 15978), -INT16_C( 23899),  INT16_C( 26279), -INT16_C( 30855),  INT16_C(   256), -INT16_C( 22272),  INT16_C( 13807), -INT16_C( 11798),
+        -INT16_C( 17031), -INT16_C( 29406), -INT16_C(   129), -INT16_C(     3), -INT16_C(  1616),  INT16_C( 30830),  INT16_C( 11176), -INT16_C(  9982) },
+      { -INT32_C(   641768431), -INT32_C(   393108307),  INT32_C(  1490598073),  INT32_C(   602566396), -INT32_C(   913053962),  INT32_C(      839778), -INT32_C(   348272508),  INT32_C(   173211819),
+        -INT32_C(   371810928),  INT32_C(  1682626148),  INT32_C(  1355466019),  INT32_C(  1563447868), -INT32_C(   100574696), -INT32_C(  1193876611), -INT32_C(    33590198), -INT32_C(  1102541675) } },
+    { {  INT32_C(      589856), -INT32_C(  1141112834), -INT32_C(  1022965468),  INT32_C(   269107203),  INT32_C(   569296818), -INT32_C(   947649642),  INT32_C(     1059072), -INT32_C(  1563815249),
+         INT32_C(    25445932), -INT32_C(   537919489), -INT32_C(   906307649),  INT32_C(    53626673), -INT32_C(  1080035331),  INT32_C(   719505175), -INT32_C(  1731792142),  INT32_C(  1343260674) },
+      { -INT16_C(  2049),  INT16_C(     0), -INT16_C(   581),  INT16_C(   112), -INT16_C(   557), -INT16_C(  8971), -INT16_C( 16385),  INT16_C(  6931),
+        -INT16_C(     2), -INT16_C( 10077), -INT16_C( 26952), -INT16_C( 24726),  INT16_C(  2835), -INT16_C( 10727), -INT16_C(     2),  INT16_C( 18270),
+         INT16_C( 10078), -INT16_C(    73), -INT16_C(    65),  INT16_C( 30000),  INT16_C( 17408), -INT16_C( 28542), -INT16_C( 17973),  INT16_C(  6418),
+        -INT16_C( 15269),  INT16_C(   272), -INT16_C(  9698), -INT16_C( 20499), -INT16_C(  2343),  INT16_C(   512), -INT16_C(  5694),  INT16_C(  1183) },
+      {  INT16_C(  1892),  INT16_C(  4608), -INT16_C(     1),  INT16_C( 25489),  INT16_C( 16384), -INT16_C( 18191),  INT16_C( 15610),  INT16_C(     8),
+         INT16_C( 16515), -INT16_C(  2050),  INT16_C(     0), -INT16_C( 11777),  INT16_C(  7168), -INT16_C(  8258), -INT16_C(  6794),  INT16_C( 10434),
+        -INT16_C(     1),  INT16_C(  1602),  INT16_C(  4096), -INT16_C( 14213),  INT16_C( 25378), -INT16_C( 28305),  INT16_C( 16384),  INT16_C( 17800),
+        -INT16_C(  4711),  INT16_C(   786),  INT16_C(   130),  INT16_C( 30697), -INT16_C( 28550),  INT16_C( 26509), -INT16_C(    33), -INT16_C(     1) },
+      { -INT32_C(     3286852), -INT32_C(  1138257485), -INT32_C(   868899895),  INT32_C(    13392801),  INT32_C(   589921638), -INT32_C(   656451540),  INT32_C(   109963918), -INT32_C(  1373172481),
+         INT32_C(    25318908), -INT32_C(   964575729),  INT32_C(   343353885), -INT32_C(   126602559), -INT32_C(  1007889280),  INT32_C(    88986632), -INT32_C(  1651326884),  INT32_C(  1343447393) } },
+    { {  INT32_C(  2064507011),  INT32_C(   102400032), -INT32_C(   405972719), -INT32_C(   303054881), -INT32_C(  1078003841), -INT32_C(  2147318784),  INT32_C(      529040), -INT32_C(      395329),
+         INT32_C(   693845550), -INT32_C(  1573830020), -INT32_C(   100663297), -INT32_C(   196081064), -INT32_C(  1288086450),  INT32_C(     8651013), -INT32_C(   705251556),  INT32_C(  1082163266) },
+      {  INT16_C(  2633), -INT16_C( 29716),  INT16_C( 12471),  INT16_C( 17273),  INT16_C(  8216),  INT16_C(  2511), -INT16_C( 32736),  INT16_C( 32703),
+        -INT16_C(     1), -INT16_C( 27486), -INT16_C(  4097),  INT16_C( 19472),  INT16_C(  7781), -INT16_C(  2083), -INT16_C(  9185), -INT16_C(  2049),
+         INT16_C(     1), -INT16_C(  8193), -INT16_C(    98),  INT16_C( 26150),  INT16_C( 21455), -INT16_C( 20579),  INT16_C( 11998), -INT16_C(   193),
+         INT16_C(   780), -INT16_C(  3017),  INT16_C( 32733),  INT16_C(  4875),  INT16_C(     8), -INT16_C( 22657), -INT16_C(  4646), -INT16_C(   255) },
+      {  INT16_C(  7935), -INT16_C(  4609),  INT16_C(  4354), -INT16_C(     1),  INT16_C(  6148), -INT16_C( 32763), -INT16_C( 14586), -INT16_C(  5249),
+        -INT16_C( 28938),  INT16_C(  8811),  INT16_C( 29070), -INT16_C(    65), -INT16_C(  8705), -INT16_C( 22747), -INT16_C( 32752), -INT16_C(  8193),
+        -INT16_C(  6050),  INT16_C( 13650), -INT16_C(  7093), -INT16_C(  1079), -INT16_C( 13532), -INT16_C(  3630), -INT16_C( 26993), -INT16_C( 16417),
+         INT16_C(     0),  INT16_C( 25875),  INT16_C(  4680),  INT16_C(  1024),  INT16_C(   274), -INT16_C(  6825),  INT16_C(   985),  INT16_C( 27532) },
+      { -INT32_C(  2072606386),  INT32_C(   156681493), -INT32_C(   437728644),  INT32_C(     2774368), -INT32_C(  1320154049),  INT32_C(  2027283042), -INT32_C(    19822564),  INT32_C(   317219248),
+         INT32_C(   582005050), -INT32_C(  1601350756), -INT32_C(   316290587), -INT32_C(   516774597), -INT32_C(  1366151325),  INT32_C(   166833453), -INT32_C(   550615339),  INT32_C(  1070566296) } },
+    { {  INT32_C(   675348688),  INT32_C(    75759760),  INT32_C(   390578007), -INT32_C(       90497),  INT32_C(   541397001),  INT32_C(   451274947),  INT32_C(         128),  INT32_C(  1879048209),
+        -INT32_C(   958923299),  INT32_C(  1030152408),  INT32_C(   981116732),  INT32_C(   578814224), -INT32_C(  1713148207),  INT32_C(     4194304), -INT32_C(    21233697), -INT32_C(  2141709689) },
+      {  INT16_C( 23899),  INT16_C(  8192),  INT16_C(  4174), -INT16_C( 17409),       INT16_MAX,  INT16_C(   388),  INT16_C( 16110),  INT16_C( 15556),
+         INT16_C(   144),  INT16_C( 28671),  INT16_C(   548),  INT16_C(     0),  INT16_C( 23500), -INT16_C(  6457), -INT16_C(     1),  INT16_C(   128),
+         INT16_C(  1040),  INT16_C(  2048),  INT16_C(  4658),  INT16_C( 21939), -INT16_C( 24786), -INT16_C(     4),  INT16_C(   192),  INT16_C(  2048),
+        -INT16_C(  9840), -INT16_C(  6875), -INT16_C(  6759),  INT16_C( 18138), -INT16_C( 25239),  INT16_C(  4967), -INT16_C( 24545),  INT16_C( 14368) },
+      { -INT16_C(   130),  INT16_C( 16897),  INT16_C( 19710),  INT16_C(    64), -INT16_C( 17627),  INT16_C(   512),  INT16_C( 32479),  INT16_C( 21346),
+         INT16_C(  2112),  INT16_C(  3155), -INT16_C( 17260),  INT16_C(     0), -INT16_C(    17), -INT16_C( 29714), -INT16_C( 16256), -INT16_C( 23461),
+         INT16_C(  8258),  INT16_C( 32733), -INT16_C( 18608),  INT16_C(  8640), -INT16_C( 25409),  INT16_C(  7503), -INT16_C(  8088), -INT16_C( 16384),
+         INT16_C( 14201),  INT16_C(    20), -INT16_C( 13648),       INT16_MIN,  INT16_C( 14659), -INT16_C( 27592),  INT16_C(  1582), -INT16_C( 18433) },
+      {  INT32_C(   810662042),  INT32_C(   156915124), -INT32_C(   186807246),  INT32_C(   855204569),  INT32_C(   632158134),  INT32_C(   441816467),  INT32_C(   191463926),  INT32_C(  1876061457),
+        -INT32_C(   883297795),  INT32_C(  1133029304),  INT32_C(  1610874194),  INT32_C(   543706896), -INT32_C(  1853023547), -INT32_C(   497904848), -INT32_C(   528261662),  INT32_C(  1849582073) } },
+    { { -INT32_C(   319142800),  INT32_C(    50462728),  INT32_C(   247417650), -INT32_C(  1655939577),  INT32_C(   354420708),  INT32_C(  1153541470), -INT32_C(  1609922847),  INT32_C(   648002444),
+        -INT32_C(  1881283502),  INT32_C(  1292151179), -INT32_C(   556081158), -INT32_C(  1297638192), -INT32_C(       16385),  INT32_C(   553657344), -INT32_C(  1604124182), -INT32_C(  2049270019) },
+      { -INT16_C(     3),  INT16_C( 28702), -INT16_C(  8211), -INT16_C(  8705), -INT16_C(  5554),  INT16_C(  1040), -INT16_C( 10373),  INT16_C( 26326),
+        -INT16_C(     1),  INT16_C( 15495), -INT16_C(  2050),  INT16_C(  4320), -INT16_C(  1226), -INT16_C(  4282), -INT16_C(  7592),  INT16_C(   514),
+         INT16_C(    32), -INT16_C(  5035), -INT16_C( 13612), -INT16_C(   258), -INT16_C(  8197), -INT16_C( 28336),  INT16_C(  5632),  INT16_C( 22794),
+        -INT16_C(  1083), -INT16_C( 11853),  INT16_C(  5760),  INT16_C(  4100), -INT16_C(  5761), -INT16_C(  1025), -INT16_C(  2057), -INT16_C(  4353) },
+      { -INT16_C(   294),  INT16_C( 14394),  INT16_C(    33),  INT16_C(     0), -INT16_C(  2049),  INT16_C( 30581), -INT16_C(  4098),  INT16_C(  9344),
+        -INT16_C( 12583),  INT16_C( 10826),  INT16_C(  4083), -INT16_C(    17), -INT16_C(  8996), -INT16_C( 32593), -INT16_C(   258),  INT16_C( 11359),
+        -INT16_C(  4097),  INT16_C( 24685), -INT16_C( 16385), -INT16_C(     6),  INT16_C( 19316), -INT16_C( 16385), -INT16_C(     5), -INT16_C(     1),
+         INT16_C( 10009), -INT16_C(  4097), -INT16_C(  4193), -INT16_C( 12270), -INT16_C(   513),  INT16_C( 11532),  INT16_C( 18689),  INT16_C( 16393) },
+      {  INT32_C(    93994670),  INT32_C(    50191765),  INT32_C(   290602036), -INT32_C(  1367440879),  INT32_C(   522182161),  INT32_C(  1145097880), -INT32_C(  1459330525),  INT32_C(   655799706),
+        -INT32_C(  2005703581),  INT32_C(  1515185347), -INT32_C(   250129050), -INT32_C(  1297689146),  INT32_C(    37705609),  INT32_C(   479198664), -INT32_C(  1612989089),  INT32_C(  2135895275) } },
+    { {  INT32_C(   603979776), -INT32_C(   134480005), -INT32_C(  1689075593),  INT32_C(         168), -INT32_C(   731466716),  INT32_C(    15109191),  INT32_C(   538247296),  INT32_C(  1611794432),
+        -INT32_C(   536903713),  INT32_C(  2145937576),  INT32_C(  1616437740),  INT32_C(  1184665096), -INT32_C(    85987604), -INT32_C(   587966329),  INT32_C(   932352257), -INT32_C(  1449678255) },
+      {  INT16_C(  2084),  INT16_C( 12339), -INT16_C( 16385), -INT16_C(  2065), -INT16_C(   963), -INT16_C(   321),  INT16_C( 21428), -INT16_C(  1597),
+        -INT16_C(   513), -INT16_C(    17),  INT16_C( 24223), -INT16_C( 32352), -INT16_C( 23611),  INT16_C(     0),  INT16_C( 26969),  INT16_C(    64),
+         INT16_C( 24243),  INT16_C( 12931), -INT16_C( 15300),  INT16_C(    10), -INT16_C(     7), -INT16_C(  8474),  INT16_C( 31054), -INT16_C(     1),
+        -INT16_C(  7943), -INT16_C(  6892),  INT16_C( 17908), -INT16_C( 11760), -INT16_C(    17), -INT16_C(    33), -INT16_C( 21884), -INT16_C(    13) },
+      {  INT16_C( 28671),  INT16_C(  2052), -INT16_C( 13814), -INT16_C(  1153), -INT16_C( 24943), -INT16_C(  5617),  INT16_C(   644),  INT16_C(  9260),
+         INT16_C( 19772),  INT16_C(  1056),  INT16_C(    32), -INT16_C( 28500), -INT16_C( 26193),  INT16_C( 13001), -INT16_C( 21743),  INT16_C( 26127),
+        -INT16_C( 28735),  INT16_C(     1),  INT16_C( 25088), -INT16_C( 22476), -INT16_C(    65), -INT16_C(  7578),  INT16_C( 14923),  INT16_C( 17229),
+         INT16_C( 17161),  INT16_C( 12579), -INT16_C(   145),  INT16_C( 17408), -INT16_C( 11824),  INT16_C( 14263), -INT16_C( 25914),  INT16_C(  8810) },
+      {  INT32_C(   689049768),  INT32_C(    94243330), -INT32_C(  1663252427), -INT32_C(      988420), -INT32_C(   741627704),  INT32_C(   937916327),  INT32_C(  1156690219),  INT32_C(  1027079593),
+        -INT32_C(  1233513387),  INT32_C(  1761866416),  INT32_C(  1680654167),  INT32_C(  1648066709), -INT32_C(   308991895), -INT32_C(   795281069),  INT32_C(   932082586), -INT32_C(   882690809) } },
+    { {  INT32_C(   540033024),  INT32_C(      688128), -INT32_C(    26003838), -INT32_C(   282103473),  INT32_C(     1179664),  INT32_C(   915589292), -INT32_C(    67179009), -INT32_C(  1149243521),
+         INT32_C(      262272),  INT32_C(       18432),  INT32_C(   738423782), -INT32_C(    33620099), -INT32_C(  2085946418), -INT32_C(       12562), -INT32_C(    10616993),  INT32_C(   389792746) },
+      {  INT16_C(  8192), -INT16_C(    41), -INT16_C(  4055),  INT16_C(     0), -INT16_C( 28959), -INT16_C( 16401), -INT16_C(  9881), -INT16_C( 32127),
+        -INT16_C( 24464), -INT16_C( 31144), -INT16_C( 31275),  INT16_C( 24966), -INT16_C(  3221), -INT16_C( 10241), -INT16_C( 13213),  INT16_C( 31784),
+         INT16_C(  8349), -INT16_C(  8194), -INT16_C(   257), -INT16_C( 23302), -INT16_C( 19104), -INT16_C(  5249), -INT16_C(  2177),  INT16_C(    19),
+         INT16_C( 20968), -INT16_C(  3479), -INT16_C(  5153),  INT16_C( 16384),  INT16_C( 31001), -INT16_C( 21772), -INT16_C( 24830), -INT16_C(  1289) },
+      {  INT16_C(  2288),  INT16_C( 15534),  INT16_C(  8848), -INT16_C( 31422),  INT16_C(     0),  INT16_C( 28037), -INT16_C( 15546), -INT16_C(   129),
+        -INT16_C(  2049),  INT16_C( 16255), -INT16_C(    65),  INT16_C(  2828),  INT16_C( 12225), -INT16_C( 28009),  INT16_C(    38), -INT16_C( 26592),
+        -INT16_C( 32752),  INT16_C(  2619), -INT16_C( 11628),  INT16_C( 25416),  INT16_C( 17817), -INT16_C( 30461), -INT16_C(     1),  INT16_C(     8),
+         INT16_C(  4226), -INT16_C( 31671), -INT16_C( 12416), -INT16_C(    13),  INT16_C( 12797),  INT16_C( 22604), -INT16_C( 14952), -INT16_C(  4709) },
+      {  INT32_C(   558139426), -INT32_C(    35190512), -INT32_C(   485838675), -INT32_C(   124349064), -INT32_C(   454939320),  INT32_C(   988226015),  INT32_C(   180284435), -INT32_C(  1994945743),
+        -INT32_C(   294644262), -INT32_C(   589236804),  INT32_C(   557937603), -INT32_C(    33617770), -INT32_C(  1887152241),  INT32_C(    63754094), -INT32_C(   106031484),  INT32_C(   767120807) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpwssd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   478727881), -INT32_C(  1184808549), -INT32_C(  1073743498),  INT32_C(   352452656), -INT32_C(   640297346),  INT32_C(  1370623715), -INT32_C(    16777249), -INT32_C(  1111917425),
+         INT32_C(   908661866), -INT32_C(  1661685100), -INT32_C(   510967639), -INT32_C(  1889152226), -INT32_C(    75916648), -INT32_C(   268568577), -INT32_C(   537397825), -INT32_C(  1605817910) },
+      UINT16_C(27721),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      { -INT32_C(  1668755767), -INT32_C(  1184808549), -INT32_C(  1073743498), -INT32_C(  1795030992), -INT32_C(   640297346),  INT32_C(  1370623715),  INT32_C(  2130706399), -INT32_C(  1111917425),
+         INT32_C(   908661866), -INT32_C(  1661685100),  INT32_C(  1636516009),  INT32_C(   258331422), -INT32_C(    75916648),  INT32_C(  1878915071),  INT32_C(  1610085823), -INT32_C(  1605817910) } },
+    { { -INT32_C(  2103228831), -INT32_C(  1039654848),  INT32_C(   678534252), -INT32_C(    67141701),  INT32_C(  1739128937),  INT32_C(  2060671381), -INT32_C(  1889425075),  INT32_C(  1140916224),
+        -INT32_C(  1158162369), -INT32_C(  1452907415),  INT32_C(  1383741374),  INT32_C(  1102355703),  INT32_C(   137625600), -INT32_C(  1736015085),  INT32_C(  1476549941), -INT32_C(   738462018) },
+      UINT16_C(39224),
+      {  INT16_C( 16753), -INT16_C( 24321), -INT16_C(  5967),  INT16_C( 29696),  INT16_C(  1024),  INT16_C(  8194), -INT16_C(     1), -INT16_C( 19145),
+        -INT16_C( 26253),  INT16_C(  2048), -INT16_C(  4188),  INT16_C( 22230),  INT16_C(  3452), -INT16_C( 32752), -INT16_C( 20495), -INT16_C( 17020),
+         INT16_C(     0), -INT16_C(  5122), -INT16_C(  3217),  INT16_C(     1), -INT16_C( 32704), -INT16_C( 13206),  INT16_C( 32766),  INT16_C(     0),
+         INT16_C(  6370), -INT16_C(    33),  INT16_C( 11829), -INT16_C( 18378), -INT16_C(  2250), -INT16_C(     1),  INT16_C(  1028), -INT16_C(  7103) },
+      {  INT16_C( 20940),  INT16_C( 15249), -INT16_C(  2729), -INT16_C( 13434),  INT16_C( 18636),  INT16_C( 31486), -INT16_C( 17109), -INT16_C( 28193),
+         INT16_C( 25321), -INT16_C( 29348), -INT16_C(     5), -INT16_C( 16338), -INT16_C(   261),  INT16_C(  2112), -INT16_C( 27120), -INT16_C(     1),
+        -INT16_C( 32062), -INT16_C( 32702),  INT16_C(  4096), -INT16_C(  4145), -INT16_C(    19), -INT16_C( 32512), -INT16_C( 23716), -INT16_C(     1),
+        -INT16_C( 32678), -INT16_C( 17635), -INT16_C(     1),  INT16_C( 17765),  INT16_C(   513),  INT16_C(  4393),  INT16_C(     1),  INT16_C( 24575) },
+      { -INT32_C(  2103228831), -INT32_C(  1039654848),  INT32_C(   678534252),  INT32_C(   472630393),  INT32_C(  1014272020),  INT32_C(  1697498581), -INT32_C(  1889425075),  INT32_C(  1140916224),
+        -INT32_C(   990662725), -INT32_C(  1452907415),  INT32_C(  1383741374),  INT32_C(   325277247), -INT32_C(    69951305), -INT32_C(  1736015085),  INT32_C(  1476549941), -INT32_C(   913017215) } },
+    { { -INT32_C(  1811938288),  INT32_C(   716544941), -INT32_C(    33554562), -INT32_C(  1113603456),  INT32_C(         160),  INT32_C(   134479888),  INT32_C(   304611904), -INT32_C(  1610794100),
+        -INT32_C(  1598982775),  INT32_C(     1056768),  INT32_C(  2063316953), -INT32_C(  1065090942), -INT32_C(   469573765),  INT32_C(   259896414),  INT32_C(  1581325606), -INT32_C(   335873665) },
+      UINT16_C(24862),
+      {  INT16_C( 19111),  INT16_C( 14874), -INT16_C( 20563),  INT16_C(     0), -INT16_C(  3073),  INT16_C( 29223),  INT16_C(  3638), -INT16_C(  2059),
+        -INT16_C(  1569),  INT16_C(  9615), -INT16_C( 12096), -INT16_C( 16641), -INT16_C(     1),  INT16_C( 14222),  INT16_C(  8837),  INT16_C( 15001),
+        -INT16_C(     1), -INT16_C( 23798),  INT16_C( 28443), -INT16_C( 13704),  INT16_C( 15542),  INT16_C( 12289), -INT16_C( 27646),  INT16_C( 19288),
+         INT16_C( 14181),  INT16_C( 16640),  INT16_C(     0),  INT16_C( 17045),  INT16_C( 32706), -INT16_C(  8773), -INT16_C( 26432),  INT16_C( 10425) },
+      { -INT16_C(  7229), -INT16_C(     4),  INT16_C(   592),  INT16_C(  9118), -INT16_C(  2073), -INT16_C(  8193),  INT16_C( 32210),  INT16_C(     4),
+        -INT16_C( 23348),  INT16_C( 18520), -INT16_C( 19863), -INT16_C( 16393), -INT16_C( 30076),  INT16_C(  3088), -INT16_C(  2271),  INT16_C(    25),
+        -INT16_C( 10256),  INT16_C(    18), -INT16_C(  1054),  INT16_C( 21311),  INT16_C(  6581), -INT16_C( 12175), -INT16_C( 16514),  INT16_C(   512),
+         INT16_C(     0),  INT16_C( 16624),  INT16_C( 20642), -INT16_C(  1270),  INT16_C(     0),  INT16_C( 27408),  INT16_C(  3426),       INT16_MIN },
+      { -INT32_C(  1811938288),  INT32_C(   704371645), -INT32_C(   266608272), -INT32_C(   996431712),  INT32_C(   214702972),  INT32_C(   134479888),  INT32_C(   304611904), -INT32_C(  1610794100),
+        -INT32_C(  1599400883),  INT32_C(     1056768),  INT32_C(  2063316953), -INT32_C(  1065090942), -INT32_C(   469573765),  INT32_C(   238249264),  INT32_C(  1340875222), -INT32_C(   335873665) } },
+    { { -INT32_C(   919891059),  INT32_C(  2013265900), -INT32_C(   787053442),  INT32_C(    33554448),  INT32_C(   268436480), -INT32_C(   135528449),  INT32_C(      524288), -INT32_C(  1056121316),
+         INT32_C(   697919463),  INT32_C(   627853773), -INT32_C(   675279281),  INT32_C(   139067520), -INT32_C(    18874369), -INT32_C(      131169),  INT32_C(   135528464), -INT32_C(   937951232) },
+      UINT16_C(12928),
+      { -INT16_C( 32305), -INT16_C(  9348),  INT16_C( 29135),  INT16_C(  2048),  INT16_C(    32), -INT16_C(  2081),  INT16_C( 28636),  INT16_C( 30920),
+         INT16_C( 25898),  INT16_C( 16795), -INT16_C(  9992),  INT16_C( 24420), -INT16_C( 11689),  INT16_C( 12176), -INT16_C(   641), -INT16_C( 11004),
+        -INT16_C(   661),  INT16_C( 26131), -INT16_C( 14902), -INT16_C( 25266),  INT16_C(  1026),  INT16_C(  4608), -INT16_C( 16385), -INT16_C(  6145),
+        -INT16_C( 14867),  INT16_C(  7631), -INT16_C( 16641), -INT16_C(    25),  INT16_C(  6591), -INT16_C( 25249),  INT16_C(    48), -INT16_C(   165) },
+      { -INT16_C( 20485), -INT16_C(    65), -INT16_C( 16385),  INT16_C( 14873),  INT16_C( 16098), -INT16_C(    26), -INT16_C(  1093), -INT16_C( 31593),
+        -INT16_C(  8769), -INT16_C(     3),  INT16_C(  3978),  INT16_C(    64),  INT16_C( 21475),  INT16_C( 27971),  INT16_C( 21789), -INT16_C(  4543),
+        -INT16_C( 26601),  INT16_C(  7501),  INT16_C( 22960),  INT16_C(     0), -INT16_C(   513), -INT16_C(  8226), -INT16_C(   129),  INT16_C(    65),
+        -INT16_C( 21302), -INT16_C( 20885), -INT16_C(  4463),  INT16_C( 16641), -INT16_C(    66), -INT16_C( 11919), -INT16_C( 22833),  INT16_C(   610) },
+      { -INT32_C(   919891059),  INT32_C(  2013265900), -INT32_C(   787053442),  INT32_C(    33554448),  INT32_C(   268436480), -INT32_C(   135528449),  INT32_C(      524288), -INT32_C(  1020096893),
+         INT32_C(   697919463),  INT32_C(   285703853), -INT32_C(   675279281),  INT32_C(   139067520),  INT32_C(   138449030),  INT32_C(    73721589),  INT32_C(   135528464), -INT32_C(   937951232) } },
+    { {  INT32_C(  1027400705),  INT32_C(    12845056),  INT32_C(     4115200), -INT32_C(  2093747697), -INT32_C(  1610883073), -INT32_C(  1355054217),  INT32_C(       32768),  INT32_C(  1085276160),
+        -INT32_C(   316608343), -INT32_C(  1879047936),  INT32_C(  1151738250), -INT32_C(  1276133409),  INT32_C(   961825960),  INT32_C(   768218605),  INT32_C(   832687415),  INT32_C(   256929864) },
+      UINT16_C(59452),
+      {  INT16_C(  2560),  INT16_C(    64), -INT16_C(     1),  INT16_C( 16429), -INT16_C( 25450),  INT16_C(  1280),  INT16_C(   128),  INT16_C(  4232),
+        -INT16_C( 32760), -INT16_C( 14429), -INT16_C( 24262), -INT16_C(   475), -INT16_C(     9), -INT16_C(  4097),  INT16_C(  8208),  INT16_C(  7245),
+         INT16_C( 16384),  INT16_C( 10672),  INT16_C( 24756),  INT16_C( 21199),  INT16_C(   192),  INT16_C( 25516), -INT16_C(   129), -INT16_C( 22508),
+        -INT16_C( 16387), -INT16_C(    20), -INT16_C(    81),  INT16_C(  8194), -INT16_C( 22113),  INT16_C(  8597), -INT16_C( 17425), -INT16_C(     1) },
+      { -INT16_C( 22083),  INT16_C(  1024),  INT16_C(     8), -INT16_C(   769), -INT16_C( 14722), -INT16_C( 32762),  INT16_C( 17385),  INT16_C( 12761),
+        -INT16_C( 25786),  INT16_C(   641),  INT16_C( 16386), -INT16_C(   193),  INT16_C(     1), -INT16_C(  2049), -INT16_C( 32504),  INT16_C(  8198),
+        -INT16_C( 23946),  INT16_C( 28194), -INT16_C(  4161), -INT16_C(  7011), -INT16_C( 16897), -INT16_C(  1026),  INT16_C( 18116), -INT16_C( 18439),
+         INT16_C(     0), -INT16_C( 29276),  INT16_C(   544), -INT16_C(   385), -INT16_C( 15243), -INT16_C( 14906), -INT16_C(  1537), -INT16_C( 22738) },
+      {  INT32_C(  1027400705),  INT32_C(    12845056),  INT32_C(   336854740), -INT32_C(  2037517865), -INT32_C(   775382702), -INT32_C(  1752519674),  INT32_C(       32768),  INT32_C(  1085276160),
+        -INT32_C(   316608343), -INT32_C(  1879047936),  INT32_C(  1151738250), -INT32_C(   863445361),  INT32_C(   961825960),  INT32_C(   765019851),  INT32_C(  1041608992),  INT32_C(   283734827) } },
+    { { -INT32_C(  1073748737), -INT32_C(    35785217),  INT32_C(    17825792), -INT32_C(   112311227),  INT32_C(   892518159), -INT32_C(    44179521), -INT32_C(    33558547), -INT32_C(   268435969),
+         INT32_C(          96),  INT32_C(  1409540304), -INT32_C(           1),  INT32_C(    37765250), -INT32_C(  1782355914),  INT32_C(  1843396607), -INT32_C(  1009072374),  INT32_C(    67141648) },
+      UINT16_C(30968),
+      { -INT16_C(  8284), -INT16_C( 18978), -INT16_C( 32760),  INT16_C(     0),  INT16_C( 28213), -INT16_C(  2177), -INT16_C( 30536),  INT16_C(   512),
+         INT16_C(  6790),  INT16_C(  6145), -INT16_C(  1343),  INT16_C(   342),  INT16_C( 28638), -INT16_C(  2049), -INT16_C(  4190),  INT16_C( 27896),
+        -INT16_C(    33),  INT16_C(  2209), -INT16_C( 13046),  INT16_C(   260), -INT16_C(  2520),  INT16_C( 25174), -INT16_C( 24577),  INT16_C( 26356),
+         INT16_C(  4864),  INT16_C( 19544),  INT16_C( 11495), -INT16_C( 20643),  INT16_C(  1088),  INT16_C( 15661), -INT16_C( 11127), -INT16_C( 27648) },
+      { -INT16_C( 29420), -INT16_C(     1),  INT16_C( 19457), -INT16_C(  2177), -INT16_C(  4974), -INT16_C(     2), -INT16_C(  1025), -INT16_C(     2),
+         INT16_C(  6144),  INT16_C(     0), -INT16_C( 23791),  INT16_C( 28456),  INT16_C( 19164), -INT16_C( 25643), -INT16_C(  1766), -INT16_C( 31488),
+        -INT16_C(    19),  INT16_C( 30692),  INT16_C( 24801),  INT16_C( 19862), -INT16_C( 19306), -INT16_C( 29638), -INT16_C( 30979), -INT16_C(  2113),
+        -INT16_C( 12990), -INT16_C( 31996), -INT16_C(     1), -INT16_C(  9606), -INT16_C( 32674), -INT16_C( 13805), -INT16_C(     1),  INT16_C(     2) },
+      { -INT32_C(  1073748737), -INT32_C(    35785217),  INT32_C(    17825792), -INT32_C(    81012851),  INT32_C(   934235919), -INT32_C(     2496256),  INT32_C(   567802592), -INT32_C(  1139425677),
+         INT32_C(          96),  INT32_C(  1409540304), -INT32_C(           1),  INT32_C(   743445905),  INT32_C(  1824098198),  INT32_C(  2041681770), -INT32_C(  1260821791),  INT32_C(    67141648) } },
+    { { -INT32_C(   268501122),  INT32_C(  2113929207),  INT32_C(   787212421), -INT32_C(        7170), -INT32_C(  1817155659),  INT32_C(   134234112),  INT32_C(  1715263947),  INT32_C(   277217536),
+        -INT32_C(  1073809507),  INT32_C(   697563873), -INT32_C(    16778245), -INT32_C(     4195457),  INT32_C(  2079607695),  INT32_C(   134283273),  INT32_C(  1648688106), -INT32_C(  1337901054) },
+      UINT16_C(24609),
+      {  INT16_C( 30499), -INT16_C( 16897), -INT16_C( 32640), -INT16_C( 20556),  INT16_C(  2560), -INT16_C( 15831), -INT16_C( 27766),  INT16_C(  6146),
+        -INT16_C(     3),  INT16_C(   128),  INT16_C( 14407),  INT16_C( 20609),  INT16_C( 14508),  INT16_C( 15971),  INT16_C(  1850),  INT16_C( 31747),
+         INT16_C( 28202),  INT16_C( 30115),  INT16_C(  9376), -INT16_C(  6657),  INT16_C( 30914), -INT16_C( 26624),  INT16_C(  1327),  INT16_C( 11167),
+         INT16_C(    64),  INT16_C(  1040), -INT16_C(     1),  INT16_C(  4292), -INT16_C( 28136),  INT16_C( 32766),  INT16_C(  2065), -INT16_C(    49) },
+      { -INT16_C( 21890),  INT16_C( 10710), -INT16_C(  1020),  INT16_C( 10240), -INT16_C( 28416),  INT16_C(     9), -INT16_C( 22417),  INT16_C(  5135),
+        -INT16_C(   545),  INT16_C( 17408), -INT16_C( 30596), -INT16_C(   130),  INT16_C(  2048),  INT16_C(  2050),  INT16_C(     0),  INT16_C( 12373),
+         INT16_C( 29366), -INT16_C( 19147),  INT16_C(  8026), -INT16_C( 23183),  INT16_C(   612),  INT16_C(  2624),  INT16_C(  2052), -INT16_C( 18433),
+        -INT16_C( 20481),  INT16_C( 26107), -INT16_C(  8321), -INT16_C(     1), -INT16_C(   706), -INT16_C(  7690), -INT16_C( 16320),  INT16_C(  5299) },
+      { -INT32_C(  1117091102),  INT32_C(  2113929207),  INT32_C(   787212421), -INT32_C(        7170), -INT32_C(  1817155659), -INT32_C(   309241630),  INT32_C(  1715263947),  INT32_C(   277217536),
+        -INT32_C(  1073809507),  INT32_C(   697563873), -INT32_C(    16778245), -INT32_C(     4195457),  INT32_C(  2079607695),  INT32_C(   134287302),  INT32_C(  1416581582), -INT32_C(  1337901054) } },
+    { {  INT32_C(  1057055306), -INT32_C(  1529056049),  INT32_C(   257432614), -INT32_C(  2141487572),  INT32_C(  1572553148), -INT32_C(  1503322538), -INT32_C(  2112314636),  INT32_C(  1952354020),
+        -INT32_C(  1342181545), -INT32_C(        2051), -INT32_C(   134217730), -INT32_C(  2015024967),  INT32_C(   134217857),  INT32_C(   856214496),  INT32_C(  1566571775), -INT32_C(   536872129) },
+      UINT16_C(23455),
+      {  INT16_C( 32755),  INT16_C( 11546),  INT16_C( 22252),  INT16_C(  2112),  INT16_C(     9),  INT16_C(  1032),  INT16_C(    20), -INT16_C(   193),
+        -INT16_C(  6705),  INT16_C( 28005), -INT16_C(  7978), -INT16_C(  3362),  INT16_C( 32415), -INT16_C(     1),  INT16_C(     4),  INT16_C(  9346),
+        -INT16_C( 23886),  INT16_C( 28573),  INT16_C( 16504), -INT16_C(     2),  INT16_C( 10606),  INT16_C( 16386),  INT16_C( 11011), -INT16_C( 30370),
+         INT16_C( 32756),  INT16_C(  7661), -INT16_C(  9217),  INT16_C(   136),  INT16_C(  2575), -INT16_C( 32192), -INT16_C(   265), -INT16_C(  9219) },
+      { -INT16_C(  8880),  INT16_C( 18924), -INT16_C(    25), -INT16_C(     9), -INT16_C(  6609),  INT16_C(     0), -INT16_C( 22874),  INT16_C(  1373),
+        -INT16_C(  1541), -INT16_C(    81), -INT16_C( 23395), -INT16_C( 20453),  INT16_C(   288), -INT16_C(     9), -INT16_C( 28849), -INT16_C(  9751),
+         INT16_C(  6254),  INT16_C( 23507),  INT16_C( 26971), -INT16_C(  5949), -INT16_C(     1), -INT16_C(  7719),  INT16_C(  6195),  INT16_C(     0),
+        -INT16_C( 31026),  INT16_C(  8448),  INT16_C( 18013), -INT16_C(    33),  INT16_C( 20484), -INT16_C( 20653),  INT16_C( 14030),  INT16_C(  1025) },
+      {  INT32_C(   984687410), -INT32_C(  1529631357),  INT32_C(   257373133), -INT32_C(  2142210041),  INT32_C(  1580617148), -INT32_C(  1503322538), -INT32_C(  2112314636),  INT32_C(  1861105778),
+        -INT32_C(   819899078),  INT32_C(   445139231), -INT32_C(   134217730), -INT32_C(  1946811822), -INT32_C(   817349671),  INT32_C(   856214496), -INT32_C(  2010787845), -INT32_C(   536872129) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpwssd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpwssd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   946906088),  INT32_C(    33558529),  INT32_C(    16777250), -INT32_C(  1382227478),  INT32_C(  2147479551), -INT32_C(   307770573), -INT32_C(   612577027), -INT32_C(        1297),
+        -INT32_C(  1078722561), -INT32_C(  2093506506), -INT32_C(   252856561), -INT32_C(  1538185287), -INT32_C(    76874754), -INT32_C(  1244341523),  INT32_C(        9480),  INT32_C(  1841515009) },
+      UINT16_C(54458),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(           0), -INT32_C(  2113925119),  INT32_C(           0),  INT32_C(   765256170), -INT32_C(        4097),  INT32_C(  1839713075),  INT32_C(           0),  INT32_C(  2147482351),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  1894627087),  INT32_C(           0),  INT32_C(  2070608894),  INT32_C(           0), -INT32_C(  2147474168), -INT32_C(   305968639) } },
+    { {  INT32_C(  1530074927),  INT32_C(  1817061030),  INT32_C(  1754696497), -INT32_C(  1124077569), -INT32_C(   648059966),  INT32_C(   630663213),  INT32_C(   798041258),  INT32_C(  1392508936),
+        -INT32_C(  2096105319),  INT32_C(   366833228),  INT32_C(   251657281),  INT32_C(  1073704831),  INT32_C(       32784),  INT32_C(   603996160),  INT32_C(  1610612775),  INT32_C(      534849) },
+      UINT16_C(16293),
+      {  INT16_C(   128),  INT16_C(  1040),  INT16_C(    18), -INT16_C(  6401), -INT16_C(  1051),  INT16_C( 28636),  INT16_C(   128),  INT16_C(  4697),
+        -INT16_C( 27324),  INT16_C( 30951), -INT16_C( 31592), -INT16_C(    17), -INT16_C(   325), -INT16_C(   129), -INT16_C(     1),  INT16_C( 16392),
+        -INT16_C( 32598), -INT16_C( 14089), -INT16_C( 13561),  INT16_C( 13752),  INT16_C( 30347),  INT16_C( 31023), -INT16_C( 15183), -INT16_C( 15882),
+        -INT16_C(    17), -INT16_C( 11076),       INT16_MAX, -INT16_C(     1), -INT16_C(   514),  INT16_C(  2049),  INT16_C( 18432),  INT16_C(  3088) },
+      {  INT16_C( 28201),  INT16_C( 21899),  INT16_C(  2064),  INT16_C(  4224),  INT16_C( 22789), -INT16_C( 24560),  INT16_C( 29207), -INT16_C( 13325),
+         INT16_C( 30290),  INT16_C( 23570),  INT16_C(   260), -INT16_C(    57),  INT16_C(   274),  INT16_C(  2096),  INT16_C( 11687),  INT16_C(  3420),
+         INT16_C(     0),  INT16_C( 29560), -INT16_C(   998), -INT16_C( 13599), -INT16_C(   305), -INT16_C(   513), -INT16_C(  1217), -INT16_C( 23964),
+         INT16_C( 27631), -INT16_C(  8225), -INT16_C(    65),  INT16_C( 20842),  INT16_C( 30538), -INT16_C(     1), -INT16_C( 32032),  INT16_C(  4493) },
+      {  INT32_C(  1556459615),  INT32_C(           0),  INT32_C(  1027445098),  INT32_C(           0),  INT32_C(           0),  INT32_C(   622450262),  INT32_C(           0),  INT32_C(  1448557889),
+         INT32_C(  1782391137),  INT32_C(   193353658),  INT32_C(   226486647),  INT32_C(  1472778790),  INT32_C(    90663157),  INT32_C(   601845463),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1874574816), -INT32_C(      561154),  INT32_C(           0), -INT32_C(  1219921656), -INT32_C(  1209009153),  INT32_C(    84164026), -INT32_C(     8430179), -INT32_C(  2146697216),
+        -INT32_C(      263169), -INT32_C(   984680711),  INT32_C(  1098907666),  INT32_C(      131072), -INT32_C(     2099238), -INT32_C(   556659251), -INT32_C(   371216385),  INT32_C(  2139094701) },
+      UINT16_C( 8831),
+      {  INT16_C(     0),  INT16_C(    64), -INT16_C(  7043), -INT16_C(  6403),  INT16_C(  1064),  INT16_C( 16347),  INT16_C(   130),  INT16_C(     5),
+        -INT16_C(   513),  INT16_C(  4096),  INT16_C(    16), -INT16_C( 28056), -INT16_C( 11665), -INT16_C(  4161), -INT16_C(  5185), -INT16_C(   751),
+        -INT16_C(  7439), -INT16_C(  6290),  INT16_C(    27),  INT16_C(   256),  INT16_C(     0),  INT16_C( 32693),  INT16_C( 18460),  INT16_C(  7208),
+        -INT16_C( 26623),  INT16_C(  7593), -INT16_C(   515),  INT16_C( 32734),  INT16_C(  4100), -INT16_C(  2305), -INT16_C( 12801),  INT16_C( 18074) },
+      { -INT16_C(    11), -INT16_C(  8473), -INT16_C(     1),  INT16_C(   256),  INT16_C(  8192),  INT16_C(  8192), -INT16_C( 16431),  INT16_C(  4914),
+         INT16_C(     5), -INT16_C(  1025), -INT16_C( 32111), -INT16_C( 11440),  INT16_C(     8), -INT16_C(  8791),  INT16_C( 27203), -INT16_C( 20571),
+        -INT16_C(     1),  INT16_C(     8),  INT16_C( 25336),  INT16_C( 30179),  INT16_C(     0),  INT16_C( 10357), -INT16_C(  6509),  INT16_C( 32691),
+         INT16_C(  1025),  INT16_C(  2336), -INT16_C(     1),  INT16_C( 20479),  INT16_C(     2), -INT16_C( 32636),  INT16_C(    66), -INT16_C( 14852) },
+      { -INT32_C(  1875117088), -INT32_C(     2193279),  INT32_C(   142630912), -INT32_C(  1222033116), -INT32_C(  1213210118),  INT32_C(   404610890),  INT32_C(    28055852),  INT32_C(           0),
+         INT32_C(           0), -INT32_C(   976270815),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   113700850),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(      135424), -INT32_C(      262419),  INT32_C(     2098178),  INT32_C(  1870135167), -INT32_C(  1337572533),  INT32_C(   138414160),  INT32_C(    16843267), -INT32_C(  1073745985),
+        -INT32_C(   133401692), -INT32_C(         641),  INT32_C(     1048577), -INT32_C(     4360513),  INT32_C(     2117632), -INT32_C(   256709492),  INT32_C(   315058168), -INT32_C(    88211466) },
+      UINT16_C(47860),
+      { -INT16_C(  9729), -INT16_C(  3732),  INT16_C(     4),  INT16_C( 30406),  INT16_C(  6937), -INT16_C(  5644),  INT16_C(   256),  INT16_C(  8704),
+        -INT16_C(     1), -INT16_C(   129),  INT16_C( 21927),  INT16_C( 16255),  INT16_C(  4023),  INT16_C( 28111), -INT16_C(    13),  INT16_C(  8224),
+         INT16_C(  3038),  INT16_C( 21982), -INT16_C( 16362),  INT16_C( 10722),  INT16_C(     4),  INT16_C(  2048),  INT16_C(  4331),  INT16_C( 19491),
+        -INT16_C(  4105),  INT16_C(     4),  INT16_C(     0), -INT16_C( 12754),  INT16_C(  1536), -INT16_C( 30618), -INT16_C(  5137),  INT16_C( 29919) },
+      { -INT16_C( 18330),  INT16_C( 24082),  INT16_C( 10823),  INT16_C( 32703),  INT16_C(  4128), -INT16_C( 20042),  INT16_C(  1120),  INT16_C( 16033),
+        -INT16_C( 18436),  INT16_C( 31253), -INT16_C(     8),  INT16_C(     4), -INT16_C( 23804), -INT16_C(  4097), -INT16_C( 14628), -INT16_C(   259),
+        -INT16_C(  7171), -INT16_C( 22837),  INT16_C( 10292), -INT16_C( 10241),  INT16_C( 14901), -INT16_C(     2), -INT16_C( 16430), -INT16_C( 32756),
+        -INT16_C( 32512),  INT16_C( 22031),  INT16_C(  6884),  INT16_C(   128), -INT16_C( 17169),  INT16_C(  3656), -INT16_C( 21973),  INT16_C( 16449) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   143851162),  INT32_C(           0), -INT32_C(  1341585734),  INT32_C(   138303764), -INT32_C(   194090992), -INT32_C(  1075685837),
+         INT32_C(           0), -INT32_C(   278202347),  INT32_C(           0), -INT32_C(   713966039),  INT32_C(   135667516), -INT32_C(   258342004),  INT32_C(           0),  INT32_C(   516801466) } },
+    { {  INT32_C(    67380304), -INT32_C(   350829238), -INT32_C(           1), -INT32_C(  1538584078),  INT32_C(  1687431385),  INT32_C(   709936934), -INT32_C(   681791718), -INT32_C(   675414082),
+        -INT32_C(    17104897),  INT32_C(      528460),  INT32_C(  1086849060),  INT32_C(    12616704), -INT32_C(  1370715919), -INT32_C(   269516803), -INT32_C(   352321665),  INT32_C(   258692154) },
+      UINT16_C(10477),
+      { -INT16_C(     9),  INT16_C( 28164),  INT16_C(     0), -INT16_C(  8597), -INT16_C(  4101), -INT16_C( 13856), -INT16_C( 21119), -INT16_C( 20574),
+         INT16_C(  1032), -INT16_C(  2145),  INT16_C( 12370),  INT16_C( 28031), -INT16_C(  3712), -INT16_C(  4804), -INT16_C(  3759), -INT16_C(     1),
+         INT16_C(  4132),  INT16_C(     1),  INT16_C(  8121),  INT16_C(     5), -INT16_C(  2708), -INT16_C( 12764), -INT16_C( 31596), -INT16_C( 10832),
+         INT16_C(   160), -INT16_C( 29266), -INT16_C(   826), -INT16_C(     3), -INT16_C(   684),  INT16_C(  4160),  INT16_C(  6148),  INT16_C(   130) },
+      { -INT16_C(    57), -INT16_C(  8195), -INT16_C(  2496),  INT16_C(   384),  INT16_C(  9799), -INT16_C( 18452),  INT16_C( 29175), -INT16_C(  4098),
+         INT16_C(  8142), -INT16_C(  4354),  INT16_C( 21469), -INT16_C(  8648),  INT16_C(    64), -INT16_C( 29901), -INT16_C( 12504), -INT16_C( 10249),
+         INT16_C( 32255),  INT16_C(     0),  INT16_C( 30679),  INT16_C(  3154),  INT16_C( 14758),  INT16_C(   703),  INT16_C( 22741),  INT16_C( 16448),
+        -INT16_C( 20207),       INT16_MAX, -INT16_C(  4113),  INT16_C(  3800), -INT16_C(  2110),  INT16_C( 13984), -INT16_C( 26625), -INT16_C(  1153) },
+      { -INT32_C(   163423163),  INT32_C(           0),  INT32_C(   215485212), -INT32_C(  2070418651),  INT32_C(           0),  INT32_C(   733096376), -INT32_C(   538384882), -INT32_C(   628401297),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   884072668),  INT32_C(           0), -INT32_C(   266130865),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1136865750), -INT32_C(  1561146358),  INT32_C(   402017025), -INT32_C(   269090819),  INT32_C(           5), -INT32_C(  1682541852),  INT32_C(   591598046), -INT32_C(  1995486334),
+         INT32_C(   764578423), -INT32_C(   140509201), -INT32_C(       32833),  INT32_C(   173354749),  INT32_C(  1756459442),  INT32_C(  1291849764),  INT32_C(      294912), -INT32_C(   926569468) },
+      UINT16_C(34234),
+      {  INT16_C( 23800),  INT16_C(  4097),  INT16_C(  9159),  INT16_C( 32639),  INT16_C(   800), -INT16_C(  8197),  INT16_C( 16384),  INT16_C(     8),
+        -INT16_C(    17),  INT16_C(  6196),  INT16_C(    64),  INT16_C(  2448), -INT16_C( 15744), -INT16_C( 21406),  INT16_C( 19120),  INT16_C( 26888),
+        -INT16_C(  4264),  INT16_C( 25268),  INT16_C(  4608), -INT16_C(     9),  INT16_C(   272), -INT16_C(  1939), -INT16_C(     1), -INT16_C( 32122),
+        -INT16_C( 16932), -INT16_C( 15442), -INT16_C(     5), -INT16_C( 20881),  INT16_C(  7052), -INT16_C(   129), -INT16_C(   529),  INT16_C(  8201) },
+      { -INT16_C(   578),  INT16_C(     0), -INT16_C(   519), -INT16_C(    13), -INT16_C(   133), -INT16_C(  1025), -INT16_C( 12289), -INT16_C( 17788),
+        -INT16_C( 30430),  INT16_C(    33),  INT16_C(   129), -INT16_C(  1025), -INT16_C( 10855),  INT16_C( 23554), -INT16_C( 29294), -INT16_C( 19608),
+        -INT16_C(     1),  INT16_C(   256), -INT16_C(   273), -INT16_C(    33),  INT16_C(  4544),  INT16_C(  2048), -INT16_C(     1),  INT16_C(     0),
+        -INT16_C( 26240),  INT16_C( 11742),  INT16_C(     2), -INT16_C(   513),  INT16_C( 29155), -INT16_C( 16387),  INT16_C( 19250),  INT16_C(   768) },
+      {  INT32_C(           0), -INT32_C(  1566324186),  INT32_C(           0), -INT32_C(   470576099),  INT32_C(      721783), -INT32_C(  1685042796),  INT32_C(           0),  INT32_C(  1212159778),
+         INT32_C(   771051295),  INT32_C(           0), -INT32_C(     2767937),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   930454350) } },
+    { {  INT32_C(     2129920), -INT32_C(      131585), -INT32_C(  1249735916), -INT32_C(   272638017), -INT32_C(  1073742345),  INT32_C(     9536528), -INT32_C(  1711282177), -INT32_C(    68265103),
+         INT32_C(  1238093298),  INT32_C(   536880192), -INT32_C(   342681969),  INT32_C(  1115613920), -INT32_C(   994882644),  INT32_C(  1235804789), -INT32_C(           1), -INT32_C(       18513) },
+      UINT16_C(64992),
+      {  INT16_C(     0),  INT16_C(  5816),  INT16_C(     0),  INT16_C( 16657),  INT16_C( 28671), -INT16_C(  7171), -INT16_C( 31744),  INT16_C(     0),
+        -INT16_C(     1),  INT16_C(    80), -INT16_C( 30446),  INT16_C( 10732), -INT16_C(     3),  INT16_C(    64), -INT16_C( 19460), -INT16_C( 25121),
+        -INT16_C(   546),  INT16_C( 10108), -INT16_C( 30550), -INT16_C( 24609), -INT16_C(  4098),  INT16_C( 16385), -INT16_C(  6574),  INT16_C( 17904),
+         INT16_C(     0), -INT16_C( 16385), -INT16_C(   257), -INT16_C( 10816), -INT16_C(   129), -INT16_C(  9379),  INT16_C(     0),  INT16_C( 31022) },
+      {  INT16_C(  6877),  INT16_C(  4352), -INT16_C(     1), -INT16_C(     5),  INT16_C( 23341), -INT16_C(  2563), -INT16_C(  8855), -INT16_C(     1),
+        -INT16_C(   145),  INT16_C( 15226),  INT16_C(  4112), -INT16_C( 31547),  INT16_C( 16813), -INT16_C( 15542), -INT16_C(  2689), -INT16_C(   257),
+         INT16_C(  2561),  INT16_C(  1956), -INT16_C( 26548),  INT16_C(    16), -INT16_C(  5337), -INT16_C(  3541),  INT16_C(  3635),  INT16_C( 24458),
+         INT16_C(     1),  INT16_C( 22651),  INT16_C(  8192), -INT16_C(  2065), -INT16_C(     9),  INT16_C(   256),  INT16_C(  3153),  INT16_C( 23843) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   454219828), -INT32_C(  1712327304), -INT32_C(     9481066),
+         INT32_C(  1256466240),  INT32_C(           0), -INT32_C(   378830228),  INT32_C(  1529613462), -INT32_C(  1366019279),  INT32_C(  1256034485), -INT32_C(     2399864),  INT32_C(   739639033) } },
+    { {  INT32_C(  1995691618),  INT32_C(   346726074), -INT32_C(   538968161), -INT32_C(    51382401),  INT32_C(    34078848),  INT32_C(   173146145), -INT32_C(   268435593),  INT32_C(   402657280),
+        -INT32_C(   182459371),  INT32_C(  2142072791), -INT32_C(         521),  INT32_C(  1289851367),  INT32_C(     1179664),  INT32_C(  1309590298), -INT32_C(        1025), -INT32_C(   892027510) },
+      UINT16_C(33563),
+      {  INT16_C( 25532),  INT16_C(    26),  INT16_C( 15019),  INT16_C(  5824), -INT16_C(     5),  INT16_C(  8968), -INT16_C(  6432),  INT16_C(   513),
+         INT16_C( 30130), -INT16_C( 17409), -INT16_C(  1625),  INT16_C(     0), -INT16_C(   513),  INT16_C(  1536), -INT16_C( 16386),  INT16_C( 32255),
+        -INT16_C(  9530),  INT16_C( 32255),  INT16_C(  5437),  INT16_C( 16894), -INT16_C( 14345),  INT16_C(  4310),  INT16_C( 28237),       INT16_MIN,
+        -INT16_C(    66), -INT16_C( 16133),  INT16_C( 16448),       INT16_MIN,       INT16_MIN,  INT16_C( 30612), -INT16_C(  2688),  INT16_C(     8) },
+      { -INT16_C(   769), -INT16_C( 28672), -INT16_C( 29125), -INT16_C(  3690),  INT16_C(     0), -INT16_C(  8195),  INT16_C( 31312), -INT16_C( 14271),
+         INT16_C( 21288), -INT16_C(  8697), -INT16_C(     1),  INT16_C( 18433),  INT16_C( 30655),  INT16_C( 10761),  INT16_C( 32672),  INT16_C( 11280),
+        -INT16_C(  9597),  INT16_C(  8224),  INT16_C(   416), -INT16_C(    17),  INT16_C(  2112),  INT16_C(   256),  INT16_C( 11525), -INT16_C(   514),
+        -INT16_C(   289),  INT16_C( 27534),  INT16_C(  4287),  INT16_C( 19684),  INT16_C( 16402),  INT16_C(     0),  INT16_C(  4096), -INT16_C( 12736) },
+      {  INT32_C(  1975312038), -INT32_C(   112192861),  INT32_C(           0), -INT32_C(   260102208),  INT32_C(   826892361),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   174265159),  INT32_C(  2144047385),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   903139446) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpwssd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpwssd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpwssd_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,812 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpwssds
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpwssds.h>
+
+static int
+test_simde_mm_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {            INT32_MAX,            INT32_MAX,            INT32_MAX,  INT32_C(           0) } },
+    { {  INT32_C(  2147455809), -INT32_C(  2147477065),  INT32_C(  2147413265), -INT32_C(  2147443656) },
+      {  INT16_C( 12631), -INT16_C(  4417),  INT16_C( 20898), -INT16_C(   585),  INT16_C( 21961),  INT16_C(   144),  INT16_C(  1259), -INT16_C( 16735) },
+      {  INT16_C( 31051),  INT16_C(   514),  INT16_C(  4917),  INT16_C(  1354), -INT16_C(   145),  INT16_C( 12011), -INT16_C(     1), -INT16_C(   661) },
+      {            INT32_MAX, -INT32_C(  2045513689),  INT32_C(  2145958504), -INT32_C(  2136383080) } },
+    { { -INT32_C(  2147440559),  INT32_C(  2147407811), -INT32_C(  2147461483),  INT32_C(  2147410790) },
+      { -INT16_C( 22450),  INT16_C( 31473),  INT16_C(     0), -INT16_C(   513), -INT16_C( 27789), -INT16_C( 12353), -INT16_C( 27106), -INT16_C( 11505) },
+      {  INT16_C( 14580), -INT16_C( 31742),  INT16_C(  5072), -INT16_C( 16271),  INT16_C( 31739), -INT16_C(   649), -INT16_C( 28160),  INT16_C(  3518) },
+      {            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX } },
+    { {  INT32_C(  1580350321), -INT32_C(      263169),  INT32_C(  2142216174), -INT32_C(  1754455615) },
+      {  INT16_C(     0),  INT16_C(  4384),  INT16_C( 30650), -INT16_C(   521),  INT16_C(   792),  INT16_C( 17263), -INT16_C(     7),  INT16_C( 22108) },
+      {  INT16_C( 13844),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25412), -INT16_C(     1),  INT16_C(    16), -INT16_C(    71), -INT16_C( 13504) },
+      {  INT32_C(  1580350321),  INT32_C(    12976483),  INT32_C(  2142491590), -INT32_C(  2053001550) } },
+    { { -INT32_C(   188809095),  INT32_C(   134217792), -INT32_C(    67502081),  INT32_C(  1532864301) },
+      { -INT16_C(  3926),  INT16_C( 26576),       INT16_MIN,  INT16_C(  5302), -INT16_C( 32752),  INT16_C( 21324),  INT16_C(  7698),  INT16_C(  8339) },
+      { -INT16_C(   265),  INT16_C( 29002),  INT16_C(    68),  INT16_C( 20350),  INT16_C( 32735), -INT16_C(   577), -INT16_C(  8193),  INT16_C( 28673) },
+      {  INT32_C(   582988447),  INT32_C(   239885268), -INT32_C(  1151942749),  INT32_C(  1708898734) } },
+    { { -INT32_C(   940526725), -INT32_C(  1343242517), -INT32_C(      294922),  INT32_C(  2118172449) },
+      { -INT16_C(  2839),  INT16_C(  4315), -INT16_C(     1), -INT16_C(   129), -INT16_C( 30113), -INT16_C( 16362), -INT16_C(     1),  INT16_C( 16426) },
+      { -INT16_C(     1),  INT16_C(  4096),  INT16_C(  5673),  INT16_C( 15977), -INT16_C(     1),  INT16_C( 16392),  INT16_C( 21059), -INT16_C(   299) },
+      { -INT32_C(   922849646), -INT32_C(  1345309223), -INT32_C(   268470713),  INT32_C(  2113240016) } },
+    { {  INT32_C(  1646767174), -INT32_C(   335996061), -INT32_C(     1180169),  INT32_C(  1018464388) },
+      { -INT16_C(     2), -INT16_C( 10536),  INT16_C( 24605), -INT16_C(  3612),  INT16_C( 16512), -INT16_C(  3105), -INT16_C( 28672),  INT16_C(     4) },
+      {  INT16_C( 26471), -INT16_C( 25557), -INT16_C( 20361),  INT16_C( 29447), -INT16_C(   329), -INT16_C(    33), -INT16_C(  1041),  INT16_C(  4675) },
+      {  INT32_C(  1915982784), -INT32_C(   943341030), -INT32_C(     6510152),  INT32_C(  1048330640) } },
+    { { -INT32_C(    84156545), -INT32_C(      263489), -INT32_C(   799013742),  INT32_C(   536872980) },
+      { -INT16_C( 15206),  INT16_C( 14925),  INT16_C( 24801),  INT16_C( 21922), -INT16_C(  3073), -INT16_C(     3),  INT16_C(  2049),  INT16_C(  6518) },
+      {  INT16_C( 32765),  INT16_C(  8449),  INT16_C( 28079),  INT16_C(  2561),  INT16_C(  3541),  INT16_C( 16385), -INT16_C( 30715), -INT16_C( 23114) },
+      { -INT32_C(   456279810),  INT32_C(   752266032), -INT32_C(   809944390),  INT32_C(   323280893) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_dpwssds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN },
+      UINT8_C(121),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {            INT32_MAX, -INT32_C(           1),            INT32_MAX,  INT32_C(           0) } },
+    { {  INT32_C(  2147395197), -INT32_C(  2147449123),  INT32_C(  2147408029), -INT32_C(  2147452406) },
+      UINT8_C(144),
+      {  INT16_C(   513), -INT16_C( 30355), -INT16_C( 17308), -INT16_C(  4828),  INT16_C(  5264),  INT16_C( 19458), -INT16_C( 28400), -INT16_C(  2245) },
+      { -INT16_C( 20964),  INT16_C(   512), -INT16_C(    33), -INT16_C( 13479),  INT16_C(   129), -INT16_C( 13059),  INT16_C(     2), -INT16_C( 13248) },
+      {  INT32_C(  2147395197), -INT32_C(  2147449123),  INT32_C(  2147408029), -INT32_C(  2147452406) } },
+    { { -INT32_C(  2147452362),  INT32_C(  2147448813), -INT32_C(  2147408745),  INT32_C(  2147425642) },
+      UINT8_C(236),
+      { -INT16_C( 13736), -INT16_C(  8193), -INT16_C(  2089),  INT16_C( 32670), -INT16_C( 25060),  INT16_C(  4128),  INT16_C( 20351), -INT16_C(  8623) },
+      { -INT16_C( 11177),  INT16_C( 25318), -INT16_C( 32702),  INT16_C(    16), -INT16_C( 19629), -INT16_C( 12379), -INT16_C(  1025), -INT16_C( 26286) },
+      { -INT32_C(  2147452362),  INT32_C(  2147448813), -INT32_C(  1706606517),            INT32_MAX } },
+    { {  INT32_C(   475122272), -INT32_C(   402653185), -INT32_C(  2115381132), -INT32_C(      524801) },
+      UINT8_C(130),
+      {  INT16_C(     3),  INT16_C( 24608),  INT16_C(  6515),  INT16_C( 12547), -INT16_C( 18697),  INT16_C( 21438), -INT16_C(    34), -INT16_C( 19673) },
+      {  INT16_C( 17128),  INT16_C( 30762),  INT16_C(  2049),  INT16_C( 16336),  INT16_C(  6696), -INT16_C( 31624),  INT16_C( 21181),  INT16_C( 17099) },
+      {  INT32_C(   475122272), -INT32_C(   184336158), -INT32_C(  2115381132), -INT32_C(      524801) } },
+    { {  INT32_C(    34196562), -INT32_C(   841158816), -INT32_C(  1077938140), -INT32_C(   134742529) },
+      UINT8_C( 87),
+      {  INT16_C( 23550),  INT16_C(     3), -INT16_C( 15338),  INT16_C( 14900), -INT16_C( 20993),  INT16_C( 18440), -INT16_C( 32752),  INT16_C( 26931) },
+      {  INT16_C( 21966), -INT16_C( 27441),  INT16_C(    66), -INT16_C(  8195), -INT16_C( 22706),  INT16_C(    64), -INT16_C(  8209), -INT16_C(  1027) },
+      {  INT32_C(   551413539), -INT32_C(   964276624), -INT32_C(   600090922), -INT32_C(   134742529) } },
+    { {  INT32_C(  2099288148), -INT32_C(   143656025), -INT32_C(  1506737868),  INT32_C(   927356095) },
+      UINT8_C(201),
+      { -INT16_C(   641),  INT16_C( 30439), -INT16_C( 24090), -INT16_C( 32640),  INT16_C(  8729),  INT16_C(  2448),  INT16_C(     0),  INT16_C(  5130) },
+      {  INT16_C(     0),  INT16_C( 16384), -INT16_C(   129),  INT16_C( 20817), -INT16_C(  3073), -INT16_C(  2592), -INT16_C(     1),  INT16_C(  1944) },
+      {            INT32_MAX, -INT32_C(   143656025), -INT32_C(  1506737868),  INT32_C(   937328815) } },
+    { { -INT32_C(   270548993), -INT32_C(   421527553),  INT32_C(     8388608),  INT32_C(  1176071896) },
+      UINT8_C( 77),
+      { -INT16_C( 30669),  INT16_C( 30685), -INT16_C(  2351),  INT16_C( 18097), -INT16_C( 28640),  INT16_C( 17284),  INT16_C( 25407),  INT16_C(   256) },
+      { -INT16_C(   604),  INT16_C(   583), -INT16_C( 16705),  INT16_C( 18623),       INT16_MIN, -INT16_C(  6143), -INT16_C( 32060), -INT16_C( 19468) },
+      { -INT32_C(   234135562), -INT32_C(   421527553),  INT32_C(   840688516),  INT32_C(   356539668) } },
+    { {  INT32_C(  1065353199),  INT32_C(   302219950), -INT32_C(   763134917),  INT32_C(   537395202) },
+      UINT8_C(246),
+      { -INT16_C(  9030), -INT16_C(   269),  INT16_C( 17898), -INT16_C( 28239),  INT16_C(   320),  INT16_C(   792), -INT16_C(     2),  INT16_C(  2409) },
+      { -INT16_C( 12565),       INT16_MIN,  INT16_C(  2229), -INT16_C( 12289), -INT16_C( 28714), -INT16_C(  8193),  INT16_C(  6259), -INT16_C( 15138) },
+      {  INT32_C(  1065353199),  INT32_C(   689143663), -INT32_C(   778812253),  INT32_C(   537395202) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpwssds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN },
+      UINT8_C(252),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(           0),  INT32_C(           0),            INT32_MAX,  INT32_C(           0) } },
+    { {  INT32_C(  2147414522), -INT32_C(  2147430607),  INT32_C(  2147447692), -INT32_C(  2147401407) },
+      UINT8_C(228),
+      {  INT16_C(     0), -INT16_C( 24297), -INT16_C(  3805), -INT16_C(  4136), -INT16_C( 27102), -INT16_C(  2049),  INT16_C( 32255), -INT16_C(  1213) },
+      {  INT16_C( 10908), -INT16_C(    41),  INT16_C( 14593), -INT16_C( 14785),  INT16_C(   259), -INT16_C( 21158),  INT16_C( 30470),  INT16_C( 26182) },
+      {  INT32_C(           0),  INT32_C(           0),            INT32_MAX,  INT32_C(           0) } },
+    { { -INT32_C(  2147476658),  INT32_C(  2147475959), -INT32_C(  2147408308),  INT32_C(  2147474972) },
+      UINT8_C( 87),
+      { -INT16_C(  3719),  INT16_C(  8194), -INT16_C(  8194),  INT16_C( 20584),  INT16_C(  8192),  INT16_C( 23999), -INT16_C(   129), -INT16_C( 27646) },
+      { -INT16_C( 32508),  INT16_C( 21231),  INT16_C( 16394),  INT16_C( 15632), -INT16_C(  2178),  INT16_C( 28274),  INT16_C(    32), -INT16_C( 21971) },
+      { -INT32_C(  1852612592),            INT32_MAX, -INT32_C(  1486702758),  INT32_C(           0) } },
+    { { -INT32_C(  1287857347), -INT32_C(    16777217),  INT32_C(  1524060692), -INT32_C(   205833363) },
+      UINT8_C( 58),
+      {  INT16_C(  1024), -INT16_C(  4161),  INT16_C( 14763), -INT16_C( 16385),  INT16_C( 18629),  INT16_C( 24573), -INT16_C( 22529),       INT16_MIN },
+      { -INT16_C( 10242), -INT16_C(  8193),  INT16_C(   772), -INT16_C( 26150), -INT16_C(   529), -INT16_C( 16140),  INT16_C(   544), -INT16_C( 12683) },
+      {  INT32_C(           0),  INT32_C(   423087569),  INT32_C(           0),  INT32_C(   197507405) } },
+    { {  INT32_C(   859402872), -INT32_C(   538098256), -INT32_C(  1066929329), -INT32_C(  1073766929) },
+      UINT8_C( 63),
+      {  INT16_C( 29695),  INT16_C( 29914),  INT16_C( 26576), -INT16_C( 32504),  INT16_C(  8384),  INT16_C( 19126),  INT16_C(     0), -INT16_C(  4423) },
+      {  INT16_C( 10412), -INT16_C(     1), -INT16_C(  8225),  INT16_C(     0),  INT16_C(  2058), -INT16_C( 27857),  INT16_C( 19735), -INT16_C( 18465) },
+      {  INT32_C(  1168557298), -INT32_C(   756685856), -INT32_C(  1582468039), -INT32_C(   992096234) } },
+    { {  INT32_C(     2114080), -INT32_C(   476839805), -INT32_C(  1490036204),  INT32_C(  1815221448) },
+      UINT8_C( 40),
+      {  INT16_C( 11783),  INT16_C(  3072),  INT16_C(     1),  INT16_C(  2064),  INT16_C( 11599),  INT16_C(  3919), -INT16_C( 30720), -INT16_C(  9134) },
+      { -INT16_C( 16385), -INT16_C(  4106),  INT16_C( 20658),  INT16_C( 22528), -INT16_C( 23170),  INT16_C( 19490),  INT16_C( 25190),  INT16_C(  8147) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   966969950) } },
+    { { -INT32_C(  1091138159), -INT32_C(    75759875),  INT32_C(   545255241), -INT32_C(   142610433) },
+      UINT8_C(232),
+      {  INT16_C(  4224),  INT16_C( 10834), -INT16_C(  8195), -INT16_C( 26296), -INT16_C(   141), -INT16_C( 25110),  INT16_C( 16387),  INT16_C( 24584) },
+      { -INT16_C(  7092), -INT16_C(  5243),  INT16_C(  9590),  INT16_C( 19582),  INT16_C( 20907),  INT16_C(  2311), -INT16_C(  6245),  INT16_C(   528) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   231966896) } },
+    { {  INT32_C(  1167277727), -INT32_C(   402685965), -INT32_C(    21365889), -INT32_C(   541071361) },
+      UINT8_C(175),
+      {  INT16_C(  9931),  INT16_C( 12929), -INT16_C(     1), -INT16_C(     3), -INT16_C( 21617), -INT16_C(     7), -INT16_C(  8021),  INT16_C( 14328) },
+      { -INT16_C(  5611),  INT16_C(   768), -INT16_C( 15212), -INT16_C(  2896), -INT16_C(  1537), -INT16_C(  9532), -INT16_C(  4635), -INT16_C( 10243) },
+      {  INT32_C(  1121484358), -INT32_C(   402662065),  INT32_C(    11926164), -INT32_C(   650655730) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpwssds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int16_t a[16];
+    const int16_t b[16];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456) },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {            INT32_MAX,            INT32_MAX,            INT32_MAX,  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),            INT32_MAX,  INT32_C(  2147360192) } },
+    { {  INT32_C(  2147456574), -INT32_C(  2147474552),  INT32_C(  2147469684), -INT32_C(  2147461636),  INT32_C(  2147473148), -INT32_C(  2147425057),  INT32_C(  2147460635), -INT32_C(  2147458451) },
+      { -INT16_C( 26845), -INT16_C(  1992), -INT16_C(  7904), -INT16_C(     4),  INT16_C( 18688), -INT16_C( 32704),  INT16_C(     6), -INT16_C(  5881),
+        -INT16_C( 27043), -INT16_C( 16706),  INT16_C(  1276),  INT16_C( 32170), -INT16_C( 27265),  INT16_C(     0), -INT16_C( 17951),  INT16_C(  2056) },
+      {  INT16_C( 28574),  INT16_C( 24057), -INT16_C(  6546),  INT16_C( 19056),  INT16_C(  3136),  INT16_C(  1033),  INT16_C( 15123),  INT16_C( 16383),
+         INT16_C(  2946), -INT16_C(  6437),  INT16_C(  1018), -INT16_C( 12859), -INT16_C(  3475), -INT16_C( 13413), -INT16_C(  1025),  INT16_C(   520) },
+      {  INT32_C(  1332466000), -INT32_C(  2095811192),            INT32_MAX,            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX, -INT32_C(  2127989556) } },
+    { { -INT32_C(  2147422843),  INT32_C(  2147438949), -INT32_C(  2147427040),  INT32_C(  2147433912), -INT32_C(  2147384184),  INT32_C(  2147459131), -INT32_C(  2147426396),  INT32_C(  2147438581) },
+      {  INT16_C(    16),       INT16_MAX, -INT16_C(     3), -INT16_C( 16386),  INT16_C( 19009),  INT16_C(   278), -INT16_C( 30910), -INT16_C( 11470),
+         INT16_C(     0),  INT16_C( 26501), -INT16_C(     1),       INT16_MIN,  INT16_C( 15880),  INT16_C(     0), -INT16_C(     1), -INT16_C(  8193) },
+      { -INT16_C( 24430), -INT16_C(  8193),  INT16_C( 32683),  INT16_C( 30771), -INT16_C( 15179), -INT16_C( 21627), -INT16_C(   257), -INT16_C(  9505),
+         INT16_C(    65), -INT16_C( 17971),  INT16_C(  1245), -INT16_C( 18447),  INT16_C(  3120), -INT16_C( 27283),  INT16_C( 12880), -INT16_C(  4225) },
+      {            INT32_MIN,  INT32_C(  1643127294),            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX, -INT32_C(  2097880796),            INT32_MAX } },
+    { {  INT32_C(     8659072), -INT32_C(   537149569), -INT32_C(      270337), -INT32_C(   121939393),  INT32_C(  1324794841), -INT32_C(      532745), -INT32_C(  2125950846), -INT32_C(   270598217) },
+      { -INT16_C(  6149), -INT16_C( 18452),  INT16_C(     4), -INT16_C( 16045), -INT16_C( 17464),  INT16_C( 19979), -INT16_C( 19429), -INT16_C( 18441),
+        -INT16_C( 16060),  INT16_C( 29779), -INT16_C(   385), -INT16_C( 10311),  INT16_C(  5410),  INT16_C(    32),  INT16_C( 16384),  INT16_C(     0) },
+      {  INT16_C(    64),  INT16_C( 32735),  INT16_C(  2048), -INT16_C(  4239),  INT16_C(   256), -INT16_C(    14), -INT16_C( 12075), -INT16_C(  2594),
+        -INT16_C(     1), -INT16_C( 20567),       INT16_MIN, -INT16_C(   257), -INT16_C(     1),  INT16_C(  4307),  INT16_C( 14324),  INT16_C(  2345) },
+      { -INT32_C(   595760684), -INT32_C(   469126622), -INT32_C(     5020827),  INT32_C(   160501736),  INT32_C(   712346208),  INT32_C(    14732862), -INT32_C(  2125818432), -INT32_C(    35913801) } },
+    { {  INT32_C(   941022463), -INT32_C(  1122648414),  INT32_C(  1632996255), -INT32_C(   343317399),  INT32_C(  2113573664), -INT32_C(  1610612753), -INT32_C(   302058051),  INT32_C(   277102593) },
+      {  INT16_C(  8202), -INT16_C(   265),  INT16_C( 24047), -INT16_C( 15925), -INT16_C(    17),  INT16_C( 16020), -INT16_C(     1),  INT16_C(  4096),
+        -INT16_C( 29952),  INT16_C( 25907),  INT16_C(     4),  INT16_C( 14975), -INT16_C( 16385),  INT16_C(  8217), -INT16_C(   393),  INT16_C(  2056) },
+      {  INT16_C(    16),  INT16_C( 28388),  INT16_C( 31752),  INT16_C(  9793), -INT16_C(  9995), -INT16_C( 30208),  INT16_C(   288),  INT16_C( 12904),
+         INT16_C(  1028),  INT16_C( 23428), -INT16_C( 26564),  INT16_C(  4112),  INT16_C(     2),  INT16_C(  2631), -INT16_C( 18642),  INT16_C(  8224) },
+      {  INT32_C(   933630875), -INT32_C(   515061595),  INT32_C(  1149234010), -INT32_C(   290462903),            INT32_MAX, -INT32_C(  1549141809), -INT32_C(   280471894),  INT32_C(   301337443) } },
+    { {  INT32_C(   536870976), -INT32_C(     8388619),  INT32_C(  1476403200), -INT32_C(  1550770129),  INT32_C(  2101897327), -INT32_C(   134217731),  INT32_C(   241283961),  INT32_C(   893163733) },
+      {  INT16_C(    16),  INT16_C( 13053),  INT16_C(  2649), -INT16_C( 27016), -INT16_C(  8209), -INT16_C(     1), -INT16_C(  6397), -INT16_C(     1),
+        -INT16_C(     1),  INT16_C( 13681),  INT16_C(   782), -INT16_C( 29747),  INT16_C(  8382),  INT16_C(    12), -INT16_C( 19217), -INT16_C(  1665) },
+      { -INT16_C(     1),  INT16_C(     2), -INT16_C(   169), -INT16_C(     1),  INT16_C(     0), -INT16_C( 16393),  INT16_C( 16034), -INT16_C(  2053),
+        -INT16_C( 16901), -INT16_C( 28275),  INT16_C(  2752), -INT16_C(   169),  INT16_C( 31651),  INT16_C(     0), -INT16_C(  4225), -INT16_C(  3201) },
+      {  INT32_C(   536897066), -INT32_C(     8809284),  INT32_C(  1476419593), -INT32_C(  1653337574),  INT32_C(  1715083953), -INT32_C(   127038424),  INT32_C(   506582643),  INT32_C(   979685223) } },
+    { {  INT32_C(    63747024), -INT32_C(  1254795013), -INT32_C(   813478122),  INT32_C(    16071874), -INT32_C(   349564937), -INT32_C(        3105), -INT32_C(   617173754), -INT32_C(  1772892535) },
+      { -INT16_C( 27719),  INT16_C(   128),  INT16_C(     4), -INT16_C( 10094), -INT16_C(  2561),  INT16_C(     2), -INT16_C(   785),  INT16_C( 31487),
+        -INT16_C( 30135), -INT16_C( 27183),       INT16_MIN,  INT16_C(  1024), -INT16_C( 32760),  INT16_C( 25752),  INT16_C(  5895),  INT16_C( 11692) },
+      {  INT16_C(  8192), -INT16_C(  4097), -INT16_C(   905), -INT16_C(  3741),  INT16_C( 11416), -INT16_C(   642),  INT16_C( 32751), -INT16_C(  2061),
+        -INT16_C( 16984), -INT16_C(  3708), -INT16_C(     1), -INT16_C(  2049), -INT16_C( 16389),  INT16_C( 18653),  INT16_C( 23941),  INT16_C(  6051) },
+      { -INT32_C(   163851440), -INT32_C(  1217036979), -INT32_C(   842715782), -INT32_C(    74532368),  INT32_C(   263042467), -INT32_C(     2068513),  INT32_C(   400081942), -INT32_C(  1561012048) } },
+    { { -INT32_C(  1450201608),  INT32_C(  1284080111), -INT32_C(  1281541569), -INT32_C(  1216982199), -INT32_C(  1076102409),  INT32_C(  2147483631),  INT32_C(    85026782), -INT32_C(   713698395) },
+      { -INT16_C( 16255), -INT16_C(   261), -INT16_C(  8459),  INT16_C(     0),  INT16_C(  1024), -INT16_C(     1),  INT16_C(     0),  INT16_C(     6),
+        -INT16_C(    73), -INT16_C(     1),  INT16_C( 14338),  INT16_C( 25873),  INT16_C(  2052), -INT16_C(     1), -INT16_C( 30845), -INT16_C(     1) },
+      {  INT16_C(  9216), -INT16_C(   273),  INT16_C( 32384), -INT16_C(  4866),  INT16_C(     0),  INT16_C( 11548),  INT16_C( 32389),  INT16_C(  4096),
+        -INT16_C( 14526),  INT16_C(  3749), -INT16_C( 14105),  INT16_C(    32),  INT16_C( 32510),  INT16_C(  2048), -INT16_C( 13539), -INT16_C(  8737) },
+      { -INT32_C(  1599936435),  INT32_C(  1010143855), -INT32_C(  1281553117), -INT32_C(  1216957623), -INT32_C(  1075045760),  INT32_C(  1946074077),  INT32_C(   151735254), -INT32_C(   296079203) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpwssds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456) },
+      UINT8_C(159),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {            INT32_MAX,            INT32_MAX,            INT32_MAX,  INT32_C(           0),            INT32_MAX, -INT32_C(           7),  INT32_C(      123456),  INT32_C(  2147360192) } },
+    { {  INT32_C(  2147418417), -INT32_C(  2147414083),  INT32_C(  2147451309), -INT32_C(  2147421377),  INT32_C(  2147406512), -INT32_C(  2147444277),  INT32_C(  2147466067), -INT32_C(  2147455003) },
+      UINT8_C(238),
+      { -INT16_C( 29141),  INT16_C( 21517),  INT16_C( 31717), -INT16_C( 21461), -INT16_C(  1041),  INT16_C( 13356), -INT16_C(   257), -INT16_C(  3428),
+         INT16_C(  9731), -INT16_C(    69),  INT16_C( 13265), -INT16_C( 17355),  INT16_C(   225), -INT16_C( 16154),  INT16_C(    16),  INT16_C( 15907) },
+      {  INT16_C(     0), -INT16_C(  9286),  INT16_C(  4096),  INT16_C(  1072), -INT16_C( 26750), -INT16_C( 28671),  INT16_C( 28245),  INT16_C( 16430),
+         INT16_C( 13062), -INT16_C(  4097), -INT16_C( 12142), -INT16_C( 13930),  INT16_C( 11005), -INT16_C(  2275), -INT16_C(  8385), -INT16_C(     1) },
+      {  INT32_C(  2147418417), -INT32_C(  2040507443),  INT32_C(  1792368183),            INT32_MIN,  INT32_C(  2147406512), -INT32_C(  2066752757),            INT32_MAX,            INT32_MIN } },
+    { { -INT32_C(  2147463688),  INT32_C(  2147418733), -INT32_C(  2147432312),  INT32_C(  2147467996), -INT32_C(  2147388148),  INT32_C(  2147430098), -INT32_C(  2147465840),  INT32_C(  2147403108) },
+      UINT8_C(193),
+      {  INT16_C(  8192), -INT16_C( 12557), -INT16_C( 16417),  INT16_C(   200), -INT16_C( 12299), -INT16_C( 32371),  INT16_C( 24300), -INT16_C( 21510),
+         INT16_C(    42), -INT16_C( 13599),  INT16_C( 25225),  INT16_C( 16416), -INT16_C( 13082),  INT16_C(     0), -INT16_C(     1),  INT16_C( 19037) },
+      { -INT16_C(    86), -INT16_C( 24037),  INT16_C( 27185),  INT16_C(  1024), -INT16_C( 12325), -INT16_C( 27402), -INT16_C(  4101),  INT16_C(   512),
+         INT16_C( 29593),  INT16_C(   256),  INT16_C(  4096), -INT16_C(     1),  INT16_C(  4424), -INT16_C( 22549),  INT16_C(  4160),  INT16_C(    16) },
+      { -INT32_C(  1846335591),  INT32_C(  2147418733), -INT32_C(  2147432312),  INT32_C(  2147467996), -INT32_C(  2147388148),  INT32_C(  2147430098),            INT32_MIN,            INT32_MAX } },
+    { {  INT32_C(        9232),  INT32_C(  1407743380),  INT32_C(    19190789),  INT32_C(   541067296), -INT32_C(  2082414307), -INT32_C(   532343264),  INT32_C(    19038273), -INT32_C(   335544833) },
+      UINT8_C(213),
+      {  INT16_C( 21980), -INT16_C(   289),  INT16_C( 29875), -INT16_C(   514),  INT16_C(  6658), -INT16_C( 16425), -INT16_C( 15696),  INT16_C( 21286),
+        -INT16_C(  8312),  INT16_C( 20480), -INT16_C(  8739), -INT16_C(  3239),  INT16_C( 32239), -INT16_C(   229),  INT16_C( 20599), -INT16_C(  8705) },
+      {  INT16_C(   129), -INT16_C( 22634),  INT16_C(  1678), -INT16_C(  4569),  INT16_C(     9), -INT16_C(    98),  INT16_C( 32229), -INT16_C( 17122),
+        -INT16_C( 18476), -INT16_C( 12707),  INT16_C( 29913),  INT16_C( 16351),  INT16_C(   256),  INT16_C(     4), -INT16_C(   466),  INT16_C(  3384) },
+      {  INT32_C(     9385878),  INT32_C(  1407743380),  INT32_C(    20860361),  INT32_C(   541067296),            INT32_MIN, -INT32_C(   532343264),  INT32_C(    27290541), -INT32_C(   374601687) } },
+    { {  INT32_C(  1995764862),  INT32_C(  1074200582),  INT32_C(  1074318546),  INT32_C(   679336635),  INT32_C(  1764865272),  INT32_C(  1188524776), -INT32_C(    33559041), -INT32_C(   270533121) },
+      UINT8_C(233),
+      {  INT16_C( 19800),  INT16_C(  3074),  INT16_C( 30911), -INT16_C(   289),  INT16_C( 31253),  INT16_C( 32625),  INT16_C( 23657), -INT16_C( 20603),
+         INT16_C( 18897), -INT16_C( 16427), -INT16_C(  3159), -INT16_C(   129), -INT16_C(  4227), -INT16_C(    11),  INT16_C(  2048),  INT16_C( 13888) },
+      { -INT16_C( 32647),  INT16_C( 24601),  INT16_C( 18382),  INT16_C( 18186), -INT16_C(  8209),  INT16_C(    16),  INT16_C(  4096), -INT16_C(  6623),
+        -INT16_C(    33), -INT16_C(  1277),  INT16_C( 27770),  INT16_C( 23326), -INT16_C(  6321), -INT16_C( 32194),  INT16_C( 29269),  INT16_C( 15169) },
+      {  INT32_C(  1424977736),  INT32_C(  1074200582),  INT32_C(  1074318546),  INT32_C(   912689376),  INT32_C(  1764865272),  INT32_C(  1097790292), -INT32_C(     6486040),  INT32_C(       76863) } },
+    { { -INT32_C(  1606233402), -INT32_C(  1959266159),  INT32_C(   151666688), -INT32_C(   134236161), -INT32_C(   722080684),  INT32_C(   541065216),  INT32_C(     1052930),  INT32_C(   733069995) },
+      UINT8_C( 87),
+      {  INT16_C(    64), -INT16_C( 21504), -INT16_C(     3),  INT16_C(  1024),  INT16_C( 12297),  INT16_C(     0),  INT16_C(  8192),  INT16_C(    36),
+         INT16_C(  7917),  INT16_C(  2050), -INT16_C( 24577),  INT16_C( 31735), -INT16_C( 11306), -INT16_C( 16385), -INT16_C(   257), -INT16_C(   545) },
+      {  INT16_C( 13738), -INT16_C(  2049), -INT16_C( 26542),  INT16_C( 29093), -INT16_C(    65), -INT16_C(  3329), -INT16_C( 32640),  INT16_C( 19505),
+         INT16_C(  1093),  INT16_C(    24),  INT16_C(  2049),  INT16_C( 11980), -INT16_C(  6855),  INT16_C(    64), -INT16_C(     1), -INT16_C( 30885) },
+      { -INT32_C(  1561292474), -INT32_C(  1929395301),  INT32_C(   150867383), -INT32_C(   134236161), -INT32_C(   713378203),  INT32_C(   541065216),  INT32_C(    77506920),  INT32_C(   733069995) } },
+    { {  INT32_C(  1419311082),  INT32_C(  1971933886),  INT32_C(  1463627819), -INT32_C(  1157693507), -INT32_C(  1753548803),  INT32_C(    51227779), -INT32_C(    50860053), -INT32_C(   514846911) },
+      UINT8_C(144),
+      { -INT16_C(  9249), -INT16_C(     1),  INT16_C( 16715),  INT16_C( 28479), -INT16_C(  6163), -INT16_C( 16841),  INT16_C( 28823), -INT16_C( 29608),
+        -INT16_C( 16390),  INT16_C( 17408),  INT16_C(  2272), -INT16_C(  1282), -INT16_C(  8193), -INT16_C(  1034),  INT16_C(     4),  INT16_C( 18748) },
+      { -INT16_C( 32704), -INT16_C(  2561),  INT16_C( 29643), -INT16_C(  9455),  INT16_C(  1376),  INT16_C(   520), -INT16_C( 29287), -INT16_C( 25148),
+        -INT16_C( 25995), -INT16_C( 16401), -INT16_C(  3074),  INT16_C( 17791), -INT16_C( 26336),  INT16_C( 27487),  INT16_C( 17303), -INT16_C(   131) },
+      {  INT32_C(  1419311082),  INT32_C(  1971933886),  INT32_C(  1463627819), -INT32_C(  1157693507), -INT32_C(  1612999361),  INT32_C(    51227779), -INT32_C(    50860053), -INT32_C(   517233687) } },
+    { {  INT32_C(   873686002), -INT32_C(  1233192229), -INT32_C(        2241), -INT32_C(  1098940417), -INT32_C(    35651585), -INT32_C(      262177), -INT32_C(  1028124672),  INT32_C(    16842752) },
+      UINT8_C( 66),
+      {  INT16_C(  2147), -INT16_C( 12155), -INT16_C(  3285), -INT16_C( 21110),  INT16_C( 18816), -INT16_C(    33),  INT16_C( 28417),  INT16_C( 30065),
+        -INT16_C( 17533),  INT16_C(  4834),  INT16_C(  4441), -INT16_C( 26496), -INT16_C( 12082),  INT16_C( 32734),  INT16_C(     0), -INT16_C(   257) },
+      { -INT16_C( 20586),  INT16_C( 24704), -INT16_C( 21074),  INT16_C(    81), -INT16_C( 16513), -INT16_C( 22722),  INT16_C(  4863), -INT16_C(    73),
+        -INT16_C(     1),  INT16_C( 16770), -INT16_C(   513), -INT16_C(   257), -INT16_C(  2051), -INT16_C( 27496), -INT16_C(  8193), -INT16_C( 26526) },
+      {  INT32_C(   873686002), -INT32_C(  1165674049), -INT32_C(        2241), -INT32_C(  1098940417), -INT32_C(    35651585), -INT32_C(      262177), -INT32_C(  1903398554),  INT32_C(    16842752) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpwssds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456) },
+      UINT8_C(118),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(           0),            INT32_MAX,            INT32_MAX,  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),            INT32_MAX,  INT32_C(           0) } },
+    { {  INT32_C(  2147423187), -INT32_C(  2147471498),  INT32_C(  2147405795), -INT32_C(  2147408037),  INT32_C(  2147396062), -INT32_C(  2147482842),  INT32_C(  2147434194), -INT32_C(  2147468701) },
+      UINT8_C( 93),
+      {  INT16_C(  2048), -INT16_C(  4098), -INT16_C( 21685),  INT16_C(    73), -INT16_C(  7512), -INT16_C(   257), -INT16_C(     1), -INT16_C(  1297),
+         INT16_C( 31092), -INT16_C(    65),  INT16_C(  3274),  INT16_C( 20302), -INT16_C(   257),  INT16_C(  3498),  INT16_C( 28945), -INT16_C( 26633) },
+      {  INT16_C( 18951),  INT16_C(  1544),  INT16_C( 10699), -INT16_C( 16897),  INT16_C(  4616), -INT16_C( 28754), -INT16_C( 18766), -INT16_C( 18570),
+         INT16_C( 17954), -INT16_C( 11281),  INT16_C(  2056), -INT16_C(  8321), -INT16_C(  1541), -INT16_C(  8293),  INT16_C(  2613),  INT16_C( 21275) },
+      {            INT32_MAX,  INT32_C(           0),  INT32_C(  2120120181), -INT32_C(  2123303981),            INT32_MAX,  INT32_C(           0),  INT32_C(  2118821317),  INT32_C(           0) } },
+    { { -INT32_C(  2147384053),  INT32_C(  2147446803), -INT32_C(  2147468355),  INT32_C(  2147445581), -INT32_C(  2147391360),  INT32_C(  2147425587), -INT32_C(  2147413291),  INT32_C(  2147455259) },
+      UINT8_C( 62),
+      { -INT16_C(  9703), -INT16_C( 28785),  INT16_C(     3),  INT16_C(   544), -INT16_C( 19471), -INT16_C( 12387), -INT16_C( 16385),  INT16_C(  1540),
+         INT16_C( 32749),  INT16_C( 12672), -INT16_C( 27141), -INT16_C( 31743), -INT16_C( 27832),  INT16_C( 16414),  INT16_C( 23040), -INT16_C(  7251) },
+      { -INT16_C(  6034), -INT16_C( 32607), -INT16_C(   267), -INT16_C( 11705),  INT16_C( 18466), -INT16_C(  6610), -INT16_C( 12353),  INT16_C( 24852),
+        -INT16_C( 12928),  INT16_C(  4100),  INT16_C(  1040),  INT16_C(  5211),  INT16_C(     0), -INT16_C(   259),  INT16_C(  2700),  INT16_C(   128) },
+      {  INT32_C(           0),  INT32_C(  2141078482),            INT32_MIN,            INT32_MAX,            INT32_MIN,  INT32_C(  1953786174),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   545267715), -INT32_C(      131077), -INT32_C(     8388609),  INT32_C(  1173029208),  INT32_C(   226374661), -INT32_C(  1915868435), -INT32_C(  1958029100), -INT32_C(   557814721) },
+         UINT8_MAX,
+      { -INT16_C(    65), -INT16_C(  2813),  INT16_C( 11173), -INT16_C( 11141),  INT16_C(    20), -INT16_C(  1025),  INT16_C(  5031),  INT16_C( 11724),
+         INT16_C(  8736), -INT16_C( 18693),  INT16_C( 28106),  INT16_C( 20966),  INT16_C( 30530),  INT16_C( 11265), -INT16_C(  4051), -INT16_C( 17314) },
+      {  INT16_C( 13714), -INT16_C(   129), -INT16_C(     1), -INT16_C( 10187), -INT16_C(   133),  INT16_C(    32), -INT16_C( 24959),  INT16_C( 17406),
+         INT16_C( 17959), -INT16_C(  8257), -INT16_C( 13284),  INT16_C(  4096), -INT16_C(    17), -INT16_C( 10163),  INT16_C(     0),  INT16_C(     0) },
+      { -INT32_C(   545796248),  INT32_C(   113351117), -INT32_C(     8424069),  INT32_C(  1251528423),  INT32_C(   537612586),            INT32_MIN, -INT32_C(  2073034305), -INT32_C(   557814721) } },
+    { { -INT32_C(   744915878),  INT32_C(   432873748),  INT32_C(   278780723), -INT32_C(  1974608499),  INT32_C(      887296), -INT32_C(  2145781463), -INT32_C(  1854482865), -INT32_C(  1217662241) },
+      UINT8_C( 51),
+      { -INT16_C( 24744),  INT16_C(  6823),  INT16_C(  4162), -INT16_C(   289),  INT16_C(  6827),  INT16_C( 10437), -INT16_C(    34), -INT16_C(  2049),
+        -INT16_C( 13373),  INT16_C(   108), -INT16_C(     3),  INT16_C( 12359),  INT16_C( 28001), -INT16_C(     1),  INT16_C(  1543), -INT16_C(  8193) },
+      {  INT16_C(  8192),  INT16_C( 32758),  INT16_C( 22560), -INT16_C( 32561),  INT16_C(  5261),  INT16_C(  7835),  INT16_C(     0),  INT16_C( 27731),
+        -INT16_C(     4),  INT16_C(  9216), -INT16_C(     5),  INT16_C(  4096), -INT16_C(   744), -INT16_C( 16801),  INT16_C(  8851),  INT16_C(   589) },
+      { -INT32_C(   724110892),  INT32_C(   536178597),  INT32_C(           0),  INT32_C(           0),  INT32_C(     1936116), -INT32_C(  2095158984),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1324573002), -INT32_C(   669935767), -INT32_C(   138468792),  INT32_C(  1176502272),  INT32_C(   645331033), -INT32_C(   333302273),  INT32_C(         256), -INT32_C(    35651873) },
+      UINT8_C( 76),
+      {  INT16_C( 20048), -INT16_C( 30381),  INT16_C(  2698), -INT16_C( 11534), -INT16_C(  8225), -INT16_C( 15743),  INT16_C(  7870), -INT16_C(  1838),
+         INT16_C(  3652), -INT16_C( 10243),  INT16_C( 27864),  INT16_C( 10516),  INT16_C(  4104), -INT16_C(   513),  INT16_C(  4112),  INT16_C( 11506) },
+      {  INT16_C( 20295),  INT16_C(     2), -INT16_C( 24576),  INT16_C( 17275),  INT16_C( 17672), -INT16_C(  8824), -INT16_C(     1), -INT16_C( 31328),
+        -INT16_C( 17130), -INT16_C(  1189),  INT16_C( 32701), -INT16_C( 13342), -INT16_C(  7125), -INT16_C(  7341), -INT16_C( 27427),  INT16_C(  8442) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   144904760),  INT32_C(  1234075266),  INT32_C(           0),  INT32_C(           0), -INT32_C(    25474811),  INT32_C(           0) } },
+    { {  INT32_C(  1358294831), -INT32_C(   498057490),  INT32_C(  2015923711), -INT32_C(  1878515200), -INT32_C(    17039363), -INT32_C(   674445818), -INT32_C(   486044520), -INT32_C(     9046017) },
+      UINT8_C(171),
+      {  INT16_C( 17531),  INT16_C(     0), -INT16_C(  1264), -INT16_C( 11908),  INT16_C( 23625), -INT16_C(   337),  INT16_C(   512),  INT16_C( 31131),
+        -INT16_C(  1025), -INT16_C( 12525),  INT16_C(   592), -INT16_C(    17), -INT16_C(   411), -INT16_C( 18198),  INT16_C( 17928), -INT16_C( 16449) },
+      {  INT16_C( 24868), -INT16_C( 30749), -INT16_C(     1), -INT16_C(     1), -INT16_C( 26413),  INT16_C(   520),  INT16_C(    64), -INT16_C( 10445),
+        -INT16_C(  2855),  INT16_C(  8192),  INT16_C(  8196), -INT16_C( 10242),  INT16_C(  9617), -INT16_C( 29629), -INT16_C(  1028),  INT16_C(  7474) },
+      {  INT32_C(  1794255739), -INT32_C(   498044318),  INT32_C(           0),            INT32_MIN,  INT32_C(           0), -INT32_C(   669419672),  INT32_C(           0), -INT32_C(   150415827) } },
+    { { -INT32_C(      622657),  INT32_C(  2019415880),  INT32_C(  1107329064), -INT32_C(  2057517318), -INT32_C(  1694723563),  INT32_C(  1073874240),  INT32_C(     8388656), -INT32_C(   336068642) },
+      UINT8_C(169),
+      {  INT16_C( 24714),  INT16_C(   258), -INT16_C(   547), -INT16_C(  2305),  INT16_C( 26803),  INT16_C(   260), -INT16_C( 19772),  INT16_C( 11694),
+        -INT16_C(     4), -INT16_C(  6312), -INT16_C( 12386),  INT16_C( 20480),  INT16_C( 32072),  INT16_C( 12639), -INT16_C(  4609), -INT16_C( 22375) },
+      { -INT16_C( 26337), -INT16_C( 31363),  INT16_C( 21876), -INT16_C( 18926), -INT16_C(     4),  INT16_C( 10479),  INT16_C( 22074), -INT16_C(    66),
+         INT16_C(    17), -INT16_C( 27583), -INT16_C( 30703),  INT16_C(  5558),  INT16_C(  4480),       INT16_MAX,  INT16_C(  3847), -INT16_C( 17301) },
+      { -INT32_C(   659606929),  INT32_C(           0),  INT32_C(           0),            INT32_MIN,  INT32_C(           0),  INT32_C(  1567989438),  INT32_C(           0),  INT32_C(    33310410) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpwssds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int16_t a[32];
+    const int16_t b[32];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456),
+         INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456) },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {            INT32_MAX,            INT32_MAX,            INT32_MAX,  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),            INT32_MAX,  INT32_C(  2147360192),
+                   INT32_MAX,            INT32_MAX,            INT32_MAX,  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),            INT32_MAX,  INT32_C(  2147360192) } },
+    { {  INT32_C(  2147450790), -INT32_C(  2147477977),  INT32_C(  2147400453), -INT32_C(  2147404683),  INT32_C(  2147416627), -INT32_C(  2147435676),  INT32_C(  2147393286), -INT32_C(  2147459757),
+         INT32_C(  2147457731), -INT32_C(  2147439488),  INT32_C(  2147385775), -INT32_C(  2147422506),  INT32_C(  2147447106), -INT32_C(  2147419129),  INT32_C(  2147463491), -INT32_C(  2147415607) },
+      { -INT16_C( 17107),  INT16_C(     0), -INT16_C(   263),  INT16_C(  2459),  INT16_C( 17816), -INT16_C( 20480),  INT16_C( 16900),  INT16_C(     2),
+        -INT16_C(  6067),  INT16_C(  8194),  INT16_C(  1024), -INT16_C(   515),  INT16_C(    33),  INT16_C( 16426),  INT16_C( 11383), -INT16_C( 24318),
+        -INT16_C( 22670), -INT16_C(     1),  INT16_C( 22351),  INT16_C(     6),  INT16_C( 15978), -INT16_C( 23899),  INT16_C( 26279), -INT16_C( 30855),
+         INT16_C(   256), -INT16_C( 22272),  INT16_C( 13807), -INT16_C( 11798), -INT16_C( 17031), -INT16_C( 29406), -INT16_C(   129), -INT16_C(     3) },
+      { -INT16_C(  1616),  INT16_C( 30830),  INT16_C( 11176), -INT16_C(  9982),  INT16_C(  5873),  INT16_C( 31615), -INT16_C( 15610),  INT16_C(  4106),
+         INT16_C(  8686), -INT16_C( 14460),  INT16_C(    16), -INT16_C( 23862),  INT16_C(   388), -INT16_C(  8209), -INT16_C( 13830),  INT16_C(   818),
+        -INT16_C( 16481),  INT16_C( 10978), -INT16_C( 26426),  INT16_C( 20496), -INT16_C(  2049),  INT16_C(     0), -INT16_C(   581),  INT16_C(   112),
+        -INT16_C(   557), -INT16_C(  8971), -INT16_C( 16385),  INT16_C(  6931), -INT16_C(     2), -INT16_C( 10077), -INT16_C( 26952), -INT16_C( 24726) },
+      {            INT32_MAX,            INT32_MIN,  INT32_C(  1604558621),            INT32_MIN,  INT32_C(  1976233425), -INT32_C(  2135130362),  INT32_C(  2012565056),            INT32_MIN,
+                   INT32_MAX,            INT32_MIN,  INT32_C(  2114646853),            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX, -INT32_C(  2143864621) } },
+    { { -INT32_C(  2147463480),  INT32_C(  2147462378), -INT32_C(  2147434951),  INT32_C(  2147401217), -INT32_C(  2147438120),  INT32_C(  2147431347), -INT32_C(  2147441372),  INT32_C(  2147440737),
+        -INT32_C(  2147444873),  INT32_C(  2147393733), -INT32_C(  2147401238),  INT32_C(  2147450316), -INT32_C(  2147459651),  INT32_C(  2147386237), -INT32_C(  2147459471),  INT32_C(  2147385235) },
+      { -INT16_C(     1),  INT16_C( 25489),  INT16_C( 16384), -INT16_C( 18191),  INT16_C( 15610),  INT16_C(     8),  INT16_C( 16515), -INT16_C(  2050),
+         INT16_C(     0), -INT16_C( 11777),  INT16_C(  7168), -INT16_C(  8258), -INT16_C(  6794),  INT16_C( 10434), -INT16_C(     1),  INT16_C(  1602),
+         INT16_C(  4096), -INT16_C( 14213),  INT16_C( 25378), -INT16_C( 28305),  INT16_C( 16384),  INT16_C( 17800), -INT16_C(  4711),  INT16_C(   786),
+         INT16_C(   130),  INT16_C( 30697), -INT16_C( 28550),  INT16_C( 26509), -INT16_C(    33), -INT16_C(     1),  INT16_C(  6920), -INT16_C(  2534) },
+      { -INT16_C(     1), -INT16_C(  4625), -INT16_C( 16450), -INT16_C( 32766),  INT16_C(     8), -INT16_C(     7),  INT16_C( 10587), -INT16_C( 24015),
+        -INT16_C(  1537), -INT16_C(  2992), -INT16_C( 19655),  INT16_C(   132), -INT16_C( 10762),  INT16_C( 16512),  INT16_C(  2633), -INT16_C( 29716),
+         INT16_C( 12471),  INT16_C( 17273),  INT16_C(  8216),  INT16_C(  2511), -INT16_C( 32736),  INT16_C( 32703), -INT16_C(     1), -INT16_C( 27486),
+        -INT16_C(  4097),  INT16_C( 19472),  INT16_C(  7781), -INT16_C(  2083), -INT16_C(  9185), -INT16_C(  2049),  INT16_C(     1), -INT16_C(  8193) },
+      {            INT32_MIN,            INT32_MAX, -INT32_C(  2147310127),            INT32_MAX, -INT32_C(  2112201336),  INT32_C(  2005454251), -INT32_C(  1902038136),  INT32_C(  2099833072),
+                   INT32_MIN,            INT32_MAX, -INT32_C(  2101634462),  INT32_C(  2125851031), -INT32_C(  1550260277),  INT32_C(  1870020440), -INT32_C(  2147154317),            INT32_MAX } },
+    { {  INT32_C(    51122176), -INT32_C(   197718675),  INT32_C(  2145247212),  INT32_C(   319495499),  INT32_C(      524321), -INT32_C(  1484783629), -INT32_C(   304420035), -INT32_C(    16681028),
+         INT32_C(   520081279), -INT32_C(   302008339),  INT32_C(   285376928), -INT32_C(         129),  INT32_C(   402915456), -INT32_C(  2147121016), -INT32_C(   955858549), -INT32_C(   343932961) },
+      { -INT16_C( 28938),  INT16_C(  8811),  INT16_C( 29070), -INT16_C(    65), -INT16_C(  8705), -INT16_C( 22747), -INT16_C( 32752), -INT16_C(  8193),
+        -INT16_C(  6050),  INT16_C( 13650), -INT16_C(  7093), -INT16_C(  1079), -INT16_C( 13532), -INT16_C(  3630), -INT16_C( 26993), -INT16_C( 16417),
+         INT16_C(     0),  INT16_C( 25875),  INT16_C(  4680),  INT16_C(  1024),  INT16_C(   274), -INT16_C(  6825),  INT16_C(   985),  INT16_C( 27532),
+        -INT16_C( 24713),  INT16_C( 10305),  INT16_C(  1156),  INT16_C(  5959), -INT16_C(     2),  INT16_C(  8261),  INT16_C(  6885),  INT16_C(     0) },
+      {  INT16_C( 28672), -INT16_C( 14633),  INT16_C( 15718),  INT16_C( 14970),  INT16_C(  8832), -INT16_C( 26141),  INT16_C(    64), -INT16_C(   325),
+        -INT16_C( 32680),  INT16_C( 23899),  INT16_C(  8192),  INT16_C(  4174), -INT16_C( 17409),       INT16_MAX,  INT16_C(   388),  INT16_C( 16110),
+         INT16_C( 15556),  INT16_C(   144),  INT16_C( 28671),  INT16_C(   548),  INT16_C(     0),  INT16_C( 23500), -INT16_C(  6457), -INT16_C(     1),
+         INT16_C(   128),  INT16_C(  1040),  INT16_C(  2048),  INT16_C(  4658),  INT16_C( 21939), -INT16_C( 24786), -INT16_C(     4),  INT16_C(   192) },
+      { -INT32_C(   907519523),  INT32_C(   258230535),            INT32_MAX,  INT32_C(   320062096),  INT32_C(   524459671), -INT32_C(  1547393231), -INT32_C(   187785657), -INT32_C(   291632182),
+         INT32_C(   523807279), -INT32_C(   167266907),  INT32_C(   124989428), -INT32_C(     6387806),  INT32_C(   410469392), -INT32_C(  2116996506), -INT32_C(  1160659573), -INT32_C(   343960501) } },
+    { { -INT32_C(  1371421961), -INT32_C(   751922963), -INT32_C(   644808766), -INT32_C(   450516250), -INT32_C(   442951091),  INT32_C(  1188724781), -INT32_C(  1654041185),  INT32_C(   325562799),
+        -INT32_C(  1608536932),  INT32_C(   941631012), -INT32_C(     8487937),  INT32_C(  1107361792),  INT32_C(  1291730254),  INT32_C(     4196384), -INT32_C(  1155158037),  INT32_C(    33554432) },
+      {  INT16_C( 32479),  INT16_C( 21346),  INT16_C(  2112),  INT16_C(  3155), -INT16_C( 17260),  INT16_C(     0), -INT16_C(    17), -INT16_C( 29714),
+        -INT16_C( 16256), -INT16_C( 23461),  INT16_C(  8258),  INT16_C( 32733), -INT16_C( 18608),  INT16_C(  8640), -INT16_C( 25409),  INT16_C(  7503),
+        -INT16_C(  8088), -INT16_C( 16384),  INT16_C( 14201),  INT16_C(    20), -INT16_C( 13648),       INT16_MIN,  INT16_C( 14659), -INT16_C( 27592),
+         INT16_C(  1582), -INT16_C( 18433),  INT16_C( 22585),  INT16_C(   770),  INT16_C(  3775), -INT16_C( 25268),  INT16_C(  5408),  INT16_C( 17601) },
+      { -INT16_C( 24566),  INT16_C(  9887), -INT16_C( 28707),  INT16_C( 19716), -INT16_C(  8486), -INT16_C( 19801), -INT16_C(     1),  INT16_C(  8448),
+        -INT16_C( 24477), -INT16_C( 31270), -INT16_C(     3),  INT16_C( 28702), -INT16_C(  8211), -INT16_C(  8705), -INT16_C(  5554),  INT16_C(  1040),
+        -INT16_C( 10373),  INT16_C( 26326), -INT16_C(     1),  INT16_C( 15495), -INT16_C(  2050),  INT16_C(  4320), -INT16_C(  1226), -INT16_C(  4282),
+        -INT16_C(  7592),  INT16_C(   514),  INT16_C(    32), -INT16_C(  5035), -INT16_C( 13612), -INT16_C(   258), -INT16_C(  8197), -INT16_C( 28336) },
+      { -INT32_C(  1958253173), -INT32_C(   750348167), -INT32_C(   498340406), -INT32_C(   701540105),  INT32_C(   688572491),  INT32_C(  2128202573), -INT32_C(  1576462097),  INT32_C(   474487505),
+        -INT32_C(  1955965292),  INT32_C(   941926711), -INT32_C(   122067297),  INT32_C(  1207538802),  INT32_C(  1270245148),  INT32_C(     1042154), -INT32_C(  1200024193), -INT32_C(   509516880) } },
+    { { -INT32_C(  1225331132),  INT32_C(  1493892172), -INT32_C(    70965986), -INT32_C(   776762825),  INT32_C(   377491456),  INT32_C(   268699648), -INT32_C(   377519896), -INT32_C(    67108929),
+        -INT32_C(   134750209), -INT32_C(   285220865), -INT32_C(    19234863),  INT32_C(   943345730),  INT32_C(     2162688),  INT32_C(       33056), -INT32_C(   134217861),  INT32_C(  2004178338) },
+      { -INT16_C(  4098),  INT16_C(  9344), -INT16_C( 12583),  INT16_C( 10826),  INT16_C(  4083), -INT16_C(    17), -INT16_C(  8996), -INT16_C( 32593),
+        -INT16_C(   258),  INT16_C( 11359), -INT16_C(  4097),  INT16_C( 24685), -INT16_C( 16385), -INT16_C(     6),  INT16_C( 19316), -INT16_C( 16385),
+        -INT16_C(     5), -INT16_C(     1),  INT16_C( 10009), -INT16_C(  4097), -INT16_C(  4193), -INT16_C( 12270), -INT16_C(   513),  INT16_C( 11532),
+         INT16_C( 18689),  INT16_C( 16393), -INT16_C( 15698),  INT16_C(  9216), -INT16_C(  2053), -INT16_C( 25774),  INT16_C(     0), -INT16_C( 11162) },
+      {  INT16_C(   230),  INT16_C(  8213),  INT16_C( 24594), -INT16_C(  8193),  INT16_C( 32744),  INT16_C( 24664),  INT16_C( 18076), -INT16_C(  1313),
+        -INT16_C(  8972),  INT16_C( 14226), -INT16_C( 22121),  INT16_C(  2084),  INT16_C( 12339), -INT16_C( 16385), -INT16_C(  2065), -INT16_C(   963),
+        -INT16_C(   321),  INT16_C( 21428), -INT16_C(  1597), -INT16_C(   513), -INT16_C(    17),  INT16_C( 24223), -INT16_C( 32352), -INT16_C( 23611),
+         INT16_C(     0),  INT16_C( 26969),  INT16_C(    64),  INT16_C( 24243),  INT16_C( 12931), -INT16_C( 15300),  INT16_C(    10), -INT16_C(     7) },
+      { -INT32_C(  1149531400),  INT32_C(  1095728452),  INT32_C(    62308478), -INT32_C(   896579912),  INT32_C(   541399366),  INT32_C(   410772925), -INT32_C(   579596101), -INT32_C(    91217714),
+        -INT32_C(   134770032), -INT32_C(   299103477), -INT32_C(   316379792),  INT32_C(   687660254),  INT32_C(   444265505),  INT32_C(   222451872),  INT32_C(   233576996),  INT32_C(  2004256472) } },
+    { { -INT32_C(   555311182),  INT32_C(  2035163381), -INT32_C(       32771), -INT32_C(   520531050), -INT32_C(   451638684),  INT32_C(  1173657890), -INT32_C(   770653973), -INT32_C(     1052801),
+        -INT32_C(     2105613), -INT32_C(  1434156674), -INT32_C(      791561),  INT32_C(  1879048155),  INT32_C(   134513672), -INT32_C(   905301254), -INT32_C(    75501569), -INT32_C(  1634623714) },
+      { -INT16_C(  5617),  INT16_C(   644),  INT16_C(  9260),  INT16_C( 19772),  INT16_C(  1056),  INT16_C(    32), -INT16_C( 28500), -INT16_C( 26193),
+         INT16_C( 13001), -INT16_C( 21743),  INT16_C( 26127), -INT16_C( 28735),  INT16_C(     1),  INT16_C( 25088), -INT16_C( 22476), -INT16_C(    65),
+        -INT16_C(  7578),  INT16_C( 14923),  INT16_C( 17229),  INT16_C( 17161),  INT16_C( 12579), -INT16_C(   145),  INT16_C( 17408), -INT16_C( 11824),
+         INT16_C( 14263), -INT16_C( 25914),  INT16_C(  8810), -INT16_C( 26713),  INT16_C(  8240),  INT16_C(    10), -INT16_C(   397), -INT16_C(  4305) },
+      {  INT16_C(    18),  INT16_C( 13970), -INT16_C(  1026), -INT16_C( 17537),  INT16_C(     4),  INT16_C(     0),  INT16_C( 11267), -INT16_C(   514),
+        -INT16_C( 31830), -INT16_C(     1), -INT16_C(   163),  INT16_C(  5947),  INT16_C(  8192), -INT16_C(    41), -INT16_C(  4055),  INT16_C(     0),
+        -INT16_C( 28959), -INT16_C( 16401), -INT16_C(  9881), -INT16_C( 32127), -INT16_C( 24464), -INT16_C( 31144), -INT16_C( 31275),  INT16_C( 24966),
+        -INT16_C(  3221), -INT16_C( 10241), -INT16_C( 13213),  INT16_C( 31784),  INT16_C(  8349), -INT16_C(  8194), -INT16_C(   257), -INT16_C( 23302) },
+      { -INT32_C(   546415608),  INT32_C(  1678921057), -INT32_C(       28547), -INT32_C(   828177348), -INT32_C(   865438771),  INT32_C(   998512144), -INT32_C(   771674389),  INT32_C(    90087379),
+        -INT32_C(    27406434),            INT32_MIN, -INT32_C(   304008337),  INT32_C(  1039414971),  INT32_C(   353957823), -INT32_C(  1870753776), -INT32_C(     6787749), -INT32_C(  1534206575) } },
+    { { -INT32_C(   343932929), -INT32_C(   142608385),  INT32_C(     1294340),  INT32_C(  1374191126), -INT32_C(   227959073), -INT32_C(   337675265),  INT32_C(  1073745936),  INT32_C(  2031724012),
+        -INT32_C(  1426845682), -INT32_C(  1627249321), -INT32_C(    84410625),  INT32_C(   149964546),  INT32_C(  1018077125),  INT32_C(   579862896), -INT32_C(  2059237167),  INT32_C(       12288) },
+      {  INT16_C( 28037), -INT16_C( 15546), -INT16_C(   129), -INT16_C(  2049),  INT16_C( 16255), -INT16_C(    65),  INT16_C(  2828),  INT16_C( 12225),
+        -INT16_C( 28009),  INT16_C(    38), -INT16_C( 26592), -INT16_C( 32752),  INT16_C(  2619), -INT16_C( 11628),  INT16_C( 25416),  INT16_C( 17817),
+        -INT16_C( 30461), -INT16_C(     1),  INT16_C(     8),  INT16_C(  4226), -INT16_C( 31671), -INT16_C( 12416), -INT16_C(    13),  INT16_C( 12797),
+         INT16_C( 22604), -INT16_C( 14952), -INT16_C(  4709),  INT16_C(  7304), -INT16_C( 18079), -INT16_C( 16385),  INT16_C(  5378), -INT16_C(  9771) },
+      {  INT16_C( 20914), -INT16_C(   257), -INT16_C( 16967),  INT16_C( 13865), -INT16_C( 25356), -INT16_C(  7797), -INT16_C( 28827), -INT16_C(  1159),
+        -INT16_C(  4099), -INT16_C(  8201), -INT16_C( 24503), -INT16_C(  4055),  INT16_C( 26814), -INT16_C(  8193), -INT16_C( 32752),  INT16_C(  8228),
+        -INT16_C(  2104),  INT16_C( 20496), -INT16_C(  5982), -INT16_C(  9010), -INT16_C( 13903), -INT16_C(   516), -INT16_C(   513), -INT16_C(  2867),
+        -INT16_C( 28361), -INT16_C(     2), -INT16_C(     1), -INT16_C( 16352), -INT16_C( 16641),  INT16_C(    53),  INT16_C(  7843),  INT16_C(  3631) },
+      {  INT32_C(   246428211), -INT32_C(   168829027), -INT32_C(   410360635),  INT32_C(  1278499595), -INT32_C(   113461820),  INT32_C(   446717871),  INT32_C(  1239240006),  INT32_C(  1345897456),
+        -INT32_C(  1362776234), -INT32_C(  1665373437),  INT32_C(   362317944),  INT32_C(   113282216),  INT32_C(   377034985),  INT32_C(   460432597), -INT32_C(  1759252933),  INT32_C(     6713441) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpwssds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456),
+         INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456) },
+      UINT16_C(31035),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {            INT32_MAX,            INT32_MAX,            INT32_MAX,  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),  INT32_C(      123456), -INT32_C(      123456),
+                   INT32_MAX, -INT32_C(           1),            INT32_MAX,  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),            INT32_MAX, -INT32_C(      123456) } },
+    { {  INT32_C(  2147469678), -INT32_C(  2147386443),  INT32_C(  2147407803), -INT32_C(  2147449396),  INT32_C(  2147445071), -INT32_C(  2147438735),  INT32_C(  2147455284), -INT32_C(  2147479202),
+         INT32_C(  2147443058), -INT32_C(  2147441920),  INT32_C(  2147401469), -INT32_C(  2147479310),  INT32_C(  2147474921), -INT32_C(  2147465695),  INT32_C(  2147436283), -INT32_C(  2147449557) },
+      UINT16_C(31557),
+      { -INT16_C( 17109), -INT16_C( 28193),  INT16_C( 25321), -INT16_C( 29348), -INT16_C(     5), -INT16_C( 16338), -INT16_C(   261),  INT16_C(  2112),
+        -INT16_C( 27120), -INT16_C(     1), -INT16_C( 32062), -INT16_C( 32702),  INT16_C(  4096), -INT16_C(  4145), -INT16_C(    19), -INT16_C( 32512),
+        -INT16_C( 23716), -INT16_C(     1), -INT16_C( 32678), -INT16_C( 17635), -INT16_C(     1),  INT16_C( 17765),  INT16_C(   513),  INT16_C(  4393),
+         INT16_C(     1),  INT16_C( 24575), -INT16_C( 27648),  INT16_C( 10933), -INT16_C(   513), -INT16_C( 16993),  INT16_C(     0),  INT16_C(  2052) },
+      {  INT16_C(  4648), -INT16_C( 24579), -INT16_C( 24399),  INT16_C(    16),  INT16_C( 31483), -INT16_C( 16252), -INT16_C(  7166),  INT16_C(  3965),
+         INT16_C( 24129), -INT16_C(  5126),  INT16_C( 19111),  INT16_C( 14874), -INT16_C( 20563),  INT16_C(     0), -INT16_C(  3073),  INT16_C( 29223),
+         INT16_C(  3638), -INT16_C(  2059), -INT16_C(  1569),  INT16_C(  9615), -INT16_C( 12096), -INT16_C( 16641), -INT16_C(     1),  INT16_C( 14222),
+         INT16_C(  8837),  INT16_C( 15001), -INT16_C(     1), -INT16_C( 23798),  INT16_C( 28443), -INT16_C( 13704),  INT16_C( 15542),  INT16_C( 12289) },
+      {            INT32_MAX, -INT32_C(  2147386443),            INT32_MAX, -INT32_C(  2147449396),  INT32_C(  2147445071), -INT32_C(  2147438735),  INT32_C(  2063229236), -INT32_C(  2147479202),
+         INT32_C(  2061166309),            INT32_MIN,  INT32_C(  2147401469), -INT32_C(  2085002577),            INT32_MAX,            INT32_MIN,            INT32_MAX, -INT32_C(  2147449557) } },
+    { { -INT32_C(  2147383952),  INT32_C(  2147426225), -INT32_C(  2147470466),  INT32_C(  2147442544), -INT32_C(  2147403073),  INT32_C(  2147475866), -INT32_C(  2147415960),  INT32_C(  2147453718),
+        -INT32_C(  2147398900),  INT32_C(  2147416689), -INT32_C(  2147452160),  INT32_C(  2147459583), -INT32_C(  2147461964),  INT32_C(  2147385795), -INT32_C(  2147413877),  INT32_C(  2147460647) },
+      UINT16_C(41144),
+      { -INT16_C( 30076),  INT16_C(  3088), -INT16_C(  2271),  INT16_C(    25), -INT16_C( 10256),  INT16_C(    18), -INT16_C(  1054),  INT16_C( 21311),
+         INT16_C(  6581), -INT16_C( 12175), -INT16_C( 16514),  INT16_C(   512),  INT16_C(     0),  INT16_C( 16624),  INT16_C( 20642), -INT16_C(  1270),
+         INT16_C(     0),  INT16_C( 27408),  INT16_C(  3426),       INT16_MIN,  INT16_C( 29162),  INT16_C( 30719), -INT16_C( 12010),  INT16_C(   512),
+         INT16_C(  4096), -INT16_C(  2069),  INT16_C(     8), -INT16_C( 16116),  INT16_C( 10649),  INT16_C(  9580), -INT16_C( 10304),  INT16_C(  2122) },
+      { -INT16_C(   289), -INT16_C(     3),  INT16_C(  2068), -INT16_C( 14312), -INT16_C( 32305), -INT16_C(  9348),  INT16_C( 29135),  INT16_C(  2048),
+         INT16_C(    32), -INT16_C(  2081),  INT16_C( 28636),  INT16_C( 30920),  INT16_C( 25898),  INT16_C( 16795), -INT16_C(  9992),  INT16_C( 24420),
+        -INT16_C( 11689),  INT16_C( 12176), -INT16_C(   641), -INT16_C( 11004), -INT16_C(   661),  INT16_C( 26131), -INT16_C( 14902), -INT16_C( 25266),
+         INT16_C(  1026),  INT16_C(  4608), -INT16_C( 16385), -INT16_C(  6145), -INT16_C( 14867),  INT16_C(  7631), -INT16_C( 16641), -INT16_C(    25) },
+      { -INT32_C(  2147383952),  INT32_C(  2147426225), -INT32_C(  2147470466),            INT32_MAX, -INT32_C(  2121856306),  INT32_C(  1690412002), -INT32_C(  2147415960),  INT32_C(  1910185454),
+        -INT32_C(  2147398900),  INT32_C(  2147416689), -INT32_C(  2147452160),  INT32_C(  2147459583), -INT32_C(  2147461964),            INT32_MAX, -INT32_C(  2147413877),            INT32_MAX } },
+    { {  INT32_C(   142671872),  INT32_C(  2092731955), -INT32_C(  1073741845),  INT32_C(   974730472),  INT32_C(  1055012732), -INT32_C(     1638467), -INT32_C(    71565313), -INT32_C(  2070471360),
+        -INT32_C(   574619650), -INT32_C(      131073),  INT32_C(   260750396),  INT32_C(     4236288),  INT32_C(  1407435759),  INT32_C(  1833148181),  INT32_C(  1428007007), -INT32_C(   297679305) },
+      UINT16_C(21315),
+      { -INT16_C( 26601),  INT16_C(  7501),  INT16_C( 22960),  INT16_C(     0), -INT16_C(   513), -INT16_C(  8226), -INT16_C(   129),  INT16_C(    65),
+        -INT16_C( 21302), -INT16_C( 20885), -INT16_C(  4463),  INT16_C( 16641), -INT16_C(    66), -INT16_C( 11919), -INT16_C( 22833),  INT16_C(   610),
+        -INT16_C(    66),  INT16_C(   196),  INT16_C(    62), -INT16_C( 31949), -INT16_C( 24581), -INT16_C( 20677),  INT16_C(     0),  INT16_C( 16560),
+        -INT16_C(  4832), -INT16_C( 28672),  INT16_C( 17574), -INT16_C( 19473),  INT16_C( 14676),  INT16_C( 11722),  INT16_C( 12705),  INT16_C(  3920) },
+      {  INT16_C(  2560),  INT16_C(    64), -INT16_C(     1),  INT16_C( 16429), -INT16_C( 25450),  INT16_C(  1280),  INT16_C(   128),  INT16_C(  4232),
+        -INT16_C( 32760), -INT16_C( 14429), -INT16_C( 24262), -INT16_C(   475), -INT16_C(     9), -INT16_C(  4097),  INT16_C(  8208),  INT16_C(  7245),
+         INT16_C( 16384),  INT16_C( 10672),  INT16_C( 24756),  INT16_C( 21199),  INT16_C(   192),  INT16_C( 25516), -INT16_C(   129), -INT16_C( 22508),
+        -INT16_C( 16387), -INT16_C(    20), -INT16_C(    81),  INT16_C(  8194), -INT16_C( 22113),  INT16_C(  8597), -INT16_C( 17425), -INT16_C(     1) },
+      {  INT32_C(    75053376),  INT32_C(  2092708995), -INT32_C(  1073741845),  INT32_C(   974730472),  INT32_C(  1055012732), -INT32_C(     1638467), -INT32_C(    22732576), -INT32_C(  2070471360),
+        -INT32_C(   573609282), -INT32_C(   675883052),  INT32_C(   260750396),  INT32_C(     4236288),  INT32_C(  1487191183),  INT32_C(  1833148181),  INT32_C(  1204250653), -INT32_C(   297679305) } },
+    { {  INT32_C(    67143720),  INT32_C(      526352), -INT32_C(    50331653), -INT32_C(   964811654), -INT32_C(  2147090432),  INT32_C(  1139344589),  INT32_C(   836333831), -INT32_C(  1689857803),
+         INT32_C(    42047000),  INT32_C(  1073872896), -INT32_C(    12584961),  INT32_C(       65538), -INT32_C(   134225921), -INT32_C(  2130173692),  INT32_C(   537265163), -INT32_C(  1569276702) },
+      UINT16_C(35693),
+      {  INT16_C( 28194), -INT16_C(  4161), -INT16_C(  7011), -INT16_C( 16897), -INT16_C(  1026),  INT16_C( 18116), -INT16_C( 18439),  INT16_C(     0),
+        -INT16_C( 29276),  INT16_C(   544), -INT16_C(   385), -INT16_C( 15243), -INT16_C( 14906), -INT16_C(  1537), -INT16_C( 22738), -INT16_C( 16385),
+        -INT16_C(   547),  INT16_C(   272), -INT16_C(  1714),  INT16_C( 13618), -INT16_C(   675), -INT16_C(   513), -INT16_C(  4097),  INT16_C(     0),
+         INT16_C( 21507), -INT16_C(     1),  INT16_C(   576), -INT16_C( 27197),  INT16_C( 28127), -INT16_C( 15398),  INT16_C(  1024), -INT16_C(  8284) },
+      { -INT16_C( 18978), -INT16_C( 32760),  INT16_C(     0),  INT16_C( 28213), -INT16_C(  2177), -INT16_C( 30536),  INT16_C(   512),  INT16_C(  6790),
+         INT16_C(  6145), -INT16_C(  1343),  INT16_C(   342),  INT16_C( 28638), -INT16_C(  2049), -INT16_C(  4190),  INT16_C( 27896), -INT16_C(    33),
+         INT16_C(  2209), -INT16_C( 13046),  INT16_C(   260), -INT16_C(  2520),  INT16_C( 25174), -INT16_C( 24577),  INT16_C( 26356),  INT16_C(  4864),
+         INT16_C( 19544),  INT16_C( 11495), -INT16_C( 20643),  INT16_C(  1088),  INT16_C( 15661), -INT16_C( 11127), -INT16_C( 27648), -INT16_C( 29420) },
+      { -INT32_C(   331607652),  INT32_C(      526352), -INT32_C(   601288227), -INT32_C(   974252422), -INT32_C(  2147090432),  INT32_C(   702683885),  INT32_C(   873316255), -INT32_C(  1689857803),
+         INT32_C(    37290165),  INT32_C(  1039109896), -INT32_C(    12584961), -INT32_C(   107914994), -INT32_C(   134225921), -INT32_C(  2130173692),  INT32_C(   537265163), -INT32_C(  1353872974) } },
+    { { -INT32_C(       32769),  INT32_C(  1275152520), -INT32_C(   142630915), -INT32_C(   325948755), -INT32_C(       69697), -INT32_C(    67108897), -INT32_C(       65569),  INT32_C(   402665476),
+         INT32_C(        8216), -INT32_C(  1559108761),  INT32_C(  1864924048),  INT32_C(  1255988538), -INT32_C(  1680506460), -INT32_C(   115696628), -INT32_C(  2063581184), -INT32_C(     1198209) },
+      UINT16_C(61120),
+      {  INT16_C( 30692),  INT16_C( 24801),  INT16_C( 19862), -INT16_C( 19306), -INT16_C( 29638), -INT16_C( 30979), -INT16_C(  2113), -INT16_C( 12990),
+        -INT16_C( 31996), -INT16_C(     1), -INT16_C(  9606), -INT16_C( 32674), -INT16_C( 13805), -INT16_C(     1),  INT16_C(     2), -INT16_C( 24318),
+        -INT16_C(  4098),  INT16_C( 32255),  INT16_C( 12011), -INT16_C(     1), -INT16_C( 27728),  INT16_C(  2048),  INT16_C( 26172),  INT16_C(  4230),
+        -INT16_C( 16386),  INT16_C( 10643), -INT16_C(   257), -INT16_C(    65),  INT16_C( 31732),  INT16_C(  2049),  INT16_C( 25156), -INT16_C( 20415) },
+      {  INT16_C( 30499), -INT16_C( 16897), -INT16_C( 32640), -INT16_C( 20556),  INT16_C(  2560), -INT16_C( 15831), -INT16_C( 27766),  INT16_C(  6146),
+        -INT16_C(     3),  INT16_C(   128),  INT16_C( 14407),  INT16_C( 20609),  INT16_C( 14508),  INT16_C( 15971),  INT16_C(  1850),  INT16_C( 31747),
+         INT16_C( 28202),  INT16_C( 30115),  INT16_C(  9376), -INT16_C(  6657),  INT16_C( 30914), -INT16_C( 26624),  INT16_C(  1327),  INT16_C( 11167),
+         INT16_C(    64),  INT16_C(  1040), -INT16_C(     1),  INT16_C(  4292), -INT16_C( 28136),  INT16_C( 32766),  INT16_C(  2065), -INT16_C(    49) },
+      { -INT32_C(       32769),  INT32_C(  1275152520), -INT32_C(   142630915), -INT32_C(   325948755), -INT32_C(       69697), -INT32_C(    67108897), -INT32_C(   200364480), -INT32_C(   369354370),
+         INT32_C(        8216), -INT32_C(  1446486968),  INT32_C(   953214704),  INT32_C(  1337955192), -INT32_C(  1680506460), -INT32_C(   115975351),            INT32_MIN,  INT32_C(    51749266) } },
+    { { -INT32_C(  1434544281),  INT32_C(   701901793), -INT32_C(    66815393),  INT32_C(   671089152), -INT32_C(  1862254592),  INT32_C(      589840), -INT32_C(  1469062649),  INT32_C(   336544258),
+        -INT32_C(    35652225),  INT32_C(  1140850697), -INT32_C(  2005089561), -INT32_C(     8486945),  INT32_C(   134221952),  INT32_C(   134393888),  INT32_C(       17416),  INT32_C(   810899706) },
+      UINT16_C(14830),
+      {  INT16_C( 29366), -INT16_C( 19147),  INT16_C(  8026), -INT16_C( 23183),  INT16_C(   612),  INT16_C(  2624),  INT16_C(  2052), -INT16_C( 18433),
+        -INT16_C( 20481),  INT16_C( 26107), -INT16_C(  8321), -INT16_C(     1), -INT16_C(   706), -INT16_C(  7690), -INT16_C( 16320),  INT16_C(  5299),
+        -INT16_C( 15017),  INT16_C( 16129), -INT16_C( 23332),  INT16_C(  3928), -INT16_C( 32677),  INT16_C( 23995), -INT16_C( 22939), -INT16_C( 32232),
+         INT16_C( 29790), -INT16_C( 20481), -INT16_C(     1), -INT16_C(  2049), -INT16_C( 30747),  INT16_C(  2048),  INT16_C( 13064),  INT16_C( 23903) },
+      { -INT16_C(  8193),  INT16_C( 32755),  INT16_C( 11546),  INT16_C( 22252),  INT16_C(  2112),  INT16_C(     9),  INT16_C(  1032),  INT16_C(    20),
+        -INT16_C(   193), -INT16_C(  6705),  INT16_C( 28005), -INT16_C(  7978), -INT16_C(  3362),  INT16_C( 32415), -INT16_C(     1),  INT16_C(     4),
+         INT16_C(  9346), -INT16_C( 23886),  INT16_C( 28573),  INT16_C( 16504), -INT16_C(     2),  INT16_C( 10606),  INT16_C( 16386),  INT16_C( 11011),
+        -INT16_C( 30370),  INT16_C( 32756),  INT16_C(  7661), -INT16_C(  9217),  INT16_C(   136),  INT16_C(  2575), -INT16_C( 32192), -INT16_C(   265) },
+      { -INT32_C(  1434544281),  INT32_C(   278701873), -INT32_C(    65499233),  INT32_C(   672838156), -INT32_C(  1862254592), -INT32_C(   232431787), -INT32_C(  1715960427),  INT32_C(   336581774),
+        -INT32_C(   561258401),  INT32_C(  1140850697), -INT32_C(  2005089561), -INT32_C(   739271951), -INT32_C(  1441375984),  INT32_C(   153271860),  INT32_C(       17416),  INT32_C(   810899706) } },
+    { {  INT32_C(  1090520066), -INT32_C(   707734123), -INT32_C(     1572897), -INT32_C(      532485), -INT32_C(   433084114),  INT32_C(       16468), -INT32_C(  1499057543),  INT32_C(    90004433),
+        -INT32_C(   100925902), -INT32_C(     5242881), -INT32_C(  1533185023), -INT32_C(  1340390753),  INT32_C(    18874528), -INT32_C(      524289), -INT32_C(  1890646020), -INT32_C(   638997794) },
+      UINT16_C(52682),
+      {  INT16_C(  6254),  INT16_C( 23507),  INT16_C( 26971), -INT16_C(  5949), -INT16_C(     1), -INT16_C(  7719),  INT16_C(  6195),  INT16_C(     0),
+        -INT16_C( 31026),  INT16_C(  8448),  INT16_C( 18013), -INT16_C(    33),  INT16_C( 20484), -INT16_C( 20653),  INT16_C( 14030),  INT16_C(  1025),
+         INT16_C( 22914), -INT16_C(     2),  INT16_C(   256), -INT16_C( 21092),       INT16_MAX, -INT16_C(  4697), -INT16_C(  9348), -INT16_C(     1),
+        -INT16_C( 16461), -INT16_C( 31945), -INT16_C(  3859), -INT16_C( 23471), -INT16_C(  1174), -INT16_C( 18988),  INT16_C(     0),  INT16_C( 28099) },
+      {  INT16_C(    32), -INT16_C( 31656),  INT16_C(  4096), -INT16_C(  8193),       INT16_MIN,  INT16_C( 28751),  INT16_C( 21233),  INT16_C( 29027),
+         INT16_C(     0), -INT16_C(     1),  INT16_C( 22355), -INT16_C(  7133), -INT16_C(    72),  INT16_C( 27750),  INT16_C(  4616),  INT16_C(  3661),
+         INT16_C(     4), -INT16_C( 14596),  INT16_C( 26363), -INT16_C( 20483),  INT16_C( 22623),  INT16_C( 20302),  INT16_C( 30121), -INT16_C(    73),
+        -INT16_C(  2229), -INT16_C(  4101),  INT16_C(  5332), -INT16_C( 16445),  INT16_C( 25884), -INT16_C(   194),  INT16_C(  1056),  INT16_C(     1) },
+      {  INT32_C(  1090520066), -INT32_C(   548520750), -INT32_C(     1572897),  INT32_C(   131005950), -INT32_C(   433084114),  INT32_C(       16468), -INT32_C(  2073653141),  INT32_C(   158519438),
+        -INT32_C(   100805054), -INT32_C(     5242881), -INT32_C(   887255676), -INT32_C(  1621961788),  INT32_C(    18874528), -INT32_C(      524289), -INT32_C(  1917350164), -INT32_C(   638969695) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpwssds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456),
+         INT32_C(           0), -INT32_C(           1),            INT32_MAX,            INT32_MIN,  INT32_C(           5), -INT32_C(           7),  INT32_C(      123456), -INT32_C(      123456) },
+      UINT16_C(29024),
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,
+              INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147483641),            INT32_MAX,  INT32_C(           0),
+                   INT32_MAX,  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),            INT32_MAX,  INT32_C(  2147483641),            INT32_MAX,  INT32_C(           0) } },
+    { {  INT32_C(  2147464209), -INT32_C(  2147439009),  INT32_C(  2147466043), -INT32_C(  2147419356),  INT32_C(  2147482276), -INT32_C(  2147470234),  INT32_C(  2147413378), -INT32_C(  2147458263),
+         INT32_C(  2147405173), -INT32_C(  2147401361),  INT32_C(  2147413576), -INT32_C(  2147471986),  INT32_C(  2147464802), -INT32_C(  2147394400),  INT32_C(  2147434237), -INT32_C(  2147476661) },
+      UINT16_C(44721),
+      {  INT16_C(     0),  INT16_C( 29560), -INT16_C(   998), -INT16_C( 13599), -INT16_C(   305), -INT16_C(   513), -INT16_C(  1217), -INT16_C( 23964),
+         INT16_C( 27631), -INT16_C(  8225), -INT16_C(    65),  INT16_C( 20842),  INT16_C( 30538), -INT16_C(     1), -INT16_C( 32032),  INT16_C(  4493),
+        -INT16_C(   129), -INT16_C(     9),  INT16_C(     0), -INT16_C( 18615), -INT16_C( 18449),  INT16_C(  1284), -INT16_C(   129), -INT16_C( 32756),
+        -INT16_C(     5), -INT16_C( 15026),  INT16_C( 16768),  INT16_C(     2), -INT16_C(    33), -INT16_C(  8494), -INT16_C(  5665),  INT16_C( 32639) },
+      {  INT16_C(     0),  INT16_C(    64), -INT16_C(  7043), -INT16_C(  6403),  INT16_C(  1064),  INT16_C( 16347),  INT16_C(   130),  INT16_C(     5),
+        -INT16_C(   513),  INT16_C(  4096),  INT16_C(    16), -INT16_C( 28056), -INT16_C( 11665), -INT16_C(  4161), -INT16_C(  5185), -INT16_C(   751),
+        -INT16_C(  7439), -INT16_C(  6290),  INT16_C(    27),  INT16_C(   256),  INT16_C(     0),  INT16_C( 32693),  INT16_C( 18460),  INT16_C(  7208),
+        -INT16_C( 26623),  INT16_C(  7593), -INT16_C(   515),  INT16_C( 32734),  INT16_C(  4100), -INT16_C(  2305), -INT16_C( 12801),  INT16_C( 18074) },
+      {            INT32_MAX,  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2099617973),            INT32_MIN,  INT32_C(           0), -INT32_C(  1984746586),
+         INT32_C(           0),            INT32_MIN,            INT32_MAX,            INT32_MIN,  INT32_C(           0),            INT32_MIN,  INT32_C(           0), -INT32_C(  1485041710) } },
+    { { -INT32_C(  2147473248),  INT32_C(  2147424555), -INT32_C(  2147453850),  INT32_C(  2147435788), -INT32_C(  2147390477),  INT32_C(  2147444114), -INT32_C(  2147392659),  INT32_C(  2147389090),
+        -INT32_C(  2147416012),  INT32_C(  2147395697), -INT32_C(  2147477302),  INT32_C(  2147422212), -INT32_C(  2147386940),  INT32_C(  2147447573), -INT32_C(  2147447424),  INT32_C(  2147451580) },
+      UINT16_C(16240),
+      {  INT16_C( 10357), -INT16_C(  6509),  INT16_C( 32691),  INT16_C(  1025),  INT16_C(  2336), -INT16_C(     1),  INT16_C( 20479),  INT16_C(     2),
+        -INT16_C( 32636),  INT16_C(    66), -INT16_C( 14852), -INT16_C(  4353),  INT16_C( 11566), -INT16_C(  5352),  INT16_C(    32),  INT16_C( 28535),
+        -INT16_C( 20410),  INT16_C(  2112),  INT16_C(   257), -INT16_C( 16385), -INT16_C(  2036), -INT16_C(     1),  INT16_C(    16), -INT16_C(    67),
+         INT16_C(    32), -INT16_C(  3918),  INT16_C(  4807), -INT16_C(  1347), -INT16_C(  9729), -INT16_C(  3732),  INT16_C(     4),  INT16_C( 30406) },
+      {  INT16_C(  6937), -INT16_C(  5644),  INT16_C(   256),  INT16_C(  8704), -INT16_C(     1), -INT16_C(   129),  INT16_C( 21927),  INT16_C( 16255),
+         INT16_C(  4023),  INT16_C( 28111), -INT16_C(    13),  INT16_C(  8224),  INT16_C(  3038),  INT16_C( 21982), -INT16_C( 16362),  INT16_C( 10722),
+         INT16_C(     4),  INT16_C(  2048),  INT16_C(  4331),  INT16_C( 19491), -INT16_C(  4105),  INT16_C(     4),  INT16_C(     0), -INT16_C( 12754),
+         INT16_C(  1536), -INT16_C( 30618), -INT16_C(  5137),  INT16_C( 29919), -INT16_C( 18330),  INT16_C( 24082),  INT16_C( 10823),  INT16_C( 32703) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),            INT32_MIN,  INT32_C(  2111838118),            INT32_MIN,  INT32_C(           0),
+        -INT32_C(  2143172276),  INT32_C(  1829148729), -INT32_C(  2139119526),            INT32_MAX, -INT32_C(  2027376464),  INT32_C(  2082453121),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   939593730), -INT32_C(  1736167801),  INT32_C(      263300), -INT32_C(  1560008969), -INT32_C(   268435521), -INT32_C(   958609805), -INT32_C(    16909505), -INT32_C(   469938662),
+        -INT32_C(  1496586578),  INT32_C(   674529883), -INT32_C(   671091489),  INT32_C(   976597235), -INT32_C(       66561), -INT32_C(  1076695089), -INT32_C(  2146664448), -INT32_C(  2130706176) },
+      UINT16_C(15898),
+      {  INT16_C( 22031),  INT16_C(  6884),  INT16_C(   128), -INT16_C( 17169),  INT16_C(  3656), -INT16_C( 21973),  INT16_C( 16449),  INT16_C(  1028),
+        -INT16_C(  5354), -INT16_C(     1), -INT16_C( 23477),  INT16_C( 25748),  INT16_C( 10832), -INT16_C( 10404), -INT16_C( 10307), -INT16_C(   262),
+         INT16_C(     8),  INT16_C( 16584),  INT16_C(   192), -INT16_C( 20916), -INT16_C(  4113), -INT16_C(  5377),  INT16_C(  3947), -INT16_C(     9),
+         INT16_C( 28164),  INT16_C(     0), -INT16_C(  8597), -INT16_C(  4101), -INT16_C( 13856), -INT16_C( 21119), -INT16_C( 20574),  INT16_C(  1032) },
+      { -INT16_C(  2145),  INT16_C( 12370),  INT16_C( 28031), -INT16_C(  3712), -INT16_C(  4804), -INT16_C(  3759), -INT16_C(     1),  INT16_C(  4132),
+         INT16_C(     1),  INT16_C(  8121),  INT16_C(     5), -INT16_C(  2708), -INT16_C( 12764), -INT16_C( 31596), -INT16_C( 10832),  INT16_C(   160),
+        -INT16_C( 29266), -INT16_C(   826), -INT16_C(     3), -INT16_C(   684),  INT16_C(  4160),  INT16_C(  6148),  INT16_C(   130), -INT16_C(    57),
+        -INT16_C(  8195), -INT16_C(  2496),  INT16_C(   384),  INT16_C(  9799), -INT16_C( 18452),  INT16_C( 29175), -INT16_C(  4098),  INT16_C(  8142) },
+      {  INT32_C(           0), -INT32_C(  1668848505),  INT32_C(           0), -INT32_C(  1555777722), -INT32_C(   268448996),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(   688835851), -INT32_C(   721259365),  INT32_C(   977110858), -INT32_C(   230870541), -INT32_C(  1120182036),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(    22020097),  INT32_C(  1134544995),  INT32_C(     4194304), -INT32_C(  1959582384), -INT32_C(   819402553), -INT32_C(   671612934),  INT32_C(  2113921023),  INT32_C(          64),
+         INT32_C(  2010644479),  INT32_C(   206726403),  INT32_C(   967197877),  INT32_C(    46128253),  INT32_C(  1490387886),  INT32_C(  1077936192), -INT32_C(  1324256572),  INT32_C(  2147483561) },
+      UINT16_C(64452),
+      { -INT16_C(  4113),  INT16_C(  3800), -INT16_C(  2110),  INT16_C( 13984), -INT16_C( 26625), -INT16_C(  1153), -INT16_C(   514),  INT16_C(  6134),
+        -INT16_C(  4107),  INT16_C(     0), -INT16_C( 25674),  INT16_C(  9027), -INT16_C( 30449),  INT16_C( 11666), -INT16_C(  2145), -INT16_C(     1),
+         INT16_C(  2645),  INT16_C( 26801),  INT16_C( 19712),  INT16_C(     4), -INT16_C( 14139),  INT16_C( 23800),  INT16_C(  4097),  INT16_C(  9159),
+         INT16_C( 32639),  INT16_C(   800), -INT16_C(  8197),  INT16_C( 16384),  INT16_C(     8), -INT16_C(    17),  INT16_C(  6196),  INT16_C(    64) },
+      {  INT16_C(  2448), -INT16_C( 15744), -INT16_C( 21406),  INT16_C( 19120),  INT16_C( 26888), -INT16_C(  4264),  INT16_C( 25268),  INT16_C(  4608),
+        -INT16_C(     9),  INT16_C(   272), -INT16_C(  1939), -INT16_C(     1), -INT16_C( 32122), -INT16_C( 16932), -INT16_C( 15442), -INT16_C(     5),
+        -INT16_C( 20881),  INT16_C(  7052), -INT16_C(   129), -INT16_C(   529),  INT16_C(  8201), -INT16_C(   578),  INT16_C(     0), -INT16_C(   519),
+        -INT16_C(    13), -INT16_C(   133), -INT16_C(  1025), -INT16_C( 12289), -INT16_C( 17788), -INT16_C( 30430),  INT16_C(    33),  INT16_C(   129) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   706782304),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),            INT32_MAX,  INT32_C(    33123159),
+         INT32_C(  2144414886),  INT32_C(   204181439),  INT32_C(           0),  INT32_C(    41374732),  INT32_C(  1489857179),  INT32_C(   884995141), -INT32_C(  1323881566),            INT32_MAX } },
+    { { -INT32_C(    67158277), -INT32_C(   711354398),  INT32_C(  1543675962), -INT32_C(  1919751444), -INT32_C(  1284996986), -INT32_C(       43026),  INT32_C(    16777248), -INT32_C(    17829890),
+        -INT32_C(     2098177),  INT32_C(   297799680),  INT32_C(   134217765), -INT32_C(        9097),  INT32_C(           1), -INT32_C(  1719657474),  INT32_C(   769548820),  INT32_C(      131104) },
+      UINT16_C(50573),
+      { -INT16_C(   513),  INT16_C( 29155), -INT16_C( 16387),  INT16_C( 19250),  INT16_C(   768),  INT16_C(    32), -INT16_C(     3), -INT16_C( 19070),
+        -INT16_C(  4161), -INT16_C( 16385),  INT16_C(   145), -INT16_C( 26113), -INT16_C(  1042),  INT16_C( 18891),  INT16_C(  8192), -INT16_C(  5229),
+         INT16_C( 17022), -INT16_C( 15181),  INT16_C( 18856), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(  5816),  INT16_C(     0),
+         INT16_C( 16657),  INT16_C( 28671), -INT16_C(  7171), -INT16_C( 31744),  INT16_C(     0), -INT16_C(     1),  INT16_C(    80), -INT16_C( 30446) },
+      {  INT16_C( 10732), -INT16_C(     3),  INT16_C(    64), -INT16_C( 19460), -INT16_C( 25121), -INT16_C(   546),  INT16_C( 10108), -INT16_C( 30550),
+        -INT16_C( 24609), -INT16_C(  4098),  INT16_C( 16385), -INT16_C(  6574),  INT16_C( 17904),  INT16_C(     0), -INT16_C( 16385), -INT16_C(   257),
+        -INT16_C( 10816), -INT16_C(   129), -INT16_C(  9379),  INT16_C(     0),  INT16_C( 31022),  INT16_C(  6877),  INT16_C(  4352), -INT16_C(     1),
+        -INT16_C(     5),  INT16_C( 23341), -INT16_C(  2563), -INT16_C(  8855), -INT16_C(     1), -INT16_C(   145),  INT16_C( 15226),  INT16_C(  4112) },
+      { -INT32_C(    72751258),  INT32_C(           0),  INT32_C(  1524365562), -INT32_C(  1337193268),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   150711957),
+        -INT32_C(   184249780),  INT32_C(           0),  INT32_C(   134186743),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   769548965), -INT32_C(   123844768) } },
+    { { -INT32_C(  2067402732),  INT32_C(  1101877990), -INT32_C(  1018531109), -INT32_C(   176160771), -INT32_C(    16785409),  INT32_C(   167872530),  INT32_C(   128195183), -INT32_C(  1739829433),
+         INT32_C(     1048640), -INT32_C(   349734944), -INT32_C(   232062027),  INT32_C(   238259722),  INT32_C(  1602917399),  INT32_C(       65538),  INT32_C(  1484487681),  INT32_C(   536870977) },
+      UINT16_C( 7881),
+      { -INT16_C(  2065), -INT16_C(     9),  INT16_C(   256),  INT16_C(  3153),  INT16_C( 23843),  INT16_C( 30451),  INT16_C(  5290), -INT16_C(  8225),
+        -INT16_C(   785),  INT16_C(   520),  INT16_C(  2642), -INT16_C(  4097),  INT16_C(  6144), -INT16_C(  2785),  INT16_C( 32685), -INT16_C(     1),
+         INT16_C( 19681),  INT16_C(    18),  INT16_C( 19982), -INT16_C(     1), -INT16_C( 13612),  INT16_C( 25532),  INT16_C(    26),  INT16_C( 15019),
+         INT16_C(  5824), -INT16_C(     5),  INT16_C(  8968), -INT16_C(  6432),  INT16_C(   513),  INT16_C( 30130), -INT16_C( 17409), -INT16_C(  1625) },
+      {  INT16_C(     0), -INT16_C(   513),  INT16_C(  1536), -INT16_C( 16386),  INT16_C( 32255), -INT16_C(  9530),  INT16_C( 32255),  INT16_C(  5437),
+         INT16_C( 16894), -INT16_C( 14345),  INT16_C(  4310),  INT16_C( 28237),       INT16_MIN, -INT16_C(    66), -INT16_C( 16133),  INT16_C( 16448),
+              INT16_MIN,       INT16_MIN,  INT16_C( 30612), -INT16_C(  2688),  INT16_C(     8), -INT16_C(   769), -INT16_C( 28672), -INT16_C( 29125),
+        -INT16_C(  3690),  INT16_C(     0), -INT16_C(  8195),  INT16_C( 31312), -INT16_C( 14271),  INT16_C( 21288), -INT16_C(  8697), -INT16_C(     1) },
+      { -INT32_C(  2067398115),  INT32_C(           0),  INT32_C(           0), -INT32_C(    50251146),  INT32_C(           0),  INT32_C(           0), -INT32_C(    72947599),            INT32_MIN,
+         INT32_C(           0),  INT32_C(   261956728), -INT32_C(   251805031), -INT32_C(   199914125),  INT32_C(  1581426839),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(    99908383),  INT32_C(  2009071606),  INT32_C(   705256708),  INT32_C(  2141195882),  INT32_C(   739288579), -INT32_C(   628922966),  INT32_C(   538968065),  INT32_C(    27262976),
+        -INT32_C(     1056769),  INT32_C(   138412032),  INT32_C(    16777224),  INT32_C(   755351657), -INT32_C(    33619993), -INT32_C(    18878465),  INT32_C(  1804484419),  INT32_C(   280959914) },
+      UINT16_C(52508),
+      {  INT16_C( 19684),  INT16_C( 16402),  INT16_C(     0),  INT16_C(  4096), -INT16_C( 12736),  INT16_C(  3529), -INT16_C( 32705),  INT16_C(    80),
+         INT16_C(     0), -INT16_C( 16393), -INT16_C(  7466), -INT16_C(   294), -INT16_C( 11393),  INT16_C(  2560),  INT16_C( 26986), -INT16_C( 27797),
+        -INT16_C(  3806),  INT16_C(  9318), -INT16_C(  3091), -INT16_C( 12360),  INT16_C(    36), -INT16_C( 30471),  INT16_C( 15455), -INT16_C( 15455),
+         INT16_C(  6939), -INT16_C( 28544),  INT16_C( 31932),  INT16_C(  5430), -INT16_C( 24296), -INT16_C(    98),  INT16_C(    81), -INT16_C(    33) },
+      {  INT16_C( 22501), -INT16_C( 32511), -INT16_C( 25799), -INT16_C( 11335), -INT16_C( 30652), -INT16_C( 16390),  INT16_C(  3948), -INT16_C(  9233),
+         INT16_C( 18293),  INT16_C(  2048),  INT16_C(   256), -INT16_C( 23643), -INT16_C( 13982), -INT16_C(  8193), -INT16_C(  2049),  INT16_C( 31624),
+        -INT16_C( 28010),  INT16_C(  1568),  INT16_C( 26909), -INT16_C( 14830), -INT16_C( 26219), -INT16_C(  1611),  INT16_C(    16),  INT16_C( 12721),
+        -INT16_C( 13247),  INT16_C(    16), -INT16_C( 19064), -INT16_C(  6687), -INT16_C(  6949),  INT16_C( 13499),  INT16_C(     0),  INT16_C(  8192) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1037800270),  INT32_C(  2011337902),  INT32_C(   705715715),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   120159915),  INT32_C(           0),  INT32_C(    64922121),  INT32_C(   558995882),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1971994421),  INT32_C(   280689578) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpwssds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpwssds_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
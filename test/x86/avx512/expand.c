@@ -0,0 +1,4268 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN expand
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/expand.h>
+
+static int
+test_simde_mm_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C( 114),  INT8_C(   9),  INT8_C(  51), -INT8_C(  55),  INT8_C(  67), -INT8_C( 123),  INT8_C(  63),  INT8_C( 119),
+         INT8_C(  12),  INT8_C( 107), -INT8_C(  12),      INT8_MIN, -INT8_C(  54),  INT8_C(  97),  INT8_C(  60), -INT8_C(  45) },
+      UINT16_C(64188),
+      {  INT8_C(  45), -INT8_C(  21), -INT8_C(  98), -INT8_C(  26), -INT8_C(  90),  INT8_C(  44),  INT8_C(  79), -INT8_C(  84),
+        -INT8_C( 119), -INT8_C(  97), -INT8_C(  14), -INT8_C(  82),  INT8_C(  88),  INT8_C(  99), -INT8_C(  71),  INT8_C(  88) },
+      {  INT8_C( 114),  INT8_C(   9),  INT8_C(  45), -INT8_C(  21), -INT8_C(  98), -INT8_C(  26),  INT8_C(  63), -INT8_C(  90),
+         INT8_C(  12),  INT8_C(  44), -INT8_C(  12),  INT8_C(  79), -INT8_C(  84), -INT8_C( 119), -INT8_C(  97), -INT8_C(  14) } },
+    { {  INT8_C(  32), -INT8_C(  45), -INT8_C( 102), -INT8_C(  41), -INT8_C(  86),  INT8_C(  77),  INT8_C(  86),  INT8_C( 112),
+         INT8_C( 116),  INT8_C(  68), -INT8_C( 113), -INT8_C(  86), -INT8_C(  30),  INT8_C(   5),  INT8_C(  54),  INT8_C(  57) },
+      UINT16_C( 2849),
+      {  INT8_C(  69),  INT8_C(  30), -INT8_C(  70),  INT8_C(   1), -INT8_C(   8),  INT8_C(  43),  INT8_C(  58),  INT8_C(  62),
+        -INT8_C(  37), -INT8_C( 114),  INT8_C(  67),  INT8_C(  92), -INT8_C( 112), -INT8_C( 115), -INT8_C(  15),  INT8_C(  90) },
+      {  INT8_C(  69), -INT8_C(  45), -INT8_C( 102), -INT8_C(  41), -INT8_C(  86),  INT8_C(  30),  INT8_C(  86),  INT8_C( 112),
+        -INT8_C(  70),  INT8_C(   1), -INT8_C( 113), -INT8_C(   8), -INT8_C(  30),  INT8_C(   5),  INT8_C(  54),  INT8_C(  57) } },
+    { { -INT8_C(  24), -INT8_C(  76), -INT8_C(  16), -INT8_C(  37), -INT8_C(  89),  INT8_C(  12), -INT8_C( 110),  INT8_C(  93),
+         INT8_C(  13),      INT8_MAX,  INT8_C(  48), -INT8_C( 102),  INT8_C( 107),  INT8_C(  60), -INT8_C(  22),  INT8_C(  45) },
+      UINT16_C(32768),
+      {  INT8_C(  16),  INT8_C( 105),  INT8_C( 115),  INT8_C( 118), -INT8_C(   6), -INT8_C(  43),  INT8_C( 109),  INT8_C(  58),
+        -INT8_C(  35), -INT8_C(  32), -INT8_C(  16), -INT8_C( 125),  INT8_C(   9),  INT8_C(  46), -INT8_C(  37), -INT8_C(   5) },
+      { -INT8_C(  24), -INT8_C(  76), -INT8_C(  16), -INT8_C(  37), -INT8_C(  89),  INT8_C(  12), -INT8_C( 110),  INT8_C(  93),
+         INT8_C(  13),      INT8_MAX,  INT8_C(  48), -INT8_C( 102),  INT8_C( 107),  INT8_C(  60), -INT8_C(  22),  INT8_C(  16) } },
+    { { -INT8_C( 108), -INT8_C(   2), -INT8_C(  69),  INT8_C(  56), -INT8_C(  49), -INT8_C( 116),  INT8_C(  37),  INT8_C(  15),
+        -INT8_C(  68), -INT8_C(  11),  INT8_C( 116),  INT8_C( 122),  INT8_C(  53),  INT8_C(   6),  INT8_C(  99), -INT8_C(  45) },
+      UINT16_C(32751),
+      {  INT8_C( 101),  INT8_C(  21), -INT8_C( 105),  INT8_C(  14),  INT8_C(  40),  INT8_C(  99), -INT8_C(  19),  INT8_C(  17),
+         INT8_C(   2), -INT8_C( 114), -INT8_C( 127), -INT8_C( 115), -INT8_C(  61),  INT8_C(   8),  INT8_C(  87), -INT8_C(  58) },
+      {  INT8_C( 101),  INT8_C(  21), -INT8_C( 105),  INT8_C(  14), -INT8_C(  49),  INT8_C(  40),  INT8_C(  99), -INT8_C(  19),
+         INT8_C(  17),  INT8_C(   2), -INT8_C( 114), -INT8_C( 127), -INT8_C( 115), -INT8_C(  61),  INT8_C(   8), -INT8_C(  45) } },
+    { {  INT8_C( 113), -INT8_C(  98),  INT8_C(   4), -INT8_C( 108),  INT8_C(  85),  INT8_C(  92), -INT8_C(  81),  INT8_C(  79),
+        -INT8_C(  27),  INT8_C(  49),  INT8_C(  60),  INT8_C(  69), -INT8_C(  46), -INT8_C( 120), -INT8_C(  49), -INT8_C( 113) },
+      UINT16_C(26665),
+      { -INT8_C( 109), -INT8_C(  91),  INT8_C(  84), -INT8_C(  26),  INT8_C(  66), -INT8_C(  78),  INT8_C(  52), -INT8_C(  32),
+         INT8_C(  31),  INT8_C(  10),  INT8_C( 123), -INT8_C(  65), -INT8_C(  20),  INT8_C(  73), -INT8_C(   3), -INT8_C(  92) },
+      { -INT8_C( 109), -INT8_C(  98),  INT8_C(   4), -INT8_C(  91),  INT8_C(  85),  INT8_C(  84), -INT8_C(  81),  INT8_C(  79),
+        -INT8_C(  27),  INT8_C(  49),  INT8_C(  60), -INT8_C(  26), -INT8_C(  46),  INT8_C(  66), -INT8_C(  78), -INT8_C( 113) } },
+    { {  INT8_C(  37), -INT8_C(  86),  INT8_C(  42), -INT8_C(  56), -INT8_C(  82),  INT8_C(  31),  INT8_C(  31), -INT8_C(  36),
+         INT8_C(  95),  INT8_C(  59), -INT8_C(  38), -INT8_C( 113), -INT8_C(  21),  INT8_C( 121),  INT8_C(  99),  INT8_C( 120) },
+      UINT16_C(33907),
+      { -INT8_C(  37), -INT8_C(  99),  INT8_C(  46),  INT8_C( 105), -INT8_C(   6),  INT8_C(  39), -INT8_C(  79), -INT8_C(  14),
+        -INT8_C( 125),  INT8_C(  56),  INT8_C(  59),  INT8_C(  15), -INT8_C(  25),  INT8_C(  93),  INT8_C(  23), -INT8_C(  16) },
+      { -INT8_C(  37), -INT8_C(  99),  INT8_C(  42), -INT8_C(  56),  INT8_C(  46),  INT8_C( 105), -INT8_C(   6), -INT8_C(  36),
+         INT8_C(  95),  INT8_C(  59),  INT8_C(  39), -INT8_C( 113), -INT8_C(  21),  INT8_C( 121),  INT8_C(  99), -INT8_C(  79) } },
+    { {  INT8_C(  42), -INT8_C(  45),  INT8_C( 109),  INT8_C(  71), -INT8_C(   1),  INT8_C( 107),  INT8_C( 107), -INT8_C( 103),
+        -INT8_C(  12),  INT8_C(  80),  INT8_C(  74),  INT8_C(  97), -INT8_C( 102), -INT8_C(  74),  INT8_C(  31),  INT8_C(  51) },
+      UINT16_C(26772),
+      { -INT8_C( 120),  INT8_C(  36),      INT8_MAX,  INT8_C(  56),  INT8_C(  29), -INT8_C(  41), -INT8_C(  59),  INT8_C( 116),
+        -INT8_C(  13), -INT8_C(  60),  INT8_C(   0),  INT8_C( 125), -INT8_C( 105),  INT8_C(  91),  INT8_C(  58),  INT8_C(  18) },
+      {  INT8_C(  42), -INT8_C(  45), -INT8_C( 120),  INT8_C(  71),  INT8_C(  36),  INT8_C( 107),  INT8_C( 107),      INT8_MAX,
+        -INT8_C(  12),  INT8_C(  80),  INT8_C(  74),  INT8_C(  56), -INT8_C( 102),  INT8_C(  29), -INT8_C(  41),  INT8_C(  51) } },
+    { {  INT8_C(  71),  INT8_C(  36), -INT8_C(  53), -INT8_C(  64),  INT8_C(   4), -INT8_C( 112),  INT8_C(  65),  INT8_C(  83),
+         INT8_C(  89),  INT8_C(   6),  INT8_C(  45),  INT8_C(  80),  INT8_C(  66),  INT8_C( 124),  INT8_C(  68),  INT8_C(  76) },
+      UINT16_C(65391),
+      { -INT8_C(  35), -INT8_C(  42), -INT8_C(  23),  INT8_C(   2), -INT8_C(  72),  INT8_C(   9), -INT8_C( 101),  INT8_C(  55),
+         INT8_C(  28), -INT8_C(  58),  INT8_C(  31), -INT8_C(  20), -INT8_C( 116),  INT8_C(  29), -INT8_C( 107), -INT8_C( 122) },
+      { -INT8_C(  35), -INT8_C(  42), -INT8_C(  23),  INT8_C(   2),  INT8_C(   4), -INT8_C(  72),  INT8_C(   9),  INT8_C(  83),
+        -INT8_C( 101),  INT8_C(  55),  INT8_C(  28), -INT8_C(  58),  INT8_C(  31), -INT8_C(  20), -INT8_C( 116),  INT8_C(  29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(49353),
+      {  INT8_C( 121),  INT8_C(  22),  INT8_C( 111),  INT8_C(  54),  INT8_C(  70),  INT8_C(  84), -INT8_C( 114),  INT8_C(  14),
+        -INT8_C( 118), -INT8_C(  49),  INT8_C( 123),  INT8_C(  59), -INT8_C(  76),  INT8_C(  90),  INT8_C(  79),  INT8_C(  63) },
+      {  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C( 111),  INT8_C(  54),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(  84) } },
+    { UINT16_C(15285),
+      {  INT8_C( 107),  INT8_C(  44),  INT8_C(  88),  INT8_C(  33), -INT8_C(   5),  INT8_C(  72), -INT8_C(  84),  INT8_C(  44),
+        -INT8_C(  98),  INT8_C(  57), -INT8_C(  56),  INT8_C(  24), -INT8_C(  66),  INT8_C( 120), -INT8_C(  59),  INT8_C(  14) },
+      {  INT8_C( 107),  INT8_C(   0),  INT8_C(  44),  INT8_C(   0),  INT8_C(  88),  INT8_C(  33),  INT8_C(   0), -INT8_C(   5),
+         INT8_C(  72), -INT8_C(  84),  INT8_C(   0),  INT8_C(  44), -INT8_C(  98),  INT8_C(  57),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(20305),
+      {  INT8_C(   8), -INT8_C(  64),  INT8_C(  97),  INT8_C(  14),  INT8_C(   1),  INT8_C(  47),  INT8_C(  86), -INT8_C(  76),
+        -INT8_C(  67),  INT8_C( 124), -INT8_C(  40),  INT8_C(  57), -INT8_C(  49),  INT8_C(  13),  INT8_C(  65),  INT8_C(  43) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0),  INT8_C(  97),  INT8_C(   0),
+         INT8_C(  14),  INT8_C(   1),  INT8_C(  47),  INT8_C(  86),  INT8_C(   0),  INT8_C(   0), -INT8_C(  76),  INT8_C(   0) } },
+    { UINT16_C(  512),
+      {  INT8_C(  40), -INT8_C(  91), -INT8_C(  77),  INT8_C(   0), -INT8_C(  45),  INT8_C( 120), -INT8_C(  82),  INT8_C(  31),
+        -INT8_C(  41),  INT8_C(  96), -INT8_C(  11),  INT8_C(  16), -INT8_C(  94), -INT8_C(   9), -INT8_C(  32), -INT8_C(  28) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(27698),
+      {  INT8_C(  45),  INT8_C(  53),  INT8_C(  76),  INT8_C(  28), -INT8_C(  59), -INT8_C( 116), -INT8_C(  90),  INT8_C(  21),
+         INT8_C(  71),  INT8_C(  20),  INT8_C( 118), -INT8_C(  51),  INT8_C(  87),  INT8_C(  32), -INT8_C(  37),  INT8_C(   4) },
+      {  INT8_C(   0),  INT8_C(  45),  INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C(  76),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  28), -INT8_C(  59),  INT8_C(   0), -INT8_C( 116), -INT8_C(  90),  INT8_C(   0) } },
+    { UINT16_C(28570),
+      { -INT8_C(  12),  INT8_C(  66),  INT8_C(   3),  INT8_C(  59), -INT8_C(  32), -INT8_C(  64), -INT8_C(  22), -INT8_C(  73),
+        -INT8_C(   6),  INT8_C(   5), -INT8_C( 111),  INT8_C(  99), -INT8_C(  73),  INT8_C( 122), -INT8_C(  34), -INT8_C(  99) },
+      {  INT8_C(   0), -INT8_C(  12),  INT8_C(   0),  INT8_C(  66),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(  59),
+        -INT8_C(  32), -INT8_C(  64), -INT8_C(  22), -INT8_C(  73),  INT8_C(   0), -INT8_C(   6),  INT8_C(   5),  INT8_C(   0) } },
+    { UINT16_C( 7524),
+      {  INT8_C(  13),  INT8_C(  31), -INT8_C(  16),  INT8_C(  25),  INT8_C(  80),  INT8_C(  15),  INT8_C(  73), -INT8_C(  87),
+        -INT8_C( 105),  INT8_C(  18),  INT8_C(  58),  INT8_C(  18),  INT8_C(  49), -INT8_C(  86), -INT8_C(  65), -INT8_C( 107) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  13),  INT8_C(   0),  INT8_C(   0),  INT8_C(  31), -INT8_C(  16),  INT8_C(   0),
+         INT8_C(  25),  INT8_C(   0),  INT8_C(  80),  INT8_C(  15),  INT8_C(  73),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(37109),
+      {  INT8_C(  18),  INT8_C(  93),  INT8_C(  94), -INT8_C(  23), -INT8_C(  42), -INT8_C( 118),  INT8_C(  53),  INT8_C(  55),
+         INT8_C(  21), -INT8_C(  80),  INT8_C( 122),  INT8_C(  62),  INT8_C(  84),  INT8_C(  54),  INT8_C(  38), -INT8_C( 108) },
+      {  INT8_C(  18),  INT8_C(   0),  INT8_C(  93),  INT8_C(   0),  INT8_C(  94), -INT8_C(  23), -INT8_C(  42), -INT8_C( 118),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C(   0),  INT8_C(   0),  INT8_C(  55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C( 124),  INT8_C(  24),  INT8_C(  33), -INT8_C(  57), -INT8_C(  99),  INT8_C(  34), -INT8_C(   6), -INT8_C(  24),
+        -INT8_C(  66), -INT8_C(  84), -INT8_C(  95), -INT8_C(  39),  INT8_C(  92),  INT8_C(  46),  INT8_C(   9), -INT8_C( 105) },
+      UINT16_C(44139),
+      {  INT8_C(  95), -INT8_C(  16),  INT8_C(  63),  INT8_C(  34),  INT8_C(  44), -INT8_C( 102),  INT8_C(  33),  INT8_C( 117),
+        -INT8_C(  24), -INT8_C(  16), -INT8_C(  94), -INT8_C(  80),  INT8_C( 117),  INT8_C( 124), -INT8_C(  45), -INT8_C(  25) },
+      {  INT8_C(  95), -INT8_C(  16),  INT8_C(  33),  INT8_C(  63), -INT8_C(  99),  INT8_C(  34),  INT8_C(  44), -INT8_C(  24),
+        -INT8_C(  66), -INT8_C(  84), -INT8_C( 102),  INT8_C(  33),  INT8_C(  92),  INT8_C( 117),  INT8_C(   9), -INT8_C(  24) } },
+    { {  INT8_C(  71),  INT8_C(  44), -INT8_C(  31), -INT8_C(  59), -INT8_C(  42),  INT8_C( 113),  INT8_C( 101), -INT8_C(  49),
+        -INT8_C(  70), -INT8_C(  25),  INT8_C(  82), -INT8_C(  19), -INT8_C(  38),  INT8_C(   3), -INT8_C(  92),  INT8_C(  39) },
+      UINT16_C(47870),
+      {  INT8_C( 112),  INT8_C( 102), -INT8_C(  82),  INT8_C(  94),  INT8_C(  72), -INT8_C(  26), -INT8_C(  42), -INT8_C(  37),
+        -INT8_C(  55), -INT8_C(  85), -INT8_C(  43),  INT8_C(  38), -INT8_C(  41), -INT8_C( 106), -INT8_C(   9),  INT8_C( 113) },
+      {  INT8_C(  71),  INT8_C( 112),  INT8_C( 102), -INT8_C(  82),  INT8_C(  94),  INT8_C(  72), -INT8_C(  26), -INT8_C(  42),
+        -INT8_C(  70), -INT8_C(  37),  INT8_C(  82), -INT8_C(  55), -INT8_C(  85), -INT8_C(  43), -INT8_C(  92),  INT8_C(  38) } },
+    { { -INT8_C(  57), -INT8_C(  47), -INT8_C(  83),  INT8_C( 107), -INT8_C(  11), -INT8_C(  52),  INT8_C( 125), -INT8_C(  54),
+         INT8_C(  12), -INT8_C(   2),  INT8_C(   5),  INT8_C(   0), -INT8_C(  88),  INT8_C(  73), -INT8_C(  45),  INT8_C(  11) },
+      UINT16_C( 5829),
+      { -INT8_C( 113),  INT8_C(  90), -INT8_C( 107),  INT8_C( 102), -INT8_C(  64), -INT8_C(  26),  INT8_C(  94), -INT8_C(  35),
+        -INT8_C(  97), -INT8_C( 119), -INT8_C( 124), -INT8_C(  66), -INT8_C(  56),  INT8_C(  78),  INT8_C(  25), -INT8_C(  22) },
+      { -INT8_C( 113), -INT8_C(  47),  INT8_C(  90),  INT8_C( 107), -INT8_C(  11), -INT8_C(  52), -INT8_C( 107),  INT8_C( 102),
+         INT8_C(  12), -INT8_C(  64), -INT8_C(  26),  INT8_C(   0),  INT8_C(  94),  INT8_C(  73), -INT8_C(  45),  INT8_C(  11) } },
+    { { -INT8_C(  84), -INT8_C(  39),  INT8_C(  23), -INT8_C(  93), -INT8_C(  45),  INT8_C(  79), -INT8_C( 115),  INT8_C(  43),
+        -INT8_C( 123), -INT8_C(  51), -INT8_C(  73), -INT8_C(  88), -INT8_C( 123),  INT8_C(   8),  INT8_C(  61),  INT8_C(   6) },
+      UINT16_C(45620),
+      {  INT8_C(  27),  INT8_C(  55), -INT8_C(  68), -INT8_C(  42),  INT8_C(  96), -INT8_C(  79),  INT8_C(  95),  INT8_C(  80),
+         INT8_C(  62),  INT8_C(  15),  INT8_C(  57), -INT8_C(  73), -INT8_C(  74),  INT8_C(  39),  INT8_C(  12), -INT8_C(  11) },
+      { -INT8_C(  84), -INT8_C(  39),  INT8_C(  27), -INT8_C(  93),  INT8_C(  55), -INT8_C(  68), -INT8_C( 115),  INT8_C(  43),
+        -INT8_C( 123), -INT8_C(  42), -INT8_C(  73), -INT8_C(  88),  INT8_C(  96), -INT8_C(  79),  INT8_C(  61),  INT8_C(  95) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i r = simde_mm_mask_expandloadu_epi8(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(61436),
+      { -INT8_C(  81), -INT8_C(  48),  INT8_C( 100), -INT8_C(  42),  INT8_C( 101),  INT8_C(  31),  INT8_C(  24), -INT8_C(   8),
+        -INT8_C( 104), -INT8_C( 127), -INT8_C(  28),  INT8_C(  33),  INT8_C( 124),  INT8_C(  72),  INT8_C(  32), -INT8_C(  39) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  81), -INT8_C(  48),  INT8_C( 100), -INT8_C(  42),  INT8_C( 101),  INT8_C(  31),
+         INT8_C(  24), -INT8_C(   8), -INT8_C( 104), -INT8_C( 127),  INT8_C(   0), -INT8_C(  28),  INT8_C(  33),  INT8_C( 124) } },
+    { UINT16_C( 1417),
+      { -INT8_C(  73),  INT8_C(  44),  INT8_C(  88), -INT8_C(   8),  INT8_C(   8), -INT8_C(  29), -INT8_C(  98),  INT8_C(  84),
+        -INT8_C(  59), -INT8_C(  23), -INT8_C( 123), -INT8_C(  12),  INT8_C(  20), -INT8_C(  73), -INT8_C( 102), -INT8_C(  55) },
+      { -INT8_C(  73),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  88),
+        -INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(35807),
+      { -INT8_C(  77), -INT8_C(  33), -INT8_C(  51),  INT8_C(  28),  INT8_C(  99), -INT8_C(  70), -INT8_C(  97), -INT8_C( 114),
+         INT8_C( 114), -INT8_C(  99), -INT8_C( 102), -INT8_C(   5),  INT8_C(  34), -INT8_C( 122),  INT8_C(  31), -INT8_C(  44) },
+      { -INT8_C(  77), -INT8_C(  33), -INT8_C(  51),  INT8_C(  28),  INT8_C(  99),  INT8_C(   0), -INT8_C(  70), -INT8_C(  97),
+        -INT8_C( 114),  INT8_C( 114),  INT8_C(   0), -INT8_C(  99),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102) } },
+    { UINT16_C(32312),
+      {  INT8_C(  79), -INT8_C(  61), -INT8_C(  28), -INT8_C( 125),  INT8_C( 110),  INT8_C(  40), -INT8_C(  41), -INT8_C(   9),
+         INT8_C( 118),  INT8_C(  15), -INT8_C(  91), -INT8_C(  22), -INT8_C(  53), -INT8_C(  35), -INT8_C( 117), -INT8_C(  41) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  79), -INT8_C(  61), -INT8_C(  28),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 125),  INT8_C( 110),  INT8_C(  40), -INT8_C(  41), -INT8_C(   9),  INT8_C( 118),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi8(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  3471),  INT16_C( 21151),  INT16_C( 24491), -INT16_C( 11306), -INT16_C(  9406),  INT16_C( 12448),  INT16_C( 32310),  INT16_C(  8960) },
+      UINT8_C(144),
+      { -INT16_C( 10240),  INT16_C( 24607), -INT16_C(  9738), -INT16_C( 29978), -INT16_C( 19210), -INT16_C(   413),  INT16_C(   849),  INT16_C( 21097) },
+      { -INT16_C(  3471),  INT16_C( 21151),  INT16_C( 24491), -INT16_C( 11306), -INT16_C( 10240),  INT16_C( 12448),  INT16_C( 32310),  INT16_C( 24607) } },
+    { {  INT16_C( 26515),  INT16_C( 11276),  INT16_C( 27075),  INT16_C( 24067), -INT16_C( 24094), -INT16_C( 32033), -INT16_C( 16777), -INT16_C( 17332) },
+      UINT8_C( 16),
+      { -INT16_C( 28665), -INT16_C( 13767), -INT16_C(  7105), -INT16_C( 24616), -INT16_C( 29302), -INT16_C( 16567),  INT16_C( 23900),  INT16_C( 17575) },
+      {  INT16_C( 26515),  INT16_C( 11276),  INT16_C( 27075),  INT16_C( 24067), -INT16_C( 28665), -INT16_C( 32033), -INT16_C( 16777), -INT16_C( 17332) } },
+    { {  INT16_C( 25820),  INT16_C( 17592), -INT16_C( 27108), -INT16_C(  9718),  INT16_C( 13059), -INT16_C( 24953), -INT16_C(  6618),  INT16_C( 19538) },
+      UINT8_C( 44),
+      { -INT16_C( 19080),  INT16_C(  2546),  INT16_C(  3916),  INT16_C( 16741), -INT16_C(  8141),  INT16_C( 18607), -INT16_C(  5510),  INT16_C(  9182) },
+      {  INT16_C( 25820),  INT16_C( 17592), -INT16_C( 19080),  INT16_C(  2546),  INT16_C( 13059),  INT16_C(  3916), -INT16_C(  6618),  INT16_C( 19538) } },
+    { { -INT16_C( 12185), -INT16_C(  5542),  INT16_C( 31276),  INT16_C( 26837), -INT16_C(  7526), -INT16_C( 11921), -INT16_C( 17795), -INT16_C( 24994) },
+      UINT8_C(156),
+      { -INT16_C( 20755), -INT16_C( 13520),  INT16_C( 23993),  INT16_C( 16526),  INT16_C( 15839), -INT16_C( 16763),  INT16_C( 17481),  INT16_C( 32313) },
+      { -INT16_C( 12185), -INT16_C(  5542), -INT16_C( 20755), -INT16_C( 13520),  INT16_C( 23993), -INT16_C( 11921), -INT16_C( 17795),  INT16_C( 16526) } },
+    { { -INT16_C( 25360), -INT16_C(  3736), -INT16_C( 13804),  INT16_C(  2090),  INT16_C( 30717),  INT16_C( 25881), -INT16_C( 17169),  INT16_C( 10649) },
+      UINT8_C(248),
+      {  INT16_C(  4695), -INT16_C( 32646), -INT16_C(  5889), -INT16_C(  1337),  INT16_C( 22294), -INT16_C( 16346), -INT16_C( 21417), -INT16_C( 27884) },
+      { -INT16_C( 25360), -INT16_C(  3736), -INT16_C( 13804),  INT16_C(  4695), -INT16_C( 32646), -INT16_C(  5889), -INT16_C(  1337),  INT16_C( 22294) } },
+    { { -INT16_C( 29165),  INT16_C(  3075),  INT16_C(  7439), -INT16_C(  2539), -INT16_C( 13268), -INT16_C( 27058), -INT16_C( 31434),  INT16_C( 25719) },
+      UINT8_C(253),
+      {  INT16_C( 29711), -INT16_C( 27070),  INT16_C( 12594), -INT16_C( 19733), -INT16_C( 31419), -INT16_C(  9810),  INT16_C(  3606),  INT16_C( 31490) },
+      {  INT16_C( 29711),  INT16_C(  3075), -INT16_C( 27070),  INT16_C( 12594), -INT16_C( 19733), -INT16_C( 31419), -INT16_C(  9810),  INT16_C(  3606) } },
+    { {  INT16_C( 31480),  INT16_C( 16263), -INT16_C( 28111), -INT16_C( 19117),  INT16_C( 26833),  INT16_C( 14698),  INT16_C(  8436),  INT16_C( 19363) },
+      UINT8_C(237),
+      { -INT16_C(  3554),  INT16_C( 22175),  INT16_C(  8422), -INT16_C( 17413), -INT16_C(  3728),  INT16_C(  6133),  INT16_C( 29177), -INT16_C( 14979) },
+      { -INT16_C(  3554),  INT16_C( 16263),  INT16_C( 22175),  INT16_C(  8422),  INT16_C( 26833), -INT16_C( 17413), -INT16_C(  3728),  INT16_C(  6133) } },
+    { {  INT16_C(  6643), -INT16_C( 14265), -INT16_C( 24261), -INT16_C(  2820), -INT16_C( 24038), -INT16_C(  8047), -INT16_C( 14056),  INT16_C( 22136) },
+      UINT8_C(247),
+      { -INT16_C( 16692),  INT16_C(  8109), -INT16_C( 18273), -INT16_C( 20117),  INT16_C(  2410),  INT16_C( 24539),  INT16_C( 30219), -INT16_C( 14235) },
+      { -INT16_C( 16692),  INT16_C(  8109), -INT16_C( 18273), -INT16_C(  2820), -INT16_C( 20117),  INT16_C(  2410),  INT16_C( 24539),  INT16_C( 30219) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(182),
+      {  INT16_C(  5180),  INT16_C( 27441),  INT16_C(   878),  INT16_C( 32075), -INT16_C( 16164),  INT16_C(  2578), -INT16_C( 13339), -INT16_C(  6807) },
+      {  INT16_C(     0),  INT16_C(  5180),  INT16_C( 27441),  INT16_C(     0),  INT16_C(   878),  INT16_C( 32075),  INT16_C(     0), -INT16_C( 16164) } },
+    { UINT8_C(147),
+      {  INT16_C( 29282), -INT16_C( 17133),  INT16_C(  7203), -INT16_C( 14654),  INT16_C( 23216),  INT16_C( 20281),  INT16_C( 21527),  INT16_C( 31132) },
+      {  INT16_C( 29282), -INT16_C( 17133),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7203),  INT16_C(     0),  INT16_C(     0), -INT16_C( 14654) } },
+    { UINT8_C( 36),
+      {  INT16_C(  4047),  INT16_C( 25698), -INT16_C( 29222),  INT16_C( 12313), -INT16_C( 15647),  INT16_C( 21932),  INT16_C( 15267), -INT16_C( 11606) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(  4047),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25698),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(122),
+      { -INT16_C( 21402), -INT16_C(  3341),  INT16_C( 23161),  INT16_C( 32504),  INT16_C(   796), -INT16_C( 19224), -INT16_C(  4907),  INT16_C( 16725) },
+      {  INT16_C(     0), -INT16_C( 21402),  INT16_C(     0), -INT16_C(  3341),  INT16_C( 23161),  INT16_C( 32504),  INT16_C(   796),  INT16_C(     0) } },
+    { UINT8_C(146),
+      { -INT16_C( 17028),  INT16_C( 23579),  INT16_C( 29821), -INT16_C( 28542), -INT16_C( 15243),  INT16_C( 28750),  INT16_C( 32240),  INT16_C( 22775) },
+      {  INT16_C(     0), -INT16_C( 17028),  INT16_C(     0),  INT16_C(     0),  INT16_C( 23579),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29821) } },
+    { UINT8_C(151),
+      {  INT16_C( 20324),  INT16_C( 18284),  INT16_C( 12025), -INT16_C( 28634), -INT16_C(  5661), -INT16_C( 22296), -INT16_C( 31649),  INT16_C(  1199) },
+      {  INT16_C( 20324),  INT16_C( 18284),  INT16_C( 12025),  INT16_C(     0), -INT16_C( 28634),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5661) } },
+    { UINT8_C(160),
+      { -INT16_C( 32193),  INT16_C( 23003),  INT16_C( 14528), -INT16_C(  8142), -INT16_C( 31360),  INT16_C( 11675),  INT16_C(  8629), -INT16_C( 26869) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32193),  INT16_C(     0),  INT16_C( 23003) } },
+    { UINT8_C(232),
+      {  INT16_C( 17417), -INT16_C( 12934), -INT16_C( 28737),  INT16_C( 24826),  INT16_C( 16348),  INT16_C( 18666),  INT16_C( 20818), -INT16_C( 15648) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17417),  INT16_C(     0), -INT16_C( 12934), -INT16_C( 28737),  INT16_C( 24826) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 11615), -INT16_C( 15682), -INT16_C( 31222),  INT16_C( 15779), -INT16_C(  4482), -INT16_C( 25118),  INT16_C(  1435),  INT16_C(  6503) },
+      UINT8_C( 34),
+      { -INT16_C(  3477), -INT16_C( 18631),  INT16_C(  3992), -INT16_C( 12086), -INT16_C( 30928),  INT16_C( 10159), -INT16_C( 26211), -INT16_C( 23708) },
+      {  INT16_C( 11615), -INT16_C(  3477), -INT16_C( 31222),  INT16_C( 15779), -INT16_C(  4482), -INT16_C( 18631),  INT16_C(  1435),  INT16_C(  6503) } },
+    { {  INT16_C( 17120), -INT16_C( 29928), -INT16_C( 22551),  INT16_C( 21331),  INT16_C( 15199),  INT16_C(    47), -INT16_C( 20186), -INT16_C(  3934) },
+      UINT8_C( 13),
+      {  INT16_C(   223),  INT16_C( 28119), -INT16_C( 23178),  INT16_C( 22687),  INT16_C( 14871), -INT16_C( 10741),  INT16_C(  9479),  INT16_C( 18367) },
+      {  INT16_C(   223), -INT16_C( 29928),  INT16_C( 28119), -INT16_C( 23178),  INT16_C( 15199),  INT16_C(    47), -INT16_C( 20186), -INT16_C(  3934) } },
+    { { -INT16_C( 27832),  INT16_C( 23555),  INT16_C(  6015), -INT16_C( 18115), -INT16_C( 31402),  INT16_C( 14001), -INT16_C( 19819),  INT16_C( 14258) },
+      UINT8_C( 22),
+      {  INT16_C(  7892),  INT16_C(  1329), -INT16_C( 26004),  INT16_C(  5523), -INT16_C(  3034),  INT16_C( 11911),  INT16_C(  6241),  INT16_C( 22202) },
+      { -INT16_C( 27832),  INT16_C(  7892),  INT16_C(  1329), -INT16_C( 18115), -INT16_C( 26004),  INT16_C( 14001), -INT16_C( 19819),  INT16_C( 14258) } },
+    { {  INT16_C(  3386),  INT16_C( 12643), -INT16_C( 19551),  INT16_C(   589), -INT16_C( 22381),  INT16_C( 32038), -INT16_C( 18588), -INT16_C( 22343) },
+      UINT8_C(244),
+      { -INT16_C( 31755),  INT16_C( 12198),  INT16_C( 28651), -INT16_C( 27850), -INT16_C( 24388),  INT16_C( 25747), -INT16_C( 32395),  INT16_C(  8926) },
+      {  INT16_C(  3386),  INT16_C( 12643), -INT16_C( 31755),  INT16_C(   589),  INT16_C( 12198),  INT16_C( 28651), -INT16_C( 27850), -INT16_C( 24388) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i r = simde_mm_mask_expandloadu_epi16(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 92),
+      {  INT16_C( 10585), -INT16_C( 10156),  INT16_C( 24143), -INT16_C( 29607), -INT16_C( 10446), -INT16_C( 18337), -INT16_C(  2206), -INT16_C( 23136) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 10585), -INT16_C( 10156),  INT16_C( 24143),  INT16_C(     0), -INT16_C( 29607),  INT16_C(     0) } },
+    { UINT8_C(191),
+      {  INT16_C( 26690),  INT16_C( 15038),  INT16_C(  1366),  INT16_C( 20210), -INT16_C( 26495), -INT16_C(  9077),  INT16_C(  5591), -INT16_C( 20374) },
+      {  INT16_C( 26690),  INT16_C( 15038),  INT16_C(  1366),  INT16_C( 20210), -INT16_C( 26495), -INT16_C(  9077),  INT16_C(     0),  INT16_C(  5591) } },
+    { UINT8_C( 64),
+      { -INT16_C( 25966),  INT16_C( 21850), -INT16_C( 19455), -INT16_C( 27879), -INT16_C( 17733), -INT16_C( 12652),  INT16_C( 32244),  INT16_C( 29826) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25966),  INT16_C(     0) } },
+    { UINT8_C( 22),
+      { -INT16_C(  8273),  INT16_C(  9324),  INT16_C( 12578),  INT16_C( 11926),  INT16_C( 22605), -INT16_C( 32211),  INT16_C( 18141), -INT16_C( 15800) },
+      {  INT16_C(     0), -INT16_C(  8273),  INT16_C(  9324),  INT16_C(     0),  INT16_C( 12578),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi16(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1281742836),  INT32_C(  1780510803),  INT32_C(  1365362634), -INT32_C(  1559259756) },
+      UINT8_C(131),
+      {  INT32_C(   303612918), -INT32_C(   169842163),  INT32_C(  1923465262), -INT32_C(  1689931026) },
+      {  INT32_C(   303612918), -INT32_C(   169842163),  INT32_C(  1365362634), -INT32_C(  1559259756) } },
+    { {  INT32_C(   890295081),  INT32_C(   534613429),  INT32_C(   263475254),  INT32_C(  1447911620) },
+      UINT8_C(247),
+      {  INT32_C(    64603247),  INT32_C(  1396432266), -INT32_C(   644804303),  INT32_C(   498597123) },
+      {  INT32_C(    64603247),  INT32_C(  1396432266), -INT32_C(   644804303),  INT32_C(  1447911620) } },
+    { {  INT32_C(  2109778597), -INT32_C(   277300971), -INT32_C(  1674368655),  INT32_C(  1663328768) },
+      UINT8_C(250),
+      {  INT32_C(  1892882966),  INT32_C(  1621233599),  INT32_C(    34920926), -INT32_C(   195591269) },
+      {  INT32_C(  2109778597),  INT32_C(  1892882966), -INT32_C(  1674368655),  INT32_C(  1621233599) } },
+    { { -INT32_C(  1528560130), -INT32_C(   798380920), -INT32_C(  1558723741), -INT32_C(   540250202) },
+      UINT8_C(165),
+      {  INT32_C(  1505995363), -INT32_C(   235073064), -INT32_C(  1031637713),  INT32_C(    41676115) },
+      {  INT32_C(  1505995363), -INT32_C(   798380920), -INT32_C(   235073064), -INT32_C(   540250202) } },
+    { {  INT32_C(   696252324), -INT32_C(  2142921546), -INT32_C(  1466271353),  INT32_C(  2130654463) },
+      UINT8_C(243),
+      {  INT32_C(  1230733872),  INT32_C(  1401770247), -INT32_C(   814607695), -INT32_C(   832666797) },
+      {  INT32_C(  1230733872),  INT32_C(  1401770247), -INT32_C(  1466271353),  INT32_C(  2130654463) } },
+    { { -INT32_C(  1405762075), -INT32_C(   724386151),  INT32_C(   706226567),  INT32_C(  1482515846) },
+      UINT8_C(205),
+      { -INT32_C(  1576879944),  INT32_C(   465382517),  INT32_C(  2107064145),  INT32_C(  1998612657) },
+      { -INT32_C(  1576879944), -INT32_C(   724386151),  INT32_C(   465382517),  INT32_C(  2107064145) } },
+    { { -INT32_C(  1634344793), -INT32_C(  1448359870), -INT32_C(     5028278),  INT32_C(   789612168) },
+         UINT8_MAX,
+      { -INT32_C(  1774361677), -INT32_C(  1307284118),  INT32_C(   180935694), -INT32_C(  1667086911) },
+      { -INT32_C(  1774361677), -INT32_C(  1307284118),  INT32_C(   180935694), -INT32_C(  1667086911) } },
+    { { -INT32_C(   637958375), -INT32_C(  1270021266),  INT32_C(   630374390), -INT32_C(  1393426894) },
+      UINT8_C( 58),
+      { -INT32_C(   552893013),  INT32_C(  1328936318),  INT32_C(  1963708023), -INT32_C(  2015302779) },
+      { -INT32_C(   637958375), -INT32_C(   552893013),  INT32_C(   630374390),  INT32_C(  1328936318) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 88),
+      { -INT32_C(    29013880),  INT32_C(  1356406106),  INT32_C(  2147466125), -INT32_C(  1026142912) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    29013880) } },
+    { UINT8_C(131),
+      { -INT32_C(  2014465757), -INT32_C(   307755731),  INT32_C(  1326227299), -INT32_C(  1377078993) },
+      { -INT32_C(  2014465757), -INT32_C(   307755731),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(166),
+      {  INT32_C(   245779957), -INT32_C(  1391659205),  INT32_C(   350984182),  INT32_C(   196921940) },
+      {  INT32_C(           0),  INT32_C(   245779957), -INT32_C(  1391659205),  INT32_C(           0) } },
+    { UINT8_C(229),
+      { -INT32_C(   565036813),  INT32_C(   495121861),  INT32_C(  1624830919), -INT32_C(   474827875) },
+      { -INT32_C(   565036813),  INT32_C(           0),  INT32_C(   495121861),  INT32_C(           0) } },
+    { UINT8_C(243),
+      {  INT32_C(   474386782),  INT32_C(    95371525),  INT32_C(   696528753),  INT32_C(  1314606384) },
+      {  INT32_C(   474386782),  INT32_C(    95371525),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(103),
+      { -INT32_C(   846831211), -INT32_C(  1068360487), -INT32_C(  2007390431), -INT32_C(   126573962) },
+      { -INT32_C(   846831211), -INT32_C(  1068360487), -INT32_C(  2007390431),  INT32_C(           0) } },
+    { UINT8_C(208),
+      { -INT32_C(  1100209959), -INT32_C(  1838424133),  INT32_C(   127872728),  INT32_C(  1339429559) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {    UINT8_MAX,
+      {  INT32_C(   714336411),  INT32_C(   955004838), -INT32_C(   274774224), -INT32_C(   681244992) },
+      {  INT32_C(   714336411),  INT32_C(   955004838), -INT32_C(   274774224), -INT32_C(   681244992) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expandloadu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   112315495),  INT32_C(  1131308716), -INT32_C(   962031355),  INT32_C(  2010934256) },
+      UINT8_C(249),
+      {  INT32_C(   320290513), -INT32_C(  1931763883), -INT32_C(   334380957), -INT32_C(  1340131375) },
+      {  INT32_C(   320290513),  INT32_C(  1131308716), -INT32_C(   962031355), -INT32_C(  1931763883) } },
+    { { -INT32_C(   776612942), -INT32_C(   338528274),  INT32_C(  1670337566), -INT32_C(  1808543564) },
+      UINT8_C(104),
+      {  INT32_C(  1917525392), -INT32_C(   825254289), -INT32_C(  1763873968),  INT32_C(  1389708392) },
+      { -INT32_C(   776612942), -INT32_C(   338528274),  INT32_C(  1670337566),  INT32_C(  1917525392) } },
+    { { -INT32_C(  1724271388), -INT32_C(   594563165),  INT32_C(  1898714080),  INT32_C(   578551213) },
+      UINT8_C( 58),
+      { -INT32_C(   721049402), -INT32_C(  1197505568),  INT32_C(  1567750979), -INT32_C(   560366131) },
+      { -INT32_C(  1724271388), -INT32_C(   721049402),  INT32_C(  1898714080), -INT32_C(  1197505568) } },
+    { {  INT32_C(   997127715),  INT32_C(  1491361719), -INT32_C(  1088542836),  INT32_C(  1428293486) },
+      UINT8_C(111),
+      { -INT32_C(   401147632),  INT32_C(  2109793619), -INT32_C(  1559159206), -INT32_C(  1497909397) },
+      { -INT32_C(   401147632),  INT32_C(  2109793619), -INT32_C(  1559159206), -INT32_C(  1497909397) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i r = simde_mm_mask_expandloadu_epi32(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expandloadu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(117),
+      { -INT32_C(  1721618222), -INT32_C(   601700925),  INT32_C(   112206932),  INT32_C(  1780972799) },
+      { -INT32_C(  1721618222),  INT32_C(           0), -INT32_C(   601700925),  INT32_C(           0) } },
+    { UINT8_C(  4),
+      { -INT32_C(   103978560), -INT32_C(  1029241634),  INT32_C(  1218939537),  INT32_C(   408398088) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   103978560),  INT32_C(           0) } },
+    { UINT8_C( 31),
+      { -INT32_C(   191786212),  INT32_C(  1835672763),  INT32_C(   242491003), -INT32_C(  1047068938) },
+      { -INT32_C(   191786212),  INT32_C(  1835672763),  INT32_C(   242491003), -INT32_C(  1047068938) } },
+    { UINT8_C(238),
+      {  INT32_C(    17244817), -INT32_C(  1123227316), -INT32_C(   409820620),  INT32_C(  1079432783) },
+      {  INT32_C(           0),  INT32_C(    17244817), -INT32_C(  1123227316), -INT32_C(   409820620) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi32(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 6390923159579377455), -INT64_C( 6622522421620526369) },
+      UINT8_C(129),
+      { -INT64_C( 9199230505861600630), -INT64_C( 4596872603119581744) },
+      { -INT64_C( 9199230505861600630), -INT64_C( 6622522421620526369) } },
+    { { -INT64_C( 1915486761936499991), -INT64_C( 4654015441595392440) },
+      UINT8_C(219),
+      {  INT64_C( 2447313983924726849), -INT64_C( 3093541979007534810) },
+      {  INT64_C( 2447313983924726849), -INT64_C( 3093541979007534810) } },
+    { { -INT64_C( 1342703850490179873), -INT64_C( 7216702230544204621) },
+      UINT8_C(230),
+      {  INT64_C( 8318282270098543953),  INT64_C( 2812835750726125712) },
+      { -INT64_C( 1342703850490179873),  INT64_C( 8318282270098543953) } },
+    { {  INT64_C( 6333001081051488867),  INT64_C(  345254759798958743) },
+      UINT8_C( 34),
+      { -INT64_C(  596946918730340061),  INT64_C( 8096706207469431772) },
+      {  INT64_C( 6333001081051488867), -INT64_C(  596946918730340061) } },
+    { {  INT64_C( 8688518757479290356), -INT64_C(  267089847975691373) },
+      UINT8_C(239),
+      { -INT64_C( 6165688205282546562), -INT64_C( 7447582884149529699) },
+      { -INT64_C( 6165688205282546562), -INT64_C( 7447582884149529699) } },
+    { { -INT64_C( 3140365336121060935),  INT64_C( 8320280001679793936) },
+      UINT8_C(144),
+      {  INT64_C( 3836802753772041168), -INT64_C( 2997156161396883605) },
+      { -INT64_C( 3140365336121060935),  INT64_C( 8320280001679793936) } },
+    { {  INT64_C( 3067510363570986963), -INT64_C( 7322043550766339244) },
+      UINT8_C(  4),
+      {  INT64_C( 6555582638330390882),  INT64_C( 8687448625831012103) },
+      {  INT64_C( 3067510363570986963), -INT64_C( 7322043550766339244) } },
+    { { -INT64_C(  635439625066046307),  INT64_C( 1329226089540407997) },
+      UINT8_C(235),
+      { -INT64_C( 3926795845636293405), -INT64_C( 4948781916907180160) },
+      { -INT64_C( 3926795845636293405), -INT64_C( 4948781916907180160) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  8),
+      {  INT64_C( 4703362372691729367), -INT64_C( 5178312210881676994) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(219),
+      {  INT64_C( 2326640572170294583), -INT64_C( 5361211360637084354) },
+      {  INT64_C( 2326640572170294583), -INT64_C( 5361211360637084354) } },
+    { UINT8_C( 34),
+      { -INT64_C(  260178241060485809), -INT64_C( 1621646390411878445) },
+      {  INT64_C(                   0), -INT64_C(  260178241060485809) } },
+    { UINT8_C(  6),
+      { -INT64_C( 3814473000850314026), -INT64_C( 3160466863860816462) },
+      {  INT64_C(                   0), -INT64_C( 3814473000850314026) } },
+    { UINT8_C(  4),
+      {  INT64_C( 1935424396629685856),  INT64_C( 8768787525530342761) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 68),
+      {  INT64_C( 7348950902813218837), -INT64_C( 8624121722645576977) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 22),
+      {  INT64_C( 1199286260099171578), -INT64_C( 7528168485136701333) },
+      {  INT64_C(                   0),  INT64_C( 1199286260099171578) } },
+    { UINT8_C(153),
+      {  INT64_C( 7100673121539579370),  INT64_C( 1006058570619256659) },
+      {  INT64_C( 7100673121539579370),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expandloadu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 3966315932883940108),  INT64_C( 3689422793512572229) },
+      UINT8_C(203),
+      { -INT64_C( 4513066107662647377), -INT64_C( 6058383767786454235) },
+      { -INT64_C( 4513066107662647377), -INT64_C( 6058383767786454235) } },
+    { {  INT64_C( 5018475103230368963),  INT64_C( 9120726600805827300) },
+      UINT8_C(  3),
+      {  INT64_C( 5993674808002378379),  INT64_C( 5206075209287474017) },
+      {  INT64_C( 5993674808002378379),  INT64_C( 5206075209287474017) } },
+    { { -INT64_C( 8643162575172488454), -INT64_C( 4508559821842480293) },
+      UINT8_C(  2),
+      {  INT64_C(  220396372964255776),  INT64_C( 3157820099237281854) },
+      { -INT64_C( 8643162575172488454),  INT64_C(  220396372964255776) } },
+    { { -INT64_C( 6706440066941973646), -INT64_C( 2080371788796264422) },
+      UINT8_C(214),
+      { -INT64_C( 1529872586941906490), -INT64_C( 8046115046736585788) },
+      { -INT64_C( 6706440066941973646), -INT64_C( 1529872586941906490) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i r = simde_mm_mask_expandloadu_epi64(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expandloadu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(204),
+      {  INT64_C( 7045060484800702921), -INT64_C( 8757469100949764464) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 96),
+      {  INT64_C( 2525331098898781996), -INT64_C( 7506572027840676974) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(190),
+      { -INT64_C( 5935199413616366662),  INT64_C( 5594533840765223542) },
+      {  INT64_C(                   0), -INT64_C( 5935199413616366662) } },
+    { UINT8_C(150),
+      { -INT64_C( 2617469135793476908),  INT64_C( 7387036418525522182) },
+      {  INT64_C(                   0), -INT64_C( 2617469135793476908) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi64(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   454.56), SIMDE_FLOAT32_C(   524.74), SIMDE_FLOAT32_C(  -245.06), SIMDE_FLOAT32_C(  -242.56) },
+      UINT8_C(161),
+      { SIMDE_FLOAT32_C(   983.16), SIMDE_FLOAT32_C(  -222.73), SIMDE_FLOAT32_C(   -27.14), SIMDE_FLOAT32_C(  -703.40) },
+      { SIMDE_FLOAT32_C(   983.16), SIMDE_FLOAT32_C(   524.74), SIMDE_FLOAT32_C(  -245.06), SIMDE_FLOAT32_C(  -242.56) } },
+    { { SIMDE_FLOAT32_C(   865.92), SIMDE_FLOAT32_C(   204.69), SIMDE_FLOAT32_C(  -833.05), SIMDE_FLOAT32_C(  -258.84) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT32_C(   316.77), SIMDE_FLOAT32_C(  -588.99), SIMDE_FLOAT32_C(   523.99), SIMDE_FLOAT32_C(   333.29) },
+      { SIMDE_FLOAT32_C(   865.92), SIMDE_FLOAT32_C(   204.69), SIMDE_FLOAT32_C(  -833.05), SIMDE_FLOAT32_C(   316.77) } },
+    { { SIMDE_FLOAT32_C(   723.68), SIMDE_FLOAT32_C(  -111.53), SIMDE_FLOAT32_C(   242.95), SIMDE_FLOAT32_C(    92.72) },
+      UINT8_C(148),
+      { SIMDE_FLOAT32_C(  -374.65), SIMDE_FLOAT32_C(   735.91), SIMDE_FLOAT32_C(  -612.75), SIMDE_FLOAT32_C(  -256.05) },
+      { SIMDE_FLOAT32_C(   723.68), SIMDE_FLOAT32_C(  -111.53), SIMDE_FLOAT32_C(  -374.65), SIMDE_FLOAT32_C(    92.72) } },
+    { { SIMDE_FLOAT32_C(   858.49), SIMDE_FLOAT32_C(  -534.18), SIMDE_FLOAT32_C(   693.87), SIMDE_FLOAT32_C(  -403.93) },
+      UINT8_C( 64),
+      { SIMDE_FLOAT32_C(   582.95), SIMDE_FLOAT32_C(  -136.45), SIMDE_FLOAT32_C(   823.01), SIMDE_FLOAT32_C(  -562.73) },
+      { SIMDE_FLOAT32_C(   858.49), SIMDE_FLOAT32_C(  -534.18), SIMDE_FLOAT32_C(   693.87), SIMDE_FLOAT32_C(  -403.93) } },
+    { { SIMDE_FLOAT32_C(   357.99), SIMDE_FLOAT32_C(  -371.39), SIMDE_FLOAT32_C(  -445.07), SIMDE_FLOAT32_C(  -246.50) },
+      UINT8_C(251),
+      { SIMDE_FLOAT32_C(   741.43), SIMDE_FLOAT32_C(   232.73), SIMDE_FLOAT32_C(   172.96), SIMDE_FLOAT32_C(   702.36) },
+      { SIMDE_FLOAT32_C(   741.43), SIMDE_FLOAT32_C(   232.73), SIMDE_FLOAT32_C(  -445.07), SIMDE_FLOAT32_C(   172.96) } },
+    { { SIMDE_FLOAT32_C(   875.11), SIMDE_FLOAT32_C(  -350.07), SIMDE_FLOAT32_C(  -909.17), SIMDE_FLOAT32_C(  -336.93) },
+      UINT8_C(243),
+      { SIMDE_FLOAT32_C(  -795.74), SIMDE_FLOAT32_C(   793.80), SIMDE_FLOAT32_C(  -303.44), SIMDE_FLOAT32_C(   812.75) },
+      { SIMDE_FLOAT32_C(  -795.74), SIMDE_FLOAT32_C(   793.80), SIMDE_FLOAT32_C(  -909.17), SIMDE_FLOAT32_C(  -336.93) } },
+    { { SIMDE_FLOAT32_C(    70.10), SIMDE_FLOAT32_C(  -242.08), SIMDE_FLOAT32_C(  -784.34), SIMDE_FLOAT32_C(  -662.76) },
+      UINT8_C( 45),
+      { SIMDE_FLOAT32_C(  -532.22), SIMDE_FLOAT32_C(   -96.61), SIMDE_FLOAT32_C(  -936.04), SIMDE_FLOAT32_C(  -280.63) },
+      { SIMDE_FLOAT32_C(  -532.22), SIMDE_FLOAT32_C(  -242.08), SIMDE_FLOAT32_C(   -96.61), SIMDE_FLOAT32_C(  -936.04) } },
+    { { SIMDE_FLOAT32_C(   -42.18), SIMDE_FLOAT32_C(  -464.62), SIMDE_FLOAT32_C(    48.75), SIMDE_FLOAT32_C(    18.41) },
+      UINT8_C(144),
+      { SIMDE_FLOAT32_C(  -989.30), SIMDE_FLOAT32_C(  -710.30), SIMDE_FLOAT32_C(   563.71), SIMDE_FLOAT32_C(    82.45) },
+      { SIMDE_FLOAT32_C(   -42.18), SIMDE_FLOAT32_C(  -464.62), SIMDE_FLOAT32_C(    48.75), SIMDE_FLOAT32_C(    18.41) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_expand_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C( 87),
+      { SIMDE_FLOAT32_C(   849.70), SIMDE_FLOAT32_C(   642.31), SIMDE_FLOAT32_C(   -65.88), SIMDE_FLOAT32_C(   383.70) },
+      { SIMDE_FLOAT32_C(   849.70), SIMDE_FLOAT32_C(   642.31), SIMDE_FLOAT32_C(   -65.88), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   472.81), SIMDE_FLOAT32_C(  -270.29), SIMDE_FLOAT32_C(  -403.63), SIMDE_FLOAT32_C(   212.32) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(128),
+      { SIMDE_FLOAT32_C(  -512.55), SIMDE_FLOAT32_C(   -18.83), SIMDE_FLOAT32_C(  -237.06), SIMDE_FLOAT32_C(   524.00) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(135),
+      { SIMDE_FLOAT32_C(    95.79), SIMDE_FLOAT32_C(  -209.62), SIMDE_FLOAT32_C(  -713.37), SIMDE_FLOAT32_C(   583.78) },
+      { SIMDE_FLOAT32_C(    95.79), SIMDE_FLOAT32_C(  -209.62), SIMDE_FLOAT32_C(  -713.37), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  -694.26), SIMDE_FLOAT32_C(  -313.90), SIMDE_FLOAT32_C(  -268.46), SIMDE_FLOAT32_C(  -507.46) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(107),
+      { SIMDE_FLOAT32_C(  -643.31), SIMDE_FLOAT32_C(   186.91), SIMDE_FLOAT32_C(  -882.01), SIMDE_FLOAT32_C(  -619.08) },
+      { SIMDE_FLOAT32_C(  -643.31), SIMDE_FLOAT32_C(   186.91), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -882.01) } },
+    { UINT8_C( 27),
+      { SIMDE_FLOAT32_C(  -891.29), SIMDE_FLOAT32_C(   456.85), SIMDE_FLOAT32_C(   859.81), SIMDE_FLOAT32_C(  -318.47) },
+      { SIMDE_FLOAT32_C(  -891.29), SIMDE_FLOAT32_C(   456.85), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   859.81) } },
+    { UINT8_C(182),
+      { SIMDE_FLOAT32_C(   922.33), SIMDE_FLOAT32_C(  -816.82), SIMDE_FLOAT32_C(   -14.31), SIMDE_FLOAT32_C(   734.50) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   922.33), SIMDE_FLOAT32_C(  -816.82), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_expand_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expandloadu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   359.51), SIMDE_FLOAT32_C(  -634.96), SIMDE_FLOAT32_C(  -909.39), SIMDE_FLOAT32_C(   802.87) },
+      UINT8_C(191),
+      { SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(   609.52), SIMDE_FLOAT32_C(  -559.32), SIMDE_FLOAT32_C(  -406.55) },
+      { SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(   609.52), SIMDE_FLOAT32_C(  -559.32), SIMDE_FLOAT32_C(  -406.55) } },
+    { { SIMDE_FLOAT32_C(  -443.62), SIMDE_FLOAT32_C(  -242.18), SIMDE_FLOAT32_C(   174.03), SIMDE_FLOAT32_C(     6.10) },
+      UINT8_C( 52),
+      { SIMDE_FLOAT32_C(  -183.42), SIMDE_FLOAT32_C(   570.16), SIMDE_FLOAT32_C(   171.88), SIMDE_FLOAT32_C(   718.26) },
+      { SIMDE_FLOAT32_C(  -443.62), SIMDE_FLOAT32_C(  -242.18), SIMDE_FLOAT32_C(  -183.42), SIMDE_FLOAT32_C(     6.10) } },
+    { { SIMDE_FLOAT32_C(   654.52), SIMDE_FLOAT32_C(  -487.29), SIMDE_FLOAT32_C(  -612.26), SIMDE_FLOAT32_C(  -615.07) },
+      UINT8_C(199),
+      { SIMDE_FLOAT32_C(   647.10), SIMDE_FLOAT32_C(  -845.83), SIMDE_FLOAT32_C(  -708.22), SIMDE_FLOAT32_C(    28.26) },
+      { SIMDE_FLOAT32_C(   647.10), SIMDE_FLOAT32_C(  -845.83), SIMDE_FLOAT32_C(  -708.22), SIMDE_FLOAT32_C(  -615.07) } },
+    { { SIMDE_FLOAT32_C(  -595.89), SIMDE_FLOAT32_C(   711.43), SIMDE_FLOAT32_C(  -943.91), SIMDE_FLOAT32_C(  -159.26) },
+      UINT8_C(  4),
+      { SIMDE_FLOAT32_C(  -920.64), SIMDE_FLOAT32_C(  -442.50), SIMDE_FLOAT32_C(  -692.58), SIMDE_FLOAT32_C(   289.15) },
+      { SIMDE_FLOAT32_C(  -595.89), SIMDE_FLOAT32_C(   711.43), SIMDE_FLOAT32_C(  -920.64), SIMDE_FLOAT32_C(  -159.26) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 r = simde_mm_mask_expandloadu_ps(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expandloadu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C( 75),
+      { SIMDE_FLOAT32_C(  -374.52), SIMDE_FLOAT32_C(   122.23), SIMDE_FLOAT32_C(   501.36), SIMDE_FLOAT32_C(   691.61) },
+      { SIMDE_FLOAT32_C(  -374.52), SIMDE_FLOAT32_C(   122.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   501.36) } },
+    { UINT8_C(176),
+      { SIMDE_FLOAT32_C(   494.77), SIMDE_FLOAT32_C(   617.32), SIMDE_FLOAT32_C(  -518.38), SIMDE_FLOAT32_C(   -30.80) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(133),
+      { SIMDE_FLOAT32_C(   853.57), SIMDE_FLOAT32_C(   177.53), SIMDE_FLOAT32_C(  -207.91), SIMDE_FLOAT32_C(   314.83) },
+      { SIMDE_FLOAT32_C(   853.57), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   177.53), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 19),
+      { SIMDE_FLOAT32_C(  -913.13), SIMDE_FLOAT32_C(  -485.67), SIMDE_FLOAT32_C(  -205.53), SIMDE_FLOAT32_C(  -786.54) },
+      { SIMDE_FLOAT32_C(  -913.13), SIMDE_FLOAT32_C(  -485.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 r = simde_mm_maskz_expandloadu_ps(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -115.76), SIMDE_FLOAT64_C(   239.36) },
+      UINT8_C( 17),
+      { SIMDE_FLOAT64_C(   674.60), SIMDE_FLOAT64_C(   458.11) },
+      { SIMDE_FLOAT64_C(   674.60), SIMDE_FLOAT64_C(   239.36) } },
+    { { SIMDE_FLOAT64_C(   -61.94), SIMDE_FLOAT64_C(   672.17) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(   304.94), SIMDE_FLOAT64_C(   945.27) },
+      { SIMDE_FLOAT64_C(   304.94), SIMDE_FLOAT64_C(   945.27) } },
+    { { SIMDE_FLOAT64_C(  -120.90), SIMDE_FLOAT64_C(   -94.62) },
+      UINT8_C(144),
+      { SIMDE_FLOAT64_C(   655.19), SIMDE_FLOAT64_C(   188.55) },
+      { SIMDE_FLOAT64_C(  -120.90), SIMDE_FLOAT64_C(   -94.62) } },
+    { { SIMDE_FLOAT64_C(    12.19), SIMDE_FLOAT64_C(  -139.18) },
+      UINT8_C(237),
+      { SIMDE_FLOAT64_C(    46.09), SIMDE_FLOAT64_C(   508.88) },
+      { SIMDE_FLOAT64_C(    46.09), SIMDE_FLOAT64_C(  -139.18) } },
+    { { SIMDE_FLOAT64_C(  -402.47), SIMDE_FLOAT64_C(  -231.89) },
+      UINT8_C(247),
+      { SIMDE_FLOAT64_C(   573.19), SIMDE_FLOAT64_C(   754.76) },
+      { SIMDE_FLOAT64_C(   573.19), SIMDE_FLOAT64_C(   754.76) } },
+    { { SIMDE_FLOAT64_C(  -570.55), SIMDE_FLOAT64_C(  -588.65) },
+      UINT8_C( 82),
+      { SIMDE_FLOAT64_C(  -933.95), SIMDE_FLOAT64_C(   772.51) },
+      { SIMDE_FLOAT64_C(  -570.55), SIMDE_FLOAT64_C(  -933.95) } },
+    { { SIMDE_FLOAT64_C(   630.85), SIMDE_FLOAT64_C(   508.84) },
+      UINT8_C(187),
+      { SIMDE_FLOAT64_C(  -393.36), SIMDE_FLOAT64_C(  -851.46) },
+      { SIMDE_FLOAT64_C(  -393.36), SIMDE_FLOAT64_C(  -851.46) } },
+    { { SIMDE_FLOAT64_C(   129.77), SIMDE_FLOAT64_C(   379.54) },
+      UINT8_C(244),
+      { SIMDE_FLOAT64_C(  -694.08), SIMDE_FLOAT64_C(  -376.81) },
+      { SIMDE_FLOAT64_C(   129.77), SIMDE_FLOAT64_C(   379.54) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_expand_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(253),
+      { SIMDE_FLOAT64_C(   827.95), SIMDE_FLOAT64_C(  -853.94) },
+      { SIMDE_FLOAT64_C(   827.95), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(204),
+      { SIMDE_FLOAT64_C(   116.33), SIMDE_FLOAT64_C(   -84.58) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 34),
+      { SIMDE_FLOAT64_C(  -485.81), SIMDE_FLOAT64_C(  -141.28) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -485.81) } },
+    { UINT8_C(144),
+      { SIMDE_FLOAT64_C(   238.75), SIMDE_FLOAT64_C(  -157.02) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(156),
+      { SIMDE_FLOAT64_C(  -129.50), SIMDE_FLOAT64_C(   658.82) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 28),
+      { SIMDE_FLOAT64_C(   169.87), SIMDE_FLOAT64_C(  -792.54) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(165),
+      { SIMDE_FLOAT64_C(   115.88), SIMDE_FLOAT64_C(  -601.48) },
+      { SIMDE_FLOAT64_C(   115.88), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(189),
+      { SIMDE_FLOAT64_C(  -248.21), SIMDE_FLOAT64_C(   816.83) },
+      { SIMDE_FLOAT64_C(  -248.21), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_expand_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expandloadu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   176.42), SIMDE_FLOAT64_C(   476.66) },
+      UINT8_C(165),
+      { SIMDE_FLOAT64_C(  -979.79), SIMDE_FLOAT64_C(  -576.13) },
+      { SIMDE_FLOAT64_C(  -979.79), SIMDE_FLOAT64_C(   476.66) } },
+    { { SIMDE_FLOAT64_C(  -471.24), SIMDE_FLOAT64_C(  -852.70) },
+      UINT8_C(121),
+      { SIMDE_FLOAT64_C(   149.37), SIMDE_FLOAT64_C(  -873.08) },
+      { SIMDE_FLOAT64_C(   149.37), SIMDE_FLOAT64_C(  -852.70) } },
+    { { SIMDE_FLOAT64_C(   498.12), SIMDE_FLOAT64_C(    70.79) },
+      UINT8_C(109),
+      { SIMDE_FLOAT64_C(   860.91), SIMDE_FLOAT64_C(  -839.25) },
+      { SIMDE_FLOAT64_C(   860.91), SIMDE_FLOAT64_C(    70.79) } },
+    { { SIMDE_FLOAT64_C(  -348.33), SIMDE_FLOAT64_C(   560.98) },
+      UINT8_C(251),
+      { SIMDE_FLOAT64_C(   964.53), SIMDE_FLOAT64_C(   875.91) },
+      { SIMDE_FLOAT64_C(   964.53), SIMDE_FLOAT64_C(   875.91) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d r = simde_mm_mask_expandloadu_pd(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expandloadu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(  6),
+      { SIMDE_FLOAT64_C(  -216.85), SIMDE_FLOAT64_C(  -661.27) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -216.85) } },
+    {    UINT8_MAX,
+      { SIMDE_FLOAT64_C(   746.62), SIMDE_FLOAT64_C(   -84.40) },
+      { SIMDE_FLOAT64_C(   746.62), SIMDE_FLOAT64_C(   -84.40) } },
+    { UINT8_C( 65),
+      { SIMDE_FLOAT64_C(    47.97), SIMDE_FLOAT64_C(   270.67) },
+      { SIMDE_FLOAT64_C(    47.97), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(111),
+      { SIMDE_FLOAT64_C(  -123.06), SIMDE_FLOAT64_C(   509.18) },
+      { SIMDE_FLOAT64_C(  -123.06), SIMDE_FLOAT64_C(   509.18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d r = simde_mm_maskz_expandloadu_pd(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C(  18),  INT8_C(   9),  INT8_C(  91),  INT8_C(  44), -INT8_C( 114),  INT8_C(   2),  INT8_C(  80),  INT8_C(  10),
+         INT8_C( 102),  INT8_C( 124), -INT8_C(  26), -INT8_C(  37),  INT8_C( 106),      INT8_MIN, -INT8_C( 100), -INT8_C( 115),
+         INT8_C(  71), -INT8_C(  95),  INT8_C(  88),  INT8_C(  28), -INT8_C(  44), -INT8_C(  31),  INT8_C( 109),  INT8_C(  79),
+         INT8_C(  77),  INT8_C(  77), -INT8_C(  34),  INT8_C(  22),  INT8_C(  15),  INT8_C(  78), -INT8_C(   2), -INT8_C(  43) },
+      UINT32_C(2252841941),
+      { -INT8_C( 100), -INT8_C(  21), -INT8_C(  74), -INT8_C(  44),  INT8_C( 102),  INT8_C(  81), -INT8_C(  75), -INT8_C(  18),
+         INT8_C(  72), -INT8_C(  75), -INT8_C(  74), -INT8_C(   3), -INT8_C(  78), -INT8_C(  87),  INT8_C( 124),  INT8_C(  38),
+         INT8_C(  99), -INT8_C( 118), -INT8_C( 112),  INT8_C( 120), -INT8_C(  59),  INT8_C(   6),  INT8_C( 111),  INT8_C(  21),
+        -INT8_C( 102),  INT8_C( 101),  INT8_C(  19),  INT8_C(  95), -INT8_C(  92), -INT8_C( 101),  INT8_C(  57), -INT8_C(  46) },
+      { -INT8_C( 100),  INT8_C(   9), -INT8_C(  21),  INT8_C(  44), -INT8_C(  74),  INT8_C(   2), -INT8_C(  44),  INT8_C( 102),
+         INT8_C(  81), -INT8_C(  75), -INT8_C(  26), -INT8_C(  37),  INT8_C( 106), -INT8_C(  18), -INT8_C( 100),  INT8_C(  72),
+        -INT8_C(  75), -INT8_C(  74), -INT8_C(   3),  INT8_C(  28), -INT8_C(  44), -INT8_C(  31), -INT8_C(  78),  INT8_C(  79),
+         INT8_C(  77), -INT8_C(  87),  INT8_C( 124),  INT8_C(  22),  INT8_C(  15),  INT8_C(  78), -INT8_C(   2),  INT8_C(  38) } },
+    { {  INT8_C(  21),  INT8_C( 120), -INT8_C(  71),  INT8_C(  69),  INT8_C(  93), -INT8_C(  86), -INT8_C(  83), -INT8_C(  90),
+        -INT8_C(  60), -INT8_C( 122), -INT8_C(  39),  INT8_C(  32),  INT8_C(  18),  INT8_C(  39),  INT8_C(  92), -INT8_C(  38),
+         INT8_C( 105), -INT8_C(  11), -INT8_C(  11), -INT8_C(  84), -INT8_C(   2),  INT8_C( 111),  INT8_C(  75), -INT8_C(  52),
+        -INT8_C(  95),  INT8_C(  51), -INT8_C(  33),  INT8_C(  46),  INT8_C(  64),  INT8_C(  17),  INT8_C(  42),  INT8_C(  99) },
+      UINT32_C(1091634209),
+      {  INT8_C(  85),  INT8_C(  31), -INT8_C(  95), -INT8_C(  17), -INT8_C(  96),  INT8_C(  81), -INT8_C( 107), -INT8_C( 123),
+         INT8_C(  36), -INT8_C(  43),  INT8_C( 121), -INT8_C(  46),  INT8_C(  64), -INT8_C( 116),  INT8_C(  42),  INT8_C(  67),
+         INT8_C(   4), -INT8_C(  47), -INT8_C(  75), -INT8_C(  60), -INT8_C(  72),  INT8_C(  47),  INT8_C( 104), -INT8_C(   7),
+        -INT8_C(  40),  INT8_C( 123), -INT8_C(  43), -INT8_C(  87), -INT8_C(  56),  INT8_C(  37),  INT8_C(   0),  INT8_C(  75) },
+      {  INT8_C(  85),  INT8_C( 120), -INT8_C(  71),  INT8_C(  69),  INT8_C(  93),  INT8_C(  31), -INT8_C(  83), -INT8_C(  90),
+        -INT8_C(  60), -INT8_C( 122), -INT8_C(  95),  INT8_C(  32),  INT8_C(  18),  INT8_C(  39),  INT8_C(  92), -INT8_C(  38),
+        -INT8_C(  17), -INT8_C(  11), -INT8_C(  11), -INT8_C(  84), -INT8_C(  96),  INT8_C( 111),  INT8_C(  75), -INT8_C(  52),
+         INT8_C(  81),  INT8_C(  51), -INT8_C(  33),  INT8_C(  46),  INT8_C(  64),  INT8_C(  17), -INT8_C( 107),  INT8_C(  99) } },
+    { { -INT8_C(  72),  INT8_C(  24), -INT8_C( 117), -INT8_C( 107),  INT8_C( 125),  INT8_C(  82), -INT8_C(  73),  INT8_C( 115),
+         INT8_C(  95),  INT8_C(  28),      INT8_MAX, -INT8_C(  22),  INT8_C(  13),  INT8_C(   0),  INT8_C( 114), -INT8_C(  73),
+         INT8_C(  33),  INT8_C(  83), -INT8_C(  91),  INT8_C(  78), -INT8_C(  43),  INT8_C(  20),  INT8_C(  68),  INT8_C(  77),
+         INT8_C(  43),  INT8_C(  41), -INT8_C( 126), -INT8_C(  80), -INT8_C(  21), -INT8_C(  38),  INT8_C(  33),  INT8_C(  20) },
+      UINT32_C(2103540759),
+      {  INT8_C( 122),      INT8_MIN, -INT8_C(  25), -INT8_C( 117), -INT8_C( 106), -INT8_C(  81),  INT8_C(  65), -INT8_C(  35),
+         INT8_C( 118),  INT8_C( 124),  INT8_C(  63),  INT8_C( 105),  INT8_C( 120), -INT8_C(  68), -INT8_C(  86),  INT8_C(  77),
+        -INT8_C(  89),  INT8_C(  15),  INT8_C(  40),  INT8_C( 116), -INT8_C(  71),  INT8_C(  64),  INT8_C(  54),  INT8_C(  45),
+        -INT8_C( 122), -INT8_C( 118), -INT8_C(  93), -INT8_C(  66),  INT8_C( 105), -INT8_C(  59),  INT8_C(  11),  INT8_C( 117) },
+      {  INT8_C( 122),      INT8_MIN, -INT8_C(  25), -INT8_C( 107), -INT8_C( 117),  INT8_C(  82), -INT8_C(  73),  INT8_C( 115),
+         INT8_C(  95),  INT8_C(  28), -INT8_C( 106), -INT8_C(  81),  INT8_C(  65), -INT8_C(  35),  INT8_C( 118), -INT8_C(  73),
+         INT8_C( 124),  INT8_C(  83), -INT8_C(  91),  INT8_C(  78), -INT8_C(  43),  INT8_C(  63),  INT8_C( 105),  INT8_C(  77),
+         INT8_C( 120),  INT8_C(  41), -INT8_C(  68), -INT8_C(  86),  INT8_C(  77), -INT8_C(  89),  INT8_C(  15),  INT8_C(  20) } },
+    { {  INT8_C(  26),  INT8_C(  31),  INT8_C(  35),  INT8_C( 120),  INT8_C(  54), -INT8_C(   9), -INT8_C(  93),  INT8_C(  96),
+        -INT8_C(  14),  INT8_C(  70),  INT8_C(  84),  INT8_C(   2),  INT8_C(  84),  INT8_C(  13),  INT8_C(  39),  INT8_C(  56),
+        -INT8_C(   1),  INT8_C(  40),  INT8_C(  63),  INT8_C(  34), -INT8_C(  72),  INT8_C(  86),  INT8_C( 111), -INT8_C(  99),
+         INT8_C(   1),  INT8_C(  45),  INT8_C(  52), -INT8_C(  93),  INT8_C( 108), -INT8_C(  99), -INT8_C(  71),  INT8_C(  59) },
+      UINT32_C(1149506568),
+      { -INT8_C( 110),  INT8_C( 103), -INT8_C( 115), -INT8_C(  77),  INT8_C(  83), -INT8_C(  49),  INT8_C(   1), -INT8_C(   7),
+         INT8_C(  74), -INT8_C(   6), -INT8_C(  69), -INT8_C( 109),  INT8_C( 102), -INT8_C(  80), -INT8_C(  44), -INT8_C(  37),
+         INT8_C(  38),  INT8_C(  29), -INT8_C( 122), -INT8_C(  41),  INT8_C(  47),  INT8_C( 107),  INT8_C(  97),  INT8_C(  95),
+        -INT8_C( 124),  INT8_C(  31),  INT8_C(  24),  INT8_C(  94), -INT8_C( 123), -INT8_C(  26), -INT8_C( 117),  INT8_C( 111) },
+      {  INT8_C(  26),  INT8_C(  31),  INT8_C(  35), -INT8_C( 110),  INT8_C(  54), -INT8_C(   9), -INT8_C(  93),  INT8_C(  96),
+        -INT8_C(  14),  INT8_C(  70),  INT8_C( 103),  INT8_C(   2), -INT8_C( 115),  INT8_C(  13),  INT8_C(  39),  INT8_C(  56),
+        -INT8_C(   1),  INT8_C(  40), -INT8_C(  77),  INT8_C(  34), -INT8_C(  72),  INT8_C(  86),  INT8_C( 111),  INT8_C(  83),
+         INT8_C(   1),  INT8_C(  45), -INT8_C(  49), -INT8_C(  93),  INT8_C( 108), -INT8_C(  99),  INT8_C(   1),  INT8_C(  59) } },
+    { {  INT8_C(  56), -INT8_C( 112),  INT8_C(  20), -INT8_C(  19),  INT8_C( 125), -INT8_C( 124), -INT8_C(  86), -INT8_C(  20),
+         INT8_C( 113),  INT8_C(  35), -INT8_C( 108),  INT8_C( 102), -INT8_C( 122),  INT8_C(  16),  INT8_C(  82),  INT8_C(  17),
+        -INT8_C(  74), -INT8_C(  75),  INT8_C(   4), -INT8_C(  63),  INT8_C(   3), -INT8_C(  46), -INT8_C(  32),  INT8_C(   9),
+         INT8_C( 115),  INT8_C(  82), -INT8_C( 114), -INT8_C(  88), -INT8_C( 104), -INT8_C( 113), -INT8_C(  83), -INT8_C(  89) },
+      UINT32_C(2156716044),
+      {  INT8_C(  51), -INT8_C( 122),  INT8_C(  88), -INT8_C(   6),  INT8_C(  89), -INT8_C(  78),  INT8_C(  30), -INT8_C(  45),
+        -INT8_C( 122), -INT8_C(  56),  INT8_C(  30), -INT8_C(  76), -INT8_C( 119),  INT8_C( 123),  INT8_C(  73), -INT8_C( 114),
+        -INT8_C(  39),  INT8_C(  93), -INT8_C(   2), -INT8_C(  31),  INT8_C(  65), -INT8_C( 113), -INT8_C( 106), -INT8_C(  23),
+         INT8_C( 102),  INT8_C( 125),  INT8_C(  46),  INT8_C(  49), -INT8_C( 100), -INT8_C( 103),  INT8_C( 100), -INT8_C(  71) },
+      {  INT8_C(  56), -INT8_C( 112),  INT8_C(  51), -INT8_C( 122),  INT8_C( 125), -INT8_C( 124), -INT8_C(  86), -INT8_C(  20),
+         INT8_C( 113),  INT8_C(  35), -INT8_C( 108),  INT8_C( 102), -INT8_C( 122),  INT8_C(  88), -INT8_C(   6),  INT8_C(  89),
+        -INT8_C(  74), -INT8_C(  75), -INT8_C(  78),  INT8_C(  30),  INT8_C(   3), -INT8_C(  46), -INT8_C(  32), -INT8_C(  45),
+         INT8_C( 115),  INT8_C(  82), -INT8_C( 114), -INT8_C(  88), -INT8_C( 104), -INT8_C( 113), -INT8_C(  83), -INT8_C( 122) } },
+    { { -INT8_C( 124), -INT8_C(  25),  INT8_C(  88),  INT8_C(  69),  INT8_C(  78),  INT8_C(  73),  INT8_C(  67),  INT8_C(  28),
+        -INT8_C(  26), -INT8_C(   3), -INT8_C( 126), -INT8_C( 107), -INT8_C(  87), -INT8_C(   6), -INT8_C(  88), -INT8_C(   3),
+        -INT8_C(  15),  INT8_C(   0),  INT8_C(  62),  INT8_C(  94),  INT8_C( 121), -INT8_C(   3), -INT8_C(  48), -INT8_C( 121),
+        -INT8_C(  57), -INT8_C( 120),  INT8_C(  12),  INT8_C(   1), -INT8_C(  68), -INT8_C(  68), -INT8_C( 124),  INT8_C(  96) },
+      UINT32_C( 241392713),
+      {  INT8_C(  26),  INT8_C(  20),  INT8_C(  56),  INT8_C(  57), -INT8_C(  97),  INT8_C(  29), -INT8_C( 103),  INT8_C(  11),
+         INT8_C( 116), -INT8_C(  19),  INT8_C(  63), -INT8_C(  16),  INT8_C(  87),  INT8_C(  86), -INT8_C( 116), -INT8_C( 123),
+         INT8_C( 123), -INT8_C( 105), -INT8_C(  32), -INT8_C(  78), -INT8_C(  96), -INT8_C(   7), -INT8_C(   5),  INT8_C(  20),
+         INT8_C(  24),  INT8_C( 105), -INT8_C(  77),  INT8_C(  16), -INT8_C(  85), -INT8_C(  73), -INT8_C( 124), -INT8_C( 116) },
+      {  INT8_C(  26), -INT8_C(  25),  INT8_C(  88),  INT8_C(  20),  INT8_C(  78),  INT8_C(  73),  INT8_C(  56),  INT8_C(  28),
+        -INT8_C(  26), -INT8_C(   3),  INT8_C(  57), -INT8_C(  97),  INT8_C(  29), -INT8_C(   6), -INT8_C( 103), -INT8_C(   3),
+         INT8_C(  11),  INT8_C( 116),  INT8_C(  62),  INT8_C(  94),  INT8_C( 121), -INT8_C(  19),  INT8_C(  63), -INT8_C( 121),
+        -INT8_C(  57), -INT8_C(  16),  INT8_C(  87),  INT8_C(  86), -INT8_C(  68), -INT8_C(  68), -INT8_C( 124),  INT8_C(  96) } },
+    { { -INT8_C(  31),  INT8_C(  27), -INT8_C(  85), -INT8_C(  85),  INT8_C(  62),  INT8_C(  78),  INT8_C(  64), -INT8_C(  41),
+         INT8_C(  67),  INT8_C(  27),  INT8_C(   7),  INT8_C( 123), -INT8_C(  97), -INT8_C(  96),  INT8_C( 117), -INT8_C(  88),
+         INT8_C(  94),  INT8_C(  41),  INT8_C(  78),  INT8_C( 102),  INT8_C(  50), -INT8_C( 127),  INT8_C(  45),  INT8_C(   7),
+         INT8_C(  66), -INT8_C( 109), -INT8_C( 100),  INT8_C(  46), -INT8_C(  24),  INT8_C(  89), -INT8_C(  50),  INT8_C(   4) },
+      UINT32_C(1631504907),
+      { -INT8_C(  25),  INT8_C(  48),  INT8_C(  44), -INT8_C(  24),  INT8_C(  21),  INT8_C(  28),      INT8_MIN,  INT8_C(  95),
+         INT8_C(  41),  INT8_C(  73),  INT8_C( 105),  INT8_C( 123), -INT8_C(  82), -INT8_C(  31),  INT8_C(  48), -INT8_C(  12),
+         INT8_C(  85), -INT8_C(  55), -INT8_C(  53), -INT8_C(  17),  INT8_C(   6),  INT8_C( 113), -INT8_C(  56), -INT8_C(  82),
+        -INT8_C(  27),  INT8_C(  85),      INT8_MAX,  INT8_C(  62), -INT8_C(  26),  INT8_C(  57),  INT8_C( 110),  INT8_C(  66) },
+      { -INT8_C(  25),  INT8_C(  48), -INT8_C(  85),  INT8_C(  44),  INT8_C(  62),  INT8_C(  78),  INT8_C(  64), -INT8_C(  41),
+         INT8_C(  67), -INT8_C(  24),  INT8_C(   7),  INT8_C(  21), -INT8_C(  97), -INT8_C(  96),  INT8_C(  28),      INT8_MIN,
+         INT8_C(  94),  INT8_C(  95),  INT8_C(  41),  INT8_C(  73),  INT8_C( 105),  INT8_C( 123),  INT8_C(  45),  INT8_C(   7),
+        -INT8_C(  82), -INT8_C( 109), -INT8_C( 100),  INT8_C(  46), -INT8_C(  24), -INT8_C(  31),  INT8_C(  48),  INT8_C(   4) } },
+    { { -INT8_C(  82),  INT8_C(  19),      INT8_MIN, -INT8_C( 113),  INT8_C(  21), -INT8_C(   3), -INT8_C( 103), -INT8_C(  53),
+        -INT8_C(  39),  INT8_C(  97), -INT8_C(  36), -INT8_C(  72),  INT8_C(  41),  INT8_C( 121),  INT8_C(  10),  INT8_C(  63),
+        -INT8_C(  95), -INT8_C(  48), -INT8_C(  51), -INT8_C(  24),  INT8_C(   7),  INT8_C(  58), -INT8_C(  39),  INT8_C(  95),
+        -INT8_C( 114), -INT8_C(  14), -INT8_C(  52), -INT8_C(  25),  INT8_C( 115), -INT8_C(  62),  INT8_C(   5),  INT8_C(  57) },
+      UINT32_C(1416750910),
+      { -INT8_C(  51),      INT8_MIN, -INT8_C(  27), -INT8_C(   2), -INT8_C(  24),  INT8_C(  41), -INT8_C(  68), -INT8_C(  37),
+         INT8_C(  76),  INT8_C(   9),  INT8_C(  47),  INT8_C(  80), -INT8_C(  38), -INT8_C( 101), -INT8_C(  70),  INT8_C(  43),
+        -INT8_C( 115), -INT8_C(  77),  INT8_C(  31),  INT8_C(  97), -INT8_C(  34),  INT8_C(  38), -INT8_C(  76),  INT8_C(  37),
+         INT8_C(   8), -INT8_C( 100),  INT8_C(  89),  INT8_C(  54), -INT8_C(  82),  INT8_C(   7),  INT8_C(  28),  INT8_C(  27) },
+      { -INT8_C(  82), -INT8_C(  51),      INT8_MIN, -INT8_C(  27), -INT8_C(   2), -INT8_C(  24), -INT8_C( 103), -INT8_C(  53),
+         INT8_C(  41), -INT8_C(  68), -INT8_C(  37), -INT8_C(  72),  INT8_C(  41),  INT8_C(  76),  INT8_C(   9),  INT8_C(  47),
+         INT8_C(  80), -INT8_C(  48), -INT8_C(  51), -INT8_C(  24), -INT8_C(  38), -INT8_C( 101), -INT8_C(  70),  INT8_C(  95),
+        -INT8_C( 114), -INT8_C(  14),  INT8_C(  43), -INT8_C(  25), -INT8_C( 115), -INT8_C(  62), -INT8_C(  77),  INT8_C(  57) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3251419163),
+      {  INT8_C(  93), -INT8_C(  58),  INT8_C(  64),  INT8_C(  10),  INT8_C(  53),  INT8_C( 125),  INT8_C(  60), -INT8_C(   7),
+         INT8_C(  96), -INT8_C(  19), -INT8_C(  67), -INT8_C(   2), -INT8_C(  85),  INT8_C(   1), -INT8_C(  57), -INT8_C(  15),
+        -INT8_C(  17), -INT8_C(  42),  INT8_C(  61),  INT8_C(  20), -INT8_C(   7), -INT8_C(  37),  INT8_C( 110),  INT8_C(  95),
+        -INT8_C(  58),  INT8_C(  50), -INT8_C(  63), -INT8_C(   9),  INT8_C(  31),  INT8_C(  16), -INT8_C(  73),  INT8_C( 109) },
+      {  INT8_C(  93), -INT8_C(  58),  INT8_C(   0),  INT8_C(  64),  INT8_C(  10),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C( 125),  INT8_C(  60),  INT8_C(   0), -INT8_C(   7),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  96), -INT8_C(  19),  INT8_C(   0),  INT8_C(   0), -INT8_C(  67), -INT8_C(   2),
+        -INT8_C(  85),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1), -INT8_C(  57) } },
+    { UINT32_C( 456062742),
+      {  INT8_C( 114), -INT8_C( 118), -INT8_C(  14), -INT8_C(   2), -INT8_C(  36), -INT8_C(  92),  INT8_C(  82),  INT8_C(  77),
+        -INT8_C(  93),  INT8_C(  14), -INT8_C(  32), -INT8_C(   3),  INT8_C(  12), -INT8_C(  84),  INT8_C(  97),  INT8_C( 120),
+        -INT8_C( 106), -INT8_C( 108), -INT8_C(  34), -INT8_C(  30), -INT8_C(  41),  INT8_C(   2),  INT8_C(  93),  INT8_C(  55),
+        -INT8_C(  34),  INT8_C(  42),  INT8_C(   4), -INT8_C(  67),  INT8_C(  39), -INT8_C( 113),  INT8_C( 126), -INT8_C(  76) },
+      {  INT8_C(   0),  INT8_C( 114), -INT8_C( 118),  INT8_C(   0), -INT8_C(  14),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   2), -INT8_C(  36), -INT8_C(  92),  INT8_C(   0),  INT8_C(  82),  INT8_C(  77), -INT8_C(  93),  INT8_C(  14),
+         INT8_C(   0), -INT8_C(  32), -INT8_C(   3),  INT8_C(  12),  INT8_C(   0), -INT8_C(  84),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  97),  INT8_C( 120),  INT8_C(   0), -INT8_C( 106), -INT8_C( 108),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(4113562623),
+      { -INT8_C(  60), -INT8_C(  32),  INT8_C( 125), -INT8_C(  73),  INT8_C( 126),  INT8_C(  61),  INT8_C(  69),  INT8_C( 116),
+        -INT8_C( 111), -INT8_C(  16), -INT8_C(  29), -INT8_C(  61),  INT8_C(  42), -INT8_C(  14), -INT8_C(  44),  INT8_C(  95),
+        -INT8_C(  47), -INT8_C(  11), -INT8_C(   6),  INT8_C(  65),  INT8_C(  89),  INT8_C(  43), -INT8_C(  76),  INT8_C(  12),
+        -INT8_C(  90), -INT8_C(  33), -INT8_C( 118), -INT8_C(  74), -INT8_C( 126),  INT8_C(   6),  INT8_C(  43),  INT8_C(  68) },
+      { -INT8_C(  60), -INT8_C(  32),  INT8_C( 125), -INT8_C(  73),  INT8_C( 126),  INT8_C(  61),  INT8_C(  69),  INT8_C( 116),
+        -INT8_C( 111), -INT8_C(  16),  INT8_C(   0), -INT8_C(  29), -INT8_C(  61),  INT8_C(  42), -INT8_C(  14), -INT8_C(  44),
+         INT8_C(  95), -INT8_C(  47), -INT8_C(  11), -INT8_C(   6),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  89),  INT8_C(   0),  INT8_C(  43),  INT8_C(   0), -INT8_C(  76),  INT8_C(  12), -INT8_C(  90), -INT8_C(  33) } },
+    { UINT32_C(2108620287),
+      { -INT8_C( 103), -INT8_C(  77), -INT8_C(  34), -INT8_C(  40), -INT8_C( 123),  INT8_C(  41),  INT8_C(   0),  INT8_C(  37),
+        -INT8_C( 119), -INT8_C( 113),  INT8_C(  77),  INT8_C(  54),  INT8_C(  61), -INT8_C( 102),  INT8_C( 126),  INT8_C( 109),
+         INT8_C(  76),  INT8_C(   9),  INT8_C( 125), -INT8_C(  75), -INT8_C(  89), -INT8_C(   8), -INT8_C(  30),  INT8_C(  26),
+        -INT8_C(  95),  INT8_C( 117),  INT8_C(  60), -INT8_C(  16),  INT8_C(  10), -INT8_C( 109),  INT8_C(   7),  INT8_C(  95) },
+      { -INT8_C( 103), -INT8_C(  77), -INT8_C(  34), -INT8_C(  40), -INT8_C( 123),  INT8_C(  41),  INT8_C(   0),  INT8_C(  37),
+        -INT8_C( 119),  INT8_C(   0), -INT8_C( 113),  INT8_C(  77),  INT8_C(  54),  INT8_C(  61), -INT8_C( 102),  INT8_C( 126),
+         INT8_C(   0),  INT8_C( 109),  INT8_C(  76),  INT8_C(   9),  INT8_C(   0),  INT8_C( 125),  INT8_C(   0), -INT8_C(  75),
+        -INT8_C(  89),  INT8_C(   0), -INT8_C(   8), -INT8_C(  30),  INT8_C(  26), -INT8_C(  95),  INT8_C( 117),  INT8_C(   0) } },
+    { UINT32_C(1029045908),
+      { -INT8_C( 116),  INT8_C(   1), -INT8_C(  71), -INT8_C(  79),  INT8_C(  66), -INT8_C(  46),  INT8_C(   0), -INT8_C(  66),
+         INT8_C( 120),  INT8_C(  25), -INT8_C(  32), -INT8_C(  78), -INT8_C(  68), -INT8_C(  94), -INT8_C(   3), -INT8_C(   9),
+        -INT8_C(  98), -INT8_C(  88), -INT8_C(  21), -INT8_C(  66),  INT8_C(   8), -INT8_C(  79),  INT8_C(  88),  INT8_C(  23),
+        -INT8_C(  45),  INT8_C(  71), -INT8_C(  65), -INT8_C(   2), -INT8_C(  10),  INT8_C(  83), -INT8_C(  54),  INT8_C( 110) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C( 116),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(  71),
+         INT8_C(   0), -INT8_C(  79),  INT8_C(  66), -INT8_C(  46),  INT8_C(   0), -INT8_C(  66),  INT8_C( 120),  INT8_C(  25),
+        -INT8_C(  32),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0), -INT8_C(  94),  INT8_C(   0),
+        -INT8_C(   3),  INT8_C(   0), -INT8_C(   9), -INT8_C(  98), -INT8_C(  88), -INT8_C(  21),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(  92288868),
+      { -INT8_C(  42),  INT8_C( 122),  INT8_C(  84),  INT8_C(  47), -INT8_C(  16), -INT8_C(  13),  INT8_C(  43), -INT8_C(  76),
+         INT8_C(  43), -INT8_C( 125), -INT8_C(  90),  INT8_C(  86),  INT8_C(  14), -INT8_C(  86), -INT8_C( 115),  INT8_C( 125),
+         INT8_C(  70),  INT8_C( 116),  INT8_C(  65),  INT8_C( 121), -INT8_C(  45),  INT8_C(  86),  INT8_C(  45),  INT8_C(  13),
+         INT8_C( 108), -INT8_C(  90),  INT8_C(  69), -INT8_C(  13),  INT8_C(  82), -INT8_C(  81), -INT8_C(  32),  INT8_C(  76) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  42),  INT8_C(   0),  INT8_C(   0),  INT8_C( 122),  INT8_C(  84),  INT8_C(   0),
+         INT8_C(  47), -INT8_C(  16), -INT8_C(  13),  INT8_C(   0),  INT8_C(  43), -INT8_C(  76),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43),
+        -INT8_C( 125),  INT8_C(   0), -INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3198667728),
+      { -INT8_C(  53), -INT8_C(  52),  INT8_C(  97),  INT8_C( 118), -INT8_C(  91), -INT8_C(  86), -INT8_C(  24), -INT8_C(  63),
+         INT8_C( 117),  INT8_C(  32), -INT8_C(  16),  INT8_C( 126),  INT8_C(  67),  INT8_C(  76), -INT8_C(  50), -INT8_C(  64),
+        -INT8_C(  29), -INT8_C(   2),  INT8_C( 125), -INT8_C( 126), -INT8_C(  77), -INT8_C(  19), -INT8_C(  62),  INT8_C(  76),
+         INT8_C(  18),  INT8_C(  90),  INT8_C( 103),  INT8_C(   1),  INT8_C(  75), -INT8_C(   3),  INT8_C(  56), -INT8_C( 124) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  53),  INT8_C(   0), -INT8_C(  52),  INT8_C(  97),
+         INT8_C( 118), -INT8_C(  91),  INT8_C(   0), -INT8_C(  86),  INT8_C(   0),  INT8_C(   0), -INT8_C(  24), -INT8_C(  63),
+         INT8_C( 117),  INT8_C(  32), -INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C( 126),  INT8_C(   0),  INT8_C(  67),
+         INT8_C(   0),  INT8_C(  76), -INT8_C(  50), -INT8_C(  64), -INT8_C(  29), -INT8_C(   2),  INT8_C(   0),  INT8_C( 125) } },
+    { UINT32_C(3209338216),
+      {  INT8_C(  22), -INT8_C(  80), -INT8_C( 111),  INT8_C(   9),  INT8_C(  83), -INT8_C(  78), -INT8_C(  76),  INT8_C(  33),
+         INT8_C(   4), -INT8_C(  86),  INT8_C(  64), -INT8_C(  35),  INT8_C(  96), -INT8_C(  49), -INT8_C(  80),  INT8_C(  97),
+        -INT8_C(  39),  INT8_C( 125),  INT8_C(  44),  INT8_C(  87), -INT8_C(  11),  INT8_C(  68), -INT8_C( 100),  INT8_C(  57),
+         INT8_C(  90),  INT8_C( 102),  INT8_C(  70),  INT8_C(  95), -INT8_C(  36), -INT8_C(  52),  INT8_C(  22),      INT8_MIN },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  22),  INT8_C(   0), -INT8_C(  80), -INT8_C( 111),  INT8_C(   0),
+         INT8_C(   9),  INT8_C(   0),  INT8_C(  83), -INT8_C(  78), -INT8_C(  76),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   0), -INT8_C(  86),  INT8_C(   0),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0),
+        -INT8_C(  35),  INT8_C(  96), -INT8_C(  49), -INT8_C(  80),  INT8_C(  97), -INT8_C(  39),  INT8_C(   0),  INT8_C( 125) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(  21),  INT8_C(  34), -INT8_C(  16),  INT8_C( 121), -INT8_C(  62), -INT8_C( 115), -INT8_C(  30),  INT8_C(   4),
+         INT8_C( 112), -INT8_C(  54), -INT8_C( 117), -INT8_C(  93),  INT8_C( 118), -INT8_C(  20), -INT8_C( 117),  INT8_C(  79),
+        -INT8_C(  68), -INT8_C(  32),  INT8_C(  17),  INT8_C(  40),  INT8_C(  62),  INT8_C(  13), -INT8_C( 109),  INT8_C(  25),
+         INT8_C(  61),  INT8_C(  14), -INT8_C(  32), -INT8_C(  55), -INT8_C(  32),  INT8_C( 118),  INT8_C(  69),  INT8_C(  29) },
+      UINT32_C(   4210691),
+      { -INT8_C( 115), -INT8_C(  51), -INT8_C(  94),  INT8_C(  30),  INT8_C(  81),  INT8_C( 106),  INT8_C(  47), -INT8_C( 105),
+        -INT8_C( 104),  INT8_C(  33),  INT8_C(  12),  INT8_C(  78),  INT8_C(  94),  INT8_C(   3),  INT8_C(  51),  INT8_C(  33),
+        -INT8_C(  95), -INT8_C( 103),  INT8_C(  26), -INT8_C(  47),  INT8_C(  33), -INT8_C( 100),  INT8_C( 126),  INT8_C(  52),
+        -INT8_C(  66), -INT8_C(  53),  INT8_C(  34), -INT8_C( 117),  INT8_C(  53), -INT8_C( 127),  INT8_C( 116),  INT8_C( 124) },
+      { -INT8_C( 115), -INT8_C(  51), -INT8_C(  16),  INT8_C( 121), -INT8_C(  62), -INT8_C( 115), -INT8_C(  30),  INT8_C(   4),
+         INT8_C( 112), -INT8_C(  54), -INT8_C( 117), -INT8_C(  93),  INT8_C( 118), -INT8_C(  20), -INT8_C(  94),  INT8_C(  79),
+        -INT8_C(  68), -INT8_C(  32),  INT8_C(  17),  INT8_C(  40),  INT8_C(  62),  INT8_C(  13),  INT8_C(  30),  INT8_C(  25),
+         INT8_C(  61),  INT8_C(  14), -INT8_C(  32), -INT8_C(  55), -INT8_C(  32),  INT8_C( 118),  INT8_C(  69),  INT8_C(  29) } },
+    { {  INT8_C(  75),  INT8_C(  74), -INT8_C(  38),  INT8_C(  30),  INT8_C(  25), -INT8_C( 122), -INT8_C(  55),      INT8_MIN,
+        -INT8_C(  18), -INT8_C(  40),  INT8_C(  29),  INT8_C(  92),  INT8_C(  78), -INT8_C( 124), -INT8_C(  43),  INT8_C( 122),
+        -INT8_C( 104),  INT8_C(  53),  INT8_C(  21), -INT8_C(  97), -INT8_C(  44), -INT8_C(   1),  INT8_C( 116),  INT8_C(  21),
+        -INT8_C(  18), -INT8_C(  36),  INT8_C( 105), -INT8_C( 100), -INT8_C(  62),  INT8_C(  66), -INT8_C(  61), -INT8_C(  79) },
+      UINT32_C( 323775256),
+      { -INT8_C(  61), -INT8_C(  79),  INT8_C(  97),  INT8_C(  34),  INT8_C( 114), -INT8_C(  83), -INT8_C(  39), -INT8_C(  31),
+        -INT8_C( 119), -INT8_C(  93), -INT8_C(  32),  INT8_C( 118), -INT8_C(  31),  INT8_C(  82),  INT8_C(  74),  INT8_C(  96),
+         INT8_C(  54), -INT8_C( 109), -INT8_C(  96), -INT8_C(  91), -INT8_C(  54), -INT8_C(  68),  INT8_C(  12), -INT8_C( 123),
+        -INT8_C(  93),      INT8_MAX, -INT8_C(  14),  INT8_C(  75),  INT8_C(  92), -INT8_C(  86), -INT8_C(  78), -INT8_C(  29) },
+      {  INT8_C(  75),  INT8_C(  74), -INT8_C(  38), -INT8_C(  61), -INT8_C(  79), -INT8_C( 122), -INT8_C(  55),      INT8_MIN,
+         INT8_C(  97),  INT8_C(  34),  INT8_C(  29),  INT8_C( 114),  INT8_C(  78), -INT8_C(  83), -INT8_C(  39),  INT8_C( 122),
+        -INT8_C( 104),  INT8_C(  53), -INT8_C(  31), -INT8_C( 119), -INT8_C(  44), -INT8_C(   1), -INT8_C(  93),  INT8_C(  21),
+        -INT8_C(  32),  INT8_C( 118),  INT8_C( 105), -INT8_C( 100), -INT8_C(  31),  INT8_C(  66), -INT8_C(  61), -INT8_C(  79) } },
+    { { -INT8_C( 114),  INT8_C( 103),  INT8_C(  32), -INT8_C(  10),  INT8_C(  49), -INT8_C( 105), -INT8_C( 105),  INT8_C( 124),
+        -INT8_C(  82), -INT8_C(   1), -INT8_C(  97), -INT8_C(  89),  INT8_C(  51),  INT8_C(  28), -INT8_C(  21),  INT8_C(  86),
+         INT8_C( 116),  INT8_C(  97), -INT8_C(  92),  INT8_C(  10),  INT8_C(  87), -INT8_C( 123), -INT8_C(  83), -INT8_C( 103),
+         INT8_C(  44),  INT8_C( 121), -INT8_C(  67),  INT8_C( 103), -INT8_C(  68),  INT8_C( 120), -INT8_C(  75), -INT8_C(  15) },
+      UINT32_C(2900025302),
+      {  INT8_C(  94),  INT8_C(  95), -INT8_C(  51),  INT8_C(  79),  INT8_C(  66), -INT8_C(  51), -INT8_C(  93), -INT8_C( 122),
+         INT8_C(  11),  INT8_C(  50),  INT8_C(  21), -INT8_C(  31),  INT8_C(  33), -INT8_C(  89), -INT8_C(  68),  INT8_C(  15),
+         INT8_C( 100),  INT8_C(  52),  INT8_C(  42),  INT8_C( 102),  INT8_C(  68),  INT8_C(  94), -INT8_C( 104), -INT8_C(  49),
+        -INT8_C(  65),  INT8_C( 103), -INT8_C(  43), -INT8_C(  43), -INT8_C(  33),  INT8_C(  59), -INT8_C(  33), -INT8_C( 112) },
+      { -INT8_C( 114),  INT8_C(  94),  INT8_C(  95), -INT8_C(  10), -INT8_C(  51), -INT8_C( 105),  INT8_C(  79),  INT8_C(  66),
+        -INT8_C(  51), -INT8_C(  93), -INT8_C( 122),  INT8_C(  11),  INT8_C(  50),  INT8_C(  28),  INT8_C(  21), -INT8_C(  31),
+         INT8_C( 116),  INT8_C(  33), -INT8_C(  92), -INT8_C(  89), -INT8_C(  68), -INT8_C( 123),  INT8_C(  15),  INT8_C( 100),
+         INT8_C(  44),  INT8_C( 121),  INT8_C(  52),  INT8_C(  42), -INT8_C(  68),  INT8_C( 102), -INT8_C(  75),  INT8_C(  68) } },
+    { { -INT8_C(  11),  INT8_C(  92), -INT8_C(  46), -INT8_C(  75),  INT8_C(  75),  INT8_C(  23),  INT8_C( 110), -INT8_C(   3),
+         INT8_C(  84),  INT8_C( 109), -INT8_C(  43),  INT8_C(  78), -INT8_C( 126), -INT8_C(   8),  INT8_C(  41),  INT8_C(  39),
+        -INT8_C(  69),  INT8_C(  71), -INT8_C(  90),  INT8_C(  12),  INT8_C(  19), -INT8_C(   4), -INT8_C(  29),  INT8_C( 101),
+         INT8_C(  73), -INT8_C(   1),  INT8_C( 118), -INT8_C(   7),  INT8_C( 103),  INT8_C(  14),  INT8_C(  36), -INT8_C( 109) },
+      UINT32_C(1844119529),
+      { -INT8_C( 121), -INT8_C( 119),  INT8_C(  75),  INT8_C(  43), -INT8_C(  55),  INT8_C(  32),  INT8_C( 107),  INT8_C(  97),
+         INT8_C(  98), -INT8_C( 120), -INT8_C(  82),  INT8_C(  46), -INT8_C(  90),  INT8_C( 105),  INT8_C(  77),  INT8_C( 108),
+         INT8_C(  14),  INT8_C(  22),      INT8_MIN,  INT8_C(  24), -INT8_C(  45),  INT8_C( 117),  INT8_C(  90), -INT8_C(  16),
+        -INT8_C(  55), -INT8_C( 114),  INT8_C(  36), -INT8_C(  22), -INT8_C(  21), -INT8_C(  33),  INT8_C(  50),  INT8_C(  30) },
+      { -INT8_C( 121),  INT8_C(  92), -INT8_C(  46), -INT8_C( 119),  INT8_C(  75),  INT8_C(  75),  INT8_C(  43), -INT8_C(  55),
+         INT8_C(  32),  INT8_C( 107),  INT8_C(  97),  INT8_C(  78), -INT8_C( 126), -INT8_C(   8),  INT8_C(  41),  INT8_C(  39),
+         INT8_C(  98), -INT8_C( 120), -INT8_C(  90), -INT8_C(  82),  INT8_C(  19),  INT8_C(  46), -INT8_C(  90),  INT8_C( 105),
+         INT8_C(  77), -INT8_C(   1),  INT8_C( 108),  INT8_C(  14),  INT8_C( 103),  INT8_C(  22),      INT8_MIN, -INT8_C( 109) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i r = simde_mm256_mask_expandloadu_epi8(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(2147551660),
+      {  INT8_C( 110), -INT8_C(  97), -INT8_C(  54), -INT8_C(  45), -INT8_C(  99), -INT8_C(  49),  INT8_C(  86), -INT8_C( 123),
+        -INT8_C(  69), -INT8_C(  62), -INT8_C(  57), -INT8_C(  86),  INT8_C(  61), -INT8_C( 104), -INT8_C(  17), -INT8_C(  19),
+        -INT8_C(  92), -INT8_C( 106), -INT8_C(  11), -INT8_C(  76),  INT8_C(   1),  INT8_C(   1),  INT8_C(  40), -INT8_C( 108),
+         INT8_C(  69),  INT8_C(   5), -INT8_C( 116), -INT8_C(  83),  INT8_C(  12),  INT8_C( 107),  INT8_C( 109),  INT8_C(  97) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C( 110), -INT8_C(  97),  INT8_C(   0), -INT8_C(  54),  INT8_C(   0), -INT8_C(  45),
+        -INT8_C(  99),  INT8_C(   0),  INT8_C(   0), -INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  86),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 123) } },
+    { UINT32_C(2190527845),
+      { -INT8_C(  86), -INT8_C( 112),  INT8_C(  93), -INT8_C(  97), -INT8_C(  91),  INT8_C(  34), -INT8_C(   1),  INT8_C(   1),
+         INT8_C(  73), -INT8_C(  48),  INT8_C( 120), -INT8_C( 126),  INT8_C(  65),  INT8_C(  43), -INT8_C(  58), -INT8_C(  99),
+        -INT8_C(  27), -INT8_C( 113), -INT8_C(  50),  INT8_C(  51),  INT8_C( 103), -INT8_C(   4), -INT8_C(  34), -INT8_C(   9),
+         INT8_C( 123),  INT8_C(  65), -INT8_C(  22),  INT8_C(  84),  INT8_C(  68),  INT8_C(  31), -INT8_C( 115),  INT8_C(   9) },
+      { -INT8_C(  86),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(  93), -INT8_C(  97),  INT8_C(   0),
+        -INT8_C(  91),  INT8_C(   0),  INT8_C(  34), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(  73),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C( 120),
+         INT8_C(   0), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65) } },
+    { UINT32_C(3697283460),
+      { -INT8_C(  80), -INT8_C(  35), -INT8_C(  91), -INT8_C( 124), -INT8_C(  37),  INT8_C(  52), -INT8_C(   8),  INT8_C(  78),
+        -INT8_C(  38), -INT8_C(  19), -INT8_C(  77), -INT8_C( 121), -INT8_C(  21),  INT8_C(  23),  INT8_C( 105), -INT8_C(  44),
+         INT8_C(  14), -INT8_C(  25),  INT8_C(  71), -INT8_C( 107),  INT8_C(  45),  INT8_C(  84),  INT8_C(  60),  INT8_C(  74),
+        -INT8_C(  62),  INT8_C(  70),  INT8_C(  33), -INT8_C( 121), -INT8_C( 109),  INT8_C( 108),  INT8_C(  33),  INT8_C( 105) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  35),
+        -INT8_C(  91),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  37),  INT8_C(  52),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   8),  INT8_C(  78), -INT8_C(  38),  INT8_C(   0), -INT8_C(  19), -INT8_C(  77) } },
+    { UINT32_C(   2099968),
+      {  INT8_C( 111), -INT8_C(  36), -INT8_C(  48), -INT8_C( 107),  INT8_C(  76),  INT8_C(  32),  INT8_C(  75),  INT8_C(  41),
+        -INT8_C(  31), -INT8_C(  93), -INT8_C(   6),  INT8_C(  90), -INT8_C(  37), -INT8_C(  59),  INT8_C( 125), -INT8_C(  17),
+         INT8_C(  78),  INT8_C(  85),  INT8_C(  18), -INT8_C(   8), -INT8_C(  61), -INT8_C(  89), -INT8_C( 126),  INT8_C(   0),
+         INT8_C( 111), -INT8_C( 127), -INT8_C( 122), -INT8_C(  57), -INT8_C(  38),  INT8_C(  93), -INT8_C(  80),  INT8_C(  79) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 111), -INT8_C(  36),  INT8_C(   0), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi8(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { -INT16_C(  5784),  INT16_C(   836),  INT16_C( 14574), -INT16_C( 11302), -INT16_C( 25456), -INT16_C( 11436), -INT16_C( 21896), -INT16_C( 18412),
+        -INT16_C( 32195),  INT16_C( 27023), -INT16_C(  6543), -INT16_C( 28641),  INT16_C( 22580), -INT16_C( 20275),  INT16_C( 26263),  INT16_C( 22837) },
+      UINT16_C(49927),
+      {  INT16_C( 11385),  INT16_C(  6719), -INT16_C( 22171), -INT16_C(  6810),  INT16_C( 16363),  INT16_C( 24645),  INT16_C( 13720), -INT16_C( 16098),
+         INT16_C( 15827),  INT16_C( 26719), -INT16_C( 23908),  INT16_C(  5749),  INT16_C(  2833), -INT16_C( 10542),  INT16_C(  1413),  INT16_C(  2073) },
+      {  INT16_C( 11385),  INT16_C(  6719), -INT16_C( 22171), -INT16_C( 11302), -INT16_C( 25456), -INT16_C( 11436), -INT16_C( 21896), -INT16_C( 18412),
+        -INT16_C(  6810),  INT16_C( 16363), -INT16_C(  6543), -INT16_C( 28641),  INT16_C( 22580), -INT16_C( 20275),  INT16_C( 24645),  INT16_C( 13720) } },
+    { { -INT16_C(  8394), -INT16_C( 15346),  INT16_C( 24069), -INT16_C(  1418),  INT16_C(  1876),  INT16_C(  8987),  INT16_C( 26268), -INT16_C( 20399),
+         INT16_C( 25990), -INT16_C(    81),  INT16_C( 10103),  INT16_C( 20908),  INT16_C( 11305), -INT16_C(  6932),  INT16_C( 30964),  INT16_C( 18238) },
+      UINT16_C(51005),
+      { -INT16_C( 26051),  INT16_C(   746),  INT16_C( 26502), -INT16_C( 18974), -INT16_C( 27543), -INT16_C(  5715), -INT16_C(  7114), -INT16_C( 17694),
+        -INT16_C( 31783), -INT16_C( 27037), -INT16_C(  7041),  INT16_C( 32248),  INT16_C( 28028),  INT16_C( 23043), -INT16_C( 23802),  INT16_C( 26589) },
+      { -INT16_C( 26051), -INT16_C( 15346),  INT16_C(   746),  INT16_C( 26502), -INT16_C( 18974), -INT16_C( 27543),  INT16_C( 26268), -INT16_C( 20399),
+        -INT16_C(  5715), -INT16_C(  7114), -INT16_C( 17694),  INT16_C( 20908),  INT16_C( 11305), -INT16_C(  6932), -INT16_C( 31783), -INT16_C( 27037) } },
+    { { -INT16_C( 31216),  INT16_C( 22746),  INT16_C(  8984), -INT16_C( 10660), -INT16_C(  5728),  INT16_C( 23368), -INT16_C( 30118), -INT16_C(  3706),
+         INT16_C( 15149),  INT16_C( 26872),  INT16_C(  2336), -INT16_C( 24702), -INT16_C(  2602),  INT16_C(  2729),  INT16_C(  7985), -INT16_C( 22326) },
+      UINT16_C( 4701),
+      { -INT16_C( 22370),  INT16_C(  6489), -INT16_C( 21476),  INT16_C(  9470),  INT16_C( 31517),  INT16_C( 12537), -INT16_C( 18799),  INT16_C( 19365),
+        -INT16_C(  3390),  INT16_C( 11914), -INT16_C( 21937), -INT16_C( 31604), -INT16_C( 29130),  INT16_C( 15847),  INT16_C(  7088),  INT16_C( 14139) },
+      { -INT16_C( 22370),  INT16_C( 22746),  INT16_C(  6489), -INT16_C( 21476),  INT16_C(  9470),  INT16_C( 23368),  INT16_C( 31517), -INT16_C(  3706),
+         INT16_C( 15149),  INT16_C( 12537),  INT16_C(  2336), -INT16_C( 24702), -INT16_C( 18799),  INT16_C(  2729),  INT16_C(  7985), -INT16_C( 22326) } },
+    { { -INT16_C( 10428), -INT16_C( 19200),  INT16_C(  6933),  INT16_C( 23656), -INT16_C( 10657),  INT16_C( 13867), -INT16_C( 16656),  INT16_C( 14052),
+         INT16_C( 18695),  INT16_C(  3179), -INT16_C( 22899), -INT16_C(  7283), -INT16_C( 21632), -INT16_C(  7109),  INT16_C( 29016),  INT16_C( 14171) },
+      UINT16_C(38177),
+      { -INT16_C(  9239),  INT16_C( 31575),  INT16_C(  8797),  INT16_C( 20352), -INT16_C( 21161), -INT16_C( 18316), -INT16_C(  5743),  INT16_C(  2995),
+         INT16_C(  8279), -INT16_C( 32116), -INT16_C( 31707), -INT16_C(  6748),  INT16_C(  4199),  INT16_C( 25060),  INT16_C( 12955), -INT16_C(  5667) },
+      { -INT16_C(  9239), -INT16_C( 19200),  INT16_C(  6933),  INT16_C( 23656), -INT16_C( 10657),  INT16_C( 31575), -INT16_C( 16656),  INT16_C( 14052),
+         INT16_C(  8797),  INT16_C(  3179),  INT16_C( 20352), -INT16_C(  7283), -INT16_C( 21161), -INT16_C(  7109),  INT16_C( 29016), -INT16_C( 18316) } },
+    { { -INT16_C(  1841),  INT16_C(  1451), -INT16_C( 29249), -INT16_C( 26552),  INT16_C( 15760),  INT16_C(  1416), -INT16_C( 26109),  INT16_C( 20583),
+         INT16_C( 11596),  INT16_C(  3446), -INT16_C(   901),  INT16_C( 21225),  INT16_C( 25515),  INT16_C( 12231), -INT16_C( 18359), -INT16_C( 19484) },
+      UINT16_C(25583),
+      { -INT16_C(  6951),  INT16_C( 14688), -INT16_C( 10372),  INT16_C( 23407), -INT16_C(  8170),  INT16_C( 21616), -INT16_C( 29605), -INT16_C( 31064),
+         INT16_C( 30979), -INT16_C( 18946),  INT16_C( 26787), -INT16_C(  3386),  INT16_C( 31200), -INT16_C(  7800),  INT16_C( 16868),  INT16_C(  7427) },
+      { -INT16_C(  6951),  INT16_C( 14688), -INT16_C( 10372),  INT16_C( 23407),  INT16_C( 15760), -INT16_C(  8170),  INT16_C( 21616), -INT16_C( 29605),
+        -INT16_C( 31064),  INT16_C( 30979), -INT16_C(   901),  INT16_C( 21225),  INT16_C( 25515), -INT16_C( 18946),  INT16_C( 26787), -INT16_C( 19484) } },
+    { { -INT16_C( 10425), -INT16_C( 25358),  INT16_C(  6062), -INT16_C( 11183),  INT16_C(  2280),  INT16_C(  2505), -INT16_C( 16694),  INT16_C( 23267),
+        -INT16_C( 17746), -INT16_C( 10761), -INT16_C( 30885), -INT16_C( 23029),  INT16_C(  6737), -INT16_C( 32158),  INT16_C( 12265), -INT16_C( 10997) },
+      UINT16_C(63775),
+      { -INT16_C( 27189),  INT16_C(  7545), -INT16_C(  5904), -INT16_C( 18040),  INT16_C( 29032), -INT16_C(  1997),  INT16_C( 11184), -INT16_C(  2162),
+        -INT16_C( 18501),  INT16_C( 10705), -INT16_C( 14273),  INT16_C( 10691), -INT16_C( 29804),  INT16_C( 19857),  INT16_C( 13239),  INT16_C( 25934) },
+      { -INT16_C( 27189),  INT16_C(  7545), -INT16_C(  5904), -INT16_C( 18040),  INT16_C( 29032),  INT16_C(  2505), -INT16_C( 16694),  INT16_C( 23267),
+        -INT16_C(  1997), -INT16_C( 10761), -INT16_C( 30885),  INT16_C( 11184), -INT16_C(  2162), -INT16_C( 18501),  INT16_C( 10705), -INT16_C( 14273) } },
+    { { -INT16_C( 12961), -INT16_C(  6476), -INT16_C( 25087),  INT16_C( 14394), -INT16_C(  8775),  INT16_C( 19141),  INT16_C( 10084), -INT16_C(   167),
+        -INT16_C(   900), -INT16_C(   334),  INT16_C( 13539), -INT16_C( 13330), -INT16_C(  5690),  INT16_C( 28292),  INT16_C( 25354),  INT16_C( 11349) },
+      UINT16_C(  260),
+      { -INT16_C( 14096),  INT16_C( 17575), -INT16_C( 27124),  INT16_C( 26281),  INT16_C( 21944),  INT16_C(  6628),  INT16_C(  4504), -INT16_C( 20636),
+         INT16_C( 24199),  INT16_C(  8291), -INT16_C( 31612),  INT16_C( 27248),  INT16_C( 22195), -INT16_C( 30010), -INT16_C(  2801),  INT16_C( 28785) },
+      { -INT16_C( 12961), -INT16_C(  6476), -INT16_C( 14096),  INT16_C( 14394), -INT16_C(  8775),  INT16_C( 19141),  INT16_C( 10084), -INT16_C(   167),
+         INT16_C( 17575), -INT16_C(   334),  INT16_C( 13539), -INT16_C( 13330), -INT16_C(  5690),  INT16_C( 28292),  INT16_C( 25354),  INT16_C( 11349) } },
+    { {  INT16_C( 12742), -INT16_C(  9203), -INT16_C( 15478),  INT16_C( 11805), -INT16_C(  2636), -INT16_C(  5008), -INT16_C( 15624),  INT16_C(  6485),
+         INT16_C( 21046),  INT16_C( 14997),  INT16_C(  4408), -INT16_C(  5310), -INT16_C( 10685), -INT16_C(  4438), -INT16_C( 23446),  INT16_C( 29473) },
+      UINT16_C( 6615),
+      {  INT16_C( 24922),  INT16_C( 10182),  INT16_C(  5325), -INT16_C( 14754), -INT16_C(  9966),  INT16_C( 22590),  INT16_C( 32219),  INT16_C( 18842),
+         INT16_C( 11243), -INT16_C( 16435), -INT16_C( 29604),  INT16_C( 24188),  INT16_C(  9635), -INT16_C( 18050),  INT16_C( 13037),  INT16_C( 11747) },
+      {  INT16_C( 24922),  INT16_C( 10182),  INT16_C(  5325),  INT16_C( 11805), -INT16_C( 14754), -INT16_C(  5008), -INT16_C(  9966),  INT16_C( 22590),
+         INT16_C( 32219),  INT16_C( 14997),  INT16_C(  4408),  INT16_C( 18842),  INT16_C( 11243), -INT16_C(  4438), -INT16_C( 23446),  INT16_C( 29473) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(34701),
+      { -INT16_C( 20148), -INT16_C( 18535), -INT16_C( 18239),  INT16_C( 31014),  INT16_C(  8891), -INT16_C(  9338), -INT16_C( 14885), -INT16_C(  3979),
+        -INT16_C( 27230),  INT16_C(  7440), -INT16_C( 27222),  INT16_C( 17791), -INT16_C( 30242), -INT16_C( 28451),  INT16_C(  4495),  INT16_C( 21719) },
+      { -INT16_C( 20148),  INT16_C(     0), -INT16_C( 18535), -INT16_C( 18239),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 31014),
+         INT16_C(  8891), -INT16_C(  9338), -INT16_C( 14885),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3979) } },
+    { UINT16_C(36140),
+      {  INT16_C( 14801),  INT16_C(  7466), -INT16_C( 24284), -INT16_C(  3322), -INT16_C( 11683),  INT16_C( 27977), -INT16_C(  1032),  INT16_C( 20599),
+         INT16_C( 11443), -INT16_C(  2273), -INT16_C( 24990),  INT16_C( 12095), -INT16_C( 25105),  INT16_C( 16874), -INT16_C( 12473), -INT16_C( 15926) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 14801),  INT16_C(  7466),  INT16_C(     0), -INT16_C( 24284),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  3322),  INT16_C(     0), -INT16_C( 11683),  INT16_C( 27977),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1032) } },
+    { UINT16_C(33090),
+      {  INT16_C( 26141), -INT16_C( 23139), -INT16_C( 21252),  INT16_C( 22949), -INT16_C( 28295), -INT16_C( 17810),  INT16_C( 19123),  INT16_C(  3815),
+         INT16_C( 15632), -INT16_C( 26181),  INT16_C( 32458), -INT16_C( 14713), -INT16_C( 17981),  INT16_C( 32611), -INT16_C( 20223), -INT16_C( 24423) },
+      {  INT16_C(     0),  INT16_C( 26141),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 23139),  INT16_C(     0),
+        -INT16_C( 21252),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22949) } },
+    { UINT16_C(37189),
+      { -INT16_C( 14406),  INT16_C(  9167),  INT16_C(   616), -INT16_C(  1733), -INT16_C( 10249),  INT16_C( 25921),  INT16_C(  8007), -INT16_C( 14487),
+        -INT16_C( 14470),  INT16_C( 31975), -INT16_C(  5707),  INT16_C( 15404), -INT16_C( 27091),  INT16_C( 30466), -INT16_C( 32186), -INT16_C(  5708) },
+      { -INT16_C( 14406),  INT16_C(     0),  INT16_C(  9167),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   616),  INT16_C(     0),
+        -INT16_C(  1733),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10249),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25921) } },
+    { UINT16_C(46594),
+      {  INT16_C( 26308),  INT16_C( 14101), -INT16_C( 15975),  INT16_C(  8646), -INT16_C( 12019),  INT16_C( 27596), -INT16_C( 26353),  INT16_C( 11695),
+         INT16_C(  2322), -INT16_C(  1312),  INT16_C( 16463),  INT16_C( 11675), -INT16_C( 28737),  INT16_C( 24098),  INT16_C( 13620), -INT16_C(  3294) },
+      {  INT16_C(     0),  INT16_C( 26308),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 14101), -INT16_C( 15975),  INT16_C(     0),  INT16_C(  8646), -INT16_C( 12019),  INT16_C(     0),  INT16_C( 27596) } },
+    { UINT16_C( 7687),
+      {  INT16_C( 15223),  INT16_C( 10160),  INT16_C( 13693),  INT16_C( 25171), -INT16_C( 11152), -INT16_C( 11210), -INT16_C( 16979), -INT16_C( 18929),
+        -INT16_C( 23908), -INT16_C(  7674), -INT16_C(  3245),  INT16_C(   749),  INT16_C( 10514),  INT16_C( 12564), -INT16_C( 23357),  INT16_C( 17620) },
+      {  INT16_C( 15223),  INT16_C( 10160),  INT16_C( 13693),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 25171), -INT16_C( 11152), -INT16_C( 11210), -INT16_C( 16979),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(17261),
+      { -INT16_C( 10109),  INT16_C(  9810), -INT16_C( 11610), -INT16_C(  8875), -INT16_C(  9312),  INT16_C( 14113),  INT16_C( 24301), -INT16_C( 24521),
+        -INT16_C( 13330), -INT16_C( 26348),  INT16_C( 25278), -INT16_C( 22367),  INT16_C( 25798), -INT16_C( 27157), -INT16_C( 16219), -INT16_C( 10464) },
+      { -INT16_C( 10109),  INT16_C(     0),  INT16_C(  9810), -INT16_C( 11610),  INT16_C(     0), -INT16_C(  8875), -INT16_C(  9312),  INT16_C(     0),
+         INT16_C( 14113),  INT16_C( 24301),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 24521),  INT16_C(     0) } },
+    { UINT16_C( 9264),
+      { -INT16_C( 20304),  INT16_C(  4485), -INT16_C(  6985),  INT16_C(   818), -INT16_C(  3749),  INT16_C( 22873), -INT16_C(  7880),  INT16_C( 31761),
+         INT16_C( 16100),  INT16_C( 26920),  INT16_C(  5153),  INT16_C( 29772),  INT16_C( 20733),  INT16_C( 26698),  INT16_C( 25483),  INT16_C( 30349) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20304),  INT16_C(  4485),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(  6985),  INT16_C(     0),  INT16_C(     0),  INT16_C(   818),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C(  5091),  INT16_C(  2097),  INT16_C( 13648), -INT16_C( 20323),  INT16_C( 30899),  INT16_C(  7707), -INT16_C( 13918), -INT16_C( 23799),
+         INT16_C(  3198), -INT16_C(  8074),  INT16_C( 28022), -INT16_C(  6057), -INT16_C( 19306), -INT16_C(  6787), -INT16_C( 17819),  INT16_C( 27064) },
+      UINT16_C(17998),
+      {  INT16_C( 32652), -INT16_C(  5953),  INT16_C(  7415),  INT16_C( 14164),  INT16_C(  4697),  INT16_C(  8484), -INT16_C( 12789),  INT16_C( 27364),
+        -INT16_C(  9390), -INT16_C( 20922), -INT16_C( 15100), -INT16_C( 21950),  INT16_C(  4598),  INT16_C( 13247), -INT16_C( 23703),  INT16_C( 17610) },
+      {  INT16_C(  5091),  INT16_C( 32652), -INT16_C(  5953),  INT16_C(  7415),  INT16_C( 30899),  INT16_C(  7707),  INT16_C( 14164), -INT16_C( 23799),
+         INT16_C(  3198),  INT16_C(  4697),  INT16_C(  8484), -INT16_C(  6057), -INT16_C( 19306), -INT16_C(  6787), -INT16_C( 12789),  INT16_C( 27064) } },
+    { { -INT16_C( 19088),  INT16_C( 28987), -INT16_C( 24770),  INT16_C(   839), -INT16_C( 18907),  INT16_C( 31482),  INT16_C(  9492), -INT16_C( 24798),
+         INT16_C( 14230),  INT16_C( 18748), -INT16_C( 16234),  INT16_C( 18769), -INT16_C( 22090),  INT16_C( 18591),  INT16_C(  6089), -INT16_C(  6615) },
+      UINT16_C(42660),
+      {  INT16_C( 28369),  INT16_C(  8624), -INT16_C(  2776), -INT16_C(  4901),  INT16_C( 17067),  INT16_C( 15880), -INT16_C( 27523),  INT16_C( 20886),
+        -INT16_C(  1623),  INT16_C( 13063),  INT16_C(  8212),  INT16_C(  2954), -INT16_C( 13669), -INT16_C(  8437),  INT16_C( 29369),  INT16_C( 25376) },
+      { -INT16_C( 19088),  INT16_C( 28987),  INT16_C( 28369),  INT16_C(   839), -INT16_C( 18907),  INT16_C(  8624),  INT16_C(  9492), -INT16_C(  2776),
+         INT16_C( 14230), -INT16_C(  4901),  INT16_C( 17067),  INT16_C( 18769), -INT16_C( 22090),  INT16_C( 15880),  INT16_C(  6089), -INT16_C( 27523) } },
+    { {  INT16_C( 20115),  INT16_C( 29033),  INT16_C(  5657),  INT16_C( 31822), -INT16_C(  6369), -INT16_C( 10196), -INT16_C( 25006), -INT16_C(  7700),
+        -INT16_C( 25509),  INT16_C( 22982),  INT16_C( 19597),  INT16_C( 10810),  INT16_C( 18519),  INT16_C(  9404),  INT16_C(  2575), -INT16_C(  2370) },
+      UINT16_C(16384),
+      { -INT16_C( 25272),  INT16_C( 27422), -INT16_C( 10357),  INT16_C( 14162),  INT16_C(  1268), -INT16_C( 31679),  INT16_C(  5039), -INT16_C(  8290),
+         INT16_C(  8535), -INT16_C( 14438), -INT16_C( 27901),  INT16_C( 24593), -INT16_C(  4886), -INT16_C( 30010),  INT16_C(  7411),  INT16_C( 26756) },
+      {  INT16_C( 20115),  INT16_C( 29033),  INT16_C(  5657),  INT16_C( 31822), -INT16_C(  6369), -INT16_C( 10196), -INT16_C( 25006), -INT16_C(  7700),
+        -INT16_C( 25509),  INT16_C( 22982),  INT16_C( 19597),  INT16_C( 10810),  INT16_C( 18519),  INT16_C(  9404), -INT16_C( 25272), -INT16_C(  2370) } },
+    { { -INT16_C( 15613),  INT16_C( 31201),  INT16_C( 23788),  INT16_C(  3224), -INT16_C( 13690),  INT16_C( 18864),  INT16_C(   104), -INT16_C(   220),
+         INT16_C( 24576),  INT16_C( 28663), -INT16_C(  4158), -INT16_C( 25107),  INT16_C( 27053), -INT16_C( 25838),  INT16_C(  6498), -INT16_C( 14050) },
+      UINT16_C(46391),
+      { -INT16_C( 12660),  INT16_C(  2398),  INT16_C( 24401), -INT16_C(  6910), -INT16_C(  5673), -INT16_C( 19857),  INT16_C(  2592),  INT16_C(  3687),
+        -INT16_C( 27559), -INT16_C( 26734),  INT16_C( 12847),  INT16_C( 14653),  INT16_C(  6056),  INT16_C( 24022), -INT16_C( 32631),  INT16_C(  3141) },
+      { -INT16_C( 12660),  INT16_C(  2398),  INT16_C( 24401),  INT16_C(  3224), -INT16_C(  6910), -INT16_C(  5673),  INT16_C(   104), -INT16_C(   220),
+        -INT16_C( 19857),  INT16_C( 28663),  INT16_C(  2592), -INT16_C( 25107),  INT16_C(  3687), -INT16_C( 27559),  INT16_C(  6498), -INT16_C( 26734) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i r = simde_mm256_mask_expandloadu_epi16(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(  512),
+      {  INT16_C( 20254),  INT16_C(  9057), -INT16_C(  6010),  INT16_C(  5858),  INT16_C(  2557), -INT16_C( 24504),  INT16_C( 28551),  INT16_C( 16279),
+         INT16_C( 24158),  INT16_C(  3481), -INT16_C( 23120), -INT16_C( 21452),  INT16_C( 17788), -INT16_C( 25605),  INT16_C( 31881),  INT16_C(  3721) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 20254),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(21479),
+      {  INT16_C( 17084), -INT16_C(  2699), -INT16_C( 29625),  INT16_C( 29302),  INT16_C(   923),  INT16_C( 23066), -INT16_C(  1427),  INT16_C( 16827),
+         INT16_C( 12935),  INT16_C( 19144),  INT16_C( 18126),  INT16_C( 21696),  INT16_C( 19112),  INT16_C( 16661),  INT16_C( 22719), -INT16_C( 10537) },
+      {  INT16_C( 17084), -INT16_C(  2699), -INT16_C( 29625),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29302),  INT16_C(   923),  INT16_C( 23066),
+        -INT16_C(  1427),  INT16_C( 16827),  INT16_C(     0),  INT16_C(     0),  INT16_C( 12935),  INT16_C(     0),  INT16_C( 19144),  INT16_C(     0) } },
+    { UINT16_C(31204),
+      {  INT16_C( 10274), -INT16_C( 26928),  INT16_C(  6733),  INT16_C( 10906),  INT16_C(  8022), -INT16_C( 25836), -INT16_C(  6310), -INT16_C( 13349),
+        -INT16_C(  1382), -INT16_C( 14279), -INT16_C( 20645),  INT16_C( 31946), -INT16_C( 13585),  INT16_C( 16585),  INT16_C( 19383), -INT16_C(  2435) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 10274),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26928),  INT16_C(  6733),  INT16_C( 10906),
+         INT16_C(  8022),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25836), -INT16_C(  6310), -INT16_C( 13349), -INT16_C(  1382),  INT16_C(     0) } },
+    { UINT16_C(16392),
+      {  INT16_C(  3096),  INT16_C(  3573),  INT16_C( 31411),  INT16_C( 29668),  INT16_C( 32276), -INT16_C(  3490),  INT16_C( 21801), -INT16_C(  7942),
+         INT16_C( 21274),  INT16_C( 15213),  INT16_C( 26780),  INT16_C(  3961), -INT16_C(  1051),  INT16_C( 12435), -INT16_C(  9557), -INT16_C( 17770) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3096),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3573),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi16(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1098078127), -INT32_C(  2016599005),  INT32_C(   218072273), -INT32_C(   971792376), -INT32_C(   578038690), -INT32_C(   497304207),  INT32_C(  1918849097), -INT32_C(    60802990) },
+      UINT8_C(163),
+      {  INT32_C(   357909213), -INT32_C(   352653327), -INT32_C(  1851157409),  INT32_C(  1005267280), -INT32_C(  1847586028),  INT32_C(  1041526479),  INT32_C(  1340942427),  INT32_C(  1333574019) },
+      {  INT32_C(   357909213), -INT32_C(   352653327),  INT32_C(   218072273), -INT32_C(   971792376), -INT32_C(   578038690), -INT32_C(  1851157409),  INT32_C(  1918849097),  INT32_C(  1005267280) } },
+    { {  INT32_C(   114556512),  INT32_C(  1068863267),  INT32_C(  1290470849), -INT32_C(   146348761),  INT32_C(  1075505045), -INT32_C(  1948247075), -INT32_C(  1883988137), -INT32_C(  1070124084) },
+      UINT8_C( 56),
+      { -INT32_C(    13696127), -INT32_C(   944394725),  INT32_C(  1043172144), -INT32_C(   697879278), -INT32_C(  1379405716),  INT32_C(   358649575), -INT32_C(   131730943),  INT32_C(  1914514716) },
+      {  INT32_C(   114556512),  INT32_C(  1068863267),  INT32_C(  1290470849), -INT32_C(    13696127), -INT32_C(   944394725),  INT32_C(  1043172144), -INT32_C(  1883988137), -INT32_C(  1070124084) } },
+    { { -INT32_C(   582706985),  INT32_C(  1939861906), -INT32_C(  1498577647), -INT32_C(  1651927806), -INT32_C(   114981747),  INT32_C(  1565767928), -INT32_C(  1580343984), -INT32_C(   962797641) },
+      UINT8_C(141),
+      { -INT32_C(   270275096),  INT32_C(   823872436),  INT32_C(   988512447), -INT32_C(  1313225757),  INT32_C(    22998037),  INT32_C(   690619174), -INT32_C(   730975645), -INT32_C(  1934226559) },
+      { -INT32_C(   270275096),  INT32_C(  1939861906),  INT32_C(   823872436),  INT32_C(   988512447), -INT32_C(   114981747),  INT32_C(  1565767928), -INT32_C(  1580343984), -INT32_C(  1313225757) } },
+    { {  INT32_C(   524321441), -INT32_C(   541189088),  INT32_C(   928729963), -INT32_C(   804817071),  INT32_C(    21237811),  INT32_C(  1155516580),  INT32_C(   230721897),  INT32_C(  1206611735) },
+      UINT8_C(214),
+      { -INT32_C(  1057132619),  INT32_C(   646823625),  INT32_C(   819535933),  INT32_C(   754013295), -INT32_C(   432986454),  INT32_C(   323291972), -INT32_C(   287065706),  INT32_C(   390486178) },
+      {  INT32_C(   524321441), -INT32_C(  1057132619),  INT32_C(   646823625), -INT32_C(   804817071),  INT32_C(   819535933),  INT32_C(  1155516580),  INT32_C(   754013295), -INT32_C(   432986454) } },
+    { {  INT32_C(   942937511), -INT32_C(  1271897014), -INT32_C(  2097212588),  INT32_C(  2041988482),  INT32_C(   333473248),  INT32_C(   749442207), -INT32_C(   916388428), -INT32_C(   500316765) },
+      UINT8_C(192),
+      { -INT32_C(  1916003365), -INT32_C(  1451276177),  INT32_C(  1815272641),  INT32_C(   306214344), -INT32_C(   725731466), -INT32_C(  1230327534), -INT32_C(   378238675), -INT32_C(  1215135037) },
+      {  INT32_C(   942937511), -INT32_C(  1271897014), -INT32_C(  2097212588),  INT32_C(  2041988482),  INT32_C(   333473248),  INT32_C(   749442207), -INT32_C(  1916003365), -INT32_C(  1451276177) } },
+    { { -INT32_C(  1935223435),  INT32_C(  1263098070),  INT32_C(   189376723), -INT32_C(  1341790954),  INT32_C(   853124452), -INT32_C(  2104690322),  INT32_C(  1374791485), -INT32_C(   647380922) },
+      UINT8_C(160),
+      { -INT32_C(  2120576972),  INT32_C(  2064594185),  INT32_C(  1892207047), -INT32_C(   843005354),  INT32_C(   672604434), -INT32_C(   388147256),  INT32_C(  1911343857),  INT32_C(  1141833172) },
+      { -INT32_C(  1935223435),  INT32_C(  1263098070),  INT32_C(   189376723), -INT32_C(  1341790954),  INT32_C(   853124452), -INT32_C(  2120576972),  INT32_C(  1374791485),  INT32_C(  2064594185) } },
+    { {  INT32_C(    53586049), -INT32_C(  1041230216), -INT32_C(  1628092886),  INT32_C(   892383120), -INT32_C(  1322234920), -INT32_C(   976134192), -INT32_C(  1819312159), -INT32_C(   477402935) },
+      UINT8_C(  7),
+      { -INT32_C(  2126145423),  INT32_C(   668163891), -INT32_C(   474213957),  INT32_C(   555144334), -INT32_C(  1498006172), -INT32_C(   819128498), -INT32_C(   969652746),  INT32_C(  1774054216) },
+      { -INT32_C(  2126145423),  INT32_C(   668163891), -INT32_C(   474213957),  INT32_C(   892383120), -INT32_C(  1322234920), -INT32_C(   976134192), -INT32_C(  1819312159), -INT32_C(   477402935) } },
+    { {  INT32_C(   461458830),  INT32_C(   320340107), -INT32_C(   166763056),  INT32_C(  1845969663),  INT32_C(   926867394),  INT32_C(  2033355589), -INT32_C(  1285903875),  INT32_C(  1961137514) },
+      UINT8_C(209),
+      {  INT32_C(  2064815225),  INT32_C(   537238909),  INT32_C(   499568040), -INT32_C(  1407351896),  INT32_C(     7406973), -INT32_C(  1268941968),  INT32_C(  1116217398),  INT32_C(  1525515741) },
+      {  INT32_C(  2064815225),  INT32_C(   320340107), -INT32_C(   166763056),  INT32_C(  1845969663),  INT32_C(   537238909),  INT32_C(  2033355589),  INT32_C(   499568040), -INT32_C(  1407351896) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(208),
+      { -INT32_C(  1473086135), -INT32_C(  1550214926), -INT32_C(  1205384893),  INT32_C(  1305437035), -INT32_C(  1218938249),  INT32_C(   520271435),  INT32_C(   909135187),  INT32_C(   301260291) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1473086135),  INT32_C(           0), -INT32_C(  1550214926), -INT32_C(  1205384893) } },
+    { UINT8_C(171),
+      { -INT32_C(  1967029247), -INT32_C(  1404964426), -INT32_C(  1957934243),  INT32_C(   715807776),  INT32_C(   784843628),  INT32_C(  1510320281),  INT32_C(  1546909155), -INT32_C(  1968039584) },
+      { -INT32_C(  1967029247), -INT32_C(  1404964426),  INT32_C(           0), -INT32_C(  1957934243),  INT32_C(           0),  INT32_C(   715807776),  INT32_C(           0),  INT32_C(   784843628) } },
+    { UINT8_C(176),
+      { -INT32_C(  1783005797),  INT32_C(  1352941076),  INT32_C(  1477487954),  INT32_C(  1798149033), -INT32_C(  1675446756), -INT32_C(  1553859725), -INT32_C(   698335315),  INT32_C(   341798340) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1783005797),  INT32_C(  1352941076),  INT32_C(           0),  INT32_C(  1477487954) } },
+    { UINT8_C( 77),
+      { -INT32_C(   975089241), -INT32_C(  1279266903), -INT32_C(   289865682), -INT32_C(   284757353), -INT32_C(  1358889909),  INT32_C(  1386599350),  INT32_C(  1683651489),  INT32_C(   109195533) },
+      { -INT32_C(   975089241),  INT32_C(           0), -INT32_C(  1279266903), -INT32_C(   289865682),  INT32_C(           0),  INT32_C(           0), -INT32_C(   284757353),  INT32_C(           0) } },
+    { UINT8_C(191),
+      {  INT32_C(  1547053607),  INT32_C(  1072739818), -INT32_C(   835841166),  INT32_C(   741123540),  INT32_C(   734651615), -INT32_C(   151377724), -INT32_C(   716925266),  INT32_C(   550274555) },
+      {  INT32_C(  1547053607),  INT32_C(  1072739818), -INT32_C(   835841166),  INT32_C(   741123540),  INT32_C(   734651615), -INT32_C(   151377724),  INT32_C(           0), -INT32_C(   716925266) } },
+    { UINT8_C(182),
+      { -INT32_C(    92497626),  INT32_C(   319277924),  INT32_C(   502114275), -INT32_C(  1919443421), -INT32_C(   850908293), -INT32_C(   790055940),  INT32_C(  1833744502), -INT32_C(  1636428825) },
+      {  INT32_C(           0), -INT32_C(    92497626),  INT32_C(   319277924),  INT32_C(           0),  INT32_C(   502114275), -INT32_C(  1919443421),  INT32_C(           0), -INT32_C(   850908293) } },
+    { UINT8_C(237),
+      { -INT32_C(   231418079), -INT32_C(   833036858),  INT32_C(  1782847169), -INT32_C(   889327291),  INT32_C(   840687340),  INT32_C(   255177617),  INT32_C(  1548049976), -INT32_C(  2051000532) },
+      { -INT32_C(   231418079),  INT32_C(           0), -INT32_C(   833036858),  INT32_C(  1782847169),  INT32_C(           0), -INT32_C(   889327291),  INT32_C(   840687340),  INT32_C(   255177617) } },
+    { UINT8_C(204),
+      {  INT32_C(  1429148679), -INT32_C(  1926839818), -INT32_C(   351595865), -INT32_C(  1821481235),  INT32_C(  1553720235),  INT32_C(  1443281134), -INT32_C(  1881893674),  INT32_C(  1252758086) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1429148679), -INT32_C(  1926839818),  INT32_C(           0),  INT32_C(           0), -INT32_C(   351595865), -INT32_C(  1821481235) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expandloadu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  1494486823),  INT32_C(  2105811632), -INT32_C(  1096756879),  INT32_C(  1201587463), -INT32_C(     7700130),  INT32_C(  1721067565), -INT32_C(   730196548), -INT32_C(  1782267914) },
+      UINT8_C(172),
+      { -INT32_C(   107770062),  INT32_C(  1175666790),  INT32_C(    44888073), -INT32_C(  1538541337), -INT32_C(  1307815594),  INT32_C(   249409988), -INT32_C(  1872750846),  INT32_C(    57463016) },
+      { -INT32_C(  1494486823),  INT32_C(  2105811632), -INT32_C(   107770062),  INT32_C(  1175666790), -INT32_C(     7700130),  INT32_C(    44888073), -INT32_C(   730196548), -INT32_C(  1538541337) } },
+    { {  INT32_C(  1986573807),  INT32_C(   244628518),  INT32_C(   214005176), -INT32_C(   231802540), -INT32_C(  1053656506),  INT32_C(   283940684),  INT32_C(  2125452357), -INT32_C(  1812243793) },
+      UINT8_C(111),
+      { -INT32_C(   168864238),  INT32_C(   775602145),  INT32_C(   863114946), -INT32_C(  1455642978),  INT32_C(  2067681873),  INT32_C(  1193031238),  INT32_C(   725549846), -INT32_C(   524370775) },
+      { -INT32_C(   168864238),  INT32_C(   775602145),  INT32_C(   863114946), -INT32_C(  1455642978), -INT32_C(  1053656506),  INT32_C(  2067681873),  INT32_C(  1193031238), -INT32_C(  1812243793) } },
+    { { -INT32_C(    54161398), -INT32_C(   626876748), -INT32_C(  1228994128), -INT32_C(  1030389626), -INT32_C(   221259491), -INT32_C(    83122956), -INT32_C(   442002715),  INT32_C(  1818268253) },
+      UINT8_C( 94),
+      { -INT32_C(  1467484520), -INT32_C(  1817335657),  INT32_C(   571743458), -INT32_C(  1148396384), -INT32_C(  1231665060),  INT32_C(  2004673591),  INT32_C(  1219519567),  INT32_C(  1234341937) },
+      { -INT32_C(    54161398), -INT32_C(  1467484520), -INT32_C(  1817335657),  INT32_C(   571743458), -INT32_C(  1148396384), -INT32_C(    83122956), -INT32_C(  1231665060),  INT32_C(  1818268253) } },
+    { {  INT32_C(   842742374), -INT32_C(  1224140565), -INT32_C(   144084635),  INT32_C(   179303770),  INT32_C(   737738217), -INT32_C(  1595695410), -INT32_C(   132863558), -INT32_C(   592049332) },
+      UINT8_C(  0),
+      { -INT32_C(   270143214),  INT32_C(   239364798),  INT32_C(  2084883087), -INT32_C(  1234524569),  INT32_C(     2826252), -INT32_C(  1583918462), -INT32_C(  1862349327),  INT32_C(  1517724151) },
+      {  INT32_C(   842742374), -INT32_C(  1224140565), -INT32_C(   144084635),  INT32_C(   179303770),  INT32_C(   737738217), -INT32_C(  1595695410), -INT32_C(   132863558), -INT32_C(   592049332) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i r = simde_mm256_mask_expandloadu_epi32(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 81),
+      { -INT32_C(  1389772626), -INT32_C(   194528785),  INT32_C(   145145089), -INT32_C(   541819720),  INT32_C(   501739636),  INT32_C(   600103448), -INT32_C(   362209559),  INT32_C(  1812875270) },
+      { -INT32_C(  1389772626),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   194528785),  INT32_C(           0),  INT32_C(   145145089),  INT32_C(           0) } },
+    { UINT8_C( 59),
+      { -INT32_C(   580446046),  INT32_C(   561529910),  INT32_C(   437331640),  INT32_C(   264639311), -INT32_C(   713095718),  INT32_C(   303622822), -INT32_C(    95809832), -INT32_C(   850325860) },
+      { -INT32_C(   580446046),  INT32_C(   561529910),  INT32_C(           0),  INT32_C(   437331640),  INT32_C(   264639311), -INT32_C(   713095718),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(212),
+      {  INT32_C(  1125481490),  INT32_C(  1454553727), -INT32_C(   923142738),  INT32_C(  1586261633), -INT32_C(    94126963),  INT32_C(   450276035),  INT32_C(  1758985284),  INT32_C(  1619813779) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1125481490),  INT32_C(           0),  INT32_C(  1454553727),  INT32_C(           0), -INT32_C(   923142738),  INT32_C(  1586261633) } },
+    { UINT8_C(  0),
+      { -INT32_C(    82400304), -INT32_C(  1222957349),  INT32_C(    22120760),  INT32_C(   912876844),  INT32_C(  1177409189), -INT32_C(   877439811),  INT32_C(  1248133757),  INT32_C(   331816261) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi32(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 8122606194886693393),  INT64_C( 8152965071382617969),  INT64_C(  879476800740788426), -INT64_C( 6754710423713728862) },
+      UINT8_C(213),
+      { -INT64_C( 4188147166071875386),  INT64_C( 3434306658878365207), -INT64_C(  746194256355268150), -INT64_C( 1978595448186103385) },
+      { -INT64_C( 4188147166071875386),  INT64_C( 8152965071382617969),  INT64_C( 3434306658878365207), -INT64_C( 6754710423713728862) } },
+    { { -INT64_C( 8493396762395714888),  INT64_C( 3637770765676291652),  INT64_C( 6185389376740116335), -INT64_C( 3856191021735424936) },
+      UINT8_C(135),
+      { -INT64_C(  181749177881912553),  INT64_C(   67403740802151890), -INT64_C( 8457688069308059171), -INT64_C( 2683087921710326020) },
+      { -INT64_C(  181749177881912553),  INT64_C(   67403740802151890), -INT64_C( 8457688069308059171), -INT64_C( 3856191021735424936) } },
+    { {  INT64_C( 7067989523404815392),  INT64_C( 4280370109056881428), -INT64_C( 3302998747523813165),  INT64_C( 8946971328273016248) },
+      UINT8_C(210),
+      { -INT64_C( 5526672213354292393),  INT64_C( 5301588998739323465), -INT64_C( 4381890654208397446), -INT64_C( 5721842326387415243) },
+      {  INT64_C( 7067989523404815392), -INT64_C( 5526672213354292393), -INT64_C( 3302998747523813165),  INT64_C( 8946971328273016248) } },
+    { { -INT64_C( 1855692366709386185),  INT64_C( 3231785800859028916), -INT64_C( 6149975311358142019), -INT64_C( 6630345995006138249) },
+      UINT8_C(253),
+      { -INT64_C( 5972113431492508602),  INT64_C( 5055878779419428229),  INT64_C( 3838980396497207712),  INT64_C( 6291688540470536005) },
+      { -INT64_C( 5972113431492508602),  INT64_C( 3231785800859028916),  INT64_C( 5055878779419428229),  INT64_C( 3838980396497207712) } },
+    { { -INT64_C( 6434733680024463978),  INT64_C( 2600037526875428767),  INT64_C( 4344812086981277017), -INT64_C( 9010576343621707116) },
+      UINT8_C(101),
+      { -INT64_C( 1556072364545517097),  INT64_C( 2149502849430722497),  INT64_C( 2104598698899196312),  INT64_C( 2146258031299502628) },
+      { -INT64_C( 1556072364545517097),  INT64_C( 2600037526875428767),  INT64_C( 2149502849430722497), -INT64_C( 9010576343621707116) } },
+    { {  INT64_C( 2112969095425676929), -INT64_C( 7848742526670920403),  INT64_C( 1756840531557717785), -INT64_C( 3346621768957639676) },
+      UINT8_C( 22),
+      {  INT64_C( 4195407021982822108), -INT64_C( 2776199828165040931),  INT64_C( 2322649135887077223), -INT64_C( 7859487409370282544) },
+      {  INT64_C( 2112969095425676929),  INT64_C( 4195407021982822108), -INT64_C( 2776199828165040931), -INT64_C( 3346621768957639676) } },
+    { { -INT64_C( 2114665935192389502),  INT64_C( 2918408993789832176), -INT64_C(  193435028333738888), -INT64_C(  192176452395310092) },
+      UINT8_C( 99),
+      {  INT64_C( 4763874384910097478), -INT64_C( 3770123359773647563),  INT64_C( 5086020849400140375), -INT64_C( 8149486594117390640) },
+      {  INT64_C( 4763874384910097478), -INT64_C( 3770123359773647563), -INT64_C(  193435028333738888), -INT64_C(  192176452395310092) } },
+    { {  INT64_C( 6530678205621864309), -INT64_C( 4196047628799619324), -INT64_C(  580253778047040220), -INT64_C( 3604913277946681172) },
+      UINT8_C(119),
+      { -INT64_C( 6023016048815058658), -INT64_C( 5122358438878492650), -INT64_C( 6049574062776561866), -INT64_C( 7391606139119640402) },
+      { -INT64_C( 6023016048815058658), -INT64_C( 5122358438878492650), -INT64_C( 6049574062776561866), -INT64_C( 3604913277946681172) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 19),
+      {  INT64_C( 2602943871547132185), -INT64_C(  111956803118927302), -INT64_C( 7428897207896013496),  INT64_C( 7519821285785271652) },
+      {  INT64_C( 2602943871547132185), -INT64_C(  111956803118927302),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(142),
+      {  INT64_C( 8203601187492330255), -INT64_C( 3194523957775162564), -INT64_C( 9166260054653864452), -INT64_C( 1062778728616113681) },
+      {  INT64_C(                   0),  INT64_C( 8203601187492330255), -INT64_C( 3194523957775162564), -INT64_C( 9166260054653864452) } },
+    { UINT8_C(228),
+      { -INT64_C( 7611212168658681758), -INT64_C(  831035559785570555), -INT64_C( 6775310558070345115),  INT64_C( 7255063068866899614) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 7611212168658681758),  INT64_C(                   0) } },
+    { UINT8_C(202),
+      {  INT64_C( 8661517100476885813),  INT64_C( 1103649093075031760),  INT64_C(  782259742513970911), -INT64_C( 2439789212061998924) },
+      {  INT64_C(                   0),  INT64_C( 8661517100476885813),  INT64_C(                   0),  INT64_C( 1103649093075031760) } },
+    { UINT8_C(127),
+      {  INT64_C( 5066913261684874459), -INT64_C( 5303937294650844499),  INT64_C( 4076677743367489085),  INT64_C( 2133024157677833722) },
+      {  INT64_C( 5066913261684874459), -INT64_C( 5303937294650844499),  INT64_C( 4076677743367489085),  INT64_C( 2133024157677833722) } },
+    { UINT8_C(  0),
+      { -INT64_C( 3300387486460475801),  INT64_C( 6924497443956894959),  INT64_C( 5896530689798959232),  INT64_C( 1621040075985997639) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(147),
+      { -INT64_C( 8904050573550355078), -INT64_C( 1818748967630192475),  INT64_C( 8199730164345241223),  INT64_C( 7126369654927361929) },
+      { -INT64_C( 8904050573550355078), -INT64_C( 1818748967630192475),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(138),
+      {  INT64_C( 1588245413299190277),  INT64_C( 4555307902735547206),  INT64_C( 2193356624708035569),  INT64_C( 5494567786536135494) },
+      {  INT64_C(                   0),  INT64_C( 1588245413299190277),  INT64_C(                   0),  INT64_C( 4555307902735547206) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expandloadu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 8632690899075417694), -INT64_C( 5071235814625332795),  INT64_C( 1640482609454812449),  INT64_C(   62545570652536281) },
+      UINT8_C(243),
+      { -INT64_C( 3999532926663444041),  INT64_C( 1821832098091817696), -INT64_C( 5424338001996836803), -INT64_C( 9065276533913854279) },
+      { -INT64_C( 3999532926663444041),  INT64_C( 1821832098091817696),  INT64_C( 1640482609454812449),  INT64_C(   62545570652536281) } },
+    { { -INT64_C( 7425358117665025188), -INT64_C( 7212408209066298946), -INT64_C( 3792646746214180146), -INT64_C( 7929230118521609957) },
+      UINT8_C( 48),
+      {  INT64_C( 4528398356222870203),  INT64_C( 1959253688623917309), -INT64_C( 5176709569220080643),  INT64_C( 7641751440023494516) },
+      { -INT64_C( 7425358117665025188), -INT64_C( 7212408209066298946), -INT64_C( 3792646746214180146), -INT64_C( 7929230118521609957) } },
+    { {  INT64_C( 8691291869541874588), -INT64_C( 2371192889199179938),  INT64_C( 7442981976895804102), -INT64_C( 5412648120608185073) },
+      UINT8_C(222),
+      { -INT64_C( 1066356018820725557), -INT64_C( 2851952967208891824),  INT64_C( 8641827307767833396),  INT64_C( 2592096034288177473) },
+      {  INT64_C( 8691291869541874588), -INT64_C( 1066356018820725557), -INT64_C( 2851952967208891824),  INT64_C( 8641827307767833396) } },
+    { { -INT64_C( 8416067242843156919),  INT64_C( 8136816916531285398), -INT64_C( 4930994910641928868), -INT64_C( 7735812060780973522) },
+      UINT8_C( 89),
+      { -INT64_C( 4760372141665532121),  INT64_C( 4850866191466901952),  INT64_C( 3277985513819249293),  INT64_C( 7267690390625295410) },
+      { -INT64_C( 4760372141665532121),  INT64_C( 8136816916531285398), -INT64_C( 4930994910641928868),  INT64_C( 4850866191466901952) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i r = simde_mm256_mask_expandloadu_epi64(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(123),
+      { -INT64_C( 7255627297033878398),  INT64_C( 7459802798039699746), -INT64_C( 2283194316951109446), -INT64_C( 5105636146913390822) },
+      { -INT64_C( 7255627297033878398),  INT64_C( 7459802798039699746),  INT64_C(                   0), -INT64_C( 2283194316951109446) } },
+    { UINT8_C(  0),
+      { -INT64_C( 7143780991796800441),  INT64_C( 5206313238380068748), -INT64_C( 2632073551556393384), -INT64_C( 1274036581974716041) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(206),
+      { -INT64_C( 3255489451134447060),  INT64_C( 8791656610422725878),  INT64_C( 2788132549504558282),  INT64_C( 3425658978636251359) },
+      {  INT64_C(                   0), -INT64_C( 3255489451134447060),  INT64_C( 8791656610422725878),  INT64_C( 2788132549504558282) } },
+    { UINT8_C(155),
+      { -INT64_C( 7201274215453435586), -INT64_C( 2769859290414596268), -INT64_C( 7345104070437420836),  INT64_C( 1159317612233250254) },
+      { -INT64_C( 7201274215453435586), -INT64_C( 2769859290414596268),  INT64_C(                   0), -INT64_C( 7345104070437420836) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi64(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   674.45), SIMDE_FLOAT32_C(  -813.17), SIMDE_FLOAT32_C(  -236.96), SIMDE_FLOAT32_C(   747.79),
+        SIMDE_FLOAT32_C(   996.43), SIMDE_FLOAT32_C(   669.59), SIMDE_FLOAT32_C(  -341.67), SIMDE_FLOAT32_C(  -470.43) },
+         UINT8_MAX,
+      { SIMDE_FLOAT32_C(   460.48), SIMDE_FLOAT32_C(  -926.90), SIMDE_FLOAT32_C(   380.09), SIMDE_FLOAT32_C(  -168.01),
+        SIMDE_FLOAT32_C(   -36.66), SIMDE_FLOAT32_C(   868.91), SIMDE_FLOAT32_C(   341.62), SIMDE_FLOAT32_C(   376.26) },
+      { SIMDE_FLOAT32_C(   460.48), SIMDE_FLOAT32_C(  -926.90), SIMDE_FLOAT32_C(   380.09), SIMDE_FLOAT32_C(  -168.01),
+        SIMDE_FLOAT32_C(   -36.66), SIMDE_FLOAT32_C(   868.91), SIMDE_FLOAT32_C(   341.62), SIMDE_FLOAT32_C(   376.26) } },
+    { { SIMDE_FLOAT32_C(   863.07), SIMDE_FLOAT32_C(  -612.87), SIMDE_FLOAT32_C(   248.97), SIMDE_FLOAT32_C(  -818.88),
+        SIMDE_FLOAT32_C(   905.94), SIMDE_FLOAT32_C(  -607.77), SIMDE_FLOAT32_C(   -33.65), SIMDE_FLOAT32_C(  -102.81) },
+      UINT8_C( 56),
+      { SIMDE_FLOAT32_C(  -621.51), SIMDE_FLOAT32_C(    87.89), SIMDE_FLOAT32_C(   866.06), SIMDE_FLOAT32_C(   215.73),
+        SIMDE_FLOAT32_C(   756.81), SIMDE_FLOAT32_C(  -321.03), SIMDE_FLOAT32_C(  -888.27), SIMDE_FLOAT32_C(   200.90) },
+      { SIMDE_FLOAT32_C(   863.07), SIMDE_FLOAT32_C(  -612.87), SIMDE_FLOAT32_C(   248.97), SIMDE_FLOAT32_C(  -621.51),
+        SIMDE_FLOAT32_C(    87.89), SIMDE_FLOAT32_C(   866.06), SIMDE_FLOAT32_C(   -33.65), SIMDE_FLOAT32_C(  -102.81) } },
+    { { SIMDE_FLOAT32_C(  -534.74), SIMDE_FLOAT32_C(  -894.13), SIMDE_FLOAT32_C(   396.57), SIMDE_FLOAT32_C(   475.45),
+        SIMDE_FLOAT32_C(  -354.18), SIMDE_FLOAT32_C(  -422.70), SIMDE_FLOAT32_C(   288.09), SIMDE_FLOAT32_C(  -746.61) },
+      UINT8_C(220),
+      { SIMDE_FLOAT32_C(  -904.82), SIMDE_FLOAT32_C(  -373.90), SIMDE_FLOAT32_C(  -776.89), SIMDE_FLOAT32_C(  -703.51),
+        SIMDE_FLOAT32_C(   133.41), SIMDE_FLOAT32_C(    -0.82), SIMDE_FLOAT32_C(  -472.31), SIMDE_FLOAT32_C(    68.34) },
+      { SIMDE_FLOAT32_C(  -534.74), SIMDE_FLOAT32_C(  -894.13), SIMDE_FLOAT32_C(  -904.82), SIMDE_FLOAT32_C(  -373.90),
+        SIMDE_FLOAT32_C(  -776.89), SIMDE_FLOAT32_C(  -422.70), SIMDE_FLOAT32_C(  -703.51), SIMDE_FLOAT32_C(   133.41) } },
+    { { SIMDE_FLOAT32_C(  -892.23), SIMDE_FLOAT32_C(  -324.29), SIMDE_FLOAT32_C(   183.63), SIMDE_FLOAT32_C(   -47.44),
+        SIMDE_FLOAT32_C(  -505.62), SIMDE_FLOAT32_C(   448.76), SIMDE_FLOAT32_C(  -392.15), SIMDE_FLOAT32_C(   985.65) },
+      UINT8_C(253),
+      { SIMDE_FLOAT32_C(   994.42), SIMDE_FLOAT32_C(   801.28), SIMDE_FLOAT32_C(   254.34), SIMDE_FLOAT32_C(   581.94),
+        SIMDE_FLOAT32_C(   735.70), SIMDE_FLOAT32_C(  -931.99), SIMDE_FLOAT32_C(   149.38), SIMDE_FLOAT32_C(   -73.03) },
+      { SIMDE_FLOAT32_C(   994.42), SIMDE_FLOAT32_C(  -324.29), SIMDE_FLOAT32_C(   801.28), SIMDE_FLOAT32_C(   254.34),
+        SIMDE_FLOAT32_C(   581.94), SIMDE_FLOAT32_C(   735.70), SIMDE_FLOAT32_C(  -931.99), SIMDE_FLOAT32_C(   149.38) } },
+    { { SIMDE_FLOAT32_C(   224.12), SIMDE_FLOAT32_C(  -529.34), SIMDE_FLOAT32_C(  -850.33), SIMDE_FLOAT32_C(   199.68),
+        SIMDE_FLOAT32_C(   601.19), SIMDE_FLOAT32_C(   -11.81), SIMDE_FLOAT32_C(  -537.63), SIMDE_FLOAT32_C(   517.72) },
+      UINT8_C(240),
+      { SIMDE_FLOAT32_C(  -465.74), SIMDE_FLOAT32_C(  -579.17), SIMDE_FLOAT32_C(   -44.79), SIMDE_FLOAT32_C(   133.97),
+        SIMDE_FLOAT32_C(   -86.28), SIMDE_FLOAT32_C(  -507.07), SIMDE_FLOAT32_C(   441.91), SIMDE_FLOAT32_C(   371.31) },
+      { SIMDE_FLOAT32_C(   224.12), SIMDE_FLOAT32_C(  -529.34), SIMDE_FLOAT32_C(  -850.33), SIMDE_FLOAT32_C(   199.68),
+        SIMDE_FLOAT32_C(  -465.74), SIMDE_FLOAT32_C(  -579.17), SIMDE_FLOAT32_C(   -44.79), SIMDE_FLOAT32_C(   133.97) } },
+    { { SIMDE_FLOAT32_C(  -854.01), SIMDE_FLOAT32_C(   993.83), SIMDE_FLOAT32_C(    55.76), SIMDE_FLOAT32_C(    82.29),
+        SIMDE_FLOAT32_C(  -118.95), SIMDE_FLOAT32_C(   121.15), SIMDE_FLOAT32_C(   828.19), SIMDE_FLOAT32_C(  -116.38) },
+      UINT8_C(252),
+      { SIMDE_FLOAT32_C(   546.62), SIMDE_FLOAT32_C(   -58.09), SIMDE_FLOAT32_C(  -889.27), SIMDE_FLOAT32_C(   422.45),
+        SIMDE_FLOAT32_C(   461.70), SIMDE_FLOAT32_C(   357.24), SIMDE_FLOAT32_C(  -596.23), SIMDE_FLOAT32_C(   805.97) },
+      { SIMDE_FLOAT32_C(  -854.01), SIMDE_FLOAT32_C(   993.83), SIMDE_FLOAT32_C(   546.62), SIMDE_FLOAT32_C(   -58.09),
+        SIMDE_FLOAT32_C(  -889.27), SIMDE_FLOAT32_C(   422.45), SIMDE_FLOAT32_C(   461.70), SIMDE_FLOAT32_C(   357.24) } },
+    { { SIMDE_FLOAT32_C(  -439.68), SIMDE_FLOAT32_C(  -426.51), SIMDE_FLOAT32_C(  -703.59), SIMDE_FLOAT32_C(   281.84),
+        SIMDE_FLOAT32_C(   989.24), SIMDE_FLOAT32_C(  -329.13), SIMDE_FLOAT32_C(   796.07), SIMDE_FLOAT32_C(  -182.11) },
+         UINT8_MAX,
+      { SIMDE_FLOAT32_C(  -671.53), SIMDE_FLOAT32_C(    12.34), SIMDE_FLOAT32_C(   530.57), SIMDE_FLOAT32_C(  -560.92),
+        SIMDE_FLOAT32_C(   143.36), SIMDE_FLOAT32_C(  -836.79), SIMDE_FLOAT32_C(  -273.29), SIMDE_FLOAT32_C(  -168.96) },
+      { SIMDE_FLOAT32_C(  -671.53), SIMDE_FLOAT32_C(    12.34), SIMDE_FLOAT32_C(   530.57), SIMDE_FLOAT32_C(  -560.92),
+        SIMDE_FLOAT32_C(   143.36), SIMDE_FLOAT32_C(  -836.79), SIMDE_FLOAT32_C(  -273.29), SIMDE_FLOAT32_C(  -168.96) } },
+    { { SIMDE_FLOAT32_C(   709.37), SIMDE_FLOAT32_C(   -79.21), SIMDE_FLOAT32_C(   967.87), SIMDE_FLOAT32_C(  -889.29),
+        SIMDE_FLOAT32_C(  -163.15), SIMDE_FLOAT32_C(   207.26), SIMDE_FLOAT32_C(   996.60), SIMDE_FLOAT32_C(   478.05) },
+      UINT8_C( 58),
+      { SIMDE_FLOAT32_C(   -72.42), SIMDE_FLOAT32_C(    58.38), SIMDE_FLOAT32_C(   838.88), SIMDE_FLOAT32_C(  -819.87),
+        SIMDE_FLOAT32_C(  -643.01), SIMDE_FLOAT32_C(   617.97), SIMDE_FLOAT32_C(   357.79), SIMDE_FLOAT32_C(  -117.87) },
+      { SIMDE_FLOAT32_C(   709.37), SIMDE_FLOAT32_C(   -72.42), SIMDE_FLOAT32_C(   967.87), SIMDE_FLOAT32_C(    58.38),
+        SIMDE_FLOAT32_C(   838.88), SIMDE_FLOAT32_C(  -819.87), SIMDE_FLOAT32_C(   996.60), SIMDE_FLOAT32_C(   478.05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_expand_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C( 77),
+      { SIMDE_FLOAT32_C(   690.71), SIMDE_FLOAT32_C(  -145.17), SIMDE_FLOAT32_C(  -370.11), SIMDE_FLOAT32_C(  -968.16),
+        SIMDE_FLOAT32_C(    28.13), SIMDE_FLOAT32_C(  -794.05), SIMDE_FLOAT32_C(   831.37), SIMDE_FLOAT32_C(  -985.91) },
+      { SIMDE_FLOAT32_C(   690.71), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -145.17), SIMDE_FLOAT32_C(  -370.11),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -968.16), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(127),
+      { SIMDE_FLOAT32_C(   912.14), SIMDE_FLOAT32_C(  -820.37), SIMDE_FLOAT32_C(   615.88), SIMDE_FLOAT32_C(   779.66),
+        SIMDE_FLOAT32_C(   196.48), SIMDE_FLOAT32_C(   475.36), SIMDE_FLOAT32_C(  -607.06), SIMDE_FLOAT32_C(   157.17) },
+      { SIMDE_FLOAT32_C(   912.14), SIMDE_FLOAT32_C(  -820.37), SIMDE_FLOAT32_C(   615.88), SIMDE_FLOAT32_C(   779.66),
+        SIMDE_FLOAT32_C(   196.48), SIMDE_FLOAT32_C(   475.36), SIMDE_FLOAT32_C(  -607.06), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 81),
+      { SIMDE_FLOAT32_C(  -953.50), SIMDE_FLOAT32_C(   738.18), SIMDE_FLOAT32_C(   263.81), SIMDE_FLOAT32_C(   264.57),
+        SIMDE_FLOAT32_C(   597.81), SIMDE_FLOAT32_C(   206.73), SIMDE_FLOAT32_C(   213.95), SIMDE_FLOAT32_C(   501.32) },
+      { SIMDE_FLOAT32_C(  -953.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   738.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   263.81), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(143),
+      { SIMDE_FLOAT32_C(   460.92), SIMDE_FLOAT32_C(    18.50), SIMDE_FLOAT32_C(   520.13), SIMDE_FLOAT32_C(  -601.22),
+        SIMDE_FLOAT32_C(  -588.44), SIMDE_FLOAT32_C(   808.45), SIMDE_FLOAT32_C(   658.86), SIMDE_FLOAT32_C(  -949.70) },
+      { SIMDE_FLOAT32_C(   460.92), SIMDE_FLOAT32_C(    18.50), SIMDE_FLOAT32_C(   520.13), SIMDE_FLOAT32_C(  -601.22),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -588.44) } },
+    { UINT8_C(103),
+      { SIMDE_FLOAT32_C(    78.79), SIMDE_FLOAT32_C(   858.66), SIMDE_FLOAT32_C(  -247.43), SIMDE_FLOAT32_C(   435.10),
+        SIMDE_FLOAT32_C(   371.28), SIMDE_FLOAT32_C(   938.40), SIMDE_FLOAT32_C(   -99.01), SIMDE_FLOAT32_C(  -527.25) },
+      { SIMDE_FLOAT32_C(    78.79), SIMDE_FLOAT32_C(   858.66), SIMDE_FLOAT32_C(  -247.43), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   435.10), SIMDE_FLOAT32_C(   371.28), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(197),
+      { SIMDE_FLOAT32_C(  -821.27), SIMDE_FLOAT32_C(   297.46), SIMDE_FLOAT32_C(   913.36), SIMDE_FLOAT32_C(   117.47),
+        SIMDE_FLOAT32_C(  -272.72), SIMDE_FLOAT32_C(  -197.34), SIMDE_FLOAT32_C(   341.25), SIMDE_FLOAT32_C(  -104.55) },
+      { SIMDE_FLOAT32_C(  -821.27), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   297.46), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   913.36), SIMDE_FLOAT32_C(   117.47) } },
+    { UINT8_C(239),
+      { SIMDE_FLOAT32_C(   966.22), SIMDE_FLOAT32_C(   596.60), SIMDE_FLOAT32_C(   203.89), SIMDE_FLOAT32_C(   594.84),
+        SIMDE_FLOAT32_C(   385.28), SIMDE_FLOAT32_C(   331.52), SIMDE_FLOAT32_C(   677.32), SIMDE_FLOAT32_C(  -491.67) },
+      { SIMDE_FLOAT32_C(   966.22), SIMDE_FLOAT32_C(   596.60), SIMDE_FLOAT32_C(   203.89), SIMDE_FLOAT32_C(   594.84),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   385.28), SIMDE_FLOAT32_C(   331.52), SIMDE_FLOAT32_C(   677.32) } },
+    { UINT8_C(  4),
+      { SIMDE_FLOAT32_C(   737.87), SIMDE_FLOAT32_C(    24.09), SIMDE_FLOAT32_C(   -93.41), SIMDE_FLOAT32_C(   827.66),
+        SIMDE_FLOAT32_C(   389.88), SIMDE_FLOAT32_C(  -159.80), SIMDE_FLOAT32_C(  -942.39), SIMDE_FLOAT32_C(  -230.80) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   737.87), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_expand_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expandloadu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   892.39), SIMDE_FLOAT32_C(  -226.66), SIMDE_FLOAT32_C(   632.62), SIMDE_FLOAT32_C(  -167.59),
+        SIMDE_FLOAT32_C(   969.76), SIMDE_FLOAT32_C(   228.15), SIMDE_FLOAT32_C(   893.95), SIMDE_FLOAT32_C(   470.73) },
+      UINT8_C(223),
+      { SIMDE_FLOAT32_C(  -139.12), SIMDE_FLOAT32_C(  -895.49), SIMDE_FLOAT32_C(  -694.60), SIMDE_FLOAT32_C(  -337.91),
+        SIMDE_FLOAT32_C(  -951.27), SIMDE_FLOAT32_C(   356.12), SIMDE_FLOAT32_C(  -589.31), SIMDE_FLOAT32_C(  -718.56) },
+      { SIMDE_FLOAT32_C(  -139.12), SIMDE_FLOAT32_C(  -895.49), SIMDE_FLOAT32_C(  -694.60), SIMDE_FLOAT32_C(  -337.91),
+        SIMDE_FLOAT32_C(  -951.27), SIMDE_FLOAT32_C(   228.15), SIMDE_FLOAT32_C(   356.12), SIMDE_FLOAT32_C(  -589.31) } },
+    { { SIMDE_FLOAT32_C(  -663.62), SIMDE_FLOAT32_C(  -274.96), SIMDE_FLOAT32_C(  -143.02), SIMDE_FLOAT32_C(  -261.72),
+        SIMDE_FLOAT32_C(   781.48), SIMDE_FLOAT32_C(  -417.53), SIMDE_FLOAT32_C(  -927.48), SIMDE_FLOAT32_C(   863.68) },
+      UINT8_C(135),
+      { SIMDE_FLOAT32_C(  -177.04), SIMDE_FLOAT32_C(   314.23), SIMDE_FLOAT32_C(  -345.90), SIMDE_FLOAT32_C(  -954.73),
+        SIMDE_FLOAT32_C(   284.30), SIMDE_FLOAT32_C(   968.78), SIMDE_FLOAT32_C(  -160.30), SIMDE_FLOAT32_C(   196.67) },
+      { SIMDE_FLOAT32_C(  -177.04), SIMDE_FLOAT32_C(   314.23), SIMDE_FLOAT32_C(  -345.90), SIMDE_FLOAT32_C(  -261.72),
+        SIMDE_FLOAT32_C(   781.48), SIMDE_FLOAT32_C(  -417.53), SIMDE_FLOAT32_C(  -927.48), SIMDE_FLOAT32_C(  -954.73) } },
+    { { SIMDE_FLOAT32_C(   521.41), SIMDE_FLOAT32_C(  -803.82), SIMDE_FLOAT32_C(   580.73), SIMDE_FLOAT32_C(  -792.14),
+        SIMDE_FLOAT32_C(  -644.50), SIMDE_FLOAT32_C(  -798.31), SIMDE_FLOAT32_C(   219.42), SIMDE_FLOAT32_C(  -452.78) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT32_C(   597.13), SIMDE_FLOAT32_C(   654.51), SIMDE_FLOAT32_C(   556.88), SIMDE_FLOAT32_C(   720.33),
+        SIMDE_FLOAT32_C(  -910.07), SIMDE_FLOAT32_C(  -537.27), SIMDE_FLOAT32_C(   305.47), SIMDE_FLOAT32_C(  -438.74) },
+      { SIMDE_FLOAT32_C(   521.41), SIMDE_FLOAT32_C(   597.13), SIMDE_FLOAT32_C(   580.73), SIMDE_FLOAT32_C(  -792.14),
+        SIMDE_FLOAT32_C(  -644.50), SIMDE_FLOAT32_C(  -798.31), SIMDE_FLOAT32_C(   219.42), SIMDE_FLOAT32_C(  -452.78) } },
+    { { SIMDE_FLOAT32_C(  -174.58), SIMDE_FLOAT32_C(  -245.58), SIMDE_FLOAT32_C(  -563.03), SIMDE_FLOAT32_C(   693.65),
+        SIMDE_FLOAT32_C(  -390.40), SIMDE_FLOAT32_C(  -929.83), SIMDE_FLOAT32_C(  -367.22), SIMDE_FLOAT32_C(   871.54) },
+      UINT8_C( 70),
+      { SIMDE_FLOAT32_C(   763.62), SIMDE_FLOAT32_C(    -7.68), SIMDE_FLOAT32_C(   780.78), SIMDE_FLOAT32_C(  -419.55),
+        SIMDE_FLOAT32_C(  -847.70), SIMDE_FLOAT32_C(   772.67), SIMDE_FLOAT32_C(     6.26), SIMDE_FLOAT32_C(   360.86) },
+      { SIMDE_FLOAT32_C(  -174.58), SIMDE_FLOAT32_C(   763.62), SIMDE_FLOAT32_C(    -7.68), SIMDE_FLOAT32_C(   693.65),
+        SIMDE_FLOAT32_C(  -390.40), SIMDE_FLOAT32_C(  -929.83), SIMDE_FLOAT32_C(   780.78), SIMDE_FLOAT32_C(   871.54) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 r = simde_mm256_mask_expandloadu_ps(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C( 81),
+      { SIMDE_FLOAT32_C(  -918.40), SIMDE_FLOAT32_C(   263.50), SIMDE_FLOAT32_C(  -756.81), SIMDE_FLOAT32_C(  -217.74),
+        SIMDE_FLOAT32_C(   519.01), SIMDE_FLOAT32_C(   -17.46), SIMDE_FLOAT32_C(  -825.25), SIMDE_FLOAT32_C(   159.78) },
+      { SIMDE_FLOAT32_C(  -918.40), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   263.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -756.81), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 85),
+      { SIMDE_FLOAT32_C(   889.31), SIMDE_FLOAT32_C(  -573.41), SIMDE_FLOAT32_C(   684.26), SIMDE_FLOAT32_C(  -660.22),
+        SIMDE_FLOAT32_C(  -782.75), SIMDE_FLOAT32_C(   329.92), SIMDE_FLOAT32_C(  -810.70), SIMDE_FLOAT32_C(   897.07) },
+      { SIMDE_FLOAT32_C(   889.31), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -573.41), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   684.26), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -660.22), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(223),
+      { SIMDE_FLOAT32_C(  -129.35), SIMDE_FLOAT32_C(  -544.69), SIMDE_FLOAT32_C(  -905.14), SIMDE_FLOAT32_C(  -563.12),
+        SIMDE_FLOAT32_C(  -374.22), SIMDE_FLOAT32_C(  -968.90), SIMDE_FLOAT32_C(   320.32), SIMDE_FLOAT32_C(   374.29) },
+      { SIMDE_FLOAT32_C(  -129.35), SIMDE_FLOAT32_C(  -544.69), SIMDE_FLOAT32_C(  -905.14), SIMDE_FLOAT32_C(  -563.12),
+        SIMDE_FLOAT32_C(  -374.22), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -968.90), SIMDE_FLOAT32_C(   320.32) } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT32_C(   275.39), SIMDE_FLOAT32_C(  -145.92), SIMDE_FLOAT32_C(   519.82), SIMDE_FLOAT32_C(   850.47),
+        SIMDE_FLOAT32_C(  -235.50), SIMDE_FLOAT32_C(   557.88), SIMDE_FLOAT32_C(  -610.33), SIMDE_FLOAT32_C(  -487.56) },
+      { SIMDE_FLOAT32_C(   275.39), SIMDE_FLOAT32_C(  -145.92), SIMDE_FLOAT32_C(   519.82), SIMDE_FLOAT32_C(   850.47),
+        SIMDE_FLOAT32_C(  -235.50), SIMDE_FLOAT32_C(   557.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -610.33) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 r = simde_mm256_maskz_expandloadu_ps(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   420.90), SIMDE_FLOAT64_C(  -209.44), SIMDE_FLOAT64_C(   459.83), SIMDE_FLOAT64_C(  -974.15) },
+      UINT8_C(191),
+      { SIMDE_FLOAT64_C(  -663.62), SIMDE_FLOAT64_C(   -63.42), SIMDE_FLOAT64_C(  -592.55), SIMDE_FLOAT64_C(   128.22) },
+      { SIMDE_FLOAT64_C(  -663.62), SIMDE_FLOAT64_C(   -63.42), SIMDE_FLOAT64_C(  -592.55), SIMDE_FLOAT64_C(   128.22) } },
+    { { SIMDE_FLOAT64_C(  -680.93), SIMDE_FLOAT64_C(  -685.51), SIMDE_FLOAT64_C(  -959.72), SIMDE_FLOAT64_C(   767.90) },
+      UINT8_C(117),
+      { SIMDE_FLOAT64_C(  -414.47), SIMDE_FLOAT64_C(   897.29), SIMDE_FLOAT64_C(  -412.05), SIMDE_FLOAT64_C(  -873.32) },
+      { SIMDE_FLOAT64_C(  -414.47), SIMDE_FLOAT64_C(  -685.51), SIMDE_FLOAT64_C(   897.29), SIMDE_FLOAT64_C(   767.90) } },
+    { { SIMDE_FLOAT64_C(   464.93), SIMDE_FLOAT64_C(   188.89), SIMDE_FLOAT64_C(   137.50), SIMDE_FLOAT64_C(   200.26) },
+      UINT8_C( 81),
+      { SIMDE_FLOAT64_C(   -92.58), SIMDE_FLOAT64_C(  -847.10), SIMDE_FLOAT64_C(    63.57), SIMDE_FLOAT64_C(   637.52) },
+      { SIMDE_FLOAT64_C(   -92.58), SIMDE_FLOAT64_C(   188.89), SIMDE_FLOAT64_C(   137.50), SIMDE_FLOAT64_C(   200.26) } },
+    { { SIMDE_FLOAT64_C(    98.89), SIMDE_FLOAT64_C(   606.78), SIMDE_FLOAT64_C(   996.98), SIMDE_FLOAT64_C(   361.28) },
+      UINT8_C(213),
+      { SIMDE_FLOAT64_C(   128.07), SIMDE_FLOAT64_C(   164.41), SIMDE_FLOAT64_C(  -175.01), SIMDE_FLOAT64_C(   728.68) },
+      { SIMDE_FLOAT64_C(   128.07), SIMDE_FLOAT64_C(   606.78), SIMDE_FLOAT64_C(   164.41), SIMDE_FLOAT64_C(   361.28) } },
+    { { SIMDE_FLOAT64_C(  -433.01), SIMDE_FLOAT64_C(  -290.90), SIMDE_FLOAT64_C(  -858.65), SIMDE_FLOAT64_C(   455.93) },
+      UINT8_C(181),
+      { SIMDE_FLOAT64_C(  -286.83), SIMDE_FLOAT64_C(  -113.18), SIMDE_FLOAT64_C(   916.27), SIMDE_FLOAT64_C(   395.74) },
+      { SIMDE_FLOAT64_C(  -286.83), SIMDE_FLOAT64_C(  -290.90), SIMDE_FLOAT64_C(  -113.18), SIMDE_FLOAT64_C(   455.93) } },
+    { { SIMDE_FLOAT64_C(  -584.15), SIMDE_FLOAT64_C(   277.89), SIMDE_FLOAT64_C(   313.11), SIMDE_FLOAT64_C(  -138.36) },
+      UINT8_C( 88),
+      { SIMDE_FLOAT64_C(   951.32), SIMDE_FLOAT64_C(   598.31), SIMDE_FLOAT64_C(   721.39), SIMDE_FLOAT64_C(     0.21) },
+      { SIMDE_FLOAT64_C(  -584.15), SIMDE_FLOAT64_C(   277.89), SIMDE_FLOAT64_C(   313.11), SIMDE_FLOAT64_C(   951.32) } },
+    { { SIMDE_FLOAT64_C(   315.42), SIMDE_FLOAT64_C(  -157.90), SIMDE_FLOAT64_C(    73.22), SIMDE_FLOAT64_C(   813.33) },
+      UINT8_C( 87),
+      { SIMDE_FLOAT64_C(  -564.42), SIMDE_FLOAT64_C(   767.48), SIMDE_FLOAT64_C(   490.64), SIMDE_FLOAT64_C(  -637.69) },
+      { SIMDE_FLOAT64_C(  -564.42), SIMDE_FLOAT64_C(   767.48), SIMDE_FLOAT64_C(   490.64), SIMDE_FLOAT64_C(   813.33) } },
+    { { SIMDE_FLOAT64_C(   -82.27), SIMDE_FLOAT64_C(  -708.72), SIMDE_FLOAT64_C(   430.35), SIMDE_FLOAT64_C(   712.45) },
+      UINT8_C(135),
+      { SIMDE_FLOAT64_C(    96.91), SIMDE_FLOAT64_C(  -564.27), SIMDE_FLOAT64_C(  -385.60), SIMDE_FLOAT64_C(   462.53) },
+      { SIMDE_FLOAT64_C(    96.91), SIMDE_FLOAT64_C(  -564.27), SIMDE_FLOAT64_C(  -385.60), SIMDE_FLOAT64_C(   712.45) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_expand_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(224),
+      { SIMDE_FLOAT64_C(  -329.83), SIMDE_FLOAT64_C(   339.65), SIMDE_FLOAT64_C(   536.23), SIMDE_FLOAT64_C(  -347.94) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(   768.98), SIMDE_FLOAT64_C(   812.22), SIMDE_FLOAT64_C(    53.31), SIMDE_FLOAT64_C(   548.71) },
+      { SIMDE_FLOAT64_C(   768.98), SIMDE_FLOAT64_C(   812.22), SIMDE_FLOAT64_C(    53.31), SIMDE_FLOAT64_C(   548.71) } },
+    { UINT8_C( 86),
+      { SIMDE_FLOAT64_C(   257.69), SIMDE_FLOAT64_C(  -727.04), SIMDE_FLOAT64_C(  -663.43), SIMDE_FLOAT64_C(  -598.29) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   257.69), SIMDE_FLOAT64_C(  -727.04), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(183),
+      { SIMDE_FLOAT64_C(   883.13), SIMDE_FLOAT64_C(   879.49), SIMDE_FLOAT64_C(   842.56), SIMDE_FLOAT64_C(  -746.25) },
+      { SIMDE_FLOAT64_C(   883.13), SIMDE_FLOAT64_C(   879.49), SIMDE_FLOAT64_C(   842.56), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 33),
+      { SIMDE_FLOAT64_C(   525.64), SIMDE_FLOAT64_C(  -539.82), SIMDE_FLOAT64_C(   928.46), SIMDE_FLOAT64_C(   936.67) },
+      { SIMDE_FLOAT64_C(   525.64), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(187),
+      { SIMDE_FLOAT64_C(   864.17), SIMDE_FLOAT64_C(  -635.44), SIMDE_FLOAT64_C(   586.37), SIMDE_FLOAT64_C(    77.95) },
+      { SIMDE_FLOAT64_C(   864.17), SIMDE_FLOAT64_C(  -635.44), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   586.37) } },
+    { UINT8_C( 64),
+      { SIMDE_FLOAT64_C(   429.06), SIMDE_FLOAT64_C(  -580.91), SIMDE_FLOAT64_C(   240.66), SIMDE_FLOAT64_C(    13.16) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 39),
+      { SIMDE_FLOAT64_C(  -408.08), SIMDE_FLOAT64_C(   554.44), SIMDE_FLOAT64_C(  -602.55), SIMDE_FLOAT64_C(   118.43) },
+      { SIMDE_FLOAT64_C(  -408.08), SIMDE_FLOAT64_C(   554.44), SIMDE_FLOAT64_C(  -602.55), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_expand_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expandloadu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   722.44), SIMDE_FLOAT64_C(   302.34), SIMDE_FLOAT64_C(   782.06), SIMDE_FLOAT64_C(   -29.92) },
+      UINT8_C(245),
+      { SIMDE_FLOAT64_C(   136.39), SIMDE_FLOAT64_C(   508.46), SIMDE_FLOAT64_C(   125.87), SIMDE_FLOAT64_C(   283.62) },
+      { SIMDE_FLOAT64_C(   136.39), SIMDE_FLOAT64_C(   302.34), SIMDE_FLOAT64_C(   508.46), SIMDE_FLOAT64_C(   -29.92) } },
+    { { SIMDE_FLOAT64_C(   -40.59), SIMDE_FLOAT64_C(   127.07), SIMDE_FLOAT64_C(   899.78), SIMDE_FLOAT64_C(   986.18) },
+      UINT8_C( 76),
+      { SIMDE_FLOAT64_C(  -468.54), SIMDE_FLOAT64_C(  -209.08), SIMDE_FLOAT64_C(   -81.83), SIMDE_FLOAT64_C(  -706.05) },
+      { SIMDE_FLOAT64_C(   -40.59), SIMDE_FLOAT64_C(   127.07), SIMDE_FLOAT64_C(  -468.54), SIMDE_FLOAT64_C(  -209.08) } },
+    { { SIMDE_FLOAT64_C(  -586.16), SIMDE_FLOAT64_C(   699.75), SIMDE_FLOAT64_C(   352.87), SIMDE_FLOAT64_C(  -886.04) },
+      UINT8_C(  4),
+      { SIMDE_FLOAT64_C(  -729.22), SIMDE_FLOAT64_C(  -990.87), SIMDE_FLOAT64_C(  -502.10), SIMDE_FLOAT64_C(  -670.96) },
+      { SIMDE_FLOAT64_C(  -586.16), SIMDE_FLOAT64_C(   699.75), SIMDE_FLOAT64_C(  -729.22), SIMDE_FLOAT64_C(  -886.04) } },
+    { { SIMDE_FLOAT64_C(  -361.50), SIMDE_FLOAT64_C(  -647.94), SIMDE_FLOAT64_C(   810.89), SIMDE_FLOAT64_C(  -949.98) },
+      UINT8_C(210),
+      { SIMDE_FLOAT64_C(  -101.32), SIMDE_FLOAT64_C(   839.53), SIMDE_FLOAT64_C(   586.21), SIMDE_FLOAT64_C(  -208.91) },
+      { SIMDE_FLOAT64_C(  -361.50), SIMDE_FLOAT64_C(  -101.32), SIMDE_FLOAT64_C(   810.89), SIMDE_FLOAT64_C(  -949.98) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d r = simde_mm256_mask_expandloadu_pd(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -314.40), SIMDE_FLOAT64_C(   610.57), SIMDE_FLOAT64_C(   307.22), SIMDE_FLOAT64_C(  -971.52) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -314.40) } },
+    { UINT8_C(128),
+      { SIMDE_FLOAT64_C(   120.78), SIMDE_FLOAT64_C(  -557.86), SIMDE_FLOAT64_C(  -657.17), SIMDE_FLOAT64_C(   272.76) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 19),
+      { SIMDE_FLOAT64_C(  -145.76), SIMDE_FLOAT64_C(   881.36), SIMDE_FLOAT64_C(  -783.81), SIMDE_FLOAT64_C(   841.97) },
+      { SIMDE_FLOAT64_C(  -145.76), SIMDE_FLOAT64_C(   881.36), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(212),
+      { SIMDE_FLOAT64_C(   942.93), SIMDE_FLOAT64_C(  -774.46), SIMDE_FLOAT64_C(  -110.08), SIMDE_FLOAT64_C(  -921.01) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   942.93), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d r = simde_mm256_maskz_expandloadu_pd(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C(   7),  INT8_C(  95),  INT8_C( 126), -INT8_C(  34),      INT8_MIN, -INT8_C(  33), -INT8_C(  48),  INT8_C(  81),
+         INT8_C(  69),  INT8_C(  60),  INT8_C(   2), -INT8_C(  51),  INT8_C( 120), -INT8_C(  39),  INT8_C(  13), -INT8_C(  30),
+         INT8_C(  37), -INT8_C( 109),  INT8_C(  73),  INT8_C(  17), -INT8_C(   5), -INT8_C(  48), -INT8_C( 125),  INT8_C(  76),
+        -INT8_C(   1),  INT8_C( 109), -INT8_C(  67), -INT8_C( 117), -INT8_C(  68),  INT8_C(  61), -INT8_C(  15),  INT8_C(  37),
+         INT8_C(  37),  INT8_C(  34), -INT8_C( 117), -INT8_C(  69), -INT8_C(  29),  INT8_C(  98), -INT8_C( 121),  INT8_C(  18),
+         INT8_C( 103), -INT8_C(   8), -INT8_C(  20), -INT8_C(  50),  INT8_C(  17), -INT8_C(  64), -INT8_C(  89), -INT8_C( 102),
+         INT8_C(  55), -INT8_C(  40), -INT8_C(  25),  INT8_C(  30),  INT8_C(  88), -INT8_C(   5), -INT8_C(  95),  INT8_C(  11),
+        -INT8_C(  60),  INT8_C(  56),  INT8_C(  91),  INT8_C(  74), -INT8_C( 123), -INT8_C(  34),  INT8_C(  49),  INT8_C(  63) },
+      UINT64_C(15725556013411989470),
+      {  INT8_C(  52), -INT8_C(  43),  INT8_C(  23),  INT8_C(   3), -INT8_C( 122),  INT8_C(  64), -INT8_C(  99),  INT8_C(  98),
+         INT8_C(  42),  INT8_C(  97),  INT8_C(  65), -INT8_C(  55), -INT8_C(  34),  INT8_C(  90), -INT8_C(  88), -INT8_C(  54),
+        -INT8_C(  19), -INT8_C(  58), -INT8_C(  28),  INT8_C(  65), -INT8_C(  42),  INT8_C(  62), -INT8_C(   9), -INT8_C(  47),
+        -INT8_C(  49),  INT8_C(  81),  INT8_C(  52), -INT8_C(  20), -INT8_C(  66), -INT8_C(  75), -INT8_C(  34),  INT8_C(  95),
+         INT8_C(  81),  INT8_C(  62),  INT8_C( 105), -INT8_C(  47), -INT8_C(  46), -INT8_C(  98), -INT8_C(  77),  INT8_C(  42),
+         INT8_C(   6), -INT8_C(  44), -INT8_C(   5), -INT8_C( 126),  INT8_C(  55),  INT8_C(  61), -INT8_C(  52), -INT8_C( 105),
+        -INT8_C(  98), -INT8_C( 103),  INT8_C(  72), -INT8_C(  61), -INT8_C(  81), -INT8_C( 122),  INT8_C(  20), -INT8_C(  19),
+         INT8_C(  23),  INT8_C(   6), -INT8_C(  75),  INT8_C(  58),  INT8_C(  10), -INT8_C(  72),  INT8_C( 102), -INT8_C(  13) },
+      { -INT8_C(   7),  INT8_C(  52), -INT8_C(  43),  INT8_C(  23),  INT8_C(   3), -INT8_C(  33), -INT8_C( 122),  INT8_C(  64),
+        -INT8_C(  99),  INT8_C(  98),  INT8_C(  42), -INT8_C(  51),  INT8_C(  97),  INT8_C(  65), -INT8_C(  55), -INT8_C(  34),
+         INT8_C(  90), -INT8_C( 109), -INT8_C(  88), -INT8_C(  54), -INT8_C(   5), -INT8_C(  19), -INT8_C(  58), -INT8_C(  28),
+        -INT8_C(   1),  INT8_C(  65), -INT8_C(  67), -INT8_C(  42), -INT8_C(  68),  INT8_C(  62), -INT8_C(   9),  INT8_C(  37),
+         INT8_C(  37),  INT8_C(  34), -INT8_C( 117), -INT8_C(  69), -INT8_C(  29), -INT8_C(  47), -INT8_C(  49),  INT8_C(  81),
+         INT8_C(  52), -INT8_C(   8), -INT8_C(  20), -INT8_C(  50),  INT8_C(  17), -INT8_C(  66), -INT8_C(  75), -INT8_C( 102),
+         INT8_C(  55), -INT8_C(  40), -INT8_C(  34),  INT8_C(  95),  INT8_C(  81),  INT8_C(  62), -INT8_C(  95),  INT8_C(  11),
+        -INT8_C(  60),  INT8_C( 105),  INT8_C(  91), -INT8_C(  47), -INT8_C(  46), -INT8_C(  34), -INT8_C(  98), -INT8_C(  77) } },
+    { {  INT8_C(  74), -INT8_C(  40),  INT8_C( 126), -INT8_C(  61),  INT8_C(   4),  INT8_C(  70), -INT8_C(  70),  INT8_C(   6),
+        -INT8_C( 101), -INT8_C(  32), -INT8_C(  77),  INT8_C( 113),  INT8_C(  82),  INT8_C( 114),  INT8_C(  59),  INT8_C(  32),
+         INT8_C(  37),  INT8_C(  82),  INT8_C( 121), -INT8_C( 112), -INT8_C(  12),  INT8_C(  73),  INT8_C( 110),  INT8_C(  94),
+         INT8_C(   2),  INT8_C(  81),  INT8_C(  53),  INT8_C(  92), -INT8_C(  51),  INT8_C(  76), -INT8_C( 102),  INT8_C(  58),
+        -INT8_C( 110),  INT8_C(  53), -INT8_C(  71), -INT8_C(  68), -INT8_C(  35),  INT8_C(  35), -INT8_C( 120), -INT8_C(  90),
+         INT8_C(  40), -INT8_C( 113), -INT8_C(  57),  INT8_C(  60), -INT8_C(  76),  INT8_C(   1),  INT8_C( 124), -INT8_C(  50),
+         INT8_C( 110), -INT8_C( 106),  INT8_C( 111), -INT8_C(  45),  INT8_C( 109),  INT8_C(  27),  INT8_C( 119),  INT8_C(  70),
+         INT8_C(  87),  INT8_C(  31), -INT8_C( 120), -INT8_C(  46), -INT8_C(  93), -INT8_C( 106), -INT8_C(  19), -INT8_C(  84) },
+      UINT64_C(17840307747173694843),
+      { -INT8_C( 126),  INT8_C(   2),  INT8_C(  31),  INT8_C(  35),  INT8_C(   7), -INT8_C(  19), -INT8_C(  66), -INT8_C(  87),
+        -INT8_C(  16), -INT8_C(  89),  INT8_C(  22),  INT8_C(  73), -INT8_C( 111),  INT8_C(  97), -INT8_C(  95), -INT8_C(   1),
+        -INT8_C( 122),  INT8_C(  26), -INT8_C(  45),  INT8_C(  52),  INT8_C(   4), -INT8_C( 108), -INT8_C(  93),  INT8_C(  12),
+         INT8_C(  39), -INT8_C(  32),  INT8_C(  46), -INT8_C(  74), -INT8_C(   2), -INT8_C(  66), -INT8_C( 120),  INT8_C(   1),
+         INT8_C(  14), -INT8_C( 116), -INT8_C(  67),  INT8_C( 114),  INT8_C(  58), -INT8_C(  98), -INT8_C(  30),  INT8_C(  69),
+         INT8_C(  20),      INT8_MAX,  INT8_C(  19),  INT8_C( 109), -INT8_C(  71), -INT8_C(  25),  INT8_C(  54),  INT8_C(   4),
+         INT8_C(   8),  INT8_C(  58),  INT8_C(  79),  INT8_C(  61), -INT8_C(  71),  INT8_C(  33),  INT8_C(  35), -INT8_C(  91),
+        -INT8_C(  61),  INT8_C( 105), -INT8_C(  81),  INT8_C( 119), -INT8_C(  34), -INT8_C( 101),  INT8_C(  22),  INT8_C(   4) },
+      { -INT8_C( 126),  INT8_C(   2),  INT8_C( 126),  INT8_C(  31),  INT8_C(  35),  INT8_C(   7), -INT8_C(  19),  INT8_C(   6),
+        -INT8_C(  66), -INT8_C(  32), -INT8_C(  87), -INT8_C(  16), -INT8_C(  89),  INT8_C(  22),  INT8_C(  73), -INT8_C( 111),
+         INT8_C(  97), -INT8_C(  95), -INT8_C(   1), -INT8_C( 122), -INT8_C(  12),  INT8_C(  26), -INT8_C(  45),  INT8_C(  52),
+         INT8_C(   4),  INT8_C(  81),  INT8_C(  53),  INT8_C(  92), -INT8_C(  51),  INT8_C(  76), -INT8_C( 108), -INT8_C(  93),
+         INT8_C(  12),  INT8_C(  39), -INT8_C(  32),  INT8_C(  46), -INT8_C(  74),  INT8_C(  35), -INT8_C(   2), -INT8_C(  90),
+        -INT8_C(  66), -INT8_C( 113), -INT8_C(  57),  INT8_C(  60), -INT8_C(  76),  INT8_C(   1),  INT8_C( 124), -INT8_C( 120),
+         INT8_C(   1), -INT8_C( 106),  INT8_C(  14), -INT8_C(  45), -INT8_C( 116),  INT8_C(  27),  INT8_C( 119), -INT8_C(  67),
+         INT8_C( 114),  INT8_C(  58), -INT8_C(  98), -INT8_C(  46), -INT8_C(  30),  INT8_C(  69),  INT8_C(  20),      INT8_MAX } },
+    { {  INT8_C(  22),  INT8_C(  39), -INT8_C(   3),  INT8_C( 101),  INT8_C(  95), -INT8_C(  42),  INT8_C( 117),  INT8_C( 120),
+        -INT8_C(  71), -INT8_C(  87), -INT8_C(  99), -INT8_C(  79),  INT8_C(  95), -INT8_C(  46), -INT8_C(   7), -INT8_C(  35),
+         INT8_C(  57), -INT8_C(  83), -INT8_C( 101),  INT8_C(   9), -INT8_C(  78),  INT8_C(  72), -INT8_C(  51),  INT8_C( 118),
+         INT8_C(  39), -INT8_C(  41),  INT8_C(  23),  INT8_C(   4), -INT8_C( 104),  INT8_C(  76),  INT8_C( 125), -INT8_C(  57),
+        -INT8_C(  42), -INT8_C(  46), -INT8_C(  18), -INT8_C(  25), -INT8_C( 118),  INT8_C(  79),  INT8_C( 106),  INT8_C(  35),
+        -INT8_C(  21), -INT8_C(  94), -INT8_C(  85),  INT8_C(  18), -INT8_C(  75),  INT8_C(  69),  INT8_C( 108),  INT8_C(  11),
+         INT8_C(  33), -INT8_C(  47),  INT8_C(  99), -INT8_C(  75),  INT8_C(  85), -INT8_C(  47),  INT8_C(  25), -INT8_C(  23),
+         INT8_C(  34), -INT8_C(  20),  INT8_C(  17),  INT8_C(  97), -INT8_C(   7),  INT8_C(  99),  INT8_C(  93),  INT8_C( 116) },
+      UINT64_C(  693242165376444143),
+      { -INT8_C( 103), -INT8_C(  87), -INT8_C( 112), -INT8_C(  88), -INT8_C( 118), -INT8_C(  94),  INT8_C(  61), -INT8_C(  29),
+        -INT8_C(  82),  INT8_C(   6),  INT8_C(  68),  INT8_C( 100), -INT8_C( 119), -INT8_C(  66), -INT8_C(  97),  INT8_C(  22),
+         INT8_C(  54), -INT8_C(  12),  INT8_C( 126), -INT8_C(  62), -INT8_C(  11), -INT8_C(  44),  INT8_C(  96), -INT8_C(  65),
+        -INT8_C(  42), -INT8_C(  97),  INT8_C(  23),  INT8_C(  64),  INT8_C(  53), -INT8_C(   5),  INT8_C( 108),  INT8_C(  82),
+         INT8_C(  76),  INT8_C( 107),  INT8_C(  43),  INT8_C(  51), -INT8_C(  88), -INT8_C( 103), -INT8_C(  94), -INT8_C(  10),
+         INT8_C( 108), -INT8_C(  49),  INT8_C(  61), -INT8_C(  79), -INT8_C(  74), -INT8_C(  87), -INT8_C(  86),  INT8_C( 118),
+        -INT8_C( 110), -INT8_C(  97),  INT8_C(  52), -INT8_C(  77),  INT8_C(  19),  INT8_C(  58), -INT8_C(  64),  INT8_C(  94),
+         INT8_C(  55),  INT8_C( 114), -INT8_C( 107), -INT8_C(  72),  INT8_C(  54), -INT8_C( 116), -INT8_C(  83),  INT8_C(  51) },
+      { -INT8_C( 103), -INT8_C(  87), -INT8_C( 112), -INT8_C(  88),  INT8_C(  95), -INT8_C( 118), -INT8_C(  94),  INT8_C(  61),
+        -INT8_C(  71), -INT8_C(  29), -INT8_C(  82), -INT8_C(  79),  INT8_C(  95),  INT8_C(   6),  INT8_C(  68),  INT8_C( 100),
+        -INT8_C( 119), -INT8_C(  83), -INT8_C(  66),  INT8_C(   9), -INT8_C(  97),  INT8_C(  72), -INT8_C(  51),  INT8_C(  22),
+         INT8_C(  39),  INT8_C(  54),  INT8_C(  23),  INT8_C(   4), -INT8_C(  12),  INT8_C(  76),  INT8_C( 125),  INT8_C( 126),
+        -INT8_C(  62), -INT8_C(  11), -INT8_C(  18), -INT8_C(  25), -INT8_C(  44),  INT8_C(  79),  INT8_C( 106),  INT8_C(  35),
+        -INT8_C(  21), -INT8_C(  94),  INT8_C(  96),  INT8_C(  18), -INT8_C(  75), -INT8_C(  65), -INT8_C(  42), -INT8_C(  97),
+         INT8_C(  33),  INT8_C(  23),  INT8_C(  64),  INT8_C(  53), -INT8_C(   5), -INT8_C(  47),  INT8_C(  25),  INT8_C( 108),
+         INT8_C(  82), -INT8_C(  20),  INT8_C(  17),  INT8_C(  76), -INT8_C(   7),  INT8_C(  99),  INT8_C(  93),  INT8_C( 116) } },
+    { { -INT8_C(  64),  INT8_C(  49), -INT8_C(  95),  INT8_C(  37),  INT8_C( 113), -INT8_C(  49),  INT8_C(  16), -INT8_C(  90),
+         INT8_C(  70),  INT8_C(  99),  INT8_C(  81), -INT8_C(  90), -INT8_C(  48),  INT8_C(   2),  INT8_C(  24), -INT8_C(  88),
+        -INT8_C(  93), -INT8_C(   8), -INT8_C(  35),  INT8_C(  22),  INT8_C( 112), -INT8_C(  58),  INT8_C(  79), -INT8_C(  36),
+        -INT8_C(  55),  INT8_C( 105),  INT8_C(  27),  INT8_C(  43),  INT8_C(  12), -INT8_C(  27),  INT8_C(  10), -INT8_C( 103),
+         INT8_C(  12),  INT8_C(  76), -INT8_C( 125),  INT8_C(  99),  INT8_C(  94), -INT8_C(  90),  INT8_C(  39),  INT8_C(   5),
+         INT8_C( 115), -INT8_C(  40), -INT8_C(   2),  INT8_C( 117),  INT8_C( 114),  INT8_C(  31),  INT8_C(  45), -INT8_C(  67),
+         INT8_C(  32), -INT8_C( 119),  INT8_C( 120), -INT8_C(  93),  INT8_C(  92),  INT8_C(  20),  INT8_C(  71), -INT8_C(  73),
+        -INT8_C( 119), -INT8_C(  34),  INT8_C(  11), -INT8_C(  95),  INT8_C(  39),  INT8_C(  96),  INT8_C(  37),  INT8_C(  70) },
+      UINT64_C(   58653272770642074),
+      { -INT8_C(  84), -INT8_C( 104), -INT8_C(  36), -INT8_C(  13),  INT8_C(  27),  INT8_C(  92),  INT8_C( 102),  INT8_C(  69),
+        -INT8_C(  93), -INT8_C(   1), -INT8_C(  65),  INT8_C(  19),  INT8_C(  15),  INT8_C( 107), -INT8_C(  64),  INT8_C( 122),
+        -INT8_C(  25),  INT8_C(  63),  INT8_C(  64), -INT8_C(  10), -INT8_C( 105),  INT8_C(  67), -INT8_C(  27),  INT8_C( 122),
+         INT8_C(  94),  INT8_C( 114),  INT8_C(  49),  INT8_C(   3),  INT8_C(  97),  INT8_C( 105), -INT8_C(  79), -INT8_C( 127),
+        -INT8_C(  78),  INT8_C(   4),  INT8_C(  33),  INT8_C(  31), -INT8_C(   1), -INT8_C( 113), -INT8_C(  57),  INT8_C( 106),
+        -INT8_C(  82),  INT8_C( 123),  INT8_C( 120),  INT8_C(   0), -INT8_C( 105),  INT8_C(  69),  INT8_C(  41),  INT8_C(  19),
+         INT8_C(  26), -INT8_C(   2), -INT8_C(  20),  INT8_C(  25), -INT8_C(  26), -INT8_C(  65),  INT8_C(  71), -INT8_C( 105),
+        -INT8_C(   5), -INT8_C(  18), -INT8_C(  49), -INT8_C( 103), -INT8_C(  48),  INT8_C(  72), -INT8_C(  32), -INT8_C( 111) },
+      { -INT8_C(  64), -INT8_C(  84), -INT8_C(  95), -INT8_C( 104), -INT8_C(  36), -INT8_C(  49),  INT8_C(  16), -INT8_C(  13),
+         INT8_C(  70),  INT8_C(  99),  INT8_C(  81), -INT8_C(  90), -INT8_C(  48),  INT8_C(   2),  INT8_C(  24),  INT8_C(  27),
+        -INT8_C(  93), -INT8_C(   8), -INT8_C(  35),  INT8_C(  92),  INT8_C( 112),  INT8_C( 102),  INT8_C(  69), -INT8_C(  36),
+        -INT8_C(  55),  INT8_C( 105),  INT8_C(  27),  INT8_C(  43),  INT8_C(  12), -INT8_C(  27), -INT8_C(  93), -INT8_C( 103),
+        -INT8_C(   1), -INT8_C(  65),  INT8_C(  19),  INT8_C(  99),  INT8_C(  15), -INT8_C(  90),  INT8_C( 107), -INT8_C(  64),
+         INT8_C( 115), -INT8_C(  40), -INT8_C(   2),  INT8_C( 117),  INT8_C( 114),  INT8_C( 122), -INT8_C(  25), -INT8_C(  67),
+         INT8_C(  32), -INT8_C( 119),  INT8_C( 120), -INT8_C(  93),  INT8_C(  63),  INT8_C(  20),  INT8_C(  64), -INT8_C(  10),
+        -INT8_C( 119), -INT8_C(  34),  INT8_C(  11), -INT8_C(  95),  INT8_C(  39),  INT8_C(  96),  INT8_C(  37),  INT8_C(  70) } },
+    { {  INT8_C( 100), -INT8_C(   4), -INT8_C(   3),  INT8_C(  23),  INT8_C(  44),  INT8_C(  99),  INT8_C( 123), -INT8_C( 112),
+        -INT8_C( 117), -INT8_C(  44),  INT8_C(  84), -INT8_C(  73),  INT8_C(  56),  INT8_C(  50),  INT8_C(  13),  INT8_C(  21),
+        -INT8_C( 125),  INT8_C(  70),  INT8_C(  33),  INT8_C( 118),  INT8_C(   6),  INT8_C(  45), -INT8_C(  20), -INT8_C(  16),
+        -INT8_C(  21),  INT8_C( 109),  INT8_C( 108),  INT8_C(  79),  INT8_C(  38), -INT8_C(  27),  INT8_C(  36), -INT8_C( 122),
+         INT8_C(  14), -INT8_C(  32), -INT8_C(  33), -INT8_C(  79), -INT8_C(  75), -INT8_C(  78),  INT8_C(  78), -INT8_C(  73),
+        -INT8_C(  82),  INT8_C( 105),  INT8_C(   0), -INT8_C(  12),  INT8_C( 119), -INT8_C( 123), -INT8_C(  30),  INT8_C(  12),
+         INT8_C(  78),  INT8_C(  20),  INT8_C(  58), -INT8_C( 118),  INT8_C(  87), -INT8_C(   9), -INT8_C(  64), -INT8_C( 111),
+         INT8_C( 103), -INT8_C(  52),  INT8_C(  42),  INT8_C(  22),  INT8_C(  35),  INT8_C(  77), -INT8_C( 105), -INT8_C( 109) },
+      UINT64_C(13438666241828912599),
+      {  INT8_C(  75), -INT8_C(  82),  INT8_C( 124), -INT8_C(   5), -INT8_C(  24),  INT8_C(  76),  INT8_C(  70),  INT8_C(  56),
+         INT8_C(  32), -INT8_C(  48), -INT8_C( 120), -INT8_C(  29),  INT8_C(  24),  INT8_C(  10), -INT8_C(  97),  INT8_C(  30),
+        -INT8_C(  23), -INT8_C(  68), -INT8_C(  49), -INT8_C(  77),  INT8_C(  61), -INT8_C(  67),  INT8_C(  53),  INT8_C(  72),
+         INT8_C( 104),  INT8_C(  62),  INT8_C(  86),  INT8_C( 114), -INT8_C(  47),  INT8_C(  73), -INT8_C(  58),  INT8_C( 108),
+         INT8_C(  24), -INT8_C(  55), -INT8_C(  23), -INT8_C(   3), -INT8_C(  37), -INT8_C(  43),  INT8_C(  16),  INT8_C(   4),
+         INT8_C(  53),  INT8_C( 107), -INT8_C( 106), -INT8_C(  25), -INT8_C(  45), -INT8_C(  15), -INT8_C(  13),  INT8_C(  81),
+         INT8_C(  20), -INT8_C(  69),  INT8_C(  84), -INT8_C(  99), -INT8_C(  43), -INT8_C( 115),  INT8_C(  87), -INT8_C( 100),
+        -INT8_C(  10), -INT8_C(  42), -INT8_C(  79),  INT8_C(   2), -INT8_C(  10),  INT8_C(  39), -INT8_C( 111),  INT8_C(  66) },
+      {  INT8_C(  75), -INT8_C(  82),  INT8_C( 124),  INT8_C(  23), -INT8_C(   5),  INT8_C(  99), -INT8_C(  24),  INT8_C(  76),
+         INT8_C(  70), -INT8_C(  44),  INT8_C(  56),  INT8_C(  32), -INT8_C(  48), -INT8_C( 120), -INT8_C(  29),  INT8_C(  24),
+        -INT8_C( 125),  INT8_C(  10), -INT8_C(  97),  INT8_C(  30), -INT8_C(  23), -INT8_C(  68), -INT8_C(  20), -INT8_C(  16),
+        -INT8_C(  49), -INT8_C(  77),  INT8_C(  61), -INT8_C(  67),  INT8_C(  38),  INT8_C(  53),  INT8_C(  72),  INT8_C( 104),
+         INT8_C(  14),  INT8_C(  62),  INT8_C(  86),  INT8_C( 114), -INT8_C(  47),  INT8_C(  73),  INT8_C(  78), -INT8_C(  58),
+         INT8_C( 108),  INT8_C(  24),  INT8_C(   0), -INT8_C(  55), -INT8_C(  23), -INT8_C(   3), -INT8_C(  30), -INT8_C(  37),
+        -INT8_C(  43),  INT8_C(  16),  INT8_C(   4),  INT8_C(  53),  INT8_C( 107), -INT8_C( 106), -INT8_C(  25), -INT8_C( 111),
+         INT8_C( 103), -INT8_C(  45),  INT8_C(  42), -INT8_C(  15), -INT8_C(  13),  INT8_C(  81), -INT8_C( 105),  INT8_C(  20) } },
+    { { -INT8_C(  68), -INT8_C(  28),  INT8_C( 122),  INT8_C(  54),  INT8_C(  20), -INT8_C( 124), -INT8_C(  77),  INT8_C(  95),
+         INT8_C( 121),  INT8_C(  48), -INT8_C(  80),  INT8_C(  54), -INT8_C(  91), -INT8_C(  95), -INT8_C(  23),  INT8_C( 125),
+         INT8_C( 112), -INT8_C(  58), -INT8_C(  26),  INT8_C(  29), -INT8_C(  66), -INT8_C(  33), -INT8_C(  62), -INT8_C(  76),
+        -INT8_C(  65), -INT8_C( 111),  INT8_C(  59),  INT8_C(  93),  INT8_C(  95), -INT8_C(  57),  INT8_C(  79),  INT8_C(  16),
+        -INT8_C(  35),  INT8_C(  13), -INT8_C(  45), -INT8_C(  85), -INT8_C( 105),  INT8_C(  10),  INT8_C(  25),  INT8_C(  76),
+        -INT8_C(  26), -INT8_C(  70), -INT8_C(  78), -INT8_C(  22), -INT8_C(  82), -INT8_C(   7),  INT8_C(   3), -INT8_C(  84),
+        -INT8_C(  69),  INT8_C( 108), -INT8_C( 124),  INT8_C( 112),  INT8_C(   9), -INT8_C( 116),  INT8_C(  32), -INT8_C( 123),
+        -INT8_C( 126),  INT8_C(   7), -INT8_C( 126), -INT8_C(  46),  INT8_C( 115),  INT8_C(  88),  INT8_C(  12), -INT8_C(   5) },
+      UINT64_C( 3545282701140843474),
+      { -INT8_C(  74), -INT8_C( 100),  INT8_C(  12), -INT8_C(  83), -INT8_C(  90),  INT8_C(  37),  INT8_C(  22),  INT8_C(  27),
+         INT8_C( 125), -INT8_C(   3),  INT8_C(  56), -INT8_C( 102), -INT8_C( 113), -INT8_C(  14),  INT8_C(  56), -INT8_C(  36),
+         INT8_C(  48), -INT8_C(  60),  INT8_C(  77), -INT8_C(  92), -INT8_C(  54),  INT8_C(  88), -INT8_C(  62),  INT8_C(  47),
+        -INT8_C(  83), -INT8_C(  67), -INT8_C(  10), -INT8_C(   4), -INT8_C(  66), -INT8_C(  28), -INT8_C(   3),  INT8_C(  31),
+        -INT8_C(  79), -INT8_C(  34), -INT8_C( 125), -INT8_C(  91),  INT8_C(  62), -INT8_C(  72), -INT8_C( 111), -INT8_C(  37),
+         INT8_C(  74), -INT8_C(  20), -INT8_C(  28),  INT8_C(  63), -INT8_C(  14),  INT8_C(  24), -INT8_C(  69), -INT8_C(  92),
+        -INT8_C(  53),  INT8_C(  90),  INT8_C(  93),  INT8_C(  60), -INT8_C( 118), -INT8_C(  83), -INT8_C( 127),  INT8_C(  58),
+        -INT8_C(  55),  INT8_C(  53), -INT8_C( 110),  INT8_C(  64),  INT8_C( 122),  INT8_C(   2),  INT8_C(   9),  INT8_C(  18) },
+      { -INT8_C(  68), -INT8_C(  74),  INT8_C( 122),  INT8_C(  54), -INT8_C( 100), -INT8_C( 124),  INT8_C(  12), -INT8_C(  83),
+        -INT8_C(  90),  INT8_C(  37), -INT8_C(  80),  INT8_C(  22),  INT8_C(  27), -INT8_C(  95),  INT8_C( 125),  INT8_C( 125),
+         INT8_C( 112), -INT8_C(   3),  INT8_C(  56),  INT8_C(  29), -INT8_C( 102), -INT8_C(  33), -INT8_C( 113), -INT8_C(  14),
+         INT8_C(  56), -INT8_C( 111), -INT8_C(  36),  INT8_C(  48), -INT8_C(  60),  INT8_C(  77),  INT8_C(  79),  INT8_C(  16),
+        -INT8_C(  92),  INT8_C(  13), -INT8_C(  54), -INT8_C(  85),  INT8_C(  88),  INT8_C(  10), -INT8_C(  62),  INT8_C(  47),
+        -INT8_C(  83), -INT8_C(  67), -INT8_C(  10), -INT8_C(   4), -INT8_C(  66), -INT8_C(   7), -INT8_C(  28), -INT8_C(  84),
+        -INT8_C(   3),  INT8_C(  31), -INT8_C( 124),  INT8_C( 112), -INT8_C(  79), -INT8_C(  34),  INT8_C(  32), -INT8_C( 123),
+        -INT8_C( 125),  INT8_C(   7), -INT8_C( 126), -INT8_C(  46), -INT8_C(  91),  INT8_C(  62),  INT8_C(  12), -INT8_C(   5) } },
+    { { -INT8_C(  31), -INT8_C(  38), -INT8_C(  76),  INT8_C(  15),  INT8_C(  38), -INT8_C(  78), -INT8_C(  36), -INT8_C(  85),
+         INT8_C( 106),  INT8_C(  21),  INT8_C(  59),  INT8_C(  17),  INT8_C(  46),  INT8_C(   5),  INT8_C(  61), -INT8_C(  29),
+        -INT8_C( 107),  INT8_C( 104),  INT8_C(   9),  INT8_C(  50),  INT8_C(  68),  INT8_C(  67),  INT8_C( 125),  INT8_C(  70),
+         INT8_C(  45),  INT8_C(  70),  INT8_C( 112), -INT8_C(   6),  INT8_C( 107),  INT8_C(  59), -INT8_C(  70), -INT8_C(  22),
+        -INT8_C(  13),  INT8_C(  53),  INT8_C(  90), -INT8_C(   6),  INT8_C(  70),  INT8_C(  55),  INT8_C(  44),  INT8_C( 102),
+        -INT8_C(  47),  INT8_C( 120), -INT8_C( 104),  INT8_C(  80), -INT8_C( 126),  INT8_C(  44),  INT8_C(  18),  INT8_C(  94),
+        -INT8_C(  79), -INT8_C(  71), -INT8_C(  93), -INT8_C(   5),  INT8_C(   4), -INT8_C(  39),  INT8_C(  81),  INT8_C(  20),
+        -INT8_C(  60), -INT8_C(  21),  INT8_C( 112), -INT8_C(  33), -INT8_C(  48), -INT8_C(  46),  INT8_C( 104),  INT8_C( 115) },
+      UINT64_C( 5839515190875539460),
+      {  INT8_C(  64), -INT8_C(  79),  INT8_C(  26), -INT8_C(  65), -INT8_C(  34),  INT8_C(  33), -INT8_C(   3),  INT8_C(  65),
+        -INT8_C( 108),  INT8_C(  93), -INT8_C(  13),  INT8_C(  53), -INT8_C(   2),  INT8_C(  77), -INT8_C(  35),  INT8_C(  27),
+         INT8_C(  53), -INT8_C(   4),  INT8_C(  64), -INT8_C( 127), -INT8_C(  51), -INT8_C(  69), -INT8_C(  82), -INT8_C( 100),
+         INT8_C(  18), -INT8_C(   8),  INT8_C(  86), -INT8_C( 111), -INT8_C(  73), -INT8_C(  78), -INT8_C(  66), -INT8_C( 126),
+         INT8_C(   3), -INT8_C( 101), -INT8_C( 119), -INT8_C(  20), -INT8_C( 117), -INT8_C(  41),  INT8_C( 116),  INT8_C(  59),
+        -INT8_C(  16),  INT8_C(  27),  INT8_C(  30),  INT8_C(  37),  INT8_C( 116), -INT8_C(  49),  INT8_C(  68),  INT8_C(  43),
+         INT8_C(  33), -INT8_C(  97), -INT8_C( 107), -INT8_C( 109),  INT8_C(  54),  INT8_C( 106),  INT8_C(  30), -INT8_C(  76),
+         INT8_C( 105),  INT8_C(  88), -INT8_C(  98),  INT8_C(  32),  INT8_C(  42), -INT8_C(  47), -INT8_C(  51),  INT8_C(   8) },
+      { -INT8_C(  31), -INT8_C(  38),  INT8_C(  64),  INT8_C(  15),  INT8_C(  38), -INT8_C(  78), -INT8_C(  36), -INT8_C(  85),
+         INT8_C( 106),  INT8_C(  21),  INT8_C(  59), -INT8_C(  79),  INT8_C(  46),  INT8_C(   5),  INT8_C(  26), -INT8_C(  29),
+        -INT8_C( 107), -INT8_C(  65),  INT8_C(   9),  INT8_C(  50),  INT8_C(  68), -INT8_C(  34),  INT8_C( 125),  INT8_C(  33),
+         INT8_C(  45),  INT8_C(  70), -INT8_C(   3), -INT8_C(   6),  INT8_C( 107),  INT8_C(  59), -INT8_C(  70),  INT8_C(  65),
+        -INT8_C(  13),  INT8_C(  53),  INT8_C(  90), -INT8_C(   6),  INT8_C(  70), -INT8_C( 108),  INT8_C(  44),  INT8_C( 102),
+        -INT8_C(  47),  INT8_C( 120), -INT8_C( 104),  INT8_C(  80), -INT8_C( 126),  INT8_C(  93),  INT8_C(  18),  INT8_C(  94),
+        -INT8_C(  79), -INT8_C(  13), -INT8_C(  93),  INT8_C(  53),  INT8_C(   4), -INT8_C(  39),  INT8_C(  81),  INT8_C(  20),
+        -INT8_C(   2), -INT8_C(  21),  INT8_C( 112), -INT8_C(  33),  INT8_C(  77), -INT8_C(  46), -INT8_C(  35),  INT8_C( 115) } },
+    { { -INT8_C( 114),  INT8_C(  29), -INT8_C(  53), -INT8_C(  95),  INT8_C(  53),  INT8_C(  99),  INT8_C(  17),  INT8_C(  39),
+         INT8_C(  86),  INT8_C(  89), -INT8_C(  92),  INT8_C(  90),  INT8_C( 114), -INT8_C(  33),  INT8_C(   6),  INT8_C(  30),
+             INT8_MIN, -INT8_C(  72), -INT8_C( 102), -INT8_C( 109), -INT8_C(  97), -INT8_C(  67),  INT8_C(  71), -INT8_C(  41),
+        -INT8_C(  18),  INT8_C(  21),  INT8_C( 113),  INT8_C(  72), -INT8_C(  14), -INT8_C(   9), -INT8_C( 118), -INT8_C(  25),
+         INT8_C(  78), -INT8_C(  37), -INT8_C(  64),  INT8_C(  73),  INT8_C(  98),  INT8_C(  21), -INT8_C(  91),  INT8_C(  40),
+         INT8_C( 107),  INT8_C( 119),  INT8_C( 117), -INT8_C( 102),  INT8_C(  36), -INT8_C(  43),  INT8_C(  82), -INT8_C(  72),
+         INT8_C(  19), -INT8_C(  37),  INT8_C(  84), -INT8_C(  42),  INT8_C(   8),  INT8_C(   0),  INT8_C(  47),  INT8_C(   1),
+         INT8_C(  92),  INT8_C(  97),  INT8_C( 107), -INT8_C(  32),  INT8_C(  78), -INT8_C(  36),  INT8_C(  28), -INT8_C(  58) },
+      UINT64_C(14190282989652155166),
+      { -INT8_C( 106),  INT8_C(  39),  INT8_C(  18),  INT8_C(  59), -INT8_C( 115),  INT8_C( 112),  INT8_C( 121),      INT8_MIN,
+         INT8_C(  95), -INT8_C(  65), -INT8_C(  54), -INT8_C(  34), -INT8_C( 119), -INT8_C(  73),  INT8_C(  97),  INT8_C(  18),
+         INT8_C(  77), -INT8_C(  64),  INT8_C(  56), -INT8_C(  90), -INT8_C(  82), -INT8_C(  47), -INT8_C(  79),  INT8_C(  57),
+         INT8_C( 119), -INT8_C(  35),  INT8_C(  23), -INT8_C(  36),  INT8_C(  45),  INT8_C( 117),  INT8_C(   0), -INT8_C(  76),
+         INT8_C(  44), -INT8_C( 122), -INT8_C( 120), -INT8_C(  99),  INT8_C(  25),  INT8_C(  41), -INT8_C(  22), -INT8_C( 109),
+         INT8_C( 122), -INT8_C(  19), -INT8_C( 116), -INT8_C(  59),  INT8_C(  77), -INT8_C( 112), -INT8_C(  82),  INT8_C(  53),
+        -INT8_C(  47), -INT8_C(  19), -INT8_C(  92), -INT8_C(  25), -INT8_C( 112),  INT8_C(  99), -INT8_C(   9),  INT8_C(  30),
+         INT8_C(   4),  INT8_C(  38), -INT8_C( 111), -INT8_C( 115), -INT8_C(  93),  INT8_C(  71),  INT8_C(  29), -INT8_C( 114) },
+      { -INT8_C( 114), -INT8_C( 106),  INT8_C(  39),  INT8_C(  18),  INT8_C(  59),  INT8_C(  99),  INT8_C(  17),  INT8_C(  39),
+        -INT8_C( 115),  INT8_C( 112), -INT8_C(  92),  INT8_C( 121),      INT8_MIN, -INT8_C(  33),  INT8_C(   6),  INT8_C(  30),
+             INT8_MIN, -INT8_C(  72),  INT8_C(  95), -INT8_C(  65), -INT8_C(  54), -INT8_C(  34), -INT8_C( 119), -INT8_C(  41),
+        -INT8_C(  18),  INT8_C(  21), -INT8_C(  73),  INT8_C(  97),  INT8_C(  18), -INT8_C(   9), -INT8_C( 118), -INT8_C(  25),
+         INT8_C(  78),  INT8_C(  77), -INT8_C(  64),  INT8_C(  73), -INT8_C(  64),  INT8_C(  56), -INT8_C(  91),  INT8_C(  40),
+        -INT8_C(  90), -INT8_C(  82),  INT8_C( 117), -INT8_C( 102),  INT8_C(  36), -INT8_C(  43),  INT8_C(  82), -INT8_C(  72),
+         INT8_C(  19), -INT8_C(  47), -INT8_C(  79),  INT8_C(  57),  INT8_C(   8),  INT8_C( 119), -INT8_C(  35),  INT8_C(  23),
+         INT8_C(  92),  INT8_C(  97), -INT8_C(  36), -INT8_C(  32),  INT8_C(  78), -INT8_C(  36),  INT8_C(  45),  INT8_C( 117) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(   72057594315018881),
+      { -INT8_C(   4),  INT8_C(  43), -INT8_C(  86),  INT8_C(  41),  INT8_C(  65), -INT8_C(  16),  INT8_C(  12),  INT8_C(  33),
+         INT8_C(  86),  INT8_C(  73),  INT8_C(  66), -INT8_C( 109),  INT8_C(  67),  INT8_C(  23),  INT8_C(  58),  INT8_C(  30),
+         INT8_C(  92),  INT8_C(  30),  INT8_C(   4),  INT8_C( 105), -INT8_C(  16),  INT8_C(  22), -INT8_C( 105), -INT8_C(  95),
+         INT8_C(  92), -INT8_C( 124),  INT8_C(  44), -INT8_C( 124), -INT8_C(  32), -INT8_C(   9), -INT8_C( 118), -INT8_C(  92),
+         INT8_C(  30), -INT8_C(  34),  INT8_C( 109), -INT8_C(  16), -INT8_C(  50), -INT8_C(  76), -INT8_C( 122), -INT8_C(   3),
+        -INT8_C(  52),  INT8_C( 107), -INT8_C(  98),  INT8_C(   6), -INT8_C(  59),  INT8_C(  26), -INT8_C( 110), -INT8_C(  68),
+        -INT8_C(   5),  INT8_C(  54), -INT8_C(  86), -INT8_C(  22),  INT8_C(  77), -INT8_C(  16), -INT8_C( 108),  INT8_C(   5),
+         INT8_C( 122), -INT8_C(  90), -INT8_C(  88), -INT8_C( 122), -INT8_C(  74),  INT8_C(  10), -INT8_C(  45), -INT8_C(  42) },
+      { -INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43),
+         INT8_C(   0), -INT8_C(  86),  INT8_C(   0),  INT8_C(   0),  INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  33),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 7242201796414141359),
+      { -INT8_C(  72), -INT8_C(  65), -INT8_C(  59),      INT8_MAX,  INT8_C(  34),  INT8_C(  49), -INT8_C(  18),  INT8_C(  49),
+        -INT8_C(  46), -INT8_C(  88),  INT8_C(  93),  INT8_C(  49),  INT8_C(  79),  INT8_C(  70),  INT8_C(  50),  INT8_C(  68),
+         INT8_C( 101),  INT8_C(  40), -INT8_C(  71),  INT8_C(  88),  INT8_C(  48),  INT8_C(  25),  INT8_C(  51), -INT8_C(  90),
+        -INT8_C(  13),  INT8_C(  88),  INT8_C(  98), -INT8_C(  48), -INT8_C(  92), -INT8_C( 127),  INT8_C(  93),  INT8_C(  35),
+         INT8_C(  18), -INT8_C(  16), -INT8_C(  44),      INT8_MAX, -INT8_C( 109),  INT8_C(  39),  INT8_C(   5),  INT8_C(  40),
+        -INT8_C(  51), -INT8_C( 118),  INT8_C(  67), -INT8_C(  84), -INT8_C(  95), -INT8_C(   2),  INT8_C(  69), -INT8_C(  23),
+         INT8_C(  35),  INT8_C(  51), -INT8_C(  60),  INT8_C(   5),  INT8_C(  75), -INT8_C(  45),      INT8_MIN, -INT8_C(  22),
+        -INT8_C(   4),  INT8_C(   9),  INT8_C( 114),  INT8_C( 104), -INT8_C(  83),  INT8_C(  15), -INT8_C(  29),  INT8_C(  39) },
+      { -INT8_C(  72), -INT8_C(  65), -INT8_C(  59),      INT8_MAX,  INT8_C(   0),  INT8_C(  34),  INT8_C(   0),  INT8_C(  49),
+        -INT8_C(  18),  INT8_C(  49),  INT8_C(   0),  INT8_C(   0), -INT8_C(  46), -INT8_C(  88),  INT8_C(  93),  INT8_C(  49),
+         INT8_C(  79),  INT8_C(   0),  INT8_C(  70),  INT8_C(   0),  INT8_C(  50),  INT8_C(  68),  INT8_C( 101),  INT8_C(  40),
+         INT8_C(   0), -INT8_C(  71),  INT8_C(   0),  INT8_C(  88),  INT8_C(  48),  INT8_C(  25),  INT8_C(   0),  INT8_C(  51),
+        -INT8_C(  90),  INT8_C(   0),  INT8_C(   0), -INT8_C(  13),  INT8_C(   0),  INT8_C(  88),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  98), -INT8_C(  48), -INT8_C(  92), -INT8_C( 127),  INT8_C(   0),
+         INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  35),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  18),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16), -INT8_C(  44),  INT8_C(   0) } },
+    { UINT64_C( 1067928467471237562),
+      { -INT8_C(  24),  INT8_C(   6),  INT8_C(  31),  INT8_C(  12),  INT8_C( 100), -INT8_C(  45),  INT8_C(  40),  INT8_C(  85),
+             INT8_MIN, -INT8_C(   2),  INT8_C(   2), -INT8_C(  62), -INT8_C( 127),  INT8_C(  61), -INT8_C(   1), -INT8_C(  92),
+        -INT8_C(  62), -INT8_C(  52), -INT8_C(  89), -INT8_C( 100),  INT8_C( 121),  INT8_C(  11), -INT8_C(  82), -INT8_C(  23),
+        -INT8_C(  18),  INT8_C(  16),  INT8_C(  77),  INT8_C( 120), -INT8_C(   3),  INT8_C(   4), -INT8_C(  86),  INT8_C(  79),
+        -INT8_C(  79), -INT8_C( 101),  INT8_C(  53),  INT8_C(  83), -INT8_C(  71), -INT8_C( 118), -INT8_C(  62), -INT8_C(  54),
+        -INT8_C(  95), -INT8_C(  66), -INT8_C(  82), -INT8_C(  95),  INT8_C(  25),  INT8_C( 105), -INT8_C(  74), -INT8_C(  28),
+        -INT8_C(  39), -INT8_C(  81),  INT8_C(  59),  INT8_C(  58),  INT8_C( 114), -INT8_C( 122), -INT8_C(  43),  INT8_C( 109),
+         INT8_C(  41),  INT8_C(  43),  INT8_C(  58), -INT8_C( 106), -INT8_C(  89), -INT8_C(  80), -INT8_C(  37),  INT8_C(  70) },
+      {  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),  INT8_C(   6),  INT8_C(  31),  INT8_C(  12),  INT8_C(   0),  INT8_C( 100),
+        -INT8_C(  45),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  40),
+         INT8_C(   0),  INT8_C(  85),      INT8_MIN,  INT8_C(   0),  INT8_C(   0), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   0), -INT8_C(  62),  INT8_C(   0), -INT8_C( 127),  INT8_C(  61), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  92),  INT8_C(   0),  INT8_C(   0), -INT8_C(  62),  INT8_C(   0),
+        -INT8_C(  52), -INT8_C(  89),  INT8_C(   0), -INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0), -INT8_C(  82), -INT8_C(  23),
+         INT8_C(   0), -INT8_C(  18),  INT8_C(  16),  INT8_C(  77),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 3944445187014516703),
+      {      INT8_MIN,  INT8_C( 101), -INT8_C(  89),  INT8_C(  97), -INT8_C(  24), -INT8_C(  13),  INT8_C(  35),  INT8_C(  54),
+        -INT8_C( 125),  INT8_C(  76),  INT8_C( 101),  INT8_C( 122), -INT8_C(  71), -INT8_C( 124),  INT8_C(  97), -INT8_C(  17),
+        -INT8_C( 102), -INT8_C( 102),  INT8_C( 107),  INT8_C(  56),      INT8_MAX, -INT8_C(  73),  INT8_C(  78), -INT8_C(  67),
+         INT8_C(  82), -INT8_C(  10), -INT8_C(  49),  INT8_C(  73), -INT8_C(  79), -INT8_C(  39), -INT8_C(  55), -INT8_C(  40),
+         INT8_C( 119), -INT8_C(  21),  INT8_C(  57), -INT8_C(  13), -INT8_C(  12),  INT8_C(  16),  INT8_C(  80), -INT8_C( 105),
+         INT8_C(  12),  INT8_C(  55),  INT8_C( 125), -INT8_C(  86), -INT8_C( 101),  INT8_C(  95), -INT8_C(  16),  INT8_C(  83),
+        -INT8_C( 115),  INT8_C(  15), -INT8_C(  51),  INT8_C(   0),  INT8_C( 109),  INT8_C( 112),  INT8_C( 120), -INT8_C(  77),
+        -INT8_C( 101),  INT8_C(  56), -INT8_C(  74),  INT8_C(  41), -INT8_C(  76), -INT8_C(  85),  INT8_C(  15),  INT8_C(  82) },
+      {      INT8_MIN,  INT8_C( 101), -INT8_C(  89),  INT8_C(  97), -INT8_C(  24),  INT8_C(   0), -INT8_C(  13),  INT8_C(  35),
+         INT8_C(  54), -INT8_C( 125),  INT8_C(  76),  INT8_C( 101),  INT8_C( 122),  INT8_C(   0), -INT8_C(  71), -INT8_C( 124),
+         INT8_C(  97), -INT8_C(  17), -INT8_C( 102), -INT8_C( 102),  INT8_C( 107),  INT8_C(  56),      INT8_MAX, -INT8_C(  73),
+         INT8_C(  78), -INT8_C(  67),  INT8_C(  82), -INT8_C(  10), -INT8_C(  49),  INT8_C(  73),  INT8_C(   0), -INT8_C(  79),
+        -INT8_C(  39), -INT8_C(  55), -INT8_C(  40),  INT8_C( 119), -INT8_C(  21),  INT8_C(  57), -INT8_C(  13), -INT8_C(  12),
+         INT8_C(  16),  INT8_C(  80),  INT8_C(   0), -INT8_C( 105),  INT8_C(  12),  INT8_C(  55),  INT8_C( 125),  INT8_C(   0),
+        -INT8_C(  86),  INT8_C(   0), -INT8_C( 101),  INT8_C(  95), -INT8_C(  16),  INT8_C(  83),  INT8_C(   0), -INT8_C( 115),
+         INT8_C(   0),  INT8_C(  15), -INT8_C(  51),  INT8_C(   0),  INT8_C(   0),  INT8_C( 109),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 5238064934598611330),
+      {  INT8_C(  14),  INT8_C(  25), -INT8_C(  98),  INT8_C(  60),      INT8_MAX, -INT8_C(  99),  INT8_C(  16),  INT8_C(  37),
+        -INT8_C(  36),  INT8_C(  23), -INT8_C(  95), -INT8_C(  64), -INT8_C( 116),  INT8_C(  49), -INT8_C( 106),  INT8_C(  86),
+         INT8_C(  66),  INT8_C(  91), -INT8_C(  20), -INT8_C(  37), -INT8_C(  68), -INT8_C( 118), -INT8_C( 104), -INT8_C( 127),
+        -INT8_C(  94),  INT8_C( 109),  INT8_C( 103),  INT8_C(  24),  INT8_C(  13), -INT8_C(  80), -INT8_C( 102),  INT8_C(  74),
+        -INT8_C( 120),  INT8_C( 120),  INT8_C(  22),  INT8_C(   6), -INT8_C(  89), -INT8_C(  76), -INT8_C(  65), -INT8_C( 121),
+        -INT8_C(  29), -INT8_C(  89), -INT8_C(  70),  INT8_C( 112),  INT8_C(  26), -INT8_C(  67),  INT8_C(  20),  INT8_C(   0),
+        -INT8_C(  41), -INT8_C(  45),  INT8_C( 122), -INT8_C(  41),  INT8_C(  81), -INT8_C(  77),  INT8_C(  80), -INT8_C( 127),
+         INT8_C(  92),  INT8_C(  86), -INT8_C(  36), -INT8_C( 117), -INT8_C(  96),  INT8_C(  85),  INT8_C( 111), -INT8_C( 121) },
+      {  INT8_C(   0),  INT8_C(  14),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  25),
+        -INT8_C(  98),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),      INT8_MAX, -INT8_C(  99),  INT8_C(  16),  INT8_C(   0),  INT8_C(  37),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23), -INT8_C(  95), -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 116),  INT8_C(  49), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66),  INT8_C(  91),  INT8_C(   0), -INT8_C(  20),  INT8_C(   0),
+        -INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  68), -INT8_C( 118),  INT8_C(   0), -INT8_C( 104),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 127),  INT8_C(   0),  INT8_C(   0), -INT8_C(  94),  INT8_C(   0) } },
+    { UINT64_C( 5238510755539125527),
+      { -INT8_C(  82), -INT8_C(  84), -INT8_C(   3), -INT8_C(  43),  INT8_C(  94),      INT8_MIN, -INT8_C(  21), -INT8_C(   9),
+         INT8_C(  72), -INT8_C( 114),  INT8_C(  56),  INT8_C(  16), -INT8_C( 111), -INT8_C(  95),  INT8_C(  96), -INT8_C(  19),
+        -INT8_C(  68), -INT8_C(  22),  INT8_C(  18),  INT8_C(  71),  INT8_C( 104), -INT8_C(  11),      INT8_MIN, -INT8_C(  61),
+         INT8_C(  27),  INT8_C( 113),  INT8_C(  51),  INT8_C(  81),  INT8_C(  39), -INT8_C(  63),  INT8_C(  25), -INT8_C(  78),
+        -INT8_C(  62),  INT8_C(  12), -INT8_C(  60),  INT8_C(  54), -INT8_C(  47),  INT8_C(  67), -INT8_C(  10),  INT8_C(  68),
+        -INT8_C(  37),  INT8_C(  75), -INT8_C(  15),  INT8_C(  53), -INT8_C(  97), -INT8_C(  50), -INT8_C( 117), -INT8_C(  76),
+         INT8_C(  71),  INT8_C(  85), -INT8_C( 127),  INT8_C(   6),  INT8_C(  35),  INT8_C(  83),  INT8_C(  78),  INT8_C(  91),
+         INT8_C(  23),  INT8_C(  51), -INT8_C(  45),  INT8_C( 101),  INT8_C(  52),  INT8_C(  48), -INT8_C(  13),  INT8_C( 112) },
+      { -INT8_C(  82), -INT8_C(  84), -INT8_C(   3),  INT8_C(   0), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  94),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  21),  INT8_C(   0),  INT8_C(   0), -INT8_C(   9),  INT8_C(  72), -INT8_C( 114),  INT8_C(  56),  INT8_C(  16),
+        -INT8_C( 111), -INT8_C(  95),  INT8_C(  96), -INT8_C(  19), -INT8_C(  68), -INT8_C(  22),  INT8_C(  18),  INT8_C(  71),
+         INT8_C(   0),  INT8_C( 104), -INT8_C(  11),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN, -INT8_C(  61),
+         INT8_C(  27),  INT8_C(   0),  INT8_C( 113),  INT8_C(  51),  INT8_C(   0),  INT8_C(  81),  INT8_C(  39), -INT8_C(  63),
+         INT8_C(   0),  INT8_C(  25),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78), -INT8_C(  62),  INT8_C(   0),  INT8_C(  12),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(  54),  INT8_C(   0) } },
+    { UINT64_C(11250043650077725679),
+      { -INT8_C(  49),  INT8_C(  10), -INT8_C(  87),  INT8_C(  49), -INT8_C( 123), -INT8_C(  33), -INT8_C(  19),  INT8_C( 115),
+         INT8_C(  77), -INT8_C(  26), -INT8_C(  36),  INT8_C(  76), -INT8_C(  44),  INT8_C(  11), -INT8_C(  57),  INT8_C(  99),
+         INT8_C(  80),  INT8_C( 119), -INT8_C( 123),  INT8_C( 107), -INT8_C(  50), -INT8_C(  19), -INT8_C( 121), -INT8_C( 124),
+        -INT8_C(  16),  INT8_C(  10),  INT8_C(  92), -INT8_C(  40),  INT8_C(  24), -INT8_C(  60), -INT8_C(  46),  INT8_C(  30),
+         INT8_C(  48), -INT8_C(  45), -INT8_C(  71), -INT8_C(  99),  INT8_C(  57),  INT8_C(  25), -INT8_C(  80),  INT8_C(  68),
+        -INT8_C(  62),  INT8_C(  55), -INT8_C(  70),  INT8_C(   8), -INT8_C(   7),  INT8_C( 103), -INT8_C(  80), -INT8_C(  71),
+        -INT8_C(  21),  INT8_C(  35),  INT8_C( 109), -INT8_C(  38), -INT8_C(   7),  INT8_C(  86),  INT8_C(   8), -INT8_C( 113),
+        -INT8_C(  57),  INT8_C(  73),  INT8_C(  99), -INT8_C(   3), -INT8_C(  73),  INT8_C( 118),  INT8_C(  30), -INT8_C(   7) },
+      { -INT8_C(  49),  INT8_C(  10), -INT8_C(  87),  INT8_C(  49),  INT8_C(   0), -INT8_C( 123), -INT8_C(  33), -INT8_C(  19),
+         INT8_C( 115),  INT8_C(  77),  INT8_C(   0),  INT8_C(   0), -INT8_C(  26),  INT8_C(   0),  INT8_C(   0), -INT8_C(  36),
+         INT8_C(  76),  INT8_C(   0), -INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11),
+         INT8_C(   0), -INT8_C(  57),  INT8_C(  99),  INT8_C(  80),  INT8_C(   0),  INT8_C( 119),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 123),  INT8_C( 107),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  50), -INT8_C(  19), -INT8_C( 121), -INT8_C( 124),  INT8_C(   0), -INT8_C(  16),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  10),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  92), -INT8_C(  40),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0), -INT8_C(  60) } },
+    { UINT64_C( 9861974912028581666),
+      {  INT8_C( 110), -INT8_C(  13), -INT8_C(  80), -INT8_C(  83),  INT8_C( 124), -INT8_C(  84), -INT8_C(  87),  INT8_C(  85),
+         INT8_C(  11), -INT8_C( 113),  INT8_C( 101),  INT8_C(  58), -INT8_C(  16), -INT8_C(  21),  INT8_C(  82), -INT8_C(  92),
+        -INT8_C(  59),  INT8_C( 121),  INT8_C(  50),  INT8_C(  98), -INT8_C(  47), -INT8_C(   5), -INT8_C(  74),  INT8_C(   9),
+         INT8_C(  58),  INT8_C(  54), -INT8_C(  87),  INT8_C( 104),  INT8_C(  99),  INT8_C(  90), -INT8_C( 101), -INT8_C(  97),
+         INT8_C(  57),  INT8_C( 101),  INT8_C(  67),  INT8_C(  49), -INT8_C(  26), -INT8_C(  55), -INT8_C(  92),  INT8_C(  94),
+        -INT8_C(  27), -INT8_C(  83), -INT8_C( 106), -INT8_C(  58),  INT8_C(  83),  INT8_C(   3),  INT8_C(  87), -INT8_C(  21),
+         INT8_C(  80), -INT8_C(  44),  INT8_C(  93), -INT8_C(  66),  INT8_C(  17),  INT8_C(  57), -INT8_C(  90),  INT8_C(  81),
+        -INT8_C(   7),  INT8_C(  20),  INT8_C(  87), -INT8_C(  57),  INT8_C(  18),  INT8_C( 101),  INT8_C(  98),  INT8_C(  94) },
+      {  INT8_C(   0),  INT8_C( 110),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  13),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  80), -INT8_C(  83),  INT8_C( 124), -INT8_C(  84), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  85),  INT8_C(  11), -INT8_C( 113),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 101),  INT8_C(   0),
+         INT8_C(  58), -INT8_C(  16), -INT8_C(  21),  INT8_C(   0),  INT8_C(  82), -INT8_C(  92), -INT8_C(  59),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 121),  INT8_C(  50),  INT8_C(  98),  INT8_C(   0), -INT8_C(  47), -INT8_C(   5), -INT8_C(  74),
+         INT8_C(   9),  INT8_C(   0),  INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  54), -INT8_C(  87),
+         INT8_C(   0),  INT8_C(   0),  INT8_C( 104),  INT8_C(  99),  INT8_C(  90),  INT8_C(   0), -INT8_C( 101), -INT8_C(  97),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  57),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 101) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C(  26), -INT8_C(  99), -INT8_C(  25), -INT8_C(  96), -INT8_C(  68), -INT8_C(   6),  INT8_C(  45), -INT8_C(  18),
+        -INT8_C(  33), -INT8_C( 102), -INT8_C( 127),  INT8_C(   1),  INT8_C(  68),  INT8_C( 109),  INT8_C(  66),  INT8_C(  22),
+        -INT8_C( 104),  INT8_C(  44),  INT8_C(  65),  INT8_C( 100),  INT8_C(  27),  INT8_C(  55), -INT8_C(  96),  INT8_C(  14),
+         INT8_C(   7),  INT8_C(  33), -INT8_C( 124),  INT8_C(  30),  INT8_C(  24),  INT8_C(   0), -INT8_C(  21),  INT8_C( 109),
+        -INT8_C(  39),  INT8_C(  61), -INT8_C( 105),  INT8_C(  93),  INT8_C( 116),  INT8_C(  48),  INT8_C(  62), -INT8_C(  42),
+        -INT8_C(  53), -INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  77), -INT8_C( 107),  INT8_C(  67),  INT8_C( 115),
+        -INT8_C( 121),  INT8_C(  46), -INT8_C(  63), -INT8_C(  55),  INT8_C( 119), -INT8_C( 118), -INT8_C( 112), -INT8_C(  32),
+         INT8_C(  90), -INT8_C(  71),  INT8_C(  79), -INT8_C(  37), -INT8_C(  46),  INT8_C(  52),  INT8_C(  18),  INT8_C(   5) },
+      UINT64_C(17293118854779600605),
+      {  INT8_C(  51),  INT8_C(  46),  INT8_C(   2), -INT8_C( 103),  INT8_C(  95),  INT8_C(  56), -INT8_C( 126),  INT8_C(  72),
+        -INT8_C(  10),  INT8_C(  38),  INT8_C( 125), -INT8_C(  91),  INT8_C(  24),  INT8_C(  52),  INT8_C(  86),  INT8_C( 110),
+         INT8_C(  58), -INT8_C(  96),  INT8_C(  48), -INT8_C( 100), -INT8_C(  43),  INT8_C(  90), -INT8_C(  42),  INT8_C(   0),
+        -INT8_C(  74),  INT8_C(  39), -INT8_C( 124), -INT8_C( 123), -INT8_C(  49),  INT8_C( 109), -INT8_C(  84), -INT8_C(   4),
+         INT8_C( 115), -INT8_C(  23),  INT8_C(  62),  INT8_C(  41), -INT8_C(  74),  INT8_C(  97), -INT8_C(  13),  INT8_C(  66),
+        -INT8_C( 104),  INT8_C(  94), -INT8_C(  40),  INT8_C(  89), -INT8_C(  74),  INT8_C( 118), -INT8_C( 123), -INT8_C(  15),
+         INT8_C(  33),  INT8_C(  59), -INT8_C(  66), -INT8_C(  91), -INT8_C(  74),  INT8_C(  12),  INT8_C(   9),  INT8_C(  35),
+         INT8_C(  23),  INT8_C(  40),  INT8_C(  92),  INT8_C(  82), -INT8_C(  16), -INT8_C(  40), -INT8_C(   6),  INT8_C( 114) },
+      {  INT8_C(  51), -INT8_C(  99),  INT8_C(  46),  INT8_C(   2), -INT8_C( 103), -INT8_C(   6),  INT8_C(  95),  INT8_C(  56),
+        -INT8_C(  33), -INT8_C( 126),  INT8_C(  72), -INT8_C(  10),  INT8_C(  38),  INT8_C( 125), -INT8_C(  91),  INT8_C(  22),
+         INT8_C(  24),  INT8_C(  52),  INT8_C(  86),  INT8_C( 110),  INT8_C(  58), -INT8_C(  96), -INT8_C(  96),  INT8_C(  48),
+        -INT8_C( 100),  INT8_C(  33), -INT8_C(  43),  INT8_C(  90), -INT8_C(  42),  INT8_C(   0), -INT8_C(  21), -INT8_C(  74),
+         INT8_C(  39),  INT8_C(  61), -INT8_C( 105), -INT8_C( 124), -INT8_C( 123), -INT8_C(  49),  INT8_C( 109), -INT8_C(  84),
+        -INT8_C(   4),  INT8_C( 115), -INT8_C(  23),  INT8_C(  62),  INT8_C(  41), -INT8_C(  74),  INT8_C(  97),  INT8_C( 115),
+        -INT8_C(  13),  INT8_C(  46),  INT8_C(  66), -INT8_C( 104),  INT8_C(  94), -INT8_C(  40),  INT8_C(  89), -INT8_C(  74),
+         INT8_C( 118), -INT8_C( 123), -INT8_C(  15),  INT8_C(  33), -INT8_C(  46),  INT8_C(  59), -INT8_C(  66), -INT8_C(  91) } },
+    { {  INT8_C(  64),  INT8_C(  54), -INT8_C(  58),  INT8_C( 108), -INT8_C(  83),  INT8_C(  83), -INT8_C(  95), -INT8_C(  10),
+         INT8_C(  65),  INT8_C(   1),  INT8_C(  96),  INT8_C(  48), -INT8_C( 111),  INT8_C( 116), -INT8_C(  94),  INT8_C(  88),
+         INT8_C(  15),  INT8_C( 111), -INT8_C( 125),  INT8_C(  28), -INT8_C(  90),  INT8_C(  93), -INT8_C(  40), -INT8_C(  72),
+        -INT8_C(  71),  INT8_C( 122),  INT8_C(  51),  INT8_C(  24),  INT8_C(  46), -INT8_C(  33), -INT8_C(  76),  INT8_C(  17),
+        -INT8_C(  36),  INT8_C(  73), -INT8_C(  50),  INT8_C(  58), -INT8_C(  33), -INT8_C(  45),  INT8_C(  84),  INT8_C(  73),
+         INT8_C(   1),  INT8_C(  66),  INT8_C(  68), -INT8_C(  63),  INT8_C( 120),  INT8_C(   4), -INT8_C( 111), -INT8_C(  37),
+        -INT8_C(  26),  INT8_C( 115),  INT8_C( 108), -INT8_C(  10), -INT8_C(  73),  INT8_C( 102), -INT8_C(  73),  INT8_C(  62),
+        -INT8_C(   9), -INT8_C(  29), -INT8_C(  25),  INT8_C(  32), -INT8_C(  41),  INT8_C(  59),  INT8_C(   6), -INT8_C(  14) },
+      UINT64_C(17125435510278767297),
+      { -INT8_C(  67), -INT8_C( 112),  INT8_C(  30),  INT8_C(  56),  INT8_C(  26), -INT8_C( 103),  INT8_C(  85),  INT8_C(  12),
+        -INT8_C(  81),  INT8_C(  66), -INT8_C( 110), -INT8_C(  71), -INT8_C(  43),  INT8_C(  51),  INT8_C( 102), -INT8_C(  52),
+         INT8_C(  17),  INT8_C( 126), -INT8_C(  61), -INT8_C(  83),  INT8_C(  40),  INT8_C(  73), -INT8_C(  58),  INT8_C( 107),
+         INT8_C(  27), -INT8_C(  18), -INT8_C(  94), -INT8_C(  51), -INT8_C(  73), -INT8_C( 121),  INT8_C(  81), -INT8_C(  86),
+        -INT8_C(  73), -INT8_C(  34),  INT8_C(  59), -INT8_C(  13), -INT8_C( 108), -INT8_C(  67),  INT8_C(  93),  INT8_C(  64),
+        -INT8_C( 100), -INT8_C(   1),  INT8_C(  99),  INT8_C( 104),  INT8_C(   2), -INT8_C( 127), -INT8_C(  50), -INT8_C(  71),
+        -INT8_C(  20),  INT8_C(  65), -INT8_C(  43),  INT8_C(  34), -INT8_C(  17), -INT8_C(  31),  INT8_C(  29),  INT8_C(   5),
+         INT8_C(  55), -INT8_C(  52),  INT8_C(  10), -INT8_C( 106),  INT8_C(  93), -INT8_C(  59),  INT8_C( 125), -INT8_C( 110) },
+      { -INT8_C(  67),  INT8_C(  54), -INT8_C(  58),  INT8_C( 108), -INT8_C(  83),  INT8_C(  83), -INT8_C( 112),  INT8_C(  30),
+         INT8_C(  65),  INT8_C(  56),  INT8_C(  96),  INT8_C(  48), -INT8_C( 111),  INT8_C( 116),  INT8_C(  26), -INT8_C( 103),
+         INT8_C(  15),  INT8_C(  85),  INT8_C(  12),  INT8_C(  28), -INT8_C(  90),  INT8_C(  93), -INT8_C(  40), -INT8_C(  72),
+        -INT8_C(  71), -INT8_C(  81),  INT8_C(  66),  INT8_C(  24), -INT8_C( 110), -INT8_C(  71), -INT8_C(  76), -INT8_C(  43),
+        -INT8_C(  36),  INT8_C(  73),  INT8_C(  51),  INT8_C( 102), -INT8_C(  52), -INT8_C(  45),  INT8_C(  17),  INT8_C( 126),
+         INT8_C(   1),  INT8_C(  66), -INT8_C(  61), -INT8_C(  63),  INT8_C( 120),  INT8_C(   4), -INT8_C(  83),  INT8_C(  40),
+         INT8_C(  73),  INT8_C( 115),  INT8_C( 108), -INT8_C(  58), -INT8_C(  73),  INT8_C( 107), -INT8_C(  73),  INT8_C(  27),
+        -INT8_C(  18), -INT8_C(  29), -INT8_C(  94), -INT8_C(  51), -INT8_C(  41), -INT8_C(  73), -INT8_C( 121),  INT8_C(  81) } },
+    { { -INT8_C( 116),  INT8_C(  71),  INT8_C( 126), -INT8_C(  94), -INT8_C(  69), -INT8_C( 107),  INT8_C(  62),  INT8_C(  85),
+         INT8_C(  64),  INT8_C(  29),  INT8_C( 122),  INT8_C(   5), -INT8_C( 116), -INT8_C(  54), -INT8_C(  50), -INT8_C(  75),
+         INT8_C(  56),  INT8_C(  62),  INT8_C(   6), -INT8_C(  60),  INT8_C(  57),  INT8_C( 125),  INT8_C(  68), -INT8_C( 109),
+         INT8_C(  48), -INT8_C(  78),  INT8_C(  65),  INT8_C( 100),  INT8_C(  41), -INT8_C(  67), -INT8_C(  57),  INT8_C( 117),
+        -INT8_C(  62), -INT8_C(  16), -INT8_C(  88), -INT8_C(  18), -INT8_C(  16), -INT8_C( 113), -INT8_C(  40), -INT8_C(  66),
+         INT8_C(  20),  INT8_C( 102), -INT8_C(  87), -INT8_C( 114), -INT8_C(  84),  INT8_C(  57),  INT8_C( 121),  INT8_C( 109),
+        -INT8_C( 121), -INT8_C(  38), -INT8_C( 110), -INT8_C(  47), -INT8_C(  88), -INT8_C(  77),  INT8_C(  43), -INT8_C( 117),
+         INT8_C(  28), -INT8_C(  36),  INT8_C(   5), -INT8_C( 103),  INT8_C(  99), -INT8_C(  15), -INT8_C(  75), -INT8_C(  93) },
+      UINT64_C( 7493980829048061887),
+      {  INT8_C(  50), -INT8_C(  36), -INT8_C(  51), -INT8_C(  47),  INT8_C(  72), -INT8_C( 115),  INT8_C(  76), -INT8_C( 121),
+        -INT8_C( 114),  INT8_C( 116),  INT8_C(  41),  INT8_C(  53), -INT8_C(  99),  INT8_C( 103),  INT8_C(  82), -INT8_C(  37),
+        -INT8_C(  93),  INT8_C(  34),  INT8_C(  34),      INT8_MIN, -INT8_C(   9), -INT8_C(  85), -INT8_C(  68), -INT8_C(  68),
+         INT8_C( 101), -INT8_C(  75),  INT8_C(  48),  INT8_C(  97),  INT8_C(  49),  INT8_C(  13),  INT8_C(  89),  INT8_C( 105),
+        -INT8_C( 115),  INT8_C(  13), -INT8_C(   2),  INT8_C(  80),  INT8_C( 100),  INT8_C(  54),  INT8_C( 117),  INT8_C(   2),
+        -INT8_C( 114), -INT8_C(  24), -INT8_C(  50),  INT8_C(  62), -INT8_C( 102), -INT8_C(  74),  INT8_C( 112), -INT8_C(  49),
+         INT8_C(  42),  INT8_C(  25),  INT8_C(  53),  INT8_C(  94), -INT8_C(  78),  INT8_C(  13),  INT8_C(  16),  INT8_C(  92),
+         INT8_C(  42), -INT8_C(   5),  INT8_C(  35),  INT8_C(  65), -INT8_C(  10),  INT8_C(  82),      INT8_MAX, -INT8_C(  83) },
+      {  INT8_C(  50), -INT8_C(  36), -INT8_C(  51), -INT8_C(  47),  INT8_C(  72), -INT8_C( 115),  INT8_C(  62),  INT8_C(  76),
+        -INT8_C( 121), -INT8_C( 114),  INT8_C( 116),  INT8_C(  41),  INT8_C(  53), -INT8_C(  99), -INT8_C(  50), -INT8_C(  75),
+         INT8_C( 103),  INT8_C(  82), -INT8_C(  37), -INT8_C(  93),  INT8_C(  34),  INT8_C(  34),      INT8_MIN, -INT8_C(   9),
+         INT8_C(  48), -INT8_C(  78), -INT8_C(  85),  INT8_C( 100), -INT8_C(  68), -INT8_C(  68),  INT8_C( 101), -INT8_C(  75),
+         INT8_C(  48),  INT8_C(  97), -INT8_C(  88),  INT8_C(  49),  INT8_C(  13), -INT8_C( 113),  INT8_C(  89),  INT8_C( 105),
+        -INT8_C( 115),  INT8_C(  13), -INT8_C(   2), -INT8_C( 114),  INT8_C(  80),  INT8_C( 100),  INT8_C(  54),  INT8_C( 117),
+         INT8_C(   2), -INT8_C( 114), -INT8_C(  24), -INT8_C(  50),  INT8_C(  62), -INT8_C( 102), -INT8_C(  74),  INT8_C( 112),
+        -INT8_C(  49),  INT8_C(  42),  INT8_C(  25), -INT8_C( 103),  INT8_C(  99),  INT8_C(  53),  INT8_C(  94), -INT8_C(  93) } },
+    { { -INT8_C(   1), -INT8_C(  67), -INT8_C(  28), -INT8_C(   1), -INT8_C(   5),  INT8_C(  27), -INT8_C(  77),  INT8_C(  65),
+        -INT8_C(  22),  INT8_C( 101), -INT8_C(  95), -INT8_C( 114),  INT8_C( 115),  INT8_C(  78), -INT8_C(  52),  INT8_C(  19),
+         INT8_C(  43), -INT8_C(  16), -INT8_C(  45), -INT8_C(  18), -INT8_C(  50),  INT8_C(  94),  INT8_C(   4), -INT8_C(   5),
+        -INT8_C(  36),  INT8_C(  97), -INT8_C(  94),  INT8_C( 107), -INT8_C(  29),  INT8_C(   1), -INT8_C(  13),  INT8_C(  70),
+        -INT8_C(  52),  INT8_C(   8), -INT8_C(  22),  INT8_C(   1), -INT8_C(  75), -INT8_C( 108), -INT8_C(  86), -INT8_C(  68),
+        -INT8_C(  75), -INT8_C(  99), -INT8_C(  67),  INT8_C(  43),  INT8_C(  68), -INT8_C( 127),  INT8_C(   4), -INT8_C(  57),
+        -INT8_C(  81),  INT8_C(  35), -INT8_C(  18),  INT8_C(  77),  INT8_C(  24), -INT8_C(  26),  INT8_C(  31),      INT8_MIN,
+         INT8_C(   9), -INT8_C(  89), -INT8_C(  27), -INT8_C(   6), -INT8_C( 118),  INT8_C(  26),  INT8_C(   4),  INT8_C( 123) },
+      UINT64_C(11308618385161666230),
+      {  INT8_C(  70), -INT8_C( 111), -INT8_C(  40),  INT8_C( 113), -INT8_C(  87), -INT8_C(  10), -INT8_C(  35), -INT8_C(  75),
+        -INT8_C( 114),  INT8_C(  95),  INT8_C(   9),  INT8_C(  46),  INT8_C(  78), -INT8_C(  33), -INT8_C(  38),  INT8_C(  11),
+        -INT8_C(  65), -INT8_C(  79), -INT8_C(   9), -INT8_C( 108),  INT8_C(  23), -INT8_C(  85),  INT8_C(  15),  INT8_C(   5),
+        -INT8_C(  56), -INT8_C(  69),  INT8_C(  25),  INT8_C(  60), -INT8_C(  73), -INT8_C(  37),  INT8_C( 105),  INT8_C(  62),
+         INT8_C(  51), -INT8_C(  65), -INT8_C(  90), -INT8_C(  36),  INT8_C(  64),  INT8_C(  21), -INT8_C( 116),  INT8_C(  84),
+        -INT8_C(  92), -INT8_C(  62), -INT8_C(  52), -INT8_C(  64),  INT8_C(  67), -INT8_C(  92),  INT8_C(  80),  INT8_C(  19),
+         INT8_C(  39),  INT8_C(  80),  INT8_C( 124), -INT8_C(  59), -INT8_C( 121), -INT8_C(  35),  INT8_C(  18), -INT8_C(   1),
+         INT8_C(  31),  INT8_C( 112),  INT8_C(   9),  INT8_C(  75), -INT8_C( 109), -INT8_C(  84),  INT8_C(  17),  INT8_C(  81) },
+      { -INT8_C(   1),  INT8_C(  70), -INT8_C( 111), -INT8_C(   1), -INT8_C(  40),  INT8_C( 113), -INT8_C(  77), -INT8_C(  87),
+        -INT8_C(  22), -INT8_C(  10), -INT8_C(  35), -INT8_C(  75), -INT8_C( 114),  INT8_C(  95), -INT8_C(  52),  INT8_C(  19),
+         INT8_C(   9),  INT8_C(  46), -INT8_C(  45), -INT8_C(  18), -INT8_C(  50),  INT8_C(  94),  INT8_C(   4), -INT8_C(   5),
+        -INT8_C(  36),  INT8_C(  97),  INT8_C(  78),  INT8_C( 107), -INT8_C(  33), -INT8_C(  38),  INT8_C(  11),  INT8_C(  70),
+        -INT8_C(  65),  INT8_C(   8), -INT8_C(  22),  INT8_C(   1), -INT8_C(  75), -INT8_C( 108), -INT8_C(  86), -INT8_C(  79),
+        -INT8_C(  75), -INT8_C(  99), -INT8_C(  67), -INT8_C(   9),  INT8_C(  68), -INT8_C( 127), -INT8_C( 108), -INT8_C(  57),
+        -INT8_C(  81),  INT8_C(  35), -INT8_C(  18),  INT8_C(  77),  INT8_C(  23), -INT8_C(  85),  INT8_C(  15),  INT8_C(   5),
+         INT8_C(   9), -INT8_C(  89), -INT8_C(  56), -INT8_C(  69),  INT8_C(  25),  INT8_C(  26),  INT8_C(   4),  INT8_C(  60) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i r = simde_mm512_mask_expandloadu_epi8(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C( 3642226126232705188),
+      {  INT8_C(  67), -INT8_C( 120),  INT8_C(  44), -INT8_C(  32),  INT8_C(  77),  INT8_C( 123), -INT8_C(   3),  INT8_C(  35),
+         INT8_C( 100),  INT8_C(  23),  INT8_C(  82),  INT8_C(  85),  INT8_C( 100), -INT8_C(  28), -INT8_C(  36),  INT8_C(  47),
+         INT8_C(  32),  INT8_C( 110),  INT8_C(  21),  INT8_C(  73),  INT8_C(  66), -INT8_C(  65), -INT8_C(  98), -INT8_C(  25),
+        -INT8_C( 117),  INT8_C(  42),      INT8_MIN,  INT8_C(  35),  INT8_C(  40),  INT8_C(  15),  INT8_C(  33),  INT8_C(  76),
+        -INT8_C(  27), -INT8_C(  72),  INT8_C(  32),  INT8_C(   1),  INT8_C( 120), -INT8_C(  49), -INT8_C(  30), -INT8_C(  82),
+        -INT8_C( 111), -INT8_C(  33),  INT8_C(  65), -INT8_C(  83), -INT8_C( 112), -INT8_C( 101),  INT8_C(  21), -INT8_C(  29),
+        -INT8_C(  84),  INT8_C(  77), -INT8_C(  19), -INT8_C(  97), -INT8_C(  82), -INT8_C( 124),  INT8_C( 101), -INT8_C(   1),
+         INT8_C(   8),  INT8_C(  64), -INT8_C( 127),  INT8_C(  22), -INT8_C(  43),  INT8_C( 103),  INT8_C(  88),  INT8_C(  17) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  67),  INT8_C(   0),  INT8_C(   0), -INT8_C( 120),  INT8_C(   0),  INT8_C(  44),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  32),  INT8_C(  77),  INT8_C(   0),  INT8_C( 123),  INT8_C(   0),
+        -INT8_C(   3),  INT8_C(  35),  INT8_C( 100),  INT8_C(  23),  INT8_C(  82),  INT8_C(  85),  INT8_C(   0),  INT8_C( 100),
+        -INT8_C(  28),  INT8_C(   0), -INT8_C(  36),  INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),
+         INT8_C( 110),  INT8_C(   0),  INT8_C(  21),  INT8_C(  73),  INT8_C(  66),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0),
+        -INT8_C(  98),  INT8_C(   0),  INT8_C(   0), -INT8_C(  25),  INT8_C(   0),  INT8_C(   0), -INT8_C( 117),  INT8_C(  42),
+             INT8_MIN,  INT8_C(  35),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  15),
+         INT8_C(   0),  INT8_C(  33),  INT8_C(   0),  INT8_C(   0),  INT8_C(  76), -INT8_C(  27),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 3100599088487877454),
+      { -INT8_C(  98),  INT8_C(  62),  INT8_C(  18), -INT8_C(  78), -INT8_C(  32),  INT8_C(  78), -INT8_C(  64),  INT8_C( 102),
+         INT8_C(  15), -INT8_C(  29), -INT8_C(  49), -INT8_C(  78), -INT8_C(  16), -INT8_C( 109),  INT8_C(  34), -INT8_C( 127),
+         INT8_C(  52), -INT8_C(  74), -INT8_C(  67),  INT8_C(  84), -INT8_C(  26), -INT8_C( 112),  INT8_C(  80), -INT8_C( 120),
+        -INT8_C(  36),  INT8_C( 124),  INT8_C(  63), -INT8_C(  29), -INT8_C( 126),  INT8_C(  16),  INT8_C(  12), -INT8_C( 123),
+         INT8_C(  79),  INT8_C(  47), -INT8_C(  76),  INT8_C(  90), -INT8_C( 108),  INT8_C(  23),  INT8_C(   5),  INT8_C(  19),
+         INT8_C(  76), -INT8_C(  95), -INT8_C( 124), -INT8_C(  69),  INT8_C(  29), -INT8_C(   3), -INT8_C(  40), -INT8_C(  73),
+         INT8_C(  36), -INT8_C(  69),  INT8_C(  20), -INT8_C( 115), -INT8_C(  85), -INT8_C(   2), -INT8_C(  72), -INT8_C( 118),
+         INT8_C(  14),  INT8_C( 104),  INT8_C(   3),  INT8_C(  63), -INT8_C(  19), -INT8_C(  90),  INT8_C(  43), -INT8_C(  68) },
+      {  INT8_C(   0), -INT8_C(  98),  INT8_C(  62),  INT8_C(  18),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0),
+        -INT8_C(  32),  INT8_C(  78),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  15), -INT8_C(  29), -INT8_C(  49),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  78), -INT8_C(  16), -INT8_C( 109),  INT8_C(  34), -INT8_C( 127),  INT8_C(   0),
+         INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  74), -INT8_C(  67),  INT8_C(  84),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  26),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  80),
+        -INT8_C( 120), -INT8_C(  36),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  63), -INT8_C(  29),  INT8_C(   0), -INT8_C( 126),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(16428565999040383484),
+      {  INT8_C( 105), -INT8_C(  43), -INT8_C(  76), -INT8_C(  52),  INT8_C(  49),  INT8_C(  22), -INT8_C( 115),  INT8_C( 114),
+        -INT8_C(   2),  INT8_C( 124), -INT8_C(  45),  INT8_C(   6), -INT8_C(  61),  INT8_C(  13), -INT8_C(  33), -INT8_C( 123),
+         INT8_C(  74),  INT8_C(  47),  INT8_C( 125), -INT8_C(  51),  INT8_C( 126),  INT8_C(  11),  INT8_C(  10), -INT8_C(  25),
+        -INT8_C(  44),  INT8_C(  32),  INT8_C(  83),  INT8_C(  31),  INT8_C(  42),  INT8_C(   0), -INT8_C(  28), -INT8_C(  89),
+        -INT8_C(  78),      INT8_MAX, -INT8_C(  86),  INT8_C( 103), -INT8_C(   6),  INT8_C(  14),  INT8_C( 106), -INT8_C(  69),
+        -INT8_C( 127), -INT8_C(  21),  INT8_C(  40),  INT8_C(  38),  INT8_C( 124),  INT8_C(   1), -INT8_C(  22), -INT8_C(  50),
+         INT8_C(  38),  INT8_C( 100), -INT8_C(  43), -INT8_C(  47), -INT8_C(   3),  INT8_C(  43), -INT8_C(  86),  INT8_C(  14),
+        -INT8_C(   6),  INT8_C(  58), -INT8_C(   6),  INT8_C(  63),  INT8_C(  28), -INT8_C(  88), -INT8_C(   4), -INT8_C(  54) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C( 105), -INT8_C(  43), -INT8_C(  76), -INT8_C(  52),  INT8_C(  49),  INT8_C(  22),
+        -INT8_C( 115),  INT8_C(   0),  INT8_C(   0),  INT8_C( 114),  INT8_C(   0),  INT8_C(   0), -INT8_C(   2),  INT8_C( 124),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  45),  INT8_C(   6), -INT8_C(  61),  INT8_C(   0),  INT8_C(  13), -INT8_C(  33),
+        -INT8_C( 123),  INT8_C(   0),  INT8_C(  74),  INT8_C(  47),  INT8_C( 125),  INT8_C(   0), -INT8_C(  51),  INT8_C( 126),
+         INT8_C(  11),  INT8_C(  10),  INT8_C(   0), -INT8_C(  25), -INT8_C(  44),  INT8_C(  32),  INT8_C(   0),  INT8_C(  83),
+         INT8_C(  31),  INT8_C(   0),  INT8_C(  42),  INT8_C(   0), -INT8_C(  28), -INT8_C(  89), -INT8_C(  78),      INT8_MAX,
+        -INT8_C(  86),  INT8_C(   0),  INT8_C( 103), -INT8_C(   6),  INT8_C(  14),  INT8_C( 106), -INT8_C(  69), -INT8_C( 127),
+        -INT8_C(  21),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  38),  INT8_C( 124),  INT8_C(   1) } },
+    { UINT64_C(10935001552340532309),
+      { -INT8_C(  89), -INT8_C(  69),  INT8_C( 106), -INT8_C(  39), -INT8_C(  74),  INT8_C( 101),  INT8_C( 102),  INT8_C(  24),
+         INT8_C(  88),  INT8_C(  43),  INT8_C(  98),  INT8_C(   1),  INT8_C(  77), -INT8_C(   2), -INT8_C(  15), -INT8_C(  87),
+        -INT8_C(  99), -INT8_C( 121),  INT8_C(  73),  INT8_C(  92),  INT8_C( 108),  INT8_C(  64),  INT8_C(  58),  INT8_C( 111),
+         INT8_C(  95), -INT8_C(  62), -INT8_C( 103), -INT8_C(  40),  INT8_C(  80),  INT8_C( 103), -INT8_C(  50), -INT8_C( 122),
+        -INT8_C( 118), -INT8_C(  12), -INT8_C( 107),  INT8_C(  27), -INT8_C(  69), -INT8_C( 106),  INT8_C(  58),  INT8_C(  29),
+        -INT8_C( 102),  INT8_C(  93), -INT8_C( 100), -INT8_C( 126), -INT8_C(  77), -INT8_C(  85), -INT8_C( 111), -INT8_C(  91),
+         INT8_C(  22),  INT8_C(  64), -INT8_C( 100), -INT8_C( 124),  INT8_C(  57),  INT8_C(  42),  INT8_C(  33),  INT8_C(  69),
+         INT8_C(  25), -INT8_C( 126), -INT8_C(  15),  INT8_C(   2),  INT8_C(  32), -INT8_C(  82), -INT8_C(  90),  INT8_C( 108) },
+      { -INT8_C(  89),  INT8_C(   0), -INT8_C(  69),  INT8_C(   0),  INT8_C( 106),  INT8_C(   0), -INT8_C(  39),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  74),  INT8_C( 101),  INT8_C( 102),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  88),  INT8_C(   0),  INT8_C(  43),  INT8_C(  98),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(  77),  INT8_C(   0),  INT8_C(   0), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0), -INT8_C(  15), -INT8_C(  87),
+        -INT8_C(  99),  INT8_C(   0),  INT8_C(   0), -INT8_C( 121),  INT8_C(  73),  INT8_C(  92),  INT8_C( 108),  INT8_C(  64),
+         INT8_C(  58),  INT8_C(   0),  INT8_C( 111),  INT8_C(  95),  INT8_C(   0), -INT8_C(  62), -INT8_C( 103), -INT8_C(  40),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  80),  INT8_C( 103),
+        -INT8_C(  50), -INT8_C( 122), -INT8_C( 118),  INT8_C(   0), -INT8_C(  12),  INT8_C(   0),  INT8_C(   0), -INT8_C( 107) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi8(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C(  7154),  INT16_C( 17317),  INT16_C(  7217), -INT16_C( 31621), -INT16_C(  2313), -INT16_C( 22385),  INT16_C( 17212),  INT16_C( 20278),
+        -INT16_C( 29131), -INT16_C(  4225),  INT16_C( 17044),  INT16_C( 22636),  INT16_C( 16153), -INT16_C(   202),  INT16_C( 21904),  INT16_C( 19032),
+         INT16_C( 14325),  INT16_C( 12858), -INT16_C( 14272),  INT16_C(  9521), -INT16_C(  7629),  INT16_C( 21328),  INT16_C( 31174), -INT16_C( 14975),
+         INT16_C( 14014), -INT16_C( 28685), -INT16_C( 26755), -INT16_C(  8885),  INT16_C( 13506), -INT16_C( 12623),  INT16_C( 30952),  INT16_C( 26427) },
+      UINT32_C(1238272284),
+      {  INT16_C( 28150),  INT16_C(  1037),  INT16_C( 28809),  INT16_C( 17361),  INT16_C( 27693),  INT16_C(  1210),  INT16_C( 18848), -INT16_C(  8114),
+        -INT16_C( 26857),  INT16_C( 24761),  INT16_C(  3164), -INT16_C( 21918), -INT16_C(  5566), -INT16_C(  9683),  INT16_C( 13289),  INT16_C( 21603),
+         INT16_C( 21650),  INT16_C( 20315), -INT16_C(  9637),  INT16_C(  1039), -INT16_C(  7671), -INT16_C(  4267),  INT16_C(  6879), -INT16_C( 24249),
+        -INT16_C( 11136), -INT16_C( 13294),  INT16_C( 30811), -INT16_C( 22841),  INT16_C(  7433),  INT16_C( 23256), -INT16_C( 22890), -INT16_C( 31444) },
+      {  INT16_C(  7154),  INT16_C( 17317),  INT16_C( 28150),  INT16_C(  1037),  INT16_C( 28809), -INT16_C( 22385),  INT16_C( 17212),  INT16_C( 20278),
+         INT16_C( 17361), -INT16_C(  4225),  INT16_C( 17044),  INT16_C( 27693),  INT16_C( 16153), -INT16_C(   202),  INT16_C( 21904),  INT16_C(  1210),
+         INT16_C( 14325),  INT16_C( 18848), -INT16_C(  8114), -INT16_C( 26857), -INT16_C(  7629),  INT16_C( 21328),  INT16_C( 24761),  INT16_C(  3164),
+        -INT16_C( 21918), -INT16_C( 28685), -INT16_C( 26755), -INT16_C(  5566),  INT16_C( 13506), -INT16_C( 12623), -INT16_C(  9683),  INT16_C( 26427) } },
+    { { -INT16_C( 25266),  INT16_C( 11561), -INT16_C(  8840),  INT16_C(  2273), -INT16_C(  7950), -INT16_C( 25482), -INT16_C( 29591),  INT16_C( 28146),
+        -INT16_C( 17253),  INT16_C( 12033), -INT16_C( 25562),  INT16_C( 12987),  INT16_C(  7906), -INT16_C( 17309),  INT16_C( 10159), -INT16_C(  2436),
+        -INT16_C(  4601), -INT16_C( 14362), -INT16_C( 13112),  INT16_C( 29925), -INT16_C(  4559),  INT16_C(  3700),  INT16_C( 23308), -INT16_C( 32214),
+         INT16_C(   373),  INT16_C( 17970), -INT16_C( 15983),  INT16_C(  3801), -INT16_C( 10235),  INT16_C( 29350), -INT16_C( 17199),  INT16_C(  9052) },
+      UINT32_C( 271122457),
+      { -INT16_C(  1711), -INT16_C( 19933),  INT16_C( 18886), -INT16_C(  9598), -INT16_C( 21769), -INT16_C( 19082),  INT16_C( 11021), -INT16_C( 11452),
+        -INT16_C( 25199), -INT16_C( 12471), -INT16_C( 25959),  INT16_C(  1928), -INT16_C(  8909),  INT16_C(  2825), -INT16_C( 25650),  INT16_C( 25548),
+         INT16_C( 21963),  INT16_C(  1331), -INT16_C( 27717),  INT16_C( 28851),  INT16_C(  3985),  INT16_C( 20754), -INT16_C(  8240),  INT16_C( 29341),
+         INT16_C( 21990),  INT16_C(    30),  INT16_C( 27209),  INT16_C( 29477),  INT16_C( 21470),  INT16_C( 28632), -INT16_C(  8851), -INT16_C( 20840) },
+      { -INT16_C(  1711),  INT16_C( 11561), -INT16_C(  8840), -INT16_C( 19933),  INT16_C( 18886), -INT16_C( 25482), -INT16_C( 29591),  INT16_C( 28146),
+        -INT16_C( 17253),  INT16_C( 12033), -INT16_C( 25562),  INT16_C( 12987),  INT16_C(  7906), -INT16_C( 17309),  INT16_C( 10159), -INT16_C(  2436),
+        -INT16_C(  9598), -INT16_C( 14362), -INT16_C( 13112), -INT16_C( 21769), -INT16_C(  4559), -INT16_C( 19082),  INT16_C( 23308), -INT16_C( 32214),
+         INT16_C(   373),  INT16_C( 17970), -INT16_C( 15983),  INT16_C(  3801),  INT16_C( 11021),  INT16_C( 29350), -INT16_C( 17199),  INT16_C(  9052) } },
+    { { -INT16_C( 22009),  INT16_C(  2274),  INT16_C(  8266), -INT16_C( 31431),  INT16_C( 18320),  INT16_C( 26054), -INT16_C( 28373),  INT16_C( 21839),
+        -INT16_C( 16047), -INT16_C(  1250), -INT16_C(  1215), -INT16_C(  7882), -INT16_C( 18503), -INT16_C( 28631), -INT16_C(  6755), -INT16_C( 12508),
+        -INT16_C(  6684),  INT16_C( 10599),  INT16_C( 26098), -INT16_C( 18341),  INT16_C(  9225),  INT16_C(  1285), -INT16_C(  3818),  INT16_C( 26788),
+        -INT16_C( 22367),  INT16_C( 15588), -INT16_C( 19626),  INT16_C(  3963),  INT16_C( 17099), -INT16_C(  8541), -INT16_C(  2050), -INT16_C(  5714) },
+      UINT32_C(4157697495),
+      { -INT16_C( 32390),  INT16_C(  8828),  INT16_C(  2222), -INT16_C( 20161), -INT16_C( 25882), -INT16_C( 24056),  INT16_C(  5607),  INT16_C( 29504),
+        -INT16_C( 31345),  INT16_C( 20282),  INT16_C(  7644),  INT16_C(  8575),  INT16_C( 14147), -INT16_C(  4502),  INT16_C( 29123),  INT16_C( 17418),
+        -INT16_C(   868),  INT16_C(  1407),  INT16_C(  2284), -INT16_C( 14264), -INT16_C( 31335), -INT16_C( 18036),  INT16_C(  8408), -INT16_C( 13338),
+        -INT16_C( 18979),  INT16_C( 21581),  INT16_C( 20177), -INT16_C( 24814),  INT16_C(  9544), -INT16_C(  2385),  INT16_C( 31218), -INT16_C(  1656) },
+      { -INT16_C( 32390),  INT16_C(  8828),  INT16_C(  2222), -INT16_C( 31431), -INT16_C( 20161),  INT16_C( 26054), -INT16_C( 25882), -INT16_C( 24056),
+         INT16_C(  5607), -INT16_C(  1250),  INT16_C( 29504), -INT16_C( 31345), -INT16_C( 18503),  INT16_C( 20282),  INT16_C(  7644), -INT16_C( 12508),
+         INT16_C(  8575),  INT16_C( 10599),  INT16_C( 26098), -INT16_C( 18341),  INT16_C( 14147),  INT16_C(  1285), -INT16_C(  4502),  INT16_C( 29123),
+         INT16_C( 17418), -INT16_C(   868),  INT16_C(  1407),  INT16_C(  3963),  INT16_C(  2284), -INT16_C( 14264), -INT16_C( 31335), -INT16_C( 18036) } },
+    { {  INT16_C(  4505), -INT16_C(  5729),  INT16_C( 11883),  INT16_C( 20132),  INT16_C( 24577), -INT16_C( 31198),  INT16_C(  9049), -INT16_C(  4432),
+         INT16_C( 28785),  INT16_C( 25325), -INT16_C( 18501), -INT16_C(  5722), -INT16_C( 29334),  INT16_C( 27068), -INT16_C(  5016),  INT16_C( 11843),
+         INT16_C(  4587),  INT16_C(  9671), -INT16_C( 23904),  INT16_C( 30259),  INT16_C(  9636), -INT16_C( 25931), -INT16_C(   300), -INT16_C( 16987),
+        -INT16_C( 23212), -INT16_C( 20157),  INT16_C(  9422),  INT16_C(  4841), -INT16_C(  5015), -INT16_C( 27247), -INT16_C( 30847),  INT16_C( 11531) },
+      UINT32_C(3221134943),
+      {  INT16_C( 15033), -INT16_C( 25921),  INT16_C( 29166), -INT16_C( 32289), -INT16_C( 18402),  INT16_C(  4537), -INT16_C( 16026),  INT16_C(  3904),
+        -INT16_C(  2524), -INT16_C( 17376), -INT16_C( 30225), -INT16_C( 27113), -INT16_C(  5227),  INT16_C( 19660), -INT16_C( 12293),  INT16_C( 32104),
+         INT16_C( 26692),  INT16_C( 15473),  INT16_C( 14229), -INT16_C( 20035),  INT16_C(  2531), -INT16_C(  6717),  INT16_C(   683),  INT16_C( 25444),
+         INT16_C( 19526),  INT16_C( 21511),  INT16_C( 18099), -INT16_C( 12776),  INT16_C( 30967), -INT16_C( 26429),  INT16_C( 17506),  INT16_C( 10290) },
+      {  INT16_C( 15033), -INT16_C( 25921),  INT16_C( 29166), -INT16_C( 32289), -INT16_C( 18402), -INT16_C( 31198),  INT16_C(  4537), -INT16_C(  4432),
+         INT16_C( 28785), -INT16_C( 16026),  INT16_C(  3904), -INT16_C(  2524), -INT16_C( 17376),  INT16_C( 27068), -INT16_C(  5016), -INT16_C( 30225),
+         INT16_C(  4587), -INT16_C( 27113), -INT16_C(  5227),  INT16_C( 19660), -INT16_C( 12293),  INT16_C( 32104),  INT16_C( 26692),  INT16_C( 15473),
+         INT16_C( 14229), -INT16_C( 20035),  INT16_C(  2531), -INT16_C(  6717),  INT16_C(   683),  INT16_C( 25444), -INT16_C( 30847),  INT16_C( 19526) } },
+    { {  INT16_C(  5582), -INT16_C( 22531),  INT16_C(  1425),  INT16_C( 24432),  INT16_C( 16621), -INT16_C( 31772),  INT16_C( 10136), -INT16_C(  5078),
+         INT16_C( 31582),  INT16_C(  9373), -INT16_C(  2994),  INT16_C( 12645), -INT16_C(  4417),  INT16_C( 13727), -INT16_C(  3383),  INT16_C( 20926),
+         INT16_C(  6567),  INT16_C( 14438),  INT16_C(  8304),  INT16_C( 25273), -INT16_C(  8499),  INT16_C( 14693), -INT16_C( 23265),  INT16_C( 26219),
+        -INT16_C(  6587), -INT16_C( 31027), -INT16_C( 19356), -INT16_C( 29278), -INT16_C( 16199), -INT16_C( 20802), -INT16_C( 27907), -INT16_C(  7434) },
+      UINT32_C(      6276),
+      {  INT16_C(   611), -INT16_C( 25851), -INT16_C( 18231),  INT16_C( 30078), -INT16_C(  5266),  INT16_C(  7172), -INT16_C( 19203), -INT16_C( 21684),
+        -INT16_C( 20810),  INT16_C( 29221), -INT16_C(  2514), -INT16_C( 29832), -INT16_C( 31911), -INT16_C( 28917),  INT16_C( 31973), -INT16_C( 30205),
+         INT16_C( 21962), -INT16_C(   413), -INT16_C( 24372),  INT16_C(  3722),  INT16_C( 20093),  INT16_C( 13234),  INT16_C( 12404), -INT16_C( 20111),
+         INT16_C( 16137), -INT16_C( 11331),  INT16_C(  9356), -INT16_C( 20841), -INT16_C( 12815), -INT16_C(  3327),  INT16_C(  1289),  INT16_C( 28863) },
+      {  INT16_C(  5582), -INT16_C( 22531),  INT16_C(   611),  INT16_C( 24432),  INT16_C( 16621), -INT16_C( 31772),  INT16_C( 10136), -INT16_C( 25851),
+         INT16_C( 31582),  INT16_C(  9373), -INT16_C(  2994), -INT16_C( 18231),  INT16_C( 30078),  INT16_C( 13727), -INT16_C(  3383),  INT16_C( 20926),
+         INT16_C(  6567),  INT16_C( 14438),  INT16_C(  8304),  INT16_C( 25273), -INT16_C(  8499),  INT16_C( 14693), -INT16_C( 23265),  INT16_C( 26219),
+        -INT16_C(  6587), -INT16_C( 31027), -INT16_C( 19356), -INT16_C( 29278), -INT16_C( 16199), -INT16_C( 20802), -INT16_C( 27907), -INT16_C(  7434) } },
+    { { -INT16_C( 22114),  INT16_C( 12997), -INT16_C( 12073), -INT16_C( 17912),  INT16_C( 14592),  INT16_C( 25926), -INT16_C( 18209), -INT16_C(  6615),
+        -INT16_C( 20696),  INT16_C( 10989), -INT16_C(  8552),  INT16_C( 20343),  INT16_C( 31009),  INT16_C( 21588), -INT16_C( 24093),  INT16_C(  2478),
+         INT16_C( 20362),  INT16_C(  1485),  INT16_C( 17757), -INT16_C( 19938), -INT16_C(  7854),  INT16_C( 31330), -INT16_C( 32256),  INT16_C( 14944),
+         INT16_C( 29635), -INT16_C( 16921),  INT16_C( 27807),  INT16_C( 17432),  INT16_C( 14789), -INT16_C( 24717),  INT16_C( 22360),  INT16_C( 13700) },
+      UINT32_C(3825021731),
+      { -INT16_C(  2909),  INT16_C( 21943),  INT16_C( 31995),  INT16_C(  2840),  INT16_C( 10046),  INT16_C( 11119), -INT16_C( 16854),  INT16_C( 21900),
+         INT16_C( 30637),  INT16_C( 28321),  INT16_C( 18176), -INT16_C( 24804), -INT16_C( 31122), -INT16_C( 24202),  INT16_C(  8714), -INT16_C( 22827),
+        -INT16_C( 26594),  INT16_C( 24412),  INT16_C( 20880),  INT16_C(  2531), -INT16_C( 16660),  INT16_C( 10654), -INT16_C( 12806),  INT16_C( 19360),
+         INT16_C( 11532),  INT16_C(  9602), -INT16_C(  8040),  INT16_C( 16751),  INT16_C( 21559),  INT16_C( 24834), -INT16_C( 24113), -INT16_C( 22412) },
+      { -INT16_C(  2909),  INT16_C( 21943), -INT16_C( 12073), -INT16_C( 17912),  INT16_C( 14592),  INT16_C( 31995), -INT16_C( 18209), -INT16_C(  6615),
+         INT16_C(  2840),  INT16_C( 10046), -INT16_C(  8552),  INT16_C( 20343),  INT16_C( 11119), -INT16_C( 16854), -INT16_C( 24093),  INT16_C(  2478),
+         INT16_C( 21900),  INT16_C(  1485),  INT16_C( 30637),  INT16_C( 28321),  INT16_C( 18176), -INT16_C( 24804), -INT16_C( 31122), -INT16_C( 24202),
+         INT16_C(  8714), -INT16_C( 22827),  INT16_C( 27807),  INT16_C( 17432),  INT16_C( 14789), -INT16_C( 26594),  INT16_C( 24412),  INT16_C( 20880) } },
+    { {  INT16_C( 20267),  INT16_C( 21306), -INT16_C(  5525), -INT16_C(   688), -INT16_C(  7338),  INT16_C( 30334),  INT16_C( 29693), -INT16_C( 12995),
+        -INT16_C( 23139), -INT16_C( 28426),  INT16_C( 18243), -INT16_C( 13701), -INT16_C( 24166),  INT16_C(  6030), -INT16_C( 13098), -INT16_C(  7547),
+         INT16_C(  3462),  INT16_C( 26925),  INT16_C( 23657),  INT16_C( 12661),  INT16_C( 31319),  INT16_C( 27139),  INT16_C(  3593), -INT16_C( 21068),
+        -INT16_C(  4321),  INT16_C(  6382),  INT16_C( 27376),  INT16_C(   619),  INT16_C( 15779),  INT16_C(  3867), -INT16_C(  7394), -INT16_C( 17240) },
+      UINT32_C(2146367839),
+      { -INT16_C( 16590),  INT16_C( 31452), -INT16_C(  7995),  INT16_C( 21398), -INT16_C( 23794), -INT16_C( 18187), -INT16_C( 14629),  INT16_C( 18725),
+         INT16_C(   752), -INT16_C( 27122), -INT16_C( 11866), -INT16_C( 21665), -INT16_C( 28436),  INT16_C( 22890),  INT16_C( 23798),  INT16_C( 28833),
+        -INT16_C(  7067), -INT16_C( 11455), -INT16_C(  2152),  INT16_C( 16081),  INT16_C( 29549), -INT16_C( 15847), -INT16_C(  1847),  INT16_C(  7519),
+        -INT16_C(  1561),  INT16_C( 14909),  INT16_C(  2807),  INT16_C(  6408),  INT16_C( 10460), -INT16_C( 18053), -INT16_C(  9220), -INT16_C( 25635) },
+      { -INT16_C( 16590),  INT16_C( 31452), -INT16_C(  7995),  INT16_C( 21398), -INT16_C( 23794),  INT16_C( 30334), -INT16_C( 18187), -INT16_C( 12995),
+        -INT16_C( 14629), -INT16_C( 28426),  INT16_C( 18243),  INT16_C( 18725),  INT16_C(   752), -INT16_C( 27122), -INT16_C( 11866), -INT16_C( 21665),
+         INT16_C(  3462), -INT16_C( 28436),  INT16_C( 22890),  INT16_C( 23798),  INT16_C( 31319),  INT16_C( 28833), -INT16_C(  7067), -INT16_C( 11455),
+        -INT16_C(  2152),  INT16_C( 16081),  INT16_C( 29549), -INT16_C( 15847), -INT16_C(  1847),  INT16_C(  7519), -INT16_C(  1561), -INT16_C( 17240) } },
+    { {  INT16_C(   970),  INT16_C(  4930), -INT16_C(  8848),  INT16_C( 13126),  INT16_C(    71), -INT16_C( 19378), -INT16_C( 12495),  INT16_C(  1671),
+         INT16_C(  4492),  INT16_C(  9273),  INT16_C( 21910),  INT16_C( 19834),  INT16_C( 15041), -INT16_C( 10507),  INT16_C(  1470),  INT16_C( 29775),
+        -INT16_C( 16154), -INT16_C( 17072), -INT16_C( 32288),  INT16_C( 18594), -INT16_C( 24314),  INT16_C( 23585),  INT16_C( 29207),  INT16_C(  4374),
+         INT16_C( 19022),  INT16_C( 12300),  INT16_C( 18314),  INT16_C( 17269), -INT16_C( 14857),  INT16_C( 27668),  INT16_C(  1098),  INT16_C(  8420) },
+      UINT32_C(1942233206),
+      {  INT16_C( 32350), -INT16_C(  3577), -INT16_C( 10752), -INT16_C( 10631),  INT16_C(  1030), -INT16_C( 22326),  INT16_C(   397), -INT16_C( 17870),
+        -INT16_C(  3428), -INT16_C( 18612), -INT16_C( 24430), -INT16_C( 27591), -INT16_C(  5629),  INT16_C( 14067),  INT16_C(  5897), -INT16_C( 20855),
+         INT16_C( 20111), -INT16_C( 30644),  INT16_C(  3524), -INT16_C(  9558), -INT16_C(   817),  INT16_C( 10975),  INT16_C( 18556),  INT16_C( 22565),
+        -INT16_C( 28844),  INT16_C(  6421), -INT16_C( 28650),  INT16_C(  8059),  INT16_C(  1157), -INT16_C(  6683), -INT16_C( 22367),  INT16_C( 20840) },
+      {  INT16_C(   970),  INT16_C( 32350), -INT16_C(  3577),  INT16_C( 13126), -INT16_C( 10752), -INT16_C( 10631),  INT16_C(  1030),  INT16_C(  1671),
+         INT16_C(  4492),  INT16_C(  9273),  INT16_C( 21910),  INT16_C( 19834),  INT16_C( 15041), -INT16_C( 22326),  INT16_C(  1470),  INT16_C( 29775),
+        -INT16_C( 16154), -INT16_C( 17072),  INT16_C(   397),  INT16_C( 18594), -INT16_C( 24314),  INT16_C( 23585), -INT16_C( 17870), -INT16_C(  3428),
+        -INT16_C( 18612), -INT16_C( 24430),  INT16_C( 18314),  INT16_C( 17269), -INT16_C( 27591), -INT16_C(  5629),  INT16_C( 14067),  INT16_C(  8420) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C( 821041162),
+      { -INT16_C( 13849),  INT16_C( 23667),  INT16_C( 29989), -INT16_C( 13901), -INT16_C( 13806), -INT16_C( 27808), -INT16_C( 20806), -INT16_C( 24145),
+         INT16_C(  5366),  INT16_C( 10070), -INT16_C( 19074), -INT16_C( 17974), -INT16_C( 15929), -INT16_C(  8758), -INT16_C(  8305),  INT16_C( 29461),
+        -INT16_C( 30265),  INT16_C( 27242),  INT16_C(  2091), -INT16_C(  8198), -INT16_C( 28174),  INT16_C( 28291),  INT16_C( 22881), -INT16_C( 17240),
+         INT16_C( 30534),  INT16_C( 12058),  INT16_C( 28702),  INT16_C( 32481),  INT16_C( 17725),  INT16_C(  2166),  INT16_C( 14201), -INT16_C(  6441) },
+      {  INT16_C(     0), -INT16_C( 13849),  INT16_C(     0),  INT16_C( 23667),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29989), -INT16_C( 13901),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13806), -INT16_C( 27808), -INT16_C( 20806), -INT16_C( 24145),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5366),  INT16_C( 10070),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2576795241),
+      {  INT16_C( 15801),  INT16_C( 19321),  INT16_C(  4440), -INT16_C( 21630),  INT16_C(   402), -INT16_C(  5165), -INT16_C( 23322), -INT16_C( 19377),
+         INT16_C( 31436), -INT16_C(  5672), -INT16_C(  5098), -INT16_C( 15543), -INT16_C( 10931),  INT16_C(  8749),  INT16_C( 28135), -INT16_C( 16303),
+         INT16_C(    49), -INT16_C( 18946), -INT16_C(  8362), -INT16_C( 31697),  INT16_C( 14720),  INT16_C( 10327),  INT16_C( 25237), -INT16_C(  3848),
+         INT16_C( 16644), -INT16_C( 22527),  INT16_C( 19946),  INT16_C( 15194),  INT16_C(  7437), -INT16_C( 25756),  INT16_C( 23312), -INT16_C( 17064) },
+      {  INT16_C( 15801),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19321),  INT16_C(     0),  INT16_C(  4440), -INT16_C( 21630),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(   402), -INT16_C(  5165),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 23322), -INT16_C( 19377),
+         INT16_C(     0),  INT16_C( 31436), -INT16_C(  5672),  INT16_C(     0), -INT16_C(  5098),  INT16_C(     0),  INT16_C(     0), -INT16_C( 15543),
+        -INT16_C( 10931),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8749),  INT16_C( 28135),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16303) } },
+    { UINT32_C(   1839104),
+      {  INT16_C( 17404),  INT16_C( 22925), -INT16_C(  5555),  INT16_C(  7018), -INT16_C( 14973), -INT16_C(  2420), -INT16_C(  6421),  INT16_C( 19539),
+         INT16_C( 16504),  INT16_C( 17870), -INT16_C( 19411),  INT16_C( 26891),  INT16_C( 12715),  INT16_C( 28657),  INT16_C( 30915), -INT16_C( 32115),
+        -INT16_C(  6636), -INT16_C( 28583), -INT16_C( 11302), -INT16_C( 22645),  INT16_C( 14090),  INT16_C( 22859),  INT16_C(  8194), -INT16_C(  6465),
+         INT16_C( 13025), -INT16_C( 21927),  INT16_C( 22890),  INT16_C( 21513), -INT16_C( 19054), -INT16_C(  7836), -INT16_C( 20717),  INT16_C( 24458) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17404),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 22925), -INT16_C(  5555),  INT16_C(  7018),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 103350915),
+      {  INT16_C( 14921),  INT16_C( 11286),  INT16_C( 19554), -INT16_C(  4795), -INT16_C(  7927),  INT16_C(  2396),  INT16_C(  4229), -INT16_C( 23862),
+        -INT16_C(  4602), -INT16_C(   101), -INT16_C( 29915),  INT16_C( 17313),  INT16_C( 29450), -INT16_C(  9409),  INT16_C( 20772), -INT16_C( 26118),
+        -INT16_C(  1827), -INT16_C(  2542),  INT16_C( 25968),  INT16_C(  4258),  INT16_C( 29275),  INT16_C( 32624), -INT16_C(  1849),  INT16_C(  4842),
+         INT16_C(  1875),  INT16_C( 21689),  INT16_C( 30359), -INT16_C( 32134),  INT16_C(  5174), -INT16_C( 31582),  INT16_C( 18886), -INT16_C(   157) },
+      {  INT16_C( 14921),  INT16_C( 11286),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19554),
+         INT16_C(     0), -INT16_C(  4795),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  7927),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2396),  INT16_C(     0),  INT16_C(  4229),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 23862), -INT16_C(  4602),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2061959159),
+      {  INT16_C( 14209),  INT16_C( 17213),  INT16_C( 27987),  INT16_C( 11182), -INT16_C( 23492),  INT16_C(  3230),  INT16_C( 11801),  INT16_C(  6039),
+        -INT16_C( 23004), -INT16_C( 17426), -INT16_C( 14677),  INT16_C( 16356),  INT16_C(  5994), -INT16_C(   557), -INT16_C( 28046),  INT16_C(  2213),
+         INT16_C(  1335),  INT16_C(   388),  INT16_C( 28197),  INT16_C( 14592),  INT16_C(  8190), -INT16_C(   379),  INT16_C( 28426), -INT16_C( 14537),
+         INT16_C( 21129), -INT16_C( 19155), -INT16_C(  4609),  INT16_C(  9747), -INT16_C( 17429),  INT16_C( 11886), -INT16_C( 31855), -INT16_C(  6627) },
+      {  INT16_C( 14209),  INT16_C( 17213),  INT16_C( 27987),  INT16_C(     0),  INT16_C( 11182), -INT16_C( 23492),  INT16_C(  3230),  INT16_C( 11801),
+         INT16_C(  6039), -INT16_C( 23004), -INT16_C( 17426), -INT16_C( 14677),  INT16_C( 16356),  INT16_C(  5994), -INT16_C(   557), -INT16_C( 28046),
+         INT16_C(     0),  INT16_C(  2213),  INT16_C(  1335),  INT16_C(     0),  INT16_C(     0),  INT16_C(   388),  INT16_C( 28197),  INT16_C( 14592),
+         INT16_C(     0),  INT16_C(  8190),  INT16_C(     0), -INT16_C(   379),  INT16_C( 28426), -INT16_C( 14537),  INT16_C( 21129),  INT16_C(     0) } },
+    { UINT32_C( 947591191),
+      {  INT16_C(  5694), -INT16_C(  2221), -INT16_C( 25883), -INT16_C(  8374), -INT16_C(  3431),  INT16_C( 31319),  INT16_C(  2477), -INT16_C( 29759),
+         INT16_C(  1708), -INT16_C( 24492), -INT16_C( 31668), -INT16_C( 10799),  INT16_C( 25133), -INT16_C(  5142),  INT16_C( 11765),  INT16_C( 32266),
+        -INT16_C( 27565),  INT16_C( 15043),  INT16_C( 30298),  INT16_C( 19801),  INT16_C( 19848), -INT16_C( 25896), -INT16_C( 13239), -INT16_C( 15870),
+         INT16_C( 10773),  INT16_C(  9889),  INT16_C( 27674),  INT16_C( 19243), -INT16_C( 28580),  INT16_C( 20886), -INT16_C( 24066),  INT16_C(  3861) },
+      {  INT16_C(  5694), -INT16_C(  2221), -INT16_C( 25883),  INT16_C(     0), -INT16_C(  8374),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3431),  INT16_C( 31319),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(  2477), -INT16_C( 29759),  INT16_C(     0),  INT16_C(  1708), -INT16_C( 24492), -INT16_C( 31668), -INT16_C( 10799),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25133), -INT16_C(  5142),  INT16_C( 11765),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1874722287),
+      {  INT16_C( 20465),  INT16_C( 13197),  INT16_C(  7174), -INT16_C( 18775),  INT16_C( 26816), -INT16_C(  9693),  INT16_C(  5076),  INT16_C( 19984),
+         INT16_C( 22163), -INT16_C( 30351), -INT16_C( 25584), -INT16_C( 16198),  INT16_C( 29232),  INT16_C(  3470), -INT16_C( 14108),  INT16_C( 11965),
+        -INT16_C( 18052), -INT16_C( 28494), -INT16_C(  9738),  INT16_C(  8900),  INT16_C(  2192), -INT16_C(  8357), -INT16_C( 19320),  INT16_C( 23162),
+        -INT16_C(  5782), -INT16_C( 26868),  INT16_C(  1772), -INT16_C(  9788),  INT16_C( 21403), -INT16_C( 19334),  INT16_C( 28884), -INT16_C(  9122) },
+      {  INT16_C( 20465),  INT16_C( 13197),  INT16_C(  7174), -INT16_C( 18775),  INT16_C(     0),  INT16_C( 26816), -INT16_C(  9693),  INT16_C(  5076),
+         INT16_C( 19984),  INT16_C(     0),  INT16_C( 22163), -INT16_C( 30351), -INT16_C( 25584), -INT16_C( 16198),  INT16_C( 29232),  INT16_C(  3470),
+        -INT16_C( 14108),  INT16_C(     0),  INT16_C( 11965), -INT16_C( 18052), -INT16_C( 28494), -INT16_C(  9738),  INT16_C(     0),  INT16_C(  8900),
+         INT16_C(  2192), -INT16_C(  8357), -INT16_C( 19320),  INT16_C( 23162),  INT16_C(     0), -INT16_C(  5782), -INT16_C( 26868),  INT16_C(     0) } },
+    { UINT32_C(1946156863),
+      { -INT16_C(  4336), -INT16_C( 28816), -INT16_C( 32012), -INT16_C( 21157),  INT16_C( 10120), -INT16_C( 19251), -INT16_C( 19140),  INT16_C( 24490),
+         INT16_C( 29773), -INT16_C( 19505),  INT16_C(  5267),  INT16_C( 28665), -INT16_C( 19231),  INT16_C(  3585),  INT16_C( 20206),  INT16_C( 24270),
+        -INT16_C( 25657),  INT16_C( 22524), -INT16_C( 19040), -INT16_C(  7193),  INT16_C( 31997), -INT16_C( 11461),  INT16_C( 18676), -INT16_C( 20947),
+        -INT16_C( 16852), -INT16_C( 32274),  INT16_C( 11999),  INT16_C(  6099),  INT16_C(   566), -INT16_C( 25505),  INT16_C( 11600), -INT16_C( 28697) },
+      { -INT16_C(  4336), -INT16_C( 28816), -INT16_C( 32012), -INT16_C( 21157),  INT16_C( 10120), -INT16_C( 19251),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 19140),  INT16_C( 24490),  INT16_C( 29773), -INT16_C( 19505),  INT16_C(  5267),  INT16_C( 28665), -INT16_C( 19231),  INT16_C(  3585),
+         INT16_C( 20206),  INT16_C( 24270), -INT16_C( 25657),  INT16_C( 22524), -INT16_C( 19040), -INT16_C(  7193),  INT16_C( 31997), -INT16_C( 11461),
+         INT16_C( 18676), -INT16_C( 20947),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16852), -INT16_C( 32274),  INT16_C( 11999),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C( 24427),  INT16_C( 29794),  INT16_C(  6415),  INT16_C(  9120), -INT16_C( 24863), -INT16_C( 21438), -INT16_C(  8386),  INT16_C( 13004),
+         INT16_C(   440), -INT16_C(  2298),  INT16_C(  1018),  INT16_C(  2784), -INT16_C( 22328),  INT16_C( 24036),  INT16_C( 12481),  INT16_C( 16121),
+        -INT16_C( 24444),  INT16_C(  8002),  INT16_C( 28614),  INT16_C( 10152), -INT16_C(  4186), -INT16_C( 19919), -INT16_C(  7009), -INT16_C( 22485),
+        -INT16_C( 11422), -INT16_C( 17711), -INT16_C( 12449),  INT16_C( 29123), -INT16_C( 30905),  INT16_C(  1690),  INT16_C(  2513),  INT16_C( 21189) },
+      UINT32_C(3366072561),
+      {  INT16_C( 31332), -INT16_C(  2367), -INT16_C( 18378),  INT16_C( 30133),  INT16_C( 16511), -INT16_C(  7848), -INT16_C( 29018),  INT16_C(  6042),
+        -INT16_C( 25857),  INT16_C( 14156), -INT16_C( 17284),  INT16_C( 12458),  INT16_C( 16221),  INT16_C( 20507),  INT16_C(  9060), -INT16_C( 25266),
+         INT16_C(  8140),  INT16_C(  6532),  INT16_C(  7350), -INT16_C(  1862), -INT16_C(  1370),  INT16_C( 26870),  INT16_C( 19605), -INT16_C( 13766),
+         INT16_C( 28722), -INT16_C( 28118), -INT16_C( 24790),  INT16_C( 12889),  INT16_C( 19825),  INT16_C(  1475),  INT16_C( 17017),  INT16_C( 19924) },
+      {  INT16_C( 31332),  INT16_C( 29794),  INT16_C(  6415),  INT16_C(  9120), -INT16_C(  2367), -INT16_C( 18378),  INT16_C( 30133),  INT16_C( 16511),
+         INT16_C(   440), -INT16_C(  2298),  INT16_C(  1018),  INT16_C(  2784), -INT16_C(  7848), -INT16_C( 29018),  INT16_C( 12481),  INT16_C( 16121),
+        -INT16_C( 24444),  INT16_C(  6042),  INT16_C( 28614),  INT16_C( 10152), -INT16_C(  4186), -INT16_C( 25857), -INT16_C(  7009),  INT16_C( 14156),
+        -INT16_C( 11422), -INT16_C( 17711), -INT16_C( 12449), -INT16_C( 17284), -INT16_C( 30905),  INT16_C(  1690),  INT16_C( 12458),  INT16_C( 16221) } },
+    { {  INT16_C(   602),  INT16_C( 25851),  INT16_C(  3432), -INT16_C(  4029),  INT16_C( 22328), -INT16_C( 10217), -INT16_C( 17434), -INT16_C( 29294),
+        -INT16_C( 18506),  INT16_C( 15733), -INT16_C( 11549),  INT16_C( 16006), -INT16_C( 23313),  INT16_C(  6191), -INT16_C(  7344), -INT16_C( 13250),
+        -INT16_C( 10925), -INT16_C( 10538),  INT16_C( 32056),  INT16_C( 15085),  INT16_C( 19487),  INT16_C( 13704), -INT16_C( 16609),  INT16_C( 23009),
+        -INT16_C( 20185),  INT16_C(  9191), -INT16_C( 10996),  INT16_C( 18307), -INT16_C( 13709),  INT16_C(  6088), -INT16_C(  4070), -INT16_C( 12971) },
+      UINT32_C(4244373227),
+      {  INT16_C( 30907),  INT16_C( 25228),  INT16_C(  3881), -INT16_C( 25166), -INT16_C( 11743), -INT16_C( 23687), -INT16_C(  7016),  INT16_C(  7431),
+        -INT16_C( 26029), -INT16_C(  8278), -INT16_C( 30422), -INT16_C( 24729), -INT16_C( 24243),  INT16_C( 27962),  INT16_C(  6827),  INT16_C( 23529),
+         INT16_C( 12204), -INT16_C( 12444),  INT16_C(  3322), -INT16_C( 31163), -INT16_C( 30394),  INT16_C( 31448), -INT16_C( 26439),  INT16_C( 10363),
+        -INT16_C( 20351),  INT16_C( 18605), -INT16_C( 28988),  INT16_C(  2259),  INT16_C( 10670),  INT16_C( 16295), -INT16_C( 11198),  INT16_C(  2561) },
+      {  INT16_C( 30907),  INT16_C( 25228),  INT16_C(  3432),  INT16_C(  3881),  INT16_C( 22328), -INT16_C( 25166), -INT16_C( 11743), -INT16_C( 23687),
+        -INT16_C( 18506), -INT16_C(  7016),  INT16_C(  7431), -INT16_C( 26029), -INT16_C(  8278), -INT16_C( 30422), -INT16_C( 24729), -INT16_C( 24243),
+         INT16_C( 27962),  INT16_C(  6827),  INT16_C( 32056),  INT16_C( 23529),  INT16_C( 12204), -INT16_C( 12444),  INT16_C(  3322), -INT16_C( 31163),
+        -INT16_C( 20185),  INT16_C(  9191), -INT16_C( 30394),  INT16_C( 31448), -INT16_C( 26439),  INT16_C( 10363), -INT16_C( 20351),  INT16_C( 18605) } },
+    { { -INT16_C( 10433), -INT16_C(  8274),  INT16_C( 20692), -INT16_C( 16236),  INT16_C( 31011),  INT16_C( 17738),  INT16_C( 22593),  INT16_C(  1921),
+        -INT16_C( 23710), -INT16_C(  6169),  INT16_C(  7419),  INT16_C( 26041), -INT16_C( 31337),  INT16_C(  6174), -INT16_C( 15694),  INT16_C( 22094),
+        -INT16_C( 27888), -INT16_C( 29236),  INT16_C( 18798),  INT16_C( 10463), -INT16_C( 22957),  INT16_C(  4988),  INT16_C( 17445),  INT16_C(  5465),
+         INT16_C( 30747), -INT16_C( 16238), -INT16_C(  1623),  INT16_C( 15778), -INT16_C(  4513),  INT16_C( 13315), -INT16_C( 17339), -INT16_C( 20440) },
+      UINT32_C( 541269000),
+      { -INT16_C(  2081), -INT16_C( 10147), -INT16_C(  4747),  INT16_C( 18968), -INT16_C(   157),  INT16_C(  9903),  INT16_C( 13115), -INT16_C(  8135),
+        -INT16_C( 14639), -INT16_C( 29015),  INT16_C( 28676), -INT16_C(   353), -INT16_C( 31260),  INT16_C(  2444), -INT16_C( 11454), -INT16_C( 19057),
+         INT16_C( 22047),  INT16_C( 31788),  INT16_C( 31461),  INT16_C( 19291),  INT16_C( 27178), -INT16_C( 11318),  INT16_C( 25248), -INT16_C( 18189),
+         INT16_C( 16802), -INT16_C( 26002), -INT16_C( 10200),  INT16_C( 19019),  INT16_C( 19095), -INT16_C( 27704), -INT16_C(  4386), -INT16_C( 32519) },
+      { -INT16_C( 10433), -INT16_C(  8274),  INT16_C( 20692), -INT16_C(  2081),  INT16_C( 31011),  INT16_C( 17738),  INT16_C( 22593),  INT16_C(  1921),
+        -INT16_C( 23710), -INT16_C(  6169), -INT16_C( 10147), -INT16_C(  4747),  INT16_C( 18968),  INT16_C(  6174), -INT16_C( 15694),  INT16_C( 22094),
+        -INT16_C(   157),  INT16_C(  9903),  INT16_C( 18798),  INT16_C( 10463), -INT16_C( 22957),  INT16_C(  4988),  INT16_C( 13115),  INT16_C(  5465),
+         INT16_C( 30747), -INT16_C( 16238), -INT16_C(  1623),  INT16_C( 15778), -INT16_C(  4513), -INT16_C(  8135), -INT16_C( 17339), -INT16_C( 20440) } },
+    { { -INT16_C( 10497),  INT16_C(  3801),  INT16_C( 16760), -INT16_C( 12256), -INT16_C( 28292),  INT16_C(  2735),  INT16_C( 14087), -INT16_C( 17464),
+         INT16_C( 12480), -INT16_C( 26397), -INT16_C( 21876),  INT16_C(  7854),  INT16_C(  6235), -INT16_C( 15469), -INT16_C( 25737), -INT16_C(  4923),
+        -INT16_C( 20799),  INT16_C( 17033),  INT16_C( 21985), -INT16_C( 28255),  INT16_C( 14326), -INT16_C(  4707),  INT16_C( 14294), -INT16_C( 28974),
+        -INT16_C(  4226), -INT16_C( 15852),  INT16_C( 12106), -INT16_C( 22285),  INT16_C( 11801),  INT16_C( 10409), -INT16_C(  7886),  INT16_C(  7412) },
+      UINT32_C(3613250090),
+      { -INT16_C( 31020),  INT16_C( 13679),  INT16_C( 27062), -INT16_C( 13441), -INT16_C( 19241), -INT16_C( 26845),  INT16_C(  3621),  INT16_C( 24569),
+         INT16_C( 28844),  INT16_C( 13754), -INT16_C( 28059),  INT16_C( 31071),  INT16_C( 32105), -INT16_C( 32006), -INT16_C(  1844),  INT16_C( 18717),
+        -INT16_C( 22907),  INT16_C( 20398),  INT16_C( 18772),  INT16_C(  4444), -INT16_C( 24653), -INT16_C(  1960),  INT16_C( 31329), -INT16_C( 24128),
+         INT16_C( 23976), -INT16_C( 27164), -INT16_C( 19244), -INT16_C( 21809), -INT16_C(  6110), -INT16_C( 17297), -INT16_C( 32269), -INT16_C( 19700) },
+      { -INT16_C( 10497), -INT16_C( 31020),  INT16_C( 16760),  INT16_C( 13679), -INT16_C( 28292),  INT16_C( 27062),  INT16_C( 14087), -INT16_C( 17464),
+         INT16_C( 12480), -INT16_C( 13441), -INT16_C( 21876),  INT16_C(  7854), -INT16_C( 19241), -INT16_C( 15469), -INT16_C( 26845),  INT16_C(  3621),
+         INT16_C( 24569),  INT16_C( 17033),  INT16_C( 28844),  INT16_C( 13754), -INT16_C( 28059), -INT16_C(  4707),  INT16_C( 31071), -INT16_C( 28974),
+         INT16_C( 32105), -INT16_C( 32006), -INT16_C(  1844), -INT16_C( 22285),  INT16_C( 18717),  INT16_C( 10409), -INT16_C( 22907),  INT16_C( 20398) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i r = simde_mm512_mask_expandloadu_epi16(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(4116458712),
+      {  INT16_C(  8780), -INT16_C( 22038),  INT16_C( 29254), -INT16_C( 14162),  INT16_C(  6209),  INT16_C( 21595), -INT16_C( 18038),  INT16_C(  5143),
+         INT16_C(   364), -INT16_C( 12202), -INT16_C( 15105), -INT16_C(  5231), -INT16_C(  8003), -INT16_C(  9868), -INT16_C( 32586),  INT16_C( 13232),
+         INT16_C( 15119),  INT16_C(   954),  INT16_C( 18386),  INT16_C( 12968), -INT16_C( 14938), -INT16_C( 30535),  INT16_C(  1477), -INT16_C( 28899),
+         INT16_C( 31963),  INT16_C( 12655),  INT16_C( 21568), -INT16_C( 27776), -INT16_C(  4671), -INT16_C(  2737),  INT16_C( 28567),  INT16_C(  8501) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8780), -INT16_C( 22038),  INT16_C(     0),  INT16_C( 29254), -INT16_C( 14162),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(  6209),  INT16_C( 21595),  INT16_C(     0), -INT16_C( 18038),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(  5143),  INT16_C(   364), -INT16_C( 12202),  INT16_C(     0), -INT16_C( 15105),  INT16_C(     0),
+        -INT16_C(  5231),  INT16_C(     0), -INT16_C(  8003),  INT16_C(     0), -INT16_C(  9868), -INT16_C( 32586),  INT16_C( 13232),  INT16_C( 15119) } },
+    { UINT32_C( 134230026),
+      { -INT16_C(   417),  INT16_C( 11051), -INT16_C(  1380),  INT16_C( 25895),  INT16_C( 32304),  INT16_C(  8986),  INT16_C( 14105), -INT16_C( 22073),
+         INT16_C(   820), -INT16_C( 11553), -INT16_C( 23401),  INT16_C( 24201),  INT16_C(  3921),  INT16_C( 15719),  INT16_C( 11605), -INT16_C(  1950),
+         INT16_C(  7921),  INT16_C(  5474), -INT16_C( 11861), -INT16_C( 28951), -INT16_C( 23161),  INT16_C( 10822), -INT16_C( 15492),  INT16_C( 22198),
+         INT16_C( 12480),  INT16_C(  4457),  INT16_C( 23933), -INT16_C( 17400),  INT16_C( 23234), -INT16_C( 23670),  INT16_C( 31795),  INT16_C(  4479) },
+      {  INT16_C(     0), -INT16_C(   417),  INT16_C(     0),  INT16_C( 11051),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1380),  INT16_C( 25895),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 32304),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1272963021),
+      {  INT16_C( 21559), -INT16_C(  3024), -INT16_C( 15989),  INT16_C( 31005), -INT16_C( 16982), -INT16_C( 10787), -INT16_C( 27384), -INT16_C(  9217),
+         INT16_C( 24788), -INT16_C( 10096), -INT16_C( 26107), -INT16_C( 21438), -INT16_C( 23307), -INT16_C( 12184), -INT16_C( 23344),  INT16_C( 27411),
+         INT16_C( 11222),  INT16_C( 24565), -INT16_C( 21194), -INT16_C( 10930),  INT16_C( 25211),  INT16_C( 23386), -INT16_C(  3925), -INT16_C( 31989),
+        -INT16_C(  3089), -INT16_C( 27794), -INT16_C( 17912), -INT16_C( 26973), -INT16_C(  6174),  INT16_C( 29101), -INT16_C( 14449), -INT16_C(  9661) },
+      {  INT16_C( 21559),  INT16_C(     0), -INT16_C(  3024), -INT16_C( 15989),  INT16_C(     0),  INT16_C(     0),  INT16_C( 31005), -INT16_C( 16982),
+        -INT16_C( 10787), -INT16_C( 27384), -INT16_C(  9217),  INT16_C( 24788), -INT16_C( 10096),  INT16_C(     0), -INT16_C( 26107), -INT16_C( 21438),
+        -INT16_C( 23307), -INT16_C( 12184), -INT16_C( 23344),  INT16_C( 27411),  INT16_C( 11222),  INT16_C(     0),  INT16_C( 24565), -INT16_C( 21194),
+        -INT16_C( 10930),  INT16_C( 25211),  INT16_C(     0),  INT16_C( 23386),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3925),  INT16_C(     0) } },
+    { UINT32_C(3082790911),
+      {  INT16_C( 26365), -INT16_C(  9872),  INT16_C(  4249), -INT16_C( 11314), -INT16_C( 28053), -INT16_C( 20954), -INT16_C(  4601),  INT16_C( 16065),
+        -INT16_C( 10602),  INT16_C( 27816),  INT16_C( 22325), -INT16_C( 26449),  INT16_C( 22765),  INT16_C( 11058),  INT16_C( 10532), -INT16_C(  5882),
+         INT16_C( 21479), -INT16_C( 31252),  INT16_C( 16777),  INT16_C(  9905),  INT16_C( 15263), -INT16_C( 15005),  INT16_C( 29865),  INT16_C( 25492),
+         INT16_C( 29374),  INT16_C( 16870), -INT16_C( 27660), -INT16_C( 10592),  INT16_C(  5506),  INT16_C(  9239), -INT16_C( 10267),  INT16_C(  7124) },
+      {  INT16_C( 26365), -INT16_C(  9872),  INT16_C(  4249), -INT16_C( 11314), -INT16_C( 28053), -INT16_C( 20954), -INT16_C(  4601),  INT16_C( 16065),
+        -INT16_C( 10602),  INT16_C( 27816),  INT16_C( 22325),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26449),  INT16_C(     0),  INT16_C( 22765),
+         INT16_C( 11058),  INT16_C( 10532), -INT16_C(  5882),  INT16_C( 21479), -INT16_C( 31252),  INT16_C( 16777),  INT16_C(     0),  INT16_C(  9905),
+         INT16_C( 15263), -INT16_C( 15005),  INT16_C( 29865),  INT16_C(     0),  INT16_C( 25492),  INT16_C( 29374),  INT16_C(     0),  INT16_C( 16870) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi16(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  2077024807), -INT32_C(  1622988969), -INT32_C(  2131246522),  INT32_C(   887366827), -INT32_C(  1820459545), -INT32_C(  1325752119),  INT32_C(   338384314), -INT32_C(   599476880),
+        -INT32_C(  1121362424), -INT32_C(  1936372246),  INT32_C(   639585072),  INT32_C(   822855270),  INT32_C(   580323936),  INT32_C(    62403049), -INT32_C(   220276238),  INT32_C(  1465925284) },
+      UINT16_C(52435),
+      {  INT32_C(  1865128750),  INT32_C(   107109262),  INT32_C(   570021511),  INT32_C(   649164138), -INT32_C(  1585192045), -INT32_C(  1807110042),  INT32_C(  1588380504),  INT32_C(   844084108),
+        -INT32_C(   800396442),  INT32_C(  1368598104),  INT32_C(  2139039493), -INT32_C(  1534932621), -INT32_C(   275694486),  INT32_C(   340121142), -INT32_C(  1388922208), -INT32_C(   378292963) },
+      {  INT32_C(  1865128750),  INT32_C(   107109262), -INT32_C(  2131246522),  INT32_C(   887366827),  INT32_C(   570021511), -INT32_C(  1325752119),  INT32_C(   649164138), -INT32_C(  1585192045),
+        -INT32_C(  1121362424), -INT32_C(  1936372246), -INT32_C(  1807110042),  INT32_C(  1588380504),  INT32_C(   580323936),  INT32_C(    62403049),  INT32_C(   844084108), -INT32_C(   800396442) } },
+    { {  INT32_C(  1803778976), -INT32_C(  1751793644), -INT32_C(  1793491570), -INT32_C(  2100400572), -INT32_C(   416861394),  INT32_C(  1362659435), -INT32_C(  1895548854),  INT32_C(   509264114),
+         INT32_C(  1002663728), -INT32_C(  1066844816), -INT32_C(   775527950), -INT32_C(   198514524),  INT32_C(   471711135),  INT32_C(  1218695412), -INT32_C(  1537443107), -INT32_C(   565127520) },
+      UINT16_C(21366),
+      { -INT32_C(  1477682537),  INT32_C(  1496854009), -INT32_C(   974581246),  INT32_C(  1643457337),  INT32_C(  1684303806), -INT32_C(   302120707),  INT32_C(   955554933), -INT32_C(   394561735),
+        -INT32_C(  1408356652),  INT32_C(   706930956), -INT32_C(    69906558), -INT32_C(   134607451),  INT32_C(  1236922584),  INT32_C(  1912433256),  INT32_C(  2045363710),  INT32_C(  1948636548) },
+      {  INT32_C(  1803778976), -INT32_C(  1477682537),  INT32_C(  1496854009), -INT32_C(  2100400572), -INT32_C(   974581246),  INT32_C(  1643457337),  INT32_C(  1684303806),  INT32_C(   509264114),
+        -INT32_C(   302120707),  INT32_C(   955554933), -INT32_C(   775527950), -INT32_C(   198514524), -INT32_C(   394561735),  INT32_C(  1218695412), -INT32_C(  1408356652), -INT32_C(   565127520) } },
+    { {  INT32_C(  2036437393), -INT32_C(  2129236599),  INT32_C(   942317445),  INT32_C(  1244161026), -INT32_C(  1540365376), -INT32_C(   258849335), -INT32_C(   951987036), -INT32_C(  1807791346),
+        -INT32_C(   246640832),  INT32_C(  1427875019),  INT32_C(    23694756), -INT32_C(  1073803845), -INT32_C(   868809541), -INT32_C(   626123088),  INT32_C(   203986166), -INT32_C(  1940715977) },
+      UINT16_C(34817),
+      { -INT32_C(   502232637),  INT32_C(   263763887),  INT32_C(   793742757),  INT32_C(   972512439), -INT32_C(  1690935906), -INT32_C(  1728338914), -INT32_C(   784151350),  INT32_C(  1853326707),
+        -INT32_C(  1463872646), -INT32_C(  1335465317), -INT32_C(   256511106),  INT32_C(  1363777283),  INT32_C(   522666268), -INT32_C(   667089866),  INT32_C(  1502495251),  INT32_C(   135613161) },
+      { -INT32_C(   502232637), -INT32_C(  2129236599),  INT32_C(   942317445),  INT32_C(  1244161026), -INT32_C(  1540365376), -INT32_C(   258849335), -INT32_C(   951987036), -INT32_C(  1807791346),
+        -INT32_C(   246640832),  INT32_C(  1427875019),  INT32_C(    23694756),  INT32_C(   263763887), -INT32_C(   868809541), -INT32_C(   626123088),  INT32_C(   203986166),  INT32_C(   793742757) } },
+    { { -INT32_C(  2095656988),  INT32_C(  1472685619),  INT32_C(   862454428), -INT32_C(   116548265), -INT32_C(  1065846141), -INT32_C(   272368401), -INT32_C(  1746251204), -INT32_C(  1605579803),
+        -INT32_C(  1288736265), -INT32_C(  1793028005), -INT32_C(   281223551),  INT32_C(   659583518),  INT32_C(  1414173200),  INT32_C(  1670071956),  INT32_C(  2004932374), -INT32_C(  1669739907) },
+      UINT16_C(14730),
+      { -INT32_C(  1900052639), -INT32_C(  1541836872), -INT32_C(   685129010),  INT32_C(  1497598495), -INT32_C(   923343455), -INT32_C(   762922364),  INT32_C(   327376287), -INT32_C(  1760354034),
+        -INT32_C(  1926256873),  INT32_C(   302427342), -INT32_C(   282309696),  INT32_C(   885965145), -INT32_C(   281948653),  INT32_C(  1455040261),  INT32_C(  1234602542),  INT32_C(  2140245201) },
+      { -INT32_C(  2095656988), -INT32_C(  1900052639),  INT32_C(   862454428), -INT32_C(  1541836872), -INT32_C(  1065846141), -INT32_C(   272368401), -INT32_C(  1746251204), -INT32_C(   685129010),
+         INT32_C(  1497598495), -INT32_C(  1793028005), -INT32_C(   281223551), -INT32_C(   923343455), -INT32_C(   762922364),  INT32_C(   327376287),  INT32_C(  2004932374), -INT32_C(  1669739907) } },
+    { { -INT32_C(  1058249151),  INT32_C(  2012352710), -INT32_C(  1334050861),  INT32_C(  1504177903), -INT32_C(   586149173), -INT32_C(  1866203091), -INT32_C(  1022445301),  INT32_C(  2135311009),
+         INT32_C(   881486357), -INT32_C(  1226221891), -INT32_C(  1057081839),  INT32_C(   962555780),  INT32_C(   789340945),  INT32_C(  1125264984), -INT32_C(  1194006996), -INT32_C(  1155237445) },
+      UINT16_C(64467),
+      {  INT32_C(   674240334), -INT32_C(  1132664331),  INT32_C(   462182088), -INT32_C(   112324544), -INT32_C(   309045582), -INT32_C(   746802828), -INT32_C(  1598047157),  INT32_C(  1225729149),
+        -INT32_C(   300825806), -INT32_C(  2066398895),  INT32_C(   189113500), -INT32_C(  1974432040), -INT32_C(  1948104998), -INT32_C(   439532522),  INT32_C(  1545886345), -INT32_C(  1329914803) },
+      {  INT32_C(   674240334), -INT32_C(  1132664331), -INT32_C(  1334050861),  INT32_C(  1504177903),  INT32_C(   462182088), -INT32_C(  1866203091), -INT32_C(   112324544), -INT32_C(   309045582),
+        -INT32_C(   746802828), -INT32_C(  1598047157), -INT32_C(  1057081839),  INT32_C(  1225729149), -INT32_C(   300825806), -INT32_C(  2066398895),  INT32_C(   189113500), -INT32_C(  1974432040) } },
+    { {  INT32_C(  1917754363), -INT32_C(  1674411870), -INT32_C(   569518509),  INT32_C(  1526513144),  INT32_C(  1366341862),  INT32_C(   568302040),  INT32_C(  2067454312),  INT32_C(   611567919),
+        -INT32_C(  1170422043), -INT32_C(   740494337), -INT32_C(   842992314), -INT32_C(  2143547384), -INT32_C(   997232678), -INT32_C(  1926788658), -INT32_C(  1297615396), -INT32_C(   370481531) },
+      UINT16_C(49129),
+      {  INT32_C(   872450115),  INT32_C(  1580982607), -INT32_C(  1603118188), -INT32_C(   687919678), -INT32_C(  1373569248), -INT32_C(  1813601869),  INT32_C(   495627053), -INT32_C(  1152800955),
+         INT32_C(  1336476115),  INT32_C(  1701734072),  INT32_C(  1576504797),  INT32_C(   729356081), -INT32_C(   120533338),  INT32_C(   214695994),  INT32_C(   659060453),  INT32_C(  1486893571) },
+      {  INT32_C(   872450115), -INT32_C(  1674411870), -INT32_C(   569518509),  INT32_C(  1580982607),  INT32_C(  1366341862), -INT32_C(  1603118188), -INT32_C(   687919678), -INT32_C(  1373569248),
+        -INT32_C(  1813601869),  INT32_C(   495627053), -INT32_C(  1152800955),  INT32_C(  1336476115),  INT32_C(  1701734072),  INT32_C(  1576504797), -INT32_C(  1297615396),  INT32_C(   729356081) } },
+    { { -INT32_C(  2073447826), -INT32_C(  1816444575),  INT32_C(   907299951), -INT32_C(   151796514), -INT32_C(   226289961), -INT32_C(   189697927),  INT32_C(   287614803), -INT32_C(  1363250663),
+        -INT32_C(   492721724),  INT32_C(  2091163163),  INT32_C(   999026034), -INT32_C(   103139338), -INT32_C(   707860175), -INT32_C(  1528870132), -INT32_C(  1961797008),  INT32_C(  1284144795) },
+      UINT16_C(46790),
+      { -INT32_C(  1979376171), -INT32_C(   561589344), -INT32_C(  2075762514),  INT32_C(  1695347145),  INT32_C(  1093339329), -INT32_C(  1601367274),  INT32_C(  1152501125),  INT32_C(  1829669836),
+        -INT32_C(  1325309205), -INT32_C(  2098114987), -INT32_C(  1090597791),  INT32_C(   810502520), -INT32_C(   845108420),  INT32_C(  1466072944),  INT32_C(   188414157), -INT32_C(  1087079788) },
+      { -INT32_C(  2073447826), -INT32_C(  1979376171), -INT32_C(   561589344), -INT32_C(   151796514), -INT32_C(   226289961), -INT32_C(   189697927), -INT32_C(  2075762514),  INT32_C(  1695347145),
+        -INT32_C(   492721724),  INT32_C(  1093339329), -INT32_C(  1601367274), -INT32_C(   103139338),  INT32_C(  1152501125),  INT32_C(  1829669836), -INT32_C(  1961797008), -INT32_C(  1325309205) } },
+    { { -INT32_C(   473347248), -INT32_C(  1043488234),  INT32_C(  1912368128),  INT32_C(  1975240270), -INT32_C(  1267576052), -INT32_C(  1469641088),  INT32_C(   720270793),  INT32_C(  1564505326),
+         INT32_C(    49319407),  INT32_C(   923157993),  INT32_C(  1499674184), -INT32_C(  1657523797), -INT32_C(  1789109064),  INT32_C(  1836606089), -INT32_C(   643386532),  INT32_C(   277093664) },
+      UINT16_C(57674),
+      { -INT32_C(   207798038),  INT32_C(  1268329173),  INT32_C(  1598963950),  INT32_C(  1139161167), -INT32_C(  1681211878), -INT32_C(  1518127338),  INT32_C(   901910140),  INT32_C(   909925705),
+        -INT32_C(   247918650), -INT32_C(   511423734),  INT32_C(  1759811262),  INT32_C(  1505123984),  INT32_C(   471035690), -INT32_C(   218370436),  INT32_C(  2086229131), -INT32_C(  1516155175) },
+      { -INT32_C(   473347248), -INT32_C(   207798038),  INT32_C(  1912368128),  INT32_C(  1268329173), -INT32_C(  1267576052), -INT32_C(  1469641088),  INT32_C(  1598963950),  INT32_C(  1564505326),
+         INT32_C(  1139161167),  INT32_C(   923157993),  INT32_C(  1499674184), -INT32_C(  1657523797), -INT32_C(  1789109064), -INT32_C(  1681211878), -INT32_C(  1518127338),  INT32_C(   901910140) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(22939),
+      {  INT32_C(  1179895210),  INT32_C(   951634343),  INT32_C(  1980134199), -INT32_C(  1281779010),  INT32_C(   984837850), -INT32_C(   762666677),  INT32_C(  1420570813),  INT32_C(  1450641252),
+        -INT32_C(  1511163140),  INT32_C(  1256762061), -INT32_C(  1318094659), -INT32_C(   486808928), -INT32_C(  1928716665), -INT32_C(  1404365061),  INT32_C(   727233990), -INT32_C(   521784905) },
+      {  INT32_C(  1179895210),  INT32_C(   951634343),  INT32_C(           0),  INT32_C(  1980134199), -INT32_C(  1281779010),  INT32_C(           0),  INT32_C(           0),  INT32_C(   984837850),
+        -INT32_C(   762666677),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1420570813),  INT32_C(  1450641252),  INT32_C(           0), -INT32_C(  1511163140),  INT32_C(           0) } },
+    { UINT16_C(59891),
+      {  INT32_C(  1053984714), -INT32_C(   839344693),  INT32_C(   948049422), -INT32_C(  1774305602),  INT32_C(  1142948340),  INT32_C(   209786525),  INT32_C(  1183188225), -INT32_C(  1374524023),
+         INT32_C(  1928496969),  INT32_C(   103843009), -INT32_C(  1411878489), -INT32_C(   953050397), -INT32_C(  1523719813),  INT32_C(   199223126), -INT32_C(   315474697), -INT32_C(  1559628015) },
+      {  INT32_C(  1053984714), -INT32_C(   839344693),  INT32_C(           0),  INT32_C(           0),  INT32_C(   948049422), -INT32_C(  1774305602),  INT32_C(  1142948340),  INT32_C(   209786525),
+         INT32_C(  1183188225),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1374524023),  INT32_C(           0),  INT32_C(  1928496969),  INT32_C(   103843009), -INT32_C(  1411878489) } },
+    { UINT16_C(65014),
+      {  INT32_C(   300472193), -INT32_C(  1042954168), -INT32_C(   345574866),  INT32_C(   679129867), -INT32_C(   379388487), -INT32_C(  1531936150),  INT32_C(    36067046), -INT32_C(   760235677),
+        -INT32_C(  1721873374), -INT32_C(    79395943), -INT32_C(  1617035697),  INT32_C(  1315957537), -INT32_C(   273511268),  INT32_C(    26179733),  INT32_C(  1568986888),  INT32_C(  1201562573) },
+      {  INT32_C(           0),  INT32_C(   300472193), -INT32_C(  1042954168),  INT32_C(           0), -INT32_C(   345574866),  INT32_C(   679129867), -INT32_C(   379388487), -INT32_C(  1531936150),
+         INT32_C(    36067046),  INT32_C(           0), -INT32_C(   760235677), -INT32_C(  1721873374), -INT32_C(    79395943), -INT32_C(  1617035697),  INT32_C(  1315957537), -INT32_C(   273511268) } },
+    { UINT16_C(53222),
+      { -INT32_C(  1749242652),  INT32_C(  1426673004), -INT32_C(  1225125396),  INT32_C(   841393616),  INT32_C(  1371560553), -INT32_C(  1645591600), -INT32_C(  1641177027), -INT32_C(  2009898587),
+         INT32_C(  1969443878), -INT32_C(  1909449189),  INT32_C(   519308667),  INT32_C(  2035580584),  INT32_C(   233284414),  INT32_C(  1845628067),  INT32_C(  1723604854),  INT32_C(   544644905) },
+      {  INT32_C(           0), -INT32_C(  1749242652),  INT32_C(  1426673004),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1225125396),  INT32_C(   841393616),  INT32_C(  1371560553),
+        -INT32_C(  1645591600), -INT32_C(  1641177027), -INT32_C(  2009898587),  INT32_C(  1969443878),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1909449189),  INT32_C(   519308667) } },
+    { UINT16_C(46516),
+      { -INT32_C(   959983081),  INT32_C(  1303564446), -INT32_C(   461264145), -INT32_C(   480713636),  INT32_C(  2141037019),  INT32_C(   620957889),  INT32_C(   394928659), -INT32_C(  1757811986),
+         INT32_C(  1377331367),  INT32_C(  1832644573), -INT32_C(  1050224364), -INT32_C(  1675907371), -INT32_C(  1541547985), -INT32_C(    80453576), -INT32_C(  1493715801), -INT32_C(  1234510664) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   959983081),  INT32_C(           0),  INT32_C(  1303564446), -INT32_C(   461264145),  INT32_C(           0), -INT32_C(   480713636),
+         INT32_C(  2141037019),  INT32_C(           0),  INT32_C(   620957889),  INT32_C(           0),  INT32_C(   394928659), -INT32_C(  1757811986),  INT32_C(           0),  INT32_C(  1377331367) } },
+    { UINT16_C(32511),
+      { -INT32_C(   188252455),  INT32_C(  1363726155), -INT32_C(  1704201752), -INT32_C(  1491012234), -INT32_C(  1661706450),  INT32_C(  1543615484), -INT32_C(   460073284),  INT32_C(  1275223361),
+         INT32_C(  1585474210),  INT32_C(   268336018), -INT32_C(  1857277613),  INT32_C(  1250392564), -INT32_C(  1382877682), -INT32_C(   773550414),  INT32_C(   988889152),  INT32_C(   187821384) },
+      { -INT32_C(   188252455),  INT32_C(  1363726155), -INT32_C(  1704201752), -INT32_C(  1491012234), -INT32_C(  1661706450),  INT32_C(  1543615484), -INT32_C(   460073284),  INT32_C(  1275223361),
+         INT32_C(           0),  INT32_C(  1585474210),  INT32_C(   268336018), -INT32_C(  1857277613),  INT32_C(  1250392564), -INT32_C(  1382877682), -INT32_C(   773550414),  INT32_C(           0) } },
+    { UINT16_C(49023),
+      {  INT32_C(   551247665),  INT32_C(  1398445182), -INT32_C(   624751499),  INT32_C(   640210885), -INT32_C(  1067066558),  INT32_C(    91228751),  INT32_C(  1782169189), -INT32_C(    55123787),
+         INT32_C(  1072767786),  INT32_C(   996851080),  INT32_C(  2074717847),  INT32_C(  1333080149),  INT32_C(   307254763), -INT32_C(   920887402), -INT32_C(  1005747562),  INT32_C(    98274015) },
+      {  INT32_C(   551247665),  INT32_C(  1398445182), -INT32_C(   624751499),  INT32_C(   640210885), -INT32_C(  1067066558),  INT32_C(    91228751),  INT32_C(  1782169189),  INT32_C(           0),
+        -INT32_C(    55123787),  INT32_C(  1072767786),  INT32_C(   996851080),  INT32_C(  2074717847),  INT32_C(  1333080149),  INT32_C(   307254763),  INT32_C(           0), -INT32_C(   920887402) } },
+    { UINT16_C( 6423),
+      {  INT32_C(  2119927421), -INT32_C(   867451617),  INT32_C(  1022598906),  INT32_C(  1821988582),  INT32_C(  1720992258),  INT32_C(   426737279),  INT32_C(  1315522293),  INT32_C(   662713828),
+         INT32_C(  1907846912),  INT32_C(  1835321605), -INT32_C(   146213591),  INT32_C(   714991803),  INT32_C(   592587987), -INT32_C(   117023082), -INT32_C(  1829312729), -INT32_C(    28555073) },
+      {  INT32_C(  2119927421), -INT32_C(   867451617),  INT32_C(  1022598906),  INT32_C(           0),  INT32_C(  1821988582),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  1720992258),  INT32_C(           0),  INT32_C(           0),  INT32_C(   426737279),  INT32_C(  1315522293),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expandloadu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  1750386874), -INT32_C(  1160969895),  INT32_C(  2027598261), -INT32_C(    70865204),  INT32_C(  1091152118), -INT32_C(  1292494736),  INT32_C(  1098013458),  INT32_C(  1039850584),
+        -INT32_C(   820177151), -INT32_C(  1454217363), -INT32_C(  1350763455), -INT32_C(   147429795),  INT32_C(   629421320),  INT32_C(   457817113),  INT32_C(  1805310977),  INT32_C(  1242598136) },
+      UINT16_C(11744),
+      { -INT32_C(   677171370), -INT32_C(  1642207853), -INT32_C(    60634696),  INT32_C(   495023725),  INT32_C(    62753519), -INT32_C(  2090624555),  INT32_C(  1201984125), -INT32_C(   354824581),
+         INT32_C(  1923897941),  INT32_C(  1317312922),  INT32_C(   182821233), -INT32_C(   533802986),  INT32_C(  1770984235), -INT32_C(  1943047978), -INT32_C(   793852967), -INT32_C(  1420659101) },
+      {  INT32_C(  1750386874), -INT32_C(  1160969895),  INT32_C(  2027598261), -INT32_C(    70865204),  INT32_C(  1091152118), -INT32_C(   677171370), -INT32_C(  1642207853), -INT32_C(    60634696),
+         INT32_C(   495023725), -INT32_C(  1454217363),  INT32_C(    62753519), -INT32_C(  2090624555),  INT32_C(   629421320),  INT32_C(  1201984125),  INT32_C(  1805310977),  INT32_C(  1242598136) } },
+    { { -INT32_C(  1245405171),  INT32_C(   488123247), -INT32_C(  1046914009),  INT32_C(   729091118),  INT32_C(  1973288540), -INT32_C(  1820774415), -INT32_C(   947564438),  INT32_C(  1493970059),
+         INT32_C(   663523318),  INT32_C(   233679612), -INT32_C(  1411880887), -INT32_C(  1473999032), -INT32_C(  1950049021), -INT32_C(   388011297), -INT32_C(     2881018),  INT32_C(  1743096824) },
+      UINT16_C(62590),
+      {  INT32_C(  1386543162), -INT32_C(   205784459), -INT32_C(   467404151), -INT32_C(   404340029),  INT32_C(   515796172), -INT32_C(   587499083),  INT32_C(  1459114590),  INT32_C(  1533913306),
+        -INT32_C(   877171702), -INT32_C(  1896987555),  INT32_C(  1813064584), -INT32_C(   585895469),  INT32_C(  1677068429), -INT32_C(  1290986725),  INT32_C(   626077682), -INT32_C(  1100607895) },
+      { -INT32_C(  1245405171),  INT32_C(  1386543162), -INT32_C(   205784459), -INT32_C(   467404151), -INT32_C(   404340029),  INT32_C(   515796172), -INT32_C(   587499083),  INT32_C(  1493970059),
+         INT32_C(   663523318),  INT32_C(   233679612),  INT32_C(  1459114590), -INT32_C(  1473999032),  INT32_C(  1533913306), -INT32_C(   877171702), -INT32_C(  1896987555),  INT32_C(  1813064584) } },
+    { {  INT32_C(  2054968660), -INT32_C(  1469718488), -INT32_C(   868026594), -INT32_C(   247021778), -INT32_C(  1469141602), -INT32_C(   436420967),  INT32_C(  2014718895), -INT32_C(  2013022360),
+         INT32_C(   769056002), -INT32_C(   188898420),  INT32_C(   619138929), -INT32_C(   916254810), -INT32_C(   456771059),  INT32_C(   763646550),  INT32_C(  1358711908),  INT32_C(  1621737066) },
+      UINT16_C(21056),
+      { -INT32_C(  1535046086),  INT32_C(   439931991),  INT32_C(   765741755),  INT32_C(  1289996724), -INT32_C(   893399720), -INT32_C(   517809174),  INT32_C(   379584608), -INT32_C(  1108809948),
+         INT32_C(   227161602),  INT32_C(  1401105492), -INT32_C(   489197983), -INT32_C(  1020189509), -INT32_C(  1219239908), -INT32_C(   244120904), -INT32_C(   747481803),  INT32_C(   777997602) },
+      {  INT32_C(  2054968660), -INT32_C(  1469718488), -INT32_C(   868026594), -INT32_C(   247021778), -INT32_C(  1469141602), -INT32_C(   436420967), -INT32_C(  1535046086), -INT32_C(  2013022360),
+         INT32_C(   769056002),  INT32_C(   439931991),  INT32_C(   619138929), -INT32_C(   916254810),  INT32_C(   765741755),  INT32_C(   763646550),  INT32_C(  1289996724),  INT32_C(  1621737066) } },
+    { {  INT32_C(   151065184), -INT32_C(  1736188799),  INT32_C(   734660720),  INT32_C(  1135706908), -INT32_C(  1125632390),  INT32_C(  2143997921), -INT32_C(  1313513516),  INT32_C(   704475154),
+        -INT32_C(  1988521723),  INT32_C(  1020197851),  INT32_C(   903553588), -INT32_C(   488167400), -INT32_C(   189973225), -INT32_C(  1068900378),  INT32_C(  1630125825), -INT32_C(   912772926) },
+      UINT16_C( 3625),
+      { -INT32_C(  1480231882), -INT32_C(   149471790),  INT32_C(   213906654), -INT32_C(  1731726544), -INT32_C(  1073856839),  INT32_C(  1857135942), -INT32_C(   625462352),  INT32_C(   492768510),
+        -INT32_C(  1034502882), -INT32_C(   997297338),  INT32_C(   111615776),  INT32_C(  1859365493), -INT32_C(  1099767486),  INT32_C(  2117009449), -INT32_C(  1706223858), -INT32_C(   837249973) },
+      { -INT32_C(  1480231882), -INT32_C(  1736188799),  INT32_C(   734660720), -INT32_C(   149471790), -INT32_C(  1125632390),  INT32_C(   213906654), -INT32_C(  1313513516),  INT32_C(   704475154),
+        -INT32_C(  1988521723), -INT32_C(  1731726544), -INT32_C(  1073856839),  INT32_C(  1857135942), -INT32_C(   189973225), -INT32_C(  1068900378),  INT32_C(  1630125825), -INT32_C(   912772926) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i r = simde_mm512_mask_expandloadu_epi32(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(48227),
+      { -INT32_C(    30121884), -INT32_C(  1708230149),  INT32_C(   837266158), -INT32_C(  2066024609),  INT32_C(   830565296),  INT32_C(  2046863007), -INT32_C(  2011088310), -INT32_C(  1530594344),
+        -INT32_C(  1720459889),  INT32_C(  1598178198), -INT32_C(  1747367450), -INT32_C(  1628150276), -INT32_C(  2105083372), -INT32_C(  2119020717),  INT32_C(  1952280299), -INT32_C(  1599192962) },
+      { -INT32_C(    30121884), -INT32_C(  1708230149),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   837266158), -INT32_C(  2066024609),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(   830565296),  INT32_C(  2046863007), -INT32_C(  2011088310), -INT32_C(  1530594344),  INT32_C(           0), -INT32_C(  1720459889) } },
+    { UINT16_C(65470),
+      {  INT32_C(   256019813), -INT32_C(   992636695), -INT32_C(  1571561203), -INT32_C(   851777947),  INT32_C(  2081045835),  INT32_C(   231452783), -INT32_C(   806960589),  INT32_C(   229640508),
+         INT32_C(   847722445), -INT32_C(   692593961), -INT32_C(  1348832027), -INT32_C(   730312910), -INT32_C(   468180135),  INT32_C(  1939154338),  INT32_C(   826057350),  INT32_C(  2140378819) },
+      {  INT32_C(           0),  INT32_C(   256019813), -INT32_C(   992636695), -INT32_C(  1571561203), -INT32_C(   851777947),  INT32_C(  2081045835),  INT32_C(           0),  INT32_C(   231452783),
+        -INT32_C(   806960589),  INT32_C(   229640508),  INT32_C(   847722445), -INT32_C(   692593961), -INT32_C(  1348832027), -INT32_C(   730312910), -INT32_C(   468180135),  INT32_C(  1939154338) } },
+    { UINT16_C( 2048),
+      { -INT32_C(  1135660158),  INT32_C(   321375454), -INT32_C(   255513636),  INT32_C(  1323276061),  INT32_C(   863165096),  INT32_C(  2142820499), -INT32_C(  1624781677),  INT32_C(    18603382),
+         INT32_C(  1952254711), -INT32_C(   398177793), -INT32_C(   423737248),  INT32_C(  2021590014),  INT32_C(   842518929),  INT32_C(  1060455888),  INT32_C(   912542668),  INT32_C(   541545911) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1135660158),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C( 2304),
+      {  INT32_C(   281443935),  INT32_C(   317003069),  INT32_C(  1185258421),  INT32_C(  1223646604), -INT32_C(   543718813),  INT32_C(   749175885),  INT32_C(   657201517),  INT32_C(   450490861),
+         INT32_C(  1599396351), -INT32_C(  1001566410),  INT32_C(  1604190632),  INT32_C(  1949872063),  INT32_C(   335605311),  INT32_C(     3353550),  INT32_C(   378438290), -INT32_C(  1794648007) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   281443935),  INT32_C(           0),  INT32_C(           0),  INT32_C(   317003069),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi32(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 1769104428296180185), -INT64_C( 8506614535902054780), -INT64_C( 5623669453178215386), -INT64_C( 7247252432653908233),
+        -INT64_C( 6778517703648841014),  INT64_C( 2039197544598422152),  INT64_C( 6068232831954183682), -INT64_C( 8976264590039487382) },
+      UINT8_C(225),
+      {  INT64_C( 2017795160586638335),  INT64_C( 5308396313626558272), -INT64_C( 3395949144466071035),  INT64_C(  907954071272344081),
+         INT64_C( 6409564753680691475), -INT64_C( 3496541810697980108),  INT64_C( 2229440526431038548),  INT64_C( 5409047101593225145) },
+      {  INT64_C( 2017795160586638335), -INT64_C( 8506614535902054780), -INT64_C( 5623669453178215386), -INT64_C( 7247252432653908233),
+        -INT64_C( 6778517703648841014),  INT64_C( 5308396313626558272), -INT64_C( 3395949144466071035),  INT64_C(  907954071272344081) } },
+    { { -INT64_C( 1859422157743630059),  INT64_C( 3130949326605250546), -INT64_C( 2649812325671977599), -INT64_C( 4603853983839409631),
+        -INT64_C(  983990045355011674),  INT64_C(  690307227630200165), -INT64_C( 5880506485656274197),  INT64_C(  134947680184336646) },
+      UINT8_C(143),
+      { -INT64_C( 5187542924201311735),  INT64_C( 8299684304727430238), -INT64_C(  122407673473365272),  INT64_C( 6725438782319483509),
+        -INT64_C(   50377074829715688),  INT64_C( 6247173347922406869),  INT64_C( 3226357703398951392),  INT64_C( 8009562099773976696) },
+      { -INT64_C( 5187542924201311735),  INT64_C( 8299684304727430238), -INT64_C(  122407673473365272),  INT64_C( 6725438782319483509),
+        -INT64_C(  983990045355011674),  INT64_C(  690307227630200165), -INT64_C( 5880506485656274197), -INT64_C(   50377074829715688) } },
+    { {  INT64_C( 4057867113913612172), -INT64_C( 5986000264788701613), -INT64_C( 6849282087504761048),  INT64_C( 2430675576228065082),
+        -INT64_C( 7897740408680883961),  INT64_C( 9014360727602920211), -INT64_C( 3745308814703755026), -INT64_C( 1692560530929467332) },
+      UINT8_C(222),
+      { -INT64_C( 8147206435623248193),  INT64_C(  454400229766992072), -INT64_C( 4333612462621066212),  INT64_C( 2010513678520656354),
+         INT64_C( 7687643357255106748),  INT64_C( 6264875037136849938), -INT64_C(  793068466322953179), -INT64_C( 1555140476164761193) },
+      {  INT64_C( 4057867113913612172), -INT64_C( 8147206435623248193),  INT64_C(  454400229766992072), -INT64_C( 4333612462621066212),
+         INT64_C( 2010513678520656354),  INT64_C( 9014360727602920211),  INT64_C( 7687643357255106748),  INT64_C( 6264875037136849938) } },
+    { { -INT64_C( 1513145061217525638),  INT64_C( 3463692541169070017), -INT64_C( 5257240461318817779),  INT64_C( 4139690462014566402),
+         INT64_C( 7429769099397019598),  INT64_C( 7835671522773511644), -INT64_C( 6667739273709026855),  INT64_C( 6994745549121709771) },
+      UINT8_C(119),
+      { -INT64_C( 6324647915704798115), -INT64_C( 7161522419743178842), -INT64_C( 8310723748689903904), -INT64_C( 7167437685660819857),
+        -INT64_C( 3955687686429723744), -INT64_C( 1521937984770984788),  INT64_C( 1909302333809207543),  INT64_C(  308324297172803998) },
+      { -INT64_C( 6324647915704798115), -INT64_C( 7161522419743178842), -INT64_C( 8310723748689903904),  INT64_C( 4139690462014566402),
+        -INT64_C( 7167437685660819857), -INT64_C( 3955687686429723744), -INT64_C( 1521937984770984788),  INT64_C( 6994745549121709771) } },
+    { {  INT64_C( 6295699010511347933), -INT64_C( 2257683391520726695),  INT64_C( 6287453719148843137),  INT64_C( 1866919670195653318),
+        -INT64_C( 5303185490266602075), -INT64_C( 4526444138390048531), -INT64_C( 2705615958802191555),  INT64_C( 1454817304614380371) },
+      UINT8_C( 48),
+      { -INT64_C( 1910742930515260216), -INT64_C( 8590969429158043017), -INT64_C( 8054799391982237898), -INT64_C( 6766540460608315957),
+        -INT64_C( 1053213923755569708),  INT64_C( 8262748629315928099),  INT64_C( 5460174142421719090),  INT64_C(  124752130116792432) },
+      {  INT64_C( 6295699010511347933), -INT64_C( 2257683391520726695),  INT64_C( 6287453719148843137),  INT64_C( 1866919670195653318),
+        -INT64_C( 1910742930515260216), -INT64_C( 8590969429158043017), -INT64_C( 2705615958802191555),  INT64_C( 1454817304614380371) } },
+    { { -INT64_C( 1143837742673667981), -INT64_C( 5017932555263506366), -INT64_C( 2599167582844814461), -INT64_C( 8811303229222049769),
+         INT64_C( 1254044537839522146), -INT64_C( 1899498548459366254),  INT64_C(  593581452293578821),  INT64_C( 2898463474250841090) },
+      UINT8_C(159),
+      {  INT64_C( 7678906425856642394),  INT64_C( 1077855441606754665), -INT64_C( 7602747220387133185), -INT64_C( 7455967694179104193),
+         INT64_C(  918018576610739346),  INT64_C( 8990614171506858304), -INT64_C(  676381690889647890), -INT64_C( 2800219577054674916) },
+      {  INT64_C( 7678906425856642394),  INT64_C( 1077855441606754665), -INT64_C( 7602747220387133185), -INT64_C( 7455967694179104193),
+         INT64_C(  918018576610739346), -INT64_C( 1899498548459366254),  INT64_C(  593581452293578821),  INT64_C( 8990614171506858304) } },
+    { { -INT64_C( 3322869582209106104), -INT64_C( 5286511966773097517), -INT64_C(  871463824987965070),  INT64_C( 6237779614215934652),
+        -INT64_C( 8213778797000137340), -INT64_C( 2729668729992383041), -INT64_C( 8756726328681173210),  INT64_C( 8807150007174011610) },
+      UINT8_C(  2),
+      { -INT64_C( 6366563998356495696), -INT64_C( 8885602334481674919),  INT64_C( 4262708872476494728), -INT64_C(  958268162937630280),
+         INT64_C( 1749450328651396913),  INT64_C( 8691553427047703223), -INT64_C( 3325419700274575575), -INT64_C( 1487761936875317577) },
+      { -INT64_C( 3322869582209106104), -INT64_C( 6366563998356495696), -INT64_C(  871463824987965070),  INT64_C( 6237779614215934652),
+        -INT64_C( 8213778797000137340), -INT64_C( 2729668729992383041), -INT64_C( 8756726328681173210),  INT64_C( 8807150007174011610) } },
+    { { -INT64_C( 2330138175139566342),  INT64_C( 2520390275901653777), -INT64_C( 1621360325562937631),  INT64_C( 5551706179850767680),
+         INT64_C(   26840810507858498), -INT64_C( 6669389036351190962), -INT64_C( 8066580929742634892),  INT64_C( 9201338330150104518) },
+      UINT8_C(181),
+      {  INT64_C( 1054250387485820573),  INT64_C( 3405326582956287910), -INT64_C( 1528634669086603339), -INT64_C( 8590953510769724176),
+         INT64_C( 6981025214801796894), -INT64_C( 2874084872430914780), -INT64_C(  929430316653214613),  INT64_C( 1911900543385702032) },
+      {  INT64_C( 1054250387485820573),  INT64_C( 2520390275901653777),  INT64_C( 3405326582956287910),  INT64_C( 5551706179850767680),
+        -INT64_C( 1528634669086603339), -INT64_C( 8590953510769724176), -INT64_C( 8066580929742634892),  INT64_C( 6981025214801796894) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 20),
+      { -INT64_C( 3907013775607527365), -INT64_C( 4258150612221964913),  INT64_C( 4007269437405665512), -INT64_C( 4978275978593689047),
+        -INT64_C( 2501567416726334948), -INT64_C(  788656049345525586),  INT64_C( 7971637541075113439),  INT64_C( 7867128338169266679) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 3907013775607527365),  INT64_C(                   0),
+        -INT64_C( 4258150612221964913),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(143),
+      {  INT64_C( 2799478494429864385), -INT64_C( 8759692368358321021), -INT64_C(  233110682405410998),  INT64_C( 2523403745293900074),
+        -INT64_C( 4564169004772933195),  INT64_C( 4687256302321608298), -INT64_C( 4491722432347426503),  INT64_C( 3315894399775911593) },
+      {  INT64_C( 2799478494429864385), -INT64_C( 8759692368358321021), -INT64_C(  233110682405410998),  INT64_C( 2523403745293900074),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4564169004772933195) } },
+    { UINT8_C( 44),
+      { -INT64_C( 2888404117933200057), -INT64_C(   36545023218054279), -INT64_C( 7850950637928518021), -INT64_C( 4879805440487883570),
+        -INT64_C( 6860830907807074242), -INT64_C( 6954770503512396938),  INT64_C( 2765708691149400211), -INT64_C( 5575338187120721060) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2888404117933200057), -INT64_C(   36545023218054279),
+         INT64_C(                   0), -INT64_C( 7850950637928518021),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(235),
+      { -INT64_C( 8701692686056316038), -INT64_C(  551924989193666622), -INT64_C( 6756288469488868444), -INT64_C(  689786998523894223),
+         INT64_C( 3217660851309120243),  INT64_C( 1803893030447145380), -INT64_C( 4522750399050788036),  INT64_C( 5347284941295758817) },
+      { -INT64_C( 8701692686056316038), -INT64_C(  551924989193666622),  INT64_C(                   0), -INT64_C( 6756288469488868444),
+         INT64_C(                   0), -INT64_C(  689786998523894223),  INT64_C( 3217660851309120243),  INT64_C( 1803893030447145380) } },
+    { UINT8_C(185),
+      { -INT64_C( 7410972905839794128), -INT64_C( 3102306194405093932),  INT64_C( 5491669236701418391),  INT64_C( 6604680018851722156),
+         INT64_C(  378825725726658867),  INT64_C( 7386654569527440409),  INT64_C( 4403647455865043928),  INT64_C(  862966803361074142) },
+      { -INT64_C( 7410972905839794128),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 3102306194405093932),
+         INT64_C( 5491669236701418391),  INT64_C( 6604680018851722156),  INT64_C(                   0),  INT64_C(  378825725726658867) } },
+    { UINT8_C(238),
+      {  INT64_C(  569309278200882768),  INT64_C( 6564411216591581484),  INT64_C( 8963416791243459521), -INT64_C( 3614487553257989820),
+        -INT64_C( 6575996363477503801),  INT64_C( 3508971954743674109), -INT64_C( 8878047103398852143), -INT64_C( 8903488768944167025) },
+      {  INT64_C(                   0),  INT64_C(  569309278200882768),  INT64_C( 6564411216591581484),  INT64_C( 8963416791243459521),
+         INT64_C(                   0), -INT64_C( 3614487553257989820), -INT64_C( 6575996363477503801),  INT64_C( 3508971954743674109) } },
+    { UINT8_C(148),
+      { -INT64_C( 7462270151859267698), -INT64_C( 8777762923527228092),  INT64_C( 7089808111095244025), -INT64_C( 2002899300571455426),
+         INT64_C( 4546547258499505163), -INT64_C( 8275255864867722078), -INT64_C( 7991593320496235554),  INT64_C(   64236623136865190) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 7462270151859267698),  INT64_C(                   0),
+        -INT64_C( 8777762923527228092),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7089808111095244025) } },
+    { UINT8_C(  8),
+      {  INT64_C( 4194973386322435980), -INT64_C( 5221346878460694652),  INT64_C( 7514880149039843985), -INT64_C( 9115936034633489749),
+         INT64_C( 5125295933668489994), -INT64_C( 6525937513562952011),  INT64_C( 1312759913366527120), -INT64_C( 1437626510684170587) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4194973386322435980),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expandloadu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 4730451365216817599),  INT64_C(  504589839101524971), -INT64_C( 5557134243726099387), -INT64_C( 2896283785846320111),
+         INT64_C( 7670261306954959073), -INT64_C( 1330673029649827127), -INT64_C( 7211099860903330062), -INT64_C( 4829280638768059017) },
+      UINT8_C(248),
+      { -INT64_C( 4307818647187495112), -INT64_C( 1586078635576084471), -INT64_C( 5744367744121952379), -INT64_C( 8817999090225468235),
+        -INT64_C( 2020258681650811698),  INT64_C( 7005965993749316446), -INT64_C( 2618701346274196072), -INT64_C( 1741667680859456496) },
+      {  INT64_C( 4730451365216817599),  INT64_C(  504589839101524971), -INT64_C( 5557134243726099387), -INT64_C( 4307818647187495112),
+        -INT64_C( 1586078635576084471), -INT64_C( 5744367744121952379), -INT64_C( 8817999090225468235), -INT64_C( 2020258681650811698) } },
+    { { -INT64_C( 5092280727202116199),  INT64_C( 1776570597109175800), -INT64_C( 3031009138915639285),  INT64_C( 7178084775766482422),
+        -INT64_C( 2936717355321100164), -INT64_C( 1722099256196945821),  INT64_C( 3360993427138161875),  INT64_C( 3725780017474913253) },
+      UINT8_C( 30),
+      { -INT64_C( 4017039641084296258), -INT64_C( 2434828531422950476), -INT64_C( 5295058445466231573),  INT64_C( 4029058742405252629),
+         INT64_C( 7124074218681051387),  INT64_C( 4077479243266987952), -INT64_C(  589880388848922952),  INT64_C( 1811127946068081121) },
+      { -INT64_C( 5092280727202116199), -INT64_C( 4017039641084296258), -INT64_C( 2434828531422950476), -INT64_C( 5295058445466231573),
+         INT64_C( 4029058742405252629), -INT64_C( 1722099256196945821),  INT64_C( 3360993427138161875),  INT64_C( 3725780017474913253) } },
+    { {  INT64_C( 4750657078008842413),  INT64_C( 7670912604570421053), -INT64_C( 5614010261812632285),  INT64_C( 2636690962409877318),
+         INT64_C( 7082173690010347492),  INT64_C( 2719425829945169636), -INT64_C( 1303682552320958416),  INT64_C( 6592859565470183261) },
+      UINT8_C(  0),
+      { -INT64_C( 2729546183241982239), -INT64_C(  106217320110073949),  INT64_C( 5499391517963116918), -INT64_C( 7773576021863675246),
+        -INT64_C( 3659792140712074710),  INT64_C( 4756646730137984136),  INT64_C( 1131900649897832378),  INT64_C( 1581307453135092418) },
+      {  INT64_C( 4750657078008842413),  INT64_C( 7670912604570421053), -INT64_C( 5614010261812632285),  INT64_C( 2636690962409877318),
+         INT64_C( 7082173690010347492),  INT64_C( 2719425829945169636), -INT64_C( 1303682552320958416),  INT64_C( 6592859565470183261) } },
+    { { -INT64_C(  212628007604095161), -INT64_C( 5146062457841653162),  INT64_C( 2165937375757130041),  INT64_C( 5641165128614298037),
+         INT64_C( 5306743227468770881), -INT64_C( 8080292547173838962), -INT64_C( 2539869596902215292), -INT64_C( 8472234232877522829) },
+      UINT8_C(230),
+      {  INT64_C( 7885324062448059289),  INT64_C( 3334131883072642038),  INT64_C( 1288571553968167380),  INT64_C( 6774380549638724198),
+         INT64_C(  735146970558099760), -INT64_C( 8242303351841681560),  INT64_C( 5883705945321651359), -INT64_C( 1345993686818241155) },
+      { -INT64_C(  212628007604095161),  INT64_C( 7885324062448059289),  INT64_C( 3334131883072642038),  INT64_C( 5641165128614298037),
+         INT64_C( 5306743227468770881),  INT64_C( 1288571553968167380),  INT64_C( 6774380549638724198),  INT64_C(  735146970558099760) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i r = simde_mm512_mask_expandloadu_epi64(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 26),
+      {  INT64_C( 3756792625040775058),  INT64_C(  379359077144097866), -INT64_C( 7997717552442470019), -INT64_C( 2551439309426324988),
+        -INT64_C( 4430049535183942525),  INT64_C( 4387793882408250474),  INT64_C( 7260397086385951532), -INT64_C( 1435154195556104489) },
+      {  INT64_C(                   0),  INT64_C( 3756792625040775058),  INT64_C(                   0),  INT64_C(  379359077144097866),
+        -INT64_C( 7997717552442470019),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(108),
+      { -INT64_C(  730835584335995653),  INT64_C( 8228616966319602435),  INT64_C( 3119681005608807189),  INT64_C( 9023339264181931578),
+         INT64_C( 1022188596765870881), -INT64_C( 1741701892697099662),  INT64_C( 4636511060306346646),  INT64_C( 6158096465323277447) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(  730835584335995653),  INT64_C( 8228616966319602435),
+         INT64_C(                   0),  INT64_C( 3119681005608807189),  INT64_C( 9023339264181931578),  INT64_C(                   0) } },
+    { UINT8_C(211),
+      { -INT64_C( 5441182136785430171),  INT64_C( 5369785043229447385), -INT64_C( 5609445200828713778),  INT64_C( 4592788535791772247),
+         INT64_C( 6187276601241243584), -INT64_C( 4962080154434056148), -INT64_C( 6532951371879123248), -INT64_C( 3369042381457164688) },
+      { -INT64_C( 5441182136785430171),  INT64_C( 5369785043229447385),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C( 5609445200828713778),  INT64_C(                   0),  INT64_C( 4592788535791772247),  INT64_C( 6187276601241243584) } },
+    { UINT8_C(120),
+      { -INT64_C( 8228316647751178221), -INT64_C( 2824102434736617998),  INT64_C( 7114888353175307389), -INT64_C( 4043293432001440157),
+        -INT64_C( 1124164413885462095),  INT64_C( 3407500738590536112), -INT64_C( 4103571404528019148), -INT64_C( 2906186702267045021) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 8228316647751178221),
+        -INT64_C( 2824102434736617998),  INT64_C( 7114888353175307389), -INT64_C( 4043293432001440157),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi64(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -393.66), SIMDE_FLOAT32_C(  -431.54), SIMDE_FLOAT32_C(  -594.61), SIMDE_FLOAT32_C(  -816.49),
+        SIMDE_FLOAT32_C(   637.01), SIMDE_FLOAT32_C(  -761.74), SIMDE_FLOAT32_C(   -73.60), SIMDE_FLOAT32_C(  -463.46),
+        SIMDE_FLOAT32_C(   573.30), SIMDE_FLOAT32_C(  -737.72), SIMDE_FLOAT32_C(   978.81), SIMDE_FLOAT32_C(   818.89),
+        SIMDE_FLOAT32_C(  -129.68), SIMDE_FLOAT32_C(  -939.51), SIMDE_FLOAT32_C(  -402.90), SIMDE_FLOAT32_C(   848.59) },
+      UINT16_C(19250),
+      { SIMDE_FLOAT32_C(  -474.29), SIMDE_FLOAT32_C(   899.91), SIMDE_FLOAT32_C(    42.88), SIMDE_FLOAT32_C(   467.65),
+        SIMDE_FLOAT32_C(   771.27), SIMDE_FLOAT32_C(  -975.39), SIMDE_FLOAT32_C(   433.59), SIMDE_FLOAT32_C(  -572.01),
+        SIMDE_FLOAT32_C(   429.42), SIMDE_FLOAT32_C(  -382.73), SIMDE_FLOAT32_C(   -64.08), SIMDE_FLOAT32_C(  -628.98),
+        SIMDE_FLOAT32_C(   917.40), SIMDE_FLOAT32_C(  -890.19), SIMDE_FLOAT32_C(  -936.43), SIMDE_FLOAT32_C(   663.21) },
+      { SIMDE_FLOAT32_C(  -393.66), SIMDE_FLOAT32_C(  -474.29), SIMDE_FLOAT32_C(  -594.61), SIMDE_FLOAT32_C(  -816.49),
+        SIMDE_FLOAT32_C(   899.91), SIMDE_FLOAT32_C(    42.88), SIMDE_FLOAT32_C(   -73.60), SIMDE_FLOAT32_C(  -463.46),
+        SIMDE_FLOAT32_C(   467.65), SIMDE_FLOAT32_C(   771.27), SIMDE_FLOAT32_C(   978.81), SIMDE_FLOAT32_C(  -975.39),
+        SIMDE_FLOAT32_C(  -129.68), SIMDE_FLOAT32_C(  -939.51), SIMDE_FLOAT32_C(   433.59), SIMDE_FLOAT32_C(   848.59) } },
+    { { SIMDE_FLOAT32_C(  -787.79), SIMDE_FLOAT32_C(   645.20), SIMDE_FLOAT32_C(   436.15), SIMDE_FLOAT32_C(   646.02),
+        SIMDE_FLOAT32_C(   -49.13), SIMDE_FLOAT32_C(   297.13), SIMDE_FLOAT32_C(  -634.49), SIMDE_FLOAT32_C(  -625.79),
+        SIMDE_FLOAT32_C(  -839.94), SIMDE_FLOAT32_C(  -893.99), SIMDE_FLOAT32_C(   867.65), SIMDE_FLOAT32_C(  -668.84),
+        SIMDE_FLOAT32_C(   836.90), SIMDE_FLOAT32_C(   301.75), SIMDE_FLOAT32_C(  -461.01), SIMDE_FLOAT32_C(   313.93) },
+      UINT16_C(    0),
+      { SIMDE_FLOAT32_C(   855.18), SIMDE_FLOAT32_C(   138.53), SIMDE_FLOAT32_C(  -538.03), SIMDE_FLOAT32_C(   117.62),
+        SIMDE_FLOAT32_C(  -196.40), SIMDE_FLOAT32_C(   -48.57), SIMDE_FLOAT32_C(   879.05), SIMDE_FLOAT32_C(   479.63),
+        SIMDE_FLOAT32_C(   697.96), SIMDE_FLOAT32_C(  -176.11), SIMDE_FLOAT32_C(  -229.17), SIMDE_FLOAT32_C(  -550.74),
+        SIMDE_FLOAT32_C(  -866.23), SIMDE_FLOAT32_C(  -269.57), SIMDE_FLOAT32_C(   698.53), SIMDE_FLOAT32_C(  -783.24) },
+      { SIMDE_FLOAT32_C(  -787.79), SIMDE_FLOAT32_C(   645.20), SIMDE_FLOAT32_C(   436.15), SIMDE_FLOAT32_C(   646.02),
+        SIMDE_FLOAT32_C(   -49.13), SIMDE_FLOAT32_C(   297.13), SIMDE_FLOAT32_C(  -634.49), SIMDE_FLOAT32_C(  -625.79),
+        SIMDE_FLOAT32_C(  -839.94), SIMDE_FLOAT32_C(  -893.99), SIMDE_FLOAT32_C(   867.65), SIMDE_FLOAT32_C(  -668.84),
+        SIMDE_FLOAT32_C(   836.90), SIMDE_FLOAT32_C(   301.75), SIMDE_FLOAT32_C(  -461.01), SIMDE_FLOAT32_C(   313.93) } },
+    { { SIMDE_FLOAT32_C(   444.17), SIMDE_FLOAT32_C(  -474.82), SIMDE_FLOAT32_C(  -842.82), SIMDE_FLOAT32_C(   396.84),
+        SIMDE_FLOAT32_C(  -680.67), SIMDE_FLOAT32_C(  -239.58), SIMDE_FLOAT32_C(   831.86), SIMDE_FLOAT32_C(  -359.47),
+        SIMDE_FLOAT32_C(  -303.07), SIMDE_FLOAT32_C(   599.34), SIMDE_FLOAT32_C(   683.49), SIMDE_FLOAT32_C(   505.61),
+        SIMDE_FLOAT32_C(   905.52), SIMDE_FLOAT32_C(  -941.36), SIMDE_FLOAT32_C(   700.53), SIMDE_FLOAT32_C(   218.85) },
+      UINT16_C( 7957),
+      { SIMDE_FLOAT32_C(  -912.90), SIMDE_FLOAT32_C(  -624.51), SIMDE_FLOAT32_C(   575.26), SIMDE_FLOAT32_C(  -463.51),
+        SIMDE_FLOAT32_C(   662.09), SIMDE_FLOAT32_C(  -488.96), SIMDE_FLOAT32_C(   999.86), SIMDE_FLOAT32_C(   796.41),
+        SIMDE_FLOAT32_C(  -513.85), SIMDE_FLOAT32_C(   602.99), SIMDE_FLOAT32_C(   588.94), SIMDE_FLOAT32_C(   568.59),
+        SIMDE_FLOAT32_C(  -443.71), SIMDE_FLOAT32_C(   965.22), SIMDE_FLOAT32_C(  -129.26), SIMDE_FLOAT32_C(   330.83) },
+      { SIMDE_FLOAT32_C(  -912.90), SIMDE_FLOAT32_C(  -474.82), SIMDE_FLOAT32_C(  -624.51), SIMDE_FLOAT32_C(   396.84),
+        SIMDE_FLOAT32_C(   575.26), SIMDE_FLOAT32_C(  -239.58), SIMDE_FLOAT32_C(   831.86), SIMDE_FLOAT32_C(  -359.47),
+        SIMDE_FLOAT32_C(  -463.51), SIMDE_FLOAT32_C(   662.09), SIMDE_FLOAT32_C(  -488.96), SIMDE_FLOAT32_C(   999.86),
+        SIMDE_FLOAT32_C(   796.41), SIMDE_FLOAT32_C(  -941.36), SIMDE_FLOAT32_C(   700.53), SIMDE_FLOAT32_C(   218.85) } },
+    { { SIMDE_FLOAT32_C(   508.91), SIMDE_FLOAT32_C(  -823.32), SIMDE_FLOAT32_C(  -783.81), SIMDE_FLOAT32_C(    52.56),
+        SIMDE_FLOAT32_C(   113.36), SIMDE_FLOAT32_C(   879.31), SIMDE_FLOAT32_C(  -467.03), SIMDE_FLOAT32_C(   -37.38),
+        SIMDE_FLOAT32_C(  -320.94), SIMDE_FLOAT32_C(   775.34), SIMDE_FLOAT32_C(  -597.15), SIMDE_FLOAT32_C(   922.42),
+        SIMDE_FLOAT32_C(  -364.14), SIMDE_FLOAT32_C(  -467.43), SIMDE_FLOAT32_C(  -838.47), SIMDE_FLOAT32_C(    63.17) },
+      UINT16_C(  804),
+      { SIMDE_FLOAT32_C(  -906.36), SIMDE_FLOAT32_C(   525.41), SIMDE_FLOAT32_C(  -168.94), SIMDE_FLOAT32_C(  -958.85),
+        SIMDE_FLOAT32_C(   825.83), SIMDE_FLOAT32_C(   440.24), SIMDE_FLOAT32_C(   207.83), SIMDE_FLOAT32_C(  -714.02),
+        SIMDE_FLOAT32_C(  -989.30), SIMDE_FLOAT32_C(  -823.29), SIMDE_FLOAT32_C(   276.56), SIMDE_FLOAT32_C(   925.01),
+        SIMDE_FLOAT32_C(   826.09), SIMDE_FLOAT32_C(  -275.80), SIMDE_FLOAT32_C(  -400.87), SIMDE_FLOAT32_C(  -998.70) },
+      { SIMDE_FLOAT32_C(   508.91), SIMDE_FLOAT32_C(  -823.32), SIMDE_FLOAT32_C(  -906.36), SIMDE_FLOAT32_C(    52.56),
+        SIMDE_FLOAT32_C(   113.36), SIMDE_FLOAT32_C(   525.41), SIMDE_FLOAT32_C(  -467.03), SIMDE_FLOAT32_C(   -37.38),
+        SIMDE_FLOAT32_C(  -168.94), SIMDE_FLOAT32_C(  -958.85), SIMDE_FLOAT32_C(  -597.15), SIMDE_FLOAT32_C(   922.42),
+        SIMDE_FLOAT32_C(  -364.14), SIMDE_FLOAT32_C(  -467.43), SIMDE_FLOAT32_C(  -838.47), SIMDE_FLOAT32_C(    63.17) } },
+    { { SIMDE_FLOAT32_C(   211.78), SIMDE_FLOAT32_C(   124.53), SIMDE_FLOAT32_C(   -77.23), SIMDE_FLOAT32_C(   978.59),
+        SIMDE_FLOAT32_C(  -557.85), SIMDE_FLOAT32_C(  -945.32), SIMDE_FLOAT32_C(   251.59), SIMDE_FLOAT32_C(  -865.04),
+        SIMDE_FLOAT32_C(   809.24), SIMDE_FLOAT32_C(   480.01), SIMDE_FLOAT32_C(   448.18), SIMDE_FLOAT32_C(  -757.19),
+        SIMDE_FLOAT32_C(  -852.12), SIMDE_FLOAT32_C(   258.38), SIMDE_FLOAT32_C(   653.03), SIMDE_FLOAT32_C(   725.56) },
+      UINT16_C(24315),
+      { SIMDE_FLOAT32_C(  -266.79), SIMDE_FLOAT32_C(  -716.90), SIMDE_FLOAT32_C(  -603.55), SIMDE_FLOAT32_C(  -406.79),
+        SIMDE_FLOAT32_C(  -605.46), SIMDE_FLOAT32_C(   469.07), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(  -624.61),
+        SIMDE_FLOAT32_C(  -300.30), SIMDE_FLOAT32_C(   -20.41), SIMDE_FLOAT32_C(   482.55), SIMDE_FLOAT32_C(  -490.68),
+        SIMDE_FLOAT32_C(  -832.22), SIMDE_FLOAT32_C(   831.15), SIMDE_FLOAT32_C(  -404.34), SIMDE_FLOAT32_C(   959.65) },
+      { SIMDE_FLOAT32_C(  -266.79), SIMDE_FLOAT32_C(  -716.90), SIMDE_FLOAT32_C(   -77.23), SIMDE_FLOAT32_C(  -603.55),
+        SIMDE_FLOAT32_C(  -406.79), SIMDE_FLOAT32_C(  -605.46), SIMDE_FLOAT32_C(   469.07), SIMDE_FLOAT32_C(    22.00),
+        SIMDE_FLOAT32_C(   809.24), SIMDE_FLOAT32_C(  -624.61), SIMDE_FLOAT32_C(  -300.30), SIMDE_FLOAT32_C(   -20.41),
+        SIMDE_FLOAT32_C(   482.55), SIMDE_FLOAT32_C(   258.38), SIMDE_FLOAT32_C(  -490.68), SIMDE_FLOAT32_C(   725.56) } },
+    { { SIMDE_FLOAT32_C(  -596.99), SIMDE_FLOAT32_C(   388.65), SIMDE_FLOAT32_C(   851.53), SIMDE_FLOAT32_C(   646.42),
+        SIMDE_FLOAT32_C(  -661.72), SIMDE_FLOAT32_C(   558.84), SIMDE_FLOAT32_C(  -471.74), SIMDE_FLOAT32_C(    87.04),
+        SIMDE_FLOAT32_C(   550.31), SIMDE_FLOAT32_C(  -211.65), SIMDE_FLOAT32_C(    22.02), SIMDE_FLOAT32_C(  -283.47),
+        SIMDE_FLOAT32_C(  -776.65), SIMDE_FLOAT32_C(   841.86), SIMDE_FLOAT32_C(   199.20), SIMDE_FLOAT32_C(  -557.24) },
+      UINT16_C( 2595),
+      { SIMDE_FLOAT32_C(  -432.79), SIMDE_FLOAT32_C(  -847.96), SIMDE_FLOAT32_C(  -480.82), SIMDE_FLOAT32_C(   317.66),
+        SIMDE_FLOAT32_C(  -407.54), SIMDE_FLOAT32_C(  -214.86), SIMDE_FLOAT32_C(  -177.67), SIMDE_FLOAT32_C(   691.86),
+        SIMDE_FLOAT32_C(   650.62), SIMDE_FLOAT32_C(   -31.35), SIMDE_FLOAT32_C(    74.58), SIMDE_FLOAT32_C(  -676.92),
+        SIMDE_FLOAT32_C(  -529.01), SIMDE_FLOAT32_C(   387.38), SIMDE_FLOAT32_C(  -116.12), SIMDE_FLOAT32_C(  -622.68) },
+      { SIMDE_FLOAT32_C(  -432.79), SIMDE_FLOAT32_C(  -847.96), SIMDE_FLOAT32_C(   851.53), SIMDE_FLOAT32_C(   646.42),
+        SIMDE_FLOAT32_C(  -661.72), SIMDE_FLOAT32_C(  -480.82), SIMDE_FLOAT32_C(  -471.74), SIMDE_FLOAT32_C(    87.04),
+        SIMDE_FLOAT32_C(   550.31), SIMDE_FLOAT32_C(   317.66), SIMDE_FLOAT32_C(    22.02), SIMDE_FLOAT32_C(  -407.54),
+        SIMDE_FLOAT32_C(  -776.65), SIMDE_FLOAT32_C(   841.86), SIMDE_FLOAT32_C(   199.20), SIMDE_FLOAT32_C(  -557.24) } },
+    { { SIMDE_FLOAT32_C(   156.14), SIMDE_FLOAT32_C(  -909.63), SIMDE_FLOAT32_C(   923.36), SIMDE_FLOAT32_C(   278.81),
+        SIMDE_FLOAT32_C(  -749.78), SIMDE_FLOAT32_C(   310.72), SIMDE_FLOAT32_C(   156.73), SIMDE_FLOAT32_C(    -3.05),
+        SIMDE_FLOAT32_C(   262.03), SIMDE_FLOAT32_C(   501.71), SIMDE_FLOAT32_C(   418.82), SIMDE_FLOAT32_C(  -935.05),
+        SIMDE_FLOAT32_C(  -675.30), SIMDE_FLOAT32_C(  -393.52), SIMDE_FLOAT32_C(  -893.05), SIMDE_FLOAT32_C(   752.48) },
+      UINT16_C(14301),
+      { SIMDE_FLOAT32_C(  -126.61), SIMDE_FLOAT32_C(  -700.88), SIMDE_FLOAT32_C(   -23.70), SIMDE_FLOAT32_C(   201.50),
+        SIMDE_FLOAT32_C(  -545.09), SIMDE_FLOAT32_C(   541.57), SIMDE_FLOAT32_C(   697.14), SIMDE_FLOAT32_C(  -518.64),
+        SIMDE_FLOAT32_C(  -420.94), SIMDE_FLOAT32_C(  -484.75), SIMDE_FLOAT32_C(   712.28), SIMDE_FLOAT32_C(   292.78),
+        SIMDE_FLOAT32_C(   452.49), SIMDE_FLOAT32_C(   749.80), SIMDE_FLOAT32_C(  -237.24), SIMDE_FLOAT32_C(   205.19) },
+      { SIMDE_FLOAT32_C(  -126.61), SIMDE_FLOAT32_C(  -909.63), SIMDE_FLOAT32_C(  -700.88), SIMDE_FLOAT32_C(   -23.70),
+        SIMDE_FLOAT32_C(   201.50), SIMDE_FLOAT32_C(   310.72), SIMDE_FLOAT32_C(  -545.09), SIMDE_FLOAT32_C(   541.57),
+        SIMDE_FLOAT32_C(   697.14), SIMDE_FLOAT32_C(  -518.64), SIMDE_FLOAT32_C(  -420.94), SIMDE_FLOAT32_C(  -935.05),
+        SIMDE_FLOAT32_C(  -484.75), SIMDE_FLOAT32_C(   712.28), SIMDE_FLOAT32_C(  -893.05), SIMDE_FLOAT32_C(   752.48) } },
+    { { SIMDE_FLOAT32_C(   765.00), SIMDE_FLOAT32_C(  -683.08), SIMDE_FLOAT32_C(  -835.64), SIMDE_FLOAT32_C(  -181.37),
+        SIMDE_FLOAT32_C(  -365.78), SIMDE_FLOAT32_C(   983.70), SIMDE_FLOAT32_C(  -944.49), SIMDE_FLOAT32_C(  -774.70),
+        SIMDE_FLOAT32_C(  -501.94), SIMDE_FLOAT32_C(  -660.10), SIMDE_FLOAT32_C(   135.87), SIMDE_FLOAT32_C(  -232.03),
+        SIMDE_FLOAT32_C(   -75.76), SIMDE_FLOAT32_C(  -533.90), SIMDE_FLOAT32_C(   515.57), SIMDE_FLOAT32_C(   382.45) },
+      UINT16_C(65463),
+      { SIMDE_FLOAT32_C(  -894.71), SIMDE_FLOAT32_C(   340.67), SIMDE_FLOAT32_C(   179.39), SIMDE_FLOAT32_C(  -407.27),
+        SIMDE_FLOAT32_C(  -108.40), SIMDE_FLOAT32_C(  -502.81), SIMDE_FLOAT32_C(  -366.20), SIMDE_FLOAT32_C(  -128.82),
+        SIMDE_FLOAT32_C(   182.53), SIMDE_FLOAT32_C(  -497.51), SIMDE_FLOAT32_C(  -825.52), SIMDE_FLOAT32_C(   -63.61),
+        SIMDE_FLOAT32_C(   955.89), SIMDE_FLOAT32_C(   261.74), SIMDE_FLOAT32_C(   283.55), SIMDE_FLOAT32_C(   223.12) },
+      { SIMDE_FLOAT32_C(  -894.71), SIMDE_FLOAT32_C(   340.67), SIMDE_FLOAT32_C(   179.39), SIMDE_FLOAT32_C(  -181.37),
+        SIMDE_FLOAT32_C(  -407.27), SIMDE_FLOAT32_C(  -108.40), SIMDE_FLOAT32_C(  -944.49), SIMDE_FLOAT32_C(  -502.81),
+        SIMDE_FLOAT32_C(  -366.20), SIMDE_FLOAT32_C(  -128.82), SIMDE_FLOAT32_C(   182.53), SIMDE_FLOAT32_C(  -497.51),
+        SIMDE_FLOAT32_C(  -825.52), SIMDE_FLOAT32_C(   -63.61), SIMDE_FLOAT32_C(   955.89), SIMDE_FLOAT32_C(   261.74) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_expand_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(29283),
+      { SIMDE_FLOAT32_C(   -23.42), SIMDE_FLOAT32_C(   137.11), SIMDE_FLOAT32_C(   956.04), SIMDE_FLOAT32_C(  -286.17),
+        SIMDE_FLOAT32_C(  -117.52), SIMDE_FLOAT32_C(  -232.22), SIMDE_FLOAT32_C(  -136.11), SIMDE_FLOAT32_C(  -681.54),
+        SIMDE_FLOAT32_C(  -272.27), SIMDE_FLOAT32_C(  -823.15), SIMDE_FLOAT32_C(  -962.53), SIMDE_FLOAT32_C(  -136.97),
+        SIMDE_FLOAT32_C(    70.37), SIMDE_FLOAT32_C(  -818.32), SIMDE_FLOAT32_C(   176.32), SIMDE_FLOAT32_C(  -552.03) },
+      { SIMDE_FLOAT32_C(   -23.42), SIMDE_FLOAT32_C(   137.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   956.04), SIMDE_FLOAT32_C(  -286.17), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -117.52), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -232.22), SIMDE_FLOAT32_C(  -136.11), SIMDE_FLOAT32_C(  -681.54), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(39587),
+      { SIMDE_FLOAT32_C(   297.69), SIMDE_FLOAT32_C(  -472.77), SIMDE_FLOAT32_C(  -932.13), SIMDE_FLOAT32_C(    34.35),
+        SIMDE_FLOAT32_C(  -107.44), SIMDE_FLOAT32_C(  -910.47), SIMDE_FLOAT32_C(  -222.22), SIMDE_FLOAT32_C(  -865.67),
+        SIMDE_FLOAT32_C(   -63.44), SIMDE_FLOAT32_C(  -277.10), SIMDE_FLOAT32_C(    -6.66), SIMDE_FLOAT32_C(  -185.56),
+        SIMDE_FLOAT32_C(   -80.75), SIMDE_FLOAT32_C(  -431.46), SIMDE_FLOAT32_C(   -16.48), SIMDE_FLOAT32_C(   903.95) },
+      { SIMDE_FLOAT32_C(   297.69), SIMDE_FLOAT32_C(  -472.77), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -932.13), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    34.35),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -107.44), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -910.47),
+        SIMDE_FLOAT32_C(  -222.22), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -865.67) } },
+    { UINT16_C( 9344),
+      { SIMDE_FLOAT32_C(  -395.15), SIMDE_FLOAT32_C(   -87.08), SIMDE_FLOAT32_C(   460.38), SIMDE_FLOAT32_C(   842.02),
+        SIMDE_FLOAT32_C(  -790.94), SIMDE_FLOAT32_C(   212.54), SIMDE_FLOAT32_C(  -946.60), SIMDE_FLOAT32_C(   621.13),
+        SIMDE_FLOAT32_C(   -28.18), SIMDE_FLOAT32_C(   979.28), SIMDE_FLOAT32_C(   193.63), SIMDE_FLOAT32_C(  -423.67),
+        SIMDE_FLOAT32_C(  -726.30), SIMDE_FLOAT32_C(  -881.86), SIMDE_FLOAT32_C(   997.50), SIMDE_FLOAT32_C(  -941.14) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -395.15),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -87.08), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   460.38), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(26941),
+      { SIMDE_FLOAT32_C(  -433.56), SIMDE_FLOAT32_C(   -97.66), SIMDE_FLOAT32_C(  -474.91), SIMDE_FLOAT32_C(  -297.91),
+        SIMDE_FLOAT32_C(  -466.84), SIMDE_FLOAT32_C(  -396.45), SIMDE_FLOAT32_C(   726.98), SIMDE_FLOAT32_C(   168.65),
+        SIMDE_FLOAT32_C(   -91.47), SIMDE_FLOAT32_C(  -118.09), SIMDE_FLOAT32_C(  -588.33), SIMDE_FLOAT32_C(  -235.73),
+        SIMDE_FLOAT32_C(   605.23), SIMDE_FLOAT32_C(  -817.09), SIMDE_FLOAT32_C(   246.54), SIMDE_FLOAT32_C(   431.38) },
+      { SIMDE_FLOAT32_C(  -433.56), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -97.66), SIMDE_FLOAT32_C(  -474.91),
+        SIMDE_FLOAT32_C(  -297.91), SIMDE_FLOAT32_C(  -466.84), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -396.45), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   726.98),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   168.65), SIMDE_FLOAT32_C(   -91.47), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(49055),
+      { SIMDE_FLOAT32_C(   239.88), SIMDE_FLOAT32_C(  -875.67), SIMDE_FLOAT32_C(   113.38), SIMDE_FLOAT32_C(   -71.80),
+        SIMDE_FLOAT32_C(   804.66), SIMDE_FLOAT32_C(   976.40), SIMDE_FLOAT32_C(   518.81), SIMDE_FLOAT32_C(  -205.73),
+        SIMDE_FLOAT32_C(  -601.73), SIMDE_FLOAT32_C(  -485.27), SIMDE_FLOAT32_C(   281.75), SIMDE_FLOAT32_C(  -803.57),
+        SIMDE_FLOAT32_C(  -857.17), SIMDE_FLOAT32_C(  -629.47), SIMDE_FLOAT32_C(  -267.16), SIMDE_FLOAT32_C(   920.74) },
+      { SIMDE_FLOAT32_C(   239.88), SIMDE_FLOAT32_C(  -875.67), SIMDE_FLOAT32_C(   113.38), SIMDE_FLOAT32_C(   -71.80),
+        SIMDE_FLOAT32_C(   804.66), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   976.40),
+        SIMDE_FLOAT32_C(   518.81), SIMDE_FLOAT32_C(  -205.73), SIMDE_FLOAT32_C(  -601.73), SIMDE_FLOAT32_C(  -485.27),
+        SIMDE_FLOAT32_C(   281.75), SIMDE_FLOAT32_C(  -803.57), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -857.17) } },
+    { UINT16_C(64727),
+      { SIMDE_FLOAT32_C(   256.80), SIMDE_FLOAT32_C(  -152.28), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(   501.21),
+        SIMDE_FLOAT32_C(   857.80), SIMDE_FLOAT32_C(  -234.68), SIMDE_FLOAT32_C(   306.59), SIMDE_FLOAT32_C(  -453.01),
+        SIMDE_FLOAT32_C(   960.89), SIMDE_FLOAT32_C(   172.20), SIMDE_FLOAT32_C(  -751.56), SIMDE_FLOAT32_C(   -70.53),
+        SIMDE_FLOAT32_C(    32.74), SIMDE_FLOAT32_C(   167.11), SIMDE_FLOAT32_C(  -136.09), SIMDE_FLOAT32_C(  -119.49) },
+      { SIMDE_FLOAT32_C(   256.80), SIMDE_FLOAT32_C(  -152.28), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   501.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   857.80), SIMDE_FLOAT32_C(  -234.68),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   306.59), SIMDE_FLOAT32_C(  -453.01),
+        SIMDE_FLOAT32_C(   960.89), SIMDE_FLOAT32_C(   172.20), SIMDE_FLOAT32_C(  -751.56), SIMDE_FLOAT32_C(   -70.53) } },
+    { UINT16_C(50560),
+      { SIMDE_FLOAT32_C(  -970.92), SIMDE_FLOAT32_C(   -75.59), SIMDE_FLOAT32_C(   468.51), SIMDE_FLOAT32_C(   589.28),
+        SIMDE_FLOAT32_C(   256.97), SIMDE_FLOAT32_C(   733.43), SIMDE_FLOAT32_C(   -34.40), SIMDE_FLOAT32_C(  -947.13),
+        SIMDE_FLOAT32_C(  -796.84), SIMDE_FLOAT32_C(  -684.32), SIMDE_FLOAT32_C(   640.36), SIMDE_FLOAT32_C(  -884.28),
+        SIMDE_FLOAT32_C(    22.08), SIMDE_FLOAT32_C(  -196.24), SIMDE_FLOAT32_C(   866.87), SIMDE_FLOAT32_C(    17.59) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -970.92),
+        SIMDE_FLOAT32_C(   -75.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   468.51), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   589.28), SIMDE_FLOAT32_C(   256.97) } },
+    { UINT16_C( 1257),
+      { SIMDE_FLOAT32_C(   648.89), SIMDE_FLOAT32_C(  -234.21), SIMDE_FLOAT32_C(   453.23), SIMDE_FLOAT32_C(   845.57),
+        SIMDE_FLOAT32_C(  -980.17), SIMDE_FLOAT32_C(  -987.80), SIMDE_FLOAT32_C(  -168.68), SIMDE_FLOAT32_C(   640.82),
+        SIMDE_FLOAT32_C(    75.27), SIMDE_FLOAT32_C(   999.37), SIMDE_FLOAT32_C(  -658.08), SIMDE_FLOAT32_C(   822.52),
+        SIMDE_FLOAT32_C(  -522.18), SIMDE_FLOAT32_C(   185.34), SIMDE_FLOAT32_C(  -764.42), SIMDE_FLOAT32_C(  -379.83) },
+      { SIMDE_FLOAT32_C(   648.89), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -234.21),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   453.23), SIMDE_FLOAT32_C(   845.57), SIMDE_FLOAT32_C(  -980.17),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -987.80), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_expand_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expandloadu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   824.00), SIMDE_FLOAT32_C(   748.83), SIMDE_FLOAT32_C(  -205.01), SIMDE_FLOAT32_C(  -318.68),
+        SIMDE_FLOAT32_C(  -666.35), SIMDE_FLOAT32_C(   573.64), SIMDE_FLOAT32_C(   924.82), SIMDE_FLOAT32_C(  -846.78),
+        SIMDE_FLOAT32_C(   202.96), SIMDE_FLOAT32_C(   780.68), SIMDE_FLOAT32_C(  -914.96), SIMDE_FLOAT32_C(  -198.78),
+        SIMDE_FLOAT32_C(  -187.29), SIMDE_FLOAT32_C(  -278.08), SIMDE_FLOAT32_C(  -258.37), SIMDE_FLOAT32_C(   -52.61) },
+      UINT16_C(50431),
+      { SIMDE_FLOAT32_C(  -150.32), SIMDE_FLOAT32_C(   831.97), SIMDE_FLOAT32_C(   223.04), SIMDE_FLOAT32_C(   569.74),
+        SIMDE_FLOAT32_C(  -357.28), SIMDE_FLOAT32_C(   106.41), SIMDE_FLOAT32_C(   292.76), SIMDE_FLOAT32_C(  -532.38),
+        SIMDE_FLOAT32_C(  -803.30), SIMDE_FLOAT32_C(   679.01), SIMDE_FLOAT32_C(  -363.62), SIMDE_FLOAT32_C(  -404.20),
+        SIMDE_FLOAT32_C(  -809.70), SIMDE_FLOAT32_C(  -892.59), SIMDE_FLOAT32_C(   251.80), SIMDE_FLOAT32_C(  -146.17) },
+      { SIMDE_FLOAT32_C(  -150.32), SIMDE_FLOAT32_C(   831.97), SIMDE_FLOAT32_C(   223.04), SIMDE_FLOAT32_C(   569.74),
+        SIMDE_FLOAT32_C(  -357.28), SIMDE_FLOAT32_C(   106.41), SIMDE_FLOAT32_C(   292.76), SIMDE_FLOAT32_C(  -532.38),
+        SIMDE_FLOAT32_C(   202.96), SIMDE_FLOAT32_C(   780.68), SIMDE_FLOAT32_C(  -803.30), SIMDE_FLOAT32_C(  -198.78),
+        SIMDE_FLOAT32_C(  -187.29), SIMDE_FLOAT32_C(  -278.08), SIMDE_FLOAT32_C(   679.01), SIMDE_FLOAT32_C(  -363.62) } },
+    { { SIMDE_FLOAT32_C(    55.27), SIMDE_FLOAT32_C(  -649.09), SIMDE_FLOAT32_C(  -325.04), SIMDE_FLOAT32_C(   812.91),
+        SIMDE_FLOAT32_C(  -387.10), SIMDE_FLOAT32_C(   293.12), SIMDE_FLOAT32_C(  -326.32), SIMDE_FLOAT32_C(   551.97),
+        SIMDE_FLOAT32_C(   624.54), SIMDE_FLOAT32_C(   466.09), SIMDE_FLOAT32_C(   132.63), SIMDE_FLOAT32_C(  -988.03),
+        SIMDE_FLOAT32_C(  -779.96), SIMDE_FLOAT32_C(   144.34), SIMDE_FLOAT32_C(   170.58), SIMDE_FLOAT32_C(  -273.97) },
+      UINT16_C(65455),
+      { SIMDE_FLOAT32_C(  -190.92), SIMDE_FLOAT32_C(  -283.08), SIMDE_FLOAT32_C(   139.76), SIMDE_FLOAT32_C(  -397.85),
+        SIMDE_FLOAT32_C(   943.25), SIMDE_FLOAT32_C(  -391.35), SIMDE_FLOAT32_C(   433.67), SIMDE_FLOAT32_C(  -944.89),
+        SIMDE_FLOAT32_C(   419.19), SIMDE_FLOAT32_C(  -541.25), SIMDE_FLOAT32_C(  -780.73), SIMDE_FLOAT32_C(  -913.18),
+        SIMDE_FLOAT32_C(   565.71), SIMDE_FLOAT32_C(   438.60), SIMDE_FLOAT32_C(   597.79), SIMDE_FLOAT32_C(  -344.82) },
+      { SIMDE_FLOAT32_C(  -190.92), SIMDE_FLOAT32_C(  -283.08), SIMDE_FLOAT32_C(   139.76), SIMDE_FLOAT32_C(  -397.85),
+        SIMDE_FLOAT32_C(  -387.10), SIMDE_FLOAT32_C(   943.25), SIMDE_FLOAT32_C(  -326.32), SIMDE_FLOAT32_C(  -391.35),
+        SIMDE_FLOAT32_C(   433.67), SIMDE_FLOAT32_C(  -944.89), SIMDE_FLOAT32_C(   419.19), SIMDE_FLOAT32_C(  -541.25),
+        SIMDE_FLOAT32_C(  -780.73), SIMDE_FLOAT32_C(  -913.18), SIMDE_FLOAT32_C(   565.71), SIMDE_FLOAT32_C(   438.60) } },
+    { { SIMDE_FLOAT32_C(  -346.32), SIMDE_FLOAT32_C(   229.93), SIMDE_FLOAT32_C(     8.22), SIMDE_FLOAT32_C(  -808.66),
+        SIMDE_FLOAT32_C(  -370.96), SIMDE_FLOAT32_C(  -879.68), SIMDE_FLOAT32_C(   303.44), SIMDE_FLOAT32_C(  -741.34),
+        SIMDE_FLOAT32_C(   426.99), SIMDE_FLOAT32_C(   136.18), SIMDE_FLOAT32_C(   844.24), SIMDE_FLOAT32_C(   240.15),
+        SIMDE_FLOAT32_C(    79.10), SIMDE_FLOAT32_C(  -396.98), SIMDE_FLOAT32_C(   -48.80), SIMDE_FLOAT32_C(   945.79) },
+      UINT16_C(10319),
+      { SIMDE_FLOAT32_C(   380.02), SIMDE_FLOAT32_C(   920.55), SIMDE_FLOAT32_C(   -69.88), SIMDE_FLOAT32_C(  -253.57),
+        SIMDE_FLOAT32_C(   575.94), SIMDE_FLOAT32_C(   -58.99), SIMDE_FLOAT32_C(   349.62), SIMDE_FLOAT32_C(   469.73),
+        SIMDE_FLOAT32_C(    -6.04), SIMDE_FLOAT32_C(   643.80), SIMDE_FLOAT32_C(   774.30), SIMDE_FLOAT32_C(  -425.84),
+        SIMDE_FLOAT32_C(  -897.40), SIMDE_FLOAT32_C(  -456.12), SIMDE_FLOAT32_C(   574.56), SIMDE_FLOAT32_C(  -791.64) },
+      { SIMDE_FLOAT32_C(   380.02), SIMDE_FLOAT32_C(   920.55), SIMDE_FLOAT32_C(   -69.88), SIMDE_FLOAT32_C(  -253.57),
+        SIMDE_FLOAT32_C(  -370.96), SIMDE_FLOAT32_C(  -879.68), SIMDE_FLOAT32_C(   575.94), SIMDE_FLOAT32_C(  -741.34),
+        SIMDE_FLOAT32_C(   426.99), SIMDE_FLOAT32_C(   136.18), SIMDE_FLOAT32_C(   844.24), SIMDE_FLOAT32_C(   -58.99),
+        SIMDE_FLOAT32_C(    79.10), SIMDE_FLOAT32_C(   349.62), SIMDE_FLOAT32_C(   -48.80), SIMDE_FLOAT32_C(   945.79) } },
+    { { SIMDE_FLOAT32_C(   944.23), SIMDE_FLOAT32_C(  -447.64), SIMDE_FLOAT32_C(   706.38), SIMDE_FLOAT32_C(    20.34),
+        SIMDE_FLOAT32_C(  -506.97), SIMDE_FLOAT32_C(  -769.65), SIMDE_FLOAT32_C(   213.56), SIMDE_FLOAT32_C(  -588.54),
+        SIMDE_FLOAT32_C(  -681.77), SIMDE_FLOAT32_C(   382.16), SIMDE_FLOAT32_C(   930.24), SIMDE_FLOAT32_C(  -312.11),
+        SIMDE_FLOAT32_C(   -24.98), SIMDE_FLOAT32_C(    85.11), SIMDE_FLOAT32_C(  -287.91), SIMDE_FLOAT32_C(  -931.85) },
+      UINT16_C(58924),
+      { SIMDE_FLOAT32_C(   259.00), SIMDE_FLOAT32_C(   385.95), SIMDE_FLOAT32_C(   412.76), SIMDE_FLOAT32_C(  -740.78),
+        SIMDE_FLOAT32_C(   657.53), SIMDE_FLOAT32_C(   687.01), SIMDE_FLOAT32_C(  -245.10), SIMDE_FLOAT32_C(   921.28),
+        SIMDE_FLOAT32_C(  -611.12), SIMDE_FLOAT32_C(  -291.50), SIMDE_FLOAT32_C(  -974.39), SIMDE_FLOAT32_C(   634.62),
+        SIMDE_FLOAT32_C(   972.52), SIMDE_FLOAT32_C(   129.89), SIMDE_FLOAT32_C(   740.32), SIMDE_FLOAT32_C(    52.44) },
+      { SIMDE_FLOAT32_C(   944.23), SIMDE_FLOAT32_C(  -447.64), SIMDE_FLOAT32_C(   259.00), SIMDE_FLOAT32_C(   385.95),
+        SIMDE_FLOAT32_C(  -506.97), SIMDE_FLOAT32_C(   412.76), SIMDE_FLOAT32_C(   213.56), SIMDE_FLOAT32_C(  -588.54),
+        SIMDE_FLOAT32_C(  -681.77), SIMDE_FLOAT32_C(  -740.78), SIMDE_FLOAT32_C(   657.53), SIMDE_FLOAT32_C(  -312.11),
+        SIMDE_FLOAT32_C(   -24.98), SIMDE_FLOAT32_C(   687.01), SIMDE_FLOAT32_C(  -245.10), SIMDE_FLOAT32_C(   921.28) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 r = simde_mm512_mask_expandloadu_ps(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(46205),
+      { SIMDE_FLOAT32_C(   878.08), SIMDE_FLOAT32_C(   334.39), SIMDE_FLOAT32_C(  -837.89), SIMDE_FLOAT32_C(    71.19),
+        SIMDE_FLOAT32_C(  -527.54), SIMDE_FLOAT32_C(  -813.05), SIMDE_FLOAT32_C(   925.54), SIMDE_FLOAT32_C(   436.71),
+        SIMDE_FLOAT32_C(    79.43), SIMDE_FLOAT32_C(   382.65), SIMDE_FLOAT32_C(   -82.26), SIMDE_FLOAT32_C(   950.73),
+        SIMDE_FLOAT32_C(  -865.24), SIMDE_FLOAT32_C(  -201.23), SIMDE_FLOAT32_C(  -294.43), SIMDE_FLOAT32_C(  -704.00) },
+      { SIMDE_FLOAT32_C(   878.08), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   334.39), SIMDE_FLOAT32_C(  -837.89),
+        SIMDE_FLOAT32_C(    71.19), SIMDE_FLOAT32_C(  -527.54), SIMDE_FLOAT32_C(  -813.05), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   925.54), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   436.71), SIMDE_FLOAT32_C(    79.43), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   382.65) } },
+    { UINT16_C(41736),
+      { SIMDE_FLOAT32_C(   735.28), SIMDE_FLOAT32_C(   891.52), SIMDE_FLOAT32_C(  -952.57), SIMDE_FLOAT32_C(  -139.96),
+        SIMDE_FLOAT32_C(   243.45), SIMDE_FLOAT32_C(   926.81), SIMDE_FLOAT32_C(    20.46), SIMDE_FLOAT32_C(  -680.17),
+        SIMDE_FLOAT32_C(   212.24), SIMDE_FLOAT32_C(   637.90), SIMDE_FLOAT32_C(  -412.69), SIMDE_FLOAT32_C(   171.75),
+        SIMDE_FLOAT32_C(   277.65), SIMDE_FLOAT32_C(   -61.43), SIMDE_FLOAT32_C(   310.48), SIMDE_FLOAT32_C(  -949.81) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   735.28),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   891.52), SIMDE_FLOAT32_C(  -952.57), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -139.96), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   243.45) } },
+    { UINT16_C( 6641),
+      { SIMDE_FLOAT32_C(   -44.02), SIMDE_FLOAT32_C(   470.79), SIMDE_FLOAT32_C(  -810.08), SIMDE_FLOAT32_C(   -49.44),
+        SIMDE_FLOAT32_C(    32.93), SIMDE_FLOAT32_C(  -980.69), SIMDE_FLOAT32_C(   229.28), SIMDE_FLOAT32_C(  -383.31),
+        SIMDE_FLOAT32_C(    55.90), SIMDE_FLOAT32_C(   114.58), SIMDE_FLOAT32_C(  -363.45), SIMDE_FLOAT32_C(   979.65),
+        SIMDE_FLOAT32_C(   659.10), SIMDE_FLOAT32_C(   471.72), SIMDE_FLOAT32_C(  -616.29), SIMDE_FLOAT32_C(  -757.49) },
+      { SIMDE_FLOAT32_C(   -44.02), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   470.79), SIMDE_FLOAT32_C(  -810.08), SIMDE_FLOAT32_C(   -49.44), SIMDE_FLOAT32_C(    32.93),
+        SIMDE_FLOAT32_C(  -980.69), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   229.28),
+        SIMDE_FLOAT32_C(  -383.31), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(65530),
+      { SIMDE_FLOAT32_C(    56.65), SIMDE_FLOAT32_C(  -221.76), SIMDE_FLOAT32_C(  -111.90), SIMDE_FLOAT32_C(  -122.80),
+        SIMDE_FLOAT32_C(  -733.25), SIMDE_FLOAT32_C(  -836.89), SIMDE_FLOAT32_C(   543.21), SIMDE_FLOAT32_C(  -801.17),
+        SIMDE_FLOAT32_C(  -787.82), SIMDE_FLOAT32_C(  -491.12), SIMDE_FLOAT32_C(   172.57), SIMDE_FLOAT32_C(  -717.73),
+        SIMDE_FLOAT32_C(  -276.69), SIMDE_FLOAT32_C(  -780.41), SIMDE_FLOAT32_C(  -167.74), SIMDE_FLOAT32_C(  -132.32) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    56.65), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -221.76),
+        SIMDE_FLOAT32_C(  -111.90), SIMDE_FLOAT32_C(  -122.80), SIMDE_FLOAT32_C(  -733.25), SIMDE_FLOAT32_C(  -836.89),
+        SIMDE_FLOAT32_C(   543.21), SIMDE_FLOAT32_C(  -801.17), SIMDE_FLOAT32_C(  -787.82), SIMDE_FLOAT32_C(  -491.12),
+        SIMDE_FLOAT32_C(   172.57), SIMDE_FLOAT32_C(  -717.73), SIMDE_FLOAT32_C(  -276.69), SIMDE_FLOAT32_C(  -780.41) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 r = simde_mm512_maskz_expandloadu_ps(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -214.20), SIMDE_FLOAT64_C(   -32.30), SIMDE_FLOAT64_C(  -879.47), SIMDE_FLOAT64_C(  -417.08),
+        SIMDE_FLOAT64_C(   -96.99), SIMDE_FLOAT64_C(  -901.04), SIMDE_FLOAT64_C(  -752.55), SIMDE_FLOAT64_C(   389.42) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(  -840.97), SIMDE_FLOAT64_C(   924.59), SIMDE_FLOAT64_C(   365.76), SIMDE_FLOAT64_C(   289.26),
+        SIMDE_FLOAT64_C(   907.15), SIMDE_FLOAT64_C(   238.62), SIMDE_FLOAT64_C(   -33.74), SIMDE_FLOAT64_C(  -190.12) },
+      { SIMDE_FLOAT64_C(  -840.97), SIMDE_FLOAT64_C(   924.59), SIMDE_FLOAT64_C(   365.76), SIMDE_FLOAT64_C(   289.26),
+        SIMDE_FLOAT64_C(   907.15), SIMDE_FLOAT64_C(   238.62), SIMDE_FLOAT64_C(   -33.74), SIMDE_FLOAT64_C(  -190.12) } },
+    { { SIMDE_FLOAT64_C(  -650.88), SIMDE_FLOAT64_C(  -992.24), SIMDE_FLOAT64_C(   -56.53), SIMDE_FLOAT64_C(   107.30),
+        SIMDE_FLOAT64_C(   334.98), SIMDE_FLOAT64_C(   241.10), SIMDE_FLOAT64_C(   677.08), SIMDE_FLOAT64_C(   857.46) },
+      UINT8_C(132),
+      { SIMDE_FLOAT64_C(  -461.77), SIMDE_FLOAT64_C(  -816.37), SIMDE_FLOAT64_C(   364.95), SIMDE_FLOAT64_C(  -329.50),
+        SIMDE_FLOAT64_C(  -979.78), SIMDE_FLOAT64_C(  -693.59), SIMDE_FLOAT64_C(  -924.70), SIMDE_FLOAT64_C(  -373.28) },
+      { SIMDE_FLOAT64_C(  -650.88), SIMDE_FLOAT64_C(  -992.24), SIMDE_FLOAT64_C(  -461.77), SIMDE_FLOAT64_C(   107.30),
+        SIMDE_FLOAT64_C(   334.98), SIMDE_FLOAT64_C(   241.10), SIMDE_FLOAT64_C(   677.08), SIMDE_FLOAT64_C(  -816.37) } },
+    { { SIMDE_FLOAT64_C(  -381.76), SIMDE_FLOAT64_C(  -970.87), SIMDE_FLOAT64_C(  -685.20), SIMDE_FLOAT64_C(   381.73),
+        SIMDE_FLOAT64_C(  -936.84), SIMDE_FLOAT64_C(  -655.38), SIMDE_FLOAT64_C(   114.92), SIMDE_FLOAT64_C(  -413.42) },
+      UINT8_C(180),
+      { SIMDE_FLOAT64_C(  -588.50), SIMDE_FLOAT64_C(  -988.12), SIMDE_FLOAT64_C(    48.12), SIMDE_FLOAT64_C(   -17.73),
+        SIMDE_FLOAT64_C(  -864.22), SIMDE_FLOAT64_C(  -408.20), SIMDE_FLOAT64_C(   228.77), SIMDE_FLOAT64_C(  -339.34) },
+      { SIMDE_FLOAT64_C(  -381.76), SIMDE_FLOAT64_C(  -970.87), SIMDE_FLOAT64_C(  -588.50), SIMDE_FLOAT64_C(   381.73),
+        SIMDE_FLOAT64_C(  -988.12), SIMDE_FLOAT64_C(    48.12), SIMDE_FLOAT64_C(   114.92), SIMDE_FLOAT64_C(   -17.73) } },
+    { { SIMDE_FLOAT64_C(    74.00), SIMDE_FLOAT64_C(   300.00), SIMDE_FLOAT64_C(  -776.17), SIMDE_FLOAT64_C(  -845.30),
+        SIMDE_FLOAT64_C(  -112.78), SIMDE_FLOAT64_C(    20.71), SIMDE_FLOAT64_C(  -365.60), SIMDE_FLOAT64_C(   417.96) },
+      UINT8_C(249),
+      { SIMDE_FLOAT64_C(  -868.42), SIMDE_FLOAT64_C(  -657.69), SIMDE_FLOAT64_C(   251.00), SIMDE_FLOAT64_C(   660.39),
+        SIMDE_FLOAT64_C(   344.84), SIMDE_FLOAT64_C(   476.47), SIMDE_FLOAT64_C(   714.50), SIMDE_FLOAT64_C(   649.28) },
+      { SIMDE_FLOAT64_C(  -868.42), SIMDE_FLOAT64_C(   300.00), SIMDE_FLOAT64_C(  -776.17), SIMDE_FLOAT64_C(  -657.69),
+        SIMDE_FLOAT64_C(   251.00), SIMDE_FLOAT64_C(   660.39), SIMDE_FLOAT64_C(   344.84), SIMDE_FLOAT64_C(   476.47) } },
+    { { SIMDE_FLOAT64_C(   996.90), SIMDE_FLOAT64_C(  -792.32), SIMDE_FLOAT64_C(   891.52), SIMDE_FLOAT64_C(   377.50),
+        SIMDE_FLOAT64_C(  -378.36), SIMDE_FLOAT64_C(  -224.24), SIMDE_FLOAT64_C(  -928.79), SIMDE_FLOAT64_C(   -47.73) },
+         UINT8_MAX,
+      { SIMDE_FLOAT64_C(   531.69), SIMDE_FLOAT64_C(   174.89), SIMDE_FLOAT64_C(   477.15), SIMDE_FLOAT64_C(   311.31),
+        SIMDE_FLOAT64_C(   -21.51), SIMDE_FLOAT64_C(    77.39), SIMDE_FLOAT64_C(   425.99), SIMDE_FLOAT64_C(  -626.82) },
+      { SIMDE_FLOAT64_C(   531.69), SIMDE_FLOAT64_C(   174.89), SIMDE_FLOAT64_C(   477.15), SIMDE_FLOAT64_C(   311.31),
+        SIMDE_FLOAT64_C(   -21.51), SIMDE_FLOAT64_C(    77.39), SIMDE_FLOAT64_C(   425.99), SIMDE_FLOAT64_C(  -626.82) } },
+    { { SIMDE_FLOAT64_C(   633.92), SIMDE_FLOAT64_C(   462.34), SIMDE_FLOAT64_C(  -827.58), SIMDE_FLOAT64_C(  -460.74),
+        SIMDE_FLOAT64_C(  -668.34), SIMDE_FLOAT64_C(   913.65), SIMDE_FLOAT64_C(  -867.23), SIMDE_FLOAT64_C(  -247.78) },
+      UINT8_C(253),
+      { SIMDE_FLOAT64_C(  -170.51), SIMDE_FLOAT64_C(   -73.36), SIMDE_FLOAT64_C(  -113.42), SIMDE_FLOAT64_C(   398.67),
+        SIMDE_FLOAT64_C(   140.44), SIMDE_FLOAT64_C(   295.52), SIMDE_FLOAT64_C(   512.98), SIMDE_FLOAT64_C(   219.04) },
+      { SIMDE_FLOAT64_C(  -170.51), SIMDE_FLOAT64_C(   462.34), SIMDE_FLOAT64_C(   -73.36), SIMDE_FLOAT64_C(  -113.42),
+        SIMDE_FLOAT64_C(   398.67), SIMDE_FLOAT64_C(   140.44), SIMDE_FLOAT64_C(   295.52), SIMDE_FLOAT64_C(   512.98) } },
+    { { SIMDE_FLOAT64_C(  -194.76), SIMDE_FLOAT64_C(   621.47), SIMDE_FLOAT64_C(   353.11), SIMDE_FLOAT64_C(  -501.82),
+        SIMDE_FLOAT64_C(  -164.53), SIMDE_FLOAT64_C(  -171.48), SIMDE_FLOAT64_C(  -211.11), SIMDE_FLOAT64_C(   147.00) },
+      UINT8_C( 78),
+      { SIMDE_FLOAT64_C(  -206.63), SIMDE_FLOAT64_C(   173.38), SIMDE_FLOAT64_C(  -889.28), SIMDE_FLOAT64_C(   519.60),
+        SIMDE_FLOAT64_C(  -802.15), SIMDE_FLOAT64_C(  -605.60), SIMDE_FLOAT64_C(   784.31), SIMDE_FLOAT64_C(   623.87) },
+      { SIMDE_FLOAT64_C(  -194.76), SIMDE_FLOAT64_C(  -206.63), SIMDE_FLOAT64_C(   173.38), SIMDE_FLOAT64_C(  -889.28),
+        SIMDE_FLOAT64_C(  -164.53), SIMDE_FLOAT64_C(  -171.48), SIMDE_FLOAT64_C(   519.60), SIMDE_FLOAT64_C(   147.00) } },
+    { { SIMDE_FLOAT64_C(   633.65), SIMDE_FLOAT64_C(  -411.49), SIMDE_FLOAT64_C(  -574.50), SIMDE_FLOAT64_C(  -750.12),
+        SIMDE_FLOAT64_C(   102.56), SIMDE_FLOAT64_C(   293.30), SIMDE_FLOAT64_C(   516.13), SIMDE_FLOAT64_C(   928.71) },
+      UINT8_C(239),
+      { SIMDE_FLOAT64_C(  -575.74), SIMDE_FLOAT64_C(   283.97), SIMDE_FLOAT64_C(   245.92), SIMDE_FLOAT64_C(   973.45),
+        SIMDE_FLOAT64_C(   -95.68), SIMDE_FLOAT64_C(  -126.81), SIMDE_FLOAT64_C(   586.64), SIMDE_FLOAT64_C(   431.32) },
+      { SIMDE_FLOAT64_C(  -575.74), SIMDE_FLOAT64_C(   283.97), SIMDE_FLOAT64_C(   245.92), SIMDE_FLOAT64_C(   973.45),
+        SIMDE_FLOAT64_C(   102.56), SIMDE_FLOAT64_C(   -95.68), SIMDE_FLOAT64_C(  -126.81), SIMDE_FLOAT64_C(   586.64) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_expand_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 40),
+      { SIMDE_FLOAT64_C(   380.28), SIMDE_FLOAT64_C(  -782.42), SIMDE_FLOAT64_C(   592.53), SIMDE_FLOAT64_C(   991.10),
+        SIMDE_FLOAT64_C(   738.76), SIMDE_FLOAT64_C(   617.74), SIMDE_FLOAT64_C(   188.27), SIMDE_FLOAT64_C(   595.27) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   380.28),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -782.42), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   888.21), SIMDE_FLOAT64_C(   483.56), SIMDE_FLOAT64_C(   225.74), SIMDE_FLOAT64_C(    66.60),
+        SIMDE_FLOAT64_C(   719.26), SIMDE_FLOAT64_C(   886.65), SIMDE_FLOAT64_C(  -561.85), SIMDE_FLOAT64_C(   768.65) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(141),
+      { SIMDE_FLOAT64_C(  -180.84), SIMDE_FLOAT64_C(   477.95), SIMDE_FLOAT64_C(   974.28), SIMDE_FLOAT64_C(   505.02),
+        SIMDE_FLOAT64_C(   981.76), SIMDE_FLOAT64_C(   658.80), SIMDE_FLOAT64_C(  -728.18), SIMDE_FLOAT64_C(   839.50) },
+      { SIMDE_FLOAT64_C(  -180.84), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   477.95), SIMDE_FLOAT64_C(   974.28),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   505.02) } },
+    { UINT8_C( 36),
+      { SIMDE_FLOAT64_C(   550.99), SIMDE_FLOAT64_C(    -8.29), SIMDE_FLOAT64_C(  -881.79), SIMDE_FLOAT64_C(   806.86),
+        SIMDE_FLOAT64_C(  -550.65), SIMDE_FLOAT64_C(  -958.83), SIMDE_FLOAT64_C(  -145.84), SIMDE_FLOAT64_C(   112.46) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   550.99), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    -8.29), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(205),
+      { SIMDE_FLOAT64_C(   145.93), SIMDE_FLOAT64_C(   974.14), SIMDE_FLOAT64_C(  -375.42), SIMDE_FLOAT64_C(  -503.15),
+        SIMDE_FLOAT64_C(    -9.49), SIMDE_FLOAT64_C(  -924.86), SIMDE_FLOAT64_C(  -234.36), SIMDE_FLOAT64_C(   636.35) },
+      { SIMDE_FLOAT64_C(   145.93), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   974.14), SIMDE_FLOAT64_C(  -375.42),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -503.15), SIMDE_FLOAT64_C(    -9.49) } },
+    { UINT8_C( 39),
+      { SIMDE_FLOAT64_C(   679.02), SIMDE_FLOAT64_C(   -20.26), SIMDE_FLOAT64_C(   692.60), SIMDE_FLOAT64_C(   468.47),
+        SIMDE_FLOAT64_C(  -508.25), SIMDE_FLOAT64_C(   -38.97), SIMDE_FLOAT64_C(   208.95), SIMDE_FLOAT64_C(  -794.18) },
+      { SIMDE_FLOAT64_C(   679.02), SIMDE_FLOAT64_C(   -20.26), SIMDE_FLOAT64_C(   692.60), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   468.47), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 28),
+      { SIMDE_FLOAT64_C(   687.71), SIMDE_FLOAT64_C(   258.59), SIMDE_FLOAT64_C(   823.98), SIMDE_FLOAT64_C(   311.95),
+        SIMDE_FLOAT64_C(   777.69), SIMDE_FLOAT64_C(  -847.82), SIMDE_FLOAT64_C(  -446.20), SIMDE_FLOAT64_C(  -178.43) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   687.71), SIMDE_FLOAT64_C(   258.59),
+        SIMDE_FLOAT64_C(   823.98), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(  -101.88), SIMDE_FLOAT64_C(   134.28), SIMDE_FLOAT64_C(   945.38), SIMDE_FLOAT64_C(   860.77),
+        SIMDE_FLOAT64_C(   612.74), SIMDE_FLOAT64_C(   492.05), SIMDE_FLOAT64_C(   867.71), SIMDE_FLOAT64_C(  -634.89) },
+      { SIMDE_FLOAT64_C(  -101.88), SIMDE_FLOAT64_C(   134.28), SIMDE_FLOAT64_C(   945.38), SIMDE_FLOAT64_C(   860.77),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_expand_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expandloadu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   605.17), SIMDE_FLOAT64_C(  -491.25), SIMDE_FLOAT64_C(  -183.13), SIMDE_FLOAT64_C(   550.58),
+        SIMDE_FLOAT64_C(  -103.28), SIMDE_FLOAT64_C(  -363.37), SIMDE_FLOAT64_C(   407.42), SIMDE_FLOAT64_C(  -981.03) },
+      UINT8_C(175),
+      { SIMDE_FLOAT64_C(   242.07), SIMDE_FLOAT64_C(   589.09), SIMDE_FLOAT64_C(   181.98), SIMDE_FLOAT64_C(  -109.63),
+        SIMDE_FLOAT64_C(   795.34), SIMDE_FLOAT64_C(  -682.41), SIMDE_FLOAT64_C(  -875.64), SIMDE_FLOAT64_C(   691.17) },
+      { SIMDE_FLOAT64_C(   242.07), SIMDE_FLOAT64_C(   589.09), SIMDE_FLOAT64_C(   181.98), SIMDE_FLOAT64_C(  -109.63),
+        SIMDE_FLOAT64_C(  -103.28), SIMDE_FLOAT64_C(   795.34), SIMDE_FLOAT64_C(   407.42), SIMDE_FLOAT64_C(  -682.41) } },
+    { { SIMDE_FLOAT64_C(  -452.30), SIMDE_FLOAT64_C(  -932.71), SIMDE_FLOAT64_C(   765.63), SIMDE_FLOAT64_C(  -670.26),
+        SIMDE_FLOAT64_C(   994.44), SIMDE_FLOAT64_C(  -862.95), SIMDE_FLOAT64_C(   362.77), SIMDE_FLOAT64_C(  -102.70) },
+      UINT8_C( 93),
+      { SIMDE_FLOAT64_C(    65.82), SIMDE_FLOAT64_C(  -209.44), SIMDE_FLOAT64_C(  -135.67), SIMDE_FLOAT64_C(  -542.72),
+        SIMDE_FLOAT64_C(    80.60), SIMDE_FLOAT64_C(   399.43), SIMDE_FLOAT64_C(  -123.91), SIMDE_FLOAT64_C(   512.33) },
+      { SIMDE_FLOAT64_C(    65.82), SIMDE_FLOAT64_C(  -932.71), SIMDE_FLOAT64_C(  -209.44), SIMDE_FLOAT64_C(  -135.67),
+        SIMDE_FLOAT64_C(  -542.72), SIMDE_FLOAT64_C(  -862.95), SIMDE_FLOAT64_C(    80.60), SIMDE_FLOAT64_C(  -102.70) } },
+    { { SIMDE_FLOAT64_C(   865.82), SIMDE_FLOAT64_C(  -857.15), SIMDE_FLOAT64_C(   688.59), SIMDE_FLOAT64_C(   407.18),
+        SIMDE_FLOAT64_C(  -725.76), SIMDE_FLOAT64_C(   256.79), SIMDE_FLOAT64_C(  -253.05), SIMDE_FLOAT64_C(   973.11) },
+      UINT8_C( 73),
+      { SIMDE_FLOAT64_C(    36.06), SIMDE_FLOAT64_C(   150.49), SIMDE_FLOAT64_C(   831.40), SIMDE_FLOAT64_C(   857.17),
+        SIMDE_FLOAT64_C(  -557.50), SIMDE_FLOAT64_C(   324.22), SIMDE_FLOAT64_C(  -998.36), SIMDE_FLOAT64_C(    70.06) },
+      { SIMDE_FLOAT64_C(    36.06), SIMDE_FLOAT64_C(  -857.15), SIMDE_FLOAT64_C(   688.59), SIMDE_FLOAT64_C(   150.49),
+        SIMDE_FLOAT64_C(  -725.76), SIMDE_FLOAT64_C(   256.79), SIMDE_FLOAT64_C(   831.40), SIMDE_FLOAT64_C(   973.11) } },
+    { { SIMDE_FLOAT64_C(    53.76), SIMDE_FLOAT64_C(  -162.40), SIMDE_FLOAT64_C(  -848.16), SIMDE_FLOAT64_C(  -194.79),
+        SIMDE_FLOAT64_C(  -649.68), SIMDE_FLOAT64_C(   352.13), SIMDE_FLOAT64_C(  -830.31), SIMDE_FLOAT64_C(  -863.23) },
+      UINT8_C(191),
+      { SIMDE_FLOAT64_C(   892.81), SIMDE_FLOAT64_C(   525.45), SIMDE_FLOAT64_C(   -62.37), SIMDE_FLOAT64_C(  -523.69),
+        SIMDE_FLOAT64_C(   909.67), SIMDE_FLOAT64_C(  -579.01), SIMDE_FLOAT64_C(   870.42), SIMDE_FLOAT64_C(  -725.72) },
+      { SIMDE_FLOAT64_C(   892.81), SIMDE_FLOAT64_C(   525.45), SIMDE_FLOAT64_C(   -62.37), SIMDE_FLOAT64_C(  -523.69),
+        SIMDE_FLOAT64_C(   909.67), SIMDE_FLOAT64_C(  -579.01), SIMDE_FLOAT64_C(  -830.31), SIMDE_FLOAT64_C(   870.42) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d r = simde_mm512_mask_expandloadu_pd(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 42),
+      { SIMDE_FLOAT64_C(  -554.98), SIMDE_FLOAT64_C(  -268.25), SIMDE_FLOAT64_C(   600.91), SIMDE_FLOAT64_C(   -76.06),
+        SIMDE_FLOAT64_C(  -728.21), SIMDE_FLOAT64_C(  -570.92), SIMDE_FLOAT64_C(  -583.87), SIMDE_FLOAT64_C(  -583.42) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -554.98), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -268.25),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   600.91), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  -197.63), SIMDE_FLOAT64_C(   519.55), SIMDE_FLOAT64_C(   668.95), SIMDE_FLOAT64_C(  -808.09),
+        SIMDE_FLOAT64_C(   864.40), SIMDE_FLOAT64_C(  -584.42), SIMDE_FLOAT64_C(   501.21), SIMDE_FLOAT64_C(  -710.65) },
+      { SIMDE_FLOAT64_C(  -197.63), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   510.22), SIMDE_FLOAT64_C(   324.12), SIMDE_FLOAT64_C(   415.83), SIMDE_FLOAT64_C(  -775.93),
+        SIMDE_FLOAT64_C(   -79.80), SIMDE_FLOAT64_C(   736.19), SIMDE_FLOAT64_C(  -985.99), SIMDE_FLOAT64_C(  -799.68) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(108),
+      { SIMDE_FLOAT64_C(   132.00), SIMDE_FLOAT64_C(     5.23), SIMDE_FLOAT64_C(  -564.62), SIMDE_FLOAT64_C(  -509.31),
+        SIMDE_FLOAT64_C(  -940.55), SIMDE_FLOAT64_C(  -214.38), SIMDE_FLOAT64_C(  -680.11), SIMDE_FLOAT64_C(   911.94) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   132.00), SIMDE_FLOAT64_C(     5.23),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -564.62), SIMDE_FLOAT64_C(  -509.31), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d r = simde_mm512_maskz_expandloadu_pd(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
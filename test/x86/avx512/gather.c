@@ -0,0 +1,1973 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN gather
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/gather.h>
+
+static int32_t i32_buffer[4096];
+static int64_t i64_buffer[4096];
+static simde_float32 f32_buffer[4096];
+static simde_float64 f64_buffer[4096];
+
+static int
+test_simde_mm_mmask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  2080366591),  INT32_C(  1021595175),  INT32_C(  1342177255), -INT32_C(  1431447880) },
+         UINT8_MAX,
+      { -INT32_C(          70), -INT32_C(          15), -INT32_C(           9), -INT32_C(         110) },
+      { -INT32_C(         210), -INT32_C(          45), -INT32_C(          27), -INT32_C(         330) } },
+    { {  INT32_C(      574016),  INT32_C(    87502580), -INT32_C(        1665),  INT32_C(   272633892) },
+      UINT8_C( 79),
+      { -INT32_C(         183),  INT32_C(         232),  INT32_C(         125),  INT32_C(          53) },
+      { -INT32_C(         549),  INT32_C(         696),  INT32_C(         375),  INT32_C(         159) } },
+    { {  INT32_C(  1553844406),  INT32_C(  1805094269),  INT32_C(  1207959568), -INT32_C(    70549505) },
+      UINT8_C( 57),
+      {  INT32_C(          65),  INT32_C(         105), -INT32_C(         104),  INT32_C(         249) },
+      {  INT32_C(         195),  INT32_C(  1805094269),  INT32_C(  1207959568),  INT32_C(         747) } },
+    { {  INT32_C(    67190800),  INT32_C(   663612841),  INT32_C(  1306692634),  INT32_C(  1979474481) },
+      UINT8_C( 21),
+      {  INT32_C(          41), -INT32_C(         233), -INT32_C(         111),  INT32_C(         243) },
+      {  INT32_C(         123),  INT32_C(   663612841), -INT32_C(         333),  INT32_C(  1979474481) } },
+    { {  INT32_C(  1358954502),  INT32_C(    60077672), -INT32_C(  1292785911),  INT32_C(   336087045) },
+      UINT8_C(123),
+      { -INT32_C(          23), -INT32_C(         222), -INT32_C(         171),  INT32_C(         103) },
+      { -INT32_C(          69), -INT32_C(         666), -INT32_C(  1292785911),  INT32_C(         309) } },
+    { { -INT32_C(     8945665), -INT32_C(   443385375),  INT32_C(   141848629),  INT32_C(   541069441) },
+      UINT8_C(247),
+      { -INT32_C(         215),  INT32_C(           0),  INT32_C(          80), -INT32_C(         244) },
+      { -INT32_C(         645),  INT32_C(           0),  INT32_C(         240),  INT32_C(   541069441) } },
+    { {  INT32_C(   272629760),  INT32_C(   168394752),  INT32_C(     2097152),  INT32_C(   205520897) },
+      UINT8_C(171),
+      {  INT32_C(          54), -INT32_C(          92), -INT32_C(          11),  INT32_C(           6) },
+      {  INT32_C(         162), -INT32_C(         276),  INT32_C(     2097152),  INT32_C(          18) } },
+    { {  INT32_C(  1029267866), -INT32_C(  1073752065), -INT32_C(      262145),  INT32_C(  1878652924) },
+      UINT8_C( 39),
+      {  INT32_C(         226),  INT32_C(         178),  INT32_C(         136), -INT32_C(          54) },
+      {  INT32_C(         678),  INT32_C(         534),  INT32_C(         408),  INT32_C(  1878652924) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i32gather_epi32(src, test_vec[i].k, vindex, &(i32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 4793875350531862948),  INT64_C(  180426181709923328) },
+         UINT8_MAX,
+      { -INT32_C(        1888), -INT32_C(         384),  INT32_C(  1994827205), -INT32_C(   499882008) },
+      { -INT64_C(       1013612282092), -INT64_C(        206158430256) } },
+    { {  INT64_C(  144185556837335552),  INT64_C( 8407586348582190484) },
+      UINT8_C( 98),
+      { -INT32_C(        1000),  INT32_C(        1744), -INT32_C(   140905600), -INT32_C(  2135266909) },
+      {  INT64_C(  144185556837335552),  INT64_C(        936302870746) } },
+    { { -INT64_C( 1739093418773054081), -INT64_C(     281494304135169) },
+      UINT8_C( 60),
+      { -INT32_C(         264), -INT32_C(        1464), -INT32_C(   684953698),  INT32_C(  1716688642) },
+      { -INT64_C( 1739093418773054081), -INT64_C(     281494304135169) } },
+    { {  INT64_C(  405122003558081958), -INT64_C( 7886645399757384747) },
+      UINT8_C(168),
+      { -INT32_C(        1328),  INT32_C(        1480),  INT32_C(  1752418016),  INT32_C(   896390744) },
+      {  INT64_C(  405122003558081958), -INT64_C( 7886645399757384747) } },
+    { {  INT64_C( 9204635133522870595), -INT64_C(  720857415373946881) },
+      UINT8_C( 19),
+      { -INT32_C(         832),  INT32_C(        1944),  INT32_C(   531529903), -INT32_C(   654936699) },
+      { -INT64_C(        446676598888),  INT64_C(       1043677053171) } },
+    { {  INT64_C(      55117584793616), -INT64_C( 4517023402793998996) },
+      UINT8_C( 20),
+      {  INT32_C(          16), -INT32_C(        1496),  INT32_C(  2105897602), -INT32_C(  1918152214) },
+      {  INT64_C(      55117584793616), -INT64_C( 4517023402793998996) } },
+    { {  INT64_C(      37392589258752), -INT64_C(  581177660542292233) },
+      UINT8_C( 43),
+      { -INT32_C(        1832),  INT32_C(          56),  INT32_C(  1438109354), -INT32_C(  2011614727) },
+      { -INT64_C(        983547511013),  INT64_C(         30064771079) } },
+    { { -INT64_C( 1733885856806076417), -INT64_C( 9223372014841978335) },
+      UINT8_C(155),
+      { -INT32_C(        2040), -INT32_C(        1136),  INT32_C(  1430897254),  INT32_C(  1697278219) },
+      { -INT64_C(       1095216660735), -INT64_C(        609885356174) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i32gather_epi64(src, test_vec[i].k, vindex, &(i64_buffer[2048]), 1);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  7665.00), SIMDE_FLOAT32_C( -1227.25), SIMDE_FLOAT32_C(  6834.75), SIMDE_FLOAT32_C( -9074.75) },
+         UINT8_MAX,
+      { -INT32_C(         142), -INT32_C(         150),  INT32_C(           2),  INT32_C(         148) },
+      { SIMDE_FLOAT32_C(  -142.00), SIMDE_FLOAT32_C(  -150.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   148.00) } },
+    { { SIMDE_FLOAT32_C( -2835.00), SIMDE_FLOAT32_C(  5450.75), SIMDE_FLOAT32_C(  9022.50), SIMDE_FLOAT32_C(  5766.75) },
+      UINT8_C(130),
+      {  INT32_C(          59),  INT32_C(          58),  INT32_C(         153),  INT32_C(         156) },
+      { SIMDE_FLOAT32_C( -2835.00), SIMDE_FLOAT32_C(    58.00), SIMDE_FLOAT32_C(  9022.50), SIMDE_FLOAT32_C(  5766.75) } },
+    { { SIMDE_FLOAT32_C( -4339.00), SIMDE_FLOAT32_C( -6436.00), SIMDE_FLOAT32_C( -3786.50), SIMDE_FLOAT32_C( -9264.00) },
+      UINT8_C(191),
+      { -INT32_C(          77), -INT32_C(         186),  INT32_C(         110), -INT32_C(          20) },
+      { SIMDE_FLOAT32_C(   -77.00), SIMDE_FLOAT32_C(  -186.00), SIMDE_FLOAT32_C(   110.00), SIMDE_FLOAT32_C(   -20.00) } },
+    { { SIMDE_FLOAT32_C( -6818.50), SIMDE_FLOAT32_C( -4909.75), SIMDE_FLOAT32_C( -8752.75), SIMDE_FLOAT32_C( -3910.25) },
+      UINT8_C( 73),
+      { -INT32_C(         208),  INT32_C(         221), -INT32_C(          64),  INT32_C(         118) },
+      { SIMDE_FLOAT32_C(  -208.00), SIMDE_FLOAT32_C( -4909.75), SIMDE_FLOAT32_C( -8752.75), SIMDE_FLOAT32_C(   118.00) } },
+    { { SIMDE_FLOAT32_C( -6148.75), SIMDE_FLOAT32_C( -2468.25), SIMDE_FLOAT32_C(  1290.25), SIMDE_FLOAT32_C( -3329.75) },
+      UINT8_C(176),
+      {  INT32_C(         221),  INT32_C(          58),  INT32_C(          97),  INT32_C(         133) },
+      { SIMDE_FLOAT32_C( -6148.75), SIMDE_FLOAT32_C( -2468.25), SIMDE_FLOAT32_C(  1290.25), SIMDE_FLOAT32_C( -3329.75) } },
+    { { SIMDE_FLOAT32_C( -7056.25), SIMDE_FLOAT32_C(  5124.75), SIMDE_FLOAT32_C( -7417.75), SIMDE_FLOAT32_C( -8930.00) },
+      UINT8_C(239),
+      {  INT32_C(          35), -INT32_C(          32), -INT32_C(         209), -INT32_C(         162) },
+      { SIMDE_FLOAT32_C(    35.00), SIMDE_FLOAT32_C(   -32.00), SIMDE_FLOAT32_C(  -209.00), SIMDE_FLOAT32_C(  -162.00) } },
+    { { SIMDE_FLOAT32_C( -4828.75), SIMDE_FLOAT32_C( -3277.75), SIMDE_FLOAT32_C(  3680.25), SIMDE_FLOAT32_C( -8603.50) },
+      UINT8_C(185),
+      {  INT32_C(          38), -INT32_C(         178), -INT32_C(         177),  INT32_C(          92) },
+      { SIMDE_FLOAT32_C(    38.00), SIMDE_FLOAT32_C( -3277.75), SIMDE_FLOAT32_C(  3680.25), SIMDE_FLOAT32_C(    92.00) } },
+    { { SIMDE_FLOAT32_C(  3207.00), SIMDE_FLOAT32_C(  3434.25), SIMDE_FLOAT32_C( -1512.25), SIMDE_FLOAT32_C( -5976.25) },
+      UINT8_C(221),
+      {  INT32_C(         130), -INT32_C(          74), -INT32_C(         197),  INT32_C(          94) },
+      { SIMDE_FLOAT32_C(   130.00), SIMDE_FLOAT32_C(  3434.25), SIMDE_FLOAT32_C(  -197.00), SIMDE_FLOAT32_C(    94.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128 r = simde_mm_mmask_i32gather_ps(src, test_vec[i].k, vindex, &(f32_buffer[2048]), 8);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  4454.50), SIMDE_FLOAT64_C(  2263.00) },
+         UINT8_MAX,
+      {  INT32_C(         228), -INT32_C(         236), -INT32_C(  1738572356),  INT32_C(   831162974) },
+      { SIMDE_FLOAT64_C(    14.25), SIMDE_FLOAT64_C(   -14.75) } },
+    { { SIMDE_FLOAT64_C( -7374.50), SIMDE_FLOAT64_C( -3034.00) },
+      UINT8_C(211),
+      { -INT32_C(         136), -INT32_C(         988),  INT32_C(  1476530553),  INT32_C(   826943895) },
+      { SIMDE_FLOAT64_C(    -8.50), SIMDE_FLOAT64_C(   -61.75) } },
+    { { SIMDE_FLOAT64_C( -8206.50), SIMDE_FLOAT64_C(  9449.00) },
+      UINT8_C(200),
+      {  INT32_C(         928), -INT32_C(         236),  INT32_C(  1765835106), -INT32_C(   490808233) },
+      { SIMDE_FLOAT64_C( -8206.50), SIMDE_FLOAT64_C(  9449.00) } },
+    { { SIMDE_FLOAT64_C(  8118.50), SIMDE_FLOAT64_C(  1193.00) },
+      UINT8_C(171),
+      { -INT32_C(         588), -INT32_C(         176), -INT32_C(   974057760), -INT32_C(  1150391994) },
+      { SIMDE_FLOAT64_C(   -36.75), SIMDE_FLOAT64_C(   -11.00) } },
+    { { SIMDE_FLOAT64_C( -9303.50), SIMDE_FLOAT64_C( -5193.00) },
+      UINT8_C( 89),
+      { -INT32_C(         932),  INT32_C(          36), -INT32_C(    25481197),  INT32_C(  1743050134) },
+      { SIMDE_FLOAT64_C(   -58.25), SIMDE_FLOAT64_C( -5193.00) } },
+    { { SIMDE_FLOAT64_C(  3252.00), SIMDE_FLOAT64_C( -8153.25) },
+      UINT8_C( 42),
+      { -INT32_C(         168), -INT32_C(         540), -INT32_C(   161716728),  INT32_C(  1382648728) },
+      { SIMDE_FLOAT64_C(  3252.00), SIMDE_FLOAT64_C(   -33.75) } },
+    { { SIMDE_FLOAT64_C(  4661.75), SIMDE_FLOAT64_C( -8813.00) },
+      UINT8_C(163),
+      { -INT32_C(         252), -INT32_C(         936), -INT32_C(   566492735),  INT32_C(  1718493051) },
+      { SIMDE_FLOAT64_C(   -15.75), SIMDE_FLOAT64_C(   -58.50) } },
+    { { SIMDE_FLOAT64_C( -3610.00), SIMDE_FLOAT64_C(  9083.25) },
+      UINT8_C( 42),
+      { -INT32_C(         728),  INT32_C(         812), -INT32_C(   145641961),  INT32_C(      123814) },
+      { SIMDE_FLOAT64_C( -3610.00), SIMDE_FLOAT64_C(    50.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128d r = simde_mm_mmask_i32gather_pd(src, test_vec[i].k, vindex, &(f64_buffer[2048]), 2);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   175739662),  INT32_C(    67175457),  INT32_C(     1050961),  INT32_C(           0) },
+         UINT8_MAX,
+      { -INT64_C(                 105),  INT64_C(                  59) },
+      { -INT32_C(         315),  INT32_C(         177),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   244266705), -INT32_C(  1877327528), -INT32_C(  1998676422), -INT32_C(  2147482560) },
+      UINT8_C(152),
+      { -INT64_C(                  27), -INT64_C(                 180) },
+      { -INT32_C(   244266705), -INT32_C(  1877327528),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1074798592), -INT32_C(   340342985),  INT32_C(   320338088),  INT32_C(  1620668365) },
+      UINT8_C(157),
+      {  INT64_C(                 217), -INT64_C(                 180) },
+      {  INT32_C(         651), -INT32_C(   340342985),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(    93619247),  INT32_C(    19407616),  INT32_C(  1172547820),  INT32_C(  1244122255) },
+      UINT8_C(166),
+      { -INT64_C(                  98),  INT64_C(                 189) },
+      {  INT32_C(    93619247),  INT32_C(         567),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   152115418),  INT32_C(    17104896), -INT32_C(   545275906),  INT32_C(   668378848) },
+      UINT8_C( 55),
+      {  INT64_C(                 172),  INT64_C(                 146) },
+      {  INT32_C(         516),  INT32_C(         438),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(     5808129), -INT32_C(  1879047168), -INT32_C(   133225195),  INT32_C(    18087936) },
+      UINT8_C(248),
+      {  INT64_C(                 235),  INT64_C(                  48) },
+      { -INT32_C(     5808129), -INT32_C(  1879047168),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1565388648), -INT32_C(  1074398209),  INT32_C(     4325382),  INT32_C(    67109920) },
+      UINT8_C(150),
+      { -INT64_C(                  64), -INT64_C(                  41) },
+      {  INT32_C(  1565388648), -INT32_C(         123),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   837938671),  INT32_C(   503972864),  INT32_C(    95791051),  INT32_C(          33) },
+      UINT8_C(189),
+      { -INT64_C(                 205),  INT64_C(                 177) },
+      { -INT32_C(         615),  INT32_C(   503972864),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i64gather_epi32(src, test_vec[i].k, vindex, &(i32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 7566047438407008420), -INT64_C( 4908929091393626113) },
+         UINT8_MAX,
+      { -INT64_C(                 252),  INT64_C(                 192) },
+      { -INT64_C(        541165879422),  INT64_C(        412316860512) } },
+    { {  INT64_C( 1349680295672881317), -INT64_C( 1154752482585346053) },
+      UINT8_C( 99),
+      { -INT64_C(                 324), -INT64_C(                 334) },
+      { -INT64_C(        695784702114), -INT64_C(        717259538599) } },
+    { { -INT64_C( 5534842788241138608), -INT64_C( 1112850293227232435) },
+      UINT8_C(205),
+      {  INT64_C(                 508),  INT64_C(                 266) },
+      {  INT64_C(       1090921693438), -INT64_C( 1112850293227232435) } },
+    { { -INT64_C( 5614342769272291605), -INT64_C(  913967186073310235) },
+      UINT8_C( 74),
+      {  INT64_C(                 332),  INT64_C(                 422) },
+      { -INT64_C( 5614342769272291605),  INT64_C(        906238099667) } },
+    { { -INT64_C(     281749889220649),  INT64_C( 7495150864223470208) },
+      UINT8_C( 85),
+      { -INT64_C(                 106), -INT64_C(                 310) },
+      { -INT64_C(        227633266741),  INT64_C( 7495150864223470208) } },
+    { {  INT64_C( 4611686008746934271),  INT64_C( 4631965420151635972) },
+      UINT8_C( 22),
+      {  INT64_C(                 428),  INT64_C(                  92) },
+      {  INT64_C( 4611686008746934271),  INT64_C(        197568495662) } },
+    { { -INT64_C(    3378249497608193),  INT64_C( 6163793112443741364) },
+      UINT8_C(251),
+      { -INT64_C(                 474), -INT64_C(                   2) },
+      { -INT64_C(       1017907249389), -INT64_C(          4294967297) } },
+    { { -INT64_C( 4611685996952484848), -INT64_C( 1239052847614559233) },
+      UINT8_C(105),
+      { -INT64_C(                 262), -INT64_C(                 212) },
+      { -INT64_C(        562640715907), -INT64_C( 1239052847614559233) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i64gather_epi64(src, test_vec[i].k, vindex, &(i64_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  9917.00), SIMDE_FLOAT32_C(  9561.25), SIMDE_FLOAT32_C( -5536.00), SIMDE_FLOAT32_C( -9076.25) },
+         UINT8_MAX,
+      { -INT64_C(                 252), -INT64_C(                 146) },
+      { SIMDE_FLOAT32_C(  -126.00), SIMDE_FLOAT32_C(   -73.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C(  6648.50), SIMDE_FLOAT32_C( -3402.25), SIMDE_FLOAT32_C( -2303.00), SIMDE_FLOAT32_C(  3062.25) },
+      UINT8_C(228),
+      {  INT64_C(                  45), -INT64_C(                 206) },
+      { SIMDE_FLOAT32_C(  6648.50), SIMDE_FLOAT32_C( -3402.25), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C( -8090.25), SIMDE_FLOAT32_C(   527.50), SIMDE_FLOAT32_C(   141.00), SIMDE_FLOAT32_C(   245.00) },
+      UINT8_C(117),
+      { -INT64_C(                 115), -INT64_C(                 248) },
+      { SIMDE_FLOAT32_C(   -57.50), SIMDE_FLOAT32_C(   527.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C( -1910.75), SIMDE_FLOAT32_C( -2214.25), SIMDE_FLOAT32_C( -8672.00), SIMDE_FLOAT32_C(  7166.25) },
+      UINT8_C(199),
+      {  INT64_C(                 100), -INT64_C(                  85) },
+      { SIMDE_FLOAT32_C(    50.00), SIMDE_FLOAT32_C(   -42.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C( -1574.50), SIMDE_FLOAT32_C(   611.50), SIMDE_FLOAT32_C(  1494.25), SIMDE_FLOAT32_C( -6052.75) },
+      UINT8_C(181),
+      { -INT64_C(                 111), -INT64_C(                 180) },
+      { SIMDE_FLOAT32_C(   -55.50), SIMDE_FLOAT32_C(   611.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C( -8307.50), SIMDE_FLOAT32_C(  -176.50), SIMDE_FLOAT32_C( -1967.75), SIMDE_FLOAT32_C( -1192.50) },
+      UINT8_C(127),
+      { -INT64_C(                 129), -INT64_C(                 214) },
+      { SIMDE_FLOAT32_C(   -64.50), SIMDE_FLOAT32_C(  -107.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C(  -616.25), SIMDE_FLOAT32_C(  6695.00), SIMDE_FLOAT32_C( -8042.50), SIMDE_FLOAT32_C(  1395.00) },
+      UINT8_C( 39),
+      { -INT64_C(                  52),  INT64_C(                  11) },
+      { SIMDE_FLOAT32_C(   -26.00), SIMDE_FLOAT32_C(     5.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C(  1563.75), SIMDE_FLOAT32_C( -7401.75), SIMDE_FLOAT32_C(   535.50), SIMDE_FLOAT32_C(  1070.00) },
+      UINT8_C( 55),
+      { -INT64_C(                  60), -INT64_C(                 248) },
+      { SIMDE_FLOAT32_C(   -30.00), SIMDE_FLOAT32_C(  -124.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128 r = simde_mm_mmask_i64gather_ps(src, test_vec[i].k, vindex, &(f32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    25.75), SIMDE_FLOAT64_C( -1935.25) },
+         UINT8_MAX,
+      { -INT64_C(                 544), -INT64_C(                 288) },
+      { SIMDE_FLOAT64_C(   -17.00), SIMDE_FLOAT64_C(    -9.00) } },
+    { { SIMDE_FLOAT64_C( -6316.00), SIMDE_FLOAT64_C( -3729.50) },
+      UINT8_C(207),
+      {  INT64_C(                1976),  INT64_C(                 424) },
+      { SIMDE_FLOAT64_C(    61.75), SIMDE_FLOAT64_C(    13.25) } },
+    { { SIMDE_FLOAT64_C(  9884.50), SIMDE_FLOAT64_C( -6971.75) },
+      UINT8_C(228),
+      {  INT64_C(                 472),  INT64_C(                 912) },
+      { SIMDE_FLOAT64_C(  9884.50), SIMDE_FLOAT64_C( -6971.75) } },
+    { { SIMDE_FLOAT64_C(  4037.75), SIMDE_FLOAT64_C(  8111.50) },
+      UINT8_C(223),
+      {  INT64_C(                 376), -INT64_C(                1504) },
+      { SIMDE_FLOAT64_C(    11.75), SIMDE_FLOAT64_C(   -47.00) } },
+    { { SIMDE_FLOAT64_C(  8327.25), SIMDE_FLOAT64_C( -5839.50) },
+      UINT8_C(230),
+      { -INT64_C(                1280),  INT64_C(                 976) },
+      { SIMDE_FLOAT64_C(  8327.25), SIMDE_FLOAT64_C(    30.50) } },
+    { { SIMDE_FLOAT64_C( -2857.75), SIMDE_FLOAT64_C(  9564.00) },
+      UINT8_C( 40),
+      { -INT64_C(                1224),  INT64_C(                 440) },
+      { SIMDE_FLOAT64_C( -2857.75), SIMDE_FLOAT64_C(  9564.00) } },
+    { { SIMDE_FLOAT64_C( -3310.25), SIMDE_FLOAT64_C( -5359.00) },
+      UINT8_C( 63),
+      { -INT64_C(                 152),  INT64_C(                 128) },
+      { SIMDE_FLOAT64_C(    -4.75), SIMDE_FLOAT64_C(     4.00) } },
+    { { SIMDE_FLOAT64_C( -8897.25), SIMDE_FLOAT64_C( -6839.50) },
+      UINT8_C( 73),
+      { -INT64_C(                 304),  INT64_C(                 504) },
+      { SIMDE_FLOAT64_C(    -9.50), SIMDE_FLOAT64_C( -6839.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128d r = simde_mm_mmask_i64gather_pd(src, test_vec[i].k, vindex, &(f64_buffer[2048]), 1);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1003216645),  INT32_C(    33591488),  INT32_C(   151389184), -INT32_C(       33283),  INT32_C(  1073750016),  INT32_C(   996160700), -INT32_C(          66), -INT32_C(  1607648237) },
+         UINT8_MAX,
+      { -INT32_C(         139),  INT32_C(         233),  INT32_C(         146),  INT32_C(         154),  INT32_C(         101),  INT32_C(         150),  INT32_C(          77), -INT32_C(          64) },
+      { -INT32_C(         834),  INT32_C(        1398),  INT32_C(         876),  INT32_C(         924),  INT32_C(         606),  INT32_C(         900),  INT32_C(         462), -INT32_C(         384) } },
+    { { -INT32_C(   301991937), -INT32_C(           1),  INT32_C(  1641382641),  INT32_C(  1532974554),  INT32_C(  2147479551), -INT32_C(  1845090549), -INT32_C(        4993),  INT32_C(      147456) },
+      UINT8_C(223),
+      {  INT32_C(          62), -INT32_C(          53),  INT32_C(         136),  INT32_C(         239),  INT32_C(         126),  INT32_C(          48), -INT32_C(          41),  INT32_C(          22) },
+      {  INT32_C(         372), -INT32_C(         318),  INT32_C(         816),  INT32_C(        1434),  INT32_C(         756), -INT32_C(  1845090549), -INT32_C(         246),  INT32_C(         132) } },
+    { { -INT32_C(    49378480), -INT32_C(   832054626),  INT32_C(   286642004),  INT32_C(  1560018810), -INT32_C(   950820283), -INT32_C(  1667451018), -INT32_C(  1726931473),  INT32_C(      789508) },
+      UINT8_C(168),
+      {  INT32_C(          19), -INT32_C(          44), -INT32_C(         203), -INT32_C(         250),  INT32_C(           9),  INT32_C(          58), -INT32_C(         131), -INT32_C(          18) },
+      { -INT32_C(    49378480), -INT32_C(   832054626),  INT32_C(   286642004), -INT32_C(        1500), -INT32_C(   950820283),  INT32_C(         348), -INT32_C(  1726931473), -INT32_C(         108) } },
+    { {  INT32_C(  1956846418), -INT32_C(    16779009),  INT32_C(  1551328301),  INT32_C(  1909504278),  INT32_C(    36306952), -INT32_C(  1202909206),  INT32_C(   340787344),  INT32_C(  1285004283) },
+      UINT8_C( 18),
+      { -INT32_C(         200), -INT32_C(         116),  INT32_C(         238), -INT32_C(          33), -INT32_C(         134),  INT32_C(          93),  INT32_C(          22), -INT32_C(          90) },
+      {  INT32_C(  1956846418), -INT32_C(         696),  INT32_C(  1551328301),  INT32_C(  1909504278), -INT32_C(         804), -INT32_C(  1202909206),  INT32_C(   340787344),  INT32_C(  1285004283) } },
+    { {  INT32_C(  1109393792),  INT32_C(   540249368), -INT32_C(      658436), -INT32_C(   730055202), -INT32_C(  1639534177), -INT32_C(   570441857), -INT32_C(  1836873174),  INT32_C(   681558851) },
+      UINT8_C(157),
+      {  INT32_C(         201),  INT32_C(          14), -INT32_C(          74), -INT32_C(         174),  INT32_C(          81),  INT32_C(         213), -INT32_C(          65),  INT32_C(          87) },
+      {  INT32_C(        1206),  INT32_C(   540249368), -INT32_C(         444), -INT32_C(        1044),  INT32_C(         486), -INT32_C(   570441857), -INT32_C(  1836873174),  INT32_C(         522) } },
+    { {  INT32_C(  1877991391),  INT32_C(        1344), -INT32_C(   596327576), -INT32_C(  1090717974),  INT32_C(  1584810365), -INT32_C(   514336482), -INT32_C(  1900499610),  INT32_C(  1355542965) },
+      UINT8_C(205),
+      { -INT32_C(          79),  INT32_C(          32),  INT32_C(         132),  INT32_C(         227), -INT32_C(          97),  INT32_C(          78), -INT32_C(          98),  INT32_C(          72) },
+      { -INT32_C(         474),  INT32_C(        1344),  INT32_C(         792),  INT32_C(        1362),  INT32_C(  1584810365), -INT32_C(   514336482), -INT32_C(         588),  INT32_C(         432) } },
+    { { -INT32_C(  2009709343),  INT32_C(  1793621652),  INT32_C(  1475870591),  INT32_C(    98657215),  INT32_C(   163283370), -INT32_C(   922593992), -INT32_C(  1541307387),  INT32_C(  1631549854) },
+      UINT8_C( 42),
+      {  INT32_C(         159),  INT32_C(          46), -INT32_C(         103), -INT32_C(         228),  INT32_C(         136),  INT32_C(         245),  INT32_C(         144), -INT32_C(          17) },
+      { -INT32_C(  2009709343),  INT32_C(         276),  INT32_C(  1475870591), -INT32_C(        1368),  INT32_C(   163283370),  INT32_C(        1470), -INT32_C(  1541307387),  INT32_C(  1631549854) } },
+    { { -INT32_C(   353296368), -INT32_C(  1257757066),  INT32_C(  1159591899), -INT32_C(    68222977),  INT32_C(  1322620947), -INT32_C(    16779905),  INT32_C(  1073774592),  INT32_C(  1608490825) },
+      UINT8_C( 80),
+      { -INT32_C(         131),  INT32_C(          36),  INT32_C(         191), -INT32_C(         102),  INT32_C(         198),  INT32_C(          66), -INT32_C(          48),  INT32_C(         144) },
+      { -INT32_C(   353296368), -INT32_C(  1257757066),  INT32_C(  1159591899), -INT32_C(    68222977),  INT32_C(        1188), -INT32_C(    16779905), -INT32_C(         288),  INT32_C(  1608490825) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256i r = simde_mm256_mmask_i32gather_epi32(src, test_vec[i].k, vindex, &(i32_buffer[2048]), 8);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 9187334443733837741), -INT64_C(    4785401021595714), -INT64_C(   20267025109303297),  INT64_C( 1153062242099405057) },
+         UINT8_MAX,
+      { -INT32_C(         260), -INT32_C(         616), -INT32_C(         616),  INT32_C(         632) },
+      { -INT64_C(        279172874305), -INT64_C(        661424963738), -INT64_C(        661424963738),  INT64_C(        678604832926) } },
+    { { -INT64_C( 6999805636882791329),  INT64_C(  446169642855431924),  INT64_C(     282712346870784),  INT64_C( 4773903617818099716) },
+      UINT8_C(114),
+      { -INT32_C(         612), -INT32_C(         244),  INT32_C(         560),  INT32_C(         220) },
+      { -INT64_C( 6999805636882791329), -INT64_C(        261993005117),  INT64_C(     282712346870784),  INT64_C( 4773903617818099716) } },
+    { {  INT64_C(         42987954176),  INT64_C(    6757607190565888),  INT64_C( 2484560590112340337), -INT64_C( 2650321900115453809) },
+      UINT8_C(127),
+      { -INT32_C(         132), -INT32_C(         576),  INT32_C(         836), -INT32_C(         704) },
+      { -INT64_C(        141733920801), -INT64_C(        618475290768),  INT64_C(        897648165073), -INT64_C(        755914244272) } },
+    { {  INT64_C(  587786065675550788),  INT64_C(    4644338191568946),  INT64_C( 6900711605964417287),  INT64_C(  324846312405078016) },
+      UINT8_C(  2),
+      {  INT32_C(         112),  INT32_C(          40), -INT32_C(         704), -INT32_C(         852) },
+      {  INT64_C(  587786065675550788),  INT64_C(         42949672970),  INT64_C( 6900711605964417287),  INT64_C(  324846312405078016) } },
+    { {  INT64_C( 4983538646706451997),  INT64_C(   76578788268868096),  INT64_C( 5002276497883017541),  INT64_C( 5771644637970268168) },
+      UINT8_C(  8),
+      {  INT32_C(         704),  INT32_C(         328),  INT32_C(         864), -INT32_C(         576) },
+      {  INT64_C( 4983538646706451997),  INT64_C(   76578788268868096),  INT64_C( 5002276497883017541), -INT64_C(        618475290768) } },
+    { { -INT64_C(       8796126597123), -INT64_C(       8804976590849),  INT64_C( 6955287681855502205),  INT64_C( 5652479402218894775) },
+      UINT8_C( 13),
+      {  INT32_C(         216),  INT32_C(         816),  INT32_C(         452),  INT32_C(          56) },
+      {  INT64_C(        231928234038), -INT64_C(       8804976590849),  INT64_C(        485331304561),  INT64_C(         60129542158) } },
+    { { -INT64_C(      13469018488881),  INT64_C( 4789746732535530842), -INT64_C(   10142034858935827),  INT64_C( 6714835399799782655) },
+      UINT8_C(  1),
+      {  INT32_C(          32),  INT32_C(         972),  INT32_C(         892),  INT32_C(         420) },
+      {  INT64_C(         34359738376),  INT64_C( 4789746732535530842), -INT64_C(   10142034858935827),  INT64_C( 6714835399799782655) } },
+    { { -INT64_C( 6326379969305408984), -INT64_C( 4931266584216458337), -INT64_C(  779590829214488560),  INT64_C( 5188780229021274370) },
+      UINT8_C( 22),
+      {  INT32_C(          36), -INT32_C(         516), -INT32_C(         212), -INT32_C(         684) },
+      { -INT64_C( 6326379969305408984), -INT64_C(        554050781313), -INT64_C(        227633266741),  INT64_C( 5188780229021274370) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256i r = simde_mm256_mmask_i32gather_epi64(src, test_vec[i].k, vindex, &(i64_buffer[2048]), 2);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -2726.75), SIMDE_FLOAT32_C( -9926.25), SIMDE_FLOAT32_C(  -739.75), SIMDE_FLOAT32_C( -1671.75),
+        SIMDE_FLOAT32_C(  1013.25), SIMDE_FLOAT32_C( -1923.00), SIMDE_FLOAT32_C(  6107.25), SIMDE_FLOAT32_C( -6688.75) },
+         UINT8_MAX,
+      {  INT32_C(          42), -INT32_C(         160), -INT32_C(           9),  INT32_C(         161),  INT32_C(         196), -INT32_C(          79), -INT32_C(          30), -INT32_C(          22) },
+      { SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(   -80.00), SIMDE_FLOAT32_C(    -4.50), SIMDE_FLOAT32_C(    80.50),
+        SIMDE_FLOAT32_C(    98.00), SIMDE_FLOAT32_C(   -39.50), SIMDE_FLOAT32_C(   -15.00), SIMDE_FLOAT32_C(   -11.00) } },
+    { { SIMDE_FLOAT32_C( -8867.25), SIMDE_FLOAT32_C(  7624.25), SIMDE_FLOAT32_C(  4808.00), SIMDE_FLOAT32_C(  1300.50),
+        SIMDE_FLOAT32_C( -5758.25), SIMDE_FLOAT32_C(  9273.50), SIMDE_FLOAT32_C(  -702.50), SIMDE_FLOAT32_C( -2926.25) },
+      UINT8_C(222),
+      {  INT32_C(         147),  INT32_C(           3),  INT32_C(         123),  INT32_C(         220),  INT32_C(          99), -INT32_C(          69),  INT32_C(          72),  INT32_C(          76) },
+      { SIMDE_FLOAT32_C( -8867.25), SIMDE_FLOAT32_C(     1.50), SIMDE_FLOAT32_C(    61.50), SIMDE_FLOAT32_C(   110.00),
+        SIMDE_FLOAT32_C(    49.50), SIMDE_FLOAT32_C(  9273.50), SIMDE_FLOAT32_C(    36.00), SIMDE_FLOAT32_C(    38.00) } },
+    { { SIMDE_FLOAT32_C(  5863.50), SIMDE_FLOAT32_C( -5170.50), SIMDE_FLOAT32_C(  1114.25), SIMDE_FLOAT32_C( -9719.50),
+        SIMDE_FLOAT32_C( -5613.25), SIMDE_FLOAT32_C( -7803.50), SIMDE_FLOAT32_C(  -220.75), SIMDE_FLOAT32_C( -6896.50) },
+      UINT8_C(122),
+      {  INT32_C(         133),  INT32_C(         137), -INT32_C(         219),  INT32_C(          14),  INT32_C(          49), -INT32_C(         140), -INT32_C(         224),  INT32_C(         207) },
+      { SIMDE_FLOAT32_C(  5863.50), SIMDE_FLOAT32_C(    68.50), SIMDE_FLOAT32_C(  1114.25), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(    24.50), SIMDE_FLOAT32_C(   -70.00), SIMDE_FLOAT32_C(  -112.00), SIMDE_FLOAT32_C( -6896.50) } },
+    { { SIMDE_FLOAT32_C(  -520.75), SIMDE_FLOAT32_C( -3182.75), SIMDE_FLOAT32_C( -3094.75), SIMDE_FLOAT32_C(   367.75),
+        SIMDE_FLOAT32_C( -6333.00), SIMDE_FLOAT32_C(  1398.75), SIMDE_FLOAT32_C( -2824.00), SIMDE_FLOAT32_C( -9339.25) },
+      UINT8_C(234),
+      { -INT32_C(          16),  INT32_C(          84), -INT32_C(          98),  INT32_C(         254), -INT32_C(         233), -INT32_C(          89), -INT32_C(           1),  INT32_C(          39) },
+      { SIMDE_FLOAT32_C(  -520.75), SIMDE_FLOAT32_C(    42.00), SIMDE_FLOAT32_C( -3094.75), SIMDE_FLOAT32_C(   127.00),
+        SIMDE_FLOAT32_C( -6333.00), SIMDE_FLOAT32_C(   -44.50), SIMDE_FLOAT32_C(    -0.50), SIMDE_FLOAT32_C(    19.50) } },
+    { { SIMDE_FLOAT32_C( -1117.75), SIMDE_FLOAT32_C(  8735.50), SIMDE_FLOAT32_C( -3517.25), SIMDE_FLOAT32_C( -3678.00),
+        SIMDE_FLOAT32_C(  9740.75), SIMDE_FLOAT32_C( -2876.00), SIMDE_FLOAT32_C(  2108.75), SIMDE_FLOAT32_C(  8435.00) },
+      UINT8_C(108),
+      {  INT32_C(          98), -INT32_C(         134),  INT32_C(          27), -INT32_C(         129), -INT32_C(         245),  INT32_C(          68),  INT32_C(          51),  INT32_C(           9) },
+      { SIMDE_FLOAT32_C( -1117.75), SIMDE_FLOAT32_C(  8735.50), SIMDE_FLOAT32_C(    13.50), SIMDE_FLOAT32_C(   -64.50),
+        SIMDE_FLOAT32_C(  9740.75), SIMDE_FLOAT32_C(    34.00), SIMDE_FLOAT32_C(    25.50), SIMDE_FLOAT32_C(  8435.00) } },
+    { { SIMDE_FLOAT32_C(  4414.75), SIMDE_FLOAT32_C(  6617.50), SIMDE_FLOAT32_C( -4160.25), SIMDE_FLOAT32_C( -4845.75),
+        SIMDE_FLOAT32_C(  -783.00), SIMDE_FLOAT32_C(  1454.00), SIMDE_FLOAT32_C( -4083.50), SIMDE_FLOAT32_C(  9975.50) },
+      UINT8_C(229),
+      { -INT32_C(          85),  INT32_C(         143),  INT32_C(         115), -INT32_C(          31), -INT32_C(         179),  INT32_C(         209),  INT32_C(          59), -INT32_C(         128) },
+      { SIMDE_FLOAT32_C(   -42.50), SIMDE_FLOAT32_C(  6617.50), SIMDE_FLOAT32_C(    57.50), SIMDE_FLOAT32_C( -4845.75),
+        SIMDE_FLOAT32_C(  -783.00), SIMDE_FLOAT32_C(   104.50), SIMDE_FLOAT32_C(    29.50), SIMDE_FLOAT32_C(   -64.00) } },
+    { { SIMDE_FLOAT32_C(   873.75), SIMDE_FLOAT32_C(  5385.25), SIMDE_FLOAT32_C(  1257.50), SIMDE_FLOAT32_C(  8374.75),
+        SIMDE_FLOAT32_C(  9289.00), SIMDE_FLOAT32_C(  2286.00), SIMDE_FLOAT32_C(  3343.75), SIMDE_FLOAT32_C(  1725.50) },
+      UINT8_C(182),
+      { -INT32_C(         157),  INT32_C(          38),  INT32_C(         132), -INT32_C(         192),  INT32_C(          27),  INT32_C(         198), -INT32_C(          40),  INT32_C(         159) },
+      { SIMDE_FLOAT32_C(   873.75), SIMDE_FLOAT32_C(    19.00), SIMDE_FLOAT32_C(    66.00), SIMDE_FLOAT32_C(  8374.75),
+        SIMDE_FLOAT32_C(    13.50), SIMDE_FLOAT32_C(    99.00), SIMDE_FLOAT32_C(  3343.75), SIMDE_FLOAT32_C(    79.50) } },
+    { { SIMDE_FLOAT32_C(  4722.25), SIMDE_FLOAT32_C( -7622.25), SIMDE_FLOAT32_C(  4657.75), SIMDE_FLOAT32_C(  5769.50),
+        SIMDE_FLOAT32_C( -6964.00), SIMDE_FLOAT32_C(  -543.50), SIMDE_FLOAT32_C( -3164.75), SIMDE_FLOAT32_C( -4972.50) },
+      UINT8_C( 45),
+      {  INT32_C(         183),  INT32_C(          80),  INT32_C(          69),  INT32_C(         255), -INT32_C(          95),  INT32_C(          63),  INT32_C(         177),  INT32_C(         154) },
+      { SIMDE_FLOAT32_C(    91.50), SIMDE_FLOAT32_C( -7622.25), SIMDE_FLOAT32_C(    34.50), SIMDE_FLOAT32_C(   127.50),
+        SIMDE_FLOAT32_C( -6964.00), SIMDE_FLOAT32_C(    31.50), SIMDE_FLOAT32_C( -3164.75), SIMDE_FLOAT32_C( -4972.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256 r = simde_mm256_mmask_i32gather_ps(src, test_vec[i].k, vindex, &(f32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -3340.75), SIMDE_FLOAT64_C( -7887.75), SIMDE_FLOAT64_C(  5074.00), SIMDE_FLOAT64_C( -8177.75) },
+         UINT8_MAX,
+      {  INT32_C(         106),  INT32_C(          46), -INT32_C(         386),  INT32_C(         422) },
+      { SIMDE_FLOAT64_C(    13.25), SIMDE_FLOAT64_C(     5.75), SIMDE_FLOAT64_C(   -48.25), SIMDE_FLOAT64_C(    52.75) } },
+    { { SIMDE_FLOAT64_C( -9861.00), SIMDE_FLOAT64_C(   102.75), SIMDE_FLOAT64_C(  7887.00), SIMDE_FLOAT64_C(  3900.50) },
+      UINT8_C( 61),
+      {  INT32_C(         478), -INT32_C(         392),  INT32_C(         450),  INT32_C(         246) },
+      { SIMDE_FLOAT64_C(    59.75), SIMDE_FLOAT64_C(   102.75), SIMDE_FLOAT64_C(    56.25), SIMDE_FLOAT64_C(    30.75) } },
+    { { SIMDE_FLOAT64_C(  9431.25), SIMDE_FLOAT64_C( -8260.25), SIMDE_FLOAT64_C( -6800.75), SIMDE_FLOAT64_C(   -81.75) },
+      UINT8_C(124),
+      {  INT32_C(         154),  INT32_C(         124), -INT32_C(         368), -INT32_C(         492) },
+      { SIMDE_FLOAT64_C(  9431.25), SIMDE_FLOAT64_C( -8260.25), SIMDE_FLOAT64_C(   -46.00), SIMDE_FLOAT64_C(   -61.50) } },
+    { { SIMDE_FLOAT64_C( -9208.25), SIMDE_FLOAT64_C(  8842.50), SIMDE_FLOAT64_C( -5325.00), SIMDE_FLOAT64_C(  1751.25) },
+      UINT8_C( 71),
+      {  INT32_C(         428), -INT32_C(         114),  INT32_C(         118), -INT32_C(          64) },
+      { SIMDE_FLOAT64_C(    53.50), SIMDE_FLOAT64_C(   -14.25), SIMDE_FLOAT64_C(    14.75), SIMDE_FLOAT64_C(  1751.25) } },
+    { { SIMDE_FLOAT64_C( -7006.00), SIMDE_FLOAT64_C(   610.25), SIMDE_FLOAT64_C( -6797.75), SIMDE_FLOAT64_C(  3725.25) },
+      UINT8_C(215),
+      { -INT32_C(         310),  INT32_C(         206),  INT32_C(         312), -INT32_C(         196) },
+      { SIMDE_FLOAT64_C(   -38.75), SIMDE_FLOAT64_C(    25.75), SIMDE_FLOAT64_C(    39.00), SIMDE_FLOAT64_C(  3725.25) } },
+    { { SIMDE_FLOAT64_C( -1345.50), SIMDE_FLOAT64_C( -4897.25), SIMDE_FLOAT64_C(  4438.25), SIMDE_FLOAT64_C(   643.50) },
+      UINT8_C( 10),
+      {  INT32_C(         378),  INT32_C(          40),  INT32_C(          52),  INT32_C(         244) },
+      { SIMDE_FLOAT64_C( -1345.50), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(  4438.25), SIMDE_FLOAT64_C(    30.50) } },
+    { { SIMDE_FLOAT64_C(  3871.00), SIMDE_FLOAT64_C(  1954.00), SIMDE_FLOAT64_C(   641.25), SIMDE_FLOAT64_C(  3908.00) },
+      UINT8_C(103),
+      {  INT32_C(          94), -INT32_C(          64), -INT32_C(          58),  INT32_C(         134) },
+      { SIMDE_FLOAT64_C(    11.75), SIMDE_FLOAT64_C(    -8.00), SIMDE_FLOAT64_C(    -7.25), SIMDE_FLOAT64_C(  3908.00) } },
+    { { SIMDE_FLOAT64_C( -2774.25), SIMDE_FLOAT64_C(  6076.25), SIMDE_FLOAT64_C( -3381.75), SIMDE_FLOAT64_C( -3829.25) },
+      UINT8_C(145),
+      { -INT32_C(         110), -INT32_C(         328), -INT32_C(         210),  INT32_C(         274) },
+      { SIMDE_FLOAT64_C(   -13.75), SIMDE_FLOAT64_C(  6076.25), SIMDE_FLOAT64_C( -3381.75), SIMDE_FLOAT64_C( -3829.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256d r = simde_mm256_mmask_i32gather_pd(src, test_vec[i].k, vindex, &(f64_buffer[2048]), 4);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1970403909), -INT32_C(  1250035644),  INT32_C(     2117632), -INT32_C(  1132502005) },
+         UINT8_MAX,
+      { -INT64_C(                  99),  INT64_C(                  16),  INT64_C(                 241),  INT64_C(                 244) },
+      { -INT32_C(         297),  INT32_C(          48),  INT32_C(         723),  INT32_C(         732) } },
+    { {  INT32_C(  1073742336), -INT32_C(   672360096), -INT32_C(    81956291),  INT32_C(    11554884) },
+      UINT8_C(118),
+      {  INT64_C(                 216),  INT64_C(                 127),  INT64_C(                 104),  INT64_C(                  58) },
+      {  INT32_C(  1073742336),  INT32_C(         381),  INT32_C(         312),  INT32_C(    11554884) } },
+    { { -INT32_C(     2097153),  INT32_C(     6308104),  INT32_C(  1065636733),  INT32_C(       16387) },
+      UINT8_C( 20),
+      { -INT64_C(                  21), -INT64_C(                  61),  INT64_C(                  41), -INT64_C(                  41) },
+      { -INT32_C(     2097153),  INT32_C(     6308104),  INT32_C(         123),  INT32_C(       16387) } },
+    { { -INT32_C(       16513),  INT32_C(  1168962622),  INT32_C(   105249732),  INT32_C(     8392736) },
+      UINT8_C( 46),
+      {  INT64_C(                 234), -INT64_C(                 175),  INT64_C(                 208),  INT64_C(                  85) },
+      { -INT32_C(       16513), -INT32_C(         525),  INT32_C(         624),  INT32_C(         255) } },
+    { { -INT32_C(   134219777),  INT32_C(   541082656), -INT32_C(   263636227),  INT32_C(  1610612735) },
+      UINT8_C(185),
+      { -INT64_C(                 229),  INT64_C(                 202), -INT64_C(                  65),  INT64_C(                  68) },
+      { -INT32_C(         687),  INT32_C(   541082656), -INT32_C(   263636227),  INT32_C(         204) } },
+    { {  INT32_C(  1285459828),  INT32_C(  1751897842),  INT32_C(   380221092),  INT32_C(   117833681) },
+      UINT8_C( 75),
+      { -INT64_C(                 239),  INT64_C(                  37), -INT64_C(                  61), -INT64_C(                 115) },
+      { -INT32_C(         717),  INT32_C(         111),  INT32_C(   380221092), -INT32_C(         345) } },
+    { { -INT32_C(  1277058120),  INT32_C(   128664587), -INT32_C(  1505573593), -INT32_C(  2133703506) },
+      UINT8_C(199),
+      {  INT64_C(                 194), -INT64_C(                  48), -INT64_C(                 163),  INT64_C(                  56) },
+      {  INT32_C(         582), -INT32_C(         144), -INT32_C(         489), -INT32_C(  2133703506) } },
+    { { -INT32_C(   268437507),  INT32_C(   268566528),  INT32_C(     2097284),  INT32_C(   973573123) },
+      UINT8_C( 10),
+      {  INT64_C(                  75), -INT64_C(                 212), -INT64_C(                 249),  INT64_C(                 145) },
+      { -INT32_C(   268437507), -INT32_C(         636),  INT32_C(     2097284),  INT32_C(         435) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128i r = simde_mm256_mmask_i64gather_epi32(src, test_vec[i].k, vindex, &(i32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C(  164417138252055557),  INT64_C( 6505944341017008691),  INT64_C(       2203452440576), -INT64_C( 3030973961037745286) },
+         UINT8_MAX,
+      { -INT64_C(                1936),  INT64_C(                1168),  INT64_C(                 624), -INT64_C(                  32) },
+      { -INT64_C(       1039382085874),  INT64_C(        627065225362),  INT64_C(        335007449166), -INT64_C(         17179869188) } },
+    { {  INT64_C( 4369637757913313434),  INT64_C(  148689156448454656),  INT64_C( 4103215965776402288), -INT64_C( 8104530145768020072) },
+      UINT8_C( 14),
+      {  INT64_C(                 632),  INT64_C(                 504),  INT64_C(                 760),  INT64_C(                 208) },
+      {  INT64_C( 4369637757913313434),  INT64_C(        270582939711),  INT64_C(        408021893215),  INT64_C(        111669149722) } },
+    { {  INT64_C( 8620973816410731234),  INT64_C(    1171254761488384),  INT64_C(  278103016343256983), -INT64_C(  577657021323559490) },
+      UINT8_C(152),
+      {  INT64_C(                 848),  INT64_C(                 344),  INT64_C(                1280), -INT64_C(                 360) },
+      {  INT64_C( 8620973816410731234),  INT64_C(    1171254761488384),  INT64_C(  278103016343256983), -INT64_C(        193273528365) } },
+    { {  INT64_C( 2305843009213693952),  INT64_C( 4383722486791422847),  INT64_C(  433506665690579016), -INT64_C(        137472507979) },
+      UINT8_C(186),
+      {  INT64_C(                 432),  INT64_C(                 112),  INT64_C(                 280),  INT64_C(                 480) },
+      {  INT64_C( 2305843009213693952),  INT64_C(         60129542158),  INT64_C(  433506665690579016),  INT64_C(        257698037820) } },
+    { {  INT64_C(  298416322908391425),  INT64_C( 4652218415073738752),  INT64_C( 8857650544020512448),  INT64_C( 3356056498292022656) },
+      UINT8_C( 62),
+      { -INT64_C(                 960), -INT64_C(                 904), -INT64_C(                 520), -INT64_C(                1336) },
+      {  INT64_C(  298416322908391425), -INT64_C(        485331304561), -INT64_C(        279172874305), -INT64_C(        717259538599) } },
+    { {  INT64_C( 4517108624497304683),  INT64_C( 9205355374875493295), -INT64_C( 9213503375185163795),  INT64_C( 2858377828579936140) },
+      UINT8_C( 91),
+      {  INT64_C(                  24),  INT64_C(                1504),  INT64_C(                1328),  INT64_C(                 688) },
+      {  INT64_C(         12884901891),  INT64_C(        807453851836), -INT64_C( 9213503375185163795),  INT64_C(        369367187542) } },
+    { { -INT64_C( 6147164827895113002), -INT64_C(   27091975106888193), -INT64_C(           135301122),  INT64_C( 4629985190448489088) },
+      UINT8_C( 35),
+      { -INT64_C(                1408), -INT64_C(                 232), -INT64_C(                1584), -INT64_C(                1264) },
+      { -INT64_C(        755914244272), -INT64_C(        124554051613), -INT64_C(           135301122),  INT64_C( 4629985190448489088) } },
+    { {  INT64_C( 9028250556485586719), -INT64_C( 4550699351471531394), -INT64_C( 4756082973537732609),  INT64_C(  669276224001469777) },
+      UINT8_C(228),
+      { -INT64_C(                1320),  INT64_C(                 264), -INT64_C(                1280),  INT64_C(                1576) },
+      {  INT64_C( 9028250556485586719), -INT64_C( 4550699351471531394), -INT64_C(        687194767520),  INT64_C(  669276224001469777) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256i r = simde_mm256_mmask_i64gather_epi64(src, test_vec[i].k, vindex, &(i64_buffer[2048]), 1);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  4768.75), SIMDE_FLOAT32_C( -2043.00), SIMDE_FLOAT32_C( -7877.75), SIMDE_FLOAT32_C(  8028.75) },
+         UINT8_MAX,
+      { -INT64_C(                  81),  INT64_C(                  56), -INT64_C(                  26), -INT64_C(                  90) },
+      { SIMDE_FLOAT32_C(   -81.00), SIMDE_FLOAT32_C(    56.00), SIMDE_FLOAT32_C(   -26.00), SIMDE_FLOAT32_C(   -90.00) } },
+    { { SIMDE_FLOAT32_C(  8639.50), SIMDE_FLOAT32_C(  8865.25), SIMDE_FLOAT32_C(  3086.75), SIMDE_FLOAT32_C( -3947.50) },
+      UINT8_C( 59),
+      { -INT64_C(                  87), -INT64_C(                 207), -INT64_C(                 120),  INT64_C(                 127) },
+      { SIMDE_FLOAT32_C(   -87.00), SIMDE_FLOAT32_C(  -207.00), SIMDE_FLOAT32_C(  3086.75), SIMDE_FLOAT32_C(   127.00) } },
+    { { SIMDE_FLOAT32_C(  8385.25), SIMDE_FLOAT32_C(  6971.00), SIMDE_FLOAT32_C(  -215.50), SIMDE_FLOAT32_C(  9808.25) },
+      UINT8_C(149),
+      {  INT64_C(                  18),  INT64_C(                  34), -INT64_C(                 223),  INT64_C(                 110) },
+      { SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(  6971.00), SIMDE_FLOAT32_C(  -223.00), SIMDE_FLOAT32_C(  9808.25) } },
+    { { SIMDE_FLOAT32_C( -1987.00), SIMDE_FLOAT32_C(  5346.75), SIMDE_FLOAT32_C(  9086.25), SIMDE_FLOAT32_C( -4552.00) },
+      UINT8_C( 58),
+      {  INT64_C(                 206),  INT64_C(                 124), -INT64_C(                 234), -INT64_C(                 125) },
+      { SIMDE_FLOAT32_C( -1987.00), SIMDE_FLOAT32_C(   124.00), SIMDE_FLOAT32_C(  9086.25), SIMDE_FLOAT32_C(  -125.00) } },
+    { { SIMDE_FLOAT32_C( -5807.50), SIMDE_FLOAT32_C( -3874.50), SIMDE_FLOAT32_C(  9268.75), SIMDE_FLOAT32_C(  8756.75) },
+      UINT8_C( 56),
+      {  INT64_C(                 158), -INT64_C(                  68),  INT64_C(                  84), -INT64_C(                  62) },
+      { SIMDE_FLOAT32_C( -5807.50), SIMDE_FLOAT32_C( -3874.50), SIMDE_FLOAT32_C(  9268.75), SIMDE_FLOAT32_C(   -62.00) } },
+    { { SIMDE_FLOAT32_C(  4986.00), SIMDE_FLOAT32_C(  7914.25), SIMDE_FLOAT32_C(  2494.25), SIMDE_FLOAT32_C(  6836.75) },
+      UINT8_C(155),
+      { -INT64_C(                 204),  INT64_C(                 230),  INT64_C(                 171),  INT64_C(                 148) },
+      { SIMDE_FLOAT32_C(  -204.00), SIMDE_FLOAT32_C(   230.00), SIMDE_FLOAT32_C(  2494.25), SIMDE_FLOAT32_C(   148.00) } },
+    { { SIMDE_FLOAT32_C( -9069.50), SIMDE_FLOAT32_C( -5933.00), SIMDE_FLOAT32_C(  8214.00), SIMDE_FLOAT32_C( -2608.50) },
+      UINT8_C(219),
+      { -INT64_C(                 138), -INT64_C(                 150),  INT64_C(                 135),  INT64_C(                 224) },
+      { SIMDE_FLOAT32_C(  -138.00), SIMDE_FLOAT32_C(  -150.00), SIMDE_FLOAT32_C(  8214.00), SIMDE_FLOAT32_C(   224.00) } },
+    { { SIMDE_FLOAT32_C(  5057.00), SIMDE_FLOAT32_C(  -635.25), SIMDE_FLOAT32_C( -2418.00), SIMDE_FLOAT32_C(  2823.25) },
+      UINT8_C( 62),
+      {  INT64_C(                 222),  INT64_C(                  84),  INT64_C(                 231), -INT64_C(                 117) },
+      { SIMDE_FLOAT32_C(  5057.00), SIMDE_FLOAT32_C(    84.00), SIMDE_FLOAT32_C(   231.00), SIMDE_FLOAT32_C(  -117.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128 r = simde_mm256_mmask_i64gather_ps(src, test_vec[i].k, vindex, &(f32_buffer[2048]), 8);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -498.75), SIMDE_FLOAT64_C(  4462.25), SIMDE_FLOAT64_C(  9514.75), SIMDE_FLOAT64_C(  1417.25) },
+         UINT8_MAX,
+      { -INT64_C(                 400),  INT64_C(                 988), -INT64_C(                 352),  INT64_C(                 120) },
+      { SIMDE_FLOAT64_C(   -25.00), SIMDE_FLOAT64_C(    61.75), SIMDE_FLOAT64_C(   -22.00), SIMDE_FLOAT64_C(     7.50) } },
+    { { SIMDE_FLOAT64_C( -2142.50), SIMDE_FLOAT64_C(  8515.25), SIMDE_FLOAT64_C( -2038.00), SIMDE_FLOAT64_C( -4529.75) },
+      UINT8_C(249),
+      {  INT64_C(                 768), -INT64_C(                 824), -INT64_C(                 440),  INT64_C(                 184) },
+      { SIMDE_FLOAT64_C(    48.00), SIMDE_FLOAT64_C(  8515.25), SIMDE_FLOAT64_C( -2038.00), SIMDE_FLOAT64_C(    11.50) } },
+    { { SIMDE_FLOAT64_C(  3791.25), SIMDE_FLOAT64_C(  9511.25), SIMDE_FLOAT64_C(  9312.25), SIMDE_FLOAT64_C( -8726.50) },
+      UINT8_C(225),
+      { -INT64_C(                 492),  INT64_C(                 264), -INT64_C(                 828),  INT64_C(                 512) },
+      { SIMDE_FLOAT64_C(   -30.75), SIMDE_FLOAT64_C(  9511.25), SIMDE_FLOAT64_C(  9312.25), SIMDE_FLOAT64_C( -8726.50) } },
+    { { SIMDE_FLOAT64_C( -4498.25), SIMDE_FLOAT64_C( -6257.25), SIMDE_FLOAT64_C( -7138.00), SIMDE_FLOAT64_C( -8450.25) },
+      UINT8_C( 92),
+      {  INT64_C(                 612), -INT64_C(                 764), -INT64_C(                 880),  INT64_C(                 356) },
+      { SIMDE_FLOAT64_C( -4498.25), SIMDE_FLOAT64_C( -6257.25), SIMDE_FLOAT64_C(   -55.00), SIMDE_FLOAT64_C(    22.25) } },
+    { { SIMDE_FLOAT64_C(  2845.25), SIMDE_FLOAT64_C(  4960.25), SIMDE_FLOAT64_C(  6407.00), SIMDE_FLOAT64_C(  8321.25) },
+      UINT8_C(253),
+      {  INT64_C(                1020), -INT64_C(                 828), -INT64_C(                 216), -INT64_C(                 948) },
+      { SIMDE_FLOAT64_C(    63.75), SIMDE_FLOAT64_C(  4960.25), SIMDE_FLOAT64_C(   -13.50), SIMDE_FLOAT64_C(   -59.25) } },
+    { { SIMDE_FLOAT64_C( -3534.25), SIMDE_FLOAT64_C(  1592.25), SIMDE_FLOAT64_C(  7530.00), SIMDE_FLOAT64_C(   186.00) },
+      UINT8_C(154),
+      { -INT64_C(                 428), -INT64_C(                 484),  INT64_C(                 884),  INT64_C(                 948) },
+      { SIMDE_FLOAT64_C( -3534.25), SIMDE_FLOAT64_C(   -30.25), SIMDE_FLOAT64_C(  7530.00), SIMDE_FLOAT64_C(    59.25) } },
+    { { SIMDE_FLOAT64_C(  9717.25), SIMDE_FLOAT64_C( -2770.50), SIMDE_FLOAT64_C(   916.25), SIMDE_FLOAT64_C( -2256.25) },
+      UINT8_C(191),
+      { -INT64_C(                 756), -INT64_C(                 984), -INT64_C(                 964),  INT64_C(                 892) },
+      { SIMDE_FLOAT64_C(   -47.25), SIMDE_FLOAT64_C(   -61.50), SIMDE_FLOAT64_C(   -60.25), SIMDE_FLOAT64_C(    55.75) } },
+    { { SIMDE_FLOAT64_C(  4885.25), SIMDE_FLOAT64_C( -1363.75), SIMDE_FLOAT64_C( -6166.50), SIMDE_FLOAT64_C( -7648.25) },
+      UINT8_C(251),
+      { -INT64_C(                 856),  INT64_C(                1012),  INT64_C(                 304), -INT64_C(                 272) },
+      { SIMDE_FLOAT64_C(   -53.50), SIMDE_FLOAT64_C(    63.25), SIMDE_FLOAT64_C( -6166.50), SIMDE_FLOAT64_C(   -17.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256d r = simde_mm256_mmask_i64gather_pd(src, test_vec[i].k, vindex, &(f64_buffer[2048]), 2);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(          99), -INT32_C(          85), -INT32_C(         244), -INT32_C(          30),  INT32_C(         239), -INT32_C(          91),  INT32_C(         118),  INT32_C(          90),
+        -INT32_C(          30),  INT32_C(         253),  INT32_C(          58), -INT32_C(         227), -INT32_C(          13), -INT32_C(         111),  INT32_C(           5), -INT32_C(         107) },
+      {  INT32_C(         297), -INT32_C(         255), -INT32_C(         732), -INT32_C(          90),  INT32_C(         717), -INT32_C(         273),  INT32_C(         354),  INT32_C(         270),
+        -INT32_C(          90),  INT32_C(         759),  INT32_C(         174), -INT32_C(         681), -INT32_C(          39), -INT32_C(         333),  INT32_C(          15), -INT32_C(         321) } },
+    { {  INT32_C(         248),  INT32_C(          71), -INT32_C(          86), -INT32_C(          40), -INT32_C(         125), -INT32_C(         151), -INT32_C(          47),  INT32_C(         155),
+        -INT32_C(          20),  INT32_C(          98), -INT32_C(          80),  INT32_C(          73), -INT32_C(          69),  INT32_C(         235), -INT32_C(         222), -INT32_C(          39) },
+      {  INT32_C(         744),  INT32_C(         213), -INT32_C(         258), -INT32_C(         120), -INT32_C(         375), -INT32_C(         453), -INT32_C(         141),  INT32_C(         465),
+        -INT32_C(          60),  INT32_C(         294), -INT32_C(         240),  INT32_C(         219), -INT32_C(         207),  INT32_C(         705), -INT32_C(         666), -INT32_C(         117) } },
+    { { -INT32_C(         128), -INT32_C(         247),  INT32_C(          56),  INT32_C(         205), -INT32_C(         237),  INT32_C(         166),  INT32_C(         113),  INT32_C(         180),
+        -INT32_C(         233), -INT32_C(          91),  INT32_C(         135), -INT32_C(         107), -INT32_C(         233), -INT32_C(         230), -INT32_C(          62),  INT32_C(          27) },
+      { -INT32_C(         384), -INT32_C(         741),  INT32_C(         168),  INT32_C(         615), -INT32_C(         711),  INT32_C(         498),  INT32_C(         339),  INT32_C(         540),
+        -INT32_C(         699), -INT32_C(         273),  INT32_C(         405), -INT32_C(         321), -INT32_C(         699), -INT32_C(         690), -INT32_C(         186),  INT32_C(          81) } },
+    { {  INT32_C(         119),  INT32_C(         243),  INT32_C(          39), -INT32_C(         126),  INT32_C(         208), -INT32_C(         201), -INT32_C(         106), -INT32_C(         225),
+         INT32_C(          93), -INT32_C(         244),  INT32_C(          40), -INT32_C(         202),  INT32_C(         129), -INT32_C(         144),  INT32_C(         184),  INT32_C(         202) },
+      {  INT32_C(         357),  INT32_C(         729),  INT32_C(         117), -INT32_C(         378),  INT32_C(         624), -INT32_C(         603), -INT32_C(         318), -INT32_C(         675),
+         INT32_C(         279), -INT32_C(         732),  INT32_C(         120), -INT32_C(         606),  INT32_C(         387), -INT32_C(         432),  INT32_C(         552),  INT32_C(         606) } },
+    { {  INT32_C(         247), -INT32_C(         219), -INT32_C(         243), -INT32_C(         217),  INT32_C(          42),  INT32_C(           4),  INT32_C(           9), -INT32_C(          23),
+         INT32_C(          73), -INT32_C(         222),  INT32_C(         151),  INT32_C(         205),  INT32_C(         108), -INT32_C(         123),  INT32_C(         189), -INT32_C(         129) },
+      {  INT32_C(         741), -INT32_C(         657), -INT32_C(         729), -INT32_C(         651),  INT32_C(         126),  INT32_C(          12),  INT32_C(          27), -INT32_C(          69),
+         INT32_C(         219), -INT32_C(         666),  INT32_C(         453),  INT32_C(         615),  INT32_C(         324), -INT32_C(         369),  INT32_C(         567), -INT32_C(         387) } },
+    { { -INT32_C(         182), -INT32_C(         251),  INT32_C(         105), -INT32_C(          56), -INT32_C(          56),  INT32_C(          44), -INT32_C(          46), -INT32_C(          79),
+         INT32_C(         196),  INT32_C(         196),  INT32_C(         254), -INT32_C(         224), -INT32_C(         133), -INT32_C(          26), -INT32_C(         198),  INT32_C(         209) },
+      { -INT32_C(         546), -INT32_C(         753),  INT32_C(         315), -INT32_C(         168), -INT32_C(         168),  INT32_C(         132), -INT32_C(         138), -INT32_C(         237),
+         INT32_C(         588),  INT32_C(         588),  INT32_C(         762), -INT32_C(         672), -INT32_C(         399), -INT32_C(          78), -INT32_C(         594),  INT32_C(         627) } },
+    { { -INT32_C(         165), -INT32_C(          31),  INT32_C(         145), -INT32_C(         192),  INT32_C(         255), -INT32_C(         103),  INT32_C(         233), -INT32_C(          62),
+        -INT32_C(         202),  INT32_C(         249), -INT32_C(         138),  INT32_C(         218), -INT32_C(          82), -INT32_C(         204), -INT32_C(         245), -INT32_C(          63) },
+      { -INT32_C(         495), -INT32_C(          93),  INT32_C(         435), -INT32_C(         576),  INT32_C(         765), -INT32_C(         309),  INT32_C(         699), -INT32_C(         186),
+        -INT32_C(         606),  INT32_C(         747), -INT32_C(         414),  INT32_C(         654), -INT32_C(         246), -INT32_C(         612), -INT32_C(         735), -INT32_C(         189) } },
+    { { -INT32_C(          42), -INT32_C(         161), -INT32_C(         128),  INT32_C(         181),  INT32_C(         197),  INT32_C(         208), -INT32_C(          10),  INT32_C(         252),
+        -INT32_C(          48),  INT32_C(         218), -INT32_C(         161), -INT32_C(          89), -INT32_C(          28), -INT32_C(         237), -INT32_C(         209),  INT32_C(         103) },
+      { -INT32_C(         126), -INT32_C(         483), -INT32_C(         384),  INT32_C(         543),  INT32_C(         591),  INT32_C(         624), -INT32_C(          30),  INT32_C(         756),
+        -INT32_C(         144),  INT32_C(         654), -INT32_C(         483), -INT32_C(         267), -INT32_C(          84), -INT32_C(         711), -INT32_C(         627),  INT32_C(         309) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i32gather_epi32(vindex, &(i32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   623210091), -INT32_C(   134234155),  INT32_C(  1685768562),  INT32_C(   677944672), -INT32_C(  1375764499), -INT32_C(   537989145),  INT32_C(   189721776), -INT32_C(   402785284),
+        -INT32_C(  1132470289),  INT32_C(    10485777),  INT32_C(  1628438658),  INT32_C(  1649062145), -INT32_C(  1207959553), -INT32_C(     1277961),  INT32_C(   786825342),  INT32_C(  2130509823) },
+           UINT16_MAX,
+      {  INT32_C(          57), -INT32_C(         196), -INT32_C(         203), -INT32_C(         165),  INT32_C(         240), -INT32_C(         236), -INT32_C(         180),  INT32_C(         183),
+         INT32_C(         171), -INT32_C(          87),  INT32_C(          50), -INT32_C(         228),  INT32_C(         227),  INT32_C(          82),  INT32_C(          53),  INT32_C(         184) },
+      {  INT32_C(         171), -INT32_C(         588), -INT32_C(         609), -INT32_C(         495),  INT32_C(         720), -INT32_C(         708), -INT32_C(         540),  INT32_C(         549),
+         INT32_C(         513), -INT32_C(         261),  INT32_C(         150), -INT32_C(         684),  INT32_C(         681),  INT32_C(         246),  INT32_C(         159),  INT32_C(         552) } },
+    { { -INT32_C(          61), -INT32_C(   270682113),  INT32_C(  1856261503), -INT32_C(  1720091957), -INT32_C(           1), -INT32_C(     8390689), -INT32_C(  1877995520), -INT32_C(   874217710),
+         INT32_C(    88754807), -INT32_C(        8209), -INT32_C(  1084753925),  INT32_C(     1058372),  INT32_C(   722242166),  INT32_C(        1026),  INT32_C(           3),  INT32_C(  1145176080) },
+      UINT16_C(35794),
+      { -INT32_C(         222), -INT32_C(         191), -INT32_C(           2), -INT32_C(         202), -INT32_C(         237), -INT32_C(          16), -INT32_C(         224), -INT32_C(         115),
+        -INT32_C(         215),  INT32_C(         197),  INT32_C(         230), -INT32_C(         147), -INT32_C(         250),  INT32_C(          27),  INT32_C(          86), -INT32_C(          40) },
+      { -INT32_C(          61), -INT32_C(         573),  INT32_C(  1856261503), -INT32_C(  1720091957), -INT32_C(         711), -INT32_C(     8390689), -INT32_C(         672), -INT32_C(         345),
+        -INT32_C(         645),  INT32_C(         591), -INT32_C(  1084753925), -INT32_C(         441),  INT32_C(   722242166),  INT32_C(        1026),  INT32_C(           3), -INT32_C(         120) } },
+    { {  INT32_C(      524736), -INT32_C(   269582401),  INT32_C(   873204932),  INT32_C(  1543719047),  INT32_C(   928125506),  INT32_C(  1141964800), -INT32_C(        8200), -INT32_C(    17047553),
+        -INT32_C(   111215537),  INT32_C(   545524770), -INT32_C(    37748737),  INT32_C(   167772176), -INT32_C(   970860029),  INT32_C(  1544410673), -INT32_C(  1815784909), -INT32_C(  1277123817) },
+      UINT16_C(29784),
+      {  INT32_C(         118),  INT32_C(         157), -INT32_C(          64),  INT32_C(         246), -INT32_C(         158),  INT32_C(         219),  INT32_C(         166), -INT32_C(          21),
+         INT32_C(         149), -INT32_C(           1),  INT32_C(          97), -INT32_C(         113), -INT32_C(         141), -INT32_C(         245),  INT32_C(         102), -INT32_C(         230) },
+      {  INT32_C(      524736), -INT32_C(   269582401),  INT32_C(   873204932),  INT32_C(         738), -INT32_C(         474),  INT32_C(  1141964800),  INT32_C(         498), -INT32_C(    17047553),
+        -INT32_C(   111215537),  INT32_C(   545524770),  INT32_C(         291),  INT32_C(   167772176), -INT32_C(         423), -INT32_C(         735),  INT32_C(         306), -INT32_C(  1277123817) } },
+    { { -INT32_C(      150722), -INT32_C(          67),  INT32_C(  1288905553), -INT32_C(   687865905), -INT32_C(   742027392), -INT32_C(   673448961),  INT32_C(  2139095023), -INT32_C(  1460036635),
+        -INT32_C(  1091023283),  INT32_C(      707072),  INT32_C(  1256454246), -INT32_C(  1794506616),  INT32_C(    67108864), -INT32_C(  2092740602), -INT32_C(  1865242958), -INT32_C(  1077937825) },
+      UINT16_C(12677),
+      {  INT32_C(         229),  INT32_C(          23),  INT32_C(         166),  INT32_C(          30),  INT32_C(         111),  INT32_C(          79),  INT32_C(         215),  INT32_C(         231),
+         INT32_C(          30), -INT32_C(         201), -INT32_C(          13),  INT32_C(         238), -INT32_C(          34), -INT32_C(          74), -INT32_C(         205),  INT32_C(         106) },
+      {  INT32_C(         687), -INT32_C(          67),  INT32_C(         498), -INT32_C(   687865905), -INT32_C(   742027392), -INT32_C(   673448961),  INT32_C(  2139095023),  INT32_C(         693),
+         INT32_C(          90),  INT32_C(      707072),  INT32_C(  1256454246), -INT32_C(  1794506616), -INT32_C(         102), -INT32_C(         222), -INT32_C(  1865242958), -INT32_C(  1077937825) } },
+    { {  INT32_C(   536870929),  INT32_C(   191369246),  INT32_C(   869636804),  INT32_C(  1225860687), -INT32_C(  1526321220),  INT32_C(   486539266),  INT32_C(   109580320),  INT32_C(  1864228727),
+        -INT32_C(        4097), -INT32_C(           1), -INT32_C(      131075), -INT32_C(   670941184), -INT32_C(    67111497), -INT32_C(     2359301), -INT32_C(  2128347072), -INT32_C(    50335747) },
+      UINT16_C(16828),
+      {  INT32_C(          60),  INT32_C(          81), -INT32_C(         223), -INT32_C(         248),  INT32_C(         233), -INT32_C(         234),  INT32_C(         160), -INT32_C(         151),
+        -INT32_C(         200),  INT32_C(         185), -INT32_C(         250), -INT32_C(          28),  INT32_C(         193),  INT32_C(         164), -INT32_C(         205),  INT32_C(          85) },
+      {  INT32_C(   536870929),  INT32_C(   191369246), -INT32_C(         669), -INT32_C(         744),  INT32_C(         699), -INT32_C(         702),  INT32_C(   109580320), -INT32_C(         453),
+        -INT32_C(         600), -INT32_C(           1), -INT32_C(      131075), -INT32_C(   670941184), -INT32_C(    67111497), -INT32_C(     2359301), -INT32_C(         615), -INT32_C(    50335747) } },
+    { {  INT32_C(   773186260),  INT32_C(    17858564), -INT32_C(   168821765),  INT32_C(  1074003976), -INT32_C(   419456021), -INT32_C(  1186772442),  INT32_C(       73728),  INT32_C(  1105385325),
+         INT32_C(  1076037792), -INT32_C(   799821006), -INT32_C(   960092623), -INT32_C(  1045274048),  INT32_C(   143398916),  INT32_C(   134234129),  INT32_C(  1386063635),  INT32_C(  1589123846) },
+      UINT16_C(14080),
+      { -INT32_C(         227),  INT32_C(         131), -INT32_C(         201),  INT32_C(          23), -INT32_C(         123),  INT32_C(          16), -INT32_C(         151),  INT32_C(         252),
+         INT32_C(         171), -INT32_C(         128), -INT32_C(          36), -INT32_C(          99), -INT32_C(         241),  INT32_C(          14), -INT32_C(         244),  INT32_C(          84) },
+      {  INT32_C(   773186260),  INT32_C(    17858564), -INT32_C(   168821765),  INT32_C(  1074003976), -INT32_C(   419456021), -INT32_C(  1186772442),  INT32_C(       73728),  INT32_C(  1105385325),
+         INT32_C(         513), -INT32_C(         384), -INT32_C(         108), -INT32_C(  1045274048), -INT32_C(         723),  INT32_C(          42),  INT32_C(  1386063635),  INT32_C(  1589123846) } },
+    { {  INT32_C(  2120744575),  INT32_C(           0),  INT32_C(  2085889044), -INT32_C(  1073971265), -INT32_C(   910944134), -INT32_C(  1539358131), -INT32_C(    75402048), -INT32_C(    83903513),
+         INT32_C(  1073774592),  INT32_C(   269862530),  INT32_C(   588743171),  INT32_C(   276825088),  INT32_C(     5243904),  INT32_C(    33620448),  INT32_C(  1602329712), -INT32_C(  1406448792) },
+      UINT16_C(11988),
+      {  INT32_C(         205), -INT32_C(         221),  INT32_C(          84),  INT32_C(          95),  INT32_C(           2), -INT32_C(         149),  INT32_C(         240), -INT32_C(         196),
+         INT32_C(          98), -INT32_C(         179), -INT32_C(         210),  INT32_C(         146), -INT32_C(          19),  INT32_C(         155),  INT32_C(         197),  INT32_C(         250) },
+      {  INT32_C(  2120744575),  INT32_C(           0),  INT32_C(         252), -INT32_C(  1073971265),  INT32_C(           6), -INT32_C(  1539358131),  INT32_C(         720), -INT32_C(         588),
+         INT32_C(  1073774592), -INT32_C(         537), -INT32_C(         630),  INT32_C(         438),  INT32_C(     5243904),  INT32_C(         465),  INT32_C(  1602329712), -INT32_C(  1406448792) } },
+    { {  INT32_C(  1212568879),  INT32_C(  1849562877),  INT32_C(   736904271), -INT32_C(  1865767978),  INT32_C(   611477506), -INT32_C(   537919489), -INT32_C(    17301521),  INT32_C(   134236193),
+         INT32_C(   127586525),  INT32_C(     8396864),  INT32_C(   142674016),  INT32_C(     2363392),  INT32_C(    73557121),  INT32_C(       32768), -INT32_C(  1890777906), -INT32_C(    34045969) },
+      UINT16_C(32669),
+      {  INT32_C(         191), -INT32_C(          75),  INT32_C(          69),  INT32_C(          79),  INT32_C(         205),  INT32_C(         250), -INT32_C(         126),  INT32_C(         241),
+        -INT32_C(         118), -INT32_C(          28),  INT32_C(         166),  INT32_C(         106),  INT32_C(          56),  INT32_C(         156), -INT32_C(          90), -INT32_C(          82) },
+      {  INT32_C(         573),  INT32_C(  1849562877),  INT32_C(         207),  INT32_C(         237),  INT32_C(         615), -INT32_C(   537919489), -INT32_C(    17301521),  INT32_C(         723),
+        -INT32_C(         354), -INT32_C(          84),  INT32_C(         498),  INT32_C(         318),  INT32_C(         168),  INT32_C(         468), -INT32_C(         270), -INT32_C(    34045969) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i32gather_epi32(src, test_vec[i].k, vindex, &(i32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(         209), -INT32_C(         231), -INT32_C(          83), -INT32_C(         143),  INT32_C(         190), -INT32_C(         253), -INT32_C(         195),  INT32_C(         218) },
+      {  INT64_C(        897648165073), -INT64_C(        992137445607), -INT64_C(        356482285651), -INT64_C(        614180323471),
+         INT64_C(        816043786430), -INT64_C(       1086626726141), -INT64_C(        837518622915),  INT64_C(        936302870746) } },
+    { { -INT32_C(          94), -INT32_C(         187),  INT32_C(         221), -INT32_C(         193),  INT32_C(         129),  INT32_C(         169),  INT32_C(         247),  INT32_C(         210) },
+      { -INT64_C(        403726925918), -INT64_C(        803158884539),  INT64_C(        949187772637), -INT64_C(        828928688321),
+         INT64_C(        554050781313),  INT64_C(        725849473193),  INT64_C(       1060856922359),  INT64_C(        901943132370) } },
+    { {  INT32_C(         252),  INT32_C(          32), -INT32_C(           4),  INT32_C(           4), -INT32_C(          29), -INT32_C(         236), -INT32_C(         159),  INT32_C(         184) },
+      {  INT64_C(       1082331758844),  INT64_C(        137438953504), -INT64_C(         17179869188),  INT64_C(         17179869188),
+        -INT64_C(        124554051613), -INT64_C(       1013612282092), -INT64_C(        682899800223),  INT64_C(        790273982648) } },
+    { { -INT32_C(          89),  INT32_C(         107),  INT32_C(         249), -INT32_C(         225), -INT32_C(          24), -INT32_C(          81),  INT32_C(         205),  INT32_C(          71) },
+      { -INT64_C(        382252089433),  INT64_C(        459561500779),  INT64_C(       1069446856953), -INT64_C(        966367641825),
+        -INT64_C(        103079215128), -INT64_C(        347892351057),  INT64_C(        880468295885),  INT64_C(        304942678087) } },
+    { {  INT32_C(          91),  INT32_C(          20), -INT32_C(          16),  INT32_C(         235), -INT32_C(           1),  INT32_C(          36),  INT32_C(          79), -INT32_C(         250) },
+      {  INT64_C(        390842024027),  INT64_C(         85899345940), -INT64_C(         68719476752),  INT64_C(       1009317314795),
+        -INT64_C(          4294967297),  INT64_C(        154618822692),  INT64_C(        339302416463), -INT64_C(       1073741824250) } },
+    { { -INT32_C(           5), -INT32_C(          43),  INT32_C(         141),  INT32_C(          27),  INT32_C(         160),  INT32_C(         149),  INT32_C(         201),  INT32_C(         204) },
+      { -INT64_C(         21474836485), -INT64_C(        184683593771),  INT64_C(        605590388877),  INT64_C(        115964117019),
+         INT64_C(        687194767520),  INT64_C(        639950127253),  INT64_C(        863288426697),  INT64_C(        876173328588) } },
+    { {  INT32_C(         168),  INT32_C(          57), -INT32_C(         211), -INT32_C(         150), -INT32_C(           1), -INT32_C(          13), -INT32_C(         163),  INT32_C(         112) },
+      {  INT64_C(        721554505896),  INT64_C(        244813135929), -INT64_C(        906238099667), -INT64_C(        644245094550),
+        -INT64_C(          4294967297), -INT64_C(         55834574861), -INT64_C(        700079669411),  INT64_C(        481036337264) } },
+    { { -INT32_C(         236),  INT32_C(          58),  INT32_C(         166),  INT32_C(         227), -INT32_C(         206),  INT32_C(          30),  INT32_C(         214),  INT32_C(          50) },
+      { -INT64_C(       1013612282092),  INT64_C(        249108103226),  INT64_C(        712964571302),  INT64_C(        974957576419),
+        -INT64_C(        884763263182),  INT64_C(        128849018910),  INT64_C(        919123001558),  INT64_C(        214748364850) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i32gather_epi64(vindex, &(i64_buffer[2048]), 8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(    2429963648114688), -INT64_C( 8193796494714439541),  INT64_C(   19140455207867008),  INT64_C(  908635513813624184),
+         INT64_C( 1017840187683635746), -INT64_C(  324830919217119241),  INT64_C( 2305886989691921488), -INT64_C( 8450943980583708050) },
+         UINT8_MAX,
+      {  INT32_C(        1856),  INT32_C(        1008), -INT32_C(         960),  INT32_C(          48), -INT32_C(        1584), -INT32_C(         256),  INT32_C(        1256),  INT32_C(         760) },
+      {  INT64_C(        996432412904),  INT64_C(        541165879422), -INT64_C(        515396075640),  INT64_C(         25769803782),
+        -INT64_C(        850403524806), -INT64_C(        137438953504),  INT64_C(        674309865629),  INT64_C(        408021893215) } },
+    { {  INT64_C( 1153255795018695696), -INT64_C( 6899373889426554368),  INT64_C(    9150135766355968), -INT64_C( 2964473590340961930),
+        -INT64_C( 4540419033455125638), -INT64_C( 7956066913123498043),  INT64_C(    4647979248005121), -INT64_C( 2435549769583291509) },
+      UINT8_C( 24),
+      {  INT32_C(         416), -INT32_C(         288),  INT32_C(        1632), -INT32_C(         168),  INT32_C(         952),  INT32_C(        1880),  INT32_C(         152),  INT32_C(         944) },
+      {  INT64_C( 1153255795018695696), -INT64_C( 6899373889426554368),  INT64_C(    9150135766355968), -INT64_C(         90194313237),
+         INT64_C(        511101108343), -INT64_C( 7956066913123498043),  INT64_C(    4647979248005121), -INT64_C( 2435549769583291509) } },
+    { {  INT64_C( 2306432416166742273),  INT64_C(  101050344024311404), -INT64_C(  144115499595239425), -INT64_C(   72057594037928897),
+        -INT64_C( 8098374436276307734), -INT64_C(  289356310445573121),  INT64_C( 2882308245735604228), -INT64_C( 3074787025200100886) },
+      UINT8_C(251),
+      {  INT32_C(        1664),  INT32_C(        1000), -INT32_C(         416),  INT32_C(        1904), -INT32_C(         208),  INT32_C(         896),  INT32_C(        1072), -INT32_C(         736) },
+      {  INT64_C(        893353197776),  INT64_C(        536870912125), -INT64_C(  144115499595239425),  INT64_C(       1022202216686),
+        -INT64_C(        111669149722),  INT64_C(        481036337264),  INT64_C(        575525617798), -INT64_C(        395136991324) } },
+    { {  INT64_C( 1297045510250561537), -INT64_C( 8505210749398688486), -INT64_C( 4612289865060450953), -INT64_C( 2776589444079922540),
+        -INT64_C(  239233229873624297),  INT64_C( 8024398315324549083),  INT64_C( 5394647478737023753), -INT64_C(  288511861111260161) },
+      UINT8_C( 54),
+      {  INT32_C(        1984), -INT32_C(        1064),  INT32_C(         944), -INT32_C(        1368), -INT32_C(         568), -INT32_C(        1480), -INT32_C(         360),  INT32_C(         280) },
+      {  INT64_C( 1297045510250561537), -INT64_C(        571230650501),  INT64_C(        506806141046), -INT64_C( 2776589444079922540),
+        -INT64_C(        304942678087), -INT64_C(        794568949945),  INT64_C( 5394647478737023753), -INT64_C(  288511861111260161) } },
+    { {  INT64_C(         68719476738),  INT64_C(      35184414077674),  INT64_C( 1898004657580642715), -INT64_C(   37154696925806659),
+         INT64_C( 1605067449890715927),  INT64_C( 6333432127225237499),  INT64_C( 6443314079986691329),  INT64_C(    4648805232288784) },
+      UINT8_C( 26),
+      {  INT32_C(         968), -INT32_C(         104),  INT32_C(         160), -INT32_C(         760),  INT32_C(        1528),  INT32_C(        1656),  INT32_C(        1448),  INT32_C(         160) },
+      {  INT64_C(         68719476738), -INT64_C(         55834574861),  INT64_C( 1898004657580642715), -INT64_C(        408021893215),
+         INT64_C(        820338753727),  INT64_C( 6333432127225237499),  INT64_C( 6443314079986691329),  INT64_C(    4648805232288784) } },
+    { { -INT64_C(        559558043729),  INT64_C( 5343728405071730797),  INT64_C(  595038513083187328), -INT64_C(       3298535936257),
+         INT64_C(  162692674514621640),  INT64_C(     180905096249360), -INT64_C( 2259902588487599871),  INT64_C(  153702930006941784) },
+      UINT8_C(149),
+      {  INT32_C(         272), -INT32_C(        1792), -INT32_C(         848),  INT32_C(        1224), -INT32_C(        1000), -INT32_C(         984), -INT32_C(        1240), -INT32_C(         936) },
+      {  INT64_C(        146028888098),  INT64_C( 5343728405071730797), -INT64_C(        455266533482), -INT64_C(       3298535936257),
+        -INT64_C(        536870912125),  INT64_C(     180905096249360), -INT64_C( 2259902588487599871), -INT64_C(        502511173749) } },
+    { {  INT64_C(   72130163986403332), -INT64_C( 4607177741576421375),  INT64_C( 6188950814762820613), -INT64_C( 5788842906902872064),
+         INT64_C(    1233660737229062), -INT64_C(      72576894239269),  INT64_C( 4249989302198022816),  INT64_C(   10133240971001888) },
+      UINT8_C(224),
+      {  INT32_C(        1360),  INT32_C(         448),  INT32_C(         976),  INT32_C(        1288),  INT32_C(        1728), -INT32_C(        1192),  INT32_C(        1496), -INT32_C(        1368) },
+      {  INT64_C(   72130163986403332), -INT64_C( 4607177741576421375),  INT64_C( 6188950814762820613), -INT64_C( 5788842906902872064),
+         INT64_C(    1233660737229062), -INT64_C(        639950127253),  INT64_C(        803158884539), -INT64_C(        734439407787) } },
+    { { -INT64_C( 1550586665908473177), -INT64_C( 2306969461090959361), -INT64_C(    2816957514514433), -INT64_C( 1318571515423696203),
+         INT64_C(  559175389518108494),  INT64_C( 5746790253029952446), -INT64_C( 8115600707750401776), -INT64_C( 4611686654623621665) },
+      UINT8_C( 48),
+      {  INT32_C(         144), -INT32_C(        1544),  INT32_C(        1504), -INT32_C(         768), -INT32_C(         824), -INT32_C(         488),  INT32_C(        1608),  INT32_C(         408) },
+      { -INT64_C( 1550586665908473177), -INT64_C( 2306969461090959361), -INT64_C(    2816957514514433), -INT64_C( 1318571515423696203),
+        -INT64_C(        442381631591), -INT64_C(        261993005117), -INT64_C( 8115600707750401776), -INT64_C( 4611686654623621665) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i32gather_epi64(src, test_vec[i].k, vindex, &(i64_buffer[2048]), 1);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { {  INT32_C(          67),  INT32_C(         254),  INT32_C(         107), -INT32_C(         140), -INT32_C(         116), -INT32_C(         100),  INT32_C(         124),  INT32_C(         202),
+        -INT32_C(         222),  INT32_C(         174),  INT32_C(         250), -INT32_C(          41),  INT32_C(         245), -INT32_C(         220),  INT32_C(         188), -INT32_C(         123) },
+      { SIMDE_FLOAT32_C(    67.00), SIMDE_FLOAT32_C(   254.00), SIMDE_FLOAT32_C(   107.00), SIMDE_FLOAT32_C(  -140.00),
+        SIMDE_FLOAT32_C(  -116.00), SIMDE_FLOAT32_C(  -100.00), SIMDE_FLOAT32_C(   124.00), SIMDE_FLOAT32_C(   202.00),
+        SIMDE_FLOAT32_C(  -222.00), SIMDE_FLOAT32_C(   174.00), SIMDE_FLOAT32_C(   250.00), SIMDE_FLOAT32_C(   -41.00),
+        SIMDE_FLOAT32_C(   245.00), SIMDE_FLOAT32_C(  -220.00), SIMDE_FLOAT32_C(   188.00), SIMDE_FLOAT32_C(  -123.00) } },
+    { {  INT32_C(          78), -INT32_C(         197), -INT32_C(         184), -INT32_C(         134), -INT32_C(         110), -INT32_C(           1),  INT32_C(          77), -INT32_C(         232),
+        -INT32_C(          60),  INT32_C(         202), -INT32_C(         189), -INT32_C(          34), -INT32_C(          34),  INT32_C(         204),  INT32_C(         127),  INT32_C(         124) },
+      { SIMDE_FLOAT32_C(    78.00), SIMDE_FLOAT32_C(  -197.00), SIMDE_FLOAT32_C(  -184.00), SIMDE_FLOAT32_C(  -134.00),
+        SIMDE_FLOAT32_C(  -110.00), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(    77.00), SIMDE_FLOAT32_C(  -232.00),
+        SIMDE_FLOAT32_C(   -60.00), SIMDE_FLOAT32_C(   202.00), SIMDE_FLOAT32_C(  -189.00), SIMDE_FLOAT32_C(   -34.00),
+        SIMDE_FLOAT32_C(   -34.00), SIMDE_FLOAT32_C(   204.00), SIMDE_FLOAT32_C(   127.00), SIMDE_FLOAT32_C(   124.00) } },
+    { {  INT32_C(         169),  INT32_C(         218), -INT32_C(          15), -INT32_C(         217),  INT32_C(          51), -INT32_C(         228),  INT32_C(         145), -INT32_C(          40),
+         INT32_C(          55),  INT32_C(           3), -INT32_C(          52), -INT32_C(         128), -INT32_C(         110), -INT32_C(         134),  INT32_C(          93),  INT32_C(         130) },
+      { SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   218.00), SIMDE_FLOAT32_C(   -15.00), SIMDE_FLOAT32_C(  -217.00),
+        SIMDE_FLOAT32_C(    51.00), SIMDE_FLOAT32_C(  -228.00), SIMDE_FLOAT32_C(   145.00), SIMDE_FLOAT32_C(   -40.00),
+        SIMDE_FLOAT32_C(    55.00), SIMDE_FLOAT32_C(     3.00), SIMDE_FLOAT32_C(   -52.00), SIMDE_FLOAT32_C(  -128.00),
+        SIMDE_FLOAT32_C(  -110.00), SIMDE_FLOAT32_C(  -134.00), SIMDE_FLOAT32_C(    93.00), SIMDE_FLOAT32_C(   130.00) } },
+    { { -INT32_C(         203),  INT32_C(         138),  INT32_C(          60), -INT32_C(         163),  INT32_C(          70),  INT32_C(         104), -INT32_C(         238), -INT32_C(         207),
+         INT32_C(          54),  INT32_C(         187),  INT32_C(         198),  INT32_C(          46),  INT32_C(          73), -INT32_C(          95),  INT32_C(         189), -INT32_C(          16) },
+      { SIMDE_FLOAT32_C(  -203.00), SIMDE_FLOAT32_C(   138.00), SIMDE_FLOAT32_C(    60.00), SIMDE_FLOAT32_C(  -163.00),
+        SIMDE_FLOAT32_C(    70.00), SIMDE_FLOAT32_C(   104.00), SIMDE_FLOAT32_C(  -238.00), SIMDE_FLOAT32_C(  -207.00),
+        SIMDE_FLOAT32_C(    54.00), SIMDE_FLOAT32_C(   187.00), SIMDE_FLOAT32_C(   198.00), SIMDE_FLOAT32_C(    46.00),
+        SIMDE_FLOAT32_C(    73.00), SIMDE_FLOAT32_C(   -95.00), SIMDE_FLOAT32_C(   189.00), SIMDE_FLOAT32_C(   -16.00) } },
+    { {  INT32_C(          40),  INT32_C(         135),  INT32_C(         109),  INT32_C(         134),  INT32_C(           0), -INT32_C(         209),  INT32_C(         173),  INT32_C(         141),
+        -INT32_C(         217), -INT32_C(         198), -INT32_C(          64), -INT32_C(          28),  INT32_C(         224),  INT32_C(         206),  INT32_C(         238), -INT32_C(         205) },
+      { SIMDE_FLOAT32_C(    40.00), SIMDE_FLOAT32_C(   135.00), SIMDE_FLOAT32_C(   109.00), SIMDE_FLOAT32_C(   134.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -209.00), SIMDE_FLOAT32_C(   173.00), SIMDE_FLOAT32_C(   141.00),
+        SIMDE_FLOAT32_C(  -217.00), SIMDE_FLOAT32_C(  -198.00), SIMDE_FLOAT32_C(   -64.00), SIMDE_FLOAT32_C(   -28.00),
+        SIMDE_FLOAT32_C(   224.00), SIMDE_FLOAT32_C(   206.00), SIMDE_FLOAT32_C(   238.00), SIMDE_FLOAT32_C(  -205.00) } },
+    { { -INT32_C(          69),  INT32_C(         115),  INT32_C(          66), -INT32_C(         172),  INT32_C(          67), -INT32_C(          28),  INT32_C(          81), -INT32_C(          38),
+        -INT32_C(         206),  INT32_C(         124),  INT32_C(         223),  INT32_C(         201),  INT32_C(          58), -INT32_C(          53), -INT32_C(         204),  INT32_C(         166) },
+      { SIMDE_FLOAT32_C(   -69.00), SIMDE_FLOAT32_C(   115.00), SIMDE_FLOAT32_C(    66.00), SIMDE_FLOAT32_C(  -172.00),
+        SIMDE_FLOAT32_C(    67.00), SIMDE_FLOAT32_C(   -28.00), SIMDE_FLOAT32_C(    81.00), SIMDE_FLOAT32_C(   -38.00),
+        SIMDE_FLOAT32_C(  -206.00), SIMDE_FLOAT32_C(   124.00), SIMDE_FLOAT32_C(   223.00), SIMDE_FLOAT32_C(   201.00),
+        SIMDE_FLOAT32_C(    58.00), SIMDE_FLOAT32_C(   -53.00), SIMDE_FLOAT32_C(  -204.00), SIMDE_FLOAT32_C(   166.00) } },
+    { {  INT32_C(         244), -INT32_C(         140),  INT32_C(         128),  INT32_C(         121), -INT32_C(         160), -INT32_C(          37),  INT32_C(         103), -INT32_C(         134),
+        -INT32_C(         225), -INT32_C(         133), -INT32_C(         224), -INT32_C(         179), -INT32_C(         130), -INT32_C(         153),  INT32_C(         253),  INT32_C(          89) },
+      { SIMDE_FLOAT32_C(   244.00), SIMDE_FLOAT32_C(  -140.00), SIMDE_FLOAT32_C(   128.00), SIMDE_FLOAT32_C(   121.00),
+        SIMDE_FLOAT32_C(  -160.00), SIMDE_FLOAT32_C(   -37.00), SIMDE_FLOAT32_C(   103.00), SIMDE_FLOAT32_C(  -134.00),
+        SIMDE_FLOAT32_C(  -225.00), SIMDE_FLOAT32_C(  -133.00), SIMDE_FLOAT32_C(  -224.00), SIMDE_FLOAT32_C(  -179.00),
+        SIMDE_FLOAT32_C(  -130.00), SIMDE_FLOAT32_C(  -153.00), SIMDE_FLOAT32_C(   253.00), SIMDE_FLOAT32_C(    89.00) } },
+    { { -INT32_C(         244),  INT32_C(         146), -INT32_C(         177), -INT32_C(         179), -INT32_C(         209), -INT32_C(         230), -INT32_C(         173), -INT32_C(         105),
+         INT32_C(          92),  INT32_C(         242), -INT32_C(          87),  INT32_C(          53),  INT32_C(          29), -INT32_C(         112), -INT32_C(         204),  INT32_C(         160) },
+      { SIMDE_FLOAT32_C(  -244.00), SIMDE_FLOAT32_C(   146.00), SIMDE_FLOAT32_C(  -177.00), SIMDE_FLOAT32_C(  -179.00),
+        SIMDE_FLOAT32_C(  -209.00), SIMDE_FLOAT32_C(  -230.00), SIMDE_FLOAT32_C(  -173.00), SIMDE_FLOAT32_C(  -105.00),
+        SIMDE_FLOAT32_C(    92.00), SIMDE_FLOAT32_C(   242.00), SIMDE_FLOAT32_C(   -87.00), SIMDE_FLOAT32_C(    53.00),
+        SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(  -112.00), SIMDE_FLOAT32_C(  -204.00), SIMDE_FLOAT32_C(   160.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 r = simde_mm512_i32gather_ps(vindex, &(f32_buffer[2048]), 8);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -6263.00), SIMDE_FLOAT32_C( -2040.50), SIMDE_FLOAT32_C( -5735.00), SIMDE_FLOAT32_C(  2172.75),
+        SIMDE_FLOAT32_C(  2468.25), SIMDE_FLOAT32_C( -2936.25), SIMDE_FLOAT32_C(  -390.25), SIMDE_FLOAT32_C( -6599.50),
+        SIMDE_FLOAT32_C(  9263.50), SIMDE_FLOAT32_C(  8543.00), SIMDE_FLOAT32_C(  5311.25), SIMDE_FLOAT32_C(  -793.00),
+        SIMDE_FLOAT32_C(  8717.00), SIMDE_FLOAT32_C( -7873.50), SIMDE_FLOAT32_C(  1932.25), SIMDE_FLOAT32_C(   -11.50) },
+           UINT16_MAX,
+      { -INT32_C(         224),  INT32_C(         480), -INT32_C(         438), -INT32_C(         336), -INT32_C(         280), -INT32_C(         164), -INT32_C(         424),  INT32_C(           2),
+         INT32_C(         478), -INT32_C(         422),  INT32_C(         286), -INT32_C(          44), -INT32_C(         202),  INT32_C(         500), -INT32_C(         400), -INT32_C(         418) },
+      { SIMDE_FLOAT32_C(   -56.00), SIMDE_FLOAT32_C(   120.00), SIMDE_FLOAT32_C(  -109.50), SIMDE_FLOAT32_C(   -84.00),
+        SIMDE_FLOAT32_C(   -70.00), SIMDE_FLOAT32_C(   -41.00), SIMDE_FLOAT32_C(  -106.00), SIMDE_FLOAT32_C(     0.50),
+        SIMDE_FLOAT32_C(   119.50), SIMDE_FLOAT32_C(  -105.50), SIMDE_FLOAT32_C(    71.50), SIMDE_FLOAT32_C(   -11.00),
+        SIMDE_FLOAT32_C(   -50.50), SIMDE_FLOAT32_C(   125.00), SIMDE_FLOAT32_C(  -100.00), SIMDE_FLOAT32_C(  -104.50) } },
+    { { SIMDE_FLOAT32_C(  5490.75), SIMDE_FLOAT32_C(  8184.50), SIMDE_FLOAT32_C( -8037.25), SIMDE_FLOAT32_C(  9433.25),
+        SIMDE_FLOAT32_C(  2148.00), SIMDE_FLOAT32_C(  9728.75), SIMDE_FLOAT32_C( -2163.25), SIMDE_FLOAT32_C(  3902.00),
+        SIMDE_FLOAT32_C(  6677.25), SIMDE_FLOAT32_C( -8347.25), SIMDE_FLOAT32_C(  8360.75), SIMDE_FLOAT32_C(  -893.75),
+        SIMDE_FLOAT32_C( -6046.75), SIMDE_FLOAT32_C(   444.50), SIMDE_FLOAT32_C(  8842.25), SIMDE_FLOAT32_C(  3904.25) },
+      UINT16_C(49188),
+      {  INT32_C(          24),  INT32_C(         288), -INT32_C(          48),  INT32_C(          40),  INT32_C(         280), -INT32_C(         158), -INT32_C(         386), -INT32_C(         390),
+        -INT32_C(         190),  INT32_C(         338), -INT32_C(         386),  INT32_C(         492), -INT32_C(         250),  INT32_C(         330),  INT32_C(          48), -INT32_C(         366) },
+      { SIMDE_FLOAT32_C(  5490.75), SIMDE_FLOAT32_C(  8184.50), SIMDE_FLOAT32_C(   -12.00), SIMDE_FLOAT32_C(  9433.25),
+        SIMDE_FLOAT32_C(  2148.00), SIMDE_FLOAT32_C(   -39.50), SIMDE_FLOAT32_C( -2163.25), SIMDE_FLOAT32_C(  3902.00),
+        SIMDE_FLOAT32_C(  6677.25), SIMDE_FLOAT32_C( -8347.25), SIMDE_FLOAT32_C(  8360.75), SIMDE_FLOAT32_C(  -893.75),
+        SIMDE_FLOAT32_C( -6046.75), SIMDE_FLOAT32_C(   444.50), SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(   -91.50) } },
+    { { SIMDE_FLOAT32_C(  6711.25), SIMDE_FLOAT32_C( -8692.25), SIMDE_FLOAT32_C(  5147.00), SIMDE_FLOAT32_C(  1003.00),
+        SIMDE_FLOAT32_C( -1838.50), SIMDE_FLOAT32_C( -7255.25), SIMDE_FLOAT32_C( -9058.50), SIMDE_FLOAT32_C( -8999.25),
+        SIMDE_FLOAT32_C( -5146.00), SIMDE_FLOAT32_C(  4802.75), SIMDE_FLOAT32_C(   942.75), SIMDE_FLOAT32_C( -9490.75),
+        SIMDE_FLOAT32_C( -7825.75), SIMDE_FLOAT32_C( -1246.50), SIMDE_FLOAT32_C(  6312.75), SIMDE_FLOAT32_C(  -502.75) },
+      UINT16_C(13679),
+      {  INT32_C(         140), -INT32_C(         500),  INT32_C(         158), -INT32_C(         130), -INT32_C(         224),  INT32_C(          94),  INT32_C(         362),  INT32_C(         372),
+         INT32_C(          30),  INT32_C(         438),  INT32_C(         194),  INT32_C(         198),  INT32_C(         164),  INT32_C(         232), -INT32_C(         258), -INT32_C(         198) },
+      { SIMDE_FLOAT32_C(    35.00), SIMDE_FLOAT32_C(  -125.00), SIMDE_FLOAT32_C(    39.50), SIMDE_FLOAT32_C(   -32.50),
+        SIMDE_FLOAT32_C( -1838.50), SIMDE_FLOAT32_C(    23.50), SIMDE_FLOAT32_C(    90.50), SIMDE_FLOAT32_C( -8999.25),
+        SIMDE_FLOAT32_C(     7.50), SIMDE_FLOAT32_C(  4802.75), SIMDE_FLOAT32_C(    48.50), SIMDE_FLOAT32_C( -9490.75),
+        SIMDE_FLOAT32_C(    41.00), SIMDE_FLOAT32_C(    58.00), SIMDE_FLOAT32_C(  6312.75), SIMDE_FLOAT32_C(  -502.75) } },
+    { { SIMDE_FLOAT32_C(  3902.50), SIMDE_FLOAT32_C(  4600.75), SIMDE_FLOAT32_C(  1866.25), SIMDE_FLOAT32_C(  1524.00),
+        SIMDE_FLOAT32_C( -8217.00), SIMDE_FLOAT32_C(  -513.75), SIMDE_FLOAT32_C(  9955.25), SIMDE_FLOAT32_C(   307.00),
+        SIMDE_FLOAT32_C(  7859.75), SIMDE_FLOAT32_C( -7768.25), SIMDE_FLOAT32_C( -8912.00), SIMDE_FLOAT32_C( -7686.25),
+        SIMDE_FLOAT32_C( -7992.50), SIMDE_FLOAT32_C(  5288.75), SIMDE_FLOAT32_C(  5650.00), SIMDE_FLOAT32_C(  1251.75) },
+      UINT16_C(27109),
+      {  INT32_C(         396), -INT32_C(          48), -INT32_C(         272), -INT32_C(         126),  INT32_C(          14),  INT32_C(         440),  INT32_C(         222), -INT32_C(          22),
+        -INT32_C(         346), -INT32_C(         470), -INT32_C(           2), -INT32_C(         434),  INT32_C(         248),  INT32_C(         216), -INT32_C(          94), -INT32_C(         336) },
+      { SIMDE_FLOAT32_C(    99.00), SIMDE_FLOAT32_C(  4600.75), SIMDE_FLOAT32_C(   -68.00), SIMDE_FLOAT32_C(  1524.00),
+        SIMDE_FLOAT32_C( -8217.00), SIMDE_FLOAT32_C(   110.00), SIMDE_FLOAT32_C(    55.50), SIMDE_FLOAT32_C(    -5.50),
+        SIMDE_FLOAT32_C(   -86.50), SIMDE_FLOAT32_C( -7768.25), SIMDE_FLOAT32_C( -8912.00), SIMDE_FLOAT32_C(  -108.50),
+        SIMDE_FLOAT32_C( -7992.50), SIMDE_FLOAT32_C(    54.00), SIMDE_FLOAT32_C(   -23.50), SIMDE_FLOAT32_C(  1251.75) } },
+    { { SIMDE_FLOAT32_C(  4626.50), SIMDE_FLOAT32_C(  1007.50), SIMDE_FLOAT32_C(   160.75), SIMDE_FLOAT32_C( -6501.25),
+        SIMDE_FLOAT32_C(  5799.00), SIMDE_FLOAT32_C(  8346.25), SIMDE_FLOAT32_C(  3671.00), SIMDE_FLOAT32_C( -7930.00),
+        SIMDE_FLOAT32_C(  6462.75), SIMDE_FLOAT32_C(  1262.00), SIMDE_FLOAT32_C( -9020.75), SIMDE_FLOAT32_C(    35.75),
+        SIMDE_FLOAT32_C( -3916.75), SIMDE_FLOAT32_C( -8868.75), SIMDE_FLOAT32_C(  9997.25), SIMDE_FLOAT32_C( -5368.75) },
+      UINT16_C(45685),
+      {  INT32_C(          50), -INT32_C(         380),  INT32_C(          64),  INT32_C(          40), -INT32_C(         254),  INT32_C(          32), -INT32_C(         278),  INT32_C(          24),
+         INT32_C(          30), -INT32_C(         154), -INT32_C(         386),  INT32_C(         398), -INT32_C(          58), -INT32_C(         384),  INT32_C(         364), -INT32_C(          92) },
+      { SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(  1007.50), SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C( -6501.25),
+        SIMDE_FLOAT32_C(   -63.50), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   -69.50), SIMDE_FLOAT32_C( -7930.00),
+        SIMDE_FLOAT32_C(  6462.75), SIMDE_FLOAT32_C(   -38.50), SIMDE_FLOAT32_C( -9020.75), SIMDE_FLOAT32_C(    35.75),
+        SIMDE_FLOAT32_C(   -14.50), SIMDE_FLOAT32_C(   -96.00), SIMDE_FLOAT32_C(  9997.25), SIMDE_FLOAT32_C(   -23.00) } },
+    { { SIMDE_FLOAT32_C(  3903.75), SIMDE_FLOAT32_C(  3528.00), SIMDE_FLOAT32_C(  9860.50), SIMDE_FLOAT32_C( -9044.00),
+        SIMDE_FLOAT32_C( -6645.50), SIMDE_FLOAT32_C( -3294.50), SIMDE_FLOAT32_C(  7117.75), SIMDE_FLOAT32_C(  4043.00),
+        SIMDE_FLOAT32_C(  2692.75), SIMDE_FLOAT32_C(  4480.75), SIMDE_FLOAT32_C(  9037.75), SIMDE_FLOAT32_C( -1200.75),
+        SIMDE_FLOAT32_C( -1113.50), SIMDE_FLOAT32_C(  9871.75), SIMDE_FLOAT32_C(  9198.00), SIMDE_FLOAT32_C( -9516.50) },
+      UINT16_C(27881),
+      {  INT32_C(         118),  INT32_C(          70),  INT32_C(         252),  INT32_C(         334),  INT32_C(         332), -INT32_C(         196), -INT32_C(         162),  INT32_C(          96),
+         INT32_C(         198),  INT32_C(         126),  INT32_C(         166),  INT32_C(         310), -INT32_C(          62), -INT32_C(         288), -INT32_C(         120), -INT32_C(          18) },
+      { SIMDE_FLOAT32_C(    29.50), SIMDE_FLOAT32_C(  3528.00), SIMDE_FLOAT32_C(  9860.50), SIMDE_FLOAT32_C(    83.50),
+        SIMDE_FLOAT32_C( -6645.50), SIMDE_FLOAT32_C(   -49.00), SIMDE_FLOAT32_C(   -40.50), SIMDE_FLOAT32_C(    24.00),
+        SIMDE_FLOAT32_C(  2692.75), SIMDE_FLOAT32_C(  4480.75), SIMDE_FLOAT32_C(    41.50), SIMDE_FLOAT32_C(    77.50),
+        SIMDE_FLOAT32_C( -1113.50), SIMDE_FLOAT32_C(   -72.00), SIMDE_FLOAT32_C(   -30.00), SIMDE_FLOAT32_C( -9516.50) } },
+    { { SIMDE_FLOAT32_C(   891.00), SIMDE_FLOAT32_C(  9938.50), SIMDE_FLOAT32_C(  6017.75), SIMDE_FLOAT32_C(   998.75),
+        SIMDE_FLOAT32_C( -7845.50), SIMDE_FLOAT32_C(  4335.25), SIMDE_FLOAT32_C( -3965.00), SIMDE_FLOAT32_C(  6489.00),
+        SIMDE_FLOAT32_C( -8205.00), SIMDE_FLOAT32_C( -6907.50), SIMDE_FLOAT32_C( -3186.25), SIMDE_FLOAT32_C( -1141.25),
+        SIMDE_FLOAT32_C( -2846.25), SIMDE_FLOAT32_C( -8711.50), SIMDE_FLOAT32_C( -5134.25), SIMDE_FLOAT32_C( -3704.75) },
+      UINT16_C(56180),
+      {  INT32_C(         504), -INT32_C(         486), -INT32_C(         308),  INT32_C(          58), -INT32_C(         402),  INT32_C(         188),  INT32_C(          64), -INT32_C(         162),
+        -INT32_C(          52), -INT32_C(         396), -INT32_C(         416), -INT32_C(         120), -INT32_C(         490),  INT32_C(         502),  INT32_C(          18), -INT32_C(          72) },
+      { SIMDE_FLOAT32_C(   891.00), SIMDE_FLOAT32_C(  9938.50), SIMDE_FLOAT32_C(   -77.00), SIMDE_FLOAT32_C(   998.75),
+        SIMDE_FLOAT32_C(  -100.50), SIMDE_FLOAT32_C(    47.00), SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(  6489.00),
+        SIMDE_FLOAT32_C(   -13.00), SIMDE_FLOAT32_C(   -99.00), SIMDE_FLOAT32_C( -3186.25), SIMDE_FLOAT32_C(   -30.00),
+        SIMDE_FLOAT32_C(  -122.50), SIMDE_FLOAT32_C( -8711.50), SIMDE_FLOAT32_C(     4.50), SIMDE_FLOAT32_C(   -18.00) } },
+    { { SIMDE_FLOAT32_C(  6876.25), SIMDE_FLOAT32_C( -7645.00), SIMDE_FLOAT32_C(  3329.75), SIMDE_FLOAT32_C(   186.75),
+        SIMDE_FLOAT32_C( -4606.50), SIMDE_FLOAT32_C(  6958.50), SIMDE_FLOAT32_C( -3920.25), SIMDE_FLOAT32_C(  3411.00),
+        SIMDE_FLOAT32_C( -5445.75), SIMDE_FLOAT32_C( -7402.50), SIMDE_FLOAT32_C(  1782.00), SIMDE_FLOAT32_C(  2468.00),
+        SIMDE_FLOAT32_C(  -313.50), SIMDE_FLOAT32_C(  9019.75), SIMDE_FLOAT32_C( -5322.25), SIMDE_FLOAT32_C( -7028.50) },
+      UINT16_C( 5380),
+      { -INT32_C(         274), -INT32_C(         240), -INT32_C(         444),  INT32_C(          70),  INT32_C(         418), -INT32_C(         442),  INT32_C(         154), -INT32_C(         100),
+         INT32_C(         244),  INT32_C(         342),  INT32_C(         408), -INT32_C(           2),  INT32_C(         462), -INT32_C(         348), -INT32_C(         156), -INT32_C(         138) },
+      { SIMDE_FLOAT32_C(  6876.25), SIMDE_FLOAT32_C( -7645.00), SIMDE_FLOAT32_C(  -111.00), SIMDE_FLOAT32_C(   186.75),
+        SIMDE_FLOAT32_C( -4606.50), SIMDE_FLOAT32_C(  6958.50), SIMDE_FLOAT32_C( -3920.25), SIMDE_FLOAT32_C(  3411.00),
+        SIMDE_FLOAT32_C(    61.00), SIMDE_FLOAT32_C( -7402.50), SIMDE_FLOAT32_C(   102.00), SIMDE_FLOAT32_C(  2468.00),
+        SIMDE_FLOAT32_C(   115.50), SIMDE_FLOAT32_C(  9019.75), SIMDE_FLOAT32_C( -5322.25), SIMDE_FLOAT32_C( -7028.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 r = simde_mm512_mask_i32gather_ps(src, test_vec[i].k, vindex, &(f32_buffer[2048]), 2);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { -INT32_C(          74),  INT32_C(         128),  INT32_C(          27),  INT32_C(          94), -INT32_C(          77), -INT32_C(         199),  INT32_C(          20), -INT32_C(          34) },
+      { SIMDE_FLOAT64_C(   -18.50), SIMDE_FLOAT64_C(    32.00), SIMDE_FLOAT64_C(     6.75), SIMDE_FLOAT64_C(    23.50),
+        SIMDE_FLOAT64_C(   -19.25), SIMDE_FLOAT64_C(   -49.75), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(    -8.50) } },
+    { {  INT32_C(         234),  INT32_C(          97),  INT32_C(         197),  INT32_C(         209), -INT32_C(          86),  INT32_C(          13), -INT32_C(          61),  INT32_C(         141) },
+      { SIMDE_FLOAT64_C(    58.50), SIMDE_FLOAT64_C(    24.25), SIMDE_FLOAT64_C(    49.25), SIMDE_FLOAT64_C(    52.25),
+        SIMDE_FLOAT64_C(   -21.50), SIMDE_FLOAT64_C(     3.25), SIMDE_FLOAT64_C(   -15.25), SIMDE_FLOAT64_C(    35.25) } },
+    { { -INT32_C(         138), -INT32_C(          40),  INT32_C(         245),  INT32_C(         107), -INT32_C(         198), -INT32_C(         222),  INT32_C(         191), -INT32_C(         166) },
+      { SIMDE_FLOAT64_C(   -34.50), SIMDE_FLOAT64_C(   -10.00), SIMDE_FLOAT64_C(    61.25), SIMDE_FLOAT64_C(    26.75),
+        SIMDE_FLOAT64_C(   -49.50), SIMDE_FLOAT64_C(   -55.50), SIMDE_FLOAT64_C(    47.75), SIMDE_FLOAT64_C(   -41.50) } },
+    { {  INT32_C(           4),  INT32_C(         167),  INT32_C(         124),  INT32_C(          51), -INT32_C(          66), -INT32_C(         113),  INT32_C(         141),  INT32_C(          94) },
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(    41.75), SIMDE_FLOAT64_C(    31.00), SIMDE_FLOAT64_C(    12.75),
+        SIMDE_FLOAT64_C(   -16.50), SIMDE_FLOAT64_C(   -28.25), SIMDE_FLOAT64_C(    35.25), SIMDE_FLOAT64_C(    23.50) } },
+    { { -INT32_C(         138),  INT32_C(         171), -INT32_C(         122), -INT32_C(         242),  INT32_C(          44),  INT32_C(         100), -INT32_C(         181),  INT32_C(         111) },
+      { SIMDE_FLOAT64_C(   -34.50), SIMDE_FLOAT64_C(    42.75), SIMDE_FLOAT64_C(   -30.50), SIMDE_FLOAT64_C(   -60.50),
+        SIMDE_FLOAT64_C(    11.00), SIMDE_FLOAT64_C(    25.00), SIMDE_FLOAT64_C(   -45.25), SIMDE_FLOAT64_C(    27.75) } },
+    { {  INT32_C(         163),  INT32_C(         220), -INT32_C(         102), -INT32_C(          76),  INT32_C(         103),  INT32_C(         209),  INT32_C(          93),  INT32_C(         187) },
+      { SIMDE_FLOAT64_C(    40.75), SIMDE_FLOAT64_C(    55.00), SIMDE_FLOAT64_C(   -25.50), SIMDE_FLOAT64_C(   -19.00),
+        SIMDE_FLOAT64_C(    25.75), SIMDE_FLOAT64_C(    52.25), SIMDE_FLOAT64_C(    23.25), SIMDE_FLOAT64_C(    46.75) } },
+    { {  INT32_C(           9),  INT32_C(          46), -INT32_C(         161),  INT32_C(         139),  INT32_C(         196),  INT32_C(         214), -INT32_C(         174),  INT32_C(          66) },
+      { SIMDE_FLOAT64_C(     2.25), SIMDE_FLOAT64_C(    11.50), SIMDE_FLOAT64_C(   -40.25), SIMDE_FLOAT64_C(    34.75),
+        SIMDE_FLOAT64_C(    49.00), SIMDE_FLOAT64_C(    53.50), SIMDE_FLOAT64_C(   -43.50), SIMDE_FLOAT64_C(    16.50) } },
+    { { -INT32_C(         144), -INT32_C(         244), -INT32_C(          94), -INT32_C(          16),  INT32_C(         166),  INT32_C(         162),  INT32_C(          18), -INT32_C(          39) },
+      { SIMDE_FLOAT64_C(   -36.00), SIMDE_FLOAT64_C(   -61.00), SIMDE_FLOAT64_C(   -23.50), SIMDE_FLOAT64_C(    -4.00),
+        SIMDE_FLOAT64_C(    41.50), SIMDE_FLOAT64_C(    40.50), SIMDE_FLOAT64_C(     4.50), SIMDE_FLOAT64_C(    -9.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_i32gather_pd(vindex, &(f64_buffer[2048]), 8);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -2395.25), SIMDE_FLOAT64_C(  5455.75), SIMDE_FLOAT64_C(  2554.00), SIMDE_FLOAT64_C(  7321.00),
+        SIMDE_FLOAT64_C( -5423.75), SIMDE_FLOAT64_C(  8933.25), SIMDE_FLOAT64_C( -9846.50), SIMDE_FLOAT64_C( -5543.75) },
+         UINT8_MAX,
+      { -INT32_C(          54), -INT32_C(          90), -INT32_C(         118), -INT32_C(         196), -INT32_C(          66),  INT32_C(         400), -INT32_C(         258), -INT32_C(         488) },
+      { SIMDE_FLOAT64_C(    -6.75), SIMDE_FLOAT64_C(   -11.25), SIMDE_FLOAT64_C(   -14.75), SIMDE_FLOAT64_C(   -24.50),
+        SIMDE_FLOAT64_C(    -8.25), SIMDE_FLOAT64_C(    50.00), SIMDE_FLOAT64_C(   -32.25), SIMDE_FLOAT64_C(   -61.00) } },
+    { { SIMDE_FLOAT64_C( -2140.75), SIMDE_FLOAT64_C(  4851.75), SIMDE_FLOAT64_C(  7817.75), SIMDE_FLOAT64_C( -2465.50),
+        SIMDE_FLOAT64_C( -5184.00), SIMDE_FLOAT64_C( -9144.25), SIMDE_FLOAT64_C( -5890.25), SIMDE_FLOAT64_C( -9277.00) },
+      UINT8_C(200),
+      { -INT32_C(         378), -INT32_C(         272),  INT32_C(         400),  INT32_C(         338), -INT32_C(         230),  INT32_C(         274), -INT32_C(         190),  INT32_C(         166) },
+      { SIMDE_FLOAT64_C( -2140.75), SIMDE_FLOAT64_C(  4851.75), SIMDE_FLOAT64_C(  7817.75), SIMDE_FLOAT64_C(    42.25),
+        SIMDE_FLOAT64_C( -5184.00), SIMDE_FLOAT64_C( -9144.25), SIMDE_FLOAT64_C(   -23.75), SIMDE_FLOAT64_C(    20.75) } },
+    { { SIMDE_FLOAT64_C(  1523.50), SIMDE_FLOAT64_C( -1667.50), SIMDE_FLOAT64_C(  1712.25), SIMDE_FLOAT64_C(  3064.50),
+        SIMDE_FLOAT64_C( -3815.25), SIMDE_FLOAT64_C( -7828.50), SIMDE_FLOAT64_C(  6728.00), SIMDE_FLOAT64_C(  7660.75) },
+      UINT8_C( 66),
+      { -INT32_C(         364), -INT32_C(         466),  INT32_C(          32),  INT32_C(         382),  INT32_C(         392),  INT32_C(         500),  INT32_C(         106),  INT32_C(         256) },
+      { SIMDE_FLOAT64_C(  1523.50), SIMDE_FLOAT64_C(   -58.25), SIMDE_FLOAT64_C(  1712.25), SIMDE_FLOAT64_C(  3064.50),
+        SIMDE_FLOAT64_C( -3815.25), SIMDE_FLOAT64_C( -7828.50), SIMDE_FLOAT64_C(    13.25), SIMDE_FLOAT64_C(  7660.75) } },
+    { { SIMDE_FLOAT64_C(  9033.75), SIMDE_FLOAT64_C(  1053.25), SIMDE_FLOAT64_C(  3694.25), SIMDE_FLOAT64_C(  9338.75),
+        SIMDE_FLOAT64_C(  8395.00), SIMDE_FLOAT64_C( -4908.00), SIMDE_FLOAT64_C( -5692.00), SIMDE_FLOAT64_C( -6096.00) },
+      UINT8_C(151),
+      { -INT32_C(         104),  INT32_C(         436), -INT32_C(         114), -INT32_C(         178),  INT32_C(          16),  INT32_C(          14), -INT32_C(         286),  INT32_C(         412) },
+      { SIMDE_FLOAT64_C(   -13.00), SIMDE_FLOAT64_C(    54.50), SIMDE_FLOAT64_C(   -14.25), SIMDE_FLOAT64_C(  9338.75),
+        SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C( -4908.00), SIMDE_FLOAT64_C( -5692.00), SIMDE_FLOAT64_C(    51.50) } },
+    { { SIMDE_FLOAT64_C( -1371.75), SIMDE_FLOAT64_C( -4898.75), SIMDE_FLOAT64_C(   855.00), SIMDE_FLOAT64_C(  5278.00),
+        SIMDE_FLOAT64_C(  -574.00), SIMDE_FLOAT64_C( -7553.00), SIMDE_FLOAT64_C(  9652.50), SIMDE_FLOAT64_C(  8250.00) },
+      UINT8_C(137),
+      { -INT32_C(         132),  INT32_C(         118), -INT32_C(         386),  INT32_C(         426), -INT32_C(         156),  INT32_C(         384), -INT32_C(         214), -INT32_C(         138) },
+      { SIMDE_FLOAT64_C(   -16.50), SIMDE_FLOAT64_C( -4898.75), SIMDE_FLOAT64_C(   855.00), SIMDE_FLOAT64_C(    53.25),
+        SIMDE_FLOAT64_C(  -574.00), SIMDE_FLOAT64_C( -7553.00), SIMDE_FLOAT64_C(  9652.50), SIMDE_FLOAT64_C(   -17.25) } },
+    { { SIMDE_FLOAT64_C( -7191.00), SIMDE_FLOAT64_C(  7171.25), SIMDE_FLOAT64_C(  3753.00), SIMDE_FLOAT64_C(  6123.75),
+        SIMDE_FLOAT64_C(  6312.00), SIMDE_FLOAT64_C( -8561.25), SIMDE_FLOAT64_C( -1381.75), SIMDE_FLOAT64_C(  5112.25) },
+      UINT8_C(224),
+      {  INT32_C(         490), -INT32_C(           6),  INT32_C(         228),  INT32_C(         208), -INT32_C(         200), -INT32_C(           4), -INT32_C(          96),  INT32_C(          70) },
+      { SIMDE_FLOAT64_C( -7191.00), SIMDE_FLOAT64_C(  7171.25), SIMDE_FLOAT64_C(  3753.00), SIMDE_FLOAT64_C(  6123.75),
+        SIMDE_FLOAT64_C(  6312.00), SIMDE_FLOAT64_C(    -0.50), SIMDE_FLOAT64_C(   -12.00), SIMDE_FLOAT64_C(     8.75) } },
+    { { SIMDE_FLOAT64_C( -5969.00), SIMDE_FLOAT64_C(  9621.75), SIMDE_FLOAT64_C(  6758.50), SIMDE_FLOAT64_C( -2506.25),
+        SIMDE_FLOAT64_C(  7110.75), SIMDE_FLOAT64_C( -6526.75), SIMDE_FLOAT64_C( -4441.75), SIMDE_FLOAT64_C( -9440.75) },
+      UINT8_C(164),
+      { -INT32_C(         162), -INT32_C(         298), -INT32_C(         262),  INT32_C(         494), -INT32_C(         450),  INT32_C(         256), -INT32_C(          30),  INT32_C(         126) },
+      { SIMDE_FLOAT64_C( -5969.00), SIMDE_FLOAT64_C(  9621.75), SIMDE_FLOAT64_C(   -32.75), SIMDE_FLOAT64_C( -2506.25),
+        SIMDE_FLOAT64_C(  7110.75), SIMDE_FLOAT64_C(    32.00), SIMDE_FLOAT64_C( -4441.75), SIMDE_FLOAT64_C(    15.75) } },
+    { { SIMDE_FLOAT64_C(  2209.25), SIMDE_FLOAT64_C( -3330.75), SIMDE_FLOAT64_C( -4316.00), SIMDE_FLOAT64_C(  7048.50),
+        SIMDE_FLOAT64_C(  9376.50), SIMDE_FLOAT64_C(  9705.75), SIMDE_FLOAT64_C(  1826.50), SIMDE_FLOAT64_C(  5167.75) },
+      UINT8_C( 15),
+      {  INT32_C(         464), -INT32_C(         364), -INT32_C(         358),  INT32_C(         128), -INT32_C(         260), -INT32_C(         392),  INT32_C(           8),  INT32_C(          14) },
+      { SIMDE_FLOAT64_C(    58.00), SIMDE_FLOAT64_C(   -45.50), SIMDE_FLOAT64_C(   -44.75), SIMDE_FLOAT64_C(    16.00),
+        SIMDE_FLOAT64_C(  9376.50), SIMDE_FLOAT64_C(  9705.75), SIMDE_FLOAT64_C(  1826.50), SIMDE_FLOAT64_C(  5167.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_mask_i32gather_pd(src, test_vec[i].k, vindex, &(f64_buffer[2048]), 4);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                 252),  INT64_C(                 234),  INT64_C(                 137),  INT64_C(                  90),
+        -INT64_C(                  57), -INT64_C(                 125),  INT64_C(                   9), -INT64_C(                  63) },
+      {  INT32_C(         756),  INT32_C(         702),  INT32_C(         411),  INT32_C(         270), -INT32_C(         171), -INT32_C(         375),  INT32_C(          27), -INT32_C(         189) } },
+    { { -INT64_C(                 245), -INT64_C(                  39), -INT64_C(                 149), -INT64_C(                 216),
+         INT64_C(                 123), -INT64_C(                  49), -INT64_C(                  87),  INT64_C(                  92) },
+      { -INT32_C(         735), -INT32_C(         117), -INT32_C(         447), -INT32_C(         648),  INT32_C(         369), -INT32_C(         147), -INT32_C(         261),  INT32_C(         276) } },
+    { { -INT64_C(                 142), -INT64_C(                 127),  INT64_C(                 224),  INT64_C(                 131),
+         INT64_C(                  64), -INT64_C(                   1),  INT64_C(                  28),  INT64_C(                 149) },
+      { -INT32_C(         426), -INT32_C(         381),  INT32_C(         672),  INT32_C(         393),  INT32_C(         192), -INT32_C(           3),  INT32_C(          84),  INT32_C(         447) } },
+    { {  INT64_C(                 197), -INT64_C(                 232),  INT64_C(                  20), -INT64_C(                  35),
+        -INT64_C(                  94), -INT64_C(                  46),  INT64_C(                   5),  INT64_C(                 204) },
+      {  INT32_C(         591), -INT32_C(         696),  INT32_C(          60), -INT32_C(         105), -INT32_C(         282), -INT32_C(         138),  INT32_C(          15),  INT32_C(         612) } },
+    { {  INT64_C(                  26), -INT64_C(                  68),  INT64_C(                 173),  INT64_C(                  31),
+        -INT64_C(                 122), -INT64_C(                  46), -INT64_C(                  96),  INT64_C(                 212) },
+      {  INT32_C(          78), -INT32_C(         204),  INT32_C(         519),  INT32_C(          93), -INT32_C(         366), -INT32_C(         138), -INT32_C(         288),  INT32_C(         636) } },
+    { {  INT64_C(                 200), -INT64_C(                 184), -INT64_C(                 238), -INT64_C(                 219),
+         INT64_C(                 173), -INT64_C(                 146),  INT64_C(                 163),  INT64_C(                 177) },
+      {  INT32_C(         600), -INT32_C(         552), -INT32_C(         714), -INT32_C(         657),  INT32_C(         519), -INT32_C(         438),  INT32_C(         489),  INT32_C(         531) } },
+    { {  INT64_C(                 171),  INT64_C(                 168),  INT64_C(                 163), -INT64_C(                 144),
+        -INT64_C(                 158),  INT64_C(                 122),  INT64_C(                 223),  INT64_C(                 108) },
+      {  INT32_C(         513),  INT32_C(         504),  INT32_C(         489), -INT32_C(         432), -INT32_C(         474),  INT32_C(         366),  INT32_C(         669),  INT32_C(         324) } },
+    { {  INT64_C(                  59),  INT64_C(                 232), -INT64_C(                 150),  INT64_C(                 157),
+         INT64_C(                 201),  INT64_C(                 167), -INT64_C(                  20),  INT64_C(                 151) },
+      {  INT32_C(         177),  INT32_C(         696), -INT32_C(         450),  INT32_C(         471),  INT32_C(         603),  INT32_C(         501), -INT32_C(          60),  INT32_C(         453) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i r = simde_mm512_i64gather_epi32(vindex, &(i32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  1056759804),  INT32_C(  1077938464), -INT32_C(  1887524688), -INT32_C(   805308417),  INT32_C(  2132538179),  INT32_C(   103102932), -INT32_C(  1111903234),  INT32_C(    35671056) },
+         UINT8_MAX,
+      {  INT64_C(                 272),  INT64_C(                 564), -INT64_C(                 228), -INT64_C(                 676),
+         INT64_C(                 232),  INT64_C(                 256),  INT64_C(                 552),  INT64_C(                 156) },
+      {  INT32_C(         204),  INT32_C(         423), -INT32_C(         171), -INT32_C(         507),  INT32_C(         174),  INT32_C(         192),  INT32_C(         414),  INT32_C(         117) } },
+    { { -INT32_C(  1009795774),  INT32_C(   135266304),  INT32_C(  2113929215),  INT32_C(  1927262335), -INT32_C(  1420886767), -INT32_C(  1712272744), -INT32_C(  1670616930), -INT32_C(   184739680) },
+      UINT8_C(  7),
+      {  INT64_C(                 404),  INT64_C(                 172),  INT64_C(                1008),  INT64_C(                 812),
+        -INT64_C(                  92), -INT64_C(                 172),  INT64_C(                 412), -INT64_C(                 416) },
+      {  INT32_C(         303),  INT32_C(         129),  INT32_C(         756),  INT32_C(  1927262335), -INT32_C(  1420886767), -INT32_C(  1712272744), -INT32_C(  1670616930), -INT32_C(   184739680) } },
+    { {  INT32_C(        4096),  INT32_C(  1250473904),  INT32_C(   223523849), -INT32_C(  1239288121), -INT32_C(  1073775106),  INT32_C(        8192),  INT32_C(     4325506),  INT32_C(       28672) },
+      UINT8_C( 60),
+      {  INT64_C(                 708), -INT64_C(                 660), -INT64_C(                 404), -INT64_C(                 584),
+        -INT64_C(                 516), -INT64_C(                 228), -INT64_C(                 324),  INT64_C(                 984) },
+      {  INT32_C(        4096),  INT32_C(  1250473904), -INT32_C(         303), -INT32_C(         438), -INT32_C(         387), -INT32_C(         171),  INT32_C(     4325506),  INT32_C(       28672) } },
+    { {  INT32_C(   589191680), -INT32_C(    35652097), -INT32_C(   268452035),  INT32_C(    33763182),  INT32_C(   196511298), -INT32_C(     1050633),  INT32_C(    17302272),  INT32_C(   212949047) },
+      UINT8_C( 56),
+      { -INT64_C(                 128),  INT64_C(                 896),  INT64_C(                  84), -INT64_C(                 216),
+        -INT64_C(                 212), -INT64_C(                 524), -INT64_C(                 432), -INT64_C(                 532) },
+      {  INT32_C(   589191680), -INT32_C(    35652097), -INT32_C(   268452035), -INT32_C(         162), -INT32_C(         159), -INT32_C(         393),  INT32_C(    17302272),  INT32_C(   212949047) } },
+    { { -INT32_C(   151261190),  INT32_C(   268435780), -INT32_C(       73762), -INT32_C(          37), -INT32_C(    33685505),  INT32_C(  1360219311),  INT32_C(  1073381374),  INT32_C(           4) },
+      UINT8_C(197),
+      { -INT64_C(                 428),  INT64_C(                 804), -INT64_C(                 480),  INT64_C(                 996),
+         INT64_C(                 292),  INT64_C(                 464), -INT64_C(                 628),  INT64_C(                 816) },
+      { -INT32_C(         321),  INT32_C(   268435780), -INT32_C(         360), -INT32_C(          37), -INT32_C(    33685505),  INT32_C(  1360219311), -INT32_C(         471),  INT32_C(         612) } },
+    { { -INT32_C(    18874369),  INT32_C(  1647040403), -INT32_C(    18219009), -INT32_C(  1710219041), -INT32_C(  1792894777),  INT32_C(      528400), -INT32_C(  1188464007),  INT32_C(   201089910) },
+      UINT8_C(164),
+      {  INT64_C(                 772), -INT64_C(                 768),  INT64_C(                 424), -INT64_C(                 136),
+        -INT64_C(                 188),  INT64_C(                1004),  INT64_C(                 460), -INT64_C(                 864) },
+      { -INT32_C(    18874369),  INT32_C(  1647040403),  INT32_C(         318), -INT32_C(  1710219041), -INT32_C(  1792894777),  INT32_C(         753), -INT32_C(  1188464007), -INT32_C(         648) } },
+    { {  INT32_C(  1462508184),  INT32_C(  1414445803), -INT32_C(   303104034), -INT32_C(  1351303126), -INT32_C(      133249),  INT32_C(  1382932186),  INT32_C(   268461120), -INT32_C(    34665451) },
+      UINT8_C( 83),
+      {  INT64_C(                 264),  INT64_C(                 524), -INT64_C(                 440),  INT64_C(                 104),
+        -INT64_C(                 576),  INT64_C(                 860),  INT64_C(                1008),  INT64_C(                  84) },
+      {  INT32_C(         198),  INT32_C(         393), -INT32_C(   303104034), -INT32_C(  1351303126), -INT32_C(         432),  INT32_C(  1382932186),  INT32_C(         756), -INT32_C(    34665451) } },
+    { { -INT32_C(   732771892), -INT32_C(    18874369), -INT32_C(     5242882),  INT32_C(    67109184), -INT32_C(     4194317), -INT32_C(    67108897), -INT32_C(  1235163118),  INT32_C(     2099232) },
+      UINT8_C(175),
+      { -INT64_C(                 328),  INT64_C(                 592),  INT64_C(                 116), -INT64_C(                 224),
+        -INT64_C(                 936),  INT64_C(                 200),  INT64_C(                 900), -INT64_C(                 916) },
+      { -INT32_C(         246),  INT32_C(         444),  INT32_C(          87), -INT32_C(         168), -INT32_C(     4194317),  INT32_C(         150), -INT32_C(  1235163118), -INT32_C(         687) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i r = simde_mm512_mask_i64gather_epi32(src, test_vec[i].k, vindex, &(i32_buffer[2048]), 1);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C(                  66),  INT64_C(                 188),  INT64_C(                 223), -INT64_C(                 191),
+         INT64_C(                 164), -INT64_C(                 205),  INT64_C(                  10),  INT64_C(                 115) },
+      { -INT64_C(        283467841602),  INT64_C(        807453851836),  INT64_C(        957777707231), -INT64_C(        820338753727),
+         INT64_C(        704374636708), -INT64_C(        880468295885),  INT64_C(         42949672970),  INT64_C(        493921239155) } },
+    { { -INT64_C(                 253),  INT64_C(                 167),  INT64_C(                 156), -INT64_C(                  32),
+        -INT64_C(                 154),  INT64_C(                  71),  INT64_C(                 198), -INT64_C(                 245) },
+      { -INT64_C(       1086626726141),  INT64_C(        717259538599),  INT64_C(        670014898332), -INT64_C(        137438953504),
+        -INT64_C(        661424963738),  INT64_C(        304942678087),  INT64_C(        850403524806), -INT64_C(       1052266987765) } },
+    { { -INT64_C(                  89), -INT64_C(                 216),  INT64_C(                 105), -INT64_C(                  22),
+         INT64_C(                  71), -INT64_C(                 165), -INT64_C(                 197),  INT64_C(                 162) },
+      { -INT64_C(        382252089433), -INT64_C(        927712936152),  INT64_C(        450971566185), -INT64_C(         94489280534),
+         INT64_C(        304942678087), -INT64_C(        708669604005), -INT64_C(        846108557509),  INT64_C(        695784702114) } },
+    { { -INT64_C(                 237), -INT64_C(                 118), -INT64_C(                 101), -INT64_C(                  41),
+        -INT64_C(                 202), -INT64_C(                 152), -INT64_C(                 175), -INT64_C(                  70) },
+      { -INT64_C(       1017907249389), -INT64_C(        506806141046), -INT64_C(        433791696997), -INT64_C(        176093659177),
+        -INT64_C(        867583393994), -INT64_C(        652835029144), -INT64_C(        751619276975), -INT64_C(        300647710790) } },
+    { {  INT64_C(                  94),  INT64_C(                  92),  INT64_C(                 118), -INT64_C(                 249),
+        -INT64_C(                 129),  INT64_C(                 224), -INT64_C(                 207),  INT64_C(                 125) },
+      {  INT64_C(        403726925918),  INT64_C(        395136991324),  INT64_C(        506806141046), -INT64_C(       1069446856953),
+        -INT64_C(        554050781313),  INT64_C(        962072674528), -INT64_C(        889058230479),  INT64_C(        536870912125) } },
+    { { -INT64_C(                  22), -INT64_C(                  62), -INT64_C(                  19),  INT64_C(                  95),
+         INT64_C(                 210),  INT64_C(                 247),  INT64_C(                 112), -INT64_C(                  43) },
+      { -INT64_C(         94489280534), -INT64_C(        266287972414), -INT64_C(         81604378643),  INT64_C(        408021893215),
+         INT64_C(        901943132370),  INT64_C(       1060856922359),  INT64_C(        481036337264), -INT64_C(        184683593771) } },
+    { { -INT64_C(                 161),  INT64_C(                 190),  INT64_C(                 168), -INT64_C(                  28),
+        -INT64_C(                 157),  INT64_C(                  16), -INT64_C(                  67), -INT64_C(                 101) },
+      { -INT64_C(        691489734817),  INT64_C(        816043786430),  INT64_C(        721554505896), -INT64_C(        120259084316),
+        -INT64_C(        674309865629),  INT64_C(         68719476752), -INT64_C(        287762808899), -INT64_C(        433791696997) } },
+    { {  INT64_C(                  61),  INT64_C(                  24),  INT64_C(                  57),  INT64_C(                 218),
+         INT64_C(                 250), -INT64_C(                 105), -INT64_C(                  67),  INT64_C(                  27) },
+      {  INT64_C(        261993005117),  INT64_C(        103079215128),  INT64_C(        244813135929),  INT64_C(        936302870746),
+         INT64_C(       1073741824250), -INT64_C(        450971566185), -INT64_C(        287762808899),  INT64_C(        115964117019) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i64gather_epi64(vindex, &(i64_buffer[2048]), 8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(  941819672536285200),  INT64_C(     149570088599568), -INT64_C( 6867807516764124599), -INT64_C( 6981001513218682670),
+        -INT64_C( 3751709600731104257),  INT64_C( 7495183302506618486),  INT64_C( 4715548657022517320),  INT64_C( 2070214482465493166) },
+         UINT8_MAX,
+      { -INT64_C(                 988), -INT64_C(                 140), -INT64_C(                 672),  INT64_C(                 152),
+        -INT64_C(                 104), -INT64_C(                 688),  INT64_C(                 872), -INT64_C(                 468) },
+      { -INT64_C(       1060856922359), -INT64_C(        150323855395), -INT64_C(        721554505896),  INT64_C(        163208757286),
+        -INT64_C(        111669149722), -INT64_C(        738734375084),  INT64_C(        936302870746), -INT64_C(        502511173749) } },
+    { {  INT64_C( 4383029556896572027), -INT64_C(   41206535921467703), -INT64_C( 5952427518477975095), -INT64_C(  650770146156086341),
+         INT64_C(     299068383453696),  INT64_C( 1803973125877268480),  INT64_C( 1989646598606757151), -INT64_C(  395294227254025699) },
+      UINT8_C(150),
+      {  INT64_C(                 112), -INT64_C(                 600),  INT64_C(                 448),  INT64_C(                 308),
+         INT64_C(                  56),  INT64_C(                 292), -INT64_C(                 292), -INT64_C(                 792) },
+      {  INT64_C( 4383029556896572027), -INT64_C(        644245094550),  INT64_C(        481036337264), -INT64_C(  650770146156086341),
+         INT64_C(         60129542158),  INT64_C( 1803973125877268480),  INT64_C( 1989646598606757151), -INT64_C(        850403524806) } },
+    { { -INT64_C( 7329807585350944610), -INT64_C(  576742236962691073),  INT64_C( 4339923506974561993), -INT64_C(               16713),
+         INT64_C( 5559101184643628970),  INT64_C( 4638997887261508096),  INT64_C( 5692549890332138907), -INT64_C( 4612812055787864769) },
+      UINT8_C(248),
+      { -INT64_C(                 560), -INT64_C(                  16), -INT64_C(                 972), -INT64_C(                 804),
+         INT64_C(                 640),  INT64_C(                   0), -INT64_C(                 512),  INT64_C(                 952) },
+      { -INT64_C( 7329807585350944610), -INT64_C(  576742236962691073),  INT64_C( 4339923506974561993), -INT64_C(        863288426697),
+         INT64_C(        687194767520),  INT64_C(                   0), -INT64_C(        549755814016),  INT64_C(       1022202216686) } },
+    { {  INT64_C( 6897556663056930862), -INT64_C( 4696132909488177153), -INT64_C( 9205171531791840342), -INT64_C( 1562440783380086620),
+         INT64_C(    5787837941678592),  INT64_C(  144115193754952704),  INT64_C( 4264322257104906708),  INT64_C( 3752841541985126998) },
+      UINT8_C( 58),
+      {  INT64_C(                 672),  INT64_C(                 312),  INT64_C(                 276),  INT64_C(                 984),
+         INT64_C(                 872), -INT64_C(                 780), -INT64_C(                 932), -INT64_C(                 724) },
+      {  INT64_C( 6897556663056930862),  INT64_C(        335007449166), -INT64_C( 9205171531791840342),  INT64_C(       1056561955062),
+         INT64_C(        936302870746), -INT64_C(        837518622915),  INT64_C( 4264322257104906708),  INT64_C( 3752841541985126998) } },
+    { { -INT64_C( 1168684897889157189),  INT64_C( 4576387793389274556),  INT64_C(    9218340115710368), -INT64_C( 6822805006255152699),
+         INT64_C( 9126170704219442040),  INT64_C( 4259323059606823598), -INT64_C(   27022697275983937), -INT64_C( 2735837258433330416) },
+      UINT8_C(156),
+      { -INT64_C(                  96), -INT64_C(                  92), -INT64_C(                 348), -INT64_C(                 564),
+        -INT64_C(                  32),  INT64_C(                 184),  INT64_C(                 140),  INT64_C(                 652) },
+      { -INT64_C( 1168684897889157189),  INT64_C( 4576387793389274556), -INT64_C(        373662154839), -INT64_C(        605590388877),
+        -INT64_C(         34359738376),  INT64_C( 4259323059606823598), -INT64_C(   27022697275983937),  INT64_C(        700079669411) } },
+    { {  INT64_C( 7440944984003509328), -INT64_C( 5596817563617136812),  INT64_C(  376887802080640435),  INT64_C( 1448757821837840798),
+        -INT64_C( 2305843009213890649), -INT64_C(  458770770246951623),  INT64_C( 1375937793785539314),  INT64_C( 1336023722607589147) },
+      UINT8_C( 60),
+      {  INT64_C(                 900), -INT64_C(                  40),  INT64_C(                 508), -INT64_C(                 764),
+        -INT64_C(                 760), -INT64_C(                 188), -INT64_C(                 224), -INT64_C(                  44) },
+      {  INT64_C( 7440944984003509328), -INT64_C( 5596817563617136812),  INT64_C(        545460846719), -INT64_C(        820338753727),
+        -INT64_C(        816043786430), -INT64_C(        201863462959),  INT64_C( 1375937793785539314),  INT64_C( 1336023722607589147) } },
+    { { -INT64_C(   54201811086606339), -INT64_C( 2141084239868727475), -INT64_C( 8986618917698524339),  INT64_C(  289358477229359680),
+        -INT64_C( 6940049833092712451),  INT64_C( 3302222867116382406), -INT64_C( 9182417324664159616), -INT64_C( 6173427246946613518) },
+      UINT8_C(155),
+      {  INT64_C(                 288), -INT64_C(                 736), -INT64_C(                 564), -INT64_C(                 456),
+        -INT64_C(                 272), -INT64_C(                 264),  INT64_C(                 532),  INT64_C(                 648) },
+      {  INT64_C(        309237645384), -INT64_C(        790273982648), -INT64_C( 8986618917698524339), -INT64_C(        489626271858),
+        -INT64_C(        292057776196),  INT64_C( 3302222867116382406), -INT64_C( 9182417324664159616),  INT64_C(        695784702114) } },
+    { {  INT64_C( 4744597357686999985), -INT64_C(      35184447651857), -INT64_C( 2306023331674982401), -INT64_C(  328762725214191171),
+         INT64_C(  144124001348766016),  INT64_C(  843176055575514435),  INT64_C(  914732793180749768), -INT64_C( 8491879827409652112) },
+      UINT8_C(166),
+      { -INT64_C(                 908), -INT64_C(                 160),  INT64_C(                 828), -INT64_C(                 928),
+         INT64_C(                 212), -INT64_C(                 704),  INT64_C(                 760), -INT64_C(                 216) },
+      {  INT64_C( 4744597357686999985), -INT64_C(        171798691880),  INT64_C(        889058230479), -INT64_C(  328762725214191171),
+         INT64_C(  144124001348766016), -INT64_C(        755914244272),  INT64_C(  914732793180749768), -INT64_C(        231928234038) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i64gather_epi64(src, test_vec[i].k, vindex, &(i64_buffer[2048]), 2);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { -INT64_C(                  23), -INT64_C(                  51),  INT64_C(                 216), -INT64_C(                  18),
+        -INT64_C(                 247),  INT64_C(                 101),  INT64_C(                 196),  INT64_C(                  97) },
+      { SIMDE_FLOAT32_C(   -11.50), SIMDE_FLOAT32_C(   -25.50), SIMDE_FLOAT32_C(   108.00), SIMDE_FLOAT32_C(    -9.00),
+        SIMDE_FLOAT32_C(  -123.50), SIMDE_FLOAT32_C(    50.50), SIMDE_FLOAT32_C(    98.00), SIMDE_FLOAT32_C(    48.50) } },
+    { { -INT64_C(                  29), -INT64_C(                 125),  INT64_C(                 235), -INT64_C(                 214),
+         INT64_C(                  71),  INT64_C(                 168),  INT64_C(                 216),  INT64_C(                  14) },
+      { SIMDE_FLOAT32_C(   -14.50), SIMDE_FLOAT32_C(   -62.50), SIMDE_FLOAT32_C(   117.50), SIMDE_FLOAT32_C(  -107.00),
+        SIMDE_FLOAT32_C(    35.50), SIMDE_FLOAT32_C(    84.00), SIMDE_FLOAT32_C(   108.00), SIMDE_FLOAT32_C(     7.00) } },
+    { {  INT64_C(                  12), -INT64_C(                 172), -INT64_C(                 133),  INT64_C(                  65),
+         INT64_C(                 103), -INT64_C(                  85), -INT64_C(                  98),  INT64_C(                   5) },
+      { SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(   -86.00), SIMDE_FLOAT32_C(   -66.50), SIMDE_FLOAT32_C(    32.50),
+        SIMDE_FLOAT32_C(    51.50), SIMDE_FLOAT32_C(   -42.50), SIMDE_FLOAT32_C(   -49.00), SIMDE_FLOAT32_C(     2.50) } },
+    { {  INT64_C(                 166),  INT64_C(                  90), -INT64_C(                 166), -INT64_C(                  43),
+         INT64_C(                 186), -INT64_C(                  30), -INT64_C(                 148),  INT64_C(                  91) },
+      { SIMDE_FLOAT32_C(    83.00), SIMDE_FLOAT32_C(    45.00), SIMDE_FLOAT32_C(   -83.00), SIMDE_FLOAT32_C(   -21.50),
+        SIMDE_FLOAT32_C(    93.00), SIMDE_FLOAT32_C(   -15.00), SIMDE_FLOAT32_C(   -74.00), SIMDE_FLOAT32_C(    45.50) } },
+    { {  INT64_C(                 161),  INT64_C(                  89),  INT64_C(                  38), -INT64_C(                 246),
+         INT64_C(                 239), -INT64_C(                 131),  INT64_C(                  41),  INT64_C(                 240) },
+      { SIMDE_FLOAT32_C(    80.50), SIMDE_FLOAT32_C(    44.50), SIMDE_FLOAT32_C(    19.00), SIMDE_FLOAT32_C(  -123.00),
+        SIMDE_FLOAT32_C(   119.50), SIMDE_FLOAT32_C(   -65.50), SIMDE_FLOAT32_C(    20.50), SIMDE_FLOAT32_C(   120.00) } },
+    { {  INT64_C(                  86),  INT64_C(                 103),  INT64_C(                 167), -INT64_C(                  76),
+        -INT64_C(                 228), -INT64_C(                   3),  INT64_C(                  58), -INT64_C(                 125) },
+      { SIMDE_FLOAT32_C(    43.00), SIMDE_FLOAT32_C(    51.50), SIMDE_FLOAT32_C(    83.50), SIMDE_FLOAT32_C(   -38.00),
+        SIMDE_FLOAT32_C(  -114.00), SIMDE_FLOAT32_C(    -1.50), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(   -62.50) } },
+    { {  INT64_C(                 240),  INT64_C(                 205),  INT64_C(                 161), -INT64_C(                  71),
+         INT64_C(                 103),  INT64_C(                 252), -INT64_C(                 137), -INT64_C(                 160) },
+      { SIMDE_FLOAT32_C(   120.00), SIMDE_FLOAT32_C(   102.50), SIMDE_FLOAT32_C(    80.50), SIMDE_FLOAT32_C(   -35.50),
+        SIMDE_FLOAT32_C(    51.50), SIMDE_FLOAT32_C(   126.00), SIMDE_FLOAT32_C(   -68.50), SIMDE_FLOAT32_C(   -80.00) } },
+    { { -INT64_C(                   4),  INT64_C(                 218), -INT64_C(                  49),  INT64_C(                  92),
+         INT64_C(                 192), -INT64_C(                 105),  INT64_C(                  77),  INT64_C(                 231) },
+      { SIMDE_FLOAT32_C(    -2.00), SIMDE_FLOAT32_C(   109.00), SIMDE_FLOAT32_C(   -24.50), SIMDE_FLOAT32_C(    46.00),
+        SIMDE_FLOAT32_C(    96.00), SIMDE_FLOAT32_C(   -52.50), SIMDE_FLOAT32_C(    38.50), SIMDE_FLOAT32_C(   115.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 r = simde_mm512_i64gather_ps(vindex, &(f32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -5379.75), SIMDE_FLOAT32_C( -9063.25), SIMDE_FLOAT32_C(  3125.25), SIMDE_FLOAT32_C(  5700.50),
+        SIMDE_FLOAT32_C(  2623.00), SIMDE_FLOAT32_C(  -198.75), SIMDE_FLOAT32_C( -9595.00), SIMDE_FLOAT32_C(  2689.25) },
+         UINT8_MAX,
+      { -INT64_C(                  66), -INT64_C(                  27), -INT64_C(                 111),  INT64_C(                   0),
+         INT64_C(                 175), -INT64_C(                  14),  INT64_C(                 151),  INT64_C(                 198) },
+      { SIMDE_FLOAT32_C(   -33.00), SIMDE_FLOAT32_C(   -13.50), SIMDE_FLOAT32_C(   -55.50), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    87.50), SIMDE_FLOAT32_C(    -7.00), SIMDE_FLOAT32_C(    75.50), SIMDE_FLOAT32_C(    99.00) } },
+    { { SIMDE_FLOAT32_C( -8265.75), SIMDE_FLOAT32_C( -8549.75), SIMDE_FLOAT32_C(  9808.00), SIMDE_FLOAT32_C(  1429.25),
+        SIMDE_FLOAT32_C( -2336.50), SIMDE_FLOAT32_C( -1913.25), SIMDE_FLOAT32_C(  4518.00), SIMDE_FLOAT32_C(  8309.50) },
+      UINT8_C(150),
+      {  INT64_C(                 238), -INT64_C(                 227), -INT64_C(                  87),  INT64_C(                 144),
+        -INT64_C(                  69),  INT64_C(                 200), -INT64_C(                  11), -INT64_C(                  27) },
+      { SIMDE_FLOAT32_C( -8265.75), SIMDE_FLOAT32_C(  -113.50), SIMDE_FLOAT32_C(   -43.50), SIMDE_FLOAT32_C(  1429.25),
+        SIMDE_FLOAT32_C(   -34.50), SIMDE_FLOAT32_C( -1913.25), SIMDE_FLOAT32_C(  4518.00), SIMDE_FLOAT32_C(   -13.50) } },
+    { { SIMDE_FLOAT32_C(  9052.50), SIMDE_FLOAT32_C(  7359.00), SIMDE_FLOAT32_C(  -479.25), SIMDE_FLOAT32_C( -3368.50),
+        SIMDE_FLOAT32_C( -3032.25), SIMDE_FLOAT32_C(  3450.00), SIMDE_FLOAT32_C(  9542.25), SIMDE_FLOAT32_C(  5291.75) },
+      UINT8_C(213),
+      {  INT64_C(                 249), -INT64_C(                  86),  INT64_C(                  14),  INT64_C(                 255),
+        -INT64_C(                 142), -INT64_C(                 178),  INT64_C(                 223),  INT64_C(                 141) },
+      { SIMDE_FLOAT32_C(   124.50), SIMDE_FLOAT32_C(  7359.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C( -3368.50),
+        SIMDE_FLOAT32_C(   -71.00), SIMDE_FLOAT32_C(  3450.00), SIMDE_FLOAT32_C(   111.50), SIMDE_FLOAT32_C(    70.50) } },
+    { { SIMDE_FLOAT32_C( -6606.25), SIMDE_FLOAT32_C(  7021.75), SIMDE_FLOAT32_C(  -722.50), SIMDE_FLOAT32_C(  6446.75),
+        SIMDE_FLOAT32_C(  1690.00), SIMDE_FLOAT32_C(  8135.00), SIMDE_FLOAT32_C(  1620.75), SIMDE_FLOAT32_C( -8888.50) },
+      UINT8_C( 43),
+      {  INT64_C(                  67),  INT64_C(                 161),  INT64_C(                 220), -INT64_C(                  89),
+         INT64_C(                 213), -INT64_C(                 111), -INT64_C(                  16),  INT64_C(                 224) },
+      { SIMDE_FLOAT32_C(    33.50), SIMDE_FLOAT32_C(    80.50), SIMDE_FLOAT32_C(  -722.50), SIMDE_FLOAT32_C(   -44.50),
+        SIMDE_FLOAT32_C(  1690.00), SIMDE_FLOAT32_C(   -55.50), SIMDE_FLOAT32_C(  1620.75), SIMDE_FLOAT32_C( -8888.50) } },
+    { { SIMDE_FLOAT32_C(  5708.75), SIMDE_FLOAT32_C(  4411.25), SIMDE_FLOAT32_C( -2657.25), SIMDE_FLOAT32_C(  8542.25),
+        SIMDE_FLOAT32_C(  -142.25), SIMDE_FLOAT32_C( -9238.25), SIMDE_FLOAT32_C(  4793.25), SIMDE_FLOAT32_C(  1886.50) },
+      UINT8_C( 26),
+      { -INT64_C(                  88),  INT64_C(                 246),  INT64_C(                 129),  INT64_C(                 231),
+         INT64_C(                 167),  INT64_C(                 121),  INT64_C(                 219),  INT64_C(                  39) },
+      { SIMDE_FLOAT32_C(  5708.75), SIMDE_FLOAT32_C(   123.00), SIMDE_FLOAT32_C( -2657.25), SIMDE_FLOAT32_C(   115.50),
+        SIMDE_FLOAT32_C(    83.50), SIMDE_FLOAT32_C( -9238.25), SIMDE_FLOAT32_C(  4793.25), SIMDE_FLOAT32_C(  1886.50) } },
+    { { SIMDE_FLOAT32_C(  3936.50), SIMDE_FLOAT32_C(  -903.25), SIMDE_FLOAT32_C( -6719.00), SIMDE_FLOAT32_C(  2718.00),
+        SIMDE_FLOAT32_C( -8580.50), SIMDE_FLOAT32_C( -3745.75), SIMDE_FLOAT32_C( -5631.50), SIMDE_FLOAT32_C( -5050.75) },
+      UINT8_C(194),
+      { -INT64_C(                  46), -INT64_C(                   3),  INT64_C(                 239),  INT64_C(                 124),
+         INT64_C(                 211), -INT64_C(                 132),  INT64_C(                  46), -INT64_C(                 158) },
+      { SIMDE_FLOAT32_C(  3936.50), SIMDE_FLOAT32_C(    -1.50), SIMDE_FLOAT32_C( -6719.00), SIMDE_FLOAT32_C(  2718.00),
+        SIMDE_FLOAT32_C( -8580.50), SIMDE_FLOAT32_C( -3745.75), SIMDE_FLOAT32_C(    23.00), SIMDE_FLOAT32_C(   -79.00) } },
+    { { SIMDE_FLOAT32_C( -1373.50), SIMDE_FLOAT32_C(  4462.00), SIMDE_FLOAT32_C( -9992.50), SIMDE_FLOAT32_C(  6919.00),
+        SIMDE_FLOAT32_C(   159.00), SIMDE_FLOAT32_C(  8074.00), SIMDE_FLOAT32_C( -7702.50), SIMDE_FLOAT32_C( -3209.25) },
+      UINT8_C(188),
+      {  INT64_C(                 149),  INT64_C(                 207), -INT64_C(                 181),  INT64_C(                 179),
+         INT64_C(                 147),  INT64_C(                 243),  INT64_C(                 225),  INT64_C(                 164) },
+      { SIMDE_FLOAT32_C( -1373.50), SIMDE_FLOAT32_C(  4462.00), SIMDE_FLOAT32_C(   -90.50), SIMDE_FLOAT32_C(    89.50),
+        SIMDE_FLOAT32_C(    73.50), SIMDE_FLOAT32_C(   121.50), SIMDE_FLOAT32_C( -7702.50), SIMDE_FLOAT32_C(    82.00) } },
+    { { SIMDE_FLOAT32_C( -5284.25), SIMDE_FLOAT32_C( -3385.25), SIMDE_FLOAT32_C( -6540.25), SIMDE_FLOAT32_C( -9634.50),
+        SIMDE_FLOAT32_C(  1180.25), SIMDE_FLOAT32_C(  4947.50), SIMDE_FLOAT32_C(  8040.25), SIMDE_FLOAT32_C( -2183.25) },
+      UINT8_C( 25),
+      { -INT64_C(                 150), -INT64_C(                  52),  INT64_C(                  78), -INT64_C(                 255),
+         INT64_C(                  85), -INT64_C(                  51), -INT64_C(                 176),  INT64_C(                 227) },
+      { SIMDE_FLOAT32_C(   -75.00), SIMDE_FLOAT32_C( -3385.25), SIMDE_FLOAT32_C( -6540.25), SIMDE_FLOAT32_C(  -127.50),
+        SIMDE_FLOAT32_C(    42.50), SIMDE_FLOAT32_C(  4947.50), SIMDE_FLOAT32_C(  8040.25), SIMDE_FLOAT32_C( -2183.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 r = simde_mm512_mask_i64gather_ps(src, test_vec[i].k, vindex, &(f32_buffer[2048]), 4);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { {  INT64_C(                 138), -INT64_C(                 205), -INT64_C(                 162),  INT64_C(                  90),
+         INT64_C(                   0), -INT64_C(                 213), -INT64_C(                 193),  INT64_C(                 154) },
+      { SIMDE_FLOAT64_C(    34.50), SIMDE_FLOAT64_C(   -51.25), SIMDE_FLOAT64_C(   -40.50), SIMDE_FLOAT64_C(    22.50),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -53.25), SIMDE_FLOAT64_C(   -48.25), SIMDE_FLOAT64_C(    38.50) } },
+    { { -INT64_C(                  75), -INT64_C(                  73), -INT64_C(                  85),  INT64_C(                  91),
+        -INT64_C(                 162),  INT64_C(                 150), -INT64_C(                  48),  INT64_C(                 127) },
+      { SIMDE_FLOAT64_C(   -18.75), SIMDE_FLOAT64_C(   -18.25), SIMDE_FLOAT64_C(   -21.25), SIMDE_FLOAT64_C(    22.75),
+        SIMDE_FLOAT64_C(   -40.50), SIMDE_FLOAT64_C(    37.50), SIMDE_FLOAT64_C(   -12.00), SIMDE_FLOAT64_C(    31.75) } },
+    { { -INT64_C(                  58),  INT64_C(                 250),  INT64_C(                  16),  INT64_C(                  89),
+         INT64_C(                 166), -INT64_C(                 183),  INT64_C(                  11), -INT64_C(                  32) },
+      { SIMDE_FLOAT64_C(   -14.50), SIMDE_FLOAT64_C(    62.50), SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(    22.25),
+        SIMDE_FLOAT64_C(    41.50), SIMDE_FLOAT64_C(   -45.75), SIMDE_FLOAT64_C(     2.75), SIMDE_FLOAT64_C(    -8.00) } },
+    { {  INT64_C(                 212),  INT64_C(                 136),  INT64_C(                 174), -INT64_C(                 163),
+         INT64_C(                  86), -INT64_C(                 131), -INT64_C(                 159), -INT64_C(                 102) },
+      { SIMDE_FLOAT64_C(    53.00), SIMDE_FLOAT64_C(    34.00), SIMDE_FLOAT64_C(    43.50), SIMDE_FLOAT64_C(   -40.75),
+        SIMDE_FLOAT64_C(    21.50), SIMDE_FLOAT64_C(   -32.75), SIMDE_FLOAT64_C(   -39.75), SIMDE_FLOAT64_C(   -25.50) } },
+    { {  INT64_C(                 116), -INT64_C(                 232),  INT64_C(                 191),  INT64_C(                 140),
+         INT64_C(                 151),  INT64_C(                 215),  INT64_C(                 244),  INT64_C(                  89) },
+      { SIMDE_FLOAT64_C(    29.00), SIMDE_FLOAT64_C(   -58.00), SIMDE_FLOAT64_C(    47.75), SIMDE_FLOAT64_C(    35.00),
+        SIMDE_FLOAT64_C(    37.75), SIMDE_FLOAT64_C(    53.75), SIMDE_FLOAT64_C(    61.00), SIMDE_FLOAT64_C(    22.25) } },
+    { { -INT64_C(                 191),  INT64_C(                 114),  INT64_C(                 218), -INT64_C(                 133),
+         INT64_C(                 195), -INT64_C(                 113), -INT64_C(                  28), -INT64_C(                  44) },
+      { SIMDE_FLOAT64_C(   -47.75), SIMDE_FLOAT64_C(    28.50), SIMDE_FLOAT64_C(    54.50), SIMDE_FLOAT64_C(   -33.25),
+        SIMDE_FLOAT64_C(    48.75), SIMDE_FLOAT64_C(   -28.25), SIMDE_FLOAT64_C(    -7.00), SIMDE_FLOAT64_C(   -11.00) } },
+    { { -INT64_C(                  38), -INT64_C(                 220),  INT64_C(                 147), -INT64_C(                 161),
+         INT64_C(                 211),  INT64_C(                 122),  INT64_C(                  10), -INT64_C(                 151) },
+      { SIMDE_FLOAT64_C(    -9.50), SIMDE_FLOAT64_C(   -55.00), SIMDE_FLOAT64_C(    36.75), SIMDE_FLOAT64_C(   -40.25),
+        SIMDE_FLOAT64_C(    52.75), SIMDE_FLOAT64_C(    30.50), SIMDE_FLOAT64_C(     2.50), SIMDE_FLOAT64_C(   -37.75) } },
+    { {  INT64_C(                 255),  INT64_C(                  22),  INT64_C(                  60),  INT64_C(                  95),
+         INT64_C(                 252), -INT64_C(                 102),  INT64_C(                 113), -INT64_C(                 113) },
+      { SIMDE_FLOAT64_C(    63.75), SIMDE_FLOAT64_C(     5.50), SIMDE_FLOAT64_C(    15.00), SIMDE_FLOAT64_C(    23.75),
+        SIMDE_FLOAT64_C(    63.00), SIMDE_FLOAT64_C(   -25.50), SIMDE_FLOAT64_C(    28.25), SIMDE_FLOAT64_C(   -28.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_i64gather_pd(vindex, &(f64_buffer[2048]), 8);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  1844.50), SIMDE_FLOAT64_C( -1461.00), SIMDE_FLOAT64_C( -6063.00), SIMDE_FLOAT64_C(  3561.00),
+        SIMDE_FLOAT64_C(  3282.75), SIMDE_FLOAT64_C( -6029.75), SIMDE_FLOAT64_C(  4287.25), SIMDE_FLOAT64_C( -7389.75) },
+         UINT8_MAX,
+      { -INT64_C(                 728), -INT64_C(                 968), -INT64_C(                1176), -INT64_C(                 648),
+         INT64_C(                1232), -INT64_C(                 520), -INT64_C(                1616), -INT64_C(                 256) },
+      { SIMDE_FLOAT64_C(   -22.75), SIMDE_FLOAT64_C(   -30.25), SIMDE_FLOAT64_C(   -36.75), SIMDE_FLOAT64_C(   -20.25),
+        SIMDE_FLOAT64_C(    38.50), SIMDE_FLOAT64_C(   -16.25), SIMDE_FLOAT64_C(   -50.50), SIMDE_FLOAT64_C(    -8.00) } },
+    { { SIMDE_FLOAT64_C( -7634.75), SIMDE_FLOAT64_C(  5419.50), SIMDE_FLOAT64_C( -1446.75), SIMDE_FLOAT64_C(  5896.00),
+        SIMDE_FLOAT64_C(  4626.25), SIMDE_FLOAT64_C(  3714.75), SIMDE_FLOAT64_C( -4836.00), SIMDE_FLOAT64_C(  6585.75) },
+      UINT8_C( 31),
+      {  INT64_C(                1936), -INT64_C(                1960),  INT64_C(                1728), -INT64_C(                1488),
+        -INT64_C(                1552), -INT64_C(                 320), -INT64_C(                 344), -INT64_C(                1680) },
+      { SIMDE_FLOAT64_C(    60.50), SIMDE_FLOAT64_C(   -61.25), SIMDE_FLOAT64_C(    54.00), SIMDE_FLOAT64_C(   -46.50),
+        SIMDE_FLOAT64_C(   -48.50), SIMDE_FLOAT64_C(  3714.75), SIMDE_FLOAT64_C( -4836.00), SIMDE_FLOAT64_C(  6585.75) } },
+    { { SIMDE_FLOAT64_C(  8954.00), SIMDE_FLOAT64_C( -6077.50), SIMDE_FLOAT64_C( -8634.50), SIMDE_FLOAT64_C(  1845.50),
+        SIMDE_FLOAT64_C(   841.75), SIMDE_FLOAT64_C(  6900.00), SIMDE_FLOAT64_C(  6118.75), SIMDE_FLOAT64_C(  1468.25) },
+      UINT8_C( 48),
+      { -INT64_C(                 568),  INT64_C(                1184), -INT64_C(                1288),  INT64_C(                2040),
+        -INT64_C(                1032), -INT64_C(                 680),  INT64_C(                1520), -INT64_C(                1392) },
+      { SIMDE_FLOAT64_C(  8954.00), SIMDE_FLOAT64_C( -6077.50), SIMDE_FLOAT64_C( -8634.50), SIMDE_FLOAT64_C(  1845.50),
+        SIMDE_FLOAT64_C(   -32.25), SIMDE_FLOAT64_C(   -21.25), SIMDE_FLOAT64_C(  6118.75), SIMDE_FLOAT64_C(  1468.25) } },
+    { { SIMDE_FLOAT64_C( -6870.00), SIMDE_FLOAT64_C( -6802.25), SIMDE_FLOAT64_C( -7698.50), SIMDE_FLOAT64_C(  -937.00),
+        SIMDE_FLOAT64_C( -3848.25), SIMDE_FLOAT64_C(  2213.50), SIMDE_FLOAT64_C(  3273.50), SIMDE_FLOAT64_C( -5648.75) },
+      UINT8_C(223),
+      { -INT64_C(                1256), -INT64_C(                 728), -INT64_C(                1152),  INT64_C(                 136),
+        -INT64_C(                 832), -INT64_C(                 632),  INT64_C(                 280), -INT64_C(                 856) },
+      { SIMDE_FLOAT64_C(   -39.25), SIMDE_FLOAT64_C(   -22.75), SIMDE_FLOAT64_C(   -36.00), SIMDE_FLOAT64_C(     4.25),
+        SIMDE_FLOAT64_C(   -26.00), SIMDE_FLOAT64_C(  2213.50), SIMDE_FLOAT64_C(     8.75), SIMDE_FLOAT64_C(   -26.75) } },
+    { { SIMDE_FLOAT64_C( -4175.50), SIMDE_FLOAT64_C( -8830.50), SIMDE_FLOAT64_C(  8906.50), SIMDE_FLOAT64_C(  2285.25),
+        SIMDE_FLOAT64_C( -4866.50), SIMDE_FLOAT64_C( -2727.25), SIMDE_FLOAT64_C(  1408.75), SIMDE_FLOAT64_C( -4548.25) },
+      UINT8_C(216),
+      { -INT64_C(                1600), -INT64_C(                1248), -INT64_C(                 976),  INT64_C(                1976),
+        -INT64_C(                 472),  INT64_C(                1848), -INT64_C(                1904), -INT64_C(                 752) },
+      { SIMDE_FLOAT64_C( -4175.50), SIMDE_FLOAT64_C( -8830.50), SIMDE_FLOAT64_C(  8906.50), SIMDE_FLOAT64_C(    61.75),
+        SIMDE_FLOAT64_C(   -14.75), SIMDE_FLOAT64_C( -2727.25), SIMDE_FLOAT64_C(   -59.50), SIMDE_FLOAT64_C(   -23.50) } },
+    { { SIMDE_FLOAT64_C(  4086.00), SIMDE_FLOAT64_C(  9776.50), SIMDE_FLOAT64_C( -3554.25), SIMDE_FLOAT64_C(  5449.25),
+        SIMDE_FLOAT64_C( -1165.50), SIMDE_FLOAT64_C( -1654.75), SIMDE_FLOAT64_C( -9094.25), SIMDE_FLOAT64_C(  9074.75) },
+      UINT8_C( 38),
+      { -INT64_C(                1640),  INT64_C(                 280),  INT64_C(                1536), -INT64_C(                1568),
+        -INT64_C(                1024),  INT64_C(                 840), -INT64_C(                 944),  INT64_C(                  64) },
+      { SIMDE_FLOAT64_C(  4086.00), SIMDE_FLOAT64_C(     8.75), SIMDE_FLOAT64_C(    48.00), SIMDE_FLOAT64_C(  5449.25),
+        SIMDE_FLOAT64_C( -1165.50), SIMDE_FLOAT64_C(    26.25), SIMDE_FLOAT64_C( -9094.25), SIMDE_FLOAT64_C(  9074.75) } },
+    { { SIMDE_FLOAT64_C(  8760.25), SIMDE_FLOAT64_C(  1163.50), SIMDE_FLOAT64_C(  3659.25), SIMDE_FLOAT64_C( -7492.75),
+        SIMDE_FLOAT64_C(  8592.50), SIMDE_FLOAT64_C( -9194.00), SIMDE_FLOAT64_C(   529.25), SIMDE_FLOAT64_C(  5289.25) },
+      UINT8_C( 92),
+      {  INT64_C(                 656), -INT64_C(                 440),  INT64_C(                 960), -INT64_C(                1552),
+         INT64_C(                 672), -INT64_C(                1208), -INT64_C(                2032), -INT64_C(                  72) },
+      { SIMDE_FLOAT64_C(  8760.25), SIMDE_FLOAT64_C(  1163.50), SIMDE_FLOAT64_C(    30.00), SIMDE_FLOAT64_C(   -48.50),
+        SIMDE_FLOAT64_C(    21.00), SIMDE_FLOAT64_C( -9194.00), SIMDE_FLOAT64_C(   -63.50), SIMDE_FLOAT64_C(  5289.25) } },
+    { { SIMDE_FLOAT64_C(  7010.50), SIMDE_FLOAT64_C(  8442.25), SIMDE_FLOAT64_C( -3793.75), SIMDE_FLOAT64_C(   -32.00),
+        SIMDE_FLOAT64_C( -6249.75), SIMDE_FLOAT64_C( -9442.00), SIMDE_FLOAT64_C( -6968.50), SIMDE_FLOAT64_C(  3049.50) },
+      UINT8_C(200),
+      { -INT64_C(                1992), -INT64_C(                1760), -INT64_C(                2016), -INT64_C(                 720),
+        -INT64_C(                 664),  INT64_C(                1664),  INT64_C(                1032),  INT64_C(                1328) },
+      { SIMDE_FLOAT64_C(  7010.50), SIMDE_FLOAT64_C(  8442.25), SIMDE_FLOAT64_C( -3793.75), SIMDE_FLOAT64_C(   -22.50),
+        SIMDE_FLOAT64_C( -6249.75), SIMDE_FLOAT64_C( -9442.00), SIMDE_FLOAT64_C(    32.25), SIMDE_FLOAT64_C(    41.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_mask_i64gather_pd(src, test_vec[i].k, vindex, &(f64_buffer[2048]), 1);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -155,10 +155,94 @@ test_simde_mm_maskz_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(       11227), -INT32_C(      174636), -INT32_C(      273076),  INT32_C(         491),  INT32_C(           0),  INT32_C(      712618),  INT32_C(          11),  INT32_C(       23313) },
+      {  INT32_C(          18),  INT32_C(           0),  INT32_C(           0),  INT32_C(          23),  INT32_C(          32),  INT32_C(          12),  INT32_C(          28),  INT32_C(          17) } },
+    { {  INT32_C(          21), -INT32_C(        2683),  INT32_C(           8),  INT32_C(          10), -INT32_C(        3319),  INT32_C(       24321), -INT32_C(         113), -INT32_C(       74102) },
+      {  INT32_C(          27),  INT32_C(           0),  INT32_C(          28),  INT32_C(          28),  INT32_C(           0),  INT32_C(          17),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(          67),  INT32_C(           0),  INT32_C(           0),  INT32_C(     4177755),  INT32_C(       10469),  INT32_C(         207),  INT32_C(    15123640),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(          32),  INT32_C(          32),  INT32_C(          10),  INT32_C(          18),  INT32_C(          24),  INT32_C(           8),  INT32_C(          32) } },
+    { {  INT32_C(           0),  INT32_C(           0), -INT32_C(         373), -INT32_C(    30219722),  INT32_C(           0),  INT32_C(  1042717840), -INT32_C(    70677133),  INT32_C(    13691688) },
+      {  INT32_C(          32),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           2),  INT32_C(           0),  INT32_C(           8) } },
+    { {  INT32_C(   251900696),  INT32_C(     6137487),  INT32_C(           1), -INT32_C(      175505),  INT32_C(           0), -INT32_C(     3096962),  INT32_C(      135553), -INT32_C(         791) },
+      {  INT32_C(           4),  INT32_C(           9),  INT32_C(          31),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(          14),  INT32_C(           0) } },
+    { {  INT32_C(           6),  INT32_C(   340305286),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      471339), -INT32_C(         125) },
+      {  INT32_C(          29),  INT32_C(           3),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          13),  INT32_C(           0) } },
+    { {  INT32_C(     2489190),  INT32_C(           0),  INT32_C(      915511),  INT32_C(         546),  INT32_C(           0),  INT32_C(           0),  INT32_C(   376928460), -INT32_C(   173255766) },
+      {  INT32_C(          10),  INT32_C(          32),  INT32_C(          12),  INT32_C(          22),  INT32_C(          32),  INT32_C(          32),  INT32_C(           3),  INT32_C(           0) } },
+    { {            INT32_MIN,  INT32_C(    64280069),  INT32_C(           0),  INT32_C(       52545),  INT32_C(           0),  INT32_C(       68143),  INT32_C(      601122),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           6),  INT32_C(          32),  INT32_C(          16),  INT32_C(          32),  INT32_C(          15),  INT32_C(          12),  INT32_C(          32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_lzcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(           0),  INT32_C(         273), -INT32_C(        2136),  INT32_C(           0),  INT32_C(           0),  INT32_C(   460224377),  INT32_C(   134167742),
+         INT32_C(     2609411), -INT32_C(   117482497),  INT32_C(         120),  INT32_C(     3776428),  INT32_C(           0), -INT32_C(       10877), -INT32_C(         213), -INT32_C(          16) },
+      {  INT32_C(          32),  INT32_C(          32),  INT32_C(          23),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32),  INT32_C(           3),  INT32_C(           5),
+         INT32_C(          10),  INT32_C(           0),  INT32_C(          25),  INT32_C(          10),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(      803489),  INT32_C(       30468),  INT32_C(           0), -INT32_C(      262724),  INT32_C(         660),  INT32_C(   115051763),  INT32_C(  2060151954),  INT32_C(        6879),
+         INT32_C(           0),  INT32_C(       14792),  INT32_C(           0),  INT32_C(        2172), -INT32_C(        1337),  INT32_C(           0),  INT32_C(      119808),  INT32_C(           0) },
+      {  INT32_C(          12),  INT32_C(          17),  INT32_C(          32),  INT32_C(           0),  INT32_C(          22),  INT32_C(           5),  INT32_C(           1),  INT32_C(          19),
+         INT32_C(          32),  INT32_C(          18),  INT32_C(          32),  INT32_C(          20),  INT32_C(           0),  INT32_C(          32),  INT32_C(          15),  INT32_C(          32) } },
+    { {  INT32_C(           0),  INT32_C(     7817048),  INT32_C(    11431243), -INT32_C(        9678), -INT32_C(    12183649),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1664362560),
+         INT32_C(         147),  INT32_C(           4),  INT32_C(       11083),  INT32_C(           0),  INT32_C(        1537),  INT32_C(          19),  INT32_C(           0),  INT32_C(         105) },
+      {  INT32_C(          32),  INT32_C(           9),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32),  INT32_C(           1),
+         INT32_C(          24),  INT32_C(          29),  INT32_C(          18),  INT32_C(          32),  INT32_C(          21),  INT32_C(          27),  INT32_C(          32),  INT32_C(          25) } },
+    { {  INT32_C(           0),  INT32_C(           0), -INT32_C(        1691),  INT32_C(        6882),  INT32_C(          29),  INT32_C(           0), -INT32_C(   100613536),  INT32_C(   148865192),
+         INT32_C(         651), -INT32_C(      103352),  INT32_C(     1382955),  INT32_C(   106991544),  INT32_C(     1813049),  INT32_C(           0),  INT32_C(    94770572), -INT32_C(          19) },
+      {  INT32_C(          32),  INT32_C(          32),  INT32_C(           0),  INT32_C(          19),  INT32_C(          27),  INT32_C(          32),  INT32_C(           0),  INT32_C(           4),
+         INT32_C(          22),  INT32_C(           0),  INT32_C(          11),  INT32_C(           5),  INT32_C(          11),  INT32_C(          32),  INT32_C(           5),  INT32_C(           0) } },
+    { { -INT32_C(          58),  INT32_C(    56326689), -INT32_C(   460422660),  INT32_C(     6779748),  INT32_C(     6926094),  INT32_C(           0),  INT32_C(           0),  INT32_C(    11909947),
+         INT32_C(        1722),  INT32_C(           0), -INT32_C(    93463185),  INT32_C(           0), -INT32_C(  1580192435),  INT32_C(         154),  INT32_C(   766406787), -INT32_C(      112135) },
+      {  INT32_C(           0),  INT32_C(           6),  INT32_C(           0),  INT32_C(           9),  INT32_C(           9),  INT32_C(          32),  INT32_C(          32),  INT32_C(           8),
+         INT32_C(          21),  INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(          24),  INT32_C(           2),  INT32_C(           0) } },
+    { {  INT32_C(     2642254),  INT32_C(           0),  INT32_C(    16502760),  INT32_C(     5196283),  INT32_C(           0),  INT32_C(          43),  INT32_C(        1317),  INT32_C(     3498096),
+         INT32_C(           0),  INT32_C(           1),  INT32_C(     7473419),  INT32_C(           0),  INT32_C(   517973996),  INT32_C(           0),  INT32_C(       29467),  INT32_C(      776101) },
+      {  INT32_C(          10),  INT32_C(          32),  INT32_C(           8),  INT32_C(           9),  INT32_C(          32),  INT32_C(          26),  INT32_C(          21),  INT32_C(          10),
+         INT32_C(          32),  INT32_C(          31),  INT32_C(           9),  INT32_C(          32),  INT32_C(           3),  INT32_C(          32),  INT32_C(          17),  INT32_C(          12) } },
+    { {  INT32_C(     1844680),  INT32_C(           7),  INT32_C(      591391),  INT32_C(    39795386),  INT32_C(          51),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(      502485),  INT32_C(           0),  INT32_C(      244029), -INT32_C(   217050170), -INT32_C(     1238542),  INT32_C(           0), -INT32_C(    79140704) },
+      {  INT32_C(          11),  INT32_C(          29),  INT32_C(          12),  INT32_C(           6),  INT32_C(          26),  INT32_C(          32),  INT32_C(          31),  INT32_C(          32),
+         INT32_C(          32),  INT32_C(          13),  INT32_C(          32),  INT32_C(          14),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0) } },
+    { {  INT32_C(      698474),  INT32_C(           0),  INT32_C(   125531051),  INT32_C(           0),  INT32_C(           0),  INT32_C(      402671),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(      377216),  INT32_C(         292), -INT32_C(    14079451),  INT32_C(           0),  INT32_C(     1676020),  INT32_C(        2348),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(          12),  INT32_C(          32),  INT32_C(           5),  INT32_C(          32),  INT32_C(          32),  INT32_C(          13),  INT32_C(          32),  INT32_C(          32),
+         INT32_C(          13),  INT32_C(          23),  INT32_C(           0),  INT32_C(          32),  INT32_C(          11),  INT32_C(          20),  INT32_C(          32),  INT32_C(          32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_lzcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_lzcnt_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_lzcnt_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_lzcnt_epi32)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
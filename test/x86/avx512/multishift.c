@@ -0,0 +1,1152 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN multishift
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/multishift.h>
+
+static int
+test_simde_mm_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int64_t b[2];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  25), -INT8_C(  71), -INT8_C(  81), -INT8_C(  55), -INT8_C(  60), -INT8_C(  31), -INT8_C(  25),  INT8_C(  38),
+         INT8_C(  66), -INT8_C(  84), -INT8_C(  94), -INT8_C(  39), -INT8_C(  25),  INT8_C(  25), -INT8_C(  33),  INT8_C(  83) },
+      { -INT64_C(   36033197213237443), -INT64_C(  146367537850875905) },
+      { -INT8_C(   9), -INT8_C(   1), -INT8_C(   1), -INT8_C(  33), -INT8_C(  13), -INT8_C(   1), -INT8_C(   9), -INT8_C(  17),
+        -INT8_C(   1),      INT8_MAX, -INT8_C(  33), -INT8_C(   7), -INT8_C(   2), -INT8_C(   7), -INT8_C(   1),  INT8_C( 119) } },
+    { { -INT8_C(  43),  INT8_C( 110),  INT8_C(  40),  INT8_C(  42),  INT8_C( 103), -INT8_C(  19), -INT8_C(  76), -INT8_C(  36),
+         INT8_C(  30), -INT8_C(  80),  INT8_C(  32), -INT8_C(   2), -INT8_C(  57), -INT8_C( 108),  INT8_C( 109),  INT8_C(  88) },
+      { -INT64_C(  151152201543356449), -INT64_C(  135862961727240408) },
+      { -INT8_C(   1), -INT8_C( 101), -INT8_C(   1), -INT8_C(  65), -INT8_C(   1),  INT8_C(  55), -INT8_C(  34), -INT8_C(   7),
+         INT8_C( 108),  INT8_C(  29),  INT8_C(  91), -INT8_C(  93),  INT8_C(  14), -INT8_C(  63), -INT8_C(  22),  INT8_C(  44) } },
+    { {  INT8_C( 107),  INT8_C(  70),  INT8_C(  27),  INT8_C(  99),  INT8_C(  25),  INT8_C(  55),  INT8_C(  61),  INT8_C(  50),
+        -INT8_C(  37),  INT8_C(  57),  INT8_C(  24),  INT8_C(  77),  INT8_C(  32), -INT8_C( 114),  INT8_C(  99), -INT8_C(  30) },
+      {  INT64_C( 9074682811553120155), -INT64_C(    1161307617232897) },
+      { -INT8_C(   9), -INT8_C(   2), -INT8_C(   2), -INT8_C(   3), -INT8_C(   5), -INT8_C(   5), -INT8_C(  37),  INT8_C( 123),
+             INT8_MAX, -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  53), -INT8_C(   1), -INT8_C(   7), -INT8_C(  14) } },
+    { {  INT8_C(  72),  INT8_C( 113),  INT8_C(  12), -INT8_C(  49), -INT8_C(  89),  INT8_C(  35), -INT8_C(  31), -INT8_C(  97),
+         INT8_C(  96), -INT8_C(  26), -INT8_C(  37), -INT8_C( 113),  INT8_C( 101),  INT8_C( 100),  INT8_C(  65),  INT8_C(   0) },
+      { -INT64_C( 7711564129752191079),  INT64_C( 4246133536395071235) },
+      { -INT8_C(  17),  INT8_C( 125), -INT8_C(  98), -INT8_C(  13),  INT8_C(  10), -INT8_C(  87), -INT8_C(  92), -INT8_C( 112),
+        -INT8_C(  12),  INT8_C(  47), -INT8_C( 118),  INT8_C( 103),  INT8_C(  95), -INT8_C(  65), -INT8_C( 127),  INT8_C(   3) } },
+    { { -INT8_C(  67),  INT8_C(  32),  INT8_C( 119), -INT8_C(  88), -INT8_C(  68), -INT8_C(  38),  INT8_C(  60),  INT8_C( 124),
+         INT8_C(  33),  INT8_C(  90), -INT8_C(  38), -INT8_C(  25),  INT8_C(  83), -INT8_C(   3), -INT8_C(  27), -INT8_C(  96) },
+      { -INT64_C( 4612565663163105283),  INT64_C(   36310274228158496) },
+      { -INT8_C(  19), -INT8_C(   9),      INT8_MAX, -INT8_C(  33), -INT8_C(  37), -INT8_C(  17), -INT8_C(  37), -INT8_C(  37),
+         INT8_C(   0),  INT8_C(  33),  INT8_C(  33),  INT8_C(   0), -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C( 107), -INT8_C(  17), -INT8_C(  10),  INT8_C(  43),  INT8_C( 116),  INT8_C( 113), -INT8_C(  81), -INT8_C(  26),
+        -INT8_C(  57), -INT8_C( 124),  INT8_C( 123), -INT8_C(  43),  INT8_C(  39),  INT8_C(  45),  INT8_C(  48),  INT8_C(  51) },
+      {  INT64_C( 3510784372236196676),  INT64_C( 8629316402989716131) },
+      {  INT8_C(  25),  INT8_C( 113), -INT8_C(  62),  INT8_C(  25),  INT8_C(  11),  INT8_C(  92),  INT8_C( 113),  INT8_C(  63),
+        -INT8_C(  91),  INT8_C(  42),  INT8_C( 110),  INT8_C(  53), -INT8_C(   5),  INT8_C(  11), -INT8_C(  63), -INT8_C(   8) } },
+    { {  INT8_C(  22), -INT8_C( 120),  INT8_C(  49), -INT8_C( 102), -INT8_C(  42), -INT8_C(  28), -INT8_C(  81),  INT8_C( 113),
+         INT8_C( 113),  INT8_C( 104), -INT8_C(  17), -INT8_C(  73),  INT8_C(  11), -INT8_C(  73), -INT8_C(  81),  INT8_C(  44) },
+      { -INT64_C(   18579560379515269),  INT64_C( 4483805450927807092) },
+      { -INT8_C(   3), -INT8_C(   2), -INT8_C(  34),  INT8_C(  63), -INT8_C(   3), -INT8_C(  33),  INT8_C( 123), -INT8_C(  34),
+         INT8_C(  28), -INT8_C(  83),  INT8_C( 115),  INT8_C( 124),  INT8_C(  99),  INT8_C( 124),  INT8_C( 115), -INT8_C( 102) } },
+    { {  INT8_C(  99), -INT8_C( 118), -INT8_C(  17), -INT8_C(  13), -INT8_C( 113), -INT8_C(  51),  INT8_C( 118),  INT8_C(  23),
+         INT8_C(  73), -INT8_C(  61), -INT8_C(  39), -INT8_C(  37),  INT8_C( 118), -INT8_C(  27), -INT8_C(  78), -INT8_C(  37) },
+      {  INT64_C( 1932533468392670131),  INT64_C( 2745527861612840895) },
+      { -INT8_C(  98),  INT8_C(  80), -INT8_C(  93),  INT8_C(  90),  INT8_C(  50), -INT8_C(  54),  INT8_C( 107), -INT8_C(  88),
+        -INT8_C( 125), -INT8_C(   9), -INT8_C( 104),  INT8_C( 102), -INT8_C( 104), -INT8_C( 104), -INT8_C( 122),  INT8_C( 102) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_multishift_epi64_epi8(a, b);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int64_t b[2];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  77), -INT8_C(  48), -INT8_C(  56),  INT8_C(  13),  INT8_C(   0),  INT8_C(   0),  INT8_C(  71), -INT8_C(  97),
+         INT8_C(  21), -INT8_C(  35),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1), -INT8_C(  72),  INT8_C(  10), -INT8_C( 124) },
+      UINT16_C( 1711),
+      {  INT8_C(  77), -INT8_C(  48),  INT8_C( 119),  INT8_C(  52), -INT8_C(  33),  INT8_C(  21),  INT8_C(  30),  INT8_C(  39),
+         INT8_C(   6), -INT8_C(  13), -INT8_C(  98),  INT8_C(  39), -INT8_C( 126), -INT8_C(  64), -INT8_C(  14),  INT8_C(  90) },
+      { -INT64_C(  818330146088057361),  INT64_C( 1157425125709074560) },
+      {  INT8_C( 108),  INT8_C( 109), -INT8_C(  23),  INT8_C(  74),  INT8_C(   0), -INT8_C(  21),  INT8_C(  71),  INT8_C( 106),
+         INT8_C(  21),  INT8_C(   2),  INT8_C(  20),  INT8_C(   0),  INT8_C(   1), -INT8_C(  72),  INT8_C(  10), -INT8_C( 124) } },
+    { { -INT8_C(  41), -INT8_C(  42),      INT8_MAX,  INT8_C(   2),  INT8_C(  21), -INT8_C(   2), -INT8_C(  33),      INT8_MAX,
+         INT8_C(   0), -INT8_C(  21),  INT8_C( 112),  INT8_C(   0), -INT8_C( 101),  INT8_C(  16), -INT8_C(  60), -INT8_C(  65) },
+      UINT16_C(54240),
+      { -INT8_C(  69),  INT8_C(   3), -INT8_C(  81),  INT8_C(  30), -INT8_C(  23), -INT8_C( 112), -INT8_C(   2), -INT8_C(  42),
+        -INT8_C(  88), -INT8_C(  93),  INT8_C(   8), -INT8_C(  32), -INT8_C(  97),  INT8_C(  58),  INT8_C( 115),  INT8_C(  63) },
+      { -INT64_C( 8106248490357657552),  INT64_C(       2201457084481) },
+      { -INT8_C(  41), -INT8_C(  42),      INT8_MAX,  INT8_C(   2),  INT8_C(  21),  INT8_C(  47), -INT8_C(  62),  INT8_C( 124),
+         INT8_C(   2),  INT8_C(  64),  INT8_C( 112),  INT8_C(   0),  INT8_C(   1),  INT8_C(  16),  INT8_C(   0), -INT8_C( 126) } },
+    { {  INT8_C(  58),  INT8_C(  37), -INT8_C(  52),  INT8_C(  79),  INT8_C( 125),  INT8_C(  32), -INT8_C(   9),  INT8_C( 119),
+         INT8_C(  38), -INT8_C(  87), -INT8_C(   8),  INT8_C(   0),  INT8_C(  55),  INT8_C(   1),  INT8_C(   2),  INT8_C(   8) },
+      UINT16_C(51456),
+      { -INT8_C(  40), -INT8_C( 110), -INT8_C(  69), -INT8_C(   5), -INT8_C( 121),  INT8_C(  45),  INT8_C(  15), -INT8_C(  35),
+        -INT8_C(  55), -INT8_C(  33),  INT8_C(  59),  INT8_C(  65),  INT8_C(  45), -INT8_C( 124),  INT8_C(   8), -INT8_C(  58) },
+      {  INT64_C(            16777216), -INT64_C( 8921298319930384164) },
+      {  INT8_C(  58),  INT8_C(  37), -INT8_C(  52),  INT8_C(  79),  INT8_C( 125),  INT8_C(  32), -INT8_C(   9),  INT8_C( 119),
+         INT8_C(  80), -INT8_C(  87), -INT8_C(   8),  INT8_C( 110),  INT8_C(  55),  INT8_C(   1), -INT8_C(  96), -INT8_C( 125) } },
+    { {  INT8_C(   0),  INT8_C(  86),  INT8_C(  83),  INT8_C(  20),  INT8_C(   1),  INT8_C( 119), -INT8_C(  65), -INT8_C(   1),
+         INT8_C(  20),      INT8_MAX, -INT8_C(   1),  INT8_C(  27),  INT8_C(  64), -INT8_C(  33),  INT8_C(  18),  INT8_C( 113) },
+      UINT16_C(27897),
+      { -INT8_C(   6),  INT8_C(   4),  INT8_C(  34), -INT8_C(  20), -INT8_C(  27),  INT8_C(  18), -INT8_C(  18),  INT8_C(  57),
+         INT8_C(  99), -INT8_C( 122),  INT8_C(   7), -INT8_C( 116),  INT8_C(  87),  INT8_C(  52),  INT8_C(  65), -INT8_C(  92) },
+      {  INT64_C( 5778879527395220724),  INT64_C( 8853742615825219583) },
+      {  INT8_C(  20),  INT8_C(  86),  INT8_C(  83),  INT8_C(  43), -INT8_C(  94), -INT8_C( 118), -INT8_C(  54),  INT8_C(  40),
+         INT8_C(  20),      INT8_MAX, -INT8_C(   1), -INT8_C(   1),  INT8_C(  64), -INT8_C(  83), -INT8_C(   1),  INT8_C( 113) } },
+    { {  INT8_C(   0),  INT8_C(  87),  INT8_C(   2),  INT8_C( 121),  INT8_C(  26),  INT8_C(  18), -INT8_C(  11), -INT8_C(  21),
+        -INT8_C(   1),  INT8_C(  17),  INT8_C( 103), -INT8_C(  46),  INT8_C(  53), -INT8_C(  10), -INT8_C(   1),  INT8_C(  16) },
+      UINT16_C( 6078),
+      {  INT8_C( 106), -INT8_C( 116),  INT8_C(  31), -INT8_C(  19), -INT8_C(  95), -INT8_C(  48), -INT8_C(  68),  INT8_C(  56),
+        -INT8_C( 111), -INT8_C(  43), -INT8_C(  80), -INT8_C(  94), -INT8_C(  68),      INT8_MIN, -INT8_C(  34), -INT8_C( 102) },
+      { -INT64_C(  324259177700835329),  INT64_C(       8796109832708) },
+      {  INT8_C(   0), -INT8_C(  77), -INT8_C(   3), -INT8_C(   1), -INT8_C(   1), -INT8_C(   5), -INT8_C(  11), -INT8_C(   5),
+             INT8_MIN,  INT8_C(   8),  INT8_C(   0), -INT8_C(  46),  INT8_C(  64), -INT8_C(  10), -INT8_C(   1),  INT8_C(  16) } },
+    { { -INT8_C(  58), -INT8_C(  17),  INT8_C(   0),  INT8_C( 119),  INT8_C(  83),  INT8_C(  80), -INT8_C(  27), -INT8_C(  64),
+        -INT8_C(  96), -INT8_C(  12), -INT8_C(  73), -INT8_C( 113), -INT8_C(   1), -INT8_C(  97), -INT8_C(  65), -INT8_C(   5) },
+      UINT16_C(44720),
+      {  INT8_C(  98),  INT8_C(  82),  INT8_C(  17), -INT8_C(  30),  INT8_C(  21), -INT8_C( 100), -INT8_C(  56),  INT8_C(  95),
+         INT8_C(  33),  INT8_C(  55),  INT8_C(  10),  INT8_C(  10), -INT8_C(   7),  INT8_C(  63),  INT8_C(  33),  INT8_C(   7) },
+      {  INT64_C(         12920569857), -INT64_C( 4081578270446218227) },
+      { -INT8_C(  58), -INT8_C(  17),  INT8_C(   0),  INT8_C( 119),  INT8_C(  17),  INT8_C(  48), -INT8_C(  27),  INT8_C(   6),
+        -INT8_C(  96), -INT8_C( 114),  INT8_C( 101),  INT8_C( 101), -INT8_C(   1),  INT8_C(  27), -INT8_C(  65),  INT8_C(  40) } },
+    { { -INT8_C( 104), -INT8_C(   2), -INT8_C(  10),  INT8_C(  80), -INT8_C(   3), -INT8_C(  87),  INT8_C(   6),      INT8_MIN,
+         INT8_C( 109),  INT8_C(  35), -INT8_C(  52), -INT8_C(  37), -INT8_C(   2),      INT8_MAX, -INT8_C(  40),  INT8_C( 125) },
+      UINT16_C(  298),
+      { -INT8_C( 113), -INT8_C( 109),  INT8_C(  37), -INT8_C(   7), -INT8_C(  90),  INT8_C(  77), -INT8_C(  74),  INT8_C(  89),
+        -INT8_C(   2), -INT8_C(  40), -INT8_C(  73), -INT8_C( 102),  INT8_C(  67), -INT8_C(  33),  INT8_C(  17), -INT8_C(  48) },
+      { -INT64_C(      70385924046850), -INT64_C( 8069887545233375216) },
+      { -INT8_C( 104), -INT8_C(   1), -INT8_C(  10),      INT8_MAX, -INT8_C(   3), -INT8_C(   1),  INT8_C(   6),      INT8_MIN,
+         INT8_C(  66),  INT8_C(  35), -INT8_C(  52), -INT8_C(  37), -INT8_C(   2),      INT8_MAX, -INT8_C(  40),  INT8_C( 125) } },
+    { {  INT8_C(   2),  INT8_C(   1), -INT8_C( 112),  INT8_C( 123), -INT8_C(   3),  INT8_C(   8),  INT8_C(  70), -INT8_C(  82),
+        -INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0) },
+      UINT16_C( 7244),
+      { -INT8_C(  37),  INT8_C(  72),  INT8_C( 124),  INT8_C(  34),  INT8_C(  86),  INT8_C( 120), -INT8_C(  21),  INT8_C(  55),
+        -INT8_C( 109), -INT8_C(  44), -INT8_C(  71), -INT8_C( 115),  INT8_C(  94), -INT8_C(  65), -INT8_C( 109),  INT8_C(  76) },
+      { -INT64_C( 2324138951427784753), -INT64_C( 6617670220883149262) },
+      {  INT8_C(   2),  INT8_C(   1), -INT8_C(   3), -INT8_C(   5), -INT8_C(   3),  INT8_C(   8), -INT8_C(  33), -INT8_C(  82),
+        -INT8_C(  95),  INT8_C(   0),  INT8_C(  82), -INT8_C(  95), -INT8_C(   5), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_multishift_epi64_epi8(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int64_t b[2];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C( 5426),
+      {  INT8_C(  59),  INT8_C(  14), -INT8_C(  16), -INT8_C(  22),  INT8_C(  43),  INT8_C(  14),  INT8_C(  25), -INT8_C(  11),
+         INT8_C(  71),  INT8_C(  72),  INT8_C(  37), -INT8_C( 125),  INT8_C(  30),  INT8_C(  79), -INT8_C( 104), -INT8_C( 100) },
+      {  INT64_C( 4123499497541432875),  INT64_C( 2883473646192492546) },
+      {  INT8_C(   0), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C( 8690),
+      {  INT8_C(  77), -INT8_C( 112),  INT8_C(  40), -INT8_C( 107),  INT8_C( 119), -INT8_C(  17),  INT8_C(  71), -INT8_C(  36),
+        -INT8_C(  45),  INT8_C( 108),  INT8_C(  16),  INT8_C(  20), -INT8_C(  37), -INT8_C(  88),  INT8_C(  95), -INT8_C(  56) },
+      {  INT64_C( 1372396804030346858), -INT64_C(   72062267050464291) },
+      {  INT8_C(   0),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(  38),  INT8_C(  23),  INT8_C( 108), -INT8_C(  13),
+         INT8_C(  87),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(55914),
+      { -INT8_C( 117),  INT8_C( 113),  INT8_C(  45),  INT8_C(  36), -INT8_C(   6), -INT8_C(  44), -INT8_C(  25),  INT8_C(  33),
+        -INT8_C( 107), -INT8_C(   1),  INT8_C(  29),  INT8_C(   5),  INT8_C( 125), -INT8_C(  95),  INT8_C(  64), -INT8_C(   2) },
+      { -INT64_C( 6901006356083164309),  INT64_C( 2449973178797367963) },
+      {  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(  52),  INT8_C(   0),  INT8_C(  15),  INT8_C( 102),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  54),  INT8_C(   0),  INT8_C(  20), -INT8_C(  39),  INT8_C(   0), -INT8_C( 101),  INT8_C( 108) } },
+    { UINT16_C(12849),
+      {  INT8_C(   6), -INT8_C(  16), -INT8_C( 113),  INT8_C(  62), -INT8_C(  96),  INT8_C( 117), -INT8_C(  37),  INT8_C( 120),
+         INT8_C( 106),  INT8_C(   7),  INT8_C(  21), -INT8_C(  23),  INT8_C(  76),  INT8_C( 117),  INT8_C( 100), -INT8_C( 122) },
+      {  INT64_C( 4760385070480031752), -INT64_C( 4034018439439576869) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  33),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),  INT8_C(  64),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(11015),
+      { -INT8_C(  34),  INT8_C(  14), -INT8_C(  21),  INT8_C(   8),  INT8_C( 104), -INT8_C(   4), -INT8_C(  55),  INT8_C(  14),
+        -INT8_C(  24), -INT8_C( 108),  INT8_C(  71), -INT8_C( 122),  INT8_C(  15), -INT8_C( 107), -INT8_C(  59), -INT8_C( 123) },
+      { -INT64_C( 4904490921833267233), -INT64_C(   18225505280987401) },
+      { -INT8_C(   9), -INT8_C(   1), -INT8_C(   9),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  63), -INT8_C(   3),  INT8_C(   0), -INT8_C(  69),  INT8_C(   0), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(32744),
+      { -INT8_C( 120),  INT8_C(  21),  INT8_C(  91), -INT8_C(  38),  INT8_C( 109), -INT8_C(  45), -INT8_C(  91), -INT8_C(  92),
+        -INT8_C(  27), -INT8_C(  99), -INT8_C(  94),  INT8_C(  94),  INT8_C(  13),  INT8_C(  30),  INT8_C(  53), -INT8_C(  17) },
+      {  INT64_C( 7787295519656233548),  INT64_C(   72638144767852576) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  10),  INT8_C(   0),  INT8_C(  67),  INT8_C(  64),      INT8_MIN,
+             INT8_MIN,  INT8_C(  16),  INT8_C(   0),  INT8_C(   8),  INT8_C(  64),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0) } },
+    { UINT16_C(31003),
+      {  INT8_C(  38),  INT8_C(  86), -INT8_C(  68),  INT8_C(  47), -INT8_C(  46),  INT8_C( 111),  INT8_C(  35),  INT8_C(  10),
+        -INT8_C( 105), -INT8_C(  67),  INT8_C(   7),  INT8_C(  87), -INT8_C(  49), -INT8_C(  73), -INT8_C(  55), -INT8_C(  66) },
+      { -INT64_C( 2070789162766802722), -INT64_C( 1308296000988839940) },
+      {  INT8_C(  80),  INT8_C( 114),  INT8_C(   0), -INT8_C( 122),  INT8_C(  35),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   3), -INT8_C(  37),      INT8_MAX,  INT8_C(   0) } },
+    { UINT16_C(28615),
+      { -INT8_C(   9), -INT8_C(  98),  INT8_C(  64),  INT8_C(  96), -INT8_C( 123),  INT8_C(  39),  INT8_C(  40), -INT8_C(  91),
+         INT8_C(  43),  INT8_C(  37), -INT8_C(  52), -INT8_C(  80), -INT8_C(  19), -INT8_C(  65),  INT8_C(  56), -INT8_C(  48) },
+      { -INT64_C( 6035329527424339549), -INT64_C( 5738391688002408339) },
+      {  INT8_C(  88),  INT8_C(  21), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51), -INT8_C(  98),
+        -INT8_C(  92),  INT8_C(  25), -INT8_C(   1),  INT8_C(  93),  INT8_C(   0), -INT8_C(  37), -INT8_C(  80),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_multishift_epi64_epi8(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int64_t b[4];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C( 124), -INT8_C(  33),  INT8_C(  91),  INT8_C(  49), -INT8_C(  28), -INT8_C( 110),  INT8_C( 100),  INT8_C(  69),
+        -INT8_C(  94), -INT8_C( 103),  INT8_C(  98),  INT8_C(  94),  INT8_C(  24), -INT8_C(  54),  INT8_C(  72), -INT8_C(  17),
+        -INT8_C(  47), -INT8_C(  68), -INT8_C( 127),  INT8_C(  43), -INT8_C(  79),  INT8_C(  68),  INT8_C(  47),  INT8_C( 108),
+         INT8_C(  37),  INT8_C(  17), -INT8_C(  31), -INT8_C(  19), -INT8_C( 117), -INT8_C( 110), -INT8_C(  99), -INT8_C(  26) },
+      { -INT64_C( 1161085653322040465), -INT64_C( 6882547296545932256),  INT64_C(  573534601226927723), -INT64_C(     565149178142721) },
+      { -INT8_C(  74),      INT8_MAX, -INT8_C(   1), -INT8_C(  15), -INT8_C(  21), -INT8_C(   5), -INT8_C(  21), -INT8_C(  37),
+        -INT8_C(  20),  INT8_C( 123), -INT8_C(  20), -INT8_C(  53), -INT8_C(   9),      INT8_MAX, -INT8_C(   4), -INT8_C(   8),
+         INT8_C(  67), -INT8_C(  80),  INT8_C(  53), -INT8_C(  77), -INT8_C(   6), -INT8_C(  26), -INT8_C(  21),  INT8_C(  89),
+        -INT8_C(  17), -INT8_C(   2), -INT8_C(   1), -INT8_C(  17), -INT8_C(  69), -INT8_C(   1), -INT8_C(   1), -INT8_C(   9) } },
+    { {  INT8_C(   6), -INT8_C( 126), -INT8_C( 101), -INT8_C(  69),  INT8_C(   7),  INT8_C(  67),  INT8_C(  14),  INT8_C(  60),
+         INT8_C(   6),  INT8_C(  71),  INT8_C(   8),  INT8_C(  78),  INT8_C(  28),  INT8_C(  32),  INT8_C(  21), -INT8_C(  59),
+        -INT8_C( 108),  INT8_C(  39),  INT8_C( 122), -INT8_C( 127),  INT8_C(  56), -INT8_C( 118),  INT8_C( 109),  INT8_C( 122),
+        -INT8_C(  35),  INT8_C(  29),  INT8_C( 120), -INT8_C( 120), -INT8_C(  95),  INT8_C(  18), -INT8_C( 111),  INT8_C(  15) },
+      { -INT64_C(  576460752303423490),  INT64_C(   45625884262006804),  INT64_C( 8930638058921389823), -INT64_C(  324259449391808517) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  34), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  17),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   7), -INT8_C(   1), -INT8_C(  34),      INT8_MAX,  INT8_C( 123), -INT8_C(   5),      INT8_MAX, -INT8_C(  34),
+        -INT8_C(   3), -INT8_C(   3), -INT8_C(   5), -INT8_C(   1), -INT8_C(  33), -INT8_C(   5), -INT8_C(   9), -INT8_C(  33) } },
+    { {  INT8_C(  46), -INT8_C(  56), -INT8_C(  67), -INT8_C(  73),  INT8_C( 106), -INT8_C(  21),  INT8_C( 117),  INT8_C( 105),
+        -INT8_C(  11),  INT8_C(  75),  INT8_C(  19), -INT8_C(  11),  INT8_C(  76), -INT8_C(  92),  INT8_C(  48), -INT8_C(  78),
+        -INT8_C(  45), -INT8_C( 110),  INT8_C(   5),  INT8_C(  59), -INT8_C(  54),  INT8_C(  41), -INT8_C(  61), -INT8_C(  40),
+         INT8_C(  43),  INT8_C( 126),  INT8_C(  20), -INT8_C( 122),  INT8_C(  76),      INT8_MAX,  INT8_C(  21),  INT8_C(  21) },
+      {  INT64_C(    4482179779311500),  INT64_C( 2306406268409020804),  INT64_C( 4453729986758419364),  INT64_C( 8283585245579634413) },
+      {  INT8_C(  63), -INT8_C(  73),  INT8_C(  96),  INT8_C(   0), -INT8_C(   5), -INT8_C(   3),  INT8_C(   0), -INT8_C(  10),
+         INT8_C(   0),  INT8_C(  32),  INT8_C(   8),  INT8_C(   0),  INT8_C(  16),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(  71), -INT8_C( 113),  INT8_C(  29), -INT8_C( 121),  INT8_C( 104),  INT8_C( 105),  INT8_C( 116),  INT8_C( 122),
+        -INT8_C(  90), -INT8_C(  75), -INT8_C(  41), -INT8_C( 101),  INT8_C(  14), -INT8_C(  38), -INT8_C(  21), -INT8_C(  21) } },
+    { {  INT8_C(  42),  INT8_C(  67), -INT8_C(  92),  INT8_C(  58),  INT8_C(  53), -INT8_C(  74),  INT8_C(  38), -INT8_C(  95),
+        -INT8_C(  42), -INT8_C(  97),  INT8_C( 124), -INT8_C(  11), -INT8_C(  43),  INT8_C(  38), -INT8_C(  15),  INT8_C( 108),
+        -INT8_C(  80), -INT8_C(  79), -INT8_C( 121),  INT8_C(  82),  INT8_C(  10), -INT8_C(   3), -INT8_C(  29), -INT8_C(  73),
+         INT8_C(  18), -INT8_C( 117), -INT8_C( 103),  INT8_C( 101), -INT8_C(  27), -INT8_C(  39),  INT8_C(  90), -INT8_C(  56) },
+      { -INT64_C( 2377879817188990438), -INT64_C( 6403388311777633498),  INT64_C( 8069798520576867323), -INT64_C( 2302329051958684641) },
+      {  INT8_C(   4),  INT8_C(  67),  INT8_C(  46), -INT8_C(  73), -INT8_C(   8),  INT8_C( 124),  INT8_C(  75),  INT8_C( 115),
+         INT8_C(  54), -INT8_C( 125),  INT8_C( 106),  INT8_C(  57),  INT8_C( 108),  INT8_C(  97), -INT8_C( 111),  INT8_C(  41),
+        -INT8_C(   3), -INT8_C(   2), -INT8_C(   9), -INT8_C(   3),  INT8_C(  62), -INT8_C(  37), -INT8_C(  33), -INT8_C(  33),
+         INT8_C( 124),  INT8_C(  26),  INT8_C( 118), -INT8_C(  33), -INT8_C(  33),  INT8_C( 118),  INT8_C(  59), -INT8_C(  44) } },
+    { {  INT8_C(  94),  INT8_C(  27), -INT8_C( 100), -INT8_C( 110),  INT8_C( 119),  INT8_C( 115),  INT8_C( 109),  INT8_C( 125),
+         INT8_C(  68), -INT8_C(  18), -INT8_C(  54),  INT8_C(  58), -INT8_C(  93),  INT8_C(  73),  INT8_C( 109),  INT8_C(  63),
+         INT8_C(  69),  INT8_C(   2), -INT8_C( 121),  INT8_C(  95), -INT8_C(  64),  INT8_C(  83),  INT8_C( 109), -INT8_C(  93),
+        -INT8_C(  80), -INT8_C( 101),  INT8_C(  44), -INT8_C(  74), -INT8_C(  10), -INT8_C(  98), -INT8_C(  41),  INT8_C( 118) },
+      {  INT64_C( 5764609859504865280), -INT64_C( 2324297212379595009),  INT64_C(   36035445632532480),  INT64_C( 8069887582293721087) },
+      {      INT8_MIN,  INT8_C(   0),  INT8_C(   0),  INT8_C(  32), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),
+        -INT8_C(  17), -INT8_C(   7), -INT8_C(  65), -INT8_C(   9), -INT8_C(   1),      INT8_MAX, -INT8_C(  13), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  24),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0), -INT8_C(  63),
+        -INT8_C(   3), -INT8_C(   1), -INT8_C(  33), -INT8_C(  65), -INT8_C(  65), -INT8_C(   1), -INT8_C(   1), -INT8_C(  65) } },
+    { { -INT8_C(  89), -INT8_C(  75),  INT8_C(   6),      INT8_MIN, -INT8_C(   7), -INT8_C( 101),  INT8_C(  81),  INT8_C(  31),
+        -INT8_C(  41), -INT8_C(  52),  INT8_C( 111), -INT8_C(  83), -INT8_C(  13),  INT8_C(  57),  INT8_C( 111),  INT8_C(  69),
+         INT8_C(  54), -INT8_C(  96), -INT8_C(  28),  INT8_C(  37),  INT8_C(  48), -INT8_C( 101), -INT8_C(  87), -INT8_C(  31),
+         INT8_C( 114), -INT8_C(  40),  INT8_C(  14), -INT8_C(  98), -INT8_C( 107), -INT8_C( 113), -INT8_C(  58),  INT8_C(  88) },
+      {  INT64_C(  734001053537521897),  INT64_C( 2838717062006242095),  INT64_C( 1984532460535008263),  INT64_C( 6917528890202127971) },
+      {  INT8_C( 100),  INT8_C(  81),  INT8_C(  67), -INT8_C(  23), -INT8_C( 123),  INT8_C(  55),  INT8_C( 110),  INT8_C(  35),
+         INT8_C( 101), -INT8_C( 113), -INT8_C(  54),  INT8_C(  41), -INT8_C(  20), -INT8_C( 109), -INT8_C(  54), -INT8_C(  39),
+         INT8_C( 110), -INT8_C(  62), -INT8_C( 100), -INT8_C(  50), -INT8_C( 118),  INT8_C(  68),  INT8_C(  60), -INT8_C(  31),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),      INT8_MAX, -INT8_C(   1), -INT8_C(   1), -INT8_C(   7), -INT8_C(   1) } },
+    { { -INT8_C(  26), -INT8_C(  54),  INT8_C(  30),  INT8_C(  56),  INT8_C(  25),  INT8_C( 107),  INT8_C(   2), -INT8_C( 101),
+        -INT8_C(  84), -INT8_C(  90),  INT8_C(  68), -INT8_C(  33), -INT8_C(   8),  INT8_C(  54),  INT8_C(  30),  INT8_C(  72),
+         INT8_C(   2), -INT8_C(  58),  INT8_C(  59),  INT8_C(  25), -INT8_C(  77),  INT8_C(  26),      INT8_MAX, -INT8_C(  53),
+        -INT8_C(  92), -INT8_C(  44),  INT8_C(  88),  INT8_C(  44), -INT8_C(   2),  INT8_C(  27), -INT8_C(  26),  INT8_C(   7) },
+      { -INT64_C( 7153147362087600324), -INT64_C( 1367400900463932477),  INT64_C( 1152921676405571584), -INT64_C( 4647724814130225223) },
+      { -INT8_C(  87), -INT8_C(  65),  INT8_C( 126), -INT8_C( 100), -INT8_C(  60),  INT8_C(  93), -INT8_C(  49), -INT8_C(  15),
+         INT8_C(  96),  INT8_C(  16), -INT8_C(  68),  INT8_C(  64), -INT8_C(  19), -INT8_C(  76),      INT8_MIN,  INT8_C(  75),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),
+         INT8_C( 110), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  26), -INT8_C(   1), -INT8_C(  37), -INT8_C(  65) } },
+    { { -INT8_C(  40), -INT8_C(  76), -INT8_C(  64), -INT8_C(  48), -INT8_C( 110),  INT8_C(  85),  INT8_C( 126), -INT8_C(   7),
+         INT8_C( 115), -INT8_C( 111), -INT8_C(  14),  INT8_C(  79), -INT8_C(  25),  INT8_C(   1), -INT8_C(  35),  INT8_C(  43),
+         INT8_C(  32),  INT8_C(  71),  INT8_C(  22),  INT8_C( 117), -INT8_C(  43),  INT8_C(   4), -INT8_C(  74),  INT8_C(  49),
+         INT8_C(  39),  INT8_C(  12), -INT8_C(  91),  INT8_C(   7),  INT8_C(  66),      INT8_MAX,  INT8_C(  33),  INT8_C(  16) },
+      {  INT64_C( 1846857745643410029), -INT64_C( 8692955141993473971),  INT64_C(  217369188472229889),  INT64_C( 3468341277547315457) },
+      { -INT8_C(  89), -INT8_C( 102),  INT8_C( 109), -INT8_C(  63), -INT8_C(  16),  INT8_C(  62), -INT8_C(  76), -INT8_C( 116),
+        -INT8_C(  21), -INT8_C( 119), -INT8_C(  41),  INT8_C(  37), -INT8_C(  42),  INT8_C(  38), -INT8_C(  40), -INT8_C( 115),
+         INT8_C(  32),  INT8_C(  32),  INT8_C(  64),  INT8_C(  24),      INT8_MIN,  INT8_C(   0),  INT8_C(  12), -INT8_C( 126),
+         INT8_C(  12), -INT8_C( 124),  INT8_C(  48), -INT8_C( 126),  INT8_C(  64),  INT8_C(   2),  INT8_C(   2),  INT8_C(   8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_multishift_epi64_epi8(a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int64_t b[4];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {      INT8_MAX,  INT8_C(   4), -INT8_C(   5), -INT8_C(   3),  INT8_C(   1),  INT8_C(  24),  INT8_C(  58), -INT8_C(  81),
+         INT8_C(  13), -INT8_C(  12),  INT8_C(  81), -INT8_C(  10), -INT8_C(  68),  INT8_C(  64),  INT8_C(  37),      INT8_MIN,
+        -INT8_C(  65),      INT8_MIN,  INT8_C(  32),  INT8_C(  95),  INT8_C(   0),  INT8_C(  96), -INT8_C(  17),  INT8_C(   0),
+         INT8_C( 125), -INT8_C(   3), -INT8_C(  65),      INT8_MIN, -INT8_C(   5),  INT8_C(  66),  INT8_C(  32),  INT8_C( 103) },
+      UINT32_C(1861559857),
+      {  INT8_C(  16), -INT8_C(  55), -INT8_C(  18),  INT8_C(  43), -INT8_C(  91), -INT8_C(   8), -INT8_C( 109),  INT8_C(  48),
+        -INT8_C(  62), -INT8_C(  64), -INT8_C( 108), -INT8_C( 107),  INT8_C(  50),  INT8_C(  12), -INT8_C( 113), -INT8_C(  31),
+         INT8_C( 118), -INT8_C(   2), -INT8_C(  39),  INT8_C(  59),  INT8_C(  68), -INT8_C(  89),  INT8_C(   1),  INT8_C(  30),
+        -INT8_C( 123), -INT8_C(  48),  INT8_C(   4),  INT8_C(  95),  INT8_C(  70),  INT8_C(  78), -INT8_C(  19), -INT8_C(  29) },
+      {  INT64_C( 7656811498690484696), -INT64_C(  103547588621783572),  INT64_C( 4602115868144435103),  INT64_C(  445031280442356823) },
+      { -INT8_C( 110),  INT8_C(   4), -INT8_C(   5), -INT8_C(   3), -INT8_C(  85),  INT8_C( 106),  INT8_C(  58), -INT8_C(  81),
+         INT8_C(  13), -INT8_C(  20), -INT8_C(  83), -INT8_C(  10), -INT8_C(  68), -INT8_C( 102),  INT8_C(  37),      INT8_MIN,
+        -INT8_C(   1),      INT8_MIN, -INT8_C(  33),  INT8_C(  95), -INT8_C(   7), -INT8_C(   1), -INT8_C(  49), -INT8_C(   2),
+         INT8_C( 125), -INT8_C(  76),  INT8_C(  69),  INT8_C(  46), -INT8_C(   5), -INT8_C(  48),  INT8_C( 104),  INT8_C( 103) } },
+    { {  INT8_C(   0),      INT8_MIN, -INT8_C(  62),  INT8_C(   0),  INT8_C(   8),  INT8_C( 117),  INT8_C(   1), -INT8_C(  26),
+        -INT8_C(  41),  INT8_C(   3), -INT8_C(   1), -INT8_C(  33),  INT8_C(   0), -INT8_C( 127), -INT8_C( 112), -INT8_C(   9),
+         INT8_C( 118), -INT8_C(   1),  INT8_C(  29),  INT8_C(  73), -INT8_C(  98),  INT8_C(   0), -INT8_C(   5),  INT8_C(  56),
+         INT8_C(  75),  INT8_C(  63),  INT8_C(  97), -INT8_C( 107), -INT8_C(  25), -INT8_C(   1),  INT8_C(  81), -INT8_C(   1) },
+      UINT32_C(2427816546),
+      { -INT8_C( 102),  INT8_C( 104), -INT8_C(  24),  INT8_C(  75), -INT8_C(  54), -INT8_C(  53),      INT8_MAX, -INT8_C(  66),
+         INT8_C(  16),      INT8_MIN,  INT8_C(  73),  INT8_C( 122), -INT8_C(  17),      INT8_MAX, -INT8_C(  99),  INT8_C(  96),
+         INT8_C(  60), -INT8_C(  30),  INT8_C(  79), -INT8_C(  54), -INT8_C(  17),  INT8_C(  88), -INT8_C( 105), -INT8_C( 127),
+         INT8_C(  73),  INT8_C(  31), -INT8_C( 124),  INT8_C(   6), -INT8_C(  74), -INT8_C(  17),  INT8_C( 100), -INT8_C( 121) },
+      {  INT64_C( 4143752881657534763), -INT64_C( 3434327153052656782), -INT64_C(  153122387336923393),  INT64_C( 5958685692787754416) },
+      {  INT8_C(   0), -INT8_C( 111), -INT8_C(  62),  INT8_C(   0),  INT8_C(   8),  INT8_C(  91),  INT8_C(  86), -INT8_C(  26),
+        -INT8_C(  41),  INT8_C( 114), -INT8_C(   1), -INT8_C(  76),  INT8_C(   0), -INT8_C( 127), -INT8_C( 112), -INT8_C(  90),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(  62),  INT8_C(  73), -INT8_C(  65), -INT8_C(   1), -INT8_C(   5),      INT8_MAX,
+         INT8_C(  75),  INT8_C(  63),  INT8_C(  97), -INT8_C( 107),  INT8_C(  74), -INT8_C(   1),  INT8_C(  81),  INT8_C(  11) } },
+    { {  INT8_C(   0),  INT8_C(  22), -INT8_C(  71), -INT8_C(  79), -INT8_C(  53),  INT8_C(  97), -INT8_C(  12),  INT8_C( 119),
+        -INT8_C(  89),  INT8_C(  31),  INT8_C(  61), -INT8_C(   5), -INT8_C(  41), -INT8_C(   1),  INT8_C(   0), -INT8_C(  95),
+         INT8_C(  86),  INT8_C(   0),  INT8_C(  32), -INT8_C(  63), -INT8_C(  53),  INT8_C(   0),  INT8_C( 110),  INT8_C(   0),
+        -INT8_C(  46), -INT8_C(   1), -INT8_C(  17),  INT8_C(  56), -INT8_C(  52), -INT8_C(  65), -INT8_C(   1), -INT8_C( 107) },
+      UINT32_C(3071643886),
+      {  INT8_C( 114), -INT8_C(  51), -INT8_C(  79), -INT8_C(  73),  INT8_C(  80),  INT8_C( 111), -INT8_C(  62), -INT8_C(  22),
+        -INT8_C(  90), -INT8_C(  66),  INT8_C(  24), -INT8_C(   2),  INT8_C(  51), -INT8_C( 101), -INT8_C(  80), -INT8_C(  60),
+        -INT8_C(  49), -INT8_C(  93), -INT8_C(  73),  INT8_C(  25),  INT8_C(  54),  INT8_C(  17),  INT8_C(  90),  INT8_C(  14),
+         INT8_C(  87),  INT8_C(  39),  INT8_C(  36),  INT8_C( 101), -INT8_C(  61), -INT8_C(   4),  INT8_C(   3), -INT8_C(  54) },
+      {  INT64_C( 9168148295995649528),  INT64_C( 6917854517446902032), -INT64_C( 8210087623944233253),  INT64_C( 7491736605740741183) },
+      {  INT8_C(   0),  INT8_C(  99), -INT8_C(  99), -INT8_C(   2), -INT8_C(  53),  INT8_C( 119),  INT8_C( 126), -INT8_C(  13),
+        -INT8_C(  89),  INT8_C(  31),  INT8_C(  61), -INT8_C(   5),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(  17),
+        -INT8_C(  14),  INT8_C(   0),  INT8_C(  28), -INT8_C(  63),  INT8_C(  56),  INT8_C(   0),  INT8_C( 110),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(   3), -INT8_C(  21),  INT8_C(  56),  INT8_C(  71), -INT8_C(  10), -INT8_C(   1), -INT8_C(  20) } },
+    { {  INT8_C(   0), -INT8_C(  17),  INT8_C(   0),  INT8_C(  74), -INT8_C(   5), -INT8_C(  98), -INT8_C(  57),  INT8_C( 115),
+        -INT8_C( 124),  INT8_C(  99), -INT8_C(   1),  INT8_C(  56),  INT8_C(  64),      INT8_MAX, -INT8_C(   1),  INT8_C(  67),
+         INT8_C(   0),  INT8_C(   6), -INT8_C(   3), -INT8_C(  37),  INT8_C(  69), -INT8_C(   1), -INT8_C(  75),  INT8_C(  64),
+        -INT8_C(  49), -INT8_C(  92), -INT8_C(  64),  INT8_C(  61),  INT8_C( 103), -INT8_C(  82),  INT8_C(   2),  INT8_C(  19) },
+      UINT32_C(2888714090),
+      {  INT8_C( 103),  INT8_C(   1),  INT8_C(  63),  INT8_C( 123), -INT8_C(   5),  INT8_C( 124), -INT8_C(  64), -INT8_C( 117),
+         INT8_C(  53),  INT8_C( 108), -INT8_C( 112), -INT8_C(  74),  INT8_C(  43), -INT8_C(  37),  INT8_C(  12),  INT8_C(   5),
+        -INT8_C(  82),  INT8_C(  10),  INT8_C(  15), -INT8_C(  14),  INT8_C(   2),  INT8_C(  99),  INT8_C(  31), -INT8_C(  40),
+        -INT8_C(  92),  INT8_C(  17),  INT8_C(  71), -INT8_C(  99),  INT8_C( 110),  INT8_C(  16), -INT8_C( 112),  INT8_C( 112) },
+      { -INT64_C(  288793334837674498),  INT64_C( 4016858541783252981),  INT64_C(       8933533548546),  INT64_C(   42221249728217109) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(  33), -INT8_C(   5), -INT8_C(  17), -INT8_C(   2),  INT8_C( 115),
+        -INT8_C(  67), -INT8_C(  21), -INT8_C(   5),  INT8_C(  56),  INT8_C(  64),      INT8_MAX, -INT8_C(  65),  INT8_C(  67),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  48),  INT8_C(   0),  INT8_C(  69),  INT8_C(   4), -INT8_C(  75),  INT8_C(  64),
+        -INT8_C(  49), -INT8_C(  92),  INT8_C(   0),  INT8_C(   6),  INT8_C( 103),  INT8_C(   6),  INT8_C(   2), -INT8_C( 106) } },
+    { {      INT8_MAX, -INT8_C(  71), -INT8_C(   1), -INT8_C( 119),  INT8_C( 111), -INT8_C(   9),  INT8_C(  67),  INT8_C( 123),
+         INT8_C(  94),  INT8_C(  70), -INT8_C(  11),      INT8_MIN,  INT8_C(  66), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  93),  INT8_C(  57), -INT8_C(   1),  INT8_C(  50), -INT8_C( 111),  INT8_C(  82), -INT8_C(  42), -INT8_C( 121),
+         INT8_C(  63),      INT8_MAX, -INT8_C(   3), -INT8_C(   1), -INT8_C(  30),  INT8_C(  64),  INT8_C(  77),  INT8_C(  72) },
+      UINT32_C(4141290974),
+      {  INT8_C( 118), -INT8_C(  27),  INT8_C(  31), -INT8_C(  17),  INT8_C(  83), -INT8_C(  62),  INT8_C( 120),  INT8_C(  97),
+         INT8_C(  27), -INT8_C( 106), -INT8_C(  29),  INT8_C(  91),  INT8_C(  39), -INT8_C(   2),  INT8_C( 123), -INT8_C(  23),
+         INT8_C(  27),  INT8_C(  15),  INT8_C( 103), -INT8_C(  47), -INT8_C(  61), -INT8_C(  99), -INT8_C(  98),  INT8_C(  97),
+        -INT8_C(  26), -INT8_C(  15),  INT8_C( 112), -INT8_C(  41),  INT8_C(   9),  INT8_C( 114),      INT8_MAX, -INT8_C(  24) },
+      {  INT64_C( 2310351144863473664), -INT64_C( 4931172052983965790), -INT64_C( 2617622484083286845), -INT64_C( 8927053000371880964) },
+      {      INT8_MAX,  INT8_C(  33),  INT8_C(  64),  INT8_C(  32),  INT8_C(   0), -INT8_C(   9),  INT8_C(  32),  INT8_C(  16),
+        -INT8_C(  99),  INT8_C(  70), -INT8_C(  92),      INT8_MIN, -INT8_C(  22), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(  71), -INT8_C(  84),  INT8_C(  50), -INT8_C( 104),  INT8_C(  82), -INT8_C(  32),  INT8_C(  28),
+         INT8_C(  63),  INT8_C(  14),  INT8_C(  28), -INT8_C(   1), -INT8_C(  35),  INT8_C(   7), -INT8_C(   7), -INT8_C(  68) } },
+    { {  INT8_C(  48),  INT8_C(  94),  INT8_C(   0), -INT8_C(  32),  INT8_C(  82),  INT8_C(  86),  INT8_C(  48), -INT8_C(  66),
+         INT8_C(  96),  INT8_C(  27),  INT8_C(  32), -INT8_C(  71),  INT8_C(   0),  INT8_C(  70),  INT8_C(  18), -INT8_C(   3),
+        -INT8_C(  51), -INT8_C(   1),  INT8_C(  32), -INT8_C(  11), -INT8_C(   1), -INT8_C(  55),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  99),      INT8_MIN,  INT8_C(  52), -INT8_C(  96),  INT8_C( 111),  INT8_C(  80),  INT8_C(  14), -INT8_C(  49) },
+      UINT32_C( 515671648),
+      {  INT8_C( 115),  INT8_C(  89),  INT8_C(  72), -INT8_C( 119), -INT8_C(  58), -INT8_C(  88),  INT8_C(   1),  INT8_C(  14),
+        -INT8_C(  86),  INT8_C(   5),  INT8_C(  65), -INT8_C(  89),  INT8_C( 120), -INT8_C( 127),  INT8_C( 106),  INT8_C(  95),
+        -INT8_C(  98), -INT8_C(  51),  INT8_C(  94),  INT8_C(  62),  INT8_C(  70),  INT8_C(  33),  INT8_C(  89),  INT8_C(  21),
+         INT8_C( 101), -INT8_C(  68), -INT8_C( 112), -INT8_C( 112), -INT8_C(  23), -INT8_C( 107),  INT8_C( 126),  INT8_C(  45) },
+      { -INT64_C(       9904228139009), -INT64_C(  585477297459437570),  INT64_C( 1157497689181545536),  INT64_C( 4985742192528185002) },
+      {  INT8_C(  48),  INT8_C(  94),  INT8_C(   0), -INT8_C(  32),  INT8_C(  82), -INT8_C(  10), -INT8_C(   1), -INT8_C(  66),
+         INT8_C(  96), -INT8_C(   1), -INT8_C(   1), -INT8_C(  71),  INT8_C(   0),  INT8_C(  70),  INT8_C(  18), -INT8_C(   1),
+        -INT8_C(  51), -INT8_C(   1),  INT8_C(  16),  INT8_C(   0), -INT8_C( 111),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  99), -INT8_C(  92),  INT8_C(  81),  INT8_C(  81),  INT8_C( 117),  INT8_C(  80),  INT8_C(  14), -INT8_C(  49) } },
+    { { -INT8_C(  10), -INT8_C(  29),  INT8_C(   6),  INT8_C(   3),  INT8_C(  55),  INT8_C(  27), -INT8_C( 105), -INT8_C( 110),
+        -INT8_C(  34),  INT8_C(  16),  INT8_C(  54),  INT8_C(  64),  INT8_C(  99), -INT8_C(   1), -INT8_C(   5),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  71), -INT8_C(   1),  INT8_C(  54),  INT8_C(  19),  INT8_C(  97), -INT8_C(   1), -INT8_C( 104),
+         INT8_C(  58),  INT8_C(  48), -INT8_C(  93), -INT8_C(  33),  INT8_C( 100),  INT8_C(  64), -INT8_C( 106), -INT8_C(  60) },
+      UINT32_C(2331667069),
+      { -INT8_C(  11), -INT8_C( 116), -INT8_C(  47),  INT8_C(  19),  INT8_C(  62), -INT8_C(  83), -INT8_C(  84),  INT8_C(  58),
+        -INT8_C( 108),  INT8_C(  71), -INT8_C(  83),  INT8_C(  23), -INT8_C(  89), -INT8_C(  85),  INT8_C(  10), -INT8_C(  37),
+        -INT8_C( 126), -INT8_C( 106), -INT8_C(  40), -INT8_C(  70), -INT8_C(  90), -INT8_C(  36), -INT8_C(  13),  INT8_C(  57),
+         INT8_C(   6),  INT8_C(  96), -INT8_C(  21), -INT8_C(   7),  INT8_C(  79),  INT8_C(   4), -INT8_C(  70), -INT8_C(  57) },
+      { -INT64_C( 8637534648315934688),  INT64_C( 7948141506184824151),  INT64_C(  144117421593088000),  INT64_C( 8167433789031149580) },
+      {  INT8_C(  65), -INT8_C(  29),  INT8_C(   0),  INT8_C(   0), -INT8_C( 126),  INT8_C(  10),  INT8_C(  21), -INT8_C( 110),
+        -INT8_C(  34), -INT8_C( 118),  INT8_C(  54),  INT8_C( 121),  INT8_C(  99), -INT8_C(  81), -INT8_C(  47),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  32), -INT8_C(   1),  INT8_C(   0),  INT8_C(   8),      INT8_MIN,  INT8_C(  64),  INT8_C(   1),
+         INT8_C(  58), -INT8_C(  62), -INT8_C(  93),  INT8_C(  56),  INT8_C( 100),  INT8_C(  64), -INT8_C( 106), -INT8_C(  32) } },
+    { {  INT8_C(  61),  INT8_C( 126),  INT8_C(   0), -INT8_C(  61),  INT8_C(  42),  INT8_C( 119),  INT8_C(  52),  INT8_C(  96),
+         INT8_C(   9), -INT8_C(  17), -INT8_C(  79), -INT8_C( 103),  INT8_C( 122), -INT8_C(  84),      INT8_MIN,  INT8_C(   4),
+        -INT8_C(  95),  INT8_C(  64),  INT8_C(  93),  INT8_C(   0),  INT8_C(  32), -INT8_C( 103),  INT8_C(  32),  INT8_C( 119),
+         INT8_C(   3),  INT8_C(  70),  INT8_C(   3), -INT8_C(  50), -INT8_C(  65),  INT8_C(  71), -INT8_C(   1),  INT8_C( 100) },
+      UINT32_C(3226223305),
+      {  INT8_C(  48), -INT8_C(  41), -INT8_C( 102),  INT8_C(  46), -INT8_C(  62), -INT8_C(  61), -INT8_C(  41), -INT8_C(  21),
+         INT8_C( 124), -INT8_C(  21),  INT8_C(   4),  INT8_C(  51),  INT8_C(  60),  INT8_C( 119), -INT8_C( 113),  INT8_C( 122),
+         INT8_C(  53), -INT8_C(  93),  INT8_C(  15), -INT8_C(  90),  INT8_C(  85),  INT8_C(  24), -INT8_C(  92), -INT8_C(  81),
+         INT8_C(  99),  INT8_C(   2), -INT8_C(  42),  INT8_C(  27),  INT8_C( 116),  INT8_C(  77),  INT8_C(   6),  INT8_C(  21) },
+      {  INT64_C( 2467972600366628864), -INT64_C(  706943173693338428),  INT64_C( 1962140230220072562), -INT64_C( 4748279423296603667) },
+      {  INT8_C(  64),  INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(  42),  INT8_C( 119),  INT8_C(  32),  INT8_C(   0),
+         INT8_C(   9),  INT8_C(  13), -INT8_C(  79), -INT8_C( 103),  INT8_C( 122), -INT8_C(  84),  INT8_C(  62),  INT8_C(   4),
+        -INT8_C(  95),  INT8_C(  64), -INT8_C( 118), -INT8_C(  80),  INT8_C(  32), -INT8_C( 103), -INT8_C(  62),  INT8_C( 119),
+         INT8_C(   3),  INT8_C(  70),  INT8_C(   3), -INT8_C(  50), -INT8_C(  65),  INT8_C(  71), -INT8_C(  25),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_multishift_epi64_epi8(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int64_t b[4];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C( 274270423),
+      { -INT8_C(  30), -INT8_C(   9),  INT8_C(  67), -INT8_C(  89), -INT8_C(  82), -INT8_C(  54),  INT8_C(  41),  INT8_C(  50),
+         INT8_C( 112), -INT8_C(  26),  INT8_C(  64), -INT8_C( 103),  INT8_C(  40), -INT8_C(  74), -INT8_C(  48), -INT8_C(  51),
+         INT8_C(  45), -INT8_C( 117), -INT8_C( 120),  INT8_C(   2),  INT8_C(  31),  INT8_C(  72),  INT8_C(   9),  INT8_C(  44),
+         INT8_C( 125),  INT8_C(  22), -INT8_C(  80),  INT8_C( 120),  INT8_C(  17),  INT8_C(  19), -INT8_C(  99),  INT8_C(  96) },
+      {  INT64_C( 1153207381925048384), -INT64_C( 8013549713408429928),  INT64_C(   72620552586002434),  INT64_C(  576460760893886816) },
+      {  INT8_C(   0),  INT8_C(  32),  INT8_C(   8),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0), -INT8_C( 126),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  35),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1299104328),
+      { -INT8_C( 113),  INT8_C(  92), -INT8_C(  91), -INT8_C( 115),      INT8_MIN,  INT8_C(  25),  INT8_C(  13),  INT8_C(  20),
+         INT8_C(  13), -INT8_C(  78),  INT8_C(  35), -INT8_C(  18), -INT8_C(  67),  INT8_C(  42),  INT8_C(  96),  INT8_C(  28),
+        -INT8_C(   2), -INT8_C(  78), -INT8_C(   8), -INT8_C(  74), -INT8_C( 115), -INT8_C(  77),  INT8_C(  16), -INT8_C(   2),
+         INT8_C( 111), -INT8_C(  25),  INT8_C(  92),  INT8_C(  85), -INT8_C( 120), -INT8_C(  35), -INT8_C(  68), -INT8_C(  78) },
+      {  INT64_C( 6075832531933710614), -INT64_C( 4612391768015503367),  INT64_C(  864691373268574309),  INT64_C( 4611703610688931912) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(  94),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  31), -INT8_C(   3),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  12),  INT8_C(  48),  INT8_C(   0),      INT8_MIN,  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36),  INT8_C(   0),  INT8_C(   0), -INT8_C( 124),  INT8_C(   0) } },
+    { UINT32_C(1255110950),
+      { -INT8_C(  13),  INT8_C(  35), -INT8_C(  79), -INT8_C(  95),  INT8_C(  90),  INT8_C( 103), -INT8_C(  36), -INT8_C(  96),
+        -INT8_C(  69), -INT8_C(   3),  INT8_C(   7),  INT8_C( 125), -INT8_C(  26), -INT8_C(   8), -INT8_C( 106),  INT8_C( 119),
+        -INT8_C(  13),  INT8_C( 105),  INT8_C(  99), -INT8_C( 106),  INT8_C(  10), -INT8_C( 117),  INT8_C( 104),  INT8_C(  41),
+         INT8_C(  45),  INT8_C(  95),  INT8_C(  77), -INT8_C(  78), -INT8_C(  57), -INT8_C(  41),  INT8_C( 103), -INT8_C(   7) },
+      {  INT64_C( 2435794329038759904), -INT64_C( 8468575638779115796), -INT64_C(  613619847275741225),  INT64_C( 6400120897043521590) },
+      {  INT8_C(   0), -INT8_C(  63), -INT8_C(  26),  INT8_C(   0),  INT8_C(   0),  INT8_C(  92),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 111),  INT8_C(   0),  INT8_C(   0),  INT8_C( 100),  INT8_C(  77), -INT8_C( 118), -INT8_C(  60),  INT8_C(   0),
+        -INT8_C(  17), -INT8_C(   3),      INT8_MAX, -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5), -INT8_C(   3),
+         INT8_C(   0),  INT8_C(  23),  INT8_C(   0),  INT8_C(  52),  INT8_C(   0),  INT8_C(   0), -INT8_C( 104),  INT8_C(   0) } },
+    { UINT32_C(2386638403),
+      { -INT8_C(  80), -INT8_C( 110),  INT8_C(  84),  INT8_C(  43), -INT8_C(  15), -INT8_C( 119),  INT8_C(  31),  INT8_C( 106),
+        -INT8_C(  43), -INT8_C( 101),  INT8_C(  17),  INT8_C(  22),  INT8_C(  77),  INT8_C( 115),  INT8_C(  32),  INT8_C(  97),
+        -INT8_C(  11), -INT8_C(  93), -INT8_C( 114), -INT8_C(  11),  INT8_C(  43), -INT8_C( 109), -INT8_C(  75),  INT8_C(  84),
+        -INT8_C(  40), -INT8_C(  70),  INT8_C(  52), -INT8_C(   6),  INT8_C(  63), -INT8_C( 112), -INT8_C( 107),  INT8_C(  89) },
+      { -INT64_C( 8070446838573957103), -INT64_C(   36033195065737221), -INT64_C( 4647750042768113673),  INT64_C( 3742421135391334738) },
+      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   3),  INT8_C(   0), -INT8_C(  33), -INT8_C(  17),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 116),  INT8_C(  62), -INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  29) } },
+    { UINT32_C( 999651810),
+      { -INT8_C( 102), -INT8_C(  49), -INT8_C( 110), -INT8_C(  31),  INT8_C(  97),  INT8_C( 115), -INT8_C(  40),  INT8_C( 105),
+        -INT8_C(  63),  INT8_C(  32),  INT8_C( 120), -INT8_C(  80), -INT8_C(  14),  INT8_C(   1), -INT8_C(  77),  INT8_C(  31),
+        -INT8_C(   9),  INT8_C(  96), -INT8_C(  27),  INT8_C( 103),  INT8_C( 115),  INT8_C(  24), -INT8_C( 115),  INT8_C(   0),
+         INT8_C(  85), -INT8_C(  37),  INT8_C(  31), -INT8_C(  70), -INT8_C(  19),  INT8_C(  77), -INT8_C( 109),  INT8_C(  13) },
+      {  INT64_C( 4900480582557901840), -INT64_C( 1153484729471729665), -INT64_C( 2887519068971295631), -INT64_C( 8647044675690101689) },
+      {  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN,  INT8_C(  64),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   3), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  81),  INT8_C(   0), -INT8_C(  59),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C( 113),
+        -INT8_C(  92), -INT8_C(  50),  INT8_C(   0), -INT8_C(  31), -INT8_C(   4),  INT8_C( 120),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1946358452),
+      { -INT8_C(  97),  INT8_C(  29), -INT8_C(  51),  INT8_C(  33),  INT8_C( 124), -INT8_C(  27), -INT8_C(  13),  INT8_C(  22),
+         INT8_C( 117), -INT8_C( 120), -INT8_C(  26),  INT8_C( 105), -INT8_C(  41),  INT8_C( 125),  INT8_C(  58), -INT8_C( 104),
+        -INT8_C(  32),  INT8_C(  27), -INT8_C(  96), -INT8_C(  91),  INT8_C(  68), -INT8_C(  71), -INT8_C( 118),  INT8_C(  81),
+        -INT8_C(  77), -INT8_C( 102),  INT8_C(  40),  INT8_C(  28),  INT8_C( 100), -INT8_C(  23), -INT8_C(  27), -INT8_C(  11) },
+      {  INT64_C( 9026973628549874403),  INT64_C(       8804716642310),  INT64_C(  198721539787457296), -INT64_C( 2612087783958773761) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(   0),  INT8_C(  55),  INT8_C(   5),  INT8_C(   0), -INT8_C(  70),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0) } },
+    { UINT32_C( 272185817),
+      {  INT8_C(  51), -INT8_C(  85),  INT8_C(  66), -INT8_C(  54),  INT8_C(  88),  INT8_C(  43),  INT8_C(  74),  INT8_C( 116),
+         INT8_C(  23),  INT8_C( 102), -INT8_C(  58),  INT8_C(  46),  INT8_C(  63), -INT8_C(  18), -INT8_C( 125), -INT8_C( 121),
+        -INT8_C(  37),  INT8_C(  89), -INT8_C( 106), -INT8_C(  51), -INT8_C(  89),  INT8_C(  23),      INT8_MAX,  INT8_C(  76),
+        -INT8_C( 112),  INT8_C(  51), -INT8_C(   1), -INT8_C(  27),  INT8_C(  80),  INT8_C(  46), -INT8_C( 112),  INT8_C(  61) },
+      {  INT64_C( 5350656250262587047), -INT64_C( 1325672438739675852),  INT64_C(    2322855794585600),  INT64_C(  297237586356798468) },
+      {  INT8_C(  72),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1), -INT8_C(  72),  INT8_C(   0),  INT8_C(   1), -INT8_C(  92),
+        -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C( 105),  INT8_C( 105),  INT8_C( 105),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1), -INT8_C( 127),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 150533337),
+      {  INT8_C(  24),  INT8_C(  99), -INT8_C(  82), -INT8_C( 119), -INT8_C( 116),  INT8_C(  93),  INT8_C(  37), -INT8_C( 124),
+         INT8_C(  22),  INT8_C(  57),  INT8_C(   2),  INT8_C( 123),  INT8_C(  85), -INT8_C(  12),  INT8_C(  98),  INT8_C(  78),
+        -INT8_C(   7),  INT8_C(  32),  INT8_C(  21), -INT8_C( 124),  INT8_C(  22), -INT8_C(  38),  INT8_C(  43), -INT8_C(  46),
+        -INT8_C(  30), -INT8_C(  45),  INT8_C( 100), -INT8_C(  87), -INT8_C(   3), -INT8_C( 106),  INT8_C( 125), -INT8_C(  63) },
+      { -INT64_C(    2330964717994181), -INT64_C( 1722656486317910892), -INT64_C( 3393394619250170669),  INT64_C( 1684619488172309612) },
+      { -INT8_C(   5),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(  65), -INT8_C(  13),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  37),  INT8_C(   0), -INT8_C(   9), -INT8_C( 127),  INT8_C(  67), -INT8_C(   2),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  77), -INT8_C( 125), -INT8_C(  88),  INT8_C(   7),  INT8_C(  55),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_multishift_epi64_epi8(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int64_t b[8];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  18), -INT8_C( 121), -INT8_C(   6), -INT8_C(  47),  INT8_C(  66), -INT8_C(  20), -INT8_C( 113),  INT8_C(   8),
+        -INT8_C( 119),  INT8_C(  87),  INT8_C(  34), -INT8_C(  42), -INT8_C(  87),  INT8_C(  62),  INT8_C(  13),  INT8_C(  87),
+        -INT8_C(  87),  INT8_C(  54),  INT8_C( 113), -INT8_C(  16), -INT8_C( 127),  INT8_C(  72), -INT8_C(  68),  INT8_C(  56),
+        -INT8_C( 113), -INT8_C( 103),  INT8_C(  87), -INT8_C( 119),  INT8_C(  86), -INT8_C(  48), -INT8_C(  15), -INT8_C(  10),
+        -INT8_C(  89),  INT8_C(  51),  INT8_C(  44),  INT8_C(  10),  INT8_C(  92), -INT8_C( 122),  INT8_C(  78), -INT8_C(  87),
+         INT8_C( 123),  INT8_C(  30),  INT8_C( 124), -INT8_C(  61), -INT8_C( 102), -INT8_C(  95),  INT8_C(  58), -INT8_C(  87),
+        -INT8_C(  43), -INT8_C( 102), -INT8_C(   9),  INT8_C(  95), -INT8_C(  92), -INT8_C(  72),  INT8_C(  67),  INT8_C(  54),
+         INT8_C( 120),  INT8_C( 111), -INT8_C( 118), -INT8_C(  14), -INT8_C(  45), -INT8_C( 103),  INT8_C(  34), -INT8_C(  56) },
+      {  INT64_C( 2882303917211844608),  INT64_C( 5456259816000323576), -INT64_C( 8233360800740896798),  INT64_C( 5515469755973361119),
+         INT64_C(  576531138227994920), -INT64_C( 2341871944212677316), -INT64_C( 6570288217522232802), -INT64_C( 8930637964841581568) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(  10),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(  51), -INT8_C(  39), -INT8_C( 101),  INT8_C(  67), -INT8_C(  31),      INT8_MAX, -INT8_C(  51),
+        -INT8_C( 100),  INT8_C(  54), -INT8_C(  34), -INT8_C(  67), -INT8_C(  15), -INT8_C( 113),  INT8_C(  40), -INT8_C( 115),
+         INT8_C( 103), -INT8_C(  85), -INT8_C(  84), -INT8_C(  18),  INT8_C(  88),  INT8_C(  51),  INT8_C(  69),  INT8_C(  50),
+             INT8_MIN,  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(  64),  INT8_C(   4),  INT8_C(  32),  INT8_C(  32),
+        -INT8_C( 101),      INT8_MAX, -INT8_C(  51), -INT8_C(  89), -INT8_C(   9), -INT8_C(  17),  INT8_C(  55), -INT8_C(   1),
+        -INT8_C( 107),  INT8_C(  84),  INT8_C(  73),  INT8_C(  90),  INT8_C(  90), -INT8_C(  92),  INT8_C(  67), -INT8_C( 109),
+        -INT8_C( 124),  INT8_C(  32),  INT8_C(   1),  INT8_C(   4),  INT8_C(   0),  INT8_C(  52),  INT8_C(   5),  INT8_C(   4) } },
+    { { -INT8_C(  72),  INT8_C(  10),  INT8_C(  24), -INT8_C(  55),  INT8_C(  69),      INT8_MIN,  INT8_C(  13), -INT8_C(  10),
+        -INT8_C(  50),  INT8_C(   2),  INT8_C(  89),  INT8_C(  48), -INT8_C( 125),  INT8_C(   0),  INT8_C(   7), -INT8_C(  57),
+        -INT8_C( 100),  INT8_C(  50), -INT8_C(   2), -INT8_C(  92),  INT8_C(  79),  INT8_C(  77), -INT8_C(  69), -INT8_C( 101),
+         INT8_C( 106),  INT8_C(  22),  INT8_C(   3), -INT8_C(  58),  INT8_C(  37), -INT8_C(  56), -INT8_C(  21),  INT8_C(  61),
+         INT8_C(  57),  INT8_C( 105), -INT8_C(  42),  INT8_C(  85), -INT8_C(   9), -INT8_C(  47), -INT8_C(  61), -INT8_C(  30),
+         INT8_C(  31),  INT8_C(  38),  INT8_C(  76), -INT8_C(  49), -INT8_C(  50),  INT8_C(  17),  INT8_C(  55),  INT8_C(  68),
+        -INT8_C(   9),  INT8_C(  20), -INT8_C(  53), -INT8_C( 100), -INT8_C( 109),  INT8_C(  60),  INT8_C( 125), -INT8_C(  39),
+        -INT8_C( 119), -INT8_C( 112),  INT8_C(  93), -INT8_C(  50),  INT8_C( 119), -INT8_C(  63), -INT8_C( 124), -INT8_C( 112) },
+      { -INT64_C(  594580703930220545), -INT64_C( 6048581991503018274),  INT64_C(  725079540023428130), -INT64_C( 8403173228344102751),
+         INT64_C( 5888712694553701521), -INT64_C( 2428875641761935610),  INT64_C(  290766125925859328),  INT64_C( 1152939973071241218) },
+      { -INT8_C(   9), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),      INT8_MAX, -INT8_C(  34),
+        -INT8_C( 115), -INT8_C(  73), -INT8_C(  36),  INT8_C(  15), -INT8_C(  37), -INT8_C(  34), -INT8_C( 115), -INT8_C( 115),
+         INT8_C(   0), -INT8_C( 124), -INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),
+         INT8_C( 123),  INT8_C(   9),  INT8_C(  20), -INT8_C(  62),  INT8_C( 115),  INT8_C(  48),  INT8_C(  61),  INT8_C(  12),
+        -INT8_C(  88),  INT8_C( 116), -INT8_C(  36), -INT8_C(  71), -INT8_C(  93), -INT8_C( 102), -INT8_C( 110),  INT8_C(  63),
+        -INT8_C(  15), -INT8_C( 103), -INT8_C(  28),  INT8_C(  92), -INT8_C(  71), -INT8_C( 105), -INT8_C(  68), -INT8_C(  16),
+         INT8_C(   8),  INT8_C(   8), -INT8_C(  32),  INT8_C(   4),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),
+         INT8_C(  64),  INT8_C(  66),  INT8_C(  96),  INT8_C(  10),  INT8_C(  32),  INT8_C(   1),  INT8_C(   0),  INT8_C(  66) } },
+    { {  INT8_C(  30),  INT8_C(  66),  INT8_C(  39),  INT8_C( 104), -INT8_C(   5),  INT8_C( 100),  INT8_C(  63), -INT8_C(  51),
+         INT8_C(   7),  INT8_C( 117),  INT8_C(  15),  INT8_C(   7), -INT8_C( 119),  INT8_C(  85),  INT8_C(  94), -INT8_C( 107),
+         INT8_C( 102), -INT8_C(  88),  INT8_C(  55), -INT8_C( 122),  INT8_C(  44),  INT8_C( 113), -INT8_C(  73), -INT8_C(  21),
+         INT8_C(  58), -INT8_C(  15), -INT8_C(   7),  INT8_C(   6),  INT8_C(  73), -INT8_C(  26), -INT8_C( 111),  INT8_C(  75),
+        -INT8_C(  68), -INT8_C(  24),  INT8_C(  43),  INT8_C(  85), -INT8_C(   9),  INT8_C( 100), -INT8_C(   7), -INT8_C(  36),
+        -INT8_C( 126),  INT8_C( 103), -INT8_C(  72), -INT8_C(  63),  INT8_C(  91),  INT8_C(  14),  INT8_C( 103), -INT8_C(  74),
+        -INT8_C(  52),  INT8_C(  47), -INT8_C(  96),  INT8_C( 105),  INT8_C(  69),  INT8_C(  33), -INT8_C(  95),  INT8_C(  52),
+         INT8_C(  17), -INT8_C(  94), -INT8_C( 106),  INT8_C(  33), -INT8_C(  79), -INT8_C(  42), -INT8_C( 108), -INT8_C( 106) },
+      {  INT64_C( 4113768841206870302), -INT64_C( 3195191913109332151), -INT64_C( 1209251684321075713), -INT64_C( 8176896631570820528),
+        -INT64_C(   72062131704660035), -INT64_C( 5284297771233221403), -INT64_C( 8343661658290650960),  INT64_C( 1142281932134828387) },
+      { -INT8_C(  36),  INT8_C(  71),  INT8_C(  21),  INT8_C(  10), -INT8_C(  57), -INT8_C(  81),  INT8_C(  60), -INT8_C(  91),
+        -INT8_C(  66), -INT8_C(  99), -INT8_C(  43), -INT8_C(  66),  INT8_C( 111),  INT8_C(  47), -INT8_C( 119),  INT8_C(  47),
+             INT8_MAX, -INT8_C(  33), -INT8_C(  34),  INT8_C( 119),  INT8_C( 125), -INT8_C( 101), -INT8_C(  34), -INT8_C(   5),
+         INT8_C(  35),  INT8_C(  66),  INT8_C(  71),  INT8_C(  73),  INT8_C(   9),  INT8_C(  79),  INT8_C(  17),  INT8_C(  66),
+        -INT8_C(  33), -INT8_C(   5), -INT8_C(   1), -INT8_C(  17), -INT8_C(   3), -INT8_C(  67), -INT8_C(   1), -INT8_C(   9),
+         INT8_C(  57), -INT8_C(  50), -INT8_C(  74),  INT8_C( 114), -INT8_C( 107),  INT8_C(   5), -INT8_C(  50), -INT8_C(  38),
+        -INT8_C(  96),  INT8_C( 106), -INT8_C(  19), -INT8_C(  83),  INT8_C(   5), -INT8_C(  10), -INT8_C(  10), -INT8_C(  61),
+         INT8_C(  31), -INT8_C(  41), -INT8_C(   8), -INT8_C(  82), -INT8_C(  19), -INT8_C(   8), -INT8_C(  29), -INT8_C(   8) } },
+    { {  INT8_C( 121), -INT8_C( 108), -INT8_C(   2),  INT8_C(  20),  INT8_C(  44),  INT8_C(  79),  INT8_C(  88), -INT8_C(  60),
+        -INT8_C( 117),  INT8_C(  35), -INT8_C(  37),  INT8_C(   3),  INT8_C(  60), -INT8_C(  30),  INT8_C( 107),  INT8_C(  56),
+         INT8_C(  29),  INT8_C(  89), -INT8_C(  37), -INT8_C(  29), -INT8_C(  22),  INT8_C(  23),  INT8_C(  83), -INT8_C(   2),
+        -INT8_C(  46),  INT8_C( 102), -INT8_C( 115),  INT8_C(  59),  INT8_C(  59),  INT8_C(   0), -INT8_C(  49),  INT8_C(  39),
+         INT8_C(  67),  INT8_C(  29),  INT8_C(  39),  INT8_C(  98),  INT8_C(  50), -INT8_C(  93), -INT8_C(  25), -INT8_C(  49),
+         INT8_C(  33),  INT8_C( 115),  INT8_C(  62), -INT8_C(  88),  INT8_C( 114), -INT8_C(  94),  INT8_C(  18), -INT8_C( 112),
+         INT8_C(  16),  INT8_C(  68),  INT8_C(  77),  INT8_C(  92),  INT8_C(  34),  INT8_C(  27), -INT8_C(  37),  INT8_C(   0),
+         INT8_C(  82), -INT8_C( 121),  INT8_C(  21),  INT8_C(  30),  INT8_C(  69), -INT8_C( 119),  INT8_C( 125),  INT8_C(  40) },
+      { -INT64_C( 3378697859217423455), -INT64_C(    6777565769891841), -INT64_C( 1157566430133645313), -INT64_C( 3789936557374920059),
+         INT64_C(      35322079486048), -INT64_C( 4972374524431963635),  INT64_C( 4611685399281008119),  INT64_C(   36029346842444804) },
+      { -INT8_C(  24), -INT8_C(  97), -INT8_C( 121), -INT8_C(  97), -INT8_C(  57), -INT8_C(  14), -INT8_C(  71),  INT8_C(  58),
+        -INT8_C(   1),  INT8_C( 122), -INT8_C(  33), -INT8_C(   1), -INT8_C(   1), -INT8_C(  11), -INT8_C(   3), -INT8_C(   1),
+        -INT8_C(  73),      INT8_MAX, -INT8_C(  33), -INT8_C(  18), -INT8_C(  33), -INT8_C(   1), -INT8_C(   2), -INT8_C(   1),
+         INT8_C(  25), -INT8_C(  61),  INT8_C(  53), -INT8_C(  71), -INT8_C(  71), -INT8_C( 123), -INT8_C(  51), -INT8_C(  31),
+         INT8_C(  12),  INT8_C(   0),  INT8_C(  64),  INT8_C(   8),  INT8_C(   0),  INT8_C(   4),  INT8_C(  64),  INT8_C(   0),
+        -INT8_C(  37),  INT8_C(  95),  INT8_C(  54), -INT8_C( 109), -INT8_C(  65), -INT8_C(  19),  INT8_C(  65),  INT8_C(   7),
+        -INT8_C(   1), -INT8_C(  33), -INT8_C(   1), -INT8_C(   3), -INT8_C(  37), -INT8_C(   6), -INT8_C(   6), -INT8_C(   9),
+         INT8_C(   2),  INT8_C(   8),  INT8_C(  32),  INT8_C(   0),  INT8_C(  32),  INT8_C(  66),  INT8_C(  32),  INT8_C(   0) } },
+    { { -INT8_C( 112), -INT8_C( 112), -INT8_C(   6), -INT8_C(  40), -INT8_C(  14),  INT8_C(  31),  INT8_C(   0), -INT8_C(  12),
+        -INT8_C(   7), -INT8_C(  96),  INT8_C(  92), -INT8_C( 112), -INT8_C(  14),  INT8_C(  79),  INT8_C(  25), -INT8_C( 123),
+         INT8_C(  90), -INT8_C(  65), -INT8_C( 115),  INT8_C(  43),  INT8_C(  54), -INT8_C(  70), -INT8_C(   5), -INT8_C(  69),
+         INT8_C(  55), -INT8_C(  66), -INT8_C(  98),  INT8_C(  37), -INT8_C(  59), -INT8_C(  65), -INT8_C(  75),  INT8_C( 118),
+         INT8_C(  54),  INT8_C(  75), -INT8_C(   5),  INT8_C(  59), -INT8_C(  52),  INT8_C(  14), -INT8_C(   6),  INT8_C( 121),
+         INT8_C( 105),  INT8_C(   6),  INT8_C(  82), -INT8_C(  46),  INT8_C(  84), -INT8_C(   7), -INT8_C(  38),  INT8_C(  82),
+        -INT8_C(  76), -INT8_C(  13), -INT8_C(  41),  INT8_C( 119), -INT8_C( 102), -INT8_C( 113),  INT8_C(  99), -INT8_C( 119),
+         INT8_C( 125), -INT8_C(   6),  INT8_C(  17),  INT8_C(  27),  INT8_C(  96), -INT8_C( 115), -INT8_C(  16),  INT8_C(  37) },
+      { -INT64_C(      10995116277825), -INT64_C(       1116768111777), -INT64_C( 5480673777474671632), -INT64_C(  621496748610687361),
+        -INT64_C( 7144490241177176262),  INT64_C( 1157710977265827840), -INT64_C(     140737489471746),  INT64_C( 2305845242865157632) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  65), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   5), -INT8_C(  65),  INT8_C( 110), -INT8_C(   1), -INT8_C(  35), -INT8_C(   3), -INT8_C( 102),
+         INT8_C(  46), -INT8_C(  31), -INT8_C( 105),  INT8_C(  23), -INT8_C(  49),  INT8_C(  44),  INT8_C(  22),  INT8_C(  22),
+        -INT8_C(  18), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C( 115), -INT8_C(   1), -INT8_C(  70), -INT8_C(  35),
+         INT8_C( 115),  INT8_C( 118),  INT8_C(  83),  INT8_C(  83),  INT8_C(  59), -INT8_C( 114), -INT8_C(  89),  INT8_C(  78),
+        -INT8_C( 126),  INT8_C(   0),  INT8_C(  32),  INT8_C(  32),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(  32),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  35), -INT8_C(   1),  INT8_C( 123),
+         INT8_C(   1),  INT8_C(   8),  INT8_C(   0),  INT8_C(   2),  INT8_C(   8),  INT8_C(   4),  INT8_C(   0),  INT8_C(  16) } },
+    { { -INT8_C(  69),  INT8_C(  30),  INT8_C(  73),  INT8_C(  71),  INT8_C(  91), -INT8_C(  77), -INT8_C( 119),  INT8_C( 125),
+        -INT8_C( 114),  INT8_C(  72), -INT8_C(  61), -INT8_C(  83),  INT8_C( 100), -INT8_C(  40),  INT8_C(  22),  INT8_C( 117),
+         INT8_C(  20), -INT8_C(  45),  INT8_C(  90), -INT8_C(  11), -INT8_C(   5),  INT8_C( 119), -INT8_C(  59), -INT8_C(  46),
+         INT8_C( 104), -INT8_C(  10),  INT8_C(  47),  INT8_C(  70),  INT8_C(  70), -INT8_C(  66), -INT8_C( 125), -INT8_C(  20),
+        -INT8_C( 121), -INT8_C( 103), -INT8_C(  93),  INT8_C(  15),  INT8_C(  29),  INT8_C(  46),  INT8_C(  88),  INT8_C(  74),
+         INT8_C(  67),  INT8_C(  37),  INT8_C(  10), -INT8_C(  42), -INT8_C(  75),  INT8_C(  70), -INT8_C( 103), -INT8_C(  67),
+         INT8_C(  63),  INT8_C(  71),  INT8_C(  74),  INT8_C(  65),  INT8_C( 118),  INT8_C(  10), -INT8_C(  82), -INT8_C(  29),
+         INT8_C( 108), -INT8_C(  92), -INT8_C( 122), -INT8_C(  36),  INT8_C(  12), -INT8_C(   3), -INT8_C(  94), -INT8_C( 127) },
+      { -INT64_C( 4611694848880754694),  INT64_C(  144405495793779281),  INT64_C( 1459167449923487777),  INT64_C(   11259566038712320),
+        -INT64_C( 6341229782155176247),  INT64_C( 5794376010860606804),  INT64_C( 4684306584583536648),  INT64_C( 4611703649268204688) },
+      {  INT8_C(  87), -INT8_C(  33),  INT8_C(  95),      INT8_MAX, -INT8_C(   1), -INT8_C(   1),  INT8_C(  95), -INT8_C(  43),
+        -INT8_C( 100),  INT8_C(   2),  INT8_C(  74),  INT8_C(   8),      INT8_MIN, -INT8_C( 120),  INT8_C(  33),  INT8_C(  16),
+         INT8_C(   8),  INT8_C(  16),  INT8_C(  36), -INT8_C(  94),  INT8_C(  34),  INT8_C(  40),  INT8_C(  65),  INT8_C(  32),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN,
+        -INT8_C(  83),  INT8_C(  33), -INT8_C(  93),  INT8_C(   6), -INT8_C(  30), -INT8_C(   3),  INT8_C(  67), -INT8_C(  43),
+        -INT8_C(  86),  INT8_C(  18),  INT8_C(  13), -INT8_C(  71), -INT8_C( 125), -INT8_C(  43),  INT8_C(  23), -INT8_C(  94),
+         INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(  18), -INT8_C( 112),  INT8_C(  16), -INT8_C( 126),  INT8_C(   2),  INT8_C(  72) } },
+    { { -INT8_C(  63),  INT8_C(  37),  INT8_C(  81), -INT8_C(  34), -INT8_C(  61), -INT8_C(  70), -INT8_C(   7), -INT8_C(  94),
+        -INT8_C(   3), -INT8_C(  69), -INT8_C(  85), -INT8_C(  93), -INT8_C(  24),  INT8_C( 115), -INT8_C(  51),      INT8_MIN,
+         INT8_C(  35),  INT8_C(  39),  INT8_C(  63), -INT8_C( 117), -INT8_C(  92),  INT8_C(  38), -INT8_C(  84),  INT8_C(  70),
+         INT8_C(  45),  INT8_C( 119),  INT8_C(  93),  INT8_C(  24), -INT8_C(  28),  INT8_C(  24), -INT8_C(   1), -INT8_C(  45),
+         INT8_C(  36), -INT8_C( 119), -INT8_C( 122), -INT8_C( 127),  INT8_C(  12),  INT8_C( 104),  INT8_C(  75),  INT8_C(  91),
+         INT8_C(  25), -INT8_C(  11),  INT8_C(  66), -INT8_C(  69),  INT8_C(  25), -INT8_C(   1), -INT8_C(  76), -INT8_C( 109),
+        -INT8_C(  57), -INT8_C( 114),  INT8_C( 119),  INT8_C(  64), -INT8_C(   6), -INT8_C(  72), -INT8_C(  99),  INT8_C(  84),
+         INT8_C(  48),  INT8_C(   5), -INT8_C(  40),  INT8_C(  15), -INT8_C( 109),  INT8_C(   3), -INT8_C( 111), -INT8_C(   4) },
+      {  INT64_C(   72339071180998660),  INT64_C(  324822157502709780),  INT64_C( 2324147955819486216),  INT64_C( 5584152745347777534),
+         INT64_C(   37154697529786370), -INT64_C( 6692461964813084425), -INT64_C( 4511653561437062843),  INT64_C( 6785739166987340462) },
+      {  INT8_C(   2),  INT8_C(   0), -INT8_C( 112),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  96),      INT8_MIN,  INT8_C(  64),  INT8_C(   1),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(  20),
+         INT8_C(   8),  INT8_C(  16),  INT8_C(  16),  INT8_C(  67), -INT8_C( 124),  INT8_C(  33),  INT8_C(  16),  INT8_C( 112),
+        -INT8_C(   9), -INT8_C( 102), -INT8_C(  81), -INT8_C(  11),  INT8_C(  85), -INT8_C(  11), -INT8_C(   4), -INT8_C(  65),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),
+        -INT8_C( 115),  INT8_C(  24),  INT8_C(  61), -INT8_C(  12), -INT8_C( 115), -INT8_C(  17),  INT8_C(  49),  INT8_C(  80),
+        -INT8_C(  14), -INT8_C(  85), -INT8_C( 126),  INT8_C(  69),  INT8_C( 112), -INT8_C(  63), -INT8_C(  22), -INT8_C( 114),
+         INT8_C(  43),  INT8_C(  85), -INT8_C(  22),  INT8_C( 120),  INT8_C(  87),  INT8_C(  85),  INT8_C(  94), -INT8_C(  27) } },
+    { { -INT8_C(  74), -INT8_C(  38), -INT8_C(  89), -INT8_C(  74), -INT8_C(  19),  INT8_C(  85),  INT8_C(  45), -INT8_C( 110),
+         INT8_C(  58), -INT8_C(  38), -INT8_C(  29),  INT8_C( 121),  INT8_C(  60), -INT8_C(  23),  INT8_C(  94), -INT8_C( 117),
+         INT8_C(  29),  INT8_C(  66),  INT8_C(  16), -INT8_C(  88), -INT8_C(   2),  INT8_C(  46),  INT8_C(  97), -INT8_C(  58),
+        -INT8_C(  86), -INT8_C(  35),  INT8_C(  81), -INT8_C( 110),  INT8_C(   3), -INT8_C(  69),  INT8_C(  21), -INT8_C(   7),
+        -INT8_C( 109), -INT8_C(  49),  INT8_C(  59),  INT8_C(  66), -INT8_C(  25), -INT8_C(  46), -INT8_C(  44), -INT8_C(  47),
+         INT8_C(  27),  INT8_C( 110), -INT8_C(  12), -INT8_C( 122), -INT8_C(  71),  INT8_C( 107), -INT8_C(  10),  INT8_C(  90),
+         INT8_C(  55), -INT8_C(  29), -INT8_C(  35),  INT8_C(  84),  INT8_C(  88), -INT8_C(  92),  INT8_C(  45), -INT8_C(  22),
+        -INT8_C(  55),      INT8_MIN,  INT8_C(  42), -INT8_C(  24), -INT8_C(  92),  INT8_C(   2), -INT8_C(  39), -INT8_C(  92) },
+      { -INT64_C(    1143492101342338),  INT64_C( 3844096114155899929),  INT64_C( 2305843009365476356), -INT64_C( 8510153793322181569),
+        -INT64_C( 3547443793023161331), -INT64_C( 5238609768025745045),  INT64_C(    4644886871547906), -INT64_C( 2685297950019440840) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(  33), -INT8_C(   1), -INT8_C(  33), -INT8_C(   5), -INT8_C(  33), -INT8_C(  33),
+         INT8_C(  77),  INT8_C(  33),  INT8_C(  33), -INT8_C( 102), -INT8_C( 109),  INT8_C( 124),  INT8_C(  50),  INT8_C(  25),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(  12),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),
+         INT8_C( 119), -INT8_C(  75), -INT8_C( 117),  INT8_C(  69), -INT8_C( 121), -INT8_C(  15), -INT8_C(  88), -INT8_C(  60),
+         INT8_C(   6),  INT8_C(  97), -INT8_C(  71),  INT8_C(   3), -INT8_C(  27),  INT8_C(  12), -INT8_C( 125),  INT8_C(  24),
+         INT8_C( 123),  INT8_C(  50),  INT8_C( 116),  INT8_C( 101), -INT8_C(  37), -INT8_C( 105), -INT8_C(  35), -INT8_C(  10),
+         INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8), -INT8_C( 124),  INT8_C(  32),
+        -INT8_C(  41),  INT8_C(  56), -INT8_C(   7), -INT8_C(  25),  INT8_C( 123), -INT8_C(  50), -INT8_C(  14),  INT8_C( 123) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_multishift_epi64_epi8(a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int64_t b[8];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C(   1),  INT8_C(  87), -INT8_C( 116),  INT8_C( 117),  INT8_C(  49), -INT8_C(   1), -INT8_C(  22), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(  65),  INT8_C(  13), -INT8_C(   1), -INT8_C(  41),  INT8_C(   0),      INT8_MIN, -INT8_C(   1),
+        -INT8_C(  73),  INT8_C(  97),  INT8_C(   5), -INT8_C(  75), -INT8_C(  82), -INT8_C(   1), -INT8_C(  56),  INT8_C(  26),
+         INT8_C( 104),  INT8_C(   1),  INT8_C(  78),  INT8_C(   1), -INT8_C(  33),      INT8_MAX,  INT8_C(  23),  INT8_C(  68),
+        -INT8_C(  37),  INT8_C( 105), -INT8_C(  39), -INT8_C(  80),  INT8_C(   0), -INT8_C(  25), -INT8_C( 110),  INT8_C(  51),
+         INT8_C(  92), -INT8_C(  77),  INT8_C(  63),  INT8_C(   0), -INT8_C(  73), -INT8_C(  17),  INT8_C(  16),  INT8_C(  13),
+        -INT8_C(   1),  INT8_C(  30),  INT8_C(   1), -INT8_C(  65), -INT8_C(   1),  INT8_C(  22), -INT8_C(  92), -INT8_C(  47),
+         INT8_C(  65),  INT8_C(  20),  INT8_C(  92),  INT8_C(   9), -INT8_C(  82), -INT8_C( 115), -INT8_C(   1),  INT8_C(   0) },
+      UINT64_C(11023747670364042359),
+      { -INT8_C(  45), -INT8_C(  54), -INT8_C(  12), -INT8_C(   1),  INT8_C(  61), -INT8_C(  34),  INT8_C(  75), -INT8_C(  26),
+         INT8_C(  81), -INT8_C(  86), -INT8_C(  78), -INT8_C(  12),  INT8_C(  50), -INT8_C(  38), -INT8_C( 124), -INT8_C(  70),
+         INT8_C(   4), -INT8_C(  69),  INT8_C(  20), -INT8_C(  27), -INT8_C(  26), -INT8_C(   6),  INT8_C(  69),  INT8_C( 116),
+        -INT8_C(  34), -INT8_C( 126), -INT8_C(  21), -INT8_C( 118), -INT8_C( 121), -INT8_C(  91), -INT8_C(  57), -INT8_C(  20),
+         INT8_C(  15),  INT8_C(  11),  INT8_C(  49),  INT8_C(  37), -INT8_C(  12),  INT8_C( 111), -INT8_C(  82), -INT8_C(  49),
+        -INT8_C(  41), -INT8_C(  94),  INT8_C(   6),  INT8_C( 111),  INT8_C(  68), -INT8_C(   8), -INT8_C( 110),  INT8_C(   6),
+        -INT8_C(  54), -INT8_C( 123), -INT8_C(  15), -INT8_C(  64),  INT8_C(  24), -INT8_C(  51), -INT8_C(  96), -INT8_C(  97),
+         INT8_C(  50),  INT8_C(  82),  INT8_C(   0),  INT8_C(  24),  INT8_C( 115), -INT8_C(  27),  INT8_C( 113), -INT8_C(  55) },
+      { -INT64_C( 5726398165080086210), -INT64_C( 2231947067537730096), -INT64_C( 2305843047868400147),  INT64_C( 3240125948181132833),
+        -INT64_C(    1692217114624033), -INT64_C(   36873222559637537),  INT64_C(    1125900982976513),  INT64_C( 2071954895771009025) },
+      { -INT8_C(   2), -INT8_C(   6),  INT8_C(   8),  INT8_C( 117), -INT8_C(  11), -INT8_C(  43),  INT8_C( 125), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(  65),  INT8_C(  65), -INT8_C(   1),  INT8_C(  65), -INT8_C(  22),      INT8_MIN,  INT8_C(  56),
+        -INT8_C(  73), -INT8_C(  69), -INT8_C(   1), -INT8_C(  75), -INT8_C(   1), -INT8_C(   1), -INT8_C(  56), -INT8_C(   1),
+        -INT8_C( 120),  INT8_C(   1),  INT8_C(  78),  INT8_C(   1),  INT8_C( 108),      INT8_MAX,  INT8_C(  23),  INT8_C( 115),
+        -INT8_C(   1),  INT8_C( 105), -INT8_C(  39), -INT8_C(  25), -INT8_C(   1), -INT8_C(  25), -INT8_C( 110),  INT8_C(  51),
+         INT8_C(  92), -INT8_C(  77),  INT8_C(  63), -INT8_C(   7), -INT8_C(   3), -INT8_C(   1),  INT8_C(  16),  INT8_C(  13),
+        -INT8_C(   1),  INT8_C(  30),  INT8_C(   2),  INT8_C(   1),  INT8_C(  64),  INT8_C(  36),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  65),  INT8_C(  20),  INT8_C(  92),  INT8_C(   1), -INT8_C( 104), -INT8_C( 115), -INT8_C(   1),  INT8_C(   0) } },
+    { { -INT8_C( 126), -INT8_C(  18), -INT8_C(  97),  INT8_C(   4),  INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(  10),
+         INT8_C( 125), -INT8_C(   1),  INT8_C(   0),  INT8_C(  58),  INT8_C( 123),  INT8_C(   2), -INT8_C(  68), -INT8_C(  96),
+         INT8_C(  21),  INT8_C(  60), -INT8_C(  38),  INT8_C(   1), -INT8_C(  90),  INT8_C(   8), -INT8_C(  25), -INT8_C(   1),
+        -INT8_C(  37), -INT8_C(   3),  INT8_C(  16),  INT8_C(  84), -INT8_C(  54), -INT8_C(  97), -INT8_C(  21), -INT8_C(  42),
+         INT8_C(  32),  INT8_C( 121),  INT8_C(  40),  INT8_C(  32), -INT8_C(  19),  INT8_C(  16),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(  58),  INT8_C(  96),  INT8_C(   2), -INT8_C(  36),  INT8_C(   0),  INT8_C(  40),  INT8_C(  50), -INT8_C(   5),
+        -INT8_C(   5), -INT8_C(  84), -INT8_C(  93), -INT8_C(   1),  INT8_C(  48),  INT8_C( 102),  INT8_C(  48), -INT8_C(  13),
+         INT8_C(   2), -INT8_C(  59), -INT8_C( 117),  INT8_C(  27), -INT8_C(  33),  INT8_C(  16),  INT8_C( 109),  INT8_C(   2) },
+      UINT64_C(10401158338697869898),
+      {  INT8_C(  10), -INT8_C(   9), -INT8_C(  28),  INT8_C(  27), -INT8_C(  75),  INT8_C(  15),  INT8_C(  63), -INT8_C(  44),
+        -INT8_C(  94), -INT8_C(  82), -INT8_C( 105),  INT8_C(  21),  INT8_C(  29), -INT8_C(   6),  INT8_C(  73), -INT8_C(  60),
+        -INT8_C(  30),  INT8_C(   9),  INT8_C(  51),  INT8_C( 107), -INT8_C(  21), -INT8_C(  66),  INT8_C(  89), -INT8_C(  51),
+         INT8_C( 106),  INT8_C(  57),  INT8_C( 124), -INT8_C(  36),  INT8_C(  97), -INT8_C(  56), -INT8_C( 102), -INT8_C(  74),
+        -INT8_C(  94),  INT8_C( 110),  INT8_C(  49),  INT8_C(  65), -INT8_C(  80), -INT8_C(  37), -INT8_C(  70), -INT8_C(  90),
+        -INT8_C( 119),  INT8_C(  21), -INT8_C(  11),  INT8_C(  49), -INT8_C(  92),  INT8_C(  75), -INT8_C( 108),  INT8_C( 126),
+         INT8_C(  39), -INT8_C(  26), -INT8_C( 106), -INT8_C(  53), -INT8_C( 125), -INT8_C( 125), -INT8_C( 101), -INT8_C(  74),
+        -INT8_C(  44),  INT8_C(  21), -INT8_C(  78),  INT8_C(  12),  INT8_C(  38),  INT8_C(  32),  INT8_C(  26),  INT8_C(   8) },
+      {  INT64_C( 8062564285090365403), -INT64_C( 2666131537751245189),  INT64_C( 9223072866411478975),  INT64_C( 9105231847648315567),
+        -INT64_C( 2599587192130993382),  INT64_C(   72057617660317744),  INT64_C( 7806374052557718104), -INT64_C( 6953735951088616065) },
+      { -INT8_C( 126), -INT8_C(  33), -INT8_C(  97), -INT8_C(   1),  INT8_C(   1), -INT8_C(   1), -INT8_C(  74), -INT8_C(  10),
+         INT8_C( 125), -INT8_C(   1),  INT8_C(   0), -INT8_C(   2), -INT8_C(  17), -INT8_C(  10), -INT8_C(  68), -INT8_C(  25),
+        -INT8_C(   7),  INT8_C(  60), -INT8_C(   1), -INT8_C(  35), -INT8_C(  90), -INT8_C(   3), -INT8_C(  25), -INT8_C(   1),
+        -INT8_C(  37), -INT8_C(  65), -INT8_C(   9), -INT8_C(   5),  INT8_C(  15), -INT8_C(  56), -INT8_C(  21), -INT8_C(   7),
+         INT8_C(  32), -INT8_C(  79), -INT8_C(  10),  INT8_C(  32), -INT8_C(  19),  INT8_C(  26), -INT8_C(  74),  INT8_C(   1),
+         INT8_C(  58),  INT8_C(   0),  INT8_C(   8), -INT8_C(  36),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0), -INT8_C(   5),
+        -INT8_C(   5), -INT8_C(  84), -INT8_C(  93), -INT8_C(  16),  INT8_C(  75),  INT8_C( 102), -INT8_C(  24), -INT8_C(  13),
+         INT8_C(   2), -INT8_C(  59), -INT8_C( 117),  INT8_C(  27),  INT8_C( 119),  INT8_C(  16),  INT8_C( 109), -INT8_C(   3) } },
+    { {  INT8_C(   0), -INT8_C(  94),  INT8_C(   5), -INT8_C(   1),      INT8_MIN, -INT8_C( 124),  INT8_C(  86),  INT8_C(  94),
+        -INT8_C(  85),  INT8_C(   0),  INT8_C(  16),  INT8_C(  78), -INT8_C( 114),  INT8_C(  83),  INT8_C( 115), -INT8_C(  65),
+        -INT8_C(  96), -INT8_C(   1),  INT8_C(   0), -INT8_C(  17), -INT8_C(  60),  INT8_C(  49),  INT8_C( 108), -INT8_C(  49),
+         INT8_C(  16), -INT8_C(  70), -INT8_C(   5),  INT8_C(  16), -INT8_C(  21), -INT8_C(   1),  INT8_C(  11),  INT8_C(   1),
+        -INT8_C(   5), -INT8_C(  33), -INT8_C(   9), -INT8_C( 121), -INT8_C(  82),  INT8_C(  16), -INT8_C(  19), -INT8_C(   9),
+         INT8_C(  36),  INT8_C(  30), -INT8_C(  63),  INT8_C(   1), -INT8_C(  41),  INT8_C( 114),  INT8_C(   8),  INT8_C(   2),
+             INT8_MIN, -INT8_C(   1), -INT8_C(   2),  INT8_C(   0), -INT8_C(  32), -INT8_C(  41), -INT8_C(  33),      INT8_MAX,
+        -INT8_C(  60),  INT8_C(  28),      INT8_MIN,  INT8_C(   0),  INT8_C(   7), -INT8_C( 112), -INT8_C(  68),  INT8_C(  17) },
+      UINT64_C(10167364578219468565),
+      { -INT8_C(  40), -INT8_C(  55), -INT8_C(  67), -INT8_C(  30),  INT8_C(  45), -INT8_C( 119),  INT8_C(  31), -INT8_C(  15),
+         INT8_C(  16), -INT8_C(  70), -INT8_C(  63), -INT8_C( 107), -INT8_C(  63), -INT8_C(  97),  INT8_C(  11),  INT8_C(  83),
+         INT8_C(  23), -INT8_C( 105),  INT8_C(  25),  INT8_C(  54),  INT8_C(  12),  INT8_C(  63), -INT8_C(  62), -INT8_C( 126),
+         INT8_C(  78), -INT8_C( 123), -INT8_C(  95), -INT8_C(  23), -INT8_C(  83),  INT8_C(  34),  INT8_C( 102), -INT8_C(  83),
+         INT8_C(  91),  INT8_C(  80),  INT8_C( 103),  INT8_C(  38), -INT8_C(   2), -INT8_C( 123), -INT8_C(  22),  INT8_C( 101),
+        -INT8_C(  43), -INT8_C(  19), -INT8_C(  89), -INT8_C(  52),  INT8_C(  40),  INT8_C(  35), -INT8_C(   3), -INT8_C(  58),
+        -INT8_C(  72),  INT8_C( 106),  INT8_C(  92),  INT8_C(  32),  INT8_C( 120),  INT8_C(  68), -INT8_C(  91),  INT8_C(  77),
+        -INT8_C(  90),  INT8_C(  40), -INT8_C(  40), -INT8_C(  84), -INT8_C(  10), -INT8_C(  86),  INT8_C( 124),  INT8_C(  60) },
+      { -INT64_C( 1817438261611021059), -INT64_C(    9289773747276033),  INT64_C( 3925334817821464724),  INT64_C(       1102741524480),
+         INT64_C( 8952064325677079515), -INT64_C( 4004973734257371564),  INT64_C(  297999363015402276),  INT64_C(  713432276175205284) },
+      { -INT8_C(  65), -INT8_C(  94), -INT8_C(  17), -INT8_C(   1),  INT8_C(  57), -INT8_C( 124),  INT8_C(  86),  INT8_C(  94),
+        -INT8_C(  65), -INT8_C(   1),      INT8_MAX,  INT8_C(  78), -INT8_C( 114), -INT8_C(   1),  INT8_C( 115), -INT8_C(  65),
+         INT8_C(  97), -INT8_C(   1),  INT8_C(   0), -INT8_C(  39), -INT8_C(  60),  INT8_C(  40),  INT8_C( 108),  INT8_C(  37),
+         INT8_C(  16),      INT8_MIN, -INT8_C(   5),  INT8_C(  16), -INT8_C(  21), -INT8_C(   1),  INT8_C(  11),  INT8_C(   1),
+         INT8_C(  95),  INT8_C( 109),  INT8_C(  62), -INT8_C( 121),  INT8_C( 109), -INT8_C(  34), -INT8_C(  19), -INT8_C(   9),
+         INT8_C(  36),  INT8_C(  30), -INT8_C(  13),  INT8_C(  29),  INT8_C( 121),  INT8_C(  51),  INT8_C(   8),  INT8_C(  89),
+         INT8_C(   4), -INT8_C(   1), -INT8_C(   2), -INT8_C(  41),  INT8_C(   4), -INT8_C(  41), -INT8_C(  33),      INT8_MAX,
+         INT8_C( 123),  INT8_C(  28),  INT8_C(  16),  INT8_C( 105),  INT8_C(   7), -INT8_C( 112), -INT8_C(  68),  INT8_C(  64) } },
+    { {  INT8_C( 126), -INT8_C(  94),      INT8_MIN,  INT8_C(  31), -INT8_C(   1),  INT8_C(   0), -INT8_C(   9),  INT8_C(   0),
+        -INT8_C(  76),  INT8_C(   2), -INT8_C(  66),  INT8_C(   1), -INT8_C(  55), -INT8_C(  52), -INT8_C(  53),      INT8_MIN,
+         INT8_C(   3),  INT8_C(  85), -INT8_C(   3), -INT8_C(  18), -INT8_C( 109),  INT8_C(  20), -INT8_C(   2), -INT8_C( 120),
+         INT8_C(  17), -INT8_C(   5), -INT8_C(  71),  INT8_C(  61),  INT8_C(  67), -INT8_C(  37),  INT8_C(  94), -INT8_C(  65),
+        -INT8_C(   3), -INT8_C(  68), -INT8_C(  66), -INT8_C(   1),  INT8_C(  24),  INT8_C(  64), -INT8_C(   4), -INT8_C(  85),
+        -INT8_C(   1),  INT8_C( 120),  INT8_C(   0), -INT8_C(  45),      INT8_MIN,  INT8_C(   0), -INT8_C( 119),  INT8_C(   8),
+         INT8_C(  64), -INT8_C(  65),  INT8_C(   0),  INT8_C(  53),  INT8_C(  91),  INT8_C(  60),  INT8_C(   0),  INT8_C(  55),
+         INT8_C( 123),  INT8_C(   8), -INT8_C(  37),  INT8_C(  29), -INT8_C(   8), -INT8_C(  65), -INT8_C(  16), -INT8_C(   1) },
+      UINT64_C( 4638134927729284458),
+      {  INT8_C(  42), -INT8_C(  66),  INT8_C(  86), -INT8_C(  22),  INT8_C(  74), -INT8_C(  65),  INT8_C(  62), -INT8_C(  31),
+         INT8_C(  18), -INT8_C(  35), -INT8_C(  68),  INT8_C(  18), -INT8_C( 116),  INT8_C(   0),  INT8_C(  72), -INT8_C(  46),
+         INT8_C(   7), -INT8_C(  40),  INT8_C(  51), -INT8_C(  39), -INT8_C(  87),  INT8_C(  14), -INT8_C(  16),  INT8_C(  94),
+        -INT8_C( 104), -INT8_C( 111), -INT8_C(   5), -INT8_C( 114), -INT8_C(  56),  INT8_C(  24), -INT8_C( 103), -INT8_C(  59),
+        -INT8_C(  49), -INT8_C( 106),  INT8_C(  23), -INT8_C( 127), -INT8_C(  63), -INT8_C( 100), -INT8_C(  65),  INT8_C(  86),
+        -INT8_C(  84),  INT8_C(  95), -INT8_C(  99),  INT8_C(  13), -INT8_C(  37),  INT8_C(  29), -INT8_C( 123),  INT8_C( 111),
+        -INT8_C( 102), -INT8_C(  99), -INT8_C(  88), -INT8_C(  86), -INT8_C( 107),  INT8_C(  77), -INT8_C(  10), -INT8_C(  38),
+        -INT8_C(  66),  INT8_C(   2), -INT8_C(  74),  INT8_C(  44), -INT8_C(  34), -INT8_C(   3),  INT8_C(  21),  INT8_C(   2) },
+      { -INT64_C(  576478894429831177),  INT64_C( 9223070714834186237),  INT64_C( 1374806607447845031), -INT64_C( 1882821303597072385),
+        -INT64_C( 1430887322984360002),  INT64_C(    5106132005683246),  INT64_C( 8815192641223271380),  INT64_C(     141441864040504) },
+      {  INT8_C( 126), -INT8_C(  33),      INT8_MIN, -INT8_C(   5), -INT8_C(   1), -INT8_C(  17), -INT8_C(  33),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   2), -INT8_C(  41),  INT8_C(   1), -INT8_C(   2), -INT8_C(  52), -INT8_C(  17), -INT8_C(   1),
+         INT8_C(   3),  INT8_C(  79), -INT8_C(   3), -INT8_C(  18), -INT8_C( 109),  INT8_C(  39), -INT8_C(   2),  INT8_C(  77),
+        -INT8_C(   1), -INT8_C(  57), -INT8_C(  71),  INT8_C(  61), -INT8_C(   1), -INT8_C(  37),  INT8_C(  94), -INT8_C(   1),
+        -INT8_C(   3), -INT8_C(  68),  INT8_C(  47), -INT8_C(   1),  INT8_C(  24), -INT8_C(   7), -INT8_C(   4), -INT8_C(  85),
+         INT8_C(  34),  INT8_C(   0),  INT8_C(   0), -INT8_C(  45),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(  36),
+         INT8_C(  37), -INT8_C(  65), -INT8_C(  37),  INT8_C( 118), -INT8_C(  74),  INT8_C(  60), -INT8_C(  23),  INT8_C(  55),
+         INT8_C( 123),  INT8_C(   8), -INT8_C(  37),  INT8_C(  29), -INT8_C(   8), -INT8_C(  65),  INT8_C(   0), -INT8_C(   1) } },
+    { { -INT8_C(  33), -INT8_C(   4), -INT8_C(   1),  INT8_C(   4),  INT8_C(   1),  INT8_C(  18), -INT8_C(  17),  INT8_C(   0),
+         INT8_C(  52), -INT8_C(  22),  INT8_C(  48), -INT8_C(  81),  INT8_C(  16),  INT8_C(  56),  INT8_C(   0), -INT8_C(  65),
+         INT8_C(   0), -INT8_C( 105), -INT8_C(  88),  INT8_C(  78),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  29), -INT8_C(  63),  INT8_C(  95), -INT8_C(  36),  INT8_C(  16), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(   0), -INT8_C(  65),  INT8_C(  16), -INT8_C(  69), -INT8_C( 113), -INT8_C(  80),  INT8_C(  99),
+        -INT8_C(  43),  INT8_C(   8),  INT8_C(   0),  INT8_C(   4), -INT8_C( 126), -INT8_C( 121), -INT8_C(  74),  INT8_C(  12),
+        -INT8_C(   1), -INT8_C( 101), -INT8_C(   1), -INT8_C(   8),  INT8_C(   8),  INT8_C(  67),  INT8_C(  25), -INT8_C(  62),
+        -INT8_C(   3), -INT8_C(   1), -INT8_C(  20), -INT8_C(  33), -INT8_C(  33),  INT8_C(  70), -INT8_C(  28),  INT8_C(   4) },
+      UINT64_C(11012285426940344847),
+      {  INT8_C(  41),  INT8_C(  82),  INT8_C( 116),  INT8_C(  18), -INT8_C(  22),  INT8_C( 108),  INT8_C(  28),  INT8_C(  60),
+         INT8_C(  43),  INT8_C(  20), -INT8_C(  50),  INT8_C(  48), -INT8_C(   9),  INT8_C(  45),  INT8_C( 120), -INT8_C( 110),
+        -INT8_C(  63), -INT8_C(  58), -INT8_C(  36), -INT8_C( 122), -INT8_C(  19),  INT8_C(  80), -INT8_C(   6),  INT8_C(  84),
+         INT8_C( 103), -INT8_C( 106),  INT8_C(  32), -INT8_C(   6), -INT8_C(  87), -INT8_C(  45),  INT8_C(  66), -INT8_C(  26),
+        -INT8_C(  32),  INT8_C(  13),  INT8_C(  85),  INT8_C(  98), -INT8_C(  79),  INT8_C(  32),  INT8_C(  90), -INT8_C(  69),
+        -INT8_C(  51), -INT8_C(  92), -INT8_C(  49), -INT8_C(  28), -INT8_C(  12), -INT8_C(   8),  INT8_C( 110), -INT8_C( 123),
+         INT8_C(  22), -INT8_C(  86), -INT8_C( 106),  INT8_C( 111), -INT8_C( 108),  INT8_C( 104), -INT8_C(  56), -INT8_C(  52),
+        -INT8_C(  10), -INT8_C( 125), -INT8_C( 104),  INT8_C(  18), -INT8_C(  28),  INT8_C( 120), -INT8_C(  58),  INT8_C( 115) },
+      {  INT64_C(           202702858), -INT64_C( 2665757732757031908), -INT64_C(  719617077135257256), -INT64_C( 4913225304296247587),
+        -INT64_C(   72058968603633665), -INT64_C( 1047599086607362913), -INT64_C(    4802666807427331), -INT64_C( 4198114122547956917) },
+      {  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),  INT8_C(  18), -INT8_C(  17),  INT8_C(   0),
+         INT8_C(  52),  INT8_C(  28),  INT8_C(  48),  INT8_C(   1), -INT8_C(  74),  INT8_C(  10), -INT8_C(  37), -INT8_C(  65),
+        -INT8_C(  84), -INT8_C( 105),  INT8_C(  75),  INT8_C(  69),  INT8_C(  27),  INT8_C(  12),  INT8_C(  61), -INT8_C(  16),
+         INT8_C( 111), -INT8_C(  63), -INT8_C(  99),  INT8_C( 110),  INT8_C(  16), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(   0), -INT8_C(  65),  INT8_C(  16), -INT8_C(  69), -INT8_C( 113), -INT8_C(   3),  INT8_C(  99),
+        -INT8_C(  12), -INT8_C(  30),  INT8_C( 125), -INT8_C(  30),  INT8_C(  23), -INT8_C(  15), -INT8_C(  40),  INT8_C(  12),
+        -INT8_C(   5), -INT8_C(  69), -INT8_C(   1), -INT8_C(   8), -INT8_C(  17),  INT8_C(  67), -INT8_C(   2),      INT8_MAX,
+        -INT8_C(   3), -INT8_C(   1), -INT8_C(  20), -INT8_C(  66), -INT8_C(  41),  INT8_C(  70), -INT8_C(  28), -INT8_C(  73) } },
+    { { -INT8_C(  52),      INT8_MAX,  INT8_C(  79),  INT8_C(   1), -INT8_C(  35),  INT8_C( 108),  INT8_C(  57), -INT8_C(   2),
+         INT8_C(  64),  INT8_C(   0), -INT8_C( 116),  INT8_C(   1),  INT8_C(   1),  INT8_C(  44),  INT8_C( 124),  INT8_C(   1),
+         INT8_C(  51),  INT8_C(   1), -INT8_C(   9),  INT8_C( 118), -INT8_C( 121), -INT8_C( 124), -INT8_C(   1), -INT8_C( 117),
+         INT8_C(   1), -INT8_C(   1),  INT8_C(  52), -INT8_C(   3),  INT8_C(   0), -INT8_C(  57),  INT8_C(   0), -INT8_C( 123),
+         INT8_C(  96), -INT8_C(  80), -INT8_C(  20), -INT8_C( 100),      INT8_MAX,  INT8_C(   0), -INT8_C(  32), -INT8_C(  65),
+         INT8_C(  64), -INT8_C(  23), -INT8_C(  17),  INT8_C(  36), -INT8_C(  70), -INT8_C(  35),      INT8_MIN, -INT8_C(  58),
+         INT8_C( 115),  INT8_C(  94), -INT8_C(  34), -INT8_C(   1),  INT8_C(  52),  INT8_C(  19), -INT8_C(   1),  INT8_C(  16),
+        -INT8_C(  79), -INT8_C(  79),  INT8_C(  64),  INT8_C(  42), -INT8_C(   1), -INT8_C(  44),  INT8_C(   8),  INT8_C(   0) },
+      UINT64_C( 4203246422875275670),
+      {  INT8_C(  29),  INT8_C(  17), -INT8_C(  71), -INT8_C(  21), -INT8_C(  90),  INT8_C(   9), -INT8_C( 101),  INT8_C(  91),
+         INT8_C( 101),  INT8_C(  39), -INT8_C(  88), -INT8_C(  42), -INT8_C( 109),  INT8_C(  56), -INT8_C(  74),  INT8_C( 124),
+        -INT8_C( 103), -INT8_C( 110), -INT8_C( 115),  INT8_C(   7),      INT8_MAX,  INT8_C(  29), -INT8_C(  95),  INT8_C(  98),
+         INT8_C(  37),  INT8_C(  42),  INT8_C( 111),  INT8_C(  31), -INT8_C(  54),  INT8_C(  15),  INT8_C(  69), -INT8_C(  43),
+         INT8_C(  86),  INT8_C( 121),  INT8_C( 121),  INT8_C(  86), -INT8_C(  39),  INT8_C(  36),  INT8_C( 126),  INT8_C(  45),
+        -INT8_C(  35), -INT8_C(  12),  INT8_C(  68),  INT8_C(  34), -INT8_C(  37), -INT8_C(  70), -INT8_C( 122), -INT8_C(  80),
+         INT8_C( 118), -INT8_C(  40),  INT8_C(  41), -INT8_C(  88), -INT8_C(  25),  INT8_C(  85),  INT8_C( 111),  INT8_C( 108),
+        -INT8_C(  17), -INT8_C(  38), -INT8_C( 107), -INT8_C(  96), -INT8_C(  12),  INT8_C(  11), -INT8_C(  74),  INT8_C(  55) },
+      {  INT64_C( 9223328043470124495),  INT64_C( 7400302043962175970), -INT64_C( 3713141663367258351), -INT64_C( 6163506173661678246),
+        -INT64_C(  108126132456488961),  INT64_C(    1127008547373184),  INT64_C(    2251799813729281),  INT64_C( 4647724713198753944) },
+      { -INT8_C(  52), -INT8_C(   9), -INT8_C(  65),  INT8_C(   1),  INT8_C(  95),  INT8_C( 108),  INT8_C(  57), -INT8_C(  97),
+         INT8_C(  60),  INT8_C(   0), -INT8_C( 116),  INT8_C(   1),  INT8_C(   1),  INT8_C(  44),  INT8_C( 124),  INT8_C(  38),
+         INT8_C(  69),  INT8_C(   1), -INT8_C(   9),  INT8_C(  62), -INT8_C( 121), -INT8_C(  92), -INT8_C(  86),  INT8_C(  85),
+         INT8_C(   1), -INT8_C(  76),  INT8_C(  52), -INT8_C(   3), -INT8_C(   3), -INT8_C(  57),  INT8_C(   0), -INT8_C( 123),
+         INT8_C(  96), -INT8_C(   1), -INT8_C(  20), -INT8_C(  17),  INT8_C( 125),  INT8_C(   0), -INT8_C(   1), -INT8_C(  65),
+         INT8_C(  64),  INT8_C(   0),  INT8_C(   8),  INT8_C(  64), -INT8_C(  70),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),
+         INT8_C( 115),  INT8_C(  94),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(  19),  INT8_C(  16),  INT8_C(  16),
+        -INT8_C(  79),  INT8_C(  32),  INT8_C(  64),  INT8_C(   0),  INT8_C(   8), -INT8_C( 125),  INT8_C(   8),  INT8_C(   0) } },
+    { {  INT8_C(   0), -INT8_C(  68), -INT8_C(   1), -INT8_C( 126),  INT8_C(  28), -INT8_C( 125), -INT8_C(   1),      INT8_MIN,
+        -INT8_C(  79),  INT8_C(  16), -INT8_C(  20),  INT8_C( 107), -INT8_C(  33),  INT8_C(  17), -INT8_C( 112),  INT8_C(   0),
+         INT8_C(  66), -INT8_C( 120), -INT8_C(   1), -INT8_C(  49), -INT8_C(  29), -INT8_C(  26),  INT8_C( 120),  INT8_C( 111),
+         INT8_C(   0),  INT8_C(   8),  INT8_C( 114),  INT8_C(  68),  INT8_C(   0), -INT8_C(  16), -INT8_C( 101),  INT8_C(  12),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(  87),  INT8_C(   2), -INT8_C(  68), -INT8_C(   1),  INT8_C(  72),
+        -INT8_C(  54),  INT8_C(  47),  INT8_C(   4), -INT8_C(   1), -INT8_C(  22), -INT8_C(   2),  INT8_C(   5), -INT8_C(  71),
+        -INT8_C(  41), -INT8_C(   6), -INT8_C(  17), -INT8_C(   9),  INT8_C(   4), -INT8_C(  69),  INT8_C(  51),  INT8_C(  30),
+         INT8_C(   0), -INT8_C(   2),  INT8_C( 120), -INT8_C(  58),  INT8_C(  91),  INT8_C(   0), -INT8_C(  87), -INT8_C( 110) },
+      UINT64_C( 8300992302784220669),
+      { -INT8_C(  70), -INT8_C(  23), -INT8_C(  92), -INT8_C(  72), -INT8_C(   1), -INT8_C(   8),  INT8_C(  50),  INT8_C(  96),
+         INT8_C(  23), -INT8_C(  67),  INT8_C(  40),  INT8_C( 106), -INT8_C(  98), -INT8_C(  81), -INT8_C(  39),  INT8_C(  66),
+        -INT8_C(  45),  INT8_C(  48),  INT8_C(  84),  INT8_C(  58),  INT8_C(  55),  INT8_C(  34), -INT8_C(   7), -INT8_C(  63),
+         INT8_C(  10), -INT8_C(   2),  INT8_C(  26),  INT8_C(  52),  INT8_C(  37),  INT8_C(  20),  INT8_C(   1),  INT8_C(  44),
+         INT8_C(  12),  INT8_C( 102), -INT8_C(  75), -INT8_C(  54), -INT8_C(   8), -INT8_C(  48), -INT8_C(  27),  INT8_C(  57),
+         INT8_C(  65),  INT8_C( 119), -INT8_C(  39), -INT8_C(  98),  INT8_C( 106), -INT8_C(  35),  INT8_C(  47), -INT8_C(  40),
+         INT8_C(  36),  INT8_C(  92), -INT8_C(  96),  INT8_C(  82),  INT8_C(  33), -INT8_C(  53), -INT8_C(   3),  INT8_C(  41),
+        -INT8_C(  96), -INT8_C(  90), -INT8_C( 122), -INT8_C(  74),  INT8_C( 104), -INT8_C( 114), -INT8_C( 104), -INT8_C( 119) },
+      { -INT64_C(  656910259968405846), -INT64_C(  839912600343960133), -INT64_C( 7820609932391168413),  INT64_C(  252219216424337704),
+         INT64_C( 9081633514107388775), -INT64_C(   72057731476881441),  INT64_C( 9205195941382973367),  INT64_C( 2342612963241754704) },
+      { -INT8_C(  67), -INT8_C(  68), -INT8_C(   7), -INT8_C(  10),  INT8_C(  85), -INT8_C(  10), -INT8_C(  72), -INT8_C( 103),
+         INT8_C(  76),  INT8_C(  16),  INT8_C(   7),  INT8_C(   1), -INT8_C(  33),  INT8_C(  17), -INT8_C( 112),  INT8_C( 110),
+         INT8_C(  66), -INT8_C( 120), -INT8_C(  50), -INT8_C(  49),  INT8_C(  38),  INT8_C(  44),  INT8_C( 120),  INT8_C(  49),
+         INT8_C(   0), -INT8_C(  96),  INT8_C( 114),  INT8_C(  68),      INT8_MIN, -INT8_C(  16), -INT8_C( 108),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   4), -INT8_C(  16),  INT8_C(  87),  INT8_C(   2), -INT8_C(  68), -INT8_C(   1), -INT8_C(  65),
+        -INT8_C(  54),  INT8_C(  47), -INT8_C(   1),      INT8_MAX, -INT8_C(  22), -INT8_C(   2),  INT8_C(   5), -INT8_C(  71),
+        -INT8_C(  50), -INT8_C(   1), -INT8_C(  17), -INT8_C(   9),  INT8_C( 119), -INT8_C(   4),  INT8_C(  51),  INT8_C(  30),
+         INT8_C(  20), -INT8_C( 120),  INT8_C( 120), -INT8_C(  58), -INT8_C(  94),  INT8_C(   0),  INT8_C(  16), -INT8_C( 110) } },
+    { {  INT8_C(  28),  INT8_C(   4), -INT8_C(   3), -INT8_C(  72), -INT8_C( 104), -INT8_C(  18),  INT8_C(   0),  INT8_C(   8),
+        -INT8_C(   1),  INT8_C(  27), -INT8_C(   1), -INT8_C( 115),  INT8_C(  46), -INT8_C(  65), -INT8_C(  65), -INT8_C(  28),
+         INT8_C(   4),  INT8_C(  82), -INT8_C(  60),  INT8_C(  92),  INT8_C(   0), -INT8_C( 124),  INT8_C(  49),  INT8_C(  95),
+        -INT8_C(   9), -INT8_C(   1),  INT8_C( 100),  INT8_C(   0),  INT8_C(  44), -INT8_C( 117), -INT8_C(   9), -INT8_C( 112),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(  20), -INT8_C(  24),  INT8_C(  58),  INT8_C(   0),  INT8_C(   4),
+        -INT8_C(  15),  INT8_C(   1),  INT8_C(  63), -INT8_C(  93),  INT8_C(  64),  INT8_C(   6), -INT8_C(  68), -INT8_C(   2),
+        -INT8_C(  86), -INT8_C(  53), -INT8_C(   1), -INT8_C( 109),  INT8_C(  33),  INT8_C( 114),  INT8_C( 113),  INT8_C(  66),
+        -INT8_C( 127),  INT8_C(   0), -INT8_C(  85), -INT8_C(   1),  INT8_C(   0),  INT8_C(  19), -INT8_C(  70), -INT8_C(  18) },
+      UINT64_C(15250080164123210925),
+      {  INT8_C( 117), -INT8_C(  93),  INT8_C(  61),  INT8_C( 106),  INT8_C(  57),  INT8_C(  74),  INT8_C( 107),  INT8_C(  41),
+         INT8_C( 114), -INT8_C(  31),  INT8_C( 121),  INT8_C( 103),  INT8_C(  49), -INT8_C(  45),  INT8_C(  37), -INT8_C(  71),
+        -INT8_C(  57),  INT8_C(   9), -INT8_C(  24),  INT8_C(  94),  INT8_C(  21), -INT8_C(  52), -INT8_C( 104),  INT8_C(  99),
+         INT8_C(   7),  INT8_C(  51),  INT8_C( 123),  INT8_C(  43), -INT8_C(  95), -INT8_C(   8), -INT8_C(  34), -INT8_C(  21),
+        -INT8_C(  74),  INT8_C(  59), -INT8_C( 121),  INT8_C( 101),  INT8_C(  68),  INT8_C(  40), -INT8_C(  93),  INT8_C(  96),
+        -INT8_C( 127),  INT8_C(   7),  INT8_C(  17), -INT8_C(  63), -INT8_C( 114), -INT8_C(  65),  INT8_C( 119), -INT8_C( 109),
+        -INT8_C(  53), -INT8_C(  70),  INT8_C(  28), -INT8_C(  10), -INT8_C(  90),  INT8_C(  80),  INT8_C(  96), -INT8_C(  65),
+        -INT8_C(  93),      INT8_MAX,  INT8_C( 109),  INT8_C(  73),  INT8_C( 108),  INT8_C(  89),  INT8_C(  75),  INT8_C(   4) },
+      { -INT64_C(  720576218078904327), -INT64_C( 4554697573368581558),  INT64_C( 6013890139482756529),  INT64_C( 5439729854831703001),
+         INT64_C( 5048214957104002924), -INT64_C( 3388426164495691085), -INT64_C( 6107889880888057104),  INT64_C( 5415756903795320483) },
+      { -INT8_C(  81),  INT8_C(   4), -INT8_C(  49), -INT8_C(   1), -INT8_C( 104), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(  27),  INT8_C(  96), -INT8_C( 115),  INT8_C( 101),  INT8_C(   1), -INT8_C(  75), -INT8_C(  28),
+         INT8_C(  43),  INT8_C(  10), -INT8_C(  60), -INT8_C(  32),  INT8_C(   0), -INT8_C( 124),  INT8_C(  10),  INT8_C(  39),
+        -INT8_C(   9),  INT8_C( 111),  INT8_C( 100),  INT8_C(   0),  INT8_C(  44),  INT8_C(  75), -INT8_C(  19), -INT8_C( 112),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(  18), -INT8_C(  26),  INT8_C( 118),  INT8_C(  58),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(  89), -INT8_C(  91),  INT8_C(  63),  INT8_C(  89),  INT8_C(  64),  INT8_C( 103), -INT8_C(  68), -INT8_C(   2),
+        -INT8_C(  36),  INT8_C(  42), -INT8_C(   1), -INT8_C( 109),  INT8_C(  33),  INT8_C( 118),  INT8_C( 113), -INT8_C(  31),
+         INT8_C(  70),  INT8_C(  70), -INT8_C(  85), -INT8_C(   1), -INT8_C( 118),  INT8_C(  19), -INT8_C(  36),  INT8_C( 106) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_multishift_epi64_epi8(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int64_t b[8];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(15762842509725559814),
+      {  INT8_C(  25),  INT8_C(  58), -INT8_C(  11),  INT8_C(  74),  INT8_C(   6),  INT8_C(  50),  INT8_C( 103), -INT8_C(  69),
+             INT8_MAX, -INT8_C( 120),  INT8_C(   5), -INT8_C(  93),  INT8_C(  39), -INT8_C(  63),  INT8_C(   0),  INT8_C(  66),
+        -INT8_C(  50), -INT8_C(  61), -INT8_C(  58), -INT8_C(  12),  INT8_C(   8),  INT8_C(   8),  INT8_C(  16), -INT8_C(  96),
+        -INT8_C(  97), -INT8_C( 115),  INT8_C(  17), -INT8_C(  27),  INT8_C( 104),  INT8_C( 117), -INT8_C(  32), -INT8_C(  36),
+        -INT8_C(  22),  INT8_C(  14),  INT8_C(   9),  INT8_C(   4), -INT8_C(  64), -INT8_C(  13),  INT8_C(  31),  INT8_C(  35),
+        -INT8_C(  54), -INT8_C( 107), -INT8_C(  56), -INT8_C(  15), -INT8_C( 110),  INT8_C(  83), -INT8_C(  34),  INT8_C(  56),
+         INT8_C( 103), -INT8_C( 104),  INT8_C(  66), -INT8_C(  59),  INT8_C(  59),  INT8_C( 116), -INT8_C(  94),  INT8_C(  47),
+        -INT8_C(  38),  INT8_C( 106), -INT8_C(  46), -INT8_C(  25),  INT8_C(  57), -INT8_C(   7),  INT8_C(  64),  INT8_C( 124) },
+      { -INT64_C(  826471057954426620), -INT64_C( 6472590102140910187),  INT64_C(    3430485137096738),  INT64_C( 5744731965532444738),
+        -INT64_C( 3747040522943594497), -INT64_C(      23090818580481),  INT64_C( 8070379613743169535), -INT64_C(     176059317354530) },
+      {  INT8_C(   0),  INT8_C(  61), -INT8_C(  92),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  44), -INT8_C(  77),  INT8_C(   0), -INT8_C(  54), -INT8_C( 107),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),
+         INT8_C(   0),  INT8_C(  36),  INT8_C(   0),  INT8_C(  26),  INT8_C(  99),  INT8_C(   0),  INT8_C(  73),  INT8_C(   0),
+        -INT8_C(  11), -INT8_C(  49), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),      INT8_MAX,  INT8_C(   0), -INT8_C(  49),
+             INT8_MAX,  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   3),  INT8_C(   0), -INT8_C(   2), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  33), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(  41),  INT8_C(   0), -INT8_C(  65),      INT8_MAX,  INT8_C(   0), -INT8_C(  34), -INT8_C(  17) } },
+    { UINT64_C( 7706553086577318444),
+      {  INT8_C( 115),  INT8_C(  86),  INT8_C(  76),  INT8_C(  56),  INT8_C( 117), -INT8_C(  67),  INT8_C(  80), -INT8_C(  25),
+        -INT8_C(   1),  INT8_C(  11),  INT8_C(  20),  INT8_C(  76), -INT8_C( 108),  INT8_C(  58),  INT8_C( 113),  INT8_C(  90),
+         INT8_C(  64),  INT8_C(   7),  INT8_C(  88),  INT8_C(   3),  INT8_C( 108), -INT8_C(  42), -INT8_C(  68),  INT8_C(  32),
+         INT8_C(  50), -INT8_C( 111), -INT8_C(  60), -INT8_C(  86),  INT8_C(   5), -INT8_C(  28),  INT8_C( 112), -INT8_C( 100),
+        -INT8_C(  64),  INT8_C(  72),  INT8_C( 110), -INT8_C(  35),  INT8_C(  35),  INT8_C(  37), -INT8_C(  57),  INT8_C(  73),
+        -INT8_C(  91), -INT8_C(  68),  INT8_C(   7), -INT8_C(  24), -INT8_C(  23), -INT8_C(  38),  INT8_C(  12), -INT8_C(  78),
+        -INT8_C( 113), -INT8_C(  48), -INT8_C(   3), -INT8_C(  67), -INT8_C(  34), -INT8_C(  31),  INT8_C(  77),  INT8_C(  69),
+        -INT8_C(  90), -INT8_C(  84), -INT8_C(  70),  INT8_C(  24),  INT8_C(  71),  INT8_C(  58),  INT8_C(  10),  INT8_C( 120) },
+      { -INT64_C( 2306968943547416577), -INT64_C(    2341139429720069),  INT64_C(  324259173709647912), -INT64_C(  162129591148807169),
+         INT64_C( 7980308093099573234),  INT64_C( 1164772490303216419), -INT64_C( 4185809517246781833),  INT64_C(  582371735539027968) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   9), -INT8_C(  33),  INT8_C(   0), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),      INT8_MAX,  INT8_C(   0), -INT8_C(  65), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0), -INT8_C(  65),
+         INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  18),
+        -INT8_C(  14), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   3), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  45),  INT8_C(   0),  INT8_C(  54),  INT8_C(  26),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  28),  INT8_C(  14),  INT8_C(   0),  INT8_C(   0), -INT8_C(  81),  INT8_C(  53),  INT8_C( 115),  INT8_C(  51),
+         INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0) } },
+    { UINT64_C( 7935760353252928283),
+      {  INT8_C(  17),  INT8_C(  93),  INT8_C(  49), -INT8_C(  23), -INT8_C(  21),  INT8_C(  95), -INT8_C(  34),  INT8_C(  72),
+        -INT8_C(  47), -INT8_C(  44), -INT8_C(  13),  INT8_C(  78),  INT8_C(  57), -INT8_C(  80),  INT8_C( 107),  INT8_C(  14),
+        -INT8_C( 120),  INT8_C(  80), -INT8_C(  50), -INT8_C(  55),  INT8_C(   7), -INT8_C(  28), -INT8_C(  80), -INT8_C(  86),
+         INT8_C(  73),  INT8_C(  62),  INT8_C( 121),  INT8_C(  79),  INT8_C(   8),  INT8_C(  33),  INT8_C(  81), -INT8_C(  19),
+        -INT8_C( 100), -INT8_C(   7), -INT8_C(  76), -INT8_C(  54), -INT8_C(  75), -INT8_C(  50),  INT8_C(  46), -INT8_C(   8),
+         INT8_C(  27), -INT8_C(  73),  INT8_C(  74),  INT8_C(   3), -INT8_C( 122),  INT8_C( 106), -INT8_C(  26), -INT8_C(  69),
+        -INT8_C(  43), -INT8_C(  52),  INT8_C(  34),  INT8_C(  62),  INT8_C(  45),  INT8_C(  22), -INT8_C(  68), -INT8_C(  60),
+        -INT8_C(  17),  INT8_C( 109),  INT8_C(  67),  INT8_C(  74),  INT8_C(  21), -INT8_C( 119), -INT8_C(  14), -INT8_C( 114) },
+      {  INT64_C(  455829993115230425),  INT64_C( 1661823410205626452), -INT64_C(   38994764011408385),  INT64_C(  576488274453889154),
+        -INT64_C(  497840531793176475), -INT64_C( 3787426050445338546),  INT64_C( 7050957701144941115), -INT64_C( 4253420887639418399) },
+      { -INT8_C(  51), -INT8_C(  75),  INT8_C(   0), -INT8_C(  73),  INT8_C( 109),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  94), -INT8_C(  53),  INT8_C(   0), -INT8_C(  16),  INT8_C(   0),  INT8_C(  15), -INT8_C(   1), -INT8_C(  16),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 117),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   4), -INT8_C( 111),  INT8_C(  70), -INT8_C(  56), -INT8_C(  76),  INT8_C(  93), -INT8_C(   7),
+         INT8_C(  92), -INT8_C( 106),  INT8_C(   0),  INT8_C(   9),  INT8_C(  97),  INT8_C(  23),  INT8_C( 112),  INT8_C(   0),
+         INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  58),  INT8_C(  60), -INT8_C(  90),  INT8_C(   0),  INT8_C(  76),  INT8_C(  62),  INT8_C(   0) } },
+    { UINT64_C( 9312984925527353276),
+      {  INT8_C(  16), -INT8_C(  91),  INT8_C(  19),  INT8_C(  72), -INT8_C( 123), -INT8_C( 107), -INT8_C(  35),  INT8_C(  16),
+         INT8_C( 103),  INT8_C(  80),  INT8_C(  20),  INT8_C(  95), -INT8_C( 121), -INT8_C(  18), -INT8_C( 126), -INT8_C(  55),
+        -INT8_C(  86), -INT8_C(  16), -INT8_C(  36),  INT8_C(  65),  INT8_C(  53),  INT8_C( 106),  INT8_C(  61),  INT8_C( 102),
+        -INT8_C(  26),  INT8_C(  83),  INT8_C(  81), -INT8_C( 106),  INT8_C( 121),  INT8_C(  58),  INT8_C( 110), -INT8_C(  40),
+        -INT8_C( 123), -INT8_C(   2), -INT8_C(  77), -INT8_C(  95),  INT8_C(  30),  INT8_C(  14),  INT8_C(   5),  INT8_C(  56),
+         INT8_C(  98), -INT8_C(  21), -INT8_C(  12),  INT8_C(  42), -INT8_C(  69), -INT8_C(  33),  INT8_C(  26), -INT8_C(  38),
+        -INT8_C(  98),  INT8_C(  47),  INT8_C(  84),  INT8_C(  33),  INT8_C(  13),  INT8_C(  26),  INT8_C(  91), -INT8_C(  71),
+        -INT8_C(  94),  INT8_C( 120), -INT8_C(  85), -INT8_C(  36), -INT8_C(  12), -INT8_C(  35), -INT8_C( 104),  INT8_C(  10) },
+      { -INT64_C( 3515117537989968376), -INT64_C( 1153211775693359617), -INT64_C(  144123986350048257),  INT64_C( 8100911809095703239),
+        -INT64_C(   11267831740235777),  INT64_C( 1236798722967491623), -INT64_C(   36028797018964227), -INT64_C( 2234034041847856706) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C( 117), -INT8_C(  66), -INT8_C(  16), -INT8_C(  30),  INT8_C(   0),  INT8_C(  92),
+        -INT8_C(  17), -INT8_C(   1), -INT8_C(  17),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0), -INT8_C(  33),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  11), -INT8_C(  57),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(  35), -INT8_C(  17), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  63),  INT8_C(  18),      INT8_MAX, -INT8_C(  30),  INT8_C(   0), -INT8_C(  81),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  48) } },
+    { UINT64_C(10942251488232701880),
+      {  INT8_C(  62), -INT8_C(  26),  INT8_C(  58), -INT8_C(  73), -INT8_C(  40), -INT8_C(  21),  INT8_C(  14),  INT8_C(  55),
+        -INT8_C(  54), -INT8_C(   9), -INT8_C(  35),  INT8_C(  60), -INT8_C( 124), -INT8_C(  92), -INT8_C(  58), -INT8_C(  50),
+        -INT8_C(  42),  INT8_C(  59), -INT8_C(  28), -INT8_C(   8), -INT8_C(  87), -INT8_C(  64), -INT8_C(  17), -INT8_C( 126),
+         INT8_C(  29),  INT8_C( 108), -INT8_C(  57),  INT8_C(  52),  INT8_C( 101),  INT8_C( 101), -INT8_C(  31),  INT8_C( 101),
+        -INT8_C(  19),  INT8_C(  68),  INT8_C(  37), -INT8_C(  88), -INT8_C(  88), -INT8_C(  22),  INT8_C( 120), -INT8_C(  43),
+        -INT8_C(  40),  INT8_C(  44), -INT8_C(  82), -INT8_C(  90), -INT8_C(  76), -INT8_C( 103),  INT8_C(  61),  INT8_C(  50),
+        -INT8_C( 124), -INT8_C(  13), -INT8_C(  52),  INT8_C(  84),  INT8_C(  36), -INT8_C(  55),  INT8_C( 123),  INT8_C( 102),
+        -INT8_C(  53), -INT8_C(  93),  INT8_C(  65),  INT8_C(  99), -INT8_C( 124), -INT8_C(  89),  INT8_C(  41),  INT8_C(  74) },
+      {  INT64_C(  254393187693798364), -INT64_C( 4919070163158040833), -INT64_C( 7303483748449597580),  INT64_C( 9218498176686751719),
+        -INT64_C(    2885258098411529),  INT64_C( 4646142483738690040),  INT64_C( 7625962269770474122),  INT64_C(  577032774839451650) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7), -INT8_C(  95), -INT8_C(   7),  INT8_C(   0),  INT8_C(   7),
+             INT8_MAX,  INT8_C( 119), -INT8_C(   3), -INT8_C(   5), -INT8_C(  17),  INT8_C(  59), -INT8_C(   5),  INT8_C(   0),
+        -INT8_C(  69),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102),  INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(  22), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  83),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(  90), -INT8_C(  23), -INT8_C(  89),  INT8_C(   0),      INT8_MAX,  INT8_C(   0),  INT8_C(  30),
+         INT8_C(   0),  INT8_C(  58),  INT8_C(   0),  INT8_C(   3), -INT8_C(  60),  INT8_C(   0),  INT8_C(  77),  INT8_C( 113),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16) } },
+    { UINT64_C( 1365308458141566907),
+      {  INT8_C(  39), -INT8_C(  94),  INT8_C(  90), -INT8_C(  16),  INT8_C(  16),  INT8_C( 103),  INT8_C(  30), -INT8_C(  36),
+        -INT8_C(  16), -INT8_C(  98),  INT8_C(  23), -INT8_C(  35),  INT8_C(  71),  INT8_C(  35),  INT8_C(  11),  INT8_C( 113),
+        -INT8_C( 126),  INT8_C(   2), -INT8_C(   4),  INT8_C(  94),  INT8_C( 107),  INT8_C( 124),  INT8_C( 118), -INT8_C(  29),
+        -INT8_C( 125), -INT8_C(  44),  INT8_C(  43),  INT8_C( 125),  INT8_C(  50), -INT8_C(  72),  INT8_C(  58), -INT8_C(  57),
+        -INT8_C(  90),  INT8_C(  64), -INT8_C(  19), -INT8_C(  47), -INT8_C(  87), -INT8_C(  14),  INT8_C(  54), -INT8_C(  30),
+         INT8_C(  21),  INT8_C(  71), -INT8_C( 102),  INT8_C(  62), -INT8_C( 123), -INT8_C(  40), -INT8_C(  38),  INT8_C(  39),
+        -INT8_C(  10),  INT8_C( 110),  INT8_C(  36), -INT8_C(  98), -INT8_C(  62), -INT8_C(  22),  INT8_C(  63),  INT8_C(   8),
+         INT8_C(  94), -INT8_C(  44), -INT8_C(  30),  INT8_C(  71),  INT8_C(  34), -INT8_C( 126), -INT8_C(  24),  INT8_C(  40) },
+      { -INT64_C( 8755622075556239289), -INT64_C(  145241158052773890),  INT64_C( 6499755043627173549),  INT64_C( 8070375765454356447),
+        -INT64_C( 8213183039951318933), -INT64_C( 6478338297854462304), -INT64_C(  288239174794870802), -INT64_C(    2533834278043913) },
+      { -INT8_C( 112),  INT8_C(   7),  INT8_C(   0),  INT8_C( 125), -INT8_C(  26), -INT8_C( 112),  INT8_C(   0), -INT8_C(  56),
+        -INT8_C(   5), -INT8_C(  66),  INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  17),  INT8_C(   0),
+        -INT8_C(  85),  INT8_C(   0), -INT8_C(  43),  INT8_C(  25),  INT8_C( 120),  INT8_C(   0),  INT8_C( 104),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  90),  INT8_C( 107),  INT8_C(  39),  INT8_C(  56),  INT8_C(   0),  INT8_C(   0),  INT8_C(  56),  INT8_C(  98),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  19), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  93),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5), -INT8_C(   3), -INT8_C(  35), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(  66),  INT8_C(   0),  INT8_C(   0), -INT8_C(  33),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 3786366586484144369),
+      {  INT8_C( 107), -INT8_C(  80), -INT8_C(   6), -INT8_C(  52),  INT8_C(  83), -INT8_C(  13), -INT8_C(  55), -INT8_C(  84),
+         INT8_C(  32), -INT8_C(  81),  INT8_C(  23),  INT8_C( 109),  INT8_C(  97), -INT8_C( 114), -INT8_C(  94),  INT8_C(  24),
+         INT8_C(  29),  INT8_C(  21), -INT8_C(  76),  INT8_C(   1), -INT8_C( 111),  INT8_C(  92), -INT8_C(  34), -INT8_C(  58),
+        -INT8_C( 115),  INT8_C(  52),  INT8_C(  62), -INT8_C( 111),  INT8_C(  30), -INT8_C(  69),  INT8_C( 115), -INT8_C(  19),
+         INT8_C(  82),  INT8_C(  41), -INT8_C(  60), -INT8_C( 119), -INT8_C(  79), -INT8_C(   3),  INT8_C(  73), -INT8_C(  41),
+        -INT8_C(  13),  INT8_C(  30),  INT8_C(  48), -INT8_C(  49),  INT8_C(  47), -INT8_C(  62),  INT8_C(  77),  INT8_C(  41),
+        -INT8_C(  62),  INT8_C(  26), -INT8_C(  26), -INT8_C( 115),  INT8_C(   5), -INT8_C( 119), -INT8_C(  55),  INT8_C(  33),
+        -INT8_C(  70), -INT8_C(  83), -INT8_C(  17),  INT8_C(  60), -INT8_C(  74), -INT8_C(  77),  INT8_C(  84), -INT8_C(   2) },
+      { -INT64_C( 3664106398161764404), -INT64_C( 9222246063933456313), -INT64_C( 8176987692823049547),  INT64_C( 4332078540969499474),
+         INT64_C( 8454597746219771202), -INT64_C( 3102533774944046578), -INT64_C( 9043815864554545089), -INT64_C( 7845547290674867663) },
+      { -INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  54), -INT8_C(  92),      INT8_MAX,  INT8_C( 103),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   8),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  34), -INT8_C(  92),  INT8_C(   0),  INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C(  17),  INT8_C(  42),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20),  INT8_C(  71), -INT8_C( 125),  INT8_C(   0),
+        -INT8_C( 113),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78), -INT8_C(  86),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 125),  INT8_C( 119), -INT8_C(  54),
+         INT8_C(  15), -INT8_C(  54),  INT8_C(   0),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  62),  INT8_C(   0),  INT8_C(  76),  INT8_C(  99),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 9384879645284961923),
+      { -INT8_C(  38),  INT8_C(  99), -INT8_C(  79), -INT8_C(  29),  INT8_C(  49),  INT8_C( 119),  INT8_C(  96), -INT8_C(  76),
+        -INT8_C(  51), -INT8_C(  46),  INT8_C(  76),  INT8_C( 104),  INT8_C( 114), -INT8_C( 119), -INT8_C(  60),  INT8_C(  16),
+        -INT8_C(  88),  INT8_C(  70), -INT8_C( 127), -INT8_C(  28),  INT8_C(  98), -INT8_C(  33), -INT8_C(  53), -INT8_C( 102),
+         INT8_C(   0), -INT8_C(  50), -INT8_C(  90),  INT8_C(  79), -INT8_C(  62), -INT8_C(  56),  INT8_C(   5), -INT8_C(  52),
+         INT8_C(  23), -INT8_C( 127), -INT8_C(  50), -INT8_C(  20),  INT8_C(  28),  INT8_C(  89), -INT8_C(  79),  INT8_C(  44),
+         INT8_C(  37),  INT8_C(  95),  INT8_C( 103), -INT8_C( 103), -INT8_C(  20),  INT8_C(  58), -INT8_C(  74), -INT8_C(  59),
+        -INT8_C(   5),  INT8_C(  44), -INT8_C( 109),  INT8_C(  98),  INT8_C( 102),  INT8_C(  74),  INT8_C(   0), -INT8_C(  39),
+        -INT8_C(  29),  INT8_C( 112),  INT8_C(  74), -INT8_C(  25),  INT8_C(  17), -INT8_C( 104), -INT8_C(  85),  INT8_C(  61) },
+      { -INT64_C( 8065600413778853020),  INT64_C( 2481839605367134634), -INT64_C( 2434648587935532731),  INT64_C( 4030457880272090739),
+        -INT64_C(    1213869675520561), -INT64_C( 6148580706063396828), -INT64_C( 7051013886040876384), -INT64_C( 4611967596483313705) },
+      {  INT8_C(  13),  INT8_C( 101),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   0), -INT8_C(  39),  INT8_C( 117),  INT8_C(  67),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 115),  INT8_C(   0),  INT8_C(  64), -INT8_C( 107),  INT8_C(   0), -INT8_C(  74), -INT8_C(  77),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  33),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  39),  INT8_C(   0),  INT8_C(  83),  INT8_C(   0),  INT8_C(   0), -INT8_C(  86), -INT8_C( 127),
+         INT8_C(  19),  INT8_C(   0),  INT8_C(   5),  INT8_C(  14),  INT8_C(  16), -INT8_C(  10),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  67) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_multishift_epi64_epi8(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_multishift_epi64_epi8)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
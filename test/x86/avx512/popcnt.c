@@ -0,0 +1,2544 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN popcnt
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/popcnt.h>
+
+static int
+test_simde_mm_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(   0), -INT8_C(  65), -INT8_C(   1), -INT8_C(  69), -INT8_C(   1),  INT8_C(  32),  INT8_C(  68), -INT8_C(  33),
+        -INT8_C(  45), -INT8_C(  66), -INT8_C(  13), -INT8_C(  21), -INT8_C(  39), -INT8_C(   3), -INT8_C(  85), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   7),  INT8_C(   8),  INT8_C(   6),  INT8_C(   8),  INT8_C(   1),  INT8_C(   2),  INT8_C(   7),
+         INT8_C(   5),  INT8_C(   6),  INT8_C(   6),  INT8_C(   6),  INT8_C(   5),  INT8_C(   7),  INT8_C(   5),  INT8_C(   8) } },
+    { {  INT8_C(  99),  INT8_C(  40),  INT8_C(  32), -INT8_C(  93),  INT8_C(  40), -INT8_C(  68), -INT8_C(  30),  INT8_C(  51),
+        -INT8_C( 123), -INT8_C(   2), -INT8_C(   1), -INT8_C( 112),  INT8_C(  16),  INT8_C(  46),  INT8_C(  49), -INT8_C(  17) },
+      {  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   7),  INT8_C(   8),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   3),  INT8_C(   7) } },
+    { { -INT8_C(   2), -INT8_C(   1),  INT8_C( 109), -INT8_C(   3),  INT8_C(  65),  INT8_C(   0),  INT8_C(   6), -INT8_C(   1),
+         INT8_C(  85),  INT8_C(   2), -INT8_C(   3),  INT8_C(   0), -INT8_C(  33),  INT8_C(  74),  INT8_C(   0),  INT8_C( 125) },
+      {  INT8_C(   7),  INT8_C(   8),  INT8_C(   5),  INT8_C(   7),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   8),
+         INT8_C(   4),  INT8_C(   1),  INT8_C(   7),  INT8_C(   0),  INT8_C(   7),  INT8_C(   3),  INT8_C(   0),  INT8_C(   6) } },
+    { { -INT8_C( 120),  INT8_C(  76), -INT8_C(   1),  INT8_C(  22),  INT8_C(  13),  INT8_C(   2),  INT8_C(   4),  INT8_C(  69),
+         INT8_C(  41), -INT8_C(  21),  INT8_C(   8), -INT8_C(   1),  INT8_C( 120),  INT8_C(  68), -INT8_C(   1),  INT8_C(   0) },
+      {  INT8_C(   2),  INT8_C(   3),  INT8_C(   8),  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   6),  INT8_C(   1),  INT8_C(   8),  INT8_C(   4),  INT8_C(   2),  INT8_C(   8),  INT8_C(   0) } },
+    { {  INT8_C(  52),  INT8_C(   6), -INT8_C( 124), -INT8_C(  34), -INT8_C(  65), -INT8_C(  19),  INT8_C(  57),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  89), -INT8_C(  97),  INT8_C(  60),  INT8_C(   8), -INT8_C(   1), -INT8_C(  44) },
+      {  INT8_C(   3),  INT8_C(   2),  INT8_C(   2),  INT8_C(   6),  INT8_C(   7),  INT8_C(   6),  INT8_C(   4),  INT8_C(   2),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   6),  INT8_C(   4),  INT8_C(   1),  INT8_C(   8),  INT8_C(   4) } },
+    { { -INT8_C(  48),  INT8_C(  48),  INT8_C( 105), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0), -INT8_C(  41), -INT8_C(  17),
+         INT8_C(   2), -INT8_C(   7),  INT8_C(   4), -INT8_C(   3), -INT8_C(  96), -INT8_C(   3),  INT8_C(  32),  INT8_C(  10) },
+      {  INT8_C(   3),  INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   7),
+         INT8_C(   1),  INT8_C(   6),  INT8_C(   1),  INT8_C(   7),  INT8_C(   2),  INT8_C(   7),  INT8_C(   1),  INT8_C(   2) } },
+    { {  INT8_C( 113),  INT8_C(   0),  INT8_C(  35),  INT8_C(  59),  INT8_C(  84),  INT8_C(  31),  INT8_C(  32),  INT8_C(   0),
+         INT8_C( 114),  INT8_C(  35),  INT8_C(   1),      INT8_MAX,  INT8_C(   4),  INT8_C(  92), -INT8_C(  64), -INT8_C(  65) },
+      {  INT8_C(   4),  INT8_C(   0),  INT8_C(   3),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(   1),  INT8_C(   7),  INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   7) } },
+    { {  INT8_C(   0),  INT8_C(  40),  INT8_C(  68),  INT8_C(  10),  INT8_C(  48),  INT8_C( 102), -INT8_C(  11), -INT8_C(  63),
+         INT8_C(  14),  INT8_C( 103), -INT8_C(   3), -INT8_C(   3), -INT8_C(  69),  INT8_C(   0),  INT8_C( 102), -INT8_C(   3) },
+      {  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   4),  INT8_C(   6),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   5),  INT8_C(   7),  INT8_C(   7),  INT8_C(   6),  INT8_C(   0),  INT8_C(   4),  INT8_C(   7) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi8(a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  60), -INT8_C(   1), -INT8_C(  11), -INT8_C(  33), -INT8_C( 120),  INT8_C( 125),  INT8_C(   4),  INT8_C(  69),
+         INT8_C(   0),  INT8_C( 113),  INT8_C(   0),  INT8_C(  12), -INT8_C( 126), -INT8_C(   1), -INT8_C( 109),  INT8_C(   2) },
+      UINT16_C( 1183),
+      {  INT8_C(   0),  INT8_C(  16),  INT8_C(   2), -INT8_C(   5),  INT8_C(   1), -INT8_C(   1), -INT8_C(  83),  INT8_C(  36),
+        -INT8_C(  96), -INT8_C(   9), -INT8_C(  11),  INT8_C(   0), -INT8_C(   1), -INT8_C(  49), -INT8_C(  59), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   7),  INT8_C(   1),  INT8_C( 125),  INT8_C(   4),  INT8_C(   2),
+         INT8_C(   0),  INT8_C( 113),  INT8_C(   6),  INT8_C(  12), -INT8_C( 126), -INT8_C(   1), -INT8_C( 109),  INT8_C(   2) } },
+    { { -INT8_C( 100),  INT8_C(  53), -INT8_C( 112),  INT8_C(   2), -INT8_C(  14),  INT8_C(   5), -INT8_C(  33), -INT8_C(  66),
+         INT8_C(   0),  INT8_C(  34),  INT8_C(  12),  INT8_C(  39), -INT8_C(  35),  INT8_C(  63), -INT8_C(  35),  INT8_C(  52) },
+      UINT16_C( 1506),
+      { -INT8_C( 115),  INT8_C(  20), -INT8_C(  61), -INT8_C(  37),  INT8_C(  16),  INT8_C(  39),  INT8_C(   2), -INT8_C( 107),
+        -INT8_C(  81),  INT8_C(  73), -INT8_C(  48),      INT8_MAX,  INT8_C(  77),  INT8_C(   2), -INT8_C(   2),  INT8_C(   0) },
+      { -INT8_C( 100),  INT8_C(   2), -INT8_C( 112),  INT8_C(   2), -INT8_C(  14),  INT8_C(   4),  INT8_C(   1),  INT8_C(   4),
+         INT8_C(   6),  INT8_C(  34),  INT8_C(   3),  INT8_C(  39), -INT8_C(  35),  INT8_C(  63), -INT8_C(  35),  INT8_C(  52) } },
+    { {  INT8_C(   1),  INT8_C(   0),  INT8_C(  63), -INT8_C(  41),  INT8_C(   0),  INT8_C( 119),  INT8_C(  99),  INT8_C(  19),
+        -INT8_C( 111), -INT8_C( 126), -INT8_C(  53),  INT8_C( 122),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 108) },
+      UINT16_C(57884),
+      {  INT8_C(   0),  INT8_C(   8), -INT8_C(  53), -INT8_C(  41),  INT8_C(   2),  INT8_C(  32), -INT8_C(   8), -INT8_C( 120),
+         INT8_C( 123),  INT8_C( 113),  INT8_C(  80),  INT8_C(  16),  INT8_C(  72), -INT8_C(   1), -INT8_C(  28),  INT8_C(  63) },
+      {  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   6),  INT8_C(   1),  INT8_C( 119),  INT8_C(  99),  INT8_C(  19),
+        -INT8_C( 111),  INT8_C(   4), -INT8_C(  53),  INT8_C( 122),  INT8_C(   0),  INT8_C(   8),  INT8_C(   4),  INT8_C(   6) } },
+    { { -INT8_C(  46), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(  24), -INT8_C(  36),  INT8_C(   7),  INT8_C(  22),
+        -INT8_C(   9),  INT8_C(  89),  INT8_C(  25),  INT8_C(  66), -INT8_C(   1),  INT8_C(   0),  INT8_C(   8), -INT8_C(   2) },
+      UINT16_C(49776),
+      { -INT8_C(  66), -INT8_C(  15), -INT8_C(  65), -INT8_C(  48),  INT8_C(  16), -INT8_C( 127),  INT8_C( 104), -INT8_C(  84),
+        -INT8_C(   9),  INT8_C( 114),  INT8_C(   1), -INT8_C(  45), -INT8_C(   1), -INT8_C(   9), -INT8_C(   1), -INT8_C(  34) },
+      { -INT8_C(  46), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   3),  INT8_C(  22),
+        -INT8_C(   9),  INT8_C(   4),  INT8_C(  25),  INT8_C(  66), -INT8_C(   1),  INT8_C(   0),  INT8_C(   8),  INT8_C(   6) } },
+    { {  INT8_C(  96), -INT8_C(   1),  INT8_C(  21), -INT8_C(  47),  INT8_C(  88), -INT8_C(  99), -INT8_C(   9),  INT8_C(  64),
+         INT8_C(   0), -INT8_C(  33),  INT8_C(  19),  INT8_C(  20),  INT8_C(  12), -INT8_C(   1),  INT8_C(  32),  INT8_C(  27) },
+      UINT16_C(63051),
+      { -INT8_C(   9),  INT8_C(  10),  INT8_C(   4), -INT8_C(  44),  INT8_C(  66),      INT8_MIN,  INT8_C(  65), -INT8_C(   1),
+         INT8_C(   1), -INT8_C(  69),  INT8_C(  43),      INT8_MAX, -INT8_C(  33), -INT8_C( 121), -INT8_C(  69), -INT8_C(  37) },
+      {  INT8_C(   7),  INT8_C(   2),  INT8_C(  21),  INT8_C(   4),  INT8_C(  88), -INT8_C(  99),  INT8_C(   2),  INT8_C(  64),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   4),  INT8_C(  20),  INT8_C(   7),  INT8_C(   4),  INT8_C(   6),  INT8_C(   6) } },
+    { {  INT8_C(  45),  INT8_C(   0), -INT8_C(   1), -INT8_C(  12), -INT8_C(  84),  INT8_C(  11),  INT8_C(  12),  INT8_C(   0),
+         INT8_C(  25), -INT8_C(  91),  INT8_C(  64), -INT8_C(  18),  INT8_C(   0), -INT8_C(  27),  INT8_C(  44),  INT8_C(  98) },
+      UINT16_C(16631),
+      { -INT8_C(  21), -INT8_C(  33),      INT8_MIN, -INT8_C(  11),  INT8_C(  25),  INT8_C(  99), -INT8_C(  23),  INT8_C(  64),
+        -INT8_C( 123),  INT8_C(  63),  INT8_C(   1),  INT8_C(   0), -INT8_C(   9),  INT8_C(  91), -INT8_C(   1),  INT8_C(  83) },
+      {  INT8_C(   6),  INT8_C(   7),  INT8_C(   1), -INT8_C(  12),  INT8_C(   3),  INT8_C(   4),  INT8_C(   5),  INT8_C(   1),
+         INT8_C(  25), -INT8_C(  91),  INT8_C(  64), -INT8_C(  18),  INT8_C(   0), -INT8_C(  27),  INT8_C(   8),  INT8_C(  98) } },
+    { {  INT8_C(   5), -INT8_C(  75), -INT8_C(   1),  INT8_C(  12), -INT8_C(  80), -INT8_C(   1),  INT8_C(  40), -INT8_C( 109),
+        -INT8_C(  75), -INT8_C(  66),  INT8_C(   8), -INT8_C(   1), -INT8_C(   9),  INT8_C(  52),  INT8_C(  15), -INT8_C(   9) },
+      UINT16_C(41858),
+      {  INT8_C( 107), -INT8_C( 120),  INT8_C(  43), -INT8_C(   1),  INT8_C(  61),  INT8_C(  38),      INT8_MAX, -INT8_C(  52),
+             INT8_MIN, -INT8_C(  14), -INT8_C( 125),  INT8_C(   0), -INT8_C( 106),      INT8_MIN,  INT8_C(  99), -INT8_C(  37) },
+      {  INT8_C(   5),  INT8_C(   2), -INT8_C(   1),  INT8_C(  12), -INT8_C(  80), -INT8_C(   1),  INT8_C(  40),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   5),  INT8_C(   8), -INT8_C(   1), -INT8_C(   9),  INT8_C(   1),  INT8_C(  15),  INT8_C(   6) } },
+    { { -INT8_C(  33),  INT8_C(  11),  INT8_C(  32),  INT8_C( 101),  INT8_C(  31), -INT8_C( 118), -INT8_C(   1),  INT8_C(  10),
+        -INT8_C(  13),  INT8_C(   1), -INT8_C(   9),  INT8_C(  54), -INT8_C(   1), -INT8_C(  43),  INT8_C(  51),  INT8_C(  66) },
+      UINT16_C(29275),
+      { -INT8_C( 126),  INT8_C(   8), -INT8_C(  91),  INT8_C( 115), -INT8_C(   9), -INT8_C(  29), -INT8_C(  25),      INT8_MAX,
+        -INT8_C( 120),  INT8_C( 119),  INT8_C(  68), -INT8_C(  19), -INT8_C( 112),      INT8_MIN,  INT8_C(  11),  INT8_C(  24) },
+      {  INT8_C(   2),  INT8_C(   1),  INT8_C(  32),  INT8_C(   5),  INT8_C(   7), -INT8_C( 118),  INT8_C(   6),  INT8_C(  10),
+        -INT8_C(  13),  INT8_C(   6), -INT8_C(   9),  INT8_C(  54),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(  66) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(31591),
+      {  INT8_C(   0),  INT8_C(  20), -INT8_C(  65),  INT8_C(   0), -INT8_C( 124),  INT8_C(   8), -INT8_C(   1),  INT8_C(  36),
+        -INT8_C(  83),      INT8_MIN, -INT8_C(  96),  INT8_C(  86), -INT8_C(  33),  INT8_C(  41),  INT8_C(  64), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   2),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(   7),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0) } },
+    { UINT16_C(49147),
+      { -INT8_C(  76),  INT8_C(  59), -INT8_C( 126),  INT8_C(   0), -INT8_C(  97), -INT8_C(   2), -INT8_C(   6),  INT8_C(   0),
+        -INT8_C(  67),  INT8_C(   2), -INT8_C(   1),  INT8_C(   1), -INT8_C( 105),  INT8_C(  37),  INT8_C(  97),  INT8_C(  77) },
+      {  INT8_C(   4),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   7),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(   1),  INT8_C(   8),  INT8_C(   1),  INT8_C(   5),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4) } },
+    { UINT16_C(40106),
+      { -INT8_C(   1), -INT8_C(  17),  INT8_C(  72),  INT8_C(   0), -INT8_C(  33), -INT8_C(   9), -INT8_C(  61), -INT8_C( 125),
+         INT8_C(  39), -INT8_C( 126), -INT8_C(   1),  INT8_C(   0),  INT8_C(  32), -INT8_C( 107),  INT8_C(  96), -INT8_C( 126) },
+      {  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2) } },
+    { UINT16_C(22494),
+      { -INT8_C(   1),  INT8_C(  89),  INT8_C(  32),  INT8_C(   0), -INT8_C( 103), -INT8_C( 121),      INT8_MAX, -INT8_C(  34),
+         INT8_C(   0), -INT8_C(  69),  INT8_C(   0),  INT8_C(  16),  INT8_C(   5), -INT8_C(   1), -INT8_C(   6), -INT8_C(  33) },
+      {  INT8_C(   0),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   7),  INT8_C(   6),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0) } },
+    { UINT16_C(20363),
+      { -INT8_C(   1),  INT8_C(  16), -INT8_C(   1), -INT8_C(   1),  INT8_C(   4),  INT8_C( 103), -INT8_C(  10), -INT8_C(   1),
+             INT8_MIN,  INT8_C(  66), -INT8_C(  35), -INT8_C(  18),  INT8_C( 122), -INT8_C(  45),  INT8_C(   0), -INT8_C(  35) },
+      {  INT8_C(   8),  INT8_C(   1),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   1),  INT8_C(   2),  INT8_C(   6),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(62165),
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C( 103), -INT8_C(  33), -INT8_C(  38),  INT8_C(  71),  INT8_C(  64),  INT8_C(  49),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(  91),  INT8_C(  34), -INT8_C(   3),  INT8_C(  83),  INT8_C(  71), -INT8_C(  81) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6) } },
+    { UINT16_C(27222),
+      {  INT8_C( 102), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(  64),  INT8_C( 122), -INT8_C(  83), -INT8_C(   5),
+         INT8_C(  16),  INT8_C(   0), -INT8_C(  23),  INT8_C(  25), -INT8_C(  25),  INT8_C(   4),  INT8_C(  45),  INT8_C(  85) },
+      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   4),  INT8_C(   0) } },
+    { UINT16_C(19351),
+      {  INT8_C(  20), -INT8_C( 111),  INT8_C(  98), -INT8_C(   1), -INT8_C(  46), -INT8_C(  65), -INT8_C(  91), -INT8_C(  13),
+        -INT8_C(  84), -INT8_C(  65),  INT8_C(  83), -INT8_C(   1), -INT8_C(   8), -INT8_C(  64), -INT8_C(   1),  INT8_C(   0) },
+      {  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),
+         INT8_C(   4),  INT8_C(   7),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C(     0), -INT16_C( 10881),  INT16_C( 32639), -INT16_C(     1),  INT16_C( 10774),  INT16_C( 29206),  INT16_C(  4537), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(    12),  INT16_C(    14),  INT16_C(    16),  INT16_C(     6),  INT16_C(     7),  INT16_C(     7),  INT16_C(    16) } },
+    { {  INT16_C(  1838), -INT16_C(   597), -INT16_C( 11668),  INT16_C(  8480),  INT16_C( 23422),  INT16_C( 21338), -INT16_C(  3069), -INT16_C(     9) },
+      {  INT16_C(     7),  INT16_C(    12),  INT16_C(     8),  INT16_C(     3),  INT16_C(    11),  INT16_C(     8),  INT16_C(     7),  INT16_C(    15) } },
+    { { -INT16_C( 26705),  INT16_C(   260),  INT16_C( 28693),  INT16_C(  8987),  INT16_C(     0), -INT16_C(  9873), -INT16_C( 16623), -INT16_C(   130) },
+      {  INT16_C(    11),  INT16_C(     2),  INT16_C(     6),  INT16_C(     7),  INT16_C(     0),  INT16_C(    11),  INT16_C(     9),  INT16_C(    14) } },
+    { { -INT16_C(     2),  INT16_C(  8226),  INT16_C(     0), -INT16_C(  5917),  INT16_C( 16896), -INT16_C(     1),  INT16_C(  5215),  INT16_C(  1028) },
+      {  INT16_C(    15),  INT16_C(     3),  INT16_C(     0),  INT16_C(     9),  INT16_C(     2),  INT16_C(    16),  INT16_C(     8),  INT16_C(     2) } },
+    { {  INT16_C( 19491),  INT16_C( 31826),  INT16_C(  1779), -INT16_C(  6145), -INT16_C(    65),       INT16_MAX,  INT16_C(     0), -INT16_C( 30895) },
+      {  INT16_C(     6),  INT16_C(     8),  INT16_C(     8),  INT16_C(    14),  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     7) } },
+    { {  INT16_C(     1), -INT16_C( 28514), -INT16_C(    33), -INT16_C(   321), -INT16_C( 28439), -INT16_C(  4097), -INT16_C( 25121), -INT16_C(  2053) },
+      {  INT16_C(     1),  INT16_C(     7),  INT16_C(    15),  INT16_C(    14),  INT16_C(     7),  INT16_C(    15),  INT16_C(    12),  INT16_C(    14) } },
+    { { -INT16_C( 20481),  INT16_C(  3149), -INT16_C( 29200), -INT16_C(  8099),  INT16_C(   640),  INT16_C( 30433),  INT16_C(  8772), -INT16_C( 17878) },
+      {  INT16_C(    14),  INT16_C(     6),  INT16_C(     8),  INT16_C(     8),  INT16_C(     2),  INT16_C(     9),  INT16_C(     4),  INT16_C(     8) } },
+    { {  INT16_C(    16), -INT16_C( 10131),  INT16_C(     0),  INT16_C( 10483), -INT16_C(  1025), -INT16_C( 15235), -INT16_C(   281),  INT16_C(   544) },
+      {  INT16_C(     1),  INT16_C(     9),  INT16_C(     0),  INT16_C(     8),  INT16_C(    15),  INT16_C(     9),  INT16_C(    13),  INT16_C(     2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi16(a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(   257),  INT16_C( 32600), -INT16_C(  8193), -INT16_C( 16389),  INT16_C(     0),  INT16_C( 25498), -INT16_C(   513), -INT16_C(     2) },
+      UINT8_C(111),
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 23093), -INT16_C( 17409), -INT16_C(  1025),  INT16_C( 21802), -INT16_C( 31340), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     9),  INT16_C(    14),  INT16_C(     0),  INT16_C(     7),  INT16_C(     6), -INT16_C(     2) } },
+    { { -INT16_C(  8351), -INT16_C( 30460), -INT16_C(    17),  INT16_C( 21274),  INT16_C(    84), -INT16_C( 28672),  INT16_C( 16720), -INT16_C( 29463) },
+      UINT8_C(131),
+      { -INT16_C(     1),  INT16_C(    24),  INT16_C(   136), -INT16_C( 22853),  INT16_C( 29958),  INT16_C( 32765), -INT16_C( 21942), -INT16_C(   658) },
+      {  INT16_C(    16),  INT16_C(     2), -INT16_C(    17),  INT16_C( 21274),  INT16_C(    84), -INT16_C( 28672),  INT16_C( 16720),  INT16_C(    12) } },
+    { { -INT16_C( 31347),  INT16_C( 30655),  INT16_C( 15227), -INT16_C( 24576),  INT16_C(   512),  INT16_C(  2407),  INT16_C( 13396), -INT16_C(    89) },
+      UINT8_C( 77),
+      { -INT16_C(     9),  INT16_C(     6),  INT16_C(     0), -INT16_C( 30703),  INT16_C( 16848), -INT16_C(  8441), -INT16_C(  4353), -INT16_C(  4097) },
+      {  INT16_C(    15),  INT16_C( 30655),  INT16_C(     0),  INT16_C(     4),  INT16_C(   512),  INT16_C(  2407),  INT16_C(    14), -INT16_C(    89) } },
+    { {  INT16_C( 10810),  INT16_C( 23925),  INT16_C( 15903), -INT16_C(  5624), -INT16_C(  6856), -INT16_C(  8559), -INT16_C(  4129),  INT16_C(     9) },
+      UINT8_C(116),
+      {  INT16_C(  8729), -INT16_C( 16385),  INT16_C( 23983), -INT16_C(  2057), -INT16_C( 22976),  INT16_C( 30541), -INT16_C( 27158), -INT16_C( 18487) },
+      {  INT16_C( 10810),  INT16_C( 23925),  INT16_C(    11), -INT16_C(  5624),  INT16_C(     5),  INT16_C(    10),  INT16_C(     9),  INT16_C(     9) } },
+    { { -INT16_C(  2081), -INT16_C( 15737),  INT16_C(  3754),  INT16_C( 20705),       INT16_MAX, -INT16_C( 12353),  INT16_C( 25104),  INT16_C(  2112) },
+      UINT8_C(119),
+      { -INT16_C( 28281), -INT16_C( 15868),  INT16_C( 21089),  INT16_C( 13688),  INT16_C(   384), -INT16_C( 30246), -INT16_C( 14426),  INT16_C( 20496) },
+      {  INT16_C(     7),  INT16_C(     4),  INT16_C(     6),  INT16_C( 20705),  INT16_C(     2),  INT16_C(     8),  INT16_C(     9),  INT16_C(  2112) } },
+    { {  INT16_C( 25344),  INT16_C( 14456),  INT16_C(  4096),  INT16_C(     0),  INT16_C( 13863), -INT16_C(    13),  INT16_C( 15301),  INT16_C(    64) },
+      UINT8_C( 19),
+      { -INT16_C( 28485), -INT16_C( 16342),  INT16_C(     0),  INT16_C(     8),  INT16_C(    16), -INT16_C(     1), -INT16_C(  2053),  INT16_C( 27626) },
+      {  INT16_C(     8),  INT16_C(     5),  INT16_C(  4096),  INT16_C(     0),  INT16_C(     1), -INT16_C(    13),  INT16_C( 15301),  INT16_C(    64) } },
+    { {  INT16_C(   110), -INT16_C(    25),  INT16_C( 20186), -INT16_C(  8193), -INT16_C(     3),  INT16_C(  8453), -INT16_C( 10375), -INT16_C(  1033) },
+      UINT8_C(180),
+      { -INT16_C( 20521), -INT16_C(  1027),  INT16_C( 32222),  INT16_C(  5120),  INT16_C(  7203),  INT16_C( 16384), -INT16_C(  1281),  INT16_C(  4096) },
+      {  INT16_C(   110), -INT16_C(    25),  INT16_C(    12), -INT16_C(  8193),  INT16_C(     6),  INT16_C(     1), -INT16_C( 10375),  INT16_C(     1) } },
+    { {  INT16_C( 24992),  INT16_C( 20673), -INT16_C(  8193), -INT16_C( 20001), -INT16_C(  6380), -INT16_C( 21870),  INT16_C( 29704), -INT16_C(   545) },
+      UINT8_C( 79),
+      {  INT16_C( 15258), -INT16_C( 16644),  INT16_C(     0), -INT16_C( 32632),  INT16_C(     1),  INT16_C(  1024),  INT16_C(   192), -INT16_C(  6449) },
+      {  INT16_C(     9),  INT16_C(    12),  INT16_C(     0),  INT16_C(     3), -INT16_C(  6380), -INT16_C( 21870),  INT16_C(     2), -INT16_C(   545) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 13),
+      {  INT16_C(     0), -INT16_C( 25602),  INT16_C(  4097),  INT16_C(  8704), -INT16_C( 23609), -INT16_C( 12291),  INT16_C( 12232), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(191),
+      {  INT16_C(  4170), -INT16_C(  2920),  INT16_C( 28747), -INT16_C( 11977), -INT16_C( 26552),  INT16_C(  1168), -INT16_C(  2636), -INT16_C(  2193) },
+      {  INT16_C(     4),  INT16_C(     8),  INT16_C(     7),  INT16_C(     9),  INT16_C(     5),  INT16_C(     3),  INT16_C(     0),  INT16_C(    13) } },
+    { UINT8_C( 30),
+      {  INT16_C( 23482), -INT16_C( 29459), -INT16_C(  6062), -INT16_C( 28713),  INT16_C( 11222),  INT16_C( 27423), -INT16_C( 32610),  INT16_C(  9216) },
+      {  INT16_C(     0),  INT16_C(     9),  INT16_C(     7),  INT16_C(    11),  INT16_C(     9),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(175),
+      {  INT16_C( 28986),  INT16_C( 10917),  INT16_C(  1973), -INT16_C(  9318),  INT16_C(  3667), -INT16_C(     1), -INT16_C(    33), -INT16_C(     5) },
+      {  INT16_C(     8),  INT16_C(     7),  INT16_C(     8),  INT16_C(    10),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(    15) } },
+    { UINT8_C(167),
+      { -INT16_C( 21619),  INT16_C(     2),  INT16_C( 16382), -INT16_C(   401),  INT16_C( 14610), -INT16_C(     1),  INT16_C( 15729),  INT16_C(   128) },
+      {  INT16_C(     9),  INT16_C(     1),  INT16_C(    13),  INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(     1) } },
+    { UINT8_C( 60),
+      {  INT16_C( 20358), -INT16_C(  5050),  INT16_C(     0),  INT16_C(  3695), -INT16_C(     1),  INT16_C(    16), -INT16_C( 22541), -INT16_C( 29242) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     9),  INT16_C(    16),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 63),
+      { -INT16_C(  1423), -INT16_C(  4226), -INT16_C(  8201),  INT16_C( 15462),  INT16_C(  1786),  INT16_C(  3221),  INT16_C(   512),  INT16_C( 32735) },
+      {  INT16_C(    10),  INT16_C(    13),  INT16_C(    14),  INT16_C(     8),  INT16_C(     8),  INT16_C(     6),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(224),
+      { -INT16_C(     1), -INT16_C(  5650),  INT16_C( 32509), -INT16_C( 25346),  INT16_C( 24896),  INT16_C( 16416),  INT16_C(  1930),  INT16_C( 20480) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     6),  INT16_C(     2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(           0), -INT32_C(   658508655), -INT32_C(  1907528705), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(          19),  INT32_C(          21),  INT32_C(          32) } },
+    { { -INT32_C(   413923128),  INT32_C(  1075654202), -INT32_C(   272726581), -INT32_C(   428723150) },
+      {  INT32_C(          13),  INT32_C(          13),  INT32_C(          21),  INT32_C(          15) } },
+    { { -INT32_C(  1946419201),  INT32_C(  1610604543), -INT32_C(   268566786), -INT32_C(    69206017) },
+      {  INT32_C(          27),  INT32_C(          29),  INT32_C(          28),  INT32_C(          30) } },
+    { {  INT32_C(    66996797),  INT32_C(  1333137797), -INT32_C(   817645327), -INT32_C(   847268865) },
+      {  INT32_C(          17),  INT32_C(          15),  INT32_C(          18),  INT32_C(          25) } },
+    { { -INT32_C(  2038431232),  INT32_C(  1946892025), -INT32_C(   464708417), -INT32_C(   153700239) },
+      {  INT32_C(           5),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19) } },
+    { { -INT32_C(  1532843656), -INT32_C(   536870913), -INT32_C(        9233),  INT32_C(  1564488976) },
+      {  INT32_C(          14),  INT32_C(          31),  INT32_C(          29),  INT32_C(          11) } },
+    { {  INT32_C(        1056),  INT32_C(     8388736),  INT32_C(  1610612736),  INT32_C(   134746112) },
+      {  INT32_C(           2),  INT32_C(           2),  INT32_C(           2),  INT32_C(           3) } },
+    { { -INT32_C(  2107649065),  INT32_C(  1434396058),  INT32_C(  1688619870),  INT32_C(       65536) },
+      {  INT32_C(          19),  INT32_C(          18),  INT32_C(          16),  INT32_C(           1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(     1049097),  INT32_C(  1965906305),  INT32_C(  1996463103), -INT32_C(    68663408) },
+      UINT8_C( 80),
+      {  INT32_C(           0),  INT32_C(      262168),  INT32_C(  1074266116), -INT32_C(           1) },
+      {  INT32_C(     1049097),  INT32_C(  1965906305),  INT32_C(  1996463103), -INT32_C(    68663408) } },
+    { { -INT32_C(  1648224392), -INT32_C(  1881565383),  INT32_C(  1073743872),  INT32_C(    99192412) },
+      UINT8_C(202),
+      {  INT32_C(   168671319),  INT32_C(   786408341), -INT32_C(           2), -INT32_C(  1929635746) },
+      { -INT32_C(  1648224392),  INT32_C(          19),  INT32_C(  1073743872),  INT32_C(          16) } },
+    { {  INT32_C(   815402917), -INT32_C(  1294787860), -INT32_C(   667914031),  INT32_C(      262160) },
+      UINT8_C( 92),
+      {  INT32_C(     2244025),  INT32_C(       15360), -INT32_C(  1418758658),  INT32_C(  1241534480) },
+      {  INT32_C(   815402917), -INT32_C(  1294787860),  INT32_C(          23),  INT32_C(           6) } },
+    { { -INT32_C(   151028801), -INT32_C(  1208238081),  INT32_C(  2139094527),  INT32_C(  1720869578) },
+      UINT8_C(117),
+      {  INT32_C(  1376523536),  INT32_C(     1048592),  INT32_C(  1559727349),  INT32_C(   807960832) },
+      {  INT32_C(           9), -INT32_C(  1208238081),  INT32_C(          20),  INT32_C(  1720869578) } },
+    { { -INT32_C(  1722534569),  INT32_C(    33554432), -INT32_C(     5784065), -INT32_C(   604509986) },
+      UINT8_C(  9),
+      {  INT32_C(   773676285), -INT32_C(  1202813310),  INT32_C(  2109734911), -INT32_C(   620892302) },
+      {  INT32_C(          19),  INT32_C(    33554432), -INT32_C(     5784065),  INT32_C(          23) } },
+    { {  INT32_C(  1946148319), -INT32_C(  2080219248),  INT32_C(      394320),  INT32_C(   315159491) },
+      UINT8_C( 52),
+      { -INT32_C(  1073873417),  INT32_C(  1855025205), -INT32_C(    86016009), -INT32_C(  1737560654) },
+      {  INT32_C(  1946148319), -INT32_C(  2080219248),  INT32_C(          27),  INT32_C(   315159491) } },
+    { {  INT32_C(  1695326318),  INT32_C(           0), -INT32_C(   134369281), -INT32_C(  2147481408) },
+      UINT8_C( 35),
+      {  INT32_C(   319881228),  INT32_C(   935866937),  INT32_C(   805306375), -INT32_C(        8449) },
+      {  INT32_C(           7),  INT32_C(          15), -INT32_C(   134369281), -INT32_C(  2147481408) } },
+    { {  INT32_C(  2008530846),  INT32_C(      262144),  INT32_C(   702309929),  INT32_C(  1515206955) },
+      UINT8_C(130),
+      { -INT32_C(     3612426),  INT32_C(  1621748533),  INT32_C(   842007374),  INT32_C(  2121647110) },
+      {  INT32_C(  2008530846),  INT32_C(          16),  INT32_C(   702309929),  INT32_C(  1515206955) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(225),
+      {  INT32_C(           0),  INT32_C(    20971776),  INT32_C(   138413056), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 40),
+      { -INT32_C(      102401),  INT32_C(  2146131446),  INT32_C(       16392), -INT32_C(   134217986) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          29) } },
+    { UINT8_C(112),
+      {  INT32_C(  1073750144), -INT32_C(  2019866445), -INT32_C(   560988227),  INT32_C(   260011340) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(200),
+      { -INT32_C(    16779297),  INT32_C(    47814110), -INT32_C(  1744830204),  INT32_C(  1125649808) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          10) } },
+    { UINT8_C(251),
+      {  INT32_C(  1354232566),  INT32_C(   807473216), -INT32_C(  1072774222),  INT32_C(  2068820082) },
+      {  INT32_C(          19),  INT32_C(           6),  INT32_C(           0),  INT32_C(          18) } },
+    { UINT8_C(236),
+      { -INT32_C(  2059193816), -INT32_C(  1561488590), -INT32_C(     4425245),  INT32_C(   512114141) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          23),  INT32_C(          18) } },
+    { UINT8_C(181),
+      { -INT32_C(     3545188),  INT32_C(  1993437565),  INT32_C(   966051840), -INT32_C(  1168034555) },
+      {  INT32_C(          22),  INT32_C(           0),  INT32_C(          10),  INT32_C(           0) } },
+    { UINT8_C(117),
+      {  INT32_C(    16777236),  INT32_C(       66048), -INT32_C(  1520249289), -INT32_C(  1382475531) },
+      {  INT32_C(           3),  INT32_C(           0),  INT32_C(          17),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  64) } },
+    { { -INT64_C(   18124353988201025), -INT64_C( 4111857945560515089) },
+      {  INT64_C(                  54),  INT64_C(                  51) } },
+    { {  INT64_C(    4505798650628096), -INT64_C(   54324807963262977) },
+      {  INT64_C(                   3),  INT64_C(                  56) } },
+    { {  INT64_C( 4093319438782814103), -INT64_C(     562951094277139) },
+      {  INT64_C(                  36),  INT64_C(                  57) } },
+    { {  INT64_C( 8726233644786750863), -INT64_C( 4611686091978702850) },
+      {  INT64_C(                  31),  INT64_C(                  59) } },
+    { {  INT64_C( 5936862297629666124),  INT64_C( 1544450486769080240) },
+      {  INT64_C(                  28),  INT64_C(                  34) } },
+    { { -INT64_C( 6240798343494014255),  INT64_C( 8568212668495942262) },
+      {  INT64_C(                  31),  INT64_C(                  31) } },
+    { {  INT64_C( 4899977971525225478), -INT64_C(          2147516451) },
+      {  INT64_C(                  10),  INT64_C(                  60) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 2978003308076557661), -INT64_C(    9007202241101829) },
+      UINT8_C( 26),
+      {  INT64_C(                   0), -INT64_C(                   1) },
+      { -INT64_C( 2978003308076557661),  INT64_C(                  64) } },
+    { { -INT64_C(  288450304515572777),  INT64_C( 6589872041760879901) },
+      UINT8_C( 44),
+      {  INT64_C( 4611683810805809151), -INT64_C( 8615737695860129120) },
+      { -INT64_C(  288450304515572777),  INT64_C( 6589872041760879901) } },
+    { { -INT64_C( 6345229686030395850),  INT64_C(  576882965842297864) },
+      UINT8_C(  9),
+      {  INT64_C( 3459336266309443712), -INT64_C( 4237207841291893574) },
+      {  INT64_C(                   8),  INT64_C(  576882965842297864) } },
+    { { -INT64_C(                2177), -INT64_C(  447826628101849502) },
+      UINT8_C( 14),
+      {  INT64_C( 2979805060116848340), -INT64_C(    1689168291823637) },
+      { -INT64_C(                2177),  INT64_C(                  55) } },
+    { {  INT64_C(  324298764179213956),  INT64_C( 4917483383088434296) },
+      UINT8_C( 88),
+      { -INT64_C(   18172816230748419), -INT64_C( 1172062912265601161) },
+      {  INT64_C(  324298764179213956),  INT64_C( 4917483383088434296) } },
+    { { -INT64_C(    7903289580978433), -INT64_C( 7461552320610047759) },
+      UINT8_C(218),
+      { -INT64_C(  576460752304996417), -INT64_C( 8544070272844561062) },
+      { -INT64_C(    7903289580978433),  INT64_C(                  30) } },
+    { {  INT64_C( 2901672758354116657),  INT64_C( 4712315724568663119) },
+      UINT8_C(154),
+      {  INT64_C( 8960292120778477720), -INT64_C( 8935140780228440032) },
+      {  INT64_C( 2901672758354116657),  INT64_C(                  12) } },
+    { {  INT64_C(           102825984),  INT64_C(  576465253429182464) },
+      UINT8_C(251),
+      { -INT64_C( 1964202593211550236),  INT64_C( 6796053593767462030) },
+      {  INT64_C(                  34),  INT64_C(                  30) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  64) } },
+    { UINT8_C(191),
+      { -INT64_C( 7594176875662262013), -INT64_C( 7601509877234978626) },
+      {  INT64_C(                  23),  INT64_C(                  25) } },
+    { UINT8_C(233),
+      {  INT64_C( 5949318182349798929), -INT64_C(       1391840002113) },
+      {  INT64_C(                  32),  INT64_C(                   0) } },
+    { UINT8_C( 43),
+      { -INT64_C( 1708976520267417927), -INT64_C(     422246841712673) },
+      {  INT64_C(                  36),  INT64_C(                  58) } },
+    { UINT8_C( 96),
+      { -INT64_C(   36226709112029317), -INT64_C( 8905561875539605662) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 59),
+      { -INT64_C(      39719893223425),  INT64_C(  162411611863253008) },
+      {  INT64_C(                  57),  INT64_C(                   8) } },
+    { UINT8_C(107),
+      { -INT64_C( 5371402695187511696),  INT64_C(     141846126788608) },
+      {  INT64_C(                  34),  INT64_C(                   4) } },
+    { UINT8_C( 90),
+      { -INT64_C(         77418480129), -INT64_C(       2757637439493) },
+      {  INT64_C(                   0),  INT64_C(                  59) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(   0), -INT8_C(  10), -INT8_C(  65),      INT8_MAX,  INT8_C( 125), -INT8_C(  18),  INT8_C(   0),  INT8_C(  75),
+        -INT8_C( 118),  INT8_C(  32), -INT8_C(   3), -INT8_C( 115), -INT8_C(  13), -INT8_C(   1),  INT8_C(   0),  INT8_C(   1),
+        -INT8_C(  65),  INT8_C(  48),  INT8_C( 125),  INT8_C(  94),  INT8_C(   7),  INT8_C(  16),  INT8_C(  97), -INT8_C(   1),
+         INT8_C(  37), -INT8_C(  51), -INT8_C(  19),  INT8_C(   4), -INT8_C(   1), -INT8_C(   1), -INT8_C(  19), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   6),  INT8_C(   7),  INT8_C(   7),  INT8_C(   6),  INT8_C(   6),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   7),  INT8_C(   4),  INT8_C(   6),  INT8_C(   8),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   7),  INT8_C(   2),  INT8_C(   6),  INT8_C(   5),  INT8_C(   3),  INT8_C(   1),  INT8_C(   3),  INT8_C(   8),
+         INT8_C(   3),  INT8_C(   5),  INT8_C(   6),  INT8_C(   1),  INT8_C(   8),  INT8_C(   8),  INT8_C(   6),  INT8_C(   8) } },
+    { {  INT8_C(  17),  INT8_C(  51),  INT8_C(  38),  INT8_C(   2),  INT8_C(   0),  INT8_C(  59),  INT8_C(   2), -INT8_C(   2),
+        -INT8_C(   3),  INT8_C(  32), -INT8_C(  68),  INT8_C( 112), -INT8_C(   9),  INT8_C(  32),  INT8_C(  34), -INT8_C(   1),
+        -INT8_C(  40), -INT8_C(  78), -INT8_C(  38),  INT8_C( 120),  INT8_C(  36), -INT8_C(   9),  INT8_C(  85), -INT8_C(  83),
+        -INT8_C(  57), -INT8_C(  93), -INT8_C(  74),  INT8_C(   0),  INT8_C(   1), -INT8_C(  13),  INT8_C(   4),  INT8_C(  12) },
+      {  INT8_C(   2),  INT8_C(   4),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),  INT8_C(   7),
+         INT8_C(   7),  INT8_C(   1),  INT8_C(   5),  INT8_C(   3),  INT8_C(   7),  INT8_C(   1),  INT8_C(   2),  INT8_C(   8),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   2),  INT8_C(   7),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   6),  INT8_C(   1),  INT8_C(   2) } },
+    { { -INT8_C(   1), -INT8_C(   5),  INT8_C(   0),  INT8_C(  48),  INT8_C( 125), -INT8_C(   1),  INT8_C(  86), -INT8_C(  91),
+        -INT8_C(   1),  INT8_C(  25), -INT8_C(   1),  INT8_C(  75), -INT8_C(  13),  INT8_C(  14),  INT8_C(  16),  INT8_C(  27),
+         INT8_C(   7), -INT8_C(  45),  INT8_C(   4),  INT8_C(   0), -INT8_C(  19), -INT8_C( 104), -INT8_C(  41), -INT8_C(  65),
+         INT8_C(  65),  INT8_C(  65), -INT8_C(   1),  INT8_C( 102),  INT8_C(  69),  INT8_C(   0),      INT8_MAX,  INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   7),  INT8_C(   0),  INT8_C(   2),  INT8_C(   6),  INT8_C(   8),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   8),  INT8_C(   3),  INT8_C(   8),  INT8_C(   4),  INT8_C(   6),  INT8_C(   3),  INT8_C(   1),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   5),  INT8_C(   1),  INT8_C(   0),  INT8_C(   6),  INT8_C(   3),  INT8_C(   6),  INT8_C(   7),
+         INT8_C(   2),  INT8_C(   2),  INT8_C(   8),  INT8_C(   4),  INT8_C(   3),  INT8_C(   0),  INT8_C(   7),  INT8_C(   1) } },
+    { { -INT8_C(  17),  INT8_C(  16), -INT8_C(  20),  INT8_C( 116),  INT8_C(  96),  INT8_C(  32), -INT8_C(   5),  INT8_C(  89),
+        -INT8_C(  99),  INT8_C(  50), -INT8_C( 110), -INT8_C(   3),  INT8_C( 108), -INT8_C(  82),  INT8_C(  40), -INT8_C(  81),
+        -INT8_C(  88),  INT8_C(  11), -INT8_C(  11), -INT8_C(   5), -INT8_C(   7),  INT8_C(   0),  INT8_C(  43), -INT8_C(  67),
+         INT8_C(  36),  INT8_C(   0),  INT8_C(   8),  INT8_C(  83),  INT8_C(  16),  INT8_C( 103), -INT8_C(  31),  INT8_C(   1) },
+      {  INT8_C(   7),  INT8_C(   1),  INT8_C(   5),  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),  INT8_C(   7),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(   3),  INT8_C(   7),  INT8_C(   4),  INT8_C(   5),  INT8_C(   2),  INT8_C(   6),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   6),  INT8_C(   7),  INT8_C(   6),  INT8_C(   0),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   4),  INT8_C(   1),  INT8_C(   5),  INT8_C(   4),  INT8_C(   1) } },
+    { {  INT8_C(  16), -INT8_C(  62), -INT8_C( 100),  INT8_C(   0),  INT8_C(  40),  INT8_C(   1), -INT8_C(  65),  INT8_C(  53),
+        -INT8_C(  23),  INT8_C( 119),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C(  17),  INT8_C(   9), -INT8_C(   1),
+        -INT8_C(  46), -INT8_C(  18),  INT8_C(  84), -INT8_C(   1), -INT8_C(  73), -INT8_C(  97),  INT8_C(  23),  INT8_C(  27),
+        -INT8_C(  58),  INT8_C(   0),  INT8_C(  64), -INT8_C(  11), -INT8_C(  17), -INT8_C(  31),  INT8_C(  91), -INT8_C(  32) },
+      {  INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   7),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   6),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   2),  INT8_C(   8),
+         INT8_C(   4),  INT8_C(   6),  INT8_C(   3),  INT8_C(   8),  INT8_C(   6),  INT8_C(   6),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   1),  INT8_C(   6),  INT8_C(   7),  INT8_C(   4),  INT8_C(   5),  INT8_C(   3) } },
+    { {  INT8_C(  85),  INT8_C(   2), -INT8_C(   1),  INT8_C(   0),  INT8_C(  40), -INT8_C(   1),  INT8_C(   5), -INT8_C( 100),
+        -INT8_C(  83),  INT8_C( 109),  INT8_C(   0),  INT8_C(  16), -INT8_C(   5), -INT8_C(   5),  INT8_C(  82), -INT8_C(   1),
+         INT8_C(  33), -INT8_C(  40),  INT8_C(   2), -INT8_C( 106),  INT8_C(  91), -INT8_C(  78),  INT8_C(  49),  INT8_C(  10),
+         INT8_C(  95),  INT8_C(  19), -INT8_C(  39), -INT8_C(  11),  INT8_C( 100), -INT8_C(  82), -INT8_C( 122), -INT8_C(  68) },
+      {  INT8_C(   4),  INT8_C(   1),  INT8_C(   8),  INT8_C(   0),  INT8_C(   2),  INT8_C(   8),  INT8_C(   2),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   7),  INT8_C(   7),  INT8_C(   3),  INT8_C(   8),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   1),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),
+         INT8_C(   6),  INT8_C(   3),  INT8_C(   5),  INT8_C(   6),  INT8_C(   3),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5) } },
+    { { -INT8_C(   2),  INT8_C(   8),  INT8_C(  92), -INT8_C(   6), -INT8_C(   1), -INT8_C(  10),  INT8_C(   1), -INT8_C(   1),
+         INT8_C(  75),  INT8_C(  92), -INT8_C(   5), -INT8_C(   1), -INT8_C(  52),  INT8_C(  52), -INT8_C(   3), -INT8_C( 106),
+        -INT8_C(   9), -INT8_C(  67),  INT8_C(   0),  INT8_C(  27),  INT8_C(  75),  INT8_C(   0),  INT8_C(   0), -INT8_C(  21),
+         INT8_C(   0),  INT8_C( 119), -INT8_C(  45), -INT8_C(   9), -INT8_C(  63), -INT8_C(  65), -INT8_C(  69),  INT8_C( 126) },
+      {  INT8_C(   7),  INT8_C(   1),  INT8_C(   4),  INT8_C(   6),  INT8_C(   8),  INT8_C(   6),  INT8_C(   1),  INT8_C(   8),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   7),  INT8_C(   8),  INT8_C(   4),  INT8_C(   3),  INT8_C(   7),  INT8_C(   4),
+         INT8_C(   7),  INT8_C(   6),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   7),  INT8_C(   3),  INT8_C(   7),  INT8_C(   6),  INT8_C(   6) } },
+    { { -INT8_C(   3),  INT8_C(   0),      INT8_MAX, -INT8_C( 106), -INT8_C( 122),  INT8_C(   0),  INT8_C( 106), -INT8_C(  71),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(  15), -INT8_C(   1),  INT8_C( 109), -INT8_C(   1), -INT8_C(   1), -INT8_C(   5),
+         INT8_C(  64), -INT8_C(  65), -INT8_C( 127),  INT8_C(   3), -INT8_C(   9),  INT8_C(  33), -INT8_C(  13),  INT8_C(  88),
+         INT8_C(  14), -INT8_C(  92), -INT8_C(   3),  INT8_C(  19),  INT8_C(  64),  INT8_C(   0), -INT8_C(   9), -INT8_C(  57) },
+      {  INT8_C(   7),  INT8_C(   0),  INT8_C(   7),  INT8_C(   4),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   4),  INT8_C(   8),  INT8_C(   5),  INT8_C(   8),  INT8_C(   8),  INT8_C(   7),
+         INT8_C(   1),  INT8_C(   7),  INT8_C(   2),  INT8_C(   2),  INT8_C(   7),  INT8_C(   2),  INT8_C(   6),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   7),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   5) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi8(a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C(  39),  INT8_C(  30), -INT8_C(  20),  INT8_C(   0),  INT8_C(  17), -INT8_C(   1), -INT8_C(   9),  INT8_C(  43),
+        -INT8_C(   1), -INT8_C(  45), -INT8_C( 122), -INT8_C(  30),  INT8_C(   0), -INT8_C(  90), -INT8_C(   4),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   5), -INT8_C( 124), -INT8_C(  48), -INT8_C(  24),      INT8_MAX,  INT8_C(   0),  INT8_C(  77),
+        -INT8_C(  79),  INT8_C(   4), -INT8_C(  96),  INT8_C(  41),  INT8_C(   4),  INT8_C(   1),  INT8_C(  21), -INT8_C(  51) },
+      UINT32_C(1341465075),
+      {  INT8_C(   0), -INT8_C(  13), -INT8_C(   1),  INT8_C(   0), -INT8_C(   3),  INT8_C( 114), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  26),  INT8_C(   0),  INT8_C(  76), -INT8_C(   4), -INT8_C(  65), -INT8_C(   5),  INT8_C(   0), -INT8_C( 121),
+         INT8_C(  16), -INT8_C(  48), -INT8_C(   1), -INT8_C( 104),  INT8_C(  78), -INT8_C(  19),  INT8_C(  16),  INT8_C(  58),
+        -INT8_C(  78), -INT8_C(  33), -INT8_C(   4), -INT8_C( 120),  INT8_C( 100),  INT8_C(  14), -INT8_C(  48), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   6), -INT8_C(  20),  INT8_C(   0),  INT8_C(   7),  INT8_C(   4),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(   5), -INT8_C(  45), -INT8_C( 122), -INT8_C(  30),  INT8_C(   0),  INT8_C(   7), -INT8_C(   4),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   5),  INT8_C(   8), -INT8_C(  48),  INT8_C(   4),  INT8_C(   6),  INT8_C(   1),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   7),  INT8_C(   6),  INT8_C(   2),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3), -INT8_C(  51) } },
+    { { -INT8_C( 126), -INT8_C(  75),  INT8_C(  55),  INT8_C(  29),  INT8_C(  34), -INT8_C(   1),  INT8_C( 112), -INT8_C(  11),
+        -INT8_C(  84),  INT8_C(   6), -INT8_C(  17), -INT8_C(   1), -INT8_C( 113),  INT8_C(   0),  INT8_C(  64),  INT8_C( 119),
+        -INT8_C(  46), -INT8_C(  70), -INT8_C( 120),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  82),  INT8_C(  42),      INT8_MAX,  INT8_C(   0),  INT8_C(  27), -INT8_C(  96),  INT8_C(   0),  INT8_C(   4) },
+      UINT32_C( 391581916),
+      {  INT8_C(   4),      INT8_MAX,  INT8_C(  32), -INT8_C(  57), -INT8_C(   1), -INT8_C( 110),  INT8_C( 125), -INT8_C(   2),
+         INT8_C(  18), -INT8_C(  33), -INT8_C(   3),  INT8_C(   0), -INT8_C(  17),  INT8_C(  77),  INT8_C(   0), -INT8_C(  93),
+             INT8_MIN, -INT8_C(   9),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0), -INT8_C(   6),  INT8_C(  64),  INT8_C(   0),
+        -INT8_C(  39),  INT8_C(   0), -INT8_C(  99),  INT8_C(  70), -INT8_C(   2), -INT8_C(   3),  INT8_C(  64),  INT8_C(  39) },
+      { -INT8_C( 126), -INT8_C(  75),  INT8_C(   1),  INT8_C(   5),  INT8_C(   8), -INT8_C(   1),  INT8_C(   6),  INT8_C(   7),
+        -INT8_C(  84),  INT8_C(   6), -INT8_C(  17), -INT8_C(   1),  INT8_C(   7),  INT8_C(   0),  INT8_C(  64),  INT8_C( 119),
+         INT8_C(   1),  INT8_C(   7),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   7), -INT8_C(  96),  INT8_C(   0),  INT8_C(   4) } },
+    { { -INT8_C(   1),  INT8_C(   0), -INT8_C(   2), -INT8_C(   2), -INT8_C(   1),  INT8_C(  38),  INT8_C(  16),  INT8_C(  67),
+        -INT8_C(  30),  INT8_C( 111), -INT8_C(  59), -INT8_C( 110),  INT8_C(  69),  INT8_C(   1),  INT8_C(  95),  INT8_C( 125),
+        -INT8_C(  67),  INT8_C(  24), -INT8_C(  51), -INT8_C(  45), -INT8_C(   2), -INT8_C(  96), -INT8_C( 113),  INT8_C(  67),
+         INT8_C(   5),  INT8_C(   2), -INT8_C(  73),  INT8_C( 126),  INT8_C(   8),  INT8_C(   8), -INT8_C(   1),  INT8_C(   0) },
+      UINT32_C(1735974817),
+      {  INT8_C( 111),  INT8_C(  96), -INT8_C(   9),  INT8_C(   0),  INT8_C(  23),  INT8_C(   5),  INT8_C(  72),  INT8_C(   0),
+         INT8_C(  56), -INT8_C(  19), -INT8_C(  86),  INT8_C( 125),  INT8_C(   0), -INT8_C(   1),      INT8_MIN, -INT8_C(   1),
+         INT8_C(  49), -INT8_C(   3), -INT8_C(   7),  INT8_C(  33),  INT8_C( 119), -INT8_C(  17), -INT8_C(  78), -INT8_C(  69),
+         INT8_C(   0),  INT8_C( 109),  INT8_C(   8),  INT8_C(   6),  INT8_C(  42),  INT8_C( 106),      INT8_MIN, -INT8_C(  94) },
+      {  INT8_C(   6),  INT8_C(   0), -INT8_C(   2), -INT8_C(   2), -INT8_C(   1),  INT8_C(   2),  INT8_C(  16),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   8),
+        -INT8_C(  67),  INT8_C(  24), -INT8_C(  51),  INT8_C(   2),  INT8_C(   6),  INT8_C(   7),  INT8_C(   4),  INT8_C(  67),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   1),  INT8_C( 126),  INT8_C(   8),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0) } },
+    { { -INT8_C(   3),  INT8_C(  55), -INT8_C( 108),  INT8_C(   0), -INT8_C(  58), -INT8_C(  41),  INT8_C( 111),  INT8_C(   3),
+        -INT8_C(   1),  INT8_C( 105), -INT8_C(  25),  INT8_C(  25),      INT8_MAX,      INT8_MAX, -INT8_C(  24), -INT8_C( 126),
+         INT8_C(  14), -INT8_C(   1),  INT8_C(  60), -INT8_C( 101), -INT8_C(  67),  INT8_C(   0),  INT8_C(  64), -INT8_C(  48),
+         INT8_C(  16),  INT8_C(  57),  INT8_C(  15),  INT8_C(   1),  INT8_C(  98),  INT8_C(  12), -INT8_C(  33),  INT8_C(  48) },
+      UINT32_C(1130458956),
+      {  INT8_C(  93),  INT8_C(  53),  INT8_C(  90),  INT8_C( 123), -INT8_C(  45),  INT8_C(  54),  INT8_C(  11),  INT8_C(  19),
+        -INT8_C(  33), -INT8_C( 118), -INT8_C(   1),  INT8_C(   8),  INT8_C(  17),  INT8_C( 125),  INT8_C( 102),  INT8_C(   1),
+        -INT8_C(  85),  INT8_C(  32), -INT8_C( 123), -INT8_C(  11),  INT8_C(  19), -INT8_C(   1), -INT8_C(   1),  INT8_C(   8),
+        -INT8_C(  40),  INT8_C(  64),  INT8_C(   4),  INT8_C( 103),  INT8_C(  28), -INT8_C( 105),  INT8_C(   0), -INT8_C( 104) },
+      { -INT8_C(   3),  INT8_C(  55),  INT8_C(   4),  INT8_C(   6), -INT8_C(  58), -INT8_C(  41),  INT8_C(   3),  INT8_C(   3),
+         INT8_C(   7),  INT8_C(   3),  INT8_C(   8),  INT8_C(   1),      INT8_MAX,  INT8_C(   6),  INT8_C(   4), -INT8_C( 126),
+         INT8_C(   5), -INT8_C(   1),  INT8_C(  60), -INT8_C( 101), -INT8_C(  67),  INT8_C(   8),  INT8_C(   8), -INT8_C(  48),
+         INT8_C(   4),  INT8_C(   1),  INT8_C(  15),  INT8_C(   1),  INT8_C(  98),  INT8_C(  12),  INT8_C(   0),  INT8_C(  48) } },
+    { {  INT8_C(  26), -INT8_C(  67),      INT8_MIN,  INT8_C(   8), -INT8_C(   1), -INT8_C( 106),  INT8_C(  53), -INT8_C(   6),
+         INT8_C(   4), -INT8_C(   1), -INT8_C(  65),  INT8_C(  82), -INT8_C(  28), -INT8_C( 127),  INT8_C(  64), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C( 101), -INT8_C(  77), -INT8_C(  41), -INT8_C(   9),  INT8_C( 109),  INT8_C(   0), -INT8_C(  85),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(  96),  INT8_C(  92), -INT8_C(  17),  INT8_C(  92),  INT8_C(  32), -INT8_C(  65) },
+      UINT32_C(2656717026),
+      { -INT8_C(  49), -INT8_C(  84), -INT8_C(  23),  INT8_C(  42), -INT8_C(   1), -INT8_C(   1), -INT8_C(  50),  INT8_C(  31),
+        -INT8_C(  76), -INT8_C(  33), -INT8_C(   5), -INT8_C(  53),  INT8_C(  16), -INT8_C(  12), -INT8_C(  78),  INT8_C(  46),
+         INT8_C(  68),  INT8_C(   0), -INT8_C(  17),  INT8_C(   0),      INT8_MAX, -INT8_C( 102), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  71), -INT8_C(  49), -INT8_C(  97), -INT8_C( 126),  INT8_C(   0),  INT8_C(  58), -INT8_C( 113), -INT8_C( 117) },
+      {  INT8_C(  26),  INT8_C(   4),      INT8_MIN,  INT8_C(   8), -INT8_C(   1),  INT8_C(   8),  INT8_C(   5),  INT8_C(   5),
+         INT8_C(   4), -INT8_C(   1), -INT8_C(  65),  INT8_C(   5), -INT8_C(  28), -INT8_C( 127),  INT8_C(   4), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(   7),  INT8_C( 109),  INT8_C(   8), -INT8_C(  85),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   6),  INT8_C(   2),  INT8_C(   0),  INT8_C(  92),  INT8_C(  32),  INT8_C(   4) } },
+    { {  INT8_C(   1), -INT8_C(  64),  INT8_C(   0),  INT8_C(  56), -INT8_C(   3),  INT8_C(   4), -INT8_C(   2), -INT8_C(  14),
+         INT8_C(   3),  INT8_C(  17),  INT8_C( 102),  INT8_C(   0),  INT8_C( 103),  INT8_C(  74),  INT8_C(   0),  INT8_C(  82),
+         INT8_C(  81),  INT8_C(   2), -INT8_C( 104),  INT8_C(   2), -INT8_C( 118), -INT8_C(   9),  INT8_C(   2), -INT8_C(   3),
+         INT8_C(  71), -INT8_C(  89), -INT8_C(  47), -INT8_C( 121),  INT8_C(  79),  INT8_C(  47), -INT8_C(   1),  INT8_C(   0) },
+      UINT32_C(3693598666),
+      {  INT8_C(   2),  INT8_C(   1), -INT8_C(  59),  INT8_C(  42),  INT8_C(   0), -INT8_C(  59), -INT8_C(  48),  INT8_C( 126),
+             INT8_MIN, -INT8_C(  96), -INT8_C(   1),  INT8_C(   0), -INT8_C( 115), -INT8_C(   1),  INT8_C(  43), -INT8_C(  43),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  95), -INT8_C(  17),  INT8_C(   0),  INT8_C( 109),  INT8_C(   4),  INT8_C(   0),
+        -INT8_C(  48), -INT8_C( 126),  INT8_C(  64), -INT8_C(  50), -INT8_C(   3), -INT8_C(   1), -INT8_C(  65), -INT8_C(   1) },
+      {  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3), -INT8_C(   3),  INT8_C(   4),  INT8_C(   3),  INT8_C(   6),
+         INT8_C(   1),  INT8_C(   2),  INT8_C(   8),  INT8_C(   0),  INT8_C(   4),  INT8_C(  74),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   2), -INT8_C( 118),  INT8_C(   5),  INT8_C(   2), -INT8_C(   3),
+         INT8_C(  71), -INT8_C(  89),  INT8_C(   1),  INT8_C(   5),  INT8_C(   7),  INT8_C(  47),  INT8_C(   7),  INT8_C(   8) } },
+    { {  INT8_C( 114), -INT8_C(  98),  INT8_C( 106), -INT8_C(  33),  INT8_C(  37),  INT8_C( 119), -INT8_C(  17),  INT8_C( 123),
+         INT8_C(  20), -INT8_C(  77), -INT8_C(  76), -INT8_C(  65), -INT8_C(   1),  INT8_C(  53), -INT8_C( 106),  INT8_C(   1),
+        -INT8_C(  65),  INT8_C(  66), -INT8_C(   6),  INT8_C(   0),      INT8_MAX,  INT8_C(  69),  INT8_C(   0),  INT8_C(  64),
+         INT8_C(  78),  INT8_C(   1), -INT8_C(  56), -INT8_C(   1), -INT8_C(  83), -INT8_C(  25), -INT8_C( 127),  INT8_C(   0) },
+      UINT32_C(3027942850),
+      { -INT8_C(   2), -INT8_C(  28), -INT8_C(  94),  INT8_C(  64), -INT8_C(  38), -INT8_C( 124),  INT8_C(   0),  INT8_C(  75),
+        -INT8_C(  18),  INT8_C( 117), -INT8_C(  79), -INT8_C(  60), -INT8_C(  65), -INT8_C(  30), -INT8_C(  86),  INT8_C(  32),
+         INT8_C(  36), -INT8_C(  84),  INT8_C(   0),      INT8_MIN, -INT8_C(  18),  INT8_C(   2), -INT8_C(  41),  INT8_C(  70),
+         INT8_C(  62), -INT8_C( 104), -INT8_C(  67),  INT8_C(  78),  INT8_C(   8),  INT8_C(  76),  INT8_C( 119),  INT8_C(  52) },
+      {  INT8_C( 114),  INT8_C(   4),  INT8_C( 106), -INT8_C(  33),  INT8_C(  37),  INT8_C( 119),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   6), -INT8_C(  77),  INT8_C(   4),  INT8_C(   3),  INT8_C(   7),  INT8_C(   4), -INT8_C( 106),  INT8_C(   1),
+        -INT8_C(  65),  INT8_C(   4), -INT8_C(   6),  INT8_C(   1),  INT8_C(   6),  INT8_C(   1),  INT8_C(   6),  INT8_C(  64),
+         INT8_C(  78),  INT8_C(   1),  INT8_C(   6), -INT8_C(   1),  INT8_C(   1),  INT8_C(   3), -INT8_C( 127),  INT8_C(   3) } },
+    { { -INT8_C(  19),  INT8_C(  99), -INT8_C(  33),  INT8_C(  22),  INT8_C(  82),  INT8_C(  30), -INT8_C( 124), -INT8_C(  32),
+         INT8_C(  90),  INT8_C(  61),  INT8_C(  66),  INT8_C(   0), -INT8_C(  32),  INT8_C( 100),  INT8_C( 103),  INT8_C(  38),
+         INT8_C( 123), -INT8_C(   4),  INT8_C( 112), -INT8_C( 113),  INT8_C( 103),  INT8_C(   8), -INT8_C(  26), -INT8_C(  86),
+         INT8_C(  69), -INT8_C(  73),  INT8_C(  63), -INT8_C(  67),  INT8_C(   8), -INT8_C(  66),  INT8_C(   0), -INT8_C(  22) },
+      UINT32_C(2207900287),
+      {  INT8_C(  33),  INT8_C(  18), -INT8_C(   1),  INT8_C(   0),  INT8_C(   1), -INT8_C(  61),  INT8_C(  64), -INT8_C(  38),
+        -INT8_C( 115),      INT8_MAX, -INT8_C(  95), -INT8_C(  82),  INT8_C(  46),  INT8_C(  95), -INT8_C(  86), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  68),  INT8_C(  24),  INT8_C(   0), -INT8_C(  11),  INT8_C(   0), -INT8_C(  66),
+        -INT8_C(  16),  INT8_C( 123),  INT8_C(  80), -INT8_C(  66), -INT8_C(  90),  INT8_C(  64),  INT8_C(  40), -INT8_C( 116) },
+      {  INT8_C(   2),  INT8_C(   2),  INT8_C(   8),  INT8_C(   0),  INT8_C(   1),  INT8_C(   4),  INT8_C(   1), -INT8_C(  32),
+         INT8_C(  90),  INT8_C(   7),  INT8_C(  66),  INT8_C(   0), -INT8_C(  32),  INT8_C(   6),  INT8_C(   4),  INT8_C(   8),
+         INT8_C(   0), -INT8_C(   4),  INT8_C( 112),  INT8_C(   2),  INT8_C(   0),  INT8_C(   8), -INT8_C(  26),  INT8_C(   6),
+         INT8_C(   4),  INT8_C(   6),  INT8_C(  63), -INT8_C(  67),  INT8_C(   8), -INT8_C(  66),  INT8_C(   0),  INT8_C(   3) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3872284440),
+      {  INT8_C(   0), -INT8_C( 124),  INT8_C(  82), -INT8_C(   1), -INT8_C(   9),  INT8_C(   9), -INT8_C(   2), -INT8_C(  62),
+         INT8_C(  84),  INT8_C(  16),  INT8_C(   4),  INT8_C(  38), -INT8_C(  33),  INT8_C(  40),  INT8_C(  22), -INT8_C(   1),
+        -INT8_C(  52),  INT8_C( 103), -INT8_C(  97),  INT8_C(  55), -INT8_C(  60), -INT8_C(   8),  INT8_C(  91), -INT8_C(  21),
+        -INT8_C(  95), -INT8_C(   1), -INT8_C( 125),      INT8_MAX,  INT8_C(  33),  INT8_C(  36),  INT8_C(  64), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   7),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   6),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   8) } },
+    { UINT32_C(3409830968),
+      {  INT8_C(   0), -INT8_C( 104), -INT8_C(   9), -INT8_C(  17), -INT8_C(   3),  INT8_C(  10),  INT8_C( 121), -INT8_C(  17),
+         INT8_C(   4),  INT8_C(  65), -INT8_C( 124),  INT8_C(  43), -INT8_C(  39), -INT8_C( 114), -INT8_C(  52), -INT8_C(  93),
+         INT8_C(  32), -INT8_C(  12),  INT8_C(  92),  INT8_C(  24),      INT8_MAX, -INT8_C(  19),      INT8_MAX, -INT8_C(  23),
+        -INT8_C(  95),  INT8_C( 119),  INT8_C(   0), -INT8_C(   3),  INT8_C(  31),  INT8_C(  35),  INT8_C(  47), -INT8_C(  74) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   7),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   6),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   5) } },
+    { UINT32_C(2249484516),
+      { -INT8_C(   1),  INT8_C(  17), -INT8_C(  83), -INT8_C(  46),  INT8_C( 114),  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),
+        -INT8_C(  33),  INT8_C(   0), -INT8_C( 110), -INT8_C(   3), -INT8_C(  88),  INT8_C(  32), -INT8_C(  26), -INT8_C(   1),
+        -INT8_C(  57), -INT8_C(   1), -INT8_C(  26), -INT8_C(   2),  INT8_C(  91),  INT8_C(  55),  INT8_C(  35),  INT8_C(   4),
+        -INT8_C(  40), -INT8_C(  96),  INT8_C(  64),  INT8_C(  32), -INT8_C(  98), -INT8_C(   1), -INT8_C(   5), -INT8_C(  60) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   1),  INT8_C(   5),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3) } },
+    { UINT32_C(1984584263),
+      { -INT8_C( 119), -INT8_C( 120),  INT8_C(  86),  INT8_C(   4),  INT8_C( 103),  INT8_C(   0), -INT8_C(  90),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C( 120), -INT8_C(  21), -INT8_C(  82),  INT8_C(  16),  INT8_C(   0),  INT8_C(  32),
+        -INT8_C(   9),  INT8_C(  65),  INT8_C(   4), -INT8_C(  65),  INT8_C( 105),  INT8_C(  71),  INT8_C(  72), -INT8_C(   2),
+        -INT8_C(  17), -INT8_C(  88),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(  83), -INT8_C( 124), -INT8_C(  85) },
+      {  INT8_C(   3),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0) } },
+    { UINT32_C(3877613833),
+      {  INT8_C( 123), -INT8_C(  84), -INT8_C( 104),  INT8_C(  90),  INT8_C(  93), -INT8_C(  66), -INT8_C(   1), -INT8_C(  50),
+         INT8_C(  64),  INT8_C(  53),  INT8_C(   0),  INT8_C(  43), -INT8_C(  95),  INT8_C(  33),  INT8_C(  57), -INT8_C( 117),
+         INT8_C(  14),  INT8_C(   8),  INT8_C(  64), -INT8_C(  33), -INT8_C( 120), -INT8_C(   1),  INT8_C(  29),  INT8_C(  80),
+         INT8_C(  70),  INT8_C(  95), -INT8_C(  66),  INT8_C( 101), -INT8_C( 122),  INT8_C(  22),  INT8_C(  16),  INT8_C(   0) },
+      {  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   7),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   6),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0) } },
+    { UINT32_C(1137151417),
+      {  INT8_C(  90),  INT8_C(  35),  INT8_C(  70), -INT8_C(  20), -INT8_C(   1), -INT8_C(  82),  INT8_C(   4), -INT8_C( 114),
+        -INT8_C(  13), -INT8_C( 117),  INT8_C(   0), -INT8_C(  32), -INT8_C(  28),  INT8_C(   8),  INT8_C(  57),  INT8_C(  14),
+         INT8_C(  97), -INT8_C(  13), -INT8_C(  55),  INT8_C(  33),  INT8_C(  55), -INT8_C(  40), -INT8_C(  19), -INT8_C(  59),
+             INT8_MIN, -INT8_C(  81),  INT8_C(  15), -INT8_C(   8), -INT8_C( 116),  INT8_C(  12),  INT8_C(  64),  INT8_C(   0) },
+      {  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   8),  INT8_C(   5),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0) } },
+    { UINT32_C( 478171494),
+      {  INT8_C(  18), -INT8_C(   1),  INT8_C(  46),  INT8_C( 112), -INT8_C(  65),  INT8_C(   0), -INT8_C( 106), -INT8_C(   1),
+         INT8_C(   5),  INT8_C(   6), -INT8_C(   1),  INT8_C(   8), -INT8_C( 123), -INT8_C(  18),  INT8_C(   9), -INT8_C(   2),
+         INT8_C(  68), -INT8_C(   3), -INT8_C(  15), -INT8_C(  57),  INT8_C(  87),  INT8_C(  14),  INT8_C(  85), -INT8_C(  33),
+        -INT8_C(   9),  INT8_C(  80),  INT8_C(   2), -INT8_C(   1),  INT8_C( 122),  INT8_C( 108), -INT8_C(  63), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   8),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3032456361),
+      { -INT8_C(   4),  INT8_C(  80),  INT8_C(  48),  INT8_C(   0),  INT8_C(  86), -INT8_C(  31),  INT8_C(  37), -INT8_C(  50),
+         INT8_C(  85), -INT8_C(  16),  INT8_C(  66), -INT8_C(  93),  INT8_C(  64), -INT8_C(   1), -INT8_C(   1),      INT8_MIN,
+        -INT8_C(  33), -INT8_C(  94),  INT8_C(  33), -INT8_C(   1), -INT8_C(  33), -INT8_C( 107),      INT8_MIN,  INT8_C(   4),
+        -INT8_C(   1), -INT8_C( 101),  INT8_C(   4), -INT8_C(   9), -INT8_C(  95),  INT8_C( 119), -INT8_C(  33), -INT8_C(   1) },
+      {  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   7),  INT8_C(   3),  INT8_C(   2),  INT8_C(   8),  INT8_C(   7),  INT8_C(   4),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(   6),  INT8_C(   0),  INT8_C(   8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C(     0),  INT16_C( 19439), -INT16_C( 18798),  INT16_C( 32367),  INT16_C( 16641),  INT16_C(  1056), -INT16_C(   205), -INT16_C( 15369),
+         INT16_C( 22007), -INT16_C( 16385), -INT16_C(  8453),  INT16_C( 32763),  INT16_C(    32),  INT16_C(  2048),  INT16_C( 16384), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(    11),  INT16_C(     8),  INT16_C(    12),  INT16_C(     3),  INT16_C(     2),  INT16_C(    12),  INT16_C(    11),
+         INT16_C(    11),  INT16_C(    15),  INT16_C(    13),  INT16_C(    14),  INT16_C(     1),  INT16_C(     1),  INT16_C(     1),  INT16_C(    16) } },
+    { { -INT16_C(  9191),  INT16_C(  2142),  INT16_C(  7067), -INT16_C(  2159), -INT16_C( 17905),  INT16_C( 24994),  INT16_C( 18697), -INT16_C( 11276),
+        -INT16_C(  3058), -INT16_C( 23953), -INT16_C( 23270),  INT16_C(  8072), -INT16_C(  8124),  INT16_C( 27908),  INT16_C(     0), -INT16_C( 32704) },
+      {  INT16_C(     8),  INT16_C(     6),  INT16_C(     9),  INT16_C(    10),  INT16_C(     9),  INT16_C(     6),  INT16_C(     5),  INT16_C(    10),
+         INT16_C(     8),  INT16_C(     9),  INT16_C(     7),  INT16_C(     7),  INT16_C(     5),  INT16_C(     6),  INT16_C(     0),  INT16_C(     2) } },
+    { { -INT16_C(  2049),  INT16_C( 27110), -INT16_C( 10674), -INT16_C( 13705), -INT16_C( 32762), -INT16_C(  9071), -INT16_C(  5459),  INT16_C(  8193),
+         INT16_C( 15322), -INT16_C(    33),  INT16_C(  8259), -INT16_C(  8385), -INT16_C( 32510), -INT16_C(  4944), -INT16_C(  1153),  INT16_C(     0) },
+      {  INT16_C(    15),  INT16_C(     9),  INT16_C(     9),  INT16_C(    10),  INT16_C(     3),  INT16_C(     8),  INT16_C(    10),  INT16_C(     2),
+         INT16_C(    10),  INT16_C(    15),  INT16_C(     4),  INT16_C(    13),  INT16_C(     3),  INT16_C(     8),  INT16_C(    14),  INT16_C(     0) } },
+    { {  INT16_C(     1), -INT16_C( 16393), -INT16_C( 18461), -INT16_C(    65),  INT16_C(   768), -INT16_C( 32036),  INT16_C( 10171),  INT16_C( 16512),
+        -INT16_C(  4097), -INT16_C( 22799),  INT16_C(  9216), -INT16_C(   129),  INT16_C(  9232), -INT16_C(  6054), -INT16_C(  9170),  INT16_C( 18560) },
+      {  INT16_C(     1),  INT16_C(    14),  INT16_C(    11),  INT16_C(    15),  INT16_C(     2),  INT16_C(     7),  INT16_C(    10),  INT16_C(     2),
+         INT16_C(    15),  INT16_C(     9),  INT16_C(     2),  INT16_C(    15),  INT16_C(     3),  INT16_C(     8),  INT16_C(     9),  INT16_C(     3) } },
+    { {  INT16_C(  8201), -INT16_C(     1),  INT16_C( 14995),  INT16_C( 12255),  INT16_C(  6385), -INT16_C(  6209),  INT16_C(   128),  INT16_C( 24591),
+         INT16_C(  2928),  INT16_C( 16385),  INT16_C(  2068),  INT16_C( 16400), -INT16_C( 24372),  INT16_C(     0),  INT16_C(    32),  INT16_C( 29318) },
+      {  INT16_C(     3),  INT16_C(    16),  INT16_C(     8),  INT16_C(    12),  INT16_C(     7),  INT16_C(    13),  INT16_C(     1),  INT16_C(     6),
+         INT16_C(     6),  INT16_C(     2),  INT16_C(     3),  INT16_C(     2),  INT16_C(     6),  INT16_C(     0),  INT16_C(     1),  INT16_C(     7) } },
+    { { -INT16_C( 16389), -INT16_C(   273),  INT16_C( 18421),  INT16_C(  6824), -INT16_C(  7941),  INT16_C( 27744), -INT16_C(    17),  INT16_C( 22828),
+         INT16_C( 14646),  INT16_C(  4160), -INT16_C(  4097), -INT16_C( 30229), -INT16_C(  8205),  INT16_C(     0), -INT16_C( 30442),  INT16_C( 11463) },
+      {  INT16_C(    14),  INT16_C(    14),  INT16_C(    10),  INT16_C(     6),  INT16_C(    10),  INT16_C(     6),  INT16_C(    15),  INT16_C(     7),
+         INT16_C(     8),  INT16_C(     2),  INT16_C(    15),  INT16_C(     9),  INT16_C(    13),  INT16_C(     0),  INT16_C(     6),  INT16_C(     8) } },
+    { { -INT16_C( 24578), -INT16_C(  3957), -INT16_C(  7809), -INT16_C( 11960), -INT16_C( 26559),  INT16_C(  3836),  INT16_C(     0), -INT16_C(  4097),
+         INT16_C( 16484), -INT16_C( 25165), -INT16_C(   193), -INT16_C(    17), -INT16_C(     1), -INT16_C( 32728), -INT16_C(    17), -INT16_C(  1808) },
+      {  INT16_C(    13),  INT16_C(     8),  INT16_C(    11),  INT16_C(     6),  INT16_C(     5),  INT16_C(     9),  INT16_C(     0),  INT16_C(    15),
+         INT16_C(     4),  INT16_C(    10),  INT16_C(    14),  INT16_C(    15),  INT16_C(    16),  INT16_C(     3),  INT16_C(    15),  INT16_C(     9) } },
+    { { -INT16_C( 21542),  INT16_C(   729),  INT16_C( 16448), -INT16_C(    98), -INT16_C(     1), -INT16_C( 13160),  INT16_C(     4),  INT16_C(  8200),
+         INT16_C( 16384),  INT16_C( 16379),  INT16_C(    18),  INT16_C( 30120),  INT16_C(   544), -INT16_C(  4354), -INT16_C( 19694), -INT16_C(     1) },
+      {  INT16_C(    10),  INT16_C(     6),  INT16_C(     2),  INT16_C(    13),  INT16_C(    16),  INT16_C(     7),  INT16_C(     1),  INT16_C(     2),
+         INT16_C(     1),  INT16_C(    13),  INT16_C(     2),  INT16_C(     8),  INT16_C(     2),  INT16_C(    13),  INT16_C(     7),  INT16_C(    16) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi16(a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { -INT16_C( 14259),  INT16_C( 17178), -INT16_C(  9883), -INT16_C(     1), -INT16_C(    65),       INT16_MIN,  INT16_C(  1024), -INT16_C( 25555),
+        -INT16_C( 31620), -INT16_C( 22763),  INT16_C( 25365),  INT16_C( 27866), -INT16_C( 26174), -INT16_C(     1),  INT16_C(     0),  INT16_C( 31707) },
+      UINT16_C(41577),
+      {  INT16_C(     0), -INT16_C( 29524), -INT16_C(   129), -INT16_C( 26467),  INT16_C(   399), -INT16_C(   131), -INT16_C(   129),  INT16_C(  9019),
+        -INT16_C(  2520),  INT16_C( 21444),  INT16_C(     0),  INT16_C( 16037), -INT16_C(  6224),  INT16_C(  8193),  INT16_C( 30431), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C( 17178), -INT16_C(  9883),  INT16_C(     8), -INT16_C(    65),  INT16_C(    14),  INT16_C(    15), -INT16_C( 25555),
+        -INT16_C( 31620),  INT16_C(     7),  INT16_C( 25365),  INT16_C( 27866), -INT16_C( 26174),  INT16_C(     2),  INT16_C(     0),  INT16_C(    16) } },
+    { { -INT16_C(  6342),  INT16_C(   768),  INT16_C( 18105),  INT16_C(    64), -INT16_C(     1),  INT16_C(   516), -INT16_C( 31655),  INT16_C( 28687),
+         INT16_C(   257), -INT16_C(    62),  INT16_C( 24575), -INT16_C(   769),  INT16_C( 21918), -INT16_C(  2793), -INT16_C( 14469), -INT16_C(     1) },
+      UINT16_C(38456),
+      { -INT16_C(  8311), -INT16_C( 10231), -INT16_C(   546),  INT16_C(  1024),  INT16_C( 11171),  INT16_C( 17257),  INT16_C(    96),  INT16_C(  8256),
+        -INT16_C(   261), -INT16_C(  8193), -INT16_C(  6456),  INT16_C( 14125), -INT16_C(  2065), -INT16_C(  1930), -INT16_C( 32373),  INT16_C( 10752) },
+      { -INT16_C(  6342),  INT16_C(   768),  INT16_C( 18105),  INT16_C(     1),  INT16_C(     8),  INT16_C(     7), -INT16_C( 31655),  INT16_C( 28687),
+         INT16_C(   257),  INT16_C(    15),  INT16_C(     8), -INT16_C(   769),  INT16_C(    14), -INT16_C(  2793), -INT16_C( 14469),  INT16_C(     3) } },
+    { {  INT16_C(   512),  INT16_C(   837), -INT16_C(   513), -INT16_C(     1), -INT16_C(     5), -INT16_C(  5444), -INT16_C(     3), -INT16_C(     1),
+        -INT16_C( 22387), -INT16_C(  7490), -INT16_C(  4750),  INT16_C( 28127), -INT16_C( 16385), -INT16_C( 16956), -INT16_C(  2306),  INT16_C( 26961) },
+      UINT16_C(31922),
+      {  INT16_C(  6207), -INT16_C(     1), -INT16_C(   133), -INT16_C( 12305),  INT16_C( 24704),  INT16_C( 32387),  INT16_C( 22528),  INT16_C(  4096),
+         INT16_C( 19777), -INT16_C(   587),  INT16_C(   654), -INT16_C( 16393),  INT16_C(  1797),  INT16_C(     1), -INT16_C(  1041), -INT16_C(     1) },
+      {  INT16_C(   512),  INT16_C(    16), -INT16_C(   513), -INT16_C(     1),  INT16_C(     3),  INT16_C(     9), -INT16_C(     3),  INT16_C(     1),
+        -INT16_C( 22387), -INT16_C(  7490),  INT16_C(     5),  INT16_C(    14),  INT16_C(     5),  INT16_C(     1),  INT16_C(    14),  INT16_C( 26961) } },
+    { {  INT16_C(     8),  INT16_C(     0),  INT16_C( 32735),  INT16_C(   276), -INT16_C( 14303), -INT16_C( 31507), -INT16_C( 18995), -INT16_C(    25),
+         INT16_C( 15242), -INT16_C(  8199), -INT16_C(     2),  INT16_C(  4378), -INT16_C(   105),  INT16_C(  4132),  INT16_C(  5875),  INT16_C( 29115) },
+      UINT16_C( 1441),
+      { -INT16_C( 26183),  INT16_C( 26952),  INT16_C(  7775), -INT16_C(  3487),  INT16_C(     0), -INT16_C( 30516), -INT16_C(    65), -INT16_C( 11969),
+        -INT16_C(  2049),  INT16_C(  2184),  INT16_C(  2049),  INT16_C( 19954),  INT16_C( 14208), -INT16_C( 29466),  INT16_C( 11714),  INT16_C(  8321) },
+      {  INT16_C(     9),  INT16_C(     0),  INT16_C( 32735),  INT16_C(   276), -INT16_C( 14303),  INT16_C(     6), -INT16_C( 18995),  INT16_C(    10),
+         INT16_C(    15), -INT16_C(  8199),  INT16_C(     2),  INT16_C(  4378), -INT16_C(   105),  INT16_C(  4132),  INT16_C(  5875),  INT16_C( 29115) } },
+    { { -INT16_C( 24491),  INT16_C(  2576), -INT16_C( 23752),  INT16_C(     0),  INT16_C( 20561),  INT16_C(  1024), -INT16_C(   257), -INT16_C( 19282),
+         INT16_C( 19953),  INT16_C( 32255), -INT16_C(  9217),  INT16_C( 23044),  INT16_C(     1), -INT16_C(  1642), -INT16_C(  4332), -INT16_C( 28742) },
+      UINT16_C(53919),
+      {  INT16_C(  2486),  INT16_C( 15817), -INT16_C(  4097),  INT16_C(  6688), -INT16_C( 21662), -INT16_C( 22284),  INT16_C(   256),  INT16_C(   256),
+        -INT16_C( 19713),  INT16_C(  4136),  INT16_C(  2560), -INT16_C(  5543), -INT16_C(   519), -INT16_C(  9366),  INT16_C( 24704), -INT16_C(  6149) },
+      {  INT16_C(     7),  INT16_C(     9),  INT16_C(    15),  INT16_C(     4),  INT16_C(     8),  INT16_C(  1024), -INT16_C(   257),  INT16_C(     1),
+         INT16_C( 19953),  INT16_C(     3), -INT16_C(  9217),  INT16_C( 23044),  INT16_C(    13), -INT16_C(  1642),  INT16_C(     3),  INT16_C(    13) } },
+    { { -INT16_C( 18685),  INT16_C(  1024), -INT16_C(    19),  INT16_C(  8448), -INT16_C( 19855),  INT16_C(   256),  INT16_C( 32081),  INT16_C(   256),
+         INT16_C(     0),  INT16_C( 14299),  INT16_C(  1025), -INT16_C( 23239),  INT16_C(  4096), -INT16_C( 18296), -INT16_C(   521), -INT16_C( 20112) },
+      UINT16_C(49367),
+      {  INT16_C( 16400),  INT16_C(  6758), -INT16_C( 17687), -INT16_C(  1089), -INT16_C( 20114),  INT16_C(  1929), -INT16_C( 27467),  INT16_C(  1040),
+        -INT16_C( 21725),  INT16_C( 30408), -INT16_C(   513),  INT16_C(   696), -INT16_C(   129), -INT16_C( 11408), -INT16_C(   704),  INT16_C( 14328) },
+      {  INT16_C(     2),  INT16_C(     7),  INT16_C(    10),  INT16_C(  8448),  INT16_C(     9),  INT16_C(   256),  INT16_C(     8),  INT16_C(     2),
+         INT16_C(     0),  INT16_C( 14299),  INT16_C(  1025), -INT16_C( 23239),  INT16_C(  4096), -INT16_C( 18296),  INT16_C(     8),  INT16_C(    10) } },
+    { {  INT16_C( 19195),  INT16_C( 18432),  INT16_C( 19881), -INT16_C(    66), -INT16_C(  4098),  INT16_C(     0), -INT16_C(   901), -INT16_C(  2053),
+         INT16_C(  5257),  INT16_C( 13384),  INT16_C( 30719),  INT16_C(  2320), -INT16_C( 20481), -INT16_C(  4097),  INT16_C(  6144),  INT16_C(  1090) },
+      UINT16_C(50361),
+      { -INT16_C(  5497), -INT16_C(    21),  INT16_C(    12), -INT16_C( 12493), -INT16_C(  3012),  INT16_C( 26065), -INT16_C( 27950), -INT16_C(   534),
+        -INT16_C(  6111), -INT16_C(   521), -INT16_C( 16930), -INT16_C( 28340), -INT16_C( 17066),  INT16_C( 30974),  INT16_C(  7307),  INT16_C( 19607) },
+      {  INT16_C(     9),  INT16_C( 18432),  INT16_C( 19881),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8), -INT16_C(   901),  INT16_C(    12),
+         INT16_C(  5257),  INT16_C( 13384),  INT16_C(    12),  INT16_C(  2320), -INT16_C( 20481), -INT16_C(  4097),  INT16_C(     7),  INT16_C(     8) } },
+    { { -INT16_C( 23433), -INT16_C( 25200),  INT16_C(  5760),  INT16_C( 29050), -INT16_C( 24849),  INT16_C(  6208),  INT16_C( 13615),       INT16_MAX,
+        -INT16_C( 20536),  INT16_C( 20481),  INT16_C(   520), -INT16_C( 18878),  INT16_C( 11326), -INT16_C( 18433), -INT16_C(  6785),  INT16_C(    20) },
+      UINT16_C( 9338),
+      { -INT16_C(  3883), -INT16_C( 11760),  INT16_C( 26937),  INT16_C( 30586),  INT16_C(  4096),  INT16_C( 15668), -INT16_C( 32240),  INT16_C(  8192),
+        -INT16_C( 12632), -INT16_C( 18369),  INT16_C( 28190), -INT16_C(  5208),  INT16_C( 19659), -INT16_C(     3), -INT16_C(   145), -INT16_C( 16927) },
+      { -INT16_C( 23433),  INT16_C(     5),  INT16_C(  5760),  INT16_C(    11),  INT16_C(     1),  INT16_C(     8),  INT16_C(     3),       INT16_MAX,
+        -INT16_C( 20536),  INT16_C( 20481),  INT16_C(     9), -INT16_C( 18878),  INT16_C( 11326),  INT16_C(    15), -INT16_C(  6785),  INT16_C(    20) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(28231),
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     5),  INT16_C(  2092), -INT16_C(  1057), -INT16_C(  8209),       INT16_MIN, -INT16_C( 12675),
+        -INT16_C( 23442),  INT16_C( 30313),  INT16_C( 29731), -INT16_C(   258),  INT16_C( 29215), -INT16_C( 11280),  INT16_C( 19117), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     9),  INT16_C(     7),  INT16_C(    14),  INT16_C(     0),  INT16_C(     9),  INT16_C(     8),  INT16_C(     0) } },
+    { UINT16_C(37485),
+      { -INT16_C( 24680),  INT16_C(  1136),  INT16_C( 29327),  INT16_C(  3088),  INT16_C( 14197), -INT16_C(  7016), -INT16_C(   282), -INT16_C( 26242),
+         INT16_C( 28591), -INT16_C(    65), -INT16_C(  2049), -INT16_C(     3),  INT16_C( 32766),  INT16_C(  3505), -INT16_C(     1),  INT16_C( 10207) },
+      {  INT16_C(     9),  INT16_C(     0),  INT16_C(     9),  INT16_C(     3),  INT16_C(     0),  INT16_C(     7),  INT16_C(    12),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(     0),  INT16_C(     0),  INT16_C(    11) } },
+    { UINT16_C(62926),
+      { -INT16_C( 28988), -INT16_C( 18129),  INT16_C(  8368),  INT16_C(     0), -INT16_C( 19415), -INT16_C( 12346), -INT16_C( 14596), -INT16_C(  2062),
+        -INT16_C(  2456), -INT16_C( 17475), -INT16_C(  3981), -INT16_C(  5280), -INT16_C(  8201),  INT16_C( 23382),  INT16_C( 26357), -INT16_C( 32640) },
+      {  INT16_C(     0),  INT16_C(    10),  INT16_C(     4),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    10),  INT16_C(    12),
+         INT16_C(     9),  INT16_C(     0),  INT16_C(     9),  INT16_C(     0),  INT16_C(    14),  INT16_C(     9),  INT16_C(    10),  INT16_C(     2) } },
+    { UINT16_C(51097),
+      {  INT16_C( 12776), -INT16_C( 23402),  INT16_C( 15361),  INT16_C(  9608),  INT16_C( 14630),  INT16_C( 19671),  INT16_C(  2049),  INT16_C( 12800),
+        -INT16_C( 21106),  INT16_C(  8893), -INT16_C( 20996), -INT16_C(   133), -INT16_C(    33), -INT16_C( 31117),  INT16_C( 28673),  INT16_C( 28170) },
+      {  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     5),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),
+         INT16_C(     9),  INT16_C(     8),  INT16_C(    11),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     4),  INT16_C(     7) } },
+    { UINT16_C(15177),
+      {  INT16_C(  6836), -INT16_C( 21382), -INT16_C(     1),  INT16_C(  5458),  INT16_C( 23241),  INT16_C(    64), -INT16_C(   133), -INT16_C( 18704),
+        -INT16_C(  2576), -INT16_C(     5),  INT16_C( 30944),  INT16_C(    40),  INT16_C(  8913), -INT16_C(  2563),  INT16_C(    65), -INT16_C( 16256) },
+      {  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(     0),
+         INT16_C(    10),  INT16_C(    15),  INT16_C(     0),  INT16_C(     2),  INT16_C(     6),  INT16_C(    13),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(25673),
+      { -INT16_C( 29931),  INT16_C(  5978), -INT16_C(  8737), -INT16_C( 16385),  INT16_C(   288),  INT16_C( 32765), -INT16_C( 30625),  INT16_C( 32720),
+         INT16_C(  3615), -INT16_C( 16929), -INT16_C(  8225), -INT16_C( 19959),  INT16_C(    16), -INT16_C( 16641), -INT16_C(   265), -INT16_C( 16897) },
+      {  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(    14),  INT16_C(     0) } },
+    { UINT16_C(47690),
+      {  INT16_C(  4292), -INT16_C(   385), -INT16_C(    82),  INT16_C( 23559), -INT16_C(   265), -INT16_C(  5360),  INT16_C(  2048),  INT16_C(   512),
+        -INT16_C( 30470), -INT16_C(     1), -INT16_C( 30464),  INT16_C(    32), -INT16_C( 21359),  INT16_C( 26665), -INT16_C(  3573), -INT16_C(   129) },
+      {  INT16_C(     0),  INT16_C(    14),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(     1),  INT16_C(     7),  INT16_C(     6),  INT16_C(     0),  INT16_C(    15) } },
+    { UINT16_C(27530),
+      { -INT16_C( 23334),  INT16_C(   781), -INT16_C(   385), -INT16_C( 32736), -INT16_C(     1),  INT16_C( 32313),  INT16_C( 11503),  INT16_C(    41),
+        -INT16_C(    50), -INT16_C(  4773),  INT16_C(     2), -INT16_C(  6529), -INT16_C(  1029),  INT16_C( 28295), -INT16_C(  4814),  INT16_C( 21608) },
+      {  INT16_C(     0),  INT16_C(     5),  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),
+         INT16_C(    13),  INT16_C(    11),  INT16_C(     0),  INT16_C(    12),  INT16_C(     0),  INT16_C(     9),  INT16_C(     9),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(  1158414608), -INT32_C(   514830693),  INT32_C(  2113396703), -INT32_C(  1610629121), -INT32_C(    67240001), -INT32_C(   839122330), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           7),  INT32_C(          15),  INT32_C(          27),  INT32_C(          29),  INT32_C(          29),  INT32_C(          16),  INT32_C(          32) } },
+    { { -INT32_C(   134373889), -INT32_C(  1715904493),  INT32_C(   268451872), -INT32_C(  1528219891),  INT32_C(  2112400679), -INT32_C(   340155352),  INT32_C(  2129624575),  INT32_C(  2076709536) },
+      {  INT32_C(          27),  INT32_C(          14),  INT32_C(           3),  INT32_C(          16),  INT32_C(          19),  INT32_C(          16),  INT32_C(          27),  INT32_C(          13) } },
+    { { -INT32_C(   167772161),  INT32_C(  1073741824),  INT32_C(  1073741953),  INT32_C(  2145450235), -INT32_C(   277932800),  INT32_C(  1378216761), -INT32_C(  2004811696),  INT32_C(  1088872255) },
+      {  INT32_C(          30),  INT32_C(           1),  INT32_C(           3),  INT32_C(          22),  INT32_C(          16),  INT32_C(          16),  INT32_C(           6),  INT32_C(          19) } },
+    { {  INT32_C(   450200058),  INT32_C(    71827456),  INT32_C(       16432),  INT32_C(   538181640), -INT32_C(     2228481), -INT32_C(  1528088231), -INT32_C(     9061123), -INT32_C(    12615713) },
+      {  INT32_C(          16),  INT32_C(           3),  INT32_C(           3),  INT32_C(           4),  INT32_C(          29),  INT32_C(          17),  INT32_C(          25),  INT32_C(          28) } },
+    { { -INT32_C(    33570913),  INT32_C(    31961703), -INT32_C(   746769237),  INT32_C(   570425632), -INT32_C(      528929), -INT32_C(   344741157), -INT32_C(  1462489309), -INT32_C(   603979777) },
+      {  INT32_C(          28),  INT32_C(          16),  INT32_C(          19),  INT32_C(           4),  INT32_C(          28),  INT32_C(          21),  INT32_C(          15),  INT32_C(          30) } },
+    { { -INT32_C(  1395954453),  INT32_C(   134218256), -INT32_C(    21185412),  INT32_C(   545525792), -INT32_C(  1868554240), -INT32_C(      526466),  INT32_C(           1),  INT32_C(  1107353638) },
+      {  INT32_C(          19),  INT32_C(           3),  INT32_C(          22),  INT32_C(           5),  INT32_C(           5),  INT32_C(          28),  INT32_C(           1),  INT32_C(           8) } },
+    { { -INT32_C(  1210089476), -INT32_C(    43016193),  INT32_C(  1610577919), -INT32_C(   293601281), -INT32_C(   134251521),  INT32_C(   444596232), -INT32_C(   270008321), -INT32_C(   276894082) },
+      {  INT32_C(          26),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29),  INT32_C(          29),  INT32_C(           5),  INT32_C(          29),  INT32_C(          25) } },
+    { {  INT32_C(   337690770), -INT32_C(  1610875043), -INT32_C(   181792109),  INT32_C(  1311463819), -INT32_C(    86800988),  INT32_C(  1354475029), -INT32_C(   250729008), -INT32_C(        1025) },
+      {  INT32_C(           8),  INT32_C(          26),  INT32_C(          15),  INT32_C(          16),  INT32_C(          17),  INT32_C(          15),  INT32_C(          15),  INT32_C(          31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(      262912),  INT32_C(    12582912), -INT32_C(       65537), -INT32_C(          42),  INT32_C(  1218934992),  INT32_C(   138428928),  INT32_C(   915851119),  INT32_C(       81936) },
+      UINT8_C(181),
+      {  INT32_C(           0), -INT32_C(  2147274752), -INT32_C(  2074292985),  INT32_C(   271683266),  INT32_C(   558846342),  INT32_C(      352277), -INT32_C(   270794891), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(    12582912),  INT32_C(          14), -INT32_C(          42),  INT32_C(          13),  INT32_C(           7),  INT32_C(   915851119),  INT32_C(          32) } },
+    { { -INT32_C(  1063778446),  INT32_C(  1086600746),  INT32_C(    33554456),  INT32_C(     6422528), -INT32_C(     9470017),  INT32_C(  1195193123),  INT32_C(   927477622),  INT32_C(    99827451) },
+      UINT8_C(243),
+      {  INT32_C(  1306241293),  INT32_C(        2058),  INT32_C(  2147347422), -INT32_C(    76979627), -INT32_C(   807418447),  INT32_C(  2078100055),  INT32_C(      525314), -INT32_C(  1430851476) },
+      {  INT32_C(          17),  INT32_C(           3),  INT32_C(    33554456),  INT32_C(     6422528),  INT32_C(          21),  INT32_C(          20),  INT32_C(           3),  INT32_C(          17) } },
+    { { -INT32_C(      528450), -INT32_C(     2621441), -INT32_C(  2130697712),  INT32_C(   484925597),  INT32_C(   578818120),  INT32_C(          32), -INT32_C(  1073744897),  INT32_C(  1766860628) },
+      UINT8_C(216),
+      { -INT32_C(    41951233),  INT32_C(  1524968240), -INT32_C(   536969217), -INT32_C(   455589933), -INT32_C(  1394971120),  INT32_C(    84018689), -INT32_C(    67109891), -INT32_C(       49410) },
+      { -INT32_C(      528450), -INT32_C(     2621441), -INT32_C(  2130697712),  INT32_C(          19),  INT32_C(          15),  INT32_C(          32),  INT32_C(          29),  INT32_C(          28) } },
+    { {  INT32_C(   806625314), -INT32_C(  1937275589),  INT32_C(  2146435071),  INT32_C(   849153743), -INT32_C(       82001), -INT32_C(  1455892172), -INT32_C(     1318918), -INT32_C(   129569794) },
+      UINT8_C(200),
+      { -INT32_C(     4194313), -INT32_C(    38376697),  INT32_C(  2016967023), -INT32_C(   812389516),  INT32_C(   117440514),  INT32_C(  2016146554),  INT32_C(  2020286744),  INT32_C(     4194368) },
+      {  INT32_C(   806625314), -INT32_C(  1937275589),  INT32_C(  2146435071),  INT32_C(          20), -INT32_C(       82001), -INT32_C(  1455892172),  INT32_C(          13),  INT32_C(           2) } },
+    { {  INT32_C(   702706583), -INT32_C(  2146433022), -INT32_C(  1478819766),  INT32_C(  1844290873), -INT32_C(   388815818),  INT32_C(  1073742848), -INT32_C(   739803442), -INT32_C(  1073708535) },
+      UINT8_C(182),
+      { -INT32_C(   268435714),  INT32_C(   891128527),  INT32_C(   993661730), -INT32_C(   335556610),  INT32_C(  1614799108),  INT32_C(  1246378746), -INT32_C(  2045631188),  INT32_C(    33554688) },
+      {  INT32_C(   702706583),  INT32_C(          17),  INT32_C(          14),  INT32_C(  1844290873),  INT32_C(          13),  INT32_C(          16), -INT32_C(   739803442),  INT32_C(           2) } },
+    { { -INT32_C(   171966465), -INT32_C(  1486895425),  INT32_C(    68452488), -INT32_C(  2147483608),  INT32_C(     8388739), -INT32_C(  1464274044), -INT32_C(  1340652880),  INT32_C(   269119488) },
+      UINT8_C(246),
+      {  INT32_C(  1359417708),  INT32_C(  2139094207),  INT32_C(   438669787), -INT32_C(        9218),  INT32_C(   270532608),  INT32_C(  1978902139),  INT32_C(  1952007908), -INT32_C(    67108867) },
+      { -INT32_C(   171966465),  INT32_C(          27),  INT32_C(          15), -INT32_C(  2147483608),  INT32_C(           2),  INT32_C(          21),  INT32_C(          15),  INT32_C(          30) } },
+    { { -INT32_C(  2136966368), -INT32_C(  1274125926), -INT32_C(   837214670),  INT32_C(  1953650813),  INT32_C(  1365861117), -INT32_C(  1420849194), -INT32_C(      557057),  INT32_C(  1236400490) },
+      UINT8_C( 79),
+      { -INT32_C(   712036313), -INT32_C(   301990425), -INT32_C(   836176938),  INT32_C(   268476420),  INT32_C(    25430020),  INT32_C(          13), -INT32_C(   428081201), -INT32_C(   304087041) },
+      {  INT32_C(          16),  INT32_C(          27),  INT32_C(          18),  INT32_C(           4),  INT32_C(  1365861117), -INT32_C(  1420849194),  INT32_C(          25),  INT32_C(  1236400490) } },
+    { { -INT32_C(     3751937), -INT32_C(   259987962), -INT32_C(   268436486),  INT32_C(  1487960649),  INT32_C(          66), -INT32_C(       32899),  INT32_C(  2113396599),  INT32_C(   447339245) },
+      UINT8_C(177),
+      {  INT32_C(  1656623625), -INT32_C(  2047391815),  INT32_C(   605095936),  INT32_C(  1313636156), -INT32_C(    44044809), -INT32_C(    92798986), -INT32_C(   233790816), -INT32_C(  1615146384) },
+      {  INT32_C(          13), -INT32_C(   259987962), -INT32_C(   268436486),  INT32_C(  1487960649),  INT32_C(          26),  INT32_C(          26),  INT32_C(  2113396599),  INT32_C(          18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT32_C(           0),  INT32_C(   882926851), -INT32_C(   337772545),  INT32_C(   134283330), -INT32_C(   884019835),  INT32_C(    34603040),  INT32_C(  1645310545), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(          11),  INT32_C(          28),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(237),
+      {  INT32_C(  1416267082), -INT32_C(  1711453934), -INT32_C(  1073746500),  INT32_C(  1737922932), -INT32_C(  2146950144),  INT32_C(    17891328),  INT32_C(   268960788), -INT32_C(   676331521) },
+      {  INT32_C(          13),  INT32_C(           0),  INT32_C(          26),  INT32_C(          17),  INT32_C(           0),  INT32_C(           3),  INT32_C(           5),  INT32_C(          28) } },
+    { UINT8_C(106),
+      {  INT32_C(  2132457880), -INT32_C(  1889916216), -INT32_C(       50177),  INT32_C(   302833647),  INT32_C(   841393110), -INT32_C(     1048706), -INT32_C(  2108617579), -INT32_C(   124407680) },
+      {  INT32_C(           0),  INT32_C(          15),  INT32_C(           0),  INT32_C(          18),  INT32_C(           0),  INT32_C(          29),  INT32_C(          11),  INT32_C(           0) } },
+    { UINT8_C(  0),
+      { -INT32_C(  1297700684),  INT32_C(  2147216383), -INT32_C(    67109377),  INT32_C(  1867392987), -INT32_C(   135004193),  INT32_C(  2147483645), -INT32_C(  1746439014),  INT32_C(   656580488) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(167),
+      {  INT32_C(  1855781929),  INT32_C(    17039377), -INT32_C(   688237362),  INT32_C(  1875771391),  INT32_C(      278528),  INT32_C(   536871973), -INT32_C(  2147221432), -INT32_C(  1888999028) },
+      {  INT32_C(          18),  INT32_C(           4),  INT32_C(          19),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5),  INT32_C(           0),  INT32_C(          14) } },
+    { UINT8_C(164),
+      { -INT32_C(   100737654), -INT32_C(     1735295), -INT32_C(    17875457),  INT32_C(  1461162801), -INT32_C(   202108356), -INT32_C(     4194310), -INT32_C(      262689),  INT32_C(     8388609) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          27),  INT32_C(           0),  INT32_C(           0),  INT32_C(          29),  INT32_C(           0),  INT32_C(           2) } },
+    { UINT8_C( 88),
+      { -INT32_C(   138370074), -INT32_C(  1653362208),  INT32_C(     1081360),  INT32_C(  1219832706),  INT32_C(  2078146542), -INT32_C(    75515908),  INT32_C(    25168912),  INT32_C(  1952014523) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          13),  INT32_C(          26),  INT32_C(           0),  INT32_C(           5),  INT32_C(           0) } },
+    { UINT8_C(221),
+      {  INT32_C(   420528460), -INT32_C(   736262325), -INT32_C(  2113273728), -INT32_C(  2009846069), -INT32_C(   269484033),  INT32_C(   205239144),  INT32_C(  1329315941),  INT32_C(   536870912) },
+      {  INT32_C(          10),  INT32_C(           0),  INT32_C(           5),  INT32_C(          14),  INT32_C(          30),  INT32_C(           0),  INT32_C(          16),  INT32_C(           1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(                   0), -INT64_C(  324541748732891779),  INT64_C( 1154047406661181441), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  54),  INT64_C(                   5),  INT64_C(                  64) } },
+    { { -INT64_C( 1154117773274652681), -INT64_C( 8597686985057055695),  INT64_C( 8427554984077228446),  INT64_C( 1805488056436238938) },
+      {  INT64_C(                  58),  INT64_C(                  31),  INT64_C(                  40),  INT64_C(                  28) } },
+    { {  INT64_C( 5378040512152560541), -INT64_C(   43912845179486343), -INT64_C(    2251868533428233),  INT64_C( 8318189702635904839) },
+      {  INT64_C(                  28),  INT64_C(                  54),  INT64_C(                  59),  INT64_C(                  39) } },
+    { {  INT64_C( 8854089967858524412), -INT64_C( 6000895401699320541),  INT64_C( 3221754107088112541),  INT64_C( 9222949549166819325) },
+      {  INT64_C(                  33),  INT64_C(                  36),  INT64_C(                  32),  INT64_C(                  54) } },
+    { { -INT64_C(  288232583798984835), -INT64_C(   14672982741876769),  INT64_C( 4755772106199081697), -INT64_C( 8787103268870622107) },
+      {  INT64_C(                  56),  INT64_C(                  56),  INT64_C(                  32),  INT64_C(                  27) } },
+    { {  INT64_C(  545357822110694359),  INT64_C( 4612248968380915720), -INT64_C( 5277016258953115576),  INT64_C( 6594747587227108969) },
+      {  INT64_C(                  31),  INT64_C(                   6),  INT64_C(                  29),  INT64_C(                  34) } },
+    { { -INT64_C( 3140740041555864866),  INT64_C( 4629700485706683426),  INT64_C(  108086940880349216), -INT64_C( 9223331900112762880) },
+      {  INT64_C(                  34),  INT64_C(                   9),  INT64_C(                   8),  INT64_C(                   8) } },
+    { {  INT64_C( 5999146552487051392), -INT64_C( 6908240078531723008), -INT64_C( 6456778747702525417), -INT64_C(  684565286375915777) },
+      {  INT64_C(                  12),  INT64_C(                   6),  INT64_C(                  32),  INT64_C(                  57) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(   63085699422749056), -INT64_C( 6316142960179667480), -INT64_C( 8020996852597758607), -INT64_C( 1985132669669161398) },
+      UINT8_C(151),
+      {  INT64_C(                   0), -INT64_C( 3223701856130574287),  INT64_C( 2614143629636306152), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  31),  INT64_C(                  28), -INT64_C( 1985132669669161398) } },
+    { {  INT64_C(  180931418854259606),  INT64_C(    9147937284194304),  INT64_C(    2256197864411192),  INT64_C( 7279194187090938212) },
+      UINT8_C(253),
+      { -INT64_C(   49539595901208578), -INT64_C(    2533291987043330),  INT64_C(      52785152329728), -INT64_C(  983170770251063952) },
+      {  INT64_C(                  58),  INT64_C(    9147937284194304),  INT64_C(                   6),  INT64_C(                  34) } },
+    { { -INT64_C( 8294519666905174509),  INT64_C( 7037368194370647692), -INT64_C( 3448691901457127122), -INT64_C( 2594161758617346049) },
+      UINT8_C(  9),
+      {  INT64_C( 1760609617133091974),  INT64_C( 7619155620774118683), -INT64_C( 7065224226287075794),  INT64_C(      10996223623184) },
+      {  INT64_C(                  31),  INT64_C( 7037368194370647692), -INT64_C( 3448691901457127122),  INT64_C(                   7) } },
+    { { -INT64_C(    9007783504513041),  INT64_C( 8646893687533469435), -INT64_C(  637850552035171169), -INT64_C( 1301540300968167467) },
+      UINT8_C( 10),
+      { -INT64_C( 8698706269191956178), -INT64_C( 1803779684710744209),  INT64_C( 6701338376315330553), -INT64_C( 4065523747764850648) },
+      { -INT64_C(    9007783504513041),  INT64_C(                  53), -INT64_C(  637850552035171169),  INT64_C(                  28) } },
+    { { -INT64_C( 7622207610386593268), -INT64_C( 1713323594478914283), -INT64_C(    4569589384216585), -INT64_C(  486052805441639057) },
+      UINT8_C( 51),
+      {  INT64_C( 6917418354915405759),  INT64_C( 4616510761349545988), -INT64_C( 9223160376571199448),  INT64_C( 1743104163099901972) },
+      {  INT64_C(                  53),  INT64_C(                   9), -INT64_C(    4569589384216585), -INT64_C(  486052805441639057) } },
+    { { -INT64_C( 6823646814988484887), -INT64_C( 4656722634254581761), -INT64_C( 6478011522934276869),  INT64_C(       4410952409172) },
+      UINT8_C(235),
+      { -INT64_C( 3125116585618998550),  INT64_C( 8929767261502755692),  INT64_C( 3413079168901231771), -INT64_C(  234318468711864977) },
+      {  INT64_C(                  34),  INT64_C(                  32), -INT64_C( 6478011522934276869),  INT64_C(                  35) } },
+    { { -INT64_C( 6251701277305454845), -INT64_C(       8804691544580),  INT64_C( 4345117819664057678),  INT64_C( 6113359852071596373) },
+      UINT8_C(  1),
+      { -INT64_C(     281758449008642),  INT64_C( 9223354427488861695),  INT64_C(  414348796899688480),  INT64_C( 3914067458296637768) },
+      {  INT64_C(                  58), -INT64_C(       8804691544580),  INT64_C( 4345117819664057678),  INT64_C( 6113359852071596373) } },
+    { {  INT64_C(  739237136888368328), -INT64_C( 2319423667232908608), -INT64_C( 1697900912867735829), -INT64_C( 6560093312721012404) },
+      UINT8_C(116),
+      {  INT64_C( 5895061532497635982), -INT64_C( 5783038551683901163),  INT64_C( 4609152193872723383), -INT64_C( 5188854890578843651) },
+      {  INT64_C(  739237136888368328), -INT64_C( 2319423667232908608),  INT64_C(                  54), -INT64_C( 6560093312721012404) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 43),
+      {  INT64_C(                   0), -INT64_C( 3101149509144859386), -INT64_C( 7693775686207382219), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  30),  INT64_C(                   0),  INT64_C(                  64) } },
+    { UINT8_C(175),
+      { -INT64_C( 4779347610587989138), -INT64_C( 6210355775937337499), -INT64_C( 5637443243157602065), -INT64_C(      18693896701059) },
+      {  INT64_C(                  36),  INT64_C(                  33),  INT64_C(                  31),  INT64_C(                  53) } },
+    { UINT8_C(247),
+      {  INT64_C( 9214285664168706039), -INT64_C(  216184886405545985), -INT64_C( 6026894637210566297), -INT64_C(  155374359026926087) },
+      {  INT64_C(                  57),  INT64_C(                  54),  INT64_C(                  29),  INT64_C(                   0) } },
+    { UINT8_C(196),
+      {  INT64_C( 7253931644521447274), -INT64_C( 6566276916675648549), -INT64_C(  676102898354094081), -INT64_C( 8543782338610690826) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  57),  INT64_C(                   0) } },
+    { UINT8_C( 38),
+      {  INT64_C( 3494795793385136128), -INT64_C( 3640344631924083960),  INT64_C( 1548467377167108319), -INT64_C( 8240648671870539603) },
+      {  INT64_C(                   0),  INT64_C(                  31),  INT64_C(                  30),  INT64_C(                   0) } },
+    { UINT8_C(171),
+      {  INT64_C(   74433091075178498),  INT64_C(  144132784590684224),  INT64_C(  110481694317969408), -INT64_C(      71468255805697) },
+      {  INT64_C(                  11),  INT64_C(                   6),  INT64_C(                   0),  INT64_C(                  61) } },
+    { UINT8_C(227),
+      { -INT64_C(    6783439137153057), -INT64_C(   74345907616743489), -INT64_C(      80814104641553), -INT64_C(  291046637814464513) },
+      {  INT64_C(                  54),  INT64_C(                  52),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(177),
+      { -INT64_C( 6935206897434426649),  INT64_C(  288247968338051073), -INT64_C(    4573974814822402),  INT64_C( 5279102301357818570) },
+      {  INT64_C(                  28),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(   0), -INT8_C(   3),  INT8_C(   4),  INT8_C( 105),  INT8_C(   5),  INT8_C( 117),  INT8_C( 118),  INT8_C(  57),
+        -INT8_C(   4), -INT8_C( 111), -INT8_C(  67), -INT8_C(  26),  INT8_C(  32), -INT8_C(  50), -INT8_C(   9),  INT8_C( 125),
+        -INT8_C(  83), -INT8_C(  33),  INT8_C(  32),  INT8_C( 116),  INT8_C(   4), -INT8_C( 119),  INT8_C(   0), -INT8_C(  80),
+         INT8_C(   9),  INT8_C(  53), -INT8_C(   1), -INT8_C(   2),  INT8_C(  12),  INT8_C(   0),      INT8_MAX,  INT8_C(   0),
+         INT8_C(  51), -INT8_C(  44),  INT8_C(  84),  INT8_C(  72),  INT8_C(  43),  INT8_C(   8),  INT8_C(  98),      INT8_MIN,
+        -INT8_C(  34),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),  INT8_C(  16), -INT8_C(   8), -INT8_C(  49), -INT8_C(   9),
+         INT8_C(  64), -INT8_C(  75), -INT8_C(  41), -INT8_C( 102),  INT8_C(  19),  INT8_C(   0), -INT8_C(   3), -INT8_C( 103),
+         INT8_C( 122),  INT8_C(  75), -INT8_C(  73),  INT8_C(  64), -INT8_C( 124),  INT8_C(  46), -INT8_C( 112), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   7),  INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   6),  INT8_C(   3),  INT8_C(   6),  INT8_C(   5),  INT8_C(   1),  INT8_C(   5),  INT8_C(   7),  INT8_C(   6),
+         INT8_C(   5),  INT8_C(   7),  INT8_C(   1),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   8),  INT8_C(   7),  INT8_C(   2),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   6),  INT8_C(   0),  INT8_C(   1),  INT8_C(   8),  INT8_C(   1),  INT8_C(   5),  INT8_C(   6),  INT8_C(   7),
+         INT8_C(   1),  INT8_C(   5),  INT8_C(   6),  INT8_C(   4),  INT8_C(   3),  INT8_C(   0),  INT8_C(   7),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(   6),  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   8) } },
+    { { -INT8_C( 127), -INT8_C(  34), -INT8_C(  23),  INT8_C(  71), -INT8_C(  50), -INT8_C(  56), -INT8_C(   5), -INT8_C(   1),
+        -INT8_C(   2), -INT8_C(  16),  INT8_C(  72), -INT8_C(  17),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(  96),  INT8_C(  41),  INT8_C(   0), -INT8_C(   9),  INT8_C(  18), -INT8_C(  49), -INT8_C( 111),  INT8_C(  62),
+        -INT8_C(   7), -INT8_C(   4),  INT8_C(  62),  INT8_C(  16), -INT8_C(   9),  INT8_C(   9), -INT8_C(  34),  INT8_C(   1),
+        -INT8_C(  83), -INT8_C(  78),      INT8_MIN, -INT8_C(   5), -INT8_C(   5),      INT8_MAX,  INT8_C(   0), -INT8_C(  77),
+        -INT8_C(   2),  INT8_C( 116),      INT8_MAX, -INT8_C(  21), -INT8_C(  27), -INT8_C(   1), -INT8_C(  47), -INT8_C(  83),
+         INT8_C(  32), -INT8_C(   2),  INT8_C(  19),  INT8_C(  64), -INT8_C(  10), -INT8_C( 127), -INT8_C(  35),  INT8_C(  29),
+        -INT8_C(   1),  INT8_C(  62), -INT8_C(  33),  INT8_C(  16),  INT8_C( 100),  INT8_C(  45), -INT8_C(   4),  INT8_C(   0) },
+      {  INT8_C(   2),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   3),  INT8_C(   7),  INT8_C(   8),
+         INT8_C(   7),  INT8_C(   4),  INT8_C(   2),  INT8_C(   7),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   0),  INT8_C(   7),  INT8_C(   2),  INT8_C(   6),  INT8_C(   3),  INT8_C(   5),
+         INT8_C(   6),  INT8_C(   6),  INT8_C(   5),  INT8_C(   1),  INT8_C(   7),  INT8_C(   2),  INT8_C(   6),  INT8_C(   1),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(   1),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   7),  INT8_C(   4),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),  INT8_C(   8),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   1),  INT8_C(   7),  INT8_C(   3),  INT8_C(   1),  INT8_C(   6),  INT8_C(   2),  INT8_C(   6),  INT8_C(   4),
+         INT8_C(   8),  INT8_C(   5),  INT8_C(   7),  INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0) } },
+    { {  INT8_C(  65), -INT8_C(   5), -INT8_C(  90), -INT8_C(  16), -INT8_C(   1), -INT8_C(   1),  INT8_C(  49), -INT8_C(  41),
+         INT8_C(  95), -INT8_C(  38), -INT8_C(   7),  INT8_C( 117),  INT8_C(  65),  INT8_C(   0), -INT8_C(   4),  INT8_C(  96),
+        -INT8_C(  69), -INT8_C(   2), -INT8_C(   9), -INT8_C(   9),  INT8_C(  67), -INT8_C(   2),  INT8_C(  33),  INT8_C(  19),
+        -INT8_C(   2), -INT8_C(  34), -INT8_C(  17), -INT8_C(  86),  INT8_C(  64), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(   7),  INT8_C(   0),  INT8_C(   1), -INT8_C(   2),  INT8_C(  18),  INT8_C(  22), -INT8_C(  79), -INT8_C(   2),
+         INT8_C( 125), -INT8_C(   1), -INT8_C(  19),  INT8_C(   3),  INT8_C(  32),  INT8_C(  86),  INT8_C(   0),  INT8_C( 101),
+         INT8_C(  72), -INT8_C(  19), -INT8_C(   3),  INT8_C(  63),  INT8_C( 124),  INT8_C( 120),  INT8_C(  79), -INT8_C(   1),
+         INT8_C(  32),  INT8_C(  11), -INT8_C( 115), -INT8_C(  49),  INT8_C( 108), -INT8_C(  48), -INT8_C(  19),  INT8_C(  16) },
+      {  INT8_C(   2),  INT8_C(   7),  INT8_C(   4),  INT8_C(   4),  INT8_C(   8),  INT8_C(   8),  INT8_C(   3),  INT8_C(   6),
+         INT8_C(   6),  INT8_C(   5),  INT8_C(   6),  INT8_C(   5),  INT8_C(   2),  INT8_C(   0),  INT8_C(   6),  INT8_C(   2),
+         INT8_C(   6),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   3),  INT8_C(   7),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   7),  INT8_C(   6),  INT8_C(   7),  INT8_C(   4),  INT8_C(   1),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   6),  INT8_C(   0),  INT8_C(   1),  INT8_C(   7),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),  INT8_C(   7),
+         INT8_C(   6),  INT8_C(   8),  INT8_C(   6),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   2),  INT8_C(   6),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   8),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   6),  INT8_C(   4),  INT8_C(   3),  INT8_C(   6),  INT8_C(   1) } },
+    { {  INT8_C(  71),  INT8_C(  81),  INT8_C( 111),  INT8_C( 122), -INT8_C(  41),  INT8_C(   0), -INT8_C(  51),  INT8_C(  32),
+         INT8_C(  70),  INT8_C(   3),  INT8_C(  45),  INT8_C(  10),  INT8_C(   0),  INT8_C(  17), -INT8_C(  30),  INT8_C(  45),
+         INT8_C(  45),  INT8_C(   0), -INT8_C(  17), -INT8_C(   3), -INT8_C( 118),  INT8_C(   0), -INT8_C(   1),      INT8_MIN,
+        -INT8_C(  11),  INT8_C(  64),  INT8_C(  73), -INT8_C( 104), -INT8_C(  66),  INT8_C(   0),  INT8_C(  66),  INT8_C( 107),
+         INT8_C( 106),  INT8_C(  52),  INT8_C(   5), -INT8_C(   3), -INT8_C(  44),  INT8_C(   0),  INT8_C(  14),  INT8_C(  31),
+        -INT8_C(  97), -INT8_C( 120), -INT8_C(   1), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(  45), -INT8_C(  84),
+        -INT8_C(   1),  INT8_C(   8), -INT8_C(  65), -INT8_C(   3),  INT8_C(   0), -INT8_C(  87),  INT8_C(  50),  INT8_C(   1),
+         INT8_C(  36),  INT8_C(  86), -INT8_C(  13), -INT8_C(   5),  INT8_C(  18),      INT8_MIN,  INT8_C(  34), -INT8_C( 122) },
+      {  INT8_C(   4),  INT8_C(   3),  INT8_C(   6),  INT8_C(   5),  INT8_C(   6),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   3),  INT8_C(   0),  INT8_C(   8),  INT8_C(   1),
+         INT8_C(   6),  INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(   6),  INT8_C(   0),  INT8_C(   2),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   7),  INT8_C(   4),  INT8_C(   0),  INT8_C(   3),  INT8_C(   5),
+         INT8_C(   6),  INT8_C(   2),  INT8_C(   8),  INT8_C(   8),  INT8_C(   1),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   8),  INT8_C(   1),  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   4),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   6),  INT8_C(   7),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   3) } },
+    { { -INT8_C(  81), -INT8_C(  18), -INT8_C( 100), -INT8_C( 112),      INT8_MIN, -INT8_C(  17),  INT8_C(   2),  INT8_C(  36),
+         INT8_C(   4), -INT8_C( 107), -INT8_C(  13), -INT8_C(  42),  INT8_C(   0),  INT8_C(  94),  INT8_C(   4),  INT8_C(  64),
+         INT8_C(  96), -INT8_C(   6), -INT8_C(   3), -INT8_C(  18),  INT8_C(   6),  INT8_C( 109),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  65),  INT8_C(   0),  INT8_C(  78),  INT8_C(  24),  INT8_C(  65), -INT8_C(  17),  INT8_C(  90),  INT8_C(  90),
+        -INT8_C(   9), -INT8_C(  33), -INT8_C( 110),  INT8_C(   0),  INT8_C( 109),  INT8_C(  58),  INT8_C(  68),  INT8_C(  82),
+         INT8_C(   7),  INT8_C(   9), -INT8_C( 106),  INT8_C(   0),  INT8_C(  22),  INT8_C(   1), -INT8_C(   2),  INT8_C(  46),
+        -INT8_C(  90), -INT8_C(  21),  INT8_C(  73),  INT8_C(   0),  INT8_C( 112), -INT8_C(  90), -INT8_C(  55), -INT8_C(   6),
+        -INT8_C(  23), -INT8_C(  57),  INT8_C(  44), -INT8_C(   2), -INT8_C(  79), -INT8_C(   1),  INT8_C(   0), -INT8_C( 107) },
+      {  INT8_C(   6),  INT8_C(   6),  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),  INT8_C(   7),  INT8_C(   1),  INT8_C(   2),
+         INT8_C(   1),  INT8_C(   4),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   6),  INT8_C(   7),  INT8_C(   6),  INT8_C(   2),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   7),  INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   2),  INT8_C(   7),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   7),  INT8_C(   7),  INT8_C(   3),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1),  INT8_C(   7),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   6),  INT8_C(   3),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   5),  INT8_C(   5),  INT8_C(   3),  INT8_C(   7),  INT8_C(   4),  INT8_C(   8),  INT8_C(   0),  INT8_C(   4) } },
+    { { -INT8_C(   2), -INT8_C(   1),  INT8_C(   2),  INT8_C(  76),  INT8_C(   5), -INT8_C(   1),  INT8_C(   0),      INT8_MIN,
+         INT8_C(   4), -INT8_C(   1),  INT8_C(   0), -INT8_C( 111),  INT8_C(   0),  INT8_C(   1),  INT8_C(  32), -INT8_C(  14),
+         INT8_C(  16), -INT8_C(  33),  INT8_C(   8), -INT8_C(  97), -INT8_C(  95), -INT8_C(   5),  INT8_C(  55), -INT8_C(  10),
+        -INT8_C(  59), -INT8_C(   3),  INT8_C(  16), -INT8_C(  44), -INT8_C(   1),  INT8_C(  83), -INT8_C(   1),  INT8_C(   2),
+         INT8_C(  25),  INT8_C( 100), -INT8_C( 122),  INT8_C( 102), -INT8_C(   9), -INT8_C(  12),  INT8_C(   1),  INT8_C(  11),
+        -INT8_C(  92), -INT8_C(  32), -INT8_C(  96), -INT8_C(   5),  INT8_C(  50),  INT8_C(  32),  INT8_C( 104),  INT8_C(   0),
+        -INT8_C(  17), -INT8_C(   3), -INT8_C(  37), -INT8_C(  34),  INT8_C(  84),  INT8_C(  15),  INT8_C(   0), -INT8_C(  73),
+        -INT8_C(   1), -INT8_C(  60),  INT8_C(   8), -INT8_C(   2),  INT8_C( 126), -INT8_C(   1),  INT8_C(   0),  INT8_C(  74) },
+      {  INT8_C(   7),  INT8_C(   8),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   8),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   8),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   5),
+         INT8_C(   1),  INT8_C(   7),  INT8_C(   1),  INT8_C(   6),  INT8_C(   3),  INT8_C(   7),  INT8_C(   5),  INT8_C(   6),
+         INT8_C(   4),  INT8_C(   7),  INT8_C(   1),  INT8_C(   4),  INT8_C(   8),  INT8_C(   4),  INT8_C(   8),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   7),  INT8_C(   5),  INT8_C(   1),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   7),  INT8_C(   3),  INT8_C(   1),  INT8_C(   3),  INT8_C(   0),
+         INT8_C(   7),  INT8_C(   7),  INT8_C(   6),  INT8_C(   6),  INT8_C(   3),  INT8_C(   4),  INT8_C(   0),  INT8_C(   6),
+         INT8_C(   8),  INT8_C(   3),  INT8_C(   1),  INT8_C(   7),  INT8_C(   6),  INT8_C(   8),  INT8_C(   0),  INT8_C(   3) } },
+    { {  INT8_C(   0), -INT8_C(  58), -INT8_C(  47), -INT8_C(  21),  INT8_C(   0), -INT8_C(  28), -INT8_C(  37),  INT8_C(   0),
+         INT8_C(  45),  INT8_C(  93), -INT8_C(  12), -INT8_C(  15),  INT8_C(  28),  INT8_C(   5),  INT8_C(  33), -INT8_C(  48),
+         INT8_C(   0), -INT8_C(  58),  INT8_C(  84), -INT8_C(  11),  INT8_C(  23),  INT8_C( 105), -INT8_C(  33), -INT8_C(  20),
+        -INT8_C(   1),  INT8_C(  42),  INT8_C(  13), -INT8_C(  28), -INT8_C(  33),  INT8_C(   0), -INT8_C(  25),  INT8_C(  88),
+        -INT8_C(   3), -INT8_C(  37), -INT8_C(  92),  INT8_C(  37),  INT8_C( 120), -INT8_C(  62), -INT8_C(  65), -INT8_C( 125),
+        -INT8_C(  23), -INT8_C(  34),  INT8_C(  36),  INT8_C(  71),  INT8_C(   0), -INT8_C(   3),  INT8_C( 124), -INT8_C(   5),
+         INT8_C(  33),  INT8_C(   0),  INT8_C(  11), -INT8_C(  81), -INT8_C( 124),  INT8_C(   0), -INT8_C(  77), -INT8_C(  19),
+        -INT8_C( 120),  INT8_C(  39),  INT8_C(  20),  INT8_C( 116), -INT8_C(   7),  INT8_C(  32), -INT8_C( 109),  INT8_C( 126) },
+      {  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   3),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   4),  INT8_C(   7),  INT8_C(   5),
+         INT8_C(   8),  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   7),  INT8_C(   0),  INT8_C(   6),  INT8_C(   3),
+         INT8_C(   7),  INT8_C(   6),  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   3),  INT8_C(   7),  INT8_C(   3),
+         INT8_C(   5),  INT8_C(   6),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   7),  INT8_C(   5),  INT8_C(   7),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   6),  INT8_C(   2),  INT8_C(   0),  INT8_C(   5),  INT8_C(   6),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   6),  INT8_C(   1),  INT8_C(   4),  INT8_C(   6) } },
+    { {  INT8_C(  63), -INT8_C(  89),  INT8_C(  32), -INT8_C( 103), -INT8_C( 103),  INT8_C(  15),  INT8_C(  85), -INT8_C(  19),
+        -INT8_C( 126),  INT8_C( 125), -INT8_C(   5),  INT8_C(  83),  INT8_C( 100),  INT8_C( 105),  INT8_C(  12),  INT8_C(   4),
+         INT8_C(  96), -INT8_C(  28), -INT8_C(  89), -INT8_C(  79),  INT8_C(  41),  INT8_C(  62), -INT8_C(   1),  INT8_C(  83),
+         INT8_C(  34), -INT8_C(  65), -INT8_C(   2),  INT8_C(   2),  INT8_C(   0), -INT8_C(  17), -INT8_C(  67), -INT8_C(   8),
+        -INT8_C( 107),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0), -INT8_C(   1), -INT8_C( 120),  INT8_C(  76),  INT8_C(  12),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(  57),  INT8_C(   0),  INT8_C( 110), -INT8_C(  33), -INT8_C(  33), -INT8_C(  26),
+         INT8_C(   4),  INT8_C(  14), -INT8_C(   9), -INT8_C(  94),  INT8_C(  68),  INT8_C(  37), -INT8_C(  91), -INT8_C(  10),
+         INT8_C(   4), -INT8_C(   7),  INT8_C(  69), -INT8_C(   1), -INT8_C(   9), -INT8_C(   5), -INT8_C(  17),  INT8_C(   3) },
+      {  INT8_C(   6),  INT8_C(   5),  INT8_C(   1),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   2),  INT8_C(   6),  INT8_C(   7),  INT8_C(   4),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   5),  INT8_C(   8),  INT8_C(   4),
+         INT8_C(   2),  INT8_C(   7),  INT8_C(   7),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   8),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   4),  INT8_C(   0),  INT8_C(   5),  INT8_C(   7),  INT8_C(   7),  INT8_C(   5),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   7),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   1),  INT8_C(   6),  INT8_C(   3),  INT8_C(   8),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi8(a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  65),      INT8_MIN,  INT8_C( 124),  INT8_C(  44),  INT8_C(  46),  INT8_C( 125), -INT8_C( 106),  INT8_C(  36),
+        -INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(  78), -INT8_C(  49),  INT8_C(  10), -INT8_C(  57),  INT8_C(  65),
+         INT8_C(   9), -INT8_C(   1),  INT8_C(  16),  INT8_C( 113), -INT8_C(  15),  INT8_C(   0),  INT8_C(  42), -INT8_C( 116),
+        -INT8_C(   2),  INT8_C(   3), -INT8_C(  17), -INT8_C(  28), -INT8_C(  35), -INT8_C(  65),  INT8_C(  15), -INT8_C(  18),
+        -INT8_C(   3), -INT8_C(  90), -INT8_C(   8),  INT8_C(  16), -INT8_C(  73),  INT8_C(  71),  INT8_C(   4),  INT8_C(  17),
+        -INT8_C(   1), -INT8_C(   3),  INT8_C(  48),  INT8_C(  32),  INT8_C(  32), -INT8_C(   9),  INT8_C( 115),  INT8_C(  45),
+         INT8_C(   0), -INT8_C(  64),  INT8_C(   0), -INT8_C(   1), -INT8_C(  35), -INT8_C( 120), -INT8_C(  12), -INT8_C(   9),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  65),  INT8_C( 119), -INT8_C( 114), -INT8_C(  89), -INT8_C(   2), -INT8_C(   1) },
+      UINT64_C( 5938398066772850481),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(  76), -INT8_C(   1), -INT8_C(  90),
+         INT8_C(   1), -INT8_C(   1), -INT8_C(  84), -INT8_C(   2),  INT8_C(  40),      INT8_MIN, -INT8_C( 108), -INT8_C(  63),
+         INT8_C( 120),  INT8_C( 106),  INT8_C(  21),  INT8_C(   0), -INT8_C(  34), -INT8_C(  91),  INT8_C(  32), -INT8_C(  91),
+         INT8_C(   0),  INT8_C(  29), -INT8_C(  65), -INT8_C(  68),  INT8_C( 123), -INT8_C(  17),  INT8_C(   0),  INT8_C( 102),
+         INT8_C( 100),      INT8_MIN,  INT8_C(   0),  INT8_C(   2), -INT8_C(  15), -INT8_C(   1),  INT8_C(  18), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(  17),  INT8_C( 107),  INT8_C(  57), -INT8_C(   1), -INT8_C(  58),  INT8_C(   0), -INT8_C( 112),
+         INT8_C( 105),  INT8_C(  57),  INT8_C(   8), -INT8_C(  27), -INT8_C(   1),  INT8_C(  55), -INT8_C(  69), -INT8_C(  25),
+        -INT8_C(   3), -INT8_C(  18), -INT8_C(  25), -INT8_C( 113),  INT8_C(  29), -INT8_C(  79),  INT8_C(   0), -INT8_C(   1) },
+      {  INT8_C(   0),      INT8_MIN,  INT8_C( 124),  INT8_C(  44),  INT8_C(   1),  INT8_C(   3), -INT8_C( 106),  INT8_C(  36),
+         INT8_C(   1),  INT8_C(   8),  INT8_C(   4),  INT8_C(  78),  INT8_C(   2),  INT8_C(   1), -INT8_C(  57),  INT8_C(   3),
+         INT8_C(   9), -INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   1),  INT8_C(   4),
+        -INT8_C(   2),  INT8_C(   3), -INT8_C(  17),  INT8_C(   5), -INT8_C(  35),  INT8_C(   7),  INT8_C(  15), -INT8_C(  18),
+        -INT8_C(   3), -INT8_C(  90),  INT8_C(   0),  INT8_C(  16),  INT8_C(   5),  INT8_C(  71),  INT8_C(   4),  INT8_C(   8),
+         INT8_C(   8), -INT8_C(   3),  INT8_C(   5),  INT8_C(   4),  INT8_C(  32),  INT8_C(   4),  INT8_C(   0),  INT8_C(  45),
+         INT8_C(   4), -INT8_C(  64),  INT8_C(   0),  INT8_C(   5), -INT8_C(  35),  INT8_C(   5),  INT8_C(   6), -INT8_C(   9),
+         INT8_C(   0),  INT8_C(   6), -INT8_C(  65),  INT8_C( 119),  INT8_C(   4), -INT8_C(  89),  INT8_C(   0), -INT8_C(   1) } },
+    { { -INT8_C(  44), -INT8_C(   2), -INT8_C(  36), -INT8_C(   9), -INT8_C(  70), -INT8_C(  43), -INT8_C( 104), -INT8_C(  44),
+        -INT8_C(  13),  INT8_C(  62),  INT8_C(   0),  INT8_C(  19),  INT8_C(   0),  INT8_C( 126),  INT8_C( 104), -INT8_C(   2),
+        -INT8_C( 118), -INT8_C( 118),  INT8_C(   3),  INT8_C(  68), -INT8_C(   3),  INT8_C(  29), -INT8_C(  75),  INT8_C(  84),
+        -INT8_C(   1), -INT8_C(  96), -INT8_C(  15),  INT8_C( 103), -INT8_C(  83), -INT8_C(   5),      INT8_MIN,  INT8_C(  41),
+         INT8_C(   0),  INT8_C(   2), -INT8_C(  82), -INT8_C(  68), -INT8_C(  84),  INT8_C(  64), -INT8_C(   4), -INT8_C(   3),
+        -INT8_C(  79), -INT8_C( 111), -INT8_C(  18),  INT8_C(   0), -INT8_C( 124), -INT8_C(  71), -INT8_C(  27), -INT8_C(   2),
+        -INT8_C(   9),  INT8_C(   0),  INT8_C(   0), -INT8_C(   6),  INT8_C(  33), -INT8_C(  17), -INT8_C(   1), -INT8_C( 111),
+         INT8_C(   2),  INT8_C(   0), -INT8_C( 101),      INT8_MIN, -INT8_C( 125),  INT8_C(  59),  INT8_C(  32), -INT8_C(  96) },
+      UINT64_C( 7337726801852304257),
+      {  INT8_C( 118),  INT8_C(   0),  INT8_C(  22),  INT8_C(  16),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(  29),  INT8_C(  83),  INT8_C(  70), -INT8_C(  15),  INT8_C(   2),  INT8_C(  93), -INT8_C(  17),  INT8_C(  16),
+         INT8_C(   4), -INT8_C(   1), -INT8_C(  50),  INT8_C(  40), -INT8_C(  70), -INT8_C(   1),  INT8_C(   2), -INT8_C(  33),
+         INT8_C(  18),  INT8_C(   0), -INT8_C(   1),  INT8_C(  96),  INT8_C(  64), -INT8_C(   1),  INT8_C(  35), -INT8_C(  13),
+         INT8_C(  88), -INT8_C( 120), -INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(  37), -INT8_C(  74),  INT8_C(   2),
+         INT8_C(  16),  INT8_C(  32),  INT8_C(  78), -INT8_C(  94),  INT8_C(  27),  INT8_C(   0), -INT8_C(  97),  INT8_C(   2),
+        -INT8_C(   7), -INT8_C(   1),  INT8_C(  13),      INT8_MAX, -INT8_C(  32), -INT8_C(   3), -INT8_C(  35), -INT8_C(   1),
+        -INT8_C( 127),  INT8_C(  80),  INT8_C(   2), -INT8_C(  88), -INT8_C(  98), -INT8_C(  77), -INT8_C(   1),  INT8_C(  10) },
+      {  INT8_C(   5), -INT8_C(   2), -INT8_C(  36), -INT8_C(   9), -INT8_C(  70), -INT8_C(  43), -INT8_C( 104),  INT8_C(   1),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C( 126),  INT8_C( 104), -INT8_C(   2),
+         INT8_C(   1), -INT8_C( 118),  INT8_C(   5),  INT8_C(  68), -INT8_C(   3),  INT8_C(  29),  INT8_C(   1),  INT8_C(  84),
+         INT8_C(   2),  INT8_C(   0), -INT8_C(  15),  INT8_C(   2),  INT8_C(   1),  INT8_C(   8),      INT8_MIN,  INT8_C(  41),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   8), -INT8_C(  68), -INT8_C(  84),  INT8_C(   6), -INT8_C(   4),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   1),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4), -INT8_C(  71),  INT8_C(   6),  INT8_C(   1),
+        -INT8_C(   9),  INT8_C(   0),  INT8_C(   3), -INT8_C(   6),  INT8_C(   3), -INT8_C(  17),  INT8_C(   6),  INT8_C(   8),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   1),      INT8_MIN, -INT8_C( 125),  INT8_C(   5),  INT8_C(   8), -INT8_C(  96) } },
+    { { -INT8_C(   1),  INT8_C(  96), -INT8_C(  31),      INT8_MIN, -INT8_C(  90),      INT8_MIN, -INT8_C( 113), -INT8_C(  60),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   1), -INT8_C(  36),  INT8_C(  16), -INT8_C(  85), -INT8_C(  97), -INT8_C(   5),
+        -INT8_C(   3),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C( 103), -INT8_C(  41),  INT8_C(   0),      INT8_MIN,
+         INT8_C(   0), -INT8_C(  51),  INT8_C( 107), -INT8_C(  77),  INT8_C(   0), -INT8_C(  37),  INT8_C(  73),  INT8_C(  16),
+        -INT8_C(  46), -INT8_C(  73),  INT8_C(  16),  INT8_C(  87),  INT8_C(   0), -INT8_C(  39), -INT8_C(   1), -INT8_C(  86),
+        -INT8_C(   5),  INT8_C(   3), -INT8_C( 117), -INT8_C(   1), -INT8_C(  19),      INT8_MAX, -INT8_C(  26), -INT8_C(  63),
+         INT8_C(  28),  INT8_C(  17),  INT8_C( 121), -INT8_C(  78),  INT8_C( 112), -INT8_C(  67),  INT8_C(   0),  INT8_C(  72),
+        -INT8_C(  53), -INT8_C(   3), -INT8_C(   3),  INT8_C(   4),  INT8_C(  94),  INT8_C(  84), -INT8_C( 124),  INT8_C( 118) },
+      UINT64_C( 7982384298125544821),
+      { -INT8_C(   9), -INT8_C(   4),  INT8_C(  78),  INT8_C(  82),  INT8_C(  32), -INT8_C(   8),      INT8_MIN,  INT8_C(   0),
+         INT8_C(  73), -INT8_C( 117),  INT8_C(  14),      INT8_MAX, -INT8_C(   3),  INT8_C(  16), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(  37), -INT8_C(  14),  INT8_C( 107), -INT8_C( 113),  INT8_C(   0),  INT8_C(  55),  INT8_C(  64), -INT8_C(   1),
+        -INT8_C(   6),  INT8_C(  93),  INT8_C(  84), -INT8_C(  69),  INT8_C(  76),  INT8_C( 118),  INT8_C( 115),  INT8_C(  96),
+             INT8_MAX, -INT8_C( 123), -INT8_C(  53), -INT8_C(  19),  INT8_C(   2),  INT8_C( 101),  INT8_C( 120), -INT8_C(   1),
+         INT8_C(  43), -INT8_C( 127),  INT8_C(   0), -INT8_C(   9), -INT8_C(   3), -INT8_C(  90), -INT8_C(  24),  INT8_C(  95),
+        -INT8_C(  72),  INT8_C(  15),  INT8_C(   4), -INT8_C(   1),  INT8_C(  82), -INT8_C(  22),      INT8_MAX, -INT8_C(  90),
+         INT8_C(   7), -INT8_C(   1),  INT8_C(  98),  INT8_C(  36), -INT8_C(   2),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0) },
+      {  INT8_C(   7),  INT8_C(  96),  INT8_C(   4),      INT8_MIN,  INT8_C(   1),  INT8_C(   5),  INT8_C(   1), -INT8_C(  60),
+         INT8_C(   3),  INT8_C(   4),  INT8_C(   3),  INT8_C(   7),  INT8_C(  16), -INT8_C(  85),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   6),  INT8_C(   0),  INT8_C(   5),  INT8_C(   5),  INT8_C( 103),  INT8_C(   5),  INT8_C(   1),      INT8_MIN,
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   3), -INT8_C(  77),  INT8_C(   0), -INT8_C(  37),  INT8_C(  73),  INT8_C(  16),
+        -INT8_C(  46),  INT8_C(   3),  INT8_C(  16),  INT8_C(   6),  INT8_C(   1),  INT8_C(   4), -INT8_C(   1), -INT8_C(  86),
+        -INT8_C(   5),  INT8_C(   3), -INT8_C( 117), -INT8_C(   1), -INT8_C(  19),  INT8_C(   4), -INT8_C(  26), -INT8_C(  63),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   1), -INT8_C(  78),  INT8_C( 112), -INT8_C(  67),  INT8_C(   7),  INT8_C(   4),
+        -INT8_C(  53),  INT8_C(   8),  INT8_C(   3),  INT8_C(   2),  INT8_C(  94),  INT8_C(   0),  INT8_C(   1),  INT8_C( 118) } },
+    { {  INT8_C(  80),  INT8_C(   8),  INT8_C(  16), -INT8_C(   3), -INT8_C(   9),  INT8_C(  66), -INT8_C(   2), -INT8_C(  89),
+         INT8_C( 100), -INT8_C(   3), -INT8_C(  25), -INT8_C(   1), -INT8_C(  73),  INT8_C(   1), -INT8_C( 116), -INT8_C(  37),
+        -INT8_C(  46),  INT8_C( 106),      INT8_MIN,  INT8_C(  76),  INT8_C( 125),  INT8_C(   2), -INT8_C( 115), -INT8_C(  27),
+        -INT8_C(  18),  INT8_C(  19), -INT8_C( 115), -INT8_C(  37),  INT8_C( 115),      INT8_MAX,  INT8_C(   2), -INT8_C( 125),
+        -INT8_C(  27),  INT8_C(  20),  INT8_C(   0),  INT8_C(  66),  INT8_C( 121), -INT8_C(  59),  INT8_C(   4), -INT8_C(  75),
+        -INT8_C(  61),  INT8_C(   2), -INT8_C(  33), -INT8_C(   9), -INT8_C(  23), -INT8_C(  79), -INT8_C(   1),  INT8_C(  59),
+        -INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(  35), -INT8_C(   1), -INT8_C( 113),
+         INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(   1), -INT8_C(  18),  INT8_C(   3),  INT8_C(  93),  INT8_C(  63) },
+      UINT64_C(16464208600727999267),
+      {  INT8_C(  97),  INT8_C( 113), -INT8_C(   3),  INT8_C(  42), -INT8_C( 111), -INT8_C(  50), -INT8_C(  73),  INT8_C(   1),
+        -INT8_C(   3), -INT8_C(   1), -INT8_C(  20), -INT8_C(   9),  INT8_C(   0),  INT8_C(   4),  INT8_C(   1),  INT8_C(  68),
+        -INT8_C(  92),  INT8_C( 123),  INT8_C(  96), -INT8_C(  33), -INT8_C(   2), -INT8_C(  81),  INT8_C(  88), -INT8_C( 124),
+         INT8_C(  32), -INT8_C(  44),  INT8_C(  38),  INT8_C(  39), -INT8_C(  56),  INT8_C(  48), -INT8_C(  18), -INT8_C(  67),
+        -INT8_C(  19), -INT8_C(   1),  INT8_C(  60), -INT8_C(   9), -INT8_C(   1), -INT8_C(  70), -INT8_C(  79),  INT8_C(   3),
+        -INT8_C(  74),  INT8_C(   2), -INT8_C(  59),      INT8_MAX, -INT8_C(  92),  INT8_C(   0), -INT8_C(  50), -INT8_C(  69),
+        -INT8_C(   3),  INT8_C(  23),      INT8_MIN,  INT8_C(  33),  INT8_C(  61),  INT8_C(  64), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(   8), -INT8_C(  65), -INT8_C( 127),  INT8_C(  64),  INT8_C(   0),  INT8_C(  94),  INT8_C(  75), -INT8_C(  99) },
+      {  INT8_C(   3),  INT8_C(   4),  INT8_C(  16), -INT8_C(   3), -INT8_C(   9),  INT8_C(   5), -INT8_C(   2), -INT8_C(  89),
+         INT8_C(   7),  INT8_C(   8), -INT8_C(  25), -INT8_C(   1),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),
+        -INT8_C(  46),  INT8_C(   6),      INT8_MIN,  INT8_C(  76),  INT8_C(   7),  INT8_C(   2),  INT8_C(   3), -INT8_C(  27),
+        -INT8_C(  18),  INT8_C(   4), -INT8_C( 115), -INT8_C(  37),  INT8_C( 115),      INT8_MAX,  INT8_C(   6),  INT8_C(   6),
+         INT8_C(   6),  INT8_C(  20),  INT8_C(   4),  INT8_C(   7),  INT8_C(   8),  INT8_C(   5),  INT8_C(   4), -INT8_C(  75),
+        -INT8_C(  61),  INT8_C(   1),  INT8_C(   4),  INT8_C(   7),  INT8_C(   3), -INT8_C(  79), -INT8_C(   1),  INT8_C(   6),
+        -INT8_C(  65),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   5),  INT8_C(   1),  INT8_C(   8), -INT8_C( 113),
+         INT8_C(  64),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1), -INT8_C(  18),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5) } },
+    { { -INT8_C( 121),  INT8_C(   0),  INT8_C(  61), -INT8_C(  20),  INT8_C(  81), -INT8_C(  24), -INT8_C(   1),  INT8_C( 121),
+        -INT8_C(  91), -INT8_C( 126), -INT8_C( 125),  INT8_C(   0), -INT8_C(   1), -INT8_C(  97),  INT8_C(  57), -INT8_C( 124),
+             INT8_MIN,      INT8_MAX,  INT8_C(  82),  INT8_C(  13),  INT8_C(  66), -INT8_C(  68), -INT8_C(  97),  INT8_C(  57),
+         INT8_C(   0), -INT8_C(  90),      INT8_MIN, -INT8_C(   1),  INT8_C(  40), -INT8_C(   1),  INT8_C(  40),  INT8_C(  10),
+         INT8_C(   0),  INT8_C(  94), -INT8_C(  33),  INT8_C( 119),  INT8_C(   0), -INT8_C(   9), -INT8_C(   5), -INT8_C(  81),
+         INT8_C(  32), -INT8_C( 117),  INT8_C(   0), -INT8_C( 117), -INT8_C(   7), -INT8_C(   5), -INT8_C(  17), -INT8_C(  25),
+        -INT8_C(   3),  INT8_C(   0), -INT8_C(  73),  INT8_C( 124), -INT8_C(   2), -INT8_C( 126),  INT8_C(  52), -INT8_C( 124),
+         INT8_C(  62), -INT8_C(  93),  INT8_C( 100),  INT8_C( 126), -INT8_C(   5),  INT8_C(   4),      INT8_MIN,      INT8_MAX },
+      UINT64_C( 3918699130535776009),
+      {  INT8_C(   0),  INT8_C(  78),  INT8_C(  68), -INT8_C( 118), -INT8_C(  72), -INT8_C(  97), -INT8_C( 124),  INT8_C(   0),
+         INT8_C(  58), -INT8_C( 120),  INT8_C(  43),  INT8_C(  16), -INT8_C(  65), -INT8_C(   1), -INT8_C(   2), -INT8_C( 122),
+         INT8_C(  78), -INT8_C(   1),  INT8_C(   0), -INT8_C(   2), -INT8_C(  49), -INT8_C(  70),  INT8_C(  27), -INT8_C(  97),
+         INT8_C( 123),  INT8_C(   0), -INT8_C(  34), -INT8_C(   5), -INT8_C(  70), -INT8_C(  29),  INT8_C(  55), -INT8_C(  36),
+         INT8_C(   0), -INT8_C(  70), -INT8_C( 108), -INT8_C(  33), -INT8_C( 124),  INT8_C( 102),  INT8_C(  16),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 106), -INT8_C(   3),  INT8_C(   0),  INT8_C(  69), -INT8_C(  13),  INT8_C(  32), -INT8_C(  12),
+         INT8_C( 110), -INT8_C(   9), -INT8_C(  10), -INT8_C(  92), -INT8_C( 108), -INT8_C(  49),  INT8_C(  81), -INT8_C(   1),
+         INT8_C(  78),  INT8_C(  14),  INT8_C(   0),  INT8_C(   0),  INT8_C(  68), -INT8_C(  33), -INT8_C( 105), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  61),  INT8_C(   3),  INT8_C(  81), -INT8_C(  24), -INT8_C(   1),  INT8_C( 121),
+         INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   1), -INT8_C(   1), -INT8_C(  97),  INT8_C(  57),  INT8_C(   3),
+         INT8_C(   4),  INT8_C(   8),  INT8_C(   0),  INT8_C(  13),  INT8_C(   6),  INT8_C(   5), -INT8_C(  97),  INT8_C(  57),
+         INT8_C(   6), -INT8_C(  90),      INT8_MIN,  INT8_C(   7),  INT8_C(   5), -INT8_C(   1),  INT8_C(   5),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(  94), -INT8_C(  33),  INT8_C(   7),  INT8_C(   2), -INT8_C(   9), -INT8_C(   5), -INT8_C(  81),
+         INT8_C(  32), -INT8_C( 117),  INT8_C(   7), -INT8_C( 117), -INT8_C(   7), -INT8_C(   5), -INT8_C(  17), -INT8_C(  25),
+        -INT8_C(   3),  INT8_C(   7), -INT8_C(  73),  INT8_C( 124), -INT8_C(   2),  INT8_C(   6),  INT8_C(   3), -INT8_C( 124),
+         INT8_C(  62),  INT8_C(   3),  INT8_C(   0),  INT8_C( 126),  INT8_C(   2),  INT8_C(   7),      INT8_MIN,      INT8_MAX } },
+    { { -INT8_C(   3),  INT8_C(  64), -INT8_C( 118), -INT8_C(  16), -INT8_C(  93),      INT8_MIN, -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  95), -INT8_C(  13),  INT8_C(   0), -INT8_C(  56), -INT8_C(  66),  INT8_C(   8), -INT8_C(  55), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(  45),  INT8_C(   1), -INT8_C(  54),  INT8_C(   0), -INT8_C(   1),  INT8_C(  33), -INT8_C(  97),
+         INT8_C( 125),  INT8_C(  17), -INT8_C(  64),  INT8_C(  36), -INT8_C(  66),  INT8_C(   4),  INT8_C(  83),  INT8_C(   0),
+         INT8_C(  21),  INT8_C(   6), -INT8_C(  13),  INT8_C(  65), -INT8_C(  49), -INT8_C(  33), -INT8_C(   5),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  45),  INT8_C(  33), -INT8_C(   7), -INT8_C(  17), -INT8_C(   1),  INT8_C(  57), -INT8_C(  45),
+        -INT8_C(   1),  INT8_C(  15), -INT8_C(  33), -INT8_C(  17),      INT8_MAX, -INT8_C( 108),  INT8_C(  85),  INT8_C(   0),
+        -INT8_C(   2),  INT8_C(  32),  INT8_C(  21), -INT8_C(  96), -INT8_C(  54),  INT8_C(  49),  INT8_C(   0), -INT8_C(   3) },
+      UINT64_C(10310950466307352647),
+      {  INT8_C( 101),  INT8_C(  48),  INT8_C(  57),  INT8_C(   2), -INT8_C( 120), -INT8_C(   3),  INT8_C(  28), -INT8_C(   1),
+        -INT8_C(   9), -INT8_C(  17), -INT8_C(   1), -INT8_C(   2),  INT8_C(   0),  INT8_C(  66),  INT8_C(   4),      INT8_MIN,
+         INT8_C(  28), -INT8_C(  13), -INT8_C(  17),  INT8_C(   2),  INT8_C(   0),  INT8_C(  99), -INT8_C( 114),  INT8_C(  64),
+        -INT8_C(   3),  INT8_C(   0), -INT8_C(   1), -INT8_C(   2),  INT8_C(  40), -INT8_C(  20), -INT8_C(   7),  INT8_C(   0),
+        -INT8_C(  78), -INT8_C(  23), -INT8_C(   1),  INT8_C(  68),  INT8_C(   4),  INT8_C(   0),  INT8_C(  55), -INT8_C(  17),
+         INT8_C(  66), -INT8_C(   6), -INT8_C(   1),  INT8_C(  98), -INT8_C(  32),  INT8_C(  32),  INT8_C(   0), -INT8_C(  14),
+         INT8_C(  50), -INT8_C(   1),  INT8_C(  83), -INT8_C(  91), -INT8_C(  50), -INT8_C(  14),  INT8_C(   4),  INT8_C(  13),
+         INT8_C( 112),  INT8_C(   9), -INT8_C(   1),  INT8_C(  96),  INT8_C(  87),  INT8_C(  17), -INT8_C(  76),  INT8_C(   0) },
+      {  INT8_C(   4),  INT8_C(   2),  INT8_C(   4), -INT8_C(  16), -INT8_C(  93),      INT8_MIN,  INT8_C(   3),  INT8_C(   0),
+        -INT8_C(  95), -INT8_C(  13),  INT8_C(   0),  INT8_C(   7), -INT8_C(  66),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(  45),  INT8_C(   7), -INT8_C(  54),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),  INT8_C(   1),
+         INT8_C( 125),  INT8_C(  17), -INT8_C(  64),  INT8_C(  36), -INT8_C(  66),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   6), -INT8_C(  13),  INT8_C(  65),  INT8_C(   1), -INT8_C(  33),  INT8_C(   5),  INT8_C(   7),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(  33),  INT8_C(   3),  INT8_C(   3), -INT8_C(   1),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   3),  INT8_C(   8),  INT8_C(   4), -INT8_C(  17),  INT8_C(   5), -INT8_C( 108),  INT8_C(  85),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   8),  INT8_C(   2), -INT8_C(  54),  INT8_C(  49),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  87), -INT8_C(  86),  INT8_C(  64),  INT8_C( 102), -INT8_C(  39), -INT8_C(  71),  INT8_C(   0), -INT8_C(   1),
+         INT8_C( 117),  INT8_C(   0),  INT8_C(  63), -INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(  27), -INT8_C( 112),
+        -INT8_C(  33), -INT8_C( 113), -INT8_C(   1),  INT8_C(  12), -INT8_C(   1), -INT8_C(  49),  INT8_C(  26), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(  23), -INT8_C( 127), -INT8_C(  33), -INT8_C( 126), -INT8_C(   1), -INT8_C( 118),
+         INT8_C( 113), -INT8_C(   1), -INT8_C(  22),  INT8_C( 122), -INT8_C(  29), -INT8_C(  97), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  43),  INT8_C(  92), -INT8_C(   1),  INT8_C(  76),  INT8_C(  31),  INT8_C(  61), -INT8_C(  20),  INT8_C(  49),
+        -INT8_C(   9), -INT8_C( 119),  INT8_C(  62), -INT8_C(  55), -INT8_C(  11), -INT8_C(  25), -INT8_C(  21),  INT8_C(  40),
+         INT8_C(   0), -INT8_C( 114),  INT8_C(  15),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0), -INT8_C(   1),  INT8_C( 111) },
+      UINT64_C(13489088996977044459),
+      {  INT8_C(   2),  INT8_C(   0), -INT8_C(  33), -INT8_C(  10), -INT8_C(  73),  INT8_C(   0), -INT8_C(   2), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(   5),  INT8_C( 103), -INT8_C(   1),  INT8_C(   0),  INT8_C( 119), -INT8_C(  38),  INT8_C(   0),
+         INT8_C(   2), -INT8_C(  44),  INT8_C( 112), -INT8_C(   3),  INT8_C(  64),  INT8_C(   0), -INT8_C( 112),  INT8_C(  32),
+         INT8_C(  63),  INT8_C( 101), -INT8_C(   1), -INT8_C(  25), -INT8_C(  38),  INT8_C(  13),  INT8_C( 111), -INT8_C(   1),
+         INT8_C(   2), -INT8_C(   2),  INT8_C(   1), -INT8_C(   3), -INT8_C(   5), -INT8_C(  32), -INT8_C(  46),  INT8_C( 123),
+        -INT8_C(   2), -INT8_C(  85),  INT8_C(   0),  INT8_C(   5), -INT8_C(   4), -INT8_C(   1),  INT8_C(   0),  INT8_C( 100),
+         INT8_C(  16), -INT8_C(  67), -INT8_C(  17), -INT8_C(  49), -INT8_C(  17), -INT8_C(  55), -INT8_C(  11),  INT8_C(  32),
+         INT8_C(  98),  INT8_C(  59), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(  33),  INT8_C(   0),  INT8_C(  28) },
+      {  INT8_C(   1),  INT8_C(   0),  INT8_C(  64),  INT8_C(   6), -INT8_C(  39),  INT8_C(   0),  INT8_C(   7),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   2),  INT8_C(  63),  INT8_C(   8),  INT8_C(   1),  INT8_C(   6),  INT8_C(   5), -INT8_C( 112),
+        -INT8_C(  33),  INT8_C(   4), -INT8_C(   1),  INT8_C(  12),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(  23),  INT8_C(   6),  INT8_C(   5),  INT8_C(   3),  INT8_C(   6), -INT8_C( 118),
+         INT8_C(   1), -INT8_C(   1), -INT8_C(  22),  INT8_C(   7),  INT8_C(   7),  INT8_C(   3),  INT8_C(   4),  INT8_C(   6),
+        -INT8_C(  43),  INT8_C(   5),  INT8_C(   0),  INT8_C(   2),  INT8_C(   6),  INT8_C(  61),  INT8_C(   0),  INT8_C(   3),
+        -INT8_C(   9),  INT8_C(   6),  INT8_C(  62), -INT8_C(  55),  INT8_C(   7),  INT8_C(   4), -INT8_C(  21),  INT8_C(  40),
+         INT8_C(   3),  INT8_C(   5),  INT8_C(  15),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),  INT8_C(   3) } },
+    { { -INT8_C(   5),  INT8_C(  65), -INT8_C(  63), -INT8_C(  45), -INT8_C(  83),  INT8_C(  83), -INT8_C(   1),  INT8_C(  80),
+        -INT8_C(  59),  INT8_C( 109), -INT8_C(   5),  INT8_C(  73), -INT8_C(  66),  INT8_C( 123), -INT8_C(  11), -INT8_C(  33),
+         INT8_C(  80),      INT8_MAX,  INT8_C(  23),  INT8_C(  86),  INT8_C(  96), -INT8_C(   2), -INT8_C(  81), -INT8_C(  32),
+         INT8_C(   0),  INT8_C(   2), -INT8_C(  18), -INT8_C(   2), -INT8_C( 102),  INT8_C(  79),  INT8_C(  87),  INT8_C(   4),
+         INT8_C(  24),  INT8_C( 119), -INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),      INT8_MAX,
+        -INT8_C(   1), -INT8_C( 116),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(  79),  INT8_C(   8),  INT8_C(  79),
+         INT8_C(   0),  INT8_C(  21),  INT8_C(  16),  INT8_C(   8), -INT8_C(  32), -INT8_C(  43), -INT8_C(  27), -INT8_C( 115),
+        -INT8_C(   9), -INT8_C(   2),  INT8_C(  64),  INT8_C( 110),  INT8_C(  76),      INT8_MIN, -INT8_C(   5),  INT8_C(  52) },
+      UINT64_C(  244292308152492835),
+      {  INT8_C(  78),  INT8_C(  90),  INT8_C( 107), -INT8_C(  72), -INT8_C(  18),  INT8_C(  20),  INT8_C(  62),  INT8_C(  10),
+        -INT8_C(  81), -INT8_C(  18), -INT8_C(  10), -INT8_C(  11), -INT8_C(  91), -INT8_C( 105),  INT8_C(   4),  INT8_C(  32),
+        -INT8_C(  33),  INT8_C(   0),  INT8_C(  25),  INT8_C(  94),  INT8_C(  90), -INT8_C(  77),  INT8_C(  53), -INT8_C(  65),
+         INT8_C(   4), -INT8_C(  65), -INT8_C(   2),  INT8_C(   2),  INT8_C( 125), -INT8_C(  11),  INT8_C(  68), -INT8_C(  70),
+         INT8_C(   8),  INT8_C(  60), -INT8_C(   9),  INT8_C(  39),  INT8_C(  35), -INT8_C( 125), -INT8_C( 108),  INT8_C(   0),
+         INT8_C(  96), -INT8_C(  97),  INT8_C(  58), -INT8_C(   1), -INT8_C(   5),  INT8_C(  72), -INT8_C(   5),  INT8_C(   0),
+         INT8_C(  85),  INT8_C(  19), -INT8_C(  10),  INT8_C( 115),  INT8_C(  82),  INT8_C(   0),  INT8_C( 111), -INT8_C(  42),
+        -INT8_C( 112),  INT8_C(  57),  INT8_C(  62), -INT8_C(  43),  INT8_C(  16), -INT8_C(   1),  INT8_C(  83), -INT8_C(   1) },
+      {  INT8_C(   4),  INT8_C(   4), -INT8_C(  63), -INT8_C(  45), -INT8_C(  83),  INT8_C(   2), -INT8_C(   1),  INT8_C(  80),
+         INT8_C(   6),  INT8_C(   6), -INT8_C(   5),  INT8_C(  73), -INT8_C(  66),  INT8_C(   5), -INT8_C(  11), -INT8_C(  33),
+         INT8_C(  80),  INT8_C(   0),  INT8_C(  23),  INT8_C(   5),  INT8_C(  96), -INT8_C(   2),  INT8_C(   4),  INT8_C(   7),
+         INT8_C(   0),  INT8_C(   2), -INT8_C(  18),  INT8_C(   1),  INT8_C(   6),  INT8_C(  79),  INT8_C(   2),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   4),  INT8_C(   7),  INT8_C(   4),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   6),  INT8_C(   4), -INT8_C(   1), -INT8_C(   1),  INT8_C(   2),  INT8_C(   7),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(  16),  INT8_C(   8), -INT8_C(  32),  INT8_C(   0),  INT8_C(   6), -INT8_C( 115),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(  64),  INT8_C( 110),  INT8_C(  76),      INT8_MIN, -INT8_C(   5),  INT8_C(  52) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C( 2137735637883183216),
+      {  INT8_C(   0), -INT8_C(  22),  INT8_C( 119), -INT8_C(   1),  INT8_C(  47), -INT8_C( 114),  INT8_C(  95),  INT8_C(  62),
+        -INT8_C(   4),  INT8_C(   9), -INT8_C( 108),  INT8_C(  52), -INT8_C(  71), -INT8_C(  81),  INT8_C(  16),  INT8_C(   0),
+        -INT8_C(  97),  INT8_C(  13), -INT8_C( 107), -INT8_C(   6), -INT8_C(   1),  INT8_C(  58), -INT8_C(   1), -INT8_C( 100),
+         INT8_C(   0), -INT8_C(  81), -INT8_C(   1), -INT8_C(   9),  INT8_C( 121),  INT8_C(  32),  INT8_C(  32),  INT8_C(  16),
+        -INT8_C( 112),  INT8_C(  68),  INT8_C(  12), -INT8_C( 126),  INT8_C(  16), -INT8_C(  20),  INT8_C( 107), -INT8_C( 115),
+         INT8_C(   1), -INT8_C(   1), -INT8_C(  17), -INT8_C( 100), -INT8_C(   2), -INT8_C( 127), -INT8_C(  27), -INT8_C(  65),
+        -INT8_C(  17),  INT8_C(   6), -INT8_C( 120), -INT8_C(   5), -INT8_C(  13),  INT8_C(  16),  INT8_C(  13),  INT8_C( 122),
+         INT8_C(   3),  INT8_C(  64), -INT8_C( 120), -INT8_C(   1),  INT8_C(  96), -INT8_C(  11), -INT8_C(  65), -INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   8),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   7),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   8),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(18124757382904911963),
+      {  INT8_C(   6), -INT8_C(  88), -INT8_C(  65), -INT8_C(  18), -INT8_C(  57), -INT8_C(   1),  INT8_C(  42),  INT8_C(  57),
+        -INT8_C( 114),  INT8_C(   0), -INT8_C(  81), -INT8_C(  86), -INT8_C(  25),  INT8_C(  19), -INT8_C(   1), -INT8_C(  70),
+         INT8_C( 103),  INT8_C( 126), -INT8_C(  63),  INT8_C(  35), -INT8_C(   1),  INT8_C(   8), -INT8_C( 124),  INT8_C(  76),
+        -INT8_C(   1), -INT8_C(   2),      INT8_MIN,  INT8_C(   8),  INT8_C(  37),  INT8_C(  24), -INT8_C(  83), -INT8_C(  40),
+         INT8_C(  16),  INT8_C(   0), -INT8_C(  33),  INT8_C(  59),  INT8_C( 122), -INT8_C(  69),  INT8_C(  76), -INT8_C(   7),
+        -INT8_C( 110),  INT8_C(   8),  INT8_C(   0), -INT8_C(  38), -INT8_C(  37), -INT8_C(  17), -INT8_C(   6), -INT8_C( 106),
+         INT8_C(  21),  INT8_C(  31), -INT8_C(  66),  INT8_C(  43), -INT8_C(  56),  INT8_C(   0), -INT8_C( 127),  INT8_C(  32),
+         INT8_C(  33), -INT8_C(   1),  INT8_C(  31),  INT8_C(   9), -INT8_C(  68), -INT8_C(   1),  INT8_C( 122), -INT8_C(  35) },
+      {  INT8_C(   2),  INT8_C(   3),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   5),  INT8_C(   6),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   6),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   8),  INT8_C(   0),  INT8_C(   2),  INT8_C(   5),  INT8_C(   8),  INT8_C(   5),  INT8_C(   6) } },
+    { UINT64_C( 7237023418408751709),
+      {  INT8_C(  50), -INT8_C(   3), -INT8_C(  26),      INT8_MIN,  INT8_C(  25), -INT8_C(  17), -INT8_C( 103), -INT8_C(  34),
+         INT8_C(   1), -INT8_C(   9),  INT8_C(  93), -INT8_C(  88),  INT8_C(   4), -INT8_C(  33), -INT8_C(  17), -INT8_C(  30),
+        -INT8_C(  22), -INT8_C(   3), -INT8_C(   2), -INT8_C( 120), -INT8_C(  39), -INT8_C(   1), -INT8_C(  87), -INT8_C(   4),
+        -INT8_C(  15),  INT8_C(  16),      INT8_MIN, -INT8_C(  71), -INT8_C(   1), -INT8_C(  10), -INT8_C(  60), -INT8_C(   1),
+        -INT8_C(  13), -INT8_C(  33),  INT8_C(   0),  INT8_C(   1), -INT8_C( 124),  INT8_C(  67),  INT8_C(   0),  INT8_C(   3),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(  89),  INT8_C(  66),  INT8_C(  64),  INT8_C(  25),  INT8_C(   0), -INT8_C(  80),
+        -INT8_C(   1), -INT8_C(  65),  INT8_C(  13), -INT8_C(  33), -INT8_C(  59),  INT8_C( 108), -INT8_C(   9),  INT8_C(  36),
+         INT8_C(   0), -INT8_C(  92), -INT8_C(   1), -INT8_C(   1), -INT8_C(  13),  INT8_C(  24), -INT8_C(   1), -INT8_C(  54) },
+      {  INT8_C(   3),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   7),  INT8_C(   7),  INT8_C(   2),  INT8_C(   0),  INT8_C(   8),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   8),  INT8_C(   7),  INT8_C(   3),  INT8_C(   7),  INT8_C(   0),  INT8_C(   4),  INT8_C(   7),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   8),  INT8_C(   0) } },
+    { UINT64_C(  504203184169308017),
+      {  INT8_C(  23), -INT8_C(  53),  INT8_C( 113), -INT8_C(  37),  INT8_C(   9), -INT8_C( 125),      INT8_MAX, -INT8_C(   1),
+        -INT8_C(  68),  INT8_C(   1),  INT8_C(  17), -INT8_C(  50),  INT8_C(   0), -INT8_C(   1),  INT8_C(  86),  INT8_C(  44),
+        -INT8_C(  17),  INT8_C(   0), -INT8_C(   9),  INT8_C(   1),  INT8_C(  54),  INT8_C(   0),  INT8_C(  51), -INT8_C(   1),
+        -INT8_C(  69), -INT8_C( 116), -INT8_C( 106), -INT8_C(  30), -INT8_C( 112), -INT8_C(  87), -INT8_C(  33), -INT8_C(  13),
+         INT8_C(  36), -INT8_C(   1), -INT8_C(  62),  INT8_C(  42),  INT8_C(  64),  INT8_C(  13), -INT8_C(   1), -INT8_C(  66),
+         INT8_C(  42),  INT8_C(  54), -INT8_C(  73), -INT8_C(   3), -INT8_C(   1), -INT8_C(  67),  INT8_C(   1),  INT8_C(  11),
+        -INT8_C(  38), -INT8_C(  51), -INT8_C(  17), -INT8_C(  33), -INT8_C(  16), -INT8_C(   1), -INT8_C(   1), -INT8_C(   7),
+        -INT8_C(  10), -INT8_C(  67), -INT8_C(  69), -INT8_C(  22),  INT8_C( 107), -INT8_C(  21), -INT8_C(   8),  INT8_C(  38) },
+      {  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   3),  INT8_C(   7),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   1),  INT8_C(   2),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(   3),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   7),  INT8_C(   6),
+         INT8_C(   2),  INT8_C(   8),  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   5),  INT8_C(   7),  INT8_C(   7),  INT8_C(   4),  INT8_C(   8),  INT8_C(   8),  INT8_C(   6),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(16557482063221339631),
+      { -INT8_C(  65), -INT8_C(   1), -INT8_C(  64),  INT8_C(  93),  INT8_C(   6),  INT8_C(  20), -INT8_C(  51), -INT8_C(   3),
+        -INT8_C( 107),  INT8_C(  36),  INT8_C(  71),  INT8_C(   3), -INT8_C(  81), -INT8_C( 127), -INT8_C(  83),  INT8_C(  67),
+         INT8_C(  65), -INT8_C( 119), -INT8_C(   1),  INT8_C(   8), -INT8_C(  20),  INT8_C( 102),  INT8_C(  57),  INT8_C(  37),
+        -INT8_C(  87),  INT8_C(  96),  INT8_C( 109), -INT8_C(   3),  INT8_C(  89),  INT8_C(  84), -INT8_C(   3),  INT8_C( 115),
+         INT8_C(   0), -INT8_C(  11), -INT8_C(  76), -INT8_C(  54),  INT8_C(  64), -INT8_C(  11),  INT8_C(  21), -INT8_C(  23),
+        -INT8_C(  18), -INT8_C(   9),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73),  INT8_C(   8), -INT8_C(  53), -INT8_C(  29),
+         INT8_C(  30), -INT8_C(  44),  INT8_C(   9),  INT8_C( 121),  INT8_C(   0), -INT8_C(  35),  INT8_C( 120),  INT8_C(  39),
+        -INT8_C(  29), -INT8_C(  36), -INT8_C(  36), -INT8_C(   1), -INT8_C(  31),  INT8_C( 112), -INT8_C(  61),  INT8_C(   0) },
+      {  INT8_C(   7),  INT8_C(   8),  INT8_C(   2),  INT8_C(   5),  INT8_C(   0),  INT8_C(   2),  INT8_C(   5),  INT8_C(   7),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   6),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   4),  INT8_C(   0),  INT8_C(   1),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1),  INT8_C(   5),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),  INT8_C(   0) } },
+    { UINT64_C( 5530158843683090467),
+      { -INT8_C(  12),  INT8_C(   1),  INT8_C(  32),  INT8_C(  18),  INT8_C(  78),  INT8_C(  66),  INT8_C(   0),  INT8_C( 110),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(  89), -INT8_C(  44), -INT8_C(  18),  INT8_C(   2),  INT8_C(  20),
+        -INT8_C(  78), -INT8_C(   3),  INT8_C(  64),  INT8_C(  77), -INT8_C(  36),  INT8_C(  24),  INT8_C(   0), -INT8_C(  17),
+         INT8_C(  71),  INT8_C(  64), -INT8_C(  97),  INT8_C(  55), -INT8_C(  74), -INT8_C(  76), -INT8_C(  15),  INT8_C(  12),
+        -INT8_C(  30),  INT8_C( 105), -INT8_C(  33), -INT8_C(  37), -INT8_C(   1),  INT8_C(  34), -INT8_C(  22),  INT8_C(   3),
+        -INT8_C(  96), -INT8_C(  71), -INT8_C( 106), -INT8_C(   1),  INT8_C(  13), -INT8_C( 107), -INT8_C( 125),  INT8_C(   0),
+         INT8_C(  76), -INT8_C(  60), -INT8_C( 126),  INT8_C(   2),      INT8_MAX,  INT8_C( 100),  INT8_C(   0), -INT8_C(  98),
+         INT8_C(   2), -INT8_C( 112),  INT8_C(  45),  INT8_C( 124),      INT8_MIN, -INT8_C(   6), -INT8_C(   1),  INT8_C(   1) },
+      {  INT8_C(   5),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   7),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   7),  INT8_C(   3),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0) } },
+    { UINT64_C(16816628198835363247),
+      { -INT8_C(  21),  INT8_C(   0),  INT8_C(  36),  INT8_C( 123), -INT8_C(  43),  INT8_C(   8),  INT8_C(  64), -INT8_C(  53),
+        -INT8_C(  33), -INT8_C(   1), -INT8_C(  35), -INT8_C(  36),  INT8_C(  23),  INT8_C(  64), -INT8_C(  25), -INT8_C(  70),
+        -INT8_C(   3), -INT8_C(  84),  INT8_C(  34),  INT8_C( 121),  INT8_C(   0),  INT8_C(   1), -INT8_C(   1),  INT8_C(  52),
+        -INT8_C(  81),  INT8_C(  30), -INT8_C(  66), -INT8_C(  65),  INT8_C(   0),  INT8_C(  79), -INT8_C(  95), -INT8_C(   1),
+        -INT8_C(   1),  INT8_C(  58), -INT8_C(  54), -INT8_C(  44), -INT8_C(  11),  INT8_C(  14),  INT8_C(  89), -INT8_C(   1),
+        -INT8_C(  35),      INT8_MIN, -INT8_C(  46),  INT8_C(  17),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(  65), -INT8_C(  95),  INT8_C(  69), -INT8_C(  43), -INT8_C(   1),  INT8_C(   8),  INT8_C(   2),  INT8_C(  57),
+         INT8_C(  64),  INT8_C(  52),  INT8_C(  57), -INT8_C(   5), -INT8_C( 115),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0) },
+      {  INT8_C(   6),  INT8_C(   0),  INT8_C(   2),  INT8_C(   6),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   7),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(   4),  INT8_C(   6),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0) } },
+    { UINT64_C(16249856851641904797),
+      { -INT8_C(   6),  INT8_C(   0),  INT8_C(  69), -INT8_C(  17),  INT8_C(   8),  INT8_C(  84),  INT8_C(   5), -INT8_C(   1),
+        -INT8_C(  96),  INT8_C(  95),  INT8_C(  33),  INT8_C(   3), -INT8_C(  60),  INT8_C(   1),  INT8_C(  86),  INT8_C( 116),
+             INT8_MIN,  INT8_C(   8),  INT8_C(  48),  INT8_C(  60), -INT8_C(   1), -INT8_C(  97), -INT8_C(   1),  INT8_C(  51),
+        -INT8_C(  35), -INT8_C(   1),  INT8_C(  13), -INT8_C(   3),  INT8_C(  40), -INT8_C(   2), -INT8_C(  58),  INT8_C(  64),
+         INT8_C(  87),      INT8_MIN, -INT8_C(  96),  INT8_C(   0),  INT8_C( 124), -INT8_C(   1),  INT8_C(  87), -INT8_C(   1),
+         INT8_C(  20),  INT8_C(   0),  INT8_C(   2), -INT8_C(  17),      INT8_MAX,  INT8_C(  63),  INT8_C( 124), -INT8_C(  58),
+        -INT8_C(  21), -INT8_C(  13),  INT8_C(   0), -INT8_C(  85), -INT8_C( 111),  INT8_C(  50), -INT8_C(  62),  INT8_C(  16),
+         INT8_C(   0), -INT8_C(   7),  INT8_C(  74), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  56),  INT8_C(  39) },
+      {  INT8_C(   6),  INT8_C(   0),  INT8_C(   3),  INT8_C(   7),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   2),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(   0),  INT8_C(   3),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   5),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   3),  INT8_C(   4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C(     0),  INT16_C( 22706), -INT16_C(  8194), -INT16_C(  4899), -INT16_C(   257), -INT16_C( 25722), -INT16_C(    93),  INT16_C( 24495),
+         INT16_C(     4),  INT16_C(  8256),  INT16_C( 26038), -INT16_C( 24096),  INT16_C( 32430),  INT16_C(     1), -INT16_C(  2392),  INT16_C(  3279),
+        -INT16_C(  8135),  INT16_C(  3577), -INT16_C(     1), -INT16_C( 16395),  INT16_C(    36),  INT16_C(    32),  INT16_C(  4096), -INT16_C( 24974),
+              INT16_MIN,       INT16_MAX, -INT16_C( 17137),  INT16_C( 28209), -INT16_C( 28522),  INT16_C(  7168), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     7),  INT16_C(    14),  INT16_C(    11),  INT16_C(    15),  INT16_C(     8),  INT16_C(    12),  INT16_C(    12),
+         INT16_C(     1),  INT16_C(     2),  INT16_C(     9),  INT16_C(     6),  INT16_C(    11),  INT16_C(     1),  INT16_C(     9),  INT16_C(     8),
+         INT16_C(     7),  INT16_C(     9),  INT16_C(    16),  INT16_C(    13),  INT16_C(     2),  INT16_C(     1),  INT16_C(     1),  INT16_C(     9),
+         INT16_C(     1),  INT16_C(    15),  INT16_C(    10),  INT16_C(     8),  INT16_C(     6),  INT16_C(     3),  INT16_C(    16),  INT16_C(    16) } },
+    { { -INT16_C(  4642), -INT16_C( 12408), -INT16_C(   129), -INT16_C(     3), -INT16_C(    65),  INT16_C( 29532),  INT16_C(     1),       INT16_MIN,
+         INT16_C( 24160),  INT16_C( 28670), -INT16_C(  1049),  INT16_C(     1),  INT16_C(  9828),  INT16_C( 23709), -INT16_C( 17191), -INT16_C(    33),
+         INT16_C( 12068),  INT16_C(  5640),  INT16_C( 26093), -INT16_C( 26005),  INT16_C( 16834),  INT16_C( 16896), -INT16_C(  8321), -INT16_C( 12581),
+         INT16_C( 24319), -INT16_C( 10369), -INT16_C(  1025), -INT16_C(     5),  INT16_C(  9456),  INT16_C(  2181), -INT16_C(  4105),  INT16_C(   256) },
+      {  INT16_C(    12),  INT16_C(     8),  INT16_C(    15),  INT16_C(    15),  INT16_C(    15),  INT16_C(     9),  INT16_C(     1),  INT16_C(     1),
+         INT16_C(     7),  INT16_C(    13),  INT16_C(    13),  INT16_C(     1),  INT16_C(     6),  INT16_C(     9),  INT16_C(    10),  INT16_C(    15),
+         INT16_C(     7),  INT16_C(     4),  INT16_C(    10),  INT16_C(     9),  INT16_C(     5),  INT16_C(     2),  INT16_C(    14),  INT16_C(    11),
+         INT16_C(    13),  INT16_C(    13),  INT16_C(    15),  INT16_C(    15),  INT16_C(     6),  INT16_C(     4),  INT16_C(    14),  INT16_C(     1) } },
+    { { -INT16_C( 22302), -INT16_C(  7772),  INT16_C( 25129),  INT16_C( 27515), -INT16_C(  2113), -INT16_C( 28672),  INT16_C( 21083),  INT16_C(  4318),
+        -INT16_C(   184), -INT16_C(  9048),  INT16_C( 14735),  INT16_C(     0), -INT16_C( 20343), -INT16_C(     1),  INT16_C( 10880),  INT16_C( 11155),
+        -INT16_C( 23425),  INT16_C(  2050),  INT16_C(  3470),  INT16_C( 11888),  INT16_C(  4100),  INT16_C(  2056),  INT16_C(  1074), -INT16_C( 32764),
+        -INT16_C(   257),  INT16_C(    96), -INT16_C(  1287), -INT16_C( 16088), -INT16_C( 11511),  INT16_C(     0), -INT16_C(   641), -INT16_C( 17441) },
+      {  INT16_C(     7),  INT16_C(     7),  INT16_C(     6),  INT16_C(    11),  INT16_C(    14),  INT16_C(     2),  INT16_C(     8),  INT16_C(     7),
+         INT16_C(    10),  INT16_C(     8),  INT16_C(     9),  INT16_C(     0),  INT16_C(     6),  INT16_C(    16),  INT16_C(     4),  INT16_C(     8),
+         INT16_C(    10),  INT16_C(     2),  INT16_C(     7),  INT16_C(     7),  INT16_C(     2),  INT16_C(     2),  INT16_C(     4),  INT16_C(     2),
+         INT16_C(    15),  INT16_C(     2),  INT16_C(    12),  INT16_C(     5),  INT16_C(     7),  INT16_C(     0),  INT16_C(    14),  INT16_C(    13) } },
+    { {  INT16_C( 23491), -INT16_C( 19977), -INT16_C(   321),  INT16_C( 25712),  INT16_C(  4119),  INT16_C(  5673),  INT16_C( 15017),  INT16_C(   660),
+         INT16_C( 28199), -INT16_C( 20068),  INT16_C( 15909), -INT16_C( 11841), -INT16_C( 21284),  INT16_C( 20361), -INT16_C(   273), -INT16_C(     1),
+         INT16_C(  2138), -INT16_C(  8193),       INT16_MIN,  INT16_C( 10234), -INT16_C(  1025), -INT16_C( 26529), -INT16_C(   274), -INT16_C( 20481),
+        -INT16_C( 32736),  INT16_C(  8311),       INT16_MIN,  INT16_C( 20078), -INT16_C( 15809), -INT16_C(  2049), -INT16_C(  3484),  INT16_C(  2402) },
+      {  INT16_C(     9),  INT16_C(    11),  INT16_C(    14),  INT16_C(     6),  INT16_C(     5),  INT16_C(     6),  INT16_C(     8),  INT16_C(     4),
+         INT16_C(     9),  INT16_C(     8),  INT16_C(     8),  INT16_C(    11),  INT16_C(     9),  INT16_C(     8),  INT16_C(    14),  INT16_C(    16),
+         INT16_C(     5),  INT16_C(    15),  INT16_C(     1),  INT16_C(    10),  INT16_C(    15),  INT16_C(     9),  INT16_C(    13),  INT16_C(    14),
+         INT16_C(     2),  INT16_C(     7),  INT16_C(     1),  INT16_C(     9),  INT16_C(     9),  INT16_C(    15),  INT16_C(     8),  INT16_C(     5) } },
+    { { -INT16_C(  2971),  INT16_C(     0),  INT16_C( 27209),  INT16_C(     2),  INT16_C(  6144), -INT16_C(  1617), -INT16_C( 25824), -INT16_C( 20325),
+         INT16_C(     8), -INT16_C( 21096),  INT16_C(     8), -INT16_C(    19), -INT16_C( 22171),  INT16_C(  1511), -INT16_C(  2049), -INT16_C(     1),
+        -INT16_C( 23637), -INT16_C(  4099),  INT16_C( 19932),  INT16_C(  8200),  INT16_C( 20484),  INT16_C( 26495), -INT16_C(  2309), -INT16_C( 32190),
+        -INT16_C(  3073), -INT16_C( 29876),  INT16_C( 32621),  INT16_C(   256),  INT16_C( 13887), -INT16_C(     1), -INT16_C( 22982), -INT16_C(  4335) },
+      {  INT16_C(     9),  INT16_C(     0),  INT16_C(     7),  INT16_C(     1),  INT16_C(     2),  INT16_C(    12),  INT16_C(     6),  INT16_C(     8),
+         INT16_C(     1),  INT16_C(     8),  INT16_C(     1),  INT16_C(    14),  INT16_C(     8),  INT16_C(     8),  INT16_C(    15),  INT16_C(    16),
+         INT16_C(     9),  INT16_C(    14),  INT16_C(     9),  INT16_C(     2),  INT16_C(     3),  INT16_C(    12),  INT16_C(    13),  INT16_C(     4),
+         INT16_C(    14),  INT16_C(     7),  INT16_C(    12),  INT16_C(     1),  INT16_C(    10),  INT16_C(    16),  INT16_C(     8),  INT16_C(     9) } },
+    { {  INT16_C(  2077), -INT16_C( 20085),  INT16_C( 26255),  INT16_C(  1449),  INT16_C( 28392), -INT16_C(     5), -INT16_C( 28705),  INT16_C(  6406),
+        -INT16_C(     3), -INT16_C( 17942), -INT16_C(  4113), -INT16_C(  1297), -INT16_C(     1),  INT16_C(    68), -INT16_C(   517), -INT16_C( 14256),
+         INT16_C( 16897),  INT16_C( 23896),  INT16_C(    56), -INT16_C( 27598),  INT16_C(    32),  INT16_C( 19459), -INT16_C(  6021),  INT16_C( 17054),
+         INT16_C( 18432),  INT16_C(  6795),  INT16_C( 24575),  INT16_C( 13978), -INT16_C( 12986),  INT16_C(  8848),  INT16_C(  8192),  INT16_C( 16640) },
+      {  INT16_C(     5),  INT16_C(     8),  INT16_C(     9),  INT16_C(     6),  INT16_C(     9),  INT16_C(    15),  INT16_C(    12),  INT16_C(     5),
+         INT16_C(    15),  INT16_C(    10),  INT16_C(    14),  INT16_C(    13),  INT16_C(    16),  INT16_C(     2),  INT16_C(    14),  INT16_C(     5),
+         INT16_C(     3),  INT16_C(     8),  INT16_C(     3),  INT16_C(     6),  INT16_C(     1),  INT16_C(     5),  INT16_C(    10),  INT16_C(     7),
+         INT16_C(     2),  INT16_C(     7),  INT16_C(    14),  INT16_C(     8),  INT16_C(     8),  INT16_C(     4),  INT16_C(     1),  INT16_C(     2) } },
+    { {  INT16_C(   272),  INT16_C( 31530), -INT16_C( 16186),  INT16_C( 29133), -INT16_C(  8193), -INT16_C(   129), -INT16_C(   257),  INT16_C(  9232),
+        -INT16_C(  9822),  INT16_C( 32701),  INT16_C( 16383),  INT16_C(   116), -INT16_C(  1057), -INT16_C(    18), -INT16_C( 18992), -INT16_C(     1),
+        -INT16_C( 32212), -INT16_C(  8866),  INT16_C( 32761), -INT16_C( 29642),  INT16_C( 24542), -INT16_C( 21538),  INT16_C( 26471),  INT16_C(     2),
+        -INT16_C(  8193), -INT16_C( 12359), -INT16_C( 28819), -INT16_C(    35), -INT16_C(     1), -INT16_C(  2049), -INT16_C(   257),  INT16_C( 17706) },
+      {  INT16_C(     2),  INT16_C(     9),  INT16_C(     6),  INT16_C(     9),  INT16_C(    15),  INT16_C(    15),  INT16_C(    15),  INT16_C(     3),
+         INT16_C(     8),  INT16_C(    13),  INT16_C(    14),  INT16_C(     4),  INT16_C(    14),  INT16_C(    14),  INT16_C(     8),  INT16_C(    16),
+         INT16_C(     5),  INT16_C(    11),  INT16_C(    13),  INT16_C(     7),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     1),
+         INT16_C(    15),  INT16_C(    11),  INT16_C(    10),  INT16_C(    14),  INT16_C(    16),  INT16_C(    15),  INT16_C(    15),  INT16_C(     6) } },
+    { { -INT16_C(  8193), -INT16_C( 32340), -INT16_C(  4103),  INT16_C( 20405),  INT16_C(  1056),  INT16_C(     0),  INT16_C( 31057), -INT16_C(  3073),
+        -INT16_C( 17728), -INT16_C(  3073), -INT16_C(  8193),  INT16_C( 10670),  INT16_C(    64), -INT16_C(  6868), -INT16_C(  9860), -INT16_C(  2181),
+         INT16_C( 17412),  INT16_C(  1536), -INT16_C( 32704),  INT16_C( 16436), -INT16_C( 16929), -INT16_C(   517), -INT16_C(    29),  INT16_C(    20),
+         INT16_C(   136),  INT16_C(     0),  INT16_C( 30364),  INT16_C( 13698),  INT16_C( 11378), -INT16_C( 31742),  INT16_C( 16383),  INT16_C( 29699) },
+      {  INT16_C(    15),  INT16_C(     6),  INT16_C(    13),  INT16_C(    10),  INT16_C(     2),  INT16_C(     0),  INT16_C(     8),  INT16_C(    14),
+         INT16_C(     7),  INT16_C(    14),  INT16_C(    15),  INT16_C(     8),  INT16_C(     1),  INT16_C(     8),  INT16_C(    10),  INT16_C(    13),
+         INT16_C(     3),  INT16_C(     2),  INT16_C(     2),  INT16_C(     4),  INT16_C(    13),  INT16_C(    14),  INT16_C(    13),  INT16_C(     2),
+         INT16_C(     2),  INT16_C(     0),  INT16_C(     9),  INT16_C(     6),  INT16_C(     7),  INT16_C(     3),  INT16_C(    14),  INT16_C(     6) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi16(a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C( 32253), -INT16_C(  3343), -INT16_C(  8482), -INT16_C( 32759), -INT16_C( 25165),  INT16_C(  2240),  INT16_C(    64), -INT16_C(  8705),
+         INT16_C( 13823), -INT16_C( 30700),  INT16_C(     0),  INT16_C( 20665), -INT16_C( 28670),  INT16_C( 25231), -INT16_C( 17537), -INT16_C( 32702),
+        -INT16_C( 27278),  INT16_C(  8193), -INT16_C( 16531), -INT16_C( 15434),  INT16_C(     0), -INT16_C(     9), -INT16_C(  8304), -INT16_C(  3723),
+         INT16_C(   512), -INT16_C(  1025),  INT16_C( 24563),  INT16_C( 18217),  INT16_C(  1622), -INT16_C( 31735), -INT16_C(  3791), -INT16_C( 20012) },
+      UINT32_C(3192321547),
+      {  INT16_C(     0),  INT16_C( 26458),  INT16_C( 16632),  INT16_C( 16247),  INT16_C( 23391), -INT16_C(     1), -INT16_C(  2213),  INT16_C(  4153),
+        -INT16_C( 28656),  INT16_C( 19588), -INT16_C(  1228),  INT16_C(  9532), -INT16_C( 22157), -INT16_C( 26881),  INT16_C( 11748), -INT16_C( 28726),
+         INT16_C(   130), -INT16_C( 16449), -INT16_C( 21434),  INT16_C( 25943), -INT16_C(     1), -INT16_C(  8193), -INT16_C(  1187), -INT16_C(    99),
+         INT16_C( 11967),  INT16_C( 25943), -INT16_C(    25), -INT16_C( 29725),  INT16_C(    66),  INT16_C( 16645),  INT16_C(  6303), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     9), -INT16_C(  8482),  INT16_C(    12), -INT16_C( 25165),  INT16_C(  2240),  INT16_C(    64), -INT16_C(  8705),
+         INT16_C( 13823),  INT16_C(     5),  INT16_C(    10),  INT16_C( 20665),  INT16_C(     9),  INT16_C(    12),  INT16_C(     8),  INT16_C(     9),
+        -INT16_C( 27278),  INT16_C(    14),  INT16_C(     7), -INT16_C( 15434),  INT16_C(     0), -INT16_C(     9),  INT16_C(    12), -INT16_C(  3723),
+         INT16_C(   512),  INT16_C(     9),  INT16_C(    14),  INT16_C(     9),  INT16_C(     2),  INT16_C(     4), -INT16_C(  3791),  INT16_C(    16) } },
+    { {  INT16_C(  8531),  INT16_C(  9161), -INT16_C(  4271), -INT16_C(     1),  INT16_C( 16385), -INT16_C(  1545),  INT16_C(  5117), -INT16_C( 15450),
+         INT16_C(     0),  INT16_C( 18884), -INT16_C(  6407), -INT16_C( 24594),  INT16_C(  7418), -INT16_C(   129), -INT16_C(  2049), -INT16_C(   260),
+        -INT16_C( 13834), -INT16_C( 19457), -INT16_C(  1153),  INT16_C( 14470),  INT16_C( 16384),  INT16_C(   128), -INT16_C(   913), -INT16_C(  2049),
+        -INT16_C( 13741),  INT16_C( 32750), -INT16_C( 20423), -INT16_C(  2081),  INT16_C(  4674),  INT16_C(  1025), -INT16_C(     3), -INT16_C(     3) },
+      UINT32_C(2125913760),
+      {  INT16_C(   518),  INT16_C( 29019), -INT16_C(    18),  INT16_C(  1281), -INT16_C( 18083), -INT16_C(  2053),  INT16_C( 15877), -INT16_C(  2185),
+         INT16_C( 28357), -INT16_C( 13095), -INT16_C(  4609), -INT16_C(  7681), -INT16_C( 30113), -INT16_C(  3411), -INT16_C( 31743),  INT16_C(     1),
+         INT16_C(  9844), -INT16_C(   225), -INT16_C(  7602),  INT16_C(     0), -INT16_C( 11552),  INT16_C(  7074),  INT16_C( 31803), -INT16_C(  3089),
+         INT16_C( 16656),  INT16_C(  4129),  INT16_C(   207), -INT16_C( 10371),  INT16_C(  4000),  INT16_C(    64), -INT16_C(  1025), -INT16_C(   514) },
+      {  INT16_C(  8531),  INT16_C(  9161), -INT16_C(  4271), -INT16_C(     1),  INT16_C( 16385),  INT16_C(    14),  INT16_C(  5117),  INT16_C(    13),
+         INT16_C(     0),  INT16_C(     9),  INT16_C(    14),  INT16_C(    12),  INT16_C(     9), -INT16_C(   129),  INT16_C(     3),  INT16_C(     1),
+        -INT16_C( 13834),  INT16_C(    13),  INT16_C(     8),  INT16_C( 14470),  INT16_C(     7),  INT16_C(     7), -INT16_C(   913),  INT16_C(    13),
+        -INT16_C( 13741),  INT16_C(     3),  INT16_C(     6),  INT16_C(    12),  INT16_C(     6),  INT16_C(     1),  INT16_C(    15), -INT16_C(     3) } },
+    { {  INT16_C( 17921), -INT16_C( 15568), -INT16_C(     5),  INT16_C( 10390),  INT16_C(  1248), -INT16_C(     7), -INT16_C(  4097), -INT16_C(   258),
+         INT16_C(  8200), -INT16_C( 13732), -INT16_C( 32281),  INT16_C(  1024), -INT16_C( 22774),  INT16_C( 16392), -INT16_C( 31449),  INT16_C( 28093),
+        -INT16_C( 14152), -INT16_C(     1), -INT16_C( 22354), -INT16_C( 32767), -INT16_C(   385),  INT16_C( 24576),  INT16_C( 22823), -INT16_C(     1),
+        -INT16_C( 23028), -INT16_C( 32704), -INT16_C(  8329), -INT16_C(    67), -INT16_C(  2796), -INT16_C(  9369),  INT16_C(   128), -INT16_C(  2049) },
+      UINT32_C(3712464465),
+      { -INT16_C(  8852),  INT16_C( 24891), -INT16_C(   265),  INT16_C( 28016),  INT16_C(   320),  INT16_C(  8224), -INT16_C( 17067),  INT16_C( 24573),
+         INT16_C(    32),  INT16_C( 29543),  INT16_C( 15150),  INT16_C( 21056),  INT16_C(  8593), -INT16_C( 21777), -INT16_C(  7021),  INT16_C(  8608),
+         INT16_C( 24595),  INT16_C( 20230),  INT16_C( 30702), -INT16_C( 12072), -INT16_C(     1),  INT16_C(    36),  INT16_C(   384),  INT16_C( 26285),
+         INT16_C(  4901),  INT16_C( 27839), -INT16_C( 26940), -INT16_C(     1),  INT16_C(  1088),  INT16_C(    42), -INT16_C(  2570),  INT16_C(  1024) },
+      {  INT16_C(    10), -INT16_C( 15568), -INT16_C(     5),  INT16_C( 10390),  INT16_C(     2), -INT16_C(     7),  INT16_C(    10), -INT16_C(   258),
+         INT16_C(  8200),  INT16_C(    10),  INT16_C(     9),  INT16_C(  1024),  INT16_C(     5),  INT16_C(    11), -INT16_C( 31449),  INT16_C(     4),
+         INT16_C(     5),  INT16_C(     7),  INT16_C(    12), -INT16_C( 32767), -INT16_C(   385),  INT16_C( 24576),  INT16_C(     2), -INT16_C(     1),
+         INT16_C(     6), -INT16_C( 32704),  INT16_C(     7),  INT16_C(    16),  INT16_C(     2), -INT16_C(  9369),  INT16_C(    12),  INT16_C(     1) } },
+    { {  INT16_C(   544),  INT16_C(  6308),  INT16_C(   269), -INT16_C(     3), -INT16_C( 31564), -INT16_C( 32760), -INT16_C(  9860), -INT16_C( 20932),
+        -INT16_C(  1025), -INT16_C( 26579), -INT16_C(     1), -INT16_C( 24931), -INT16_C( 28664), -INT16_C(     3), -INT16_C(    65),  INT16_C(   768),
+        -INT16_C(  6215),  INT16_C(     0), -INT16_C(    18),  INT16_C( 10240), -INT16_C( 14294), -INT16_C( 15581), -INT16_C(  2874),  INT16_C( 16530),
+         INT16_C( 19364),  INT16_C(  2048),  INT16_C( 16384),  INT16_C( 32759),       INT16_MIN, -INT16_C( 17742),  INT16_C(  4736), -INT16_C(  4736) },
+      UINT32_C(2855876354),
+      {  INT16_C( 17872),  INT16_C( 27503),  INT16_C( 16384),  INT16_C( 15945),  INT16_C( 16384),  INT16_C(  8448),  INT16_C( 13768),  INT16_C(     0),
+        -INT16_C(  8152), -INT16_C(  2053), -INT16_C(  2049),  INT16_C( 22552),  INT16_C(  2322),  INT16_C(    10),  INT16_C( 27917),  INT16_C(    32),
+        -INT16_C( 26721),  INT16_C( 22479),  INT16_C(  1425), -INT16_C(  1111), -INT16_C( 17473), -INT16_C( 26362),  INT16_C(     6),  INT16_C( 23801),
+        -INT16_C( 21806),  INT16_C( 18115),  INT16_C(  8175),  INT16_C( 24897), -INT16_C(    11), -INT16_C( 10935), -INT16_C( 13425),  INT16_C( 28004) },
+      {  INT16_C(   544),  INT16_C(    11),  INT16_C(   269), -INT16_C(     3), -INT16_C( 31564), -INT16_C( 32760), -INT16_C(  9860), -INT16_C( 20932),
+         INT16_C(     5),  INT16_C(    14),  INT16_C(    15), -INT16_C( 24931),  INT16_C(     4),  INT16_C(     2), -INT16_C(    65),  INT16_C(   768),
+         INT16_C(    11),  INT16_C(     0), -INT16_C(    18),  INT16_C(    11),  INT16_C(    13),  INT16_C(     6), -INT16_C(  2874),  INT16_C( 16530),
+         INT16_C( 19364),  INT16_C(     7),  INT16_C( 16384),  INT16_C(     5),       INT16_MIN,  INT16_C(     8),  INT16_C(  4736),  INT16_C(     8) } },
+    { {  INT16_C( 28681),  INT16_C(  2761), -INT16_C( 23051), -INT16_C( 10665),  INT16_C(   512),  INT16_C( 11280),  INT16_C(  1345),  INT16_C(  1274),
+         INT16_C(  6550),  INT16_C( 21967), -INT16_C(   813), -INT16_C(  2049), -INT16_C( 11870), -INT16_C(   129),  INT16_C( 28600), -INT16_C( 15343),
+         INT16_C(  2451),  INT16_C(   320),  INT16_C(    66),  INT16_C( 22693),  INT16_C( 14379), -INT16_C(  7950), -INT16_C(  8417), -INT16_C( 27643),
+        -INT16_C( 30838),  INT16_C( 20426), -INT16_C(   686),  INT16_C(    32),  INT16_C( 21743), -INT16_C( 29755), -INT16_C(   261), -INT16_C(  2049) },
+      UINT32_C( 458725826),
+      { -INT16_C( 29759),  INT16_C(  1024),  INT16_C( 19433),  INT16_C( 10254),  INT16_C(  1152), -INT16_C(   657),  INT16_C(  7278), -INT16_C( 28946),
+        -INT16_C(     2),  INT16_C(   769),  INT16_C(  3999),  INT16_C( 12987), -INT16_C(  1065), -INT16_C( 23514),  INT16_C(  2624),  INT16_C( 29934),
+         INT16_C( 15841), -INT16_C(  1026),  INT16_C( 15530), -INT16_C(  4113), -INT16_C( 23234), -INT16_C(  2209),  INT16_C(  6050),  INT16_C(  2065),
+              INT16_MAX, -INT16_C( 28031),  INT16_C(     8),  INT16_C( 28541),  INT16_C( 25475), -INT16_C(  1924), -INT16_C(  8448),  INT16_C(  2716) },
+      {  INT16_C( 28681),  INT16_C(     1), -INT16_C( 23051), -INT16_C( 10665),  INT16_C(   512),  INT16_C( 11280),  INT16_C(     8),  INT16_C(    10),
+         INT16_C(    15),  INT16_C( 21967), -INT16_C(   813),  INT16_C(     9),  INT16_C(    13), -INT16_C(   129),  INT16_C( 28600),  INT16_C(    10),
+         INT16_C(     9),  INT16_C(    14),  INT16_C(     8),  INT16_C( 22693),  INT16_C(     9), -INT16_C(  7950),  INT16_C(     7), -INT16_C( 27643),
+         INT16_C(    15),  INT16_C(     5), -INT16_C(   686),  INT16_C(    12),  INT16_C(     7), -INT16_C( 29755), -INT16_C(   261), -INT16_C(  2049) } },
+    { {  INT16_C( 27968),  INT16_C( 16367), -INT16_C(  1162), -INT16_C(  4073), -INT16_C(   448), -INT16_C(     1),  INT16_C(  4144),  INT16_C(  4113),
+         INT16_C(     0),  INT16_C( 16656),  INT16_C( 18688), -INT16_C( 18114), -INT16_C( 11040),  INT16_C( 11328),  INT16_C( 13082),  INT16_C( 27011),
+         INT16_C(   520), -INT16_C( 12421),  INT16_C(  1686),  INT16_C(  8192),  INT16_C(  7980),  INT16_C(  8192),  INT16_C(  5132),  INT16_C(  1461),
+        -INT16_C( 13135), -INT16_C(  3504),  INT16_C(  6316), -INT16_C(     1),  INT16_C(  2050), -INT16_C(    33), -INT16_C(  7052), -INT16_C(  2785) },
+      UINT32_C(3624203950),
+      { -INT16_C( 24118),  INT16_C(  8192), -INT16_C(     8),  INT16_C(  8449), -INT16_C( 25874),  INT16_C( 26576),  INT16_C(     2),  INT16_C(  4096),
+        -INT16_C( 17409),  INT16_C( 32759), -INT16_C( 15926),  INT16_C( 25028),  INT16_C(     8),  INT16_C( 16932),  INT16_C( 16512), -INT16_C( 32512),
+        -INT16_C( 10095),  INT16_C( 23645),  INT16_C( 32735), -INT16_C(  9196), -INT16_C(  4113),  INT16_C(  5895),  INT16_C( 17680),  INT16_C(  5058),
+         INT16_C(  8576),  INT16_C(  2586),  INT16_C(  4160),  INT16_C(    80),  INT16_C(     4), -INT16_C(   161), -INT16_C( 15036),  INT16_C( 26859) },
+      {  INT16_C( 27968),  INT16_C(     1),  INT16_C(    13),  INT16_C(     3), -INT16_C(   448),  INT16_C(     8),  INT16_C(  4144),  INT16_C(     1),
+         INT16_C(     0),  INT16_C(    14),  INT16_C(     7), -INT16_C( 18114),  INT16_C(     1),  INT16_C(     4),  INT16_C(     2),  INT16_C(     2),
+         INT16_C(   520), -INT16_C( 12421),  INT16_C(    14),  INT16_C(  8192),  INT16_C(  7980),  INT16_C(  8192),  INT16_C(  5132),  INT16_C(  1461),
+        -INT16_C( 13135), -INT16_C(  3504),  INT16_C(  6316),  INT16_C(     2),  INT16_C(     1), -INT16_C(    33),  INT16_C(     6),  INT16_C(     9) } },
+    { { -INT16_C( 13571),  INT16_C(  5041),  INT16_C(  2056), -INT16_C( 12977), -INT16_C(  1345), -INT16_C(  1029), -INT16_C( 20555),  INT16_C(    64),
+         INT16_C( 31776), -INT16_C(  8193),  INT16_C( 11563), -INT16_C(  7770),  INT16_C(  2048), -INT16_C( 12306), -INT16_C(     1), -INT16_C( 20274),
+         INT16_C( 15070),  INT16_C( 12704),  INT16_C( 30438),  INT16_C(  7994), -INT16_C(   261), -INT16_C(  7639), -INT16_C(  2050), -INT16_C(   257),
+        -INT16_C(  8193), -INT16_C( 14693),  INT16_C(  1024),  INT16_C(   132), -INT16_C(  8193), -INT16_C( 27262), -INT16_C(   129), -INT16_C( 24987) },
+      UINT32_C(4054213153),
+      {  INT16_C( 27191), -INT16_C(  8193),  INT16_C(     4), -INT16_C( 16947),  INT16_C(     2), -INT16_C( 19521), -INT16_C(  1089),  INT16_C( 32254),
+         INT16_C( 24483), -INT16_C(  7401),  INT16_C(  1024),  INT16_C(   578),  INT16_C( 24061), -INT16_C(     3), -INT16_C( 18911),  INT16_C(  9310),
+        -INT16_C( 19863),  INT16_C( 15004),  INT16_C( 16400),  INT16_C( 16384), -INT16_C(  5064), -INT16_C( 16385),  INT16_C(  2050), -INT16_C(  4661),
+        -INT16_C(  1545), -INT16_C(  1479), -INT16_C( 13345),  INT16_C( 21803),  INT16_C(     0),  INT16_C( 12229),  INT16_C(     0), -INT16_C( 26869) },
+      {  INT16_C(     9),  INT16_C(  5041),  INT16_C(  2056), -INT16_C( 12977), -INT16_C(  1345),  INT16_C(    12), -INT16_C( 20555),  INT16_C(    64),
+         INT16_C( 31776),  INT16_C(     9),  INT16_C( 11563), -INT16_C(  7770),  INT16_C(  2048),  INT16_C(    15),  INT16_C(     7), -INT16_C( 20274),
+         INT16_C( 15070),  INT16_C(     8),  INT16_C(     2),  INT16_C(  7994), -INT16_C(   261),  INT16_C(    15), -INT16_C(  2050),  INT16_C(    11),
+         INT16_C(    13), -INT16_C( 14693),  INT16_C(  1024),  INT16_C(   132),  INT16_C(     0),  INT16_C(     9),  INT16_C(     0),  INT16_C(     8) } },
+    { {  INT16_C(   116),  INT16_C(     0), -INT16_C( 25363),  INT16_C(    20), -INT16_C(  3380),  INT16_C(    64), -INT16_C( 17407),  INT16_C(  9472),
+        -INT16_C(   137), -INT16_C( 32766),  INT16_C(  6273),  INT16_C(  4946),  INT16_C(     0),  INT16_C( 17346),  INT16_C(  4097), -INT16_C(  4161),
+        -INT16_C( 27021), -INT16_C( 24432), -INT16_C(  4353),  INT16_C( 14965),  INT16_C(  9899),  INT16_C( 19914), -INT16_C( 22519), -INT16_C( 15110),
+         INT16_C(  4609), -INT16_C(     1), -INT16_C(   577),  INT16_C( 31727), -INT16_C(     9),  INT16_C(   856),  INT16_C(     0),  INT16_C(     1) },
+      UINT32_C( 316963418),
+      { -INT16_C(  1864),  INT16_C( 32503),  INT16_C(   544), -INT16_C( 25540),  INT16_C(  1782),  INT16_C(  2519), -INT16_C(   521), -INT16_C(  6450),
+         INT16_C( 24886), -INT16_C( 18205), -INT16_C(  1665),  INT16_C(     0),  INT16_C(    72),  INT16_C( 24282), -INT16_C(     3), -INT16_C(   329),
+        -INT16_C( 25522),  INT16_C(    32), -INT16_C( 27643), -INT16_C(  2561),  INT16_C(   512),  INT16_C(     0), -INT16_C( 15963),  INT16_C( 17848),
+        -INT16_C( 13248),  INT16_C( 31104),  INT16_C( 16384),  INT16_C( 13619), -INT16_C(  8089), -INT16_C( 16618), -INT16_C( 10756),  INT16_C( 32766) },
+      {  INT16_C(   116),  INT16_C(    13), -INT16_C( 25363),  INT16_C(     8),  INT16_C(     8),  INT16_C(    64),  INT16_C(    14),  INT16_C(  9472),
+        -INT16_C(   137),  INT16_C(     9),  INT16_C(  6273),  INT16_C(     0),  INT16_C(     2),  INT16_C(    10),  INT16_C(    15), -INT16_C(  4161),
+        -INT16_C( 27021), -INT16_C( 24432),  INT16_C(     5),  INT16_C( 14965),  INT16_C(  9899),  INT16_C(     0),  INT16_C(     7),  INT16_C(     7),
+         INT16_C(  4609),  INT16_C(     6), -INT16_C(   577),  INT16_C( 31727),  INT16_C(     8),  INT16_C(   856),  INT16_C(     0),  INT16_C(     1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3366801625),
+      {  INT16_C(     0), -INT16_C(  8420),  INT16_C(  2048),  INT16_C(  7236), -INT16_C(  9864),  INT16_C(   170), -INT16_C( 16905),  INT16_C( 29985),
+         INT16_C(  1034), -INT16_C(  4613), -INT16_C( 15247),  INT16_C( 16649),  INT16_C( 21680),  INT16_C(  9506),  INT16_C( 30565), -INT16_C( 13603),
+        -INT16_C( 17537),  INT16_C( 30131), -INT16_C(  8461), -INT16_C( 31748),  INT16_C(  9868),  INT16_C( 17732),  INT16_C(    64), -INT16_C(     3),
+         INT16_C(   774), -INT16_C(  4097),  INT16_C( 12153), -INT16_C( 23089), -INT16_C( 16389),  INT16_C(  2768),  INT16_C( 25043), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     5),  INT16_C(     9),  INT16_C(     0),  INT16_C(    13),  INT16_C(     7),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     6),  INT16_C(     0),  INT16_C(    10),  INT16_C(     0),
+         INT16_C(    13),  INT16_C(     0),  INT16_C(    12),  INT16_C(     9),  INT16_C(     0),  INT16_C(     5),  INT16_C(     0),  INT16_C(    15),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8),  INT16_C(    16) } },
+    { UINT32_C(1338919864),
+      { -INT16_C( 26418),  INT16_C( 23556),  INT16_C(    51), -INT16_C(  4099), -INT16_C( 18437), -INT16_C( 29128), -INT16_C( 15535), -INT16_C(  7458),
+         INT16_C( 17667), -INT16_C(   130),  INT16_C( 22660), -INT16_C(  2138),  INT16_C(  4446), -INT16_C( 32766), -INT16_C( 31635), -INT16_C( 25057),
+        -INT16_C(    57), -INT16_C(  4233), -INT16_C(   518),  INT16_C(  6115), -INT16_C( 24354), -INT16_C( 10251),  INT16_C( 25937), -INT16_C( 16385),
+        -INT16_C( 14659),  INT16_C(   640), -INT16_C( 31747),  INT16_C( 16384), -INT16_C(   729), -INT16_C(    65),  INT16_C( 24567), -INT16_C(    33) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(    13),  INT16_C(     7),  INT16_C(     0),  INT16_C(    10),
+         INT16_C(     5),  INT16_C(    14),  INT16_C(     0),  INT16_C(    11),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(    13),  INT16_C(    13),  INT16_C(     9),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(    15),
+         INT16_C(    10),  INT16_C(     2),  INT16_C(    10),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(    13),  INT16_C(     0) } },
+    { UINT32_C(2864578387),
+      {  INT16_C(  1371),  INT16_C( 25254),  INT16_C( 13749), -INT16_C( 18097), -INT16_C(  4617),  INT16_C(  8596), -INT16_C( 24577),  INT16_C(  4098),
+         INT16_C( 19523), -INT16_C( 20177),  INT16_C(  3100), -INT16_C( 20389), -INT16_C( 31305),  INT16_C( 30719),  INT16_C(     0),  INT16_C( 20823),
+        -INT16_C(     1), -INT16_C(  4854),  INT16_C( 21427), -INT16_C(     2), -INT16_C( 24561), -INT16_C(   261),  INT16_C(  4192),  INT16_C(    19),
+         INT16_C( 13394),  INT16_C( 31963),  INT16_C(   129),  INT16_C(  8512),  INT16_C(  8558),  INT16_C(     0),  INT16_C( 22806), -INT16_C(  1033) },
+      {  INT16_C(     7),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(    13),  INT16_C(     0),  INT16_C(    14),  INT16_C(     0),
+         INT16_C(     6),  INT16_C(     9),  INT16_C(     5),  INT16_C(     8),  INT16_C(     9),  INT16_C(    14),  INT16_C(     0),  INT16_C(     8),
+         INT16_C(    16),  INT16_C(     0),  INT16_C(     9),  INT16_C(    15),  INT16_C(     6),  INT16_C(    14),  INT16_C(     0),  INT16_C(     3),
+         INT16_C(     0),  INT16_C(    11),  INT16_C(     0),  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14) } },
+    { UINT32_C(1639238999),
+      {  INT16_C( 19837), -INT16_C( 19992),  INT16_C( 25357),  INT16_C(     0),  INT16_C( 11876),  INT16_C(  7340), -INT16_C(     1), -INT16_C( 19092),
+        -INT16_C(  7761),  INT16_C( 31331),  INT16_C(  8448),  INT16_C(  8704),  INT16_C(     0), -INT16_C( 16441),  INT16_C(   128),  INT16_C( 12228),
+         INT16_C(  4040),  INT16_C( 16375),  INT16_C(  8188), -INT16_C( 23916), -INT16_C(     3), -INT16_C( 28065), -INT16_C(     1),  INT16_C( 17072),
+         INT16_C( 30455),  INT16_C(  1028), -INT16_C( 24448), -INT16_C( 30719),  INT16_C(  8201), -INT16_C( 29628),  INT16_C(  4104),  INT16_C( 32639) },
+      {  INT16_C(    10),  INT16_C(     8),  INT16_C(     7),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),
+         INT16_C(    10),  INT16_C(     0),  INT16_C(     2),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     8),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(    11),  INT16_C(     0),  INT16_C(    15),  INT16_C(     9),  INT16_C(     0),  INT16_C(     5),
+         INT16_C(    12),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     5),  INT16_C(     2),  INT16_C(     0) } },
+    { UINT32_C( 928392511),
+      {  INT16_C( 22071), -INT16_C(  1089),       INT16_MIN,  INT16_C(  1448), -INT16_C( 19586),  INT16_C(  4096),  INT16_C( 32251), -INT16_C( 17591),
+        -INT16_C( 30894), -INT16_C(   321),  INT16_C(   256),  INT16_C(     0),  INT16_C(     8),  INT16_C( 23535), -INT16_C( 24286), -INT16_C( 16513),
+         INT16_C(    33), -INT16_C(  9217), -INT16_C(   529),  INT16_C(  2176),  INT16_C(    16),  INT16_C( 21867),  INT16_C( 23388), -INT16_C(  1025),
+        -INT16_C( 32760),  INT16_C( 17543), -INT16_C(     1), -INT16_C(  6810),  INT16_C(   352),  INT16_C(  6658),  INT16_C(   128),  INT16_C(     0) },
+      {  INT16_C(     9),  INT16_C(    14),  INT16_C(     1),  INT16_C(     5),  INT16_C(    11),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     7),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(    12),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(    14),  INT16_C(    14),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     9),  INT16_C(     0),
+         INT16_C(     2),  INT16_C(     6),  INT16_C(    16),  INT16_C(     0),  INT16_C(     3),  INT16_C(     4),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1284877029),
+      { -INT16_C(   130), -INT16_C(   837), -INT16_C(  1292),  INT16_C(  4416),  INT16_C(  6638),  INT16_C(     1), -INT16_C(    17), -INT16_C(  3285),
+        -INT16_C(   521),  INT16_C( 20168), -INT16_C( 20299), -INT16_C( 15102),  INT16_C( 12727), -INT16_C(     1),  INT16_C( 30196), -INT16_C( 24742),
+        -INT16_C( 29440), -INT16_C(  4613), -INT16_C( 17313), -INT16_C( 17217),  INT16_C( 15750), -INT16_C( 14096),  INT16_C(  7978),  INT16_C(  9407),
+         INT16_C( 18158), -INT16_C( 15319), -INT16_C(   129), -INT16_C(  8209), -INT16_C(   261), -INT16_C( 15248), -INT16_C(  3105),  INT16_C( 21550) },
+      {  INT16_C(    14),  INT16_C(     0),  INT16_C(    11),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(    15),  INT16_C(    10),
+         INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     5),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(    10),
+         INT16_C(     4),  INT16_C(     0),  INT16_C(    11),  INT16_C(     0),  INT16_C(     8),  INT16_C(     0),  INT16_C(     0),  INT16_C(     9),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(    15),  INT16_C(    14),  INT16_C(     0),  INT16_C(     0),  INT16_C(    13),  INT16_C(     0) } },
+    { UINT32_C(1792439769),
+      { -INT16_C(   133), -INT16_C( 30652),  INT16_C( 26353), -INT16_C(  2049),  INT16_C( 20481),  INT16_C(  1536),  INT16_C(  3328), -INT16_C(   868),
+        -INT16_C(   129),  INT16_C( 28102), -INT16_C( 19374), -INT16_C( 15448),  INT16_C(     0), -INT16_C(  1025),  INT16_C( 20547),  INT16_C(     0),
+        -INT16_C(  2402), -INT16_C( 23910),  INT16_C(    16),  INT16_C(     0),  INT16_C(  8831), -INT16_C(    11), -INT16_C(   513), -INT16_C( 22032),
+        -INT16_C(  3206), -INT16_C( 13851),       INT16_MIN,  INT16_C(  4890),  INT16_C( 31352),  INT16_C(   257), -INT16_C(   263), -INT16_C(  1025) },
+      {  INT16_C(    14),  INT16_C(     0),  INT16_C(     0),  INT16_C(    15),  INT16_C(     3),  INT16_C(     0),  INT16_C(     3),  INT16_C(    10),
+         INT16_C(    15),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(    15),  INT16_C(     5),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     7),  INT16_C(     1),  INT16_C(     0),  INT16_C(     9),  INT16_C(     0),  INT16_C(    15),  INT16_C(     8),
+         INT16_C(     0),  INT16_C(     9),  INT16_C(     0),  INT16_C(     6),  INT16_C(     0),  INT16_C(     2),  INT16_C(    13),  INT16_C(     0) } },
+    { UINT32_C( 284615044),
+      {  INT16_C( 10244),  INT16_C(   256),  INT16_C( 12288), -INT16_C(   514), -INT16_C(     1),  INT16_C( 30527), -INT16_C( 27907), -INT16_C(  7105),
+         INT16_C( 10669),  INT16_C(  1028), -INT16_C(  4646),  INT16_C( 23746),  INT16_C(     5),  INT16_C(  8192), -INT16_C( 22190),  INT16_C( 23264),
+         INT16_C( 30411), -INT16_C(  8257), -INT16_C(  1029), -INT16_C( 28664), -INT16_C(  6570),  INT16_C(     4), -INT16_C(  2051), -INT16_C( 29219),
+         INT16_C( 28526),  INT16_C(  8192),  INT16_C(  2624), -INT16_C(  9106), -INT16_C(  7152),  INT16_C(  2048), -INT16_C(  1025), -INT16_C( 10313) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    10),
+         INT16_C(     8),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     7),  INT16_C(     7),
+         INT16_C(     0),  INT16_C(    14),  INT16_C(    14),  INT16_C(     0),  INT16_C(     9),  INT16_C(     1),  INT16_C(    14),  INT16_C(    10),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     5),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(  2147426302), -INT32_C(    70254602),  INT32_C(    33559618),  INT32_C(  1345060896), -INT32_C(  1164822948), -INT32_C(  1492166962),  INT32_C(  2014278550),
+        -INT32_C(    33554435), -INT32_C(  2051812118), -INT32_C(    26279969), -INT32_C(     2098177),  INT32_C(  1074906118), -INT32_C(  1858049921),  INT32_C(  1932314890), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(          27),  INT32_C(          27),  INT32_C(           5),  INT32_C(           6),  INT32_C(          16),  INT32_C(          18),  INT32_C(          17),
+         INT32_C(          30),  INT32_C(          17),  INT32_C(          27),  INT32_C(          30),  INT32_C(           8),  INT32_C(          14),  INT32_C(          14),  INT32_C(          32) } },
+    { {  INT32_C(  1256419669),  INT32_C(  1704501663),  INT32_C(    26095992),  INT32_C(  2010877951), -INT32_C(     8390665), -INT32_C(        8737), -INT32_C(    88341148), -INT32_C(  1399317906),
+        -INT32_C(      263169),  INT32_C(  1711670306),  INT32_C(   896403980), -INT32_C(   290209472),  INT32_C(   668041931), -INT32_C(   436542822), -INT32_C(         129), -INT32_C(   451142036) },
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(          12),  INT32_C(          25),  INT32_C(          29),  INT32_C(          29),  INT32_C(          16),  INT32_C(          15),
+         INT32_C(          30),  INT32_C(           9),  INT32_C(          13),  INT32_C(          15),  INT32_C(          15),  INT32_C(          19),  INT32_C(          31),  INT32_C(          16) } },
+    { {  INT32_C(   195167307),  INT32_C(   780901240),  INT32_C(          68),  INT32_C(     4654148), -INT32_C(   939523056), -INT32_C(   392440373),  INT32_C(    34603008), -INT32_C(   570427777),
+        -INT32_C(       65537),  INT32_C(  1020080573),  INT32_C(  1172396819),  INT32_C(      164866), -INT32_C(      139777), -INT32_C(  2118123512), -INT32_C(      524289),  INT32_C(   142818034) },
+      {  INT32_C(          11),  INT32_C(          17),  INT32_C(           2),  INT32_C(           7),  INT32_C(           5),  INT32_C(          19),  INT32_C(           2),  INT32_C(          27),
+         INT32_C(          31),  INT32_C(          18),  INT32_C(          15),  INT32_C(           4),  INT32_C(          29),  INT32_C(           5),  INT32_C(          31),  INT32_C(          13) } },
+    { { -INT32_C(  1108377633), -INT32_C(   671678529), -INT32_C(  1649414916), -INT32_C(     4194338), -INT32_C(  1404666704), -INT32_C(     4194595), -INT32_C(   270534657), -INT32_C(      262153),
+        -INT32_C(  1631899304),  INT32_C(   761088422),  INT32_C(     8424448),  INT32_C(    42139649),  INT32_C(   681574400),  INT32_C(     5242880),  INT32_C(   536871489), -INT32_C(   929977832) },
+      {  INT32_C(          27),  INT32_C(          27),  INT32_C(          22),  INT32_C(          29),  INT32_C(          15),  INT32_C(          28),  INT32_C(          29),  INT32_C(          30),
+         INT32_C(          17),  INT32_C(          16),  INT32_C(           4),  INT32_C(           5),  INT32_C(           4),  INT32_C(           2),  INT32_C(           4),  INT32_C(          12) } },
+    { { -INT32_C(   671088641), -INT32_C(   722901163), -INT32_C(  1176607739), -INT32_C(       29825), -INT32_C(   211222107),  INT32_C(     1049092), -INT32_C(        2059), -INT32_C(    20232575),
+         INT32_C(     6863954),  INT32_C(   822477863),  INT32_C(    35895056), -INT32_C(  2104372729),  INT32_C(  1751072593),  INT32_C(   679477840),  INT32_C(  1208484864), -INT32_C(  1832872413) },
+      {  INT32_C(          30),  INT32_C(          18),  INT32_C(          16),  INT32_C(          27),  INT32_C(          15),  INT32_C(           3),  INT32_C(          29),  INT32_C(          17),
+         INT32_C(          11),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          18),  INT32_C(           6),  INT32_C(           4),  INT32_C(          12) } },
+    { { -INT32_C(  1233125521), -INT32_C(       20545), -INT32_C(     4261377),  INT32_C(   271319838), -INT32_C(  1183763759), -INT32_C(  1879048128), -INT32_C(  1610475424), -INT32_C(  2144337918),
+        -INT32_C(  1888633857), -INT32_C(  1595236831), -INT32_C(   957175797), -INT32_C(  2071855104),  INT32_C(        2304), -INT32_C(        1029),  INT32_C(  1296684748),  INT32_C(      591936) },
+      {  INT32_C(          26),  INT32_C(          29),  INT32_C(          28),  INT32_C(          10),  INT32_C(          16),  INT32_C(           3),  INT32_C(           7),  INT32_C(           4),
+         INT32_C(          24),  INT32_C(          14),  INT32_C(          15),  INT32_C(           4),  INT32_C(           2),  INT32_C(          30),  INT32_C(          16),  INT32_C(           4) } },
+    { { -INT32_C(  1943858726), -INT32_C(  2111831552),  INT32_C(  1655888132),  INT32_C(      524424),  INT32_C(  1191182464),  INT32_C(    16842752),  INT32_C(  1488271288),  INT32_C(         512),
+         INT32_C(  1551448527),  INT32_C(          72),  INT32_C(   106120224), -INT32_C(     4194565),  INT32_C(  1263077403), -INT32_C(    16778769), -INT32_C(  1094500968), -INT32_C(   536887305) },
+      {  INT32_C(          13),  INT32_C(           4),  INT32_C(          13),  INT32_C(           3),  INT32_C(           5),  INT32_C(           2),  INT32_C(          17),  INT32_C(           1),
+         INT32_C(          19),  INT32_C(           2),  INT32_C(           9),  INT32_C(          29),  INT32_C(          12),  INT32_C(          28),  INT32_C(          18),  INT32_C(          29) } },
+    { { -INT32_C(   739169935), -INT32_C(      151553), -INT32_C(  1535167081), -INT32_C(      266242), -INT32_C(      524293),  INT32_C(   392653516),  INT32_C(   536875136), -INT32_C(        9217),
+        -INT32_C(   624565110),  INT32_C(  1608514559), -INT32_C(   687866121), -INT32_C(     5259281), -INT32_C(  1576009664), -INT32_C(   896649966),  INT32_C(    33685888), -INT32_C(  1614454403) },
+      {  INT32_C(          17),  INT32_C(          29),  INT32_C(          19),  INT32_C(          29),  INT32_C(          30),  INT32_C(          17),  INT32_C(           3),  INT32_C(          30),
+         INT32_C(          16),  INT32_C(          28),  INT32_C(          27),  INT32_C(          28),  INT32_C(           5),  INT32_C(          14),  INT32_C(           4),  INT32_C(          19) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(    12851848),  INT32_C(   696772154), -INT32_C(  1297270774),  INT32_C(    67330128), -INT32_C(  1217257998),  INT32_C(     4260096), -INT32_C(   189783927), -INT32_C(     8912897),
+         INT32_C(  1855203881), -INT32_C(          33),  INT32_C(   110496032),  INT32_C(  1804204251),  INT32_C(   507810258), -INT32_C(    67109153),  INT32_C(    20972617),  INT32_C(  1408725253) },
+      UINT16_C(34848),
+      {  INT32_C(           0), -INT32_C(   545259521), -INT32_C(   102036980), -INT32_C(  1610608476),  INT32_C(   243764472), -INT32_C(   682432312), -INT32_C(   698970878), -INT32_C(   607048357),
+         INT32_C(    17301504), -INT32_C(   895901635),  INT32_C(     3949060), -INT32_C(  2021028677),  INT32_C(  1214298548), -INT32_C(  2073512794), -INT32_C(  1638770850), -INT32_C(           1) },
+      {  INT32_C(    12851848),  INT32_C(   696772154), -INT32_C(  1297270774),  INT32_C(    67330128), -INT32_C(  1217257998),  INT32_C(          16), -INT32_C(   189783927), -INT32_C(     8912897),
+         INT32_C(  1855203881), -INT32_C(          33),  INT32_C(   110496032),  INT32_C(          16),  INT32_C(   507810258), -INT32_C(    67109153),  INT32_C(    20972617),  INT32_C(          32) } },
+    { { -INT32_C(      788514), -INT32_C(  1108410693), -INT32_C(   835061433), -INT32_C(  1106493957),  INT32_C(   268959872), -INT32_C(  1342570754),  INT32_C(   335578116),  INT32_C(    33622016),
+         INT32_C(  1646302992), -INT32_C(  1269008650),  INT32_C(      131200),  INT32_C(   152142084), -INT32_C(   370510953), -INT32_C(  1851931871), -INT32_C(   342254581), -INT32_C(  1461474377) },
+      UINT16_C(33992),
+      { -INT32_C(  2143215596),  INT32_C(  1232009395),  INT32_C(   827480242), -INT32_C(  1617177646),  INT32_C(   272630021),  INT32_C(  1384343209),  INT32_C(     6425728), -INT32_C(  1832961558),
+         INT32_C(   894950779), -INT32_C(  2063532030),  INT32_C(    39938057), -INT32_C(   490633901), -INT32_C(      542723),  INT32_C(  1839863849),  INT32_C(    61201835),  INT32_C(   301710380) },
+      { -INT32_C(      788514), -INT32_C(  1108410693), -INT32_C(   835061433),  INT32_C(          20),  INT32_C(   268959872), -INT32_C(  1342570754),  INT32_C(           6),  INT32_C(          19),
+         INT32_C(  1646302992), -INT32_C(  1269008650),  INT32_C(           9),  INT32_C(   152142084), -INT32_C(   370510953), -INT32_C(  1851931871), -INT32_C(   342254581),  INT32_C(          17) } },
+    { {  INT32_C(       17424),  INT32_C(   134217728),  INT32_C(  1804744315),  INT32_C(     1114260), -INT32_C(   893455045),  INT32_C(  1073743936), -INT32_C(   570425353), -INT32_C(   136396834),
+         INT32_C(  1776821195),  INT32_C(  1085870656),  INT32_C(    41945089), -INT32_C(   790121016),  INT32_C(           1), -INT32_C(   536904257),  INT32_C(   536872448), -INT32_C(  1742462968) },
+      UINT16_C(24695),
+      { -INT32_C(    17826833),  INT32_C(  1073741832),  INT32_C(   768534086),  INT32_C(    85231746), -INT32_C(   826125607), -INT32_C(    25698817), -INT32_C(         513),  INT32_C(   151001089),
+         INT32_C(   570496000), -INT32_C(  1342177921),  INT32_C(   553689504), -INT32_C(   201326568),  INT32_C(   655082799),  INT32_C(  1583361196),  INT32_C(   545264672), -INT32_C(  1967126528) },
+      {  INT32_C(          28),  INT32_C(           2),  INT32_C(          17),  INT32_C(     1114260),  INT32_C(          16),  INT32_C(          27),  INT32_C(          31), -INT32_C(   136396834),
+         INT32_C(  1776821195),  INT32_C(  1085870656),  INT32_C(    41945089), -INT32_C(   790121016),  INT32_C(           1),  INT32_C(          14),  INT32_C(           5), -INT32_C(  1742462968) } },
+    { { -INT32_C(  2147397374), -INT32_C(      263361), -INT32_C(   553654513),  INT32_C(   815398913),  INT32_C(   520561158),  INT32_C(  1561858154), -INT32_C(  1668774075),  INT32_C(   765331150),
+        -INT32_C(  1073743905),  INT32_C(  1162691038), -INT32_C(  1875753792),  INT32_C(   487040601),  INT32_C(   496080690),  INT32_C(   269090824),  INT32_C(   699534242),  INT32_C(  1153435650) },
+      UINT16_C(22758),
+      { -INT32_C(  1979414528), -INT32_C(  1237380282), -INT32_C(  1254253698),  INT32_C(   402669572),  INT32_C(   268697600),  INT32_C(   134226433),  INT32_C(   481680820),  INT32_C(  2004881582),
+        -INT32_C(  1072000767), -INT32_C(  1432357782),  INT32_C(  2139088894), -INT32_C(     8406027),  INT32_C(   268961824),  INT32_C(       16402),  INT32_C(  1258291198),  INT32_C(   109052928) },
+      { -INT32_C(  2147397374),  INT32_C(          17),  INT32_C(          21),  INT32_C(   815398913),  INT32_C(   520561158),  INT32_C(           4),  INT32_C(          18),  INT32_C(          13),
+        -INT32_C(  1073743905),  INT32_C(  1162691038), -INT32_C(  1875753792),  INT32_C(          27),  INT32_C(           4),  INT32_C(   269090824),  INT32_C(          26),  INT32_C(  1153435650) } },
+    { {  INT32_C(   579901569),  INT32_C(  1074790786),  INT32_C(   592405235), -INT32_C(   272761105), -INT32_C(  1208995491), -INT32_C(       98833), -INT32_C(  2147434336), -INT32_C(  1637487993),
+         INT32_C(  1610604543),  INT32_C(  2109665163), -INT32_C(   209977345),  INT32_C(   196203933),  INT32_C(  1198583000), -INT32_C(        2305),  INT32_C(  1308207573),  INT32_C(   539005952) },
+      UINT16_C(34484),
+      { -INT32_C(   572677948), -INT32_C(     2099713), -INT32_C(  1260761585), -INT32_C(  1935583212), -INT32_C(  1358766239), -INT32_C(   180231700), -INT32_C(   100664451), -INT32_C(   897415642),
+        -INT32_C(    83902529),  INT32_C(   218105344),  INT32_C(    53019648),  INT32_C(  1800981497),  INT32_C(  2112667968), -INT32_C(  1827126104),  INT32_C(   253280798),  INT32_C(  1081081857) },
+      {  INT32_C(   579901569),  INT32_C(  1074790786),  INT32_C(          17), -INT32_C(   272761105),  INT32_C(          17),  INT32_C(          17), -INT32_C(  2147434336),  INT32_C(          12),
+         INT32_C(  1610604543),  INT32_C(           5),  INT32_C(           6),  INT32_C(   196203933),  INT32_C(  1198583000), -INT32_C(        2305),  INT32_C(  1308207573),  INT32_C(           5) } },
+    { {  INT32_C(   456058522), -INT32_C(     1343635),  INT32_C(   142954496),  INT32_C(   551071528), -INT32_C(  1808863900),  INT32_C(    16778304),  INT32_C(  1073841153),  INT32_C(  2071556065),
+        -INT32_C(  1773176267),  INT32_C(  1391050129), -INT32_C(      262273), -INT32_C(   268566531),  INT32_C(   570949632),  INT32_C(  1253823909), -INT32_C(  1686736075), -INT32_C(  1304766213) },
+      UINT16_C(63646),
+      { -INT32_C(    10816513),  INT32_C(  1412878666), -INT32_C(  1161986506),  INT32_C(  1074528256),  INT32_C(  1107460097),  INT32_C(   599542278), -INT32_C(   903407630), -INT32_C(   493804583),
+        -INT32_C(   290861093),  INT32_C(   414293575), -INT32_C(  1073743905), -INT32_C(   226241636), -INT32_C(   834722241),  INT32_C(  1318017463),  INT32_C(  1942639493), -INT32_C(  1708513213) },
+      {  INT32_C(   456058522),  INT32_C(          14),  INT32_C(          21),  INT32_C(           3),  INT32_C(           5),  INT32_C(    16778304),  INT32_C(  1073841153),  INT32_C(          15),
+        -INT32_C(  1773176267),  INT32_C(  1391050129), -INT32_C(      262273),  INT32_C(          17),  INT32_C(          20),  INT32_C(          19),  INT32_C(          16),  INT32_C(          12) } },
+    { { -INT32_C(     2883585),  INT32_C(     4194816), -INT32_C(   362694411),  INT32_C(        1024),  INT32_C(  1880979346),  INT32_C(   385151534),  INT32_C(   718903183),  INT32_C(  1142164541),
+        -INT32_C(    12910865), -INT32_C(      525825),  INT32_C(  1074135552),  INT32_C(    12188293), -INT32_C(      262737),  INT32_C(  1474980924), -INT32_C(    16779809), -INT32_C(      663553) },
+      UINT16_C(54002),
+      { -INT32_C(  2147220224),  INT32_C(   100663426), -INT32_C(    67588301),  INT32_C(    75530240), -INT32_C(   119829659), -INT32_C(    33587729),  INT32_C(  1507177753),  INT32_C(     2097152),
+        -INT32_C(  2113928192),  INT32_C(   572407109), -INT32_C(  1048724332), -INT32_C(  1007603608), -INT32_C(   299908614), -INT32_C(     8396801),  INT32_C(  2058407300), -INT32_C(  1321020546) },
+      { -INT32_C(     2883585),  INT32_C(           4), -INT32_C(   362694411),  INT32_C(        1024),  INT32_C(          19),  INT32_C(          28),  INT32_C(          17),  INT32_C(           1),
+        -INT32_C(    12910865),  INT32_C(          14),  INT32_C(  1074135552),  INT32_C(    12188293),  INT32_C(          20),  INT32_C(  1474980924),  INT32_C(          15),  INT32_C(          17) } },
+    { {  INT32_C(   678226171),  INT32_C(   268698176),  INT32_C(  1094329863),  INT32_C(   357626334),  INT32_C(   162555353),  INT32_C(   285476872), -INT32_C(    33554497),  INT32_C(   546411051),
+         INT32_C(  1009342322), -INT32_C(  2083062600),  INT32_C(    67117056),  INT32_C(   537006240),  INT32_C(   570427904), -INT32_C(     1048577), -INT32_C(   420648585), -INT32_C(  2045751915) },
+      UINT16_C(20960),
+      {  INT32_C(  1606154002), -INT32_C(         386),  INT32_C(    34095112), -INT32_C(   551098223),  INT32_C(  1846498316),  INT32_C(  1207959552), -INT32_C(   536870949), -INT32_C(        2049),
+        -INT32_C(    73401089), -INT32_C(   272629761),  INT32_C(   703108635), -INT32_C(  2046689120), -INT32_C(   536887297), -INT32_C(   860038307),  INT32_C(   135528464),  INT32_C(   550502656) },
+      {  INT32_C(   678226171),  INT32_C(   268698176),  INT32_C(  1094329863),  INT32_C(   357626334),  INT32_C(   162555353),  INT32_C(           2),  INT32_C(          29),  INT32_C(          31),
+         INT32_C(          27), -INT32_C(  2083062600),  INT32_C(    67117056),  INT32_C(   537006240),  INT32_C(          30), -INT32_C(     1048577),  INT32_C(           4), -INT32_C(  2045751915) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(10625),
+      {  INT32_C(           0), -INT32_C(  1152356054), -INT32_C(    14745633),  INT32_C(  1627389952),  INT32_C(     1048856),  INT32_C(    17238576),  INT32_C(  1535239121),  INT32_C(    18543995),
+         INT32_C(  1703530851),  INT32_C(         192), -INT32_C(    16777249), -INT32_C(  1852313534), -INT32_C(  1282469329),  INT32_C(  2090981950),  INT32_C(  1736350090), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),
+         INT32_C(          15),  INT32_C(           0),  INT32_C(           0),  INT32_C(          14),  INT32_C(           0),  INT32_C(          18),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(30914),
+      {  INT32_C(    71368724),  INT32_C(   687651305), -INT32_C(  1618731264), -INT32_C(   754095676),  INT32_C(    16785426), -INT32_C(        4483), -INT32_C(  2004393807), -INT32_C(   545341569),
+        -INT32_C(      524641),  INT32_C(  1923593857),  INT32_C(   969562646),  INT32_C(   167776272), -INT32_C(   134242821), -INT32_C(  1610616993),  INT32_C(  1828188436),  INT32_C(    12714016) },
+      {  INT32_C(           0),  INT32_C(          18),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          12),  INT32_C(          27),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(          27),  INT32_C(          27),  INT32_C(          18),  INT32_C(           0) } },
+    { UINT16_C(42048),
+      { -INT32_C(   700091071), -INT32_C(        2721),  INT32_C(     8396820), -INT32_C(    67633156), -INT32_C(   671121425), -INT32_C(     9452257), -INT32_C(   665682930), -INT32_C(   269485073),
+        -INT32_C(  1145561759),  INT32_C(   559242234),  INT32_C(   680528896),  INT32_C(   645319278), -INT32_C(     1835201), -INT32_C(   217039533),  INT32_C(     1048576), -INT32_C(   434400578) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          15),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           6),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(          18) } },
+    { UINT16_C(40792),
+      {  INT32_C(  1752594887), -INT32_C(    67108865),  INT32_C(    16859264),  INT32_C(  1211186377),  INT32_C(  1137773865),  INT32_C(   994794164),  INT32_C(  1919707268),  INT32_C(   635936503),
+        -INT32_C(    67109641),  INT32_C(   104996663), -INT32_C(    34152561), -INT32_C(  1012921318),  INT32_C(   135266304), -INT32_C(     3145741), -INT32_C(   965856534),  INT32_C(  1294954600) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          13),  INT32_C(          13),  INT32_C(           0),  INT32_C(          13),  INT32_C(           0),
+         INT32_C(          28),  INT32_C(          14),  INT32_C(          25),  INT32_C(          11),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(          15) } },
+    { UINT16_C(20020),
+      {  INT32_C(     4260096),  INT32_C(   567898291),  INT32_C(  2113535999), -INT32_C(  1634763384),  INT32_C(      268302), -INT32_C(   133467890),  INT32_C(   514524142),  INT32_C(  2075656187),
+        -INT32_C(   289568999),  INT32_C(  1281950877), -INT32_C(  1879015167), -INT32_C(  1757307627), -INT32_C(  1862962397), -INT32_C(  2095202439),  INT32_C(       34816),  INT32_C(   910318581) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          28),  INT32_C(           0),  INT32_C(           6),  INT32_C(          15),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(          13),  INT32_C(           5),  INT32_C(          15),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0) } },
+    { UINT16_C( 7300),
+      {  INT32_C(    38283297), -INT32_C(   422805470), -INT32_C(   745604296), -INT32_C(    17301505),  INT32_C(   585911779), -INT32_C(  1992457061), -INT32_C(   148973622),  INT32_C(  1978224673),
+        -INT32_C(    46237014),  INT32_C(  1598426237), -INT32_C(  1106337964), -INT32_C(  1111553115), -INT32_C(       66561), -INT32_C(         163),  INT32_C(     1049344),  INT32_C(    34736128) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          19),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          14),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(          18),  INT32_C(          20),  INT32_C(          30),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(64187),
+      {  INT32_C(   134349064), -INT32_C(   457435860),  INT32_C(    71336001), -INT32_C(   268566531),  INT32_C(    33619968), -INT32_C(    35700737), -INT32_C(   369099317),  INT32_C(  1046066836),
+        -INT32_C(     4200449), -INT32_C(  1877470407), -INT32_C(     5308421), -INT32_C(  1764684475), -INT32_C(    45137932), -INT32_C(    67633153),  INT32_C(  1240282934), -INT32_C(         273) },
+      {  INT32_C(           4),  INT32_C(          15),  INT32_C(           0),  INT32_C(          29),  INT32_C(           2),  INT32_C(          28),  INT32_C(           0),  INT32_C(          17),
+         INT32_C(           0),  INT32_C(          11),  INT32_C(           0),  INT32_C(          14),  INT32_C(          23),  INT32_C(          30),  INT32_C(          18),  INT32_C(          30) } },
+    { UINT16_C(14065),
+      {  INT32_C(      131456),  INT32_C(  1439512106),  INT32_C(  1032940338), -INT32_C(   268501010),  INT32_C(    34078737), -INT32_C(  1783013336),  INT32_C(   142606352),  INT32_C(    70960239),
+        -INT32_C(  1867589005),  INT32_C(  1756881577), -INT32_C(   335544482),  INT32_C(  1271466978),  INT32_C(     5259289),  INT32_C(   337646080),  INT32_C(    25165824), -INT32_C(     4202769) },
+      {  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(          13),  INT32_C(           3),  INT32_C(          14),
+         INT32_C(           0),  INT32_C(          17),  INT32_C(          27),  INT32_C(           0),  INT32_C(           6),  INT32_C(           5),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                   0), -INT64_C( 2128296100357850641),  INT64_C( 4760907613380543105), -INT64_C( 5836735401172431631),
+        -INT64_C( 5116197845713135846), -INT64_C(  324553843362758657),  INT64_C(  310838555181056394), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  35),  INT64_C(                  10),  INT64_C(                  35),
+         INT64_C(                  35),  INT64_C(                  57),  INT64_C(                  15),  INT64_C(                  64) } },
+    { {  INT64_C( 1729391122798608416),  INT64_C( 3677190247336116481), -INT64_C( 5175688543024935262), -INT64_C( 6414806577363984380),
+        -INT64_C( 3893700706091537558),  INT64_C(     572845558595840),  INT64_C( 1685964787537410600), -INT64_C( 9223087806656510921) },
+      {  INT64_C(                   7),  INT64_C(                  11),  INT64_C(                  27),  INT64_C(                  29),
+         INT64_C(                  40),  INT64_C(                   5),  INT64_C(                  30),  INT64_C(                  13) } },
+    { {  INT64_C(   90247914407854400), -INT64_C( 6677972000421184027),  INT64_C(    2252212948434988),  INT64_C( 8012061184746499847),
+         INT64_C( 9223372029875453694),  INT64_C( 6809295339320366039), -INT64_C( 2240296504117584348), -INT64_C( 1321078719121301623) },
+      {  INT64_C(                   6),  INT64_C(                  37),  INT64_C(                  10),  INT64_C(                  31),
+         INT64_C(                  58),  INT64_C(                  39),  INT64_C(                  31),  INT64_C(                  35) } },
+    { {  INT64_C( 7610118558487243423), -INT64_C(  297519600692641794),  INT64_C( 8917126712282576895),  INT64_C(     105557570687492),
+         INT64_C( 4607041672050638847), -INT64_C( 7160421791143178564), -INT64_C( 7685329260725848202),  INT64_C(  614741349137154052) },
+      {  INT64_C(                  30),  INT64_C(                  56),  INT64_C(                  56),  INT64_C(                  10),
+         INT64_C(                  57),  INT64_C(                  29),  INT64_C(                  29),  INT64_C(                   6) } },
+    { {  INT64_C(        245081579536), -INT64_C(   86148969444986881), -INT64_C(   73218712945041409),  INT64_C( 8596233273514249830),
+        -INT64_C( 6817832800236592938), -INT64_C(    2533550742044675), -INT64_C( 1615530886196013692), -INT64_C( 5679464051382940894) },
+      {  INT64_C(                   7),  INT64_C(                  52),  INT64_C(                  58),  INT64_C(                  35),
+         INT64_C(                  26),  INT64_C(                  59),  INT64_C(                  35),  INT64_C(                  30) } },
+    { {  INT64_C( 4942779893388887497),  INT64_C(        137441051264), -INT64_C( 8406747379862137017), -INT64_C(           580911233),
+        -INT64_C( 7536619327595528621), -INT64_C(      10170499375115),  INT64_C( 7486500302971468778), -INT64_C( 4581511891512608157) },
+      {  INT64_C(                  20),  INT64_C(                   4),  INT64_C(                  34),  INT64_C(                  59),
+         INT64_C(                  35),  INT64_C(                  56),  INT64_C(                  37),  INT64_C(                  30) } },
+    { { -INT64_C( 1188950306457649153),  INT64_C( 6536618385327654413),  INT64_C( 9223370645280129023), -INT64_C( 6046055428962867647),
+         INT64_C( 9221014679084571647),  INT64_C( 6917528958921342959), -INT64_C( 8393623464364814292),  INT64_C( 4616761364101468803) },
+      {  INT64_C(                  60),  INT64_C(                  36),  INT64_C(                  58),  INT64_C(                  26),
+         INT64_C(                  54),  INT64_C(                  59),  INT64_C(                  31),  INT64_C(                  10) } },
+    { {  INT64_C( 3653999479310729374),  INT64_C( 7647557929980939761), -INT64_C( 2310347742721867777), -INT64_C( 7263733969302004534),
+        -INT64_C( 4611756387171698753), -INT64_C(     285873665999881), -INT64_C( 6917529019048525550), -INT64_C( 3340004489622368848) },
+      {  INT64_C(                  32),  INT64_C(                  34),  INT64_C(                  58),  INT64_C(                  27),
+         INT64_C(                  59),  INT64_C(                  55),  INT64_C(                   8),  INT64_C(                  37) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C(     563224840310913), -INT64_C(  360922663276777993), -INT64_C( 7458286746293875780),  INT64_C( 2350046786914176461),
+        -INT64_C( 4609328528058466304), -INT64_C(  544028464972051215), -INT64_C(  332870071522993666),  INT64_C( 8427892271656205300) },
+      UINT8_C(221),
+      {  INT64_C(                   0), -INT64_C( 3002454570236332694),  INT64_C( 8070309519839723515),  INT64_C( 1729382295850188804),
+         INT64_C(    5911008870663170),  INT64_C( 1951322409182734048),  INT64_C( 7737546958548450366), -INT64_C(                   1) },
+      {  INT64_C(                   0), -INT64_C(  360922663276777993),  INT64_C(                  57),  INT64_C(                   7),
+         INT64_C(                   6), -INT64_C(  544028464972051215),  INT64_C(                  35),  INT64_C(                  64) } },
+    { {  INT64_C(     316659353075712), -INT64_C( 3536513793246293914),  INT64_C( 4957781733772540302),  INT64_C( 7744487623100140693),
+        -INT64_C( 4828149209050906759),  INT64_C( 3259202592476281495),  INT64_C( 8312435514489736272),  INT64_C( 3207029968012704507) },
+      UINT8_C(175),
+      { -INT64_C( 3356065649123525411), -INT64_C( 4038264993024103214), -INT64_C( 5764748406552002561), -INT64_C( 1152930369486716929),
+         INT64_C( 2666131607743627264),  INT64_C( 6420082974086096746), -INT64_C( 3019555927570321179),  INT64_C(  288233404107854912) },
+      {  INT64_C(                  34),  INT64_C(                  36),  INT64_C(                  58),  INT64_C(                  59),
+        -INT64_C( 4828149209050906759),  INT64_C(                  36),  INT64_C( 8312435514489736272),  INT64_C(                   9) } },
+    { {  INT64_C( 2352812856968339496), -INT64_C( 3718615258301132413), -INT64_C(    2254411153801217),  INT64_C( 7673659093778734376),
+        -INT64_C(  144119586123465090), -INT64_C( 4053595371212671765), -INT64_C(    9007749018943489), -INT64_C(  318946005907119289) },
+      UINT8_C(203),
+      { -INT64_C(   76561743421128737), -INT64_C( 6416491978262256092), -INT64_C(  688566942558024598),  INT64_C(  108157310093923328),
+         INT64_C( 2701713457572245006), -INT64_C( 1812712044156174337), -INT64_C(  209770834483434099),  INT64_C( 4941542194721829442) },
+      {  INT64_C(                  59),  INT64_C(                  28), -INT64_C(    2254411153801217),  INT64_C(                   9),
+        -INT64_C(  144119586123465090), -INT64_C( 4053595371212671765),  INT64_C(                  34),  INT64_C(                  33) } },
+    { { -INT64_C( 6235940918478530794), -INT64_C( 3225943700136418817),  INT64_C( 3756156096364660027),  INT64_C( 9210960875018891450),
+         INT64_C( 3782191011375630075),  INT64_C( 1225050575498912768), -INT64_C( 7621967743431900260), -INT64_C(  634074805775315756) },
+      UINT8_C( 27),
+      {  INT64_C(  864691302989041665), -INT64_C(      18691710271493),  INT64_C(  961057270861982830),  INT64_C( 3747655427659407584),
+        -INT64_C( 7901837678600307087), -INT64_C( 3713116480002436814), -INT64_C(  585801394900280334), -INT64_C(  288230651029881473) },
+      {  INT64_C(                  11),  INT64_C(                  58),  INT64_C( 3756156096364660027),  INT64_C(                  21),
+         INT64_C(                  35),  INT64_C( 1225050575498912768), -INT64_C( 7621967743431900260), -INT64_C(  634074805775315756) } },
+    { { -INT64_C( 7637250118934170261),  INT64_C( 9079256843678638079),  INT64_C(    4644340353860610),  INT64_C(        275953745920),
+        -INT64_C( 1635184314094255125), -INT64_C(   72132396287666197), -INT64_C(    2815338178936833), -INT64_C( 6599655901749776711) },
+      UINT8_C(249),
+      {  INT64_C( 9102513878634553752),  INT64_C( 2219443299433963713), -INT64_C( 7874989585234630466), -INT64_C(  576460760901747713),
+        -INT64_C( 2305843009884782595),  INT64_C( 9069827436782288895), -INT64_C( 3370863177174096705), -INT64_C(   95495681538560394) },
+      {  INT64_C(                  28),  INT64_C( 9079256843678638079),  INT64_C(    4644340353860610),  INT64_C(                  60),
+         INT64_C(                  60),  INT64_C(                  57),  INT64_C(                  33),  INT64_C(                  37) } },
+    { {  INT64_C( 3847020517628662238),  INT64_C( 5244303114935595758), -INT64_C(  577028531142266945),  INT64_C( 4772432828106245391),
+         INT64_C(   18016598740697248), -INT64_C( 1105785247951320927),  INT64_C( 3707667256902099020),  INT64_C(  144678138306201856) },
+      UINT8_C( 62),
+      {  INT64_C( 4488232329953061797), -INT64_C(  887530245369133987),  INT64_C( 6872413729091215355),  INT64_C(   72057596185444416),
+         INT64_C(  577586652294165088), -INT64_C(   12384899013050945), -INT64_C( 2153231598531943646), -INT64_C( 2453792277486837319) },
+      {  INT64_C( 3847020517628662238),  INT64_C(                  39),  INT64_C(                  55),  INT64_C(                   4),
+         INT64_C(                   9),  INT64_C(                  56),  INT64_C( 3707667256902099020),  INT64_C(  144678138306201856) } },
+    { { -INT64_C( 5764616606900027397), -INT64_C( 5072055178152049466),  INT64_C( 1511348780416236488), -INT64_C(   18014402975760769),
+         INT64_C( 3223301592772142622), -INT64_C( 8189714354474207043), -INT64_C( 5350285153410744881), -INT64_C(    2256197864407042) },
+      UINT8_C( 51),
+      {  INT64_C( 8452190949749263513), -INT64_C(      44023415309317), -INT64_C(   76719677958561857),  INT64_C(     564049498603568),
+         INT64_C( 7809350211233750086), -INT64_C( 4757490099582140737), -INT64_C( 4022321358051058393),  INT64_C(      71124693025024) },
+      {  INT64_C(                  32),  INT64_C(                  57),  INT64_C( 1511348780416236488), -INT64_C(   18014402975760769),
+         INT64_C(                  27),  INT64_C(                  54), -INT64_C( 5350285153410744881), -INT64_C(    2256197864407042) } },
+    { { -INT64_C( 8883144680737921488),  INT64_C(   36614853913215538),  INT64_C(  148637827295625216), -INT64_C(   72066597363155478),
+        -INT64_C( 5001103585052501482), -INT64_C(  650770146156085265),  INT64_C( 4613093393310941184),  INT64_C( 4419157118698034190) },
+      UINT8_C(128),
+      {  INT64_C( 6633359426473539292), -INT64_C( 6278830132187080312), -INT64_C( 5166875032568536531),  INT64_C( 1020463780842321029),
+        -INT64_C(  585467961221863074),  INT64_C( 4030914362879539216), -INT64_C( 8644096500424433660),  INT64_C( 8540828085441782954) },
+      { -INT64_C( 8883144680737921488),  INT64_C(   36614853913215538),  INT64_C(  148637827295625216), -INT64_C(   72066597363155478),
+        -INT64_C( 5001103585052501482), -INT64_C(  650770146156085265),  INT64_C( 4613093393310941184),  INT64_C(                  35) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 10),
+      {  INT64_C(                   0),  INT64_C( 4429287209844080639),  INT64_C( 8023838217908939309), -INT64_C( 1107204495497668949),
+        -INT64_C( 3808097412237598882),  INT64_C( 6853220100757268634), -INT64_C( 2212733148890994993), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  54),  INT64_C(                   0),  INT64_C(                  29),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(136),
+      { -INT64_C( 5531114962472410597),  INT64_C(  571448604691517632),  INT64_C(  576482777470861312), -INT64_C( 6945690144341600271),
+        -INT64_C( 6714116883663878499), -INT64_C( 5031063237509390747), -INT64_C(  563104145295590779),  INT64_C( 7197813794954889469) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  38),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  33) } },
+    { UINT8_C(225),
+      {  INT64_C( 1762411008908860677),  INT64_C( 6181995610125229875), -INT64_C( 4612530546478678025), -INT64_C( 2197636518490431421),
+         INT64_C(          2300617729), -INT64_C( 3747153238001390353), -INT64_C(      45079977033730), -INT64_C( 4622945155071350437) },
+      {  INT64_C(                  28),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                  48),  INT64_C(                  58),  INT64_C(                  51) } },
+    { UINT8_C(211),
+      { -INT64_C( 8691281689802566246),  INT64_C( 8850854153266133442),  INT64_C( 9115284408779923311), -INT64_C( 2186182147590506327),
+        -INT64_C(  145436037684608993),  INT64_C(   36028815272579584), -INT64_C( 1659250526176169679),  INT64_C( 6151853037688039663) },
+      {  INT64_C(                  34),  INT64_C(                  35),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                  36),  INT64_C(                   0),  INT64_C(                  28),  INT64_C(                  40) } },
+    { UINT8_C(236),
+      { -INT64_C( 6093451985114557706), -INT64_C( 1154048091860500483),  INT64_C( 3617514437707495358),  INT64_C( 2461457780667345173),
+         INT64_C(   72690917031027216), -INT64_C( 8240485519502683854), -INT64_C(  144972833252245506), -INT64_C( 5395817989820423807) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  41),  INT64_C(                  29),
+         INT64_C(                   0),  INT64_C(                  30),  INT64_C(                  51),  INT64_C(                  25) } },
+    { UINT8_C(117),
+      { -INT64_C( 5548080974871342564), -INT64_C( 2357027011961768685), -INT64_C( 8060735101405675504),  INT64_C( 2900452249492805137),
+        -INT64_C( 5914099667909995684),  INT64_C( 3262643944680965238), -INT64_C(  331741360133719534), -INT64_C(  619687054771564925) },
+      {  INT64_C(                  29),  INT64_C(                   0),  INT64_C(                  14),  INT64_C(                   0),
+         INT64_C(                  39),  INT64_C(                  32),  INT64_C(                  39),  INT64_C(                   0) } },
+    { UINT8_C(180),
+      { -INT64_C(   18296148368687121), -INT64_C( 6332680379643431985),  INT64_C( 2546988807266162394),  INT64_C( 3185669168964921081),
+         INT64_C(  216744528185393152), -INT64_C(   36028865877017617),  INT64_C( 9221049850848607999), -INT64_C(   18050682397393441) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  38),  INT64_C(                   0),
+         INT64_C(                   6),  INT64_C(                  56),  INT64_C(                   0),  INT64_C(                  58) } },
+    { UINT8_C( 92),
+      {  INT64_C( 2763829756980756171), -INT64_C(      17593276694531), -INT64_C( 8395601069191928956), -INT64_C( 4713137404675974315),
+         INT64_C( 2594214140293685512), -INT64_C( 4432689469018255163),  INT64_C(   36048588312156160), -INT64_C(   73746633024602161) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  34),  INT64_C(                  32),
+         INT64_C(                  12),  INT64_C(                   0),  INT64_C(                   7),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
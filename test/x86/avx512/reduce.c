@@ -0,0 +1,2648 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN reduce
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/reduce.h>
+
+static int
+test_simde_mm512_reduce_add_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(  830256800), -INT32_C(  169673641),  INT32_C( 1243931546), -INT32_C( 1004560899),
+         INT32_C(  473142372),  INT32_C(    1050880),  INT32_C( 1083980018), -INT32_C( 1543934194),
+         INT32_C(  590735842),  INT32_C(     458785),  INT32_C(  648177039),  INT32_C( 1421789144),
+        -INT32_C( 1593802624),  INT32_C(    2097920), -INT32_C( 1545434980), -INT32_C( 1363175021) },
+      INT32_C( 1709492683) },
+    { { -INT32_C(  801534862),  INT32_C(   76597798),  INT32_C( 1598556092), -INT32_C( 2147418048),
+         INT32_C(  216018216),  INT32_C( 1609878352),  INT32_C(   67109378),  INT32_C(   67240000),
+        -INT32_C( 2031872732),  INT32_C(  249589259),  INT32_C(  275900122),  INT32_C(  827844210),
+         INT32_C( 1074481458), -INT32_C(  358504253),  INT32_C( 1369574851),  INT32_C( 1426243517) },
+      -INT32_C(  775263938) },
+    { {  INT32_C( 1439293403),  INT32_C(    9437184),  INT32_C(   82528368), -INT32_C( 1096733787),
+         INT32_C( 2035003053),  INT32_C(   33685556),  INT32_C(  322250603),  INT32_C(   88739978),
+         INT32_C( 1730926569), -INT32_C( 1152595394),  INT32_C(  787209476), -INT32_C(   19768893),
+        -INT32_C(  167938917), -INT32_C( 1390238259),  INT32_C(    4786176), -INT32_C(  837794495) },
+      INT32_C( 1868790621) },
+    { { -INT32_C(  812673597),  INT32_C(  212355784), -INT32_C(  318003371),  INT32_C(  398539540),
+        -INT32_C(  691732236), -INT32_C( 1471235197),  INT32_C( 2062677414),  INT32_C(        512),
+         INT32_C(  966092897), -INT32_C( 1821162198), -INT32_C(  853098906),  INT32_C(  211381875),
+        -INT32_C( 1776368135), -INT32_C(  753991024),  INT32_C(  955517694), -INT32_C( 2080191475) },
+      -INT32_C( 1476923127) },
+    { {  INT32_C(  332429936), -INT32_C( 1066302158),  INT32_C(  983810142),  INT32_C( 1366850737),
+        -INT32_C(  129884223), -INT32_C( 1725887389), -INT32_C( 1845444576),  INT32_C(  230583233),
+        -INT32_C(  153037811), -INT32_C(  301690944), -INT32_C( 1662257827),  INT32_C( 1580350321),
+        -INT32_C(    8170503),  INT32_C( 1302857102),  INT32_C( 1526928396), -INT32_C( 1754455615) },
+      -INT32_C( 1323321179) },
+    { {  INT32_C(    2097793),  INT32_C( 1930073193),  INT32_C( 1913655982), -INT32_C( 1991777397),
+         INT32_C( 1944783540),  INT32_C(   50397184),  INT32_C( 1115750404), -INT32_C( 1065246686),
+         INT32_C(  907307450),  INT32_C(       2080),  INT32_C(          8), -INT32_C( 1665341287),
+        -INT32_C(   29672832), -INT32_C( 1073213408),  INT32_C(    1050628), -INT32_C(  569777927) },
+      INT32_C( 1470088725) },
+    { {  INT32_C( 1073742340),  INT32_C(   76021784),  INT32_C(    2097158),  INT32_C( 1157214531),
+         INT32_C( 1491701706),  INT32_C( 1741736869),            INT32_MIN,  INT32_C(  347532894),
+        -INT32_C( 2146430464),  INT32_C( 1397490449),  INT32_C(  504497857),  INT32_C(  546549086),
+        -INT32_C(  327735525), -INT32_C(  765210398),  INT32_C( 1900693417),  INT32_C(    4456450) },
+      INT32_C(  561907210) },
+    { {  INT32_C( 1333661182),  INT32_C( 2073702001),  INT32_C(  550608946), -INT32_C( 2126649287),
+        -INT32_C(  924878383),  INT32_C(  357408336),  INT32_C( 1879162169), -INT32_C(  940526725),
+        -INT32_C( 1446334965),  INT32_C(  706384097),  INT32_C( 2118172449), -INT32_C(  186005475),
+         INT32_C(  282820614),  INT32_C(  724263506), -INT32_C(  953387377),  INT32_C( 1834040999) },
+      INT32_C(  987474791) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_add_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C( 1973436475), -INT32_C( 1072241801),  INT32_C( 1239855598),  INT32_C( 2129126141),
+        -INT32_C( 2137290222),  INT32_C( 1599696450),  INT32_C(     132112),  INT32_C(  330103300),
+         INT32_C(  371844211),  INT32_C( 1047117352),  INT32_C(  303163977),  INT32_C(  312743459),
+         INT32_C( 1459302557),  INT32_C( 1380177753), -INT32_C(  154812164), -INT32_C( 1101673248) },
+      INT32_C(          0) },
+    { UINT16_C(65535),
+      {  INT32_C( 1646767174), -INT32_C(  335996061),  INT32_C( 1873606117), -INT32_C( 1069481980),
+         INT32_C( 1018464388),  INT32_C(  915819089), -INT32_C(  690428239),  INT32_C( 1612547002),
+        -INT32_C(  236672782),  INT32_C( 1082130464), -INT32_C(  509890696),  INT32_C(   51172103),
+        -INT32_C( 1879015388),  INT32_C(     262659),  INT32_C( 1734846948), -INT32_C( 1674859322) },
+      -INT32_C(  755695820) },
+    { UINT16_C(31852),
+      {  INT32_C( 1929859744), -INT32_C( 1065240541),  INT32_C(  914733051),  INT32_C(  893576733),
+        -INT32_C( 1128932816),  INT32_C(  987770711),  INT32_C(  306424421), -INT32_C( 1464775319),
+         INT32_C( 1524861266), -INT32_C(  259999562), -INT32_C( 1126810960), -INT32_C(  799013742),
+         INT32_C(  536872980), -INT32_C(  996493459),  INT32_C(  978133247),  INT32_C( 1625395830) },
+      INT32_C( 1695192982) },
+    { UINT16_C(24800),
+      { -INT32_C(  636099129),  INT32_C( 1403127613), -INT32_C(  301039144), -INT32_C(  610737271),
+         INT32_C( 2116031756),  INT32_C(  134316080),  INT32_C(  427204384),  INT32_C( 2133344937),
+         INT32_C(      74112),  INT32_C(  673455129),  INT32_C(  629873522),  INT32_C(  167837696),
+         INT32_C(  232096823),  INT32_C( 1073807362), -INT32_C( 2012911054), -INT32_C( 1514798079) },
+      INT32_C( 1755761709) },
+    { UINT16_C(40062),
+      { -INT32_C(  819298532),  INT32_C(   80879632), -INT32_C( 1998266275),  INT32_C(   68157441),
+        -INT32_C( 1648918035), -INT32_C(  426633062), -INT32_C(  208650803), -INT32_C(  998555650),
+         INT32_C(  184680496),  INT32_C( 1917501674), -INT32_C(  846729241),  INT32_C( 1575796090),
+         INT32_C(   33609145),  INT32_C(      90114), -INT32_C(  637609968),  INT32_C(  494688257) },
+      INT32_C( 1418900445) },
+    { UINT16_C(50180),
+      {  INT32_C(          0),  INT32_C(  603979776), -INT32_C( 1506140684), -INT32_C( 1942956176),
+         INT32_C(  202215212),  INT32_C(   78188235),  INT32_C(    9797776),  INT32_C(  946418548),
+        -INT32_C(  902852980),  INT32_C( 1300524119), -INT32_C( 1921658143),  INT32_C(   33554464),
+         INT32_C(   33622035), -INT32_C( 1989288052), -INT32_C( 1134264290), -INT32_C(  316360085) },
+      -INT32_C(  583455906) },
+    { UINT16_C( 8478),
+      {  INT32_C(  345014788),  INT32_C( 1275208530), -INT32_C( 1861222400), -INT32_C( 1022143604),
+         INT32_C(          0),  INT32_C(   33559936), -INT32_C(  539935687), -INT32_C( 1080138877),
+        -INT32_C(  883320120),  INT32_C(    8454912), -INT32_C(  855805599),  INT32_C(     131072),
+        -INT32_C(  868183239), -INT32_C( 1817114913), -INT32_C( 1877912757), -INT32_C( 1708096174) },
+      -INT32_C(   13625211) },
+    { UINT16_C(28079),
+      { -INT32_C(  575311784), -INT32_C(  725473144), -INT32_C( 1469951315),  INT32_C( 2022475522),
+        -INT32_C(  900182788), -INT32_C( 1630633518),  INT32_C(     134208),  INT32_C(  894138989),
+         INT32_C( 1871483747), -INT32_C(  805109933), -INT32_C( 1642282228),  INT32_C(  270534660),
+         INT32_C(   24609494),  INT32_C(  219612432), -INT32_C(  565096306), -INT32_C(  732455522) },
+      -INT32_C( 1330502945) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_add_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C( 845194823232808721),  INT64_C(  37295434414194696), -INT64_C(4003669480786523182), -INT64_C(3942179017386392286),
+        -INT64_C(7222660106176067025),  INT64_C(4403158950687689738),  INT64_C(8163518352838091283),  INT64_C(2366476437395982944) },
+      INT64_C( 647135394219784889) },
+    { { -INT64_C(9085492778565355300),  INT64_C(8205989764641635788),  INT64_C(  19140316133065728),  INT64_C(5162222520357831944),
+         INT64_C(2595584987090580978),  INT64_C(2323857450991888436), -INT64_C( 699183793955359470),  INT64_C(6672290903465867244) },
+      -INT64_C(3252334703549396268) },
+    { {  INT64_C(1652975761393107227),  INT64_C(4572104905949429725),  INT64_C(5743889478042305026),  INT64_C(   9007199256870912),
+        -INT64_C(9067668742425810496),  INT64_C(8357154489941740626),  INT64_C(2983573720569739300),  INT64_C(1926987466822358683) },
+      -INT64_C(2268719794159810613) },
+    { { -INT64_C(5261394757416079437),  INT64_C(1193462710231367696), -INT64_C(2857934176509687622),  INT64_C(    140772116660224),
+         INT64_C(7654693469217297434), -INT64_C(8463120711076466679), -INT64_C(2106006085468968356),  INT64_C(  36032413385623552) },
+      INT64_C(8642617708189298428) },
+    { {  INT64_C( 630003093027580784),  INT64_C(5279709223547136586),  INT64_C(6153641927553817788), -INT64_C(4971562389385436231),
+        -INT64_C( 480138607684908339),  INT64_C(4308686411485190228), -INT64_C(3175432505083608187), -INT64_C(4863952496022716108) },
+      INT64_C(2880954657437056521) },
+    { {  INT64_C(3116105856299979967), -INT64_C(2203257393612760465), -INT64_C(8404916641663076012),  INT64_C(1152355898784885314),
+        -INT64_C( 607536764263243791),  INT64_C(  89070449284122121),  INT64_C(1854857651075316372), -INT64_C(9223301590465642456) },
+      INT64_C(4220121539149132666) },
+    { {  INT64_C(    281476287725568), -INT64_C(1336485210017953452),  INT64_C(8138882846673861025),  INT64_C(4015982137430792581),
+        -INT64_C(1506080431232735014), -INT64_C(3953404940711867809), -INT64_C(8247061834543623689), -INT64_C(8767963353939222345) },
+      INT64_C(6790894763656528481) },
+    { {  INT64_C(1152930317879803968),  INT64_C(3212692628398384779),  INT64_C(2595634096807184104), -INT64_C(4053640625754397175),
+         INT64_C(1187908090342792137), -INT64_C(1724321293949193447), -INT64_C(3718694064598593736),  INT64_C(   2252212147322896) },
+      -INT64_C(1345238638726696474) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_add_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(   9007200093601792), -INT64_C(9223090536107698159),  INT64_C(6730829129350174003),  INT64_C(4200088142814741712),
+         INT64_C(    282162171478016), -INT64_C(9216616636327395328), -INT64_C( 693001675874255076), -INT64_C(1490223684828629842) },
+      INT64_C(                  0) },
+    { UINT8_C(255),
+      { -INT64_C(1252604858424260791),  INT64_C( 112625175077355536),  INT64_C(1156300374731786496),  INT64_C(8233317902620769433),
+        -INT64_C(8932889860888051708),  INT64_C(3677122480951352074), -INT64_C(3731299501016365147), -INT64_C(4900622961530713453) },
+      -INT64_C(5638051248478127560) },
+    { UINT8_C( 51),
+      {  INT64_C(4611686044201394208), -INT64_C(6725341146845017236), -INT64_C(7740375026141103340),  INT64_C(2862278036762140594),
+        -INT64_C(7941833016163709921), -INT64_C(2501704373626309313), -INT64_C(1940166795910836737),  INT64_C( 960664088635600713) },
+      INT64_C(5889551581275909354) },
+    { UINT8_C(200),
+      {  INT64_C(4298074317409215365), -INT64_C(1707100814743360817), -INT64_C( 866806024071503841),  INT64_C(6926676981566169088),
+        -INT64_C(6481373668072089718),  INT64_C(7246042307901782727),  INT64_C(2305843215447753731),  INT64_C(  11259377103218704) },
+      -INT64_C(9202964499592410093) },
+    { UINT8_C(104),
+      { -INT64_C(5858975173588694361), -INT64_C(5301222610749920869),  INT64_C( 288969872883351616), -INT64_C( 765835411283037410),
+        -INT64_C(8601161566236780421), -INT64_C(8972962760809916841),  INT64_C(1570464961807647720),  INT64_C( 630503950517535360) },
+      -INT64_C(8168333210285306531) },
+    { UINT8_C(226),
+      { -INT64_C( 998790629161371205),  INT64_C(3726943601446504479),  INT64_C(5505645279868210497),  INT64_C(7141586738152303225),
+         INT64_C(3566966594831431726), -INT64_C(8437403335462231531),  INT64_C(4923931365868673337),  INT64_C( 360859733432942624) },
+      INT64_C( 574331365285888909) },
+    { UINT8_C( 63),
+      {  INT64_C(6846683578450192330),  INT64_C(7464860145777039822), -INT64_C(1969683350849278740),  INT64_C( 716711089226170629),
+        -INT64_C(7953520023689778686),  INT64_C(4363366468438074251), -INT64_C(8285313395180093332),  INT64_C( 925140572404532529) },
+      -INT64_C(8978326166357132010) },
+    { UINT8_C(107),
+      { -INT64_C(1002286709965430573),  INT64_C(1770656707338225554),  INT64_C(       549823120384),  INT64_C(  40532431614312450),
+        -INT64_C(1137655580127759979), -INT64_C(2371868762585661896), -INT64_C(5414721407101548983),  INT64_C(    219902362091520) },
+      -INT64_C(6977687740700103448) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_add_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      674.19), SIMDE_FLOAT32_C(     -257.20), SIMDE_FLOAT32_C(     -573.62), SIMDE_FLOAT32_C(     -707.37),
+        SIMDE_FLOAT32_C(      -48.08), SIMDE_FLOAT32_C(     -930.82), SIMDE_FLOAT32_C(     -662.42), SIMDE_FLOAT32_C(     -157.21),
+        SIMDE_FLOAT32_C(     -893.34), SIMDE_FLOAT32_C(     -882.68), SIMDE_FLOAT32_C(     -867.63), SIMDE_FLOAT32_C(       54.57),
+        SIMDE_FLOAT32_C(     -172.93), SIMDE_FLOAT32_C(     -661.36), SIMDE_FLOAT32_C(      803.48), SIMDE_FLOAT32_C(      944.20) },
+      SIMDE_FLOAT32_C(    -4338.22) },
+    { { SIMDE_FLOAT32_C(100000000.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00),
+        SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00),
+        SIMDE_FLOAT32_C(-100000000.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00),
+        SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00) },
+      SIMDE_FLOAT32_C(       14.00) },
+    { { SIMDE_FLOAT32_C(     -950.07), SIMDE_FLOAT32_C(      250.56), SIMDE_FLOAT32_C(      817.21), SIMDE_FLOAT32_C(      172.68),
+        SIMDE_FLOAT32_C(      153.46), SIMDE_FLOAT32_C(     -312.90), SIMDE_FLOAT32_C(     -589.75), SIMDE_FLOAT32_C(      660.09),
+        SIMDE_FLOAT32_C(      476.01), SIMDE_FLOAT32_C(      932.53), SIMDE_FLOAT32_C(      899.13), SIMDE_FLOAT32_C(      201.97),
+        SIMDE_FLOAT32_C(     -742.76), SIMDE_FLOAT32_C(      702.34), SIMDE_FLOAT32_C(      707.96), SIMDE_FLOAT32_C(     -153.93) },
+      SIMDE_FLOAT32_C(     3224.53) },
+    { { SIMDE_FLOAT32_C(       26.41), SIMDE_FLOAT32_C(      456.28), SIMDE_FLOAT32_C(     -327.84), SIMDE_FLOAT32_C(     -543.47),
+        SIMDE_FLOAT32_C(     -349.49), SIMDE_FLOAT32_C(     -441.44), SIMDE_FLOAT32_C(      144.31), SIMDE_FLOAT32_C(      503.17),
+        SIMDE_FLOAT32_C(      617.63), SIMDE_FLOAT32_C(      324.59), SIMDE_FLOAT32_C(     -618.76), SIMDE_FLOAT32_C(      420.72),
+        SIMDE_FLOAT32_C(     -506.18), SIMDE_FLOAT32_C(     -728.81), SIMDE_FLOAT32_C(     -149.03), SIMDE_FLOAT32_C(      988.23) },
+      SIMDE_FLOAT32_C(     -183.68) },
+    { { SIMDE_FLOAT32_C(     -799.40), SIMDE_FLOAT32_C(      388.11), SIMDE_FLOAT32_C(     -799.95), SIMDE_FLOAT32_C(     -203.85),
+        SIMDE_FLOAT32_C(      432.98), SIMDE_FLOAT32_C(      229.12), SIMDE_FLOAT32_C(      539.50), SIMDE_FLOAT32_C(     -416.31),
+        SIMDE_FLOAT32_C(      353.42), SIMDE_FLOAT32_C(     -602.18), SIMDE_FLOAT32_C(     -684.04), SIMDE_FLOAT32_C(       32.27),
+        SIMDE_FLOAT32_C(      717.62), SIMDE_FLOAT32_C(     -682.24), SIMDE_FLOAT32_C(     -634.50), SIMDE_FLOAT32_C(     -723.09) },
+      SIMDE_FLOAT32_C(    -2852.54) },
+    { { SIMDE_FLOAT32_C(     -683.01), SIMDE_FLOAT32_C(     -296.63), SIMDE_FLOAT32_C(     -887.79), SIMDE_FLOAT32_C(     -225.90),
+        SIMDE_FLOAT32_C(      488.99), SIMDE_FLOAT32_C(     -477.27), SIMDE_FLOAT32_C(      945.21), SIMDE_FLOAT32_C(     -478.38),
+        SIMDE_FLOAT32_C(      -15.33), SIMDE_FLOAT32_C(       90.45), SIMDE_FLOAT32_C(       41.91), SIMDE_FLOAT32_C(      426.63),
+        SIMDE_FLOAT32_C(       16.68), SIMDE_FLOAT32_C(      615.14), SIMDE_FLOAT32_C(      161.41), SIMDE_FLOAT32_C(      913.66) },
+      SIMDE_FLOAT32_C(      635.77) },
+    { { SIMDE_FLOAT32_C(     -439.21), SIMDE_FLOAT32_C(      876.47), SIMDE_FLOAT32_C(     -282.68), SIMDE_FLOAT32_C(       -4.27),
+        SIMDE_FLOAT32_C(     -173.63), SIMDE_FLOAT32_C(     -883.88), SIMDE_FLOAT32_C(      606.82), SIMDE_FLOAT32_C(      748.19),
+        SIMDE_FLOAT32_C(     -913.52), SIMDE_FLOAT32_C(     -472.13), SIMDE_FLOAT32_C(     -834.88), SIMDE_FLOAT32_C(      110.33),
+        SIMDE_FLOAT32_C(     -249.35), SIMDE_FLOAT32_C(      901.76), SIMDE_FLOAT32_C(      302.17), SIMDE_FLOAT32_C(     -880.40) },
+      SIMDE_FLOAT32_C(    -1588.21) },
+    { { SIMDE_FLOAT32_C(      828.82), SIMDE_FLOAT32_C(      -79.57), SIMDE_FLOAT32_C(     -583.14), SIMDE_FLOAT32_C(     -814.48),
+        SIMDE_FLOAT32_C(       50.19), SIMDE_FLOAT32_C(      874.71), SIMDE_FLOAT32_C(     -369.55), SIMDE_FLOAT32_C(     -275.31),
+        SIMDE_FLOAT32_C(      723.40), SIMDE_FLOAT32_C(      292.92), SIMDE_FLOAT32_C(      550.10), SIMDE_FLOAT32_C(     -995.46),
+        SIMDE_FLOAT32_C(      720.45), SIMDE_FLOAT32_C(      977.45), SIMDE_FLOAT32_C(     -231.24), SIMDE_FLOAT32_C(      619.47) },
+      SIMDE_FLOAT32_C(     2288.76) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_add_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(     -682.90), SIMDE_FLOAT32_C(      491.90), SIMDE_FLOAT32_C(       11.76), SIMDE_FLOAT32_C(     -545.63),
+        SIMDE_FLOAT32_C(       11.57), SIMDE_FLOAT32_C(     -746.10), SIMDE_FLOAT32_C(     -363.67), SIMDE_FLOAT32_C(      752.92),
+        SIMDE_FLOAT32_C(      880.51), SIMDE_FLOAT32_C(     -831.95), SIMDE_FLOAT32_C(     -669.37), SIMDE_FLOAT32_C(     -697.51),
+        SIMDE_FLOAT32_C(       48.15), SIMDE_FLOAT32_C(     -155.68), SIMDE_FLOAT32_C(      365.23), SIMDE_FLOAT32_C(     -597.82) },
+      SIMDE_FLOAT32_C(        0.00) },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(100000000.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00),
+        SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00),
+        SIMDE_FLOAT32_C(-100000000.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00),
+        SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00), SIMDE_FLOAT32_C(        1.00) },
+      SIMDE_FLOAT32_C(       14.00) },
+    { UINT16_C(37803),
+      { SIMDE_FLOAT32_C(     -397.24), SIMDE_FLOAT32_C(     -575.49), SIMDE_FLOAT32_C(      539.67), SIMDE_FLOAT32_C(       73.59),
+        SIMDE_FLOAT32_C(      578.58), SIMDE_FLOAT32_C(     -822.69), SIMDE_FLOAT32_C(     -130.11), SIMDE_FLOAT32_C(     -187.46),
+        SIMDE_FLOAT32_C(       65.46), SIMDE_FLOAT32_C(     -603.76), SIMDE_FLOAT32_C(     -452.36), SIMDE_FLOAT32_C(      702.33),
+        SIMDE_FLOAT32_C(     -134.97), SIMDE_FLOAT32_C(       78.92), SIMDE_FLOAT32_C(     -561.11), SIMDE_FLOAT32_C(       24.59) },
+      SIMDE_FLOAT32_C(    -2557.97) },
+    { UINT16_C(11254),
+      { SIMDE_FLOAT32_C(     -159.96), SIMDE_FLOAT32_C(      279.27), SIMDE_FLOAT32_C(     -347.13), SIMDE_FLOAT32_C(     -677.66),
+        SIMDE_FLOAT32_C(      -80.29), SIMDE_FLOAT32_C(     -594.04), SIMDE_FLOAT32_C(      -50.02), SIMDE_FLOAT32_C(     -301.02),
+        SIMDE_FLOAT32_C(     -653.91), SIMDE_FLOAT32_C(     -387.66), SIMDE_FLOAT32_C(      788.38), SIMDE_FLOAT32_C(      755.22),
+        SIMDE_FLOAT32_C(      735.37), SIMDE_FLOAT32_C(     -562.72), SIMDE_FLOAT32_C(      -81.69), SIMDE_FLOAT32_C(      338.89) },
+      SIMDE_FLOAT32_C(    -1942.30) },
+    { UINT16_C(18734),
+      { SIMDE_FLOAT32_C(      150.21), SIMDE_FLOAT32_C(     -101.32), SIMDE_FLOAT32_C(     -431.60), SIMDE_FLOAT32_C(      698.45),
+        SIMDE_FLOAT32_C(     -556.66), SIMDE_FLOAT32_C(     -368.05), SIMDE_FLOAT32_C(      709.11), SIMDE_FLOAT32_C(      858.56),
+        SIMDE_FLOAT32_C(     -604.59), SIMDE_FLOAT32_C(     -457.22), SIMDE_FLOAT32_C(      370.16), SIMDE_FLOAT32_C(      888.17),
+        SIMDE_FLOAT32_C(      746.80), SIMDE_FLOAT32_C(     -392.01), SIMDE_FLOAT32_C(     -957.18), SIMDE_FLOAT32_C(      656.66) },
+      SIMDE_FLOAT32_C(     -876.12) },
+    { UINT16_C( 6581),
+      { SIMDE_FLOAT32_C(     -546.39), SIMDE_FLOAT32_C(      881.78), SIMDE_FLOAT32_C(     -287.37), SIMDE_FLOAT32_C(      564.07),
+        SIMDE_FLOAT32_C(     -830.85), SIMDE_FLOAT32_C(      600.61), SIMDE_FLOAT32_C(     -454.40), SIMDE_FLOAT32_C(      326.28),
+        SIMDE_FLOAT32_C(     -420.72), SIMDE_FLOAT32_C(      464.50), SIMDE_FLOAT32_C(      401.82), SIMDE_FLOAT32_C(      969.78),
+        SIMDE_FLOAT32_C(     -596.47), SIMDE_FLOAT32_C(     -164.92), SIMDE_FLOAT32_C(      787.11), SIMDE_FLOAT32_C(      262.68) },
+      SIMDE_FLOAT32_C(     -785.13) },
+    { UINT16_C(63985),
+      { SIMDE_FLOAT32_C(     -368.04), SIMDE_FLOAT32_C(     -968.37), SIMDE_FLOAT32_C(      391.81), SIMDE_FLOAT32_C(      -75.26),
+        SIMDE_FLOAT32_C(     -505.09), SIMDE_FLOAT32_C(     -266.63), SIMDE_FLOAT32_C(      174.73), SIMDE_FLOAT32_C(       -0.95),
+        SIMDE_FLOAT32_C(     -768.88), SIMDE_FLOAT32_C(     -865.18), SIMDE_FLOAT32_C(     -899.50), SIMDE_FLOAT32_C(      966.96),
+        SIMDE_FLOAT32_C(     -817.71), SIMDE_FLOAT32_C(     -262.64), SIMDE_FLOAT32_C(      550.57), SIMDE_FLOAT32_C(     -819.61) },
+      SIMDE_FLOAT32_C(    -2117.29) },
+    { UINT16_C(33039),
+      { SIMDE_FLOAT32_C(     -207.24), SIMDE_FLOAT32_C(      -65.04), SIMDE_FLOAT32_C(      944.94), SIMDE_FLOAT32_C(      194.60),
+        SIMDE_FLOAT32_C(      102.84), SIMDE_FLOAT32_C(     -480.71), SIMDE_FLOAT32_C(      886.82), SIMDE_FLOAT32_C(      329.00),
+        SIMDE_FLOAT32_C(     -387.57), SIMDE_FLOAT32_C(      929.28), SIMDE_FLOAT32_C(     -469.51), SIMDE_FLOAT32_C(      893.90),
+        SIMDE_FLOAT32_C(      898.08), SIMDE_FLOAT32_C(      615.73), SIMDE_FLOAT32_C(     -426.06), SIMDE_FLOAT32_C(      896.23) },
+      SIMDE_FLOAT32_C(     1375.92) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_add_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      656.16), SIMDE_FLOAT64_C(     -727.96), SIMDE_FLOAT64_C(     -108.43), SIMDE_FLOAT64_C(     -970.00),
+        SIMDE_FLOAT64_C(     -120.51), SIMDE_FLOAT64_C(      334.99), SIMDE_FLOAT64_C(       36.94), SIMDE_FLOAT64_C(     -541.55) },
+      SIMDE_FLOAT64_C(    -1440.36) },
+    { { SIMDE_FLOAT64_C(100000000000000000.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00),
+        SIMDE_FLOAT64_C(-100000000000000000.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00) },
+      SIMDE_FLOAT64_C(        6.00) },
+    { { SIMDE_FLOAT64_C(     -671.76), SIMDE_FLOAT64_C(     -963.70), SIMDE_FLOAT64_C(      376.56), SIMDE_FLOAT64_C(     -903.64),
+        SIMDE_FLOAT64_C(      -23.16), SIMDE_FLOAT64_C(      850.81), SIMDE_FLOAT64_C(      408.27), SIMDE_FLOAT64_C(      697.71) },
+      SIMDE_FLOAT64_C(     -228.91) },
+    { { SIMDE_FLOAT64_C(      925.29), SIMDE_FLOAT64_C(     -456.86), SIMDE_FLOAT64_C(      336.85), SIMDE_FLOAT64_C(      784.10),
+        SIMDE_FLOAT64_C(     -207.67), SIMDE_FLOAT64_C(      784.24), SIMDE_FLOAT64_C(     -862.85), SIMDE_FLOAT64_C(     -837.67) },
+      SIMDE_FLOAT64_C(      465.43) },
+    { { SIMDE_FLOAT64_C(      611.24), SIMDE_FLOAT64_C(       68.09), SIMDE_FLOAT64_C(     -597.82), SIMDE_FLOAT64_C(      200.65),
+        SIMDE_FLOAT64_C(     -132.96), SIMDE_FLOAT64_C(      223.39), SIMDE_FLOAT64_C(      939.21), SIMDE_FLOAT64_C(     -806.85) },
+      SIMDE_FLOAT64_C(      504.95) },
+    { { SIMDE_FLOAT64_C(      947.26), SIMDE_FLOAT64_C(      446.18), SIMDE_FLOAT64_C(      917.29), SIMDE_FLOAT64_C(      490.98),
+        SIMDE_FLOAT64_C(      863.17), SIMDE_FLOAT64_C(      -18.13), SIMDE_FLOAT64_C(      946.75), SIMDE_FLOAT64_C(     -961.58) },
+      SIMDE_FLOAT64_C(     3631.92) },
+    { { SIMDE_FLOAT64_C(      959.15), SIMDE_FLOAT64_C(      974.63), SIMDE_FLOAT64_C(     -199.75), SIMDE_FLOAT64_C(     -992.20),
+        SIMDE_FLOAT64_C(      820.55), SIMDE_FLOAT64_C(      961.40), SIMDE_FLOAT64_C(      275.33), SIMDE_FLOAT64_C(      174.73) },
+      SIMDE_FLOAT64_C(     2973.84) },
+    { { SIMDE_FLOAT64_C(     -681.27), SIMDE_FLOAT64_C(     -561.01), SIMDE_FLOAT64_C(      733.64), SIMDE_FLOAT64_C(      530.82),
+        SIMDE_FLOAT64_C(     -395.42), SIMDE_FLOAT64_C(     -171.56), SIMDE_FLOAT64_C(     -152.02), SIMDE_FLOAT64_C(      443.58) },
+      SIMDE_FLOAT64_C(     -253.24) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_add_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(      -48.28), SIMDE_FLOAT64_C(     -146.38), SIMDE_FLOAT64_C(      -45.65), SIMDE_FLOAT64_C(      596.61),
+        SIMDE_FLOAT64_C(     -402.93), SIMDE_FLOAT64_C(      326.60), SIMDE_FLOAT64_C(     -995.66), SIMDE_FLOAT64_C(     -722.28) },
+      SIMDE_FLOAT64_C(        0.00) },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(100000000000000000.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00),
+        SIMDE_FLOAT64_C(-100000000000000000.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00), SIMDE_FLOAT64_C(        1.00) },
+      SIMDE_FLOAT64_C(        6.00) },
+    { UINT8_C(104),
+      { SIMDE_FLOAT64_C(     -108.07), SIMDE_FLOAT64_C(     -426.77), SIMDE_FLOAT64_C(     -560.09), SIMDE_FLOAT64_C(     -848.26),
+        SIMDE_FLOAT64_C(      649.97), SIMDE_FLOAT64_C(     -783.14), SIMDE_FLOAT64_C(      123.76), SIMDE_FLOAT64_C(      -46.40) },
+      SIMDE_FLOAT64_C(    -1507.64) },
+    { UINT8_C(147),
+      { SIMDE_FLOAT64_C(     -968.92), SIMDE_FLOAT64_C(      729.33), SIMDE_FLOAT64_C(      607.59), SIMDE_FLOAT64_C(      893.98),
+        SIMDE_FLOAT64_C(      590.67), SIMDE_FLOAT64_C(     -424.88), SIMDE_FLOAT64_C(      459.71), SIMDE_FLOAT64_C(     -825.78) },
+      SIMDE_FLOAT64_C(     -474.70) },
+    { UINT8_C(195),
+      { SIMDE_FLOAT64_C(     -586.88), SIMDE_FLOAT64_C(      826.52), SIMDE_FLOAT64_C(     -786.93), SIMDE_FLOAT64_C(     -839.80),
+        SIMDE_FLOAT64_C(      702.86), SIMDE_FLOAT64_C(     -648.85), SIMDE_FLOAT64_C(     -176.75), SIMDE_FLOAT64_C(     -247.08) },
+      SIMDE_FLOAT64_C(     -184.19) },
+    { UINT8_C( 94),
+      { SIMDE_FLOAT64_C(     -968.37), SIMDE_FLOAT64_C(      653.17), SIMDE_FLOAT64_C(     -171.58), SIMDE_FLOAT64_C(      220.72),
+        SIMDE_FLOAT64_C(      329.43), SIMDE_FLOAT64_C(      894.57), SIMDE_FLOAT64_C(      664.63), SIMDE_FLOAT64_C(      103.50) },
+      SIMDE_FLOAT64_C(     1696.37) },
+    { UINT8_C(134),
+      { SIMDE_FLOAT64_C(      574.19), SIMDE_FLOAT64_C(     -390.18), SIMDE_FLOAT64_C(      265.69), SIMDE_FLOAT64_C(     -566.59),
+        SIMDE_FLOAT64_C(      -47.78), SIMDE_FLOAT64_C(     -189.99), SIMDE_FLOAT64_C(      637.37), SIMDE_FLOAT64_C(      -25.40) },
+      SIMDE_FLOAT64_C(     -149.89) },
+    { UINT8_C(159),
+      { SIMDE_FLOAT64_C(      417.18), SIMDE_FLOAT64_C(      484.77), SIMDE_FLOAT64_C(     -206.45), SIMDE_FLOAT64_C(      -39.23),
+        SIMDE_FLOAT64_C(      572.96), SIMDE_FLOAT64_C(     -722.14), SIMDE_FLOAT64_C(     -277.93), SIMDE_FLOAT64_C(     -798.21) },
+      SIMDE_FLOAT64_C(      431.02) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_add_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_and_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(  335675395), -INT32_C(  268452101), -INT32_C(       2117),  INT32_C( 2080370623),
+        -INT32_C(     524289), -INT32_C(  547377156), -INT32_C(   68165851), -INT32_C(      66561),
+        -INT32_C(    3145761), -INT32_C(         49), -INT32_C(  536871433), -INT32_C( 1076105226),
+        -INT32_C(      19201), -INT32_C(     262151), -INT32_C(   92799507), -INT32_C(  268435521) },
+      INT32_C(  171999232) },
+    { { -INT32_C(   16777259), -INT32_C(  622854145), -INT32_C(     270405), -INT32_C(   33686529),
+        -INT32_C( 1208877569), -INT32_C(  536871941), -INT32_C(  538051585), -INT32_C(      17153),
+        -INT32_C(  276824197), -INT32_C(    2228257), -INT32_C(  269058049), -INT32_C(  806375425),
+        -INT32_C(      16386), -INT32_C(  537149569), -INT32_C(     270337), -INT32_C(   16785473) },
+      -INT32_C( 2143287280) },
+    { { -INT32_C(     139393), -INT32_C(     532745), -INT32_C(   33948505), -INT32_C(  270598217),
+        -INT32_C(  402935841), -INT32_C( 1209208851),  INT32_C( 2145352511), -INT32_C(     262657),
+        -INT32_C(     263169), -INT32_C( 1115701269), -INT32_C(      17729), -INT32_C(   17596449),
+        -INT32_C(   83886081),  INT32_C( 1069277167), -INT32_C(   10752006), -INT32_C(    1114113) },
+      INT32_C(  536872960) },
+    { { -INT32_C(     786449),  INT32_C( 2145386478), -INT32_C(   16779265), -INT32_C(     397386),
+        -INT32_C(     262146), -INT32_C(  142688297), -INT32_C(    2129921), -INT32_C(       8454),
+        -INT32_C(  269910028), -INT32_C(   16777729), -INT32_C(      14353),  INT32_C( 2012740223),
+        -INT32_C(    1442049), -INT32_C(       8449), -INT32_C(     131137), -INT32_C(   67108885) },
+      INT32_C( 1648361472) },
+    { {  INT32_C( 2147475319), -INT32_C(       4099), -INT32_C(  604185153), -INT32_C(   72351745),
+                   INT32_MAX, -INT32_C(   33816581),  INT32_C( 1576008699), -INT32_C(    1310721),
+         INT32_C( 2130050045), -INT32_C(      16417), -INT32_C(       4385), -INT32_C(   67505153),
+        -INT32_C( 1077952899), -INT32_C( 1149255681), -INT32_C(   37748737), -INT32_C(   25690689) },
+      INT32_C(  404783121) },
+    { { -INT32_C( 1140981764), -INT32_C(      65569),  INT32_C( 2130631675), -INT32_C(   16777233),
+        -INT32_C( 1075315330), -INT32_C(  276824067), -INT32_C( 1073881094),  INT32_C( 2142740447),
+        -INT32_C(   67174933), -INT32_C( 1073742529), -INT32_C(   52958209), -INT32_C(        257),
+         INT32_C( 1063243647), -INT32_C(     528417), -INT32_C(  201342985), -INT32_C(    8388619) },
+      INT32_C(  537167872) },
+    { { -INT32_C(    3276835), -INT32_C(      33921), -INT32_C(  134217731),  INT32_C( 2138962941),
+         INT32_C( 2147479551), -INT32_C(     131205), -INT32_C(    4816897), -INT32_C( 1073807617),
+        -INT32_C(         18), -INT32_C(        105), -INT32_C(    8390145), -INT32_C(      33153),
+        -INT32_C(       4098), -INT32_C(    2097153), -INT32_C( 1258307585), -INT32_C(  134254593) },
+      INT32_C(  872687616) },
+    { { -INT32_C(  109059075), -INT32_C(      18465), -INT32_C(      16389), -INT32_C(   11012123),
+        -INT32_C(        133),  INT32_C( 1577039871), -INT32_C( 1074268161),  INT32_C( 2147478335),
+        -INT32_C(  136314883), -INT32_C( 1107558497), -INT32_C(  603979777), -INT32_C(  268435459),
+        -INT32_C(   67126419), -INT32_C(      36097), -INT32_C(  276824321), -INT32_C(  209723915) },
+      INT32_C(   22216705) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_and_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_and_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C(  134217729), -INT32_C(  805863466), -INT32_C(      32769), -INT32_C(       3105),
+        -INT32_C(     528401), -INT32_C( 1073741825), -INT32_C(         14), -INT32_C(      38145),
+        -INT32_C(  167804932), -INT32_C(    1048577), -INT32_C(   51380274),  INT32_C( 2063572991),
+        -INT32_C(     131089), -INT32_C(  268959777),  INT32_C( 2145377279), -INT32_C( 1073758465) },
+      -INT32_C(          1) },
+    { UINT16_C(65535),
+      { -INT32_C(     524802), -INT32_C( 1074790401), -INT32_C(  335544321), -INT32_C(   59244577),
+        -INT32_C(    8421381), -INT32_C(     610565), -INT32_C(  545341961),  INT32_C( 2146417215),
+        -INT32_C(      40969), -INT32_C(      65665), -INT32_C(       2073), -INT32_C(  134217737),
+        -INT32_C( 1074037249),  INT32_C( 2113929183), -INT32_C(  537137665), -INT32_C(    4194305) },
+      INT32_C(    2228226) },
+    { UINT16_C( 6229),
+      { -INT32_C(    8455297), -INT32_C( 1076102409),  INT32_C( 2147483631), -INT32_C(  713164801),
+        -INT32_C(    1081921), -INT32_C(   17040153), -INT32_C(  554338306), -INT32_C(   33816579),
+        -INT32_C(       6145), -INT32_C(         19), -INT32_C( 1084227589), -INT32_C(    4194305),
+        -INT32_C(    4718593), -INT32_C(          1),  INT32_C( 2147221503), -INT32_C(  170143874) },
+      INT32_C( 1579446574) },
+    { UINT16_C(15214),
+      { -INT32_C( 1074266121), -INT32_C(    4194353), -INT32_C(       4097), -INT32_C( 1346371585),
+        -INT32_C(   17825858), -INT32_C(    1180225), -INT32_C(  268500993),  INT32_C( 2145381757),
+        -INT32_C(  541139529), -INT32_C(    8422913), -INT32_C(  554713355), -INT32_C(  546308099),
+         INT32_C( 2130639775), -INT32_C(          1), -INT32_C(   71306257), -INT32_C(  269488385) },
+      INT32_C(  237783429) },
+    { UINT16_C(30621),
+      { -INT32_C(  806092929), -INT32_C(   17042433),  INT32_C( 1610612607), -INT32_C(  545267713),
+         INT32_C( 2143272959),  INT32_C( 2147352559), -INT32_C(   17563777), -INT32_C(  973080577),
+        -INT32_C( 1145054209), -INT32_C(  570429570), -INT32_C(  545343489), -INT32_C(  268567553),
+        -INT32_C(  539001345), -INT32_C( 1342183506), -INT32_C(  436207617), -INT32_C(        650) },
+      INT32_C(   17957166) },
+    { UINT16_C(40786),
+      { -INT32_C(  268566597), -INT32_C(   33720835), -INT32_C(   17829891), -INT32_C( 1082261573),
+        -INT32_C( 1073744001), -INT32_C(    1048609),  INT32_C( 2147221502), -INT32_C(    9175041),
+         INT32_C( 2111700791), -INT32_C(  136593553), -INT32_C(  537395233),  INT32_C( 2146957309),
+        -INT32_C(   16784454), -INT32_C( 1073758733), -INT32_C(        257),  INT32_C( 2146426543) },
+      INT32_C(  348192768) },
+    { UINT16_C(53121),
+      { -INT32_C(      65809), -INT32_C( 1073742345), -INT32_C(        257),  INT32_C( 2147479487),
+        -INT32_C(  805323785), -INT32_C(       2097), -INT32_C(    1708193), -INT32_C(  268437538),
+        -INT32_C(    9519105), -INT32_C(   16794121), -INT32_C(      16453), -INT32_C(  138936609),
+        -INT32_C(    2131969), -INT32_C(   17301506), -INT32_C(    6430728),  INT32_C( 2147483581) },
+      INT32_C( 1711576192) },
+    { UINT16_C(34185),
+      { -INT32_C( 1073762433), -INT32_C(  295829505), -INT32_C(  537486850), -INT32_C( 1610621953),
+        -INT32_C( 1107689473), -INT32_C(    4734993),  INT32_C( 1870659047),  INT32_C( 1073676287),
+        -INT32_C(   36249737), -INT32_C(        513), -INT32_C(  549456129), -INT32_C(         65),
+        -INT32_C(          1), -INT32_C(          2), -INT32_C(   10487302), -INT32_C(   73400321) },
+      INT32_C(  420905591) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_and_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_and_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(  18155204717346945), -INT64_C(   4576718762287105), -INT64_C(5336906298606879009), -INT64_C( 288380189212426763),
+         INT64_C(2161727821136787455), -INT64_C(2305851805576749569), -INT64_C(  73414391386603521), -INT64_C(1225542052926721094) },
+      INT64_C(  47610150791483408) },
+    { { -INT64_C(         2181300289),  INT64_C(9223089702884605362),  INT64_C(6332061071787947839), -INT64_C(4865031106849734785),
+        -INT64_C(  77124762630881282), -INT64_C(     35184405709065), -INT64_C(  18687299625811977), -INT64_C(4674775997843898409) },
+      INT64_C(1443556660210103314) },
+    { { -INT64_C(     28862247338017),  INT64_C(4611686018292903931), -INT64_C(  72480081397678881), -INT64_C( 303289631003247761),
+        -INT64_C(2310349263671918657), -INT64_C(       550864191749), -INT64_C(     17592187355649), -INT64_C( 288230376185276673) },
+      INT64_C(1930466464857931787) },
+    { { -INT64_C(   2533550073055745), -INT64_C(2324596280661114881), -INT64_C( 144115256828956681), -INT64_C(      4415249719314),
+         INT64_C(7493972178627385855), -INT64_C( 288379965567668809), -INT64_C( 288265564820999171),  INT64_C(9223336577604777980) },
+      INT64_C(4734483464971665828) },
+    { { -INT64_C( 576461319524323841), -INT64_C(      8873419210785),  INT64_C(4602608381402808285), -INT64_C( 144119727889842689),
+        -INT64_C(      8937829192197), -INT64_C(3317185900143706113), -INT64_C(4035506845303996417), -INT64_C( 576461302067726337) },
+      INT64_C( 132487030865929689) },
+    { { -INT64_C(1486207672537055233), -INT64_C(1155183206467641665), -INT64_C(1441151950014910985),  INT64_C(9211954158356135419),
+        -INT64_C(  83320991155093577), -INT64_C(         6450839809),  INT64_C(9221082166179782655),  INT64_C(9187059497107976191) },
+      INT64_C(7662382521100127411) },
+    { { -INT64_C(5766859597726351489), -INT64_C(  36033199520235553), -INT64_C( 166650812760653865), -INT64_C( 109212292641460245),
+        -INT64_C( 180146338773091081), -INT64_C(1162491653815017505), -INT64_C(2305843009281335361), -INT64_C(    670702101332993) },
+      -INT64_C(8358248170843502589) },
+    { { -INT64_C( 146369187323838465), -INT64_C(       274877911425), -INT64_C(2305896903545454881), -INT64_C( 146369324351752193),
+        -INT64_C(   9359289962463233), -INT64_C(   1143494307479554), -INT64_C(      1099512156181), -INT64_C(  19193075243946370) },
+      -INT64_C(2480765954176850358) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_and_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_and_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C(4625496027820982274), -INT64_C(4612248985562513544), -INT64_C(5765666009134400001), -INT64_C( 288230379909809166),
+        -INT64_C(4611686023263421489), -INT64_C(   2251799826268163), -INT64_C(  72067009696792577), -INT64_C(2315415357445120513) },
+      -INT64_C(                  1) },
+    { UINT8_C(255),
+      {  INT64_C(8502778499893805039), -INT64_C( 288230376172683801), -INT64_C(2450521147242971141), -INT64_C(1152921642045800481),
+        -INT64_C(1224979373522690061),  INT64_C(9223363232171776751), -INT64_C(  38350974166762501), -INT64_C(2305843009354336257) },
+      INT64_C(4644802883196096707) },
+    { UINT8_C(  8),
+      { -INT64_C(4904446382493925441),  INT64_C(9187340627421954047), -INT64_C( 297237611981864961), -INT64_C(1152956770583390209),
+        -INT64_C(  36662253163954177), -INT64_C(3458782114596521985), -INT64_C(      2765969852421), -INT64_C(  18014399064309769) },
+      -INT64_C(1152956770583390209) },
+    { UINT8_C( 68),
+      { -INT64_C(    562950020628485), -INT64_C(4899917034596941841), -INT64_C( 360362736997630211), -INT64_C(2305923171557049345),
+        -INT64_C( 576461302059237510), -INT64_C(    149671557480449),  INT64_C(9221120166710837235), -INT64_C(4755871581773758821) },
+      INT64_C(8860757429713207025) },
+    { UINT8_C(243),
+      { -INT64_C(2454479389140717587), -INT64_C(     18141941858564), -INT64_C( 297545455871459329), -INT64_C(4611686576773138633),
+        -INT64_C(4616471230508695553), -INT64_C(   2251799830724609), -INT64_C(1152921538966618185), -INT64_C(   4538784100122625) },
+      -INT64_C(8221656092976648540) },
+    { UINT8_C(173),
+      { -INT64_C(2305860670119485449), -INT64_C(   1163559541145601), -INT64_C(3459906116128616708), -INT64_C( 543388130472892417),
+        -INT64_C( 144546196634009601),  INT64_C(9223299194142259035), -INT64_C(    290271086512129), -INT64_C( 288231479958986753) },
+      INT64_C(5219988656796763728) },
+    { UINT8_C( 76),
+      { -INT64_C(4695003179543691275),  INT64_C(9205268569179258878), -INT64_C(  13510801029679105), -INT64_C(   9009398831645697),
+        -INT64_C( 577023995019395073),  INT64_C(8934558815924191167), -INT64_C( 292786753411482629), -INT64_C(4620693288557609089) },
+      -INT64_C( 301796154390694917) },
+    { UINT8_C( 14),
+      { -INT64_C(   1143526674531041), -INT64_C(1206964710335842337), -INT64_C( 361592265858715650), -INT64_C(   2251885847281665),
+        -INT64_C(1155174403932160265), -INT64_C(1175441978255609857), -INT64_C(     13262875787305), -INT64_C(   1548391578337537) },
+      -INT64_C(1570808862041806882) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_and_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(  650264683), -INT32_C( 1169205786), -INT32_C(  830467250),  INT32_C( 1711573210),
+         INT32_C( 1109265440), -INT32_C( 1440166662),  INT32_C(   69476352),  INT32_C(  144769026),
+         INT32_C(     884738),  INT32_C(   16777232), -INT32_C( 1838621716),  INT32_C( 1294271991),
+        -INT32_C(  566545597), -INT32_C( 1290133427), -INT32_C( 1732773340), -INT32_C( 1735570064) },
+      INT32_C( 1711573210) },
+    { { -INT32_C( 1252419307), -INT32_C(  375091330), -INT32_C( 1309708026),  INT32_C(          0),
+         INT32_C( 1708920167),  INT32_C( 1893811927), -INT32_C( 1926835559), -INT32_C(  925402718),
+         INT32_C(  268435712), -INT32_C(  798497863),  INT32_C(   13387417), -INT32_C( 1285094602),
+         INT32_C( 1470057521), -INT32_C( 1585444863), -INT32_C( 2147483520), -INT32_C( 1915494460) },
+      INT32_C( 1893811927) },
+    { { -INT32_C( 1722981942), -INT32_C( 1638995347),  INT32_C( 1673105609),  INT32_C(  134217776),
+         INT32_C( 1244461849), -INT32_C( 1421099893),  INT32_C(    4785153), -INT32_C(  492266631),
+        -INT32_C(  928059260), -INT32_C(  361813726),  INT32_C( 1568154948),  INT32_C( 1919591884),
+        -INT32_C( 1964426573),  INT32_C( 2037679375), -INT32_C(  226431992),  INT32_C(      49152) },
+      INT32_C( 2037679375) },
+    { {  INT32_C( 1330559406), -INT32_C(  624937420), -INT32_C(  620884409),  INT32_C(  229245628),
+         INT32_C( 1896996857), -INT32_C( 1745398472),  INT32_C( 1242027386),  INT32_C(  101236830),
+         INT32_C(  701223862), -INT32_C( 1778786203), -INT32_C( 1872045447),  INT32_C(  302514181),
+        -INT32_C( 1884420300), -INT32_C( 1229818048), -INT32_C( 1216961738),  INT32_C( 1176638119) },
+      INT32_C( 1896996857) },
+    { {  INT32_C(  134742081), -INT32_C( 1961327416), -INT32_C( 2146959288), -INT32_C(  789319374),
+         INT32_C(  431081901), -INT32_C( 1719577118),  INT32_C(  171303184),  INT32_C( 1394336223),
+         INT32_C(  398160584),  INT32_C( 1073741840),  INT32_C(   16777280),  INT32_C(  769592764),
+         INT32_C(   67108864),  INT32_C(    2134144),  INT32_C(   17076240),  INT32_C(  372517201) },
+      INT32_C( 1394336223) },
+    { {  INT32_C(    2131972), -INT32_C(  635892726), -INT32_C( 1886453726),  INT32_C(     196608),
+         INT32_C(   35685376), -INT32_C( 1276045547), -INT32_C(  811734570), -INT32_C( 1295884698),
+         INT32_C(  480838482),  INT32_C(  100925516),  INT32_C( 1048865140),  INT32_C(          0),
+         INT32_C(  830474976), -INT32_C( 1778705233), -INT32_C( 2080308696), -INT32_C( 1823983055) },
+      INT32_C( 1048865140) },
+    { {  INT32_C( 2099248742),  INT32_C( 1509998592), -INT32_C(  475187053), -INT32_C(  395402248),
+        -INT32_C( 2136920492), -INT32_C( 1674308315),  INT32_C( 1532698987),  INT32_C( 1210187777),
+        -INT32_C(  433138650), -INT32_C( 2052519753), -INT32_C( 2147483640),  INT32_C( 1628718629),
+        -INT32_C(  847211322),  INT32_C(  268726464),  INT32_C(   68173840),  INT32_C(  341526748) },
+      INT32_C( 2099248742) },
+    { {  INT32_C(      33024),  INT32_C( 1552221039),  INT32_C(  176955856),  INT32_C(    8404996),
+        -INT32_C(  952949352),  INT32_C(    4195592),  INT32_C( 1040557719),  INT32_C(   75471461),
+        -INT32_C( 1015243331), -INT32_C( 1105645510),  INT32_C(  631096290), -INT32_C( 1137365268),
+         INT32_C(  593392575),  INT32_C( 1173029208),  INT32_C(  226374661), -INT32_C( 1915868435) },
+      INT32_C( 1552221039) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_max_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C( 1958029100), -INT32_C(  557814721),  INT32_C( 1085603935), -INT32_C( 1212394449),
+        -INT32_C(  184312611),  INT32_C(  732262393), -INT32_C(  730110069),  INT32_C(    1314824),
+         INT32_C( 2072946019),  INT32_C(  329738818),  INT32_C(  768344660),  INT32_C(  572532768),
+         INT32_C(  574163793), -INT32_C( 1336255453),  INT32_C( 1842002517),  INT32_C( 1374078356) },
+      INT32_MIN },
+    { UINT16_C(65535),
+      { -INT32_C(  448045024),  INT32_C(  738271360), -INT32_C(  265440124),  INT32_C( 1012182441),
+         INT32_C(  898767665), -INT32_C( 1167316778), -INT32_C( 1321545805), -INT32_C( 1252201042),
+         INT32_C( 2030279597), -INT32_C(  667587633),  INT32_C( 1849811622), -INT32_C(  505486228),
+         INT32_C(    2130944), -INT32_C( 1635687390),  INT32_C( 1140758012),  INT32_C( 1177012054) },
+      INT32_C( 2030279597) },
+    { UINT16_C(42305),
+      {  INT32_C(  160782905), -INT32_C(  870574632),  INT32_C(  268435456),  INT32_C(  600147082),
+        -INT32_C(  269493950), -INT32_C(  666015276),  INT32_C(       4105),  INT32_C(      12292),
+        -INT32_C(  744915878),  INT32_C(  432873748),  INT32_C(  278780723), -INT32_C( 1974608499),
+         INT32_C(     887296), -INT32_C( 2145781463), -INT32_C( 1854482865),  INT32_C(  640369241) },
+      INT32_C(  640369241) },
+    { UINT16_C(14942),
+      { -INT32_C( 1621586483),  INT32_C(  447190592),  INT32_C(  272761348), -INT32_C( 1797959988),
+         INT32_C( 1563201122),  INT32_C(  536936448),  INT32_C(  701522866), -INT32_C( 2066746315),
+        -INT32_C(  688716377), -INT32_C(  876400312),  INT32_C(    7077889),  INT32_C(  486899864),
+        -INT32_C( 1007316042),  INT32_C(  810021260),  INT32_C( 1835126350), -INT32_C(  592874657) },
+      INT32_C( 1563201122) },
+    { UINT16_C(14145),
+      {  INT32_C(  101138432), -INT32_C(  764423741),  INT32_C( 1410638955),  INT32_C(  536870976),
+         INT32_C( 1846947268),  INT32_C( 1892721253),  INT32_C( 1478501419), -INT32_C( 2133904656),
+         INT32_C(  344828040),  INT32_C(  513529842),  INT32_C(         40),  INT32_C( 1817417312),
+         INT32_C( 1402262517),  INT32_C(  603980288),  INT32_C(  658154187),  INT32_C(  428659507) },
+      INT32_C( 1478501419) },
+    { UINT16_C(46887),
+      {  INT32_C( 1962938400), -INT32_C( 1237238842),  INT32_C(  580094896),  INT32_C(   38618644),
+        -INT32_C( 1539334359), -INT32_C( 1324573002), -INT32_C(  669935767), -INT32_C(  138468792),
+         INT32_C( 1176502272),  INT32_C(  645331033), -INT32_C(  333302273),  INT32_C(        256),
+        -INT32_C(  510919089), -INT32_C(  866826594),  INT32_C( 1313885225), -INT32_C( 1991045031) },
+      INT32_C( 1962938400) },
+    { UINT16_C( 5245),
+      {  INT32_C(  176822297), -INT32_C(  755841657),  INT32_C( 1330306707), -INT32_C( 1031712625),
+         INT32_C(  515777355), -INT32_C(  120420093),  INT32_C(  239368938), -INT32_C(  671263321),
+         INT32_C( 1826118200),  INT32_C(  689209408),  INT32_C(  268960009),  INT32_C( 1637992330),
+        -INT32_C(  884097468),  INT32_C(  269485057),  INT32_C(  754081987),  INT32_C( 1330055596) },
+      INT32_C( 1330306707) },
+    { UINT16_C(47164),
+      {  INT32_C( 1700454095), -INT32_C(   24710687), -INT32_C( 1610608640),  INT32_C( 1132138610),
+         INT32_C( 1158168592), -INT32_C(  578288947),  INT32_C( 1822193607), -INT32_C( 1647700999),
+        -INT32_C( 2053095805), -INT32_C( 1122627904),  INT32_C( 1498988927), -INT32_C(  606783667),
+         INT32_C( 1915042388),  INT32_C( 1098907906), -INT32_C(  466904779), -INT32_C(  481034942) },
+      INT32_C( 1915042388) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_max_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { { -INT32_C( 1797403313),  INT32_C(  553262917), -INT32_C(  570783496),  INT32_C( 1358294831),
+        -INT32_C(  498057490),  INT32_C( 2015923711), -INT32_C( 1878515200), -INT32_C( 1563849227),
+        -INT32_C(  193380968), -INT32_C(  674445818), -INT32_C(  486044520), -INT32_C(  331053977),
+         INT32_C( 1148969610),  INT32_C(      40961), -INT32_C(   82790902), -INT32_C(  780339523) },
+      UINT32_C(4212176394) },
+    { { -INT32_C( 2045425384),  INT32_C(  739149555), -INT32_C(   64114715),  INT32_C(   33555457),
+         INT32_C( 2040207359), -INT32_C(  356801660),  INT32_C( 1241695234),  INT32_C(   38797312),
+         INT32_C( 1688460822), -INT32_C( 1643700424), -INT32_C(   26931324), -INT32_C( 1192609529),
+         INT32_C( 1174968320), -INT32_C( 1691212910),  INT32_C( 1629767680), -INT32_C( 2015124386) },
+      UINT32_C(4268035972) },
+    { { -INT32_C(  602514470), -INT32_C(  922165521), -INT32_C( 1168425403),  INT32_C(   67125253),
+         INT32_C(   34086928),  INT32_C(    4210768), -INT32_C(  684461473), -INT32_C(  187060977),
+         INT32_C(  536870912),  INT32_C(  537135120),  INT32_C(  368975754), -INT32_C(  797963017),
+         INT32_C(  630259720), -INT32_C( 1941703703), -INT32_C(   67325537),  INT32_C(  489854967) },
+      UINT32_C(4227641759) },
+    { { -INT32_C(  720078028),  INT32_C( 2019415880),  INT32_C( 1107329064), -INT32_C( 2057517318),
+        -INT32_C( 1694723563),  INT32_C( 1073874240),  INT32_C(    8388656),  INT32_C( 1117235916),
+        -INT32_C(  362419374),  INT32_C( 1619709776),  INT32_C(   16908292),  INT32_C( 1371622320),
+        -INT32_C(   46086077), -INT32_C( 1235456115), -INT32_C(  794018702),  INT32_C( 1756595334) },
+      UINT32_C(4248881219) },
+    { {  INT32_C(  222221259), -INT32_C(  754244980), -INT32_C( 1295740315),  INT32_C(  766432978),
+         INT32_C(  260315828), -INT32_C(  413599176), -INT32_C(  811725904),  INT32_C( 1342177296),
+         INT32_C( 2101881954),  INT32_C(  828369134), -INT32_C(  865776290), -INT32_C(  522044989),
+        -INT32_C( 1466348865), -INT32_C( 1725999101), -INT32_C( 2055359157),  INT32_C( 1433718062) },
+      UINT32_C(3881368120) },
+    { { -INT32_C( 1240331616),  INT32_C( 1527310018),  INT32_C(  686788097),  INT32_C( 1446647824),
+         INT32_C( 1755058334),  INT32_C(    1114880), -INT32_C( 1807656668), -INT32_C( 2012113225),
+         INT32_C(  364302001),  INT32_C(  293652491),  INT32_C( 2145250944),  INT32_C(  821878387),
+         INT32_C(  252172469), -INT32_C( 1133801231), -INT32_C(  138481257),  INT32_C( 1700850582) },
+      UINT32_C(4156486039) },
+    { {  INT32_C(   33554689), -INT32_C( 1806286036),  INT32_C(  810024960), -INT32_C( 1752884438),
+         INT32_C(  454920079), -INT32_C( 1611916146),  INT32_C(  944343586),  INT32_C(  507668062),
+        -INT32_C( 1358606814), -INT32_C(  521571547),  INT32_C( 2110195347),  INT32_C(      32770),
+         INT32_C(  987268004),  INT32_C( 1002154226), -INT32_C( 1405645154),  INT32_C(    1049154) },
+      UINT32_C(3773395749) },
+    { {  INT32_C(  637551684),  INT32_C( 1073774592),  INT32_C(  887132029),  INT32_C( 2127636739),
+        -INT32_C( 1878026466),  INT32_C( 1312767620),  INT32_C( 1708986328), -INT32_C( 1238238464),
+        -INT32_C( 1481580702), -INT32_C( 1589419181), -INT32_C(  732330119),  INT32_C( 1502213369),
+         INT32_C(  132557986),  INT32_C(  134218016),  INT32_C( 1205718418),  INT32_C(  213123521) },
+      UINT32_C(3562637177) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_reduce_max_epu32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C(  693159543),  INT32_C(  325103750),  INT32_C(  615559494),  INT32_C( 1140851744),
+         INT32_C( 1188516814),  INT32_C( 1073905921), -INT32_C( 1647202614),  INT32_C(  134807634),
+        -INT32_C( 1159750147),  INT32_C(  482906479),  INT32_C(    3178496), -INT32_C(  500801503),
+         INT32_C(  536872322),  INT32_C( 1863443259), -INT32_C( 1924405273), -INT32_C( 1690928197) },
+      UINT32_C(         0) },
+    { UINT16_C(65535),
+      {  INT32_C( 1344502366),  INT32_C(    1115136), -INT32_C( 2147270583),  INT32_C( 1535334603),
+        -INT32_C(  268629828), -INT32_C( 2003638537), -INT32_C( 1463528606),  INT32_C( 1947969536),
+         INT32_C(  505811534), -INT32_C(   32919453),  INT32_C(   15730688),  INT32_C( 1926009073),
+         INT32_C( 1986601744),  INT32_C(  141274207),  INT32_C( 1824703597),  INT32_C(  609070024) },
+      UINT32_C(4262047843) },
+    { UINT16_C(53007),
+      { -INT32_C(  681659514), -INT32_C( 1931080915), -INT32_C(  245573310), -INT32_C( 1494326675),
+        -INT32_C(  824902946),  INT32_C(     196624),  INT32_C(  992071811),  INT32_C( 1543806499),
+         INT32_C( 1560757512),  INT32_C(    2099200), -INT32_C( 1195353796), -INT32_C(   61235110),
+         INT32_C(  894136101), -INT32_C( 2087993114),  INT32_C(  679679612), -INT32_C( 1982271917) },
+      UINT32_C(4233732186) },
+    { UINT16_C(10311),
+      { -INT32_C( 2072176976), -INT32_C(  701655215),  INT32_C( 1875039142), -INT32_C( 1283908163),
+        -INT32_C(  284095484), -INT32_C( 1369671720),  INT32_C(  272894080), -INT32_C( 1423835478),
+        -INT32_C( 1085397126),  INT32_C(  306184512), -INT32_C(  919242522),  INT32_C(  746701478),
+         INT32_C(  296886927),  INT32_C(  268571650),  INT32_C(  507967642),  INT32_C(  268632072) },
+      UINT32_C(3593312081) },
+    { UINT16_C(13231),
+      { -INT32_C(  626155260),  INT32_C( 1008897032),  INT32_C( 1899449463),  INT32_C(  150995120),
+        -INT32_C(  593656206),  INT32_C(   84934672),  INT32_C(  521144345),  INT32_C(   79724800),
+        -INT32_C( 1274270118),  INT32_C(  960307704),  INT32_C(  397074730),  INT32_C(  334320186),
+         INT32_C( 1090524244), -INT32_C(   81850247), -INT32_C( 1121120982),  INT32_C(          1) },
+      UINT32_C(4213117049) },
+    { UINT16_C( 9713),
+      {  INT32_C( 1725975702),  INT32_C(  161165412),  INT32_C( 1167590234), -INT32_C( 1342169088),
+         INT32_C( 1107592704),  INT32_C(     139266), -INT32_C(  397597988),  INT32_C(  537040392),
+         INT32_C(   67111168), -INT32_C(  783014142), -INT32_C( 1716698323),  INT32_C(    2162690),
+         INT32_C( 1076547996),  INT32_C(  746017634), -INT32_C( 1593681074), -INT32_C( 1485675398) },
+      UINT32_C(3897369308) },
+    { UINT16_C(38268),
+      { -INT32_C( 2139062240),  INT32_C( 1464795536),  INT32_C(     393728),  INT32_C( 1047188948),
+        -INT32_C( 1566230207),  INT32_C( 1722272983), -INT32_C( 2022051530),  INT32_C(   16777216),
+        -INT32_C( 1459617278),  INT32_C(  904872418), -INT32_C(  773190398), -INT32_C( 1116138721),
+        -INT32_C( 1927120560),  INT32_C( 1111097726),  INT32_C( 1034795587), -INT32_C( 1601373448) },
+      UINT32_C(3521776898) },
+    { UINT16_C(11174),
+      { -INT32_C(  105867196),  INT32_C( 2020488262),  INT32_C(  732490077), -INT32_C(  654141116),
+         INT32_C(  384912755),  INT32_C(  303771061),  INT32_C(  705294472), -INT32_C( 1022965468),
+         INT32_C(  269107203),  INT32_C(  569296818), -INT32_C(  947649642),  INT32_C(    1059072),
+        -INT32_C( 1563815249),  INT32_C(   25445932), -INT32_C(  607738506), -INT32_C(  486539264) },
+      UINT32_C(3272001828) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_mask_reduce_max_epu32(test_vec[i].k, a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(1699400794238860777), -INT64_C( 220092042796972239),  INT64_C(4006416895721698709),  INT64_C(3090251197929582367),
+        -INT64_C(9098634102272757006),  INT64_C(7205776996247308296), -INT64_C(5809888345734211208),  INT64_C( 324260345696944384) },
+      INT64_C(7205776996247308296) },
+    { { -INT64_C(8570350073164332736),  INT64_C(3803090061373046120), -INT64_C(7907437412689937402), -INT64_C(2982872129695673981),
+        -INT64_C(3094350015680588649), -INT64_C(2836176613943405511), -INT64_C(5821300277063965783),  INT64_C(4624235924130783735) },
+      INT64_C(4624235924130783735) },
+    { { -INT64_C(5729492193247655093),  INT64_C(6215103345026039176),  INT64_C(9080358981534130411),  INT64_C(2578464943865373753),
+        -INT64_C(1214272409994762505), -INT64_C(7233400219890114931),  INT64_C(2057500086500333091), -INT64_C(4660058046947704094) },
+      INT64_C(9080358981534130411) },
+    { { -INT64_C(8068118465925213694), -INT64_C(8449828340460972320),  INT64_C(8816977159371517179), -INT64_C(9223264834453204736),
+        -INT64_C(5934611590444412098), -INT64_C(7799211892981265886), -INT64_C(9007198086476201760),  INT64_C(8873912005262712686) },
+      INT64_C(8873912005262712686) },
+    { {  INT64_C(1056567997958991772), -INT64_C(4182218429668204795),  INT64_C(3259608138021621990),  INT64_C( 157070529098016013),
+        -INT64_C(1149102810829808006), -INT64_C(1512860054629253147), -INT64_C(5563105553611559246),  INT64_C( 865257687254827616) },
+      INT64_C(3259608138021621990) },
+    { { -INT64_C(6718114191230348645),  INT64_C(   1267874345861120),  INT64_C(1190113619287744512), -INT64_C(1912206025045647093),
+         INT64_C(3592300231762524102), -INT64_C(8408971238709238522),  INT64_C( 648518346346070022), -INT64_C(1118125967129012769) },
+      INT64_C(3592300231762524102) },
+    { {  INT64_C( 324824169968530671), -INT64_C(1818778196364525226),  INT64_C(4611704178715721736),  INT64_C(     17876727694337),
+        -INT64_C(8004950464285412673),  INT64_C(7766055099913914951),  INT64_C(3596516007338046260),  INT64_C(  72057664947589248) },
+      INT64_C(7766055099913914951) },
+    { {  INT64_C(6836115638155116849),  INT64_C(8820174808355140057),  INT64_C(5579853649305673435), -INT64_C(7056874167035324865),
+         INT64_C( 150892854774989344),  INT64_C(3731622865813428150),  INT64_C(9113985306488159790), -INT64_C(2817493253001939539) },
+      INT64_C(9113985306488159790) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_max_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C(6825849068253607336),  INT64_C(1329478224353778766), -INT64_C(9187167317975367416),  INT64_C(4621257816902991890),
+        -INT64_C(6753571987488549477),  INT64_C( 163379483330083488), -INT64_C( 801733974685991707), -INT64_C(1359551629433504778) },
+      INT64_MIN },
+    { UINT8_C(255),
+      {  INT64_C(8473893300312781446),  INT64_C(4605656043053901705),  INT64_C(3020929404105601458),  INT64_C(2521403443153899842),
+         INT64_C(1154050017061765120),  INT64_C(8364779953484770318),  INT64_C(2464080972574880070), -INT64_C(4593636158516223904) },
+      INT64_C(8473893300312781446) },
+    { UINT8_C( 79),
+      {  INT64_C(    571815338442816),  INT64_C(2838503107692524644),  INT64_C(6853518277299800478),  INT64_C(5949893826941699321),
+        -INT64_C(5792456703891210401), -INT64_C(2500345545934045780), -INT64_C(4679800562974846041),  INT64_C(2308415866422953984) },
+      INT64_C(6853518277299800478) },
+    { UINT8_C( 59),
+      {  INT64_C(5819713436183190720),  INT64_C(   1125906484101152),  INT64_C(2745766202209261941), -INT64_C( 157138810321910432),
+        -INT64_C(1049359638562411715),  INT64_C(4425160386223896508),  INT64_C(   9007199254905088),  INT64_C(  72761556626145281) },
+      INT64_C(5819713436183190720) },
+    { UINT8_C(203),
+      {  INT64_C(1942959690949219938), -INT64_C(7001537410648751155),  INT64_C( 360442178843213960), -INT64_C(2080440350262610730),
+        -INT64_C(  62692647378706744), -INT64_C(2087507628884496117), -INT64_C(4908961911626878681), -INT64_C(1860267835582257990) },
+      INT64_C(1942959690949219938) },
+    { UINT8_C(200),
+      {  INT64_C(5023496427540056741), -INT64_C(9079186162204516352),  INT64_C(2273846949557652174),  INT64_C(7153864125426558964),
+         INT64_C(6570071087731867262), -INT64_C(6250818659929709083), -INT64_C(4964730927116310815), -INT64_C(5916367131013489358) },
+      INT64_C(7153864125426558964) },
+    { UINT8_C(199),
+      { -INT64_C(7941695977116499494),  INT64_C(3849960935213972527),  INT64_C(1224980199230144584), -INT64_C( 733004839598736203),
+         INT64_C( 432910715636940816), -INT64_C(1362402989235726472), -INT64_C(4746504036231205744), -INT64_C(4685476589266838105) },
+      INT64_C(3849960935213972527) },
+    { UINT8_C(157),
+      {  INT64_C( 756605046642206721), -INT64_C(8473812675236355466),  INT64_C( 432346182707118226), -INT64_C(1759970596989976745),
+        -INT64_C( 581944886534960054),  INT64_C(1085577808800817929), -INT64_C(5801276127506902423), -INT64_C(8342308295047518013) },
+      INT64_C( 756605046642206721) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_max_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { { -INT64_C(8034418917730418688),  INT64_C(4620728476142471313),  INT64_C(4213864278845245429),  INT64_C(     17592328784016),
+         INT64_C(   4837855599789072),  INT64_C(8453909239329536075), -INT64_C(7850558633307071769),  INT64_C(  20829285732319272) },
+      UINT64_C(10596185440402479847) },
+    { {  INT64_C(3460558470830240263),  INT64_C(5644010047788495417),  INT64_C( 144115222435594498),  INT64_C(1197976227141391496),
+         INT64_C(3142813341191975709), -INT64_C(1937482331252332553),  INT64_C(7680956038998269209), -INT64_C(4218353983625165895) },
+      UINT64_C(16509261742457219063) },
+    { { -INT64_C(4057849222941349910),  INT64_C(1224979115825172488), -INT64_C(  51738391946476653), -INT64_C(1324276959945294206),
+         INT64_C(6975154049975727186),  INT64_C( 594510337416366080),  INT64_C(9065808055674682136),  INT64_C(   9009402707181833) },
+      UINT64_C(18395005681763074963) },
+    { {  INT64_C( 882776514188283904), -INT64_C(9020723978659000083), -INT64_C(7911200782008909886),  INT64_C(6630421432799439590),
+         INT64_C(9134854248131625005),  INT64_C(5016157709085946287),  INT64_C(2663647754808469028), -INT64_C(2138750201256393471) },
+      UINT64_C(16307993872453158145) },
+    { {  INT64_C(6772880114858243008),  INT64_C( 949909715715425411),  INT64_C(4635357091765345400), -INT64_C(4234099381413498901),
+         INT64_C(2630104939786928132), -INT64_C(2439100971789768927), -INT64_C(2989632098037247794),  INT64_C( 864708720780922881) },
+      UINT64_C(16007643101919782689) },
+    { { -INT64_C(4140349582576682028),  INT64_C(4647715090324521216), -INT64_C(5761428404720369670), -INT64_C(7333054166149995071),
+         INT64_C(2305844196772222976),  INT64_C(3170610038906028632), -INT64_C( 115609304558126409), -INT64_C( 565623116516004443) },
+      UINT64_C(18331134769151425207) },
+    { {  INT64_C(9078981116908424225), -INT64_C( 327449751421239332),  INT64_C(4622443808189005269),  INT64_C( 585467952095559744),
+         INT64_C( 580981961574055938),  INT64_C(7229463239065831428), -INT64_C(7672401815078527133),  INT64_C( 432172284684444044) },
+      UINT64_C(18119294322288312284) },
+    { { -INT64_C(1370707887273709270),  INT64_C( 720585286262325248), -INT64_C(4900456123300291065), -INT64_C(2655314606425110556),
+        -INT64_C(3285903976062409378),  INT64_C(6393654079478466273), -INT64_C(6343357657672843472), -INT64_C(5229420871455742894) },
+      UINT64_C(17076036186435842346) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_reduce_max_epu64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(1354044035036462303),  INT64_C(4994778391683570714), -INT64_C(  28503224968865666),  INT64_C(    282858782466048),
+        -INT64_C(2999642390352191747),  INT64_C(7334242056720654844),  INT64_C(8078967428603708680), -INT64_C(8240156499841861608) },
+      UINT64_C(                   0) },
+    { UINT8_C(255),
+      {  INT64_C(6435557631245005943), -INT64_C(1563144158865391534),  INT64_C(    284773580308992),  INT64_C(8056663718077647024),
+         INT64_C(4722274527310555308),  INT64_C(3852122120019958987),  INT64_C(1306046228467286048),  INT64_C(7902554990642132639) },
+      UINT64_C(16883599914844160082) },
+    { UINT8_C( 78),
+      {  INT64_C(2196799256564078657),  INT64_C(   9007340988989472),  INT64_C(8720965007259804056),  INT64_C(3937507402470807458),
+        -INT64_C(2951830877832537024), -INT64_C(7975662050218422649), -INT64_C(7764135388406316536), -INT64_C(3254878566494831540) },
+      UINT64_C(10682608685303235080) },
+    { UINT8_C(165),
+      {  INT64_C(2096346993502947895), -INT64_C(5215919941623955930), -INT64_C(2304998584015092672), -INT64_C(1125190015839340014),
+         INT64_C(8228743863501773013),  INT64_C(7809470972606931279),  INT64_C(8359470860240322513), -INT64_C(2058890339200340197) },
+      UINT64_C(16387853734509211419) },
+    { UINT8_C(196),
+      {  INT64_C( 144678146694710288),  INT64_C(4101201575021991330),  INT64_C(2190956245724302033), -INT64_C(3541773465194729725),
+        -INT64_C(8507840796848138239), -INT64_C(5721315918870233938),  INT64_C(9161313908364496077),  INT64_C(2305844128061872136) },
+      UINT64_C( 9161313908364496077) },
+    { UINT8_C(153),
+      { -INT64_C(5227341552526552947),  INT64_C(4185076465372461345), -INT64_C(8094198991790530625),  INT64_C(3757303354266333605),
+         INT64_C(1441732423569768576),  INT64_C(4157753838166917608), -INT64_C(2563840149990898535),  INT64_C(9075827943249812251) },
+      UINT64_C(13219402521182998669) },
+    { UINT8_C(  7),
+      {  INT64_C(2823515534020689074), -INT64_C(7290260755358773732), -INT64_C(6227186544121372850), -INT64_C(3453617105262865137),
+         INT64_C(9039479672819894222),  INT64_C(3246042971502792395), -INT64_C(2417890982390320984),  INT64_C(4612004877873990144) },
+      UINT64_C(12219557529588178766) },
+    { UINT8_C(127),
+      { -INT64_C(6382143374424989637), -INT64_C(7720503217834197919), -INT64_C(4625379531202314121),  INT64_C(7524811599131967520),
+         INT64_C( 148618824757018752), -INT64_C( 634411457622865828), -INT64_C(7621674921416261025),  INT64_C(6148627230954707479) },
+      UINT64_C(17812332616086685788) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_mask_reduce_max_epu64(test_vec[i].k, a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      381.29), SIMDE_FLOAT32_C(     -247.29), SIMDE_FLOAT32_C(      194.08), SIMDE_FLOAT32_C(     -448.35),
+        SIMDE_FLOAT32_C(     -580.98), SIMDE_FLOAT32_C(      813.38), SIMDE_FLOAT32_C(      570.50), SIMDE_FLOAT32_C(     -496.82),
+        SIMDE_FLOAT32_C(     -427.63), SIMDE_FLOAT32_C(     -248.55), SIMDE_FLOAT32_C(      268.64), SIMDE_FLOAT32_C(     -662.44),
+        SIMDE_FLOAT32_C(      210.09), SIMDE_FLOAT32_C(      -36.04), SIMDE_FLOAT32_C(     -661.25), SIMDE_FLOAT32_C(      248.76) },
+      SIMDE_FLOAT32_C(      813.38) },
+    { { SIMDE_FLOAT32_C(     -605.12), SIMDE_FLOAT32_C(      553.73), SIMDE_FLOAT32_C(     -251.60), SIMDE_FLOAT32_C(     -713.06),
+        SIMDE_FLOAT32_C(      723.94), SIMDE_FLOAT32_C(     -330.99), SIMDE_FLOAT32_C(      895.44), SIMDE_FLOAT32_C(      951.29),
+        SIMDE_FLOAT32_C(     -964.99), SIMDE_FLOAT32_C(      948.90), SIMDE_FLOAT32_C(     -688.67), SIMDE_FLOAT32_C(      -96.37),
+        SIMDE_FLOAT32_C(     -733.34), SIMDE_FLOAT32_C(     -843.29), SIMDE_FLOAT32_C(     -811.52), SIMDE_FLOAT32_C(      154.14) },
+      SIMDE_FLOAT32_C(      951.29) },
+    { { SIMDE_FLOAT32_C(     -117.48), SIMDE_FLOAT32_C(     -969.61), SIMDE_FLOAT32_C(     -705.89), SIMDE_FLOAT32_C(     -311.52),
+        SIMDE_FLOAT32_C(      762.95), SIMDE_FLOAT32_C(     -465.93), SIMDE_FLOAT32_C(       49.05), SIMDE_FLOAT32_C(      -37.94),
+        SIMDE_FLOAT32_C(      198.62), SIMDE_FLOAT32_C(      457.81), SIMDE_FLOAT32_C(       87.68), SIMDE_FLOAT32_C(     -605.35),
+        SIMDE_FLOAT32_C(      533.11), SIMDE_FLOAT32_C(     -985.56), SIMDE_FLOAT32_C(      222.00), SIMDE_FLOAT32_C(     -641.32) },
+      SIMDE_FLOAT32_C(      762.95) },
+    { { SIMDE_FLOAT32_C(      708.75), SIMDE_FLOAT32_C(      681.70), SIMDE_FLOAT32_C(      189.99), SIMDE_FLOAT32_C(     -252.99),
+        SIMDE_FLOAT32_C(      876.45), SIMDE_FLOAT32_C(      910.57), SIMDE_FLOAT32_C(       95.49), SIMDE_FLOAT32_C(      926.01),
+        SIMDE_FLOAT32_C(      -35.47), SIMDE_FLOAT32_C(     -671.77), SIMDE_FLOAT32_C(      -80.65), SIMDE_FLOAT32_C(     -244.07),
+        SIMDE_FLOAT32_C(      325.51), SIMDE_FLOAT32_C(      789.69), SIMDE_FLOAT32_C(     -453.47), SIMDE_FLOAT32_C(      641.14) },
+      SIMDE_FLOAT32_C(      926.01) },
+    { { SIMDE_FLOAT32_C(      652.78), SIMDE_FLOAT32_C(     -735.46), SIMDE_FLOAT32_C(     -720.56), SIMDE_FLOAT32_C(       44.21),
+        SIMDE_FLOAT32_C(      804.13), SIMDE_FLOAT32_C(      332.17), SIMDE_FLOAT32_C(     -540.95), SIMDE_FLOAT32_C(     -582.93),
+        SIMDE_FLOAT32_C(     -696.29), SIMDE_FLOAT32_C(     -392.12), SIMDE_FLOAT32_C(      477.97), SIMDE_FLOAT32_C(     -942.25),
+        SIMDE_FLOAT32_C(     -678.53), SIMDE_FLOAT32_C(     -221.56), SIMDE_FLOAT32_C(      155.45), SIMDE_FLOAT32_C(      352.26) },
+      SIMDE_FLOAT32_C(      804.13) },
+    { { SIMDE_FLOAT32_C(      296.04), SIMDE_FLOAT32_C(      -58.80), SIMDE_FLOAT32_C(      651.26), SIMDE_FLOAT32_C(      -12.21),
+        SIMDE_FLOAT32_C(      -20.85), SIMDE_FLOAT32_C(     -983.11), SIMDE_FLOAT32_C(     -478.81), SIMDE_FLOAT32_C(      315.61),
+        SIMDE_FLOAT32_C(     -717.40), SIMDE_FLOAT32_C(     -396.59), SIMDE_FLOAT32_C(     -868.36), SIMDE_FLOAT32_C(      346.76),
+        SIMDE_FLOAT32_C(      815.06), SIMDE_FLOAT32_C(      797.81), SIMDE_FLOAT32_C(      568.12), SIMDE_FLOAT32_C(     -240.65) },
+      SIMDE_FLOAT32_C(      815.06) },
+    { { SIMDE_FLOAT32_C(      877.09), SIMDE_FLOAT32_C(      200.67), SIMDE_FLOAT32_C(     -603.24), SIMDE_FLOAT32_C(      336.48),
+        SIMDE_FLOAT32_C(     -202.65), SIMDE_FLOAT32_C(      903.10), SIMDE_FLOAT32_C(      123.10), SIMDE_FLOAT32_C(       61.06),
+        SIMDE_FLOAT32_C(     -957.30), SIMDE_FLOAT32_C(      265.67), SIMDE_FLOAT32_C(      829.57), SIMDE_FLOAT32_C(      -94.95),
+        SIMDE_FLOAT32_C(      314.10), SIMDE_FLOAT32_C(      148.54), SIMDE_FLOAT32_C(     -685.32), SIMDE_FLOAT32_C(     -119.35) },
+      SIMDE_FLOAT32_C(      903.10) },
+    { { SIMDE_FLOAT32_C(      768.74), SIMDE_FLOAT32_C(     -544.58), SIMDE_FLOAT32_C(     -474.19), SIMDE_FLOAT32_C(      297.62),
+        SIMDE_FLOAT32_C(      819.62), SIMDE_FLOAT32_C(     -949.90), SIMDE_FLOAT32_C(      899.78), SIMDE_FLOAT32_C(     -372.03),
+        SIMDE_FLOAT32_C(     -579.62), SIMDE_FLOAT32_C(      565.67), SIMDE_FLOAT32_C(     -852.07), SIMDE_FLOAT32_C(      560.02),
+        SIMDE_FLOAT32_C(     -267.75), SIMDE_FLOAT32_C(     -725.93), SIMDE_FLOAT32_C(     -846.06), SIMDE_FLOAT32_C(     -327.06) },
+      SIMDE_FLOAT32_C(      899.78) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_max_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(     -731.13), SIMDE_FLOAT32_C(      184.80), SIMDE_FLOAT32_C(      674.75), SIMDE_FLOAT32_C(     -825.32),
+        SIMDE_FLOAT32_C(     -527.56), SIMDE_FLOAT32_C(      300.74), SIMDE_FLOAT32_C(       74.55), SIMDE_FLOAT32_C(      546.34),
+        SIMDE_FLOAT32_C(      987.89), SIMDE_FLOAT32_C(      868.64), SIMDE_FLOAT32_C(       44.33), SIMDE_FLOAT32_C(     -992.34),
+        SIMDE_FLOAT32_C(       32.10), SIMDE_FLOAT32_C(     -491.56), SIMDE_FLOAT32_C(     -518.35), SIMDE_FLOAT32_C(     -657.59) },
+      -SIMDE_MATH_INFINITYF },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(     -690.07), SIMDE_FLOAT32_C(     -616.83), SIMDE_FLOAT32_C(     -897.92), SIMDE_FLOAT32_C(     -978.88),
+        SIMDE_FLOAT32_C(      761.53), SIMDE_FLOAT32_C(     -740.57), SIMDE_FLOAT32_C(      875.60), SIMDE_FLOAT32_C(     -656.14),
+        SIMDE_FLOAT32_C(      191.25), SIMDE_FLOAT32_C(      105.60), SIMDE_FLOAT32_C(     -476.80), SIMDE_FLOAT32_C(      980.87),
+        SIMDE_FLOAT32_C(      857.24), SIMDE_FLOAT32_C(      304.43), SIMDE_FLOAT32_C(     -692.93), SIMDE_FLOAT32_C(     -819.55) },
+      SIMDE_FLOAT32_C(      980.87) },
+    { UINT16_C(25967),
+      { SIMDE_FLOAT32_C(      648.94), SIMDE_FLOAT32_C(      948.39), SIMDE_FLOAT32_C(     -108.06), SIMDE_FLOAT32_C(     -579.26),
+        SIMDE_FLOAT32_C(      252.52), SIMDE_FLOAT32_C(     -129.09), SIMDE_FLOAT32_C(     -828.64), SIMDE_FLOAT32_C(      600.83),
+        SIMDE_FLOAT32_C(      823.37), SIMDE_FLOAT32_C(       80.38), SIMDE_FLOAT32_C(      116.26), SIMDE_FLOAT32_C(      490.31),
+        SIMDE_FLOAT32_C(     -846.33), SIMDE_FLOAT32_C(      698.47), SIMDE_FLOAT32_C(       19.57), SIMDE_FLOAT32_C(      253.42) },
+      SIMDE_FLOAT32_C(      948.39) },
+    { UINT16_C(23630),
+      { SIMDE_FLOAT32_C(       49.59), SIMDE_FLOAT32_C(      135.83), SIMDE_FLOAT32_C(       45.58), SIMDE_FLOAT32_C(     -238.07),
+        SIMDE_FLOAT32_C(      822.14), SIMDE_FLOAT32_C(     -117.47), SIMDE_FLOAT32_C(     -650.47), SIMDE_FLOAT32_C(       30.64),
+        SIMDE_FLOAT32_C(     -302.59), SIMDE_FLOAT32_C(      504.23), SIMDE_FLOAT32_C(      903.89), SIMDE_FLOAT32_C(      486.86),
+        SIMDE_FLOAT32_C(      240.38), SIMDE_FLOAT32_C(      -30.01), SIMDE_FLOAT32_C(     -432.02), SIMDE_FLOAT32_C(     -622.41) },
+      SIMDE_FLOAT32_C(      903.89) },
+    { UINT16_C(25561),
+      { SIMDE_FLOAT32_C(      530.89), SIMDE_FLOAT32_C(     -340.65), SIMDE_FLOAT32_C(     -773.59), SIMDE_FLOAT32_C(      288.90),
+        SIMDE_FLOAT32_C(      417.01), SIMDE_FLOAT32_C(     -625.02), SIMDE_FLOAT32_C(      331.01), SIMDE_FLOAT32_C(      958.59),
+        SIMDE_FLOAT32_C(     -561.95), SIMDE_FLOAT32_C(      925.39), SIMDE_FLOAT32_C(     -984.07), SIMDE_FLOAT32_C(      647.21),
+        SIMDE_FLOAT32_C(     -361.30), SIMDE_FLOAT32_C(     -338.84), SIMDE_FLOAT32_C(      411.91), SIMDE_FLOAT32_C(      825.14) },
+      SIMDE_FLOAT32_C(      958.59) },
+    { UINT16_C( 4711),
+      { SIMDE_FLOAT32_C(     -897.92), SIMDE_FLOAT32_C(      913.16), SIMDE_FLOAT32_C(     -300.98), SIMDE_FLOAT32_C(      -23.47),
+        SIMDE_FLOAT32_C(      -44.53), SIMDE_FLOAT32_C(      884.29), SIMDE_FLOAT32_C(     -618.65), SIMDE_FLOAT32_C(      380.45),
+        SIMDE_FLOAT32_C(      402.10), SIMDE_FLOAT32_C(      391.13), SIMDE_FLOAT32_C(     -930.17), SIMDE_FLOAT32_C(     -525.92),
+        SIMDE_FLOAT32_C(      592.12), SIMDE_FLOAT32_C(     -825.02), SIMDE_FLOAT32_C(      811.07), SIMDE_FLOAT32_C(     -481.39) },
+      SIMDE_FLOAT32_C(      913.16) },
+    { UINT16_C(33338),
+      { SIMDE_FLOAT32_C(      430.93), SIMDE_FLOAT32_C(     -902.66), SIMDE_FLOAT32_C(     -144.38), SIMDE_FLOAT32_C(     -239.06),
+        SIMDE_FLOAT32_C(      271.72), SIMDE_FLOAT32_C(     -655.25), SIMDE_FLOAT32_C(      595.46), SIMDE_FLOAT32_C(     -519.50),
+        SIMDE_FLOAT32_C(      542.73), SIMDE_FLOAT32_C(     -737.71), SIMDE_FLOAT32_C(     -756.17), SIMDE_FLOAT32_C(     -572.52),
+        SIMDE_FLOAT32_C(     -300.12), SIMDE_FLOAT32_C(      370.24), SIMDE_FLOAT32_C(      618.92), SIMDE_FLOAT32_C(      217.95) },
+      SIMDE_FLOAT32_C(      271.72) },
+    { UINT16_C(17817),
+      { SIMDE_FLOAT32_C(      228.71), SIMDE_FLOAT32_C(     -913.67), SIMDE_FLOAT32_C(     -626.92), SIMDE_FLOAT32_C(       80.77),
+        SIMDE_FLOAT32_C(      145.24), SIMDE_FLOAT32_C(     -138.68), SIMDE_FLOAT32_C(     -679.99), SIMDE_FLOAT32_C(      214.65),
+        SIMDE_FLOAT32_C(      938.51), SIMDE_FLOAT32_C(      762.40), SIMDE_FLOAT32_C(       82.90), SIMDE_FLOAT32_C(      292.00),
+        SIMDE_FLOAT32_C(     -414.33), SIMDE_FLOAT32_C(     -229.10), SIMDE_FLOAT32_C(      211.19), SIMDE_FLOAT32_C(     -224.35) },
+      SIMDE_FLOAT32_C(      938.51) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_max_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      771.46), SIMDE_FLOAT64_C(     -989.23), SIMDE_FLOAT64_C(      994.37), SIMDE_FLOAT64_C(     -690.31),
+        SIMDE_FLOAT64_C(     -527.36), SIMDE_FLOAT64_C(      458.65), SIMDE_FLOAT64_C(     -399.07), SIMDE_FLOAT64_C(     -691.47) },
+      SIMDE_FLOAT64_C(      994.37) },
+    { { SIMDE_FLOAT64_C(     -758.85), SIMDE_FLOAT64_C(      404.90), SIMDE_FLOAT64_C(      782.40), SIMDE_FLOAT64_C(       33.48),
+        SIMDE_FLOAT64_C(      467.31), SIMDE_FLOAT64_C(      -44.31), SIMDE_FLOAT64_C(      736.50), SIMDE_FLOAT64_C(     -537.91) },
+      SIMDE_FLOAT64_C(      782.40) },
+    { { SIMDE_FLOAT64_C(      -62.88), SIMDE_FLOAT64_C(     -609.44), SIMDE_FLOAT64_C(     -310.17), SIMDE_FLOAT64_C(     -107.73),
+        SIMDE_FLOAT64_C(     -189.63), SIMDE_FLOAT64_C(      610.46), SIMDE_FLOAT64_C(     -777.07), SIMDE_FLOAT64_C(      448.28) },
+      SIMDE_FLOAT64_C(      610.46) },
+    { { SIMDE_FLOAT64_C(     -712.35), SIMDE_FLOAT64_C(     -691.91), SIMDE_FLOAT64_C(       86.37), SIMDE_FLOAT64_C(      416.48),
+        SIMDE_FLOAT64_C(     -750.39), SIMDE_FLOAT64_C(     -143.13), SIMDE_FLOAT64_C(      734.66), SIMDE_FLOAT64_C(     -206.61) },
+      SIMDE_FLOAT64_C(      734.66) },
+    { { SIMDE_FLOAT64_C(      273.35), SIMDE_FLOAT64_C(      -12.95), SIMDE_FLOAT64_C(      999.90), SIMDE_FLOAT64_C(      995.78),
+        SIMDE_FLOAT64_C(      747.91), SIMDE_FLOAT64_C(      482.22), SIMDE_FLOAT64_C(      176.70), SIMDE_FLOAT64_C(      954.70) },
+      SIMDE_FLOAT64_C(      999.90) },
+    { { SIMDE_FLOAT64_C(     -141.53), SIMDE_FLOAT64_C(      -67.46), SIMDE_FLOAT64_C(      917.79), SIMDE_FLOAT64_C(     -235.10),
+        SIMDE_FLOAT64_C(     -370.89), SIMDE_FLOAT64_C(      420.52), SIMDE_FLOAT64_C(      832.77), SIMDE_FLOAT64_C(      373.72) },
+      SIMDE_FLOAT64_C(      917.79) },
+    { { SIMDE_FLOAT64_C(      214.38), SIMDE_FLOAT64_C(     -352.81), SIMDE_FLOAT64_C(     -384.22), SIMDE_FLOAT64_C(      252.23),
+        SIMDE_FLOAT64_C(      876.26), SIMDE_FLOAT64_C(     -181.70), SIMDE_FLOAT64_C(      644.04), SIMDE_FLOAT64_C(      602.02) },
+      SIMDE_FLOAT64_C(      876.26) },
+    { { SIMDE_FLOAT64_C(      203.66), SIMDE_FLOAT64_C(     -790.74), SIMDE_FLOAT64_C(     -177.84), SIMDE_FLOAT64_C(      693.38),
+        SIMDE_FLOAT64_C(      935.80), SIMDE_FLOAT64_C(     -294.16), SIMDE_FLOAT64_C(      979.12), SIMDE_FLOAT64_C(      817.47) },
+      SIMDE_FLOAT64_C(      979.12) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_max_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(      725.07), SIMDE_FLOAT64_C(      575.72), SIMDE_FLOAT64_C(       93.72), SIMDE_FLOAT64_C(       77.29),
+        SIMDE_FLOAT64_C(      603.78), SIMDE_FLOAT64_C(     -235.22), SIMDE_FLOAT64_C(      793.44), SIMDE_FLOAT64_C(      912.53) },
+      -SIMDE_MATH_INFINITY },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(     -597.18), SIMDE_FLOAT64_C(     -271.77), SIMDE_FLOAT64_C(      143.37), SIMDE_FLOAT64_C(     -737.77),
+        SIMDE_FLOAT64_C(      416.49), SIMDE_FLOAT64_C(      500.99), SIMDE_FLOAT64_C(      237.79), SIMDE_FLOAT64_C(      444.24) },
+      SIMDE_FLOAT64_C(      500.99) },
+    { UINT8_C(249),
+      { SIMDE_FLOAT64_C(      677.71), SIMDE_FLOAT64_C(     -426.09), SIMDE_FLOAT64_C(      613.52), SIMDE_FLOAT64_C(       51.97),
+        SIMDE_FLOAT64_C(     -760.62), SIMDE_FLOAT64_C(      136.04), SIMDE_FLOAT64_C(     -889.18), SIMDE_FLOAT64_C(      277.60) },
+      SIMDE_FLOAT64_C(      677.71) },
+    { UINT8_C(251),
+      { SIMDE_FLOAT64_C(     -486.27), SIMDE_FLOAT64_C(      446.09), SIMDE_FLOAT64_C(     -592.33), SIMDE_FLOAT64_C(      932.62),
+        SIMDE_FLOAT64_C(      801.78), SIMDE_FLOAT64_C(     -443.89), SIMDE_FLOAT64_C(      -25.63), SIMDE_FLOAT64_C(      865.83) },
+      SIMDE_FLOAT64_C(      932.62) },
+    { UINT8_C(195),
+      { SIMDE_FLOAT64_C(      992.83), SIMDE_FLOAT64_C(      692.29), SIMDE_FLOAT64_C(      340.09), SIMDE_FLOAT64_C(      489.45),
+        SIMDE_FLOAT64_C(      119.29), SIMDE_FLOAT64_C(     -131.29), SIMDE_FLOAT64_C(      688.35), SIMDE_FLOAT64_C(      248.08) },
+      SIMDE_FLOAT64_C(      992.83) },
+    { UINT8_C( 34),
+      { SIMDE_FLOAT64_C(      988.69), SIMDE_FLOAT64_C(     -896.00), SIMDE_FLOAT64_C(      944.86), SIMDE_FLOAT64_C(     -886.01),
+        SIMDE_FLOAT64_C(      135.96), SIMDE_FLOAT64_C(      497.37), SIMDE_FLOAT64_C(      523.83), SIMDE_FLOAT64_C(     -118.21) },
+      SIMDE_FLOAT64_C(      497.37) },
+    { UINT8_C( 80),
+      { SIMDE_FLOAT64_C(      388.42), SIMDE_FLOAT64_C(      165.31), SIMDE_FLOAT64_C(      445.66), SIMDE_FLOAT64_C(     -317.63),
+        SIMDE_FLOAT64_C(      980.13), SIMDE_FLOAT64_C(     -315.55), SIMDE_FLOAT64_C(     -852.43), SIMDE_FLOAT64_C(     -555.21) },
+      SIMDE_FLOAT64_C(      980.13) },
+    { UINT8_C(113),
+      { SIMDE_FLOAT64_C(      370.32), SIMDE_FLOAT64_C(     -897.93), SIMDE_FLOAT64_C(     -563.21), SIMDE_FLOAT64_C(      697.52),
+        SIMDE_FLOAT64_C(     -617.45), SIMDE_FLOAT64_C(     -660.10), SIMDE_FLOAT64_C(      274.51), SIMDE_FLOAT64_C(     -613.27) },
+      SIMDE_FLOAT64_C(      370.32) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_max_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C( 1539936295), -INT32_C( 1564583445),  INT32_C( 1430927182), -INT32_C( 1999334874),
+        -INT32_C( 2113929216), -INT32_C( 1169013906), -INT32_C( 2117396915), -INT32_C(  394777281),
+         INT32_C(  448558425),  INT32_C( 1090551809), -INT32_C(  999269565),  INT32_C(    1179906),
+         INT32_C(   62882067),  INT32_C( 1342210048),  INT32_C(    2110468),  INT32_C(    9441952) },
+      -INT32_C( 2117396915) },
+    { { -INT32_C(  464014075), -INT32_C(  801702413),  INT32_C( 1606665162),  INT32_C(  711272589),
+        -INT32_C( 1544968308), -INT32_C(  410272526),  INT32_C(          0),  INT32_C( 1421116741),
+         INT32_C(  570425348), -INT32_C(   65100775), -INT32_C( 2103228831), -INT32_C( 1039654848),
+         INT32_C(  678534252),  INT32_C(   33125930),  INT32_C( 1739128937),  INT32_C( 2060671381) },
+      -INT32_C( 2103228831) },
+    { { -INT32_C( 1889425075),  INT32_C( 1140916224), -INT32_C( 1158162369), -INT32_C( 1452907415),
+         INT32_C( 1383741374),  INT32_C( 1102355703),  INT32_C(  137625600), -INT32_C( 1736015085),
+         INT32_C( 1476549941), -INT32_C( 1812818244),  INT32_C( 1097975833), -INT32_C( 1593872581),
+        -INT32_C(  390990661),  INT32_C( 1946158080),  INT32_C(   67110144),  INT32_C(  537004544) },
+      -INT32_C( 1889425075) },
+    { {  INT32_C( 2135818271), -INT32_C( 1254685880), -INT32_C( 1720506162),  INT32_C(  134252544),
+        -INT32_C(  274427540),  INT32_C( 1456871470),  INT32_C(  226283567), -INT32_C( 2146401276),
+         INT32_C(  757161268), -INT32_C(  257127898), -INT32_C( 1115358971),  INT32_C(       2563),
+        -INT32_C( 1060229224),  INT32_C(  139348909), -INT32_C(  210771746),  INT32_C(      82440) },
+      -INT32_C( 2146401276) },
+    { { -INT32_C( 2143289262), -INT32_C(  865464722),  INT32_C(  164392154),  INT32_C(   42074114),
+         INT32_C(      32896),  INT32_C(  417484774), -INT32_C( 1914879999),  INT32_C(  775236227),
+        -INT32_C( 1204408959), -INT32_C(  147413794), -INT32_C(  453816096), -INT32_C(  312207901),
+         INT32_C(   67371008), -INT32_C(  465492134),  INT32_C( 1372389082),  INT32_C(  999391020) },
+      -INT32_C( 2143289262) },
+    { { -INT32_C(  880395938),  INT32_C( 1221362965),  INT32_C(  711618538),  INT32_C( 1115702280),
+        -INT32_C( 1847605107),  INT32_C( 1659494037), -INT32_C( 1923336711), -INT32_C(  925316896),
+        -INT32_C( 1070679062), -INT32_C(  593369094), -INT32_C( 1435971020),  INT32_C(  138413056),
+        -INT32_C( 1777301935), -INT32_C( 1896139681),  INT32_C( 1544045649), -INT32_C( 2101185820) },
+      -INT32_C( 2101185820) },
+    { {  INT32_C(  268438800),  INT32_C( 1661788528),  INT32_C( 1373972511),  INT32_C(   16793668),
+        -INT32_C( 1554211430), -INT32_C(  272247113), -INT32_C( 2141543826), -INT32_C( 1155662643),
+         INT32_C(  634176759),  INT32_C( 1185195207),  INT32_C(  371324911), -INT32_C( 2033358780),
+         INT32_C( 1074823233), -INT32_C( 2146958272),  INT32_C(      90632),  INT32_C( 1540151802) },
+      -INT32_C( 2146958272) },
+    { { -INT32_C( 1724358860), -INT32_C( 1811938288),  INT32_C(  716544941), -INT32_C(  507511242),
+         INT32_C( 1474490339),  INT32_C(        160),  INT32_C(  134479888),  INT32_C(  304611904),
+        -INT32_C( 1610794100), -INT32_C( 1598982775),  INT32_C(    1056768),  INT32_C( 1886986576),
+         INT32_C(  818581657), -INT32_C( 1065090942), -INT32_C(  469573765),  INT32_C(  259896414) },
+      -INT32_C( 1811938288) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_min_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C( 1581325606),  INT32_C(  723032190), -INT32_C( 1509610503),  INT32_C( 1252496386),
+         INT32_C(  974845750), -INT32_C( 1347564459),  INT32_C(          4), -INT32_C(  751958552),
+         INT32_C( 1915218482),  INT32_C(  238457866), -INT32_C(  134924591), -INT32_C( 1193580322),
+        -INT32_C( 2056624674),  INT32_C(  630139038), -INT32_C(  792689820), -INT32_C( 1777781418) },
+      INT32_MAX },
+    { UINT16_C(65535),
+      { -INT32_C( 2063450112),  INT32_C( 1455307915), -INT32_C(  748323978),  INT32_C(  932081496),
+         INT32_C(  579156347),  INT32_C(  983107211), -INT32_C( 1770215197), -INT32_C(  518610686),
+        -INT32_C( 1559590261),  INT32_C( 1864069683), -INT32_C(  898073263),  INT32_C( 1018614483),
+         INT32_C(  805417986), -INT32_C( 1811796989),  INT32_C( 1264061579),  INT32_C(  929429444) },
+      -INT32_C( 2063450112) },
+    { UINT16_C(33611),
+      {  INT32_C( 1367364443),  INT32_C(       2568),  INT32_C( 1117116513),  INT32_C( 2143485823),
+         INT32_C(  480781412),  INT32_C(  532224308),  INT32_C(  683252677), -INT32_C(  473715653),
+        -INT32_C( 1283680937),  INT32_C(  148942920),  INT32_C(  642971041),  INT32_C( 1342691501),
+        -INT32_C( 1797472308),  INT32_C( 1692594872),  INT32_C(   73118068), -INT32_C( 1745420485) },
+      -INT32_C( 1745420485) },
+    { UINT16_C(28243),
+      {  INT32_C(  968923531),  INT32_C( 1154541843),  INT32_C(     295104), -INT32_C( 1530118748),
+         INT32_C( 1213776305), -INT32_C( 1301716542), -INT32_C( 2014008750),  INT32_C( 1829183725),
+         INT32_C(  202375168), -INT32_C(  148828191),  INT32_C(    1638416), -INT32_C(  672127899),
+         INT32_C(    1220736), -INT32_C(   69019368),  INT32_C( 1396699918),  INT32_C(  431311644) },
+      -INT32_C( 2014008750) },
+    { UINT16_C(58731),
+      {  INT32_C(  712816651), -INT32_C( 2024342705),  INT32_C(   33554945),  INT32_C(      33280),
+         INT32_C( 1089513659),  INT32_C( 1352839952), -INT32_C(   83185471),  INT32_C(          1),
+         INT32_C( 1796224613),  INT32_C(  224575956), -INT32_C( 2147483512),  INT32_C( 1911214733),
+         INT32_C(  103935492),  INT32_C( 1944976620), -INT32_C(  787053442),  INT32_C(   33554448) },
+      -INT32_C( 2147483512) },
+    { UINT16_C(20519),
+      {  INT32_C(  268436480), -INT32_C(  213714954),  INT32_C(    8388736), -INT32_C(  912269463),
+        -INT32_C( 1056121316),  INT32_C(  697919463),  INT32_C(  627853773), -INT32_C(  675279281),
+         INT32_C(  139067520),  INT32_C(  848360946),  INT32_C(  677423439), -INT32_C(  198906338),
+         INT32_C(  135528464), -INT32_C(  937951232), -INT32_C( 2117112884), -INT32_C(  612601541) },
+      -INT32_C( 2117112884) },
+    { UINT16_C(32011),
+      { -INT32_C(  969831978),  INT32_C(  134250656),  INT32_C(    2129920),  INT32_C(  663446313),
+         INT32_C(      34816),  INT32_C( 1771930211), -INT32_C( 1815331725),  INT32_C( 1697312058),
+         INT32_C( 1100689625), -INT32_C(  654781641),  INT32_C( 1600422187), -INT32_C(  765987276),
+         INT32_C(  797981779),  INT32_C(  896853482), -INT32_C(  721151726),  INT32_C( 2016125755) },
+      -INT32_C(  969831978) },
+    { UINT16_C(10842),
+      {  INT32_C( 1712567917), -INT32_C(  976581500), -INT32_C( 1655804492),  INT32_C(   67248640),
+         INT32_C(  301989968), -INT32_C( 1284212657),  INT32_C(  645705117), -INT32_C(  974270981),
+         INT32_C(  500112030),  INT32_C(  442260106),  INT32_C(        260), -INT32_C( 1028114635),
+         INT32_C(  431951548), -INT32_C( 1654674729),  INT32_C(    3146508),  INT32_C(  788561184) },
+      -INT32_C( 1654674729) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_min_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { { -INT32_C( 1598527769),  INT32_C(  142671872),  INT32_C( 2092731955), -INT32_C( 1324908958),
+         INT32_C(  974730472),  INT32_C( 1055012732),  INT32_C(  891582388), -INT32_C(  895090244),
+         INT32_C( 1613277057), -INT32_C(  485847812), -INT32_C( 2070471360), -INT32_C( 1793720346),
+         INT32_C(  228440828), -INT32_C(  558301840),  INT32_C(  260750396),  INT32_C(    4236288) },
+      UINT32_C(   4236288) },
+    { {  INT32_C( 1428331798), -INT32_C( 1481956402),  INT32_C( 1428007007), -INT32_C(  297679305),
+        -INT32_C( 1743303121),  INT32_C(  491635645),  INT32_C( 1504745429),  INT32_C(          1),
+        -INT32_C(  241124208),  INT32_C( 1096598100), -INT32_C(  546829640), -INT32_C(  640561576),
+         INT32_C(    4268097), -INT32_C( 1396030494), -INT32_C( 1368704047), -INT32_C(  292428520) },
+      UINT32_C(         1) },
+    { {  INT32_C( 1397727951),  INT32_C(  537211936),  INT32_C(   79588158), -INT32_C(  781118815),
+        -INT32_C( 1496371135),  INT32_C(   39977088),  INT32_C( 1453645212), -INT32_C(  837379145),
+         INT32_C(   12845056),  INT32_C(    4115200), -INT32_C( 2093747697), -INT32_C( 1645524127),
+         INT32_C(   16908310),  INT32_C(      32768),  INT32_C( 1085276160), -INT32_C(  316608343) },
+      UINT32_C(     32768) },
+    { { -INT32_C( 1879047936),  INT32_C( 1151738250),  INT32_C(  300823260), -INT32_C( 1283017468),
+         INT32_C(  961825960),  INT32_C(  768218605),  INT32_C(  832687415),  INT32_C(  256929864),
+         INT32_C(  167772168),  INT32_C(    4198916), -INT32_C( 1044611870),  INT32_C( 1676332502),
+         INT32_C( 1076723528), -INT32_C( 1667854438),  INT32_C(   83904512),  INT32_C(    8388864) },
+      UINT32_C(   4198916) },
+    { {  INT32_C(    8946688), -INT32_C( 2146959332), -INT32_C(  945596298), -INT32_C( 1589991707),
+        -INT32_C(   31089381), -INT32_C(    8286095), -INT32_C(   97262988), -INT32_C(  424892415),
+         INT32_C(  587333762),  INT32_C(  537919496),  INT32_C(  474818857),  INT32_C( 1073791488),
+         INT32_C(  699414119),  INT32_C( 1622454907),  INT32_C( 1389309059),  INT32_C(   12587016) },
+      UINT32_C(   8946688) },
+    { {  INT32_C(  906898063),  INT32_C( 1610894340), -INT32_C( 1445682523),  INT32_C(  472677434),
+        -INT32_C( 1077902763), -INT32_C( 1364956161),  INT32_C( 1092871876),  INT32_C(  537010304),
+        -INT32_C( 1449170923),  INT32_C(  563416598), -INT32_C( 1848640368),  INT32_C(  413673850),
+        -INT32_C(  593833849),  INT32_C( 1396948534),  INT32_C(   67143720),  INT32_C(     526352) },
+      UINT32_C(    526352) },
+    { {  INT32_C(  879579569), -INT32_C(  923506453), -INT32_C(  964811654), -INT32_C( 2147090432),
+         INT32_C( 1139344589),  INT32_C(  836333831), -INT32_C( 1689857803),  INT32_C(   42047000),
+         INT32_C( 1073872896), -INT32_C( 1490074315), -INT32_C( 2146434560),  INT32_C(      65538),
+         INT32_C(  338107293), -INT32_C( 1223976343), -INT32_C( 2130173692),  INT32_C(  537265163) },
+      UINT32_C(     65538) },
+    { {  INT32_C( 1847735639),  INT32_C( 1334934995),  INT32_C( 1858224939), -INT32_C( 1452113514),
+        -INT32_C( 1953250229), -INT32_C( 1845618747),  INT32_C( 1809859326),  INT32_C( 1187302116),
+         INT32_C(  863510647), -INT32_C( 1306411379),  INT32_C(      40192), -INT32_C( 1918594793),
+         INT32_C(   35659776), -INT32_C(  330442817), -INT32_C(  998945114), -INT32_C(  976820570) },
+      UINT32_C(     40192) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_reduce_min_epu32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C( 1635948385), -INT32_C( 1490108454), -INT32_C( 1639340821), -INT32_C( 2059386507),
+         INT32_C( 1753564369),  INT32_C(   17825792), -INT32_C(  112311227),  INT32_C(  892518159),
+         INT32_C(  676151570),  INT32_C(  883061105), -INT32_C(  988224087), -INT32_C(  376430131),
+         INT32_C( 1112376797),  INT32_C(         96),  INT32_C( 1409540304), -INT32_C(  268645835) },
+      UINT32_MAX },
+    { UINT16_C(65535),
+      {  INT32_C(   37765250), -INT32_C( 1782355914),  INT32_C(  698186154),  INT32_C(   88864549),
+        -INT32_C( 1009072374),  INT32_C(   67141648), -INT32_C(  542863429), -INT32_C( 1243678881),
+        -INT32_C( 2146959075),  INT32_C(      32897),  INT32_C( 1848984666),  INT32_C(  927464902),
+        -INT32_C( 2001195524),  INT32_C(   33572864),  INT32_C(  445031930),  INT32_C(  402718720) },
+      UINT32_C(     32897) },
+    { UINT16_C(49929),
+      { -INT32_C(   87982110),  INT32_C(   22449480),  INT32_C(  126357552),  INT32_C(  626435011),
+        -INT32_C(  184768456),  INT32_C( 1230229447),  INT32_C( 1828228709),  INT32_C(  768748197),
+         INT32_C(       4672), -INT32_C(  854966334),  INT32_C(   17039365), -INT32_C(  165128877),
+         INT32_C( 1649833568),  INT32_C(  242455118),  INT32_C(   67109920),  INT32_C(  318768160) },
+      UINT32_C(      4672) },
+    { UINT16_C(15893),
+      {  INT32_C( 1280880407),  INT32_C(  753345923), -INT32_C( 1374088010),  INT32_C(   71311361),
+         INT32_C( 1026415995), -INT32_C(  729183729), -INT32_C( 1811926006), -INT32_C( 1928006639),
+        -INT32_C(  234004637), -INT32_C( 2147483628),  INT32_C( 1275152520), -INT32_C( 1524661000),
+        -INT32_C( 1251374867), -INT32_C(  325948755), -INT32_C( 2015081300), -INT32_C( 1178679143) },
+      UINT32_C(1026415995) },
+    { UINT16_C(19712),
+      {  INT32_C(  932155868),  INT32_C(  754761692),  INT32_C(  402665476),  INT32_C(       8216),
+        -INT32_C( 1559108761),  INT32_C( 1864924048),  INT32_C( 1255988538), -INT32_C( 1680506460),
+        -INT32_C(  115696628), -INT32_C( 2063581184),  INT32_C( 1456255614),  INT32_C( 1394415101),
+        -INT32_C( 1435946516),  INT32_C( 1625423501),  INT32_C( 1301702010), -INT32_C( 1265204836) },
+      UINT32_C(1301702010) },
+    { UINT16_C(58565),
+      { -INT32_C( 2030232018),  INT32_C( 1354487845), -INT32_C(  981321492), -INT32_C(  851253783),
+        -INT32_C( 2096880238),  INT32_C( 1953843347), -INT32_C( 1142973145), -INT32_C(  629532598),
+        -INT32_C( 2141308216), -INT32_C(  904686228), -INT32_C(  757994098), -INT32_C( 1023466539),
+         INT32_C(     147490), -INT32_C( 1593659382),  INT32_C( 1829955188), -INT32_C(  875293866) },
+      UINT32_C(1829955188) },
+    { UINT16_C( 5114),
+      {  INT32_C(  141653941),  INT32_C( 1149230561),  INT32_C(  787212421),  INT32_C( 2073723752),
+        -INT32_C( 1817155659),  INT32_C(  134234112),  INT32_C( 1715263947),  INT32_C(  277217536),
+         INT32_C(  262013445),  INT32_C(  697563873), -INT32_C( 1707123847), -INT32_C(  384851929),
+        -INT32_C(  204990808),  INT32_C( 2079607695),  INT32_C(  134283273),  INT32_C( 1648688106) },
+      UINT32_C( 134234112) },
+    { UINT16_C(42298),
+      {  INT32_C( 1998837167), -INT32_C( 1720698995), -INT32_C( 2146361216), -INT32_C( 2139078638),
+        -INT32_C( 1347157357),  INT32_C(  167776256), -INT32_C( 1037464357), -INT32_C( 1819667998),
+         INT32_C(  402817024),  INT32_C( 2010927231), -INT32_C( 2142240752),  INT32_C(    8388608),
+         INT32_C(  944235929),  INT32_C( 1350670617),  INT32_C(  950861574),  INT32_C( 1046681380) },
+      UINT32_C( 167776256) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_mask_reduce_min_epu32(test_vec[i].k, a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(7201072451890275904), -INT64_C(4592272751283963267), -INT64_C(7390458307230935096),  INT64_C(8441198858605949696),
+        -INT64_C(6581455476457883650), -INT64_C(3012070909234985373),  INT64_C(       550158467073),  INT64_C( 261637163452422020) },
+      -INT64_C(7390458307230935096) },
+    { {  INT64_C( 581012730511656994), -INT64_C(2324759950057412441),  INT64_C(1152922106212913152),  INT64_C(6845036424115667972),
+         INT64_C(1913026200953692551),  INT64_C(3193972870186783518), -INT64_C(1833051863138154799),  INT64_C(1729399851814223872) },
+      -INT64_C(2324759950057412441) },
+    { {  INT64_C( 951741207716067935), -INT64_C(4717091646631312598),  INT64_C(    290340344168960),  INT64_C( 576608224300630016),
+         INT64_C(  23643903479644224),  INT64_C(5712325821107431767),  INT64_C( 648676882308534400), -INT64_C(7558078555589280533) },
+      -INT64_C(7558078555589280533) },
+    { {  INT64_C(5374621710229526778), -INT64_C(5389378713444996167),  INT64_C(8084699443260689062), -INT64_C( 610147018284460547),
+        -INT64_C( 588356733504555598),  INT64_C(  57425843051298816),  INT64_C(1115574065297221296),  INT64_C(2664732517652831985) },
+      -INT64_C(5389378713444996167) },
+    { { -INT64_C(8060396903453144952), -INT64_C(1050643889992974003), -INT64_C(8180484523516055474),  INT64_C(2015389961212534710),
+         INT64_C(6927042384844002305),  INT64_C(5556763091586343498), -INT64_C( 933042998682837978), -INT64_C(5188957602568241620) },
+      -INT64_C(8180484523516055474) },
+    { {  INT64_C(8174224477064479164), -INT64_C(8176797734245195020),  INT64_C(2940842793324416740),  INT64_C(   4503600181027328),
+        -INT64_C( 826572331001493714), -INT64_C(8654466331879099512),  INT64_C(   2261145880625281),  INT64_C(6420827752056597689) },
+      -INT64_C(8654466331879099512) },
+    { {  INT64_C(4843552214289754416),  INT64_C(6458701211323546539),  INT64_C(3250185708422356904), -INT64_C(  67178054464814495),
+         INT64_C(   9710903876387873),  INT64_C(3458765150574674977),  INT64_C(   5866994582685992),  INT64_C(3322693940939236489) },
+      -INT64_C(  67178054464814495) },
+    { { -INT64_C( 806900707544309416), -INT64_C(1128168438013521853),  INT64_C(5224194997658986444),  INT64_C(4471977846465995416),
+         INT64_C(4258040543791542646), -INT64_C(9151242871448010678),  INT64_C(5807183783560087295),  INT64_C(6056428901739869551) },
+      -INT64_C(9151242871448010678) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_min_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(5700504395447976766),  INT64_C(8693012484201422458), -INT64_C(3357085626301621605),  INT64_C(4614580620360810512),
+         INT64_C(6008009582800297533),  INT64_C(2156602037023152170), -INT64_C(3927924409231513291),  INT64_C(   4576442307055684) },
+      INT64_MAX },
+    { UINT8_C(255),
+      {  INT64_C(1478846737909264219), -INT64_C(7323799947521938610),  INT64_C( 576496040845247488), -INT64_C(4304625033329634726),
+         INT64_C(8919051338837613490),  INT64_C(2060685090113956142),  INT64_C(2001133137523395829), -INT64_C(6806898527090363783) },
+      -INT64_C(7323799947521938610) },
+    { UINT8_C(131),
+      { -INT64_C(7972313600345941039),  INT64_C( 608645734815314962), -INT64_C( 789867984764551691), -INT64_C(6584979530447984682),
+        -INT64_C( 289454803948715361),  INT64_C(2386917148365750304), -INT64_C(1413225876441593860), -INT64_C(2242262925342823714) },
+      -INT64_C(7972313600345941039) },
+    { UINT8_C(171),
+      { -INT64_C(3038016249940479803),  INT64_C(5931908170180149956), -INT64_C(1674439040691249675), -INT64_C(8152111862215413417),
+        -INT64_C(3822202943181657925),  INT64_C(6623100643808207148), -INT64_C(7890283457205500928),  INT64_C( 359210365156729376) },
+      -INT64_C(8152111862215413417) },
+    { UINT8_C( 48),
+      { -INT64_C(8326441355179877334), -INT64_C(4243642306783238150), -INT64_C(3710435058954444712),  INT64_C(   2305710914437508),
+         INT64_C( 277627786444539148),  INT64_C(1734063978495246472),  INT64_C(  18023195139728404),  INT64_C(2377971530341556352) },
+      INT64_C( 277627786444539148) },
+    { UINT8_C(251),
+      { -INT64_C(3914661836466173133),  INT64_C(3984675089575366909), -INT64_C(5512244002525681691), -INT64_C(8740380965569564004),
+        -INT64_C(7729294459729936004), -INT64_C(7046761129632620490),  INT64_C(8750680614747617039),  INT64_C(6415582327340594146) },
+      -INT64_C(8740380965569564004) },
+    { UINT8_C(141),
+      {  INT64_C(1088505450713111277),  INT64_C(7241858571435253824),  INT64_C(      4535485480960), -INT64_C(9221111440411196400),
+         INT64_C(       350593486856), -INT64_C( 132756118680120835),  INT64_C(6570413289748127434), -INT64_C(4372189105003562727) },
+      -INT64_C(9221111440411196400) },
+    { UINT8_C(  6),
+      {  INT64_C(  47287796355830016), -INT64_C(4475182468912768709),  INT64_C(7689669376178589791), -INT64_C(5687804949923611295),
+         INT64_C(2102481837189688448),  INT64_C(4883502911153158293),  INT64_C( 108086395352122144),  INT64_C(7368276900631918334) },
+      -INT64_C(4475182468912768709) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_min_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { { -INT64_C(6796747080251163384), -INT64_C(6665463092271691520), -INT64_C(1553185976638025521), -INT64_C(2984748196304091259),
+         INT64_C(4597177934408124859),  INT64_C( 554782007286386598), -INT64_C(4377369877380113745), -INT64_C(1365280369911940918) },
+      UINT64_C(  554782007286386598) },
+    { { -INT64_C(1317041952828415640),  INT64_C(7622051600388088186), -INT64_C(4565202006593224826),  INT64_C(2170320202589301642),
+        -INT64_C(8129093486982655499),  INT64_C( 594547718580338688), -INT64_C(8748011581763740024),  INT64_C(3812103085449521723) },
+      UINT64_C(  594547718580338688) },
+    { {  INT64_C( 273906909100822023),  INT64_C(2211409064835480005), -INT64_C(5451960183278405903),  INT64_C( 217382794660220928),
+        -INT64_C(6315309123120411043),  INT64_C(2219076260111870140),  INT64_C(          144703520), -INT64_C( 387900577549927881) },
+      UINT64_C(           144703520) },
+    { { -INT64_C(6389510339437056618),  INT64_C(7823138035838308695), -INT64_C(8070133460582264704),  INT64_C(8846253691956137136),
+        -INT64_C(4720999647950448704), -INT64_C(5925854078368301890), -INT64_C(2568468520473399052), -INT64_C(5966602785364423357) },
+      UINT64_C( 7823138035838308695) },
+    { { -INT64_C(4851815894619575528),  INT64_C(9138950758192918806),  INT64_C(1459188575293536903), -INT64_C(6788415672827012895),
+        -INT64_C(6395880218203805480), -INT64_C(4578709021557422156),  INT64_C( 648518346492348464),  INT64_C( 648518767382380544) },
+      UINT64_C(  648518346492348464) },
+    { {  INT64_C(7551435615737795952), -INT64_C(4074535290034033703),  INT64_C(7111184693616383791),  INT64_C(7536364070632687650),
+        -INT64_C(5452898554669693126), -INT64_C(2783396358447835785),  INT64_C(4695715581030508589), -INT64_C(2665276474121262175) },
+      UINT64_C( 4695715581030508589) },
+    { { -INT64_C(9002703792235767039),  INT64_C(9152109033608277580),  INT64_C( 145557747602096136),  INT64_C(1194838547412039049),
+         INT64_C(  18018797227147265),  INT64_C(1893441621868551638),  INT64_C(1214110069546663371),  INT64_C(      8882068914200) },
+      UINT64_C(       8882068914200) },
+    { {  INT64_C(   9007199290394112),  INT64_C(8152653278644116597), -INT64_C(  96955294237800280),  INT64_C(   5814234701111312),
+         INT64_C(7023482050340973047), -INT64_C(7456439911299997033),  INT64_C(4238155193512770598), -INT64_C(2685773289993568295) },
+      UINT64_C(    5814234701111312) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_reduce_min_epu64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C(7918913396186153162),  INT64_C(7916992630578224600),  INT64_C(1856806122849231621), -INT64_C(9175265476936248424),
+        -INT64_C(3563255197835221097),  INT64_C(7334913463246379024),  INT64_C(8541978784246823037),  INT64_C(7656770872152123983) },
+      UINT64_MAX },
+    { UINT8_C(255),
+      { -INT64_C(4141701157154824583), -INT64_C(4563980172718757039), -INT64_C(3117491028119837981),  INT64_C(4224335731212643164),
+        -INT64_C( 406249393712257991),  INT64_C(   2251800351875604),  INT64_C(2053729395440386080),  INT64_C(3548872103258753536) },
+      UINT64_C(    2251800351875604) },
+    { UINT8_C(130),
+      {  INT64_C( 576461856112120880),  INT64_C(6414714188505127410),  INT64_C(     35460122975490),  INT64_C(8928047378879181437),
+         INT64_C(6634422716557027793),  INT64_C( 576461027735240704),  INT64_C(    615863951696160),  INT64_C( 576460786699130888) },
+      UINT64_C(  576460786699130888) },
+    { UINT8_C( 41),
+      {  INT64_C( 843792307443220289), -INT64_C(7082998608671608881), -INT64_C(  38959444541246098), -INT64_C(8039222460759234378),
+         INT64_C(2889323738642349570),  INT64_C(8463271905180066017),  INT64_C(4191439741493986994), -INT64_C(8103371200444227912) },
+      UINT64_C(  843792307443220289) },
+    { UINT8_C( 16),
+      {  INT64_C(3111906644387550750),  INT64_C( 706961008259303477),  INT64_C(3063009560540832166), -INT64_C(1978912145975638461),
+        -INT64_C(2177845985289795682), -INT64_C(3134507236264200091), -INT64_C(2135147739520904705),  INT64_C(4586320599001695531) },
+      UINT64_C(16268898088419755934) },
+    { UINT8_C( 88),
+      { -INT64_C(3695934279799862722), -INT64_C(6809135310116882531),  INT64_C(4926375943602737209), -INT64_C(8961059996461902849),
+        -INT64_C(3005657786269549126), -INT64_C(5042248723117242220),  INT64_C(1297177741557760000), -INT64_C(6566540646184953667) },
+      UINT64_C( 1297177741557760000) },
+    { UINT8_C(129),
+      {  INT64_C(  72110954854646018), -INT64_C(2031350471765912742), -INT64_C(9182834688077573120), -INT64_C(3975820033017697486),
+         INT64_C(8601082180592237596),  INT64_C(1109948451212113449),  INT64_C( 171136828798927237), -INT64_C(5970883756066791180) },
+      UINT64_C(   72110954854646018) },
+    { UINT8_C(146),
+      { -INT64_C(6620222381575814946),  INT64_C( 299646318906051418),  INT64_C(1898981866398801746),  INT64_C(7692851421888568897),
+         INT64_C( 576460752573972488),  INT64_C(7871727484201529683),  INT64_C(3496384665011208983),  INT64_C(     79165039575048) },
+      UINT64_C(      79165039575048) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_mask_reduce_min_epu64(test_vec[i].k, a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -459.32), SIMDE_FLOAT32_C(     -724.21), SIMDE_FLOAT32_C(     -472.31), SIMDE_FLOAT32_C(      417.00),
+        SIMDE_FLOAT32_C(     -646.46), SIMDE_FLOAT32_C(     -436.81), SIMDE_FLOAT32_C(       48.16), SIMDE_FLOAT32_C(      977.09),
+        SIMDE_FLOAT32_C(      819.60), SIMDE_FLOAT32_C(      167.93), SIMDE_FLOAT32_C(      773.01), SIMDE_FLOAT32_C(     -163.01),
+        SIMDE_FLOAT32_C(      109.92), SIMDE_FLOAT32_C(      435.84), SIMDE_FLOAT32_C(      -67.93), SIMDE_FLOAT32_C(     -885.60) },
+      SIMDE_FLOAT32_C(     -885.60) },
+    { { SIMDE_FLOAT32_C(     -970.81), SIMDE_FLOAT32_C(      278.12), SIMDE_FLOAT32_C(     -958.81), SIMDE_FLOAT32_C(      325.33),
+        SIMDE_FLOAT32_C(     -580.13), SIMDE_FLOAT32_C(     -940.27), SIMDE_FLOAT32_C(       23.17), SIMDE_FLOAT32_C(     -436.63),
+        SIMDE_FLOAT32_C(      982.36), SIMDE_FLOAT32_C(      238.07), SIMDE_FLOAT32_C(     -998.58), SIMDE_FLOAT32_C(      236.51),
+        SIMDE_FLOAT32_C(      638.26), SIMDE_FLOAT32_C(     -768.27), SIMDE_FLOAT32_C(      507.82), SIMDE_FLOAT32_C(      907.69) },
+      SIMDE_FLOAT32_C(     -998.58) },
+    { { SIMDE_FLOAT32_C(      256.77), SIMDE_FLOAT32_C(      442.76), SIMDE_FLOAT32_C(     -358.50), SIMDE_FLOAT32_C(     -501.28),
+        SIMDE_FLOAT32_C(     -324.01), SIMDE_FLOAT32_C(      -61.80), SIMDE_FLOAT32_C(     -732.30), SIMDE_FLOAT32_C(      928.99),
+        SIMDE_FLOAT32_C(     -584.23), SIMDE_FLOAT32_C(     -462.69), SIMDE_FLOAT32_C(      -46.91), SIMDE_FLOAT32_C(      766.04),
+        SIMDE_FLOAT32_C(      773.60), SIMDE_FLOAT32_C(      948.86), SIMDE_FLOAT32_C(      741.43), SIMDE_FLOAT32_C(      -18.97) },
+      SIMDE_FLOAT32_C(     -732.30) },
+    { { SIMDE_FLOAT32_C(     -795.30), SIMDE_FLOAT32_C(     -612.64), SIMDE_FLOAT32_C(      197.43), SIMDE_FLOAT32_C(       69.21),
+        SIMDE_FLOAT32_C(     -712.44), SIMDE_FLOAT32_C(     -246.06), SIMDE_FLOAT32_C(     -893.37), SIMDE_FLOAT32_C(     -208.79),
+        SIMDE_FLOAT32_C(      471.29), SIMDE_FLOAT32_C(      498.58), SIMDE_FLOAT32_C(      782.09), SIMDE_FLOAT32_C(      449.68),
+        SIMDE_FLOAT32_C(     -184.25), SIMDE_FLOAT32_C(     -761.48), SIMDE_FLOAT32_C(     -782.48), SIMDE_FLOAT32_C(     -502.24) },
+      SIMDE_FLOAT32_C(     -893.37) },
+    { { SIMDE_FLOAT32_C(     -473.07), SIMDE_FLOAT32_C(       20.06), SIMDE_FLOAT32_C(      650.89), SIMDE_FLOAT32_C(      663.57),
+        SIMDE_FLOAT32_C(     -909.00), SIMDE_FLOAT32_C(     -818.98), SIMDE_FLOAT32_C(      972.21), SIMDE_FLOAT32_C(      731.73),
+        SIMDE_FLOAT32_C(      453.88), SIMDE_FLOAT32_C(     -169.83), SIMDE_FLOAT32_C(      283.48), SIMDE_FLOAT32_C(      372.25),
+        SIMDE_FLOAT32_C(      -55.61), SIMDE_FLOAT32_C(      897.40), SIMDE_FLOAT32_C(     -542.72), SIMDE_FLOAT32_C(      452.90) },
+      SIMDE_FLOAT32_C(     -909.00) },
+    { { SIMDE_FLOAT32_C(      480.85), SIMDE_FLOAT32_C(      980.66), SIMDE_FLOAT32_C(      -32.48), SIMDE_FLOAT32_C(      672.42),
+        SIMDE_FLOAT32_C(     -824.75), SIMDE_FLOAT32_C(     -933.03), SIMDE_FLOAT32_C(     -347.29), SIMDE_FLOAT32_C(     -264.89),
+        SIMDE_FLOAT32_C(     -628.26), SIMDE_FLOAT32_C(     -245.48), SIMDE_FLOAT32_C(      301.32), SIMDE_FLOAT32_C(     -774.43),
+        SIMDE_FLOAT32_C(     -442.27), SIMDE_FLOAT32_C(     -996.05), SIMDE_FLOAT32_C(       86.98), SIMDE_FLOAT32_C(      234.55) },
+      SIMDE_FLOAT32_C(     -996.05) },
+    { { SIMDE_FLOAT32_C(     -569.10), SIMDE_FLOAT32_C(      429.67), SIMDE_FLOAT32_C(     -980.98), SIMDE_FLOAT32_C(     -406.86),
+        SIMDE_FLOAT32_C(      434.06), SIMDE_FLOAT32_C(      852.07), SIMDE_FLOAT32_C(      894.32), SIMDE_FLOAT32_C(      251.18),
+        SIMDE_FLOAT32_C(     -524.54), SIMDE_FLOAT32_C(     -825.26), SIMDE_FLOAT32_C(      567.57), SIMDE_FLOAT32_C(      211.77),
+        SIMDE_FLOAT32_C(     -164.43), SIMDE_FLOAT32_C(     -216.69), SIMDE_FLOAT32_C(      387.60), SIMDE_FLOAT32_C(      546.77) },
+      SIMDE_FLOAT32_C(     -980.98) },
+    { { SIMDE_FLOAT32_C(      567.82), SIMDE_FLOAT32_C(     -359.14), SIMDE_FLOAT32_C(     -153.23), SIMDE_FLOAT32_C(      231.81),
+        SIMDE_FLOAT32_C(     -610.16), SIMDE_FLOAT32_C(     -404.49), SIMDE_FLOAT32_C(     -379.78), SIMDE_FLOAT32_C(     -647.86),
+        SIMDE_FLOAT32_C(     -488.51), SIMDE_FLOAT32_C(     -828.00), SIMDE_FLOAT32_C(     -395.21), SIMDE_FLOAT32_C(     -962.94),
+        SIMDE_FLOAT32_C(     -218.96), SIMDE_FLOAT32_C(      615.82), SIMDE_FLOAT32_C(      227.85), SIMDE_FLOAT32_C(     -650.65) },
+      SIMDE_FLOAT32_C(     -962.94) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_min_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(     -666.39), SIMDE_FLOAT32_C(      472.31), SIMDE_FLOAT32_C(     -985.23), SIMDE_FLOAT32_C(      700.75),
+        SIMDE_FLOAT32_C(      110.46), SIMDE_FLOAT32_C(      555.67), SIMDE_FLOAT32_C(     -748.12), SIMDE_FLOAT32_C(     -488.55),
+        SIMDE_FLOAT32_C(     -842.24), SIMDE_FLOAT32_C(      880.46), SIMDE_FLOAT32_C(      898.92), SIMDE_FLOAT32_C(     -498.95),
+        SIMDE_FLOAT32_C(       28.50), SIMDE_FLOAT32_C(       17.01), SIMDE_FLOAT32_C(      958.56), SIMDE_FLOAT32_C(      698.61) },
+      SIMDE_MATH_INFINITYF },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(      170.09), SIMDE_FLOAT32_C(      886.13), SIMDE_FLOAT32_C(       24.57), SIMDE_FLOAT32_C(     -964.46),
+        SIMDE_FLOAT32_C(      848.60), SIMDE_FLOAT32_C(      -72.06), SIMDE_FLOAT32_C(     -788.30), SIMDE_FLOAT32_C(      827.76),
+        SIMDE_FLOAT32_C(      760.01), SIMDE_FLOAT32_C(     -719.50), SIMDE_FLOAT32_C(     -113.24), SIMDE_FLOAT32_C(     -541.65),
+        SIMDE_FLOAT32_C(      337.54), SIMDE_FLOAT32_C(      807.48), SIMDE_FLOAT32_C(      863.30), SIMDE_FLOAT32_C(      939.34) },
+      SIMDE_FLOAT32_C(     -964.46) },
+    { UINT16_C(41647),
+      { SIMDE_FLOAT32_C(      842.65), SIMDE_FLOAT32_C(     -364.69), SIMDE_FLOAT32_C(     -625.49), SIMDE_FLOAT32_C(     -668.13),
+        SIMDE_FLOAT32_C(     -478.72), SIMDE_FLOAT32_C(     -353.96), SIMDE_FLOAT32_C(     -695.79), SIMDE_FLOAT32_C(       56.21),
+        SIMDE_FLOAT32_C(     -789.76), SIMDE_FLOAT32_C(     -629.66), SIMDE_FLOAT32_C(     -294.21), SIMDE_FLOAT32_C(      121.38),
+        SIMDE_FLOAT32_C(     -329.15), SIMDE_FLOAT32_C(      -67.73), SIMDE_FLOAT32_C(      -14.53), SIMDE_FLOAT32_C(       91.11) },
+      SIMDE_FLOAT32_C(     -668.13) },
+    { UINT16_C(34760),
+      { SIMDE_FLOAT32_C(     -465.67), SIMDE_FLOAT32_C(     -908.47), SIMDE_FLOAT32_C(     -884.32), SIMDE_FLOAT32_C(     -383.38),
+        SIMDE_FLOAT32_C(      335.99), SIMDE_FLOAT32_C(     -457.23), SIMDE_FLOAT32_C(     -707.24), SIMDE_FLOAT32_C(       86.97),
+        SIMDE_FLOAT32_C(     -883.28), SIMDE_FLOAT32_C(     -235.20), SIMDE_FLOAT32_C(      188.97), SIMDE_FLOAT32_C(       91.50),
+        SIMDE_FLOAT32_C(      176.31), SIMDE_FLOAT32_C(      572.39), SIMDE_FLOAT32_C(      610.80), SIMDE_FLOAT32_C(     -443.71) },
+      SIMDE_FLOAT32_C(     -883.28) },
+    { UINT16_C(28332),
+      { SIMDE_FLOAT32_C(     -133.64), SIMDE_FLOAT32_C(      290.43), SIMDE_FLOAT32_C(     -503.81), SIMDE_FLOAT32_C(     -916.58),
+        SIMDE_FLOAT32_C(      690.01), SIMDE_FLOAT32_C(      -86.91), SIMDE_FLOAT32_C(     -259.16), SIMDE_FLOAT32_C(      895.27),
+        SIMDE_FLOAT32_C(     -265.07), SIMDE_FLOAT32_C(      900.23), SIMDE_FLOAT32_C(      413.11), SIMDE_FLOAT32_C(      820.15),
+        SIMDE_FLOAT32_C(     -184.43), SIMDE_FLOAT32_C(      822.06), SIMDE_FLOAT32_C(      934.99), SIMDE_FLOAT32_C(      972.37) },
+      SIMDE_FLOAT32_C(     -916.58) },
+    { UINT16_C( 3967),
+      { SIMDE_FLOAT32_C(     -932.52), SIMDE_FLOAT32_C(     -841.30), SIMDE_FLOAT32_C(     -545.32), SIMDE_FLOAT32_C(      421.68),
+        SIMDE_FLOAT32_C(      388.39), SIMDE_FLOAT32_C(      639.37), SIMDE_FLOAT32_C(      342.03), SIMDE_FLOAT32_C(      -62.56),
+        SIMDE_FLOAT32_C(     -449.54), SIMDE_FLOAT32_C(     -510.69), SIMDE_FLOAT32_C(      186.78), SIMDE_FLOAT32_C(     -851.79),
+        SIMDE_FLOAT32_C(      -46.22), SIMDE_FLOAT32_C(      277.11), SIMDE_FLOAT32_C(     -268.29), SIMDE_FLOAT32_C(      805.91) },
+      SIMDE_FLOAT32_C(     -932.52) },
+    { UINT16_C(65223),
+      { SIMDE_FLOAT32_C(     -233.52), SIMDE_FLOAT32_C(      397.59), SIMDE_FLOAT32_C(      273.56), SIMDE_FLOAT32_C(     -715.75),
+        SIMDE_FLOAT32_C(      825.54), SIMDE_FLOAT32_C(     -462.98), SIMDE_FLOAT32_C(     -658.50), SIMDE_FLOAT32_C(     -807.49),
+        SIMDE_FLOAT32_C(     -279.74), SIMDE_FLOAT32_C(      294.87), SIMDE_FLOAT32_C(      303.10), SIMDE_FLOAT32_C(     -104.01),
+        SIMDE_FLOAT32_C(      191.60), SIMDE_FLOAT32_C(      146.66), SIMDE_FLOAT32_C(      542.43), SIMDE_FLOAT32_C(     -545.24) },
+      SIMDE_FLOAT32_C(     -807.49) },
+    { UINT16_C(39073),
+      { SIMDE_FLOAT32_C(     -631.53), SIMDE_FLOAT32_C(      995.02), SIMDE_FLOAT32_C(     -710.81), SIMDE_FLOAT32_C(      119.65),
+        SIMDE_FLOAT32_C(     -976.95), SIMDE_FLOAT32_C(      975.02), SIMDE_FLOAT32_C(      185.10), SIMDE_FLOAT32_C(     -859.10),
+        SIMDE_FLOAT32_C(      136.45), SIMDE_FLOAT32_C(     -406.37), SIMDE_FLOAT32_C(      983.37), SIMDE_FLOAT32_C(     -273.64),
+        SIMDE_FLOAT32_C(      261.33), SIMDE_FLOAT32_C(     -611.18), SIMDE_FLOAT32_C(      185.08), SIMDE_FLOAT32_C(      183.63) },
+      SIMDE_FLOAT32_C(     -859.10) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_min_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -905.09), SIMDE_FLOAT64_C(      -74.81), SIMDE_FLOAT64_C(       18.46), SIMDE_FLOAT64_C(      329.47),
+        SIMDE_FLOAT64_C(       20.48), SIMDE_FLOAT64_C(     -498.01), SIMDE_FLOAT64_C(     -875.84), SIMDE_FLOAT64_C(     -575.50) },
+      SIMDE_FLOAT64_C(     -905.09) },
+    { { SIMDE_FLOAT64_C(      836.63), SIMDE_FLOAT64_C(     -738.64), SIMDE_FLOAT64_C(      232.42), SIMDE_FLOAT64_C(      481.37),
+        SIMDE_FLOAT64_C(      283.54), SIMDE_FLOAT64_C(      430.18), SIMDE_FLOAT64_C(      734.22), SIMDE_FLOAT64_C(     -214.23) },
+      SIMDE_FLOAT64_C(     -738.64) },
+    { { SIMDE_FLOAT64_C(      446.58), SIMDE_FLOAT64_C(     -669.41), SIMDE_FLOAT64_C(     -178.76), SIMDE_FLOAT64_C(      854.09),
+        SIMDE_FLOAT64_C(      268.78), SIMDE_FLOAT64_C(     -664.30), SIMDE_FLOAT64_C(     -939.55), SIMDE_FLOAT64_C(     -521.29) },
+      SIMDE_FLOAT64_C(     -939.55) },
+    { { SIMDE_FLOAT64_C(      300.32), SIMDE_FLOAT64_C(     -402.03), SIMDE_FLOAT64_C(     -498.27), SIMDE_FLOAT64_C(      -78.74),
+        SIMDE_FLOAT64_C(      577.13), SIMDE_FLOAT64_C(     -991.29), SIMDE_FLOAT64_C(      131.44), SIMDE_FLOAT64_C(      921.00) },
+      SIMDE_FLOAT64_C(     -991.29) },
+    { { SIMDE_FLOAT64_C(      853.93), SIMDE_FLOAT64_C(     -910.94), SIMDE_FLOAT64_C(      600.69), SIMDE_FLOAT64_C(      756.48),
+        SIMDE_FLOAT64_C(     -733.77), SIMDE_FLOAT64_C(     -355.51), SIMDE_FLOAT64_C(      835.23), SIMDE_FLOAT64_C(     -669.06) },
+      SIMDE_FLOAT64_C(     -910.94) },
+    { { SIMDE_FLOAT64_C(      998.70), SIMDE_FLOAT64_C(      865.38), SIMDE_FLOAT64_C(     -137.31), SIMDE_FLOAT64_C(      406.47),
+        SIMDE_FLOAT64_C(      542.02), SIMDE_FLOAT64_C(     -951.40), SIMDE_FLOAT64_C(       92.35), SIMDE_FLOAT64_C(     -281.38) },
+      SIMDE_FLOAT64_C(     -951.40) },
+    { { SIMDE_FLOAT64_C(     -430.79), SIMDE_FLOAT64_C(      262.78), SIMDE_FLOAT64_C(      311.34), SIMDE_FLOAT64_C(      367.46),
+        SIMDE_FLOAT64_C(      577.15), SIMDE_FLOAT64_C(      355.50), SIMDE_FLOAT64_C(      372.15), SIMDE_FLOAT64_C(      674.22) },
+      SIMDE_FLOAT64_C(     -430.79) },
+    { { SIMDE_FLOAT64_C(     -895.17), SIMDE_FLOAT64_C(      780.97), SIMDE_FLOAT64_C(      341.85), SIMDE_FLOAT64_C(     -611.41),
+        SIMDE_FLOAT64_C(     -448.95), SIMDE_FLOAT64_C(     -928.73), SIMDE_FLOAT64_C(      449.19), SIMDE_FLOAT64_C(     -743.45) },
+      SIMDE_FLOAT64_C(     -928.73) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_min_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(     -177.76), SIMDE_FLOAT64_C(     -338.63), SIMDE_FLOAT64_C(      -15.54), SIMDE_FLOAT64_C(      551.85),
+        SIMDE_FLOAT64_C(      235.99), SIMDE_FLOAT64_C(      885.31), SIMDE_FLOAT64_C(     -681.59), SIMDE_FLOAT64_C(      247.79) },
+      SIMDE_MATH_INFINITY },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(     -512.01), SIMDE_FLOAT64_C(     -834.34), SIMDE_FLOAT64_C(      859.90), SIMDE_FLOAT64_C(     -291.99),
+        SIMDE_FLOAT64_C(     -671.63), SIMDE_FLOAT64_C(     -752.16), SIMDE_FLOAT64_C(     -952.75), SIMDE_FLOAT64_C(     -287.87) },
+      SIMDE_FLOAT64_C(     -952.75) },
+    { UINT8_C(134),
+      { SIMDE_FLOAT64_C(      917.38), SIMDE_FLOAT64_C(      610.48), SIMDE_FLOAT64_C(       35.79), SIMDE_FLOAT64_C(     -293.13),
+        SIMDE_FLOAT64_C(      729.10), SIMDE_FLOAT64_C(      341.77), SIMDE_FLOAT64_C(      171.05), SIMDE_FLOAT64_C(      106.90) },
+      SIMDE_FLOAT64_C(       35.79) },
+    { UINT8_C( 90),
+      { SIMDE_FLOAT64_C(      277.54), SIMDE_FLOAT64_C(      -16.48), SIMDE_FLOAT64_C(      789.12), SIMDE_FLOAT64_C(     -631.90),
+        SIMDE_FLOAT64_C(      682.18), SIMDE_FLOAT64_C(      135.04), SIMDE_FLOAT64_C(      979.15), SIMDE_FLOAT64_C(     -908.62) },
+      SIMDE_FLOAT64_C(     -631.90) },
+    { UINT8_C(215),
+      { SIMDE_FLOAT64_C(     -118.15), SIMDE_FLOAT64_C(     -545.21), SIMDE_FLOAT64_C(      978.75), SIMDE_FLOAT64_C(     -839.49),
+        SIMDE_FLOAT64_C(      263.74), SIMDE_FLOAT64_C(      127.15), SIMDE_FLOAT64_C(      378.93), SIMDE_FLOAT64_C(      740.36) },
+      SIMDE_FLOAT64_C(     -545.21) },
+    { UINT8_C(183),
+      { SIMDE_FLOAT64_C(      234.07), SIMDE_FLOAT64_C(      147.86), SIMDE_FLOAT64_C(      -92.43), SIMDE_FLOAT64_C(      536.28),
+        SIMDE_FLOAT64_C(      321.48), SIMDE_FLOAT64_C(      730.74), SIMDE_FLOAT64_C(     -643.36), SIMDE_FLOAT64_C(     -700.95) },
+      SIMDE_FLOAT64_C(     -700.95) },
+    { UINT8_C(196),
+      { SIMDE_FLOAT64_C(      596.80), SIMDE_FLOAT64_C(     -109.64), SIMDE_FLOAT64_C(      658.62), SIMDE_FLOAT64_C(     -723.54),
+        SIMDE_FLOAT64_C(     -188.02), SIMDE_FLOAT64_C(      294.98), SIMDE_FLOAT64_C(     -751.53), SIMDE_FLOAT64_C(     -664.48) },
+      SIMDE_FLOAT64_C(     -751.53) },
+    { UINT8_C(134),
+      { SIMDE_FLOAT64_C(      -61.04), SIMDE_FLOAT64_C(     -471.69), SIMDE_FLOAT64_C(     -873.33), SIMDE_FLOAT64_C(     -973.39),
+        SIMDE_FLOAT64_C(     -284.54), SIMDE_FLOAT64_C(      624.84), SIMDE_FLOAT64_C(      618.44), SIMDE_FLOAT64_C(     -708.46) },
+      SIMDE_FLOAT64_C(     -873.33) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_min_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C(  945800420), -INT32_C(          6), -INT32_C(          4),  INT32_C(          1),
+        -INT32_C(          8),  INT32_C(  967197877),  INT32_C(   46128253),  INT32_C( 1490387886),
+         INT32_C(          2), -INT32_C( 1324256572),  INT32_C(          2), -INT32_C(          4),
+         INT32_C(  249095784),  INT32_C(          3),  INT32_C(  916456199),  INT32_C(          7) },
+      INT32_C( 1470889984) },
+    { {  INT32_C(          3),  INT32_C(          2),  INT32_C(  402017025), -INT32_C(          8),
+        -INT32_C(          6), -INT32_C( 1682541852),  INT32_C(  591598046), -INT32_C( 1995486334),
+         INT32_C(  764578423),  INT32_C(          1), -INT32_C(          3),  INT32_C(  173354749),
+         INT32_C( 1756459442),  INT32_C(          4), -INT32_C(          9),  INT32_C( 1440093812) },
+      -INT32_C(  127352832) },
+    { {  INT32_C( 1559792779),  INT32_C(          5), -INT32_C(  468823569),  INT32_C(  600270455),
+        -INT32_C(          6),  INT32_C(          8),  INT32_C(          2), -INT32_C(          6),
+        -INT32_C(          1), -INT32_C( 2017917917), -INT32_C(          1), -INT32_C(          6),
+         INT32_C(  406061059), -INT32_C(          1), -INT32_C(          1),  INT32_C(          8) },
+      INT32_C(  788909056) },
+    { {  INT32_C( 1253093916),  INT32_C( 1762169736),  INT32_C(          4),  INT32_C(          3),
+         INT32_C(   42515136),  INT32_C(          2),  INT32_C(          2),  INT32_C(          0),
+        -INT32_C(  127058022),  INT32_C(          3), -INT32_C( 2105143237), -INT32_C( 1109601907),
+        -INT32_C( 1011961785),  INT32_C(          3), -INT32_C( 1368412064),  INT32_C(  462201656) },
+      INT32_C(          0) },
+    { {  INT32_C(          1),  INT32_C(          3), -INT32_C(          4), -INT32_C(          3),
+        -INT32_C(          7), -INT32_C(          5),  INT32_C( 2104559857), -INT32_C(          4),
+         INT32_C( 2100385116),  INT32_C(          9),  INT32_C(          8), -INT32_C( 1165700544),
+        -INT32_C( 1994249148),  INT32_C(          7),  INT32_C(          5),  INT32_C(          5) },
+      -INT32_C( 1831206912) },
+    { { -INT32_C(  711354398),  INT32_C( 1543675962), -INT32_C( 1919751444), -INT32_C( 1284996986),
+         INT32_C(          1),  INT32_C(          8),  INT32_C(          0), -INT32_C(          9),
+        -INT32_C(          8), -INT32_C(          2), -INT32_C( 1817870262), -INT32_C(          4),
+        -INT32_C( 1719657474),  INT32_C(  769548820),  INT32_C(          7),  INT32_C(  917107729) },
+      INT32_C(          0) },
+    { {  INT32_C(          5), -INT32_C(          5),  INT32_C(          4), -INT32_C( 1856196946),
+         INT32_C(          9),  INT32_C(          7),  INT32_C(          8),  INT32_C(          6),
+        -INT32_C( 1249735916), -INT32_C(          9),  INT32_C(          7), -INT32_C(          6),
+        -INT32_C(          6),  INT32_C(          2), -INT32_C( 1309461199),  INT32_C(          5) },
+      -INT32_C( 1685532672) },
+    { { -INT32_C(  342681969),  INT32_C( 1115613920), -INT32_C(  994882644),  INT32_C( 1235804789),
+        -INT32_C(          2),  INT32_C(          5), -INT32_C(          4), -INT32_C(  299525263),
+         INT32_C(  381218907),  INT32_C(          2),  INT32_C(          3),  INT32_C(  605386545),
+         INT32_C(          4), -INT32_C(          6), -INT32_C(          6),  INT32_C(          2) },
+      -INT32_C( 1204617216) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_mul_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C(          8),  INT32_C(          5), -INT32_C(          2), -INT32_C(          9),
+        -INT32_C(  928183911), -INT32_C(          3), -INT32_C( 1646317923),  INT32_C(          5),
+         INT32_C(  662476851), -INT32_C( 2002068179),  INT32_C(          9),  INT32_C(          7),
+        -INT32_C( 1836011882),  INT32_C(          6), -INT32_C(  430802557),  INT32_C( 1173359690) },
+      INT32_C(          1) },
+    { UINT16_C(65535),
+      { -INT32_C(          2), -INT32_C(          3),  INT32_C(  577042125), -INT32_C(  708820646),
+         INT32_C(          9), -INT32_C(  540784676), -INT32_C(  614608281), -INT32_C(          7),
+         INT32_C( 2033104883),  INT32_C(  450696553), -INT32_C(          3),  INT32_C(  929389209),
+        -INT32_C(          4), -INT32_C(  733028885),  INT32_C( 1529710422),  INT32_C(          3) },
+      INT32_C( 1660215424) },
+    { UINT16_C(25087),
+      {  INT32_C(          0),  INT32_C(          4),  INT32_C(  997909391),  INT32_C(          9),
+        -INT32_C( 2067402732),  INT32_C( 1101877990), -INT32_C( 1018531109), -INT32_C(          5),
+        -INT32_C( 1899685843),  INT32_C(          4),  INT32_C(  128195183), -INT32_C( 1739829433),
+        -INT32_C(          3),  INT32_C( 1292351685), -INT32_C(  232062027),  INT32_C(  238259722) },
+      INT32_C(          0) },
+    { UINT16_C(44218),
+      {  INT32_C(  252721834), -INT32_C(          3),  INT32_C( 1484487681),  INT32_C(          6),
+        -INT32_C(          3),  INT32_C(          4), -INT32_C(          4),  INT32_C(  206660621),
+         INT32_C( 1562616233),  INT32_C( 1995691618),  INT32_C(  346726074), -INT32_C(          8),
+         INT32_C(          6), -INT32_C(          7), -INT32_C(          4), -INT32_C( 1336437759) },
+      INT32_C(  560843392) },
+    { UINT16_C( 8968),
+      { -INT32_C(          9),  INT32_C(          0),  INT32_C(          2), -INT32_C(          9),
+        -INT32_C( 1548500706),  INT32_C( 1289851367), -INT32_C(          1),  INT32_C( 1309590298),
+         INT32_C(          9), -INT32_C(  892027510),  INT32_C( 1673301474), -INT32_C(          8),
+         INT32_C(  984290528),  INT32_C(  381700714), -INT32_C(          2),  INT32_C( 1955710941) },
+      INT32_C(   58844572) },
+    { UINT16_C(16894),
+      { -INT32_C(  421504988),  INT32_C(   33670112),  INT32_C( 1974617622), -INT32_C(          6),
+        -INT32_C(  106465599),  INT32_C(          3), -INT32_C(          4), -INT32_C(  515909412),
+         INT32_C(          1), -INT32_C(          4),  INT32_C( 1021639125), -INT32_C(  523435979),
+        -INT32_C(  624511098),  INT32_C(          0),  INT32_C( 1715752007),  INT32_C(          6) },
+      -INT32_C( 2005407744) },
+    { UINT16_C(37871),
+      { -INT32_C(          9),  INT32_C(  282469102),  INT32_C( 1850540961),  INT32_C(          7),
+         INT32_C(          4),  INT32_C(          2),  INT32_C(          7),  INT32_C(          7),
+         INT32_C( 2006226268), -INT32_C(  176140079), -INT32_C(          1),  INT32_C(          8),
+        -INT32_C(          2),  INT32_C(          9), -INT32_C( 1908719219), -INT32_C(  241773986) },
+      INT32_C( 1792010304) },
+    { UINT16_C(53850),
+      { -INT32_C(          9),  INT32_C(          8),  INT32_C( 2052077588),  INT32_C(          1),
+         INT32_C( 1557601110),  INT32_C(          2),  INT32_C(          0),  INT32_C(          5),
+         INT32_C(          0),  INT32_C(          1),  INT32_C( 1809155393), -INT32_C(          6),
+         INT32_C(  564452725),  INT32_C(          6), -INT32_C(          3), -INT32_C( 1205250206) },
+      INT32_C(          0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_mul_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(                  6),  INT64_C(2564931762943758474), -INT64_C(3244207566367637399),  INT64_C(                  2),
+        -INT64_C(                  9),  INT64_C(4671615850691575619), -INT64_C(                  8), -INT64_C(3685408926622641550) },
+      INT64_C(6968533190168003968) },
+    { { -INT64_C(                  6),  INT64_C(                  1),  INT64_C(4685220583230244736), -INT64_C(                  5),
+        -INT64_C(                  5),  INT64_C(                  6), -INT64_C(                  4), -INT64_C(3371740572297882409) },
+      INT64_C(3237956533754775552) },
+    { { -INT64_C(                  1), -INT64_C(7824077599610126624), -INT64_C(8218799759463148363),  INT64_C(6906361589296165316),
+         INT64_C( 925382137978827422), -INT64_C(4002322348741719036), -INT64_C(6791583662053180090), -INT64_C(7826981574097773005) },
+      INT64_C(6224523152256620544) },
+    { { -INT64_C(9123972858116993274), -INT64_C(5408759109759807896),  INT64_C(                  9), -INT64_C(5596584702355164823),
+         INT64_C(7686345495584101328), -INT64_C(                  8), -INT64_C(                  4),  INT64_C(                  2) },
+      INT64_C(1881079269835587584) },
+    { { -INT64_C(                  1),  INT64_C(8742034248090348897),  INT64_C(                  3), -INT64_C(                  8),
+         INT64_C( 947018265374557846),  INT64_C(2989991640124846999),  INT64_C(6955345495873420041),  INT64_C(                  1) },
+      -INT64_C(8668395450518380304) },
+    { { -INT64_C(2216825165759409816), -INT64_C(5780339603914868856),  INT64_C( 942458909742237864),  INT64_C(                  3),
+        -INT64_C(4174156332373628924),  INT64_C(4163217733662875064),  INT64_C(6418079751638219960),  INT64_C(                  4) },
+      INT64_C(6411207724324356096) },
+    { {  INT64_C( 498518017114715608),  INT64_C(                  2), -INT64_C(3836207610342980774),  INT64_C(2062298500191466593),
+         INT64_C(1121754094648722518), -INT64_C(                  4),  INT64_C(8390865755651560597), -INT64_C(                  4) },
+      -INT64_C(7790715220010736640) },
+    { {  INT64_C(                  7), -INT64_C(7271118237212757769), -INT64_C(                  1),  INT64_C(6035212513653394025),
+         INT64_C(                  8), -INT64_C(                  9),  INT64_C(                  4), -INT64_C(                  7) },
+      INT64_C(1940994493810122016) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_mul_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C(                  9),  INT64_C(1018625398325542768), -INT64_C(4782110254857451144), -INT64_C(2262188569115968787),
+         INT64_C(8762249570470472245),  INT64_C(8226652829084441645), -INT64_C(1074460497804511432),  INT64_C(1086376035375727817) },
+      INT64_C(                  1) },
+    { UINT8_C(255),
+      {  INT64_C(                  4),  INT64_C(2758787791895671487), -INT64_C(2543484273159202880), -INT64_C(8604915974984950566),
+        -INT64_C(                  4), -INT64_C(1810953492020507334), -INT64_C(6548089095819526519),  INT64_C(                  8) },
+      -INT64_C(5504995310583185408) },
+    { UINT8_C(112),
+      {  INT64_C(                  1), -INT64_C(1786045462557630218), -INT64_C(8009033735025546722), -INT64_C(2222142724391936457),
+         INT64_C(4658384688928643544),  INT64_C(                  7), -INT64_C(4381380217314620377), -INT64_C(                  3) },
+      -INT64_C(5855364603478921384) },
+    { UINT8_C( 98),
+      {  INT64_C(                  3), -INT64_C(                  3), -INT64_C(                  3), -INT64_C( 854182149217771483),
+        -INT64_C(                  6), -INT64_C(                  9),  INT64_C(                  7),  INT64_C(7446303443266916599) },
+      INT64_C(                189) },
+    { UINT8_C(136),
+      { -INT64_C(                  2), -INT64_C(                  2),  INT64_C(2930415102251342447), -INT64_C(4644975358051856315),
+         INT64_C(2116923150436315801), -INT64_C(                  7),  INT64_C(7359893208804365611), -INT64_C(                  4) },
+      INT64_C( 133157358497873644) },
+    { UINT8_C(227),
+      {  INT64_C(                  5),  INT64_C(3754086778431243121), -INT64_C(8055403023528050928),  INT64_C(1035906776038244820),
+        -INT64_C( 582594978219749680),  INT64_C(3909070384650148425), -INT64_C(                  1),  INT64_C(                  6) },
+      -INT64_C( 297392143384198318) },
+    { UINT8_C(124),
+      {  INT64_C(                  8), -INT64_C(                  2), -INT64_C(4549878726110956016),  INT64_C(2702146999104957835),
+        -INT64_C(                  2),  INT64_C(4107985497589402070), -INT64_C(                  3), -INT64_C(                  2) },
+      -INT64_C(8613648035276309824) },
+    { UINT8_C( 20),
+      {  INT64_C(                  1),  INT64_C(7600178969351336310),  INT64_C(                  8), -INT64_C(                  7),
+         INT64_C( 748402048555642769), -INT64_C(                  1), -INT64_C(                  6), -INT64_C(                  5) },
+      INT64_C(5987216388445142152) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_mul_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(       -0.01), SIMDE_FLOAT32_C(        1.54), SIMDE_FLOAT32_C(       -0.33), SIMDE_FLOAT32_C(       -0.75),
+        SIMDE_FLOAT32_C(        1.16), SIMDE_FLOAT32_C(        0.45), SIMDE_FLOAT32_C(        0.01), SIMDE_FLOAT32_C(        0.17),
+        SIMDE_FLOAT32_C(        0.08), SIMDE_FLOAT32_C(        1.25), SIMDE_FLOAT32_C(        1.44), SIMDE_FLOAT32_C(       -1.96),
+        SIMDE_FLOAT32_C(       -1.77), SIMDE_FLOAT32_C(        1.05), SIMDE_FLOAT32_C(       -0.84), SIMDE_FLOAT32_C(       -0.10) },
+      SIMDE_FLOAT32_C(       -0.00) },
+    { { SIMDE_FLOAT32_C(        0.11), SIMDE_FLOAT32_C(        0.46), SIMDE_FLOAT32_C(        0.71), SIMDE_FLOAT32_C(       -0.39),
+        SIMDE_FLOAT32_C(       -1.95), SIMDE_FLOAT32_C(        0.58), SIMDE_FLOAT32_C(       -1.92), SIMDE_FLOAT32_C(        0.51),
+        SIMDE_FLOAT32_C(        1.71), SIMDE_FLOAT32_C(       -1.70), SIMDE_FLOAT32_C(        0.81), SIMDE_FLOAT32_C(        0.72),
+        SIMDE_FLOAT32_C(        0.84), SIMDE_FLOAT32_C(       -1.98), SIMDE_FLOAT32_C(        1.03), SIMDE_FLOAT32_C(       -1.41) },
+      SIMDE_FLOAT32_C(        0.06) },
+    { { SIMDE_FLOAT32_C(       -1.31), SIMDE_FLOAT32_C(        0.70), SIMDE_FLOAT32_C(       -1.75), SIMDE_FLOAT32_C(        1.86),
+        SIMDE_FLOAT32_C(       -0.14), SIMDE_FLOAT32_C(        0.44), SIMDE_FLOAT32_C(       -1.12), SIMDE_FLOAT32_C(       -0.83),
+        SIMDE_FLOAT32_C(       -1.54), SIMDE_FLOAT32_C(        1.55), SIMDE_FLOAT32_C(       -0.14), SIMDE_FLOAT32_C(        0.57),
+        SIMDE_FLOAT32_C(        1.81), SIMDE_FLOAT32_C(        1.09), SIMDE_FLOAT32_C(        1.01), SIMDE_FLOAT32_C(        0.89) },
+      SIMDE_FLOAT32_C(       -0.06) },
+    { { SIMDE_FLOAT32_C(        0.04), SIMDE_FLOAT32_C(        1.67), SIMDE_FLOAT32_C(       -0.36), SIMDE_FLOAT32_C(        0.61),
+        SIMDE_FLOAT32_C(        1.77), SIMDE_FLOAT32_C(        0.24), SIMDE_FLOAT32_C(       -1.82), SIMDE_FLOAT32_C(        1.82),
+        SIMDE_FLOAT32_C(        1.51), SIMDE_FLOAT32_C(       -0.61), SIMDE_FLOAT32_C(        0.44), SIMDE_FLOAT32_C(        1.88),
+        SIMDE_FLOAT32_C(        0.28), SIMDE_FLOAT32_C(       -1.73), SIMDE_FLOAT32_C(        0.84), SIMDE_FLOAT32_C(       -1.75) },
+      SIMDE_FLOAT32_C(       -0.01) },
+    { { SIMDE_FLOAT32_C(        0.57), SIMDE_FLOAT32_C(        0.46), SIMDE_FLOAT32_C(       -1.17), SIMDE_FLOAT32_C(        1.18),
+        SIMDE_FLOAT32_C(        0.72), SIMDE_FLOAT32_C(       -1.90), SIMDE_FLOAT32_C(        1.98), SIMDE_FLOAT32_C(        1.04),
+        SIMDE_FLOAT32_C(       -0.90), SIMDE_FLOAT32_C(       -1.86), SIMDE_FLOAT32_C(       -0.68), SIMDE_FLOAT32_C(       -0.48),
+        SIMDE_FLOAT32_C(        1.41), SIMDE_FLOAT32_C(       -0.12), SIMDE_FLOAT32_C(       -1.62), SIMDE_FLOAT32_C(        0.99) },
+      SIMDE_FLOAT32_C(        0.15) },
+    { { SIMDE_FLOAT32_C(        0.26), SIMDE_FLOAT32_C(        0.93), SIMDE_FLOAT32_C(       -1.56), SIMDE_FLOAT32_C(       -1.95),
+        SIMDE_FLOAT32_C(        0.79), SIMDE_FLOAT32_C(        0.34), SIMDE_FLOAT32_C(       -1.93), SIMDE_FLOAT32_C(       -0.15),
+        SIMDE_FLOAT32_C(       -0.54), SIMDE_FLOAT32_C(        1.13), SIMDE_FLOAT32_C(       -1.72), SIMDE_FLOAT32_C(        0.32),
+        SIMDE_FLOAT32_C(        0.28), SIMDE_FLOAT32_C(        0.52), SIMDE_FLOAT32_C(       -0.62), SIMDE_FLOAT32_C(        1.96) },
+      SIMDE_FLOAT32_C(       -0.00) },
+    { { SIMDE_FLOAT32_C(       -0.70), SIMDE_FLOAT32_C(        1.17), SIMDE_FLOAT32_C(        1.87), SIMDE_FLOAT32_C(        0.69),
+        SIMDE_FLOAT32_C(       -1.49), SIMDE_FLOAT32_C(       -0.27), SIMDE_FLOAT32_C(        0.18), SIMDE_FLOAT32_C(       -0.89),
+        SIMDE_FLOAT32_C(       -1.34), SIMDE_FLOAT32_C(       -1.41), SIMDE_FLOAT32_C(        0.54), SIMDE_FLOAT32_C(        0.80),
+        SIMDE_FLOAT32_C(       -0.47), SIMDE_FLOAT32_C(        1.47), SIMDE_FLOAT32_C(        1.62), SIMDE_FLOAT32_C(       -1.14) },
+      SIMDE_FLOAT32_C(        0.07) },
+    { { SIMDE_FLOAT32_C(       -0.58), SIMDE_FLOAT32_C(        1.42), SIMDE_FLOAT32_C(        0.13), SIMDE_FLOAT32_C(        0.30),
+        SIMDE_FLOAT32_C(       -0.32), SIMDE_FLOAT32_C(        1.61), SIMDE_FLOAT32_C(        0.81), SIMDE_FLOAT32_C(       -1.45),
+        SIMDE_FLOAT32_C(       -0.65), SIMDE_FLOAT32_C(        0.45), SIMDE_FLOAT32_C(        1.74), SIMDE_FLOAT32_C(        0.65),
+        SIMDE_FLOAT32_C(       -0.25), SIMDE_FLOAT32_C(        1.93), SIMDE_FLOAT32_C(        0.55), SIMDE_FLOAT32_C(        1.16) },
+      SIMDE_FLOAT32_C(       -0.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_mul_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(       -1.34), SIMDE_FLOAT32_C(        1.66), SIMDE_FLOAT32_C(       -0.97), SIMDE_FLOAT32_C(       -1.68),
+        SIMDE_FLOAT32_C(       -0.94), SIMDE_FLOAT32_C(        1.51), SIMDE_FLOAT32_C(       -1.83), SIMDE_FLOAT32_C(       -1.85),
+        SIMDE_FLOAT32_C(       -0.39), SIMDE_FLOAT32_C(       -1.68), SIMDE_FLOAT32_C(       -0.23), SIMDE_FLOAT32_C(        0.12),
+        SIMDE_FLOAT32_C(       -0.87), SIMDE_FLOAT32_C(        1.06), SIMDE_FLOAT32_C(        1.91), SIMDE_FLOAT32_C(       -1.67) },
+      SIMDE_FLOAT32_C(        1.00) },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(        1.55), SIMDE_FLOAT32_C(        0.03), SIMDE_FLOAT32_C(        1.53), SIMDE_FLOAT32_C(        0.99),
+        SIMDE_FLOAT32_C(        0.84), SIMDE_FLOAT32_C(        0.39), SIMDE_FLOAT32_C(       -1.92), SIMDE_FLOAT32_C(       -0.16),
+        SIMDE_FLOAT32_C(       -1.31), SIMDE_FLOAT32_C(       -0.35), SIMDE_FLOAT32_C(        0.24), SIMDE_FLOAT32_C(       -0.48),
+        SIMDE_FLOAT32_C(        0.64), SIMDE_FLOAT32_C(       -1.62), SIMDE_FLOAT32_C(        1.79), SIMDE_FLOAT32_C(        0.65) },
+      SIMDE_FLOAT32_C(        0.00) },
+    { UINT16_C(28788),
+      { SIMDE_FLOAT32_C(       -0.51), SIMDE_FLOAT32_C(       -0.09), SIMDE_FLOAT32_C(       -1.59), SIMDE_FLOAT32_C(        0.55),
+        SIMDE_FLOAT32_C(       -1.13), SIMDE_FLOAT32_C(       -1.66), SIMDE_FLOAT32_C(        1.95), SIMDE_FLOAT32_C(       -0.49),
+        SIMDE_FLOAT32_C(        1.96), SIMDE_FLOAT32_C(       -1.10), SIMDE_FLOAT32_C(       -1.77), SIMDE_FLOAT32_C(       -0.69),
+        SIMDE_FLOAT32_C(       -1.09), SIMDE_FLOAT32_C(       -0.15), SIMDE_FLOAT32_C(        0.73), SIMDE_FLOAT32_C(       -0.66) },
+      SIMDE_FLOAT32_C(       -0.69) },
+    { UINT16_C(31520),
+      { SIMDE_FLOAT32_C(        0.36), SIMDE_FLOAT32_C(       -0.63), SIMDE_FLOAT32_C(        1.03), SIMDE_FLOAT32_C(       -1.33),
+        SIMDE_FLOAT32_C(        1.61), SIMDE_FLOAT32_C(        0.11), SIMDE_FLOAT32_C(        0.28), SIMDE_FLOAT32_C(       -1.71),
+        SIMDE_FLOAT32_C(       -1.58), SIMDE_FLOAT32_C(        0.50), SIMDE_FLOAT32_C(        0.17), SIMDE_FLOAT32_C(       -1.25),
+        SIMDE_FLOAT32_C(       -1.53), SIMDE_FLOAT32_C(       -1.52), SIMDE_FLOAT32_C(       -0.84), SIMDE_FLOAT32_C(       -0.51) },
+      SIMDE_FLOAT32_C(       -0.21) },
+    { UINT16_C(61024),
+      { SIMDE_FLOAT32_C(       -1.67), SIMDE_FLOAT32_C(       -1.27), SIMDE_FLOAT32_C(        0.86), SIMDE_FLOAT32_C(        0.93),
+        SIMDE_FLOAT32_C(        0.87), SIMDE_FLOAT32_C(       -0.78), SIMDE_FLOAT32_C(        0.79), SIMDE_FLOAT32_C(       -1.76),
+        SIMDE_FLOAT32_C(        0.45), SIMDE_FLOAT32_C(       -0.28), SIMDE_FLOAT32_C(       -1.85), SIMDE_FLOAT32_C(        0.76),
+        SIMDE_FLOAT32_C(       -0.76), SIMDE_FLOAT32_C(       -1.36), SIMDE_FLOAT32_C(       -0.90), SIMDE_FLOAT32_C(       -1.27) },
+      SIMDE_FLOAT32_C(        0.38) },
+    { UINT16_C(18250),
+      { SIMDE_FLOAT32_C(        1.32), SIMDE_FLOAT32_C(       -1.29), SIMDE_FLOAT32_C(        1.68), SIMDE_FLOAT32_C(        1.33),
+        SIMDE_FLOAT32_C(       -0.10), SIMDE_FLOAT32_C(       -1.25), SIMDE_FLOAT32_C(       -1.37), SIMDE_FLOAT32_C(       -1.38),
+        SIMDE_FLOAT32_C(        1.04), SIMDE_FLOAT32_C(       -1.83), SIMDE_FLOAT32_C(       -0.93), SIMDE_FLOAT32_C(       -1.45),
+        SIMDE_FLOAT32_C(       -0.99), SIMDE_FLOAT32_C(        0.46), SIMDE_FLOAT32_C(       -1.43), SIMDE_FLOAT32_C(       -1.53) },
+      SIMDE_FLOAT32_C(       -5.95) },
+    { UINT16_C(65330),
+      { SIMDE_FLOAT32_C(        0.03), SIMDE_FLOAT32_C(        0.10), SIMDE_FLOAT32_C(       -1.26), SIMDE_FLOAT32_C(        1.84),
+        SIMDE_FLOAT32_C(        1.49), SIMDE_FLOAT32_C(       -1.00), SIMDE_FLOAT32_C(        1.94), SIMDE_FLOAT32_C(       -1.19),
+        SIMDE_FLOAT32_C(        1.71), SIMDE_FLOAT32_C(       -1.35), SIMDE_FLOAT32_C(       -0.60), SIMDE_FLOAT32_C(        0.43),
+        SIMDE_FLOAT32_C(        0.19), SIMDE_FLOAT32_C(       -1.90), SIMDE_FLOAT32_C(        1.87), SIMDE_FLOAT32_C(       -1.99) },
+      SIMDE_FLOAT32_C(       -0.12) },
+    { UINT16_C(58495),
+      { SIMDE_FLOAT32_C(        1.32), SIMDE_FLOAT32_C(       -1.05), SIMDE_FLOAT32_C(        0.91), SIMDE_FLOAT32_C(        1.53),
+        SIMDE_FLOAT32_C(        1.75), SIMDE_FLOAT32_C(       -0.56), SIMDE_FLOAT32_C(        1.59), SIMDE_FLOAT32_C(        0.17),
+        SIMDE_FLOAT32_C(        1.26), SIMDE_FLOAT32_C(        0.11), SIMDE_FLOAT32_C(        0.07), SIMDE_FLOAT32_C(       -1.53),
+        SIMDE_FLOAT32_C(       -1.95), SIMDE_FLOAT32_C(       -1.64), SIMDE_FLOAT32_C(       -0.88), SIMDE_FLOAT32_C(       -1.70) },
+      SIMDE_FLOAT32_C(       -0.52) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_mul_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(       -1.29), SIMDE_FLOAT64_C(       -1.15), SIMDE_FLOAT64_C(        0.03), SIMDE_FLOAT64_C(        0.97),
+        SIMDE_FLOAT64_C(        1.51), SIMDE_FLOAT64_C(       -0.90), SIMDE_FLOAT64_C(       -0.98), SIMDE_FLOAT64_C(        0.85) },
+      SIMDE_FLOAT64_C(        0.05) },
+    { { SIMDE_FLOAT64_C(        0.21), SIMDE_FLOAT64_C(        1.54), SIMDE_FLOAT64_C(       -1.51), SIMDE_FLOAT64_C(        0.28),
+        SIMDE_FLOAT64_C(       -0.35), SIMDE_FLOAT64_C(        0.28), SIMDE_FLOAT64_C(        0.75), SIMDE_FLOAT64_C(        0.43) },
+      SIMDE_FLOAT64_C(        0.00) },
+    { { SIMDE_FLOAT64_C(       -1.26), SIMDE_FLOAT64_C(        1.99), SIMDE_FLOAT64_C(        1.50), SIMDE_FLOAT64_C(        1.32),
+        SIMDE_FLOAT64_C(       -1.08), SIMDE_FLOAT64_C(       -1.83), SIMDE_FLOAT64_C(       -1.24), SIMDE_FLOAT64_C(       -0.96) },
+      SIMDE_FLOAT64_C(      -11.68) },
+    { { SIMDE_FLOAT64_C(       -1.19), SIMDE_FLOAT64_C(        0.98), SIMDE_FLOAT64_C(       -1.31), SIMDE_FLOAT64_C(        0.50),
+        SIMDE_FLOAT64_C(        1.93), SIMDE_FLOAT64_C(       -0.53), SIMDE_FLOAT64_C(        0.68), SIMDE_FLOAT64_C(       -0.69) },
+      SIMDE_FLOAT64_C(        0.37) },
+    { { SIMDE_FLOAT64_C(       -0.96), SIMDE_FLOAT64_C(        0.53), SIMDE_FLOAT64_C(        1.42), SIMDE_FLOAT64_C(        1.46),
+        SIMDE_FLOAT64_C(       -1.72), SIMDE_FLOAT64_C(       -0.60), SIMDE_FLOAT64_C(       -0.30), SIMDE_FLOAT64_C(        1.90) },
+      SIMDE_FLOAT64_C(        0.62) },
+    { { SIMDE_FLOAT64_C(       -0.54), SIMDE_FLOAT64_C(       -0.64), SIMDE_FLOAT64_C(       -1.20), SIMDE_FLOAT64_C(       -1.94),
+        SIMDE_FLOAT64_C(        0.14), SIMDE_FLOAT64_C(        0.37), SIMDE_FLOAT64_C(        0.46), SIMDE_FLOAT64_C(        0.03) },
+      SIMDE_FLOAT64_C(        0.00) },
+    { { SIMDE_FLOAT64_C(       -1.18), SIMDE_FLOAT64_C(        0.87), SIMDE_FLOAT64_C(       -1.88), SIMDE_FLOAT64_C(       -1.75),
+        SIMDE_FLOAT64_C(       -0.97), SIMDE_FLOAT64_C(       -1.08), SIMDE_FLOAT64_C(        0.01), SIMDE_FLOAT64_C(       -1.59) },
+      SIMDE_FLOAT64_C(        0.06) },
+    { { SIMDE_FLOAT64_C(       -1.72), SIMDE_FLOAT64_C(       -0.98), SIMDE_FLOAT64_C(        0.40), SIMDE_FLOAT64_C(        0.36),
+        SIMDE_FLOAT64_C(        0.54), SIMDE_FLOAT64_C(        0.60), SIMDE_FLOAT64_C(       -0.58), SIMDE_FLOAT64_C(       -1.59) },
+      SIMDE_FLOAT64_C(        0.07) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_mul_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(        1.11), SIMDE_FLOAT64_C(        0.09), SIMDE_FLOAT64_C(        0.14), SIMDE_FLOAT64_C(        0.99),
+        SIMDE_FLOAT64_C(       -1.96), SIMDE_FLOAT64_C(       -1.92), SIMDE_FLOAT64_C(       -0.77), SIMDE_FLOAT64_C(       -0.37) },
+      SIMDE_FLOAT64_C(        1.00) },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(        1.63), SIMDE_FLOAT64_C(        0.46), SIMDE_FLOAT64_C(        1.02), SIMDE_FLOAT64_C(        1.04),
+        SIMDE_FLOAT64_C(       -0.25), SIMDE_FLOAT64_C(        1.36), SIMDE_FLOAT64_C(        0.65), SIMDE_FLOAT64_C(       -0.99) },
+      SIMDE_FLOAT64_C(        0.17) },
+    { UINT8_C(234),
+      { SIMDE_FLOAT64_C(        1.21), SIMDE_FLOAT64_C(       -0.44), SIMDE_FLOAT64_C(       -1.81), SIMDE_FLOAT64_C(       -0.72),
+        SIMDE_FLOAT64_C(        0.64), SIMDE_FLOAT64_C(        0.43), SIMDE_FLOAT64_C(       -1.89), SIMDE_FLOAT64_C(        1.07) },
+      SIMDE_FLOAT64_C(       -0.28) },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT64_C(        0.61), SIMDE_FLOAT64_C(       -0.80), SIMDE_FLOAT64_C(        1.70), SIMDE_FLOAT64_C(       -0.34),
+        SIMDE_FLOAT64_C(        1.55), SIMDE_FLOAT64_C(       -0.72), SIMDE_FLOAT64_C(        0.96), SIMDE_FLOAT64_C(       -1.56) },
+      SIMDE_FLOAT64_C(        0.17) },
+    { UINT8_C(253),
+      { SIMDE_FLOAT64_C(        0.92), SIMDE_FLOAT64_C(       -1.44), SIMDE_FLOAT64_C(        1.50), SIMDE_FLOAT64_C(       -0.95),
+        SIMDE_FLOAT64_C(       -0.36), SIMDE_FLOAT64_C(       -0.26), SIMDE_FLOAT64_C(       -1.92), SIMDE_FLOAT64_C(        0.11) },
+      SIMDE_FLOAT64_C(        0.03) },
+    { UINT8_C(146),
+      { SIMDE_FLOAT64_C(        1.84), SIMDE_FLOAT64_C(        0.32), SIMDE_FLOAT64_C(        1.03), SIMDE_FLOAT64_C(       -0.69),
+        SIMDE_FLOAT64_C(       -1.86), SIMDE_FLOAT64_C(       -0.66), SIMDE_FLOAT64_C(        0.40), SIMDE_FLOAT64_C(       -0.05) },
+      SIMDE_FLOAT64_C(        0.03) },
+    { UINT8_C(123),
+      { SIMDE_FLOAT64_C(        0.43), SIMDE_FLOAT64_C(       -0.89), SIMDE_FLOAT64_C(        1.84), SIMDE_FLOAT64_C(        0.67),
+        SIMDE_FLOAT64_C(        0.67), SIMDE_FLOAT64_C(       -1.57), SIMDE_FLOAT64_C(        0.96), SIMDE_FLOAT64_C(        1.55) },
+      SIMDE_FLOAT64_C(        0.26) },
+    { UINT8_C(131),
+      { SIMDE_FLOAT64_C(       -0.99), SIMDE_FLOAT64_C(        1.33), SIMDE_FLOAT64_C(       -0.16), SIMDE_FLOAT64_C(        0.28),
+        SIMDE_FLOAT64_C(        0.46), SIMDE_FLOAT64_C(        0.43), SIMDE_FLOAT64_C(       -0.03), SIMDE_FLOAT64_C(       -0.69) },
+      SIMDE_FLOAT64_C(        0.91) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_mul_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_or_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C( 1842802172), -INT32_C( 1542321600),  INT32_C( 1075855488),  INT32_C(   12976640),
+         INT32_C( 1074020480),  INT32_C(  134225920),  INT32_C(   33686528),  INT32_C(       8192),
+         INT32_C(       3072), -INT32_C( 1738274299), -INT32_C( 2147478448),  INT32_C(  151519232),
+         INT32_C(  201850952),  INT32_C(  675336400),  INT32_C(  134217730),  INT32_C(    9445376) },
+      -INT32_C(        289) },
+    { {  INT32_C(  279974144),  INT32_C(      17408),  INT32_C(  134217984),  INT32_C(     557060),
+        -INT32_C( 2146434558),  INT32_C(       4096),  INT32_C(  270533124),  INT32_C(  346588160),
+         INT32_C(      16386),  INT32_C(     526336),  INT32_C(  353437697),  INT32_C(  134488072),
+         INT32_C(     295041),  INT32_C(   49826528),  INT32_C(    9242624),  INT32_C(  135790626) },
+      -INT32_C( 1610743825) },
+    { {  INT32_C( 1073741824),  INT32_C(  134225984),  INT32_C(    1048616),  INT32_C(  268567306),
+         INT32_C(    2359296),  INT32_C(  541069345),  INT32_C(     557064),  INT32_C( 1107329280),
+        -INT32_C( 2130573312),  INT32_C(   25174048),  INT32_C(  420552704),  INT32_C( 1073743360),
+         INT32_C(    3670036),  INT32_C(   67371520),  INT32_C(   67109636),  INT32_C(     147568) },
+      -INT32_C(        129) },
+    { {  INT32_C(    2129920),  INT32_C(   17825841),  INT32_C(   33554697),  INT32_C(      12288),
+        -INT32_C( 2145644544),  INT32_C(      86016),  INT32_C(   27295776),  INT32_C(    4194328),
+        -INT32_C( 1023391192),  INT32_C(  536871113),  INT32_C(  268470272),  INT32_C(    8458240),
+         INT32_C(  268435464),  INT32_C(   84410692),  INT32_C(  268435586),  INT32_C(   68158217) },
+      -INT32_C(  134349825) },
+    { {  INT32_C(   67125312),  INT32_C(  604013593),  INT32_C(  277315777),  INT32_C(  151035938),
+         INT32_C(   16777232), -INT32_C( 2130673662),  INT32_C(  369623112),  INT32_C(     327760),
+         INT32_C(   50331648),  INT32_C(    5313536),  INT32_C(    8392704),  INT32_C(   41959432),
+         INT32_C( 1078067264),  INT32_C(  810549316),  INT32_C(   69206594),  INT32_C(   17106952) },
+      -INT32_C(        257) },
+    { {  INT32_C(  288374784),  INT32_C(   16777740),  INT32_C(     550976), -INT32_C( 2147467008),
+         INT32_C( 1073872912),  INT32_C(   42139712),  INT32_C(   33554434),  INT32_C(      34129),
+         INT32_C(     655360),  INT32_C(    8389120),  INT32_C(   67633152),  INT32_C( 1358956816),
+         INT32_C(    1067296),  INT32_C(    3670017),  INT32_C( 1074266176), -INT32_C( 2147450784) },
+      -INT32_C(  675549313) },
+    { {  INT32_C(    1048604),  INT32_C( 1073758208),  INT32_C(        256),  INT32_C( 1077936144),
+         INT32_C(      16392),  INT32_C(      73730), -INT32_C( 2145370112),  INT32_C(     131072),
+         INT32_C(  335544656),  INT32_C(   33588240),  INT32_C(  605028420), -INT32_C( 2147481592),
+         INT32_C(  335544772),  INT32_C(  538476676),  INT32_C( 1610614816),  INT32_C(     131328) },
+      -INT32_C(  159650306) },
+    { { -INT32_C( 2138560502), -INT32_C( 2147418112), -INT32_C( 2147482604),  INT32_C(  536904004),
+         INT32_C(  277381122),  INT32_C(   44319248),  INT32_C(         64), -INT32_C( 2146434556),
+         INT32_C(  138414080),  INT32_C(    4195328),  INT32_C(      12288), -INT32_C( 2147475452),
+         INT32_C(   67110913),  INT32_C( 1073741888),  INT32_C(  150995010),  INT32_C(   67108900) },
+      -INT32_C(     131201) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_or_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_or_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C(    6295568), -INT32_C( 2147352576),  INT32_C(    8953988),  INT32_C( 1077936640),
+         INT32_C( 1075838976),  INT32_C(        320),  INT32_C( 1644216352),  INT32_C( 1073905736),
+        -INT32_C( 1677688831),  INT32_C(  135659776), -INT32_C( 1610350592),  INT32_C(          4),
+         INT32_C(  536871424),  INT32_C(  167903232),  INT32_C( 1093140481),  INT32_C( 1346371586) },
+      INT32_C(          0) },
+    { UINT16_C(65535),
+      {  INT32_C(  268501632),  INT32_C(        524),  INT32_C(   41943808),  INT32_C(   20980256),
+         INT32_C( 1140850790),  INT32_C(  268510336),  INT32_C(  268435520),  INT32_C(    8388864),
+         INT32_C(  134218752),  INT32_C(  579076640),  INT32_C( 1073741824),  INT32_C(          0),
+         INT32_C(    4195361),  INT32_C(  537460868),  INT32_C(    2117664),  INT32_C(       3728) },
+      INT32_C( 2146271231) },
+    { UINT16_C( 7382),
+      { -INT32_C( 2146435068),  INT32_C( 1109655556),  INT32_C(      32788),  INT32_C(  136577432),
+         INT32_C( 1075841284),  INT32_C(   17695264),  INT32_C(     262400),  INT32_C(    4227076),
+         INT32_C(         17),  INT32_C(      16384),  INT32_C(          4),  INT32_C(    2164868),
+        -INT32_C( 2147450879),  INT32_C(    1179793),  INT32_C( 1074266114),  INT32_C(  134275080) },
+      -INT32_C( 1033533035) },
+    { UINT16_C(36180),
+      { -INT32_C( 1342172990),  INT32_C(  100859908), -INT32_C( 1606418432),  INT32_C(    2105344),
+         INT32_C(     139265), -INT32_C( 2130690038),  INT32_C(    8423440),  INT32_C(   69225472),
+         INT32_C(    8651874),  INT32_C(          0),  INT32_C(     526400),  INT32_C( 1375801344),
+         INT32_C(  537133056),  INT32_C(      33800),  INT32_C( 1342177280),  INT32_C( 1142947840) },
+      -INT32_C(  152060813) },
+    { UINT16_C(65442),
+      {  INT32_C(  402720517),  INT32_C(    1056768),  INT32_C(    2363480), -INT32_C( 2147351536),
+         INT32_C(  943723072),  INT32_C(     262168), -INT32_C(  738195454),  INT32_C( 1074332744),
+         INT32_C(  268961024),  INT32_C(  537004040),  INT32_C(         64),  INT32_C(   37831684),
+         INT32_C(  117965344),  INT32_C(   16777232),  INT32_C(   17565184), -INT32_C( 1601961344) },
+      -INT32_C(  136351748) },
+    { UINT16_C(39041),
+      {  INT32_C(   25174016),  INT32_C(    4336656),  INT32_C(  537919616),  INT32_C(   68419840),
+         INT32_C(  144965633),  INT32_C(       2821),  INT32_C(  289955852), -INT32_C( 1811677184),
+         INT32_C(     524288),            INT32_MIN,  INT32_C(  838860816),  INT32_C(     303169),
+         INT32_C( 1073741826),  INT32_C(     131104),  INT32_C(  541085785),  INT32_C(    4474880) },
+      -INT32_C(  708515773) },
+    { UINT16_C(31208),
+      {  INT32_C(  538968068),  INT32_C(  562692224),  INT32_C( 1073742340),  INT32_C(  809574400),
+         INT32_C(    3276800),  INT32_C(       4096),  INT32_C(     655652),  INT32_C( 1879052368),
+         INT32_C(    1048576),  INT32_C(    4759552),  INT32_C(    1089600),  INT32_C(  270807040),
+         INT32_C(      81920),  INT32_C( 1073758528),  INT32_C(          0),  INT32_C(     525512) },
+      INT32_C( 1887400308) },
+    { UINT16_C(23259),
+      {  INT32_C(     655368), -INT32_C( 2146435072),  INT32_C(    1056896), -INT32_C( 2147483584),
+         INT32_C(    3145728),  INT32_C(        268),  INT32_C(  201328384),  INT32_C(   11124832),
+         INT32_C(   75629056),  INT32_C(  268468736),  INT32_C(   34603010),  INT32_C(  606076960),
+         INT32_C(      16420),  INT32_C(    1310784),  INT32_C(  279216128),  INT32_C(          0) },
+      -INT32_C( 1128282260) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_or_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_or_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C(     22003118571530),  INT64_C(1164198098075914256),  INT64_C( 405328368939110400), -INT64_C(8502655339122912240),
+         INT64_C(   4609152785582152),  INT64_C(2455605924866818070),  INT64_C(4668096290695974916),  INT64_C(7156219881057419396) },
+      -INT64_C(    847862248399650) },
+    { {  INT64_C(   9011666020832258),  INT64_C(   9051182806859776),  INT64_C(     70918499991648), -INT64_C(9222791357242767808),
+         INT64_C(    844431372583168),  INT64_C(1297071945841393665),  INT64_C( 903043193816221704),  INT64_C( 578782940188639360) },
+      -INT64_C(7013373775164874773) },
+    { {  INT64_C( 578149602297905152),  INT64_C(1479451444722600272),  INT64_C( 648518485122486288),  INT64_C(4612248969454571524),
+        -INT64_C(9223342882583080830),  INT64_C(4107933771582440529),  INT64_C(2323866479499411528),  INT64_C(   9009605510168832) },
+      -INT64_C( 149080632060551713) },
+    { {  INT64_C(  40569823529271298),  INT64_C(4620975246709621250),  INT64_C(  36029081024774336),  INT64_C(   5066601188589568),
+         INT64_C(   4504699417920512),  INT64_C( 153142728304108194),  INT64_C(    143486804561936),  INT64_C(4791832203087511552) },
+      INT64_C(4806382929863243506) },
+    { { -INT64_C(4530620116763670519),  INT64_C(2022116417508884608),  INT64_C(  54337873234624656),  INT64_C(    633868520529920),
+         INT64_C( 870391271635550208),  INT64_C(  72058732741133744),  INT64_C( 578994027093821656),  INT64_C( 211706566033278992) },
+      -INT64_C(2306001428050973191) },
+    { {  INT64_C( 579345905176625344),  INT64_C(   6825792881297472),  INT64_C(4701848171465146624),  INT64_C(2308235546515734528),
+         INT64_C(     35188667064322),  INT64_C(2449966995566792736),  INT64_C(2310768890162497600),  INT64_C(   2393087158517804) },
+      INT64_C(7736052341152545262) },
+    { {  INT64_C(     45148734161024),  INT64_C(    598409253773320),  INT64_C(  37717956118446080),  INT64_C( 576461886275803136),
+         INT64_C(         8590262537), -INT64_C(9205248648718188536),  INT64_C(  10133106814093360),  INT64_C(4647714815859507220) },
+      -INT64_C(3970367841160431171) },
+    { {  INT64_C(4647787935284871168),  INT64_C(  74942712549218304),  INT64_C(  39451181646381312),  INT64_C(    283682724184104),
+         INT64_C(2378043542045196352),  INT64_C(  12411459053060096),  INT64_C(   9570183567908865),  INT64_C( 289074801115661312) },
+      INT64_C(7327350746369097065) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_or_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_or_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C( 162129603832385537),  INT64_C(4035262718239047712), -INT64_C(7421930536291008384),  INT64_C(  36138748190654980),
+         INT64_C(   1152298923328162),  INT64_C(1157426203745845260),  INT64_C(    281621005729920),  INT64_C(     36283884261892) },
+      INT64_C(                  0) },
+    { UINT8_C(255),
+      {  INT64_C(4116290068677656752),  INT64_C( 577025905583456782), -INT64_C(8286302806420225792),  INT64_C( 581828575050072112),
+        -INT64_C(9223262085020876736), -INT64_C(9150751424143916928),  INT64_C(    282026881089538),  INT64_C( 594475167992783896) },
+      -INT64_C(4795357684665112578) },
+    { UINT8_C( 48),
+      {  INT64_C(    351912979857425),  INT64_C(   2255235867771216),  INT64_C(      2203586691204),  INT64_C(    615735109878784),
+        -INT64_C(2089670227099383776), -INT64_C(9196350438952140000),  INT64_C( 588846820784865284),  INT64_C(   4503601779179544) },
+      -INT64_C(2062648629196748000) },
+    { UINT8_C(234),
+      {  INT64_C( 882987691585635328),  INT64_C(2305843287329603968),  INT64_C(6125194582398861888),  INT64_C(5764644356812242948),
+        -INT64_C(9223372036845861760),  INT64_C( 144125152402130048),  INT64_C(6917531365177556992),  INT64_C(4684341746857935240) },
+      INT64_C(8287234577553540492) },
+    { UINT8_C(195),
+      {  INT64_C(3531393956993040424), -INT64_C(9187343188275232768),  INT64_C(   3729543462461850),  INT64_C(4611976303455764608),
+         INT64_C(2319384741528207360),  INT64_C( 886382431303680000), -INT64_C(9061242441142630400),  INT64_C( 144115325590839400) },
+      -INT64_C(5493819532423714712) },
+    { UINT8_C(250),
+      {  INT64_C(1161933112654176257),  INT64_C(4611690416742334528),  INT64_C(1739515771627765914),  INT64_C(4904459577698811906),
+         INT64_C(  36732489829449734),  INT64_C(5206163505702502400), -INT64_C(9182697663604915199),  INT64_C(     88098906112008) },
+      -INT64_C(3687613419713395633) },
+    { UINT8_C( 33),
+      {  INT64_C(2306968986439387648),  INT64_C( 298451505038760000), -INT64_C(7987133930008477680),  INT64_C(     70438000525314),
+         INT64_C(1513422780052275968), -INT64_C(4467570817457454080),  INT64_C(8125742772985529344),  INT64_C(      8933541478912) },
+      -INT64_C(2160601839616389632) },
+    { UINT8_C(  6),
+      { -INT64_C(9223230741020606398),  INT64_C(            8454177),  INT64_C(2883429936839262208),  INT64_C( 614758958603342336),
+         INT64_C(1152939715293364224),  INT64_C( 288266127459876992),  INT64_C(1161928910323073060),  INT64_C(2040132866738172161) },
+      INT64_C(2883429936847716385) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_or_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_and_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_and_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_and_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_and_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_or_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_or_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_or_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_or_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,3165 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN scatter
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/scatter.h>
+
+static int32_t i32_buffer[4096];
+static int64_t i64_buffer[4096];
+static simde_float32 f32_buffer[4096];
+static simde_float64 f64_buffer[4096];
+
+static int
+test_simde_mm_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(          70), -INT32_C(          15), -INT32_C(           9), -INT32_C(         110) },
+      {  INT32_C(  2080366591),  INT32_C(  1021595175),  INT32_C(  1342177255), -INT32_C(  1431447880) },
+      {  INT32_C(  2080366591),  INT32_C(  1021595175),  INT32_C(  1342177255), -INT32_C(  1431447880) } },
+    { { -INT32_C(         183),  INT32_C(          53), -INT32_C(         244), -INT32_C(         244) },
+      {  INT32_C(    67174692),  INT32_C(   272633892), -INT32_C(    62578033), -INT32_C(   538968065) },
+      {  INT32_C(    67174692),  INT32_C(   272633892), -INT32_C(   538968065), -INT32_C(   538968065) } },
+    { { -INT32_C(         123), -INT32_C(          40),  INT32_C(         148), -INT32_C(         211) },
+      {  INT32_C(  1817300626), -INT32_C(    70549505),  INT32_C(     4194304),  INT32_C(    67190800) },
+      {  INT32_C(  1817300626), -INT32_C(    70549505),  INT32_C(     4194304),  INT32_C(    67190800) } },
+    { { -INT32_C(           5), -INT32_C(           5), -INT32_C(          93), -INT32_C(          23) },
+      { -INT32_C(    76087298),  INT32_C(  1358954502),  INT32_C(    60077672), -INT32_C(  1292785911) },
+      {  INT32_C(  1358954502),  INT32_C(  1358954502),  INT32_C(    60077672), -INT32_C(  1292785911) } },
+    { {  INT32_C(         152), -INT32_C(         193), -INT32_C(          23),  INT32_C(         171) },
+      {  INT32_C(    92275010), -INT32_C(     8945665), -INT32_C(   443385375),  INT32_C(   141848629) },
+      {  INT32_C(    92275010), -INT32_C(     8945665), -INT32_C(   443385375),  INT32_C(   141848629) } },
+    { {  INT32_C(          21),  INT32_C(          21), -INT32_C(          92),  INT32_C(           6) },
+      {  INT32_C(   272629760),  INT32_C(   168394752),  INT32_C(     2097152),  INT32_C(   205520897) },
+      {  INT32_C(   168394752),  INT32_C(   168394752),  INT32_C(     2097152),  INT32_C(   205520897) } },
+    { {  INT32_C(         226),  INT32_C(         178),  INT32_C(         136), -INT32_C(          54) },
+      {  INT32_C(  1029267866), -INT32_C(  1073752065), -INT32_C(      262145),  INT32_C(  1878652924) },
+      {  INT32_C(  1029267866), -INT32_C(  1073752065), -INT32_C(      262145),  INT32_C(  1878652924) } },
+    { { -INT32_C(         236), -INT32_C(          18), -INT32_C(          17), -INT32_C(         122) },
+      {  INT32_C(         168), -INT32_C(  1429526787), -INT32_C(   322401430),  INT32_C(   443631375) },
+      {  INT32_C(         168), -INT32_C(  1429526787), -INT32_C(   322401430),  INT32_C(   443631375) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde_mm_i32scatter_epi32(&(i32_buffer[2048]), vindex, a, 4);
+
+    int32_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x4(simde_x_mm_loadu_epi32(r), simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT32_C(         640), -INT32_C(         580), -INT32_C(         788), -INT32_C(         172) },
+      {  INT32_C(    10486036),  INT32_C(   606409581),  INT32_C(  1020222046), -INT32_C(   471859841) },
+      {  INT32_C(    10486036),  INT32_C(   606409581),  INT32_C(  1020222046), -INT32_C(   471859841) } },
+    { UINT8_C(170),
+      { -INT32_C(         196),  INT32_C(           4),  INT32_C(           4),  INT32_C(           4) },
+      { -INT32_C(   748635126), -INT32_C(    41943297), -INT32_C(   658102874),  INT32_C(     8913088) },
+      { -INT32_C(         147),  INT32_C(     8913088),  INT32_C(     8913088),  INT32_C(     8913088) } },
+    { UINT8_C( 19),
+      { -INT32_C(         416),  INT32_C(         972), -INT32_C(         768),  INT32_C(         712) },
+      { -INT32_C(  1128922813),  INT32_C(  1037536569),  INT32_C(   898289386), -INT32_C(  2136994953) },
+      { -INT32_C(  1128922813),  INT32_C(  1037536569), -INT32_C(         576),  INT32_C(         534) } },
+    { UINT8_C( 80),
+      { -INT32_C(         748),  INT32_C(         112), -INT32_C(         748),  INT32_C(         332) },
+      {  INT32_C(    67641888), -INT32_C(  1168743060),  INT32_C(       65536), -INT32_C(     3162113) },
+      { -INT32_C(         561),  INT32_C(          84), -INT32_C(         561),  INT32_C(         249) } },
+    { UINT8_C( 57),
+      { -INT32_C(         196), -INT32_C(         444), -INT32_C(         220), -INT32_C(         888) },
+      { -INT32_C(   134258721),  INT32_C(      790529),  INT32_C(  1697278219), -INT32_C(   268435489) },
+      { -INT32_C(   134258721), -INT32_C(         333), -INT32_C(         165), -INT32_C(   268435489) } },
+    { UINT8_C(244),
+      {  INT32_C(         288),  INT32_C(         288), -INT32_C(         904), -INT32_C(         904) },
+      { -INT32_C(    33587265), -INT32_C(  2088398062), -INT32_C(  1940910080), -INT32_C(     4325505) },
+      {  INT32_C(         216),  INT32_C(         216), -INT32_C(  1940910080), -INT32_C(  1940910080) } },
+    { UINT8_C(191),
+      { -INT32_C(         308), -INT32_C(         744),  INT32_C(         440), -INT32_C(          80) },
+      {  INT32_C(  1071333375),  INT32_C(   169877504), -INT32_C(    11032794),  INT32_C(    25199425) },
+      {  INT32_C(  1071333375),  INT32_C(   169877504), -INT32_C(    11032794),  INT32_C(    25199425) } },
+    { UINT8_C(194),
+      {  INT32_C(         884),  INT32_C(         388), -INT32_C(         780),  INT32_C(         920) },
+      { -INT32_C(    46268737),  INT32_C(   389787663), -INT32_C(        2065),  INT32_C(      526336) },
+      {  INT32_C(         663),  INT32_C(   389787663), -INT32_C(         585),  INT32_C(         690) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde_mm_mask_i32scatter_epi32(&(i32_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    int32_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x4(simde_x_mm_loadu_epi32(r), simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(         178), -INT32_C(         177), -INT32_C(  1377095571), -INT32_C(  1177995949) },
+      {  INT64_C( 9150749276391604213),  INT64_C(  603554986589036548) },
+      {  INT64_C( 9150749276391604213),  INT64_C(  603554986589036548) } },
+    { {  INT32_C(          57),  INT32_C(          49),  INT32_C(   831162974),  INT32_C(  1518886607) },
+      {  INT64_C( 7988214777858914102),  INT64_C( 1153484472008572952) },
+      {  INT64_C( 7988214777858914102),  INT64_C( 1153484472008572952) } },
+    { { -INT32_C(          59), -INT32_C(          45), -INT32_C(   490808233), -INT32_C(   930009677) },
+      { -INT64_C(    3537146086457865),  INT64_C(   18612601623674896) },
+      { -INT64_C(    3537146086457865),  INT64_C(   18612601623674896) } },
+    { { -INT32_C(         180), -INT32_C(         135), -INT32_C(   161716728),  INT32_C(  1382648728) },
+      {  INT64_C( 6938406073635034672),  INT64_C( 4612250147383148608) },
+      {  INT64_C( 6938406073635034672),  INT64_C( 4612250147383148608) } },
+    { {  INT32_C(          78),  INT32_C(         221),  INT32_C(   155596082),  INT32_C(   614466408) },
+      { -INT64_C( 6316291879776284672), -INT64_C( 6122156624301407392) },
+      { -INT64_C( 6316291879776284672), -INT64_C( 6122156624301407392) } },
+    { {  INT32_C(         242), -INT32_C(          45), -INT32_C(   175739662), -INT32_C(   677390818) },
+      { -INT64_C( 9223090424170675198),  INT64_C(    4503599896887297) },
+      { -INT64_C( 9223090424170675198),  INT64_C(    4503599896887297) } },
+    { {  INT32_C(          45),  INT32_C(          18),  INT32_C(  1299658351),  INT32_C(  1919475567) },
+      {  INT64_C( 5218924076632951087),  INT64_C( 1518700506881367610) },
+      {  INT64_C( 5218924076632951087),  INT64_C( 1518700506881367610) } },
+    { {  INT32_C(         208),  INT32_C(         141), -INT32_C(   327479396),  INT32_C(   637000963) },
+      {  INT64_C(  144890413634289792), -INT64_C( 5075847060046559433) },
+      {  INT64_C(  144890413634289792), -INT64_C( 5075847060046559433) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde_mm_i32scatter_epi64(&(i64_buffer[2048]), vindex, a, 8);
+
+    int64_t r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x2(simde_x_mm_loadu_epi64(r), simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT32_C(         376), -INT32_C(         868), -INT32_C(   417680196), -INT32_C(   799169399) },
+      {  INT64_C( 5662545027094114253),  INT64_C( 2290842990644855855) },
+      {  INT64_C( 5662545027094114253),  INT64_C( 2290842990644855855) } },
+    { UINT8_C( 69),
+      { -INT32_C(         788),  INT32_C(         796), -INT32_C(     8565814),  INT32_C(  1725858310) },
+      { -INT64_C( 3040404882283049841), -INT64_C(       8800527459873) },
+      { -INT64_C( 3040404882283049841),  INT64_C(        854698492103) } },
+    { UINT8_C(204),
+      {  INT32_C(         452), -INT32_C(         616), -INT32_C(   545964054),  INT32_C(   354005910) },
+      { -INT64_C(  787875942640474400), -INT64_C( 2305845208539474945) },
+      {  INT64_C(        485331304561), -INT64_C(        661424963738) } },
+    { UINT8_C(203),
+      {  INT32_C(         500),  INT32_C(         964), -INT32_C(   478855065), -INT32_C(   717872814) },
+      {  INT64_C( 1152992302864531456), -INT64_C( 4564133478990483608) },
+      {  INT64_C( 1152992302864531456), -INT64_C( 4564133478990483608) } },
+    { UINT8_C(206),
+      { -INT32_C(         584), -INT32_C(         700), -INT32_C(  1481303873),  INT32_C(   870376182) },
+      {  INT64_C(             4325414),  INT64_C(   18296977562288198) },
+      { -INT64_C(        627065225362),  INT64_C(   18296977562288198) } },
+    { UINT8_C(  0),
+      { -INT32_C(         776), -INT32_C(          12),  INT32_C(  1535399714),  INT32_C(    95791051) },
+      {  INT64_C(   11270065119428896), -INT64_C( 7445856577872836689) },
+      { -INT64_C(        833223655618), -INT64_C(         12884901891) } },
+    { UINT8_C(155),
+      { -INT32_C(          32), -INT32_C(         252), -INT32_C(   308115297),  INT32_C(  1019661528) },
+      { -INT64_C( 5917734868909637633), -INT64_C(  847398663530703307) },
+      { -INT64_C( 5917734868909637633), -INT64_C(  847398663530703307) } },
+    { UINT8_C( 52),
+      { -INT32_C(         300), -INT32_C(         300),  INT32_C(   118707633), -INT32_C(  1525068656) },
+      { -INT64_C(   20271696166521089),  INT64_C( 4611686020843323713) },
+      { -INT64_C(        322122547275), -INT64_C(        322122547275) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde_mm_mask_i32scatter_epi64(&(i64_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    int64_t r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x2(simde_x_mm_loadu_epi64(r), simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { -INT32_C(         107),  INT32_C(         198), -INT32_C(          36), -INT32_C(          83) },
+      { SIMDE_FLOAT32_C(   656.50), SIMDE_FLOAT32_C(  2975.50), SIMDE_FLOAT32_C( -3579.50), SIMDE_FLOAT32_C(   981.00) },
+      { SIMDE_FLOAT32_C(   656.50), SIMDE_FLOAT32_C(  2975.50), SIMDE_FLOAT32_C( -3579.50), SIMDE_FLOAT32_C(   981.00) } },
+    { { -INT32_C(         128), -INT32_C(         243),  INT32_C(         245), -INT32_C(         243) },
+      { SIMDE_FLOAT32_C(  4377.25), SIMDE_FLOAT32_C(  7670.75), SIMDE_FLOAT32_C(  3330.25), SIMDE_FLOAT32_C(  6716.25) },
+      { SIMDE_FLOAT32_C(  4377.25), SIMDE_FLOAT32_C(  6716.25), SIMDE_FLOAT32_C(  3330.25), SIMDE_FLOAT32_C(  6716.25) } },
+    { { -INT32_C(          46),  INT32_C(         214),  INT32_C(          46), -INT32_C(         210) },
+      { SIMDE_FLOAT32_C( -5360.75), SIMDE_FLOAT32_C( -2150.75), SIMDE_FLOAT32_C(  7439.25), SIMDE_FLOAT32_C( -1937.75) },
+      { SIMDE_FLOAT32_C( -5360.75), SIMDE_FLOAT32_C( -2150.75), SIMDE_FLOAT32_C(  7439.25), SIMDE_FLOAT32_C( -1937.75) } },
+    { { -INT32_C(         246), -INT32_C(         246), -INT32_C(         246), -INT32_C(         246) },
+      { SIMDE_FLOAT32_C( -8840.00), SIMDE_FLOAT32_C(  6288.50), SIMDE_FLOAT32_C( -5714.75), SIMDE_FLOAT32_C( -1983.00) },
+      { SIMDE_FLOAT32_C( -1983.00), SIMDE_FLOAT32_C( -1983.00), SIMDE_FLOAT32_C( -1983.00), SIMDE_FLOAT32_C( -1983.00) } },
+    { { -INT32_C(          94), -INT32_C(          15), -INT32_C(          40),  INT32_C(         229) },
+      { SIMDE_FLOAT32_C(  2222.25), SIMDE_FLOAT32_C(   949.00), SIMDE_FLOAT32_C( -2010.50), SIMDE_FLOAT32_C(  -455.75) },
+      { SIMDE_FLOAT32_C(  2222.25), SIMDE_FLOAT32_C(   949.00), SIMDE_FLOAT32_C( -2010.50), SIMDE_FLOAT32_C(  -455.75) } },
+    { { -INT32_C(          44), -INT32_C(         250),  INT32_C(         193), -INT32_C(          44) },
+      { SIMDE_FLOAT32_C(  4146.50), SIMDE_FLOAT32_C( -5035.25), SIMDE_FLOAT32_C( -9752.25), SIMDE_FLOAT32_C( -3018.50) },
+      { SIMDE_FLOAT32_C( -3018.50), SIMDE_FLOAT32_C( -5035.25), SIMDE_FLOAT32_C( -9752.25), SIMDE_FLOAT32_C( -3018.50) } },
+    { {  INT32_C(         196),  INT32_C(         191),  INT32_C(         235),  INT32_C(          56) },
+      { SIMDE_FLOAT32_C(  9561.25), SIMDE_FLOAT32_C( -5536.00), SIMDE_FLOAT32_C( -9076.25), SIMDE_FLOAT32_C(  9241.50) },
+      { SIMDE_FLOAT32_C(  9561.25), SIMDE_FLOAT32_C( -5536.00), SIMDE_FLOAT32_C( -9076.25), SIMDE_FLOAT32_C(  9241.50) } },
+    { { -INT32_C(         206), -INT32_C(         152), -INT32_C(         135), -INT32_C(         115) },
+      { SIMDE_FLOAT32_C(  5082.00), SIMDE_FLOAT32_C( -8090.25), SIMDE_FLOAT32_C(   527.50), SIMDE_FLOAT32_C(   141.00) },
+      { SIMDE_FLOAT32_C(  5082.00), SIMDE_FLOAT32_C( -8090.25), SIMDE_FLOAT32_C(   527.50), SIMDE_FLOAT32_C(   141.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_mm_i32scatter_ps(&(f32_buffer[2048]), vindex, a, 4);
+
+    simde_float32 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x4(simde_mm_loadu_ps(r), simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT32_C(          95),  INT32_C(         100), -INT32_C(          85),  INT32_C(         144) },
+      { SIMDE_FLOAT32_C( -2214.25), SIMDE_FLOAT32_C( -8672.00), SIMDE_FLOAT32_C(  7166.25), SIMDE_FLOAT32_C(  -781.50) },
+      { SIMDE_FLOAT32_C( -2214.25), SIMDE_FLOAT32_C( -8672.00), SIMDE_FLOAT32_C(  7166.25), SIMDE_FLOAT32_C(  -781.50) } },
+    { UINT8_C( 63),
+      { -INT32_C(         180), -INT32_C(         124),  INT32_C(         168), -INT32_C(         194) },
+      { SIMDE_FLOAT32_C( -7361.50), SIMDE_FLOAT32_C(  6308.50), SIMDE_FLOAT32_C( -8307.50), SIMDE_FLOAT32_C(  -176.50) },
+      { SIMDE_FLOAT32_C( -7361.50), SIMDE_FLOAT32_C(  6308.50), SIMDE_FLOAT32_C( -8307.50), SIMDE_FLOAT32_C(  -176.50) } },
+    { UINT8_C( 68),
+      {  INT32_C(          68),  INT32_C(         254), -INT32_C(         130),  INT32_C(         187) },
+      { SIMDE_FLOAT32_C(  3028.00), SIMDE_FLOAT32_C(  7068.25), SIMDE_FLOAT32_C( -4899.75), SIMDE_FLOAT32_C(  -616.25) },
+      { SIMDE_FLOAT32_C(    34.00), SIMDE_FLOAT32_C(   127.00), SIMDE_FLOAT32_C( -4899.75), SIMDE_FLOAT32_C(    93.50) } },
+    { UINT8_C( 90),
+      {  INT32_C(         241), -INT32_C(         225), -INT32_C(          60),  INT32_C(         241) },
+      { SIMDE_FLOAT32_C( -7401.75), SIMDE_FLOAT32_C(   535.50), SIMDE_FLOAT32_C(  1070.00), SIMDE_FLOAT32_C(  2014.50) },
+      { SIMDE_FLOAT32_C(  2014.50), SIMDE_FLOAT32_C(   535.50), SIMDE_FLOAT32_C(   -30.00), SIMDE_FLOAT32_C(  2014.50) } },
+    { UINT8_C(251),
+      { -INT32_C(          36),  INT32_C(           7), -INT32_C(          99), -INT32_C(         129) },
+      { SIMDE_FLOAT32_C(  9751.25), SIMDE_FLOAT32_C( -6316.00), SIMDE_FLOAT32_C( -3729.50), SIMDE_FLOAT32_C(  9884.50) },
+      { SIMDE_FLOAT32_C(  9751.25), SIMDE_FLOAT32_C( -6316.00), SIMDE_FLOAT32_C(   -49.50), SIMDE_FLOAT32_C(  9884.50) } },
+    { UINT8_C(230),
+      {  INT32_C(          74),  INT32_C(          74),  INT32_C(          27),  INT32_C(          27) },
+      { SIMDE_FLOAT32_C(  8327.25), SIMDE_FLOAT32_C( -5839.50), SIMDE_FLOAT32_C( -3451.50), SIMDE_FLOAT32_C(  9878.50) },
+      { SIMDE_FLOAT32_C( -5839.50), SIMDE_FLOAT32_C( -5839.50), SIMDE_FLOAT32_C( -3451.50), SIMDE_FLOAT32_C( -3451.50) } },
+    { UINT8_C(187),
+      { -INT32_C(         174),  INT32_C(         156), -INT32_C(         144),  INT32_C(         103) },
+      { SIMDE_FLOAT32_C(  9564.00), SIMDE_FLOAT32_C(  5124.00), SIMDE_FLOAT32_C(  7380.00), SIMDE_FLOAT32_C( -1865.00) },
+      { SIMDE_FLOAT32_C(  9564.00), SIMDE_FLOAT32_C(  5124.00), SIMDE_FLOAT32_C(   -72.00), SIMDE_FLOAT32_C( -1865.00) } },
+    { UINT8_C( 58),
+      { -INT32_C(         151), -INT32_C(         151), -INT32_C(         108), -INT32_C(         151) },
+      { SIMDE_FLOAT32_C(  2264.00), SIMDE_FLOAT32_C(  8302.75), SIMDE_FLOAT32_C(  -370.00), SIMDE_FLOAT32_C( -2346.25) },
+      { SIMDE_FLOAT32_C( -2346.25), SIMDE_FLOAT32_C( -2346.25), SIMDE_FLOAT32_C(   -54.00), SIMDE_FLOAT32_C( -2346.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_mm_mask_i32scatter_ps(&(f32_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    simde_float32 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x4(simde_mm_loadu_ps(r), simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { {  INT32_C(          70),  INT32_C(         234), -INT32_C(   311085271), -INT32_C(   826698442) },
+      { SIMDE_FLOAT64_C( -8167.25), SIMDE_FLOAT64_C(  8825.75) },
+      { SIMDE_FLOAT64_C( -8167.25), SIMDE_FLOAT64_C(  8825.75) } },
+    { { -INT32_C(         202), -INT32_C(         202), -INT32_C(  1451303318), -INT32_C(  1414605015) },
+      { SIMDE_FLOAT64_C( -4866.75), SIMDE_FLOAT64_C( -5153.00) },
+      { SIMDE_FLOAT64_C( -5153.00), SIMDE_FLOAT64_C( -5153.00) } },
+    { {  INT32_C(         249), -INT32_C(         238),  INT32_C(  1667687494),  INT32_C(  1877456784) },
+      { SIMDE_FLOAT64_C(    27.25), SIMDE_FLOAT64_C( -2400.00) },
+      { SIMDE_FLOAT64_C(    27.25), SIMDE_FLOAT64_C( -2400.00) } },
+    { {  INT32_C(          32),  INT32_C(          32),  INT32_C(  1473896758), -INT32_C(  1290807144) },
+      { SIMDE_FLOAT64_C(  2957.25), SIMDE_FLOAT64_C(  9405.00) },
+      { SIMDE_FLOAT64_C(  9405.00), SIMDE_FLOAT64_C(  9405.00) } },
+    { { -INT32_C(          41),  INT32_C(          22), -INT32_C(   539614112),  INT32_C(  1019154259) },
+      { SIMDE_FLOAT64_C(  -110.25), SIMDE_FLOAT64_C(  3412.50) },
+      { SIMDE_FLOAT64_C(  -110.25), SIMDE_FLOAT64_C(  3412.50) } },
+    { {  INT32_C(         112),  INT32_C(         112), -INT32_C(  1233401454),  INT32_C(   464134139) },
+      { SIMDE_FLOAT64_C(  3730.00), SIMDE_FLOAT64_C(  2522.75) },
+      { SIMDE_FLOAT64_C(  2522.75), SIMDE_FLOAT64_C(  2522.75) } },
+    { { -INT32_C(           4), -INT32_C(          73),  INT32_C(   611257739),  INT32_C(  1622100203) },
+      { SIMDE_FLOAT64_C(  3999.25), SIMDE_FLOAT64_C(  8942.00) },
+      { SIMDE_FLOAT64_C(  3999.25), SIMDE_FLOAT64_C(  8942.00) } },
+    { {  INT32_C(         159),  INT32_C(          37), -INT32_C(  1037705602), -INT32_C(   903184313) },
+      { SIMDE_FLOAT64_C( -4103.00), SIMDE_FLOAT64_C( -3585.00) },
+      { SIMDE_FLOAT64_C( -4103.00), SIMDE_FLOAT64_C( -3585.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_mm_i32scatter_pd(&(f64_buffer[2048]), vindex, a, 8);
+
+    simde_float64 r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x2(simde_mm_loadu_pd(r), simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT32_C(         264),  INT32_C(         208), -INT32_C(   203176140),  INT32_C(   282183415) },
+      { SIMDE_FLOAT64_C(  9799.00), SIMDE_FLOAT64_C(  2299.50) },
+      { SIMDE_FLOAT64_C(  9799.00), SIMDE_FLOAT64_C(  2299.50) } },
+    { UINT8_C(156),
+      {  INT32_C(         152), -INT32_C(        1624),  INT32_C(    47633029), -INT32_C(  2077434001) },
+      { SIMDE_FLOAT64_C( -2012.75), SIMDE_FLOAT64_C(  5227.50) },
+      { SIMDE_FLOAT64_C(     4.75), SIMDE_FLOAT64_C(   -50.75) } },
+    { UINT8_C(206),
+      {  INT32_C(         656), -INT32_C(         752), -INT32_C(    49378480),  INT32_C(  1541448193) },
+      { SIMDE_FLOAT64_C(  5040.75), SIMDE_FLOAT64_C( -7813.25) },
+      { SIMDE_FLOAT64_C(    20.50), SIMDE_FLOAT64_C( -7813.25) } },
+    { UINT8_C(234),
+      {  INT32_C(        1824),  INT32_C(        1120), -INT32_C(  1928225271), -INT32_C(  1305130954) },
+      { SIMDE_FLOAT64_C( -4031.25), SIMDE_FLOAT64_C(  -706.25) },
+      { SIMDE_FLOAT64_C(    57.00), SIMDE_FLOAT64_C(  -706.25) } },
+    { UINT8_C(199),
+      { -INT32_C(        1720), -INT32_C(        1656), -INT32_C(  1647155676),  INT32_C(  1586692917) },
+      { SIMDE_FLOAT64_C(  1128.75), SIMDE_FLOAT64_C(  6689.50) },
+      { SIMDE_FLOAT64_C(  1128.75), SIMDE_FLOAT64_C(  6689.50) } },
+    { UINT8_C( 53),
+      {  INT32_C(        1584),  INT32_C(         408),  INT32_C(   261600795), -INT32_C(  1027772660) },
+      { SIMDE_FLOAT64_C(  4286.00), SIMDE_FLOAT64_C( -6472.25) },
+      { SIMDE_FLOAT64_C(  4286.00), SIMDE_FLOAT64_C(    12.75) } },
+    { UINT8_C(174),
+      { -INT32_C(         928),  INT32_C(        1904),  INT32_C(  1867481752),  INT32_C(  1015951838) },
+      { SIMDE_FLOAT64_C(  7765.75), SIMDE_FLOAT64_C(   589.75) },
+      { SIMDE_FLOAT64_C(   -29.00), SIMDE_FLOAT64_C(   589.75) } },
+    { UINT8_C(234),
+      { -INT32_C(        1744), -INT32_C(         176), -INT32_C(   319676596),  INT32_C(  1040945687) },
+      { SIMDE_FLOAT64_C(  6699.50), SIMDE_FLOAT64_C(  2103.75) },
+      { SIMDE_FLOAT64_C(   -54.50), SIMDE_FLOAT64_C(  2103.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_mm_mask_i32scatter_pd(&(f64_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    simde_float64 r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x2(simde_mm_loadu_pd(r), simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(                 188), -INT64_C(                 114) },
+      {  INT32_C(  1909504278),  INT32_C(    36306952), -INT32_C(  1202909206),  INT32_C(   340787344) },
+      {  INT32_C(  1909504278),  INT32_C(    36306952),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT64_C(                 248), -INT64_C(                  30) },
+      {  INT32_C(   682623182), -INT32_C(  1421768426),  INT32_C(  1109393792),  INT32_C(   540249368) },
+      {  INT32_C(   682623182), -INT32_C(  1421768426),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT64_C(                 176),  INT64_C(                  95) },
+      { -INT32_C(  1400400366), -INT32_C(   730055202), -INT32_C(  1639534177), -INT32_C(   570441857) },
+      { -INT32_C(  1400400366), -INT32_C(   730055202),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT64_C(                 107),  INT64_C(                 206) },
+      {  INT32_C(   681558851), -INT32_C(  1885664737), -INT32_C(  1499408447), -INT32_C(  1545736324) },
+      {  INT32_C(   681558851), -INT32_C(  1885664737),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT64_C(                 156), -INT64_C(                 184) },
+      {  INT32_C(  1642143181),  INT32_C(        1344), -INT32_C(   596327576), -INT32_C(  1090717974) },
+      {  INT32_C(  1642143181),  INT32_C(        1344),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT64_C(                 172), -INT64_C(                  67) },
+      { -INT32_C(   514336482), -INT32_C(  1900499610),  INT32_C(  1355542965),  INT32_C(   231192383) },
+      { -INT32_C(   514336482), -INT32_C(  1900499610),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT64_C(                 136),  INT64_C(                 245) },
+      {  INT32_C(   706877648), -INT32_C(  2009709343),  INT32_C(  1793621652),  INT32_C(  1475870591) },
+      {  INT32_C(   706877648), -INT32_C(  2009709343),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT64_C(                  13), -INT64_C(                  13) },
+      { -INT32_C(   922593992), -INT32_C(  1541307387),  INT32_C(  1631549854), -INT32_C(   536872961) },
+      { -INT32_C(  1541307387), -INT32_C(  1541307387),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde_mm_i64scatter_epi32(&(i32_buffer[2048]), vindex, a, 8);
+
+    int32_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x4(simde_x_mm_loadu_epi32(r), simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                 396),  INT64_C(                 132) },
+      {  INT32_C(  1635107852), -INT32_C(  1257757066),  INT32_C(  1159591899), -INT32_C(    68222977) },
+      {  INT32_C(  1635107852), -INT32_C(  1257757066),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 44),
+      {  INT64_C(                 342), -INT64_C(                 196) },
+      {  INT32_C(       65536),  INT32_C(  1244832214),  INT32_C(  1608490825),  INT32_C(   848399354) },
+      {  INT32_C(         513), -INT32_C(         294),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(106),
+      { -INT64_C(                 308),  INT64_C(                 316) },
+      { -INT32_C(     9017363),  INT32_C(  1090782208), -INT32_C(   134250566),  INT32_C(       10242) },
+      { -INT32_C(         462),  INT32_C(  1090782208),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(248),
+      {  INT64_C(                  36),  INT64_C(                  36) },
+      {  INT32_C(     1048580),  INT32_C(         256),  INT32_C(   306199479), -INT32_C(   134742034) },
+      {  INT32_C(          54),  INT32_C(          54),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(197),
+      {  INT64_C(                 110), -INT64_C(                  54) },
+      {  INT32_C(   483591263),  INT32_C(   536215284), -INT32_C(  1065876416),  INT32_C(   402784256) },
+      {  INT32_C(   483591263), -INT32_C(          81),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(218),
+      { -INT64_C(                 228),  INT64_C(                 362) },
+      {  INT32_C(           5), -INT32_C(         161),  INT32_C(  2147450623), -INT32_C(  1077169938) },
+      { -INT32_C(         342), -INT32_C(         161),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(145),
+      {  INT64_C(                 358),  INT64_C(                 140) },
+      {  INT32_C(        5120),  INT32_C(   537923601), -INT32_C(   545276977),  INT32_C(   402521085) },
+      {  INT32_C(        5120),  INT32_C(         210),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 13),
+      { -INT64_C(                 472),  INT64_C(                 172) },
+      {  INT32_C(  1612709888),  INT32_C(  1073741828),  INT32_C(    58724608),  INT32_C(    79824896) },
+      {  INT32_C(  1612709888),  INT32_C(         258),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde_mm_mask_i64scatter_epi32(&(i32_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    int32_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x4(simde_x_mm_loadu_epi32(r), simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                  82),  INT64_C(                 216) },
+      {  INT64_C( 4620693269225930768), -INT64_C( 3494798808397971761) },
+      {  INT64_C( 4620693269225930768), -INT64_C( 3494798808397971761) } },
+    { {  INT64_C(                 122), -INT64_C(                 215) },
+      { -INT64_C( 2667917702920299684),  INT64_C(  578996571938177026) },
+      { -INT64_C( 2667917702920299684),  INT64_C(  578996571938177026) } },
+    { {  INT64_C(                 240),  INT64_C(                  59) },
+      { -INT64_C(  441370355668355073), -INT64_C(       8804976590849) },
+      { -INT64_C(  441370355668355073), -INT64_C(       8804976590849) } },
+    { {  INT64_C(                 205), -INT64_C(                  30) },
+      {  INT64_C( 8464574560950550279), -INT64_C(  473037636956897033) },
+      {  INT64_C( 8464574560950550279), -INT64_C(  473037636956897033) } },
+    { {  INT64_C(                 223),  INT64_C(                 105) },
+      { -INT64_C(      13469018488881),  INT64_C( 4789746732535530842) },
+      { -INT64_C(      13469018488881),  INT64_C( 4789746732535530842) } },
+    { {  INT64_C(                 182),  INT64_C(                  32) },
+      { -INT64_C(   10142034858935827),  INT64_C( 6714835399799782655) },
+      { -INT64_C(   10142034858935827),  INT64_C( 6714835399799782655) } },
+    { {  INT64_C(                   9), -INT64_C(                 129) },
+      { -INT64_C( 1191219693625540615), -INT64_C(  779590829214488560) },
+      { -INT64_C( 1191219693625540615), -INT64_C(  779590829214488560) } },
+    { { -INT64_C(                 225),  INT64_C(                   8) },
+      { -INT64_C(  216315718692919307),  INT64_C( 2305847478127952384) },
+      { -INT64_C(  216315718692919307),  INT64_C( 2305847478127952384) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde_mm_i64scatter_epi64(&(i64_buffer[2048]), vindex, a, 8);
+
+    int64_t r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x2(simde_x_mm_loadu_epi64(r), simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                 302),  INT64_C(                 400) },
+      {  INT64_C( 4688497213055395627),  INT64_C( 4547077421931634741) },
+      {  INT64_C( 4688497213055395627),  INT64_C( 4547077421931634741) } },
+    { UINT8_C(201),
+      { -INT64_C(                   8), -INT64_C(                 408) },
+      { -INT64_C( 6514983550082457043),  INT64_C( 2377903901786505281) },
+      { -INT64_C( 6514983550082457043), -INT64_C(        876173328588) } },
+    { UINT8_C(212),
+      { -INT64_C(                 220),  INT64_C(                 364) },
+      { -INT64_C(       6597698914321),  INT64_C( 8794140290110858278) },
+      { -INT64_C(        472446402670),  INT64_C(        781684048054) } },
+    { UINT8_C(200),
+      { -INT64_C(                 164), -INT64_C(                 164) },
+      {  INT64_C(  577586657646116864),  INT64_C( 2306058814174838784) },
+      { -INT64_C(        352187318354), -INT64_C(        352187318354) } },
+    { UINT8_C( 80),
+      { -INT64_C(                 296),  INT64_C(                 212) },
+      {  INT64_C(  288309541257347080), -INT64_C( 5765453322391651330) },
+      { -INT64_C(        635655159956),  INT64_C(        455266533482) } },
+    { UINT8_C(220),
+      { -INT64_C(                 234),  INT64_C(                 116) },
+      { -INT64_C( 2324983308839143437), -INT64_C( 1711427489082686573) },
+      { -INT64_C(        502511173749),  INT64_C(        249108103226) } },
+    { UINT8_C(229),
+      {  INT64_C(                 118), -INT64_C(                 256) },
+      {  INT64_C( 3287510284277856827), -INT64_C( 2324156749764003970) },
+      {  INT64_C( 3287510284277856827), -INT64_C(        549755814016) } },
+    { UINT8_C(186),
+      {  INT64_C(                 190), -INT64_C(                 326) },
+      { -INT64_C( 1152927551920828417), -INT64_C( 3614721800888195579) },
+      {  INT64_C(        408021893215), -INT64_C( 3614721800888195579) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde_mm_mask_i64scatter_epi64(&(i64_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    int64_t r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x2(simde_x_mm_loadu_epi64(r), simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { -INT64_C(                  80),  INT64_C(                  32) },
+      { SIMDE_FLOAT32_C(  2286.00), SIMDE_FLOAT32_C(  3343.75), SIMDE_FLOAT32_C(  1725.50), SIMDE_FLOAT32_C(   296.75) },
+      { SIMDE_FLOAT32_C(  2286.00), SIMDE_FLOAT32_C(  3343.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { {  INT64_C(                  63),  INT64_C(                  63) },
+      { SIMDE_FLOAT32_C( -7622.25), SIMDE_FLOAT32_C(  4657.75), SIMDE_FLOAT32_C(  5769.50), SIMDE_FLOAT32_C( -6964.00) },
+      { SIMDE_FLOAT32_C(  4657.75), SIMDE_FLOAT32_C(  4657.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { -INT64_C(                 108),  INT64_C(                 144) },
+      { SIMDE_FLOAT32_C( -3164.75), SIMDE_FLOAT32_C( -4972.50), SIMDE_FLOAT32_C(  9735.50), SIMDE_FLOAT32_C(  7795.50) },
+      { SIMDE_FLOAT32_C( -3164.75), SIMDE_FLOAT32_C( -4972.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { -INT64_C(                 193),  INT64_C(                 125) },
+      { SIMDE_FLOAT32_C( -7887.75), SIMDE_FLOAT32_C(  5074.00), SIMDE_FLOAT32_C( -8177.75), SIMDE_FLOAT32_C( -6173.00) },
+      { SIMDE_FLOAT32_C( -7887.75), SIMDE_FLOAT32_C(  5074.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { {  INT64_C(                 225),  INT64_C(                 123) },
+      { SIMDE_FLOAT32_C( -9861.00), SIMDE_FLOAT32_C(   102.75), SIMDE_FLOAT32_C(  7887.00), SIMDE_FLOAT32_C(  3900.50) },
+      { SIMDE_FLOAT32_C( -9861.00), SIMDE_FLOAT32_C(   102.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { {  INT64_C(                  77), -INT64_C(                 184) },
+      { SIMDE_FLOAT32_C(  5932.75), SIMDE_FLOAT32_C(  9431.25), SIMDE_FLOAT32_C( -8260.25), SIMDE_FLOAT32_C( -6800.75) },
+      { SIMDE_FLOAT32_C(  5932.75), SIMDE_FLOAT32_C(  9431.25), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { -INT64_C(                 101),  INT64_C(                 214) },
+      { SIMDE_FLOAT32_C(  4272.00), SIMDE_FLOAT32_C(  -889.25), SIMDE_FLOAT32_C( -9208.25), SIMDE_FLOAT32_C(  8842.50) },
+      { SIMDE_FLOAT32_C(  4272.00), SIMDE_FLOAT32_C(  -889.25), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { {  INT64_C(                 114),  INT64_C(                 114) },
+      { SIMDE_FLOAT32_C(    92.00), SIMDE_FLOAT32_C( -7006.00), SIMDE_FLOAT32_C(   610.25), SIMDE_FLOAT32_C( -6797.75) },
+      { SIMDE_FLOAT32_C( -7006.00), SIMDE_FLOAT32_C( -7006.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_mm_i64scatter_ps(&(f32_buffer[2048]), vindex, a, 4);
+
+    simde_float32 r[4] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x4(simde_mm_loadu_ps(r), simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                 624),  INT64_C(                 228) },
+      { SIMDE_FLOAT32_C(  3725.25), SIMDE_FLOAT32_C(  7629.00), SIMDE_FLOAT32_C(  8012.25), SIMDE_FLOAT32_C( -8690.75) },
+      { SIMDE_FLOAT32_C(  3725.25), SIMDE_FLOAT32_C(  7629.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(209),
+      { -INT64_C(                 480), -INT64_C(                 480) },
+      { SIMDE_FLOAT32_C(   643.50), SIMDE_FLOAT32_C(  9352.50), SIMDE_FLOAT32_C(  4309.00), SIMDE_FLOAT32_C(  4494.50) },
+      { SIMDE_FLOAT32_C(   643.50), SIMDE_FLOAT32_C(   643.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(108),
+      {  INT64_C(                 268), -INT64_C(                 196) },
+      { SIMDE_FLOAT32_C(  1954.00), SIMDE_FLOAT32_C(   641.25), SIMDE_FLOAT32_C(  3908.00), SIMDE_FLOAT32_C(  2803.25) },
+      { SIMDE_FLOAT32_C(    33.50), SIMDE_FLOAT32_C(   -24.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(145),
+      { -INT64_C(                 656),  INT64_C(                 548) },
+      { SIMDE_FLOAT32_C( -2774.25), SIMDE_FLOAT32_C(  6076.25), SIMDE_FLOAT32_C( -3381.75), SIMDE_FLOAT32_C( -3829.25) },
+      { SIMDE_FLOAT32_C( -2774.25), SIMDE_FLOAT32_C(    68.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(248),
+      { -INT64_C(                 396),  INT64_C(                  64) },
+      { SIMDE_FLOAT32_C(  1949.75), SIMDE_FLOAT32_C( -1078.75), SIMDE_FLOAT32_C(  5032.75), SIMDE_FLOAT32_C(  6159.75) },
+      { SIMDE_FLOAT32_C(   -49.50), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 61),
+      {  INT64_C(                 428),  INT64_C(                 428) },
+      { SIMDE_FLOAT32_C(     3.25), SIMDE_FLOAT32_C(  -156.50), SIMDE_FLOAT32_C(  5221.50), SIMDE_FLOAT32_C(  7028.50) },
+      { SIMDE_FLOAT32_C(     3.25), SIMDE_FLOAT32_C(     3.25), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(245),
+      {  INT64_C(                  24), -INT64_C(                 848) },
+      { SIMDE_FLOAT32_C(  5628.25), SIMDE_FLOAT32_C( -1276.75), SIMDE_FLOAT32_C(  1369.50), SIMDE_FLOAT32_C(  5398.00) },
+      { SIMDE_FLOAT32_C(  5628.25), SIMDE_FLOAT32_C(  -106.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(210),
+      {  INT64_C(                 988),  INT64_C(                 988) },
+      { SIMDE_FLOAT32_C(  4980.50), SIMDE_FLOAT32_C(  2459.00), SIMDE_FLOAT32_C(  8951.25), SIMDE_FLOAT32_C(  3727.75) },
+      { SIMDE_FLOAT32_C(  2459.00), SIMDE_FLOAT32_C(  2459.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_mm_mask_i64scatter_ps(&(f32_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    simde_float32 r[4] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x4(simde_mm_loadu_ps(r), simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { -INT64_C(                 214),  INT64_C(                  81) },
+      { SIMDE_FLOAT64_C( -3987.25), SIMDE_FLOAT64_C(  7826.75) },
+      { SIMDE_FLOAT64_C( -3987.25), SIMDE_FLOAT64_C(  7826.75) } },
+    { { -INT64_C(                  17), -INT64_C(                  17) },
+      { SIMDE_FLOAT64_C(  1512.75), SIMDE_FLOAT64_C( -3098.50) },
+      { SIMDE_FLOAT64_C( -3098.50), SIMDE_FLOAT64_C( -3098.50) } },
+    { {  INT64_C(                 194),  INT64_C(                  59) },
+      { SIMDE_FLOAT64_C(  4827.25), SIMDE_FLOAT64_C( -1870.00) },
+      { SIMDE_FLOAT64_C(  4827.25), SIMDE_FLOAT64_C( -1870.00) } },
+    { {  INT64_C(                 133), -INT64_C(                 218) },
+      { SIMDE_FLOAT64_C( -9022.50), SIMDE_FLOAT64_C( -4842.75) },
+      { SIMDE_FLOAT64_C( -9022.50), SIMDE_FLOAT64_C( -4842.75) } },
+    { {  INT64_C(                 208),  INT64_C(                  85) },
+      { SIMDE_FLOAT64_C( -5896.75), SIMDE_FLOAT64_C(  6374.50) },
+      { SIMDE_FLOAT64_C( -5896.75), SIMDE_FLOAT64_C(  6374.50) } },
+    { {  INT64_C(                 194), -INT64_C(                 116) },
+      { SIMDE_FLOAT64_C( -9197.25), SIMDE_FLOAT64_C( -6230.00) },
+      { SIMDE_FLOAT64_C( -9197.25), SIMDE_FLOAT64_C( -6230.00) } },
+    { { -INT64_C(                 216), -INT64_C(                 238) },
+      { SIMDE_FLOAT64_C( -8299.50), SIMDE_FLOAT64_C(  2219.50) },
+      { SIMDE_FLOAT64_C( -8299.50), SIMDE_FLOAT64_C(  2219.50) } },
+    { {  INT64_C(                  68),  INT64_C(                 248) },
+      { SIMDE_FLOAT64_C(  8533.75), SIMDE_FLOAT64_C( -6034.50) },
+      { SIMDE_FLOAT64_C(  8533.75), SIMDE_FLOAT64_C( -6034.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_mm_i64scatter_pd(&(f64_buffer[2048]), vindex, a, 8);
+
+    simde_float64 r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x2(simde_mm_loadu_pd(r), simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT64_C(                 124), -INT64_C(                 764) },
+      { SIMDE_FLOAT64_C(  4935.75), SIMDE_FLOAT64_C( -5102.00) },
+      { SIMDE_FLOAT64_C(  4935.75), SIMDE_FLOAT64_C( -5102.00) } },
+    { UINT8_C(  8),
+      { -INT64_C(                 436), -INT64_C(                 436) },
+      { SIMDE_FLOAT64_C(  8723.50), SIMDE_FLOAT64_C(  2426.25) },
+      { SIMDE_FLOAT64_C(   -27.25), SIMDE_FLOAT64_C(   -27.25) } },
+    { UINT8_C( 73),
+      { -INT64_C(                 460), -INT64_C(                 416) },
+      { SIMDE_FLOAT64_C(  -192.75), SIMDE_FLOAT64_C(  3615.00) },
+      { SIMDE_FLOAT64_C(  -192.75), SIMDE_FLOAT64_C(   -26.00) } },
+    { UINT8_C(119),
+      { -INT64_C(                 188),  INT64_C(                 544) },
+      { SIMDE_FLOAT64_C( -7099.25), SIMDE_FLOAT64_C(    29.00) },
+      { SIMDE_FLOAT64_C( -7099.25), SIMDE_FLOAT64_C(    29.00) } },
+    { UINT8_C(103),
+      { -INT64_C(                 964),  INT64_C(                 776) },
+      { SIMDE_FLOAT64_C( -4071.25), SIMDE_FLOAT64_C(  9938.00) },
+      { SIMDE_FLOAT64_C( -4071.25), SIMDE_FLOAT64_C(  9938.00) } },
+    { UINT8_C(120),
+      {  INT64_C(                 576),  INT64_C(                 416) },
+      { SIMDE_FLOAT64_C( -9018.50), SIMDE_FLOAT64_C(  2794.50) },
+      { SIMDE_FLOAT64_C(    36.00), SIMDE_FLOAT64_C(    26.00) } },
+    { UINT8_C(118),
+      {  INT64_C(                 308),  INT64_C(                 852) },
+      { SIMDE_FLOAT64_C(  6489.00), SIMDE_FLOAT64_C( -7247.00) },
+      { SIMDE_FLOAT64_C(    19.25), SIMDE_FLOAT64_C( -7247.00) } },
+    { UINT8_C(  8),
+      { -INT64_C(                 996), -INT64_C(                 996) },
+      { SIMDE_FLOAT64_C(  7358.00), SIMDE_FLOAT64_C(  2562.00) },
+      { SIMDE_FLOAT64_C(   -62.25), SIMDE_FLOAT64_C(   -62.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_mm_mask_i64scatter_pd(&(f64_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    simde_float64 r[2] = { 0 };
+    for (size_t j = 0 ; j < 2 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x2(simde_mm_loadu_pd(r), simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(         128),  INT32_C(          12), -INT32_C(         254),  INT32_C(         162),  INT32_C(         248), -INT32_C(         135), -INT32_C(         217), -INT32_C(          19) },
+      {  INT32_C(  1144860111), -INT32_C(   289411073),  INT32_C(  1855985965), -INT32_C(  1216349189),  INT32_C(  2091081554),  INT32_C(  2127043123), -INT32_C(   775150156),  INT32_C(           0) },
+      {  INT32_C(  1144860111), -INT32_C(   289411073),  INT32_C(  1855985965), -INT32_C(  1216349189),  INT32_C(  2091081554),  INT32_C(  2127043123), -INT32_C(   775150156),  INT32_C(           0) } },
+    { { -INT32_C(         213),  INT32_C(          72),  INT32_C(         130),  INT32_C(          63),  INT32_C(          26),  INT32_C(         130), -INT32_C(         134), -INT32_C(         224) },
+      {  INT32_C(   576605709),  INT32_C(  2129911807),  INT32_C(   955354414), -INT32_C(  1509070952), -INT32_C(  1736954609), -INT32_C(  1726287134), -INT32_C(  2131766209),  INT32_C(     4195328) },
+      {  INT32_C(   576605709),  INT32_C(  2129911807), -INT32_C(  1726287134), -INT32_C(  1509070952), -INT32_C(  1736954609), -INT32_C(  1726287134), -INT32_C(  2131766209),  INT32_C(     4195328) } },
+    { {  INT32_C(          75),  INT32_C(         254), -INT32_C(         123),  INT32_C(         249), -INT32_C(          40), -INT32_C(         103), -INT32_C(         248), -INT32_C(         141) },
+      { -INT32_C(  1630044161),  INT32_C(  1073741824), -INT32_C(    25200673),  INT32_C(  2128609275),  INT32_C(  1877475325), -INT32_C(       65801),  INT32_C(  1074003969),  INT32_C(  1600016663) },
+      { -INT32_C(  1630044161),  INT32_C(  1073741824), -INT32_C(    25200673),  INT32_C(  2128609275),  INT32_C(  1877475325), -INT32_C(       65801),  INT32_C(  1074003969),  INT32_C(  1600016663) } },
+    { { -INT32_C(         167), -INT32_C(         167),  INT32_C(         128),  INT32_C(         150),  INT32_C(         172),  INT32_C(         128),  INT32_C(          21), -INT32_C(          38) },
+      { -INT32_C(  1563009664), -INT32_C(   537264129), -INT32_C(  1809758520),  INT32_C(  2130961515),  INT32_C(  2142220281),  INT32_C(  1610743840), -INT32_C(   650524179), -INT32_C(  1571027060) },
+      { -INT32_C(   537264129), -INT32_C(   537264129),  INT32_C(  1610743840),  INT32_C(  2130961515),  INT32_C(  2142220281),  INT32_C(  1610743840), -INT32_C(   650524179), -INT32_C(  1571027060) } },
+    { { -INT32_C(         176), -INT32_C(         176), -INT32_C(          29), -INT32_C(         198), -INT32_C(         158), -INT32_C(         185),  INT32_C(         160), -INT32_C(         113) },
+      { -INT32_C(    10650625),  INT32_C(      262168),  INT32_C(  1090519588),  INT32_C(       18944), -INT32_C(   483527777),  INT32_C(   757569700), -INT32_C(   151027729),  INT32_C(   579587871) },
+      {  INT32_C(      262168),  INT32_C(      262168),  INT32_C(  1090519588),  INT32_C(       18944), -INT32_C(   483527777),  INT32_C(   757569700), -INT32_C(   151027729),  INT32_C(   579587871) } },
+    { { -INT32_C(           5), -INT32_C(          41),  INT32_C(          13), -INT32_C(          41), -INT32_C(           1), -INT32_C(          41), -INT32_C(         247),  INT32_C(          13) },
+      {  INT32_C(  1392500470),  INT32_C(  1042958946),  INT32_C(           0),  INT32_C(    54559008),  INT32_C(   793328799), -INT32_C(  2071981568), -INT32_C(   148999694),  INT32_C(     1048576) },
+      {  INT32_C(  1392500470), -INT32_C(  2071981568),  INT32_C(     1048576), -INT32_C(  2071981568),  INT32_C(   793328799), -INT32_C(  2071981568), -INT32_C(   148999694),  INT32_C(     1048576) } },
+    { {  INT32_C(         250),  INT32_C(          66),  INT32_C(         211), -INT32_C(          16),  INT32_C(         238),  INT32_C(          43),  INT32_C(          90),  INT32_C(          77) },
+      { -INT32_C(  1449292357),  INT32_C(   950183346), -INT32_C(       16513), -INT32_C(  1073444864), -INT32_C(  1946909188), -INT32_C(   428364366), -INT32_C(       20513),  INT32_C(   134479878) },
+      { -INT32_C(  1449292357),  INT32_C(   950183346), -INT32_C(       16513), -INT32_C(  1073444864), -INT32_C(  1946909188), -INT32_C(   428364366), -INT32_C(       20513),  INT32_C(   134479878) } },
+    { {  INT32_C(         222),  INT32_C(         231), -INT32_C(         131), -INT32_C(         109), -INT32_C(         137),  INT32_C(         156), -INT32_C(          55),  INT32_C(         247) },
+      { -INT32_C(   268435457), -INT32_C(  1737109291), -INT32_C(   544752785),  INT32_C(    13705344), -INT32_C(    21521413), -INT32_C(    83894337), -INT32_C(   363865703),  INT32_C(     1706116) },
+      { -INT32_C(   268435457), -INT32_C(  1737109291), -INT32_C(   544752785),  INT32_C(    13705344), -INT32_C(    21521413), -INT32_C(    83894337), -INT32_C(   363865703),  INT32_C(     1706116) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde_mm256_i32scatter_epi32(&(i32_buffer[2048]), vindex, a, 4);
+
+    int32_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x8(simde_x_mm256_loadu_epi32(r), simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT32_C(          89), -INT32_C(          70), -INT32_C(         170), -INT32_C(         197), -INT32_C(         211),  INT32_C(         219),  INT32_C(         142), -INT32_C(         231) },
+      {  INT32_C(     4210848), -INT32_C(    23226552), -INT32_C(  2144441555),  INT32_C(  1125678296), -INT32_C(     2171009),  INT32_C(   554423134),  INT32_C(   117871106),  INT32_C(  2113928191) },
+      {  INT32_C(     4210848), -INT32_C(    23226552), -INT32_C(  2144441555),  INT32_C(  1125678296), -INT32_C(     2171009),  INT32_C(   554423134),  INT32_C(   117871106),  INT32_C(  2113928191) } },
+    { UINT8_C(254),
+      {  INT32_C(         253), -INT32_C(          68),  INT32_C(         163), -INT32_C(         196),  INT32_C(         163), -INT32_C(         196),  INT32_C(         118), -INT32_C(          30) },
+      {  INT32_C(           2), -INT32_C(  1760317833), -INT32_C(   272781507),  INT32_C(  1074085910), -INT32_C(  1496820875), -INT32_C(  1097104207),  INT32_C(  1993387270),  INT32_C(   228191460) },
+      {  INT32_C(         759), -INT32_C(  1760317833), -INT32_C(  1496820875), -INT32_C(  1097104207), -INT32_C(  1496820875), -INT32_C(  1097104207),  INT32_C(  1993387270),  INT32_C(   228191460) } },
+    { UINT8_C( 85),
+      { -INT32_C(         233),  INT32_C(          82), -INT32_C(         255),  INT32_C(          18),  INT32_C(         236), -INT32_C(          79), -INT32_C(          71), -INT32_C(          64) },
+      {  INT32_C(     8389192), -INT32_C(   999661943), -INT32_C(  2116950954),  INT32_C(       65536),  INT32_C(   655336703),  INT32_C(  2017765234),  INT32_C(  1007549390),  INT32_C(  1806171569) },
+      {  INT32_C(     8389192),  INT32_C(         246), -INT32_C(  2116950954),  INT32_C(          54),  INT32_C(   655336703), -INT32_C(         237),  INT32_C(  1007549390), -INT32_C(         192) } },
+    { UINT8_C( 44),
+      { -INT32_C(         125), -INT32_C(         125),  INT32_C(          98),  INT32_C(          73),  INT32_C(         235),  INT32_C(          73),  INT32_C(          73), -INT32_C(         156) },
+      {  INT32_C(  1337255394), -INT32_C(   134266881), -INT32_C(     1065985),  INT32_C(     1310724),  INT32_C(   537920000), -INT32_C(  1866719329), -INT32_C(     8523333), -INT32_C(   748978677) },
+      { -INT32_C(         375), -INT32_C(         375), -INT32_C(     1065985), -INT32_C(  1866719329),  INT32_C(         705), -INT32_C(  1866719329), -INT32_C(  1866719329), -INT32_C(         468) } },
+    { UINT8_C(116),
+      { -INT32_C(          29),  INT32_C(          11),  INT32_C(          40),  INT32_C(          75),  INT32_C(         136), -INT32_C(          73), -INT32_C(          81),  INT32_C(         216) },
+      {  INT32_C(   852987623), -INT32_C(   402654225), -INT32_C(     4194345), -INT32_C(  1877974976),  INT32_C(  1109393408),  INT32_C(           8), -INT32_C(   479956619), -INT32_C(  2031967322) },
+      { -INT32_C(          87),  INT32_C(          33), -INT32_C(     4194345),  INT32_C(         225),  INT32_C(  1109393408),  INT32_C(           8), -INT32_C(   479956619),  INT32_C(         648) } },
+    { UINT8_C( 54),
+      { -INT32_C(          16),  INT32_C(         237), -INT32_C(         174),  INT32_C(          42),  INT32_C(          99),  INT32_C(          99),  INT32_C(         143), -INT32_C(         174) },
+      {  INT32_C(  1856801772),  INT32_C(   138420224), -INT32_C(        1153), -INT32_C(   805974612), -INT32_C(    30134908), -INT32_C(  1618156509),  INT32_C(     2359296),  INT32_C(   404480866) },
+      { -INT32_C(          48),  INT32_C(   138420224), -INT32_C(        1153),  INT32_C(         126), -INT32_C(  1618156509), -INT32_C(  1618156509),  INT32_C(         429), -INT32_C(        1153) } },
+    { UINT8_C(145),
+      {  INT32_C(         161), -INT32_C(         217),  INT32_C(         215),  INT32_C(         114), -INT32_C(         153),  INT32_C(         230), -INT32_C(         215),  INT32_C(          70) },
+      { -INT32_C(   402653622),  INT32_C(   168886272),  INT32_C(      729344), -INT32_C(     4980741),  INT32_C(  1880358976),  INT32_C(     8390656), -INT32_C(   545144571),  INT32_C(   119510662) },
+      { -INT32_C(   402653622), -INT32_C(         651),  INT32_C(         645),  INT32_C(         342),  INT32_C(  1880358976),  INT32_C(         690), -INT32_C(         645),  INT32_C(   119510662) } },
+    { UINT8_C(137),
+      { -INT32_C(          45), -INT32_C(          45), -INT32_C(          44), -INT32_C(          45),  INT32_C(         134), -INT32_C(          44),  INT32_C(         199),  INT32_C(         199) },
+      {  INT32_C(           0), -INT32_C(   781143709),  INT32_C(   387477282),  INT32_C(   853849050),  INT32_C(     2245440),  INT32_C(     4210705),  INT32_C(     4223009), -INT32_C(  1538907180) },
+      {  INT32_C(   853849050),  INT32_C(   853849050), -INT32_C(         132),  INT32_C(   853849050),  INT32_C(         402), -INT32_C(         132), -INT32_C(  1538907180), -INT32_C(  1538907180) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde_mm256_mask_i32scatter_epi32(&(i32_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    int32_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x8(simde_x_mm256_loadu_epi32(r), simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(         222),  INT32_C(         151),  INT32_C(         205),  INT32_C(         108) },
+      { -INT64_C( 4616191817146173709),  INT64_C( 1653729723154803736),  INT64_C(  937874630991937802),  INT64_C( 6827455231138200383) },
+      { -INT64_C( 4616191817146173709),  INT64_C( 1653729723154803736),  INT64_C(  937874630991937802),  INT64_C( 6827455231138200383) } },
+    { {  INT32_C(         158),  INT32_C(         158),  INT32_C(         158), -INT32_C(         105) },
+      {  INT64_C(    9359042975631392), -INT64_C( 9214083348630994431), -INT64_C(   72092787001526273),  INT64_C( 2646293292796681206) },
+      { -INT64_C(   72092787001526273), -INT64_C(   72092787001526273), -INT64_C(   72092787001526273),  INT64_C( 2646293292796681206) } },
+    { { -INT32_C(         251),  INT32_C(         105), -INT32_C(          56), -INT32_C(          56) },
+      { -INT64_C( 2189447615893753897),  INT64_C(     105566137483298), -INT64_C( 4765965096287469571),  INT64_C( 1513440083627879170) },
+      { -INT64_C( 2189447615893753897),  INT64_C(     105566137483298),  INT64_C( 1513440083627879170),  INT64_C( 1513440083627879170) } },
+    { {  INT32_C(          17), -INT32_C(          73),  INT32_C(         253),  INT32_C(          17) },
+      { -INT64_C( 8396325094296835349), -INT64_C( 1193453970106880009),  INT64_C(           822091776), -INT64_C( 1021997764998771556) },
+      { -INT64_C( 1021997764998771556), -INT64_C( 1193453970106880009),  INT64_C(           822091776), -INT64_C( 1021997764998771556) } },
+    { { -INT32_C(          51), -INT32_C(         187), -INT32_C(         149),  INT32_C(         109) },
+      {  INT64_C( 2344128017515741202), -INT64_C(  578747770983162945),  INT64_C( 8097655710560538511),  INT64_C( 4611686018700320772) },
+      {  INT64_C( 2344128017515741202), -INT64_C(  578747770983162945),  INT64_C( 8097655710560538511),  INT64_C( 4611686018700320772) } },
+    { { -INT32_C(         138), -INT32_C(         204), -INT32_C(         204),  INT32_C(           3) },
+      {  INT64_C(   23824260917168640),  INT64_C( 4509453219755539446),  INT64_C( 7159751073531976235), -INT64_C( 1803990856437428493) },
+      {  INT64_C(   23824260917168640),  INT64_C( 7159751073531976235),  INT64_C( 7159751073531976235), -INT64_C( 1803990856437428493) } },
+    { {  INT32_C(         216),  INT32_C(         179), -INT32_C(         232),  INT32_C(           0) },
+      {  INT64_C( 2904822584288739328), -INT64_C( 4900527860483097603),  INT64_C( 8948058641186176040),  INT64_C(    1759356244721688) },
+      {  INT64_C( 2904822584288739328), -INT64_C( 4900527860483097603),  INT64_C( 8948058641186176040),  INT64_C(    1759356244721688) } },
+    { { -INT32_C(          23), -INT32_C(          61), -INT32_C(         161), -INT32_C(          61) },
+      {  INT64_C( 3400230074966284739),  INT64_C(  670402761400754993),  INT64_C( 2306687444932628754),  INT64_C( 6192961715986050839) },
+      {  INT64_C( 3400230074966284739),  INT64_C( 6192961715986050839),  INT64_C( 2306687444932628754),  INT64_C( 6192961715986050839) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde_mm256_i32scatter_epi64(&(i64_buffer[2048]), vindex, a, 8);
+
+    int64_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x4(simde_x_mm256_loadu_epi64(r), simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT32_C(        1968),  INT32_C(         160), -INT32_C(         392), -INT32_C(        1872) },
+      { -INT64_C( 3453291188719384114), -INT64_C( 6865533390844645670), -INT64_C( 2138177495950185386),  INT64_C(  108649342088250369) },
+      { -INT64_C( 3453291188719384114), -INT64_C( 6865533390844645670), -INT64_C( 2138177495950185386),  INT64_C(  108649342088250369) } },
+    { UINT8_C( 81),
+      {  INT32_C(         496), -INT32_C(        1752), -INT32_C(          24), -INT32_C(        1440) },
+      {  INT64_C( 9223347847393443247), -INT64_C( 7650629574023274156), -INT64_C( 6599488611315666574),  INT64_C( 1486880973667019754) },
+      {  INT64_C( 9223347847393443247), -INT64_C(        940597838043), -INT64_C(         12884901891), -INT64_C(        773094113460) } },
+    { UINT8_C(215),
+      {  INT32_C(        1736),  INT32_C(        1416), -INT32_C(         976),  INT32_C(        1448) },
+      {  INT64_C( 1153152402048713730), -INT64_C( 2305913378093141505), -INT64_C( 8628861695226801918), -INT64_C( 5209408955413261931) },
+      {  INT64_C( 1153152402048713730), -INT64_C( 2305913378093141505), -INT64_C( 8628861695226801918),  INT64_C(        777389080757) } },
+    { UINT8_C( 56),
+      { -INT32_C(        1264), -INT32_C(        1264),  INT32_C(         192), -INT32_C(        1400) },
+      { -INT64_C(    4803872066441292), -INT64_C( 4883159926879437568),  INT64_C(  154292336506048512),  INT64_C( 3625031190648107265) },
+      { -INT64_C(        678604832926), -INT64_C(        678604832926),  INT64_C(        103079215128),  INT64_C( 3625031190648107265) } },
+    { UINT8_C(211),
+      { -INT32_C(        1168), -INT32_C(        1696),  INT32_C(         368),  INT32_C(        1376) },
+      { -INT64_C(         42967597569),  INT64_C( 3486025230919181837),  INT64_C(  580986376523087872), -INT64_C( 2161229673308702650) },
+      { -INT64_C(         42967597569),  INT64_C( 3486025230919181837),  INT64_C(        197568495662),  INT64_C(        738734375084) } },
+    { UINT8_C( 52),
+      {  INT32_C(        1840),  INT32_C(        1840),  INT32_C(         688),  INT32_C(         192) },
+      { -INT64_C( 3886606478420213632), -INT64_C( 1223966287665541761), -INT64_C( 8605475679477597493), -INT64_C(   18014398551427137) },
+      {  INT64_C(        987842478310),  INT64_C(        987842478310), -INT64_C( 8605475679477597493),  INT64_C(        103079215128) } },
+    { UINT8_C(209),
+      {  INT32_C(         760),  INT32_C(         880), -INT32_C(        1960),  INT32_C(         848) },
+      { -INT64_C( 3211401053012197614),  INT64_C( 3353763743321967223),  INT64_C( 1171217929996599296),  INT64_C(    4611626920715392) },
+      { -INT64_C( 3211401053012197614),  INT64_C(        472446402670), -INT64_C(       1052266987765),  INT64_C(        455266533482) } },
+    { UINT8_C( 84),
+      { -INT32_C(        1352), -INT32_C(        1352), -INT32_C(        1352), -INT32_C(        2024) },
+      { -INT64_C( 4978311589388428421),  INT64_C( 3517777420213771936),  INT64_C( 9171824753292117855),  INT64_C(  383261845708200394) },
+      {  INT64_C( 9171824753292117855),  INT64_C( 9171824753292117855),  INT64_C( 9171824753292117855), -INT64_C(       1086626726141) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde_mm256_mask_i32scatter_epi64(&(i64_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    int64_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x4(simde_x_mm256_loadu_epi64(r), simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { {  INT32_C(         102), -INT32_C(         230), -INT32_C(          23), -INT32_C(         223), -INT32_C(         168), -INT32_C(         245),  INT32_C(          14),  INT32_C(         241) },
+      { SIMDE_FLOAT32_C( -3171.25), SIMDE_FLOAT32_C(  3011.00), SIMDE_FLOAT32_C(   349.25), SIMDE_FLOAT32_C( -3338.00),
+        SIMDE_FLOAT32_C( -1056.25), SIMDE_FLOAT32_C(  1777.50), SIMDE_FLOAT32_C(  4791.75), SIMDE_FLOAT32_C( -2919.00) },
+      { SIMDE_FLOAT32_C( -3171.25), SIMDE_FLOAT32_C(  3011.00), SIMDE_FLOAT32_C(   349.25), SIMDE_FLOAT32_C( -3338.00),
+        SIMDE_FLOAT32_C( -1056.25), SIMDE_FLOAT32_C(  1777.50), SIMDE_FLOAT32_C(  4791.75), SIMDE_FLOAT32_C( -2919.00) } },
+    { { -INT32_C(         217), -INT32_C(          81), -INT32_C(         217), -INT32_C(         175), -INT32_C(          22), -INT32_C(         175), -INT32_C(         194),  INT32_C(          84) },
+      { SIMDE_FLOAT32_C( -3226.75), SIMDE_FLOAT32_C(  2807.75), SIMDE_FLOAT32_C( -6193.25), SIMDE_FLOAT32_C(  7929.50),
+        SIMDE_FLOAT32_C( -8092.50), SIMDE_FLOAT32_C(    74.50), SIMDE_FLOAT32_C(  9808.50), SIMDE_FLOAT32_C(  2067.25) },
+      { SIMDE_FLOAT32_C( -6193.25), SIMDE_FLOAT32_C(  2807.75), SIMDE_FLOAT32_C( -6193.25), SIMDE_FLOAT32_C(    74.50),
+        SIMDE_FLOAT32_C( -8092.50), SIMDE_FLOAT32_C(    74.50), SIMDE_FLOAT32_C(  9808.50), SIMDE_FLOAT32_C(  2067.25) } },
+    { {  INT32_C(         141), -INT32_C(          39), -INT32_C(          71),  INT32_C(         148), -INT32_C(         116),  INT32_C(          40),  INT32_C(           1), -INT32_C(          92) },
+      { SIMDE_FLOAT32_C(  7832.25), SIMDE_FLOAT32_C(  8302.75), SIMDE_FLOAT32_C(  8259.00), SIMDE_FLOAT32_C( -6485.75),
+        SIMDE_FLOAT32_C(  5537.00), SIMDE_FLOAT32_C(  4148.00), SIMDE_FLOAT32_C(  1621.00), SIMDE_FLOAT32_C( -6756.50) },
+      { SIMDE_FLOAT32_C(  7832.25), SIMDE_FLOAT32_C(  8302.75), SIMDE_FLOAT32_C(  8259.00), SIMDE_FLOAT32_C( -6485.75),
+        SIMDE_FLOAT32_C(  5537.00), SIMDE_FLOAT32_C(  4148.00), SIMDE_FLOAT32_C(  1621.00), SIMDE_FLOAT32_C( -6756.50) } },
+    { {  INT32_C(         106),  INT32_C(         106),  INT32_C(         141), -INT32_C(         148), -INT32_C(           4), -INT32_C(         148),  INT32_C(         182),  INT32_C(         182) },
+      { SIMDE_FLOAT32_C( -1802.25), SIMDE_FLOAT32_C(  4506.25), SIMDE_FLOAT32_C( -5888.25), SIMDE_FLOAT32_C(   912.00),
+        SIMDE_FLOAT32_C( -3665.50), SIMDE_FLOAT32_C(  2703.75), SIMDE_FLOAT32_C( -8423.00), SIMDE_FLOAT32_C(  6038.00) },
+      { SIMDE_FLOAT32_C(  4506.25), SIMDE_FLOAT32_C(  4506.25), SIMDE_FLOAT32_C( -5888.25), SIMDE_FLOAT32_C(  2703.75),
+        SIMDE_FLOAT32_C( -3665.50), SIMDE_FLOAT32_C(  2703.75), SIMDE_FLOAT32_C(  6038.00), SIMDE_FLOAT32_C(  6038.00) } },
+    { {  INT32_C(         226),  INT32_C(         148),  INT32_C(         249), -INT32_C(          94),  INT32_C(          82), -INT32_C(         117),  INT32_C(         126), -INT32_C(         213) },
+      { SIMDE_FLOAT32_C(  1669.25), SIMDE_FLOAT32_C( -8096.75), SIMDE_FLOAT32_C(   651.75), SIMDE_FLOAT32_C(  -414.25),
+        SIMDE_FLOAT32_C( -7603.00), SIMDE_FLOAT32_C( -9364.75), SIMDE_FLOAT32_C(  -236.00), SIMDE_FLOAT32_C(  6234.00) },
+      { SIMDE_FLOAT32_C(  1669.25), SIMDE_FLOAT32_C( -8096.75), SIMDE_FLOAT32_C(   651.75), SIMDE_FLOAT32_C(  -414.25),
+        SIMDE_FLOAT32_C( -7603.00), SIMDE_FLOAT32_C( -9364.75), SIMDE_FLOAT32_C(  -236.00), SIMDE_FLOAT32_C(  6234.00) } },
+    { {  INT32_C(          45),  INT32_C(          68), -INT32_C(         103),  INT32_C(         168),  INT32_C(          34),  INT32_C(          34),  INT32_C(          34), -INT32_C(         223) },
+      { SIMDE_FLOAT32_C( -8653.25), SIMDE_FLOAT32_C( -3288.50), SIMDE_FLOAT32_C( -6456.50), SIMDE_FLOAT32_C( -9651.00),
+        SIMDE_FLOAT32_C(  4585.25), SIMDE_FLOAT32_C( -6761.75), SIMDE_FLOAT32_C( -1585.75), SIMDE_FLOAT32_C( -8911.00) },
+      { SIMDE_FLOAT32_C( -8653.25), SIMDE_FLOAT32_C( -3288.50), SIMDE_FLOAT32_C( -6456.50), SIMDE_FLOAT32_C( -9651.00),
+        SIMDE_FLOAT32_C( -1585.75), SIMDE_FLOAT32_C( -1585.75), SIMDE_FLOAT32_C( -1585.75), SIMDE_FLOAT32_C( -8911.00) } },
+    { { -INT32_C(          44), -INT32_C(         172), -INT32_C(         191),  INT32_C(         189),  INT32_C(         107),  INT32_C(          50), -INT32_C(          69), -INT32_C(         233) },
+      { SIMDE_FLOAT32_C( -3365.25), SIMDE_FLOAT32_C(  4465.75), SIMDE_FLOAT32_C(  -647.50), SIMDE_FLOAT32_C(  4555.50),
+        SIMDE_FLOAT32_C( -9456.00), SIMDE_FLOAT32_C( -6179.25), SIMDE_FLOAT32_C(  2240.00), SIMDE_FLOAT32_C( -6655.75) },
+      { SIMDE_FLOAT32_C( -3365.25), SIMDE_FLOAT32_C(  4465.75), SIMDE_FLOAT32_C(  -647.50), SIMDE_FLOAT32_C(  4555.50),
+        SIMDE_FLOAT32_C( -9456.00), SIMDE_FLOAT32_C( -6179.25), SIMDE_FLOAT32_C(  2240.00), SIMDE_FLOAT32_C( -6655.75) } },
+    { { -INT32_C(         208),  INT32_C(          32), -INT32_C(          33),  INT32_C(          32),  INT32_C(          32),  INT32_C(          99),  INT32_C(          97), -INT32_C(          33) },
+      { SIMDE_FLOAT32_C( -7324.75), SIMDE_FLOAT32_C( -3601.25), SIMDE_FLOAT32_C( -3632.25), SIMDE_FLOAT32_C( -4119.25),
+        SIMDE_FLOAT32_C( -9527.00), SIMDE_FLOAT32_C(  7302.75), SIMDE_FLOAT32_C(  8758.50), SIMDE_FLOAT32_C( -5280.25) },
+      { SIMDE_FLOAT32_C( -7324.75), SIMDE_FLOAT32_C( -9527.00), SIMDE_FLOAT32_C( -5280.25), SIMDE_FLOAT32_C( -9527.00),
+        SIMDE_FLOAT32_C( -9527.00), SIMDE_FLOAT32_C(  7302.75), SIMDE_FLOAT32_C(  8758.50), SIMDE_FLOAT32_C( -5280.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_mm256_i32scatter_ps(&(f32_buffer[2048]), vindex, a, 8);
+
+    simde_float32 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x8(simde_mm256_loadu_ps(r), simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT32_C(         140),  INT32_C(         146),  INT32_C(         498), -INT32_C(         454),  INT32_C(         262), -INT32_C(         402),  INT32_C(          46), -INT32_C(         246) },
+      { SIMDE_FLOAT32_C( -3303.75), SIMDE_FLOAT32_C( -1840.25), SIMDE_FLOAT32_C(  4067.75), SIMDE_FLOAT32_C(    -9.25),
+        SIMDE_FLOAT32_C( -9087.25), SIMDE_FLOAT32_C(  7260.00), SIMDE_FLOAT32_C( -9238.75), SIMDE_FLOAT32_C( -2959.75) },
+      { SIMDE_FLOAT32_C( -3303.75), SIMDE_FLOAT32_C( -1840.25), SIMDE_FLOAT32_C(  4067.75), SIMDE_FLOAT32_C(    -9.25),
+        SIMDE_FLOAT32_C( -9087.25), SIMDE_FLOAT32_C(  7260.00), SIMDE_FLOAT32_C( -9238.75), SIMDE_FLOAT32_C( -2959.75) } },
+    { UINT8_C(198),
+      {  INT32_C(          88), -INT32_C(          64),  INT32_C(          88), -INT32_C(         280),  INT32_C(          88), -INT32_C(         502), -INT32_C(         110), -INT32_C(         280) },
+      { SIMDE_FLOAT32_C(  8753.25), SIMDE_FLOAT32_C(  7875.00), SIMDE_FLOAT32_C(  4704.50), SIMDE_FLOAT32_C( -6439.00),
+        SIMDE_FLOAT32_C( -9166.50), SIMDE_FLOAT32_C( -2662.50), SIMDE_FLOAT32_C(  6182.25), SIMDE_FLOAT32_C( -1566.75) },
+      { SIMDE_FLOAT32_C(  4704.50), SIMDE_FLOAT32_C(  7875.00), SIMDE_FLOAT32_C(  4704.50), SIMDE_FLOAT32_C( -1566.75),
+        SIMDE_FLOAT32_C(  4704.50), SIMDE_FLOAT32_C(  -125.50), SIMDE_FLOAT32_C(  6182.25), SIMDE_FLOAT32_C( -1566.75) } },
+    { UINT8_C(242),
+      { -INT32_C(         440), -INT32_C(         192),  INT32_C(         410), -INT32_C(          92), -INT32_C(         154),  INT32_C(         322), -INT32_C(         238),  INT32_C(         284) },
+      { SIMDE_FLOAT32_C( -1749.25), SIMDE_FLOAT32_C(  7306.50), SIMDE_FLOAT32_C( -6526.25), SIMDE_FLOAT32_C( -8353.50),
+        SIMDE_FLOAT32_C( -4522.00), SIMDE_FLOAT32_C( -6720.75), SIMDE_FLOAT32_C( -5948.50), SIMDE_FLOAT32_C( -2720.00) },
+      { SIMDE_FLOAT32_C(  -110.00), SIMDE_FLOAT32_C(  7306.50), SIMDE_FLOAT32_C(   102.50), SIMDE_FLOAT32_C(   -23.00),
+        SIMDE_FLOAT32_C( -4522.00), SIMDE_FLOAT32_C( -6720.75), SIMDE_FLOAT32_C( -5948.50), SIMDE_FLOAT32_C( -2720.00) } },
+    { UINT8_C(175),
+      {  INT32_C(         306),  INT32_C(          14),  INT32_C(         170),  INT32_C(           6), -INT32_C(         180), -INT32_C(         206),  INT32_C(         410), -INT32_C(         206) },
+      { SIMDE_FLOAT32_C(  6491.75), SIMDE_FLOAT32_C( -3182.50), SIMDE_FLOAT32_C( -6173.00), SIMDE_FLOAT32_C( -5106.00),
+        SIMDE_FLOAT32_C( -7059.75), SIMDE_FLOAT32_C(  5160.75), SIMDE_FLOAT32_C( -4005.75), SIMDE_FLOAT32_C(  7447.50) },
+      { SIMDE_FLOAT32_C(  6491.75), SIMDE_FLOAT32_C( -3182.50), SIMDE_FLOAT32_C( -6173.00), SIMDE_FLOAT32_C( -5106.00),
+        SIMDE_FLOAT32_C(   -45.00), SIMDE_FLOAT32_C(  7447.50), SIMDE_FLOAT32_C(   102.50), SIMDE_FLOAT32_C(  7447.50) } },
+    { UINT8_C( 48),
+      {  INT32_C(         476),  INT32_C(         262), -INT32_C(         268), -INT32_C(         134), -INT32_C(          22), -INT32_C(         270), -INT32_C(         402),  INT32_C(         260) },
+      { SIMDE_FLOAT32_C(  5400.00), SIMDE_FLOAT32_C(  3062.00), SIMDE_FLOAT32_C(  5914.00), SIMDE_FLOAT32_C( -3128.25),
+        SIMDE_FLOAT32_C( -5936.00), SIMDE_FLOAT32_C(  6922.00), SIMDE_FLOAT32_C(  9201.50), SIMDE_FLOAT32_C(  2443.25) },
+      { SIMDE_FLOAT32_C(   119.00), SIMDE_FLOAT32_C(    65.50), SIMDE_FLOAT32_C(   -67.00), SIMDE_FLOAT32_C(   -33.50),
+        SIMDE_FLOAT32_C( -5936.00), SIMDE_FLOAT32_C(  6922.00), SIMDE_FLOAT32_C(  -100.50), SIMDE_FLOAT32_C(    65.00) } },
+    { UINT8_C(149),
+      {  INT32_C(         296),  INT32_C(         146), -INT32_C(         118), -INT32_C(         118), -INT32_C(         286), -INT32_C(         118), -INT32_C(         246),  INT32_C(         176) },
+      { SIMDE_FLOAT32_C(  5380.75), SIMDE_FLOAT32_C( -7941.25), SIMDE_FLOAT32_C(  4015.75), SIMDE_FLOAT32_C( -5508.25),
+        SIMDE_FLOAT32_C( -9860.50), SIMDE_FLOAT32_C(  8507.00), SIMDE_FLOAT32_C( -2767.50), SIMDE_FLOAT32_C(  8911.50) },
+      { SIMDE_FLOAT32_C(  5380.75), SIMDE_FLOAT32_C(    36.50), SIMDE_FLOAT32_C(  4015.75), SIMDE_FLOAT32_C(  4015.75),
+        SIMDE_FLOAT32_C( -9860.50), SIMDE_FLOAT32_C(  4015.75), SIMDE_FLOAT32_C(   -61.50), SIMDE_FLOAT32_C(  8911.50) } },
+    { UINT8_C(  7),
+      { -INT32_C(         434),  INT32_C(         476), -INT32_C(         254),  INT32_C(         144),  INT32_C(         264), -INT32_C(         410), -INT32_C(         342), -INT32_C(         230) },
+      { SIMDE_FLOAT32_C(  2557.00), SIMDE_FLOAT32_C(  2224.75), SIMDE_FLOAT32_C(  3962.25), SIMDE_FLOAT32_C(  1531.75),
+        SIMDE_FLOAT32_C( -1684.50), SIMDE_FLOAT32_C( -1227.00), SIMDE_FLOAT32_C(  4555.25), SIMDE_FLOAT32_C(  9948.25) },
+      { SIMDE_FLOAT32_C(  2557.00), SIMDE_FLOAT32_C(  2224.75), SIMDE_FLOAT32_C(  3962.25), SIMDE_FLOAT32_C(    36.00),
+        SIMDE_FLOAT32_C(    66.00), SIMDE_FLOAT32_C(  -102.50), SIMDE_FLOAT32_C(   -85.50), SIMDE_FLOAT32_C(   -57.50) } },
+    { UINT8_C( 60),
+      {  INT32_C(         312), -INT32_C(         164), -INT32_C(         162),  INT32_C(         470), -INT32_C(          70), -INT32_C(         336),  INT32_C(          68), -INT32_C(         366) },
+      { SIMDE_FLOAT32_C(   785.75), SIMDE_FLOAT32_C( -5007.00), SIMDE_FLOAT32_C( -6063.00), SIMDE_FLOAT32_C( -7859.25),
+        SIMDE_FLOAT32_C( -4853.75), SIMDE_FLOAT32_C( -6282.75), SIMDE_FLOAT32_C(  1603.50), SIMDE_FLOAT32_C(  9663.75) },
+      { SIMDE_FLOAT32_C(    78.00), SIMDE_FLOAT32_C(   -41.00), SIMDE_FLOAT32_C( -6063.00), SIMDE_FLOAT32_C( -7859.25),
+        SIMDE_FLOAT32_C( -4853.75), SIMDE_FLOAT32_C( -6282.75), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(   -91.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_mm256_mask_i32scatter_ps(&(f32_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    simde_float32 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x8(simde_mm256_loadu_ps(r), simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { {  INT32_C(         138),  INT32_C(         133), -INT32_C(           9), -INT32_C(         240) },
+      { SIMDE_FLOAT64_C(  9665.25), SIMDE_FLOAT64_C( -7626.75), SIMDE_FLOAT64_C(  8760.50), SIMDE_FLOAT64_C(  7489.00) },
+      { SIMDE_FLOAT64_C(  9665.25), SIMDE_FLOAT64_C( -7626.75), SIMDE_FLOAT64_C(  8760.50), SIMDE_FLOAT64_C(  7489.00) } },
+    { { -INT32_C(         182), -INT32_C(         182),  INT32_C(         168), -INT32_C(         182) },
+      { SIMDE_FLOAT64_C( -7086.00), SIMDE_FLOAT64_C(   871.00), SIMDE_FLOAT64_C(  6049.50), SIMDE_FLOAT64_C( -5989.00) },
+      { SIMDE_FLOAT64_C( -5989.00), SIMDE_FLOAT64_C( -5989.00), SIMDE_FLOAT64_C(  6049.50), SIMDE_FLOAT64_C( -5989.00) } },
+    { { -INT32_C(         217), -INT32_C(         178), -INT32_C(         199), -INT32_C(         114) },
+      { SIMDE_FLOAT64_C( -3454.75), SIMDE_FLOAT64_C( -8292.00), SIMDE_FLOAT64_C( -8434.25), SIMDE_FLOAT64_C(  1040.25) },
+      { SIMDE_FLOAT64_C( -3454.75), SIMDE_FLOAT64_C( -8292.00), SIMDE_FLOAT64_C( -8434.25), SIMDE_FLOAT64_C(  1040.25) } },
+    { { -INT32_C(         143), -INT32_C(         143),  INT32_C(         205), -INT32_C(         212) },
+      { SIMDE_FLOAT64_C( -4674.00), SIMDE_FLOAT64_C(  5751.00), SIMDE_FLOAT64_C(  -570.00), SIMDE_FLOAT64_C(  2085.75) },
+      { SIMDE_FLOAT64_C(  5751.00), SIMDE_FLOAT64_C(  5751.00), SIMDE_FLOAT64_C(  -570.00), SIMDE_FLOAT64_C(  2085.75) } },
+    { {  INT32_C(         110),  INT32_C(          84), -INT32_C(         155),  INT32_C(          76) },
+      { SIMDE_FLOAT64_C( -6393.25), SIMDE_FLOAT64_C( -1798.75), SIMDE_FLOAT64_C(  9308.50), SIMDE_FLOAT64_C( -7228.75) },
+      { SIMDE_FLOAT64_C( -6393.25), SIMDE_FLOAT64_C( -1798.75), SIMDE_FLOAT64_C(  9308.50), SIMDE_FLOAT64_C( -7228.75) } },
+    { { -INT32_C(         214), -INT32_C(         214),  INT32_C(         100), -INT32_C(         214) },
+      { SIMDE_FLOAT64_C( -4877.50), SIMDE_FLOAT64_C( -9339.75), SIMDE_FLOAT64_C( -2080.00), SIMDE_FLOAT64_C(  -827.25) },
+      { SIMDE_FLOAT64_C(  -827.25), SIMDE_FLOAT64_C(  -827.25), SIMDE_FLOAT64_C( -2080.00), SIMDE_FLOAT64_C(  -827.25) } },
+    { {  INT32_C(         231),  INT32_C(         143), -INT32_C(           1),  INT32_C(         149) },
+      { SIMDE_FLOAT64_C( -1933.75), SIMDE_FLOAT64_C( -4537.75), SIMDE_FLOAT64_C(  7594.00), SIMDE_FLOAT64_C( -2965.25) },
+      { SIMDE_FLOAT64_C( -1933.75), SIMDE_FLOAT64_C( -4537.75), SIMDE_FLOAT64_C(  7594.00), SIMDE_FLOAT64_C( -2965.25) } },
+    { {  INT32_C(         166), -INT32_C(         161), -INT32_C(          94),  INT32_C(         166) },
+      { SIMDE_FLOAT64_C(  -439.25), SIMDE_FLOAT64_C(  7597.75), SIMDE_FLOAT64_C( -3961.75), SIMDE_FLOAT64_C(  9913.75) },
+      { SIMDE_FLOAT64_C(  9913.75), SIMDE_FLOAT64_C(  7597.75), SIMDE_FLOAT64_C( -3961.75), SIMDE_FLOAT64_C(  9913.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_mm256_i32scatter_pd(&(f64_buffer[2048]), vindex, a, 8);
+
+    simde_float64 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x4(simde_mm256_loadu_pd(r), simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT32_C(         304),  INT32_C(         190),  INT32_C(         400),  INT32_C(         160) },
+      { SIMDE_FLOAT64_C( -9798.50), SIMDE_FLOAT64_C(  -784.50), SIMDE_FLOAT64_C(  8397.75), SIMDE_FLOAT64_C(  7994.25) },
+      { SIMDE_FLOAT64_C( -9798.50), SIMDE_FLOAT64_C(  -784.50), SIMDE_FLOAT64_C(  8397.75), SIMDE_FLOAT64_C(  7994.25) } },
+    { UINT8_C( 13),
+      { -INT32_C(          52),  INT32_C(         368), -INT32_C(         214), -INT32_C(         214) },
+      { SIMDE_FLOAT64_C(  7793.75), SIMDE_FLOAT64_C(  7276.75), SIMDE_FLOAT64_C(  2530.25), SIMDE_FLOAT64_C( -3812.25) },
+      { SIMDE_FLOAT64_C(  7793.75), SIMDE_FLOAT64_C(    46.00), SIMDE_FLOAT64_C( -3812.25), SIMDE_FLOAT64_C( -3812.25) } },
+    { UINT8_C(161),
+      {  INT32_C(         488), -INT32_C(         108), -INT32_C(         480), -INT32_C(         460) },
+      { SIMDE_FLOAT64_C( -7643.25), SIMDE_FLOAT64_C(  6521.00), SIMDE_FLOAT64_C(  4246.50), SIMDE_FLOAT64_C(  5454.75) },
+      { SIMDE_FLOAT64_C( -7643.25), SIMDE_FLOAT64_C(   -13.50), SIMDE_FLOAT64_C(   -60.00), SIMDE_FLOAT64_C(   -57.50) } },
+    { UINT8_C(219),
+      {  INT32_C(         276), -INT32_C(           8), -INT32_C(          58),  INT32_C(         276) },
+      { SIMDE_FLOAT64_C(  6153.25), SIMDE_FLOAT64_C(   336.25), SIMDE_FLOAT64_C(  9706.50), SIMDE_FLOAT64_C(   160.00) },
+      { SIMDE_FLOAT64_C(   160.00), SIMDE_FLOAT64_C(   336.25), SIMDE_FLOAT64_C(    -7.25), SIMDE_FLOAT64_C(   160.00) } },
+    { UINT8_C( 82),
+      {  INT32_C(         452),  INT32_C(          96),  INT32_C(         112),  INT32_C(          64) },
+      { SIMDE_FLOAT64_C( -3742.25), SIMDE_FLOAT64_C(  6026.75), SIMDE_FLOAT64_C(  -358.00), SIMDE_FLOAT64_C(  8417.00) },
+      { SIMDE_FLOAT64_C(    56.50), SIMDE_FLOAT64_C(  6026.75), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(     8.00) } },
+    { UINT8_C( 66),
+      {  INT32_C(         328), -INT32_C(         294), -INT32_C(         164),  INT32_C(         158) },
+      { SIMDE_FLOAT64_C( -1507.75), SIMDE_FLOAT64_C(  4391.00), SIMDE_FLOAT64_C( -3101.00), SIMDE_FLOAT64_C( -8964.50) },
+      { SIMDE_FLOAT64_C(    41.00), SIMDE_FLOAT64_C(  4391.00), SIMDE_FLOAT64_C(   -20.50), SIMDE_FLOAT64_C(    19.75) } },
+    { UINT8_C( 42),
+      {  INT32_C(         392),  INT32_C(         340),  INT32_C(         498), -INT32_C(         434) },
+      { SIMDE_FLOAT64_C(  1010.75), SIMDE_FLOAT64_C( -2781.25), SIMDE_FLOAT64_C( -1276.50), SIMDE_FLOAT64_C(   649.75) },
+      { SIMDE_FLOAT64_C(    49.00), SIMDE_FLOAT64_C( -2781.25), SIMDE_FLOAT64_C(    62.25), SIMDE_FLOAT64_C(   649.75) } },
+    { UINT8_C(163),
+      { -INT32_C(          12),  INT32_C(         214),  INT32_C(         214),  INT32_C(         410) },
+      { SIMDE_FLOAT64_C(   -74.50), SIMDE_FLOAT64_C( -7308.00), SIMDE_FLOAT64_C(  4983.00), SIMDE_FLOAT64_C( -8004.75) },
+      { SIMDE_FLOAT64_C(   -74.50), SIMDE_FLOAT64_C( -7308.00), SIMDE_FLOAT64_C( -7308.00), SIMDE_FLOAT64_C(    51.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_mm256_mask_i32scatter_pd(&(f64_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    simde_float64 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x4(simde_mm256_loadu_pd(r), simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(                  25),  INT64_C(                  75), -INT64_C(                 143),  INT64_C(                 235) },
+      { -INT32_C(   536870913), -INT32_C(  1641066464),  INT32_C(   547125868),  INT32_C(  1447609224) },
+      { -INT32_C(   536870913), -INT32_C(  1641066464),  INT32_C(   547125868),  INT32_C(  1447609224) } },
+    { {  INT64_C(                 165),  INT64_C(                 161),  INT64_C(                 161),  INT64_C(                  62) },
+      { -INT32_C(   268468481),  INT32_C(   981476395),  INT32_C(   996545172), -INT32_C(   598265193) },
+      { -INT32_C(   268468481),  INT32_C(   996545172),  INT32_C(   996545172), -INT32_C(   598265193) } },
+    { {  INT64_C(                  83),  INT64_C(                  91),  INT64_C(                  20), -INT64_C(                  16) },
+      { -INT32_C(  1848343285),  INT32_C(        4096), -INT32_C(  1886662340),  INT32_C(   536871044) },
+      { -INT32_C(  1848343285),  INT32_C(        4096), -INT32_C(  1886662340),  INT32_C(   536871044) } },
+    { {  INT64_C(                  82),  INT64_C(                  82), -INT64_C(                 223),  INT64_C(                  82) },
+      { -INT32_C(  1654865874), -INT32_C(   537002762),  INT32_C(   268452872),  INT32_C(  2012184491) },
+      {  INT32_C(  2012184491),  INT32_C(  2012184491),  INT32_C(   268452872),  INT32_C(  2012184491) } },
+    { { -INT64_C(                 120),  INT64_C(                  16),  INT64_C(                 176),  INT64_C(                  92) },
+      { -INT32_C(  1666493630), -INT32_C(  2002412038), -INT32_C(    12648769), -INT32_C(   205172264) },
+      { -INT32_C(  1666493630), -INT32_C(  2002412038), -INT32_C(    12648769), -INT32_C(   205172264) } },
+    { {  INT64_C(                  37),  INT64_C(                 173), -INT64_C(                 156), -INT64_C(                 156) },
+      {            INT32_MIN,  INT32_C(   152043844), -INT32_C(   134217749),  INT32_C(  2143289087) },
+      {            INT32_MIN,  INT32_C(   152043844),  INT32_C(  2143289087),  INT32_C(  2143289087) } },
+    { { -INT64_C(                  44), -INT64_C(                 152), -INT64_C(                 164), -INT64_C(                 117) },
+      {  INT32_C(  1833116130), -INT32_C(   608174012),  INT32_C(   805323392), -INT32_C(  2147188224) },
+      {  INT32_C(  1833116130), -INT32_C(   608174012),  INT32_C(   805323392), -INT32_C(  2147188224) } },
+    { { -INT64_C(                 211), -INT64_C(                 211), -INT64_C(                 163),  INT64_C(                 116) },
+      {  INT32_C(    68165636),  INT32_C(    38277136), -INT32_C(  1731851107),  INT32_C(    18874496) },
+      {  INT32_C(    38277136),  INT32_C(    38277136), -INT32_C(  1731851107),  INT32_C(    18874496) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde_mm256_i64scatter_epi32(&(i32_buffer[2048]), vindex, a, 4);
+
+    int32_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x4(simde_x_mm_loadu_epi32(r), simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                  80), -INT64_C(                 640),  INT64_C(                 548),  INT64_C(                 400) },
+      {  INT32_C(  1792117008), -INT32_C(     8423425),  INT32_C(     4202496), -INT32_C(   542730367) },
+      {  INT32_C(  1792117008), -INT32_C(     8423425),  INT32_C(     4202496), -INT32_C(   542730367) } },
+    { UINT8_C(210),
+      { -INT64_C(                 632), -INT64_C(                 632), -INT64_C(                 632), -INT64_C(                 632) },
+      { -INT32_C(  2002780160), -INT32_C(  2113928064),  INT32_C(   439345036), -INT32_C(  2078061717) },
+      { -INT32_C(  2113928064), -INT32_C(  2113928064), -INT32_C(  2113928064), -INT32_C(  2113928064) } },
+    { UINT8_C( 74),
+      { -INT64_C(                 604), -INT64_C(                  44), -INT64_C(                 880), -INT64_C(                 328) },
+      {  INT32_C(    17563714),  INT32_C(   381337517),  INT32_C(           0), -INT32_C(  1541195075) },
+      { -INT32_C(         453),  INT32_C(   381337517), -INT32_C(         660), -INT32_C(  1541195075) } },
+    { UINT8_C(130),
+      {  INT64_C(                 192), -INT64_C(                 660),  INT64_C(                 928), -INT64_C(                 480) },
+      {  INT32_C(   235028544),  INT32_C(        8704),  INT32_C(   238938826),  INT32_C(   716470411) },
+      {  INT32_C(         144),  INT32_C(        8704),  INT32_C(         696), -INT32_C(         360) } },
+    { UINT8_C( 45),
+      {  INT64_C(                 116),  INT64_C(                 472), -INT64_C(                 916),  INT64_C(                 784) },
+      { -INT32_C(           1),  INT32_C(     8390720), -INT32_C(     8388609), -INT32_C(       41987) },
+      { -INT32_C(           1),  INT32_C(         354), -INT32_C(     8388609), -INT32_C(       41987) } },
+    { UINT8_C(230),
+      {  INT64_C(                 580), -INT64_C(                 228),  INT64_C(                 580),  INT64_C(                 580) },
+      {  INT32_C(  1929800865), -INT32_C(  2070603154), -INT32_C(   443082941), -INT32_C(  1152733937) },
+      { -INT32_C(   443082941), -INT32_C(  2070603154), -INT32_C(   443082941), -INT32_C(   443082941) } },
+    { UINT8_C( 29),
+      {  INT64_C(                 940),  INT64_C(                  76),  INT64_C(                 472), -INT64_C(                 828) },
+      {  INT32_C(   862305785),  INT32_C(   134283795), -INT32_C(  1071644160),  INT32_C(    67112960) },
+      {  INT32_C(   862305785),  INT32_C(          57), -INT32_C(  1071644160),  INT32_C(    67112960) } },
+    { UINT8_C(192),
+      { -INT64_C(                 796), -INT64_C(                 796),  INT64_C(                 104),  INT64_C(                 988) },
+      { -INT32_C(  1442248763),  INT32_C(      526592),  INT32_C(  1872147326),  INT32_C(  2134119307) },
+      { -INT32_C(         597), -INT32_C(         597),  INT32_C(          78),  INT32_C(         741) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde_mm256_mask_i64scatter_epi32(&(i32_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    int32_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x4(simde_x_mm_loadu_epi32(r), simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(                 189),  INT64_C(                 208),  INT64_C(                 125), -INT64_C(                  52) },
+      { -INT64_C( 4420333776219033570), -INT64_C(  753014376744073560),  INT64_C( 2306432416166742273),  INT64_C(  101050344024311404) },
+      { -INT64_C( 4420333776219033570), -INT64_C(  753014376744073560),  INT64_C( 2306432416166742273),  INT64_C(  101050344024311404) } },
+    { { -INT64_C(                 138), -INT64_C(                 138), -INT64_C(                 184), -INT64_C(                 182) },
+      { -INT64_C( 7036226164018283515),  INT64_C(  864691197745039424), -INT64_C( 7405363163440537242),  INT64_C(  348898897181041314) },
+      {  INT64_C(  864691197745039424),  INT64_C(  864691197745039424), -INT64_C( 7405363163440537242),  INT64_C(  348898897181041314) } },
+    { {  INT64_C(                  41), -INT64_C(                 167), -INT64_C(                  93),  INT64_C(                  87) },
+      { -INT64_C(  288287572231749761), -INT64_C(  621496853812226438),  INT64_C( 1297045510250561537), -INT64_C( 8505210749398688486) },
+      { -INT64_C(  288287572231749761), -INT64_C(  621496853812226438),  INT64_C( 1297045510250561537), -INT64_C( 8505210749398688486) } },
+    { {  INT64_C(                 130),  INT64_C(                  95),  INT64_C(                 154), -INT64_C(                 187) },
+      {  INT64_C(    2251834475741200), -INT64_C( 2776589444079922540), -INT64_C(  239233229873624297),  INT64_C( 8024398315324549083) },
+      {  INT64_C(    2251834475741200), -INT64_C( 2776589444079922540), -INT64_C(  239233229873624297),  INT64_C( 8024398315324549083) } },
+    { {  INT64_C(                 253), -INT64_C(                  66),  INT64_C(                 134), -INT64_C(                 106) },
+      { -INT64_C( 7434846630188560130),  INT64_C( 5782523642117705918),  INT64_C(          8592031756),  INT64_C(      35184414077674) },
+      { -INT64_C( 7434846630188560130),  INT64_C( 5782523642117705918),  INT64_C(          8592031756),  INT64_C(      35184414077674) } },
+    { { -INT64_C(                  87), -INT64_C(                  87), -INT64_C(                  87), -INT64_C(                   8) },
+      {  INT64_C( 1605067449890715927),  INT64_C( 6333432127225237499),  INT64_C( 6443314079986691329),  INT64_C(    4648805232288784) },
+      {  INT64_C( 6443314079986691329),  INT64_C( 6443314079986691329),  INT64_C( 6443314079986691329),  INT64_C(    4648805232288784) } },
+    { {  INT64_C(                  34), -INT64_C(                 224), -INT64_C(                 106),  INT64_C(                 153) },
+      {  INT64_C( 4975301081582206634), -INT64_C(        559558043729),  INT64_C( 5343728405071730797),  INT64_C(  595038513083187328) },
+      {  INT64_C( 4975301081582206634), -INT64_C(        559558043729),  INT64_C( 5343728405071730797),  INT64_C(  595038513083187328) } },
+    { { -INT64_C(                 178), -INT64_C(                  65), -INT64_C(                  47), -INT64_C(                  65) },
+      { -INT64_C(   45035996273723521),  INT64_C(     180905096249360), -INT64_C( 2259902588487599871),  INT64_C(  153702930006941784) },
+      { -INT64_C(   45035996273723521),  INT64_C(  153702930006941784), -INT64_C( 2259902588487599871),  INT64_C(  153702930006941784) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde_mm256_i64scatter_epi64(&(i64_buffer[2048]), vindex, a, 8);
+
+    int64_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x4(simde_x_mm256_loadu_epi64(r), simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                 680),  INT64_C(                 224),  INT64_C(                 488),  INT64_C(                 644) },
+      {  INT64_C( 4323455625094750143),  INT64_C(  432633911156146177),  INT64_C( 6188950814762820613), -INT64_C( 5788842906902872064) },
+      {  INT64_C( 4323455625094750143),  INT64_C(  432633911156146177),  INT64_C( 6188950814762820613), -INT64_C( 5788842906902872064) } },
+    { UINT8_C( 64),
+      {  INT64_C(                 620),  INT64_C(                 620),  INT64_C(                 620), -INT64_C(                 832) },
+      { -INT64_C(      72576894239269),  INT64_C( 4249989302198022816),  INT64_C(   10133240971001888),  INT64_C(   73267057971430146) },
+      {  INT64_C(        665719931035),  INT64_C(        665719931035),  INT64_C(        665719931035), -INT64_C(        893353197776) } },
+    { UINT8_C(137),
+      { -INT64_C(                 632),  INT64_C(                 684),  INT64_C(                 464), -INT64_C(                 364) },
+      { -INT64_C( 2306969461090959361), -INT64_C(    2816957514514433), -INT64_C( 1318571515423696203),  INT64_C(  559175389518108494) },
+      { -INT64_C( 2306969461090959361),  INT64_C(        734439407787),  INT64_C(        498216206452),  INT64_C(  559175389518108494) } },
+    { UINT8_C(159),
+      { -INT64_C(                 124), -INT64_C(                 384),  INT64_C(                 160), -INT64_C(                 552) },
+      {  INT64_C(   72198331538866432), -INT64_C(       9350181584931),  INT64_C( 1286792203451742140),  INT64_C( 4762469248154482443) },
+      {  INT64_C(   72198331538866432), -INT64_C(       9350181584931),  INT64_C( 1286792203451742140),  INT64_C( 4762469248154482443) } },
+    { UINT8_C( 97),
+      { -INT64_C(                 584),  INT64_C(                 476),  INT64_C(                 152),  INT64_C(                 692) },
+      {  INT64_C(  546570577914289524), -INT64_C( 9151314374095536128), -INT64_C(        137858650769),  INT64_C( 2449962595606626688) },
+      {  INT64_C(  546570577914289524),  INT64_C(        511101108343),  INT64_C(        163208757286),  INT64_C(        743029342381) } },
+    { UINT8_C( 33),
+      { -INT64_C(                 536), -INT64_C(                   4), -INT64_C(                 928),  INT64_C(                 808) },
+      { -INT64_C( 1904708656933745243),  INT64_C( 6585021658057032342), -INT64_C( 6596577376240686185), -INT64_C(     158329961971725) },
+      { -INT64_C( 1904708656933745243), -INT64_C(          4294967297), -INT64_C(        996432412904),  INT64_C(        867583393994) } },
+    { UINT8_C(110),
+      {  INT64_C(                 744),  INT64_C(                 544), -INT64_C(                 516), -INT64_C(                  88) },
+      {  INT64_C( 1154082606133084160), -INT64_C( 7406728001358327310),  INT64_C(   72058715024466438), -INT64_C( 5902500483593746326) },
+      {  INT64_C(        798863917242), -INT64_C( 7406728001358327310),  INT64_C(   72058715024466438), -INT64_C( 5902500483593746326) } },
+    { UINT8_C( 25),
+      {  INT64_C(                 520),  INT64_C(                 668),  INT64_C(                 668),  INT64_C(                 668) },
+      { -INT64_C( 4611686018481913857), -INT64_C( 9078975373802207168),  INT64_C(    1271181479008896), -INT64_C(    2322444594055169) },
+      { -INT64_C( 4611686018481913857), -INT64_C(    2322444594055169), -INT64_C(    2322444594055169), -INT64_C(    2322444594055169) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde_mm256_mask_i64scatter_epi64(&(i64_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    int64_t r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x4(simde_x_mm256_loadu_epi64(r), simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { {  INT64_C(                 198),  INT64_C(                  46),  INT64_C(                  73), -INT64_C(                  95) },
+      { SIMDE_FLOAT32_C(  5355.50), SIMDE_FLOAT32_C(  4826.00), SIMDE_FLOAT32_C(  4844.00), SIMDE_FLOAT32_C( -2199.50) },
+      { SIMDE_FLOAT32_C(  5355.50), SIMDE_FLOAT32_C(  4826.00), SIMDE_FLOAT32_C(  4844.00), SIMDE_FLOAT32_C( -2199.50) } },
+    { { -INT64_C(                   4), -INT64_C(                   4), -INT64_C(                   4),  INT64_C(                  25) },
+      { SIMDE_FLOAT32_C(  3616.50), SIMDE_FLOAT32_C(  4871.00), SIMDE_FLOAT32_C(  4058.25), SIMDE_FLOAT32_C( -5391.50) },
+      { SIMDE_FLOAT32_C(  4058.25), SIMDE_FLOAT32_C(  4058.25), SIMDE_FLOAT32_C(  4058.25), SIMDE_FLOAT32_C( -5391.50) } },
+    { { -INT64_C(                  74),  INT64_C(                 180),  INT64_C(                 184),  INT64_C(                 181) },
+      { SIMDE_FLOAT32_C(   579.25), SIMDE_FLOAT32_C(  8908.00), SIMDE_FLOAT32_C(  6322.75), SIMDE_FLOAT32_C( -6997.50) },
+      { SIMDE_FLOAT32_C(   579.25), SIMDE_FLOAT32_C(  8908.00), SIMDE_FLOAT32_C(  6322.75), SIMDE_FLOAT32_C( -6997.50) } },
+    { {  INT64_C(                 173),  INT64_C(                 173), -INT64_C(                  28),  INT64_C(                 173) },
+      { SIMDE_FLOAT32_C(  -129.50), SIMDE_FLOAT32_C( -3322.25), SIMDE_FLOAT32_C( -7725.00), SIMDE_FLOAT32_C( -7878.25) },
+      { SIMDE_FLOAT32_C( -7878.25), SIMDE_FLOAT32_C( -7878.25), SIMDE_FLOAT32_C( -7725.00), SIMDE_FLOAT32_C( -7878.25) } },
+    { {  INT64_C(                  17), -INT64_C(                 125), -INT64_C(                 113),  INT64_C(                 129) },
+      { SIMDE_FLOAT32_C(  2360.50), SIMDE_FLOAT32_C(  2251.00), SIMDE_FLOAT32_C( -6241.75), SIMDE_FLOAT32_C( -6327.00) },
+      { SIMDE_FLOAT32_C(  2360.50), SIMDE_FLOAT32_C(  2251.00), SIMDE_FLOAT32_C( -6241.75), SIMDE_FLOAT32_C( -6327.00) } },
+    { {  INT64_C(                 239), -INT64_C(                  12),  INT64_C(                 111), -INT64_C(                  12) },
+      { SIMDE_FLOAT32_C( -4670.25), SIMDE_FLOAT32_C(  4557.25), SIMDE_FLOAT32_C(  3939.50), SIMDE_FLOAT32_C( -6863.00) },
+      { SIMDE_FLOAT32_C( -4670.25), SIMDE_FLOAT32_C( -6863.00), SIMDE_FLOAT32_C(  3939.50), SIMDE_FLOAT32_C( -6863.00) } },
+    { {  INT64_C(                 124),  INT64_C(                 223),  INT64_C(                 201),  INT64_C(                  58) },
+      { SIMDE_FLOAT32_C( -6731.00), SIMDE_FLOAT32_C(  9947.00), SIMDE_FLOAT32_C(  4030.50), SIMDE_FLOAT32_C(  6496.50) },
+      { SIMDE_FLOAT32_C( -6731.00), SIMDE_FLOAT32_C(  9947.00), SIMDE_FLOAT32_C(  4030.50), SIMDE_FLOAT32_C(  6496.50) } },
+    { { -INT64_C(                 232), -INT64_C(                 232), -INT64_C(                 232),  INT64_C(                 164) },
+      { SIMDE_FLOAT32_C(  4628.75), SIMDE_FLOAT32_C(  5872.00), SIMDE_FLOAT32_C( -4738.00), SIMDE_FLOAT32_C(  5143.25) },
+      { SIMDE_FLOAT32_C( -4738.00), SIMDE_FLOAT32_C( -4738.00), SIMDE_FLOAT32_C( -4738.00), SIMDE_FLOAT32_C(  5143.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_mm256_i64scatter_ps(&(f32_buffer[2048]), vindex, a, 4);
+
+    simde_float32 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x4(simde_mm_loadu_ps(r), simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                 121), -INT64_C(                 136),  INT64_C(                  12), -INT64_C(                 252) },
+      { SIMDE_FLOAT32_C( -2591.50), SIMDE_FLOAT32_C( -3868.75), SIMDE_FLOAT32_C(  3978.50), SIMDE_FLOAT32_C( -2224.75) },
+      { SIMDE_FLOAT32_C( -2591.50), SIMDE_FLOAT32_C( -3868.75), SIMDE_FLOAT32_C(  3978.50), SIMDE_FLOAT32_C( -2224.75) } },
+    { UINT8_C(226),
+      { -INT64_C(                 225), -INT64_C(                 225), -INT64_C(                 225), -INT64_C(                 225) },
+      { SIMDE_FLOAT32_C( -5852.75), SIMDE_FLOAT32_C( -7415.00), SIMDE_FLOAT32_C(  2821.50), SIMDE_FLOAT32_C(  6725.00) },
+      { SIMDE_FLOAT32_C( -7415.00), SIMDE_FLOAT32_C( -7415.00), SIMDE_FLOAT32_C( -7415.00), SIMDE_FLOAT32_C( -7415.00) } },
+    { UINT8_C(103),
+      { -INT64_C(                 100),  INT64_C(                  70),  INT64_C(                   2),  INT64_C(                 147) },
+      { SIMDE_FLOAT32_C(  4850.00), SIMDE_FLOAT32_C( -6028.75), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(  8138.00) },
+      { SIMDE_FLOAT32_C(  4850.00), SIMDE_FLOAT32_C( -6028.75), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    73.50) } },
+    { UINT8_C( 38),
+      { -INT64_C(                 132), -INT64_C(                 132), -INT64_C(                 132), -INT64_C(                 132) },
+      { SIMDE_FLOAT32_C( -7024.25), SIMDE_FLOAT32_C( -8368.25), SIMDE_FLOAT32_C( -4715.25), SIMDE_FLOAT32_C(  -377.00) },
+      { SIMDE_FLOAT32_C( -4715.25), SIMDE_FLOAT32_C( -4715.25), SIMDE_FLOAT32_C( -4715.25), SIMDE_FLOAT32_C( -4715.25) } },
+    { UINT8_C(142),
+      {  INT64_C(                  92),  INT64_C(                 242), -INT64_C(                  87),  INT64_C(                  53) },
+      { SIMDE_FLOAT32_C(  -818.50), SIMDE_FLOAT32_C( -6693.50), SIMDE_FLOAT32_C( -7729.00), SIMDE_FLOAT32_C(  6650.25) },
+      { SIMDE_FLOAT32_C(    46.00), SIMDE_FLOAT32_C( -6693.50), SIMDE_FLOAT32_C( -7729.00), SIMDE_FLOAT32_C(  6650.25) } },
+    { UINT8_C( 55),
+      { -INT64_C(                 230), -INT64_C(                  94), -INT64_C(                 230),  INT64_C(                 179) },
+      { SIMDE_FLOAT32_C(  7266.25), SIMDE_FLOAT32_C( -7076.75), SIMDE_FLOAT32_C( -5559.25), SIMDE_FLOAT32_C(  5024.00) },
+      { SIMDE_FLOAT32_C( -5559.25), SIMDE_FLOAT32_C( -7076.75), SIMDE_FLOAT32_C( -5559.25), SIMDE_FLOAT32_C(    89.50) } },
+    { UINT8_C(249),
+      { -INT64_C(                 212), -INT64_C(                 186), -INT64_C(                 185),  INT64_C(                  86) },
+      { SIMDE_FLOAT32_C( -3016.50), SIMDE_FLOAT32_C(  -809.00), SIMDE_FLOAT32_C( -7653.00), SIMDE_FLOAT32_C( -4407.00) },
+      { SIMDE_FLOAT32_C( -3016.50), SIMDE_FLOAT32_C(   -93.00), SIMDE_FLOAT32_C(   -92.50), SIMDE_FLOAT32_C( -4407.00) } },
+    { UINT8_C( 77),
+      { -INT64_C(                 140), -INT64_C(                 212),  INT64_C(                 239), -INT64_C(                 212) },
+      { SIMDE_FLOAT32_C( -6461.50), SIMDE_FLOAT32_C( -6999.00), SIMDE_FLOAT32_C( -6263.00), SIMDE_FLOAT32_C( -2040.50) },
+      { SIMDE_FLOAT32_C( -6461.50), SIMDE_FLOAT32_C( -2040.50), SIMDE_FLOAT32_C( -6263.00), SIMDE_FLOAT32_C( -2040.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_mm256_mask_i64scatter_ps(&(f32_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    simde_float32 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x4(simde_mm_loadu_ps(r), simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { {  INT64_C(                 183),  INT64_C(                  80),  INT64_C(                  96), -INT64_C(                 189) },
+      { SIMDE_FLOAT64_C(  2172.75), SIMDE_FLOAT64_C(  2468.25), SIMDE_FLOAT64_C( -2936.25), SIMDE_FLOAT64_C(  -390.25) },
+      { SIMDE_FLOAT64_C(  2172.75), SIMDE_FLOAT64_C(  2468.25), SIMDE_FLOAT64_C( -2936.25), SIMDE_FLOAT64_C(  -390.25) } },
+    { {  INT64_C(                 199), -INT64_C(                 202),  INT64_C(                  34), -INT64_C(                 112) },
+      { SIMDE_FLOAT64_C( -7873.50), SIMDE_FLOAT64_C(  1932.25), SIMDE_FLOAT64_C(   -11.50), SIMDE_FLOAT64_C(  7138.25) },
+      { SIMDE_FLOAT64_C( -7873.50), SIMDE_FLOAT64_C(  1932.25), SIMDE_FLOAT64_C(   -11.50), SIMDE_FLOAT64_C(  7138.25) } },
+    { {  INT64_C(                 144), -INT64_C(                  24),  INT64_C(                  20),  INT64_C(                 140) },
+      { SIMDE_FLOAT64_C( -5981.25), SIMDE_FLOAT64_C( -6129.25), SIMDE_FLOAT64_C(   244.50), SIMDE_FLOAT64_C( -5997.50) },
+      { SIMDE_FLOAT64_C( -5981.25), SIMDE_FLOAT64_C( -6129.25), SIMDE_FLOAT64_C(   244.50), SIMDE_FLOAT64_C( -5997.50) } },
+    { {  INT64_C(                 246),  INT64_C(                 165), -INT64_C(                 183),  INT64_C(                 175) },
+      { SIMDE_FLOAT64_C(  8184.50), SIMDE_FLOAT64_C( -8037.25), SIMDE_FLOAT64_C(  9433.25), SIMDE_FLOAT64_C(  2148.00) },
+      { SIMDE_FLOAT64_C(  8184.50), SIMDE_FLOAT64_C( -8037.25), SIMDE_FLOAT64_C(  9433.25), SIMDE_FLOAT64_C(  2148.00) } },
+    { {  INT64_C(                  53), -INT64_C(                 133),  INT64_C(                 244), -INT64_C(                  38) },
+      { SIMDE_FLOAT64_C( -8347.25), SIMDE_FLOAT64_C(  8360.75), SIMDE_FLOAT64_C(  -893.75), SIMDE_FLOAT64_C( -6046.75) },
+      { SIMDE_FLOAT64_C( -8347.25), SIMDE_FLOAT64_C(  8360.75), SIMDE_FLOAT64_C(  -893.75), SIMDE_FLOAT64_C( -6046.75) } },
+    { {  INT64_C(                 238),  INT64_C(                 198),  INT64_C(                 108),  INT64_C(                  70) },
+      { SIMDE_FLOAT64_C(  2195.50), SIMDE_FLOAT64_C(  -822.25), SIMDE_FLOAT64_C(  9342.75), SIMDE_FLOAT64_C(  7308.25) },
+      { SIMDE_FLOAT64_C(  2195.50), SIMDE_FLOAT64_C(  -822.25), SIMDE_FLOAT64_C(  9342.75), SIMDE_FLOAT64_C(  7308.25) } },
+    { {  INT64_C(                 219),  INT64_C(                  97),  INT64_C(                  99),  INT64_C(                  82) },
+      { SIMDE_FLOAT64_C( -1905.75), SIMDE_FLOAT64_C(    30.75), SIMDE_FLOAT64_C( -3160.50), SIMDE_FLOAT64_C(  6711.25) },
+      { SIMDE_FLOAT64_C( -1905.75), SIMDE_FLOAT64_C(    30.75), SIMDE_FLOAT64_C( -3160.50), SIMDE_FLOAT64_C(  6711.25) } },
+    { { -INT64_C(                 235),  INT64_C(                 250),  INT64_C(                  83), -INT64_C(                 235) },
+      { SIMDE_FLOAT64_C( -8999.25), SIMDE_FLOAT64_C( -5146.00), SIMDE_FLOAT64_C(  4802.75), SIMDE_FLOAT64_C(   942.75) },
+      { SIMDE_FLOAT64_C(   942.75), SIMDE_FLOAT64_C( -5146.00), SIMDE_FLOAT64_C(  4802.75), SIMDE_FLOAT64_C(   942.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_mm256_i64scatter_pd(&(f64_buffer[2048]), vindex, a, 8);
+
+    simde_float64 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x4(simde_mm256_loadu_pd(r), simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT64_C(                1984), -INT64_C(                1776), -INT64_C(                 952), -INT64_C(                   8) },
+      { SIMDE_FLOAT64_C(  -502.75), SIMDE_FLOAT64_C(  4801.00), SIMDE_FLOAT64_C( -2320.25), SIMDE_FLOAT64_C(  2312.25) },
+      { SIMDE_FLOAT64_C(  -502.75), SIMDE_FLOAT64_C(  4801.00), SIMDE_FLOAT64_C( -2320.25), SIMDE_FLOAT64_C(  2312.25) } },
+    { UINT8_C(189),
+      {  INT64_C(                  56), -INT64_C(                  88),  INT64_C(                  56), -INT64_C(                1736) },
+      { SIMDE_FLOAT64_C(  3313.50), SIMDE_FLOAT64_C( -4377.75), SIMDE_FLOAT64_C(  3554.50), SIMDE_FLOAT64_C(  3902.50) },
+      { SIMDE_FLOAT64_C(  3554.50), SIMDE_FLOAT64_C(    -2.75), SIMDE_FLOAT64_C(  3554.50), SIMDE_FLOAT64_C(  3902.50) } },
+    { UINT8_C( 13),
+      { -INT64_C(                 216),  INT64_C(                1040), -INT64_C(                 560), -INT64_C(                 600) },
+      { SIMDE_FLOAT64_C(  -513.75), SIMDE_FLOAT64_C(  9955.25), SIMDE_FLOAT64_C(   307.00), SIMDE_FLOAT64_C(  7859.75) },
+      { SIMDE_FLOAT64_C(  -513.75), SIMDE_FLOAT64_C(    32.50), SIMDE_FLOAT64_C(   307.00), SIMDE_FLOAT64_C(  7859.75) } },
+    { UINT8_C(172),
+      {  INT64_C(                1560),  INT64_C(                1560),  INT64_C(                1560), -INT64_C(                  88) },
+      { SIMDE_FLOAT64_C(  1251.75), SIMDE_FLOAT64_C(  7969.25), SIMDE_FLOAT64_C( -5794.00), SIMDE_FLOAT64_C(  8370.50) },
+      { SIMDE_FLOAT64_C( -5794.00), SIMDE_FLOAT64_C( -5794.00), SIMDE_FLOAT64_C( -5794.00), SIMDE_FLOAT64_C(  8370.50) } },
+    { UINT8_C(133),
+      {  INT64_C(                 160), -INT64_C(                1016),  INT64_C(                 128), -INT64_C(                1112) },
+      { SIMDE_FLOAT64_C(  7288.75), SIMDE_FLOAT64_C(  1412.00), SIMDE_FLOAT64_C( -5998.50), SIMDE_FLOAT64_C(  4523.25) },
+      { SIMDE_FLOAT64_C(  7288.75), SIMDE_FLOAT64_C(   -31.75), SIMDE_FLOAT64_C( -5998.50), SIMDE_FLOAT64_C(   -34.75) } },
+    { UINT8_C(204),
+      { -INT64_C(                1536),  INT64_C(                 808), -INT64_C(                 672),  INT64_C(                 712) },
+      { SIMDE_FLOAT64_C( -6501.25), SIMDE_FLOAT64_C(  5799.00), SIMDE_FLOAT64_C(  8346.25), SIMDE_FLOAT64_C(  3671.00) },
+      { SIMDE_FLOAT64_C(   -48.00), SIMDE_FLOAT64_C(    25.25), SIMDE_FLOAT64_C(  8346.25), SIMDE_FLOAT64_C(  3671.00) } },
+    { UINT8_C(176),
+      { -INT64_C(                1784),  INT64_C(                  16), -INT64_C(                 640),  INT64_C(                1680) },
+      { SIMDE_FLOAT64_C( -9020.75), SIMDE_FLOAT64_C(    35.75), SIMDE_FLOAT64_C( -3916.75), SIMDE_FLOAT64_C( -8868.75) },
+      { SIMDE_FLOAT64_C(   -55.75), SIMDE_FLOAT64_C(     0.50), SIMDE_FLOAT64_C(   -20.00), SIMDE_FLOAT64_C(    52.50) } },
+    { UINT8_C(169),
+      {  INT64_C(                 456),  INT64_C(                 456),  INT64_C(                 384),  INT64_C(                 504) },
+      { SIMDE_FLOAT64_C(  4370.25), SIMDE_FLOAT64_C( -2845.00), SIMDE_FLOAT64_C(  2495.50), SIMDE_FLOAT64_C(  5794.00) },
+      { SIMDE_FLOAT64_C(  4370.25), SIMDE_FLOAT64_C(  4370.25), SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(  5794.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_mm256_mask_i64scatter_pd(&(f64_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    simde_float64 r[4] = { 0 };
+    for (size_t j = 0 ; j < 4 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x4(simde_mm256_loadu_pd(r), simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(          38),  INT32_C(         168), -INT32_C(          38), -INT32_C(          44),  INT32_C(          55), -INT32_C(         241),  INT32_C(         178), -INT32_C(         203),
+         INT32_C(          73),  INT32_C(         139),  INT32_C(         226),  INT32_C(          87), -INT32_C(         151),  INT32_C(         188),  INT32_C(          12), -INT32_C(          36) },
+      {  INT32_C(  1898051621), -INT32_C(  1367214062), -INT32_C(  1652820132),  INT32_C(     2528264),  INT32_C(   100671488),  INT32_C(   480639070),  INT32_C(    16779264), -INT32_C(   613102019),
+        -INT32_C(  1431363764),  INT32_C(  1441633168),  INT32_C(   667418753), -INT32_C(         513),  INT32_C(   269030408), -INT32_C(   299997074),  INT32_C(  1061134303), -INT32_C(   738463842) },
+      { -INT32_C(  1652820132), -INT32_C(  1367214062), -INT32_C(  1652820132),  INT32_C(     2528264),  INT32_C(   100671488),  INT32_C(   480639070),  INT32_C(    16779264), -INT32_C(   613102019),
+        -INT32_C(  1431363764),  INT32_C(  1441633168),  INT32_C(   667418753), -INT32_C(         513),  INT32_C(   269030408), -INT32_C(   299997074),  INT32_C(  1061134303), -INT32_C(   738463842) } },
+    { {  INT32_C(         209),  INT32_C(         209),  INT32_C(         171),  INT32_C(         231),  INT32_C(         171), -INT32_C(         213),  INT32_C(         248),  INT32_C(           8),
+         INT32_C(         248),  INT32_C(         254), -INT32_C(         171),  INT32_C(         238),  INT32_C(           9), -INT32_C(         161), -INT32_C(         184),  INT32_C(         152) },
+      {  INT32_C(  1074266112), -INT32_C(  1801993775), -INT32_C(     4768263),  INT32_C(   477434053), -INT32_C(  1553290218),  INT32_C(  1423512273),  INT32_C(  1794539371), -INT32_C(  1870659568),
+        -INT32_C(  2042508995), -INT32_C(   970702694), -INT32_C(  2138562560), -INT32_C(     2753161),  INT32_C(  2080112621),  INT32_C(           0),  INT32_C(  1343750176), -INT32_C(     8388678) },
+      { -INT32_C(  1801993775), -INT32_C(  1801993775), -INT32_C(  1553290218),  INT32_C(   477434053), -INT32_C(  1553290218),  INT32_C(  1423512273), -INT32_C(  2042508995), -INT32_C(  1870659568),
+        -INT32_C(  2042508995), -INT32_C(   970702694), -INT32_C(  2138562560), -INT32_C(     2753161),  INT32_C(  2080112621),  INT32_C(           0),  INT32_C(  1343750176), -INT32_C(     8388678) } },
+    { {  INT32_C(         235),  INT32_C(         212), -INT32_C(         253), -INT32_C(         194), -INT32_C(         246),  INT32_C(           4),  INT32_C(         167),  INT32_C(         124),
+         INT32_C(          51), -INT32_C(          66), -INT32_C(         113),  INT32_C(         141),  INT32_C(          94), -INT32_C(         164), -INT32_C(         160),  INT32_C(         180) },
+      { -INT32_C(   509022244),  INT32_C(  2078399140),  INT32_C(   135004452), -INT32_C(   672760833), -INT32_C(  1079510145), -INT32_C(      524289),  INT32_C(   172171280),  INT32_C(  1380624028),
+         INT32_C(  1509926658),  INT32_C(  1878359039),  INT32_C(  1988430920), -INT32_C(  1434284554),  INT32_C(   748450968), -INT32_C(   270532615), -INT32_C(   286261329),  INT32_C(      524548) },
+      { -INT32_C(   509022244),  INT32_C(  2078399140),  INT32_C(   135004452), -INT32_C(   672760833), -INT32_C(  1079510145), -INT32_C(      524289),  INT32_C(   172171280),  INT32_C(  1380624028),
+         INT32_C(  1509926658),  INT32_C(  1878359039),  INT32_C(  1988430920), -INT32_C(  1434284554),  INT32_C(   748450968), -INT32_C(   270532615), -INT32_C(   286261329),  INT32_C(      524548) } },
+    { {  INT32_C(          17),  INT32_C(          17),  INT32_C(          17), -INT32_C(          16), -INT32_C(          39),  INT32_C(          17), -INT32_C(          74),  INT32_C(          17),
+        -INT32_C(          52), -INT32_C(          45), -INT32_C(          98),  INT32_C(         200),  INT32_C(          17), -INT32_C(         137), -INT32_C(          59),  INT32_C(         224) },
+      { -INT32_C(     1069321),  INT32_C(   537923586), -INT32_C(  1006540515), -INT32_C(  1454550999), -INT32_C(        1025), -INT32_C(     4792578),  INT32_C(   536945026),  INT32_C(        4096),
+         INT32_C(  1510414218), -INT32_C(   515547982),  INT32_C(  1712419223), -INT32_C(   150995473), -INT32_C(   326271743),  INT32_C(  1399737417), -INT32_C(      131585), -INT32_C(  1511662442) },
+      { -INT32_C(   326271743), -INT32_C(   326271743), -INT32_C(   326271743), -INT32_C(  1454550999), -INT32_C(        1025), -INT32_C(   326271743),  INT32_C(   536945026), -INT32_C(   326271743),
+         INT32_C(  1510414218), -INT32_C(   515547982),  INT32_C(  1712419223), -INT32_C(   150995473), -INT32_C(   326271743),  INT32_C(  1399737417), -INT32_C(      131585), -INT32_C(  1511662442) } },
+    { { -INT32_C(          42),  INT32_C(          47),  INT32_C(         197),  INT32_C(         155),  INT32_C(          32),  INT32_C(         121), -INT32_C(         176),  INT32_C(         119),
+         INT32_C(         171), -INT32_C(         188), -INT32_C(         194), -INT32_C(          66),  INT32_C(          59), -INT32_C(         193),  INT32_C(         213), -INT32_C(          78) },
+      {  INT32_C(  1560990080),  INT32_C(   668663358),  INT32_C(  2002534982),  INT32_C(   320753189), -INT32_C(  1192886874),  INT32_C(  2126740517), -INT32_C(  1858916353),  INT32_C(       10496),
+         INT32_C(  2138055122),  INT32_C(  1108377632), -INT32_C(     8396801), -INT32_C(  1625696408), -INT32_C(  1878474744), -INT32_C(     5242881),  INT32_C(      262144),  INT32_C(   536879104) },
+      {  INT32_C(  1560990080),  INT32_C(   668663358),  INT32_C(  2002534982),  INT32_C(   320753189), -INT32_C(  1192886874),  INT32_C(  2126740517), -INT32_C(  1858916353),  INT32_C(       10496),
+         INT32_C(  2138055122),  INT32_C(  1108377632), -INT32_C(     8396801), -INT32_C(  1625696408), -INT32_C(  1878474744), -INT32_C(     5242881),  INT32_C(      262144),  INT32_C(   536879104) } },
+    { {  INT32_C(          64),  INT32_C(          64),  INT32_C(           7),  INT32_C(          64),  INT32_C(          64),  INT32_C(         113),  INT32_C(         125), -INT32_C(          71),
+         INT32_C(         252), -INT32_C(          57),  INT32_C(           9), -INT32_C(          31), -INT32_C(          57),  INT32_C(         156),  INT32_C(          64), -INT32_C(          94) },
+      { -INT32_C(      525345),  INT32_C(       33041),  INT32_C(   268453888),  INT32_C(   872517042),  INT32_C(   656162106),  INT32_C(           0),  INT32_C(  1413365006), -INT32_C(    67112965),
+        -INT32_C(   268441617), -INT32_C(       67601), -INT32_C(  1074135937),  INT32_C(      286856),  INT32_C(  1542911548), -INT32_C(   828813405),  INT32_C(    69470724), -INT32_C(   268435521) },
+      {  INT32_C(    69470724),  INT32_C(    69470724),  INT32_C(   268453888),  INT32_C(    69470724),  INT32_C(    69470724),  INT32_C(           0),  INT32_C(  1413365006), -INT32_C(    67112965),
+        -INT32_C(   268441617),  INT32_C(  1542911548), -INT32_C(  1074135937),  INT32_C(      286856),  INT32_C(  1542911548), -INT32_C(   828813405),  INT32_C(    69470724), -INT32_C(   268435521) } },
+    { {  INT32_C(          64), -INT32_C(           1),  INT32_C(          28),  INT32_C(         149), -INT32_C(         242), -INT32_C(         123),  INT32_C(          29), -INT32_C(          12),
+         INT32_C(          58), -INT32_C(         173), -INT32_C(         204),  INT32_C(         250),  INT32_C(         213),  INT32_C(          34), -INT32_C(          70),  INT32_C(          18) },
+      { -INT32_C(        4129), -INT32_C(        1282),  INT32_C(    34604096), -INT32_C(   100663297),  INT32_C(     1050624), -INT32_C(  2107239003), -INT32_C(  1461014303),  INT32_C(  1257566851),
+        -INT32_C(  1824101607),  INT32_C(   703799354), -INT32_C(   536872609), -INT32_C(    71435873), -INT32_C(      528401),  INT32_C(   134217729), -INT32_C(   704441711),  INT32_C(  1755426448) },
+      { -INT32_C(        4129), -INT32_C(        1282),  INT32_C(    34604096), -INT32_C(   100663297),  INT32_C(     1050624), -INT32_C(  2107239003), -INT32_C(  1461014303),  INT32_C(  1257566851),
+        -INT32_C(  1824101607),  INT32_C(   703799354), -INT32_C(   536872609), -INT32_C(    71435873), -INT32_C(      528401),  INT32_C(   134217729), -INT32_C(   704441711),  INT32_C(  1755426448) } },
+    { { -INT32_C(          96), -INT32_C(          33), -INT32_C(         129), -INT32_C(         156),  INT32_C(          91),  INT32_C(         222), -INT32_C(         201), -INT32_C(         208),
+         INT32_C(          72), -INT32_C(         129),  INT32_C(          91),  INT32_C(         222), -INT32_C(         156), -INT32_C(          96), -INT32_C(          96), -INT32_C(          96) },
+      {  INT32_C(  1285111975),  INT32_C(   671090880), -INT32_C(       16405), -INT32_C(   593494019), -INT32_C(   246902396),  INT32_C(  2130509823),  INT32_C(     1590016), -INT32_C(         129),
+         INT32_C(  1376051755), -INT32_C(      114691), -INT32_C(  1312554609), -INT32_C(   119777394),  INT32_C(  1275915734),  INT32_C(  1550079260),  INT32_C(  2141340891),  INT32_C(  1577587410) },
+      {  INT32_C(  1577587410),  INT32_C(   671090880), -INT32_C(      114691),  INT32_C(  1275915734), -INT32_C(  1312554609), -INT32_C(   119777394),  INT32_C(     1590016), -INT32_C(         129),
+         INT32_C(  1376051755), -INT32_C(      114691), -INT32_C(  1312554609), -INT32_C(   119777394),  INT32_C(  1275915734),  INT32_C(  1577587410),  INT32_C(  1577587410),  INT32_C(  1577587410) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde_mm512_i32scatter_epi32(&(i32_buffer[2048]), vindex, a, 8);
+
+    int32_t r[16] = { 0 };
+    for (size_t j = 0 ; j < 16 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x16(simde_mm512_loadu_epi32(r), simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    {      UINT16_MAX,
+      {  INT32_C(         118),  INT32_C(         464), -INT32_C(         300),  INT32_C(         314),  INT32_C(         402),  INT32_C(         334), -INT32_C(          40),  INT32_C(         302),
+        -INT32_C(         288), -INT32_C(         182), -INT32_C(         140),  INT32_C(          62), -INT32_C(          24),  INT32_C(          92), -INT32_C(         154), -INT32_C(         216) },
+      { -INT32_C(      262153), -INT32_C(         257), -INT32_C(   113789896), -INT32_C(   546341009),  INT32_C(   812942681),  INT32_C(   722277897), -INT32_C(   837971456), -INT32_C(  1056759804),
+         INT32_C(  1077938464), -INT32_C(  1887524688), -INT32_C(   805308417),  INT32_C(  2132538179),  INT32_C(   103102932), -INT32_C(  1111903234),  INT32_C(    35671056),  INT32_C(  1781902115) },
+      { -INT32_C(      262153), -INT32_C(         257), -INT32_C(   113789896), -INT32_C(   546341009),  INT32_C(   812942681),  INT32_C(   722277897), -INT32_C(   837971456), -INT32_C(  1056759804),
+         INT32_C(  1077938464), -INT32_C(  1887524688), -INT32_C(   805308417),  INT32_C(  2132538179),  INT32_C(   103102932), -INT32_C(  1111903234),  INT32_C(    35671056),  INT32_C(  1781902115) } },
+    { UINT16_C(64158),
+      {  INT32_C(         206), -INT32_C(         482),  INT32_C(         272),  INT32_C(         206), -INT32_C(         482),  INT32_C(         272), -INT32_C(          26), -INT32_C(         232),
+         INT32_C(          16), -INT32_C(         204),  INT32_C(          84),  INT32_C(         114),  INT32_C(         468), -INT32_C(         482),  INT32_C(         206), -INT32_C(         162) },
+      { -INT32_C(  1275600907), -INT32_C(    17382971),  INT32_C(  1250473904),  INT32_C(   223523849), -INT32_C(  1239288121), -INT32_C(  1073775106),  INT32_C(        8192),  INT32_C(     4325506),
+         INT32_C(       28672), -INT32_C(   274020774),  INT32_C(  1697925832),  INT32_C(  2109177775),  INT32_C(   589191680), -INT32_C(    35652097), -INT32_C(   268452035),  INT32_C(    33763182) },
+      { -INT32_C(   268452035), -INT32_C(    35652097),  INT32_C(  1250473904), -INT32_C(   268452035), -INT32_C(    35652097),  INT32_C(  1250473904), -INT32_C(          39),  INT32_C(     4325506),
+         INT32_C(          24), -INT32_C(   274020774),  INT32_C(         126),  INT32_C(  2109177775),  INT32_C(   589191680), -INT32_C(    35652097), -INT32_C(   268452035),  INT32_C(    33763182) } },
+    { UINT16_C( 3249),
+      {  INT32_C(         184),  INT32_C(         412), -INT32_C(          22), -INT32_C(         464),  INT32_C(         480), -INT32_C(         362), -INT32_C(         400), -INT32_C(         450),
+         INT32_C(         410),  INT32_C(         292), -INT32_C(         500), -INT32_C(         378),  INT32_C(         174),  INT32_C(          70),  INT32_C(         160), -INT32_C(          72) },
+      { -INT32_C(   468077336), -INT32_C(    62027020), -INT32_C(    33554689), -INT32_C(  2147417272),  INT32_C(   268435780), -INT32_C(       73762), -INT32_C(          37), -INT32_C(    33685505),
+         INT32_C(  1360219311),  INT32_C(  1073381374),  INT32_C(           4),  INT32_C(   536883200),  INT32_C(   603980800),  INT32_C(  1647040403), -INT32_C(    18219009), -INT32_C(  1710219041) },
+      { -INT32_C(   468077336),  INT32_C(         618), -INT32_C(          33), -INT32_C(         696),  INT32_C(   268435780), -INT32_C(       73762), -INT32_C(         600), -INT32_C(    33685505),
+         INT32_C(         615),  INT32_C(         438),  INT32_C(           4),  INT32_C(   536883200),  INT32_C(         261),  INT32_C(         105),  INT32_C(         240), -INT32_C(         108) } },
+    { UINT16_C(44916),
+      {  INT32_C(         446),  INT32_C(         206),  INT32_C(          86),  INT32_C(         446), -INT32_C(         222),  INT32_C(         230), -INT32_C(         464),  INT32_C(         262),
+         INT32_C(          52),  INT32_C(          52), -INT32_C(         138), -INT32_C(          16), -INT32_C(         282), -INT32_C(         216),  INT32_C(         332), -INT32_C(         196) },
+      { -INT32_C(      133249),  INT32_C(  1382932186),  INT32_C(   268461120), -INT32_C(    34665451), -INT32_C(   907418187),  INT32_C(   182008719),  INT32_C(    67125312), -INT32_C(    18874369),
+        -INT32_C(     5242882),  INT32_C(    67109184), -INT32_C(     4194317), -INT32_C(    67108897), -INT32_C(  1235163118),  INT32_C(     2099232), -INT32_C(   575384810), -INT32_C(   571482643) },
+      {  INT32_C(         669),  INT32_C(         309),  INT32_C(   268461120),  INT32_C(         669), -INT32_C(   907418187),  INT32_C(   182008719),  INT32_C(    67125312),  INT32_C(         393),
+         INT32_C(    67109184),  INT32_C(    67109184), -INT32_C(     4194317), -INT32_C(    67108897), -INT32_C(         423),  INT32_C(     2099232),  INT32_C(         498), -INT32_C(   571482643) } },
+    { UINT16_C(43609),
+      {  INT32_C(         230), -INT32_C(         486), -INT32_C(         174),  INT32_C(          78),  INT32_C(         308), -INT32_C(         116),  INT32_C(         386), -INT32_C(         394),
+         INT32_C(         134),  INT32_C(         444), -INT32_C(         344),  INT32_C(         266),  INT32_C(          12), -INT32_C(          88), -INT32_C(         336), -INT32_C(         320) },
+      { -INT32_C(   415429871),  INT32_C(   270824871), -INT32_C(    20971589),  INT32_C(    67928321),  INT32_C(     7370620), -INT32_C(  1577058044),  INT32_C(   151125226), -INT32_C(   536870950),
+         INT32_C(   852414322),  INT32_C(     8388609),  INT32_C(  1983234619),  INT32_C(           1), -INT32_C(  1149183508),  INT32_C(  2080276479), -INT32_C(   807665729), -INT32_C(    33825317) },
+      { -INT32_C(   415429871), -INT32_C(         729), -INT32_C(         261),  INT32_C(    67928321),  INT32_C(     7370620), -INT32_C(         174),  INT32_C(   151125226), -INT32_C(         591),
+         INT32_C(         201),  INT32_C(     8388609), -INT32_C(         516),  INT32_C(           1),  INT32_C(          18),  INT32_C(  2080276479), -INT32_C(         504), -INT32_C(    33825317) } },
+    { UINT16_C( 7513),
+      {  INT32_C(         124),  INT32_C(         124),  INT32_C(         124),  INT32_C(         124),  INT32_C(         124),  INT32_C(         106),  INT32_C(         124),  INT32_C(          42),
+         INT32_C(         124),  INT32_C(         124), -INT32_C(         508), -INT32_C(          56), -INT32_C(         174), -INT32_C(         432), -INT32_C(          44), -INT32_C(         330) },
+      { -INT32_C(    69500961),  INT32_C(   387104614), -INT32_C(   669669213), -INT32_C(  1207428623),  INT32_C(   268439561), -INT32_C(    33591425),  INT32_C(  1649056328), -INT32_C(   541081606),
+         INT32_C(  1631579474), -INT32_C(  1610743809), -INT32_C(     1048578),  INT32_C(     1064969),  INT32_C(   158421372),  INT32_C(  1296575078),  INT32_C(   448829771),  INT32_C(  2130439165) },
+      {  INT32_C(  1631579474),  INT32_C(  1631579474),  INT32_C(  1631579474),  INT32_C(  1631579474),  INT32_C(  1631579474),  INT32_C(         159),  INT32_C(  1631579474),  INT32_C(          63),
+         INT32_C(  1631579474),  INT32_C(  1631579474), -INT32_C(     1048578),  INT32_C(     1064969),  INT32_C(   158421372), -INT32_C(         648), -INT32_C(          66), -INT32_C(         495) } },
+    { UINT16_C(51142),
+      { -INT32_C(         264),  INT32_C(         478), -INT32_C(          92),  INT32_C(         296),  INT32_C(         158),  INT32_C(          34),  INT32_C(          20), -INT32_C(         396),
+         INT32_C(          68), -INT32_C(         352),  INT32_C(         172), -INT32_C(         224),  INT32_C(         342), -INT32_C(         346),  INT32_C(         174),  INT32_C(           6) },
+      { -INT32_C(  1238723032),  INT32_C(   113381664),  INT32_C(  1256707345), -INT32_C(          17), -INT32_C(  1089261626),  INT32_C(  1783935664),  INT32_C(  1610612735), -INT32_C(  1362358455),
+         INT32_C(   138444800), -INT32_C(   150994949),  INT32_C(   810582016),  INT32_C(  1813868692),  INT32_C(  1672637224), -INT32_C(  1705877177), -INT32_C(      525313),  INT32_C(     1196112) },
+      { -INT32_C(         396),  INT32_C(   113381664),  INT32_C(  1256707345),  INT32_C(         444),  INT32_C(         237),  INT32_C(          51),  INT32_C(  1610612735), -INT32_C(  1362358455),
+         INT32_C(   138444800), -INT32_C(   150994949),  INT32_C(   810582016), -INT32_C(         336),  INT32_C(         513), -INT32_C(         519), -INT32_C(      525313),  INT32_C(     1196112) } },
+    { UINT16_C( 9311),
+      {  INT32_C(         410),  INT32_C(         410), -INT32_C(          38), -INT32_C(         146), -INT32_C(         504), -INT32_C(         504), -INT32_C(          46), -INT32_C(         124),
+         INT32_C(         190), -INT32_C(          86),  INT32_C(         402), -INT32_C(          86), -INT32_C(         504),  INT32_C(         410), -INT32_C(         124),  INT32_C(         204) },
+      { -INT32_C(       66563),  INT32_C(  1880525630), -INT32_C(      131081),  INT32_C(  1079052296),  INT32_C(    33693696),  INT32_C(   154132757), -INT32_C(   436207873), -INT32_C(   281232178),
+         INT32_C(   283493035),  INT32_C(  2117785778), -INT32_C(   336544322), -INT32_C(  2077599256),  INT32_C(   789822501),  INT32_C(   828913777),  INT32_C(  1299243521), -INT32_C(  1078198273) },
+      {  INT32_C(   828913777),  INT32_C(   828913777), -INT32_C(      131081),  INT32_C(  1079052296),  INT32_C(    33693696),  INT32_C(    33693696), -INT32_C(   436207873), -INT32_C(         186),
+         INT32_C(         285), -INT32_C(         129), -INT32_C(   336544322), -INT32_C(         129),  INT32_C(    33693696),  INT32_C(   828913777), -INT32_C(         186),  INT32_C(         306) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde_mm512_mask_i32scatter_epi32(&(i32_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    int32_t r[16] = { 0 };
+    for (size_t j = 0 ; j < 16 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x16(simde_mm512_loadu_epi32(r), simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(          98),  INT32_C(         208),  INT32_C(         172),  INT32_C(         105),  INT32_C(         241), -INT32_C(          71),  INT32_C(         250), -INT32_C(         232) },
+      {  INT64_C(   63668994330591621),  INT64_C( 7869724995967822584),  INT64_C( 4035586498899090770),  INT64_C( 2554979760383549065),
+        -INT64_C( 3628233346139343586),  INT64_C( 4612389843593330946), -INT64_C( 8263559256793866605), -INT64_C(  288232581617418241) },
+      {  INT64_C(   63668994330591621),  INT64_C( 7869724995967822584),  INT64_C( 4035586498899090770),  INT64_C( 2554979760383549065),
+        -INT64_C( 3628233346139343586),  INT64_C( 4612389843593330946), -INT64_C( 8263559256793866605), -INT64_C(  288232581617418241) } },
+    { {  INT32_C(         101),  INT32_C(         101),  INT32_C(         144),  INT32_C(          46),  INT32_C(           2),  INT32_C(          63),  INT32_C(         101),  INT32_C(         101) },
+      {  INT64_C(  116707342273231839), -INT64_C(    4505798650888193), -INT64_C(  210939367863065939),  INT64_C(      12163659999232),
+         INT64_C( 4905603015120267794),  INT64_C( 2342012543721537570), -INT64_C( 2237096501424700572),  INT64_C(  941819672536285200) },
+      {  INT64_C(  941819672536285200),  INT64_C(  941819672536285200), -INT64_C(  210939367863065939),  INT64_C(      12163659999232),
+         INT64_C( 4905603015120267794),  INT64_C( 2342012543721537570),  INT64_C(  941819672536285200),  INT64_C(  941819672536285200) } },
+    { {  INT32_C(         175),  INT32_C(         143),  INT32_C(          86), -INT32_C(         199),  INT32_C(         230),  INT32_C(         148),  INT32_C(         145), -INT32_C(          29) },
+      { -INT64_C( 1173193200723036161), -INT64_C( 2638598312221048804), -INT64_C( 3751709600731104257),  INT64_C( 7495183302506618486),
+         INT64_C( 4715548657022517320),  INT64_C( 2070214482465493166), -INT64_C( 4684166378981253121),  INT64_C( 4383029556896572027) },
+      { -INT64_C( 1173193200723036161), -INT64_C( 2638598312221048804), -INT64_C( 3751709600731104257),  INT64_C( 7495183302506618486),
+         INT64_C( 4715548657022517320),  INT64_C( 2070214482465493166), -INT64_C( 4684166378981253121),  INT64_C( 4383029556896572027) } },
+    { { -INT32_C(         152), -INT32_C(         105), -INT32_C(         105),  INT32_C(          91), -INT32_C(         138),  INT32_C(          41), -INT32_C(         138),  INT32_C(         152) },
+      {  INT64_C(     299068383453696),  INT64_C( 1803973125877268480),  INT64_C( 1989646598606757151), -INT64_C(  395294227254025699),
+        -INT64_C(     116550380028049), -INT64_C( 7329807585350944610), -INT64_C(  576742236962691073),  INT64_C( 4339923506974561993) },
+      {  INT64_C(     299068383453696),  INT64_C( 1989646598606757151),  INT64_C( 1989646598606757151), -INT64_C(  395294227254025699),
+        -INT64_C(  576742236962691073), -INT64_C( 7329807585350944610), -INT64_C(  576742236962691073),  INT64_C( 4339923506974561993) } },
+    { { -INT32_C(         189),  INT32_C(         204), -INT32_C(          22),  INT32_C(         254),  INT32_C(          84),  INT32_C(          64),  INT32_C(         245), -INT32_C(          40) },
+      { -INT64_C( 6105008531743306519), -INT64_C(  292738373842378793),  INT64_C( 5692549890332138907), -INT64_C( 4612812055787864769),
+         INT64_C(  360850928867213312), -INT64_C( 4778757560961930547), -INT64_C(       4398066040833), -INT64_C( 1562440783380086620) },
+      { -INT64_C( 6105008531743306519), -INT64_C(  292738373842378793),  INT64_C( 5692549890332138907), -INT64_C( 4612812055787864769),
+         INT64_C(  360850928867213312), -INT64_C( 4778757560961930547), -INT64_C(       4398066040833), -INT64_C( 1562440783380086620) } },
+    { {  INT32_C(         211),  INT32_C(         248), -INT32_C(         214),  INT32_C(         211),  INT32_C(         248),  INT32_C(         211),  INT32_C(         182), -INT32_C(         214) },
+      { -INT64_C( 2668466169176474621),  INT64_C( 4264322257104906708),  INT64_C( 3752841541985126998),  INT64_C( 6056355414928895555),
+        -INT64_C( 2323861805769687073), -INT64_C( 1168684897889157189),  INT64_C( 4576387793389274556),  INT64_C(    9218340115710368) },
+      { -INT64_C( 1168684897889157189), -INT64_C( 2323861805769687073),  INT64_C(    9218340115710368), -INT64_C( 1168684897889157189),
+        -INT64_C( 2323861805769687073), -INT64_C( 1168684897889157189),  INT64_C( 4576387793389274556),  INT64_C(    9218340115710368) } },
+    { {  INT32_C(         206),  INT32_C(          47),  INT32_C(          44),  INT32_C(          27), -INT32_C(          38),  INT32_C(         189),  INT32_C(          67),  INT32_C(          64) },
+      {  INT64_C( 9126170704219442040),  INT64_C( 4259323059606823598), -INT64_C(   27022697275983937), -INT64_C( 2735837258433330416),
+         INT64_C( 2338992330220538705),  INT64_C( 9223297261398261759),  INT64_C(  144124053458945024),  INT64_C(    5629499535786368) },
+      {  INT64_C( 9126170704219442040),  INT64_C( 4259323059606823598), -INT64_C(   27022697275983937), -INT64_C( 2735837258433330416),
+         INT64_C( 2338992330220538705),  INT64_C( 9223297261398261759),  INT64_C(  144124053458945024),  INT64_C(    5629499535786368) } },
+    { { -INT32_C(         141), -INT32_C(         250), -INT32_C(         115), -INT32_C(         176), -INT32_C(         176), -INT32_C(         218), -INT32_C(         184), -INT32_C(         115) },
+      { -INT64_C( 3422531114186188225), -INT64_C(   54201811086606339), -INT64_C( 2141084239868727475), -INT64_C( 8986618917698524339),
+         INT64_C(  289358477229359680), -INT64_C( 6940049833092712451),  INT64_C( 3302222867116382406), -INT64_C( 9182417324664159616) },
+      { -INT64_C( 3422531114186188225), -INT64_C(   54201811086606339), -INT64_C( 9182417324664159616),  INT64_C(  289358477229359680),
+         INT64_C(  289358477229359680), -INT64_C( 6940049833092712451),  INT64_C( 3302222867116382406), -INT64_C( 9182417324664159616) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_i32scatter_epi64(&(i64_buffer[2048]), vindex, a, 8);
+
+    int64_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x8(simde_mm512_loadu_epi64(r), simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT32_C(          90),  INT32_C(          46),  INT32_C(         170), -INT32_C(         454), -INT32_C(          80),  INT32_C(         414), -INT32_C(         464),  INT32_C(         106) },
+      {  INT64_C( 5766277353280354113),  INT64_C( 7601099719726184911), -INT64_C(     141905796071441),  INT64_C( 6917531227738079232),
+        -INT64_C(  328762725214191171),  INT64_C(  144124001348766016),  INT64_C(  843176055575514435),  INT64_C(  914732793180749768) },
+      {  INT64_C( 5766277353280354113),  INT64_C( 7601099719726184911), -INT64_C(     141905796071441),  INT64_C( 6917531227738079232),
+        -INT64_C(  328762725214191171),  INT64_C(  144124001348766016),  INT64_C(  843176055575514435),  INT64_C(  914732793180749768) } },
+    { UINT8_C(104),
+      { -INT32_C(          22), -INT32_C(          46),  INT32_C(         432), -INT32_C(         494),  INT32_C(         392), -INT32_C(         106), -INT32_C(         106), -INT32_C(         392) },
+      { -INT64_C( 5886537292760818927),  INT64_C( 8687695109742622567), -INT64_C(  782106375204983392),  INT64_C(   40884246809724032),
+         INT64_C(  960276187931761075),  INT64_C( 4716843592253342421),  INT64_C( 3025005396491523489), -INT64_C(           142619266) },
+      { -INT64_C(         47244640267), -INT64_C(         98784247831),  INT64_C(        927712936152),  INT64_C(   40884246809724032),
+         INT64_C(        841813590212),  INT64_C( 3025005396491523489),  INT64_C( 3025005396491523489), -INT64_C(        841813590212) } },
+    { UINT8_C(210),
+      { -INT32_C(           6), -INT32_C(          80), -INT32_C(          94), -INT32_C(         476),  INT32_C(          28), -INT32_C(         468),  INT32_C(          94),  INT32_C(          18) },
+      { -INT64_C(  144119586126823445),  INT64_C(  255529611178839307), -INT64_C(   18016872411168773), -INT64_C( 4683781000289976369),
+        -INT64_C( 1156334388967969793),  INT64_C( 2143131665463104712), -INT64_C(    5638329986973705),  INT64_C( 9101957877180995788) },
+      { -INT64_C(         12884901891),  INT64_C(  255529611178839307), -INT64_C(        201863462959), -INT64_C(       1022202216686),
+        -INT64_C( 1156334388967969793), -INT64_C(       1005022347498), -INT64_C(    5638329986973705),  INT64_C( 9101957877180995788) } },
+    { UINT8_C(230),
+      {  INT32_C(         116),  INT32_C(          96), -INT32_C(         316),  INT32_C(         508), -INT32_C(          22),  INT32_C(         116), -INT32_C(          38),  INT32_C(         480) },
+      { -INT64_C(  147515880041793302), -INT64_C( 1213737726392926473),  INT64_C( 6672768878079309209), -INT64_C(       4677219663873),
+        -INT64_C( 2307398780894361101), -INT64_C(  904826688809631495), -INT64_C(     215512871075841), -INT64_C( 3930365249119251636) },
+      { -INT64_C(  904826688809631495), -INT64_C( 1213737726392926473),  INT64_C( 6672768878079309209),  INT64_C(       1090921693438),
+        -INT64_C(         47244640267), -INT64_C(  904826688809631495), -INT64_C(     215512871075841), -INT64_C( 3930365249119251636) } },
+    { UINT8_C(215),
+      {  INT32_C(         468),  INT32_C(         254),  INT32_C(         436), -INT32_C(         124), -INT32_C(         132), -INT32_C(          54), -INT32_C(         222),  INT32_C(           0) },
+      { -INT64_C( 2105143169794138657),  INT64_C(  144117456422604890),  INT64_C(  228034874656749107),  INT64_C( 1042761125227856066),
+         INT64_C( 6709735536800952167), -INT64_C( 7601712947994230661), -INT64_C( 9151169169691762684),  INT64_C( 4552475252396868140) },
+      { -INT64_C( 2105143169794138657),  INT64_C(  144117456422604890),  INT64_C(  228034874656749107), -INT64_C(        266287972414),
+         INT64_C( 6709735536800952167), -INT64_C(        115964117019), -INT64_C( 9151169169691762684),  INT64_C( 4552475252396868140) } },
+    { UINT8_C(152),
+      {  INT32_C(         442), -INT32_C(          58),  INT32_C(         498),  INT32_C(          28), -INT32_C(          58),  INT32_C(          32), -INT32_C(         304),  INT32_C(          28) },
+      { -INT64_C( 3438136655072594959),  INT64_C( 5201291796952150839),  INT64_C( 3147519808541108932),  INT64_C(   22518069004895232),
+         INT64_C( 6023969744803008515),  INT64_C( 3463427544848531522),  INT64_C(  428888917549970693),  INT64_C( 7554123927851438169) },
+      {  INT64_C(        949187772637),  INT64_C( 6023969744803008515),  INT64_C(       1069446856953),  INT64_C( 7554123927851438169),
+         INT64_C( 6023969744803008515),  INT64_C(         68719476752), -INT64_C(        652835029144),  INT64_C( 7554123927851438169) } },
+    { UINT8_C(108),
+      { -INT32_C(           6),  INT32_C(         478),  INT32_C(         248),  INT32_C(         422), -INT32_C(         264),  INT32_C(          92), -INT32_C(         316),  INT32_C(         266) },
+      {  INT64_C( 1847062603549719277),  INT64_C(  799241912181292184), -INT64_C(   18296165629165569), -INT64_C(  144115463054430209),
+         INT64_C( 8141394204921688620),  INT64_C( 5476377149099343872),  INT64_C( 2308675351167467520), -INT64_C( 1067657383679095472) },
+      { -INT64_C(         12884901891),  INT64_C(       1026497183983), -INT64_C(   18296165629165569), -INT64_C(  144115463054430209),
+        -INT64_C(        566935683204),  INT64_C( 5476377149099343872),  INT64_C( 2308675351167467520),  INT64_C(        571230650501) } },
+    { UINT8_C( 21),
+      { -INT32_C(         410), -INT32_C(         410), -INT32_C(         410),  INT32_C(         492), -INT32_C(          44), -INT32_C(         266), -INT32_C(         410),  INT32_C(           0) },
+      {  INT64_C(  738695892005028096), -INT64_C( 1155314076318957601),  INT64_C( 6125650408271137647), -INT64_C(     571763226345505),
+         INT64_C( 7429756596872610820),  INT64_C(  153263124902903874), -INT64_C(     563499843452929),  INT64_C( 5151599385600954658) },
+      {  INT64_C( 6125650408271137647),  INT64_C( 6125650408271137647),  INT64_C( 6125650408271137647),  INT64_C(       1056561955062),
+         INT64_C( 7429756596872610820), -INT64_C(        571230650501),  INT64_C( 6125650408271137647),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_mask_i32scatter_epi64(&(i64_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    int64_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x8(simde_mm512_loadu_epi64(r), simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { -INT32_C(         210), -INT32_C(          36),  INT32_C(         143),  INT32_C(         227), -INT32_C(         115),  INT32_C(         159),  INT32_C(         214),  INT32_C(         170),
+        -INT32_C(          51), -INT32_C(           5),  INT32_C(         153), -INT32_C(         163),  INT32_C(         212),  INT32_C(         136),  INT32_C(         174), -INT32_C(         163) },
+      { SIMDE_FLOAT32_C( -2027.50), SIMDE_FLOAT32_C( -3799.25), SIMDE_FLOAT32_C(  -148.25), SIMDE_FLOAT32_C( -5090.00),
+        SIMDE_FLOAT32_C(  8942.25), SIMDE_FLOAT32_C( -3586.50), SIMDE_FLOAT32_C( -2653.00), SIMDE_FLOAT32_C( -7627.00),
+        SIMDE_FLOAT32_C(  -343.00), SIMDE_FLOAT32_C(  -940.50), SIMDE_FLOAT32_C(  3800.50), SIMDE_FLOAT32_C( -5428.50),
+        SIMDE_FLOAT32_C( -8508.50), SIMDE_FLOAT32_C(  1973.75), SIMDE_FLOAT32_C( -3054.00), SIMDE_FLOAT32_C(  6188.00) },
+      { SIMDE_FLOAT32_C( -2027.50), SIMDE_FLOAT32_C( -3799.25), SIMDE_FLOAT32_C(  -148.25), SIMDE_FLOAT32_C( -5090.00),
+        SIMDE_FLOAT32_C(  8942.25), SIMDE_FLOAT32_C( -3586.50), SIMDE_FLOAT32_C( -2653.00), SIMDE_FLOAT32_C( -7627.00),
+        SIMDE_FLOAT32_C(  -343.00), SIMDE_FLOAT32_C(  -940.50), SIMDE_FLOAT32_C(  3800.50), SIMDE_FLOAT32_C(  6188.00),
+        SIMDE_FLOAT32_C( -8508.50), SIMDE_FLOAT32_C(  1973.75), SIMDE_FLOAT32_C( -3054.00), SIMDE_FLOAT32_C(  6188.00) } },
+    { { -INT32_C(          17), -INT32_C(          17), -INT32_C(         198), -INT32_C(         198), -INT32_C(         198), -INT32_C(          44),  INT32_C(          79), -INT32_C(         168),
+         INT32_C(          67), -INT32_C(         110), -INT32_C(          17), -INT32_C(          38), -INT32_C(         198),  INT32_C(          10), -INT32_C(         198),  INT32_C(          96) },
+      { SIMDE_FLOAT32_C( -9328.75), SIMDE_FLOAT32_C( -3809.00), SIMDE_FLOAT32_C( -2821.25), SIMDE_FLOAT32_C(  6566.75),
+        SIMDE_FLOAT32_C(  7420.25), SIMDE_FLOAT32_C( -4674.00), SIMDE_FLOAT32_C(  7736.50), SIMDE_FLOAT32_C(  -165.25),
+        SIMDE_FLOAT32_C(  -886.75), SIMDE_FLOAT32_C(  8441.00), SIMDE_FLOAT32_C(  6564.25), SIMDE_FLOAT32_C(   768.25),
+        SIMDE_FLOAT32_C(  2730.00), SIMDE_FLOAT32_C(  8730.50), SIMDE_FLOAT32_C( -4255.25), SIMDE_FLOAT32_C(  8589.75) },
+      { SIMDE_FLOAT32_C(  6564.25), SIMDE_FLOAT32_C(  6564.25), SIMDE_FLOAT32_C( -4255.25), SIMDE_FLOAT32_C( -4255.25),
+        SIMDE_FLOAT32_C( -4255.25), SIMDE_FLOAT32_C( -4674.00), SIMDE_FLOAT32_C(  7736.50), SIMDE_FLOAT32_C(  -165.25),
+        SIMDE_FLOAT32_C(  -886.75), SIMDE_FLOAT32_C(  8441.00), SIMDE_FLOAT32_C(  6564.25), SIMDE_FLOAT32_C(   768.25),
+        SIMDE_FLOAT32_C( -4255.25), SIMDE_FLOAT32_C(  8730.50), SIMDE_FLOAT32_C( -4255.25), SIMDE_FLOAT32_C(  8589.75) } },
+    { {  INT32_C(         250), -INT32_C(          81), -INT32_C(         165), -INT32_C(          91), -INT32_C(         121), -INT32_C(         147), -INT32_C(          81),  INT32_C(         154),
+        -INT32_C(          65), -INT32_C(         202), -INT32_C(          32),  INT32_C(          45), -INT32_C(          70), -INT32_C(         122), -INT32_C(         194),  INT32_C(         169) },
+      { SIMDE_FLOAT32_C(  3282.75), SIMDE_FLOAT32_C( -6029.75), SIMDE_FLOAT32_C(  4287.25), SIMDE_FLOAT32_C( -7389.75),
+        SIMDE_FLOAT32_C( -9322.75), SIMDE_FLOAT32_C( -5532.50), SIMDE_FLOAT32_C( -6047.50), SIMDE_FLOAT32_C(  3765.50),
+        SIMDE_FLOAT32_C(  3612.50), SIMDE_FLOAT32_C( -7098.75), SIMDE_FLOAT32_C( -5997.50), SIMDE_FLOAT32_C( -7634.75),
+        SIMDE_FLOAT32_C(  5419.50), SIMDE_FLOAT32_C( -1446.75), SIMDE_FLOAT32_C(  5896.00), SIMDE_FLOAT32_C(  4626.25) },
+      { SIMDE_FLOAT32_C(  3282.75), SIMDE_FLOAT32_C( -6047.50), SIMDE_FLOAT32_C(  4287.25), SIMDE_FLOAT32_C( -7389.75),
+        SIMDE_FLOAT32_C( -9322.75), SIMDE_FLOAT32_C( -5532.50), SIMDE_FLOAT32_C( -6047.50), SIMDE_FLOAT32_C(  3765.50),
+        SIMDE_FLOAT32_C(  3612.50), SIMDE_FLOAT32_C( -7098.75), SIMDE_FLOAT32_C( -5997.50), SIMDE_FLOAT32_C( -7634.75),
+        SIMDE_FLOAT32_C(  5419.50), SIMDE_FLOAT32_C( -1446.75), SIMDE_FLOAT32_C(  5896.00), SIMDE_FLOAT32_C(  4626.25) } },
+    { {  INT32_C(         214),  INT32_C(         117),  INT32_C(         247),  INT32_C(         247),  INT32_C(         148),  INT32_C(         117),  INT32_C(         190),  INT32_C(         117),
+        -INT32_C(         194), -INT32_C(         234),  INT32_C(         177),  INT32_C(           9),  INT32_C(          90), -INT32_C(         157), -INT32_C(         144), -INT32_C(         104) },
+      { SIMDE_FLOAT32_C(  8617.75), SIMDE_FLOAT32_C(  -468.75), SIMDE_FLOAT32_C( -6870.00), SIMDE_FLOAT32_C( -6802.25),
+        SIMDE_FLOAT32_C( -7698.50), SIMDE_FLOAT32_C(  -937.00), SIMDE_FLOAT32_C( -3848.25), SIMDE_FLOAT32_C(  2213.50),
+        SIMDE_FLOAT32_C(  3273.50), SIMDE_FLOAT32_C( -5648.75), SIMDE_FLOAT32_C( -6466.75), SIMDE_FLOAT32_C( -3619.75),
+        SIMDE_FLOAT32_C( -1466.50), SIMDE_FLOAT32_C(  2558.25), SIMDE_FLOAT32_C( -8890.75), SIMDE_FLOAT32_C(   309.50) },
+      { SIMDE_FLOAT32_C(  8617.75), SIMDE_FLOAT32_C(  2213.50), SIMDE_FLOAT32_C( -6802.25), SIMDE_FLOAT32_C( -6802.25),
+        SIMDE_FLOAT32_C( -7698.50), SIMDE_FLOAT32_C(  2213.50), SIMDE_FLOAT32_C( -3848.25), SIMDE_FLOAT32_C(  2213.50),
+        SIMDE_FLOAT32_C(  3273.50), SIMDE_FLOAT32_C( -5648.75), SIMDE_FLOAT32_C( -6466.75), SIMDE_FLOAT32_C( -3619.75),
+        SIMDE_FLOAT32_C( -1466.50), SIMDE_FLOAT32_C(  2558.25), SIMDE_FLOAT32_C( -8890.75), SIMDE_FLOAT32_C(   309.50) } },
+    { {  INT32_C(         178), -INT32_C(         164),  INT32_C(         128), -INT32_C(         237),  INT32_C(          40),  INT32_C(          60),  INT32_C(         125), -INT32_C(          64),
+        -INT32_C(         175), -INT32_C(         142), -INT32_C(          77),  INT32_C(         207),  INT32_C(         205),  INT32_C(          87), -INT32_C(         170), -INT32_C(         205) },
+      { SIMDE_FLOAT32_C( -6207.50), SIMDE_FLOAT32_C( -1821.50), SIMDE_FLOAT32_C( -1213.00), SIMDE_FLOAT32_C(  6879.25),
+        SIMDE_FLOAT32_C( -5130.50), SIMDE_FLOAT32_C(  4086.00), SIMDE_FLOAT32_C(  9776.50), SIMDE_FLOAT32_C( -3554.25),
+        SIMDE_FLOAT32_C(  5449.25), SIMDE_FLOAT32_C( -1165.50), SIMDE_FLOAT32_C( -1654.75), SIMDE_FLOAT32_C( -9094.25),
+        SIMDE_FLOAT32_C(  9074.75), SIMDE_FLOAT32_C(  2810.50), SIMDE_FLOAT32_C( -6056.25), SIMDE_FLOAT32_C( -3289.25) },
+      { SIMDE_FLOAT32_C( -6207.50), SIMDE_FLOAT32_C( -1821.50), SIMDE_FLOAT32_C( -1213.00), SIMDE_FLOAT32_C(  6879.25),
+        SIMDE_FLOAT32_C( -5130.50), SIMDE_FLOAT32_C(  4086.00), SIMDE_FLOAT32_C(  9776.50), SIMDE_FLOAT32_C( -3554.25),
+        SIMDE_FLOAT32_C(  5449.25), SIMDE_FLOAT32_C( -1165.50), SIMDE_FLOAT32_C( -1654.75), SIMDE_FLOAT32_C( -9094.25),
+        SIMDE_FLOAT32_C(  9074.75), SIMDE_FLOAT32_C(  2810.50), SIMDE_FLOAT32_C( -6056.25), SIMDE_FLOAT32_C( -3289.25) } },
+    { { -INT32_C(         254), -INT32_C(          71), -INT32_C(          81), -INT32_C(         216),  INT32_C(         123), -INT32_C(          81), -INT32_C(         249), -INT32_C(         254),
+        -INT32_C(          83),  INT32_C(          33),  INT32_C(         123), -INT32_C(         254), -INT32_C(         208), -INT32_C(         188), -INT32_C(          81),  INT32_C(         123) },
+      { SIMDE_FLOAT32_C(  4089.25), SIMDE_FLOAT32_C( -6144.50), SIMDE_FLOAT32_C( -7160.50), SIMDE_FLOAT32_C( -7098.50),
+        SIMDE_FLOAT32_C( -6357.25), SIMDE_FLOAT32_C(  -543.75), SIMDE_FLOAT32_C(   641.00), SIMDE_FLOAT32_C( -4138.50),
+        SIMDE_FLOAT32_C( -7192.75), SIMDE_FLOAT32_C( -1316.00), SIMDE_FLOAT32_C( -2194.25), SIMDE_FLOAT32_C(  9425.75),
+        SIMDE_FLOAT32_C(  4341.75), SIMDE_FLOAT32_C( -5102.75), SIMDE_FLOAT32_C(  3587.25), SIMDE_FLOAT32_C(  6680.00) },
+      { SIMDE_FLOAT32_C(  9425.75), SIMDE_FLOAT32_C( -6144.50), SIMDE_FLOAT32_C(  3587.25), SIMDE_FLOAT32_C( -7098.50),
+        SIMDE_FLOAT32_C(  6680.00), SIMDE_FLOAT32_C(  3587.25), SIMDE_FLOAT32_C(   641.00), SIMDE_FLOAT32_C(  9425.75),
+        SIMDE_FLOAT32_C( -7192.75), SIMDE_FLOAT32_C( -1316.00), SIMDE_FLOAT32_C(  6680.00), SIMDE_FLOAT32_C(  9425.75),
+        SIMDE_FLOAT32_C(  4341.75), SIMDE_FLOAT32_C( -5102.75), SIMDE_FLOAT32_C(  3587.25), SIMDE_FLOAT32_C(  6680.00) } },
+    { { -INT32_C(         155), -INT32_C(          95), -INT32_C(         211),  INT32_C(           6), -INT32_C(          55),  INT32_C(         241),  INT32_C(         102), -INT32_C(          85),
+        -INT32_C(         170),  INT32_C(         244), -INT32_C(         151), -INT32_C(         114), -INT32_C(         152), -INT32_C(          26), -INT32_C(         165), -INT32_C(          51) },
+      { SIMDE_FLOAT32_C(  3312.00), SIMDE_FLOAT32_C(  5878.50), SIMDE_FLOAT32_C( -8757.50), SIMDE_FLOAT32_C( -6148.50),
+        SIMDE_FLOAT32_C(  2266.75), SIMDE_FLOAT32_C(  1621.00), SIMDE_FLOAT32_C(  8138.00), SIMDE_FLOAT32_C(  3619.25),
+        SIMDE_FLOAT32_C(  7414.75), SIMDE_FLOAT32_C(   270.00), SIMDE_FLOAT32_C(  2868.75), SIMDE_FLOAT32_C( -4643.50),
+        SIMDE_FLOAT32_C(  1610.75), SIMDE_FLOAT32_C( -4317.50), SIMDE_FLOAT32_C(  9116.75), SIMDE_FLOAT32_C(   569.25) },
+      { SIMDE_FLOAT32_C(  3312.00), SIMDE_FLOAT32_C(  5878.50), SIMDE_FLOAT32_C( -8757.50), SIMDE_FLOAT32_C( -6148.50),
+        SIMDE_FLOAT32_C(  2266.75), SIMDE_FLOAT32_C(  1621.00), SIMDE_FLOAT32_C(  8138.00), SIMDE_FLOAT32_C(  3619.25),
+        SIMDE_FLOAT32_C(  7414.75), SIMDE_FLOAT32_C(   270.00), SIMDE_FLOAT32_C(  2868.75), SIMDE_FLOAT32_C( -4643.50),
+        SIMDE_FLOAT32_C(  1610.75), SIMDE_FLOAT32_C( -4317.50), SIMDE_FLOAT32_C(  9116.75), SIMDE_FLOAT32_C(   569.25) } },
+    { { -INT32_C(         110),  INT32_C(         221),  INT32_C(         221), -INT32_C(          64),  INT32_C(         147), -INT32_C(         245),  INT32_C(         123), -INT32_C(         159),
+         INT32_C(         123),  INT32_C(          35),  INT32_C(          35), -INT32_C(          64), -INT32_C(         101),  INT32_C(          35), -INT32_C(         143),  INT32_C(         172) },
+      { SIMDE_FLOAT32_C( -8115.00), SIMDE_FLOAT32_C( -6661.00), SIMDE_FLOAT32_C(  -142.50), SIMDE_FLOAT32_C(  -615.25),
+        SIMDE_FLOAT32_C( -7625.00), SIMDE_FLOAT32_C(  1179.50), SIMDE_FLOAT32_C(  3947.75), SIMDE_FLOAT32_C(  4452.25),
+        SIMDE_FLOAT32_C( -5973.50), SIMDE_FLOAT32_C(  4294.00), SIMDE_FLOAT32_C(  9351.75), SIMDE_FLOAT32_C(   310.75),
+        SIMDE_FLOAT32_C(  2685.25), SIMDE_FLOAT32_C( -4496.25), SIMDE_FLOAT32_C(  1100.75), SIMDE_FLOAT32_C( -2074.50) },
+      { SIMDE_FLOAT32_C( -8115.00), SIMDE_FLOAT32_C(  -142.50), SIMDE_FLOAT32_C(  -142.50), SIMDE_FLOAT32_C(   310.75),
+        SIMDE_FLOAT32_C( -7625.00), SIMDE_FLOAT32_C(  1179.50), SIMDE_FLOAT32_C( -5973.50), SIMDE_FLOAT32_C(  4452.25),
+        SIMDE_FLOAT32_C( -5973.50), SIMDE_FLOAT32_C( -4496.25), SIMDE_FLOAT32_C( -4496.25), SIMDE_FLOAT32_C(   310.75),
+        SIMDE_FLOAT32_C(  2685.25), SIMDE_FLOAT32_C( -4496.25), SIMDE_FLOAT32_C(  1100.75), SIMDE_FLOAT32_C( -2074.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_mm512_i32scatter_ps(&(f32_buffer[2048]), vindex, a, 4);
+
+    simde_float32 r[16] = { 0 };
+    for (size_t j = 0 ; j < 16 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x16(simde_mm512_loadu_ps(r), simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    {      UINT16_MAX,
+      {  INT32_C(         420),  INT32_C(        1004), -INT32_C(         968), -INT32_C(         916),  INT32_C(         416), -INT32_C(         536), -INT32_C(         776),  INT32_C(         180),
+         INT32_C(          52), -INT32_C(         208),  INT32_C(         588),  INT32_C(         248), -INT32_C(         112), -INT32_C(         896), -INT32_C(         336), -INT32_C(         156) },
+      { SIMDE_FLOAT32_C(   918.00), SIMDE_FLOAT32_C(  4300.25), SIMDE_FLOAT32_C(   180.50), SIMDE_FLOAT32_C( -1763.50),
+        SIMDE_FLOAT32_C(  9829.75), SIMDE_FLOAT32_C(  5699.50), SIMDE_FLOAT32_C( -3418.25), SIMDE_FLOAT32_C(  1784.00),
+        SIMDE_FLOAT32_C( -5981.50), SIMDE_FLOAT32_C(  3354.25), SIMDE_FLOAT32_C( -7209.00), SIMDE_FLOAT32_C(  9161.00),
+        SIMDE_FLOAT32_C( -6344.50), SIMDE_FLOAT32_C( -7098.50), SIMDE_FLOAT32_C( -8387.75), SIMDE_FLOAT32_C( -1710.75) },
+      { SIMDE_FLOAT32_C(   918.00), SIMDE_FLOAT32_C(  4300.25), SIMDE_FLOAT32_C(   180.50), SIMDE_FLOAT32_C( -1763.50),
+        SIMDE_FLOAT32_C(  9829.75), SIMDE_FLOAT32_C(  5699.50), SIMDE_FLOAT32_C( -3418.25), SIMDE_FLOAT32_C(  1784.00),
+        SIMDE_FLOAT32_C( -5981.50), SIMDE_FLOAT32_C(  3354.25), SIMDE_FLOAT32_C( -7209.00), SIMDE_FLOAT32_C(  9161.00),
+        SIMDE_FLOAT32_C( -6344.50), SIMDE_FLOAT32_C( -7098.50), SIMDE_FLOAT32_C( -8387.75), SIMDE_FLOAT32_C( -1710.75) } },
+    { UINT16_C(33403),
+      {  INT32_C(         360),  INT32_C(         448),  INT32_C(         360),  INT32_C(         472),  INT32_C(         516),  INT32_C(         360), -INT32_C(         196), -INT32_C(         812),
+        -INT32_C(         948),  INT32_C(         360),  INT32_C(         324),  INT32_C(         892),  INT32_C(         608),  INT32_C(         484),  INT32_C(         360), -INT32_C(         584) },
+      { SIMDE_FLOAT32_C( -5686.25), SIMDE_FLOAT32_C( -6820.75), SIMDE_FLOAT32_C(  -107.00), SIMDE_FLOAT32_C(  9106.75),
+        SIMDE_FLOAT32_C(  4066.00), SIMDE_FLOAT32_C( -9945.25), SIMDE_FLOAT32_C( -3714.50), SIMDE_FLOAT32_C(  3182.00),
+        SIMDE_FLOAT32_C( -8726.75), SIMDE_FLOAT32_C(  -201.75), SIMDE_FLOAT32_C(  -885.00), SIMDE_FLOAT32_C(  7115.00),
+        SIMDE_FLOAT32_C(  8688.75), SIMDE_FLOAT32_C( -3160.75), SIMDE_FLOAT32_C( -1904.50), SIMDE_FLOAT32_C(  8066.00) },
+      { SIMDE_FLOAT32_C(  -201.75), SIMDE_FLOAT32_C( -6820.75), SIMDE_FLOAT32_C(  -201.75), SIMDE_FLOAT32_C(  9106.75),
+        SIMDE_FLOAT32_C(  4066.00), SIMDE_FLOAT32_C(  -201.75), SIMDE_FLOAT32_C( -3714.50), SIMDE_FLOAT32_C(  -101.50),
+        SIMDE_FLOAT32_C(  -118.50), SIMDE_FLOAT32_C(  -201.75), SIMDE_FLOAT32_C(    40.50), SIMDE_FLOAT32_C(   111.50),
+        SIMDE_FLOAT32_C(    76.00), SIMDE_FLOAT32_C(    60.50), SIMDE_FLOAT32_C(  -201.75), SIMDE_FLOAT32_C(  8066.00) } },
+    { UINT16_C(21532),
+      { -INT32_C(         216),  INT32_C(         712), -INT32_C(         120), -INT32_C(         328),  INT32_C(         444), -INT32_C(         896), -INT32_C(         764), -INT32_C(         200),
+        -INT32_C(         800),  INT32_C(         424),  INT32_C(         428), -INT32_C(         256),  INT32_C(         796),  INT32_C(         236), -INT32_C(         784), -INT32_C(          12) },
+      { SIMDE_FLOAT32_C( -6736.50), SIMDE_FLOAT32_C( -6632.25), SIMDE_FLOAT32_C( -1225.75), SIMDE_FLOAT32_C( -8444.25),
+        SIMDE_FLOAT32_C(  2968.50), SIMDE_FLOAT32_C( -3080.75), SIMDE_FLOAT32_C( -1174.00), SIMDE_FLOAT32_C(   379.00),
+        SIMDE_FLOAT32_C(  1487.25), SIMDE_FLOAT32_C(  4051.50), SIMDE_FLOAT32_C( -9084.50), SIMDE_FLOAT32_C( -2762.75),
+        SIMDE_FLOAT32_C( -4310.25), SIMDE_FLOAT32_C( -5116.00), SIMDE_FLOAT32_C(   461.75), SIMDE_FLOAT32_C(  4611.00) },
+      { SIMDE_FLOAT32_C(   -27.00), SIMDE_FLOAT32_C(    89.00), SIMDE_FLOAT32_C( -1225.75), SIMDE_FLOAT32_C( -8444.25),
+        SIMDE_FLOAT32_C(  2968.50), SIMDE_FLOAT32_C(  -112.00), SIMDE_FLOAT32_C(   -95.50), SIMDE_FLOAT32_C(   -25.00),
+        SIMDE_FLOAT32_C(  -100.00), SIMDE_FLOAT32_C(    53.00), SIMDE_FLOAT32_C( -9084.50), SIMDE_FLOAT32_C(   -32.00),
+        SIMDE_FLOAT32_C( -4310.25), SIMDE_FLOAT32_C(    29.50), SIMDE_FLOAT32_C(   461.75), SIMDE_FLOAT32_C(    -1.50) } },
+    { UINT16_C(36426),
+      {  INT32_C(         692),  INT32_C(          68), -INT32_C(         512), -INT32_C(         416), -INT32_C(         660),  INT32_C(          68), -INT32_C(         876), -INT32_C(         232),
+        -INT32_C(         412), -INT32_C(          40), -INT32_C(         660),  INT32_C(         264),  INT32_C(         288),  INT32_C(         896),  INT32_C(         784), -INT32_C(         200) },
+      { SIMDE_FLOAT32_C( -1439.00), SIMDE_FLOAT32_C( -7677.25), SIMDE_FLOAT32_C(  6607.75), SIMDE_FLOAT32_C(  9394.00),
+        SIMDE_FLOAT32_C( -7149.75), SIMDE_FLOAT32_C(  8624.25), SIMDE_FLOAT32_C( -5721.25), SIMDE_FLOAT32_C(  -582.75),
+        SIMDE_FLOAT32_C(  7385.50), SIMDE_FLOAT32_C( -8377.25), SIMDE_FLOAT32_C( -4943.50), SIMDE_FLOAT32_C( -1862.00),
+        SIMDE_FLOAT32_C( -8818.00), SIMDE_FLOAT32_C( -4729.00), SIMDE_FLOAT32_C( -7420.75), SIMDE_FLOAT32_C(  5479.25) },
+      { SIMDE_FLOAT32_C(    86.50), SIMDE_FLOAT32_C( -7677.25), SIMDE_FLOAT32_C(   -64.00), SIMDE_FLOAT32_C(  9394.00),
+        SIMDE_FLOAT32_C( -4943.50), SIMDE_FLOAT32_C( -7677.25), SIMDE_FLOAT32_C( -5721.25), SIMDE_FLOAT32_C(   -29.00),
+        SIMDE_FLOAT32_C(   -51.50), SIMDE_FLOAT32_C( -8377.25), SIMDE_FLOAT32_C( -4943.50), SIMDE_FLOAT32_C( -1862.00),
+        SIMDE_FLOAT32_C(    36.00), SIMDE_FLOAT32_C(   112.00), SIMDE_FLOAT32_C(    98.00), SIMDE_FLOAT32_C(  5479.25) } },
+    { UINT16_C(48233),
+      {  INT32_C(         252), -INT32_C(          32), -INT32_C(         464), -INT32_C(         676), -INT32_C(        1020), -INT32_C(         704), -INT32_C(         536),  INT32_C(         452),
+        -INT32_C(         260), -INT32_C(         320), -INT32_C(          48),  INT32_C(         388),  INT32_C(         516), -INT32_C(         192), -INT32_C(         144),  INT32_C(          84) },
+      { SIMDE_FLOAT32_C( -7770.25), SIMDE_FLOAT32_C(   340.25), SIMDE_FLOAT32_C( -8137.50), SIMDE_FLOAT32_C( -3780.50),
+        SIMDE_FLOAT32_C(  9130.50), SIMDE_FLOAT32_C(  5322.75), SIMDE_FLOAT32_C( -1417.25), SIMDE_FLOAT32_C(  2310.25),
+        SIMDE_FLOAT32_C( -5893.25), SIMDE_FLOAT32_C(  5536.25), SIMDE_FLOAT32_C( -8584.00), SIMDE_FLOAT32_C(  3311.75),
+        SIMDE_FLOAT32_C( -9292.00), SIMDE_FLOAT32_C( -3420.00), SIMDE_FLOAT32_C(  2557.00), SIMDE_FLOAT32_C(   939.50) },
+      { SIMDE_FLOAT32_C( -7770.25), SIMDE_FLOAT32_C(    -4.00), SIMDE_FLOAT32_C(   -58.00), SIMDE_FLOAT32_C( -3780.50),
+        SIMDE_FLOAT32_C(  -127.50), SIMDE_FLOAT32_C(  5322.75), SIMDE_FLOAT32_C( -1417.25), SIMDE_FLOAT32_C(    56.50),
+        SIMDE_FLOAT32_C(   -32.50), SIMDE_FLOAT32_C(   -40.00), SIMDE_FLOAT32_C( -8584.00), SIMDE_FLOAT32_C(  3311.75),
+        SIMDE_FLOAT32_C( -9292.00), SIMDE_FLOAT32_C( -3420.00), SIMDE_FLOAT32_C(   -18.00), SIMDE_FLOAT32_C(   939.50) } },
+    { UINT16_C(57060),
+      { -INT32_C(         472), -INT32_C(         472), -INT32_C(         472), -INT32_C(         472), -INT32_C(         996), -INT32_C(         472), -INT32_C(         472), -INT32_C(         472),
+         INT32_C(         964), -INT32_C(         472), -INT32_C(         472), -INT32_C(         712),  INT32_C(         560), -INT32_C(         748), -INT32_C(         748),  INT32_C(         172) },
+      { SIMDE_FLOAT32_C(   872.25), SIMDE_FLOAT32_C(  1608.25), SIMDE_FLOAT32_C(  3339.25), SIMDE_FLOAT32_C(  2837.75),
+        SIMDE_FLOAT32_C(  4258.75), SIMDE_FLOAT32_C(  2996.00), SIMDE_FLOAT32_C( -3097.75), SIMDE_FLOAT32_C( -2556.25),
+        SIMDE_FLOAT32_C(  -818.50), SIMDE_FLOAT32_C( -2207.75), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C(  4109.25),
+        SIMDE_FLOAT32_C(  8938.75), SIMDE_FLOAT32_C( -3924.25), SIMDE_FLOAT32_C( -8703.75), SIMDE_FLOAT32_C( -3281.25) },
+      { SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C( -5947.25),
+        SIMDE_FLOAT32_C(  -124.50), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C( -5947.25),
+        SIMDE_FLOAT32_C(   120.50), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C( -5947.25), SIMDE_FLOAT32_C(  4109.25),
+        SIMDE_FLOAT32_C(  8938.75), SIMDE_FLOAT32_C( -8703.75), SIMDE_FLOAT32_C( -8703.75), SIMDE_FLOAT32_C( -3281.25) } },
+    { UINT16_C(31346),
+      {  INT32_C(         300),  INT32_C(         284),  INT32_C(         844), -INT32_C(         720),  INT32_C(         744),  INT32_C(         828),  INT32_C(         692),  INT32_C(         564),
+        -INT32_C(         144), -INT32_C(         476),  INT32_C(          52), -INT32_C(         248),  INT32_C(         968), -INT32_C(         752), -INT32_C(          72), -INT32_C(         332) },
+      { SIMDE_FLOAT32_C( -4332.25), SIMDE_FLOAT32_C(  9428.75), SIMDE_FLOAT32_C( -7487.00), SIMDE_FLOAT32_C( -3061.75),
+        SIMDE_FLOAT32_C( -5408.75), SIMDE_FLOAT32_C(  3576.25), SIMDE_FLOAT32_C(  1873.00), SIMDE_FLOAT32_C( -2153.50),
+        SIMDE_FLOAT32_C( -2978.00), SIMDE_FLOAT32_C(  5034.50), SIMDE_FLOAT32_C( -2175.75), SIMDE_FLOAT32_C(  3303.50),
+        SIMDE_FLOAT32_C( -2454.75), SIMDE_FLOAT32_C( -5936.25), SIMDE_FLOAT32_C( -7978.00), SIMDE_FLOAT32_C(  9541.00) },
+      { SIMDE_FLOAT32_C(    37.50), SIMDE_FLOAT32_C(  9428.75), SIMDE_FLOAT32_C(   105.50), SIMDE_FLOAT32_C(   -90.00),
+        SIMDE_FLOAT32_C( -5408.75), SIMDE_FLOAT32_C(  3576.25), SIMDE_FLOAT32_C(  1873.00), SIMDE_FLOAT32_C(    70.50),
+        SIMDE_FLOAT32_C(   -18.00), SIMDE_FLOAT32_C(  5034.50), SIMDE_FLOAT32_C(     6.50), SIMDE_FLOAT32_C(  3303.50),
+        SIMDE_FLOAT32_C( -2454.75), SIMDE_FLOAT32_C( -5936.25), SIMDE_FLOAT32_C( -7978.00), SIMDE_FLOAT32_C(   -41.50) } },
+    { UINT16_C(55003),
+      {  INT32_C(         992),  INT32_C(         380), -INT32_C(         956), -INT32_C(         952),  INT32_C(         376), -INT32_C(           8),  INT32_C(         500),  INT32_C(         380),
+         INT32_C(         200), -INT32_C(         756),  INT32_C(         992), -INT32_C(         716), -INT32_C(           4),  INT32_C(         380),  INT32_C(          12),  INT32_C(         736) },
+      { SIMDE_FLOAT32_C( -2285.00), SIMDE_FLOAT32_C( -9698.00), SIMDE_FLOAT32_C(  7010.00), SIMDE_FLOAT32_C( -5063.50),
+        SIMDE_FLOAT32_C( -1210.25), SIMDE_FLOAT32_C(  8646.50), SIMDE_FLOAT32_C( -7834.50), SIMDE_FLOAT32_C( -1139.00),
+        SIMDE_FLOAT32_C(  -661.75), SIMDE_FLOAT32_C(  3204.50), SIMDE_FLOAT32_C(  1637.25), SIMDE_FLOAT32_C(  4245.50),
+        SIMDE_FLOAT32_C( -2739.00), SIMDE_FLOAT32_C( -2344.50), SIMDE_FLOAT32_C(  6834.75), SIMDE_FLOAT32_C( -1821.50) },
+      { SIMDE_FLOAT32_C(  1637.25), SIMDE_FLOAT32_C( -1139.00), SIMDE_FLOAT32_C(  -119.50), SIMDE_FLOAT32_C( -5063.50),
+        SIMDE_FLOAT32_C( -1210.25), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C( -7834.50), SIMDE_FLOAT32_C( -1139.00),
+        SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(  3204.50), SIMDE_FLOAT32_C(  1637.25), SIMDE_FLOAT32_C(   -89.50),
+        SIMDE_FLOAT32_C( -2739.00), SIMDE_FLOAT32_C( -1139.00), SIMDE_FLOAT32_C(  6834.75), SIMDE_FLOAT32_C( -1821.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_mm512_mask_i32scatter_ps(&(f32_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    simde_float32 r[16] = { 0 };
+    for (size_t j = 0 ; j < 16 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x16(simde_mm512_loadu_ps(r), simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { -INT32_C(         122), -INT32_C(         166), -INT32_C(           4), -INT32_C(         226),  INT32_C(          63), -INT32_C(         189), -INT32_C(         230),  INT32_C(         199) },
+      { SIMDE_FLOAT64_C(  4320.50), SIMDE_FLOAT64_C( -9120.00), SIMDE_FLOAT64_C(  3687.00), SIMDE_FLOAT64_C(  2892.50),
+        SIMDE_FLOAT64_C( -7775.25), SIMDE_FLOAT64_C( -7329.25), SIMDE_FLOAT64_C(  2421.50), SIMDE_FLOAT64_C(  7646.75) },
+      { SIMDE_FLOAT64_C(  4320.50), SIMDE_FLOAT64_C( -9120.00), SIMDE_FLOAT64_C(  3687.00), SIMDE_FLOAT64_C(  2892.50),
+        SIMDE_FLOAT64_C( -7775.25), SIMDE_FLOAT64_C( -7329.25), SIMDE_FLOAT64_C(  2421.50), SIMDE_FLOAT64_C(  7646.75) } },
+    { { -INT32_C(          95),  INT32_C(         117),  INT32_C(         117), -INT32_C(         174), -INT32_C(          95), -INT32_C(          75), -INT32_C(         249), -INT32_C(         109) },
+      { SIMDE_FLOAT64_C( -4759.25), SIMDE_FLOAT64_C( -9349.50), SIMDE_FLOAT64_C( -7026.75), SIMDE_FLOAT64_C( -7731.25),
+        SIMDE_FLOAT64_C( -8834.00), SIMDE_FLOAT64_C( -9330.25), SIMDE_FLOAT64_C(  9436.25), SIMDE_FLOAT64_C( -3771.75) },
+      { SIMDE_FLOAT64_C( -8834.00), SIMDE_FLOAT64_C( -7026.75), SIMDE_FLOAT64_C( -7026.75), SIMDE_FLOAT64_C( -7731.25),
+        SIMDE_FLOAT64_C( -8834.00), SIMDE_FLOAT64_C( -9330.25), SIMDE_FLOAT64_C(  9436.25), SIMDE_FLOAT64_C( -3771.75) } },
+    { {  INT32_C(         166), -INT32_C(         170), -INT32_C(          12),  INT32_C(         146),  INT32_C(          34),  INT32_C(         171), -INT32_C(         240),  INT32_C(          26) },
+      { SIMDE_FLOAT64_C(  7016.50), SIMDE_FLOAT64_C(  9073.50), SIMDE_FLOAT64_C(   890.50), SIMDE_FLOAT64_C( -2365.00),
+        SIMDE_FLOAT64_C(   342.00), SIMDE_FLOAT64_C(  3006.00), SIMDE_FLOAT64_C( -1241.25), SIMDE_FLOAT64_C( -8652.50) },
+      { SIMDE_FLOAT64_C(  7016.50), SIMDE_FLOAT64_C(  9073.50), SIMDE_FLOAT64_C(   890.50), SIMDE_FLOAT64_C( -2365.00),
+        SIMDE_FLOAT64_C(   342.00), SIMDE_FLOAT64_C(  3006.00), SIMDE_FLOAT64_C( -1241.25), SIMDE_FLOAT64_C( -8652.50) } },
+    { {  INT32_C(         124),  INT32_C(         124),  INT32_C(         134),  INT32_C(         237),  INT32_C(          62),  INT32_C(         134),  INT32_C(         231), -INT32_C(          40) },
+      { SIMDE_FLOAT64_C(  2010.00), SIMDE_FLOAT64_C( -3378.00), SIMDE_FLOAT64_C(  1181.75), SIMDE_FLOAT64_C( -7929.75),
+        SIMDE_FLOAT64_C(  6711.25), SIMDE_FLOAT64_C(   173.00), SIMDE_FLOAT64_C(  6595.25), SIMDE_FLOAT64_C( -9536.00) },
+      { SIMDE_FLOAT64_C( -3378.00), SIMDE_FLOAT64_C( -3378.00), SIMDE_FLOAT64_C(   173.00), SIMDE_FLOAT64_C( -7929.75),
+        SIMDE_FLOAT64_C(  6711.25), SIMDE_FLOAT64_C(   173.00), SIMDE_FLOAT64_C(  6595.25), SIMDE_FLOAT64_C( -9536.00) } },
+    { { -INT32_C(          28),  INT32_C(         144), -INT32_C(         164),  INT32_C(         132), -INT32_C(          59), -INT32_C(          44), -INT32_C(         109), -INT32_C(         183) },
+      { SIMDE_FLOAT64_C( -8595.75), SIMDE_FLOAT64_C( -7431.25), SIMDE_FLOAT64_C(  6103.50), SIMDE_FLOAT64_C(  6392.50),
+        SIMDE_FLOAT64_C( -3790.50), SIMDE_FLOAT64_C(  5964.50), SIMDE_FLOAT64_C( -9153.25), SIMDE_FLOAT64_C( -7500.00) },
+      { SIMDE_FLOAT64_C( -8595.75), SIMDE_FLOAT64_C( -7431.25), SIMDE_FLOAT64_C(  6103.50), SIMDE_FLOAT64_C(  6392.50),
+        SIMDE_FLOAT64_C( -3790.50), SIMDE_FLOAT64_C(  5964.50), SIMDE_FLOAT64_C( -9153.25), SIMDE_FLOAT64_C( -7500.00) } },
+    { { -INT32_C(          56),  INT32_C(         225), -INT32_C(         226),  INT32_C(          85),  INT32_C(         194),  INT32_C(          85),  INT32_C(         214),  INT32_C(         214) },
+      { SIMDE_FLOAT64_C( -3596.50), SIMDE_FLOAT64_C(  5231.25), SIMDE_FLOAT64_C(  9715.75), SIMDE_FLOAT64_C( -5656.50),
+        SIMDE_FLOAT64_C(  6665.25), SIMDE_FLOAT64_C(  3570.75), SIMDE_FLOAT64_C( -4305.50), SIMDE_FLOAT64_C(  8024.00) },
+      { SIMDE_FLOAT64_C( -3596.50), SIMDE_FLOAT64_C(  5231.25), SIMDE_FLOAT64_C(  9715.75), SIMDE_FLOAT64_C(  3570.75),
+        SIMDE_FLOAT64_C(  6665.25), SIMDE_FLOAT64_C(  3570.75), SIMDE_FLOAT64_C(  8024.00), SIMDE_FLOAT64_C(  8024.00) } },
+    { {  INT32_C(          91), -INT32_C(          13), -INT32_C(         141), -INT32_C(         254), -INT32_C(         244),  INT32_C(         167), -INT32_C(          20), -INT32_C(          41) },
+      { SIMDE_FLOAT64_C(  2338.00), SIMDE_FLOAT64_C(  8834.75), SIMDE_FLOAT64_C( -3172.50), SIMDE_FLOAT64_C(   104.50),
+        SIMDE_FLOAT64_C( -7801.25), SIMDE_FLOAT64_C(  4178.50), SIMDE_FLOAT64_C( -8493.75), SIMDE_FLOAT64_C(  5822.50) },
+      { SIMDE_FLOAT64_C(  2338.00), SIMDE_FLOAT64_C(  8834.75), SIMDE_FLOAT64_C( -3172.50), SIMDE_FLOAT64_C(   104.50),
+        SIMDE_FLOAT64_C( -7801.25), SIMDE_FLOAT64_C(  4178.50), SIMDE_FLOAT64_C( -8493.75), SIMDE_FLOAT64_C(  5822.50) } },
+    { { -INT32_C(         119), -INT32_C(         119), -INT32_C(         102), -INT32_C(         119),  INT32_C(         178), -INT32_C(         224), -INT32_C(         119),  INT32_C(         178) },
+      { SIMDE_FLOAT64_C(  4079.75), SIMDE_FLOAT64_C( -8878.75), SIMDE_FLOAT64_C(  4230.25), SIMDE_FLOAT64_C(  9553.25),
+        SIMDE_FLOAT64_C(   -21.00), SIMDE_FLOAT64_C( -9643.25), SIMDE_FLOAT64_C( -8319.00), SIMDE_FLOAT64_C( -9559.25) },
+      { SIMDE_FLOAT64_C( -8319.00), SIMDE_FLOAT64_C( -8319.00), SIMDE_FLOAT64_C(  4230.25), SIMDE_FLOAT64_C( -8319.00),
+        SIMDE_FLOAT64_C( -9559.25), SIMDE_FLOAT64_C( -9643.25), SIMDE_FLOAT64_C( -8319.00), SIMDE_FLOAT64_C( -9559.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_i32scatter_pd(&(f64_buffer[2048]), vindex, a, 8);
+
+    simde_float64 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x8(simde_mm512_loadu_pd(r), simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT32_C(         460),  INT32_C(        1008), -INT32_C(         440),  INT32_C(        1016),  INT32_C(         496),  INT32_C(         232), -INT32_C(          60),  INT32_C(         324) },
+      { SIMDE_FLOAT64_C(  -650.25), SIMDE_FLOAT64_C(  -517.25), SIMDE_FLOAT64_C(  2500.50), SIMDE_FLOAT64_C( -6285.25),
+        SIMDE_FLOAT64_C( -3302.75), SIMDE_FLOAT64_C( -8501.75), SIMDE_FLOAT64_C( -4081.00), SIMDE_FLOAT64_C(  1867.50) },
+      { SIMDE_FLOAT64_C(  -650.25), SIMDE_FLOAT64_C(  -517.25), SIMDE_FLOAT64_C(  2500.50), SIMDE_FLOAT64_C( -6285.25),
+        SIMDE_FLOAT64_C( -3302.75), SIMDE_FLOAT64_C( -8501.75), SIMDE_FLOAT64_C( -4081.00), SIMDE_FLOAT64_C(  1867.50) } },
+    { UINT8_C(254),
+      {  INT32_C(         216),  INT32_C(          68),  INT32_C(         332),  INT32_C(         332), -INT32_C(         228),  INT32_C(         320), -INT32_C(         412),  INT32_C(         296) },
+      { SIMDE_FLOAT64_C(  8149.00), SIMDE_FLOAT64_C( -6674.50), SIMDE_FLOAT64_C( -3560.50), SIMDE_FLOAT64_C( -1481.75),
+        SIMDE_FLOAT64_C( -9575.00), SIMDE_FLOAT64_C( -4629.00), SIMDE_FLOAT64_C(  2759.75), SIMDE_FLOAT64_C(  8699.75) },
+      { SIMDE_FLOAT64_C(    13.50), SIMDE_FLOAT64_C( -6674.50), SIMDE_FLOAT64_C( -1481.75), SIMDE_FLOAT64_C( -1481.75),
+        SIMDE_FLOAT64_C( -9575.00), SIMDE_FLOAT64_C( -4629.00), SIMDE_FLOAT64_C(  2759.75), SIMDE_FLOAT64_C(  8699.75) } },
+    { UINT8_C(164),
+      {  INT32_C(         328), -INT32_C(          96),  INT32_C(         700),  INT32_C(         480),  INT32_C(         864),  INT32_C(          16), -INT32_C(         484),  INT32_C(         440) },
+      { SIMDE_FLOAT64_C(  9576.75), SIMDE_FLOAT64_C(  2708.50), SIMDE_FLOAT64_C( -3513.00), SIMDE_FLOAT64_C(  5797.50),
+        SIMDE_FLOAT64_C( -7341.75), SIMDE_FLOAT64_C(  4085.00), SIMDE_FLOAT64_C(  2680.25), SIMDE_FLOAT64_C( -1540.75) },
+      { SIMDE_FLOAT64_C(    20.50), SIMDE_FLOAT64_C(    -6.00), SIMDE_FLOAT64_C( -3513.00), SIMDE_FLOAT64_C(    30.00),
+        SIMDE_FLOAT64_C(    54.00), SIMDE_FLOAT64_C(  4085.00), SIMDE_FLOAT64_C(   -30.25), SIMDE_FLOAT64_C( -1540.75) } },
+    { UINT8_C( 82),
+      {  INT32_C(         604),  INT32_C(         828),  INT32_C(           4),  INT32_C(         828), -INT32_C(         124),  INT32_C(         828),  INT32_C(         260),  INT32_C(         828) },
+      { SIMDE_FLOAT64_C( -2703.75), SIMDE_FLOAT64_C( -3607.75), SIMDE_FLOAT64_C(  7701.75), SIMDE_FLOAT64_C( -9771.50),
+        SIMDE_FLOAT64_C(  1552.50), SIMDE_FLOAT64_C( -5438.75), SIMDE_FLOAT64_C(  3935.50), SIMDE_FLOAT64_C(  9418.50) },
+      { SIMDE_FLOAT64_C(    37.75), SIMDE_FLOAT64_C( -3607.75), SIMDE_FLOAT64_C(     0.25), SIMDE_FLOAT64_C( -3607.75),
+        SIMDE_FLOAT64_C(  1552.50), SIMDE_FLOAT64_C( -3607.75), SIMDE_FLOAT64_C(  3935.50), SIMDE_FLOAT64_C( -3607.75) } },
+    { UINT8_C( 25),
+      { -INT32_C(         512),  INT32_C(         752), -INT32_C(         984), -INT32_C(         832), -INT32_C(         908),  INT32_C(         648),  INT32_C(         328),  INT32_C(         372) },
+      { SIMDE_FLOAT64_C( -6523.25), SIMDE_FLOAT64_C(  1246.50), SIMDE_FLOAT64_C(  6010.50), SIMDE_FLOAT64_C(  1067.75),
+        SIMDE_FLOAT64_C(  3581.75), SIMDE_FLOAT64_C( -4801.25), SIMDE_FLOAT64_C( -4160.00), SIMDE_FLOAT64_C(   797.50) },
+      { SIMDE_FLOAT64_C( -6523.25), SIMDE_FLOAT64_C(    47.00), SIMDE_FLOAT64_C(   -61.50), SIMDE_FLOAT64_C(  1067.75),
+        SIMDE_FLOAT64_C(  3581.75), SIMDE_FLOAT64_C(    40.50), SIMDE_FLOAT64_C(    20.50), SIMDE_FLOAT64_C(    23.25) } },
+    { UINT8_C( 74),
+      { -INT32_C(         752),  INT32_C(         788), -INT32_C(         752), -INT32_C(         208), -INT32_C(         752), -INT32_C(         756),  INT32_C(         788),  INT32_C(         896) },
+      { SIMDE_FLOAT64_C(  1624.25), SIMDE_FLOAT64_C(  3737.00), SIMDE_FLOAT64_C(  1296.75), SIMDE_FLOAT64_C(   -59.25),
+        SIMDE_FLOAT64_C( -5558.25), SIMDE_FLOAT64_C( -6404.75), SIMDE_FLOAT64_C(   787.00), SIMDE_FLOAT64_C(  5828.00) },
+      { SIMDE_FLOAT64_C(   -47.00), SIMDE_FLOAT64_C(   787.00), SIMDE_FLOAT64_C(   -47.00), SIMDE_FLOAT64_C(   -59.25),
+        SIMDE_FLOAT64_C(   -47.00), SIMDE_FLOAT64_C(   -47.25), SIMDE_FLOAT64_C(   787.00), SIMDE_FLOAT64_C(    56.00) } },
+    { UINT8_C(137),
+      {  INT32_C(         792), -INT32_C(         204),  INT32_C(         188), -INT32_C(         952), -INT32_C(         848),  INT32_C(         300),  INT32_C(         284),  INT32_C(         332) },
+      { SIMDE_FLOAT64_C(  6577.50), SIMDE_FLOAT64_C(  1117.50), SIMDE_FLOAT64_C( -6330.00), SIMDE_FLOAT64_C(  4205.25),
+        SIMDE_FLOAT64_C( -4178.00), SIMDE_FLOAT64_C( -4596.75), SIMDE_FLOAT64_C( -1615.25), SIMDE_FLOAT64_C(  8351.25) },
+      { SIMDE_FLOAT64_C(  6577.50), SIMDE_FLOAT64_C(   -12.75), SIMDE_FLOAT64_C(    11.75), SIMDE_FLOAT64_C(  4205.25),
+        SIMDE_FLOAT64_C(   -53.00), SIMDE_FLOAT64_C(    18.75), SIMDE_FLOAT64_C(    17.75), SIMDE_FLOAT64_C(  8351.25) } },
+    { UINT8_C(248),
+      {  INT32_C(         124),  INT32_C(        1016),  INT32_C(        1016),  INT32_C(         408),  INT32_C(         240),  INT32_C(         124),  INT32_C(         600),  INT32_C(         124) },
+      { SIMDE_FLOAT64_C(  -797.50), SIMDE_FLOAT64_C( -4059.00), SIMDE_FLOAT64_C(  7293.75), SIMDE_FLOAT64_C( -9027.75),
+        SIMDE_FLOAT64_C( -2302.25), SIMDE_FLOAT64_C(  5738.25), SIMDE_FLOAT64_C(   428.75), SIMDE_FLOAT64_C(  3376.75) },
+      { SIMDE_FLOAT64_C(  3376.75), SIMDE_FLOAT64_C(    63.50), SIMDE_FLOAT64_C(    63.50), SIMDE_FLOAT64_C( -9027.75),
+        SIMDE_FLOAT64_C( -2302.25), SIMDE_FLOAT64_C(  3376.75), SIMDE_FLOAT64_C(   428.75), SIMDE_FLOAT64_C(  3376.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_mask_i32scatter_pd(&(f64_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    simde_float64 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x8(simde_mm512_loadu_pd(r), simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT64_C(                 100), -INT64_C(                 117), -INT64_C(                  74),  INT64_C(                 173),
+         INT64_C(                   8), -INT64_C(                 148), -INT64_C(                 121),  INT64_C(                 142) },
+      { -INT32_C(     8413457),            INT32_MAX, -INT32_C(   152690439),  INT32_C(     4202496),  INT32_C(  1074791680), -INT32_C(   409317640), -INT32_C(  1631973008), -INT32_C(     2097153) },
+      { -INT32_C(     8413457),            INT32_MAX, -INT32_C(   152690439),  INT32_C(     4202496),  INT32_C(  1074791680), -INT32_C(   409317640), -INT32_C(  1631973008), -INT32_C(     2097153) } },
+    { { -INT64_C(                  45), -INT64_C(                 231), -INT64_C(                  45), -INT64_C(                 194),
+        -INT64_C(                  45), -INT64_C(                 231), -INT64_C(                 231), -INT64_C(                  47) },
+      { -INT32_C(    19156993), -INT32_C(  2078718912),  INT32_C(  2050443368), -INT32_C(   422356572), -INT32_C(  1484071881), -INT32_C(   268437505),  INT32_C(    74936355),  INT32_C(   268435520) },
+      { -INT32_C(  1484071881),  INT32_C(    74936355), -INT32_C(  1484071881), -INT32_C(   422356572), -INT32_C(  1484071881),  INT32_C(    74936355),  INT32_C(    74936355),  INT32_C(   268435520) } },
+    { {  INT64_C(                 178), -INT64_C(                 140), -INT64_C(                 120), -INT64_C(                  79),
+         INT64_C(                  52), -INT64_C(                 235), -INT64_C(                 216),  INT64_C(                 108) },
+      {  INT32_C(   155353216), -INT32_C(  1666465691), -INT32_C(    71319553),  INT32_C(    34411285),  INT32_C(     1761606),  INT32_C(   153094152), -INT32_C(   856397022),  INT32_C(  2141568057) },
+      {  INT32_C(   155353216), -INT32_C(  1666465691), -INT32_C(    71319553),  INT32_C(    34411285),  INT32_C(     1761606),  INT32_C(   153094152), -INT32_C(   856397022),  INT32_C(  2141568057) } },
+    { { -INT64_C(                 111), -INT64_C(                 212), -INT64_C(                 111), -INT64_C(                  30),
+        -INT64_C(                 111), -INT64_C(                 111),  INT64_C(                 211), -INT64_C(                 187) },
+      {  INT32_C(   289058789), -INT32_C(   282000244),  INT32_C(   119731174), -INT32_C(  1209041602),  INT32_C(  1168323427), -INT32_C(  1744830465),  INT32_C(    54654562), -INT32_C(     5945675) },
+      { -INT32_C(  1744830465), -INT32_C(   282000244), -INT32_C(  1744830465), -INT32_C(  1209041602), -INT32_C(  1744830465), -INT32_C(  1744830465),  INT32_C(    54654562), -INT32_C(     5945675) } },
+    { { -INT64_C(                  53),  INT64_C(                  74), -INT64_C(                 126), -INT64_C(                 104),
+         INT64_C(                  54),  INT64_C(                 249),  INT64_C(                 170), -INT64_C(                  96) },
+      {  INT32_C(    16785440),  INT32_C(    62466108), -INT32_C(  2013245184), -INT32_C(  2095606316), -INT32_C(   728911974), -INT32_C(   394737980),  INT32_C(  1011891053), -INT32_C(  1150554125) },
+      {  INT32_C(    16785440),  INT32_C(    62466108), -INT32_C(  2013245184), -INT32_C(  2095606316), -INT32_C(   728911974), -INT32_C(   394737980),  INT32_C(  1011891053), -INT32_C(  1150554125) } },
+    { {  INT64_C(                   5),  INT64_C(                   5),  INT64_C(                   5), -INT64_C(                 224),
+         INT64_C(                 187),  INT64_C(                   5),  INT64_C(                  42),  INT64_C(                  34) },
+      {  INT32_C(   932428374), -INT32_C(    16779265), -INT32_C(   500046950), -INT32_C(  1087901697),  INT32_C(   583671970), -INT32_C(    68044931), -INT32_C(  1872147511),  INT32_C(   135266432) },
+      { -INT32_C(    68044931), -INT32_C(    68044931), -INT32_C(    68044931), -INT32_C(  1087901697),  INT32_C(   583671970), -INT32_C(    68044931), -INT32_C(  1872147511),  INT32_C(   135266432) } },
+    { {  INT64_C(                 223),  INT64_C(                  20),  INT64_C(                 172), -INT64_C(                   1),
+         INT64_C(                 100),  INT64_C(                 176), -INT64_C(                 216), -INT64_C(                 165) },
+      { -INT32_C(   784330194),  INT32_C(   377418887), -INT32_C(  1590725341), -INT32_C(  1821799293), -INT32_C(  2147483647),  INT32_C(  1312535337),  INT32_C(   942721734), -INT32_C(  1027424412) },
+      { -INT32_C(   784330194),  INT32_C(   377418887), -INT32_C(  1590725341), -INT32_C(  1821799293), -INT32_C(  2147483647),  INT32_C(  1312535337),  INT32_C(   942721734), -INT32_C(  1027424412) } },
+    { {  INT64_C(                 215),  INT64_C(                 215),  INT64_C(                  53),  INT64_C(                 168),
+        -INT64_C(                 224),  INT64_C(                 204), -INT64_C(                  21),  INT64_C(                 212) },
+      { -INT32_C(   411199628), -INT32_C(  1609097900), -INT32_C(   813731843), -INT32_C(  1728277559), -INT32_C(   650647019), -INT32_C(  1283719169), -INT32_C(  1238553384),  INT32_C(          18) },
+      { -INT32_C(  1609097900), -INT32_C(  1609097900), -INT32_C(   813731843), -INT32_C(  1728277559), -INT32_C(   650647019), -INT32_C(  1283719169), -INT32_C(  1238553384),  INT32_C(          18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde_mm512_i64scatter_epi32(&(i32_buffer[2048]), vindex, a, 4);
+
+    int32_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x8(simde_x_mm256_loadu_epi32(r), simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT64_C(                 155), -INT64_C(                   8), -INT64_C(                 121), -INT64_C(                 185),
+        -INT64_C(                 232),  INT64_C(                 204),  INT64_C(                 244), -INT64_C(                 126) },
+      { -INT32_C(    34085185), -INT32_C(     8388881),  INT32_C(  1330610386), -INT32_C(   142671873), -INT32_C(       35081), -INT32_C(    10486113),  INT32_C(   746529015), -INT32_C(  1342963777) },
+      { -INT32_C(    34085185), -INT32_C(     8388881),  INT32_C(  1330610386), -INT32_C(   142671873), -INT32_C(       35081), -INT32_C(    10486113),  INT32_C(   746529015), -INT32_C(  1342963777) } },
+    { UINT8_C( 16),
+      {  INT64_C(                 253),  INT64_C(                 253),  INT64_C(                  40),  INT64_C(                 234),
+         INT64_C(                 193),  INT64_C(                 253),  INT64_C(                 197),  INT64_C(                 191) },
+      { -INT32_C(    67240065),  INT32_C(  1526081503), -INT32_C(   436469761),  INT32_C(     1975300), -INT32_C(   163700486), -INT32_C(   558438433), -INT32_C(  1073774721), -INT32_C(   167903491) },
+      {  INT32_C(         759),  INT32_C(         759),  INT32_C(         120),  INT32_C(         702), -INT32_C(   163700486),  INT32_C(         759),  INT32_C(         591),  INT32_C(         573) } },
+    { UINT8_C( 96),
+      { -INT64_C(                  72),  INT64_C(                  65),  INT64_C(                 119), -INT64_C(                 133),
+         INT64_C(                 223), -INT64_C(                  37), -INT64_C(                  83), -INT64_C(                  77) },
+      {  INT32_C(   824787383), -INT32_C(    75497601),  INT32_C(  2102056348), -INT32_C(   546390017),  INT32_C(  1073743872),  INT32_C(  1364044582),  INT32_C(  2130237781),  INT32_C(   461717955) },
+      { -INT32_C(         216),  INT32_C(         195),  INT32_C(         357), -INT32_C(         399),  INT32_C(         669),  INT32_C(  1364044582),  INT32_C(  2130237781), -INT32_C(         231) } },
+    { UINT8_C(227),
+      { -INT64_C(                  56), -INT64_C(                  56), -INT64_C(                  56), -INT64_C(                  56),
+        -INT64_C(                  56), -INT64_C(                  56),  INT64_C(                  98), -INT64_C(                 172) },
+      {  INT32_C(  1864166379), -INT32_C(  1091649797), -INT32_C(   693020660), -INT32_C(     2129921), -INT32_C(    34734658), -INT32_C(  2146942968),  INT32_C(   216542899),  INT32_C(   142868992) },
+      { -INT32_C(  2146942968), -INT32_C(  2146942968), -INT32_C(  2146942968), -INT32_C(  2146942968), -INT32_C(  2146942968), -INT32_C(  2146942968),  INT32_C(   216542899),  INT32_C(   142868992) } },
+    { UINT8_C(109),
+      { -INT64_C(                 120), -INT64_C(                 148),  INT64_C(                  55), -INT64_C(                 121),
+         INT64_C(                 244), -INT64_C(                 179),  INT64_C(                  14), -INT64_C(                 153) },
+      { -INT32_C(  1204589260),  INT32_C(       65796), -INT32_C(  1375797409),  INT32_C(    97360781),  INT32_C(  1249933898), -INT32_C(   105584583),  INT32_C(   738197648), -INT32_C(  1073741828) },
+      { -INT32_C(  1204589260), -INT32_C(         444), -INT32_C(  1375797409),  INT32_C(    97360781),  INT32_C(         732), -INT32_C(   105584583),  INT32_C(   738197648), -INT32_C(         459) } },
+    { UINT8_C(212),
+      { -INT64_C(                 104), -INT64_C(                 104), -INT64_C(                 104),  INT64_C(                  56),
+        -INT64_C(                 120), -INT64_C(                 113), -INT64_C(                  58),  INT64_C(                 106) },
+      { -INT32_C(  1475466440), -INT32_C(   134250625),  INT32_C(  2119010207), -INT32_C(   302546961), -INT32_C(  1073741833),  INT32_C(  1687438608), -INT32_C(    67772417), -INT32_C(   477483481) },
+      {  INT32_C(  2119010207),  INT32_C(  2119010207),  INT32_C(  2119010207),  INT32_C(         168), -INT32_C(  1073741833), -INT32_C(         339), -INT32_C(    67772417), -INT32_C(   477483481) } },
+    { UINT8_C(236),
+      { -INT64_C(                  41),  INT64_C(                 146),  INT64_C(                 243), -INT64_C(                 219),
+         INT64_C(                 196), -INT64_C(                 236), -INT64_C(                 219),  INT64_C(                  27) },
+      { -INT32_C(           1), -INT32_C(   314098572),  INT32_C(   318335617),  INT32_C(   138431592), -INT32_C(     8655553),  INT32_C(     2163840),  INT32_C(   484476276), -INT32_C(  1205341972) },
+      { -INT32_C(         123),  INT32_C(         438),  INT32_C(   318335617),  INT32_C(   484476276),  INT32_C(         588),  INT32_C(     2163840),  INT32_C(   484476276), -INT32_C(  1205341972) } },
+    { UINT8_C(160),
+      {  INT64_C(                  95),  INT64_C(                  95),  INT64_C(                  95),  INT64_C(                  95),
+         INT64_C(                 109), -INT64_C(                 155), -INT64_C(                  51),  INT64_C(                 137) },
+      { -INT32_C(   318804565),  INT32_C(  1733820908),  INT32_C(     8391840),  INT32_C(    33554438), -INT32_C(   372457790),  INT32_C(  1098483545), -INT32_C(   796062280),  INT32_C(         512) },
+      {  INT32_C(         285),  INT32_C(         285),  INT32_C(         285),  INT32_C(         285),  INT32_C(         327),  INT32_C(  1098483545), -INT32_C(         153),  INT32_C(         512) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = (HEDLEY_STATIC_CAST(int32_t, i) - 2048) * 3; }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = (HEDLEY_STATIC_CAST(int32_t, j) - 2048) * 3; }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde_mm512_mask_i64scatter_epi32(&(i32_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    int32_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i32_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 4)];
+    }
+    simde_test_x86_assert_equal_i32x8(simde_x_mm256_loadu_epi32(r), simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C(                  32),  INT64_C(                 113), -INT64_C(                  81), -INT64_C(                 193),
+        -INT64_C(                 191),  INT64_C(                 178),  INT64_C(                 255), -INT64_C(                  84) },
+      {  INT64_C( 2391969831612106358), -INT64_C( 7989555747528641531),  INT64_C( 1729420192208994369),  INT64_C(   97734526599680124),
+        -INT64_C( 2501833660445606856),  INT64_C( 3787537186518205056),  INT64_C( 2335116484101013520),  INT64_C( 8763006231429492486) },
+      {  INT64_C( 2391969831612106358), -INT64_C( 7989555747528641531),  INT64_C( 1729420192208994369),  INT64_C(   97734526599680124),
+        -INT64_C( 2501833660445606856),  INT64_C( 3787537186518205056),  INT64_C( 2335116484101013520),  INT64_C( 8763006231429492486) } },
+    { {  INT64_C(                 229),  INT64_C(                 229), -INT64_C(                 250), -INT64_C(                 250),
+         INT64_C(                 229), -INT64_C(                 108), -INT64_C(                 237), -INT64_C(                 209) },
+      { -INT64_C(   72057594038484993), -INT64_C( 1170957893365670421),  INT64_C( 5006233510927130833), -INT64_C( 3882612339739203330),
+        -INT64_C( 2882871350035283987),  INT64_C(  288547654112153732),  INT64_C( 2306434598122296336),  INT64_C( 6798005252466291875) },
+      { -INT64_C( 2882871350035283987), -INT64_C( 2882871350035283987), -INT64_C( 3882612339739203330), -INT64_C( 3882612339739203330),
+        -INT64_C( 2882871350035283987),  INT64_C(  288547654112153732),  INT64_C( 2306434598122296336),  INT64_C( 6798005252466291875) } },
+    { { -INT64_C(                  73),  INT64_C(                  98),  INT64_C(                  30), -INT64_C(                 241),
+         INT64_C(                 154), -INT64_C(                 117),  INT64_C(                 212),  INT64_C(                   1) },
+      {  INT64_C( 1159734078653256320),  INT64_C(  342839820183453696), -INT64_C(  612489618113333526),  INT64_C(   23081025588428804),
+         INT64_C( 6588876888064250580), -INT64_C(  864972878853309827),  INT64_C(  190057139783420816), -INT64_C(  146437670166396937) },
+      {  INT64_C( 1159734078653256320),  INT64_C(  342839820183453696), -INT64_C(  612489618113333526),  INT64_C(   23081025588428804),
+         INT64_C( 6588876888064250580), -INT64_C(  864972878853309827),  INT64_C(  190057139783420816), -INT64_C(  146437670166396937) } },
+    { { -INT64_C(                 171), -INT64_C(                  46),  INT64_C(                  74), -INT64_C(                  46),
+        -INT64_C(                  22),  INT64_C(                 184),  INT64_C(                   6), -INT64_C(                  22) },
+      {  INT64_C(  171547876421163609), -INT64_C( 7606005455638057087),  INT64_C( 4615684251191068295), -INT64_C( 5421990570865665461),
+         INT64_C( 7287410322031934234),  INT64_C( 4611690416473899040), -INT64_C( 2450208890505266257), -INT64_C(   15763699281432577) },
+      {  INT64_C(  171547876421163609), -INT64_C( 5421990570865665461),  INT64_C( 4615684251191068295), -INT64_C( 5421990570865665461),
+        -INT64_C(   15763699281432577),  INT64_C( 4611690416473899040), -INT64_C( 2450208890505266257), -INT64_C(   15763699281432577) } },
+    { { -INT64_C(                  46),  INT64_C(                  36),  INT64_C(                 158),  INT64_C(                  20),
+         INT64_C(                 204), -INT64_C(                 128),  INT64_C(                 164),  INT64_C(                 140) },
+      { -INT64_C( 6914531498260873264),  INT64_C( 4611686018562129924),  INT64_C( 1152921543798481280), -INT64_C( 1984795474181830190),
+         INT64_C(     562988608131360), -INT64_C( 4852699159207053477), -INT64_C( 2308094845677338777), -INT64_C( 3032315253791897416) },
+      { -INT64_C( 6914531498260873264),  INT64_C( 4611686018562129924),  INT64_C( 1152921543798481280), -INT64_C( 1984795474181830190),
+         INT64_C(     562988608131360), -INT64_C( 4852699159207053477), -INT64_C( 2308094845677338777), -INT64_C( 3032315253791897416) } },
+    { {  INT64_C(                  23),  INT64_C(                  23),  INT64_C(                  23), -INT64_C(                  23),
+        -INT64_C(                 188),  INT64_C(                 247), -INT64_C(                 172), -INT64_C(                 188) },
+      { -INT64_C(    2956603951218721),  INT64_C( 4899920861345350656), -INT64_C(  834397890225813265),  INT64_C( 9223371761957986271),
+         INT64_C(  456603538390238872), -INT64_C(   81065343048515585),  INT64_C( 5030217675390826920), -INT64_C( 1614785289298880736) },
+      { -INT64_C(  834397890225813265), -INT64_C(  834397890225813265), -INT64_C(  834397890225813265),  INT64_C( 9223371761957986271),
+        -INT64_C( 1614785289298880736), -INT64_C(   81065343048515585),  INT64_C( 5030217675390826920), -INT64_C( 1614785289298880736) } },
+    { { -INT64_C(                 214),  INT64_C(                 178),  INT64_C(                 230),  INT64_C(                 255),
+         INT64_C(                  60), -INT64_C(                  24),  INT64_C(                 222),  INT64_C(                 119) },
+      {  INT64_C(    1126527513174016), -INT64_C(    2260604497963025), -INT64_C( 6054408233189309239), -INT64_C( 7177328607932703219),
+        -INT64_C(  957185338499881455),  INT64_C( 2882303761521311776), -INT64_C( 7146483661321938210),  INT64_C(   38702810371457088) },
+      {  INT64_C(    1126527513174016), -INT64_C(    2260604497963025), -INT64_C( 6054408233189309239), -INT64_C( 7177328607932703219),
+        -INT64_C(  957185338499881455),  INT64_C( 2882303761521311776), -INT64_C( 7146483661321938210),  INT64_C(   38702810371457088) } },
+    { { -INT64_C(                  26), -INT64_C(                  26),  INT64_C(                  51),  INT64_C(                  30),
+        -INT64_C(                  26), -INT64_C(                  26), -INT64_C(                 241), -INT64_C(                  26) },
+      { -INT64_C( 3338037855295475284), -INT64_C( 3998633037308887040), -INT64_C( 1507805453571148712),  INT64_C( 9031933087858681542),
+         INT64_C( 2475684172989660807), -INT64_C(       9895604649985), -INT64_C( 6010435053802860524), -INT64_C(   36048592667152393) },
+      { -INT64_C(   36048592667152393), -INT64_C(   36048592667152393), -INT64_C( 1507805453571148712),  INT64_C( 9031933087858681542),
+        -INT64_C(   36048592667152393), -INT64_C(   36048592667152393), -INT64_C( 6010435053802860524), -INT64_C(   36048592667152393) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_i64scatter_epi64(&(i64_buffer[2048]), vindex, a, 8);
+
+    int64_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x8(simde_mm512_loadu_epi64(r), simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      {  INT64_C(                 336),  INT64_C(                 648), -INT64_C(                1080), -INT64_C(                1760),
+        -INT64_C(                 296),  INT64_C(                 704),  INT64_C(                1968),  INT64_C(                  56) },
+      { -INT64_C( 4775944491847359125), -INT64_C(  288239172253163665), -INT64_C(      92498835812353), -INT64_C( 1274758951829220590),
+         INT64_C( 2344159099656347720),  INT64_C(  594761023840321536),  INT64_C(  998151459914022149), -INT64_C( 4724311202082067969) },
+      { -INT64_C( 4775944491847359125), -INT64_C(  288239172253163665), -INT64_C(      92498835812353), -INT64_C( 1274758951829220590),
+         INT64_C( 2344159099656347720),  INT64_C(  594761023840321536),  INT64_C(  998151459914022149), -INT64_C( 4724311202082067969) } },
+    {    UINT8_MAX,
+      {  INT64_C(                  16),  INT64_C(                1816), -INT64_C(                1552),  INT64_C(                1816),
+         INT64_C(                  72),  INT64_C(                1752), -INT64_C(                 168), -INT64_C(                1448) },
+      {  INT64_C( 3056050689633168419),  INT64_C(  297241973989900289), -INT64_C( 6224420231654813072), -INT64_C(   72127962916325379),
+         INT64_C(   72059793147169025),  INT64_C( 7151002056888901347),  INT64_C( 4035206503945207743), -INT64_C(  725782299508268367) },
+      {  INT64_C( 3056050689633168419), -INT64_C(   72127962916325379), -INT64_C( 6224420231654813072), -INT64_C(   72127962916325379),
+         INT64_C(   72059793147169025),  INT64_C( 7151002056888901347),  INT64_C( 4035206503945207743), -INT64_C(  725782299508268367) } },
+    { UINT8_C( 45),
+      {  INT64_C(                 680),  INT64_C(                1824),  INT64_C(                1592), -INT64_C(                 664),
+         INT64_C(                1960), -INT64_C(                2008), -INT64_C(                1184), -INT64_C(                 680) },
+      {  INT64_C(       4398651670657),  INT64_C(  292753836244767760), -INT64_C( 8683802133599889409),  INT64_C( 1068325760548159018),
+        -INT64_C( 1170945944750669825), -INT64_C( 7987788795068280157),  INT64_C(  118940769850493216), -INT64_C( 1315683918336657692) },
+      {  INT64_C(       4398651670657),  INT64_C(        979252543716), -INT64_C( 8683802133599889409),  INT64_C( 1068325760548159018),
+         INT64_C(       1052266987765), -INT64_C( 7987788795068280157), -INT64_C(        635655159956), -INT64_C(        365072220245) } },
+    { UINT8_C( 72),
+      { -INT64_C(                1008), -INT64_C(                1008), -INT64_C(                1008),  INT64_C(                 728),
+         INT64_C(                 152),  INT64_C(                1144),  INT64_C(                 928), -INT64_C(                1672) },
+      {  INT64_C( 2319652876332827009),  INT64_C( 1379728091044579916), -INT64_C( 3463611656694642605),  INT64_C( 8151079897921557789),
+         INT64_C( 6629298616978635263),  INT64_C( 3071622844599775672),  INT64_C( 1340169484623957557),  INT64_C(   18014398562123780) },
+      { -INT64_C(        541165879422), -INT64_C(        541165879422), -INT64_C(        541165879422),  INT64_C( 8151079897921557789),
+         INT64_C(         81604378643),  INT64_C(        614180323471),  INT64_C( 1340169484623957557), -INT64_C(        897648165073) } },
+    { UINT8_C(101),
+      {  INT64_C(                 400),  INT64_C(                 720), -INT64_C(                1656), -INT64_C(                1944),
+         INT64_C(                 560),  INT64_C(                1400),  INT64_C(                1504),  INT64_C(                 824) },
+      {  INT64_C(  150870587516911616), -INT64_C( 7108386063885966292), -INT64_C(      70438805831716), -INT64_C( 3945697620705561947),
+        -INT64_C( 9213238662815283000),  INT64_C(  854022278514171200), -INT64_C( 5200336328664193040),  INT64_C(  252203784633065504) },
+      {  INT64_C(  150870587516911616),  INT64_C(        386547056730), -INT64_C(      70438805831716), -INT64_C(       1043677053171),
+         INT64_C(        300647710790),  INT64_C(  854022278514171200), -INT64_C( 5200336328664193040),  INT64_C(        442381631591) } },
+    { UINT8_C(151),
+      { -INT64_C(                1696), -INT64_C(                1808), -INT64_C(                 888),  INT64_C(                1400),
+        -INT64_C(                 888), -INT64_C(                1696), -INT64_C(                 888), -INT64_C(                1808) },
+      { -INT64_C(   36125554043259905),  INT64_C( 8532563186803164481),  INT64_C( 8515629827225734669),  INT64_C( 6268931476734066547),
+        -INT64_C( 2630102182384369921),  INT64_C( 4279356698660735590), -INT64_C( 8825219910376652996),  INT64_C( 2674121617752328159) },
+      { -INT64_C(   36125554043259905),  INT64_C( 2674121617752328159), -INT64_C( 2630102182384369921),  INT64_C(        751619276975),
+        -INT64_C( 2630102182384369921), -INT64_C(   36125554043259905), -INT64_C( 2630102182384369921),  INT64_C( 2674121617752328159) } },
+    { UINT8_C(214),
+      { -INT64_C(                 752), -INT64_C(                1408), -INT64_C(                1208), -INT64_C(                 776),
+         INT64_C(                 568),  INT64_C(                1536),  INT64_C(                  48),  INT64_C(                1520) },
+      {  INT64_C( 1155736255464497152), -INT64_C(       6751722147841),  INT64_C( 3068157092876681264), -INT64_C( 4026746019155281378),
+         INT64_C(         73023881222),  INT64_C( 4763970355390175190),  INT64_C(  288300744895906816), -INT64_C(   79095018246111233) },
+      { -INT64_C(        403726925918), -INT64_C(       6751722147841),  INT64_C( 3068157092876681264), -INT64_C(        416611827809),
+         INT64_C(         73023881222),  INT64_C(        824633721024),  INT64_C(  288300744895906816), -INT64_C(   79095018246111233) } },
+    { UINT8_C(  3),
+      {  INT64_C(                 888), -INT64_C(                1120), -INT64_C(                 968),  INT64_C(                 208),
+        -INT64_C(                 968),  INT64_C(                 208),  INT64_C(                 888),  INT64_C(                 888) },
+      { -INT64_C(     300458803462417), -INT64_C(      71193453463553),  INT64_C( 4607163586442166271), -INT64_C( 8454905368256954491),
+         INT64_C(  794393852537471008), -INT64_C( 2182468857104795368), -INT64_C( 6917537829237565570), -INT64_C( 5801253483668063111) },
+      { -INT64_C(     300458803462417), -INT64_C(      71193453463553), -INT64_C(        519691042937),  INT64_C(        111669149722),
+        -INT64_C(        519691042937),  INT64_C(        111669149722), -INT64_C(     300458803462417), -INT64_C(     300458803462417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; i++) { i64_buffer[i] = (HEDLEY_STATIC_CAST(int64_t, i) - 2048) * INT64_C(4294967297); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = (HEDLEY_STATIC_CAST(int64_t, j) - 2048) * INT64_C(4294967297); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_mask_i64scatter_epi64(&(i64_buffer[2048]), test_vec[i].k, vindex, a, 1);
+
+    int64_t r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = i64_buffer[2048 + ((test_vec[i].vindex[j] * 1) / 8)];
+    }
+    simde_test_x86_assert_equal_i64x8(simde_mm512_loadu_epi64(r), simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { -INT64_C(                 140), -INT64_C(                  83), -INT64_C(                 127),  INT64_C(                  79),
+         INT64_C(                 236),  INT64_C(                   5),  INT64_C(                 224), -INT64_C(                 129) },
+      { SIMDE_FLOAT32_C( -4907.50), SIMDE_FLOAT32_C( -6874.50), SIMDE_FLOAT32_C(  5344.50), SIMDE_FLOAT32_C(  -332.00),
+        SIMDE_FLOAT32_C( -9987.75), SIMDE_FLOAT32_C(  3936.75), SIMDE_FLOAT32_C(  8257.00), SIMDE_FLOAT32_C( -2479.75) },
+      { SIMDE_FLOAT32_C( -4907.50), SIMDE_FLOAT32_C( -6874.50), SIMDE_FLOAT32_C(  5344.50), SIMDE_FLOAT32_C(  -332.00),
+        SIMDE_FLOAT32_C( -9987.75), SIMDE_FLOAT32_C(  3936.75), SIMDE_FLOAT32_C(  8257.00), SIMDE_FLOAT32_C( -2479.75) } },
+    { {  INT64_C(                 192), -INT64_C(                 152),  INT64_C(                 136), -INT64_C(                  24),
+         INT64_C(                 192), -INT64_C(                 152), -INT64_C(                 212),  INT64_C(                 224) },
+      { SIMDE_FLOAT32_C( -4904.25), SIMDE_FLOAT32_C(  7705.25), SIMDE_FLOAT32_C(  4598.00), SIMDE_FLOAT32_C(  5276.25),
+        SIMDE_FLOAT32_C(  7546.50), SIMDE_FLOAT32_C(  3091.50), SIMDE_FLOAT32_C( -4723.75), SIMDE_FLOAT32_C( -3888.00) },
+      { SIMDE_FLOAT32_C(  7546.50), SIMDE_FLOAT32_C(  3091.50), SIMDE_FLOAT32_C(  4598.00), SIMDE_FLOAT32_C(  5276.25),
+        SIMDE_FLOAT32_C(  7546.50), SIMDE_FLOAT32_C(  3091.50), SIMDE_FLOAT32_C( -4723.75), SIMDE_FLOAT32_C( -3888.00) } },
+    { {  INT64_C(                  51),  INT64_C(                  58), -INT64_C(                 138), -INT64_C(                 205),
+        -INT64_C(                  11), -INT64_C(                  91), -INT64_C(                 226),  INT64_C(                  35) },
+      { SIMDE_FLOAT32_C( -9290.00), SIMDE_FLOAT32_C(    48.75), SIMDE_FLOAT32_C(  -845.75), SIMDE_FLOAT32_C(  7848.25),
+        SIMDE_FLOAT32_C( -2725.50), SIMDE_FLOAT32_C(  2840.00), SIMDE_FLOAT32_C(  1216.25), SIMDE_FLOAT32_C(  3072.25) },
+      { SIMDE_FLOAT32_C( -9290.00), SIMDE_FLOAT32_C(    48.75), SIMDE_FLOAT32_C(  -845.75), SIMDE_FLOAT32_C(  7848.25),
+        SIMDE_FLOAT32_C( -2725.50), SIMDE_FLOAT32_C(  2840.00), SIMDE_FLOAT32_C(  1216.25), SIMDE_FLOAT32_C(  3072.25) } },
+    { { -INT64_C(                   4), -INT64_C(                   4), -INT64_C(                   4), -INT64_C(                  73),
+         INT64_C(                   7),  INT64_C(                  59), -INT64_C(                  73), -INT64_C(                   4) },
+      { SIMDE_FLOAT32_C( -5701.50), SIMDE_FLOAT32_C( -1752.25), SIMDE_FLOAT32_C( -5317.00), SIMDE_FLOAT32_C( -3249.75),
+        SIMDE_FLOAT32_C( -8772.50), SIMDE_FLOAT32_C(   885.75), SIMDE_FLOAT32_C(  5302.75), SIMDE_FLOAT32_C( -1618.50) },
+      { SIMDE_FLOAT32_C( -1618.50), SIMDE_FLOAT32_C( -1618.50), SIMDE_FLOAT32_C( -1618.50), SIMDE_FLOAT32_C(  5302.75),
+        SIMDE_FLOAT32_C( -8772.50), SIMDE_FLOAT32_C(   885.75), SIMDE_FLOAT32_C(  5302.75), SIMDE_FLOAT32_C( -1618.50) } },
+    { {  INT64_C(                  65), -INT64_C(                 122), -INT64_C(                  85),  INT64_C(                 119),
+        -INT64_C(                 247),  INT64_C(                 234), -INT64_C(                 189), -INT64_C(                 158) },
+      { SIMDE_FLOAT32_C(  7046.75), SIMDE_FLOAT32_C(  2318.50), SIMDE_FLOAT32_C( -5443.00), SIMDE_FLOAT32_C( -8200.00),
+        SIMDE_FLOAT32_C(  2584.00), SIMDE_FLOAT32_C(  -575.25), SIMDE_FLOAT32_C(  3756.00), SIMDE_FLOAT32_C( -7987.50) },
+      { SIMDE_FLOAT32_C(  7046.75), SIMDE_FLOAT32_C(  2318.50), SIMDE_FLOAT32_C( -5443.00), SIMDE_FLOAT32_C( -8200.00),
+        SIMDE_FLOAT32_C(  2584.00), SIMDE_FLOAT32_C(  -575.25), SIMDE_FLOAT32_C(  3756.00), SIMDE_FLOAT32_C( -7987.50) } },
+    { {  INT64_C(                 147),  INT64_C(                 147),  INT64_C(                 105),  INT64_C(                  92),
+         INT64_C(                  36),  INT64_C(                  92),  INT64_C(                 147),  INT64_C(                  57) },
+      { SIMDE_FLOAT32_C( -2507.25), SIMDE_FLOAT32_C(  6027.25), SIMDE_FLOAT32_C(  9094.25), SIMDE_FLOAT32_C( -6752.75),
+        SIMDE_FLOAT32_C(   319.75), SIMDE_FLOAT32_C( -4078.00), SIMDE_FLOAT32_C( -4389.25), SIMDE_FLOAT32_C( -5414.00) },
+      { SIMDE_FLOAT32_C( -4389.25), SIMDE_FLOAT32_C( -4389.25), SIMDE_FLOAT32_C(  9094.25), SIMDE_FLOAT32_C( -4078.00),
+        SIMDE_FLOAT32_C(   319.75), SIMDE_FLOAT32_C( -4078.00), SIMDE_FLOAT32_C( -4389.25), SIMDE_FLOAT32_C( -5414.00) } },
+    { { -INT64_C(                  26),  INT64_C(                  55),  INT64_C(                 231),  INT64_C(                 174),
+         INT64_C(                 180), -INT64_C(                  51), -INT64_C(                  31), -INT64_C(                 129) },
+      { SIMDE_FLOAT32_C(  8605.75), SIMDE_FLOAT32_C(  5275.50), SIMDE_FLOAT32_C(  9314.00), SIMDE_FLOAT32_C(  1018.50),
+        SIMDE_FLOAT32_C(  8793.50), SIMDE_FLOAT32_C( -7907.25), SIMDE_FLOAT32_C( -3932.75), SIMDE_FLOAT32_C( -4177.00) },
+      { SIMDE_FLOAT32_C(  8605.75), SIMDE_FLOAT32_C(  5275.50), SIMDE_FLOAT32_C(  9314.00), SIMDE_FLOAT32_C(  1018.50),
+        SIMDE_FLOAT32_C(  8793.50), SIMDE_FLOAT32_C( -7907.25), SIMDE_FLOAT32_C( -3932.75), SIMDE_FLOAT32_C( -4177.00) } },
+    { {  INT64_C(                 233),  INT64_C(                 233),  INT64_C(                 233), -INT64_C(                 217),
+        -INT64_C(                  33),  INT64_C(                 233), -INT64_C(                 217),  INT64_C(                 204) },
+      { SIMDE_FLOAT32_C(  9059.75), SIMDE_FLOAT32_C( -9653.75), SIMDE_FLOAT32_C(   555.75), SIMDE_FLOAT32_C( -2036.50),
+        SIMDE_FLOAT32_C(  5969.25), SIMDE_FLOAT32_C( -5875.25), SIMDE_FLOAT32_C(  2472.00), SIMDE_FLOAT32_C( -1180.75) },
+      { SIMDE_FLOAT32_C( -5875.25), SIMDE_FLOAT32_C( -5875.25), SIMDE_FLOAT32_C( -5875.25), SIMDE_FLOAT32_C(  2472.00),
+        SIMDE_FLOAT32_C(  5969.25), SIMDE_FLOAT32_C( -5875.25), SIMDE_FLOAT32_C(  2472.00), SIMDE_FLOAT32_C( -1180.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_mm512_i64scatter_ps(&(f32_buffer[2048]), vindex, a, 8);
+
+    simde_float32 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x8(simde_mm256_loadu_ps(r), simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT64_C(                 344), -INT64_C(                 234), -INT64_C(                 424), -INT64_C(                  72),
+        -INT64_C(                 280), -INT64_C(                 158), -INT64_C(                 466), -INT64_C(                 142) },
+      { SIMDE_FLOAT32_C(  7112.75), SIMDE_FLOAT32_C( -8538.75), SIMDE_FLOAT32_C( -7895.50), SIMDE_FLOAT32_C(  3932.00),
+        SIMDE_FLOAT32_C( -8680.75), SIMDE_FLOAT32_C(  6918.50), SIMDE_FLOAT32_C( -9591.25), SIMDE_FLOAT32_C(  9643.50) },
+      { SIMDE_FLOAT32_C(  7112.75), SIMDE_FLOAT32_C( -8538.75), SIMDE_FLOAT32_C( -7895.50), SIMDE_FLOAT32_C(  3932.00),
+        SIMDE_FLOAT32_C( -8680.75), SIMDE_FLOAT32_C(  6918.50), SIMDE_FLOAT32_C( -9591.25), SIMDE_FLOAT32_C(  9643.50) } },
+    { UINT8_C( 45),
+      { -INT64_C(                 272),  INT64_C(                 420),  INT64_C(                  38),  INT64_C(                  38),
+         INT64_C(                  38),  INT64_C(                 126), -INT64_C(                 342),  INT64_C(                 468) },
+      { SIMDE_FLOAT32_C( -5123.50), SIMDE_FLOAT32_C(  1647.50), SIMDE_FLOAT32_C(   810.75), SIMDE_FLOAT32_C(  2317.25),
+        SIMDE_FLOAT32_C( -1912.25), SIMDE_FLOAT32_C(  3647.75), SIMDE_FLOAT32_C(  5453.00), SIMDE_FLOAT32_C( -1735.75) },
+      { SIMDE_FLOAT32_C( -5123.50), SIMDE_FLOAT32_C(   105.00), SIMDE_FLOAT32_C(  2317.25), SIMDE_FLOAT32_C(  2317.25),
+        SIMDE_FLOAT32_C(  2317.25), SIMDE_FLOAT32_C(  3647.75), SIMDE_FLOAT32_C(   -85.50), SIMDE_FLOAT32_C(   117.00) } },
+    { UINT8_C( 13),
+      { -INT64_C(                 334), -INT64_C(                  54), -INT64_C(                 216), -INT64_C(                 276),
+        -INT64_C(                  28),  INT64_C(                 106),  INT64_C(                 384),  INT64_C(                 448) },
+      { SIMDE_FLOAT32_C(  5313.00), SIMDE_FLOAT32_C(  7261.75), SIMDE_FLOAT32_C( -8178.25), SIMDE_FLOAT32_C(  1608.00),
+        SIMDE_FLOAT32_C( -4477.50), SIMDE_FLOAT32_C( -7505.75), SIMDE_FLOAT32_C( -4086.75), SIMDE_FLOAT32_C(   895.50) },
+      { SIMDE_FLOAT32_C(  5313.00), SIMDE_FLOAT32_C(   -13.50), SIMDE_FLOAT32_C( -8178.25), SIMDE_FLOAT32_C(  1608.00),
+        SIMDE_FLOAT32_C(    -7.00), SIMDE_FLOAT32_C(    26.50), SIMDE_FLOAT32_C(    96.00), SIMDE_FLOAT32_C(   112.00) } },
+    { UINT8_C(183),
+      { -INT64_C(                 478),  INT64_C(                 216),  INT64_C(                 216),  INT64_C(                 448),
+         INT64_C(                 336),  INT64_C(                 216),  INT64_C(                 336), -INT64_C(                 138) },
+      { SIMDE_FLOAT32_C( -9838.00), SIMDE_FLOAT32_C( -9920.75), SIMDE_FLOAT32_C(  8042.00), SIMDE_FLOAT32_C(  2438.00),
+        SIMDE_FLOAT32_C(  -242.25), SIMDE_FLOAT32_C(  6813.00), SIMDE_FLOAT32_C(  -946.00), SIMDE_FLOAT32_C( -5247.75) },
+      { SIMDE_FLOAT32_C( -9838.00), SIMDE_FLOAT32_C(  6813.00), SIMDE_FLOAT32_C(  6813.00), SIMDE_FLOAT32_C(   112.00),
+        SIMDE_FLOAT32_C(  -242.25), SIMDE_FLOAT32_C(  6813.00), SIMDE_FLOAT32_C(  -242.25), SIMDE_FLOAT32_C( -5247.75) } },
+    { UINT8_C( 92),
+      {  INT64_C(                 350),  INT64_C(                 220), -INT64_C(                 454), -INT64_C(                 134),
+         INT64_C(                 348),  INT64_C(                 334),  INT64_C(                 172), -INT64_C(                 130) },
+      { SIMDE_FLOAT32_C( -5681.50), SIMDE_FLOAT32_C( -8712.50), SIMDE_FLOAT32_C( -9918.50), SIMDE_FLOAT32_C(  9819.50),
+        SIMDE_FLOAT32_C(   885.75), SIMDE_FLOAT32_C(  1091.25), SIMDE_FLOAT32_C( -6356.75), SIMDE_FLOAT32_C(  9587.75) },
+      { SIMDE_FLOAT32_C(    87.50), SIMDE_FLOAT32_C(    55.00), SIMDE_FLOAT32_C( -9918.50), SIMDE_FLOAT32_C(  9819.50),
+        SIMDE_FLOAT32_C(   885.75), SIMDE_FLOAT32_C(    83.50), SIMDE_FLOAT32_C( -6356.75), SIMDE_FLOAT32_C(   -32.50) } },
+    { UINT8_C( 58),
+      {  INT64_C(                 210),  INT64_C(                 210),  INT64_C(                 210), -INT64_C(                 130),
+        -INT64_C(                 130), -INT64_C(                  90), -INT64_C(                 130), -INT64_C(                  90) },
+      { SIMDE_FLOAT32_C( -6751.25), SIMDE_FLOAT32_C(  8346.00), SIMDE_FLOAT32_C( -1633.50), SIMDE_FLOAT32_C(  5009.75),
+        SIMDE_FLOAT32_C(  -642.00), SIMDE_FLOAT32_C( -1200.75), SIMDE_FLOAT32_C(  9518.50), SIMDE_FLOAT32_C(  8879.50) },
+      { SIMDE_FLOAT32_C(  8346.00), SIMDE_FLOAT32_C(  8346.00), SIMDE_FLOAT32_C(  8346.00), SIMDE_FLOAT32_C(  -642.00),
+        SIMDE_FLOAT32_C(  -642.00), SIMDE_FLOAT32_C( -1200.75), SIMDE_FLOAT32_C(  -642.00), SIMDE_FLOAT32_C( -1200.75) } },
+    { UINT8_C( 20),
+      {  INT64_C(                 436),  INT64_C(                 226),  INT64_C(                 114), -INT64_C(                 206),
+        -INT64_C(                  44),  INT64_C(                 338),  INT64_C(                 158),  INT64_C(                 112) },
+      { SIMDE_FLOAT32_C(  8611.75), SIMDE_FLOAT32_C( -3971.25), SIMDE_FLOAT32_C(  1047.25), SIMDE_FLOAT32_C( -5590.00),
+        SIMDE_FLOAT32_C(  4023.50), SIMDE_FLOAT32_C(  8487.25), SIMDE_FLOAT32_C( -5176.50), SIMDE_FLOAT32_C(  8517.50) },
+      { SIMDE_FLOAT32_C(   109.00), SIMDE_FLOAT32_C(    56.50), SIMDE_FLOAT32_C(  1047.25), SIMDE_FLOAT32_C(   -51.50),
+        SIMDE_FLOAT32_C(  4023.50), SIMDE_FLOAT32_C(    84.50), SIMDE_FLOAT32_C(    39.50), SIMDE_FLOAT32_C(    28.00) } },
+    { UINT8_C( 50),
+      { -INT64_C(                 200), -INT64_C(                 302), -INT64_C(                 200),  INT64_C(                 404),
+         INT64_C(                 404),  INT64_C(                 404), -INT64_C(                  12),  INT64_C(                 404) },
+      { SIMDE_FLOAT32_C( -3758.25), SIMDE_FLOAT32_C(  5245.00), SIMDE_FLOAT32_C(  2819.75), SIMDE_FLOAT32_C( -7148.50),
+        SIMDE_FLOAT32_C(  -586.25), SIMDE_FLOAT32_C(  3997.25), SIMDE_FLOAT32_C( -2869.25), SIMDE_FLOAT32_C( -9710.50) },
+      { SIMDE_FLOAT32_C(   -50.00), SIMDE_FLOAT32_C(  5245.00), SIMDE_FLOAT32_C(   -50.00), SIMDE_FLOAT32_C(  3997.25),
+        SIMDE_FLOAT32_C(  3997.25), SIMDE_FLOAT32_C(  3997.25), SIMDE_FLOAT32_C(    -3.00), SIMDE_FLOAT32_C(  3997.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = (HEDLEY_STATIC_CAST(simde_float32, i) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = (HEDLEY_STATIC_CAST(simde_float32, j) - SIMDE_FLOAT32_C(2048.0)) * SIMDE_FLOAT32_C(0.5); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_mm512_mask_i64scatter_ps(&(f32_buffer[2048]), test_vec[i].k, vindex, a, 2);
+
+    simde_float32 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f32_buffer[2048 + ((test_vec[i].vindex[j] * 2) / 4)];
+    }
+    simde_test_x86_assert_equal_f32x8(simde_mm256_loadu_ps(r), simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { {  INT64_C(                 124),  INT64_C(                 113),  INT64_C(                 191),  INT64_C(                 243),
+         INT64_C(                 157),  INT64_C(                 249),  INT64_C(                 160), -INT64_C(                 144) },
+      { SIMDE_FLOAT64_C(  4413.25), SIMDE_FLOAT64_C(  2761.75), SIMDE_FLOAT64_C( -9186.00), SIMDE_FLOAT64_C(   829.00),
+        SIMDE_FLOAT64_C(  -288.75), SIMDE_FLOAT64_C( -8118.00), SIMDE_FLOAT64_C( -4188.25), SIMDE_FLOAT64_C(  3065.25) },
+      { SIMDE_FLOAT64_C(  4413.25), SIMDE_FLOAT64_C(  2761.75), SIMDE_FLOAT64_C( -9186.00), SIMDE_FLOAT64_C(   829.00),
+        SIMDE_FLOAT64_C(  -288.75), SIMDE_FLOAT64_C( -8118.00), SIMDE_FLOAT64_C( -4188.25), SIMDE_FLOAT64_C(  3065.25) } },
+    { { -INT64_C(                  81),  INT64_C(                  52), -INT64_C(                 163), -INT64_C(                  91),
+         INT64_C(                  52), -INT64_C(                 203), -INT64_C(                  91), -INT64_C(                 238) },
+      { SIMDE_FLOAT64_C(  4507.25), SIMDE_FLOAT64_C( -1348.25), SIMDE_FLOAT64_C(  1914.75), SIMDE_FLOAT64_C(  1643.75),
+        SIMDE_FLOAT64_C( -7108.50), SIMDE_FLOAT64_C( -8323.00), SIMDE_FLOAT64_C(  8697.75), SIMDE_FLOAT64_C(  4140.50) },
+      { SIMDE_FLOAT64_C(  4507.25), SIMDE_FLOAT64_C( -7108.50), SIMDE_FLOAT64_C(  1914.75), SIMDE_FLOAT64_C(  8697.75),
+        SIMDE_FLOAT64_C( -7108.50), SIMDE_FLOAT64_C( -8323.00), SIMDE_FLOAT64_C(  8697.75), SIMDE_FLOAT64_C(  4140.50) } },
+    { { -INT64_C(                  26), -INT64_C(                  91),  INT64_C(                 155),  INT64_C(                 225),
+        -INT64_C(                  34), -INT64_C(                 251), -INT64_C(                  15), -INT64_C(                 212) },
+      { SIMDE_FLOAT64_C(  9932.75), SIMDE_FLOAT64_C( -7145.75), SIMDE_FLOAT64_C(  8881.00), SIMDE_FLOAT64_C(  1484.50),
+        SIMDE_FLOAT64_C(  8767.25), SIMDE_FLOAT64_C( -2875.00), SIMDE_FLOAT64_C(  2372.00), SIMDE_FLOAT64_C(  4866.00) },
+      { SIMDE_FLOAT64_C(  9932.75), SIMDE_FLOAT64_C( -7145.75), SIMDE_FLOAT64_C(  8881.00), SIMDE_FLOAT64_C(  1484.50),
+        SIMDE_FLOAT64_C(  8767.25), SIMDE_FLOAT64_C( -2875.00), SIMDE_FLOAT64_C(  2372.00), SIMDE_FLOAT64_C(  4866.00) } },
+    { { -INT64_C(                 183), -INT64_C(                  63), -INT64_C(                 183), -INT64_C(                  63),
+        -INT64_C(                  63), -INT64_C(                 140),  INT64_C(                  13), -INT64_C(                 183) },
+      { SIMDE_FLOAT64_C( -6950.25), SIMDE_FLOAT64_C(  6223.50), SIMDE_FLOAT64_C( -9921.75), SIMDE_FLOAT64_C( -1909.50),
+        SIMDE_FLOAT64_C( -7851.00), SIMDE_FLOAT64_C(  -214.25), SIMDE_FLOAT64_C(  5401.25), SIMDE_FLOAT64_C(  2880.50) },
+      { SIMDE_FLOAT64_C(  2880.50), SIMDE_FLOAT64_C( -7851.00), SIMDE_FLOAT64_C(  2880.50), SIMDE_FLOAT64_C( -7851.00),
+        SIMDE_FLOAT64_C( -7851.00), SIMDE_FLOAT64_C(  -214.25), SIMDE_FLOAT64_C(  5401.25), SIMDE_FLOAT64_C(  2880.50) } },
+    { {  INT64_C(                 168),  INT64_C(                 136),  INT64_C(                 245), -INT64_C(                  99),
+        -INT64_C(                 158), -INT64_C(                 190),  INT64_C(                  42), -INT64_C(                 178) },
+      { SIMDE_FLOAT64_C(  1242.25), SIMDE_FLOAT64_C( -6920.00), SIMDE_FLOAT64_C( -8141.50), SIMDE_FLOAT64_C( -5324.25),
+        SIMDE_FLOAT64_C( -4356.00), SIMDE_FLOAT64_C( -3216.75), SIMDE_FLOAT64_C(  1150.00), SIMDE_FLOAT64_C(  -104.75) },
+      { SIMDE_FLOAT64_C(  1242.25), SIMDE_FLOAT64_C( -6920.00), SIMDE_FLOAT64_C( -8141.50), SIMDE_FLOAT64_C( -5324.25),
+        SIMDE_FLOAT64_C( -4356.00), SIMDE_FLOAT64_C( -3216.75), SIMDE_FLOAT64_C(  1150.00), SIMDE_FLOAT64_C(  -104.75) } },
+    { { -INT64_C(                  81), -INT64_C(                  81),  INT64_C(                  12), -INT64_C(                 137),
+         INT64_C(                  12),  INT64_C(                  12),  INT64_C(                  72),  INT64_C(                 232) },
+      { SIMDE_FLOAT64_C(  2568.00), SIMDE_FLOAT64_C( -5326.50), SIMDE_FLOAT64_C(  8157.75), SIMDE_FLOAT64_C(  4606.75),
+        SIMDE_FLOAT64_C(  6938.75), SIMDE_FLOAT64_C( -8260.75), SIMDE_FLOAT64_C(  4187.25), SIMDE_FLOAT64_C(  1976.25) },
+      { SIMDE_FLOAT64_C( -5326.50), SIMDE_FLOAT64_C( -5326.50), SIMDE_FLOAT64_C( -8260.75), SIMDE_FLOAT64_C(  4606.75),
+        SIMDE_FLOAT64_C( -8260.75), SIMDE_FLOAT64_C( -8260.75), SIMDE_FLOAT64_C(  4187.25), SIMDE_FLOAT64_C(  1976.25) } },
+    { { -INT64_C(                 210),  INT64_C(                 170),  INT64_C(                  47), -INT64_C(                 139),
+         INT64_C(                 133),  INT64_C(                  32),  INT64_C(                 167), -INT64_C(                 245) },
+      { SIMDE_FLOAT64_C(  1861.25), SIMDE_FLOAT64_C( -2064.50), SIMDE_FLOAT64_C(  5686.25), SIMDE_FLOAT64_C( -7644.25),
+        SIMDE_FLOAT64_C(  8299.25), SIMDE_FLOAT64_C(  4708.00), SIMDE_FLOAT64_C( -6383.00), SIMDE_FLOAT64_C(  6507.00) },
+      { SIMDE_FLOAT64_C(  1861.25), SIMDE_FLOAT64_C( -2064.50), SIMDE_FLOAT64_C(  5686.25), SIMDE_FLOAT64_C( -7644.25),
+        SIMDE_FLOAT64_C(  8299.25), SIMDE_FLOAT64_C(  4708.00), SIMDE_FLOAT64_C( -6383.00), SIMDE_FLOAT64_C(  6507.00) } },
+    { {  INT64_C(                 126), -INT64_C(                  61),  INT64_C(                 110),  INT64_C(                 131),
+         INT64_C(                 248),  INT64_C(                  88),  INT64_C(                 110),  INT64_C(                 131) },
+      { SIMDE_FLOAT64_C( -2616.00), SIMDE_FLOAT64_C( -3337.50), SIMDE_FLOAT64_C( -7050.25), SIMDE_FLOAT64_C( -5930.50),
+        SIMDE_FLOAT64_C(  8787.75), SIMDE_FLOAT64_C( -5652.25), SIMDE_FLOAT64_C(  1695.75), SIMDE_FLOAT64_C( -3275.25) },
+      { SIMDE_FLOAT64_C( -2616.00), SIMDE_FLOAT64_C( -3337.50), SIMDE_FLOAT64_C(  1695.75), SIMDE_FLOAT64_C( -3275.25),
+        SIMDE_FLOAT64_C(  8787.75), SIMDE_FLOAT64_C( -5652.25), SIMDE_FLOAT64_C(  1695.75), SIMDE_FLOAT64_C( -3275.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_i64scatter_pd(&(f64_buffer[2048]), vindex, a, 8);
+
+    simde_float64 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 8) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x8(simde_mm512_loadu_pd(r), simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    {    UINT8_MAX,
+      { -INT64_C(                 396),  INT64_C(                 204),  INT64_C(                 370),  INT64_C(                 118),
+         INT64_C(                   4),  INT64_C(                 312), -INT64_C(                 174), -INT64_C(                 130) },
+      { SIMDE_FLOAT64_C( -3164.75), SIMDE_FLOAT64_C( -1048.00), SIMDE_FLOAT64_C(  9455.75), SIMDE_FLOAT64_C(   456.75),
+        SIMDE_FLOAT64_C(  7958.25), SIMDE_FLOAT64_C( -8638.00), SIMDE_FLOAT64_C( -2398.25), SIMDE_FLOAT64_C(  2151.00) },
+      { SIMDE_FLOAT64_C( -3164.75), SIMDE_FLOAT64_C( -1048.00), SIMDE_FLOAT64_C(  9455.75), SIMDE_FLOAT64_C(   456.75),
+        SIMDE_FLOAT64_C(  7958.25), SIMDE_FLOAT64_C( -8638.00), SIMDE_FLOAT64_C( -2398.25), SIMDE_FLOAT64_C(  2151.00) } },
+    { UINT8_C(228),
+      { -INT64_C(                 344), -INT64_C(                  22), -INT64_C(                 160), -INT64_C(                  22),
+        -INT64_C(                  22), -INT64_C(                 378),  INT64_C(                 446), -INT64_C(                 222) },
+      { SIMDE_FLOAT64_C(  9923.25), SIMDE_FLOAT64_C(  6354.00), SIMDE_FLOAT64_C(  7893.25), SIMDE_FLOAT64_C(   768.00),
+        SIMDE_FLOAT64_C( -7612.25), SIMDE_FLOAT64_C(  4298.00), SIMDE_FLOAT64_C( -3848.50), SIMDE_FLOAT64_C(  1729.00) },
+      { SIMDE_FLOAT64_C(   -43.00), SIMDE_FLOAT64_C(    -2.75), SIMDE_FLOAT64_C(  7893.25), SIMDE_FLOAT64_C(    -2.75),
+        SIMDE_FLOAT64_C(    -2.75), SIMDE_FLOAT64_C(  4298.00), SIMDE_FLOAT64_C( -3848.50), SIMDE_FLOAT64_C(  1729.00) } },
+    { UINT8_C(180),
+      { -INT64_C(                 430),  INT64_C(                 294), -INT64_C(                 350), -INT64_C(                 306),
+         INT64_C(                 148), -INT64_C(                 108), -INT64_C(                  92), -INT64_C(                 466) },
+      { SIMDE_FLOAT64_C( -1340.50), SIMDE_FLOAT64_C( -6490.75), SIMDE_FLOAT64_C( -7240.25), SIMDE_FLOAT64_C(  5862.25),
+        SIMDE_FLOAT64_C(  -764.25), SIMDE_FLOAT64_C( -9355.75), SIMDE_FLOAT64_C( -6693.25), SIMDE_FLOAT64_C( -7075.75) },
+      { SIMDE_FLOAT64_C(   -53.75), SIMDE_FLOAT64_C(    36.75), SIMDE_FLOAT64_C( -7240.25), SIMDE_FLOAT64_C(   -38.25),
+        SIMDE_FLOAT64_C(  -764.25), SIMDE_FLOAT64_C( -9355.75), SIMDE_FLOAT64_C(   -11.50), SIMDE_FLOAT64_C( -7075.75) } },
+    { UINT8_C(147),
+      {  INT64_C(                 282), -INT64_C(                 138), -INT64_C(                 138),  INT64_C(                 172),
+         INT64_C(                 172),  INT64_C(                 198), -INT64_C(                 138), -INT64_C(                 138) },
+      { SIMDE_FLOAT64_C(  -180.00), SIMDE_FLOAT64_C( -5402.25), SIMDE_FLOAT64_C(  4233.25), SIMDE_FLOAT64_C(   -59.25),
+        SIMDE_FLOAT64_C(  8726.50), SIMDE_FLOAT64_C(  1477.25), SIMDE_FLOAT64_C( -4283.75), SIMDE_FLOAT64_C(  4055.50) },
+      { SIMDE_FLOAT64_C(  -180.00), SIMDE_FLOAT64_C(  4055.50), SIMDE_FLOAT64_C(  4055.50), SIMDE_FLOAT64_C(  8726.50),
+        SIMDE_FLOAT64_C(  8726.50), SIMDE_FLOAT64_C(    24.75), SIMDE_FLOAT64_C(  4055.50), SIMDE_FLOAT64_C(  4055.50) } },
+    { UINT8_C(240),
+      {  INT64_C(                 466), -INT64_C(                  10),  INT64_C(                  76), -INT64_C(                  32),
+         INT64_C(                 344), -INT64_C(                 446),  INT64_C(                   6), -INT64_C(                 282) },
+      { SIMDE_FLOAT64_C(  3173.25), SIMDE_FLOAT64_C(  1669.50), SIMDE_FLOAT64_C( -7781.75), SIMDE_FLOAT64_C(  9307.75),
+        SIMDE_FLOAT64_C( -5971.25), SIMDE_FLOAT64_C(  -615.75), SIMDE_FLOAT64_C( -4939.75), SIMDE_FLOAT64_C(  6737.25) },
+      { SIMDE_FLOAT64_C(    58.25), SIMDE_FLOAT64_C(    -1.25), SIMDE_FLOAT64_C(     9.50), SIMDE_FLOAT64_C(    -4.00),
+        SIMDE_FLOAT64_C( -5971.25), SIMDE_FLOAT64_C(  -615.75), SIMDE_FLOAT64_C( -4939.75), SIMDE_FLOAT64_C(  6737.25) } },
+    { UINT8_C(166),
+      { -INT64_C(                 182), -INT64_C(                 182), -INT64_C(                 182),  INT64_C(                 450),
+        -INT64_C(                 182),  INT64_C(                 280), -INT64_C(                 312), -INT64_C(                 182) },
+      { SIMDE_FLOAT64_C( -9674.00), SIMDE_FLOAT64_C( -7371.75), SIMDE_FLOAT64_C(  2509.50), SIMDE_FLOAT64_C(  5576.25),
+        SIMDE_FLOAT64_C( -7643.50), SIMDE_FLOAT64_C(  1040.75), SIMDE_FLOAT64_C(  7558.25), SIMDE_FLOAT64_C(  1150.00) },
+      { SIMDE_FLOAT64_C(  1150.00), SIMDE_FLOAT64_C(  1150.00), SIMDE_FLOAT64_C(  1150.00), SIMDE_FLOAT64_C(    56.25),
+        SIMDE_FLOAT64_C(  1150.00), SIMDE_FLOAT64_C(  1040.75), SIMDE_FLOAT64_C(   -39.00), SIMDE_FLOAT64_C(  1150.00) } },
+    { UINT8_C( 93),
+      { -INT64_C(                 160),  INT64_C(                 464), -INT64_C(                 166),  INT64_C(                 288),
+         INT64_C(                 214), -INT64_C(                 236), -INT64_C(                 126),  INT64_C(                 168) },
+      { SIMDE_FLOAT64_C( -3373.00), SIMDE_FLOAT64_C(  1372.75), SIMDE_FLOAT64_C( -3330.50), SIMDE_FLOAT64_C( -2041.75),
+        SIMDE_FLOAT64_C(  3551.50), SIMDE_FLOAT64_C(  -812.50), SIMDE_FLOAT64_C( -7836.50), SIMDE_FLOAT64_C( -2471.00) },
+      { SIMDE_FLOAT64_C( -3373.00), SIMDE_FLOAT64_C(    58.00), SIMDE_FLOAT64_C( -3330.50), SIMDE_FLOAT64_C( -2041.75),
+        SIMDE_FLOAT64_C(  3551.50), SIMDE_FLOAT64_C(   -29.50), SIMDE_FLOAT64_C( -7836.50), SIMDE_FLOAT64_C(    21.00) } },
+    { UINT8_C( 50),
+      { -INT64_C(                 186),  INT64_C(                 392),  INT64_C(                 268),  INT64_C(                 392),
+        -INT64_C(                  26),  INT64_C(                 392),  INT64_C(                 344), -INT64_C(                 212) },
+      { SIMDE_FLOAT64_C(  8399.50), SIMDE_FLOAT64_C( -1530.25), SIMDE_FLOAT64_C(  1350.50), SIMDE_FLOAT64_C(  4519.25),
+        SIMDE_FLOAT64_C( -8753.50), SIMDE_FLOAT64_C( -9642.75), SIMDE_FLOAT64_C( -5324.25), SIMDE_FLOAT64_C( -8135.50) },
+      { SIMDE_FLOAT64_C(   -23.25), SIMDE_FLOAT64_C( -9642.75), SIMDE_FLOAT64_C(    33.50), SIMDE_FLOAT64_C( -9642.75),
+        SIMDE_FLOAT64_C( -8753.50), SIMDE_FLOAT64_C( -9642.75), SIMDE_FLOAT64_C(    43.00), SIMDE_FLOAT64_C(   -26.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; i++) { f64_buffer[i] = (HEDLEY_STATIC_CAST(simde_float64, i) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = (HEDLEY_STATIC_CAST(simde_float64, j) - SIMDE_FLOAT64_C(2048.0)) * SIMDE_FLOAT64_C(0.25); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_mask_i64scatter_pd(&(f64_buffer[2048]), test_vec[i].k, vindex, a, 4);
+
+    simde_float64 r[8] = { 0 };
+    for (size_t j = 0 ; j < 8 ; j++) {
+      r[j] = f64_buffer[2048 + ((test_vec[i].vindex[j] * 4) / 8)];
+    }
+    simde_test_x86_assert_equal_f64x8(simde_mm512_loadu_pd(r), simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,2063 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN shldi
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/shldi.h>
+
+static int
+test_simde_mm_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r5[8];
+    const int16_t r15[8];
+    const int16_t r19[8];
+  } test_vec[] = {
+    { { -INT16_C(  4417),  INT16_C(  4608),  INT16_C( 28665),  INT16_C(     0), -INT16_C(  3275),  INT16_C( 26999), -INT16_C(  3265),  INT16_C( 21544) },
+      {  INT16_C(  6076),  INT16_C( 26537),  INT16_C(  4112),  INT16_C(  4128), -INT16_C(  3083),  INT16_C( 19992),  INT16_C( 10705),  INT16_C(  1112) },
+      { -INT16_C(  4417),  INT16_C(  4608),  INT16_C( 28665),  INT16_C(     0), -INT16_C(  3275),  INT16_C( 26999), -INT16_C(  3265),  INT16_C( 21544) },
+      { -INT16_C( 10270),  INT16_C( 16396), -INT16_C(   222),  INT16_C(     2),  INT16_C( 26302),  INT16_C( 12009),  INT16_C( 26597), -INT16_C( 31488) },
+      { -INT16_C( 29730),  INT16_C( 13268), -INT16_C( 30712),  INT16_C(  2064), -INT16_C(  1542), -INT16_C( 22772), -INT16_C( 27416),  INT16_C(   556) },
+      {  INT16_C( 30200), -INT16_C( 28669),  INT16_C( 32712),  INT16_C(     0), -INT16_C( 26193),  INT16_C( 19386), -INT16_C( 26119), -INT16_C( 24256) } },
+    { {  INT16_C(     0),  INT16_C(     1),  INT16_C(   830),  INT16_C(  4672),  INT16_C(     1), -INT16_C( 32631), -INT16_C( 22044),  INT16_C(   128) },
+      { -INT16_C( 19457),  INT16_C(    16), -INT16_C(     3),       INT16_MAX,  INT16_C(  6464), -INT16_C(    13),  INT16_C( 32251), -INT16_C(  7460) },
+      {  INT16_C(     0),  INT16_C(     1),  INT16_C(   830),  INT16_C(  4672),  INT16_C(     1), -INT16_C( 32631), -INT16_C( 22044),  INT16_C(   128) },
+      {  INT16_C(    22),  INT16_C(    32),  INT16_C( 26591),  INT16_C( 18447),  INT16_C(    35),  INT16_C(  4415),  INT16_C( 15503),  INT16_C(  4124) },
+      {  INT16_C( 23039), -INT16_C( 32760),  INT16_C( 32766),  INT16_C( 16383), -INT16_C( 29536), -INT16_C(     7),  INT16_C( 16125),  INT16_C( 29038) },
+      {  INT16_C(     5),  INT16_C(     8),  INT16_C(  6647), -INT16_C( 28157),  INT16_C(     8),  INT16_C(  1103),  INT16_C( 20259),  INT16_C(  1031) } },
+    { { -INT16_C( 20409),  INT16_C(  4102),  INT16_C( 29018),  INT16_C(   768), -INT16_C(  6594),  INT16_C( 25824),  INT16_C(   238),  INT16_C(  6009) },
+      {  INT16_C( 20915), -INT16_C(     1), -INT16_C(   640),  INT16_C( 24915), -INT16_C(  8193), -INT16_C(     1),  INT16_C(  1322),  INT16_C(  2066) },
+      { -INT16_C( 20409),  INT16_C(  4102),  INT16_C( 29018),  INT16_C(   768), -INT16_C(  6594),  INT16_C( 25824),  INT16_C(   238),  INT16_C(  6009) },
+      {  INT16_C(  2282),  INT16_C(   223),  INT16_C( 11103),  INT16_C( 24588), -INT16_C( 14373), -INT16_C( 25569),  INT16_C(  7616), -INT16_C(  4319) },
+      { -INT16_C( 22311),       INT16_MAX,  INT16_C( 32448),  INT16_C( 12457),  INT16_C( 28671),       INT16_MAX,  INT16_C(   661), -INT16_C( 31735) },
+      { -INT16_C( 32198), -INT16_C( 32713), -INT16_C( 29993),  INT16_C(  6147),  INT16_C( 12790),  INT16_C(  9991),  INT16_C(  1904), -INT16_C( 17464) } },
+    { { -INT16_C( 12275), -INT16_C( 24234), -INT16_C(  2063), -INT16_C(  6273),  INT16_C(   419),  INT16_C( 17997), -INT16_C(   130),  INT16_C(  5572) },
+      {  INT16_C( 23519), -INT16_C(     1),  INT16_C(  2585),  INT16_C( 24576),  INT16_C(  8800), -INT16_C( 32616), -INT16_C(  4203), -INT16_C(     5) },
+      { -INT16_C( 12275), -INT16_C( 24234), -INT16_C(  2063), -INT16_C(  6273),  INT16_C(   419),  INT16_C( 17997), -INT16_C(   130),  INT16_C(  5572) },
+      {  INT16_C(   427),  INT16_C( 10975), -INT16_C(   479), -INT16_C(  4116),  INT16_C( 13412), -INT16_C( 13904), -INT16_C(  4131), -INT16_C( 18273) },
+      { -INT16_C( 21009),       INT16_MAX, -INT16_C( 31476), -INT16_C( 20480), -INT16_C( 28368), -INT16_C( 16308),  INT16_C( 30666),  INT16_C( 32765) },
+      { -INT16_C( 32662),  INT16_C(  2743), -INT16_C( 16504),  INT16_C( 15355),  INT16_C(  3353),  INT16_C( 12908), -INT16_C(  1033), -INT16_C( 20953) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r0 = simde_mm_shldi_epi16(a, b, 0);
+    simde_test_x86_assert_equal_i16x8(r0, simde_x_mm_loadu_epi16(test_vec[i].r0));
+    simde__m128i r5 = simde_mm_shldi_epi16(a, b, 5);
+    simde_test_x86_assert_equal_i16x8(r5, simde_x_mm_loadu_epi16(test_vec[i].r5));
+    simde__m128i r15 = simde_mm_shldi_epi16(a, b, 15);
+    simde_test_x86_assert_equal_i16x8(r15, simde_x_mm_loadu_epi16(test_vec[i].r15));
+    simde__m128i r19 = simde_mm_shldi_epi16(a, b, 19);
+    simde_test_x86_assert_equal_i16x8(r19, simde_x_mm_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r5[8];
+    const int16_t r15[8];
+    const int16_t r19[8];
+  } test_vec[] = {
+    { {  INT16_C( 21529),  INT16_C(  8192),  INT16_C(  2112),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112), -INT16_C(   545), -INT16_C( 21656) },
+      UINT8_C( 70),
+      {  INT16_C(     0),  INT16_C( 29127), -INT16_C(  4266),  INT16_C(  9218), -INT16_C(  8196), -INT16_C( 19386),  INT16_C( 10371), -INT16_C(  2049) },
+      { -INT16_C( 24833),  INT16_C( 28291), -INT16_C( 14184), -INT16_C( 17666),  INT16_C(   128),  INT16_C(   289), -INT16_C( 15214),  INT16_C( 17226) },
+      {  INT16_C( 21529),  INT16_C( 29127), -INT16_C(  4266),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112),  INT16_C( 10371), -INT16_C( 21656) },
+      {  INT16_C( 21529),  INT16_C( 14573), -INT16_C(  5415),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112),  INT16_C(  4216), -INT16_C( 21656) },
+      {  INT16_C( 21529), -INT16_C( 18623),  INT16_C( 25676),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112), -INT16_C(  7607), -INT16_C( 21656) },
+      {  INT16_C( 21529), -INT16_C( 29125),  INT16_C( 31414),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112),  INT16_C( 17438), -INT16_C( 21656) } },
+    { { -INT16_C(  8822),  INT16_C(     0),  INT16_C(     2),  INT16_C(   256), -INT16_C( 18408),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      UINT8_C( 30),
+      { -INT16_C( 23350), -INT16_C(    69),  INT16_C(   514),  INT16_C( 11613), -INT16_C(    35),  INT16_C(  8287), -INT16_C(    33), -INT16_C( 13568) },
+      {  INT16_C(   128), -INT16_C( 12154),  INT16_C( 13317),  INT16_C(  1552), -INT16_C(  3329), -INT16_C(  1861),  INT16_C( 23917),  INT16_C(   640) },
+      { -INT16_C(  8822), -INT16_C(    69),  INT16_C(   514),  INT16_C( 11613), -INT16_C(    35),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      { -INT16_C(  8822), -INT16_C(  2182),  INT16_C( 16454), -INT16_C( 21600), -INT16_C(  1090),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      { -INT16_C(  8822), -INT16_C(  6077),  INT16_C(  6658), -INT16_C( 31992), -INT16_C(  1665),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      { -INT16_C(  8822), -INT16_C(   546),  INT16_C(  4113),  INT16_C( 27368), -INT16_C(   273),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) } },
+    { {  INT16_C( 14874),  INT16_C(  9540), -INT16_C( 13072),  INT16_C( 20335),  INT16_C( 32255),  INT16_C(  8225), -INT16_C(  2053),  INT16_C( 30671) },
+      UINT8_C(213),
+      {  INT16_C(   129),  INT16_C( 16321),  INT16_C( 24367), -INT16_C( 32447),  INT16_C(  4098), -INT16_C( 27599), -INT16_C( 10613),  INT16_C( 32747) },
+      {  INT16_C(   529),  INT16_C(  5413), -INT16_C(   258), -INT16_C(  8257),  INT16_C( 32639),  INT16_C(   128), -INT16_C(  5297),  INT16_C( 28719) },
+      {  INT16_C(   129),  INT16_C(  9540),  INT16_C( 24367),  INT16_C( 20335),  INT16_C(  4098),  INT16_C(  8225), -INT16_C( 10613),  INT16_C( 32747) },
+      {  INT16_C(  4128),  INT16_C(  9540), -INT16_C(  6657),  INT16_C( 20335),  INT16_C(    79),  INT16_C(  8225), -INT16_C( 11907), -INT16_C(   658) },
+      { -INT16_C( 32504),  INT16_C(  9540), -INT16_C(   129),  INT16_C( 20335),  INT16_C( 16319),  INT16_C(  8225), -INT16_C(  2649), -INT16_C( 18409) },
+      {  INT16_C(  1032),  INT16_C(  9540), -INT16_C(  1665),  INT16_C( 20335), -INT16_C( 32749),  INT16_C(  8225), -INT16_C( 19361), -INT16_C(   165) } },
+    { {  INT16_C( 15027), -INT16_C(     3),  INT16_C(  7156),  INT16_C( 16514), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C( 27286) },
+      UINT8_C(140),
+      {  INT16_C(  9795), -INT16_C( 22262), -INT16_C(  1892),  INT16_C(    64),  INT16_C( 14279),  INT16_C(   256),  INT16_C(   512),  INT16_C(  2056) },
+      {  INT16_C(  8208),  INT16_C(  8272),  INT16_C(  1025), -INT16_C( 23511), -INT16_C(  2517),  INT16_C( 14258), -INT16_C(  4369), -INT16_C(  2923) },
+      {  INT16_C( 15027), -INT16_C(     3), -INT16_C(  1892),  INT16_C(    64), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C(  2056) },
+      {  INT16_C( 15027), -INT16_C(     3),  INT16_C(  4992),  INT16_C(  2068), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C(   286) },
+      {  INT16_C( 15027), -INT16_C(     3),  INT16_C(   512),  INT16_C( 21012), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C( 31306) },
+      {  INT16_C( 15027), -INT16_C(     3), -INT16_C( 15136),  INT16_C(   517), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C( 16455) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r0 = simde_mm_mask_shldi_epi16(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x8(r0, simde_x_mm_loadu_epi16(test_vec[i].r0));
+    simde__m128i r5 = simde_mm_mask_shldi_epi16(src, test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x8(r5, simde_x_mm_loadu_epi16(test_vec[i].r5));
+    simde__m128i r15 = simde_mm_mask_shldi_epi16(src, test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x8(r15, simde_x_mm_loadu_epi16(test_vec[i].r15));
+    simde__m128i r19 = simde_mm_mask_shldi_epi16(src, test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x8(r19, simde_x_mm_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r5[8];
+    const int16_t r15[8];
+    const int16_t r19[8];
+  } test_vec[] = {
+    { UINT8_C(193),
+      { -INT16_C( 32702), -INT16_C(  2579), -INT16_C(  1669),  INT16_C(     0),  INT16_C(     1),  INT16_C( 22483),  INT16_C(   537),  INT16_C( 31020) },
+      {  INT16_C(  6705),  INT16_C(  4863), -INT16_C(  2635), -INT16_C(  5123), -INT16_C(    66),  INT16_C(  4384),  INT16_C( 26392), -INT16_C( 11718) },
+      { -INT16_C( 32702),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   537),  INT16_C( 31020) },
+      {  INT16_C(  2115),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17196),  INT16_C(  9626) },
+      {  INT16_C(  3352),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19572),  INT16_C( 26909) },
+      {  INT16_C(   528),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4299), -INT16_C( 13978) } },
+    { UINT8_C( 55),
+      { -INT16_C(  6831), -INT16_C( 16384), -INT16_C( 24576), -INT16_C(  3036), -INT16_C( 18441), -INT16_C( 28718), -INT16_C(   129), -INT16_C( 24822) },
+      { -INT16_C( 16385), -INT16_C(  1025), -INT16_C(     1), -INT16_C(   320), -INT16_C(  8418), -INT16_C( 32703),       INT16_MAX,  INT16_C(     4) },
+      { -INT16_C(  6831), -INT16_C( 16384), -INT16_C( 24576),  INT16_C(     0), -INT16_C( 18441), -INT16_C( 28718),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C( 21961),  INT16_C(    31),  INT16_C(    31),  INT16_C(     0), -INT16_C(   261), -INT16_C(  1456),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(  8193),  INT16_C( 32255),       INT16_MAX,  INT16_C(     0), -INT16_C(  4209),  INT16_C( 16416),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C( 10893),  INT16_C(     7),  INT16_C(     7),  INT16_C(     0), -INT16_C( 16450),  INT16_C( 32404),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 78),
+      { -INT16_C( 16423),  INT16_C( 14408), -INT16_C(   487), -INT16_C(  5761), -INT16_C(  1132),  INT16_C(   640),  INT16_C(   272), -INT16_C( 28654) },
+      {  INT16_C( 31612), -INT16_C(   577),  INT16_C(  2084),  INT16_C( 17975), -INT16_C( 20739), -INT16_C( 24081),  INT16_C(    52),  INT16_C(     2) },
+      {  INT16_C(     0),  INT16_C( 14408), -INT16_C(   487), -INT16_C(  5761),  INT16_C(     0),  INT16_C(     0),  INT16_C(   272),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(  2335), -INT16_C( 15583),  INT16_C( 12264),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8704),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 32479), -INT16_C( 31726), -INT16_C( 23781),  INT16_C(     0),  INT16_C(     0),  INT16_C(    26),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C( 15801), -INT16_C(  3896),  INT16_C( 19450),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2176),  INT16_C(     0) } },
+    { UINT8_C(149),
+      { -INT16_C( 21002), -INT16_C( 14686), -INT16_C( 29125), -INT16_C( 24769), -INT16_C(   297),  INT16_C(   256), -INT16_C(   258), -INT16_C( 22540) },
+      { -INT16_C( 20748),  INT16_C( 15974),  INT16_C(   388),  INT16_C(     0), -INT16_C(  4331), -INT16_C(  9169),  INT16_C(  4153),  INT16_C(  2188) },
+      { -INT16_C( 21002),  INT16_C(     0), -INT16_C( 29125),  INT16_C(     0), -INT16_C(   297),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22540) },
+      { -INT16_C( 16683),  INT16_C(     0), -INT16_C( 14496),  INT16_C(     0), -INT16_C(  9475),  INT16_C(     0),  INT16_C(     0), -INT16_C(   383) },
+      {  INT16_C( 22394),  INT16_C(     0), -INT16_C( 32574),  INT16_C(     0), -INT16_C(  2166),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1094) },
+      {  INT16_C( 28597),  INT16_C(     0),  INT16_C( 29144),  INT16_C(     0), -INT16_C(  2369),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16288) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r0 = simde_mm_maskz_shldi_epi16(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x8(r0, simde_x_mm_loadu_epi16(test_vec[i].r0));
+    simde__m128i r5 = simde_mm_maskz_shldi_epi16(test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x8(r5, simde_x_mm_loadu_epi16(test_vec[i].r5));
+    simde__m128i r15 = simde_mm_maskz_shldi_epi16(test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x8(r15, simde_x_mm_loadu_epi16(test_vec[i].r15));
+    simde__m128i r19 = simde_mm_maskz_shldi_epi16(test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x8(r19, simde_x_mm_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r7[4];
+    const int32_t r31[4];
+    const int32_t r40[4];
+  } test_vec[] = {
+    { {  INT32_C(    53852042),  INT32_C(     4227072), -INT32_C(   465897233), -INT32_C(         769) },
+      { -INT32_C(         529), -INT32_C(     1049605),  INT32_C(        8208),  INT32_C(  1089682283) },
+      {  INT32_C(    53852042),  INT32_C(     4227072), -INT32_C(   465897233), -INT32_C(         769) },
+      { -INT32_C(  1696873089),  INT32_C(   541065343),  INT32_C(   494696320), -INT32_C(       98400) },
+      {  INT32_C(  2147483383),  INT32_C(  2146958845), -INT32_C(  2147479544), -INT32_C(  1602642507) },
+      {  INT32_C(   901221119),  INT32_C(  1082130687),  INT32_C(   989392640), -INT32_C(      196800) } },
+    { {  INT32_C(      196624),  INT32_C(  1082895334), -INT32_C(     1437238),  INT32_C(   869050994) },
+      { -INT32_C(  2147483640),  INT32_C(   281018368),  INT32_C(   398418030),  INT32_C(    68227592) },
+      {  INT32_C(      196624),  INT32_C(  1082895334), -INT32_C(     1437238),  INT32_C(   869050994) },
+      {  INT32_C(    25167936),  INT32_C(  1171649288), -INT32_C(   183966453), -INT32_C(   430622462) },
+      {  INT32_C(  1073741828),  INT32_C(   140509184),  INT32_C(   199209015),  INT32_C(    34113796) },
+      {  INT32_C(    50335872), -INT32_C(  1951668720), -INT32_C(   367932905), -INT32_C(   861244924) } },
+    { {  INT32_C(  1212248946),  INT32_C(  1135685454), -INT32_C(  2011157187), -INT32_C(   680370993) },
+      { -INT32_C(   925576020), -INT32_C(   528220150),  INT32_C(   286136966),  INT32_C(    75497736) },
+      {  INT32_C(  1212248946),  INT32_C(  1135685454), -INT32_C(  2011157187), -INT32_C(   680370993) },
+      {  INT32_C(   549042532), -INT32_C(   661149840),  INT32_C(   269917832), -INT32_C(  1188141182) },
+      {  INT32_C(  1684695638),  INT32_C(  1883373573), -INT32_C(  2004415165), -INT32_C(  2109734780) },
+      {  INT32_C(  1098085064), -INT32_C(  1322299680),  INT32_C(   539835665),  INT32_C(  1918684932) } },
+    { { -INT32_C(  2062974952), -INT32_C(     1052707),  INT32_C(  1970272255),  INT32_C(    41945153) },
+      { -INT32_C(   553664521), -INT32_C(  1075314817), -INT32_C(   311753775),  INT32_C(  1126662163) },
+      { -INT32_C(  2062974952), -INT32_C(     1052707),  INT32_C(  1970272255),  INT32_C(    41945153) },
+      { -INT32_C(  2067788689), -INT32_C(   134746401), -INT32_C(  1208221706),  INT32_C(  1074012321) },
+      {  INT32_C(  1870651387), -INT32_C(   537657409), -INT32_C(   155876888), -INT32_C(  1584152567) },
+      {  INT32_C(   159389918), -INT32_C(   269492801),  INT32_C(  1878523885), -INT32_C(  2146942653) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r0 = simde_mm_shldi_epi32(a, b, 0);
+    simde_test_x86_assert_equal_i32x4(r0, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    simde__m128i r7 = simde_mm_shldi_epi32(a, b, 7);
+    simde_test_x86_assert_equal_i32x4(r7, simde_x_mm_loadu_epi32(test_vec[i].r7));
+    simde__m128i r31 = simde_mm_shldi_epi32(a, b, 31);
+    simde_test_x86_assert_equal_i32x4(r31, simde_x_mm_loadu_epi32(test_vec[i].r31));
+    simde__m128i r40 = simde_mm_shldi_epi32(a, b, 40);
+    simde_test_x86_assert_equal_i32x4(r40, simde_x_mm_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r7[4];
+    const int32_t r31[4];
+    const int32_t r40[4];
+  } test_vec[] = {
+    { { -INT32_C(  1021937721),  INT32_C(  1610530683), -INT32_C(   272728099), -INT32_C(      262277) },
+      UINT8_C(183),
+      { -INT32_C(   329705193), -INT32_C(   707335039), -INT32_C(     4722177), -INT32_C(   159373473) },
+      {  INT32_C(   395273988),  INT32_C(           2), -INT32_C(   541065217), -INT32_C(   749336017) },
+      { -INT32_C(   329705193), -INT32_C(   707335039), -INT32_C(     4722177), -INT32_C(      262277) },
+      {  INT32_C(   747408267), -INT32_C(   344571776), -INT32_C(   604438545), -INT32_C(      262277) },
+      { -INT32_C(  1949846654), -INT32_C(  2147483647), -INT32_C(   270532609), -INT32_C(      262277) },
+      {  INT32_C(  1494816535), -INT32_C(   689143552), -INT32_C(  1208877089), -INT32_C(      262277) } },
+    { { -INT32_C(      411681),  INT32_C(   595824586),  INT32_C(    84017552), -INT32_C(   811577883) },
+      UINT8_C(183),
+      { -INT32_C(   402661379), -INT32_C(  1566067201), -INT32_C(  1300164558), -INT32_C(   704067697) },
+      { -INT32_C(   189633496),  INT32_C(   221399437),  INT32_C(  2146856958), -INT32_C(  1107296273) },
+      { -INT32_C(   402661379), -INT32_C(  1566067201), -INT32_C(  1300164558), -INT32_C(   811577883) },
+      { -INT32_C(     1048838),  INT32_C(  1406861190),  INT32_C(  1082661183), -INT32_C(   811577883) },
+      { -INT32_C(    94816748), -INT32_C(  2036783930),  INT32_C(  1073428479), -INT32_C(   811577883) },
+      { -INT32_C(     2097676), -INT32_C(  1481244915), -INT32_C(  2129644929), -INT32_C(   811577883) } },
+    { { -INT32_C(     8650753), -INT32_C(  2138501110),  INT32_C(   152762703), -INT32_C(  1879048176) },
+      UINT8_C( 29),
+      {  INT32_C(  1552834782), -INT32_C(     2097158), -INT32_C(  1255743564),  INT32_C(     7720560) },
+      {            INT32_MIN,  INT32_C(    33554436),  INT32_C(      788992),  INT32_C(  1333786617) },
+      {  INT32_C(  1552834782), -INT32_C(  2138501110), -INT32_C(  1255743564),  INT32_C(     7720560) },
+      {  INT32_C(  1194356544), -INT32_C(  2138501110), -INT32_C(  1821386240),  INT32_C(   988231719) },
+      {  INT32_C(  1073741824), -INT32_C(  2138501110),  INT32_C(      394496),  INT32_C(   666893308) },
+      { -INT32_C(  1906254208), -INT32_C(  2138501110),  INT32_C(   652194816),  INT32_C(  1976463439) } },
+    { { -INT32_C(  2080306176),  INT32_C(   277088384), -INT32_C(    67518499),  INT32_C(   202878502) },
+      UINT8_C(101),
+      {  INT32_C(  1615198232),  INT32_C(   323454800),  INT32_C(     1089536),  INT32_C(  1616939545) },
+      { -INT32_C(  1342177793), -INT32_C(    46173196), -INT32_C(      331922), -INT32_C(  1405209659) },
+      {  INT32_C(  1615198232),  INT32_C(   277088384),  INT32_C(     1089536),  INT32_C(   202878502) },
+      {  INT32_C(   586943575),  INT32_C(   277088384),  INT32_C(   139460735),  INT32_C(   202878502) },
+      {  INT32_C(  1476394751),  INT32_C(   277088384),  INT32_C(  2147317687),  INT32_C(   202878502) },
+      {  INT32_C(  1173887151),  INT32_C(   277088384),  INT32_C(   278921471),  INT32_C(   202878502) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r0 = simde_mm_mask_shldi_epi32(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x4(r0, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    simde__m128i r7 = simde_mm_mask_shldi_epi32(src, test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x4(r7, simde_x_mm_loadu_epi32(test_vec[i].r7));
+    simde__m128i r31 = simde_mm_mask_shldi_epi32(src, test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x4(r31, simde_x_mm_loadu_epi32(test_vec[i].r31));
+    simde__m128i r40 = simde_mm_mask_shldi_epi32(src, test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x4(r40, simde_x_mm_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r7[4];
+    const int32_t r31[4];
+    const int32_t r40[4];
+  } test_vec[] = {
+    { UINT8_C( 33),
+      {  INT32_C(   411172864),  INT32_C(   900618222), -INT32_C(  1239444156),  INT32_C(   134480048) },
+      {  INT32_C(   982776018),  INT32_C(   268701696), -INT32_C(   716308339), -INT32_C(  2066763552) },
+      {  INT32_C(   411172864),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  1090519069),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(   491388009),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  2113929158),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 97),
+      {  INT32_C(  1485107419),  INT32_C(  1552334443), -INT32_C(  1877999584), -INT32_C(   134381570) },
+      { -INT32_C(   570434058), -INT32_C(        1027),  INT32_C(  1845872620),  INT32_C(  1406834886) },
+      {  INT32_C(  1485107419),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  1115188718),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   285217029),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  2064589859),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 92),
+      { -INT32_C(  1914910800), -INT32_C(       65794),  INT32_C(  1076240896), -INT32_C(     5275785) },
+      {  INT32_C(   983936471), -INT32_C(  1080330590),  INT32_C(  1082392609), -INT32_C(     8388737) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1076240896), -INT32_C(     5275785) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   319881248), -INT32_C(   675300353) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   541196304), -INT32_C(     4194369) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   639762496), -INT32_C(  1350600705) } },
+    { UINT8_C(199),
+      {  INT32_C(     8388864),  INT32_C(      541696),  INT32_C(           2),  INT32_C(        1100) },
+      { -INT32_C(    67764225),  INT32_C(  2054310575),  INT32_C(     8389714),  INT32_C(        2688) },
+      {  INT32_C(     8388864),  INT32_C(      541696),  INT32_C(           2),  INT32_C(           0) },
+      {  INT32_C(  1073774717),  INT32_C(    69337149),  INT32_C(         256),  INT32_C(           0) },
+      {  INT32_C(  2113601535),  INT32_C(  1027155287),  INT32_C(     4194857),  INT32_C(           0) },
+      { -INT32_C(  2147417861),  INT32_C(   138674298),  INT32_C(         512),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r0 = simde_mm_maskz_shldi_epi32(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x4(r0, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    simde__m128i r7 = simde_mm_maskz_shldi_epi32(test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x4(r7, simde_x_mm_loadu_epi32(test_vec[i].r7));
+    simde__m128i r31 = simde_mm_maskz_shldi_epi32(test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x4(r31, simde_x_mm_loadu_epi32(test_vec[i].r31));
+    simde__m128i r40 = simde_mm_maskz_shldi_epi32(test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x4(r40, simde_x_mm_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r13[2];
+    const int64_t r63[2];
+    const int64_t r72[2];
+  } test_vec[] = {
+    { { -INT64_C(  900274069877448275), -INT64_C( 1276925047256958808) },
+      {  INT64_C( 4600959125504097979),  INT64_C( 6042257448177895128) },
+      { -INT64_C(  900274069877448275), -INT64_C( 1276925047256958808) },
+      {  INT64_C( 3652449047764379643), -INT64_C( 1266097335690786181) },
+      { -INT64_C( 6922892474102726819),  INT64_C( 3021128724088947564) },
+      { -INT64_C( 9109233004112138945),  INT64_C( 5148581228990474323) } },
+    { {  INT64_C( 4616225938982830336),  INT64_C( 6694283299646965900) },
+      {  INT64_C( 5294262319115977614),  INT64_C( 8470272515974221267) },
+      {  INT64_C( 4616225938982830336),  INT64_C( 6694283299646965900) },
+      {  INT64_C(  297541042765302063), -INT64_C( 2601340430552297807) },
+      {  INT64_C( 2647131159557988807),  INT64_C( 4235136257987110633) },
+      {  INT64_C( 1162219662193262665), -INT64_C( 1810674145365029771) } },
+    { {  INT64_C( 5190433914216551640), -INT64_C(     738873970786465) },
+      { -INT64_C(   45317471250415681),  INT64_C( 5453957155436318841) },
+      {  INT64_C( 5190433914216551640), -INT64_C(     738873970786465) },
+      {  INT64_C(  289535361474568171), -INT64_C( 6052855568682718858) },
+      {  INT64_C( 9200713301229567967), -INT64_C( 6496393459136616388) },
+      {  INT64_C(  585508732349503743), -INT64_C(  189151736521334965) } },
+    { {  INT64_C( 7133001015851449933),  INT64_C( 9207616568841655251) },
+      { -INT64_C( 5847639606988294940), -INT64_C( 2305895785772369409) },
+      {  INT64_C( 7133001015851449933),  INT64_C( 9207616568841655251) },
+      { -INT64_C( 5740903656781662757),  INT64_C(   58414552483265535) },
+      { -INT64_C( 2923819803494147470), -INT64_C( 1152947892886184705) },
+      { -INT64_C(  179403239274426962), -INT64_C( 4033399811358862369) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r0 = simde_mm_shldi_epi64(a, b, 0);
+    simde_test_x86_assert_equal_i64x2(r0, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    simde__m128i r13 = simde_mm_shldi_epi64(a, b, 13);
+    simde_test_x86_assert_equal_i64x2(r13, simde_x_mm_loadu_epi64(test_vec[i].r13));
+    simde__m128i r63 = simde_mm_shldi_epi64(a, b, 63);
+    simde_test_x86_assert_equal_i64x2(r63, simde_x_mm_loadu_epi64(test_vec[i].r63));
+    simde__m128i r72 = simde_mm_shldi_epi64(a, b, 72);
+    simde_test_x86_assert_equal_i64x2(r72, simde_x_mm_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r13[2];
+    const int64_t r63[2];
+    const int64_t r72[2];
+  } test_vec[] = {
+    { {  INT64_C(   73324240023060480),  INT64_C( 2305878193653284864) },
+      UINT8_C(199),
+      {  INT64_C(  892333193249821773),  INT64_C( 4185268267097574617) },
+      { -INT64_C(        824633720833),  INT64_C( 1825346250189948153) },
+      {  INT64_C(  892333193249821773),  INT64_C( 4185268267097574617) },
+      {  INT64_C( 5082865913557532671), -INT64_C( 6779588962725190870) },
+      { -INT64_C(        412316860417), -INT64_C( 8310698911759801732) },
+      {  INT64_C( 7076368587439754751),  INT64_C( 1517520101825108249) } },
+    { { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      UINT8_C(124),
+      {  INT64_C(  308040993149046597),  INT64_C( 4250359746092252472) },
+      { -INT64_C( 4630865899329486851),  INT64_C( 2586547524296485037) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) } },
+    { { -INT64_C(    1125899908939777), -INT64_C( 6809121278853706553) },
+      UINT8_C(230),
+      { -INT64_C(     563259329511937),  INT64_C(     147336722387136) },
+      { -INT64_C( 2748922581925095278),  INT64_C( 5130046208865553324) },
+      { -INT64_C(    1125899908939777),  INT64_C(     147336722387136) },
+      { -INT64_C(    1125899908939777),  INT64_C( 1206982429795420390) },
+      { -INT64_C(    1125899908939777),  INT64_C( 2565023104432776662) },
+      { -INT64_C(    1125899908939777),  INT64_C(   37718200931106887) } },
+    { {  INT64_C(    2286993379819776), -INT64_C( 6447303931077666020) },
+      UINT8_C( 31),
+      { -INT64_C(       1108135903234),  INT64_C(   56298298172023809) },
+      { -INT64_C(     633426072305665), -INT64_C( 5016506412408516886) },
+      { -INT64_C(       1108135903234),  INT64_C(   56298298172023809) },
+      { -INT64_C(    9077849319284737),  INT64_C(   27056782480258892) },
+      {  INT64_C( 9223055323818622975), -INT64_C( 2508253206204258443) },
+      { -INT64_C(     283682791227649), -INT64_C( 4034379741671456326) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r0 = simde_mm_mask_shldi_epi64(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x2(r0, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    simde__m128i r13 = simde_mm_mask_shldi_epi64(src, test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x2(r13, simde_x_mm_loadu_epi64(test_vec[i].r13));
+    simde__m128i r63 = simde_mm_mask_shldi_epi64(src, test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x2(r63, simde_x_mm_loadu_epi64(test_vec[i].r63));
+    simde__m128i r72 = simde_mm_mask_shldi_epi64(src, test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x2(r72, simde_x_mm_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r13[2];
+    const int64_t r63[2];
+    const int64_t r72[2];
+  } test_vec[] = {
+    { UINT8_C(200),
+      {  INT64_C( 3639061855255684559), -INT64_C( 1445296953154926061) },
+      { -INT64_C( 7215604875077074154),  INT64_C( 7321966304620590139) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(125),
+      {  INT64_C( 3053102659216256493),  INT64_C(  771011520021587929) },
+      { -INT64_C(  155462156870623425),  INT64_C(       1374389534720) },
+      {  INT64_C( 3053102659216256493),  INT64_C(                   0) },
+      { -INT64_C( 2767979650578792518),  INT64_C(                   0) },
+      { -INT64_C(   77731078435311713),  INT64_C(                   0) },
+      {  INT64_C( 6831029663560494589),  INT64_C(                   0) } },
+    { UINT8_C(220),
+      { -INT64_C( 3882115141215913292),  INT64_C( 9187272853643067391) },
+      {  INT64_C( 6047006599553610807), -INT64_C( 5698450579961475866) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(183),
+      {  INT64_C( 8069887582293721087),  INT64_C(   36592039603733512) },
+      { -INT64_C( 4970897121225156545),  INT64_C( 9223371950686985951) },
+      {  INT64_C( 8069887582293721087),  INT64_C(   36592039603733512) },
+      { -INT64_C( 4611686024869841056),  INT64_C( 4614083254432108543) },
+      { -INT64_C( 2485448560612578273),  INT64_C( 4611685975343492975) },
+      { -INT64_C(  144115188277182533), -INT64_C( 9079181935153772417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r0 = simde_mm_maskz_shldi_epi64(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x2(r0, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    simde__m128i r13 = simde_mm_maskz_shldi_epi64(test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x2(r13, simde_x_mm_loadu_epi64(test_vec[i].r13));
+    simde__m128i r63 = simde_mm_maskz_shldi_epi64(test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x2(r63, simde_x_mm_loadu_epi64(test_vec[i].r63));
+    simde__m128i r72 = simde_mm_maskz_shldi_epi64(test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x2(r72, simde_x_mm_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r0[16];
+    const int16_t r5[16];
+    const int16_t r15[16];
+    const int16_t r19[16];
+  } test_vec[] = {
+    { {  INT16_C(     0), -INT16_C(   129), -INT16_C(  8328),  INT16_C(  7154), -INT16_C( 15433),  INT16_C( 18311), -INT16_C( 19110),  INT16_C(  4879),
+        -INT16_C(     1),  INT16_C( 10682), -INT16_C( 12356),  INT16_C(  1024),  INT16_C( 16469),  INT16_C(   146),  INT16_C( 12589), -INT16_C(  8323) },
+      { -INT16_C(  2414),  INT16_C(    64),  INT16_C(  2050), -INT16_C(  1025),  INT16_C(    72),  INT16_C( 16460), -INT16_C(  2089),  INT16_C(  1024),
+         INT16_C(  8054), -INT16_C( 21169),  INT16_C( 32573), -INT16_C( 17425), -INT16_C( 10210), -INT16_C( 31744), -INT16_C( 13498), -INT16_C( 17187) },
+      {  INT16_C(     0), -INT16_C(   129), -INT16_C(  8328),  INT16_C(  7154), -INT16_C( 15433),  INT16_C( 18311), -INT16_C( 19110),  INT16_C(  4879),
+        -INT16_C(     1),  INT16_C( 10682), -INT16_C( 12356),  INT16_C(  1024),  INT16_C( 16469),  INT16_C(   146),  INT16_C( 12589), -INT16_C(  8323) },
+      {  INT16_C(    30), -INT16_C(  4128), -INT16_C(  4351),  INT16_C( 32351),  INT16_C( 30432), -INT16_C(  3864), -INT16_C( 21666),  INT16_C( 25056),
+        -INT16_C(    29),  INT16_C( 14165), -INT16_C(  2161), -INT16_C( 32745),  INT16_C(  2747),  INT16_C(  4688),  INT16_C(  9657), -INT16_C(  4169) },
+      {  INT16_C( 31561), -INT16_C( 32736),  INT16_C(  1025),  INT16_C( 32255), -INT16_C( 32732), -INT16_C( 24538),  INT16_C( 31723), -INT16_C( 32256),
+        -INT16_C( 28741),  INT16_C( 22183),  INT16_C( 16286),  INT16_C( 24055), -INT16_C(  5105),  INT16_C( 16896), -INT16_C(  6749), -INT16_C(  8594) },
+      {  INT16_C(     7), -INT16_C(  1032), -INT16_C(  1088), -INT16_C(  8297),  INT16_C(  7608),  INT16_C( 15418), -INT16_C( 21801), -INT16_C( 26504),
+        -INT16_C(     8),  INT16_C( 19925),  INT16_C( 32227),  INT16_C(  8197),  INT16_C(   686),  INT16_C(  1172), -INT16_C( 30354), -INT16_C(  1043) } },
+    { { -INT16_C( 20481),  INT16_C(  2080), -INT16_C( 32752), -INT16_C(  8304),  INT16_C( 24189), -INT16_C( 17425), -INT16_C( 13399),  INT16_C( 11296),
+         INT16_C(     0), -INT16_C( 30530),  INT16_C( 13900),  INT16_C(     0),  INT16_C( 28158), -INT16_C(     1),  INT16_C( 10076),  INT16_C( 16146) },
+      { -INT16_C( 19408),  INT16_C( 23925),  INT16_C( 29841),  INT16_C( 31268), -INT16_C(  1762), -INT16_C(  9237), -INT16_C(  4108), -INT16_C( 30680),
+         INT16_C(  9721), -INT16_C( 21378),  INT16_C(    80),  INT16_C(   792),  INT16_C( 20893), -INT16_C(   310), -INT16_C(     8), -INT16_C( 12657) },
+      { -INT16_C( 20481),  INT16_C(  2080), -INT16_C( 32752), -INT16_C(  8304),  INT16_C( 24189), -INT16_C( 17425), -INT16_C( 13399),  INT16_C( 11296),
+         INT16_C(     0), -INT16_C( 30530),  INT16_C( 13900),  INT16_C(     0),  INT16_C( 28158), -INT16_C(     1),  INT16_C( 10076),  INT16_C( 16146) },
+      { -INT16_C(    10),  INT16_C(  1035),  INT16_C(   526), -INT16_C(  3569), -INT16_C( 12353),  INT16_C( 32251),  INT16_C( 30013), -INT16_C( 31727),
+         INT16_C(     4),  INT16_C(  6101), -INT16_C( 13952),  INT16_C(     0), -INT16_C( 16438), -INT16_C(     1), -INT16_C(  5217), -INT16_C(  7591) },
+      { -INT16_C(  9704),  INT16_C( 11962),  INT16_C( 14920),  INT16_C( 15634), -INT16_C(   881), -INT16_C(  4619), -INT16_C(  2054),  INT16_C( 17428),
+         INT16_C(  4860),  INT16_C( 22079),  INT16_C(    40),  INT16_C(   396),  INT16_C( 10446), -INT16_C(   155),  INT16_C( 32764),  INT16_C( 26439) },
+      {  INT16_C( 32765),  INT16_C( 16642),  INT16_C(   131), -INT16_C(   893), -INT16_C(  3089), -INT16_C(  8322),  INT16_C( 23887),  INT16_C( 24836),
+         INT16_C(     1),  INT16_C( 17909), -INT16_C( 19872),  INT16_C(     0),  INT16_C( 28658), -INT16_C(     1),  INT16_C( 15079), -INT16_C(  1898) } },
+    { {  INT16_C(     0), -INT16_C( 25201), -INT16_C( 29620), -INT16_C(   289), -INT16_C(  7696),  INT16_C(  9791),  INT16_C( 18434),  INT16_C( 16542),
+         INT16_C( 16400),  INT16_C(     0),  INT16_C( 28093),  INT16_C( 28951),  INT16_C(   759), -INT16_C( 10740), -INT16_C(   130),  INT16_C(     8) },
+      {  INT16_C(  2050),  INT16_C(   441),  INT16_C( 32719), -INT16_C(  4199), -INT16_C(    11), -INT16_C(   750),  INT16_C(    28),  INT16_C(  5983),
+         INT16_C(   128),  INT16_C( 30107),  INT16_C(  2048), -INT16_C( 10497), -INT16_C(  4106), -INT16_C(   272), -INT16_C(  6145),  INT16_C(    32) },
+      {  INT16_C(     0), -INT16_C( 25201), -INT16_C( 29620), -INT16_C(   289), -INT16_C(  7696),  INT16_C(  9791),  INT16_C( 18434),  INT16_C( 16542),
+         INT16_C( 16400),  INT16_C(     0),  INT16_C( 28093),  INT16_C( 28951),  INT16_C(   759), -INT16_C( 10740), -INT16_C(   130),  INT16_C(     8) },
+      {  INT16_C(     1), -INT16_C( 20000), -INT16_C( 30321), -INT16_C(  9219),  INT16_C( 15903), -INT16_C( 14337),  INT16_C(    64),  INT16_C(  5058),
+         INT16_C(   512),  INT16_C(    14), -INT16_C( 18527),  INT16_C(  8954),  INT16_C( 24317), -INT16_C( 15969), -INT16_C(  4132),  INT16_C(   256) },
+      {  INT16_C(  1025), -INT16_C( 32548),  INT16_C( 16359), -INT16_C(  2100),  INT16_C( 32762), -INT16_C(   375),  INT16_C(    14),  INT16_C(  2991),
+         INT16_C(    64),  INT16_C( 15053), -INT16_C( 31744), -INT16_C(  5249), -INT16_C(  2053),  INT16_C( 32632),  INT16_C( 29695),  INT16_C(    16) },
+      {  INT16_C(     0), -INT16_C(  5000),  INT16_C( 25187), -INT16_C(  2305),  INT16_C(  3975),  INT16_C( 12799),  INT16_C( 16400),  INT16_C(  1264),
+         INT16_C(   128),  INT16_C(     3),  INT16_C( 28136), -INT16_C( 30530),  INT16_C(  6079), -INT16_C( 20377), -INT16_C(  1033),  INT16_C(    64) } },
+    { {  INT16_C( 17100),  INT16_C(  8256),  INT16_C( 26570), -INT16_C( 26003), -INT16_C(  5925), -INT16_C( 13587), -INT16_C( 16739),  INT16_C(    80),
+        -INT16_C( 25202),  INT16_C( 15410), -INT16_C( 13820), -INT16_C( 26640),  INT16_C(  7942),  INT16_C(  9348), -INT16_C( 27598), -INT16_C(  4105) },
+      { -INT16_C(  4129), -INT16_C( 17526),  INT16_C( 11985), -INT16_C( 23135),  INT16_C(     2), -INT16_C( 32752), -INT16_C( 15751),  INT16_C(     0),
+         INT16_C(  2094),  INT16_C( 30035),  INT16_C(   256), -INT16_C(  6402), -INT16_C( 10242),  INT16_C(   770), -INT16_C(     5), -INT16_C(  8193) },
+      {  INT16_C( 17100),  INT16_C(  8256),  INT16_C( 26570), -INT16_C( 26003), -INT16_C(  5925), -INT16_C( 13587), -INT16_C( 16739),  INT16_C(    80),
+        -INT16_C( 25202),  INT16_C( 15410), -INT16_C( 13820), -INT16_C( 26640),  INT16_C(  7942),  INT16_C(  9348), -INT16_C( 27598), -INT16_C(  4105) },
+      {  INT16_C( 22941),  INT16_C(  2071), -INT16_C(  1723),  INT16_C( 19892),  INT16_C(  7008),  INT16_C( 23984), -INT16_C( 11336),  INT16_C(  2560),
+        -INT16_C( 20031), -INT16_C( 31154),  INT16_C( 16512), -INT16_C(   484), -INT16_C(  7974), -INT16_C( 28544), -INT16_C( 31137), -INT16_C(   261) },
+      {  INT16_C( 30703),  INT16_C( 24005),  INT16_C(  5992), -INT16_C( 11568), -INT16_C( 32767), -INT16_C( 16376), -INT16_C(  7876),  INT16_C(     0),
+         INT16_C(  1047),  INT16_C( 15017),  INT16_C(   128),  INT16_C( 29567),  INT16_C( 27647),  INT16_C(   385),  INT16_C( 32765), -INT16_C(  4097) },
+      {  INT16_C(  5735),  INT16_C(   517),  INT16_C( 15953), -INT16_C( 11411),  INT16_C( 18136),  INT16_C( 22380), -INT16_C(  2834),  INT16_C(   640),
+        -INT16_C(  5008), -INT16_C(  7789),  INT16_C( 20512), -INT16_C( 16505), -INT16_C(  1994),  INT16_C(  9248), -INT16_C( 24169),  INT16_C( 32702) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_shldi_epi16(a, b, 0);
+    simde_test_x86_assert_equal_i16x16(r0, simde_x_mm256_loadu_epi16(test_vec[i].r0));
+    simde__m256i r5 = simde_mm256_shldi_epi16(a, b, 5);
+    simde_test_x86_assert_equal_i16x16(r5, simde_x_mm256_loadu_epi16(test_vec[i].r5));
+    simde__m256i r15 = simde_mm256_shldi_epi16(a, b, 15);
+    simde_test_x86_assert_equal_i16x16(r15, simde_x_mm256_loadu_epi16(test_vec[i].r15));
+    simde__m256i r19 = simde_mm256_shldi_epi16(a, b, 19);
+    simde_test_x86_assert_equal_i16x16(r19, simde_x_mm256_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r0[16];
+    const int16_t r5[16];
+    const int16_t r15[16];
+    const int16_t r19[16];
+  } test_vec[] = {
+    { { -INT16_C( 15641), -INT16_C( 23040),  INT16_C( 19028), -INT16_C(  1025), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503), -INT16_C( 31719),
+         INT16_C( 25441), -INT16_C(     9),  INT16_C( 14509),  INT16_C( 16548),       INT16_MAX, -INT16_C(    65),  INT16_C( 17389),  INT16_C(     8) },
+      UINT16_C(56203),
+      {  INT16_C(     2),  INT16_C(  5887), -INT16_C( 17948), -INT16_C( 20081), -INT16_C( 13552),  INT16_C( 25057), -INT16_C(  3017),  INT16_C( 30552),
+        -INT16_C( 22654),  INT16_C(  8126),  INT16_C( 15647), -INT16_C(  1025), -INT16_C( 10368), -INT16_C(     1),  INT16_C(     9), -INT16_C( 24277) },
+      {  INT16_C( 22027),  INT16_C(     0),  INT16_C(  8320), -INT16_C( 16101), -INT16_C( 13400),  INT16_C(     2),  INT16_C( 28213),  INT16_C(     0),
+        -INT16_C( 11564), -INT16_C(   129), -INT16_C(  4265),  INT16_C( 14338), -INT16_C( 13107), -INT16_C( 16536), -INT16_C(     1), -INT16_C( 27278) },
+      {  INT16_C(     2),  INT16_C(  5887),  INT16_C( 19028), -INT16_C( 20081), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503),  INT16_C( 30552),
+        -INT16_C( 22654),  INT16_C(  8126),  INT16_C( 14509), -INT16_C(  1025), -INT16_C( 10368), -INT16_C(    65),  INT16_C(     9), -INT16_C( 24277) },
+      {  INT16_C(    74), -INT16_C(  8224),  INT16_C( 19028),  INT16_C( 12792), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503), -INT16_C(  5376),
+        -INT16_C(  4006), -INT16_C(  2081),  INT16_C( 14509),  INT16_C( 32743), -INT16_C(  4071), -INT16_C(    65),  INT16_C(   319),  INT16_C(  9586) },
+      {  INT16_C( 11013),       INT16_MIN,  INT16_C( 19028), -INT16_C(  8051), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503),  INT16_C(     0),
+         INT16_C( 26986),  INT16_C( 32703),  INT16_C( 14509), -INT16_C( 25599),  INT16_C( 26214), -INT16_C(    65), -INT16_C(     1), -INT16_C( 13639) },
+      {  INT16_C(    18), -INT16_C( 18440),  INT16_C( 19028), -INT16_C( 29570), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503), -INT16_C( 17728),
+         INT16_C( 15382), -INT16_C(   521),  INT16_C( 14509), -INT16_C(  8199), -INT16_C( 17402), -INT16_C(    65),  INT16_C(    79),  INT16_C(  2396) } },
+    { { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751),  INT16_C( 16256),  INT16_C( 32515), -INT16_C(   710), -INT16_C(     5), -INT16_C(  7502),
+         INT16_C( 16448),  INT16_C( 19773),  INT16_C( 18432),  INT16_C( 22810), -INT16_C( 30294),  INT16_C(    16), -INT16_C( 22576), -INT16_C( 32298) },
+      UINT16_C(27304),
+      {  INT16_C(  1552), -INT16_C(   513), -INT16_C(  9217),  INT16_C( 17881), -INT16_C(     1), -INT16_C( 18945),  INT16_C( 16384), -INT16_C( 12383),
+        -INT16_C( 23472), -INT16_C( 16376),  INT16_C( 15690),  INT16_C( 26513), -INT16_C( 20737),  INT16_C(   544),  INT16_C(  4864), -INT16_C(  6843) },
+      {  INT16_C( 16896),  INT16_C( 25051),  INT16_C(   656), -INT16_C(    10),  INT16_C(   320), -INT16_C(  6421), -INT16_C( 10321),  INT16_C( 24786),
+         INT16_C(  8208), -INT16_C(  8537), -INT16_C(  4210),  INT16_C( 12323), -INT16_C(   577),  INT16_C( 32751), -INT16_C( 18167), -INT16_C(     1) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751),  INT16_C( 17881),  INT16_C( 32515), -INT16_C( 18945), -INT16_C(     5), -INT16_C( 12383),
+         INT16_C( 16448), -INT16_C( 16376),  INT16_C( 18432),  INT16_C( 26513), -INT16_C( 30294),  INT16_C(   544),  INT16_C(  4864), -INT16_C( 32298) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751), -INT16_C( 17601),  INT16_C( 32515), -INT16_C( 16388), -INT16_C(     5), -INT16_C(  3028),
+         INT16_C( 16448),  INT16_C(   283),  INT16_C( 18432), -INT16_C(  3546), -INT16_C( 30294),  INT16_C( 17423),  INT16_C( 24599), -INT16_C( 32298) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751), -INT16_C(     5),  INT16_C( 32515), -INT16_C(  3211), -INT16_C(     5), -INT16_C( 20375),
+         INT16_C( 16448),  INT16_C( 28499),  INT16_C( 18432), -INT16_C( 26607), -INT16_C( 30294),  INT16_C( 16375),  INT16_C( 23684), -INT16_C( 32298) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751),  INT16_C( 11983),  INT16_C( 32515), -INT16_C( 20481), -INT16_C(     5),  INT16_C( 32011),
+         INT16_C( 16448),  INT16_C(    70),  INT16_C( 18432),  INT16_C( 15497), -INT16_C( 30294),  INT16_C(  4355), -INT16_C( 26619), -INT16_C( 32298) } },
+    { {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C( 12357),  INT16_C(   129), -INT16_C( 24032), -INT16_C(  2466),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C( 14319),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      UINT16_C( 2192),
+      { -INT16_C( 24923),  INT16_C( 16094),  INT16_C(  8480),  INT16_C(  5630), -INT16_C( 17392),  INT16_C( 11571), -INT16_C(   145), -INT16_C(  5121),
+        -INT16_C( 14179),  INT16_C(  4160), -INT16_C( 17378),       INT16_MIN, -INT16_C( 14511), -INT16_C(  4932),  INT16_C( 12363),  INT16_C( 24198) },
+      {  INT16_C(     0), -INT16_C(  7944),  INT16_C( 21064),  INT16_C( 22110),  INT16_C( 12464), -INT16_C( 16643),  INT16_C( 24605),  INT16_C(  6995),
+         INT16_C(  8192), -INT16_C( 18015),  INT16_C(    38),  INT16_C( 18088),  INT16_C(  4863), -INT16_C(   521), -INT16_C( 12803), -INT16_C(     1) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C( 17392),  INT16_C(   129), -INT16_C( 24032), -INT16_C(  5121),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),       INT16_MIN,  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C( 32250),  INT16_C(   129), -INT16_C( 24032),  INT16_C( 32739),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C(     8),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954),  INT16_C(  6232),  INT16_C(   129), -INT16_C( 24032), -INT16_C( 29271),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C(  9044),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C(  8063),  INT16_C(   129), -INT16_C( 24032),  INT16_C( 24568),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C(     2),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) } },
+    { { -INT16_C( 24319),  INT16_C( 16622),  INT16_C( 23854),  INT16_C(    64),  INT16_C(  8256), -INT16_C( 26189),  INT16_C(  8193),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275), -INT16_C(     1),  INT16_C( 25622) },
+      UINT16_C(49228),
+      {  INT16_C(    64), -INT16_C(     1),  INT16_C( 26342),  INT16_C( 15664), -INT16_C(    10), -INT16_C(  1026),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 18117), -INT16_C(    10),  INT16_C( 14034),  INT16_C(  4958),  INT16_C( 24983), -INT16_C(    33), -INT16_C( 26503),  INT16_C( 14992) },
+      {  INT16_C( 12288), -INT16_C( 23597), -INT16_C(  8201),  INT16_C( 25819),  INT16_C( 16386), -INT16_C( 27099), -INT16_C( 15285), -INT16_C(     9),
+        -INT16_C(  5145),  INT16_C( 12352),  INT16_C( 13769),  INT16_C(     0),  INT16_C(   566),  INT16_C(  1028),  INT16_C(     0), -INT16_C( 16401) },
+      { -INT16_C( 24319),  INT16_C( 16622),  INT16_C( 26342),  INT16_C( 15664),  INT16_C(  8256), -INT16_C( 26189),  INT16_C(     0),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275), -INT16_C( 26503),  INT16_C( 14992) },
+      { -INT16_C( 24319),  INT16_C( 16622), -INT16_C(  8997), -INT16_C( 23028),  INT16_C(  8256), -INT16_C( 26189),  INT16_C(    24),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275),  INT16_C(  3872),  INT16_C( 21015) },
+      { -INT16_C( 24319),  INT16_C( 16622),  INT16_C( 28667),  INT16_C( 12909),  INT16_C(  8256), -INT16_C( 26189),  INT16_C( 25125),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275),       INT16_MIN,  INT16_C( 24567) },
+      { -INT16_C( 24319),  INT16_C( 16622),  INT16_C( 14134), -INT16_C(  5757),  INT16_C(  8256), -INT16_C( 26189),  INT16_C(     6),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275), -INT16_C( 15416), -INT16_C( 11131) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_mask_shldi_epi16(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x16(r0, simde_x_mm256_loadu_epi16(test_vec[i].r0));
+    simde__m256i r5 = simde_mm256_mask_shldi_epi16(src, test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x16(r5, simde_x_mm256_loadu_epi16(test_vec[i].r5));
+    simde__m256i r15 = simde_mm256_mask_shldi_epi16(src, test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x16(r15, simde_x_mm256_loadu_epi16(test_vec[i].r15));
+    simde__m256i r19 = simde_mm256_mask_shldi_epi16(src, test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x16(r19, simde_x_mm256_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r0[16];
+    const int16_t r5[16];
+    const int16_t r15[16];
+    const int16_t r19[16];
+  } test_vec[] = {
+    { UINT16_C(11330),
+      { -INT16_C( 22555), -INT16_C(  2305), -INT16_C( 26281), -INT16_C(     1), -INT16_C( 29761),  INT16_C(  2048),  INT16_C(  5852),  INT16_C(  4589),
+         INT16_C(     2),  INT16_C(     0), -INT16_C( 12845),  INT16_C( 18011),  INT16_C(  1064), -INT16_C( 28849), -INT16_C(  4097),  INT16_C( 32015) },
+      {  INT16_C( 15141), -INT16_C(  2777), -INT16_C( 29174),  INT16_C(  4114),  INT16_C( 17602),  INT16_C( 32759),  INT16_C(  1025), -INT16_C(  2113),
+        -INT16_C( 23550), -INT16_C( 23808),  INT16_C(  6144),  INT16_C( 11723),  INT16_C(     0), -INT16_C( 30283), -INT16_C(  6663), -INT16_C(     2) },
+      {  INT16_C(     0), -INT16_C(  2305),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5852),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 12845),  INT16_C( 18011),  INT16_C(     0), -INT16_C( 28849),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  8194),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  9344),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 17821), -INT16_C( 13467),  INT16_C(     0), -INT16_C(  5647),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  1389),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   512),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 29696), -INT16_C( 26907),  INT16_C(     0), -INT16_C( 15142),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C( 18433),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18720),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 28312),  INT16_C( 13017),  INT16_C(     0),  INT16_C( 31356),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(61319),
+      {  INT16_C( 28671), -INT16_C(  6191),  INT16_C( 11685),  INT16_C( 26213),  INT16_C( 28752),  INT16_C( 21528),  INT16_C(   593),  INT16_C( 10400),
+        -INT16_C( 16602),  INT16_C( 32511), -INT16_C( 31717),  INT16_C( 24247),  INT16_C( 16386),  INT16_C( 13709),  INT16_C(  2096),  INT16_C( 16416) },
+      { -INT16_C(     1), -INT16_C(  1029), -INT16_C( 29542), -INT16_C(    97), -INT16_C( 24874), -INT16_C(  3092), -INT16_C(  1025), -INT16_C(  9058),
+         INT16_C( 24580), -INT16_C(  3163),  INT16_C( 25355),  INT16_C(  2056), -INT16_C(     1), -INT16_C(  1614),  INT16_C( 28740), -INT16_C(  1029) },
+      {  INT16_C( 28671), -INT16_C(  6191),  INT16_C( 11685),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10400),
+        -INT16_C( 16602),  INT16_C( 32511), -INT16_C( 31717),  INT16_C( 24247),  INT16_C(     0),  INT16_C( 13709),  INT16_C(  2096),  INT16_C( 16416) },
+      { -INT16_C(     1), -INT16_C(  1473), -INT16_C( 19279),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5147),
+        -INT16_C(  6964), -INT16_C(  8194), -INT16_C( 31892), -INT16_C( 10527),  INT16_C(     0), -INT16_C( 20033),  INT16_C(  1550),  INT16_C(  1055) },
+      { -INT16_C(     1), -INT16_C(   515), -INT16_C( 14771),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28239),
+         INT16_C( 12290), -INT16_C(  1582), -INT16_C( 20091), -INT16_C( 31740),  INT16_C(     0), -INT16_C(   807),  INT16_C( 14370),  INT16_C( 32253) },
+      {       INT16_MAX,  INT16_C( 16015),  INT16_C( 27948),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17670),
+        -INT16_C(  1741), -INT16_C(  2049),  INT16_C(  8411), -INT16_C(  2632),  INT16_C(     0), -INT16_C( 21393),  INT16_C( 16771),  INT16_C(   263) } },
+    { UINT16_C(14153),
+      { -INT16_C(     1),  INT16_C( 16722), -INT16_C( 20424),  INT16_C( 11152),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2113), -INT16_C(  2065),
+        -INT16_C(     9), -INT16_C( 25836),  INT16_C(    32), -INT16_C(   259),  INT16_C( 15920),  INT16_C(    82), -INT16_C( 24577),  INT16_C( 31743) },
+      {  INT16_C( 22834), -INT16_C( 20643),  INT16_C(  4616),  INT16_C(  2340),  INT16_C(  8028), -INT16_C( 28668), -INT16_C( 31051), -INT16_C(  2563),
+         INT16_C(  6435),  INT16_C( 10774),  INT16_C( 17887), -INT16_C( 26026), -INT16_C( 16395),  INT16_C( 14454),  INT16_C(     2),  INT16_C( 18894) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11152),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2113),  INT16_C(     0),
+        -INT16_C(     9), -INT16_C( 25836),  INT16_C(    32),  INT16_C(     0),  INT16_C( 15920),  INT16_C(    82),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(    21),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29185),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2064),  INT16_C(     0),
+        -INT16_C(   285),  INT16_C( 25221),  INT16_C(  1032),  INT16_C(     0), -INT16_C( 14825),  INT16_C(  2631),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C( 21351),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1170),  INT16_C(     0),  INT16_C(     0), -INT16_C( 15526),  INT16_C(     0),
+        -INT16_C( 29551),  INT16_C(  5387),  INT16_C(  8943),  INT16_C(     0),  INT16_C( 24570),  INT16_C(  7227),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C( 23680),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16900),  INT16_C(     0),
+        -INT16_C(    72), -INT16_C( 10079),  INT16_C(   258),  INT16_C(     0), -INT16_C(  3707),  INT16_C(   657),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 4470),
+      { -INT16_C(  9249), -INT16_C(  9703),  INT16_C(  8208), -INT16_C( 23583), -INT16_C(  1105),  INT16_C(     0), -INT16_C(     3),  INT16_C(    16),
+         INT16_C( 31781),  INT16_C(  7047), -INT16_C(     3),  INT16_C( 32765),  INT16_C(  3145), -INT16_C(  1035),  INT16_C( 19427), -INT16_C(  8195) },
+      { -INT16_C(  2466), -INT16_C( 26650), -INT16_C( 27264), -INT16_C(  6156), -INT16_C(     9), -INT16_C( 29786), -INT16_C( 10991), -INT16_C(  8225),
+        -INT16_C(    19),  INT16_C(    32), -INT16_C( 10297),  INT16_C( 14894),  INT16_C(   200), -INT16_C( 19538), -INT16_C(   513),  INT16_C( 11912) },
+      {  INT16_C(     0), -INT16_C(  9703),  INT16_C(  8208),  INT16_C(     0), -INT16_C(  1105),  INT16_C(     0), -INT16_C(     3),  INT16_C(     0),
+         INT16_C( 31781),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3145),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 17202),  INT16_C(   530),  INT16_C(     0),  INT16_C( 30207),  INT16_C(    17), -INT16_C(    70),  INT16_C(     0),
+        -INT16_C( 31553),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 30432),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C( 13325),  INT16_C( 19136),  INT16_C(     0), -INT16_C(     5),  INT16_C( 17875), -INT16_C(  5496),  INT16_C(     0),
+        -INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32668),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C( 12084),  INT16_C(   132),  INT16_C(     0), -INT16_C(  8833),  INT16_C(     4), -INT16_C(    18),  INT16_C(     0),
+        -INT16_C(  7889),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25160),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_maskz_shldi_epi16(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x16(r0, simde_x_mm256_loadu_epi16(test_vec[i].r0));
+    simde__m256i r5 = simde_mm256_maskz_shldi_epi16(test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x16(r5, simde_x_mm256_loadu_epi16(test_vec[i].r5));
+    simde__m256i r15 = simde_mm256_maskz_shldi_epi16(test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x16(r15, simde_x_mm256_loadu_epi16(test_vec[i].r15));
+    simde__m256i r19 = simde_mm256_maskz_shldi_epi16(test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x16(r19, simde_x_mm256_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r7[8];
+    const int32_t r31[8];
+    const int32_t r40[8];
+  } test_vec[] = {
+    { {  INT32_C(   268570624), -INT32_C(   899718866),  INT32_C(   734298387),  INT32_C(  1948499854),  INT32_C(   100925508), -INT32_C(   277021761), -INT32_C(  1765225695),  INT32_C(           1) },
+      { -INT32_C(    12713985), -INT32_C(        2373), -INT32_C(   382494999), -INT32_C(   798665420),  INT32_C(    42467328),  INT32_C(  1216348416),  INT32_C(    69218310),  INT32_C(    25724928) },
+      {  INT32_C(   268570624), -INT32_C(   899718866),  INT32_C(   734298387),  INT32_C(  1948499854),  INT32_C(   100925508), -INT32_C(   277021761), -INT32_C(  1765225695),  INT32_C(           1) },
+      {  INT32_C(    17301631),  INT32_C(   800102271), -INT32_C(   499086860),  INT32_C(   299878248),  INT32_C(    33563137), -INT32_C(  1099047004),  INT32_C(  1684377730),  INT32_C(         128) },
+      {  INT32_C(  2141126655),  INT32_C(  2147482461), -INT32_C(   191247500),  INT32_C(  1748150938),  INT32_C(    21233664), -INT32_C(  1539309440), -INT32_C(  2112874493), -INT32_C(  2134621184) },
+      {  INT32_C(    34603263),  INT32_C(  1600204543), -INT32_C(   998173719),  INT32_C(   599756496),  INT32_C(    67126274),  INT32_C(  2096873288), -INT32_C(   926211836),  INT32_C(         257) } },
+    { {  INT32_C(  1895933211),  INT32_C(  1003127846), -INT32_C(        2441), -INT32_C(   678787337),  INT32_C(  1508715627),  INT32_C(   277892708), -INT32_C(   268697603),  INT32_C(    94403824) },
+      { -INT32_C(    16778250), -INT32_C(   786942831),  INT32_C(  2146435005),  INT32_C(   219127688),  INT32_C(  1073811520), -INT32_C(     1048737),  INT32_C(     3145816),  INT32_C(   621367869) },
+      {  INT32_C(  1895933211),  INT32_C(  1003127846), -INT32_C(        2441), -INT32_C(   678787337),  INT32_C(  1508715627),  INT32_C(   277892708), -INT32_C(   268697603),  INT32_C(    94403824) },
+      { -INT32_C(  2133684737), -INT32_C(   448654488), -INT32_C(      312385), -INT32_C(   985433210), -INT32_C(   157928032),  INT32_C(  1210528383), -INT32_C(    33554816), -INT32_C(   801212398) },
+      { -INT32_C(     8389125),  INT32_C(  1754012232), -INT32_C(  1074266146), -INT32_C(  2037919804), -INT32_C(  1610577888),  INT32_C(  2146959279), -INT32_C(  2145910740),  INT32_C(   310683934) },
+      {  INT32_C(    27597822), -INT32_C(   897308975), -INT32_C(      624769), -INT32_C(  1970866419), -INT32_C(   315856064), -INT32_C(  1873910529), -INT32_C(    67109632), -INT32_C(  1602424795) } },
+    { {  INT32_C(  1285605047),  INT32_C(  1490812158),  INT32_C(  2147479551),  INT32_C(   680540910), -INT32_C(    33554433), -INT32_C(   524084812), -INT32_C(  2089314647),  INT32_C(  1349788542) },
+      { -INT32_C(  1821647010), -INT32_C(  1073741825),  INT32_C(  1064163139), -INT32_C(   184482359),  INT32_C(   805305335), -INT32_C(   285605897),  INT32_C(  1565743664),  INT32_C(     8519745) },
+      {  INT32_C(  1285605047),  INT32_C(  1490812158),  INT32_C(  2147479551),  INT32_C(   680540910), -INT32_C(    33554433), -INT32_C(   524084812), -INT32_C(  2089314647),  INT32_C(  1349788542) },
+      {  INT32_C(  1348688841),  INT32_C(  1845395295), -INT32_C(      524385),  INT32_C(  1209890682), -INT32_C(         105),  INT32_C(  1636620919), -INT32_C(  1144302418),  INT32_C(   974241536) },
+      { -INT32_C(   910823505),  INT32_C(  1610612735), -INT32_C(  1615402079),  INT32_C(  2055242468), -INT32_C(  1744830981),  INT32_C(  2004680699), -INT32_C(  1364611816),  INT32_C(     4259872) },
+      { -INT32_C(  1597589613), -INT32_C(   604176705), -INT32_C(     1048769), -INT32_C(  1875185931), -INT32_C(         209), -INT32_C(  1021725458),  INT32_C(  2006362461),  INT32_C(  1948483072) } },
+    { {  INT32_C(     5509120), -INT32_C(           3), -INT32_C(  1529807552),  INT32_C(   912114144),  INT32_C(  1878640110), -INT32_C(    16777218),  INT32_C(     2130436), -INT32_C(   277151390) },
+      { -INT32_C(   420478984), -INT32_C(  1028671948),  INT32_C(  1412861922),  INT32_C(  1446239711), -INT32_C(   718259057),  INT32_C(         288), -INT32_C(   867658883), -INT32_C(   804782016) },
+      {  INT32_C(     5509120), -INT32_C(           3), -INT32_C(  1529807552),  INT32_C(   912114144),  INT32_C(  1878640110), -INT32_C(    16777218),  INT32_C(     2130436), -INT32_C(   277151390) },
+      {  INT32_C(   705167475), -INT32_C(         287),  INT32_C(  1753129002),  INT32_C(   786493483), -INT32_C(    52234390),  INT32_C(  2147483392),  INT32_C(   272695910), -INT32_C(  1115639448) },
+      {  INT32_C(  1937244156), -INT32_C(   514335974),  INT32_C(   706430961),  INT32_C(   723119855),  INT32_C(  1788354119),  INT32_C(         144),  INT32_C(  1713654206),  INT32_C(  1745092640) },
+      {  INT32_C(  1410334950), -INT32_C(         574), -INT32_C(   788709292),  INT32_C(  1572986966), -INT32_C(   104468779), -INT32_C(         512),  INT32_C(   545391820),  INT32_C(  2063688400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_shldi_epi32(a, b, 0);
+    simde_test_x86_assert_equal_i32x8(r0, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    simde__m256i r7 = simde_mm256_shldi_epi32(a, b, 7);
+    simde_test_x86_assert_equal_i32x8(r7, simde_x_mm256_loadu_epi32(test_vec[i].r7));
+    simde__m256i r31 = simde_mm256_shldi_epi32(a, b, 31);
+    simde_test_x86_assert_equal_i32x8(r31, simde_x_mm256_loadu_epi32(test_vec[i].r31));
+    simde__m256i r40 = simde_mm256_shldi_epi32(a, b, 40);
+    simde_test_x86_assert_equal_i32x8(r40, simde_x_mm256_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r7[8];
+    const int32_t r31[8];
+    const int32_t r40[8];
+  } test_vec[] = {
+    { { -INT32_C(  1782519622),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904), -INT32_C(         529), -INT32_C(       66609), -INT32_C(   738202178) },
+      UINT8_C( 33),
+      {  INT32_C(  1271198904), -INT32_C(  2080357864),  INT32_C(      294952),  INT32_C(   585298098), -INT32_C(  1692209218), -INT32_C(     8531870),  INT32_C(   136315908),  INT32_C(  1956872489) },
+      {  INT32_C(  1879048063), -INT32_C(   705912433),  INT32_C(  1854181548), -INT32_C(    67141793),  INT32_C(   333902759),  INT32_C(   746071958), -INT32_C(   292400402),  INT32_C(   278921796) },
+      {  INT32_C(  1271198904),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904), -INT32_C(     8531870), -INT32_C(       66609), -INT32_C(   738202178) },
+      { -INT32_C(   495297481),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904), -INT32_C(  1092079338), -INT32_C(       66609), -INT32_C(   738202178) },
+      {  INT32_C(   939524031),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904),  INT32_C(   373035979), -INT32_C(       66609), -INT32_C(   738202178) },
+      { -INT32_C(   990594961),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904),  INT32_C(  2110808620), -INT32_C(       66609), -INT32_C(   738202178) } },
+    { {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(    67108992),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(    33587717) },
+      UINT8_C(144),
+      { -INT32_C(  1222445895),  INT32_C(   134217992),  INT32_C(  1955924954),  INT32_C(   272893184),  INT32_C(   537919536),  INT32_C(   205318655),  INT32_C(  1234853721),  INT32_C(  2147481981) },
+      { -INT32_C(  1111054798),  INT32_C(    67110928),  INT32_C(   218103936),  INT32_C(  1880752950), -INT32_C(  1877069882), -INT32_C(     8388609), -INT32_C(  1893175594), -INT32_C(   365218187) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(   537919536),  INT32_C(    67241216), -INT32_C(  2147483520),  INT32_C(  2147481981) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(   134223944),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(      213259) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(  1208948707),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(   182609094) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(   268447888),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(      426518) } },
+    { { -INT32_C(  1073742153),  INT32_C(  1074072074),  INT32_C(  1840904186),  INT32_C(  1140883589), -INT32_C(   687931905),  INT32_C(    50333696), -INT32_C(     4718898), -INT32_C(  1598112960) },
+      UINT8_C(149),
+      { -INT32_C(   829156979), -INT32_C(  1049236255), -INT32_C(    33554433),  INT32_C(   659250792), -INT32_C(  1180481826),  INT32_C(   152044896), -INT32_C(   549519617), -INT32_C(  2105921375) },
+      { -INT32_C(   147526511),  INT32_C(  1405791362),  INT32_C(  1074463232), -INT32_C(      164001),  INT32_C(    88211586),  INT32_C(   268468354), -INT32_C(     1048645),  INT32_C(     2097474) },
+      { -INT32_C(   829156979),  INT32_C(  1074072074), -INT32_C(    33554433),  INT32_C(  1140883589), -INT32_C(  1180481826),  INT32_C(    50333696), -INT32_C(     4718898), -INT32_C(  2105921375) },
+      {  INT32_C(  1242089211),  INT32_C(  1074072074), -INT32_C(          96),  INT32_C(  1140883589), -INT32_C(   777818366),  INT32_C(    50333696), -INT32_C(     4718898),  INT32_C(  1025003648) },
+      { -INT32_C(    73763256),  INT32_C(  1074072074), -INT32_C(  1610252032),  INT32_C(  1140883589),  INT32_C(    44105793),  INT32_C(    50333696), -INT32_C(     4718898), -INT32_C(  2146434911) },
+      { -INT32_C(  1810788873),  INT32_C(  1074072074), -INT32_C(         192),  INT32_C(  1140883589), -INT32_C(  1555636731),  INT32_C(    50333696), -INT32_C(     4718898),  INT32_C(  2050007296) } },
+    { {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(   135337985), -INT32_C(  1328754061), -INT32_C(   268599301),  INT32_C(     8454656),  INT32_C(   596216001), -INT32_C(  1322753730) },
+      UINT8_C(100),
+      { -INT32_C(      541313), -INT32_C(     6815873), -INT32_C(         129), -INT32_C(   308285953), -INT32_C(   751727389), -INT32_C(   344981633),  INT32_C(  2147450873),  INT32_C(   345187568) },
+      { -INT32_C(   334223233), -INT32_C(  1132677112), -INT32_C(  1844953072),  INT32_C(  1093563600),  INT32_C(       33290),  INT32_C(  1611969449), -INT32_C(   112508053),  INT32_C(   137908748) },
+      {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(         129), -INT32_C(  1328754061), -INT32_C(   268599301), -INT32_C(   344981633),  INT32_C(  2147450873), -INT32_C(  1322753730) },
+      {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(       16439), -INT32_C(  1328754061), -INT32_C(   268599301), -INT32_C(  1207976016), -INT32_C(     4195076), -INT32_C(  1322753730) },
+      {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(   922476536), -INT32_C(  1328754061), -INT32_C(   268599301), -INT32_C(  1341498924), -INT32_C(    56254027), -INT32_C(  1322753730) },
+      {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(       32878), -INT32_C(  1328754061), -INT32_C(   268599301),  INT32_C(  1879015264), -INT32_C(     8390151), -INT32_C(  1322753730) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_mask_shldi_epi32(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x8(r0, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    simde__m256i r7 = simde_mm256_mask_shldi_epi32(src, test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x8(r7, simde_x_mm256_loadu_epi32(test_vec[i].r7));
+    simde__m256i r31 = simde_mm256_mask_shldi_epi32(src, test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x8(r31, simde_x_mm256_loadu_epi32(test_vec[i].r31));
+    simde__m256i r40 = simde_mm256_mask_shldi_epi32(src, test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x8(r40, simde_x_mm256_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r7[8];
+    const int32_t r31[8];
+    const int32_t r40[8];
+  } test_vec[] = {
+    { UINT8_C(252),
+      { -INT32_C(  1313057836),  INT32_C(  1059914310),  INT32_C(  2146693055), -INT32_C(   268469266), -INT32_C(  1865548270), -INT32_C(  1808498688), -INT32_C(   277086210), -INT32_C(     2132225) },
+      { -INT32_C(  1901008451), -INT32_C(    20162376),  INT32_C(   515059995),  INT32_C(   667347689), -INT32_C(    81477175),  INT32_C(  1059986689),  INT32_C(    96534656),  INT32_C(  1587801578) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  2146693055), -INT32_C(   268469266), -INT32_C(  1865548270), -INT32_C(  1808498688), -INT32_C(   277086210), -INT32_C(     2132225) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   101195889), -INT32_C(     4327661),  INT32_C(  1727990141),  INT32_C(   440401951), -INT32_C(  1107296510), -INT32_C(   272924753) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1889953651),  INT32_C(   333673844),  INT32_C(  2106745060),  INT32_C(   529993344),  INT32_C(    48267328), -INT32_C(  1353582859) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   202391778), -INT32_C(     8655321), -INT32_C(   838987013),  INT32_C(   880803903),  INT32_C(  2080374277), -INT32_C(   545849506) } },
+    { UINT8_C(173),
+      { -INT32_C(  1438554907), -INT32_C(  1417019216),  INT32_C(  2118011235),  INT32_C(   538968098),  INT32_C(      139904),  INT32_C(  1077936128), -INT32_C(     1609729), -INT32_C(    67110153) },
+      {  INT32_C(   566069397),  INT32_C(   268468497),  INT32_C(  2092615648),  INT32_C(   421671983), -INT32_C(   487779836),  INT32_C(      295436),  INT32_C(  1609641318),  INT32_C(  1103448824) },
+      { -INT32_C(  1438554907),  INT32_C(           0),  INT32_C(  2118011235),  INT32_C(   538968098),  INT32_C(           0),  INT32_C(  1077936128),  INT32_C(           0), -INT32_C(    67110153) },
+      {  INT32_C(   548565648),  INT32_C(           0),  INT32_C(   522498494),  INT32_C(   268439820),  INT32_C(           0),  INT32_C(   536870912),  INT32_C(           0), -INT32_C(      164960) },
+      { -INT32_C(  1864448950),  INT32_C(           0), -INT32_C(  1101175824),  INT32_C(   210835991),  INT32_C(           0),  INT32_C(      147718),  INT32_C(           0), -INT32_C(  1595759236) },
+      {  INT32_C(  1097131297),  INT32_C(           0),  INT32_C(  1044996988),  INT32_C(   536879641),  INT32_C(           0),  INT32_C(  1073741824),  INT32_C(           0), -INT32_C(      329919) } },
+    { UINT8_C(148),
+      { -INT32_C(  2018462262), -INT32_C(  1603199661),  INT32_C(  1812860770), -INT32_C(   268468321),  INT32_C(  1392022815),  INT32_C(    96546868), -INT32_C(  1606409720),  INT32_C(  1074004224) },
+      {  INT32_C(   349269881),  INT32_C(  1871359770),  INT32_C(   294003424),  INT32_C(   123849797), -INT32_C(   368822496),  INT32_C(  1550809479), -INT32_C(    19005441),  INT32_C(  2147155966) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1812860770),  INT32_C(           0),  INT32_C(  1392022815),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1074004224) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   117944584),  INT32_C(           0),  INT32_C(  2085261301),  INT32_C(           0),  INT32_C(           0),  INT32_C(    33587263) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   147001712),  INT32_C(           0), -INT32_C(   184411248),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1073577983) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   235889169),  INT32_C(           0), -INT32_C(   124444694),  INT32_C(           0),  INT32_C(           0),  INT32_C(    67174527) } },
+    { UINT8_C(143),
+      {  INT32_C(   135528962), -INT32_C(     2359553),  INT32_C(   942111702),  INT32_C(  1090544400),  INT32_C(  1380978692), -INT32_C(  1925786938), -INT32_C(     8404993),  INT32_C(  2143289343) },
+      {  INT32_C(   848748396), -INT32_C(       36901), -INT32_C(  1574574866),  INT32_C(     8396800),  INT32_C(  1548306762), -INT32_C(   603979841), -INT32_C(  2025715974),  INT32_C(       67584) },
+      {  INT32_C(   135528962), -INT32_C(     2359553),  INT32_C(   942111702),  INT32_C(  1090544400),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2143289343) },
+      {  INT32_C(   167837977), -INT32_C(   302022657),  INT32_C(   331213649), -INT32_C(  2144237568),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   536871040) },
+      {  INT32_C(   424374198), -INT32_C(       18451),  INT32_C(  1360196215),  INT32_C(     4198400),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147449856) },
+      {  INT32_C(   335675954), -INT32_C(   604045313),  INT32_C(   662427298),  INT32_C(     6492160),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1073742080) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_maskz_shldi_epi32(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x8(r0, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    simde__m256i r7 = simde_mm256_maskz_shldi_epi32(test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x8(r7, simde_x_mm256_loadu_epi32(test_vec[i].r7));
+    simde__m256i r31 = simde_mm256_maskz_shldi_epi32(test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x8(r31, simde_x_mm256_loadu_epi32(test_vec[i].r31));
+    simde__m256i r40 = simde_mm256_maskz_shldi_epi32(test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x8(r40, simde_x_mm256_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r13[4];
+    const int64_t r63[4];
+    const int64_t r72[4];
+  } test_vec[] = {
+    { { -INT64_C( 1191202251763482881), -INT64_C( 6786470925570432181),  INT64_C(     562950096551968),  INT64_C( 4254509975908352403) },
+      { -INT64_C(     565151124160513), -INT64_C(  565198247774964572),  INT64_C( 6915659715602808831),  INT64_C( 4240396987166600992) },
+      { -INT64_C( 1191202251763482881), -INT64_C( 6786470925570432181),  INT64_C(     562950096551968),  INT64_C( 4254509975908352403) },
+      { -INT64_C(    1231454098948097),  INT64_C( 3716815887608151813),  INT64_C( 4611687190953724927),  INT64_C( 7046167403879884635) },
+      { -INT64_C(     282575562080257), -INT64_C(  282599123887482286),  INT64_C( 3457829857801404415), -INT64_C( 7103173543271475312) },
+      {  INT64_C( 8646872801610760191), -INT64_C( 3342614017332786184),  INT64_C(  144115224717303903),  INT64_C(  796653483674669882) } },
+    { {  INT64_C( 7615924057843053091), -INT64_C( 2314868935666696195), -INT64_C( 6406224515636135690),  INT64_C( 2306478531238559744) },
+      {  INT64_C(     178120885962756), -INT64_C( 8890096866641837038), -INT64_C(  576461854257447042),  INT64_C( 1398104897812241114) },
+      {  INT64_C( 7615924057843053091), -INT64_C( 2314868935666696195), -INT64_C( 6406224515636135690),  INT64_C( 2306478531238559744) },
+      {  INT64_C( 2761424564587356160), -INT64_C(  153413208156163948),  INT64_C( 1195657612450782975),  INT64_C( 5206196427700568684) },
+      { -INT64_C( 9223282976411794430), -INT64_C( 4445048433320918519),  INT64_C( 8935141109726052287),  INT64_C(  699052448906120557) },
+      { -INT64_C( 5678313005390880000), -INT64_C( 2310637171968574076),  INT64_C( 1766746557299357431),  INT64_C(  162693638365642771) } },
+    { {  INT64_C( 2607724923908653060),  INT64_C( 2986796905004795655),  INT64_C( 7949845194235796553), -INT64_C( 5717006941972114790) },
+      {  INT64_C( 1163056942654988288),  INT64_C( 5764607688394801154), -INT64_C( 8791398515143237785), -INT64_C( 8234114922187106667) },
+      {  INT64_C( 2607724923908653060),  INT64_C( 2986796905004795655),  INT64_C( 7949845194235796553), -INT64_C( 5717006941972114790) },
+      {  INT64_C( 1152939304025096708),  INT64_C( 7457604060420565504),  INT64_C( 8125250984928161983),  INT64_C( 2562334512987197879) },
+      {  INT64_C(  581528471327494144), -INT64_C( 6341068192657375231), -INT64_C( 4395699257571618893),  INT64_C( 5106314575761222474) },
+      {  INT64_C( 3494793867071325200),  INT64_C( 8303500659136071504),  INT64_C( 6018521616313239941), -INT64_C( 6260995321806808435) } },
+    { {  INT64_C(           403718336), -INT64_C(  627211623907735014), -INT64_C( 2306423551495766210),  INT64_C(  180179169736459264) },
+      { -INT64_C( 4864675646214082012),  INT64_C( 2305845242865157632), -INT64_C( 3729861554173963036), -INT64_C(    9288674416003073) },
+      {  INT64_C(           403718336), -INT64_C(  627211623907735014), -INT64_C( 2306423551495766210),  INT64_C(  180179169736459264) },
+      {  INT64_C(       3307260614543),  INT64_C( 8523973512799667200), -INT64_C( 4755802374735931001),  INT64_C(  288232584310169595) },
+      {  INT64_C( 6791034213747734802),  INT64_C( 1152922621432578816),  INT64_C( 7358441259767794290),  INT64_C( 9218727699646774271) },
+      {  INT64_C(        103351894204),  INT64_C( 5454520943005800992), -INT64_C(  148618824210497844), -INT64_C( 9214364768595083009) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_shldi_epi64(a, b, 0);
+    simde_test_x86_assert_equal_i64x4(r0, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    simde__m256i r13 = simde_mm256_shldi_epi64(a, b, 13);
+    simde_test_x86_assert_equal_i64x4(r13, simde_x_mm256_loadu_epi64(test_vec[i].r13));
+    simde__m256i r63 = simde_mm256_shldi_epi64(a, b, 63);
+    simde_test_x86_assert_equal_i64x4(r63, simde_x_mm256_loadu_epi64(test_vec[i].r63));
+    simde__m256i r72 = simde_mm256_shldi_epi64(a, b, 72);
+    simde_test_x86_assert_equal_i64x4(r72, simde_x_mm256_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r13[4];
+    const int64_t r63[4];
+    const int64_t r72[4];
+  } test_vec[] = {
+    { { -INT64_C(  577586656505241761),  INT64_C(      17592186095624),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      UINT8_C( 50),
+      {  INT64_C( 6802166866758825848),  INT64_C(    2251800417673224), -INT64_C(  532029946139992942), -INT64_C( 2328413784177117185) },
+      { -INT64_C(       2235530478081), -INT64_C( 1928298978791082357), -INT64_C( 5217623599133422360),  INT64_C( 9115285611396202495) },
+      { -INT64_C(  577586656505241761),  INT64_C(    2251800417673224),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      { -INT64_C(  577586656505241761),  INT64_C(       4947869506727),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      { -INT64_C(  577586656505241761),  INT64_C( 8259222547459234629),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      { -INT64_C(  577586656505241761),  INT64_C(  576460906924345573),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) } },
+    { { -INT64_C(  146542931224822289), -INT64_C(    6755675394802179),  INT64_C(   27373441485635586),  INT64_C(   74382099213320704) },
+      UINT8_C(142),
+      {  INT64_C( 3580328184038876959),  INT64_C(      70507274698802), -INT64_C( 2333698531825648557),  INT64_C(         34376523824) },
+      {  INT64_C( 1820852210462333115),  INT64_C( 2305843576956780548), -INT64_C( 1152922639551955217),  INT64_C(  144576982961619456) },
+      { -INT64_C(  146542931224822289),  INT64_C(      70507274698802), -INT64_C( 2333698531825648557),  INT64_C(         34376523824) },
+      { -INT64_C(  146542931224822289),  INT64_C(  577595594332587008), -INT64_C( 6831512352617497089),  INT64_C(     281612483166272) },
+      { -INT64_C(  146542931224822289),  INT64_C( 1152921788478390274), -INT64_C(  576461319775977609),  INT64_C(   72288491480809728) },
+      { -INT64_C(  146542931224822289),  INT64_C(   18049862322893344), -INT64_C( 7131013788660378641),  INT64_C(       8800390098946) } },
+    { { -INT64_C( 4611694848880754694),  INT64_C(  144405495793779281),  INT64_C( 1459167449923487777),  INT64_C(   11259566038712320) },
+      UINT8_C(246),
+      { -INT64_C( 5960865195646975049),  INT64_C( 1601650135021647830), -INT64_C( 3220515625236109675), -INT64_C(  326955223107568972) },
+      { -INT64_C( 3298985714138523973),  INT64_C( 3457211049754522907), -INT64_C( 4744875963865567889),  INT64_C(   40552462733541392) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 1601650135021647830), -INT64_C( 3220515625236109675),  INT64_C(   11259566038712320) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 5082869689847825919), -INT64_C( 3619976529551640636),  INT64_C(   11259566038712320) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 1728605524877261453), -INT64_C( 2372437981932783945),  INT64_C(   11259566038712320) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 4194064943931708975),  INT64_C( 5651483256485746110),  INT64_C(   11259566038712320) } },
+    { {  INT64_C(        549890295808), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697), -INT64_C(    2429920697384961) },
+      UINT8_C(249),
+      { -INT64_C( 6341229782155176247),  INT64_C( 5794376010860606804),  INT64_C( 4684306584583536648),  INT64_C( 4611703649268204688) },
+      {  INT64_C(  702930448027518617),  INT64_C( 2342469940558170114), -INT64_C( 1152924150843572482), -INT64_C( 1162509383440039957) },
+      { -INT64_C( 6341229782155176247), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697),  INT64_C( 4611703649268204688) },
+      { -INT64_C( 1323063849106464456), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697),  INT64_C(  144431847971102203) },
+      { -INT64_C( 8871906812841016500), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697),  INT64_C( 8642117345134755829) },
+      { -INT64_C(   41345745284577015), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697),  INT64_C(    4513495249096943) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_mask_shldi_epi64(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x4(r0, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    simde__m256i r13 = simde_mm256_mask_shldi_epi64(src, test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x4(r13, simde_x_mm256_loadu_epi64(test_vec[i].r13));
+    simde__m256i r63 = simde_mm256_mask_shldi_epi64(src, test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x4(r63, simde_x_mm256_loadu_epi64(test_vec[i].r63));
+    simde__m256i r72 = simde_mm256_mask_shldi_epi64(src, test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x4(r72, simde_x_mm256_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r13[4];
+    const int64_t r63[4];
+    const int64_t r72[4];
+  } test_vec[] = {
+    { UINT8_C(109),
+      { -INT64_C( 1152930300699870213),  INT64_C( 5911488862909851648), -INT64_C(  144132782409654820),  INT64_C(    4785074612551680) },
+      {  INT64_C(    2392537436389384), -INT64_C( 4611545280939032512),  INT64_C( 7918036055947611470),  INT64_C( 2998485984211388608) },
+      { -INT64_C( 1152930300699870213),  INT64_C(                   0), -INT64_C(  144132782409654820),  INT64_C(    4785074612551680) },
+      { -INT64_C(   72057594046357503),  INT64_C(                   0), -INT64_C(  144132782480978500),  INT64_C( 2305843078604260659) },
+      { -INT64_C( 9222175768136581116),  INT64_C(                   0),  INT64_C( 3959018027973805735),  INT64_C( 1499242992105694304) },
+      { -INT64_C(    2251799813948672),  INT64_C(                   0), -INT64_C(    4504149452530579),  INT64_C( 1224979100813230121) } },
+    { UINT8_C(176),
+      { -INT64_C( 7497593570338417616), -INT64_C( 8916530182246039723), -INT64_C( 2621472276664129082),  INT64_C( 9184930842604953595) },
+      {  INT64_C( 7054747599431170908), -INT64_C( 9223372035204316088), -INT64_C(       8797234921985),  INT64_C(  502694388514254594) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      { -INT64_C( 1155499864071798785), -INT64_C(   72066390198075403), -INT64_C( 9155347516735810585), -INT64_C( 4611695984094874369) },
+      {  INT64_C( 8580201891933739429), -INT64_C( 2016767099614716435), -INT64_C( 9150883434187456189),  INT64_C(        275954794688) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C( 9223319259355021271),  INT64_C(      72791105863685),  INT64_C( 6785739166987340462),  INT64_C(        276807286784) },
+      {  INT64_C( 2291052450433992566),  INT64_C( 5076167915189276587), -INT64_C( 8214486344401219476),  INT64_C(  144115739979153472) },
+      {  INT64_C(                   0),  INT64_C(      72791105863685),  INT64_C(                   0),  INT64_C(        276807286784) },
+      {  INT64_C(                   0),  INT64_C(  596304739235309774),  INT64_C(                   0),  INT64_C(    2267605293334592) },
+      {  INT64_C(                   0), -INT64_C( 6685288079260137515),  INT64_C(                   0),  INT64_C(   72057869989576736) },
+      {  INT64_C(                   0),  INT64_C(   18634523101103430),  INT64_C(                   0),  INT64_C(      70862665416706) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_maskz_shldi_epi64(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x4(r0, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    simde__m256i r13 = simde_mm256_maskz_shldi_epi64(test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x4(r13, simde_x_mm256_loadu_epi64(test_vec[i].r13));
+    simde__m256i r63 = simde_mm256_maskz_shldi_epi64(test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x4(r63, simde_x_mm256_loadu_epi64(test_vec[i].r63));
+    simde__m256i r72 = simde_mm256_maskz_shldi_epi64(test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x4(r72, simde_x_mm256_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r0[32];
+    const int16_t r5[32];
+    const int16_t r15[32];
+    const int16_t r19[32];
+  } test_vec[] = {
+    { {  INT16_C( 27845),  INT16_C( 30522),  INT16_C( 25605),  INT16_C(  4147), -INT16_C( 26713),  INT16_C(     2),  INT16_C(  1088), -INT16_C( 24286),
+        -INT16_C( 12062),  INT16_C(    66), -INT16_C(  7168),  INT16_C( 14814), -INT16_C( 32764), -INT16_C( 23344), -INT16_C(    97),  INT16_C(  4096),
+         INT16_C( 30379), -INT16_C(  6145), -INT16_C( 17441), -INT16_C( 32220), -INT16_C(  7447), -INT16_C(  1185),  INT16_C(   258), -INT16_C(  8259),
+         INT16_C(     0),  INT16_C( 22501), -INT16_C(   129),  INT16_C(   256),  INT16_C( 18894), -INT16_C(   114), -INT16_C( 26839),  INT16_C(     4) },
+      {       INT16_MIN,  INT16_C(     1), -INT16_C(  8297), -INT16_C(  4097),  INT16_C(  4128),  INT16_C( 25418), -INT16_C( 16378),  INT16_C(     0),
+         INT16_C(   130), -INT16_C( 10480), -INT16_C( 19337), -INT16_C( 13323), -INT16_C( 32248),  INT16_C( 11718), -INT16_C(  1025), -INT16_C(    37),
+         INT16_C(    33), -INT16_C(  4097), -INT16_C( 28018),  INT16_C(  4481), -INT16_C(  2049),  INT16_C(  1188), -INT16_C(  2451),  INT16_C( 14204),
+         INT16_C( 22561), -INT16_C(  5122), -INT16_C(  4355), -INT16_C(   130),  INT16_C( 22442), -INT16_C( 31048), -INT16_C(  8258),  INT16_C( 14654) },
+      {  INT16_C( 27845),  INT16_C( 30522),  INT16_C( 25605),  INT16_C(  4147), -INT16_C( 26713),  INT16_C(     2),  INT16_C(  1088), -INT16_C( 24286),
+        -INT16_C( 12062),  INT16_C(    66), -INT16_C(  7168),  INT16_C( 14814), -INT16_C( 32764), -INT16_C( 23344), -INT16_C(    97),  INT16_C(  4096),
+         INT16_C( 30379), -INT16_C(  6145), -INT16_C( 17441), -INT16_C( 32220), -INT16_C(  7447), -INT16_C(  1185),  INT16_C(   258), -INT16_C(  8259),
+         INT16_C(     0),  INT16_C( 22501), -INT16_C(   129),  INT16_C(   256),  INT16_C( 18894), -INT16_C(   114), -INT16_C( 26839),  INT16_C(     4) },
+      { -INT16_C( 26448), -INT16_C(  6336), -INT16_C( 32581),  INT16_C(  1661), -INT16_C(  2846),  INT16_C(    76), -INT16_C( 30696),  INT16_C(  9280),
+         INT16_C(  7232),  INT16_C(  2138), -INT16_C( 32746),  INT16_C( 15321),  INT16_C(   144), -INT16_C( 26107), -INT16_C(  3073),  INT16_C(    31),
+        -INT16_C( 10912), -INT16_C(     3),  INT16_C( 31730),  INT16_C( 17538),  INT16_C( 23870),  INT16_C( 27616),  INT16_C(  8286), -INT16_C(  2138),
+         INT16_C(    11), -INT16_C(   835), -INT16_C(  4099),  INT16_C(  8223),  INT16_C( 14794), -INT16_C(  3632), -INT16_C(  6853),  INT16_C(   135) },
+      { -INT16_C( 16384),  INT16_C(     0), -INT16_C(  4149), -INT16_C(  2049), -INT16_C( 30704),  INT16_C( 12709),  INT16_C( 24579),  INT16_C(     0),
+         INT16_C(    65),  INT16_C( 27528),  INT16_C( 23099),  INT16_C( 26106),  INT16_C( 16644),  INT16_C(  5859), -INT16_C(   513),  INT16_C( 32749),
+        -INT16_C( 32752), -INT16_C(  2049), -INT16_C( 14009),  INT16_C(  2240), -INT16_C(  1025), -INT16_C( 32174),  INT16_C( 31542), -INT16_C( 25666),
+         INT16_C( 11280), -INT16_C(  2561), -INT16_C(  2178),  INT16_C( 32703),  INT16_C( 11221),  INT16_C( 17244), -INT16_C(  4129),  INT16_C(  7327) },
+      {  INT16_C( 26156), -INT16_C( 17968),  INT16_C(  8238), -INT16_C( 32353), -INT16_C( 17096),  INT16_C(    19),  INT16_C(  8710),  INT16_C(  2320),
+        -INT16_C( 30960),  INT16_C(   534),  INT16_C(  8197), -INT16_C( 12554),  INT16_C(    36),  INT16_C(  9857), -INT16_C(   769), -INT16_C( 32761),
+        -INT16_C( 19112),  INT16_C( 16383), -INT16_C(  8452),  INT16_C(  4384),  INT16_C(  5967), -INT16_C(  9480),  INT16_C(  2071), -INT16_C(   535),
+         INT16_C(     2), -INT16_C( 16593), -INT16_C(  1025),  INT16_C(  2055),  INT16_C( 20082), -INT16_C(   908), -INT16_C( 18098),  INT16_C(    33) } },
+    { { -INT16_C(   257),  INT16_C(     1),  INT16_C( 29841),  INT16_C(   256), -INT16_C( 20985),  INT16_C( 16396), -INT16_C( 32736), -INT16_C( 32736),
+         INT16_C( 23277), -INT16_C(  6831), -INT16_C( 13938),  INT16_C( 26611), -INT16_C( 22032), -INT16_C(  9217),  INT16_C( 30460),  INT16_C(  9347),
+        -INT16_C(     1), -INT16_C(  1185), -INT16_C(  5150),  INT16_C(     4), -INT16_C(  8195),  INT16_C( 15605),  INT16_C( 10568),  INT16_C( 22506),
+        -INT16_C( 29696),  INT16_C( 30036),  INT16_C( 12681), -INT16_C(     1), -INT16_C(  5560), -INT16_C(     2), -INT16_C(    65), -INT16_C( 16449) },
+      {  INT16_C(  3581), -INT16_C(    66), -INT16_C( 10248),  INT16_C(   201),       INT16_MIN, -INT16_C(     1), -INT16_C( 18611),  INT16_C( 24854),
+         INT16_C(  1304), -INT16_C( 19025), -INT16_C( 20818), -INT16_C(    43), -INT16_C( 14328),  INT16_C(  6755),  INT16_C( 26771),  INT16_C(   392),
+         INT16_C( 20168),  INT16_C(   264), -INT16_C(  8193),  INT16_C( 32681),  INT16_C(  5919),  INT16_C( 17472), -INT16_C(  9219),  INT16_C( 26954),
+        -INT16_C(  9793), -INT16_C( 20273),  INT16_C(    12), -INT16_C(  6374), -INT16_C( 28118),  INT16_C( 13115),  INT16_C( 23799), -INT16_C( 19516) },
+      { -INT16_C(   257),  INT16_C(     1),  INT16_C( 29841),  INT16_C(   256), -INT16_C( 20985),  INT16_C( 16396), -INT16_C( 32736), -INT16_C( 32736),
+         INT16_C( 23277), -INT16_C(  6831), -INT16_C( 13938),  INT16_C( 26611), -INT16_C( 22032), -INT16_C(  9217),  INT16_C( 30460),  INT16_C(  9347),
+        -INT16_C(     1), -INT16_C(  1185), -INT16_C(  5150),  INT16_C(     4), -INT16_C(  8195),  INT16_C( 15605),  INT16_C( 10568),  INT16_C( 22506),
+        -INT16_C( 29696),  INT16_C( 30036),  INT16_C( 12681), -INT16_C(     1), -INT16_C(  5560), -INT16_C(     2), -INT16_C(    65), -INT16_C( 16449) },
+      { -INT16_C(  8223),  INT16_C(    63), -INT16_C( 28102),  INT16_C(  8192), -INT16_C( 16144),  INT16_C(   415),  INT16_C(  1046),  INT16_C(  1036),
+         INT16_C( 23968), -INT16_C( 21962),  INT16_C( 12757), -INT16_C(   385),  INT16_C( 15897),  INT16_C( 32739), -INT16_C(  8307), -INT16_C( 28576),
+        -INT16_C(    23),  INT16_C( 27616),  INT16_C( 31835),  INT16_C(   143), -INT16_C(    94), -INT16_C( 24920),  INT16_C( 10523), -INT16_C(   691),
+        -INT16_C( 32741), -INT16_C( 21866),  INT16_C( 12576), -INT16_C(     4),  INT16_C( 18706), -INT16_C(    58), -INT16_C(  2069), -INT16_C(  2058) },
+      { -INT16_C( 30978), -INT16_C(    33), -INT16_C(  5124),  INT16_C(   100), -INT16_C( 16384),       INT16_MAX,  INT16_C( 23462),  INT16_C( 12427),
+        -INT16_C( 32116), -INT16_C(  9513),  INT16_C( 22359), -INT16_C(    22),  INT16_C( 25604), -INT16_C( 29391),  INT16_C( 13385), -INT16_C( 32572),
+        -INT16_C( 22684), -INT16_C( 32636),  INT16_C( 28671),  INT16_C( 16340), -INT16_C( 29809), -INT16_C( 24032),  INT16_C( 28158),  INT16_C( 13477),
+         INT16_C( 27871),  INT16_C( 22631), -INT16_C( 32762), -INT16_C(  3187),  INT16_C( 18709),  INT16_C(  6557), -INT16_C( 20869), -INT16_C(  9758) },
+      { -INT16_C(  2056),  INT16_C(    15), -INT16_C( 23410),  INT16_C(  2048),  INT16_C( 28732),  INT16_C(   103),  INT16_C(   261),  INT16_C(   259),
+        -INT16_C( 10392),  INT16_C( 10893),  INT16_C( 19573),  INT16_C( 16287),  INT16_C( 20358), -INT16_C(  8200), -INT16_C( 18461),  INT16_C(  9240),
+        -INT16_C(     6), -INT16_C(  9480),  INT16_C( 24342),  INT16_C(    35), -INT16_C(    24), -INT16_C(  6230),  INT16_C( 19014), -INT16_C( 16557),
+         INT16_C( 24582), -INT16_C( 21851), -INT16_C( 29624), -INT16_C(     1),  INT16_C( 21060), -INT16_C(    15), -INT16_C(   518), -INT16_C(   515) } },
+    { { -INT16_C(   747),  INT16_C(  4104),  INT16_C( 21531), -INT16_C( 13588), -INT16_C( 24577), -INT16_C(  5137), -INT16_C( 10739),  INT16_C(  8192),
+         INT16_C( 31197),  INT16_C( 10305),  INT16_C(  8217), -INT16_C(  4679),  INT16_C(  4104),  INT16_C(   512),  INT16_C(   256),  INT16_C( 14904),
+         INT16_C( 24817),  INT16_C(   576), -INT16_C(  9164),  INT16_C(     0),  INT16_C( 10369),  INT16_C( 12921), -INT16_C(  1059), -INT16_C(  1033),
+        -INT16_C( 21249), -INT16_C( 23698), -INT16_C(     1),  INT16_C( 12440),  INT16_C( 26201),  INT16_C( 12288), -INT16_C(  3073),  INT16_C(   516) },
+      { -INT16_C( 14904), -INT16_C( 29700),  INT16_C(  7133), -INT16_C(  8225),  INT16_C(  4163),  INT16_C( 27921),  INT16_C(   512), -INT16_C(     1),
+              INT16_MIN,  INT16_C(  4864),  INT16_C(  1024), -INT16_C( 31409), -INT16_C(    69),  INT16_C( 26460), -INT16_C(     1), -INT16_C( 10988),
+        -INT16_C(     2),  INT16_C( 23759), -INT16_C(   513), -INT16_C( 22926), -INT16_C(   275),  INT16_C( 15419), -INT16_C( 16520), -INT16_C(     1),
+         INT16_C(  1322),       INT16_MAX,  INT16_C(     0), -INT16_C(   259), -INT16_C( 23855),  INT16_C( 32723),  INT16_C(   168),  INT16_C(    66) },
+      { -INT16_C(   747),  INT16_C(  4104),  INT16_C( 21531), -INT16_C( 13588), -INT16_C( 24577), -INT16_C(  5137), -INT16_C( 10739),  INT16_C(  8192),
+         INT16_C( 31197),  INT16_C( 10305),  INT16_C(  8217), -INT16_C(  4679),  INT16_C(  4104),  INT16_C(   512),  INT16_C(   256),  INT16_C( 14904),
+         INT16_C( 24817),  INT16_C(   576), -INT16_C(  9164),  INT16_C(     0),  INT16_C( 10369),  INT16_C( 12921), -INT16_C(  1059), -INT16_C(  1033),
+        -INT16_C( 21249), -INT16_C( 23698), -INT16_C(     1),  INT16_C( 12440),  INT16_C( 26201),  INT16_C( 12288), -INT16_C(  3073),  INT16_C(   516) },
+      { -INT16_C( 23880),  INT16_C(   273), -INT16_C( 31901),  INT16_C( 23963), -INT16_C(    30),  INT16_C( 32237), -INT16_C( 15968),  INT16_C(    31),
+         INT16_C( 15280),  INT16_C(  2082),  INT16_C(   800), -INT16_C( 18640),  INT16_C(   287),  INT16_C( 16396),  INT16_C(  8223),  INT16_C( 18202),
+         INT16_C(  7743),  INT16_C( 18443), -INT16_C( 31073),  INT16_C(    20),  INT16_C(  4159),  INT16_C( 20263),  INT16_C( 31671),  INT16_C( 32511),
+        -INT16_C( 24608),  INT16_C( 28111), -INT16_C(    32),  INT16_C(  4895), -INT16_C( 13516),  INT16_C(    15),  INT16_C( 32736),  INT16_C( 16512) },
+      { -INT16_C(  7452),  INT16_C( 17918), -INT16_C( 29202),  INT16_C( 28655), -INT16_C( 30687), -INT16_C( 18808), -INT16_C( 32512),       INT16_MAX,
+        -INT16_C( 16384), -INT16_C( 30336), -INT16_C( 32256), -INT16_C( 15705),  INT16_C( 32733),  INT16_C( 13230),       INT16_MAX,  INT16_C( 27274),
+        -INT16_C(     1),  INT16_C( 11879),  INT16_C( 32511),  INT16_C( 21305), -INT16_C(   138), -INT16_C( 25059), -INT16_C(  8260), -INT16_C(     1),
+        -INT16_C( 32107),  INT16_C( 16383),       INT16_MIN,  INT16_C( 32638), -INT16_C( 11928),  INT16_C( 16361), -INT16_C( 32684),  INT16_C(    33) },
+      { -INT16_C(  5970), -INT16_C( 32700), -INT16_C( 24360),  INT16_C( 22374), -INT16_C(     8),  INT16_C( 24443), -INT16_C( 20376),  INT16_C(     7),
+        -INT16_C( 12564),  INT16_C( 16904),  INT16_C(   200),  INT16_C( 28108), -INT16_C( 32697),  INT16_C(  4099),  INT16_C(  2055), -INT16_C( 11834),
+         INT16_C(  1935),  INT16_C(  4610), -INT16_C(  7769),  INT16_C(     5),  INT16_C( 17423), -INT16_C( 27703), -INT16_C(  8467), -INT16_C(  8257),
+         INT16_C( 26616),  INT16_C(  7027), -INT16_C(     8), -INT16_C( 31545),  INT16_C( 13005), -INT16_C( 32765), -INT16_C( 24584),  INT16_C(  4128) } },
+    { { -INT16_C( 21295), -INT16_C( 25324),  INT16_C(   384), -INT16_C( 26032), -INT16_C(  2559),  INT16_C(  1026),  INT16_C(     1), -INT16_C(  2569),
+        -INT16_C( 31623), -INT16_C(  3125), -INT16_C(  8197), -INT16_C( 19850), -INT16_C( 27282),  INT16_C( 20425),  INT16_C(   128),  INT16_C( 15242),
+        -INT16_C(     1),  INT16_C(     0), -INT16_C( 23202), -INT16_C( 26944),  INT16_C(  6598), -INT16_C(  8265),  INT16_C( 32511), -INT16_C( 24029),
+        -INT16_C( 32704),  INT16_C(  8191), -INT16_C(     9),  INT16_C(   128), -INT16_C(  2051),  INT16_C(    32), -INT16_C( 19368),  INT16_C(   528) },
+      { -INT16_C( 16701),  INT16_C(   256), -INT16_C( 14061), -INT16_C( 13104), -INT16_C( 13332),       INT16_MIN,  INT16_C(   916),  INT16_C( 21790),
+        -INT16_C(   513), -INT16_C(  4479), -INT16_C( 27778),  INT16_C(  5155), -INT16_C(   257), -INT16_C( 30688),  INT16_C(  4381), -INT16_C(  1029),
+        -INT16_C( 17926),  INT16_C( 15811),  INT16_C( 17371), -INT16_C(  9383),  INT16_C( 24189), -INT16_C( 16423), -INT16_C(   566), -INT16_C( 17393),
+        -INT16_C( 16892), -INT16_C(     5),  INT16_C(  6317),  INT16_C( 16638), -INT16_C(   769), -INT16_C( 21658), -INT16_C(     1),  INT16_C( 30746) },
+      { -INT16_C( 21295), -INT16_C( 25324),  INT16_C(   384), -INT16_C( 26032), -INT16_C(  2559),  INT16_C(  1026),  INT16_C(     1), -INT16_C(  2569),
+        -INT16_C( 31623), -INT16_C(  3125), -INT16_C(  8197), -INT16_C( 19850), -INT16_C( 27282),  INT16_C( 20425),  INT16_C(   128),  INT16_C( 15242),
+        -INT16_C(     1),  INT16_C(     0), -INT16_C( 23202), -INT16_C( 26944),  INT16_C(  6598), -INT16_C(  8265),  INT16_C( 32511), -INT16_C( 24029),
+        -INT16_C( 32704),  INT16_C(  8191), -INT16_C(     9),  INT16_C(   128), -INT16_C(  2051),  INT16_C(    32), -INT16_C( 19368),  INT16_C(   528) },
+      { -INT16_C( 26057), -INT16_C( 23936),  INT16_C( 12313),  INT16_C( 18969), -INT16_C( 16327), -INT16_C( 32688),  INT16_C(    32), -INT16_C( 16662),
+        -INT16_C( 28865),  INT16_C( 31101), -INT16_C(   142),  INT16_C( 20162), -INT16_C( 21025), -INT16_C(  1743),  INT16_C(  4098),  INT16_C( 29023),
+        -INT16_C(     9),  INT16_C(     7), -INT16_C( 21560), -INT16_C( 10213),  INT16_C( 14539), -INT16_C(  2313), -INT16_C(  8193),  INT16_C( 17527),
+         INT16_C(  2071), -INT16_C(     1), -INT16_C(   285),  INT16_C(  4104), -INT16_C(    65),  INT16_C(  1045), -INT16_C( 29921),  INT16_C( 16911) },
+      { -INT16_C(  8351),  INT16_C(   128),  INT16_C( 25737),  INT16_C( 26216), -INT16_C(  6666),  INT16_C( 16384), -INT16_C( 32310), -INT16_C( 21873),
+        -INT16_C(   257), -INT16_C(  2240), -INT16_C( 13889),  INT16_C(  2577),  INT16_C( 32639), -INT16_C( 15344),  INT16_C(  2190),  INT16_C( 32253),
+        -INT16_C(  8963),  INT16_C(  7905),  INT16_C(  8685),  INT16_C( 28076),  INT16_C( 12094), -INT16_C(  8212), -INT16_C(   283), -INT16_C(  8697),
+         INT16_C( 24322), -INT16_C(     3), -INT16_C( 29610),  INT16_C(  8319), -INT16_C(   385),  INT16_C( 21939),       INT16_MAX,  INT16_C( 15373) },
+      {  INT16_C( 26253), -INT16_C(  5984),  INT16_C(  3078), -INT16_C( 11642), -INT16_C( 20466),  INT16_C(  8212),  INT16_C(     8), -INT16_C( 20550),
+         INT16_C(  9167), -INT16_C( 24993), -INT16_C(    36), -INT16_C( 27728), -INT16_C( 21641),  INT16_C( 32332),  INT16_C(  1024), -INT16_C(  9129),
+        -INT16_C(     3),  INT16_C(     1),  INT16_C( 10994), -INT16_C( 18938), -INT16_C( 12750), -INT16_C(   579), -INT16_C(  2049),  INT16_C(  4381),
+         INT16_C(   517), -INT16_C(     1), -INT16_C(    72),  INT16_C(  1026), -INT16_C( 16401),  INT16_C(   261), -INT16_C( 23865),  INT16_C(  4227) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_shldi_epi16(a, b, 0);
+    simde_test_x86_assert_equal_i16x32(r0, simde_mm512_loadu_epi16(test_vec[i].r0));
+    simde__m512i r5 = simde_mm512_shldi_epi16(a, b, 5);
+    simde_test_x86_assert_equal_i16x32(r5, simde_mm512_loadu_epi16(test_vec[i].r5));
+    simde__m512i r15 = simde_mm512_shldi_epi16(a, b, 15);
+    simde_test_x86_assert_equal_i16x32(r15, simde_mm512_loadu_epi16(test_vec[i].r15));
+    simde__m512i r19 = simde_mm512_shldi_epi16(a, b, 19);
+    simde_test_x86_assert_equal_i16x32(r19, simde_mm512_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r0[32];
+    const int16_t r5[32];
+    const int16_t r15[32];
+    const int16_t r19[32];
+  } test_vec[] = {
+    { {  INT16_C(     0), -INT16_C( 31300),  INT16_C( 24592), -INT16_C( 20480), -INT16_C(  5073), -INT16_C( 25456),  INT16_C( 32761),  INT16_C(     0),
+        -INT16_C(  8004), -INT16_C( 16385),  INT16_C( 16385), -INT16_C(  5810), -INT16_C(  4113),  INT16_C(  9220), -INT16_C( 17793), -INT16_C(  8855),
+        -INT16_C( 32704), -INT16_C( 14627),  INT16_C( 29692),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522),  INT16_C(  5105),
+        -INT16_C(    34),  INT16_C(  4100), -INT16_C( 20216), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      UINT32_C( 126282066),
+      {  INT16_C( 26066),  INT16_C(   160), -INT16_C(  7232), -INT16_C( 15980),  INT16_C( 24479), -INT16_C(  9107),  INT16_C(  4104), -INT16_C(   129),
+         INT16_C(    32), -INT16_C(     4), -INT16_C(    83),  INT16_C(    64), -INT16_C( 16385),  INT16_C(  4096), -INT16_C( 17464), -INT16_C( 28870),
+        -INT16_C( 20350),  INT16_C( 25584), -INT16_C( 10841),  INT16_C(  2212),  INT16_C(     0),  INT16_C(  1173), -INT16_C( 32178), -INT16_C( 30874),
+        -INT16_C( 18778),  INT16_C(  3136), -INT16_C(    19), -INT16_C( 25692), -INT16_C(    97), -INT16_C(  1793),  INT16_C(  2234),  INT16_C( 17390) },
+      {  INT16_C(  6618), -INT16_C( 15762), -INT16_C(   513), -INT16_C(   131), -INT16_C(  5064), -INT16_C(  8321), -INT16_C(  8193),  INT16_C( 17927),
+        -INT16_C(  7111),  INT16_C(  1066),  INT16_C(  4288),  INT16_C(   256), -INT16_C(     2), -INT16_C(    13),  INT16_C(   264),  INT16_C(  9685),
+        -INT16_C(    37),  INT16_C( 17410),  INT16_C( 31118), -INT16_C(  9764), -INT16_C(   129),  INT16_C(  8898), -INT16_C( 10132), -INT16_C(     9),
+         INT16_C( 27790),  INT16_C(  9728),  INT16_C( 16359), -INT16_C( 14905),  INT16_C(  8438), -INT16_C(  1332), -INT16_C( 30134),  INT16_C( 27639) },
+      {  INT16_C(     0),  INT16_C(   160),  INT16_C( 24592), -INT16_C( 20480),  INT16_C( 24479), -INT16_C( 25456),  INT16_C(  4104),  INT16_C(     0),
+         INT16_C(    32), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(    64), -INT16_C(  4113),  INT16_C(  4096), -INT16_C( 17464), -INT16_C( 28870),
+        -INT16_C( 32704),  INT16_C( 25584), -INT16_C( 10841),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522), -INT16_C( 30874),
+        -INT16_C( 18778),  INT16_C(  3136), -INT16_C(    19), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      {  INT16_C(     0),  INT16_C(  5144),  INT16_C( 24592), -INT16_C( 20480), -INT16_C(  3075), -INT16_C( 25456),  INT16_C(   283),  INT16_C(     0),
+         INT16_C(  1052), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(  2048), -INT16_C(  4113),  INT16_C(    31),  INT16_C( 30976), -INT16_C(  6332),
+        -INT16_C( 32704),  INT16_C( 32264), -INT16_C( 19217),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522), -INT16_C(  4897),
+        -INT16_C( 11059), -INT16_C( 30716), -INT16_C(   601), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      {  INT16_C(     0),  INT16_C( 24887),  INT16_C( 24592), -INT16_C( 20480), -INT16_C(  2532), -INT16_C( 25456),  INT16_C( 28671),  INT16_C(     0),
+         INT16_C( 29212), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(   128), -INT16_C(  4113),  INT16_C( 32761),  INT16_C(   132),  INT16_C(  4842),
+        -INT16_C( 32704),  INT16_C(  8705), -INT16_C( 17209),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522),  INT16_C( 32763),
+         INT16_C( 13895),  INT16_C(  4864), -INT16_C( 24589), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      {  INT16_C(     0),  INT16_C(  1286),  INT16_C( 24592), -INT16_C( 20480), -INT16_C(   769), -INT16_C( 25456), -INT16_C( 32698),  INT16_C(     0),
+         INT16_C(   263), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(   512), -INT16_C(  4113), -INT16_C( 32761), -INT16_C(  8640),  INT16_C( 31185),
+        -INT16_C( 32704),  INT16_C(  8066), -INT16_C( 21189),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522),  INT16_C( 15159),
+        -INT16_C( 19149),  INT16_C( 25089), -INT16_C(   151), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) } },
+    { {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128), -INT16_C( 27770),  INT16_C(    96), -INT16_C( 16481),
+         INT16_C( 28014),  INT16_C( 27854),  INT16_C( 19423), -INT16_C( 32624), -INT16_C( 10273),  INT16_C( 16384), -INT16_C( 16182),  INT16_C(  2584),
+        -INT16_C(  7558),  INT16_C( 26452),  INT16_C( 30131), -INT16_C( 27986),  INT16_C(  9624), -INT16_C( 21898), -INT16_C( 14186),  INT16_C( 22943),
+        -INT16_C( 14174),  INT16_C(  1028), -INT16_C(   513), -INT16_C( 18230), -INT16_C( 26519), -INT16_C(  4407),  INT16_C(    56),  INT16_C(  2129) },
+      UINT32_C( 626518368),
+      { -INT16_C( 29280),  INT16_C(     8),  INT16_C( 10304), -INT16_C(     1), -INT16_C(     1), -INT16_C( 11418),  INT16_C( 32639), -INT16_C(  1033),
+         INT16_C(  1025),  INT16_C(  1028), -INT16_C(   133), -INT16_C(  8875), -INT16_C(   898),  INT16_C(  8517), -INT16_C( 22785), -INT16_C( 29142),
+         INT16_C( 22854), -INT16_C( 23009), -INT16_C( 21266),  INT16_C(  8320), -INT16_C(   513), -INT16_C( 31577), -INT16_C( 28522), -INT16_C(     1),
+        -INT16_C(  4353),  INT16_C( 24845), -INT16_C( 17409),  INT16_C( 30087), -INT16_C( 24988), -INT16_C(   643),  INT16_C(    32), -INT16_C(   129) },
+      { -INT16_C( 32253),  INT16_C(  7176), -INT16_C( 31861), -INT16_C(     9), -INT16_C( 32764), -INT16_C( 20014),  INT16_C(  4194), -INT16_C(  4904),
+         INT16_C( 27599), -INT16_C(  8193),  INT16_C(  4603), -INT16_C( 28490),  INT16_C(     0),  INT16_C( 17107), -INT16_C( 30521), -INT16_C(    11),
+        -INT16_C( 12311), -INT16_C(  7181), -INT16_C(  6462),  INT16_C( 30916),  INT16_C( 28462),  INT16_C(     0),  INT16_C(  2160),  INT16_C( 29391),
+         INT16_C( 17536),  INT16_C(   136), -INT16_C(  3921), -INT16_C( 25832),  INT16_C(  3072),  INT16_C(    60),  INT16_C(  1024),  INT16_C(   532) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128), -INT16_C( 11418),  INT16_C( 32639), -INT16_C( 16481),
+         INT16_C(  1025),  INT16_C( 27854),  INT16_C( 19423), -INT16_C(  8875), -INT16_C( 10273),  INT16_C(  8517), -INT16_C( 22785), -INT16_C( 29142),
+         INT16_C( 22854), -INT16_C( 23009), -INT16_C( 21266), -INT16_C( 27986), -INT16_C(   513), -INT16_C( 21898), -INT16_C( 28522),  INT16_C( 22943),
+        -INT16_C(  4353),  INT16_C(  1028), -INT16_C( 17409), -INT16_C( 18230), -INT16_C( 26519), -INT16_C(   643),  INT16_C(    56),  INT16_C(  2129) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128),  INT16_C( 27862), -INT16_C(  4126), -INT16_C( 16481),
+        -INT16_C( 32723),  INT16_C( 27854),  INT16_C( 19423), -INT16_C( 21838), -INT16_C( 10273),  INT16_C( 10408), -INT16_C(  8207), -INT16_C( 15009),
+         INT16_C( 10457), -INT16_C( 15364), -INT16_C( 25124), -INT16_C( 27986), -INT16_C( 16403), -INT16_C( 21898),  INT16_C(  4801),  INT16_C( 22943),
+        -INT16_C(  8216),  INT16_C(  1028),  INT16_C( 32766), -INT16_C( 18230), -INT16_C( 26519), -INT16_C( 20576),  INT16_C(    56),  INT16_C(  2129) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128),  INT16_C( 22761), -INT16_C( 30671), -INT16_C( 16481),
+        -INT16_C( 18969),  INT16_C( 27854),  INT16_C( 19423), -INT16_C( 14245), -INT16_C( 10273), -INT16_C( 24215), -INT16_C( 15261),  INT16_C( 32762),
+         INT16_C( 26612), -INT16_C(  3591),  INT16_C( 29537), -INT16_C( 27986), -INT16_C( 18537), -INT16_C( 21898),  INT16_C(  1080),  INT16_C( 22943),
+        -INT16_C( 24000),  INT16_C(  1028), -INT16_C(  1961), -INT16_C( 18230), -INT16_C( 26519), -INT16_C( 32738),  INT16_C(    56),  INT16_C(  2129) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128), -INT16_C( 25803), -INT16_C(  1032), -INT16_C( 16481),
+         INT16_C(  8203),  INT16_C( 27854),  INT16_C( 19423), -INT16_C(  5460), -INT16_C( 10273),  INT16_C(  2602),  INT16_C( 14332),  INT16_C( 29015),
+        -INT16_C( 13770),  INT16_C( 12543),  INT16_C( 26487), -INT16_C( 27986), -INT16_C(  4101), -INT16_C( 21898), -INT16_C( 31568),  INT16_C( 22943),
+         INT16_C( 30714),  INT16_C(  1028), -INT16_C(  8193), -INT16_C( 18230), -INT16_C( 26519), -INT16_C(  5144),  INT16_C(    56),  INT16_C(  2129) } },
+    { {  INT16_C(   256), -INT16_C( 20406),  INT16_C(  4392), -INT16_C( 32766), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129),  INT16_C(  8264),
+         INT16_C(   513), -INT16_C( 12725),  INT16_C( 18234), -INT16_C( 20051),  INT16_C( 25821),  INT16_C( 24575),  INT16_C(   516), -INT16_C(   996),
+        -INT16_C( 20231), -INT16_C(     2),  INT16_C(  2104),  INT16_C(  2386),  INT16_C(  2542),  INT16_C( 10446), -INT16_C(     1),  INT16_C(   513),
+        -INT16_C(  8705),  INT16_C( 29406),  INT16_C( 14473), -INT16_C(     3), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     4), -INT16_C( 25567) },
+      UINT32_C(3382049935),
+      {  INT16_C( 14209),  INT16_C(  7147), -INT16_C(    65), -INT16_C( 29424),  INT16_C( 11935), -INT16_C( 16393), -INT16_C( 16401), -INT16_C(  7018),
+         INT16_C(  1263),  INT16_C( 21022), -INT16_C( 15163),  INT16_C( 23677),  INT16_C(     2), -INT16_C( 31623),  INT16_C( 12544),  INT16_C( 24571),
+        -INT16_C(  2082), -INT16_C(    81),  INT16_C( 25738),  INT16_C(     0),  INT16_C( 11423), -INT16_C( 29704), -INT16_C(  2053), -INT16_C( 28591),
+         INT16_C(   137), -INT16_C(    65),  INT16_C(     0),  INT16_C(  5364), -INT16_C(  5898),  INT16_C( 14925),  INT16_C(     0),  INT16_C(  1216) },
+      { -INT16_C(  3786),  INT16_C(   288),  INT16_C( 16177), -INT16_C( 23670),  INT16_C( 16385),  INT16_C(  1537), -INT16_C( 17356), -INT16_C(   261),
+        -INT16_C( 21892), -INT16_C( 13384), -INT16_C(   193), -INT16_C( 27852),  INT16_C(  8669),  INT16_C( 29363),  INT16_C( 29062),  INT16_C( 17132),
+        -INT16_C( 32398),  INT16_C(    64), -INT16_C( 21746), -INT16_C(    36),  INT16_C(    19),  INT16_C(  4892), -INT16_C( 17804), -INT16_C(  4536),
+        -INT16_C( 11357),  INT16_C(     0),  INT16_C(  8760), -INT16_C( 30519),  INT16_C(   400),  INT16_C( 16908),  INT16_C(     1),  INT16_C( 24580) },
+      {  INT16_C( 14209),  INT16_C(  7147), -INT16_C(    65), -INT16_C( 29424), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129), -INT16_C(  7018),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C( 15163),  INT16_C( 23677),  INT16_C(     2), -INT16_C( 31623),  INT16_C( 12544),  INT16_C( 24571),
+        -INT16_C(  2082), -INT16_C(     2),  INT16_C( 25738),  INT16_C(  2386),  INT16_C( 11423),  INT16_C( 10446), -INT16_C(     1), -INT16_C( 28591),
+         INT16_C(   137),  INT16_C( 29406),  INT16_C( 14473),  INT16_C(  5364), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     0),  INT16_C(  1216) },
+      { -INT16_C(  4034),  INT16_C( 32096), -INT16_C(  2073), -INT16_C( 24044), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129), -INT16_C( 27937),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C( 26433), -INT16_C( 28750),  INT16_C(    68), -INT16_C( 28882),  INT16_C(  8206), -INT16_C(   152),
+        -INT16_C(  1072), -INT16_C(     2), -INT16_C( 28331),  INT16_C(  2386), -INT16_C( 27680),  INT16_C( 10446), -INT16_C(     1),  INT16_C(  2621),
+         INT16_C(  4410),  INT16_C( 29406),  INT16_C( 14473), -INT16_C( 24943), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     0), -INT16_C( 26612) },
+      { -INT16_C(  1893), -INT16_C( 32624), -INT16_C( 24680),  INT16_C( 20933), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129),  INT16_C( 32637),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C(    97), -INT16_C( 13926),  INT16_C(  4334), -INT16_C( 18087),  INT16_C( 14531), -INT16_C( 24202),
+         INT16_C( 16569), -INT16_C(     2),  INT16_C( 21895),  INT16_C(  2386), -INT16_C( 32759),  INT16_C( 10446), -INT16_C(     1), -INT16_C(  2268),
+        -INT16_C(  5679),  INT16_C( 29406),  INT16_C( 14473),  INT16_C( 17508), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     0),  INT16_C( 12290) },
+      { -INT16_C( 17393), -INT16_C(  8360), -INT16_C(   519),  INT16_C( 26757), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129),  INT16_C(  9399),
+         INT16_C(   513), -INT16_C( 12725),  INT16_C(  9775), -INT16_C(  7188),  INT16_C(    17),  INT16_C(  9163), -INT16_C( 30717), -INT16_C(    38),
+        -INT16_C( 16652), -INT16_C(     2),  INT16_C(  9301),  INT16_C(  2386),  INT16_C( 25848),  INT16_C( 10446), -INT16_C(     1), -INT16_C( 32113),
+         INT16_C(  1102),  INT16_C( 29406),  INT16_C( 14473), -INT16_C( 22620), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     0),  INT16_C(  9731) } },
+    { {  INT16_C( 24551),  INT16_C(     4), -INT16_C(     1), -INT16_C(  8197), -INT16_C(     1),  INT16_C(  1792),  INT16_C( 24386), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(  4497),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+         INT16_C( 14656),  INT16_C(  3700), -INT16_C( 12717), -INT16_C( 24568),  INT16_C( 15895),  INT16_C( 20299),  INT16_C(   325), -INT16_C(    57),
+         INT16_C(   825), -INT16_C(  6503),  INT16_C( 16383),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      UINT32_C(  87363670),
+      { -INT16_C(  9217), -INT16_C( 28887),  INT16_C(  3457),  INT16_C(  8092), -INT16_C(  4517), -INT16_C( 24180),  INT16_C(     0),  INT16_C(  3144),
+         INT16_C( 30860),  INT16_C(  2048), -INT16_C(   258),  INT16_C( 24733),  INT16_C(    34), -INT16_C(  4053), -INT16_C(    16), -INT16_C( 23505),
+        -INT16_C(  9536),  INT16_C( 22225),  INT16_C( 14549), -INT16_C( 17086), -INT16_C(  6332),  INT16_C(  1026),  INT16_C( 31739),  INT16_C(   140),
+        -INT16_C(  2049),  INT16_C(     0),  INT16_C( 28378), -INT16_C(  4099), -INT16_C( 14272),       INT16_MIN,  INT16_C( 17788),  INT16_C(   640) },
+      { -INT16_C( 16153), -INT16_C(  1025),  INT16_C( 16696), -INT16_C( 16401),  INT16_C( 23009),  INT16_C(   128), -INT16_C( 16393), -INT16_C(  4097),
+         INT16_C(   260), -INT16_C(  8225), -INT16_C(   353), -INT16_C( 24405), -INT16_C( 29950), -INT16_C(  7410),  INT16_C(  2057), -INT16_C( 17032),
+        -INT16_C(  2995),  INT16_C( 17872),  INT16_C( 32148),  INT16_C( 24575), -INT16_C(  4360),  INT16_C(   581), -INT16_C(   385),  INT16_C( 21514),
+         INT16_C( 10487), -INT16_C( 26548), -INT16_C( 32672),  INT16_C(  1280),  INT16_C(    56), -INT16_C(  1537),  INT16_C(     0),  INT16_C(   131) },
+      {  INT16_C( 24551), -INT16_C( 28887),  INT16_C(  3457), -INT16_C(  8197), -INT16_C(  4517),  INT16_C(  1792),  INT16_C(     0), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(    34),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+        -INT16_C(  9536),  INT16_C(  3700),  INT16_C( 14549), -INT16_C( 24568), -INT16_C(  6332),  INT16_C(  1026),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C(  2049), -INT16_C(  6503),  INT16_C( 28378),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      {  INT16_C( 24551), -INT16_C(  6849), -INT16_C( 20440), -INT16_C(  8197), -INT16_C( 13461),  INT16_C(  1792),  INT16_C(    23), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(  1105),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+         INT16_C( 22558),  INT16_C(  3700),  INT16_C(  6831), -INT16_C( 24568), -INT16_C(  5987), -INT16_C( 32704),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C(    27), -INT16_C(  6503), -INT16_C(  9392),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      {  INT16_C( 24551), -INT16_C(   513), -INT16_C( 24420), -INT16_C(  8197), -INT16_C( 21264),  INT16_C(  1792),  INT16_C( 24571), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C( 17793),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+         INT16_C( 31270),  INT16_C(  3700), -INT16_C( 16694), -INT16_C( 24568),  INT16_C( 30588),  INT16_C(   290),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C( 27525), -INT16_C(  6503),  INT16_C( 16432),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      {  INT16_C( 24551),  INT16_C( 31055),  INT16_C( 27658), -INT16_C(  8197),  INT16_C( 29402),  INT16_C(  1792),  INT16_C(     5), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(   276),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+        -INT16_C( 10745),  INT16_C(  3700), -INT16_C( 14677), -INT16_C( 24568),  INT16_C( 14887),  INT16_C(  8208),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C( 16391), -INT16_C(  6503),  INT16_C( 30420),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_mask_shldi_epi16(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x32(r0, simde_mm512_loadu_epi16(test_vec[i].r0));
+    simde__m512i r5 = simde_mm512_mask_shldi_epi16(src, test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x32(r5, simde_mm512_loadu_epi16(test_vec[i].r5));
+    simde__m512i r15 = simde_mm512_mask_shldi_epi16(src, test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x32(r15, simde_mm512_loadu_epi16(test_vec[i].r15));
+    simde__m512i r19 = simde_mm512_mask_shldi_epi16(src, test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x32(r19, simde_mm512_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r0[32];
+    const int16_t r5[32];
+    const int16_t r15[32];
+    const int16_t r19[32];
+  } test_vec[] = {
+    { UINT32_C(3133690470),
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C( 15912), -INT16_C( 29779), -INT16_C(  7643), -INT16_C(  4340), -INT16_C( 21195),  INT16_C(     6),
+         INT16_C(  2304),  INT16_C( 19136),  INT16_C(  4488), -INT16_C(  3936),  INT16_C( 13806), -INT16_C(     1), -INT16_C( 32496),  INT16_C(   518),
+         INT16_C(     0),  INT16_C( 21294), -INT16_C(     9), -INT16_C( 26881),  INT16_C(    16), -INT16_C(  3125),  INT16_C( 29627),  INT16_C(   128),
+         INT16_C( 11937), -INT16_C(     1),  INT16_C(  6329), -INT16_C( 19026),  INT16_C(   592), -INT16_C(  2625), -INT16_C(    41), -INT16_C(  9109) },
+      { -INT16_C( 29138), -INT16_C(    15),  INT16_C(     0), -INT16_C(     1),  INT16_C(  7571),  INT16_C(    98), -INT16_C( 24064),  INT16_C( 23400),
+        -INT16_C( 32256),  INT16_C(  1324),  INT16_C( 25581),  INT16_C( 19681),  INT16_C( 21649), -INT16_C( 24035), -INT16_C(     2), -INT16_C( 12519),
+        -INT16_C( 27692),  INT16_C( 22864),  INT16_C(  2304), -INT16_C(  8193), -INT16_C(     2), -INT16_C(  2164),  INT16_C( 20497),  INT16_C(  8322),
+         INT16_C( 10240), -INT16_C(  4225),  INT16_C(   128),  INT16_C( 20479),  INT16_C(  4504), -INT16_C(  8961), -INT16_C( 13644), -INT16_C( 18945) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 15912),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4340), -INT16_C( 21195),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 19136),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13806),  INT16_C(     0), -INT16_C( 32496),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26881),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29627),  INT16_C(   128),
+         INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C( 19026),  INT16_C(   592), -INT16_C(  2625),  INT16_C(     0), -INT16_C(  9109) },
+      {  INT16_C(     0),  INT16_C(    31), -INT16_C( 15104),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7808), -INT16_C( 22860),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 22528),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16950),  INT16_C(     0),  INT16_C(  8735),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8197),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30570),  INT16_C(  4100),
+         INT16_C(     0), -INT16_C(     3),  INT16_C(     0), -INT16_C( 18999),  INT16_C( 18946), -INT16_C( 18437),  INT16_C(     0), -INT16_C( 29322) },
+      {  INT16_C(     0),  INT16_C( 32760),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    49), -INT16_C( 12032),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(   662),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10824),  INT16_C(     0),       INT16_MAX,  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4097),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22520),  INT16_C(  4161),
+         INT16_C(     0), -INT16_C(  2113),  INT16_C(     0),  INT16_C( 10239),  INT16_C(  2252), -INT16_C(  4481),  INT16_C(     0), -INT16_C(  9473) },
+      {  INT16_C(     0),  INT16_C(     7), -INT16_C(  3776),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30816),  INT16_C( 27053),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 22016),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20622),  INT16_C(     0),  INT16_C(  2183),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18434),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25126),  INT16_C(  1025),
+         INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C( 21134),  INT16_C(  4736), -INT16_C( 20994),  INT16_C(     0), -INT16_C(  7331) } },
+    { UINT32_C(1137116126),
+      { -INT16_C(  6447), -INT16_C( 29708),  INT16_C( 26877),  INT16_C( 12465), -INT16_C( 27174),  INT16_C(  1780),  INT16_C( 17047), -INT16_C( 28117),
+        -INT16_C(     1),  INT16_C(  6494), -INT16_C(   131),  INT16_C(  4354), -INT16_C( 14423), -INT16_C( 28929), -INT16_C(  1025), -INT16_C( 25022),
+        -INT16_C( 30192),  INT16_C( 28487), -INT16_C(  1598),  INT16_C(  6408),  INT16_C( 11391),  INT16_C( 32703), -INT16_C(  2309), -INT16_C(   569),
+         INT16_C( 22842), -INT16_C( 30466), -INT16_C(  4481), -INT16_C(  2385),  INT16_C( 32390), -INT16_C(   133),  INT16_C(   522), -INT16_C(  6418) },
+      { -INT16_C(   642),  INT16_C(  1024),  INT16_C( 26029), -INT16_C(  4766),  INT16_C(  9604), -INT16_C( 10796), -INT16_C( 16715), -INT16_C(  2049),
+         INT16_C(  9369),  INT16_C( 26310),  INT16_C( 25473), -INT16_C(  5169),  INT16_C(  8225), -INT16_C(  1041), -INT16_C(     1), -INT16_C( 27456),
+        -INT16_C(     1), -INT16_C(    11), -INT16_C(   232),  INT16_C( 25714), -INT16_C(  8479),  INT16_C(    16), -INT16_C( 26817), -INT16_C( 22477),
+        -INT16_C( 22529),  INT16_C( 21312), -INT16_C( 16385), -INT16_C(  7715),  INT16_C(   513),  INT16_C( 31987), -INT16_C(     1), -INT16_C( 15924) },
+      {  INT16_C(     0), -INT16_C( 29708),  INT16_C( 26877),  INT16_C( 12465), -INT16_C( 27174),  INT16_C(     0),  INT16_C( 17047), -INT16_C( 28117),
+        -INT16_C(     1),  INT16_C(  6494),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 30192),  INT16_C( 28487), -INT16_C(  1598),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2309), -INT16_C(   569),
+         INT16_C( 22842), -INT16_C( 30466),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   522),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 32384),  INT16_C(  8108),  INT16_C(  5693), -INT16_C( 17596),  INT16_C(     0),  INT16_C( 21239),  INT16_C( 17790),
+        -INT16_C(    28),  INT16_C( 11212),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C( 16927), -INT16_C(  5889),  INT16_C( 14431),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8334), -INT16_C( 18187),
+         INT16_C( 10068),  INT16_C(  8138),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16735),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(   512), -INT16_C( 19754), -INT16_C(  2383),  INT16_C(  4802),  INT16_C(     0), -INT16_C(  8358), -INT16_C(  1025),
+        -INT16_C( 28084),  INT16_C( 13155),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+              INT16_MAX, -INT16_C(     6),  INT16_C( 32652),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13409), -INT16_C( 11239),
+         INT16_C( 21503),  INT16_C( 10656),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),       INT16_MAX,  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 24480),  INT16_C( 18411), -INT16_C( 31345), -INT16_C( 20783),  INT16_C(     0),  INT16_C(  5309), -INT16_C( 28321),
+        -INT16_C(     7), -INT16_C( 13581),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C( 20615),  INT16_C( 31295), -INT16_C( 12777),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18468), -INT16_C(  4547),
+        -INT16_C( 13867),  INT16_C( 18418),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4183),  INT16_C(     0) } },
+    { UINT32_C( 637836867),
+      {  INT16_C( 18432),  INT16_C( 19859), -INT16_C(  2065),  INT16_C(  8949),  INT16_C(     0),  INT16_C( 16388),  INT16_C( 30591),  INT16_C(    34),
+         INT16_C(  9079), -INT16_C(     1),       INT16_MAX,  INT16_C(  5124),  INT16_C(  2048),  INT16_C( 12845),  INT16_C(    20), -INT16_C( 32418),
+         INT16_C(  7752),  INT16_C( 20780), -INT16_C( 23722),  INT16_C( 32765),  INT16_C(  8208),  INT16_C(   512),  INT16_C( 20329), -INT16_C( 17275),
+         INT16_C(  6201),  INT16_C( 24545), -INT16_C( 21675),  INT16_C(  8300),  INT16_C(  2048),  INT16_C( 10605), -INT16_C(  1122),  INT16_C( 22218) },
+      {  INT16_C(     0),  INT16_C(  8192),  INT16_C(  8192),  INT16_C(     4),  INT16_C(  8200),  INT16_C( 14789), -INT16_C(  1678),  INT16_C(     0),
+        -INT16_C( 32512),  INT16_C( 24576),  INT16_C(  2052),  INT16_C( 31463), -INT16_C(     9),  INT16_C( 28434),  INT16_C(     0),  INT16_C(   256),
+         INT16_C( 23635),  INT16_C( 20535),  INT16_C( 21523),  INT16_C(  4112),  INT16_C(  9344), -INT16_C(    39),  INT16_C(  1594), -INT16_C(   261),
+        -INT16_C( 32544), -INT16_C( 22060), -INT16_C( 29563), -INT16_C( 29260),  INT16_C( 16351), -INT16_C(     5), -INT16_C(  1991),  INT16_C( 15555) },
+      {  INT16_C( 18432),  INT16_C( 19859),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30591),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(     1),       INT16_MAX,  INT16_C(  5124),  INT16_C(  2048),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32418),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 23722),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 24545), -INT16_C( 21675),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10605),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C( 19868),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4097),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(    20), -INT16_C(    31), -INT16_C( 32625),  INT16_C(    31),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11200),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 27338),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(   971),  INT16_C( 27313),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11711),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C( 28672),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   839),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 20480), -INT16_C( 31742),  INT16_C( 15731),  INT16_C( 32763),  INT16_C(     0),  INT16_C(     0),  INT16_C(   128),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 10761),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 11030), -INT16_C( 14782),  INT16_C(     0),  INT16_C(     0), -INT16_C(     3),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C( 16384),  INT16_C( 27801),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 17409),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(     5), -INT16_C(     8), -INT16_C( 24541),  INT16_C( 16391),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2800),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(  6834),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(   243),  INT16_C( 23212),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19311),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 277544090),
+      {  INT16_C(     6), -INT16_C( 16393), -INT16_C(    73), -INT16_C(     3), -INT16_C( 24240), -INT16_C( 16641),  INT16_C( 17948),  INT16_C(   857),
+        -INT16_C( 16009),  INT16_C( 30944), -INT16_C(  4934),  INT16_C(     2),  INT16_C( 19453), -INT16_C( 18500), -INT16_C( 21268),  INT16_C(  1024),
+        -INT16_C( 23909), -INT16_C(  4293), -INT16_C(     5),  INT16_C( 12565), -INT16_C(  1026),  INT16_C( 13451), -INT16_C( 20173), -INT16_C(  2049),
+         INT16_C( 26811), -INT16_C( 30243),  INT16_C(     8), -INT16_C(  8360),  INT16_C(  1664),  INT16_C(     0),  INT16_C(     8), -INT16_C(     1) },
+      { -INT16_C(   131), -INT16_C(  2081),  INT16_C(   103),  INT16_C( 18946),  INT16_C(  2176),  INT16_C( 13431), -INT16_C( 15513), -INT16_C(  4105),
+         INT16_C( 13106),  INT16_C( 31690), -INT16_C(   129),  INT16_C( 16682),  INT16_C( 30448), -INT16_C( 32721), -INT16_C(     1),  INT16_C(   304),
+        -INT16_C(  3106),  INT16_C( 12312), -INT16_C( 30720),  INT16_C( 24543), -INT16_C(   129), -INT16_C( 10274), -INT16_C( 10753),  INT16_C(   512),
+        -INT16_C( 24138),  INT16_C(  3809),  INT16_C(  1152), -INT16_C(  4502),  INT16_C( 20962), -INT16_C( 20229),  INT16_C( 15249),  INT16_C(  2176) },
+      {  INT16_C(     0), -INT16_C( 16393),  INT16_C(     0), -INT16_C(     3), -INT16_C( 24240),  INT16_C(     0),  INT16_C(     0),  INT16_C(   857),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(  4934),  INT16_C(     2),  INT16_C( 19453), -INT16_C( 18500), -INT16_C( 21268),  INT16_C(  1024),
+         INT16_C(     0), -INT16_C(  4293),  INT16_C(     0),  INT16_C( 12565),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2049),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1664),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(   258),  INT16_C(     0), -INT16_C(    87),  INT16_C( 10753),  INT16_C(     0),  INT16_C(     0),  INT16_C( 27453),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 26785),  INT16_C(    72),  INT16_C( 32686), -INT16_C(  2160), -INT16_C( 25185),       INT16_MIN,
+         INT16_C(     0), -INT16_C(  6298),  INT16_C(     0),  INT16_C(  8875),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    32),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12278),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  1041),  INT16_C(     0), -INT16_C( 23295),  INT16_C(  1088),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2053),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 32703),  INT16_C(  8341), -INT16_C( 17544),  INT16_C( 16407),       INT16_MAX,  INT16_C(   152),
+         INT16_C(     0), -INT16_C( 26612),  INT16_C(     0), -INT16_C( 20497),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32512),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10481),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(    65),  INT16_C(     0), -INT16_C(    22),  INT16_C(  2688),  INT16_C(     0),  INT16_C(     0),  INT16_C(  6863),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 26071),  INT16_C(    18),  INT16_C( 24555), -INT16_C( 16924),  INT16_C( 26471),  INT16_C(  8192),
+         INT16_C(     0),  INT16_C( 31193),  INT16_C(     0), -INT16_C( 30550),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16392),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13314),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_maskz_shldi_epi16(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x32(r0, simde_mm512_loadu_epi16(test_vec[i].r0));
+    simde__m512i r5 = simde_mm512_maskz_shldi_epi16(test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x32(r5, simde_mm512_loadu_epi16(test_vec[i].r5));
+    simde__m512i r15 = simde_mm512_maskz_shldi_epi16(test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x32(r15, simde_mm512_loadu_epi16(test_vec[i].r15));
+    simde__m512i r19 = simde_mm512_maskz_shldi_epi16(test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x32(r19, simde_mm512_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r7[16];
+    const int32_t r31[16];
+    const int32_t r40[16];
+  } test_vec[] = {
+    { { -INT32_C(  1244653521),  INT32_C(      532608),  INT32_C(  1490034520),  INT32_C(   570949676), -INT32_C(   884998241),  INT32_C(        4160),  INT32_C(     2441217), -INT32_C(     3170819),
+        -INT32_C(       65537), -INT32_C(  1627406369),  INT32_C(  1032600085), -INT32_C(    26270587), -INT32_C(    67764225), -INT32_C(    19034113), -INT32_C(   537661457), -INT32_C(  1204478447) },
+      { -INT32_C(      268321),  INT32_C(  2147467003), -INT32_C(  1725400487),  INT32_C(   366017543), -INT32_C(     2129929),  INT32_C(  2074869759), -INT32_C(   139854849),  INT32_C(  1979432959),
+        -INT32_C(  1058764363),  INT32_C(   140247040),  INT32_C(   266498793),  INT32_C(  1930558264),  INT32_C(   497985196),  INT32_C(    30269960),  INT32_C(   745702234), -INT32_C(      135169) },
+      { -INT32_C(  1244653521),  INT32_C(      532608),  INT32_C(  1490034520),  INT32_C(   570949676), -INT32_C(   884998241),  INT32_C(        4160),  INT32_C(     2441217), -INT32_C(     3170819),
+        -INT32_C(       65537), -INT32_C(  1627406369),  INT32_C(  1032600085), -INT32_C(    26270587), -INT32_C(    67764225), -INT32_C(    19034113), -INT32_C(   537661457), -INT32_C(  1204478447) },
+      { -INT32_C(   401860609),  INT32_C(    68173887),  INT32_C(  1745857612),  INT32_C(    67114506), -INT32_C(  1610625025),  INT32_C(      532541),  INT32_C(   312475899), -INT32_C(   405864774),
+        -INT32_C(     8388640),  INT32_C(  2145382276), -INT32_C(   971175289),  INT32_C(   932332217), -INT32_C(    83886194),  INT32_C(  1858600832), -INT32_C(   101189738),  INT32_C(   445581567) },
+      { -INT32_C(      134161),  INT32_C(  1073733501),  INT32_C(  1284783404),  INT32_C(   183008771), -INT32_C(     1064965),  INT32_C(  1037434879), -INT32_C(    69927425), -INT32_C(  1157767169),
+        -INT32_C(   529382182), -INT32_C(  2077360128), -INT32_C(  2014234252), -INT32_C(  1182204516), -INT32_C(  1898491050), -INT32_C(  2132348668), -INT32_C(  1774632531), -INT32_C(       67585) },
+      { -INT32_C(   803721217),  INT32_C(   136347775), -INT32_C(   803252071),  INT32_C(   134229013),  INT32_C(  1073717247),  INT32_C(     1065083),  INT32_C(   624951799), -INT32_C(   811729547),
+        -INT32_C(    16777280), -INT32_C(     4202744), -INT32_C(  1942350577),  INT32_C(  1864664435), -INT32_C(   167772387), -INT32_C(   577765631), -INT32_C(   202379476),  INT32_C(   891163135) } },
+    { { -INT32_C(  1833002144),  INT32_C(  1292629648), -INT32_C(       36865), -INT32_C(   268460225),  INT32_C(           1), -INT32_C(   495741653),  INT32_C(  1465777837),  INT32_C(  1647536913),
+        -INT32_C(    34603105), -INT32_C(   701477440), -INT32_C(   582267700), -INT32_C(    50335745),  INT32_C(  2042914293), -INT32_C(   100868641), -INT32_C(   394678946),  INT32_C(   857154437) },
+      {  INT32_C(   134234128),  INT32_C(  1764619045), -INT32_C(      270337),  INT32_C(   337958347),  INT32_C(    17825856),  INT32_C(   104246715),  INT32_C(      540672), -INT32_C(    67912737),
+         INT32_C(  1429361952), -INT32_C(    36241409),  INT32_C(    92323968), -INT32_C(   101187594),  INT32_C(   554172464), -INT32_C(   613533951), -INT32_C(  1379872952),  INT32_C(   537202768) },
+      { -INT32_C(  1833002144),  INT32_C(  1292629648), -INT32_C(       36865), -INT32_C(   268460225),  INT32_C(           1), -INT32_C(   495741653),  INT32_C(  1465777837),  INT32_C(  1647536913),
+        -INT32_C(    34603105), -INT32_C(   701477440), -INT32_C(   582267700), -INT32_C(    50335745),  INT32_C(  2042914293), -INT32_C(   100868641), -INT32_C(   394678946),  INT32_C(   857154437) },
+      {  INT32_C(  1598926852), -INT32_C(  2047129548), -INT32_C(     4718593), -INT32_C(     3170422),  INT32_C(         128),  INT32_C(   969577859), -INT32_C(  1358997888),  INT32_C(   431327485),
+        -INT32_C(   134230102),  INT32_C(   405201022), -INT32_C(  1515821566),  INT32_C(  2146959356), -INT32_C(   499975536), -INT32_C(    26284051),  INT32_C(  1020702550), -INT32_C(  1953381744) },
+      {  INT32_C(    67117064),  INT32_C(   882309522), -INT32_C(      135169), -INT32_C(  1978504475), -INT32_C(  2138570720), -INT32_C(  2095360291), -INT32_C(  2147213312), -INT32_C(    33956369),
+        -INT32_C(  1432802672),  INT32_C(  2129362943),  INT32_C(    46161984), -INT32_C(    50593797), -INT32_C(  1870397416), -INT32_C(   306766976),  INT32_C(  1457547172), -INT32_C(  1878882264) },
+      { -INT32_C(  1097113592),  INT32_C(   200708201), -INT32_C(     9437185), -INT32_C(     6340844),  INT32_C(         257),  INT32_C(  1939155718),  INT32_C(  1576971520),  INT32_C(   862654971),
+        -INT32_C(   268460203),  INT32_C(   810402045),  INT32_C(  1263324165), -INT32_C(     1048583), -INT32_C(   999951071), -INT32_C(    52568101),  INT32_C(  2041405101),  INT32_C(   388203808) } },
+    { { -INT32_C(    94115761), -INT32_C(  1210750875),  INT32_C(  1095189171),  INT32_C(   168821764),  INT32_C(  2146959359),  INT32_C(   167773448),  INT32_C(  1073742592),  INT32_C(   404946946),
+        -INT32_C(  1076265119),  INT32_C(  1269516311),  INT32_C(           0), -INT32_C(   958270276), -INT32_C(   559187101),  INT32_C(   805312769),  INT32_C(   900405589),  INT32_C(   897999899) },
+      { -INT32_C(    67117061),  INT32_C(   367392541), -INT32_C(   456009675), -INT32_C(     7471649), -INT32_C(         201),  INT32_C(   134217728), -INT32_C(  1158455895), -INT32_C(   590721793),
+         INT32_C(  1241261971), -INT32_C(       65569), -INT32_C(      315133),  INT32_C(   115633749), -INT32_C(   886546401), -INT32_C(  1702249115), -INT32_C(  1948874963),  INT32_C(      534592) },
+      { -INT32_C(    94115761), -INT32_C(  1210750875),  INT32_C(  1095189171),  INT32_C(   168821764),  INT32_C(  2146959359),  INT32_C(   167773448),  INT32_C(  1073742592),  INT32_C(   404946946),
+        -INT32_C(  1076265119),  INT32_C(  1269516311),  INT32_C(           0), -INT32_C(   958270276), -INT32_C(   559187101),  INT32_C(   805312769),  INT32_C(   900405589),  INT32_C(   897999899) },
+      {  INT32_C(   838084605), -INT32_C(   357289334), -INT32_C(  1549706766),  INT32_C(   134349439), -INT32_C(    67108865),  INT32_C(      164868),  INT32_C(       98397),  INT32_C(   293601646),
+        -INT32_C(   322981724), -INT32_C(   710669313),  INT32_C(         127),  INT32_C(  1895456259),  INT32_C(  1438495205),  INT32_C(      819405), -INT32_C(   712201531), -INT32_C(  1020129920) },
+      { -INT32_C(    33558531), -INT32_C(  1963787378), -INT32_C(   228004838),  INT32_C(  2143747823), -INT32_C(         101),  INT32_C(    67108864),  INT32_C(  1568255700),  INT32_C(  1852122751),
+        -INT32_C(  1526852663), -INT32_C(       32785),  INT32_C(  2147326081),  INT32_C(    57816874), -INT32_C(   443273201), -INT32_C(   851124558), -INT32_C(   974437482), -INT32_C(  2147216352) },
+      {  INT32_C(  1676169211), -INT32_C(   714578667),  INT32_C(  1195553764),  INT32_C(   268698879), -INT32_C(   134217729),  INT32_C(      329736),  INT32_C(      196794),  INT32_C(   587203292),
+        -INT32_C(   645963447), -INT32_C(  1421338625),  INT32_C(         255), -INT32_C(   504054778), -INT32_C(  1417976885),  INT32_C(     1638810), -INT32_C(  1424403061), -INT32_C(  2040259840) } },
+    { {  INT32_C(    33554432),  INT32_C(  1059973516),  INT32_C(  1004503039), -INT32_C(   549454353), -INT32_C(   827250820),  INT32_C(    41976832),  INT32_C(    68239360),  INT32_C(        2304),
+        -INT32_C(   612442114), -INT32_C(  1576910848), -INT32_C(   539099173), -INT32_C(  1116006409),  INT32_C(  1965029406), -INT32_C(   525238636), -INT32_C(  1633845989), -INT32_C(  1074274561) },
+      {  INT32_C(  1881454561),  INT32_C(  1207959681), -INT32_C(      132611), -INT32_C(  1537736499), -INT32_C(   842464817),  INT32_C(  1450956187), -INT32_C(    33554721),  INT32_C(           0),
+         INT32_C(  1724560853),  INT32_C(  1106187640), -INT32_C(  1599916560), -INT32_C(  1478329794), -INT32_C(   268570753),  INT32_C(  2105407487), -INT32_C(  1081219632), -INT32_C(     6308161) },
+      {  INT32_C(    33554432),  INT32_C(  1059973516),  INT32_C(  1004503039), -INT32_C(   549454353), -INT32_C(   827250820),  INT32_C(    41976832),  INT32_C(    68239360),  INT32_C(        2304),
+        -INT32_C(   612442114), -INT32_C(  1576910848), -INT32_C(   539099173), -INT32_C(  1116006409),  INT32_C(  1965029406), -INT32_C(   525238636), -INT32_C(  1633845989), -INT32_C(  1074274561) },
+      {  INT32_C(          56), -INT32_C(  1762343388), -INT32_C(   272629761), -INT32_C(  1610680366),  INT32_C(  1486077542),  INT32_C(  1078067243),  INT32_C(   144703614),  INT32_C(      294912),
+        -INT32_C(  1083179213),  INT32_C(    18874400), -INT32_C(   285217328), -INT32_C(  1114899501), -INT32_C(  1879306377),  INT32_C(  1488931390),  INT32_C(  1321111007), -INT32_C(    68190209) },
+      {  INT32_C(   940727280),  INT32_C(   603979840), -INT32_C(       66306), -INT32_C(   768868250),  INT32_C(  1726251239),  INT32_C(   725478093),  INT32_C(  2130706287),  INT32_C(           0),
+         INT32_C(   862280426),  INT32_C(   553093820), -INT32_C(   799958280), -INT32_C(   739164897),  INT32_C(  2013198271),  INT32_C(  1052703743), -INT32_C(   540609816), -INT32_C(     3154081) },
+      {  INT32_C(         112),  INT32_C(   770280520), -INT32_C(   545259521),  INT32_C(  1073606564), -INT32_C(  1322812211), -INT32_C(  2138832810),  INT32_C(   289407229),  INT32_C(      589824),
+         INT32_C(  2128608870),  INT32_C(    37748801), -INT32_C(   570434656),  INT32_C(  2065168295),  INT32_C(   536354543), -INT32_C(  1317104515), -INT32_C(  1652745281), -INT32_C(   136380417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_shldi_epi32(a, b, 0);
+    simde_test_x86_assert_equal_i32x16(r0, simde_mm512_loadu_epi32(test_vec[i].r0));
+    simde__m512i r7 = simde_mm512_shldi_epi32(a, b, 7);
+    simde_test_x86_assert_equal_i32x16(r7, simde_mm512_loadu_epi32(test_vec[i].r7));
+    simde__m512i r31 = simde_mm512_shldi_epi32(a, b, 31);
+    simde_test_x86_assert_equal_i32x16(r31, simde_mm512_loadu_epi32(test_vec[i].r31));
+    simde__m512i r40 = simde_mm512_shldi_epi32(a, b, 40);
+    simde_test_x86_assert_equal_i32x16(r40, simde_mm512_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r7[16];
+    const int32_t r31[16];
+    const int32_t r40[16];
+  } test_vec[] = {
+    { {  INT32_C(    35655712), -INT32_C(  1911251547),  INT32_C(  1113821632), -INT32_C(     1050633), -INT32_C(  2073296736),  INT32_C(   783990111),  INT32_C(   317983736), -INT32_C(  1078149162),
+        -INT32_C(   447841813),  INT32_C(  1385676859),  INT32_C(  1085382714), -INT32_C(  1610878977),  INT32_C(  2010906095), -INT32_C(    34349313),  INT32_C(   512301638),  INT32_C(   204031351) },
+      UINT16_C(23130),
+      { -INT32_C(  1043675061),  INT32_C(   308676699),  INT32_C(       82192),  INT32_C(  2143280575), -INT32_C(   920613932), -INT32_C(  1221346711),  INT32_C(  1053002349), -INT32_C(  1562039715),
+        -INT32_C(   272629761), -INT32_C(  1985427382),  INT32_C(   170760329),  INT32_C(    75442273),  INT32_C(  1223036070),  INT32_C(       50436),  INT32_C(   278708073), -INT32_C(  2130704380) },
+      { -INT32_C(  1930634630),  INT32_C(  1009906786),  INT32_C(   303632099), -INT32_C(  1258224488),  INT32_C(   541082692),  INT32_C(  1605990889),  INT32_C(   846810964), -INT32_C(   923894966),
+         INT32_C(    53129692), -INT32_C(  1175265275), -INT32_C(     8519686),  INT32_C(    67108936),  INT32_C(  1632558639),  INT32_C(   559038528), -INT32_C(   303169537),  INT32_C(  2007387323) },
+      {  INT32_C(    35655712),  INT32_C(   308676699),  INT32_C(  1113821632),  INT32_C(  2143280575), -INT32_C(   920613932),  INT32_C(   783990111),  INT32_C(  1053002349), -INT32_C(  1078149162),
+        -INT32_C(   447841813), -INT32_C(  1985427382),  INT32_C(  1085382714),  INT32_C(    75442273),  INT32_C(  1223036070), -INT32_C(    34349313),  INT32_C(   278708073),  INT32_C(   204031351) },
+      {  INT32_C(    35655712),  INT32_C(   855911838),  INT32_C(  1113821632), -INT32_C(   537993254), -INT32_C(  1874466288),  INT32_C(   783990111),  INT32_C(  1640314521), -INT32_C(  1078149162),
+        -INT32_C(   447841813), -INT32_C(   731634340),  INT32_C(  1085382714),  INT32_C(  1066676354),  INT32_C(  1929794352), -INT32_C(    34349313),  INT32_C(  1314895094),  INT32_C(   204031351) },
+      {  INT32_C(    35655712), -INT32_C(  1642530255),  INT32_C(  1113821632), -INT32_C(   629112244),  INT32_C(   270541346),  INT32_C(   783990111), -INT32_C(  1724078166), -INT32_C(  1078149162),
+        -INT32_C(   447841813),  INT32_C(  1559851010),  INT32_C(  1085382714), -INT32_C(  2113929180),  INT32_C(   816279319), -INT32_C(    34349313), -INT32_C(   151584769),  INT32_C(   204031351) },
+      {  INT32_C(    35655712),  INT32_C(  1711823676),  INT32_C(  1113821632), -INT32_C(  1075986507),  INT32_C(   546034720),  INT32_C(   783990111), -INT32_C(  1014338254), -INT32_C(  1078149162),
+        -INT32_C(   447841813), -INT32_C(  1463268679),  INT32_C(  1085382714),  INT32_C(  2133352708), -INT32_C(   435378591), -INT32_C(    34349313), -INT32_C(  1665177107),  INT32_C(   204031351) } },
+    { {  INT32_C(    16844041), -INT32_C(        1025), -INT32_C(    16859137),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+         INT32_C(   268577092), -INT32_C(  1714608292), -INT32_C(       81953),  INT32_C(    16809985), -INT32_C(     3151377),  INT32_C(   119795602),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      UINT16_C(11527),
+      { -INT32_C(  1073775617), -INT32_C(  1465221219),  INT32_C(       69888), -INT32_C(       11266),  INT32_C(     1048612), -INT32_C(  1224737025),  INT32_C(  1783704081), -INT32_C(      262658),
+        -INT32_C(   285246469), -INT32_C(   134354193), -INT32_C(     8539170), -INT32_C(   147846139),  INT32_C(    21266976),  INT32_C(        2049), -INT32_C(   327055048),  INT32_C(           0) },
+      { -INT32_C(  2147481599),  INT32_C(   630345613),  INT32_C(  1613275184), -INT32_C(  1082343489), -INT32_C(   401897647), -INT32_C(       16513), -INT32_C(   428706228),  INT32_C(   644080504),
+        -INT32_C(  1074266371),  INT32_C(  1744189488),  INT32_C(  1902262391), -INT32_C(       33537), -INT32_C(  1310774943),  INT32_C(        8218),  INT32_C(  2146402233), -INT32_C(   805340163) },
+      { -INT32_C(  1073775617), -INT32_C(  1465221219),  INT32_C(       69888),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+        -INT32_C(   285246469), -INT32_C(  1714608292), -INT32_C(     8539170), -INT32_C(   147846139), -INT32_C(     3151377),  INT32_C(        2049),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      { -INT32_C(     4325440),  INT32_C(  1430245010),  INT32_C(     8945712),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+         INT32_C(  2143157727), -INT32_C(  1714608292), -INT32_C(  1093013704), -INT32_C(  1744436481), -INT32_C(     3151377),  INT32_C(      262272),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      { -INT32_C(  1073740800), -INT32_C(  1832310842),  INT32_C(   806637592),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+        -INT32_C(   537133186), -INT32_C(  1714608292),  INT32_C(   951131195), -INT32_C(       16769), -INT32_C(     3151377), -INT32_C(  2147479539),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      { -INT32_C(     8650880), -INT32_C(  1434477275),  INT32_C(    17891424),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+        -INT32_C(     8651841), -INT32_C(  1714608292),  INT32_C(  2108939889),  INT32_C(   806094335), -INT32_C(     3151377),  INT32_C(      524544),  INT32_C(  1618951086), -INT32_C(   464491640) } },
+    { {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(        6145),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(       16385), -INT32_C(       16387), -INT32_C(  1052765888), -INT32_C(   834479188), -INT32_C(  1211146437), -INT32_C(       66930) },
+      UINT16_C(15488),
+      {  INT32_C(    17957888), -INT32_C(     2162689), -INT32_C(     9437185), -INT32_C(  1235125391),  INT32_C(     8454208), -INT32_C(    16777218),  INT32_C(     4198432), -INT32_C(   270540833),
+        -INT32_C(  1315963903),  INT32_C(   142868480), -INT32_C(   929757151),  INT32_C(     8654888), -INT32_C(    51905537), -INT32_C(  2128068607),  INT32_C(  1964986965), -INT32_C(   965580812) },
+      { -INT32_C(   302022978),  INT32_C(    41960072),  INT32_C(       98561), -INT32_C(  2145320960), -INT32_C(  1017322521),  INT32_C(   511329117),  INT32_C(  2139092989),  INT32_C(   469233360),
+        -INT32_C(  2145386284), -INT32_C(  1187040631), -INT32_C(   936442235),  INT32_C(   838179092), -INT32_C(    67895303), -INT32_C(   272629761), -INT32_C(  1284912749), -INT32_C(   315363651) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(   270540833),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(   929757151),  INT32_C(     8654888), -INT32_C(    51905537), -INT32_C(  2128068607), -INT32_C(  1211146437), -INT32_C(       66930) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(   269488243),
+         INT32_C(  1985228763), -INT32_C(         267),  INT32_C(  1250169060),  INT32_C(  1107825688),  INT32_C(  1946025981), -INT32_C(  1809841929), -INT32_C(  1211146437), -INT32_C(       66930) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(  1912866968),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(   468221118),  INT32_C(   419089546), -INT32_C(    33947652), -INT32_C(   136314881), -INT32_C(  1211146437), -INT32_C(       66930) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(   538976485),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(  1794629176), -INT32_C(  2079315919), -INT32_C(   402915333),  INT32_C(   675283439), -INT32_C(  1211146437), -INT32_C(       66930) } },
+    { {  INT32_C(   861402116), -INT32_C(   973081089),  INT32_C(        2306), -INT32_C(   434438820),  INT32_C(  2005213755), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(  1107361793),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(      540672),  INT32_C(   268697616), -INT32_C(   842955728), -INT32_C(    14747713), -INT32_C(  2147483644) },
+      UINT16_C(26781),
+      {  INT32_C(           2), -INT32_C(   271581209), -INT32_C(  2147481600), -INT32_C(   815793153),  INT32_C(   134226465), -INT32_C(  1207959969),  INT32_C(   340118695),  INT32_C(       65558),
+         INT32_C(  1091174400), -INT32_C(     4470849),  INT32_C(  1208107016),  INT32_C(  1490438006), -INT32_C(   856836140), -INT32_C(     2106369),  INT32_C(          32), -INT32_C(  1094729761) },
+      {  INT32_C(  1414435246),  INT32_C(  1878249471), -INT32_C(    67666051),  INT32_C(      426520), -INT32_C(     3277825),  INT32_C(   134218000),  INT32_C(  1332065442), -INT32_C(   734480060),
+         INT32_C(   498951320), -INT32_C(   439131750),  INT32_C(  1763555628),  INT32_C(        1024),  INT32_C(   269494784), -INT32_C(   574652417),  INT32_C(  2143248375), -INT32_C(        4121) },
+      {  INT32_C(           2), -INT32_C(   973081089), -INT32_C(  2147481600), -INT32_C(   815793153),  INT32_C(   134226465), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(       65558),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(  1490438006),  INT32_C(   268697616), -INT32_C(     2106369),  INT32_C(          32), -INT32_C(  2147483644) },
+      {  INT32_C(         298), -INT32_C(   973081089),  INT32_C(      262269), -INT32_C(  1342308480),  INT32_C(     1118463), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(     8391530),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(  1797503744),  INT32_C(   268697616), -INT32_C(   269615122),  INT32_C(        4159), -INT32_C(  2147483644) },
+      {  INT32_C(   707217623), -INT32_C(   973081089),  INT32_C(  2113650622), -INT32_C(  2147270388), -INT32_C(     1638913), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(  1780243618),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(         512),  INT32_C(   268697616), -INT32_C(   287326209),  INT32_C(  1071624187), -INT32_C(  2147483644) },
+      {  INT32_C(         596), -INT32_C(   973081089),  INT32_C(      524539),  INT32_C(  1610350336),  INT32_C(     2236927), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(    16783060),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739), -INT32_C(   699959808),  INT32_C(   268697616), -INT32_C(   539230243),  INT32_C(        8319), -INT32_C(  2147483644) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_mask_shldi_epi32(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x16(r0, simde_mm512_loadu_epi32(test_vec[i].r0));
+    simde__m512i r7 = simde_mm512_mask_shldi_epi32(src, test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x16(r7, simde_mm512_loadu_epi32(test_vec[i].r7));
+    simde__m512i r31 = simde_mm512_mask_shldi_epi32(src, test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x16(r31, simde_mm512_loadu_epi32(test_vec[i].r31));
+    simde__m512i r40 = simde_mm512_mask_shldi_epi32(src, test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x16(r40, simde_mm512_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r7[16];
+    const int32_t r31[16];
+    const int32_t r40[16];
+  } test_vec[] = {
+    { UINT16_C(55316),
+      { -INT32_C(   557075892),  INT32_C(     6946833), -INT32_C(  1448049465), -INT32_C(    67764225), -INT32_C(     4358401),  INT32_C(  2145386495),  INT32_C(  2146885615),  INT32_C(  1032179771),
+         INT32_C(   910758419),  INT32_C(    16924736),  INT32_C(    72359952),  INT32_C(   218294452),  INT32_C(  1498163392),  INT32_C(      264448), -INT32_C(    62681162),  INT32_C(   570425348) },
+      {  INT32_C(   503027244), -INT32_C(      262658), -INT32_C(   148936762), -INT32_C(   402918403),  INT32_C(  1787256142),  INT32_C(   608444416),  INT32_C(    67109888),  INT32_C(   272633920),
+        -INT32_C(    49608093),  INT32_C(    17302032), -INT32_C(     8388609), -INT32_C(  1577058048),  INT32_C(      524320), -INT32_C(  1556655945), -INT32_C(   134217729),  INT32_C(    67216389) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1448049465),  INT32_C(           0), -INT32_C(     4358401),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   218294452),  INT32_C(  1498163392),  INT32_C(           0), -INT32_C(    62681162),  INT32_C(   570425348) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   666737669),  INT32_C(           0), -INT32_C(   557875275),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2123081135), -INT32_C(  1508614144),  INT32_C(           0),  INT32_C(   566745979),  INT32_C(         514) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(    74468381),  INT32_C(           0), -INT32_C(  1253855577),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1358954624),  INT32_C(      262160),  INT32_C(           0),  INT32_C(  2080374783),  INT32_C(    33608194) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1333475337),  INT32_C(           0), -INT32_C(  1115750550),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    48805026),  INT32_C(  1277739008),  INT32_C(           0),  INT32_C(  1133491959),  INT32_C(        1028) } },
+    { UINT16_C(52050),
+      {  INT32_C(  1073745984), -INT32_C(    67108865), -INT32_C(   860330802), -INT32_C(   982888433), -INT32_C(   241597281), -INT32_C(  1204486740), -INT32_C(         513),  INT32_C(  1346830574),
+        -INT32_C(   536879106),  INT32_C(  1904951400),  INT32_C(   711556884),  INT32_C(   532604503), -INT32_C(  1470754894),  INT32_C(   101712000),  INT32_C(  1072693215),  INT32_C(     8388608) },
+      { -INT32_C(      134209), -INT32_C(   446027759), -INT32_C(   180355073),  INT32_C(    33693776),  INT32_C(      295104), -INT32_C(  1872633607), -INT32_C(  1735190879), -INT32_C(  2135387330),
+        -INT32_C(  1268876326),  INT32_C(   958766526), -INT32_C(   276956198),  INT32_C(   414352663),  INT32_C(   921442125),  INT32_C(      540802), -INT32_C(   335544337),  INT32_C(    69271552) },
+      {  INT32_C(           0), -INT32_C(    67108865),  INT32_C(           0),  INT32_C(           0), -INT32_C(   241597281),  INT32_C(           0), -INT32_C(         513),  INT32_C(           0),
+        -INT32_C(   536879106),  INT32_C(  1904951400),  INT32_C(           0),  INT32_C(   532604503),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1072693215),  INT32_C(     8388608) },
+      {  INT32_C(           0), -INT32_C(          14),  INT32_C(           0),  INT32_C(           0), -INT32_C(   859680896),  INT32_C(           0), -INT32_C(       65588),  INT32_C(           0),
+        -INT32_C(     1048742), -INT32_C(   979356644),  INT32_C(           0), -INT32_C(   546100340),  INT32_C(           0),  INT32_C(           0), -INT32_C(   134221835),  INT32_C(  1073741826) },
+      {  INT32_C(           0), -INT32_C(   223013880),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147336096),  INT32_C(           0), -INT32_C(   867595440),  INT32_C(           0),
+         INT32_C(  1513045485),  INT32_C(   479383263),  INT32_C(           0), -INT32_C(  1940307317),  INT32_C(           0),  INT32_C(           0), -INT32_C(   167772169),  INT32_C(    34635776) },
+      {  INT32_C(           0), -INT32_C(          27),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1719361792),  INT32_C(           0), -INT32_C(      131176),  INT32_C(           0),
+        -INT32_C(     2097484), -INT32_C(  1958713287),  INT32_C(           0), -INT32_C(  1092200680),  INT32_C(           0),  INT32_C(           0), -INT32_C(   268443669), -INT32_C(  2147483644) } },
+    { UINT16_C(16599),
+      { -INT32_C(    83886081),  INT32_C(   335676416),  INT32_C(    37749256),  INT32_C(  2147482109),  INT32_C(  1895829508), -INT32_C(   164043461),  INT32_C(   848184416), -INT32_C(    16777377),
+         INT32_C(   883543050),  INT32_C(  1126800135),  INT32_C(  2011486750),  INT32_C(    68161544), -INT32_C(  2075701490), -INT32_C(      524296),  INT32_C(      155656),  INT32_C(  1084817408) },
+      {  INT32_C(   497628398), -INT32_C(  1123005967), -INT32_C(   343076156), -INT32_C(  1736631849), -INT32_C(   134781081),  INT32_C(  1573601921), -INT32_C(   143720481),  INT32_C(   339886594),
+         INT32_C(  1279471987),  INT32_C(   268468288), -INT32_C(  1087919853),  INT32_C(      270468), -INT32_C(      524289), -INT32_C(      527361),  INT32_C(   823787825),  INT32_C(  1922284212) },
+      { -INT32_C(    83886081),  INT32_C(   335676416),  INT32_C(    37749256),  INT32_C(           0),  INT32_C(  1895829508),  INT32_C(           0),  INT32_C(   848184416), -INT32_C(    16777377),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      155656),  INT32_C(           0) },
+      {  INT32_C(  2147483534),  INT32_C(    16908382),  INT32_C(   536937589),  INT32_C(           0), -INT32_C(  2146958725),  INT32_C(           0),  INT32_C(  1193422971),  INT32_C(  2147463050),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    19923992),  INT32_C(           0) },
+      { -INT32_C(  1898669449),  INT32_C(  1585980664),  INT32_C(  1975945570),  INT32_C(           0),  INT32_C(  2080093107),  INT32_C(           0),  INT32_C(  2075623407), -INT32_C(  1977540351),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   411893912),  INT32_C(           0) },
+      { -INT32_C(         227),  INT32_C(    33816765),  INT32_C(  1073875179),  INT32_C(           0),  INT32_C(     1049847),  INT32_C(           0), -INT32_C(  1908121353), -INT32_C(       41196),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    39847985),  INT32_C(           0) } },
+    { UINT16_C( 4429),
+      { -INT32_C(   142606609),  INT32_C(       66608),  INT32_C(      788628),  INT32_C(   402784268),  INT32_C(   678768086),  INT32_C(  1054299899),  INT32_C(     8389312), -INT32_C(   197554507),
+         INT32_C(   536879368),  INT32_C(  1861188472),  INT32_C(        2057),  INT32_C(  1037688008),  INT32_C(      280112),  INT32_C(   733048204), -INT32_C(   624164867), -INT32_C(   221675229) },
+      {  INT32_C(       82628),  INT32_C(  1074925780), -INT32_C(   608174401),  INT32_C(   607752600),  INT32_C(   570425872),  INT32_C(     4194304),  INT32_C(  1069546999),  INT32_C(  1051933004),
+         INT32_C(  1593825782), -INT32_C(  1555977070), -INT32_C(  1083900335),  INT32_C(   617473349),  INT32_C(   569654257), -INT32_C(   469935523),  INT32_C(    33556516), -INT32_C(        2049) },
+      { -INT32_C(   142606609),  INT32_C(           0),  INT32_C(      788628),  INT32_C(   402784268),  INT32_C(           0),  INT32_C(           0),  INT32_C(     8389312),  INT32_C(           0),
+         INT32_C(   536879368),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      280112),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  1073776768),  INT32_C(           0),  INT32_C(   100944493),  INT32_C(    16778770),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1073831967),  INT32_C(           0),
+         INT32_C(     1082415),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    35854352),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  2147442334),  INT32_C(           0),  INT32_C(  1843396447),  INT32_C(   303876300),  INT32_C(           0),  INT32_C(           0),  INT32_C(   534773499),  INT32_C(           0),
+         INT32_C(   796912891),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   284827128),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  2147413760),  INT32_C(           0),  INT32_C(   201888987),  INT32_C(    33557540),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147303361),  INT32_C(           0),
+         INT32_C(     2164830),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    71708705),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_maskz_shldi_epi32(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x16(r0, simde_mm512_loadu_epi32(test_vec[i].r0));
+    simde__m512i r7 = simde_mm512_maskz_shldi_epi32(test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x16(r7, simde_mm512_loadu_epi32(test_vec[i].r7));
+    simde__m512i r31 = simde_mm512_maskz_shldi_epi32(test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x16(r31, simde_mm512_loadu_epi32(test_vec[i].r31));
+    simde__m512i r40 = simde_mm512_maskz_shldi_epi32(test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x16(r40, simde_mm512_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r13[8];
+    const int64_t r63[8];
+    const int64_t r72[8];
+  } test_vec[] = {
+    { { -INT64_C( 3722393368951803312),  INT64_C( 1163054879183217152),  INT64_C( 2306585042123489280), -INT64_C(       2199031645252),
+         INT64_C(       2783206440960),  INT64_C( 2210849351904181742),  INT64_C(      17592324457473), -INT64_C( 8867651390305445874) },
+      { -INT64_C( 3408724464057116062),  INT64_C( 8998191780339843007), -INT64_C(  900720509589716995),  INT64_C(   36028934458048580),
+        -INT64_C( 6927099281002201641),  INT64_C( 3452563557783463303), -INT64_C(   73188854063958017),  INT64_C( 1767948782208791771) },
+      { -INT64_C( 3722393368951803312),  INT64_C( 1163054879183217152),  INT64_C( 2306585042123489280), -INT64_C(       2199031645252),
+         INT64_C(       2783206440960),  INT64_C( 2210849351904181742),  INT64_C(      17592324457473), -INT64_C( 8867651390305445874) },
+      { -INT64_C( 1378524611283903978), -INT64_C( 9221115838923272293),  INT64_C( 6078733597043334767), -INT64_C(   18014467237904368),
+         INT64_C(   22800027164349435), -INT64_C( 3424789583722854915),  INT64_C(  144116321955626975), -INT64_C(  522027113998335215) },
+      {  INT64_C( 7519009804826217777),  INT64_C( 4499095890169921503),  INT64_C( 8773011782059917310),  INT64_C(   18014467229024290),
+         INT64_C( 5759822396353674987),  INT64_C( 1726281778891731651), -INT64_C(   36594427031979009),  INT64_C(  883974391104395885) },
+      {  INT64_C( 6297989381235036368),  INT64_C( 2594143891550765180),  INT64_C(  189960424907604211), -INT64_C(     562952101184512),
+         INT64_C(     712500848885919), -INT64_C( 5871632197525574097),  INT64_C(    4503635061113342), -INT64_C( 1169234851919294952) } },
+    { {  INT64_C( 5141439356885783966),  INT64_C( 1447218474191463998),  INT64_C(    4789567610290432),  INT64_C( 9079256846631436283),
+         INT64_C( 2186617384992853056), -INT64_C(  306526249721798917),  INT64_C( 2345326687337969132), -INT64_C( 1801580726414475265) },
+      {  INT64_C( 2962439349134835106),  INT64_C( 7449822310007951126),  INT64_C( 4656722117780382236),  INT64_C( 1315236084025655552),
+        -INT64_C(  871983392649443942), -INT64_C( 1594292575449638360), -INT64_C(  585485681183162369),  INT64_C(   20934701392921616) },
+      {  INT64_C( 5141439356885783966),  INT64_C( 1447218474191463998),  INT64_C(    4789567610290432),  INT64_C( 9079256846631436283),
+         INT64_C( 2186617384992853056), -INT64_C(  306526249721798917),  INT64_C( 2345326687337969132), -INT64_C( 1801580726414475265) },
+      {  INT64_C( 4754491329435911459), -INT64_C( 5642698818768614164),  INT64_C( 2342649716080117780), -INT64_C(      17592186084792),
+         INT64_C(  981122289477623420), -INT64_C( 2305843696477700805), -INT64_C( 8591102132709646597), -INT64_C( 1154051819740078071) },
+      {  INT64_C( 1481219674567417553),  INT64_C( 3724911155003975563),  INT64_C( 2328361058890191118), -INT64_C( 8565753994841948032),
+         INT64_C( 8787380340530053837), -INT64_C(  797146287724819180),  INT64_C( 8930629196263194623), -INT64_C( 9212904686158315000) },
+      {  INT64_C( 6489646129382530601),  INT64_C( 1553047918823751271),  INT64_C( 1226129308234350656), -INT64_C(        549755815150),
+         INT64_C( 6371728346883834099), -INT64_C( 4683743633942316055), -INT64_C( 8338922473895105289), -INT64_C(   36064119366877440) } },
+    { {  INT64_C(   18023233262583808),  INT64_C( 7477806485892887209), -INT64_C(       1116691566729), -INT64_C( 1158568957104439361),
+         INT64_C( 6217574475476926271),  INT64_C( 8214801940760137787), -INT64_C( 1211468314795049217),  INT64_C( 5911146166253439398) },
+      { -INT64_C(     308687898038289), -INT64_C( 3727508476426738336), -INT64_C(    4507997708223121), -INT64_C(  454738218672896503),
+        -INT64_C( 6997253234939761759), -INT64_C(       2474983456796), -INT64_C(   45317471272435715), -INT64_C( 3799021595303075935) },
+      {  INT64_C(   18023233262583808),  INT64_C( 7477806485892887209), -INT64_C(       1116691566729), -INT64_C( 1158568957104439361),
+         INT64_C( 6217574475476926271),  INT64_C( 8214801940760137787), -INT64_C( 1211468314795049217),  INT64_C( 5911146166253439398) },
+      {  INT64_C(   72374297410150399), -INT64_C( 3446336354888894072), -INT64_C(    9147937314635779),  INT64_C( 9076301360851844918),
+         INT64_C( 2909715594908005340),  INT64_C( 1935117814604464127), -INT64_C(     123145304408085),  INT64_C( 1406200460602562920) },
+      {  INT64_C( 9223217692905756663), -INT64_C( 1863754238213369168), -INT64_C(    2253998854111561), -INT64_C(  227369109336448252),
+        -INT64_C( 3498626617469880880), -INT64_C(       1237491728398), -INT64_C(   22658735636217858),  INT64_C( 7323861239203237840) },
+      {  INT64_C( 4613947715221455103), -INT64_C( 4142923277214242356), -INT64_C(     285873041082369), -INT64_C( 1445747839383650311),
+         INT64_C( 5279075383071686558),  INT64_C(   60472431706389503),  INT64_C( 3458760665529778175),  INT64_C(  620404516697253579) } },
+    { { -INT64_C( 2287783186274439160),  INT64_C( 4612249108000950272), -INT64_C( 5982157832980909589), -INT64_C(         68856087553),
+         INT64_C( 1651831470753252935),  INT64_C(  576742605371482112),  INT64_C(  346512524760053424), -INT64_C(    2289331452511249) },
+      { -INT64_C(         70968189953), -INT64_C( 8143174428115360144),  INT64_C(     563121761624064), -INT64_C( 2842547184663592606),
+         INT64_C(  148623736176640576), -INT64_C( 7521876425795324442), -INT64_C( 5873086212776332741),  INT64_C(   38280598982295553) },
+      { -INT64_C( 2287783186274439160),  INT64_C( 4612249108000950272), -INT64_C( 5982157832980909589), -INT64_C(         68856087553),
+         INT64_C( 1651831470753252935),  INT64_C(  576742605371482112),  INT64_C(  346512524760053424), -INT64_C(    2289331452511249) },
+      {  INT64_C(  372116928698851327),  INT64_C( 4612829786622923231),  INT64_C( 7162036066667290624), -INT64_C(     564069069227247),
+        -INT64_C( 8106741692162842558),  INT64_C( 2308940333536252659), -INT64_C( 2167984516913293873), -INT64_C(  307459185262600175) },
+      {  INT64_C( 9223372001370680831),  INT64_C( 5151784822797095736), -INT64_C( 9223090475973963776), -INT64_C( 1421273592331796303),
+        -INT64_C( 9149060168766455520),  INT64_C( 5462433823957113587),  INT64_C( 6286828930466609437), -INT64_C( 9204231737363628032) },
+      {  INT64_C( 4623314672449227007),  INT64_C(  144150930831966350), -INT64_C(  352647125220070656), -INT64_C(      17627158413352),
+        -INT64_C( 1406257182486935806),  INT64_C(   72154385423007895), -INT64_C( 3526514029974081362), -INT64_C(  586068851842879744) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_shldi_epi64(a, b, 0);
+    simde_test_x86_assert_equal_i64x8(r0, simde_mm512_loadu_epi64(test_vec[i].r0));
+    simde__m512i r13 = simde_mm512_shldi_epi64(a, b, 13);
+    simde_test_x86_assert_equal_i64x8(r13, simde_mm512_loadu_epi64(test_vec[i].r13));
+    simde__m512i r63 = simde_mm512_shldi_epi64(a, b, 63);
+    simde_test_x86_assert_equal_i64x8(r63, simde_mm512_loadu_epi64(test_vec[i].r63));
+    simde__m512i r72 = simde_mm512_shldi_epi64(a, b, 72);
+    simde_test_x86_assert_equal_i64x8(r72, simde_mm512_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r13[8];
+    const int64_t r63[8];
+    const int64_t r72[8];
+  } test_vec[] = {
+    { { -INT64_C( 5551202956678752255), -INT64_C( 3265148371221668702),  INT64_C( 8948249588434567974), -INT64_C( 3045629616753483777),
+         INT64_C( 9222808801822636030),  INT64_C( 3972429247277357791),  INT64_C( 5661406459820133563), -INT64_C( 5536098828079154514) },
+      UINT8_C( 90),
+      { -INT64_C( 2922736189696636776),  INT64_C(    5210588355493896), -INT64_C(  612526387277889537), -INT64_C( 1317926543524855714),
+         INT64_C(  851081782086602896), -INT64_C(  159877810393975138), -INT64_C(  772506604417757561),  INT64_C( 5515807285716921121) },
+      { -INT64_C(                 385),  INT64_C(    5348439029252624),  INT64_C(     351927747491328),  INT64_C( 6990468385547368757),
+        -INT64_C(       2473917943809),  INT64_C(    2286990661808128),  INT64_C( 5238325801199206815),  INT64_C(   23661490229739534) },
+      { -INT64_C( 5551202956678752255),  INT64_C(    5210588355493896),  INT64_C( 8948249588434567974), -INT64_C( 1317926543524855714),
+         INT64_C(  851081782086602896),  INT64_C( 3972429247277357791), -INT64_C(  772506604417757561), -INT64_C( 5536098828079154514) },
+      { -INT64_C( 5551202956678752255),  INT64_C( 5791651660786892802),  INT64_C( 8948249588434567974), -INT64_C( 5108961435530310624),
+        -INT64_C(  807301008759578625),  INT64_C( 3972429247277357791), -INT64_C( 1140886107893733098), -INT64_C( 5536098828079154514) },
+      { -INT64_C( 5551202956678752255),  INT64_C(    2674219514626312),  INT64_C( 8948249588434567974),  INT64_C( 3495234192773684378),
+         INT64_C( 9223370799895803903),  INT64_C( 3972429247277357791), -INT64_C( 6604209136255172401), -INT64_C( 5536098828079154514) },
+      { -INT64_C( 5551202956678752255),  INT64_C( 1333910619006437376),  INT64_C( 8948249588434567974), -INT64_C( 5347801815591133599),
+        -INT64_C( 3483992670344277761),  INT64_C( 3972429247277357791),  INT64_C( 5152494079859132232), -INT64_C( 5536098828079154514) } },
+    { {  INT64_C( 3998070569197633535), -INT64_C(            67635205), -INT64_C( 1100931191985858285),  INT64_C( 2305845827786637320),
+         INT64_C(       1374389542912), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861), -INT64_C( 1153202979584151810) },
+      UINT8_C(158),
+      { -INT64_C( 7302594513499369452), -INT64_C( 4840870286413499898),  INT64_C( 5988893184442954129), -INT64_C( 6917526828601040896),
+         INT64_C( 4701898791429611778), -INT64_C( 6468625332090901568),  INT64_C(    1126174784753670),  INT64_C( 1179960883540132864) },
+      { -INT64_C( 4147491980617822727),  INT64_C(    2815299522920472), -INT64_C( 7552795575479351375), -INT64_C( 6025911766201555158),
+        -INT64_C( 1162632494386814985), -INT64_C( 6908521278340071424), -INT64_C(  144115325582016513), -INT64_C( 8176267694008608224) },
+      {  INT64_C( 3998070569197633535), -INT64_C( 4840870286413499898),  INT64_C( 5988893184442954129), -INT64_C( 6917526828601040896),
+         INT64_C( 4701898791429611778), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C( 1179960883540132864) },
+      {  INT64_C( 3998070569197633535),  INT64_C( 4090372176144809985), -INT64_C( 7326269110727068955),  INT64_C(   18014536015549835),
+         INT64_C( 1153273485835918843), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C(  145663336963379665) },
+      {  INT64_C( 3998070569197633535),  INT64_C(    1407649761460236), -INT64_C( 3776397787739675688),  INT64_C( 6210416153753998229),
+         INT64_C( 8642055789661368315), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C( 5135238189850471696) },
+      {  INT64_C( 3998070569197633535), -INT64_C( 3330940383316015616),  INT64_C( 2076897099503473047),  INT64_C(     562954250485932),
+         INT64_C( 4647725814859760367), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C( 6922081006921187470) } },
+    { { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154),  INT64_C( 5964045263539872017),
+         INT64_C( 4611967493406195712), -INT64_C( 6963926032773492089),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      UINT8_C( 40),
+      { -INT64_C( 7671920873462703561),  INT64_C( 4000382183446714259),  INT64_C( 8934543241299098623),  INT64_C( 7616973895377652736),
+         INT64_C(  908908459573859796),  INT64_C( 1545092682474405191),  INT64_C( 2882303830244982912), -INT64_C(    2252358328255505) },
+      {  INT64_C(    9077567998951424),  INT64_C(    5242471575455753), -INT64_C(  434606162617565445), -INT64_C( 2990895181915669825),
+        -INT64_C(  594476525202440194),  INT64_C( 1233986608345255936),  INT64_C( 3260669358385212126),  INT64_C( 8579226018627543290) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154),  INT64_C( 7616973895377652736),
+         INT64_C( 4611967493406195712),  INT64_C( 1545092682474405191),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154), -INT64_C( 7085050425681896753),
+         INT64_C( 4611967493406195712),  INT64_C( 2932820265574916644),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154),  INT64_C( 7727924445896940895),
+         INT64_C( 4611967493406195712), -INT64_C( 8606378732682147840),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154), -INT64_C( 5409554596533370666),
+         INT64_C( 4611967493406195712),  INT64_C( 8162101165547144977),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) } },
+    { { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878),  INT64_C( 5275828379170050391),  INT64_C( 6028984787529573455),
+        -INT64_C( 2604490158526976065), -INT64_C( 1490559613030665393), -INT64_C(  456843814949049988),  INT64_C( 1420865128360824681) },
+      UINT8_C(188),
+      {  INT64_C(   18049583423688986),  INT64_C( 1225058332411203648), -INT64_C(             8392739),  INT64_C( 1421873324399150195),
+         INT64_C(   36338928554641536), -INT64_C(  576460752303751169),  INT64_C( 1441151897967788168),  INT64_C( 5592213067597132556) },
+      {  INT64_C( 2326953641132425224), -INT64_C(    2252366817002819), -INT64_C( 2249126809543251556),  INT64_C( 5224556120440279132),
+        -INT64_C( 3026427757530726657), -INT64_C(  288230384741662849), -INT64_C(      17598632953857),  INT64_C(  261227263935942729) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C(             8392739),  INT64_C( 1421873324399150195),
+         INT64_C(   36338928554641536), -INT64_C(  576460752303751169), -INT64_C(  456843814949049988),  INT64_C( 5592213067597132556) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C(         68753310695),  INT64_C( 8090762967111330064),
+         INT64_C( 2540597540270643903), -INT64_C(          2684354689), -INT64_C(  456843814949049988),  INT64_C( 8143914734893236340) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C( 1124563404771625778), -INT64_C( 6611093976634636242),
+         INT64_C( 7710158158089412479), -INT64_C(  144115192370831425), -INT64_C(  456843814949049988),  INT64_C(  130613631967971364) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C(          2148540960), -INT64_C( 4935310428008582328),
+        -INT64_C( 9143978363721318187), -INT64_C(            83886085), -INT64_C(  456843814949049988), -INT64_C( 7239492444479091709) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_mask_shldi_epi64(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x8(r0, simde_mm512_loadu_epi64(test_vec[i].r0));
+    simde__m512i r13 = simde_mm512_mask_shldi_epi64(src, test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x8(r13, simde_mm512_loadu_epi64(test_vec[i].r13));
+    simde__m512i r63 = simde_mm512_mask_shldi_epi64(src, test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x8(r63, simde_mm512_loadu_epi64(test_vec[i].r63));
+    simde__m512i r72 = simde_mm512_mask_shldi_epi64(src, test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x8(r72, simde_mm512_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r13[8];
+    const int64_t r63[8];
+    const int64_t r72[8];
+  } test_vec[] = {
+    { UINT8_C(119),
+      {  INT64_C( 9151314442816585725),  INT64_C( 1175439546230243841), -INT64_C( 9149907067933292480),  INT64_C(  288863698071585792),
+        -INT64_C(   36627069072916484), -INT64_C(  649925726593681425), -INT64_C( 2312669054558638113), -INT64_C( 6499639415319830425) },
+      { -INT64_C( 5882870115206168513), -INT64_C( 7998392921030127536),  INT64_C( 2306444391105429536), -INT64_C(  886021163190518507),
+        -INT64_C( 2677055790963132626),  INT64_C(  145804632822645264), -INT64_C(       1108236828705),  INT64_C( 4998262364882743087) },
+      {  INT64_C( 9151314442816585725),  INT64_C( 1175439546230243841), -INT64_C( 9149907067933292480),  INT64_C(                   0),
+        -INT64_C(   36627069072916484), -INT64_C(  649925726593681425), -INT64_C( 2312669054558638113),  INT64_C(                   0) },
+      { -INT64_C(          2147502645),  INT64_C(     356241771606560), -INT64_C( 6917529027623779328),  INT64_C(                   0),
+        -INT64_C( 4901044665979004069),  INT64_C( 6917485046622183488), -INT64_C(  578731244653903873),  INT64_C(                   0) },
+      { -INT64_C( 2941435057603084257), -INT64_C( 3999196460515063768),  INT64_C( 1153222195552714768),  INT64_C(                   0),
+         INT64_C( 7884844141373209495), -INT64_C( 9150469720443453176), -INT64_C(        554118414353),  INT64_C(                   0) },
+      { -INT64_C(            67109458),  INT64_C( 5764618655589597585),  INT64_C(  360287970190180384),  INT64_C(                   0),
+         INT64_C( 9070214391042931930), -INT64_C(  360289344596480254), -INT64_C( 1747467608305704961),  INT64_C(                   0) } },
+    { UINT8_C( 49),
+      { -INT64_C(   40813871623045633), -INT64_C(  995198114825924614), -INT64_C( 4937352566548725761),  INT64_C( 7549461407401178667),
+         INT64_C( 8117977549360464990),  INT64_C( 8677405295095357828), -INT64_C( 7633253352428970882), -INT64_C(    3588805953128515) },
+      { -INT64_C(  298364231764443137),  INT64_C( 2305878193594441769),  INT64_C(      35185445830656), -INT64_C( 3063592288224582018),
+         INT64_C( 1334474008126554124),  INT64_C( 1098147268460500966),  INT64_C(    9029189910921216),  INT64_C(  288516279239723008) },
+      { -INT64_C(   40813871623045633),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C( 8117977549360464990),  INT64_C( 8677405295095357828),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 2305843009217888389),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C( 1959698637995622992), -INT64_C( 8447482655440600601),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(  149182115882221569),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(  667237004063277062),  INT64_C(  549073634230250483),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 7998392938209869819),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C( 6279827692900295150),  INT64_C( 7806466699265410063),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 48),
+      { -INT64_C(   18014399591622665),  INT64_C( 8951841122872908289), -INT64_C(  292733998329827329),  INT64_C( 7750124949868340246),
+        -INT64_C(  290570137166152195),  INT64_C( 7177162064362822120), -INT64_C( 4765512093199763970),  INT64_C( 5908656981591673579) },
+      { -INT64_C( 4783722977209765774),  INT64_C( 5565569456272801465), -INT64_C( 7929797503969712922),  INT64_C(   96600322946248906),
+         INT64_C( 7117028465989949503),  INT64_C(   27234980732207104), -INT64_C( 1229522830446624805), -INT64_C( 2449960397386563730) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(  290570137166152195),  INT64_C( 7177162064362822120),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(  720578156586619816),  INT64_C( 5538268347897806860),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C( 5664857803859801057),  INT64_C(   13617490366103552),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(  598978819696755358), -INT64_C( 7320918894072698880),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 59),
+      { -INT64_C( 3778708736659287361), -INT64_C(    2533489538793505),  INT64_C(  216315718625985920), -INT64_C( 1232563183654309386),
+         INT64_C(   36099168179128322), -INT64_C(    9007298038997249),  INT64_C( 1357301409335842029), -INT64_C( 4730289735772946498) },
+      { -INT64_C( 6034464587309383914),  INT64_C( 9187268473040910319),  INT64_C( 8615083893727337558),  INT64_C( 2450521215984517160),
+         INT64_C(    9592150178154496), -INT64_C( 5295275991355046781), -INT64_C( 9223372033623970976), -INT64_C(  398008265289147225) },
+      { -INT64_C( 3778708736659287361), -INT64_C(    2533489538793505),  INT64_C(                   0), -INT64_C( 1232563183654309386),
+         INT64_C(   36099168179128322), -INT64_C(    9007298038997249),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 1545415028254444152), -INT64_C( 2307602228086837265),  INT64_C(                   0), -INT64_C( 6788592176977755072),
+         INT64_C(  576480544066387972), -INT64_C(     809240627251504),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 3017232293654691957), -INT64_C( 4629737800334320649),  INT64_C(                   0),  INT64_C( 1225260607992258580),
+         INT64_C(    4796075089077248), -INT64_C( 2647637995677523391),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 8118744751880880212), -INT64_C(  648573321931137153),  INT64_C(                   0), -INT64_C( 1941525762440825310),
+        -INT64_C( 9205357019852701184), -INT64_C( 2305868297983295562),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_maskz_shldi_epi64(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x8(r0, simde_mm512_loadu_epi64(test_vec[i].r0));
+    simde__m512i r13 = simde_mm512_maskz_shldi_epi64(test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x8(r13, simde_mm512_loadu_epi64(test_vec[i].r13));
+    simde__m512i r63 = simde_mm512_maskz_shldi_epi64(test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x8(r63, simde_mm512_loadu_epi64(test_vec[i].r63));
+    simde__m512i r72 = simde_mm512_maskz_shldi_epi64(test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x8(r72, simde_mm512_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shldi_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
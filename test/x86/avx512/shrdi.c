@@ -0,0 +1,2063 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN shrdi
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/shrdi.h>
+
+static int
+test_simde_mm_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r5[8];
+    const int16_t r15[8];
+    const int16_t r19[8];
+  } test_vec[] = {
+    { { -INT16_C(  4417),  INT16_C(  4608),  INT16_C( 28665),  INT16_C(     0), -INT16_C(  3275),  INT16_C( 26999), -INT16_C(  3265),  INT16_C( 21544) },
+      {  INT16_C(  6076),  INT16_C( 26537),  INT16_C(  4112),  INT16_C(  4128), -INT16_C(  3083),  INT16_C( 19992),  INT16_C( 10705),  INT16_C(  1112) },
+      { -INT16_C(  4417),  INT16_C(  4608),  INT16_C( 28665),  INT16_C(     0), -INT16_C(  3275),  INT16_C( 26999), -INT16_C(  3265),  INT16_C( 21544) },
+      { -INT16_C(  6283),  INT16_C( 18576), -INT16_C( 31873),  INT16_C(     0), -INT16_C( 20583), -INT16_C( 15541), -INT16_C( 28775), -INT16_C( 15711) },
+      {  INT16_C( 12153), -INT16_C( 12462),  INT16_C(  8224),  INT16_C(  8256), -INT16_C(  6165), -INT16_C( 25552),  INT16_C( 21411),  INT16_C(  2224) },
+      { -INT16_C( 25129),  INT16_C(  8768),  INT16_C(  3583),  INT16_C(     0), -INT16_C( 16794),  INT16_C(  3374),  INT16_C( 15975),  INT16_C(  2693) } },
+    { {  INT16_C(     0),  INT16_C(     1),  INT16_C(   830),  INT16_C(  4672),  INT16_C(     1), -INT16_C( 32631), -INT16_C( 22044),  INT16_C(   128) },
+      { -INT16_C( 19457),  INT16_C(    16), -INT16_C(     3),       INT16_MAX,  INT16_C(  6464), -INT16_C(    13),  INT16_C( 32251), -INT16_C(  7460) },
+      {  INT16_C(     0),  INT16_C(     1),  INT16_C(   830),  INT16_C(  4672),  INT16_C(     1), -INT16_C( 32631), -INT16_C( 22044),  INT16_C(   128) },
+      { -INT16_C(  2048),       INT16_MIN, -INT16_C(  6119), -INT16_C(  1902),  INT16_C(     0), -INT16_C( 25596), -INT16_C(  8881), -INT16_C(  8188) },
+      {  INT16_C( 26622),  INT16_C(    32), -INT16_C(     6), -INT16_C(     2),  INT16_C( 12928), -INT16_C(    25), -INT16_C(  1033), -INT16_C( 14920) },
+      { -INT16_C(  8192),  INT16_C(     0), -INT16_C( 24473), -INT16_C(  7608),  INT16_C(     0),  INT16_C( 28689),  INT16_C( 30012), -INT16_C( 32752) } },
+    { { -INT16_C( 20409),  INT16_C(  4102),  INT16_C( 29018),  INT16_C(   768), -INT16_C(  6594),  INT16_C( 25824),  INT16_C(   238),  INT16_C(  6009) },
+      {  INT16_C( 20915), -INT16_C(     1), -INT16_C(   640),  INT16_C( 24915), -INT16_C(  8193), -INT16_C(     1),  INT16_C(  1322),  INT16_C(  2066) },
+      { -INT16_C( 20409),  INT16_C(  4102),  INT16_C( 29018),  INT16_C(   768), -INT16_C(  6594),  INT16_C( 25824),  INT16_C(   238),  INT16_C(  6009) },
+      { -INT16_C( 25214), -INT16_C(  1920),  INT16_C(   906), -INT16_C( 26600), -INT16_C(   207), -INT16_C(  1241),  INT16_C( 20487), -INT16_C( 28485) },
+      { -INT16_C( 23705), -INT16_C(     2), -INT16_C(  1280), -INT16_C( 15706), -INT16_C( 16385), -INT16_C(     2),  INT16_C(  2644),  INT16_C(  4132) },
+      {  INT16_C( 30216), -INT16_C(  7680),  INT16_C(  3627),  INT16_C( 24672), -INT16_C(   825), -INT16_C(  4964),  INT16_C( 16413),  INT16_C( 17135) } },
+    { { -INT16_C( 12275), -INT16_C( 24234), -INT16_C(  2063), -INT16_C(  6273),  INT16_C(   419),  INT16_C( 17997), -INT16_C(   130),  INT16_C(  5572) },
+      {  INT16_C( 23519), -INT16_C(     1),  INT16_C(  2585),  INT16_C( 24576),  INT16_C(  8800), -INT16_C( 32616), -INT16_C(  4203), -INT16_C(     5) },
+      { -INT16_C( 12275), -INT16_C( 24234), -INT16_C(  2063), -INT16_C(  6273),  INT16_C(   419),  INT16_C( 17997), -INT16_C(   130),  INT16_C(  5572) },
+      { -INT16_C(   384), -INT16_C(   758), -INT16_C( 12353),  INT16_C(  1851),  INT16_C(    13), -INT16_C( 15822), -INT16_C( 20485), -INT16_C( 10066) },
+      { -INT16_C( 18497), -INT16_C(     1),  INT16_C(  5171), -INT16_C( 16383),  INT16_C( 17600),  INT16_C(   304), -INT16_C(  8405), -INT16_C(    10) },
+      { -INT16_C(  1535), -INT16_C(  3030),  INT16_C( 16126),  INT16_C(  7407),  INT16_C(    52),  INT16_C(  2249), -INT16_C( 16401),  INT16_C( 25272) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r0 = simde_mm_shrdi_epi16(a, b, 0);
+    simde_test_x86_assert_equal_i16x8(r0, simde_x_mm_loadu_epi16(test_vec[i].r0));
+    simde__m128i r5 = simde_mm_shrdi_epi16(a, b, 5);
+    simde_test_x86_assert_equal_i16x8(r5, simde_x_mm_loadu_epi16(test_vec[i].r5));
+    simde__m128i r15 = simde_mm_shrdi_epi16(a, b, 15);
+    simde_test_x86_assert_equal_i16x8(r15, simde_x_mm_loadu_epi16(test_vec[i].r15));
+    simde__m128i r19 = simde_mm_shrdi_epi16(a, b, 19);
+    simde_test_x86_assert_equal_i16x8(r19, simde_x_mm_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r5[8];
+    const int16_t r15[8];
+    const int16_t r19[8];
+  } test_vec[] = {
+    { {  INT16_C( 21529),  INT16_C(  8192),  INT16_C(  2112),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112), -INT16_C(   545), -INT16_C( 21656) },
+      UINT8_C( 70),
+      {  INT16_C(     0),  INT16_C( 29127), -INT16_C(  4266),  INT16_C(  9218), -INT16_C(  8196), -INT16_C( 19386),  INT16_C( 10371), -INT16_C(  2049) },
+      { -INT16_C( 24833),  INT16_C( 28291), -INT16_C( 14184), -INT16_C( 17666),  INT16_C(   128),  INT16_C(   289), -INT16_C( 15214),  INT16_C( 17226) },
+      {  INT16_C( 21529),  INT16_C( 29127), -INT16_C(  4266),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112),  INT16_C( 10371), -INT16_C( 21656) },
+      {  INT16_C( 21529),  INT16_C(  7054), -INT16_C( 14470),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112), -INT16_C( 28348), -INT16_C( 21656) },
+      {  INT16_C( 21529), -INT16_C(  8954), -INT16_C( 28367),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112), -INT16_C( 30428), -INT16_C( 21656) },
+      {  INT16_C( 21529),  INT16_C( 28216),  INT16_C(  7658),  INT16_C( 12258),       INT16_MAX,  INT16_C(  2112),  INT16_C( 17680), -INT16_C( 21656) } },
+    { { -INT16_C(  8822),  INT16_C(     0),  INT16_C(     2),  INT16_C(   256), -INT16_C( 18408),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      UINT8_C( 30),
+      { -INT16_C( 23350), -INT16_C(    69),  INT16_C(   514),  INT16_C( 11613), -INT16_C(    35),  INT16_C(  8287), -INT16_C(    33), -INT16_C( 13568) },
+      {  INT16_C(   128), -INT16_C( 12154),  INT16_C( 13317),  INT16_C(  1552), -INT16_C(  3329), -INT16_C(  1861),  INT16_C( 23917),  INT16_C(   640) },
+      { -INT16_C(  8822), -INT16_C(    69),  INT16_C(   514),  INT16_C( 11613), -INT16_C(    35),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      { -INT16_C(  8822),  INT16_C( 14333),  INT16_C( 10256), -INT16_C( 32406), -INT16_C(     2),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      { -INT16_C(  8822), -INT16_C( 24307),  INT16_C( 26634),  INT16_C(  3104), -INT16_C(  6657),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) },
+      { -INT16_C(  8822), -INT16_C(  8201), -INT16_C( 24512),  INT16_C(  1451), -INT16_C(     5),  INT16_C(  2564), -INT16_C( 31716),  INT16_C(   768) } },
+    { {  INT16_C( 14874),  INT16_C(  9540), -INT16_C( 13072),  INT16_C( 20335),  INT16_C( 32255),  INT16_C(  8225), -INT16_C(  2053),  INT16_C( 30671) },
+      UINT8_C(213),
+      {  INT16_C(   129),  INT16_C( 16321),  INT16_C( 24367), -INT16_C( 32447),  INT16_C(  4098), -INT16_C( 27599), -INT16_C( 10613),  INT16_C( 32747) },
+      {  INT16_C(   529),  INT16_C(  5413), -INT16_C(   258), -INT16_C(  8257),  INT16_C( 32639),  INT16_C(   128), -INT16_C(  5297),  INT16_C( 28719) },
+      {  INT16_C(   129),  INT16_C(  9540),  INT16_C( 24367),  INT16_C( 20335),  INT16_C(  4098),  INT16_C(  8225), -INT16_C( 10613),  INT16_C( 32747) },
+      { -INT16_C( 30716),  INT16_C(  9540), -INT16_C(  3335),  INT16_C( 20335), -INT16_C(  1920),  INT16_C(  8225),  INT16_C( 32436),  INT16_C( 31743) },
+      {  INT16_C(  1058),  INT16_C(  9540), -INT16_C(   516),  INT16_C( 20335), -INT16_C(   258),  INT16_C(  8225), -INT16_C( 10593), -INT16_C(  8098) },
+      {  INT16_C(  8208),  INT16_C(  9540), -INT16_C( 13339),  INT16_C( 20335), -INT16_C(  7680),  INT16_C(  8225), -INT16_C(  1327), -INT16_C(  4099) } },
+    { {  INT16_C( 15027), -INT16_C(     3),  INT16_C(  7156),  INT16_C( 16514), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C( 27286) },
+      UINT8_C(140),
+      {  INT16_C(  9795), -INT16_C( 22262), -INT16_C(  1892),  INT16_C(    64),  INT16_C( 14279),  INT16_C(   256),  INT16_C(   512),  INT16_C(  2056) },
+      {  INT16_C(  8208),  INT16_C(  8272),  INT16_C(  1025), -INT16_C( 23511), -INT16_C(  2517),  INT16_C( 14258), -INT16_C(  4369), -INT16_C(  2923) },
+      {  INT16_C( 15027), -INT16_C(     3), -INT16_C(  1892),  INT16_C(    64), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037),  INT16_C(  2056) },
+      {  INT16_C( 15027), -INT16_C(     3),  INT16_C(  4036),  INT16_C( 18434), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037), -INT16_C( 22464) },
+      {  INT16_C( 15027), -INT16_C(     3),  INT16_C(  2051),  INT16_C( 18514), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037), -INT16_C(  5846) },
+      {  INT16_C( 15027), -INT16_C(     3),  INT16_C( 16147),  INT16_C(  8200), -INT16_C(  8193),  INT16_C(  4634),  INT16_C( 29037), -INT16_C( 24319) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r0 = simde_mm_mask_shrdi_epi16(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x8(r0, simde_x_mm_loadu_epi16(test_vec[i].r0));
+    simde__m128i r5 = simde_mm_mask_shrdi_epi16(src, test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x8(r5, simde_x_mm_loadu_epi16(test_vec[i].r5));
+    simde__m128i r15 = simde_mm_mask_shrdi_epi16(src, test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x8(r15, simde_x_mm_loadu_epi16(test_vec[i].r15));
+    simde__m128i r19 = simde_mm_mask_shrdi_epi16(src, test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x8(r19, simde_x_mm_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r5[8];
+    const int16_t r15[8];
+    const int16_t r19[8];
+  } test_vec[] = {
+    { UINT8_C(193),
+      { -INT16_C( 32702), -INT16_C(  2579), -INT16_C(  1669),  INT16_C(     0),  INT16_C(     1),  INT16_C( 22483),  INT16_C(   537),  INT16_C( 31020) },
+      {  INT16_C(  6705),  INT16_C(  4863), -INT16_C(  2635), -INT16_C(  5123), -INT16_C(    66),  INT16_C(  4384),  INT16_C( 26392), -INT16_C( 11718) },
+      { -INT16_C( 32702),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   537),  INT16_C( 31020) },
+      { -INT16_C( 29694),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16368), -INT16_C( 11319) },
+      {  INT16_C( 13411),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12752), -INT16_C( 23436) },
+      {  INT16_C( 12296),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    67),  INT16_C( 20261) } },
+    { UINT8_C( 55),
+      { -INT16_C(  6831), -INT16_C( 16384), -INT16_C( 24576), -INT16_C(  3036), -INT16_C( 18441), -INT16_C( 28718), -INT16_C(   129), -INT16_C( 24822) },
+      { -INT16_C( 16385), -INT16_C(  1025), -INT16_C(     1), -INT16_C(   320), -INT16_C(  8418), -INT16_C( 32703),       INT16_MAX,  INT16_C(     4) },
+      { -INT16_C(  6831), -INT16_C( 16384), -INT16_C( 24576),  INT16_C(     0), -INT16_C( 18441), -INT16_C( 28718),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(   214), -INT16_C(   512), -INT16_C(   768),  INT16_C(     0), -INT16_C(  2625),  INT16_C(  3198),  INT16_C(     0),  INT16_C(     0) },
+      {       INT16_MAX, -INT16_C(  2049), -INT16_C(     1),  INT16_C(     0), -INT16_C( 16835),  INT16_C(   131),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(   854), -INT16_C(  2048), -INT16_C(  3072),  INT16_C(     0), -INT16_C( 10498),  INT16_C( 12794),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 78),
+      { -INT16_C( 16423),  INT16_C( 14408), -INT16_C(   487), -INT16_C(  5761), -INT16_C(  1132),  INT16_C(   640),  INT16_C(   272), -INT16_C( 28654) },
+      {  INT16_C( 31612), -INT16_C(   577),  INT16_C(  2084),  INT16_C( 17975), -INT16_C( 20739), -INT16_C( 24081),  INT16_C(    52),  INT16_C(     2) },
+      {  INT16_C(     0),  INT16_C( 14408), -INT16_C(   487), -INT16_C(  5761),  INT16_C(     0),  INT16_C(     0),  INT16_C(   272),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  1598),  INT16_C( 10224), -INT16_C( 16565),  INT16_C(     0),  INT16_C(     0), -INT16_C( 24568),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  1154),  INT16_C(  4169), -INT16_C( 29585),  INT16_C(     0),  INT16_C(     0),  INT16_C(   104),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  6391), -INT16_C( 24637), -INT16_C(   721),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32734),  INT16_C(     0) } },
+    { UINT8_C(149),
+      { -INT16_C( 21002), -INT16_C( 14686), -INT16_C( 29125), -INT16_C( 24769), -INT16_C(   297),  INT16_C(   256), -INT16_C(   258), -INT16_C( 22540) },
+      { -INT16_C( 20748),  INT16_C( 15974),  INT16_C(   388),  INT16_C(     0), -INT16_C(  4331), -INT16_C(  9169),  INT16_C(  4153),  INT16_C(  2188) },
+      { -INT16_C( 21002),  INT16_C(     0), -INT16_C( 29125),  INT16_C(     0), -INT16_C(   297),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22540) },
+      { -INT16_C( 23185),  INT16_C(     0),  INT16_C(  9329),  INT16_C(     0), -INT16_C( 20490),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25919) },
+      {  INT16_C( 24041),  INT16_C(     0),  INT16_C(   777),  INT16_C(     0), -INT16_C(  8661),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4377) },
+      { -INT16_C( 27202),  INT16_C(     0), -INT16_C( 28217),  INT16_C(     0), -INT16_C( 16422),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27394) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r0 = simde_mm_maskz_shrdi_epi16(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x8(r0, simde_x_mm_loadu_epi16(test_vec[i].r0));
+    simde__m128i r5 = simde_mm_maskz_shrdi_epi16(test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x8(r5, simde_x_mm_loadu_epi16(test_vec[i].r5));
+    simde__m128i r15 = simde_mm_maskz_shrdi_epi16(test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x8(r15, simde_x_mm_loadu_epi16(test_vec[i].r15));
+    simde__m128i r19 = simde_mm_maskz_shrdi_epi16(test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x8(r19, simde_x_mm_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r7[4];
+    const int32_t r31[4];
+    const int32_t r40[4];
+  } test_vec[] = {
+    { {  INT32_C(    53852042),  INT32_C(     4227072), -INT32_C(   465897233), -INT32_C(         769) },
+      { -INT32_C(         529), -INT32_C(     1049605),  INT32_C(        8208),  INT32_C(  1089682283) },
+      {  INT32_C(    53852042),  INT32_C(     4227072), -INT32_C(   465897233), -INT32_C(         769) },
+      { -INT32_C(   570004625), -INT32_C(   167739136),  INT32_C(   566785521), -INT32_C(   671088647) },
+      { -INT32_C(        1058), -INT32_C(     2099210),  INT32_C(       16417), -INT32_C(  2115602729) },
+      { -INT32_C(   285002313), -INT32_C(    83869568),  INT32_C(   283392760),  INT32_C(  1811939324) } },
+    { {  INT32_C(      196624),  INT32_C(  1082895334), -INT32_C(     1437238),  INT32_C(   869050994) },
+      { -INT32_C(  2147483640),  INT32_C(   281018368),  INT32_C(   398418030),  INT32_C(    68227592) },
+      {  INT32_C(      196624),  INT32_C(  1082895334), -INT32_C(     1437238),  INT32_C(   869050994) },
+      {  INT32_C(   268436992),  INT32_C(     8460119), -INT32_C(   570436573),  INT32_C(   275224916) },
+      {  INT32_C(          16),  INT32_C(   562036736),  INT32_C(   796836061),  INT32_C(   136455184) },
+      {  INT32_C(   134218496),  INT32_C(     4230059),  INT32_C(  1862265361),  INT32_C(   137612458) } },
+    { {  INT32_C(  1212248946),  INT32_C(  1135685454), -INT32_C(  2011157187), -INT32_C(   680370993) },
+      { -INT32_C(   925576020), -INT32_C(   528220150),  INT32_C(   286136966),  INT32_C(    75497736) },
+      {  INT32_C(  1212248946),  INT32_C(  1135685454), -INT32_C(  2011157187), -INT32_C(   680370993) },
+      {  INT32_C(  1485865702),  INT32_C(   344416862),  INT32_C(   219168858),  INT32_C(   296674489) },
+      { -INT32_C(  1851152040), -INT32_C(  1056440300),  INT32_C(   572273933),  INT32_C(   150995473) },
+      { -INT32_C(  1404550797),  INT32_C(   172208431), -INT32_C(  2037899219),  INT32_C(   148337244) } },
+    { { -INT32_C(  2062974952), -INT32_C(     1052707),  INT32_C(  1970272255),  INT32_C(    41945153) },
+      { -INT32_C(   553664521), -INT32_C(  1075314817), -INT32_C(   311753775),  INT32_C(  1126662163) },
+      { -INT32_C(  2062974952), -INT32_C(     1052707),  INT32_C(  1970272255),  INT32_C(    41945153) },
+      { -INT32_C(   284552448), -INT32_C(        8225), -INT32_C(  1561665553),  INT32_C(   637861904) },
+      { -INT32_C(  1107329041),  INT32_C(  2144337663), -INT32_C(   623507550), -INT32_C(  2041642970) },
+      { -INT32_C(   142276224),  INT32_C(  2147479535), -INT32_C(   780832777),  INT32_C(   318930952) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r0 = simde_mm_shrdi_epi32(a, b, 0);
+    simde_test_x86_assert_equal_i32x4(r0, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    simde__m128i r7 = simde_mm_shrdi_epi32(a, b, 7);
+    simde_test_x86_assert_equal_i32x4(r7, simde_x_mm_loadu_epi32(test_vec[i].r7));
+    simde__m128i r31 = simde_mm_shrdi_epi32(a, b, 31);
+    simde_test_x86_assert_equal_i32x4(r31, simde_x_mm_loadu_epi32(test_vec[i].r31));
+    simde__m128i r40 = simde_mm_shrdi_epi32(a, b, 40);
+    simde_test_x86_assert_equal_i32x4(r40, simde_x_mm_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r7[4];
+    const int32_t r31[4];
+    const int32_t r40[4];
+  } test_vec[] = {
+    { { -INT32_C(  1021937721),  INT32_C(  1610530683), -INT32_C(   272728099), -INT32_C(      262277) },
+      UINT8_C(183),
+      { -INT32_C(   329705193), -INT32_C(   707335039), -INT32_C(     4722177), -INT32_C(   159373473) },
+      {  INT32_C(   395273988),  INT32_C(           2), -INT32_C(   541065217), -INT32_C(   749336017) },
+      { -INT32_C(   329705193), -INT32_C(   707335039), -INT32_C(     4722177), -INT32_C(      262277) },
+      {  INT32_C(   165196338),  INT32_C(    95137241), -INT32_C(       36893), -INT32_C(      262277) },
+      {  INT32_C(   790547977),  INT32_C(           5), -INT32_C(  1082130433), -INT32_C(      262277) },
+      {  INT32_C(    82598169),  INT32_C(    47568620), -INT32_C(       18447), -INT32_C(      262277) } },
+    { { -INT32_C(      411681),  INT32_C(   595824586),  INT32_C(    84017552), -INT32_C(   811577883) },
+      UINT8_C(183),
+      { -INT32_C(   402661379), -INT32_C(  1566067201), -INT32_C(  1300164558), -INT32_C(   704067697) },
+      { -INT32_C(   189633496),  INT32_C(   221399437),  INT32_C(  2146856958), -INT32_C(  1107296273) },
+      { -INT32_C(   402661379), -INT32_C(  1566067201), -INT32_C(  1300164558), -INT32_C(   811577883) },
+      {  INT32_C(  1372585919),  INT32_C(   457527147), -INT32_C(    43711968), -INT32_C(   811577883) },
+      { -INT32_C(   379266991),  INT32_C(   442798875), -INT32_C(     1253379), -INT32_C(   811577883) },
+      {  INT32_C(   686292959), -INT32_C(  1918720075), -INT32_C(    21855984), -INT32_C(   811577883) } },
+    { { -INT32_C(     8650753), -INT32_C(  2138501110),  INT32_C(   152762703), -INT32_C(  1879048176) },
+      UINT8_C( 29),
+      {  INT32_C(  1552834782), -INT32_C(     2097158), -INT32_C(  1255743564),  INT32_C(     7720560) },
+      {            INT32_MIN,  INT32_C(    33554436),  INT32_C(      788992),  INT32_C(  1333786617) },
+      {  INT32_C(  1552834782), -INT32_C(  2138501110), -INT32_C(  1255743564),  INT32_C(     7720560) },
+      {  INT32_C(    12131521), -INT32_C(  2138501110),  INT32_C(    23743935), -INT32_C(   234820708) },
+      {  INT32_C(           0), -INT32_C(  2138501110),  INT32_C(     1577985), -INT32_C(  1627394062) },
+      {  INT32_C(     6065760), -INT32_C(  2138501110),  INT32_C(    11871967), -INT32_C(   117410354) } },
+    { { -INT32_C(  2080306176),  INT32_C(   277088384), -INT32_C(    67518499),  INT32_C(   202878502) },
+      UINT8_C(101),
+      {  INT32_C(  1615198232),  INT32_C(   323454800),  INT32_C(     1089536),  INT32_C(  1616939545) },
+      { -INT32_C(  1342177793), -INT32_C(    46173196), -INT32_C(      331922), -INT32_C(  1405209659) },
+      {  INT32_C(  1615198232),  INT32_C(   277088384),  INT32_C(     1089536),  INT32_C(   202878502) },
+      { -INT32_C(    20935696),  INT32_C(   277088384), -INT32_C(   603971264),  INT32_C(   202878502) },
+      {  INT32_C(  1610611710),  INT32_C(   277088384), -INT32_C(      663844),  INT32_C(   202878502) },
+      { -INT32_C(    10467848),  INT32_C(   277088384),  INT32_C(  1845498016),  INT32_C(   202878502) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r0 = simde_mm_mask_shrdi_epi32(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x4(r0, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    simde__m128i r7 = simde_mm_mask_shrdi_epi32(src, test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x4(r7, simde_x_mm_loadu_epi32(test_vec[i].r7));
+    simde__m128i r31 = simde_mm_mask_shrdi_epi32(src, test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x4(r31, simde_x_mm_loadu_epi32(test_vec[i].r31));
+    simde__m128i r40 = simde_mm_mask_shrdi_epi32(src, test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x4(r40, simde_x_mm_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r7[4];
+    const int32_t r31[4];
+    const int32_t r40[4];
+  } test_vec[] = {
+    { UINT8_C( 33),
+      {  INT32_C(   411172864),  INT32_C(   900618222), -INT32_C(  1239444156),  INT32_C(   134480048) },
+      {  INT32_C(   982776018),  INT32_C(   268701696), -INT32_C(   716308339), -INT32_C(  2066763552) },
+      {  INT32_C(   411172864),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  1540291584),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  1965552036),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   770145792),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 97),
+      {  INT32_C(  1485107419),  INT32_C(  1552334443), -INT32_C(  1877999584), -INT32_C(   134381570) },
+      { -INT32_C(   570434058), -INT32_C(        1027),  INT32_C(  1845872620),  INT32_C(  1406834886) },
+      {  INT32_C(  1485107419),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   323941919),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  1140868116),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   161970960),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 92),
+      { -INT32_C(  1914910800), -INT32_C(       65794),  INT32_C(  1076240896), -INT32_C(     5275785) },
+      {  INT32_C(   983936471), -INT32_C(  1080330590),  INT32_C(  1082392609), -INT32_C(     8388737) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1076240896), -INT32_C(     5275785) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1115704388), -INT32_C(       41218) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  2130182078), -INT32_C(    16777473) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   557852194),  INT32_C(  2147463039) } },
+    { UINT8_C(199),
+      {  INT32_C(     8388864),  INT32_C(      541696),  INT32_C(           2),  INT32_C(        1100) },
+      { -INT32_C(    67764225),  INT32_C(  2054310575),  INT32_C(     8389714),  INT32_C(        2688) },
+      {  INT32_C(     8388864),  INT32_C(      541696),  INT32_C(           2),  INT32_C(           0) },
+      { -INT32_C(    33488894),  INT32_C(  1577062536), -INT32_C(  1543503872),  INT32_C(           0) },
+      { -INT32_C(   135528450), -INT32_C(   186346146),  INT32_C(    16779428),  INT32_C(           0) },
+      { -INT32_C(    16744447), -INT32_C(  1358952380),  INT32_C(  1375731712),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r0 = simde_mm_maskz_shrdi_epi32(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x4(r0, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    simde__m128i r7 = simde_mm_maskz_shrdi_epi32(test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x4(r7, simde_x_mm_loadu_epi32(test_vec[i].r7));
+    simde__m128i r31 = simde_mm_maskz_shrdi_epi32(test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x4(r31, simde_x_mm_loadu_epi32(test_vec[i].r31));
+    simde__m128i r40 = simde_mm_maskz_shrdi_epi32(test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x4(r40, simde_x_mm_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r13[2];
+    const int64_t r63[2];
+    const int64_t r72[2];
+  } test_vec[] = {
+    { { -INT64_C(  900274069877448275), -INT64_C( 1276925047256958808) },
+      {  INT64_C( 4600959125504097979),  INT64_C( 6042257448177895128) },
+      { -INT64_C(  900274069877448275), -INT64_C( 1276925047256958808) },
+      { -INT64_C(  729693036371065939),  INT64_C( 3947249198750682009) },
+      {  INT64_C( 9201918251008195959), -INT64_C( 6362229177353761359) },
+      { -INT64_C( 4903433090164558431), -INT64_C( 2815234155945037000) } },
+    { {  INT64_C( 4616225938982830336),  INT64_C( 6694283299646965900) },
+      {  INT64_C( 5294262319115977614),  INT64_C( 8470272515974221267) },
+      {  INT64_C( 4616225938982830336),  INT64_C( 6694283299646965900) },
+      {  INT64_C( 2049701334596517920),  INT64_C( 7969936713886444108) },
+      { -INT64_C( 7858219435477596388), -INT64_C( 1506199041761109082) },
+      { -INT64_C( 8196533587749633023), -INT64_C( 3216442187567511160) } },
+    { {  INT64_C( 5190433914216551640), -INT64_C(     738873970786465) },
+      { -INT64_C(   45317471250415681),  INT64_C( 5453957155436318841) },
+      {  INT64_C( 5190433914216551640), -INT64_C(     738873970786465) },
+      { -INT64_C(  145733389999622108), -INT64_C( 8948652549779752065) },
+      { -INT64_C(   90634942500831362), -INT64_C( 7538829762836913933) },
+      { -INT64_C( 4663468479987907436),  INT64_C( 8791023586400759807) } },
+    { {  INT64_C( 7133001015851449933),  INT64_C( 9207616568841655251) },
+      { -INT64_C( 5847639606988294940), -INT64_C( 2305895785772369409) },
+      {  INT64_C( 7133001015851449933),  INT64_C( 9207616568841655251) },
+      { -INT64_C( 6403247942457777509), -INT64_C( 3459892337002287498) },
+      {  INT64_C( 6751464859732961736), -INT64_C( 4611791571544738818) },
+      { -INT64_C( 1989749347843812482), -INT64_C(   36090341815890221) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r0 = simde_mm_shrdi_epi64(a, b, 0);
+    simde_test_x86_assert_equal_i64x2(r0, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    simde__m128i r13 = simde_mm_shrdi_epi64(a, b, 13);
+    simde_test_x86_assert_equal_i64x2(r13, simde_x_mm_loadu_epi64(test_vec[i].r13));
+    simde__m128i r63 = simde_mm_shrdi_epi64(a, b, 63);
+    simde_test_x86_assert_equal_i64x2(r63, simde_x_mm_loadu_epi64(test_vec[i].r63));
+    simde__m128i r72 = simde_mm_shrdi_epi64(a, b, 72);
+    simde_test_x86_assert_equal_i64x2(r72, simde_x_mm_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r13[2];
+    const int64_t r63[2];
+    const int64_t r72[2];
+  } test_vec[] = {
+    { {  INT64_C(   73324240023060480),  INT64_C( 2305878193653284864) },
+      UINT8_C(199),
+      {  INT64_C(  892333193249821773),  INT64_C( 4185268267097574617) },
+      { -INT64_C(        824633720833),  INT64_C( 1825346250189948153) },
+      {  INT64_C(  892333193249821773),  INT64_C( 4185268267097574617) },
+      { -INT64_C(    2142872421931120),  INT64_C( 2867052059826581638) },
+      { -INT64_C(       1649267441666),  INT64_C( 3650692500379896306) },
+      { -INT64_C(   68571917501795820), -INT64_C(  488054454097145652) } },
+    { { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      UINT8_C(124),
+      {  INT64_C(  308040993149046597),  INT64_C( 4250359746092252472) },
+      { -INT64_C( 4630865899329486851),  INT64_C( 2586547524296485037) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) },
+      { -INT64_C( 2305860603547224065), -INT64_C( 4613937818376603665) } },
+    { { -INT64_C(    1125899908939777), -INT64_C( 6809121278853706553) },
+      UINT8_C(230),
+      { -INT64_C(     563259329511937),  INT64_C(     147336722387136) },
+      { -INT64_C( 2748922581925095278),  INT64_C( 5130046208865553324) },
+      { -INT64_C(    1125899908939777),  INT64_C(     147336722387136) },
+      { -INT64_C(    1125899908939777),  INT64_C( 6728377861276960768) },
+      { -INT64_C(    1125899908939777), -INT64_C( 8186651655978444968) },
+      { -INT64_C(    1125899908939777), -INT64_C( 6052837323651874800) } },
+    { {  INT64_C(    2286993379819776), -INT64_C( 6447303931077666020) },
+      UINT8_C( 31),
+      { -INT64_C(       1108135903234),  INT64_C(   56298298172023809) },
+      { -INT64_C(     633426072305665), -INT64_C( 5016506412408516886) },
+      { -INT64_C(       1108135903234),  INT64_C(   56298298172023809) },
+      { -INT64_C(           135270497),  INT64_C( 8597378561001127941) },
+      { -INT64_C(    1266852144611329),  INT64_C( 8413731248892517844) },
+      { -INT64_C(          4328655873), -INT64_C( 1585047153607180124) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r0 = simde_mm_mask_shrdi_epi64(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x2(r0, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    simde__m128i r13 = simde_mm_mask_shrdi_epi64(src, test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x2(r13, simde_x_mm_loadu_epi64(test_vec[i].r13));
+    simde__m128i r63 = simde_mm_mask_shrdi_epi64(src, test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x2(r63, simde_x_mm_loadu_epi64(test_vec[i].r63));
+    simde__m128i r72 = simde_mm_mask_shrdi_epi64(src, test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x2(r72, simde_x_mm_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r13[2];
+    const int64_t r63[2];
+    const int64_t r72[2];
+  } test_vec[] = {
+    { UINT8_C(200),
+      {  INT64_C( 3639061855255684559), -INT64_C( 1445296953154926061) },
+      { -INT64_C( 7215604875077074154),  INT64_C( 7321966304620590139) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(125),
+      {  INT64_C( 3053102659216256493),  INT64_C(  771011520021587929) },
+      { -INT64_C(  155462156870623425),  INT64_C(       1374389534720) },
+      {  INT64_C( 3053102659216256493),  INT64_C(                   0) },
+      { -INT64_C(  434224670845547755),  INT64_C(                   0) },
+      { -INT64_C(  310924313741246850),  INT64_C(                   0) },
+      {  INT64_C( 4551554606652023469),  INT64_C(                   0) } },
+    { UINT8_C(220),
+      { -INT64_C( 3882115141215913292),  INT64_C( 9187272853643067391) },
+      {  INT64_C( 6047006599553610807), -INT64_C( 5698450579961475866) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(183),
+      {  INT64_C( 8069887582293721087),  INT64_C(   36592039603733512) },
+      { -INT64_C( 4970897121225156545),  INT64_C( 9223371950686985951) },
+      {  INT64_C( 8069887582293721087),  INT64_C(   36592039603733512) },
+      { -INT64_C( 4468837536466206817), -INT64_C(  650765679353327232) },
+      {  INT64_C( 8504949831259238526), -INT64_C(        172335579714) },
+      {  INT64_C( 4571151422757794815), -INT64_C( 2377757665596919804) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r0 = simde_mm_maskz_shrdi_epi64(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x2(r0, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    simde__m128i r13 = simde_mm_maskz_shrdi_epi64(test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x2(r13, simde_x_mm_loadu_epi64(test_vec[i].r13));
+    simde__m128i r63 = simde_mm_maskz_shrdi_epi64(test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x2(r63, simde_x_mm_loadu_epi64(test_vec[i].r63));
+    simde__m128i r72 = simde_mm_maskz_shrdi_epi64(test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x2(r72, simde_x_mm_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r0[16];
+    const int16_t r5[16];
+    const int16_t r15[16];
+    const int16_t r19[16];
+  } test_vec[] = {
+    { {  INT16_C(     0), -INT16_C(   129), -INT16_C(  8328),  INT16_C(  7154), -INT16_C( 15433),  INT16_C( 18311), -INT16_C( 19110),  INT16_C(  4879),
+        -INT16_C(     1),  INT16_C( 10682), -INT16_C( 12356),  INT16_C(  1024),  INT16_C( 16469),  INT16_C(   146),  INT16_C( 12589), -INT16_C(  8323) },
+      { -INT16_C(  2414),  INT16_C(    64),  INT16_C(  2050), -INT16_C(  1025),  INT16_C(    72),  INT16_C( 16460), -INT16_C(  2089),  INT16_C(  1024),
+         INT16_C(  8054), -INT16_C( 21169),  INT16_C( 32573), -INT16_C( 17425), -INT16_C( 10210), -INT16_C( 31744), -INT16_C( 13498), -INT16_C( 17187) },
+      {  INT16_C(     0), -INT16_C(   129), -INT16_C(  8328),  INT16_C(  7154), -INT16_C( 15433),  INT16_C( 18311), -INT16_C( 19110),  INT16_C(  4879),
+        -INT16_C(     1),  INT16_C( 10682), -INT16_C( 12356),  INT16_C(  1024),  INT16_C( 16469),  INT16_C(   146),  INT16_C( 12589), -INT16_C(  8323) },
+      { -INT16_C( 28672),  INT16_C(  2043),  INT16_C(  5883), -INT16_C(  1825),  INT16_C( 17949),  INT16_C( 25148), -INT16_C( 16982),  INT16_C(   152),
+        -INT16_C( 18433),  INT16_C( 31053), -INT16_C(  4483),  INT16_C( 30752), -INT16_C(  3582),  INT16_C(     4),  INT16_C( 12681), -INT16_C(  4357) },
+      { -INT16_C(  4828),  INT16_C(   129),  INT16_C(  4101), -INT16_C(  2050),  INT16_C(   145), -INT16_C( 32616), -INT16_C(  4177),  INT16_C(  2048),
+         INT16_C( 16109),  INT16_C( 23198), -INT16_C(   389),  INT16_C( 30686), -INT16_C( 20420),  INT16_C(  2048), -INT16_C( 26996),  INT16_C( 31163) },
+      {  INT16_C( 16384),  INT16_C(  8175),  INT16_C( 23535), -INT16_C(  7298),  INT16_C(  6262), -INT16_C( 30480), -INT16_C(  2389),  INT16_C(   609),
+        -INT16_C(  8193), -INT16_C(  6857), -INT16_C( 17929), -INT16_C(  8064), -INT16_C( 14326),  INT16_C(    18), -INT16_C( 14811), -INT16_C( 17425) } },
+    { { -INT16_C( 20481),  INT16_C(  2080), -INT16_C( 32752), -INT16_C(  8304),  INT16_C( 24189), -INT16_C( 17425), -INT16_C( 13399),  INT16_C( 11296),
+         INT16_C(     0), -INT16_C( 30530),  INT16_C( 13900),  INT16_C(     0),  INT16_C( 28158), -INT16_C(     1),  INT16_C( 10076),  INT16_C( 16146) },
+      { -INT16_C( 19408),  INT16_C( 23925),  INT16_C( 29841),  INT16_C( 31268), -INT16_C(  1762), -INT16_C(  9237), -INT16_C(  4108), -INT16_C( 30680),
+         INT16_C(  9721), -INT16_C( 21378),  INT16_C(    80),  INT16_C(   792),  INT16_C( 20893), -INT16_C(   310), -INT16_C(     8), -INT16_C( 12657) },
+      { -INT16_C( 20481),  INT16_C(  2080), -INT16_C( 32752), -INT16_C(  8304),  INT16_C( 24189), -INT16_C( 17425), -INT16_C( 13399),  INT16_C( 11296),
+         INT16_C(     0), -INT16_C( 30530),  INT16_C( 13900),  INT16_C(     0),  INT16_C( 28158), -INT16_C(     1),  INT16_C( 10076),  INT16_C( 16146) },
+      { -INT16_C( 31361), -INT16_C( 22463), -INT16_C( 29696),  INT16_C(  9980), -INT16_C(  3341),  INT16_C( 24031), -INT16_C( 22947),  INT16_C( 16737),
+        -INT16_C( 14336), -INT16_C(  3003), -INT16_C( 32334), -INT16_C( 16384), -INT16_C(  5265),  INT16_C( 22527), -INT16_C( 16070),  INT16_C( 31224) },
+      {  INT16_C( 26721), -INT16_C( 17686), -INT16_C(  5853), -INT16_C(  2999), -INT16_C(  3524), -INT16_C( 18473), -INT16_C(  8215),  INT16_C(  4176),
+         INT16_C( 19442),  INT16_C( 22781),  INT16_C(   160),  INT16_C(  1584), -INT16_C( 23750), -INT16_C(   619), -INT16_C(    16), -INT16_C( 25314) },
+      {  INT16_C(  5631), -INT16_C( 24316),  INT16_C( 12290), -INT16_C( 25614), -INT16_C( 13361),  INT16_C( 30589), -INT16_C( 26251),  INT16_C(  1412),
+         INT16_C(  8192), -INT16_C( 12009),  INT16_C(  1737),  INT16_C(     0), -INT16_C( 21057),  INT16_C( 24575),  INT16_C(  1259), -INT16_C(  6174) } },
+    { {  INT16_C(     0), -INT16_C( 25201), -INT16_C( 29620), -INT16_C(   289), -INT16_C(  7696),  INT16_C(  9791),  INT16_C( 18434),  INT16_C( 16542),
+         INT16_C( 16400),  INT16_C(     0),  INT16_C( 28093),  INT16_C( 28951),  INT16_C(   759), -INT16_C( 10740), -INT16_C(   130),  INT16_C(     8) },
+      {  INT16_C(  2050),  INT16_C(   441),  INT16_C( 32719), -INT16_C(  4199), -INT16_C(    11), -INT16_C(   750),  INT16_C(    28),  INT16_C(  5983),
+         INT16_C(   128),  INT16_C( 30107),  INT16_C(  2048), -INT16_C( 10497), -INT16_C(  4106), -INT16_C(   272), -INT16_C(  6145),  INT16_C(    32) },
+      {  INT16_C(     0), -INT16_C( 25201), -INT16_C( 29620), -INT16_C(   289), -INT16_C(  7696),  INT16_C(  9791),  INT16_C( 18434),  INT16_C( 16542),
+         INT16_C( 16400),  INT16_C(     0),  INT16_C( 28093),  INT16_C( 28951),  INT16_C(   759), -INT16_C( 10740), -INT16_C(   130),  INT16_C(     8) },
+      {  INT16_C(  4096), -INT16_C( 13076),  INT16_C( 31842), -INT16_C( 12298), -INT16_C( 20721), -INT16_C( 28367), -INT16_C(  7616), -INT16_C(  1532),
+         INT16_C(   512), -INT16_C( 10240),  INT16_C(   877), -INT16_C(  1144), -INT16_C( 20457), -INT16_C( 31056), -INT16_C(     5),  INT16_C(     0) },
+      {  INT16_C(  4100),  INT16_C(   883), -INT16_C(    97), -INT16_C(  8397), -INT16_C(    21), -INT16_C(  1500),  INT16_C(    56),  INT16_C( 11966),
+         INT16_C(   256), -INT16_C(  5322),  INT16_C(  4096), -INT16_C( 20994), -INT16_C(  8212), -INT16_C(   543), -INT16_C( 12289),  INT16_C(    64) },
+      {  INT16_C( 16384),  INT16_C( 13233), -INT16_C(  3703),  INT16_C( 16347), -INT16_C( 17346),  INT16_C( 17607), -INT16_C( 30464), -INT16_C(  6125),
+         INT16_C(  2050),  INT16_C( 24576),  INT16_C(  3511), -INT16_C(  4574), -INT16_C( 16290),  INT16_C(  6849), -INT16_C(    17),  INT16_C(     1) } },
+    { {  INT16_C( 17100),  INT16_C(  8256),  INT16_C( 26570), -INT16_C( 26003), -INT16_C(  5925), -INT16_C( 13587), -INT16_C( 16739),  INT16_C(    80),
+        -INT16_C( 25202),  INT16_C( 15410), -INT16_C( 13820), -INT16_C( 26640),  INT16_C(  7942),  INT16_C(  9348), -INT16_C( 27598), -INT16_C(  4105) },
+      { -INT16_C(  4129), -INT16_C( 17526),  INT16_C( 11985), -INT16_C( 23135),  INT16_C(     2), -INT16_C( 32752), -INT16_C( 15751),  INT16_C(     0),
+         INT16_C(  2094),  INT16_C( 30035),  INT16_C(   256), -INT16_C(  6402), -INT16_C( 10242),  INT16_C(   770), -INT16_C(     5), -INT16_C(  8193) },
+      {  INT16_C( 17100),  INT16_C(  8256),  INT16_C( 26570), -INT16_C( 26003), -INT16_C(  5925), -INT16_C( 13587), -INT16_C( 16739),  INT16_C(    80),
+        -INT16_C( 25202),  INT16_C( 15410), -INT16_C( 13820), -INT16_C( 26640),  INT16_C(  7942),  INT16_C(  9348), -INT16_C( 27598), -INT16_C(  4105) },
+      { -INT16_C(  1514),  INT16_C( 20738), -INT16_C( 29890),  INT16_C(  3283),  INT16_C(  5958), -INT16_C( 31145), -INT16_C( 12812),  INT16_C(     2),
+         INT16_C( 29932), -INT16_C( 26143),  INT16_C(  1616), -INT16_C(  2881), -INT16_C(  3848),  INT16_C(  4388), -INT16_C(  9055), -INT16_C(   129) },
+      { -INT16_C(  8258),  INT16_C( 30484),  INT16_C( 23970),  INT16_C( 19267),  INT16_C(     5),  INT16_C(    33), -INT16_C( 31501),  INT16_C(     0),
+         INT16_C(  4189), -INT16_C(  5466),  INT16_C(   513), -INT16_C( 12803), -INT16_C( 20484),  INT16_C(  1540), -INT16_C(     9), -INT16_C( 16385) },
+      { -INT16_C(  6055),  INT16_C( 17416),  INT16_C( 11513),  INT16_C( 13133),  INT16_C( 23835),  INT16_C(  6493),  INT16_C( 14291),  INT16_C(    10),
+        -INT16_C( 11343),  INT16_C( 26502),  INT16_C(  6464), -INT16_C( 11522), -INT16_C( 15392),  INT16_C( 17552),  INT16_C( 29318), -INT16_C(   514) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_shrdi_epi16(a, b, 0);
+    simde_test_x86_assert_equal_i16x16(r0, simde_x_mm256_loadu_epi16(test_vec[i].r0));
+    simde__m256i r5 = simde_mm256_shrdi_epi16(a, b, 5);
+    simde_test_x86_assert_equal_i16x16(r5, simde_x_mm256_loadu_epi16(test_vec[i].r5));
+    simde__m256i r15 = simde_mm256_shrdi_epi16(a, b, 15);
+    simde_test_x86_assert_equal_i16x16(r15, simde_x_mm256_loadu_epi16(test_vec[i].r15));
+    simde__m256i r19 = simde_mm256_shrdi_epi16(a, b, 19);
+    simde_test_x86_assert_equal_i16x16(r19, simde_x_mm256_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r0[16];
+    const int16_t r5[16];
+    const int16_t r15[16];
+    const int16_t r19[16];
+  } test_vec[] = {
+    { { -INT16_C( 15641), -INT16_C( 23040),  INT16_C( 19028), -INT16_C(  1025), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503), -INT16_C( 31719),
+         INT16_C( 25441), -INT16_C(     9),  INT16_C( 14509),  INT16_C( 16548),       INT16_MAX, -INT16_C(    65),  INT16_C( 17389),  INT16_C(     8) },
+      UINT16_C(56203),
+      {  INT16_C(     2),  INT16_C(  5887), -INT16_C( 17948), -INT16_C( 20081), -INT16_C( 13552),  INT16_C( 25057), -INT16_C(  3017),  INT16_C( 30552),
+        -INT16_C( 22654),  INT16_C(  8126),  INT16_C( 15647), -INT16_C(  1025), -INT16_C( 10368), -INT16_C(     1),  INT16_C(     9), -INT16_C( 24277) },
+      {  INT16_C( 22027),  INT16_C(     0),  INT16_C(  8320), -INT16_C( 16101), -INT16_C( 13400),  INT16_C(     2),  INT16_C( 28213),  INT16_C(     0),
+        -INT16_C( 11564), -INT16_C(   129), -INT16_C(  4265),  INT16_C( 14338), -INT16_C( 13107), -INT16_C( 16536), -INT16_C(     1), -INT16_C( 27278) },
+      {  INT16_C(     2),  INT16_C(  5887),  INT16_C( 19028), -INT16_C( 20081), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503),  INT16_C( 30552),
+        -INT16_C( 22654),  INT16_C(  8126),  INT16_C( 14509), -INT16_C(  1025), -INT16_C( 10368), -INT16_C(    65),  INT16_C(     9), -INT16_C( 24277) },
+      {  INT16_C( 22528),  INT16_C(   183),  INT16_C( 19028), -INT16_C(  8820), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503),  INT16_C(   954),
+        -INT16_C( 23236), -INT16_C(  1795),  INT16_C( 14509),  INT16_C(  6111),  INT16_C( 28348), -INT16_C(    65), -INT16_C(  2048), -INT16_C( 27383) },
+      { -INT16_C( 21482),  INT16_C(     0),  INT16_C( 19028), -INT16_C( 32201), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503),  INT16_C(     0),
+        -INT16_C( 23127), -INT16_C(   258),  INT16_C( 14509),  INT16_C( 28677), -INT16_C( 26213), -INT16_C(    65), -INT16_C(     2),  INT16_C( 10981) },
+      {  INT16_C( 24576),  INT16_C(   735),  INT16_C( 19028),  INT16_C( 30257), -INT16_C( 24865), -INT16_C( 14353),  INT16_C( 29503),  INT16_C(  3819),
+        -INT16_C( 27408), -INT16_C(  7177),  INT16_C( 14509),  INT16_C( 24447), -INT16_C( 17680), -INT16_C(    65), -INT16_C(  8191),  INT16_C( 21541) } },
+    { { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751),  INT16_C( 16256),  INT16_C( 32515), -INT16_C(   710), -INT16_C(     5), -INT16_C(  7502),
+         INT16_C( 16448),  INT16_C( 19773),  INT16_C( 18432),  INT16_C( 22810), -INT16_C( 30294),  INT16_C(    16), -INT16_C( 22576), -INT16_C( 32298) },
+      UINT16_C(27304),
+      {  INT16_C(  1552), -INT16_C(   513), -INT16_C(  9217),  INT16_C( 17881), -INT16_C(     1), -INT16_C( 18945),  INT16_C( 16384), -INT16_C( 12383),
+        -INT16_C( 23472), -INT16_C( 16376),  INT16_C( 15690),  INT16_C( 26513), -INT16_C( 20737),  INT16_C(   544),  INT16_C(  4864), -INT16_C(  6843) },
+      {  INT16_C( 16896),  INT16_C( 25051),  INT16_C(   656), -INT16_C(    10),  INT16_C(   320), -INT16_C(  6421), -INT16_C( 10321),  INT16_C( 24786),
+         INT16_C(  8208), -INT16_C(  8537), -INT16_C(  4210),  INT16_C( 12323), -INT16_C(   577),  INT16_C( 32751), -INT16_C( 18167), -INT16_C(     1) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751),  INT16_C( 17881),  INT16_C( 32515), -INT16_C( 18945), -INT16_C(     5), -INT16_C( 12383),
+         INT16_C( 16448), -INT16_C( 16376),  INT16_C( 18432),  INT16_C( 26513), -INT16_C( 30294),  INT16_C(   544),  INT16_C(  4864), -INT16_C( 32298) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751), -INT16_C( 19922),  INT16_C( 32515),  INT16_C( 23983), -INT16_C(     5), -INT16_C( 27011),
+         INT16_C( 16448),  INT16_C( 15872),  INT16_C( 18432),  INT16_C(  6972), -INT16_C( 30294),  INT16_C( 30737),  INT16_C( 18584), -INT16_C( 32298) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751), -INT16_C(    20),  INT16_C( 32515), -INT16_C( 12841), -INT16_C(     5), -INT16_C( 15963),
+         INT16_C( 16448), -INT16_C( 17073),  INT16_C( 18432),  INT16_C( 24646), -INT16_C( 30294), -INT16_C(    34),  INT16_C( 29202), -INT16_C( 32298) },
+      { -INT16_C( 17090), -INT16_C( 10719), -INT16_C( 30751), -INT16_C( 14149),  INT16_C( 32515),  INT16_C( 30399), -INT16_C(     5),  INT16_C( 23028),
+         INT16_C( 16448), -INT16_C(  2047),  INT16_C( 18432),  INT16_C( 27890), -INT16_C( 30294), -INT16_C(  8124),  INT16_C(  8800), -INT16_C( 32298) } },
+    { {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C( 12357),  INT16_C(   129), -INT16_C( 24032), -INT16_C(  2466),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C( 14319),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      UINT16_C( 2192),
+      { -INT16_C( 24923),  INT16_C( 16094),  INT16_C(  8480),  INT16_C(  5630), -INT16_C( 17392),  INT16_C( 11571), -INT16_C(   145), -INT16_C(  5121),
+        -INT16_C( 14179),  INT16_C(  4160), -INT16_C( 17378),       INT16_MIN, -INT16_C( 14511), -INT16_C(  4932),  INT16_C( 12363),  INT16_C( 24198) },
+      {  INT16_C(     0), -INT16_C(  7944),  INT16_C( 21064),  INT16_C( 22110),  INT16_C( 12464), -INT16_C( 16643),  INT16_C( 24605),  INT16_C(  6995),
+         INT16_C(  8192), -INT16_C( 18015),  INT16_C(    38),  INT16_C( 18088),  INT16_C(  4863), -INT16_C(   521), -INT16_C( 12803), -INT16_C(     1) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C( 17392),  INT16_C(   129), -INT16_C( 24032), -INT16_C(  5121),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),       INT16_MIN,  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954), -INT16_C( 31264),  INT16_C(   129), -INT16_C( 24032), -INT16_C( 24737),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C( 17408),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954),  INT16_C( 24929),  INT16_C(   129), -INT16_C( 24032),  INT16_C( 13991),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811), -INT16_C( 29359),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) },
+      {  INT16_C(     1), -INT16_C( 22403), -INT16_C( 17233),  INT16_C(  6954),  INT16_C(  6018),  INT16_C(   129), -INT16_C( 24032),  INT16_C( 32127),
+        -INT16_C(  7351),  INT16_C(  1536),  INT16_C(   811),  INT16_C(  4096),  INT16_C(  7107), -INT16_C( 26638), -INT16_C( 28051), -INT16_C(  8596) } },
+    { { -INT16_C( 24319),  INT16_C( 16622),  INT16_C( 23854),  INT16_C(    64),  INT16_C(  8256), -INT16_C( 26189),  INT16_C(  8193),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275), -INT16_C(     1),  INT16_C( 25622) },
+      UINT16_C(49228),
+      {  INT16_C(    64), -INT16_C(     1),  INT16_C( 26342),  INT16_C( 15664), -INT16_C(    10), -INT16_C(  1026),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 18117), -INT16_C(    10),  INT16_C( 14034),  INT16_C(  4958),  INT16_C( 24983), -INT16_C(    33), -INT16_C( 26503),  INT16_C( 14992) },
+      {  INT16_C( 12288), -INT16_C( 23597), -INT16_C(  8201),  INT16_C( 25819),  INT16_C( 16386), -INT16_C( 27099), -INT16_C( 15285), -INT16_C(     9),
+        -INT16_C(  5145),  INT16_C( 12352),  INT16_C( 13769),  INT16_C(     0),  INT16_C(   566),  INT16_C(  1028),  INT16_C(     0), -INT16_C( 16401) },
+      { -INT16_C( 24319),  INT16_C( 16622),  INT16_C( 26342),  INT16_C( 15664),  INT16_C(  8256), -INT16_C( 26189),  INT16_C(     0),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275), -INT16_C( 26503),  INT16_C( 14992) },
+      { -INT16_C( 24319),  INT16_C( 16622), -INT16_C( 17609), -INT16_C(  9751),  INT16_C(  8256), -INT16_C( 26189),  INT16_C( 22528),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275),  INT16_C(  1219),  INT16_C( 31188) },
+      { -INT16_C( 24319),  INT16_C( 16622), -INT16_C( 16402), -INT16_C( 13898),  INT16_C(  8256), -INT16_C( 26189), -INT16_C( 30570),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275),  INT16_C(     1),  INT16_C( 32734) },
+      { -INT16_C( 24319),  INT16_C( 16622), -INT16_C(  4900),  INT16_C( 26534),  INT16_C(  8256), -INT16_C( 26189),  INT16_C( 24576),  INT16_C( 30719),
+         INT16_C(  1012),  INT16_C( 18113),  INT16_C(   877), -INT16_C( 12778), -INT16_C( 16426),  INT16_C( 18275),  INT16_C(  4879), -INT16_C(  6318) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_mask_shrdi_epi16(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x16(r0, simde_x_mm256_loadu_epi16(test_vec[i].r0));
+    simde__m256i r5 = simde_mm256_mask_shrdi_epi16(src, test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x16(r5, simde_x_mm256_loadu_epi16(test_vec[i].r5));
+    simde__m256i r15 = simde_mm256_mask_shrdi_epi16(src, test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x16(r15, simde_x_mm256_loadu_epi16(test_vec[i].r15));
+    simde__m256i r19 = simde_mm256_mask_shrdi_epi16(src, test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x16(r19, simde_x_mm256_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r0[16];
+    const int16_t r5[16];
+    const int16_t r15[16];
+    const int16_t r19[16];
+  } test_vec[] = {
+    { UINT16_C(11330),
+      { -INT16_C( 22555), -INT16_C(  2305), -INT16_C( 26281), -INT16_C(     1), -INT16_C( 29761),  INT16_C(  2048),  INT16_C(  5852),  INT16_C(  4589),
+         INT16_C(     2),  INT16_C(     0), -INT16_C( 12845),  INT16_C( 18011),  INT16_C(  1064), -INT16_C( 28849), -INT16_C(  4097),  INT16_C( 32015) },
+      {  INT16_C( 15141), -INT16_C(  2777), -INT16_C( 29174),  INT16_C(  4114),  INT16_C( 17602),  INT16_C( 32759),  INT16_C(  1025), -INT16_C(  2113),
+        -INT16_C( 23550), -INT16_C( 23808),  INT16_C(  6144),  INT16_C( 11723),  INT16_C(     0), -INT16_C( 30283), -INT16_C(  6663), -INT16_C(     2) },
+      {  INT16_C(     0), -INT16_C(  2305),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5852),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 12845),  INT16_C( 18011),  INT16_C(     0), -INT16_C( 28849),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 16311),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2230),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(  1646),  INT16_C( 23090),  INT16_C(     0), -INT16_C( 21382),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  5553),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2050),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 12289),  INT16_C( 23446),  INT16_C(     0),  INT16_C(  4971),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(   289),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8923),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(  6586),  INT16_C( 26827),  INT16_C(     0), -INT16_C( 19991),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(61319),
+      {  INT16_C( 28671), -INT16_C(  6191),  INT16_C( 11685),  INT16_C( 26213),  INT16_C( 28752),  INT16_C( 21528),  INT16_C(   593),  INT16_C( 10400),
+        -INT16_C( 16602),  INT16_C( 32511), -INT16_C( 31717),  INT16_C( 24247),  INT16_C( 16386),  INT16_C( 13709),  INT16_C(  2096),  INT16_C( 16416) },
+      { -INT16_C(     1), -INT16_C(  1029), -INT16_C( 29542), -INT16_C(    97), -INT16_C( 24874), -INT16_C(  3092), -INT16_C(  1025), -INT16_C(  9058),
+         INT16_C( 24580), -INT16_C(  3163),  INT16_C( 25355),  INT16_C(  2056), -INT16_C(     1), -INT16_C(  1614),  INT16_C( 28740), -INT16_C(  1029) },
+      {  INT16_C( 28671), -INT16_C(  6191),  INT16_C( 11685),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10400),
+        -INT16_C( 16602),  INT16_C( 32511), -INT16_C( 31717),  INT16_C( 24247),  INT16_C(     0),  INT16_C( 13709),  INT16_C(  2096),  INT16_C( 16416) },
+      { -INT16_C(  1153), -INT16_C(  8386), -INT16_C( 11923),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3771),
+         INT16_C(  9721),  INT16_C( 11255),  INT16_C( 23584),  INT16_C( 17141),  INT16_C(     0), -INT16_C( 28244),  INT16_C(  8257), -INT16_C(  9727) },
+      { -INT16_C(     2), -INT16_C(  2057),  INT16_C(  6452),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18116),
+        -INT16_C( 16375), -INT16_C(  6326), -INT16_C( 14825),  INT16_C(  4112),  INT16_C(     0), -INT16_C(  3228), -INT16_C(  8056), -INT16_C(  2058) },
+      { -INT16_C(  4609),  INT16_C( 31994),  INT16_C( 17844),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 15084),
+        -INT16_C( 26652), -INT16_C( 20513),  INT16_C( 28803),  INT16_C(  3030),  INT16_C(     0),  INT16_C( 18097), -INT16_C( 32506),  INT16_C( 26628) } },
+    { UINT16_C(14153),
+      { -INT16_C(     1),  INT16_C( 16722), -INT16_C( 20424),  INT16_C( 11152),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2113), -INT16_C(  2065),
+        -INT16_C(     9), -INT16_C( 25836),  INT16_C(    32), -INT16_C(   259),  INT16_C( 15920),  INT16_C(    82), -INT16_C( 24577),  INT16_C( 31743) },
+      {  INT16_C( 22834), -INT16_C( 20643),  INT16_C(  4616),  INT16_C(  2340),  INT16_C(  8028), -INT16_C( 28668), -INT16_C( 31051), -INT16_C(  2563),
+         INT16_C(  6435),  INT16_C( 10774),  INT16_C( 17887), -INT16_C( 26026), -INT16_C( 16395),  INT16_C( 14454),  INT16_C(     2),  INT16_C( 18894) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11152),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2113),  INT16_C(     0),
+        -INT16_C(     9), -INT16_C( 25836),  INT16_C(    32),  INT16_C(     0),  INT16_C( 15920),  INT16_C(    82),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C( 26625),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8540),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20547),  INT16_C(     0),
+         INT16_C(  8191), -INT16_C( 19240), -INT16_C(  2047),  INT16_C(     0), -INT16_C( 22031), -INT16_C( 20478),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C( 19867),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4680),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3435),  INT16_C(     0),
+         INT16_C( 12871),  INT16_C( 21549), -INT16_C( 29762),  INT16_C(     0),  INT16_C( 32746),  INT16_C( 28908),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C( 24575),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31374),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16649),  INT16_C(     0),
+         INT16_C( 32766), -INT16_C( 11422), -INT16_C(  8188),  INT16_C(     0), -INT16_C( 22586), -INT16_C( 16374),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 4470),
+      { -INT16_C(  9249), -INT16_C(  9703),  INT16_C(  8208), -INT16_C( 23583), -INT16_C(  1105),  INT16_C(     0), -INT16_C(     3),  INT16_C(    16),
+         INT16_C( 31781),  INT16_C(  7047), -INT16_C(     3),  INT16_C( 32765),  INT16_C(  3145), -INT16_C(  1035),  INT16_C( 19427), -INT16_C(  8195) },
+      { -INT16_C(  2466), -INT16_C( 26650), -INT16_C( 27264), -INT16_C(  6156), -INT16_C(     9), -INT16_C( 29786), -INT16_C( 10991), -INT16_C(  8225),
+        -INT16_C(    19),  INT16_C(    32), -INT16_C( 10297),  INT16_C( 14894),  INT16_C(   200), -INT16_C( 19538), -INT16_C(   513),  INT16_C( 11912) },
+      {  INT16_C(     0), -INT16_C(  9703),  INT16_C(  8208),  INT16_C(     0), -INT16_C(  1105),  INT16_C(     0), -INT16_C(     3),  INT16_C(     0),
+         INT16_C( 31781),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3145),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 14032),  INT16_C(   256),  INT16_C(     0), -INT16_C( 16419),  INT16_C( 12288), -INT16_C( 28673),  INT16_C(     0),
+         INT16_C( 27617),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16482),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 12237),  INT16_C( 11008),  INT16_C(     0), -INT16_C(    17),  INT16_C(  5964), -INT16_C( 21981),  INT16_C(     0),
+        -INT16_C(    38),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   400),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  9405),  INT16_C(  1026),  INT16_C(     0), -INT16_C(   139), -INT16_C( 16384),  INT16_C( 16383),  INT16_C(     0),
+        -INT16_C( 20604),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   393),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_maskz_shrdi_epi16(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x16(r0, simde_x_mm256_loadu_epi16(test_vec[i].r0));
+    simde__m256i r5 = simde_mm256_maskz_shrdi_epi16(test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x16(r5, simde_x_mm256_loadu_epi16(test_vec[i].r5));
+    simde__m256i r15 = simde_mm256_maskz_shrdi_epi16(test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x16(r15, simde_x_mm256_loadu_epi16(test_vec[i].r15));
+    simde__m256i r19 = simde_mm256_maskz_shrdi_epi16(test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x16(r19, simde_x_mm256_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r7[8];
+    const int32_t r31[8];
+    const int32_t r40[8];
+  } test_vec[] = {
+    { {  INT32_C(   268570624), -INT32_C(   899718866),  INT32_C(   734298387),  INT32_C(  1948499854),  INT32_C(   100925508), -INT32_C(   277021761), -INT32_C(  1765225695),  INT32_C(           1) },
+      { -INT32_C(    12713985), -INT32_C(        2373), -INT32_C(   382494999), -INT32_C(   798665420),  INT32_C(    42467328),  INT32_C(  1216348416),  INT32_C(    69218310),  INT32_C(    25724928) },
+      {  INT32_C(   268570624), -INT32_C(   899718866),  INT32_C(   734298387),  INT32_C(  1948499854),  INT32_C(   100925508), -INT32_C(   277021761), -INT32_C(  1765225695),  INT32_C(           1) },
+      { -INT32_C(    31456224),  INT32_C(  2006236866), -INT32_C(   766015230),  INT32_C(  1760053119),  INT32_C(      788480),  INT32_C(    31390199),  INT32_C(   221090198),  INT32_C(           0) },
+      { -INT32_C(    25427970), -INT32_C(        4745), -INT32_C(   764989998), -INT32_C(  1597330840),  INT32_C(    84934656), -INT32_C(  1862270463),  INT32_C(   138436621),  INT32_C(    51449856) },
+      { -INT32_C(    15728112), -INT32_C(  1144365215), -INT32_C(   383007615),  INT32_C(   880026559),  INT32_C(      394240),  INT32_C(    15695099),  INT32_C(   110545099),  INT32_C(           0) } },
+    { {  INT32_C(  1895933211),  INT32_C(  1003127846), -INT32_C(        2441), -INT32_C(   678787337),  INT32_C(  1508715627),  INT32_C(   277892708), -INT32_C(   268697603),  INT32_C(    94403824) },
+      { -INT32_C(    16778250), -INT32_C(   786942831),  INT32_C(  2146435005),  INT32_C(   219127688),  INT32_C(  1073811520), -INT32_C(     1048737),  INT32_C(     3145816),  INT32_C(   621367869) },
+      {  INT32_C(  1895933211),  INT32_C(  1003127846), -INT32_C(        2441), -INT32_C(   678787337),  INT32_C(  1508715627),  INT32_C(   277892708), -INT32_C(   268697603),  INT32_C(    94403824) },
+      { -INT32_C(   320732342),  INT32_C(   578262280),  INT32_C(  2080374764),  INT32_C(   296686861), -INT32_C(  2135696808), -INT32_C(  1105125220), -INT32_C(  1310722049),  INT32_C(  2047557881) },
+      { -INT32_C(    33556500), -INT32_C(  1573885662), -INT32_C(     2097285),  INT32_C(   438255377), -INT32_C(  2147344256), -INT32_C(     2097474),  INT32_C(     6291633),  INT32_C(  1242735738) },
+      { -INT32_C(   160366171), -INT32_C(  1858352508), -INT32_C(  1107296266), -INT32_C(  1999140218),  INT32_C(  1079635244),  INT32_C(  1594921038),  INT32_C(  1492122623),  INT32_C(  1023778940) } },
+    { {  INT32_C(  1285605047),  INT32_C(  1490812158),  INT32_C(  2147479551),  INT32_C(   680540910), -INT32_C(    33554433), -INT32_C(   524084812), -INT32_C(  2089314647),  INT32_C(  1349788542) },
+      { -INT32_C(  1821647010), -INT32_C(  1073741825),  INT32_C(  1064163139), -INT32_C(   184482359),  INT32_C(   805305335), -INT32_C(   285605897),  INT32_C(  1565743664),  INT32_C(     8519745) },
+      {  INT32_C(  1285605047),  INT32_C(  1490812158),  INT32_C(  2147479551),  INT32_C(   680540910), -INT32_C(    33554433), -INT32_C(   524084812), -INT32_C(  2089314647),  INT32_C(  1349788542) },
+      { -INT32_C(  1130806899), -INT32_C(    21907463), -INT32_C(  2030043169), -INT32_C(  1840177035), -INT32_C(   268697601), -INT32_C(   272529869),  INT32_C(  1627844397), -INT32_C(  2103383994) },
+      {  INT32_C(   651673276),  INT32_C(  2147483646),  INT32_C(  2128326278), -INT32_C(   368964718),  INT32_C(  1610610671), -INT32_C(   571211793), -INT32_C(  1163479967),  INT32_C(    17039490) },
+      {  INT32_C(  1582080198), -INT32_C(    10953732),  INT32_C(  1132462063), -INT32_C(   920088518), -INT32_C(   134348801), -INT32_C(   136264935),  INT32_C(   813922198),  INT32_C(  1095791651) } },
+    { {  INT32_C(     5509120), -INT32_C(           3), -INT32_C(  1529807552),  INT32_C(   912114144),  INT32_C(  1878640110), -INT32_C(    16777218),  INT32_C(     2130436), -INT32_C(   277151390) },
+      { -INT32_C(   420478984), -INT32_C(  1028671948),  INT32_C(  1412861922),  INT32_C(  1446239711), -INT32_C(   718259057),  INT32_C(         288), -INT32_C(   867658883), -INT32_C(   804782016) },
+      {  INT32_C(     5509120), -INT32_C(           3), -INT32_C(  1529807552),  INT32_C(   912114144),  INT32_C(  1878640110), -INT32_C(    16777218),  INT32_C(     2130436), -INT32_C(   277151390) },
+      { -INT32_C(   268392416),  INT32_C(  1778384895), -INT32_C(   985030150), -INT32_C(  1100170365),  INT32_C(   517993355),  INT32_C(  1107165183), -INT32_C(   100646652), -INT32_C(  2116094462) },
+      { -INT32_C(   840957968), -INT32_C(  2057343895), -INT32_C(  1469243451), -INT32_C(  1402487874), -INT32_C(  1436518114),  INT32_C(         577), -INT32_C(  1735317766), -INT32_C(  1609564031) },
+      { -INT32_C(   134196208),  INT32_C(   889192447), -INT32_C(   492515075), -INT32_C(   550085183), -INT32_C(  1888486971),  INT32_C(   553582591),  INT32_C(  2097160322),  INT32_C(  1089436417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_shrdi_epi32(a, b, 0);
+    simde_test_x86_assert_equal_i32x8(r0, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    simde__m256i r7 = simde_mm256_shrdi_epi32(a, b, 7);
+    simde_test_x86_assert_equal_i32x8(r7, simde_x_mm256_loadu_epi32(test_vec[i].r7));
+    simde__m256i r31 = simde_mm256_shrdi_epi32(a, b, 31);
+    simde_test_x86_assert_equal_i32x8(r31, simde_x_mm256_loadu_epi32(test_vec[i].r31));
+    simde__m256i r40 = simde_mm256_shrdi_epi32(a, b, 40);
+    simde_test_x86_assert_equal_i32x8(r40, simde_x_mm256_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r7[8];
+    const int32_t r31[8];
+    const int32_t r40[8];
+  } test_vec[] = {
+    { { -INT32_C(  1782519622),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904), -INT32_C(         529), -INT32_C(       66609), -INT32_C(   738202178) },
+      UINT8_C( 33),
+      {  INT32_C(  1271198904), -INT32_C(  2080357864),  INT32_C(      294952),  INT32_C(   585298098), -INT32_C(  1692209218), -INT32_C(     8531870),  INT32_C(   136315908),  INT32_C(  1956872489) },
+      {  INT32_C(  1879048063), -INT32_C(   705912433),  INT32_C(  1854181548), -INT32_C(    67141793),  INT32_C(   333902759),  INT32_C(   746071958), -INT32_C(   292400402),  INT32_C(   278921796) },
+      {  INT32_C(  1271198904),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904), -INT32_C(     8531870), -INT32_C(       66609), -INT32_C(   738202178) },
+      { -INT32_C(    23623191),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904),  INT32_C(   771685280), -INT32_C(       66609), -INT32_C(   738202178) },
+      { -INT32_C(   536871170),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904),  INT32_C(  1492143917), -INT32_C(       66609), -INT32_C(   738202178) },
+      {  INT32_C(  2135672052),  INT32_C(      200960),  INT32_C(  1610350207), -INT32_C(     2101257),  INT32_C(         904), -INT32_C(  1761641008), -INT32_C(       66609), -INT32_C(   738202178) } },
+    { {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(    67108992),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(    33587717) },
+      UINT8_C(144),
+      { -INT32_C(  1222445895),  INT32_C(   134217992),  INT32_C(  1955924954),  INT32_C(   272893184),  INT32_C(   537919536),  INT32_C(   205318655),  INT32_C(  1234853721),  INT32_C(  2147481981) },
+      { -INT32_C(  1111054798),  INT32_C(    67110928),  INT32_C(   218103936),  INT32_C(  1880752950), -INT32_C(  1877069882), -INT32_C(     8388609), -INT32_C(  1893175594), -INT32_C(   365218187) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(   537919536),  INT32_C(    67241216), -INT32_C(  2147483520),  INT32_C(  2147481981) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561), -INT32_C(  1941954560),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(   352321550) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561),  INT32_C(   540827532),  INT32_C(    67241216), -INT32_C(  2147483520), -INT32_C(   730436374) },
+      {  INT32_C(   383054892),  INT32_C(       32768), -INT32_C(     6555649), -INT32_C(   141724561), -INT32_C(   970977280),  INT32_C(    67241216), -INT32_C(  2147483520),  INT32_C(  1971322873) } },
+    { { -INT32_C(  1073742153),  INT32_C(  1074072074),  INT32_C(  1840904186),  INT32_C(  1140883589), -INT32_C(   687931905),  INT32_C(    50333696), -INT32_C(     4718898), -INT32_C(  1598112960) },
+      UINT8_C(149),
+      { -INT32_C(   829156979), -INT32_C(  1049236255), -INT32_C(    33554433),  INT32_C(   659250792), -INT32_C(  1180481826),  INT32_C(   152044896), -INT32_C(   549519617), -INT32_C(  2105921375) },
+      { -INT32_C(   147526511),  INT32_C(  1405791362),  INT32_C(  1074463232), -INT32_C(      164001),  INT32_C(    88211586),  INT32_C(   268468354), -INT32_C(     1048645),  INT32_C(     2097474) },
+      { -INT32_C(   829156979),  INT32_C(  1074072074), -INT32_C(    33554433),  INT32_C(  1140883589), -INT32_C(  1180481826),  INT32_C(    50333696), -INT32_C(     4718898), -INT32_C(  2105921375) },
+      {  INT32_C(   597501987),  INT32_C(  1074072074),  INT32_C(    33292287),  INT32_C(  1140883589),  INT32_C(    91440781),  INT32_C(    50333696), -INT32_C(     4718898), -INT32_C(  2063272863) },
+      { -INT32_C(   295053021),  INT32_C(  1074072074), -INT32_C(  2146040831),  INT32_C(  1140883589),  INT32_C(   176423173),  INT32_C(    50333696), -INT32_C(     4718898),  INT32_C(     4194949) },
+      { -INT32_C(  1848732655),  INT32_C(  1074072074),  INT32_C(    16646143),  INT32_C(  1140883589), -INT32_C(  2101763258),  INT32_C(    50333696), -INT32_C(     4718898),  INT32_C(  1115847216) } },
+    { {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(   135337985), -INT32_C(  1328754061), -INT32_C(   268599301),  INT32_C(     8454656),  INT32_C(   596216001), -INT32_C(  1322753730) },
+      UINT8_C(100),
+      { -INT32_C(      541313), -INT32_C(     6815873), -INT32_C(         129), -INT32_C(   308285953), -INT32_C(   751727389), -INT32_C(   344981633),  INT32_C(  2147450873),  INT32_C(   345187568) },
+      { -INT32_C(   334223233), -INT32_C(  1132677112), -INT32_C(  1844953072),  INT32_C(  1093563600),  INT32_C(       33290),  INT32_C(  1611969449), -INT32_C(   112508053),  INT32_C(   137908748) },
+      {  INT32_C(    50351112), -INT32_C(    35815838), -INT32_C(         129), -INT32_C(  1328754061), -INT32_C(   268599301), -INT32_C(   344981633),  INT32_C(  2147450873), -INT32_C(  1322753730) },
+      {  INT32_C(    50351112), -INT32_C(    35815838),  INT32_C(   570425342), -INT32_C(  1328754061), -INT32_C(   268599301),  INT32_C(  1406590974), -INT32_C(   687866113), -INT32_C(  1322753730) },
+      {  INT32_C(    50351112), -INT32_C(    35815838),  INT32_C(   605061153), -INT32_C(  1328754061), -INT32_C(   268599301), -INT32_C(  1071028397), -INT32_C(   225016106), -INT32_C(  1322753730) },
+      {  INT32_C(    50351112), -INT32_C(    35815838),  INT32_C(   285212671), -INT32_C(  1328754061), -INT32_C(   268599301), -INT32_C(  1444188161),  INT32_C(  1803550591), -INT32_C(  1322753730) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_mask_shrdi_epi32(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x8(r0, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    simde__m256i r7 = simde_mm256_mask_shrdi_epi32(src, test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x8(r7, simde_x_mm256_loadu_epi32(test_vec[i].r7));
+    simde__m256i r31 = simde_mm256_mask_shrdi_epi32(src, test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x8(r31, simde_x_mm256_loadu_epi32(test_vec[i].r31));
+    simde__m256i r40 = simde_mm256_mask_shrdi_epi32(src, test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x8(r40, simde_x_mm256_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r7[8];
+    const int32_t r31[8];
+    const int32_t r40[8];
+  } test_vec[] = {
+    { UINT8_C(252),
+      { -INT32_C(  1313057836),  INT32_C(  1059914310),  INT32_C(  2146693055), -INT32_C(   268469266), -INT32_C(  1865548270), -INT32_C(  1808498688), -INT32_C(   277086210), -INT32_C(     2132225) },
+      { -INT32_C(  1901008451), -INT32_C(    20162376),  INT32_C(   515059995),  INT32_C(   667347689), -INT32_C(    81477175),  INT32_C(  1059986689),  INT32_C(    96534656),  INT32_C(  1587801578) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  2146693055), -INT32_C(   268469266), -INT32_C(  1865548270), -INT32_C(  1808498688), -INT32_C(   277086210), -INT32_C(     2132225) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   922740703), -INT32_C(   740294921), -INT32_C(  1826513924),  INT32_C(    52979968),  INT32_C(    31389695), -INT32_C(   704659731) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1030119990),  INT32_C(  1334695379), -INT32_C(   162954349),  INT32_C(  2119973379),  INT32_C(   193069313), -INT32_C(  1119364139) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   461370351), -INT32_C(   370147461), -INT32_C(   913256962),  INT32_C(    26489984), -INT32_C(  2131788801), -INT32_C(   352329866) } },
+    { UINT8_C(173),
+      { -INT32_C(  1438554907), -INT32_C(  1417019216),  INT32_C(  2118011235),  INT32_C(   538968098),  INT32_C(      139904),  INT32_C(  1077936128), -INT32_C(     1609729), -INT32_C(    67110153) },
+      {  INT32_C(   566069397),  INT32_C(   268468497),  INT32_C(  2092615648),  INT32_C(   421671983), -INT32_C(   487779836),  INT32_C(      295436),  INT32_C(  1609641318),  INT32_C(  1103448824) },
+      { -INT32_C(  1438554907),  INT32_C(           0),  INT32_C(  2118011235),  INT32_C(   538968098),  INT32_C(           0),  INT32_C(  1077936128),  INT32_C(           0), -INT32_C(    67110153) },
+      {  INT32_C(   726958793),  INT32_C(           0), -INT32_C(  1057194862),  INT32_C(  1581268992),  INT32_C(           0),  INT32_C(   411074560),  INT32_C(           0), -INT32_C(   235405323) },
+      {  INT32_C(  1132138795),  INT32_C(           0), -INT32_C(   109736000),  INT32_C(   843343966),  INT32_C(           0),  INT32_C(      590872),  INT32_C(           0), -INT32_C(  2088069647) },
+      { -INT32_C(  1784004252),  INT32_C(           0), -INT32_C(   528597431),  INT32_C(   790634496),  INT32_C(           0),  INT32_C(   205537280),  INT32_C(           0), -INT32_C(   117702662) } },
+    { UINT8_C(148),
+      { -INT32_C(  2018462262), -INT32_C(  1603199661),  INT32_C(  1812860770), -INT32_C(   268468321),  INT32_C(  1392022815),  INT32_C(    96546868), -INT32_C(  1606409720),  INT32_C(  1074004224) },
+      {  INT32_C(   349269881),  INT32_C(  1871359770),  INT32_C(   294003424),  INT32_C(   123849797), -INT32_C(   368822496),  INT32_C(  1550809479), -INT32_C(    19005441),  INT32_C(  2147155966) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1812860770),  INT32_C(           0),  INT32_C(  1392022815),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1074004224) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1059578850),  INT32_C(           0),  INT32_C(  1084617002),  INT32_C(           0),  INT32_C(           0), -INT32_C(    58718206) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   588006848),  INT32_C(           0), -INT32_C(   737644992),  INT32_C(           0),  INT32_C(           0), -INT32_C(      655364) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   529789425),  INT32_C(           0),  INT32_C(   542308501),  INT32_C(           0),  INT32_C(           0), -INT32_C(    29359103) } },
+    { UINT8_C(143),
+      {  INT32_C(   135528962), -INT32_C(     2359553),  INT32_C(   942111702),  INT32_C(  1090544400),  INT32_C(  1380978692), -INT32_C(  1925786938), -INT32_C(     8404993),  INT32_C(  2143289343) },
+      {  INT32_C(   848748396), -INT32_C(       36901), -INT32_C(  1574574866),  INT32_C(     8396800),  INT32_C(  1548306762), -INT32_C(   603979841), -INT32_C(  2025715974),  INT32_C(       67584) },
+      {  INT32_C(   135528962), -INT32_C(     2359553),  INT32_C(   942111702),  INT32_C(  1090544400),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2143289343) },
+      { -INT32_C(   670029820), -INT32_C(  1207977987), -INT32_C(   596619529),  INT32_C(     8519878),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    16744447) },
+      {  INT32_C(  1697496792), -INT32_C(       73801),  INT32_C(  1145817564),  INT32_C(    16793600),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      135168) },
+      {  INT32_C(  1812468738), -INT32_C(   603988994), -INT32_C(   298309765),  INT32_C(     4259939),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(     8372223) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_maskz_shrdi_epi32(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x8(r0, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    simde__m256i r7 = simde_mm256_maskz_shrdi_epi32(test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x8(r7, simde_x_mm256_loadu_epi32(test_vec[i].r7));
+    simde__m256i r31 = simde_mm256_maskz_shrdi_epi32(test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x8(r31, simde_x_mm256_loadu_epi32(test_vec[i].r31));
+    simde__m256i r40 = simde_mm256_maskz_shrdi_epi32(test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x8(r40, simde_x_mm256_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r13[4];
+    const int64_t r63[4];
+    const int64_t r72[4];
+  } test_vec[] = {
+    { { -INT64_C( 1191202251763482881), -INT64_C( 6786470925570432181),  INT64_C(     562950096551968),  INT64_C( 4254509975908352403) },
+      { -INT64_C(     565151124160513), -INT64_C(  565198247774964572),  INT64_C( 6915659715602808831),  INT64_C( 4240396987166600992) },
+      { -INT64_C( 1191202251763482881), -INT64_C( 6786470925570432181),  INT64_C(     562950096551968),  INT64_C( 4254509975908352403) },
+      { -INT64_C(     145410431123473), -INT64_C( 6546810485009672483), -INT64_C(    2251731094191040),  INT64_C( 8719488227951573756) },
+      { -INT64_C(    1130302248321025), -INT64_C( 1130396495549929143), -INT64_C( 4615424642503933954),  INT64_C( 8480793974333201984) },
+      { -INT64_C(    4653133795951106), -INT64_C( 6583750709504451677), -INT64_C(   72055395014113280),  INT64_C( 2322462188807085953) } },
+    { {  INT64_C( 7615924057843053091), -INT64_C( 2314868935666696195), -INT64_C( 6406224515636135690),  INT64_C( 2306478531238559744) },
+      {  INT64_C(     178120885962756), -INT64_C( 8890096866641837038), -INT64_C(  576461854257447042),  INT64_C( 1398104897812241114) },
+      {  INT64_C( 7615924057843053091), -INT64_C( 2314868935666696195), -INT64_C( 6406224515636135690),  INT64_C( 2306478531238559744) },
+      {  INT64_C( 4621622895911846065),  INT64_C( 2348344628899340287), -INT64_C(  291264185793965857), -INT64_C( 2967590601882074032) },
+      {  INT64_C(     356241771925512),  INT64_C(  666550340425877541), -INT64_C( 1152923708514894083),  INT64_C( 2796209795624482228) },
+      {  INT64_C(  317980079502661170),  INT64_C( 1360051829940682751),  INT64_C( 9126290128302644216), -INT64_C( 2729178891678610944) } },
+    { {  INT64_C( 2607724923908653060),  INT64_C( 2986796905004795655),  INT64_C( 7949845194235796553), -INT64_C( 5717006941972114790) },
+      {  INT64_C( 1163056942654988288),  INT64_C( 5764607688394801154), -INT64_C( 8791398515143237785), -INT64_C( 8234114922187106667) },
+      {  INT64_C( 2607724923908653060),  INT64_C( 2986796905004795655),  INT64_C( 7949845194235796553), -INT64_C( 5717006941972114790) },
+      {  INT64_C(     318325796375568),  INT64_C(    4868198858938464), -INT64_C(  343554931406655958), -INT64_C( 5427535427805418886) },
+      {  INT64_C( 2326113885309976576), -INT64_C( 6917528696919949308),  INT64_C(  863947043423076046),  INT64_C( 1978514229335338283) },
+      {  INT64_C(   10186425484018176),  INT64_C(  155782363486030855),  INT64_C( 7452986268696560988), -INT64_C( 7660437026387439790) } },
+    { {  INT64_C(           403718336), -INT64_C(  627211623907735014), -INT64_C( 2306423551495766210),  INT64_C(  180179169736459264) },
+      { -INT64_C( 4864675646214082012),  INT64_C( 2305845242865157632), -INT64_C( 3729861554173963036), -INT64_C(    9288674416003073) },
+      {  INT64_C(           403718336), -INT64_C(  627211623907735014), -INT64_C( 2306423551495766210),  INT64_C(  180179169736459264) },
+      { -INT64_C( 7989385738955210622),  INT64_C( 3460939749715292126), -INT64_C( 6402148416150848513), -INT64_C( 4613915823713517432) },
+      {  INT64_C( 8717392781281387592),  INT64_C( 4611690485730315265), -INT64_C( 7459723108347926071), -INT64_C(   18577348832006146) },
+      {  INT64_C( 2594073385366982720),  INT64_C(   69607548632038346), -INT64_C( 1954564506022084609), -INT64_C(   71353769156144892) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_shrdi_epi64(a, b, 0);
+    simde_test_x86_assert_equal_i64x4(r0, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    simde__m256i r13 = simde_mm256_shrdi_epi64(a, b, 13);
+    simde_test_x86_assert_equal_i64x4(r13, simde_x_mm256_loadu_epi64(test_vec[i].r13));
+    simde__m256i r63 = simde_mm256_shrdi_epi64(a, b, 63);
+    simde_test_x86_assert_equal_i64x4(r63, simde_x_mm256_loadu_epi64(test_vec[i].r63));
+    simde__m256i r72 = simde_mm256_shrdi_epi64(a, b, 72);
+    simde_test_x86_assert_equal_i64x4(r72, simde_x_mm256_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r13[4];
+    const int64_t r63[4];
+    const int64_t r72[4];
+  } test_vec[] = {
+    { { -INT64_C(  577586656505241761),  INT64_C(      17592186095624),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      UINT8_C( 50),
+      {  INT64_C( 6802166866758825848),  INT64_C(    2251800417673224), -INT64_C(  532029946139992942), -INT64_C( 2328413784177117185) },
+      { -INT64_C(       2235530478081), -INT64_C( 1928298978791082357), -INT64_C( 5217623599133422360),  INT64_C( 9115285611396202495) },
+      { -INT64_C(  577586656505241761),  INT64_C(    2251800417673224),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      { -INT64_C(  577586656505241761), -INT64_C( 5451607074054004735),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      { -INT64_C(  577586656505241761), -INT64_C( 3856597957582164714),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) },
+      { -INT64_C(  577586656505241761), -INT64_C( 8430729706342186976),  INT64_C(  594603246098588704), -INT64_C( 8878829062433267454) } },
+    { { -INT64_C(  146542931224822289), -INT64_C(    6755675394802179),  INT64_C(   27373441485635586),  INT64_C(   74382099213320704) },
+      UINT8_C(142),
+      {  INT64_C( 3580328184038876959),  INT64_C(      70507274698802), -INT64_C( 2333698531825648557),  INT64_C(         34376523824) },
+      {  INT64_C( 1820852210462333115),  INT64_C( 2305843576956780548), -INT64_C( 1152922639551955217),  INT64_C(  144576982961619456) },
+      { -INT64_C(  146542931224822289),  INT64_C(      70507274698802), -INT64_C( 2333698531825648557),  INT64_C(         34376523824) },
+      { -INT64_C(  146542931224822289),  INT64_C(    9007207861586048), -INT64_C(  612774424631448205),  INT64_C( 1152921504611043329) },
+      { -INT64_C(  146542931224822289),  INT64_C( 4611687153913561096), -INT64_C( 2305845279103910433),  INT64_C(  289153965923238912) },
+      { -INT64_C(  146542931224822289),  INT64_C(  288230651570753536), -INT64_C( 1162037514496790916),  INT64_C(           134283296) } },
+    { { -INT64_C( 4611694848880754694),  INT64_C(  144405495793779281),  INT64_C( 1459167449923487777),  INT64_C(   11259566038712320) },
+      UINT8_C(246),
+      { -INT64_C( 5960865195646975049),  INT64_C( 1601650135021647830), -INT64_C( 3220515625236109675), -INT64_C(  326955223107568972) },
+      { -INT64_C( 3298985714138523973),  INT64_C( 3457211049754522907), -INT64_C( 4744875963865567889),  INT64_C(   40552462733541392) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 1601650135021647830), -INT64_C( 3220515625236109675),  INT64_C(   11259566038712320) },
+      { -INT64_C( 4611694848880754694), -INT64_C( 6280074166435658913),  INT64_C( 7745798229728469415),  INT64_C(   11259566038712320) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 6914422099509045814),  INT64_C( 8956992145978415839),  INT64_C(   11259566038712320) },
+      { -INT64_C( 4611694848880754694),  INT64_C( 1951811484863982583),  INT64_C( 8057870393086850278),  INT64_C(   11259566038712320) } },
+    { {  INT64_C(        549890295808), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697), -INT64_C(    2429920697384961) },
+      UINT8_C(249),
+      { -INT64_C( 6341229782155176247),  INT64_C( 5794376010860606804),  INT64_C( 4684306584583536648),  INT64_C( 4611703649268204688) },
+      {  INT64_C(  702930448027518617),  INT64_C( 2342469940558170114), -INT64_C( 1152924150843572482), -INT64_C( 1162509383440039957) },
+      { -INT64_C( 6341229782155176247), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697),  INT64_C( 4611703649268204688) },
+      {  INT64_C( 3804767609226927130), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697), -INT64_C(   46724843981766648) },
+      {  INT64_C( 1405860896055037235), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697), -INT64_C( 2325018766880079914) },
+      { -INT64_C( 7374645020705193130), -INT64_C( 6332169673473130093),  INT64_C( 2750295860669913697), -INT64_C( 1495195007416532732) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_mask_shrdi_epi64(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x4(r0, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    simde__m256i r13 = simde_mm256_mask_shrdi_epi64(src, test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x4(r13, simde_x_mm256_loadu_epi64(test_vec[i].r13));
+    simde__m256i r63 = simde_mm256_mask_shrdi_epi64(src, test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x4(r63, simde_x_mm256_loadu_epi64(test_vec[i].r63));
+    simde__m256i r72 = simde_mm256_mask_shrdi_epi64(src, test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x4(r72, simde_x_mm256_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r13[4];
+    const int64_t r63[4];
+    const int64_t r72[4];
+  } test_vec[] = {
+    { UINT8_C(109),
+      { -INT64_C( 1152930300699870213),  INT64_C( 5911488862909851648), -INT64_C(  144132782409654820),  INT64_C(    4785074612551680) },
+      {  INT64_C(    2392537436389384), -INT64_C( 4611545280939032512),  INT64_C( 7918036055947611470),  INT64_C( 2998485984211388608) },
+      { -INT64_C( 1152930300699870213),  INT64_C(                   0), -INT64_C(  144132782409654820),  INT64_C(    4785074612551680) },
+      {  INT64_C(   20125459761070079),  INT64_C(                   0),  INT64_C( 7671864370891849694),  INT64_C( 5044032166770508810) },
+      {  INT64_C(    4785074872778769),  INT64_C(                   0), -INT64_C( 2610671961814328675),  INT64_C( 5996971968422777216) },
+      {  INT64_C(  644014712354242555),  INT64_C(                   0),  INT64_C( 5691986910315019229), -INT64_C( 4611667326729682624) } },
+    { UINT8_C(176),
+      { -INT64_C( 7497593570338417616), -INT64_C( 8916530182246039723), -INT64_C( 2621472276664129082),  INT64_C( 9184930842604953595) },
+      {  INT64_C( 7054747599431170908), -INT64_C( 9223372035204316088), -INT64_C(       8797234921985),  INT64_C(  502694388514254594) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      { -INT64_C( 1155499864071798785), -INT64_C(   72066390198075403), -INT64_C( 9155347516735810585), -INT64_C( 4611695984094874369) },
+      {  INT64_C( 8580201891933739429), -INT64_C( 2016767099614716435), -INT64_C( 9150883434187456189),  INT64_C(        275954794688) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C( 9223319259355021271),  INT64_C(      72791105863685),  INT64_C( 6785739166987340462),  INT64_C(        276807286784) },
+      {  INT64_C( 2291052450433992566),  INT64_C( 5076167915189276587), -INT64_C( 8214486344401219476),  INT64_C(  144115739979153472) },
+      {  INT64_C(                   0),  INT64_C(      72791105863685),  INT64_C(                   0),  INT64_C(        276807286784) },
+      {  INT64_C(                   0),  INT64_C( 9031969061577162768),  INT64_C(                   0),  INT64_C(  144115188109645824) },
+      {  INT64_C(                   0), -INT64_C( 8294408243330998442),  INT64_C(                   0),  INT64_C(  288231479958306944) },
+      {  INT64_C(                   0), -INT64_C( 6124895208883617280),  INT64_C(                   0),  INT64_C( 4611686019508666368) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r0 = simde_mm256_maskz_shrdi_epi64(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x4(r0, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    simde__m256i r13 = simde_mm256_maskz_shrdi_epi64(test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x4(r13, simde_x_mm256_loadu_epi64(test_vec[i].r13));
+    simde__m256i r63 = simde_mm256_maskz_shrdi_epi64(test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x4(r63, simde_x_mm256_loadu_epi64(test_vec[i].r63));
+    simde__m256i r72 = simde_mm256_maskz_shrdi_epi64(test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x4(r72, simde_x_mm256_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r0[32];
+    const int16_t r5[32];
+    const int16_t r15[32];
+    const int16_t r19[32];
+  } test_vec[] = {
+    { {  INT16_C( 27845),  INT16_C( 30522),  INT16_C( 25605),  INT16_C(  4147), -INT16_C( 26713),  INT16_C(     2),  INT16_C(  1088), -INT16_C( 24286),
+        -INT16_C( 12062),  INT16_C(    66), -INT16_C(  7168),  INT16_C( 14814), -INT16_C( 32764), -INT16_C( 23344), -INT16_C(    97),  INT16_C(  4096),
+         INT16_C( 30379), -INT16_C(  6145), -INT16_C( 17441), -INT16_C( 32220), -INT16_C(  7447), -INT16_C(  1185),  INT16_C(   258), -INT16_C(  8259),
+         INT16_C(     0),  INT16_C( 22501), -INT16_C(   129),  INT16_C(   256),  INT16_C( 18894), -INT16_C(   114), -INT16_C( 26839),  INT16_C(     4) },
+      {       INT16_MIN,  INT16_C(     1), -INT16_C(  8297), -INT16_C(  4097),  INT16_C(  4128),  INT16_C( 25418), -INT16_C( 16378),  INT16_C(     0),
+         INT16_C(   130), -INT16_C( 10480), -INT16_C( 19337), -INT16_C( 13323), -INT16_C( 32248),  INT16_C( 11718), -INT16_C(  1025), -INT16_C(    37),
+         INT16_C(    33), -INT16_C(  4097), -INT16_C( 28018),  INT16_C(  4481), -INT16_C(  2049),  INT16_C(  1188), -INT16_C(  2451),  INT16_C( 14204),
+         INT16_C( 22561), -INT16_C(  5122), -INT16_C(  4355), -INT16_C(   130),  INT16_C( 22442), -INT16_C( 31048), -INT16_C(  8258),  INT16_C( 14654) },
+      {  INT16_C( 27845),  INT16_C( 30522),  INT16_C( 25605),  INT16_C(  4147), -INT16_C( 26713),  INT16_C(     2),  INT16_C(  1088), -INT16_C( 24286),
+        -INT16_C( 12062),  INT16_C(    66), -INT16_C(  7168),  INT16_C( 14814), -INT16_C( 32764), -INT16_C( 23344), -INT16_C(    97),  INT16_C(  4096),
+         INT16_C( 30379), -INT16_C(  6145), -INT16_C( 17441), -INT16_C( 32220), -INT16_C(  7447), -INT16_C(  1185),  INT16_C(   258), -INT16_C(  8259),
+         INT16_C(     0),  INT16_C( 22501), -INT16_C(   129),  INT16_C(   256),  INT16_C( 18894), -INT16_C(   114), -INT16_C( 26839),  INT16_C(     4) },
+      {  INT16_C(   870),  INT16_C(  3001), -INT16_C( 17632), -INT16_C(  1919),  INT16_C(  1213),  INT16_C( 20480),  INT16_C( 12322),  INT16_C(  1289),
+         INT16_C(  5767), -INT16_C( 32766), -INT16_C( 16608), -INT16_C( 22066),  INT16_C( 17408),  INT16_C( 13606), -INT16_C(     4), -INT16_C( 10112),
+         INT16_C(  2997), -INT16_C(   193),  INT16_C( 30174),  INT16_C(  3089), -INT16_C(   233),  INT16_C( 10202),  INT16_C( 26632), -INT16_C(  6403),
+         INT16_C(  2048), -INT16_C(  3393), -INT16_C(  4101), -INT16_C(  4088),  INT16_C( 21070), -INT16_C( 14340), -INT16_C(  2887), -INT16_C(  4096) },
+      {  INT16_C(     0),  INT16_C(     2), -INT16_C( 16594), -INT16_C(  8194),  INT16_C(  8257), -INT16_C( 14700), -INT16_C( 32756),  INT16_C(     1),
+         INT16_C(   261), -INT16_C( 20960),  INT16_C( 26863), -INT16_C( 26646),  INT16_C(  1041),  INT16_C( 23437), -INT16_C(  2049), -INT16_C(    74),
+         INT16_C(    66), -INT16_C(  8193),  INT16_C(  9501),  INT16_C(  8963), -INT16_C(  4097),  INT16_C(  2377), -INT16_C(  4902),  INT16_C( 28409),
+        -INT16_C( 20414), -INT16_C( 10244), -INT16_C(  8709), -INT16_C(   260), -INT16_C( 20652),  INT16_C(  3441), -INT16_C( 16515),  INT16_C( 29308) },
+      {  INT16_C(  3480),  INT16_C( 12007), -INT16_C(  4992), -INT16_C(  7674),  INT16_C(  4852),  INT16_C( 16384), -INT16_C( 16248),  INT16_C(  5156),
+         INT16_C( 23068),  INT16_C(     8), -INT16_C(   896), -INT16_C( 22725),  INT16_C(  4096), -INT16_C( 11110), -INT16_C(    13),  INT16_C( 25088),
+         INT16_C( 11989), -INT16_C(   769), -INT16_C( 10373),  INT16_C( 12356), -INT16_C(   931), -INT16_C( 24725), -INT16_C( 24544), -INT16_C( 25609),
+         INT16_C(  8192), -INT16_C( 13572), -INT16_C( 16401), -INT16_C( 16352),  INT16_C( 18745),  INT16_C(  8177), -INT16_C( 11547), -INT16_C( 16384) } },
+    { { -INT16_C(   257),  INT16_C(     1),  INT16_C( 29841),  INT16_C(   256), -INT16_C( 20985),  INT16_C( 16396), -INT16_C( 32736), -INT16_C( 32736),
+         INT16_C( 23277), -INT16_C(  6831), -INT16_C( 13938),  INT16_C( 26611), -INT16_C( 22032), -INT16_C(  9217),  INT16_C( 30460),  INT16_C(  9347),
+        -INT16_C(     1), -INT16_C(  1185), -INT16_C(  5150),  INT16_C(     4), -INT16_C(  8195),  INT16_C( 15605),  INT16_C( 10568),  INT16_C( 22506),
+        -INT16_C( 29696),  INT16_C( 30036),  INT16_C( 12681), -INT16_C(     1), -INT16_C(  5560), -INT16_C(     2), -INT16_C(    65), -INT16_C( 16449) },
+      {  INT16_C(  3581), -INT16_C(    66), -INT16_C( 10248),  INT16_C(   201),       INT16_MIN, -INT16_C(     1), -INT16_C( 18611),  INT16_C( 24854),
+         INT16_C(  1304), -INT16_C( 19025), -INT16_C( 20818), -INT16_C(    43), -INT16_C( 14328),  INT16_C(  6755),  INT16_C( 26771),  INT16_C(   392),
+         INT16_C( 20168),  INT16_C(   264), -INT16_C(  8193),  INT16_C( 32681),  INT16_C(  5919),  INT16_C( 17472), -INT16_C(  9219),  INT16_C( 26954),
+        -INT16_C(  9793), -INT16_C( 20273),  INT16_C(    12), -INT16_C(  6374), -INT16_C( 28118),  INT16_C( 13115),  INT16_C( 23799), -INT16_C( 19516) },
+      { -INT16_C(   257),  INT16_C(     1),  INT16_C( 29841),  INT16_C(   256), -INT16_C( 20985),  INT16_C( 16396), -INT16_C( 32736), -INT16_C( 32736),
+         INT16_C( 23277), -INT16_C(  6831), -INT16_C( 13938),  INT16_C( 26611), -INT16_C( 22032), -INT16_C(  9217),  INT16_C( 30460),  INT16_C(  9347),
+        -INT16_C(     1), -INT16_C(  1185), -INT16_C(  5150),  INT16_C(     4), -INT16_C(  8195),  INT16_C( 15605),  INT16_C( 10568),  INT16_C( 22506),
+        -INT16_C( 29696),  INT16_C( 30036),  INT16_C( 12681), -INT16_C(     1), -INT16_C(  5560), -INT16_C(     2), -INT16_C(    65), -INT16_C( 16449) },
+      { -INT16_C(  4105), -INT16_C(  4096), -INT16_C( 15452),  INT16_C( 18440),  INT16_C(  1392), -INT16_C(  1536),  INT16_C( 27649), -INT16_C( 19455),
+        -INT16_C( 15657),  INT16_C( 32554),  INT16_C( 30284), -INT16_C( 21697),  INT16_C( 17743),  INT16_C(  7903), -INT16_C( 25673),  INT16_C( 16676),
+         INT16_C( 18431),  INT16_C( 18394), -INT16_C(   161),  INT16_C( 18432), -INT16_C(   257),  INT16_C(   487), -INT16_C(  5814),  INT16_C( 21183),
+        -INT16_C(   928),  INT16_C( 31658),  INT16_C( 24972), -INT16_C( 10241),  INT16_C( 22354), -INT16_C(  8193), -INT16_C( 16387),  INT16_C(  9725) },
+      {  INT16_C(  7163), -INT16_C(   132), -INT16_C( 20496),  INT16_C(   402),  INT16_C(     1), -INT16_C(     2),  INT16_C( 28315), -INT16_C( 15827),
+         INT16_C(  2608),  INT16_C( 27487),  INT16_C( 23901), -INT16_C(    86), -INT16_C( 28655),  INT16_C( 13511), -INT16_C( 11994),  INT16_C(   784),
+        -INT16_C( 25199),  INT16_C(   529), -INT16_C( 16385), -INT16_C(   174),  INT16_C( 11839), -INT16_C( 30592), -INT16_C( 18438), -INT16_C( 11628),
+        -INT16_C( 19585),  INT16_C( 24990),  INT16_C(    24), -INT16_C( 12747),  INT16_C(  9301),  INT16_C( 26231), -INT16_C( 17937),  INT16_C( 26505) },
+      { -INT16_C( 16417), -INT16_C( 16384),  INT16_C(  3730),  INT16_C(  8224),  INT16_C(  5568), -INT16_C(  6143), -INT16_C( 20476), -INT16_C( 12284),
+         INT16_C(  2909), -INT16_C(   854), -INT16_C(  9935), -INT16_C( 21250),  INT16_C(  5438),  INT16_C( 31615),  INT16_C( 28383),  INT16_C(  1168),
+         INT16_C(  8191),  INT16_C(  8043), -INT16_C(   644),  INT16_C(  8192), -INT16_C(  1025),  INT16_C(  1950), -INT16_C( 23255),  INT16_C( 19197),
+        -INT16_C(  3712), -INT16_C(  4438), -INT16_C( 31183),  INT16_C( 24575),  INT16_C( 23881),       INT16_MAX, -INT16_C(     9), -INT16_C( 26633) } },
+    { { -INT16_C(   747),  INT16_C(  4104),  INT16_C( 21531), -INT16_C( 13588), -INT16_C( 24577), -INT16_C(  5137), -INT16_C( 10739),  INT16_C(  8192),
+         INT16_C( 31197),  INT16_C( 10305),  INT16_C(  8217), -INT16_C(  4679),  INT16_C(  4104),  INT16_C(   512),  INT16_C(   256),  INT16_C( 14904),
+         INT16_C( 24817),  INT16_C(   576), -INT16_C(  9164),  INT16_C(     0),  INT16_C( 10369),  INT16_C( 12921), -INT16_C(  1059), -INT16_C(  1033),
+        -INT16_C( 21249), -INT16_C( 23698), -INT16_C(     1),  INT16_C( 12440),  INT16_C( 26201),  INT16_C( 12288), -INT16_C(  3073),  INT16_C(   516) },
+      { -INT16_C( 14904), -INT16_C( 29700),  INT16_C(  7133), -INT16_C(  8225),  INT16_C(  4163),  INT16_C( 27921),  INT16_C(   512), -INT16_C(     1),
+              INT16_MIN,  INT16_C(  4864),  INT16_C(  1024), -INT16_C( 31409), -INT16_C(    69),  INT16_C( 26460), -INT16_C(     1), -INT16_C( 10988),
+        -INT16_C(     2),  INT16_C( 23759), -INT16_C(   513), -INT16_C( 22926), -INT16_C(   275),  INT16_C( 15419), -INT16_C( 16520), -INT16_C(     1),
+         INT16_C(  1322),       INT16_MAX,  INT16_C(     0), -INT16_C(   259), -INT16_C( 23855),  INT16_C( 32723),  INT16_C(   168),  INT16_C(    66) },
+      { -INT16_C(   747),  INT16_C(  4104),  INT16_C( 21531), -INT16_C( 13588), -INT16_C( 24577), -INT16_C(  5137), -INT16_C( 10739),  INT16_C(  8192),
+         INT16_C( 31197),  INT16_C( 10305),  INT16_C(  8217), -INT16_C(  4679),  INT16_C(  4104),  INT16_C(   512),  INT16_C(   256),  INT16_C( 14904),
+         INT16_C( 24817),  INT16_C(   576), -INT16_C(  9164),  INT16_C(     0),  INT16_C( 10369),  INT16_C( 12921), -INT16_C(  1059), -INT16_C(  1033),
+        -INT16_C( 21249), -INT16_C( 23698), -INT16_C(     1),  INT16_C( 12440),  INT16_C( 26201),  INT16_C( 12288), -INT16_C(  3073),  INT16_C(   516) },
+      {  INT16_C( 18408), -INT16_C(  8064), -INT16_C(  5472), -INT16_C(   425),  INT16_C(  7423), -INT16_C( 28833),  INT16_C(  1712), -INT16_C(  1792),
+         INT16_C(   974),  INT16_C(   322),  INT16_C(   256),  INT16_C( 32621), -INT16_C( 10112), -INT16_C(  8176), -INT16_C(  2040), -INT16_C( 24111),
+        -INT16_C(  3321),  INT16_C( 30738), -INT16_C(   287), -INT16_C( 28672),  INT16_C( 26948), -INT16_C(  9837), -INT16_C( 14370), -INT16_C(    33),
+         INT16_C( 21863), -INT16_C(   741),  INT16_C(  2047), -INT16_C(  5756), -INT16_C( 29902), -INT16_C( 26240),  INT16_C( 18335),  INT16_C(  4112) },
+      { -INT16_C( 29807),  INT16_C(  6136),  INT16_C( 14266), -INT16_C( 16449),  INT16_C(  8327), -INT16_C(  9693),  INT16_C(  1025), -INT16_C(     2),
+         INT16_C(     0),  INT16_C(  9728),  INT16_C(  2048),  INT16_C(  2719), -INT16_C(   138), -INT16_C( 12616), -INT16_C(     2), -INT16_C( 21976),
+        -INT16_C(     4), -INT16_C( 18018), -INT16_C(  1025),  INT16_C( 19684), -INT16_C(   550),  INT16_C( 30838),  INT16_C( 32497), -INT16_C(     1),
+         INT16_C(  2645), -INT16_C(     1),  INT16_C(     1), -INT16_C(   518),  INT16_C( 17826), -INT16_C(    90),  INT16_C(   337),  INT16_C(   132) },
+      {  INT16_C(  8098), -INT16_C( 32255), -INT16_C( 21885), -INT16_C(  1699),  INT16_C( 29695),  INT16_C( 15741),  INT16_C(  6849), -INT16_C(  7168),
+         INT16_C(  3899),  INT16_C(  1288),  INT16_C(  1027), -INT16_C(   585),  INT16_C( 25089), -INT16_C( 32704), -INT16_C(  8160), -INT16_C( 30905),
+        -INT16_C( 13282), -INT16_C(  8120), -INT16_C(  1146),  INT16_C( 16384), -INT16_C( 23280),  INT16_C( 26191),  INT16_C(  8059), -INT16_C(   130),
+         INT16_C( 21919), -INT16_C(  2963),  INT16_C(  8191), -INT16_C( 23021),  INT16_C( 11467),  INT16_C( 26112),  INT16_C(  7807),  INT16_C( 16448) } },
+    { { -INT16_C( 21295), -INT16_C( 25324),  INT16_C(   384), -INT16_C( 26032), -INT16_C(  2559),  INT16_C(  1026),  INT16_C(     1), -INT16_C(  2569),
+        -INT16_C( 31623), -INT16_C(  3125), -INT16_C(  8197), -INT16_C( 19850), -INT16_C( 27282),  INT16_C( 20425),  INT16_C(   128),  INT16_C( 15242),
+        -INT16_C(     1),  INT16_C(     0), -INT16_C( 23202), -INT16_C( 26944),  INT16_C(  6598), -INT16_C(  8265),  INT16_C( 32511), -INT16_C( 24029),
+        -INT16_C( 32704),  INT16_C(  8191), -INT16_C(     9),  INT16_C(   128), -INT16_C(  2051),  INT16_C(    32), -INT16_C( 19368),  INT16_C(   528) },
+      { -INT16_C( 16701),  INT16_C(   256), -INT16_C( 14061), -INT16_C( 13104), -INT16_C( 13332),       INT16_MIN,  INT16_C(   916),  INT16_C( 21790),
+        -INT16_C(   513), -INT16_C(  4479), -INT16_C( 27778),  INT16_C(  5155), -INT16_C(   257), -INT16_C( 30688),  INT16_C(  4381), -INT16_C(  1029),
+        -INT16_C( 17926),  INT16_C( 15811),  INT16_C( 17371), -INT16_C(  9383),  INT16_C( 24189), -INT16_C( 16423), -INT16_C(   566), -INT16_C( 17393),
+        -INT16_C( 16892), -INT16_C(     5),  INT16_C(  6317),  INT16_C( 16638), -INT16_C(   769), -INT16_C( 21658), -INT16_C(     1),  INT16_C( 30746) },
+      { -INT16_C( 21295), -INT16_C( 25324),  INT16_C(   384), -INT16_C( 26032), -INT16_C(  2559),  INT16_C(  1026),  INT16_C(     1), -INT16_C(  2569),
+        -INT16_C( 31623), -INT16_C(  3125), -INT16_C(  8197), -INT16_C( 19850), -INT16_C( 27282),  INT16_C( 20425),  INT16_C(   128),  INT16_C( 15242),
+        -INT16_C(     1),  INT16_C(     0), -INT16_C( 23202), -INT16_C( 26944),  INT16_C(  6598), -INT16_C(  8265),  INT16_C( 32511), -INT16_C( 24029),
+        -INT16_C( 32704),  INT16_C(  8191), -INT16_C(     9),  INT16_C(   128), -INT16_C(  2051),  INT16_C(    32), -INT16_C( 19368),  INT16_C(   528) },
+      {  INT16_C(  7526),  INT16_C(  1256), -INT16_C( 26612), -INT16_C( 31534),  INT16_C( 26544),  INT16_C(    32), -INT16_C( 24576), -INT16_C(  2129),
+        -INT16_C(   989),  INT16_C(  3998), -INT16_C(  2305),  INT16_C(  7571), -INT16_C(   853),  INT16_C(   638), -INT16_C(  6140), -INT16_C(  9764),
+        -INT16_C( 10241),  INT16_C(  6144), -INT16_C(  8918), -INT16_C( 13130), -INT16_C(  5938), -INT16_C( 12547),  INT16_C( 21495),  INT16_C( 32017),
+         INT16_C(  9218), -INT16_C(  9985),  INT16_C( 28671), -INT16_C(  4092), -INT16_C(    65),  INT16_C( 12289), -INT16_C(   606), -INT16_C( 12272) },
+      {  INT16_C( 32135),  INT16_C(   513), -INT16_C( 28122), -INT16_C( 26207), -INT16_C( 26663),  INT16_C(     0),  INT16_C(  1832), -INT16_C( 21955),
+        -INT16_C(  1025), -INT16_C(  8957),  INT16_C(  9981),  INT16_C( 10311), -INT16_C(   513),  INT16_C(  4160),  INT16_C(  8762), -INT16_C(  2058),
+         INT16_C( 29685),  INT16_C( 31622), -INT16_C( 30793), -INT16_C( 18765), -INT16_C( 17158),  INT16_C( 32691), -INT16_C(  1132),  INT16_C( 30751),
+         INT16_C( 31753), -INT16_C(    10),  INT16_C( 12635), -INT16_C( 32260), -INT16_C(  1537),  INT16_C( 22220), -INT16_C(     1), -INT16_C(  4044) },
+      {  INT16_C( 30106),  INT16_C(  5026),  INT16_C( 24624),  INT16_C(  4938), -INT16_C( 24896),  INT16_C(   128),       INT16_MIN, -INT16_C(  8514),
+        -INT16_C(  3953),  INT16_C( 15993), -INT16_C(  9217),  INT16_C( 30286), -INT16_C(  3411),  INT16_C(  2553), -INT16_C( 24560),  INT16_C( 26481),
+         INT16_C( 24575),  INT16_C( 24576),  INT16_C( 29867),  INT16_C( 13016), -INT16_C( 23752),  INT16_C( 15350),  INT16_C( 20447), -INT16_C(  3004),
+        -INT16_C( 28664),  INT16_C( 25599), -INT16_C( 16386), -INT16_C( 16368), -INT16_C(   257), -INT16_C( 16380), -INT16_C(  2421),  INT16_C( 16450) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_shrdi_epi16(a, b, 0);
+    simde_test_x86_assert_equal_i16x32(r0, simde_mm512_loadu_epi16(test_vec[i].r0));
+    simde__m512i r5 = simde_mm512_shrdi_epi16(a, b, 5);
+    simde_test_x86_assert_equal_i16x32(r5, simde_mm512_loadu_epi16(test_vec[i].r5));
+    simde__m512i r15 = simde_mm512_shrdi_epi16(a, b, 15);
+    simde_test_x86_assert_equal_i16x32(r15, simde_mm512_loadu_epi16(test_vec[i].r15));
+    simde__m512i r19 = simde_mm512_shrdi_epi16(a, b, 19);
+    simde_test_x86_assert_equal_i16x32(r19, simde_mm512_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r0[32];
+    const int16_t r5[32];
+    const int16_t r15[32];
+    const int16_t r19[32];
+  } test_vec[] = {
+    { {  INT16_C(     0), -INT16_C( 31300),  INT16_C( 24592), -INT16_C( 20480), -INT16_C(  5073), -INT16_C( 25456),  INT16_C( 32761),  INT16_C(     0),
+        -INT16_C(  8004), -INT16_C( 16385),  INT16_C( 16385), -INT16_C(  5810), -INT16_C(  4113),  INT16_C(  9220), -INT16_C( 17793), -INT16_C(  8855),
+        -INT16_C( 32704), -INT16_C( 14627),  INT16_C( 29692),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522),  INT16_C(  5105),
+        -INT16_C(    34),  INT16_C(  4100), -INT16_C( 20216), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      UINT32_C( 126282066),
+      {  INT16_C( 26066),  INT16_C(   160), -INT16_C(  7232), -INT16_C( 15980),  INT16_C( 24479), -INT16_C(  9107),  INT16_C(  4104), -INT16_C(   129),
+         INT16_C(    32), -INT16_C(     4), -INT16_C(    83),  INT16_C(    64), -INT16_C( 16385),  INT16_C(  4096), -INT16_C( 17464), -INT16_C( 28870),
+        -INT16_C( 20350),  INT16_C( 25584), -INT16_C( 10841),  INT16_C(  2212),  INT16_C(     0),  INT16_C(  1173), -INT16_C( 32178), -INT16_C( 30874),
+        -INT16_C( 18778),  INT16_C(  3136), -INT16_C(    19), -INT16_C( 25692), -INT16_C(    97), -INT16_C(  1793),  INT16_C(  2234),  INT16_C( 17390) },
+      {  INT16_C(  6618), -INT16_C( 15762), -INT16_C(   513), -INT16_C(   131), -INT16_C(  5064), -INT16_C(  8321), -INT16_C(  8193),  INT16_C( 17927),
+        -INT16_C(  7111),  INT16_C(  1066),  INT16_C(  4288),  INT16_C(   256), -INT16_C(     2), -INT16_C(    13),  INT16_C(   264),  INT16_C(  9685),
+        -INT16_C(    37),  INT16_C( 17410),  INT16_C( 31118), -INT16_C(  9764), -INT16_C(   129),  INT16_C(  8898), -INT16_C( 10132), -INT16_C(     9),
+         INT16_C( 27790),  INT16_C(  9728),  INT16_C( 16359), -INT16_C( 14905),  INT16_C(  8438), -INT16_C(  1332), -INT16_C( 30134),  INT16_C( 27639) },
+      {  INT16_C(     0),  INT16_C(   160),  INT16_C( 24592), -INT16_C( 20480),  INT16_C( 24479), -INT16_C( 25456),  INT16_C(  4104),  INT16_C(     0),
+         INT16_C(    32), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(    64), -INT16_C(  4113),  INT16_C(  4096), -INT16_C( 17464), -INT16_C( 28870),
+        -INT16_C( 32704),  INT16_C( 25584), -INT16_C( 10841),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522), -INT16_C( 30874),
+        -INT16_C( 18778),  INT16_C(  3136), -INT16_C(    19), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      {  INT16_C(     0),  INT16_C( 28677),  INT16_C( 24592), -INT16_C( 20480), -INT16_C( 15620), -INT16_C( 25456), -INT16_C(  1920),  INT16_C(     0),
+        -INT16_C( 14335), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(     2), -INT16_C(  4113), -INT16_C( 26496),  INT16_C( 17886), -INT16_C( 21383),
+        -INT16_C( 32704),  INT16_C(  4895),  INT16_C( 30381),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522), -INT16_C( 17349),
+         INT16_C( 30133),  INT16_C(    98),  INT16_C( 16383), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      {  INT16_C(     0), -INT16_C( 31524),  INT16_C( 24592), -INT16_C( 20480), -INT16_C( 10128), -INT16_C( 25456), -INT16_C( 16386),  INT16_C(     0),
+        -INT16_C( 14222), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(   512), -INT16_C(  4113), -INT16_C(    26),  INT16_C(   529),  INT16_C( 19371),
+        -INT16_C( 32704), -INT16_C( 30716), -INT16_C(  3299),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522), -INT16_C(    17),
+        -INT16_C(  9955),  INT16_C( 19456),  INT16_C( 32719), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) },
+      {  INT16_C(     0), -INT16_C( 16364),  INT16_C( 24592), -INT16_C( 20480),  INT16_C(  3059), -INT16_C( 25456), -INT16_C(  7679),  INT16_C(     0),
+         INT16_C(  8196), -INT16_C( 16385),  INT16_C( 16385),  INT16_C(     8), -INT16_C(  4113),  INT16_C( 25088),  INT16_C(  6009), -INT16_C( 19993),
+        -INT16_C( 32704),  INT16_C( 19582), -INT16_C(  9548),  INT16_C( 24303), -INT16_C(  8513), -INT16_C(     2),  INT16_C( 13522), -INT16_C(  3860),
+        -INT16_C( 10540),  INT16_C(   392), -INT16_C(     3), -INT16_C( 19995),  INT16_C( 16388),  INT16_C( 10940), -INT16_C(   141), -INT16_C( 11051) } },
+    { {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128), -INT16_C( 27770),  INT16_C(    96), -INT16_C( 16481),
+         INT16_C( 28014),  INT16_C( 27854),  INT16_C( 19423), -INT16_C( 32624), -INT16_C( 10273),  INT16_C( 16384), -INT16_C( 16182),  INT16_C(  2584),
+        -INT16_C(  7558),  INT16_C( 26452),  INT16_C( 30131), -INT16_C( 27986),  INT16_C(  9624), -INT16_C( 21898), -INT16_C( 14186),  INT16_C( 22943),
+        -INT16_C( 14174),  INT16_C(  1028), -INT16_C(   513), -INT16_C( 18230), -INT16_C( 26519), -INT16_C(  4407),  INT16_C(    56),  INT16_C(  2129) },
+      UINT32_C( 626518368),
+      { -INT16_C( 29280),  INT16_C(     8),  INT16_C( 10304), -INT16_C(     1), -INT16_C(     1), -INT16_C( 11418),  INT16_C( 32639), -INT16_C(  1033),
+         INT16_C(  1025),  INT16_C(  1028), -INT16_C(   133), -INT16_C(  8875), -INT16_C(   898),  INT16_C(  8517), -INT16_C( 22785), -INT16_C( 29142),
+         INT16_C( 22854), -INT16_C( 23009), -INT16_C( 21266),  INT16_C(  8320), -INT16_C(   513), -INT16_C( 31577), -INT16_C( 28522), -INT16_C(     1),
+        -INT16_C(  4353),  INT16_C( 24845), -INT16_C( 17409),  INT16_C( 30087), -INT16_C( 24988), -INT16_C(   643),  INT16_C(    32), -INT16_C(   129) },
+      { -INT16_C( 32253),  INT16_C(  7176), -INT16_C( 31861), -INT16_C(     9), -INT16_C( 32764), -INT16_C( 20014),  INT16_C(  4194), -INT16_C(  4904),
+         INT16_C( 27599), -INT16_C(  8193),  INT16_C(  4603), -INT16_C( 28490),  INT16_C(     0),  INT16_C( 17107), -INT16_C( 30521), -INT16_C(    11),
+        -INT16_C( 12311), -INT16_C(  7181), -INT16_C(  6462),  INT16_C( 30916),  INT16_C( 28462),  INT16_C(     0),  INT16_C(  2160),  INT16_C( 29391),
+         INT16_C( 17536),  INT16_C(   136), -INT16_C(  3921), -INT16_C( 25832),  INT16_C(  3072),  INT16_C(    60),  INT16_C(  1024),  INT16_C(   532) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128), -INT16_C( 11418),  INT16_C( 32639), -INT16_C( 16481),
+         INT16_C(  1025),  INT16_C( 27854),  INT16_C( 19423), -INT16_C(  8875), -INT16_C( 10273),  INT16_C(  8517), -INT16_C( 22785), -INT16_C( 29142),
+         INT16_C( 22854), -INT16_C( 23009), -INT16_C( 21266), -INT16_C( 27986), -INT16_C(   513), -INT16_C( 21898), -INT16_C( 28522),  INT16_C( 22943),
+        -INT16_C(  4353),  INT16_C(  1028), -INT16_C( 17409), -INT16_C( 18230), -INT16_C( 26519), -INT16_C(   643),  INT16_C(    56),  INT16_C(  2129) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128), -INT16_C( 26981),  INT16_C(  5115), -INT16_C( 16481),
+         INT16_C( 30752),  INT16_C( 27854),  INT16_C( 19423), -INT16_C( 18710), -INT16_C( 10273), -INT16_C( 26358),  INT16_C( 15671), -INT16_C( 21391),
+         INT16_C( 19146), -INT16_C( 25296),  INT16_C(  5479), -INT16_C( 27986),  INT16_C( 30703), -INT16_C( 21898), -INT16_C( 31612),  INT16_C( 22943),
+         INT16_C(  1911),  INT16_C(  1028),  INT16_C( 32223), -INT16_C( 18230), -INT16_C( 26519), -INT16_C(  6165),  INT16_C(    56),  INT16_C(  2129) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128),  INT16_C( 25509),  INT16_C(  8388), -INT16_C( 16481),
+        -INT16_C( 10338),  INT16_C( 27854),  INT16_C( 19423),  INT16_C(  8557), -INT16_C( 10273), -INT16_C( 31322),  INT16_C(  4495), -INT16_C(    21),
+        -INT16_C( 24622), -INT16_C( 14361), -INT16_C( 12923), -INT16_C( 27986), -INT16_C(  8611), -INT16_C( 21898),  INT16_C(  4321),  INT16_C( 22943),
+        -INT16_C( 30463),  INT16_C(  1028), -INT16_C(  7841), -INT16_C( 18230), -INT16_C( 26519),  INT16_C(   121),  INT16_C(    56),  INT16_C(  2129) },
+      {  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145), -INT16_C(  7169),  INT16_C(   128),  INT16_C( 23148),  INT16_C( 20463), -INT16_C( 16481),
+        -INT16_C(  8064),  INT16_C( 27854),  INT16_C( 19423), -INT16_C(  9302), -INT16_C( 10273),  INT16_C( 25640), -INT16_C(  2849), -INT16_C( 20027),
+         INT16_C( 11048),  INT16_C( 29891),  INT16_C( 21917), -INT16_C( 27986), -INT16_C(  8257), -INT16_C( 21898),  INT16_C(  4626),  INT16_C( 22943),
+         INT16_C(  7647),  INT16_C(  1028), -INT16_C(  2177), -INT16_C( 18230), -INT16_C( 26519), -INT16_C( 24657),  INT16_C(    56),  INT16_C(  2129) } },
+    { {  INT16_C(   256), -INT16_C( 20406),  INT16_C(  4392), -INT16_C( 32766), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129),  INT16_C(  8264),
+         INT16_C(   513), -INT16_C( 12725),  INT16_C( 18234), -INT16_C( 20051),  INT16_C( 25821),  INT16_C( 24575),  INT16_C(   516), -INT16_C(   996),
+        -INT16_C( 20231), -INT16_C(     2),  INT16_C(  2104),  INT16_C(  2386),  INT16_C(  2542),  INT16_C( 10446), -INT16_C(     1),  INT16_C(   513),
+        -INT16_C(  8705),  INT16_C( 29406),  INT16_C( 14473), -INT16_C(     3), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     4), -INT16_C( 25567) },
+      UINT32_C(3382049935),
+      {  INT16_C( 14209),  INT16_C(  7147), -INT16_C(    65), -INT16_C( 29424),  INT16_C( 11935), -INT16_C( 16393), -INT16_C( 16401), -INT16_C(  7018),
+         INT16_C(  1263),  INT16_C( 21022), -INT16_C( 15163),  INT16_C( 23677),  INT16_C(     2), -INT16_C( 31623),  INT16_C( 12544),  INT16_C( 24571),
+        -INT16_C(  2082), -INT16_C(    81),  INT16_C( 25738),  INT16_C(     0),  INT16_C( 11423), -INT16_C( 29704), -INT16_C(  2053), -INT16_C( 28591),
+         INT16_C(   137), -INT16_C(    65),  INT16_C(     0),  INT16_C(  5364), -INT16_C(  5898),  INT16_C( 14925),  INT16_C(     0),  INT16_C(  1216) },
+      { -INT16_C(  3786),  INT16_C(   288),  INT16_C( 16177), -INT16_C( 23670),  INT16_C( 16385),  INT16_C(  1537), -INT16_C( 17356), -INT16_C(   261),
+        -INT16_C( 21892), -INT16_C( 13384), -INT16_C(   193), -INT16_C( 27852),  INT16_C(  8669),  INT16_C( 29363),  INT16_C( 29062),  INT16_C( 17132),
+        -INT16_C( 32398),  INT16_C(    64), -INT16_C( 21746), -INT16_C(    36),  INT16_C(    19),  INT16_C(  4892), -INT16_C( 17804), -INT16_C(  4536),
+        -INT16_C( 11357),  INT16_C(     0),  INT16_C(  8760), -INT16_C( 30519),  INT16_C(   400),  INT16_C( 16908),  INT16_C(     1),  INT16_C( 24580) },
+      {  INT16_C( 14209),  INT16_C(  7147), -INT16_C(    65), -INT16_C( 29424), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129), -INT16_C(  7018),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C( 15163),  INT16_C( 23677),  INT16_C(     2), -INT16_C( 31623),  INT16_C( 12544),  INT16_C( 24571),
+        -INT16_C(  2082), -INT16_C(     2),  INT16_C( 25738),  INT16_C(  2386),  INT16_C( 11423),  INT16_C( 10446), -INT16_C(     1), -INT16_C( 28591),
+         INT16_C(   137),  INT16_C( 29406),  INT16_C( 14473),  INT16_C(  5364), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     0),  INT16_C(  1216) },
+      { -INT16_C( 20036),  INT16_C(   223), -INT16_C( 28675),  INT16_C( 21608), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129), -INT16_C(  8412),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C(   474), -INT16_C( 23837), -INT16_C(  6144), -INT16_C( 25565),  INT16_C( 12680),  INT16_C( 25343),
+        -INT16_C( 26690), -INT16_C(     2),  INT16_C( 29476),  INT16_C(  2386), -INT16_C( 26268),  INT16_C( 10446), -INT16_C(     1),  INT16_C( 17538),
+         INT16_C(  6148),  INT16_C( 29406),  INT16_C( 14473),  INT16_C( 18599), -INT16_C( 13686),  INT16_C(     2),  INT16_C(  2048),  INT16_C(  8230) },
+      { -INT16_C(  7572),  INT16_C(   576),  INT16_C( 32355),  INT16_C( 18197), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129), -INT16_C(   521),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C(   385),  INT16_C(  9832),  INT16_C( 17338), -INT16_C(  6809), -INT16_C(  7412), -INT16_C( 31272),
+         INT16_C(   741), -INT16_C(     2),  INT16_C( 22044),  INT16_C(  2386),  INT16_C(    38),  INT16_C( 10446), -INT16_C(     1), -INT16_C(  9071),
+        -INT16_C( 22714),  INT16_C( 29406),  INT16_C( 14473),  INT16_C(  4498), -INT16_C( 13686),  INT16_C(     2),  INT16_C(     2), -INT16_C( 16376) },
+      { -INT16_C( 14608),  INT16_C(   893),  INT16_C( 16375),  INT16_C( 20898), -INT16_C( 16385),  INT16_C( 16424), -INT16_C(   129),  INT16_C( 31890),
+         INT16_C(   513), -INT16_C( 12725), -INT16_C(  1896), -INT16_C( 29809), -INT16_C( 24576),  INT16_C( 28815), -INT16_C( 14816), -INT16_C( 29697),
+         INT16_C( 24315), -INT16_C(     2), -INT16_C( 13167),  INT16_C(  2386),  INT16_C( 26003),  INT16_C( 10446), -INT16_C(     1),  INT16_C(  4618),
+         INT16_C( 24593),  INT16_C( 29406),  INT16_C( 14473),  INT16_C(  8862), -INT16_C( 13686),  INT16_C(     2),  INT16_C(  8192), -INT16_C( 32616) } },
+    { {  INT16_C( 24551),  INT16_C(     4), -INT16_C(     1), -INT16_C(  8197), -INT16_C(     1),  INT16_C(  1792),  INT16_C( 24386), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(  4497),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+         INT16_C( 14656),  INT16_C(  3700), -INT16_C( 12717), -INT16_C( 24568),  INT16_C( 15895),  INT16_C( 20299),  INT16_C(   325), -INT16_C(    57),
+         INT16_C(   825), -INT16_C(  6503),  INT16_C( 16383),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      UINT32_C(  87363670),
+      { -INT16_C(  9217), -INT16_C( 28887),  INT16_C(  3457),  INT16_C(  8092), -INT16_C(  4517), -INT16_C( 24180),  INT16_C(     0),  INT16_C(  3144),
+         INT16_C( 30860),  INT16_C(  2048), -INT16_C(   258),  INT16_C( 24733),  INT16_C(    34), -INT16_C(  4053), -INT16_C(    16), -INT16_C( 23505),
+        -INT16_C(  9536),  INT16_C( 22225),  INT16_C( 14549), -INT16_C( 17086), -INT16_C(  6332),  INT16_C(  1026),  INT16_C( 31739),  INT16_C(   140),
+        -INT16_C(  2049),  INT16_C(     0),  INT16_C( 28378), -INT16_C(  4099), -INT16_C( 14272),       INT16_MIN,  INT16_C( 17788),  INT16_C(   640) },
+      { -INT16_C( 16153), -INT16_C(  1025),  INT16_C( 16696), -INT16_C( 16401),  INT16_C( 23009),  INT16_C(   128), -INT16_C( 16393), -INT16_C(  4097),
+         INT16_C(   260), -INT16_C(  8225), -INT16_C(   353), -INT16_C( 24405), -INT16_C( 29950), -INT16_C(  7410),  INT16_C(  2057), -INT16_C( 17032),
+        -INT16_C(  2995),  INT16_C( 17872),  INT16_C( 32148),  INT16_C( 24575), -INT16_C(  4360),  INT16_C(   581), -INT16_C(   385),  INT16_C( 21514),
+         INT16_C( 10487), -INT16_C( 26548), -INT16_C( 32672),  INT16_C(  1280),  INT16_C(    56), -INT16_C(  1537),  INT16_C(     0),  INT16_C(   131) },
+      {  INT16_C( 24551), -INT16_C( 28887),  INT16_C(  3457), -INT16_C(  8197), -INT16_C(  4517),  INT16_C(  1792),  INT16_C(     0), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(    34),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+        -INT16_C(  9536),  INT16_C(  3700),  INT16_C( 14549), -INT16_C( 24568), -INT16_C(  6332),  INT16_C(  1026),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C(  2049), -INT16_C(  6503),  INT16_C( 28378),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      {  INT16_C( 24551), -INT16_C(   903), -INT16_C( 16276), -INT16_C(  8197),  INT16_C(  3954),  INT16_C(  1792), -INT16_C( 18432), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(  4097),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+         INT16_C( 28374),  INT16_C(  3700), -INT16_C( 24122), -INT16_C( 24568), -INT16_C( 14534),  INT16_C( 10272),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C( 16449), -INT16_C(  6503),  INT16_C(   886),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      {  INT16_C( 24551), -INT16_C(  2049), -INT16_C( 32144), -INT16_C(  8197), -INT16_C( 19517),  INT16_C(  1792),  INT16_C( 32750), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C(  5636),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+        -INT16_C(  5989),  INT16_C(  3700), -INT16_C(  1240), -INT16_C( 24568), -INT16_C(  8719),  INT16_C(  1162),  INT16_C(   325), -INT16_C(    57),
+         INT16_C( 20975), -INT16_C(  6503),  INT16_C(   192),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) },
+      {  INT16_C( 24551), -INT16_C(  3611),  INT16_C(   432), -INT16_C(  8197),  INT16_C( 15819),  INT16_C(  1792), -INT16_C(  8192), -INT16_C( 32247),
+        -INT16_C( 12671),  INT16_C( 18023),  INT16_C(   642),  INT16_C( 27095),  INT16_C( 16388),  INT16_C( 12678), -INT16_C(  8701), -INT16_C( 11878),
+        -INT16_C( 17576),  INT16_C(  3700), -INT16_C( 30950), -INT16_C( 24568),  INT16_C(  7400), -INT16_C( 24448),  INT16_C(   325), -INT16_C(    57),
+        -INT16_C(   257), -INT16_C(  6503),  INT16_C(  3547),  INT16_C( 17247),  INT16_C(  5513), -INT16_C( 20070),  INT16_C(  8194), -INT16_C(     1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_mask_shrdi_epi16(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x32(r0, simde_mm512_loadu_epi16(test_vec[i].r0));
+    simde__m512i r5 = simde_mm512_mask_shrdi_epi16(src, test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x32(r5, simde_mm512_loadu_epi16(test_vec[i].r5));
+    simde__m512i r15 = simde_mm512_mask_shrdi_epi16(src, test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x32(r15, simde_mm512_loadu_epi16(test_vec[i].r15));
+    simde__m512i r19 = simde_mm512_mask_shrdi_epi16(src, test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x32(r19, simde_mm512_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shrdi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r0[32];
+    const int16_t r5[32];
+    const int16_t r15[32];
+    const int16_t r19[32];
+  } test_vec[] = {
+    { UINT32_C(3133690470),
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C( 15912), -INT16_C( 29779), -INT16_C(  7643), -INT16_C(  4340), -INT16_C( 21195),  INT16_C(     6),
+         INT16_C(  2304),  INT16_C( 19136),  INT16_C(  4488), -INT16_C(  3936),  INT16_C( 13806), -INT16_C(     1), -INT16_C( 32496),  INT16_C(   518),
+         INT16_C(     0),  INT16_C( 21294), -INT16_C(     9), -INT16_C( 26881),  INT16_C(    16), -INT16_C(  3125),  INT16_C( 29627),  INT16_C(   128),
+         INT16_C( 11937), -INT16_C(     1),  INT16_C(  6329), -INT16_C( 19026),  INT16_C(   592), -INT16_C(  2625), -INT16_C(    41), -INT16_C(  9109) },
+      { -INT16_C( 29138), -INT16_C(    15),  INT16_C(     0), -INT16_C(     1),  INT16_C(  7571),  INT16_C(    98), -INT16_C( 24064),  INT16_C( 23400),
+        -INT16_C( 32256),  INT16_C(  1324),  INT16_C( 25581),  INT16_C( 19681),  INT16_C( 21649), -INT16_C( 24035), -INT16_C(     2), -INT16_C( 12519),
+        -INT16_C( 27692),  INT16_C( 22864),  INT16_C(  2304), -INT16_C(  8193), -INT16_C(     2), -INT16_C(  2164),  INT16_C( 20497),  INT16_C(  8322),
+         INT16_C( 10240), -INT16_C(  4225),  INT16_C(   128),  INT16_C( 20479),  INT16_C(  4504), -INT16_C(  8961), -INT16_C( 13644), -INT16_C( 18945) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 15912),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4340), -INT16_C( 21195),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 19136),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13806),  INT16_C(     0), -INT16_C( 32496),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26881),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29627),  INT16_C(   128),
+         INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C( 19026),  INT16_C(   592), -INT16_C(  2625),  INT16_C(     0), -INT16_C(  9109) },
+      {  INT16_C(     0), -INT16_C( 30720),  INT16_C(   497),  INT16_C(     0),  INT16_C(     0),  INT16_C(  6008),  INT16_C(  1385),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 25174),  INT16_C(     0),  INT16_C(     0), -INT16_C( 30289),  INT16_C(     0), -INT16_C(  3064),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   841),  INT16_C(     0),  INT16_C(     0), -INT16_C( 29795),  INT16_C(  4100),
+         INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(   595), -INT16_C( 16366), -INT16_C(    83),  INT16_C(     0), -INT16_C(   285) },
+      {  INT16_C(     0), -INT16_C(    30),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   197),  INT16_C( 17409),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(  2648),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22238),  INT16_C(     0), -INT16_C(     3),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16385),  INT16_C(     0),  INT16_C(     0), -INT16_C( 24542),  INT16_C( 16644),
+         INT16_C(     0), -INT16_C(  8449),  INT16_C(     0), -INT16_C( 24577),  INT16_C(  9008), -INT16_C( 17921),  INT16_C(     0),  INT16_C( 27647) },
+      {  INT16_C(     0),  INT16_C(  8192),  INT16_C(  1989),  INT16_C(     0),  INT16_C(     0),  INT16_C( 24033),  INT16_C(  5542),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 30376),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9917),  INT16_C(     0), -INT16_C( 12254),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3361),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11895),  INT16_C( 16400),
+         INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(  2379),  INT16_C(    74), -INT16_C(   329),  INT16_C(     0), -INT16_C(  1139) } },
+    { UINT32_C(1137116126),
+      { -INT16_C(  6447), -INT16_C( 29708),  INT16_C( 26877),  INT16_C( 12465), -INT16_C( 27174),  INT16_C(  1780),  INT16_C( 17047), -INT16_C( 28117),
+        -INT16_C(     1),  INT16_C(  6494), -INT16_C(   131),  INT16_C(  4354), -INT16_C( 14423), -INT16_C( 28929), -INT16_C(  1025), -INT16_C( 25022),
+        -INT16_C( 30192),  INT16_C( 28487), -INT16_C(  1598),  INT16_C(  6408),  INT16_C( 11391),  INT16_C( 32703), -INT16_C(  2309), -INT16_C(   569),
+         INT16_C( 22842), -INT16_C( 30466), -INT16_C(  4481), -INT16_C(  2385),  INT16_C( 32390), -INT16_C(   133),  INT16_C(   522), -INT16_C(  6418) },
+      { -INT16_C(   642),  INT16_C(  1024),  INT16_C( 26029), -INT16_C(  4766),  INT16_C(  9604), -INT16_C( 10796), -INT16_C( 16715), -INT16_C(  2049),
+         INT16_C(  9369),  INT16_C( 26310),  INT16_C( 25473), -INT16_C(  5169),  INT16_C(  8225), -INT16_C(  1041), -INT16_C(     1), -INT16_C( 27456),
+        -INT16_C(     1), -INT16_C(    11), -INT16_C(   232),  INT16_C( 25714), -INT16_C(  8479),  INT16_C(    16), -INT16_C( 26817), -INT16_C( 22477),
+        -INT16_C( 22529),  INT16_C( 21312), -INT16_C( 16385), -INT16_C(  7715),  INT16_C(   513),  INT16_C( 31987), -INT16_C(     1), -INT16_C( 15924) },
+      {  INT16_C(     0), -INT16_C( 29708),  INT16_C( 26877),  INT16_C( 12465), -INT16_C( 27174),  INT16_C(     0),  INT16_C( 17047), -INT16_C( 28117),
+        -INT16_C(     1),  INT16_C(  6494),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 30192),  INT16_C( 28487), -INT16_C(  1598),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2309), -INT16_C(   569),
+         INT16_C( 22842), -INT16_C( 30466),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   522),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(  1119),  INT16_C( 27463),  INT16_C(  4485),  INT16_C(  9390),  INT16_C(     0), -INT16_C( 21996), -INT16_C(   879),
+        -INT16_C( 12289),  INT16_C( 12490),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(   944), -INT16_C( 21638), -INT16_C( 14386),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    73), -INT16_C( 24594),
+        -INT16_C(  1335),  INT16_C(  1095),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2032),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(  2049), -INT16_C( 13478), -INT16_C(  9532),  INT16_C( 19209),  INT16_C(     0),  INT16_C( 32106), -INT16_C(  4097),
+         INT16_C( 18739), -INT16_C( 12916),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(     1), -INT16_C(    22), -INT16_C(   463),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11903),  INT16_C( 20583),
+         INT16_C( 20478), -INT16_C( 22911),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     2),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(  4478), -INT16_C( 21217),  INT16_C( 17942), -INT16_C( 27973),  INT16_C(     0), -INT16_C( 22446), -INT16_C(  3515),
+         INT16_C( 16383), -INT16_C( 15573),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  3774), -INT16_C( 21016),  INT16_C(  7992),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   289),  INT16_C( 32696),
+        -INT16_C(  5337),  INT16_C(  4383),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8127),  INT16_C(     0) } },
+    { UINT32_C( 637836867),
+      {  INT16_C( 18432),  INT16_C( 19859), -INT16_C(  2065),  INT16_C(  8949),  INT16_C(     0),  INT16_C( 16388),  INT16_C( 30591),  INT16_C(    34),
+         INT16_C(  9079), -INT16_C(     1),       INT16_MAX,  INT16_C(  5124),  INT16_C(  2048),  INT16_C( 12845),  INT16_C(    20), -INT16_C( 32418),
+         INT16_C(  7752),  INT16_C( 20780), -INT16_C( 23722),  INT16_C( 32765),  INT16_C(  8208),  INT16_C(   512),  INT16_C( 20329), -INT16_C( 17275),
+         INT16_C(  6201),  INT16_C( 24545), -INT16_C( 21675),  INT16_C(  8300),  INT16_C(  2048),  INT16_C( 10605), -INT16_C(  1122),  INT16_C( 22218) },
+      {  INT16_C(     0),  INT16_C(  8192),  INT16_C(  8192),  INT16_C(     4),  INT16_C(  8200),  INT16_C( 14789), -INT16_C(  1678),  INT16_C(     0),
+        -INT16_C( 32512),  INT16_C( 24576),  INT16_C(  2052),  INT16_C( 31463), -INT16_C(     9),  INT16_C( 28434),  INT16_C(     0),  INT16_C(   256),
+         INT16_C( 23635),  INT16_C( 20535),  INT16_C( 21523),  INT16_C(  4112),  INT16_C(  9344), -INT16_C(    39),  INT16_C(  1594), -INT16_C(   261),
+        -INT16_C( 32544), -INT16_C( 22060), -INT16_C( 29563), -INT16_C( 29260),  INT16_C( 16351), -INT16_C(     5), -INT16_C(  1991),  INT16_C( 15555) },
+      {  INT16_C( 18432),  INT16_C( 19859),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30591),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(     1),       INT16_MAX,  INT16_C(  5124),  INT16_C(  2048),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32418),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 23722),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 24545), -INT16_C( 21675),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10605),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(   576),  INT16_C(   620),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27717),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(  2047),  INT16_C(  9215),  INT16_C( 14496), -INT16_C( 18368),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1034),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 25318),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 23809),  INT16_C( 11610),  INT16_C(     0),  INT16_C(     0), -INT16_C(  9909),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C( 16384),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3356),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 16383),  INT16_C(  4104), -INT16_C(  2610), -INT16_C(    18),  INT16_C(     0),  INT16_C(     0),  INT16_C(   513),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 22489),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 21416),  INT16_C(  6411),  INT16_C(     0),  INT16_C(     0), -INT16_C(    10),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(  2304),  INT16_C(  2482),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20207),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(  8191), -INT16_C( 28673), -INT16_C(  7552), -INT16_C(  7936),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4139),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 29802),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 29700), -INT16_C( 19094),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25901),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 277544090),
+      {  INT16_C(     6), -INT16_C( 16393), -INT16_C(    73), -INT16_C(     3), -INT16_C( 24240), -INT16_C( 16641),  INT16_C( 17948),  INT16_C(   857),
+        -INT16_C( 16009),  INT16_C( 30944), -INT16_C(  4934),  INT16_C(     2),  INT16_C( 19453), -INT16_C( 18500), -INT16_C( 21268),  INT16_C(  1024),
+        -INT16_C( 23909), -INT16_C(  4293), -INT16_C(     5),  INT16_C( 12565), -INT16_C(  1026),  INT16_C( 13451), -INT16_C( 20173), -INT16_C(  2049),
+         INT16_C( 26811), -INT16_C( 30243),  INT16_C(     8), -INT16_C(  8360),  INT16_C(  1664),  INT16_C(     0),  INT16_C(     8), -INT16_C(     1) },
+      { -INT16_C(   131), -INT16_C(  2081),  INT16_C(   103),  INT16_C( 18946),  INT16_C(  2176),  INT16_C( 13431), -INT16_C( 15513), -INT16_C(  4105),
+         INT16_C( 13106),  INT16_C( 31690), -INT16_C(   129),  INT16_C( 16682),  INT16_C( 30448), -INT16_C( 32721), -INT16_C(     1),  INT16_C(   304),
+        -INT16_C(  3106),  INT16_C( 12312), -INT16_C( 30720),  INT16_C( 24543), -INT16_C(   129), -INT16_C( 10274), -INT16_C( 10753),  INT16_C(   512),
+        -INT16_C( 24138),  INT16_C(  3809),  INT16_C(  1152), -INT16_C(  4502),  INT16_C( 20962), -INT16_C( 20229),  INT16_C( 15249),  INT16_C(  2176) },
+      {  INT16_C(     0), -INT16_C( 16393),  INT16_C(     0), -INT16_C(     3), -INT16_C( 24240),  INT16_C(     0),  INT16_C(     0),  INT16_C(   857),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(  4934),  INT16_C(     2),  INT16_C( 19453), -INT16_C( 18500), -INT16_C( 21268),  INT16_C(  1024),
+         INT16_C(     0), -INT16_C(  4293),  INT16_C(     0),  INT16_C( 12565),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2049),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1664),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(   513),  INT16_C(     0),  INT16_C(  6143),  INT16_C(  1290),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18406),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(   155),  INT16_C( 20480), -INT16_C( 32161),  INT16_C( 32189), -INT16_C(   665), -INT16_C( 32736),
+         INT16_C(     0), -INT16_C( 14471),  INT16_C(     0), -INT16_C(  1656),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1983),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4148),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  4161),  INT16_C(     0), -INT16_C( 27643),  INT16_C(  4353),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8210),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(   257), -INT16_C( 32172), -INT16_C(  4640),  INT16_C(    95), -INT16_C(     1),  INT16_C(   608),
+         INT16_C(     0),  INT16_C( 24625),  INT16_C(     0), -INT16_C( 16450),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1025),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 23612),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(  2050),  INT16_C(     0),  INT16_C( 24575),  INT16_C(  5162),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8085),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(   617),  INT16_C( 16384),  INT16_C(  2431), -INT16_C(  2313), -INT16_C(  2659),  INT16_C(   128),
+         INT16_C(     0),  INT16_C(  7655),  INT16_C(     0), -INT16_C(  6622),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7935),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16592),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_maskz_shrdi_epi16(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i16x32(r0, simde_mm512_loadu_epi16(test_vec[i].r0));
+    simde__m512i r5 = simde_mm512_maskz_shrdi_epi16(test_vec[i].k, a, b, 5);
+    simde_test_x86_assert_equal_i16x32(r5, simde_mm512_loadu_epi16(test_vec[i].r5));
+    simde__m512i r15 = simde_mm512_maskz_shrdi_epi16(test_vec[i].k, a, b, 15);
+    simde_test_x86_assert_equal_i16x32(r15, simde_mm512_loadu_epi16(test_vec[i].r15));
+    simde__m512i r19 = simde_mm512_maskz_shrdi_epi16(test_vec[i].k, a, b, 19);
+    simde_test_x86_assert_equal_i16x32(r19, simde_mm512_loadu_epi16(test_vec[i].r19));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r7[16];
+    const int32_t r31[16];
+    const int32_t r40[16];
+  } test_vec[] = {
+    { { -INT32_C(  1244653521),  INT32_C(      532608),  INT32_C(  1490034520),  INT32_C(   570949676), -INT32_C(   884998241),  INT32_C(        4160),  INT32_C(     2441217), -INT32_C(     3170819),
+        -INT32_C(       65537), -INT32_C(  1627406369),  INT32_C(  1032600085), -INT32_C(    26270587), -INT32_C(    67764225), -INT32_C(    19034113), -INT32_C(   537661457), -INT32_C(  1204478447) },
+      { -INT32_C(      268321),  INT32_C(  2147467003), -INT32_C(  1725400487),  INT32_C(   366017543), -INT32_C(     2129929),  INT32_C(  2074869759), -INT32_C(   139854849),  INT32_C(  1979432959),
+        -INT32_C(  1058764363),  INT32_C(   140247040),  INT32_C(   266498793),  INT32_C(  1930558264),  INT32_C(   497985196),  INT32_C(    30269960),  INT32_C(   745702234), -INT32_C(      135169) },
+      { -INT32_C(  1244653521),  INT32_C(      532608),  INT32_C(  1490034520),  INT32_C(   570949676), -INT32_C(   884998241),  INT32_C(        4160),  INT32_C(     2441217), -INT32_C(     3170819),
+        -INT32_C(       65537), -INT32_C(  1627406369),  INT32_C(  1032600085), -INT32_C(    26270587), -INT32_C(    67764225), -INT32_C(    19034113), -INT32_C(   537661457), -INT32_C(  1204478447) },
+      { -INT32_C(  1083465680), -INT32_C(   167767999), -INT32_C(  1296981954),  INT32_C(   239341568), -INT32_C(   275349505), -INT32_C(    33554400), -INT32_C(    33535360), -INT32_C(       24773),
+         INT32_C(  1811938815),  INT32_C(    20840319), -INT32_C(   763684748),  INT32_C(  1912397385),  INT32_C(  1509420031),  INT32_C(   301841183), -INT32_C(  1245714465), -INT32_C(     9409988) },
+      { -INT32_C(      536641), -INT32_C(       33290),  INT32_C(   844166322),  INT32_C(   732035086), -INT32_C(     4259857), -INT32_C(   145227778), -INT32_C(   279709698), -INT32_C(   336101377),
+        -INT32_C(  2117528725),  INT32_C(   280494081),  INT32_C(   532997586), -INT32_C(   433850767),  INT32_C(   995970393),  INT32_C(    60539921),  INT32_C(  1491404469), -INT32_C(      270337) },
+      { -INT32_C(   541732840), -INT32_C(    83884000),  INT32_C(  1498992671),  INT32_C(   119670784), -INT32_C(   137674753), -INT32_C(    16777200), -INT32_C(    16767680), -INT32_C(       12387),
+        -INT32_C(  1241514241),  INT32_C(    10420159), -INT32_C(   381842374),  INT32_C(   956198692), -INT32_C(  1392773633),  INT32_C(   150920591),  INT32_C(  1524626415), -INT32_C(     4704994) } },
+    { { -INT32_C(  1833002144),  INT32_C(  1292629648), -INT32_C(       36865), -INT32_C(   268460225),  INT32_C(           1), -INT32_C(   495741653),  INT32_C(  1465777837),  INT32_C(  1647536913),
+        -INT32_C(    34603105), -INT32_C(   701477440), -INT32_C(   582267700), -INT32_C(    50335745),  INT32_C(  2042914293), -INT32_C(   100868641), -INT32_C(   394678946),  INT32_C(   857154437) },
+      {  INT32_C(   134234128),  INT32_C(  1764619045), -INT32_C(      270337),  INT32_C(   337958347),  INT32_C(    17825856),  INT32_C(   104246715),  INT32_C(      540672), -INT32_C(    67912737),
+         INT32_C(  1429361952), -INT32_C(    36241409),  INT32_C(    92323968), -INT32_C(   101187594),  INT32_C(   554172464), -INT32_C(   613533951), -INT32_C(  1379872952),  INT32_C(   537202768) },
+      { -INT32_C(  1833002144),  INT32_C(  1292629648), -INT32_C(       36865), -INT32_C(   268460225),  INT32_C(           1), -INT32_C(   495741653),  INT32_C(  1465777837),  INT32_C(  1647536913),
+        -INT32_C(    34603105), -INT32_C(   701477440), -INT32_C(   582267700), -INT32_C(    50335745),  INT32_C(  2042914293), -INT32_C(   100868641), -INT32_C(   394678946),  INT32_C(   857154437) },
+      {  INT32_C(   556105014),  INT32_C(  1251612653), -INT32_C(         289), -INT32_C(  1746927810),            INT32_MIN,  INT32_C(  2009392938),  INT32_C(    11451389), -INT32_C(  1094424874),
+         INT32_C(  1107025919), -INT32_C(     5480293),  INT32_C(    29005465), -INT32_C(   302383137),  INT32_C(  1626573003),  INT32_C(    66320827), -INT32_C(  1848577190), -INT32_C(  1603916217) },
+      {  INT32_C(   268468257), -INT32_C(   765729206), -INT32_C(      540673),  INT32_C(   675916695),  INT32_C(    35651712),  INT32_C(   208493431),  INT32_C(     1081344), -INT32_C(   135825474),
+        -INT32_C(  1436243391), -INT32_C(    72482817),  INT32_C(   184647937), -INT32_C(   202375187),  INT32_C(  1108344928), -INT32_C(  1227067901),  INT32_C(  1535221393),  INT32_C(  1074405536) },
+      {  INT32_C(   278052507),  INT32_C(   625806326), -INT32_C(         145), -INT32_C(   873463905),  INT32_C(  1073741824), -INT32_C(  1142787179),  INT32_C(     5725694), -INT32_C(   547212437),
+         INT32_C(   553512959), -INT32_C(     2740147), -INT32_C(  2132980916), -INT32_C(   151191569),  INT32_C(   813286501),  INT32_C(    33160413),  INT32_C(  1223195053),  INT32_C(  1345525539) } },
+    { { -INT32_C(    94115761), -INT32_C(  1210750875),  INT32_C(  1095189171),  INT32_C(   168821764),  INT32_C(  2146959359),  INT32_C(   167773448),  INT32_C(  1073742592),  INT32_C(   404946946),
+        -INT32_C(  1076265119),  INT32_C(  1269516311),  INT32_C(           0), -INT32_C(   958270276), -INT32_C(   559187101),  INT32_C(   805312769),  INT32_C(   900405589),  INT32_C(   897999899) },
+      { -INT32_C(    67117061),  INT32_C(   367392541), -INT32_C(   456009675), -INT32_C(     7471649), -INT32_C(         201),  INT32_C(   134217728), -INT32_C(  1158455895), -INT32_C(   590721793),
+         INT32_C(  1241261971), -INT32_C(       65569), -INT32_C(      315133),  INT32_C(   115633749), -INT32_C(   886546401), -INT32_C(  1702249115), -INT32_C(  1948874963),  INT32_C(      534592) },
+      { -INT32_C(    94115761), -INT32_C(  1210750875),  INT32_C(  1095189171),  INT32_C(   168821764),  INT32_C(  2146959359),  INT32_C(   167773448),  INT32_C(  1073742592),  INT32_C(   404946946),
+        -INT32_C(  1076265119),  INT32_C(  1269516311),  INT32_C(           0), -INT32_C(   958270276), -INT32_C(   559187101),  INT32_C(   805312769),  INT32_C(   900405589),  INT32_C(   897999899) },
+      { -INT32_C(   134953008),  INT32_C(   997173968),  INT32_C(  1786941061), -INT32_C(  1105977336),  INT32_C(  1862266879),  INT32_C(     1310730),  INT32_C(  1384120326), -INT32_C(    30390784),
+         INT32_C(   662680318), -INT32_C(  1097378160),  INT32_C(   100663296), -INT32_C(  1416772631),  INT32_C(  1069373174), -INT32_C(   899678158),  INT32_C(  1516983858), -INT32_C(  2140468024) },
+      { -INT32_C(   134234121),  INT32_C(   734785083), -INT32_C(   912019350), -INT32_C(    14943298), -INT32_C(         402),  INT32_C(   268435456),  INT32_C(  1978055506), -INT32_C(  1181443586),
+        -INT32_C(  1812443353), -INT32_C(      131138), -INT32_C(      630266),  INT32_C(   231267499), -INT32_C(  1773092801),  INT32_C(   890469066),  INT32_C(   397217370),  INT32_C(     1069184) },
+      { -INT32_C(    67476504),  INT32_C(   498586984),  INT32_C(   893470530), -INT32_C(   552988668),  INT32_C(   931133439),  INT32_C(      655365), -INT32_C(  1455423485), -INT32_C(    15195392),
+        -INT32_C(  1816143489), -INT32_C(   548689080),  INT32_C(    50331648),  INT32_C(  1439097332),  INT32_C(   534686587),  INT32_C(  1697644569),  INT32_C(   758491929),  INT32_C(  1077249636) } },
+    { {  INT32_C(    33554432),  INT32_C(  1059973516),  INT32_C(  1004503039), -INT32_C(   549454353), -INT32_C(   827250820),  INT32_C(    41976832),  INT32_C(    68239360),  INT32_C(        2304),
+        -INT32_C(   612442114), -INT32_C(  1576910848), -INT32_C(   539099173), -INT32_C(  1116006409),  INT32_C(  1965029406), -INT32_C(   525238636), -INT32_C(  1633845989), -INT32_C(  1074274561) },
+      {  INT32_C(  1881454561),  INT32_C(  1207959681), -INT32_C(      132611), -INT32_C(  1537736499), -INT32_C(   842464817),  INT32_C(  1450956187), -INT32_C(    33554721),  INT32_C(           0),
+         INT32_C(  1724560853),  INT32_C(  1106187640), -INT32_C(  1599916560), -INT32_C(  1478329794), -INT32_C(   268570753),  INT32_C(  2105407487), -INT32_C(  1081219632), -INT32_C(     6308161) },
+      {  INT32_C(    33554432),  INT32_C(  1059973516),  INT32_C(  1004503039), -INT32_C(   549454353), -INT32_C(   827250820),  INT32_C(    41976832),  INT32_C(    68239360),  INT32_C(        2304),
+        -INT32_C(   612442114), -INT32_C(  1576910848), -INT32_C(   539099173), -INT32_C(  1116006409),  INT32_C(  1965029406), -INT32_C(   525238636), -INT32_C(  1633845989), -INT32_C(  1074274561) },
+      { -INT32_C(  1039925248),  INT32_C(    41835475), -INT32_C(    92815617), -INT32_C(  1682014213), -INT32_C(  1617075634),  INT32_C(   906297608), -INT32_C(  1106763136),  INT32_C(          18),
+        -INT32_C(  1414070849), -INT32_C(   247200640), -INT32_C(   507528193),  INT32_C(  2105210415), -INT32_C(    18202640), -INT32_C(     4103427), -INT32_C(  1589822726),  INT32_C(  2139090877) },
+      { -INT32_C(   532058174), -INT32_C(  1879047934), -INT32_C(      265222),  INT32_C(  1219494299), -INT32_C(  1684929633), -INT32_C(  1393054922), -INT32_C(    67109442),  INT32_C(           0),
+        -INT32_C(   845845589), -INT32_C(  2082592015),  INT32_C(  1095134177),  INT32_C(  1338307709), -INT32_C(   537141506), -INT32_C(    84152321),  INT32_C(  2132528033), -INT32_C(    12616321) },
+      { -INT32_C(   519962624), -INT32_C(  2126565911), -INT32_C(    46407809), -INT32_C(   841007107), -INT32_C(   808537817), -INT32_C(  1694334844), -INT32_C(   553381568),  INT32_C(           9),
+        -INT32_C(   707035425),  INT32_C(  2023883328), -INT32_C(   253764097),  INT32_C(  1052605207),  INT32_C(  2138382328), -INT32_C(     2051714), -INT32_C(   794911363), -INT32_C(  1077938210) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_shrdi_epi32(a, b, 0);
+    simde_test_x86_assert_equal_i32x16(r0, simde_mm512_loadu_epi32(test_vec[i].r0));
+    simde__m512i r7 = simde_mm512_shrdi_epi32(a, b, 7);
+    simde_test_x86_assert_equal_i32x16(r7, simde_mm512_loadu_epi32(test_vec[i].r7));
+    simde__m512i r31 = simde_mm512_shrdi_epi32(a, b, 31);
+    simde_test_x86_assert_equal_i32x16(r31, simde_mm512_loadu_epi32(test_vec[i].r31));
+    simde__m512i r40 = simde_mm512_shrdi_epi32(a, b, 40);
+    simde_test_x86_assert_equal_i32x16(r40, simde_mm512_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r7[16];
+    const int32_t r31[16];
+    const int32_t r40[16];
+  } test_vec[] = {
+    { {  INT32_C(    35655712), -INT32_C(  1911251547),  INT32_C(  1113821632), -INT32_C(     1050633), -INT32_C(  2073296736),  INT32_C(   783990111),  INT32_C(   317983736), -INT32_C(  1078149162),
+        -INT32_C(   447841813),  INT32_C(  1385676859),  INT32_C(  1085382714), -INT32_C(  1610878977),  INT32_C(  2010906095), -INT32_C(    34349313),  INT32_C(   512301638),  INT32_C(   204031351) },
+      UINT16_C(23130),
+      { -INT32_C(  1043675061),  INT32_C(   308676699),  INT32_C(       82192),  INT32_C(  2143280575), -INT32_C(   920613932), -INT32_C(  1221346711),  INT32_C(  1053002349), -INT32_C(  1562039715),
+        -INT32_C(   272629761), -INT32_C(  1985427382),  INT32_C(   170760329),  INT32_C(    75442273),  INT32_C(  1223036070),  INT32_C(       50436),  INT32_C(   278708073), -INT32_C(  2130704380) },
+      { -INT32_C(  1930634630),  INT32_C(  1009906786),  INT32_C(   303632099), -INT32_C(  1258224488),  INT32_C(   541082692),  INT32_C(  1605990889),  INT32_C(   846810964), -INT32_C(   923894966),
+         INT32_C(    53129692), -INT32_C(  1175265275), -INT32_C(     8519686),  INT32_C(    67108936),  INT32_C(  1632558639),  INT32_C(   559038528), -INT32_C(   303169537),  INT32_C(  2007387323) },
+      {  INT32_C(    35655712),  INT32_C(   308676699),  INT32_C(  1113821632),  INT32_C(  2143280575), -INT32_C(   920613932),  INT32_C(   783990111),  INT32_C(  1053002349), -INT32_C(  1078149162),
+        -INT32_C(   447841813), -INT32_C(  1985427382),  INT32_C(  1085382714),  INT32_C(    75442273),  INT32_C(  1223036070), -INT32_C(    34349313),  INT32_C(   278708073),  INT32_C(   204031351) },
+      {  INT32_C(    35655712), -INT32_C(  1004221424),  INT32_C(  1113821632),  INT32_C(   822050747), -INT32_C(  1986903785),  INT32_C(   783990111), -INT32_C(  1468168428), -INT32_C(  1078149162),
+        -INT32_C(   447841813),  INT32_C(   185815440),  INT32_C(  1085382714), -INT32_C(  1878458800),  INT32_C(  1586613273), -INT32_C(    34349313), -INT32_C(    31377026),  INT32_C(   204031351) },
+      {  INT32_C(    35655712),  INT32_C(  2019813572),  INT32_C(  1113821632),  INT32_C(  1778518320),  INT32_C(  1082165385),  INT32_C(   783990111),  INT32_C(  1693621928), -INT32_C(  1078149162),
+        -INT32_C(   447841813),  INT32_C(  1944436747),  INT32_C(  1085382714),  INT32_C(   134217872), -INT32_C(  1029850018), -INT32_C(    34349313), -INT32_C(   606339074),  INT32_C(   204031351) },
+      {  INT32_C(    35655712),  INT32_C(  1645372936),  INT32_C(  1113821632), -INT32_C(  1736458275),  INT32_C(  1154031755),  INT32_C(   783990111),  INT32_C(  1413399434), -INT32_C(  1078149162),
+        -INT32_C(   447841813),  INT32_C(    92907720),  INT32_C(  1085382714),  INT32_C(  1208254248),  INT32_C(   793306636), -INT32_C(    34349313), -INT32_C(    15688513),  INT32_C(   204031351) } },
+    { {  INT32_C(    16844041), -INT32_C(        1025), -INT32_C(    16859137),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+         INT32_C(   268577092), -INT32_C(  1714608292), -INT32_C(       81953),  INT32_C(    16809985), -INT32_C(     3151377),  INT32_C(   119795602),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      UINT16_C(11527),
+      { -INT32_C(  1073775617), -INT32_C(  1465221219),  INT32_C(       69888), -INT32_C(       11266),  INT32_C(     1048612), -INT32_C(  1224737025),  INT32_C(  1783704081), -INT32_C(      262658),
+        -INT32_C(   285246469), -INT32_C(   134354193), -INT32_C(     8539170), -INT32_C(   147846139),  INT32_C(    21266976),  INT32_C(        2049), -INT32_C(   327055048),  INT32_C(           0) },
+      { -INT32_C(  2147481599),  INT32_C(   630345613),  INT32_C(  1613275184), -INT32_C(  1082343489), -INT32_C(   401897647), -INT32_C(       16513), -INT32_C(   428706228),  INT32_C(   644080504),
+        -INT32_C(  1074266371),  INT32_C(  1744189488),  INT32_C(  1902262391), -INT32_C(       33537), -INT32_C(  1310774943),  INT32_C(        8218),  INT32_C(  2146402233), -INT32_C(   805340163) },
+      { -INT32_C(  1073775617), -INT32_C(  1465221219),  INT32_C(       69888),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+        -INT32_C(   285246469), -INT32_C(  1714608292), -INT32_C(     8539170), -INT32_C(   147846139), -INT32_C(     3151377),  INT32_C(        2049),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      {  INT32_C(    58719991),  INT32_C(   458315007),  INT32_C(  1610613282),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+        -INT32_C(    69337353), -INT32_C(  1714608292), -INT32_C(   268502169), -INT32_C(     1155048), -INT32_C(     3151377),  INT32_C(   872415248),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      {  INT32_C(        4099),  INT32_C(  1260691227), -INT32_C(  1068416928),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+         INT32_C(  2146434555), -INT32_C(  1714608292), -INT32_C(   490442513), -INT32_C(       67073), -INT32_C(     3151377),  INT32_C(       16436),  INT32_C(  1618951086), -INT32_C(   464491640) },
+      {  INT32_C(    29359995), -INT32_C(  1918326145),  INT32_C(   805306641),  INT32_C(     4456480), -INT32_C(  1486073736),  INT32_C(   536936514), -INT32_C(  1904988756), -INT32_C(     5245313),
+        -INT32_C(    34668677), -INT32_C(  1714608292),  INT32_C(  2013232563), -INT32_C(      577524), -INT32_C(     3151377),  INT32_C(   436207624),  INT32_C(  1618951086), -INT32_C(   464491640) } },
+    { {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(        6145),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(       16385), -INT32_C(       16387), -INT32_C(  1052765888), -INT32_C(   834479188), -INT32_C(  1211146437), -INT32_C(       66930) },
+      UINT16_C(15488),
+      {  INT32_C(    17957888), -INT32_C(     2162689), -INT32_C(     9437185), -INT32_C(  1235125391),  INT32_C(     8454208), -INT32_C(    16777218),  INT32_C(     4198432), -INT32_C(   270540833),
+        -INT32_C(  1315963903),  INT32_C(   142868480), -INT32_C(   929757151),  INT32_C(     8654888), -INT32_C(    51905537), -INT32_C(  2128068607),  INT32_C(  1964986965), -INT32_C(   965580812) },
+      { -INT32_C(   302022978),  INT32_C(    41960072),  INT32_C(       98561), -INT32_C(  2145320960), -INT32_C(  1017322521),  INT32_C(   511329117),  INT32_C(  2139092989),  INT32_C(   469233360),
+        -INT32_C(  2145386284), -INT32_C(  1187040631), -INT32_C(   936442235),  INT32_C(   838179092), -INT32_C(    67895303), -INT32_C(   272629761), -INT32_C(  1284912749), -INT32_C(   315363651) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(   270540833),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(   929757151),  INT32_C(     8654888), -INT32_C(    51905537), -INT32_C(  2128068607), -INT32_C(  1211146437), -INT32_C(       66930) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(  1579171905),
+         INT32_C(  1985228763), -INT32_C(         267),  INT32_C(   194062864),  INT32_C(   671156256), -INT32_C(   201732105), -INT32_C(    16625536), -INT32_C(  1211146437), -INT32_C(       66930) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111),  INT32_C(   938466721),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(  1872884469),  INT32_C(  1676358184), -INT32_C(   135790605), -INT32_C(   545259521), -INT32_C(  1211146437), -INT32_C(       66930) },
+      {  INT32_C(    34080784),  INT32_C(    33964032), -INT32_C(   807669769),  INT32_C(   134246916), -INT32_C(     1118209), -INT32_C(  1186630588), -INT32_C(  1608961111), -INT32_C(   789585953),
+         INT32_C(  1985228763), -INT32_C(         267), -INT32_C(  2050452216),  INT32_C(   335578128), -INT32_C(   100866053), -INT32_C(     8312768), -INT32_C(  1211146437), -INT32_C(       66930) } },
+    { {  INT32_C(   861402116), -INT32_C(   973081089),  INT32_C(        2306), -INT32_C(   434438820),  INT32_C(  2005213755), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(  1107361793),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(      540672),  INT32_C(   268697616), -INT32_C(   842955728), -INT32_C(    14747713), -INT32_C(  2147483644) },
+      UINT16_C(26781),
+      {  INT32_C(           2), -INT32_C(   271581209), -INT32_C(  2147481600), -INT32_C(   815793153),  INT32_C(   134226465), -INT32_C(  1207959969),  INT32_C(   340118695),  INT32_C(       65558),
+         INT32_C(  1091174400), -INT32_C(     4470849),  INT32_C(  1208107016),  INT32_C(  1490438006), -INT32_C(   856836140), -INT32_C(     2106369),  INT32_C(          32), -INT32_C(  1094729761) },
+      {  INT32_C(  1414435246),  INT32_C(  1878249471), -INT32_C(    67666051),  INT32_C(      426520), -INT32_C(     3277825),  INT32_C(   134218000),  INT32_C(  1332065442), -INT32_C(   734480060),
+         INT32_C(   498951320), -INT32_C(   439131750),  INT32_C(  1763555628),  INT32_C(        1024),  INT32_C(   269494784), -INT32_C(   574652417),  INT32_C(  2143248375), -INT32_C(        4121) },
+      {  INT32_C(           2), -INT32_C(   973081089), -INT32_C(  2147481600), -INT32_C(   815793153),  INT32_C(   134226465), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(       65558),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(  1490438006),  INT32_C(   268697616), -INT32_C(     2106369),  INT32_C(          32), -INT32_C(  2147483644) },
+      {  INT32_C(  1543503872), -INT32_C(   973081089), -INT32_C(    83886064),  INT32_C(   832487415), -INT32_C(    32505788), -INT32_C(  1858525362), -INT32_C(     1081425), -INT32_C(  2013265408),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(    11644046),  INT32_C(   268697616), -INT32_C(       16457), -INT32_C(   301989888), -INT32_C(  2147483644) },
+      { -INT32_C(  1466096804), -INT32_C(   973081089), -INT32_C(   135332101),  INT32_C(      853041), -INT32_C(     6555650), -INT32_C(  1858525362), -INT32_C(     1081425), -INT32_C(  1468960120),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(        2048),  INT32_C(   268697616), -INT32_C(  1149304833), -INT32_C(     8470546), -INT32_C(  2147483644) },
+      { -INT32_C(  1375731712), -INT32_C(   973081089),  INT32_C(  2105540616),  INT32_C(   416243707), -INT32_C(    16252894), -INT32_C(  1858525362), -INT32_C(     1081425),  INT32_C(  1140850944),
+         INT32_C(   932022246),  INT32_C(    67109956), -INT32_C(   139235739),  INT32_C(     5822023),  INT32_C(   268697616), -INT32_C(        8229), -INT32_C(   150994944), -INT32_C(  2147483644) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_mask_shrdi_epi32(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x16(r0, simde_mm512_loadu_epi32(test_vec[i].r0));
+    simde__m512i r7 = simde_mm512_mask_shrdi_epi32(src, test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x16(r7, simde_mm512_loadu_epi32(test_vec[i].r7));
+    simde__m512i r31 = simde_mm512_mask_shrdi_epi32(src, test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x16(r31, simde_mm512_loadu_epi32(test_vec[i].r31));
+    simde__m512i r40 = simde_mm512_mask_shrdi_epi32(src, test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x16(r40, simde_mm512_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shrdi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r7[16];
+    const int32_t r31[16];
+    const int32_t r40[16];
+  } test_vec[] = {
+    { UINT16_C(55316),
+      { -INT32_C(   557075892),  INT32_C(     6946833), -INT32_C(  1448049465), -INT32_C(    67764225), -INT32_C(     4358401),  INT32_C(  2145386495),  INT32_C(  2146885615),  INT32_C(  1032179771),
+         INT32_C(   910758419),  INT32_C(    16924736),  INT32_C(    72359952),  INT32_C(   218294452),  INT32_C(  1498163392),  INT32_C(      264448), -INT32_C(    62681162),  INT32_C(   570425348) },
+      {  INT32_C(   503027244), -INT32_C(      262658), -INT32_C(   148936762), -INT32_C(   402918403),  INT32_C(  1787256142),  INT32_C(   608444416),  INT32_C(    67109888),  INT32_C(   272633920),
+        -INT32_C(    49608093),  INT32_C(    17302032), -INT32_C(     8388609), -INT32_C(  1577058048),  INT32_C(      524320), -INT32_C(  1556655945), -INT32_C(   134217729),  INT32_C(    67216389) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1448049465),  INT32_C(           0), -INT32_C(     4358401),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   218294452),  INT32_C(  1498163392),  INT32_C(           0), -INT32_C(    62681162),  INT32_C(   570425348) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1923915511),  INT32_C(           0), -INT32_C(  1644201219),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(     1705425),  INT32_C(  1085446225),  INT32_C(           0), -INT32_C(      489697),  INT32_C(   172228608) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   297873523),  INT32_C(           0), -INT32_C(   720455011),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1140851200),  INT32_C(     1048640),  INT32_C(           0), -INT32_C(   268435457),  INT32_C(   134432778) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   961957756),  INT32_C(           0),  INT32_C(  1325383038),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      852712),  INT32_C(   542723112),  INT32_C(           0), -INT32_C(      244849),  INT32_C(    86114304) } },
+    { UINT16_C(52050),
+      {  INT32_C(  1073745984), -INT32_C(    67108865), -INT32_C(   860330802), -INT32_C(   982888433), -INT32_C(   241597281), -INT32_C(  1204486740), -INT32_C(         513),  INT32_C(  1346830574),
+        -INT32_C(   536879106),  INT32_C(  1904951400),  INT32_C(   711556884),  INT32_C(   532604503), -INT32_C(  1470754894),  INT32_C(   101712000),  INT32_C(  1072693215),  INT32_C(     8388608) },
+      { -INT32_C(      134209), -INT32_C(   446027759), -INT32_C(   180355073),  INT32_C(    33693776),  INT32_C(      295104), -INT32_C(  1872633607), -INT32_C(  1735190879), -INT32_C(  2135387330),
+        -INT32_C(  1268876326),  INT32_C(   958766526), -INT32_C(   276956198),  INT32_C(   414352663),  INT32_C(   921442125),  INT32_C(      540802), -INT32_C(   335544337),  INT32_C(    69271552) },
+      {  INT32_C(           0), -INT32_C(    67108865),  INT32_C(           0),  INT32_C(           0), -INT32_C(   241597281),  INT32_C(           0), -INT32_C(         513),  INT32_C(           0),
+        -INT32_C(   536879106),  INT32_C(  1904951400),  INT32_C(           0),  INT32_C(   532604503),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1072693215),  INT32_C(     8388608) },
+      {  INT32_C(           0),  INT32_C(   603455487),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2115816695),  INT32_C(           0),  INT32_C(  1140850683),  INT32_C(           0),
+        -INT32_C(  1245708353),  INT32_C(  2095257216),  INT32_C(           0),  INT32_C(   775912908),  INT32_C(           0),  INT32_C(           0), -INT32_C(   562044929),  INT32_C(       65536) },
+      {  INT32_C(           0), -INT32_C(   892055517),  INT32_C(           0),  INT32_C(           0),  INT32_C(      590209),  INT32_C(           0),  INT32_C(   824585539),  INT32_C(           0),
+         INT32_C(  1757214645),  INT32_C(  1917533052),  INT32_C(           0),  INT32_C(   828705326),  INT32_C(           0),  INT32_C(           0), -INT32_C(   671088674),  INT32_C(   138543104) },
+      {  INT32_C(           0),  INT32_C(   301727743),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1057908348),  INT32_C(           0), -INT32_C(  1577058307),  INT32_C(           0),
+        -INT32_C(   622854177), -INT32_C(  1099855040),  INT32_C(           0),  INT32_C(   387956454),  INT32_C(           0),  INT32_C(           0), -INT32_C(   281022465),  INT32_C(       32768) } },
+    { UINT16_C(16599),
+      { -INT32_C(    83886081),  INT32_C(   335676416),  INT32_C(    37749256),  INT32_C(  2147482109),  INT32_C(  1895829508), -INT32_C(   164043461),  INT32_C(   848184416), -INT32_C(    16777377),
+         INT32_C(   883543050),  INT32_C(  1126800135),  INT32_C(  2011486750),  INT32_C(    68161544), -INT32_C(  2075701490), -INT32_C(      524296),  INT32_C(      155656),  INT32_C(  1084817408) },
+      {  INT32_C(   497628398), -INT32_C(  1123005967), -INT32_C(   343076156), -INT32_C(  1736631849), -INT32_C(   134781081),  INT32_C(  1573601921), -INT32_C(   143720481),  INT32_C(   339886594),
+         INT32_C(  1279471987),  INT32_C(   268468288), -INT32_C(  1087919853),  INT32_C(      270468), -INT32_C(      524289), -INT32_C(      527361),  INT32_C(   823787825),  INT32_C(  1922284212) },
+      { -INT32_C(    83886081),  INT32_C(   335676416),  INT32_C(    37749256),  INT32_C(           0),  INT32_C(  1895829508),  INT32_C(           0),  INT32_C(   848184416), -INT32_C(    16777377),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      155656),  INT32_C(           0) },
+      { -INT32_C(   571080705), -INT32_C(   500694008), -INT32_C(  2012971004),  INT32_C(           0), -INT32_C(   824049632),  INT32_C(           0), -INT32_C(  1100669816),  INT32_C(   100532222),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1644168384),  INT32_C(           0) },
+      {  INT32_C(   995256797),  INT32_C(  2048955362), -INT32_C(   686152312),  INT32_C(           0), -INT32_C(   269562162),  INT32_C(           0), -INT32_C(   287440962),  INT32_C(   679773189),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1647575650),  INT32_C(           0) },
+      { -INT32_C(   285540353), -INT32_C(   250347004), -INT32_C(  1006485502),  INT32_C(           0),  INT32_C(  1735458832),  INT32_C(           0), -INT32_C(   550334908),  INT32_C(    50266111),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   822084192),  INT32_C(           0) } },
+    { UINT16_C( 4429),
+      { -INT32_C(   142606609),  INT32_C(       66608),  INT32_C(      788628),  INT32_C(   402784268),  INT32_C(   678768086),  INT32_C(  1054299899),  INT32_C(     8389312), -INT32_C(   197554507),
+         INT32_C(   536879368),  INT32_C(  1861188472),  INT32_C(        2057),  INT32_C(  1037688008),  INT32_C(      280112),  INT32_C(   733048204), -INT32_C(   624164867), -INT32_C(   221675229) },
+      {  INT32_C(       82628),  INT32_C(  1074925780), -INT32_C(   608174401),  INT32_C(   607752600),  INT32_C(   570425872),  INT32_C(     4194304),  INT32_C(  1069546999),  INT32_C(  1051933004),
+         INT32_C(  1593825782), -INT32_C(  1555977070), -INT32_C(  1083900335),  INT32_C(   617473349),  INT32_C(   569654257), -INT32_C(   469935523),  INT32_C(    33556516), -INT32_C(        2049) },
+      { -INT32_C(   142606609),  INT32_C(           0),  INT32_C(      788628),  INT32_C(   402784268),  INT32_C(           0),  INT32_C(           0),  INT32_C(     8389312),  INT32_C(           0),
+         INT32_C(   536879368),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(      280112),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  1980825603),  INT32_C(           0),  INT32_C(  2113935377),  INT32_C(   808453120),  INT32_C(           0),  INT32_C(           0), -INT32_C(   301924347),  INT32_C(           0),
+        -INT32_C(   331349950),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   503314292),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(      165257),  INT32_C(           0), -INT32_C(  1216348802),  INT32_C(  1215505200),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2139093998),  INT32_C(           0),
+        -INT32_C(  1107315732),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1139308514),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   990412802),  INT32_C(           0), -INT32_C(  1090515960), -INT32_C(  1743257088),  INT32_C(           0),  INT32_C(           0), -INT32_C(   150962174),  INT32_C(           0),
+        -INT32_C(   165674975),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   251657146),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_maskz_shrdi_epi32(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i32x16(r0, simde_mm512_loadu_epi32(test_vec[i].r0));
+    simde__m512i r7 = simde_mm512_maskz_shrdi_epi32(test_vec[i].k, a, b, 7);
+    simde_test_x86_assert_equal_i32x16(r7, simde_mm512_loadu_epi32(test_vec[i].r7));
+    simde__m512i r31 = simde_mm512_maskz_shrdi_epi32(test_vec[i].k, a, b, 31);
+    simde_test_x86_assert_equal_i32x16(r31, simde_mm512_loadu_epi32(test_vec[i].r31));
+    simde__m512i r40 = simde_mm512_maskz_shrdi_epi32(test_vec[i].k, a, b, 40);
+    simde_test_x86_assert_equal_i32x16(r40, simde_mm512_loadu_epi32(test_vec[i].r40));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r13[8];
+    const int64_t r63[8];
+    const int64_t r72[8];
+  } test_vec[] = {
+    { { -INT64_C( 3722393368951803312),  INT64_C( 1163054879183217152),  INT64_C( 2306585042123489280), -INT64_C(       2199031645252),
+         INT64_C(       2783206440960),  INT64_C( 2210849351904181742),  INT64_C(      17592324457473), -INT64_C( 8867651390305445874) },
+      { -INT64_C( 3408724464057116062),  INT64_C( 8998191780339843007), -INT64_C(  900720509589716995),  INT64_C(   36028934458048580),
+        -INT64_C( 6927099281002201641),  INT64_C( 3452563557783463303), -INT64_C(   73188854063958017),  INT64_C( 1767948782208791771) },
+      { -INT64_C( 3722393368951803312),  INT64_C( 1163054879183217152),  INT64_C( 2306585042123489280), -INT64_C(       2199031645252),
+         INT64_C(       2783206440960),  INT64_C( 2210849351904181742),  INT64_C(      17592324457473), -INT64_C( 8867651390305445874) },
+      { -INT64_C( 3236290725987497251), -INT64_C(  146225013416984575), -INT64_C(    6473833884155904),  INT64_C(  155374186875845631),
+        -INT64_C( 1245245296628195264),  INT64_C( 3186566615435903285), -INT64_C( 4613937816093572608), -INT64_C( 6423215545606682942) },
+      { -INT64_C( 6817448928114232123), -INT64_C(  450360513029865602), -INT64_C( 1801441019179433990),  INT64_C(   72057868916097161),
+         INT64_C( 4592545511705148334),  INT64_C( 6905127115566926606), -INT64_C(  146377708127916034),  INT64_C( 3535897564417583543) },
+      {  INT64_C( 7119161210657397682), -INT64_C( 4679200429343506398), -INT64_C(  207162684292988928),  INT64_C( 4971973980027060219),
+        -INT64_C( 2954361344683145216), -INT64_C( 8710332748308404547), -INT64_C(   72057525317910524), -INT64_C( 2628712648608786344) } },
+    { {  INT64_C( 5141439356885783966),  INT64_C( 1447218474191463998),  INT64_C(    4789567610290432),  INT64_C( 9079256846631436283),
+         INT64_C( 2186617384992853056), -INT64_C(  306526249721798917),  INT64_C( 2345326687337969132), -INT64_C( 1801580726414475265) },
+      {  INT64_C( 2962439349134835106),  INT64_C( 7449822310007951126),  INT64_C( 4656722117780382236),  INT64_C( 1315236084025655552),
+        -INT64_C(  871983392649443942), -INT64_C( 1594292575449638360), -INT64_C(  585485681183162369),  INT64_C(   20934701392921616) },
+      {  INT64_C( 5141439356885783966),  INT64_C( 1447218474191463998),  INT64_C(    4789567610290432),  INT64_C( 9079256846631436283),
+         INT64_C( 2186617384992853056), -INT64_C(  306526249721798917),  INT64_C( 2345326687337969132), -INT64_C( 1801580726414475265) },
+      { -INT64_C( 1363963069984265442),  INT64_C( 8696627542863828101),  INT64_C( 1215972484054048848),  INT64_C(  577569060023959551),
+         INT64_C( 3229347853892149642), -INT64_C( 3366478139214538754), -INT64_C(    1965505052047313),  INT64_C( 2343903686524075775) },
+      {  INT64_C( 5924878698269670212), -INT64_C( 3547099453693649364), -INT64_C( 9133299838148787144),  INT64_C( 2630472168051311104),
+        -INT64_C( 1743966785298887884), -INT64_C( 3188585150899276719), -INT64_C( 1170971362366324738),  INT64_C(   41869402785843233) },
+      { -INT64_C( 6753330092077390891),  INT64_C( 1590920265999224998),  INT64_C( 2017631342310459905),  INT64_C(   35465847057154047),
+        -INT64_C( 7341333117708521140),  INT64_C( 2953163987392069598), -INT64_C(   62896161665513995),  INT64_C( 1217941673932218367) } },
+    { {  INT64_C(   18023233262583808),  INT64_C( 7477806485892887209), -INT64_C(       1116691566729), -INT64_C( 1158568957104439361),
+         INT64_C( 6217574475476926271),  INT64_C( 8214801940760137787), -INT64_C( 1211468314795049217),  INT64_C( 5911146166253439398) },
+      { -INT64_C(     308687898038289), -INT64_C( 3727508476426738336), -INT64_C(    4507997708223121), -INT64_C(  454738218672896503),
+        -INT64_C( 6997253234939761759), -INT64_C(       2474983456796), -INT64_C(   45317471272435715), -INT64_C( 3799021595303075935) },
+      {  INT64_C(   18023233262583808),  INT64_C( 7477806485892887209), -INT64_C(       1116691566729), -INT64_C( 1158568957104439361),
+         INT64_C( 6217574475476926271),  INT64_C( 8214801940760137787), -INT64_C( 1211468314795049217),  INT64_C( 5911146166253439398) },
+      {  INT64_C( 9185093640123843216),  INT64_C( 3099389361805448719), -INT64_C( 1477180677913837577),  INT64_C( 3481141085082746869),
+         INT64_C( 6704367026600196787), -INT64_C(   62047611343152748), -INT64_C(    4651483943141377), -INT64_C(  213199406840350826) },
+      { -INT64_C(     617375796076578), -INT64_C( 7455016952853476672), -INT64_C(    9015995416446241), -INT64_C(  909476437345793005),
+         INT64_C( 4452237603830028098), -INT64_C(       4949966913592), -INT64_C(   90634942544871429), -INT64_C( 7598043190606151870) },
+      { -INT64_C( 1224908695389842944),  INT64_C( 6946739209226600946),  INT64_C( 8070450527885852399),  INT64_C(  716050280390590143),
+        -INT64_C( 6821184033308322177), -INT64_C( 1985523562980887920), -INT64_C(  148847486180524034), -INT64_C( 6822381018891226423) } },
+    { { -INT64_C( 2287783186274439160),  INT64_C( 4612249108000950272), -INT64_C( 5982157832980909589), -INT64_C(         68856087553),
+         INT64_C( 1651831470753252935),  INT64_C(  576742605371482112),  INT64_C(  346512524760053424), -INT64_C(    2289331452511249) },
+      { -INT64_C(         70968189953), -INT64_C( 8143174428115360144),  INT64_C(     563121761624064), -INT64_C( 2842547184663592606),
+         INT64_C(  148623736176640576), -INT64_C( 7521876425795324442), -INT64_C( 5873086212776332741),  INT64_C(   38280598982295553) },
+      { -INT64_C( 2287783186274439160),  INT64_C( 4612249108000950272), -INT64_C( 5982157832980909589), -INT64_C(         68856087553),
+         INT64_C( 1651831470753252935),  INT64_C(  576742605371482112),  INT64_C(  346512524760053424), -INT64_C(    2289331452511249) },
+      { -INT64_C( 2306122279622174719),  INT64_C( 3711529111643230226),  INT64_C(    1521555937588945),  INT64_C(  799388933849857755),
+         INT64_C( 1297238332266535032), -INT64_C( 5823083915039981567), -INT64_C( 7937552044348316577),  INT64_C(    4503320167964671) },
+      { -INT64_C(        141936379905),  INT64_C( 2160395217478831328),  INT64_C(    1126243523248129), -INT64_C( 5685094369327185211),
+         INT64_C(  297247472353281152),  INT64_C( 3402991222118902732),  INT64_C( 6700571648156886134),  INT64_C(   76561197964591107) },
+      { -INT64_C(    8936653071384528),  INT64_C( 8088467130326057544),  INT64_C(   48689790002846257),  INT64_C( 7133701809485896571),
+         INT64_C( 4618138485110017798), -INT64_C( 1871244544183893984),  INT64_C( 4252751612787592182),  INT64_C(  144106245374869499) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_shrdi_epi64(a, b, 0);
+    simde_test_x86_assert_equal_i64x8(r0, simde_mm512_loadu_epi64(test_vec[i].r0));
+    simde__m512i r13 = simde_mm512_shrdi_epi64(a, b, 13);
+    simde_test_x86_assert_equal_i64x8(r13, simde_mm512_loadu_epi64(test_vec[i].r13));
+    simde__m512i r63 = simde_mm512_shrdi_epi64(a, b, 63);
+    simde_test_x86_assert_equal_i64x8(r63, simde_mm512_loadu_epi64(test_vec[i].r63));
+    simde__m512i r72 = simde_mm512_shrdi_epi64(a, b, 72);
+    simde_test_x86_assert_equal_i64x8(r72, simde_mm512_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r13[8];
+    const int64_t r63[8];
+    const int64_t r72[8];
+  } test_vec[] = {
+    { { -INT64_C( 5551202956678752255), -INT64_C( 3265148371221668702),  INT64_C( 8948249588434567974), -INT64_C( 3045629616753483777),
+         INT64_C( 9222808801822636030),  INT64_C( 3972429247277357791),  INT64_C( 5661406459820133563), -INT64_C( 5536098828079154514) },
+      UINT8_C( 90),
+      { -INT64_C( 2922736189696636776),  INT64_C(    5210588355493896), -INT64_C(  612526387277889537), -INT64_C( 1317926543524855714),
+         INT64_C(  851081782086602896), -INT64_C(  159877810393975138), -INT64_C(  772506604417757561),  INT64_C( 5515807285716921121) },
+      { -INT64_C(                 385),  INT64_C(    5348439029252624),  INT64_C(     351927747491328),  INT64_C( 6990468385547368757),
+        -INT64_C(       2473917943809),  INT64_C(    2286990661808128),  INT64_C( 5238325801199206815),  INT64_C(   23661490229739534) },
+      { -INT64_C( 5551202956678752255),  INT64_C(    5210588355493896),  INT64_C( 8948249588434567974), -INT64_C( 1317926543524855714),
+         INT64_C(  851081782086602896),  INT64_C( 3972429247277357791), -INT64_C(  772506604417757561), -INT64_C( 5536098828079154514) },
+      { -INT64_C( 5551202956678752255),  INT64_C( 1188950937683959808),  INT64_C( 8948249588434567974), -INT64_C( 3913788955889981148),
+         INT64_C( 9221224128860192928),  INT64_C( 3972429247277357791),  INT64_C(  936654422370453578), -INT64_C( 5536098828079154514) },
+      { -INT64_C( 5551202956678752255),  INT64_C(   10696878058505248),  INT64_C( 8948249588434567974), -INT64_C( 4465807302614814101),
+        -INT64_C(       4947835887618),  INT64_C( 3972429247277357791), -INT64_C( 7970092471311137985), -INT64_C( 5536098828079154514) },
+      { -INT64_C( 5551202956678752255),  INT64_C( 1152941858467610624),  INT64_C( 8948249588434567974),  INT64_C( 3885961927487464576),
+        -INT64_C(   68733055826652144),  INT64_C( 3972429247277357791), -INT64_C( 6920546631564588722), -INT64_C( 5536098828079154514) } },
+    { {  INT64_C( 3998070569197633535), -INT64_C(            67635205), -INT64_C( 1100931191985858285),  INT64_C( 2305845827786637320),
+         INT64_C(       1374389542912), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861), -INT64_C( 1153202979584151810) },
+      UINT8_C(158),
+      { -INT64_C( 7302594513499369452), -INT64_C( 4840870286413499898),  INT64_C( 5988893184442954129), -INT64_C( 6917526828601040896),
+         INT64_C( 4701898791429611778), -INT64_C( 6468625332090901568),  INT64_C(    1126174784753670),  INT64_C( 1179960883540132864) },
+      { -INT64_C( 4147491980617822727),  INT64_C(    2815299522920472), -INT64_C( 7552795575479351375), -INT64_C( 6025911766201555158),
+        -INT64_C( 1162632494386814985), -INT64_C( 6908521278340071424), -INT64_C(  144115325582016513), -INT64_C( 8176267694008608224) },
+      {  INT64_C( 3998070569197633535), -INT64_C( 4840870286413499898),  INT64_C( 5988893184442954129), -INT64_C( 6917526828601040896),
+         INT64_C( 4701898791429611778), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C( 1179960883540132864) },
+      {  INT64_C( 3998070569197633535),  INT64_C(   55704068793496739),  INT64_C( 4434524899208807383),  INT64_C( 4131208233450735617),
+        -INT64_C(   19692236068354047), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861), -INT64_C( 3386562881588821472) },
+      {  INT64_C( 3998070569197633535),  INT64_C(    5630599045840945),  INT64_C( 3341152922750848866),  INT64_C( 6394920541306441301),
+        -INT64_C( 2325264988773629970), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C( 2094208685692335168) },
+      {  INT64_C( 3998070569197633535),  INT64_C( 1782530201391895666), -INT64_C( 5669155814994576655),  INT64_C( 3071454954456678432),
+        -INT64_C(  630151554187329503), -INT64_C( 8065944561798020960),  INT64_C( 2029283484145433861),  INT64_C( 2310452231415022596) } },
+    { { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154),  INT64_C( 5964045263539872017),
+         INT64_C( 4611967493406195712), -INT64_C( 6963926032773492089),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      UINT8_C( 40),
+      { -INT64_C( 7671920873462703561),  INT64_C( 4000382183446714259),  INT64_C( 8934543241299098623),  INT64_C( 7616973895377652736),
+         INT64_C(  908908459573859796),  INT64_C( 1545092682474405191),  INT64_C( 2882303830244982912), -INT64_C(    2252358328255505) },
+      {  INT64_C(    9077567998951424),  INT64_C(    5242471575455753), -INT64_C(  434606162617565445), -INT64_C( 2990895181915669825),
+        -INT64_C(  594476525202440194),  INT64_C( 1233986608345255936),  INT64_C( 3260669358385212126),  INT64_C( 8579226018627543290) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154),  INT64_C( 7616973895377652736),
+         INT64_C( 4611967493406195712),  INT64_C( 1545092682474405191),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154), -INT64_C( 3027740943022945468),
+         INT64_C( 4611967493406195712), -INT64_C( 9223183426908184695),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154), -INT64_C( 5981790363831339650),
+         INT64_C( 4611967493406195712),  INT64_C( 2467973216690511872),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) },
+      { -INT64_C( 2310346614479389265), -INT64_C( 1161937501036744705), -INT64_C( 6969194970443655154), -INT64_C( 4653989808186496884),
+         INT64_C( 4611967493406195712),  INT64_C(    6035518290915645),  INT64_C(   19140298433101824), -INT64_C( 7009226222678797781) } },
+    { { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878),  INT64_C( 5275828379170050391),  INT64_C( 6028984787529573455),
+        -INT64_C( 2604490158526976065), -INT64_C( 1490559613030665393), -INT64_C(  456843814949049988),  INT64_C( 1420865128360824681) },
+      UINT8_C(188),
+      {  INT64_C(   18049583423688986),  INT64_C( 1225058332411203648), -INT64_C(             8392739),  INT64_C( 1421873324399150195),
+         INT64_C(   36338928554641536), -INT64_C(  576460752303751169),  INT64_C( 1441151897967788168),  INT64_C( 5592213067597132556) },
+      {  INT64_C( 2326953641132425224), -INT64_C(    2252366817002819), -INT64_C( 2249126809543251556),  INT64_C( 5224556120440279132),
+        -INT64_C( 3026427757530726657), -INT64_C(  288230384741662849), -INT64_C(      17598632953857),  INT64_C(  261227263935942729) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C(             8392739),  INT64_C( 1421873324399150195),
+         INT64_C(   36338928554641536), -INT64_C(  576460752303751169), -INT64_C(  456843814949049988),  INT64_C( 5592213067597132556) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878),  INT64_C( 5541679341479394303), -INT64_C( 9016032885474688174),
+        -INT64_C(  578708116212744156), -INT64_C(  288300744895889449), -INT64_C(  456843814949049988), -INT64_C( 9058308007259024539) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C( 4498253619086503111), -INT64_C( 7997631832828993352),
+        -INT64_C( 6052855515061453314), -INT64_C(  576460769483325697), -INT64_C(  456843814949049988),  INT64_C(  522454527871885458) },
+      { -INT64_C(  412096612744297341), -INT64_C( 4227216119054608878), -INT64_C( 7133701809754898449),  INT64_C( 6634852844162804292),
+        -INT64_C(   71915645098261368),  INT64_C( 9221120237041089279), -INT64_C(  456843814949049988),  INT64_C( 5282048947064040627) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_mask_shrdi_epi64(src, test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x8(r0, simde_mm512_loadu_epi64(test_vec[i].r0));
+    simde__m512i r13 = simde_mm512_mask_shrdi_epi64(src, test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x8(r13, simde_mm512_loadu_epi64(test_vec[i].r13));
+    simde__m512i r63 = simde_mm512_mask_shrdi_epi64(src, test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x8(r63, simde_mm512_loadu_epi64(test_vec[i].r63));
+    simde__m512i r72 = simde_mm512_mask_shrdi_epi64(src, test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x8(r72, simde_mm512_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shrdi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r13[8];
+    const int64_t r63[8];
+    const int64_t r72[8];
+  } test_vec[] = {
+    { UINT8_C(119),
+      {  INT64_C( 9151314442816585725),  INT64_C( 1175439546230243841), -INT64_C( 9149907067933292480),  INT64_C(  288863698071585792),
+        -INT64_C(   36627069072916484), -INT64_C(  649925726593681425), -INT64_C( 2312669054558638113), -INT64_C( 6499639415319830425) },
+      { -INT64_C( 5882870115206168513), -INT64_C( 7998392921030127536),  INT64_C( 2306444391105429536), -INT64_C(  886021163190518507),
+        -INT64_C( 2677055790963132626),  INT64_C(  145804632822645264), -INT64_C(       1108236828705),  INT64_C( 4998262364882743087) },
+      {  INT64_C( 9151314442816585725),  INT64_C( 1175439546230243841), -INT64_C( 9149907067933292480),  INT64_C(                   0),
+        -INT64_C(   36627069072916484), -INT64_C(  649925726593681425), -INT64_C( 2312669054558638113),  INT64_C(                   0) },
+      {  INT64_C(  142980492075991007), -INT64_C( 9043084565487222784),  INT64_C(   73192461836484608),  INT64_C(                   0),
+        -INT64_C( 5082316650565372427),  INT64_C( 1191122764802949111), -INT64_C(   72339902272126989),  INT64_C(                   0) },
+      {  INT64_C( 6681003843297214590),  INT64_C( 2449958231649296544),  INT64_C( 4612888782210859073),  INT64_C(                   0),
+        -INT64_C( 5354111581926265251),  INT64_C(  291609265645290529), -INT64_C(       2216473657409),  INT64_C(                   0) },
+      {  INT64_C( 4575375746431712255),  INT64_C( 5769199083761696770),  INT64_C( 2342158778767507464),  INT64_C(                   0),
+         INT64_C( 3386563845294046911),  INT64_C( 1222440326275268343), -INT64_C( 2314876872708063633),  INT64_C(                   0) } },
+    { UINT8_C( 49),
+      { -INT64_C(   40813871623045633), -INT64_C(  995198114825924614), -INT64_C( 4937352566548725761),  INT64_C( 7549461407401178667),
+         INT64_C( 8117977549360464990),  INT64_C( 8677405295095357828), -INT64_C( 7633253352428970882), -INT64_C(    3588805953128515) },
+      { -INT64_C(  298364231764443137),  INT64_C( 2305878193594441769),  INT64_C(      35185445830656), -INT64_C( 3063592288224582018),
+         INT64_C( 1334474008126554124),  INT64_C( 1098147268460500966),  INT64_C(    9029189910921216),  INT64_C(  288516279239723008) },
+      { -INT64_C(   40813871623045633),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C( 8117977549360464990),  INT64_C( 8677405295095357828),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(       4982162063361),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(   28012561820541392), -INT64_C( 4669173560007142907),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(  596728463528886273),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C( 2668948016253108248),  INT64_C( 2196294536921001932),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(     159429186027523),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(  896401978257324548), -INT64_C( 1839601330552160095),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 48),
+      { -INT64_C(   18014399591622665),  INT64_C( 8951841122872908289), -INT64_C(  292733998329827329),  INT64_C( 7750124949868340246),
+        -INT64_C(  290570137166152195),  INT64_C( 7177162064362822120), -INT64_C( 4765512093199763970),  INT64_C( 5908656981591673579) },
+      { -INT64_C( 4783722977209765774),  INT64_C( 5565569456272801465), -INT64_C( 7929797503969712922),  INT64_C(   96600322946248906),
+         INT64_C( 7117028465989949503),  INT64_C(   27234980732207104), -INT64_C( 1229522830446624805), -INT64_C( 2449960397386563730) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(  290570137166152195),  INT64_C( 7177162064362822120),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C( 4467606300338979073),  INT64_C(     876118416059914),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C( 4212687141729652609),  INT64_C(   54469961464414208),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C( 4610550978829082621),  INT64_C(   28035789313917273),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 59),
+      { -INT64_C( 3778708736659287361), -INT64_C(    2533489538793505),  INT64_C(  216315718625985920), -INT64_C( 1232563183654309386),
+         INT64_C(   36099168179128322), -INT64_C(    9007298038997249),  INT64_C( 1357301409335842029), -INT64_C( 4730289735772946498) },
+      { -INT64_C( 6034464587309383914),  INT64_C( 9187268473040910319),  INT64_C( 8615083893727337558),  INT64_C( 2450521215984517160),
+         INT64_C(    9592150178154496), -INT64_C( 5295275991355046781), -INT64_C( 9223372033623970976), -INT64_C(  398008265289147225) },
+      { -INT64_C( 3778708736659287361), -INT64_C(    2533489538793505),  INT64_C(                   0), -INT64_C( 1232563183654309386),
+         INT64_C(   36099168179128322), -INT64_C(    9007298038997249),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(  525130624744993264), -INT64_C( 4647715124710211589),  INT64_C(                   0),  INT64_C(   92173332988090491),
+         INT64_C( 4611690425064128520),  INT64_C( 2603079485096460286),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 6377814899090783789), -INT64_C(   72207127627730977),  INT64_C(                   0),  INT64_C( 4901042431969034321),
+         INT64_C(   19184300356308992),  INT64_C( 7856192090999458055),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 1642564081869767186), -INT64_C( 1152931401050357889),  INT64_C(                   0),  INT64_C( 2949546655618895729),
+         INT64_C(     141012375699720), -INT64_C( 8935176845461028898),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r0 = simde_mm512_maskz_shrdi_epi64(test_vec[i].k, a, b, 0);
+    simde_test_x86_assert_equal_i64x8(r0, simde_mm512_loadu_epi64(test_vec[i].r0));
+    simde__m512i r13 = simde_mm512_maskz_shrdi_epi64(test_vec[i].k, a, b, 13);
+    simde_test_x86_assert_equal_i64x8(r13, simde_mm512_loadu_epi64(test_vec[i].r13));
+    simde__m512i r63 = simde_mm512_maskz_shrdi_epi64(test_vec[i].k, a, b, 63);
+    simde_test_x86_assert_equal_i64x8(r63, simde_mm512_loadu_epi64(test_vec[i].r63));
+    simde__m512i r72 = simde_mm512_maskz_shrdi_epi64(test_vec[i].k, a, b, 72);
+    simde_test_x86_assert_equal_i64x8(r72, simde_mm512_loadu_epi64(test_vec[i].r72));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shrdi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shrdi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shrdi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shrdi_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
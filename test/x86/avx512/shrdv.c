@@ -0,0 +1,2228 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN shrdv
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/shrdv.h>
+
+static int
+test_simde_mm_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t c[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  4417),  INT16_C(  4608),  INT16_C( 28665),  INT16_C(     0), -INT16_C(  3275),  INT16_C( 26999), -INT16_C(  3265),  INT16_C( 21544) },
+      {  INT16_C(  6076),  INT16_C( 26537),  INT16_C(  4112),  INT16_C(  4128), -INT16_C(  3083),  INT16_C( 19992),  INT16_C( 10705),  INT16_C(  1112) },
+      { -INT16_C( 16641),  INT16_C( 18310), -INT16_C( 26232),  INT16_C(     9),  INT16_C(    27), -INT16_C(    20), -INT16_C(     1),  INT16_C(    22) },
+      {  INT16_C( 12153), -INT16_C( 23480),  INT16_C(  4207),  INT16_C(  4096),  INT16_C( 32446), -INT16_C(  7802),  INT16_C( 21411),  INT16_C( 24912) } },
+    { {  INT16_C(     0),  INT16_C(     1),  INT16_C(   830),  INT16_C(  4672),  INT16_C(     1), -INT16_C( 32631), -INT16_C( 22044),  INT16_C(   128) },
+      { -INT16_C( 19457),  INT16_C(    16), -INT16_C(     3),       INT16_MAX,  INT16_C(  6464), -INT16_C(    13),  INT16_C( 32251), -INT16_C(  7460) },
+      {  INT16_C(   192), -INT16_C(     1),  INT16_C(     6),  INT16_C(    13),  INT16_C(    19),  INT16_C(    16),  INT16_C(    23),  INT16_C(    25) },
+      {  INT16_C(     0),  INT16_C(    32), -INT16_C(  3060), -INT16_C(     8),  INT16_C(     0), -INT16_C( 32631), -INT16_C(  2221),  INT16_C( 28160) } },
+    { { -INT16_C( 20409),  INT16_C(  4102),  INT16_C( 29018),  INT16_C(   768), -INT16_C(  6594),  INT16_C( 25824),  INT16_C(   238),  INT16_C(  6009) },
+      {  INT16_C( 20915), -INT16_C(     1), -INT16_C(   640),  INT16_C( 24915), -INT16_C(  8193), -INT16_C(     1),  INT16_C(  1322),  INT16_C(  2066) },
+      { -INT16_C( 14707), -INT16_C(     1),  INT16_C(   704),  INT16_C(    15),  INT16_C(    24),  INT16_C(    32),  INT16_C(     5),  INT16_C(    17) },
+      { -INT16_C( 29283), -INT16_C(     2),  INT16_C( 29018), -INT16_C( 15706), -INT16_C(    26),  INT16_C( 25824),  INT16_C( 20487),  INT16_C(  3004) } },
+    { { -INT16_C( 12275), -INT16_C( 24234), -INT16_C(  2063), -INT16_C(  6273),  INT16_C(   419),  INT16_C( 17997), -INT16_C(   130),  INT16_C(  5572) },
+      {  INT16_C( 23519), -INT16_C(     1),  INT16_C(  2585),  INT16_C( 24576),  INT16_C(  8800), -INT16_C( 32616), -INT16_C(  4203), -INT16_C(     5) },
+      {  INT16_C(     9),  INT16_C( 32677),  INT16_C( 26279),  INT16_C(     4),  INT16_C(     7), -INT16_C(   385), -INT16_C(   393),  INT16_C(    30) },
+      { -INT16_C(  4120), -INT16_C(   758),  INT16_C( 13295),  INT16_C(  3703), -INT16_C( 16381),  INT16_C(   304),  INT16_C( 11262), -INT16_C(    20) } },
+    { {  INT16_C(     0),  INT16_C( 29127), -INT16_C(  4266),  INT16_C(  9218), -INT16_C(  8196), -INT16_C( 19386),  INT16_C( 10371), -INT16_C(  2049) },
+      { -INT16_C( 24833),  INT16_C( 28291), -INT16_C( 14184), -INT16_C( 17666),  INT16_C(   128),  INT16_C(   289), -INT16_C( 15214),  INT16_C( 17226) },
+      {  INT16_C(    25),  INT16_C(   907), -INT16_C( 17441),  INT16_C( 27575),  INT16_C(     1),  INT16_C(    29), -INT16_C( 15528),  INT16_C(    33) },
+      {  INT16_C( 32640), -INT16_C( 12178), -INT16_C( 28367), -INT16_C(   952),  INT16_C( 28670),  INT16_C(  2317), -INT16_C( 28120),  INT16_C( 31743) } },
+    { { -INT16_C( 23350), -INT16_C(    69),  INT16_C(   514),  INT16_C( 11613), -INT16_C(    35),  INT16_C(  8287), -INT16_C(    33), -INT16_C( 13568) },
+      {  INT16_C(   128), -INT16_C( 12154),  INT16_C( 13317),  INT16_C(  1552), -INT16_C(  3329), -INT16_C(  1861),  INT16_C( 23917),  INT16_C(   640) },
+      {  INT16_C(     0),  INT16_C(    18),  INT16_C(    29),  INT16_C(     3),  INT16_C(    40),  INT16_C(    26),  INT16_C(    29),  INT16_C(     5) },
+      { -INT16_C( 23350), -INT16_C( 16402), -INT16_C( 24536),  INT16_C(  1451), -INT16_C(     1),  INT16_C( 11976), -INT16_C(  5265),  INT16_C(  1624) } },
+    { {  INT16_C(   129),  INT16_C( 16321),  INT16_C( 24367), -INT16_C( 32447),  INT16_C(  4098), -INT16_C( 27599), -INT16_C( 10613),  INT16_C( 32747) },
+      {  INT16_C(   529),  INT16_C(  5413), -INT16_C(   258), -INT16_C(  8257),  INT16_C( 32639),  INT16_C(   128), -INT16_C(  5297),  INT16_C( 28719) },
+      {  INT16_C(     0),  INT16_C(     7),  INT16_C(    12),  INT16_C(     9), -INT16_C( 14071),  INT16_C( 11773),  INT16_C(   320),  INT16_C( 28992) },
+      {  INT16_C(   129),  INT16_C( 19071), -INT16_C(  4123), -INT16_C(  8256), -INT16_C( 16504),  INT16_C(  1028), -INT16_C( 10613),  INT16_C( 32747) } },
+    { {  INT16_C(  9795), -INT16_C( 22262), -INT16_C(  1892),  INT16_C(    64),  INT16_C( 14279),  INT16_C(   256),  INT16_C(   512),  INT16_C(  2056) },
+      {  INT16_C(  8208),  INT16_C(  8272),  INT16_C(  1025), -INT16_C( 23511), -INT16_C(  2517),  INT16_C( 14258), -INT16_C(  4369), -INT16_C(  2923) },
+      { -INT16_C(  2081),  INT16_C(    20),  INT16_C(     5),  INT16_C( 31097),  INT16_C(  8201), -INT16_C( 16387),  INT16_C(     8),  INT16_C(     4) },
+      {  INT16_C( 16416),  INT16_C(  2704),  INT16_C(  4036),  INT16_C(  5248),  INT16_C(  5531), -INT16_C( 17008), -INT16_C(  4350),  INT16_C( 20608) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi16(test_vec[i].c);
+    simde__m128i r = simde_mm_shrdv_epi16(a, b, c);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const simde__mmask8 k;
+    const int16_t b[8];
+    const int16_t c[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 32702), -INT16_C(  2579), -INT16_C(  1669),  INT16_C(     0),  INT16_C(     1),  INT16_C( 22483),  INT16_C(   537),  INT16_C( 31020) },
+      UINT8_C(193),
+      {  INT16_C(  6705),  INT16_C(  4863), -INT16_C(  2635), -INT16_C(  5123), -INT16_C(    66),  INT16_C(  4384),  INT16_C( 26392), -INT16_C( 11718) },
+      {  INT16_C(    13),  INT16_C(   192),  INT16_C(    30),  INT16_C( 16354),  INT16_C( 21088),  INT16_C(  2112), -INT16_C(  1165), -INT16_C( 16389) },
+      { -INT16_C( 11892), -INT16_C(  2579), -INT16_C(  1669),  INT16_C(     0),  INT16_C(     1),  INT16_C( 22483),  INT16_C(    67),  INT16_C( 18255) } },
+    { { -INT16_C(  6831), -INT16_C( 16384), -INT16_C( 24576), -INT16_C(  3036), -INT16_C( 18441), -INT16_C( 28718), -INT16_C(   129), -INT16_C( 24822) },
+      UINT8_C( 55),
+      { -INT16_C( 16385), -INT16_C(  1025), -INT16_C(     1), -INT16_C(   320), -INT16_C(  8418), -INT16_C( 32703),       INT16_MAX,  INT16_C(     4) },
+      {  INT16_C(    32),  INT16_C(    14),  INT16_C(     5),  INT16_C(    20), -INT16_C( 22148),  INT16_C(  5764),  INT16_C( 28031),  INT16_C(     8) },
+      { -INT16_C(  6831), -INT16_C(  4097), -INT16_C(   768), -INT16_C(  3036), -INT16_C(  3605),  INT16_C(  6397), -INT16_C(   129), -INT16_C( 24822) } },
+    { { -INT16_C( 16423),  INT16_C( 14408), -INT16_C(   487), -INT16_C(  5761), -INT16_C(  1132),  INT16_C(   640),  INT16_C(   272), -INT16_C( 28654) },
+      UINT8_C( 78),
+      {  INT16_C( 31612), -INT16_C(   577),  INT16_C(  2084),  INT16_C( 17975), -INT16_C( 20739), -INT16_C( 24081),  INT16_C(    52),  INT16_C(     2) },
+      {  INT16_C(     2), -INT16_C(   529), -INT16_C(   193),  INT16_C( 18074), -INT16_C(   337),  INT16_C(   260),  INT16_C(     9), -INT16_C( 26579) },
+      { -INT16_C( 16423), -INT16_C(  1154),  INT16_C(  4169), -INT16_C( 29190), -INT16_C(  1132),  INT16_C(   640),  INT16_C(  6656), -INT16_C( 28654) } },
+    { { -INT16_C( 21002), -INT16_C( 14686), -INT16_C( 29125), -INT16_C( 24769), -INT16_C(   297),  INT16_C(   256), -INT16_C(   258), -INT16_C( 22540) },
+      UINT8_C(149),
+      { -INT16_C( 20748),  INT16_C( 15974),  INT16_C(   388),  INT16_C(     0), -INT16_C(  4331), -INT16_C(  9169),  INT16_C(  4153),  INT16_C(  2188) },
+      {  INT16_C(    14), -INT16_C(   257),  INT16_C(    22),  INT16_C( 26183),  INT16_C( 27747),  INT16_C(    19),  INT16_C(     0),  INT16_C(    30) },
+      { -INT16_C( 17454), -INT16_C( 14686),  INT16_C(  4664), -INT16_C( 24769), -INT16_C( 16422),  INT16_C(   256), -INT16_C(   258),  INT16_C(  8754) } },
+    { {  INT16_C(   821),  INT16_C(    64), -INT16_C(  7110), -INT16_C(     1), -INT16_C(     1), -INT16_C(    17),  INT16_C(     0),  INT16_C( 16627) },
+      UINT8_C(200),
+      {  INT16_C( 10099), -INT16_C(   193), -INT16_C(  7081), -INT16_C(  8193),  INT16_C( 27685), -INT16_C( 21468), -INT16_C(  4132),  INT16_C( 16398) },
+      {  INT16_C(     3),  INT16_C( 11679),  INT16_C( 16523),  INT16_C(    20),       INT16_MIN, -INT16_C(  1026),  INT16_C(     5),  INT16_C( 21561) },
+      {  INT16_C(   821),  INT16_C(    64), -INT16_C(  7110), -INT16_C(     1), -INT16_C(     1), -INT16_C(    17), -INT16_C(  8192),  INT16_C(  1824) } },
+    { {  INT16_C(  6623), -INT16_C(   885),  INT16_C( 18497),  INT16_C( 17329), -INT16_C( 30688), -INT16_C( 10382), -INT16_C( 14124), -INT16_C(  8060) },
+      UINT8_C(220),
+      {  INT16_C(  4366),  INT16_C(  1152),  INT16_C( 11770),  INT16_C( 27843),  INT16_C( 17896), -INT16_C( 21369), -INT16_C( 15606), -INT16_C( 25209) },
+      {  INT16_C(  2048), -INT16_C( 31204), -INT16_C(    17),  INT16_C( 32143), -INT16_C(  8449), -INT16_C(  8753),  INT16_C(    28),  INT16_C(     0) },
+      {  INT16_C(  6623), -INT16_C(   885),  INT16_C( 23540), -INT16_C(  9850), -INT16_C( 29743), -INT16_C( 10382),  INT16_C( 12460), -INT16_C(  8060) } },
+    { { -INT16_C( 10794), -INT16_C(    73), -INT16_C(  2432),  INT16_C(  6031),  INT16_C(     0), -INT16_C(  8257), -INT16_C( 11434),  INT16_C(  3460) },
+      UINT8_C(183),
+      {  INT16_C(  8450),  INT16_C( 10777), -INT16_C( 23987),  INT16_C(     4),  INT16_C( 22616),  INT16_C( 10240), -INT16_C( 21826), -INT16_C(     5) },
+      { -INT16_C( 23897),  INT16_C(    32),  INT16_C(    26),  INT16_C(     3),  INT16_C(  7844), -INT16_C( 16897),  INT16_C(    15), -INT16_C(   257) },
+      {  INT16_C(  1451), -INT16_C(    73), -INT16_C( 27779),  INT16_C(  6031),       INT16_MIN,  INT16_C( 20481), -INT16_C( 11434), -INT16_C(    10) } },
+    { {  INT16_C( 23694), -INT16_C(    33), -INT16_C( 19162),  INT16_C(   117),       INT16_MIN,  INT16_C(   512),  INT16_C(    12),  INT16_C( 20351) },
+      UINT8_C( 77),
+      { -INT16_C(    65), -INT16_C( 17357), -INT16_C( 11719), -INT16_C(   589), -INT16_C(  3641),  INT16_C( 32627), -INT16_C( 32631),  INT16_C(  2330) },
+      {  INT16_C( 16448),  INT16_C(    16),  INT16_C(    24), -INT16_C( 20481),  INT16_C( 30578),  INT16_C(    24),  INT16_C(     2),  INT16_C(     6) },
+      {  INT16_C( 23694), -INT16_C(    33),  INT16_C( 14773), -INT16_C(  1178),       INT16_MIN,  INT16_C(   512),  INT16_C( 16387),  INT16_C( 20351) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi16(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_shrdv_epi16(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t c[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(186),
+      {  INT16_C(  2052),  INT16_C( 14995),  INT16_C(  4100), -INT16_C( 10930), -INT16_C( 31537),  INT16_C( 12624),  INT16_C( 17912),  INT16_C( 24230) },
+      {  INT16_C( 18528), -INT16_C(     1),  INT16_C(  9596), -INT16_C( 32512), -INT16_C(    18), -INT16_C(  8313),  INT16_C( 23686), -INT16_C( 28656) },
+      {  INT16_C( 29368),  INT16_C(   305),  INT16_C(    27),  INT16_C(    20),  INT16_C(     6), -INT16_C(     1),  INT16_C(    14), -INT16_C( 24506) },
+      {  INT16_C(     0), -INT16_C( 25271),  INT16_C(     0),  INT16_C(  3412), -INT16_C( 17901), -INT16_C( 16626),  INT16_C(     0),  INT16_C( 16762) } },
+    { UINT8_C( 63),
+      { -INT16_C(    81),  INT16_C( 15013), -INT16_C( 16485),  INT16_C( 16516), -INT16_C(   129),  INT16_C(     5), -INT16_C(  9985), -INT16_C(    14) },
+      {  INT16_C(   768),  INT16_C( 19233),  INT16_C(   128), -INT16_C(  5121), -INT16_C(  5617),  INT16_C( 12088),  INT16_C(  1810), -INT16_C( 24641) },
+      {  INT16_C(  3757),  INT16_C(     0), -INT16_C( 10754), -INT16_C( 32331),  INT16_C( 31346), -INT16_C( 30574),  INT16_C( 12304),  INT16_C(     0) },
+      {  INT16_C(  6151),  INT16_C( 15013),  INT16_C(   514), -INT16_C(  1532), -INT16_C(    33),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(  5),
+      { -INT16_C( 14310),  INT16_C( 27466), -INT16_C( 16421),  INT16_C( 11136),  INT16_C(     2),  INT16_C(  4112),  INT16_C(    13), -INT16_C(  5563) },
+      { -INT16_C(  8737),  INT16_C( 30025), -INT16_C( 28097),  INT16_C( 28324), -INT16_C( 32425), -INT16_C( 11931), -INT16_C( 26566), -INT16_C(   513) },
+      {  INT16_C(     7), -INT16_C(     1),  INT16_C(    32),  INT16_C(    16),  INT16_C(     1),  INT16_C(     1),  INT16_C(    26),  INT16_C(    19) },
+      { -INT16_C( 16496),  INT16_C(     0), -INT16_C( 16421),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 35),
+      { -INT16_C(  5137), -INT16_C(   257),  INT16_C( 32527),  INT16_C(     0),  INT16_C(  1100), -INT16_C( 16641), -INT16_C( 19373),  INT16_C( 31293) },
+      {  INT16_C( 32765), -INT16_C(     5),  INT16_C( 16640), -INT16_C(    65),  INT16_C(  7555), -INT16_C(    73), -INT16_C(     1), -INT16_C( 17166) },
+      {  INT16_C( 32272), -INT16_C(  1025),  INT16_C( 21161),  INT16_C(    17),  INT16_C(  8457), -INT16_C(  8193), -INT16_C(     1),  INT16_C(  1095) },
+      { -INT16_C(  5137), -INT16_C(     9),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   145),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(155),
+      { -INT16_C( 12289), -INT16_C( 19401),  INT16_C(  1024), -INT16_C(  9697), -INT16_C(  8193),  INT16_C( 10832), -INT16_C( 23543), -INT16_C( 18437) },
+      { -INT16_C(  2675), -INT16_C(   577),  INT16_C(  2647),  INT16_C(   260), -INT16_C( 14139), -INT16_C( 24095), -INT16_C( 12901), -INT16_C( 19459) },
+      { -INT16_C(     9), -INT16_C(   257),  INT16_C(    18),  INT16_C(    12), -INT16_C(  4623),  INT16_C(     0), -INT16_C(   513),  INT16_C( 13268) },
+      {  INT16_C(  7071), -INT16_C(  1153),  INT16_C(     0),  INT16_C(  4173), -INT16_C(  4097),  INT16_C(     0),  INT16_C(     0), -INT16_C(  9345) } },
+    { UINT8_C(  7),
+      { -INT16_C( 31670),  INT16_C(  3031),  INT16_C( 17297),  INT16_C( 18434), -INT16_C( 12519),  INT16_C(  7923),  INT16_C( 18786), -INT16_C(    65) },
+      {  INT16_C( 30878),  INT16_C(  8193),  INT16_C( 31815),  INT16_C(     0), -INT16_C( 32622),  INT16_C(  6110), -INT16_C(  4259),  INT16_C( 31647) },
+      {  INT16_C(     6),  INT16_C(    28),  INT16_C(    31),  INT16_C(    14),  INT16_C(    27),  INT16_C(   589),  INT16_C(    20),  INT16_C(    11) },
+      {  INT16_C( 31249),  INT16_C(    16), -INT16_C(  1906),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(  6),
+      { -INT16_C( 16513), -INT16_C(  4097), -INT16_C( 17828), -INT16_C(  4097), -INT16_C( 15726),  INT16_C( 24641),  INT16_C(  2080),  INT16_C(  9074) },
+      { -INT16_C(     4),  INT16_C(   704),  INT16_C(   208), -INT16_C(   129), -INT16_C(  8328),  INT16_C(  7154), -INT16_C( 15433),  INT16_C( 18311) },
+      {  INT16_C(    31), -INT16_C(     1),  INT16_C(    10),  INT16_C(     0),  INT16_C(     5),  INT16_C(    16),  INT16_C(     0),  INT16_C(    12) },
+      {  INT16_C(     0),  INT16_C(  1409),  INT16_C( 13358),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 55),
+      { -INT16_C( 32767),  INT16_C(  8054), -INT16_C( 21169),  INT16_C( 32573), -INT16_C( 17425), -INT16_C( 10210), -INT16_C( 31744), -INT16_C( 13498) },
+      { -INT16_C( 17187),  INT16_C(    32),  INT16_C(  9067),  INT16_C(   512),  INT16_C(  6400),  INT16_C( 19738),  INT16_C( 30701),  INT16_C( 14515) },
+      {  INT16_C( 20447),  INT16_C(    11),  INT16_C(     3),  INT16_C(    12), -INT16_C( 13356),  INT16_C( 11321),  INT16_C( 22690),  INT16_C(    14) },
+      {  INT16_C( 31163),  INT16_C(  1027),  INT16_C( 30121),  INT16_C(     0),  INT16_C(  3006), -INT16_C( 29332),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi16(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_shrdv_epi16(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   676259874),  INT32_C(      540672),  INT32_C(   688920908),  INT32_C(  1614824448) },
+      {  INT32_C(  1667118653), -INT32_C(   536883217),  INT32_C(  2122317823),  INT32_C(  2080587728) },
+      {  INT32_C(   921872688),  INT32_C(          19), -INT32_C(   285310985),  INT32_C(  2080193535) },
+      {  INT32_C(   910022577), -INT32_C(   100802559), -INT32_C(         430), -INT32_C(   133791840) } },
+    { {  INT32_C(   740297363),  INT32_C(           1), -INT32_C(  2000748740),  INT32_C(   910969795) },
+      {  INT32_C(          32),  INT32_C(  1845410819), -INT32_C(        8259),  INT32_C(   660399621) },
+      {  INT32_C(          31),  INT32_C(          51),  INT32_C(          42),  INT32_C(          36) },
+      {  INT32_C(          64), -INT32_C(   679452672), -INT32_C(   278777921),  INT32_C(  1399112892) } },
+    { { -INT32_C(   268435537),  INT32_C(      133528),  INT32_C(    51904640),  INT32_C(  1369266426) },
+      { -INT32_C(    20289222), -INT32_C(      458753), -INT32_C(   829431171),  INT32_C(  1352871744) },
+      {  INT32_C(          53),  INT32_C(          39),  INT32_C(  1946148351),  INT32_C(          15) },
+      {  INT32_C(  1397348223), -INT32_C(    33553389), -INT32_C(  1658862342),  INT32_C(  1585488698) } },
+    { {  INT32_C(     4194432),  INT32_C(     4259880), -INT32_C(    12583026), -INT32_C(  1016016881) },
+      {  INT32_C(   748045962),  INT32_C(    17170432),  INT32_C(  2130537153), -INT32_C(  1851618432) },
+      {  INT32_C(           0),  INT32_C(  2012970431), -INT32_C(  1342513153),  INT32_C(  2134061213) },
+      {  INT32_C(     4194432),  INT32_C(    34340864), -INT32_C(    33892989), -INT32_C(  1928045562) } },
+    { {  INT32_C(   402801028),  INT32_C(  1986149909), -INT32_C(  2067267552),  INT32_C(     4195600) },
+      {  INT32_C(   852511945), -INT32_C(   939524098), -INT32_C(  1740416280),  INT32_C(  1655827423) },
+      { -INT32_C(  1076904707),  INT32_C(          54), -INT32_C(   504354247),  INT32_C(          19) },
+      { -INT32_C(  1769839032), -INT32_C(        1575),  INT32_C(   565015618),  INT32_C(  1031528456) } },
+    { {  INT32_C(   536936456),  INT32_C(  1897361475),  INT32_C(    49777305), -INT32_C(   703843853) },
+      { -INT32_C(     8454209),  INT32_C(      524289),  INT32_C(   134350848),  INT32_C(    28901948) },
+      {  INT32_C(  2146435007), -INT32_C(   564827870),  INT32_C(           1),  INT32_C(          56) },
+      { -INT32_C(    16908418),  INT32_C(  1548082192),  INT32_C(    24888652), -INT32_C(  1191035690) } },
+    { { -INT32_C(   687882241), -INT32_C(   269029523), -INT32_C(    17806188), -INT32_C(   402653209) },
+      {  INT32_C(     2097440),  INT32_C(  1184394214), -INT32_C(   317402952), -INT32_C(  1819108904) },
+      {  INT32_C(          42),  INT32_C(          21),  INT32_C(      262147),  INT32_C(           3) },
+      {  INT32_C(  1211482095), -INT32_C(  1017170049),  INT32_C(   534645138),  INT32_C(   486539260) } },
+    { {  INT32_C(    16777217),  INT32_C(   406978600),  INT32_C(   978068040), -INT32_C(  1342703617) },
+      {  INT32_C(   225184619), -INT32_C(   195833308),  INT32_C(  1372679803), -INT32_C(   155189253) },
+      {  INT32_C(          13),  INT32_C(          41), -INT32_C(  2147483646),  INT32_C(           9) },
+      {  INT32_C(  1532495872),  INT32_C(   302784768), -INT32_C(   829224814), -INT32_C(    36176901) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r = simde_mm_shrdv_epi32(a, b, c);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const simde__mmask8 k;
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   269802030),  INT32_C(      590864),  INT32_C(  2103343771), -INT32_C(    33554477) },
+      UINT8_C(239),
+      { -INT32_C(  1084949652), -INT32_C(  2138536428), -INT32_C(    70883115),  INT32_C(  1120669850) },
+      { -INT32_C(   276828481),  INT32_C(          51),  INT32_C(          52),  INT32_C(          63) },
+      {  INT32_C(  2125067993),  INT32_C(   281182209),  INT32_C(  1720539093), -INT32_C(  2053627595) } },
+    { { -INT32_C(  1745877940),  INT32_C(   520516510),  INT32_C(   612630530), -INT32_C(  1808606933) },
+      UINT8_C(208),
+      { -INT32_C(   268969097), -INT32_C(   270582017), -INT32_C(  1148566899),  INT32_C(   785450416) },
+      {  INT32_C(          13),  INT32_C(           7),  INT32_C(          12),  INT32_C(   137250488) },
+      { -INT32_C(  1745877940),  INT32_C(   520516510),  INT32_C(   612630530), -INT32_C(  1808606933) } },
+    { {  INT32_C(    50503680), -INT32_C(      262145), -INT32_C(   536875529),  INT32_C(        1544) },
+      UINT8_C(237),
+      { -INT32_C(  2130607548), -INT32_C(  1874853888), -INT32_C(   135267347),  INT32_C(  1982207900) },
+      { -INT32_C(   624841537),  INT32_C(   497793229),  INT32_C(          36),  INT32_C(          11) },
+      {  INT32_C(    33752200), -INT32_C(      262145), -INT32_C(   570425633), -INT32_C(   209715200) } },
+    { {  INT32_C(  1874250901), -INT32_C(   412840109), -INT32_C(           1),  INT32_C(  1364230152) },
+      UINT8_C( 15),
+      { -INT32_C(       16387), -INT32_C(   851118711),  INT32_C(  1875169407),  INT32_C(   310640645) },
+      {  INT32_C(  1599340541),  INT32_C(          19), -INT32_C(  1006904516), -INT32_C(   554930696) },
+      { -INT32_C(      131093), -INT32_C(  1632551700), -INT32_C(    62060545), -INT32_C(  2080373423) } },
+    { { -INT32_C(      542657),  INT32_C(  1471611422),  INT32_C(      131076),  INT32_C(  1873803471) },
+      UINT8_C(101),
+      {  INT32_C(    10747905), -INT32_C(  1315975025), -INT32_C(   888139054),  INT32_C(  1642173761) },
+      {  INT32_C(          35),  INT32_C(          58),  INT32_C(        1088),  INT32_C(          30) },
+      {  INT32_C(  1073673991),  INT32_C(  1471611422),  INT32_C(      131076),  INT32_C(  1873803471) } },
+    { {  INT32_C(  1443594629),  INT32_C(       17408),  INT32_C(   545263681), -INT32_C(  1055182111) },
+      UINT8_C(183),
+      { -INT32_C(   878174345),  INT32_C(      131072),  INT32_C(  1849003454),  INT32_C(       16384) },
+      {  INT32_C(          22),  INT32_C(          29),  INT32_C(          22), -INT32_C(  1203085475) },
+      { -INT32_C(  1602364072),  INT32_C(     1048576), -INT32_C(   701040510), -INT32_C(  1055182111) } },
+    { {  INT32_C(    28918213), -INT32_C(     8471837), -INT32_C(    16777345), -INT32_C(   538464257) },
+      UINT8_C(231),
+      {  INT32_C(    37748736),  INT32_C(   520929480),  INT32_C(    67108864),  INT32_C(   277881856) },
+      { -INT32_C(   146800705), -INT32_C(  1346634763),  INT32_C(      262144),  INT32_C(    57279443) },
+      {  INT32_C(    75497472),  INT32_C(  1711687675), -INT32_C(    16777345), -INT32_C(   538464257) } },
+    { {  INT32_C(  1247020607), -INT32_C(    67111142), -INT32_C(  1629489153), -INT32_C(   940581377) },
+      UINT8_C( 34),
+      {  INT32_C(  1933569535), -INT32_C(  2078706089),  INT32_C(  1667316067), -INT32_C(      557121) },
+      {  INT32_C(          28),  INT32_C(  1756233593),  INT32_C(  1783189360),  INT32_C(          17) },
+      {  INT32_C(  1247020607),  INT32_C(   213593085), -INT32_C(  1629489153), -INT32_C(   940581377) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_shrdv_epi32(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(120),
+      { -INT32_C(         513),  INT32_C(  1396688839),  INT32_C(   836668342),  INT32_C(   888825535) },
+      { -INT32_C(  1241546945),  INT32_C(  1073741896), -INT32_C(   811519264), -INT32_C(  1538202942) },
+      {  INT32_C(  1028260980),  INT32_C(          51),  INT32_C(   142835972),  INT32_C(          10) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1332920679) } },
+    { UINT8_C(161),
+      {  INT32_C(   469299733),  INT32_C(   661440542), -INT32_C(   371812108),  INT32_C(    20971560) },
+      { -INT32_C(   420798008), -INT32_C(   676343406),  INT32_C(  1624375296),  INT32_C(   537930752) },
+      {  INT32_C(          36),  INT32_C(          24),  INT32_C(          52),  INT32_C(          52) },
+      { -INT32_C(  2118152415),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(146),
+      {  INT32_C(  1140740204),  INT32_C(  2080112639),  INT32_C(  1588909808),  INT32_C(  1188763015) },
+      { -INT32_C(   173992724), -INT32_C(  2135097012),  INT32_C(  1107558530), -INT32_C(      262421) },
+      { -INT32_C(  2137915392),  INT32_C(   100663296),  INT32_C(          60), -INT32_C(        9249) },
+      {  INT32_C(           0),  INT32_C(  2080112639),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 89),
+      { -INT32_C(  2015250453),  INT32_C(  1065369930),  INT32_C(  2130904858), -INT32_C(    46478843) },
+      { -INT32_C(      262401), -INT32_C(   491632913),  INT32_C(  1077941248),  INT32_C(  1295880340) },
+      { -INT32_C(   121239859),  INT32_C(          57),  INT32_C(          36),  INT32_C(        8256) },
+      { -INT32_C(   134463731),  INT32_C(           0),  INT32_C(           0), -INT32_C(    46478843) } },
+    { UINT8_C( 59),
+      {  INT32_C(     1056832),  INT32_C(   758359060), -INT32_C(     9437185), -INT32_C(   335552515) },
+      { -INT32_C(   929194794),  INT32_C(   272629776), -INT32_C(  1138819265), -INT32_C(  2147460990) },
+      {  INT32_C(          34),  INT32_C(          24),  INT32_C(          47), -INT32_C(   365690060) },
+      { -INT32_C(  2147219440),  INT32_C(  1073745965),  INT32_C(           0),  INT32_C(    92810943) } },
+    { UINT8_C(104),
+      {  INT32_C(    67114112),  INT32_C(  1612537651),  INT32_C(   458446510),  INT32_C(   536883216) },
+      { -INT32_C(  1180626011),  INT32_C(     2491993),  INT32_C(  1185461228),  INT32_C(   318728072) },
+      { -INT32_C(   174647211),  INT32_C(          43),  INT32_C(   537012256), -INT32_C(  1047505562) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   545259712) } },
+    { UINT8_C( 46),
+      { -INT32_C(  2146434912),  INT32_C(   873372477), -INT32_C(  1610612736),  INT32_C(  1869841825) },
+      {  INT32_C(  1342308352),  INT32_C(   239075328), -INT32_C(   810380275), -INT32_C(  2147215103) },
+      { -INT32_C(  1075912707),  INT32_C(          11), -INT32_C(   270794825),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(      426451),  INT32_C(  1697127232),  INT32_C(  1541202280) } },
+    { UINT8_C( 28),
+      {  INT32_C(       22528),  INT32_C(   431583244), -INT32_C(  1574938723), -INT32_C(   161583386) },
+      { -INT32_C(   481716452),  INT32_C(   100663425),  INT32_C(    53165166),  INT32_C(   938415414) },
+      {  INT32_C(          13),  INT32_C(          45),  INT32_C(           4),  INT32_C(   917699535) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   366869127),  INT32_C(   711847100) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_shrdv_epi32(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 1301754055272797361),  INT64_C( 1153484733869457408) },
+      { -INT64_C( 4611686018427453477), -INT64_C( 2565175187215555170) },
+      {  INT64_C(                  97), -INT64_C(  641696293326460702) },
+      { -INT64_C(     140816793706187), -INT64_C( 8874420686462877680) } },
+    { {  INT64_C( 6484048767411544062),  INT64_C( 8640691664084599254) },
+      { -INT64_C( 8432310263901125332), -INT64_C( 2330788733328556169) },
+      {  INT64_C(                   4), -INT64_C( 4616190167810588713) },
+      { -INT64_C( 4206432970464166401), -INT64_C( 1153221740742143098) } },
+    { {  INT64_C(  463589657305438650),  INT64_C(        152739782756) },
+      { -INT64_C(   74450200193692193),  INT64_C( 1962140230220072562) },
+      {  INT64_C(                  71),  INT64_C(  117391980994792975) },
+      { -INT64_C( 4752179412305545037), -INT64_C( 8294504613704949760) } },
+    { { -INT64_C( 4329941381315567463),  INT64_C(      74771085660288) },
+      { -INT64_C( 1729382258051321858),  INT64_C( 8151978738313076425) },
+      {  INT64_C( 1179233957404166868),  INT64_C(                   4) },
+      { -INT64_C( 3530843829398400186), -INT64_C( 8070445859055075064) } },
+    { {  INT64_C( 4917930801716269088), -INT64_C(          1174405633) },
+      {  INT64_C(  288511851967381508), -INT64_C( 5797528556654056557) },
+      {  INT64_C(                   3),  INT64_C(                  70) },
+      { -INT64_C( 8608630686640242172),  INT64_C( 5764607523015884791) } },
+    { { -INT64_C(      39737037447169), -INT64_C( 4590220487462353785) },
+      { -INT64_C( 5858603459310931105),  INT64_C( 8718959807618334719) },
+      {  INT64_C(          4447151244),  INT64_C(                  17) },
+      {  INT64_C( 3891110068346683385), -INT64_C( 2305878029816778229) } },
+    { {  INT64_C(   72620552586002434),  INT64_C(  576460760893886816) },
+      { -INT64_C( 5182081520002275385), -INT64_C( 3109550940891961662) },
+      {  INT64_C(                  28),  INT64_C(                  16) },
+      { -INT64_C( 5593896866398863328),  INT64_C( 2792803515016282120) } },
+    { { -INT64_C( 3696641118528510398), -INT64_C( 5766869218620342274) },
+      { -INT64_C( 6917529027469114239),  INT64_C(  288239177236152320) },
+      {  INT64_C(                  12),  INT64_C(                 102) },
+      {  INT64_C( 5196251469712474134),  INT64_C(  334968416471343067) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_shrdv_epi64(a, b, c);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const simde__mmask8 k;
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C(             6324292), -INT64_C( 9213801749016477680) },
+      UINT8_C(162),
+      { -INT64_C(        283486724097),  INT64_C( 4665910033735618093) },
+      {  INT64_C(                 128),  INT64_C(                  54) },
+      { -INT64_C(             6324292),  INT64_C(  185159454499059200) } },
+    { {  INT64_C(  576812993310360640),  INT64_C(   90923031727210502) },
+      UINT8_C( 30),
+      { -INT64_C( 4719776807548616969),  INT64_C(  577086100682640128) },
+      {  INT64_C(                  36),  INT64_C(                  52) },
+      {  INT64_C(  576812993310360640),  INT64_C( 2561426961271357460) } },
+    { {  INT64_C(     635003398524928),  INT64_C( 1170936762110314544) },
+      UINT8_C(231),
+      { -INT64_C(    4503875579027713), -INT64_C(   73535612543631361) },
+      {  INT64_C(                 121),  INT64_C(                  94) },
+      { -INT64_C(  576496074115547264), -INT64_C(    1125915996191968) } },
+    { {  INT64_C( 6354428652345995107), -INT64_C( 6080838141572050617) },
+      UINT8_C(243),
+      { -INT64_C( 6404333283457303694),  INT64_C(  288231476817821728) },
+      { -INT64_C( 8989815820600959740),  INT64_C(                  50) },
+      {  INT64_C( 2702994799985318646),  INT64_C(   18033313545988839) } },
+    { { -INT64_C(       1666468282369), -INT64_C( 2067572169442599389) },
+      UINT8_C(243),
+      { -INT64_C( 1327880896341220559),  INT64_C(  585503137039683584) },
+      {  INT64_C(                  53),  INT64_C(                  48) },
+      { -INT64_C( 7828696871515615233),  INT64_C( 2305915716836057934) } },
+    { { -INT64_C( 1765486026878402633), -INT64_C( 9077671351123967488) },
+      UINT8_C(152),
+      { -INT64_C( 7573834143733393421),  INT64_C(  578857704984940694) },
+      {  INT64_C(                  70),  INT64_C(                  33) },
+      { -INT64_C( 1765486026878402633), -INT64_C( 9077671351123967488) } },
+    { {  INT64_C( 6400120897043521590),  INT64_C( 8646906886504820459) },
+      UINT8_C(155),
+      {  INT64_C( 4750157934342487963),  INT64_C(   10134748462579716) },
+      { -INT64_C( 2738054669301837902),  INT64_C(                 112) },
+      { -INT64_C(  225650713275476428),  INT64_C(  108088590080440319) } },
+    { { -INT64_C(    9572402057189377), -INT64_C(   18577353305235714) },
+      UINT8_C(121),
+      {  INT64_C( 4200902071216440182),  INT64_C( 3403711443527420083) },
+      {  INT64_C( 4513084076764731224),  INT64_C(                  52) },
+      {  INT64_C( 1081839176812196727), -INT64_C(   18577353305235714) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_shrdv_epi64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C( 63),
+      {  INT64_C( 3780520496257520257),  INT64_C( 6266570321218567644) },
+      {  INT64_C(    5069848134619648),  INT64_C(       1202591367169) },
+      {  INT64_C(                 122),  INT64_C(                  29) },
+      {  INT64_C(  324470280615657485),  INT64_C(   18014444541617163) } },
+    { UINT8_C( 17),
+      { -INT64_C( 1480562529323313262),  INT64_C( 5390660484197422385) },
+      { -INT64_C( 1070563835232870899),  INT64_C(   83316601729845504) },
+      {  INT64_C(                  32),  INT64_C(                  43) },
+      {  INT64_C( 3139182722899246137),  INT64_C(                   0) } },
+    { UINT8_C(239),
+      {  INT64_C(  108104544004604764), -INT64_C(   40610540810109045) },
+      {  INT64_C( 2454682820130504704), -INT64_C( 9159758691845406720) },
+      { -INT64_C( 2305856205567852547),  INT64_C(                   6) },
+      {  INT64_C( 1190718487334486016),  INT64_C(  287595836451553790) } },
+    { UINT8_C(250),
+      { -INT64_C( 3831569609883546207),  INT64_C( 8646911215798058935) },
+      { -INT64_C( 1161928772992132225), -INT64_C( 2047029962411631686) },
+      {  INT64_C(                  56), -INT64_C(  324289959538198057) },
+      {  INT64_C(                   0), -INT64_C( 4668133914605264901) } },
+    { UINT8_C(223),
+      { -INT64_C( 2014914586501018750),  INT64_C(  155448146481131776) },
+      {  INT64_C(    2815368787722641),  INT64_C( 4650111767991550080) },
+      {  INT64_C(     598276060495874),  INT64_C(                  84) },
+      {  INT64_C( 8719643390229521120),  INT64_C(    2251948060590080) } },
+    { UINT8_C(147),
+      {  INT64_C(    9159619322577665), -INT64_C( 8196210182763988786) },
+      { -INT64_C( 2860489865503133599),  INT64_C( 2311059293187578539) },
+      {  INT64_C(                   1),  INT64_C( 7492718653864306716) },
+      { -INT64_C( 9218792227193486976),  INT64_C( 1511426861036692537) } },
+    { UINT8_C( 53),
+      {  INT64_C(   72836186250481680), -INT64_C( 1794055265267867341) },
+      { -INT64_C( 1153484729471729665), -INT64_C( 2887519068971295631) },
+      {  INT64_C(                 116),  INT64_C(                 102) },
+      { -INT64_C( 2306969046559494128),  INT64_C(                   0) } },
+    { UINT8_C( 13),
+      {  INT64_C(  511273959851810120),  INT64_C( 2450178168334844032) },
+      {  INT64_C( 1152921634261180432), -INT64_C( 8649985601302853727) },
+      { -INT64_C( 4675833580012244564),  INT64_C(                  47) },
+      {  INT64_C(  135952422357987718),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_shrdv_epi64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t c[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { -INT16_C(  5676),  INT16_C( 31781),  INT16_C(  7047), -INT16_C(     3),  INT16_C( 32765),  INT16_C(  3145), -INT16_C(  1035),  INT16_C( 19427),
+        -INT16_C(  8195), -INT16_C(  2466), -INT16_C( 26650), -INT16_C( 27264), -INT16_C(  6156), -INT16_C(     9), -INT16_C( 29786), -INT16_C( 10991) },
+      { -INT16_C(  8225), -INT16_C(    19),  INT16_C(    32), -INT16_C( 10297),  INT16_C( 14894),  INT16_C(   200), -INT16_C( 19538), -INT16_C(   513),
+         INT16_C( 11912), -INT16_C( 16492),  INT16_C(   530),  INT16_C( 29415),  INT16_C(  1092), -INT16_C( 17053), -INT16_C(  1537), -INT16_C(  9245) },
+      {  INT16_C(     3), -INT16_C(     1),  INT16_C(     7),  INT16_C( 22356), -INT16_C( 25287),  INT16_C(    26),  INT16_C(    17), -INT16_C(  8258),
+         INT16_C(  2084),  INT16_C(   640),  INT16_C(     0),  INT16_C( 16393),  INT16_C( 13204), -INT16_C( 26244),  INT16_C(    21),  INT16_C( 31732) },
+      { -INT16_C(   710), -INT16_C(    38),  INT16_C( 16439),       INT16_MAX,  INT16_C(  5951),  INT16_C( 12803),  INT16_C( 32250), -INT16_C(  2051),
+        -INT16_C( 29185), -INT16_C(  2466), -INT16_C( 26650),  INT16_C( 29642),  INT16_C( 20095), -INT16_C( 10689), -INT16_C(   931),  INT16_C( 15697) } },
+    { { -INT16_C( 26936),  INT16_C(     0), -INT16_C(   195), -INT16_C(     1), -INT16_C(  5837), -INT16_C( 12187),  INT16_C(   648),  INT16_C( 18560),
+         INT16_C(  1056),  INT16_C(   392), -INT16_C( 12376), -INT16_C(  1932),  INT16_C(    32),  INT16_C( 27489), -INT16_C(  1041),  INT16_C( 16384) },
+      {  INT16_C(    24), -INT16_C(  2385),  INT16_C(   205), -INT16_C(     1),  INT16_C( 28833),  INT16_C(    64),  INT16_C(   710), -INT16_C( 21332),
+        -INT16_C( 10755), -INT16_C( 29139),  INT16_C(  1154), -INT16_C(   129),  INT16_C( 28929),  INT16_C( 15306), -INT16_C(     1), -INT16_C( 10358) },
+      {  INT16_C(    22),  INT16_C(     4), -INT16_C(  4103), -INT16_C( 12008),  INT16_C( 16718),  INT16_C(    30),  INT16_C( 16385),  INT16_C(    48),
+         INT16_C(     9),  INT16_C( 32766),  INT16_C(    19),  INT16_C(     0), -INT16_C( 22084),  INT16_C(    11),  INT16_C(    20),  INT16_C(     5) },
+      {  INT16_C( 25179), -INT16_C(  4096),  INT16_C( 26367), -INT16_C(     1), -INT16_C( 15737),  INT16_C(   259),  INT16_C(   324),  INT16_C( 18560),
+        -INT16_C(   382),  INT16_C( 14516),  INT16_C( 23029), -INT16_C(  1932),  INT16_C(  4112),  INT16_C( 31053), -INT16_C(    66),  INT16_C( 20992) } },
+    { {  INT16_C( 20596), -INT16_C( 27797), -INT16_C( 16385),  INT16_C( 16237), -INT16_C(  2815),  INT16_C( 12287), -INT16_C(  4359),  INT16_C( 23891),
+         INT16_C(   130), -INT16_C(  9620), -INT16_C( 18273),  INT16_C( 32765), -INT16_C(    57), -INT16_C(  4059), -INT16_C( 32765),  INT16_C(  8610) },
+      { -INT16_C( 24508),  INT16_C( 14962), -INT16_C(  1029),  INT16_C(   512), -INT16_C(  5009),  INT16_C(     0), -INT16_C(     2), -INT16_C(  3649),
+        -INT16_C( 17304), -INT16_C(  8297), -INT16_C( 12262),  INT16_C( 32479), -INT16_C( 22120),  INT16_C(  7771), -INT16_C( 15394), -INT16_C(     1) },
+      {  INT16_C(    16),  INT16_C( 28665),  INT16_C(    32),  INT16_C(    17),  INT16_C(    28),  INT16_C(    26),  INT16_C(    19),  INT16_C(    64),
+        -INT16_C(  8273),  INT16_C(    22),  INT16_C(     0),  INT16_C(    26),  INT16_C(    14),  INT16_C(    16),  INT16_C( 27857),  INT16_C(     0) },
+      {  INT16_C( 20596),  INT16_C( 14665), -INT16_C( 16385),  INT16_C(  8118), -INT16_C( 14593),  INT16_C(    11), -INT16_C(  8737),  INT16_C( 23891),
+         INT16_C( 30928),  INT16_C( 24425), -INT16_C( 18273), -INT16_C( 18465), -INT16_C( 22941), -INT16_C(  4059),  INT16_C( 16385),  INT16_C(  8610) } },
+    { {  INT16_C( 28292), -INT16_C(  1025),  INT16_C(  5094),  INT16_C( 11384), -INT16_C(  4462),  INT16_C(  4256),  INT16_C( 16379),  INT16_C( 13615),
+        -INT16_C(  8193), -INT16_C( 15726),  INT16_C( 19572),  INT16_C(  3340), -INT16_C(     3),  INT16_C( 26311), -INT16_C( 17710), -INT16_C(  8715) },
+      {  INT16_C( 13880),  INT16_C(  7618),  INT16_C( 14336),  INT16_C(     0), -INT16_C(     1), -INT16_C(     2), -INT16_C( 11265), -INT16_C(     2),
+         INT16_C(  2048),  INT16_C( 29845),  INT16_C(  4164),  INT16_C(  8208),  INT16_C(  3132),  INT16_C( 18842),       INT16_MAX, -INT16_C( 16954) },
+      { -INT16_C( 12780),  INT16_C( 21821),  INT16_C(    21),  INT16_C(     0),  INT16_C(    29),  INT16_C(    29),  INT16_C( 20534),  INT16_C(    17),
+         INT16_C(     6),  INT16_C(     0),  INT16_C(    16),  INT16_C(    19),  INT16_C(     5), -INT16_C(     2), -INT16_C( 10616),  INT16_C(     7) },
+      { -INT16_C( 31000), -INT16_C(  4585),  INT16_C(   159),  INT16_C( 11384), -INT16_C(     1), -INT16_C(    16), -INT16_C(   769),  INT16_C(  6807),
+         INT16_C(   895), -INT16_C( 15726),  INT16_C( 19572),  INT16_C(   417), -INT16_C(  6145),  INT16_C(  9833), -INT16_C(    70), -INT16_C( 29253) } },
+    { {  INT16_C(   528), -INT16_C( 25100), -INT16_C(     9), -INT16_C(    17),  INT16_C(    32), -INT16_C(     7),  INT16_C( 26978),  INT16_C( 26723),
+        -INT16_C(   385),       INT16_MAX, -INT16_C( 24879), -INT16_C(  5118),  INT16_C(    32),  INT16_C( 30869), -INT16_C( 16385),  INT16_C( 16389) },
+      {  INT16_C( 28089),  INT16_C( 17408), -INT16_C( 10498),  INT16_C(   768), -INT16_C(    73), -INT16_C( 24386), -INT16_C(     9), -INT16_C(   105),
+        -INT16_C(     1), -INT16_C(  4705), -INT16_C( 11471), -INT16_C(  5265),       INT16_MAX,  INT16_C(  5267), -INT16_C(  5100), -INT16_C( 17284) },
+      {  INT16_C( 16686),  INT16_C( 29231),  INT16_C(    29),  INT16_C( 11753),  INT16_C(   530),  INT16_C( 15904), -INT16_C( 29247),  INT16_C(     2),
+         INT16_C(     3),  INT16_C(     0),  INT16_C( 28008),  INT16_C(     4),  INT16_C( 21878),  INT16_C( 18382),  INT16_C(    14),  INT16_C(   129) },
+      { -INT16_C( 18716), -INT16_C( 30719), -INT16_C( 18441), -INT16_C( 32641), -INT16_C( 16376), -INT16_C(     7), -INT16_C( 19279), -INT16_C(  9704),
+        -INT16_C(    49),       INT16_MAX,  INT16_C( 12702), -INT16_C(   320), -INT16_C(  1024),  INT16_C( 21069), -INT16_C( 20398),  INT16_C(  8194) } },
+    { {  INT16_C(  1473),  INT16_C( 24227), -INT16_C( 22472), -INT16_C(     1), -INT16_C(     5), -INT16_C(  6552), -INT16_C( 17180), -INT16_C(  2065),
+        -INT16_C( 18272),  INT16_C(  3679), -INT16_C( 18923), -INT16_C(  4785), -INT16_C( 18945), -INT16_C(  2209),  INT16_C(  9268), -INT16_C( 10246) },
+      { -INT16_C(     1), -INT16_C(  8201), -INT16_C(  4099),  INT16_C( 32766), -INT16_C( 21951), -INT16_C( 21622),  INT16_C( 32318),  INT16_C(  8224),
+         INT16_C(     2),  INT16_C( 16448), -INT16_C(    25), -INT16_C(  1025),  INT16_C(  8637),  INT16_C(  4096),  INT16_C( 31930),  INT16_C(  6434) },
+      {  INT16_C(     5),  INT16_C( 24561),  INT16_C(    16), -INT16_C(   321),  INT16_C(     9),  INT16_C(    16),  INT16_C(     2),  INT16_C(    32),
+         INT16_C(     8), -INT16_C( 13163),  INT16_C( 23749),  INT16_C( 19103),  INT16_C(    14), -INT16_C( 21361),  INT16_C(    20), -INT16_C(     1) },
+      { -INT16_C(  2002), -INT16_C( 20655), -INT16_C( 22472), -INT16_C(     3),  INT16_C(  8447), -INT16_C(  6552), -INT16_C( 20679), -INT16_C(  2065),
+         INT16_C(   696),  INT16_C(   114),  INT16_C( 15792), -INT16_C(  2049), -INT16_C( 30986),  INT16_C(  8193), -INT16_C( 23997),  INT16_C( 12869) } },
+    { {  INT16_C( 23663), -INT16_C(   291),  INT16_C( 32762),  INT16_C(     0), -INT16_C(  9163),  INT16_C(    16), -INT16_C( 22101),  INT16_C( 28411),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C( 23379),  INT16_C(  2639),  INT16_C(     4), -INT16_C(     1), -INT16_C( 24641),  INT16_C(    11) },
+      {  INT16_C(   128), -INT16_C( 22253),  INT16_C( 23700), -INT16_C(  7589),  INT16_C(    16), -INT16_C( 29726),  INT16_C( 31059),  INT16_C(  2068),
+        -INT16_C(    37),  INT16_C( 14375),  INT16_C( 16640),  INT16_C( 21072), -INT16_C( 29386), -INT16_C(   129),  INT16_C( 32703),  INT16_C( 12950) },
+      {  INT16_C( 15901),  INT16_C(     4),  INT16_C( 19717),  INT16_C(     8),  INT16_C(     0), -INT16_C( 30329),  INT16_C(    10),  INT16_C(     9),
+        -INT16_C(  1536), -INT16_C(     9),  INT16_C(    13),  INT16_C(    23), -INT16_C(     1),  INT16_C(     8),  INT16_C(  9451),  INT16_C(    13) },
+      {  INT16_C(  1026),  INT16_C( 16365), -INT16_C( 23553),  INT16_C( 23296), -INT16_C(  9163), -INT16_C( 15360),  INT16_C( 21738),  INT16_C(  2615),
+        -INT16_C(     1),  INT16_C( 20479),  INT16_C(  2053), -INT16_C( 24556),  INT16_C(  6764),       INT16_MAX, -INT16_C(  2061), -INT16_C( 27472) } },
+    { { -INT16_C( 24581),  INT16_C( 21929),  INT16_C( 21024), -INT16_C(  1285), -INT16_C(     1), -INT16_C( 32663), -INT16_C( 10696), -INT16_C( 11746),
+        -INT16_C(  1025),  INT16_C( 26969), -INT16_C(   513), -INT16_C(   129), -INT16_C(    17), -INT16_C(     1), -INT16_C(  1738), -INT16_C(  9743) },
+      { -INT16_C(  4885),  INT16_C(     2),  INT16_C( 26646), -INT16_C( 24202), -INT16_C(     1),  INT16_C(   512), -INT16_C( 32766), -INT16_C(    38),
+        -INT16_C(  1037),  INT16_C( 25601),  INT16_C( 32383),  INT16_C(   145),  INT16_C(  4967), -INT16_C( 24922),  INT16_C(   256),  INT16_C(     7) },
+      {  INT16_C(    19), -INT16_C(  1533),  INT16_C( 30719), -INT16_C( 31710),  INT16_C(    24), -INT16_C( 20579),  INT16_C(    32),  INT16_C(  5936),
+         INT16_C(    15), -INT16_C( 31998),  INT16_C(    16), -INT16_C( 31291),  INT16_C(    28),  INT16_C(     2),  INT16_C(    19), -INT16_C( 16565) },
+      {  INT16_C( 29695),  INT16_C( 19125), -INT16_C( 12244), -INT16_C( 16706), -INT16_C(     1),  INT16_C(  4100), -INT16_C( 10696), -INT16_C( 11746),
+        -INT16_C(  2073),  INT16_C( 23126), -INT16_C(   513), -INT16_C( 28677),  INT16_C( 13951), -INT16_C( 16385),  INT16_C(  7974),  INT16_C(   251) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi16(test_vec[i].c);
+    simde__m256i r = simde_mm256_shrdv_epi16(a, b, c);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const simde__mmask16 k;
+    const int16_t b[16];
+    const int16_t c[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { -INT16_C(  2561), -INT16_C(     1),  INT16_C(  4226),  INT16_C(     0),  INT16_C(  8170),  INT16_C( 12288),  INT16_C(     0), -INT16_C(     2),
+         INT16_C( 11740), -INT16_C( 31659), -INT16_C(     2),  INT16_C(   256), -INT16_C(  9475),  INT16_C(  4821),  INT16_C( 11663), -INT16_C( 23686) },
+      UINT16_C(16383),
+      { -INT16_C(   133), -INT16_C(  4098),  INT16_C( 12263), -INT16_C( 12368),  INT16_C(  1104), -INT16_C(   353), -INT16_C( 24145),  INT16_C(  2576),
+        -INT16_C(  5109),  INT16_C( 12916), -INT16_C(  8209), -INT16_C(  8047), -INT16_C(     1), -INT16_C( 28694), -INT16_C( 25496),  INT16_C(  4597) },
+      {  INT16_C( 10617),  INT16_C(    14), -INT16_C( 32416),  INT16_C(    21), -INT16_C(     6),  INT16_C(  5450), -INT16_C( 32504),  INT16_C(    11),
+        -INT16_C( 10245),  INT16_C( 16384), -INT16_C(     1), -INT16_C( 32576), -INT16_C( 27404),  INT16_C(  2066),  INT16_C(  3112),  INT16_C(  8192) },
+      { -INT16_C( 16902), -INT16_C( 16389),  INT16_C(  4226),       INT16_MIN,  INT16_C(  5127), -INT16_C( 22580), -INT16_C( 20736),  INT16_C( 16927),
+        -INT16_C( 32411), -INT16_C( 31659), -INT16_C( 16417),  INT16_C(   256), -INT16_C(   593), -INT16_C( 31563),  INT16_C( 11663), -INT16_C( 23686) } },
+    { { -INT16_C(  4358), -INT16_C( 16385), -INT16_C( 22004),  INT16_C(     8),  INT16_C( 16640), -INT16_C( 29001), -INT16_C( 15495), -INT16_C( 10133),
+         INT16_C(  4100), -INT16_C(  2762), -INT16_C( 14929), -INT16_C(  2516), -INT16_C(   273),  INT16_C(  2048),  INT16_C( 17158), -INT16_C(    65) },
+      UINT16_C(62106),
+      { -INT16_C( 26208),  INT16_C( 20475),  INT16_C(  2749), -INT16_C( 23426),       INT16_MIN,  INT16_C( 32759), -INT16_C(  4105), -INT16_C( 30105),
+        -INT16_C(  9289), -INT16_C(    19),  INT16_C(  2688), -INT16_C(     2),  INT16_C( 17283),  INT16_C( 11876), -INT16_C(  3311),  INT16_C(  2338) },
+      {  INT16_C(    31), -INT16_C( 21623),  INT16_C(     5),  INT16_C(     2), -INT16_C( 16645),  INT16_C( 20615),  INT16_C(    72),  INT16_C(    17),
+         INT16_C(    17),  INT16_C( 10024),  INT16_C(     1),  INT16_C(     0),  INT16_C( 13090),  INT16_C(    30), -INT16_C(     1),  INT16_C( 25637) },
+      { -INT16_C(  4358), -INT16_C(   545), -INT16_C( 22004), -INT16_C( 32766),  INT16_C(     8), -INT16_C( 29001), -INT16_C( 15495), -INT16_C(  5067),
+         INT16_C(  4100), -INT16_C(  4619), -INT16_C( 14929), -INT16_C(  2516), -INT16_C(    69), -INT16_C( 18032), -INT16_C(  6622),  INT16_C(  6141) } },
+    { {  INT16_C(     0), -INT16_C(   265),  INT16_C(  4814),  INT16_C(   258),  INT16_C(  4372), -INT16_C( 15946), -INT16_C( 28210),  INT16_C( 10681),
+        -INT16_C( 32212), -INT16_C( 32538), -INT16_C(   137),  INT16_C( 12968),  INT16_C( 16416),  INT16_C(  9248), -INT16_C(  2827), -INT16_C( 16393) },
+      UINT16_C(52132),
+      {  INT16_C( 17446),  INT16_C(   592),  INT16_C(     0),  INT16_C( 27492), -INT16_C(  7296),  INT16_C( 32727),  INT16_C(   130),  INT16_C( 23067),
+        -INT16_C(   130),  INT16_C(   264),  INT16_C( 13092),  INT16_C( 28312), -INT16_C( 20415), -INT16_C(  6306),  INT16_C( 25840), -INT16_C(  8257) },
+      {  INT16_C(    32), -INT16_C( 16385),  INT16_C( 11736),  INT16_C(    23),  INT16_C(    68),  INT16_C( 19362),  INT16_C(     6),  INT16_C(     6),
+         INT16_C(    16),  INT16_C(    12),  INT16_C(   264), -INT16_C( 12499),  INT16_C(     0),  INT16_C(    28),  INT16_C(     5), -INT16_C(  2566) },
+      {  INT16_C(     0), -INT16_C(   265),  INT16_C(    18),  INT16_C(   258),  INT16_C(  4372), -INT16_C(  3987), -INT16_C( 28210),  INT16_C( 27814),
+        -INT16_C( 32212),  INT16_C(  4232), -INT16_C(   137),  INT16_C( 29889),  INT16_C( 16416),  INT16_C(  9248), -INT16_C( 30809), -INT16_C(  4113) } },
+    { { -INT16_C(    65), -INT16_C( 22382), -INT16_C(  1514), -INT16_C( 32760), -INT16_C(  8488), -INT16_C(  1729), -INT16_C(     1),  INT16_C( 17024),
+         INT16_C(     9), -INT16_C(     1),  INT16_C( 17473),  INT16_C( 30522),  INT16_C( 25605),  INT16_C(  4147), -INT16_C( 26713),  INT16_C(     2) },
+      UINT16_C(55707),
+      {  INT16_C(  1088), -INT16_C( 24286), -INT16_C( 12062),  INT16_C(    66), -INT16_C(  7168),  INT16_C( 14814), -INT16_C( 32764), -INT16_C( 23344),
+        -INT16_C(    97),  INT16_C(  4096),  INT16_C( 30379), -INT16_C(  6145), -INT16_C( 17441), -INT16_C( 32220), -INT16_C(  7447), -INT16_C(  1185) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(    21), -INT16_C(  2962),  INT16_C( 16416),  INT16_C(    13), -INT16_C(  9363),  INT16_C(     6),
+         INT16_C(     4), -INT16_C(  1283), -INT16_C( 30399),  INT16_C(  4128),  INT16_C(    24),  INT16_C(     0),  INT16_C(  8627),  INT16_C(    21) },
+      { -INT16_C(    65), -INT16_C( 22382), -INT16_C(  1514),  INT16_C(   266), -INT16_C(  8488), -INT16_C(  1729), -INT16_C(     1),  INT16_C( 16650),
+        -INT16_C(  4096), -INT16_C(     1),  INT16_C( 17473),  INT16_C( 30522), -INT16_C(  8348),  INT16_C(  4147),  INT16_C( 13044), -INT16_C(  2048) } },
+    { { -INT16_C(   130),  INT16_C( 22442), -INT16_C( 31048), -INT16_C(  8258),  INT16_C( 14654), -INT16_C( 19178),  INT16_C( 22576), -INT16_C(  9233),
+         INT16_C( 16449), -INT16_C(    98),  INT16_C( 21896), -INT16_C(     1), -INT16_C(  8449), -INT16_C( 16706), -INT16_C( 16385), -INT16_C( 17784) },
+      UINT16_C(40896),
+      {  INT16_C( 32733),  INT16_C( 30779), -INT16_C( 20171), -INT16_C( 23644), -INT16_C( 21467), -INT16_C(     1), -INT16_C( 20617),  INT16_C(  9392),
+         INT16_C(   520), -INT16_C( 30852),  INT16_C(  5444),  INT16_C(     0), -INT16_C( 31486), -INT16_C(     9),  INT16_C(  8192),  INT16_C(    64) },
+      {  INT16_C(    16),  INT16_C( 27180),  INT16_C(    24),  INT16_C(    24),  INT16_C(    32), -INT16_C( 16537),  INT16_C(    19), -INT16_C(   501),
+        -INT16_C( 28793), -INT16_C( 23446),  INT16_C(    26),  INT16_C(    26),  INT16_C(    32),  INT16_C(    29), -INT16_C(  9560), -INT16_C( 16769) },
+      { -INT16_C(   130),  INT16_C( 22442), -INT16_C( 31048), -INT16_C(  8258),  INT16_C( 14654), -INT16_C( 19178), -INT16_C(  5370), -INT16_C( 27109),
+         INT16_C(  4224), -INT16_C(  8385),  INT16_C( 20757),  INT16_C(    63), -INT16_C(  8449), -INT16_C( 16706), -INT16_C( 16385),  INT16_C(   129) } },
+    { { -INT16_C(  3081), -INT16_C(  4426),  INT16_C( 14576), -INT16_C( 10206),  INT16_C( 19061),  INT16_C(  9193), -INT16_C( 10070), -INT16_C(     5),
+        -INT16_C( 21987), -INT16_C(   257),  INT16_C(     1),  INT16_C( 29841),  INT16_C(   256), -INT16_C( 20985),  INT16_C( 16396), -INT16_C( 32736) },
+      UINT16_C(30036),
+      { -INT16_C( 32736),  INT16_C( 23277), -INT16_C(  6831), -INT16_C( 13938),  INT16_C( 26611), -INT16_C( 22032), -INT16_C(  9217),  INT16_C( 30460),
+         INT16_C(  9347), -INT16_C(     1), -INT16_C(  1185), -INT16_C(  5150),  INT16_C(     4), -INT16_C(  8195),  INT16_C( 15605),  INT16_C( 10568) },
+      {  INT16_C(    21),  INT16_C( 30036),  INT16_C(    12), -INT16_C(  5560), -INT16_C(    65), -INT16_C( 18433),  INT16_C(     3), -INT16_C( 21722),
+         INT16_C(     1),       INT16_MIN,  INT16_C(  3338),  INT16_C(    21),  INT16_C(     0),  INT16_C(    29),  INT16_C(    13),  INT16_C(  6755) },
+      { -INT16_C(  3081), -INT16_C(  4426),  INT16_C( 21779), -INT16_C( 10206), -INT16_C( 12314),  INT16_C(  9193), -INT16_C(  1259), -INT16_C(     5),
+        -INT16_C( 10994), -INT16_C(   257), -INT16_C( 10304),  INT16_C( 29841),  INT16_C(   256), -INT16_C(    19), -INT16_C(  6230), -INT16_C( 32736) } },
+    { { -INT16_C( 22785), -INT16_C( 19516),  INT16_C( 16168),  INT16_C(   128), -INT16_C( 18437), -INT16_C(  4097),  INT16_C(  4244),  INT16_C(  3328),
+        -INT16_C(     1),  INT16_C(  7838),  INT16_C(   260), -INT16_C( 16389), -INT16_C(    33),  INT16_C(  5824), -INT16_C( 23498), -INT16_C( 11863) },
+      UINT16_C(40223),
+      {  INT16_C( 16720),  INT16_C(  5368),  INT16_C( 23636),  INT16_C(  2304), -INT16_C( 20809), -INT16_C( 29199), -INT16_C(    33),  INT16_C(    24),
+         INT16_C(    33),  INT16_C(     0),  INT16_C(  2196),  INT16_C(  9000), -INT16_C( 12891),  INT16_C( 14787), -INT16_C(  9117), -INT16_C( 14146) },
+      {  INT16_C(    12),  INT16_C(     5), -INT16_C( 27472),  INT16_C(     9),  INT16_C(    64), -INT16_C(    17),  INT16_C(    24),  INT16_C(    10),
+         INT16_C(    32),  INT16_C(  4697),  INT16_C( 19509),  INT16_C(    27),  INT16_C( 16388),  INT16_C(  1025), -INT16_C(    82),  INT16_C(  7591) },
+      {  INT16_C(  5386), -INT16_C( 14946),  INT16_C( 16168),       INT16_MIN, -INT16_C( 18437), -INT16_C(  4097),  INT16_C(  4244),  INT16_C(  3328),
+        -INT16_C(     1),  INT16_C(  7838), -INT16_C( 24568),  INT16_C( 25879),  INT16_C( 24573),  INT16_C(  5824), -INT16_C( 23498),  INT16_C( 32163) } },
+    { { -INT16_C( 22833),  INT16_C(  2147), -INT16_C(  6256), -INT16_C(     1), -INT16_C(  9389), -INT16_C(   747),  INT16_C(  4104),  INT16_C( 21531),
+        -INT16_C( 13588), -INT16_C( 24577), -INT16_C(  5137), -INT16_C( 10739),  INT16_C(  8192),  INT16_C( 31197),  INT16_C( 10305),  INT16_C(  8217) },
+      UINT16_C(51307),
+      { -INT16_C(  4679),  INT16_C(  4104),  INT16_C(   512),  INT16_C(   256),  INT16_C( 14904),  INT16_C( 24817),  INT16_C(   576), -INT16_C(  9164),
+         INT16_C(     0),  INT16_C( 10369),  INT16_C( 12921), -INT16_C(  1059), -INT16_C(  1033), -INT16_C( 21249), -INT16_C( 23698), -INT16_C(     1) },
+      {  INT16_C(    12),  INT16_C(    25), -INT16_C( 19946),  INT16_C(   704), -INT16_C(  7532),  INT16_C(    20),  INT16_C(     6),  INT16_C(  4297),
+         INT16_C(    22),  INT16_C(    27),  INT16_C(  4642),  INT16_C(  4161),  INT16_C(  5985), -INT16_C(    13),  INT16_C(    33), -INT16_C( 21231) },
+      { -INT16_C(  9318),  INT16_C(  1028), -INT16_C(  6256), -INT16_C(     1), -INT16_C(  9389),  INT16_C(  8145),  INT16_C(    64),  INT16_C( 21531),
+        -INT16_C( 13588), -INT16_C( 24577), -INT16_C(  5137), -INT16_C(  5370),  INT16_C(  8192),  INT16_C( 31197),  INT16_C(  5152), -INT16_C( 28660) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi16(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_shrdv_epi16(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t c[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(19072),
+      {  INT16_C( 32723),  INT16_C(   168),  INT16_C(    66),  INT16_C( 31200),  INT16_C(  1280), -INT16_C(     1), -INT16_C( 32627), -INT16_C( 31744),
+         INT16_C( 22056),  INT16_C( 24074), -INT16_C( 21506),  INT16_C(    96),  INT16_C(  4234),  INT16_C( 20018), -INT16_C( 28985),  INT16_C( 21248) },
+      {  INT16_C( 29554), -INT16_C( 16522), -INT16_C( 24384), -INT16_C(   193),  INT16_C(    64), -INT16_C(  4105), -INT16_C( 15277),  INT16_C( 12651),
+         INT16_C( 27672), -INT16_C( 12305),  INT16_C(  4096), -INT16_C( 17697), -INT16_C(  1049),  INT16_C(  4129), -INT16_C(  5343), -INT16_C(     1) },
+      {  INT16_C(     2),  INT16_C(  8528), -INT16_C(  8257), -INT16_C(  9480),  INT16_C(    33),  INT16_C(    19), -INT16_C(  4609),  INT16_C(  9452),
+         INT16_C(     7),  INT16_C(     4),  INT16_C(    14),  INT16_C(    28),  INT16_C(     5),  INT16_C(     5),  INT16_C(  7915),  INT16_C( 32511) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5816),
+         INT16_C(     0), -INT16_C(  2592),  INT16_C(     0), -INT16_C( 21008),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25649),  INT16_C(     0) } },
+    { UINT16_C( 5017),
+      { -INT16_C(    13),  INT16_C(     4),  INT16_C(  4096),  INT16_C(  4096), -INT16_C( 32511), -INT16_C( 32736), -INT16_C( 21295), -INT16_C( 25324),
+         INT16_C(   384), -INT16_C( 26032), -INT16_C(  2559),  INT16_C(  1026),  INT16_C(     1), -INT16_C(  2569), -INT16_C( 31623), -INT16_C(  3125) },
+      { -INT16_C(  8197), -INT16_C( 19850), -INT16_C( 27282),  INT16_C( 20425),  INT16_C(   128),  INT16_C( 15242), -INT16_C(     1),  INT16_C(     0),
+        -INT16_C( 23202), -INT16_C( 26944),  INT16_C(  6598), -INT16_C(  8265),  INT16_C( 32511), -INT16_C( 24029), -INT16_C( 32704),  INT16_C(  8191) },
+      { -INT16_C(     1),  INT16_C(     0), -INT16_C( 32735),  INT16_C(     0), -INT16_C( 16701),  INT16_C(    32),  INT16_C(    31),  INT16_C(     3),
+         INT16_C(     0),  INT16_C(    21),       INT16_MIN,  INT16_C(    30),  INT16_C(     5), -INT16_C( 30688),  INT16_C(     4), -INT16_C( 13365) },
+      { -INT16_C( 16393),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4096),  INT16_C(  4128),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5026),
+         INT16_C(   384),  INT16_C(  1234),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2048),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(17038),
+      {  INT16_C(  1652), -INT16_C( 28587), -INT16_C( 11476), -INT16_C( 32760),  INT16_C(    18), -INT16_C( 30227),  INT16_C(  2056),  INT16_C( 16410),
+        -INT16_C( 16394),  INT16_C(     2),  INT16_C( 13694),  INT16_C( 23314),  INT16_C( 15475),  INT16_C(     0),  INT16_C( 14255),  INT16_C( 31563) },
+      {  INT16_C(  2048), -INT16_C(  9403),  INT16_C(  7557), -INT16_C(  1867), -INT16_C( 16385), -INT16_C(  4049), -INT16_C(    33),  INT16_C( 10691),
+         INT16_C( 29755),  INT16_C(  2048), -INT16_C(     1), -INT16_C(     1), -INT16_C(  1447),  INT16_C( 26530), -INT16_C(  1033), -INT16_C(  6491) },
+      {  INT16_C( 25287), -INT16_C( 17464),  INT16_C(    33), -INT16_C( 27558),  INT16_C(    32), -INT16_C( 14639),  INT16_C(     4),  INT16_C(    23),
+         INT16_C( 16836),  INT16_C(    22), -INT16_C(  8193),  INT16_C(    23),  INT16_C( 13288), -INT16_C( 18694),  INT16_C(    25), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C( 17808), -INT16_C(  5738),  INT16_C( 11616),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31104),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1125),  INT16_C(     0) } },
+    { UINT16_C(43638),
+      { -INT16_C( 32229),  INT16_C(     1), -INT16_C(    33),  INT16_C(   128),  INT16_C(   164), -INT16_C(  7232), -INT16_C( 15980),  INT16_C( 24479),
+        -INT16_C(  9107),  INT16_C(  4104), -INT16_C(   129),  INT16_C(    32), -INT16_C(     4), -INT16_C(    83),  INT16_C(    64), -INT16_C( 16385) },
+      {  INT16_C(  4096), -INT16_C( 17464), -INT16_C( 28870), -INT16_C( 20350),  INT16_C( 25584), -INT16_C( 10841),  INT16_C(  2212),  INT16_C(     0),
+         INT16_C(  1173), -INT16_C( 32178), -INT16_C( 30874), -INT16_C( 18778),  INT16_C(  3136), -INT16_C(    19), -INT16_C( 25692), -INT16_C(    97) },
+      {  INT16_C(  2176),  INT16_C(    16),  INT16_C(     6),  INT16_C(    12),  INT16_C( 13905),  INT16_C(     7),  INT16_C(    12), -INT16_C( 11220),
+         INT16_C( 16388),  INT16_C(     3),  INT16_C(  3581), -INT16_C( 24576),  INT16_C( 25908), -INT16_C(    13),  INT16_C(  7561),  INT16_C(     9) },
+      {  INT16_C(     0),  INT16_C(     1), -INT16_C(  5121),  INT16_C(     0),  INT16_C(    82),  INT16_C( 20423), -INT16_C( 30132),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 15871),  INT16_C(     0),  INT16_C(    32),  INT16_C(     0), -INT16_C( 16395),  INT16_C(     0), -INT16_C( 12321) } },
+    { UINT16_C( 4841),
+      { -INT16_C(  1330),  INT16_C(  8224),  INT16_C( 16175),  INT16_C(     8), -INT16_C( 16641), -INT16_C( 32752),  INT16_C( 28354),  INT16_C( 32658),
+         INT16_C( 20319),  INT16_C(   258), -INT16_C(  8705),  INT16_C( 27669),  INT16_C( 14618), -INT16_C(   258),  INT16_C( 16416),  INT16_C(    32) },
+      { -INT16_C( 29442),  INT16_C(   322),  INT16_C(   328),  INT16_C( 11399),  INT16_C( 31893),  INT16_C(   384),  INT16_C( 13203),  INT16_C(   320),
+        -INT16_C(  2049),  INT16_C( 30262), -INT16_C( 30721), -INT16_C( 31591), -INT16_C(    26), -INT16_C( 29733),  INT16_C(   296), -INT16_C(     1) },
+      { -INT16_C(   513),  INT16_C(     0), -INT16_C( 14513),  INT16_C( 16384),  INT16_C( 29201), -INT16_C(  5073),  INT16_C(    11),  INT16_C( 25704),
+        -INT16_C(  8193),  INT16_C(     8), -INT16_C(  8449),  INT16_C(    27),  INT16_C( 16525), -INT16_C(  2561), -INT16_C(  8855), -INT16_C( 14627) },
+      {  INT16_C(  6653),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8),  INT16_C(     0),  INT16_C(   769),  INT16_C( 29293),  INT16_C( 16511),
+         INT16_C(     0),  INT16_C( 13825),  INT16_C(     0),  INT16_C(     0), -INT16_C(   207),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 7196),
+      { -INT16_C(    35), -INT16_C(     1), -INT16_C(     1), -INT16_C( 11418),  INT16_C( 32639), -INT16_C(  1033),  INT16_C(  1025),  INT16_C(  1028),
+        -INT16_C(   133), -INT16_C(  8875), -INT16_C(   898),  INT16_C(  8517), -INT16_C( 22785), -INT16_C( 29142),  INT16_C( 22854), -INT16_C( 23009) },
+      { -INT16_C( 21266),  INT16_C(  8320), -INT16_C(   513), -INT16_C( 31577), -INT16_C( 28522), -INT16_C(     1), -INT16_C(  4353),  INT16_C( 24845),
+        -INT16_C( 17409),  INT16_C( 30087), -INT16_C( 24988), -INT16_C(   643),  INT16_C(    32), -INT16_C(   129), -INT16_C( 32253),  INT16_C(  7176) },
+      {  INT16_C(    32), -INT16_C(  9567), -INT16_C( 20014), -INT16_C( 12833),  INT16_C(    26),  INT16_C( 16822),  INT16_C(     4),  INT16_C(     1),
+         INT16_C( 17107),  INT16_C(    14), -INT16_C( 12311), -INT16_C(   399),  INT16_C(    30),  INT16_C(    27),  INT16_C(   847), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(  2383),  INT16_C(  9631),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 12926), -INT16_C( 28510),  INT16_C(   130),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(41316),
+      {  INT16_C(    64), -INT16_C(    33), -INT16_C(  5534), -INT16_C(   291),  INT16_C(  1482), -INT16_C( 18044), -INT16_C( 10241), -INT16_C(  1466),
+        -INT16_C(  4098), -INT16_C(  2057),  INT16_C(  1261), -INT16_C( 17441),  INT16_C( 13200),  INT16_C(  7775),  INT16_C(     0), -INT16_C(   265) },
+      {  INT16_C( 30732), -INT16_C( 14646),  INT16_C( 23455),  INT16_C(   136), -INT16_C( 22153), -INT16_C( 27973),  INT16_C( 30152),  INT16_C( 31743),
+         INT16_C( 10711), -INT16_C(  7771),  INT16_C( 26455), -INT16_C(     9),  INT16_C(     0),  INT16_C(  1977), -INT16_C(  1025), -INT16_C(  6145) },
+      { -INT16_C( 32428), -INT16_C( 32639),  INT16_C(     7),  INT16_C(    24),  INT16_C(    27),  INT16_C(    27),  INT16_C(    18), -INT16_C( 10273),
+        -INT16_C( 12884),  INT16_C(    22),  INT16_C(     2),  INT16_C(    17),  INT16_C(    18),  INT16_C(    17),  INT16_C(     9),  INT16_C(    25) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 16340),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22391),  INT16_C( 13823),  INT16_C(     0),
+        -INT16_C( 25218),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 28881),  INT16_C(     0), -INT16_C(     1) } },
+    { UINT16_C(58080),
+      { -INT16_C(  7018),  INT16_C(  1263),  INT16_C( 21022), -INT16_C( 15163),  INT16_C( 23677),  INT16_C(     2), -INT16_C( 31623),  INT16_C( 12544),
+         INT16_C( 24571), -INT16_C(  2082), -INT16_C(    81),  INT16_C( 25738),  INT16_C(     0),  INT16_C( 11423), -INT16_C( 29704), -INT16_C(  2053) },
+      { -INT16_C( 28591),  INT16_C(   137), -INT16_C(    65),  INT16_C(     0),  INT16_C(  5364), -INT16_C(  5898),  INT16_C( 14925),  INT16_C(     0),
+         INT16_C(  1216), -INT16_C(  3786),  INT16_C(   288),  INT16_C( 16177), -INT16_C( 23670),  INT16_C( 16385),  INT16_C(  1537), -INT16_C( 17356) },
+      {  INT16_C( 31428),  INT16_C(     9),  INT16_C(    31),  INT16_C( 29363),  INT16_C(    28),  INT16_C(    16),  INT16_C(    32),  INT16_C(   325),
+         INT16_C(    12), -INT16_C( 29783),  INT16_C( 25947),  INT16_C(     4),  INT16_C(    32),  INT16_C(    24), -INT16_C(   193), -INT16_C( 17476) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     2), -INT16_C( 31623),  INT16_C(   392),
+         INT16_C(     0), -INT16_C( 25733),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   300),  INT16_C(  3075), -INT16_C( 15537) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi16(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_shrdv_epi16(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   660904002), -INT32_C(  1351472765), -INT32_C(     2097153),  INT32_C(     3145734),  INT32_C(  1049747198), -INT32_C(     4211729),  INT32_C(    33554432), -INT32_C(  1075052593) },
+      { -INT32_C(  1147249278),  INT32_C(   947140804),  INT32_C(  2145404406),  INT32_C(  1636797535), -INT32_C(  1003961072),  INT32_C(        5124), -INT32_C(  1352433386), -INT32_C(     4194881) },
+      { -INT32_C(   566030975), -INT32_C(  2100644877),  INT32_C(   268632065),  INT32_C(  2023622875),  INT32_C(          55),  INT32_C(    26509312), -INT32_C(        1025),  INT32_C(  1874198463) },
+      {  INT32_C(   330452001), -INT32_C(  2028431890),  INT32_C(  2146435071),  INT32_C(   837913568),  INT32_C(  1368006781), -INT32_C(     4211729),  INT32_C(  1590100524), -INT32_C(     8389761) } },
+    { { -INT32_C(   108845133), -INT32_C(  1314023041),  INT32_C(  1692217578),  INT32_C(  1610612718),  INT32_C(    33824768), -INT32_C(    65234719), -INT32_C(  1325838355), -INT32_C(       81921) },
+      {  INT32_C(   137920577),  INT32_C(   156371712),  INT32_C(   166637007),  INT32_C(   684631896), -INT32_C(       33797),  INT32_C(    33633296), -INT32_C(   570425345),  INT32_C(  1927189630) },
+      {  INT32_C(          28), -INT32_C(  2147483509),  INT32_C(           3),  INT32_C(           7),  INT32_C(  1611153496), -INT32_C(  1893080026),  INT32_C(           6),  INT32_C(          15) },
+      { -INT32_C(  2088238049),  INT32_C(  1612068275), -INT32_C(   325343715), -INT32_C(  1329594369), -INT32_C(     8652030),  INT32_C(  1139831395), -INT32_C(    20716225),  INT32_C(   687734781) } },
+    { {  INT32_C(   538970432),  INT32_C(  1437650986), -INT32_C(  1540413483), -INT32_C(   624894529),  INT32_C(  1456597230),  INT32_C(   953517791), -INT32_C(  1119742364), -INT32_C(   414912818) },
+      {  INT32_C(    67242112),  INT32_C(  2080087039),  INT32_C(     9175170), -INT32_C(   134217801),  INT32_C(         512),  INT32_C(  1859844275), -INT32_C(   268568601), -INT32_C(   935329792) },
+      {  INT32_C(  1165784009),  INT32_C(   984575481), -INT32_C(  1058594001), -INT32_C(      262145),  INT32_C(          32), -INT32_C(  1610415606),  INT32_C(          44),  INT32_C(   811864576) },
+      {  INT32_C(  1074794500), -INT32_C(    36831318),  INT32_C(    17123422), -INT32_C(   268435601),  INT32_C(  1456597230),  INT32_C(   751711585),  INT32_C(  2122044449), -INT32_C(   414912818) } },
+    { {  INT32_C(   134807552), -INT32_C(  1116188091), -INT32_C(   196259676),  INT32_C(  1171310711),  INT32_C(  2106881685),  INT32_C(  1610612415), -INT32_C(   285704386),  INT32_C(    38117888) },
+      { -INT32_C(    25165857),  INT32_C(  1409989692),  INT32_C(   687305194), -INT32_C(  1739814651), -INT32_C(  2141187567),  INT32_C(    83906560),  INT32_C(     3672577), -INT32_C(   100671493) },
+      { -INT32_C(  1433751582),  INT32_C(           0), -INT32_C(  1073741825),  INT32_C(          51),  INT32_C(          21),  INT32_C(  1465673550),  INT32_C(  1512357550),  INT32_C(          54) },
+      { -INT32_C(  1040039936), -INT32_C(  1116188091),  INT32_C(  1374610389), -INT32_C(  1860130630),  INT32_C(     9473004),  INT32_C(  1073840127),  INT32_C(   671595489), -INT32_C(     8393719) } },
+    { { -INT32_C(  2094813719), -INT32_C(   268436481),  INT32_C(   287932463),  INT32_C(  1346371584), -INT32_C(   217621801),  INT32_C(   223655557),  INT32_C(   541130760), -INT32_C(   383324625) },
+      { -INT32_C(  1076903937), -INT32_C(   818224642),  INT32_C(    28571560),  INT32_C(  1078001696),  INT32_C(   289108602), -INT32_C(     8389889), -INT32_C(           9),  INT32_C(    16777216) },
+      {  INT32_C(   269488786),  INT32_C(   770486638),  INT32_C(           2),  INT32_C(  1802016322), -INT32_C(     1441921),  INT32_C(          21),  INT32_C(   383989044),  INT32_C(      264272) },
+      { -INT32_C(   268443448), -INT32_C(  2013544449),  INT32_C(    71983115),  INT32_C(   336592896),  INT32_C(   578217205), -INT32_C(     2623382), -INT32_C(       36348),  INT32_C(       59686) } },
+    { {  INT32_C(    42074752),  INT32_C(  1775733419),  INT32_C(   294729008),  INT32_C(   830889148), -INT32_C(   570196389), -INT32_C(   778417901),  INT32_C(   960514044),  INT32_C(   242524885) },
+      { -INT32_C(   833380480), -INT32_C(  1610088192),  INT32_C(  1041751884),  INT32_C(  1330320747),  INT32_C(    21332000), -INT32_C(     3691537),  INT32_C(    54072434), -INT32_C(   426154324) },
+      { -INT32_C(  1082130721),  INT32_C(          33),  INT32_C(          10),  INT32_C(           3),  INT32_C(          30), -INT32_C(   134220801),  INT32_C(        6152),  INT32_C(          31) },
+      { -INT32_C(  1666760960),  INT32_C(   887866709), -INT32_C(   754686899),  INT32_C(  1714473879),  INT32_C(    85328003), -INT32_C(     7383073),  INT32_C(  1916354631), -INT32_C(   852308648) } },
+    { {  INT32_C(   904809467), -INT32_C(          49), -INT32_C(  2129625071),  INT32_C(    33947648),  INT32_C(         545),  INT32_C(  1395572281), -INT32_C(      533505), -INT32_C(  1761657135) },
+      {  INT32_C(     1050658), -INT32_C(   204737565),  INT32_C(  1941649424),  INT32_C(     8388657),  INT32_C(   782311470), -INT32_C(       18561),  INT32_C(   414836404), -INT32_C(  1246882835) },
+      {  INT32_C(    83978626),  INT32_C(          31),  INT32_C(           1),  INT32_C(          65),  INT32_C(          27),  INT32_C(     4227072), -INT32_C(  1589124716),  INT32_C(   496222929) },
+      { -INT32_C(  1921281282), -INT32_C(   409475129),  INT32_C(  1082671112), -INT32_C(  2130509824), -INT32_C(   735836736),  INT32_C(  1395572281), -INT32_C(  1637134337),  INT32_C(   167168895) } },
+    { { -INT32_C(       98691), -INT32_C(   820391152), -INT32_C(  1814758318),  INT32_C(  1498470915),  INT32_C(   151003136), -INT32_C(   536871937), -INT32_C(       81985), -INT32_C(   141789833) },
+      {  INT32_C(  1343302318),  INT32_C(   545390592),  INT32_C(   671088680), -INT32_C(   276856865),  INT32_C(     8389121),  INT32_C(  1342173183),  INT32_C(   295177773), -INT32_C(   587202561) },
+      {  INT32_C(          65),  INT32_C(   268706432),  INT32_C(          45),  INT32_C(           7), -INT32_C(    16809987),  INT32_C(          55),  INT32_C(          55),  INT32_C(           0) },
+      {  INT32_C(  2147434302), -INT32_C(   820391152),  INT32_C(    21274279), -INT32_C(  1095589452),  INT32_C(    67112968), -INT32_C(     2097217),  INT32_C(   807164927), -INT32_C(   141789833) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r = simde_mm256_shrdv_epi32(a, b, c);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const simde__mmask8 k;
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(         262), -INT32_C(   350851723), -INT32_C(       65538),  INT32_C(  2113929199),  INT32_C(      589824), -INT32_C(  1420459589),  INT32_C(    68159488), -INT32_C(    16885793) },
+      UINT8_C( 62),
+      { -INT32_C(  1253116379), -INT32_C(    35913729), -INT32_C(    33685506), -INT32_C(  1310025017),  INT32_C(   602099971), -INT32_C(   913031115),  INT32_C(      132419), -INT32_C(  1121823705) },
+      { -INT32_C(    71303169),  INT32_C(   394740158),  INT32_C(    54525953),  INT32_C(   322965504),  INT32_C(          27), -INT32_C(   745310642),  INT32_C(   531054703), -INT32_C(      589825) },
+      {  INT32_C(         262), -INT32_C(   143654913),  INT32_C(  2147450879),  INT32_C(  2113929199),  INT32_C(  2087329888),  INT32_C(    14069078),  INT32_C(    68159488), -INT32_C(    16885793) } },
+    { {  INT32_C(  1351410608), -INT32_C(  1815378149), -INT32_C(    13795842),  INT32_C(   716204666),  INT32_C(   912391289), -INT32_C(   272633089), -INT32_C(  1348298886),  INT32_C(   625360217) },
+      UINT8_C(147),
+      { -INT32_C(   436596630),  INT32_C(   772919520), -INT32_C(   969187409), -INT32_C(    10488323),  INT32_C(  1334721478), -INT32_C(        8961),  INT32_C(           0), -INT32_C(  1076887553) },
+      {  INT32_C(  2120370710),  INT32_C(          29), -INT32_C(   422499350),  INT32_C(          61),  INT32_C(          50), -INT32_C(  1780813941),  INT32_C(           3),  INT32_C(          33) },
+      { -INT32_C(   398350014),  INT32_C(  1888388868), -INT32_C(    13795842),  INT32_C(   716204666), -INT32_C(  1896772200), -INT32_C(   272633089), -INT32_C(  1348298886), -INT32_C(  1834803540) } },
+    { { -INT32_C(  1639805151), -INT32_C(  1978642430),  INT32_C(  1866981776), -INT32_C(   104701078),  INT32_C(   419955675),  INT32_C(   746564522),  INT32_C(  2143255538), -INT32_C(   151261185) },
+      UINT8_C(192),
+      { -INT32_C(    37256147),  INT32_C(  1497021089), -INT32_C(  1996554270), -INT32_C(   293601282), -INT32_C(   156245142),  INT32_C(  2122747833), -INT32_C(     8683537),  INT32_C(    34218004) },
+      { -INT32_C(    42027394), -INT32_C(   949438703),  INT32_C(  1705842947),  INT32_C(          34), -INT32_C(   707522613), -INT32_C(   134218785),  INT32_C(          18),  INT32_C(          51) },
+      { -INT32_C(  1639805151), -INT32_C(  1978642430),  INT32_C(  1866981776), -INT32_C(   104701078),  INT32_C(   419955675),  INT32_C(   746564522), -INT32_C(   537141265),  INT32_C(  1141022431) } },
+    { { -INT32_C(    15171080),  INT32_C(  1685194008), -INT32_C(   555631573),  INT32_C(     1065346), -INT32_C(  1757435821), -INT32_C(  1473029095), -INT32_C(  1476395009),  INT32_C(  1396712542) },
+      UINT8_C( 70),
+      { -INT32_C(  1073745922), -INT32_C(   505600886),  INT32_C(    33620994),  INT32_C(  2096364466), -INT32_C(           4), -INT32_C(  1043546291), -INT32_C(       33473), -INT32_C(  2147483644) },
+      { -INT32_C(  1796896937),  INT32_C(          25),  INT32_C(   403509264), -INT32_C(  1477483465),  INT32_C(          18),  INT32_C(          49),  INT32_C(          65),  INT32_C(          21) },
+      { -INT32_C(    15171080), -INT32_C(   292403918),  INT32_C(    67296993),  INT32_C(     1065346), -INT32_C(  1757435821), -INT32_C(  1473029095), -INT32_C(   738197505),  INT32_C(  1396712542) } },
+    { {  INT32_C(  1783880011), -INT32_C(   669397605), -INT32_C(  1103573231), -INT32_C(  2079818098), -INT32_C(  1366861976), -INT32_C(  2146959100), -INT32_C(    41947401),  INT32_C(   272663552) },
+      UINT8_C(  7),
+      {  INT32_C(  2004877311),  INT32_C(   426112029),  INT32_C(        1032), -INT32_C(  1082130433), -INT32_C(   918483043),  INT32_C(  2080374727),  INT32_C(    75548736), -INT32_C(   121282418) },
+      { -INT32_C(   407401035), -INT32_C(   840668700),  INT32_C(      165903),  INT32_C(          46), -INT32_C(   637763585),  INT32_C(           5),  INT32_C(  2130574334),  INT32_C(          37) },
+      { -INT32_C(        1198), -INT32_C(   578708263),  INT32_C(   135363697), -INT32_C(  2079818098), -INT32_C(  1366861976), -INT32_C(  2146959100), -INT32_C(    41947401),  INT32_C(   272663552) } },
+    { { -INT32_C(    85991441),  INT32_C(    67108864),  INT32_C(    16778240),  INT32_C(       32864),  INT32_C(  1795771175),  INT32_C(  1986407439), -INT32_C(       32914), -INT32_C(   411570177) },
+      UINT8_C(135),
+      { -INT32_C(   137429569), -INT32_C(   536952833), -INT32_C(    17047621), -INT32_C(   553648641),  INT32_C(   580625631), -INT32_C(   268435617), -INT32_C(  1073774594), -INT32_C(  1976023446) },
+      {  INT32_C(          51),  INT32_C(          24),  INT32_C(          33),  INT32_C(  1520688035),  INT32_C(          45),  INT32_C(          18),  INT32_C(           3),  INT32_C(          17) },
+      { -INT32_C(   541589669), -INT32_C(    20971772), -INT32_C(  2139094528),  INT32_C(       32864),  INT32_C(  1795771175),  INT32_C(  1986407439), -INT32_C(       32914),  INT32_C(   590705595) } },
+    { {  INT32_C(   134226008),  INT32_C(   841846848),  INT32_C(     1310724), -INT32_C(  2124490253),  INT32_C(   508065113),  INT32_C(  1361883665), -INT32_C(  1554622393),  INT32_C(  2147319803) },
+      UINT8_C(189),
+      {  INT32_C(   537954944),  INT32_C(    33558528),  INT32_C(  1332346518), -INT32_C(  1132103936),  INT32_C(   406404755),  INT32_C(  1608613422), -INT32_C(  1420468887),  INT32_C(   543967037) },
+      {  INT32_C(   608187392), -INT32_C(    73465865),  INT32_C(          43), -INT32_C(  1877039222),  INT32_C(           3),  INT32_C(           2),  INT32_C(           5),  INT32_C(          10) },
+      {  INT32_C(   134226008),  INT32_C(   841846848), -INT32_C(   759168384), -INT32_C(  1071622218),  INT32_C(  1674120875), -INT32_C(  1807012732), -INT32_C(  1554622393), -INT32_C(   815792289) } },
+    { { -INT32_C(      524289),  INT32_C(  1863471602),  INT32_C(       32896),  INT32_C(    16809984),  INT32_C(  1548945911),  INT32_C(  1345783434),  INT32_C(  1410551069),  INT32_C(   269484064) },
+      UINT8_C(196),
+      {  INT32_C(   612369424), -INT32_C(     2502689),  INT32_C(   104490007), -INT32_C(    17039393), -INT32_C(  2132779008), -INT32_C(  1445699625), -INT32_C(  1937404565), -INT32_C(  1917557182) },
+      {  INT32_C(    38011392), -INT32_C(   405783433),  INT32_C(          44),  INT32_C(          30),  INT32_C(  1065213778),  INT32_C(          45), -INT32_C(  1484696676),  INT32_C(   540024832) },
+      { -INT32_C(      524289),  INT32_C(  1863471602),  INT32_C(  1097859080),  INT32_C(    16809984),  INT32_C(  1548945911),  INT32_C(  1345783434), -INT32_C(   933701963),  INT32_C(   269484064) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_shrdv_epi32(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 75),
+      { -INT32_C(   679837879),  INT32_C(     4196608),  INT32_C(   689698694),  INT32_C(    67641344), -INT32_C(      655393), -INT32_C(   144441349), -INT32_C(   430637108),  INT32_C(       32839) },
+      {  INT32_C(  1418365621),  INT32_C(   227826514), -INT32_C(      589841),  INT32_C(   272662536),  INT32_C(   724508735),  INT32_C(  2127286833),  INT32_C(  1343212097), -INT32_C(        8209) },
+      {  INT32_C(          51),  INT32_C(          12), -INT32_C(  1319877558),  INT32_C(           0), -INT32_C(   161543473),  INT32_C(          53),  INT32_C(          15),  INT32_C(   822091912) },
+      {  INT32_C(  1364638447), -INT32_C(  1256193024),  INT32_C(           0),  INT32_C(    67641344),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1803301719),  INT32_C(           0) } },
+    { UINT8_C(234),
+      {  INT32_C(  1278244978), -INT32_C(  1496125866),  INT32_C(     1118208), -INT32_C(  2142036566), -INT32_C(  1879342234), -INT32_C(        4133), -INT32_C(  1342177329), -INT32_C(  2063073279) },
+      {  INT32_C(   200543867), -INT32_C(   577526181),  INT32_C(  2080374767), -INT32_C(  1117042401), -INT32_C(  1107362081), -INT32_C(   172711006), -INT32_C(    67108993),            INT32_MAX },
+      { -INT32_C(   176695297),  INT32_C(  1629390622), -INT32_C(    67379217),  INT32_C(   281281024),  INT32_C(          57),  INT32_C(          56),  INT32_C(      394272),  INT32_C(    34603018) },
+      {  INT32_C(           0),  INT32_C(  1984862574),  INT32_C(           0), -INT32_C(  2142036566),  INT32_C(           0), -INT32_C(  1264344321), -INT32_C(  1342177329), -INT32_C(     2014720) } },
+    { UINT8_C( 78),
+      { -INT32_C(   323340141),  INT32_C(      163850),  INT32_C(  1274907410), -INT32_C(  1212403421), -INT32_C(  1393765735),  INT32_C(    67113090), -INT32_C(  1566879041), -INT32_C(   281297921) },
+      { -INT32_C(      264713),  INT32_C(   823465692), -INT32_C(    67174593),  INT32_C(   881582169), -INT32_C(  1322021332), -INT32_C(   134217733),  INT32_C(  1757110324), -INT32_C(  1981941743) },
+      { -INT32_C(  2120598839),  INT32_C(           0),  INT32_C(           2),  INT32_C(      524291),  INT32_C(  1744005102), -INT32_C(   136314913),  INT32_C(           0),  INT32_C(          37) },
+      {  INT32_C(           0),  INT32_C(      163850), -INT32_C(   755014972),  INT32_C(   922191396),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1566879041),  INT32_C(           0) } },
+    { UINT8_C(131),
+      { -INT32_C(  1505406940), -INT32_C(  2144347488), -INT32_C(          41),  INT32_C(    19958018), -INT32_C(   203553313),  INT32_C(   806879376), -INT32_C(  2013233071),  INT32_C(  1608515295) },
+      { -INT32_C(     8388673), -INT32_C(   673251585), -INT32_C(   704648578),  INT32_C(    33562976), -INT32_C(  1581868113),  INT32_C(   249684010),  INT32_C(    75497576), -INT32_C(   294977538) },
+      {  INT32_C(          40),  INT32_C(          53),  INT32_C(   142606352),  INT32_C(          38),  INT32_C(  1191771174),  INT32_C(  2034584311), -INT32_C(     2146433),  INT32_C(          50) },
+      { -INT32_C(  1079622320), -INT32_C(   134743039),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1073768457) } },
+    { UINT8_C(110),
+      { -INT32_C(  1485039263),  INT32_C(   332317061), -INT32_C(    46141441),  INT32_C(   995051496),  INT32_C(  1177005285), -INT32_C(   134776833), -INT32_C(  1078526017), -INT32_C(   347141876) },
+      { -INT32_C(  1203308280),  INT32_C(   301992960),  INT32_C(  2052145751), -INT32_C(  1037940194),  INT32_C(  1360160373),  INT32_C(     8454144),  INT32_C(  1079432724), -INT32_C(   513970533) },
+      { -INT32_C(         259),  INT32_C(          41),  INT32_C(          14),  INT32_C(    67115168),  INT32_C(          43),  INT32_C(  1073741303),  INT32_C(           5),  INT32_C(          27) },
+      {  INT32_C(           0),  INT32_C(      649056),  INT32_C(   157283583),  INT32_C(   995051496),  INT32_C(           0),  INT32_C(    33554927), -INT32_C(  1510098947),  INT32_C(           0) } },
+    { UINT8_C( 84),
+      { -INT32_C(  2109879728),  INT32_C(  1910407056), -INT32_C(     5508225),  INT32_C(  1739111888),  INT32_C(    67371008), -INT32_C(  1785739240), -INT32_C(    34605058), -INT32_C(   418584962) },
+      { -INT32_C(         257), -INT32_C(       65569),  INT32_C(  1595351544),  INT32_C(   325555322), -INT32_C(          19), -INT32_C(   205521537), -INT32_C(    81139145), -INT32_C(   722601444) },
+      {  INT32_C(          15),  INT32_C(           2),  INT32_C(    16787728),  INT32_C(  1830855620), -INT32_C(    13008961), -INT32_C(  1141112834),  INT32_C(          13),  INT32_C(  1648242368) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   569966507),  INT32_C(           0), -INT32_C(          38),  INT32_C(           0),  INT32_C(  1371533183),  INT32_C(           0) } },
+    { UINT8_C( 38),
+      { -INT32_C(    16810329), -INT32_C(    67764225), -INT32_C(    19034113), -INT32_C(   537661457), -INT32_C(  1204478447), -INT32_C(      268321),  INT32_C(  2147467003), -INT32_C(  1725400487) },
+      {  INT32_C(   366017543), -INT32_C(     2129929),  INT32_C(  2074869759), -INT32_C(   139854849),  INT32_C(  1979432959), -INT32_C(  1058764363),  INT32_C(   140247040),  INT32_C(   266498793) },
+      {  INT32_C(          57),  INT32_C(          14),  INT32_C(           0),  INT32_C(          22),  INT32_C(   268468292), -INT32_C(   959610929), -INT32_C(   431392033),  INT32_C(          29) },
+      {  INT32_C(           0), -INT32_C(     2101289), -INT32_C(    19034113),  INT32_C(           0),  INT32_C(           0),  INT32_C(   325844983),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(145),
+      {  INT32_C(     4194386), -INT32_C(  1862266880),  INT32_C(   979424551), -INT32_C(  1052465979),  INT32_C(  1392648681),  INT32_C(  1390581339), -INT32_C(   645909728),  INT32_C(   125997683) },
+      { -INT32_C(   169338419),  INT32_C(   277159018), -INT32_C(   277874711),  INT32_C(  1035478768),  INT32_C(   450188283),  INT32_C(  1124073728), -INT32_C(   187874871), -INT32_C(  1914160636) },
+      {  INT32_C(          60), -INT32_C(   311289833),  INT32_C(   658133706),  INT32_C(           5),  INT32_C(           9),  INT32_C(    18354178),  INT32_C(          32),  INT32_C(          41) },
+      {  INT32_C(  1585552592),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    39223024),  INT32_C(           0),  INT32_C(           0),  INT32_C(    33800521) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_shrdv_epi32(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 5361321844268879296), -INT64_C(           100667401), -INT64_C(  288303115818635809),  INT64_C( 2144122355911697285) },
+      { -INT64_C( 8495811355769288270), -INT64_C( 6513868908268752091), -INT64_C(   18049720320786433),  INT64_C(     563087426977792) },
+      { -INT64_C(   36036089873434625),  INT64_C(                  85), -INT64_C( 5366909760962159406), -INT64_C( 3494006560243976256) },
+      {  INT64_C( 1455121362170975076),  INT64_C( 8041511386204864463), -INT64_C(       1099789107585),  INT64_C( 2144122355911697285) } },
+    { { -INT64_C(  580964903834098691), -INT64_C( 1530760547795300606), -INT64_C(  167174333868762479),  INT64_C( 5427908094089052055) },
+      {  INT64_C( 2862488366952119188),  INT64_C(   18014558497013890),  INT64_C( 2996776153672177461), -INT64_C(  286304640300834144) },
+      { -INT64_C( 2073712351979795811),  INT64_C(                  71), -INT64_C( 9187343204937103104),  INT64_C(                  97) },
+      {  INT64_C( 7994976376543247355),  INT64_C(  420386497447916830), -INT64_C(  167174333868762479),  INT64_C( 2929962437252343507) } },
+    { { -INT64_C( 2450028841045950693), -INT64_C( 4223295687251988420),  INT64_C( 6485467283446595840),  INT64_C( 9214360430812325887) },
+      {  INT64_C( 7494033794907766784),  INT64_C( 4419953038601668353),  INT64_C( 8643955797027454935), -INT64_C( 3224214040304326555) },
+      {  INT64_C(                  65), -INT64_C(     140737555468297), -INT64_C( 2323936716458688513),  INT64_C( 4752778773542414122) },
+      {  INT64_C( 7998357616331800461), -INT64_C( 5933565302220651638), -INT64_C( 1158832479654641746), -INT64_C( 7318924052085606402) } },
+    { { -INT64_C(  648518897209704993), -INT64_C( 1585302802962841603), -INT64_C( 6826345820136024011), -INT64_C(         17183146145) },
+      {  INT64_C( 3076051501735413020), -INT64_C( 6192363933044351575),  INT64_C( 6991702128704769279),  INT64_C( 3317679626567270747) },
+      {  INT64_C(                  66),  INT64_C(                   6),  INT64_C(                 114),  INT64_C(                  24) },
+      {  INT64_C( 4449556294124961655), -INT64_C( 6365838631633952769), -INT64_C( 2233021037375657904),  INT64_C( 1711750488447253503) } },
+    { { -INT64_C( 1982263415463384340),  INT64_C( 8188533705663451485), -INT64_C( 3437739582768578954), -INT64_C(   11269174786088986) },
+      { -INT64_C( 4873157614399395675), -INT64_C(  144185556820036610),  INT64_C( 2305824867267608447), -INT64_C( 2613842957647197965) },
+      { -INT64_C(       8040178947329),  INT64_C(                  37),  INT64_C( 3438078210297773392), -INT64_C( 8182247666409655029) },
+      {  INT64_C( 8700428844910760267), -INT64_C(        412525716448),  INT64_C( 9187290784092666567),  INT64_C( 2197751115630051027) } },
+    { { -INT64_C( 4430458352674455975), -INT64_C( 2209775538939188699), -INT64_C( 9142042099770095759), -INT64_C(    1429777433038881) },
+      { -INT64_C( 5764643815508412417),  INT64_C( 2936417325800816832),  INT64_C( 1757707701891069468), -INT64_C(    5066695609827369) },
+      {  INT64_C( 1297612871136448776),  INT64_C(                   8),  INT64_C(     151741261676800),  INT64_C(                  22) },
+      { -INT64_C(   17306477940134594), -INT64_C( 4548260360088441174), -INT64_C( 9142042099770095759), -INT64_C(  648694268542681089) } },
+    { { -INT64_C( 6734652302518551269),  INT64_C( 6896690499154329599),  INT64_C( 5463780006931215607), -INT64_C(     587689099412995) },
+      { -INT64_C( 2414305434089750065), -INT64_C( 7661318676393765477),  INT64_C( 1008735947749064399), -INT64_C( 6110280691755005331) },
+      {  INT64_C(                 102),  INT64_C(                  65),  INT64_C(                 102), -INT64_C( 4616763702908160001) },
+      { -INT64_C(   56536856786229547), -INT64_C( 5775026787277611009), -INT64_C(    2533295238722309),  INT64_C( 6226182690199540955) } },
+    { {  INT64_C( 1724456444817833471),  INT64_C(   72059793867603968), -INT64_C(      37520909860866), -INT64_C( 7806448933709136319) },
+      { -INT64_C( 5363429520930677350),  INT64_C( 4676615275531723893), -INT64_C(  472882362175193089), -INT64_C(  192386334284300937) },
+      {  INT64_C(                 122), -INT64_C( 1348167144619881004), -INT64_C( 3876007815949779671), -INT64_C( 9072665950330917903) },
+      {  INT64_C( 7228648060918130309), -INT64_C( 4735728453504990463), -INT64_C(   27303072740933650),  INT64_C( 4671071380693567956) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_shrdv_epi64(a, b, c);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const simde__mmask8 k;
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 8198618484372523837),  INT64_C( 4017316536151914554),  INT64_C( 6570658928733192224),  INT64_C( 8266412199864120362) },
+      UINT8_C( 76),
+      { -INT64_C(  321346795696306680), -INT64_C(  288232644432373761), -INT64_C(   72059793061183649),  INT64_C(  307933899416170528) },
+      { -INT64_C( 6825418298749526071),  INT64_C(                 108),  INT64_C(  648518363521220624), -INT64_C( 5291026176286880812) },
+      {  INT64_C( 8198618484372523837),  INT64_C( 4017316536151914554), -INT64_C(   45217210951820444),  INT64_C(  504973991683920701) } },
+    { {  INT64_C( 6715667776807999625),  INT64_C(    1130864889053784),  INT64_C( 6211340186630518631),  INT64_C( 4611694814839312386) },
+      UINT8_C(150),
+      {  INT64_C( 5279441648851481698),  INT64_C(       4398046531664),  INT64_C( 6510430566980614633), -INT64_C( 3463554123943657473) },
+      {  INT64_C( 1265798514288384946),  INT64_C(                 100),  INT64_C(                  97), -INT64_C(  596771993425349798) },
+      {  INT64_C( 6715667776807999625),  INT64_C(       5519032991816), -INT64_C( 5774532863167197570),  INT64_C( 4611694814839312386) } },
+    { {  INT64_C( 2567714115021649611), -INT64_C(  432416001693483041),  INT64_C(    9025411124299776), -INT64_C( 4022741637882643207) },
+      UINT8_C(160),
+      { -INT64_C( 1564926776478239681),  INT64_C(  576496486431854594), -INT64_C(  459677263317751323),  INT64_C(  452617672425735168) },
+      { -INT64_C(  579561924851664899),  INT64_C( 6123819533115358264),  INT64_C(                  66), -INT64_C( 4684097655213654017) },
+      {  INT64_C( 2567714115021649611), -INT64_C(  432416001693483041),  INT64_C(    9025411124299776), -INT64_C( 4022741637882643207) } },
+    { {  INT64_C( 4611683681830686463), -INT64_C(   82297386663673889),  INT64_C( 6510675099541652855),  INT64_C( 8052431322301300735) },
+      UINT8_C(125),
+      { -INT64_C( 4317509329605552382), -INT64_C(   18317898212843521),  INT64_C( 3781346808184645979), -INT64_C(     562984316076033) },
+      {  INT64_C(                  47), -INT64_C( 3222914170604697014), -INT64_C( 4731695715888586466),  INT64_C(                  14) },
+      {  INT64_C( 4631843202662694911), -INT64_C(   82297386663673889), -INT64_C( 1613232677166890488), -INT64_C(     634418502893571) } },
+    { {  INT64_C( 3083382866498337210), -INT64_C(   36099165771661313),  INT64_C( 8718387236652185471), -INT64_C( 1161937499954626567) },
+      UINT8_C(188),
+      { -INT64_C( 1613467959636641673), -INT64_C( 4611688243793232385),  INT64_C( 2488273978494294024), -INT64_C( 3458764517335401494) },
+      {  INT64_C(                 124),  INT64_C(                 129), -INT64_C(  295289824917585977), -INT64_C(   74459000715878433) },
+      {  INT64_C( 3083382866498337210), -INT64_C(   36099165771661313),  INT64_C( 1221033904893192174),  INT64_C( 6701065793527869439) } },
+    { { -INT64_C( 8131598506701491439),  INT64_C( 8472884806120093056),  INT64_C( 8280949923800767313), -INT64_C( 1234003892300152833) },
+      UINT8_C(194),
+      {  INT64_C(  288230376172683273), -INT64_C( 4971983335153745921),  INT64_C(      17663057215504), -INT64_C( 8181864404245023784) },
+      {  INT64_C( 1459782091947975492),  INT64_C(  288230930202525696),  INT64_C(                   7),  INT64_C(                  96) },
+      { -INT64_C( 8131598506701491439),  INT64_C( 8472884806120093056),  INT64_C( 8280949923800767313), -INT64_C( 1234003892300152833) } },
+    { {  INT64_C(    9042676087324752),  INT64_C(   18034413191696418), -INT64_C( 1207422235218813993),  INT64_C(  792776471205904641) },
+      UINT8_C(219),
+      { -INT64_C( 1176652213459285983),  INT64_C( 2522018127798862088), -INT64_C(  233192788384976514),  INT64_C(   72339142233055744) },
+      {  INT64_C(                  33),  INT64_C(                   8),  INT64_C(                  83), -INT64_C( 9214012989517069824) },
+      { -INT64_C( 1996638278382514142),  INT64_C(  576531199229953552), -INT64_C( 1207422235218813993),  INT64_C(  792776471205904641) } },
+    { {  INT64_C( 5760671618112107145), -INT64_C( 4055430230260213484), -INT64_C( 4612882561994653731), -INT64_C( 1833953575002584685) },
+      UINT8_C( 32),
+      {  INT64_C( 3682346410557304509), -INT64_C( 6726138314636152111),  INT64_C( 6915276057444614142),  INT64_C(  936381516926420692) },
+      {  INT64_C( 6271249626913185957),  INT64_C(                  76),  INT64_C(    8453191458947089),  INT64_C(                  98) },
+      {  INT64_C( 5760671618112107145), -INT64_C( 4055430230260213484), -INT64_C( 4612882561994653731), -INT64_C( 1833953575002584685) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_shrdv_epi64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(203),
+      {  INT64_C(  873980080249176192),  INT64_C(  339159506044701074),  INT64_C(  360292368336846912),  INT64_C( 5639204500438841862) },
+      { -INT64_C( 2380454219008180225),  INT64_C( 3373330942609929129),  INT64_C( 4507519886524952539), -INT64_C( 5814992691406689563) },
+      { -INT64_C(    4503633987387393),  INT64_C(                 104),  INT64_C(  579876447807477894),  INT64_C(       1099528414208) },
+      { -INT64_C( 4760908438016360450), -INT64_C( 7016580509773548305),  INT64_C(                   0),  INT64_C( 5639204500438841862) } },
+    { UINT8_C( 55),
+      {  INT64_C(       4399122481152), -INT64_C( 6953309789297278547),  INT64_C( 5337047361036370976), -INT64_C(  396334359395738633) },
+      { -INT64_C(   18087520329007113),  INT64_C(    5418943058018312),  INT64_C(  112607857899405312), -INT64_C( 9223090561877900784) },
+      {  INT64_C( 9079113361437736959),  INT64_C(                  90),  INT64_C(                  29),  INT64_C(                 120) },
+      { -INT64_C(   36175040658014226),  INT64_C(  144117558364628366),  INT64_C( 5194902180112892514),  INT64_C(                   0) } },
+    { UINT8_C( 68),
+      { -INT64_C( 3292435553984888256), -INT64_C(  511367263382780086),  INT64_C( 6917490475947515837), -INT64_C( 9187306955918540782) },
+      {  INT64_C( 5670954768573971748),  INT64_C(   22097985124958216),  INT64_C( 4555065978019711818),  INT64_C(   39408439923602966) },
+      {  INT64_C(                  72),  INT64_C( 2690844750871254019),  INT64_C(                  30),  INT64_C(                 104) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3554515662166520767),  INT64_C(                   0) } },
+    { UINT8_C(216),
+      {  INT64_C(  306245118527023392), -INT64_C( 8527807381252005317),  INT64_C( 4556171872050947918),  INT64_C( 1371682639535527247) },
+      { -INT64_C(  453465268077490163),  INT64_C( 1894805367084124134),  INT64_C(        276054412801),  INT64_C(  146438043831107584) },
+      {  INT64_C( 4610429030980748336),  INT64_C( 4613975236130374789),  INT64_C( 2305843009214742528), -INT64_C(             8391179) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4757208586755506328) } },
+    { UINT8_C( 34),
+      {  INT64_C(  959276445934037184), -INT64_C(    1126181227204769), -INT64_C( 2870834682210314708), -INT64_C(   36028801448419332) },
+      { -INT64_C( 1034038678313277498), -INT64_C( 1153097978538624004),  INT64_C(  324259177532776456),  INT64_C( 5834832102459710726) },
+      {  INT64_C(                  57),  INT64_C(                   4), -INT64_C( 3308100534872405628), -INT64_C( 9136809683242188542) },
+      {  INT64_C(                   0), -INT64_C( 3458834900147241227),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(123),
+      {  INT64_C( 9205287200877182831),  INT64_C( 6998248181202313014),  INT64_C(    1205614769618960),  INT64_C(   45110831783870592) },
+      {  INT64_C(  294985849680957504), -INT64_C(    4504699207164161), -INT64_C( 6845396663590977336),  INT64_C( 1124585107062883175) },
+      { -INT64_C( 2305843561126429196), -INT64_C(  648801007804883073),  INT64_C( 4566638476205752255),  INT64_C(                 122) },
+      { -INT64_C( 9223068571628468229), -INT64_C(    9009398414328322),  INT64_C(                   0), -INT64_C( 1813529442813683264) } },
+    { UINT8_C( 46),
+      {  INT64_C( 5764616319446220804), -INT64_C( 2422459553826231875),  INT64_C( 6876090984616675774), -INT64_C(  301741312481166917) },
+      { -INT64_C(   54363154596513825),  INT64_C(   13546876909387776),  INT64_C( 8634948502981146575), -INT64_C( 1752605983802851924) },
+      {  INT64_C( 2884250886287589614),  INT64_C(                 124),  INT64_C(                  75), -INT64_C( 5610209761812355497) },
+      {  INT64_C(                   0),  INT64_C(  216750030550204429), -INT64_C(  437995297181226247),  INT64_C( 7636796513212940286) } },
+    { UINT8_C(122),
+      { -INT64_C( 4920634854520309204),  INT64_C(        274928238656),  INT64_C( 1152922196096651272), -INT64_C( 3828636043375117350) },
+      { -INT64_C( 1333263164612698690), -INT64_C( 2323857545195815938), -INT64_C( 2108321048646903987),  INT64_C(   72339069687840994) },
+      {  INT64_C(   11261335608230912),  INT64_C(                 118),  INT64_C(                  14),  INT64_C( 9038164960487679325) },
+      {  INT64_C(                   0), -INT64_C(     140771983362048),  INT64_C(                   0),  INT64_C( 4684314354947956333) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_shrdv_epi64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t c[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C( 12288),       INT16_MIN, -INT16_C(   129), -INT16_C(  2586), -INT16_C( 11812), -INT16_C( 16819), -INT16_C( 20686),  INT16_C(  1176),
+        -INT16_C( 16387), -INT16_C( 19552), -INT16_C(     5),  INT16_C(  2112),  INT16_C(   144), -INT16_C( 16166), -INT16_C(    73),  INT16_C(  7047),
+        -INT16_C( 32037),  INT16_C( 28285),  INT16_C( 16384), -INT16_C(  7417), -INT16_C(  8227), -INT16_C( 31751),  INT16_C( 13849), -INT16_C(  1281),
+         INT16_C(  5122),  INT16_C(   576),       INT16_MAX,  INT16_C( 28928), -INT16_C(  2504),  INT16_C( 12942), -INT16_C(   257),  INT16_C( 13481) },
+      {  INT16_C( 17193),  INT16_C( 30692),  INT16_C(  1040), -INT16_C( 31673), -INT16_C(     9),  INT16_C(     2),  INT16_C( 16553),  INT16_C(  7593),
+        -INT16_C( 17136), -INT16_C(  5235), -INT16_C( 26499), -INT16_C(  2057),  INT16_C( 24011), -INT16_C(  2194),  INT16_C(  5186),  INT16_C( 19523),
+         INT16_C(  4096), -INT16_C( 16601),  INT16_C(     4), -INT16_C(     9), -INT16_C(     9),  INT16_C( 12570),  INT16_C( 29331),  INT16_C(  2269),
+        -INT16_C(  1089), -INT16_C(   777),  INT16_C(     0), -INT16_C(     1),  INT16_C(  5144), -INT16_C( 16642),  INT16_C(  3396),  INT16_C( 26021) },
+      { -INT16_C(    12), -INT16_C( 16556), -INT16_C(  4242),  INT16_C( 16384),  INT16_C(     0),  INT16_C(     7),  INT16_C(    17),  INT16_C(    17),
+         INT16_C(    20),  INT16_C( 22422),  INT16_C(   517),  INT16_C(  4096),  INT16_C(     3),  INT16_C(    13),  INT16_C( 15536),  INT16_C(    27),
+         INT16_C(     7), -INT16_C(   578), -INT16_C(  3165), -INT16_C(   529),  INT16_C( 27283),  INT16_C(    21),  INT16_C(    12),  INT16_C(    25),
+        -INT16_C( 21983),  INT16_C( 11533), -INT16_C(   513),  INT16_C(    10),  INT16_C(    15),  INT16_C( 20153), -INT16_C(  3015), -INT16_C( 19770) },
+      { -INT16_C( 27904),  INT16_C( 18432),  INT16_C(  4163), -INT16_C(  2586), -INT16_C( 11812),  INT16_C(  1404), -INT16_C( 10343), -INT16_C( 32180),
+         INT16_C(  3071),  INT16_C( 14030), -INT16_C(  4097),  INT16_C(  2112),  INT16_C( 24594), -INT16_C( 17546), -INT16_C(    73), -INT16_C( 30621),
+         INT16_C(   261), -INT16_C(   867), -INT16_C( 30720), -INT16_C(    17), -INT16_C(  1029), -INT16_C( 11233),  INT16_C( 10547),  INT16_C( 28413),
+        -INT16_C( 30207), -INT16_C(  6216),  INT16_C(     0), -INT16_C(    36),  INT16_C( 10289),  INT16_C( 32537), -INT16_C( 23937), -INT16_C( 27438) } },
+    { { -INT16_C(  2337),  INT16_C(   520), -INT16_C( 28788),  INT16_C( 14057), -INT16_C(  4737), -INT16_C(  7976), -INT16_C( 15953),  INT16_C(    64),
+         INT16_C( 14843), -INT16_C( 12719), -INT16_C(   129), -INT16_C(  8256), -INT16_C( 23254),  INT16_C(  5120),  INT16_C( 17372),  INT16_C( 16460),
+        -INT16_C( 10312), -INT16_C(    14),  INT16_C( 29640),  INT16_C( 14029),  INT16_C( 11520), -INT16_C( 24576), -INT16_C(   396),  INT16_C( 30837),
+         INT16_C(  1024), -INT16_C( 13263), -INT16_C( 30060),  INT16_C(     0),  INT16_C(    16),  INT16_C( 13316), -INT16_C( 17921),  INT16_C(     0) },
+      {  INT16_C( 32639), -INT16_C( 32247),  INT16_C(    68), -INT16_C( 17240),  INT16_C( 16736), -INT16_C( 22448),  INT16_C(  2048),  INT16_C(    72),
+        -INT16_C(   335), -INT16_C(     2),  INT16_C( 28667), -INT16_C( 32758),  INT16_C( 29552),  INT16_C(     2),  INT16_C( 14333), -INT16_C( 25633),
+         INT16_C( 27172), -INT16_C(  2305), -INT16_C(   899),  INT16_C(     0), -INT16_C(  4097), -INT16_C(    65),  INT16_C(     0), -INT16_C(     1),
+        -INT16_C(  9217), -INT16_C(  8733), -INT16_C( 24070), -INT16_C( 24559), -INT16_C( 18441), -INT16_C( 30706),  INT16_C( 12729), -INT16_C(    97) },
+      { -INT16_C(     3),  INT16_C(    33), -INT16_C(   108),  INT16_C(    32),  INT16_C(    18),  INT16_C(  6613),  INT16_C(  1024),  INT16_C( 21370),
+        -INT16_C( 15005),  INT16_C(    16),  INT16_C(    16),  INT16_C(   528),       INT16_MAX,  INT16_C(    24),  INT16_C(    66),  INT16_C( 12549),
+        -INT16_C(     1),  INT16_C(    25),  INT16_C(    28), -INT16_C( 29747),  INT16_C(     5),  INT16_C(    30),  INT16_C(     8),  INT16_C( 16385),
+         INT16_C(    31),  INT16_C( 29298),  INT16_C(    67),  INT16_C(    23),  INT16_C(    25),  INT16_C(  1922), -INT16_C(  7216),  INT16_C(    20) },
+      { -INT16_C(  1025), -INT16_C( 32508),  INT16_C( 18680),  INT16_C( 14057),  INT16_C( 15199), -INT16_C( 30970), -INT16_C( 15953),  INT16_C(  4608),
+         INT16_C( 10047), -INT16_C( 12719), -INT16_C(   129), -INT16_C(  8256), -INT16_C(  6431),  INT16_C(   532),  INT16_C( 20727), -INT16_C(  1534),
+        -INT16_C( 11191),       INT16_MAX, -INT16_C( 14377),  INT16_C(     1), -INT16_C(  1688), -INT16_C(   258),  INT16_C(   254), -INT16_C( 17350),
+        -INT16_C( 18434), -INT16_C(  3316),  INT16_C( 20818),  INT16_C(  8704), -INT16_C(  1152), -INT16_C( 29439), -INT16_C( 17921), -INT16_C(  4096) } },
+    { { -INT16_C(   653), -INT16_C(  9675),  INT16_C( 32758), -INT16_C( 16524), -INT16_C(    65), -INT16_C(   337),  INT16_C(     0), -INT16_C( 18964),
+         INT16_C( 16918), -INT16_C( 18945),  INT16_C(  8192),  INT16_C( 32270),  INT16_C(  7730), -INT16_C( 16449), -INT16_C(  8709), -INT16_C(  5309),
+         INT16_C(    96),  INT16_C( 18586),  INT16_C( 20018), -INT16_C(  8035), -INT16_C(  8289), -INT16_C( 26328), -INT16_C(    17), -INT16_C(  8353),
+        -INT16_C( 26636),  INT16_C(  2176),  INT16_C(   320), -INT16_C( 32760),  INT16_C( 10857), -INT16_C(  6157),  INT16_C( 15603), -INT16_C( 27193) },
+      { -INT16_C( 23189),  INT16_C( 12320), -INT16_C(     1), -INT16_C( 31198),  INT16_C( 22390), -INT16_C( 21253), -INT16_C(  2053),  INT16_C( 17353),
+        -INT16_C( 29937),  INT16_C(  2048),  INT16_C(  2177),  INT16_C( 11403),  INT16_C(    16), -INT16_C( 12511),  INT16_C(    16),  INT16_C( 31190),
+        -INT16_C(  4609),  INT16_C( 16513),  INT16_C(  2050),  INT16_C( 24791),  INT16_C(  8704), -INT16_C( 32688),  INT16_C( 19477), -INT16_C( 10184),
+         INT16_C(  1029),  INT16_C( 23982),  INT16_C( 24891), -INT16_C(  4098), -INT16_C( 18296), -INT16_C(     1), -INT16_C(  9971),  INT16_C(  8349) },
+      {  INT16_C(  8464),  INT16_C( 23190), -INT16_C(   120),  INT16_C( 31579),  INT16_C(    27),  INT16_C( 18468),  INT16_C( 10118), -INT16_C(   321),
+        -INT16_C( 27858),  INT16_C(     0),  INT16_C(    31), -INT16_C(    33),  INT16_C(    30),  INT16_C(    16), -INT16_C( 10497),  INT16_C(    32),
+         INT16_C(     8), -INT16_C( 16385),  INT16_C(    21),  INT16_C(     4),  INT16_C(    19),  INT16_C( 19123),  INT16_C(    10), -INT16_C(  7435),
+         INT16_C(  4160), -INT16_C(  2057),  INT16_C(  5795),  INT16_C(     1), -INT16_C( 18890),  INT16_C(    18),  INT16_C(    72),  INT16_C(     5) },
+      { -INT16_C(   653), -INT16_C( 31896), -INT16_C(   129), -INT16_C( 15273), -INT16_C(  4385), -INT16_C( 16406), -INT16_C(  5120), -INT16_C( 30829),
+         INT16_C( 11325), -INT16_C( 18945),  INT16_C(  4354),  INT16_C( 22806),  INT16_C(    64), -INT16_C( 16449),  INT16_C(    33), -INT16_C(  5309),
+        -INT16_C(   256), -INT16_C( 32510),  INT16_C(  4721),  INT16_C( 32265),  INT16_C(  7155),  INT16_C(  4901),  INT16_C(  1407), -INT16_C( 14598),
+        -INT16_C( 26636),  INT16_C( 23569),  INT16_C( 24616),  INT16_C( 16388),  INT16_C(  8361), -INT16_C(  1540),  INT16_C(  3388), -INT16_C(  4946) } },
+    { {  INT16_C(     2), -INT16_C(  2131),  INT16_C( 17484), -INT16_C( 25986),  INT16_C(     0), -INT16_C( 14743), -INT16_C(  8267), -INT16_C(   649),
+         INT16_C(  2077), -INT16_C(     3), -INT16_C(   257),  INT16_C( 29182),  INT16_C(  7709), -INT16_C(  1934),  INT16_C( 16836), -INT16_C(   137),
+         INT16_C( 20902),  INT16_C( 27333), -INT16_C(  8266), -INT16_C( 12682), -INT16_C( 25460),  INT16_C( 21446), -INT16_C(   129), -INT16_C(  2057),
+         INT16_C(   512), -INT16_C(  5635), -INT16_C(  3191),  INT16_C(   522), -INT16_C(  2688),  INT16_C(     0),  INT16_C(    64), -INT16_C(  8325) },
+      { -INT16_C( 15090),  INT16_C(  2208), -INT16_C(    14), -INT16_C(  1959), -INT16_C( 24028), -INT16_C( 16385),  INT16_C(  4070),  INT16_C( 16416),
+        -INT16_C( 21953),  INT16_C(    16),  INT16_C(   384),  INT16_C(  2260),  INT16_C( 29436),  INT16_C(  4323),  INT16_C(     0),  INT16_C(    34),
+         INT16_C( 12503),  INT16_C(  1026),  INT16_C( 14389), -INT16_C( 20126), -INT16_C(     3),       INT16_MAX,  INT16_C(  1024),  INT16_C( 29837),
+        -INT16_C(   129),  INT16_C( 25827), -INT16_C( 16961),  INT16_C(  4160), -INT16_C( 22255), -INT16_C( 20353),  INT16_C(     0), -INT16_C(     1) },
+      {  INT16_C( 13178),  INT16_C(     6),       INT16_MIN, -INT16_C(   641),  INT16_C(    10), -INT16_C( 29036), -INT16_C(  4115),  INT16_C(    12),
+         INT16_C(    18),  INT16_C(    31),  INT16_C(     5),  INT16_C(    27),  INT16_C( 21695),  INT16_C(     6), -INT16_C( 20024), -INT16_C(   257),
+         INT16_C(    88),  INT16_C(  1024), -INT16_C(   129),  INT16_C(    20),  INT16_C(  8196),  INT16_C(  3537), -INT16_C(  8709), -INT16_C(     9),
+         INT16_C(    19),  INT16_C( 31823), -INT16_C(  4105),  INT16_C(    27),  INT16_C(    28),  INT16_C(    18),  INT16_C(  4352), -INT16_C(    65) },
+      {  INT16_C( 17280), -INT16_C( 31778),  INT16_C( 17484), -INT16_C(  3917), -INT16_C( 30464), -INT16_C(   922),  INT16_C( 32566),  INT16_C(   527),
+        -INT16_C( 15865),  INT16_C(    33),  INT16_C(  2039),  INT16_C(  6798), -INT16_C(  6664), -INT16_C( 28703),  INT16_C(    65),  INT16_C(    69),
+        -INT16_C( 10415),  INT16_C( 27333),  INT16_C( 28779),  INT16_C( 11495), -INT16_C(  9784), -INT16_C( 22045), -INT16_C( 32737),  INT16_C(  7151),
+        -INT16_C(  8128), -INT16_C( 13881),  INT16_C( 32743),  INT16_C(  2048), -INT16_C( 28385), -INT16_C( 16384),  INT16_C(    64), -INT16_C(     1) } },
+    { { -INT16_C( 24315),  INT16_C( 16659), -INT16_C(  5139), -INT16_C(     5), -INT16_C( 24666),  INT16_C(     4), -INT16_C( 30393), -INT16_C(  9373),
+         INT16_C( 27067), -INT16_C( 29856),  INT16_C(  4096), -INT16_C( 26133),  INT16_C(  8704), -INT16_C( 21811),  INT16_C( 18572),  INT16_C(  6077),
+        -INT16_C( 24062), -INT16_C( 15731), -INT16_C(    57),  INT16_C(  9005), -INT16_C( 28406),  INT16_C(  9011), -INT16_C( 30215),  INT16_C( 15546),
+        -INT16_C( 14399),  INT16_C(  7262),  INT16_C(     0),  INT16_C( 18726),  INT16_C( 30977),  INT16_C( 14720), -INT16_C(  8705), -INT16_C( 21223) },
+      {  INT16_C( 26987),  INT16_C(  8380),  INT16_C( 12292), -INT16_C(  5189), -INT16_C(  1848), -INT16_C(  8241),  INT16_C(  8420), -INT16_C(     1),
+         INT16_C(     0),  INT16_C(     2), -INT16_C( 19268), -INT16_C( 31108),  INT16_C(  4198),  INT16_C( 14994),  INT16_C(     6),  INT16_C( 20508),
+        -INT16_C(     1),  INT16_C( 32586),  INT16_C( 23721), -INT16_C(  1025), -INT16_C(  1553), -INT16_C(   966), -INT16_C( 26500),  INT16_C(  6720),
+         INT16_C( 31816), -INT16_C( 16386), -INT16_C(     1), -INT16_C( 20537), -INT16_C( 32716),  INT16_C( 12287), -INT16_C(   514), -INT16_C( 27878) },
+      {  INT16_C(     1),  INT16_C(    30),  INT16_C(    30),  INT16_C(     4),  INT16_C(    21),  INT16_C(  6144),  INT16_C( 23344),  INT16_C( 29699),
+         INT16_C( 20143),  INT16_C(     3), -INT16_C(  5157),  INT16_C( 23316), -INT16_C(  8713),  INT16_C( 21960),  INT16_C(   592),  INT16_C(     0),
+         INT16_C(     1),  INT16_C( 16452), -INT16_C(     1),  INT16_C(    16),  INT16_C(     6),  INT16_C(     7),  INT16_C(    25),  INT16_C(     4),
+         INT16_C(    16),  INT16_C(  4459),  INT16_C(     0),  INT16_C(    20), -INT16_C(   133),  INT16_C(    33),  INT16_C(    13),  INT16_C(    12) },
+      { -INT16_C( 12158), -INT16_C( 32015), -INT16_C( 16365), -INT16_C( 16385),  INT16_C( 17661),  INT16_C(     4), -INT16_C( 30393), -INT16_C(  1172),
+         INT16_C(     0),  INT16_C( 20844), -INT16_C( 26750), -INT16_C( 13922), -INT16_C( 13244), -INT16_C( 27990),  INT16_C( 18572),  INT16_C(  6077),
+        -INT16_C( 12031), -INT16_C( 21464), -INT16_C( 18093),  INT16_C(  9005), -INT16_C( 16828),  INT16_C( 29766),  INT16_C( 15940),  INT16_C(   971),
+        -INT16_C( 14399), -INT16_C(    61),  INT16_C(     0),  INT16_C( 29842),  INT16_C(  1679), -INT16_C( 25408), -INT16_C(  4106),  INT16_C( 12714) } },
+    { { -INT16_C(     1), -INT16_C(  1097), -INT16_C(  4456), -INT16_C( 24585),  INT16_C( 27032),  INT16_C( 15625), -INT16_C(     1),  INT16_C( 10239),
+         INT16_C( 11985), -INT16_C( 27755),  INT16_C(    64), -INT16_C( 12857),  INT16_C(  3927), -INT16_C(  2049),  INT16_C( 14724), -INT16_C( 18618),
+         INT16_C(  5120), -INT16_C( 24102),  INT16_C( 15900), -INT16_C( 28608), -INT16_C(  4097),  INT16_C( 30655),  INT16_C(   841), -INT16_C( 28860),
+        -INT16_C( 24211), -INT16_C( 25841),  INT16_C(   512), -INT16_C(   129),  INT16_C( 28671), -INT16_C( 15207),  INT16_C(    17),  INT16_C(  1983) },
+      { -INT16_C(  8321), -INT16_C( 17768),  INT16_C(  4868),  INT16_C( 17216), -INT16_C( 16521),  INT16_C( 16922), -INT16_C( 31677),  INT16_C( 27077),
+        -INT16_C(   273),  INT16_C( 18271),  INT16_C( 30719),  INT16_C(  8194),  INT16_C(    64), -INT16_C(  2113),  INT16_C( 10718), -INT16_C( 12669),
+        -INT16_C( 16901),  INT16_C(  1284), -INT16_C( 30091),  INT16_C(  4096), -INT16_C(   563), -INT16_C(  1389),  INT16_C( 10720), -INT16_C( 11108),
+        -INT16_C(  4105),       INT16_MIN,  INT16_C(  7681),  INT16_C( 22527),  INT16_C(  6820), -INT16_C(     1),  INT16_C( 17849), -INT16_C(  4097) },
+      {  INT16_C(     4),  INT16_C(     7), -INT16_C(     1),  INT16_C(  8194),  INT16_C( 19715), -INT16_C( 19005),  INT16_C(    25),  INT16_C( 19471),
+        -INT16_C(  6215),  INT16_C( 19884), -INT16_C( 15679), -INT16_C( 16385),  INT16_C(  1536),  INT16_C(     6), -INT16_C(     1), -INT16_C( 11868),
+         INT16_C(    11), -INT16_C( 20514), -INT16_C( 29696),  INT16_C(    33),  INT16_C(    33),  INT16_C(     4),  INT16_C(     4),  INT16_C( 30245),
+         INT16_C(     9),  INT16_C(    12),  INT16_C(     2),  INT16_C( 16384),  INT16_C(    10),  INT16_C(    26),  INT16_C(    30), -INT16_C( 29255) },
+      { -INT16_C(     1),  INT16_C( 12791),  INT16_C(  9737),  INT16_C( 10237), -INT16_C(  4813),  INT16_C( 18337),  INT16_C(  8703), -INT16_C( 11382),
+         INT16_C( 30615),  INT16_C( 30201), -INT16_C( 32736),  INT16_C( 16389),  INT16_C(  3927), -INT16_C(    33),  INT16_C( 21436),  INT16_C( 15220),
+        -INT16_C( 16542),  INT16_C(  5138),  INT16_C( 15900),  INT16_C( 18464), -INT16_C(  2049),  INT16_C( 14203),  INT16_C(    52), -INT16_C(  7046),
+        -INT16_C(  1072),  INT16_C(     9),  INT16_C( 16512), -INT16_C(   129), -INT16_C( 22245), -INT16_C(    15),  INT16_C(  5860), -INT16_C(   125) } },
+    { { -INT16_C(  8195),  INT16_C( 31227),  INT16_C( 15926),  INT16_C( 11441),  INT16_C( 18029), -INT16_C( 29294),  INT16_C(  1208),  INT16_C(  1024),
+         INT16_C(    64),  INT16_C( 19100), -INT16_C( 28672),  INT16_C( 20121), -INT16_C(  4523), -INT16_C(  2049), -INT16_C(     1), -INT16_C( 30432),
+        -INT16_C( 11022), -INT16_C(     1),  INT16_C( 20517), -INT16_C( 21979), -INT16_C( 11350),  INT16_C( 16386), -INT16_C(   193),  INT16_C(  3104),
+         INT16_C(  8224),  INT16_C(    97),  INT16_C( 28178), -INT16_C(     1),  INT16_C( 27940),  INT16_C(  2848),  INT16_C( 18560), -INT16_C( 14737) },
+      { -INT16_C(     1), -INT16_C( 29778), -INT16_C(  7744),  INT16_C( 29312),  INT16_C(    92), -INT16_C(  3583), -INT16_C(     1), -INT16_C( 13211),
+         INT16_C(     0), -INT16_C( 16972), -INT16_C( 22243), -INT16_C(   257),  INT16_C(  2048), -INT16_C(  6951), -INT16_C(  1041), -INT16_C(   202),
+         INT16_C( 31215),  INT16_C(  2112), -INT16_C(    65),  INT16_C( 10255), -INT16_C(     1), -INT16_C(     2), -INT16_C( 18367), -INT16_C(  1029),
+        -INT16_C( 12229), -INT16_C( 16097), -INT16_C(  8201),  INT16_C(     0), -INT16_C(    37),  INT16_C(   513), -INT16_C( 32610),  INT16_C(     0) },
+      {  INT16_C(    33),  INT16_C(    30), -INT16_C(     1), -INT16_C(     1),  INT16_C(     9),  INT16_C(    20),  INT16_C(    14),  INT16_C( 28748),
+         INT16_C( 10709),  INT16_C(    21),  INT16_C(    26),  INT16_C(    33),  INT16_C( 26603),  INT16_C( 14316),  INT16_C( 27053),  INT16_C(    25),
+         INT16_C(    25),  INT16_C(     7),  INT16_C(    30),  INT16_C(    11),  INT16_C(    23),  INT16_C(    21),  INT16_C(     6),  INT16_C(    23),
+         INT16_C(    15), -INT16_C( 29512), -INT16_C(  4609),  INT16_C(    17),  INT16_C(    23),  INT16_C(    15),  INT16_C(    16),  INT16_C( 17972) },
+      { -INT16_C(  4098),  INT16_C( 11961), -INT16_C( 15488), -INT16_C(  6912),  INT16_C( 11811),  INT16_C(  6361), -INT16_C(     4), -INT16_C( 14768),
+         INT16_C(     2), -INT16_C( 23980),  INT16_C( 18276), -INT16_C( 22708),  INT16_C(    29),  INT16_C( 19871), -INT16_C(  8321), -INT16_C( 25788),
+        -INT16_C(  2070), -INT16_C( 32257), -INT16_C(   259),  INT16_C(   501), -INT16_C(    89), -INT16_C(  3584),  INT16_C(  2044), -INT16_C(  2536),
+        -INT16_C( 24458),  INT16_C(  7936), -INT16_C( 16402),       INT16_MAX, -INT16_C( 18726),  INT16_C(  1026),  INT16_C( 18560),  INT16_C(  3174) } },
+    { {  INT16_C( 16384),  INT16_C( 10529), -INT16_C( 28366), -INT16_C( 22951), -INT16_C(    33),  INT16_C( 21000), -INT16_C( 14158),  INT16_C( 24700),
+        -INT16_C( 11813),  INT16_C( 15123), -INT16_C(     1),  INT16_C( 13383), -INT16_C(  3540), -INT16_C(  6145), -INT16_C( 19781), -INT16_C(     1),
+         INT16_C(  4096), -INT16_C(  2177),  INT16_C(     0), -INT16_C(   265),  INT16_C(    16),  INT16_C(  8224), -INT16_C(  5121),  INT16_C( 18337),
+        -INT16_C( 13290),  INT16_C(   265),  INT16_C(  2560), -INT16_C(  1089), -INT16_C( 25819),  INT16_C( 10240),  INT16_C(  5173),  INT16_C(  3072) },
+      {  INT16_C(  3671), -INT16_C(  6395), -INT16_C( 20576),  INT16_C(   544), -INT16_C(    53), -INT16_C( 13642), -INT16_C(  8259),  INT16_C( 29859),
+        -INT16_C(  1025), -INT16_C(     2),  INT16_C(    66), -INT16_C( 16449),  INT16_C( 30463), -INT16_C( 22284), -INT16_C(     1),  INT16_C(  5550),
+        -INT16_C( 16545), -INT16_C( 17921),  INT16_C( 13260),  INT16_C( 10752), -INT16_C( 14662), -INT16_C(  4085),  INT16_C(    33),  INT16_C(  9007),
+         INT16_C(  3823), -INT16_C(  4582),  INT16_C(   209),  INT16_C(  1024), -INT16_C(  5982), -INT16_C( 21150), -INT16_C(    33),  INT16_C(   256) },
+      {  INT16_C(     7), -INT16_C( 14777), -INT16_C(     1),  INT16_C(    22),  INT16_C(    10),  INT16_C(     4),  INT16_C(    31), -INT16_C( 30861),
+        -INT16_C( 17539),  INT16_C(    27),  INT16_C(     7),  INT16_C(    16),  INT16_C(    10),  INT16_C(     4),  INT16_C(    25),  INT16_C( 24738),
+        -INT16_C( 14748),  INT16_C(  4096),  INT16_C(     0),  INT16_C(     8), -INT16_C( 21165),  INT16_C(  5933), -INT16_C( 29356),  INT16_C(    31),
+         INT16_C(     7),  INT16_C(  1764), -INT16_C(  1154),  INT16_C(    27), -INT16_C(     1),  INT16_C( 31972),  INT16_C(     4), -INT16_C( 16504) },
+      { -INT16_C( 20864),  INT16_C(  2642),  INT16_C( 24385), -INT16_C( 32103), -INT16_C(  3329),  INT16_C( 25888), -INT16_C( 16517),  INT16_C( 27663),
+        -INT16_C(  8194), -INT16_C(    57), -INT16_C( 31233),  INT16_C( 13383), -INT16_C( 16388),  INT16_C( 20095), -INT16_C(    39), -INT16_C( 16385),
+        -INT16_C(  3840), -INT16_C(  2177),  INT16_C(     0),  INT16_C(   254),  INT16_C( 16386), -INT16_C( 32679),  INT16_C(  7871),  INT16_C( 18014),
+        -INT16_C(  8296), -INT16_C( 24560),  INT16_C(   836), -INT16_C( 32737), -INT16_C( 11963),  INT16_C(  8832), -INT16_C(  3773),  INT16_C(    12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi16(test_vec[i].c);
+    simde__m512i r = simde_mm512_shrdv_epi16(a, b, c);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const simde__mmask32 k;
+    const int16_t b[32];
+    const int16_t c[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C(     5), -INT16_C( 20994),  INT16_C(   518),  INT16_C(   128), -INT16_C(     3),  INT16_C( 17316),  INT16_C( 15758),  INT16_C(   514),
+         INT16_C( 23900),  INT16_C( 24576),  INT16_C(  4097),       INT16_MIN, -INT16_C(     1), -INT16_C( 24585),  INT16_C( 31735),  INT16_C( 22114),
+         INT16_C( 32762), -INT16_C(  5441), -INT16_C( 31519), -INT16_C(  8769), -INT16_C( 12530), -INT16_C(     5), -INT16_C( 26618), -INT16_C( 19877),
+        -INT16_C( 13806),  INT16_C( 19946), -INT16_C( 22549),  INT16_C(  4544),  INT16_C(    18), -INT16_C( 22492), -INT16_C(     1),  INT16_C( 18836) },
+      UINT32_C( 113008546),
+      { -INT16_C(     1),  INT16_C( 25703), -INT16_C( 10756),  INT16_C(  6794), -INT16_C(  5935),  INT16_C(  3149),  INT16_C( 16387),  INT16_C( 32610),
+         INT16_C( 32511),  INT16_C( 14110), -INT16_C(  3063),  INT16_C(     6),  INT16_C(   512),  INT16_C( 29526),  INT16_C( 14810),  INT16_C( 23529),
+         INT16_C( 30255),  INT16_C( 18782), -INT16_C( 24114),  INT16_C( 24923),  INT16_C(     0),  INT16_C(   321),  INT16_C(  8208), -INT16_C( 12884),
+         INT16_C(  8192), -INT16_C(   593),  INT16_C(  6482), -INT16_C(  4101), -INT16_C(   785),  INT16_C( 24342),  INT16_C(  7185), -INT16_C(  5377) },
+      {  INT16_C(    33),  INT16_C(    16),  INT16_C( 16871), -INT16_C( 25182),  INT16_C(    27),  INT16_C(    16), -INT16_C(  2054),  INT16_C(    25),
+         INT16_C(    16),  INT16_C(     7),  INT16_C(    10), -INT16_C(    65),  INT16_C( 26079),  INT16_C(    30), -INT16_C( 25256),  INT16_C( 31711),
+         INT16_C(     7),  INT16_C( 11556),  INT16_C(     1), -INT16_C(     9),  INT16_C(     0),  INT16_C( 14281),  INT16_C(    33),  INT16_C( 32766),
+         INT16_C(    18),  INT16_C(    32),  INT16_C(  1668),  INT16_C(     3),  INT16_C(     8), -INT16_C(  3529), -INT16_C( 24575), -INT16_C(  2049) },
+      { -INT16_C(     5), -INT16_C( 20994),  INT16_C(   518),  INT16_C(   128), -INT16_C(     3),  INT16_C( 17316),  INT16_C( 15758), -INT16_C( 20223),
+         INT16_C( 23900),  INT16_C( 15552),  INT16_C(   580),  INT16_C(    13),  INT16_C(  1025), -INT16_C( 24585), -INT16_C(  9605),  INT16_C( 22114),
+         INT16_C( 32762), -INT16_C(  5441),  INT16_C( 17008), -INT16_C( 18501), -INT16_C( 12530), -INT16_C( 24321), -INT16_C( 26618),  INT16_C( 14002),
+        -INT16_C( 13806),  INT16_C( 19946),  INT16_C( 10878),  INT16_C(  4544),  INT16_C(    18), -INT16_C( 22492), -INT16_C(     1),  INT16_C( 18836) } },
+    { { -INT16_C(  5361),  INT16_C( 19689),  INT16_C( 26709), -INT16_C( 13486), -INT16_C(  4097), -INT16_C( 32766), -INT16_C( 18661), -INT16_C(  8387),
+         INT16_C( 16637),  INT16_C(   256), -INT16_C( 29151), -INT16_C( 14280), -INT16_C( 27599),  INT16_C( 23817), -INT16_C( 10709), -INT16_C( 31852),
+        -INT16_C( 12338), -INT16_C(  1025),  INT16_C( 29314),  INT16_C( 32063),  INT16_C( 22566),  INT16_C(  8678),  INT16_C( 22896),  INT16_C( 25281),
+        -INT16_C(  2098),  INT16_C( 20990),  INT16_C(  8448), -INT16_C( 13301),  INT16_C( 17892), -INT16_C( 32643), -INT16_C( 14527),  INT16_C( 15649) },
+      UINT32_C(3371749445),
+      {  INT16_C( 31995), -INT16_C( 18441),  INT16_C(   648),  INT16_C(   148), -INT16_C( 23589),  INT16_C(   256), -INT16_C(  2167), -INT16_C(   261),
+        -INT16_C( 11168), -INT16_C( 30720), -INT16_C(  8827), -INT16_C( 25735), -INT16_C(    35),  INT16_C( 20925), -INT16_C(  3149), -INT16_C( 31232),
+        -INT16_C( 10469), -INT16_C(    18), -INT16_C( 30140),  INT16_C( 12652), -INT16_C( 23808),  INT16_C(    16),  INT16_C(  4176),  INT16_C( 29637),
+        -INT16_C( 21645),  INT16_C(    64), -INT16_C( 21929),  INT16_C(   528), -INT16_C(  1470),  INT16_C( 17007),  INT16_C(   512), -INT16_C( 28915) },
+      {  INT16_C(    23), -INT16_C( 13124), -INT16_C( 12766),  INT16_C(     7),  INT16_C(     2), -INT16_C(    10),  INT16_C(    33),  INT16_C(     1),
+         INT16_C( 15347),  INT16_C(     0), -INT16_C( 28587), -INT16_C(     9), -INT16_C( 24577),  INT16_C(    10),  INT16_C( 17110),  INT16_C(    27),
+        -INT16_C(   257), -INT16_C( 19300),  INT16_C(    12), -INT16_C( 10783),  INT16_C(    16),  INT16_C(    24),  INT16_C(    28),  INT16_C(     1),
+         INT16_C(    16),  INT16_C(     0),  INT16_C(    29),  INT16_C(    29),  INT16_C(  1274),  INT16_C(    30), -INT16_C( 28698),  INT16_C(    15) },
+      { -INT16_C(  2090),  INT16_C( 19689),  INT16_C(  6677), -INT16_C( 13486), -INT16_C(  4097), -INT16_C( 32766), -INT16_C(  9331), -INT16_C(  8387),
+         INT16_C( 16637),  INT16_C(   256), -INT16_C( 29151), -INT16_C( 14280), -INT16_C(    69),  INT16_C( 23817), -INT16_C( 12456), -INT16_C( 16368),
+        -INT16_C( 12338), -INT16_C(  1025),  INT16_C( 29314),  INT16_C( 16031),  INT16_C( 22566),  INT16_C(  4129),  INT16_C(  1285), -INT16_C( 20128),
+        -INT16_C(  2098),  INT16_C( 20990),  INT16_C(  8448),  INT16_C(  4230),  INT16_C( 17892), -INT16_C( 32643),  INT16_C(   797),  INT16_C(  7706) } },
+    { { -INT16_C(  1793), -INT16_C( 20967), -INT16_C( 10568), -INT16_C(   225),  INT16_C( 24495), -INT16_C( 16383), -INT16_C(  2049), -INT16_C( 12503),
+        -INT16_C(   514),  INT16_C( 28671),  INT16_C(  2048), -INT16_C(     1), -INT16_C( 29346), -INT16_C( 12545), -INT16_C(     1),  INT16_C(   416),
+        -INT16_C(  9855), -INT16_C( 24576), -INT16_C(     5), -INT16_C(  8193),  INT16_C( 10797), -INT16_C( 30925),  INT16_C(   521),  INT16_C(  8712),
+         INT16_C(  8163),  INT16_C(  3088), -INT16_C( 11663), -INT16_C(    34), -INT16_C(  9558),  INT16_C( 15290),  INT16_C( 32673), -INT16_C(     5) },
+      UINT32_C(2189539090),
+      { -INT16_C( 31965),  INT16_C(   516), -INT16_C( 13986), -INT16_C( 16318), -INT16_C(     1),  INT16_C( 27015), -INT16_C(     1),  INT16_C( 25450),
+         INT16_C( 22342),  INT16_C(  4479), -INT16_C( 18177), -INT16_C( 31559),  INT16_C(  2321), -INT16_C(  4097), -INT16_C( 16675), -INT16_C(  3346),
+        -INT16_C(    37),  INT16_C(   128), -INT16_C( 18216), -INT16_C(  8973),  INT16_C(     0),  INT16_C(  1028),  INT16_C(  2068), -INT16_C(  2149),
+        -INT16_C(  3316),  INT16_C( 31989),  INT16_C( 28739), -INT16_C(   259),  INT16_C(  5725),       INT16_MIN,  INT16_C(  8736),  INT16_C( 30522) },
+      {  INT16_C(  2336), -INT16_C(  4187),  INT16_C(    23),  INT16_C(     5),  INT16_C(    23),  INT16_C(    31),  INT16_C( 19111), -INT16_C(  7773),
+         INT16_C(    20), -INT16_C(  8210),  INT16_C( 31022),  INT16_C(    20),  INT16_C(    21),  INT16_C(    24),  INT16_C( 11740),  INT16_C(    22),
+         INT16_C(     6),  INT16_C(     4),  INT16_C(     2),  INT16_C(    30),  INT16_C(    18),  INT16_C(     3), -INT16_C( 16387), -INT16_C( 18345),
+         INT16_C(    15), -INT16_C(  1529), -INT16_C( 25102),  INT16_C(    32),  INT16_C(    15), -INT16_C(  7600), -INT16_C( 25460),  INT16_C(     3) },
+      { -INT16_C(  1793),  INT16_C(  9584), -INT16_C( 10568), -INT16_C(   225), -INT16_C(   321), -INT16_C( 16383), -INT16_C(  2049), -INT16_C( 12503),
+         INT16_C( 28639),  INT16_C( 17917), -INT16_C(  7172), -INT16_C(     1), -INT16_C( 29590), -INT16_C(    50), -INT16_C(     1), -INT16_C( 18426),
+         INT16_C( 28518), -INT16_C( 24576), -INT16_C(     5), -INT16_C(  8193),  INT16_C( 10797), -INT16_C( 30925),  INT16_C(   521),  INT16_C( 13892),
+         INT16_C(  8163), -INT16_C(  5608), -INT16_C( 11663), -INT16_C(    34), -INT16_C(  9558),  INT16_C( 15290),  INT16_C( 32673),  INT16_C( 24575) } },
+    { {  INT16_C( 28366),  INT16_C( 18667),  INT16_C( 17242), -INT16_C( 22527), -INT16_C( 23410), -INT16_C(    17),  INT16_C( 17015),  INT16_C( 27812),
+         INT16_C(  7095),  INT16_C( 10252),  INT16_C(   128),  INT16_C(  4050),  INT16_C(  3716),  INT16_C( 24968),  INT16_C(   290), -INT16_C( 23767),
+        -INT16_C( 11918), -INT16_C( 20772), -INT16_C(     3),  INT16_C(  6359),  INT16_C(  9472),  INT16_C(     0),  INT16_C( 21798), -INT16_C( 23487),
+        -INT16_C( 13824), -INT16_C( 16449), -INT16_C(  4012), -INT16_C( 28746), -INT16_C( 12289), -INT16_C( 23368),  INT16_C(    40),  INT16_C(  6464) },
+      UINT32_C( 721101406),
+      { -INT16_C( 18091),  INT16_C( 26691),  INT16_C(    32), -INT16_C( 27521), -INT16_C(    39),  INT16_C(  4128), -INT16_C(  9870), -INT16_C( 17322),
+         INT16_C(  2226),  INT16_C(  8768),  INT16_C(     0),  INT16_C( 16312),  INT16_C( 16384), -INT16_C( 19335),  INT16_C( 24810), -INT16_C(     1),
+         INT16_C( 28604),  INT16_C(  2481),  INT16_C(  6470), -INT16_C(  3107), -INT16_C( 24625), -INT16_C(  8817),  INT16_C( 10781),  INT16_C(     0),
+        -INT16_C(  4097),  INT16_C( 20941),  INT16_C(  2049),  INT16_C(  4228), -INT16_C( 26106), -INT16_C(  1281), -INT16_C( 30393),  INT16_C(  9236) },
+      {  INT16_C(    28),  INT16_C(  5833),  INT16_C(     0),  INT16_C(  8196),  INT16_C(    27),  INT16_C(    10),  INT16_C(     2),  INT16_C(     4),
+         INT16_C(     1),  INT16_C( 15604),  INT16_C(  4100),  INT16_C(    15), -INT16_C( 24645),  INT16_C( 16157), -INT16_C( 29750),  INT16_C(    27),
+        -INT16_C( 15120), -INT16_C(  9362),  INT16_C( 27757),  INT16_C(     6), -INT16_C(   145), -INT16_C( 27691), -INT16_C(  2049),  INT16_C(    24),
+         INT16_C(     7),  INT16_C(    29),  INT16_C(  5067),  INT16_C( 18436),  INT16_C(    27),  INT16_C(     9),  INT16_C(     6),  INT16_C(    16) },
+      {  INT16_C( 28366),  INT16_C(  8612),  INT16_C( 17242), -INT16_C(  1408), -INT16_C(  1228), -INT16_C(    17), -INT16_C( 28515),  INT16_C( 27812),
+         INT16_C(  7095),  INT16_C(   640),  INT16_C(   128),  INT16_C(  4050),  INT16_C(  3716), -INT16_C( 23605),  INT16_C(   290), -INT16_C( 23767),
+        -INT16_C( 11918),  INT16_C(  9926), -INT16_C(     3),  INT16_C( 29795),  INT16_C( 16286),  INT16_C( 30720),  INT16_C( 21562),  INT16_C(   164),
+        -INT16_C( 13824), -INT16_C( 29075), -INT16_C(  4012),  INT16_C( 18683), -INT16_C( 12289),  INT16_C( 32722),  INT16_C(    40),  INT16_C(  6464) } },
+    { {  INT16_C( 18440), -INT16_C( 23776),       INT16_MIN, -INT16_C( 32752), -INT16_C(     9),  INT16_C(    64),  INT16_C(  4096),  INT16_C( 18756),
+        -INT16_C( 12941),  INT16_C(  6438),  INT16_C( 25600),  INT16_C(  5124), -INT16_C(    33), -INT16_C( 10465),  INT16_C(  2048),  INT16_C(     0),
+         INT16_C( 32757),  INT16_C(  2048), -INT16_C(  5076), -INT16_C(  4930), -INT16_C(  2906), -INT16_C(  1025), -INT16_C(  4168),  INT16_C( 17679),
+         INT16_C( 18833),  INT16_C( 25421),  INT16_C(   544), -INT16_C( 32440),  INT16_C( 30057),  INT16_C(    32),  INT16_C( 16386), -INT16_C( 18426) },
+      UINT32_C(3579424208),
+      {  INT16_C(  5120), -INT16_C(  5495),  INT16_C(   288), -INT16_C( 18308), -INT16_C( 16384),  INT16_C(  1792), -INT16_C(   417),  INT16_C( 17143),
+         INT16_C( 14770), -INT16_C( 24040), -INT16_C( 13773), -INT16_C(   191),  INT16_C(    16),  INT16_C( 30513), -INT16_C(  1025),  INT16_C(  9472),
+         INT16_C( 21660), -INT16_C(   145), -INT16_C(  1804), -INT16_C( 31936),  INT16_C(     4), -INT16_C(     1), -INT16_C( 32275),  INT16_C(     0),
+         INT16_C(  4733), -INT16_C( 32767), -INT16_C( 17379),  INT16_C(  6347), -INT16_C( 12150),  INT16_C( 13404), -INT16_C( 17441),  INT16_C( 24573) },
+      {  INT16_C(    13),  INT16_C(     5), -INT16_C(  4770),  INT16_C(    10),  INT16_C(  5093), -INT16_C( 18933), -INT16_C(   513),  INT16_C(   576),
+         INT16_C(    12),  INT16_C(  8448),  INT16_C(    29),  INT16_C( 17093),  INT16_C(    16),  INT16_C(     0), -INT16_C( 16694), -INT16_C(  1025),
+        -INT16_C(  6355),  INT16_C( 12675),  INT16_C(  2127),  INT16_C(    64), -INT16_C( 30720),  INT16_C(    27),  INT16_C( 21342),  INT16_C(  8496),
+        -INT16_C( 13552),  INT16_C(    31), -INT16_C(  3927), -INT16_C(     1),  INT16_C(     2), -INT16_C( 14366),  INT16_C(     1),  INT16_C(    16) },
+      {  INT16_C( 18440), -INT16_C( 23776),       INT16_MIN, -INT16_C( 32752),  INT16_C(  2047),  INT16_C(    64), -INT16_C(   834),  INT16_C( 18756),
+        -INT16_C( 25812),  INT16_C(  6438),  INT16_C( 20891),  INT16_C(  2208), -INT16_C(    33), -INT16_C( 10465),  INT16_C(  2048),  INT16_C( 18944),
+        -INT16_C( 23325),  INT16_C(  2048), -INT16_C(  5076), -INT16_C(  4930), -INT16_C(  2906), -INT16_C(  1025),  INT16_C(  1975),  INT16_C( 17679),
+         INT16_C( 18833),  INT16_C( 25421),  INT16_C(  3713), -INT16_C( 32440), -INT16_C( 25254),  INT16_C(    32), -INT16_C( 24575), -INT16_C( 18426) } },
+    { {  INT16_C(  8264), -INT16_C( 28033),  INT16_C(   988),  INT16_C(  6657),  INT16_C( 16177), -INT16_C(    97), -INT16_C( 20490), -INT16_C( 17409),
+         INT16_C(     0),  INT16_C( 24509),  INT16_C( 27044),  INT16_C(   725), -INT16_C(  8354), -INT16_C(  2177), -INT16_C(  2313),  INT16_C(   256),
+        -INT16_C(     1),  INT16_C( 30797),  INT16_C( 31613), -INT16_C(  9945), -INT16_C(     1), -INT16_C( 17858), -INT16_C( 32751),  INT16_C(  8448),
+         INT16_C( 12112),  INT16_C( 20919),  INT16_C( 13044), -INT16_C( 25437), -INT16_C( 14206),  INT16_C(   516), -INT16_C( 20553),  INT16_C(  4102) },
+      UINT32_C(2737383063),
+      {  INT16_C( 16384),  INT16_C( 18644),  INT16_C(   526), -INT16_C(     9), -INT16_C( 29047),  INT16_C( 31650),       INT16_MIN,  INT16_C( 29586),
+         INT16_C( 28655),  INT16_C(   384), -INT16_C( 30704),  INT16_C(     0), -INT16_C( 10994),  INT16_C(  1530),  INT16_C(   641),  INT16_C( 25963),
+        -INT16_C(  4126), -INT16_C( 26473),  INT16_C(  1088),  INT16_C( 20482),  INT16_C( 16384), -INT16_C(  8217), -INT16_C(  5393),  INT16_C(  2368),
+        -INT16_C( 17410),  INT16_C(     8), -INT16_C( 29275),  INT16_C(     0),  INT16_C(     1), -INT16_C(  7080), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(    24),  INT16_C(     2),  INT16_C(     9),  INT16_C(     0), -INT16_C( 12046),  INT16_C(    14),  INT16_C(    21),  INT16_C(     0),
+        -INT16_C( 15905),  INT16_C(     0), -INT16_C( 20753), -INT16_C(  7148),  INT16_C(    18),  INT16_C(    10),  INT16_C(    28),  INT16_C(     9),
+        -INT16_C(  8193),  INT16_C(  2048),  INT16_C(  4141),  INT16_C(    20),  INT16_C(    26), -INT16_C( 17043), -INT16_C( 18290),  INT16_C(    27),
+        -INT16_C(    33), -INT16_C(     1),  INT16_C(    30),  INT16_C(     3),  INT16_C(    15),  INT16_C(    23),  INT16_C( 29822), -INT16_C( 23426) },
+      {  INT16_C(    32),  INT16_C(  9375),  INT16_C(  1793),  INT16_C(  6657),  INT16_C( 20428), -INT16_C(    97), -INT16_C( 20490), -INT16_C( 17409),
+         INT16_C(     0),  INT16_C( 24509),  INT16_C(  4128),  INT16_C(   725), -INT16_C(  8354),  INT16_C( 32445), -INT16_C(  2313),  INT16_C(   256),
+        -INT16_C(  8251),  INT16_C( 30797),  INT16_C( 31613),  INT16_C( 11666), -INT16_C(     1), -INT16_C(   195), -INT16_C( 32751),  INT16_C(  8448),
+         INT16_C( 30716),  INT16_C(    16),  INT16_C( 13044), -INT16_C( 25437), -INT16_C( 14206), -INT16_C( 20476), -INT16_C( 20553), -INT16_C(     4) } },
+    { {  INT16_C(    32),  INT16_C(    17), -INT16_C(  8193), -INT16_C(    10), -INT16_C( 15567), -INT16_C(     3), -INT16_C(  3140), -INT16_C(     5),
+        -INT16_C(  2772),  INT16_C(  3521),  INT16_C( 23436),  INT16_C(   128), -INT16_C(  9743), -INT16_C( 31128), -INT16_C( 32636), -INT16_C(    21),
+        -INT16_C( 14123),  INT16_C( 32763), -INT16_C(   260),  INT16_C( 31767),  INT16_C( 31772), -INT16_C( 18117),  INT16_C( 24892), -INT16_C(  8321),
+         INT16_C(  5632),  INT16_C( 32765),  INT16_C( 24644),  INT16_C( 15165),  INT16_C(  3625),  INT16_C( 21677),  INT16_C( 23971),  INT16_C( 13125) },
+      UINT32_C(1048723650),
+      { -INT16_C( 26325), -INT16_C(  2821),  INT16_C(   640),  INT16_C( 23882),  INT16_C( 31720), -INT16_C(  1873), -INT16_C(     1), -INT16_C( 30378),
+         INT16_C( 28319), -INT16_C( 10373), -INT16_C(   513), -INT16_C( 31734),  INT16_C(  5760),  INT16_C( 32743),  INT16_C(     0),  INT16_C( 24918),
+        -INT16_C(   115), -INT16_C( 24415),  INT16_C( 23906),  INT16_C(  6272),  INT16_C(  1026), -INT16_C(  1153),  INT16_C( 16384),  INT16_C(   512),
+         INT16_C( 22755), -INT16_C(  4097),  INT16_C(  4352),  INT16_C(     0),  INT16_C(  4540),  INT16_C( 15953), -INT16_C(  2305), -INT16_C( 28844) },
+      { -INT16_C( 12179),  INT16_C(     3),  INT16_C(    19),  INT16_C( 27678),  INT16_C(  5909),  INT16_C(    20),  INT16_C(  6150),  INT16_C(    64),
+        -INT16_C(  3932), -INT16_C(     6),  INT16_C( 30016),  INT16_C(  8193),  INT16_C(    14),  INT16_C(    16),  INT16_C(    28),  INT16_C(    24),
+         INT16_C(  6996),  INT16_C(    18),  INT16_C(     0),  INT16_C(    31), -INT16_C( 32736), -INT16_C(   289), -INT16_C(  9176),  INT16_C(  2112),
+         INT16_C(    27),  INT16_C(     4),  INT16_C(    11),  INT16_C(     6),  INT16_C(    31), -INT16_C(  5881),  INT16_C(     0), -INT16_C( 28404) },
+      {  INT16_C(    32),  INT16_C( 24578), -INT16_C(  8193), -INT16_C(    10), -INT16_C( 15567), -INT16_C(     3), -INT16_C(    50), -INT16_C(     5),
+        -INT16_C(  2772),  INT16_C(  3521),  INT16_C( 23436),  INT16_C(   128), -INT16_C(  9743), -INT16_C( 31128),  INT16_C(     8), -INT16_C(    21),
+        -INT16_C( 14123),  INT16_C( 24574), -INT16_C(   260),  INT16_C( 31767),  INT16_C( 31772), -INT16_C( 18117),  INT16_C( 24892), -INT16_C(  8321),
+         INT16_C(  5632), -INT16_C(  2049),  INT16_C(  8204),  INT16_C(   236),  INT16_C(  9080), -INT16_C( 23895),  INT16_C( 23971),  INT16_C( 13125) } },
+    { { -INT16_C(  1049), -INT16_C(     1),  INT16_C( 21127), -INT16_C( 21905), -INT16_C(  3651),  INT16_C( 17704), -INT16_C( 31275),  INT16_C( 21674),
+        -INT16_C( 26624), -INT16_C( 12044), -INT16_C( 16496), -INT16_C(  9360),  INT16_C(     0), -INT16_C( 14010), -INT16_C(    65), -INT16_C( 28896),
+        -INT16_C(  8518), -INT16_C(     1),  INT16_C(    32), -INT16_C(   129),  INT16_C(  8208),  INT16_C( 21804),  INT16_C(  7968), -INT16_C( 16385),
+         INT16_C( 11260),  INT16_C(  2839), -INT16_C( 22780), -INT16_C(   962),  INT16_C(     4), -INT16_C(   257), -INT16_C( 12372), -INT16_C( 15520) },
+      UINT32_C(1979918198),
+      { -INT16_C(   203),  INT16_C( 15780), -INT16_C(     1),  INT16_C(  4160),  INT16_C( 15625),  INT16_C( 16975), -INT16_C( 16898),  INT16_C( 17791),
+        -INT16_C(    35), -INT16_C(  9382),  INT16_C(     4), -INT16_C(  9083), -INT16_C(     6),  INT16_C(  6982), -INT16_C(  4097), -INT16_C( 30672),
+         INT16_C( 11041),  INT16_C( 18502),  INT16_C(   931),  INT16_C( 30215), -INT16_C( 31488),  INT16_C( 29237),  INT16_C( 15116), -INT16_C( 29401),
+         INT16_C( 32176), -INT16_C( 17441), -INT16_C( 21505), -INT16_C(     1),  INT16_C(  2508), -INT16_C(   577), -INT16_C( 20690), -INT16_C(   129) },
+      { -INT16_C( 11888),  INT16_C(     3), -INT16_C( 29427),  INT16_C( 27771),  INT16_C(    25), -INT16_C(  1246), -INT16_C( 23619), -INT16_C(    65),
+         INT16_C(     2),  INT16_C(    27),  INT16_C(     2),  INT16_C(    23),  INT16_C( 16456),  INT16_C(    28), -INT16_C( 28899), -INT16_C( 24645),
+         INT16_C(    33), -INT16_C( 31950), -INT16_C( 21666), -INT16_C(    81),  INT16_C(     5),  INT16_C(    23),  INT16_C( 31930),  INT16_C(    11),
+         INT16_C(    32),  INT16_C(    16),  INT16_C(    20), -INT16_C(  1153),  INT16_C(  4096),  INT16_C(    19),  INT16_C( 29581),  INT16_C(    31) },
+      { -INT16_C(  1049), -INT16_C( 24577), -INT16_C(     6), -INT16_C( 21905), -INT16_C( 31496), -INT16_C( 11958), -INT16_C(  4108),  INT16_C( 21674),
+         INT16_C( 26112),  INT16_C( 27482),  INT16_C( 12260), -INT16_C(  9360),  INT16_C(     0), -INT16_C( 19348), -INT16_C(    65), -INT16_C( 28896),
+        -INT16_C(  4259), -INT16_C( 16385),  INT16_C(    32), -INT16_C(   129),  INT16_C(  8208),  INT16_C( 21804),  INT16_C(  7968), -INT16_C( 16385),
+         INT16_C( 11260),  INT16_C(  2839), -INT16_C(  1424), -INT16_C(   962),  INT16_C(     4), -INT16_C(    33),  INT16_C( 31094), -INT16_C( 15520) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi16(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_shrdv_epi16(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shrdv_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t c[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(2504293067),
+      { -INT16_C(    25),  INT16_C(  1024),  INT16_C(  6887),  INT16_C( 16422),  INT16_C( 16593), -INT16_C( 25283), -INT16_C( 28258), -INT16_C(   545),
+         INT16_C( 16009), -INT16_C( 30882),  INT16_C( 16393),  INT16_C(     0), -INT16_C(  4161), -INT16_C( 12449),  INT16_C(   560),  INT16_C(  9409),
+         INT16_C(  4771), -INT16_C( 11749), -INT16_C( 22759),  INT16_C(  6272), -INT16_C( 15225), -INT16_C(    73), -INT16_C(   133),  INT16_C(  2754),
+        -INT16_C(   257), -INT16_C( 31999),  INT16_C(  3072), -INT16_C( 28249), -INT16_C(     3),  INT16_C(  5398),  INT16_C( 15269),  INT16_C(  4100) },
+      {  INT16_C( 28669), -INT16_C(     1), -INT16_C(  2065),  INT16_C( 16815), -INT16_C( 25149),       INT16_MIN, -INT16_C( 16736),  INT16_C(   512),
+        -INT16_C( 29699), -INT16_C(  1026),  INT16_C(  1024),  INT16_C(  9376), -INT16_C( 19514),  INT16_C(     1), -INT16_C(     1),  INT16_C(   256),
+         INT16_C( 32723), -INT16_C(  1049), -INT16_C(  4097),  INT16_C(     8),  INT16_C( 31537),  INT16_C(     0),  INT16_C(    17),  INT16_C( 29767),
+        -INT16_C( 30874), -INT16_C( 12757),  INT16_C( 28686), -INT16_C( 14337),  INT16_C(  6016), -INT16_C(  5041), -INT16_C( 23683), -INT16_C( 25035) },
+      {  INT16_C( 27124),  INT16_C(     6),  INT16_C(  1088),  INT16_C(    11), -INT16_C( 20333),  INT16_C( 20539), -INT16_C( 21425),  INT16_C(    21),
+        -INT16_C(   513),  INT16_C(  5221), -INT16_C(  8210), -INT16_C( 21658),  INT16_C(    15), -INT16_C( 20883), -INT16_C( 30716),  INT16_C(   176),
+         INT16_C(    20), -INT16_C(  5439),  INT16_C(     3),  INT16_C(     9),  INT16_C(    17),  INT16_C(    32), -INT16_C( 32128),  INT16_C(     8),
+         INT16_C( 17811),  INT16_C(    14),  INT16_C(     6),  INT16_C(    22),  INT16_C(    17),  INT16_C(    13),  INT16_C( 30560),  INT16_C(     1) },
+      { -INT16_C(  8194), -INT16_C(  1008),  INT16_C(     0),  INT16_C( 13800),  INT16_C(     0),  INT16_C(     0),  INT16_C( 32065),  INT16_C(  2030),
+         INT16_C(     0), -INT16_C(  3014),  INT16_C(     0),       INT16_MIN,  INT16_C( 26509),  INT16_C(    14), -INT16_C(  4061),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(  2845),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   133),  INT16_C(     0),
+        -INT16_C(  8225),  INT16_C(     0),  INT16_C( 14384),  INT16_C(     0),  INT16_C( 32766),  INT16_C(     0),  INT16_C(     0), -INT16_C( 30718) } },
+    { UINT32_C( 956788250),
+      { -INT16_C(  1089), -INT16_C( 30785), -INT16_C( 25538),  INT16_C( 12668),  INT16_C(  2048),       INT16_MAX, -INT16_C(   258), -INT16_C(    65),
+        -INT16_C( 17413), -INT16_C( 21167),  INT16_C(  2335),  INT16_C(    64), -INT16_C(     1), -INT16_C( 19985), -INT16_C(   609),  INT16_C(  4290),
+        -INT16_C(  4054), -INT16_C( 22148),  INT16_C(   516), -INT16_C( 16554),  INT16_C( 23163),  INT16_C( 20758),  INT16_C( 12818), -INT16_C(     1),
+         INT16_C(    96),  INT16_C(   512),  INT16_C(    72),  INT16_C(  4224), -INT16_C( 22770),  INT16_C(     2), -INT16_C(   329), -INT16_C(  4627) },
+      {  INT16_C( 13584),  INT16_C(  4144),  INT16_C(  1280), -INT16_C( 10241), -INT16_C( 15744),  INT16_C( 18112), -INT16_C( 16385),  INT16_C( 20158),
+         INT16_C(  1096), -INT16_C( 16290),  INT16_C( 11480),  INT16_C(  6593),  INT16_C(     0),  INT16_C( 16385), -INT16_C(   257),  INT16_C(     0),
+        -INT16_C( 19213),  INT16_C( 31083),  INT16_C(    10),  INT16_C(   384),  INT16_C( 29028),  INT16_C( 15632), -INT16_C(    73),  INT16_C(   768),
+        -INT16_C(  1201), -INT16_C(     1), -INT16_C( 24137), -INT16_C(  4547), -INT16_C( 26609),  INT16_C(  2137),       INT16_MIN,  INT16_C(   512) },
+      { -INT16_C(  3849), -INT16_C(  4753), -INT16_C(    35),  INT16_C(     0),  INT16_C(    31),  INT16_C(  1408),  INT16_C(    20),  INT16_C( 27267),
+        -INT16_C( 17694),  INT16_C(    17),  INT16_C( 16383),  INT16_C(    18),  INT16_C(    13), -INT16_C(  4443), -INT16_C(    21),  INT16_C(    33),
+        -INT16_C( 27695),  INT16_C(     5), -INT16_C( 26922),  INT16_C(    16),  INT16_C(    30),  INT16_C(     9),  INT16_C(     3), -INT16_C( 18725),
+         INT16_C( 16542),  INT16_C(    11),  INT16_C(    27),  INT16_C(     0),  INT16_C(  4101),  INT16_C(     1),  INT16_C(     2),  INT16_C(    29) },
+      {  INT16_C(     0),  INT16_C(  8289),  INT16_C(     0),  INT16_C( 12668), -INT16_C( 31488),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 22184),  INT16_C( 22960),  INT16_C( 16400),  INT16_C(     0),  INT16_C(  3471), -INT16_C(  8193),  INT16_C(     0),
+        -INT16_C(  2027),  INT16_C( 23883),  INT16_C( 10248),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  4804),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4224),  INT16_C( 32056), -INT16_C( 32767),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 973438160),
+      {  INT16_C(   129), -INT16_C( 31744),  INT16_C( 21361),  INT16_C(  4098),  INT16_C(  2796), -INT16_C( 23215), -INT16_C(  2050),  INT16_C( 27316),
+         INT16_C( 23994),  INT16_C(    65),  INT16_C(  8192),  INT16_C( 13433), -INT16_C(  3245),  INT16_C( 20278), -INT16_C(  6661), -INT16_C( 22529),
+         INT16_C( 22507), -INT16_C(  6224),  INT16_C(    68), -INT16_C( 19469),  INT16_C(  2084),  INT16_C( 12308),       INT16_MIN,  INT16_C( 32110),
+        -INT16_C( 14515), -INT16_C(   861),  INT16_C( 24296),  INT16_C( 20921),  INT16_C(   136), -INT16_C( 22528),  INT16_C(  2056),  INT16_C(    64) },
+      {  INT16_C( 12288), -INT16_C( 16385),  INT16_C( 30249), -INT16_C(     9), -INT16_C(  2049), -INT16_C( 29325), -INT16_C( 16129), -INT16_C(  8539),
+        -INT16_C( 21145),  INT16_C(  4096),  INT16_C(   320),  INT16_C(   256), -INT16_C(   513), -INT16_C( 21756),  INT16_C(  2266),  INT16_C( 20491),
+        -INT16_C(   129),  INT16_C(  6561),  INT16_C( 26017),  INT16_C( 31225),  INT16_C(     0),  INT16_C( 30448), -INT16_C( 15617),  INT16_C(    64),
+        -INT16_C(  4555),  INT16_C( 18509),  INT16_C(   512),  INT16_C( 25958),  INT16_C( 15077),  INT16_C(  4279), -INT16_C(   257), -INT16_C( 12417) },
+      {  INT16_C(    17),  INT16_C(    29), -INT16_C(  6539), -INT16_C( 28640),  INT16_C(    15),  INT16_C(    20),  INT16_C(    21),  INT16_C( 31672),
+         INT16_C(    12),  INT16_C(    22),  INT16_C(    19), -INT16_C( 12024),  INT16_C( 32702),  INT16_C(     9),  INT16_C( 20479),  INT16_C(    30),
+        -INT16_C( 17104),  INT16_C( 25503),  INT16_C(    27), -INT16_C( 19976),  INT16_C(     2),  INT16_C(    19),  INT16_C(    27),  INT16_C(    19),
+        -INT16_C(  8960), -INT16_C(  4113), -INT16_C( 17381),  INT16_C(     0), -INT16_C(     1),  INT16_C(    11),  INT16_C(     5),  INT16_C(  2583) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4098),  INT16_C(     0), -INT16_C(    65), -INT16_C( 23190),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(  1024),  INT16_C(    52), -INT16_C(  2049), -INT16_C( 32217),  INT16_C(  4533),  INT16_C(     0),
+         INT16_C( 22507),  INT16_C(     0), -INT16_C( 19424),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 28517),  INT16_C(     0),  INT16_C( 20921),  INT16_C( 30154),  INT16_C(  5877),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 458300821),
+      {  INT16_C(  2312), -INT16_C(  3759),  INT16_C( 29412),  INT16_C(  2144),  INT16_C( 30900), -INT16_C( 11489),  INT16_C(  2088), -INT16_C( 22603),
+         INT16_C(   196),  INT16_C( 25147),  INT16_C(  3799), -INT16_C(  6812),  INT16_C( 31162), -INT16_C( 28866),  INT16_C( 16648),  INT16_C(  7808),
+        -INT16_C(  5329),  INT16_C( 15515), -INT16_C( 28798), -INT16_C( 21054), -INT16_C( 15573), -INT16_C(     1), -INT16_C( 20704),  INT16_C( 11938),
+         INT16_C( 16083), -INT16_C( 10257),  INT16_C(  1576),  INT16_C( 11324),  INT16_C(  8448), -INT16_C(   258), -INT16_C(  8201),  INT16_C( 13727) },
+      { -INT16_C( 32736),  INT16_C(  6160), -INT16_C( 18603), -INT16_C(     1), -INT16_C( 19974),  INT16_C( 19609), -INT16_C(  6860),  INT16_C(   140),
+         INT16_C(     0),  INT16_C( 12160), -INT16_C( 29133),  INT16_C(  2052),  INT16_C( 32757), -INT16_C(     1),  INT16_C(  4132), -INT16_C( 19457),
+         INT16_C( 32195), -INT16_C( 10569), -INT16_C( 25694), -INT16_C(  2051), -INT16_C(  4105),  INT16_C(   256), -INT16_C( 17537), -INT16_C( 21341),
+        -INT16_C(  2049), -INT16_C( 11993),  INT16_C(  1040), -INT16_C( 20481),  INT16_C(   994), -INT16_C(  2058),  INT16_C(  9996), -INT16_C(  2049) },
+      {  INT16_C(    18), -INT16_C( 17728),  INT16_C(     4),  INT16_C(     6),  INT16_C(     8),  INT16_C(    13),  INT16_C(    29),  INT16_C(    22),
+        -INT16_C( 24320),  INT16_C( 17418),  INT16_C(    26),  INT16_C(    19),  INT16_C(    13),  INT16_C( 23069), -INT16_C( 23035), -INT16_C(  4615),
+         INT16_C( 16408), -INT16_C(  5915),  INT16_C( 22985), -INT16_C(  4289), -INT16_C( 11400), -INT16_C(  4737),  INT16_C(     1), -INT16_C( 15126),
+         INT16_C(    22),  INT16_C(    16),  INT16_C(    28),  INT16_C(    31),  INT16_C(   324),  INT16_C(    14),  INT16_C(     0),  INT16_C( 10940) },
+      {  INT16_C(   578),  INT16_C(     0),  INT16_C( 22318),  INT16_C(     0), -INT16_C(  1416),  INT16_C(     0),  INT16_C(     0),  INT16_C( 12958),
+         INT16_C(   196),  INT16_C(     0), -INT16_C( 29501), -INT16_C( 25428), -INT16_C(    85),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 15381),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2109),  INT16_C(     0), -INT16_C( 10352),  INT16_C(     0),
+        -INT16_C(   773), -INT16_C( 10257),  INT16_C(     0),  INT16_C( 24574),  INT16_C(  8720),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1671579802),
+      { -INT16_C(     7),  INT16_C( 32189), -INT16_C(  4240),  INT16_C(     2), -INT16_C( 17014), -INT16_C(    33),  INT16_C(  1335),  INT16_C(  8722),
+        -INT16_C(    11), -INT16_C(  8935), -INT16_C( 25517), -INT16_C(     1),  INT16_C( 16612), -INT16_C(  3593),  INT16_C( 16360), -INT16_C(  4097),
+        -INT16_C( 18753),  INT16_C( 27506),  INT16_C( 24491), -INT16_C(  4269),  INT16_C(  7751), -INT16_C( 26279),  INT16_C( 26005),  INT16_C( 11753),
+         INT16_C( 18696), -INT16_C( 31374), -INT16_C( 32186), -INT16_C( 26672),  INT16_C( 16720), -INT16_C( 20633), -INT16_C(  8953),  INT16_C( 11886) },
+      { -INT16_C( 28042), -INT16_C( 31000),  INT16_C(    16), -INT16_C(  3087), -INT16_C(  1059), -INT16_C( 28794), -INT16_C( 19036),  INT16_C(     1),
+        -INT16_C( 25128),  INT16_C(  1024),  INT16_C( 16296), -INT16_C(     1), -INT16_C(  4101),  INT16_C(   288), -INT16_C( 14649), -INT16_C( 15797),
+              INT16_MIN, -INT16_C( 27311),  INT16_C(    72),  INT16_C(  4130),  INT16_C( 12950), -INT16_C( 16730), -INT16_C( 11631),  INT16_C(  3241),
+         INT16_C(     0), -INT16_C(   517), -INT16_C( 29360),       INT16_MAX, -INT16_C( 16425), -INT16_C(     1),  INT16_C( 11335),  INT16_C(  9717) },
+      {  INT16_C(     2), -INT16_C( 25658),  INT16_C(    16), -INT16_C( 23949), -INT16_C(  4758),  INT16_C(    12),  INT16_C(    24), -INT16_C( 26512),
+         INT16_C(   281),  INT16_C(    11),  INT16_C(    25),  INT16_C(    17), -INT16_C( 30680), -INT16_C(   774), -INT16_C(    65), -INT16_C( 32256),
+         INT16_C(    27), -INT16_C( 27788),  INT16_C(    31),  INT16_C( 24104),  INT16_C(    33), -INT16_C( 24628),  INT16_C(  2370),  INT16_C( 27209),
+         INT16_C(    24), -INT16_C( 30208),  INT16_C(     4),  INT16_C( 15482),  INT16_C( 14293),  INT16_C(     9), -INT16_C( 18535),  INT16_C(    32) },
+      {  INT16_C(     0), -INT16_C( 24074),  INT16_C(     0),  INT16_C(  8192), -INT16_C(  2193),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8722),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C( 29298),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(  5815),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5527),  INT16_C(     0),  INT16_C( 21654),
+         INT16_C(    73), -INT16_C( 31374),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    41),  INT16_C(  9198),  INT16_C(     0) } },
+    { UINT32_C(1914885350),
+      { -INT16_C(    81),  INT16_C( 28141),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5121), -INT16_C( 32512),  INT16_C( 12289), -INT16_C(     3),
+         INT16_C( 11891), -INT16_C( 11315),  INT16_C( 15596),  INT16_C( 18432),  INT16_C(  1071),  INT16_C(     0),  INT16_C(  2048),  INT16_C( 29847),
+        -INT16_C(     1), -INT16_C(  2733), -INT16_C( 32396), -INT16_C(  7538), -INT16_C(  2317), -INT16_C(  4161),  INT16_C(   272), -INT16_C( 23909),
+         INT16_C(  5465), -INT16_C(     9),  INT16_C(     1),  INT16_C( 14667),  INT16_C(  4177),  INT16_C( 16384),  INT16_C(     1), -INT16_C(     1) },
+      { -INT16_C(  5575),  INT16_C(  2315),  INT16_C( 22949),  INT16_C(   389), -INT16_C( 21170),  INT16_C(    28),  INT16_C(     8),  INT16_C(  5632),
+         INT16_C(     4),  INT16_C( 21512), -INT16_C(   513), -INT16_C(  4568), -INT16_C( 24319), -INT16_C(    65),  INT16_C( 31059), -INT16_C(   257),
+        -INT16_C(   169),  INT16_C(   769),  INT16_C( 22909), -INT16_C(  6865), -INT16_C( 30339),  INT16_C( 25207),  INT16_C( 21769), -INT16_C( 32512),
+         INT16_C( 15838),  INT16_C( 12614),  INT16_C( 11887),  INT16_C( 11545),  INT16_C( 30457),  INT16_C( 22771),  INT16_C( 14439),  INT16_C(   269) },
+      {  INT16_C(    27),  INT16_C(    33),  INT16_C(    22),  INT16_C(    10),  INT16_C(    19), -INT16_C(  3161),  INT16_C(    26), -INT16_C(  4377),
+         INT16_C(    33),  INT16_C(    25), -INT16_C( 24568),  INT16_C(    25),  INT16_C(    24), -INT16_C( 27298), -INT16_C( 21557), -INT16_C( 14664),
+         INT16_C(  3456),  INT16_C(    22),  INT16_C(     8),  INT16_C(    19),  INT16_C(    12),  INT16_C(    14),  INT16_C(    17),  INT16_C(  6238),
+         INT16_C(    33),  INT16_C(     2),  INT16_C(    13),  INT16_C(    28),  INT16_C(    31),  INT16_C(     7), -INT16_C( 15588), -INT16_C(     5) },
+      {  INT16_C(     0), -INT16_C( 18698), -INT16_C( 27648),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14594),  INT16_C(   524),  INT16_C(   511),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(   196),  INT16_C(     0),  INT16_C(   260),  INT16_C(     0),  INT16_C( 10849), -INT16_C(   140),
+         INT16_C(     0),  INT16_C(  2005),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 30241),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 16387),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4622), -INT16_C(  6528), -INT16_C( 31120),  INT16_C(     0) } },
+    { UINT32_C( 147422588),
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 16407),  INT16_C(  3839), -INT16_C(  7246), -INT16_C( 18585), -INT16_C( 21094),  INT16_C( 10774),
+         INT16_C(   160), -INT16_C( 10497),  INT16_C(   520), -INT16_C(     1),  INT16_C( 20512), -INT16_C(     1), -INT16_C(  8381),  INT16_C(   256),
+        -INT16_C( 30530),  INT16_C( 31743),  INT16_C( 30697), -INT16_C( 24821), -INT16_C( 28533), -INT16_C( 18462),  INT16_C(  8274), -INT16_C(  9539),
+         INT16_C( 32642),  INT16_C(  8192), -INT16_C( 26653),  INT16_C(  8127), -INT16_C( 20419),  INT16_C( 32026),  INT16_C( 15871), -INT16_C(  2177) },
+      {  INT16_C( 31147), -INT16_C(  1852),  INT16_C( 16384),  INT16_C(  2848), -INT16_C(  2049), -INT16_C( 21363), -INT16_C(     1), -INT16_C(    33),
+        -INT16_C(  7343), -INT16_C( 24538), -INT16_C(    35),  INT16_C(    66),  INT16_C(  5994), -INT16_C( 14017), -INT16_C( 16897),  INT16_C( 25981),
+         INT16_C(  8712), -INT16_C( 11457), -INT16_C( 18613),  INT16_C( 28287),  INT16_C(  6385), -INT16_C(   262),  INT16_C(  8704),  INT16_C(    32),
+        -INT16_C( 32128), -INT16_C(  8104),  INT16_C( 28875), -INT16_C(   129), -INT16_C(  1281),  INT16_C( 16504),  INT16_C( 27249),  INT16_C(  4096) },
+      {  INT16_C(     2),  INT16_C(    31),  INT16_C(  1088),  INT16_C(  2865), -INT16_C( 24772),  INT16_C(     7),  INT16_C(    15),  INT16_C(    23),
+         INT16_C( 30492),  INT16_C(    12), -INT16_C(  1089), -INT16_C( 12321), -INT16_C(  1025),  INT16_C(     5),  INT16_C(  8424), -INT16_C(   257),
+         INT16_C(    21), -INT16_C( 23847),  INT16_C(     5), -INT16_C( 16397),  INT16_C( 15611),  INT16_C(    19),  INT16_C(     6),  INT16_C(     0),
+         INT16_C(  6629),  INT16_C(     9),  INT16_C(    17),  INT16_C(    21),  INT16_C( 15630),  INT16_C(    15),  INT16_C(    10), -INT16_C(     2) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 16407),  INT16_C(  1919),  INT16_C( 32766),  INT16_C(  7022), -INT16_C(     1),  INT16_C(     0),
+         INT16_C( 13584),  INT16_C(     0), -INT16_C(    70),  INT16_C(   133),  INT16_C( 11988), -INT16_C(     1), -INT16_C(    33),  INT16_C(     0),
+         INT16_C( 17477),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3103),  INT16_C(     0),  INT16_C(     0),  INT16_C(   129), -INT16_C(  9539),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1795),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2931704100),
+      { -INT16_C(     1), -INT16_C(  2553),  INT16_C( 21244), -INT16_C( 21527),  INT16_C( 20863),  INT16_C(  6595), -INT16_C(     9),  INT16_C( 14084),
+        -INT16_C(  3158),  INT16_C(    50),  INT16_C(   520),  INT16_C( 15892),  INT16_C( 22868), -INT16_C(    34), -INT16_C(  7875), -INT16_C(    11),
+        -INT16_C(     1),  INT16_C( 20820),  INT16_C( 25841),  INT16_C(  2131), -INT16_C(   677),  INT16_C( 18272),  INT16_C(     0), -INT16_C( 13399),
+        -INT16_C(   193), -INT16_C( 32397),  INT16_C(  4036),  INT16_C( 23886), -INT16_C(  6161),  INT16_C(   788), -INT16_C(    97), -INT16_C(    11) },
+      {  INT16_C(   129),  INT16_C(  7987), -INT16_C(     1),  INT16_C( 29474),       INT16_MAX,  INT16_C( 31182), -INT16_C(  2049),  INT16_C(   272),
+         INT16_C( 32643), -INT16_C(     9), -INT16_C( 20813), -INT16_C( 28624),  INT16_C(  5409), -INT16_C( 30717),  INT16_C(  9529),  INT16_C(    66),
+         INT16_C(  2057), -INT16_C(  4137),  INT16_C( 16392), -INT16_C( 21750), -INT16_C(   513),  INT16_C(  4384), -INT16_C( 21086), -INT16_C(  4353),
+        -INT16_C( 32755), -INT16_C( 26050), -INT16_C(  9509),  INT16_C( 24872), -INT16_C( 28672),  INT16_C( 10497),  INT16_C( 19836),  INT16_C( 18197) },
+      {  INT16_C(    15),  INT16_C(    14), -INT16_C(  3154),  INT16_C(     8), -INT16_C(    73),  INT16_C( 22380),  INT16_C(    17),  INT16_C(    22),
+         INT16_C(    25), -INT16_C( 16384),  INT16_C(    10), -INT16_C( 18623), -INT16_C(  9491),  INT16_C(    28),  INT16_C(    17),  INT16_C(    10),
+         INT16_C(    23),  INT16_C(    80), -INT16_C( 24044),  INT16_C(    27),  INT16_C(    21),  INT16_C( 32765),  INT16_C(   130), -INT16_C(  8193),
+         INT16_C(     1),  INT16_C(     5),  INT16_C(     1),  INT16_C(    20),  INT16_C(    30), -INT16_C( 10471), -INT16_C(  2817),  INT16_C(  1024) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     3),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25375),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 15879),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3938),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 20820), -INT16_C( 31153),  INT16_C( 24897), -INT16_C(    22), -INT16_C( 30462),  INT16_C(     0), -INT16_C(  8705),
+         INT16_C(     0), -INT16_C(  3061), -INT16_C( 30750), -INT16_C( 31276),  INT16_C(     0), -INT16_C( 32639),  INT16_C(     0), -INT16_C(    11) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi16(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_shrdv_epi16(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1391994454),  INT32_C(   277086912), -INT32_C(  1077940481),  INT32_C(   541134976), -INT32_C(  2105270270), -INT32_C(   269258755), -INT32_C(      133202),  INT32_C(  2059337214),
+        -INT32_C(     4195329),  INT32_C(  2125372993),  INT32_C(       32769),  INT32_C(   954694200), -INT32_C(  2109819299), -INT32_C(  1792139168),  INT32_C(     8456192),  INT32_C(   313589762) },
+      {  INT32_C(   652883444), -INT32_C(  1579449812),  INT32_C(   271712768),  INT32_C(  2048782036),  INT32_C(   754978836),  INT32_C(     1049672), -INT32_C(  2143997143), -INT32_C(   134218753),
+        -INT32_C(  1921536261),  INT32_C(   248424181), -INT32_C(  1631983243), -INT32_C(    33685505),  INT32_C(   745893697),  INT32_C(   761250189),  INT32_C(  1148215253),  INT32_C(  1357132139) },
+      {  INT32_C(          30),  INT32_C(          45),  INT32_C(       73728),  INT32_C(  1616908300),  INT32_C(          34),  INT32_C(     4497416),  INT32_C(           9),  INT32_C(          58),
+         INT32_C(          26),  INT32_C(          56), -INT32_C(   269484034),  INT32_C(    34604049),  INT32_C(          63),  INT32_C(          53),  INT32_C(          52),  INT32_C(   671123586) },
+      { -INT32_C(  1683433518),  INT32_C(   291537952), -INT32_C(  1077940481), -INT32_C(   314440687),  INT32_C(   547424256),  INT32_C(  1223684975), -INT32_C(  1795162373), -INT32_C(       65570),
+         INT32_C(  1575730943), -INT32_C(   827918978),  INT32_C(  2062001620), -INT32_C(       25485),  INT32_C(  1491787395), -INT32_C(    32740183),  INT32_C(   100487176), -INT32_C(   995344384) } },
+    { { -INT32_C(  2062415485),  INT32_C(     1065216),  INT32_C(     4211200), -INT32_C(   188317229), -INT32_C(  1082138886), -INT32_C(   807535105), -INT32_C(      131169),  INT32_C(  1074799108),
+         INT32_C(   456700618),  INT32_C(  2081254943),  INT32_C(   134873472), -INT32_C(  1076105225),  INT32_C(  1999634430),  INT32_C(   807361749),  INT32_C(  1075839008),  INT32_C(       32772) },
+      { -INT32_C(   151004165), -INT32_C(   285220865), -INT32_C(        8193), -INT32_C(    33587401),  INT32_C(   587454161),  INT32_C(  2027371381), -INT32_C(           1), -INT32_C(  1949962647),
+         INT32_C(          64), -INT32_C(  1233618325), -INT32_C(   302125025), -INT32_C(   536903685),  INT32_C(  1386767871), -INT32_C(  1149255787), -INT32_C(        8199), -INT32_C(   238192471) },
+      {  INT32_C(   863711074),  INT32_C(  1280833264), -INT32_C(  1646345468),  INT32_C(          22), -INT32_C(  1914494155),  INT32_C(          60),  INT32_C(          44), -INT32_C(    33685825),
+         INT32_C(          49),  INT32_C(          65),  INT32_C(           3),  INT32_C(          60),  INT32_C(          31),  INT32_C(          39), -INT32_C(  2002133881),  INT32_C(          33) },
+      { -INT32_C(   515603872), -INT32_C(   536936432), -INT32_C(   268172256), -INT32_C(    33759277),  INT32_C(   515280379), -INT32_C(  1921796260), -INT32_C(          33),  INT32_C(   395042002),
+         INT32_C(     2100636), -INT32_C(  1106856177), -INT32_C(   520011728), -INT32_C(      524357), -INT32_C(  1521431554),  INT32_C(   710950585), -INT32_C(   226476032), -INT32_C(  2147467262) } },
+    { { -INT32_C(     1906689),  INT32_C(  1244927543), -INT32_C(     2099265),  INT32_C(     3293216), -INT32_C(  1347015339),  INT32_C(    33816720),  INT32_C(        2564),  INT32_C(    33554464),
+         INT32_C(    33554432), -INT32_C(    67371521),  INT32_C(    65412093), -INT32_C(  1759286089),  INT32_C(   193064403), -INT32_C(  2080342016), -INT32_C(    17826305), -INT32_C(   134348877) },
+      { -INT32_C(   537460737), -INT32_C(         257),  INT32_C(    33816640),  INT32_C(  1073742008), -INT32_C(   286261569),  INT32_C(   534266126),  INT32_C(  1080463455), -INT32_C(  1314674999),
+         INT32_C(  1803336125), -INT32_C(     8388609),  INT32_C(    37748736), -INT32_C(  1075847233),  INT32_C(    17301504), -INT32_C(       32770), -INT32_C(       16673), -INT32_C(       74753) },
+      {  INT32_C(  1681417062), -INT32_C(    50339979),  INT32_C(   907994143),  INT32_C(   667659755), -INT32_C(    21069825), -INT32_C(   268468225), -INT32_C(  1218548718),  INT32_C(  1124336640),
+         INT32_C(   681679508),  INT32_C(           3),  INT32_C(  1263492335),  INT32_C(          34), -INT32_C(  1610481144),  INT32_C(  1074798592),  INT32_C(          10),  INT32_C(          30) },
+      { -INT32_C(       29793), -INT32_C(      525743),  INT32_C(    67633281),  INT32_C(   385877576), -INT32_C(   572523137),  INT32_C(  1068532252), -INT32_C(  1541947392),  INT32_C(    33554464),
+        -INT32_C(   878981088), -INT32_C(     8421441),  INT32_C(        1996), -INT32_C(   439821523),  INT32_C(      754157), -INT32_C(  2080342016), -INT32_C(  1207976961), -INT32_C(      299009) } },
+    { { -INT32_C(       67585), -INT32_C(    33563649), -INT32_C(   688287890), -INT32_C(   671121409), -INT32_C(         273), -INT32_C(    71438497),  INT32_C(     1048666), -INT32_C(   316116120),
+        -INT32_C(   604110865), -INT32_C(    94945401),  INT32_C(  2146434815), -INT32_C(   905969923),  INT32_C(   807785533), -INT32_C(     2109509), -INT32_C(   402654209),  INT32_C(     4849664) },
+      {  INT32_C(  1037257056), -INT32_C(   883641013),  INT32_C(   512516760),  INT32_C(   507151492), -INT32_C(     1118217), -INT32_C(   959384535),  INT32_C(   979953209), -INT32_C(   674617085),
+         INT32_C(  1985269665), -INT32_C(  1706342003), -INT32_C(   603983873),  INT32_C(  1107558488), -INT32_C(  2059413230),  INT32_C(  1582079501), -INT32_C(  1207959557),  INT32_C(   536870977) },
+      {  INT32_C(   433250149),  INT32_C(   449731235),  INT32_C(  2111037439),  INT32_C(  1173072611),  INT32_C(           6),  INT32_C(          63), -INT32_C(   904322128),  INT32_C(           1),
+        -INT32_C(  1012249628), -INT32_C(  1664162978), -INT32_C(   111164282),  INT32_C(          52),  INT32_C(  1826697853),  INT32_C(          37),  INT32_C(          51),  INT32_C(  1534870829) },
+      {  INT32_C(   134215615),  INT32_C(  2143288191),  INT32_C(  1025033521), -INT32_C(  1694502913), -INT32_C(   536870917), -INT32_C(  1918769069), -INT32_C(   432472048), -INT32_C(   158058060),
+         INT32_C(   499113982),  INT32_C(  1764566583), -INT32_C(    33570821),  INT32_C(  1074105503),  INT32_C(   704563345),  INT32_C(  1878982269), -INT32_C(       33537),  INT32_C(    34079312) } },
+    { {  INT32_C(   798970126), -INT32_C(   134219777),  INT32_C(   177431273), -INT32_C(   134234145),  INT32_C(   150994952), -INT32_C(   577956275), -INT32_C(  1614084881),  INT32_C(  1771098473),
+        -INT32_C(  1077938317), -INT32_C(   536950049),  INT32_C(     1180168),  INT32_C(  1713354198),  INT32_C(  1551152613),  INT32_C(  2100818341), -INT32_C(  1781948618),  INT32_C(    16778272) },
+      {  INT32_C(  1864543538),  INT32_C(    37748740),  INT32_C(   269090816),  INT32_C(   545259651),  INT32_C(  1044012614),  INT32_C(  1176190946), -INT32_C(   485851264), -INT32_C(   469703105),
+        -INT32_C(   822977382), -INT32_C(  1430436727), -INT32_C(  1073742881), -INT32_C(  1350699393),  INT32_C(  1922787559),  INT32_C(  1232419280),  INT32_C(  2079175277),  INT32_C(  2136973307) },
+      {  INT32_C(  2145386431),  INT32_C(           7),  INT32_C(           8),  INT32_C(          13),  INT32_C(        3088), -INT32_C(  1047674464),  INT32_C(    67113024), -INT32_C(           9),
+         INT32_C(  1624144615),  INT32_C(  1077938304), -INT32_C(   421528577),  INT32_C(           2),  INT32_C(           5),  INT32_C(          54), -INT32_C(  1190112562),  INT32_C(          54) },
+      { -INT32_C(   565880220),  INT32_C(   166723567),  INT32_C(      693090),  INT32_C(    69189629),  INT32_C(  1581648128), -INT32_C(   577956275), -INT32_C(  1614084881),  INT32_C(    30179027),
+         INT32_C(   897548270), -INT32_C(   536950049),  INT32_C(  2147481534), -INT32_C(   645403275),  INT32_C(   987997615), -INT32_C(   723041804), -INT32_C(   910797018),  INT32_C(  2122312708) } },
+    { { -INT32_C(    21037345), -INT32_C(  1149768705), -INT32_C(   566304773), -INT32_C(   670632666), -INT32_C(   586077691),  INT32_C(  1205016941), -INT32_C(   376577368), -INT32_C(   377460179),
+        -INT32_C(     8388609),  INT32_C(   301989904), -INT32_C(   285343753),  INT32_C(   117931009),  INT32_C(   440701870), -INT32_C(         529),  INT32_C(  1632211367),  INT32_C(   826079463) },
+      {  INT32_C(   122683776), -INT32_C(  1501835495), -INT32_C(   620756993),  INT32_C(       69761),  INT32_C(   651688930),  INT32_C(    14734340),  INT32_C(   536872994),  INT32_C(     2361368),
+        -INT32_C(   571474305),  INT32_C(   519280506),  INT32_C(  1392730459), -INT32_C(   886851212),  INT32_C(      131072), -INT32_C(   805306433), -INT32_C(  1066632421),  INT32_C(  2011152318) },
+      {  INT32_C(   267464098), -INT32_C(   109052930),  INT32_C(          42),  INT32_C(          55),  INT32_C(          14),  INT32_C(          52),  INT32_C(          15), -INT32_C(   674760316),
+         INT32_C(           2), -INT32_C(  2128574460),  INT32_C(   701774345),  INT32_C(           6),  INT32_C(   268505153),  INT32_C(          11),  INT32_C(          48), -INT32_C(    57905041) },
+      {  INT32_C(  1068482487), -INT32_C(  1712374682), -INT32_C(      553033),  INT32_C(    35718064), -INT32_C(   276073404),  INT32_C(   222315645),  INT32_C(   273011483), -INT32_C(  1902639454),
+        -INT32_C(     2097153), -INT32_C(  1591738367), -INT32_C(  1376289025), -INT32_C(   803463696),  INT32_C(   220350935), -INT32_C(   134217729),  INT32_C(  2065391945),  INT32_C(  2138858105) } },
+    { {  INT32_C(     7055392),  INT32_C(   717742667),  INT32_C(   973781906), -INT32_C(   318775441), -INT32_C(  1577851442),  INT32_C(  1306367964),  INT32_C(   447902364),  INT32_C(  1541113319),
+         INT32_C(   397770582), -INT32_C(  1652602495),  INT32_C(   136315908), -INT32_C(   403456001), -INT32_C(   976627277), -INT32_C(       67585), -INT32_C(   134217737), -INT32_C(   407826956) },
+      { -INT32_C(  1749631914),  INT32_C(   570497028), -INT32_C(   765535093), -INT32_C(  2019390624),  INT32_C(  1220549120), -INT32_C(     8536130), -INT32_C(   703736205),  INT32_C(  1525601299),
+        -INT32_C(  1667079900),  INT32_C(  1074025984),  INT32_C(  1583191197),  INT32_C(  1195008157),  INT32_C(  1622869748),  INT32_C(  1800190143),  INT32_C(    13994969), -INT32_C(  1157905647) },
+      {  INT32_C(           8),  INT32_C(           0),  INT32_C(  1134335205),  INT32_C(    10485760),  INT32_C(          26),  INT32_C(          19),  INT32_C(   274522730), -INT32_C(   570427433),
+         INT32_C(          10), -INT32_C(  1619969236),  INT32_C(           2),  INT32_C(          63),  INT32_C(           7),  INT32_C(          36),  INT32_C(      786496),  INT32_C(      525440) },
+      {  INT32_C(  1442868136),  INT32_C(   717742667),  INT32_C(  1506825692), -INT32_C(   318775441),  INT32_C(   805732392), -INT32_C(  1208497733), -INT32_C(  1664701284), -INT32_C(   576182601),
+         INT32_C(  1225125215),  INT32_C(  1611257844),  INT32_C(  1107820801), -INT32_C(  1904950981), -INT32_C(   376728653), -INT32_C(        4225), -INT32_C(   134217737), -INT32_C(   407826956) } },
+    { { -INT32_C(   200546695), -INT32_C(  1639054667),  INT32_C(  1082687488), -INT32_C(  1915617784), -INT32_C(  1965982111), -INT32_C(    59743623), -INT32_C(  1187888995),  INT32_C(  1827217826),
+        -INT32_C(    68698513),  INT32_C(    67125250), -INT32_C(   970004302), -INT32_C(     1310721),  INT32_C(   750597256),  INT32_C(  1356857472),  INT32_C(     8388689),  INT32_C(  2139279700) },
+      {  INT32_C(  1498511057),  INT32_C(  1925139123),  INT32_C(  1140986368),  INT32_C(  1074631480),  INT32_C(  1994391551),  INT32_C(    33558528),  INT32_C(   341651855), -INT32_C(   138420233),
+        -INT32_C(  2129995206),  INT32_C(   671123456),  INT32_C(    17825792),  INT32_C(   536872452),  INT32_C(   945956719), -INT32_C(    80189402),  INT32_C(   765505389),  INT32_C(   812985395) },
+      {  INT32_C(  1656782864),  INT32_C(  2143710422),  INT32_C(          63), -INT32_C(    16908297),  INT32_C(    13962055), -INT32_C(   840962049),  INT32_C(   567818374),  INT32_C(          49),
+        -INT32_C(   223340226), -INT32_C(   541066497), -INT32_C(    35651861),  INT32_C(           9),  INT32_C(   140510209),  INT32_C(          19),  INT32_C(          13),  INT32_C(          46) },
+      {  INT32_C(  1993470987), -INT32_C(    47526279), -INT32_C(  2012994560),  INT32_C(   455504155), -INT32_C(    15359236),  INT32_C(    67117057),  INT32_C(  1055181058), -INT32_C(   268716428),
+         INT32_C(    69953771),  INT32_C(  1342246912),  INT32_C(     1623517),  INT32_C(    41940479), -INT32_C(  1772185020),  INT32_C(   218417692),  INT32_C(  2070414336), -INT32_C(  1328677365) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r = simde_mm512_shrdv_epi32(a, b, c);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const simde__mmask16 k;
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   713149819), -INT32_C(  1808400799),  INT32_C(   276955136),  INT32_C(  1144922751),  INT32_C(         512),  INT32_C(  1038480961),  INT32_C(  1313957844),  INT32_C(  2147478263),
+         INT32_C(   991463745), -INT32_C(   268435729), -INT32_C(  1539466064), -INT32_C(   373495012),  INT32_C(  1074003969),  INT32_C(   810722646), -INT32_C(  1210056961), -INT32_C(   909806678) },
+      UINT16_C(38244),
+      { -INT32_C(     4198417), -INT32_C(  1683793929),  INT32_C(   136904736), -INT32_C(           1), -INT32_C(   171155945), -INT32_C(   292520949), -INT32_C(   799140624),  INT32_C(  2000355324),
+        -INT32_C(   549732467), -INT32_C(  2147467134), -INT32_C(   177590399),  INT32_C(   616823516),  INT32_C(   318564714), -INT32_C(  1488053947), -INT32_C(   537399297),  INT32_C(  1677770816) },
+      {  INT32_C(          48),  INT32_C(          43),  INT32_C(          18), -INT32_C(  1493185247),  INT32_C(   945499406),  INT32_C(          59),  INT32_C(          37),  INT32_C(  1350065289),
+         INT32_C(           1),  INT32_C(          30), -INT32_C(       16514),  INT32_C(          62),  INT32_C(          28),  INT32_C(           9),  INT32_C(          54), -INT32_C(   222920405) },
+      {  INT32_C(   713149819), -INT32_C(  1808400799),  INT32_C(  1074267168),  INT32_C(  1144922751),  INT32_C(         512), -INT32_C(   770735769), -INT32_C(  2106422466),  INT32_C(  2147478263),
+        -INT32_C(  1651751776), -INT32_C(   268435729), -INT32_C(   710361594), -INT32_C(   373495012),  INT32_C(   802068132),  INT32_C(   810722646), -INT32_C(  1210056961),  INT32_C(   135870638) } },
+    { { -INT32_C(   304356609),  INT32_C(    24441453),  INT32_C(   724864665),  INT32_C(   545357826),  INT32_C(  2087137985),  INT32_C(   268568385), -INT32_C(  1456916111),  INT32_C(  1073746944),
+         INT32_C(   860672280), -INT32_C(     6291489), -INT32_C(  1615863813), -INT32_C(   808867539),  INT32_C(   542261248), -INT32_C(  1074331672),  INT32_C(   446825713),  INT32_C(       65792) },
+      UINT16_C(50357),
+      { -INT32_C(  1074038017), -INT32_C(  1502522200),  INT32_C(  1768518052), -INT32_C(  1612019350), -INT32_C(   419223462),  INT32_C(   554715136),  INT32_C(  1232995154),  INT32_C(    33556480),
+         INT32_C(  1670857227),  INT32_C(    67117360),  INT32_C(  1073724923), -INT32_C(  1193246952), -INT32_C(  2041530987), -INT32_C(   223922789),  INT32_C(  1580163410), -INT32_C(    16777221) },
+      { -INT32_C(  1536834415),  INT32_C(     3178784), -INT32_C(  1688164264), -INT32_C(    16809985),  INT32_C(          40),  INT32_C(           2), -INT32_C(         133),  INT32_C(          62),
+         INT32_C(          30), -INT32_C(  1322670051), -INT32_C(   529181935),  INT32_C(          10),  INT32_C(          36),  INT32_C(          17), -INT32_C(  1565820123),  INT32_C(          64) },
+      { -INT32_C(  1115687187),  INT32_C(    24441453),  INT32_C(  1769055275),  INT32_C(   545357826),  INT32_C(  1518102322),  INT32_C(    67142096), -INT32_C(  1456916111),  INT32_C(   134225921),
+         INT32_C(   860672280), -INT32_C(     6291489), -INT32_C(   553791529), -INT32_C(   808867539),  INT32_C(   542261248), -INT32_C(  1074331672), -INT32_C(  1865084889),  INT32_C(       65792) } },
+    { { -INT32_C(    35667969),  INT32_C(     4198400),  INT32_C(  2104325446),  INT32_C(  1073889408), -INT32_C(        4113),  INT32_C(  1447623508), -INT32_C(  1110683484),  INT32_C(     2101248),
+        -INT32_C(    50397317),  INT32_C(    36622782), -INT32_C(  2005259654), -INT32_C(  2077793671),  INT32_C(   829283493),  INT32_C(    34078737), -INT32_C(  1073746025),  INT32_C(  1886758918) },
+      UINT16_C(51994),
+      {  INT32_C(    21037056),  INT32_C(  1737020847),  INT32_C(   797924694),  INT32_C(   909663254), -INT32_C(   547364889), -INT32_C(  2013249535),  INT32_C(  1521857834),  INT32_C(    35180127),
+         INT32_C(   410462907), -INT32_C(    69011770), -INT32_C(   357151166),  INT32_C(   878767665),  INT32_C(   174329213), -INT32_C(  1073741937),  INT32_C(  1062363998), -INT32_C(  2073350135) },
+      {  INT32_C(          21),  INT32_C(          16),  INT32_C(          56),  INT32_C(          27),  INT32_C(          36),  INT32_C(   277087264),  INT32_C(          40),  INT32_C(          39),
+         INT32_C(   992325228),  INT32_C(          12),  INT32_C(    33554464),  INT32_C(          46),  INT32_C(          53), -INT32_C(  2010514177),  INT32_C(          51),  INT32_C(          53) },
+      { -INT32_C(    35667969), -INT32_C(   709951424),  INT32_C(  2104325446), -INT32_C(   955546936),  INT32_C(  2147483390),  INT32_C(  1447623508), -INT32_C(  1110683484),  INT32_C(     2101248),
+        -INT32_C(  1413492753),  INT32_C(  1818239725), -INT32_C(  2005259654), -INT32_C(  1194979171),  INT32_C(   829283493),  INT32_C(    34078737),  INT32_C(  1282136063),  INT32_C(  1501580163) } },
+    { { -INT32_C(    67113762),  INT32_C(  1238763637),  INT32_C(    67121792), -INT32_C(    86940796), -INT32_C(    18874378), -INT32_C(   481624304),  INT32_C(   822099968),  INT32_C(  1370837857),
+        -INT32_C(  1347268566), -INT32_C(   808508416), -INT32_C(    67108865),  INT32_C(   375016154),  INT32_C(    33620160),  INT32_C(   326660003),  INT32_C(        4096), -INT32_C(   956695736) },
+      UINT16_C(35117),
+      {  INT32_C(    67244032),  INT32_C(  1140850728),  INT32_C(    58801534),  INT32_C(   444732074),  INT32_C(  2147348409), -INT32_C(    31526647),  INT32_C(   429195004), -INT32_C(  1591203621),
+        -INT32_C(   334991265),  INT32_C(   446210707), -INT32_C(  1091059713),  INT32_C(  1161041335),  INT32_C(  2139084798),  INT32_C(       65674),  INT32_C(     8414096), -INT32_C(   197899940) },
+      { -INT32_C(  1976868856),  INT32_C(           1),  INT32_C(           2),  INT32_C(    33554464), -INT32_C(   838828795),  INT32_C(   541065218),  INT32_C(       32833),  INT32_C(          28),
+         INT32_C(          40), -INT32_C(   556364970),  INT32_C(          45),  INT32_C(          27),  INT32_C(          29),  INT32_C(   961461985),  INT32_C(  1623412398), -INT32_C(   134259201) },
+      {  INT32_C(    16515052),  INT32_C(  1238763637), -INT32_C(  2130703200), -INT32_C(    86940796), -INT32_C(    18874378),  INT32_C(  2027077572),  INT32_C(   822099968),  INT32_C(  1370837857),
+         INT32_C(  1605349968), -INT32_C(   808508416), -INT32_C(    67108865), -INT32_C(  1501382942),  INT32_C(    33620160),  INT32_C(   326660003),  INT32_C(        4096), -INT32_C(   395799879) } },
+    { {  INT32_C(  2089701358), -INT32_C(   823311972),  INT32_C(  1329021883),  INT32_C(   552873001), -INT32_C(  1422626069), -INT32_C(    16781833), -INT32_C(   938057625),  INT32_C(  1601094227),
+        -INT32_C(  1458879934),  INT32_C(  1130334319),  INT32_C(    18880128), -INT32_C(    68173825),  INT32_C(   605140844),  INT32_C(  1301888570), -INT32_C(  2063580577), -INT32_C(  2140912055) },
+      UINT16_C(15590),
+      { -INT32_C(  1044372464),  INT32_C(  1210089480),  INT32_C(  1073852416), -INT32_C(  1082136451), -INT32_C(   975404605),  INT32_C(  2146435070), -INT32_C(  1153425990),  INT32_C(       19714),
+         INT32_C(  1143287046), -INT32_C(   844104682),  INT32_C(      526338), -INT32_C(   192424762),  INT32_C(   136315528), -INT32_C(   265458075), -INT32_C(   205240373),  INT32_C(        4096) },
+      { -INT32_C(  2061987154),  INT32_C(    33554436),  INT32_C(          53),  INT32_C(          56),  INT32_C(           9),  INT32_C(          60),  INT32_C(          26),  INT32_C(          24),
+        -INT32_C(   541066247), -INT32_C(    17827329),  INT32_C(          62),  INT32_C(          39), -INT32_C(   536973315), -INT32_C(       32769),  INT32_C(  2140732415), -INT32_C(   397615933) },
+      {  INT32_C(  2089701358), -INT32_C(  1930505191),  INT32_C(   226493049),  INT32_C(   552873001), -INT32_C(  1422626069), -INT32_C(    16777233), -INT32_C(   804819278),  INT32_C(     5046879),
+        -INT32_C(  1458879934),  INT32_C(  1130334319),  INT32_C(     2105352), -INT32_C(  1913135233),  INT32_C(  1090524225), -INT32_C(   530916150), -INT32_C(  2063580577), -INT32_C(  2140912055) } },
+    { {  INT32_C(   421466382), -INT32_C(        8449),  INT32_C(   822202120),  INT32_C(  1904554482), -INT32_C(   796992638),  INT32_C(  1601699835),  INT32_C(  2143222783), -INT32_C(  1756272999),
+        -INT32_C(  2113927132),  INT32_C(  1792671819), -INT32_C(    68159529), -INT32_C(  1638402649), -INT32_C(  1224965874),  INT32_C(     4719744),  INT32_C(  1879047167), -INT32_C(  1937123901) },
+      UINT16_C(29380),
+      {  INT32_C(  2145222143),  INT32_C(   274921341), -INT32_C(   863890057),  INT32_C(   139165824),  INT32_C(     8388616), -INT32_C(  2130702330), -INT32_C(   462514499), -INT32_C(      262145),
+         INT32_C(  1173845551),  INT32_C(   185559857),  INT32_C(    10781184), -INT32_C(  1082132609),  INT32_C(    67636232),  INT32_C(       19456),  INT32_C(        4097),  INT32_C(    20185096) },
+      {  INT32_C(           5),  INT32_C(   995617612),  INT32_C(     9437188), -INT32_C(    69472708),  INT32_C(          52),  INT32_C(          39),  INT32_C(          64),  INT32_C(          40),
+         INT32_C(          62),  INT32_C(          34),  INT32_C(          61),  INT32_C(          31),  INT32_C(    37814273),  INT32_C(      262144),  INT32_C(          59), -INT32_C(   788468954) },
+      {  INT32_C(   421466382), -INT32_C(        8449),  INT32_C(  1930435824),  INT32_C(  1904554482), -INT32_C(   796992638),  INT32_C(  1601699835),  INT32_C(  2143222783), -INT32_C(     6860442),
+        -INT32_C(  2113927132),  INT32_C(  1521909778), -INT32_C(    68159529), -INT32_C(  1638402649),  INT32_C(  1535000711),  INT32_C(     4719744),  INT32_C(      131117), -INT32_C(  1937123901) } },
+    { { -INT32_C(  2047984108), -INT32_C(   536913409),  INT32_C(    35653632), -INT32_C(  1642830500), -INT32_C(  1019768436),  INT32_C(  1971440718),  INT32_C(  1222585606), -INT32_C(     1130501),
+        -INT32_C(   383312366), -INT32_C(  1073742082), -INT32_C(  1010431187),  INT32_C(    75505696),  INT32_C(       65536), -INT32_C(     3424289),  INT32_C(       35716),  INT32_C(  1282611010) },
+      UINT16_C(42174),
+      {  INT32_C(   208315981),  INT32_C(   805512192), -INT32_C(        2275), -INT32_C(  2122252028), -INT32_C(   722934675), -INT32_C(  1832231264), -INT32_C(  2095234458),  INT32_C(   268566529),
+        -INT32_C(  1837201744),  INT32_C(   232339448), -INT32_C(  1943721066),  INT32_C(       38212), -INT32_C(   573079553), -INT32_C(  2147352062),  INT32_C(   841417143),  INT32_C(  1342244867) },
+      { -INT32_C(  1208484097),  INT32_C(   735519418),  INT32_C(          34),  INT32_C(          57), -INT32_C(   294558278), -INT32_C(     4246530), -INT32_C(       16385),  INT32_C(          21),
+        -INT32_C(  1526699387),  INT32_C(          54), -INT32_C(        6146), -INT32_C(  1073737520),  INT32_C(          50),  INT32_C(          27),  INT32_C(          29),  INT32_C(  2130698111) },
+      { -INT32_C(  2047984108),  INT32_C(    13172791),  INT32_C(  1082655232), -INT32_C(  1065319857),  INT32_C(   976821104),  INT32_C(  1261009537),  INT32_C(  1222585606),  INT32_C(   268439551),
+        -INT32_C(   383312366), -INT32_C(  1073742082),  INT32_C(   815050331),  INT32_C(    75505696),  INT32_C(       65536),  INT32_C(     4210783),  INT32_C(       35716), -INT32_C(  1610477562) } },
+    { {  INT32_C(   219296049),  INT32_C(   384598077),  INT32_C(    67108900), -INT32_C(  1320429678),  INT32_C(     3280896), -INT32_C(   302060641), -INT32_C(     5111813), -INT32_C(   459139887),
+        -INT32_C(  1124077571), -INT32_C(  2139613184), -INT32_C(       32801), -INT32_C(     1085457),  INT32_C(  1974609336), -INT32_C(   134748161), -INT32_C(   855868417), -INT32_C(     9184274) },
+      UINT16_C(53491),
+      { -INT32_C(  1978380916), -INT32_C(   484860656),  INT32_C(  2147450111),  INT32_C(           2), -INT32_C(  1663190710),  INT32_C(  1161348831), -INT32_C(   268699729),  INT32_C(  2078801855),
+        -INT32_C(  1419323541), -INT32_C(  1980591803),  INT32_C(    17334272), -INT32_C(   883778013),  INT32_C(      540688), -INT32_C(    17828653),  INT32_C(  1208485009), -INT32_C(   466498288) },
+      {  INT32_C(           7),  INT32_C(          37),  INT32_C(          64),  INT32_C(  1578534040),  INT32_C(   858266400),  INT32_C(          59), -INT32_C(  2080342000),  INT32_C(      657673),
+         INT32_C(          60),  INT32_C(          28), -INT32_C(        8725),  INT32_C(          54),  INT32_C(          30),  INT32_C(          40),  INT32_C(   107047988),  INT32_C(          44) },
+      {  INT32_C(   404366434), -INT32_C(  2135464959),  INT32_C(    67108900), -INT32_C(  1320429678),  INT32_C(     3280896), -INT32_C(  1491543043), -INT32_C(   139460687), -INT32_C(   537767670),
+        -INT32_C(  1124077571), -INT32_C(  2139613184), -INT32_C(       32801), -INT32_C(     1085457),  INT32_C(     2162753), -INT32_C(   134748161), -INT32_C(  2142692145), -INT32_C(   787482819) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_shrdv_epi32(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shrdv_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(11277),
+      { -INT32_C(  1539721403), -INT32_C(  1726939092),  INT32_C(  2036510231), -INT32_C(   968530962), -INT32_C(   212539720),  INT32_C(      524290),  INT32_C(   110280397),  INT32_C(   484346544),
+         INT32_C(   671533090),  INT32_C(   774772358),  INT32_C(    69206016),  INT32_C(    75447663), -INT32_C(  1090519041),  INT32_C(   361794278),  INT32_C(     1050128), -INT32_C(   521102691) },
+      {  INT32_C(    35048164), -INT32_C(  1366904118), -INT32_C(   435890447), -INT32_C(  1546622874), -INT32_C(        8241), -INT32_C(    94667581),  INT32_C(   265296087),  INT32_C(   249689531),
+         INT32_C(  2094035521),  INT32_C(  1293237001),  INT32_C(  2147416991),  INT32_C(   402916352), -INT32_C(  1169264130),  INT32_C(   991910181), -INT32_C(  1971271706), -INT32_C(   841654509) },
+      {  INT32_C(   333442686),  INT32_C(          11),  INT32_C(    67109888),  INT32_C(          42), -INT32_C(     8396812),  INT32_C(          24),  INT32_C(          43),  INT32_C(          41),
+        -INT32_C(  1360003145),  INT32_C(          15), -INT32_C(   268865665),  INT32_C(      163968),  INT32_C(  2145984825),  INT32_C(     4325632), -INT32_C(   637050717), -INT32_C(   226128069) },
+      {  INT32_C(   140192658),  INT32_C(           0),  INT32_C(  2036510231),  INT32_C(   431067480),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(      133314),  INT32_C(    75447663),  INT32_C(           0),  INT32_C(   361794278),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(27761),
+      { -INT32_C(   724771782),  INT32_C(  1476919298),  INT32_C(    42201598), -INT32_C(           1),  INT32_C(          33), -INT32_C(  1206840546), -INT32_C(   671187141), -INT32_C(  1275846397),
+         INT32_C(  1630351262), -INT32_C(   590522795),  INT32_C(  1860879312),  INT32_C(  1738151541), -INT32_C(    20971521),  INT32_C(   537403520),  INT32_C(  1207959554), -INT32_C(     4227089) },
+      { -INT32_C(    38922217), -INT32_C(     8425473),  INT32_C(  1824618186), -INT32_C(  1301570537), -INT32_C(  1217506910), -INT32_C(   134285313),  INT32_C(   810272618), -INT32_C(  1677721604),
+        -INT32_C(   822210384),  INT32_C(   285212672),  INT32_C(   137633792), -INT32_C(  1782375268),  INT32_C(   719800443), -INT32_C(     4202577), -INT32_C(  2096138923),  INT32_C(  2130102318) },
+      {  INT32_C(          27),  INT32_C(           3),  INT32_C(          28),  INT32_C(          27),  INT32_C(  1084227712),  INT32_C(   285213200),  INT32_C(          55),  INT32_C(          40),
+         INT32_C(    33554692), -INT32_C(   153908382),  INT32_C(   218105888),  INT32_C(          56),  INT32_C(          19),  INT32_C(        8224),  INT32_C(          39), -INT32_C(  1645267223) },
+      { -INT32_C(  1245510918),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          33), -INT32_C(   134236143), -INT32_C(  1752246865),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  1860879312), -INT32_C(  1021535129),  INT32_C(           0),  INT32_C(   537403520), -INT32_C(  1433403392),  INT32_C(           0) } },
+    { UINT16_C(27583),
+      {  INT32_C(  2082501580), -INT32_C(     1572881),  INT32_C(      524290), -INT32_C(     5246978),  INT32_C(   538972160),  INT32_C(  2114124009),  INT32_C(   600212499),  INT32_C(   165476800),
+        -INT32_C(     8390673), -INT32_C(  1082134529), -INT32_C(    84934692), -INT32_C(  1548600425), -INT32_C(   674228783), -INT32_C(    16777217), -INT32_C(  1596411242),  INT32_C(   138674176) },
+      { -INT32_C(    67633165),  INT32_C(   444876438), -INT32_C(   398930936),  INT32_C(   127899901), -INT32_C(          41), -INT32_C(   529925839), -INT32_C(   134482433), -INT32_C(   570441729),
+         INT32_C(   134610954), -INT32_C(      131665), -INT32_C(   661258759), -INT32_C(    68177945),  INT32_C(   763794882),  INT32_C(  1079116032), -INT32_C(    67108961), -INT32_C(   620838913) },
+      {  INT32_C(          34),  INT32_C(          57),  INT32_C(           2),  INT32_C(          54),  INT32_C(  2147449855),  INT32_C(   995697054), -INT32_C(   539230213),  INT32_C(          30),
+         INT32_C(   333996074), -INT32_C(    27328545),  INT32_C(          59),  INT32_C(           0),  INT32_C(   734769710),  INT32_C(      131589),  INT32_C(          29),  INT32_C(           3) },
+      { -INT32_C(   553116429),  INT32_C(  1109609343),  INT32_C(      131072),  INT32_C(  2120480766), -INT32_C(          82), -INT32_C(  2119703355),  INT32_C(           0),  INT32_C(  2013200380),
+         INT32_C(    46129149), -INT32_C(      263329),  INT32_C(           0), -INT32_C(  1548600425),  INT32_C(           0),  INT32_C(   133693439), -INT32_C(   536871683),  INT32_C(           0) } },
+    { UINT16_C(49259),
+      {  INT32_C(   872517093), -INT32_C(    34735626),  INT32_C(     2097184),  INT32_C(   123972970), -INT32_C(   119039484),  INT32_C(  2044877924),  INT32_C(  2055707114),  INT32_C(   110100610),
+         INT32_C(     3178624), -INT32_C(    58983537), -INT32_C(  1242562564), -INT32_C(    67108865),  INT32_C(   485303816), -INT32_C(    67109386),  INT32_C(     8699912), -INT32_C(    18879041) },
+      {  INT32_C(  1207975941), -INT32_C(   847251943),  INT32_C(       12353), -INT32_C(  2051211875),  INT32_C(    69211137), -INT32_C(  1833469480),  INT32_C(   663712322),  INT32_C(   759716722),
+         INT32_C(   524460789),  INT32_C(   818913470), -INT32_C(  1142956033), -INT32_C(   301990145), -INT32_C(  1395921147),  INT32_C(  2147401023), -INT32_C(      139553), -INT32_C(  1476395008) },
+      {  INT32_C(  2141156400),  INT32_C(          61),  INT32_C(           9), -INT32_C(  2065078563),  INT32_C(          52), -INT32_C(  1715872259),  INT32_C(  1465037372), -INT32_C(  1651374274),
+        -INT32_C(  1178249605), -INT32_C(  1567293547), -INT32_C(     2359297), -INT32_C(  1879031680),  INT32_C(   536870913),  INT32_C(           7),  INT32_C(  2142339859),  INT32_C(          34) },
+      {  INT32_C(  1074082817),  INT32_C(  1811919055),  INT32_C(           0),  INT32_C(   770174184),  INT32_C(           0), -INT32_C(  1782853949),  INT32_C(  2029462567),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1143218160),  INT32_C(  1069022063) } },
+    { UINT16_C(31493),
+      { -INT32_C(   377734566), -INT32_C(     4325417), -INT32_C(   919284281),  INT32_C(  1505115324),  INT32_C(  2067361392), -INT32_C(   294841330),  INT32_C(   270074882), -INT32_C(   537395241),
+         INT32_C(        2129), -INT32_C(   536895489), -INT32_C(  1704197297),  INT32_C(         160),  INT32_C(  1299604698),  INT32_C(  1337713964),  INT32_C(  1335776518), -INT32_C(  1476328447) },
+      { -INT32_C(   273162245), -INT32_C(  1285271304),  INT32_C(   849482473), -INT32_C(       32771),  INT32_C(  1670062219),  INT32_C(  1531658693),  INT32_C(    93893104), -INT32_C(  1448586304),
+        -INT32_C(  1302088299),  INT32_C(   155839213),  INT32_C(     8658962), -INT32_C(   579391816),  INT32_C(  2122317819),  INT32_C(  1365734591), -INT32_C(     2097153),  INT32_C(  1861573355) },
+      {  INT32_C(   900867885),  INT32_C(           3),  INT32_C(          30),  INT32_C(          63),  INT32_C(           9),  INT32_C(          39),  INT32_C(          44), -INT32_C(   270008459),
+         INT32_C(   134217730),  INT32_C(        4176), -INT32_C(   335546373),  INT32_C(   196444833),  INT32_C(  2128605183),  INT32_C(          20),  INT32_C(           0), -INT32_C(    10617125) },
+      { -INT32_C(     2143263),  INT32_C(           0), -INT32_C(   897037401),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  1073742356), -INT32_C(   353509377),  INT32_C(           0),  INT32_C(          80), -INT32_C(    50331658),  INT32_C(  2001466619),  INT32_C(  1335776518),  INT32_C(           0) } },
+    { UINT16_C(16144),
+      { -INT32_C(   135266309),  INT32_C(  1610612447), -INT32_C(  1659111019), -INT32_C(    50463305),  INT32_C(         128),  INT32_C(     8544258),  INT32_C(    33587584), -INT32_C(  1555308649),
+         INT32_C(  1720300290),  INT32_C(    19401024), -INT32_C(  1388039499),  INT32_C(  1598824633), -INT32_C(  1665256174),  INT32_C(      786720),  INT32_C(   572522496),  INT32_C(   528163098) },
+      {  INT32_C(   423452762), -INT32_C(  1174405125), -INT32_C(     8405001),  INT32_C(   646526906), -INT32_C(   343933217),  INT32_C(  2147479551), -INT32_C(  1714464860), -INT32_C(     1081349),
+         INT32_C(  2011705411),  INT32_C(       65676), -INT32_C(    19416065),  INT32_C(   138412114),  INT32_C(   100737152),  INT32_C(   617499415), -INT32_C(  1995238263), -INT32_C(   169115649) },
+      {  INT32_C(  2147445735),  INT32_C(    16777216),  INT32_C(           9), -INT32_C(  1666633355),  INT32_C(           7),  INT32_C(          42),  INT32_C(          31),  INT32_C(          19),
+         INT32_C(        3634),  INT32_C(          10), -INT32_C(          69), -INT32_C(   606274561),  INT32_C(          43),  INT32_C(          25),  INT32_C(          54),  INT32_C(          44) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1107296255),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   202430882),  INT32_C(   587221506), -INT32_C(   621314059),  INT32_C(   276824228),  INT32_C(   269719494),  INT32_C(  1730513792),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(  484),
+      { -INT32_C(         513), -INT32_C(  2080374784), -INT32_C(   134217761),  INT32_C(  1638833024),  INT32_C(   510643413), -INT32_C(    16793601),  INT32_C(    14745605), -INT32_C(           3),
+         INT32_C(   744055440),  INT32_C(     8389632), -INT32_C(   767760049),  INT32_C(  1610612773),  INT32_C(  2047731616),  INT32_C(  1355673871),  INT32_C(   448320328), -INT32_C(    86317057) },
+      {  INT32_C(  2025665706), -INT32_C(  1416931614),  INT32_C(   872456384),  INT32_C(  1224648007), -INT32_C(   499151625), -INT32_C(   933715318),  INT32_C(       40960),  INT32_C(  2120100932),
+        -INT32_C(       73729), -INT32_C(   173045531),  INT32_C(        4356),  INT32_C(  1256495936), -INT32_C(    50902024), -INT32_C(     3146883),  INT32_C(  1992937760),  INT32_C(   527861896) },
+      {  INT32_C(          42), -INT32_C(        2051),  INT32_C(          20),  INT32_C(          45),  INT32_C(          18), -INT32_C(  1209028625),  INT32_C(          64),  INT32_C(          43),
+         INT32_C(          54),  INT32_C(          46),  INT32_C(          22),  INT32_C(           6), -INT32_C(      655361),  INT32_C(    16777730),  INT32_C(          58),  INT32_C(           5) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   168562559),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1159069183),  INT32_C(    14745605), -INT32_C(  2002780161),
+        -INT32_C(    75498319),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(51140),
+      {  INT32_C(  2146404420),  INT32_C(   820134889), -INT32_C(  1773911235), -INT32_C(    16777219), -INT32_C(  1082130497),  INT32_C(   909940120), -INT32_C(  2147481536), -INT32_C(  1436440237),
+         INT32_C(  1210056776), -INT32_C(   559440489), -INT32_C(   569624029), -INT32_C(     3162117),  INT32_C(  1610612670), -INT32_C(   925141811),  INT32_C(   101073036),  INT32_C(  1492319745) },
+      {  INT32_C(   836669250), -INT32_C(   331718349), -INT32_C(    33554561),  INT32_C(      524288),  INT32_C(   134217728),  INT32_C(     1052673), -INT32_C(         513), -INT32_C(   534959341),
+         INT32_C(    35651585),  INT32_C(  1407699612), -INT32_C(   473298011), -INT32_C(   536870913),  INT32_C(          64), -INT32_C(  1141423268), -INT32_C(     4195329), -INT32_C(   366693967) },
+      {  INT32_C(          46),  INT32_C(          58),  INT32_C(  1782824111), -INT32_C(   207135027), -INT32_C(  2113895934),  INT32_C(           5),  INT32_C(          58),  INT32_C(          51),
+         INT32_C(          49),  INT32_C(          60),  INT32_C(          29), -INT32_C(        1345), -INT32_C(   139468813),  INT32_C(          51),  INT32_C(          49),  INT32_C(          53) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(    16831352),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(       32800), -INT32_C(  1520274100),
+         INT32_C(       42000),  INT32_C(  1048357325),  INT32_C(   508583214),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    33586429),  INT32_C(   630033095) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_shrdv_epi32(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 7089400756470145811), -INT64_C( 2934551874793509626), -INT64_C(     647754084794453), -INT64_C( 1152922058926063681),
+        -INT64_C(   82243470932134081), -INT64_C( 1588156739969027943),  INT64_C( 7116244868583918107),  INT64_C(  306244778956293128) },
+      {  INT64_C( 2159312055042309924),  INT64_C( 3325485035140240016),  INT64_C( 9136535532294363746), -INT64_C( 5844244186750285908),
+        -INT64_C(    3412884092616721),  INT64_C(   54751285311963144),  INT64_C( 1608099747689809759),  INT64_C( 1441717201538138248) },
+      {  INT64_C(                  53),  INT64_C(  602688438759412782),  INT64_C(                  97), -INT64_C(  642961395242503371),
+        -INT64_C( 8642407684917688304),  INT64_C( 8027099103443771462), -INT64_C(       8933666258953),  INT64_C(                  42) },
+      { -INT64_C( 4947488963641662228), -INT64_C(  282383562911294183),  INT64_C( 6922574899101751663),  INT64_C( 2924809372913461119),
+        -INT64_C(    4504854563145218),  INT64_C( 2569258436303389634), -INT64_C( 6756412499747225915), -INT64_C( 8502778434999480320) } },
+    { { -INT64_C( 4375396755466641891), -INT64_C( 6673323010805780513), -INT64_C( 2669649417685960737),  INT64_C( 6667248115803414097),
+        -INT64_C( 2887793625222086794),  INT64_C( 2896001270178805594),  INT64_C( 1781161481595798624),  INT64_C( 8545315618026033659) },
+      {  INT64_C( 1225262222889058304), -INT64_C(     281887562039809), -INT64_C(    5066558246256897),  INT64_C( 8607565134204561559),
+        -INT64_C( 1870089894141272140),  INT64_C(     281477132648993), -INT64_C( 4632841983505182973),  INT64_C(   18014398519972096) },
+      {  INT64_C( 3711703844826850136),  INT64_C( 1039516892645869125),  INT64_C(                  75),  INT64_C(                 125),
+         INT64_C( 2222230299889441465),  INT64_C(                  43),  INT64_C(                  78),  INT64_C(   72066424767824384) },
+      {  INT64_C(  144116026793514287), -INT64_C(  208541344087680642), -INT64_C( 2307146548968423426), -INT64_C( 4926455221201713990),
+         INT64_C(  436166508141337195),  INT64_C(    4521330395645461),  INT64_C( 4326942055465539713),  INT64_C( 8545315618026033659) } },
+    { {  INT64_C( 5787728629085432772), -INT64_C( 2305843558969508865),  INT64_C( 5513394823775436891), -INT64_C(      37422050591301),
+        -INT64_C( 7049332106718326651), -INT64_C( 2408069562112084143), -INT64_C( 6579376566098314340), -INT64_C( 9115875561666158744) },
+      { -INT64_C(      17592477548546),  INT64_C(  915510214670993455),  INT64_C( 1441231268935788672),  INT64_C(    7353826109554706),
+        -INT64_C( 7665239982736306631), -INT64_C(  636613408522368525),  INT64_C(    9024862309363714),  INT64_C( 4425779343525399618) },
+      {  INT64_C(                   8),  INT64_C(                 112),  INT64_C(                  28),  INT64_C(                  84),
+         INT64_C( 4611967497699065864), -INT64_C(      79164854239361),  INT64_C(                 129),  INT64_C(                  13) },
+      { -INT64_C(  121506873118490901), -INT64_C( 8381043098944282625),  INT64_C(  118931994292270616),  INT64_C(     334251499155455),
+         INT64_C( 4151804000657951824), -INT64_C( 1273226817044737049),  INT64_C( 5933683753805618638),  INT64_C( 7067286837379469770) } },
+    { {  INT64_C( 8495308450039879941),  INT64_C( 2198914896261804277),  INT64_C(  655161545441145093), -INT64_C(    4504742099157250),
+        -INT64_C( 4789571297175111175),  INT64_C( 1315059887323021314), -INT64_C(      70923065753697),  INT64_C( 4826450354698872728) },
+      { -INT64_C(   18015498038968449),  INT64_C( 4164397131967717030), -INT64_C( 1369094286737409153), -INT64_C(      40149354815745),
+         INT64_C( 4617405677991103520),  INT64_C( 3124417218886613688),  INT64_C(     158883861496960),  INT64_C( 4602678750184701951) },
+      {  INT64_C( 2326127114094379008),  INT64_C(                  81),  INT64_C(                  25),  INT64_C(                 101),
+         INT64_C(                   0),  INT64_C(                  55), -INT64_C( 4967089170116137189), -INT64_C(            76087301) },
+      {  INT64_C( 8495308450039879941), -INT64_C( 5813285917615894145),  INT64_C( 9222738187926698537), -INT64_C( 2305914511829270537),
+        -INT64_C( 4789571297175111175), -INT64_C( 5165118342784782300),  INT64_C(  288388843264536541), -INT64_C(  288232583765950488) } },
+    { {  INT64_C( 7943675215951606938), -INT64_C( 8939752312928218928), -INT64_C( 6528279338758901210),  INT64_C( 3029024944752560145),
+         INT64_C( 1133867038937577153), -INT64_C( 8718846442535901150),  INT64_C(   76983440492199936), -INT64_C( 4597624844228146568) },
+      { -INT64_C(  289497014645817410), -INT64_C( 9205357603704504179),  INT64_C( 4793103573130829209), -INT64_C( 6229604154021511104),
+         INT64_C(  432627108192231620), -INT64_C( 1741156684859443776), -INT64_C( 1171578056566243329), -INT64_C(   18023340715335681) },
+      {  INT64_C(                  16), -INT64_C( 1925184108701307546), -INT64_C(   22870494698012673),  INT64_C( 4193925822008962018),
+         INT64_C(                   9), -INT64_C( 5840664070435564528),  INT64_C(                  38),  INT64_C(                  69) },
+      { -INT64_C(   18456137598402082),  INT64_C( 2324704041173499514), -INT64_C( 8860536927447893197), -INT64_C( 4102779191638732664),
+         INT64_C( 7063858799777362683), -INT64_C(  738441902950785672), -INT64_C( 2594381248688011776), -INT64_C(  143675776382129581) } },
+    { {  INT64_C( 1154188211845628928), -INT64_C( 2315413433299812689),  INT64_C(   36031004632187648),  INT64_C(        549755879472),
+        -INT64_C( 2150971289955351968),  INT64_C( 1188950310216335488), -INT64_C( 8855969130325796624),  INT64_C( 8701271892148197988) },
+      {  INT64_C(      70918510839828),  INT64_C( 3270166331352328984),  INT64_C(   38281713541056832),  INT64_C(   38355501063348224),
+        -INT64_C( 3739031127487143465), -INT64_C( 9220137163407809320),  INT64_C(  108262330097223680),  INT64_C( 4277515369328926918) },
+      {  INT64_C( 1152921504942393344),  INT64_C(                  18),  INT64_C(                   7), -INT64_C(   72057802343841795),
+         INT64_C(                  67),  INT64_C( 4459855004373318629),  INT64_C(                 113), -INT64_C( 6755238912257425408) },
+      {  INT64_C( 1154188211845628928), -INT64_C( 6141159505730207745), -INT64_C( 9223090544631086842),  INT64_C(  306844008506785792),
+        -INT64_C(  268871411244418996), -INT64_C( 3650843531196235776),  INT64_C( 5765170473591653004),  INT64_C( 8701271892148197988) } },
+    { { -INT64_C(    2674029463347201),  INT64_C(  901353278801969152),  INT64_C(  216172799293718528),  INT64_C( 6707567546194434849),
+        -INT64_C( 3986334423395909088),  INT64_C( 7979021659978255216), -INT64_C(         34393293833),  INT64_C( 3443077630911747444) },
+      {  INT64_C(   91760844564218896),  INT64_C( 1893772441550858626),  INT64_C( 4160790960124850493),  INT64_C( 7908406359148410968),
+         INT64_C( 2570914027373924723), -INT64_C(    9044591242182657),  INT64_C( 4611615572100628479),  INT64_C( 8645728209553194879) },
+      {  INT64_C(                  26),  INT64_C(                  35),  INT64_C(                 118), -INT64_C( 2910511083447731570),
+         INT64_C( 1414206509454453571),  INT64_C(                   0),  INT64_C( 4552715544302065880),  INT64_C(    4802666806911504) },
+      {  INT64_C( 2490776741797166847),  INT64_C( 1153490159376812033), -INT64_C(  547937859059518452), -INT64_C( 2206354419978303634),
+         INT64_C( 8725080233930287172),  INT64_C( 7979021659978255216), -INT64_C( 5206161169240295427), -INT64_C(   36257734800378730) } },
+    { {  INT64_C(  144257299987882048),  INT64_C( 1147239707591822929), -INT64_C(         10871718401), -INT64_C( 8936965219084294285),
+         INT64_C(   27761009462160879), -INT64_C( 1108124904306170783),  INT64_C( 4584678096179760899), -INT64_C(   19140298559029249) },
+      { -INT64_C( 1900170033636942473), -INT64_C( 8128367630110702489),  INT64_C( 7429176790390541580), -INT64_C(  293305722095206401),
+        -INT64_C( 3600341856151418054), -INT64_C( 7844799515818677291),  INT64_C(     281475043847168), -INT64_C( 2556345960280143453) },
+      {  INT64_C(                 117),  INT64_C(                   9),  INT64_C(                  89),  INT64_C(                  66),
+        -INT64_C( 1242995971055526017),  INT64_C(                  65),  INT64_C( 6781477452548917116), -INT64_C(  757238056179793985) },
+      {  INT64_C(  714770664257206288),  INT64_C( 3713206795507178983),  INT64_C( 7423768920080776891), -INT64_C( 2234241304771073572),
+        -INT64_C( 7200683712302836108), -INT64_C(  554062452153085392),  INT64_C(    4503600701554691), -INT64_C( 5112691920560286905) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_shrdv_epi64(a, b, c);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const simde__mmask8 k;
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 5206389867799380496),  INT64_C(   36679707936163173), -INT64_C(  576471748497637379),  INT64_C( 2603085008482598917),
+        -INT64_C( 7859251831863307531), -INT64_C(  585503135930307843), -INT64_C(    1126202723008531), -INT64_C(  144115206481510913) },
+      UINT8_C( 67),
+      { -INT64_C( 1152923712321257489),  INT64_C( 3202864944379688422), -INT64_C( 4360949687135502837), -INT64_C(  297238140194652213),
+        -INT64_C(       1109510935041), -INT64_C(  293895077793628321),  INT64_C( 3052045382718823420), -INT64_C( 1388066047942903966) },
+      {  INT64_C(                   5),  INT64_C( 4611783325206708736), -INT64_C( 8876732294395988288), -INT64_C( 1227802663901462531),
+        -INT64_C(   18598583890755585),  INT64_C(         34426850314), -INT64_C( 8928929338713119359), -INT64_C(  613669325302141107) },
+      {  INT64_C( 8809610967920082960),  INT64_C(   36679707936163173), -INT64_C(  576471748497637379),  INT64_C( 2603085008482598917),
+        -INT64_C( 7859251831863307531), -INT64_C(  585503135930307843),  INT64_C( 9222808935493271542), -INT64_C(  144115206481510913) } },
+    { { -INT64_C(   21463841901773825), -INT64_C( 1775051574062940161),  INT64_C( 5736736816751149592),  INT64_C( 8217131773482488334),
+        -INT64_C( 4611560264761403962), -INT64_C( 4987623299876272180),  INT64_C( 2992603070866413515),  INT64_C( 8370910595624230024) },
+      UINT8_C(100),
+      {  INT64_C(  286588122188568427), -INT64_C( 6917537825883684865), -INT64_C(                   3), -INT64_C(  146472558454114305),
+        -INT64_C( 8688764416905560602),  INT64_C( 3876719490891351465), -INT64_C( 5293261715080932066),  INT64_C( 4611967772614722560) },
+      { -INT64_C(   72620621301153811),  INT64_C(                 105),  INT64_C(                  11), -INT64_C(  144116289889141057),
+         INT64_C( 4440528177333223847),  INT64_C(                  11), -INT64_C( 3527894657972045016), -INT64_C( 5429924544577444941) },
+      { -INT64_C(   21463841901773825), -INT64_C( 1775051574062940161), -INT64_C(   24220456740418704),  INT64_C( 8217131773482488334),
+        -INT64_C( 4611560264761403962), -INT64_C( 5388740517274505928), -INT64_C( 8945999247327000612),  INT64_C( 8370910595624230024) } },
+    { { -INT64_C( 7493426828778929663),  INT64_C( 3963591780190477861), -INT64_C( 6955437395586550672),  INT64_C(  650779062511468544),
+         INT64_C( 7740211579780298992),  INT64_C( 6917529028447698952),  INT64_C( 8930620468822523631), -INT64_C(  307397337834061970) },
+      UINT8_C( 90),
+      { -INT64_C(     140746355245066),  INT64_C(   18014399583233032),  INT64_C(  594554350043935113),  INT64_C(   40743511468802432),
+         INT64_C( 9223371726404976382),  INT64_C( 6883131439747648935), -INT64_C( 8070169057237663736),  INT64_C(   73189026131148848) },
+      {  INT64_C(                  86),  INT64_C( 6215196143274081155), -INT64_C(  433754176598573089), -INT64_C( 6879976797675197216),
+         INT64_C(                  15),  INT64_C(                 128),  INT64_C(    2325329856238086), -INT64_C( 8244305051135712411) },
+      { -INT64_C( 7493426828778929663),  INT64_C(  495448972523809732), -INT64_C( 6955437395586550672),  INT64_C(       1649418962972),
+        -INT64_C(  145004875471108522),  INT64_C( 6917529028447698952),  INT64_C( 2445383954039045883), -INT64_C(  307397337834061970) } },
+    { { -INT64_C( 9223090561609498488), -INT64_C(    5916197736423491),  INT64_C( 1301681046991937808), -INT64_C(     140737756924421),
+        -INT64_C(  648943900342235649),  INT64_C( 6005011540224231472), -INT64_C( 2951803269475628011), -INT64_C(  991150044139283616) },
+      UINT8_C(114),
+      { -INT64_C( 4902172592439296553), -INT64_C( 1154047406124302597),  INT64_C( 2010426571921046108),  INT64_C( 6480837961384378557),
+         INT64_C(       1168265184000), -INT64_C( 6856975442435318227), -INT64_C( 1154047679418990657), -INT64_C( 5993989384686790299) },
+      {  INT64_C(                  54), -INT64_C( 2377906109399695961),  INT64_C( 8578502251892623284),  INT64_C(                   4),
+         INT64_C(   20301382695256192),  INT64_C(                  52),  INT64_C(                 127),  INT64_C(                   6) },
+      { -INT64_C( 9223090561609498488), -INT64_C(   54043204252609034),  INT64_C( 1301681046991937808), -INT64_C(     140737756924421),
+        -INT64_C(  648943900342235649),  INT64_C( 8219812044583654709), -INT64_C( 2308095358837981313), -INT64_C(  991150044139283616) } },
+    { {  INT64_C( 9025972817323776470), -INT64_C( 7206885579787599873), -INT64_C(     563224831402009), -INT64_C(   36591746972451841),
+        -INT64_C( 7871073448172658364), -INT64_C( 3426949748669556975), -INT64_C( 1745281513697663650),  INT64_C(  644016395981431044) },
+      UINT8_C(249),
+      {  INT64_C(  576465150350003200),  INT64_C( 9064959812398972933),  INT64_C( 8610108504915933415),  INT64_C( 6253925318819664582),
+        -INT64_C(  293297066929766405),  INT64_C( 7950804882490251478),  INT64_C( 5149567714974117117),  INT64_C( 5832303783811171006) },
+      {  INT64_C(                   6),  INT64_C(                  58),  INT64_C(    1126005674606977), -INT64_C(  582099322808828161),
+         INT64_C( 2506579007822654849),  INT64_C(                  79),  INT64_C(                  53), -INT64_C(      72568887578753) },
+      {  INT64_C(  141030825270684007), -INT64_C( 7206885579787599873), -INT64_C(     563224831402009), -INT64_C( 5938893436070222451),
+        -INT64_C( 3935536724086329182), -INT64_C( 5643677865255338273), -INT64_C( 5222929894871666882), -INT64_C( 6782136506087209604) } },
+    { { -INT64_C(      46183867289633), -INT64_C( 1152921513197862913), -INT64_C( 3298484452958792669), -INT64_C( 1225019785004187653),
+         INT64_C( 2760255772875827628), -INT64_C( 4467535619133716480), -INT64_C( 2900323657588934922), -INT64_C( 1930699438647626169) },
+      UINT8_C(190),
+      { -INT64_C( 4611686022806388761), -INT64_C( 2308165177826811937), -INT64_C( 5277712490708408270),  INT64_C(    9033725510451712),
+        -INT64_C( 6924396269811650488), -INT64_C( 4614254752467927105), -INT64_C( 1905525264488249708),  INT64_C( 9071211221176977123) },
+      { -INT64_C( 5291870985147316574),  INT64_C(                  51),  INT64_C(                  90),  INT64_C(                   2),
+        -INT64_C( 1785054330370852778),  INT64_C(    1129275751137280),  INT64_C(                  69),  INT64_C(                  15) },
+      { -INT64_C(      46183867289633), -INT64_C(  576461204952973825),  INT64_C( 3150844858921088879),  INT64_C( 4305431072176340990),
+         INT64_C( 6395428788311163133), -INT64_C( 4467535619133716480), -INT64_C( 2900323657588934922),  INT64_C(  992984797564239545) } },
+    { {  INT64_C(   40637955131310080),  INT64_C( 1162775396585832552), -INT64_C(  630521677456867601),  INT64_C( 1450737900174641616),
+         INT64_C( 5478629015433003072),  INT64_C( 3092198388136481390),  INT64_C(      17596514834433), -INT64_C(   17874264568748747) },
+      UINT8_C(189),
+      { -INT64_C( 3231986114126230459), -INT64_C( 3091567540877803229),  INT64_C(  146366988243992576),  INT64_C( 4247785204253473779),
+        -INT64_C(  585503155261801985), -INT64_C( 5319350783526196515), -INT64_C(  144133879840704005), -INT64_C(  734087289017764161) },
+      { -INT64_C( 6926817839312535553),  INT64_C( 8086046260468202856),  INT64_C( 8678493109543424127), -INT64_C( 2305852355096101131),
+        -INT64_C( 6078859911773799919), -INT64_C(  144132918778795009),  INT64_C(                  47),  INT64_C(   36592023058913920) },
+      { -INT64_C( 6463972228252460918),  INT64_C( 1162775396585832552),  INT64_C(  292733976487985153), -INT64_C( 7399104479794063199),
+        -INT64_C(  216271720979890044),  INT64_C( 7808042506657158586),  INT64_C(      17596514834433), -INT64_C(   17874264568748747) } },
+    { { -INT64_C(  153122404578426881),  INT64_C(     562962846714018),  INT64_C(  198211181637535236), -INT64_C( 6820882502487266640),
+         INT64_C(   41693551801663724), -INT64_C(  144115188075860499), -INT64_C( 5906244152659470243), -INT64_C(      36296902852929) },
+      UINT8_C( 80),
+      { -INT64_C( 5115183030923411238),  INT64_C( 9222509985177526271),  INT64_C(  576462985820635136), -INT64_C( 1765983049083797767),
+         INT64_C( 6165620634562273634), -INT64_C( 5989534079012471542), -INT64_C( 7039200377977994423), -INT64_C( 3461018547033997317) },
+      { -INT64_C( 3493077499542935675), -INT64_C( 2045944567158073074),  INT64_C(                  90), -INT64_C( 8413680989109338015),
+         INT64_C(                  23),  INT64_C(                 106),  INT64_C(                  26),  INT64_C(                  12) },
+      { -INT64_C(  153122404578426881),  INT64_C(     562962846714018),  INT64_C(  198211181637535236), -INT64_C( 6820882502487266640),
+        -INT64_C( 3584086844184190719), -INT64_C(  144115188075860499), -INT64_C(  801409374484197609), -INT64_C(      36296902852929) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_shrdv_epi64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shrdv_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 25),
+      {  INT64_C( 4008152819826622759),  INT64_C( 7594724478103783896),  INT64_C( 4613937818408878336),  INT64_C( 1457751557507809140),
+        -INT64_C( 8899042443375017984), -INT64_C( 5188217414487114242), -INT64_C(   72059793218469921), -INT64_C( 8788225108292622256) },
+      {  INT64_C(  585468785092215296), -INT64_C( 2229281802658707438), -INT64_C( 6221746126018266770), -INT64_C(    9007474669527042),
+        -INT64_C(      27041659357700), -INT64_C( 2324983582541482017),  INT64_C( 6907026774866098496), -INT64_C(  594477355207557122) },
+      {  INT64_C(  144115325540140288), -INT64_C( 5549560640894533633), -INT64_C( 2612092353720092677),  INT64_C(                  62),
+        -INT64_C(  199012093213056034),  INT64_C( 3458764513821197312),  INT64_C( 8126680920391518481),  INT64_C(                  61) },
+      {  INT64_C( 4008152819826622759),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(   36029898678108168),
+         INT64_C( 9079212808486322224),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(215),
+      { -INT64_C(  648659083873779714), -INT64_C( 1152921504616022025), -INT64_C( 2599711750282805249),  INT64_C(   77827839918866434),
+         INT64_C( 4631389547513511936),  INT64_C(  293047529018286185),  INT64_C(  304133715020237064),  INT64_C(   36028835845637136) },
+      { -INT64_C(    9147946809974849),  INT64_C( 9222246134514155503),  INT64_C( 2305843012605329409),  INT64_C(     141150409752832),
+         INT64_C(    9042401008419392),  INT64_C( 3525446311315932446),  INT64_C(  960638569827749116), -INT64_C( 3288278485518803556) },
+      { -INT64_C( 2414694163117718645),  INT64_C(                  48),  INT64_C(                  85),  INT64_C(                  56),
+        -INT64_C(    1126048319684641),  INT64_C(                 101), -INT64_C( 2370771322867857706), -INT64_C( 8913340265954495302) },
+      { -INT64_C(  576777480371721233), -INT64_C(     159500054040577),  INT64_C( 4755817559050125039),  INT64_C(                   0),
+         INT64_C( 1732764906589782146),  INT64_C(                   0),  INT64_C( 9021818433855029888), -INT64_C( 7535638262398359808) } },
+    { UINT8_C( 78),
+      {  INT64_C(  113012216034660352), -INT64_C( 6949290513062879365), -INT64_C(   10344240291985667),  INT64_C(  295185642374426100),
+        -INT64_C( 1053956936865810424),  INT64_C( 2051046078477021289),  INT64_C(  855186049224845514),  INT64_C(    3452468927137792) },
+      {  INT64_C(     281475113812000),  INT64_C( 4611113170936791039),  INT64_C( 2308104155949957120),  INT64_C( 6868138902844904809),
+         INT64_C(  594514771902990336), -INT64_C(   84055952799342518),  INT64_C( 3619401640325923544),  INT64_C( 8077305407951249859) },
+      { -INT64_C( 6577662881278394889),  INT64_C(                 128), -INT64_C(   18377306200872994),  INT64_C(                  30),
+         INT64_C(                 105),  INT64_C( 7446903980251900287), -INT64_C( 5260770162304360993),  INT64_C(                   5) },
+      {  INT64_C(                   0), -INT64_C( 6949290513062879365),  INT64_C(         17170235359), -INT64_C( 3426582203337615588),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2175104136402204252),  INT64_C(                   0) } },
+    { UINT8_C(113),
+      { -INT64_C( 6644597983184230074), -INT64_C(    2621235790350593), -INT64_C(  578712561264889889), -INT64_C(   72075195351908353),
+         INT64_C( 6027856149635463316),  INT64_C( 7490374742840004341), -INT64_C( 2310351557013307553),  INT64_C( 7742264088841841052) },
+      {  INT64_C( 4612814119505035264),  INT64_C( 8622952009012415291),  INT64_C(   54043213043859648),  INT64_C(    1147894434791424),
+         INT64_C(   72163216008806916),  INT64_C(   38281146722943236),  INT64_C(  144186106645089288),  INT64_C( 2819583883186165071) },
+      {  INT64_C( 3635174287753640450), -INT64_C(      26388379731137), -INT64_C(  498372214729751632),  INT64_C(                  17),
+         INT64_C(                 106), -INT64_C( 1168121187708961890),  INT64_C(    9042521074712578),  INT64_C(                   4) },
+      {  INT64_C( 2950536522631330385),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(  288797176561461711),  INT64_C( 2310351082583007378),  INT64_C( 4034098129174061015),  INT64_C(                   0) } },
+    { UINT8_C(246),
+      { -INT64_C( 2261087004739835509), -INT64_C( 6241945102936047520),  INT64_C(   36068413799270528), -INT64_C(  289356362008231937),
+         INT64_C( 7395622591916595411),  INT64_C(  288231063952588812),  INT64_C(    1302932150616064), -INT64_C( 4611263805861362943) },
+      {  INT64_C( 7772716656763704962),  INT64_C(      17603133184384),  INT64_C( 8725878720508487909),  INT64_C( 5729487689284638660),
+         INT64_C( 6502435554465302722),  INT64_C( 2346410870546432512), -INT64_C( 2593644604874872624), -INT64_C(    4538922516357121) },
+      {  INT64_C(                   5),  INT64_C( 1625133885624349544),  INT64_C(                  82),  INT64_C(   72339208601075716),
+         INT64_C(                 101),  INT64_C(                 116), -INT64_C( 9151314442816847736),  INT64_C(                  78) },
+      {  INT64_C(                   0),  INT64_C(  183662531836469288),  INT64_C( 1889612024992890887),  INT64_C(                   0),
+         INT64_C( 8914367788977820732),  INT64_C(  145263355511177280), -INT64_C( 3458759424241827584),  INT64_C( 9223090587647875090) } },
+    { UINT8_C(253),
+      { -INT64_C(     150362510327828),  INT64_C( 6021172281952756656),  INT64_C( 7854318948018392227),  INT64_C( 4650824968416190322),
+        -INT64_C( 6917528958921078777), -INT64_C( 9218867887328690163),  INT64_C( 5493279535554528315), -INT64_C( 3625296876197953676) },
+      { -INT64_C( 1154399523314074625),  INT64_C( 4619342405918512869), -INT64_C(   38280631209185793), -INT64_C( 2742058069165918813),
+        -INT64_C( 1949536050996281321),  INT64_C(      45079977806848),  INT64_C(     853221023285776),  INT64_C(  584483064017592624) },
+      {  INT64_C(                  66),  INT64_C( 4243690773093234477), -INT64_C( 1246107319033398337),  INT64_C(                  13),
+         INT64_C(                  63), -INT64_C( 1872439474287917534),  INT64_C( 7168404203946053115),  INT64_C(                 117) },
+      { -INT64_C(      37590627581957),  INT64_C(                   0), -INT64_C(   76561262418371586), -INT64_C( 5973457178049685578),
+        -INT64_C( 3899072101992562641),  INT64_C(    1146791164903456),  INT64_C(   27303072745144841), -INT64_C( 2017049683091159443) } },
+    { UINT8_C(125),
+      { -INT64_C( 6173623694631352168), -INT64_C( 8464434067062816512), -INT64_C( 4657285514485891079), -INT64_C( 7672090112321345665),
+        -INT64_C( 5413508868471439368), -INT64_C( 2359886209053896773),  INT64_C(   45062384552841216), -INT64_C(  328036496682635953) },
+      { -INT64_C(   18295874023084035),  INT64_C( 3051582221152332068), -INT64_C( 1883758921858942666), -INT64_C( 6249621615249514862),
+         INT64_C( 3022190169064082828),  INT64_C( 2528105562570406873),  INT64_C( 6264340266801816649),  INT64_C(     149534730633472) },
+      {  INT64_C(                  84),  INT64_C(                  69),  INT64_C(                  48),  INT64_C(                   7),
+         INT64_C(                 112),  INT64_C( 5767052836894412800),  INT64_C(                 103),  INT64_C(       8796093046786) },
+      { -INT64_C(  360329042188085239),  INT64_C(                   0), -INT64_C( 8413361683347095715),  INT64_C( 2678250369438751054),
+        -INT64_C(  436199635723438881), -INT64_C( 2359886209053896773), -INT64_C( 8014775899532476368),  INT64_C(                   0) } },
+    { UINT8_C(126),
+      {  INT64_C( 8964999242885755933), -INT64_C( 6206130991413010552),  INT64_C( 1586336117690370543),  INT64_C(   38286284261163028),
+         INT64_C(       9414569885700),  INT64_C(     704786953404416),  INT64_C( 4061712301891748107),  INT64_C( 7814569529340097153) },
+      { -INT64_C( 2305880117740441859), -INT64_C( 1333065489701666821), -INT64_C(  535541351038100832), -INT64_C(   81209928829902849),
+        -INT64_C(  144115223526118417),  INT64_C( 2305860627169673472), -INT64_C( 5461856430355318207),  INT64_C( 3693275672424400350) },
+      {  INT64_C(                   7), -INT64_C( 8610882341149343168), -INT64_C(  148622705049207809),  INT64_C( 4638726376617690209),
+        -INT64_C( 4312838817119242021),  INT64_C( 5476708673247874542), -INT64_C( 2961866921376444728), -INT64_C( 4611696515331721483) },
+      {  INT64_C(                   0), -INT64_C( 6206130991413010552), -INT64_C( 1071082702076201664), -INT64_C(    5084143909862762),
+        -INT64_C( 2306549033117609472),  INT64_C( 4618441452295290890),  INT64_C( 4699609676144580481),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_shrdv_epi64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shrdv_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shrdv_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shrdv_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shrdv_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,1358 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN ternarylogic
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/ternarylogic.h>
+
+static int
+test_simde_mm_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r0[4];
+    const int32_t r1[4];
+    const int32_t r2[4];
+    const int32_t r3[4];
+  } test_vec[] = {
+    { { -INT32_C(   553648229), -INT32_C(    43923142),  INT32_C(         512),  INT32_C(    32601641) },
+      {  INT32_C(  1078071296),  INT32_C(    50332032),  INT32_C(   183307600), -INT32_C(   828173822) },
+      {  INT32_C(           0), -INT32_C(   536937009),  INT32_C(       67584), -INT32_C(  1671427230) },
+      {  INT32_C(   553648228), -INT32_C(   564082038), -INT32_C(   183240529), -INT32_C(  1404272458) },
+      { -INT32_C(  1631719525),  INT32_C(   553713968),  INT32_C(   183240528),  INT32_C(  1127376393) },
+      {  INT32_C(  1078071296), -INT32_C(   580859638),  INT32_C(   183240016),  INT32_C(  1122177568) },
+      { -INT32_C(   553648229),  INT32_C(   553713968),  INT32_C(   183240528),  INT32_C(  1135834633) } },
+    { {  INT32_C(  1258708440), -INT32_C(  2109698016), -INT32_C(           1), -INT32_C(    16777217) },
+      { -INT32_C(       32769), -INT32_C(   443847478), -INT32_C(  1847731964),  INT32_C(    33947672) },
+      {  INT32_C(    33619993),  INT32_C(   397237618), -INT32_C(      266241), -INT32_C(    34100608) },
+      {  INT32_C(       98305),  INT32_C(   261709415),  INT32_C(  1847731963), -INT32_C(    51271040) },
+      { -INT32_C(  1225252290),  INT32_C(  1614979208), -INT32_C(  1847998204),  INT32_C(      939367) },
+      { -INT32_C(       98306), -INT32_C(   503172952), -INT32_C(           1), -INT32_C(    17323368) },
+      { -INT32_C(       98306), -INT32_C(   532504440), -INT32_C(  1847731964),  INT32_C(    34493823) } },
+    { { -INT32_C(   538183753), -INT32_C(  1445629164), -INT32_C(  2011539415), -INT32_C(        6145) },
+      {  INT32_C(  1960598688), -INT32_C(    76595201), -INT32_C(   725740713),  INT32_C(  1090519042) },
+      { -INT32_C(   285215011),  INT32_C(  2113855406),  INT32_C(   251448994),  INT32_C(     4196384) },
+      { -INT32_C(  1439194603),  INT32_C(  1354386602),  INT32_C(   765815330),  INT32_C(     4198432) },
+      {  INT32_C(  1170759042),  INT32_C(   725881669),  INT32_C(  1343750492), -INT32_C(  1094719523) },
+      { -INT32_C(   554959179), -INT32_C(  1412074667), -INT32_C(   669361803),  INT32_C(  1094713378) },
+      {  INT32_C(  1439194530), -INT32_C(  1421528235), -INT32_C(   803597987), -INT32_C(     4200481) } },
+    { { -INT32_C(    18874369),  INT32_C(  1056274741),  INT32_C(   150610060),  INT32_C(  1913229956) },
+      { -INT32_C(    27262978), -INT32_C(   139504123), -INT32_C(  2147483503), -INT32_C(   799725987) },
+      { -INT32_C(    71303171), -INT32_C(   269156369),  INT32_C(      409736), -INT32_C(  1558688709) },
+      {  INT32_C(     8388609), -INT32_C(   917491936),  INT32_C(  1996726122), -INT32_C(  1363540711) },
+      { -INT32_C(    98566148),  INT32_C(   648957973), -INT32_C(  1997004651),  INT32_C(     4501696) },
+      { -INT32_C(    18874369),  INT32_C(  1056930085), -INT32_C(  2147352423),  INT32_C(  1917657668) },
+      { -INT32_C(    27262978),  INT32_C(   917458965), -INT32_C(  1997004651),  INT32_C(  1346745028) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0x29);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0x94);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r1));
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0xe4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r2));
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0xd4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r1[4];
+    const int32_t r2[4];
+    const int32_t r3[4];
+  } test_vec[] = {
+    { {  INT32_C(   245300736),  INT32_C(  1099432004), -INT32_C(  1205968265), -INT32_C(      526849) },
+      UINT8_C(218),
+      { -INT32_C(  2147220992), -INT32_C(  1964954755),  INT32_C(      131075), -INT32_C(  1346515016) },
+      { -INT32_C(    17301569),  INT32_C(   504081940), -INT32_C(  2146942940), -INT32_C(  1076363521) },
+      {  INT32_C(   245300736),  INT32_C(   714963670), -INT32_C(  1205968265), -INT32_C(  1074266113) },
+      {  INT32_C(   245300736), -INT32_C(   512470613), -INT32_C(  1205968265),  INT32_C(  1074266112) },
+      {  INT32_C(   245300736), -INT32_C(  2141191895), -INT32_C(  1205968265),  INT32_C(      524288) },
+      {  INT32_C(   245300736), -INT32_C(   176761425), -INT32_C(  1205968265), -INT32_C(   274873160) } },
+    { { -INT32_C(   932472782),  INT32_C(  1153496018),  INT32_C(  1848154928), -INT32_C(   376920730) },
+      UINT8_C(239),
+      {  INT32_C(  1452468842),  INT32_C(   135593984), -INT32_C(   134218754), -INT32_C(      528385) },
+      { -INT32_C(   130406614),  INT32_C(   475899655),  INT32_C(   339738752),  INT32_C(   805316608) },
+      { -INT32_C(   650204497), -INT32_C(  1351111894),  INT32_C(  1986568113), -INT32_C(   109003418) },
+      {  INT32_C(   130371797), -INT32_C(   475899656), -INT32_C(  1986567089),  INT32_C(   109007513) },
+      {  INT32_C(   109068352),  INT32_C(           0), -INT32_C(  2120785842),  INT32_C(   108479129) },
+      {  INT32_C(  1741116919), -INT32_C(   206938883), -INT32_C(  1919458225),  INT32_C(   645886617) } },
+    { {  INT32_C(    10616920), -INT32_C(    32392177),  INT32_C(   536969248),  INT32_C(     2101312) },
+      UINT8_C(165),
+      { -INT32_C(           1), -INT32_C(  1601961928), -INT32_C(     1048577),  INT32_C(     1736705) },
+      { -INT32_C(  2145386496), -INT32_C(   867676795),  INT32_C(     8421376), -INT32_C(   603979777) },
+      { -INT32_C(  2136866728), -INT32_C(    32392177),  INT32_C(   546406432),  INT32_C(     2101312) },
+      {  INT32_C(  2136866727), -INT32_C(    32392177), -INT32_C(   545357857),  INT32_C(     2101312) },
+      {  INT32_C(  2136866727), -INT32_C(    32392177), -INT32_C(   546406433),  INT32_C(     2101312) },
+      {  INT32_C(  2138963879), -INT32_C(    32392177), -INT32_C(   545325089),  INT32_C(     2101312) } },
+    { {  INT32_C(    35976743),  INT32_C(   351354182),  INT32_C(  1400883990), -INT32_C(  1414872487) },
+      UINT8_C( 91),
+      {  INT32_C(     1085452), -INT32_C(   840988171),  INT32_C(   537018368),  INT32_C(    67655682) },
+      { -INT32_C(   268435585), -INT32_C(   687935489), -INT32_C(  1869610751), -INT32_C(     8519809) },
+      {  INT32_C(   305460911), -INT32_C(   184570377),  INT32_C(  1400883990), -INT32_C(  1356277029) },
+      {  INT32_C(   268435584),  INT32_C(   687869952),  INT32_C(  1400883990),  INT32_C(     8519808) },
+      {  INT32_C(           0),  INT32_C(   150994944),  INT32_C(  1400883990),  INT32_C(           0) },
+      { -INT32_C(    36988460),  INT32_C(   802184012),  INT32_C(  1400883990),  INT32_C(  1356817828) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0xe9);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x15);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r1));
+    r = simde_mm_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x04);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r2));
+    r = simde_mm_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x97);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r0[4];
+    const int32_t r1[4];
+    const int32_t r2[4];
+    const int32_t r3[4];
+  } test_vec[] = {
+    { UINT8_C( 67),
+      {  INT32_C(        2304), -INT32_C(    70438368), -INT32_C(   995261671),  INT32_C(   604504130) },
+      { -INT32_C(  1585178559),  INT32_C(  1973526022), -INT32_C(  1344278529), -INT32_C(   573046986) },
+      {  INT32_C(      147593), -INT32_C(   536904737),  INT32_C(           0),  INT32_C(   554968156) },
+      { -INT32_C(      147849), -INT32_C(  1368609786),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  1585030967),  INT32_C(   607309279),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(  1585178559), -INT32_C(  1368609786),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  1585032758), -INT32_C(  1437851648),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(100),
+      { -INT32_C(  1123474910), -INT32_C(   134228033),  INT32_C(  1291488019),  INT32_C(  1224747024) },
+      { -INT32_C(   903261045),  INT32_C(      786944),  INT32_C(  1616237968),  INT32_C(      659720) },
+      {  INT32_C(     1116160), -INT32_C(  1318536130), -INT32_C(    67111457), -INT32_C(   227844575) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   682579107),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1291488052),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   682579075),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   145358883),  INT32_C(           0) } },
+    { UINT8_C(  4),
+      {  INT32_C(  1828716383), -INT32_C(  2050087958), -INT32_C(  1395335207), -INT32_C(     1048837) },
+      { -INT32_C(  1172704158), -INT32_C(   151060482), -INT32_C(   915655442), -INT32_C(  1938651732) },
+      {  INT32_C(  1611141184), -INT32_C(  1219597468),  INT32_C(     4194305),  INT32_C(    71303232) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   617663249),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   919849746),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   919849745),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1710811959),  INT32_C(           0) } },
+    { UINT8_C(202),
+      { -INT32_C(     8388609), -INT32_C(   450661822), -INT32_C(   536870914),  INT32_C(  1099629702) },
+      { -INT32_C(        1025), -INT32_C(    71319554), -INT32_C(      197383),  INT32_C(  1458337301) },
+      { -INT32_C(  1961434166), -INT32_C(     6291585),  INT32_C(   536936452), -INT32_C(  1755806433) },
+      {  INT32_C(           0),  INT32_C(   519884220),  INT32_C(           0),  INT32_C(  2145679987) },
+      {  INT32_C(           0),  INT32_C(   448564669),  INT32_C(           0), -INT32_C(   688590055) },
+      {  INT32_C(           0),  INT32_C(   515689916),  INT32_C(           0),  INT32_C(  1474589203) },
+      {  INT32_C(           0),  INT32_C(    73416704),  INT32_C(           0),  INT32_C(  1769998434) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x6d);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x4e);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r1));
+    r = simde_mm_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x6c);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r2));
+    r = simde_mm_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x61);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r0[2];
+    const int64_t r1[2];
+    const int64_t r2[2];
+    const int64_t r3[2];
+  } test_vec[] = {
+    { {  INT64_C(  972778619023917824), -INT64_C( 2477424962898983854) },
+      { -INT64_C(       2199091414017), -INT64_C( 7910474174711067641) },
+      { -INT64_C( 4920076099543119156), -INT64_C(  146507862821052546) },
+      { -INT64_C( 5316389568151040564),  INT64_C( 5597607757127264468) },
+      {  INT64_C( 5316391767241406003), -INT64_C( 5597467019638900821) },
+      { -INT64_C( 5316389568149991988),  INT64_C( 2335561437193665452) },
+      {  INT64_C(       2199090365440),  INT64_C( 5586330616066515152) } },
+    { { -INT64_C( 9138575183308822255),  INT64_C( 2413929411017441412) },
+      {  INT64_C( 2595342911159664640),  INT64_C( 2884555561331064832) },
+      {  INT64_C( 4235621764828174376), -INT64_C(  577869240759058473) },
+      { -INT64_C( 2217516098391248937),  INT64_C(  111746681482346668) },
+      {  INT64_C( 6833718987894986478), -INT64_C(  110338201617694853) },
+      { -INT64_C(  289710498204420097), -INT64_C( 2990390154729881733) },
+      {  INT64_C( 4616554773039910598),  INT64_C(  109494873077416108) } },
+    { { -INT64_C(    1125899915266049),  INT64_C( 4616207218830737408) },
+      { -INT64_C(     562984313229569), -INT64_C(          2151702529) },
+      {  INT64_C( 4611827306147676416),  INT64_C( 4912325887310380634) },
+      { -INT64_C( 4612953206062876673),  INT64_C(  305125869886070362) },
+      {  INT64_C( 4612953206062876672), -INT64_C(  305125867734376027) },
+      { -INT64_C( 4612953206062942465),  INT64_C(  305125869886078554) },
+      {  INT64_C(               65792),  INT64_C(          2151694336) } },
+    { { -INT64_C(   37718773234420353),  INT64_C( 4463065031700887295) },
+      { -INT64_C(  117375065623888131), -INT64_C(    2841141276049433) },
+      { -INT64_C( 9079256848778918896),  INT64_C( 8931504641922385910) },
+      {  INT64_C( 9077566872563462511),  INT64_C( 5052750546335101209) },
+      { -INT64_C( 9041538075544498544), -INT64_C( 5052750546335101210) },
+      {  INT64_C( 9077566872563462511),  INT64_C( 5052170002039763209) },
+      {  INT64_C(   36028797018963968),  INT64_C(     580544295338000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0x79);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0x87);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r1));
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r2));
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0x21);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r1[2];
+    const int64_t r2[2];
+    const int64_t r3[2];
+  } test_vec[] = {
+    { {  INT64_C( 4980985620278018049),  INT64_C( 4467007876639488959) },
+      UINT8_C( 82),
+      { -INT64_C(   18018904030839553),  INT64_C( 4920502282472675830) },
+      { -INT64_C( 9070715801702957353),  INT64_C(   38280871861551120) },
+      {  INT64_C( 4980985620278018049), -INT64_C( 4613938095283765329) },
+      {  INT64_C( 4980985620278018049), -INT64_C( 4918250207764306407) },
+      {  INT64_C( 4980985620278018049), -INT64_C( 4920502282472675831) },
+      {  INT64_C( 4980985620278018049),  INT64_C( 4918250207764306406) } },
+    { { -INT64_C( 3295777703948914148),  INT64_C(    1134696268824576) },
+      UINT8_C(193),
+      { -INT64_C( 9222175768136646650),  INT64_C( 9078588311349492735) },
+      { -INT64_C(  461977356911454325), -INT64_C( 3945530486409350174) },
+      {  INT64_C( 6227088466958350972),  INT64_C(    1134696268824576) },
+      { -INT64_C( 2995157669989582214),  INT64_C(    1134696268824576) },
+      {  INT64_C( 6227088466958350968),  INT64_C(    1134696268824576) },
+      {  INT64_C(      70368811286532),  INT64_C(    1134696268824576) } },
+    { { -INT64_C(   18014398778048553),  INT64_C(       9354438772800) },
+      UINT8_C(134),
+      { -INT64_C( 1240886043019871991), -INT64_C( 4621049459483086853) },
+      { -INT64_C(  288793328256909313),  INT64_C(   18014398813569152) },
+      { -INT64_C(   18014398778048553),  INT64_C( 4621058813888305220) },
+      { -INT64_C(   18014398778048553),  INT64_C( 4639063858229547140) },
+      { -INT64_C(   18014398778048553),  INT64_C( 4621049459449532420) },
+      { -INT64_C(   18014398778048553), -INT64_C( 4639063858263101573) } },
+    { { -INT64_C(     281475249373185), -INT64_C( 5424234955158342225) },
+      UINT8_C(186),
+      {  INT64_C( 3044929519671174674), -INT64_C( 5782621922084798501) },
+      { -INT64_C(      44032013108753), -INT64_C( 4039978024713650324) },
+      { -INT64_C(     281475249373185),  INT64_C( 3463305531324694695) },
+      { -INT64_C(     281475249373185), -INT64_C( 7516756937576366228) },
+      { -INT64_C(     281475249373185),  INT64_C( 1152921504611041316) },
+      { -INT64_C(     281475249373185),  INT64_C( 2887056520102609043) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x71);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    r = simde_mm_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0xb9);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r1));
+    r = simde_mm_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x31);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r2));
+    r = simde_mm_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x44);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r0[2];
+    const int64_t r1[2];
+    const int64_t r2[2];
+    const int64_t r3[2];
+  } test_vec[] = {
+    { UINT8_C(115),
+      {  INT64_C(  839481255375658828), -INT64_C( 4613976026272235521) },
+      {  INT64_C( 8474996762370194370),  INT64_C( 1804254602862788672) },
+      { -INT64_C( 2308798565255819265), -INT64_C( 8451743002360375329) },
+      {  INT64_C(  729797888103928844), -INT64_C( 3191008950014535777) },
+      {  INT64_C(  730360838057350156), -INT64_C(  578748288394592321) },
+      { -INT64_C( 9205216794152533967),  INT64_C( 4611724226458550272) },
+      {  INT64_C( 6787860761531827342), -INT64_C( 6415978829321338945) } },
+    { UINT8_C(192),
+      {  INT64_C( 2308730601777463558),  INT64_C( 1583627711339280421) },
+      {  INT64_C( 9079256573888430075), -INT64_C( 2332297195092589152) },
+      { -INT64_C(  306244774838669829), -INT64_C(      43983761850433) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 27),
+      {  INT64_C( 1153067739787558928),  INT64_C(    9038024268660737) },
+      { -INT64_C( 5697842528698059333),  INT64_C(    4726817936671751) },
+      { -INT64_C( 5523818594780008871),  INT64_C( 5029279069010575752) },
+      {  INT64_C( 5476390986492493828), -INT64_C( 5042839333333075343) },
+      {  INT64_C( 5476532823492476932), -INT64_C( 5033832129749747087) },
+      {  INT64_C( 5697696293651565124), -INT64_C(   13756046112310280) },
+      { -INT64_C( 6897907967726672887),  INT64_C(    9172164687806464) } },
+    { UINT8_C(221),
+      {  INT64_C( 8996293313624310509), -INT64_C( 4647759345684578353) },
+      {  INT64_C( 3578787493030298400), -INT64_C(      35219805569025) },
+      { -INT64_C( 4597721333432636419), -INT64_C(  238623077358732905) },
+      {  INT64_C( 8258830032611103951),  INT64_C(                   0) },
+      {  INT64_C( 9141536728431776975),  INT64_C(                   0) },
+      { -INT64_C( 9077965316510614510),  INT64_C(                   0) },
+      {  INT64_C( 5508194093706117581),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x61);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    r = simde_mm_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x71);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r1));
+    r = simde_mm_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x03);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r2));
+    r = simde_mm_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x38);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r0[8];
+    const int32_t r1[8];
+    const int32_t r2[8];
+    const int32_t r3[8];
+  } test_vec[] = {
+    { {  INT32_C(  2147467263), -INT32_C(  2139088224), -INT32_C(  2013263872),  INT32_C(      557066), -INT32_C(     2097158), -INT32_C(      557065),  INT32_C(  1671769721), -INT32_C(   393301991) },
+      { -INT32_C(   984330254),  INT32_C(  1098961068), -INT32_C(  1026867927), -INT32_C(   134217861), -INT32_C(   198957906),  INT32_C(  1653254004), -INT32_C(  1108479106),  INT32_C(   607829657) },
+      { -INT32_C(   353018689),  INT32_C(   538968066), -INT32_C(  1325394880), -INT32_C(      262149),  INT32_C(  1172974507),  INT32_C(     8396801), -INT32_C(  1208231443),  INT32_C(  1555417464) },
+      { -INT32_C(  2063580352),  INT32_C(   517944817),  INT32_C(    70573718), -INT32_C(   135037067), -INT32_C(  1339816960),  INT32_C(  1644300156), -INT32_C(  1806896364),  INT32_C(   662321159) },
+      { -INT32_C(   799085390), -INT32_C(   517944818), -INT32_C(    70568599), -INT32_C(           5),  INT32_C(  1311895807), -INT32_C(  1644300158), -INT32_C(    33827346), -INT32_C(  1808674824) },
+      {  INT32_C(  1068217165), -INT32_C(  1048520020),  INT32_C(  1254828329),  INT32_C(      262144), -INT32_C(  1142956204), -INT32_C(     8396809),  INT32_C(  1241787923), -INT32_C(   393333119) },
+      {  INT32_C(  1878335487),  INT32_C(  1637929134), -INT32_C(   204789399),  INT32_C(   135037066), -INT32_C(   171036753),  INT32_C(  1653254005),  INT32_C(   733424379),  INT32_C(  2022701049) } },
+    { { -INT32_C(     1179649),  INT32_C(   201328320),  INT32_C(  2104578818), -INT32_C(  1130879967),  INT32_C(      525312),  INT32_C(  1551200152), -INT32_C(   140599587),  INT32_C(         384) },
+      { -INT32_C(    16777537), -INT32_C(  2147418032),  INT32_C(     1081344), -INT32_C(  2113929212), -INT32_C(  2013133823), -INT32_C(    16848897), -INT32_C(    31694850), -INT32_C(    90420833) },
+      {  INT32_C(   537966418), -INT32_C(           9),  INT32_C(      264896),  INT32_C(   807929856), -INT32_C(  1355808769), -INT32_C(  2080374526), -INT32_C(  1390945799), -INT32_C(   136318985) },
+      { -INT32_C(   553826131), -INT32_C(  2147418088), -INT32_C(  2103827395), -INT32_C(  1052257318), -INT32_C(   657326079), -INT32_C(   646678886),  INT32_C(  1516791588), -INT32_C(   222537705) },
+      {  INT32_C(   554874386), -INT32_C(   201328265),  INT32_C(  2103826882),  INT32_C(   246426661), -INT32_C(  1356333057), -INT32_C(  1500804761), -INT32_C(  1399498246), -INT32_C(     2101249) },
+      { -INT32_C(   537966099),  INT32_C(   201328256),  INT32_C(  2104611586), -INT32_C(  1097325531),  INT32_C(      524288),  INT32_C(  2063593213),  INT32_C(  1401587207),  INT32_C(   134217736) },
+      { -INT32_C(    17825793),  INT32_C(  2147418087),  INT32_C(     1346240), -INT32_C(  1305999356),  INT32_C(   657326078),  INT32_C(  2130634749), -INT32_C(   148922657),  INT32_C(   222537704) } },
+    { {  INT32_C(  1269224593), -INT32_C(   731684529),  INT32_C(   276840448),  INT32_C(         128),  INT32_C(   523231926), -INT32_C(  2109446216),  INT32_C(   891177450),  INT32_C(  1072627707) },
+      {  INT32_C(   444533979), -INT32_C(  2132089737),  INT32_C(  1140592744), -INT32_C(    56352033),  INT32_C(     4785152),  INT32_C(  1127840055), -INT32_C(  1580791510),  INT32_C(  1603186075) },
+      { -INT32_C(   536891433),  INT32_C(      262724),  INT32_C(  1927128014),  INT32_C(     1839136),  INT32_C(  1767046901),  INT32_C(         520),  INT32_C(  1349890728), -INT32_C(    71303681) },
+      {  INT32_C(   811141218), -INT32_C(  1418561405), -INT32_C(   832697255),  INT32_C(    55037312), -INT32_C(  2134309624),  INT32_C(  1048764784),  INT32_C(   725814551),  INT32_C(  1140850688) },
+      { -INT32_C(  1635811361),  INT32_C(  1418561404),  INT32_C(  1677587438), -INT32_C(    54775169),  INT32_C(  1987320899), -INT32_C(  1048765305), -INT32_C(   991038872), -INT32_C(   606097505) },
+      {  INT32_C(  1098960904), -INT32_C(   722737861),  INT32_C(   287330336), -INT32_C(    56614177),  INT32_C(   523231926), -INT32_C(  1015185473), -INT32_C(  1248179774),  INT32_C(   610292320) },
+      { -INT32_C(   811161699), -INT32_C(  2131827081),  INT32_C(   832680870), -INT32_C(    55037185),  INT32_C(  1763441397),  INT32_C(  1127840575), -INT32_C(   239682646), -INT32_C(  1077936641) } },
+    { {  INT32_C(  2016237285),  INT32_C(      526914), -INT32_C(   573383808),  INT32_C(  1476530688), -INT32_C(    71247007),  INT32_C(       16388), -INT32_C(  1771601078), -INT32_C(   268435457) },
+      {  INT32_C(   308532724),  INT32_C(     1310721), -INT32_C(  1107372049), -INT32_C(    67110917),  INT32_C(  1719284454), -INT32_C(  1305093782),  INT32_C(  1978007359),  INT32_C(     2228224) },
+      {  INT32_C(    67141632),  INT32_C(  1412471389), -INT32_C(   605028361), -INT32_C(   454743032),  INT32_C(   130394728), -INT32_C(    17301510), -INT32_C(  1206824036), -INT32_C(   352342273) },
+      { -INT32_C(  1850606354), -INT32_C(  1412209247),  INT32_C(    71042151), -INT32_C(  1192806900),  INT32_C(  1677734928), -INT32_C(  1287808661),  INT32_C(   611110934),  INT32_C(   268435456) },
+      {  INT32_C(  1850639121),  INT32_C(  1413255199), -INT32_C(  1141901313), -INT32_C(   402788869), -INT32_C(  1635818513), -INT32_C(    17301506),  INT32_C(  2073264125),  INT32_C(    86135040) },
+      {  INT32_C(  2054117365),  INT32_C(      789058),  INT32_C(  1678772232),  INT32_C(   454743027), -INT32_C(   105195129),  INT32_C(           4), -INT32_C(   941183901), -INT32_C(   270663681) },
+      {  INT32_C(   375608820),  INT32_C(  1411684956), -INT32_C(     2884712),  INT32_C(  1595595763),  INT32_C(  1677695726),  INT32_C(  1287808656), -INT32_C(   571101269), -INT32_C(   352342273) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0x49);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0x9e);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r1));
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0x74);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r2));
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0xe6);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r1[8];
+    const int32_t r2[8];
+    const int32_t r3[8];
+  } test_vec[] = {
+    { { -INT32_C(   572785161), -INT32_C(      802817),  INT32_C(  1039356887), -INT32_C(  2115773504), -INT32_C(  1495065321),  INT32_C(  1342177284),  INT32_C(  1462913618),  INT32_C(  2145353213) },
+      UINT8_C( 95),
+      { -INT32_C(   765827423), -INT32_C(  2146942680), -INT32_C(    12780033), -INT32_C(  2147483103),  INT32_C(   505264948), -INT32_C(    73402897),  INT32_C(     1048578), -INT32_C(   577639874) },
+      {  INT32_C(  1587848411),  INT32_C(  1772412737),  INT32_C(  2093984047),  INT32_C(  1322097825), -INT32_C(  1884585148),  INT32_C(   292789145),  INT32_C(     8456192),  INT32_C(  1205869181) },
+      { -INT32_C(  1359036294), -INT32_C(   375071127),  INT32_C(  1107294456), -INT32_C(    19022145), -INT32_C(   911549736),  INT32_C(  1342177284), -INT32_C(  1461862993),  INT32_C(  2145353213) },
+      {  INT32_C(     2359816),  INT32_C(      786432), -INT32_C(  2113928192),  INT32_C(  1309410304),  INT32_C(   286531680),  INT32_C(  1342177284),  INT32_C(     8454144),  INT32_C(  2145353213) },
+      {  INT32_C(   589633804),  INT32_C(   374825110),  INT32_C(  1074571816),  INT32_C(  2134795647),  INT32_C(  1766377163),  INT32_C(  1342177284), -INT32_C(     1050627),  INT32_C(  2145353213) },
+      { -INT32_C(   539230217), -INT32_C(      262145), -INT32_C(           1), -INT32_C(  2115773471), -INT32_C(  1090535625),  INT32_C(  1342177284),  INT32_C(  1462913618),  INT32_C(  2145353213) } },
+    { {  INT32_C(    12634120),  INT32_C(  1943968341),  INT32_C(  1375623761), -INT32_C(  2074235563), -INT32_C(  1734919002), -INT32_C(   136380545),  INT32_C(   768503628), -INT32_C(    67239969) },
+      UINT8_C(217),
+      { -INT32_C(    67635553), -INT32_C(   665487728),  INT32_C(  1701881340), -INT32_C(   605292033), -INT32_C(    67682309),  INT32_C(    42012673), -INT32_C(   270055654),  INT32_C(  2146892462) },
+      {  INT32_C(     7252799), -INT32_C(  1494135145), -INT32_C(  1342177442), -INT32_C(    33587202),  INT32_C(   469756804),  INT32_C(    67556116), -INT32_C(  2107600704), -INT32_C(       51201) },
+      {  INT32_C(    78539639),  INT32_C(  1943968341),  INT32_C(  1375623761),  INT32_C(  2109134507), -INT32_C(  2023172314), -INT32_C(   136380545), -INT32_C(  1078536215), -INT32_C(  2079601295) },
+      { -INT32_C(    82242144),  INT32_C(  1943968341),  INT32_C(  1375623761),  INT32_C(   570425856),  INT32_C(  1611186265), -INT32_C(   136380545),  INT32_C(  1073844370),  INT32_C(           0) },
+      {  INT32_C(    70132599),  INT32_C(  1943968341),  INT32_C(  1375623761),  INT32_C(  2040681130),  INT32_C(   124306176), -INT32_C(   136380545), -INT32_C(  1841776475),  INT32_C(    67239968) },
+      { -INT32_C(    67633505),  INT32_C(  1943968341),  INT32_C(  1375623761), -INT32_C(   536871425), -INT32_C(    67682305), -INT32_C(   136380545), -INT32_C(   269521058), -INT32_C(           1) } },
+    { { -INT32_C(    59641922),  INT32_C(   237895296),  INT32_C(  2107757198), -INT32_C(  1550449216), -INT32_C(  1604321280),  INT32_C(     4210693),  INT32_C(   889715337), -INT32_C(   606078981) },
+      UINT8_C( 39),
+      { -INT32_C(  1761722219),  INT32_C(   344823266),  INT32_C(    37388264), -INT32_C(        1041), -INT32_C(    72368417),  INT32_C(   402653216), -INT32_C(   635783288),  INT32_C(   268697600) },
+      { -INT32_C(  1502572317), -INT32_C(  1627401216),  INT32_C(  1372572400),  INT32_C(  1562552333), -INT32_C(  1220512641), -INT32_C(  1207959553),  INT32_C(  2145384959),  INT32_C(   269091072) },
+      {  INT32_C(   855691383), -INT32_C(    68009827), -INT32_C(   772827015), -INT32_C(  1550449216), -INT32_C(  1604321280), -INT32_C(   134217729),  INT32_C(   889715337), -INT32_C(   606078981) },
+      {  INT32_C(     9310272), -INT32_C(  2142109342),  INT32_C(    39068944), -INT32_C(  1550449216), -INT32_C(  1604321280), -INT32_C(  1346388006),  INT32_C(   889715337), -INT32_C(   606078981) },
+      {  INT32_C(  1258372937), -INT32_C(   237884899), -INT32_C(  1404172169), -INT32_C(  1550449216), -INT32_C(  1604321280), -INT32_C(   138428422),  INT32_C(   889715337), -INT32_C(   606078981) },
+      { -INT32_C(    16781377),  INT32_C(   514719714),  INT32_C(  2143027182), -INT32_C(  1550449216), -INT32_C(  1604321280),  INT32_C(   406863909),  INT32_C(   889715337), -INT32_C(   606078981) } },
+    { { -INT32_C(  1627378533), -INT32_C(    52462594),  INT32_C(  1531807616),  INT32_C(   402670592), -INT32_C(   545488913),  INT32_C(     8388608),  INT32_C(  1074808900),  INT32_C(    17825944) },
+      UINT8_C( 67),
+      {  INT32_C(    43185559), -INT32_C(   306446465),  INT32_C(  2147483646),  INT32_C(         128),  INT32_C(   676339981), -INT32_C(  1142350032),  INT32_C(  2129882775), -INT32_C(     4194305) },
+      {  INT32_C(  1222891232), -INT32_C(  2147449848),  INT32_C(      526464), -INT32_C(  1001151229), -INT32_C(   546308102), -INT32_C(  1084228609), -INT32_C(  1349961218), -INT32_C(   522208011) },
+      {  INT32_C(  1794110067),  INT32_C(  1855717238),  INT32_C(  1531807616),  INT32_C(   402670592), -INT32_C(   545488913),  INT32_C(     8388608), -INT32_C(   274861574),  INT32_C(    17825944) },
+      {  INT32_C(  1081148260),  INT32_C(    18874369),  INT32_C(  1531807616),  INT32_C(   402670592), -INT32_C(   545488913),  INT32_C(     8388608), -INT32_C(  1855318231),  INT32_C(    17825944) },
+      { -INT32_C(   168830360),  INT32_C(   306480256),  INT32_C(  1531807616),  INT32_C(   402670592), -INT32_C(   545488913),  INT32_C(     8388608), -INT32_C(  1349668422),  INT32_C(    17825944) },
+      { -INT32_C(  1617756769), -INT32_C(    33554433),  INT32_C(  1531807616),  INT32_C(   402670592), -INT32_C(   545488913),  INT32_C(     8388608),  INT32_C(  2129882839),  INT32_C(    17825944) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r;
+
+    r = simde_mm256_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x6b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    r = simde_mm256_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x06);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r1));
+    r = simde_mm256_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x1b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r2));
+    r = simde_mm256_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0xfc);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r0[8];
+    const int32_t r1[8];
+    const int32_t r2[8];
+    const int32_t r3[8];
+  } test_vec[] = {
+    { UINT8_C(123),
+      { -INT32_C(  1660747796),  INT32_C(  1032422376),  INT32_C(   872546568),  INT32_C(        4240),  INT32_C(     1114114), -INT32_C(  1677410386), -INT32_C(   402917483),  INT32_C(  2143813233) },
+      {  INT32_C(    35733504),  INT32_C(      102441),  INT32_C(    37782530),  INT32_C(    78135812), -INT32_C(   414293809), -INT32_C(   536940849),  INT32_C(  1092269916),  INT32_C(   803209215) },
+      { -INT32_C(  2070921292),  INT32_C(  2119950076),  INT32_C(  1836524787),  INT32_C(    67108872), -INT32_C(   223316885), -INT32_C(  2086385322), -INT32_C(   865408966),  INT32_C(   636773022) },
+      {  INT32_C(  1651326979), -INT32_C(  2145112061),  INT32_C(           0), -INT32_C(        4249), -INT32_C(   280040483),  INT32_C(  2147215049),  INT32_C(   286529356),  INT32_C(           0) },
+      { -INT32_C(     9453585), -INT32_C(  1112693781),  INT32_C(           0), -INT32_C(    67108873),  INT32_C(   224365462), -INT32_C(   530638553), -INT32_C(   152051503),  INT32_C(           0) },
+      { -INT32_C(           1), -INT32_C(       98345),  INT32_C(           0), -INT32_C(           1), -INT32_C(           3),  INT32_C(  2147219449), -INT32_C(  1074438161),  INT32_C(           0) },
+      { -INT32_C(   455311433), -INT32_C(    25264426),  INT32_C(           0), -INT32_C(    11031189), -INT32_C(    89063559),  INT32_C(  1067575256), -INT32_C(  1653317842),  INT32_C(           0) } },
+    { UINT8_C( 15),
+      { -INT32_C(  1612746338), -INT32_C(  2002770141), -INT32_C(   671613969), -INT32_C(   605443320), -INT32_C(  1845325696), -INT32_C(   431027969), -INT32_C(  1019965971),  INT32_C(  1854874346) },
+      {  INT32_C(  1032055373),  INT32_C(   113541636),  INT32_C(    11685485),  INT32_C(     4235264),  INT32_C(    33587200),  INT32_C(   269583106), -INT32_C(   604850717), -INT32_C(       69669) },
+      {  INT32_C(    40370176),  INT32_C(    83437653), -INT32_C(  2130706416),  INT32_C(  1064559575),  INT32_C(   268435602),  INT32_C(     8912896),  INT32_C(    67640797),  INT32_C(  1360609076) },
+      {  INT32_C(  2105798253),  INT32_C(  2001130124),  INT32_C(   683298413),  INT32_C(      267296),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   497246221), -INT32_C(    72944213), -INT32_C(    11684478), -INT32_C(   605176024),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(           1), -INT32_C(     8388609), -INT32_C(           1), -INT32_C(     4235265),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  1609262124),  INT32_C(  1971026653), -INT32_C(  1447409027),  INT32_C(  1060591607),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 14),
+      {  INT32_C(   724495370), -INT32_C(  1848916876),  INT32_C(   308001885),  INT32_C(      524288), -INT32_C(  2130607744), -INT32_C(     2097473), -INT32_C(   951751117), -INT32_C(   724276904) },
+      { -INT32_C(  1822143990),  INT32_C(  2034247692), -INT32_C(   582448656),  INT32_C(     9568272), -INT32_C(  1176214531), -INT32_C(   978330011), -INT32_C(  1073741822), -INT32_C(  1140884354) },
+      {  INT32_C(   541065224),  INT32_C(   625245069), -INT32_C(  2138753596), -INT32_C(  1310875086),  INT32_C(  1994917433), -INT32_C(  1343959965), -INT32_C(    13666561), -INT32_C(  1323219527) },
+      {  INT32_C(           0),  INT32_C(  2049976330), -INT32_C(    43463758),  INT32_C(  1320312285),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(   872692618),  INT32_C(  1865643631),  INT32_C(  1311399373),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(    20971525), -INT32_C(          65), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(   909409163), -INT32_C(  1326579818), -INT32_C(      131073),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(153),
+      {  INT32_C(  1264538723),  INT32_C(   827426964),  INT32_C(  1996484607),  INT32_C(    73659566), -INT32_C(   110966264),  INT32_C(  1429983678), -INT32_C(  1293553681), -INT32_C(   323400998) },
+      {  INT32_C(   268500992), -INT32_C(  1052531535),  INT32_C(  1837255430), -INT32_C(  2032114519), -INT32_C(  1748988667),  INT32_C(  1544034877),  INT32_C(  1986582768),  INT32_C(  1638098282) },
+      {  INT32_C(  1379441451),  INT32_C(   278592944),  INT32_C(   285568830),  INT32_C(   668401622),  INT32_C(    83927048), -INT32_C(   274726913), -INT32_C(  1610480630), -INT32_C(  1496287084) },
+      { -INT32_C(  1266605932),  INT32_C(           0),  INT32_C(           0), -INT32_C(   626524119), -INT32_C(  1763893769),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1361552747) },
+      { -INT32_C(   270633737),  INT32_C(           0),  INT32_C(           0), -INT32_C(   599001977),  INT32_C(  1807734783),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1113665615) },
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(    71328897), -INT32_C(    16809985),  INT32_C(           0),  INT32_C(           0), -INT32_C(   545275905) },
+      { -INT32_C(   155599937),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2076089214), -INT32_C(  1805829894),  INT32_C(           0),  INT32_C(           0), -INT32_C(   696928033) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x4d);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    r = simde_mm256_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0xb5);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r1));
+    r = simde_mm256_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x7f);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r2));
+    r = simde_mm256_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x6b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r0[4];
+    const int64_t r1[4];
+    const int64_t r2[4];
+    const int64_t r3[4];
+  } test_vec[] = {
+    { { -INT64_C( 5189327646370040835), -INT64_C( 6379591055712401526), -INT64_C(    4512438687367203),  INT64_C(  576461302061858944) },
+      {  INT64_C( 4830392075331569696),  INT64_C( 1476925777717595488),  INT64_C( 8826593988024727354), -INT64_C(    9059977964552231) },
+      {  INT64_C(     598280387956768),  INT64_C( 6099297496984109541), -INT64_C(   13792514452488197), -INT64_C(     563018681319489) },
+      {  INT64_C(  578204723958518786),  INT64_C( 6377324407386173685), -INT64_C( 8826866658385065757), -INT64_C(  577024320743178433) },
+      {  INT64_C( 5189292461997952002),  INT64_C(  578941257797416976),  INT64_C(    4503633987108864),  INT64_C(     563018681319488) },
+      {  INT64_C(  577641627942650914),  INT64_C( 5523036299537592597),  INT64_C( 8813074212668831512),  INT64_C(  585521280026411174) },
+      {  INT64_C(     563096015867936),  INT64_C(  298647699069124992), -INT64_C(   13801319152746535),  INT64_C(  576461302061858944) } },
+    { { -INT64_C( 3913803440351728095), -INT64_C( 6917388284750430208),  INT64_C( 7648404144380920353), -INT64_C(  144401061669503561) },
+      { -INT64_C( 4481181440707972401), -INT64_C( 4359547540743153025),  INT64_C( 7938389766958026732),  INT64_C( 5762421215490799941) },
+      { -INT64_C(      37434969047041), -INT64_C(         30064789505),  INT64_C(   72058143795843074), -INT64_C( 4692771715326698755) },
+      {  INT64_C( 4499342280498208254),  INT64_C( 9223231277891549183), -INT64_C( 7939520068540649454), -INT64_C( 5618306040267078920) },
+      {  INT64_C(       2250596958208),  INT64_C(         25769822208), -INT64_C( 7720462288174666276),  INT64_C(                   0) },
+      { -INT64_C(  603734933028281583), -INT64_C( 7169526773239192192), -INT64_C( 7939520068538552302),  INT64_C(  925820198500473357) },
+      { -INT64_C( 3913838624723816927), -INT64_C( 6917388289045397504),  INT64_C(             2097152), -INT64_C( 4837172776996202315) } },
+    { {  INT64_C( 5418269547465709453), -INT64_C( 5248077782288735747), -INT64_C(         68719738881), -INT64_C(       4400210773641) },
+      { -INT64_C( 9067641773786014882),  INT64_C(  612526932789174784),  INT64_C( 9078130946719874038), -INT64_C( 4647717014604349441) },
+      { -INT64_C( 3494802935911680153),  INT64_C(  217317929933342754),  INT64_C( 7382844622529443024),  INT64_C(  260118097766121472) },
+      { -INT64_C(  153416855153974173),  INT64_C( 4851742323327933474),  INT64_C(  145241156706632704),  INT64_C(   36028797035741184) },
+      {  INT64_C( 3494793864907065360),  INT64_C( 5246951326183626240),  INT64_C(                   0),  INT64_C(       4400193996424) },
+      {  INT64_C( 3956186961428919076),  INT64_C( 4635550849499700226),  INT64_C( 7237603465822810320),  INT64_C(  224089300730380288) },
+      {  INT64_C( 5418260476461094661),  INT64_C(  216191473828233248),  INT64_C( 7382844553809704144),  INT64_C(  260118097749344256) } },
+    { { -INT64_C(  640659803573333788), -INT64_C( 4485834765819523286),  INT64_C( 3183727986931146144),  INT64_C( 4647714828366913600) },
+      {  INT64_C(     351843762832384),  INT64_C(  705959230919324129),  INT64_C( 1337165984532711984), -INT64_C( 6592143403331352576) },
+      { -INT64_C(     351860936704275), -INT64_C( 4230760771552150298),  INT64_C(    3404569103050880),  INT64_C( 1461127527142604147) },
+      { -INT64_C(     351860936441857), -INT64_C(  702031629444088618), -INT64_C( 4516784614258171697),  INT64_C( 2269814206826020863) },
+      {  INT64_C(              262418),  INT64_C( 4179519131550482449), -INT64_C( 3183728261876170145), -INT64_C( 6108842346883923316) },
+      {  INT64_C(  640659803564944155),  INT64_C( 3965684308057620532), -INT64_C( 4513398324603049905),  INT64_C( 1980457371983402943) },
+      { -INT64_C(  641011664509775644), -INT64_C( 4537076405821191134),  INT64_C(    3404294158026880),  INT64_C(          8625594432) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0x2b);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0x05);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r1));
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0x83);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r2));
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0xa0);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r1[4];
+    const int64_t r2[4];
+    const int64_t r3[4];
+  } test_vec[] = {
+    { {  INT64_C( 3264711372510444029),  INT64_C( 4233992793296992272),  INT64_C( 6965866649044280753), -INT64_C( 7099524887648727821) },
+      UINT8_C(132),
+      { -INT64_C( 4849971754998052097),  INT64_C( 9126786961711655495), -INT64_C( 9024294460724215260),  INT64_C( 7703425016447888380) },
+      { -INT64_C( 4756927535906955393),  INT64_C(      57535516377088),  INT64_C(  577868127737644064), -INT64_C( 6217313065679472041) },
+      {  INT64_C( 3264711372510444029),  INT64_C( 4233992793296992272), -INT64_C(   36591747509257217), -INT64_C( 7099524887648727821) },
+      {  INT64_C( 3264711372510444029),  INT64_C( 4233992793296992272),  INT64_C( 9024575936237927931), -INT64_C( 7099524887648727821) },
+      {  INT64_C( 3264711372510444029),  INT64_C( 4233992793296992272), -INT64_C( 8446989283477125628), -INT64_C( 7099524887648727821) },
+      {  INT64_C( 3264711372510444029),  INT64_C( 4233992793296992272), -INT64_C(  577586652760801281), -INT64_C( 7099524887648727821) } },
+    { {  INT64_C( 2432475758154411808),  INT64_C(     140737860345856),  INT64_C(    9297607763689745),  INT64_C( 4783373373148787107) },
+      UINT8_C(142),
+      { -INT64_C(  622393715889725783),  INT64_C(   63050394818846721),  INT64_C( 1398314395935921453),  INT64_C( 5234745710088100026) },
+      { -INT64_C(    9148007660437649), -INT64_C( 1441226721905876993), -INT64_C(  624629124773850458), -INT64_C( 7406701522716483821) },
+      {  INT64_C( 2432475758154411808), -INT64_C(   63191132339445762), -INT64_C( 1397742100100239654), -INT64_C( 5189721305859557810) },
+      {  INT64_C( 2432475758154411808), -INT64_C(                8193), -INT64_C(    9852173974373642), -INT64_C( 4648138436699226281) },
+      {  INT64_C( 2432475758154411808), -INT64_C( 1441226721941520385), -INT64_C(  614785746892499025), -INT64_C( 2767574911085998151) },
+      {  INT64_C( 2432475758154411808),  INT64_C( 1441367459497779200),  INT64_C(  624637920867134809),  INT64_C( 7415730940038377967) } },
+    { {  INT64_C( 2321322395635686717),  INT64_C( 3391630881823101843), -INT64_C(   18014399583223809),  INT64_C(   18014536082685952) },
+      UINT8_C( 94),
+      {  INT64_C( 8317065533209920071),  INT64_C(  323173024689980455),  INT64_C( 5721853321847567531),  INT64_C( 8070449421193571807) },
+      {  INT64_C( 2539955597109205984),  INT64_C( 4634788956750250000),  INT64_C( 2882331249861462528), -INT64_C( 3074904959259380011) },
+      {  INT64_C( 2321322395635686717), -INT64_C(  306297556588167188), -INT64_C( 7433193691904016044), -INT64_C( 4977531027779052758) },
+      {  INT64_C( 2321322395635686717), -INT64_C(  300650628506584104), -INT64_C( 5145365081736672428), -INT64_C( 3074903857331833099) },
+      {  INT64_C( 2321322395635686717),  INT64_C( 4930931587582919735),  INT64_C( 7451208091487239851), -INT64_C(   18015638010232865) },
+      {  INT64_C( 2321322395635686717), -INT64_C( 4630263366890291201), -INT64_C(                   1),  INT64_C( 3092919495342065962) } },
+    { { -INT64_C(  289356293372903685),  INT64_C( 3815267943762999074), -INT64_C(  175089549125099143), -INT64_C( 7026796058446772016) },
+      UINT8_C( 37),
+      {  INT64_C( 6285815871236944111), -INT64_C( 2050562131021914341), -INT64_C( 4611686572481251339),  INT64_C( 4411197087982096631) },
+      {  INT64_C( 8197664924486548299), -INT64_C(  339425071815159767),  INT64_C(   19140298955303169), -INT64_C( 7762728127457981035) },
+      { -INT64_C( 2519835373385812641),  INT64_C( 3815267943762999074),  INT64_C( 4767635822650277775), -INT64_C( 7026796058446772016) },
+      { -INT64_C(  448108348144091301),  INT64_C( 3815267943762999074),  INT64_C( 4630826871434455307), -INT64_C( 7026796058446772016) },
+      {  INT64_C( 2808065749537786788),  INT64_C( 3815267943762999074), -INT64_C( 4611686572479160588), -INT64_C( 7026796058446772016) },
+      { -INT64_C(                 257),  INT64_C( 3815267943762999074), -INT64_C(   19140298955294721), -INT64_C( 7026796058446772016) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r;
+
+    r = simde_mm256_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x97);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    r = simde_mm256_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0xbb);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r1));
+    r = simde_mm256_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x6e);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r2));
+    r = simde_mm256_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0xf5);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r0[4];
+    const int64_t r1[4];
+    const int64_t r2[4];
+    const int64_t r3[4];
+  } test_vec[] = {
+    { UINT8_C(  8),
+      { -INT64_C(  333283973201395969), -INT64_C(            23068673), -INT64_C( 2454479495686745699), -INT64_C( 4613656343541317895) },
+      {  INT64_C(  578782955229413905),  INT64_C(      35184372678672), -INT64_C( 1573249447495608396), -INT64_C( 2707297436737907122) },
+      {  INT64_C( 4386476594196297916),  INT64_C(  613333975329677600),  INT64_C( 7144972043800814997), -INT64_C( 5005994507821398711) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4977111079848126902) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2708704811898284466) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4613656343541317894) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7318420505211742391) } },
+    { UINT8_C(197),
+      {  INT64_C( 6488521391813918454),  INT64_C( 7510432894511875074),  INT64_C(      18141946057728),  INT64_C( 8125488108979317285) },
+      {  INT64_C( 3427820899425054072), -INT64_C( 5668927144243564025),  INT64_C( 6035727533677028189),  INT64_C( 2151590596572530230) },
+      { -INT64_C(   72148308176404513),  INT64_C(  531856503338643548), -INT64_C( 4755836408055268353), -INT64_C( 5605074923308685648) },
+      { -INT64_C( 9123054753485946879),  INT64_C(                   0), -INT64_C( 1279891675377578846),  INT64_C(                   0) },
+      {  INT64_C(  793214974414777456),  INT64_C(                   0),  INT64_C( 4755854000245506048),  INT64_C(                   0) },
+      { -INT64_C( 6488521396243103479),  INT64_C(                   0), -INT64_C(      18141946057729),  INT64_C(                   0) },
+      {  INT64_C( 5839421609904181894),  INT64_C(                   0),  INT64_C( 4755836957811086336),  INT64_C(                   0) } },
+    { UINT8_C(113),
+      {  INT64_C( 9203105804169772975), -INT64_C( 6480337421449114919), -INT64_C( 2629452315489933521),  INT64_C( 2595199568740630532) },
+      {  INT64_C( 9150609655855054847), -INT64_C(    9077568554676225),  INT64_C( 1050412601756744531), -INT64_C( 6434232827178834493) },
+      {  INT64_C(        137441068544),  INT64_C( 2314852416085829632), -INT64_C( 6606302658810203331), -INT64_C( 1360997839055820327) },
+      { -INT64_C( 9130343423172149168),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(   72762381001818113),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(   20266232685002832),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(   93028613682626640),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(184),
+      {  INT64_C(       9905378574368),  INT64_C( 2299804711777937725),  INT64_C( 5919133711308149498), -INT64_C( 1863324748224364186) },
+      { -INT64_C( 4613040636114239513), -INT64_C(      35184374784001), -INT64_C(  144255925632368641), -INT64_C( 3297984467797293214) },
+      { -INT64_C(  871179541617056480), -INT64_C( 7504320197273348923),  INT64_C( 7217215039351507823), -INT64_C(    4521402336018561) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  707306434455419033) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4454002644060175902) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 1863324610718301721) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2599720554407657476) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x17);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    r = simde_mm256_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0xc5);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r1));
+    r = simde_mm256_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x0e);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r2));
+    r = simde_mm256_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x34);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r0[16];
+    const int32_t r1[16];
+    const int32_t r2[16];
+    const int32_t r3[16];
+  } test_vec[] = {
+    { {  INT32_C(  1867981257),  INT32_C(  1545383961), -INT32_C(  1788742069), -INT32_C(   937886411),  INT32_C(  1701861326), -INT32_C(  1115422884),  INT32_C(  1888619376), -INT32_C(       19489),
+         INT32_C(  2146041855), -INT32_C(  2071584768),  INT32_C(   537919744), -INT32_C(      524697), -INT32_C(  1916625192),  INT32_C(  1432595601), -INT32_C(  1487972103),  INT32_C(  1419825763) },
+      {  INT32_C(  1095273695),  INT32_C(   340533572),  INT32_C(    33589248), -INT32_C(   559661179), -INT32_C(  1641381413), -INT32_C(  1082130433),  INT32_C(      525376), -INT32_C(  1306525632),
+         INT32_C(  1471201388),  INT32_C(   553664640),  INT32_C(   931330751), -INT32_C(   201588873),  INT32_C(    47169050),  INT32_C(  1342300628),  INT32_C(   553976322),  INT32_C(   134235136) },
+      {  INT32_C(   104776848), -INT32_C(     2097161),  INT32_C(  1596521386), -INT32_C(           1),  INT32_C(  1209170270), -INT32_C(  1927253445), -INT32_C(  1342177281), -INT32_C(    10552577),
+         INT32_C(   306188816), -INT32_C(   402653185), -INT32_C(   917671370), -INT32_C(       65537), -INT32_C(   897653494),  INT32_C(  2146130777), -INT32_C(   209715203), -INT32_C(  1631505028) },
+      { -INT32_C(  1767991760),  INT32_C(  1215336789),  INT32_C(   934705694),  INT32_C(   381469360),  INT32_C(  1217876020),  INT32_C(  1075839011),  INT32_C(   546967344),  INT32_C(  1298052767),
+        -INT32_C(  2142891504), -INT32_C(  1115266944),  INT32_C(    18904694),  INT32_C(   202113296), -INT32_C(  1173610457), -INT32_C(  2055845533), -INT32_C(  1966449927),  INT32_C(  1033772256) },
+      {  INT32_C(  1095271641),  INT32_C(   340533572),  INT32_C(    33589248), -INT32_C(   559661179),  INT32_C(   203555290), -INT32_C(  1121714305),  INT32_C(      525376), -INT32_C(  1306525632),
+         INT32_C(  1470152812),  INT32_C(   553664640),  INT32_C(   553677366), -INT32_C(   201588873),  INT32_C(    47103514),  INT32_C(  1342300624),  INT32_C(   553976320),  INT32_C(   134235136) },
+      { -INT32_C(  1870096848),  INT32_C(     6291780),  INT32_C(   580257812),  INT32_C(   379847296),  INT32_C(   143065136),  INT32_C(  1075839011),  INT32_C(      525312),  INT32_C(        1024),
+        -INT32_C(  2147090432),  INT32_C(   956317824),  INT32_C(    18904694),  INT32_C(      524560),  INT32_C(   839655463), -INT32_C(  2146156190),  INT32_C(   142606848),  INT32_C(   689835136) },
+      {  INT32_C(   673278342), -INT32_C(  1215336790), -INT32_C(   934705695), -INT32_C(   381469361), -INT32_C(  1287082165), -INT32_C(  1881378152), -INT32_C(   546967345), -INT32_C(  1300149920),
+         INT32_C(   974728579),  INT32_C(  1115266943), -INT32_C(   555775607), -INT32_C(   202178833),  INT32_C(  1165215176),  INT32_C(  2055804444),  INT32_C(  1966449926), -INT32_C(  1033788641) } },
+    { {  INT32_C(   516703699), -INT32_C(  1082786321), -INT32_C(  2140927984), -INT32_C(   308166072),  INT32_C(  1565384490), -INT32_C(    34619405),  INT32_C(    75530304),  INT32_C(   174848472),
+        -INT32_C(  1339410575),  INT32_C(  1835052662),  INT32_C(     4194584),  INT32_C(     2099712),  INT32_C(   210873670),  INT32_C(  1431310762),  INT32_C(   134218752),  INT32_C(  1241280740) },
+      {  INT32_C(  1879045887),  INT32_C(    89757068), -INT32_C(      327825), -INT32_C(  1251715994), -INT32_C(  1156617286), -INT32_C(  1503782734), -INT32_C(   268443665),  INT32_C(        2112),
+         INT32_C(     2097156),  INT32_C(     8390344), -INT32_C(  1955456766), -INT32_C(  1259529830),  INT32_C(   268580928), -INT32_C(    71320609), -INT32_C(    39894837), -INT32_C(   354793448) },
+      { -INT32_C(  1834516966),  INT32_C(  1344807174), -INT32_C(   303302658), -INT32_C(   402605740),  INT32_C(    50331648),  INT32_C(   134217762), -INT32_C(     2359361), -INT32_C(  2080374750),
+        -INT32_C(   652148734),  INT32_C(   501992734),  INT32_C(  1182665452),  INT32_C(  2126544361), -INT32_C(   637275136),  INT32_C(  1389401092),  INT32_C(  1073809744),  INT32_C(   400138486) },
+      {  INT32_C(   270742024),  INT32_C(   279585298),  INT32_C(  1837823870),  INT32_C(  1243254917),  INT32_C(    45088837),  INT32_C(   134234124), -INT32_C(   346333265),  INT32_C(  1905526277),
+        -INT32_C(  1764439928), -INT32_C(  1879795681),  INT32_C(   850652169),  INT32_C(   902992268),  INT32_C(   963614393),  INT32_C(    46186500),  INT32_C(  1113698916),  INT32_C(    50341877) },
+      {  INT32_C(   250574555),  INT32_C(    89757068), -INT32_C(   303366290), -INT32_C(  1524608956),  INT32_C(   453856042), -INT32_C(  1538385742), -INT32_C(   270802961),  INT32_C(        2112),
+         INT32_C(     2097152),  INT32_C(     8390216),  INT32_C(    41027840),  INT32_C(   887101832),  INT32_C(   268580928),  INT32_C(  1401983374),  INT32_C(  1208025152),  INT32_C(  1255686160) },
+      {  INT32_C(     2306568),  INT32_C(     9044496),  INT32_C(  1837823854),  INT32_C(    35262597),  INT32_C(    45088837),  INT32_C(       16396), -INT32_C(   346333265),  INT32_C(  1905526277),
+         INT32_C(   114608264), -INT32_C(  2104225783),  INT32_C(   850652161),  INT32_C(   902992268),  INT32_C(   829297337),  INT32_C(    41992196),  INT32_C(  1113698916),  INT32_C(    33556241) },
+      { -INT32_C(   476787402), -INT32_C(   368817819), -INT32_C(  1837825919), -INT32_C(  1329254534), -INT32_C(   448613232),  INT32_C(  1404151651),  INT32_C(   346333200), -INT32_C(  1905528390),
+         INT32_C(  1764439927),  INT32_C(  1879795104), -INT32_C(   850652426), -INT32_C(   905089421), -INT32_C(   963616506), -INT32_C(    62964111), -INT32_C(  1247916645), -INT32_C(  1258317814) } },
+    { {  INT32_C(  1752427946), -INT32_C(   402653697), -INT32_C(  1922084728),  INT32_C(   232092313), -INT32_C(   586744519), -INT32_C(  1461054672),  INT32_C(  1892493098),  INT32_C(  1879893177),
+        -INT32_C(     7344129), -INT32_C(    68419682),  INT32_C(   301990336),  INT32_C(    20687610), -INT32_C(  1096448538),  INT32_C(   602277619),  INT32_C(    33611784), -INT32_C(  1073741829) },
+      {  INT32_C(  1520974199), -INT32_C(     2097669),  INT32_C(     3211265), -INT32_C(   765419853),  INT32_C(  2146430847),  INT32_C(       49156),  INT32_C(  1210763328), -INT32_C(  1762347972),
+        -INT32_C(   245261254),  INT32_C(   537800704),  INT32_C(   578165010),  INT32_C(   521248306),  INT32_C(   134218240), -INT32_C(    33816581),  INT32_C(   614185862), -INT32_C(   247474968) },
+      { -INT32_C(   537067523),  INT32_C(   452534384),  INT32_C(   403111231), -INT32_C(    17104901),  INT32_C(           8), -INT32_C(  2147475448),  INT32_C(        2305),  INT32_C(   134238240),
+         INT32_C(   534822973),  INT32_C(           8), -INT32_C(   706287612),  INT32_C(  2146172863), -INT32_C(  1103783320), -INT32_C(        5121), -INT32_C(   838860814), -INT32_C(  1082916865) },
+      {  INT32_C(   316200157),  INT32_C(   404750848),  INT32_C(  1787187785), -INT32_C(   558830546),  INT32_C(     1048704), -INT32_C(   686486333), -INT32_C(  2028988012),  INT32_C(    16997186),
+         INT32_C(   250626053),  INT32_C(    68157545),  INT32_C(   409931305), -INT32_C(  1641139064), -INT32_C(   143662479), -INT32_C(   568465144),  INT32_C(   345725827),  INT32_C(   239086355) },
+      {  INT32_C(  1520974199), -INT32_C(     2097669),  INT32_C(     2162689), -INT32_C(   765419853),  INT32_C(  1560735033),  INT32_C(           0),  INT32_C(  1074268160),  INT32_C(   268743736),
+        -INT32_C(   245265350),  INT32_C(   537538560),  INT32_C(    40241408),  INT32_C(   521248306),  INT32_C(   134218240), -INT32_C(    33820677),  INT32_C(    77314946), -INT32_C(  1321216792) },
+      {  INT32_C(   310906965),  INT32_C(   402653696),  INT32_C(  1652556353), -INT32_C(   769618906),  INT32_C(     1048704),  INT32_C(  1460997315), -INT32_C(  2028988268),  INT32_C(    16980802),
+         INT32_C(     7340032),  INT32_C(    68157537),  INT32_C(   141495849), -INT32_C(  1643899904),  INT32_C(  1095393809), -INT32_C(   602281720),  INT32_C(   345709443),  INT32_C(           0) },
+      { -INT32_C(   316200160),  INT32_C(    47784052), -INT32_C(  1789350474),  INT32_C(   558830545), -INT32_C(  1561783730),  INT32_C(   686486332),  INT32_C(   954721899), -INT32_C(   285736795),
+         INT32_C(   286176248), -INT32_C(   605696106), -INT32_C(   443485994),  INT32_C(  1640090487),  INT32_C(   143662478),  INT32_C(   568464119), -INT32_C(   345725828), -INT32_C(   239872788) } },
+    { {  INT32_C(   228515698), -INT32_C(  1866320627), -INT32_C(   641712348),  INT32_C(   422101808), -INT32_C(   335544330), -INT32_C(   197501613), -INT32_C(   828150477), -INT32_C(           1),
+         INT32_C(    67373377),  INT32_C(   478452227),  INT32_C(     8913216), -INT32_C(    69206534),  INT32_C(   201347264), -INT32_C(          41), -INT32_C(   542036438), -INT32_C(   870689688) },
+      { -INT32_C(  2146959224),  INT32_C(  1176109088), -INT32_C(  1611868161),  INT32_C(   268435984), -INT32_C(    67383303),  INT32_C(  1075841216),  INT32_C(       32771),  INT32_C(   833067663),
+        -INT32_C(           9),  INT32_C(   139669520),  INT32_C(  1208676334),  INT32_C(    69730560),  INT32_C(   333945312),  INT32_C(     8781825), -INT32_C(   514191528), -INT32_C(   557857000) },
+      {  INT32_C(  2090261220),  INT32_C(   412769383),  INT32_C(      534696), -INT32_C(           3),  INT32_C(   571510784),  INT32_C(  1140883456),  INT32_C(   818717800),  INT32_C(   802703181),
+        -INT32_C(   684660535), -INT32_C(   620757249),  INT32_C(   536875009), -INT32_C(         524),  INT32_C(  1798433159), -INT32_C(     4207619),  INT32_C(     1064962),  INT32_C(     4517905) },
+      {  INT32_C(   251132641),  INT32_C(   834508469),  INT32_C(   538650760),  INT32_C(   153665826),  INT32_C(    67112960),  INT32_C(   264577580),  INT32_C(    26261156),  INT32_C(   240665920),
+        -INT32_C(   751771520),  INT32_C(   836217619), -INT32_C(  1753939952), -INT32_C(      524559), -INT32_C(  1960194280), -INT32_C(    12989484),  INT32_C(      299143),  INT32_C(   553949334) },
+      {  INT32_C(      524416),  INT32_C(     1703968), -INT32_C(  1714939988),  INT32_C(   268435984), -INT32_C(   335818768),  INT32_C(  1075841088),  INT32_C(       32771),  INT32_C(   833067663),
+        -INT32_C(   684398143),  INT32_C(   139669520),  INT32_C(      524608),  INT32_C(    69730560),  INT32_C(    52533696),  INT32_C(     8781825), -INT32_C(  1055912440), -INT32_C(   870398952) },
+      {  INT32_C(    39919745),  INT32_C(   557679280),  INT32_C(   538640520),  INT32_C(           2),  INT32_C(    67108864),  INT32_C(   197468716),  INT32_C(    17863300),  INT32_C(           0),
+        -INT32_C(   751771520),  INT32_C(   559096080), -INT32_C(  1753939952),  INT32_C(    69206529), -INT32_C(  2094428392),  INT32_C(           0),  INT32_C(      299141),  INT32_C(   553945238) },
+      { -INT32_C(   251656930), -INT32_C(   834508470),  INT32_C(  1176813683), -INT32_C(   153665827),  INT32_C(   840212495), -INT32_C(   266676845), -INT32_C(    26261160), -INT32_C(   511696323),
+         INT32_C(   751509119), -INT32_C(   836217620),  INT32_C(  1753415343),  INT32_C(      524558),  INT32_C(  1960190119),  INT32_C(    12989483),  INT32_C(  1056661872),  INT32_C(   316760929) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0x29);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r0));
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0xc8);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r1));
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0x09);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r2));
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r1[16];
+    const int32_t r2[16];
+    const int32_t r3[16];
+  } test_vec[] = {
+    { { -INT32_C(  1073741953), -INT32_C(         297),  INT32_C(   536872004), -INT32_C(     2099201),  INT32_C(    23069768), -INT32_C(   993517483), -INT32_C(           3),  INT32_C(  1158676624),
+        -INT32_C(   333298717),  INT32_C(   212693073), -INT32_C(  2002457072), -INT32_C(  1420571253),  INT32_C(   163906600), -INT32_C(     1181697),  INT32_C(   134219026),  INT32_C(        6145) },
+      UINT16_C(47993),
+      {  INT32_C(  2011164598),  INT32_C(    33554432),  INT32_C(   135266306),  INT32_C(   541108634), -INT32_C(  1908901448), -INT32_C(    25174017), -INT32_C(     9454101),  INT32_C(   138412032),
+         INT32_C(  2030837261), -INT32_C(  2147188736), -INT32_C(     1050113),  INT32_C(     8388608), -INT32_C(   233655885),  INT32_C(   965460719), -INT32_C(   226494465), -INT32_C(    11026433) },
+      {  INT32_C(  2056558448),  INT32_C(  1792851694),  INT32_C(  1890625468), -INT32_C(     1318945),  INT32_C(       33280), -INT32_C(     1122321),  INT32_C(     8389760), -INT32_C(         777),
+         INT32_C(  1364105969),  INT32_C(   504158446),  INT32_C(   167772160), -INT32_C(  1841809883), -INT32_C(  1948807171),  INT32_C(     2435074),  INT32_C(   366834678),  INT32_C(   637535105) },
+      {  INT32_C(  2145386358), -INT32_C(         297),  INT32_C(   536872004), -INT32_C(     3407905),  INT32_C(  1889992719), -INT32_C(    17899521), -INT32_C(     1065495),  INT32_C(  1158676624),
+         INT32_C(  2074032865),  INT32_C(  1834932032), -INT32_C(  2002457072), -INT32_C(   971766703), -INT32_C(  1879063111),  INT32_C(   968745711),  INT32_C(   134219026),  INT32_C(   648567681) },
+      { -INT32_C(   982816625), -INT32_C(         297),  INT32_C(   536872004),  INT32_C(     3418144), -INT32_C(  1887895560),  INT32_C(   993525690), -INT32_C(     8389761),  INT32_C(  1158676624),
+        -INT32_C(  1116938978), -INT32_C(  1834899265), -INT32_C(  2002457072),  INT32_C(   971766702), -INT32_C(   233653289), -INT32_C(     3481603),  INT32_C(   134219026), -INT32_C(    11026434) },
+      {  INT32_C(  2056558448), -INT32_C(         297),  INT32_C(   536872004), -INT32_C(     3416097),  INT32_C(           0), -INT32_C(    17899537),  INT32_C(     8389760),  INT32_C(  1158676624),
+         INT32_C(  1359878881),  INT32_C(   202166336), -INT32_C(  2002457072), -INT32_C(  2112879615), -INT32_C(  1948809799),  INT32_C(     2433026),  INT32_C(   134219026),  INT32_C(   637535105) },
+      {  INT32_C(  1207963840), -INT32_C(         297),  INT32_C(   536872004), -INT32_C(   544514491), -INT32_C(  1910998608),  INT32_C(   985128874),  INT32_C(     8388610),  INT32_C(  1158676624),
+         INT32_C(   286137580), -INT32_C(  1945579456), -INT32_C(  2002457072), -INT32_C(  2104491007), -INT32_C(    69749349),  INT32_C(     2498560),  INT32_C(   134219026), -INT32_C(    11032578) } },
+    { {  INT32_C(   933808357), -INT32_C(   113021654), -INT32_C(      262921), -INT32_C(     1050641), -INT32_C(        9218), -INT32_C(   141571146),  INT32_C(   878926648), -INT32_C(  1535638034),
+         INT32_C(     1048576), -INT32_C(   844045725),  INT32_C(  1481664317),  INT32_C(   603996296), -INT32_C(         139),  INT32_C(  1795851114),  INT32_C(  1405677502),  INT32_C(  1488164221) },
+      UINT16_C(50827),
+      {  INT32_C(  2145347583),  INT32_C(   612679680),  INT32_C(   268829040), -INT32_C(     2097283),  INT32_C(  1083496445), -INT32_C(  1143011516), -INT32_C(  1079298736), -INT32_C(  1632483271),
+        -INT32_C(  1073807363), -INT32_C(   216638226), -INT32_C(   493052312), -INT32_C(     8912897),  INT32_C(  1994176957),  INT32_C(    33624576), -INT32_C(   581784419),  INT32_C(  2003272822) },
+      {  INT32_C(   637649924), -INT32_C(   805388865), -INT32_C(   541081865),  INT32_C(  1590171096),  INT32_C(  1334020698), -INT32_C(       37511),  INT32_C(   874380520), -INT32_C(   408430512),
+         INT32_C(  1988939754), -INT32_C(   402825217),  INT32_C(     4229122),  INT32_C(     4200576),  INT32_C(    77394674), -INT32_C(    37773313),  INT32_C(   453843179),  INT32_C(    16782344) },
+      { -INT32_C(  1215703835), -INT32_C(   305729686), -INT32_C(      262921), -INT32_C(     3147779), -INT32_C(        9218), -INT32_C(   141571146),  INT32_C(   878926648), -INT32_C(  1498256776),
+         INT32_C(     1048576), -INT32_C(   407609617),  INT32_C(  1165201064),  INT32_C(   603996296), -INT32_C(         139),  INT32_C(  1795851114),  INT32_C(  2070457535), -INT32_C(   785645828) },
+      {  INT32_C(  1509896187),  INT32_C(   918409365), -INT32_C(      262921), -INT32_C(  1590171081), -INT32_C(        9218), -INT32_C(   141571146),  INT32_C(   878926648),  INT32_C(  1541397951),
+         INT32_C(     1048576),  INT32_C(   978304412), -INT32_C(    90374273),  INT32_C(   603996296), -INT32_C(         139),  INT32_C(  1795851114), -INT32_C(   858261675),  INT32_C(  2146926967) },
+      {  INT32_C(   637649924), -INT32_C(   842617558), -INT32_C(      262921),  INT32_C(  1590171096), -INT32_C(        9218), -INT32_C(   141571146),  INT32_C(   878926648), -INT32_C(  1499314096),
+         INT32_C(     1048576), -INT32_C(   407609617),  INT32_C(     4229120),  INT32_C(   603996296), -INT32_C(         139),  INT32_C(  1795851114),  INT32_C(   453511339),  INT32_C(    16782344) },
+      {  INT32_C(  1213703962), -INT32_C(   842617558), -INT32_C(      262921),  INT32_C(     1050768), -INT32_C(        9218), -INT32_C(   141571146),  INT32_C(   878926648),  INT32_C(   981616721),
+         INT32_C(     1048576),  INT32_C(   916856461), -INT32_C(  1563649984),  INT32_C(   603996296), -INT32_C(         139),  INT32_C(  1795851114), -INT32_C(  1910898653),  INT32_C(   658771978) } },
+    { {  INT32_C(  1638572253), -INT32_C(  1209045125), -INT32_C(  2054273662), -INT32_C(   879988533),  INT32_C(   537006208),  INT32_C(  1540216111), -INT32_C(  1576885303),  INT32_C(   536870913),
+         INT32_C(  1339011890), -INT32_C(     6356994), -INT32_C(      591105), -INT32_C(   276824193), -INT32_C(      164865),  INT32_C(  1614823553),  INT32_C(  1229356193),  INT32_C(    67108912) },
+      UINT16_C(12751),
+      { -INT32_C(  1207762784),  INT32_C(  2059699941), -INT32_C(   152931082), -INT32_C(   541065283), -INT32_C(    71648310),  INT32_C(   201359360), -INT32_C(    16974921), -INT32_C(     2129921),
+         INT32_C(     8929616), -INT32_C(  1284384610), -INT32_C(   583794599),  INT32_C(  1678728779),  INT32_C(  1074181740),  INT32_C(   214077268),  INT32_C(   857676434),  INT32_C(   536870922) },
+      {  INT32_C(   589937936),  INT32_C(   137381121), -INT32_C(  1077018625),  INT32_C(   402653480), -INT32_C(     1097953),  INT32_C(   688402316), -INT32_C(  1445102418),  INT32_C(     2097408),
+         INT32_C(  1283205583),  INT32_C(   724023330),  INT32_C(   298610355),  INT32_C(  2046263480),  INT32_C(      393600), -INT32_C(     4194307),  INT32_C(   605028352),  INT32_C(   134941058) },
+      {  INT32_C(   629138066),  INT32_C(   988043105), -INT32_C(  1210157578), -INT32_C(    70487639),  INT32_C(   537006208),  INT32_C(  1540216111), -INT32_C(  1428358225),  INT32_C(   536903937),
+        -INT32_C(    53729966), -INT32_C(     6356994), -INT32_C(      591105), -INT32_C(   276824193),  INT32_C(  1074148332),  INT32_C(  1824706519),  INT32_C(  1229356193),  INT32_C(    67108912) },
+      { -INT32_C(   628941331), -INT32_C(     2118914),  INT32_C(  2053356157), -INT32_C(   675282953),  INT32_C(   537006208),  INT32_C(  1540216111),  INT32_C(  1610604407), -INT32_C(       32769),
+         INT32_C(    62118653), -INT32_C(     6356994), -INT32_C(      591105), -INT32_C(   276824193), -INT32_C(      262529), -INT32_C(  1610629252),  INT32_C(  1229356193),  INT32_C(    67108912) },
+      {  INT32_C(   556376080),  INT32_C(   136332545), -INT32_C(  1211337226),  INT32_C(   402653480),  INT32_C(   537006208),  INT32_C(  1540216111), -INT32_C(  1461946194),  INT32_C(         256),
+         INT32_C(  1280057666), -INT32_C(     6356994), -INT32_C(      591105), -INT32_C(   276824193),  INT32_C(      393600),  INT32_C(  1820512213),  INT32_C(  1229356193),  INT32_C(    67108912) },
+      { -INT32_C(  1725325264),  INT32_C(  1210106244),  INT32_C(  1936470388),  INT32_C(   338923316),  INT32_C(   537006208),  INT32_C(  1540216111),  INT32_C(  1560041534), -INT32_C(   539000834),
+         INT32_C(  1279549506), -INT32_C(     6356994), -INT32_C(      591105), -INT32_C(   276824193),  INT32_C(      165248),  INT32_C(  1820512213),  INT32_C(  1229356193),  INT32_C(    67108912) } },
+    { {  INT32_C(   407011328), -INT32_C(  1082164226), -INT32_C(     1387493), -INT32_C(  2078077903), -INT32_C(  1073872901), -INT32_C(  1097943667), -INT32_C(         257), -INT32_C(  1055561794),
+        -INT32_C(   140526721),  INT32_C(   176915209),  INT32_C(     2098688),  INT32_C(    73506413), -INT32_C(   528861927),  INT32_C(    33588615),  INT32_C(   309818048),  INT32_C(   285221908) },
+      UINT16_C( 6112),
+      { -INT32_C(     2097153),  INT32_C(  1342226688), -INT32_C(  1546187876),  INT32_C(     3244066),  INT32_C(   986364645), -INT32_C(   906395133),  INT32_C(   411043840), -INT32_C(      262145),
+         INT32_C(   542153810), -INT32_C(   254267995), -INT32_C(   134218241), -INT32_C(      132234), -INT32_C(  1039763953),  INT32_C(  1612709892), -INT32_C(     4194306), -INT32_C(  2108638879) },
+      { -INT32_C(     1097729), -INT32_C(   143654913),  INT32_C(   649734885),  INT32_C(   272646144), -INT32_C(     3166723), -INT32_C(  1659335228),  INT32_C(        4866), -INT32_C(   512567054),
+         INT32_C(  1595394577),  INT32_C(  1835499833),  INT32_C(   268500994),  INT32_C(     1576964), -INT32_C(  1785222856), -INT32_C(   536870913), -INT32_C(    33603585), -INT32_C(  2114688054) },
+      {  INT32_C(   407011328), -INT32_C(  1082164226), -INT32_C(     1387493), -INT32_C(  2078077903), -INT32_C(  1073872901), -INT32_C(  1650932299),  INT32_C(   411048450), -INT32_C(   512491522),
+         INT32_C(  2000132819),  INT32_C(  1758187883),  INT32_C(   404816898),  INT32_C(    73506413), -INT32_C(   938068519),  INT32_C(    33588615),  INT32_C(   309818048),  INT32_C(   285221908) },
+      {  INT32_C(   407011328), -INT32_C(  1082164226), -INT32_C(     1387493), -INT32_C(  2078077903), -INT32_C(  1073872901),  INT32_C(  1677146699), -INT32_C(        4611),  INT32_C(  1055899469),
+        -INT32_C(  1463257746), -INT32_C(   134467916), -INT32_C(   134217729),  INT32_C(    73506413),  INT32_C(  2012077607),  INT32_C(    33588615),  INT32_C(   309818048),  INT32_C(   285221908) },
+      {  INT32_C(   407011328), -INT32_C(  1082164226), -INT32_C(     1387493), -INT32_C(  2078077903), -INT32_C(  1073872901), -INT32_C(  1659337340),  INT32_C(        4610), -INT32_C(   512567054),
+         INT32_C(  1461160465),  INT32_C(  1749254441),  INT32_C(   268500994),  INT32_C(    73506413), -INT32_C(  2146033384),  INT32_C(    33588615),  INT32_C(   309818048),  INT32_C(   285221908) },
+      {  INT32_C(   407011328), -INT32_C(  1082164226), -INT32_C(     1387493), -INT32_C(  2078077903), -INT32_C(  1073872901),  INT32_C(  1433470854),  INT32_C(        4610),  INT32_C(  1055561793),
+         INT32_C(  1464272385), -INT32_C(   128734036), -INT32_C(   136316417),  INT32_C(    73506413),  INT32_C(    34882326),  INT32_C(    33588615),  INT32_C(   309818048),  INT32_C(   285221908) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r;
+
+    r = simde_mm512_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0xe9);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r0));
+    r = simde_mm512_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x5e);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r1));
+    r = simde_mm512_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0xa8);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r2));
+    r = simde_mm512_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x2c);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r0[16];
+    const int32_t r1[16];
+    const int32_t r2[16];
+    const int32_t r3[16];
+  } test_vec[] = {
+    { UINT16_C(26790),
+      { -INT32_C(  1399655162),  INT32_C(     6563430), -INT32_C(  1357049958), -INT32_C(  2147483136),  INT32_C(   152078376), -INT32_C(          33),  INT32_C(   310134420),  INT32_C(  2147475423),
+        -INT32_C(    16843906),  INT32_C(  1987399137), -INT32_C(  1488973857), -INT32_C(           1), -INT32_C(       20481),  INT32_C(   150998022), -INT32_C(  1666153927), -INT32_C(          99) },
+      {  INT32_C(  1689997712), -INT32_C(  2080374272),  INT32_C(  1286349306),  INT32_C(   537657482),  INT32_C(         272),  INT32_C(  1555990468),  INT32_C(   268697608),  INT32_C(     4325376),
+        -INT32_C(   541069313),  INT32_C(   222928712), -INT32_C(       16386),  INT32_C(      132098),  INT32_C(  1448173521),  INT32_C(    67108928), -INT32_C(      262403),  INT32_C(   352112730) },
+      { -INT32_C(   137364097),  INT32_C(           5), -INT32_C(   268464641),  INT32_C(  1233783991),  INT32_C(     5378332),  INT32_C(   569791471),  INT32_C(    17826848),  INT32_C(  1981213876),
+        -INT32_C(  1253959107),  INT32_C(   797070583), -INT32_C(   268439937), -INT32_C(  2147483632), -INT32_C(   710716650),  INT32_C(  1342390336),  INT32_C(  1855917187),  INT32_C(   105119760) },
+      {  INT32_C(           0), -INT32_C(     6562916), -INT32_C(   206472096),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2101924875),  INT32_C(           0), -INT32_C(   162214764),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147351534),  INT32_C(           0), -INT32_C(  1493388295), -INT32_C(   211025924),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(     6562916), -INT32_C(     4358662),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2113853391),  INT32_C(           0), -INT32_C(   162083692),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147351534),  INT32_C(           0), -INT32_C(  1493388295), -INT32_C(      262147),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(         513), -INT32_C(  1286341115),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1555990469),  INT32_C(           0), -INT32_C(     4325377),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(      132099),  INT32_C(           0), -INT32_C(          65),  INT32_C(    21262662),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(  2073811866), -INT32_C(   272814086),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1544061985),  INT32_C(           0),  INT32_C(  2143281119),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(      132099),  INT32_C(           0),  INT32_C(   218106950),  INT32_C(  1876655301),  INT32_C(           0) } },
+    { UINT16_C(54373),
+      {  INT32_C(      262158),  INT32_C(         160),  INT32_C(   268468224), -INT32_C(  1500345645),  INT32_C(    16781329), -INT32_C(     8658945),  INT32_C(        8194),  INT32_C(    33621040),
+        -INT32_C(       18689), -INT32_C(         585), -INT32_C(  2143027200), -INT32_C(  1969131204),  INT32_C(   553684992),  INT32_C(  1075381374),  INT32_C(  1635618594),  INT32_C(   901282564) },
+      { -INT32_C(  1722553222),  INT32_C(   244035385), -INT32_C(   545263619), -INT32_C(      623124),  INT32_C(  1772830529),  INT32_C(   436544906), -INT32_C(    86785014),  INT32_C(    71565504),
+         INT32_C(  2076859790),  INT32_C(  1610727424), -INT32_C(   385284854),  INT32_C(    21316608), -INT32_C(    33266758), -INT32_C(   626261796), -INT32_C(   766998873),  INT32_C(   557842944) },
+      { -INT32_C(   558039554),  INT32_C(  1853728304),  INT32_C(     2113800),  INT32_C(       81920), -INT32_C(     2098307),  INT32_C(     2130112), -INT32_C(   134221825),  INT32_C(  1610749960),
+        -INT32_C(        2177), -INT32_C(   939632856),  INT32_C(    65144275),  INT32_C(   622902544),  INT32_C(  2134986683),  INT32_C(   292543633), -INT32_C(   167772161), -INT32_C(  1235513653) },
+      { -INT32_C(  1185419659),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(   447063370), -INT32_C(    86772728),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(    44433618),  INT32_C(           0), -INT32_C(   541170690),  INT32_C(           0), -INT32_C(  1154152059),  INT32_C(  1566312496) },
+      { -INT32_C(  1185419649),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(   447063498), -INT32_C(    86772726),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(    44433618),  INT32_C(           0), -INT32_C(     4299778),  INT32_C(           0), -INT32_C(    75657305),  INT32_C(  2103183920) },
+      {  INT32_C(  1743721349),  INT32_C(           0), -INT32_C(   270582025),  INT32_C(           0),  INT32_C(           0), -INT32_C(   436274571),  INT32_C(   221002741),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  2130705149),  INT32_C(           0), -INT32_C(  2113946555),  INT32_C(           0),  INT32_C(   800553304), -INT32_C(   557842945) },
+      { -INT32_C(  1722291074),  INT32_C(           0), -INT32_C(   813731843),  INT32_C(           0),  INT32_C(           0), -INT32_C(   444663051), -INT32_C(    86776822),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  1766655242),  INT32_C(           0), -INT32_C(    16452678),  INT32_C(           0), -INT32_C(   209875033),  INT32_C(   888699652) } },
+    { UINT16_C(46161),
+      {  INT32_C(     1180160),  INT32_C(    90315829),  INT32_C(  1512639757),  INT32_C(   376571346), -INT32_C(   268963905),  INT32_C(   663170056),  INT32_C(   136321048),  INT32_C(  1076200449),
+        -INT32_C(   599278505),  INT32_C(   114598797),  INT32_C(      590376),  INT32_C(   476465629),  INT32_C(  1523152632),  INT32_C(   184558081),  INT32_C(  2142207679), -INT32_C(   228674675) },
+      {  INT32_C(       10753), -INT32_C(   750029188),  INT32_C(   139067392),  INT32_C(  1689512132),  INT32_C(         640), -INT32_C(  1416846694),  INT32_C(    16803740),  INT32_C(  1327530046),
+        -INT32_C(  1803549792),  INT32_C(  1959953395), -INT32_C(   337897795), -INT32_C(  1278512437), -INT32_C(  2006930119),  INT32_C(     1048961),  INT32_C(   432676948),  INT32_C(   595064672) },
+      { -INT32_C(   101319201),  INT32_C(   865230975), -INT32_C(  1212219425), -INT32_C(   547356673),  INT32_C(   382288486), -INT32_C(  1214252033), -INT32_C(     4300961), -INT32_C(   452131845),
+        -INT32_C(   228446018), -INT32_C(   135270531),  INT32_C(    33823104),  INT32_C(        2054), -INT32_C(      278993), -INT32_C(    41951241), -INT32_C(     8454274), -INT32_C(   836525634) },
+      {  INT32_C(   102246945),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   113332390),  INT32_C(           0),  INT32_C(   157417380),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(       67841),  INT32_C(           0), -INT32_C(   760374511),  INT32_C(   160433032),  INT32_C(           0), -INT32_C(   504013076) },
+      {  INT32_C(   102246945),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   113332902),  INT32_C(           0),  INT32_C(   157417404),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(       67841),  INT32_C(           0), -INT32_C(   621953223),  INT32_C(   160433033),  INT32_C(           0), -INT32_C(   470286356) },
+      { -INT32_C(       10754),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(         641),  INT32_C(           0), -INT32_C(    16795421),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(    34345641),  INT32_C(           0),  INT32_C(  2006930374), -INT32_C(     1048962),  INT32_C(           0), -INT32_C(   578269985) },
+      {  INT32_C(     1189889),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   268964033),  INT32_C(           0),  INT32_C(   153124764),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(   338357099),  INT32_C(           0), -INT32_C(   622198807),  INT32_C(   185607041),  INT32_C(           0), -INT32_C(   752097811) } },
+    { UINT16_C(10523),
+      { -INT32_C(   545783817),  INT32_C(  2080305146),  INT32_C(  1681858906),  INT32_C(   196472092), -INT32_C(  1041189205),  INT32_C(  1082262552),  INT32_C(   824460569), -INT32_C(  1757985598),
+         INT32_C(  1047059827), -INT32_C(    67502094), -INT32_C(  1057157302),  INT32_C(  1116612013), -INT32_C(           1),  INT32_C(  1895289856),  INT32_C(   408075127),  INT32_C(  1825299524) },
+      {  INT32_C(     8396937), -INT32_C(        3201),  INT32_C(   160203736),  INT32_C(     2097153), -INT32_C(   330489471), -INT32_C(  1653562393),  INT32_C(  2143272959),  INT32_C(  1394610176),
+         INT32_C(   498039571), -INT32_C(   541067785),  INT32_C(    84164736),  INT32_C(   298449074),  INT32_C(    47218694),  INT32_C(   269484544), -INT32_C(   996215790), -INT32_C(    42483713) },
+      { -INT32_C(   287309826), -INT32_C(  1456885450),  INT32_C(  1201909630), -INT32_C(  2147481015),  INT32_C(       16896),  INT32_C(  2146959101), -INT32_C(   974440122),  INT32_C(   197001479),
+        -INT32_C(  1473691874),  INT32_C(   317755452),  INT32_C(   819723819), -INT32_C(     2688009), -INT32_C(          65), -INT32_C(   611811773), -INT32_C(  2033406868),  INT32_C(  2139095007) },
+      { -INT32_C(   824713345), -INT32_C(   690531763),  INT32_C(           0),  INT32_C(  1953110187), -INT32_C(    28365867),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  1972856449),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1399838999),  INT32_C(           0),  INT32_C(  1150310332),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   824705025), -INT32_C(        3201),  INT32_C(           0),  INT32_C(  1953110187), -INT32_C(    28365867),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  2109702035),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1408235959),  INT32_C(           0),  INT32_C(  1418745788),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(     8396938),  INT32_C(    67112065),  INT32_C(           0), -INT32_C(     2097154),  INT32_C(  1069539198),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+        -INT32_C(   472480532),  INT32_C(           0),  INT32_C(           0), -INT32_C(   298383539),  INT32_C(           0), -INT32_C(   269484545),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(   537395202), -INT32_C(  1389773385),  INT32_C(           0),  INT32_C(   194374941),  INT32_C(   767399722),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   737132402),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1405615551),  INT32_C(           0),  INT32_C(  1894241792),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x6d);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r0));
+    r = simde_mm512_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0xed);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r1));
+    r = simde_mm512_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x37);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r2));
+    r = simde_mm512_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0xbc);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r0[8];
+    const int64_t r1[8];
+    const int64_t r2[8];
+    const int64_t r3[8];
+  } test_vec[] = {
+    { { -INT64_C(     281484189630475), -INT64_C( 8583490496354206801),  INT64_C( 4610507135535153151),  INT64_C(       4679635304992),
+        -INT64_C( 5293538489597312873), -INT64_C(   36046389205013121),  INT64_C( 6698351608858708281), -INT64_C( 5765742768857042433) },
+      { -INT64_C(     105557415432201), -INT64_C(    4514664002097409),  INT64_C(  589022123297603593),  INT64_C(        561031185202),
+         INT64_C(  576460752571859970),  INT64_C(    1125899924819968), -INT64_C( 1180381280260560253), -INT64_C( 4943100744349459282) },
+      { -INT64_C(  615946727723636509),  INT64_C(     563059609829376), -INT64_C( 9079256427867893758), -INT64_C( 2305948631049439235),
+        -INT64_C( 8071576468661993601),  INT64_C( 9043227708145498085), -INT64_C( 5976661791500601993),  INT64_C( 3226441545306129110) },
+      {  INT64_C(  616263396289550110), -INT64_C( 8578412984002036817),  INT64_C( 9222210814868455423),  INT64_C( 2305953867420961040),
+        -INT64_C(  104265816543738731), -INT64_C(    1143492094083713), -INT64_C( 1010075094678509254), -INT64_C( 4053974207120313991) },
+      {  INT64_C(  616228211913266966), -INT64_C(    4514700107186177),  INT64_C( 4467552748534591485),  INT64_C(        558883701010),
+         INT64_C( 4035225300752139392), -INT64_C( 9079256505164457958), -INT64_C(  865972906682979702), -INT64_C( 7837002213515363031) },
+      { -INT64_C(  616193023250401055),  INT64_C(         37178839296),  INT64_C( 3878530625236987892),  INT64_C(          2147484192),
+         INT64_C( 3458764548180279426), -INT64_C( 9078130605273200614),  INT64_C( 2046045179164491785),  INT64_C( 2908186343674978695) },
+      { -INT64_C(     387041605062667), -INT64_C( 8583490565610558801), -INT64_C( 8635510860665585655), -INT64_C( 2305953867420961043),
+         INT64_C(  104265816543738730),  INT64_C(    1143492110860928),  INT64_C( 5518266103291190341), -INT64_C( 6097139352837254482) } },
+    { {  INT64_C( 2722576237261508491), -INT64_C(       2817498818561), -INT64_C( 5910007185504469001), -INT64_C(  288652588768165889),
+        -INT64_C( 4382856172723622679), -INT64_C( 8546135606399003657),  INT64_C( 2882303765812092964), -INT64_C( 4373109592810319590) },
+      { -INT64_C( 9223336577537671088),  INT64_C(   18014400191397896), -INT64_C( 4186234073500040215),  INT64_C(    9060525602767392),
+         INT64_C( 3157953515496487610),  INT64_C( 1226861499662730240),  INT64_C( 2314850217058631680),  INT64_C( 3028125391678095362) },
+      {  INT64_C( 5187856481675902975),  INT64_C(    9715301922898432), -INT64_C(   76578854573613123),  INT64_C(          8592040448),
+        -INT64_C(   72165897543876609),  INT64_C( 1164250906783711784),  INT64_C( 4635157606102472459), -INT64_C( 9222175768203616256) },
+      {  INT64_C( 4452275445511245787), -INT64_C(                   1),  INT64_C( 7574207523305798750), -INT64_C(                 513),
+        -INT64_C( 1585272610290985389), -INT64_C(    2515685355815945), -INT64_C( 4644164813947410188), -INT64_C( 2883500030206042113) },
+      { -INT64_C( 6917484771492757424), -INT64_C(    9718119421716993),  INT64_C( 4689513883850416202), -INT64_C(  288652597360206337),
+         INT64_C( 3013870179971043858), -INT64_C( 7402027749893728809),  INT64_C( 2891310973657030692),  INT64_C( 7731440305692496154) },
+      {  INT64_C( 2305851806179131392), -INT64_C(   27732519613114889), -INT64_C( 8866740758094388317), -INT64_C(  297713122962972705),
+         INT64_C(  144158104463616168), -INT64_C( 8628889249556459049),  INT64_C(  576460756598399012),  INT64_C( 4705566713828086040) },
+      {  INT64_C( 4771096591343530020),  INT64_C(   18014400191397896), -INT64_C( 7502149929265740831),  INT64_C(    9060525602767392),
+         INT64_C( 1657401122292033964),  INT64_C(   76068612456054792),  INT64_C( 6941000615316166411),  INT64_C(  145891998867529730) } },
+    { {  INT64_C( 2191580194793886914),  INT64_C( 8571905913790258900),  INT64_C( 2420344847003028060), -INT64_C( 6920062302432526337),
+         INT64_C(  288230376218820608),  INT64_C(   36063981927936012), -INT64_C( 1081470318588044331),  INT64_C( 4621256648675295376) },
+      { -INT64_C( 6471231857918344408), -INT64_C( 6886435216261656441),  INT64_C( 8522590231173635762),  INT64_C(      89069166068256),
+        -INT64_C( 6746118353505914221), -INT64_C( 7638874573366603411),  INT64_C( 9036899559286957117), -INT64_C(      10995387869698) },
+      { -INT64_C( 1135570698079145622),  INT64_C( 1885075592032629420), -INT64_C( 6650485846212015306),  INT64_C( 6537068856253979475),
+         INT64_C( 4826701294124689639), -INT64_C(  225602333994666017), -INT64_C( 1820091641908101853),  INT64_C( 1915732268152888472) },
+      { -INT64_C( 4621871951609094657),  INT64_C( 8637249977653972816),  INT64_C(  836506099883139183), -INT64_C( 4614026878817206785),
+         INT64_C( 2262185419952022923), -INT64_C( 7611958388624709311), -INT64_C( 7721879263009849356),  INT64_C( 6535855732388378121) },
+      { -INT64_C( 5885189966604105816), -INT64_C( 1954855086019392429),  INT64_C( 6215619122761405674), -INT64_C( 8843193340445432660),
+        -INT64_C( 6457887977354202477), -INT64_C( 7674903369848700575),  INT64_C( 2107759616376350460), -INT64_C(     574288935529106) },
+      {  INT64_C(  604056300594693248),  INT64_C( 4949598927252430036),  INT64_C( 2306971108412230232), -INT64_C( 8843104288459233652),
+         INT64_C(  288230376151711744),  INT64_C(   36028797555838988),  INT64_C( 6929281093789565633),  INT64_C(     563293553950864) },
+      {  INT64_C( 5054200439181959168),  INT64_C( 2910459232217067692), -INT64_C( 6906724666579875056),  INT64_C( 4614026887407141408),
+         INT64_C( 4655317113939953764),  INT64_C( 7530612120321758878),  INT64_C( 8244296802504687639),  INT64_C( 4621265445033609360) } },
+    { {  INT64_C( 1153204087685515392), -INT64_C( 6917524251637448704),  INT64_C( 7131228898593602331), -INT64_C( 7084146328117930257),
+        -INT64_C(  571983589618261432),  INT64_C( 4755801756292907040),  INT64_C( 9058990375561052127),  INT64_C(  146377020937371648) },
+      {  INT64_C(  189723345715986688),  INT64_C( 1153027642912407632), -INT64_C(      30786342619137), -INT64_C( 1186686550808882221),
+        -INT64_C( 2791093035592200679), -INT64_C( 4434383344275823335), -INT64_C(  856190068261244003), -INT64_C( 1740642355758760450) },
+      { -INT64_C(    4790031029896323), -INT64_C(    4503599627898886), -INT64_C( 7704303031995643988), -INT64_C( 4853586351540807899),
+        -INT64_C( 6771582983144950542), -INT64_C( 6129796767336898865),  INT64_C( 7648113957458750560), -INT64_C( 7403373965778553198) },
+      {  INT64_C( 1347435980797644162), -INT64_C( 5759993077816618923), -INT64_C(  584342255020491593),  INT64_C( 3563305797577289198),
+         INT64_C( 8988048857404008284), -INT64_C( 3070171843933027287),  INT64_C( 2158909724232245215), -INT64_C( 8977389594959645549) },
+      {  INT64_C(  190004829282632064),  INT64_C( 1153027608552669264), -INT64_C(    5656051050300169),  INT64_C( 7140464484909122010),
+         INT64_C( 6433795418905628185), -INT64_C( 4578498532351711943), -INT64_C( 7666128630846155873), -INT64_C( 1738398252530696706) },
+      {  INT64_C(     281483566645376),  INT64_C(         34359738368),  INT64_C(    5634060800707336), -INT64_C( 8318135040370241015),
+        -INT64_C( 9219601311067930624),  INT64_C(  144115188075888672),  INT64_C( 7026252086847512578),  INT64_C(    2261695422562304) },
+      { -INT64_C( 1347435980831198595),  INT64_C( 5759993077816618922),  INT64_C( 7131206908378084123), -INT64_C( 8249298933494000957),
+        -INT64_C( 2737058656348450134),  INT64_C( 7676966656799447750),  INT64_C( 8509045356838925245),  INT64_C( 1873506378790765056) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0x79);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r0));
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0x5c);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r1));
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0x90);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r2));
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0xc2);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r1[8];
+    const int64_t r2[8];
+    const int64_t r3[8];
+  } test_vec[] = {
+    { { -INT64_C(  792774467614277961), -INT64_C( 5914651282638899524), -INT64_C( 8501670179249586048),  INT64_C(     158329678667796),
+         INT64_C( 6816708913249494363),  INT64_C( 8872984818147885250), -INT64_C(   72059793128295041), -INT64_C( 3909505334302531465) },
+      UINT8_C(181),
+      {  INT64_C( 9151239675353754623), -INT64_C( 3206308049798181272),  INT64_C(  434460488021830672), -INT64_C(   38287271752110345),
+        -INT64_C(     562952105099401), -INT64_C( 5877838105416522621),  INT64_C( 2148504865080287118), -INT64_C( 1158568667196342305) },
+      { -INT64_C( 1724476280926606500), -INT64_C( 4611691516423834722),  INT64_C( 4651657698775924992), -INT64_C( 5313805750607644354),
+        -INT64_C(   81346543148327569), -INT64_C( 1729963349349761089), -INT64_C(    9007255560126465), -INT64_C(         34360958994) },
+      { -INT64_C( 7643076949197876061), -INT64_C( 5914651282638899524), -INT64_C( 4940311949565226257),  INT64_C(     158329678667796),
+         INT64_C(     281477129019544),  INT64_C( 6413693820284895296), -INT64_C(   72059793128295041),  INT64_C(    5629604763181105) },
+      {  INT64_C( 9006983715697065983), -INT64_C( 5914651282638899524), -INT64_C( 8501105030004473728),  INT64_C(     158329678667796),
+        -INT64_C(   81628020276085385), -INT64_C( 4724370693290679101), -INT64_C(   72059793128295041), -INT64_C( 1158568667197259809) },
+      {  INT64_C( 6922360076159712788), -INT64_C( 5914651282638899524), -INT64_C( 3995818717706190464),  INT64_C(     158329678667796),
+         INT64_C( 6816990386073896259),  INT64_C( 3653381040154139646), -INT64_C(   72059793128295041), -INT64_C( 2762195842272640954) },
+      {  INT64_C( 2084623639537353195), -INT64_C( 5914651282638899524),  INT64_C(  144680337321492480),  INT64_C(     158329678667796),
+        -INT64_C( 6898055456396560332), -INT64_C( 8337146696007670783), -INT64_C(   72059793128295041),  INT64_C( 2756566271868288921) } },
+    { { -INT64_C( 4611844365283953305), -INT64_C( 4889991039627496701), -INT64_C( 3397613985657721156),  INT64_C( 3644608766087049390),
+         INT64_C(  999569336029815891),  INT64_C(     457406812284416), -INT64_C( 1027958589385159557), -INT64_C( 1152921504606847011) },
+      UINT8_C(155),
+      {  INT64_C( 6894728987587641343), -INT64_C(    4538986030694698), -INT64_C( 8790595537569629796), -INT64_C(     439804655566865),
+         INT64_C(    2357370111918083), -INT64_C( 2150424347252562252), -INT64_C( 8851231030892423205),  INT64_C(   36031180725813248) },
+      {  INT64_C( 5045094158962737453), -INT64_C( 8282659885956470457),  INT64_C(     598138637255168), -INT64_C( 2377945700542971906),
+         INT64_C(     281479942767616),  INT64_C( 4756434533795012613),  INT64_C( 8484254352365588293), -INT64_C( 2183401016039789047) },
+      { -INT64_C( 5044830276169976766),  INT64_C( 3472665700668019497), -INT64_C( 3397613985657721156),  INT64_C( 2305843026532237312),
+        -INT64_C(      70386058264577),  INT64_C(     457406812284416), -INT64_C( 1027958589385159557), -INT64_C(   36028831378702337) },
+      { -INT64_C(     299084348918417), -INT64_C( 4814533162594993594), -INT64_C( 3397613985657721156), -INT64_C(   72542478670757906),
+         INT64_C(  999287856221266003),  INT64_C(     457406812284416), -INT64_C( 1027958589385159557),  INT64_C( 1066508342811644372) },
+      { -INT64_C( 6462024551682522843), -INT64_C( 8358117780034625534), -INT64_C( 3397613985657721156),  INT64_C( 1339205544205922494),
+         INT64_C(  997000872167612496),  INT64_C(     457406812284416), -INT64_C( 1027958589385159557),  INT64_C( 1066505993464533460) },
+      {  INT64_C( 6461725467333604426),  INT64_C( 3543584759207107140), -INT64_C( 3397613985657721156), -INT64_C( 1411308218225569984),
+         INT64_C(    2286984187871235),  INT64_C(     457406812284416), -INT64_C( 1027958589385159557),  INT64_C(       2349347110912) } },
+    { { -INT64_C( 5523189796407002951),  INT64_C( 2886099352885103481),  INT64_C(  864761498340500480),  INT64_C( 1832276134879846415),
+        -INT64_C( 6935054607462762209),  INT64_C( 4653344383714721824), -INT64_C( 5783184890824493057),  INT64_C(   36028797052518912) },
+      UINT8_C(201),
+      { -INT64_C( 9214364786060427008),  INT64_C( 1152943772076774916),  INT64_C( 9077848923736828927),  INT64_C( 4647719764326613504),
+         INT64_C( 2110487852404929189),  INT64_C( 8197818221335345242),  INT64_C( 1014704815828732935), -INT64_C( 2682826697102831820) },
+      { -INT64_C( 4420477130007351148), -INT64_C( 4656872717587448841),  INT64_C( 1170935903133112385),  INT64_C( 7742333216909517561),
+         INT64_C(  180143985094824224), -INT64_C( 9060348652277787184), -INT64_C( 8858385986978253595),  INT64_C(  288230928323446017) },
+      {  INT64_C( 4564873932646891259),  INT64_C( 2886099352885103481),  INT64_C(  864761498340500480), -INT64_C( 7102812680947827441),
+        -INT64_C( 6935054607462762209),  INT64_C( 4653344383714721824), -INT64_C(  292928197997661190),  INT64_C( 2430624565798351562) },
+      { -INT64_C( 5658579365432063959),  INT64_C( 2886099352885103481),  INT64_C(  864761498340500480),  INT64_C( 5768412270570766854),
+        -INT64_C( 6935054607462762209),  INT64_C( 4653344383714721824),  INT64_C( 3368129276971550495),  INT64_C(   36028797052520192) },
+      { -INT64_C( 1018095745633007571),  INT64_C( 2886099352885103481),  INT64_C(  864761498340500480),  INT64_C( 3611819168764592374),
+        -INT64_C( 6935054607462762209),  INT64_C( 4653344383714721824),  INT64_C( 2646352659140478749),  INT64_C(  288230928356999169) },
+      {  INT64_C(    9007250794348544),  INT64_C( 2886099352885103481),  INT64_C(  864761498340500480),  INT64_C( 4611690416478093824),
+        -INT64_C( 6935054607462762209),  INT64_C( 4653344383714721824),  INT64_C(  721776619978555394),  INT64_C(   36028797018965760) } },
+    { {  INT64_C( 2455029694714740804), -INT64_C(  323001238831345037),  INT64_C( 9196315254718463991),  INT64_C( 2305860601533961344),
+        -INT64_C( 9060113243220869120), -INT64_C(  895529601491678661),  INT64_C( 8070440636071804927),  INT64_C( 8752528303750238057) },
+      UINT8_C(117),
+      { -INT64_C(  459345474554622647),  INT64_C( 3987888480082910273), -INT64_C( 4626432668448506242),  INT64_C(    4714843298865220),
+         INT64_C( 7567187077301713659),  INT64_C( 1157427303292208160), -INT64_C(  706866014603430757),  INT64_C( 4874505676295144623) },
+      {  INT64_C(  288270028634357776), -INT64_C(  153122524870344705),  INT64_C( 2887460609599733770),  INT64_C( 7970764191673057654),
+         INT64_C( 7081234249469425446), -INT64_C( 2020651747431545821), -INT64_C(  576460825604390914),  INT64_C( 1442278072723177474) },
+      {  INT64_C( 2476923473042240230), -INT64_C(  323001238831345037),  INT64_C( 6322470997119205365),  INT64_C( 2305860601533961344),
+        -INT64_C( 7567626882481192960), -INT64_C(   32936287464981537),  INT64_C(  706857286978489189),  INT64_C( 8752528303750238057) },
+      {  INT64_C( 2455025366732243012), -INT64_C(  323001238831345037),  INT64_C( 9191741286344818687),  INT64_C( 2305860601533961344),
+        -INT64_C( 2304706071048605150),  INT64_C( 1158060632461790776), -INT64_C(  130405258005039973),  INT64_C( 8752528303750238057) },
+      {  INT64_C(  437447298180612116), -INT64_C(  323001238831345037),  INT64_C( 7495702957674119555),  INT64_C( 2305860601533961344),
+        -INT64_C( 9221804124138355452),  INT64_C(   33567417577622072),  INT64_C( 7940052902322648218),  INT64_C( 8752528303750238057) },
+      {  INT64_C( 2305843629075464256), -INT64_C(  323001238831345037),  INT64_C( 1696038328670699132),  INT64_C( 2305860601533961344),
+         INT64_C( 6917537858286137890),  INT64_C( 1152923703663789056), -INT64_C( 8070449363697795071),  INT64_C( 8752528303750238057) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r;
+
+    r = simde_mm512_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x71);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r0));
+    r = simde_mm512_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0xd8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r1));
+    r = simde_mm512_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x92);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r2));
+    r = simde_mm512_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x48);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r0[8];
+    const int64_t r1[8];
+    const int64_t r2[8];
+    const int64_t r3[8];
+  } test_vec[] = {
+    { UINT8_C( 25),
+      { -INT64_C( 2305807548620471296),  INT64_C( 6724496367672913599), -INT64_C( 4618533470357315844), -INT64_C( 1324124898304564989),
+        -INT64_C( 5565510976903088766), -INT64_C( 8495546766914882062),  INT64_C( 2562737082216897126), -INT64_C( 2383670840278450193) },
+      { -INT64_C( 1285541218374857638), -INT64_C( 5242189983783059841), -INT64_C( 4611686293305295049), -INT64_C(    9009960918732801),
+        -INT64_C( 1175509880147021825), -INT64_C(    1125951446581261), -INT64_C(    1157790039146501),  INT64_C(       8864812504160) },
+      { -INT64_C(     562949955600513),  INT64_C(     562951329153056),  INT64_C( 4022531835593544826), -INT64_C(                  73),
+        -INT64_C(  294985775599124505),  INT64_C( 3789250480635562909),  INT64_C(   21392098498446337),  INT64_C( 9220978397759371127) },
+      {  INT64_C(     598410546708608),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(       2211908173824),
+         INT64_C( 1175509871555055616),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 1284942807830262566),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(    9007749010559049),
+        -INT64_C(  290482184561688601),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(             2162688),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(     598410546708609),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(       2211908173825),
+        -INT64_C( 1175509871557087233),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(248),
+      {  INT64_C(      38775098970144),  INT64_C( 4728928681928275919),  INT64_C( 3168716139038241888), -INT64_C( 8754082843273418740),
+        -INT64_C(    4522308807229441), -INT64_C( 1224979098661879810), -INT64_C( 2306128891101577221), -INT64_C( 2342435031087054977) },
+      { -INT64_C( 4758827620924133665),  INT64_C( 4447658436458071127), -INT64_C(  108649676017762819), -INT64_C(  576462951360250123),
+        -INT64_C( 1492083690657305158), -INT64_C( 4153052648997965436), -INT64_C(  145527519461769221),  INT64_C(   72787708690302976) },
+      { -INT64_C( 5403527683760608162), -INT64_C( 2305242617882869503), -INT64_C( 4899923010977529873), -INT64_C( 1102790299142156265),
+        -INT64_C(        687731965953),  INT64_C( 2084943042843352970),  INT64_C( 2306124836378771466),  INT64_C( 1152995206248792132) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 1009158198941739264),
+         INT64_C( 1487562894249316933), -INT64_C( 3768861735660376561), -INT64_C( 2451366474500014091),  INT64_C( 3567091977395636420) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(  526331745828417259),
+        -INT64_C(    4521896993685505),  INT64_C( 1004079132257918859),  INT64_C( 2305847750858637326),  INT64_C( 3494867287378231492) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  432697446604744712),
+         INT64_C(        687731638272), -INT64_C( 2157000636881543052), -INT64_C( 2306129234700009487), -INT64_C( 3495430237333749957) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(  576460752336994569),
+        -INT64_C( 1487562481395585606), -INT64_C( 3000131144374341244), -INT64_C(  145246035895123973),  INT64_C(   72787708692400128) } },
+    { UINT8_C(129),
+      { -INT64_C( 7645888550849792182),  INT64_C( 8547708062495371057), -INT64_C( 1154057300454410881), -INT64_C( 1152925903191277569),
+        -INT64_C(  144119586126692865), -INT64_C(   76578793635971073), -INT64_C( 5509218029976375863), -INT64_C( 1152921504606912513) },
+      {  INT64_C( 2341871943672661056), -INT64_C( 2323857409871839313),  INT64_C( 2305879567994716162), -INT64_C( 9076092202832654841),
+         INT64_C( 7304472658031243685),  INT64_C(  576465150417053824),  INT64_C( 9097785824023718602), -INT64_C( 2360026944378091587) },
+      { -INT64_C(     140738042339329), -INT64_C(    2260647715311621), -INT64_C(   76167591520768834), -INT64_C( 8451983747144913560),
+        -INT64_C(  576496486471172097), -INT64_C( 6209225117933954344),  INT64_C( 3349120676279212465),  INT64_C(  586911785608196028) },
+      { -INT64_C( 7681776610901880054),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4099860230298015743) },
+      { -INT64_C( 5339904667229218998),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  586911785608261564) },
+      {  INT64_C(           537206784),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 1739833290215108541) },
+      {  INT64_C( 7681776610364673269),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2360026944378091587) } },
+    { UINT8_C(123),
+      {  INT64_C(   36028798092739648),  INT64_C( 5935289851416625252), -INT64_C( 3035165793572961689), -INT64_C(  747602022225739777),
+        -INT64_C( 1152956728170643715), -INT64_C(   72094979582329365),  INT64_C(  776908361302805227),  INT64_C( 3469478245349458944) },
+      { -INT64_C( 1337509422008084769), -INT64_C( 1154047481890209825), -INT64_C(      17596514568706), -INT64_C(     141287647625217),
+        -INT64_C(  148628730016727443),  INT64_C(    1128098930164000),  INT64_C(    9148222492639308), -INT64_C(    9108357011145601) },
+      { -INT64_C( 8826344121643490907),  INT64_C( 3579154115477683942),  INT64_C( 7798290349111978174), -INT64_C( 1152921504608976903),
+        -INT64_C( 8522912997243378762),  INT64_C( 9031798556874075455), -INT64_C( 2551498011829907859),  INT64_C( 1829026752345669636) },
+      {  INT64_C( 1336805147027835968),  INT64_C( 5931313320039759904),  INT64_C(                   0),  INT64_C( 1153062792120287238),
+         INT64_C( 7230337011424484569),  INT64_C( 8958579880703061515),  INT64_C( 2990424946947177265),  INT64_C(                   0) },
+      { -INT64_C( 7526272048762320763),  INT64_C( 3579154055415250662),  INT64_C(                   0), -INT64_C( 1152921504743194631),
+        -INT64_C( 8522913031066246476),  INT64_C( 8959705780609969963),  INT64_C( 2990424957818813309),  INT64_C(                   0) },
+      {  INT64_C(          1073775680),  INT64_C( 4779517706682712064),  INT64_C(                   0),  INT64_C( 1152921504606879750),
+         INT64_C( 7369956307727572041), -INT64_C( 9031800758044815168),  INT64_C(  164416606208524418),  INT64_C(                   0) },
+      { -INT64_C( 1336805145954125825), -INT64_C( 1154047413170733089),  INT64_C(                   0), -INT64_C(     141287513407489),
+        -INT64_C(  148628695656988817),  INT64_C(   73220877341753652), -INT64_C( 3154841553155701684),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x61);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r0));
+    r = simde_mm512_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0xa9);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r1));
+    r = simde_mm512_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x50);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r2));
+    r = simde_mm512_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0xce);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_ternarylogic_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,439 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX bmi
+#include <simde/x86/bmi.h>
+#include <test/x86/test-sse2.h>
+
+static int
+test_simde_andn_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(2150170882), UINT32_C(   1048576), UINT32_C(   1048576) },
+    { UINT32_C( 133955584), UINT32_C(3688366079), UINT32_C(3624140799) },
+    { UINT32_C(  15728640), UINT32_C(1090712096), UINT32_C(1090712096) },
+    { UINT32_C(     12288), UINT32_C(4294967227), UINT32_C(4294954939) },
+    { UINT32_C(3719848138), UINT32_C( 135267332), UINT32_C(      1028) },
+    { UINT32_C( 269322240), UINT32_C(3245548453), UINT32_C(3245482917) },
+    { UINT32_C(1891079901), UINT32_C(1073740800), UINT32_C( 256403456) },
+    { UINT32_C(1000045731), UINT32_C(2476474075), UINT32_C(2147517016) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_andn_u32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_andn_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 2305849193985540116), UINT64_C(10094344598379417371), UINT64_C(10094343911184584459) },
+    { UINT64_C(17653030750184262593), UINT64_C( 8849907905460809568), UINT64_C(  720875050058130464) },
+    { UINT64_C( 9595533934275010900), UINT64_C( 9224595534845062471), UINT64_C(    1214418126900227) },
+    { UINT64_C( 7900743031504730276), UINT64_C( 3384967659315971674), UINT64_C(  169096103021807194) },
+    { UINT64_C( 1371346086536417344), UINT64_C(    2252283618296896), UINT64_C(        483804611584) },
+    { UINT64_C( 8287165361927820369), UINT64_C(13565728259501039204), UINT64_C(10106641621925268004) },
+    { UINT64_C(18446741698584248311), UINT64_C(   37719863133209874), UINT64_C(       2199023255552) },
+    { UINT64_C( 8540310759340466606), UINT64_C(       8883879879552), UINT64_C(       8883602981376) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_andn_u64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t start;
+    uint32_t len;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(4026138343), UINT32_C(  0), UINT32_C( 32), UINT32_C(4026138343) },
+    { UINT32_C(4278122303), UINT32_C( 31), UINT32_C(  1), UINT32_C(         1) },
+    { UINT32_C(4294901760), UINT32_C( 32), UINT32_C(  3), UINT32_C(         0) },
+    { UINT32_C(2001366622), UINT32_C(  8), UINT32_C(  0), UINT32_C(         0) },
+    { UINT32_C( 419446784), UINT32_C(  2), UINT32_C( 16), UINT32_C(      4096) },
+    { UINT32_C(  25165824), UINT32_C(  6), UINT32_C( 23), UINT32_C(    393216) },
+    { UINT32_C(1065353216), UINT32_C( 16), UINT32_C(200), UINT32_C(     16256) },
+    { UINT32_C( 671352320), UINT32_C( 27), UINT32_C( 20), UINT32_C(         5) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bextr_u32(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint32_t start;
+    uint32_t len;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(18445612665703628767), UINT32_C(  0), UINT32_C( 64), UINT64_C(18445612665703628767) },
+    { UINT64_C(10094800922359416525), UINT32_C( 63), UINT32_C(  1), UINT64_C(                   1) },
+    { UINT64_C(10311689008146686207), UINT32_C( 64), UINT32_C(  3), UINT64_C(                   0) },
+    { UINT64_C( 7131150415038378689), UINT32_C( 35), UINT32_C(  0), UINT64_C(                   0) },
+    { UINT64_C( 9223372036854767616), UINT32_C( 53), UINT32_C( 58), UINT64_C(                1023) },
+    { UINT64_C(    4515161784455297), UINT32_C( 10), UINT32_C( 20), UINT64_C(              102660) },
+    { UINT64_C(                   0), UINT32_C( 54), UINT32_C(200), UINT64_C(                   0) },
+    { UINT64_C(18338620143824763901), UINT32_C(  6), UINT32_C(  8), UINT64_C(                 239) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bextr_u64(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr2_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t control;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(  25755656), UINT32_C(      2080), UINT32_C(         0) },
+    { UINT32_C(  33882112), UINT32_C(       287), UINT32_C(         0) },
+    { UINT32_C(1511898414), UINT32_C(      8192), UINT32_C(1511898414) },
+    { UINT32_C( 520093696), UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C( 976817354), UINT32_C(      2827), UINT32_C(      1825) },
+    { UINT32_C(2055206783), UINT32_C(     27238), UINT32_C(         0) },
+    { UINT32_C(   4190208), UINT32_C(     65280), UINT32_C(   4190208) },
+    { UINT32_C( 939524096), UINT32_C(      7169), UINT32_C( 201326592) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bextr2_u32(test_vec[i].a, test_vec[i].control);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr2_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t control;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 9599647366769711036), UINT64_C(                2112), UINT64_C(                   0) },
+    { UINT64_C(15574613840450096169), UINT64_C(                 319), UINT64_C(                   1) },
+    { UINT64_C(   18014993496678913), UINT64_C(               16384), UINT64_C(   18014993496678913) },
+    { UINT64_C(12535206157563721723), UINT64_C(                   0), UINT64_C(                   0) },
+    { UINT64_C( 4611685949707911168), UINT64_C(               10026), UINT64_C(             1048575) },
+    { UINT64_C( 7394532407365559052), UINT64_C(               52154), UINT64_C(                   0) },
+    { UINT64_C(18446739675663036415), UINT64_C(               65289), UINT64_C(   36028788429029367) },
+    { UINT64_C( 6823625192572050887), UINT64_C(                2056), UINT64_C(                 221) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bextr2_u64(test_vec[i].a, test_vec[i].control);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsi_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(2147483648), UINT32_C(2147483648) },
+    { UINT32_C(1517178598), UINT32_C(         2) },
+    { UINT32_C(   2093056), UINT32_C(      4096) },
+    { UINT32_C(4252499711), UINT32_C(         1) },
+    { UINT32_C(2130706432), UINT32_C(  16777216) },
+    { UINT32_C(  32505856), UINT32_C(   1048576) },
+    { UINT32_C(2154990626), UINT32_C(         2) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsi_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsi_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0), UINT64_C(                   0) },
+    { UINT64_C( 9223372036854775808), UINT64_C( 9223372036854775808) },
+    { UINT64_C(  144119672558584960), UINT64_C(                 128) },
+    { UINT64_C(   20266336032654528), UINT64_C(                  64) },
+    { UINT64_C(11392374519552018585), UINT64_C(                   1) },
+    { UINT64_C( 3924018417461032849), UINT64_C(                   1) },
+    { UINT64_C(  285978576338026496), UINT64_C(    2251799813685248) },
+    { UINT64_C(      34084860461056), UINT64_C(       1099511627776) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsi_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsmsk_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),        UINT32_MAX },
+    { UINT32_C(2147483648),        UINT32_MAX },
+    { UINT32_C(3710522068), UINT32_C(         7) },
+    { UINT32_C(1048184220), UINT32_C(         7) },
+    { UINT32_C(3495056034), UINT32_C(         3) },
+    { UINT32_C(  25690626), UINT32_C(         3) },
+    { UINT32_C(2499881647), UINT32_C(         1) },
+    { UINT32_C(4160684026), UINT32_C(         3) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsmsk_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsmsk_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),                  UINT64_MAX },
+    { UINT64_C( 9223372036854775808),                  UINT64_MAX },
+    { UINT64_C(                   0),                  UINT64_MAX },
+    { UINT64_C(   72056494526300160), UINT64_C(       2199023255551) },
+    { UINT64_C(18446673567255281663), UINT64_C(                   1) },
+    { UINT64_C(  614402011229412375), UINT64_C(                   1) },
+    { UINT64_C( 1152921229728940032), UINT64_C(        549755813887) },
+    { UINT64_C(    4503599627239424), UINT64_C(              262143) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsmsk_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsr_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(2147483648), UINT32_C(         0) },
+    { UINT32_C(   1049600), UINT32_C(   1048576) },
+    { UINT32_C(  67108863), UINT32_C(  67108862) },
+    { UINT32_C(  33292288), UINT32_C(  33030144) },
+    { UINT32_C(2141192191), UINT32_C(2141192190) },
+    { UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(3633216285), UINT32_C(3633216284) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsr_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsr_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0), UINT64_C(                   0) },
+    { UINT64_C( 9223372036854775808), UINT64_C(                   0) },
+    { UINT64_C( 9204231651998038006), UINT64_C( 9204231651998038004) },
+    { UINT64_C(18446721937397772287), UINT64_C(18446721937397772286) },
+    { UINT64_C( 2596325194842775558), UINT64_C( 2596325194842775556) },
+    { UINT64_C(14023978349422183998), UINT64_C(14023978349422183996) },
+    { UINT64_C( 3039434438205095031), UINT64_C( 3039434438205095030) },
+    { UINT64_C( 1513218408596905986), UINT64_C( 1513218408596905984) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsr_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tzcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0), UINT32_C(        32) },
+    { UINT32_C(2147483648), UINT32_C(        31) },
+    { UINT32_C(         1), UINT32_C(         0) },
+    {        UINT32_MAX, UINT32_C(         0) },
+    { UINT32_C( 662652196), UINT32_C(         2) },
+    { UINT32_C(4294966527), UINT32_C(         0) },
+    { UINT32_C(2121691404), UINT32_C(         2) },
+    { UINT32_C(    491520), UINT32_C(        15) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_tzcnt_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tzcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0), UINT64_C(                  64) },
+    { UINT64_C( 9223372036854775808), UINT64_C(                  63) },
+    { UINT64_C(                   1), UINT64_C(                   0) },
+    {                  UINT64_MAX, UINT64_C(                   0) },
+    { UINT64_C( 9141570972229884422), UINT64_C(                   1) },
+    { UINT64_C( 9268693910450881280), UINT64_C(                   8) },
+    { UINT64_C(17145185085393731583), UINT64_C(                   0) },
+    { UINT64_C(17335072322022999509), UINT64_C(                   0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_tzcnt_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_lzcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0), UINT32_C(        32) },
+    { UINT32_C(2147483648), UINT32_C(         0) },
+    { UINT32_C(         1), UINT32_C(        31) },
+    {        UINT32_MAX, UINT32_C(         0) },
+    { UINT32_C(2181300289), UINT32_C(         0) },
+    { UINT32_C(      4224), UINT32_C(        19) },
+    { UINT32_C( 881451027), UINT32_C(         2) },
+    { UINT32_C(4292870144), UINT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_lzcnt_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_lzcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0), UINT64_C(                  64) },
+    { UINT64_C( 9223372036854775808), UINT64_C(                   0) },
+    { UINT64_C(                   1), UINT64_C(                  63) },
+    {                  UINT64_MAX, UINT64_C(                   0) },
+    { UINT64_C( 6365214000797046695), UINT64_C(                   1) },
+    { UINT64_C(18446708313811713791), UINT64_C(                   0) },
+    { UINT64_C(17275808149113667582), UINT64_C(                   0) },
+    { UINT64_C( 8123196413480981705), UINT64_C(                   1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_lzcnt_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(andn_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(andn_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr2_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr2_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsi_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsi_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsmsk_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsmsk_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsr_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsr_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(lzcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(lzcnt_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -0,0 +1,261 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX bmi2
+#include <simde/x86/bmi2.h>
+#include <test/x86/test-sse2.h>
+
+static int
+test_simde_bzhi_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t index;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(2150170882), UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(1242812974), UINT32_C(        32), UINT32_C(1242812974) },
+    { UINT32_C(1406030606), UINT32_C(        31), UINT32_C(1406030606) },
+    { UINT32_C( 270008480), UINT32_C(       255), UINT32_C( 270008480) },
+    { UINT32_C(3719848138), UINT32_C(      4660), UINT32_C(3719848138) },
+    { UINT32_C(   1409057), UINT32_C(        28), UINT32_C(   1409057) },
+    { UINT32_C(1000045731), UINT32_C(        24), UINT32_C(  10189987) },
+    { UINT32_C(4269799407), UINT32_C(        29), UINT32_C( 511703023) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bzhi_u32(test_vec[i].a, test_vec[i].index);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bzhi_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint32_t index;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 2209896689368110491), UINT32_C(         0), UINT64_C(                   0) },
+    { UINT64_C( 3384967659315971674), UINT32_C(        64), UINT64_C( 3384967659315971674) },
+    { UINT64_C( 8334267031711489754), UINT32_C(        63), UINT64_C( 8334267031711489754) },
+    { UINT64_C( 1152921367167893504), UINT32_C(       255), UINT64_C( 1152921367167893504) },
+    { UINT64_C(                 480), UINT32_C(      4670), UINT64_C(                 480) },
+    { UINT64_C( 8646317449773583102), UINT32_C(         2), UINT64_C(                   2) },
+    { UINT64_C(            67043328), UINT32_C(        59), UINT64_C(            67043328) },
+    { UINT64_C(18428166171195856767), UINT32_C(         1), UINT64_C(                   1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bzhi_u64(test_vec[i].a, test_vec[i].index);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mulx_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t lo;
+    uint32_t hi;
+  } test_vec[] = {
+    {        UINT32_MAX,        UINT32_MAX,
+      UINT32_C(         1), UINT32_C(4294967294) },
+    { UINT32_C(2666222411), UINT32_C(   1048572),
+      UINT32_C(3103961812), UINT32_C(    650930) },
+    { UINT32_C(2529096538), UINT32_C(   4128768),
+      UINT32_C(3810918400), UINT32_C(   2431229) },
+    { UINT32_C(         0), UINT32_C( 104939536),
+      UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(2071920383), UINT32_C(2001366622),
+      UINT32_C( 686371746), UINT32_C( 965472380) },
+    { UINT32_C( 583632882), UINT32_C(  33488896),
+      UINT32_C(1544421376), UINT32_C(   4550726) },
+    { UINT32_C(1226074068), UINT32_C(2444684304),
+      UINT32_C(1169550656), UINT32_C( 697878196) },
+    { UINT32_C(3547706105), UINT32_C(4018649849),
+      UINT32_C( 164822577), UINT32_C(3319463833) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t hi;
+    uint32_t lo = simde_mulx_u32(test_vec[i].a, test_vec[i].b, &hi);
+    simde_assert_equal_u32(lo, test_vec[i].lo);
+    simde_assert_equal_u32(hi, test_vec[i].hi);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mulx_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t lo;
+    uint64_t hi;
+  } test_vec[] = {
+    {                  UINT64_MAX,                  UINT64_MAX,
+      UINT64_C(                   1), UINT64_C(18446744073709551614) },
+    { UINT64_C(   72057594172162048), UINT64_C( 1227266735700183041),
+      UINT64_C(14498917629835624448), UINT64_C(    4794010695259470) },
+    { UINT64_C( 6995953617331435986), UINT64_C(    2251799805296640),
+      UINT64_C( 7977824250021019648), UINT64_C(     853998241121762) },
+    { UINT64_C(    4503599627366400), UINT64_C( 7621473855854535475),
+      UINT64_C(16469251304910016512), UINT64_C(    1860711390587793) },
+    { UINT64_C(16080922520692138166), UINT64_C( 1116892707587883008),
+      UINT64_C(  360287970189639680), UINT64_C(  973649605745031803) },
+    { UINT64_C(13484473891936914363), UINT64_C(    1125891316908032),
+      UINT64_C(18379305021213769728), UINT64_C(     823020691745943) },
+    { UINT64_C(  576744462273740864), UINT64_C(13690889540881874942),
+      UINT64_C( 3077607740323921792), UINT64_C(  428050863325997406) },
+    { UINT64_C( 1678990180929823334), UINT64_C( 2522860259242934276),
+      UINT64_C( 9936790771380488600), UINT64_C(  229626300782474324) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t hi;
+    uint64_t lo = simde_mulx_u64(test_vec[i].a, test_vec[i].b, &hi);
+    simde_assert_equal_u64(lo, test_vec[i].lo);
+    simde_assert_equal_u64(hi, test_vec[i].hi);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pdep_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t mask;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(1393417061),        UINT32_MAX, UINT32_C(1393417061) },
+    { UINT32_C(3149922302), UINT32_C(1431655765), UINT32_C(1431655764) },
+    { UINT32_C(  15730788), UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(3758014399), UINT32_C(         1), UINT32_C(         1) },
+    { UINT32_C( 965672189), UINT32_C(  10625216), UINT32_C(  10625088) },
+    { UINT32_C( 949368599), UINT32_C(1921830384), UINT32_C( 302809456) },
+    { UINT32_C(         0), UINT32_C(4284473343), UINT32_C(         0) },
+    { UINT32_C(3892313999), UINT32_C(1504501136), UINT32_C(1504478608) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_pdep_u32(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pdep_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t mask;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 9692629971871786778),                  UINT64_MAX, UINT64_C( 9692629971871786778) },
+    { UINT64_C(10629794472869083250), UINT64_C( 6148914691236517205), UINT64_C(    5717534640706820) },
+    { UINT64_C(18446708888261337087), UINT64_C(                   0), UINT64_C(                   0) },
+    { UINT64_C(11694699648148060364), UINT64_C(                   0), UINT64_C(                   0) },
+    { UINT64_C(18330985825985058557), UINT64_C(          4294967296), UINT64_C(          4294967296) },
+    { UINT64_C(14838911743762835679), UINT64_C(   22517998138425344), UINT64_C(   22517998138425344) },
+    { UINT64_C(13835058055282163712), UINT64_C(           125829120), UINT64_C(                   0) },
+    { UINT64_C( 5615096408333454809), UINT64_C(  180214353906172928), UINT64_C(   36099165763142656) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_pdep_u64(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pext_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t mask;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),        UINT32_MAX, UINT32_C(         0) },
+    { UINT32_C(  25755656), UINT32_C(1431655765), UINT32_C(      4352) },
+    { UINT32_C(1333052432), UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(  31457280), UINT32_C( 134217729), UINT32_C(         0) },
+    { UINT32_C(1511898414), UINT32_C(         0), UINT32_C(         0) },
+    { UINT32_C(   8390656), UINT32_C(1659175087), UINT32_C(      1024) },
+    { UINT32_C(1073733632), UINT32_C(3486026457), UINT32_C(     32640) },
+    { UINT32_C(   2625546), UINT32_C( 976817354), UINT32_C(       643) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_pext_u32(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pext_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t mask;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 3261771934220269126),                  UINT64_MAX, UINT64_C( 3261771934220269126) },
+    { UINT64_C(12393905487328697855), UINT64_C( 6148914691236517205), UINT64_C(           536870911) },
+    { UINT64_C(     422379968806916), UINT64_C(                   0), UINT64_C(                   0) },
+    { UINT64_C(16696721739553433807), UINT64_C( 2594074484910587936), UINT64_C(                  30) },
+    { UINT64_C(   72056494526300160), UINT64_C( 1152921504606846976), UINT64_C(                   0) },
+    { UINT64_C(17870001845279129599), UINT64_C(17035308098863610283), UINT64_C(          2009067519) },
+    { UINT64_C(       4967339395212), UINT64_C( 9599647366769711036), UINT64_C(             1048595) },
+    { UINT64_C(16685636578207641960), UINT64_C(15041745725343321605), UINT64_C(           444090176) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_pext_u64(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(bzhi_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bzhi_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mulx_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mulx_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pdep_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pdep_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pext_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pext_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -374,12 +374,66 @@ test_simde_mm512_clmulepi64_epi128 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_x_crc32c_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const uint8_t data[320] = {
+    UINT8_C( 70), UINT8_C(100), UINT8_C( 49), UINT8_C( 41), UINT8_C(100), UINT8_C(134), UINT8_C(237), UINT8_C(156), UINT8_C(215), UINT8_C( 31), UINT8_C(194), UINT8_C(  7), UINT8_C( 37), UINT8_C( 72), UINT8_C( 32), UINT8_C(162),
+    UINT8_C(196), UINT8_C(168), UINT8_C( 90), UINT8_C(235), UINT8_C( 11), UINT8_C( 32), UINT8_C( 65), UINT8_C( 73), UINT8_C( 79), UINT8_C(139), UINT8_C(241), UINT8_C(248), UINT8_C(205), UINT8_C( 48), UINT8_C(241), UINT8_C( 19),
+    UINT8_C(148), UINT8_C( 34), UINT8_C( 60), UINT8_C(248), UINT8_C(168), UINT8_C( 41), UINT8_C(149), UINT8_C(128), UINT8_C( 73), UINT8_C( 87), UINT8_C(135), UINT8_C(110), UINT8_C(159), UINT8_C(167), UINT8_C( 17), UINT8_C( 99),
+    UINT8_C( 80), UINT8_C(107), UINT8_C( 78), UINT8_C( 91), UINT8_C(140), UINT8_C(143), UINT8_C(164), UINT8_C(219), UINT8_C( 27), UINT8_C(149), UINT8_C(211), UINT8_C(232), UINT8_C(197), UINT8_C(197), UINT8_C(251), UINT8_C( 90),
+    UINT8_C(231), UINT8_C( 55), UINT8_C( 82), UINT8_C(144), UINT8_C( 96), UINT8_C(231), UINT8_C( 16), UINT8_C(169), UINT8_C( 62), UINT8_C(151), UINT8_C( 24), UINT8_C(221), UINT8_C( 62), UINT8_C( 41), UINT8_C( 65), UINT8_C(142),
+    UINT8_C(148), UINT8_C(143), UINT8_C(233), UINT8_C( 32), UINT8_C( 31), UINT8_C(141), UINT8_C(251), UINT8_C( 58), UINT8_C( 34), UINT8_C(207), UINT8_C( 34), UINT8_C(232), UINT8_C(148), UINT8_C( 29), UINT8_C( 66), UINT8_C(123),
+    UINT8_C( 84), UINT8_C(148), UINT8_C( 11), UINT8_C(180), UINT8_C(124), UINT8_C( 27), UINT8_C( 94), UINT8_C(186), UINT8_C(178), UINT8_C(118), UINT8_C(152), UINT8_C(241), UINT8_C(159), UINT8_C(217), UINT8_C(127), UINT8_C( 51),
+    UINT8_C(104), UINT8_C(105), UINT8_C( 84), UINT8_C(135), UINT8_C(246), UINT8_C( 79), UINT8_C(193), UINT8_C( 25), UINT8_C( 30), UINT8_C(227), UINT8_C(  1), UINT8_C(178), UINT8_C(  0), UINT8_C( 67), UINT8_C( 46), UINT8_C( 84),
+    UINT8_C(215), UINT8_C( 57), UINT8_C(  9), UINT8_C( 83), UINT8_C( 85), UINT8_C(103), UINT8_C( 14), UINT8_C(  7), UINT8_C(221), UINT8_C(166), UINT8_C(248), UINT8_C(124), UINT8_C(127), UINT8_C(120), UINT8_C(175), UINT8_C(231),
+    UINT8_C(225), UINT8_C(  3), UINT8_C(111), UINT8_C(215), UINT8_C( 83), UINT8_C( 48), UINT8_C(240), UINT8_C(113), UINT8_C( 20), UINT8_C(241), UINT8_C( 36), UINT8_C( 20), UINT8_C( 52), UINT8_C( 82), UINT8_C(105), UINT8_C( 12),
+    UINT8_C(139), UINT8_C(114), UINT8_C( 95), UINT8_C(224), UINT8_C(217), UINT8_C(109), UINT8_C(232), UINT8_C(182), UINT8_C( 19), UINT8_C(224), UINT8_C( 50), UINT8_C(146), UINT8_C( 88), UINT8_C(225), UINT8_C(122), UINT8_C( 57),
+    UINT8_C(229), UINT8_C(233), UINT8_C( 17), UINT8_C( 56), UINT8_C( 25), UINT8_C(  1), UINT8_C(169), UINT8_C( 45), UINT8_C(243), UINT8_C(205), UINT8_C( 66), UINT8_C( 39), UINT8_C( 31), UINT8_C(171), UINT8_C( 51), UINT8_C(171),
+    UINT8_C( 29), UINT8_C(147), UINT8_C(139), UINT8_C(246), UINT8_C(  0), UINT8_C(115), UINT8_C(172), UINT8_C( 20), UINT8_C( 84), UINT8_C(222), UINT8_C(166), UINT8_C(172), UINT8_C(191), UINT8_C( 32), UINT8_C(230), UINT8_C(164),
+    UINT8_C(  9), UINT8_C(247), UINT8_C(220), UINT8_C( 35), UINT8_C(248), UINT8_C(134), UINT8_C( 80), UINT8_C(235), UINT8_C( 83), UINT8_C(146), UINT8_C( 19), UINT8_C(115), UINT8_C( 61), UINT8_C( 70), UINT8_C( 30), UINT8_C( 90),
+    UINT8_C(217), UINT8_C(169), UINT8_C( 80), UINT8_C(218), UINT8_C( 29), UINT8_C(252), UINT8_C(238), UINT8_C(113), UINT8_C(218), UINT8_C(148), UINT8_C( 29), UINT8_C(154), UINT8_C(181), UINT8_C(  3), UINT8_C( 62), UINT8_C(190),
+    UINT8_C(250), UINT8_C( 27), UINT8_C(225), UINT8_C(243), UINT8_C(161), UINT8_C( 50), UINT8_C(222), UINT8_C(244), UINT8_C(196), UINT8_C(241), UINT8_C(103), UINT8_C(  2), UINT8_C( 56), UINT8_C(133), UINT8_C( 92), UINT8_C( 17),
+    UINT8_C( 47), UINT8_C(173), UINT8_C(235), UINT8_C( 76), UINT8_C(169), UINT8_C(217), UINT8_C(189), UINT8_C(132), UINT8_C(110), UINT8_C(218), UINT8_C( 30), UINT8_C( 35), UINT8_C(222), UINT8_C( 92), UINT8_C(225), UINT8_C(216),
+    UINT8_C(119), UINT8_C(195), UINT8_C(203), UINT8_C( 24), UINT8_C(245), UINT8_C(170), UINT8_C( 13), UINT8_C(185), UINT8_C(155), UINT8_C(116), UINT8_C(187), UINT8_C(211), UINT8_C(250), UINT8_C( 24), UINT8_C(229), UINT8_C( 41),
+    UINT8_C(197), UINT8_C(208), UINT8_C(117), UINT8_C(110), UINT8_C(170), UINT8_C( 50), UINT8_C(242), UINT8_C( 24), UINT8_C( 12), UINT8_C( 16), UINT8_C( 59), UINT8_C(234), UINT8_C(109), UINT8_C( 28), UINT8_C(195), UINT8_C(228),
+    UINT8_C(223), UINT8_C(142), UINT8_C(253), UINT8_C(212), UINT8_C( 56), UINT8_C( 10), UINT8_C(142), UINT8_C(212), UINT8_C(126), UINT8_C( 73), UINT8_C(167), UINT8_C(120), UINT8_C( 97), UINT8_C(140), UINT8_C(161), UINT8_C( 38)
+  };
+  static const struct {
+    const uint32_t crc;
+    const size_t offset;
+    const size_t len;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C( 753711693),   0,   0, UINT32_C( 753711693) },
+    { UINT32_C(1665572918),   3,   1, UINT32_C(1311686123) },
+    { UINT32_C(1598452741),   1,   7, UINT32_C(2852089264) },
+    { UINT32_C(3477905367),   0,  16, UINT32_C(2040610403) },
+    { UINT32_C( 567152584),   5,  63, UINT32_C(2300860548) },
+    { UINT32_C( 811776599),   0,  64, UINT32_C(3764108204) },
+    { UINT32_C(1896438127),   7,  65, UINT32_C(1933207790) },
+    { UINT32_C(  88530629),   2, 127, UINT32_C(2186057427) },
+    { UINT32_C(1557293336),   0, 200, UINT32_C( 254433926) },
+    { UINT32_C( 991946042),  11, 256, UINT32_C(2794747525) },
+    { UINT32_C(3536615055),   0, 320, UINT32_C(1884562886) },
+    { UINT32_C(3004805493),   9, 311, UINT32_C(1091580398) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_x_crc32c_buffer(test_vec[i].crc, &(data[test_vec[i].offset]), test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(x_clmul_u64)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_clmulepi64_epi128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_clmulepi64_epi128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_clmulepi64_epi128)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_crc32c_buffer)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
@@ -7,8 +7,13 @@ SIMDE_TEST_DECLARE_SUITE(sse4_1)
 SIMDE_TEST_DECLARE_SUITE(sse4_2)
 SIMDE_TEST_DECLARE_SUITE(avx)
 SIMDE_TEST_DECLARE_SUITE(avx2)
+SIMDE_TEST_DECLARE_SUITE(bmi)
+SIMDE_TEST_DECLARE_SUITE(bmi2)
+SIMDE_TEST_DECLARE_SUITE(f16c)
 SIMDE_TEST_DECLARE_SUITE(fma)
 SIMDE_TEST_DECLARE_SUITE(gfni)
+SIMDE_TEST_DECLARE_SUITE(aes)
 SIMDE_TEST_DECLARE_SUITE(clmul)
+SIMDE_TEST_DECLARE_SUITE(sha)
 SIMDE_TEST_DECLARE_SUITE(svml)
 SIMDE_TEST_DECLARE_SUITE(xop)
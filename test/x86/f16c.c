@@ -0,0 +1,411 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX f16c
+#include <simde/x86/f16c.h>
+#include <test/x86/test-avx.h>
+
+static int
+test_simde_mm_cvtph_ps(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { UINT16_C(13366), UINT16_C(14803), UINT16_C(50740), UINT16_C(49258), UINT16_C(33791), UINT16_C(17227), UINT16_C(12996), UINT16_C(31744) },
+      {    SIMDE_FLOAT32_C(0.263183594),    SIMDE_FLOAT32_C(0.728027344),    SIMDE_FLOAT32_C(-6.20312500),    SIMDE_FLOAT32_C(-2.20703125) } },
+    { { UINT16_C(48809), UINT16_C(45571), UINT16_C(22821), UINT16_C(16649), UINT16_C(59785), UINT16_C(31744), UINT16_C(    1), UINT16_C(17796) },
+      {    SIMDE_FLOAT32_C(-1.66503906),   SIMDE_FLOAT32_C(-0.187866211),     SIMDE_FLOAT32_C(164.625000),     SIMDE_FLOAT32_C(2.51757812) } },
+    { { UINT16_C(50135), UINT16_C(14308), UINT16_C(    0), UINT16_C(32860), UINT16_C(54490), UINT16_C(32975), UINT16_C(39804), UINT16_C(32256) },
+      {    SIMDE_FLOAT32_C(-3.91992188),    SIMDE_FLOAT32_C(0.493164062),     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-5.48362732e-06) } },
+    { { UINT16_C(45453), UINT16_C( 1024), UINT16_C(13774), UINT16_C( 7920), UINT16_C(  641), UINT16_C(13653), UINT16_C(59887), UINT16_C(50592) },
+      {   SIMDE_FLOAT32_C(-0.173461914), SIMDE_FLOAT32_C(6.10351562e-05),    SIMDE_FLOAT32_C(0.362792969),  SIMDE_FLOAT32_C(0.00677490234) } },
+    { { UINT16_C(  605), UINT16_C(  673), UINT16_C(30292), UINT16_C(51037), UINT16_C(27248), UINT16_C(16423), UINT16_C(32256), UINT16_C(32984) },
+      { SIMDE_FLOAT32_C(3.60608101e-05), SIMDE_FLOAT32_C(4.01139259e-05),     SIMDE_FLOAT32_C(25920.0000),    SIMDE_FLOAT32_C(-7.36328125) } },
+    { { UINT16_C(44275), UINT16_C(15995), UINT16_C( 6298), UINT16_C(64512), UINT16_C(15299), UINT16_C(27548), UINT16_C(33146), UINT16_C(50225) },
+      {  SIMDE_FLOAT32_C(-0.0773315430),     SIMDE_FLOAT32_C(1.62011719),  SIMDE_FLOAT32_C(0.00224685669),           -SIMDE_MATH_INFINITYF } },
+    { { UINT16_C(47027), UINT16_C(35866), UINT16_C( 1024), UINT16_C(  850), UINT16_C(36604), UINT16_C(17313), UINT16_C(12832), UINT16_C(13153) },
+      {   SIMDE_FLOAT32_C(-0.481201172), SIMDE_FLOAT32_C(-0.000250339508), SIMDE_FLOAT32_C(6.10351562e-05), SIMDE_FLOAT32_C(5.06639481e-05) } },
+    { { UINT16_C(14181), UINT16_C(29296), UINT16_C(  950), UINT16_C(59711), UINT16_C( 7894), UINT16_C(50759), UINT16_C(  898), UINT16_C(47907) },
+      {    SIMDE_FLOAT32_C(0.462158203),     SIMDE_FLOAT32_C(13184.0000), SIMDE_FLOAT32_C(5.66244125e-05),    SIMDE_FLOAT32_C(-2686.00000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128 r = simde_mm_cvtph_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtph_ps(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    simde_float32 r[8];
+  } test_vec[] = {
+    { { UINT16_C(17315), UINT16_C(50702), UINT16_C(16415), UINT16_C(47198), UINT16_C(45737), UINT16_C(13852), UINT16_C(26448), UINT16_C(56512) },
+      {     SIMDE_FLOAT32_C(3.81835938),    SIMDE_FLOAT32_C(-6.05468750),     SIMDE_FLOAT32_C(2.06054688),   SIMDE_FLOAT32_C(-0.545898438),
+          SIMDE_FLOAT32_C(-0.208129883),    SIMDE_FLOAT32_C(0.381835938),     SIMDE_FLOAT32_C(1872.00000),    SIMDE_FLOAT32_C(-304.000000) } },
+    { { UINT16_C(49078), UINT16_C(46529), UINT16_C(45782), UINT16_C(14839), UINT16_C(12322), UINT16_C(42226), UINT16_C(55935), UINT16_C(25504) },
+      {    SIMDE_FLOAT32_C(-1.92773438),   SIMDE_FLOAT32_C(-0.359619141),   SIMDE_FLOAT32_C(-0.213623047),    SIMDE_FLOAT32_C(0.745605469),
+           SIMDE_FLOAT32_C(0.129150391),  SIMDE_FLOAT32_C(-0.0193176270),    SIMDE_FLOAT32_C(-207.875000),     SIMDE_FLOAT32_C(976.000000) } },
+    { { UINT16_C(19204), UINT16_C(15446), UINT16_C(52451), UINT16_C(17715), UINT16_C(45898), UINT16_C(15360), UINT16_C(40584), UINT16_C(17984) },
+      {     SIMDE_FLOAT32_C(14.0312500),     SIMDE_FLOAT32_C(1.08398438),    SIMDE_FLOAT32_C(-19.5468750),     SIMDE_FLOAT32_C(5.19921875),
+          SIMDE_FLOAT32_C(-0.227783203),     SIMDE_FLOAT32_C(1.00000000), SIMDE_FLOAT32_C(-0.00637817383),     SIMDE_FLOAT32_C(6.25000000) } },
+    { { UINT16_C(50802), UINT16_C(64512), UINT16_C(45217), UINT16_C(46544), UINT16_C(    0), UINT16_C(15186), UINT16_C(12574), UINT16_C(46170) },
+      {    SIMDE_FLOAT32_C(-6.44531250),           -SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.144653320),   SIMDE_FLOAT32_C(-0.363281250),
+            SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(0.915039062),    SIMDE_FLOAT32_C(0.159912109),   SIMDE_FLOAT32_C(-0.271972656) } },
+    { { UINT16_C(12304), UINT16_C(49277), UINT16_C(45265), UINT16_C(48914), UINT16_C( 1024), UINT16_C(26431), UINT16_C(13791), UINT16_C(33182) },
+      {    SIMDE_FLOAT32_C(0.126953125),    SIMDE_FLOAT32_C(-2.24414062),   SIMDE_FLOAT32_C(-0.150512695),    SIMDE_FLOAT32_C(-1.76757812),
+        SIMDE_FLOAT32_C(6.10351562e-05),     SIMDE_FLOAT32_C(1855.00000),    SIMDE_FLOAT32_C(0.366943359), SIMDE_FLOAT32_C(-2.46763229e-05) } },
+    { { UINT16_C(13763), UINT16_C(49594), UINT16_C(47624), UINT16_C(15442), UINT16_C(42960), UINT16_C(17933), UINT16_C(17811), UINT16_C(10595) },
+      {    SIMDE_FLOAT32_C(0.360107422),    SIMDE_FLOAT32_C(-2.86328125),   SIMDE_FLOAT32_C(-0.753906250),     SIMDE_FLOAT32_C(1.08007812),
+         SIMDE_FLOAT32_C(-0.0305175781),     SIMDE_FLOAT32_C(6.05078125),     SIMDE_FLOAT32_C(5.57421875),   SIMDE_FLOAT32_C(0.0420837402) } },
+    { { UINT16_C(32768), UINT16_C(17213), UINT16_C(55998), UINT16_C(48111), UINT16_C(47876), UINT16_C(15111), UINT16_C(15360), UINT16_C(45102) },
+      {    SIMDE_FLOAT32_C(-0.00000000),     SIMDE_FLOAT32_C(3.61914062),    SIMDE_FLOAT32_C(-215.750000),   SIMDE_FLOAT32_C(-0.991699219),
+          SIMDE_FLOAT32_C(-0.876953125),    SIMDE_FLOAT32_C(0.878417969),     SIMDE_FLOAT32_C(1.00000000),   SIMDE_FLOAT32_C(-0.130615234) } },
+    { { UINT16_C(13960), UINT16_C(46920), UINT16_C(45963), UINT16_C(16808), UINT16_C(64511), UINT16_C(16916), UINT16_C(48955), UINT16_C(46099) },
+      {    SIMDE_FLOAT32_C(0.408203125),   SIMDE_FLOAT32_C(-0.455078125),   SIMDE_FLOAT32_C(-0.235717773),     SIMDE_FLOAT32_C(2.82812500),
+           SIMDE_FLOAT32_C(-65504.0000),     SIMDE_FLOAT32_C(3.03906250),    SIMDE_FLOAT32_C(-1.80761719),   SIMDE_FLOAT32_C(-0.254638672) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m256 r = simde_mm256_cvtph_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtps_ph_nearest(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(2.98023224e-08),   SIMDE_FLOAT32_C(-0.435760498),    SIMDE_FLOAT32_C(-2.36157227),   SIMDE_FLOAT32_C(-0.246459961) },
+      { UINT16_C(    0), UINT16_C(46841), UINT16_C(49337), UINT16_C(46051), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(65504.0000), SIMDE_FLOAT32_C(5.93662262e-05),     SIMDE_FLOAT32_C(164.671875) },
+      { UINT16_C(    0), UINT16_C(31743), UINT16_C(  996), UINT16_C(22821), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(4.86746430e-05),     SIMDE_FLOAT32_C(5.51855469),    SIMDE_FLOAT32_C(-58.8242188),     SIMDE_FLOAT32_C(1.87756348) },
+      { UINT16_C(  817), UINT16_C(17797), UINT16_C(54106), UINT16_C(16259), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(-3.16235352),   SIMDE_FLOAT32_C(-0.173461914) },
+      { UINT16_C(31744), UINT16_C(    0), UINT16_C(49747), UINT16_C(45453), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(-1.54577637),     SIMDE_FLOAT32_C(44540.0000),    SIMDE_FLOAT32_C(-1.29479980),    SIMDE_FLOAT32_C(0.903137207) },
+      { UINT16_C(48687), UINT16_C(31088), UINT16_C(48430), UINT16_C(15162), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(6.10500574e-05), SIMDE_FLOAT32_C(-1.29118562e-05),    SIMDE_FLOAT32_C(-38580.0000),    SIMDE_FLOAT32_C(-65520.0000) },
+      { UINT16_C( 1024), UINT16_C(32985), UINT16_C(63670), UINT16_C(64512), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {   SIMDE_FLOAT32_C(-0.801025391),    SIMDE_FLOAT32_C(-1.74389648),                -SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(0.0572967529) },
+      { UINT16_C(47720), UINT16_C(48890), UINT16_C(65024), UINT16_C(11094), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(-3.67382812),    SIMDE_FLOAT32_C(-6.79003906),           -SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(1.63989258) },
+      { UINT16_C(50009), UINT16_C(50890), UINT16_C(64512), UINT16_C(16015), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtps_ph_ninf(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { {   SIMDE_FLOAT32_C(-0.218261719),     SIMDE_FLOAT32_C(836.812500),     SIMDE_FLOAT32_C(65520.0000),   SIMDE_FLOAT32_C(-0.202590942) },
+      { UINT16_C(45820), UINT16_C(25225), UINT16_C(31743), UINT16_C(45692), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {                -SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(310.031250),     SIMDE_FLOAT32_C(1.44079590),    SIMDE_FLOAT32_C(0.984436035) },
+      { UINT16_C(65024), UINT16_C(23768), UINT16_C(15811), UINT16_C(15328), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(8.94069672e-08),   SIMDE_FLOAT32_C(-0.198699951), SIMDE_FLOAT32_C(-0.000104725361),   SIMDE_FLOAT32_C(-0.126525879) },
+      { UINT16_C(    1), UINT16_C(45660), UINT16_C(34525), UINT16_C(45069), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(8.94069672e-08), SIMDE_FLOAT32_C(-2.98023224e-08),    SIMDE_FLOAT32_C(-3.86987305),                 SIMDE_MATH_NANF },
+      { UINT16_C(    1), UINT16_C(32769), UINT16_C(50110), UINT16_C(32256), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(-3.19946289), SIMDE_FLOAT32_C(-0.00539588928),    SIMDE_FLOAT32_C(-415.062500),   SIMDE_FLOAT32_C(-0.172164917) },
+      { UINT16_C(49767), UINT16_C(40327), UINT16_C(56957), UINT16_C(45443), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {   SIMDE_FLOAT32_C(0.0549392700),    SIMDE_FLOAT32_C(-6.64599609),   SIMDE_FLOAT32_C(-0.846069336),    SIMDE_FLOAT32_C(-7.15869141) },
+      { UINT16_C(11016), UINT16_C(50854), UINT16_C(47813), UINT16_C(50985), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {   SIMDE_FLOAT32_C(-0.188201904),    SIMDE_FLOAT32_C(-1119.12500), SIMDE_FLOAT32_C(-2.17333436e-05),     SIMDE_FLOAT32_C(1.65332031) },
+      { UINT16_C(45574), UINT16_C(58464), UINT16_C(33133), UINT16_C(16029), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {     SIMDE_FLOAT32_C(7.43750000),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.00000001e-10),           -SIMDE_MATH_INFINITYF },
+      { UINT16_C(18288), UINT16_C(64512), UINT16_C(    0), UINT16_C(64512), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEG_INF);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtps_ph_pinf(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { {     SIMDE_FLOAT32_C(3.73803711),     SIMDE_FLOAT32_C(17.5996094), SIMDE_FLOAT32_C(-1.65849924e-05), SIMDE_FLOAT32_C(2.98023224e-08) },
+      { UINT16_C(17274), UINT16_C(19559), UINT16_C(33046), UINT16_C(    1), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(5.96046448e-08),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(0.432922363),                -SIMDE_MATH_NANF },
+      { UINT16_C(    1), UINT16_C(64512), UINT16_C(14062), UINT16_C(65024), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(-4.47034836e-08),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-4.39584255e-06),    SIMDE_FLOAT32_C(-2.19555664) },
+      { UINT16_C(32768), UINT16_C(64512), UINT16_C(32841), UINT16_C(49252), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(0.261291504),    SIMDE_FLOAT32_C(0.612243652),     SIMDE_FLOAT32_C(6.32470703),     SIMDE_FLOAT32_C(0.00000000) },
+      { UINT16_C(13359), UINT16_C(14566), UINT16_C(18004), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(0.250793457), SIMDE_FLOAT32_C(5.96046448e-08),   SIMDE_FLOAT32_C(-0.665954590),     SIMDE_FLOAT32_C(100000.000) },
+      { UINT16_C(13316), UINT16_C(    1), UINT16_C(47443), UINT16_C(31744), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(-235.312500), SIMDE_FLOAT32_C(-5.21540642e-08),    SIMDE_FLOAT32_C(0.519592285), SIMDE_FLOAT32_C(-4.59775329e-05) },
+      { UINT16_C(56154), UINT16_C(32768), UINT16_C(14377), UINT16_C(33539), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(4.64320183e-05),    SIMDE_FLOAT32_C(0.363800049),    SIMDE_FLOAT32_C(0.156250000), SIMDE_FLOAT32_C(-0.00184774399) },
+      { UINT16_C(  779), UINT16_C(13779), UINT16_C(12544), UINT16_C(38801), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {     SIMDE_FLOAT32_C(2.00195312),    SIMDE_FLOAT32_C(-65520.0000),     SIMDE_FLOAT32_C(1.55285645),    SIMDE_FLOAT32_C(-6.73779297) },
+      { UINT16_C(16385), UINT16_C(64511), UINT16_C(15927), UINT16_C(50876), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_POS_INF);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtps_ph_zero(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { {    SIMDE_FLOAT32_C(-3.75146484),    SIMDE_FLOAT32_C(-26.8613281),    SIMDE_FLOAT32_C(0.350646973), SIMDE_FLOAT32_C(5.96046448e-08) },
+      { UINT16_C(50048), UINT16_C(52919), UINT16_C(13724), UINT16_C(    1), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(5.96046448e-08),    SIMDE_FLOAT32_C(-65520.0000),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(0.831787109) },
+      { UINT16_C(    1), UINT16_C(64511), UINT16_C(64512), UINT16_C(15015), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {           -SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.787414551),    SIMDE_FLOAT32_C(-65132.0000),     SIMDE_FLOAT32_C(5.37207031) },
+      { UINT16_C(64512), UINT16_C(47692), UINT16_C(64499), UINT16_C(17759), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {   SIMDE_FLOAT32_C(-0.811035156),   SIMDE_FLOAT32_C(-0.144500732),                 SIMDE_MATH_NANF,                 SIMDE_MATH_NANF },
+      { UINT16_C(47741), UINT16_C(45215), UINT16_C(32256), UINT16_C(32256), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(-0.00869655609), SIMDE_FLOAT32_C(4.39733267e-05),    SIMDE_FLOAT32_C(0.707702637),     SIMDE_FLOAT32_C(653.125000) },
+      { UINT16_C(41075), UINT16_C(  737), UINT16_C(14761), UINT16_C(24858), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {    SIMDE_FLOAT32_C(-256.562500),     SIMDE_FLOAT32_C(690.562500),     SIMDE_FLOAT32_C(6.50439453),    SIMDE_FLOAT32_C(-7.83154297) },
+      { UINT16_C(56322), UINT16_C(24933), UINT16_C(18049), UINT16_C(51156), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(3.47197056e-06),    SIMDE_FLOAT32_C(-2.94165039), SIMDE_FLOAT32_C(3.68058681e-06), SIMDE_FLOAT32_C(-0.000739037991) },
+      { UINT16_C(   58), UINT16_C(49634), UINT16_C(   61), UINT16_C(37389), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {     SIMDE_FLOAT32_C(2.88916016),    SIMDE_FLOAT32_C(-1.31005859),  SIMDE_FLOAT32_C(0.00162410736),                -SIMDE_MATH_NANF },
+      { UINT16_C(16839), UINT16_C(48445), UINT16_C( 5799), UINT16_C(65024), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_ZERO);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtps_ph_nearest(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[8];
+    uint16_t r[8];
+  } test_vec[] = {
+    { {   SIMDE_FLOAT32_C(-0.305236816), SIMDE_FLOAT32_C(1.00000001e-10),    SIMDE_FLOAT32_C(-2236.00000),     SIMDE_FLOAT32_C(1.00048828),
+                   SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-304.093750),     SIMDE_FLOAT32_C(6.78466797),     SIMDE_FLOAT32_C(1.00048828) },
+      { UINT16_C(46306), UINT16_C(    0), UINT16_C(59486), UINT16_C(15360), UINT16_C(31744), UINT16_C(56512), UINT16_C(18121), UINT16_C(15360) } },
+    { {     SIMDE_FLOAT32_C(2.00195312),            SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-569.562500),            SIMDE_MATH_INFINITYF,
+            SIMDE_FLOAT32_C(976.125000),     SIMDE_FLOAT32_C(1.00048828), SIMDE_FLOAT32_C(-7.01695681e-05),     SIMDE_FLOAT32_C(1.08398438) },
+      { UINT16_C(16385), UINT16_C(31744), UINT16_C(57459), UINT16_C(31744), UINT16_C(25504), UINT16_C(15360), UINT16_C(33945), UINT16_C(15446) } },
+    { { SIMDE_FLOAT32_C(-2.98023224e-08),    SIMDE_FLOAT32_C(0.323974609), SIMDE_FLOAT32_C(-4.40180302e-05),     SIMDE_FLOAT32_C(65519.9883),
+           SIMDE_FLOAT32_C(-4.10791016),    SIMDE_FLOAT32_C(0.752380371),    SIMDE_FLOAT32_C(0.915039062),   SIMDE_FLOAT32_C(-0.272216797) },
+      { UINT16_C(32768), UINT16_C(13615), UINT16_C(33506), UINT16_C(31743), UINT16_C(50204), UINT16_C(14853), UINT16_C(15186), UINT16_C(46171) } },
+    { {                 SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(23.6406250),            SIMDE_MATH_INFINITYF,   SIMDE_FLOAT32_C(-0.150604248),
+        SIMDE_FLOAT32_C(6.10649586e-05),    SIMDE_FLOAT32_C(-65520.0000),    SIMDE_FLOAT32_C(-13.0595703),    SIMDE_FLOAT32_C(0.636291504) },
+      { UINT16_C(32256), UINT16_C(19945), UINT16_C(31744), UINT16_C(45266), UINT16_C( 1024), UINT16_C(64512), UINT16_C(51848), UINT16_C(14615) } },
+    { {    SIMDE_FLOAT32_C(-65520.0000),  SIMDE_FLOAT32_C(-0.0989456177),            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(100000.000),
+        SIMDE_FLOAT32_C(-0.00682449341),   SIMDE_FLOAT32_C(-0.449340820),     SIMDE_FLOAT32_C(1.04589844),     SIMDE_FLOAT32_C(3.61938477) },
+      { UINT16_C(64512), UINT16_C(44629), UINT16_C(31744), UINT16_C(31744), UINT16_C(40701), UINT16_C(46896), UINT16_C(15407), UINT16_C(17213) } },
+    { {     SIMDE_FLOAT32_C(65519.9883),                 SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(253.062500),     SIMDE_FLOAT32_C(65519.9883),
+        SIMDE_FLOAT32_C(-1.43423676e-05),     SIMDE_FLOAT32_C(1.50634766), SIMDE_FLOAT32_C(3.36244702e-05), SIMDE_FLOAT32_C(-3.72529030e-08) },
+      { UINT16_C(31743), UINT16_C(32256), UINT16_C(23528), UINT16_C(31743), UINT16_C(33009), UINT16_C(15878), UINT16_C(  564), UINT16_C(32769) } },
+    { {   SIMDE_FLOAT32_C(-0.165298462),     SIMDE_FLOAT32_C(2.00195312), SIMDE_FLOAT32_C(-8.73953104e-05), SIMDE_FLOAT32_C(-2.98023224e-08),
+            SIMDE_FLOAT32_C(1.31140137),     SIMDE_FLOAT32_C(2284.25000), SIMDE_FLOAT32_C(2.06306577e-05),     SIMDE_FLOAT32_C(7.80273438) },
+      { UINT16_C(45386), UINT16_C(16385), UINT16_C(34234), UINT16_C(32768), UINT16_C(15679), UINT16_C(26742), UINT16_C(  346), UINT16_C(18382) } },
+    { {     SIMDE_FLOAT32_C(3.24438477), SIMDE_FLOAT32_C(3.72007489e-05),     SIMDE_FLOAT32_C(2.71093750),     SIMDE_FLOAT32_C(1.49511719),
+           SIMDE_FLOAT32_C(0.696655273),  SIMDE_FLOAT32_C(0.00235438347),     SIMDE_FLOAT32_C(1.26562500), SIMDE_FLOAT32_C(5.96046448e-08) },
+      { UINT16_C(17021), UINT16_C(  624), UINT16_C(16748), UINT16_C(15867), UINT16_C(14739), UINT16_C( 6354), UINT16_C(15632), UINT16_C(    1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtps_ph_ninf(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[8];
+    uint16_t r[8];
+  } test_vec[] = {
+    { {                -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(2.98023224e-08),                 SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(7.93408203),
+            SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(-0.00636672974),    SIMDE_FLOAT32_C(0.607971191),    SIMDE_FLOAT32_C(-1.45019531) },
+      { UINT16_C(65024), UINT16_C(    0), UINT16_C(32256), UINT16_C(18415), UINT16_C(    0), UINT16_C(40581), UINT16_C(14557), UINT16_C(48589) } },
+    { {     SIMDE_FLOAT32_C(1.61364746),     SIMDE_FLOAT32_C(1.00097656),    SIMDE_FLOAT32_C(-65520.0000),    SIMDE_FLOAT32_C(0.245834351),
+           SIMDE_FLOAT32_C(0.153533936), SIMDE_FLOAT32_C(2.98023224e-08),           -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-65520.0000) },
+      { UINT16_C(15988), UINT16_C(15361), UINT16_C(64512), UINT16_C(13277), UINT16_C(12521), UINT16_C(    0), UINT16_C(64512), UINT16_C(64512) } },
+    { {     SIMDE_FLOAT32_C(1.95678711), SIMDE_FLOAT32_C(-0.00297665596), SIMDE_FLOAT32_C(-1.77547336e-05), SIMDE_FLOAT32_C(-2.98023224e-08),
+           SIMDE_FLOAT32_C(0.553466797),     SIMDE_FLOAT32_C(3.26293945),     SIMDE_FLOAT32_C(6.23681641), SIMDE_FLOAT32_C(8.94069672e-08) },
+      { UINT16_C(16339), UINT16_C(39449), UINT16_C(33066), UINT16_C(32769), UINT16_C(14445), UINT16_C(17030), UINT16_C(17980), UINT16_C(    1) } },
+    { { SIMDE_FLOAT32_C(3.72529030e-08),    SIMDE_FLOAT32_C(-65520.0000),     SIMDE_FLOAT32_C(3.99951172),     SIMDE_FLOAT32_C(5.09033203),
+           SIMDE_FLOAT32_C(-2.44946289),   SIMDE_FLOAT32_C(-0.173446655),     SIMDE_FLOAT32_C(29.8027344),     SIMDE_FLOAT32_C(65504.0000) },
+      { UINT16_C(    0), UINT16_C(64512), UINT16_C(17407), UINT16_C(17687), UINT16_C(49383), UINT16_C(45453), UINT16_C(20339), UINT16_C(31743) } },
+    { {     SIMDE_FLOAT32_C(127.703125),   SIMDE_FLOAT32_C(-0.963684082), SIMDE_FLOAT32_C(8.94069672e-08),    SIMDE_FLOAT32_C(-1.06762695),
+            SIMDE_FLOAT32_C(2.00195312), SIMDE_FLOAT32_C(-1.66147947e-06),     SIMDE_FLOAT32_C(1.04870605),    SIMDE_FLOAT32_C(-65520.0000) },
+      { UINT16_C(22523), UINT16_C(48054), UINT16_C(    1), UINT16_C(48198), UINT16_C(16385), UINT16_C(32796), UINT16_C(15409), UINT16_C(64512) } },
+    { {     SIMDE_FLOAT32_C(0.00000000), SIMDE_FLOAT32_C(0.000378638506),     SIMDE_FLOAT32_C(10.9902344),   SIMDE_FLOAT32_C(0.0688323975),
+          SIMDE_FLOAT32_C(-0.765014648),     SIMDE_FLOAT32_C(3489.75000), SIMDE_FLOAT32_C(3.23653221e-05),    SIMDE_FLOAT32_C(-65520.0000) },
+      { UINT16_C(    0), UINT16_C( 3636), UINT16_C(18814), UINT16_C(11367), UINT16_C(47647), UINT16_C(27344), UINT16_C(  543), UINT16_C(64512) } },
+    { {   SIMDE_FLOAT32_C(0.0520401001), SIMDE_FLOAT32_C(4.66927886e-05),    SIMDE_FLOAT32_C(-2.36206055),    SIMDE_FLOAT32_C(-2429.25000),
+            SIMDE_FLOAT32_C(7.64062500), SIMDE_FLOAT32_C(2.98023224e-08), SIMDE_FLOAT32_C(-2.98023224e-08),    SIMDE_FLOAT32_C(0.641784668) },
+      { UINT16_C(10921), UINT16_C(  783), UINT16_C(49338), UINT16_C(59583), UINT16_C(18340), UINT16_C(    0), UINT16_C(32769), UINT16_C(14626) } },
+    { {   SIMDE_FLOAT32_C(0.0172271729), SIMDE_FLOAT32_C(-5.86733222e-05),    SIMDE_FLOAT32_C(-7.62451172),   SIMDE_FLOAT32_C(-0.411376953),
+           SIMDE_FLOAT32_C(0.889587402),            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-3.12775373e-05),    SIMDE_FLOAT32_C(-3.68579102) },
+      { UINT16_C( 9321), UINT16_C(33753), UINT16_C(51104), UINT16_C(46741), UINT16_C(15133), UINT16_C(31744), UINT16_C(33293), UINT16_C(50016) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEG_INF);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtps_ph_pinf(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[8];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(-2.74553895e-05), SIMDE_FLOAT32_C(5.21540642e-08), SIMDE_FLOAT32_C(1.49011612e-08), SIMDE_FLOAT32_C(1.00000001e-10),
+        SIMDE_FLOAT32_C(2.75075436e-05),     SIMDE_FLOAT32_C(1.76757812),     SIMDE_FLOAT32_C(4.78857422),  SIMDE_FLOAT32_C(-0.0307960510) },
+      { UINT16_C(33228), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(  462), UINT16_C(16146), UINT16_C(17610), UINT16_C(42978) } },
+    { {    SIMDE_FLOAT32_C(-11.8554688), SIMDE_FLOAT32_C(-0.00196909904), SIMDE_FLOAT32_C(8.94069672e-08),   SIMDE_FLOAT32_C(-0.786499023),
+        SIMDE_FLOAT32_C(5.96046448e-08),    SIMDE_FLOAT32_C(0.825561523), SIMDE_FLOAT32_C(5.96046448e-08),                 SIMDE_MATH_NANF },
+      { UINT16_C(51693), UINT16_C(38920), UINT16_C(    2), UINT16_C(47690), UINT16_C(    1), UINT16_C(15003), UINT16_C(    1), UINT16_C(32256) } },
+    { {    SIMDE_FLOAT32_C(-4.82617188),     SIMDE_FLOAT32_C(0.00000000),     SIMDE_FLOAT32_C(45792.0000), SIMDE_FLOAT32_C(-6.10202551e-05),
+        SIMDE_FLOAT32_C(1.00000001e-10),   SIMDE_FLOAT32_C(-0.265167236), SIMDE_FLOAT32_C(8.94069672e-08),   SIMDE_FLOAT32_C(-0.648132324) },
+      { UINT16_C(50387), UINT16_C(    0), UINT16_C(31127), UINT16_C(33791), UINT16_C(    1), UINT16_C(46142), UINT16_C(    2), UINT16_C(47407) } },
+    { {     SIMDE_FLOAT32_C(1.85156250), SIMDE_FLOAT32_C(5.96046448e-08),   SIMDE_FLOAT32_C(-0.835937500),     SIMDE_FLOAT32_C(11.2187500),
+           SIMDE_FLOAT32_C(-2.25268555),     SIMDE_FLOAT32_C(37960.0000),                 SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(-0.419677734) },
+      { UINT16_C(16232), UINT16_C(    1), UINT16_C(47792), UINT16_C(18844), UINT16_C(49281), UINT16_C(30883), UINT16_C(32256), UINT16_C(46775) } },
+    { { SIMDE_FLOAT32_C(4.66331840e-05), SIMDE_FLOAT32_C(-2.48998404e-05),     SIMDE_FLOAT32_C(4.51513672), SIMDE_FLOAT32_C(3.94582748e-05),
+          SIMDE_FLOAT32_C(-0.237854004), SIMDE_FLOAT32_C(1.00000001e-10),    SIMDE_FLOAT32_C(-1.72412109),   SIMDE_FLOAT32_C(-0.241073608) },
+      { UINT16_C(  783), UINT16_C(33185), UINT16_C(17540), UINT16_C(  662), UINT16_C(45980), UINT16_C(    1), UINT16_C(48869), UINT16_C(46006) } },
+    { {                 SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(2.00195312), SIMDE_FLOAT32_C(-0.000357627869),    SIMDE_FLOAT32_C(-75.1796875),
+            SIMDE_FLOAT32_C(5.63476562),    SIMDE_FLOAT32_C(-4.80322266),    SIMDE_FLOAT32_C(-12.5498047),     SIMDE_FLOAT32_C(2.03735352) },
+      { UINT16_C(32256), UINT16_C(16385), UINT16_C(36316), UINT16_C(54450), UINT16_C(17827), UINT16_C(50381), UINT16_C(51782), UINT16_C(16404) } },
+    { { SIMDE_FLOAT32_C(5.96046448e-08),                -SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(1.00048828), SIMDE_FLOAT32_C(8.50260258e-05),
+            SIMDE_FLOAT32_C(100000.000),            SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(-1.42675781),    SIMDE_FLOAT32_C(-65520.0000) },
+      { UINT16_C(    1), UINT16_C(65024), UINT16_C(15361), UINT16_C( 1427), UINT16_C(31744), UINT16_C(31744), UINT16_C(48565), UINT16_C(64511) } },
+    { {    SIMDE_FLOAT32_C(0.831115723),    SIMDE_FLOAT32_C(-2.76586914),     SIMDE_FLOAT32_C(2.00195312),   SIMDE_FLOAT32_C(-0.239868164),
+           SIMDE_FLOAT32_C(-65520.0000),     SIMDE_FLOAT32_C(7.53759766),    SIMDE_FLOAT32_C(0.228973389), SIMDE_FLOAT32_C(5.96046448e-08) },
+      { UINT16_C(15015), UINT16_C(49544), UINT16_C(16385), UINT16_C(45997), UINT16_C(64511), UINT16_C(18314), UINT16_C(13140), UINT16_C(    1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_POS_INF);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtps_ph_zero(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[8];
+    uint16_t r[8];
+  } test_vec[] = {
+    { {    SIMDE_FLOAT32_C(-2.23901367),     SIMDE_FLOAT32_C(2.09960938),     SIMDE_FLOAT32_C(0.00000000),    SIMDE_FLOAT32_C(0.154266357),
+           SIMDE_FLOAT32_C(0.333465576),    SIMDE_FLOAT32_C(-3.59350586), SIMDE_FLOAT32_C(-2.23517418e-08),     SIMDE_FLOAT32_C(861.000000) },
+      { UINT16_C(49274), UINT16_C(16435), UINT16_C(    0), UINT16_C(12527), UINT16_C(13653), UINT16_C(49967), UINT16_C(32768), UINT16_C(25274) } },
+    { {    SIMDE_FLOAT32_C(-2.99536133), SIMDE_FLOAT32_C(3.90931964e-05),   SIMDE_FLOAT32_C(-0.517089844),    SIMDE_FLOAT32_C(0.333435059),
+                  -SIMDE_MATH_INFINITYF,            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.00000001e-10),    SIMDE_FLOAT32_C(-6.31591797) },
+      { UINT16_C(49661), UINT16_C(  655), UINT16_C(47139), UINT16_C(13653), UINT16_C(64512), UINT16_C(31744), UINT16_C(    0), UINT16_C(50768) } },
+    { {            SIMDE_MATH_INFINITYF,     SIMDE_FLOAT32_C(44.2187500),    SIMDE_FLOAT32_C(-1.92138672),     SIMDE_FLOAT32_C(2.20581055),
+        SIMDE_FLOAT32_C(-2.98023224e-08),   SIMDE_FLOAT32_C(-0.249542236),    SIMDE_FLOAT32_C(0.210754395), SIMDE_FLOAT32_C(2.47061253e-05) },
+      { UINT16_C(31744), UINT16_C(20871), UINT16_C(49071), UINT16_C(16489), UINT16_C(32768), UINT16_C(46076), UINT16_C(12990), UINT16_C(  414) } },
+    { {    SIMDE_FLOAT32_C(0.283355713),   SIMDE_FLOAT32_C(-0.364166260), SIMDE_FLOAT32_C(3.43397260e-05),    SIMDE_FLOAT32_C(-741.750000),
+          SIMDE_FLOAT32_C(-0.175628662), SIMDE_FLOAT32_C(-3.39150429e-05), SIMDE_FLOAT32_C(-3.66866589e-05), SIMDE_FLOAT32_C(8.94069672e-08) },
+      { UINT16_C(13448), UINT16_C(46547), UINT16_C(  576), UINT16_C(57803), UINT16_C(45470), UINT16_C(33337), UINT16_C(33383), UINT16_C(    1) } },
+    { {                 SIMDE_MATH_NANF,   SIMDE_FLOAT32_C(-0.241088867),    SIMDE_FLOAT32_C(0.161621094), SIMDE_FLOAT32_C(-0.00210928917),
+           SIMDE_FLOAT32_C(-4.41845703),     SIMDE_FLOAT32_C(2.00195312),     SIMDE_FLOAT32_C(3.61572266), SIMDE_FLOAT32_C(0.000483930111) },
+      { UINT16_C(32256), UINT16_C(46007), UINT16_C(12588), UINT16_C(38993), UINT16_C(50283), UINT16_C(16385), UINT16_C(17211), UINT16_C( 4077) } },
+    { { SIMDE_FLOAT32_C(2.98023224e-08),    SIMDE_FLOAT32_C(0.333465576),   SIMDE_FLOAT32_C(-0.250732422),     SIMDE_FLOAT32_C(1.00048828),
+            SIMDE_FLOAT32_C(1.78369141),    SIMDE_FLOAT32_C(0.731933594),     SIMDE_FLOAT32_C(100000.000), SIMDE_FLOAT32_C(-0.000154435635) },
+      { UINT16_C(    0), UINT16_C(13653), UINT16_C(46083), UINT16_C(15360), UINT16_C(16162), UINT16_C(14811), UINT16_C(31743), UINT16_C(35087) } },
+    { {    SIMDE_FLOAT32_C(-1.29760742), SIMDE_FLOAT32_C(-5.14984131e-05),     SIMDE_FLOAT32_C(5.23876953),    SIMDE_FLOAT32_C(-1.27209473),
+                        SIMDE_MATH_NANF,     SIMDE_FLOAT32_C(6.52099609),    SIMDE_FLOAT32_C(0.745178223),   SIMDE_FLOAT32_C(-0.134826660) },
+      { UINT16_C(48432), UINT16_C(33632), UINT16_C(17725), UINT16_C(48406), UINT16_C(32256), UINT16_C(18053), UINT16_C(14838), UINT16_C(45136) } },
+    { {   SIMDE_FLOAT32_C(-0.782409668),     SIMDE_FLOAT32_C(3.81835938),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.17048621e-05),
+           SIMDE_FLOAT32_C(0.332519531),   SIMDE_FLOAT32_C(-0.567077637),     SIMDE_FLOAT32_C(6.91699219), SIMDE_FLOAT32_C(0.000861883163) },
+      { UINT16_C(47682), UINT16_C(17315), UINT16_C(64512), UINT16_C(  196), UINT16_C(13650), UINT16_C(47241), UINT16_C(18154), UINT16_C( 4879) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128i r = simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_ZERO);
+    simde_test_x86_assert_equal_u16x8(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtps_ph_nearest)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtps_ph_ninf)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtps_ph_pinf)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtps_ph_zero)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtps_ph_nearest)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtps_ph_ninf)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtps_ph_pinf)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtps_ph_zero)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
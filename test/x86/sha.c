@@ -0,0 +1,445 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX sha
+#include <simde/x86/sha.h>
+#include <test/x86/test-sse2.h>
+
+static int
+test_simde_mm_sha1msg1_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3115448963), UINT32_C(3348362220), UINT32_C( 621146698), UINT32_C(2810613223) },
+      { UINT32_C(1110172481), UINT32_C(2024421290), UINT32_C(3804688957), UINT32_C( 253881416) },
+      { UINT32_C(1534527678), UINT32_C(3367116708), UINT32_C(2629044425), UINT32_C(1612021259) } },
+    { { UINT32_C(3729602260), UINT32_C(2352415708), UINT32_C(3163563498), UINT32_C(1555379550) },
+      { UINT32_C(  16275113), UINT32_C( 195332830), UINT32_C( 555480804), UINT32_C(3296192847) },
+      { UINT32_C(4283875376), UINT32_C(1212213907), UINT32_C(1658655550), UINT32_C(3498194562) } },
+    { { UINT32_C(4199342428), UINT32_C(3505245096), UINT32_C(3860556419), UINT32_C(1267940603) },
+      { UINT32_C(4214063946), UINT32_C(3622856867), UINT32_C( 443899634), UINT32_C(1486969268) },
+      { UINT32_C(3761881006), UINT32_C(2286719516), UINT32_C( 475499487), UINT32_C(2608789331) } },
+    { { UINT32_C(3849618024), UINT32_C(1585995236), UINT32_C(1007500864), UINT32_C(4039886722) },
+      { UINT32_C(3283795813), UINT32_C(1141411504), UINT32_C( 590584403), UINT32_C( 435805393) },
+      { UINT32_C(3326548027), UINT32_C(1198620981), UINT32_C(3648633896), UINT32_C(2923666022) } },
+    { { UINT32_C( 645286423), UINT32_C(3488535663), UINT32_C(2899904959), UINT32_C(3562327370) },
+      { UINT32_C(3618330298), UINT32_C(1122867275), UINT32_C(2729147975), UINT32_C(3999416194) },
+      { UINT32_C(2229089360), UINT32_C( 562883565), UINT32_C(2326741928), UINT32_C( 465180965) } },
+    { { UINT32_C(2896814039), UINT32_C(1038189874), UINT32_C(1523344625), UINT32_C(1643173308) },
+      { UINT32_C(1303929458), UINT32_C(2222457335), UINT32_C(1895931292), UINT32_C(3436582587) },
+      { UINT32_C(3718791755), UINT32_C(4046951305), UINT32_C(4133862182), UINT32_C(1544638606) } },
+    { { UINT32_C(3556456702), UINT32_C( 634023654), UINT32_C(3980588400), UINT32_C(  90066918) },
+      { UINT32_C(3511805674), UINT32_C(2073631088), UINT32_C(1679507755), UINT32_C(2225856644) },
+      { UINT32_C(3084941781), UINT32_C(2707525218), UINT32_C(1052364174), UINT32_C( 546578688) } },
+    { { UINT32_C(2969654623), UINT32_C( 108846589), UINT32_C(3608101344), UINT32_C( 598556780) },
+      { UINT32_C(1512532049), UINT32_C(1976980451), UINT32_C(3848396787), UINT32_C(3015595673) },
+      { UINT32_C(1415613100), UINT32_C(3049425764), UINT32_C(1712198847), UINT32_C( 634494353) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg1_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha1msg2_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1332251715), UINT32_C(1657768625), UINT32_C( 324607789), UINT32_C(3902775410) },
+      { UINT32_C(3437930187), UINT32_C(2042736768), UINT32_C( 394001682), UINT32_C(2173791321) },
+      { UINT32_C(1631612165), UINT32_C(1548376309), UINT32_C(3576782682), UINT32_C(4291345089) } },
+    { { UINT32_C( 333284231), UINT32_C(2423236494), UINT32_C(1322233386), UINT32_C(2809395660) },
+      { UINT32_C(3857615980), UINT32_C(1404109734), UINT32_C(1336833589), UINT32_C(2715557144) },
+      { UINT32_C(2228041961), UINT32_C(3942799300), UINT32_C( 989682456), UINT32_C(3518701555) } },
+    { { UINT32_C(3615385397), UINT32_C(  16599549), UINT32_C(1492522325), UINT32_C( 522235944) },
+      { UINT32_C(4155519974), UINT32_C(1488839098), UINT32_C(2541328936), UINT32_C(2289676943) },
+      { UINT32_C(2409129577), UINT32_C(4003132471), UINT32_C(   9955806), UINT32_C( 280122369) } },
+    { { UINT32_C(3922528494), UINT32_C(1973673763), UINT32_C(2187031964), UINT32_C(2047292585) },
+      { UINT32_C(1938255918), UINT32_C(2406680606), UINT32_C( 234443539), UINT32_C(  51764560) },
+      { UINT32_C( 207851316), UINT32_C( 206134810), UINT32_C( 441514756), UINT32_C(4026322804) } },
+    { { UINT32_C(2826449285), UINT32_C( 131165920), UINT32_C(2705667539), UINT32_C( 579874091) },
+      { UINT32_C(4075881830), UINT32_C(3199974296), UINT32_C(4139695128), UINT32_C(1825278575) },
+      { UINT32_C(   4859844), UINT32_C(3930117901), UINT32_C(1073552534), UINT32_C(2824675943) } },
+    { { UINT32_C(2630209067), UINT32_C(3647550838), UINT32_C(4119837212), UINT32_C( 243394697) },
+      { UINT32_C( 840942691), UINT32_C(3472147424), UINT32_C(3416458263), UINT32_C(1142221887) },
+      { UINT32_C( 754986540), UINT32_C(3605914155), UINT32_C(1995895800), UINT32_C(2319833405) } },
+    { { UINT32_C(3668428373), UINT32_C(1388816301), UINT32_C(1146372207), UINT32_C(4188914818) },
+      { UINT32_C(4162721184), UINT32_C(3590901232), UINT32_C(2541199362), UINT32_C(4086076612) },
+      { UINT32_C( 237379242), UINT32_C(1437819931), UINT32_C( 616110911), UINT32_C(3719612672) } },
+    { { UINT32_C(3006171993), UINT32_C( 424474974), UINT32_C(2296976252), UINT32_C(2292795872) },
+      { UINT32_C(3649610921), UINT32_C(1836938986), UINT32_C(2615516660), UINT32_C(1802259276) },
+      { UINT32_C( 728647395), UINT32_C(2173221871), UINT32_C(3408448301), UINT32_C( 647604264) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg2_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha1nexte_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 399699409), UINT32_C(3073882967), UINT32_C(2541412617), UINT32_C(2630509645) },
+      { UINT32_C(1265696956), UINT32_C(2496557678), UINT32_C(1277707219), UINT32_C(1077822229) },
+      { UINT32_C(1265696956), UINT32_C(2496557678), UINT32_C(1277707219), UINT32_C(2809191464) } },
+    { { UINT32_C(3737298348), UINT32_C(3456050612), UINT32_C(1501539255), UINT32_C(2003434519) },
+      { UINT32_C(2930825910), UINT32_C(3592571818), UINT32_C(2577414963), UINT32_C(1460891558) },
+      { UINT32_C(2930825910), UINT32_C(3592571818), UINT32_C(2577414963), UINT32_C( 888008363) } },
+    { { UINT32_C(2959708336), UINT32_C(1235279552), UINT32_C(1220877914), UINT32_C(2877252892) },
+      { UINT32_C(2497347832), UINT32_C( 343020014), UINT32_C(2329324740), UINT32_C(1715133650) },
+      { UINT32_C(2497347832), UINT32_C( 343020014), UINT32_C(2329324740), UINT32_C(2434446873) } },
+    { { UINT32_C(3689847671), UINT32_C(2608987183), UINT32_C(1651394778), UINT32_C( 873604641) },
+      { UINT32_C(3859024622), UINT32_C(2138019127), UINT32_C( 930877510), UINT32_C(2980604398) },
+      { UINT32_C(3859024622), UINT32_C(2138019127), UINT32_C( 930877510), UINT32_C(4272747382) } },
+    { { UINT32_C(1005280644), UINT32_C(1479330835), UINT32_C(  96147943), UINT32_C( 372066237) },
+      { UINT32_C(2575681539), UINT32_C(3626032781), UINT32_C(1963380336), UINT32_C(1936866649) },
+      { UINT32_C(2575681539), UINT32_C(3626032781), UINT32_C(1963380336), UINT32_C(3103625032) } },
+    { { UINT32_C(1353535739), UINT32_C(4197102863), UINT32_C( 735208875), UINT32_C( 771308933) },
+      { UINT32_C(2149025864), UINT32_C( 288456999), UINT32_C(2998048711), UINT32_C( 887250136) },
+      { UINT32_C(2149025864), UINT32_C( 288456999), UINT32_C(2998048711), UINT32_C(2153819193) } },
+    { { UINT32_C(2093068060), UINT32_C(2312416491), UINT32_C( 609729379), UINT32_C(2814466940) },
+      { UINT32_C( 924426019), UINT32_C(1215836958), UINT32_C( 547943485), UINT32_C(2700246521) },
+      { UINT32_C( 924426019), UINT32_C(1215836958), UINT32_C( 547943485), UINT32_C(3403863256) } },
+    { { UINT32_C(2453458047), UINT32_C( 383002795), UINT32_C(2870130844), UINT32_C(   2983746) },
+      { UINT32_C(3554879956), UINT32_C(3207704727), UINT32_C(3230238075), UINT32_C(4033218051) },
+      { UINT32_C(3554879956), UINT32_C(3207704727), UINT32_C(3230238075), UINT32_C(1886480339) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1nexte_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha1rnds4_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(4051435074), UINT32_C(1874626592), UINT32_C(3808553818), UINT32_C( 115077106) },
+      { UINT32_C(3758912631), UINT32_C(3449636697), UINT32_C(1686414833), UINT32_C(2943017275) },
+      { UINT32_C( 372866373), UINT32_C(1305053898), UINT32_C( 491170318), UINT32_C( 852862078) } },
+    { { UINT32_C(4138643013), UINT32_C(2413916858), UINT32_C(1207004193), UINT32_C(1894916801) },
+      { UINT32_C(3962116033), UINT32_C(3813270249), UINT32_C(3606044945), UINT32_C(4131963221) },
+      { UINT32_C(2961796480), UINT32_C(2349306288), UINT32_C(3048439620), UINT32_C(1075505906) } },
+    { { UINT32_C(2973184161), UINT32_C(2953833047), UINT32_C(1460161013), UINT32_C(2633100957) },
+      { UINT32_C(4017163117), UINT32_C(2372768932), UINT32_C(2183465017), UINT32_C( 779039405) },
+      { UINT32_C(1127615244), UINT32_C(1016093069), UINT32_C(1520319658), UINT32_C(2336938805) } },
+    { { UINT32_C(3699784875), UINT32_C(2962349774), UINT32_C(3942228058), UINT32_C(1475455779) },
+      { UINT32_C(2886250431), UINT32_C(1884042155), UINT32_C( 548945128), UINT32_C(2713897402) },
+      { UINT32_C(2085768334), UINT32_C(2477353000), UINT32_C(1577064831), UINT32_C(3627585658) } },
+    { { UINT32_C(3470418497), UINT32_C( 419623383), UINT32_C( 232024175), UINT32_C(2461022847) },
+      { UINT32_C( 209825634), UINT32_C(1154444553), UINT32_C(2792445103), UINT32_C( 963712153) },
+      { UINT32_C(3980480538), UINT32_C(3203024486), UINT32_C( 334243315), UINT32_C(2500007831) } },
+    { { UINT32_C(3307085698), UINT32_C( 933224842), UINT32_C(1589673330), UINT32_C(3790473981) },
+      { UINT32_C(3929042195), UINT32_C(1015514310), UINT32_C( 627512171), UINT32_C(  34884004) },
+      { UINT32_C(3602662942), UINT32_C(1045497993), UINT32_C(3233815592), UINT32_C(1614930861) } },
+    { { UINT32_C(1747521992), UINT32_C(2441786828), UINT32_C(3188597837), UINT32_C(4091570361) },
+      { UINT32_C(  74323891), UINT32_C(2338470261), UINT32_C(2475753644), UINT32_C( 124234244) },
+      { UINT32_C(2997267706), UINT32_C(3026959760), UINT32_C(1350700961), UINT32_C(  66981942) } },
+    { { UINT32_C(3617330251), UINT32_C(1002495964), UINT32_C(1976809433), UINT32_C(2409122818) },
+      { UINT32_C(3168849922), UINT32_C(3670245569), UINT32_C(2702256123), UINT32_C(1305618416) },
+      { UINT32_C(1764981145), UINT32_C( 830362174), UINT32_C(4201601566), UINT32_C(1104143886) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i r;
+
+    switch(i & 3) {
+      case 0:
+        r = simde_mm_sha1rnds4_epu32(a, b, 0);
+        break;
+      case 1:
+        r = simde_mm_sha1rnds4_epu32(a, b, 1);
+        break;
+      case 2:
+        r = simde_mm_sha1rnds4_epu32(a, b, 2);
+        break;
+      case 3:
+        r = simde_mm_sha1rnds4_epu32(a, b, 3);
+        break;
+      default:
+        HEDLEY_UNREACHABLE();
+    }
+
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha256msg1_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3389616760), UINT32_C(2104455170), UINT32_C( 770595597), UINT32_C( 417522429) },
+      { UINT32_C(2664002778), UINT32_C(1949394260), UINT32_C(1311557892), UINT32_C(1353301869) },
+      { UINT32_C(2707497523), UINT32_C( 110415022), UINT32_C(1870740143), UINT32_C( 347406013) } },
+    { { UINT32_C(1499802137), UINT32_C(4208952953), UINT32_C(2653872012), UINT32_C(3891372643) },
+      { UINT32_C( 517034950), UINT32_C(3770943263), UINT32_C( 670893587), UINT32_C(4170408554) },
+      { UINT32_C(1721064333), UINT32_C(3086624830), UINT32_C(1373113984), UINT32_C(3272061390) } },
+    { { UINT32_C( 329372146), UINT32_C( 291141879), UINT32_C(2537013298), UINT32_C(1270333271) },
+      { UINT32_C(2620174299), UINT32_C(  76649065), UINT32_C(  16388359), UINT32_C( 512638976) },
+      { UINT32_C(2245398955), UINT32_C(2568923970), UINT32_C(3748399787), UINT32_C(3674401542) } },
+    { { UINT32_C(  73203504), UINT32_C(2323646064), UINT32_C( 304587202), UINT32_C(2866520360) },
+      { UINT32_C(4285171044), UINT32_C(1774614128), UINT32_C(1140431932), UINT32_C( 637495617) },
+      { UINT32_C(4130742674), UINT32_C(4170204770), UINT32_C(3194784659), UINT32_C( 572939172) } },
+    { { UINT32_C(2393263489), UINT32_C(3143869448), UINT32_C(2982563797), UINT32_C(3516777920) },
+      { UINT32_C( 542862111), UINT32_C(1242564853), UINT32_C(1857511088), UINT32_C(2062194281) },
+      { UINT32_C(2109663890), UINT32_C(3927035164), UINT32_C(2628192041), UINT32_C(2989087075) } },
+    { { UINT32_C( 108476057), UINT32_C(2217680589), UINT32_C(2842947944), UINT32_C(3758293552) },
+      { UINT32_C(1140676676), UINT32_C(3079928247), UINT32_C(1544505588), UINT32_C(2416777196) },
+      { UINT32_C(1387664264), UINT32_C(3159741024), UINT32_C(1723879338), UINT32_C(3068937079) } },
+    { { UINT32_C(2693586838), UINT32_C( 501047334), UINT32_C(4247148786), UINT32_C(3414981077) },
+      { UINT32_C( 375280954), UINT32_C(1701575719), UINT32_C(3495997085), UINT32_C( 565734348) },
+      { UINT32_C(3088478537), UINT32_C(2319423756), UINT32_C(2847555100), UINT32_C(2939579759) } },
+    { { UINT32_C(2792438310), UINT32_C(1541454700), UINT32_C( 375165127), UINT32_C(1880178587) },
+      { UINT32_C(1526677080), UINT32_C(1022437690), UINT32_C( 500525444), UINT32_C(3546041525) },
+      { UINT32_C(2743204617), UINT32_C(  79145498), UINT32_C(2371971663), UINT32_C(3834465955) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg1_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha256msg2_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 579368663), UINT32_C(2846373823), UINT32_C(2096649516), UINT32_C(3762108991) },
+      { UINT32_C(1716056043), UINT32_C(1767691490), UINT32_C(2096988043), UINT32_C(1422272129) },
+      { UINT32_C( 850683285), UINT32_C(2167269681), UINT32_C( 996992833), UINT32_C( 702281224) } },
+    { { UINT32_C(4184729745), UINT32_C(2410198820), UINT32_C(3452802153), UINT32_C( 575264934) },
+      { UINT32_C( 225213842), UINT32_C(1175571489), UINT32_C(1244060735), UINT32_C(1151765891) },
+      { UINT32_C(2935533169), UINT32_C( 654940808), UINT32_C( 279638257), UINT32_C( 543600041) } },
+    { { UINT32_C(3304079378), UINT32_C( 887114974), UINT32_C(2718903742), UINT32_C(3844028394) },
+      { UINT32_C(3332073355), UINT32_C(3957287740), UINT32_C(2446503627), UINT32_C( 283012190) },
+      { UINT32_C(3347648138), UINT32_C( 813779661), UINT32_C(1219823412), UINT32_C(1901221356) } },
+    { { UINT32_C(3391971168), UINT32_C(2827950232), UINT32_C(2349455266), UINT32_C( 913890006) },
+      { UINT32_C(1511672685), UINT32_C(2377356013), UINT32_C( 933756426), UINT32_C( 380896156) },
+      { UINT32_C(3405190200), UINT32_C( 709311780), UINT32_C(4105410946), UINT32_C(2947865722) } },
+    { { UINT32_C( 478796642), UINT32_C(3425491592), UINT32_C(3449830222), UINT32_C(3109285279) },
+      { UINT32_C(3629958749), UINT32_C(2606908692), UINT32_C( 479694916), UINT32_C(3615068288) },
+      { UINT32_C(1454867359), UINT32_C(3331492287), UINT32_C(4283049915), UINT32_C(3475877080) } },
+    { { UINT32_C(1908079852), UINT32_C(1087728112), UINT32_C(2791288884), UINT32_C(  68635978) },
+      { UINT32_C(2728856916), UINT32_C(1558826128), UINT32_C(3965982851), UINT32_C(2825204029) },
+      { UINT32_C(  19238820), UINT32_C(2137580130), UINT32_C( 478575113), UINT32_C(1903818667) } },
+    { { UINT32_C(2246402974), UINT32_C(2414533988), UINT32_C(2384713336), UINT32_C(3778917991) },
+      { UINT32_C( 869394540), UINT32_C( 910236499), UINT32_C(2138356602), UINT32_C(4129695809) },
+      { UINT32_C(1353912600), UINT32_C(1627400641), UINT32_C(2027873539), UINT32_C(4076770065) } },
+    { { UINT32_C(4170545728), UINT32_C(2963835163), UINT32_C(1883451302), UINT32_C( 285063504) },
+      { UINT32_C(  95402246), UINT32_C(2137271505), UINT32_C(1386551373), UINT32_C(1101682397) },
+      { UINT32_C( 668017792), UINT32_C( 307096464), UINT32_C( 656216833), UINT32_C(1505513829) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg2_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha256rnds2_epu32(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t k[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1112392457), UINT32_C(1551800352), UINT32_C(1407894464), UINT32_C(2789542984) },
+      { UINT32_C(1071036108), UINT32_C(2770424719), UINT32_C(3958272787), UINT32_C(1439437380) },
+      { UINT32_C(1992858385), UINT32_C(3246374320), UINT32_C( 710723435), UINT32_C(1220724118) },
+      { UINT32_C(1781113660), UINT32_C(2100230001), UINT32_C(3039014242), UINT32_C( 364963580) } },
+    { { UINT32_C(4156261570), UINT32_C(4095810929), UINT32_C(2063384801), UINT32_C(3282621104) },
+      { UINT32_C( 228208707), UINT32_C(2410721298), UINT32_C(2584348804), UINT32_C(  12984837) },
+      { UINT32_C(2885294056), UINT32_C(2152310183), UINT32_C( 186905475), UINT32_C(3761273789) },
+      { UINT32_C( 746248319), UINT32_C( 335323526), UINT32_C(2090448085), UINT32_C( 138201957) } },
+    { { UINT32_C(1467795311), UINT32_C(1693582912), UINT32_C(3709530496), UINT32_C(1451770422) },
+      { UINT32_C( 936846643), UINT32_C(1796780739), UINT32_C(3169337797), UINT32_C( 433165634) },
+      { UINT32_C(2469283162), UINT32_C(2607945166), UINT32_C( 957223653), UINT32_C(2043212653) },
+      { UINT32_C(3377496756), UINT32_C(  75577413), UINT32_C(1932490293), UINT32_C( 949673102) } },
+    { { UINT32_C(1386875636), UINT32_C(3557477518), UINT32_C(2526497407), UINT32_C( 844701656) },
+      { UINT32_C(  96602699), UINT32_C(1992282434), UINT32_C(1330461268), UINT32_C(2671168067) },
+      { UINT32_C(1566482048), UINT32_C(3993597932), UINT32_C(4208339255), UINT32_C(1238426278) },
+      { UINT32_C(1235126853), UINT32_C(3424014328), UINT32_C(1096589168), UINT32_C(2193798829) } },
+    { { UINT32_C(3980219466), UINT32_C(2884863656), UINT32_C( 934190021), UINT32_C( 781560715) },
+      { UINT32_C(2753977248), UINT32_C(2047713160), UINT32_C(3888902912), UINT32_C(2190679415) },
+      { UINT32_C(  99624237), UINT32_C(3048209314), UINT32_C(3386303246), UINT32_C(3131441314) },
+      { UINT32_C(2734351564), UINT32_C(2360582171), UINT32_C(1498223065), UINT32_C( 247984476) } },
+    { { UINT32_C(1337788195), UINT32_C(1769158742), UINT32_C(1599351166), UINT32_C(3246006260) },
+      { UINT32_C( 660943240), UINT32_C( 875917598), UINT32_C(1427624483), UINT32_C(3959054220) },
+      { UINT32_C(1389094375), UINT32_C( 481013682), UINT32_C( 146595014), UINT32_C(3937040238) },
+      { UINT32_C(2968726592), UINT32_C(1913793552), UINT32_C(1124163076), UINT32_C(3645229223) } },
+    { { UINT32_C(  23417068), UINT32_C(3956319124), UINT32_C(3511892393), UINT32_C(2691019179) },
+      { UINT32_C(3862135686), UINT32_C(1287837809), UINT32_C( 731157267), UINT32_C(1820592054) },
+      { UINT32_C(4091002113), UINT32_C( 542920378), UINT32_C( 672032876), UINT32_C( 111306167) },
+      { UINT32_C(1478071990), UINT32_C(2652205933), UINT32_C(1708633407), UINT32_C(1501462878) } },
+    { { UINT32_C(2784290339), UINT32_C(2685197488), UINT32_C(1220503253), UINT32_C(2885527999) },
+      { UINT32_C( 851812624), UINT32_C( 464531415), UINT32_C(1748719286), UINT32_C(3798736081) },
+      { UINT32_C(4223515261), UINT32_C( 274225466), UINT32_C(2604144891), UINT32_C(2724342600) },
+      { UINT32_C( 463033820), UINT32_C(2675932653), UINT32_C(3955122075), UINT32_C(3708737659) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde__m128i k = simde_mm_loadu_si128(test_vec[i].k);
+    simde__m128i r = simde_mm_sha256rnds2_epu32(a, b, k);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_si128(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_sha256_abc(SIMDE_MUNIT_TEST_ARGS) {
+  static const uint32_t k[64] = {
+    UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5),
+    UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
+    UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3),
+    UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
+    UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc),
+    UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
+    UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7),
+    UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
+    UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13),
+    UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
+    UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3),
+    UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
+    UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5),
+    UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
+    UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208),
+    UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2)
+  };
+  /* "abc", padded, as big-endian words. */
+  static const uint32_t block[16] = {
+    UINT32_C(0x61626380), UINT32_C(0), UINT32_C(0), UINT32_C(0),
+    UINT32_C(0), UINT32_C(0), UINT32_C(0), UINT32_C(0),
+    UINT32_C(0), UINT32_C(0), UINT32_C(0), UINT32_C(0),
+    UINT32_C(0), UINT32_C(0), UINT32_C(0), UINT32_C(0x18)
+  };
+  static const uint32_t digest[8] = {
+    UINT32_C(0xba7816bf), UINT32_C(0x8f01cfea), UINT32_C(0x414140de), UINT32_C(0x5dae2223),
+    UINT32_C(0xb00361a3), UINT32_C(0x96177a9c), UINT32_C(0xb410ff61), UINT32_C(0xf20015ad)
+  };
+
+  simde__m128i abef = simde_mm_set_epi32(
+    HEDLEY_STATIC_CAST(int32_t, UINT32_C(0x6a09e667)), HEDLEY_STATIC_CAST(int32_t, UINT32_C(0xbb67ae85)),
+    HEDLEY_STATIC_CAST(int32_t, UINT32_C(0x510e527f)), HEDLEY_STATIC_CAST(int32_t, UINT32_C(0x9b05688c)));
+  simde__m128i cdgh = simde_mm_set_epi32(
+    HEDLEY_STATIC_CAST(int32_t, UINT32_C(0x3c6ef372)), HEDLEY_STATIC_CAST(int32_t, UINT32_C(0xa54ff53a)),
+    HEDLEY_STATIC_CAST(int32_t, UINT32_C(0x1f83d9ab)), HEDLEY_STATIC_CAST(int32_t, UINT32_C(0x5be0cd19)));
+  simde__m128i w[4];
+  uint32_t r[8], t[4];
+
+  for (size_t i = 0 ; i < 16 ; i++) {
+    simde__m128i wk;
+
+    if (i < 4) {
+      w[i] = simde_mm_loadu_si128(&(block[i * 4]));
+    } else {
+      simde__m128i w7 = simde_mm_or_si128(
+        simde_mm_srli_si128(w[(i + 2) & 3], 4),
+        simde_mm_slli_si128(w[(i + 3) & 3], 12));
+      w[i & 3] = simde_mm_sha256msg2_epu32(
+        simde_mm_add_epi32(simde_mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]), w7),
+        w[(i + 3) & 3]);
+    }
+
+    wk = simde_mm_add_epi32(w[i & 3], simde_mm_loadu_si128(&(k[i * 4])));
+    cdgh = simde_mm_sha256rnds2_epu32(cdgh, abef, wk);
+    abef = simde_mm_sha256rnds2_epu32(abef, cdgh, simde_mm_shuffle_epi32(wk, 0x0e));
+  }
+
+  simde_mm_storeu_si128(t, abef);
+  r[0] = t[3] + UINT32_C(0x6a09e667);
+  r[1] = t[2] + UINT32_C(0xbb67ae85);
+  r[4] = t[1] + UINT32_C(0x510e527f);
+  r[5] = t[0] + UINT32_C(0x9b05688c);
+  simde_mm_storeu_si128(t, cdgh);
+  r[2] = t[3] + UINT32_C(0x3c6ef372);
+  r[3] = t[2] + UINT32_C(0xa54ff53a);
+  r[6] = t[1] + UINT32_C(0x1f83d9ab);
+  r[7] = t[0] + UINT32_C(0x5be0cd19);
+
+  simde_assert_equal_vu32(8, r, digest);
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1nexte_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1rnds4_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256rnds2_epu32)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_sha256_abc)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
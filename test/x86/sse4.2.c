@@ -25,6 +25,392 @@
 #include <test/x86/test-sse2.h>
 #include <simde/x86/sse4.2.h>
 
+static int
+test_simde_mm_cmpestri_8(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int r[8];
+  } test_vec[] = {
+    { { INT8_C(  -1), INT8_C(  98), INT8_C(  99), INT8_C(  98), INT8_C(  57), INT8_C(  48), INT8_C(-128), INT8_C(  -1),
+        INT8_C(  99), INT8_C( 127), INT8_C(-128), INT8_C(   1), INT8_C(-128), INT8_C(   1), INT8_C(  98), INT8_C( 122) },
+       14,
+      { INT8_C(  97), INT8_C(  98), INT8_C( 127), INT8_C(  97), INT8_C( 122), INT8_C( 122), INT8_C(  48), INT8_C(  99),
+        INT8_C( 127), INT8_C(   1), INT8_C(  99), INT8_C( 122), INT8_C(   1), INT8_C(  48), INT8_C(  -1), INT8_C(-128) },
+        5,
+      {  1, 15,  2, 16,  0,  0, 16,  4 } },
+    { { INT8_C(  97), INT8_C(  48), INT8_C(  98), INT8_C(  57), INT8_C(  57), INT8_C(  98), INT8_C(-128), INT8_C(  97),
+        INT8_C(  48), INT8_C(  97), INT8_C(  48), INT8_C(  57), INT8_C( 122), INT8_C(  98), INT8_C(  57), INT8_C(  57) },
+       16,
+      { INT8_C(  97), INT8_C(  98), INT8_C(  97), INT8_C(-128), INT8_C(  48), INT8_C(  98), INT8_C( 122), INT8_C(-128),
+        INT8_C(   1), INT8_C( 122), INT8_C(  97), INT8_C(  57), INT8_C( 127), INT8_C(   1), INT8_C(  97), INT8_C(-128) },
+        1,
+      {  0, 15,  0, 16,  1, 16, 16,  0 } },
+    { { INT8_C(  97), INT8_C(  99), INT8_C(  99), INT8_C( 127), INT8_C(   1), INT8_C( 127), INT8_C(  98), INT8_C(   1),
+        INT8_C(   1), INT8_C(  99), INT8_C(  99), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  98), INT8_C(  48) },
+       16,
+      { INT8_C(  57), INT8_C(-128), INT8_C( 122), INT8_C(  98), INT8_C(  97), INT8_C( 122), INT8_C(  97), INT8_C(  57),
+        INT8_C(  48), INT8_C(  57), INT8_C(  48), INT8_C(   1), INT8_C(  98), INT8_C( 127), INT8_C(  -1), INT8_C( 122) },
+        7,
+      {  3, 15,  0,  1,  0,  0, 16,  6 } },
+    { { INT8_C(  97), INT8_C(  97), INT8_C(   1), INT8_C( 122), INT8_C(  48), INT8_C(  97), INT8_C(  99), INT8_C(   1),
+        INT8_C( 127), INT8_C(  98), INT8_C(  99), INT8_C(  -1), INT8_C(-128), INT8_C(   1), INT8_C(  57), INT8_C( 127) },
+        2,
+      { INT8_C( 127), INT8_C(  98), INT8_C(   1), INT8_C(   1), INT8_C(  57), INT8_C( 122), INT8_C(  97), INT8_C(  97),
+        INT8_C(   1), INT8_C( 122), INT8_C(   1), INT8_C(  97), INT8_C(   1), INT8_C(  98), INT8_C(  57), INT8_C(-128) },
+       11,
+      {  6, 15,  6, 10,  0,  0,  6, 10 } },
+    { { INT8_C(  98), INT8_C(  98), INT8_C(   1), INT8_C(  98), INT8_C(-128), INT8_C(  97), INT8_C(  48), INT8_C(  99),
+        INT8_C(  97), INT8_C(   1), INT8_C(   1), INT8_C(  98), INT8_C( 122), INT8_C(  48), INT8_C(  98), INT8_C(  97) },
+        5,
+      { INT8_C(  48), INT8_C(  57), INT8_C( 122), INT8_C( 122), INT8_C(  97), INT8_C(  57), INT8_C(  98), INT8_C( 127),
+        INT8_C(  97), INT8_C( 127), INT8_C( 127), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(  48), INT8_C(  99) },
+        1,
+      { 16, 15,  0, 16,  0,  0, 16,  0 } },
+    { { INT8_C(  97), INT8_C(   1), INT8_C(  57), INT8_C( 122), INT8_C(  98), INT8_C(   1), INT8_C( 127), INT8_C( 122),
+        INT8_C(   1), INT8_C(-128), INT8_C( 122), INT8_C(  48), INT8_C(  97), INT8_C(  48), INT8_C(  97), INT8_C(-128) },
+        7,
+      { INT8_C(  97), INT8_C(   1), INT8_C(  -1), INT8_C(  57), INT8_C(   1), INT8_C( 122), INT8_C(   1), INT8_C(   1),
+        INT8_C(  57), INT8_C( 122), INT8_C(  99), INT8_C(-128), INT8_C(  -1), INT8_C(  99), INT8_C(  48), INT8_C(  97) },
+        0,
+      { 16, 15, 16, 16,  0,  7, 16, 16 } },
+    { { INT8_C(  99), INT8_C( 127), INT8_C( 127), INT8_C(  98), INT8_C(   1), INT8_C(-128), INT8_C(  48), INT8_C( 122),
+        INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  48), INT8_C(   1), INT8_C(-128), INT8_C(  97), INT8_C(  97) },
+      -19,
+      { INT8_C(   1), INT8_C(  -1), INT8_C(-128), INT8_C( 127), INT8_C(-128), INT8_C(  97), INT8_C(  48), INT8_C(-128),
+        INT8_C( 127), INT8_C(  97), INT8_C( 122), INT8_C(  -1), INT8_C(  99), INT8_C(  57), INT8_C(  99), INT8_C(  57) },
+       -1,
+      {  0, 15,  0, 16,  0,  0, 16,  0 } },
+    { { INT8_C(  98), INT8_C(  99), INT8_C(  48), INT8_C(   1), INT8_C( 127), INT8_C(  57), INT8_C(  57), INT8_C(  57),
+        INT8_C(  99), INT8_C(  98), INT8_C(  99), INT8_C(  48), INT8_C(-128), INT8_C(  -1), INT8_C(  99), INT8_C( 122) },
+        2,
+      { INT8_C(  98), INT8_C( 127), INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  48), INT8_C( 122), INT8_C(  57),
+        INT8_C(  57), INT8_C(  98), INT8_C(  99), INT8_C(  48), INT8_C(   1), INT8_C( 127), INT8_C(  98), INT8_C( 122) },
+       21,
+      {  0, 15,  0, 15,  1,  1,  3, 15 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestri_16(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int la;
+    int16_t b[8];
+    int lb;
+    int r[8];
+  } test_vec[] = {
+    { { INT16_C(-32768), INT16_C(  1000), INT16_C(  1000), INT16_C(   122), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(   122) },
+        1,
+      { INT16_C(    98), INT16_C(    -1), INT16_C(  1000), INT16_C(    97), INT16_C(    98), INT16_C(    97), INT16_C( 32767), INT16_C(   122) },
+        7,
+      {  8,  7,  8,  6,  0,  0,  8,  6 } },
+    { { INT16_C(    -1), INT16_C(  1000), INT16_C(-32768), INT16_C(  1000), INT16_C(     1), INT16_C(-32768), INT16_C(    97), INT16_C( 32767) },
+        5,
+      { INT16_C(    -1), INT16_C(  1000), INT16_C(-32768), INT16_C(    -1), INT16_C( 32767), INT16_C(    -1), INT16_C(   122), INT16_C(    -1) },
+        7,
+      {  0,  7,  8,  4,  3,  3,  8,  6 } },
+    { { INT16_C(    98), INT16_C(    98), INT16_C(-32768), INT16_C(-32768), INT16_C(    97), INT16_C(     1), INT16_C(    97), INT16_C(     1) },
+        3,
+      { INT16_C(    -1), INT16_C( 32767), INT16_C( 32767), INT16_C(     1), INT16_C(     1), INT16_C(-32768), INT16_C(   122), INT16_C(-32768) },
+        7,
+      {  5,  7,  8,  6,  0,  0,  8,  6 } },
+    { { INT16_C(    98), INT16_C(    98), INT16_C(   122), INT16_C(    97), INT16_C(-32768), INT16_C(   122), INT16_C(     1), INT16_C(    98) },
+        2,
+      { INT16_C(    98), INT16_C(    98), INT16_C(    98), INT16_C(    97), INT16_C(     1), INT16_C(-32768), INT16_C(  1000), INT16_C(    98) },
+        1,
+      {  0,  7,  0,  8,  1,  2,  8,  0 } },
+    { { INT16_C(-32768), INT16_C( 32767), INT16_C(-32768), INT16_C( 32767), INT16_C(  1000), INT16_C(     1), INT16_C(  1000), INT16_C(  1000) },
+        0,
+      { INT16_C(    97), INT16_C(    -1), INT16_C( 32767), INT16_C(    -1), INT16_C(-32768), INT16_C(-32768), INT16_C(    97), INT16_C(-32768) },
+        7,
+      {  8,  7,  8,  6,  0,  0,  0,  7 } },
+    { { INT16_C( 32767), INT16_C(  1000), INT16_C(    -1), INT16_C(  1000), INT16_C(  1000), INT16_C(    -1), INT16_C(    -1), INT16_C(  1000) },
+        1,
+      { INT16_C(     1), INT16_C(    97), INT16_C(   122), INT16_C(-32768), INT16_C( 32767), INT16_C(  1000), INT16_C(    -1), INT16_C(  1000) },
+        3,
+      {  8,  7,  8,  2,  0,  0,  8,  2 } },
+    { { INT16_C(    -1), INT16_C(    98), INT16_C(   122), INT16_C(  1000), INT16_C(   122), INT16_C(    98), INT16_C(    -1), INT16_C(    97) },
+      -11,
+      { INT16_C(-32768), INT16_C(  1000), INT16_C(    -1), INT16_C(-32768), INT16_C(-32768), INT16_C(    97), INT16_C(    -1), INT16_C(    97) },
+       -7,
+      {  1,  7,  1,  4,  0,  0,  8,  6 } },
+    { { INT16_C(  1000), INT16_C(   122), INT16_C(    98), INT16_C(-32768), INT16_C(    97), INT16_C(    98), INT16_C(   122), INT16_C(-32768) },
+        1,
+      { INT16_C(  1000), INT16_C(   122), INT16_C(-32768), INT16_C(  1000), INT16_C(    97), INT16_C(    97), INT16_C(-32768), INT16_C(     1) },
+       13,
+      {  0,  7,  8,  7,  1,  1,  0,  7 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestrm_8(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int8_t r[4][16];
+  } test_vec[] = {
+    { { INT8_C( 122), INT8_C(  -1), INT8_C(  57), INT8_C(  98), INT8_C(  97), INT8_C(-128), INT8_C(   1), INT8_C(  97),
+        INT8_C( 127), INT8_C(  98), INT8_C( 127), INT8_C( 127), INT8_C(  -1), INT8_C(   1), INT8_C(  -1), INT8_C(  48) },
+        1,
+      { INT8_C(  99), INT8_C(   1), INT8_C(  -1), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(  99), INT8_C( 127),
+        INT8_C( 122), INT8_C(   1), INT8_C(  48), INT8_C( 127), INT8_C(-128), INT8_C(   1), INT8_C(  99), INT8_C(  99) },
+        2,
+      { { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C( 122), INT8_C(  97), INT8_C( 127), INT8_C(  48), INT8_C( 127), INT8_C(  98), INT8_C( 122), INT8_C(  48),
+        INT8_C(  99), INT8_C( 122), INT8_C(  99), INT8_C( 127), INT8_C(  97), INT8_C(  -1), INT8_C(  97), INT8_C( 127) },
+       14,
+      { INT8_C(  98), INT8_C(-128), INT8_C(  98), INT8_C(-128), INT8_C(  57), INT8_C(  97), INT8_C(  98), INT8_C(-128),
+        INT8_C(  48), INT8_C( 122), INT8_C(  97), INT8_C( 127), INT8_C(  48), INT8_C(  -1), INT8_C(  97), INT8_C(  -1) },
+        8,
+      { { INT8_C( 101), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(  97), INT8_C(  97), INT8_C(  57), INT8_C( 122), INT8_C(  57), INT8_C(-128), INT8_C(  98), INT8_C( 127),
+        INT8_C(   1), INT8_C(-128), INT8_C(  48), INT8_C(-128), INT8_C(  57), INT8_C( 122), INT8_C(-128), INT8_C(  98) },
+       16,
+      { INT8_C(-128), INT8_C(  97), INT8_C( 122), INT8_C( 127), INT8_C(-128), INT8_C(-128), INT8_C(  97), INT8_C(  57),
+        INT8_C( 127), INT8_C(  98), INT8_C( 122), INT8_C(-128), INT8_C(  -1), INT8_C( 127), INT8_C( 127), INT8_C(-128) },
+        3,
+      { { INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(   1), INT8_C(-128), INT8_C( 122), INT8_C(  98), INT8_C(   1), INT8_C(  98), INT8_C( 127), INT8_C(-128),
+        INT8_C(  48), INT8_C( 122), INT8_C(  98), INT8_C(   1), INT8_C(   1), INT8_C(  -1), INT8_C(  57), INT8_C(  -1) },
+        5,
+      { INT8_C(  99), INT8_C(  99), INT8_C(  99), INT8_C(  97), INT8_C(  99), INT8_C(-128), INT8_C(  99), INT8_C(   1),
+        INT8_C(-128), INT8_C(  98), INT8_C( 127), INT8_C(  -1), INT8_C(  -1), INT8_C(  99), INT8_C( 122), INT8_C(-128) },
+        4,
+      { { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(-128), INT8_C(   1), INT8_C(  57), INT8_C( 127), INT8_C(  57), INT8_C(  57), INT8_C(   1), INT8_C(  99),
+        INT8_C( 127), INT8_C( 127), INT8_C(  97), INT8_C(  99), INT8_C( 127), INT8_C(  57), INT8_C( 122), INT8_C(-128) },
+        2,
+      { INT8_C(  98), INT8_C( 127), INT8_C(  99), INT8_C(  57), INT8_C(  57), INT8_C(   1), INT8_C( 127), INT8_C(  97),
+        INT8_C(  99), INT8_C(-128), INT8_C(  48), INT8_C(  -1), INT8_C( 127), INT8_C(  -1), INT8_C(  48), INT8_C(  99) },
+       10,
+      { { INT8_C(  32), INT8_C(   2), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(  97), INT8_C(  98), INT8_C(  97), INT8_C(  -1), INT8_C(  57), INT8_C(-128), INT8_C(  97), INT8_C(  98),
+        INT8_C(  57), INT8_C(  57), INT8_C(  97), INT8_C(-128), INT8_C(  98), INT8_C(  98), INT8_C(  48), INT8_C( 127) },
+       10,
+      { INT8_C(  57), INT8_C(  97), INT8_C(  98), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(  -1), INT8_C( 127),
+        INT8_C(  99), INT8_C(-128), INT8_C( 122), INT8_C(  57), INT8_C(  99), INT8_C( 127), INT8_C(  98), INT8_C(-128) },
+       15,
+      { { INT8_C( 127), INT8_C(  74), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(-128), INT8_C(  -1), INT8_C( 122), INT8_C(  48), INT8_C(  98), INT8_C( 122), INT8_C(   1), INT8_C(  -1),
+        INT8_C(  98), INT8_C( 127), INT8_C( 127), INT8_C(  48), INT8_C( 122), INT8_C(  97), INT8_C(  48), INT8_C(   1) },
+      -19,
+      { INT8_C(  57), INT8_C(  48), INT8_C( 122), INT8_C( 122), INT8_C(  57), INT8_C(   1), INT8_C( 127), INT8_C(  98),
+        INT8_C(  -1), INT8_C(  48), INT8_C(  97), INT8_C( 122), INT8_C( 122), INT8_C(   1), INT8_C(   1), INT8_C(  99) },
+       -1,
+      { { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(-128), INT8_C(  97), INT8_C(  99), INT8_C(  48), INT8_C( 127), INT8_C(   1), INT8_C(  99), INT8_C(  97),
+        INT8_C(   1), INT8_C(  -1), INT8_C(  98), INT8_C(  48), INT8_C( 122), INT8_C(  98), INT8_C(  57), INT8_C(  97) },
+        1,
+      { INT8_C( 127), INT8_C( 122), INT8_C( 122), INT8_C( 127), INT8_C( 122), INT8_C(-128), INT8_C(-128), INT8_C(  97),
+        INT8_C(  99), INT8_C(  48), INT8_C(  98), INT8_C(  48), INT8_C(  57), INT8_C( 122), INT8_C(  57), INT8_C(  99) },
+       21,
+      { { INT8_C(  96), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[0]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[1]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[2]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestrm_16(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int la;
+    int16_t b[8];
+    int lb;
+    int16_t r[4][8];
+  } test_vec[] = {
+    { { INT16_C(    -1), INT16_C(   122), INT16_C(-32768), INT16_C(    98), INT16_C(    98), INT16_C(    98), INT16_C(   122), INT16_C( 32767) },
+        3,
+      { INT16_C(  1000), INT16_C(   122), INT16_C(     1), INT16_C(    -1), INT16_C(    97), INT16_C(-32768), INT16_C(    -1), INT16_C(  1000) },
+        2,
+      { { INT16_C(     2), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(    -1), INT16_C(-32768), INT16_C(  1000), INT16_C(    -1), INT16_C(    -1), INT16_C(     1), INT16_C(   122), INT16_C(    98) },
+        0,
+      { INT16_C(    97), INT16_C(    98), INT16_C(    97), INT16_C(    -1), INT16_C(-32768), INT16_C( 32767), INT16_C(    -1), INT16_C(    -1) },
+        3,
+      { { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) } } },
+    { { INT16_C(  1000), INT16_C(     1), INT16_C(  1000), INT16_C(    97), INT16_C(-32768), INT16_C(    -1), INT16_C(     1), INT16_C(   122) },
+        8,
+      { INT16_C(-32768), INT16_C(    -1), INT16_C(    98), INT16_C(    98), INT16_C(     1), INT16_C(    98), INT16_C(    98), INT16_C(   122) },
+        7,
+      { { INT16_C(    19), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C( 32767), INT16_C(    -1), INT16_C(  1000), INT16_C(    98), INT16_C(  1000), INT16_C(  1000), INT16_C( 32767), INT16_C(    -1) },
+        8,
+      { INT16_C(-32768), INT16_C( 32767), INT16_C( 32767), INT16_C(    -1), INT16_C(     1), INT16_C( 32767), INT16_C(    -1), INT16_C(-32768) },
+        7,
+      { { INT16_C(   110), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(    97), INT16_C(    98), INT16_C(-32768), INT16_C( 32767), INT16_C(  1000), INT16_C( 32767), INT16_C(-32768), INT16_C(    97) },
+        7,
+      { INT16_C(    -1), INT16_C(-32768), INT16_C(    98), INT16_C(     1), INT16_C(    97), INT16_C(   122), INT16_C(   122), INT16_C(    98) },
+        5,
+      { { INT16_C(    22), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(-32768), INT16_C(    97), INT16_C(  1000), INT16_C( 32767), INT16_C(    -1), INT16_C(     1), INT16_C(   122), INT16_C(     1) },
+        0,
+      { INT16_C(    -1), INT16_C(    97), INT16_C(-32768), INT16_C(    97), INT16_C(  1000), INT16_C(  1000), INT16_C(     1), INT16_C(    -1) },
+        5,
+      { { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) } } },
+    { { INT16_C(  1000), INT16_C(  1000), INT16_C(   122), INT16_C(    -1), INT16_C(    98), INT16_C(    -1), INT16_C(    98), INT16_C(     1) },
+      -11,
+      { INT16_C(    97), INT16_C(   122), INT16_C(    97), INT16_C(   122), INT16_C(-32768), INT16_C(     1), INT16_C(    -1), INT16_C(    -1) },
+       -3,
+      { { INT16_C(     2), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C( 32767), INT16_C(     1), INT16_C(  1000), INT16_C(    98), INT16_C(    98), INT16_C(     1), INT16_C(   122), INT16_C(    97) },
+        1,
+      { INT16_C( 32767), INT16_C( 32767), INT16_C(   122), INT16_C(   122), INT16_C(-32768), INT16_C(-32768), INT16_C(   122), INT16_C(   122) },
+       13,
+      { { INT16_C(     3), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[0]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[1]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[2]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm_cmpestrs_8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -428,6 +814,320 @@ test_simde_mm_cmpgt_epi64(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cmpistri_8(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int r[8];
+  } test_vec[] = {
+    { { INT8_C(   1), INT8_C( 122), INT8_C(  97), INT8_C(  -1), INT8_C( 127), INT8_C(  -1), INT8_C(  57), INT8_C(  -1),
+        INT8_C(  98), INT8_C(  98), INT8_C( 122), INT8_C( 122), INT8_C(   0), INT8_C(  48), INT8_C(  99), INT8_C(   1) },
+      { INT8_C(  98), INT8_C( 122), INT8_C(  57), INT8_C(  -1), INT8_C(-128), INT8_C( 122), INT8_C( 127), INT8_C(  99),
+        INT8_C(  99), INT8_C(   0), INT8_C(  99), INT8_C( 127), INT8_C(   1), INT8_C(  48), INT8_C(  98), INT8_C(  98) },
+      {  0, 15,  0,  6,  0,  0, 16,  8 } },
+    { { INT8_C( 127), INT8_C(  99), INT8_C(  99), INT8_C(  98), INT8_C(   0), INT8_C(  98), INT8_C(  98), INT8_C( 122),
+        INT8_C(  48), INT8_C(  48), INT8_C(  57), INT8_C(-128), INT8_C(  99), INT8_C(  97), INT8_C(  98), INT8_C(  99) },
+      { INT8_C(  48), INT8_C( 127), INT8_C(  98), INT8_C(-128), INT8_C(   1), INT8_C( 122), INT8_C(  99), INT8_C(  48),
+        INT8_C(  -1), INT8_C(  99), INT8_C(   1), INT8_C(   0), INT8_C(  99), INT8_C(  99), INT8_C(  98), INT8_C(  99) },
+      {  1, 15, 16, 10,  0,  0, 16, 10 } },
+    { { INT8_C(  57), INT8_C( 122), INT8_C(  99), INT8_C(  98), INT8_C(  98), INT8_C( 122), INT8_C(  97), INT8_C(-128),
+        INT8_C(   1), INT8_C(  57), INT8_C(  57), INT8_C(  98), INT8_C(   1), INT8_C(  48), INT8_C(  48), INT8_C(  57) },
+      { INT8_C(   1), INT8_C(  -1), INT8_C(  57), INT8_C(-128), INT8_C(   0), INT8_C(  -1), INT8_C(  97), INT8_C(-128),
+        INT8_C(   1), INT8_C(  97), INT8_C(-128), INT8_C(   1), INT8_C(  -1), INT8_C(  98), INT8_C(  48), INT8_C(   1) },
+      {  0, 15,  0,  3,  0,  0, 16,  3 } },
+    { { INT8_C( 127), INT8_C(  97), INT8_C(-128), INT8_C(  98), INT8_C( 127), INT8_C(   0), INT8_C(  98), INT8_C(  99),
+        INT8_C( 127), INT8_C(  -1), INT8_C(  99), INT8_C(  48), INT8_C(-128), INT8_C(  98), INT8_C( 122), INT8_C(-128) },
+      { INT8_C(  48), INT8_C(  -1), INT8_C(  -1), INT8_C( 122), INT8_C( 127), INT8_C(  97), INT8_C(  98), INT8_C( 122),
+        INT8_C(  98), INT8_C( 127), INT8_C( 122), INT8_C(  48), INT8_C(   1), INT8_C( 127), INT8_C(  97), INT8_C( 122) },
+      {  4, 15, 16, 15,  0,  0, 16, 15 } },
+    { { INT8_C(  98), INT8_C(  48), INT8_C(  99), INT8_C(  -1), INT8_C( 122), INT8_C(  48), INT8_C( 127), INT8_C(   1),
+        INT8_C(  -1), INT8_C( 127), INT8_C(-128), INT8_C(  97), INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C( 127) },
+      { INT8_C(   1), INT8_C( 122), INT8_C(  98), INT8_C( 122), INT8_C(  99), INT8_C(-128), INT8_C(  99), INT8_C(  98),
+        INT8_C(  57), INT8_C(  57), INT8_C(   0), INT8_C(   1), INT8_C(  48), INT8_C(  99), INT8_C(  48), INT8_C(  -1) },
+      {  0, 15,  1, 16,  0,  0, 16,  9 } },
+    { { INT8_C( 122), INT8_C(  98), INT8_C(  97), INT8_C(  57), INT8_C(   1), INT8_C(  99), INT8_C(  99), INT8_C( 122),
+        INT8_C(   1), INT8_C(  98), INT8_C(   1), INT8_C(-128), INT8_C( 122), INT8_C( 122), INT8_C(   1), INT8_C(  -1) },
+      { INT8_C( 127), INT8_C( 127), INT8_C(  57), INT8_C( 127), INT8_C(  57), INT8_C(  57), INT8_C(  97), INT8_C(   1),
+        INT8_C(   0), INT8_C( 122), INT8_C(   1), INT8_C(-128), INT8_C( 122), INT8_C( 127), INT8_C(  57), INT8_C(  48) },
+      {  2, 15,  0,  3,  0,  0, 16,  7 } },
+    { { INT8_C(  97), INT8_C( 122), INT8_C(   1), INT8_C(   1), INT8_C(  57), INT8_C(  98), INT8_C(  48), INT8_C(  99),
+        INT8_C( 122), INT8_C(   0), INT8_C( 122), INT8_C(   1), INT8_C(  48), INT8_C(-128), INT8_C(   1), INT8_C(-128) },
+      { INT8_C(-128), INT8_C(-128), INT8_C(  97), INT8_C(  99), INT8_C(  98), INT8_C(  98), INT8_C(  48), INT8_C( 122),
+        INT8_C(   1), INT8_C(  97), INT8_C(   0), INT8_C(  97), INT8_C(  57), INT8_C( 122), INT8_C(  -1), INT8_C(  98) },
+      {  2, 15,  2,  1,  0,  0, 16,  9 } },
+    { { INT8_C(  57), INT8_C(  97), INT8_C( 127), INT8_C(  97), INT8_C(-128), INT8_C(  48), INT8_C(   1), INT8_C(  99),
+        INT8_C( 127), INT8_C(  97), INT8_C(  57), INT8_C(   0), INT8_C(  -1), INT8_C( 127), INT8_C(  98), INT8_C(  97) },
+      { INT8_C( 122), INT8_C(-128), INT8_C( 122), INT8_C(   1), INT8_C(  -1), INT8_C(  99), INT8_C( 122), INT8_C(   1),
+        INT8_C(  97), INT8_C(  97), INT8_C(  57), INT8_C( 127), INT8_C(  57), INT8_C(  97), INT8_C(  97), INT8_C( 127) },
+      {  1,  6,  3, 15,  0,  0, 16, 15 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistri_16(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int r[8];
+  } test_vec[] = {
+    { { INT16_C(     0), INT16_C(    98), INT16_C(    98), INT16_C(   122), INT16_C(  1000), INT16_C(-32768), INT16_C(-32768), INT16_C(    97) },
+      { INT16_C(    98), INT16_C(    97), INT16_C(-32768), INT16_C(   122), INT16_C(   122), INT16_C(    98), INT16_C(-32768), INT16_C(     0) },
+      {  8,  7,  8,  6,  0,  0,  0,  7 } },
+    { { INT16_C(    98), INT16_C(   122), INT16_C(-32768), INT16_C(     0), INT16_C(-32768), INT16_C(   122), INT16_C(    97), INT16_C(  1000) },
+      { INT16_C(    97), INT16_C(    -1), INT16_C(    98), INT16_C(   122), INT16_C(     0), INT16_C(  1000), INT16_C(    -1), INT16_C(    98) },
+      {  2,  7,  2,  1,  0,  0,  8,  3 } },
+    { { INT16_C( 32767), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(  1000), INT16_C(    -1), INT16_C(   122), INT16_C(-32768) },
+      { INT16_C(-32768), INT16_C( 32767), INT16_C(-32768), INT16_C(    -1), INT16_C(     0), INT16_C( 32767), INT16_C(    98), INT16_C( 32767) },
+      {  0,  7,  0,  3,  0,  0,  8,  3 } },
+    { { INT16_C( 32767), INT16_C(-32768), INT16_C(     0), INT16_C(    -1), INT16_C(    98), INT16_C(     1), INT16_C( 32767), INT16_C( 32767) },
+      { INT16_C(-32768), INT16_C(   122), INT16_C( 32767), INT16_C(     1), INT16_C(    97), INT16_C( 32767), INT16_C(-32768), INT16_C(    -1) },
+      {  0,  7,  0,  7,  0,  0,  5,  7 } },
+    { { INT16_C(    97), INT16_C(-32768), INT16_C(    -1), INT16_C(    98), INT16_C(    -1), INT16_C(     0), INT16_C(    -1), INT16_C(  1000) },
+      { INT16_C(  1000), INT16_C(  1000), INT16_C(     0), INT16_C(    97), INT16_C(     1), INT16_C(   122), INT16_C(    98), INT16_C(  1000) },
+      {  8,  7,  0,  1,  0,  0,  8,  1 } },
+    { { INT16_C(    98), INT16_C(    -1), INT16_C(    -1), INT16_C(    98), INT16_C(  1000), INT16_C(     1), INT16_C(   122), INT16_C( 32767) },
+      { INT16_C( 32767), INT16_C( 32767), INT16_C(    98), INT16_C(    97), INT16_C(     1), INT16_C(    98), INT16_C(    -1), INT16_C(     0) },
+      {  0,  7,  0,  8,  0,  0,  8,  6 } },
+    { { INT16_C( 32767), INT16_C(  1000), INT16_C(     0), INT16_C(-32768), INT16_C(  1000), INT16_C(  1000), INT16_C(    97), INT16_C(-32768) },
+      { INT16_C(    -1), INT16_C(    97), INT16_C( 32767), INT16_C(    98), INT16_C(  1000), INT16_C(     0), INT16_C(    98), INT16_C(    98) },
+      {  2,  7,  8,  4,  0,  0,  8,  4 } },
+    { { INT16_C(   122), INT16_C(     1), INT16_C(    97), INT16_C(  1000), INT16_C( 32767), INT16_C(    98), INT16_C(    98), INT16_C(     0) },
+      { INT16_C(    -1), INT16_C(    -1), INT16_C( 32767), INT16_C(   122), INT16_C(     1), INT16_C(-32768), INT16_C(-32768), INT16_C(    98) },
+      {  2,  6,  3,  6,  0,  0,  8,  7 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistrm_8(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[4][16];
+  } test_vec[] = {
+    { { INT8_C(  97), INT8_C(-128), INT8_C(  99), INT8_C(  97), INT8_C(  98), INT8_C(   1), INT8_C( 127), INT8_C(   0),
+        INT8_C(   1), INT8_C(-128), INT8_C(  48), INT8_C(  97), INT8_C(  48), INT8_C(  98), INT8_C(  57), INT8_C(  98) },
+      { INT8_C(  -1), INT8_C(-128), INT8_C( 122), INT8_C(  98), INT8_C(  97), INT8_C(   1), INT8_C(  98), INT8_C(-128),
+        INT8_C(  98), INT8_C(  98), INT8_C(  -1), INT8_C(  97), INT8_C( 127), INT8_C(   0), INT8_C(  48), INT8_C(-128) },
+      { { INT8_C(  -6), INT8_C(  27), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(  99), INT8_C(   1), INT8_C(-128), INT8_C(  57), INT8_C(  98), INT8_C(  48), INT8_C( 127), INT8_C( 122),
+        INT8_C(  97), INT8_C(  57), INT8_C(  99), INT8_C( 122), INT8_C( 122), INT8_C(-128), INT8_C(  -1), INT8_C(   0) },
+      { INT8_C(-128), INT8_C(  57), INT8_C( 127), INT8_C(-128), INT8_C(  99), INT8_C(  97), INT8_C(  99), INT8_C(  57),
+        INT8_C( 122), INT8_C(   0), INT8_C( 127), INT8_C(   1), INT8_C(  57), INT8_C(  -1), INT8_C( 122), INT8_C( 127) },
+      { { INT8_C(  -1), INT8_C(   1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(-128), INT8_C(-128), INT8_C(   1), INT8_C(  57), INT8_C( 122), INT8_C( 127), INT8_C(  99), INT8_C( 127),
+        INT8_C(  98), INT8_C( 122), INT8_C(  98), INT8_C(  48), INT8_C(   1), INT8_C(  98), INT8_C(  -1), INT8_C(  57) },
+      { INT8_C(  -1), INT8_C(  98), INT8_C( 127), INT8_C(  99), INT8_C(  -1), INT8_C(  97), INT8_C(  99), INT8_C(  -1),
+        INT8_C( 122), INT8_C( 127), INT8_C(   1), INT8_C(-128), INT8_C(  48), INT8_C(  48), INT8_C(  -1), INT8_C(   0) },
+      { { INT8_C( -33), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(  48), INT8_C(  48), INT8_C(   1), INT8_C(  -1), INT8_C(  48), INT8_C(  97), INT8_C(  99), INT8_C(  57),
+        INT8_C(-128), INT8_C(  -1), INT8_C(  57), INT8_C(  57), INT8_C(   1), INT8_C(-128), INT8_C(-128), INT8_C(   0) },
+      { INT8_C(  48), INT8_C(  48), INT8_C(   1), INT8_C(  -1), INT8_C( 127), INT8_C(  99), INT8_C( 122), INT8_C(  99),
+        INT8_C(  -1), INT8_C(  48), INT8_C( 122), INT8_C(  97), INT8_C(  99), INT8_C(  48), INT8_C( 122), INT8_C(  98) },
+      { { INT8_C( -81), INT8_C(  59), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C( 127), INT8_C(-128), INT8_C(  98), INT8_C(  97), INT8_C(-128), INT8_C( 122), INT8_C(   1), INT8_C(   1),
+        INT8_C(  57), INT8_C(  98), INT8_C( 127), INT8_C(  -1), INT8_C(   0), INT8_C(   1), INT8_C(  97), INT8_C(  98) },
+      { INT8_C(   1), INT8_C( 127), INT8_C(   1), INT8_C(  -1), INT8_C( 122), INT8_C( 122), INT8_C(-128), INT8_C(  99),
+        INT8_C(   0), INT8_C(   1), INT8_C(-128), INT8_C(  98), INT8_C(   1), INT8_C( 127), INT8_C(   1), INT8_C( 127) },
+      { { INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(   1), INT8_C(-128), INT8_C(  99), INT8_C(  97), INT8_C(  97), INT8_C(  -1), INT8_C(  99), INT8_C(  48),
+        INT8_C(-128), INT8_C(  98), INT8_C( 122), INT8_C( 127), INT8_C(  48), INT8_C(  48), INT8_C(   1), INT8_C(  57) },
+      { INT8_C(   1), INT8_C(   0), INT8_C(  98), INT8_C(  99), INT8_C(  98), INT8_C(  57), INT8_C(   1), INT8_C(-128),
+        INT8_C(  99), INT8_C(  97), INT8_C( 122), INT8_C(  48), INT8_C(  98), INT8_C(  48), INT8_C( 122), INT8_C(  97) },
+      { { INT8_C(   1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(   1), INT8_C( 127), INT8_C(  -1), INT8_C(  99), INT8_C(  97), INT8_C(  57), INT8_C(   0), INT8_C( 127),
+        INT8_C( 122), INT8_C(  -1), INT8_C( 127), INT8_C(-128), INT8_C(-128), INT8_C(   1), INT8_C(  48), INT8_C(  98) },
+      { INT8_C(   1), INT8_C(  97), INT8_C( 122), INT8_C(  -1), INT8_C(  48), INT8_C(  48), INT8_C(  57), INT8_C(  97),
+        INT8_C(  48), INT8_C(   0), INT8_C(  99), INT8_C(  48), INT8_C(-128), INT8_C(  48), INT8_C(  -1), INT8_C(  57) },
+      { { INT8_C( -53), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } },
+    { { INT8_C(  -1), INT8_C(-128), INT8_C(-128), INT8_C(-128), INT8_C(   1), INT8_C(   0), INT8_C(-128), INT8_C(  97),
+        INT8_C(  -1), INT8_C(  99), INT8_C(  99), INT8_C(  98), INT8_C(  -1), INT8_C(-128), INT8_C(  57), INT8_C(   1) },
+      { INT8_C(  57), INT8_C(  -1), INT8_C(-128), INT8_C(  98), INT8_C(  48), INT8_C(  98), INT8_C(  57), INT8_C(  57),
+        INT8_C(  99), INT8_C(  97), INT8_C(  97), INT8_C(  -1), INT8_C(-128), INT8_C(  99), INT8_C(   1), INT8_C( 122) },
+      { { INT8_C(   6), INT8_C(  88), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1),
+          INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1) },
+        { INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+          INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[0]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[1]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[2]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistrm_16(SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[4][8];
+  } test_vec[] = {
+    { { INT16_C(    97), INT16_C( 32767), INT16_C(-32768), INT16_C(-32768), INT16_C(    98), INT16_C( 32767), INT16_C(     1), INT16_C(     0) },
+      { INT16_C(-32768), INT16_C(    98), INT16_C(    97), INT16_C(     1), INT16_C(-32768), INT16_C(-32768), INT16_C(     0), INT16_C(-32768) },
+      { { INT16_C(    63), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(     0), INT16_C(  1000), INT16_C( 32767), INT16_C(    98), INT16_C(    -1), INT16_C(     1), INT16_C(  1000), INT16_C( 32767) },
+      { INT16_C(  1000), INT16_C(  1000), INT16_C(-32768), INT16_C( 32767), INT16_C(  1000), INT16_C( 32767), INT16_C(-32768), INT16_C(     0) },
+      { { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) } } },
+    { { INT16_C(    -1), INT16_C(     1), INT16_C(-32768), INT16_C(    97), INT16_C(    97), INT16_C(    98), INT16_C(   122), INT16_C(    97) },
+      { INT16_C(     1), INT16_C(   122), INT16_C( 32767), INT16_C(     0), INT16_C( 32767), INT16_C(  1000), INT16_C(     1), INT16_C(  1000) },
+      { { INT16_C(     3), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(   122), INT16_C(-32768), INT16_C(     1), INT16_C(     0), INT16_C( 32767), INT16_C(   122), INT16_C(    98), INT16_C(    -1) },
+      { INT16_C(    98), INT16_C(   122), INT16_C( 32767), INT16_C(   122), INT16_C(    -1), INT16_C(    -1), INT16_C(    98), INT16_C(  1000) },
+      { { INT16_C(    10), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(   122), INT16_C(     0), INT16_C( 32767), INT16_C(     1), INT16_C(  1000), INT16_C(    -1), INT16_C(-32768), INT16_C(  1000) },
+      { INT16_C( 32767), INT16_C(    -1), INT16_C( 32767), INT16_C(    98), INT16_C(    97), INT16_C(     0), INT16_C(    -1), INT16_C(  1000) },
+      { { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(     1), INT16_C(     1), INT16_C(   122), INT16_C(     1), INT16_C(-32768), INT16_C(     1), INT16_C(   122), INT16_C(  1000) },
+      { INT16_C( 32767), INT16_C(    97), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(     1), INT16_C(-32768), INT16_C(    97) },
+      { { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C( 32767), INT16_C(     0), INT16_C(-32768), INT16_C(  1000), INT16_C(-32768), INT16_C(    98), INT16_C(    97), INT16_C(-32768) },
+      { INT16_C(   122), INT16_C(   122), INT16_C(     0), INT16_C(   122), INT16_C(    98), INT16_C(  1000), INT16_C(   122), INT16_C(   122) },
+      { { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } },
+    { { INT16_C(-32768), INT16_C(     1), INT16_C( 32767), INT16_C(    97), INT16_C(-32768), INT16_C(     0), INT16_C(    97), INT16_C(    98) },
+      { INT16_C(    98), INT16_C(     1), INT16_C(  1000), INT16_C(    98), INT16_C(-32768), INT16_C(     1), INT16_C( 32767), INT16_C(   122) },
+      { { INT16_C(   114), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) },
+        { INT16_C(    -1), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(     0), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(    -1), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(     0), INT16_C(    -1), INT16_C(    -1), INT16_C(    -1) },
+        { INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0), INT16_C(     0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[0]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[1]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[2]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm_cmpistrs_8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -1063,12 +1763,68 @@ test_simde_mm_crc32_u64 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_popcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    int32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0), INT32_C( 0) },
+    { UINT32_C(2239039009), INT32_C(12) },
+    { UINT32_C( 151143426), INT32_C( 6) },
+    { UINT32_C(  67111440), INT32_C( 4) },
+    { UINT32_C( 236000768), INT32_C( 8) },
+    { UINT32_C( 632426858), INT32_C(13) },
+    { UINT32_C(4294966782), INT32_C(30) },
+    {           UINT32_MAX, INT32_C(32) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_mm_popcnt_u32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    int64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0), INT64_C( 0) },
+    { UINT64_C( 1910661523599001616), INT64_C(14) },
+    { UINT64_C( 4611705329878565568), INT64_C(13) },
+    { UINT64_C(10658110173077307119), INT64_C(45) },
+    { UINT64_C(15507791271923015671), INT64_C(51) },
+    { UINT64_C(10511390515679672663), INT64_C(44) },
+    { UINT64_C(17159481718628811076), INT64_C(28) },
+    {                     UINT64_MAX, INT64_C(64) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_mm_popcnt_u64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestri_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestri_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrm_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrm_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrs_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrz_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrz_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpgt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistri_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistri_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrm_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrm_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrz_8)
@@ -1077,6 +1833,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_u64)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
@@ -26,6 +26,81 @@
 #include <test/x86/avx512/test-avx512.h>
 #include <simde/x86/svml.h>
 
+/* The *_ulp tests check results against correctly rounded values to
+ * within max_ulp units in the last place instead of a number of
+ * decimal places.  NaN and infinity must match exactly. */
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DIAGNOSTIC_DISABLE_FLOAT_EQUAL_
+
+static int
+simde_test_svml_assert_ulp_f32x4_(simde__m128 a, simde__m128 b, int max_ulp,
+    const char* filename, int line, const char* astr, const char* bstr) {
+  simde_float32 a_[4], b_[4];
+  simde_mm_storeu_ps(a_, a);
+  simde_mm_storeu_ps(b_, b);
+
+  for (size_t i = 0 ; i < (sizeof(a_) / sizeof(a_[0])) ; i++) {
+    int ok;
+    if (simde_math_isnan(b_[i]) || simde_math_isinf(b_[i])) {
+      ok = simde_math_isnan(b_[i]) ? simde_math_isnan(a_[i]) : (a_[i] == b_[i]);
+    } else if (simde_math_isnan(a_[i]) || simde_math_isinf(a_[i])) {
+      ok = 0;
+    } else {
+      /* Map the bits to integers which are ordered like the floats. */
+      uint32_t ai, bi;
+      simde_memcpy(&ai, &a_[i], sizeof(ai));
+      simde_memcpy(&bi, &b_[i], sizeof(bi));
+      ai = (ai >> 31) ? ~ai : (ai | (UINT32_C(1) << 31));
+      bi = (bi >> 31) ? ~bi : (bi | (UINT32_C(1) << 31));
+      ok = ((ai > bi) ? (ai - bi) : (bi - ai)) <= HEDLEY_STATIC_CAST(uint32_t, max_ulp);
+    }
+
+    if (HEDLEY_UNLIKELY(!ok)) {
+      simde_test_debug_printf_("%s:%d: assertion failed: %s[%zu] ~= %s[%zu] (%.9g ~= %.9g, max %d ulp)\n",
+          filename, line, astr, i, bstr, i, HEDLEY_STATIC_CAST(double, a_[i]), HEDLEY_STATIC_CAST(double, b_[i]), max_ulp);
+      SIMDE_TEST_ASSERT_RETURN(1);
+    }
+  }
+
+  return 0;
+}
+#define simde_test_svml_assert_ulp_f32x4(a, b, max_ulp) do { if (simde_test_svml_assert_ulp_f32x4_(a, b, max_ulp, __FILE__, __LINE__, #a, #b)) { return 1; } } while (0)
+
+static int
+simde_test_svml_assert_ulp_f64x2_(simde__m128d a, simde__m128d b, int max_ulp,
+    const char* filename, int line, const char* astr, const char* bstr) {
+  simde_float64 a_[2], b_[2];
+  simde_mm_storeu_pd(a_, a);
+  simde_mm_storeu_pd(b_, b);
+
+  for (size_t i = 0 ; i < (sizeof(a_) / sizeof(a_[0])) ; i++) {
+    int ok;
+    if (simde_math_isnan(b_[i]) || simde_math_isinf(b_[i])) {
+      ok = simde_math_isnan(b_[i]) ? simde_math_isnan(a_[i]) : (a_[i] == b_[i]);
+    } else if (simde_math_isnan(a_[i]) || simde_math_isinf(a_[i])) {
+      ok = 0;
+    } else {
+      uint64_t ai, bi;
+      simde_memcpy(&ai, &a_[i], sizeof(ai));
+      simde_memcpy(&bi, &b_[i], sizeof(bi));
+      ai = (ai >> 63) ? ~ai : (ai | (UINT64_C(1) << 63));
+      bi = (bi >> 63) ? ~bi : (bi | (UINT64_C(1) << 63));
+      ok = ((ai > bi) ? (ai - bi) : (bi - ai)) <= HEDLEY_STATIC_CAST(uint64_t, max_ulp);
+    }
+
+    if (HEDLEY_UNLIKELY(!ok)) {
+      simde_test_debug_printf_("%s:%d: assertion failed: %s[%zu] ~= %s[%zu] (%.17g ~= %.17g, max %d ulp)\n",
+          filename, line, astr, i, bstr, i, a_[i], b_[i], max_ulp);
+      SIMDE_TEST_ASSERT_RETURN(1);
+    }
+  }
+
+  return 0;
+}
+#define simde_test_svml_assert_ulp_f64x2(a, b, max_ulp) do { if (simde_test_svml_assert_ulp_f64x2_(a, b, max_ulp, __FILE__, __LINE__, #a, #b)) { return 1; } } while (0)
+
+HEDLEY_DIAGNOSTIC_POP
+
 static int
 test_simde_mm_acos_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -2474,6 +2549,72 @@ test_simde_mm_atan_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_atan_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 1.57079637e+00), SIMDE_FLOAT32_C(-1.57079637e+00) } },
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C(-1.00000000e+00), SIMDE_FLOAT32_C( 1.00000002e+30) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 7.85398185e-01), SIMDE_FLOAT32_C(-7.85398185e-01), SIMDE_FLOAT32_C( 1.57079637e+00) } },
+    { { SIMDE_FLOAT32_C(-1.00000000e-30), SIMDE_FLOAT32_C( 4.40930337e-01), SIMDE_FLOAT32_C(-4.45575684e-01), SIMDE_FLOAT32_C( 1.22760355e+00) },
+      { SIMDE_FLOAT32_C(-1.00000000e-30), SIMDE_FLOAT32_C( 4.15286034e-01), SIMDE_FLOAT32_C(-4.19168562e-01), SIMDE_FLOAT32_C( 8.87219012e-01) } },
+    { { SIMDE_FLOAT32_C(-5.50033379e+00), SIMDE_FLOAT32_C(-2.13816452e+00), SIMDE_FLOAT32_C(-1.12123215e+00), SIMDE_FLOAT32_C(-4.29917479e+00) },
+      { SIMDE_FLOAT32_C(-1.39095354e+00), SIMDE_FLOAT32_C(-1.13332844e+00), SIMDE_FLOAT32_C(-8.42487812e-01), SIMDE_FLOAT32_C(-1.34225738e+00) } },
+    { { SIMDE_FLOAT32_C(-7.10437918e+00), SIMDE_FLOAT32_C( 1.27109003e+00), SIMDE_FLOAT32_C( 7.29357386e+00), SIMDE_FLOAT32_C( 7.90803671e+00) },
+      { SIMDE_FLOAT32_C(-1.43095684e+00), SIMDE_FLOAT32_C( 9.04201627e-01), SIMDE_FLOAT32_C( 1.43453884e+00), SIMDE_FLOAT32_C( 1.44501030e+00) } },
+    { { SIMDE_FLOAT32_C(-5.38390636e+00), SIMDE_FLOAT32_C(-9.91976833e+00), SIMDE_FLOAT32_C(-7.88382232e-01), SIMDE_FLOAT32_C(-6.47353411e+00) },
+      { SIMDE_FLOAT32_C(-1.38715041e+00), SIMDE_FLOAT32_C(-1.47032690e+00), SIMDE_FLOAT32_C(-6.67616665e-01), SIMDE_FLOAT32_C(-1.41753268e+00) } },
+    { { SIMDE_FLOAT32_C( 2.52332449e+00), SIMDE_FLOAT32_C( 8.89747238e+00), SIMDE_FLOAT32_C( 6.92169189e+00), SIMDE_FLOAT32_C(-9.80006123e+00) },
+      { SIMDE_FLOAT32_C( 1.19348145e+00), SIMDE_FLOAT32_C( 1.45887458e+00), SIMDE_FLOAT32_C( 1.42731571e+00), SIMDE_FLOAT32_C(-1.46910810e+00) } },
+    { { SIMDE_FLOAT32_C(-4.85838270e+00), SIMDE_FLOAT32_C(-9.18493271e+00), SIMDE_FLOAT32_C(-1.12105095e+00), SIMDE_FLOAT32_C(-6.51114893e+00) },
+      { SIMDE_FLOAT32_C(-1.36780155e+00), SIMDE_FLOAT32_C(-1.46234953e+00), SIMDE_FLOAT32_C(-8.42407525e-01), SIMDE_FLOAT32_C(-1.41840434e+00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_atan_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_atan_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) } },
+    { {                        SIMDE_MATH_INFINITY,                       -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(   1.5707963267948966e+00), SIMDE_FLOAT64_C(  -1.5707963267948966e+00) } },
+    { {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   1.0000000000000000e+00) },
+      {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   7.8539816339744828e-01) } },
+    { { SIMDE_FLOAT64_C(  1.0000000000000001e+300), SIMDE_FLOAT64_C( -1.0000000000000000e-300) },
+      { SIMDE_FLOAT64_C(   1.5707963267948966e+00), SIMDE_FLOAT64_C( -1.0000000000000000e-300) } },
+    { { SIMDE_FLOAT64_C(  -2.6695866289872612e+00), SIMDE_FLOAT64_C(  -8.8236144365852773e+00) },
+      { SIMDE_FLOAT64_C(  -1.2123853066037757e+00), SIMDE_FLOAT64_C(  -1.4579456006948550e+00) } },
+    { { SIMDE_FLOAT64_C(   1.2486561626422485e+00), SIMDE_FLOAT64_C(  -7.3212157084239724e+00) },
+      { SIMDE_FLOAT64_C(   8.9553061628317510e-01), SIMDE_FLOAT64_C(  -1.4350470391199595e+00) } },
+    { { SIMDE_FLOAT64_C(   7.5737277407076817e+00), SIMDE_FLOAT64_C(   1.3688771200221375e+00) },
+      { SIMDE_FLOAT64_C(   1.4395202949778787e+00), SIMDE_FLOAT64_C(   9.3987567082292323e-01) } },
+    { { SIMDE_FLOAT64_C(   4.2568066642884261e-01), SIMDE_FLOAT64_C(  -5.8624274636909499e+00) },
+      { SIMDE_FLOAT64_C(   4.0244703673740151e-01), SIMDE_FLOAT64_C(  -1.4018446492914383e+00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_atan_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_atan_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -5746,6 +5887,72 @@ test_simde_mm_cos_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cos_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) },
+      { SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00) } },
+    { { SIMDE_FLOAT32_C( 1.57079637e+00), SIMDE_FLOAT32_C(-3.14159274e+00), SIMDE_FLOAT32_C( 1.00000000e+02), SIMDE_FLOAT32_C(-1.00000000e+04) },
+      { SIMDE_FLOAT32_C(-4.37113883e-08), SIMDE_FLOAT32_C(-1.00000000e+00), SIMDE_FLOAT32_C( 8.62318873e-01), SIMDE_FLOAT32_C(-9.52155352e-01) } },
+    { { SIMDE_FLOAT32_C( 1.00000000e+05), SIMDE_FLOAT32_C(-3.00000000e+06), SIMDE_FLOAT32_C( 1.00000000e+10), SIMDE_FLOAT32_C(-1.00000002e+30) },
+      { SIMDE_FLOAT32_C(-9.99360800e-01), SIMDE_FLOAT32_C( 4.77760643e-01), SIMDE_FLOAT32_C( 8.73119652e-01), SIMDE_FLOAT32_C(-6.11604810e-01) } },
+    { { SIMDE_FLOAT32_C( 3.40282347e+38),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C( 8.53021026e-01),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(-6.51114883e+01), SIMDE_FLOAT32_C(-2.66958656e+01), SIMDE_FLOAT32_C(-8.82361450e+01), SIMDE_FLOAT32_C( 1.24865618e+01) },
+      { SIMDE_FLOAT32_C(-6.50952816e-01), SIMDE_FLOAT32_C( 7.67184934e-03), SIMDE_FLOAT32_C( 9.63356137e-01), SIMDE_FLOAT32_C( 9.96816993e-01) } },
+    { { SIMDE_FLOAT32_C(-7.32121582e+01), SIMDE_FLOAT32_C( 7.57372742e+01), SIMDE_FLOAT32_C( 1.36887712e+01), SIMDE_FLOAT32_C( 4.25680685e+00) },
+      { SIMDE_FLOAT32_C(-5.77178359e-01), SIMDE_FLOAT32_C( 9.43070889e-01), SIMDE_FLOAT32_C( 4.33520377e-01), SIMDE_FLOAT32_C(-4.39985156e-01) } },
+    { { SIMDE_FLOAT32_C(-5.86242752e+01), SIMDE_FLOAT32_C( 7.37550659e+01), SIMDE_FLOAT32_C( 5.40932312e+01), SIMDE_FLOAT32_C( 5.36517601e+01) },
+      { SIMDE_FLOAT32_C(-4.83642131e-01), SIMDE_FLOAT32_C(-7.22983107e-02), SIMDE_FLOAT32_C(-7.73687124e-01), SIMDE_FLOAT32_C(-9.70213711e-01) } },
+    { { SIMDE_FLOAT32_C(-8.12482758e+01), SIMDE_FLOAT32_C(-6.72884140e+01), SIMDE_FLOAT32_C(-5.75605621e+01), SIMDE_FLOAT32_C(-2.42400227e+01) },
+      { SIMDE_FLOAT32_C( 9.07655120e-01), SIMDE_FLOAT32_C(-2.53046602e-01), SIMDE_FLOAT32_C( 5.30255556e-01), SIMDE_FLOAT32_C( 6.27297163e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_cos_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cos_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.5707963267948966e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(   6.1232339957367660e-17) } },
+    { { SIMDE_FLOAT64_C(  -3.1415926535897931e+00), SIMDE_FLOAT64_C(  -1.0000000000000000e+04) },
+      { SIMDE_FLOAT64_C(  -1.0000000000000000e+00), SIMDE_FLOAT64_C(  -9.5215536825901481e-01) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000000e+08), SIMDE_FLOAT64_C(  -1.0000000000000000e+15) },
+      { SIMDE_FLOAT64_C(  -3.6338508935569053e-01), SIMDE_FLOAT64_C(  -5.1319373778697031e-01) } },
+    { { SIMDE_FLOAT64_C(  1.0000000000000001e+300),                        SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(  -5.7538611195754907e-01),                             SIMDE_MATH_NAN } },
+    { {                       -SIMDE_MATH_INFINITY,                             SIMDE_MATH_NAN },
+      {                             SIMDE_MATH_NAN,                             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -3.8332204212589282e+01), SIMDE_FLOAT64_C(   5.5150338893360612e+01) },
+      { SIMDE_FLOAT64_C(   8.0620179444920459e-01), SIMDE_FLOAT64_C(   1.7161371817249502e-01) } },
+    { { SIMDE_FLOAT64_C(  -5.1304282039079943e+01), SIMDE_FLOAT64_C(  -5.9251837040880616e+01) },
+      { SIMDE_FLOAT64_C(   5.0725513811674394e-01), SIMDE_FLOAT64_C(  -9.0542208427231485e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_cos_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_cos_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -11699,6 +11906,72 @@ test_simde_mm_erf_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_erf_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C(-1.00000000e+00) } },
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 1.00000000e-30), SIMDE_FLOAT32_C( 4.72464800e-01), SIMDE_FLOAT32_C(-3.00000000e+00) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 1.12837913e-30), SIMDE_FLOAT32_C( 4.95972455e-01), SIMDE_FLOAT32_C(-9.99977887e-01) } },
+    { { SIMDE_FLOAT32_C( 6.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+01), SIMDE_FLOAT32_C( 1.30035577e-03), SIMDE_FLOAT32_C( 4.91041392e-01) },
+      { SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.46729348e-03), SIMDE_FLOAT32_C( 5.12592077e-01) } },
+    { { SIMDE_FLOAT32_C(-2.20013356e+00), SIMDE_FLOAT32_C(-8.55265737e-01), SIMDE_FLOAT32_C(-4.48492855e-01), SIMDE_FLOAT32_C(-1.71966994e+00) },
+      { SIMDE_FLOAT32_C(-9.98138368e-01), SIMDE_FLOAT32_C(-7.73540080e-01), SIMDE_FLOAT32_C(-4.74091887e-01), SIMDE_FLOAT32_C(-9.84983504e-01) } },
+    { { SIMDE_FLOAT32_C(-2.84175158e+00), SIMDE_FLOAT32_C( 5.08436024e-01), SIMDE_FLOAT32_C( 2.91742969e+00), SIMDE_FLOAT32_C( 3.16321468e+00) },
+      { SIMDE_FLOAT32_C(-9.99941528e-01), SIMDE_FLOAT32_C( 5.27881980e-01), SIMDE_FLOAT32_C( 9.99963045e-01), SIMDE_FLOAT32_C( 9.99992311e-01) } },
+    { { SIMDE_FLOAT32_C(-2.15356255e+00), SIMDE_FLOAT32_C(-3.96790719e+00), SIMDE_FLOAT32_C(-3.15352887e-01), SIMDE_FLOAT32_C(-2.58941364e+00) },
+      { SIMDE_FLOAT32_C(-9.97677803e-01), SIMDE_FLOAT32_C(-1.00000000e+00), SIMDE_FLOAT32_C(-3.44385654e-01), SIMDE_FLOAT32_C(-9.99749720e-01) } },
+    { { SIMDE_FLOAT32_C( 1.00932980e+00), SIMDE_FLOAT32_C( 3.55898881e+00), SIMDE_FLOAT32_C( 2.76867676e+00), SIMDE_FLOAT32_C(-3.92002439e+00) },
+      { SIMDE_FLOAT32_C( 8.46537650e-01), SIMDE_FLOAT32_C( 9.99999523e-01), SIMDE_FLOAT32_C( 9.99909759e-01), SIMDE_FLOAT32_C(-1.00000000e+00) } },
+    { { SIMDE_FLOAT32_C(-1.94335306e+00), SIMDE_FLOAT32_C(-3.67397308e+00), SIMDE_FLOAT32_C(-4.48420376e-01), SIMDE_FLOAT32_C(-2.60445952e+00) },
+      { SIMDE_FLOAT32_C(-9.94009793e-01), SIMDE_FLOAT32_C(-9.99999821e-01), SIMDE_FLOAT32_C(-4.74025011e-01), SIMDE_FLOAT32_C(-9.99769747e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_erf_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_erf_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) } },
+    { {                        SIMDE_MATH_INFINITY,                       -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(  -1.0000000000000000e+00) } },
+    { {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  1.0000000000000000e-300) },
+      {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  1.1283791670955126e-300) } },
+    { { SIMDE_FLOAT64_C(  -4.6817450107455905e-01), SIMDE_FLOAT64_C(   6.5000000000000000e+00) },
+      { SIMDE_FLOAT64_C(  -4.9209204964936570e-01), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(  -1.0678346515949046e+00), SIMDE_FLOAT64_C(  -3.5294457746341106e+00) },
+      { SIMDE_FLOAT64_C(  -8.6899388886205819e-01), SIMDE_FLOAT64_C(  -9.9999940053706604e-01) } },
+    { { SIMDE_FLOAT64_C(   4.9946246505689906e-01), SIMDE_FLOAT64_C(  -2.9284862833695886e+00) },
+      { SIMDE_FLOAT64_C(   5.2002737453284853e-01), SIMDE_FLOAT64_C(  -9.9996549656787470e-01) } },
+    { { SIMDE_FLOAT64_C(   3.0294910962830723e+00), SIMDE_FLOAT64_C(   5.4755084800885534e-01) },
+      { SIMDE_FLOAT64_C(   9.9998167236462654e-01), SIMDE_FLOAT64_C(   5.6127842435742581e-01) } },
+    { { SIMDE_FLOAT64_C(   1.7027226657153705e-01), SIMDE_FLOAT64_C(  -2.3449709854763796e+00) },
+      { SIMDE_FLOAT64_C(   1.9029091572101317e-01), SIMDE_FLOAT64_C(  -9.9908778809415544e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_erf_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_erf_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -13611,6 +13884,72 @@ test_simde_mm_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_exp_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C(-1.00000000e+00) },
+      { SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 2.71828175e+00), SIMDE_FLOAT32_C( 3.67879450e-01) } },
+    { { SIMDE_FLOAT32_C( 8.85000000e+01), SIMDE_FLOAT32_C( 8.90000000e+01), SIMDE_FLOAT32_C(-8.75000000e+01), SIMDE_FLOAT32_C(-1.00000000e+02) },
+      { SIMDE_FLOAT32_C( 2.72308792e+38),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 9.98235140e-39), SIMDE_FLOAT32_C( 3.78350585e-44) } },
+    { { SIMDE_FLOAT32_C(-1.03500000e+02), SIMDE_FLOAT32_C(-1.10000000e+02),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C( 1.40129846e-45), SIMDE_FLOAT32_C( 0.00000000e+00),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 0.00000000e+00) } },
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 9.99999994e-09), SIMDE_FLOAT32_C( 9.82082844e+00), SIMDE_FLOAT32_C(-4.40026703e+01) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.84132988e+04), SIMDE_FLOAT32_C( 7.76038232e-20) } },
+    { { SIMDE_FLOAT32_C(-1.71053162e+01), SIMDE_FLOAT32_C(-8.96985722e+00), SIMDE_FLOAT32_C(-3.43933983e+01), SIMDE_FLOAT32_C(-5.68350334e+01) },
+      { SIMDE_FLOAT32_C( 3.72610920e-08), SIMDE_FLOAT32_C( 1.27186344e-04), SIMDE_FLOAT32_C( 1.15647674e-15), SIMDE_FLOAT32_C( 2.07423801e-25) } },
+    { { SIMDE_FLOAT32_C( 1.01687202e+01), SIMDE_FLOAT32_C( 5.83485909e+01), SIMDE_FLOAT32_C( 6.32642937e+01), SIMDE_FLOAT32_C(-4.30712509e+01) },
+      { SIMDE_FLOAT32_C( 2.60746855e+04), SIMDE_FLOAT32_C( 2.19013581e+25), SIMDE_FLOAT32_C( 2.98767688e+27), SIMDE_FLOAT32_C( 1.96966968e-19) } },
+    { { SIMDE_FLOAT32_C(-7.93581467e+01), SIMDE_FLOAT32_C(-6.30705786e+00), SIMDE_FLOAT32_C(-5.17882729e+01), SIMDE_FLOAT32_C( 2.01865959e+01) },
+      { SIMDE_FLOAT32_C( 3.42921577e-35), SIMDE_FLOAT32_C( 1.82339002e-03), SIMDE_FLOAT32_C( 3.22581064e-23), SIMDE_FLOAT32_C( 5.84692096e+08) } },
+    { { SIMDE_FLOAT32_C( 7.11797791e+01), SIMDE_FLOAT32_C( 5.53735352e+01), SIMDE_FLOAT32_C(-7.84004898e+01), SIMDE_FLOAT32_C(-3.88670616e+01) },
+      { SIMDE_FLOAT32_C( 8.18437037e+30), SIMDE_FLOAT32_C( 1.11794583e+24), SIMDE_FLOAT32_C( 8.93510992e-35), SIMDE_FLOAT32_C( 1.31901459e-17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_exp_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_exp_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(   7.0950000000000000e+02), SIMDE_FLOAT64_C(   7.1000000000000000e+02) },
+      { SIMDE_FLOAT64_C(  1.3549863193146328e+308),                        SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C(  -7.0850000000000000e+02), SIMDE_FLOAT64_C(  -7.4000000000000000e+02) },
+      { SIMDE_FLOAT64_C(  2.0061323053313060e-308), SIMDE_FLOAT64_C(  4.1995579896505956e-322) } },
+    { { SIMDE_FLOAT64_C(  -7.4500000000000000e+02), SIMDE_FLOAT64_C(  -8.0000000000000000e+02) },
+      { SIMDE_FLOAT64_C(  4.9406564584124654e-324), SIMDE_FLOAT64_C(   0.0000000000000000e+00) } },
+    { {                        SIMDE_MATH_INFINITY,                       -SIMDE_MATH_INFINITY },
+      {                        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.0000000000000000e+00) } },
+    { {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   1.0000000000000001e-17) },
+      {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(  -6.4294527850250961e+02), SIMDE_FLOAT64_C(  -7.8473566089977339e+01) },
+      { SIMDE_FLOAT64_C(  5.9212497665094731e-280), SIMDE_FLOAT64_C(   8.3054519849242511e-35) } },
+    { { SIMDE_FLOAT64_C(  -4.5578043551919075e+02), SIMDE_FLOAT64_C(  -1.8687106402910831e+02) },
+      { SIMDE_FLOAT64_C(  1.1404385639325247e-198), SIMDE_FLOAT64_C(   6.9651113654709736e-82) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_exp_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -16914,6 +17253,72 @@ test_simde_mm_log_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_log_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C(-1.00000000e+00),      -SIMDE_MATH_INFINITYF },
+      {      -SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { {       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 9.99994610e-41) },
+      {       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-9.21034088e+01) } },
+    { { SIMDE_FLOAT32_C( 1.40129846e-45), SIMDE_FLOAT32_C( 1.17549435e-38), SIMDE_FLOAT32_C( 3.40282347e+38), SIMDE_FLOAT32_C( 5.00000000e-01) },
+      { SIMDE_FLOAT32_C(-1.03278931e+02), SIMDE_FLOAT32_C(-8.73365479e+01), SIMDE_FLOAT32_C( 8.87228394e+01), SIMDE_FLOAT32_C(-6.93147182e-01) } },
+    { { SIMDE_FLOAT32_C( 2.00000000e+00), SIMDE_FLOAT32_C( 7.07106769e-01), SIMDE_FLOAT32_C( 1.41421354e+00), SIMDE_FLOAT32_C( 5.61380188e+02) },
+      { SIMDE_FLOAT32_C( 6.93147182e-01), SIMDE_FLOAT32_C(-3.46573621e-01), SIMDE_FLOAT32_C( 3.46573561e-01), SIMDE_FLOAT32_C( 6.33039856e+00) } },
+    { { SIMDE_FLOAT32_C( 2.24983307e+02), SIMDE_FLOAT32_C( 3.93091766e+02), SIMDE_FLOAT32_C( 4.43938385e+02), SIMDE_FLOAT32_C( 2.85041260e+02) },
+      { SIMDE_FLOAT32_C( 5.41602612e+00), SIMDE_FLOAT32_C( 5.97404289e+00), SIMDE_FLOAT32_C( 6.09568596e+00), SIMDE_FLOAT32_C( 5.65263414e+00) } },
+    { { SIMDE_FLOAT32_C( 1.44781052e+02), SIMDE_FLOAT32_C( 5.63554504e+02), SIMDE_FLOAT32_C( 8.64678711e+02), SIMDE_FLOAT32_C( 8.95401855e+02) },
+      { SIMDE_FLOAT32_C( 4.97522259e+00), SIMDE_FLOAT32_C( 6.33426428e+00), SIMDE_FLOAT32_C( 6.76235819e+00), SIMDE_FLOAT32_C( 6.79727268e+00) } },
+    { { SIMDE_FLOAT32_C( 2.30804672e+02), SIMDE_FLOAT32_C( 4.01160574e+00), SIMDE_FLOAT32_C( 4.60580902e+02), SIMDE_FLOAT32_C( 1.76323288e+02) },
+      { SIMDE_FLOAT32_C( 5.44157171e+00), SIMDE_FLOAT32_C( 1.38919163e+00), SIMDE_FLOAT32_C( 6.13248873e+00), SIMDE_FLOAT32_C( 5.17231894e+00) } },
+    { { SIMDE_FLOAT32_C( 6.26166260e+02), SIMDE_FLOAT32_C( 9.44873596e+02), SIMDE_FLOAT32_C( 8.46084595e+02), SIMDE_FLOAT32_C( 9.99693966e+00) },
+      { SIMDE_FLOAT32_C( 6.43961573e+00), SIMDE_FLOAT32_C( 6.85105133e+00), SIMDE_FLOAT32_C( 6.74061918e+00), SIMDE_FLOAT32_C( 2.30227900e+00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_log_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_log_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      {                       -SIMDE_MATH_INFINITY,                       -SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C(  -1.0000000000000000e+00),                       -SIMDE_MATH_INFINITY },
+      {                             SIMDE_MATH_NAN,                             SIMDE_MATH_NAN } },
+    { {                        SIMDE_MATH_INFINITY,                             SIMDE_MATH_NAN },
+      {                        SIMDE_MATH_INFINITY,                             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(  9.9999999999999694e-311) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -7.1380137882815416e+02) } },
+    { { SIMDE_FLOAT64_C(  4.9406564584124654e-324), SIMDE_FLOAT64_C(  2.2250738585072014e-308) },
+      { SIMDE_FLOAT64_C(  -7.4444007192138122e+02), SIMDE_FLOAT64_C(  -7.0839641853226408e+02) } },
+    { { SIMDE_FLOAT64_C(  1.7976931348623157e+308), SIMDE_FLOAT64_C(   7.0710678118654757e-01) },
+      { SIMDE_FLOAT64_C(   7.0978271289338397e+02), SIMDE_FLOAT64_C(  -3.4657359027997259e-01) } },
+    { { SIMDE_FLOAT64_C(   2.5708087499117522e+02), SIMDE_FLOAT64_C(   4.0753372498207433e+01) },
+      { SIMDE_FLOAT64_C(   5.5493907240727376e+00), SIMDE_FLOAT64_C(   3.7075385969546013e+00) } },
+    { { SIMDE_FLOAT64_C(   4.4394745279287332e+02), SIMDE_FLOAT64_C(   1.7444254605772090e+02) },
+      { SIMDE_FLOAT64_C(   6.0957062058627614e+00), SIMDE_FLOAT64_C(   5.1615954384752563e+00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_log_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_log_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -19892,6 +20297,92 @@ test_simde_mm_pow_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_pow_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 2.00000000e+00), SIMDE_FLOAT32_C( 2.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+01), SIMDE_FLOAT32_C(-2.00000000e+00) },
+      { SIMDE_FLOAT32_C( 1.00000000e+01), SIMDE_FLOAT32_C(-1.00000000e+01), SIMDE_FLOAT32_C( 3.80000000e+01), SIMDE_FLOAT32_C( 3.00000000e+00) },
+      { SIMDE_FLOAT32_C( 1.02400000e+03), SIMDE_FLOAT32_C( 9.76562500e-04), SIMDE_FLOAT32_C( 9.99999968e+37), SIMDE_FLOAT32_C(-8.00000000e+00) } },
+    { { SIMDE_FLOAT32_C(-2.00000000e+00), SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00) },
+      { SIMDE_FLOAT32_C( 5.00000000e-01), SIMDE_FLOAT32_C(-1.00000000e+00), SIMDE_FLOAT32_C( 2.00000000e+00), SIMDE_FLOAT32_C(-3.00000000e+00) },
+      {            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 0.00000000e+00),      -SIMDE_MATH_INFINITYF } },
+    { {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 1.00000000e+00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-1.00000000e+00) },
+      { SIMDE_FLOAT32_C(-2.00000000e+00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 0.00000000e+00),       SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00) } },
+    { { SIMDE_FLOAT32_C( 2.00000000e+00), SIMDE_FLOAT32_C( 3.75000000e+00), SIMDE_FLOAT32_C( 1.00000005e-03), SIMDE_FLOAT32_C( 5.00000000e-01) },
+      { SIMDE_FLOAT32_C( 2.00000000e+02), SIMDE_FLOAT32_C(-5.00000000e+01), SIMDE_FLOAT32_C( 2.50000000e+00), SIMDE_FLOAT32_C( 3.29999995e+00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 1.98809264e-29), SIMDE_FLOAT32_C( 3.16227791e-08), SIMDE_FLOAT32_C( 1.01531550e-01) } },
+    { { SIMDE_FLOAT32_C( 1.12276039e+01), SIMDE_FLOAT32_C( 7.86183548e+00), SIMDE_FLOAT32_C( 5.70082521e+00), SIMDE_FLOAT32_C( 1.12710896e+01) },
+      { SIMDE_FLOAT32_C(-5.50033379e+00), SIMDE_FLOAT32_C(-1.12123215e+00), SIMDE_FLOAT32_C(-7.10437918e+00), SIMDE_FLOAT32_C( 7.29357386e+00) },
+      { SIMDE_FLOAT32_C( 1.67136182e-06), SIMDE_FLOAT32_C( 9.90626067e-02), SIMDE_FLOAT32_C( 4.26119868e-06), SIMDE_FLOAT32_C( 4.70533960e+07) } },
+    { { SIMDE_FLOAT32_C( 1.79080372e+01), SIMDE_FLOAT32_C( 8.02321211e-02), SIMDE_FLOAT32_C( 3.52646589e+00), SIMDE_FLOAT32_C( 1.88974724e+01) },
+      { SIMDE_FLOAT32_C(-5.38390636e+00), SIMDE_FLOAT32_C(-7.88382232e-01), SIMDE_FLOAT32_C( 2.52332449e+00), SIMDE_FLOAT32_C( 6.92169189e+00) },
+      { SIMDE_FLOAT32_C( 1.79352313e-07), SIMDE_FLOAT32_C( 7.30789614e+00), SIMDE_FLOAT32_C( 2.40500317e+01), SIMDE_FLOAT32_C( 6.83712128e+08) } },
+    { { SIMDE_FLOAT32_C( 1.99938789e-01), SIMDE_FLOAT32_C( 8.15067470e-01), SIMDE_FLOAT32_C( 3.48885083e+00), SIMDE_FLOAT32_C( 1.17638552e+00) },
+      { SIMDE_FLOAT32_C(-4.85838270e+00), SIMDE_FLOAT32_C(-1.12105095e+00), SIMDE_FLOAT32_C(-2.66958666e+00), SIMDE_FLOAT32_C( 1.24865615e+00) },
+      { SIMDE_FLOAT32_C( 2.49177979e+03), SIMDE_FLOAT32_C( 1.25764060e+00), SIMDE_FLOAT32_C( 3.55846174e-02), SIMDE_FLOAT32_C( 1.22487640e+00) } },
+    { { SIMDE_FLOAT32_C( 2.67878437e+00), SIMDE_FLOAT32_C( 1.13688774e+01), SIMDE_FLOAT32_C( 4.13757277e+00), SIMDE_FLOAT32_C( 1.54093227e+01) },
+      { SIMDE_FLOAT32_C( 7.57372761e+00), SIMDE_FLOAT32_C( 4.25680667e-01), SIMDE_FLOAT32_C( 7.37550640e+00), SIMDE_FLOAT32_C( 5.36517620e+00) },
+      { SIMDE_FLOAT32_C( 1.74214380e+03), SIMDE_FLOAT32_C( 2.81448269e+00), SIMDE_FLOAT32_C( 3.53843672e+04), SIMDE_FLOAT32_C( 2.35867475e+06) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_pow_ps(a, b);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_pow_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   2.0000000000000000e+00), SIMDE_FLOAT64_C(   1.0000000000000000e+01) },
+      { SIMDE_FLOAT64_C(  -1.0000000000000000e+01), SIMDE_FLOAT64_C(   3.0800000000000000e+02) },
+      { SIMDE_FLOAT64_C(   9.7656250000000000e-04), SIMDE_FLOAT64_C(  1.0000000000000000e+308) } },
+    { { SIMDE_FLOAT64_C(  -2.0000000000000000e+00), SIMDE_FLOAT64_C(  -2.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   3.0000000000000000e+00), SIMDE_FLOAT64_C(   5.0000000000000000e-01) },
+      { SIMDE_FLOAT64_C(  -8.0000000000000000e+00),                             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(  -1.0000000000000000e+00), SIMDE_FLOAT64_C(  -3.0000000000000000e+00) },
+      {                        SIMDE_MATH_INFINITY,                       -SIMDE_MATH_INFINITY } },
+    { {                        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   1.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(  -2.0000000000000000e+00),                             SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { {                             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -1.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00),                        SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(   2.0000000000000000e+00), SIMDE_FLOAT64_C(   3.7500000000000000e+00) },
+      { SIMDE_FLOAT64_C(   1.1000000000000000e+03), SIMDE_FLOAT64_C(  -5.3000000000000000e+02) },
+      {                        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  5.8000014790132555e-305) } },
+    { { SIMDE_FLOAT64_C(   9.3758635266571613e+00), SIMDE_FLOAT64_C(   2.1219719490604344e+01) },
+      { SIMDE_FLOAT64_C(  -6.7288414559927020e+01), SIMDE_FLOAT64_C(  -2.4240022769309590e+01) },
+      { SIMDE_FLOAT64_C(   3.9346148089576059e-66), SIMDE_FLOAT64_C(   6.9151396138988438e-33) } },
+    { { SIMDE_FLOAT64_C(   3.0833897893705359e+01), SIMDE_FLOAT64_C(   2.4347858980460028e+01) },
+      { SIMDE_FLOAT64_C(   5.5150338893360612e+01), SIMDE_FLOAT64_C(  -5.9251837040880616e+01) },
+      { SIMDE_FLOAT64_C(   1.3195399132586908e+82), SIMDE_FLOAT64_C(   7.0737862968576423e-83) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_pow_pd(a, b);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_pow_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -24566,6 +25057,72 @@ test_simde_mm_sin_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_sin_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) },
+      { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) } },
+    { { SIMDE_FLOAT32_C( 1.57079637e+00), SIMDE_FLOAT32_C(-3.14159274e+00), SIMDE_FLOAT32_C( 1.00000000e+02), SIMDE_FLOAT32_C(-1.00000000e+04) },
+      { SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 8.74227766e-08), SIMDE_FLOAT32_C(-5.06365657e-01), SIMDE_FLOAT32_C( 3.05614382e-01) } },
+    { { SIMDE_FLOAT32_C( 1.00000000e+05), SIMDE_FLOAT32_C(-3.00000000e+06), SIMDE_FLOAT32_C( 1.00000000e+10), SIMDE_FLOAT32_C(-1.00000002e+30) },
+      { SIMDE_FLOAT32_C( 3.57487984e-02), SIMDE_FLOAT32_C( 8.78490031e-01), SIMDE_FLOAT32_C(-4.87506032e-01), SIMDE_FLOAT32_C( 7.91163445e-01) } },
+    { { SIMDE_FLOAT32_C( 3.40282347e+38),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(-5.21876514e-01),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C( 1.22760353e+01), SIMDE_FLOAT32_C(-5.50033379e+01), SIMDE_FLOAT32_C(-2.13816433e+01), SIMDE_FLOAT32_C(-1.12123213e+01) },
+      { SIMDE_FLOAT32_C(-2.86273509e-01), SIMDE_FLOAT32_C( 9.99675751e-01), SIMDE_FLOAT32_C(-5.72461903e-01), SIMDE_FLOAT32_C( 9.76602197e-01) } },
+    { { SIMDE_FLOAT32_C(-4.29917488e+01), SIMDE_FLOAT32_C(-7.10437927e+01), SIMDE_FLOAT32_C( 1.27109003e+01), SIMDE_FLOAT32_C( 7.29357376e+01) },
+      { SIMDE_FLOAT32_C( 8.36326718e-01), SIMDE_FLOAT32_C(-9.36614215e-01), SIMDE_FLOAT32_C( 1.44027039e-01), SIMDE_FLOAT32_C(-6.28098071e-01) } },
+    { { SIMDE_FLOAT32_C( 7.90803680e+01), SIMDE_FLOAT32_C(-5.38390656e+01), SIMDE_FLOAT32_C(-9.91976776e+01), SIMDE_FLOAT32_C(-7.88382244e+00) },
+      { SIMDE_FLOAT32_C(-5.14609098e-01), SIMDE_FLOAT32_C( 4.18679208e-01), SIMDE_FLOAT32_C( 9.71927047e-01), SIMDE_FLOAT32_C(-9.99554813e-01) } },
+    { { SIMDE_FLOAT32_C(-6.47353439e+01), SIMDE_FLOAT32_C( 2.52332458e+01), SIMDE_FLOAT32_C( 8.89747162e+01), SIMDE_FLOAT32_C( 6.92169189e+01) },
+      { SIMDE_FLOAT32_C(-9.45165753e-01), SIMDE_FLOAT32_C( 1.00335501e-01), SIMDE_FLOAT32_C( 8.46896648e-01), SIMDE_FLOAT32_C( 1.01704411e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_sin_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sin_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.5707963267948966e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(  -3.1415926535897931e+00), SIMDE_FLOAT64_C(  -1.0000000000000000e+04) },
+      { SIMDE_FLOAT64_C(  -1.2246467991473532e-16), SIMDE_FLOAT64_C(   3.0561438888825215e-01) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000000e+08), SIMDE_FLOAT64_C(  -1.0000000000000000e+15) },
+      { SIMDE_FLOAT64_C(   9.3163902710972601e-01), SIMDE_FLOAT64_C(  -8.5827279317023586e-01) } },
+    { { SIMDE_FLOAT64_C(  1.0000000000000001e+300),                        SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(  -8.1788191211590855e-01),                             SIMDE_MATH_NAN } },
+    { {                       -SIMDE_MATH_INFINITY,                             SIMDE_MATH_NAN },
+      {                             SIMDE_MATH_NAN,                             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -9.8000612108968483e+01), SIMDE_FLOAT64_C(  -4.8583825001764957e+01) },
+      { SIMDE_FLOAT64_C(   5.7388325822521358e-01), SIMDE_FLOAT64_C(   9.9386119617293711e-01) } },
+    { { SIMDE_FLOAT64_C(  -9.1849325500358518e+01), SIMDE_FLOAT64_C(  -1.1210509441425330e+01) },
+      { SIMDE_FLOAT64_C(   6.7660230452755121e-01), SIMDE_FLOAT64_C(   9.7699022690972859e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_sin_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -25218,6 +25775,94 @@ test_simde_mm_sincos_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_sincos_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+    const simde_float32 c[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) },
+      { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) },
+      { SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 1.00000000e+00) } },
+    { { SIMDE_FLOAT32_C( 1.57079637e+00), SIMDE_FLOAT32_C(-3.14159274e+00), SIMDE_FLOAT32_C( 1.00000000e+02), SIMDE_FLOAT32_C(-1.00000000e+04) },
+      { SIMDE_FLOAT32_C( 1.00000000e+00), SIMDE_FLOAT32_C( 8.74227766e-08), SIMDE_FLOAT32_C(-5.06365657e-01), SIMDE_FLOAT32_C( 3.05614382e-01) },
+      { SIMDE_FLOAT32_C(-4.37113883e-08), SIMDE_FLOAT32_C(-1.00000000e+00), SIMDE_FLOAT32_C( 8.62318873e-01), SIMDE_FLOAT32_C(-9.52155352e-01) } },
+    { { SIMDE_FLOAT32_C( 1.00000000e+05), SIMDE_FLOAT32_C(-3.00000000e+06), SIMDE_FLOAT32_C( 1.00000000e+10), SIMDE_FLOAT32_C(-1.00000002e+30) },
+      { SIMDE_FLOAT32_C( 3.57487984e-02), SIMDE_FLOAT32_C( 8.78490031e-01), SIMDE_FLOAT32_C(-4.87506032e-01), SIMDE_FLOAT32_C( 7.91163445e-01) },
+      { SIMDE_FLOAT32_C(-9.99360800e-01), SIMDE_FLOAT32_C( 4.77760643e-01), SIMDE_FLOAT32_C( 8.73119652e-01), SIMDE_FLOAT32_C(-6.11604810e-01) } },
+    { { SIMDE_FLOAT32_C( 3.40282347e+38),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(-5.21876514e-01),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C( 8.53021026e-01),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(-9.19258575e+01), SIMDE_FLOAT32_C( 7.23855438e+01), SIMDE_FLOAT32_C(-5.19512177e+01), SIMDE_FLOAT32_C(-7.31741333e+01) },
+      { SIMDE_FLOAT32_C( 7.30921030e-01), SIMDE_FLOAT32_C(-1.28556028e-01), SIMDE_FLOAT32_C(-9.93401825e-01), SIMDE_FLOAT32_C( 7.94085979e-01) },
+      { SIMDE_FLOAT32_C(-6.82462037e-01), SIMDE_FLOAT32_C(-9.91702259e-01), SIMDE_FLOAT32_C(-1.14685960e-01), SIMDE_FLOAT32_C(-6.07805490e-01) } },
+    { { SIMDE_FLOAT32_C(-9.49028778e+01), SIMDE_FLOAT32_C(-9.51177883e+00), SIMDE_FLOAT32_C( 2.58584595e+00), SIMDE_FLOAT32_C(-3.32350807e+01) },
+      { SIMDE_FLOAT32_C(-6.09237134e-01), SIMDE_FLOAT32_C( 8.68911594e-02), SIMDE_FLOAT32_C( 5.27577758e-01), SIMDE_FLOAT32_C(-9.69317377e-01) },
+      { SIMDE_FLOAT32_C( 7.92988122e-01), SIMDE_FLOAT32_C(-9.96217787e-01), SIMDE_FLOAT32_C(-8.49506736e-01), SIMDE_FLOAT32_C(-2.45812535e-01) } },
+    { { SIMDE_FLOAT32_C(-5.43614388e+01), SIMDE_FLOAT32_C( 5.12815628e+01), SIMDE_FLOAT32_C( 7.51308393e+00), SIMDE_FLOAT32_C(-5.30501671e+01) },
+      { SIMDE_FLOAT32_C( 8.15945983e-01), SIMDE_FLOAT32_C( 8.50050092e-01), SIMDE_FLOAT32_C( 9.42454934e-01), SIMDE_FLOAT32_C(-3.49378794e-01) },
+      { SIMDE_FLOAT32_C(-5.78128099e-01), SIMDE_FLOAT32_C( 5.26701868e-01), SIMDE_FLOAT32_C( 3.34333271e-01), SIMDE_FLOAT32_C(-9.36981559e-01) } },
+    { { SIMDE_FLOAT32_C(-9.92203979e+01), SIMDE_FLOAT32_C(-5.96225739e+01), SIMDE_FLOAT32_C(-1.64742336e+01), SIMDE_FLOAT32_C( 7.55108871e+01) },
+      { SIMDE_FLOAT32_C( 9.66331005e-01), SIMDE_FLOAT32_C(-6.76348954e-02), SIMDE_FLOAT32_C( 6.93452835e-01), SIMDE_FLOAT32_C( 1.12425268e-01) },
+      { SIMDE_FLOAT32_C( 2.57302195e-01), SIMDE_FLOAT32_C(-9.97710168e-01), SIMDE_FLOAT32_C(-7.20502019e-01), SIMDE_FLOAT32_C( 9.93660212e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 c;
+    simde__m128 r = simde_mm_sincos_ps(&c, a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+    simde_test_svml_assert_ulp_f32x4(c, simde_mm_loadu_ps(test_vec[i].c), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sincos_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+    const simde_float64 c[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(   1.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.5707963267948966e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000000e+00), SIMDE_FLOAT64_C(   6.1232339957367660e-17) } },
+    { { SIMDE_FLOAT64_C(  -3.1415926535897931e+00), SIMDE_FLOAT64_C(  -1.0000000000000000e+04) },
+      { SIMDE_FLOAT64_C(  -1.2246467991473532e-16), SIMDE_FLOAT64_C(   3.0561438888825215e-01) },
+      { SIMDE_FLOAT64_C(  -1.0000000000000000e+00), SIMDE_FLOAT64_C(  -9.5215536825901481e-01) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000000e+08), SIMDE_FLOAT64_C(  -1.0000000000000000e+15) },
+      { SIMDE_FLOAT64_C(   9.3163902710972601e-01), SIMDE_FLOAT64_C(  -8.5827279317023586e-01) },
+      { SIMDE_FLOAT64_C(  -3.6338508935569053e-01), SIMDE_FLOAT64_C(  -5.1319373778697031e-01) } },
+    { { SIMDE_FLOAT64_C(  1.0000000000000001e+300),                        SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(  -8.1788191211590855e-01),                             SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(  -5.7538611195754907e-01),                             SIMDE_MATH_NAN } },
+    { {                       -SIMDE_MATH_INFINITY,                             SIMDE_MATH_NAN },
+      {                             SIMDE_MATH_NAN,                             SIMDE_MATH_NAN },
+      {                             SIMDE_MATH_NAN,                             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(   6.2216484808463832e+01), SIMDE_FLOAT64_C(  -1.0681380755585337e+01) },
+      { SIMDE_FLOAT64_C(  -5.7725927086672357e-01), SIMDE_FLOAT64_C(   9.5104592676888244e-01) },
+      { SIMDE_FLOAT64_C(   8.1656091885322224e-01), SIMDE_FLOAT64_C(  -3.0904958368572111e-01) } },
+    { { SIMDE_FLOAT64_C(   5.2241561167054613e+01), SIMDE_FLOAT64_C(   3.5471719939015685e+01) },
+      { SIMDE_FLOAT64_C(   9.1899109639273602e-01), SIMDE_FLOAT64_C(  -7.9207495837648489e-01) },
+      { SIMDE_FLOAT64_C(  -3.9427828338735177e-01), SIMDE_FLOAT64_C(  -6.1042383661918853e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d c;
+    simde__m128d r = simde_mm_sincos_pd(&c, a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+    simde_test_svml_assert_ulp_f64x2(c, simde_mm_loadu_pd(test_vec[i].c), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_sincos_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -28552,6 +29197,72 @@ test_simde_mm_tan_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_tan_ps_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) },
+      { SIMDE_FLOAT32_C( 0.00000000e+00), SIMDE_FLOAT32_C(-0.00000000e+00), SIMDE_FLOAT32_C( 9.99999997e-07), SIMDE_FLOAT32_C(-9.99999997e-07) } },
+    { { SIMDE_FLOAT32_C( 1.57079637e+00), SIMDE_FLOAT32_C(-3.14159274e+00), SIMDE_FLOAT32_C( 1.00000000e+02), SIMDE_FLOAT32_C(-1.00000000e+04) },
+      { SIMDE_FLOAT32_C(-2.28773320e+07), SIMDE_FLOAT32_C(-8.74227766e-08), SIMDE_FLOAT32_C(-5.87213933e-01), SIMDE_FLOAT32_C(-3.20971131e-01) } },
+    { { SIMDE_FLOAT32_C( 1.00000000e+05), SIMDE_FLOAT32_C(-3.00000000e+06), SIMDE_FLOAT32_C( 1.00000000e+10), SIMDE_FLOAT32_C(-1.00000002e+30) },
+      { SIMDE_FLOAT32_C(-3.57716642e-02), SIMDE_FLOAT32_C( 1.83876610e+00), SIMDE_FLOAT32_C(-5.58349609e-01), SIMDE_FLOAT32_C(-1.29358613e+00) } },
+    { { SIMDE_FLOAT32_C( 3.40282347e+38),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(-6.11797929e-01),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(-9.86887283e+01), SIMDE_FLOAT32_C(-5.05019608e+01), SIMDE_FLOAT32_C( 3.28643417e+01), SIMDE_FLOAT32_C(-6.34240685e+01) },
+      { SIMDE_FLOAT32_C(-3.59312439e+00), SIMDE_FLOAT32_C(-2.40987301e-01), SIMDE_FLOAT32_C( 8.13035965e+00), SIMDE_FLOAT32_C(-6.72768950e-01) } },
+    { { SIMDE_FLOAT32_C( 7.47312851e+01), SIMDE_FLOAT32_C( 2.18390598e+01), SIMDE_FLOAT32_C(-9.42071457e+01), SIMDE_FLOAT32_C( 7.67306747e+01) },
+      { SIMDE_FLOAT32_C(-7.87283242e-01), SIMDE_FLOAT32_C(-1.53272346e-01), SIMDE_FLOAT32_C( 4.06562947e-02), SIMDE_FLOAT32_C( 4.11584330e+00) } },
+    { { SIMDE_FLOAT32_C( 7.32552338e+01), SIMDE_FLOAT32_C(-8.60564728e+01), SIMDE_FLOAT32_C(-3.44798355e+01), SIMDE_FLOAT32_C(-9.18562546e+01) },
+      { SIMDE_FLOAT32_C( 1.55263174e+00), SIMDE_FLOAT32_C(-2.85119438e+00), SIMDE_FLOAT32_C( 7.78403282e-02), SIMDE_FLOAT32_C(-9.31722760e-01) } },
+    { { SIMDE_FLOAT32_C(-1.27523394e+01), SIMDE_FLOAT32_C(-2.27159805e+01), SIMDE_FLOAT32_C( 2.06303062e+01), SIMDE_FLOAT32_C( 1.40355034e+01) },
+      { SIMDE_FLOAT32_C(-1.88142702e-01), SIMDE_FLOAT32_C(-8.85653257e-01), SIMDE_FLOAT32_C(-4.69275713e+00), SIMDE_FLOAT32_C( 9.80245590e+00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_tan_ps(a);
+    simde_test_svml_assert_ulp_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_tan_pd_ulp (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) },
+      { SIMDE_FLOAT64_C(   0.0000000000000000e+00), SIMDE_FLOAT64_C(  -0.0000000000000000e+00) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.5707963267948966e+00) },
+      { SIMDE_FLOAT64_C(   1.0000000000000001e-09), SIMDE_FLOAT64_C(   1.6331239353195370e+16) } },
+    { { SIMDE_FLOAT64_C(  -3.1415926535897931e+00), SIMDE_FLOAT64_C(  -1.0000000000000000e+04) },
+      { SIMDE_FLOAT64_C(   1.2246467991473532e-16), SIMDE_FLOAT64_C(  -3.2097113462381471e-01) } },
+    { { SIMDE_FLOAT64_C(   1.0000000000000000e+08), SIMDE_FLOAT64_C(  -1.0000000000000000e+15) },
+      { SIMDE_FLOAT64_C(  -2.5637789067283774e+00), SIMDE_FLOAT64_C(   1.6724147821275830e+00) } },
+    { { SIMDE_FLOAT64_C(  1.0000000000000001e+300),                        SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(   1.4214488238747245e+00),                             SIMDE_MATH_NAN } },
+    { {                       -SIMDE_MATH_INFINITY,                             SIMDE_MATH_NAN },
+      {                             SIMDE_MATH_NAN,                             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -4.6978703489051533e+01), SIMDE_FLOAT64_C(  -6.5680922831260091e+01) },
+      { SIMDE_FLOAT64_C(   1.4621512081235005e-01), SIMDE_FLOAT64_C(   3.0116242083331574e-01) } },
+    { { SIMDE_FLOAT64_C(  -8.1707689716344561e+01), SIMDE_FLOAT64_C(  -5.6029781259610161e+00) },
+      { SIMDE_FLOAT64_C(  -2.6286775173712935e-02), SIMDE_FLOAT64_C(   8.0900409646669136e-01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_tan_pd(a);
+    simde_test_svml_assert_ulp_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_tan_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -30939,6 +31650,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_atan_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_atan_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_atan_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_atan_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_atan_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_atan_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_atan_ps)
@@ -30993,6 +31706,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cos_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cos_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cos_ps)
@@ -31061,6 +31776,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_erf_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_erf_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_erf_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_erf_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_erf_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_erf_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_erf_ps)
@@ -31097,6 +31814,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_exp_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_exp_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_exp_ps)
@@ -31159,6 +31878,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_log_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_log_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_log_ps)
@@ -31209,6 +31930,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_pow_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_pow_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_pow_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_pow_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_pow_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_pow_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_pow_ps)
@@ -31255,6 +31978,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sin_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sin_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sin_ps)
@@ -31264,6 +31989,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_sincos_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_sincos_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sincos_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sincos_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sincos_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sincos_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sincos_ps)
@@ -31323,6 +32050,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_tan_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_tan_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_tan_ps_ulp)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_tan_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_tan_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_tan_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_tan_ps)